@@ -146,13 +146,12 @@ QueryResult AccessManagementClient::GetGroup(const Aws::String& groupName, Aws::
 
 QueryResult AccessManagementClient::GetPolicy(const Aws::String& policyName, Aws::IAM::Model::Policy& policyData)
 {
-    ListPoliciesRequest listPoliciesRequest;
-
-    bool done = false;
-    while(!done)
+    // the next page of policies is fetched while this one is searched
+    auto policyPages = m_iamClient->ListPoliciesPaginator(ListPoliciesRequest());
+    while(policyPages.HasMorePages())
     {
         // List the policies
-        auto outcome = m_iamClient->ListPolicies(listPoliciesRequest);
+        auto outcome = policyPages.GetNextPage();
         if (!outcome.IsSuccess())
         {
             AWS_LOGSTREAM_INFO(LOG_TAG, "ListPolicies failed: " << outcome.GetError().GetMessage() << " ( " << outcome.GetError().GetExceptionName() << " )\n");
@@ -166,20 +165,9 @@ QueryResult AccessManagementClient::GetPolicy(const Aws::String& policyName, Aws
             policyData = *policyIter;
             return QueryResult::YES;
         }
-
-        const Aws::String &marker = outcome.GetResult().GetMarker();
-        if(marker.size() > 0)
-        {
-            // If there are more policies in our account, keep looking
-            listPoliciesRequest.SetMarker(marker);
-        }
-        else
-        {
-            // bummer, couldn't find a match, give up
-            done = true;
-        }
     }
 
+    // bummer, couldn't find a match, give up
     return QueryResult::NO;
 }
 
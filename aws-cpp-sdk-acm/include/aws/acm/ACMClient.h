@@ -27,6 +27,9 @@
 #include <aws/acm/model/RequestCertificateResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -217,6 +220,18 @@ namespace Model
          */
         virtual void AddTagsToCertificateAsync(const Model::AddTagsToCertificateRequest& request, const AddTagsToCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToCertificateCallable(const Model::AddTagsToCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsToCertificateOutcomeCallable AddTagsToCertificateCallable(Model::AddTagsToCertificateRequest&& request) const;
+
+        /**
+         * Same as AddTagsToCertificateAsync(const Model::AddTagsToCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsToCertificateAsync(Model::AddTagsToCertificateRequest&& request, const AddTagsToCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an ACM Certificate and its associated private key. If this action
          * succeeds, the certificate no longer appears in the list of ACM Certificates that
@@ -254,6 +269,18 @@ namespace Model
          */
         virtual void DeleteCertificateAsync(const Model::DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCertificateCallable(const Model::DeleteCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteCertificateOutcomeCallable DeleteCertificateCallable(Model::DeleteCertificateRequest&& request) const;
+
+        /**
+         * Same as DeleteCertificateAsync(const Model::DeleteCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteCertificateAsync(Model::DeleteCertificateRequest&& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of the fields contained in the specified ACM Certificate. For
          * example, this action returns the certificate status, a flag that indicates
@@ -285,6 +312,18 @@ namespace Model
          */
         virtual void DescribeCertificateAsync(const Model::DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCertificateCallable(const Model::DescribeCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCertificateOutcomeCallable DescribeCertificateCallable(Model::DescribeCertificateRequest&& request) const;
+
+        /**
+         * Same as DescribeCertificateAsync(const Model::DescribeCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCertificateAsync(Model::DescribeCertificateRequest&& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves an ACM Certificate and certificate chain for the certificate
          * specified by an ARN. The chain is an ordered list of certificates that contains
@@ -322,6 +361,18 @@ namespace Model
          */
         virtual void GetCertificateAsync(const Model::GetCertificateRequest& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCertificateCallable(const Model::GetCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetCertificateOutcomeCallable GetCertificateCallable(Model::GetCertificateRequest&& request) const;
+
+        /**
+         * Same as GetCertificateAsync(const Model::GetCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetCertificateAsync(Model::GetCertificateRequest&& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a list of ACM Certificates and the domain name for each. You can
          * optionally filter the list to return only the certificates that match the
@@ -347,6 +398,18 @@ namespace Model
          */
         virtual void ListCertificatesAsync(const Model::ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListCertificatesCallable(const Model::ListCertificatesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListCertificatesOutcomeCallable ListCertificatesCallable(Model::ListCertificatesRequest&& request) const;
+
+        /**
+         * Same as ListCertificatesAsync(const Model::ListCertificatesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListCertificatesAsync(Model::ListCertificatesRequest&& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the tags that have been applied to the ACM Certificate. Use the
          * certificate ARN to specify the certificate. To add a tag to an ACM Certificate,
@@ -375,6 +438,18 @@ namespace Model
          */
         virtual void ListTagsForCertificateAsync(const Model::ListTagsForCertificateRequest& request, const ListTagsForCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForCertificateCallable(const Model::ListTagsForCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsForCertificateOutcomeCallable ListTagsForCertificateCallable(Model::ListTagsForCertificateRequest&& request) const;
+
+        /**
+         * Same as ListTagsForCertificateAsync(const Model::ListTagsForCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsForCertificateAsync(Model::ListTagsForCertificateRequest&& request, const ListTagsForCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Remove one or more tags from an ACM Certificate. A tag consists of a
          * key-value pair. If you do not specify the value portion of the tag when calling
@@ -412,6 +487,18 @@ namespace Model
          */
         virtual void RemoveTagsFromCertificateAsync(const Model::RemoveTagsFromCertificateRequest& request, const RemoveTagsFromCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromCertificateCallable(const Model::RemoveTagsFromCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsFromCertificateOutcomeCallable RemoveTagsFromCertificateCallable(Model::RemoveTagsFromCertificateRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsFromCertificateAsync(const Model::RemoveTagsFromCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsFromCertificateAsync(Model::RemoveTagsFromCertificateRequest&& request, const RemoveTagsFromCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests an ACM Certificate for use with other AWS services. To request an
          * ACM Certificate, you must specify the fully qualified domain name (FQDN) for
@@ -452,6 +539,18 @@ namespace Model
          */
         virtual void RequestCertificateAsync(const Model::RequestCertificateRequest& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RequestCertificateCallable(const Model::RequestCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RequestCertificateOutcomeCallable RequestCertificateCallable(Model::RequestCertificateRequest&& request) const;
+
+        /**
+         * Same as RequestCertificateAsync(const Model::RequestCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RequestCertificateAsync(Model::RequestCertificateRequest&& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Resends the email that requests domain ownership validation. The domain owner
          * or an authorized representative must approve the ACM Certificate before it can
@@ -495,6 +594,70 @@ namespace Model
          */
         virtual void ResendValidationEmailAsync(const Model::ResendValidationEmailRequest& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResendValidationEmailCallable(const Model::ResendValidationEmailRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResendValidationEmailOutcomeCallable ResendValidationEmailCallable(Model::ResendValidationEmailRequest&& request) const;
+
+        /**
+         * Same as ResendValidationEmailAsync(const Model::ResendValidationEmailRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResendValidationEmailAsync(Model::ResendValidationEmailRequest&& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListCertificates(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ACMClient, Model::ListCertificatesRequest, Model::ListCertificatesOutcome> ListCertificatesPaginator(const Model::ListCertificatesRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddTagsToCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ACMClient, Model::AddTagsToCertificateRequest, Model::AddTagsToCertificateOutcome> AddTagsToCertificateAwaitable(Model::AddTagsToCertificateRequest request) const;
+
+        /**
+         * co_await-able form of DeleteCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ACMClient, Model::DeleteCertificateRequest, Model::DeleteCertificateOutcome> DeleteCertificateAwaitable(Model::DeleteCertificateRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ACMClient, Model::DescribeCertificateRequest, Model::DescribeCertificateOutcome> DescribeCertificateAwaitable(Model::DescribeCertificateRequest request) const;
+
+        /**
+         * co_await-able form of GetCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ACMClient, Model::GetCertificateRequest, Model::GetCertificateOutcome> GetCertificateAwaitable(Model::GetCertificateRequest request) const;
+
+        /**
+         * co_await-able form of ListCertificates(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ACMClient, Model::ListCertificatesRequest, Model::ListCertificatesOutcome> ListCertificatesAwaitable(Model::ListCertificatesRequest request) const;
+
+        /**
+         * co_await-able form of ListTagsForCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ACMClient, Model::ListTagsForCertificateRequest, Model::ListTagsForCertificateOutcome> ListTagsForCertificateAwaitable(Model::ListTagsForCertificateRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTagsFromCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ACMClient, Model::RemoveTagsFromCertificateRequest, Model::RemoveTagsFromCertificateOutcome> RemoveTagsFromCertificateAwaitable(Model::RemoveTagsFromCertificateRequest request) const;
+
+        /**
+         * co_await-able form of RequestCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ACMClient, Model::RequestCertificateRequest, Model::RequestCertificateOutcome> RequestCertificateAwaitable(Model::RequestCertificateRequest request) const;
+
+        /**
+         * co_await-able form of ResendValidationEmail(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ACMClient, Model::ResendValidationEmailRequest, Model::ResendValidationEmailOutcome> ResendValidationEmailAwaitable(Model::ResendValidationEmailRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
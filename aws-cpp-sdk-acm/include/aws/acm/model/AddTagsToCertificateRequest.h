@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AddTagsToCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "AddTagsToCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
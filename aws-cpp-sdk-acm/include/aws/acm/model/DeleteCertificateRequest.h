@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
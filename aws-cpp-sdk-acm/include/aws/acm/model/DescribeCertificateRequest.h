@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
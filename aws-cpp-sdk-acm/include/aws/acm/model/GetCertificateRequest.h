@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "GetCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
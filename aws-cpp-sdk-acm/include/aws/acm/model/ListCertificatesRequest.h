@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListCertificatesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListCertificates"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
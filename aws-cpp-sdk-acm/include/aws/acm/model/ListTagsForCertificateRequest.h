@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListTagsForCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTagsForCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RemoveTagsFromCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "RemoveTagsFromCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RequestCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "RequestCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
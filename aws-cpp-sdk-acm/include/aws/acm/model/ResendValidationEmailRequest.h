@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ResendValidationEmailRequest();
+    inline const char* GetServiceRequestName() const override { return "ResendValidationEmail"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -118,7 +118,7 @@ AddTagsToCertificateOutcome ACMClient::AddTagsToCertificate(const AddTagsToCerti
 
 AddTagsToCertificateOutcomeCallable ACMClient::AddTagsToCertificateCallable(const AddTagsToCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTagsToCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTagsToCertificate(request); } );
 }
 
 void ACMClient::AddTagsToCertificateAsync(const AddTagsToCertificateRequest& request, const AddTagsToCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -126,6 +126,16 @@ void ACMClient::AddTagsToCertificateAsync(const AddTagsToCertificateRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsToCertificateAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsToCertificateOutcomeCallable ACMClient::AddTagsToCertificateCallable(AddTagsToCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ACMClient::AddTagsToCertificate, this, std::move(request)));
+}
+
+void ACMClient::AddTagsToCertificateAsync(AddTagsToCertificateRequest&& request, const AddTagsToCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ACMClient::AddTagsToCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ACMClient::AddTagsToCertificateAsyncHelper(const AddTagsToCertificateRequest& request, const AddTagsToCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTagsToCertificate(request), context);
@@ -149,7 +159,7 @@ DeleteCertificateOutcome ACMClient::DeleteCertificate(const DeleteCertificateReq
 
 DeleteCertificateOutcomeCallable ACMClient::DeleteCertificateCallable(const DeleteCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteCertificate(request); } );
 }
 
 void ACMClient::DeleteCertificateAsync(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -157,6 +167,16 @@ void ACMClient::DeleteCertificateAsync(const DeleteCertificateRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DeleteCertificateAsyncHelper( request, handler, context ); } );
 }
 
+DeleteCertificateOutcomeCallable ACMClient::DeleteCertificateCallable(DeleteCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ACMClient::DeleteCertificate, this, std::move(request)));
+}
+
+void ACMClient::DeleteCertificateAsync(DeleteCertificateRequest&& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ACMClient::DeleteCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ACMClient::DeleteCertificateAsyncHelper(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteCertificate(request), context);
@@ -180,7 +200,7 @@ DescribeCertificateOutcome ACMClient::DescribeCertificate(const DescribeCertific
 
 DescribeCertificateOutcomeCallable ACMClient::DescribeCertificateCallable(const DescribeCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCertificate(request); } );
 }
 
 void ACMClient::DescribeCertificateAsync(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -188,6 +208,16 @@ void ACMClient::DescribeCertificateAsync(const DescribeCertificateRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCertificateAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCertificateOutcomeCallable ACMClient::DescribeCertificateCallable(DescribeCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ACMClient::DescribeCertificate, this, std::move(request)));
+}
+
+void ACMClient::DescribeCertificateAsync(DescribeCertificateRequest&& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ACMClient::DescribeCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ACMClient::DescribeCertificateAsyncHelper(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCertificate(request), context);
@@ -211,7 +241,7 @@ GetCertificateOutcome ACMClient::GetCertificate(const GetCertificateRequest& req
 
 GetCertificateOutcomeCallable ACMClient::GetCertificateCallable(const GetCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetCertificate(request); } );
 }
 
 void ACMClient::GetCertificateAsync(const GetCertificateRequest& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -219,6 +249,16 @@ void ACMClient::GetCertificateAsync(const GetCertificateRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->GetCertificateAsyncHelper( request, handler, context ); } );
 }
 
+GetCertificateOutcomeCallable ACMClient::GetCertificateCallable(GetCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ACMClient::GetCertificate, this, std::move(request)));
+}
+
+void ACMClient::GetCertificateAsync(GetCertificateRequest&& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ACMClient::GetCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ACMClient::GetCertificateAsyncHelper(const GetCertificateRequest& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetCertificate(request), context);
@@ -242,7 +282,7 @@ ListCertificatesOutcome ACMClient::ListCertificates(const ListCertificatesReques
 
 ListCertificatesOutcomeCallable ACMClient::ListCertificatesCallable(const ListCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListCertificates(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListCertificates(request); } );
 }
 
 void ACMClient::ListCertificatesAsync(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -250,6 +290,16 @@ void ACMClient::ListCertificatesAsync(const ListCertificatesRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->ListCertificatesAsyncHelper( request, handler, context ); } );
 }
 
+ListCertificatesOutcomeCallable ACMClient::ListCertificatesCallable(ListCertificatesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ACMClient::ListCertificates, this, std::move(request)));
+}
+
+void ACMClient::ListCertificatesAsync(ListCertificatesRequest&& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ACMClient::ListCertificatesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ACMClient::ListCertificatesAsyncHelper(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListCertificates(request), context);
@@ -273,7 +323,7 @@ ListTagsForCertificateOutcome ACMClient::ListTagsForCertificate(const ListTagsFo
 
 ListTagsForCertificateOutcomeCallable ACMClient::ListTagsForCertificateCallable(const ListTagsForCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTagsForCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTagsForCertificate(request); } );
 }
 
 void ACMClient::ListTagsForCertificateAsync(const ListTagsForCertificateRequest& request, const ListTagsForCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -281,6 +331,16 @@ void ACMClient::ListTagsForCertificateAsync(const ListTagsForCertificateRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsForCertificateAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsForCertificateOutcomeCallable ACMClient::ListTagsForCertificateCallable(ListTagsForCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ACMClient::ListTagsForCertificate, this, std::move(request)));
+}
+
+void ACMClient::ListTagsForCertificateAsync(ListTagsForCertificateRequest&& request, const ListTagsForCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ACMClient::ListTagsForCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ACMClient::ListTagsForCertificateAsyncHelper(const ListTagsForCertificateRequest& request, const ListTagsForCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTagsForCertificate(request), context);
@@ -304,7 +364,7 @@ RemoveTagsFromCertificateOutcome ACMClient::RemoveTagsFromCertificate(const Remo
 
 RemoveTagsFromCertificateOutcomeCallable ACMClient::RemoveTagsFromCertificateCallable(const RemoveTagsFromCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTagsFromCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTagsFromCertificate(request); } );
 }
 
 void ACMClient::RemoveTagsFromCertificateAsync(const RemoveTagsFromCertificateRequest& request, const RemoveTagsFromCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -312,6 +372,16 @@ void ACMClient::RemoveTagsFromCertificateAsync(const RemoveTagsFromCertificateRe
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsFromCertificateAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsFromCertificateOutcomeCallable ACMClient::RemoveTagsFromCertificateCallable(RemoveTagsFromCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ACMClient::RemoveTagsFromCertificate, this, std::move(request)));
+}
+
+void ACMClient::RemoveTagsFromCertificateAsync(RemoveTagsFromCertificateRequest&& request, const RemoveTagsFromCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ACMClient::RemoveTagsFromCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ACMClient::RemoveTagsFromCertificateAsyncHelper(const RemoveTagsFromCertificateRequest& request, const RemoveTagsFromCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTagsFromCertificate(request), context);
@@ -335,7 +405,7 @@ RequestCertificateOutcome ACMClient::RequestCertificate(const RequestCertificate
 
 RequestCertificateOutcomeCallable ACMClient::RequestCertificateCallable(const RequestCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RequestCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RequestCertificate(request); } );
 }
 
 void ACMClient::RequestCertificateAsync(const RequestCertificateRequest& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -343,6 +413,16 @@ void ACMClient::RequestCertificateAsync(const RequestCertificateRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->RequestCertificateAsyncHelper( request, handler, context ); } );
 }
 
+RequestCertificateOutcomeCallable ACMClient::RequestCertificateCallable(RequestCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ACMClient::RequestCertificate, this, std::move(request)));
+}
+
+void ACMClient::RequestCertificateAsync(RequestCertificateRequest&& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ACMClient::RequestCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ACMClient::RequestCertificateAsyncHelper(const RequestCertificateRequest& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RequestCertificate(request), context);
@@ -366,7 +446,7 @@ ResendValidationEmailOutcome ACMClient::ResendValidationEmail(const ResendValida
 
 ResendValidationEmailOutcomeCallable ACMClient::ResendValidationEmailCallable(const ResendValidationEmailRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResendValidationEmail(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResendValidationEmail(request); } );
 }
 
 void ACMClient::ResendValidationEmailAsync(const ResendValidationEmailRequest& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -374,8 +454,82 @@ void ACMClient::ResendValidationEmailAsync(const ResendValidationEmailRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->ResendValidationEmailAsyncHelper( request, handler, context ); } );
 }
 
+ResendValidationEmailOutcomeCallable ACMClient::ResendValidationEmailCallable(ResendValidationEmailRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ACMClient::ResendValidationEmail, this, std::move(request)));
+}
+
+void ACMClient::ResendValidationEmailAsync(ResendValidationEmailRequest&& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ACMClient::ResendValidationEmailAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ACMClient::ResendValidationEmailAsyncHelper(const ResendValidationEmailRequest& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResendValidationEmail(request), context);
 }
 
+Paginator<ACMClient, ListCertificatesRequest, ListCertificatesOutcome> ACMClient::ListCertificatesPaginator(const ListCertificatesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ACMClient, ListCertificatesRequest, ListCertificatesOutcome>(this, &ACMClient::ListCertificates, request,
+    [](const ListCertificatesRequest& current, const ListCertificatesOutcome& outcome, ListCertificatesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<ACMClient, AddTagsToCertificateRequest, AddTagsToCertificateOutcome> ACMClient::AddTagsToCertificateAwaitable(AddTagsToCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &ACMClient::AddTagsToCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<ACMClient, DeleteCertificateRequest, DeleteCertificateOutcome> ACMClient::DeleteCertificateAwaitable(DeleteCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &ACMClient::DeleteCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<ACMClient, DescribeCertificateRequest, DescribeCertificateOutcome> ACMClient::DescribeCertificateAwaitable(DescribeCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &ACMClient::DescribeCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<ACMClient, GetCertificateRequest, GetCertificateOutcome> ACMClient::GetCertificateAwaitable(GetCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &ACMClient::GetCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<ACMClient, ListCertificatesRequest, ListCertificatesOutcome> ACMClient::ListCertificatesAwaitable(ListCertificatesRequest request) const
+{
+  return { m_executor.get(), { this, &ACMClient::ListCertificates, std::move(request) } };
+}
+
+ClientOperationAwaitable<ACMClient, ListTagsForCertificateRequest, ListTagsForCertificateOutcome> ACMClient::ListTagsForCertificateAwaitable(ListTagsForCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &ACMClient::ListTagsForCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<ACMClient, RemoveTagsFromCertificateRequest, RemoveTagsFromCertificateOutcome> ACMClient::RemoveTagsFromCertificateAwaitable(RemoveTagsFromCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &ACMClient::RemoveTagsFromCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<ACMClient, RequestCertificateRequest, RequestCertificateOutcome> ACMClient::RequestCertificateAwaitable(RequestCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &ACMClient::RequestCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<ACMClient, ResendValidationEmailRequest, ResendValidationEmailOutcome> ACMClient::ResendValidationEmailAwaitable(ResendValidationEmailRequest request) const
+{
+  return { m_executor.get(), { this, &ACMClient::ResendValidationEmail, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
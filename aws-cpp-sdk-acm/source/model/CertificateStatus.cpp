@@ -29,46 +29,44 @@ namespace Aws
       namespace CertificateStatusMapper
       {
 
-        static const int PENDING_VALIDATION_HASH = HashingUtils::HashString("PENDING_VALIDATION");
-        static const int ISSUED_HASH = HashingUtils::HashString("ISSUED");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-        static const int VALIDATION_TIMED_OUT_HASH = HashingUtils::HashString("VALIDATION_TIMED_OUT");
-        static const int REVOKED_HASH = HashingUtils::HashString("REVOKED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PENDING_VALIDATION_HASH = 1438135361;
+        static const int ISSUED_HASH = -2125830485;
+        static const int INACTIVE_HASH = 807292011;
+        static const int EXPIRED_HASH = -591252731;
+        static const int VALIDATION_TIMED_OUT_HASH = 1296873920;
+        static const int REVOKED_HASH = 1818119806;
+        static const int FAILED_HASH = 2066319421;
 
 
         CertificateStatus GetCertificateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_VALIDATION_HASH)
+          switch (hashCode)
           {
+          case PENDING_VALIDATION_HASH:
             return CertificateStatus::PENDING_VALIDATION;
-          }
-          else if (hashCode == ISSUED_HASH)
-          {
+          case ISSUED_HASH:
             return CertificateStatus::ISSUED;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
+          case INACTIVE_HASH:
             return CertificateStatus::INACTIVE;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
+          case EXPIRED_HASH:
             return CertificateStatus::EXPIRED;
-          }
-          else if (hashCode == VALIDATION_TIMED_OUT_HASH)
-          {
+          case VALIDATION_TIMED_OUT_HASH:
             return CertificateStatus::VALIDATION_TIMED_OUT;
-          }
-          else if (hashCode == REVOKED_HASH)
-          {
+          case REVOKED_HASH:
             return CertificateStatus::REVOKED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return CertificateStatus::FAILED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,36 +29,38 @@ namespace Aws
       namespace FailureReasonMapper
       {
 
-        static const int NO_AVAILABLE_CONTACTS_HASH = HashingUtils::HashString("NO_AVAILABLE_CONTACTS");
-        static const int ADDITIONAL_VERIFICATION_REQUIRED_HASH = HashingUtils::HashString("ADDITIONAL_VERIFICATION_REQUIRED");
-        static const int DOMAIN_NOT_ALLOWED_HASH = HashingUtils::HashString("DOMAIN_NOT_ALLOWED");
-        static const int INVALID_PUBLIC_DOMAIN_HASH = HashingUtils::HashString("INVALID_PUBLIC_DOMAIN");
-        static const int OTHER_HASH = HashingUtils::HashString("OTHER");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int NO_AVAILABLE_CONTACTS_HASH = 1112412263;
+        static const int ADDITIONAL_VERIFICATION_REQUIRED_HASH = 86162219;
+        static const int DOMAIN_NOT_ALLOWED_HASH = -1683087103;
+        static const int INVALID_PUBLIC_DOMAIN_HASH = -1326738702;
+        static const int OTHER_HASH = 75532016;
 
 
         FailureReason GetFailureReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NO_AVAILABLE_CONTACTS_HASH)
+          switch (hashCode)
           {
+          case NO_AVAILABLE_CONTACTS_HASH:
             return FailureReason::NO_AVAILABLE_CONTACTS;
-          }
-          else if (hashCode == ADDITIONAL_VERIFICATION_REQUIRED_HASH)
-          {
+          case ADDITIONAL_VERIFICATION_REQUIRED_HASH:
             return FailureReason::ADDITIONAL_VERIFICATION_REQUIRED;
-          }
-          else if (hashCode == DOMAIN_NOT_ALLOWED_HASH)
-          {
+          case DOMAIN_NOT_ALLOWED_HASH:
             return FailureReason::DOMAIN_NOT_ALLOWED;
-          }
-          else if (hashCode == INVALID_PUBLIC_DOMAIN_HASH)
-          {
+          case INVALID_PUBLIC_DOMAIN_HASH:
             return FailureReason::INVALID_PUBLIC_DOMAIN;
-          }
-          else if (hashCode == OTHER_HASH)
-          {
+          case OTHER_HASH:
             return FailureReason::OTHER;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
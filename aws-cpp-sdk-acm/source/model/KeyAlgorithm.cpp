@@ -29,21 +29,29 @@ namespace Aws
       namespace KeyAlgorithmMapper
       {
 
-        static const int RSA_2048_HASH = HashingUtils::HashString("RSA_2048");
-        static const int EC_prime256v1_HASH = HashingUtils::HashString("EC_prime256v1");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int RSA_2048_HASH = -519912447;
+        static const int EC_prime256v1_HASH = 1155394352;
 
 
         KeyAlgorithm GetKeyAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RSA_2048_HASH)
+          switch (hashCode)
           {
+          case RSA_2048_HASH:
             return KeyAlgorithm::RSA_2048;
-          }
-          else if (hashCode == EC_prime256v1_HASH)
-          {
+          case EC_prime256v1_HASH:
             return KeyAlgorithm::EC_prime256v1;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
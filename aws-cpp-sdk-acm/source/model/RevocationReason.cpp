@@ -29,61 +29,53 @@ namespace Aws
       namespace RevocationReasonMapper
       {
 
-        static const int UNSPECIFIED_HASH = HashingUtils::HashString("UNSPECIFIED");
-        static const int KEY_COMPROMISE_HASH = HashingUtils::HashString("KEY_COMPROMISE");
-        static const int CA_COMPROMISE_HASH = HashingUtils::HashString("CA_COMPROMISE");
-        static const int AFFILIATION_CHANGED_HASH = HashingUtils::HashString("AFFILIATION_CHANGED");
-        static const int SUPERCEDED_HASH = HashingUtils::HashString("SUPERCEDED");
-        static const int CESSATION_OF_OPERATION_HASH = HashingUtils::HashString("CESSATION_OF_OPERATION");
-        static const int CERTIFICATE_HOLD_HASH = HashingUtils::HashString("CERTIFICATE_HOLD");
-        static const int REMOVE_FROM_CRL_HASH = HashingUtils::HashString("REMOVE_FROM_CRL");
-        static const int PRIVILEGE_WITHDRAWN_HASH = HashingUtils::HashString("PRIVILEGE_WITHDRAWN");
-        static const int A_A_COMPROMISE_HASH = HashingUtils::HashString("A_A_COMPROMISE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int UNSPECIFIED_HASH = 526786327;
+        static const int KEY_COMPROMISE_HASH = 1784301178;
+        static const int CA_COMPROMISE_HASH = -1464686853;
+        static const int AFFILIATION_CHANGED_HASH = 1816386597;
+        static const int SUPERCEDED_HASH = -1229818426;
+        static const int CESSATION_OF_OPERATION_HASH = -351852597;
+        static const int CERTIFICATE_HOLD_HASH = 1933025927;
+        static const int REMOVE_FROM_CRL_HASH = -1931970301;
+        static const int PRIVILEGE_WITHDRAWN_HASH = -1038997930;
+        static const int A_A_COMPROMISE_HASH = 408391286;
 
 
         RevocationReason GetRevocationReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNSPECIFIED_HASH)
+          switch (hashCode)
           {
+          case UNSPECIFIED_HASH:
             return RevocationReason::UNSPECIFIED;
-          }
-          else if (hashCode == KEY_COMPROMISE_HASH)
-          {
+          case KEY_COMPROMISE_HASH:
             return RevocationReason::KEY_COMPROMISE;
-          }
-          else if (hashCode == CA_COMPROMISE_HASH)
-          {
+          case CA_COMPROMISE_HASH:
             return RevocationReason::CA_COMPROMISE;
-          }
-          else if (hashCode == AFFILIATION_CHANGED_HASH)
-          {
+          case AFFILIATION_CHANGED_HASH:
             return RevocationReason::AFFILIATION_CHANGED;
-          }
-          else if (hashCode == SUPERCEDED_HASH)
-          {
+          case SUPERCEDED_HASH:
             return RevocationReason::SUPERCEDED;
-          }
-          else if (hashCode == CESSATION_OF_OPERATION_HASH)
-          {
+          case CESSATION_OF_OPERATION_HASH:
             return RevocationReason::CESSATION_OF_OPERATION;
-          }
-          else if (hashCode == CERTIFICATE_HOLD_HASH)
-          {
+          case CERTIFICATE_HOLD_HASH:
             return RevocationReason::CERTIFICATE_HOLD;
-          }
-          else if (hashCode == REMOVE_FROM_CRL_HASH)
-          {
+          case REMOVE_FROM_CRL_HASH:
             return RevocationReason::REMOVE_FROM_CRL;
-          }
-          else if (hashCode == PRIVILEGE_WITHDRAWN_HASH)
-          {
+          case PRIVILEGE_WITHDRAWN_HASH:
             return RevocationReason::PRIVILEGE_WITHDRAWN;
-          }
-          else if (hashCode == A_A_COMPROMISE_HASH)
-          {
+          case A_A_COMPROMISE_HASH:
             return RevocationReason::A_A_COMPROMISE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
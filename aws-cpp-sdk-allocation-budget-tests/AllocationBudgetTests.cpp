@@ -0,0 +1,355 @@
+/*
+ * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ * 
+ *  http://aws.amazon.com/apache2.0
+ * 
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/dynamodb/DynamoDBClient.h>
+#include <aws/dynamodb/model/GetItemRequest.h>
+#include <aws/dynamodb/model/PutItemRequest.h>
+#include <aws/s3/S3Client.h>
+#include <aws/s3/model/GetObjectRequest.h>
+#include <aws/s3/model/PutObjectRequest.h>
+#include <aws/sqs/SQSClient.h>
+#include <aws/sqs/model/ReceiveMessageRequest.h>
+#include <aws/sqs/model/SendMessageRequest.h>
+
+#ifdef USE_AWS_MEMORY_MANAGEMENT
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+
+/*
+ * Each test below drives one representative operation of the generated DynamoDB, S3 and SQS clients through the full
+ * pipeline (request serialization, the http client and result parsing) against canned responses, and fails if a single
+ * call makes more allocations or allocates more bytes through the AWS memory system than its checked-in budget.
+ *
+ * The clients are given empty credentials, which the signer passes through unsigned, so the budgets do not depend on
+ * which crypto backend the platform provides. When a change legitimately alters the numbers, the failure message
+ * reports the measured values; update the budget and explain why in the commit.
+ */
+
+static const char* BUDGET_TEST_TAG = "AllocationBudgetTest";
+
+struct AllocationBudget
+{
+    uint64_t allocations;
+    uint64_t bytes;
+};
+
+// measured with libstdc++ on x86_64, plus roughly 20% headroom for other standard libraries
+static const AllocationBudget DYNAMODB_GET_ITEM_BUDGET = { 250, 13600 };
+static const AllocationBudget DYNAMODB_PUT_ITEM_BUDGET = { 145, 9100 };
+static const AllocationBudget S3_PUT_OBJECT_BUDGET = { 57, 8000 };
+static const AllocationBudget S3_GET_OBJECT_BUDGET = { 50, 3400 };
+static const AllocationBudget SQS_SEND_MESSAGE_BUDGET = { 62, 16300 };
+static const AllocationBudget SQS_RECEIVE_MESSAGE_BUDGET = { 70, 18700 };
+
+namespace
+{
+
+class CannedHttpClient : public HttpClient
+{
+public:
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
+    {
+        AWS_UNREFERENCED_PARAM(request);
+        AWS_UNREFERENCED_PARAM(readLimiter);
+        AWS_UNREFERENCED_PARAM(writeLimiter);
+
+        //responses are built before measuring starts, so handing one out must not allocate.
+        if (m_nextResponse < m_responses.size())
+        {
+            return m_responses[m_nextResponse++];
+        }
+        return nullptr;
+    }
+
+    void AddResponse(const std::shared_ptr<HttpResponse>& response) { m_responses.push_back(response); }
+
+private:
+    Aws::Vector<std::shared_ptr<HttpResponse>> m_responses;
+    mutable size_t m_nextResponse = 0;
+};
+
+class CannedHttpClientFactory : public HttpClientFactory
+{
+public:
+    CannedHttpClientFactory(const std::shared_ptr<CannedHttpClient>& client) : m_client(client) {}
+
+    std::shared_ptr<HttpClient> CreateHttpClient(const ClientConfiguration& clientConfiguration) const override
+    {
+        AWS_UNREFERENCED_PARAM(clientConfiguration);
+        return m_client;
+    }
+
+    std::shared_ptr<HttpRequest> CreateHttpRequest(const Aws::String& uri, HttpMethod method, const Aws::IOStreamFactory& streamFactory) const override
+    {
+        return CreateHttpRequest(URI(uri), method, streamFactory);
+    }
+
+    std::shared_ptr<HttpRequest> CreateHttpRequest(const URI& uri, HttpMethod method, const Aws::IOStreamFactory& streamFactory) const override
+    {
+        auto request = Aws::MakeShared<Standard::StandardHttpRequest>(BUDGET_TEST_TAG, uri, method);
+        request->SetResponseStreamFactory(streamFactory);
+        return request;
+    }
+
+private:
+    std::shared_ptr<CannedHttpClient> m_client;
+};
+
+struct MeasuredCall
+{
+    MeasuredCall() : succeeded(false), allocations(0), bytes(0), clean(false) {}
+
+    bool succeeded;
+    uint64_t allocations;
+    uint64_t bytes;
+    bool clean;
+};
+
+class AllocationBudgetTest : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        SetHttpClientFactory(nullptr);
+        InitHttp();
+    }
+
+    static std::shared_ptr<HttpResponse> BuildResponse(const HttpRequest& originatingRequest, const char* body,
+        const char* headerName = nullptr, const char* headerValue = nullptr)
+    {
+        auto response = Aws::MakeShared<Standard::StandardHttpResponse>(BUDGET_TEST_TAG, originatingRequest);
+        response->SetResponseCode(HttpResponseCode::OK);
+        response->AddHeader("x-amzn-requestid", "0f8a58a6-7c9b-4d2a-bd2e-2c3a8a6f3e1d");
+        if (headerName)
+        {
+            response->AddHeader(headerName, headerValue);
+        }
+        response->GetResponseBody() << body;
+        return response;
+    }
+
+    /*
+     * Creates the client, runs the call once to warm up anything created lazily, then once more while counting. Everything
+     * lives inside an exact memory test, so a leak in the pipeline is reported as well.
+     */
+    template<typename ClientType, typename CallFn>
+    static MeasuredCall Measure(const char* responseBody, const char* headerName, const char* headerValue, const CallFn& call)
+    {
+        MeasuredCall measured;
+        //the default factory was allocated before the test memory system was installed, so it has to go first.
+        SetHttpClientFactory(nullptr);
+
+        ExactTestMemorySystem memorySystem(1024, 128);
+        Aws::Utils::Memory::InitializeAWSMemorySystem(memorySystem);
+        {
+            auto httpClient = Aws::MakeShared<CannedHttpClient>(BUDGET_TEST_TAG);
+            SetHttpClientFactory(Aws::MakeShared<CannedHttpClientFactory>(BUDGET_TEST_TAG, httpClient));
+
+            Standard::StandardHttpRequest cannedRequest(URI("https://canned.amazonaws.com"), HttpMethod::HTTP_POST);
+            cannedRequest.SetResponseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+            httpClient->AddResponse(BuildResponse(cannedRequest, responseBody, headerName, headerValue));
+            httpClient->AddResponse(BuildResponse(cannedRequest, responseBody, headerName, headerValue));
+
+            ClientConfiguration configuration;
+            ClientType client(Aws::Auth::AWSCredentials(), configuration);
+            bool warmedUp = call(client);
+
+            uint64_t allocationsBefore = memorySystem.GetTotalAllocationCount();
+            uint64_t bytesBefore = memorySystem.GetTotalBytesAllocated();
+            measured.succeeded = call(client) && warmedUp;
+            measured.allocations = memorySystem.GetTotalAllocationCount() - allocationsBefore;
+            measured.bytes = memorySystem.GetTotalBytesAllocated() - bytesBefore;
+
+        }
+        SetHttpClientFactory(nullptr);
+        Aws::Utils::Memory::ShutdownAWSMemorySystem();
+        measured.clean = memorySystem.IsClean();
+
+        return measured;
+    }
+
+    static void CheckBudget(const char* operation, const MeasuredCall& measured, const AllocationBudget& budget)
+    {
+        ASSERT_TRUE(measured.succeeded) << operation;
+        ASSERT_TRUE(measured.clean) << operation << " leaked memory";
+        EXPECT_LE(measured.allocations, budget.allocations) << operation << " made " << measured.allocations
+            << " allocations (" << measured.bytes << " bytes)";
+        EXPECT_LE(measured.bytes, budget.bytes) << operation << " allocated " << measured.bytes
+            << " bytes in " << measured.allocations << " allocations";
+    }
+};
+
+} // anonymous namespace
+
+TEST_F(AllocationBudgetTest, DynamoDBGetItem)
+{
+    MeasuredCall measured = Measure<Aws::DynamoDB::DynamoDBClient>(
+        "{\"Item\":{\"id\":{\"S\":\"user-1234\"},\"name\":{\"S\":\"Jane Doe\"},\"email\":{\"S\":\"jane@example.com\"}}}",
+        nullptr, nullptr,
+        [](const Aws::DynamoDB::DynamoDBClient& client)
+        {
+            Aws::DynamoDB::Model::GetItemRequest request;
+            request.SetTableName("Users");
+            request.AddKey("id", Aws::DynamoDB::Model::AttributeValue("user-1234"));
+            request.SetConsistentRead(true);
+
+            Aws::DynamoDB::Model::GetItemOutcome outcome = client.GetItem(request);
+            return outcome.IsSuccess() && outcome.GetResult().GetItem().size() == 3 &&
+                outcome.GetResult().GetItem().at("name").GetS() == "Jane Doe";
+        });
+
+    CheckBudget("DynamoDB GetItem", measured, DYNAMODB_GET_ITEM_BUDGET);
+}
+
+TEST_F(AllocationBudgetTest, DynamoDBPutItem)
+{
+    MeasuredCall measured = Measure<Aws::DynamoDB::DynamoDBClient>(
+        "{}",
+        nullptr, nullptr,
+        [](const Aws::DynamoDB::DynamoDBClient& client)
+        {
+            Aws::DynamoDB::Model::PutItemRequest request;
+            request.SetTableName("Users");
+            request.AddItem("id", Aws::DynamoDB::Model::AttributeValue("user-1234"));
+            request.AddItem("name", Aws::DynamoDB::Model::AttributeValue("Jane Doe"));
+            request.AddItem("email", Aws::DynamoDB::Model::AttributeValue("jane@example.com"));
+
+            Aws::DynamoDB::Model::PutItemOutcome outcome = client.PutItem(request);
+            return outcome.IsSuccess() && outcome.GetResult().GetAttributes().empty();
+        });
+
+    CheckBudget("DynamoDB PutItem", measured, DYNAMODB_PUT_ITEM_BUDGET);
+}
+
+TEST_F(AllocationBudgetTest, S3PutObject)
+{
+    MeasuredCall measured = Measure<Aws::S3::S3Client>(
+        "",
+        "etag", "\"9b2cf535f27731c974343645a3985328\"",
+        [](const Aws::S3::S3Client& client)
+        {
+            Aws::S3::Model::PutObjectRequest request;
+            request.SetBucket("bucket");
+            request.SetKey("key");
+            request.SetStorageClass(Aws::S3::Model::StorageClass::STANDARD);
+            auto body = Aws::MakeShared<Aws::StringStream>(BUDGET_TEST_TAG);
+            *body << Aws::String(1024, 'x');
+            request.SetBody(body);
+
+            Aws::S3::Model::PutObjectOutcome outcome = client.PutObject(request);
+            return outcome.IsSuccess() && outcome.GetResult().GetETag() == "\"9b2cf535f27731c974343645a3985328\"";
+        });
+
+    CheckBudget("S3 PutObject", measured, S3_PUT_OBJECT_BUDGET);
+}
+
+TEST_F(AllocationBudgetTest, S3GetObject)
+{
+    static const Aws::String objectBody(1024, 'y');
+
+    MeasuredCall measured = Measure<Aws::S3::S3Client>(
+        objectBody.c_str(),
+        "etag", "\"9b2cf535f27731c974343645a3985328\"",
+        [](const Aws::S3::S3Client& client)
+        {
+            Aws::S3::Model::GetObjectRequest request;
+            request.SetBucket("bucket");
+            request.SetKey("key");
+
+            Aws::S3::Model::GetObjectOutcome outcome = client.GetObject(request);
+            if (!outcome.IsSuccess())
+            {
+                return false;
+            }
+
+            char buffer[256];
+            size_t bytesRead = 0;
+            Aws::IOStream& body = outcome.GetResult().GetBody();
+            while (body.read(buffer, sizeof(buffer)) || body.gcount() > 0)
+            {
+                bytesRead += static_cast<size_t>(body.gcount());
+            }
+            return bytesRead == 1024;
+        });
+
+    CheckBudget("S3 GetObject", measured, S3_GET_OBJECT_BUDGET);
+}
+
+TEST_F(AllocationBudgetTest, SQSSendMessage)
+{
+    MeasuredCall measured = Measure<Aws::SQS::SQSClient>(
+        "<SendMessageResponse><SendMessageResult>"
+        "<MD5OfMessageBody>fafb00f5732ab283681e124bf8747ed1</MD5OfMessageBody>"
+        "<MessageId>5fea7756-0ea4-451a-a703-a558b933e274</MessageId>"
+        "</SendMessageResult><ResponseMetadata><RequestId>27daac76-34dd-47df-bd01-1f6e873584a0</RequestId></ResponseMetadata>"
+        "</SendMessageResponse>",
+        nullptr, nullptr,
+        [](const Aws::SQS::SQSClient& client)
+        {
+            Aws::SQS::Model::SendMessageRequest request;
+            request.SetQueueUrl("https://sqs.us-east-1.amazonaws.com/123456789012/queue");
+            request.SetMessageBody("This is a test message");
+
+            Aws::SQS::Model::SendMessageOutcome outcome = client.SendMessage(request);
+            return outcome.IsSuccess() && outcome.GetResult().GetMessageId() == "5fea7756-0ea4-451a-a703-a558b933e274";
+        });
+
+    CheckBudget("SQS SendMessage", measured, SQS_SEND_MESSAGE_BUDGET);
+}
+
+TEST_F(AllocationBudgetTest, SQSReceiveMessage)
+{
+    MeasuredCall measured = Measure<Aws::SQS::SQSClient>(
+        "<ReceiveMessageResponse><ReceiveMessageResult>"
+        "<Message><MessageId>5fea7756-0ea4-451a-a703-a558b933e274</MessageId>"
+        "<ReceiptHandle>MbZj6wDWli+JvwwJaBV+3dcjk2YW2vA3+STFFljTM8tJJg6HRG6PYSasuWXPJB+Cw==</ReceiptHandle>"
+        "<MD5OfBody>fafb00f5732ab283681e124bf8747ed1</MD5OfBody><Body>This is a test message</Body></Message>"
+        "<Message><MessageId>6aa1e2a7-1c7b-4a44-9d3c-5a1bcbf6b0c2</MessageId>"
+        "<ReceiptHandle>NcAk7xEXmj+KwxxKbCW+4edkl3ZX3wB4+TUGGmkUN9uKKh7ISH7QZTbtvXYQKC+Dx==</ReceiptHandle>"
+        "<MD5OfBody>fafb00f5732ab283681e124bf8747ed1</MD5OfBody><Body>This is a test message</Body></Message>"
+        "</ReceiveMessageResult><ResponseMetadata><RequestId>b6633655-283d-45b4-aee4-4e84e0ae6afa</RequestId></ResponseMetadata>"
+        "</ReceiveMessageResponse>",
+        nullptr, nullptr,
+        [](const Aws::SQS::SQSClient& client)
+        {
+            Aws::SQS::Model::ReceiveMessageRequest request;
+            request.SetQueueUrl("https://sqs.us-east-1.amazonaws.com/123456789012/queue");
+            request.SetMaxNumberOfMessages(10);
+            request.SetWaitTimeSeconds(20);
+
+            Aws::SQS::Model::ReceiveMessageOutcome outcome = client.ReceiveMessage(request);
+            return outcome.IsSuccess() && outcome.GetResult().GetMessages().size() == 2 &&
+                outcome.GetResult().GetMessages()[1].GetBody() == "This is a test message";
+        });
+
+    CheckBudget("SQS ReceiveMessage", measured, SQS_RECEIVE_MESSAGE_BUDGET);
+}
+
+#endif // USE_AWS_MEMORY_MANAGEMENT
@@ -93,6 +93,9 @@
 #include <aws/apigateway/model/UpdateUsagePlanResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -558,6 +561,18 @@ namespace Model
          */
         virtual void CreateApiKeyAsync(const Model::CreateApiKeyRequest& request, const CreateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateApiKeyCallable(const Model::CreateApiKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateApiKeyOutcomeCallable CreateApiKeyCallable(Model::CreateApiKeyRequest&& request) const;
+
+        /**
+         * Same as CreateApiKeyAsync(const Model::CreateApiKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateApiKeyAsync(Model::CreateApiKeyRequest&& request, const CreateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds a new <a>Authorizer</a> resource to an existing <a>RestApi</a>
          * resource.</p> <div class="seeAlso"><a
@@ -586,6 +601,18 @@ namespace Model
          */
         virtual void CreateAuthorizerAsync(const Model::CreateAuthorizerRequest& request, const CreateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAuthorizerCallable(const Model::CreateAuthorizerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateAuthorizerOutcomeCallable CreateAuthorizerCallable(Model::CreateAuthorizerRequest&& request) const;
+
+        /**
+         * Same as CreateAuthorizerAsync(const Model::CreateAuthorizerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateAuthorizerAsync(Model::CreateAuthorizerRequest&& request, const CreateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new <a>BasePathMapping</a> resource.</p>
          */
@@ -605,6 +632,18 @@ namespace Model
          */
         virtual void CreateBasePathMappingAsync(const Model::CreateBasePathMappingRequest& request, const CreateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateBasePathMappingCallable(const Model::CreateBasePathMappingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateBasePathMappingOutcomeCallable CreateBasePathMappingCallable(Model::CreateBasePathMappingRequest&& request) const;
+
+        /**
+         * Same as CreateBasePathMappingAsync(const Model::CreateBasePathMappingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateBasePathMappingAsync(Model::CreateBasePathMappingRequest&& request, const CreateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <a>Deployment</a> resource, which makes a specified <a>RestApi</a>
          * callable over the internet.</p>
@@ -627,6 +666,18 @@ namespace Model
          */
         virtual void CreateDeploymentAsync(const Model::CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDeploymentCallable(const Model::CreateDeploymentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDeploymentOutcomeCallable CreateDeploymentCallable(Model::CreateDeploymentRequest&& request) const;
+
+        /**
+         * Same as CreateDeploymentAsync(const Model::CreateDeploymentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDeploymentAsync(Model::CreateDeploymentRequest&& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new domain name.</p>
          */
@@ -646,6 +697,18 @@ namespace Model
          */
         virtual void CreateDomainNameAsync(const Model::CreateDomainNameRequest& request, const CreateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDomainNameCallable(const Model::CreateDomainNameRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDomainNameOutcomeCallable CreateDomainNameCallable(Model::CreateDomainNameRequest&& request) const;
+
+        /**
+         * Same as CreateDomainNameAsync(const Model::CreateDomainNameRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDomainNameAsync(Model::CreateDomainNameRequest&& request, const CreateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds a new <a>Model</a> resource to an existing <a>RestApi</a> resource.</p>
          */
@@ -665,6 +728,18 @@ namespace Model
          */
         virtual void CreateModelAsync(const Model::CreateModelRequest& request, const CreateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateModelCallable(const Model::CreateModelRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateModelOutcomeCallable CreateModelCallable(Model::CreateModelRequest&& request) const;
+
+        /**
+         * Same as CreateModelAsync(const Model::CreateModelRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateModelAsync(Model::CreateModelRequest&& request, const CreateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <a>Resource</a> resource.</p>
          */
@@ -684,6 +759,18 @@ namespace Model
          */
         virtual void CreateResourceAsync(const Model::CreateResourceRequest& request, const CreateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateResourceCallable(const Model::CreateResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateResourceOutcomeCallable CreateResourceCallable(Model::CreateResourceRequest&& request) const;
+
+        /**
+         * Same as CreateResourceAsync(const Model::CreateResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateResourceAsync(Model::CreateResourceRequest&& request, const CreateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new <a>RestApi</a> resource.</p>
          */
@@ -703,6 +790,18 @@ namespace Model
          */
         virtual void CreateRestApiAsync(const Model::CreateRestApiRequest& request, const CreateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRestApiCallable(const Model::CreateRestApiRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateRestApiOutcomeCallable CreateRestApiCallable(Model::CreateRestApiRequest&& request) const;
+
+        /**
+         * Same as CreateRestApiAsync(const Model::CreateRestApiRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateRestApiAsync(Model::CreateRestApiRequest&& request, const CreateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new <a>Stage</a> resource that references a pre-existing
          * <a>Deployment</a> for the API. </p>
@@ -725,6 +824,18 @@ namespace Model
          */
         virtual void CreateStageAsync(const Model::CreateStageRequest& request, const CreateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateStageCallable(const Model::CreateStageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateStageOutcomeCallable CreateStageCallable(Model::CreateStageRequest&& request) const;
+
+        /**
+         * Same as CreateStageAsync(const Model::CreateStageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateStageAsync(Model::CreateStageRequest&& request, const CreateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a usage plan with the throttle and quota limits, as well as the
          * associated API stages, specified in the payload. </p>
@@ -747,6 +858,18 @@ namespace Model
          */
         virtual void CreateUsagePlanAsync(const Model::CreateUsagePlanRequest& request, const CreateUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateUsagePlanCallable(const Model::CreateUsagePlanRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateUsagePlanOutcomeCallable CreateUsagePlanCallable(Model::CreateUsagePlanRequest&& request) const;
+
+        /**
+         * Same as CreateUsagePlanAsync(const Model::CreateUsagePlanRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateUsagePlanAsync(Model::CreateUsagePlanRequest&& request, const CreateUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a usage plan key for adding an existing API key to a usage plan.</p>
          */
@@ -766,6 +889,18 @@ namespace Model
          */
         virtual void CreateUsagePlanKeyAsync(const Model::CreateUsagePlanKeyRequest& request, const CreateUsagePlanKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateUsagePlanKeyCallable(const Model::CreateUsagePlanKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateUsagePlanKeyOutcomeCallable CreateUsagePlanKeyCallable(Model::CreateUsagePlanKeyRequest&& request) const;
+
+        /**
+         * Same as CreateUsagePlanKeyAsync(const Model::CreateUsagePlanKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateUsagePlanKeyAsync(Model::CreateUsagePlanKeyRequest&& request, const CreateUsagePlanKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the <a>ApiKey</a> resource.</p>
          */
@@ -785,6 +920,18 @@ namespace Model
          */
         virtual void DeleteApiKeyAsync(const Model::DeleteApiKeyRequest& request, const DeleteApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteApiKeyCallable(const Model::DeleteApiKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteApiKeyOutcomeCallable DeleteApiKeyCallable(Model::DeleteApiKeyRequest&& request) const;
+
+        /**
+         * Same as DeleteApiKeyAsync(const Model::DeleteApiKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteApiKeyAsync(Model::DeleteApiKeyRequest&& request, const DeleteApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an existing <a>Authorizer</a> resource.</p> <div class="seeAlso"><a
          * href="http://docs.aws.amazon.com/cli/latest/reference/apigateway/delete-authorizer.html">AWS
@@ -810,6 +957,18 @@ namespace Model
          */
         virtual void DeleteAuthorizerAsync(const Model::DeleteAuthorizerRequest& request, const DeleteAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAuthorizerCallable(const Model::DeleteAuthorizerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteAuthorizerOutcomeCallable DeleteAuthorizerCallable(Model::DeleteAuthorizerRequest&& request) const;
+
+        /**
+         * Same as DeleteAuthorizerAsync(const Model::DeleteAuthorizerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteAuthorizerAsync(Model::DeleteAuthorizerRequest&& request, const DeleteAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the <a>BasePathMapping</a> resource.</p>
          */
@@ -829,6 +988,18 @@ namespace Model
          */
         virtual void DeleteBasePathMappingAsync(const Model::DeleteBasePathMappingRequest& request, const DeleteBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBasePathMappingCallable(const Model::DeleteBasePathMappingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteBasePathMappingOutcomeCallable DeleteBasePathMappingCallable(Model::DeleteBasePathMappingRequest&& request) const;
+
+        /**
+         * Same as DeleteBasePathMappingAsync(const Model::DeleteBasePathMappingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteBasePathMappingAsync(Model::DeleteBasePathMappingRequest&& request, const DeleteBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the <a>ClientCertificate</a> resource.</p>
          */
@@ -848,6 +1019,18 @@ namespace Model
          */
         virtual void DeleteClientCertificateAsync(const Model::DeleteClientCertificateRequest& request, const DeleteClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteClientCertificateCallable(const Model::DeleteClientCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteClientCertificateOutcomeCallable DeleteClientCertificateCallable(Model::DeleteClientCertificateRequest&& request) const;
+
+        /**
+         * Same as DeleteClientCertificateAsync(const Model::DeleteClientCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteClientCertificateAsync(Model::DeleteClientCertificateRequest&& request, const DeleteClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a <a>Deployment</a> resource. Deleting a deployment will only succeed
          * if there are no <a>Stage</a> resources associated with it.</p>
@@ -870,6 +1053,18 @@ namespace Model
          */
         virtual void DeleteDeploymentAsync(const Model::DeleteDeploymentRequest& request, const DeleteDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDeploymentCallable(const Model::DeleteDeploymentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDeploymentOutcomeCallable DeleteDeploymentCallable(Model::DeleteDeploymentRequest&& request) const;
+
+        /**
+         * Same as DeleteDeploymentAsync(const Model::DeleteDeploymentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDeploymentAsync(Model::DeleteDeploymentRequest&& request, const DeleteDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the <a>DomainName</a> resource.</p>
          */
@@ -889,6 +1084,18 @@ namespace Model
          */
         virtual void DeleteDomainNameAsync(const Model::DeleteDomainNameRequest& request, const DeleteDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDomainNameCallable(const Model::DeleteDomainNameRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDomainNameOutcomeCallable DeleteDomainNameCallable(Model::DeleteDomainNameRequest&& request) const;
+
+        /**
+         * Same as DeleteDomainNameAsync(const Model::DeleteDomainNameRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDomainNameAsync(Model::DeleteDomainNameRequest&& request, const DeleteDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a delete integration.</p>
          */
@@ -908,6 +1115,18 @@ namespace Model
          */
         virtual void DeleteIntegrationAsync(const Model::DeleteIntegrationRequest& request, const DeleteIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIntegrationCallable(const Model::DeleteIntegrationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteIntegrationOutcomeCallable DeleteIntegrationCallable(Model::DeleteIntegrationRequest&& request) const;
+
+        /**
+         * Same as DeleteIntegrationAsync(const Model::DeleteIntegrationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteIntegrationAsync(Model::DeleteIntegrationRequest&& request, const DeleteIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a delete integration response.</p>
          */
@@ -927,6 +1146,18 @@ namespace Model
          */
         virtual void DeleteIntegrationResponseAsync(const Model::DeleteIntegrationResponseRequest& request, const DeleteIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIntegrationResponseCallable(const Model::DeleteIntegrationResponseRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteIntegrationResponseOutcomeCallable DeleteIntegrationResponseCallable(Model::DeleteIntegrationResponseRequest&& request) const;
+
+        /**
+         * Same as DeleteIntegrationResponseAsync(const Model::DeleteIntegrationResponseRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteIntegrationResponseAsync(Model::DeleteIntegrationResponseRequest&& request, const DeleteIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an existing <a>Method</a> resource.</p>
          */
@@ -946,6 +1177,18 @@ namespace Model
          */
         virtual void DeleteMethodAsync(const Model::DeleteMethodRequest& request, const DeleteMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteMethodCallable(const Model::DeleteMethodRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteMethodOutcomeCallable DeleteMethodCallable(Model::DeleteMethodRequest&& request) const;
+
+        /**
+         * Same as DeleteMethodAsync(const Model::DeleteMethodRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteMethodAsync(Model::DeleteMethodRequest&& request, const DeleteMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an existing <a>MethodResponse</a> resource.</p>
          */
@@ -965,6 +1208,18 @@ namespace Model
          */
         virtual void DeleteMethodResponseAsync(const Model::DeleteMethodResponseRequest& request, const DeleteMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteMethodResponseCallable(const Model::DeleteMethodResponseRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteMethodResponseOutcomeCallable DeleteMethodResponseCallable(Model::DeleteMethodResponseRequest&& request) const;
+
+        /**
+         * Same as DeleteMethodResponseAsync(const Model::DeleteMethodResponseRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteMethodResponseAsync(Model::DeleteMethodResponseRequest&& request, const DeleteMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a model.</p>
          */
@@ -984,6 +1239,18 @@ namespace Model
          */
         virtual void DeleteModelAsync(const Model::DeleteModelRequest& request, const DeleteModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteModelCallable(const Model::DeleteModelRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteModelOutcomeCallable DeleteModelCallable(Model::DeleteModelRequest&& request) const;
+
+        /**
+         * Same as DeleteModelAsync(const Model::DeleteModelRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteModelAsync(Model::DeleteModelRequest&& request, const DeleteModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a <a>Resource</a> resource.</p>
          */
@@ -1003,6 +1270,18 @@ namespace Model
          */
         virtual void DeleteResourceAsync(const Model::DeleteResourceRequest& request, const DeleteResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteResourceCallable(const Model::DeleteResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteResourceOutcomeCallable DeleteResourceCallable(Model::DeleteResourceRequest&& request) const;
+
+        /**
+         * Same as DeleteResourceAsync(const Model::DeleteResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteResourceAsync(Model::DeleteResourceRequest&& request, const DeleteResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified API.</p>
          */
@@ -1022,6 +1301,18 @@ namespace Model
          */
         virtual void DeleteRestApiAsync(const Model::DeleteRestApiRequest& request, const DeleteRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRestApiCallable(const Model::DeleteRestApiRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRestApiOutcomeCallable DeleteRestApiCallable(Model::DeleteRestApiRequest&& request) const;
+
+        /**
+         * Same as DeleteRestApiAsync(const Model::DeleteRestApiRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRestApiAsync(Model::DeleteRestApiRequest&& request, const DeleteRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a <a>Stage</a> resource.</p>
          */
@@ -1041,6 +1332,18 @@ namespace Model
          */
         virtual void DeleteStageAsync(const Model::DeleteStageRequest& request, const DeleteStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteStageCallable(const Model::DeleteStageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteStageOutcomeCallable DeleteStageCallable(Model::DeleteStageRequest&& request) const;
+
+        /**
+         * Same as DeleteStageAsync(const Model::DeleteStageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteStageAsync(Model::DeleteStageRequest&& request, const DeleteStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a usage plan of a given plan Id.</p>
          */
@@ -1060,6 +1363,18 @@ namespace Model
          */
         virtual void DeleteUsagePlanAsync(const Model::DeleteUsagePlanRequest& request, const DeleteUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteUsagePlanCallable(const Model::DeleteUsagePlanRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteUsagePlanOutcomeCallable DeleteUsagePlanCallable(Model::DeleteUsagePlanRequest&& request) const;
+
+        /**
+         * Same as DeleteUsagePlanAsync(const Model::DeleteUsagePlanRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteUsagePlanAsync(Model::DeleteUsagePlanRequest&& request, const DeleteUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a usage plan key and remove the underlying API key from the
          * associated usage plan.</p>
@@ -1082,6 +1397,18 @@ namespace Model
          */
         virtual void DeleteUsagePlanKeyAsync(const Model::DeleteUsagePlanKeyRequest& request, const DeleteUsagePlanKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteUsagePlanKeyCallable(const Model::DeleteUsagePlanKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteUsagePlanKeyOutcomeCallable DeleteUsagePlanKeyCallable(Model::DeleteUsagePlanKeyRequest&& request) const;
+
+        /**
+         * Same as DeleteUsagePlanKeyAsync(const Model::DeleteUsagePlanKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteUsagePlanKeyAsync(Model::DeleteUsagePlanKeyRequest&& request, const DeleteUsagePlanKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Flushes all authorizer cache entries on a stage.</p>
          */
@@ -1101,6 +1428,18 @@ namespace Model
          */
         virtual void FlushStageAuthorizersCacheAsync(const Model::FlushStageAuthorizersCacheRequest& request, const FlushStageAuthorizersCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as FlushStageAuthorizersCacheCallable(const Model::FlushStageAuthorizersCacheRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::FlushStageAuthorizersCacheOutcomeCallable FlushStageAuthorizersCacheCallable(Model::FlushStageAuthorizersCacheRequest&& request) const;
+
+        /**
+         * Same as FlushStageAuthorizersCacheAsync(const Model::FlushStageAuthorizersCacheRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void FlushStageAuthorizersCacheAsync(Model::FlushStageAuthorizersCacheRequest&& request, const FlushStageAuthorizersCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Flushes a stage's cache.</p>
          */
@@ -1120,6 +1459,18 @@ namespace Model
          */
         virtual void FlushStageCacheAsync(const Model::FlushStageCacheRequest& request, const FlushStageCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as FlushStageCacheCallable(const Model::FlushStageCacheRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::FlushStageCacheOutcomeCallable FlushStageCacheCallable(Model::FlushStageCacheRequest&& request) const;
+
+        /**
+         * Same as FlushStageCacheAsync(const Model::FlushStageCacheRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void FlushStageCacheAsync(Model::FlushStageCacheRequest&& request, const FlushStageCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates a <a>ClientCertificate</a> resource.</p>
          */
@@ -1139,6 +1490,18 @@ namespace Model
          */
         virtual void GenerateClientCertificateAsync(const Model::GenerateClientCertificateRequest& request, const GenerateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GenerateClientCertificateCallable(const Model::GenerateClientCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GenerateClientCertificateOutcomeCallable GenerateClientCertificateCallable(Model::GenerateClientCertificateRequest&& request) const;
+
+        /**
+         * Same as GenerateClientCertificateAsync(const Model::GenerateClientCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GenerateClientCertificateAsync(Model::GenerateClientCertificateRequest&& request, const GenerateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the current <a>Account</a> resource.</p>
          */
@@ -1158,6 +1521,18 @@ namespace Model
          */
         virtual void GetAccountAsync(const Model::GetAccountRequest& request, const GetAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAccountCallable(const Model::GetAccountRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetAccountOutcomeCallable GetAccountCallable(Model::GetAccountRequest&& request) const;
+
+        /**
+         * Same as GetAccountAsync(const Model::GetAccountRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetAccountAsync(Model::GetAccountRequest&& request, const GetAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the current <a>ApiKey</a> resource.</p>
          */
@@ -1177,6 +1552,18 @@ namespace Model
          */
         virtual void GetApiKeyAsync(const Model::GetApiKeyRequest& request, const GetApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetApiKeyCallable(const Model::GetApiKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetApiKeyOutcomeCallable GetApiKeyCallable(Model::GetApiKeyRequest&& request) const;
+
+        /**
+         * Same as GetApiKeyAsync(const Model::GetApiKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetApiKeyAsync(Model::GetApiKeyRequest&& request, const GetApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the current <a>ApiKeys</a> resource.</p>
          */
@@ -1196,6 +1583,18 @@ namespace Model
          */
         virtual void GetApiKeysAsync(const Model::GetApiKeysRequest& request, const GetApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetApiKeysCallable(const Model::GetApiKeysRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetApiKeysOutcomeCallable GetApiKeysCallable(Model::GetApiKeysRequest&& request) const;
+
+        /**
+         * Same as GetApiKeysAsync(const Model::GetApiKeysRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetApiKeysAsync(Model::GetApiKeysRequest&& request, const GetApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describe an existing <a>Authorizer</a> resource.</p> <div class="seeAlso"><a
          * href="http://docs.aws.amazon.com/cli/latest/reference/apigateway/get-authorizer.html">AWS
@@ -1221,6 +1620,18 @@ namespace Model
          */
         virtual void GetAuthorizerAsync(const Model::GetAuthorizerRequest& request, const GetAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAuthorizerCallable(const Model::GetAuthorizerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetAuthorizerOutcomeCallable GetAuthorizerCallable(Model::GetAuthorizerRequest&& request) const;
+
+        /**
+         * Same as GetAuthorizerAsync(const Model::GetAuthorizerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetAuthorizerAsync(Model::GetAuthorizerRequest&& request, const GetAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describe an existing <a>Authorizers</a> resource.</p> <div class="seeAlso"><a
          * href="http://docs.aws.amazon.com/cli/latest/reference/apigateway/get-authorizers.html">AWS
@@ -1246,6 +1657,18 @@ namespace Model
          */
         virtual void GetAuthorizersAsync(const Model::GetAuthorizersRequest& request, const GetAuthorizersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAuthorizersCallable(const Model::GetAuthorizersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetAuthorizersOutcomeCallable GetAuthorizersCallable(Model::GetAuthorizersRequest&& request) const;
+
+        /**
+         * Same as GetAuthorizersAsync(const Model::GetAuthorizersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetAuthorizersAsync(Model::GetAuthorizersRequest&& request, const GetAuthorizersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describe a <a>BasePathMapping</a> resource.</p>
          */
@@ -1265,6 +1688,18 @@ namespace Model
          */
         virtual void GetBasePathMappingAsync(const Model::GetBasePathMappingRequest& request, const GetBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBasePathMappingCallable(const Model::GetBasePathMappingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBasePathMappingOutcomeCallable GetBasePathMappingCallable(Model::GetBasePathMappingRequest&& request) const;
+
+        /**
+         * Same as GetBasePathMappingAsync(const Model::GetBasePathMappingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBasePathMappingAsync(Model::GetBasePathMappingRequest&& request, const GetBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a collection of <a>BasePathMapping</a> resources.</p>
          */
@@ -1284,6 +1719,18 @@ namespace Model
          */
         virtual void GetBasePathMappingsAsync(const Model::GetBasePathMappingsRequest& request, const GetBasePathMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBasePathMappingsCallable(const Model::GetBasePathMappingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBasePathMappingsOutcomeCallable GetBasePathMappingsCallable(Model::GetBasePathMappingsRequest&& request) const;
+
+        /**
+         * Same as GetBasePathMappingsAsync(const Model::GetBasePathMappingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBasePathMappingsAsync(Model::GetBasePathMappingsRequest&& request, const GetBasePathMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the current <a>ClientCertificate</a> resource.</p>
          */
@@ -1303,6 +1750,18 @@ namespace Model
          */
         virtual void GetClientCertificateAsync(const Model::GetClientCertificateRequest& request, const GetClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetClientCertificateCallable(const Model::GetClientCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetClientCertificateOutcomeCallable GetClientCertificateCallable(Model::GetClientCertificateRequest&& request) const;
+
+        /**
+         * Same as GetClientCertificateAsync(const Model::GetClientCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetClientCertificateAsync(Model::GetClientCertificateRequest&& request, const GetClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a collection of <a>ClientCertificate</a> resources.</p>
          */
@@ -1322,6 +1781,18 @@ namespace Model
          */
         virtual void GetClientCertificatesAsync(const Model::GetClientCertificatesRequest& request, const GetClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetClientCertificatesCallable(const Model::GetClientCertificatesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetClientCertificatesOutcomeCallable GetClientCertificatesCallable(Model::GetClientCertificatesRequest&& request) const;
+
+        /**
+         * Same as GetClientCertificatesAsync(const Model::GetClientCertificatesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetClientCertificatesAsync(Model::GetClientCertificatesRequest&& request, const GetClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a <a>Deployment</a> resource.</p>
          */
@@ -1341,6 +1812,18 @@ namespace Model
          */
         virtual void GetDeploymentAsync(const Model::GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDeploymentCallable(const Model::GetDeploymentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDeploymentOutcomeCallable GetDeploymentCallable(Model::GetDeploymentRequest&& request) const;
+
+        /**
+         * Same as GetDeploymentAsync(const Model::GetDeploymentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDeploymentAsync(Model::GetDeploymentRequest&& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a <a>Deployments</a> collection.</p>
          */
@@ -1360,6 +1843,18 @@ namespace Model
          */
         virtual void GetDeploymentsAsync(const Model::GetDeploymentsRequest& request, const GetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDeploymentsCallable(const Model::GetDeploymentsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDeploymentsOutcomeCallable GetDeploymentsCallable(Model::GetDeploymentsRequest&& request) const;
+
+        /**
+         * Same as GetDeploymentsAsync(const Model::GetDeploymentsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDeploymentsAsync(Model::GetDeploymentsRequest&& request, const GetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a domain name that is contained in a simpler, more intuitive URL
          * that can be called.</p>
@@ -1382,6 +1877,18 @@ namespace Model
          */
         virtual void GetDomainNameAsync(const Model::GetDomainNameRequest& request, const GetDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDomainNameCallable(const Model::GetDomainNameRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDomainNameOutcomeCallable GetDomainNameCallable(Model::GetDomainNameRequest&& request) const;
+
+        /**
+         * Same as GetDomainNameAsync(const Model::GetDomainNameRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDomainNameAsync(Model::GetDomainNameRequest&& request, const GetDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a collection of <a>DomainName</a> resources.</p>
          */
@@ -1402,13 +1909,25 @@ namespace Model
         virtual void GetDomainNamesAsync(const Model::GetDomainNamesRequest& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
         /**
-         * <p>Exports a deployed version of a <a>RestApi</a> in a specified format.</p>
+         * Same as GetDomainNamesCallable(const Model::GetDomainNamesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
          */
-        virtual Model::GetExportOutcome GetExport(const Model::GetExportRequest& request) const;
+        virtual Model::GetDomainNamesOutcomeCallable GetDomainNamesCallable(Model::GetDomainNamesRequest&& request) const;
 
         /**
-         * <p>Exports a deployed version of a <a>RestApi</a> in a specified format.</p>
-         *
+         * Same as GetDomainNamesAsync(const Model::GetDomainNamesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDomainNamesAsync(Model::GetDomainNamesRequest&& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+        /**
+         * <p>Exports a deployed version of a <a>RestApi</a> in a specified format.</p>
+         */
+        virtual Model::GetExportOutcome GetExport(const Model::GetExportRequest& request) const;
+
+        /**
+         * <p>Exports a deployed version of a <a>RestApi</a> in a specified format.</p>
+         *
          * returns a future to the operation so that it can be executed in parallel to other requests.
          */
         virtual Model::GetExportOutcomeCallable GetExportCallable(const Model::GetExportRequest& request) const;
@@ -1420,6 +1939,18 @@ namespace Model
          */
         virtual void GetExportAsync(const Model::GetExportRequest& request, const GetExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetExportCallable(const Model::GetExportRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetExportOutcomeCallable GetExportCallable(Model::GetExportRequest&& request) const;
+
+        /**
+         * Same as GetExportAsync(const Model::GetExportRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetExportAsync(Model::GetExportRequest&& request, const GetExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a get integration.</p>
          */
@@ -1439,6 +1970,18 @@ namespace Model
          */
         virtual void GetIntegrationAsync(const Model::GetIntegrationRequest& request, const GetIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIntegrationCallable(const Model::GetIntegrationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetIntegrationOutcomeCallable GetIntegrationCallable(Model::GetIntegrationRequest&& request) const;
+
+        /**
+         * Same as GetIntegrationAsync(const Model::GetIntegrationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetIntegrationAsync(Model::GetIntegrationRequest&& request, const GetIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a get integration response.</p>
          */
@@ -1458,6 +2001,18 @@ namespace Model
          */
         virtual void GetIntegrationResponseAsync(const Model::GetIntegrationResponseRequest& request, const GetIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIntegrationResponseCallable(const Model::GetIntegrationResponseRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetIntegrationResponseOutcomeCallable GetIntegrationResponseCallable(Model::GetIntegrationResponseRequest&& request) const;
+
+        /**
+         * Same as GetIntegrationResponseAsync(const Model::GetIntegrationResponseRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetIntegrationResponseAsync(Model::GetIntegrationResponseRequest&& request, const GetIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describe an existing <a>Method</a> resource.</p>
          */
@@ -1477,6 +2032,18 @@ namespace Model
          */
         virtual void GetMethodAsync(const Model::GetMethodRequest& request, const GetMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetMethodCallable(const Model::GetMethodRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetMethodOutcomeCallable GetMethodCallable(Model::GetMethodRequest&& request) const;
+
+        /**
+         * Same as GetMethodAsync(const Model::GetMethodRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetMethodAsync(Model::GetMethodRequest&& request, const GetMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes a <a>MethodResponse</a> resource.</p>
          */
@@ -1496,6 +2063,18 @@ namespace Model
          */
         virtual void GetMethodResponseAsync(const Model::GetMethodResponseRequest& request, const GetMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetMethodResponseCallable(const Model::GetMethodResponseRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetMethodResponseOutcomeCallable GetMethodResponseCallable(Model::GetMethodResponseRequest&& request) const;
+
+        /**
+         * Same as GetMethodResponseAsync(const Model::GetMethodResponseRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetMethodResponseAsync(Model::GetMethodResponseRequest&& request, const GetMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes an existing model defined for a <a>RestApi</a> resource.</p>
          */
@@ -1515,6 +2094,18 @@ namespace Model
          */
         virtual void GetModelAsync(const Model::GetModelRequest& request, const GetModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetModelCallable(const Model::GetModelRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetModelOutcomeCallable GetModelCallable(Model::GetModelRequest&& request) const;
+
+        /**
+         * Same as GetModelAsync(const Model::GetModelRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetModelAsync(Model::GetModelRequest&& request, const GetModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates a sample mapping template that can be used to transform a payload
          * into the structure of a model.</p>
@@ -1537,6 +2128,18 @@ namespace Model
          */
         virtual void GetModelTemplateAsync(const Model::GetModelTemplateRequest& request, const GetModelTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetModelTemplateCallable(const Model::GetModelTemplateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetModelTemplateOutcomeCallable GetModelTemplateCallable(Model::GetModelTemplateRequest&& request) const;
+
+        /**
+         * Same as GetModelTemplateAsync(const Model::GetModelTemplateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetModelTemplateAsync(Model::GetModelTemplateRequest&& request, const GetModelTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes existing <a>Models</a> defined for a <a>RestApi</a> resource.</p>
          */
@@ -1556,6 +2159,18 @@ namespace Model
          */
         virtual void GetModelsAsync(const Model::GetModelsRequest& request, const GetModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetModelsCallable(const Model::GetModelsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetModelsOutcomeCallable GetModelsCallable(Model::GetModelsRequest&& request) const;
+
+        /**
+         * Same as GetModelsAsync(const Model::GetModelsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetModelsAsync(Model::GetModelsRequest&& request, const GetModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists information about a resource.</p>
          */
@@ -1575,6 +2190,18 @@ namespace Model
          */
         virtual void GetResourceAsync(const Model::GetResourceRequest& request, const GetResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetResourceCallable(const Model::GetResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetResourceOutcomeCallable GetResourceCallable(Model::GetResourceRequest&& request) const;
+
+        /**
+         * Same as GetResourceAsync(const Model::GetResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetResourceAsync(Model::GetResourceRequest&& request, const GetResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists information about a collection of <a>Resource</a> resources.</p>
          */
@@ -1594,6 +2221,18 @@ namespace Model
          */
         virtual void GetResourcesAsync(const Model::GetResourcesRequest& request, const GetResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetResourcesCallable(const Model::GetResourcesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetResourcesOutcomeCallable GetResourcesCallable(Model::GetResourcesRequest&& request) const;
+
+        /**
+         * Same as GetResourcesAsync(const Model::GetResourcesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetResourcesAsync(Model::GetResourcesRequest&& request, const GetResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the <a>RestApi</a> resource in the collection.</p>
          */
@@ -1613,6 +2252,18 @@ namespace Model
          */
         virtual void GetRestApiAsync(const Model::GetRestApiRequest& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRestApiCallable(const Model::GetRestApiRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetRestApiOutcomeCallable GetRestApiCallable(Model::GetRestApiRequest&& request) const;
+
+        /**
+         * Same as GetRestApiAsync(const Model::GetRestApiRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetRestApiAsync(Model::GetRestApiRequest&& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the <a>RestApis</a> resources for your collection.</p>
          */
@@ -1632,6 +2283,18 @@ namespace Model
          */
         virtual void GetRestApisAsync(const Model::GetRestApisRequest& request, const GetRestApisResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRestApisCallable(const Model::GetRestApisRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetRestApisOutcomeCallable GetRestApisCallable(Model::GetRestApisRequest&& request) const;
+
+        /**
+         * Same as GetRestApisAsync(const Model::GetRestApisRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetRestApisAsync(Model::GetRestApisRequest&& request, const GetRestApisResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates a client SDK for a <a>RestApi</a> and <a>Stage</a>.</p>
          */
@@ -1651,6 +2314,18 @@ namespace Model
          */
         virtual void GetSdkAsync(const Model::GetSdkRequest& request, const GetSdkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSdkCallable(const Model::GetSdkRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetSdkOutcomeCallable GetSdkCallable(Model::GetSdkRequest&& request) const;
+
+        /**
+         * Same as GetSdkAsync(const Model::GetSdkRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetSdkAsync(Model::GetSdkRequest&& request, const GetSdkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a <a>Stage</a> resource.</p>
          */
@@ -1670,6 +2345,18 @@ namespace Model
          */
         virtual void GetStageAsync(const Model::GetStageRequest& request, const GetStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetStageCallable(const Model::GetStageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetStageOutcomeCallable GetStageCallable(Model::GetStageRequest&& request) const;
+
+        /**
+         * Same as GetStageAsync(const Model::GetStageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetStageAsync(Model::GetStageRequest&& request, const GetStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more <a>Stage</a> resources.</p>
          */
@@ -1689,6 +2376,18 @@ namespace Model
          */
         virtual void GetStagesAsync(const Model::GetStagesRequest& request, const GetStagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetStagesCallable(const Model::GetStagesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetStagesOutcomeCallable GetStagesCallable(Model::GetStagesRequest&& request) const;
+
+        /**
+         * Same as GetStagesAsync(const Model::GetStagesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetStagesAsync(Model::GetStagesRequest&& request, const GetStagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the usage data of a usage plan in a specified time interval.</p>
          */
@@ -1708,6 +2407,18 @@ namespace Model
          */
         virtual void GetUsageAsync(const Model::GetUsageRequest& request, const GetUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetUsageCallable(const Model::GetUsageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetUsageOutcomeCallable GetUsageCallable(Model::GetUsageRequest&& request) const;
+
+        /**
+         * Same as GetUsageAsync(const Model::GetUsageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetUsageAsync(Model::GetUsageRequest&& request, const GetUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a usage plan of a given plan identifier.</p>
          */
@@ -1727,6 +2438,18 @@ namespace Model
          */
         virtual void GetUsagePlanAsync(const Model::GetUsagePlanRequest& request, const GetUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetUsagePlanCallable(const Model::GetUsagePlanRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetUsagePlanOutcomeCallable GetUsagePlanCallable(Model::GetUsagePlanRequest&& request) const;
+
+        /**
+         * Same as GetUsagePlanAsync(const Model::GetUsagePlanRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetUsagePlanAsync(Model::GetUsagePlanRequest&& request, const GetUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a usage plan key of a given key identifier.</p>
          */
@@ -1746,6 +2469,18 @@ namespace Model
          */
         virtual void GetUsagePlanKeyAsync(const Model::GetUsagePlanKeyRequest& request, const GetUsagePlanKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetUsagePlanKeyCallable(const Model::GetUsagePlanKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetUsagePlanKeyOutcomeCallable GetUsagePlanKeyCallable(Model::GetUsagePlanKeyRequest&& request) const;
+
+        /**
+         * Same as GetUsagePlanKeyAsync(const Model::GetUsagePlanKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetUsagePlanKeyAsync(Model::GetUsagePlanKeyRequest&& request, const GetUsagePlanKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets all the usage plan keys representing the API keys added to a specified
          * usage plan.</p>
@@ -1768,6 +2503,18 @@ namespace Model
          */
         virtual void GetUsagePlanKeysAsync(const Model::GetUsagePlanKeysRequest& request, const GetUsagePlanKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetUsagePlanKeysCallable(const Model::GetUsagePlanKeysRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetUsagePlanKeysOutcomeCallable GetUsagePlanKeysCallable(Model::GetUsagePlanKeysRequest&& request) const;
+
+        /**
+         * Same as GetUsagePlanKeysAsync(const Model::GetUsagePlanKeysRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetUsagePlanKeysAsync(Model::GetUsagePlanKeysRequest&& request, const GetUsagePlanKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets all the usage plans of the caller's account.</p>
          */
@@ -1787,6 +2534,18 @@ namespace Model
          */
         virtual void GetUsagePlansAsync(const Model::GetUsagePlansRequest& request, const GetUsagePlansResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetUsagePlansCallable(const Model::GetUsagePlansRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetUsagePlansOutcomeCallable GetUsagePlansCallable(Model::GetUsagePlansRequest&& request) const;
+
+        /**
+         * Same as GetUsagePlansAsync(const Model::GetUsagePlansRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetUsagePlansAsync(Model::GetUsagePlansRequest&& request, const GetUsagePlansResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Import API keys from an external source, such as a CSV-formatted file.</p>
          */
@@ -1806,6 +2565,18 @@ namespace Model
          */
         virtual void ImportApiKeysAsync(const Model::ImportApiKeysRequest& request, const ImportApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ImportApiKeysCallable(const Model::ImportApiKeysRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ImportApiKeysOutcomeCallable ImportApiKeysCallable(Model::ImportApiKeysRequest&& request) const;
+
+        /**
+         * Same as ImportApiKeysAsync(const Model::ImportApiKeysRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ImportApiKeysAsync(Model::ImportApiKeysRequest&& request, const ImportApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>A feature of the Amazon API Gateway control service for creating a new API
          * from an external API definition file.</p>
@@ -1828,6 +2599,18 @@ namespace Model
          */
         virtual void ImportRestApiAsync(const Model::ImportRestApiRequest& request, const ImportRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ImportRestApiCallable(const Model::ImportRestApiRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ImportRestApiOutcomeCallable ImportRestApiCallable(Model::ImportRestApiRequest&& request) const;
+
+        /**
+         * Same as ImportRestApiAsync(const Model::ImportRestApiRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ImportRestApiAsync(Model::ImportRestApiRequest&& request, const ImportRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a put integration.</p>
          */
@@ -1847,6 +2630,18 @@ namespace Model
          */
         virtual void PutIntegrationAsync(const Model::PutIntegrationRequest& request, const PutIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutIntegrationCallable(const Model::PutIntegrationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutIntegrationOutcomeCallable PutIntegrationCallable(Model::PutIntegrationRequest&& request) const;
+
+        /**
+         * Same as PutIntegrationAsync(const Model::PutIntegrationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutIntegrationAsync(Model::PutIntegrationRequest&& request, const PutIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a put integration.</p>
          */
@@ -1866,6 +2661,18 @@ namespace Model
          */
         virtual void PutIntegrationResponseAsync(const Model::PutIntegrationResponseRequest& request, const PutIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutIntegrationResponseCallable(const Model::PutIntegrationResponseRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutIntegrationResponseOutcomeCallable PutIntegrationResponseCallable(Model::PutIntegrationResponseRequest&& request) const;
+
+        /**
+         * Same as PutIntegrationResponseAsync(const Model::PutIntegrationResponseRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutIntegrationResponseAsync(Model::PutIntegrationResponseRequest&& request, const PutIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Add a method to an existing <a>Resource</a> resource.</p>
          */
@@ -1885,6 +2692,18 @@ namespace Model
          */
         virtual void PutMethodAsync(const Model::PutMethodRequest& request, const PutMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutMethodCallable(const Model::PutMethodRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutMethodOutcomeCallable PutMethodCallable(Model::PutMethodRequest&& request) const;
+
+        /**
+         * Same as PutMethodAsync(const Model::PutMethodRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutMethodAsync(Model::PutMethodRequest&& request, const PutMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds a <a>MethodResponse</a> to an existing <a>Method</a> resource.</p>
          */
@@ -1904,6 +2723,18 @@ namespace Model
          */
         virtual void PutMethodResponseAsync(const Model::PutMethodResponseRequest& request, const PutMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutMethodResponseCallable(const Model::PutMethodResponseRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutMethodResponseOutcomeCallable PutMethodResponseCallable(Model::PutMethodResponseRequest&& request) const;
+
+        /**
+         * Same as PutMethodResponseAsync(const Model::PutMethodResponseRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutMethodResponseAsync(Model::PutMethodResponseRequest&& request, const PutMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>A feature of the Amazon API Gateway control service for updating an existing
          * API with an input of external API definitions. The update can take the form of
@@ -1932,6 +2763,18 @@ namespace Model
          */
         virtual void PutRestApiAsync(const Model::PutRestApiRequest& request, const PutRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRestApiCallable(const Model::PutRestApiRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutRestApiOutcomeCallable PutRestApiCallable(Model::PutRestApiRequest&& request) const;
+
+        /**
+         * Same as PutRestApiAsync(const Model::PutRestApiRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutRestApiAsync(Model::PutRestApiRequest&& request, const PutRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Simulate the execution of an <a>Authorizer</a> in your <a>RestApi</a> with
          * headers, parameters, and an incoming request body.</p> <div class="seeAlso"> <a
@@ -1960,6 +2803,18 @@ namespace Model
          */
         virtual void TestInvokeAuthorizerAsync(const Model::TestInvokeAuthorizerRequest& request, const TestInvokeAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TestInvokeAuthorizerCallable(const Model::TestInvokeAuthorizerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TestInvokeAuthorizerOutcomeCallable TestInvokeAuthorizerCallable(Model::TestInvokeAuthorizerRequest&& request) const;
+
+        /**
+         * Same as TestInvokeAuthorizerAsync(const Model::TestInvokeAuthorizerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TestInvokeAuthorizerAsync(Model::TestInvokeAuthorizerRequest&& request, const TestInvokeAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Simulate the execution of a <a>Method</a> in your <a>RestApi</a> with
          * headers, parameters, and an incoming request body.</p>
@@ -1982,6 +2837,18 @@ namespace Model
          */
         virtual void TestInvokeMethodAsync(const Model::TestInvokeMethodRequest& request, const TestInvokeMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TestInvokeMethodCallable(const Model::TestInvokeMethodRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TestInvokeMethodOutcomeCallable TestInvokeMethodCallable(Model::TestInvokeMethodRequest&& request) const;
+
+        /**
+         * Same as TestInvokeMethodAsync(const Model::TestInvokeMethodRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TestInvokeMethodAsync(Model::TestInvokeMethodRequest&& request, const TestInvokeMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about the current <a>Account</a> resource.</p>
          */
@@ -2001,6 +2868,18 @@ namespace Model
          */
         virtual void UpdateAccountAsync(const Model::UpdateAccountRequest& request, const UpdateAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAccountCallable(const Model::UpdateAccountRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateAccountOutcomeCallable UpdateAccountCallable(Model::UpdateAccountRequest&& request) const;
+
+        /**
+         * Same as UpdateAccountAsync(const Model::UpdateAccountRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateAccountAsync(Model::UpdateAccountRequest&& request, const UpdateAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about an <a>ApiKey</a> resource.</p>
          */
@@ -2020,6 +2899,18 @@ namespace Model
          */
         virtual void UpdateApiKeyAsync(const Model::UpdateApiKeyRequest& request, const UpdateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateApiKeyCallable(const Model::UpdateApiKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateApiKeyOutcomeCallable UpdateApiKeyCallable(Model::UpdateApiKeyRequest&& request) const;
+
+        /**
+         * Same as UpdateApiKeyAsync(const Model::UpdateApiKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateApiKeyAsync(Model::UpdateApiKeyRequest&& request, const UpdateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates an existing <a>Authorizer</a> resource.</p> <div class="seeAlso"><a
          * href="http://docs.aws.amazon.com/cli/latest/reference/apigateway/update-authorizer.html">AWS
@@ -2045,6 +2936,18 @@ namespace Model
          */
         virtual void UpdateAuthorizerAsync(const Model::UpdateAuthorizerRequest& request, const UpdateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAuthorizerCallable(const Model::UpdateAuthorizerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateAuthorizerOutcomeCallable UpdateAuthorizerCallable(Model::UpdateAuthorizerRequest&& request) const;
+
+        /**
+         * Same as UpdateAuthorizerAsync(const Model::UpdateAuthorizerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateAuthorizerAsync(Model::UpdateAuthorizerRequest&& request, const UpdateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about the <a>BasePathMapping</a> resource.</p>
          */
@@ -2064,6 +2967,18 @@ namespace Model
          */
         virtual void UpdateBasePathMappingAsync(const Model::UpdateBasePathMappingRequest& request, const UpdateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateBasePathMappingCallable(const Model::UpdateBasePathMappingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateBasePathMappingOutcomeCallable UpdateBasePathMappingCallable(Model::UpdateBasePathMappingRequest&& request) const;
+
+        /**
+         * Same as UpdateBasePathMappingAsync(const Model::UpdateBasePathMappingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateBasePathMappingAsync(Model::UpdateBasePathMappingRequest&& request, const UpdateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about an <a>ClientCertificate</a> resource.</p>
          */
@@ -2083,6 +2998,18 @@ namespace Model
          */
         virtual void UpdateClientCertificateAsync(const Model::UpdateClientCertificateRequest& request, const UpdateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateClientCertificateCallable(const Model::UpdateClientCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateClientCertificateOutcomeCallable UpdateClientCertificateCallable(Model::UpdateClientCertificateRequest&& request) const;
+
+        /**
+         * Same as UpdateClientCertificateAsync(const Model::UpdateClientCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateClientCertificateAsync(Model::UpdateClientCertificateRequest&& request, const UpdateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about a <a>Deployment</a> resource.</p>
          */
@@ -2102,6 +3029,18 @@ namespace Model
          */
         virtual void UpdateDeploymentAsync(const Model::UpdateDeploymentRequest& request, const UpdateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDeploymentCallable(const Model::UpdateDeploymentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateDeploymentOutcomeCallable UpdateDeploymentCallable(Model::UpdateDeploymentRequest&& request) const;
+
+        /**
+         * Same as UpdateDeploymentAsync(const Model::UpdateDeploymentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateDeploymentAsync(Model::UpdateDeploymentRequest&& request, const UpdateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about the <a>DomainName</a> resource.</p>
          */
@@ -2121,6 +3060,18 @@ namespace Model
          */
         virtual void UpdateDomainNameAsync(const Model::UpdateDomainNameRequest& request, const UpdateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDomainNameCallable(const Model::UpdateDomainNameRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateDomainNameOutcomeCallable UpdateDomainNameCallable(Model::UpdateDomainNameRequest&& request) const;
+
+        /**
+         * Same as UpdateDomainNameAsync(const Model::UpdateDomainNameRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateDomainNameAsync(Model::UpdateDomainNameRequest&& request, const UpdateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents an update integration.</p>
          */
@@ -2140,6 +3091,18 @@ namespace Model
          */
         virtual void UpdateIntegrationAsync(const Model::UpdateIntegrationRequest& request, const UpdateIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateIntegrationCallable(const Model::UpdateIntegrationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateIntegrationOutcomeCallable UpdateIntegrationCallable(Model::UpdateIntegrationRequest&& request) const;
+
+        /**
+         * Same as UpdateIntegrationAsync(const Model::UpdateIntegrationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateIntegrationAsync(Model::UpdateIntegrationRequest&& request, const UpdateIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents an update integration response.</p>
          */
@@ -2159,6 +3122,18 @@ namespace Model
          */
         virtual void UpdateIntegrationResponseAsync(const Model::UpdateIntegrationResponseRequest& request, const UpdateIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateIntegrationResponseCallable(const Model::UpdateIntegrationResponseRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateIntegrationResponseOutcomeCallable UpdateIntegrationResponseCallable(Model::UpdateIntegrationResponseRequest&& request) const;
+
+        /**
+         * Same as UpdateIntegrationResponseAsync(const Model::UpdateIntegrationResponseRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateIntegrationResponseAsync(Model::UpdateIntegrationResponseRequest&& request, const UpdateIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates an existing <a>Method</a> resource.</p>
          */
@@ -2178,6 +3153,18 @@ namespace Model
          */
         virtual void UpdateMethodAsync(const Model::UpdateMethodRequest& request, const UpdateMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateMethodCallable(const Model::UpdateMethodRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateMethodOutcomeCallable UpdateMethodCallable(Model::UpdateMethodRequest&& request) const;
+
+        /**
+         * Same as UpdateMethodAsync(const Model::UpdateMethodRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateMethodAsync(Model::UpdateMethodRequest&& request, const UpdateMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates an existing <a>MethodResponse</a> resource.</p>
          */
@@ -2197,6 +3184,18 @@ namespace Model
          */
         virtual void UpdateMethodResponseAsync(const Model::UpdateMethodResponseRequest& request, const UpdateMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateMethodResponseCallable(const Model::UpdateMethodResponseRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateMethodResponseOutcomeCallable UpdateMethodResponseCallable(Model::UpdateMethodResponseRequest&& request) const;
+
+        /**
+         * Same as UpdateMethodResponseAsync(const Model::UpdateMethodResponseRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateMethodResponseAsync(Model::UpdateMethodResponseRequest&& request, const UpdateMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about a model.</p>
          */
@@ -2216,6 +3215,18 @@ namespace Model
          */
         virtual void UpdateModelAsync(const Model::UpdateModelRequest& request, const UpdateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateModelCallable(const Model::UpdateModelRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateModelOutcomeCallable UpdateModelCallable(Model::UpdateModelRequest&& request) const;
+
+        /**
+         * Same as UpdateModelAsync(const Model::UpdateModelRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateModelAsync(Model::UpdateModelRequest&& request, const UpdateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about a <a>Resource</a> resource.</p>
          */
@@ -2235,6 +3246,18 @@ namespace Model
          */
         virtual void UpdateResourceAsync(const Model::UpdateResourceRequest& request, const UpdateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateResourceCallable(const Model::UpdateResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateResourceOutcomeCallable UpdateResourceCallable(Model::UpdateResourceRequest&& request) const;
+
+        /**
+         * Same as UpdateResourceAsync(const Model::UpdateResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateResourceAsync(Model::UpdateResourceRequest&& request, const UpdateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about the specified API.</p>
          */
@@ -2254,6 +3277,18 @@ namespace Model
          */
         virtual void UpdateRestApiAsync(const Model::UpdateRestApiRequest& request, const UpdateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateRestApiCallable(const Model::UpdateRestApiRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateRestApiOutcomeCallable UpdateRestApiCallable(Model::UpdateRestApiRequest&& request) const;
+
+        /**
+         * Same as UpdateRestApiAsync(const Model::UpdateRestApiRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateRestApiAsync(Model::UpdateRestApiRequest&& request, const UpdateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about a <a>Stage</a> resource.</p>
          */
@@ -2273,6 +3308,18 @@ namespace Model
          */
         virtual void UpdateStageAsync(const Model::UpdateStageRequest& request, const UpdateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateStageCallable(const Model::UpdateStageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateStageOutcomeCallable UpdateStageCallable(Model::UpdateStageRequest&& request) const;
+
+        /**
+         * Same as UpdateStageAsync(const Model::UpdateStageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateStageAsync(Model::UpdateStageRequest&& request, const UpdateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Grants a temporary extension to the reamining quota of a usage plan
          * associated with a specified API key.</p>
@@ -2295,6 +3342,18 @@ namespace Model
          */
         virtual void UpdateUsageAsync(const Model::UpdateUsageRequest& request, const UpdateUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateUsageCallable(const Model::UpdateUsageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateUsageOutcomeCallable UpdateUsageCallable(Model::UpdateUsageRequest&& request) const;
+
+        /**
+         * Same as UpdateUsageAsync(const Model::UpdateUsageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateUsageAsync(Model::UpdateUsageRequest&& request, const UpdateUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a usage plan of a given plan Id.</p>
          */
@@ -2314,6 +3373,525 @@ namespace Model
          */
         virtual void UpdateUsagePlanAsync(const Model::UpdateUsagePlanRequest& request, const UpdateUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateUsagePlanCallable(const Model::UpdateUsagePlanRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateUsagePlanOutcomeCallable UpdateUsagePlanCallable(Model::UpdateUsagePlanRequest&& request) const;
+
+        /**
+         * Same as UpdateUsagePlanAsync(const Model::UpdateUsagePlanRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateUsagePlanAsync(Model::UpdateUsagePlanRequest&& request, const UpdateUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through GetApiKeys(), following Position; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<APIGatewayClient, Model::GetApiKeysRequest, Model::GetApiKeysOutcome> GetApiKeysPaginator(const Model::GetApiKeysRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through GetAuthorizers(), following Position; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<APIGatewayClient, Model::GetAuthorizersRequest, Model::GetAuthorizersOutcome> GetAuthorizersPaginator(const Model::GetAuthorizersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through GetBasePathMappings(), following Position; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<APIGatewayClient, Model::GetBasePathMappingsRequest, Model::GetBasePathMappingsOutcome> GetBasePathMappingsPaginator(const Model::GetBasePathMappingsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through GetClientCertificates(), following Position; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<APIGatewayClient, Model::GetClientCertificatesRequest, Model::GetClientCertificatesOutcome> GetClientCertificatesPaginator(const Model::GetClientCertificatesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through GetDeployments(), following Position; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<APIGatewayClient, Model::GetDeploymentsRequest, Model::GetDeploymentsOutcome> GetDeploymentsPaginator(const Model::GetDeploymentsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through GetDomainNames(), following Position; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<APIGatewayClient, Model::GetDomainNamesRequest, Model::GetDomainNamesOutcome> GetDomainNamesPaginator(const Model::GetDomainNamesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through GetModels(), following Position; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<APIGatewayClient, Model::GetModelsRequest, Model::GetModelsOutcome> GetModelsPaginator(const Model::GetModelsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through GetResources(), following Position; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<APIGatewayClient, Model::GetResourcesRequest, Model::GetResourcesOutcome> GetResourcesPaginator(const Model::GetResourcesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through GetRestApis(), following Position; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<APIGatewayClient, Model::GetRestApisRequest, Model::GetRestApisOutcome> GetRestApisPaginator(const Model::GetRestApisRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through GetUsage(), following Position; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<APIGatewayClient, Model::GetUsageRequest, Model::GetUsageOutcome> GetUsagePaginator(const Model::GetUsageRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through GetUsagePlanKeys(), following Position; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<APIGatewayClient, Model::GetUsagePlanKeysRequest, Model::GetUsagePlanKeysOutcome> GetUsagePlanKeysPaginator(const Model::GetUsagePlanKeysRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through GetUsagePlans(), following Position; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<APIGatewayClient, Model::GetUsagePlansRequest, Model::GetUsagePlansOutcome> GetUsagePlansPaginator(const Model::GetUsagePlansRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CreateApiKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::CreateApiKeyRequest, Model::CreateApiKeyOutcome> CreateApiKeyAwaitable(Model::CreateApiKeyRequest request) const;
+
+        /**
+         * co_await-able form of CreateAuthorizer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::CreateAuthorizerRequest, Model::CreateAuthorizerOutcome> CreateAuthorizerAwaitable(Model::CreateAuthorizerRequest request) const;
+
+        /**
+         * co_await-able form of CreateBasePathMapping(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::CreateBasePathMappingRequest, Model::CreateBasePathMappingOutcome> CreateBasePathMappingAwaitable(Model::CreateBasePathMappingRequest request) const;
+
+        /**
+         * co_await-able form of CreateDeployment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::CreateDeploymentRequest, Model::CreateDeploymentOutcome> CreateDeploymentAwaitable(Model::CreateDeploymentRequest request) const;
+
+        /**
+         * co_await-able form of CreateDomainName(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::CreateDomainNameRequest, Model::CreateDomainNameOutcome> CreateDomainNameAwaitable(Model::CreateDomainNameRequest request) const;
+
+        /**
+         * co_await-able form of CreateModel(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::CreateModelRequest, Model::CreateModelOutcome> CreateModelAwaitable(Model::CreateModelRequest request) const;
+
+        /**
+         * co_await-able form of CreateResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::CreateResourceRequest, Model::CreateResourceOutcome> CreateResourceAwaitable(Model::CreateResourceRequest request) const;
+
+        /**
+         * co_await-able form of CreateRestApi(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::CreateRestApiRequest, Model::CreateRestApiOutcome> CreateRestApiAwaitable(Model::CreateRestApiRequest request) const;
+
+        /**
+         * co_await-able form of CreateStage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::CreateStageRequest, Model::CreateStageOutcome> CreateStageAwaitable(Model::CreateStageRequest request) const;
+
+        /**
+         * co_await-able form of CreateUsagePlan(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::CreateUsagePlanRequest, Model::CreateUsagePlanOutcome> CreateUsagePlanAwaitable(Model::CreateUsagePlanRequest request) const;
+
+        /**
+         * co_await-able form of CreateUsagePlanKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::CreateUsagePlanKeyRequest, Model::CreateUsagePlanKeyOutcome> CreateUsagePlanKeyAwaitable(Model::CreateUsagePlanKeyRequest request) const;
+
+        /**
+         * co_await-able form of DeleteApiKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteApiKeyRequest, Model::DeleteApiKeyOutcome> DeleteApiKeyAwaitable(Model::DeleteApiKeyRequest request) const;
+
+        /**
+         * co_await-able form of DeleteAuthorizer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteAuthorizerRequest, Model::DeleteAuthorizerOutcome> DeleteAuthorizerAwaitable(Model::DeleteAuthorizerRequest request) const;
+
+        /**
+         * co_await-able form of DeleteBasePathMapping(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteBasePathMappingRequest, Model::DeleteBasePathMappingOutcome> DeleteBasePathMappingAwaitable(Model::DeleteBasePathMappingRequest request) const;
+
+        /**
+         * co_await-able form of DeleteClientCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteClientCertificateRequest, Model::DeleteClientCertificateOutcome> DeleteClientCertificateAwaitable(Model::DeleteClientCertificateRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDeployment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteDeploymentRequest, Model::DeleteDeploymentOutcome> DeleteDeploymentAwaitable(Model::DeleteDeploymentRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDomainName(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteDomainNameRequest, Model::DeleteDomainNameOutcome> DeleteDomainNameAwaitable(Model::DeleteDomainNameRequest request) const;
+
+        /**
+         * co_await-able form of DeleteIntegration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteIntegrationRequest, Model::DeleteIntegrationOutcome> DeleteIntegrationAwaitable(Model::DeleteIntegrationRequest request) const;
+
+        /**
+         * co_await-able form of DeleteIntegrationResponse(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteIntegrationResponseRequest, Model::DeleteIntegrationResponseOutcome> DeleteIntegrationResponseAwaitable(Model::DeleteIntegrationResponseRequest request) const;
+
+        /**
+         * co_await-able form of DeleteMethod(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteMethodRequest, Model::DeleteMethodOutcome> DeleteMethodAwaitable(Model::DeleteMethodRequest request) const;
+
+        /**
+         * co_await-able form of DeleteMethodResponse(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteMethodResponseRequest, Model::DeleteMethodResponseOutcome> DeleteMethodResponseAwaitable(Model::DeleteMethodResponseRequest request) const;
+
+        /**
+         * co_await-able form of DeleteModel(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteModelRequest, Model::DeleteModelOutcome> DeleteModelAwaitable(Model::DeleteModelRequest request) const;
+
+        /**
+         * co_await-able form of DeleteResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteResourceRequest, Model::DeleteResourceOutcome> DeleteResourceAwaitable(Model::DeleteResourceRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRestApi(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteRestApiRequest, Model::DeleteRestApiOutcome> DeleteRestApiAwaitable(Model::DeleteRestApiRequest request) const;
+
+        /**
+         * co_await-able form of DeleteStage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteStageRequest, Model::DeleteStageOutcome> DeleteStageAwaitable(Model::DeleteStageRequest request) const;
+
+        /**
+         * co_await-able form of DeleteUsagePlan(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteUsagePlanRequest, Model::DeleteUsagePlanOutcome> DeleteUsagePlanAwaitable(Model::DeleteUsagePlanRequest request) const;
+
+        /**
+         * co_await-able form of DeleteUsagePlanKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::DeleteUsagePlanKeyRequest, Model::DeleteUsagePlanKeyOutcome> DeleteUsagePlanKeyAwaitable(Model::DeleteUsagePlanKeyRequest request) const;
+
+        /**
+         * co_await-able form of FlushStageAuthorizersCache(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::FlushStageAuthorizersCacheRequest, Model::FlushStageAuthorizersCacheOutcome> FlushStageAuthorizersCacheAwaitable(Model::FlushStageAuthorizersCacheRequest request) const;
+
+        /**
+         * co_await-able form of FlushStageCache(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::FlushStageCacheRequest, Model::FlushStageCacheOutcome> FlushStageCacheAwaitable(Model::FlushStageCacheRequest request) const;
+
+        /**
+         * co_await-able form of GenerateClientCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GenerateClientCertificateRequest, Model::GenerateClientCertificateOutcome> GenerateClientCertificateAwaitable(Model::GenerateClientCertificateRequest request) const;
+
+        /**
+         * co_await-able form of GetAccount(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetAccountRequest, Model::GetAccountOutcome> GetAccountAwaitable(Model::GetAccountRequest request) const;
+
+        /**
+         * co_await-able form of GetApiKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetApiKeyRequest, Model::GetApiKeyOutcome> GetApiKeyAwaitable(Model::GetApiKeyRequest request) const;
+
+        /**
+         * co_await-able form of GetApiKeys(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetApiKeysRequest, Model::GetApiKeysOutcome> GetApiKeysAwaitable(Model::GetApiKeysRequest request) const;
+
+        /**
+         * co_await-able form of GetAuthorizer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetAuthorizerRequest, Model::GetAuthorizerOutcome> GetAuthorizerAwaitable(Model::GetAuthorizerRequest request) const;
+
+        /**
+         * co_await-able form of GetAuthorizers(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetAuthorizersRequest, Model::GetAuthorizersOutcome> GetAuthorizersAwaitable(Model::GetAuthorizersRequest request) const;
+
+        /**
+         * co_await-able form of GetBasePathMapping(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetBasePathMappingRequest, Model::GetBasePathMappingOutcome> GetBasePathMappingAwaitable(Model::GetBasePathMappingRequest request) const;
+
+        /**
+         * co_await-able form of GetBasePathMappings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetBasePathMappingsRequest, Model::GetBasePathMappingsOutcome> GetBasePathMappingsAwaitable(Model::GetBasePathMappingsRequest request) const;
+
+        /**
+         * co_await-able form of GetClientCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetClientCertificateRequest, Model::GetClientCertificateOutcome> GetClientCertificateAwaitable(Model::GetClientCertificateRequest request) const;
+
+        /**
+         * co_await-able form of GetClientCertificates(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetClientCertificatesRequest, Model::GetClientCertificatesOutcome> GetClientCertificatesAwaitable(Model::GetClientCertificatesRequest request) const;
+
+        /**
+         * co_await-able form of GetDeployment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetDeploymentRequest, Model::GetDeploymentOutcome> GetDeploymentAwaitable(Model::GetDeploymentRequest request) const;
+
+        /**
+         * co_await-able form of GetDeployments(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetDeploymentsRequest, Model::GetDeploymentsOutcome> GetDeploymentsAwaitable(Model::GetDeploymentsRequest request) const;
+
+        /**
+         * co_await-able form of GetDomainName(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetDomainNameRequest, Model::GetDomainNameOutcome> GetDomainNameAwaitable(Model::GetDomainNameRequest request) const;
+
+        /**
+         * co_await-able form of GetDomainNames(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetDomainNamesRequest, Model::GetDomainNamesOutcome> GetDomainNamesAwaitable(Model::GetDomainNamesRequest request) const;
+
+        /**
+         * co_await-able form of GetExport(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetExportRequest, Model::GetExportOutcome> GetExportAwaitable(Model::GetExportRequest request) const;
+
+        /**
+         * co_await-able form of GetIntegration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetIntegrationRequest, Model::GetIntegrationOutcome> GetIntegrationAwaitable(Model::GetIntegrationRequest request) const;
+
+        /**
+         * co_await-able form of GetIntegrationResponse(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetIntegrationResponseRequest, Model::GetIntegrationResponseOutcome> GetIntegrationResponseAwaitable(Model::GetIntegrationResponseRequest request) const;
+
+        /**
+         * co_await-able form of GetMethod(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetMethodRequest, Model::GetMethodOutcome> GetMethodAwaitable(Model::GetMethodRequest request) const;
+
+        /**
+         * co_await-able form of GetMethodResponse(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetMethodResponseRequest, Model::GetMethodResponseOutcome> GetMethodResponseAwaitable(Model::GetMethodResponseRequest request) const;
+
+        /**
+         * co_await-able form of GetModel(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetModelRequest, Model::GetModelOutcome> GetModelAwaitable(Model::GetModelRequest request) const;
+
+        /**
+         * co_await-able form of GetModelTemplate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetModelTemplateRequest, Model::GetModelTemplateOutcome> GetModelTemplateAwaitable(Model::GetModelTemplateRequest request) const;
+
+        /**
+         * co_await-able form of GetModels(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetModelsRequest, Model::GetModelsOutcome> GetModelsAwaitable(Model::GetModelsRequest request) const;
+
+        /**
+         * co_await-able form of GetResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetResourceRequest, Model::GetResourceOutcome> GetResourceAwaitable(Model::GetResourceRequest request) const;
+
+        /**
+         * co_await-able form of GetResources(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetResourcesRequest, Model::GetResourcesOutcome> GetResourcesAwaitable(Model::GetResourcesRequest request) const;
+
+        /**
+         * co_await-able form of GetRestApi(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetRestApiRequest, Model::GetRestApiOutcome> GetRestApiAwaitable(Model::GetRestApiRequest request) const;
+
+        /**
+         * co_await-able form of GetRestApis(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetRestApisRequest, Model::GetRestApisOutcome> GetRestApisAwaitable(Model::GetRestApisRequest request) const;
+
+        /**
+         * co_await-able form of GetSdk(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetSdkRequest, Model::GetSdkOutcome> GetSdkAwaitable(Model::GetSdkRequest request) const;
+
+        /**
+         * co_await-able form of GetStage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetStageRequest, Model::GetStageOutcome> GetStageAwaitable(Model::GetStageRequest request) const;
+
+        /**
+         * co_await-able form of GetStages(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetStagesRequest, Model::GetStagesOutcome> GetStagesAwaitable(Model::GetStagesRequest request) const;
+
+        /**
+         * co_await-able form of GetUsage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetUsageRequest, Model::GetUsageOutcome> GetUsageAwaitable(Model::GetUsageRequest request) const;
+
+        /**
+         * co_await-able form of GetUsagePlan(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetUsagePlanRequest, Model::GetUsagePlanOutcome> GetUsagePlanAwaitable(Model::GetUsagePlanRequest request) const;
+
+        /**
+         * co_await-able form of GetUsagePlanKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetUsagePlanKeyRequest, Model::GetUsagePlanKeyOutcome> GetUsagePlanKeyAwaitable(Model::GetUsagePlanKeyRequest request) const;
+
+        /**
+         * co_await-able form of GetUsagePlanKeys(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetUsagePlanKeysRequest, Model::GetUsagePlanKeysOutcome> GetUsagePlanKeysAwaitable(Model::GetUsagePlanKeysRequest request) const;
+
+        /**
+         * co_await-able form of GetUsagePlans(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::GetUsagePlansRequest, Model::GetUsagePlansOutcome> GetUsagePlansAwaitable(Model::GetUsagePlansRequest request) const;
+
+        /**
+         * co_await-able form of ImportApiKeys(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::ImportApiKeysRequest, Model::ImportApiKeysOutcome> ImportApiKeysAwaitable(Model::ImportApiKeysRequest request) const;
+
+        /**
+         * co_await-able form of ImportRestApi(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::ImportRestApiRequest, Model::ImportRestApiOutcome> ImportRestApiAwaitable(Model::ImportRestApiRequest request) const;
+
+        /**
+         * co_await-able form of PutIntegration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::PutIntegrationRequest, Model::PutIntegrationOutcome> PutIntegrationAwaitable(Model::PutIntegrationRequest request) const;
+
+        /**
+         * co_await-able form of PutIntegrationResponse(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::PutIntegrationResponseRequest, Model::PutIntegrationResponseOutcome> PutIntegrationResponseAwaitable(Model::PutIntegrationResponseRequest request) const;
+
+        /**
+         * co_await-able form of PutMethod(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::PutMethodRequest, Model::PutMethodOutcome> PutMethodAwaitable(Model::PutMethodRequest request) const;
+
+        /**
+         * co_await-able form of PutMethodResponse(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::PutMethodResponseRequest, Model::PutMethodResponseOutcome> PutMethodResponseAwaitable(Model::PutMethodResponseRequest request) const;
+
+        /**
+         * co_await-able form of PutRestApi(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::PutRestApiRequest, Model::PutRestApiOutcome> PutRestApiAwaitable(Model::PutRestApiRequest request) const;
+
+        /**
+         * co_await-able form of TestInvokeAuthorizer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::TestInvokeAuthorizerRequest, Model::TestInvokeAuthorizerOutcome> TestInvokeAuthorizerAwaitable(Model::TestInvokeAuthorizerRequest request) const;
+
+        /**
+         * co_await-able form of TestInvokeMethod(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::TestInvokeMethodRequest, Model::TestInvokeMethodOutcome> TestInvokeMethodAwaitable(Model::TestInvokeMethodRequest request) const;
+
+        /**
+         * co_await-able form of UpdateAccount(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateAccountRequest, Model::UpdateAccountOutcome> UpdateAccountAwaitable(Model::UpdateAccountRequest request) const;
+
+        /**
+         * co_await-able form of UpdateApiKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateApiKeyRequest, Model::UpdateApiKeyOutcome> UpdateApiKeyAwaitable(Model::UpdateApiKeyRequest request) const;
+
+        /**
+         * co_await-able form of UpdateAuthorizer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateAuthorizerRequest, Model::UpdateAuthorizerOutcome> UpdateAuthorizerAwaitable(Model::UpdateAuthorizerRequest request) const;
+
+        /**
+         * co_await-able form of UpdateBasePathMapping(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateBasePathMappingRequest, Model::UpdateBasePathMappingOutcome> UpdateBasePathMappingAwaitable(Model::UpdateBasePathMappingRequest request) const;
+
+        /**
+         * co_await-able form of UpdateClientCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateClientCertificateRequest, Model::UpdateClientCertificateOutcome> UpdateClientCertificateAwaitable(Model::UpdateClientCertificateRequest request) const;
+
+        /**
+         * co_await-able form of UpdateDeployment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateDeploymentRequest, Model::UpdateDeploymentOutcome> UpdateDeploymentAwaitable(Model::UpdateDeploymentRequest request) const;
+
+        /**
+         * co_await-able form of UpdateDomainName(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateDomainNameRequest, Model::UpdateDomainNameOutcome> UpdateDomainNameAwaitable(Model::UpdateDomainNameRequest request) const;
+
+        /**
+         * co_await-able form of UpdateIntegration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateIntegrationRequest, Model::UpdateIntegrationOutcome> UpdateIntegrationAwaitable(Model::UpdateIntegrationRequest request) const;
+
+        /**
+         * co_await-able form of UpdateIntegrationResponse(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateIntegrationResponseRequest, Model::UpdateIntegrationResponseOutcome> UpdateIntegrationResponseAwaitable(Model::UpdateIntegrationResponseRequest request) const;
+
+        /**
+         * co_await-able form of UpdateMethod(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateMethodRequest, Model::UpdateMethodOutcome> UpdateMethodAwaitable(Model::UpdateMethodRequest request) const;
+
+        /**
+         * co_await-able form of UpdateMethodResponse(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateMethodResponseRequest, Model::UpdateMethodResponseOutcome> UpdateMethodResponseAwaitable(Model::UpdateMethodResponseRequest request) const;
+
+        /**
+         * co_await-able form of UpdateModel(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateModelRequest, Model::UpdateModelOutcome> UpdateModelAwaitable(Model::UpdateModelRequest request) const;
+
+        /**
+         * co_await-able form of UpdateResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateResourceRequest, Model::UpdateResourceOutcome> UpdateResourceAwaitable(Model::UpdateResourceRequest request) const;
+
+        /**
+         * co_await-able form of UpdateRestApi(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateRestApiRequest, Model::UpdateRestApiOutcome> UpdateRestApiAwaitable(Model::UpdateRestApiRequest request) const;
+
+        /**
+         * co_await-able form of UpdateStage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateStageRequest, Model::UpdateStageOutcome> UpdateStageAwaitable(Model::UpdateStageRequest request) const;
+
+        /**
+         * co_await-able form of UpdateUsage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateUsageRequest, Model::UpdateUsageOutcome> UpdateUsageAwaitable(Model::UpdateUsageRequest request) const;
+
+        /**
+         * co_await-able form of UpdateUsagePlan(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<APIGatewayClient, Model::UpdateUsagePlanRequest, Model::UpdateUsagePlanOutcome> UpdateUsagePlanAwaitable(Model::UpdateUsagePlanRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateApiKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateApiKey"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateAuthorizerRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateAuthorizer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
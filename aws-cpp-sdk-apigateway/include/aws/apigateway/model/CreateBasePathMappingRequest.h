@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateBasePathMappingRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateBasePathMapping"; }
+
     Aws::String SerializePayload() const override;
 
     /**
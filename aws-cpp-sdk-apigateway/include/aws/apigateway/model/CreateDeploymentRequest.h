@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateDeploymentRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDeployment"; }
+
     Aws::String SerializePayload() const override;
 
     /**
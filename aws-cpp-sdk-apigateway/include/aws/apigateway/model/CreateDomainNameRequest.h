@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateDomainNameRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDomainName"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateModelRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateModel"; }
+
     Aws::String SerializePayload() const override;
 
     /**
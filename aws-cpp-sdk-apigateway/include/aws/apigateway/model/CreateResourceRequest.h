@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateResourceRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateResource"; }
+
     Aws::String SerializePayload() const override;
 
     /**
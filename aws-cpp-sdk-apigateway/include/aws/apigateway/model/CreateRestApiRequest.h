@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateRestApiRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateRestApi"; }
+
     Aws::String SerializePayload() const override;
 
     /**
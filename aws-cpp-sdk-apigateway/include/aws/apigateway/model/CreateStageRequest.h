@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateStageRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateStage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateUsagePlanKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateUsagePlanKey"; }
+
     Aws::String SerializePayload() const override;
 
     /**
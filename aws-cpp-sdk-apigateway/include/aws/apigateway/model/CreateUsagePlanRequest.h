@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     CreateUsagePlanRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateUsagePlan"; }
+
     Aws::String SerializePayload() const override;
 
     /**
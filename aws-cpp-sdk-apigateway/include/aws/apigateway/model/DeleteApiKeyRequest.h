@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteApiKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteApiKey"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteAuthorizerRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteAuthorizer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteBasePathMappingRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteBasePathMapping"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteClientCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteClientCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
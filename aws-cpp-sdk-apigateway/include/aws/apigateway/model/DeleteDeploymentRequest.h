@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDeploymentRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDeployment"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDomainNameRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDomainName"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteIntegrationRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteIntegration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteIntegrationResponseRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteIntegrationResponse"; }
+
     Aws::String SerializePayload() const override;
 
     /**
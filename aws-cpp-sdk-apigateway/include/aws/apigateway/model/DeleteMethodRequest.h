@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteMethodRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteMethod"; }
+
     Aws::String SerializePayload() const override;
 
     /**
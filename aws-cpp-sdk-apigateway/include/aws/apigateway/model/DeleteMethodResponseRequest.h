@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteMethodResponseRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteMethodResponse"; }
+
     Aws::String SerializePayload() const override;
 
     /**
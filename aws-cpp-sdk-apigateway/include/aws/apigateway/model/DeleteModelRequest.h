@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteModelRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteModel"; }
+
     Aws::String SerializePayload() const override;
 
     /**
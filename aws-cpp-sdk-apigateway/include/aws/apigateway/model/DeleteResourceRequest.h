@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteResourceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteResource"; }
+
     Aws::String SerializePayload() const override;
 
     /**
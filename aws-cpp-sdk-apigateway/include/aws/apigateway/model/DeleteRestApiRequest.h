@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteRestApiRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteRestApi"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteStageRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteStage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
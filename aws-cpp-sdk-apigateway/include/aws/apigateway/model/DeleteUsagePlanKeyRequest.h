@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteUsagePlanKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteUsagePlanKey"; }
+
     Aws::String SerializePayload() const override;
 
     /**
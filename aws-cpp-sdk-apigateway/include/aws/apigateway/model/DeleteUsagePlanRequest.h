@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteUsagePlanRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteUsagePlan"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     FlushStageAuthorizersCacheRequest();
+    inline const char* GetServiceRequestName() const override { return "FlushStageAuthorizersCache"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     FlushStageCacheRequest();
+    inline const char* GetServiceRequestName() const override { return "FlushStageCache"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GenerateClientCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "GenerateClientCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
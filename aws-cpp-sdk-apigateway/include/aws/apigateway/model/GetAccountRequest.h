@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetAccountRequest();
+    inline const char* GetServiceRequestName() const override { return "GetAccount"; }
+
     Aws::String SerializePayload() const override;
 
   };
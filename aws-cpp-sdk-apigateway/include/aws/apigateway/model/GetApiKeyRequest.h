@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     GetApiKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetApiKey"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     GetApiKeysRequest();
+    inline const char* GetServiceRequestName() const override { return "GetApiKeys"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetAuthorizerRequest();
+    inline const char* GetServiceRequestName() const override { return "GetAuthorizer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     GetAuthorizersRequest();
+    inline const char* GetServiceRequestName() const override { return "GetAuthorizers"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetBasePathMappingRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBasePathMapping"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetBasePathMappingsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBasePathMappings"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetClientCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "GetClientCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetClientCertificatesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetClientCertificates"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
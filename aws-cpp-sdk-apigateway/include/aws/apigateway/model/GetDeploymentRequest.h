@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetDeploymentRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDeployment"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetDeploymentsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDeployments"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
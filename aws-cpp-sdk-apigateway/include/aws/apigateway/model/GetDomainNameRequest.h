@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetDomainNameRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDomainName"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     GetDomainNamesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDomainNames"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetExportRequest();
+    inline const char* GetServiceRequestName() const override { return "GetExport"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
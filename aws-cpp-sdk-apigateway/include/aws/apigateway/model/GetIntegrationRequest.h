@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetIntegrationRequest();
+    inline const char* GetServiceRequestName() const override { return "GetIntegration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetIntegrationResponseRequest();
+    inline const char* GetServiceRequestName() const override { return "GetIntegrationResponse"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetMethodRequest();
+    inline const char* GetServiceRequestName() const override { return "GetMethod"; }
+
     Aws::String SerializePayload() const override;
 
     /**
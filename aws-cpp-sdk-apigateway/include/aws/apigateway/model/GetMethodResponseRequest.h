@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetMethodResponseRequest();
+    inline const char* GetServiceRequestName() const override { return "GetMethodResponse"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetModelRequest();
+    inline const char* GetServiceRequestName() const override { return "GetModel"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetModelTemplateRequest();
+    inline const char* GetServiceRequestName() const override { return "GetModelTemplate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
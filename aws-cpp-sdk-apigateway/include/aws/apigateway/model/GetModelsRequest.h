@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetModelsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetModels"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
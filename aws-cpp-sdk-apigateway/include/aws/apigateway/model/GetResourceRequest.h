@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetResourceRequest();
+    inline const char* GetServiceRequestName() const override { return "GetResource"; }
+
     Aws::String SerializePayload() const override;
 
     /**
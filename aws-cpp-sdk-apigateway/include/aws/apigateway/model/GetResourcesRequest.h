@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     GetResourcesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetResources"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetRestApiRequest();
+    inline const char* GetServiceRequestName() const override { return "GetRestApi"; }
+
     Aws::String SerializePayload() const override;
 
     /**
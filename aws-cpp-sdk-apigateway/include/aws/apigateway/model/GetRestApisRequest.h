@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetRestApisRequest();
+    inline const char* GetServiceRequestName() const override { return "GetRestApis"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
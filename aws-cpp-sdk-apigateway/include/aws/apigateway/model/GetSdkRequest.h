@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetSdkRequest();
+    inline const char* GetServiceRequestName() const override { return "GetSdk"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetStageRequest();
+    inline const char* GetServiceRequestName() const override { return "GetStage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetStagesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetStages"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetUsagePlanKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetUsagePlanKey"; }
+
     Aws::String SerializePayload() const override;
 
     /**
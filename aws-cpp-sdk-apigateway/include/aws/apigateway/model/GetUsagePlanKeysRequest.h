@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetUsagePlanKeysRequest();
+    inline const char* GetServiceRequestName() const override { return "GetUsagePlanKeys"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetUsagePlanRequest();
+    inline const char* GetServiceRequestName() const override { return "GetUsagePlan"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     GetUsagePlansRequest();
+    inline const char* GetServiceRequestName() const override { return "GetUsagePlans"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
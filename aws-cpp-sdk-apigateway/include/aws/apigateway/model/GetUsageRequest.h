@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetUsageRequest();
+    inline const char* GetServiceRequestName() const override { return "GetUsage"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
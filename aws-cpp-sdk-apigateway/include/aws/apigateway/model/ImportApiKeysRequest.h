@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     ImportApiKeysRequest();
+    inline const char* GetServiceRequestName() const override { return "ImportApiKeys"; }
+
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
 
     /**
@@ -38,6 +38,8 @@ namespace Model
   {
   public:
     ImportRestApiRequest();
+    inline const char* GetServiceRequestName() const override { return "ImportRestApi"; }
+
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     PutIntegrationRequest();
+    inline const char* GetServiceRequestName() const override { return "PutIntegration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
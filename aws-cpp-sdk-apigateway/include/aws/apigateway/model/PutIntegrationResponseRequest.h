@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PutIntegrationResponseRequest();
+    inline const char* GetServiceRequestName() const override { return "PutIntegrationResponse"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PutMethodRequest();
+    inline const char* GetServiceRequestName() const override { return "PutMethod"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     PutMethodResponseRequest();
+    inline const char* GetServiceRequestName() const override { return "PutMethodResponse"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -39,6 +39,8 @@ namespace Model
   {
   public:
     PutRestApiRequest();
+    inline const char* GetServiceRequestName() const override { return "PutRestApi"; }
+
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
 
     /**
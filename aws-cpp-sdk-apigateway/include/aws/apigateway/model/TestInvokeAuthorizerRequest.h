@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     TestInvokeAuthorizerRequest();
+    inline const char* GetServiceRequestName() const override { return "TestInvokeAuthorizer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     TestInvokeMethodRequest();
+    inline const char* GetServiceRequestName() const override { return "TestInvokeMethod"; }
+
     Aws::String SerializePayload() const override;
 
     /**
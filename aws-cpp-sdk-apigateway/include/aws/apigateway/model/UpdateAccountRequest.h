@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateAccountRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateAccount"; }
+
     Aws::String SerializePayload() const override;
 
     /**
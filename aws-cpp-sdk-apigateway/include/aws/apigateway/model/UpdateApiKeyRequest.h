@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateApiKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateApiKey"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateAuthorizerRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateAuthorizer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
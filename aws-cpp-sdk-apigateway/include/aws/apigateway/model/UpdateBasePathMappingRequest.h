@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     UpdateBasePathMappingRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateBasePathMapping"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     UpdateClientCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateClientCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     UpdateDeploymentRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateDeployment"; }
+
     Aws::String SerializePayload() const override;
 
     /**
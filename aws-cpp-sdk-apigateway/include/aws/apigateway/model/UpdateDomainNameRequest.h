@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateDomainNameRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateDomainName"; }
+
     Aws::String SerializePayload() const override;
 
     /**
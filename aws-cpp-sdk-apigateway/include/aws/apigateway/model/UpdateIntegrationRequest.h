@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateIntegrationRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateIntegration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
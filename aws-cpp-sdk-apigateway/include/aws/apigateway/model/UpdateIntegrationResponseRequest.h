@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateIntegrationResponseRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateIntegrationResponse"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateMethodRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateMethod"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateMethodResponseRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateMethodResponse"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     UpdateModelRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateModel"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateResourceRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateResource"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateRestApiRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateRestApi"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     UpdateStageRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateStage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateUsagePlanRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateUsagePlan"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     UpdateUsageRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateUsage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -198,7 +198,7 @@ CreateApiKeyOutcome APIGatewayClient::CreateApiKey(const CreateApiKeyRequest& re
 
 CreateApiKeyOutcomeCallable APIGatewayClient::CreateApiKeyCallable(const CreateApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateApiKey(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateApiKey(request); } );
 }
 
 void APIGatewayClient::CreateApiKeyAsync(const CreateApiKeyRequest& request, const CreateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -206,6 +206,16 @@ void APIGatewayClient::CreateApiKeyAsync(const CreateApiKeyRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->CreateApiKeyAsyncHelper( request, handler, context ); } );
 }
 
+CreateApiKeyOutcomeCallable APIGatewayClient::CreateApiKeyCallable(CreateApiKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::CreateApiKey, this, std::move(request)));
+}
+
+void APIGatewayClient::CreateApiKeyAsync(CreateApiKeyRequest&& request, const CreateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::CreateApiKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::CreateApiKeyAsyncHelper(const CreateApiKeyRequest& request, const CreateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateApiKey(request), context);
@@ -231,7 +241,7 @@ CreateAuthorizerOutcome APIGatewayClient::CreateAuthorizer(const CreateAuthorize
 
 CreateAuthorizerOutcomeCallable APIGatewayClient::CreateAuthorizerCallable(const CreateAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateAuthorizer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateAuthorizer(request); } );
 }
 
 void APIGatewayClient::CreateAuthorizerAsync(const CreateAuthorizerRequest& request, const CreateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -239,6 +249,16 @@ void APIGatewayClient::CreateAuthorizerAsync(const CreateAuthorizerRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->CreateAuthorizerAsyncHelper( request, handler, context ); } );
 }
 
+CreateAuthorizerOutcomeCallable APIGatewayClient::CreateAuthorizerCallable(CreateAuthorizerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::CreateAuthorizer, this, std::move(request)));
+}
+
+void APIGatewayClient::CreateAuthorizerAsync(CreateAuthorizerRequest&& request, const CreateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::CreateAuthorizerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::CreateAuthorizerAsyncHelper(const CreateAuthorizerRequest& request, const CreateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateAuthorizer(request), context);
@@ -264,7 +284,7 @@ CreateBasePathMappingOutcome APIGatewayClient::CreateBasePathMapping(const Creat
 
 CreateBasePathMappingOutcomeCallable APIGatewayClient::CreateBasePathMappingCallable(const CreateBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateBasePathMapping(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateBasePathMapping(request); } );
 }
 
 void APIGatewayClient::CreateBasePathMappingAsync(const CreateBasePathMappingRequest& request, const CreateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -272,6 +292,16 @@ void APIGatewayClient::CreateBasePathMappingAsync(const CreateBasePathMappingReq
   m_executor->Submit( [this, request, handler, context](){ this->CreateBasePathMappingAsyncHelper( request, handler, context ); } );
 }
 
+CreateBasePathMappingOutcomeCallable APIGatewayClient::CreateBasePathMappingCallable(CreateBasePathMappingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::CreateBasePathMapping, this, std::move(request)));
+}
+
+void APIGatewayClient::CreateBasePathMappingAsync(CreateBasePathMappingRequest&& request, const CreateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::CreateBasePathMappingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::CreateBasePathMappingAsyncHelper(const CreateBasePathMappingRequest& request, const CreateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateBasePathMapping(request), context);
@@ -297,7 +327,7 @@ CreateDeploymentOutcome APIGatewayClient::CreateDeployment(const CreateDeploymen
 
 CreateDeploymentOutcomeCallable APIGatewayClient::CreateDeploymentCallable(const CreateDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDeployment(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDeployment(request); } );
 }
 
 void APIGatewayClient::CreateDeploymentAsync(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -305,6 +335,16 @@ void APIGatewayClient::CreateDeploymentAsync(const CreateDeploymentRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->CreateDeploymentAsyncHelper( request, handler, context ); } );
 }
 
+CreateDeploymentOutcomeCallable APIGatewayClient::CreateDeploymentCallable(CreateDeploymentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::CreateDeployment, this, std::move(request)));
+}
+
+void APIGatewayClient::CreateDeploymentAsync(CreateDeploymentRequest&& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::CreateDeploymentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::CreateDeploymentAsyncHelper(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDeployment(request), context);
@@ -328,7 +368,7 @@ CreateDomainNameOutcome APIGatewayClient::CreateDomainName(const CreateDomainNam
 
 CreateDomainNameOutcomeCallable APIGatewayClient::CreateDomainNameCallable(const CreateDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDomainName(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDomainName(request); } );
 }
 
 void APIGatewayClient::CreateDomainNameAsync(const CreateDomainNameRequest& request, const CreateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -336,6 +376,16 @@ void APIGatewayClient::CreateDomainNameAsync(const CreateDomainNameRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->CreateDomainNameAsyncHelper( request, handler, context ); } );
 }
 
+CreateDomainNameOutcomeCallable APIGatewayClient::CreateDomainNameCallable(CreateDomainNameRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::CreateDomainName, this, std::move(request)));
+}
+
+void APIGatewayClient::CreateDomainNameAsync(CreateDomainNameRequest&& request, const CreateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::CreateDomainNameAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::CreateDomainNameAsyncHelper(const CreateDomainNameRequest& request, const CreateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDomainName(request), context);
@@ -361,7 +411,7 @@ CreateModelOutcome APIGatewayClient::CreateModel(const CreateModelRequest& reque
 
 CreateModelOutcomeCallable APIGatewayClient::CreateModelCallable(const CreateModelRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateModel(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateModel(request); } );
 }
 
 void APIGatewayClient::CreateModelAsync(const CreateModelRequest& request, const CreateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -369,6 +419,16 @@ void APIGatewayClient::CreateModelAsync(const CreateModelRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->CreateModelAsyncHelper( request, handler, context ); } );
 }
 
+CreateModelOutcomeCallable APIGatewayClient::CreateModelCallable(CreateModelRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::CreateModel, this, std::move(request)));
+}
+
+void APIGatewayClient::CreateModelAsync(CreateModelRequest&& request, const CreateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::CreateModelAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::CreateModelAsyncHelper(const CreateModelRequest& request, const CreateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateModel(request), context);
@@ -395,7 +455,7 @@ CreateResourceOutcome APIGatewayClient::CreateResource(const CreateResourceReque
 
 CreateResourceOutcomeCallable APIGatewayClient::CreateResourceCallable(const CreateResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateResource(request); } );
 }
 
 void APIGatewayClient::CreateResourceAsync(const CreateResourceRequest& request, const CreateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -403,6 +463,16 @@ void APIGatewayClient::CreateResourceAsync(const CreateResourceRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->CreateResourceAsyncHelper( request, handler, context ); } );
 }
 
+CreateResourceOutcomeCallable APIGatewayClient::CreateResourceCallable(CreateResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::CreateResource, this, std::move(request)));
+}
+
+void APIGatewayClient::CreateResourceAsync(CreateResourceRequest&& request, const CreateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::CreateResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::CreateResourceAsyncHelper(const CreateResourceRequest& request, const CreateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateResource(request), context);
@@ -426,7 +496,7 @@ CreateRestApiOutcome APIGatewayClient::CreateRestApi(const CreateRestApiRequest&
 
 CreateRestApiOutcomeCallable APIGatewayClient::CreateRestApiCallable(const CreateRestApiRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateRestApi(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateRestApi(request); } );
 }
 
 void APIGatewayClient::CreateRestApiAsync(const CreateRestApiRequest& request, const CreateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -434,6 +504,16 @@ void APIGatewayClient::CreateRestApiAsync(const CreateRestApiRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->CreateRestApiAsyncHelper( request, handler, context ); } );
 }
 
+CreateRestApiOutcomeCallable APIGatewayClient::CreateRestApiCallable(CreateRestApiRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::CreateRestApi, this, std::move(request)));
+}
+
+void APIGatewayClient::CreateRestApiAsync(CreateRestApiRequest&& request, const CreateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::CreateRestApiAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::CreateRestApiAsyncHelper(const CreateRestApiRequest& request, const CreateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateRestApi(request), context);
@@ -459,7 +539,7 @@ CreateStageOutcome APIGatewayClient::CreateStage(const CreateStageRequest& reque
 
 CreateStageOutcomeCallable APIGatewayClient::CreateStageCallable(const CreateStageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateStage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateStage(request); } );
 }
 
 void APIGatewayClient::CreateStageAsync(const CreateStageRequest& request, const CreateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -467,6 +547,16 @@ void APIGatewayClient::CreateStageAsync(const CreateStageRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->CreateStageAsyncHelper( request, handler, context ); } );
 }
 
+CreateStageOutcomeCallable APIGatewayClient::CreateStageCallable(CreateStageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::CreateStage, this, std::move(request)));
+}
+
+void APIGatewayClient::CreateStageAsync(CreateStageRequest&& request, const CreateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::CreateStageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::CreateStageAsyncHelper(const CreateStageRequest& request, const CreateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateStage(request), context);
@@ -490,7 +580,7 @@ CreateUsagePlanOutcome APIGatewayClient::CreateUsagePlan(const CreateUsagePlanRe
 
 CreateUsagePlanOutcomeCallable APIGatewayClient::CreateUsagePlanCallable(const CreateUsagePlanRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateUsagePlan(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateUsagePlan(request); } );
 }
 
 void APIGatewayClient::CreateUsagePlanAsync(const CreateUsagePlanRequest& request, const CreateUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -498,6 +588,16 @@ void APIGatewayClient::CreateUsagePlanAsync(const CreateUsagePlanRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->CreateUsagePlanAsyncHelper( request, handler, context ); } );
 }
 
+CreateUsagePlanOutcomeCallable APIGatewayClient::CreateUsagePlanCallable(CreateUsagePlanRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::CreateUsagePlan, this, std::move(request)));
+}
+
+void APIGatewayClient::CreateUsagePlanAsync(CreateUsagePlanRequest&& request, const CreateUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::CreateUsagePlanAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::CreateUsagePlanAsyncHelper(const CreateUsagePlanRequest& request, const CreateUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateUsagePlan(request), context);
@@ -523,7 +623,7 @@ CreateUsagePlanKeyOutcome APIGatewayClient::CreateUsagePlanKey(const CreateUsage
 
 CreateUsagePlanKeyOutcomeCallable APIGatewayClient::CreateUsagePlanKeyCallable(const CreateUsagePlanKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateUsagePlanKey(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateUsagePlanKey(request); } );
 }
 
 void APIGatewayClient::CreateUsagePlanKeyAsync(const CreateUsagePlanKeyRequest& request, const CreateUsagePlanKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -531,6 +631,16 @@ void APIGatewayClient::CreateUsagePlanKeyAsync(const CreateUsagePlanKeyRequest&
   m_executor->Submit( [this, request, handler, context](){ this->CreateUsagePlanKeyAsyncHelper( request, handler, context ); } );
 }
 
+CreateUsagePlanKeyOutcomeCallable APIGatewayClient::CreateUsagePlanKeyCallable(CreateUsagePlanKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::CreateUsagePlanKey, this, std::move(request)));
+}
+
+void APIGatewayClient::CreateUsagePlanKeyAsync(CreateUsagePlanKeyRequest&& request, const CreateUsagePlanKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::CreateUsagePlanKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::CreateUsagePlanKeyAsyncHelper(const CreateUsagePlanKeyRequest& request, const CreateUsagePlanKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateUsagePlanKey(request), context);
@@ -555,7 +665,7 @@ DeleteApiKeyOutcome APIGatewayClient::DeleteApiKey(const DeleteApiKeyRequest& re
 
 DeleteApiKeyOutcomeCallable APIGatewayClient::DeleteApiKeyCallable(const DeleteApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteApiKey(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteApiKey(request); } );
 }
 
 void APIGatewayClient::DeleteApiKeyAsync(const DeleteApiKeyRequest& request, const DeleteApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -563,6 +673,16 @@ void APIGatewayClient::DeleteApiKeyAsync(const DeleteApiKeyRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->DeleteApiKeyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteApiKeyOutcomeCallable APIGatewayClient::DeleteApiKeyCallable(DeleteApiKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteApiKey, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteApiKeyAsync(DeleteApiKeyRequest&& request, const DeleteApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteApiKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteApiKeyAsyncHelper(const DeleteApiKeyRequest& request, const DeleteApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteApiKey(request), context);
@@ -589,7 +709,7 @@ DeleteAuthorizerOutcome APIGatewayClient::DeleteAuthorizer(const DeleteAuthorize
 
 DeleteAuthorizerOutcomeCallable APIGatewayClient::DeleteAuthorizerCallable(const DeleteAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteAuthorizer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteAuthorizer(request); } );
 }
 
 void APIGatewayClient::DeleteAuthorizerAsync(const DeleteAuthorizerRequest& request, const DeleteAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -597,6 +717,16 @@ void APIGatewayClient::DeleteAuthorizerAsync(const DeleteAuthorizerRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->DeleteAuthorizerAsyncHelper( request, handler, context ); } );
 }
 
+DeleteAuthorizerOutcomeCallable APIGatewayClient::DeleteAuthorizerCallable(DeleteAuthorizerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteAuthorizer, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteAuthorizerAsync(DeleteAuthorizerRequest&& request, const DeleteAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteAuthorizerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteAuthorizerAsyncHelper(const DeleteAuthorizerRequest& request, const DeleteAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteAuthorizer(request), context);
@@ -623,7 +753,7 @@ DeleteBasePathMappingOutcome APIGatewayClient::DeleteBasePathMapping(const Delet
 
 DeleteBasePathMappingOutcomeCallable APIGatewayClient::DeleteBasePathMappingCallable(const DeleteBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteBasePathMapping(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteBasePathMapping(request); } );
 }
 
 void APIGatewayClient::DeleteBasePathMappingAsync(const DeleteBasePathMappingRequest& request, const DeleteBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -631,6 +761,16 @@ void APIGatewayClient::DeleteBasePathMappingAsync(const DeleteBasePathMappingReq
   m_executor->Submit( [this, request, handler, context](){ this->DeleteBasePathMappingAsyncHelper( request, handler, context ); } );
 }
 
+DeleteBasePathMappingOutcomeCallable APIGatewayClient::DeleteBasePathMappingCallable(DeleteBasePathMappingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteBasePathMapping, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteBasePathMappingAsync(DeleteBasePathMappingRequest&& request, const DeleteBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteBasePathMappingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteBasePathMappingAsyncHelper(const DeleteBasePathMappingRequest& request, const DeleteBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteBasePathMapping(request), context);
@@ -655,7 +795,7 @@ DeleteClientCertificateOutcome APIGatewayClient::DeleteClientCertificate(const D
 
 DeleteClientCertificateOutcomeCallable APIGatewayClient::DeleteClientCertificateCallable(const DeleteClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteClientCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteClientCertificate(request); } );
 }
 
 void APIGatewayClient::DeleteClientCertificateAsync(const DeleteClientCertificateRequest& request, const DeleteClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -663,6 +803,16 @@ void APIGatewayClient::DeleteClientCertificateAsync(const DeleteClientCertificat
   m_executor->Submit( [this, request, handler, context](){ this->DeleteClientCertificateAsyncHelper( request, handler, context ); } );
 }
 
+DeleteClientCertificateOutcomeCallable APIGatewayClient::DeleteClientCertificateCallable(DeleteClientCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteClientCertificate, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteClientCertificateAsync(DeleteClientCertificateRequest&& request, const DeleteClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteClientCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteClientCertificateAsyncHelper(const DeleteClientCertificateRequest& request, const DeleteClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteClientCertificate(request), context);
@@ -689,7 +839,7 @@ DeleteDeploymentOutcome APIGatewayClient::DeleteDeployment(const DeleteDeploymen
 
 DeleteDeploymentOutcomeCallable APIGatewayClient::DeleteDeploymentCallable(const DeleteDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDeployment(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDeployment(request); } );
 }
 
 void APIGatewayClient::DeleteDeploymentAsync(const DeleteDeploymentRequest& request, const DeleteDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -697,6 +847,16 @@ void APIGatewayClient::DeleteDeploymentAsync(const DeleteDeploymentRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDeploymentAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDeploymentOutcomeCallable APIGatewayClient::DeleteDeploymentCallable(DeleteDeploymentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteDeployment, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteDeploymentAsync(DeleteDeploymentRequest&& request, const DeleteDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteDeploymentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteDeploymentAsyncHelper(const DeleteDeploymentRequest& request, const DeleteDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDeployment(request), context);
@@ -721,7 +881,7 @@ DeleteDomainNameOutcome APIGatewayClient::DeleteDomainName(const DeleteDomainNam
 
 DeleteDomainNameOutcomeCallable APIGatewayClient::DeleteDomainNameCallable(const DeleteDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDomainName(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDomainName(request); } );
 }
 
 void APIGatewayClient::DeleteDomainNameAsync(const DeleteDomainNameRequest& request, const DeleteDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -729,6 +889,16 @@ void APIGatewayClient::DeleteDomainNameAsync(const DeleteDomainNameRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDomainNameAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDomainNameOutcomeCallable APIGatewayClient::DeleteDomainNameCallable(DeleteDomainNameRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteDomainName, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteDomainNameAsync(DeleteDomainNameRequest&& request, const DeleteDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteDomainNameAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteDomainNameAsyncHelper(const DeleteDomainNameRequest& request, const DeleteDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDomainName(request), context);
@@ -758,7 +928,7 @@ DeleteIntegrationOutcome APIGatewayClient::DeleteIntegration(const DeleteIntegra
 
 DeleteIntegrationOutcomeCallable APIGatewayClient::DeleteIntegrationCallable(const DeleteIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteIntegration(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteIntegration(request); } );
 }
 
 void APIGatewayClient::DeleteIntegrationAsync(const DeleteIntegrationRequest& request, const DeleteIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -766,6 +936,16 @@ void APIGatewayClient::DeleteIntegrationAsync(const DeleteIntegrationRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->DeleteIntegrationAsyncHelper( request, handler, context ); } );
 }
 
+DeleteIntegrationOutcomeCallable APIGatewayClient::DeleteIntegrationCallable(DeleteIntegrationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteIntegration, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteIntegrationAsync(DeleteIntegrationRequest&& request, const DeleteIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteIntegrationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteIntegrationAsyncHelper(const DeleteIntegrationRequest& request, const DeleteIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteIntegration(request), context);
@@ -796,7 +976,7 @@ DeleteIntegrationResponseOutcome APIGatewayClient::DeleteIntegrationResponse(con
 
 DeleteIntegrationResponseOutcomeCallable APIGatewayClient::DeleteIntegrationResponseCallable(const DeleteIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteIntegrationResponse(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteIntegrationResponse(request); } );
 }
 
 void APIGatewayClient::DeleteIntegrationResponseAsync(const DeleteIntegrationResponseRequest& request, const DeleteIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -804,6 +984,16 @@ void APIGatewayClient::DeleteIntegrationResponseAsync(const DeleteIntegrationRes
   m_executor->Submit( [this, request, handler, context](){ this->DeleteIntegrationResponseAsyncHelper( request, handler, context ); } );
 }
 
+DeleteIntegrationResponseOutcomeCallable APIGatewayClient::DeleteIntegrationResponseCallable(DeleteIntegrationResponseRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteIntegrationResponse, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteIntegrationResponseAsync(DeleteIntegrationResponseRequest&& request, const DeleteIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteIntegrationResponseAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteIntegrationResponseAsyncHelper(const DeleteIntegrationResponseRequest& request, const DeleteIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteIntegrationResponse(request), context);
@@ -832,7 +1022,7 @@ DeleteMethodOutcome APIGatewayClient::DeleteMethod(const DeleteMethodRequest& re
 
 DeleteMethodOutcomeCallable APIGatewayClient::DeleteMethodCallable(const DeleteMethodRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteMethod(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteMethod(request); } );
 }
 
 void APIGatewayClient::DeleteMethodAsync(const DeleteMethodRequest& request, const DeleteMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -840,6 +1030,16 @@ void APIGatewayClient::DeleteMethodAsync(const DeleteMethodRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->DeleteMethodAsyncHelper( request, handler, context ); } );
 }
 
+DeleteMethodOutcomeCallable APIGatewayClient::DeleteMethodCallable(DeleteMethodRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteMethod, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteMethodAsync(DeleteMethodRequest&& request, const DeleteMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteMethodAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteMethodAsyncHelper(const DeleteMethodRequest& request, const DeleteMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteMethod(request), context);
@@ -870,7 +1070,7 @@ DeleteMethodResponseOutcome APIGatewayClient::DeleteMethodResponse(const DeleteM
 
 DeleteMethodResponseOutcomeCallable APIGatewayClient::DeleteMethodResponseCallable(const DeleteMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteMethodResponse(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteMethodResponse(request); } );
 }
 
 void APIGatewayClient::DeleteMethodResponseAsync(const DeleteMethodResponseRequest& request, const DeleteMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -878,6 +1078,16 @@ void APIGatewayClient::DeleteMethodResponseAsync(const DeleteMethodResponseReque
   m_executor->Submit( [this, request, handler, context](){ this->DeleteMethodResponseAsyncHelper( request, handler, context ); } );
 }
 
+DeleteMethodResponseOutcomeCallable APIGatewayClient::DeleteMethodResponseCallable(DeleteMethodResponseRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteMethodResponse, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteMethodResponseAsync(DeleteMethodResponseRequest&& request, const DeleteMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteMethodResponseAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteMethodResponseAsyncHelper(const DeleteMethodResponseRequest& request, const DeleteMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteMethodResponse(request), context);
@@ -904,7 +1114,7 @@ DeleteModelOutcome APIGatewayClient::DeleteModel(const DeleteModelRequest& reque
 
 DeleteModelOutcomeCallable APIGatewayClient::DeleteModelCallable(const DeleteModelRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteModel(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteModel(request); } );
 }
 
 void APIGatewayClient::DeleteModelAsync(const DeleteModelRequest& request, const DeleteModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -912,6 +1122,16 @@ void APIGatewayClient::DeleteModelAsync(const DeleteModelRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DeleteModelAsyncHelper( request, handler, context ); } );
 }
 
+DeleteModelOutcomeCallable APIGatewayClient::DeleteModelCallable(DeleteModelRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteModel, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteModelAsync(DeleteModelRequest&& request, const DeleteModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteModelAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteModelAsyncHelper(const DeleteModelRequest& request, const DeleteModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteModel(request), context);
@@ -938,7 +1158,7 @@ DeleteResourceOutcome APIGatewayClient::DeleteResource(const DeleteResourceReque
 
 DeleteResourceOutcomeCallable APIGatewayClient::DeleteResourceCallable(const DeleteResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteResource(request); } );
 }
 
 void APIGatewayClient::DeleteResourceAsync(const DeleteResourceRequest& request, const DeleteResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -946,6 +1166,16 @@ void APIGatewayClient::DeleteResourceAsync(const DeleteResourceRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DeleteResourceAsyncHelper( request, handler, context ); } );
 }
 
+DeleteResourceOutcomeCallable APIGatewayClient::DeleteResourceCallable(DeleteResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteResource, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteResourceAsync(DeleteResourceRequest&& request, const DeleteResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteResourceAsyncHelper(const DeleteResourceRequest& request, const DeleteResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteResource(request), context);
@@ -970,7 +1200,7 @@ DeleteRestApiOutcome APIGatewayClient::DeleteRestApi(const DeleteRestApiRequest&
 
 DeleteRestApiOutcomeCallable APIGatewayClient::DeleteRestApiCallable(const DeleteRestApiRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRestApi(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRestApi(request); } );
 }
 
 void APIGatewayClient::DeleteRestApiAsync(const DeleteRestApiRequest& request, const DeleteRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -978,6 +1208,16 @@ void APIGatewayClient::DeleteRestApiAsync(const DeleteRestApiRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRestApiAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRestApiOutcomeCallable APIGatewayClient::DeleteRestApiCallable(DeleteRestApiRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteRestApi, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteRestApiAsync(DeleteRestApiRequest&& request, const DeleteRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteRestApiAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteRestApiAsyncHelper(const DeleteRestApiRequest& request, const DeleteRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRestApi(request), context);
@@ -1004,7 +1244,7 @@ DeleteStageOutcome APIGatewayClient::DeleteStage(const DeleteStageRequest& reque
 
 DeleteStageOutcomeCallable APIGatewayClient::DeleteStageCallable(const DeleteStageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteStage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteStage(request); } );
 }
 
 void APIGatewayClient::DeleteStageAsync(const DeleteStageRequest& request, const DeleteStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1012,6 +1252,16 @@ void APIGatewayClient::DeleteStageAsync(const DeleteStageRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DeleteStageAsyncHelper( request, handler, context ); } );
 }
 
+DeleteStageOutcomeCallable APIGatewayClient::DeleteStageCallable(DeleteStageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteStage, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteStageAsync(DeleteStageRequest&& request, const DeleteStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteStageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteStageAsyncHelper(const DeleteStageRequest& request, const DeleteStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteStage(request), context);
@@ -1036,7 +1286,7 @@ DeleteUsagePlanOutcome APIGatewayClient::DeleteUsagePlan(const DeleteUsagePlanRe
 
 DeleteUsagePlanOutcomeCallable APIGatewayClient::DeleteUsagePlanCallable(const DeleteUsagePlanRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteUsagePlan(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteUsagePlan(request); } );
 }
 
 void APIGatewayClient::DeleteUsagePlanAsync(const DeleteUsagePlanRequest& request, const DeleteUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1044,6 +1294,16 @@ void APIGatewayClient::DeleteUsagePlanAsync(const DeleteUsagePlanRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->DeleteUsagePlanAsyncHelper( request, handler, context ); } );
 }
 
+DeleteUsagePlanOutcomeCallable APIGatewayClient::DeleteUsagePlanCallable(DeleteUsagePlanRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteUsagePlan, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteUsagePlanAsync(DeleteUsagePlanRequest&& request, const DeleteUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteUsagePlanAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteUsagePlanAsyncHelper(const DeleteUsagePlanRequest& request, const DeleteUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteUsagePlan(request), context);
@@ -1070,7 +1330,7 @@ DeleteUsagePlanKeyOutcome APIGatewayClient::DeleteUsagePlanKey(const DeleteUsage
 
 DeleteUsagePlanKeyOutcomeCallable APIGatewayClient::DeleteUsagePlanKeyCallable(const DeleteUsagePlanKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteUsagePlanKey(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteUsagePlanKey(request); } );
 }
 
 void APIGatewayClient::DeleteUsagePlanKeyAsync(const DeleteUsagePlanKeyRequest& request, const DeleteUsagePlanKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1078,6 +1338,16 @@ void APIGatewayClient::DeleteUsagePlanKeyAsync(const DeleteUsagePlanKeyRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DeleteUsagePlanKeyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteUsagePlanKeyOutcomeCallable APIGatewayClient::DeleteUsagePlanKeyCallable(DeleteUsagePlanKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::DeleteUsagePlanKey, this, std::move(request)));
+}
+
+void APIGatewayClient::DeleteUsagePlanKeyAsync(DeleteUsagePlanKeyRequest&& request, const DeleteUsagePlanKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::DeleteUsagePlanKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::DeleteUsagePlanKeyAsyncHelper(const DeleteUsagePlanKeyRequest& request, const DeleteUsagePlanKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteUsagePlanKey(request), context);
@@ -1105,7 +1375,7 @@ FlushStageAuthorizersCacheOutcome APIGatewayClient::FlushStageAuthorizersCache(c
 
 FlushStageAuthorizersCacheOutcomeCallable APIGatewayClient::FlushStageAuthorizersCacheCallable(const FlushStageAuthorizersCacheRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->FlushStageAuthorizersCache(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->FlushStageAuthorizersCache(request); } );
 }
 
 void APIGatewayClient::FlushStageAuthorizersCacheAsync(const FlushStageAuthorizersCacheRequest& request, const FlushStageAuthorizersCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1113,6 +1383,16 @@ void APIGatewayClient::FlushStageAuthorizersCacheAsync(const FlushStageAuthorize
   m_executor->Submit( [this, request, handler, context](){ this->FlushStageAuthorizersCacheAsyncHelper( request, handler, context ); } );
 }
 
+FlushStageAuthorizersCacheOutcomeCallable APIGatewayClient::FlushStageAuthorizersCacheCallable(FlushStageAuthorizersCacheRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::FlushStageAuthorizersCache, this, std::move(request)));
+}
+
+void APIGatewayClient::FlushStageAuthorizersCacheAsync(FlushStageAuthorizersCacheRequest&& request, const FlushStageAuthorizersCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::FlushStageAuthorizersCacheAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::FlushStageAuthorizersCacheAsyncHelper(const FlushStageAuthorizersCacheRequest& request, const FlushStageAuthorizersCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, FlushStageAuthorizersCache(request), context);
@@ -1140,7 +1420,7 @@ FlushStageCacheOutcome APIGatewayClient::FlushStageCache(const FlushStageCacheRe
 
 FlushStageCacheOutcomeCallable APIGatewayClient::FlushStageCacheCallable(const FlushStageCacheRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->FlushStageCache(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->FlushStageCache(request); } );
 }
 
 void APIGatewayClient::FlushStageCacheAsync(const FlushStageCacheRequest& request, const FlushStageCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1148,6 +1428,16 @@ void APIGatewayClient::FlushStageCacheAsync(const FlushStageCacheRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->FlushStageCacheAsyncHelper( request, handler, context ); } );
 }
 
+FlushStageCacheOutcomeCallable APIGatewayClient::FlushStageCacheCallable(FlushStageCacheRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::FlushStageCache, this, std::move(request)));
+}
+
+void APIGatewayClient::FlushStageCacheAsync(FlushStageCacheRequest&& request, const FlushStageCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::FlushStageCacheAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::FlushStageCacheAsyncHelper(const FlushStageCacheRequest& request, const FlushStageCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, FlushStageCache(request), context);
@@ -1171,7 +1461,7 @@ GenerateClientCertificateOutcome APIGatewayClient::GenerateClientCertificate(con
 
 GenerateClientCertificateOutcomeCallable APIGatewayClient::GenerateClientCertificateCallable(const GenerateClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GenerateClientCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GenerateClientCertificate(request); } );
 }
 
 void APIGatewayClient::GenerateClientCertificateAsync(const GenerateClientCertificateRequest& request, const GenerateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1179,6 +1469,16 @@ void APIGatewayClient::GenerateClientCertificateAsync(const GenerateClientCertif
   m_executor->Submit( [this, request, handler, context](){ this->GenerateClientCertificateAsyncHelper( request, handler, context ); } );
 }
 
+GenerateClientCertificateOutcomeCallable APIGatewayClient::GenerateClientCertificateCallable(GenerateClientCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GenerateClientCertificate, this, std::move(request)));
+}
+
+void APIGatewayClient::GenerateClientCertificateAsync(GenerateClientCertificateRequest&& request, const GenerateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GenerateClientCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GenerateClientCertificateAsyncHelper(const GenerateClientCertificateRequest& request, const GenerateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GenerateClientCertificate(request), context);
@@ -1202,7 +1502,7 @@ GetAccountOutcome APIGatewayClient::GetAccount(const GetAccountRequest& request)
 
 GetAccountOutcomeCallable APIGatewayClient::GetAccountCallable(const GetAccountRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetAccount(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetAccount(request); } );
 }
 
 void APIGatewayClient::GetAccountAsync(const GetAccountRequest& request, const GetAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1210,6 +1510,16 @@ void APIGatewayClient::GetAccountAsync(const GetAccountRequest& request, const G
   m_executor->Submit( [this, request, handler, context](){ this->GetAccountAsyncHelper( request, handler, context ); } );
 }
 
+GetAccountOutcomeCallable APIGatewayClient::GetAccountCallable(GetAccountRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetAccount, this, std::move(request)));
+}
+
+void APIGatewayClient::GetAccountAsync(GetAccountRequest&& request, const GetAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetAccountAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetAccountAsyncHelper(const GetAccountRequest& request, const GetAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetAccount(request), context);
@@ -1234,7 +1544,7 @@ GetApiKeyOutcome APIGatewayClient::GetApiKey(const GetApiKeyRequest& request) co
 
 GetApiKeyOutcomeCallable APIGatewayClient::GetApiKeyCallable(const GetApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetApiKey(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetApiKey(request); } );
 }
 
 void APIGatewayClient::GetApiKeyAsync(const GetApiKeyRequest& request, const GetApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1242,6 +1552,16 @@ void APIGatewayClient::GetApiKeyAsync(const GetApiKeyRequest& request, const Get
   m_executor->Submit( [this, request, handler, context](){ this->GetApiKeyAsyncHelper( request, handler, context ); } );
 }
 
+GetApiKeyOutcomeCallable APIGatewayClient::GetApiKeyCallable(GetApiKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetApiKey, this, std::move(request)));
+}
+
+void APIGatewayClient::GetApiKeyAsync(GetApiKeyRequest&& request, const GetApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetApiKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetApiKeyAsyncHelper(const GetApiKeyRequest& request, const GetApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetApiKey(request), context);
@@ -1265,7 +1585,7 @@ GetApiKeysOutcome APIGatewayClient::GetApiKeys(const GetApiKeysRequest& request)
 
 GetApiKeysOutcomeCallable APIGatewayClient::GetApiKeysCallable(const GetApiKeysRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetApiKeys(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetApiKeys(request); } );
 }
 
 void APIGatewayClient::GetApiKeysAsync(const GetApiKeysRequest& request, const GetApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1273,6 +1593,16 @@ void APIGatewayClient::GetApiKeysAsync(const GetApiKeysRequest& request, const G
   m_executor->Submit( [this, request, handler, context](){ this->GetApiKeysAsyncHelper( request, handler, context ); } );
 }
 
+GetApiKeysOutcomeCallable APIGatewayClient::GetApiKeysCallable(GetApiKeysRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetApiKeys, this, std::move(request)));
+}
+
+void APIGatewayClient::GetApiKeysAsync(GetApiKeysRequest&& request, const GetApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetApiKeysAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetApiKeysAsyncHelper(const GetApiKeysRequest& request, const GetApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetApiKeys(request), context);
@@ -1299,7 +1629,7 @@ GetAuthorizerOutcome APIGatewayClient::GetAuthorizer(const GetAuthorizerRequest&
 
 GetAuthorizerOutcomeCallable APIGatewayClient::GetAuthorizerCallable(const GetAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetAuthorizer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetAuthorizer(request); } );
 }
 
 void APIGatewayClient::GetAuthorizerAsync(const GetAuthorizerRequest& request, const GetAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1307,6 +1637,16 @@ void APIGatewayClient::GetAuthorizerAsync(const GetAuthorizerRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->GetAuthorizerAsyncHelper( request, handler, context ); } );
 }
 
+GetAuthorizerOutcomeCallable APIGatewayClient::GetAuthorizerCallable(GetAuthorizerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetAuthorizer, this, std::move(request)));
+}
+
+void APIGatewayClient::GetAuthorizerAsync(GetAuthorizerRequest&& request, const GetAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetAuthorizerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetAuthorizerAsyncHelper(const GetAuthorizerRequest& request, const GetAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetAuthorizer(request), context);
@@ -1332,7 +1672,7 @@ GetAuthorizersOutcome APIGatewayClient::GetAuthorizers(const GetAuthorizersReque
 
 GetAuthorizersOutcomeCallable APIGatewayClient::GetAuthorizersCallable(const GetAuthorizersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetAuthorizers(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetAuthorizers(request); } );
 }
 
 void APIGatewayClient::GetAuthorizersAsync(const GetAuthorizersRequest& request, const GetAuthorizersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1340,6 +1680,16 @@ void APIGatewayClient::GetAuthorizersAsync(const GetAuthorizersRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->GetAuthorizersAsyncHelper( request, handler, context ); } );
 }
 
+GetAuthorizersOutcomeCallable APIGatewayClient::GetAuthorizersCallable(GetAuthorizersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetAuthorizers, this, std::move(request)));
+}
+
+void APIGatewayClient::GetAuthorizersAsync(GetAuthorizersRequest&& request, const GetAuthorizersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetAuthorizersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetAuthorizersAsyncHelper(const GetAuthorizersRequest& request, const GetAuthorizersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetAuthorizers(request), context);
@@ -1366,7 +1716,7 @@ GetBasePathMappingOutcome APIGatewayClient::GetBasePathMapping(const GetBasePath
 
 GetBasePathMappingOutcomeCallable APIGatewayClient::GetBasePathMappingCallable(const GetBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBasePathMapping(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBasePathMapping(request); } );
 }
 
 void APIGatewayClient::GetBasePathMappingAsync(const GetBasePathMappingRequest& request, const GetBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1374,6 +1724,16 @@ void APIGatewayClient::GetBasePathMappingAsync(const GetBasePathMappingRequest&
   m_executor->Submit( [this, request, handler, context](){ this->GetBasePathMappingAsyncHelper( request, handler, context ); } );
 }
 
+GetBasePathMappingOutcomeCallable APIGatewayClient::GetBasePathMappingCallable(GetBasePathMappingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetBasePathMapping, this, std::move(request)));
+}
+
+void APIGatewayClient::GetBasePathMappingAsync(GetBasePathMappingRequest&& request, const GetBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetBasePathMappingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetBasePathMappingAsyncHelper(const GetBasePathMappingRequest& request, const GetBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBasePathMapping(request), context);
@@ -1399,7 +1759,7 @@ GetBasePathMappingsOutcome APIGatewayClient::GetBasePathMappings(const GetBasePa
 
 GetBasePathMappingsOutcomeCallable APIGatewayClient::GetBasePathMappingsCallable(const GetBasePathMappingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBasePathMappings(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBasePathMappings(request); } );
 }
 
 void APIGatewayClient::GetBasePathMappingsAsync(const GetBasePathMappingsRequest& request, const GetBasePathMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1407,6 +1767,16 @@ void APIGatewayClient::GetBasePathMappingsAsync(const GetBasePathMappingsRequest
   m_executor->Submit( [this, request, handler, context](){ this->GetBasePathMappingsAsyncHelper( request, handler, context ); } );
 }
 
+GetBasePathMappingsOutcomeCallable APIGatewayClient::GetBasePathMappingsCallable(GetBasePathMappingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetBasePathMappings, this, std::move(request)));
+}
+
+void APIGatewayClient::GetBasePathMappingsAsync(GetBasePathMappingsRequest&& request, const GetBasePathMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetBasePathMappingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetBasePathMappingsAsyncHelper(const GetBasePathMappingsRequest& request, const GetBasePathMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBasePathMappings(request), context);
@@ -1431,7 +1801,7 @@ GetClientCertificateOutcome APIGatewayClient::GetClientCertificate(const GetClie
 
 GetClientCertificateOutcomeCallable APIGatewayClient::GetClientCertificateCallable(const GetClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetClientCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetClientCertificate(request); } );
 }
 
 void APIGatewayClient::GetClientCertificateAsync(const GetClientCertificateRequest& request, const GetClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1439,6 +1809,16 @@ void APIGatewayClient::GetClientCertificateAsync(const GetClientCertificateReque
   m_executor->Submit( [this, request, handler, context](){ this->GetClientCertificateAsyncHelper( request, handler, context ); } );
 }
 
+GetClientCertificateOutcomeCallable APIGatewayClient::GetClientCertificateCallable(GetClientCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetClientCertificate, this, std::move(request)));
+}
+
+void APIGatewayClient::GetClientCertificateAsync(GetClientCertificateRequest&& request, const GetClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetClientCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetClientCertificateAsyncHelper(const GetClientCertificateRequest& request, const GetClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetClientCertificate(request), context);
@@ -1462,7 +1842,7 @@ GetClientCertificatesOutcome APIGatewayClient::GetClientCertificates(const GetCl
 
 GetClientCertificatesOutcomeCallable APIGatewayClient::GetClientCertificatesCallable(const GetClientCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetClientCertificates(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetClientCertificates(request); } );
 }
 
 void APIGatewayClient::GetClientCertificatesAsync(const GetClientCertificatesRequest& request, const GetClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1470,6 +1850,16 @@ void APIGatewayClient::GetClientCertificatesAsync(const GetClientCertificatesReq
   m_executor->Submit( [this, request, handler, context](){ this->GetClientCertificatesAsyncHelper( request, handler, context ); } );
 }
 
+GetClientCertificatesOutcomeCallable APIGatewayClient::GetClientCertificatesCallable(GetClientCertificatesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetClientCertificates, this, std::move(request)));
+}
+
+void APIGatewayClient::GetClientCertificatesAsync(GetClientCertificatesRequest&& request, const GetClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetClientCertificatesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetClientCertificatesAsyncHelper(const GetClientCertificatesRequest& request, const GetClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetClientCertificates(request), context);
@@ -1496,7 +1886,7 @@ GetDeploymentOutcome APIGatewayClient::GetDeployment(const GetDeploymentRequest&
 
 GetDeploymentOutcomeCallable APIGatewayClient::GetDeploymentCallable(const GetDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDeployment(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDeployment(request); } );
 }
 
 void APIGatewayClient::GetDeploymentAsync(const GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1504,6 +1894,16 @@ void APIGatewayClient::GetDeploymentAsync(const GetDeploymentRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->GetDeploymentAsyncHelper( request, handler, context ); } );
 }
 
+GetDeploymentOutcomeCallable APIGatewayClient::GetDeploymentCallable(GetDeploymentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetDeployment, this, std::move(request)));
+}
+
+void APIGatewayClient::GetDeploymentAsync(GetDeploymentRequest&& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetDeploymentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetDeploymentAsyncHelper(const GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDeployment(request), context);
@@ -1529,7 +1929,7 @@ GetDeploymentsOutcome APIGatewayClient::GetDeployments(const GetDeploymentsReque
 
 GetDeploymentsOutcomeCallable APIGatewayClient::GetDeploymentsCallable(const GetDeploymentsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDeployments(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDeployments(request); } );
 }
 
 void APIGatewayClient::GetDeploymentsAsync(const GetDeploymentsRequest& request, const GetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1537,6 +1937,16 @@ void APIGatewayClient::GetDeploymentsAsync(const GetDeploymentsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->GetDeploymentsAsyncHelper( request, handler, context ); } );
 }
 
+GetDeploymentsOutcomeCallable APIGatewayClient::GetDeploymentsCallable(GetDeploymentsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetDeployments, this, std::move(request)));
+}
+
+void APIGatewayClient::GetDeploymentsAsync(GetDeploymentsRequest&& request, const GetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetDeploymentsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetDeploymentsAsyncHelper(const GetDeploymentsRequest& request, const GetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDeployments(request), context);
@@ -1561,7 +1971,7 @@ GetDomainNameOutcome APIGatewayClient::GetDomainName(const GetDomainNameRequest&
 
 GetDomainNameOutcomeCallable APIGatewayClient::GetDomainNameCallable(const GetDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDomainName(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDomainName(request); } );
 }
 
 void APIGatewayClient::GetDomainNameAsync(const GetDomainNameRequest& request, const GetDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1569,6 +1979,16 @@ void APIGatewayClient::GetDomainNameAsync(const GetDomainNameRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->GetDomainNameAsyncHelper( request, handler, context ); } );
 }
 
+GetDomainNameOutcomeCallable APIGatewayClient::GetDomainNameCallable(GetDomainNameRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetDomainName, this, std::move(request)));
+}
+
+void APIGatewayClient::GetDomainNameAsync(GetDomainNameRequest&& request, const GetDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetDomainNameAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetDomainNameAsyncHelper(const GetDomainNameRequest& request, const GetDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDomainName(request), context);
@@ -1592,7 +2012,7 @@ GetDomainNamesOutcome APIGatewayClient::GetDomainNames(const GetDomainNamesReque
 
 GetDomainNamesOutcomeCallable APIGatewayClient::GetDomainNamesCallable(const GetDomainNamesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDomainNames(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDomainNames(request); } );
 }
 
 void APIGatewayClient::GetDomainNamesAsync(const GetDomainNamesRequest& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1600,14 +2020,24 @@ void APIGatewayClient::GetDomainNamesAsync(const GetDomainNamesRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->GetDomainNamesAsyncHelper( request, handler, context ); } );
 }
 
-void APIGatewayClient::GetDomainNamesAsyncHelper(const GetDomainNamesRequest& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+GetDomainNamesOutcomeCallable APIGatewayClient::GetDomainNamesCallable(GetDomainNamesRequest&& request) const
 {
-  handler(this, request, GetDomainNames(request), context);
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetDomainNames, this, std::move(request)));
 }
 
-GetExportOutcome APIGatewayClient::GetExport(const GetExportRequest& request) const
+void APIGatewayClient::GetDomainNamesAsync(GetDomainNamesRequest&& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  Aws::StringStream ss;
+  m_executor->Submit(&APIGatewayClient::GetDomainNamesAsyncHelper, this, std::move(request), handler, context);
+}
+
+void APIGatewayClient::GetDomainNamesAsyncHelper(const GetDomainNamesRequest& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  handler(this, request, GetDomainNames(request), context);
+}
+
+GetExportOutcome APIGatewayClient::GetExport(const GetExportRequest& request) const
+{
+  Aws::StringStream ss;
   ss << m_uri << "/restapis/";
   ss << request.GetRestApiId();
   ss << "/stages/";
@@ -1628,7 +2058,7 @@ GetExportOutcome APIGatewayClient::GetExport(const GetExportRequest& request) co
 
 GetExportOutcomeCallable APIGatewayClient::GetExportCallable(const GetExportRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetExport(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetExport(request); } );
 }
 
 void APIGatewayClient::GetExportAsync(const GetExportRequest& request, const GetExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1636,6 +2066,16 @@ void APIGatewayClient::GetExportAsync(const GetExportRequest& request, const Get
   m_executor->Submit( [this, request, handler, context](){ this->GetExportAsyncHelper( request, handler, context ); } );
 }
 
+GetExportOutcomeCallable APIGatewayClient::GetExportCallable(GetExportRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetExport, this, std::move(request)));
+}
+
+void APIGatewayClient::GetExportAsync(GetExportRequest&& request, const GetExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetExportAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetExportAsyncHelper(const GetExportRequest& request, const GetExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetExport(request), context);
@@ -1665,7 +2105,7 @@ GetIntegrationOutcome APIGatewayClient::GetIntegration(const GetIntegrationReque
 
 GetIntegrationOutcomeCallable APIGatewayClient::GetIntegrationCallable(const GetIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetIntegration(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetIntegration(request); } );
 }
 
 void APIGatewayClient::GetIntegrationAsync(const GetIntegrationRequest& request, const GetIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1673,6 +2113,16 @@ void APIGatewayClient::GetIntegrationAsync(const GetIntegrationRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->GetIntegrationAsyncHelper( request, handler, context ); } );
 }
 
+GetIntegrationOutcomeCallable APIGatewayClient::GetIntegrationCallable(GetIntegrationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetIntegration, this, std::move(request)));
+}
+
+void APIGatewayClient::GetIntegrationAsync(GetIntegrationRequest&& request, const GetIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetIntegrationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetIntegrationAsyncHelper(const GetIntegrationRequest& request, const GetIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetIntegration(request), context);
@@ -1703,7 +2153,7 @@ GetIntegrationResponseOutcome APIGatewayClient::GetIntegrationResponse(const Get
 
 GetIntegrationResponseOutcomeCallable APIGatewayClient::GetIntegrationResponseCallable(const GetIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetIntegrationResponse(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetIntegrationResponse(request); } );
 }
 
 void APIGatewayClient::GetIntegrationResponseAsync(const GetIntegrationResponseRequest& request, const GetIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1711,6 +2161,16 @@ void APIGatewayClient::GetIntegrationResponseAsync(const GetIntegrationResponseR
   m_executor->Submit( [this, request, handler, context](){ this->GetIntegrationResponseAsyncHelper( request, handler, context ); } );
 }
 
+GetIntegrationResponseOutcomeCallable APIGatewayClient::GetIntegrationResponseCallable(GetIntegrationResponseRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetIntegrationResponse, this, std::move(request)));
+}
+
+void APIGatewayClient::GetIntegrationResponseAsync(GetIntegrationResponseRequest&& request, const GetIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetIntegrationResponseAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetIntegrationResponseAsyncHelper(const GetIntegrationResponseRequest& request, const GetIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetIntegrationResponse(request), context);
@@ -1739,7 +2199,7 @@ GetMethodOutcome APIGatewayClient::GetMethod(const GetMethodRequest& request) co
 
 GetMethodOutcomeCallable APIGatewayClient::GetMethodCallable(const GetMethodRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetMethod(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetMethod(request); } );
 }
 
 void APIGatewayClient::GetMethodAsync(const GetMethodRequest& request, const GetMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1747,6 +2207,16 @@ void APIGatewayClient::GetMethodAsync(const GetMethodRequest& request, const Get
   m_executor->Submit( [this, request, handler, context](){ this->GetMethodAsyncHelper( request, handler, context ); } );
 }
 
+GetMethodOutcomeCallable APIGatewayClient::GetMethodCallable(GetMethodRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetMethod, this, std::move(request)));
+}
+
+void APIGatewayClient::GetMethodAsync(GetMethodRequest&& request, const GetMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetMethodAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetMethodAsyncHelper(const GetMethodRequest& request, const GetMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetMethod(request), context);
@@ -1777,7 +2247,7 @@ GetMethodResponseOutcome APIGatewayClient::GetMethodResponse(const GetMethodResp
 
 GetMethodResponseOutcomeCallable APIGatewayClient::GetMethodResponseCallable(const GetMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetMethodResponse(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetMethodResponse(request); } );
 }
 
 void APIGatewayClient::GetMethodResponseAsync(const GetMethodResponseRequest& request, const GetMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1785,6 +2255,16 @@ void APIGatewayClient::GetMethodResponseAsync(const GetMethodResponseRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->GetMethodResponseAsyncHelper( request, handler, context ); } );
 }
 
+GetMethodResponseOutcomeCallable APIGatewayClient::GetMethodResponseCallable(GetMethodResponseRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetMethodResponse, this, std::move(request)));
+}
+
+void APIGatewayClient::GetMethodResponseAsync(GetMethodResponseRequest&& request, const GetMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetMethodResponseAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetMethodResponseAsyncHelper(const GetMethodResponseRequest& request, const GetMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetMethodResponse(request), context);
@@ -1811,7 +2291,7 @@ GetModelOutcome APIGatewayClient::GetModel(const GetModelRequest& request) const
 
 GetModelOutcomeCallable APIGatewayClient::GetModelCallable(const GetModelRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetModel(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetModel(request); } );
 }
 
 void APIGatewayClient::GetModelAsync(const GetModelRequest& request, const GetModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1819,6 +2299,16 @@ void APIGatewayClient::GetModelAsync(const GetModelRequest& request, const GetMo
   m_executor->Submit( [this, request, handler, context](){ this->GetModelAsyncHelper( request, handler, context ); } );
 }
 
+GetModelOutcomeCallable APIGatewayClient::GetModelCallable(GetModelRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetModel, this, std::move(request)));
+}
+
+void APIGatewayClient::GetModelAsync(GetModelRequest&& request, const GetModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetModelAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetModelAsyncHelper(const GetModelRequest& request, const GetModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetModel(request), context);
@@ -1846,7 +2336,7 @@ GetModelTemplateOutcome APIGatewayClient::GetModelTemplate(const GetModelTemplat
 
 GetModelTemplateOutcomeCallable APIGatewayClient::GetModelTemplateCallable(const GetModelTemplateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetModelTemplate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetModelTemplate(request); } );
 }
 
 void APIGatewayClient::GetModelTemplateAsync(const GetModelTemplateRequest& request, const GetModelTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1854,6 +2344,16 @@ void APIGatewayClient::GetModelTemplateAsync(const GetModelTemplateRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->GetModelTemplateAsyncHelper( request, handler, context ); } );
 }
 
+GetModelTemplateOutcomeCallable APIGatewayClient::GetModelTemplateCallable(GetModelTemplateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetModelTemplate, this, std::move(request)));
+}
+
+void APIGatewayClient::GetModelTemplateAsync(GetModelTemplateRequest&& request, const GetModelTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetModelTemplateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetModelTemplateAsyncHelper(const GetModelTemplateRequest& request, const GetModelTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetModelTemplate(request), context);
@@ -1879,7 +2379,7 @@ GetModelsOutcome APIGatewayClient::GetModels(const GetModelsRequest& request) co
 
 GetModelsOutcomeCallable APIGatewayClient::GetModelsCallable(const GetModelsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetModels(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetModels(request); } );
 }
 
 void APIGatewayClient::GetModelsAsync(const GetModelsRequest& request, const GetModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1887,6 +2387,16 @@ void APIGatewayClient::GetModelsAsync(const GetModelsRequest& request, const Get
   m_executor->Submit( [this, request, handler, context](){ this->GetModelsAsyncHelper( request, handler, context ); } );
 }
 
+GetModelsOutcomeCallable APIGatewayClient::GetModelsCallable(GetModelsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetModels, this, std::move(request)));
+}
+
+void APIGatewayClient::GetModelsAsync(GetModelsRequest&& request, const GetModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetModelsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetModelsAsyncHelper(const GetModelsRequest& request, const GetModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetModels(request), context);
@@ -1913,7 +2423,7 @@ GetResourceOutcome APIGatewayClient::GetResource(const GetResourceRequest& reque
 
 GetResourceOutcomeCallable APIGatewayClient::GetResourceCallable(const GetResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetResource(request); } );
 }
 
 void APIGatewayClient::GetResourceAsync(const GetResourceRequest& request, const GetResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1921,6 +2431,16 @@ void APIGatewayClient::GetResourceAsync(const GetResourceRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->GetResourceAsyncHelper( request, handler, context ); } );
 }
 
+GetResourceOutcomeCallable APIGatewayClient::GetResourceCallable(GetResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetResource, this, std::move(request)));
+}
+
+void APIGatewayClient::GetResourceAsync(GetResourceRequest&& request, const GetResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetResourceAsyncHelper(const GetResourceRequest& request, const GetResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetResource(request), context);
@@ -1946,7 +2466,7 @@ GetResourcesOutcome APIGatewayClient::GetResources(const GetResourcesRequest& re
 
 GetResourcesOutcomeCallable APIGatewayClient::GetResourcesCallable(const GetResourcesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetResources(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetResources(request); } );
 }
 
 void APIGatewayClient::GetResourcesAsync(const GetResourcesRequest& request, const GetResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1954,6 +2474,16 @@ void APIGatewayClient::GetResourcesAsync(const GetResourcesRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->GetResourcesAsyncHelper( request, handler, context ); } );
 }
 
+GetResourcesOutcomeCallable APIGatewayClient::GetResourcesCallable(GetResourcesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetResources, this, std::move(request)));
+}
+
+void APIGatewayClient::GetResourcesAsync(GetResourcesRequest&& request, const GetResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetResourcesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetResourcesAsyncHelper(const GetResourcesRequest& request, const GetResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetResources(request), context);
@@ -1978,7 +2508,7 @@ GetRestApiOutcome APIGatewayClient::GetRestApi(const GetRestApiRequest& request)
 
 GetRestApiOutcomeCallable APIGatewayClient::GetRestApiCallable(const GetRestApiRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetRestApi(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetRestApi(request); } );
 }
 
 void APIGatewayClient::GetRestApiAsync(const GetRestApiRequest& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1986,6 +2516,16 @@ void APIGatewayClient::GetRestApiAsync(const GetRestApiRequest& request, const G
   m_executor->Submit( [this, request, handler, context](){ this->GetRestApiAsyncHelper( request, handler, context ); } );
 }
 
+GetRestApiOutcomeCallable APIGatewayClient::GetRestApiCallable(GetRestApiRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetRestApi, this, std::move(request)));
+}
+
+void APIGatewayClient::GetRestApiAsync(GetRestApiRequest&& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetRestApiAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetRestApiAsyncHelper(const GetRestApiRequest& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetRestApi(request), context);
@@ -2009,7 +2549,7 @@ GetRestApisOutcome APIGatewayClient::GetRestApis(const GetRestApisRequest& reque
 
 GetRestApisOutcomeCallable APIGatewayClient::GetRestApisCallable(const GetRestApisRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetRestApis(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetRestApis(request); } );
 }
 
 void APIGatewayClient::GetRestApisAsync(const GetRestApisRequest& request, const GetRestApisResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2017,6 +2557,16 @@ void APIGatewayClient::GetRestApisAsync(const GetRestApisRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->GetRestApisAsyncHelper( request, handler, context ); } );
 }
 
+GetRestApisOutcomeCallable APIGatewayClient::GetRestApisCallable(GetRestApisRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetRestApis, this, std::move(request)));
+}
+
+void APIGatewayClient::GetRestApisAsync(GetRestApisRequest&& request, const GetRestApisResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetRestApisAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetRestApisAsyncHelper(const GetRestApisRequest& request, const GetRestApisResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetRestApis(request), context);
@@ -2045,7 +2595,7 @@ GetSdkOutcome APIGatewayClient::GetSdk(const GetSdkRequest& request) const
 
 GetSdkOutcomeCallable APIGatewayClient::GetSdkCallable(const GetSdkRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetSdk(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetSdk(request); } );
 }
 
 void APIGatewayClient::GetSdkAsync(const GetSdkRequest& request, const GetSdkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2053,6 +2603,16 @@ void APIGatewayClient::GetSdkAsync(const GetSdkRequest& request, const GetSdkRes
   m_executor->Submit( [this, request, handler, context](){ this->GetSdkAsyncHelper( request, handler, context ); } );
 }
 
+GetSdkOutcomeCallable APIGatewayClient::GetSdkCallable(GetSdkRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetSdk, this, std::move(request)));
+}
+
+void APIGatewayClient::GetSdkAsync(GetSdkRequest&& request, const GetSdkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetSdkAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetSdkAsyncHelper(const GetSdkRequest& request, const GetSdkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetSdk(request), context);
@@ -2079,7 +2639,7 @@ GetStageOutcome APIGatewayClient::GetStage(const GetStageRequest& request) const
 
 GetStageOutcomeCallable APIGatewayClient::GetStageCallable(const GetStageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetStage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetStage(request); } );
 }
 
 void APIGatewayClient::GetStageAsync(const GetStageRequest& request, const GetStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2087,6 +2647,16 @@ void APIGatewayClient::GetStageAsync(const GetStageRequest& request, const GetSt
   m_executor->Submit( [this, request, handler, context](){ this->GetStageAsyncHelper( request, handler, context ); } );
 }
 
+GetStageOutcomeCallable APIGatewayClient::GetStageCallable(GetStageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetStage, this, std::move(request)));
+}
+
+void APIGatewayClient::GetStageAsync(GetStageRequest&& request, const GetStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetStageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetStageAsyncHelper(const GetStageRequest& request, const GetStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetStage(request), context);
@@ -2112,7 +2682,7 @@ GetStagesOutcome APIGatewayClient::GetStages(const GetStagesRequest& request) co
 
 GetStagesOutcomeCallable APIGatewayClient::GetStagesCallable(const GetStagesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetStages(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetStages(request); } );
 }
 
 void APIGatewayClient::GetStagesAsync(const GetStagesRequest& request, const GetStagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2120,6 +2690,16 @@ void APIGatewayClient::GetStagesAsync(const GetStagesRequest& request, const Get
   m_executor->Submit( [this, request, handler, context](){ this->GetStagesAsyncHelper( request, handler, context ); } );
 }
 
+GetStagesOutcomeCallable APIGatewayClient::GetStagesCallable(GetStagesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetStages, this, std::move(request)));
+}
+
+void APIGatewayClient::GetStagesAsync(GetStagesRequest&& request, const GetStagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetStagesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetStagesAsyncHelper(const GetStagesRequest& request, const GetStagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetStages(request), context);
@@ -2145,7 +2725,7 @@ GetUsageOutcome APIGatewayClient::GetUsage(const GetUsageRequest& request) const
 
 GetUsageOutcomeCallable APIGatewayClient::GetUsageCallable(const GetUsageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetUsage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetUsage(request); } );
 }
 
 void APIGatewayClient::GetUsageAsync(const GetUsageRequest& request, const GetUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2153,6 +2733,16 @@ void APIGatewayClient::GetUsageAsync(const GetUsageRequest& request, const GetUs
   m_executor->Submit( [this, request, handler, context](){ this->GetUsageAsyncHelper( request, handler, context ); } );
 }
 
+GetUsageOutcomeCallable APIGatewayClient::GetUsageCallable(GetUsageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetUsage, this, std::move(request)));
+}
+
+void APIGatewayClient::GetUsageAsync(GetUsageRequest&& request, const GetUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetUsageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetUsageAsyncHelper(const GetUsageRequest& request, const GetUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetUsage(request), context);
@@ -2177,7 +2767,7 @@ GetUsagePlanOutcome APIGatewayClient::GetUsagePlan(const GetUsagePlanRequest& re
 
 GetUsagePlanOutcomeCallable APIGatewayClient::GetUsagePlanCallable(const GetUsagePlanRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetUsagePlan(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetUsagePlan(request); } );
 }
 
 void APIGatewayClient::GetUsagePlanAsync(const GetUsagePlanRequest& request, const GetUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2185,6 +2775,16 @@ void APIGatewayClient::GetUsagePlanAsync(const GetUsagePlanRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->GetUsagePlanAsyncHelper( request, handler, context ); } );
 }
 
+GetUsagePlanOutcomeCallable APIGatewayClient::GetUsagePlanCallable(GetUsagePlanRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetUsagePlan, this, std::move(request)));
+}
+
+void APIGatewayClient::GetUsagePlanAsync(GetUsagePlanRequest&& request, const GetUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetUsagePlanAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetUsagePlanAsyncHelper(const GetUsagePlanRequest& request, const GetUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetUsagePlan(request), context);
@@ -2211,7 +2811,7 @@ GetUsagePlanKeyOutcome APIGatewayClient::GetUsagePlanKey(const GetUsagePlanKeyRe
 
 GetUsagePlanKeyOutcomeCallable APIGatewayClient::GetUsagePlanKeyCallable(const GetUsagePlanKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetUsagePlanKey(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetUsagePlanKey(request); } );
 }
 
 void APIGatewayClient::GetUsagePlanKeyAsync(const GetUsagePlanKeyRequest& request, const GetUsagePlanKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2219,6 +2819,16 @@ void APIGatewayClient::GetUsagePlanKeyAsync(const GetUsagePlanKeyRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->GetUsagePlanKeyAsyncHelper( request, handler, context ); } );
 }
 
+GetUsagePlanKeyOutcomeCallable APIGatewayClient::GetUsagePlanKeyCallable(GetUsagePlanKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetUsagePlanKey, this, std::move(request)));
+}
+
+void APIGatewayClient::GetUsagePlanKeyAsync(GetUsagePlanKeyRequest&& request, const GetUsagePlanKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetUsagePlanKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetUsagePlanKeyAsyncHelper(const GetUsagePlanKeyRequest& request, const GetUsagePlanKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetUsagePlanKey(request), context);
@@ -2244,7 +2854,7 @@ GetUsagePlanKeysOutcome APIGatewayClient::GetUsagePlanKeys(const GetUsagePlanKey
 
 GetUsagePlanKeysOutcomeCallable APIGatewayClient::GetUsagePlanKeysCallable(const GetUsagePlanKeysRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetUsagePlanKeys(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetUsagePlanKeys(request); } );
 }
 
 void APIGatewayClient::GetUsagePlanKeysAsync(const GetUsagePlanKeysRequest& request, const GetUsagePlanKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2252,6 +2862,16 @@ void APIGatewayClient::GetUsagePlanKeysAsync(const GetUsagePlanKeysRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->GetUsagePlanKeysAsyncHelper( request, handler, context ); } );
 }
 
+GetUsagePlanKeysOutcomeCallable APIGatewayClient::GetUsagePlanKeysCallable(GetUsagePlanKeysRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetUsagePlanKeys, this, std::move(request)));
+}
+
+void APIGatewayClient::GetUsagePlanKeysAsync(GetUsagePlanKeysRequest&& request, const GetUsagePlanKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetUsagePlanKeysAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetUsagePlanKeysAsyncHelper(const GetUsagePlanKeysRequest& request, const GetUsagePlanKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetUsagePlanKeys(request), context);
@@ -2275,7 +2895,7 @@ GetUsagePlansOutcome APIGatewayClient::GetUsagePlans(const GetUsagePlansRequest&
 
 GetUsagePlansOutcomeCallable APIGatewayClient::GetUsagePlansCallable(const GetUsagePlansRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetUsagePlans(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetUsagePlans(request); } );
 }
 
 void APIGatewayClient::GetUsagePlansAsync(const GetUsagePlansRequest& request, const GetUsagePlansResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2283,6 +2903,16 @@ void APIGatewayClient::GetUsagePlansAsync(const GetUsagePlansRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->GetUsagePlansAsyncHelper( request, handler, context ); } );
 }
 
+GetUsagePlansOutcomeCallable APIGatewayClient::GetUsagePlansCallable(GetUsagePlansRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::GetUsagePlans, this, std::move(request)));
+}
+
+void APIGatewayClient::GetUsagePlansAsync(GetUsagePlansRequest&& request, const GetUsagePlansResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::GetUsagePlansAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::GetUsagePlansAsyncHelper(const GetUsagePlansRequest& request, const GetUsagePlansResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetUsagePlans(request), context);
@@ -2306,7 +2936,7 @@ ImportApiKeysOutcome APIGatewayClient::ImportApiKeys(const ImportApiKeysRequest&
 
 ImportApiKeysOutcomeCallable APIGatewayClient::ImportApiKeysCallable(const ImportApiKeysRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ImportApiKeys(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ImportApiKeys(request); } );
 }
 
 void APIGatewayClient::ImportApiKeysAsync(const ImportApiKeysRequest& request, const ImportApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2314,6 +2944,16 @@ void APIGatewayClient::ImportApiKeysAsync(const ImportApiKeysRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->ImportApiKeysAsyncHelper( request, handler, context ); } );
 }
 
+ImportApiKeysOutcomeCallable APIGatewayClient::ImportApiKeysCallable(ImportApiKeysRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::ImportApiKeys, this, std::move(request)));
+}
+
+void APIGatewayClient::ImportApiKeysAsync(ImportApiKeysRequest&& request, const ImportApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::ImportApiKeysAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::ImportApiKeysAsyncHelper(const ImportApiKeysRequest& request, const ImportApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ImportApiKeys(request), context);
@@ -2337,7 +2977,7 @@ ImportRestApiOutcome APIGatewayClient::ImportRestApi(const ImportRestApiRequest&
 
 ImportRestApiOutcomeCallable APIGatewayClient::ImportRestApiCallable(const ImportRestApiRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ImportRestApi(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ImportRestApi(request); } );
 }
 
 void APIGatewayClient::ImportRestApiAsync(const ImportRestApiRequest& request, const ImportRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2345,6 +2985,16 @@ void APIGatewayClient::ImportRestApiAsync(const ImportRestApiRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->ImportRestApiAsyncHelper( request, handler, context ); } );
 }
 
+ImportRestApiOutcomeCallable APIGatewayClient::ImportRestApiCallable(ImportRestApiRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::ImportRestApi, this, std::move(request)));
+}
+
+void APIGatewayClient::ImportRestApiAsync(ImportRestApiRequest&& request, const ImportRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::ImportRestApiAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::ImportRestApiAsyncHelper(const ImportRestApiRequest& request, const ImportRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ImportRestApi(request), context);
@@ -2374,7 +3024,7 @@ PutIntegrationOutcome APIGatewayClient::PutIntegration(const PutIntegrationReque
 
 PutIntegrationOutcomeCallable APIGatewayClient::PutIntegrationCallable(const PutIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutIntegration(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutIntegration(request); } );
 }
 
 void APIGatewayClient::PutIntegrationAsync(const PutIntegrationRequest& request, const PutIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2382,6 +3032,16 @@ void APIGatewayClient::PutIntegrationAsync(const PutIntegrationRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->PutIntegrationAsyncHelper( request, handler, context ); } );
 }
 
+PutIntegrationOutcomeCallable APIGatewayClient::PutIntegrationCallable(PutIntegrationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::PutIntegration, this, std::move(request)));
+}
+
+void APIGatewayClient::PutIntegrationAsync(PutIntegrationRequest&& request, const PutIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::PutIntegrationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::PutIntegrationAsyncHelper(const PutIntegrationRequest& request, const PutIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutIntegration(request), context);
@@ -2412,7 +3072,7 @@ PutIntegrationResponseOutcome APIGatewayClient::PutIntegrationResponse(const Put
 
 PutIntegrationResponseOutcomeCallable APIGatewayClient::PutIntegrationResponseCallable(const PutIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutIntegrationResponse(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutIntegrationResponse(request); } );
 }
 
 void APIGatewayClient::PutIntegrationResponseAsync(const PutIntegrationResponseRequest& request, const PutIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2420,6 +3080,16 @@ void APIGatewayClient::PutIntegrationResponseAsync(const PutIntegrationResponseR
   m_executor->Submit( [this, request, handler, context](){ this->PutIntegrationResponseAsyncHelper( request, handler, context ); } );
 }
 
+PutIntegrationResponseOutcomeCallable APIGatewayClient::PutIntegrationResponseCallable(PutIntegrationResponseRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::PutIntegrationResponse, this, std::move(request)));
+}
+
+void APIGatewayClient::PutIntegrationResponseAsync(PutIntegrationResponseRequest&& request, const PutIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::PutIntegrationResponseAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::PutIntegrationResponseAsyncHelper(const PutIntegrationResponseRequest& request, const PutIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutIntegrationResponse(request), context);
@@ -2448,7 +3118,7 @@ PutMethodOutcome APIGatewayClient::PutMethod(const PutMethodRequest& request) co
 
 PutMethodOutcomeCallable APIGatewayClient::PutMethodCallable(const PutMethodRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutMethod(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutMethod(request); } );
 }
 
 void APIGatewayClient::PutMethodAsync(const PutMethodRequest& request, const PutMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2456,6 +3126,16 @@ void APIGatewayClient::PutMethodAsync(const PutMethodRequest& request, const Put
   m_executor->Submit( [this, request, handler, context](){ this->PutMethodAsyncHelper( request, handler, context ); } );
 }
 
+PutMethodOutcomeCallable APIGatewayClient::PutMethodCallable(PutMethodRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::PutMethod, this, std::move(request)));
+}
+
+void APIGatewayClient::PutMethodAsync(PutMethodRequest&& request, const PutMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::PutMethodAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::PutMethodAsyncHelper(const PutMethodRequest& request, const PutMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutMethod(request), context);
@@ -2486,7 +3166,7 @@ PutMethodResponseOutcome APIGatewayClient::PutMethodResponse(const PutMethodResp
 
 PutMethodResponseOutcomeCallable APIGatewayClient::PutMethodResponseCallable(const PutMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutMethodResponse(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutMethodResponse(request); } );
 }
 
 void APIGatewayClient::PutMethodResponseAsync(const PutMethodResponseRequest& request, const PutMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2494,6 +3174,16 @@ void APIGatewayClient::PutMethodResponseAsync(const PutMethodResponseRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->PutMethodResponseAsyncHelper( request, handler, context ); } );
 }
 
+PutMethodResponseOutcomeCallable APIGatewayClient::PutMethodResponseCallable(PutMethodResponseRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::PutMethodResponse, this, std::move(request)));
+}
+
+void APIGatewayClient::PutMethodResponseAsync(PutMethodResponseRequest&& request, const PutMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::PutMethodResponseAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::PutMethodResponseAsyncHelper(const PutMethodResponseRequest& request, const PutMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutMethodResponse(request), context);
@@ -2518,7 +3208,7 @@ PutRestApiOutcome APIGatewayClient::PutRestApi(const PutRestApiRequest& request)
 
 PutRestApiOutcomeCallable APIGatewayClient::PutRestApiCallable(const PutRestApiRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutRestApi(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutRestApi(request); } );
 }
 
 void APIGatewayClient::PutRestApiAsync(const PutRestApiRequest& request, const PutRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2526,6 +3216,16 @@ void APIGatewayClient::PutRestApiAsync(const PutRestApiRequest& request, const P
   m_executor->Submit( [this, request, handler, context](){ this->PutRestApiAsyncHelper( request, handler, context ); } );
 }
 
+PutRestApiOutcomeCallable APIGatewayClient::PutRestApiCallable(PutRestApiRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::PutRestApi, this, std::move(request)));
+}
+
+void APIGatewayClient::PutRestApiAsync(PutRestApiRequest&& request, const PutRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::PutRestApiAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::PutRestApiAsyncHelper(const PutRestApiRequest& request, const PutRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutRestApi(request), context);
@@ -2552,7 +3252,7 @@ TestInvokeAuthorizerOutcome APIGatewayClient::TestInvokeAuthorizer(const TestInv
 
 TestInvokeAuthorizerOutcomeCallable APIGatewayClient::TestInvokeAuthorizerCallable(const TestInvokeAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TestInvokeAuthorizer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TestInvokeAuthorizer(request); } );
 }
 
 void APIGatewayClient::TestInvokeAuthorizerAsync(const TestInvokeAuthorizerRequest& request, const TestInvokeAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2560,6 +3260,16 @@ void APIGatewayClient::TestInvokeAuthorizerAsync(const TestInvokeAuthorizerReque
   m_executor->Submit( [this, request, handler, context](){ this->TestInvokeAuthorizerAsyncHelper( request, handler, context ); } );
 }
 
+TestInvokeAuthorizerOutcomeCallable APIGatewayClient::TestInvokeAuthorizerCallable(TestInvokeAuthorizerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::TestInvokeAuthorizer, this, std::move(request)));
+}
+
+void APIGatewayClient::TestInvokeAuthorizerAsync(TestInvokeAuthorizerRequest&& request, const TestInvokeAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::TestInvokeAuthorizerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::TestInvokeAuthorizerAsyncHelper(const TestInvokeAuthorizerRequest& request, const TestInvokeAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TestInvokeAuthorizer(request), context);
@@ -2588,7 +3298,7 @@ TestInvokeMethodOutcome APIGatewayClient::TestInvokeMethod(const TestInvokeMetho
 
 TestInvokeMethodOutcomeCallable APIGatewayClient::TestInvokeMethodCallable(const TestInvokeMethodRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TestInvokeMethod(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TestInvokeMethod(request); } );
 }
 
 void APIGatewayClient::TestInvokeMethodAsync(const TestInvokeMethodRequest& request, const TestInvokeMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2596,6 +3306,16 @@ void APIGatewayClient::TestInvokeMethodAsync(const TestInvokeMethodRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->TestInvokeMethodAsyncHelper( request, handler, context ); } );
 }
 
+TestInvokeMethodOutcomeCallable APIGatewayClient::TestInvokeMethodCallable(TestInvokeMethodRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::TestInvokeMethod, this, std::move(request)));
+}
+
+void APIGatewayClient::TestInvokeMethodAsync(TestInvokeMethodRequest&& request, const TestInvokeMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::TestInvokeMethodAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::TestInvokeMethodAsyncHelper(const TestInvokeMethodRequest& request, const TestInvokeMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TestInvokeMethod(request), context);
@@ -2619,7 +3339,7 @@ UpdateAccountOutcome APIGatewayClient::UpdateAccount(const UpdateAccountRequest&
 
 UpdateAccountOutcomeCallable APIGatewayClient::UpdateAccountCallable(const UpdateAccountRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateAccount(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateAccount(request); } );
 }
 
 void APIGatewayClient::UpdateAccountAsync(const UpdateAccountRequest& request, const UpdateAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2627,6 +3347,16 @@ void APIGatewayClient::UpdateAccountAsync(const UpdateAccountRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->UpdateAccountAsyncHelper( request, handler, context ); } );
 }
 
+UpdateAccountOutcomeCallable APIGatewayClient::UpdateAccountCallable(UpdateAccountRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateAccount, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateAccountAsync(UpdateAccountRequest&& request, const UpdateAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateAccountAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateAccountAsyncHelper(const UpdateAccountRequest& request, const UpdateAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateAccount(request), context);
@@ -2651,7 +3381,7 @@ UpdateApiKeyOutcome APIGatewayClient::UpdateApiKey(const UpdateApiKeyRequest& re
 
 UpdateApiKeyOutcomeCallable APIGatewayClient::UpdateApiKeyCallable(const UpdateApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateApiKey(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateApiKey(request); } );
 }
 
 void APIGatewayClient::UpdateApiKeyAsync(const UpdateApiKeyRequest& request, const UpdateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2659,6 +3389,16 @@ void APIGatewayClient::UpdateApiKeyAsync(const UpdateApiKeyRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->UpdateApiKeyAsyncHelper( request, handler, context ); } );
 }
 
+UpdateApiKeyOutcomeCallable APIGatewayClient::UpdateApiKeyCallable(UpdateApiKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateApiKey, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateApiKeyAsync(UpdateApiKeyRequest&& request, const UpdateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateApiKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateApiKeyAsyncHelper(const UpdateApiKeyRequest& request, const UpdateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateApiKey(request), context);
@@ -2685,7 +3425,7 @@ UpdateAuthorizerOutcome APIGatewayClient::UpdateAuthorizer(const UpdateAuthorize
 
 UpdateAuthorizerOutcomeCallable APIGatewayClient::UpdateAuthorizerCallable(const UpdateAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateAuthorizer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateAuthorizer(request); } );
 }
 
 void APIGatewayClient::UpdateAuthorizerAsync(const UpdateAuthorizerRequest& request, const UpdateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2693,6 +3433,16 @@ void APIGatewayClient::UpdateAuthorizerAsync(const UpdateAuthorizerRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->UpdateAuthorizerAsyncHelper( request, handler, context ); } );
 }
 
+UpdateAuthorizerOutcomeCallable APIGatewayClient::UpdateAuthorizerCallable(UpdateAuthorizerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateAuthorizer, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateAuthorizerAsync(UpdateAuthorizerRequest&& request, const UpdateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateAuthorizerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateAuthorizerAsyncHelper(const UpdateAuthorizerRequest& request, const UpdateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateAuthorizer(request), context);
@@ -2719,7 +3469,7 @@ UpdateBasePathMappingOutcome APIGatewayClient::UpdateBasePathMapping(const Updat
 
 UpdateBasePathMappingOutcomeCallable APIGatewayClient::UpdateBasePathMappingCallable(const UpdateBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateBasePathMapping(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateBasePathMapping(request); } );
 }
 
 void APIGatewayClient::UpdateBasePathMappingAsync(const UpdateBasePathMappingRequest& request, const UpdateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2727,6 +3477,16 @@ void APIGatewayClient::UpdateBasePathMappingAsync(const UpdateBasePathMappingReq
   m_executor->Submit( [this, request, handler, context](){ this->UpdateBasePathMappingAsyncHelper( request, handler, context ); } );
 }
 
+UpdateBasePathMappingOutcomeCallable APIGatewayClient::UpdateBasePathMappingCallable(UpdateBasePathMappingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateBasePathMapping, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateBasePathMappingAsync(UpdateBasePathMappingRequest&& request, const UpdateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateBasePathMappingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateBasePathMappingAsyncHelper(const UpdateBasePathMappingRequest& request, const UpdateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateBasePathMapping(request), context);
@@ -2751,7 +3511,7 @@ UpdateClientCertificateOutcome APIGatewayClient::UpdateClientCertificate(const U
 
 UpdateClientCertificateOutcomeCallable APIGatewayClient::UpdateClientCertificateCallable(const UpdateClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateClientCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateClientCertificate(request); } );
 }
 
 void APIGatewayClient::UpdateClientCertificateAsync(const UpdateClientCertificateRequest& request, const UpdateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2759,6 +3519,16 @@ void APIGatewayClient::UpdateClientCertificateAsync(const UpdateClientCertificat
   m_executor->Submit( [this, request, handler, context](){ this->UpdateClientCertificateAsyncHelper( request, handler, context ); } );
 }
 
+UpdateClientCertificateOutcomeCallable APIGatewayClient::UpdateClientCertificateCallable(UpdateClientCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateClientCertificate, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateClientCertificateAsync(UpdateClientCertificateRequest&& request, const UpdateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateClientCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateClientCertificateAsyncHelper(const UpdateClientCertificateRequest& request, const UpdateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateClientCertificate(request), context);
@@ -2785,7 +3555,7 @@ UpdateDeploymentOutcome APIGatewayClient::UpdateDeployment(const UpdateDeploymen
 
 UpdateDeploymentOutcomeCallable APIGatewayClient::UpdateDeploymentCallable(const UpdateDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateDeployment(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateDeployment(request); } );
 }
 
 void APIGatewayClient::UpdateDeploymentAsync(const UpdateDeploymentRequest& request, const UpdateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2793,6 +3563,16 @@ void APIGatewayClient::UpdateDeploymentAsync(const UpdateDeploymentRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->UpdateDeploymentAsyncHelper( request, handler, context ); } );
 }
 
+UpdateDeploymentOutcomeCallable APIGatewayClient::UpdateDeploymentCallable(UpdateDeploymentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateDeployment, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateDeploymentAsync(UpdateDeploymentRequest&& request, const UpdateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateDeploymentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateDeploymentAsyncHelper(const UpdateDeploymentRequest& request, const UpdateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateDeployment(request), context);
@@ -2817,7 +3597,7 @@ UpdateDomainNameOutcome APIGatewayClient::UpdateDomainName(const UpdateDomainNam
 
 UpdateDomainNameOutcomeCallable APIGatewayClient::UpdateDomainNameCallable(const UpdateDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateDomainName(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateDomainName(request); } );
 }
 
 void APIGatewayClient::UpdateDomainNameAsync(const UpdateDomainNameRequest& request, const UpdateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2825,6 +3605,16 @@ void APIGatewayClient::UpdateDomainNameAsync(const UpdateDomainNameRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->UpdateDomainNameAsyncHelper( request, handler, context ); } );
 }
 
+UpdateDomainNameOutcomeCallable APIGatewayClient::UpdateDomainNameCallable(UpdateDomainNameRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateDomainName, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateDomainNameAsync(UpdateDomainNameRequest&& request, const UpdateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateDomainNameAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateDomainNameAsyncHelper(const UpdateDomainNameRequest& request, const UpdateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateDomainName(request), context);
@@ -2854,7 +3644,7 @@ UpdateIntegrationOutcome APIGatewayClient::UpdateIntegration(const UpdateIntegra
 
 UpdateIntegrationOutcomeCallable APIGatewayClient::UpdateIntegrationCallable(const UpdateIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateIntegration(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateIntegration(request); } );
 }
 
 void APIGatewayClient::UpdateIntegrationAsync(const UpdateIntegrationRequest& request, const UpdateIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2862,6 +3652,16 @@ void APIGatewayClient::UpdateIntegrationAsync(const UpdateIntegrationRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->UpdateIntegrationAsyncHelper( request, handler, context ); } );
 }
 
+UpdateIntegrationOutcomeCallable APIGatewayClient::UpdateIntegrationCallable(UpdateIntegrationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateIntegration, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateIntegrationAsync(UpdateIntegrationRequest&& request, const UpdateIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateIntegrationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateIntegrationAsyncHelper(const UpdateIntegrationRequest& request, const UpdateIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateIntegration(request), context);
@@ -2892,7 +3692,7 @@ UpdateIntegrationResponseOutcome APIGatewayClient::UpdateIntegrationResponse(con
 
 UpdateIntegrationResponseOutcomeCallable APIGatewayClient::UpdateIntegrationResponseCallable(const UpdateIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateIntegrationResponse(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateIntegrationResponse(request); } );
 }
 
 void APIGatewayClient::UpdateIntegrationResponseAsync(const UpdateIntegrationResponseRequest& request, const UpdateIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2900,6 +3700,16 @@ void APIGatewayClient::UpdateIntegrationResponseAsync(const UpdateIntegrationRes
   m_executor->Submit( [this, request, handler, context](){ this->UpdateIntegrationResponseAsyncHelper( request, handler, context ); } );
 }
 
+UpdateIntegrationResponseOutcomeCallable APIGatewayClient::UpdateIntegrationResponseCallable(UpdateIntegrationResponseRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateIntegrationResponse, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateIntegrationResponseAsync(UpdateIntegrationResponseRequest&& request, const UpdateIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateIntegrationResponseAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateIntegrationResponseAsyncHelper(const UpdateIntegrationResponseRequest& request, const UpdateIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateIntegrationResponse(request), context);
@@ -2928,7 +3738,7 @@ UpdateMethodOutcome APIGatewayClient::UpdateMethod(const UpdateMethodRequest& re
 
 UpdateMethodOutcomeCallable APIGatewayClient::UpdateMethodCallable(const UpdateMethodRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateMethod(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateMethod(request); } );
 }
 
 void APIGatewayClient::UpdateMethodAsync(const UpdateMethodRequest& request, const UpdateMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2936,6 +3746,16 @@ void APIGatewayClient::UpdateMethodAsync(const UpdateMethodRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->UpdateMethodAsyncHelper( request, handler, context ); } );
 }
 
+UpdateMethodOutcomeCallable APIGatewayClient::UpdateMethodCallable(UpdateMethodRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateMethod, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateMethodAsync(UpdateMethodRequest&& request, const UpdateMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateMethodAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateMethodAsyncHelper(const UpdateMethodRequest& request, const UpdateMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateMethod(request), context);
@@ -2966,7 +3786,7 @@ UpdateMethodResponseOutcome APIGatewayClient::UpdateMethodResponse(const UpdateM
 
 UpdateMethodResponseOutcomeCallable APIGatewayClient::UpdateMethodResponseCallable(const UpdateMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateMethodResponse(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateMethodResponse(request); } );
 }
 
 void APIGatewayClient::UpdateMethodResponseAsync(const UpdateMethodResponseRequest& request, const UpdateMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2974,6 +3794,16 @@ void APIGatewayClient::UpdateMethodResponseAsync(const UpdateMethodResponseReque
   m_executor->Submit( [this, request, handler, context](){ this->UpdateMethodResponseAsyncHelper( request, handler, context ); } );
 }
 
+UpdateMethodResponseOutcomeCallable APIGatewayClient::UpdateMethodResponseCallable(UpdateMethodResponseRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateMethodResponse, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateMethodResponseAsync(UpdateMethodResponseRequest&& request, const UpdateMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateMethodResponseAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateMethodResponseAsyncHelper(const UpdateMethodResponseRequest& request, const UpdateMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateMethodResponse(request), context);
@@ -3000,7 +3830,7 @@ UpdateModelOutcome APIGatewayClient::UpdateModel(const UpdateModelRequest& reque
 
 UpdateModelOutcomeCallable APIGatewayClient::UpdateModelCallable(const UpdateModelRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateModel(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateModel(request); } );
 }
 
 void APIGatewayClient::UpdateModelAsync(const UpdateModelRequest& request, const UpdateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3008,6 +3838,16 @@ void APIGatewayClient::UpdateModelAsync(const UpdateModelRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->UpdateModelAsyncHelper( request, handler, context ); } );
 }
 
+UpdateModelOutcomeCallable APIGatewayClient::UpdateModelCallable(UpdateModelRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateModel, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateModelAsync(UpdateModelRequest&& request, const UpdateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateModelAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateModelAsyncHelper(const UpdateModelRequest& request, const UpdateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateModel(request), context);
@@ -3034,7 +3874,7 @@ UpdateResourceOutcome APIGatewayClient::UpdateResource(const UpdateResourceReque
 
 UpdateResourceOutcomeCallable APIGatewayClient::UpdateResourceCallable(const UpdateResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateResource(request); } );
 }
 
 void APIGatewayClient::UpdateResourceAsync(const UpdateResourceRequest& request, const UpdateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3042,6 +3882,16 @@ void APIGatewayClient::UpdateResourceAsync(const UpdateResourceRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->UpdateResourceAsyncHelper( request, handler, context ); } );
 }
 
+UpdateResourceOutcomeCallable APIGatewayClient::UpdateResourceCallable(UpdateResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateResource, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateResourceAsync(UpdateResourceRequest&& request, const UpdateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateResourceAsyncHelper(const UpdateResourceRequest& request, const UpdateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateResource(request), context);
@@ -3066,7 +3916,7 @@ UpdateRestApiOutcome APIGatewayClient::UpdateRestApi(const UpdateRestApiRequest&
 
 UpdateRestApiOutcomeCallable APIGatewayClient::UpdateRestApiCallable(const UpdateRestApiRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateRestApi(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateRestApi(request); } );
 }
 
 void APIGatewayClient::UpdateRestApiAsync(const UpdateRestApiRequest& request, const UpdateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3074,6 +3924,16 @@ void APIGatewayClient::UpdateRestApiAsync(const UpdateRestApiRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->UpdateRestApiAsyncHelper( request, handler, context ); } );
 }
 
+UpdateRestApiOutcomeCallable APIGatewayClient::UpdateRestApiCallable(UpdateRestApiRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateRestApi, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateRestApiAsync(UpdateRestApiRequest&& request, const UpdateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateRestApiAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateRestApiAsyncHelper(const UpdateRestApiRequest& request, const UpdateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateRestApi(request), context);
@@ -3100,7 +3960,7 @@ UpdateStageOutcome APIGatewayClient::UpdateStage(const UpdateStageRequest& reque
 
 UpdateStageOutcomeCallable APIGatewayClient::UpdateStageCallable(const UpdateStageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateStage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateStage(request); } );
 }
 
 void APIGatewayClient::UpdateStageAsync(const UpdateStageRequest& request, const UpdateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3108,6 +3968,16 @@ void APIGatewayClient::UpdateStageAsync(const UpdateStageRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->UpdateStageAsyncHelper( request, handler, context ); } );
 }
 
+UpdateStageOutcomeCallable APIGatewayClient::UpdateStageCallable(UpdateStageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateStage, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateStageAsync(UpdateStageRequest&& request, const UpdateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateStageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateStageAsyncHelper(const UpdateStageRequest& request, const UpdateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateStage(request), context);
@@ -3135,7 +4005,7 @@ UpdateUsageOutcome APIGatewayClient::UpdateUsage(const UpdateUsageRequest& reque
 
 UpdateUsageOutcomeCallable APIGatewayClient::UpdateUsageCallable(const UpdateUsageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateUsage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateUsage(request); } );
 }
 
 void APIGatewayClient::UpdateUsageAsync(const UpdateUsageRequest& request, const UpdateUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3143,6 +4013,16 @@ void APIGatewayClient::UpdateUsageAsync(const UpdateUsageRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->UpdateUsageAsyncHelper( request, handler, context ); } );
 }
 
+UpdateUsageOutcomeCallable APIGatewayClient::UpdateUsageCallable(UpdateUsageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateUsage, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateUsageAsync(UpdateUsageRequest&& request, const UpdateUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateUsageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateUsageAsyncHelper(const UpdateUsageRequest& request, const UpdateUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateUsage(request), context);
@@ -3167,7 +4047,7 @@ UpdateUsagePlanOutcome APIGatewayClient::UpdateUsagePlan(const UpdateUsagePlanRe
 
 UpdateUsagePlanOutcomeCallable APIGatewayClient::UpdateUsagePlanCallable(const UpdateUsagePlanRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateUsagePlan(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateUsagePlan(request); } );
 }
 
 void APIGatewayClient::UpdateUsagePlanAsync(const UpdateUsagePlanRequest& request, const UpdateUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3175,8 +4055,669 @@ void APIGatewayClient::UpdateUsagePlanAsync(const UpdateUsagePlanRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->UpdateUsagePlanAsyncHelper( request, handler, context ); } );
 }
 
+UpdateUsagePlanOutcomeCallable APIGatewayClient::UpdateUsagePlanCallable(UpdateUsagePlanRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&APIGatewayClient::UpdateUsagePlan, this, std::move(request)));
+}
+
+void APIGatewayClient::UpdateUsagePlanAsync(UpdateUsagePlanRequest&& request, const UpdateUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&APIGatewayClient::UpdateUsagePlanAsyncHelper, this, std::move(request), handler, context);
+}
+
 void APIGatewayClient::UpdateUsagePlanAsyncHelper(const UpdateUsagePlanRequest& request, const UpdateUsagePlanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateUsagePlan(request), context);
 }
 
+Paginator<APIGatewayClient, GetApiKeysRequest, GetApiKeysOutcome> APIGatewayClient::GetApiKeysPaginator(const GetApiKeysRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<APIGatewayClient, GetApiKeysRequest, GetApiKeysOutcome>(this, &APIGatewayClient::GetApiKeys, request,
+    [](const GetApiKeysRequest& current, const GetApiKeysOutcome& outcome, GetApiKeysRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetPosition();
+      if(token.empty() || token == current.GetPosition())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPosition(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<APIGatewayClient, GetAuthorizersRequest, GetAuthorizersOutcome> APIGatewayClient::GetAuthorizersPaginator(const GetAuthorizersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<APIGatewayClient, GetAuthorizersRequest, GetAuthorizersOutcome>(this, &APIGatewayClient::GetAuthorizers, request,
+    [](const GetAuthorizersRequest& current, const GetAuthorizersOutcome& outcome, GetAuthorizersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetPosition();
+      if(token.empty() || token == current.GetPosition())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPosition(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<APIGatewayClient, GetBasePathMappingsRequest, GetBasePathMappingsOutcome> APIGatewayClient::GetBasePathMappingsPaginator(const GetBasePathMappingsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<APIGatewayClient, GetBasePathMappingsRequest, GetBasePathMappingsOutcome>(this, &APIGatewayClient::GetBasePathMappings, request,
+    [](const GetBasePathMappingsRequest& current, const GetBasePathMappingsOutcome& outcome, GetBasePathMappingsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetPosition();
+      if(token.empty() || token == current.GetPosition())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPosition(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<APIGatewayClient, GetClientCertificatesRequest, GetClientCertificatesOutcome> APIGatewayClient::GetClientCertificatesPaginator(const GetClientCertificatesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<APIGatewayClient, GetClientCertificatesRequest, GetClientCertificatesOutcome>(this, &APIGatewayClient::GetClientCertificates, request,
+    [](const GetClientCertificatesRequest& current, const GetClientCertificatesOutcome& outcome, GetClientCertificatesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetPosition();
+      if(token.empty() || token == current.GetPosition())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPosition(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<APIGatewayClient, GetDeploymentsRequest, GetDeploymentsOutcome> APIGatewayClient::GetDeploymentsPaginator(const GetDeploymentsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<APIGatewayClient, GetDeploymentsRequest, GetDeploymentsOutcome>(this, &APIGatewayClient::GetDeployments, request,
+    [](const GetDeploymentsRequest& current, const GetDeploymentsOutcome& outcome, GetDeploymentsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetPosition();
+      if(token.empty() || token == current.GetPosition())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPosition(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<APIGatewayClient, GetDomainNamesRequest, GetDomainNamesOutcome> APIGatewayClient::GetDomainNamesPaginator(const GetDomainNamesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<APIGatewayClient, GetDomainNamesRequest, GetDomainNamesOutcome>(this, &APIGatewayClient::GetDomainNames, request,
+    [](const GetDomainNamesRequest& current, const GetDomainNamesOutcome& outcome, GetDomainNamesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetPosition();
+      if(token.empty() || token == current.GetPosition())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPosition(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<APIGatewayClient, GetModelsRequest, GetModelsOutcome> APIGatewayClient::GetModelsPaginator(const GetModelsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<APIGatewayClient, GetModelsRequest, GetModelsOutcome>(this, &APIGatewayClient::GetModels, request,
+    [](const GetModelsRequest& current, const GetModelsOutcome& outcome, GetModelsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetPosition();
+      if(token.empty() || token == current.GetPosition())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPosition(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<APIGatewayClient, GetResourcesRequest, GetResourcesOutcome> APIGatewayClient::GetResourcesPaginator(const GetResourcesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<APIGatewayClient, GetResourcesRequest, GetResourcesOutcome>(this, &APIGatewayClient::GetResources, request,
+    [](const GetResourcesRequest& current, const GetResourcesOutcome& outcome, GetResourcesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetPosition();
+      if(token.empty() || token == current.GetPosition())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPosition(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<APIGatewayClient, GetRestApisRequest, GetRestApisOutcome> APIGatewayClient::GetRestApisPaginator(const GetRestApisRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<APIGatewayClient, GetRestApisRequest, GetRestApisOutcome>(this, &APIGatewayClient::GetRestApis, request,
+    [](const GetRestApisRequest& current, const GetRestApisOutcome& outcome, GetRestApisRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetPosition();
+      if(token.empty() || token == current.GetPosition())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPosition(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<APIGatewayClient, GetUsageRequest, GetUsageOutcome> APIGatewayClient::GetUsagePaginator(const GetUsageRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<APIGatewayClient, GetUsageRequest, GetUsageOutcome>(this, &APIGatewayClient::GetUsage, request,
+    [](const GetUsageRequest& current, const GetUsageOutcome& outcome, GetUsageRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetPosition();
+      if(token.empty() || token == current.GetPosition())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPosition(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<APIGatewayClient, GetUsagePlanKeysRequest, GetUsagePlanKeysOutcome> APIGatewayClient::GetUsagePlanKeysPaginator(const GetUsagePlanKeysRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<APIGatewayClient, GetUsagePlanKeysRequest, GetUsagePlanKeysOutcome>(this, &APIGatewayClient::GetUsagePlanKeys, request,
+    [](const GetUsagePlanKeysRequest& current, const GetUsagePlanKeysOutcome& outcome, GetUsagePlanKeysRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetPosition();
+      if(token.empty() || token == current.GetPosition())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPosition(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<APIGatewayClient, GetUsagePlansRequest, GetUsagePlansOutcome> APIGatewayClient::GetUsagePlansPaginator(const GetUsagePlansRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<APIGatewayClient, GetUsagePlansRequest, GetUsagePlansOutcome>(this, &APIGatewayClient::GetUsagePlans, request,
+    [](const GetUsagePlansRequest& current, const GetUsagePlansOutcome& outcome, GetUsagePlansRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetPosition();
+      if(token.empty() || token == current.GetPosition())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPosition(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<APIGatewayClient, CreateApiKeyRequest, CreateApiKeyOutcome> APIGatewayClient::CreateApiKeyAwaitable(CreateApiKeyRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::CreateApiKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, CreateAuthorizerRequest, CreateAuthorizerOutcome> APIGatewayClient::CreateAuthorizerAwaitable(CreateAuthorizerRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::CreateAuthorizer, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, CreateBasePathMappingRequest, CreateBasePathMappingOutcome> APIGatewayClient::CreateBasePathMappingAwaitable(CreateBasePathMappingRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::CreateBasePathMapping, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, CreateDeploymentRequest, CreateDeploymentOutcome> APIGatewayClient::CreateDeploymentAwaitable(CreateDeploymentRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::CreateDeployment, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, CreateDomainNameRequest, CreateDomainNameOutcome> APIGatewayClient::CreateDomainNameAwaitable(CreateDomainNameRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::CreateDomainName, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, CreateModelRequest, CreateModelOutcome> APIGatewayClient::CreateModelAwaitable(CreateModelRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::CreateModel, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, CreateResourceRequest, CreateResourceOutcome> APIGatewayClient::CreateResourceAwaitable(CreateResourceRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::CreateResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, CreateRestApiRequest, CreateRestApiOutcome> APIGatewayClient::CreateRestApiAwaitable(CreateRestApiRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::CreateRestApi, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, CreateStageRequest, CreateStageOutcome> APIGatewayClient::CreateStageAwaitable(CreateStageRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::CreateStage, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, CreateUsagePlanRequest, CreateUsagePlanOutcome> APIGatewayClient::CreateUsagePlanAwaitable(CreateUsagePlanRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::CreateUsagePlan, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, CreateUsagePlanKeyRequest, CreateUsagePlanKeyOutcome> APIGatewayClient::CreateUsagePlanKeyAwaitable(CreateUsagePlanKeyRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::CreateUsagePlanKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteApiKeyRequest, DeleteApiKeyOutcome> APIGatewayClient::DeleteApiKeyAwaitable(DeleteApiKeyRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteApiKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteAuthorizerRequest, DeleteAuthorizerOutcome> APIGatewayClient::DeleteAuthorizerAwaitable(DeleteAuthorizerRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteAuthorizer, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteBasePathMappingRequest, DeleteBasePathMappingOutcome> APIGatewayClient::DeleteBasePathMappingAwaitable(DeleteBasePathMappingRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteBasePathMapping, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteClientCertificateRequest, DeleteClientCertificateOutcome> APIGatewayClient::DeleteClientCertificateAwaitable(DeleteClientCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteClientCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteDeploymentRequest, DeleteDeploymentOutcome> APIGatewayClient::DeleteDeploymentAwaitable(DeleteDeploymentRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteDeployment, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteDomainNameRequest, DeleteDomainNameOutcome> APIGatewayClient::DeleteDomainNameAwaitable(DeleteDomainNameRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteDomainName, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteIntegrationRequest, DeleteIntegrationOutcome> APIGatewayClient::DeleteIntegrationAwaitable(DeleteIntegrationRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteIntegration, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteIntegrationResponseRequest, DeleteIntegrationResponseOutcome> APIGatewayClient::DeleteIntegrationResponseAwaitable(DeleteIntegrationResponseRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteIntegrationResponse, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteMethodRequest, DeleteMethodOutcome> APIGatewayClient::DeleteMethodAwaitable(DeleteMethodRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteMethod, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteMethodResponseRequest, DeleteMethodResponseOutcome> APIGatewayClient::DeleteMethodResponseAwaitable(DeleteMethodResponseRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteMethodResponse, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteModelRequest, DeleteModelOutcome> APIGatewayClient::DeleteModelAwaitable(DeleteModelRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteModel, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteResourceRequest, DeleteResourceOutcome> APIGatewayClient::DeleteResourceAwaitable(DeleteResourceRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteRestApiRequest, DeleteRestApiOutcome> APIGatewayClient::DeleteRestApiAwaitable(DeleteRestApiRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteRestApi, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteStageRequest, DeleteStageOutcome> APIGatewayClient::DeleteStageAwaitable(DeleteStageRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteStage, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteUsagePlanRequest, DeleteUsagePlanOutcome> APIGatewayClient::DeleteUsagePlanAwaitable(DeleteUsagePlanRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteUsagePlan, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, DeleteUsagePlanKeyRequest, DeleteUsagePlanKeyOutcome> APIGatewayClient::DeleteUsagePlanKeyAwaitable(DeleteUsagePlanKeyRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::DeleteUsagePlanKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, FlushStageAuthorizersCacheRequest, FlushStageAuthorizersCacheOutcome> APIGatewayClient::FlushStageAuthorizersCacheAwaitable(FlushStageAuthorizersCacheRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::FlushStageAuthorizersCache, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, FlushStageCacheRequest, FlushStageCacheOutcome> APIGatewayClient::FlushStageCacheAwaitable(FlushStageCacheRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::FlushStageCache, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GenerateClientCertificateRequest, GenerateClientCertificateOutcome> APIGatewayClient::GenerateClientCertificateAwaitable(GenerateClientCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GenerateClientCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetAccountRequest, GetAccountOutcome> APIGatewayClient::GetAccountAwaitable(GetAccountRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetAccount, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetApiKeyRequest, GetApiKeyOutcome> APIGatewayClient::GetApiKeyAwaitable(GetApiKeyRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetApiKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetApiKeysRequest, GetApiKeysOutcome> APIGatewayClient::GetApiKeysAwaitable(GetApiKeysRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetApiKeys, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetAuthorizerRequest, GetAuthorizerOutcome> APIGatewayClient::GetAuthorizerAwaitable(GetAuthorizerRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetAuthorizer, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetAuthorizersRequest, GetAuthorizersOutcome> APIGatewayClient::GetAuthorizersAwaitable(GetAuthorizersRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetAuthorizers, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetBasePathMappingRequest, GetBasePathMappingOutcome> APIGatewayClient::GetBasePathMappingAwaitable(GetBasePathMappingRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetBasePathMapping, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetBasePathMappingsRequest, GetBasePathMappingsOutcome> APIGatewayClient::GetBasePathMappingsAwaitable(GetBasePathMappingsRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetBasePathMappings, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetClientCertificateRequest, GetClientCertificateOutcome> APIGatewayClient::GetClientCertificateAwaitable(GetClientCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetClientCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetClientCertificatesRequest, GetClientCertificatesOutcome> APIGatewayClient::GetClientCertificatesAwaitable(GetClientCertificatesRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetClientCertificates, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetDeploymentRequest, GetDeploymentOutcome> APIGatewayClient::GetDeploymentAwaitable(GetDeploymentRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetDeployment, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetDeploymentsRequest, GetDeploymentsOutcome> APIGatewayClient::GetDeploymentsAwaitable(GetDeploymentsRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetDeployments, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetDomainNameRequest, GetDomainNameOutcome> APIGatewayClient::GetDomainNameAwaitable(GetDomainNameRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetDomainName, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetDomainNamesRequest, GetDomainNamesOutcome> APIGatewayClient::GetDomainNamesAwaitable(GetDomainNamesRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetDomainNames, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetExportRequest, GetExportOutcome> APIGatewayClient::GetExportAwaitable(GetExportRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetExport, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetIntegrationRequest, GetIntegrationOutcome> APIGatewayClient::GetIntegrationAwaitable(GetIntegrationRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetIntegration, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetIntegrationResponseRequest, GetIntegrationResponseOutcome> APIGatewayClient::GetIntegrationResponseAwaitable(GetIntegrationResponseRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetIntegrationResponse, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetMethodRequest, GetMethodOutcome> APIGatewayClient::GetMethodAwaitable(GetMethodRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetMethod, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetMethodResponseRequest, GetMethodResponseOutcome> APIGatewayClient::GetMethodResponseAwaitable(GetMethodResponseRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetMethodResponse, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetModelRequest, GetModelOutcome> APIGatewayClient::GetModelAwaitable(GetModelRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetModel, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetModelTemplateRequest, GetModelTemplateOutcome> APIGatewayClient::GetModelTemplateAwaitable(GetModelTemplateRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetModelTemplate, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetModelsRequest, GetModelsOutcome> APIGatewayClient::GetModelsAwaitable(GetModelsRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetModels, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetResourceRequest, GetResourceOutcome> APIGatewayClient::GetResourceAwaitable(GetResourceRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetResourcesRequest, GetResourcesOutcome> APIGatewayClient::GetResourcesAwaitable(GetResourcesRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetResources, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetRestApiRequest, GetRestApiOutcome> APIGatewayClient::GetRestApiAwaitable(GetRestApiRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetRestApi, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetRestApisRequest, GetRestApisOutcome> APIGatewayClient::GetRestApisAwaitable(GetRestApisRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetRestApis, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetSdkRequest, GetSdkOutcome> APIGatewayClient::GetSdkAwaitable(GetSdkRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetSdk, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetStageRequest, GetStageOutcome> APIGatewayClient::GetStageAwaitable(GetStageRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetStage, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetStagesRequest, GetStagesOutcome> APIGatewayClient::GetStagesAwaitable(GetStagesRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetStages, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetUsageRequest, GetUsageOutcome> APIGatewayClient::GetUsageAwaitable(GetUsageRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetUsage, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetUsagePlanRequest, GetUsagePlanOutcome> APIGatewayClient::GetUsagePlanAwaitable(GetUsagePlanRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetUsagePlan, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetUsagePlanKeyRequest, GetUsagePlanKeyOutcome> APIGatewayClient::GetUsagePlanKeyAwaitable(GetUsagePlanKeyRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetUsagePlanKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetUsagePlanKeysRequest, GetUsagePlanKeysOutcome> APIGatewayClient::GetUsagePlanKeysAwaitable(GetUsagePlanKeysRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetUsagePlanKeys, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, GetUsagePlansRequest, GetUsagePlansOutcome> APIGatewayClient::GetUsagePlansAwaitable(GetUsagePlansRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::GetUsagePlans, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, ImportApiKeysRequest, ImportApiKeysOutcome> APIGatewayClient::ImportApiKeysAwaitable(ImportApiKeysRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::ImportApiKeys, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, ImportRestApiRequest, ImportRestApiOutcome> APIGatewayClient::ImportRestApiAwaitable(ImportRestApiRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::ImportRestApi, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, PutIntegrationRequest, PutIntegrationOutcome> APIGatewayClient::PutIntegrationAwaitable(PutIntegrationRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::PutIntegration, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, PutIntegrationResponseRequest, PutIntegrationResponseOutcome> APIGatewayClient::PutIntegrationResponseAwaitable(PutIntegrationResponseRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::PutIntegrationResponse, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, PutMethodRequest, PutMethodOutcome> APIGatewayClient::PutMethodAwaitable(PutMethodRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::PutMethod, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, PutMethodResponseRequest, PutMethodResponseOutcome> APIGatewayClient::PutMethodResponseAwaitable(PutMethodResponseRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::PutMethodResponse, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, PutRestApiRequest, PutRestApiOutcome> APIGatewayClient::PutRestApiAwaitable(PutRestApiRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::PutRestApi, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, TestInvokeAuthorizerRequest, TestInvokeAuthorizerOutcome> APIGatewayClient::TestInvokeAuthorizerAwaitable(TestInvokeAuthorizerRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::TestInvokeAuthorizer, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, TestInvokeMethodRequest, TestInvokeMethodOutcome> APIGatewayClient::TestInvokeMethodAwaitable(TestInvokeMethodRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::TestInvokeMethod, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateAccountRequest, UpdateAccountOutcome> APIGatewayClient::UpdateAccountAwaitable(UpdateAccountRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateAccount, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateApiKeyRequest, UpdateApiKeyOutcome> APIGatewayClient::UpdateApiKeyAwaitable(UpdateApiKeyRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateApiKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateAuthorizerRequest, UpdateAuthorizerOutcome> APIGatewayClient::UpdateAuthorizerAwaitable(UpdateAuthorizerRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateAuthorizer, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateBasePathMappingRequest, UpdateBasePathMappingOutcome> APIGatewayClient::UpdateBasePathMappingAwaitable(UpdateBasePathMappingRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateBasePathMapping, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateClientCertificateRequest, UpdateClientCertificateOutcome> APIGatewayClient::UpdateClientCertificateAwaitable(UpdateClientCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateClientCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateDeploymentRequest, UpdateDeploymentOutcome> APIGatewayClient::UpdateDeploymentAwaitable(UpdateDeploymentRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateDeployment, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateDomainNameRequest, UpdateDomainNameOutcome> APIGatewayClient::UpdateDomainNameAwaitable(UpdateDomainNameRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateDomainName, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateIntegrationRequest, UpdateIntegrationOutcome> APIGatewayClient::UpdateIntegrationAwaitable(UpdateIntegrationRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateIntegration, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateIntegrationResponseRequest, UpdateIntegrationResponseOutcome> APIGatewayClient::UpdateIntegrationResponseAwaitable(UpdateIntegrationResponseRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateIntegrationResponse, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateMethodRequest, UpdateMethodOutcome> APIGatewayClient::UpdateMethodAwaitable(UpdateMethodRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateMethod, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateMethodResponseRequest, UpdateMethodResponseOutcome> APIGatewayClient::UpdateMethodResponseAwaitable(UpdateMethodResponseRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateMethodResponse, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateModelRequest, UpdateModelOutcome> APIGatewayClient::UpdateModelAwaitable(UpdateModelRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateModel, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateResourceRequest, UpdateResourceOutcome> APIGatewayClient::UpdateResourceAwaitable(UpdateResourceRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateRestApiRequest, UpdateRestApiOutcome> APIGatewayClient::UpdateRestApiAwaitable(UpdateRestApiRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateRestApi, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateStageRequest, UpdateStageOutcome> APIGatewayClient::UpdateStageAwaitable(UpdateStageRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateStage, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateUsageRequest, UpdateUsageOutcome> APIGatewayClient::UpdateUsageAwaitable(UpdateUsageRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateUsage, std::move(request) } };
+}
+
+ClientOperationAwaitable<APIGatewayClient, UpdateUsagePlanRequest, UpdateUsagePlanOutcome> APIGatewayClient::UpdateUsagePlanAwaitable(UpdateUsagePlanRequest request) const
+{
+  return { m_executor.get(), { this, &APIGatewayClient::UpdateUsagePlan, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
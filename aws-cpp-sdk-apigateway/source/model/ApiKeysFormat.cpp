@@ -29,16 +29,26 @@ namespace Aws
       namespace ApiKeysFormatMapper
       {
 
-        static const int csv_HASH = HashingUtils::HashString("csv");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int csv_HASH = 98822;
 
 
         ApiKeysFormat GetApiKeysFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == csv_HASH)
+          switch (hashCode)
           {
+          case csv_HASH:
             return ApiKeysFormat::csv;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
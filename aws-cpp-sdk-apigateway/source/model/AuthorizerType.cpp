@@ -29,21 +29,29 @@ namespace Aws
       namespace AuthorizerTypeMapper
       {
 
-        static const int TOKEN_HASH = HashingUtils::HashString("TOKEN");
-        static const int COGNITO_USER_POOLS_HASH = HashingUtils::HashString("COGNITO_USER_POOLS");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int TOKEN_HASH = 80003545;
+        static const int COGNITO_USER_POOLS_HASH = 1501629937;
 
 
         AuthorizerType GetAuthorizerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TOKEN_HASH)
+          switch (hashCode)
           {
+          case TOKEN_HASH:
             return AuthorizerType::TOKEN;
-          }
-          else if (hashCode == COGNITO_USER_POOLS_HASH)
-          {
+          case COGNITO_USER_POOLS_HASH:
             return AuthorizerType::COGNITO_USER_POOLS;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,51 +29,47 @@ namespace Aws
       namespace CacheClusterSizeMapper
       {
 
-        static const int _0_5_HASH = HashingUtils::HashString("0.5");
-        static const int _1_6_HASH = HashingUtils::HashString("1.6");
-        static const int _6_1_HASH = HashingUtils::HashString("6.1");
-        static const int _13_5_HASH = HashingUtils::HashString("13.5");
-        static const int _28_4_HASH = HashingUtils::HashString("28.4");
-        static const int _58_2_HASH = HashingUtils::HashString("58.2");
-        static const int _118_HASH = HashingUtils::HashString("118");
-        static const int _237_HASH = HashingUtils::HashString("237");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int _0_5_HASH = 47607;
+        static const int _1_6_HASH = 48569;
+        static const int _6_1_HASH = 53369;
+        static const int _13_5_HASH = 1510249;
+        static const int _28_4_HASH = 1544844;
+        static const int _58_2_HASH = 1634215;
+        static const int _118_HASH = 48664;
+        static const int _237_HASH = 49686;
 
 
         CacheClusterSize GetCacheClusterSizeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == _0_5_HASH)
+          switch (hashCode)
           {
+          case _0_5_HASH:
             return CacheClusterSize::_0_5;
-          }
-          else if (hashCode == _1_6_HASH)
-          {
+          case _1_6_HASH:
             return CacheClusterSize::_1_6;
-          }
-          else if (hashCode == _6_1_HASH)
-          {
+          case _6_1_HASH:
             return CacheClusterSize::_6_1;
-          }
-          else if (hashCode == _13_5_HASH)
-          {
+          case _13_5_HASH:
             return CacheClusterSize::_13_5;
-          }
-          else if (hashCode == _28_4_HASH)
-          {
+          case _28_4_HASH:
             return CacheClusterSize::_28_4;
-          }
-          else if (hashCode == _58_2_HASH)
-          {
+          case _58_2_HASH:
             return CacheClusterSize::_58_2;
-          }
-          else if (hashCode == _118_HASH)
-          {
+          case _118_HASH:
             return CacheClusterSize::_118;
-          }
-          else if (hashCode == _237_HASH)
-          {
+          case _237_HASH:
             return CacheClusterSize::_237;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,36 +29,38 @@ namespace Aws
       namespace CacheClusterStatusMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int DELETE_IN_PROGRESS_HASH = HashingUtils::HashString("DELETE_IN_PROGRESS");
-        static const int NOT_AVAILABLE_HASH = HashingUtils::HashString("NOT_AVAILABLE");
-        static const int FLUSH_IN_PROGRESS_HASH = HashingUtils::HashString("FLUSH_IN_PROGRESS");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CREATE_IN_PROGRESS_HASH = 43560260;
+        static const int AVAILABLE_HASH = 2052692649;
+        static const int DELETE_IN_PROGRESS_HASH = 1089799027;
+        static const int NOT_AVAILABLE_HASH = 140722205;
+        static const int FLUSH_IN_PROGRESS_HASH = -499073236;
 
 
         CacheClusterStatus GetCacheClusterStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
+          switch (hashCode)
           {
+          case CREATE_IN_PROGRESS_HASH:
             return CacheClusterStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
+          case AVAILABLE_HASH:
             return CacheClusterStatus::AVAILABLE;
-          }
-          else if (hashCode == DELETE_IN_PROGRESS_HASH)
-          {
+          case DELETE_IN_PROGRESS_HASH:
             return CacheClusterStatus::DELETE_IN_PROGRESS;
-          }
-          else if (hashCode == NOT_AVAILABLE_HASH)
-          {
+          case NOT_AVAILABLE_HASH:
             return CacheClusterStatus::NOT_AVAILABLE;
-          }
-          else if (hashCode == FLUSH_IN_PROGRESS_HASH)
-          {
+          case FLUSH_IN_PROGRESS_HASH:
             return CacheClusterStatus::FLUSH_IN_PROGRESS;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace IntegrationTypeMapper
       {
 
-        static const int HTTP_HASH = HashingUtils::HashString("HTTP");
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
-        static const int MOCK_HASH = HashingUtils::HashString("MOCK");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int HTTP_HASH = 2228360;
+        static const int AWS_HASH = 65245;
+        static const int MOCK_HASH = 2371978;
 
 
         IntegrationType GetIntegrationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTTP_HASH)
+          switch (hashCode)
           {
+          case HTTP_HASH:
             return IntegrationType::HTTP;
-          }
-          else if (hashCode == AWS_HASH)
-          {
+          case AWS_HASH:
             return IntegrationType::AWS;
-          }
-          else if (hashCode == MOCK_HASH)
-          {
+          case MOCK_HASH:
             return IntegrationType::MOCK;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,41 +29,41 @@ namespace Aws
       namespace OpMapper
       {
 
-        static const int add_HASH = HashingUtils::HashString("add");
-        static const int remove_HASH = HashingUtils::HashString("remove");
-        static const int replace_HASH = HashingUtils::HashString("replace");
-        static const int move_HASH = HashingUtils::HashString("move");
-        static const int copy_HASH = HashingUtils::HashString("copy");
-        static const int test_HASH = HashingUtils::HashString("test");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int add_HASH = 96417;
+        static const int remove_HASH = -934610812;
+        static const int replace_HASH = 1094496948;
+        static const int move_HASH = 3357649;
+        static const int copy_HASH = 3059573;
+        static const int test_HASH = 3556498;
 
 
         Op GetOpForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == add_HASH)
+          switch (hashCode)
           {
+          case add_HASH:
             return Op::add;
-          }
-          else if (hashCode == remove_HASH)
-          {
+          case remove_HASH:
             return Op::remove;
-          }
-          else if (hashCode == replace_HASH)
-          {
+          case replace_HASH:
             return Op::replace;
-          }
-          else if (hashCode == move_HASH)
-          {
+          case move_HASH:
             return Op::move;
-          }
-          else if (hashCode == copy_HASH)
-          {
+          case copy_HASH:
             return Op::copy;
-          }
-          else if (hashCode == test_HASH)
-          {
+          case test_HASH:
             return Op::test;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
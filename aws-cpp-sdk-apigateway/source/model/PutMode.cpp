@@ -29,21 +29,29 @@ namespace Aws
       namespace PutModeMapper
       {
 
-        static const int merge_HASH = HashingUtils::HashString("merge");
-        static const int overwrite_HASH = HashingUtils::HashString("overwrite");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int merge_HASH = 103785528;
+        static const int overwrite_HASH = -745078901;
 
 
         PutMode GetPutModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == merge_HASH)
+          switch (hashCode)
           {
+          case merge_HASH:
             return PutMode::merge;
-          }
-          else if (hashCode == overwrite_HASH)
-          {
+          case overwrite_HASH:
             return PutMode::overwrite;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
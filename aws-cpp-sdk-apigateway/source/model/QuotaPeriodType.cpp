@@ -29,26 +29,32 @@ namespace Aws
       namespace QuotaPeriodTypeMapper
       {
 
-        static const int DAY_HASH = HashingUtils::HashString("DAY");
-        static const int WEEK_HASH = HashingUtils::HashString("WEEK");
-        static const int MONTH_HASH = HashingUtils::HashString("MONTH");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int DAY_HASH = 67452;
+        static const int WEEK_HASH = 2660340;
+        static const int MONTH_HASH = 73542240;
 
 
         QuotaPeriodType GetQuotaPeriodTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DAY_HASH)
+          switch (hashCode)
           {
+          case DAY_HASH:
             return QuotaPeriodType::DAY;
-          }
-          else if (hashCode == WEEK_HASH)
-          {
+          case WEEK_HASH:
             return QuotaPeriodType::WEEK;
-          }
-          else if (hashCode == MONTH_HASH)
-          {
+          case MONTH_HASH:
             return QuotaPeriodType::MONTH;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
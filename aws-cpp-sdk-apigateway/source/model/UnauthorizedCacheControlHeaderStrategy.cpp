@@ -29,26 +29,32 @@ namespace Aws
       namespace UnauthorizedCacheControlHeaderStrategyMapper
       {
 
-        static const int FAIL_WITH_403_HASH = HashingUtils::HashString("FAIL_WITH_403");
-        static const int SUCCEED_WITH_RESPONSE_HEADER_HASH = HashingUtils::HashString("SUCCEED_WITH_RESPONSE_HEADER");
-        static const int SUCCEED_WITHOUT_RESPONSE_HEADER_HASH = HashingUtils::HashString("SUCCEED_WITHOUT_RESPONSE_HEADER");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int FAIL_WITH_403_HASH = 587158079;
+        static const int SUCCEED_WITH_RESPONSE_HEADER_HASH = -1094860593;
+        static const int SUCCEED_WITHOUT_RESPONSE_HEADER_HASH = 653283223;
 
 
         UnauthorizedCacheControlHeaderStrategy GetUnauthorizedCacheControlHeaderStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FAIL_WITH_403_HASH)
+          switch (hashCode)
           {
+          case FAIL_WITH_403_HASH:
             return UnauthorizedCacheControlHeaderStrategy::FAIL_WITH_403;
-          }
-          else if (hashCode == SUCCEED_WITH_RESPONSE_HEADER_HASH)
-          {
+          case SUCCEED_WITH_RESPONSE_HEADER_HASH:
             return UnauthorizedCacheControlHeaderStrategy::SUCCEED_WITH_RESPONSE_HEADER;
-          }
-          else if (hashCode == SUCCEED_WITHOUT_RESPONSE_HEADER_HASH)
-          {
+          case SUCCEED_WITHOUT_RESPONSE_HEADER_HASH:
             return UnauthorizedCacheControlHeaderStrategy::SUCCEED_WITHOUT_RESPONSE_HEADER;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -28,6 +28,9 @@
 #include <aws/application-autoscaling/model/PutScalingPolicyResult.h>
 #include <aws/application-autoscaling/model/RegisterScalableTargetResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -184,6 +187,18 @@ namespace Model
          */
         virtual void DeleteScalingPolicyAsync(const Model::DeleteScalingPolicyRequest& request, const DeleteScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteScalingPolicyCallable(const Model::DeleteScalingPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteScalingPolicyOutcomeCallable DeleteScalingPolicyCallable(Model::DeleteScalingPolicyRequest&& request) const;
+
+        /**
+         * Same as DeleteScalingPolicyAsync(const Model::DeleteScalingPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteScalingPolicyAsync(Model::DeleteScalingPolicyRequest&& request, const DeleteScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters a scalable target that was previously registered. If you are no
          * longer using a scalable target, you can delete it with this operation. When you
@@ -215,6 +230,18 @@ namespace Model
          */
         virtual void DeregisterScalableTargetAsync(const Model::DeregisterScalableTargetRequest& request, const DeregisterScalableTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterScalableTargetCallable(const Model::DeregisterScalableTargetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeregisterScalableTargetOutcomeCallable DeregisterScalableTargetCallable(Model::DeregisterScalableTargetRequest&& request) const;
+
+        /**
+         * Same as DeregisterScalableTargetAsync(const Model::DeregisterScalableTargetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeregisterScalableTargetAsync(Model::DeregisterScalableTargetRequest&& request, const DeregisterScalableTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides descriptive information for scalable targets with a specified
          * service namespace.</p> <p>You can filter the results in a service namespace with
@@ -249,6 +276,18 @@ namespace Model
          */
         virtual void DescribeScalableTargetsAsync(const Model::DescribeScalableTargetsRequest& request, const DescribeScalableTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScalableTargetsCallable(const Model::DescribeScalableTargetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeScalableTargetsOutcomeCallable DescribeScalableTargetsCallable(Model::DescribeScalableTargetsRequest&& request) const;
+
+        /**
+         * Same as DescribeScalableTargetsAsync(const Model::DescribeScalableTargetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeScalableTargetsAsync(Model::DescribeScalableTargetsRequest&& request, const DescribeScalableTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides descriptive information for scaling activities with a specified
          * service namespace for the previous six weeks.</p> <p>You can filter the results
@@ -289,6 +328,18 @@ namespace Model
          */
         virtual void DescribeScalingActivitiesAsync(const Model::DescribeScalingActivitiesRequest& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScalingActivitiesCallable(const Model::DescribeScalingActivitiesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeScalingActivitiesOutcomeCallable DescribeScalingActivitiesCallable(Model::DescribeScalingActivitiesRequest&& request) const;
+
+        /**
+         * Same as DescribeScalingActivitiesAsync(const Model::DescribeScalingActivitiesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeScalingActivitiesAsync(Model::DescribeScalingActivitiesRequest&& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides descriptive information for scaling policies with a specified
          * service namespace.</p> <p>You can filter the results in a service namespace with
@@ -323,6 +374,18 @@ namespace Model
          */
         virtual void DescribeScalingPoliciesAsync(const Model::DescribeScalingPoliciesRequest& request, const DescribeScalingPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScalingPoliciesCallable(const Model::DescribeScalingPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeScalingPoliciesOutcomeCallable DescribeScalingPoliciesCallable(Model::DescribeScalingPoliciesRequest&& request) const;
+
+        /**
+         * Same as DescribeScalingPoliciesAsync(const Model::DescribeScalingPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeScalingPoliciesAsync(Model::DescribeScalingPoliciesRequest&& request, const DescribeScalingPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates a policy for an existing Application Auto Scaling scalable
          * target. Each scalable target is identified by service namespace, a resource ID,
@@ -372,6 +435,18 @@ namespace Model
          */
         virtual void PutScalingPolicyAsync(const Model::PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutScalingPolicyCallable(const Model::PutScalingPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutScalingPolicyOutcomeCallable PutScalingPolicyCallable(Model::PutScalingPolicyRequest&& request) const;
+
+        /**
+         * Same as PutScalingPolicyAsync(const Model::PutScalingPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutScalingPolicyAsync(Model::PutScalingPolicyRequest&& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers or updates a scalable target. A scalable target is a resource that
          * can be scaled up or down with Application Auto Scaling. After you have
@@ -418,6 +493,70 @@ namespace Model
          */
         virtual void RegisterScalableTargetAsync(const Model::RegisterScalableTargetRequest& request, const RegisterScalableTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterScalableTargetCallable(const Model::RegisterScalableTargetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterScalableTargetOutcomeCallable RegisterScalableTargetCallable(Model::RegisterScalableTargetRequest&& request) const;
+
+        /**
+         * Same as RegisterScalableTargetAsync(const Model::RegisterScalableTargetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterScalableTargetAsync(Model::RegisterScalableTargetRequest&& request, const RegisterScalableTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeScalableTargets(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ApplicationAutoScalingClient, Model::DescribeScalableTargetsRequest, Model::DescribeScalableTargetsOutcome> DescribeScalableTargetsPaginator(const Model::DescribeScalableTargetsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeScalingActivities(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ApplicationAutoScalingClient, Model::DescribeScalingActivitiesRequest, Model::DescribeScalingActivitiesOutcome> DescribeScalingActivitiesPaginator(const Model::DescribeScalingActivitiesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeScalingPolicies(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ApplicationAutoScalingClient, Model::DescribeScalingPoliciesRequest, Model::DescribeScalingPoliciesOutcome> DescribeScalingPoliciesPaginator(const Model::DescribeScalingPoliciesRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of DeleteScalingPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ApplicationAutoScalingClient, Model::DeleteScalingPolicyRequest, Model::DeleteScalingPolicyOutcome> DeleteScalingPolicyAwaitable(Model::DeleteScalingPolicyRequest request) const;
+
+        /**
+         * co_await-able form of DeregisterScalableTarget(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ApplicationAutoScalingClient, Model::DeregisterScalableTargetRequest, Model::DeregisterScalableTargetOutcome> DeregisterScalableTargetAwaitable(Model::DeregisterScalableTargetRequest request) const;
+
+        /**
+         * co_await-able form of DescribeScalableTargets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ApplicationAutoScalingClient, Model::DescribeScalableTargetsRequest, Model::DescribeScalableTargetsOutcome> DescribeScalableTargetsAwaitable(Model::DescribeScalableTargetsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeScalingActivities(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ApplicationAutoScalingClient, Model::DescribeScalingActivitiesRequest, Model::DescribeScalingActivitiesOutcome> DescribeScalingActivitiesAwaitable(Model::DescribeScalingActivitiesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeScalingPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ApplicationAutoScalingClient, Model::DescribeScalingPoliciesRequest, Model::DescribeScalingPoliciesOutcome> DescribeScalingPoliciesAwaitable(Model::DescribeScalingPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of PutScalingPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ApplicationAutoScalingClient, Model::PutScalingPolicyRequest, Model::PutScalingPolicyOutcome> PutScalingPolicyAwaitable(Model::PutScalingPolicyRequest request) const;
+
+        /**
+         * co_await-able form of RegisterScalableTarget(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ApplicationAutoScalingClient, Model::RegisterScalableTargetRequest, Model::RegisterScalableTargetOutcome> RegisterScalableTargetAwaitable(Model::RegisterScalableTargetRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteScalingPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteScalingPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
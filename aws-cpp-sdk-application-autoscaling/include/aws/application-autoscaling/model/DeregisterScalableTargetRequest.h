@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeregisterScalableTargetRequest();
+    inline const char* GetServiceRequestName() const override { return "DeregisterScalableTarget"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeScalableTargetsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeScalableTargets"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeScalingPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeScalingPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
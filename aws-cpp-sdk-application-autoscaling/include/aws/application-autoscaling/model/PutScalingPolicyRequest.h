@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     PutScalingPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "PutScalingPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
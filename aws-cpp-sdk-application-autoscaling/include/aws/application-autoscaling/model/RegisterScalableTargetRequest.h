@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RegisterScalableTargetRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterScalableTarget"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -116,7 +116,7 @@ DeleteScalingPolicyOutcome ApplicationAutoScalingClient::DeleteScalingPolicy(con
 
 DeleteScalingPolicyOutcomeCallable ApplicationAutoScalingClient::DeleteScalingPolicyCallable(const DeleteScalingPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteScalingPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteScalingPolicy(request); } );
 }
 
 void ApplicationAutoScalingClient::DeleteScalingPolicyAsync(const DeleteScalingPolicyRequest& request, const DeleteScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -124,6 +124,16 @@ void ApplicationAutoScalingClient::DeleteScalingPolicyAsync(const DeleteScalingP
   m_executor->Submit( [this, request, handler, context](){ this->DeleteScalingPolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteScalingPolicyOutcomeCallable ApplicationAutoScalingClient::DeleteScalingPolicyCallable(DeleteScalingPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ApplicationAutoScalingClient::DeleteScalingPolicy, this, std::move(request)));
+}
+
+void ApplicationAutoScalingClient::DeleteScalingPolicyAsync(DeleteScalingPolicyRequest&& request, const DeleteScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ApplicationAutoScalingClient::DeleteScalingPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ApplicationAutoScalingClient::DeleteScalingPolicyAsyncHelper(const DeleteScalingPolicyRequest& request, const DeleteScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteScalingPolicy(request), context);
@@ -147,7 +157,7 @@ DeregisterScalableTargetOutcome ApplicationAutoScalingClient::DeregisterScalable
 
 DeregisterScalableTargetOutcomeCallable ApplicationAutoScalingClient::DeregisterScalableTargetCallable(const DeregisterScalableTargetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeregisterScalableTarget(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeregisterScalableTarget(request); } );
 }
 
 void ApplicationAutoScalingClient::DeregisterScalableTargetAsync(const DeregisterScalableTargetRequest& request, const DeregisterScalableTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -155,6 +165,16 @@ void ApplicationAutoScalingClient::DeregisterScalableTargetAsync(const Deregiste
   m_executor->Submit( [this, request, handler, context](){ this->DeregisterScalableTargetAsyncHelper( request, handler, context ); } );
 }
 
+DeregisterScalableTargetOutcomeCallable ApplicationAutoScalingClient::DeregisterScalableTargetCallable(DeregisterScalableTargetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ApplicationAutoScalingClient::DeregisterScalableTarget, this, std::move(request)));
+}
+
+void ApplicationAutoScalingClient::DeregisterScalableTargetAsync(DeregisterScalableTargetRequest&& request, const DeregisterScalableTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ApplicationAutoScalingClient::DeregisterScalableTargetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ApplicationAutoScalingClient::DeregisterScalableTargetAsyncHelper(const DeregisterScalableTargetRequest& request, const DeregisterScalableTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeregisterScalableTarget(request), context);
@@ -178,7 +198,7 @@ DescribeScalableTargetsOutcome ApplicationAutoScalingClient::DescribeScalableTar
 
 DescribeScalableTargetsOutcomeCallable ApplicationAutoScalingClient::DescribeScalableTargetsCallable(const DescribeScalableTargetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeScalableTargets(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeScalableTargets(request); } );
 }
 
 void ApplicationAutoScalingClient::DescribeScalableTargetsAsync(const DescribeScalableTargetsRequest& request, const DescribeScalableTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -186,6 +206,16 @@ void ApplicationAutoScalingClient::DescribeScalableTargetsAsync(const DescribeSc
   m_executor->Submit( [this, request, handler, context](){ this->DescribeScalableTargetsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeScalableTargetsOutcomeCallable ApplicationAutoScalingClient::DescribeScalableTargetsCallable(DescribeScalableTargetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ApplicationAutoScalingClient::DescribeScalableTargets, this, std::move(request)));
+}
+
+void ApplicationAutoScalingClient::DescribeScalableTargetsAsync(DescribeScalableTargetsRequest&& request, const DescribeScalableTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ApplicationAutoScalingClient::DescribeScalableTargetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ApplicationAutoScalingClient::DescribeScalableTargetsAsyncHelper(const DescribeScalableTargetsRequest& request, const DescribeScalableTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeScalableTargets(request), context);
@@ -209,7 +239,7 @@ DescribeScalingActivitiesOutcome ApplicationAutoScalingClient::DescribeScalingAc
 
 DescribeScalingActivitiesOutcomeCallable ApplicationAutoScalingClient::DescribeScalingActivitiesCallable(const DescribeScalingActivitiesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeScalingActivities(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeScalingActivities(request); } );
 }
 
 void ApplicationAutoScalingClient::DescribeScalingActivitiesAsync(const DescribeScalingActivitiesRequest& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -217,6 +247,16 @@ void ApplicationAutoScalingClient::DescribeScalingActivitiesAsync(const Describe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeScalingActivitiesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeScalingActivitiesOutcomeCallable ApplicationAutoScalingClient::DescribeScalingActivitiesCallable(DescribeScalingActivitiesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ApplicationAutoScalingClient::DescribeScalingActivities, this, std::move(request)));
+}
+
+void ApplicationAutoScalingClient::DescribeScalingActivitiesAsync(DescribeScalingActivitiesRequest&& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ApplicationAutoScalingClient::DescribeScalingActivitiesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ApplicationAutoScalingClient::DescribeScalingActivitiesAsyncHelper(const DescribeScalingActivitiesRequest& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeScalingActivities(request), context);
@@ -240,7 +280,7 @@ DescribeScalingPoliciesOutcome ApplicationAutoScalingClient::DescribeScalingPoli
 
 DescribeScalingPoliciesOutcomeCallable ApplicationAutoScalingClient::DescribeScalingPoliciesCallable(const DescribeScalingPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeScalingPolicies(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeScalingPolicies(request); } );
 }
 
 void ApplicationAutoScalingClient::DescribeScalingPoliciesAsync(const DescribeScalingPoliciesRequest& request, const DescribeScalingPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -248,6 +288,16 @@ void ApplicationAutoScalingClient::DescribeScalingPoliciesAsync(const DescribeSc
   m_executor->Submit( [this, request, handler, context](){ this->DescribeScalingPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeScalingPoliciesOutcomeCallable ApplicationAutoScalingClient::DescribeScalingPoliciesCallable(DescribeScalingPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ApplicationAutoScalingClient::DescribeScalingPolicies, this, std::move(request)));
+}
+
+void ApplicationAutoScalingClient::DescribeScalingPoliciesAsync(DescribeScalingPoliciesRequest&& request, const DescribeScalingPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ApplicationAutoScalingClient::DescribeScalingPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ApplicationAutoScalingClient::DescribeScalingPoliciesAsyncHelper(const DescribeScalingPoliciesRequest& request, const DescribeScalingPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeScalingPolicies(request), context);
@@ -271,7 +321,7 @@ PutScalingPolicyOutcome ApplicationAutoScalingClient::PutScalingPolicy(const Put
 
 PutScalingPolicyOutcomeCallable ApplicationAutoScalingClient::PutScalingPolicyCallable(const PutScalingPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutScalingPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutScalingPolicy(request); } );
 }
 
 void ApplicationAutoScalingClient::PutScalingPolicyAsync(const PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -279,6 +329,16 @@ void ApplicationAutoScalingClient::PutScalingPolicyAsync(const PutScalingPolicyR
   m_executor->Submit( [this, request, handler, context](){ this->PutScalingPolicyAsyncHelper( request, handler, context ); } );
 }
 
+PutScalingPolicyOutcomeCallable ApplicationAutoScalingClient::PutScalingPolicyCallable(PutScalingPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ApplicationAutoScalingClient::PutScalingPolicy, this, std::move(request)));
+}
+
+void ApplicationAutoScalingClient::PutScalingPolicyAsync(PutScalingPolicyRequest&& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ApplicationAutoScalingClient::PutScalingPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ApplicationAutoScalingClient::PutScalingPolicyAsyncHelper(const PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutScalingPolicy(request), context);
@@ -302,7 +362,7 @@ RegisterScalableTargetOutcome ApplicationAutoScalingClient::RegisterScalableTarg
 
 RegisterScalableTargetOutcomeCallable ApplicationAutoScalingClient::RegisterScalableTargetCallable(const RegisterScalableTargetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterScalableTarget(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterScalableTarget(request); } );
 }
 
 void ApplicationAutoScalingClient::RegisterScalableTargetAsync(const RegisterScalableTargetRequest& request, const RegisterScalableTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -310,8 +370,106 @@ void ApplicationAutoScalingClient::RegisterScalableTargetAsync(const RegisterSca
   m_executor->Submit( [this, request, handler, context](){ this->RegisterScalableTargetAsyncHelper( request, handler, context ); } );
 }
 
+RegisterScalableTargetOutcomeCallable ApplicationAutoScalingClient::RegisterScalableTargetCallable(RegisterScalableTargetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ApplicationAutoScalingClient::RegisterScalableTarget, this, std::move(request)));
+}
+
+void ApplicationAutoScalingClient::RegisterScalableTargetAsync(RegisterScalableTargetRequest&& request, const RegisterScalableTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ApplicationAutoScalingClient::RegisterScalableTargetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ApplicationAutoScalingClient::RegisterScalableTargetAsyncHelper(const RegisterScalableTargetRequest& request, const RegisterScalableTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterScalableTarget(request), context);
 }
 
+Paginator<ApplicationAutoScalingClient, DescribeScalableTargetsRequest, DescribeScalableTargetsOutcome> ApplicationAutoScalingClient::DescribeScalableTargetsPaginator(const DescribeScalableTargetsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ApplicationAutoScalingClient, DescribeScalableTargetsRequest, DescribeScalableTargetsOutcome>(this, &ApplicationAutoScalingClient::DescribeScalableTargets, request,
+    [](const DescribeScalableTargetsRequest& current, const DescribeScalableTargetsOutcome& outcome, DescribeScalableTargetsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ApplicationAutoScalingClient, DescribeScalingActivitiesRequest, DescribeScalingActivitiesOutcome> ApplicationAutoScalingClient::DescribeScalingActivitiesPaginator(const DescribeScalingActivitiesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ApplicationAutoScalingClient, DescribeScalingActivitiesRequest, DescribeScalingActivitiesOutcome>(this, &ApplicationAutoScalingClient::DescribeScalingActivities, request,
+    [](const DescribeScalingActivitiesRequest& current, const DescribeScalingActivitiesOutcome& outcome, DescribeScalingActivitiesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ApplicationAutoScalingClient, DescribeScalingPoliciesRequest, DescribeScalingPoliciesOutcome> ApplicationAutoScalingClient::DescribeScalingPoliciesPaginator(const DescribeScalingPoliciesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ApplicationAutoScalingClient, DescribeScalingPoliciesRequest, DescribeScalingPoliciesOutcome>(this, &ApplicationAutoScalingClient::DescribeScalingPolicies, request,
+    [](const DescribeScalingPoliciesRequest& current, const DescribeScalingPoliciesOutcome& outcome, DescribeScalingPoliciesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<ApplicationAutoScalingClient, DeleteScalingPolicyRequest, DeleteScalingPolicyOutcome> ApplicationAutoScalingClient::DeleteScalingPolicyAwaitable(DeleteScalingPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &ApplicationAutoScalingClient::DeleteScalingPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<ApplicationAutoScalingClient, DeregisterScalableTargetRequest, DeregisterScalableTargetOutcome> ApplicationAutoScalingClient::DeregisterScalableTargetAwaitable(DeregisterScalableTargetRequest request) const
+{
+  return { m_executor.get(), { this, &ApplicationAutoScalingClient::DeregisterScalableTarget, std::move(request) } };
+}
+
+ClientOperationAwaitable<ApplicationAutoScalingClient, DescribeScalableTargetsRequest, DescribeScalableTargetsOutcome> ApplicationAutoScalingClient::DescribeScalableTargetsAwaitable(DescribeScalableTargetsRequest request) const
+{
+  return { m_executor.get(), { this, &ApplicationAutoScalingClient::DescribeScalableTargets, std::move(request) } };
+}
+
+ClientOperationAwaitable<ApplicationAutoScalingClient, DescribeScalingActivitiesRequest, DescribeScalingActivitiesOutcome> ApplicationAutoScalingClient::DescribeScalingActivitiesAwaitable(DescribeScalingActivitiesRequest request) const
+{
+  return { m_executor.get(), { this, &ApplicationAutoScalingClient::DescribeScalingActivities, std::move(request) } };
+}
+
+ClientOperationAwaitable<ApplicationAutoScalingClient, DescribeScalingPoliciesRequest, DescribeScalingPoliciesOutcome> ApplicationAutoScalingClient::DescribeScalingPoliciesAwaitable(DescribeScalingPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &ApplicationAutoScalingClient::DescribeScalingPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<ApplicationAutoScalingClient, PutScalingPolicyRequest, PutScalingPolicyOutcome> ApplicationAutoScalingClient::PutScalingPolicyAwaitable(PutScalingPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &ApplicationAutoScalingClient::PutScalingPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<ApplicationAutoScalingClient, RegisterScalableTargetRequest, RegisterScalableTargetOutcome> ApplicationAutoScalingClient::RegisterScalableTargetAwaitable(RegisterScalableTargetRequest request) const
+{
+  return { m_executor.get(), { this, &ApplicationAutoScalingClient::RegisterScalableTarget, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,26 +29,32 @@ namespace Aws
       namespace AdjustmentTypeMapper
       {
 
-        static const int ChangeInCapacity_HASH = HashingUtils::HashString("ChangeInCapacity");
-        static const int PercentChangeInCapacity_HASH = HashingUtils::HashString("PercentChangeInCapacity");
-        static const int ExactCapacity_HASH = HashingUtils::HashString("ExactCapacity");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ChangeInCapacity_HASH = -796727057;
+        static const int PercentChangeInCapacity_HASH = 1784216340;
+        static const int ExactCapacity_HASH = -160004935;
 
 
         AdjustmentType GetAdjustmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ChangeInCapacity_HASH)
+          switch (hashCode)
           {
+          case ChangeInCapacity_HASH:
             return AdjustmentType::ChangeInCapacity;
-          }
-          else if (hashCode == PercentChangeInCapacity_HASH)
-          {
+          case PercentChangeInCapacity_HASH:
             return AdjustmentType::PercentChangeInCapacity;
-          }
-          else if (hashCode == ExactCapacity_HASH)
-          {
+          case ExactCapacity_HASH:
             return AdjustmentType::ExactCapacity;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace MetricAggregationTypeMapper
       {
 
-        static const int Average_HASH = HashingUtils::HashString("Average");
-        static const int Minimum_HASH = HashingUtils::HashString("Minimum");
-        static const int Maximum_HASH = HashingUtils::HashString("Maximum");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Average_HASH = 1033205245;
+        static const int Minimum_HASH = -1565775890;
+        static const int Maximum_HASH = -1785573888;
 
 
         MetricAggregationType GetMetricAggregationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Average_HASH)
+          switch (hashCode)
           {
+          case Average_HASH:
             return MetricAggregationType::Average;
-          }
-          else if (hashCode == Minimum_HASH)
-          {
+          case Minimum_HASH:
             return MetricAggregationType::Minimum;
-          }
-          else if (hashCode == Maximum_HASH)
-          {
+          case Maximum_HASH:
             return MetricAggregationType::Maximum;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace PolicyTypeMapper
       {
 
-        static const int StepScaling_HASH = HashingUtils::HashString("StepScaling");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int StepScaling_HASH = -1106299141;
 
 
         PolicyType GetPolicyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == StepScaling_HASH)
+          switch (hashCode)
           {
+          case StepScaling_HASH:
             return PolicyType::StepScaling;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace ScalableDimensionMapper
       {
 
-        static const int ecs_service_DesiredCount_HASH = HashingUtils::HashString("ecs:service:DesiredCount");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ecs_service_DesiredCount_HASH = -525255137;
 
 
         ScalableDimension GetScalableDimensionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ecs_service_DesiredCount_HASH)
+          switch (hashCode)
           {
+          case ecs_service_DesiredCount_HASH:
             return ScalableDimension::ecs_service_DesiredCount;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,41 +29,41 @@ namespace Aws
       namespace ScalingActivityStatusCodeMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Successful_HASH = HashingUtils::HashString("Successful");
-        static const int Overridden_HASH = HashingUtils::HashString("Overridden");
-        static const int Unfulfilled_HASH = HashingUtils::HashString("Unfulfilled");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Pending_HASH = 982065527;
+        static const int InProgress_HASH = 646453906;
+        static const int Successful_HASH = 1259833018;
+        static const int Overridden_HASH = 219233748;
+        static const int Unfulfilled_HASH = -103457146;
+        static const int Failed_HASH = 2096857181;
 
 
         ScalingActivityStatusCode GetScalingActivityStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          switch (hashCode)
           {
+          case Pending_HASH:
             return ScalingActivityStatusCode::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
+          case InProgress_HASH:
             return ScalingActivityStatusCode::InProgress;
-          }
-          else if (hashCode == Successful_HASH)
-          {
+          case Successful_HASH:
             return ScalingActivityStatusCode::Successful;
-          }
-          else if (hashCode == Overridden_HASH)
-          {
+          case Overridden_HASH:
             return ScalingActivityStatusCode::Overridden;
-          }
-          else if (hashCode == Unfulfilled_HASH)
-          {
+          case Unfulfilled_HASH:
             return ScalingActivityStatusCode::Unfulfilled;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return ScalingActivityStatusCode::Failed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace ServiceNamespaceMapper
       {
 
-        static const int ecs_HASH = HashingUtils::HashString("ecs");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ecs_HASH = 100245;
 
 
         ServiceNamespace GetServiceNamespaceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ecs_HASH)
+          switch (hashCode)
           {
+          case ecs_HASH:
             return ServiceNamespace::ecs;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -54,6 +54,9 @@
 #include <aws/autoscaling/model/TerminateInstanceInAutoScalingGroupResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -397,6 +400,18 @@ namespace Model
          */
         virtual void AttachInstancesAsync(const Model::AttachInstancesRequest& request, const AttachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachInstancesCallable(const Model::AttachInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachInstancesOutcomeCallable AttachInstancesCallable(Model::AttachInstancesRequest&& request) const;
+
+        /**
+         * Same as AttachInstancesAsync(const Model::AttachInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachInstancesAsync(Model::AttachInstancesRequest&& request, const AttachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches one or more target groups to the specified Auto Scaling group.</p>
          * <p>To describe the target groups for an Auto Scaling group, use
@@ -437,6 +452,18 @@ namespace Model
          */
         virtual void AttachLoadBalancerTargetGroupsAsync(const Model::AttachLoadBalancerTargetGroupsRequest& request, const AttachLoadBalancerTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachLoadBalancerTargetGroupsCallable(const Model::AttachLoadBalancerTargetGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachLoadBalancerTargetGroupsOutcomeCallable AttachLoadBalancerTargetGroupsCallable(Model::AttachLoadBalancerTargetGroupsRequest&& request) const;
+
+        /**
+         * Same as AttachLoadBalancerTargetGroupsAsync(const Model::AttachLoadBalancerTargetGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachLoadBalancerTargetGroupsAsync(Model::AttachLoadBalancerTargetGroupsRequest&& request, const AttachLoadBalancerTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches one or more Classic load balancers to the specified Auto Scaling
          * group.</p> <p>To attach an Application load balancer instead, see
@@ -480,6 +507,18 @@ namespace Model
          */
         virtual void AttachLoadBalancersAsync(const Model::AttachLoadBalancersRequest& request, const AttachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachLoadBalancersCallable(const Model::AttachLoadBalancersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachLoadBalancersOutcomeCallable AttachLoadBalancersCallable(Model::AttachLoadBalancersRequest&& request) const;
+
+        /**
+         * Same as AttachLoadBalancersAsync(const Model::AttachLoadBalancersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachLoadBalancersAsync(Model::AttachLoadBalancersRequest&& request, const AttachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Completes the lifecycle action for the specified token or instance with the
          * specified result.</p> <p>This step is a part of the procedure for adding a
@@ -541,6 +580,18 @@ namespace Model
          */
         virtual void CompleteLifecycleActionAsync(const Model::CompleteLifecycleActionRequest& request, const CompleteLifecycleActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CompleteLifecycleActionCallable(const Model::CompleteLifecycleActionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CompleteLifecycleActionOutcomeCallable CompleteLifecycleActionCallable(Model::CompleteLifecycleActionRequest&& request) const;
+
+        /**
+         * Same as CompleteLifecycleActionAsync(const Model::CompleteLifecycleActionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CompleteLifecycleActionAsync(Model::CompleteLifecycleActionRequest&& request, const CompleteLifecycleActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an Auto Scaling group with the specified name and attributes.</p>
          * <p>If you exceed your maximum limit of Auto Scaling groups, which by default is
@@ -575,6 +626,18 @@ namespace Model
          */
         virtual void CreateAutoScalingGroupAsync(const Model::CreateAutoScalingGroupRequest& request, const CreateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAutoScalingGroupCallable(const Model::CreateAutoScalingGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateAutoScalingGroupOutcomeCallable CreateAutoScalingGroupCallable(Model::CreateAutoScalingGroupRequest&& request) const;
+
+        /**
+         * Same as CreateAutoScalingGroupAsync(const Model::CreateAutoScalingGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateAutoScalingGroupAsync(Model::CreateAutoScalingGroupRequest&& request, const CreateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a launch configuration.</p> <p>If you exceed your maximum limit of
          * launch configurations, which by default is 100 per region, the call fails. For
@@ -609,6 +672,18 @@ namespace Model
          */
         virtual void CreateLaunchConfigurationAsync(const Model::CreateLaunchConfigurationRequest& request, const CreateLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLaunchConfigurationCallable(const Model::CreateLaunchConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateLaunchConfigurationOutcomeCallable CreateLaunchConfigurationCallable(Model::CreateLaunchConfigurationRequest&& request) const;
+
+        /**
+         * Same as CreateLaunchConfigurationAsync(const Model::CreateLaunchConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateLaunchConfigurationAsync(Model::CreateLaunchConfigurationRequest&& request, const CreateLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates tags for the specified Auto Scaling group.</p> <p>When you
          * specify a tag with a key that already exists, the operation overwrites the
@@ -643,6 +718,18 @@ namespace Model
          */
         virtual void CreateOrUpdateTagsAsync(const Model::CreateOrUpdateTagsRequest& request, const CreateOrUpdateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateOrUpdateTagsCallable(const Model::CreateOrUpdateTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateOrUpdateTagsOutcomeCallable CreateOrUpdateTagsCallable(Model::CreateOrUpdateTagsRequest&& request) const;
+
+        /**
+         * Same as CreateOrUpdateTagsAsync(const Model::CreateOrUpdateTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateOrUpdateTagsAsync(Model::CreateOrUpdateTagsRequest&& request, const CreateOrUpdateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified Auto Scaling group.</p> <p>If the group has instances
          * or scaling activities in progress, you must specify the option to force the
@@ -689,6 +776,18 @@ namespace Model
          */
         virtual void DeleteAutoScalingGroupAsync(const Model::DeleteAutoScalingGroupRequest& request, const DeleteAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAutoScalingGroupCallable(const Model::DeleteAutoScalingGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteAutoScalingGroupOutcomeCallable DeleteAutoScalingGroupCallable(Model::DeleteAutoScalingGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteAutoScalingGroupAsync(const Model::DeleteAutoScalingGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteAutoScalingGroupAsync(Model::DeleteAutoScalingGroupRequest&& request, const DeleteAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified launch configuration.</p> <p>The launch configuration
          * must not be attached to an Auto Scaling group. When this call completes, the
@@ -714,6 +813,18 @@ namespace Model
          */
         virtual void DeleteLaunchConfigurationAsync(const Model::DeleteLaunchConfigurationRequest& request, const DeleteLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLaunchConfigurationCallable(const Model::DeleteLaunchConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteLaunchConfigurationOutcomeCallable DeleteLaunchConfigurationCallable(Model::DeleteLaunchConfigurationRequest&& request) const;
+
+        /**
+         * Same as DeleteLaunchConfigurationAsync(const Model::DeleteLaunchConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteLaunchConfigurationAsync(Model::DeleteLaunchConfigurationRequest&& request, const DeleteLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified lifecycle hook.</p> <p>If there are any outstanding
          * lifecycle actions, they are completed first (<code>ABANDON</code> for launching
@@ -739,6 +850,18 @@ namespace Model
          */
         virtual void DeleteLifecycleHookAsync(const Model::DeleteLifecycleHookRequest& request, const DeleteLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLifecycleHookCallable(const Model::DeleteLifecycleHookRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteLifecycleHookOutcomeCallable DeleteLifecycleHookCallable(Model::DeleteLifecycleHookRequest&& request) const;
+
+        /**
+         * Same as DeleteLifecycleHookAsync(const Model::DeleteLifecycleHookRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteLifecycleHookAsync(Model::DeleteLifecycleHookRequest&& request, const DeleteLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified notification.</p>
          */
@@ -758,6 +881,18 @@ namespace Model
          */
         virtual void DeleteNotificationConfigurationAsync(const Model::DeleteNotificationConfigurationRequest& request, const DeleteNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteNotificationConfigurationCallable(const Model::DeleteNotificationConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteNotificationConfigurationOutcomeCallable DeleteNotificationConfigurationCallable(Model::DeleteNotificationConfigurationRequest&& request) const;
+
+        /**
+         * Same as DeleteNotificationConfigurationAsync(const Model::DeleteNotificationConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteNotificationConfigurationAsync(Model::DeleteNotificationConfigurationRequest&& request, const DeleteNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified Auto Scaling policy.</p> <p>Deleting a policy deletes
          * the underlying alarm action, but does not delete the alarm, even if it no longer
@@ -783,6 +918,18 @@ namespace Model
          */
         virtual void DeletePolicyAsync(const Model::DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePolicyCallable(const Model::DeletePolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeletePolicyOutcomeCallable DeletePolicyCallable(Model::DeletePolicyRequest&& request) const;
+
+        /**
+         * Same as DeletePolicyAsync(const Model::DeletePolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeletePolicyAsync(Model::DeletePolicyRequest&& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified scheduled action.</p>
          */
@@ -802,6 +949,18 @@ namespace Model
          */
         virtual void DeleteScheduledActionAsync(const Model::DeleteScheduledActionRequest& request, const DeleteScheduledActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteScheduledActionCallable(const Model::DeleteScheduledActionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteScheduledActionOutcomeCallable DeleteScheduledActionCallable(Model::DeleteScheduledActionRequest&& request) const;
+
+        /**
+         * Same as DeleteScheduledActionAsync(const Model::DeleteScheduledActionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteScheduledActionAsync(Model::DeleteScheduledActionRequest&& request, const DeleteScheduledActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified tags.</p>
          */
@@ -821,6 +980,18 @@ namespace Model
          */
         virtual void DeleteTagsAsync(const Model::DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTagsCallable(const Model::DeleteTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTagsOutcomeCallable DeleteTagsCallable(Model::DeleteTagsRequest&& request) const;
+
+        /**
+         * Same as DeleteTagsAsync(const Model::DeleteTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTagsAsync(Model::DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the current Auto Scaling resource limits for your AWS account.</p>
          * <p>For information about requesting an increase in these limits, see <a
@@ -849,6 +1020,18 @@ namespace Model
          */
         virtual void DescribeAccountLimitsAsync(const Model::DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAccountLimitsCallable(const Model::DescribeAccountLimitsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAccountLimitsOutcomeCallable DescribeAccountLimitsCallable(Model::DescribeAccountLimitsRequest&& request) const;
+
+        /**
+         * Same as DescribeAccountLimitsAsync(const Model::DescribeAccountLimitsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAccountLimitsAsync(Model::DescribeAccountLimitsRequest&& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the policy adjustment types for use with
          * <a>PutScalingPolicy</a>.</p>
@@ -871,6 +1054,18 @@ namespace Model
          */
         virtual void DescribeAdjustmentTypesAsync(const Model::DescribeAdjustmentTypesRequest& request, const DescribeAdjustmentTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAdjustmentTypesCallable(const Model::DescribeAdjustmentTypesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAdjustmentTypesOutcomeCallable DescribeAdjustmentTypesCallable(Model::DescribeAdjustmentTypesRequest&& request) const;
+
+        /**
+         * Same as DescribeAdjustmentTypesAsync(const Model::DescribeAdjustmentTypesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAdjustmentTypesAsync(Model::DescribeAdjustmentTypesRequest&& request, const DescribeAdjustmentTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more Auto Scaling groups.</p>
          */
@@ -890,6 +1085,18 @@ namespace Model
          */
         virtual void DescribeAutoScalingGroupsAsync(const Model::DescribeAutoScalingGroupsRequest& request, const DescribeAutoScalingGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAutoScalingGroupsCallable(const Model::DescribeAutoScalingGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAutoScalingGroupsOutcomeCallable DescribeAutoScalingGroupsCallable(Model::DescribeAutoScalingGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeAutoScalingGroupsAsync(const Model::DescribeAutoScalingGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAutoScalingGroupsAsync(Model::DescribeAutoScalingGroupsRequest&& request, const DescribeAutoScalingGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more Auto Scaling instances.</p>
          */
@@ -909,6 +1116,18 @@ namespace Model
          */
         virtual void DescribeAutoScalingInstancesAsync(const Model::DescribeAutoScalingInstancesRequest& request, const DescribeAutoScalingInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAutoScalingInstancesCallable(const Model::DescribeAutoScalingInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAutoScalingInstancesOutcomeCallable DescribeAutoScalingInstancesCallable(Model::DescribeAutoScalingInstancesRequest&& request) const;
+
+        /**
+         * Same as DescribeAutoScalingInstancesAsync(const Model::DescribeAutoScalingInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAutoScalingInstancesAsync(Model::DescribeAutoScalingInstancesRequest&& request, const DescribeAutoScalingInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the notification types that are supported by Auto Scaling.</p>
          */
@@ -928,6 +1147,18 @@ namespace Model
          */
         virtual void DescribeAutoScalingNotificationTypesAsync(const Model::DescribeAutoScalingNotificationTypesRequest& request, const DescribeAutoScalingNotificationTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAutoScalingNotificationTypesCallable(const Model::DescribeAutoScalingNotificationTypesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAutoScalingNotificationTypesOutcomeCallable DescribeAutoScalingNotificationTypesCallable(Model::DescribeAutoScalingNotificationTypesRequest&& request) const;
+
+        /**
+         * Same as DescribeAutoScalingNotificationTypesAsync(const Model::DescribeAutoScalingNotificationTypesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAutoScalingNotificationTypesAsync(Model::DescribeAutoScalingNotificationTypesRequest&& request, const DescribeAutoScalingNotificationTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more launch configurations.</p>
          */
@@ -947,6 +1178,18 @@ namespace Model
          */
         virtual void DescribeLaunchConfigurationsAsync(const Model::DescribeLaunchConfigurationsRequest& request, const DescribeLaunchConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLaunchConfigurationsCallable(const Model::DescribeLaunchConfigurationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLaunchConfigurationsOutcomeCallable DescribeLaunchConfigurationsCallable(Model::DescribeLaunchConfigurationsRequest&& request) const;
+
+        /**
+         * Same as DescribeLaunchConfigurationsAsync(const Model::DescribeLaunchConfigurationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLaunchConfigurationsAsync(Model::DescribeLaunchConfigurationsRequest&& request, const DescribeLaunchConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the available types of lifecycle hooks.</p>
          */
@@ -966,6 +1209,18 @@ namespace Model
          */
         virtual void DescribeLifecycleHookTypesAsync(const Model::DescribeLifecycleHookTypesRequest& request, const DescribeLifecycleHookTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLifecycleHookTypesCallable(const Model::DescribeLifecycleHookTypesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLifecycleHookTypesOutcomeCallable DescribeLifecycleHookTypesCallable(Model::DescribeLifecycleHookTypesRequest&& request) const;
+
+        /**
+         * Same as DescribeLifecycleHookTypesAsync(const Model::DescribeLifecycleHookTypesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLifecycleHookTypesAsync(Model::DescribeLifecycleHookTypesRequest&& request, const DescribeLifecycleHookTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the lifecycle hooks for the specified Auto Scaling group.</p>
          */
@@ -985,6 +1240,18 @@ namespace Model
          */
         virtual void DescribeLifecycleHooksAsync(const Model::DescribeLifecycleHooksRequest& request, const DescribeLifecycleHooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLifecycleHooksCallable(const Model::DescribeLifecycleHooksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLifecycleHooksOutcomeCallable DescribeLifecycleHooksCallable(Model::DescribeLifecycleHooksRequest&& request) const;
+
+        /**
+         * Same as DescribeLifecycleHooksAsync(const Model::DescribeLifecycleHooksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLifecycleHooksAsync(Model::DescribeLifecycleHooksRequest&& request, const DescribeLifecycleHooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the target groups for the specified Auto Scaling group.</p>
          */
@@ -1004,6 +1271,18 @@ namespace Model
          */
         virtual void DescribeLoadBalancerTargetGroupsAsync(const Model::DescribeLoadBalancerTargetGroupsRequest& request, const DescribeLoadBalancerTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoadBalancerTargetGroupsCallable(const Model::DescribeLoadBalancerTargetGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLoadBalancerTargetGroupsOutcomeCallable DescribeLoadBalancerTargetGroupsCallable(Model::DescribeLoadBalancerTargetGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeLoadBalancerTargetGroupsAsync(const Model::DescribeLoadBalancerTargetGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLoadBalancerTargetGroupsAsync(Model::DescribeLoadBalancerTargetGroupsRequest&& request, const DescribeLoadBalancerTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the load balancers for the specified Auto Scaling group.</p>
          * <p>Note that this operation describes only Classic load balancers. If you have
@@ -1032,6 +1311,18 @@ namespace Model
          */
         virtual void DescribeLoadBalancersAsync(const Model::DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoadBalancersCallable(const Model::DescribeLoadBalancersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLoadBalancersOutcomeCallable DescribeLoadBalancersCallable(Model::DescribeLoadBalancersRequest&& request) const;
+
+        /**
+         * Same as DescribeLoadBalancersAsync(const Model::DescribeLoadBalancersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLoadBalancersAsync(Model::DescribeLoadBalancersRequest&& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the available CloudWatch metrics for Auto Scaling.</p> <p>Note that
          * the <code>GroupStandbyInstances</code> metric is not returned by default. You
@@ -1060,6 +1351,18 @@ namespace Model
          */
         virtual void DescribeMetricCollectionTypesAsync(const Model::DescribeMetricCollectionTypesRequest& request, const DescribeMetricCollectionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeMetricCollectionTypesCallable(const Model::DescribeMetricCollectionTypesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeMetricCollectionTypesOutcomeCallable DescribeMetricCollectionTypesCallable(Model::DescribeMetricCollectionTypesRequest&& request) const;
+
+        /**
+         * Same as DescribeMetricCollectionTypesAsync(const Model::DescribeMetricCollectionTypesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeMetricCollectionTypesAsync(Model::DescribeMetricCollectionTypesRequest&& request, const DescribeMetricCollectionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the notification actions associated with the specified Auto Scaling
          * group.</p>
@@ -1082,6 +1385,18 @@ namespace Model
          */
         virtual void DescribeNotificationConfigurationsAsync(const Model::DescribeNotificationConfigurationsRequest& request, const DescribeNotificationConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeNotificationConfigurationsCallable(const Model::DescribeNotificationConfigurationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeNotificationConfigurationsOutcomeCallable DescribeNotificationConfigurationsCallable(Model::DescribeNotificationConfigurationsRequest&& request) const;
+
+        /**
+         * Same as DescribeNotificationConfigurationsAsync(const Model::DescribeNotificationConfigurationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeNotificationConfigurationsAsync(Model::DescribeNotificationConfigurationsRequest&& request, const DescribeNotificationConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the policies for the specified Auto Scaling group.</p>
          */
@@ -1101,6 +1416,18 @@ namespace Model
          */
         virtual void DescribePoliciesAsync(const Model::DescribePoliciesRequest& request, const DescribePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribePoliciesCallable(const Model::DescribePoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribePoliciesOutcomeCallable DescribePoliciesCallable(Model::DescribePoliciesRequest&& request) const;
+
+        /**
+         * Same as DescribePoliciesAsync(const Model::DescribePoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribePoliciesAsync(Model::DescribePoliciesRequest&& request, const DescribePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more scaling activities for the specified Auto Scaling
          * group.</p>
@@ -1123,6 +1450,18 @@ namespace Model
          */
         virtual void DescribeScalingActivitiesAsync(const Model::DescribeScalingActivitiesRequest& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScalingActivitiesCallable(const Model::DescribeScalingActivitiesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeScalingActivitiesOutcomeCallable DescribeScalingActivitiesCallable(Model::DescribeScalingActivitiesRequest&& request) const;
+
+        /**
+         * Same as DescribeScalingActivitiesAsync(const Model::DescribeScalingActivitiesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeScalingActivitiesAsync(Model::DescribeScalingActivitiesRequest&& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the scaling process types for use with <a>ResumeProcesses</a> and
          * <a>SuspendProcesses</a>.</p>
@@ -1145,6 +1484,18 @@ namespace Model
          */
         virtual void DescribeScalingProcessTypesAsync(const Model::DescribeScalingProcessTypesRequest& request, const DescribeScalingProcessTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScalingProcessTypesCallable(const Model::DescribeScalingProcessTypesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeScalingProcessTypesOutcomeCallable DescribeScalingProcessTypesCallable(Model::DescribeScalingProcessTypesRequest&& request) const;
+
+        /**
+         * Same as DescribeScalingProcessTypesAsync(const Model::DescribeScalingProcessTypesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeScalingProcessTypesAsync(Model::DescribeScalingProcessTypesRequest&& request, const DescribeScalingProcessTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the actions scheduled for your Auto Scaling group that haven't run.
          * To describe the actions that have already run, use
@@ -1170,6 +1521,18 @@ namespace Model
          */
         virtual void DescribeScheduledActionsAsync(const Model::DescribeScheduledActionsRequest& request, const DescribeScheduledActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScheduledActionsCallable(const Model::DescribeScheduledActionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeScheduledActionsOutcomeCallable DescribeScheduledActionsCallable(Model::DescribeScheduledActionsRequest&& request) const;
+
+        /**
+         * Same as DescribeScheduledActionsAsync(const Model::DescribeScheduledActionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeScheduledActionsAsync(Model::DescribeScheduledActionsRequest&& request, const DescribeScheduledActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified tags.</p> <p>You can use filters to limit the
          * results. For example, you can query for the tags for a specific Auto Scaling
@@ -1207,6 +1570,18 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTagsCallable(const Model::DescribeTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(Model::DescribeTagsRequest&& request) const;
+
+        /**
+         * Same as DescribeTagsAsync(const Model::DescribeTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTagsAsync(Model::DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the termination policies supported by Auto Scaling.</p>
          */
@@ -1226,6 +1601,18 @@ namespace Model
          */
         virtual void DescribeTerminationPolicyTypesAsync(const Model::DescribeTerminationPolicyTypesRequest& request, const DescribeTerminationPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTerminationPolicyTypesCallable(const Model::DescribeTerminationPolicyTypesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTerminationPolicyTypesOutcomeCallable DescribeTerminationPolicyTypesCallable(Model::DescribeTerminationPolicyTypesRequest&& request) const;
+
+        /**
+         * Same as DescribeTerminationPolicyTypesAsync(const Model::DescribeTerminationPolicyTypesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTerminationPolicyTypesAsync(Model::DescribeTerminationPolicyTypesRequest&& request, const DescribeTerminationPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes one or more instances from the specified Auto Scaling group.</p>
          * <p>After the instances are detached, you can manage them independently from the
@@ -1275,6 +1662,18 @@ namespace Model
          */
         virtual void DetachInstancesAsync(const Model::DetachInstancesRequest& request, const DetachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachInstancesCallable(const Model::DetachInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachInstancesOutcomeCallable DetachInstancesCallable(Model::DetachInstancesRequest&& request) const;
+
+        /**
+         * Same as DetachInstancesAsync(const Model::DetachInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachInstancesAsync(Model::DetachInstancesRequest&& request, const DetachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches one or more target groups from the specified Auto Scaling group.</p>
          */
@@ -1294,6 +1693,18 @@ namespace Model
          */
         virtual void DetachLoadBalancerTargetGroupsAsync(const Model::DetachLoadBalancerTargetGroupsRequest& request, const DetachLoadBalancerTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachLoadBalancerTargetGroupsCallable(const Model::DetachLoadBalancerTargetGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachLoadBalancerTargetGroupsOutcomeCallable DetachLoadBalancerTargetGroupsCallable(Model::DetachLoadBalancerTargetGroupsRequest&& request) const;
+
+        /**
+         * Same as DetachLoadBalancerTargetGroupsAsync(const Model::DetachLoadBalancerTargetGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachLoadBalancerTargetGroupsAsync(Model::DetachLoadBalancerTargetGroupsRequest&& request, const DetachLoadBalancerTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches one or more Classic load balancers from the specified Auto Scaling
          * group.</p> <p>Note that this operation detaches only Classic load balancers. If
@@ -1334,6 +1745,18 @@ namespace Model
          */
         virtual void DetachLoadBalancersAsync(const Model::DetachLoadBalancersRequest& request, const DetachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachLoadBalancersCallable(const Model::DetachLoadBalancersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachLoadBalancersOutcomeCallable DetachLoadBalancersCallable(Model::DetachLoadBalancersRequest&& request) const;
+
+        /**
+         * Same as DetachLoadBalancersAsync(const Model::DetachLoadBalancersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachLoadBalancersAsync(Model::DetachLoadBalancersRequest&& request, const DetachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables monitoring of the specified metrics for the specified Auto Scaling
          * group.</p>
@@ -1356,6 +1779,18 @@ namespace Model
          */
         virtual void DisableMetricsCollectionAsync(const Model::DisableMetricsCollectionRequest& request, const DisableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableMetricsCollectionCallable(const Model::DisableMetricsCollectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableMetricsCollectionOutcomeCallable DisableMetricsCollectionCallable(Model::DisableMetricsCollectionRequest&& request) const;
+
+        /**
+         * Same as DisableMetricsCollectionAsync(const Model::DisableMetricsCollectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableMetricsCollectionAsync(Model::DisableMetricsCollectionRequest&& request, const DisableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables monitoring of the specified metrics for the specified Auto Scaling
          * group.</p> <p>You can only enable metrics collection if
@@ -1384,6 +1819,18 @@ namespace Model
          */
         virtual void EnableMetricsCollectionAsync(const Model::EnableMetricsCollectionRequest& request, const EnableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableMetricsCollectionCallable(const Model::EnableMetricsCollectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableMetricsCollectionOutcomeCallable EnableMetricsCollectionCallable(Model::EnableMetricsCollectionRequest&& request) const;
+
+        /**
+         * Same as EnableMetricsCollectionAsync(const Model::EnableMetricsCollectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableMetricsCollectionAsync(Model::EnableMetricsCollectionRequest&& request, const EnableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Moves the specified instances into <code>Standby</code> mode.</p> <p>For more
          * information, see <a
@@ -1412,6 +1859,18 @@ namespace Model
          */
         virtual void EnterStandbyAsync(const Model::EnterStandbyRequest& request, const EnterStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnterStandbyCallable(const Model::EnterStandbyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnterStandbyOutcomeCallable EnterStandbyCallable(Model::EnterStandbyRequest&& request) const;
+
+        /**
+         * Same as EnterStandbyAsync(const Model::EnterStandbyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnterStandbyAsync(Model::EnterStandbyRequest&& request, const EnterStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Executes the specified policy.</p>
          */
@@ -1431,6 +1890,18 @@ namespace Model
          */
         virtual void ExecutePolicyAsync(const Model::ExecutePolicyRequest& request, const ExecutePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ExecutePolicyCallable(const Model::ExecutePolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ExecutePolicyOutcomeCallable ExecutePolicyCallable(Model::ExecutePolicyRequest&& request) const;
+
+        /**
+         * Same as ExecutePolicyAsync(const Model::ExecutePolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ExecutePolicyAsync(Model::ExecutePolicyRequest&& request, const ExecutePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Moves the specified instances out of <code>Standby</code> mode.</p> <p>For
          * more information, see <a
@@ -1459,6 +1930,18 @@ namespace Model
          */
         virtual void ExitStandbyAsync(const Model::ExitStandbyRequest& request, const ExitStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ExitStandbyCallable(const Model::ExitStandbyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ExitStandbyOutcomeCallable ExitStandbyCallable(Model::ExitStandbyRequest&& request) const;
+
+        /**
+         * Same as ExitStandbyAsync(const Model::ExitStandbyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ExitStandbyAsync(Model::ExitStandbyRequest&& request, const ExitStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates a lifecycle hook for the specified Auto Scaling Group.</p>
          * <p>A lifecycle hook tells Auto Scaling that you want to perform an action on an
@@ -1538,6 +2021,18 @@ namespace Model
          */
         virtual void PutLifecycleHookAsync(const Model::PutLifecycleHookRequest& request, const PutLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutLifecycleHookCallable(const Model::PutLifecycleHookRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutLifecycleHookOutcomeCallable PutLifecycleHookCallable(Model::PutLifecycleHookRequest&& request) const;
+
+        /**
+         * Same as PutLifecycleHookAsync(const Model::PutLifecycleHookRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutLifecycleHookAsync(Model::PutLifecycleHookRequest&& request, const PutLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures an Auto Scaling group to send notifications when specified events
          * take place. Subscribers to the specified topic can have messages delivered to an
@@ -1575,6 +2070,18 @@ namespace Model
          */
         virtual void PutNotificationConfigurationAsync(const Model::PutNotificationConfigurationRequest& request, const PutNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutNotificationConfigurationCallable(const Model::PutNotificationConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutNotificationConfigurationOutcomeCallable PutNotificationConfigurationCallable(Model::PutNotificationConfigurationRequest&& request) const;
+
+        /**
+         * Same as PutNotificationConfigurationAsync(const Model::PutNotificationConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutNotificationConfigurationAsync(Model::PutNotificationConfigurationRequest&& request, const PutNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates a policy for an Auto Scaling group. To update an existing
          * policy, use the existing policy name and set the parameters you want to change.
@@ -1615,6 +2122,18 @@ namespace Model
          */
         virtual void PutScalingPolicyAsync(const Model::PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutScalingPolicyCallable(const Model::PutScalingPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutScalingPolicyOutcomeCallable PutScalingPolicyCallable(Model::PutScalingPolicyRequest&& request) const;
+
+        /**
+         * Same as PutScalingPolicyAsync(const Model::PutScalingPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutScalingPolicyAsync(Model::PutScalingPolicyRequest&& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates a scheduled scaling action for an Auto Scaling group. When
          * updating a scheduled scaling action, if you leave a parameter unspecified, the
@@ -1649,6 +2168,18 @@ namespace Model
          */
         virtual void PutScheduledUpdateGroupActionAsync(const Model::PutScheduledUpdateGroupActionRequest& request, const PutScheduledUpdateGroupActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutScheduledUpdateGroupActionCallable(const Model::PutScheduledUpdateGroupActionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutScheduledUpdateGroupActionOutcomeCallable PutScheduledUpdateGroupActionCallable(Model::PutScheduledUpdateGroupActionRequest&& request) const;
+
+        /**
+         * Same as PutScheduledUpdateGroupActionAsync(const Model::PutScheduledUpdateGroupActionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutScheduledUpdateGroupActionAsync(Model::PutScheduledUpdateGroupActionRequest&& request, const PutScheduledUpdateGroupActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Records a heartbeat for the lifecycle action associated with the specified
          * token or instance. This extends the timeout by the length of time defined using
@@ -1713,6 +2244,18 @@ namespace Model
          */
         virtual void RecordLifecycleActionHeartbeatAsync(const Model::RecordLifecycleActionHeartbeatRequest& request, const RecordLifecycleActionHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RecordLifecycleActionHeartbeatCallable(const Model::RecordLifecycleActionHeartbeatRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RecordLifecycleActionHeartbeatOutcomeCallable RecordLifecycleActionHeartbeatCallable(Model::RecordLifecycleActionHeartbeatRequest&& request) const;
+
+        /**
+         * Same as RecordLifecycleActionHeartbeatAsync(const Model::RecordLifecycleActionHeartbeatRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RecordLifecycleActionHeartbeatAsync(Model::RecordLifecycleActionHeartbeatRequest&& request, const RecordLifecycleActionHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Resumes the specified suspended Auto Scaling processes, or all suspended
          * process, for the specified Auto Scaling group.</p> <p>For more information, see
@@ -1747,6 +2290,18 @@ namespace Model
          */
         virtual void ResumeProcessesAsync(const Model::ResumeProcessesRequest& request, const ResumeProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResumeProcessesCallable(const Model::ResumeProcessesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResumeProcessesOutcomeCallable ResumeProcessesCallable(Model::ResumeProcessesRequest&& request) const;
+
+        /**
+         * Same as ResumeProcessesAsync(const Model::ResumeProcessesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResumeProcessesAsync(Model::ResumeProcessesRequest&& request, const ResumeProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the size of the specified Auto Scaling group.</p> <p>For more
          * information about desired capacity, see <a
@@ -1775,6 +2330,18 @@ namespace Model
          */
         virtual void SetDesiredCapacityAsync(const Model::SetDesiredCapacityRequest& request, const SetDesiredCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetDesiredCapacityCallable(const Model::SetDesiredCapacityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetDesiredCapacityOutcomeCallable SetDesiredCapacityCallable(Model::SetDesiredCapacityRequest&& request) const;
+
+        /**
+         * Same as SetDesiredCapacityAsync(const Model::SetDesiredCapacityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetDesiredCapacityAsync(Model::SetDesiredCapacityRequest&& request, const SetDesiredCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the health status of the specified instance.</p> <p>For more
          * information, see <a
@@ -1803,6 +2370,18 @@ namespace Model
          */
         virtual void SetInstanceHealthAsync(const Model::SetInstanceHealthRequest& request, const SetInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetInstanceHealthCallable(const Model::SetInstanceHealthRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetInstanceHealthOutcomeCallable SetInstanceHealthCallable(Model::SetInstanceHealthRequest&& request) const;
+
+        /**
+         * Same as SetInstanceHealthAsync(const Model::SetInstanceHealthRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetInstanceHealthAsync(Model::SetInstanceHealthRequest&& request, const SetInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the instance protection settings of the specified instances.</p>
          * <p>For more information, see <a
@@ -1831,6 +2410,18 @@ namespace Model
          */
         virtual void SetInstanceProtectionAsync(const Model::SetInstanceProtectionRequest& request, const SetInstanceProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetInstanceProtectionCallable(const Model::SetInstanceProtectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetInstanceProtectionOutcomeCallable SetInstanceProtectionCallable(Model::SetInstanceProtectionRequest&& request) const;
+
+        /**
+         * Same as SetInstanceProtectionAsync(const Model::SetInstanceProtectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetInstanceProtectionAsync(Model::SetInstanceProtectionRequest&& request, const SetInstanceProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Suspends the specified Auto Scaling processes, or all processes, for the
          * specified Auto Scaling group.</p> <p>Note that if you suspend either the
@@ -1874,6 +2465,18 @@ namespace Model
          */
         virtual void SuspendProcessesAsync(const Model::SuspendProcessesRequest& request, const SuspendProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SuspendProcessesCallable(const Model::SuspendProcessesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SuspendProcessesOutcomeCallable SuspendProcessesCallable(Model::SuspendProcessesRequest&& request) const;
+
+        /**
+         * Same as SuspendProcessesAsync(const Model::SuspendProcessesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SuspendProcessesAsync(Model::SuspendProcessesRequest&& request, const SuspendProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Terminates the specified instance and optionally adjusts the desired group
          * size.</p> <p>This call simply makes a termination request. The instance is not
@@ -1899,6 +2502,18 @@ namespace Model
          */
         virtual void TerminateInstanceInAutoScalingGroupAsync(const Model::TerminateInstanceInAutoScalingGroupRequest& request, const TerminateInstanceInAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TerminateInstanceInAutoScalingGroupCallable(const Model::TerminateInstanceInAutoScalingGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TerminateInstanceInAutoScalingGroupOutcomeCallable TerminateInstanceInAutoScalingGroupCallable(Model::TerminateInstanceInAutoScalingGroupRequest&& request) const;
+
+        /**
+         * Same as TerminateInstanceInAutoScalingGroupAsync(const Model::TerminateInstanceInAutoScalingGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TerminateInstanceInAutoScalingGroupAsync(Model::TerminateInstanceInAutoScalingGroupRequest&& request, const TerminateInstanceInAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the configuration for the specified Auto Scaling group.</p> <p>To
          * update an Auto Scaling group with a launch configuration with
@@ -1972,6 +2587,330 @@ namespace Model
          */
         virtual void UpdateAutoScalingGroupAsync(const Model::UpdateAutoScalingGroupRequest& request, const UpdateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAutoScalingGroupCallable(const Model::UpdateAutoScalingGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateAutoScalingGroupOutcomeCallable UpdateAutoScalingGroupCallable(Model::UpdateAutoScalingGroupRequest&& request) const;
+
+        /**
+         * Same as UpdateAutoScalingGroupAsync(const Model::UpdateAutoScalingGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateAutoScalingGroupAsync(Model::UpdateAutoScalingGroupRequest&& request, const UpdateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeAutoScalingGroups(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<AutoScalingClient, Model::DescribeAutoScalingGroupsRequest, Model::DescribeAutoScalingGroupsOutcome> DescribeAutoScalingGroupsPaginator(const Model::DescribeAutoScalingGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeAutoScalingInstances(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<AutoScalingClient, Model::DescribeAutoScalingInstancesRequest, Model::DescribeAutoScalingInstancesOutcome> DescribeAutoScalingInstancesPaginator(const Model::DescribeAutoScalingInstancesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeLaunchConfigurations(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<AutoScalingClient, Model::DescribeLaunchConfigurationsRequest, Model::DescribeLaunchConfigurationsOutcome> DescribeLaunchConfigurationsPaginator(const Model::DescribeLaunchConfigurationsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeLoadBalancerTargetGroups(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<AutoScalingClient, Model::DescribeLoadBalancerTargetGroupsRequest, Model::DescribeLoadBalancerTargetGroupsOutcome> DescribeLoadBalancerTargetGroupsPaginator(const Model::DescribeLoadBalancerTargetGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeLoadBalancers(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<AutoScalingClient, Model::DescribeLoadBalancersRequest, Model::DescribeLoadBalancersOutcome> DescribeLoadBalancersPaginator(const Model::DescribeLoadBalancersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeNotificationConfigurations(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<AutoScalingClient, Model::DescribeNotificationConfigurationsRequest, Model::DescribeNotificationConfigurationsOutcome> DescribeNotificationConfigurationsPaginator(const Model::DescribeNotificationConfigurationsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribePolicies(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<AutoScalingClient, Model::DescribePoliciesRequest, Model::DescribePoliciesOutcome> DescribePoliciesPaginator(const Model::DescribePoliciesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeScalingActivities(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<AutoScalingClient, Model::DescribeScalingActivitiesRequest, Model::DescribeScalingActivitiesOutcome> DescribeScalingActivitiesPaginator(const Model::DescribeScalingActivitiesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeScheduledActions(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<AutoScalingClient, Model::DescribeScheduledActionsRequest, Model::DescribeScheduledActionsOutcome> DescribeScheduledActionsPaginator(const Model::DescribeScheduledActionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeTags(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<AutoScalingClient, Model::DescribeTagsRequest, Model::DescribeTagsOutcome> DescribeTagsPaginator(const Model::DescribeTagsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AttachInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::AttachInstancesRequest, Model::AttachInstancesOutcome> AttachInstancesAwaitable(Model::AttachInstancesRequest request) const;
+
+        /**
+         * co_await-able form of AttachLoadBalancerTargetGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::AttachLoadBalancerTargetGroupsRequest, Model::AttachLoadBalancerTargetGroupsOutcome> AttachLoadBalancerTargetGroupsAwaitable(Model::AttachLoadBalancerTargetGroupsRequest request) const;
+
+        /**
+         * co_await-able form of AttachLoadBalancers(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::AttachLoadBalancersRequest, Model::AttachLoadBalancersOutcome> AttachLoadBalancersAwaitable(Model::AttachLoadBalancersRequest request) const;
+
+        /**
+         * co_await-able form of CompleteLifecycleAction(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::CompleteLifecycleActionRequest, Model::CompleteLifecycleActionOutcome> CompleteLifecycleActionAwaitable(Model::CompleteLifecycleActionRequest request) const;
+
+        /**
+         * co_await-able form of CreateAutoScalingGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::CreateAutoScalingGroupRequest, Model::CreateAutoScalingGroupOutcome> CreateAutoScalingGroupAwaitable(Model::CreateAutoScalingGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateLaunchConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::CreateLaunchConfigurationRequest, Model::CreateLaunchConfigurationOutcome> CreateLaunchConfigurationAwaitable(Model::CreateLaunchConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of CreateOrUpdateTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::CreateOrUpdateTagsRequest, Model::CreateOrUpdateTagsOutcome> CreateOrUpdateTagsAwaitable(Model::CreateOrUpdateTagsRequest request) const;
+
+        /**
+         * co_await-able form of DeleteAutoScalingGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DeleteAutoScalingGroupRequest, Model::DeleteAutoScalingGroupOutcome> DeleteAutoScalingGroupAwaitable(Model::DeleteAutoScalingGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteLaunchConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DeleteLaunchConfigurationRequest, Model::DeleteLaunchConfigurationOutcome> DeleteLaunchConfigurationAwaitable(Model::DeleteLaunchConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of DeleteLifecycleHook(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DeleteLifecycleHookRequest, Model::DeleteLifecycleHookOutcome> DeleteLifecycleHookAwaitable(Model::DeleteLifecycleHookRequest request) const;
+
+        /**
+         * co_await-able form of DeleteNotificationConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DeleteNotificationConfigurationRequest, Model::DeleteNotificationConfigurationOutcome> DeleteNotificationConfigurationAwaitable(Model::DeleteNotificationConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of DeletePolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DeletePolicyRequest, Model::DeletePolicyOutcome> DeletePolicyAwaitable(Model::DeletePolicyRequest request) const;
+
+        /**
+         * co_await-able form of DeleteScheduledAction(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DeleteScheduledActionRequest, Model::DeleteScheduledActionOutcome> DeleteScheduledActionAwaitable(Model::DeleteScheduledActionRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DeleteTagsRequest, Model::DeleteTagsOutcome> DeleteTagsAwaitable(Model::DeleteTagsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAccountLimits(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeAccountLimitsRequest, Model::DescribeAccountLimitsOutcome> DescribeAccountLimitsAwaitable(Model::DescribeAccountLimitsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAdjustmentTypes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeAdjustmentTypesRequest, Model::DescribeAdjustmentTypesOutcome> DescribeAdjustmentTypesAwaitable(Model::DescribeAdjustmentTypesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAutoScalingGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeAutoScalingGroupsRequest, Model::DescribeAutoScalingGroupsOutcome> DescribeAutoScalingGroupsAwaitable(Model::DescribeAutoScalingGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAutoScalingInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeAutoScalingInstancesRequest, Model::DescribeAutoScalingInstancesOutcome> DescribeAutoScalingInstancesAwaitable(Model::DescribeAutoScalingInstancesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAutoScalingNotificationTypes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeAutoScalingNotificationTypesRequest, Model::DescribeAutoScalingNotificationTypesOutcome> DescribeAutoScalingNotificationTypesAwaitable(Model::DescribeAutoScalingNotificationTypesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLaunchConfigurations(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeLaunchConfigurationsRequest, Model::DescribeLaunchConfigurationsOutcome> DescribeLaunchConfigurationsAwaitable(Model::DescribeLaunchConfigurationsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLifecycleHookTypes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeLifecycleHookTypesRequest, Model::DescribeLifecycleHookTypesOutcome> DescribeLifecycleHookTypesAwaitable(Model::DescribeLifecycleHookTypesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLifecycleHooks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeLifecycleHooksRequest, Model::DescribeLifecycleHooksOutcome> DescribeLifecycleHooksAwaitable(Model::DescribeLifecycleHooksRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLoadBalancerTargetGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeLoadBalancerTargetGroupsRequest, Model::DescribeLoadBalancerTargetGroupsOutcome> DescribeLoadBalancerTargetGroupsAwaitable(Model::DescribeLoadBalancerTargetGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLoadBalancers(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeLoadBalancersRequest, Model::DescribeLoadBalancersOutcome> DescribeLoadBalancersAwaitable(Model::DescribeLoadBalancersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeMetricCollectionTypes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeMetricCollectionTypesRequest, Model::DescribeMetricCollectionTypesOutcome> DescribeMetricCollectionTypesAwaitable(Model::DescribeMetricCollectionTypesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeNotificationConfigurations(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeNotificationConfigurationsRequest, Model::DescribeNotificationConfigurationsOutcome> DescribeNotificationConfigurationsAwaitable(Model::DescribeNotificationConfigurationsRequest request) const;
+
+        /**
+         * co_await-able form of DescribePolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribePoliciesRequest, Model::DescribePoliciesOutcome> DescribePoliciesAwaitable(Model::DescribePoliciesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeScalingActivities(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeScalingActivitiesRequest, Model::DescribeScalingActivitiesOutcome> DescribeScalingActivitiesAwaitable(Model::DescribeScalingActivitiesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeScalingProcessTypes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeScalingProcessTypesRequest, Model::DescribeScalingProcessTypesOutcome> DescribeScalingProcessTypesAwaitable(Model::DescribeScalingProcessTypesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeScheduledActions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeScheduledActionsRequest, Model::DescribeScheduledActionsOutcome> DescribeScheduledActionsAwaitable(Model::DescribeScheduledActionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeTagsRequest, Model::DescribeTagsOutcome> DescribeTagsAwaitable(Model::DescribeTagsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTerminationPolicyTypes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DescribeTerminationPolicyTypesRequest, Model::DescribeTerminationPolicyTypesOutcome> DescribeTerminationPolicyTypesAwaitable(Model::DescribeTerminationPolicyTypesRequest request) const;
+
+        /**
+         * co_await-able form of DetachInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DetachInstancesRequest, Model::DetachInstancesOutcome> DetachInstancesAwaitable(Model::DetachInstancesRequest request) const;
+
+        /**
+         * co_await-able form of DetachLoadBalancerTargetGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DetachLoadBalancerTargetGroupsRequest, Model::DetachLoadBalancerTargetGroupsOutcome> DetachLoadBalancerTargetGroupsAwaitable(Model::DetachLoadBalancerTargetGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DetachLoadBalancers(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DetachLoadBalancersRequest, Model::DetachLoadBalancersOutcome> DetachLoadBalancersAwaitable(Model::DetachLoadBalancersRequest request) const;
+
+        /**
+         * co_await-able form of DisableMetricsCollection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::DisableMetricsCollectionRequest, Model::DisableMetricsCollectionOutcome> DisableMetricsCollectionAwaitable(Model::DisableMetricsCollectionRequest request) const;
+
+        /**
+         * co_await-able form of EnableMetricsCollection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::EnableMetricsCollectionRequest, Model::EnableMetricsCollectionOutcome> EnableMetricsCollectionAwaitable(Model::EnableMetricsCollectionRequest request) const;
+
+        /**
+         * co_await-able form of EnterStandby(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::EnterStandbyRequest, Model::EnterStandbyOutcome> EnterStandbyAwaitable(Model::EnterStandbyRequest request) const;
+
+        /**
+         * co_await-able form of ExecutePolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::ExecutePolicyRequest, Model::ExecutePolicyOutcome> ExecutePolicyAwaitable(Model::ExecutePolicyRequest request) const;
+
+        /**
+         * co_await-able form of ExitStandby(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::ExitStandbyRequest, Model::ExitStandbyOutcome> ExitStandbyAwaitable(Model::ExitStandbyRequest request) const;
+
+        /**
+         * co_await-able form of PutLifecycleHook(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::PutLifecycleHookRequest, Model::PutLifecycleHookOutcome> PutLifecycleHookAwaitable(Model::PutLifecycleHookRequest request) const;
+
+        /**
+         * co_await-able form of PutNotificationConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::PutNotificationConfigurationRequest, Model::PutNotificationConfigurationOutcome> PutNotificationConfigurationAwaitable(Model::PutNotificationConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of PutScalingPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::PutScalingPolicyRequest, Model::PutScalingPolicyOutcome> PutScalingPolicyAwaitable(Model::PutScalingPolicyRequest request) const;
+
+        /**
+         * co_await-able form of PutScheduledUpdateGroupAction(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::PutScheduledUpdateGroupActionRequest, Model::PutScheduledUpdateGroupActionOutcome> PutScheduledUpdateGroupActionAwaitable(Model::PutScheduledUpdateGroupActionRequest request) const;
+
+        /**
+         * co_await-able form of RecordLifecycleActionHeartbeat(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::RecordLifecycleActionHeartbeatRequest, Model::RecordLifecycleActionHeartbeatOutcome> RecordLifecycleActionHeartbeatAwaitable(Model::RecordLifecycleActionHeartbeatRequest request) const;
+
+        /**
+         * co_await-able form of ResumeProcesses(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::ResumeProcessesRequest, Model::ResumeProcessesOutcome> ResumeProcessesAwaitable(Model::ResumeProcessesRequest request) const;
+
+        /**
+         * co_await-able form of SetDesiredCapacity(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::SetDesiredCapacityRequest, Model::SetDesiredCapacityOutcome> SetDesiredCapacityAwaitable(Model::SetDesiredCapacityRequest request) const;
+
+        /**
+         * co_await-able form of SetInstanceHealth(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::SetInstanceHealthRequest, Model::SetInstanceHealthOutcome> SetInstanceHealthAwaitable(Model::SetInstanceHealthRequest request) const;
+
+        /**
+         * co_await-able form of SetInstanceProtection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::SetInstanceProtectionRequest, Model::SetInstanceProtectionOutcome> SetInstanceProtectionAwaitable(Model::SetInstanceProtectionRequest request) const;
+
+        /**
+         * co_await-able form of SuspendProcesses(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::SuspendProcessesRequest, Model::SuspendProcessesOutcome> SuspendProcessesAwaitable(Model::SuspendProcessesRequest request) const;
+
+        /**
+         * co_await-able form of TerminateInstanceInAutoScalingGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::TerminateInstanceInAutoScalingGroupRequest, Model::TerminateInstanceInAutoScalingGroupOutcome> TerminateInstanceInAutoScalingGroupAwaitable(Model::TerminateInstanceInAutoScalingGroupRequest request) const;
+
+        /**
+         * co_await-able form of UpdateAutoScalingGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<AutoScalingClient, Model::UpdateAutoScalingGroupRequest, Model::UpdateAutoScalingGroupOutcome> UpdateAutoScalingGroupAwaitable(Model::UpdateAutoScalingGroupRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AttachInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AttachLoadBalancerTargetGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachLoadBalancerTargetGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
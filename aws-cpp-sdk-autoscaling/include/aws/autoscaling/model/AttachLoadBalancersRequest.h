@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AttachLoadBalancersRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachLoadBalancers"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CompleteLifecycleActionRequest();
+    inline const char* GetServiceRequestName() const override { return "CompleteLifecycleAction"; }
+
     Aws::String SerializePayload() const override;
 
     /**
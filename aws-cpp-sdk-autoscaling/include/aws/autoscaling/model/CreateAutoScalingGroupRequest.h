@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateAutoScalingGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateAutoScalingGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateLaunchConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateLaunchConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
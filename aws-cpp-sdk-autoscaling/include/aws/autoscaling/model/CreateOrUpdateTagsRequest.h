@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateOrUpdateTagsRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateOrUpdateTags"; }
+
     Aws::String SerializePayload() const override;
 
     /**
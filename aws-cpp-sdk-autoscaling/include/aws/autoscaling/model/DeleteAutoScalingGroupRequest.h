@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteAutoScalingGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteAutoScalingGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
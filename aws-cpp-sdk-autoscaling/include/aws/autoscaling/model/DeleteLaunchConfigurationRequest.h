@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteLaunchConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteLaunchConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteLifecycleHookRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteLifecycleHook"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteNotificationConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteNotificationConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeletePolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeletePolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteScheduledActionRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteScheduledAction"; }
+
     Aws::String SerializePayload() const override;
 
     /**
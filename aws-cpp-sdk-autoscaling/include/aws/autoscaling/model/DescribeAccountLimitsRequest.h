@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     DescribeAccountLimitsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAccountLimits"; }
+
     Aws::String SerializePayload() const override;
 
   };
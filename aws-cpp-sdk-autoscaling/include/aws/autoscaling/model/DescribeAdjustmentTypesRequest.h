@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     DescribeAdjustmentTypesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAdjustmentTypes"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeAutoScalingGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAutoScalingGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
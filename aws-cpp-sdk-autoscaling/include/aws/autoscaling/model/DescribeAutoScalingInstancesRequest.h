@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeAutoScalingInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAutoScalingInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
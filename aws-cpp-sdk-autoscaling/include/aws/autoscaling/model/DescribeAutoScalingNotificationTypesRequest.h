@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     DescribeAutoScalingNotificationTypesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAutoScalingNotificationTypes"; }
+
     Aws::String SerializePayload() const override;
 
   };
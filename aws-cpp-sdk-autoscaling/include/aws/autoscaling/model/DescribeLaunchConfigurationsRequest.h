@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeLaunchConfigurationsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLaunchConfigurations"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     DescribeLifecycleHookTypesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLifecycleHookTypes"; }
+
     Aws::String SerializePayload() const override;
 
   };
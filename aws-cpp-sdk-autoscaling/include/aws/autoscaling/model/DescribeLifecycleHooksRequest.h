@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeLifecycleHooksRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLifecycleHooks"; }
+
     Aws::String SerializePayload() const override;
 
     /**
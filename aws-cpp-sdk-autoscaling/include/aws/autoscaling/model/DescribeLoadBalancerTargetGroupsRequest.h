@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeLoadBalancerTargetGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLoadBalancerTargetGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeLoadBalancersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLoadBalancers"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     DescribeMetricCollectionTypesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeMetricCollectionTypes"; }
+
     Aws::String SerializePayload() const override;
 
   };
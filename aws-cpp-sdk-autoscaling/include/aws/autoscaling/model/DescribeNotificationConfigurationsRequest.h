@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeNotificationConfigurationsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeNotificationConfigurations"; }
+
     Aws::String SerializePayload() const override;
 
     /**
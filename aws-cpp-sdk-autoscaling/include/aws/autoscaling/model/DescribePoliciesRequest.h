@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribePoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribePolicies"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeScalingActivitiesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeScalingActivities"; }
+
     Aws::String SerializePayload() const override;
 
     /**
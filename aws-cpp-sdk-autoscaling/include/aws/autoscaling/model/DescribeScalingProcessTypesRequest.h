@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     DescribeScalingProcessTypesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeScalingProcessTypes"; }
+
     Aws::String SerializePayload() const override;
 
   };
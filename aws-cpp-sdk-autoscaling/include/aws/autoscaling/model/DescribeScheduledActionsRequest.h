@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeScheduledActionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeScheduledActions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     DescribeTerminationPolicyTypesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTerminationPolicyTypes"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DetachInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DetachLoadBalancerTargetGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachLoadBalancerTargetGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
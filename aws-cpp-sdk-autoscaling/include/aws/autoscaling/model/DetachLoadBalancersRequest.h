@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DetachLoadBalancersRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachLoadBalancers"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DisableMetricsCollectionRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableMetricsCollection"; }
+
     Aws::String SerializePayload() const override;
 
     /**
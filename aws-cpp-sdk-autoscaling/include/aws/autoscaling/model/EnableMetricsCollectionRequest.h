@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     EnableMetricsCollectionRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableMetricsCollection"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     EnterStandbyRequest();
+    inline const char* GetServiceRequestName() const override { return "EnterStandby"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ExecutePolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "ExecutePolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
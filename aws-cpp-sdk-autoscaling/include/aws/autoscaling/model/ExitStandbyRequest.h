@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ExitStandbyRequest();
+    inline const char* GetServiceRequestName() const override { return "ExitStandby"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PutLifecycleHookRequest();
+    inline const char* GetServiceRequestName() const override { return "PutLifecycleHook"; }
+
     Aws::String SerializePayload() const override;
 
     /**
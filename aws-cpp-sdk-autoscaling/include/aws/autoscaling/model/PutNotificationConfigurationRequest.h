@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PutNotificationConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "PutNotificationConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
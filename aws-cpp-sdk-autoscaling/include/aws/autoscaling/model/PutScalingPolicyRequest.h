@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     PutScalingPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "PutScalingPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
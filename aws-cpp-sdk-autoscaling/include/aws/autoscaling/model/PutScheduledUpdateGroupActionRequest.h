@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PutScheduledUpdateGroupActionRequest();
+    inline const char* GetServiceRequestName() const override { return "PutScheduledUpdateGroupAction"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RecordLifecycleActionHeartbeatRequest();
+    inline const char* GetServiceRequestName() const override { return "RecordLifecycleActionHeartbeat"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ResumeProcessesRequest();
+    inline const char* GetServiceRequestName() const override { return "ResumeProcesses"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     SetDesiredCapacityRequest();
+    inline const char* GetServiceRequestName() const override { return "SetDesiredCapacity"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     SetInstanceHealthRequest();
+    inline const char* GetServiceRequestName() const override { return "SetInstanceHealth"; }
+
     Aws::String SerializePayload() const override;
 
     /**
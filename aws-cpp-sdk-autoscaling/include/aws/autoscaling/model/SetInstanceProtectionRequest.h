@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetInstanceProtectionRequest();
+    inline const char* GetServiceRequestName() const override { return "SetInstanceProtection"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SuspendProcessesRequest();
+    inline const char* GetServiceRequestName() const override { return "SuspendProcesses"; }
+
     Aws::String SerializePayload() const override;
 
     /**
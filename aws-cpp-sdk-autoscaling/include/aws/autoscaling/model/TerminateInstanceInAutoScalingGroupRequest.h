@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     TerminateInstanceInAutoScalingGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "TerminateInstanceInAutoScalingGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
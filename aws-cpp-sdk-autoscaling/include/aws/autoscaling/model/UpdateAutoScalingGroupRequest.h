@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateAutoScalingGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateAutoScalingGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -161,7 +161,7 @@ AttachInstancesOutcome AutoScalingClient::AttachInstances(const AttachInstancesR
 
 AttachInstancesOutcomeCallable AutoScalingClient::AttachInstancesCallable(const AttachInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachInstances( request ); } );
 }
 
 void AutoScalingClient::AttachInstancesAsync(const AttachInstancesRequest& request, const AttachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -169,6 +169,16 @@ void AutoScalingClient::AttachInstancesAsync(const AttachInstancesRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->AttachInstancesAsyncHelper( request, handler, context ); } );
 }
 
+AttachInstancesOutcomeCallable AutoScalingClient::AttachInstancesCallable(AttachInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::AttachInstances, this, std::move(request)));
+}
+
+void AutoScalingClient::AttachInstancesAsync(AttachInstancesRequest&& request, const AttachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::AttachInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::AttachInstancesAsyncHelper(const AttachInstancesRequest& request, const AttachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachInstances(request), context);
@@ -191,7 +201,7 @@ AttachLoadBalancerTargetGroupsOutcome AutoScalingClient::AttachLoadBalancerTarge
 
 AttachLoadBalancerTargetGroupsOutcomeCallable AutoScalingClient::AttachLoadBalancerTargetGroupsCallable(const AttachLoadBalancerTargetGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachLoadBalancerTargetGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachLoadBalancerTargetGroups( request ); } );
 }
 
 void AutoScalingClient::AttachLoadBalancerTargetGroupsAsync(const AttachLoadBalancerTargetGroupsRequest& request, const AttachLoadBalancerTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -199,6 +209,16 @@ void AutoScalingClient::AttachLoadBalancerTargetGroupsAsync(const AttachLoadBala
   m_executor->Submit( [this, request, handler, context](){ this->AttachLoadBalancerTargetGroupsAsyncHelper( request, handler, context ); } );
 }
 
+AttachLoadBalancerTargetGroupsOutcomeCallable AutoScalingClient::AttachLoadBalancerTargetGroupsCallable(AttachLoadBalancerTargetGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::AttachLoadBalancerTargetGroups, this, std::move(request)));
+}
+
+void AutoScalingClient::AttachLoadBalancerTargetGroupsAsync(AttachLoadBalancerTargetGroupsRequest&& request, const AttachLoadBalancerTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::AttachLoadBalancerTargetGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::AttachLoadBalancerTargetGroupsAsyncHelper(const AttachLoadBalancerTargetGroupsRequest& request, const AttachLoadBalancerTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachLoadBalancerTargetGroups(request), context);
@@ -221,7 +241,7 @@ AttachLoadBalancersOutcome AutoScalingClient::AttachLoadBalancers(const AttachLo
 
 AttachLoadBalancersOutcomeCallable AutoScalingClient::AttachLoadBalancersCallable(const AttachLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachLoadBalancers( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachLoadBalancers( request ); } );
 }
 
 void AutoScalingClient::AttachLoadBalancersAsync(const AttachLoadBalancersRequest& request, const AttachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -229,6 +249,16 @@ void AutoScalingClient::AttachLoadBalancersAsync(const AttachLoadBalancersReques
   m_executor->Submit( [this, request, handler, context](){ this->AttachLoadBalancersAsyncHelper( request, handler, context ); } );
 }
 
+AttachLoadBalancersOutcomeCallable AutoScalingClient::AttachLoadBalancersCallable(AttachLoadBalancersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::AttachLoadBalancers, this, std::move(request)));
+}
+
+void AutoScalingClient::AttachLoadBalancersAsync(AttachLoadBalancersRequest&& request, const AttachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::AttachLoadBalancersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::AttachLoadBalancersAsyncHelper(const AttachLoadBalancersRequest& request, const AttachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachLoadBalancers(request), context);
@@ -251,7 +281,7 @@ CompleteLifecycleActionOutcome AutoScalingClient::CompleteLifecycleAction(const
 
 CompleteLifecycleActionOutcomeCallable AutoScalingClient::CompleteLifecycleActionCallable(const CompleteLifecycleActionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CompleteLifecycleAction( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CompleteLifecycleAction( request ); } );
 }
 
 void AutoScalingClient::CompleteLifecycleActionAsync(const CompleteLifecycleActionRequest& request, const CompleteLifecycleActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -259,6 +289,16 @@ void AutoScalingClient::CompleteLifecycleActionAsync(const CompleteLifecycleActi
   m_executor->Submit( [this, request, handler, context](){ this->CompleteLifecycleActionAsyncHelper( request, handler, context ); } );
 }
 
+CompleteLifecycleActionOutcomeCallable AutoScalingClient::CompleteLifecycleActionCallable(CompleteLifecycleActionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::CompleteLifecycleAction, this, std::move(request)));
+}
+
+void AutoScalingClient::CompleteLifecycleActionAsync(CompleteLifecycleActionRequest&& request, const CompleteLifecycleActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::CompleteLifecycleActionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::CompleteLifecycleActionAsyncHelper(const CompleteLifecycleActionRequest& request, const CompleteLifecycleActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CompleteLifecycleAction(request), context);
@@ -281,7 +321,7 @@ CreateAutoScalingGroupOutcome AutoScalingClient::CreateAutoScalingGroup(const Cr
 
 CreateAutoScalingGroupOutcomeCallable AutoScalingClient::CreateAutoScalingGroupCallable(const CreateAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateAutoScalingGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateAutoScalingGroup( request ); } );
 }
 
 void AutoScalingClient::CreateAutoScalingGroupAsync(const CreateAutoScalingGroupRequest& request, const CreateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -289,6 +329,16 @@ void AutoScalingClient::CreateAutoScalingGroupAsync(const CreateAutoScalingGroup
   m_executor->Submit( [this, request, handler, context](){ this->CreateAutoScalingGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateAutoScalingGroupOutcomeCallable AutoScalingClient::CreateAutoScalingGroupCallable(CreateAutoScalingGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::CreateAutoScalingGroup, this, std::move(request)));
+}
+
+void AutoScalingClient::CreateAutoScalingGroupAsync(CreateAutoScalingGroupRequest&& request, const CreateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::CreateAutoScalingGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::CreateAutoScalingGroupAsyncHelper(const CreateAutoScalingGroupRequest& request, const CreateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateAutoScalingGroup(request), context);
@@ -311,7 +361,7 @@ CreateLaunchConfigurationOutcome AutoScalingClient::CreateLaunchConfiguration(co
 
 CreateLaunchConfigurationOutcomeCallable AutoScalingClient::CreateLaunchConfigurationCallable(const CreateLaunchConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateLaunchConfiguration( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateLaunchConfiguration( request ); } );
 }
 
 void AutoScalingClient::CreateLaunchConfigurationAsync(const CreateLaunchConfigurationRequest& request, const CreateLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -319,6 +369,16 @@ void AutoScalingClient::CreateLaunchConfigurationAsync(const CreateLaunchConfigu
   m_executor->Submit( [this, request, handler, context](){ this->CreateLaunchConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+CreateLaunchConfigurationOutcomeCallable AutoScalingClient::CreateLaunchConfigurationCallable(CreateLaunchConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::CreateLaunchConfiguration, this, std::move(request)));
+}
+
+void AutoScalingClient::CreateLaunchConfigurationAsync(CreateLaunchConfigurationRequest&& request, const CreateLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::CreateLaunchConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::CreateLaunchConfigurationAsyncHelper(const CreateLaunchConfigurationRequest& request, const CreateLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateLaunchConfiguration(request), context);
@@ -341,7 +401,7 @@ CreateOrUpdateTagsOutcome AutoScalingClient::CreateOrUpdateTags(const CreateOrUp
 
 CreateOrUpdateTagsOutcomeCallable AutoScalingClient::CreateOrUpdateTagsCallable(const CreateOrUpdateTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateOrUpdateTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateOrUpdateTags( request ); } );
 }
 
 void AutoScalingClient::CreateOrUpdateTagsAsync(const CreateOrUpdateTagsRequest& request, const CreateOrUpdateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -349,6 +409,16 @@ void AutoScalingClient::CreateOrUpdateTagsAsync(const CreateOrUpdateTagsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->CreateOrUpdateTagsAsyncHelper( request, handler, context ); } );
 }
 
+CreateOrUpdateTagsOutcomeCallable AutoScalingClient::CreateOrUpdateTagsCallable(CreateOrUpdateTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::CreateOrUpdateTags, this, std::move(request)));
+}
+
+void AutoScalingClient::CreateOrUpdateTagsAsync(CreateOrUpdateTagsRequest&& request, const CreateOrUpdateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::CreateOrUpdateTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::CreateOrUpdateTagsAsyncHelper(const CreateOrUpdateTagsRequest& request, const CreateOrUpdateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateOrUpdateTags(request), context);
@@ -371,7 +441,7 @@ DeleteAutoScalingGroupOutcome AutoScalingClient::DeleteAutoScalingGroup(const De
 
 DeleteAutoScalingGroupOutcomeCallable AutoScalingClient::DeleteAutoScalingGroupCallable(const DeleteAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteAutoScalingGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteAutoScalingGroup( request ); } );
 }
 
 void AutoScalingClient::DeleteAutoScalingGroupAsync(const DeleteAutoScalingGroupRequest& request, const DeleteAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -379,6 +449,16 @@ void AutoScalingClient::DeleteAutoScalingGroupAsync(const DeleteAutoScalingGroup
   m_executor->Submit( [this, request, handler, context](){ this->DeleteAutoScalingGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteAutoScalingGroupOutcomeCallable AutoScalingClient::DeleteAutoScalingGroupCallable(DeleteAutoScalingGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DeleteAutoScalingGroup, this, std::move(request)));
+}
+
+void AutoScalingClient::DeleteAutoScalingGroupAsync(DeleteAutoScalingGroupRequest&& request, const DeleteAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DeleteAutoScalingGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DeleteAutoScalingGroupAsyncHelper(const DeleteAutoScalingGroupRequest& request, const DeleteAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteAutoScalingGroup(request), context);
@@ -401,7 +481,7 @@ DeleteLaunchConfigurationOutcome AutoScalingClient::DeleteLaunchConfiguration(co
 
 DeleteLaunchConfigurationOutcomeCallable AutoScalingClient::DeleteLaunchConfigurationCallable(const DeleteLaunchConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteLaunchConfiguration( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteLaunchConfiguration( request ); } );
 }
 
 void AutoScalingClient::DeleteLaunchConfigurationAsync(const DeleteLaunchConfigurationRequest& request, const DeleteLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -409,6 +489,16 @@ void AutoScalingClient::DeleteLaunchConfigurationAsync(const DeleteLaunchConfigu
   m_executor->Submit( [this, request, handler, context](){ this->DeleteLaunchConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+DeleteLaunchConfigurationOutcomeCallable AutoScalingClient::DeleteLaunchConfigurationCallable(DeleteLaunchConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DeleteLaunchConfiguration, this, std::move(request)));
+}
+
+void AutoScalingClient::DeleteLaunchConfigurationAsync(DeleteLaunchConfigurationRequest&& request, const DeleteLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DeleteLaunchConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DeleteLaunchConfigurationAsyncHelper(const DeleteLaunchConfigurationRequest& request, const DeleteLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteLaunchConfiguration(request), context);
@@ -431,7 +521,7 @@ DeleteLifecycleHookOutcome AutoScalingClient::DeleteLifecycleHook(const DeleteLi
 
 DeleteLifecycleHookOutcomeCallable AutoScalingClient::DeleteLifecycleHookCallable(const DeleteLifecycleHookRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteLifecycleHook( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteLifecycleHook( request ); } );
 }
 
 void AutoScalingClient::DeleteLifecycleHookAsync(const DeleteLifecycleHookRequest& request, const DeleteLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -439,6 +529,16 @@ void AutoScalingClient::DeleteLifecycleHookAsync(const DeleteLifecycleHookReques
   m_executor->Submit( [this, request, handler, context](){ this->DeleteLifecycleHookAsyncHelper( request, handler, context ); } );
 }
 
+DeleteLifecycleHookOutcomeCallable AutoScalingClient::DeleteLifecycleHookCallable(DeleteLifecycleHookRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DeleteLifecycleHook, this, std::move(request)));
+}
+
+void AutoScalingClient::DeleteLifecycleHookAsync(DeleteLifecycleHookRequest&& request, const DeleteLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DeleteLifecycleHookAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DeleteLifecycleHookAsyncHelper(const DeleteLifecycleHookRequest& request, const DeleteLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteLifecycleHook(request), context);
@@ -461,7 +561,7 @@ DeleteNotificationConfigurationOutcome AutoScalingClient::DeleteNotificationConf
 
 DeleteNotificationConfigurationOutcomeCallable AutoScalingClient::DeleteNotificationConfigurationCallable(const DeleteNotificationConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteNotificationConfiguration( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteNotificationConfiguration( request ); } );
 }
 
 void AutoScalingClient::DeleteNotificationConfigurationAsync(const DeleteNotificationConfigurationRequest& request, const DeleteNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -469,6 +569,16 @@ void AutoScalingClient::DeleteNotificationConfigurationAsync(const DeleteNotific
   m_executor->Submit( [this, request, handler, context](){ this->DeleteNotificationConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+DeleteNotificationConfigurationOutcomeCallable AutoScalingClient::DeleteNotificationConfigurationCallable(DeleteNotificationConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DeleteNotificationConfiguration, this, std::move(request)));
+}
+
+void AutoScalingClient::DeleteNotificationConfigurationAsync(DeleteNotificationConfigurationRequest&& request, const DeleteNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DeleteNotificationConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DeleteNotificationConfigurationAsyncHelper(const DeleteNotificationConfigurationRequest& request, const DeleteNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteNotificationConfiguration(request), context);
@@ -491,7 +601,7 @@ DeletePolicyOutcome AutoScalingClient::DeletePolicy(const DeletePolicyRequest& r
 
 DeletePolicyOutcomeCallable AutoScalingClient::DeletePolicyCallable(const DeletePolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeletePolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeletePolicy( request ); } );
 }
 
 void AutoScalingClient::DeletePolicyAsync(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -499,6 +609,16 @@ void AutoScalingClient::DeletePolicyAsync(const DeletePolicyRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DeletePolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeletePolicyOutcomeCallable AutoScalingClient::DeletePolicyCallable(DeletePolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DeletePolicy, this, std::move(request)));
+}
+
+void AutoScalingClient::DeletePolicyAsync(DeletePolicyRequest&& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DeletePolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DeletePolicyAsyncHelper(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeletePolicy(request), context);
@@ -521,7 +641,7 @@ DeleteScheduledActionOutcome AutoScalingClient::DeleteScheduledAction(const Dele
 
 DeleteScheduledActionOutcomeCallable AutoScalingClient::DeleteScheduledActionCallable(const DeleteScheduledActionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteScheduledAction( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteScheduledAction( request ); } );
 }
 
 void AutoScalingClient::DeleteScheduledActionAsync(const DeleteScheduledActionRequest& request, const DeleteScheduledActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -529,6 +649,16 @@ void AutoScalingClient::DeleteScheduledActionAsync(const DeleteScheduledActionRe
   m_executor->Submit( [this, request, handler, context](){ this->DeleteScheduledActionAsyncHelper( request, handler, context ); } );
 }
 
+DeleteScheduledActionOutcomeCallable AutoScalingClient::DeleteScheduledActionCallable(DeleteScheduledActionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DeleteScheduledAction, this, std::move(request)));
+}
+
+void AutoScalingClient::DeleteScheduledActionAsync(DeleteScheduledActionRequest&& request, const DeleteScheduledActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DeleteScheduledActionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DeleteScheduledActionAsyncHelper(const DeleteScheduledActionRequest& request, const DeleteScheduledActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteScheduledAction(request), context);
@@ -551,7 +681,7 @@ DeleteTagsOutcome AutoScalingClient::DeleteTags(const DeleteTagsRequest& request
 
 DeleteTagsOutcomeCallable AutoScalingClient::DeleteTagsCallable(const DeleteTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTags( request ); } );
 }
 
 void AutoScalingClient::DeleteTagsAsync(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -559,6 +689,16 @@ void AutoScalingClient::DeleteTagsAsync(const DeleteTagsRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTagsAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTagsOutcomeCallable AutoScalingClient::DeleteTagsCallable(DeleteTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DeleteTags, this, std::move(request)));
+}
+
+void AutoScalingClient::DeleteTagsAsync(DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DeleteTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DeleteTagsAsyncHelper(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTags(request), context);
@@ -581,7 +721,7 @@ DescribeAccountLimitsOutcome AutoScalingClient::DescribeAccountLimits(const Desc
 
 DescribeAccountLimitsOutcomeCallable AutoScalingClient::DescribeAccountLimitsCallable(const DescribeAccountLimitsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAccountLimits( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAccountLimits( request ); } );
 }
 
 void AutoScalingClient::DescribeAccountLimitsAsync(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -589,6 +729,16 @@ void AutoScalingClient::DescribeAccountLimitsAsync(const DescribeAccountLimitsRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAccountLimitsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAccountLimitsOutcomeCallable AutoScalingClient::DescribeAccountLimitsCallable(DescribeAccountLimitsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeAccountLimits, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeAccountLimitsAsync(DescribeAccountLimitsRequest&& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeAccountLimitsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeAccountLimitsAsyncHelper(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAccountLimits(request), context);
@@ -611,7 +761,7 @@ DescribeAdjustmentTypesOutcome AutoScalingClient::DescribeAdjustmentTypes(const
 
 DescribeAdjustmentTypesOutcomeCallable AutoScalingClient::DescribeAdjustmentTypesCallable(const DescribeAdjustmentTypesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAdjustmentTypes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAdjustmentTypes( request ); } );
 }
 
 void AutoScalingClient::DescribeAdjustmentTypesAsync(const DescribeAdjustmentTypesRequest& request, const DescribeAdjustmentTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -619,6 +769,16 @@ void AutoScalingClient::DescribeAdjustmentTypesAsync(const DescribeAdjustmentTyp
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAdjustmentTypesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAdjustmentTypesOutcomeCallable AutoScalingClient::DescribeAdjustmentTypesCallable(DescribeAdjustmentTypesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeAdjustmentTypes, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeAdjustmentTypesAsync(DescribeAdjustmentTypesRequest&& request, const DescribeAdjustmentTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeAdjustmentTypesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeAdjustmentTypesAsyncHelper(const DescribeAdjustmentTypesRequest& request, const DescribeAdjustmentTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAdjustmentTypes(request), context);
@@ -641,7 +801,7 @@ DescribeAutoScalingGroupsOutcome AutoScalingClient::DescribeAutoScalingGroups(co
 
 DescribeAutoScalingGroupsOutcomeCallable AutoScalingClient::DescribeAutoScalingGroupsCallable(const DescribeAutoScalingGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAutoScalingGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAutoScalingGroups( request ); } );
 }
 
 void AutoScalingClient::DescribeAutoScalingGroupsAsync(const DescribeAutoScalingGroupsRequest& request, const DescribeAutoScalingGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -649,6 +809,16 @@ void AutoScalingClient::DescribeAutoScalingGroupsAsync(const DescribeAutoScaling
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAutoScalingGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAutoScalingGroupsOutcomeCallable AutoScalingClient::DescribeAutoScalingGroupsCallable(DescribeAutoScalingGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeAutoScalingGroups, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeAutoScalingGroupsAsync(DescribeAutoScalingGroupsRequest&& request, const DescribeAutoScalingGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeAutoScalingGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeAutoScalingGroupsAsyncHelper(const DescribeAutoScalingGroupsRequest& request, const DescribeAutoScalingGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAutoScalingGroups(request), context);
@@ -671,7 +841,7 @@ DescribeAutoScalingInstancesOutcome AutoScalingClient::DescribeAutoScalingInstan
 
 DescribeAutoScalingInstancesOutcomeCallable AutoScalingClient::DescribeAutoScalingInstancesCallable(const DescribeAutoScalingInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAutoScalingInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAutoScalingInstances( request ); } );
 }
 
 void AutoScalingClient::DescribeAutoScalingInstancesAsync(const DescribeAutoScalingInstancesRequest& request, const DescribeAutoScalingInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -679,6 +849,16 @@ void AutoScalingClient::DescribeAutoScalingInstancesAsync(const DescribeAutoScal
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAutoScalingInstancesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAutoScalingInstancesOutcomeCallable AutoScalingClient::DescribeAutoScalingInstancesCallable(DescribeAutoScalingInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeAutoScalingInstances, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeAutoScalingInstancesAsync(DescribeAutoScalingInstancesRequest&& request, const DescribeAutoScalingInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeAutoScalingInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeAutoScalingInstancesAsyncHelper(const DescribeAutoScalingInstancesRequest& request, const DescribeAutoScalingInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAutoScalingInstances(request), context);
@@ -701,7 +881,7 @@ DescribeAutoScalingNotificationTypesOutcome AutoScalingClient::DescribeAutoScali
 
 DescribeAutoScalingNotificationTypesOutcomeCallable AutoScalingClient::DescribeAutoScalingNotificationTypesCallable(const DescribeAutoScalingNotificationTypesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAutoScalingNotificationTypes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAutoScalingNotificationTypes( request ); } );
 }
 
 void AutoScalingClient::DescribeAutoScalingNotificationTypesAsync(const DescribeAutoScalingNotificationTypesRequest& request, const DescribeAutoScalingNotificationTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -709,6 +889,16 @@ void AutoScalingClient::DescribeAutoScalingNotificationTypesAsync(const Describe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAutoScalingNotificationTypesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAutoScalingNotificationTypesOutcomeCallable AutoScalingClient::DescribeAutoScalingNotificationTypesCallable(DescribeAutoScalingNotificationTypesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeAutoScalingNotificationTypes, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeAutoScalingNotificationTypesAsync(DescribeAutoScalingNotificationTypesRequest&& request, const DescribeAutoScalingNotificationTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeAutoScalingNotificationTypesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeAutoScalingNotificationTypesAsyncHelper(const DescribeAutoScalingNotificationTypesRequest& request, const DescribeAutoScalingNotificationTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAutoScalingNotificationTypes(request), context);
@@ -731,7 +921,7 @@ DescribeLaunchConfigurationsOutcome AutoScalingClient::DescribeLaunchConfigurati
 
 DescribeLaunchConfigurationsOutcomeCallable AutoScalingClient::DescribeLaunchConfigurationsCallable(const DescribeLaunchConfigurationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLaunchConfigurations( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLaunchConfigurations( request ); } );
 }
 
 void AutoScalingClient::DescribeLaunchConfigurationsAsync(const DescribeLaunchConfigurationsRequest& request, const DescribeLaunchConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -739,6 +929,16 @@ void AutoScalingClient::DescribeLaunchConfigurationsAsync(const DescribeLaunchCo
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLaunchConfigurationsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLaunchConfigurationsOutcomeCallable AutoScalingClient::DescribeLaunchConfigurationsCallable(DescribeLaunchConfigurationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeLaunchConfigurations, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeLaunchConfigurationsAsync(DescribeLaunchConfigurationsRequest&& request, const DescribeLaunchConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeLaunchConfigurationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeLaunchConfigurationsAsyncHelper(const DescribeLaunchConfigurationsRequest& request, const DescribeLaunchConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLaunchConfigurations(request), context);
@@ -761,7 +961,7 @@ DescribeLifecycleHookTypesOutcome AutoScalingClient::DescribeLifecycleHookTypes(
 
 DescribeLifecycleHookTypesOutcomeCallable AutoScalingClient::DescribeLifecycleHookTypesCallable(const DescribeLifecycleHookTypesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLifecycleHookTypes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLifecycleHookTypes( request ); } );
 }
 
 void AutoScalingClient::DescribeLifecycleHookTypesAsync(const DescribeLifecycleHookTypesRequest& request, const DescribeLifecycleHookTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -769,6 +969,16 @@ void AutoScalingClient::DescribeLifecycleHookTypesAsync(const DescribeLifecycleH
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLifecycleHookTypesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLifecycleHookTypesOutcomeCallable AutoScalingClient::DescribeLifecycleHookTypesCallable(DescribeLifecycleHookTypesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeLifecycleHookTypes, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeLifecycleHookTypesAsync(DescribeLifecycleHookTypesRequest&& request, const DescribeLifecycleHookTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeLifecycleHookTypesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeLifecycleHookTypesAsyncHelper(const DescribeLifecycleHookTypesRequest& request, const DescribeLifecycleHookTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLifecycleHookTypes(request), context);
@@ -791,7 +1001,7 @@ DescribeLifecycleHooksOutcome AutoScalingClient::DescribeLifecycleHooks(const De
 
 DescribeLifecycleHooksOutcomeCallable AutoScalingClient::DescribeLifecycleHooksCallable(const DescribeLifecycleHooksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLifecycleHooks( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLifecycleHooks( request ); } );
 }
 
 void AutoScalingClient::DescribeLifecycleHooksAsync(const DescribeLifecycleHooksRequest& request, const DescribeLifecycleHooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -799,6 +1009,16 @@ void AutoScalingClient::DescribeLifecycleHooksAsync(const DescribeLifecycleHooks
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLifecycleHooksAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLifecycleHooksOutcomeCallable AutoScalingClient::DescribeLifecycleHooksCallable(DescribeLifecycleHooksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeLifecycleHooks, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeLifecycleHooksAsync(DescribeLifecycleHooksRequest&& request, const DescribeLifecycleHooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeLifecycleHooksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeLifecycleHooksAsyncHelper(const DescribeLifecycleHooksRequest& request, const DescribeLifecycleHooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLifecycleHooks(request), context);
@@ -821,7 +1041,7 @@ DescribeLoadBalancerTargetGroupsOutcome AutoScalingClient::DescribeLoadBalancerT
 
 DescribeLoadBalancerTargetGroupsOutcomeCallable AutoScalingClient::DescribeLoadBalancerTargetGroupsCallable(const DescribeLoadBalancerTargetGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLoadBalancerTargetGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLoadBalancerTargetGroups( request ); } );
 }
 
 void AutoScalingClient::DescribeLoadBalancerTargetGroupsAsync(const DescribeLoadBalancerTargetGroupsRequest& request, const DescribeLoadBalancerTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -829,6 +1049,16 @@ void AutoScalingClient::DescribeLoadBalancerTargetGroupsAsync(const DescribeLoad
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLoadBalancerTargetGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLoadBalancerTargetGroupsOutcomeCallable AutoScalingClient::DescribeLoadBalancerTargetGroupsCallable(DescribeLoadBalancerTargetGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeLoadBalancerTargetGroups, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeLoadBalancerTargetGroupsAsync(DescribeLoadBalancerTargetGroupsRequest&& request, const DescribeLoadBalancerTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeLoadBalancerTargetGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeLoadBalancerTargetGroupsAsyncHelper(const DescribeLoadBalancerTargetGroupsRequest& request, const DescribeLoadBalancerTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLoadBalancerTargetGroups(request), context);
@@ -851,7 +1081,7 @@ DescribeLoadBalancersOutcome AutoScalingClient::DescribeLoadBalancers(const Desc
 
 DescribeLoadBalancersOutcomeCallable AutoScalingClient::DescribeLoadBalancersCallable(const DescribeLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLoadBalancers( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLoadBalancers( request ); } );
 }
 
 void AutoScalingClient::DescribeLoadBalancersAsync(const DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -859,6 +1089,16 @@ void AutoScalingClient::DescribeLoadBalancersAsync(const DescribeLoadBalancersRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLoadBalancersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLoadBalancersOutcomeCallable AutoScalingClient::DescribeLoadBalancersCallable(DescribeLoadBalancersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeLoadBalancers, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeLoadBalancersAsync(DescribeLoadBalancersRequest&& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeLoadBalancersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeLoadBalancersAsyncHelper(const DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLoadBalancers(request), context);
@@ -881,7 +1121,7 @@ DescribeMetricCollectionTypesOutcome AutoScalingClient::DescribeMetricCollection
 
 DescribeMetricCollectionTypesOutcomeCallable AutoScalingClient::DescribeMetricCollectionTypesCallable(const DescribeMetricCollectionTypesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeMetricCollectionTypes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeMetricCollectionTypes( request ); } );
 }
 
 void AutoScalingClient::DescribeMetricCollectionTypesAsync(const DescribeMetricCollectionTypesRequest& request, const DescribeMetricCollectionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -889,6 +1129,16 @@ void AutoScalingClient::DescribeMetricCollectionTypesAsync(const DescribeMetricC
   m_executor->Submit( [this, request, handler, context](){ this->DescribeMetricCollectionTypesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeMetricCollectionTypesOutcomeCallable AutoScalingClient::DescribeMetricCollectionTypesCallable(DescribeMetricCollectionTypesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeMetricCollectionTypes, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeMetricCollectionTypesAsync(DescribeMetricCollectionTypesRequest&& request, const DescribeMetricCollectionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeMetricCollectionTypesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeMetricCollectionTypesAsyncHelper(const DescribeMetricCollectionTypesRequest& request, const DescribeMetricCollectionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeMetricCollectionTypes(request), context);
@@ -911,7 +1161,7 @@ DescribeNotificationConfigurationsOutcome AutoScalingClient::DescribeNotificatio
 
 DescribeNotificationConfigurationsOutcomeCallable AutoScalingClient::DescribeNotificationConfigurationsCallable(const DescribeNotificationConfigurationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeNotificationConfigurations( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeNotificationConfigurations( request ); } );
 }
 
 void AutoScalingClient::DescribeNotificationConfigurationsAsync(const DescribeNotificationConfigurationsRequest& request, const DescribeNotificationConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -919,6 +1169,16 @@ void AutoScalingClient::DescribeNotificationConfigurationsAsync(const DescribeNo
   m_executor->Submit( [this, request, handler, context](){ this->DescribeNotificationConfigurationsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeNotificationConfigurationsOutcomeCallable AutoScalingClient::DescribeNotificationConfigurationsCallable(DescribeNotificationConfigurationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeNotificationConfigurations, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeNotificationConfigurationsAsync(DescribeNotificationConfigurationsRequest&& request, const DescribeNotificationConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeNotificationConfigurationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeNotificationConfigurationsAsyncHelper(const DescribeNotificationConfigurationsRequest& request, const DescribeNotificationConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeNotificationConfigurations(request), context);
@@ -941,7 +1201,7 @@ DescribePoliciesOutcome AutoScalingClient::DescribePolicies(const DescribePolici
 
 DescribePoliciesOutcomeCallable AutoScalingClient::DescribePoliciesCallable(const DescribePoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribePolicies( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribePolicies( request ); } );
 }
 
 void AutoScalingClient::DescribePoliciesAsync(const DescribePoliciesRequest& request, const DescribePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -949,6 +1209,16 @@ void AutoScalingClient::DescribePoliciesAsync(const DescribePoliciesRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DescribePoliciesAsyncHelper( request, handler, context ); } );
 }
 
+DescribePoliciesOutcomeCallable AutoScalingClient::DescribePoliciesCallable(DescribePoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribePolicies, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribePoliciesAsync(DescribePoliciesRequest&& request, const DescribePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribePoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribePoliciesAsyncHelper(const DescribePoliciesRequest& request, const DescribePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribePolicies(request), context);
@@ -971,7 +1241,7 @@ DescribeScalingActivitiesOutcome AutoScalingClient::DescribeScalingActivities(co
 
 DescribeScalingActivitiesOutcomeCallable AutoScalingClient::DescribeScalingActivitiesCallable(const DescribeScalingActivitiesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeScalingActivities( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeScalingActivities( request ); } );
 }
 
 void AutoScalingClient::DescribeScalingActivitiesAsync(const DescribeScalingActivitiesRequest& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -979,6 +1249,16 @@ void AutoScalingClient::DescribeScalingActivitiesAsync(const DescribeScalingActi
   m_executor->Submit( [this, request, handler, context](){ this->DescribeScalingActivitiesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeScalingActivitiesOutcomeCallable AutoScalingClient::DescribeScalingActivitiesCallable(DescribeScalingActivitiesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeScalingActivities, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeScalingActivitiesAsync(DescribeScalingActivitiesRequest&& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeScalingActivitiesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeScalingActivitiesAsyncHelper(const DescribeScalingActivitiesRequest& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeScalingActivities(request), context);
@@ -1001,7 +1281,7 @@ DescribeScalingProcessTypesOutcome AutoScalingClient::DescribeScalingProcessType
 
 DescribeScalingProcessTypesOutcomeCallable AutoScalingClient::DescribeScalingProcessTypesCallable(const DescribeScalingProcessTypesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeScalingProcessTypes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeScalingProcessTypes( request ); } );
 }
 
 void AutoScalingClient::DescribeScalingProcessTypesAsync(const DescribeScalingProcessTypesRequest& request, const DescribeScalingProcessTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1009,6 +1289,16 @@ void AutoScalingClient::DescribeScalingProcessTypesAsync(const DescribeScalingPr
   m_executor->Submit( [this, request, handler, context](){ this->DescribeScalingProcessTypesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeScalingProcessTypesOutcomeCallable AutoScalingClient::DescribeScalingProcessTypesCallable(DescribeScalingProcessTypesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeScalingProcessTypes, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeScalingProcessTypesAsync(DescribeScalingProcessTypesRequest&& request, const DescribeScalingProcessTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeScalingProcessTypesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeScalingProcessTypesAsyncHelper(const DescribeScalingProcessTypesRequest& request, const DescribeScalingProcessTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeScalingProcessTypes(request), context);
@@ -1031,7 +1321,7 @@ DescribeScheduledActionsOutcome AutoScalingClient::DescribeScheduledActions(cons
 
 DescribeScheduledActionsOutcomeCallable AutoScalingClient::DescribeScheduledActionsCallable(const DescribeScheduledActionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeScheduledActions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeScheduledActions( request ); } );
 }
 
 void AutoScalingClient::DescribeScheduledActionsAsync(const DescribeScheduledActionsRequest& request, const DescribeScheduledActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1039,6 +1329,16 @@ void AutoScalingClient::DescribeScheduledActionsAsync(const DescribeScheduledAct
   m_executor->Submit( [this, request, handler, context](){ this->DescribeScheduledActionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeScheduledActionsOutcomeCallable AutoScalingClient::DescribeScheduledActionsCallable(DescribeScheduledActionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeScheduledActions, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeScheduledActionsAsync(DescribeScheduledActionsRequest&& request, const DescribeScheduledActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeScheduledActionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeScheduledActionsAsyncHelper(const DescribeScheduledActionsRequest& request, const DescribeScheduledActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeScheduledActions(request), context);
@@ -1061,7 +1361,7 @@ DescribeTagsOutcome AutoScalingClient::DescribeTags(const DescribeTagsRequest& r
 
 DescribeTagsOutcomeCallable AutoScalingClient::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTags( request ); } );
 }
 
 void AutoScalingClient::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1069,6 +1369,16 @@ void AutoScalingClient::DescribeTagsAsync(const DescribeTagsRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTagsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTagsOutcomeCallable AutoScalingClient::DescribeTagsCallable(DescribeTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeTags, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeTagsAsync(DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTags(request), context);
@@ -1091,7 +1401,7 @@ DescribeTerminationPolicyTypesOutcome AutoScalingClient::DescribeTerminationPoli
 
 DescribeTerminationPolicyTypesOutcomeCallable AutoScalingClient::DescribeTerminationPolicyTypesCallable(const DescribeTerminationPolicyTypesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTerminationPolicyTypes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTerminationPolicyTypes( request ); } );
 }
 
 void AutoScalingClient::DescribeTerminationPolicyTypesAsync(const DescribeTerminationPolicyTypesRequest& request, const DescribeTerminationPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1099,6 +1409,16 @@ void AutoScalingClient::DescribeTerminationPolicyTypesAsync(const DescribeTermin
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTerminationPolicyTypesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTerminationPolicyTypesOutcomeCallable AutoScalingClient::DescribeTerminationPolicyTypesCallable(DescribeTerminationPolicyTypesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DescribeTerminationPolicyTypes, this, std::move(request)));
+}
+
+void AutoScalingClient::DescribeTerminationPolicyTypesAsync(DescribeTerminationPolicyTypesRequest&& request, const DescribeTerminationPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DescribeTerminationPolicyTypesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DescribeTerminationPolicyTypesAsyncHelper(const DescribeTerminationPolicyTypesRequest& request, const DescribeTerminationPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTerminationPolicyTypes(request), context);
@@ -1121,7 +1441,7 @@ DetachInstancesOutcome AutoScalingClient::DetachInstances(const DetachInstancesR
 
 DetachInstancesOutcomeCallable AutoScalingClient::DetachInstancesCallable(const DetachInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachInstances( request ); } );
 }
 
 void AutoScalingClient::DetachInstancesAsync(const DetachInstancesRequest& request, const DetachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1129,6 +1449,16 @@ void AutoScalingClient::DetachInstancesAsync(const DetachInstancesRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DetachInstancesAsyncHelper( request, handler, context ); } );
 }
 
+DetachInstancesOutcomeCallable AutoScalingClient::DetachInstancesCallable(DetachInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DetachInstances, this, std::move(request)));
+}
+
+void AutoScalingClient::DetachInstancesAsync(DetachInstancesRequest&& request, const DetachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DetachInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DetachInstancesAsyncHelper(const DetachInstancesRequest& request, const DetachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachInstances(request), context);
@@ -1151,7 +1481,7 @@ DetachLoadBalancerTargetGroupsOutcome AutoScalingClient::DetachLoadBalancerTarge
 
 DetachLoadBalancerTargetGroupsOutcomeCallable AutoScalingClient::DetachLoadBalancerTargetGroupsCallable(const DetachLoadBalancerTargetGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachLoadBalancerTargetGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachLoadBalancerTargetGroups( request ); } );
 }
 
 void AutoScalingClient::DetachLoadBalancerTargetGroupsAsync(const DetachLoadBalancerTargetGroupsRequest& request, const DetachLoadBalancerTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1159,6 +1489,16 @@ void AutoScalingClient::DetachLoadBalancerTargetGroupsAsync(const DetachLoadBala
   m_executor->Submit( [this, request, handler, context](){ this->DetachLoadBalancerTargetGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DetachLoadBalancerTargetGroupsOutcomeCallable AutoScalingClient::DetachLoadBalancerTargetGroupsCallable(DetachLoadBalancerTargetGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DetachLoadBalancerTargetGroups, this, std::move(request)));
+}
+
+void AutoScalingClient::DetachLoadBalancerTargetGroupsAsync(DetachLoadBalancerTargetGroupsRequest&& request, const DetachLoadBalancerTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DetachLoadBalancerTargetGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DetachLoadBalancerTargetGroupsAsyncHelper(const DetachLoadBalancerTargetGroupsRequest& request, const DetachLoadBalancerTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachLoadBalancerTargetGroups(request), context);
@@ -1181,7 +1521,7 @@ DetachLoadBalancersOutcome AutoScalingClient::DetachLoadBalancers(const DetachLo
 
 DetachLoadBalancersOutcomeCallable AutoScalingClient::DetachLoadBalancersCallable(const DetachLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachLoadBalancers( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachLoadBalancers( request ); } );
 }
 
 void AutoScalingClient::DetachLoadBalancersAsync(const DetachLoadBalancersRequest& request, const DetachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1189,6 +1529,16 @@ void AutoScalingClient::DetachLoadBalancersAsync(const DetachLoadBalancersReques
   m_executor->Submit( [this, request, handler, context](){ this->DetachLoadBalancersAsyncHelper( request, handler, context ); } );
 }
 
+DetachLoadBalancersOutcomeCallable AutoScalingClient::DetachLoadBalancersCallable(DetachLoadBalancersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DetachLoadBalancers, this, std::move(request)));
+}
+
+void AutoScalingClient::DetachLoadBalancersAsync(DetachLoadBalancersRequest&& request, const DetachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DetachLoadBalancersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DetachLoadBalancersAsyncHelper(const DetachLoadBalancersRequest& request, const DetachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachLoadBalancers(request), context);
@@ -1211,7 +1561,7 @@ DisableMetricsCollectionOutcome AutoScalingClient::DisableMetricsCollection(cons
 
 DisableMetricsCollectionOutcomeCallable AutoScalingClient::DisableMetricsCollectionCallable(const DisableMetricsCollectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableMetricsCollection( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableMetricsCollection( request ); } );
 }
 
 void AutoScalingClient::DisableMetricsCollectionAsync(const DisableMetricsCollectionRequest& request, const DisableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1219,6 +1569,16 @@ void AutoScalingClient::DisableMetricsCollectionAsync(const DisableMetricsCollec
   m_executor->Submit( [this, request, handler, context](){ this->DisableMetricsCollectionAsyncHelper( request, handler, context ); } );
 }
 
+DisableMetricsCollectionOutcomeCallable AutoScalingClient::DisableMetricsCollectionCallable(DisableMetricsCollectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::DisableMetricsCollection, this, std::move(request)));
+}
+
+void AutoScalingClient::DisableMetricsCollectionAsync(DisableMetricsCollectionRequest&& request, const DisableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::DisableMetricsCollectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::DisableMetricsCollectionAsyncHelper(const DisableMetricsCollectionRequest& request, const DisableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableMetricsCollection(request), context);
@@ -1241,7 +1601,7 @@ EnableMetricsCollectionOutcome AutoScalingClient::EnableMetricsCollection(const
 
 EnableMetricsCollectionOutcomeCallable AutoScalingClient::EnableMetricsCollectionCallable(const EnableMetricsCollectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableMetricsCollection( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableMetricsCollection( request ); } );
 }
 
 void AutoScalingClient::EnableMetricsCollectionAsync(const EnableMetricsCollectionRequest& request, const EnableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1249,6 +1609,16 @@ void AutoScalingClient::EnableMetricsCollectionAsync(const EnableMetricsCollecti
   m_executor->Submit( [this, request, handler, context](){ this->EnableMetricsCollectionAsyncHelper( request, handler, context ); } );
 }
 
+EnableMetricsCollectionOutcomeCallable AutoScalingClient::EnableMetricsCollectionCallable(EnableMetricsCollectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::EnableMetricsCollection, this, std::move(request)));
+}
+
+void AutoScalingClient::EnableMetricsCollectionAsync(EnableMetricsCollectionRequest&& request, const EnableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::EnableMetricsCollectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::EnableMetricsCollectionAsyncHelper(const EnableMetricsCollectionRequest& request, const EnableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableMetricsCollection(request), context);
@@ -1271,7 +1641,7 @@ EnterStandbyOutcome AutoScalingClient::EnterStandby(const EnterStandbyRequest& r
 
 EnterStandbyOutcomeCallable AutoScalingClient::EnterStandbyCallable(const EnterStandbyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnterStandby( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnterStandby( request ); } );
 }
 
 void AutoScalingClient::EnterStandbyAsync(const EnterStandbyRequest& request, const EnterStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1279,6 +1649,16 @@ void AutoScalingClient::EnterStandbyAsync(const EnterStandbyRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->EnterStandbyAsyncHelper( request, handler, context ); } );
 }
 
+EnterStandbyOutcomeCallable AutoScalingClient::EnterStandbyCallable(EnterStandbyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::EnterStandby, this, std::move(request)));
+}
+
+void AutoScalingClient::EnterStandbyAsync(EnterStandbyRequest&& request, const EnterStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::EnterStandbyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::EnterStandbyAsyncHelper(const EnterStandbyRequest& request, const EnterStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnterStandby(request), context);
@@ -1301,7 +1681,7 @@ ExecutePolicyOutcome AutoScalingClient::ExecutePolicy(const ExecutePolicyRequest
 
 ExecutePolicyOutcomeCallable AutoScalingClient::ExecutePolicyCallable(const ExecutePolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ExecutePolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ExecutePolicy( request ); } );
 }
 
 void AutoScalingClient::ExecutePolicyAsync(const ExecutePolicyRequest& request, const ExecutePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1309,6 +1689,16 @@ void AutoScalingClient::ExecutePolicyAsync(const ExecutePolicyRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ExecutePolicyAsyncHelper( request, handler, context ); } );
 }
 
+ExecutePolicyOutcomeCallable AutoScalingClient::ExecutePolicyCallable(ExecutePolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::ExecutePolicy, this, std::move(request)));
+}
+
+void AutoScalingClient::ExecutePolicyAsync(ExecutePolicyRequest&& request, const ExecutePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::ExecutePolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::ExecutePolicyAsyncHelper(const ExecutePolicyRequest& request, const ExecutePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ExecutePolicy(request), context);
@@ -1331,7 +1721,7 @@ ExitStandbyOutcome AutoScalingClient::ExitStandby(const ExitStandbyRequest& requ
 
 ExitStandbyOutcomeCallable AutoScalingClient::ExitStandbyCallable(const ExitStandbyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ExitStandby( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ExitStandby( request ); } );
 }
 
 void AutoScalingClient::ExitStandbyAsync(const ExitStandbyRequest& request, const ExitStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1339,6 +1729,16 @@ void AutoScalingClient::ExitStandbyAsync(const ExitStandbyRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->ExitStandbyAsyncHelper( request, handler, context ); } );
 }
 
+ExitStandbyOutcomeCallable AutoScalingClient::ExitStandbyCallable(ExitStandbyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::ExitStandby, this, std::move(request)));
+}
+
+void AutoScalingClient::ExitStandbyAsync(ExitStandbyRequest&& request, const ExitStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::ExitStandbyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::ExitStandbyAsyncHelper(const ExitStandbyRequest& request, const ExitStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ExitStandby(request), context);
@@ -1361,7 +1761,7 @@ PutLifecycleHookOutcome AutoScalingClient::PutLifecycleHook(const PutLifecycleHo
 
 PutLifecycleHookOutcomeCallable AutoScalingClient::PutLifecycleHookCallable(const PutLifecycleHookRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutLifecycleHook( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutLifecycleHook( request ); } );
 }
 
 void AutoScalingClient::PutLifecycleHookAsync(const PutLifecycleHookRequest& request, const PutLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1369,6 +1769,16 @@ void AutoScalingClient::PutLifecycleHookAsync(const PutLifecycleHookRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->PutLifecycleHookAsyncHelper( request, handler, context ); } );
 }
 
+PutLifecycleHookOutcomeCallable AutoScalingClient::PutLifecycleHookCallable(PutLifecycleHookRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::PutLifecycleHook, this, std::move(request)));
+}
+
+void AutoScalingClient::PutLifecycleHookAsync(PutLifecycleHookRequest&& request, const PutLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::PutLifecycleHookAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::PutLifecycleHookAsyncHelper(const PutLifecycleHookRequest& request, const PutLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutLifecycleHook(request), context);
@@ -1391,7 +1801,7 @@ PutNotificationConfigurationOutcome AutoScalingClient::PutNotificationConfigurat
 
 PutNotificationConfigurationOutcomeCallable AutoScalingClient::PutNotificationConfigurationCallable(const PutNotificationConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutNotificationConfiguration( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutNotificationConfiguration( request ); } );
 }
 
 void AutoScalingClient::PutNotificationConfigurationAsync(const PutNotificationConfigurationRequest& request, const PutNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1399,6 +1809,16 @@ void AutoScalingClient::PutNotificationConfigurationAsync(const PutNotificationC
   m_executor->Submit( [this, request, handler, context](){ this->PutNotificationConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+PutNotificationConfigurationOutcomeCallable AutoScalingClient::PutNotificationConfigurationCallable(PutNotificationConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::PutNotificationConfiguration, this, std::move(request)));
+}
+
+void AutoScalingClient::PutNotificationConfigurationAsync(PutNotificationConfigurationRequest&& request, const PutNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::PutNotificationConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::PutNotificationConfigurationAsyncHelper(const PutNotificationConfigurationRequest& request, const PutNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutNotificationConfiguration(request), context);
@@ -1421,7 +1841,7 @@ PutScalingPolicyOutcome AutoScalingClient::PutScalingPolicy(const PutScalingPoli
 
 PutScalingPolicyOutcomeCallable AutoScalingClient::PutScalingPolicyCallable(const PutScalingPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutScalingPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutScalingPolicy( request ); } );
 }
 
 void AutoScalingClient::PutScalingPolicyAsync(const PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1429,6 +1849,16 @@ void AutoScalingClient::PutScalingPolicyAsync(const PutScalingPolicyRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->PutScalingPolicyAsyncHelper( request, handler, context ); } );
 }
 
+PutScalingPolicyOutcomeCallable AutoScalingClient::PutScalingPolicyCallable(PutScalingPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::PutScalingPolicy, this, std::move(request)));
+}
+
+void AutoScalingClient::PutScalingPolicyAsync(PutScalingPolicyRequest&& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::PutScalingPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::PutScalingPolicyAsyncHelper(const PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutScalingPolicy(request), context);
@@ -1451,7 +1881,7 @@ PutScheduledUpdateGroupActionOutcome AutoScalingClient::PutScheduledUpdateGroupA
 
 PutScheduledUpdateGroupActionOutcomeCallable AutoScalingClient::PutScheduledUpdateGroupActionCallable(const PutScheduledUpdateGroupActionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutScheduledUpdateGroupAction( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutScheduledUpdateGroupAction( request ); } );
 }
 
 void AutoScalingClient::PutScheduledUpdateGroupActionAsync(const PutScheduledUpdateGroupActionRequest& request, const PutScheduledUpdateGroupActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1459,6 +1889,16 @@ void AutoScalingClient::PutScheduledUpdateGroupActionAsync(const PutScheduledUpd
   m_executor->Submit( [this, request, handler, context](){ this->PutScheduledUpdateGroupActionAsyncHelper( request, handler, context ); } );
 }
 
+PutScheduledUpdateGroupActionOutcomeCallable AutoScalingClient::PutScheduledUpdateGroupActionCallable(PutScheduledUpdateGroupActionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::PutScheduledUpdateGroupAction, this, std::move(request)));
+}
+
+void AutoScalingClient::PutScheduledUpdateGroupActionAsync(PutScheduledUpdateGroupActionRequest&& request, const PutScheduledUpdateGroupActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::PutScheduledUpdateGroupActionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::PutScheduledUpdateGroupActionAsyncHelper(const PutScheduledUpdateGroupActionRequest& request, const PutScheduledUpdateGroupActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutScheduledUpdateGroupAction(request), context);
@@ -1481,7 +1921,7 @@ RecordLifecycleActionHeartbeatOutcome AutoScalingClient::RecordLifecycleActionHe
 
 RecordLifecycleActionHeartbeatOutcomeCallable AutoScalingClient::RecordLifecycleActionHeartbeatCallable(const RecordLifecycleActionHeartbeatRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RecordLifecycleActionHeartbeat( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RecordLifecycleActionHeartbeat( request ); } );
 }
 
 void AutoScalingClient::RecordLifecycleActionHeartbeatAsync(const RecordLifecycleActionHeartbeatRequest& request, const RecordLifecycleActionHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1489,6 +1929,16 @@ void AutoScalingClient::RecordLifecycleActionHeartbeatAsync(const RecordLifecycl
   m_executor->Submit( [this, request, handler, context](){ this->RecordLifecycleActionHeartbeatAsyncHelper( request, handler, context ); } );
 }
 
+RecordLifecycleActionHeartbeatOutcomeCallable AutoScalingClient::RecordLifecycleActionHeartbeatCallable(RecordLifecycleActionHeartbeatRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::RecordLifecycleActionHeartbeat, this, std::move(request)));
+}
+
+void AutoScalingClient::RecordLifecycleActionHeartbeatAsync(RecordLifecycleActionHeartbeatRequest&& request, const RecordLifecycleActionHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::RecordLifecycleActionHeartbeatAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::RecordLifecycleActionHeartbeatAsyncHelper(const RecordLifecycleActionHeartbeatRequest& request, const RecordLifecycleActionHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RecordLifecycleActionHeartbeat(request), context);
@@ -1511,7 +1961,7 @@ ResumeProcessesOutcome AutoScalingClient::ResumeProcesses(const ResumeProcessesR
 
 ResumeProcessesOutcomeCallable AutoScalingClient::ResumeProcessesCallable(const ResumeProcessesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResumeProcesses( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResumeProcesses( request ); } );
 }
 
 void AutoScalingClient::ResumeProcessesAsync(const ResumeProcessesRequest& request, const ResumeProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1519,6 +1969,16 @@ void AutoScalingClient::ResumeProcessesAsync(const ResumeProcessesRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ResumeProcessesAsyncHelper( request, handler, context ); } );
 }
 
+ResumeProcessesOutcomeCallable AutoScalingClient::ResumeProcessesCallable(ResumeProcessesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::ResumeProcesses, this, std::move(request)));
+}
+
+void AutoScalingClient::ResumeProcessesAsync(ResumeProcessesRequest&& request, const ResumeProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::ResumeProcessesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::ResumeProcessesAsyncHelper(const ResumeProcessesRequest& request, const ResumeProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResumeProcesses(request), context);
@@ -1541,7 +2001,7 @@ SetDesiredCapacityOutcome AutoScalingClient::SetDesiredCapacity(const SetDesired
 
 SetDesiredCapacityOutcomeCallable AutoScalingClient::SetDesiredCapacityCallable(const SetDesiredCapacityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetDesiredCapacity( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetDesiredCapacity( request ); } );
 }
 
 void AutoScalingClient::SetDesiredCapacityAsync(const SetDesiredCapacityRequest& request, const SetDesiredCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1549,6 +2009,16 @@ void AutoScalingClient::SetDesiredCapacityAsync(const SetDesiredCapacityRequest&
   m_executor->Submit( [this, request, handler, context](){ this->SetDesiredCapacityAsyncHelper( request, handler, context ); } );
 }
 
+SetDesiredCapacityOutcomeCallable AutoScalingClient::SetDesiredCapacityCallable(SetDesiredCapacityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::SetDesiredCapacity, this, std::move(request)));
+}
+
+void AutoScalingClient::SetDesiredCapacityAsync(SetDesiredCapacityRequest&& request, const SetDesiredCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::SetDesiredCapacityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::SetDesiredCapacityAsyncHelper(const SetDesiredCapacityRequest& request, const SetDesiredCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetDesiredCapacity(request), context);
@@ -1571,7 +2041,7 @@ SetInstanceHealthOutcome AutoScalingClient::SetInstanceHealth(const SetInstanceH
 
 SetInstanceHealthOutcomeCallable AutoScalingClient::SetInstanceHealthCallable(const SetInstanceHealthRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetInstanceHealth( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetInstanceHealth( request ); } );
 }
 
 void AutoScalingClient::SetInstanceHealthAsync(const SetInstanceHealthRequest& request, const SetInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1579,6 +2049,16 @@ void AutoScalingClient::SetInstanceHealthAsync(const SetInstanceHealthRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->SetInstanceHealthAsyncHelper( request, handler, context ); } );
 }
 
+SetInstanceHealthOutcomeCallable AutoScalingClient::SetInstanceHealthCallable(SetInstanceHealthRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::SetInstanceHealth, this, std::move(request)));
+}
+
+void AutoScalingClient::SetInstanceHealthAsync(SetInstanceHealthRequest&& request, const SetInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::SetInstanceHealthAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::SetInstanceHealthAsyncHelper(const SetInstanceHealthRequest& request, const SetInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetInstanceHealth(request), context);
@@ -1601,7 +2081,7 @@ SetInstanceProtectionOutcome AutoScalingClient::SetInstanceProtection(const SetI
 
 SetInstanceProtectionOutcomeCallable AutoScalingClient::SetInstanceProtectionCallable(const SetInstanceProtectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetInstanceProtection( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetInstanceProtection( request ); } );
 }
 
 void AutoScalingClient::SetInstanceProtectionAsync(const SetInstanceProtectionRequest& request, const SetInstanceProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1609,6 +2089,16 @@ void AutoScalingClient::SetInstanceProtectionAsync(const SetInstanceProtectionRe
   m_executor->Submit( [this, request, handler, context](){ this->SetInstanceProtectionAsyncHelper( request, handler, context ); } );
 }
 
+SetInstanceProtectionOutcomeCallable AutoScalingClient::SetInstanceProtectionCallable(SetInstanceProtectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::SetInstanceProtection, this, std::move(request)));
+}
+
+void AutoScalingClient::SetInstanceProtectionAsync(SetInstanceProtectionRequest&& request, const SetInstanceProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::SetInstanceProtectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::SetInstanceProtectionAsyncHelper(const SetInstanceProtectionRequest& request, const SetInstanceProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetInstanceProtection(request), context);
@@ -1631,7 +2121,7 @@ SuspendProcessesOutcome AutoScalingClient::SuspendProcesses(const SuspendProcess
 
 SuspendProcessesOutcomeCallable AutoScalingClient::SuspendProcessesCallable(const SuspendProcessesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SuspendProcesses( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SuspendProcesses( request ); } );
 }
 
 void AutoScalingClient::SuspendProcessesAsync(const SuspendProcessesRequest& request, const SuspendProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1639,6 +2129,16 @@ void AutoScalingClient::SuspendProcessesAsync(const SuspendProcessesRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->SuspendProcessesAsyncHelper( request, handler, context ); } );
 }
 
+SuspendProcessesOutcomeCallable AutoScalingClient::SuspendProcessesCallable(SuspendProcessesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::SuspendProcesses, this, std::move(request)));
+}
+
+void AutoScalingClient::SuspendProcessesAsync(SuspendProcessesRequest&& request, const SuspendProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::SuspendProcessesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::SuspendProcessesAsyncHelper(const SuspendProcessesRequest& request, const SuspendProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SuspendProcesses(request), context);
@@ -1661,7 +2161,7 @@ TerminateInstanceInAutoScalingGroupOutcome AutoScalingClient::TerminateInstanceI
 
 TerminateInstanceInAutoScalingGroupOutcomeCallable AutoScalingClient::TerminateInstanceInAutoScalingGroupCallable(const TerminateInstanceInAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TerminateInstanceInAutoScalingGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TerminateInstanceInAutoScalingGroup( request ); } );
 }
 
 void AutoScalingClient::TerminateInstanceInAutoScalingGroupAsync(const TerminateInstanceInAutoScalingGroupRequest& request, const TerminateInstanceInAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1669,6 +2169,16 @@ void AutoScalingClient::TerminateInstanceInAutoScalingGroupAsync(const Terminate
   m_executor->Submit( [this, request, handler, context](){ this->TerminateInstanceInAutoScalingGroupAsyncHelper( request, handler, context ); } );
 }
 
+TerminateInstanceInAutoScalingGroupOutcomeCallable AutoScalingClient::TerminateInstanceInAutoScalingGroupCallable(TerminateInstanceInAutoScalingGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::TerminateInstanceInAutoScalingGroup, this, std::move(request)));
+}
+
+void AutoScalingClient::TerminateInstanceInAutoScalingGroupAsync(TerminateInstanceInAutoScalingGroupRequest&& request, const TerminateInstanceInAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::TerminateInstanceInAutoScalingGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::TerminateInstanceInAutoScalingGroupAsyncHelper(const TerminateInstanceInAutoScalingGroupRequest& request, const TerminateInstanceInAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TerminateInstanceInAutoScalingGroup(request), context);
@@ -1691,7 +2201,7 @@ UpdateAutoScalingGroupOutcome AutoScalingClient::UpdateAutoScalingGroup(const Up
 
 UpdateAutoScalingGroupOutcomeCallable AutoScalingClient::UpdateAutoScalingGroupCallable(const UpdateAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateAutoScalingGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateAutoScalingGroup( request ); } );
 }
 
 void AutoScalingClient::UpdateAutoScalingGroupAsync(const UpdateAutoScalingGroupRequest& request, const UpdateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1699,8 +2209,450 @@ void AutoScalingClient::UpdateAutoScalingGroupAsync(const UpdateAutoScalingGroup
   m_executor->Submit( [this, request, handler, context](){ this->UpdateAutoScalingGroupAsyncHelper( request, handler, context ); } );
 }
 
+UpdateAutoScalingGroupOutcomeCallable AutoScalingClient::UpdateAutoScalingGroupCallable(UpdateAutoScalingGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&AutoScalingClient::UpdateAutoScalingGroup, this, std::move(request)));
+}
+
+void AutoScalingClient::UpdateAutoScalingGroupAsync(UpdateAutoScalingGroupRequest&& request, const UpdateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&AutoScalingClient::UpdateAutoScalingGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void AutoScalingClient::UpdateAutoScalingGroupAsyncHelper(const UpdateAutoScalingGroupRequest& request, const UpdateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateAutoScalingGroup(request), context);
 }
 
+Paginator<AutoScalingClient, DescribeAutoScalingGroupsRequest, DescribeAutoScalingGroupsOutcome> AutoScalingClient::DescribeAutoScalingGroupsPaginator(const DescribeAutoScalingGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<AutoScalingClient, DescribeAutoScalingGroupsRequest, DescribeAutoScalingGroupsOutcome>(this, &AutoScalingClient::DescribeAutoScalingGroups, request,
+    [](const DescribeAutoScalingGroupsRequest& current, const DescribeAutoScalingGroupsOutcome& outcome, DescribeAutoScalingGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<AutoScalingClient, DescribeAutoScalingInstancesRequest, DescribeAutoScalingInstancesOutcome> AutoScalingClient::DescribeAutoScalingInstancesPaginator(const DescribeAutoScalingInstancesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<AutoScalingClient, DescribeAutoScalingInstancesRequest, DescribeAutoScalingInstancesOutcome>(this, &AutoScalingClient::DescribeAutoScalingInstances, request,
+    [](const DescribeAutoScalingInstancesRequest& current, const DescribeAutoScalingInstancesOutcome& outcome, DescribeAutoScalingInstancesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<AutoScalingClient, DescribeLaunchConfigurationsRequest, DescribeLaunchConfigurationsOutcome> AutoScalingClient::DescribeLaunchConfigurationsPaginator(const DescribeLaunchConfigurationsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<AutoScalingClient, DescribeLaunchConfigurationsRequest, DescribeLaunchConfigurationsOutcome>(this, &AutoScalingClient::DescribeLaunchConfigurations, request,
+    [](const DescribeLaunchConfigurationsRequest& current, const DescribeLaunchConfigurationsOutcome& outcome, DescribeLaunchConfigurationsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<AutoScalingClient, DescribeLoadBalancerTargetGroupsRequest, DescribeLoadBalancerTargetGroupsOutcome> AutoScalingClient::DescribeLoadBalancerTargetGroupsPaginator(const DescribeLoadBalancerTargetGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<AutoScalingClient, DescribeLoadBalancerTargetGroupsRequest, DescribeLoadBalancerTargetGroupsOutcome>(this, &AutoScalingClient::DescribeLoadBalancerTargetGroups, request,
+    [](const DescribeLoadBalancerTargetGroupsRequest& current, const DescribeLoadBalancerTargetGroupsOutcome& outcome, DescribeLoadBalancerTargetGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<AutoScalingClient, DescribeLoadBalancersRequest, DescribeLoadBalancersOutcome> AutoScalingClient::DescribeLoadBalancersPaginator(const DescribeLoadBalancersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<AutoScalingClient, DescribeLoadBalancersRequest, DescribeLoadBalancersOutcome>(this, &AutoScalingClient::DescribeLoadBalancers, request,
+    [](const DescribeLoadBalancersRequest& current, const DescribeLoadBalancersOutcome& outcome, DescribeLoadBalancersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<AutoScalingClient, DescribeNotificationConfigurationsRequest, DescribeNotificationConfigurationsOutcome> AutoScalingClient::DescribeNotificationConfigurationsPaginator(const DescribeNotificationConfigurationsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<AutoScalingClient, DescribeNotificationConfigurationsRequest, DescribeNotificationConfigurationsOutcome>(this, &AutoScalingClient::DescribeNotificationConfigurations, request,
+    [](const DescribeNotificationConfigurationsRequest& current, const DescribeNotificationConfigurationsOutcome& outcome, DescribeNotificationConfigurationsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<AutoScalingClient, DescribePoliciesRequest, DescribePoliciesOutcome> AutoScalingClient::DescribePoliciesPaginator(const DescribePoliciesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<AutoScalingClient, DescribePoliciesRequest, DescribePoliciesOutcome>(this, &AutoScalingClient::DescribePolicies, request,
+    [](const DescribePoliciesRequest& current, const DescribePoliciesOutcome& outcome, DescribePoliciesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<AutoScalingClient, DescribeScalingActivitiesRequest, DescribeScalingActivitiesOutcome> AutoScalingClient::DescribeScalingActivitiesPaginator(const DescribeScalingActivitiesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<AutoScalingClient, DescribeScalingActivitiesRequest, DescribeScalingActivitiesOutcome>(this, &AutoScalingClient::DescribeScalingActivities, request,
+    [](const DescribeScalingActivitiesRequest& current, const DescribeScalingActivitiesOutcome& outcome, DescribeScalingActivitiesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<AutoScalingClient, DescribeScheduledActionsRequest, DescribeScheduledActionsOutcome> AutoScalingClient::DescribeScheduledActionsPaginator(const DescribeScheduledActionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<AutoScalingClient, DescribeScheduledActionsRequest, DescribeScheduledActionsOutcome>(this, &AutoScalingClient::DescribeScheduledActions, request,
+    [](const DescribeScheduledActionsRequest& current, const DescribeScheduledActionsOutcome& outcome, DescribeScheduledActionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<AutoScalingClient, DescribeTagsRequest, DescribeTagsOutcome> AutoScalingClient::DescribeTagsPaginator(const DescribeTagsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<AutoScalingClient, DescribeTagsRequest, DescribeTagsOutcome>(this, &AutoScalingClient::DescribeTags, request,
+    [](const DescribeTagsRequest& current, const DescribeTagsOutcome& outcome, DescribeTagsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<AutoScalingClient, AttachInstancesRequest, AttachInstancesOutcome> AutoScalingClient::AttachInstancesAwaitable(AttachInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::AttachInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, AttachLoadBalancerTargetGroupsRequest, AttachLoadBalancerTargetGroupsOutcome> AutoScalingClient::AttachLoadBalancerTargetGroupsAwaitable(AttachLoadBalancerTargetGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::AttachLoadBalancerTargetGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, AttachLoadBalancersRequest, AttachLoadBalancersOutcome> AutoScalingClient::AttachLoadBalancersAwaitable(AttachLoadBalancersRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::AttachLoadBalancers, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, CompleteLifecycleActionRequest, CompleteLifecycleActionOutcome> AutoScalingClient::CompleteLifecycleActionAwaitable(CompleteLifecycleActionRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::CompleteLifecycleAction, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, CreateAutoScalingGroupRequest, CreateAutoScalingGroupOutcome> AutoScalingClient::CreateAutoScalingGroupAwaitable(CreateAutoScalingGroupRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::CreateAutoScalingGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, CreateLaunchConfigurationRequest, CreateLaunchConfigurationOutcome> AutoScalingClient::CreateLaunchConfigurationAwaitable(CreateLaunchConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::CreateLaunchConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, CreateOrUpdateTagsRequest, CreateOrUpdateTagsOutcome> AutoScalingClient::CreateOrUpdateTagsAwaitable(CreateOrUpdateTagsRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::CreateOrUpdateTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DeleteAutoScalingGroupRequest, DeleteAutoScalingGroupOutcome> AutoScalingClient::DeleteAutoScalingGroupAwaitable(DeleteAutoScalingGroupRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DeleteAutoScalingGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DeleteLaunchConfigurationRequest, DeleteLaunchConfigurationOutcome> AutoScalingClient::DeleteLaunchConfigurationAwaitable(DeleteLaunchConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DeleteLaunchConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DeleteLifecycleHookRequest, DeleteLifecycleHookOutcome> AutoScalingClient::DeleteLifecycleHookAwaitable(DeleteLifecycleHookRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DeleteLifecycleHook, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DeleteNotificationConfigurationRequest, DeleteNotificationConfigurationOutcome> AutoScalingClient::DeleteNotificationConfigurationAwaitable(DeleteNotificationConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DeleteNotificationConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DeletePolicyRequest, DeletePolicyOutcome> AutoScalingClient::DeletePolicyAwaitable(DeletePolicyRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DeletePolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DeleteScheduledActionRequest, DeleteScheduledActionOutcome> AutoScalingClient::DeleteScheduledActionAwaitable(DeleteScheduledActionRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DeleteScheduledAction, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DeleteTagsRequest, DeleteTagsOutcome> AutoScalingClient::DeleteTagsAwaitable(DeleteTagsRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DeleteTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeAccountLimitsRequest, DescribeAccountLimitsOutcome> AutoScalingClient::DescribeAccountLimitsAwaitable(DescribeAccountLimitsRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeAccountLimits, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeAdjustmentTypesRequest, DescribeAdjustmentTypesOutcome> AutoScalingClient::DescribeAdjustmentTypesAwaitable(DescribeAdjustmentTypesRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeAdjustmentTypes, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeAutoScalingGroupsRequest, DescribeAutoScalingGroupsOutcome> AutoScalingClient::DescribeAutoScalingGroupsAwaitable(DescribeAutoScalingGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeAutoScalingGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeAutoScalingInstancesRequest, DescribeAutoScalingInstancesOutcome> AutoScalingClient::DescribeAutoScalingInstancesAwaitable(DescribeAutoScalingInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeAutoScalingInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeAutoScalingNotificationTypesRequest, DescribeAutoScalingNotificationTypesOutcome> AutoScalingClient::DescribeAutoScalingNotificationTypesAwaitable(DescribeAutoScalingNotificationTypesRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeAutoScalingNotificationTypes, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeLaunchConfigurationsRequest, DescribeLaunchConfigurationsOutcome> AutoScalingClient::DescribeLaunchConfigurationsAwaitable(DescribeLaunchConfigurationsRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeLaunchConfigurations, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeLifecycleHookTypesRequest, DescribeLifecycleHookTypesOutcome> AutoScalingClient::DescribeLifecycleHookTypesAwaitable(DescribeLifecycleHookTypesRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeLifecycleHookTypes, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeLifecycleHooksRequest, DescribeLifecycleHooksOutcome> AutoScalingClient::DescribeLifecycleHooksAwaitable(DescribeLifecycleHooksRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeLifecycleHooks, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeLoadBalancerTargetGroupsRequest, DescribeLoadBalancerTargetGroupsOutcome> AutoScalingClient::DescribeLoadBalancerTargetGroupsAwaitable(DescribeLoadBalancerTargetGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeLoadBalancerTargetGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeLoadBalancersRequest, DescribeLoadBalancersOutcome> AutoScalingClient::DescribeLoadBalancersAwaitable(DescribeLoadBalancersRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeLoadBalancers, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeMetricCollectionTypesRequest, DescribeMetricCollectionTypesOutcome> AutoScalingClient::DescribeMetricCollectionTypesAwaitable(DescribeMetricCollectionTypesRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeMetricCollectionTypes, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeNotificationConfigurationsRequest, DescribeNotificationConfigurationsOutcome> AutoScalingClient::DescribeNotificationConfigurationsAwaitable(DescribeNotificationConfigurationsRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeNotificationConfigurations, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribePoliciesRequest, DescribePoliciesOutcome> AutoScalingClient::DescribePoliciesAwaitable(DescribePoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribePolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeScalingActivitiesRequest, DescribeScalingActivitiesOutcome> AutoScalingClient::DescribeScalingActivitiesAwaitable(DescribeScalingActivitiesRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeScalingActivities, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeScalingProcessTypesRequest, DescribeScalingProcessTypesOutcome> AutoScalingClient::DescribeScalingProcessTypesAwaitable(DescribeScalingProcessTypesRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeScalingProcessTypes, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeScheduledActionsRequest, DescribeScheduledActionsOutcome> AutoScalingClient::DescribeScheduledActionsAwaitable(DescribeScheduledActionsRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeScheduledActions, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeTagsRequest, DescribeTagsOutcome> AutoScalingClient::DescribeTagsAwaitable(DescribeTagsRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DescribeTerminationPolicyTypesRequest, DescribeTerminationPolicyTypesOutcome> AutoScalingClient::DescribeTerminationPolicyTypesAwaitable(DescribeTerminationPolicyTypesRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DescribeTerminationPolicyTypes, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DetachInstancesRequest, DetachInstancesOutcome> AutoScalingClient::DetachInstancesAwaitable(DetachInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DetachInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DetachLoadBalancerTargetGroupsRequest, DetachLoadBalancerTargetGroupsOutcome> AutoScalingClient::DetachLoadBalancerTargetGroupsAwaitable(DetachLoadBalancerTargetGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DetachLoadBalancerTargetGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DetachLoadBalancersRequest, DetachLoadBalancersOutcome> AutoScalingClient::DetachLoadBalancersAwaitable(DetachLoadBalancersRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DetachLoadBalancers, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, DisableMetricsCollectionRequest, DisableMetricsCollectionOutcome> AutoScalingClient::DisableMetricsCollectionAwaitable(DisableMetricsCollectionRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::DisableMetricsCollection, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, EnableMetricsCollectionRequest, EnableMetricsCollectionOutcome> AutoScalingClient::EnableMetricsCollectionAwaitable(EnableMetricsCollectionRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::EnableMetricsCollection, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, EnterStandbyRequest, EnterStandbyOutcome> AutoScalingClient::EnterStandbyAwaitable(EnterStandbyRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::EnterStandby, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, ExecutePolicyRequest, ExecutePolicyOutcome> AutoScalingClient::ExecutePolicyAwaitable(ExecutePolicyRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::ExecutePolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, ExitStandbyRequest, ExitStandbyOutcome> AutoScalingClient::ExitStandbyAwaitable(ExitStandbyRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::ExitStandby, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, PutLifecycleHookRequest, PutLifecycleHookOutcome> AutoScalingClient::PutLifecycleHookAwaitable(PutLifecycleHookRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::PutLifecycleHook, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, PutNotificationConfigurationRequest, PutNotificationConfigurationOutcome> AutoScalingClient::PutNotificationConfigurationAwaitable(PutNotificationConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::PutNotificationConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, PutScalingPolicyRequest, PutScalingPolicyOutcome> AutoScalingClient::PutScalingPolicyAwaitable(PutScalingPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::PutScalingPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, PutScheduledUpdateGroupActionRequest, PutScheduledUpdateGroupActionOutcome> AutoScalingClient::PutScheduledUpdateGroupActionAwaitable(PutScheduledUpdateGroupActionRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::PutScheduledUpdateGroupAction, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, RecordLifecycleActionHeartbeatRequest, RecordLifecycleActionHeartbeatOutcome> AutoScalingClient::RecordLifecycleActionHeartbeatAwaitable(RecordLifecycleActionHeartbeatRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::RecordLifecycleActionHeartbeat, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, ResumeProcessesRequest, ResumeProcessesOutcome> AutoScalingClient::ResumeProcessesAwaitable(ResumeProcessesRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::ResumeProcesses, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, SetDesiredCapacityRequest, SetDesiredCapacityOutcome> AutoScalingClient::SetDesiredCapacityAwaitable(SetDesiredCapacityRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::SetDesiredCapacity, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, SetInstanceHealthRequest, SetInstanceHealthOutcome> AutoScalingClient::SetInstanceHealthAwaitable(SetInstanceHealthRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::SetInstanceHealth, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, SetInstanceProtectionRequest, SetInstanceProtectionOutcome> AutoScalingClient::SetInstanceProtectionAwaitable(SetInstanceProtectionRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::SetInstanceProtection, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, SuspendProcessesRequest, SuspendProcessesOutcome> AutoScalingClient::SuspendProcessesAwaitable(SuspendProcessesRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::SuspendProcesses, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, TerminateInstanceInAutoScalingGroupRequest, TerminateInstanceInAutoScalingGroupOutcome> AutoScalingClient::TerminateInstanceInAutoScalingGroupAwaitable(TerminateInstanceInAutoScalingGroupRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::TerminateInstanceInAutoScalingGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<AutoScalingClient, UpdateAutoScalingGroupRequest, UpdateAutoScalingGroupOutcome> AutoScalingClient::UpdateAutoScalingGroupAwaitable(UpdateAutoScalingGroupRequest request) const
+{
+  return { m_executor.get(), { this, &AutoScalingClient::UpdateAutoScalingGroup, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -69,61 +69,61 @@ Activity& Activity::operator =(const XmlNode& xmlNode)
     XmlNode activityIdNode = resultNode.FirstChild("ActivityId");
     if(!activityIdNode.IsNull())
     {
-      m_activityId = StringUtils::Trim(activityIdNode.GetText().c_str());
+      m_activityId = activityIdNode.GetTextView().Trim().ToString();
       m_activityIdHasBeenSet = true;
     }
     XmlNode autoScalingGroupNameNode = resultNode.FirstChild("AutoScalingGroupName");
     if(!autoScalingGroupNameNode.IsNull())
     {
-      m_autoScalingGroupName = StringUtils::Trim(autoScalingGroupNameNode.GetText().c_str());
+      m_autoScalingGroupName = autoScalingGroupNameNode.GetTextView().Trim().ToString();
       m_autoScalingGroupNameHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode causeNode = resultNode.FirstChild("Cause");
     if(!causeNode.IsNull())
     {
-      m_cause = StringUtils::Trim(causeNode.GetText().c_str());
+      m_cause = causeNode.GetTextView().Trim().ToString();
       m_causeHasBeenSet = true;
     }
     XmlNode startTimeNode = resultNode.FirstChild("StartTime");
     if(!startTimeNode.IsNull())
     {
-      m_startTime = DateTime(StringUtils::Trim(startTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_startTime = DateTime(startTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_startTimeHasBeenSet = true;
     }
     XmlNode endTimeNode = resultNode.FirstChild("EndTime");
     if(!endTimeNode.IsNull())
     {
-      m_endTime = DateTime(StringUtils::Trim(endTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_endTime = DateTime(endTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_endTimeHasBeenSet = true;
     }
     XmlNode statusCodeNode = resultNode.FirstChild("StatusCode");
     if(!statusCodeNode.IsNull())
     {
-      m_statusCode = ScalingActivityStatusCodeMapper::GetScalingActivityStatusCodeForName(StringUtils::Trim(statusCodeNode.GetText().c_str()).c_str());
+      m_statusCode = ScalingActivityStatusCodeMapper::GetScalingActivityStatusCodeForName(statusCodeNode.GetTextView().Trim().ToString().c_str());
       m_statusCodeHasBeenSet = true;
     }
     XmlNode statusMessageNode = resultNode.FirstChild("StatusMessage");
     if(!statusMessageNode.IsNull())
     {
-      m_statusMessage = StringUtils::Trim(statusMessageNode.GetText().c_str());
+      m_statusMessage = statusMessageNode.GetTextView().Trim().ToString();
       m_statusMessageHasBeenSet = true;
     }
     XmlNode progressNode = resultNode.FirstChild("Progress");
     if(!progressNode.IsNull())
     {
-      m_progress = StringUtils::ConvertToInt32(StringUtils::Trim(progressNode.GetText().c_str()).c_str());
+      m_progress = StringUtils::ConvertToInt32(progressNode.GetTextView().Trim().ToString().c_str());
       m_progressHasBeenSet = true;
     }
     XmlNode detailsNode = resultNode.FirstChild("Details");
     if(!detailsNode.IsNull())
     {
-      m_details = StringUtils::Trim(detailsNode.GetText().c_str());
+      m_details = detailsNode.GetTextView().Trim().ToString();
       m_detailsHasBeenSet = true;
     }
   }
@@ -135,32 +135,32 @@ void Activity::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 {
   if(m_activityIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ActivityId=" << StringUtils::URLEncode(m_activityId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ActivityId=" << StringUtils::URLEncoded(m_activityId) << "&";
   }
 
   if(m_autoScalingGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_causeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Cause=" << StringUtils::URLEncode(m_cause.c_str()) << "&";
+      oStream << location << index << locationValue << ".Cause=" << StringUtils::URLEncoded(m_cause) << "&";
   }
 
   if(m_startTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_endTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EndTime=" << StringUtils::URLEncode(m_endTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".EndTime=" << StringUtils::URLEncoded(m_endTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_statusCodeHasBeenSet)
@@ -170,7 +170,7 @@ void Activity::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
 
   if(m_progressHasBeenSet)
@@ -180,7 +180,7 @@ void Activity::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_detailsHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Details=" << StringUtils::URLEncode(m_details.c_str()) << "&";
+      oStream << location << index << locationValue << ".Details=" << StringUtils::URLEncoded(m_details) << "&";
   }
 
 }
@@ -189,27 +189,27 @@ void Activity::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_activityIdHasBeenSet)
   {
-      oStream << location << ".ActivityId=" << StringUtils::URLEncode(m_activityId.c_str()) << "&";
+      oStream << location << ".ActivityId=" << StringUtils::URLEncoded(m_activityId) << "&";
   }
   if(m_autoScalingGroupNameHasBeenSet)
   {
-      oStream << location << ".AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+      oStream << location << ".AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_causeHasBeenSet)
   {
-      oStream << location << ".Cause=" << StringUtils::URLEncode(m_cause.c_str()) << "&";
+      oStream << location << ".Cause=" << StringUtils::URLEncoded(m_cause) << "&";
   }
   if(m_startTimeHasBeenSet)
   {
-      oStream << location << ".StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_endTimeHasBeenSet)
   {
-      oStream << location << ".EndTime=" << StringUtils::URLEncode(m_endTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".EndTime=" << StringUtils::URLEncoded(m_endTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_statusCodeHasBeenSet)
   {
@@ -217,7 +217,7 @@ void Activity::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
   if(m_progressHasBeenSet)
   {
@@ -225,7 +225,7 @@ void Activity::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_detailsHasBeenSet)
   {
-      oStream << location << ".Details=" << StringUtils::URLEncode(m_details.c_str()) << "&";
+      oStream << location << ".Details=" << StringUtils::URLEncoded(m_details) << "&";
   }
 }
 
@@ -49,7 +49,7 @@ AdjustmentType& AdjustmentType::operator =(const XmlNode& xmlNode)
     XmlNode adjustmentTypeNode = resultNode.FirstChild("AdjustmentType");
     if(!adjustmentTypeNode.IsNull())
     {
-      m_adjustmentType = StringUtils::Trim(adjustmentTypeNode.GetText().c_str());
+      m_adjustmentType = adjustmentTypeNode.GetTextView().Trim().ToString();
       m_adjustmentTypeHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void AdjustmentType::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_adjustmentTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AdjustmentType=" << StringUtils::URLEncode(m_adjustmentType.c_str()) << "&";
+      oStream << location << index << locationValue << ".AdjustmentType=" << StringUtils::URLEncoded(m_adjustmentType) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void AdjustmentType::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_adjustmentTypeHasBeenSet)
   {
-      oStream << location << ".AdjustmentType=" << StringUtils::URLEncode(m_adjustmentType.c_str()) << "&";
+      oStream << location << ".AdjustmentType=" << StringUtils::URLEncoded(m_adjustmentType) << "&";
   }
 }
 
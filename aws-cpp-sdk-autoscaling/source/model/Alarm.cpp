@@ -51,13 +51,13 @@ Alarm& Alarm::operator =(const XmlNode& xmlNode)
     XmlNode alarmNameNode = resultNode.FirstChild("AlarmName");
     if(!alarmNameNode.IsNull())
     {
-      m_alarmName = StringUtils::Trim(alarmNameNode.GetText().c_str());
+      m_alarmName = alarmNameNode.GetTextView().Trim().ToString();
       m_alarmNameHasBeenSet = true;
     }
     XmlNode alarmARNNode = resultNode.FirstChild("AlarmARN");
     if(!alarmARNNode.IsNull())
     {
-      m_alarmARN = StringUtils::Trim(alarmARNNode.GetText().c_str());
+      m_alarmARN = alarmARNNode.GetTextView().Trim().ToString();
       m_alarmARNHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void Alarm::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 {
   if(m_alarmNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AlarmName=" << StringUtils::URLEncode(m_alarmName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AlarmName=" << StringUtils::URLEncoded(m_alarmName) << "&";
   }
 
   if(m_alarmARNHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AlarmARN=" << StringUtils::URLEncode(m_alarmARN.c_str()) << "&";
+      oStream << location << index << locationValue << ".AlarmARN=" << StringUtils::URLEncoded(m_alarmARN) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void Alarm::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_alarmNameHasBeenSet)
   {
-      oStream << location << ".AlarmName=" << StringUtils::URLEncode(m_alarmName.c_str()) << "&";
+      oStream << location << ".AlarmName=" << StringUtils::URLEncoded(m_alarmName) << "&";
   }
   if(m_alarmARNHasBeenSet)
   {
-      oStream << location << ".AlarmARN=" << StringUtils::URLEncode(m_alarmARN.c_str()) << "&";
+      oStream << location << ".AlarmARN=" << StringUtils::URLEncoded(m_alarmARN) << "&";
   }
 }
 
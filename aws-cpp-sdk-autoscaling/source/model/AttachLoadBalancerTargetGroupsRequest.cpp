@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/AttachLoadBalancerTargetGroupsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ AttachLoadBalancerTargetGroupsRequest::AttachLoadBalancerTargetGroupsRequest() :
 
 Aws::String AttachLoadBalancerTargetGroupsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AttachLoadBalancerTargetGroups&";
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_targetGroupARNsHasBeenSet)
@@ -40,12 +41,12 @@ Aws::String AttachLoadBalancerTargetGroupsRequest::SerializePayload() const
     for(auto& item : m_targetGroupARNs)
     {
       ss << "TargetGroupARNs.member." << targetGroupARNsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       targetGroupARNsCount++;
     }
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
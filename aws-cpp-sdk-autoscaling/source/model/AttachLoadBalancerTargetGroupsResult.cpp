@@ -40,7 +40,7 @@ AttachLoadBalancerTargetGroupsResult& AttachLoadBalancerTargetGroupsResult::oper
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AttachLoadBalancerTargetGroupsResult")
+  if (rootNode.GetNameView() != "AttachLoadBalancerTargetGroupsResult")
   {
     resultNode = rootNode.FirstChild("AttachLoadBalancerTargetGroupsResult");
   }
@@ -40,7 +40,7 @@ AttachLoadBalancersResult& AttachLoadBalancersResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AttachLoadBalancersResult")
+  if (rootNode.GetNameView() != "AttachLoadBalancersResult")
   {
     resultNode = rootNode.FirstChild("AttachLoadBalancersResult");
   }
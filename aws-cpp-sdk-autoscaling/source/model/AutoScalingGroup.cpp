@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -103,43 +104,43 @@ AutoScalingGroup& AutoScalingGroup::operator =(const XmlNode& xmlNode)
     XmlNode autoScalingGroupNameNode = resultNode.FirstChild("AutoScalingGroupName");
     if(!autoScalingGroupNameNode.IsNull())
     {
-      m_autoScalingGroupName = StringUtils::Trim(autoScalingGroupNameNode.GetText().c_str());
+      m_autoScalingGroupName = autoScalingGroupNameNode.GetTextView().Trim().ToString();
       m_autoScalingGroupNameHasBeenSet = true;
     }
     XmlNode autoScalingGroupARNNode = resultNode.FirstChild("AutoScalingGroupARN");
     if(!autoScalingGroupARNNode.IsNull())
     {
-      m_autoScalingGroupARN = StringUtils::Trim(autoScalingGroupARNNode.GetText().c_str());
+      m_autoScalingGroupARN = autoScalingGroupARNNode.GetTextView().Trim().ToString();
       m_autoScalingGroupARNHasBeenSet = true;
     }
     XmlNode launchConfigurationNameNode = resultNode.FirstChild("LaunchConfigurationName");
     if(!launchConfigurationNameNode.IsNull())
     {
-      m_launchConfigurationName = StringUtils::Trim(launchConfigurationNameNode.GetText().c_str());
+      m_launchConfigurationName = launchConfigurationNameNode.GetTextView().Trim().ToString();
       m_launchConfigurationNameHasBeenSet = true;
     }
     XmlNode minSizeNode = resultNode.FirstChild("MinSize");
     if(!minSizeNode.IsNull())
     {
-      m_minSize = StringUtils::ConvertToInt32(StringUtils::Trim(minSizeNode.GetText().c_str()).c_str());
+      m_minSize = StringUtils::ConvertToInt32(minSizeNode.GetTextView().Trim().ToString().c_str());
       m_minSizeHasBeenSet = true;
     }
     XmlNode maxSizeNode = resultNode.FirstChild("MaxSize");
     if(!maxSizeNode.IsNull())
     {
-      m_maxSize = StringUtils::ConvertToInt32(StringUtils::Trim(maxSizeNode.GetText().c_str()).c_str());
+      m_maxSize = StringUtils::ConvertToInt32(maxSizeNode.GetTextView().Trim().ToString().c_str());
       m_maxSizeHasBeenSet = true;
     }
     XmlNode desiredCapacityNode = resultNode.FirstChild("DesiredCapacity");
     if(!desiredCapacityNode.IsNull())
     {
-      m_desiredCapacity = StringUtils::ConvertToInt32(StringUtils::Trim(desiredCapacityNode.GetText().c_str()).c_str());
+      m_desiredCapacity = StringUtils::ConvertToInt32(desiredCapacityNode.GetTextView().Trim().ToString().c_str());
       m_desiredCapacityHasBeenSet = true;
     }
     XmlNode defaultCooldownNode = resultNode.FirstChild("DefaultCooldown");
     if(!defaultCooldownNode.IsNull())
     {
-      m_defaultCooldown = StringUtils::ConvertToInt32(StringUtils::Trim(defaultCooldownNode.GetText().c_str()).c_str());
+      m_defaultCooldown = StringUtils::ConvertToInt32(defaultCooldownNode.GetTextView().Trim().ToString().c_str());
       m_defaultCooldownHasBeenSet = true;
     }
     XmlNode availabilityZonesNode = resultNode.FirstChild("AvailabilityZones");
@@ -148,7 +149,7 @@ AutoScalingGroup& AutoScalingGroup::operator =(const XmlNode& xmlNode)
       XmlNode availabilityZonesMember = availabilityZonesNode.FirstChild("member");
       while(!availabilityZonesMember.IsNull())
       {
-        m_availabilityZones.push_back(StringUtils::Trim(availabilityZonesMember.GetText().c_str()));
+        m_availabilityZones.push_back(availabilityZonesMember.GetTextView().Trim().ToString());
         availabilityZonesMember = availabilityZonesMember.NextNode("member");
       }
 
@@ -160,7 +161,7 @@ AutoScalingGroup& AutoScalingGroup::operator =(const XmlNode& xmlNode)
       XmlNode loadBalancerNamesMember = loadBalancerNamesNode.FirstChild("member");
       while(!loadBalancerNamesMember.IsNull())
       {
-        m_loadBalancerNames.push_back(StringUtils::Trim(loadBalancerNamesMember.GetText().c_str()));
+        m_loadBalancerNames.push_back(loadBalancerNamesMember.GetTextView().Trim().ToString());
         loadBalancerNamesMember = loadBalancerNamesMember.NextNode("member");
       }
 
@@ -172,7 +173,7 @@ AutoScalingGroup& AutoScalingGroup::operator =(const XmlNode& xmlNode)
       XmlNode targetGroupARNsMember = targetGroupARNsNode.FirstChild("member");
       while(!targetGroupARNsMember.IsNull())
       {
-        m_targetGroupARNs.push_back(StringUtils::Trim(targetGroupARNsMember.GetText().c_str()));
+        m_targetGroupARNs.push_back(targetGroupARNsMember.GetTextView().Trim().ToString());
         targetGroupARNsMember = targetGroupARNsMember.NextNode("member");
       }
 
@@ -181,13 +182,13 @@ AutoScalingGroup& AutoScalingGroup::operator =(const XmlNode& xmlNode)
     XmlNode healthCheckTypeNode = resultNode.FirstChild("HealthCheckType");
     if(!healthCheckTypeNode.IsNull())
     {
-      m_healthCheckType = StringUtils::Trim(healthCheckTypeNode.GetText().c_str());
+      m_healthCheckType = healthCheckTypeNode.GetTextView().Trim().ToString();
       m_healthCheckTypeHasBeenSet = true;
     }
     XmlNode healthCheckGracePeriodNode = resultNode.FirstChild("HealthCheckGracePeriod");
     if(!healthCheckGracePeriodNode.IsNull())
     {
-      m_healthCheckGracePeriod = StringUtils::ConvertToInt32(StringUtils::Trim(healthCheckGracePeriodNode.GetText().c_str()).c_str());
+      m_healthCheckGracePeriod = StringUtils::ConvertToInt32(healthCheckGracePeriodNode.GetTextView().Trim().ToString().c_str());
       m_healthCheckGracePeriodHasBeenSet = true;
     }
     XmlNode instancesNode = resultNode.FirstChild("Instances");
@@ -205,7 +206,7 @@ AutoScalingGroup& AutoScalingGroup::operator =(const XmlNode& xmlNode)
     XmlNode createdTimeNode = resultNode.FirstChild("CreatedTime");
     if(!createdTimeNode.IsNull())
     {
-      m_createdTime = DateTime(StringUtils::Trim(createdTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createdTime = DateTime(createdTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createdTimeHasBeenSet = true;
     }
     XmlNode suspendedProcessesNode = resultNode.FirstChild("SuspendedProcesses");
@@ -223,13 +224,13 @@ AutoScalingGroup& AutoScalingGroup::operator =(const XmlNode& xmlNode)
     XmlNode placementGroupNode = resultNode.FirstChild("PlacementGroup");
     if(!placementGroupNode.IsNull())
     {
-      m_placementGroup = StringUtils::Trim(placementGroupNode.GetText().c_str());
+      m_placementGroup = placementGroupNode.GetTextView().Trim().ToString();
       m_placementGroupHasBeenSet = true;
     }
     XmlNode vPCZoneIdentifierNode = resultNode.FirstChild("VPCZoneIdentifier");
     if(!vPCZoneIdentifierNode.IsNull())
     {
-      m_vPCZoneIdentifier = StringUtils::Trim(vPCZoneIdentifierNode.GetText().c_str());
+      m_vPCZoneIdentifier = vPCZoneIdentifierNode.GetTextView().Trim().ToString();
       m_vPCZoneIdentifierHasBeenSet = true;
     }
     XmlNode enabledMetricsNode = resultNode.FirstChild("EnabledMetrics");
@@ -247,7 +248,7 @@ AutoScalingGroup& AutoScalingGroup::operator =(const XmlNode& xmlNode)
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("Tags");
@@ -268,7 +269,7 @@ AutoScalingGroup& AutoScalingGroup::operator =(const XmlNode& xmlNode)
       XmlNode terminationPoliciesMember = terminationPoliciesNode.FirstChild("member");
       while(!terminationPoliciesMember.IsNull())
       {
-        m_terminationPolicies.push_back(StringUtils::Trim(terminationPoliciesMember.GetText().c_str()));
+        m_terminationPolicies.push_back(terminationPoliciesMember.GetTextView().Trim().ToString());
         terminationPoliciesMember = terminationPoliciesMember.NextNode("member");
       }
 
@@ -277,7 +278,7 @@ AutoScalingGroup& AutoScalingGroup::operator =(const XmlNode& xmlNode)
     XmlNode newInstancesProtectedFromScaleInNode = resultNode.FirstChild("NewInstancesProtectedFromScaleIn");
     if(!newInstancesProtectedFromScaleInNode.IsNull())
     {
-      m_newInstancesProtectedFromScaleIn = StringUtils::ConvertToBool(StringUtils::Trim(newInstancesProtectedFromScaleInNode.GetText().c_str()).c_str());
+      m_newInstancesProtectedFromScaleIn = StringUtils::ConvertToBool(newInstancesProtectedFromScaleInNode.GetTextView().Trim().ToString().c_str());
       m_newInstancesProtectedFromScaleInHasBeenSet = true;
     }
   }
@@ -289,17 +290,17 @@ void AutoScalingGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_autoScalingGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_autoScalingGroupARNHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AutoScalingGroupARN=" << StringUtils::URLEncode(m_autoScalingGroupARN.c_str()) << "&";
+      oStream << location << index << locationValue << ".AutoScalingGroupARN=" << StringUtils::URLEncoded(m_autoScalingGroupARN) << "&";
   }
 
   if(m_launchConfigurationNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LaunchConfigurationName=" << StringUtils::URLEncode(m_launchConfigurationName.c_str()) << "&";
+      oStream << location << index << locationValue << ".LaunchConfigurationName=" << StringUtils::URLEncoded(m_launchConfigurationName) << "&";
   }
 
   if(m_minSizeHasBeenSet)
@@ -327,7 +328,7 @@ void AutoScalingGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned availabilityZonesIdx = 1;
       for(auto& item : m_availabilityZones)
       {
-        oStream << location << index << locationValue << ".AvailabilityZones.member." << availabilityZonesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".AvailabilityZones.member." << availabilityZonesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -336,7 +337,7 @@ void AutoScalingGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned loadBalancerNamesIdx = 1;
       for(auto& item : m_loadBalancerNames)
       {
-        oStream << location << index << locationValue << ".LoadBalancerNames.member." << loadBalancerNamesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".LoadBalancerNames.member." << loadBalancerNamesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -345,13 +346,13 @@ void AutoScalingGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned targetGroupARNsIdx = 1;
       for(auto& item : m_targetGroupARNs)
       {
-        oStream << location << index << locationValue << ".TargetGroupARNs.member." << targetGroupARNsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".TargetGroupARNs.member." << targetGroupARNsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
   if(m_healthCheckTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HealthCheckType=" << StringUtils::URLEncode(m_healthCheckType.c_str()) << "&";
+      oStream << location << index << locationValue << ".HealthCheckType=" << StringUtils::URLEncoded(m_healthCheckType) << "&";
   }
 
   if(m_healthCheckGracePeriodHasBeenSet)
@@ -364,15 +365,15 @@ void AutoScalingGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned instancesIdx = 1;
       for(auto& item : m_instances)
       {
-        Aws::StringStream instancesSs;
+        Aws::Utils::Stream::StringOutputStream instancesSs;
         instancesSs << location << index << locationValue << ".Instances.member." << instancesIdx++;
-        item.OutputToStream(oStream, instancesSs.str().c_str());
+        item.OutputToStream(oStream, instancesSs.GetString().c_str());
       }
   }
 
   if(m_createdTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreatedTime=" << StringUtils::URLEncode(m_createdTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreatedTime=" << StringUtils::URLEncoded(m_createdTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_suspendedProcessesHasBeenSet)
@@ -380,20 +381,20 @@ void AutoScalingGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned suspendedProcessesIdx = 1;
       for(auto& item : m_suspendedProcesses)
       {
-        Aws::StringStream suspendedProcessesSs;
+        Aws::Utils::Stream::StringOutputStream suspendedProcessesSs;
         suspendedProcessesSs << location << index << locationValue << ".SuspendedProcesses.member." << suspendedProcessesIdx++;
-        item.OutputToStream(oStream, suspendedProcessesSs.str().c_str());
+        item.OutputToStream(oStream, suspendedProcessesSs.GetString().c_str());
       }
   }
 
   if(m_placementGroupHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PlacementGroup=" << StringUtils::URLEncode(m_placementGroup.c_str()) << "&";
+      oStream << location << index << locationValue << ".PlacementGroup=" << StringUtils::URLEncoded(m_placementGroup) << "&";
   }
 
   if(m_vPCZoneIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VPCZoneIdentifier=" << StringUtils::URLEncode(m_vPCZoneIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".VPCZoneIdentifier=" << StringUtils::URLEncoded(m_vPCZoneIdentifier) << "&";
   }
 
   if(m_enabledMetricsHasBeenSet)
@@ -401,15 +402,15 @@ void AutoScalingGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned enabledMetricsIdx = 1;
       for(auto& item : m_enabledMetrics)
       {
-        Aws::StringStream enabledMetricsSs;
+        Aws::Utils::Stream::StringOutputStream enabledMetricsSs;
         enabledMetricsSs << location << index << locationValue << ".EnabledMetrics.member." << enabledMetricsIdx++;
-        item.OutputToStream(oStream, enabledMetricsSs.str().c_str());
+        item.OutputToStream(oStream, enabledMetricsSs.GetString().c_str());
       }
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -417,9 +418,9 @@ void AutoScalingGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".Tags.member." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -428,7 +429,7 @@ void AutoScalingGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned terminationPoliciesIdx = 1;
       for(auto& item : m_terminationPolicies)
       {
-        oStream << location << index << locationValue << ".TerminationPolicies.member." << terminationPoliciesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".TerminationPolicies.member." << terminationPoliciesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -443,15 +444,15 @@ void AutoScalingGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_autoScalingGroupNameHasBeenSet)
   {
-      oStream << location << ".AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+      oStream << location << ".AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
   if(m_autoScalingGroupARNHasBeenSet)
   {
-      oStream << location << ".AutoScalingGroupARN=" << StringUtils::URLEncode(m_autoScalingGroupARN.c_str()) << "&";
+      oStream << location << ".AutoScalingGroupARN=" << StringUtils::URLEncoded(m_autoScalingGroupARN) << "&";
   }
   if(m_launchConfigurationNameHasBeenSet)
   {
-      oStream << location << ".LaunchConfigurationName=" << StringUtils::URLEncode(m_launchConfigurationName.c_str()) << "&";
+      oStream << location << ".LaunchConfigurationName=" << StringUtils::URLEncoded(m_launchConfigurationName) << "&";
   }
   if(m_minSizeHasBeenSet)
   {
@@ -474,7 +475,7 @@ void AutoScalingGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned availabilityZonesIdx = 1;
       for(auto& item : m_availabilityZones)
       {
-        oStream << location << ".AvailabilityZones.member." << availabilityZonesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".AvailabilityZones.member." << availabilityZonesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_loadBalancerNamesHasBeenSet)
@@ -482,7 +483,7 @@ void AutoScalingGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned loadBalancerNamesIdx = 1;
       for(auto& item : m_loadBalancerNames)
       {
-        oStream << location << ".LoadBalancerNames.member." << loadBalancerNamesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".LoadBalancerNames.member." << loadBalancerNamesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_targetGroupARNsHasBeenSet)
@@ -490,12 +491,12 @@ void AutoScalingGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned targetGroupARNsIdx = 1;
       for(auto& item : m_targetGroupARNs)
       {
-        oStream << location << ".TargetGroupARNs.member." << targetGroupARNsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".TargetGroupARNs.member." << targetGroupARNsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_healthCheckTypeHasBeenSet)
   {
-      oStream << location << ".HealthCheckType=" << StringUtils::URLEncode(m_healthCheckType.c_str()) << "&";
+      oStream << location << ".HealthCheckType=" << StringUtils::URLEncoded(m_healthCheckType) << "&";
   }
   if(m_healthCheckGracePeriodHasBeenSet)
   {
@@ -506,55 +507,55 @@ void AutoScalingGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned instancesIdx = 1;
       for(auto& item : m_instances)
       {
-        Aws::StringStream instancesSs;
+        Aws::Utils::Stream::StringOutputStream instancesSs;
         instancesSs << location <<  ".Instances.member." << instancesIdx++;
-        item.OutputToStream(oStream, instancesSs.str().c_str());
+        item.OutputToStream(oStream, instancesSs.GetString().c_str());
       }
   }
   if(m_createdTimeHasBeenSet)
   {
-      oStream << location << ".CreatedTime=" << StringUtils::URLEncode(m_createdTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreatedTime=" << StringUtils::URLEncoded(m_createdTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_suspendedProcessesHasBeenSet)
   {
       unsigned suspendedProcessesIdx = 1;
       for(auto& item : m_suspendedProcesses)
       {
-        Aws::StringStream suspendedProcessesSs;
+        Aws::Utils::Stream::StringOutputStream suspendedProcessesSs;
         suspendedProcessesSs << location <<  ".SuspendedProcesses.member." << suspendedProcessesIdx++;
-        item.OutputToStream(oStream, suspendedProcessesSs.str().c_str());
+        item.OutputToStream(oStream, suspendedProcessesSs.GetString().c_str());
       }
   }
   if(m_placementGroupHasBeenSet)
   {
-      oStream << location << ".PlacementGroup=" << StringUtils::URLEncode(m_placementGroup.c_str()) << "&";
+      oStream << location << ".PlacementGroup=" << StringUtils::URLEncoded(m_placementGroup) << "&";
   }
   if(m_vPCZoneIdentifierHasBeenSet)
   {
-      oStream << location << ".VPCZoneIdentifier=" << StringUtils::URLEncode(m_vPCZoneIdentifier.c_str()) << "&";
+      oStream << location << ".VPCZoneIdentifier=" << StringUtils::URLEncoded(m_vPCZoneIdentifier) << "&";
   }
   if(m_enabledMetricsHasBeenSet)
   {
       unsigned enabledMetricsIdx = 1;
       for(auto& item : m_enabledMetrics)
       {
-        Aws::StringStream enabledMetricsSs;
+        Aws::Utils::Stream::StringOutputStream enabledMetricsSs;
         enabledMetricsSs << location <<  ".EnabledMetrics.member." << enabledMetricsIdx++;
-        item.OutputToStream(oStream, enabledMetricsSs.str().c_str());
+        item.OutputToStream(oStream, enabledMetricsSs.GetString().c_str());
       }
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_tagsHasBeenSet)
   {
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".Tags.member." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
   if(m_terminationPoliciesHasBeenSet)
@@ -562,7 +563,7 @@ void AutoScalingGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned terminationPoliciesIdx = 1;
       for(auto& item : m_terminationPolicies)
       {
-        oStream << location << ".TerminationPolicies.member." << terminationPoliciesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".TerminationPolicies.member." << terminationPoliciesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_newInstancesProtectedFromScaleInHasBeenSet)
@@ -63,43 +63,43 @@ AutoScalingInstanceDetails& AutoScalingInstanceDetails::operator =(const XmlNode
     XmlNode instanceIdNode = resultNode.FirstChild("InstanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode autoScalingGroupNameNode = resultNode.FirstChild("AutoScalingGroupName");
     if(!autoScalingGroupNameNode.IsNull())
     {
-      m_autoScalingGroupName = StringUtils::Trim(autoScalingGroupNameNode.GetText().c_str());
+      m_autoScalingGroupName = autoScalingGroupNameNode.GetTextView().Trim().ToString();
       m_autoScalingGroupNameHasBeenSet = true;
     }
     XmlNode availabilityZoneNode = resultNode.FirstChild("AvailabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode lifecycleStateNode = resultNode.FirstChild("LifecycleState");
     if(!lifecycleStateNode.IsNull())
     {
-      m_lifecycleState = StringUtils::Trim(lifecycleStateNode.GetText().c_str());
+      m_lifecycleState = lifecycleStateNode.GetTextView().Trim().ToString();
       m_lifecycleStateHasBeenSet = true;
     }
     XmlNode healthStatusNode = resultNode.FirstChild("HealthStatus");
     if(!healthStatusNode.IsNull())
     {
-      m_healthStatus = StringUtils::Trim(healthStatusNode.GetText().c_str());
+      m_healthStatus = healthStatusNode.GetTextView().Trim().ToString();
       m_healthStatusHasBeenSet = true;
     }
     XmlNode launchConfigurationNameNode = resultNode.FirstChild("LaunchConfigurationName");
     if(!launchConfigurationNameNode.IsNull())
     {
-      m_launchConfigurationName = StringUtils::Trim(launchConfigurationNameNode.GetText().c_str());
+      m_launchConfigurationName = launchConfigurationNameNode.GetTextView().Trim().ToString();
       m_launchConfigurationNameHasBeenSet = true;
     }
     XmlNode protectedFromScaleInNode = resultNode.FirstChild("ProtectedFromScaleIn");
     if(!protectedFromScaleInNode.IsNull())
     {
-      m_protectedFromScaleIn = StringUtils::ConvertToBool(StringUtils::Trim(protectedFromScaleInNode.GetText().c_str()).c_str());
+      m_protectedFromScaleIn = StringUtils::ConvertToBool(protectedFromScaleInNode.GetTextView().Trim().ToString().c_str());
       m_protectedFromScaleInHasBeenSet = true;
     }
   }
@@ -111,32 +111,32 @@ void AutoScalingInstanceDetails::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_autoScalingGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_lifecycleStateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LifecycleState=" << StringUtils::URLEncode(m_lifecycleState.c_str()) << "&";
+      oStream << location << index << locationValue << ".LifecycleState=" << StringUtils::URLEncoded(m_lifecycleState) << "&";
   }
 
   if(m_healthStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HealthStatus=" << StringUtils::URLEncode(m_healthStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".HealthStatus=" << StringUtils::URLEncoded(m_healthStatus) << "&";
   }
 
   if(m_launchConfigurationNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LaunchConfigurationName=" << StringUtils::URLEncode(m_launchConfigurationName.c_str()) << "&";
+      oStream << location << index << locationValue << ".LaunchConfigurationName=" << StringUtils::URLEncoded(m_launchConfigurationName) << "&";
   }
 
   if(m_protectedFromScaleInHasBeenSet)
@@ -150,27 +150,27 @@ void AutoScalingInstanceDetails::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_autoScalingGroupNameHasBeenSet)
   {
-      oStream << location << ".AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+      oStream << location << ".AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_lifecycleStateHasBeenSet)
   {
-      oStream << location << ".LifecycleState=" << StringUtils::URLEncode(m_lifecycleState.c_str()) << "&";
+      oStream << location << ".LifecycleState=" << StringUtils::URLEncoded(m_lifecycleState) << "&";
   }
   if(m_healthStatusHasBeenSet)
   {
-      oStream << location << ".HealthStatus=" << StringUtils::URLEncode(m_healthStatus.c_str()) << "&";
+      oStream << location << ".HealthStatus=" << StringUtils::URLEncoded(m_healthStatus) << "&";
   }
   if(m_launchConfigurationNameHasBeenSet)
   {
-      oStream << location << ".LaunchConfigurationName=" << StringUtils::URLEncode(m_launchConfigurationName.c_str()) << "&";
+      oStream << location << ".LaunchConfigurationName=" << StringUtils::URLEncoded(m_launchConfigurationName) << "&";
   }
   if(m_protectedFromScaleInHasBeenSet)
   {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -57,13 +58,13 @@ BlockDeviceMapping& BlockDeviceMapping::operator =(const XmlNode& xmlNode)
     XmlNode virtualNameNode = resultNode.FirstChild("VirtualName");
     if(!virtualNameNode.IsNull())
     {
-      m_virtualName = StringUtils::Trim(virtualNameNode.GetText().c_str());
+      m_virtualName = virtualNameNode.GetTextView().Trim().ToString();
       m_virtualNameHasBeenSet = true;
     }
     XmlNode deviceNameNode = resultNode.FirstChild("DeviceName");
     if(!deviceNameNode.IsNull())
     {
-      m_deviceName = StringUtils::Trim(deviceNameNode.GetText().c_str());
+      m_deviceName = deviceNameNode.GetTextView().Trim().ToString();
       m_deviceNameHasBeenSet = true;
     }
     XmlNode ebsNode = resultNode.FirstChild("Ebs");
@@ -75,7 +76,7 @@ BlockDeviceMapping& BlockDeviceMapping::operator =(const XmlNode& xmlNode)
     XmlNode noDeviceNode = resultNode.FirstChild("NoDevice");
     if(!noDeviceNode.IsNull())
     {
-      m_noDevice = StringUtils::ConvertToBool(StringUtils::Trim(noDeviceNode.GetText().c_str()).c_str());
+      m_noDevice = StringUtils::ConvertToBool(noDeviceNode.GetTextView().Trim().ToString().c_str());
       m_noDeviceHasBeenSet = true;
     }
   }
@@ -87,19 +88,19 @@ void BlockDeviceMapping::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_virtualNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VirtualName=" << StringUtils::URLEncode(m_virtualName.c_str()) << "&";
+      oStream << location << index << locationValue << ".VirtualName=" << StringUtils::URLEncoded(m_virtualName) << "&";
   }
 
   if(m_deviceNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DeviceName=" << StringUtils::URLEncode(m_deviceName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DeviceName=" << StringUtils::URLEncoded(m_deviceName) << "&";
   }
 
   if(m_ebsHasBeenSet)
   {
-      Aws::StringStream ebsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream ebsLocationAndMemberSs;
       ebsLocationAndMemberSs << location << index << locationValue << ".Ebs";
-      m_ebs.OutputToStream(oStream, ebsLocationAndMemberSs.str().c_str());
+      m_ebs.OutputToStream(oStream, ebsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_noDeviceHasBeenSet)
@@ -113,11 +114,11 @@ void BlockDeviceMapping::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_virtualNameHasBeenSet)
   {
-      oStream << location << ".VirtualName=" << StringUtils::URLEncode(m_virtualName.c_str()) << "&";
+      oStream << location << ".VirtualName=" << StringUtils::URLEncoded(m_virtualName) << "&";
   }
   if(m_deviceNameHasBeenSet)
   {
-      oStream << location << ".DeviceName=" << StringUtils::URLEncode(m_deviceName.c_str()) << "&";
+      oStream << location << ".DeviceName=" << StringUtils::URLEncoded(m_deviceName) << "&";
   }
   if(m_ebsHasBeenSet)
   {
@@ -40,7 +40,7 @@ CompleteLifecycleActionResult& CompleteLifecycleActionResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CompleteLifecycleActionResult")
+  if (rootNode.GetNameView() != "CompleteLifecycleActionResult")
   {
     resultNode = rootNode.FirstChild("CompleteLifecycleActionResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/CreateAutoScalingGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -48,21 +49,21 @@ CreateAutoScalingGroupRequest::CreateAutoScalingGroupRequest() :
 
 Aws::String CreateAutoScalingGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateAutoScalingGroup&";
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_launchConfigurationNameHasBeenSet)
   {
-    ss << "LaunchConfigurationName=" << StringUtils::URLEncode(m_launchConfigurationName.c_str()) << "&";
+    ss << "LaunchConfigurationName=" << StringUtils::URLEncoded(m_launchConfigurationName) << "&";
   }
 
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_minSizeHasBeenSet)
@@ -91,7 +92,7 @@ Aws::String CreateAutoScalingGroupRequest::SerializePayload() const
     for(auto& item : m_availabilityZones)
     {
       ss << "AvailabilityZones.member." << availabilityZonesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       availabilityZonesCount++;
     }
   }
@@ -102,7 +103,7 @@ Aws::String CreateAutoScalingGroupRequest::SerializePayload() const
     for(auto& item : m_loadBalancerNames)
     {
       ss << "LoadBalancerNames.member." << loadBalancerNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       loadBalancerNamesCount++;
     }
   }
@@ -113,14 +114,14 @@ Aws::String CreateAutoScalingGroupRequest::SerializePayload() const
     for(auto& item : m_targetGroupARNs)
     {
       ss << "TargetGroupARNs.member." << targetGroupARNsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       targetGroupARNsCount++;
     }
   }
 
   if(m_healthCheckTypeHasBeenSet)
   {
-    ss << "HealthCheckType=" << StringUtils::URLEncode(m_healthCheckType.c_str()) << "&";
+    ss << "HealthCheckType=" << StringUtils::URLEncoded(m_healthCheckType) << "&";
   }
 
   if(m_healthCheckGracePeriodHasBeenSet)
@@ -130,12 +131,12 @@ Aws::String CreateAutoScalingGroupRequest::SerializePayload() const
 
   if(m_placementGroupHasBeenSet)
   {
-    ss << "PlacementGroup=" << StringUtils::URLEncode(m_placementGroup.c_str()) << "&";
+    ss << "PlacementGroup=" << StringUtils::URLEncoded(m_placementGroup) << "&";
   }
 
   if(m_vPCZoneIdentifierHasBeenSet)
   {
-    ss << "VPCZoneIdentifier=" << StringUtils::URLEncode(m_vPCZoneIdentifier.c_str()) << "&";
+    ss << "VPCZoneIdentifier=" << StringUtils::URLEncoded(m_vPCZoneIdentifier) << "&";
   }
 
   if(m_terminationPoliciesHasBeenSet)
@@ -144,7 +145,7 @@ Aws::String CreateAutoScalingGroupRequest::SerializePayload() const
     for(auto& item : m_terminationPolicies)
     {
       ss << "TerminationPolicies.member." << terminationPoliciesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       terminationPoliciesCount++;
     }
   }
@@ -165,6 +166,6 @@ Aws::String CreateAutoScalingGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
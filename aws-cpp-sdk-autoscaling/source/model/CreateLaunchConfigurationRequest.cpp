@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/CreateLaunchConfigurationRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -45,21 +46,21 @@ CreateLaunchConfigurationRequest::CreateLaunchConfigurationRequest() :
 
 Aws::String CreateLaunchConfigurationRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateLaunchConfiguration&";
   if(m_launchConfigurationNameHasBeenSet)
   {
-    ss << "LaunchConfigurationName=" << StringUtils::URLEncode(m_launchConfigurationName.c_str()) << "&";
+    ss << "LaunchConfigurationName=" << StringUtils::URLEncoded(m_launchConfigurationName) << "&";
   }
 
   if(m_imageIdHasBeenSet)
   {
-    ss << "ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+    ss << "ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
 
   if(m_keyNameHasBeenSet)
   {
-    ss << "KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+    ss << "KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
 
   if(m_securityGroupsHasBeenSet)
@@ -68,14 +69,14 @@ Aws::String CreateLaunchConfigurationRequest::SerializePayload() const
     for(auto& item : m_securityGroups)
     {
       ss << "SecurityGroups.member." << securityGroupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       securityGroupsCount++;
     }
   }
 
   if(m_classicLinkVPCIdHasBeenSet)
   {
-    ss << "ClassicLinkVPCId=" << StringUtils::URLEncode(m_classicLinkVPCId.c_str()) << "&";
+    ss << "ClassicLinkVPCId=" << StringUtils::URLEncoded(m_classicLinkVPCId) << "&";
   }
 
   if(m_classicLinkVPCSecurityGroupsHasBeenSet)
@@ -84,34 +85,34 @@ Aws::String CreateLaunchConfigurationRequest::SerializePayload() const
     for(auto& item : m_classicLinkVPCSecurityGroups)
     {
       ss << "ClassicLinkVPCSecurityGroups.member." << classicLinkVPCSecurityGroupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       classicLinkVPCSecurityGroupsCount++;
     }
   }
 
   if(m_userDataHasBeenSet)
   {
-    ss << "UserData=" << StringUtils::URLEncode(m_userData.c_str()) << "&";
+    ss << "UserData=" << StringUtils::URLEncoded(m_userData) << "&";
   }
 
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_instanceTypeHasBeenSet)
   {
-    ss << "InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+    ss << "InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
 
   if(m_kernelIdHasBeenSet)
   {
-    ss << "KernelId=" << StringUtils::URLEncode(m_kernelId.c_str()) << "&";
+    ss << "KernelId=" << StringUtils::URLEncoded(m_kernelId) << "&";
   }
 
   if(m_ramdiskIdHasBeenSet)
   {
-    ss << "RamdiskId=" << StringUtils::URLEncode(m_ramdiskId.c_str()) << "&";
+    ss << "RamdiskId=" << StringUtils::URLEncoded(m_ramdiskId) << "&";
   }
 
   if(m_blockDeviceMappingsHasBeenSet)
@@ -131,12 +132,12 @@ Aws::String CreateLaunchConfigurationRequest::SerializePayload() const
 
   if(m_spotPriceHasBeenSet)
   {
-    ss << "SpotPrice=" << StringUtils::URLEncode(m_spotPrice.c_str()) << "&";
+    ss << "SpotPrice=" << StringUtils::URLEncoded(m_spotPrice) << "&";
   }
 
   if(m_iamInstanceProfileHasBeenSet)
   {
-    ss << "IamInstanceProfile=" << StringUtils::URLEncode(m_iamInstanceProfile.c_str()) << "&";
+    ss << "IamInstanceProfile=" << StringUtils::URLEncoded(m_iamInstanceProfile) << "&";
   }
 
   if(m_ebsOptimizedHasBeenSet)
@@ -151,10 +152,10 @@ Aws::String CreateLaunchConfigurationRequest::SerializePayload() const
 
   if(m_placementTenancyHasBeenSet)
   {
-    ss << "PlacementTenancy=" << StringUtils::URLEncode(m_placementTenancy.c_str()) << "&";
+    ss << "PlacementTenancy=" << StringUtils::URLEncoded(m_placementTenancy) << "&";
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
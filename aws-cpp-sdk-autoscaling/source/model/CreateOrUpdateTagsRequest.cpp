@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/CreateOrUpdateTagsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -26,7 +27,7 @@ CreateOrUpdateTagsRequest::CreateOrUpdateTagsRequest() :
 
 Aws::String CreateOrUpdateTagsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateOrUpdateTags&";
   if(m_tagsHasBeenSet)
   {
@@ -39,6 +40,6 @@ Aws::String CreateOrUpdateTagsRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/DeleteAutoScalingGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -28,11 +29,11 @@ DeleteAutoScalingGroupRequest::DeleteAutoScalingGroupRequest() :
 
 Aws::String DeleteAutoScalingGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteAutoScalingGroup&";
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_forceDeleteHasBeenSet)
@@ -41,6 +42,6 @@ Aws::String DeleteAutoScalingGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/DeleteLaunchConfigurationRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteLaunchConfigurationRequest::DeleteLaunchConfigurationRequest() :
 
 Aws::String DeleteLaunchConfigurationRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteLaunchConfiguration&";
   if(m_launchConfigurationNameHasBeenSet)
   {
-    ss << "LaunchConfigurationName=" << StringUtils::URLEncode(m_launchConfigurationName.c_str()) << "&";
+    ss << "LaunchConfigurationName=" << StringUtils::URLEncoded(m_launchConfigurationName) << "&";
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
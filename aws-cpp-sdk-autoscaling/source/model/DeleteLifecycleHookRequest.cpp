@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/DeleteLifecycleHookRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ DeleteLifecycleHookRequest::DeleteLifecycleHookRequest() :
 
 Aws::String DeleteLifecycleHookRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteLifecycleHook&";
   if(m_lifecycleHookNameHasBeenSet)
   {
-    ss << "LifecycleHookName=" << StringUtils::URLEncode(m_lifecycleHookName.c_str()) << "&";
+    ss << "LifecycleHookName=" << StringUtils::URLEncoded(m_lifecycleHookName) << "&";
   }
 
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DeleteLifecycleHookResult& DeleteLifecycleHookResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteLifecycleHookResult")
+  if (rootNode.GetNameView() != "DeleteLifecycleHookResult")
   {
     resultNode = rootNode.FirstChild("DeleteLifecycleHookResult");
   }
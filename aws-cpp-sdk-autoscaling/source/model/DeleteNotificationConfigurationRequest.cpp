@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/DeleteNotificationConfigurationRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ DeleteNotificationConfigurationRequest::DeleteNotificationConfigurationRequest()
 
 Aws::String DeleteNotificationConfigurationRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteNotificationConfiguration&";
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_topicARNHasBeenSet)
   {
-    ss << "TopicARN=" << StringUtils::URLEncode(m_topicARN.c_str()) << "&";
+    ss << "TopicARN=" << StringUtils::URLEncoded(m_topicARN) << "&";
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -48,7 +48,7 @@ DescribeAccountLimitsResult& DescribeAccountLimitsResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeAccountLimitsResult")
+  if (rootNode.GetNameView() != "DescribeAccountLimitsResult")
   {
     resultNode = rootNode.FirstChild("DescribeAccountLimitsResult");
   }
@@ -58,22 +58,22 @@ DescribeAccountLimitsResult& DescribeAccountLimitsResult::operator =(const Amazo
     XmlNode maxNumberOfAutoScalingGroupsNode = resultNode.FirstChild("MaxNumberOfAutoScalingGroups");
     if(!maxNumberOfAutoScalingGroupsNode.IsNull())
     {
-      m_maxNumberOfAutoScalingGroups = StringUtils::ConvertToInt32(StringUtils::Trim(maxNumberOfAutoScalingGroupsNode.GetText().c_str()).c_str());
+      m_maxNumberOfAutoScalingGroups = StringUtils::ConvertToInt32(maxNumberOfAutoScalingGroupsNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode maxNumberOfLaunchConfigurationsNode = resultNode.FirstChild("MaxNumberOfLaunchConfigurations");
     if(!maxNumberOfLaunchConfigurationsNode.IsNull())
     {
-      m_maxNumberOfLaunchConfigurations = StringUtils::ConvertToInt32(StringUtils::Trim(maxNumberOfLaunchConfigurationsNode.GetText().c_str()).c_str());
+      m_maxNumberOfLaunchConfigurations = StringUtils::ConvertToInt32(maxNumberOfLaunchConfigurationsNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode numberOfAutoScalingGroupsNode = resultNode.FirstChild("NumberOfAutoScalingGroups");
     if(!numberOfAutoScalingGroupsNode.IsNull())
     {
-      m_numberOfAutoScalingGroups = StringUtils::ConvertToInt32(StringUtils::Trim(numberOfAutoScalingGroupsNode.GetText().c_str()).c_str());
+      m_numberOfAutoScalingGroups = StringUtils::ConvertToInt32(numberOfAutoScalingGroupsNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode numberOfLaunchConfigurationsNode = resultNode.FirstChild("NumberOfLaunchConfigurations");
     if(!numberOfLaunchConfigurationsNode.IsNull())
     {
-      m_numberOfLaunchConfigurations = StringUtils::ConvertToInt32(StringUtils::Trim(numberOfLaunchConfigurationsNode.GetText().c_str()).c_str());
+      m_numberOfLaunchConfigurations = StringUtils::ConvertToInt32(numberOfLaunchConfigurationsNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -40,7 +40,7 @@ DescribeAdjustmentTypesResult& DescribeAdjustmentTypesResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeAdjustmentTypesResult")
+  if (rootNode.GetNameView() != "DescribeAdjustmentTypesResult")
   {
     resultNode = rootNode.FirstChild("DescribeAdjustmentTypesResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/DescribeAutoScalingGroupsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ DescribeAutoScalingGroupsRequest::DescribeAutoScalingGroupsRequest() :
 
 Aws::String DescribeAutoScalingGroupsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeAutoScalingGroups&";
   if(m_autoScalingGroupNamesHasBeenSet)
   {
@@ -37,14 +38,14 @@ Aws::String DescribeAutoScalingGroupsRequest::SerializePayload() const
     for(auto& item : m_autoScalingGroupNames)
     {
       ss << "AutoScalingGroupNames.member." << autoScalingGroupNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       autoScalingGroupNamesCount++;
     }
   }
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -53,6 +54,6 @@ Aws::String DescribeAutoScalingGroupsRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeAutoScalingGroupsResult& DescribeAutoScalingGroupsResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeAutoScalingGroupsResult")
+  if (rootNode.GetNameView() != "DescribeAutoScalingGroupsResult")
   {
     resultNode = rootNode.FirstChild("DescribeAutoScalingGroupsResult");
   }
@@ -61,7 +61,7 @@ DescribeAutoScalingGroupsResult& DescribeAutoScalingGroupsResult::operator =(con
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/DescribeAutoScalingInstancesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ DescribeAutoScalingInstancesRequest::DescribeAutoScalingInstancesRequest() :
 
 Aws::String DescribeAutoScalingInstancesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeAutoScalingInstances&";
   if(m_instanceIdsHasBeenSet)
   {
@@ -37,7 +38,7 @@ Aws::String DescribeAutoScalingInstancesRequest::SerializePayload() const
     for(auto& item : m_instanceIds)
     {
       ss << "InstanceIds.member." << instanceIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       instanceIdsCount++;
     }
   }
@@ -49,10 +50,10 @@ Aws::String DescribeAutoScalingInstancesRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
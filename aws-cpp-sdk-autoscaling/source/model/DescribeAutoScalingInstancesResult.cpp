@@ -40,7 +40,7 @@ DescribeAutoScalingInstancesResult& DescribeAutoScalingInstancesResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeAutoScalingInstancesResult")
+  if (rootNode.GetNameView() != "DescribeAutoScalingInstancesResult")
   {
     resultNode = rootNode.FirstChild("DescribeAutoScalingInstancesResult");
   }
@@ -61,7 +61,7 @@ DescribeAutoScalingInstancesResult& DescribeAutoScalingInstancesResult::operator
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ DescribeAutoScalingNotificationTypesResult& DescribeAutoScalingNotificationTypes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeAutoScalingNotificationTypesResult")
+  if (rootNode.GetNameView() != "DescribeAutoScalingNotificationTypesResult")
   {
     resultNode = rootNode.FirstChild("DescribeAutoScalingNotificationTypesResult");
   }
@@ -53,7 +53,7 @@ DescribeAutoScalingNotificationTypesResult& DescribeAutoScalingNotificationTypes
       XmlNode autoScalingNotificationTypesMember = autoScalingNotificationTypesNode.FirstChild("member");
       while(!autoScalingNotificationTypesMember.IsNull())
       {
-        m_autoScalingNotificationTypes.push_back(StringUtils::Trim(autoScalingNotificationTypesMember.GetText().c_str()));
+        m_autoScalingNotificationTypes.push_back(autoScalingNotificationTypesMember.GetTextView().Trim().ToString());
         autoScalingNotificationTypesMember = autoScalingNotificationTypesMember.NextNode("member");
       }
 
@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/DescribeLaunchConfigurationsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ DescribeLaunchConfigurationsRequest::DescribeLaunchConfigurationsRequest() :
 
 Aws::String DescribeLaunchConfigurationsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeLaunchConfigurations&";
   if(m_launchConfigurationNamesHasBeenSet)
   {
@@ -37,14 +38,14 @@ Aws::String DescribeLaunchConfigurationsRequest::SerializePayload() const
     for(auto& item : m_launchConfigurationNames)
     {
       ss << "LaunchConfigurationNames.member." << launchConfigurationNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       launchConfigurationNamesCount++;
     }
   }
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -53,6 +54,6 @@ Aws::String DescribeLaunchConfigurationsRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeLaunchConfigurationsResult& DescribeLaunchConfigurationsResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeLaunchConfigurationsResult")
+  if (rootNode.GetNameView() != "DescribeLaunchConfigurationsResult")
   {
     resultNode = rootNode.FirstChild("DescribeLaunchConfigurationsResult");
   }
@@ -61,7 +61,7 @@ DescribeLaunchConfigurationsResult& DescribeLaunchConfigurationsResult::operator
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
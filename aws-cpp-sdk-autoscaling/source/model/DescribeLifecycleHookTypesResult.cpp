@@ -40,7 +40,7 @@ DescribeLifecycleHookTypesResult& DescribeLifecycleHookTypesResult::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeLifecycleHookTypesResult")
+  if (rootNode.GetNameView() != "DescribeLifecycleHookTypesResult")
   {
     resultNode = rootNode.FirstChild("DescribeLifecycleHookTypesResult");
   }
@@ -53,7 +53,7 @@ DescribeLifecycleHookTypesResult& DescribeLifecycleHookTypesResult::operator =(c
       XmlNode lifecycleHookTypesMember = lifecycleHookTypesNode.FirstChild("member");
       while(!lifecycleHookTypesMember.IsNull())
       {
-        m_lifecycleHookTypes.push_back(StringUtils::Trim(lifecycleHookTypesMember.GetText().c_str()));
+        m_lifecycleHookTypes.push_back(lifecycleHookTypesMember.GetTextView().Trim().ToString());
         lifecycleHookTypesMember = lifecycleHookTypesMember.NextNode("member");
       }
 
@@ -40,7 +40,7 @@ DescribeLifecycleHooksResult& DescribeLifecycleHooksResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeLifecycleHooksResult")
+  if (rootNode.GetNameView() != "DescribeLifecycleHooksResult")
   {
     resultNode = rootNode.FirstChild("DescribeLifecycleHooksResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/DescribeLoadBalancerTargetGroupsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ DescribeLoadBalancerTargetGroupsRequest::DescribeLoadBalancerTargetGroupsRequest
 
 Aws::String DescribeLoadBalancerTargetGroupsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeLoadBalancerTargetGroups&";
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String DescribeLoadBalancerTargetGroupsRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
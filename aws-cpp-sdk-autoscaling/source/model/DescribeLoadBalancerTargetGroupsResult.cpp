@@ -40,7 +40,7 @@ DescribeLoadBalancerTargetGroupsResult& DescribeLoadBalancerTargetGroupsResult::
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeLoadBalancerTargetGroupsResult")
+  if (rootNode.GetNameView() != "DescribeLoadBalancerTargetGroupsResult")
   {
     resultNode = rootNode.FirstChild("DescribeLoadBalancerTargetGroupsResult");
   }
@@ -61,7 +61,7 @@ DescribeLoadBalancerTargetGroupsResult& DescribeLoadBalancerTargetGroupsResult::
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
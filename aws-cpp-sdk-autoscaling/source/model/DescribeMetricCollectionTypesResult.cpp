@@ -40,7 +40,7 @@ DescribeMetricCollectionTypesResult& DescribeMetricCollectionTypesResult::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeMetricCollectionTypesResult")
+  if (rootNode.GetNameView() != "DescribeMetricCollectionTypesResult")
   {
     resultNode = rootNode.FirstChild("DescribeMetricCollectionTypesResult");
   }
@@ -40,7 +40,7 @@ DescribeNotificationConfigurationsResult& DescribeNotificationConfigurationsResu
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeNotificationConfigurationsResult")
+  if (rootNode.GetNameView() != "DescribeNotificationConfigurationsResult")
   {
     resultNode = rootNode.FirstChild("DescribeNotificationConfigurationsResult");
   }
@@ -61,7 +61,7 @@ DescribeNotificationConfigurationsResult& DescribeNotificationConfigurationsResu
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/DescribePoliciesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -31,11 +32,11 @@ DescribePoliciesRequest::DescribePoliciesRequest() :
 
 Aws::String DescribePoliciesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribePolicies&";
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_policyNamesHasBeenSet)
@@ -44,7 +45,7 @@ Aws::String DescribePoliciesRequest::SerializePayload() const
     for(auto& item : m_policyNames)
     {
       ss << "PolicyNames.member." << policyNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       policyNamesCount++;
     }
   }
@@ -55,14 +56,14 @@ Aws::String DescribePoliciesRequest::SerializePayload() const
     for(auto& item : m_policyTypes)
     {
       ss << "PolicyTypes.member." << policyTypesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       policyTypesCount++;
     }
   }
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -71,6 +72,6 @@ Aws::String DescribePoliciesRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribePoliciesResult& DescribePoliciesResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribePoliciesResult")
+  if (rootNode.GetNameView() != "DescribePoliciesResult")
   {
     resultNode = rootNode.FirstChild("DescribePoliciesResult");
   }
@@ -61,7 +61,7 @@ DescribePoliciesResult& DescribePoliciesResult::operator =(const AmazonWebServic
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
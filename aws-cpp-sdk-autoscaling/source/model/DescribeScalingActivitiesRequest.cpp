@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/DescribeScalingActivitiesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ DescribeScalingActivitiesRequest::DescribeScalingActivitiesRequest() :
 
 Aws::String DescribeScalingActivitiesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeScalingActivities&";
   if(m_activityIdsHasBeenSet)
   {
@@ -38,14 +39,14 @@ Aws::String DescribeScalingActivitiesRequest::SerializePayload() const
     for(auto& item : m_activityIds)
     {
       ss << "ActivityIds.member." << activityIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       activityIdsCount++;
     }
   }
 
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -55,10 +56,10 @@ Aws::String DescribeScalingActivitiesRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeScalingActivitiesResult& DescribeScalingActivitiesResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeScalingActivitiesResult")
+  if (rootNode.GetNameView() != "DescribeScalingActivitiesResult")
   {
     resultNode = rootNode.FirstChild("DescribeScalingActivitiesResult");
   }
@@ -61,7 +61,7 @@ DescribeScalingActivitiesResult& DescribeScalingActivitiesResult::operator =(con
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/DescribeScalingProcessTypesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -25,9 +26,9 @@ DescribeScalingProcessTypesRequest::DescribeScalingProcessTypesRequest()
 
 Aws::String DescribeScalingProcessTypesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeScalingProcessTypes&";
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
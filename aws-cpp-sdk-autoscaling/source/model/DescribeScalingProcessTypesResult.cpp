@@ -40,7 +40,7 @@ DescribeScalingProcessTypesResult& DescribeScalingProcessTypesResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeScalingProcessTypesResult")
+  if (rootNode.GetNameView() != "DescribeScalingProcessTypesResult")
   {
     resultNode = rootNode.FirstChild("DescribeScalingProcessTypesResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/DescribeScheduledActionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -32,11 +33,11 @@ DescribeScheduledActionsRequest::DescribeScheduledActionsRequest() :
 
 Aws::String DescribeScheduledActionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeScheduledActions&";
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_scheduledActionNamesHasBeenSet)
@@ -45,24 +46,24 @@ Aws::String DescribeScheduledActionsRequest::SerializePayload() const
     for(auto& item : m_scheduledActionNames)
     {
       ss << "ScheduledActionNames.member." << scheduledActionNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       scheduledActionNamesCount++;
     }
   }
 
   if(m_startTimeHasBeenSet)
   {
-    ss << "StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_endTimeHasBeenSet)
   {
-    ss << "EndTime=" << StringUtils::URLEncode(m_endTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "EndTime=" << StringUtils::URLEncoded(m_endTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -71,6 +72,6 @@ Aws::String DescribeScheduledActionsRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeScheduledActionsResult& DescribeScheduledActionsResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeScheduledActionsResult")
+  if (rootNode.GetNameView() != "DescribeScheduledActionsResult")
   {
     resultNode = rootNode.FirstChild("DescribeScheduledActionsResult");
   }
@@ -61,7 +61,7 @@ DescribeScheduledActionsResult& DescribeScheduledActionsResult::operator =(const
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/DescribeTagsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ DescribeTagsRequest::DescribeTagsRequest() :
 
 Aws::String DescribeTagsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeTags&";
   if(m_filtersHasBeenSet)
   {
@@ -43,7 +44,7 @@ Aws::String DescribeTagsRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -52,6 +53,6 @@ Aws::String DescribeTagsRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
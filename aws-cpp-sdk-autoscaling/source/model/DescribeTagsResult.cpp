@@ -40,7 +40,7 @@ DescribeTagsResult& DescribeTagsResult::operator =(const AmazonWebServiceResult<
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeTagsResult")
+  if (rootNode.GetNameView() != "DescribeTagsResult")
   {
     resultNode = rootNode.FirstChild("DescribeTagsResult");
   }
@@ -61,7 +61,7 @@ DescribeTagsResult& DescribeTagsResult::operator =(const AmazonWebServiceResult<
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ DescribeTerminationPolicyTypesResult& DescribeTerminationPolicyTypesResult::oper
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeTerminationPolicyTypesResult")
+  if (rootNode.GetNameView() != "DescribeTerminationPolicyTypesResult")
   {
     resultNode = rootNode.FirstChild("DescribeTerminationPolicyTypesResult");
   }
@@ -53,7 +53,7 @@ DescribeTerminationPolicyTypesResult& DescribeTerminationPolicyTypesResult::oper
       XmlNode terminationPolicyTypesMember = terminationPolicyTypesNode.FirstChild("member");
       while(!terminationPolicyTypesMember.IsNull())
       {
-        m_terminationPolicyTypes.push_back(StringUtils::Trim(terminationPolicyTypesMember.GetText().c_str()));
+        m_terminationPolicyTypes.push_back(terminationPolicyTypesMember.GetTextView().Trim().ToString());
         terminationPolicyTypesMember = terminationPolicyTypesMember.NextNode("member");
       }
 
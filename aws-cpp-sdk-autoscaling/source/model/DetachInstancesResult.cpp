@@ -40,7 +40,7 @@ DetachInstancesResult& DetachInstancesResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DetachInstancesResult")
+  if (rootNode.GetNameView() != "DetachInstancesResult")
   {
     resultNode = rootNode.FirstChild("DetachInstancesResult");
   }
@@ -40,7 +40,7 @@ DetachLoadBalancerTargetGroupsResult& DetachLoadBalancerTargetGroupsResult::oper
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DetachLoadBalancerTargetGroupsResult")
+  if (rootNode.GetNameView() != "DetachLoadBalancerTargetGroupsResult")
   {
     resultNode = rootNode.FirstChild("DetachLoadBalancerTargetGroupsResult");
   }
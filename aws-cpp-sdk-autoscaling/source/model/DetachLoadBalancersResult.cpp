@@ -40,7 +40,7 @@ DetachLoadBalancersResult& DetachLoadBalancersResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DetachLoadBalancersResult")
+  if (rootNode.GetNameView() != "DetachLoadBalancersResult")
   {
     resultNode = rootNode.FirstChild("DetachLoadBalancersResult");
   }
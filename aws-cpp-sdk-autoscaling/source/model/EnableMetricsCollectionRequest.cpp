@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/EnableMetricsCollectionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -28,11 +29,11 @@ EnableMetricsCollectionRequest::EnableMetricsCollectionRequest() :
 
 Aws::String EnableMetricsCollectionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=EnableMetricsCollection&";
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_metricsHasBeenSet)
@@ -41,17 +42,17 @@ Aws::String EnableMetricsCollectionRequest::SerializePayload() const
     for(auto& item : m_metrics)
     {
       ss << "Metrics.member." << metricsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       metricsCount++;
     }
   }
 
   if(m_granularityHasBeenSet)
   {
-    ss << "Granularity=" << StringUtils::URLEncode(m_granularity.c_str()) << "&";
+    ss << "Granularity=" << StringUtils::URLEncoded(m_granularity) << "&";
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -51,13 +51,13 @@ EnabledMetric& EnabledMetric::operator =(const XmlNode& xmlNode)
     XmlNode metricNode = resultNode.FirstChild("Metric");
     if(!metricNode.IsNull())
     {
-      m_metric = StringUtils::Trim(metricNode.GetText().c_str());
+      m_metric = metricNode.GetTextView().Trim().ToString();
       m_metricHasBeenSet = true;
     }
     XmlNode granularityNode = resultNode.FirstChild("Granularity");
     if(!granularityNode.IsNull())
     {
-      m_granularity = StringUtils::Trim(granularityNode.GetText().c_str());
+      m_granularity = granularityNode.GetTextView().Trim().ToString();
       m_granularityHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void EnabledMetric::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_metricHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Metric=" << StringUtils::URLEncode(m_metric.c_str()) << "&";
+      oStream << location << index << locationValue << ".Metric=" << StringUtils::URLEncoded(m_metric) << "&";
   }
 
   if(m_granularityHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Granularity=" << StringUtils::URLEncode(m_granularity.c_str()) << "&";
+      oStream << location << index << locationValue << ".Granularity=" << StringUtils::URLEncoded(m_granularity) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void EnabledMetric::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_metricHasBeenSet)
   {
-      oStream << location << ".Metric=" << StringUtils::URLEncode(m_metric.c_str()) << "&";
+      oStream << location << ".Metric=" << StringUtils::URLEncoded(m_metric) << "&";
   }
   if(m_granularityHasBeenSet)
   {
-      oStream << location << ".Granularity=" << StringUtils::URLEncode(m_granularity.c_str()) << "&";
+      oStream << location << ".Granularity=" << StringUtils::URLEncoded(m_granularity) << "&";
   }
 }
 
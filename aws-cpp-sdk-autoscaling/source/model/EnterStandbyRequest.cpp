@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/EnterStandbyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ EnterStandbyRequest::EnterStandbyRequest() :
 
 Aws::String EnterStandbyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=EnterStandby&";
   if(m_instanceIdsHasBeenSet)
   {
@@ -37,14 +38,14 @@ Aws::String EnterStandbyRequest::SerializePayload() const
     for(auto& item : m_instanceIds)
     {
       ss << "InstanceIds.member." << instanceIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       instanceIdsCount++;
     }
   }
 
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_shouldDecrementDesiredCapacityHasBeenSet)
@@ -53,6 +54,6 @@ Aws::String EnterStandbyRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
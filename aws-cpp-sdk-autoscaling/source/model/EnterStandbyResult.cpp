@@ -40,7 +40,7 @@ EnterStandbyResult& EnterStandbyResult::operator =(const AmazonWebServiceResult<
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "EnterStandbyResult")
+  if (rootNode.GetNameView() != "EnterStandbyResult")
   {
     resultNode = rootNode.FirstChild("EnterStandbyResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/ExecutePolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -33,16 +34,16 @@ ExecutePolicyRequest::ExecutePolicyRequest() :
 
 Aws::String ExecutePolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ExecutePolicy&";
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_policyNameHasBeenSet)
   {
-    ss << "PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+    ss << "PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
 
   if(m_honorCooldownHasBeenSet)
@@ -61,6 +62,6 @@ Aws::String ExecutePolicyRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
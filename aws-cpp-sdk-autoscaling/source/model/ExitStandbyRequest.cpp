@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/ExitStandbyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -27,7 +28,7 @@ ExitStandbyRequest::ExitStandbyRequest() :
 
 Aws::String ExitStandbyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ExitStandby&";
   if(m_instanceIdsHasBeenSet)
   {
@@ -35,17 +36,17 @@ Aws::String ExitStandbyRequest::SerializePayload() const
     for(auto& item : m_instanceIds)
     {
       ss << "InstanceIds.member." << instanceIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       instanceIdsCount++;
     }
   }
 
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ExitStandbyResult& ExitStandbyResult::operator =(const AmazonWebServiceResult<Xm
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ExitStandbyResult")
+  if (rootNode.GetNameView() != "ExitStandbyResult")
   {
     resultNode = rootNode.FirstChild("ExitStandbyResult");
   }
@@ -51,7 +51,7 @@ InstanceMonitoring& InstanceMonitoring::operator =(const XmlNode& xmlNode)
     XmlNode enabledNode = resultNode.FirstChild("Enabled");
     if(!enabledNode.IsNull())
     {
-      m_enabled = StringUtils::ConvertToBool(StringUtils::Trim(enabledNode.GetText().c_str()).c_str());
+      m_enabled = StringUtils::ConvertToBool(enabledNode.GetTextView().Trim().ToString().c_str());
       m_enabledHasBeenSet = true;
     }
   }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -89,25 +90,25 @@ LaunchConfiguration& LaunchConfiguration::operator =(const XmlNode& xmlNode)
     XmlNode launchConfigurationNameNode = resultNode.FirstChild("LaunchConfigurationName");
     if(!launchConfigurationNameNode.IsNull())
     {
-      m_launchConfigurationName = StringUtils::Trim(launchConfigurationNameNode.GetText().c_str());
+      m_launchConfigurationName = launchConfigurationNameNode.GetTextView().Trim().ToString();
       m_launchConfigurationNameHasBeenSet = true;
     }
     XmlNode launchConfigurationARNNode = resultNode.FirstChild("LaunchConfigurationARN");
     if(!launchConfigurationARNNode.IsNull())
     {
-      m_launchConfigurationARN = StringUtils::Trim(launchConfigurationARNNode.GetText().c_str());
+      m_launchConfigurationARN = launchConfigurationARNNode.GetTextView().Trim().ToString();
       m_launchConfigurationARNHasBeenSet = true;
     }
     XmlNode imageIdNode = resultNode.FirstChild("ImageId");
     if(!imageIdNode.IsNull())
     {
-      m_imageId = StringUtils::Trim(imageIdNode.GetText().c_str());
+      m_imageId = imageIdNode.GetTextView().Trim().ToString();
       m_imageIdHasBeenSet = true;
     }
     XmlNode keyNameNode = resultNode.FirstChild("KeyName");
     if(!keyNameNode.IsNull())
     {
-      m_keyName = StringUtils::Trim(keyNameNode.GetText().c_str());
+      m_keyName = keyNameNode.GetTextView().Trim().ToString();
       m_keyNameHasBeenSet = true;
     }
     XmlNode securityGroupsNode = resultNode.FirstChild("SecurityGroups");
@@ -116,7 +117,7 @@ LaunchConfiguration& LaunchConfiguration::operator =(const XmlNode& xmlNode)
       XmlNode securityGroupsMember = securityGroupsNode.FirstChild("member");
       while(!securityGroupsMember.IsNull())
       {
-        m_securityGroups.push_back(StringUtils::Trim(securityGroupsMember.GetText().c_str()));
+        m_securityGroups.push_back(securityGroupsMember.GetTextView().Trim().ToString());
         securityGroupsMember = securityGroupsMember.NextNode("member");
       }
 
@@ -125,7 +126,7 @@ LaunchConfiguration& LaunchConfiguration::operator =(const XmlNode& xmlNode)
     XmlNode classicLinkVPCIdNode = resultNode.FirstChild("ClassicLinkVPCId");
     if(!classicLinkVPCIdNode.IsNull())
     {
-      m_classicLinkVPCId = StringUtils::Trim(classicLinkVPCIdNode.GetText().c_str());
+      m_classicLinkVPCId = classicLinkVPCIdNode.GetTextView().Trim().ToString();
       m_classicLinkVPCIdHasBeenSet = true;
     }
     XmlNode classicLinkVPCSecurityGroupsNode = resultNode.FirstChild("ClassicLinkVPCSecurityGroups");
@@ -134,7 +135,7 @@ LaunchConfiguration& LaunchConfiguration::operator =(const XmlNode& xmlNode)
       XmlNode classicLinkVPCSecurityGroupsMember = classicLinkVPCSecurityGroupsNode.FirstChild("member");
       while(!classicLinkVPCSecurityGroupsMember.IsNull())
       {
-        m_classicLinkVPCSecurityGroups.push_back(StringUtils::Trim(classicLinkVPCSecurityGroupsMember.GetText().c_str()));
+        m_classicLinkVPCSecurityGroups.push_back(classicLinkVPCSecurityGroupsMember.GetTextView().Trim().ToString());
         classicLinkVPCSecurityGroupsMember = classicLinkVPCSecurityGroupsMember.NextNode("member");
       }
 
@@ -143,25 +144,25 @@ LaunchConfiguration& LaunchConfiguration::operator =(const XmlNode& xmlNode)
     XmlNode userDataNode = resultNode.FirstChild("UserData");
     if(!userDataNode.IsNull())
     {
-      m_userData = StringUtils::Trim(userDataNode.GetText().c_str());
+      m_userData = userDataNode.GetTextView().Trim().ToString();
       m_userDataHasBeenSet = true;
     }
     XmlNode instanceTypeNode = resultNode.FirstChild("InstanceType");
     if(!instanceTypeNode.IsNull())
     {
-      m_instanceType = StringUtils::Trim(instanceTypeNode.GetText().c_str());
+      m_instanceType = instanceTypeNode.GetTextView().Trim().ToString();
       m_instanceTypeHasBeenSet = true;
     }
     XmlNode kernelIdNode = resultNode.FirstChild("KernelId");
     if(!kernelIdNode.IsNull())
     {
-      m_kernelId = StringUtils::Trim(kernelIdNode.GetText().c_str());
+      m_kernelId = kernelIdNode.GetTextView().Trim().ToString();
       m_kernelIdHasBeenSet = true;
     }
     XmlNode ramdiskIdNode = resultNode.FirstChild("RamdiskId");
     if(!ramdiskIdNode.IsNull())
     {
-      m_ramdiskId = StringUtils::Trim(ramdiskIdNode.GetText().c_str());
+      m_ramdiskId = ramdiskIdNode.GetTextView().Trim().ToString();
       m_ramdiskIdHasBeenSet = true;
     }
     XmlNode blockDeviceMappingsNode = resultNode.FirstChild("BlockDeviceMappings");
@@ -185,37 +186,37 @@ LaunchConfiguration& LaunchConfiguration::operator =(const XmlNode& xmlNode)
     XmlNode spotPriceNode = resultNode.FirstChild("SpotPrice");
     if(!spotPriceNode.IsNull())
     {
-      m_spotPrice = StringUtils::Trim(spotPriceNode.GetText().c_str());
+      m_spotPrice = spotPriceNode.GetTextView().Trim().ToString();
       m_spotPriceHasBeenSet = true;
     }
     XmlNode iamInstanceProfileNode = resultNode.FirstChild("IamInstanceProfile");
     if(!iamInstanceProfileNode.IsNull())
     {
-      m_iamInstanceProfile = StringUtils::Trim(iamInstanceProfileNode.GetText().c_str());
+      m_iamInstanceProfile = iamInstanceProfileNode.GetTextView().Trim().ToString();
       m_iamInstanceProfileHasBeenSet = true;
     }
     XmlNode createdTimeNode = resultNode.FirstChild("CreatedTime");
     if(!createdTimeNode.IsNull())
     {
-      m_createdTime = DateTime(StringUtils::Trim(createdTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createdTime = DateTime(createdTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createdTimeHasBeenSet = true;
     }
     XmlNode ebsOptimizedNode = resultNode.FirstChild("EbsOptimized");
     if(!ebsOptimizedNode.IsNull())
     {
-      m_ebsOptimized = StringUtils::ConvertToBool(StringUtils::Trim(ebsOptimizedNode.GetText().c_str()).c_str());
+      m_ebsOptimized = StringUtils::ConvertToBool(ebsOptimizedNode.GetTextView().Trim().ToString().c_str());
       m_ebsOptimizedHasBeenSet = true;
     }
     XmlNode associatePublicIpAddressNode = resultNode.FirstChild("AssociatePublicIpAddress");
     if(!associatePublicIpAddressNode.IsNull())
     {
-      m_associatePublicIpAddress = StringUtils::ConvertToBool(StringUtils::Trim(associatePublicIpAddressNode.GetText().c_str()).c_str());
+      m_associatePublicIpAddress = StringUtils::ConvertToBool(associatePublicIpAddressNode.GetTextView().Trim().ToString().c_str());
       m_associatePublicIpAddressHasBeenSet = true;
     }
     XmlNode placementTenancyNode = resultNode.FirstChild("PlacementTenancy");
     if(!placementTenancyNode.IsNull())
     {
-      m_placementTenancy = StringUtils::Trim(placementTenancyNode.GetText().c_str());
+      m_placementTenancy = placementTenancyNode.GetTextView().Trim().ToString();
       m_placementTenancyHasBeenSet = true;
     }
   }
@@ -227,22 +228,22 @@ void LaunchConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_launchConfigurationNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LaunchConfigurationName=" << StringUtils::URLEncode(m_launchConfigurationName.c_str()) << "&";
+      oStream << location << index << locationValue << ".LaunchConfigurationName=" << StringUtils::URLEncoded(m_launchConfigurationName) << "&";
   }
 
   if(m_launchConfigurationARNHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LaunchConfigurationARN=" << StringUtils::URLEncode(m_launchConfigurationARN.c_str()) << "&";
+      oStream << location << index << locationValue << ".LaunchConfigurationARN=" << StringUtils::URLEncoded(m_launchConfigurationARN) << "&";
   }
 
   if(m_imageIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
 
   if(m_keyNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+      oStream << location << index << locationValue << ".KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
 
   if(m_securityGroupsHasBeenSet)
@@ -250,13 +251,13 @@ void LaunchConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned securityGroupsIdx = 1;
       for(auto& item : m_securityGroups)
       {
-        oStream << location << index << locationValue << ".SecurityGroups.member." << securityGroupsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".SecurityGroups.member." << securityGroupsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
   if(m_classicLinkVPCIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClassicLinkVPCId=" << StringUtils::URLEncode(m_classicLinkVPCId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClassicLinkVPCId=" << StringUtils::URLEncoded(m_classicLinkVPCId) << "&";
   }
 
   if(m_classicLinkVPCSecurityGroupsHasBeenSet)
@@ -264,28 +265,28 @@ void LaunchConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned classicLinkVPCSecurityGroupsIdx = 1;
       for(auto& item : m_classicLinkVPCSecurityGroups)
       {
-        oStream << location << index << locationValue << ".ClassicLinkVPCSecurityGroups.member." << classicLinkVPCSecurityGroupsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".ClassicLinkVPCSecurityGroups.member." << classicLinkVPCSecurityGroupsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
   if(m_userDataHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UserData=" << StringUtils::URLEncode(m_userData.c_str()) << "&";
+      oStream << location << index << locationValue << ".UserData=" << StringUtils::URLEncoded(m_userData) << "&";
   }
 
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
 
   if(m_kernelIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KernelId=" << StringUtils::URLEncode(m_kernelId.c_str()) << "&";
+      oStream << location << index << locationValue << ".KernelId=" << StringUtils::URLEncoded(m_kernelId) << "&";
   }
 
   if(m_ramdiskIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RamdiskId=" << StringUtils::URLEncode(m_ramdiskId.c_str()) << "&";
+      oStream << location << index << locationValue << ".RamdiskId=" << StringUtils::URLEncoded(m_ramdiskId) << "&";
   }
 
   if(m_blockDeviceMappingsHasBeenSet)
@@ -293,32 +294,32 @@ void LaunchConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned blockDeviceMappingsIdx = 1;
       for(auto& item : m_blockDeviceMappings)
       {
-        Aws::StringStream blockDeviceMappingsSs;
+        Aws::Utils::Stream::StringOutputStream blockDeviceMappingsSs;
         blockDeviceMappingsSs << location << index << locationValue << ".BlockDeviceMappings.member." << blockDeviceMappingsIdx++;
-        item.OutputToStream(oStream, blockDeviceMappingsSs.str().c_str());
+        item.OutputToStream(oStream, blockDeviceMappingsSs.GetString().c_str());
       }
   }
 
   if(m_instanceMonitoringHasBeenSet)
   {
-      Aws::StringStream instanceMonitoringLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream instanceMonitoringLocationAndMemberSs;
       instanceMonitoringLocationAndMemberSs << location << index << locationValue << ".InstanceMonitoring";
-      m_instanceMonitoring.OutputToStream(oStream, instanceMonitoringLocationAndMemberSs.str().c_str());
+      m_instanceMonitoring.OutputToStream(oStream, instanceMonitoringLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_spotPriceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SpotPrice=" << StringUtils::URLEncode(m_spotPrice.c_str()) << "&";
+      oStream << location << index << locationValue << ".SpotPrice=" << StringUtils::URLEncoded(m_spotPrice) << "&";
   }
 
   if(m_iamInstanceProfileHasBeenSet)
   {
-      oStream << location << index << locationValue << ".IamInstanceProfile=" << StringUtils::URLEncode(m_iamInstanceProfile.c_str()) << "&";
+      oStream << location << index << locationValue << ".IamInstanceProfile=" << StringUtils::URLEncoded(m_iamInstanceProfile) << "&";
   }
 
   if(m_createdTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreatedTime=" << StringUtils::URLEncode(m_createdTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreatedTime=" << StringUtils::URLEncoded(m_createdTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_ebsOptimizedHasBeenSet)
@@ -333,7 +334,7 @@ void LaunchConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
 
   if(m_placementTenancyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PlacementTenancy=" << StringUtils::URLEncode(m_placementTenancy.c_str()) << "&";
+      oStream << location << index << locationValue << ".PlacementTenancy=" << StringUtils::URLEncoded(m_placementTenancy) << "&";
   }
 
 }
@@ -342,64 +343,64 @@ void LaunchConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_launchConfigurationNameHasBeenSet)
   {
-      oStream << location << ".LaunchConfigurationName=" << StringUtils::URLEncode(m_launchConfigurationName.c_str()) << "&";
+      oStream << location << ".LaunchConfigurationName=" << StringUtils::URLEncoded(m_launchConfigurationName) << "&";
   }
   if(m_launchConfigurationARNHasBeenSet)
   {
-      oStream << location << ".LaunchConfigurationARN=" << StringUtils::URLEncode(m_launchConfigurationARN.c_str()) << "&";
+      oStream << location << ".LaunchConfigurationARN=" << StringUtils::URLEncoded(m_launchConfigurationARN) << "&";
   }
   if(m_imageIdHasBeenSet)
   {
-      oStream << location << ".ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+      oStream << location << ".ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
   if(m_keyNameHasBeenSet)
   {
-      oStream << location << ".KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+      oStream << location << ".KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
   if(m_securityGroupsHasBeenSet)
   {
       unsigned securityGroupsIdx = 1;
       for(auto& item : m_securityGroups)
       {
-        oStream << location << ".SecurityGroups.member." << securityGroupsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".SecurityGroups.member." << securityGroupsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_classicLinkVPCIdHasBeenSet)
   {
-      oStream << location << ".ClassicLinkVPCId=" << StringUtils::URLEncode(m_classicLinkVPCId.c_str()) << "&";
+      oStream << location << ".ClassicLinkVPCId=" << StringUtils::URLEncoded(m_classicLinkVPCId) << "&";
   }
   if(m_classicLinkVPCSecurityGroupsHasBeenSet)
   {
       unsigned classicLinkVPCSecurityGroupsIdx = 1;
       for(auto& item : m_classicLinkVPCSecurityGroups)
       {
-        oStream << location << ".ClassicLinkVPCSecurityGroups.member." << classicLinkVPCSecurityGroupsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".ClassicLinkVPCSecurityGroups.member." << classicLinkVPCSecurityGroupsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_userDataHasBeenSet)
   {
-      oStream << location << ".UserData=" << StringUtils::URLEncode(m_userData.c_str()) << "&";
+      oStream << location << ".UserData=" << StringUtils::URLEncoded(m_userData) << "&";
   }
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
   if(m_kernelIdHasBeenSet)
   {
-      oStream << location << ".KernelId=" << StringUtils::URLEncode(m_kernelId.c_str()) << "&";
+      oStream << location << ".KernelId=" << StringUtils::URLEncoded(m_kernelId) << "&";
   }
   if(m_ramdiskIdHasBeenSet)
   {
-      oStream << location << ".RamdiskId=" << StringUtils::URLEncode(m_ramdiskId.c_str()) << "&";
+      oStream << location << ".RamdiskId=" << StringUtils::URLEncoded(m_ramdiskId) << "&";
   }
   if(m_blockDeviceMappingsHasBeenSet)
   {
       unsigned blockDeviceMappingsIdx = 1;
       for(auto& item : m_blockDeviceMappings)
       {
-        Aws::StringStream blockDeviceMappingsSs;
+        Aws::Utils::Stream::StringOutputStream blockDeviceMappingsSs;
         blockDeviceMappingsSs << location <<  ".BlockDeviceMappings.member." << blockDeviceMappingsIdx++;
-        item.OutputToStream(oStream, blockDeviceMappingsSs.str().c_str());
+        item.OutputToStream(oStream, blockDeviceMappingsSs.GetString().c_str());
       }
   }
   if(m_instanceMonitoringHasBeenSet)
@@ -410,15 +411,15 @@ void LaunchConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
   }
   if(m_spotPriceHasBeenSet)
   {
-      oStream << location << ".SpotPrice=" << StringUtils::URLEncode(m_spotPrice.c_str()) << "&";
+      oStream << location << ".SpotPrice=" << StringUtils::URLEncoded(m_spotPrice) << "&";
   }
   if(m_iamInstanceProfileHasBeenSet)
   {
-      oStream << location << ".IamInstanceProfile=" << StringUtils::URLEncode(m_iamInstanceProfile.c_str()) << "&";
+      oStream << location << ".IamInstanceProfile=" << StringUtils::URLEncoded(m_iamInstanceProfile) << "&";
   }
   if(m_createdTimeHasBeenSet)
   {
-      oStream << location << ".CreatedTime=" << StringUtils::URLEncode(m_createdTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreatedTime=" << StringUtils::URLEncoded(m_createdTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_ebsOptimizedHasBeenSet)
   {
@@ -430,7 +431,7 @@ void LaunchConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
   }
   if(m_placementTenancyHasBeenSet)
   {
-      oStream << location << ".PlacementTenancy=" << StringUtils::URLEncode(m_placementTenancy.c_str()) << "&";
+      oStream << location << ".PlacementTenancy=" << StringUtils::URLEncoded(m_placementTenancy) << "&";
   }
 }
 
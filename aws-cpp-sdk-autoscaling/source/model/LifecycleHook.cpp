@@ -69,55 +69,55 @@ LifecycleHook& LifecycleHook::operator =(const XmlNode& xmlNode)
     XmlNode lifecycleHookNameNode = resultNode.FirstChild("LifecycleHookName");
     if(!lifecycleHookNameNode.IsNull())
     {
-      m_lifecycleHookName = StringUtils::Trim(lifecycleHookNameNode.GetText().c_str());
+      m_lifecycleHookName = lifecycleHookNameNode.GetTextView().Trim().ToString();
       m_lifecycleHookNameHasBeenSet = true;
     }
     XmlNode autoScalingGroupNameNode = resultNode.FirstChild("AutoScalingGroupName");
     if(!autoScalingGroupNameNode.IsNull())
     {
-      m_autoScalingGroupName = StringUtils::Trim(autoScalingGroupNameNode.GetText().c_str());
+      m_autoScalingGroupName = autoScalingGroupNameNode.GetTextView().Trim().ToString();
       m_autoScalingGroupNameHasBeenSet = true;
     }
     XmlNode lifecycleTransitionNode = resultNode.FirstChild("LifecycleTransition");
     if(!lifecycleTransitionNode.IsNull())
     {
-      m_lifecycleTransition = StringUtils::Trim(lifecycleTransitionNode.GetText().c_str());
+      m_lifecycleTransition = lifecycleTransitionNode.GetTextView().Trim().ToString();
       m_lifecycleTransitionHasBeenSet = true;
     }
     XmlNode notificationTargetARNNode = resultNode.FirstChild("NotificationTargetARN");
     if(!notificationTargetARNNode.IsNull())
     {
-      m_notificationTargetARN = StringUtils::Trim(notificationTargetARNNode.GetText().c_str());
+      m_notificationTargetARN = notificationTargetARNNode.GetTextView().Trim().ToString();
       m_notificationTargetARNHasBeenSet = true;
     }
     XmlNode roleARNNode = resultNode.FirstChild("RoleARN");
     if(!roleARNNode.IsNull())
     {
-      m_roleARN = StringUtils::Trim(roleARNNode.GetText().c_str());
+      m_roleARN = roleARNNode.GetTextView().Trim().ToString();
       m_roleARNHasBeenSet = true;
     }
     XmlNode notificationMetadataNode = resultNode.FirstChild("NotificationMetadata");
     if(!notificationMetadataNode.IsNull())
     {
-      m_notificationMetadata = StringUtils::Trim(notificationMetadataNode.GetText().c_str());
+      m_notificationMetadata = notificationMetadataNode.GetTextView().Trim().ToString();
       m_notificationMetadataHasBeenSet = true;
     }
     XmlNode heartbeatTimeoutNode = resultNode.FirstChild("HeartbeatTimeout");
     if(!heartbeatTimeoutNode.IsNull())
     {
-      m_heartbeatTimeout = StringUtils::ConvertToInt32(StringUtils::Trim(heartbeatTimeoutNode.GetText().c_str()).c_str());
+      m_heartbeatTimeout = StringUtils::ConvertToInt32(heartbeatTimeoutNode.GetTextView().Trim().ToString().c_str());
       m_heartbeatTimeoutHasBeenSet = true;
     }
     XmlNode globalTimeoutNode = resultNode.FirstChild("GlobalTimeout");
     if(!globalTimeoutNode.IsNull())
     {
-      m_globalTimeout = StringUtils::ConvertToInt32(StringUtils::Trim(globalTimeoutNode.GetText().c_str()).c_str());
+      m_globalTimeout = StringUtils::ConvertToInt32(globalTimeoutNode.GetTextView().Trim().ToString().c_str());
       m_globalTimeoutHasBeenSet = true;
     }
     XmlNode defaultResultNode = resultNode.FirstChild("DefaultResult");
     if(!defaultResultNode.IsNull())
     {
-      m_defaultResult = StringUtils::Trim(defaultResultNode.GetText().c_str());
+      m_defaultResult = defaultResultNode.GetTextView().Trim().ToString();
       m_defaultResultHasBeenSet = true;
     }
   }
@@ -129,32 +129,32 @@ void LifecycleHook::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_lifecycleHookNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LifecycleHookName=" << StringUtils::URLEncode(m_lifecycleHookName.c_str()) << "&";
+      oStream << location << index << locationValue << ".LifecycleHookName=" << StringUtils::URLEncoded(m_lifecycleHookName) << "&";
   }
 
   if(m_autoScalingGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_lifecycleTransitionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LifecycleTransition=" << StringUtils::URLEncode(m_lifecycleTransition.c_str()) << "&";
+      oStream << location << index << locationValue << ".LifecycleTransition=" << StringUtils::URLEncoded(m_lifecycleTransition) << "&";
   }
 
   if(m_notificationTargetARNHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NotificationTargetARN=" << StringUtils::URLEncode(m_notificationTargetARN.c_str()) << "&";
+      oStream << location << index << locationValue << ".NotificationTargetARN=" << StringUtils::URLEncoded(m_notificationTargetARN) << "&";
   }
 
   if(m_roleARNHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RoleARN=" << StringUtils::URLEncode(m_roleARN.c_str()) << "&";
+      oStream << location << index << locationValue << ".RoleARN=" << StringUtils::URLEncoded(m_roleARN) << "&";
   }
 
   if(m_notificationMetadataHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NotificationMetadata=" << StringUtils::URLEncode(m_notificationMetadata.c_str()) << "&";
+      oStream << location << index << locationValue << ".NotificationMetadata=" << StringUtils::URLEncoded(m_notificationMetadata) << "&";
   }
 
   if(m_heartbeatTimeoutHasBeenSet)
@@ -169,7 +169,7 @@ void LifecycleHook::OutputToStream(Aws::OStream& oStream, const char* location,
 
   if(m_defaultResultHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DefaultResult=" << StringUtils::URLEncode(m_defaultResult.c_str()) << "&";
+      oStream << location << index << locationValue << ".DefaultResult=" << StringUtils::URLEncoded(m_defaultResult) << "&";
   }
 
 }
@@ -178,27 +178,27 @@ void LifecycleHook::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_lifecycleHookNameHasBeenSet)
   {
-      oStream << location << ".LifecycleHookName=" << StringUtils::URLEncode(m_lifecycleHookName.c_str()) << "&";
+      oStream << location << ".LifecycleHookName=" << StringUtils::URLEncoded(m_lifecycleHookName) << "&";
   }
   if(m_autoScalingGroupNameHasBeenSet)
   {
-      oStream << location << ".AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+      oStream << location << ".AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
   if(m_lifecycleTransitionHasBeenSet)
   {
-      oStream << location << ".LifecycleTransition=" << StringUtils::URLEncode(m_lifecycleTransition.c_str()) << "&";
+      oStream << location << ".LifecycleTransition=" << StringUtils::URLEncoded(m_lifecycleTransition) << "&";
   }
   if(m_notificationTargetARNHasBeenSet)
   {
-      oStream << location << ".NotificationTargetARN=" << StringUtils::URLEncode(m_notificationTargetARN.c_str()) << "&";
+      oStream << location << ".NotificationTargetARN=" << StringUtils::URLEncoded(m_notificationTargetARN) << "&";
   }
   if(m_roleARNHasBeenSet)
   {
-      oStream << location << ".RoleARN=" << StringUtils::URLEncode(m_roleARN.c_str()) << "&";
+      oStream << location << ".RoleARN=" << StringUtils::URLEncoded(m_roleARN) << "&";
   }
   if(m_notificationMetadataHasBeenSet)
   {
-      oStream << location << ".NotificationMetadata=" << StringUtils::URLEncode(m_notificationMetadata.c_str()) << "&";
+      oStream << location << ".NotificationMetadata=" << StringUtils::URLEncoded(m_notificationMetadata) << "&";
   }
   if(m_heartbeatTimeoutHasBeenSet)
   {
@@ -210,7 +210,7 @@ void LifecycleHook::OutputToStream(Aws::OStream& oStream, const char* location)
   }
   if(m_defaultResultHasBeenSet)
   {
-      oStream << location << ".DefaultResult=" << StringUtils::URLEncode(m_defaultResult.c_str()) << "&";
+      oStream << location << ".DefaultResult=" << StringUtils::URLEncoded(m_defaultResult) << "&";
   }
 }
 
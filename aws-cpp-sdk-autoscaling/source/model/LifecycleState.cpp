@@ -29,76 +29,62 @@ namespace Aws
       namespace LifecycleStateMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Pending_Wait_HASH = HashingUtils::HashString("Pending:Wait");
-        static const int Pending_Proceed_HASH = HashingUtils::HashString("Pending:Proceed");
-        static const int Quarantined_HASH = HashingUtils::HashString("Quarantined");
-        static const int InService_HASH = HashingUtils::HashString("InService");
-        static const int Terminating_HASH = HashingUtils::HashString("Terminating");
-        static const int Terminating_Wait_HASH = HashingUtils::HashString("Terminating:Wait");
-        static const int Terminating_Proceed_HASH = HashingUtils::HashString("Terminating:Proceed");
-        static const int Terminated_HASH = HashingUtils::HashString("Terminated");
-        static const int Detaching_HASH = HashingUtils::HashString("Detaching");
-        static const int Detached_HASH = HashingUtils::HashString("Detached");
-        static const int EnteringStandby_HASH = HashingUtils::HashString("EnteringStandby");
-        static const int Standby_HASH = HashingUtils::HashString("Standby");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Pending_HASH = 982065527;
+        static const int Pending_Wait_HASH = 292456888;
+        static const int Pending_Proceed_HASH = 963746187;
+        static const int Quarantined_HASH = -5840938;
+        static const int InService_HASH = -1010741840;
+        static const int Terminating_HASH = -250712386;
+        static const int Terminating_Wait_HASH = -2074513199;
+        static const int Terminating_Proceed_HASH = 1330950098;
+        static const int Terminated_HASH = 684649027;
+        static const int Detaching_HASH = 25236303;
+        static const int Detached_HASH = 1109192594;
+        static const int EnteringStandby_HASH = 1425998115;
+        static const int Standby_HASH = -232666483;
 
 
         LifecycleState GetLifecycleStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          switch (hashCode)
           {
+          case Pending_HASH:
             return LifecycleState::Pending;
-          }
-          else if (hashCode == Pending_Wait_HASH)
-          {
+          case Pending_Wait_HASH:
             return LifecycleState::Pending_Wait;
-          }
-          else if (hashCode == Pending_Proceed_HASH)
-          {
+          case Pending_Proceed_HASH:
             return LifecycleState::Pending_Proceed;
-          }
-          else if (hashCode == Quarantined_HASH)
-          {
+          case Quarantined_HASH:
             return LifecycleState::Quarantined;
-          }
-          else if (hashCode == InService_HASH)
-          {
+          case InService_HASH:
             return LifecycleState::InService;
-          }
-          else if (hashCode == Terminating_HASH)
-          {
+          case Terminating_HASH:
             return LifecycleState::Terminating;
-          }
-          else if (hashCode == Terminating_Wait_HASH)
-          {
+          case Terminating_Wait_HASH:
             return LifecycleState::Terminating_Wait;
-          }
-          else if (hashCode == Terminating_Proceed_HASH)
-          {
+          case Terminating_Proceed_HASH:
             return LifecycleState::Terminating_Proceed;
-          }
-          else if (hashCode == Terminated_HASH)
-          {
+          case Terminated_HASH:
             return LifecycleState::Terminated;
-          }
-          else if (hashCode == Detaching_HASH)
-          {
+          case Detaching_HASH:
             return LifecycleState::Detaching;
-          }
-          else if (hashCode == Detached_HASH)
-          {
+          case Detached_HASH:
             return LifecycleState::Detached;
-          }
-          else if (hashCode == EnteringStandby_HASH)
-          {
+          case EnteringStandby_HASH:
             return LifecycleState::EnteringStandby;
-          }
-          else if (hashCode == Standby_HASH)
-          {
+          case Standby_HASH:
             return LifecycleState::Standby;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -51,13 +51,13 @@ LoadBalancerState& LoadBalancerState::operator =(const XmlNode& xmlNode)
     XmlNode loadBalancerNameNode = resultNode.FirstChild("LoadBalancerName");
     if(!loadBalancerNameNode.IsNull())
     {
-      m_loadBalancerName = StringUtils::Trim(loadBalancerNameNode.GetText().c_str());
+      m_loadBalancerName = loadBalancerNameNode.GetTextView().Trim().ToString();
       m_loadBalancerNameHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("State");
     if(!stateNode.IsNull())
     {
-      m_state = StringUtils::Trim(stateNode.GetText().c_str());
+      m_state = stateNode.GetTextView().Trim().ToString();
       m_stateHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void LoadBalancerState::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_loadBalancerNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+      oStream << location << index << locationValue << ".LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
 
   if(m_stateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".State=" << StringUtils::URLEncode(m_state.c_str()) << "&";
+      oStream << location << index << locationValue << ".State=" << StringUtils::URLEncoded(m_state) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void LoadBalancerState::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_loadBalancerNameHasBeenSet)
   {
-      oStream << location << ".LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+      oStream << location << ".LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
   if(m_stateHasBeenSet)
   {
-      oStream << location << ".State=" << StringUtils::URLEncode(m_state.c_str()) << "&";
+      oStream << location << ".State=" << StringUtils::URLEncoded(m_state) << "&";
   }
 }
 
@@ -51,13 +51,13 @@ LoadBalancerTargetGroupState& LoadBalancerTargetGroupState::operator =(const Xml
     XmlNode loadBalancerTargetGroupARNNode = resultNode.FirstChild("LoadBalancerTargetGroupARN");
     if(!loadBalancerTargetGroupARNNode.IsNull())
     {
-      m_loadBalancerTargetGroupARN = StringUtils::Trim(loadBalancerTargetGroupARNNode.GetText().c_str());
+      m_loadBalancerTargetGroupARN = loadBalancerTargetGroupARNNode.GetTextView().Trim().ToString();
       m_loadBalancerTargetGroupARNHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("State");
     if(!stateNode.IsNull())
     {
-      m_state = StringUtils::Trim(stateNode.GetText().c_str());
+      m_state = stateNode.GetTextView().Trim().ToString();
       m_stateHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void LoadBalancerTargetGroupState::OutputToStream(Aws::OStream& oStream, const c
 {
   if(m_loadBalancerTargetGroupARNHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LoadBalancerTargetGroupARN=" << StringUtils::URLEncode(m_loadBalancerTargetGroupARN.c_str()) << "&";
+      oStream << location << index << locationValue << ".LoadBalancerTargetGroupARN=" << StringUtils::URLEncoded(m_loadBalancerTargetGroupARN) << "&";
   }
 
   if(m_stateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".State=" << StringUtils::URLEncode(m_state.c_str()) << "&";
+      oStream << location << index << locationValue << ".State=" << StringUtils::URLEncoded(m_state) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void LoadBalancerTargetGroupState::OutputToStream(Aws::OStream& oStream, const c
 {
   if(m_loadBalancerTargetGroupARNHasBeenSet)
   {
-      oStream << location << ".LoadBalancerTargetGroupARN=" << StringUtils::URLEncode(m_loadBalancerTargetGroupARN.c_str()) << "&";
+      oStream << location << ".LoadBalancerTargetGroupARN=" << StringUtils::URLEncoded(m_loadBalancerTargetGroupARN) << "&";
   }
   if(m_stateHasBeenSet)
   {
-      oStream << location << ".State=" << StringUtils::URLEncode(m_state.c_str()) << "&";
+      oStream << location << ".State=" << StringUtils::URLEncoded(m_state) << "&";
   }
 }
 
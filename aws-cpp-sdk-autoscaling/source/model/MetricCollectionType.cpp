@@ -49,7 +49,7 @@ MetricCollectionType& MetricCollectionType::operator =(const XmlNode& xmlNode)
     XmlNode metricNode = resultNode.FirstChild("Metric");
     if(!metricNode.IsNull())
     {
-      m_metric = StringUtils::Trim(metricNode.GetText().c_str());
+      m_metric = metricNode.GetTextView().Trim().ToString();
       m_metricHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void MetricCollectionType::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_metricHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Metric=" << StringUtils::URLEncode(m_metric.c_str()) << "&";
+      oStream << location << index << locationValue << ".Metric=" << StringUtils::URLEncoded(m_metric) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void MetricCollectionType::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_metricHasBeenSet)
   {
-      oStream << location << ".Metric=" << StringUtils::URLEncode(m_metric.c_str()) << "&";
+      oStream << location << ".Metric=" << StringUtils::URLEncoded(m_metric) << "&";
   }
 }
 
@@ -49,7 +49,7 @@ MetricGranularityType& MetricGranularityType::operator =(const XmlNode& xmlNode)
     XmlNode granularityNode = resultNode.FirstChild("Granularity");
     if(!granularityNode.IsNull())
     {
-      m_granularity = StringUtils::Trim(granularityNode.GetText().c_str());
+      m_granularity = granularityNode.GetTextView().Trim().ToString();
       m_granularityHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void MetricGranularityType::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_granularityHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Granularity=" << StringUtils::URLEncode(m_granularity.c_str()) << "&";
+      oStream << location << index << locationValue << ".Granularity=" << StringUtils::URLEncoded(m_granularity) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void MetricGranularityType::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_granularityHasBeenSet)
   {
-      oStream << location << ".Granularity=" << StringUtils::URLEncode(m_granularity.c_str()) << "&";
+      oStream << location << ".Granularity=" << StringUtils::URLEncoded(m_granularity) << "&";
   }
 }
 
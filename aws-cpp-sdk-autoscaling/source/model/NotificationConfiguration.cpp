@@ -53,19 +53,19 @@ NotificationConfiguration& NotificationConfiguration::operator =(const XmlNode&
     XmlNode autoScalingGroupNameNode = resultNode.FirstChild("AutoScalingGroupName");
     if(!autoScalingGroupNameNode.IsNull())
     {
-      m_autoScalingGroupName = StringUtils::Trim(autoScalingGroupNameNode.GetText().c_str());
+      m_autoScalingGroupName = autoScalingGroupNameNode.GetTextView().Trim().ToString();
       m_autoScalingGroupNameHasBeenSet = true;
     }
     XmlNode topicARNNode = resultNode.FirstChild("TopicARN");
     if(!topicARNNode.IsNull())
     {
-      m_topicARN = StringUtils::Trim(topicARNNode.GetText().c_str());
+      m_topicARN = topicARNNode.GetTextView().Trim().ToString();
       m_topicARNHasBeenSet = true;
     }
     XmlNode notificationTypeNode = resultNode.FirstChild("NotificationType");
     if(!notificationTypeNode.IsNull())
     {
-      m_notificationType = StringUtils::Trim(notificationTypeNode.GetText().c_str());
+      m_notificationType = notificationTypeNode.GetTextView().Trim().ToString();
       m_notificationTypeHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void NotificationConfiguration::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_autoScalingGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_topicARNHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TopicARN=" << StringUtils::URLEncode(m_topicARN.c_str()) << "&";
+      oStream << location << index << locationValue << ".TopicARN=" << StringUtils::URLEncoded(m_topicARN) << "&";
   }
 
   if(m_notificationTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NotificationType=" << StringUtils::URLEncode(m_notificationType.c_str()) << "&";
+      oStream << location << index << locationValue << ".NotificationType=" << StringUtils::URLEncoded(m_notificationType) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void NotificationConfiguration::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_autoScalingGroupNameHasBeenSet)
   {
-      oStream << location << ".AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+      oStream << location << ".AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
   if(m_topicARNHasBeenSet)
   {
-      oStream << location << ".TopicARN=" << StringUtils::URLEncode(m_topicARN.c_str()) << "&";
+      oStream << location << ".TopicARN=" << StringUtils::URLEncoded(m_topicARN) << "&";
   }
   if(m_notificationTypeHasBeenSet)
   {
-      oStream << location << ".NotificationType=" << StringUtils::URLEncode(m_notificationType.c_str()) << "&";
+      oStream << location << ".NotificationType=" << StringUtils::URLEncoded(m_notificationType) << "&";
   }
 }
 
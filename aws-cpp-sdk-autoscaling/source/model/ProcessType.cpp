@@ -49,7 +49,7 @@ ProcessType& ProcessType::operator =(const XmlNode& xmlNode)
     XmlNode processNameNode = resultNode.FirstChild("ProcessName");
     if(!processNameNode.IsNull())
     {
-      m_processName = StringUtils::Trim(processNameNode.GetText().c_str());
+      m_processName = processNameNode.GetTextView().Trim().ToString();
       m_processNameHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void ProcessType::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_processNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ProcessName=" << StringUtils::URLEncode(m_processName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ProcessName=" << StringUtils::URLEncoded(m_processName) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void ProcessType::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_processNameHasBeenSet)
   {
-      oStream << location << ".ProcessName=" << StringUtils::URLEncode(m_processName.c_str()) << "&";
+      oStream << location << ".ProcessName=" << StringUtils::URLEncoded(m_processName) << "&";
   }
 }
 
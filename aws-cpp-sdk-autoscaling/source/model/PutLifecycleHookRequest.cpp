@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/PutLifecycleHookRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -34,36 +35,36 @@ PutLifecycleHookRequest::PutLifecycleHookRequest() :
 
 Aws::String PutLifecycleHookRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=PutLifecycleHook&";
   if(m_lifecycleHookNameHasBeenSet)
   {
-    ss << "LifecycleHookName=" << StringUtils::URLEncode(m_lifecycleHookName.c_str()) << "&";
+    ss << "LifecycleHookName=" << StringUtils::URLEncoded(m_lifecycleHookName) << "&";
   }
 
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_lifecycleTransitionHasBeenSet)
   {
-    ss << "LifecycleTransition=" << StringUtils::URLEncode(m_lifecycleTransition.c_str()) << "&";
+    ss << "LifecycleTransition=" << StringUtils::URLEncoded(m_lifecycleTransition) << "&";
   }
 
   if(m_roleARNHasBeenSet)
   {
-    ss << "RoleARN=" << StringUtils::URLEncode(m_roleARN.c_str()) << "&";
+    ss << "RoleARN=" << StringUtils::URLEncoded(m_roleARN) << "&";
   }
 
   if(m_notificationTargetARNHasBeenSet)
   {
-    ss << "NotificationTargetARN=" << StringUtils::URLEncode(m_notificationTargetARN.c_str()) << "&";
+    ss << "NotificationTargetARN=" << StringUtils::URLEncoded(m_notificationTargetARN) << "&";
   }
 
   if(m_notificationMetadataHasBeenSet)
   {
-    ss << "NotificationMetadata=" << StringUtils::URLEncode(m_notificationMetadata.c_str()) << "&";
+    ss << "NotificationMetadata=" << StringUtils::URLEncoded(m_notificationMetadata) << "&";
   }
 
   if(m_heartbeatTimeoutHasBeenSet)
@@ -73,10 +74,10 @@ Aws::String PutLifecycleHookRequest::SerializePayload() const
 
   if(m_defaultResultHasBeenSet)
   {
-    ss << "DefaultResult=" << StringUtils::URLEncode(m_defaultResult.c_str()) << "&";
+    ss << "DefaultResult=" << StringUtils::URLEncoded(m_defaultResult) << "&";
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ PutLifecycleHookResult& PutLifecycleHookResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "PutLifecycleHookResult")
+  if (rootNode.GetNameView() != "PutLifecycleHookResult")
   {
     resultNode = rootNode.FirstChild("PutLifecycleHookResult");
   }
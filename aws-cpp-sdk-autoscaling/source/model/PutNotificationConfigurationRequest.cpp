@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/PutNotificationConfigurationRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ PutNotificationConfigurationRequest::PutNotificationConfigurationRequest() :
 
 Aws::String PutNotificationConfigurationRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=PutNotificationConfiguration&";
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_topicARNHasBeenSet)
   {
-    ss << "TopicARN=" << StringUtils::URLEncode(m_topicARN.c_str()) << "&";
+    ss << "TopicARN=" << StringUtils::URLEncoded(m_topicARN) << "&";
   }
 
   if(m_notificationTypesHasBeenSet)
@@ -46,12 +47,12 @@ Aws::String PutNotificationConfigurationRequest::SerializePayload() const
     for(auto& item : m_notificationTypes)
     {
       ss << "NotificationTypes.member." << notificationTypesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       notificationTypesCount++;
     }
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
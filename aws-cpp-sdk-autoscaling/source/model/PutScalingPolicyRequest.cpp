@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/PutScalingPolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -41,26 +42,26 @@ PutScalingPolicyRequest::PutScalingPolicyRequest() :
 
 Aws::String PutScalingPolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=PutScalingPolicy&";
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_policyNameHasBeenSet)
   {
-    ss << "PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+    ss << "PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
 
   if(m_policyTypeHasBeenSet)
   {
-    ss << "PolicyType=" << StringUtils::URLEncode(m_policyType.c_str()) << "&";
+    ss << "PolicyType=" << StringUtils::URLEncoded(m_policyType) << "&";
   }
 
   if(m_adjustmentTypeHasBeenSet)
   {
-    ss << "AdjustmentType=" << StringUtils::URLEncode(m_adjustmentType.c_str()) << "&";
+    ss << "AdjustmentType=" << StringUtils::URLEncoded(m_adjustmentType) << "&";
   }
 
   if(m_minAdjustmentStepHasBeenSet)
@@ -85,7 +86,7 @@ Aws::String PutScalingPolicyRequest::SerializePayload() const
 
   if(m_metricAggregationTypeHasBeenSet)
   {
-    ss << "MetricAggregationType=" << StringUtils::URLEncode(m_metricAggregationType.c_str()) << "&";
+    ss << "MetricAggregationType=" << StringUtils::URLEncoded(m_metricAggregationType) << "&";
   }
 
   if(m_stepAdjustmentsHasBeenSet)
@@ -104,6 +105,6 @@ Aws::String PutScalingPolicyRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
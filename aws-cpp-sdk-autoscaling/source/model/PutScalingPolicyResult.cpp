@@ -40,7 +40,7 @@ PutScalingPolicyResult& PutScalingPolicyResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "PutScalingPolicyResult")
+  if (rootNode.GetNameView() != "PutScalingPolicyResult")
   {
     resultNode = rootNode.FirstChild("PutScalingPolicyResult");
   }
@@ -50,7 +50,7 @@ PutScalingPolicyResult& PutScalingPolicyResult::operator =(const AmazonWebServic
     XmlNode policyARNNode = resultNode.FirstChild("PolicyARN");
     if(!policyARNNode.IsNull())
     {
-      m_policyARN = StringUtils::Trim(policyARNNode.GetText().c_str());
+      m_policyARN = policyARNNode.GetTextView().Trim().ToString();
     }
   }
 
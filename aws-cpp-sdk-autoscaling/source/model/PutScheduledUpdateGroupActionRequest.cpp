@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/PutScheduledUpdateGroupActionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -37,36 +38,36 @@ PutScheduledUpdateGroupActionRequest::PutScheduledUpdateGroupActionRequest() :
 
 Aws::String PutScheduledUpdateGroupActionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=PutScheduledUpdateGroupAction&";
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_scheduledActionNameHasBeenSet)
   {
-    ss << "ScheduledActionName=" << StringUtils::URLEncode(m_scheduledActionName.c_str()) << "&";
+    ss << "ScheduledActionName=" << StringUtils::URLEncoded(m_scheduledActionName) << "&";
   }
 
   if(m_timeHasBeenSet)
   {
-    ss << "Time=" << StringUtils::URLEncode(m_time.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "Time=" << StringUtils::URLEncoded(m_time.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_startTimeHasBeenSet)
   {
-    ss << "StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_endTimeHasBeenSet)
   {
-    ss << "EndTime=" << StringUtils::URLEncode(m_endTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "EndTime=" << StringUtils::URLEncoded(m_endTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_recurrenceHasBeenSet)
   {
-    ss << "Recurrence=" << StringUtils::URLEncode(m_recurrence.c_str()) << "&";
+    ss << "Recurrence=" << StringUtils::URLEncoded(m_recurrence) << "&";
   }
 
   if(m_minSizeHasBeenSet)
@@ -85,6 +86,6 @@ Aws::String PutScheduledUpdateGroupActionRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/RecordLifecycleActionHeartbeatRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -29,29 +30,29 @@ RecordLifecycleActionHeartbeatRequest::RecordLifecycleActionHeartbeatRequest() :
 
 Aws::String RecordLifecycleActionHeartbeatRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=RecordLifecycleActionHeartbeat&";
   if(m_lifecycleHookNameHasBeenSet)
   {
-    ss << "LifecycleHookName=" << StringUtils::URLEncode(m_lifecycleHookName.c_str()) << "&";
+    ss << "LifecycleHookName=" << StringUtils::URLEncoded(m_lifecycleHookName) << "&";
   }
 
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_lifecycleActionTokenHasBeenSet)
   {
-    ss << "LifecycleActionToken=" << StringUtils::URLEncode(m_lifecycleActionToken.c_str()) << "&";
+    ss << "LifecycleActionToken=" << StringUtils::URLEncoded(m_lifecycleActionToken) << "&";
   }
 
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
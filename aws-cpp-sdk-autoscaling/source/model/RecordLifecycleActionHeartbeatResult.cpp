@@ -40,7 +40,7 @@ RecordLifecycleActionHeartbeatResult& RecordLifecycleActionHeartbeatResult::oper
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RecordLifecycleActionHeartbeatResult")
+  if (rootNode.GetNameView() != "RecordLifecycleActionHeartbeatResult")
   {
     resultNode = rootNode.FirstChild("RecordLifecycleActionHeartbeatResult");
   }
@@ -29,71 +29,59 @@ namespace Aws
       namespace ScalingActivityStatusCodeMapper
       {
 
-        static const int PendingSpotBidPlacement_HASH = HashingUtils::HashString("PendingSpotBidPlacement");
-        static const int WaitingForSpotInstanceRequestId_HASH = HashingUtils::HashString("WaitingForSpotInstanceRequestId");
-        static const int WaitingForSpotInstanceId_HASH = HashingUtils::HashString("WaitingForSpotInstanceId");
-        static const int WaitingForInstanceId_HASH = HashingUtils::HashString("WaitingForInstanceId");
-        static const int PreInService_HASH = HashingUtils::HashString("PreInService");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int WaitingForELBConnectionDraining_HASH = HashingUtils::HashString("WaitingForELBConnectionDraining");
-        static const int MidLifecycleAction_HASH = HashingUtils::HashString("MidLifecycleAction");
-        static const int WaitingForInstanceWarmup_HASH = HashingUtils::HashString("WaitingForInstanceWarmup");
-        static const int Successful_HASH = HashingUtils::HashString("Successful");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PendingSpotBidPlacement_HASH = 1049261089;
+        static const int WaitingForSpotInstanceRequestId_HASH = 2018723863;
+        static const int WaitingForSpotInstanceId_HASH = 161750446;
+        static const int WaitingForInstanceId_HASH = 1543291148;
+        static const int PreInService_HASH = -636078451;
+        static const int InProgress_HASH = 646453906;
+        static const int WaitingForELBConnectionDraining_HASH = 1679717863;
+        static const int MidLifecycleAction_HASH = 1022693112;
+        static const int WaitingForInstanceWarmup_HASH = -1236506799;
+        static const int Successful_HASH = 1259833018;
+        static const int Failed_HASH = 2096857181;
+        static const int Cancelled_HASH = -1814410959;
 
 
         ScalingActivityStatusCode GetScalingActivityStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PendingSpotBidPlacement_HASH)
+          switch (hashCode)
           {
+          case PendingSpotBidPlacement_HASH:
             return ScalingActivityStatusCode::PendingSpotBidPlacement;
-          }
-          else if (hashCode == WaitingForSpotInstanceRequestId_HASH)
-          {
+          case WaitingForSpotInstanceRequestId_HASH:
             return ScalingActivityStatusCode::WaitingForSpotInstanceRequestId;
-          }
-          else if (hashCode == WaitingForSpotInstanceId_HASH)
-          {
+          case WaitingForSpotInstanceId_HASH:
             return ScalingActivityStatusCode::WaitingForSpotInstanceId;
-          }
-          else if (hashCode == WaitingForInstanceId_HASH)
-          {
+          case WaitingForInstanceId_HASH:
             return ScalingActivityStatusCode::WaitingForInstanceId;
-          }
-          else if (hashCode == PreInService_HASH)
-          {
+          case PreInService_HASH:
             return ScalingActivityStatusCode::PreInService;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
+          case InProgress_HASH:
             return ScalingActivityStatusCode::InProgress;
-          }
-          else if (hashCode == WaitingForELBConnectionDraining_HASH)
-          {
+          case WaitingForELBConnectionDraining_HASH:
             return ScalingActivityStatusCode::WaitingForELBConnectionDraining;
-          }
-          else if (hashCode == MidLifecycleAction_HASH)
-          {
+          case MidLifecycleAction_HASH:
             return ScalingActivityStatusCode::MidLifecycleAction;
-          }
-          else if (hashCode == WaitingForInstanceWarmup_HASH)
-          {
+          case WaitingForInstanceWarmup_HASH:
             return ScalingActivityStatusCode::WaitingForInstanceWarmup;
-          }
-          else if (hashCode == Successful_HASH)
-          {
+          case Successful_HASH:
             return ScalingActivityStatusCode::Successful;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return ScalingActivityStatusCode::Failed;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
+          case Cancelled_HASH:
             return ScalingActivityStatusCode::Cancelled;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
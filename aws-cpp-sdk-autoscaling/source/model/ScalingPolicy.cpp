@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -83,55 +84,55 @@ ScalingPolicy& ScalingPolicy::operator =(const XmlNode& xmlNode)
     XmlNode autoScalingGroupNameNode = resultNode.FirstChild("AutoScalingGroupName");
     if(!autoScalingGroupNameNode.IsNull())
     {
-      m_autoScalingGroupName = StringUtils::Trim(autoScalingGroupNameNode.GetText().c_str());
+      m_autoScalingGroupName = autoScalingGroupNameNode.GetTextView().Trim().ToString();
       m_autoScalingGroupNameHasBeenSet = true;
     }
     XmlNode policyNameNode = resultNode.FirstChild("PolicyName");
     if(!policyNameNode.IsNull())
     {
-      m_policyName = StringUtils::Trim(policyNameNode.GetText().c_str());
+      m_policyName = policyNameNode.GetTextView().Trim().ToString();
       m_policyNameHasBeenSet = true;
     }
     XmlNode policyARNNode = resultNode.FirstChild("PolicyARN");
     if(!policyARNNode.IsNull())
     {
-      m_policyARN = StringUtils::Trim(policyARNNode.GetText().c_str());
+      m_policyARN = policyARNNode.GetTextView().Trim().ToString();
       m_policyARNHasBeenSet = true;
     }
     XmlNode policyTypeNode = resultNode.FirstChild("PolicyType");
     if(!policyTypeNode.IsNull())
     {
-      m_policyType = StringUtils::Trim(policyTypeNode.GetText().c_str());
+      m_policyType = policyTypeNode.GetTextView().Trim().ToString();
       m_policyTypeHasBeenSet = true;
     }
     XmlNode adjustmentTypeNode = resultNode.FirstChild("AdjustmentType");
     if(!adjustmentTypeNode.IsNull())
     {
-      m_adjustmentType = StringUtils::Trim(adjustmentTypeNode.GetText().c_str());
+      m_adjustmentType = adjustmentTypeNode.GetTextView().Trim().ToString();
       m_adjustmentTypeHasBeenSet = true;
     }
     XmlNode minAdjustmentStepNode = resultNode.FirstChild("MinAdjustmentStep");
     if(!minAdjustmentStepNode.IsNull())
     {
-      m_minAdjustmentStep = StringUtils::ConvertToInt32(StringUtils::Trim(minAdjustmentStepNode.GetText().c_str()).c_str());
+      m_minAdjustmentStep = StringUtils::ConvertToInt32(minAdjustmentStepNode.GetTextView().Trim().ToString().c_str());
       m_minAdjustmentStepHasBeenSet = true;
     }
     XmlNode minAdjustmentMagnitudeNode = resultNode.FirstChild("MinAdjustmentMagnitude");
     if(!minAdjustmentMagnitudeNode.IsNull())
     {
-      m_minAdjustmentMagnitude = StringUtils::ConvertToInt32(StringUtils::Trim(minAdjustmentMagnitudeNode.GetText().c_str()).c_str());
+      m_minAdjustmentMagnitude = StringUtils::ConvertToInt32(minAdjustmentMagnitudeNode.GetTextView().Trim().ToString().c_str());
       m_minAdjustmentMagnitudeHasBeenSet = true;
     }
     XmlNode scalingAdjustmentNode = resultNode.FirstChild("ScalingAdjustment");
     if(!scalingAdjustmentNode.IsNull())
     {
-      m_scalingAdjustment = StringUtils::ConvertToInt32(StringUtils::Trim(scalingAdjustmentNode.GetText().c_str()).c_str());
+      m_scalingAdjustment = StringUtils::ConvertToInt32(scalingAdjustmentNode.GetTextView().Trim().ToString().c_str());
       m_scalingAdjustmentHasBeenSet = true;
     }
     XmlNode cooldownNode = resultNode.FirstChild("Cooldown");
     if(!cooldownNode.IsNull())
     {
-      m_cooldown = StringUtils::ConvertToInt32(StringUtils::Trim(cooldownNode.GetText().c_str()).c_str());
+      m_cooldown = StringUtils::ConvertToInt32(cooldownNode.GetTextView().Trim().ToString().c_str());
       m_cooldownHasBeenSet = true;
     }
     XmlNode stepAdjustmentsNode = resultNode.FirstChild("StepAdjustments");
@@ -149,13 +150,13 @@ ScalingPolicy& ScalingPolicy::operator =(const XmlNode& xmlNode)
     XmlNode metricAggregationTypeNode = resultNode.FirstChild("MetricAggregationType");
     if(!metricAggregationTypeNode.IsNull())
     {
-      m_metricAggregationType = StringUtils::Trim(metricAggregationTypeNode.GetText().c_str());
+      m_metricAggregationType = metricAggregationTypeNode.GetTextView().Trim().ToString();
       m_metricAggregationTypeHasBeenSet = true;
     }
     XmlNode estimatedInstanceWarmupNode = resultNode.FirstChild("EstimatedInstanceWarmup");
     if(!estimatedInstanceWarmupNode.IsNull())
     {
-      m_estimatedInstanceWarmup = StringUtils::ConvertToInt32(StringUtils::Trim(estimatedInstanceWarmupNode.GetText().c_str()).c_str());
+      m_estimatedInstanceWarmup = StringUtils::ConvertToInt32(estimatedInstanceWarmupNode.GetTextView().Trim().ToString().c_str());
       m_estimatedInstanceWarmupHasBeenSet = true;
     }
     XmlNode alarmsNode = resultNode.FirstChild("Alarms");
@@ -179,27 +180,27 @@ void ScalingPolicy::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_autoScalingGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_policyNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
 
   if(m_policyARNHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PolicyARN=" << StringUtils::URLEncode(m_policyARN.c_str()) << "&";
+      oStream << location << index << locationValue << ".PolicyARN=" << StringUtils::URLEncoded(m_policyARN) << "&";
   }
 
   if(m_policyTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PolicyType=" << StringUtils::URLEncode(m_policyType.c_str()) << "&";
+      oStream << location << index << locationValue << ".PolicyType=" << StringUtils::URLEncoded(m_policyType) << "&";
   }
 
   if(m_adjustmentTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AdjustmentType=" << StringUtils::URLEncode(m_adjustmentType.c_str()) << "&";
+      oStream << location << index << locationValue << ".AdjustmentType=" << StringUtils::URLEncoded(m_adjustmentType) << "&";
   }
 
   if(m_minAdjustmentStepHasBeenSet)
@@ -227,15 +228,15 @@ void ScalingPolicy::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned stepAdjustmentsIdx = 1;
       for(auto& item : m_stepAdjustments)
       {
-        Aws::StringStream stepAdjustmentsSs;
+        Aws::Utils::Stream::StringOutputStream stepAdjustmentsSs;
         stepAdjustmentsSs << location << index << locationValue << ".StepAdjustments.member." << stepAdjustmentsIdx++;
-        item.OutputToStream(oStream, stepAdjustmentsSs.str().c_str());
+        item.OutputToStream(oStream, stepAdjustmentsSs.GetString().c_str());
       }
   }
 
   if(m_metricAggregationTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MetricAggregationType=" << StringUtils::URLEncode(m_metricAggregationType.c_str()) << "&";
+      oStream << location << index << locationValue << ".MetricAggregationType=" << StringUtils::URLEncoded(m_metricAggregationType) << "&";
   }
 
   if(m_estimatedInstanceWarmupHasBeenSet)
@@ -248,9 +249,9 @@ void ScalingPolicy::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned alarmsIdx = 1;
       for(auto& item : m_alarms)
       {
-        Aws::StringStream alarmsSs;
+        Aws::Utils::Stream::StringOutputStream alarmsSs;
         alarmsSs << location << index << locationValue << ".Alarms.member." << alarmsIdx++;
-        item.OutputToStream(oStream, alarmsSs.str().c_str());
+        item.OutputToStream(oStream, alarmsSs.GetString().c_str());
       }
   }
 
@@ -260,23 +261,23 @@ void ScalingPolicy::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_autoScalingGroupNameHasBeenSet)
   {
-      oStream << location << ".AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+      oStream << location << ".AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
   if(m_policyNameHasBeenSet)
   {
-      oStream << location << ".PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+      oStream << location << ".PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
   if(m_policyARNHasBeenSet)
   {
-      oStream << location << ".PolicyARN=" << StringUtils::URLEncode(m_policyARN.c_str()) << "&";
+      oStream << location << ".PolicyARN=" << StringUtils::URLEncoded(m_policyARN) << "&";
   }
   if(m_policyTypeHasBeenSet)
   {
-      oStream << location << ".PolicyType=" << StringUtils::URLEncode(m_policyType.c_str()) << "&";
+      oStream << location << ".PolicyType=" << StringUtils::URLEncoded(m_policyType) << "&";
   }
   if(m_adjustmentTypeHasBeenSet)
   {
-      oStream << location << ".AdjustmentType=" << StringUtils::URLEncode(m_adjustmentType.c_str()) << "&";
+      oStream << location << ".AdjustmentType=" << StringUtils::URLEncoded(m_adjustmentType) << "&";
   }
   if(m_minAdjustmentStepHasBeenSet)
   {
@@ -299,14 +300,14 @@ void ScalingPolicy::OutputToStream(Aws::OStream& oStream, const char* location)
       unsigned stepAdjustmentsIdx = 1;
       for(auto& item : m_stepAdjustments)
       {
-        Aws::StringStream stepAdjustmentsSs;
+        Aws::Utils::Stream::StringOutputStream stepAdjustmentsSs;
         stepAdjustmentsSs << location <<  ".StepAdjustments.member." << stepAdjustmentsIdx++;
-        item.OutputToStream(oStream, stepAdjustmentsSs.str().c_str());
+        item.OutputToStream(oStream, stepAdjustmentsSs.GetString().c_str());
       }
   }
   if(m_metricAggregationTypeHasBeenSet)
   {
-      oStream << location << ".MetricAggregationType=" << StringUtils::URLEncode(m_metricAggregationType.c_str()) << "&";
+      oStream << location << ".MetricAggregationType=" << StringUtils::URLEncoded(m_metricAggregationType) << "&";
   }
   if(m_estimatedInstanceWarmupHasBeenSet)
   {
@@ -317,9 +318,9 @@ void ScalingPolicy::OutputToStream(Aws::OStream& oStream, const char* location)
       unsigned alarmsIdx = 1;
       for(auto& item : m_alarms)
       {
-        Aws::StringStream alarmsSs;
+        Aws::Utils::Stream::StringOutputStream alarmsSs;
         alarmsSs << location <<  ".Alarms.member." << alarmsIdx++;
-        item.OutputToStream(oStream, alarmsSs.str().c_str());
+        item.OutputToStream(oStream, alarmsSs.GetString().c_str());
       }
   }
 }
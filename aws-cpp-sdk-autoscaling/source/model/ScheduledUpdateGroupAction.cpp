@@ -73,61 +73,61 @@ ScheduledUpdateGroupAction& ScheduledUpdateGroupAction::operator =(const XmlNode
     XmlNode autoScalingGroupNameNode = resultNode.FirstChild("AutoScalingGroupName");
     if(!autoScalingGroupNameNode.IsNull())
     {
-      m_autoScalingGroupName = StringUtils::Trim(autoScalingGroupNameNode.GetText().c_str());
+      m_autoScalingGroupName = autoScalingGroupNameNode.GetTextView().Trim().ToString();
       m_autoScalingGroupNameHasBeenSet = true;
     }
     XmlNode scheduledActionNameNode = resultNode.FirstChild("ScheduledActionName");
     if(!scheduledActionNameNode.IsNull())
     {
-      m_scheduledActionName = StringUtils::Trim(scheduledActionNameNode.GetText().c_str());
+      m_scheduledActionName = scheduledActionNameNode.GetTextView().Trim().ToString();
       m_scheduledActionNameHasBeenSet = true;
     }
     XmlNode scheduledActionARNNode = resultNode.FirstChild("ScheduledActionARN");
     if(!scheduledActionARNNode.IsNull())
     {
-      m_scheduledActionARN = StringUtils::Trim(scheduledActionARNNode.GetText().c_str());
+      m_scheduledActionARN = scheduledActionARNNode.GetTextView().Trim().ToString();
       m_scheduledActionARNHasBeenSet = true;
     }
     XmlNode timeNode = resultNode.FirstChild("Time");
     if(!timeNode.IsNull())
     {
-      m_time = DateTime(StringUtils::Trim(timeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_time = DateTime(timeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_timeHasBeenSet = true;
     }
     XmlNode startTimeNode = resultNode.FirstChild("StartTime");
     if(!startTimeNode.IsNull())
     {
-      m_startTime = DateTime(StringUtils::Trim(startTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_startTime = DateTime(startTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_startTimeHasBeenSet = true;
     }
     XmlNode endTimeNode = resultNode.FirstChild("EndTime");
     if(!endTimeNode.IsNull())
     {
-      m_endTime = DateTime(StringUtils::Trim(endTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_endTime = DateTime(endTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_endTimeHasBeenSet = true;
     }
     XmlNode recurrenceNode = resultNode.FirstChild("Recurrence");
     if(!recurrenceNode.IsNull())
     {
-      m_recurrence = StringUtils::Trim(recurrenceNode.GetText().c_str());
+      m_recurrence = recurrenceNode.GetTextView().Trim().ToString();
       m_recurrenceHasBeenSet = true;
     }
     XmlNode minSizeNode = resultNode.FirstChild("MinSize");
     if(!minSizeNode.IsNull())
     {
-      m_minSize = StringUtils::ConvertToInt32(StringUtils::Trim(minSizeNode.GetText().c_str()).c_str());
+      m_minSize = StringUtils::ConvertToInt32(minSizeNode.GetTextView().Trim().ToString().c_str());
       m_minSizeHasBeenSet = true;
     }
     XmlNode maxSizeNode = resultNode.FirstChild("MaxSize");
     if(!maxSizeNode.IsNull())
     {
-      m_maxSize = StringUtils::ConvertToInt32(StringUtils::Trim(maxSizeNode.GetText().c_str()).c_str());
+      m_maxSize = StringUtils::ConvertToInt32(maxSizeNode.GetTextView().Trim().ToString().c_str());
       m_maxSizeHasBeenSet = true;
     }
     XmlNode desiredCapacityNode = resultNode.FirstChild("DesiredCapacity");
     if(!desiredCapacityNode.IsNull())
     {
-      m_desiredCapacity = StringUtils::ConvertToInt32(StringUtils::Trim(desiredCapacityNode.GetText().c_str()).c_str());
+      m_desiredCapacity = StringUtils::ConvertToInt32(desiredCapacityNode.GetTextView().Trim().ToString().c_str());
       m_desiredCapacityHasBeenSet = true;
     }
   }
@@ -139,37 +139,37 @@ void ScheduledUpdateGroupAction::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_autoScalingGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_scheduledActionNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ScheduledActionName=" << StringUtils::URLEncode(m_scheduledActionName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ScheduledActionName=" << StringUtils::URLEncoded(m_scheduledActionName) << "&";
   }
 
   if(m_scheduledActionARNHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ScheduledActionARN=" << StringUtils::URLEncode(m_scheduledActionARN.c_str()) << "&";
+      oStream << location << index << locationValue << ".ScheduledActionARN=" << StringUtils::URLEncoded(m_scheduledActionARN) << "&";
   }
 
   if(m_timeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Time=" << StringUtils::URLEncode(m_time.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".Time=" << StringUtils::URLEncoded(m_time.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_startTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_endTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EndTime=" << StringUtils::URLEncode(m_endTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".EndTime=" << StringUtils::URLEncoded(m_endTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_recurrenceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Recurrence=" << StringUtils::URLEncode(m_recurrence.c_str()) << "&";
+      oStream << location << index << locationValue << ".Recurrence=" << StringUtils::URLEncoded(m_recurrence) << "&";
   }
 
   if(m_minSizeHasBeenSet)
@@ -193,31 +193,31 @@ void ScheduledUpdateGroupAction::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_autoScalingGroupNameHasBeenSet)
   {
-      oStream << location << ".AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+      oStream << location << ".AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
   if(m_scheduledActionNameHasBeenSet)
   {
-      oStream << location << ".ScheduledActionName=" << StringUtils::URLEncode(m_scheduledActionName.c_str()) << "&";
+      oStream << location << ".ScheduledActionName=" << StringUtils::URLEncoded(m_scheduledActionName) << "&";
   }
   if(m_scheduledActionARNHasBeenSet)
   {
-      oStream << location << ".ScheduledActionARN=" << StringUtils::URLEncode(m_scheduledActionARN.c_str()) << "&";
+      oStream << location << ".ScheduledActionARN=" << StringUtils::URLEncoded(m_scheduledActionARN) << "&";
   }
   if(m_timeHasBeenSet)
   {
-      oStream << location << ".Time=" << StringUtils::URLEncode(m_time.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".Time=" << StringUtils::URLEncoded(m_time.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_startTimeHasBeenSet)
   {
-      oStream << location << ".StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_endTimeHasBeenSet)
   {
-      oStream << location << ".EndTime=" << StringUtils::URLEncode(m_endTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".EndTime=" << StringUtils::URLEncoded(m_endTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_recurrenceHasBeenSet)
   {
-      oStream << location << ".Recurrence=" << StringUtils::URLEncode(m_recurrence.c_str()) << "&";
+      oStream << location << ".Recurrence=" << StringUtils::URLEncoded(m_recurrence) << "&";
   }
   if(m_minSizeHasBeenSet)
   {
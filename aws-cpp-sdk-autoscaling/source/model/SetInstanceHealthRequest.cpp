@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/SetInstanceHealthRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ SetInstanceHealthRequest::SetInstanceHealthRequest() :
 
 Aws::String SetInstanceHealthRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SetInstanceHealth&";
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_healthStatusHasBeenSet)
   {
-    ss << "HealthStatus=" << StringUtils::URLEncode(m_healthStatus.c_str()) << "&";
+    ss << "HealthStatus=" << StringUtils::URLEncoded(m_healthStatus) << "&";
   }
 
   if(m_shouldRespectGracePeriodHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String SetInstanceHealthRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
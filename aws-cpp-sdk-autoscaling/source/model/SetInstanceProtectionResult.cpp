@@ -40,7 +40,7 @@ SetInstanceProtectionResult& SetInstanceProtectionResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SetInstanceProtectionResult")
+  if (rootNode.GetNameView() != "SetInstanceProtectionResult")
   {
     resultNode = rootNode.FirstChild("SetInstanceProtectionResult");
   }
@@ -51,13 +51,13 @@ SuspendedProcess& SuspendedProcess::operator =(const XmlNode& xmlNode)
     XmlNode processNameNode = resultNode.FirstChild("ProcessName");
     if(!processNameNode.IsNull())
     {
-      m_processName = StringUtils::Trim(processNameNode.GetText().c_str());
+      m_processName = processNameNode.GetTextView().Trim().ToString();
       m_processNameHasBeenSet = true;
     }
     XmlNode suspensionReasonNode = resultNode.FirstChild("SuspensionReason");
     if(!suspensionReasonNode.IsNull())
     {
-      m_suspensionReason = StringUtils::Trim(suspensionReasonNode.GetText().c_str());
+      m_suspensionReason = suspensionReasonNode.GetTextView().Trim().ToString();
       m_suspensionReasonHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void SuspendedProcess::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_processNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ProcessName=" << StringUtils::URLEncode(m_processName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ProcessName=" << StringUtils::URLEncoded(m_processName) << "&";
   }
 
   if(m_suspensionReasonHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SuspensionReason=" << StringUtils::URLEncode(m_suspensionReason.c_str()) << "&";
+      oStream << location << index << locationValue << ".SuspensionReason=" << StringUtils::URLEncoded(m_suspensionReason) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void SuspendedProcess::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_processNameHasBeenSet)
   {
-      oStream << location << ".ProcessName=" << StringUtils::URLEncode(m_processName.c_str()) << "&";
+      oStream << location << ".ProcessName=" << StringUtils::URLEncoded(m_processName) << "&";
   }
   if(m_suspensionReasonHasBeenSet)
   {
-      oStream << location << ".SuspensionReason=" << StringUtils::URLEncode(m_suspensionReason.c_str()) << "&";
+      oStream << location << ".SuspensionReason=" << StringUtils::URLEncoded(m_suspensionReason) << "&";
   }
 }
 
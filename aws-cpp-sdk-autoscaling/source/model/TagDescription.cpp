@@ -59,31 +59,31 @@ TagDescription& TagDescription::operator =(const XmlNode& xmlNode)
     XmlNode resourceIdNode = resultNode.FirstChild("ResourceId");
     if(!resourceIdNode.IsNull())
     {
-      m_resourceId = StringUtils::Trim(resourceIdNode.GetText().c_str());
+      m_resourceId = resourceIdNode.GetTextView().Trim().ToString();
       m_resourceIdHasBeenSet = true;
     }
     XmlNode resourceTypeNode = resultNode.FirstChild("ResourceType");
     if(!resourceTypeNode.IsNull())
     {
-      m_resourceType = StringUtils::Trim(resourceTypeNode.GetText().c_str());
+      m_resourceType = resourceTypeNode.GetTextView().Trim().ToString();
       m_resourceTypeHasBeenSet = true;
     }
     XmlNode keyNode = resultNode.FirstChild("Key");
     if(!keyNode.IsNull())
     {
-      m_key = StringUtils::Trim(keyNode.GetText().c_str());
+      m_key = keyNode.GetTextView().Trim().ToString();
       m_keyHasBeenSet = true;
     }
     XmlNode valueNode = resultNode.FirstChild("Value");
     if(!valueNode.IsNull())
     {
-      m_value = StringUtils::Trim(valueNode.GetText().c_str());
+      m_value = valueNode.GetTextView().Trim().ToString();
       m_valueHasBeenSet = true;
     }
     XmlNode propagateAtLaunchNode = resultNode.FirstChild("PropagateAtLaunch");
     if(!propagateAtLaunchNode.IsNull())
     {
-      m_propagateAtLaunch = StringUtils::ConvertToBool(StringUtils::Trim(propagateAtLaunchNode.GetText().c_str()).c_str());
+      m_propagateAtLaunch = StringUtils::ConvertToBool(propagateAtLaunchNode.GetTextView().Trim().ToString().c_str());
       m_propagateAtLaunchHasBeenSet = true;
     }
   }
@@ -95,22 +95,22 @@ void TagDescription::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_resourceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceId=" << StringUtils::URLEncode(m_resourceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceId=" << StringUtils::URLEncoded(m_resourceId) << "&";
   }
 
   if(m_resourceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceType=" << StringUtils::URLEncode(m_resourceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceType=" << StringUtils::URLEncoded(m_resourceType) << "&";
   }
 
   if(m_keyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Key=" << StringUtils::URLEncode(m_key.c_str()) << "&";
+      oStream << location << index << locationValue << ".Key=" << StringUtils::URLEncoded(m_key) << "&";
   }
 
   if(m_valueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 
   if(m_propagateAtLaunchHasBeenSet)
@@ -124,19 +124,19 @@ void TagDescription::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_resourceIdHasBeenSet)
   {
-      oStream << location << ".ResourceId=" << StringUtils::URLEncode(m_resourceId.c_str()) << "&";
+      oStream << location << ".ResourceId=" << StringUtils::URLEncoded(m_resourceId) << "&";
   }
   if(m_resourceTypeHasBeenSet)
   {
-      oStream << location << ".ResourceType=" << StringUtils::URLEncode(m_resourceType.c_str()) << "&";
+      oStream << location << ".ResourceType=" << StringUtils::URLEncoded(m_resourceType) << "&";
   }
   if(m_keyHasBeenSet)
   {
-      oStream << location << ".Key=" << StringUtils::URLEncode(m_key.c_str()) << "&";
+      oStream << location << ".Key=" << StringUtils::URLEncoded(m_key) << "&";
   }
   if(m_valueHasBeenSet)
   {
-      oStream << location << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
   if(m_propagateAtLaunchHasBeenSet)
   {
@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/TerminateInstanceInAutoScalingGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -28,11 +29,11 @@ TerminateInstanceInAutoScalingGroupRequest::TerminateInstanceInAutoScalingGroupR
 
 Aws::String TerminateInstanceInAutoScalingGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=TerminateInstanceInAutoScalingGroup&";
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_shouldDecrementDesiredCapacityHasBeenSet)
@@ -41,6 +42,6 @@ Aws::String TerminateInstanceInAutoScalingGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
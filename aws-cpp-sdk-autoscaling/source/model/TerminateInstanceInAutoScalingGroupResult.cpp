@@ -40,7 +40,7 @@ TerminateInstanceInAutoScalingGroupResult& TerminateInstanceInAutoScalingGroupRe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "TerminateInstanceInAutoScalingGroupResult")
+  if (rootNode.GetNameView() != "TerminateInstanceInAutoScalingGroupResult")
   {
     resultNode = rootNode.FirstChild("TerminateInstanceInAutoScalingGroupResult");
   }
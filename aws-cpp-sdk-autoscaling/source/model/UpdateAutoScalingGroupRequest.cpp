@@ -15,6 +15,7 @@
 #include <aws/autoscaling/model/UpdateAutoScalingGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::AutoScaling::Model;
 using namespace Aws::Utils;
@@ -44,16 +45,16 @@ UpdateAutoScalingGroupRequest::UpdateAutoScalingGroupRequest() :
 
 Aws::String UpdateAutoScalingGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UpdateAutoScalingGroup&";
   if(m_autoScalingGroupNameHasBeenSet)
   {
-    ss << "AutoScalingGroupName=" << StringUtils::URLEncode(m_autoScalingGroupName.c_str()) << "&";
+    ss << "AutoScalingGroupName=" << StringUtils::URLEncoded(m_autoScalingGroupName) << "&";
   }
 
   if(m_launchConfigurationNameHasBeenSet)
   {
-    ss << "LaunchConfigurationName=" << StringUtils::URLEncode(m_launchConfigurationName.c_str()) << "&";
+    ss << "LaunchConfigurationName=" << StringUtils::URLEncoded(m_launchConfigurationName) << "&";
   }
 
   if(m_minSizeHasBeenSet)
@@ -82,14 +83,14 @@ Aws::String UpdateAutoScalingGroupRequest::SerializePayload() const
     for(auto& item : m_availabilityZones)
     {
       ss << "AvailabilityZones.member." << availabilityZonesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       availabilityZonesCount++;
     }
   }
 
   if(m_healthCheckTypeHasBeenSet)
   {
-    ss << "HealthCheckType=" << StringUtils::URLEncode(m_healthCheckType.c_str()) << "&";
+    ss << "HealthCheckType=" << StringUtils::URLEncoded(m_healthCheckType) << "&";
   }
 
   if(m_healthCheckGracePeriodHasBeenSet)
@@ -99,12 +100,12 @@ Aws::String UpdateAutoScalingGroupRequest::SerializePayload() const
 
   if(m_placementGroupHasBeenSet)
   {
-    ss << "PlacementGroup=" << StringUtils::URLEncode(m_placementGroup.c_str()) << "&";
+    ss << "PlacementGroup=" << StringUtils::URLEncoded(m_placementGroup) << "&";
   }
 
   if(m_vPCZoneIdentifierHasBeenSet)
   {
-    ss << "VPCZoneIdentifier=" << StringUtils::URLEncode(m_vPCZoneIdentifier.c_str()) << "&";
+    ss << "VPCZoneIdentifier=" << StringUtils::URLEncoded(m_vPCZoneIdentifier) << "&";
   }
 
   if(m_terminationPoliciesHasBeenSet)
@@ -113,7 +114,7 @@ Aws::String UpdateAutoScalingGroupRequest::SerializePayload() const
     for(auto& item : m_terminationPolicies)
     {
       ss << "TerminationPolicies.member." << terminationPoliciesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       terminationPoliciesCount++;
     }
   }
@@ -124,6 +125,6 @@ Aws::String UpdateAutoScalingGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2011-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
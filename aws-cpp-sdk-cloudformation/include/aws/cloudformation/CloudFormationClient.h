@@ -42,6 +42,9 @@
 #include <aws/cloudformation/model/ValidateTemplateResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -261,6 +264,18 @@ namespace Model
          */
         virtual void CancelUpdateStackAsync(const Model::CancelUpdateStackRequest& request, const CancelUpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelUpdateStackCallable(const Model::CancelUpdateStackRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelUpdateStackOutcomeCallable CancelUpdateStackCallable(Model::CancelUpdateStackRequest&& request) const;
+
+        /**
+         * Same as CancelUpdateStackAsync(const Model::CancelUpdateStackRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelUpdateStackAsync(Model::CancelUpdateStackRequest&& request, const CancelUpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>For a specified stack that is in the <code>UPDATE_ROLLBACK_FAILED</code>
          * state, continues rolling it back to the <code>UPDATE_ROLLBACK_COMPLETE</code>
@@ -316,6 +331,18 @@ namespace Model
          */
         virtual void ContinueUpdateRollbackAsync(const Model::ContinueUpdateRollbackRequest& request, const ContinueUpdateRollbackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ContinueUpdateRollbackCallable(const Model::ContinueUpdateRollbackRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ContinueUpdateRollbackOutcomeCallable ContinueUpdateRollbackCallable(Model::ContinueUpdateRollbackRequest&& request) const;
+
+        /**
+         * Same as ContinueUpdateRollbackAsync(const Model::ContinueUpdateRollbackRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ContinueUpdateRollbackAsync(Model::ContinueUpdateRollbackRequest&& request, const ContinueUpdateRollbackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a list of changes for a stack. AWS CloudFormation generates the
          * change set by comparing the stack's information with the information that you
@@ -365,6 +392,18 @@ namespace Model
          */
         virtual void CreateChangeSetAsync(const Model::CreateChangeSetRequest& request, const CreateChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateChangeSetCallable(const Model::CreateChangeSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateChangeSetOutcomeCallable CreateChangeSetCallable(Model::CreateChangeSetRequest&& request) const;
+
+        /**
+         * Same as CreateChangeSetAsync(const Model::CreateChangeSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateChangeSetAsync(Model::CreateChangeSetRequest&& request, const CreateChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a stack as specified in the template. After the call completes
          * successfully, the stack creation starts. You can check the status of the stack
@@ -390,6 +429,18 @@ namespace Model
          */
         virtual void CreateStackAsync(const Model::CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateStackCallable(const Model::CreateStackRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateStackOutcomeCallable CreateStackCallable(Model::CreateStackRequest&& request) const;
+
+        /**
+         * Same as CreateStackAsync(const Model::CreateStackRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateStackAsync(Model::CreateStackRequest&& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified change set. Deleting change sets ensures that no one
          * executes the wrong change set.</p> <p>If the call successfully completes, AWS
@@ -415,6 +466,18 @@ namespace Model
          */
         virtual void DeleteChangeSetAsync(const Model::DeleteChangeSetRequest& request, const DeleteChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteChangeSetCallable(const Model::DeleteChangeSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteChangeSetOutcomeCallable DeleteChangeSetCallable(Model::DeleteChangeSetRequest&& request) const;
+
+        /**
+         * Same as DeleteChangeSetAsync(const Model::DeleteChangeSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteChangeSetAsync(Model::DeleteChangeSetRequest&& request, const DeleteChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a specified stack. Once the call completes successfully, stack
          * deletion starts. Deleted stacks do not show up in the <a>DescribeStacks</a> API
@@ -440,6 +503,18 @@ namespace Model
          */
         virtual void DeleteStackAsync(const Model::DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteStackCallable(const Model::DeleteStackRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteStackOutcomeCallable DeleteStackCallable(Model::DeleteStackRequest&& request) const;
+
+        /**
+         * Same as DeleteStackAsync(const Model::DeleteStackRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteStackAsync(Model::DeleteStackRequest&& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves your account's AWS CloudFormation limits, such as the maximum
          * number of stacks that you can create in your account.</p>
@@ -462,6 +537,18 @@ namespace Model
          */
         virtual void DescribeAccountLimitsAsync(const Model::DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAccountLimitsCallable(const Model::DescribeAccountLimitsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAccountLimitsOutcomeCallable DescribeAccountLimitsCallable(Model::DescribeAccountLimitsRequest&& request) const;
+
+        /**
+         * Same as DescribeAccountLimitsAsync(const Model::DescribeAccountLimitsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAccountLimitsAsync(Model::DescribeAccountLimitsRequest&& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the inputs for the change set and a list of changes that AWS
          * CloudFormation will make if you execute the change set. For more information,
@@ -493,6 +580,18 @@ namespace Model
          */
         virtual void DescribeChangeSetAsync(const Model::DescribeChangeSetRequest& request, const DescribeChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeChangeSetCallable(const Model::DescribeChangeSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeChangeSetOutcomeCallable DescribeChangeSetCallable(Model::DescribeChangeSetRequest&& request) const;
+
+        /**
+         * Same as DescribeChangeSetAsync(const Model::DescribeChangeSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeChangeSetAsync(Model::DescribeChangeSetRequest&& request, const DescribeChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns all stack related events for a specified stack in reverse
          * chronological order. For more information about a stack's event history, go to
@@ -530,6 +629,18 @@ namespace Model
          */
         virtual void DescribeStackEventsAsync(const Model::DescribeStackEventsRequest& request, const DescribeStackEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStackEventsCallable(const Model::DescribeStackEventsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeStackEventsOutcomeCallable DescribeStackEventsCallable(Model::DescribeStackEventsRequest&& request) const;
+
+        /**
+         * Same as DescribeStackEventsAsync(const Model::DescribeStackEventsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeStackEventsAsync(Model::DescribeStackEventsRequest&& request, const DescribeStackEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a description of the specified resource in the specified stack.</p>
          * <p>For deleted stacks, DescribeStackResource returns resource information for up
@@ -555,6 +666,18 @@ namespace Model
          */
         virtual void DescribeStackResourceAsync(const Model::DescribeStackResourceRequest& request, const DescribeStackResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStackResourceCallable(const Model::DescribeStackResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeStackResourceOutcomeCallable DescribeStackResourceCallable(Model::DescribeStackResourceRequest&& request) const;
+
+        /**
+         * Same as DescribeStackResourceAsync(const Model::DescribeStackResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeStackResourceAsync(Model::DescribeStackResourceRequest&& request, const DescribeStackResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns AWS resource descriptions for running and deleted stacks. If
          * <code>StackName</code> is specified, all the associated resources that are part
@@ -622,6 +745,18 @@ namespace Model
          */
         virtual void DescribeStackResourcesAsync(const Model::DescribeStackResourcesRequest& request, const DescribeStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStackResourcesCallable(const Model::DescribeStackResourcesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeStackResourcesOutcomeCallable DescribeStackResourcesCallable(Model::DescribeStackResourcesRequest&& request) const;
+
+        /**
+         * Same as DescribeStackResourcesAsync(const Model::DescribeStackResourcesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeStackResourcesAsync(Model::DescribeStackResourcesRequest&& request, const DescribeStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the description for the specified stack; if no stack name was
          * specified, then it returns the description for all the stacks created.</p>
@@ -644,6 +779,18 @@ namespace Model
          */
         virtual void DescribeStacksAsync(const Model::DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStacksCallable(const Model::DescribeStacksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeStacksOutcomeCallable DescribeStacksCallable(Model::DescribeStacksRequest&& request) const;
+
+        /**
+         * Same as DescribeStacksAsync(const Model::DescribeStacksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeStacksAsync(Model::DescribeStacksRequest&& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the estimated monthly cost of a template. The return value is an AWS
          * Simple Monthly Calculator URL with a query string that describes the resources
@@ -669,6 +816,18 @@ namespace Model
          */
         virtual void EstimateTemplateCostAsync(const Model::EstimateTemplateCostRequest& request, const EstimateTemplateCostResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EstimateTemplateCostCallable(const Model::EstimateTemplateCostRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EstimateTemplateCostOutcomeCallable EstimateTemplateCostCallable(Model::EstimateTemplateCostRequest&& request) const;
+
+        /**
+         * Same as EstimateTemplateCostAsync(const Model::EstimateTemplateCostRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EstimateTemplateCostAsync(Model::EstimateTemplateCostRequest&& request, const EstimateTemplateCostResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a stack using the input information that was provided when the
          * specified change set was created. After the call successfully completes, AWS
@@ -709,6 +868,18 @@ namespace Model
          */
         virtual void ExecuteChangeSetAsync(const Model::ExecuteChangeSetRequest& request, const ExecuteChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ExecuteChangeSetCallable(const Model::ExecuteChangeSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ExecuteChangeSetOutcomeCallable ExecuteChangeSetCallable(Model::ExecuteChangeSetRequest&& request) const;
+
+        /**
+         * Same as ExecuteChangeSetAsync(const Model::ExecuteChangeSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ExecuteChangeSetAsync(Model::ExecuteChangeSetRequest&& request, const ExecuteChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the stack policy for a specified stack. If a stack doesn't have a
          * policy, a null value is returned.</p>
@@ -731,6 +902,18 @@ namespace Model
          */
         virtual void GetStackPolicyAsync(const Model::GetStackPolicyRequest& request, const GetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetStackPolicyCallable(const Model::GetStackPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetStackPolicyOutcomeCallable GetStackPolicyCallable(Model::GetStackPolicyRequest&& request) const;
+
+        /**
+         * Same as GetStackPolicyAsync(const Model::GetStackPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetStackPolicyAsync(Model::GetStackPolicyRequest&& request, const GetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the template body for a specified stack. You can get the template for
          * running or deleted stacks.</p> <p>For deleted stacks, GetTemplate returns the
@@ -762,6 +945,18 @@ namespace Model
          */
         virtual void GetTemplateAsync(const Model::GetTemplateRequest& request, const GetTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTemplateCallable(const Model::GetTemplateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetTemplateOutcomeCallable GetTemplateCallable(Model::GetTemplateRequest&& request) const;
+
+        /**
+         * Same as GetTemplateAsync(const Model::GetTemplateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetTemplateAsync(Model::GetTemplateRequest&& request, const GetTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about a new or existing template. The
          * <code>GetTemplateSummary</code> action is useful for viewing parameter
@@ -805,6 +1000,18 @@ namespace Model
          */
         virtual void GetTemplateSummaryAsync(const Model::GetTemplateSummaryRequest& request, const GetTemplateSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTemplateSummaryCallable(const Model::GetTemplateSummaryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetTemplateSummaryOutcomeCallable GetTemplateSummaryCallable(Model::GetTemplateSummaryRequest&& request) const;
+
+        /**
+         * Same as GetTemplateSummaryAsync(const Model::GetTemplateSummaryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetTemplateSummaryAsync(Model::GetTemplateSummaryRequest&& request, const GetTemplateSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the ID and status of each active change set for a stack. For example,
          * AWS CloudFormation lists change sets that are in the
@@ -830,6 +1037,18 @@ namespace Model
          */
         virtual void ListChangeSetsAsync(const Model::ListChangeSetsRequest& request, const ListChangeSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListChangeSetsCallable(const Model::ListChangeSetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListChangeSetsOutcomeCallable ListChangeSetsCallable(Model::ListChangeSetsRequest&& request) const;
+
+        /**
+         * Same as ListChangeSetsAsync(const Model::ListChangeSetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListChangeSetsAsync(Model::ListChangeSetsRequest&& request, const ListChangeSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns descriptions of all resources of the specified stack.</p> <p>For
          * deleted stacks, ListStackResources returns resource information for up to 90
@@ -855,6 +1074,18 @@ namespace Model
          */
         virtual void ListStackResourcesAsync(const Model::ListStackResourcesRequest& request, const ListStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListStackResourcesCallable(const Model::ListStackResourcesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListStackResourcesOutcomeCallable ListStackResourcesCallable(Model::ListStackResourcesRequest&& request) const;
+
+        /**
+         * Same as ListStackResourcesAsync(const Model::ListStackResourcesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListStackResourcesAsync(Model::ListStackResourcesRequest&& request, const ListStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the summary information for stacks whose status matches the specified
          * StackStatusFilter. Summary information for stacks that have been deleted is kept
@@ -886,6 +1117,18 @@ namespace Model
          */
         virtual void ListStacksAsync(const Model::ListStacksRequest& request, const ListStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListStacksCallable(const Model::ListStacksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListStacksOutcomeCallable ListStacksCallable(Model::ListStacksRequest&& request) const;
+
+        /**
+         * Same as ListStacksAsync(const Model::ListStacksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListStacksAsync(Model::ListStacksRequest&& request, const ListStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets a stack policy for a specified stack.</p>
          */
@@ -905,6 +1148,18 @@ namespace Model
          */
         virtual void SetStackPolicyAsync(const Model::SetStackPolicyRequest& request, const SetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetStackPolicyCallable(const Model::SetStackPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetStackPolicyOutcomeCallable SetStackPolicyCallable(Model::SetStackPolicyRequest&& request) const;
+
+        /**
+         * Same as SetStackPolicyAsync(const Model::SetStackPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetStackPolicyAsync(Model::SetStackPolicyRequest&& request, const SetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sends a signal to the specified resource with a success or failure status.
          * You can use the SignalResource API in conjunction with a creation policy or
@@ -939,6 +1194,18 @@ namespace Model
          */
         virtual void SignalResourceAsync(const Model::SignalResourceRequest& request, const SignalResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SignalResourceCallable(const Model::SignalResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SignalResourceOutcomeCallable SignalResourceCallable(Model::SignalResourceRequest&& request) const;
+
+        /**
+         * Same as SignalResourceAsync(const Model::SignalResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SignalResourceAsync(Model::SignalResourceRequest&& request, const SignalResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a stack as specified in the template. After the call completes
          * successfully, the stack update starts. You can check the status of the stack via
@@ -979,6 +1246,18 @@ namespace Model
          */
         virtual void UpdateStackAsync(const Model::UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateStackCallable(const Model::UpdateStackRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateStackOutcomeCallable UpdateStackCallable(Model::UpdateStackRequest&& request) const;
+
+        /**
+         * Same as UpdateStackAsync(const Model::UpdateStackRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateStackAsync(Model::UpdateStackRequest&& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Validates a specified template.</p>
          */
@@ -998,6 +1277,175 @@ namespace Model
          */
         virtual void ValidateTemplateAsync(const Model::ValidateTemplateRequest& request, const ValidateTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ValidateTemplateCallable(const Model::ValidateTemplateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ValidateTemplateOutcomeCallable ValidateTemplateCallable(Model::ValidateTemplateRequest&& request) const;
+
+        /**
+         * Same as ValidateTemplateAsync(const Model::ValidateTemplateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ValidateTemplateAsync(Model::ValidateTemplateRequest&& request, const ValidateTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeAccountLimits(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudFormationClient, Model::DescribeAccountLimitsRequest, Model::DescribeAccountLimitsOutcome> DescribeAccountLimitsPaginator(const Model::DescribeAccountLimitsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeChangeSet(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudFormationClient, Model::DescribeChangeSetRequest, Model::DescribeChangeSetOutcome> DescribeChangeSetPaginator(const Model::DescribeChangeSetRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeStackEvents(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudFormationClient, Model::DescribeStackEventsRequest, Model::DescribeStackEventsOutcome> DescribeStackEventsPaginator(const Model::DescribeStackEventsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeStacks(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudFormationClient, Model::DescribeStacksRequest, Model::DescribeStacksOutcome> DescribeStacksPaginator(const Model::DescribeStacksRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListChangeSets(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudFormationClient, Model::ListChangeSetsRequest, Model::ListChangeSetsOutcome> ListChangeSetsPaginator(const Model::ListChangeSetsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListStackResources(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudFormationClient, Model::ListStackResourcesRequest, Model::ListStackResourcesOutcome> ListStackResourcesPaginator(const Model::ListStackResourcesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListStacks(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudFormationClient, Model::ListStacksRequest, Model::ListStacksOutcome> ListStacksPaginator(const Model::ListStacksRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CancelUpdateStack(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::CancelUpdateStackRequest, Model::CancelUpdateStackOutcome> CancelUpdateStackAwaitable(Model::CancelUpdateStackRequest request) const;
+
+        /**
+         * co_await-able form of ContinueUpdateRollback(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::ContinueUpdateRollbackRequest, Model::ContinueUpdateRollbackOutcome> ContinueUpdateRollbackAwaitable(Model::ContinueUpdateRollbackRequest request) const;
+
+        /**
+         * co_await-able form of CreateChangeSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::CreateChangeSetRequest, Model::CreateChangeSetOutcome> CreateChangeSetAwaitable(Model::CreateChangeSetRequest request) const;
+
+        /**
+         * co_await-able form of CreateStack(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::CreateStackRequest, Model::CreateStackOutcome> CreateStackAwaitable(Model::CreateStackRequest request) const;
+
+        /**
+         * co_await-able form of DeleteChangeSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::DeleteChangeSetRequest, Model::DeleteChangeSetOutcome> DeleteChangeSetAwaitable(Model::DeleteChangeSetRequest request) const;
+
+        /**
+         * co_await-able form of DeleteStack(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::DeleteStackRequest, Model::DeleteStackOutcome> DeleteStackAwaitable(Model::DeleteStackRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAccountLimits(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::DescribeAccountLimitsRequest, Model::DescribeAccountLimitsOutcome> DescribeAccountLimitsAwaitable(Model::DescribeAccountLimitsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeChangeSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::DescribeChangeSetRequest, Model::DescribeChangeSetOutcome> DescribeChangeSetAwaitable(Model::DescribeChangeSetRequest request) const;
+
+        /**
+         * co_await-able form of DescribeStackEvents(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::DescribeStackEventsRequest, Model::DescribeStackEventsOutcome> DescribeStackEventsAwaitable(Model::DescribeStackEventsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeStackResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::DescribeStackResourceRequest, Model::DescribeStackResourceOutcome> DescribeStackResourceAwaitable(Model::DescribeStackResourceRequest request) const;
+
+        /**
+         * co_await-able form of DescribeStackResources(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::DescribeStackResourcesRequest, Model::DescribeStackResourcesOutcome> DescribeStackResourcesAwaitable(Model::DescribeStackResourcesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeStacks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::DescribeStacksRequest, Model::DescribeStacksOutcome> DescribeStacksAwaitable(Model::DescribeStacksRequest request) const;
+
+        /**
+         * co_await-able form of EstimateTemplateCost(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::EstimateTemplateCostRequest, Model::EstimateTemplateCostOutcome> EstimateTemplateCostAwaitable(Model::EstimateTemplateCostRequest request) const;
+
+        /**
+         * co_await-able form of ExecuteChangeSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::ExecuteChangeSetRequest, Model::ExecuteChangeSetOutcome> ExecuteChangeSetAwaitable(Model::ExecuteChangeSetRequest request) const;
+
+        /**
+         * co_await-able form of GetStackPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::GetStackPolicyRequest, Model::GetStackPolicyOutcome> GetStackPolicyAwaitable(Model::GetStackPolicyRequest request) const;
+
+        /**
+         * co_await-able form of GetTemplate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::GetTemplateRequest, Model::GetTemplateOutcome> GetTemplateAwaitable(Model::GetTemplateRequest request) const;
+
+        /**
+         * co_await-able form of GetTemplateSummary(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::GetTemplateSummaryRequest, Model::GetTemplateSummaryOutcome> GetTemplateSummaryAwaitable(Model::GetTemplateSummaryRequest request) const;
+
+        /**
+         * co_await-able form of ListChangeSets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::ListChangeSetsRequest, Model::ListChangeSetsOutcome> ListChangeSetsAwaitable(Model::ListChangeSetsRequest request) const;
+
+        /**
+         * co_await-able form of ListStackResources(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::ListStackResourcesRequest, Model::ListStackResourcesOutcome> ListStackResourcesAwaitable(Model::ListStackResourcesRequest request) const;
+
+        /**
+         * co_await-able form of ListStacks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::ListStacksRequest, Model::ListStacksOutcome> ListStacksAwaitable(Model::ListStacksRequest request) const;
+
+        /**
+         * co_await-able form of SetStackPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::SetStackPolicyRequest, Model::SetStackPolicyOutcome> SetStackPolicyAwaitable(Model::SetStackPolicyRequest request) const;
+
+        /**
+         * co_await-able form of SignalResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::SignalResourceRequest, Model::SignalResourceOutcome> SignalResourceAwaitable(Model::SignalResourceRequest request) const;
+
+        /**
+         * co_await-able form of UpdateStack(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::UpdateStackRequest, Model::UpdateStackOutcome> UpdateStackAwaitable(Model::UpdateStackRequest request) const;
+
+        /**
+         * co_await-able form of ValidateTemplate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFormationClient, Model::ValidateTemplateRequest, Model::ValidateTemplateOutcome> ValidateTemplateAwaitable(Model::ValidateTemplateRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
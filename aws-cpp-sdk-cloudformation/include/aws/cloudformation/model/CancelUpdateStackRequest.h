@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CancelUpdateStackRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelUpdateStack"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ContinueUpdateRollbackRequest();
+    inline const char* GetServiceRequestName() const override { return "ContinueUpdateRollback"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     CreateChangeSetRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateChangeSet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
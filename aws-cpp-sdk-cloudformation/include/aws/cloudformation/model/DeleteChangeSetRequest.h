@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteChangeSetRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteChangeSet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
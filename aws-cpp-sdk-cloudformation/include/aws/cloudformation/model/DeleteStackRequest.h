@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteStackRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteStack"; }
+
     Aws::String SerializePayload() const override;
 
     /**
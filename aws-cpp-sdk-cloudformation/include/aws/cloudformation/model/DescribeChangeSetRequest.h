@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeChangeSetRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeChangeSet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
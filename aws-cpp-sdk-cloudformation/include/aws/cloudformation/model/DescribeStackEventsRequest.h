@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeStackEventsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeStackEvents"; }
+
     Aws::String SerializePayload() const override;
 
     /**
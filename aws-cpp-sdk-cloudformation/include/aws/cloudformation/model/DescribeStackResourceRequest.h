@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeStackResourceRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeStackResource"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeStackResourcesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeStackResources"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeStacksRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeStacks"; }
+
     Aws::String SerializePayload() const override;
 
     /**
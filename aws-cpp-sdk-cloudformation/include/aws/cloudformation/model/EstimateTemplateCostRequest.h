@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     EstimateTemplateCostRequest();
+    inline const char* GetServiceRequestName() const override { return "EstimateTemplateCost"; }
+
     Aws::String SerializePayload() const override;
 
     /**
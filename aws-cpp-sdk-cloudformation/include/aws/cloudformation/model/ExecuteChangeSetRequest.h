@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ExecuteChangeSetRequest();
+    inline const char* GetServiceRequestName() const override { return "ExecuteChangeSet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetStackPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetStackPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetTemplateRequest();
+    inline const char* GetServiceRequestName() const override { return "GetTemplate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetTemplateSummaryRequest();
+    inline const char* GetServiceRequestName() const override { return "GetTemplateSummary"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListChangeSetsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListChangeSets"; }
+
     Aws::String SerializePayload() const override;
 
     /**
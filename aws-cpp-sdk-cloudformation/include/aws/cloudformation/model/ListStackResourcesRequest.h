@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListStackResourcesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListStackResources"; }
+
     Aws::String SerializePayload() const override;
 
     /**
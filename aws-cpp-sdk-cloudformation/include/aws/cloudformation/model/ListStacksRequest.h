@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ListStacksRequest();
+    inline const char* GetServiceRequestName() const override { return "ListStacks"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     SetStackPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "SetStackPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SignalResourceRequest();
+    inline const char* GetServiceRequestName() const override { return "SignalResource"; }
+
     Aws::String SerializePayload() const override;
 
     /**
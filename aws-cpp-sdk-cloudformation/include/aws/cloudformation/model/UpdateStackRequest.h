@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     UpdateStackRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateStack"; }
+
     Aws::String SerializePayload() const override;
 
     /**
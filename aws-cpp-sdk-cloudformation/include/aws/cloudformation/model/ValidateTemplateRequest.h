@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ValidateTemplateRequest();
+    inline const char* GetServiceRequestName() const override { return "ValidateTemplate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
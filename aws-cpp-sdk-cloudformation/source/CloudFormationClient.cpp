@@ -133,7 +133,7 @@ CancelUpdateStackOutcome CloudFormationClient::CancelUpdateStack(const CancelUpd
 
 CancelUpdateStackOutcomeCallable CloudFormationClient::CancelUpdateStackCallable(const CancelUpdateStackRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelUpdateStack( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelUpdateStack( request ); } );
 }
 
 void CloudFormationClient::CancelUpdateStackAsync(const CancelUpdateStackRequest& request, const CancelUpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -141,6 +141,16 @@ void CloudFormationClient::CancelUpdateStackAsync(const CancelUpdateStackRequest
   m_executor->Submit( [this, request, handler, context](){ this->CancelUpdateStackAsyncHelper( request, handler, context ); } );
 }
 
+CancelUpdateStackOutcomeCallable CloudFormationClient::CancelUpdateStackCallable(CancelUpdateStackRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::CancelUpdateStack, this, std::move(request)));
+}
+
+void CloudFormationClient::CancelUpdateStackAsync(CancelUpdateStackRequest&& request, const CancelUpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::CancelUpdateStackAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::CancelUpdateStackAsyncHelper(const CancelUpdateStackRequest& request, const CancelUpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelUpdateStack(request), context);
@@ -163,7 +173,7 @@ ContinueUpdateRollbackOutcome CloudFormationClient::ContinueUpdateRollback(const
 
 ContinueUpdateRollbackOutcomeCallable CloudFormationClient::ContinueUpdateRollbackCallable(const ContinueUpdateRollbackRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ContinueUpdateRollback( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ContinueUpdateRollback( request ); } );
 }
 
 void CloudFormationClient::ContinueUpdateRollbackAsync(const ContinueUpdateRollbackRequest& request, const ContinueUpdateRollbackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -171,6 +181,16 @@ void CloudFormationClient::ContinueUpdateRollbackAsync(const ContinueUpdateRollb
   m_executor->Submit( [this, request, handler, context](){ this->ContinueUpdateRollbackAsyncHelper( request, handler, context ); } );
 }
 
+ContinueUpdateRollbackOutcomeCallable CloudFormationClient::ContinueUpdateRollbackCallable(ContinueUpdateRollbackRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::ContinueUpdateRollback, this, std::move(request)));
+}
+
+void CloudFormationClient::ContinueUpdateRollbackAsync(ContinueUpdateRollbackRequest&& request, const ContinueUpdateRollbackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::ContinueUpdateRollbackAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::ContinueUpdateRollbackAsyncHelper(const ContinueUpdateRollbackRequest& request, const ContinueUpdateRollbackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ContinueUpdateRollback(request), context);
@@ -193,7 +213,7 @@ CreateChangeSetOutcome CloudFormationClient::CreateChangeSet(const CreateChangeS
 
 CreateChangeSetOutcomeCallable CloudFormationClient::CreateChangeSetCallable(const CreateChangeSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateChangeSet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateChangeSet( request ); } );
 }
 
 void CloudFormationClient::CreateChangeSetAsync(const CreateChangeSetRequest& request, const CreateChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -201,6 +221,16 @@ void CloudFormationClient::CreateChangeSetAsync(const CreateChangeSetRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->CreateChangeSetAsyncHelper( request, handler, context ); } );
 }
 
+CreateChangeSetOutcomeCallable CloudFormationClient::CreateChangeSetCallable(CreateChangeSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::CreateChangeSet, this, std::move(request)));
+}
+
+void CloudFormationClient::CreateChangeSetAsync(CreateChangeSetRequest&& request, const CreateChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::CreateChangeSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::CreateChangeSetAsyncHelper(const CreateChangeSetRequest& request, const CreateChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateChangeSet(request), context);
@@ -223,7 +253,7 @@ CreateStackOutcome CloudFormationClient::CreateStack(const CreateStackRequest& r
 
 CreateStackOutcomeCallable CloudFormationClient::CreateStackCallable(const CreateStackRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateStack( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateStack( request ); } );
 }
 
 void CloudFormationClient::CreateStackAsync(const CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -231,6 +261,16 @@ void CloudFormationClient::CreateStackAsync(const CreateStackRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->CreateStackAsyncHelper( request, handler, context ); } );
 }
 
+CreateStackOutcomeCallable CloudFormationClient::CreateStackCallable(CreateStackRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::CreateStack, this, std::move(request)));
+}
+
+void CloudFormationClient::CreateStackAsync(CreateStackRequest&& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::CreateStackAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::CreateStackAsyncHelper(const CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateStack(request), context);
@@ -253,7 +293,7 @@ DeleteChangeSetOutcome CloudFormationClient::DeleteChangeSet(const DeleteChangeS
 
 DeleteChangeSetOutcomeCallable CloudFormationClient::DeleteChangeSetCallable(const DeleteChangeSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteChangeSet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteChangeSet( request ); } );
 }
 
 void CloudFormationClient::DeleteChangeSetAsync(const DeleteChangeSetRequest& request, const DeleteChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -261,6 +301,16 @@ void CloudFormationClient::DeleteChangeSetAsync(const DeleteChangeSetRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->DeleteChangeSetAsyncHelper( request, handler, context ); } );
 }
 
+DeleteChangeSetOutcomeCallable CloudFormationClient::DeleteChangeSetCallable(DeleteChangeSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::DeleteChangeSet, this, std::move(request)));
+}
+
+void CloudFormationClient::DeleteChangeSetAsync(DeleteChangeSetRequest&& request, const DeleteChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::DeleteChangeSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::DeleteChangeSetAsyncHelper(const DeleteChangeSetRequest& request, const DeleteChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteChangeSet(request), context);
@@ -283,7 +333,7 @@ DeleteStackOutcome CloudFormationClient::DeleteStack(const DeleteStackRequest& r
 
 DeleteStackOutcomeCallable CloudFormationClient::DeleteStackCallable(const DeleteStackRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteStack( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteStack( request ); } );
 }
 
 void CloudFormationClient::DeleteStackAsync(const DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -291,6 +341,16 @@ void CloudFormationClient::DeleteStackAsync(const DeleteStackRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->DeleteStackAsyncHelper( request, handler, context ); } );
 }
 
+DeleteStackOutcomeCallable CloudFormationClient::DeleteStackCallable(DeleteStackRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::DeleteStack, this, std::move(request)));
+}
+
+void CloudFormationClient::DeleteStackAsync(DeleteStackRequest&& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::DeleteStackAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::DeleteStackAsyncHelper(const DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteStack(request), context);
@@ -313,7 +373,7 @@ DescribeAccountLimitsOutcome CloudFormationClient::DescribeAccountLimits(const D
 
 DescribeAccountLimitsOutcomeCallable CloudFormationClient::DescribeAccountLimitsCallable(const DescribeAccountLimitsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAccountLimits( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAccountLimits( request ); } );
 }
 
 void CloudFormationClient::DescribeAccountLimitsAsync(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -321,6 +381,16 @@ void CloudFormationClient::DescribeAccountLimitsAsync(const DescribeAccountLimit
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAccountLimitsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAccountLimitsOutcomeCallable CloudFormationClient::DescribeAccountLimitsCallable(DescribeAccountLimitsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::DescribeAccountLimits, this, std::move(request)));
+}
+
+void CloudFormationClient::DescribeAccountLimitsAsync(DescribeAccountLimitsRequest&& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::DescribeAccountLimitsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::DescribeAccountLimitsAsyncHelper(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAccountLimits(request), context);
@@ -343,7 +413,7 @@ DescribeChangeSetOutcome CloudFormationClient::DescribeChangeSet(const DescribeC
 
 DescribeChangeSetOutcomeCallable CloudFormationClient::DescribeChangeSetCallable(const DescribeChangeSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeChangeSet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeChangeSet( request ); } );
 }
 
 void CloudFormationClient::DescribeChangeSetAsync(const DescribeChangeSetRequest& request, const DescribeChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -351,6 +421,16 @@ void CloudFormationClient::DescribeChangeSetAsync(const DescribeChangeSetRequest
   m_executor->Submit( [this, request, handler, context](){ this->DescribeChangeSetAsyncHelper( request, handler, context ); } );
 }
 
+DescribeChangeSetOutcomeCallable CloudFormationClient::DescribeChangeSetCallable(DescribeChangeSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::DescribeChangeSet, this, std::move(request)));
+}
+
+void CloudFormationClient::DescribeChangeSetAsync(DescribeChangeSetRequest&& request, const DescribeChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::DescribeChangeSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::DescribeChangeSetAsyncHelper(const DescribeChangeSetRequest& request, const DescribeChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeChangeSet(request), context);
@@ -373,7 +453,7 @@ DescribeStackEventsOutcome CloudFormationClient::DescribeStackEvents(const Descr
 
 DescribeStackEventsOutcomeCallable CloudFormationClient::DescribeStackEventsCallable(const DescribeStackEventsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeStackEvents( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeStackEvents( request ); } );
 }
 
 void CloudFormationClient::DescribeStackEventsAsync(const DescribeStackEventsRequest& request, const DescribeStackEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -381,6 +461,16 @@ void CloudFormationClient::DescribeStackEventsAsync(const DescribeStackEventsReq
   m_executor->Submit( [this, request, handler, context](){ this->DescribeStackEventsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeStackEventsOutcomeCallable CloudFormationClient::DescribeStackEventsCallable(DescribeStackEventsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::DescribeStackEvents, this, std::move(request)));
+}
+
+void CloudFormationClient::DescribeStackEventsAsync(DescribeStackEventsRequest&& request, const DescribeStackEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::DescribeStackEventsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::DescribeStackEventsAsyncHelper(const DescribeStackEventsRequest& request, const DescribeStackEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeStackEvents(request), context);
@@ -403,7 +493,7 @@ DescribeStackResourceOutcome CloudFormationClient::DescribeStackResource(const D
 
 DescribeStackResourceOutcomeCallable CloudFormationClient::DescribeStackResourceCallable(const DescribeStackResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeStackResource( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeStackResource( request ); } );
 }
 
 void CloudFormationClient::DescribeStackResourceAsync(const DescribeStackResourceRequest& request, const DescribeStackResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -411,6 +501,16 @@ void CloudFormationClient::DescribeStackResourceAsync(const DescribeStackResourc
   m_executor->Submit( [this, request, handler, context](){ this->DescribeStackResourceAsyncHelper( request, handler, context ); } );
 }
 
+DescribeStackResourceOutcomeCallable CloudFormationClient::DescribeStackResourceCallable(DescribeStackResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::DescribeStackResource, this, std::move(request)));
+}
+
+void CloudFormationClient::DescribeStackResourceAsync(DescribeStackResourceRequest&& request, const DescribeStackResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::DescribeStackResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::DescribeStackResourceAsyncHelper(const DescribeStackResourceRequest& request, const DescribeStackResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeStackResource(request), context);
@@ -433,7 +533,7 @@ DescribeStackResourcesOutcome CloudFormationClient::DescribeStackResources(const
 
 DescribeStackResourcesOutcomeCallable CloudFormationClient::DescribeStackResourcesCallable(const DescribeStackResourcesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeStackResources( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeStackResources( request ); } );
 }
 
 void CloudFormationClient::DescribeStackResourcesAsync(const DescribeStackResourcesRequest& request, const DescribeStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -441,6 +541,16 @@ void CloudFormationClient::DescribeStackResourcesAsync(const DescribeStackResour
   m_executor->Submit( [this, request, handler, context](){ this->DescribeStackResourcesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeStackResourcesOutcomeCallable CloudFormationClient::DescribeStackResourcesCallable(DescribeStackResourcesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::DescribeStackResources, this, std::move(request)));
+}
+
+void CloudFormationClient::DescribeStackResourcesAsync(DescribeStackResourcesRequest&& request, const DescribeStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::DescribeStackResourcesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::DescribeStackResourcesAsyncHelper(const DescribeStackResourcesRequest& request, const DescribeStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeStackResources(request), context);
@@ -463,7 +573,7 @@ DescribeStacksOutcome CloudFormationClient::DescribeStacks(const DescribeStacksR
 
 DescribeStacksOutcomeCallable CloudFormationClient::DescribeStacksCallable(const DescribeStacksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeStacks( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeStacks( request ); } );
 }
 
 void CloudFormationClient::DescribeStacksAsync(const DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -471,6 +581,16 @@ void CloudFormationClient::DescribeStacksAsync(const DescribeStacksRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeStacksAsyncHelper( request, handler, context ); } );
 }
 
+DescribeStacksOutcomeCallable CloudFormationClient::DescribeStacksCallable(DescribeStacksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::DescribeStacks, this, std::move(request)));
+}
+
+void CloudFormationClient::DescribeStacksAsync(DescribeStacksRequest&& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::DescribeStacksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::DescribeStacksAsyncHelper(const DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeStacks(request), context);
@@ -493,7 +613,7 @@ EstimateTemplateCostOutcome CloudFormationClient::EstimateTemplateCost(const Est
 
 EstimateTemplateCostOutcomeCallable CloudFormationClient::EstimateTemplateCostCallable(const EstimateTemplateCostRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EstimateTemplateCost( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EstimateTemplateCost( request ); } );
 }
 
 void CloudFormationClient::EstimateTemplateCostAsync(const EstimateTemplateCostRequest& request, const EstimateTemplateCostResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -501,6 +621,16 @@ void CloudFormationClient::EstimateTemplateCostAsync(const EstimateTemplateCostR
   m_executor->Submit( [this, request, handler, context](){ this->EstimateTemplateCostAsyncHelper( request, handler, context ); } );
 }
 
+EstimateTemplateCostOutcomeCallable CloudFormationClient::EstimateTemplateCostCallable(EstimateTemplateCostRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::EstimateTemplateCost, this, std::move(request)));
+}
+
+void CloudFormationClient::EstimateTemplateCostAsync(EstimateTemplateCostRequest&& request, const EstimateTemplateCostResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::EstimateTemplateCostAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::EstimateTemplateCostAsyncHelper(const EstimateTemplateCostRequest& request, const EstimateTemplateCostResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EstimateTemplateCost(request), context);
@@ -523,7 +653,7 @@ ExecuteChangeSetOutcome CloudFormationClient::ExecuteChangeSet(const ExecuteChan
 
 ExecuteChangeSetOutcomeCallable CloudFormationClient::ExecuteChangeSetCallable(const ExecuteChangeSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ExecuteChangeSet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ExecuteChangeSet( request ); } );
 }
 
 void CloudFormationClient::ExecuteChangeSetAsync(const ExecuteChangeSetRequest& request, const ExecuteChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -531,6 +661,16 @@ void CloudFormationClient::ExecuteChangeSetAsync(const ExecuteChangeSetRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ExecuteChangeSetAsyncHelper( request, handler, context ); } );
 }
 
+ExecuteChangeSetOutcomeCallable CloudFormationClient::ExecuteChangeSetCallable(ExecuteChangeSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::ExecuteChangeSet, this, std::move(request)));
+}
+
+void CloudFormationClient::ExecuteChangeSetAsync(ExecuteChangeSetRequest&& request, const ExecuteChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::ExecuteChangeSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::ExecuteChangeSetAsyncHelper(const ExecuteChangeSetRequest& request, const ExecuteChangeSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ExecuteChangeSet(request), context);
@@ -553,7 +693,7 @@ GetStackPolicyOutcome CloudFormationClient::GetStackPolicy(const GetStackPolicyR
 
 GetStackPolicyOutcomeCallable CloudFormationClient::GetStackPolicyCallable(const GetStackPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetStackPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetStackPolicy( request ); } );
 }
 
 void CloudFormationClient::GetStackPolicyAsync(const GetStackPolicyRequest& request, const GetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -561,6 +701,16 @@ void CloudFormationClient::GetStackPolicyAsync(const GetStackPolicyRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->GetStackPolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetStackPolicyOutcomeCallable CloudFormationClient::GetStackPolicyCallable(GetStackPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::GetStackPolicy, this, std::move(request)));
+}
+
+void CloudFormationClient::GetStackPolicyAsync(GetStackPolicyRequest&& request, const GetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::GetStackPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::GetStackPolicyAsyncHelper(const GetStackPolicyRequest& request, const GetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetStackPolicy(request), context);
@@ -583,7 +733,7 @@ GetTemplateOutcome CloudFormationClient::GetTemplate(const GetTemplateRequest& r
 
 GetTemplateOutcomeCallable CloudFormationClient::GetTemplateCallable(const GetTemplateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetTemplate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetTemplate( request ); } );
 }
 
 void CloudFormationClient::GetTemplateAsync(const GetTemplateRequest& request, const GetTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -591,6 +741,16 @@ void CloudFormationClient::GetTemplateAsync(const GetTemplateRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->GetTemplateAsyncHelper( request, handler, context ); } );
 }
 
+GetTemplateOutcomeCallable CloudFormationClient::GetTemplateCallable(GetTemplateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::GetTemplate, this, std::move(request)));
+}
+
+void CloudFormationClient::GetTemplateAsync(GetTemplateRequest&& request, const GetTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::GetTemplateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::GetTemplateAsyncHelper(const GetTemplateRequest& request, const GetTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetTemplate(request), context);
@@ -613,7 +773,7 @@ GetTemplateSummaryOutcome CloudFormationClient::GetTemplateSummary(const GetTemp
 
 GetTemplateSummaryOutcomeCallable CloudFormationClient::GetTemplateSummaryCallable(const GetTemplateSummaryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetTemplateSummary( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetTemplateSummary( request ); } );
 }
 
 void CloudFormationClient::GetTemplateSummaryAsync(const GetTemplateSummaryRequest& request, const GetTemplateSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -621,6 +781,16 @@ void CloudFormationClient::GetTemplateSummaryAsync(const GetTemplateSummaryReque
   m_executor->Submit( [this, request, handler, context](){ this->GetTemplateSummaryAsyncHelper( request, handler, context ); } );
 }
 
+GetTemplateSummaryOutcomeCallable CloudFormationClient::GetTemplateSummaryCallable(GetTemplateSummaryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::GetTemplateSummary, this, std::move(request)));
+}
+
+void CloudFormationClient::GetTemplateSummaryAsync(GetTemplateSummaryRequest&& request, const GetTemplateSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::GetTemplateSummaryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::GetTemplateSummaryAsyncHelper(const GetTemplateSummaryRequest& request, const GetTemplateSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetTemplateSummary(request), context);
@@ -643,7 +813,7 @@ ListChangeSetsOutcome CloudFormationClient::ListChangeSets(const ListChangeSetsR
 
 ListChangeSetsOutcomeCallable CloudFormationClient::ListChangeSetsCallable(const ListChangeSetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListChangeSets( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListChangeSets( request ); } );
 }
 
 void CloudFormationClient::ListChangeSetsAsync(const ListChangeSetsRequest& request, const ListChangeSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -651,6 +821,16 @@ void CloudFormationClient::ListChangeSetsAsync(const ListChangeSetsRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->ListChangeSetsAsyncHelper( request, handler, context ); } );
 }
 
+ListChangeSetsOutcomeCallable CloudFormationClient::ListChangeSetsCallable(ListChangeSetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::ListChangeSets, this, std::move(request)));
+}
+
+void CloudFormationClient::ListChangeSetsAsync(ListChangeSetsRequest&& request, const ListChangeSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::ListChangeSetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::ListChangeSetsAsyncHelper(const ListChangeSetsRequest& request, const ListChangeSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListChangeSets(request), context);
@@ -673,7 +853,7 @@ ListStackResourcesOutcome CloudFormationClient::ListStackResources(const ListSta
 
 ListStackResourcesOutcomeCallable CloudFormationClient::ListStackResourcesCallable(const ListStackResourcesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListStackResources( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListStackResources( request ); } );
 }
 
 void CloudFormationClient::ListStackResourcesAsync(const ListStackResourcesRequest& request, const ListStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -681,6 +861,16 @@ void CloudFormationClient::ListStackResourcesAsync(const ListStackResourcesReque
   m_executor->Submit( [this, request, handler, context](){ this->ListStackResourcesAsyncHelper( request, handler, context ); } );
 }
 
+ListStackResourcesOutcomeCallable CloudFormationClient::ListStackResourcesCallable(ListStackResourcesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::ListStackResources, this, std::move(request)));
+}
+
+void CloudFormationClient::ListStackResourcesAsync(ListStackResourcesRequest&& request, const ListStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::ListStackResourcesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::ListStackResourcesAsyncHelper(const ListStackResourcesRequest& request, const ListStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListStackResources(request), context);
@@ -703,7 +893,7 @@ ListStacksOutcome CloudFormationClient::ListStacks(const ListStacksRequest& requ
 
 ListStacksOutcomeCallable CloudFormationClient::ListStacksCallable(const ListStacksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListStacks( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListStacks( request ); } );
 }
 
 void CloudFormationClient::ListStacksAsync(const ListStacksRequest& request, const ListStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -711,6 +901,16 @@ void CloudFormationClient::ListStacksAsync(const ListStacksRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->ListStacksAsyncHelper( request, handler, context ); } );
 }
 
+ListStacksOutcomeCallable CloudFormationClient::ListStacksCallable(ListStacksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::ListStacks, this, std::move(request)));
+}
+
+void CloudFormationClient::ListStacksAsync(ListStacksRequest&& request, const ListStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::ListStacksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::ListStacksAsyncHelper(const ListStacksRequest& request, const ListStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListStacks(request), context);
@@ -733,7 +933,7 @@ SetStackPolicyOutcome CloudFormationClient::SetStackPolicy(const SetStackPolicyR
 
 SetStackPolicyOutcomeCallable CloudFormationClient::SetStackPolicyCallable(const SetStackPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetStackPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetStackPolicy( request ); } );
 }
 
 void CloudFormationClient::SetStackPolicyAsync(const SetStackPolicyRequest& request, const SetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -741,6 +941,16 @@ void CloudFormationClient::SetStackPolicyAsync(const SetStackPolicyRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->SetStackPolicyAsyncHelper( request, handler, context ); } );
 }
 
+SetStackPolicyOutcomeCallable CloudFormationClient::SetStackPolicyCallable(SetStackPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::SetStackPolicy, this, std::move(request)));
+}
+
+void CloudFormationClient::SetStackPolicyAsync(SetStackPolicyRequest&& request, const SetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::SetStackPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::SetStackPolicyAsyncHelper(const SetStackPolicyRequest& request, const SetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetStackPolicy(request), context);
@@ -763,7 +973,7 @@ SignalResourceOutcome CloudFormationClient::SignalResource(const SignalResourceR
 
 SignalResourceOutcomeCallable CloudFormationClient::SignalResourceCallable(const SignalResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SignalResource( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SignalResource( request ); } );
 }
 
 void CloudFormationClient::SignalResourceAsync(const SignalResourceRequest& request, const SignalResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -771,6 +981,16 @@ void CloudFormationClient::SignalResourceAsync(const SignalResourceRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->SignalResourceAsyncHelper( request, handler, context ); } );
 }
 
+SignalResourceOutcomeCallable CloudFormationClient::SignalResourceCallable(SignalResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::SignalResource, this, std::move(request)));
+}
+
+void CloudFormationClient::SignalResourceAsync(SignalResourceRequest&& request, const SignalResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::SignalResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::SignalResourceAsyncHelper(const SignalResourceRequest& request, const SignalResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SignalResource(request), context);
@@ -793,7 +1013,7 @@ UpdateStackOutcome CloudFormationClient::UpdateStack(const UpdateStackRequest& r
 
 UpdateStackOutcomeCallable CloudFormationClient::UpdateStackCallable(const UpdateStackRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateStack( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateStack( request ); } );
 }
 
 void CloudFormationClient::UpdateStackAsync(const UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -801,6 +1021,16 @@ void CloudFormationClient::UpdateStackAsync(const UpdateStackRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->UpdateStackAsyncHelper( request, handler, context ); } );
 }
 
+UpdateStackOutcomeCallable CloudFormationClient::UpdateStackCallable(UpdateStackRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::UpdateStack, this, std::move(request)));
+}
+
+void CloudFormationClient::UpdateStackAsync(UpdateStackRequest&& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::UpdateStackAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::UpdateStackAsyncHelper(const UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateStack(request), context);
@@ -823,7 +1053,7 @@ ValidateTemplateOutcome CloudFormationClient::ValidateTemplate(const ValidateTem
 
 ValidateTemplateOutcomeCallable CloudFormationClient::ValidateTemplateCallable(const ValidateTemplateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ValidateTemplate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ValidateTemplate( request ); } );
 }
 
 void CloudFormationClient::ValidateTemplateAsync(const ValidateTemplateRequest& request, const ValidateTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -831,8 +1061,259 @@ void CloudFormationClient::ValidateTemplateAsync(const ValidateTemplateRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ValidateTemplateAsyncHelper( request, handler, context ); } );
 }
 
+ValidateTemplateOutcomeCallable CloudFormationClient::ValidateTemplateCallable(ValidateTemplateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFormationClient::ValidateTemplate, this, std::move(request)));
+}
+
+void CloudFormationClient::ValidateTemplateAsync(ValidateTemplateRequest&& request, const ValidateTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFormationClient::ValidateTemplateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFormationClient::ValidateTemplateAsyncHelper(const ValidateTemplateRequest& request, const ValidateTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ValidateTemplate(request), context);
 }
 
+Paginator<CloudFormationClient, DescribeAccountLimitsRequest, DescribeAccountLimitsOutcome> CloudFormationClient::DescribeAccountLimitsPaginator(const DescribeAccountLimitsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudFormationClient, DescribeAccountLimitsRequest, DescribeAccountLimitsOutcome>(this, &CloudFormationClient::DescribeAccountLimits, request,
+    [](const DescribeAccountLimitsRequest& current, const DescribeAccountLimitsOutcome& outcome, DescribeAccountLimitsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudFormationClient, DescribeChangeSetRequest, DescribeChangeSetOutcome> CloudFormationClient::DescribeChangeSetPaginator(const DescribeChangeSetRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudFormationClient, DescribeChangeSetRequest, DescribeChangeSetOutcome>(this, &CloudFormationClient::DescribeChangeSet, request,
+    [](const DescribeChangeSetRequest& current, const DescribeChangeSetOutcome& outcome, DescribeChangeSetRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudFormationClient, DescribeStackEventsRequest, DescribeStackEventsOutcome> CloudFormationClient::DescribeStackEventsPaginator(const DescribeStackEventsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudFormationClient, DescribeStackEventsRequest, DescribeStackEventsOutcome>(this, &CloudFormationClient::DescribeStackEvents, request,
+    [](const DescribeStackEventsRequest& current, const DescribeStackEventsOutcome& outcome, DescribeStackEventsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudFormationClient, DescribeStacksRequest, DescribeStacksOutcome> CloudFormationClient::DescribeStacksPaginator(const DescribeStacksRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudFormationClient, DescribeStacksRequest, DescribeStacksOutcome>(this, &CloudFormationClient::DescribeStacks, request,
+    [](const DescribeStacksRequest& current, const DescribeStacksOutcome& outcome, DescribeStacksRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudFormationClient, ListChangeSetsRequest, ListChangeSetsOutcome> CloudFormationClient::ListChangeSetsPaginator(const ListChangeSetsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudFormationClient, ListChangeSetsRequest, ListChangeSetsOutcome>(this, &CloudFormationClient::ListChangeSets, request,
+    [](const ListChangeSetsRequest& current, const ListChangeSetsOutcome& outcome, ListChangeSetsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudFormationClient, ListStackResourcesRequest, ListStackResourcesOutcome> CloudFormationClient::ListStackResourcesPaginator(const ListStackResourcesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudFormationClient, ListStackResourcesRequest, ListStackResourcesOutcome>(this, &CloudFormationClient::ListStackResources, request,
+    [](const ListStackResourcesRequest& current, const ListStackResourcesOutcome& outcome, ListStackResourcesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudFormationClient, ListStacksRequest, ListStacksOutcome> CloudFormationClient::ListStacksPaginator(const ListStacksRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudFormationClient, ListStacksRequest, ListStacksOutcome>(this, &CloudFormationClient::ListStacks, request,
+    [](const ListStacksRequest& current, const ListStacksOutcome& outcome, ListStacksRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<CloudFormationClient, CancelUpdateStackRequest, CancelUpdateStackOutcome> CloudFormationClient::CancelUpdateStackAwaitable(CancelUpdateStackRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::CancelUpdateStack, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, ContinueUpdateRollbackRequest, ContinueUpdateRollbackOutcome> CloudFormationClient::ContinueUpdateRollbackAwaitable(ContinueUpdateRollbackRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::ContinueUpdateRollback, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, CreateChangeSetRequest, CreateChangeSetOutcome> CloudFormationClient::CreateChangeSetAwaitable(CreateChangeSetRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::CreateChangeSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, CreateStackRequest, CreateStackOutcome> CloudFormationClient::CreateStackAwaitable(CreateStackRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::CreateStack, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, DeleteChangeSetRequest, DeleteChangeSetOutcome> CloudFormationClient::DeleteChangeSetAwaitable(DeleteChangeSetRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::DeleteChangeSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, DeleteStackRequest, DeleteStackOutcome> CloudFormationClient::DeleteStackAwaitable(DeleteStackRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::DeleteStack, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, DescribeAccountLimitsRequest, DescribeAccountLimitsOutcome> CloudFormationClient::DescribeAccountLimitsAwaitable(DescribeAccountLimitsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::DescribeAccountLimits, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, DescribeChangeSetRequest, DescribeChangeSetOutcome> CloudFormationClient::DescribeChangeSetAwaitable(DescribeChangeSetRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::DescribeChangeSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, DescribeStackEventsRequest, DescribeStackEventsOutcome> CloudFormationClient::DescribeStackEventsAwaitable(DescribeStackEventsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::DescribeStackEvents, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, DescribeStackResourceRequest, DescribeStackResourceOutcome> CloudFormationClient::DescribeStackResourceAwaitable(DescribeStackResourceRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::DescribeStackResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, DescribeStackResourcesRequest, DescribeStackResourcesOutcome> CloudFormationClient::DescribeStackResourcesAwaitable(DescribeStackResourcesRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::DescribeStackResources, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, DescribeStacksRequest, DescribeStacksOutcome> CloudFormationClient::DescribeStacksAwaitable(DescribeStacksRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::DescribeStacks, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, EstimateTemplateCostRequest, EstimateTemplateCostOutcome> CloudFormationClient::EstimateTemplateCostAwaitable(EstimateTemplateCostRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::EstimateTemplateCost, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, ExecuteChangeSetRequest, ExecuteChangeSetOutcome> CloudFormationClient::ExecuteChangeSetAwaitable(ExecuteChangeSetRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::ExecuteChangeSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, GetStackPolicyRequest, GetStackPolicyOutcome> CloudFormationClient::GetStackPolicyAwaitable(GetStackPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::GetStackPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, GetTemplateRequest, GetTemplateOutcome> CloudFormationClient::GetTemplateAwaitable(GetTemplateRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::GetTemplate, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, GetTemplateSummaryRequest, GetTemplateSummaryOutcome> CloudFormationClient::GetTemplateSummaryAwaitable(GetTemplateSummaryRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::GetTemplateSummary, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, ListChangeSetsRequest, ListChangeSetsOutcome> CloudFormationClient::ListChangeSetsAwaitable(ListChangeSetsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::ListChangeSets, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, ListStackResourcesRequest, ListStackResourcesOutcome> CloudFormationClient::ListStackResourcesAwaitable(ListStackResourcesRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::ListStackResources, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, ListStacksRequest, ListStacksOutcome> CloudFormationClient::ListStacksAwaitable(ListStacksRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::ListStacks, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, SetStackPolicyRequest, SetStackPolicyOutcome> CloudFormationClient::SetStackPolicyAwaitable(SetStackPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::SetStackPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, SignalResourceRequest, SignalResourceOutcome> CloudFormationClient::SignalResourceAwaitable(SignalResourceRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::SignalResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, UpdateStackRequest, UpdateStackOutcome> CloudFormationClient::UpdateStackAwaitable(UpdateStackRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::UpdateStack, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFormationClient, ValidateTemplateRequest, ValidateTemplateOutcome> CloudFormationClient::ValidateTemplateAwaitable(ValidateTemplateRequest request) const
+{
+  return { m_executor.get(), { this, &CloudFormationClient::ValidateTemplate, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
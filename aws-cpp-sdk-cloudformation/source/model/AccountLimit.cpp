@@ -53,13 +53,13 @@ AccountLimit& AccountLimit::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode valueNode = resultNode.FirstChild("Value");
     if(!valueNode.IsNull())
     {
-      m_value = StringUtils::ConvertToInt32(StringUtils::Trim(valueNode.GetText().c_str()).c_str());
+      m_value = StringUtils::ConvertToInt32(valueNode.GetTextView().Trim().ToString().c_str());
       m_valueHasBeenSet = true;
     }
   }
@@ -71,7 +71,7 @@ void AccountLimit::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_valueHasBeenSet)
@@ -85,7 +85,7 @@ void AccountLimit::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_valueHasBeenSet)
   {
@@ -15,6 +15,7 @@
 #include <aws/cloudformation/model/CancelUpdateStackRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudFormation::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ CancelUpdateStackRequest::CancelUpdateStackRequest() :
 
 Aws::String CancelUpdateStackRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CancelUpdateStack&";
   if(m_stackNameHasBeenSet)
   {
-    ss << "StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+    ss << "StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
 
   ss << "Version=2010-05-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
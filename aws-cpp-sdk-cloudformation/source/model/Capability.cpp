@@ -29,21 +29,29 @@ namespace Aws
       namespace CapabilityMapper
       {
 
-        static const int CAPABILITY_IAM_HASH = HashingUtils::HashString("CAPABILITY_IAM");
-        static const int CAPABILITY_NAMED_IAM_HASH = HashingUtils::HashString("CAPABILITY_NAMED_IAM");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CAPABILITY_IAM_HASH = -1522397554;
+        static const int CAPABILITY_NAMED_IAM_HASH = 2041807272;
 
 
         Capability GetCapabilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CAPABILITY_IAM_HASH)
+          switch (hashCode)
           {
+          case CAPABILITY_IAM_HASH:
             return Capability::CAPABILITY_IAM;
-          }
-          else if (hashCode == CAPABILITY_NAMED_IAM_HASH)
-          {
+          case CAPABILITY_NAMED_IAM_HASH:
             return Capability::CAPABILITY_NAMED_IAM;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
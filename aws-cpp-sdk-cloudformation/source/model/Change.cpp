@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ Change& Change::operator =(const XmlNode& xmlNode)
     XmlNode typeNode = resultNode.FirstChild("Type");
     if(!typeNode.IsNull())
     {
-      m_type = ChangeTypeMapper::GetChangeTypeForName(StringUtils::Trim(typeNode.GetText().c_str()).c_str());
+      m_type = ChangeTypeMapper::GetChangeTypeForName(typeNode.GetTextView().Trim().ToString().c_str());
       m_typeHasBeenSet = true;
     }
     XmlNode resourceChangeNode = resultNode.FirstChild("ResourceChange");
@@ -74,9 +75,9 @@ void Change::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
 
   if(m_resourceChangeHasBeenSet)
   {
-      Aws::StringStream resourceChangeLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream resourceChangeLocationAndMemberSs;
       resourceChangeLocationAndMemberSs << location << index << locationValue << ".ResourceChange";
-      m_resourceChange.OutputToStream(oStream, resourceChangeLocationAndMemberSs.str().c_str());
+      m_resourceChange.OutputToStream(oStream, resourceChangeLocationAndMemberSs.GetString().c_str());
   }
 
 }
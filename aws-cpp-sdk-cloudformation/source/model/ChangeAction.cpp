@@ -29,26 +29,32 @@ namespace Aws
       namespace ChangeActionMapper
       {
 
-        static const int Add_HASH = HashingUtils::HashString("Add");
-        static const int Modify_HASH = HashingUtils::HashString("Modify");
-        static const int Remove_HASH = HashingUtils::HashString("Remove");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Add_HASH = 65665;
+        static const int Modify_HASH = -1984928550;
+        static const int Remove_HASH = -1850743644;
 
 
         ChangeAction GetChangeActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Add_HASH)
+          switch (hashCode)
           {
+          case Add_HASH:
             return ChangeAction::Add;
-          }
-          else if (hashCode == Modify_HASH)
-          {
+          case Modify_HASH:
             return ChangeAction::Modify;
-          }
-          else if (hashCode == Remove_HASH)
-          {
+          case Remove_HASH:
             return ChangeAction::Remove;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,36 +29,38 @@ namespace Aws
       namespace ChangeSetStatusMapper
       {
 
-        static const int CREATE_PENDING_HASH = HashingUtils::HashString("CREATE_PENDING");
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int CREATE_COMPLETE_HASH = HashingUtils::HashString("CREATE_COMPLETE");
-        static const int DELETE_COMPLETE_HASH = HashingUtils::HashString("DELETE_COMPLETE");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CREATE_PENDING_HASH = 288199988;
+        static const int CREATE_IN_PROGRESS_HASH = 43560260;
+        static const int CREATE_COMPLETE_HASH = -569796324;
+        static const int DELETE_COMPLETE_HASH = 1677560141;
+        static const int FAILED_HASH = 2066319421;
 
 
         ChangeSetStatus GetChangeSetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_PENDING_HASH)
+          switch (hashCode)
           {
+          case CREATE_PENDING_HASH:
             return ChangeSetStatus::CREATE_PENDING;
-          }
-          else if (hashCode == CREATE_IN_PROGRESS_HASH)
-          {
+          case CREATE_IN_PROGRESS_HASH:
             return ChangeSetStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == CREATE_COMPLETE_HASH)
-          {
+          case CREATE_COMPLETE_HASH:
             return ChangeSetStatus::CREATE_COMPLETE;
-          }
-          else if (hashCode == DELETE_COMPLETE_HASH)
-          {
+          case DELETE_COMPLETE_HASH:
             return ChangeSetStatus::DELETE_COMPLETE;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return ChangeSetStatus::FAILED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -65,55 +65,55 @@ ChangeSetSummary& ChangeSetSummary::operator =(const XmlNode& xmlNode)
     XmlNode stackIdNode = resultNode.FirstChild("StackId");
     if(!stackIdNode.IsNull())
     {
-      m_stackId = StringUtils::Trim(stackIdNode.GetText().c_str());
+      m_stackId = stackIdNode.GetTextView().Trim().ToString();
       m_stackIdHasBeenSet = true;
     }
     XmlNode stackNameNode = resultNode.FirstChild("StackName");
     if(!stackNameNode.IsNull())
     {
-      m_stackName = StringUtils::Trim(stackNameNode.GetText().c_str());
+      m_stackName = stackNameNode.GetTextView().Trim().ToString();
       m_stackNameHasBeenSet = true;
     }
     XmlNode changeSetIdNode = resultNode.FirstChild("ChangeSetId");
     if(!changeSetIdNode.IsNull())
     {
-      m_changeSetId = StringUtils::Trim(changeSetIdNode.GetText().c_str());
+      m_changeSetId = changeSetIdNode.GetTextView().Trim().ToString();
       m_changeSetIdHasBeenSet = true;
     }
     XmlNode changeSetNameNode = resultNode.FirstChild("ChangeSetName");
     if(!changeSetNameNode.IsNull())
     {
-      m_changeSetName = StringUtils::Trim(changeSetNameNode.GetText().c_str());
+      m_changeSetName = changeSetNameNode.GetTextView().Trim().ToString();
       m_changeSetNameHasBeenSet = true;
     }
     XmlNode executionStatusNode = resultNode.FirstChild("ExecutionStatus");
     if(!executionStatusNode.IsNull())
     {
-      m_executionStatus = ExecutionStatusMapper::GetExecutionStatusForName(StringUtils::Trim(executionStatusNode.GetText().c_str()).c_str());
+      m_executionStatus = ExecutionStatusMapper::GetExecutionStatusForName(executionStatusNode.GetTextView().Trim().ToString().c_str());
       m_executionStatusHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = ChangeSetStatusMapper::GetChangeSetStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = ChangeSetStatusMapper::GetChangeSetStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode statusReasonNode = resultNode.FirstChild("StatusReason");
     if(!statusReasonNode.IsNull())
     {
-      m_statusReason = StringUtils::Trim(statusReasonNode.GetText().c_str());
+      m_statusReason = statusReasonNode.GetTextView().Trim().ToString();
       m_statusReasonHasBeenSet = true;
     }
     XmlNode creationTimeNode = resultNode.FirstChild("CreationTime");
     if(!creationTimeNode.IsNull())
     {
-      m_creationTime = DateTime(StringUtils::Trim(creationTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_creationTime = DateTime(creationTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_creationTimeHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
   }
@@ -125,22 +125,22 @@ void ChangeSetSummary::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_stackIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StackId=" << StringUtils::URLEncode(m_stackId.c_str()) << "&";
+      oStream << location << index << locationValue << ".StackId=" << StringUtils::URLEncoded(m_stackId) << "&";
   }
 
   if(m_stackNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+      oStream << location << index << locationValue << ".StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
 
   if(m_changeSetIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ChangeSetId=" << StringUtils::URLEncode(m_changeSetId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ChangeSetId=" << StringUtils::URLEncoded(m_changeSetId) << "&";
   }
 
   if(m_changeSetNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ChangeSetName=" << StringUtils::URLEncode(m_changeSetName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ChangeSetName=" << StringUtils::URLEncoded(m_changeSetName) << "&";
   }
 
   if(m_executionStatusHasBeenSet)
@@ -155,17 +155,17 @@ void ChangeSetSummary::OutputToStream(Aws::OStream& oStream, const char* locatio
 
   if(m_statusReasonHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StatusReason=" << StringUtils::URLEncode(m_statusReason.c_str()) << "&";
+      oStream << location << index << locationValue << ".StatusReason=" << StringUtils::URLEncoded(m_statusReason) << "&";
   }
 
   if(m_creationTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreationTime=" << StringUtils::URLEncode(m_creationTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreationTime=" << StringUtils::URLEncoded(m_creationTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
 }
@@ -174,19 +174,19 @@ void ChangeSetSummary::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_stackIdHasBeenSet)
   {
-      oStream << location << ".StackId=" << StringUtils::URLEncode(m_stackId.c_str()) << "&";
+      oStream << location << ".StackId=" << StringUtils::URLEncoded(m_stackId) << "&";
   }
   if(m_stackNameHasBeenSet)
   {
-      oStream << location << ".StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+      oStream << location << ".StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
   if(m_changeSetIdHasBeenSet)
   {
-      oStream << location << ".ChangeSetId=" << StringUtils::URLEncode(m_changeSetId.c_str()) << "&";
+      oStream << location << ".ChangeSetId=" << StringUtils::URLEncoded(m_changeSetId) << "&";
   }
   if(m_changeSetNameHasBeenSet)
   {
-      oStream << location << ".ChangeSetName=" << StringUtils::URLEncode(m_changeSetName.c_str()) << "&";
+      oStream << location << ".ChangeSetName=" << StringUtils::URLEncoded(m_changeSetName) << "&";
   }
   if(m_executionStatusHasBeenSet)
   {
@@ -198,15 +198,15 @@ void ChangeSetSummary::OutputToStream(Aws::OStream& oStream, const char* locatio
   }
   if(m_statusReasonHasBeenSet)
   {
-      oStream << location << ".StatusReason=" << StringUtils::URLEncode(m_statusReason.c_str()) << "&";
+      oStream << location << ".StatusReason=" << StringUtils::URLEncoded(m_statusReason) << "&";
   }
   if(m_creationTimeHasBeenSet)
   {
-      oStream << location << ".CreationTime=" << StringUtils::URLEncode(m_creationTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreationTime=" << StringUtils::URLEncoded(m_creationTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 }
 
@@ -29,36 +29,38 @@ namespace Aws
       namespace ChangeSourceMapper
       {
 
-        static const int ResourceReference_HASH = HashingUtils::HashString("ResourceReference");
-        static const int ParameterReference_HASH = HashingUtils::HashString("ParameterReference");
-        static const int ResourceAttribute_HASH = HashingUtils::HashString("ResourceAttribute");
-        static const int DirectModification_HASH = HashingUtils::HashString("DirectModification");
-        static const int Automatic_HASH = HashingUtils::HashString("Automatic");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ResourceReference_HASH = -966358339;
+        static const int ParameterReference_HASH = 99055042;
+        static const int ResourceAttribute_HASH = -28117490;
+        static const int DirectModification_HASH = -2146244539;
+        static const int Automatic_HASH = -617328117;
 
 
         ChangeSource GetChangeSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ResourceReference_HASH)
+          switch (hashCode)
           {
+          case ResourceReference_HASH:
             return ChangeSource::ResourceReference;
-          }
-          else if (hashCode == ParameterReference_HASH)
-          {
+          case ParameterReference_HASH:
             return ChangeSource::ParameterReference;
-          }
-          else if (hashCode == ResourceAttribute_HASH)
-          {
+          case ResourceAttribute_HASH:
             return ChangeSource::ResourceAttribute;
-          }
-          else if (hashCode == DirectModification_HASH)
-          {
+          case DirectModification_HASH:
             return ChangeSource::DirectModification;
-          }
-          else if (hashCode == Automatic_HASH)
-          {
+          case Automatic_HASH:
             return ChangeSource::Automatic;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
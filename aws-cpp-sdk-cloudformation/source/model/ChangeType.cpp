@@ -29,16 +29,26 @@ namespace Aws
       namespace ChangeTypeMapper
       {
 
-        static const int Resource_HASH = HashingUtils::HashString("Resource");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Resource_HASH = -276420562;
 
 
         ChangeType GetChangeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Resource_HASH)
+          switch (hashCode)
           {
+          case Resource_HASH:
             return ChangeType::Resource;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
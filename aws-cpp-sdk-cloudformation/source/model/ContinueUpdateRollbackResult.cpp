@@ -40,7 +40,7 @@ ContinueUpdateRollbackResult& ContinueUpdateRollbackResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ContinueUpdateRollbackResult")
+  if (rootNode.GetNameView() != "ContinueUpdateRollbackResult")
   {
     resultNode = rootNode.FirstChild("ContinueUpdateRollbackResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/cloudformation/model/CreateChangeSetRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudFormation::Model;
 using namespace Aws::Utils;
@@ -38,21 +39,21 @@ CreateChangeSetRequest::CreateChangeSetRequest() :
 
 Aws::String CreateChangeSetRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateChangeSet&";
   if(m_stackNameHasBeenSet)
   {
-    ss << "StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+    ss << "StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
 
   if(m_templateBodyHasBeenSet)
   {
-    ss << "TemplateBody=" << StringUtils::URLEncode(m_templateBody.c_str()) << "&";
+    ss << "TemplateBody=" << StringUtils::URLEncoded(m_templateBody) << "&";
   }
 
   if(m_templateURLHasBeenSet)
   {
-    ss << "TemplateURL=" << StringUtils::URLEncode(m_templateURL.c_str()) << "&";
+    ss << "TemplateURL=" << StringUtils::URLEncoded(m_templateURL) << "&";
   }
 
   if(m_usePreviousTemplateHasBeenSet)
@@ -76,7 +77,7 @@ Aws::String CreateChangeSetRequest::SerializePayload() const
     for(auto& item : m_capabilities)
     {
       ss << "Capabilities.member." << capabilitiesCount << "="
-          << StringUtils::URLEncode(CapabilityMapper::GetNameForCapability(item).c_str()) << "&";
+          << StringUtils::URLEncoded(CapabilityMapper::GetNameForCapability(item)) << "&";
       capabilitiesCount++;
     }
   }
@@ -87,7 +88,7 @@ Aws::String CreateChangeSetRequest::SerializePayload() const
     for(auto& item : m_resourceTypes)
     {
       ss << "ResourceTypes.member." << resourceTypesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       resourceTypesCount++;
     }
   }
@@ -98,7 +99,7 @@ Aws::String CreateChangeSetRequest::SerializePayload() const
     for(auto& item : m_notificationARNs)
     {
       ss << "NotificationARNs.member." << notificationARNsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       notificationARNsCount++;
     }
   }
@@ -115,20 +116,20 @@ Aws::String CreateChangeSetRequest::SerializePayload() const
 
   if(m_changeSetNameHasBeenSet)
   {
-    ss << "ChangeSetName=" << StringUtils::URLEncode(m_changeSetName.c_str()) << "&";
+    ss << "ChangeSetName=" << StringUtils::URLEncoded(m_changeSetName) << "&";
   }
 
   if(m_clientTokenHasBeenSet)
   {
-    ss << "ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+    ss << "ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   ss << "Version=2010-05-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateChangeSetResult& CreateChangeSetResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateChangeSetResult")
+  if (rootNode.GetNameView() != "CreateChangeSetResult")
   {
     resultNode = rootNode.FirstChild("CreateChangeSetResult");
   }
@@ -50,7 +50,7 @@ CreateChangeSetResult& CreateChangeSetResult::operator =(const AmazonWebServiceR
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
     }
   }
 
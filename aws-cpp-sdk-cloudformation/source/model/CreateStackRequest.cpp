@@ -15,6 +15,7 @@
 #include <aws/cloudformation/model/CreateStackRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudFormation::Model;
 using namespace Aws::Utils;
@@ -40,21 +41,21 @@ CreateStackRequest::CreateStackRequest() :
 
 Aws::String CreateStackRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateStack&";
   if(m_stackNameHasBeenSet)
   {
-    ss << "StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+    ss << "StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
 
   if(m_templateBodyHasBeenSet)
   {
-    ss << "TemplateBody=" << StringUtils::URLEncode(m_templateBody.c_str()) << "&";
+    ss << "TemplateBody=" << StringUtils::URLEncoded(m_templateBody) << "&";
   }
 
   if(m_templateURLHasBeenSet)
   {
-    ss << "TemplateURL=" << StringUtils::URLEncode(m_templateURL.c_str()) << "&";
+    ss << "TemplateURL=" << StringUtils::URLEncoded(m_templateURL) << "&";
   }
 
   if(m_parametersHasBeenSet)
@@ -83,7 +84,7 @@ Aws::String CreateStackRequest::SerializePayload() const
     for(auto& item : m_notificationARNs)
     {
       ss << "NotificationARNs.member." << notificationARNsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       notificationARNsCount++;
     }
   }
@@ -94,7 +95,7 @@ Aws::String CreateStackRequest::SerializePayload() const
     for(auto& item : m_capabilities)
     {
       ss << "Capabilities.member." << capabilitiesCount << "="
-          << StringUtils::URLEncode(CapabilityMapper::GetNameForCapability(item).c_str()) << "&";
+          << StringUtils::URLEncoded(CapabilityMapper::GetNameForCapability(item)) << "&";
       capabilitiesCount++;
     }
   }
@@ -105,7 +106,7 @@ Aws::String CreateStackRequest::SerializePayload() const
     for(auto& item : m_resourceTypes)
     {
       ss << "ResourceTypes.member." << resourceTypesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       resourceTypesCount++;
     }
   }
@@ -117,12 +118,12 @@ Aws::String CreateStackRequest::SerializePayload() const
 
   if(m_stackPolicyBodyHasBeenSet)
   {
-    ss << "StackPolicyBody=" << StringUtils::URLEncode(m_stackPolicyBody.c_str()) << "&";
+    ss << "StackPolicyBody=" << StringUtils::URLEncoded(m_stackPolicyBody) << "&";
   }
 
   if(m_stackPolicyURLHasBeenSet)
   {
-    ss << "StackPolicyURL=" << StringUtils::URLEncode(m_stackPolicyURL.c_str()) << "&";
+    ss << "StackPolicyURL=" << StringUtils::URLEncoded(m_stackPolicyURL) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -136,6 +137,6 @@ Aws::String CreateStackRequest::SerializePayload() const
   }
 
   ss << "Version=2010-05-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
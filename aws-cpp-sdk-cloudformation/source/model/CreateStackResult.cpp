@@ -40,7 +40,7 @@ CreateStackResult& CreateStackResult::operator =(const AmazonWebServiceResult<Xm
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateStackResult")
+  if (rootNode.GetNameView() != "CreateStackResult")
   {
     resultNode = rootNode.FirstChild("CreateStackResult");
   }
@@ -50,7 +50,7 @@ CreateStackResult& CreateStackResult::operator =(const AmazonWebServiceResult<Xm
     XmlNode stackIdNode = resultNode.FirstChild("StackId");
     if(!stackIdNode.IsNull())
     {
-      m_stackId = StringUtils::Trim(stackIdNode.GetText().c_str());
+      m_stackId = stackIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/cloudformation/model/DeleteChangeSetRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudFormation::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ DeleteChangeSetRequest::DeleteChangeSetRequest() :
 
 Aws::String DeleteChangeSetRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteChangeSet&";
   if(m_changeSetNameHasBeenSet)
   {
-    ss << "ChangeSetName=" << StringUtils::URLEncode(m_changeSetName.c_str()) << "&";
+    ss << "ChangeSetName=" << StringUtils::URLEncoded(m_changeSetName) << "&";
   }
 
   if(m_stackNameHasBeenSet)
   {
-    ss << "StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+    ss << "StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
 
   ss << "Version=2010-05-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DeleteChangeSetResult& DeleteChangeSetResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteChangeSetResult")
+  if (rootNode.GetNameView() != "DeleteChangeSetResult")
   {
     resultNode = rootNode.FirstChild("DeleteChangeSetResult");
   }
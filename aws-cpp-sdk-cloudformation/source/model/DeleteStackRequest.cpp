@@ -15,6 +15,7 @@
 #include <aws/cloudformation/model/DeleteStackRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudFormation::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ DeleteStackRequest::DeleteStackRequest() :
 
 Aws::String DeleteStackRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteStack&";
   if(m_stackNameHasBeenSet)
   {
-    ss << "StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+    ss << "StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
 
   if(m_retainResourcesHasBeenSet)
@@ -40,12 +41,12 @@ Aws::String DeleteStackRequest::SerializePayload() const
     for(auto& item : m_retainResources)
     {
       ss << "RetainResources.member." << retainResourcesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       retainResourcesCount++;
     }
   }
 
   ss << "Version=2010-05-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeAccountLimitsResult& DescribeAccountLimitsResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeAccountLimitsResult")
+  if (rootNode.GetNameView() != "DescribeAccountLimitsResult")
   {
     resultNode = rootNode.FirstChild("DescribeAccountLimitsResult");
   }
@@ -61,7 +61,7 @@ DescribeAccountLimitsResult& DescribeAccountLimitsResult::operator =(const Amazo
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ DescribeChangeSetResult& DescribeChangeSetResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeChangeSetResult")
+  if (rootNode.GetNameView() != "DescribeChangeSetResult")
   {
     resultNode = rootNode.FirstChild("DescribeChangeSetResult");
   }
@@ -50,27 +50,27 @@ DescribeChangeSetResult& DescribeChangeSetResult::operator =(const AmazonWebServ
     XmlNode changeSetNameNode = resultNode.FirstChild("ChangeSetName");
     if(!changeSetNameNode.IsNull())
     {
-      m_changeSetName = StringUtils::Trim(changeSetNameNode.GetText().c_str());
+      m_changeSetName = changeSetNameNode.GetTextView().Trim().ToString();
     }
     XmlNode changeSetIdNode = resultNode.FirstChild("ChangeSetId");
     if(!changeSetIdNode.IsNull())
     {
-      m_changeSetId = StringUtils::Trim(changeSetIdNode.GetText().c_str());
+      m_changeSetId = changeSetIdNode.GetTextView().Trim().ToString();
     }
     XmlNode stackIdNode = resultNode.FirstChild("StackId");
     if(!stackIdNode.IsNull())
     {
-      m_stackId = StringUtils::Trim(stackIdNode.GetText().c_str());
+      m_stackId = stackIdNode.GetTextView().Trim().ToString();
     }
     XmlNode stackNameNode = resultNode.FirstChild("StackName");
     if(!stackNameNode.IsNull())
     {
-      m_stackName = StringUtils::Trim(stackNameNode.GetText().c_str());
+      m_stackName = stackNameNode.GetTextView().Trim().ToString();
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
     }
     XmlNode parametersNode = resultNode.FirstChild("Parameters");
     if(!parametersNode.IsNull())
@@ -86,22 +86,22 @@ DescribeChangeSetResult& DescribeChangeSetResult::operator =(const AmazonWebServ
     XmlNode creationTimeNode = resultNode.FirstChild("CreationTime");
     if(!creationTimeNode.IsNull())
     {
-      m_creationTime = DateTime(StringUtils::Trim(creationTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_creationTime = DateTime(creationTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
     XmlNode executionStatusNode = resultNode.FirstChild("ExecutionStatus");
     if(!executionStatusNode.IsNull())
     {
-      m_executionStatus = ExecutionStatusMapper::GetExecutionStatusForName(StringUtils::Trim(executionStatusNode.GetText().c_str()).c_str());
+      m_executionStatus = ExecutionStatusMapper::GetExecutionStatusForName(executionStatusNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = ChangeSetStatusMapper::GetChangeSetStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = ChangeSetStatusMapper::GetChangeSetStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode statusReasonNode = resultNode.FirstChild("StatusReason");
     if(!statusReasonNode.IsNull())
     {
-      m_statusReason = StringUtils::Trim(statusReasonNode.GetText().c_str());
+      m_statusReason = statusReasonNode.GetTextView().Trim().ToString();
     }
     XmlNode notificationARNsNode = resultNode.FirstChild("NotificationARNs");
     if(!notificationARNsNode.IsNull())
@@ -109,7 +109,7 @@ DescribeChangeSetResult& DescribeChangeSetResult::operator =(const AmazonWebServ
       XmlNode notificationARNsMember = notificationARNsNode.FirstChild("member");
       while(!notificationARNsMember.IsNull())
       {
-        m_notificationARNs.push_back(StringUtils::Trim(notificationARNsMember.GetText().c_str()));
+        m_notificationARNs.push_back(notificationARNsMember.GetTextView().Trim().ToString());
         notificationARNsMember = notificationARNsMember.NextNode("member");
       }
 
@@ -120,7 +120,7 @@ DescribeChangeSetResult& DescribeChangeSetResult::operator =(const AmazonWebServ
       XmlNode capabilitiesMember = capabilitiesNode.FirstChild("member");
       while(!capabilitiesMember.IsNull())
       {
-        m_capabilities.push_back(CapabilityMapper::GetCapabilityForName(StringUtils::Trim(capabilitiesMember.GetText().c_str())));
+        m_capabilities.push_back(CapabilityMapper::GetCapabilityForName(capabilitiesMember.GetTextView().Trim().ToString()));
         capabilitiesMember = capabilitiesMember.NextNode("member");
       }
 
@@ -150,7 +150,7 @@ DescribeChangeSetResult& DescribeChangeSetResult::operator =(const AmazonWebServ
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
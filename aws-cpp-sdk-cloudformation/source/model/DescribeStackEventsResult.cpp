@@ -40,7 +40,7 @@ DescribeStackEventsResult& DescribeStackEventsResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeStackEventsResult")
+  if (rootNode.GetNameView() != "DescribeStackEventsResult")
   {
     resultNode = rootNode.FirstChild("DescribeStackEventsResult");
   }
@@ -61,7 +61,7 @@ DescribeStackEventsResult& DescribeStackEventsResult::operator =(const AmazonWeb
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ DescribeStackResourceResult& DescribeStackResourceResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeStackResourceResult")
+  if (rootNode.GetNameView() != "DescribeStackResourceResult")
   {
     resultNode = rootNode.FirstChild("DescribeStackResourceResult");
   }
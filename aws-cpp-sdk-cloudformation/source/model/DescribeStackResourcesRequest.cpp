@@ -15,6 +15,7 @@
 #include <aws/cloudformation/model/DescribeStackResourcesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudFormation::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ DescribeStackResourcesRequest::DescribeStackResourcesRequest() :
 
 Aws::String DescribeStackResourcesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeStackResources&";
   if(m_stackNameHasBeenSet)
   {
-    ss << "StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+    ss << "StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
 
   if(m_logicalResourceIdHasBeenSet)
   {
-    ss << "LogicalResourceId=" << StringUtils::URLEncode(m_logicalResourceId.c_str()) << "&";
+    ss << "LogicalResourceId=" << StringUtils::URLEncoded(m_logicalResourceId) << "&";
   }
 
   if(m_physicalResourceIdHasBeenSet)
   {
-    ss << "PhysicalResourceId=" << StringUtils::URLEncode(m_physicalResourceId.c_str()) << "&";
+    ss << "PhysicalResourceId=" << StringUtils::URLEncoded(m_physicalResourceId) << "&";
   }
 
   ss << "Version=2010-05-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeStackResourcesResult& DescribeStackResourcesResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeStackResourcesResult")
+  if (rootNode.GetNameView() != "DescribeStackResourcesResult")
   {
     resultNode = rootNode.FirstChild("DescribeStackResourcesResult");
   }
@@ -40,7 +40,7 @@ DescribeStacksResult& DescribeStacksResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeStacksResult")
+  if (rootNode.GetNameView() != "DescribeStacksResult")
   {
     resultNode = rootNode.FirstChild("DescribeStacksResult");
   }
@@ -61,7 +61,7 @@ DescribeStacksResult& DescribeStacksResult::operator =(const AmazonWebServiceRes
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/cloudformation/model/EstimateTemplateCostRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudFormation::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ EstimateTemplateCostRequest::EstimateTemplateCostRequest() :
 
 Aws::String EstimateTemplateCostRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=EstimateTemplateCost&";
   if(m_templateBodyHasBeenSet)
   {
-    ss << "TemplateBody=" << StringUtils::URLEncode(m_templateBody.c_str()) << "&";
+    ss << "TemplateBody=" << StringUtils::URLEncoded(m_templateBody) << "&";
   }
 
   if(m_templateURLHasBeenSet)
   {
-    ss << "TemplateURL=" << StringUtils::URLEncode(m_templateURL.c_str()) << "&";
+    ss << "TemplateURL=" << StringUtils::URLEncoded(m_templateURL) << "&";
   }
 
   if(m_parametersHasBeenSet)
@@ -51,6 +52,6 @@ Aws::String EstimateTemplateCostRequest::SerializePayload() const
   }
 
   ss << "Version=2010-05-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ EstimateTemplateCostResult& EstimateTemplateCostResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "EstimateTemplateCostResult")
+  if (rootNode.GetNameView() != "EstimateTemplateCostResult")
   {
     resultNode = rootNode.FirstChild("EstimateTemplateCostResult");
   }
@@ -50,7 +50,7 @@ EstimateTemplateCostResult& EstimateTemplateCostResult::operator =(const AmazonW
     XmlNode urlNode = resultNode.FirstChild("Url");
     if(!urlNode.IsNull())
     {
-      m_url = StringUtils::Trim(urlNode.GetText().c_str());
+      m_url = urlNode.GetTextView().Trim().ToString();
     }
   }
 
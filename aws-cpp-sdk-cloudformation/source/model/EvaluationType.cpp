@@ -29,21 +29,29 @@ namespace Aws
       namespace EvaluationTypeMapper
       {
 
-        static const int Static_HASH = HashingUtils::HashString("Static");
-        static const int Dynamic_HASH = HashingUtils::HashString("Dynamic");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Static_HASH = -1808614770;
+        static const int Dynamic_HASH = -505546721;
 
 
         EvaluationType GetEvaluationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Static_HASH)
+          switch (hashCode)
           {
+          case Static_HASH:
             return EvaluationType::Static;
-          }
-          else if (hashCode == Dynamic_HASH)
-          {
+          case Dynamic_HASH:
             return EvaluationType::Dynamic;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
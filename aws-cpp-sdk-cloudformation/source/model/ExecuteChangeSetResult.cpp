@@ -40,7 +40,7 @@ ExecuteChangeSetResult& ExecuteChangeSetResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ExecuteChangeSetResult")
+  if (rootNode.GetNameView() != "ExecuteChangeSetResult")
   {
     resultNode = rootNode.FirstChild("ExecuteChangeSetResult");
   }
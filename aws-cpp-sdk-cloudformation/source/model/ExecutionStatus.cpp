@@ -29,41 +29,41 @@ namespace Aws
       namespace ExecutionStatusMapper
       {
 
-        static const int UNAVAILABLE_HASH = HashingUtils::HashString("UNAVAILABLE");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int EXECUTE_IN_PROGRESS_HASH = HashingUtils::HashString("EXECUTE_IN_PROGRESS");
-        static const int EXECUTE_COMPLETE_HASH = HashingUtils::HashString("EXECUTE_COMPLETE");
-        static const int EXECUTE_FAILED_HASH = HashingUtils::HashString("EXECUTE_FAILED");
-        static const int OBSOLETE_HASH = HashingUtils::HashString("OBSOLETE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int UNAVAILABLE_HASH = 1487498288;
+        static const int AVAILABLE_HASH = 2052692649;
+        static const int EXECUTE_IN_PROGRESS_HASH = -1159930339;
+        static const int EXECUTE_COMPLETE_HASH = 1307688675;
+        static const int EXECUTE_FAILED_HASH = -944797593;
+        static const int OBSOLETE_HASH = 1140274585;
 
 
         ExecutionStatus GetExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNAVAILABLE_HASH)
+          switch (hashCode)
           {
+          case UNAVAILABLE_HASH:
             return ExecutionStatus::UNAVAILABLE;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
+          case AVAILABLE_HASH:
             return ExecutionStatus::AVAILABLE;
-          }
-          else if (hashCode == EXECUTE_IN_PROGRESS_HASH)
-          {
+          case EXECUTE_IN_PROGRESS_HASH:
             return ExecutionStatus::EXECUTE_IN_PROGRESS;
-          }
-          else if (hashCode == EXECUTE_COMPLETE_HASH)
-          {
+          case EXECUTE_COMPLETE_HASH:
             return ExecutionStatus::EXECUTE_COMPLETE;
-          }
-          else if (hashCode == EXECUTE_FAILED_HASH)
-          {
+          case EXECUTE_FAILED_HASH:
             return ExecutionStatus::EXECUTE_FAILED;
-          }
-          else if (hashCode == OBSOLETE_HASH)
-          {
+          case OBSOLETE_HASH:
             return ExecutionStatus::OBSOLETE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -40,7 +40,7 @@ GetStackPolicyResult& GetStackPolicyResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetStackPolicyResult")
+  if (rootNode.GetNameView() != "GetStackPolicyResult")
   {
     resultNode = rootNode.FirstChild("GetStackPolicyResult");
   }
@@ -50,7 +50,7 @@ GetStackPolicyResult& GetStackPolicyResult::operator =(const AmazonWebServiceRes
     XmlNode stackPolicyBodyNode = resultNode.FirstChild("StackPolicyBody");
     if(!stackPolicyBodyNode.IsNull())
     {
-      m_stackPolicyBody = StringUtils::Trim(stackPolicyBodyNode.GetText().c_str());
+      m_stackPolicyBody = stackPolicyBodyNode.GetTextView().Trim().ToString();
     }
   }
 
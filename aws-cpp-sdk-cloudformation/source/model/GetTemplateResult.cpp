@@ -40,7 +40,7 @@ GetTemplateResult& GetTemplateResult::operator =(const AmazonWebServiceResult<Xm
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetTemplateResult")
+  if (rootNode.GetNameView() != "GetTemplateResult")
   {
     resultNode = rootNode.FirstChild("GetTemplateResult");
   }
@@ -50,7 +50,7 @@ GetTemplateResult& GetTemplateResult::operator =(const AmazonWebServiceResult<Xm
     XmlNode templateBodyNode = resultNode.FirstChild("TemplateBody");
     if(!templateBodyNode.IsNull())
     {
-      m_templateBody = StringUtils::Trim(templateBodyNode.GetText().c_str());
+      m_templateBody = templateBodyNode.GetTextView().Trim().ToString();
     }
   }
 
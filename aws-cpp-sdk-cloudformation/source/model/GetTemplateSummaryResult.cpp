@@ -40,7 +40,7 @@ GetTemplateSummaryResult& GetTemplateSummaryResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetTemplateSummaryResult")
+  if (rootNode.GetNameView() != "GetTemplateSummaryResult")
   {
     resultNode = rootNode.FirstChild("GetTemplateSummaryResult");
   }
@@ -61,7 +61,7 @@ GetTemplateSummaryResult& GetTemplateSummaryResult::operator =(const AmazonWebSe
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
     }
     XmlNode capabilitiesNode = resultNode.FirstChild("Capabilities");
     if(!capabilitiesNode.IsNull())
@@ -69,7 +69,7 @@ GetTemplateSummaryResult& GetTemplateSummaryResult::operator =(const AmazonWebSe
       XmlNode capabilitiesMember = capabilitiesNode.FirstChild("member");
       while(!capabilitiesMember.IsNull())
       {
-        m_capabilities.push_back(CapabilityMapper::GetCapabilityForName(StringUtils::Trim(capabilitiesMember.GetText().c_str())));
+        m_capabilities.push_back(CapabilityMapper::GetCapabilityForName(capabilitiesMember.GetTextView().Trim().ToString()));
         capabilitiesMember = capabilitiesMember.NextNode("member");
       }
 
@@ -77,7 +77,7 @@ GetTemplateSummaryResult& GetTemplateSummaryResult::operator =(const AmazonWebSe
     XmlNode capabilitiesReasonNode = resultNode.FirstChild("CapabilitiesReason");
     if(!capabilitiesReasonNode.IsNull())
     {
-      m_capabilitiesReason = StringUtils::Trim(capabilitiesReasonNode.GetText().c_str());
+      m_capabilitiesReason = capabilitiesReasonNode.GetTextView().Trim().ToString();
     }
     XmlNode resourceTypesNode = resultNode.FirstChild("ResourceTypes");
     if(!resourceTypesNode.IsNull())
@@ -85,7 +85,7 @@ GetTemplateSummaryResult& GetTemplateSummaryResult::operator =(const AmazonWebSe
       XmlNode resourceTypesMember = resourceTypesNode.FirstChild("member");
       while(!resourceTypesMember.IsNull())
       {
-        m_resourceTypes.push_back(StringUtils::Trim(resourceTypesMember.GetText().c_str()));
+        m_resourceTypes.push_back(resourceTypesMember.GetTextView().Trim().ToString());
         resourceTypesMember = resourceTypesMember.NextNode("member");
       }
 
@@ -93,12 +93,12 @@ GetTemplateSummaryResult& GetTemplateSummaryResult::operator =(const AmazonWebSe
     XmlNode versionNode = resultNode.FirstChild("Version");
     if(!versionNode.IsNull())
     {
-      m_version = StringUtils::Trim(versionNode.GetText().c_str());
+      m_version = versionNode.GetTextView().Trim().ToString();
     }
     XmlNode metadataNode = resultNode.FirstChild("Metadata");
     if(!metadataNode.IsNull())
     {
-      m_metadata = StringUtils::Trim(metadataNode.GetText().c_str());
+      m_metadata = metadataNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ ListChangeSetsResult& ListChangeSetsResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListChangeSetsResult")
+  if (rootNode.GetNameView() != "ListChangeSetsResult")
   {
     resultNode = rootNode.FirstChild("ListChangeSetsResult");
   }
@@ -61,7 +61,7 @@ ListChangeSetsResult& ListChangeSetsResult::operator =(const AmazonWebServiceRes
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ ListStackResourcesResult& ListStackResourcesResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListStackResourcesResult")
+  if (rootNode.GetNameView() != "ListStackResourcesResult")
   {
     resultNode = rootNode.FirstChild("ListStackResourcesResult");
   }
@@ -61,7 +61,7 @@ ListStackResourcesResult& ListStackResourcesResult::operator =(const AmazonWebSe
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/cloudformation/model/ListStacksRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudFormation::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ ListStacksRequest::ListStacksRequest() :
 
 Aws::String ListStacksRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListStacks&";
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_stackStatusFilterHasBeenSet)
@@ -40,12 +41,12 @@ Aws::String ListStacksRequest::SerializePayload() const
     for(auto& item : m_stackStatusFilter)
     {
       ss << "StackStatusFilter.member." << stackStatusFilterCount << "="
-          << StringUtils::URLEncode(StackStatusMapper::GetNameForStackStatus(item).c_str()) << "&";
+          << StringUtils::URLEncoded(StackStatusMapper::GetNameForStackStatus(item)) << "&";
       stackStatusFilterCount++;
     }
   }
 
   ss << "Version=2010-05-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ListStacksResult& ListStacksResult::operator =(const AmazonWebServiceResult<XmlD
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListStacksResult")
+  if (rootNode.GetNameView() != "ListStacksResult")
   {
     resultNode = rootNode.FirstChild("ListStacksResult");
   }
@@ -61,7 +61,7 @@ ListStacksResult& ListStacksResult::operator =(const AmazonWebServiceResult<XmlD
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -29,26 +29,32 @@ namespace Aws
       namespace OnFailureMapper
       {
 
-        static const int DO_NOTHING_HASH = HashingUtils::HashString("DO_NOTHING");
-        static const int ROLLBACK_HASH = HashingUtils::HashString("ROLLBACK");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int DO_NOTHING_HASH = -622434311;
+        static const int ROLLBACK_HASH = 522907364;
+        static const int DELETE__HASH = 2012838315;
 
 
         OnFailure GetOnFailureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DO_NOTHING_HASH)
+          switch (hashCode)
           {
+          case DO_NOTHING_HASH:
             return OnFailure::DO_NOTHING;
-          }
-          else if (hashCode == ROLLBACK_HASH)
-          {
+          case ROLLBACK_HASH:
             return OnFailure::ROLLBACK;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
+          case DELETE__HASH:
             return OnFailure::DELETE_;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -53,19 +53,19 @@ Output& Output::operator =(const XmlNode& xmlNode)
     XmlNode outputKeyNode = resultNode.FirstChild("OutputKey");
     if(!outputKeyNode.IsNull())
     {
-      m_outputKey = StringUtils::Trim(outputKeyNode.GetText().c_str());
+      m_outputKey = outputKeyNode.GetTextView().Trim().ToString();
       m_outputKeyHasBeenSet = true;
     }
     XmlNode outputValueNode = resultNode.FirstChild("OutputValue");
     if(!outputValueNode.IsNull())
     {
-      m_outputValue = StringUtils::Trim(outputValueNode.GetText().c_str());
+      m_outputValue = outputValueNode.GetTextView().Trim().ToString();
       m_outputValueHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void Output::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
 {
   if(m_outputKeyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OutputKey=" << StringUtils::URLEncode(m_outputKey.c_str()) << "&";
+      oStream << location << index << locationValue << ".OutputKey=" << StringUtils::URLEncoded(m_outputKey) << "&";
   }
 
   if(m_outputValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OutputValue=" << StringUtils::URLEncode(m_outputValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".OutputValue=" << StringUtils::URLEncoded(m_outputValue) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void Output::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_outputKeyHasBeenSet)
   {
-      oStream << location << ".OutputKey=" << StringUtils::URLEncode(m_outputKey.c_str()) << "&";
+      oStream << location << ".OutputKey=" << StringUtils::URLEncoded(m_outputKey) << "&";
   }
   if(m_outputValueHasBeenSet)
   {
-      oStream << location << ".OutputValue=" << StringUtils::URLEncode(m_outputValue.c_str()) << "&";
+      oStream << location << ".OutputValue=" << StringUtils::URLEncoded(m_outputValue) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 }
 
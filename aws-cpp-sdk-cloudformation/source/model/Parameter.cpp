@@ -55,19 +55,19 @@ Parameter& Parameter::operator =(const XmlNode& xmlNode)
     XmlNode parameterKeyNode = resultNode.FirstChild("ParameterKey");
     if(!parameterKeyNode.IsNull())
     {
-      m_parameterKey = StringUtils::Trim(parameterKeyNode.GetText().c_str());
+      m_parameterKey = parameterKeyNode.GetTextView().Trim().ToString();
       m_parameterKeyHasBeenSet = true;
     }
     XmlNode parameterValueNode = resultNode.FirstChild("ParameterValue");
     if(!parameterValueNode.IsNull())
     {
-      m_parameterValue = StringUtils::Trim(parameterValueNode.GetText().c_str());
+      m_parameterValue = parameterValueNode.GetTextView().Trim().ToString();
       m_parameterValueHasBeenSet = true;
     }
     XmlNode usePreviousValueNode = resultNode.FirstChild("UsePreviousValue");
     if(!usePreviousValueNode.IsNull())
     {
-      m_usePreviousValue = StringUtils::ConvertToBool(StringUtils::Trim(usePreviousValueNode.GetText().c_str()).c_str());
+      m_usePreviousValue = StringUtils::ConvertToBool(usePreviousValueNode.GetTextView().Trim().ToString().c_str());
       m_usePreviousValueHasBeenSet = true;
     }
   }
@@ -79,12 +79,12 @@ void Parameter::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 {
   if(m_parameterKeyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterKey=" << StringUtils::URLEncode(m_parameterKey.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterKey=" << StringUtils::URLEncoded(m_parameterKey) << "&";
   }
 
   if(m_parameterValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterValue=" << StringUtils::URLEncode(m_parameterValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterValue=" << StringUtils::URLEncoded(m_parameterValue) << "&";
   }
 
   if(m_usePreviousValueHasBeenSet)
@@ -98,11 +98,11 @@ void Parameter::OutputToStream(Aws::OStream& oStream, const char* location) cons
 {
   if(m_parameterKeyHasBeenSet)
   {
-      oStream << location << ".ParameterKey=" << StringUtils::URLEncode(m_parameterKey.c_str()) << "&";
+      oStream << location << ".ParameterKey=" << StringUtils::URLEncoded(m_parameterKey) << "&";
   }
   if(m_parameterValueHasBeenSet)
   {
-      oStream << location << ".ParameterValue=" << StringUtils::URLEncode(m_parameterValue.c_str()) << "&";
+      oStream << location << ".ParameterValue=" << StringUtils::URLEncoded(m_parameterValue) << "&";
   }
   if(m_usePreviousValueHasBeenSet)
   {
@@ -52,7 +52,7 @@ ParameterConstraints& ParameterConstraints::operator =(const XmlNode& xmlNode)
       XmlNode allowedValuesMember = allowedValuesNode.FirstChild("member");
       while(!allowedValuesMember.IsNull())
       {
-        m_allowedValues.push_back(StringUtils::Trim(allowedValuesMember.GetText().c_str()));
+        m_allowedValues.push_back(allowedValuesMember.GetTextView().Trim().ToString());
         allowedValuesMember = allowedValuesMember.NextNode("member");
       }
 
@@ -70,7 +70,7 @@ void ParameterConstraints::OutputToStream(Aws::OStream& oStream, const char* loc
       unsigned allowedValuesIdx = 1;
       for(auto& item : m_allowedValues)
       {
-        oStream << location << index << locationValue << ".AllowedValues.member." << allowedValuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".AllowedValues.member." << allowedValuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -83,7 +83,7 @@ void ParameterConstraints::OutputToStream(Aws::OStream& oStream, const char* loc
       unsigned allowedValuesIdx = 1;
       for(auto& item : m_allowedValues)
       {
-        oStream << location << ".AllowedValues.member." << allowedValuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".AllowedValues.member." << allowedValuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
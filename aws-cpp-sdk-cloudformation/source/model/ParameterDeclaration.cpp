@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,31 +62,31 @@ ParameterDeclaration& ParameterDeclaration::operator =(const XmlNode& xmlNode)
     XmlNode parameterKeyNode = resultNode.FirstChild("ParameterKey");
     if(!parameterKeyNode.IsNull())
     {
-      m_parameterKey = StringUtils::Trim(parameterKeyNode.GetText().c_str());
+      m_parameterKey = parameterKeyNode.GetTextView().Trim().ToString();
       m_parameterKeyHasBeenSet = true;
     }
     XmlNode defaultValueNode = resultNode.FirstChild("DefaultValue");
     if(!defaultValueNode.IsNull())
     {
-      m_defaultValue = StringUtils::Trim(defaultValueNode.GetText().c_str());
+      m_defaultValue = defaultValueNode.GetTextView().Trim().ToString();
       m_defaultValueHasBeenSet = true;
     }
     XmlNode parameterTypeNode = resultNode.FirstChild("ParameterType");
     if(!parameterTypeNode.IsNull())
     {
-      m_parameterType = StringUtils::Trim(parameterTypeNode.GetText().c_str());
+      m_parameterType = parameterTypeNode.GetTextView().Trim().ToString();
       m_parameterTypeHasBeenSet = true;
     }
     XmlNode noEchoNode = resultNode.FirstChild("NoEcho");
     if(!noEchoNode.IsNull())
     {
-      m_noEcho = StringUtils::ConvertToBool(StringUtils::Trim(noEchoNode.GetText().c_str()).c_str());
+      m_noEcho = StringUtils::ConvertToBool(noEchoNode.GetTextView().Trim().ToString().c_str());
       m_noEchoHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode parameterConstraintsNode = resultNode.FirstChild("ParameterConstraints");
@@ -103,17 +104,17 @@ void ParameterDeclaration::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_parameterKeyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterKey=" << StringUtils::URLEncode(m_parameterKey.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterKey=" << StringUtils::URLEncoded(m_parameterKey) << "&";
   }
 
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
 
   if(m_parameterTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterType=" << StringUtils::URLEncode(m_parameterType.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterType=" << StringUtils::URLEncoded(m_parameterType) << "&";
   }
 
   if(m_noEchoHasBeenSet)
@@ -123,14 +124,14 @@ void ParameterDeclaration::OutputToStream(Aws::OStream& oStream, const char* loc
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_parameterConstraintsHasBeenSet)
   {
-      Aws::StringStream parameterConstraintsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream parameterConstraintsLocationAndMemberSs;
       parameterConstraintsLocationAndMemberSs << location << index << locationValue << ".ParameterConstraints";
-      m_parameterConstraints.OutputToStream(oStream, parameterConstraintsLocationAndMemberSs.str().c_str());
+      m_parameterConstraints.OutputToStream(oStream, parameterConstraintsLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -139,15 +140,15 @@ void ParameterDeclaration::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_parameterKeyHasBeenSet)
   {
-      oStream << location << ".ParameterKey=" << StringUtils::URLEncode(m_parameterKey.c_str()) << "&";
+      oStream << location << ".ParameterKey=" << StringUtils::URLEncoded(m_parameterKey) << "&";
   }
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
   if(m_parameterTypeHasBeenSet)
   {
-      oStream << location << ".ParameterType=" << StringUtils::URLEncode(m_parameterType.c_str()) << "&";
+      oStream << location << ".ParameterType=" << StringUtils::URLEncoded(m_parameterType) << "&";
   }
   if(m_noEchoHasBeenSet)
   {
@@ -155,7 +156,7 @@ void ParameterDeclaration::OutputToStream(Aws::OStream& oStream, const char* loc
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_parameterConstraintsHasBeenSet)
   {
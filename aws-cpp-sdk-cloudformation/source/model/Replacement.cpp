@@ -29,26 +29,32 @@ namespace Aws
       namespace ReplacementMapper
       {
 
-        static const int True_HASH = HashingUtils::HashString("True");
-        static const int False_HASH = HashingUtils::HashString("False");
-        static const int Conditional_HASH = HashingUtils::HashString("Conditional");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int True_HASH = 2615726;
+        static const int False_HASH = 67643651;
+        static const int Conditional_HASH = -1418967450;
 
 
         Replacement GetReplacementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == True_HASH)
+          switch (hashCode)
           {
+          case True_HASH:
             return Replacement::True;
-          }
-          else if (hashCode == False_HASH)
-          {
+          case False_HASH:
             return Replacement::False;
-          }
-          else if (hashCode == Conditional_HASH)
-          {
+          case Conditional_HASH:
             return Replacement::Conditional;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace RequiresRecreationMapper
       {
 
-        static const int Never_HASH = HashingUtils::HashString("Never");
-        static const int Conditionally_HASH = HashingUtils::HashString("Conditionally");
-        static const int Always_HASH = HashingUtils::HashString("Always");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Never_HASH = 75160172;
+        static const int Conditionally_HASH = -2123083149;
+        static const int Always_HASH = 1964277295;
 
 
         RequiresRecreation GetRequiresRecreationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Never_HASH)
+          switch (hashCode)
           {
+          case Never_HASH:
             return RequiresRecreation::Never;
-          }
-          else if (hashCode == Conditionally_HASH)
-          {
+          case Conditionally_HASH:
             return RequiresRecreation::Conditionally;
-          }
-          else if (hashCode == Always_HASH)
-          {
+          case Always_HASH:
             return RequiresRecreation::Always;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
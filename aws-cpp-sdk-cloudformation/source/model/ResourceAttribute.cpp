@@ -29,41 +29,41 @@ namespace Aws
       namespace ResourceAttributeMapper
       {
 
-        static const int Properties_HASH = HashingUtils::HashString("Properties");
-        static const int Metadata_HASH = HashingUtils::HashString("Metadata");
-        static const int CreationPolicy_HASH = HashingUtils::HashString("CreationPolicy");
-        static const int UpdatePolicy_HASH = HashingUtils::HashString("UpdatePolicy");
-        static const int DeletionPolicy_HASH = HashingUtils::HashString("DeletionPolicy");
-        static const int Tags_HASH = HashingUtils::HashString("Tags");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Properties_HASH = 1067411795;
+        static const int Metadata_HASH = -385360049;
+        static const int CreationPolicy_HASH = -1663178479;
+        static const int UpdatePolicy_HASH = -866606213;
+        static const int DeletionPolicy_HASH = -343757120;
+        static const int Tags_HASH = 2598969;
 
 
         ResourceAttribute GetResourceAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Properties_HASH)
+          switch (hashCode)
           {
+          case Properties_HASH:
             return ResourceAttribute::Properties;
-          }
-          else if (hashCode == Metadata_HASH)
-          {
+          case Metadata_HASH:
             return ResourceAttribute::Metadata;
-          }
-          else if (hashCode == CreationPolicy_HASH)
-          {
+          case CreationPolicy_HASH:
             return ResourceAttribute::CreationPolicy;
-          }
-          else if (hashCode == UpdatePolicy_HASH)
-          {
+          case UpdatePolicy_HASH:
             return ResourceAttribute::UpdatePolicy;
-          }
-          else if (hashCode == DeletionPolicy_HASH)
-          {
+          case DeletionPolicy_HASH:
             return ResourceAttribute::DeletionPolicy;
-          }
-          else if (hashCode == Tags_HASH)
-          {
+          case Tags_HASH:
             return ResourceAttribute::Tags;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,31 +62,31 @@ ResourceChange& ResourceChange::operator =(const XmlNode& xmlNode)
     XmlNode actionNode = resultNode.FirstChild("Action");
     if(!actionNode.IsNull())
     {
-      m_action = ChangeActionMapper::GetChangeActionForName(StringUtils::Trim(actionNode.GetText().c_str()).c_str());
+      m_action = ChangeActionMapper::GetChangeActionForName(actionNode.GetTextView().Trim().ToString().c_str());
       m_actionHasBeenSet = true;
     }
     XmlNode logicalResourceIdNode = resultNode.FirstChild("LogicalResourceId");
     if(!logicalResourceIdNode.IsNull())
     {
-      m_logicalResourceId = StringUtils::Trim(logicalResourceIdNode.GetText().c_str());
+      m_logicalResourceId = logicalResourceIdNode.GetTextView().Trim().ToString();
       m_logicalResourceIdHasBeenSet = true;
     }
     XmlNode physicalResourceIdNode = resultNode.FirstChild("PhysicalResourceId");
     if(!physicalResourceIdNode.IsNull())
     {
-      m_physicalResourceId = StringUtils::Trim(physicalResourceIdNode.GetText().c_str());
+      m_physicalResourceId = physicalResourceIdNode.GetTextView().Trim().ToString();
       m_physicalResourceIdHasBeenSet = true;
     }
     XmlNode resourceTypeNode = resultNode.FirstChild("ResourceType");
     if(!resourceTypeNode.IsNull())
     {
-      m_resourceType = StringUtils::Trim(resourceTypeNode.GetText().c_str());
+      m_resourceType = resourceTypeNode.GetTextView().Trim().ToString();
       m_resourceTypeHasBeenSet = true;
     }
     XmlNode replacementNode = resultNode.FirstChild("Replacement");
     if(!replacementNode.IsNull())
     {
-      m_replacement = ReplacementMapper::GetReplacementForName(StringUtils::Trim(replacementNode.GetText().c_str()).c_str());
+      m_replacement = ReplacementMapper::GetReplacementForName(replacementNode.GetTextView().Trim().ToString().c_str());
       m_replacementHasBeenSet = true;
     }
     XmlNode scopeNode = resultNode.FirstChild("Scope");
@@ -94,7 +95,7 @@ ResourceChange& ResourceChange::operator =(const XmlNode& xmlNode)
       XmlNode scopeMember = scopeNode.FirstChild("member");
       while(!scopeMember.IsNull())
       {
-        m_scope.push_back(ResourceAttributeMapper::GetResourceAttributeForName(StringUtils::Trim(scopeMember.GetText().c_str())));
+        m_scope.push_back(ResourceAttributeMapper::GetResourceAttributeForName(scopeMember.GetTextView().Trim().ToString()));
         scopeMember = scopeMember.NextNode("member");
       }
 
@@ -126,17 +127,17 @@ void ResourceChange::OutputToStream(Aws::OStream& oStream, const char* location,
 
   if(m_logicalResourceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LogicalResourceId=" << StringUtils::URLEncode(m_logicalResourceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".LogicalResourceId=" << StringUtils::URLEncoded(m_logicalResourceId) << "&";
   }
 
   if(m_physicalResourceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PhysicalResourceId=" << StringUtils::URLEncode(m_physicalResourceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".PhysicalResourceId=" << StringUtils::URLEncoded(m_physicalResourceId) << "&";
   }
 
   if(m_resourceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceType=" << StringUtils::URLEncode(m_resourceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceType=" << StringUtils::URLEncoded(m_resourceType) << "&";
   }
 
   if(m_replacementHasBeenSet)
@@ -158,9 +159,9 @@ void ResourceChange::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned detailsIdx = 1;
       for(auto& item : m_details)
       {
-        Aws::StringStream detailsSs;
+        Aws::Utils::Stream::StringOutputStream detailsSs;
         detailsSs << location << index << locationValue << ".Details.member." << detailsIdx++;
-        item.OutputToStream(oStream, detailsSs.str().c_str());
+        item.OutputToStream(oStream, detailsSs.GetString().c_str());
       }
   }
 
@@ -174,15 +175,15 @@ void ResourceChange::OutputToStream(Aws::OStream& oStream, const char* location)
   }
   if(m_logicalResourceIdHasBeenSet)
   {
-      oStream << location << ".LogicalResourceId=" << StringUtils::URLEncode(m_logicalResourceId.c_str()) << "&";
+      oStream << location << ".LogicalResourceId=" << StringUtils::URLEncoded(m_logicalResourceId) << "&";
   }
   if(m_physicalResourceIdHasBeenSet)
   {
-      oStream << location << ".PhysicalResourceId=" << StringUtils::URLEncode(m_physicalResourceId.c_str()) << "&";
+      oStream << location << ".PhysicalResourceId=" << StringUtils::URLEncoded(m_physicalResourceId) << "&";
   }
   if(m_resourceTypeHasBeenSet)
   {
-      oStream << location << ".ResourceType=" << StringUtils::URLEncode(m_resourceType.c_str()) << "&";
+      oStream << location << ".ResourceType=" << StringUtils::URLEncoded(m_resourceType) << "&";
   }
   if(m_replacementHasBeenSet)
   {
@@ -201,9 +202,9 @@ void ResourceChange::OutputToStream(Aws::OStream& oStream, const char* location)
       unsigned detailsIdx = 1;
       for(auto& item : m_details)
       {
-        Aws::StringStream detailsSs;
+        Aws::Utils::Stream::StringOutputStream detailsSs;
         detailsSs << location <<  ".Details.member." << detailsIdx++;
-        item.OutputToStream(oStream, detailsSs.str().c_str());
+        item.OutputToStream(oStream, detailsSs.GetString().c_str());
       }
   }
 }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,19 +62,19 @@ ResourceChangeDetail& ResourceChangeDetail::operator =(const XmlNode& xmlNode)
     XmlNode evaluationNode = resultNode.FirstChild("Evaluation");
     if(!evaluationNode.IsNull())
     {
-      m_evaluation = EvaluationTypeMapper::GetEvaluationTypeForName(StringUtils::Trim(evaluationNode.GetText().c_str()).c_str());
+      m_evaluation = EvaluationTypeMapper::GetEvaluationTypeForName(evaluationNode.GetTextView().Trim().ToString().c_str());
       m_evaluationHasBeenSet = true;
     }
     XmlNode changeSourceNode = resultNode.FirstChild("ChangeSource");
     if(!changeSourceNode.IsNull())
     {
-      m_changeSource = ChangeSourceMapper::GetChangeSourceForName(StringUtils::Trim(changeSourceNode.GetText().c_str()).c_str());
+      m_changeSource = ChangeSourceMapper::GetChangeSourceForName(changeSourceNode.GetTextView().Trim().ToString().c_str());
       m_changeSourceHasBeenSet = true;
     }
     XmlNode causingEntityNode = resultNode.FirstChild("CausingEntity");
     if(!causingEntityNode.IsNull())
     {
-      m_causingEntity = StringUtils::Trim(causingEntityNode.GetText().c_str());
+      m_causingEntity = causingEntityNode.GetTextView().Trim().ToString();
       m_causingEntityHasBeenSet = true;
     }
   }
@@ -85,9 +86,9 @@ void ResourceChangeDetail::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_targetHasBeenSet)
   {
-      Aws::StringStream targetLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream targetLocationAndMemberSs;
       targetLocationAndMemberSs << location << index << locationValue << ".Target";
-      m_target.OutputToStream(oStream, targetLocationAndMemberSs.str().c_str());
+      m_target.OutputToStream(oStream, targetLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_evaluationHasBeenSet)
@@ -102,7 +103,7 @@ void ResourceChangeDetail::OutputToStream(Aws::OStream& oStream, const char* loc
 
   if(m_causingEntityHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CausingEntity=" << StringUtils::URLEncode(m_causingEntity.c_str()) << "&";
+      oStream << location << index << locationValue << ".CausingEntity=" << StringUtils::URLEncoded(m_causingEntity) << "&";
   }
 
 }
@@ -125,7 +126,7 @@ void ResourceChangeDetail::OutputToStream(Aws::OStream& oStream, const char* loc
   }
   if(m_causingEntityHasBeenSet)
   {
-      oStream << location << ".CausingEntity=" << StringUtils::URLEncode(m_causingEntity.c_str()) << "&";
+      oStream << location << ".CausingEntity=" << StringUtils::URLEncoded(m_causingEntity) << "&";
   }
 }
 
@@ -29,21 +29,29 @@ namespace Aws
       namespace ResourceSignalStatusMapper
       {
 
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILURE_HASH = HashingUtils::HashString("FAILURE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int SUCCESS_HASH = -1149187101;
+        static const int FAILURE_HASH = -368591510;
 
 
         ResourceSignalStatus GetResourceSignalStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCESS_HASH)
+          switch (hashCode)
           {
+          case SUCCESS_HASH:
             return ResourceSignalStatus::SUCCESS;
-          }
-          else if (hashCode == FAILURE_HASH)
-          {
+          case FAILURE_HASH:
             return ResourceSignalStatus::FAILURE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,61 +29,53 @@ namespace Aws
       namespace ResourceStatusMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int CREATE_FAILED_HASH = HashingUtils::HashString("CREATE_FAILED");
-        static const int CREATE_COMPLETE_HASH = HashingUtils::HashString("CREATE_COMPLETE");
-        static const int DELETE_IN_PROGRESS_HASH = HashingUtils::HashString("DELETE_IN_PROGRESS");
-        static const int DELETE_FAILED_HASH = HashingUtils::HashString("DELETE_FAILED");
-        static const int DELETE_COMPLETE_HASH = HashingUtils::HashString("DELETE_COMPLETE");
-        static const int DELETE_SKIPPED_HASH = HashingUtils::HashString("DELETE_SKIPPED");
-        static const int UPDATE_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_IN_PROGRESS");
-        static const int UPDATE_FAILED_HASH = HashingUtils::HashString("UPDATE_FAILED");
-        static const int UPDATE_COMPLETE_HASH = HashingUtils::HashString("UPDATE_COMPLETE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CREATE_IN_PROGRESS_HASH = 43560260;
+        static const int CREATE_FAILED_HASH = -835019552;
+        static const int CREATE_COMPLETE_HASH = -569796324;
+        static const int DELETE_IN_PROGRESS_HASH = 1089799027;
+        static const int DELETE_FAILED_HASH = 1008657745;
+        static const int DELETE_COMPLETE_HASH = 1677560141;
+        static const int DELETE_SKIPPED_HASH = 142686332;
+        static const int UPDATE_IN_PROGRESS_HASH = 1375009169;
+        static const int UPDATE_FAILED_HASH = -282520461;
+        static const int UPDATE_COMPLETE_HASH = 2100852719;
 
 
         ResourceStatus GetResourceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
+          switch (hashCode)
           {
+          case CREATE_IN_PROGRESS_HASH:
             return ResourceStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == CREATE_FAILED_HASH)
-          {
+          case CREATE_FAILED_HASH:
             return ResourceStatus::CREATE_FAILED;
-          }
-          else if (hashCode == CREATE_COMPLETE_HASH)
-          {
+          case CREATE_COMPLETE_HASH:
             return ResourceStatus::CREATE_COMPLETE;
-          }
-          else if (hashCode == DELETE_IN_PROGRESS_HASH)
-          {
+          case DELETE_IN_PROGRESS_HASH:
             return ResourceStatus::DELETE_IN_PROGRESS;
-          }
-          else if (hashCode == DELETE_FAILED_HASH)
-          {
+          case DELETE_FAILED_HASH:
             return ResourceStatus::DELETE_FAILED;
-          }
-          else if (hashCode == DELETE_COMPLETE_HASH)
-          {
+          case DELETE_COMPLETE_HASH:
             return ResourceStatus::DELETE_COMPLETE;
-          }
-          else if (hashCode == DELETE_SKIPPED_HASH)
-          {
+          case DELETE_SKIPPED_HASH:
             return ResourceStatus::DELETE_SKIPPED;
-          }
-          else if (hashCode == UPDATE_IN_PROGRESS_HASH)
-          {
+          case UPDATE_IN_PROGRESS_HASH:
             return ResourceStatus::UPDATE_IN_PROGRESS;
-          }
-          else if (hashCode == UPDATE_FAILED_HASH)
-          {
+          case UPDATE_FAILED_HASH:
             return ResourceStatus::UPDATE_FAILED;
-          }
-          else if (hashCode == UPDATE_COMPLETE_HASH)
-          {
+          case UPDATE_COMPLETE_HASH:
             return ResourceStatus::UPDATE_COMPLETE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
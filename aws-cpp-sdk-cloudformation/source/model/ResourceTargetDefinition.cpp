@@ -53,19 +53,19 @@ ResourceTargetDefinition& ResourceTargetDefinition::operator =(const XmlNode& xm
     XmlNode attributeNode = resultNode.FirstChild("Attribute");
     if(!attributeNode.IsNull())
     {
-      m_attribute = ResourceAttributeMapper::GetResourceAttributeForName(StringUtils::Trim(attributeNode.GetText().c_str()).c_str());
+      m_attribute = ResourceAttributeMapper::GetResourceAttributeForName(attributeNode.GetTextView().Trim().ToString().c_str());
       m_attributeHasBeenSet = true;
     }
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode requiresRecreationNode = resultNode.FirstChild("RequiresRecreation");
     if(!requiresRecreationNode.IsNull())
     {
-      m_requiresRecreation = RequiresRecreationMapper::GetRequiresRecreationForName(StringUtils::Trim(requiresRecreationNode.GetText().c_str()).c_str());
+      m_requiresRecreation = RequiresRecreationMapper::GetRequiresRecreationForName(requiresRecreationNode.GetTextView().Trim().ToString().c_str());
       m_requiresRecreationHasBeenSet = true;
     }
   }
@@ -82,7 +82,7 @@ void ResourceTargetDefinition::OutputToStream(Aws::OStream& oStream, const char*
 
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_requiresRecreationHasBeenSet)
@@ -100,7 +100,7 @@ void ResourceTargetDefinition::OutputToStream(Aws::OStream& oStream, const char*
   }
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_requiresRecreationHasBeenSet)
   {
@@ -15,6 +15,7 @@
 #include <aws/cloudformation/model/SetStackPolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudFormation::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ SetStackPolicyRequest::SetStackPolicyRequest() :
 
 Aws::String SetStackPolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SetStackPolicy&";
   if(m_stackNameHasBeenSet)
   {
-    ss << "StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+    ss << "StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
 
   if(m_stackPolicyBodyHasBeenSet)
   {
-    ss << "StackPolicyBody=" << StringUtils::URLEncode(m_stackPolicyBody.c_str()) << "&";
+    ss << "StackPolicyBody=" << StringUtils::URLEncoded(m_stackPolicyBody) << "&";
   }
 
   if(m_stackPolicyURLHasBeenSet)
   {
-    ss << "StackPolicyURL=" << StringUtils::URLEncode(m_stackPolicyURL.c_str()) << "&";
+    ss << "StackPolicyURL=" << StringUtils::URLEncoded(m_stackPolicyURL) << "&";
   }
 
   ss << "Version=2010-05-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/cloudformation/model/SignalResourceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudFormation::Model;
 using namespace Aws::Utils;
@@ -29,21 +30,21 @@ SignalResourceRequest::SignalResourceRequest() :
 
 Aws::String SignalResourceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SignalResource&";
   if(m_stackNameHasBeenSet)
   {
-    ss << "StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+    ss << "StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
 
   if(m_logicalResourceIdHasBeenSet)
   {
-    ss << "LogicalResourceId=" << StringUtils::URLEncode(m_logicalResourceId.c_str()) << "&";
+    ss << "LogicalResourceId=" << StringUtils::URLEncoded(m_logicalResourceId) << "&";
   }
 
   if(m_uniqueIdHasBeenSet)
   {
-    ss << "UniqueId=" << StringUtils::URLEncode(m_uniqueId.c_str()) << "&";
+    ss << "UniqueId=" << StringUtils::URLEncoded(m_uniqueId) << "&";
   }
 
   if(m_statusHasBeenSet)
@@ -52,6 +53,6 @@ Aws::String SignalResourceRequest::SerializePayload() const
   }
 
   ss << "Version=2010-05-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
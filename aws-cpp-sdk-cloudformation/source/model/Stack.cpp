@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -79,19 +80,19 @@ Stack& Stack::operator =(const XmlNode& xmlNode)
     XmlNode stackIdNode = resultNode.FirstChild("StackId");
     if(!stackIdNode.IsNull())
     {
-      m_stackId = StringUtils::Trim(stackIdNode.GetText().c_str());
+      m_stackId = stackIdNode.GetTextView().Trim().ToString();
       m_stackIdHasBeenSet = true;
     }
     XmlNode stackNameNode = resultNode.FirstChild("StackName");
     if(!stackNameNode.IsNull())
     {
-      m_stackName = StringUtils::Trim(stackNameNode.GetText().c_str());
+      m_stackName = stackNameNode.GetTextView().Trim().ToString();
       m_stackNameHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode parametersNode = resultNode.FirstChild("Parameters");
@@ -109,31 +110,31 @@ Stack& Stack::operator =(const XmlNode& xmlNode)
     XmlNode creationTimeNode = resultNode.FirstChild("CreationTime");
     if(!creationTimeNode.IsNull())
     {
-      m_creationTime = DateTime(StringUtils::Trim(creationTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_creationTime = DateTime(creationTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_creationTimeHasBeenSet = true;
     }
     XmlNode lastUpdatedTimeNode = resultNode.FirstChild("LastUpdatedTime");
     if(!lastUpdatedTimeNode.IsNull())
     {
-      m_lastUpdatedTime = DateTime(StringUtils::Trim(lastUpdatedTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_lastUpdatedTime = DateTime(lastUpdatedTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_lastUpdatedTimeHasBeenSet = true;
     }
     XmlNode stackStatusNode = resultNode.FirstChild("StackStatus");
     if(!stackStatusNode.IsNull())
     {
-      m_stackStatus = StackStatusMapper::GetStackStatusForName(StringUtils::Trim(stackStatusNode.GetText().c_str()).c_str());
+      m_stackStatus = StackStatusMapper::GetStackStatusForName(stackStatusNode.GetTextView().Trim().ToString().c_str());
       m_stackStatusHasBeenSet = true;
     }
     XmlNode stackStatusReasonNode = resultNode.FirstChild("StackStatusReason");
     if(!stackStatusReasonNode.IsNull())
     {
-      m_stackStatusReason = StringUtils::Trim(stackStatusReasonNode.GetText().c_str());
+      m_stackStatusReason = stackStatusReasonNode.GetTextView().Trim().ToString();
       m_stackStatusReasonHasBeenSet = true;
     }
     XmlNode disableRollbackNode = resultNode.FirstChild("DisableRollback");
     if(!disableRollbackNode.IsNull())
     {
-      m_disableRollback = StringUtils::ConvertToBool(StringUtils::Trim(disableRollbackNode.GetText().c_str()).c_str());
+      m_disableRollback = StringUtils::ConvertToBool(disableRollbackNode.GetTextView().Trim().ToString().c_str());
       m_disableRollbackHasBeenSet = true;
     }
     XmlNode notificationARNsNode = resultNode.FirstChild("NotificationARNs");
@@ -142,7 +143,7 @@ Stack& Stack::operator =(const XmlNode& xmlNode)
       XmlNode notificationARNsMember = notificationARNsNode.FirstChild("member");
       while(!notificationARNsMember.IsNull())
       {
-        m_notificationARNs.push_back(StringUtils::Trim(notificationARNsMember.GetText().c_str()));
+        m_notificationARNs.push_back(notificationARNsMember.GetTextView().Trim().ToString());
         notificationARNsMember = notificationARNsMember.NextNode("member");
       }
 
@@ -151,7 +152,7 @@ Stack& Stack::operator =(const XmlNode& xmlNode)
     XmlNode timeoutInMinutesNode = resultNode.FirstChild("TimeoutInMinutes");
     if(!timeoutInMinutesNode.IsNull())
     {
-      m_timeoutInMinutes = StringUtils::ConvertToInt32(StringUtils::Trim(timeoutInMinutesNode.GetText().c_str()).c_str());
+      m_timeoutInMinutes = StringUtils::ConvertToInt32(timeoutInMinutesNode.GetTextView().Trim().ToString().c_str());
       m_timeoutInMinutesHasBeenSet = true;
     }
     XmlNode capabilitiesNode = resultNode.FirstChild("Capabilities");
@@ -160,7 +161,7 @@ Stack& Stack::operator =(const XmlNode& xmlNode)
       XmlNode capabilitiesMember = capabilitiesNode.FirstChild("member");
       while(!capabilitiesMember.IsNull())
       {
-        m_capabilities.push_back(CapabilityMapper::GetCapabilityForName(StringUtils::Trim(capabilitiesMember.GetText().c_str())));
+        m_capabilities.push_back(CapabilityMapper::GetCapabilityForName(capabilitiesMember.GetTextView().Trim().ToString()));
         capabilitiesMember = capabilitiesMember.NextNode("member");
       }
 
@@ -199,17 +200,17 @@ void Stack::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 {
   if(m_stackIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StackId=" << StringUtils::URLEncode(m_stackId.c_str()) << "&";
+      oStream << location << index << locationValue << ".StackId=" << StringUtils::URLEncoded(m_stackId) << "&";
   }
 
   if(m_stackNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+      oStream << location << index << locationValue << ".StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_parametersHasBeenSet)
@@ -217,20 +218,20 @@ void Stack::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
       unsigned parametersIdx = 1;
       for(auto& item : m_parameters)
       {
-        Aws::StringStream parametersSs;
+        Aws::Utils::Stream::StringOutputStream parametersSs;
         parametersSs << location << index << locationValue << ".Parameters.member." << parametersIdx++;
-        item.OutputToStream(oStream, parametersSs.str().c_str());
+        item.OutputToStream(oStream, parametersSs.GetString().c_str());
       }
   }
 
   if(m_creationTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreationTime=" << StringUtils::URLEncode(m_creationTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreationTime=" << StringUtils::URLEncoded(m_creationTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_lastUpdatedTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LastUpdatedTime=" << StringUtils::URLEncode(m_lastUpdatedTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".LastUpdatedTime=" << StringUtils::URLEncoded(m_lastUpdatedTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_stackStatusHasBeenSet)
@@ -240,7 +241,7 @@ void Stack::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 
   if(m_stackStatusReasonHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StackStatusReason=" << StringUtils::URLEncode(m_stackStatusReason.c_str()) << "&";
+      oStream << location << index << locationValue << ".StackStatusReason=" << StringUtils::URLEncoded(m_stackStatusReason) << "&";
   }
 
   if(m_disableRollbackHasBeenSet)
@@ -253,7 +254,7 @@ void Stack::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
       unsigned notificationARNsIdx = 1;
       for(auto& item : m_notificationARNs)
       {
-        oStream << location << index << locationValue << ".NotificationARNs.member." << notificationARNsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".NotificationARNs.member." << notificationARNsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -276,9 +277,9 @@ void Stack::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
       unsigned outputsIdx = 1;
       for(auto& item : m_outputs)
       {
-        Aws::StringStream outputsSs;
+        Aws::Utils::Stream::StringOutputStream outputsSs;
         outputsSs << location << index << locationValue << ".Outputs.member." << outputsIdx++;
-        item.OutputToStream(oStream, outputsSs.str().c_str());
+        item.OutputToStream(oStream, outputsSs.GetString().c_str());
       }
   }
 
@@ -287,9 +288,9 @@ void Stack::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".Tags.member." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -299,33 +300,33 @@ void Stack::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_stackIdHasBeenSet)
   {
-      oStream << location << ".StackId=" << StringUtils::URLEncode(m_stackId.c_str()) << "&";
+      oStream << location << ".StackId=" << StringUtils::URLEncoded(m_stackId) << "&";
   }
   if(m_stackNameHasBeenSet)
   {
-      oStream << location << ".StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+      oStream << location << ".StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_parametersHasBeenSet)
   {
       unsigned parametersIdx = 1;
       for(auto& item : m_parameters)
       {
-        Aws::StringStream parametersSs;
+        Aws::Utils::Stream::StringOutputStream parametersSs;
         parametersSs << location <<  ".Parameters.member." << parametersIdx++;
-        item.OutputToStream(oStream, parametersSs.str().c_str());
+        item.OutputToStream(oStream, parametersSs.GetString().c_str());
       }
   }
   if(m_creationTimeHasBeenSet)
   {
-      oStream << location << ".CreationTime=" << StringUtils::URLEncode(m_creationTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreationTime=" << StringUtils::URLEncoded(m_creationTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_lastUpdatedTimeHasBeenSet)
   {
-      oStream << location << ".LastUpdatedTime=" << StringUtils::URLEncode(m_lastUpdatedTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".LastUpdatedTime=" << StringUtils::URLEncoded(m_lastUpdatedTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_stackStatusHasBeenSet)
   {
@@ -333,7 +334,7 @@ void Stack::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_stackStatusReasonHasBeenSet)
   {
-      oStream << location << ".StackStatusReason=" << StringUtils::URLEncode(m_stackStatusReason.c_str()) << "&";
+      oStream << location << ".StackStatusReason=" << StringUtils::URLEncoded(m_stackStatusReason) << "&";
   }
   if(m_disableRollbackHasBeenSet)
   {
@@ -344,7 +345,7 @@ void Stack::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned notificationARNsIdx = 1;
       for(auto& item : m_notificationARNs)
       {
-        oStream << location << ".NotificationARNs.member." << notificationARNsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".NotificationARNs.member." << notificationARNsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_timeoutInMinutesHasBeenSet)
@@ -364,9 +365,9 @@ void Stack::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned outputsIdx = 1;
       for(auto& item : m_outputs)
       {
-        Aws::StringStream outputsSs;
+        Aws::Utils::Stream::StringOutputStream outputsSs;
         outputsSs << location <<  ".Outputs.member." << outputsIdx++;
-        item.OutputToStream(oStream, outputsSs.str().c_str());
+        item.OutputToStream(oStream, outputsSs.GetString().c_str());
       }
   }
   if(m_tagsHasBeenSet)
@@ -374,9 +375,9 @@ void Stack::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".Tags.member." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
@@ -67,61 +67,61 @@ StackEvent& StackEvent::operator =(const XmlNode& xmlNode)
     XmlNode stackIdNode = resultNode.FirstChild("StackId");
     if(!stackIdNode.IsNull())
     {
-      m_stackId = StringUtils::Trim(stackIdNode.GetText().c_str());
+      m_stackId = stackIdNode.GetTextView().Trim().ToString();
       m_stackIdHasBeenSet = true;
     }
     XmlNode eventIdNode = resultNode.FirstChild("EventId");
     if(!eventIdNode.IsNull())
     {
-      m_eventId = StringUtils::Trim(eventIdNode.GetText().c_str());
+      m_eventId = eventIdNode.GetTextView().Trim().ToString();
       m_eventIdHasBeenSet = true;
     }
     XmlNode stackNameNode = resultNode.FirstChild("StackName");
     if(!stackNameNode.IsNull())
     {
-      m_stackName = StringUtils::Trim(stackNameNode.GetText().c_str());
+      m_stackName = stackNameNode.GetTextView().Trim().ToString();
       m_stackNameHasBeenSet = true;
     }
     XmlNode logicalResourceIdNode = resultNode.FirstChild("LogicalResourceId");
     if(!logicalResourceIdNode.IsNull())
     {
-      m_logicalResourceId = StringUtils::Trim(logicalResourceIdNode.GetText().c_str());
+      m_logicalResourceId = logicalResourceIdNode.GetTextView().Trim().ToString();
       m_logicalResourceIdHasBeenSet = true;
     }
     XmlNode physicalResourceIdNode = resultNode.FirstChild("PhysicalResourceId");
     if(!physicalResourceIdNode.IsNull())
     {
-      m_physicalResourceId = StringUtils::Trim(physicalResourceIdNode.GetText().c_str());
+      m_physicalResourceId = physicalResourceIdNode.GetTextView().Trim().ToString();
       m_physicalResourceIdHasBeenSet = true;
     }
     XmlNode resourceTypeNode = resultNode.FirstChild("ResourceType");
     if(!resourceTypeNode.IsNull())
     {
-      m_resourceType = StringUtils::Trim(resourceTypeNode.GetText().c_str());
+      m_resourceType = resourceTypeNode.GetTextView().Trim().ToString();
       m_resourceTypeHasBeenSet = true;
     }
     XmlNode timestampNode = resultNode.FirstChild("Timestamp");
     if(!timestampNode.IsNull())
     {
-      m_timestamp = DateTime(StringUtils::Trim(timestampNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_timestamp = DateTime(timestampNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_timestampHasBeenSet = true;
     }
     XmlNode resourceStatusNode = resultNode.FirstChild("ResourceStatus");
     if(!resourceStatusNode.IsNull())
     {
-      m_resourceStatus = ResourceStatusMapper::GetResourceStatusForName(StringUtils::Trim(resourceStatusNode.GetText().c_str()).c_str());
+      m_resourceStatus = ResourceStatusMapper::GetResourceStatusForName(resourceStatusNode.GetTextView().Trim().ToString().c_str());
       m_resourceStatusHasBeenSet = true;
     }
     XmlNode resourceStatusReasonNode = resultNode.FirstChild("ResourceStatusReason");
     if(!resourceStatusReasonNode.IsNull())
     {
-      m_resourceStatusReason = StringUtils::Trim(resourceStatusReasonNode.GetText().c_str());
+      m_resourceStatusReason = resourceStatusReasonNode.GetTextView().Trim().ToString();
       m_resourceStatusReasonHasBeenSet = true;
     }
     XmlNode resourcePropertiesNode = resultNode.FirstChild("ResourceProperties");
     if(!resourcePropertiesNode.IsNull())
     {
-      m_resourceProperties = StringUtils::Trim(resourcePropertiesNode.GetText().c_str());
+      m_resourceProperties = resourcePropertiesNode.GetTextView().Trim().ToString();
       m_resourcePropertiesHasBeenSet = true;
     }
   }
@@ -133,37 +133,37 @@ void StackEvent::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_stackIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StackId=" << StringUtils::URLEncode(m_stackId.c_str()) << "&";
+      oStream << location << index << locationValue << ".StackId=" << StringUtils::URLEncoded(m_stackId) << "&";
   }
 
   if(m_eventIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EventId=" << StringUtils::URLEncode(m_eventId.c_str()) << "&";
+      oStream << location << index << locationValue << ".EventId=" << StringUtils::URLEncoded(m_eventId) << "&";
   }
 
   if(m_stackNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+      oStream << location << index << locationValue << ".StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
 
   if(m_logicalResourceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LogicalResourceId=" << StringUtils::URLEncode(m_logicalResourceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".LogicalResourceId=" << StringUtils::URLEncoded(m_logicalResourceId) << "&";
   }
 
   if(m_physicalResourceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PhysicalResourceId=" << StringUtils::URLEncode(m_physicalResourceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".PhysicalResourceId=" << StringUtils::URLEncoded(m_physicalResourceId) << "&";
   }
 
   if(m_resourceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceType=" << StringUtils::URLEncode(m_resourceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceType=" << StringUtils::URLEncoded(m_resourceType) << "&";
   }
 
   if(m_timestampHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Timestamp=" << StringUtils::URLEncode(m_timestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".Timestamp=" << StringUtils::URLEncoded(m_timestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_resourceStatusHasBeenSet)
@@ -173,12 +173,12 @@ void StackEvent::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_resourceStatusReasonHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceStatusReason=" << StringUtils::URLEncode(m_resourceStatusReason.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceStatusReason=" << StringUtils::URLEncoded(m_resourceStatusReason) << "&";
   }
 
   if(m_resourcePropertiesHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceProperties=" << StringUtils::URLEncode(m_resourceProperties.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceProperties=" << StringUtils::URLEncoded(m_resourceProperties) << "&";
   }
 
 }
@@ -187,31 +187,31 @@ void StackEvent::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_stackIdHasBeenSet)
   {
-      oStream << location << ".StackId=" << StringUtils::URLEncode(m_stackId.c_str()) << "&";
+      oStream << location << ".StackId=" << StringUtils::URLEncoded(m_stackId) << "&";
   }
   if(m_eventIdHasBeenSet)
   {
-      oStream << location << ".EventId=" << StringUtils::URLEncode(m_eventId.c_str()) << "&";
+      oStream << location << ".EventId=" << StringUtils::URLEncoded(m_eventId) << "&";
   }
   if(m_stackNameHasBeenSet)
   {
-      oStream << location << ".StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+      oStream << location << ".StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
   if(m_logicalResourceIdHasBeenSet)
   {
-      oStream << location << ".LogicalResourceId=" << StringUtils::URLEncode(m_logicalResourceId.c_str()) << "&";
+      oStream << location << ".LogicalResourceId=" << StringUtils::URLEncoded(m_logicalResourceId) << "&";
   }
   if(m_physicalResourceIdHasBeenSet)
   {
-      oStream << location << ".PhysicalResourceId=" << StringUtils::URLEncode(m_physicalResourceId.c_str()) << "&";
+      oStream << location << ".PhysicalResourceId=" << StringUtils::URLEncoded(m_physicalResourceId) << "&";
   }
   if(m_resourceTypeHasBeenSet)
   {
-      oStream << location << ".ResourceType=" << StringUtils::URLEncode(m_resourceType.c_str()) << "&";
+      oStream << location << ".ResourceType=" << StringUtils::URLEncoded(m_resourceType) << "&";
   }
   if(m_timestampHasBeenSet)
   {
-      oStream << location << ".Timestamp=" << StringUtils::URLEncode(m_timestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".Timestamp=" << StringUtils::URLEncoded(m_timestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_resourceStatusHasBeenSet)
   {
@@ -219,11 +219,11 @@ void StackEvent::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_resourceStatusReasonHasBeenSet)
   {
-      oStream << location << ".ResourceStatusReason=" << StringUtils::URLEncode(m_resourceStatusReason.c_str()) << "&";
+      oStream << location << ".ResourceStatusReason=" << StringUtils::URLEncoded(m_resourceStatusReason) << "&";
   }
   if(m_resourcePropertiesHasBeenSet)
   {
-      oStream << location << ".ResourceProperties=" << StringUtils::URLEncode(m_resourceProperties.c_str()) << "&";
+      oStream << location << ".ResourceProperties=" << StringUtils::URLEncoded(m_resourceProperties) << "&";
   }
 }
 
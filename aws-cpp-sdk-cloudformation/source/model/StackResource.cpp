@@ -65,55 +65,55 @@ StackResource& StackResource::operator =(const XmlNode& xmlNode)
     XmlNode stackNameNode = resultNode.FirstChild("StackName");
     if(!stackNameNode.IsNull())
     {
-      m_stackName = StringUtils::Trim(stackNameNode.GetText().c_str());
+      m_stackName = stackNameNode.GetTextView().Trim().ToString();
       m_stackNameHasBeenSet = true;
     }
     XmlNode stackIdNode = resultNode.FirstChild("StackId");
     if(!stackIdNode.IsNull())
     {
-      m_stackId = StringUtils::Trim(stackIdNode.GetText().c_str());
+      m_stackId = stackIdNode.GetTextView().Trim().ToString();
       m_stackIdHasBeenSet = true;
     }
     XmlNode logicalResourceIdNode = resultNode.FirstChild("LogicalResourceId");
     if(!logicalResourceIdNode.IsNull())
     {
-      m_logicalResourceId = StringUtils::Trim(logicalResourceIdNode.GetText().c_str());
+      m_logicalResourceId = logicalResourceIdNode.GetTextView().Trim().ToString();
       m_logicalResourceIdHasBeenSet = true;
     }
     XmlNode physicalResourceIdNode = resultNode.FirstChild("PhysicalResourceId");
     if(!physicalResourceIdNode.IsNull())
     {
-      m_physicalResourceId = StringUtils::Trim(physicalResourceIdNode.GetText().c_str());
+      m_physicalResourceId = physicalResourceIdNode.GetTextView().Trim().ToString();
       m_physicalResourceIdHasBeenSet = true;
     }
     XmlNode resourceTypeNode = resultNode.FirstChild("ResourceType");
     if(!resourceTypeNode.IsNull())
     {
-      m_resourceType = StringUtils::Trim(resourceTypeNode.GetText().c_str());
+      m_resourceType = resourceTypeNode.GetTextView().Trim().ToString();
       m_resourceTypeHasBeenSet = true;
     }
     XmlNode timestampNode = resultNode.FirstChild("Timestamp");
     if(!timestampNode.IsNull())
     {
-      m_timestamp = DateTime(StringUtils::Trim(timestampNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_timestamp = DateTime(timestampNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_timestampHasBeenSet = true;
     }
     XmlNode resourceStatusNode = resultNode.FirstChild("ResourceStatus");
     if(!resourceStatusNode.IsNull())
     {
-      m_resourceStatus = ResourceStatusMapper::GetResourceStatusForName(StringUtils::Trim(resourceStatusNode.GetText().c_str()).c_str());
+      m_resourceStatus = ResourceStatusMapper::GetResourceStatusForName(resourceStatusNode.GetTextView().Trim().ToString().c_str());
       m_resourceStatusHasBeenSet = true;
     }
     XmlNode resourceStatusReasonNode = resultNode.FirstChild("ResourceStatusReason");
     if(!resourceStatusReasonNode.IsNull())
     {
-      m_resourceStatusReason = StringUtils::Trim(resourceStatusReasonNode.GetText().c_str());
+      m_resourceStatusReason = resourceStatusReasonNode.GetTextView().Trim().ToString();
       m_resourceStatusReasonHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
   }
@@ -125,32 +125,32 @@ void StackResource::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_stackNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+      oStream << location << index << locationValue << ".StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
 
   if(m_stackIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StackId=" << StringUtils::URLEncode(m_stackId.c_str()) << "&";
+      oStream << location << index << locationValue << ".StackId=" << StringUtils::URLEncoded(m_stackId) << "&";
   }
 
   if(m_logicalResourceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LogicalResourceId=" << StringUtils::URLEncode(m_logicalResourceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".LogicalResourceId=" << StringUtils::URLEncoded(m_logicalResourceId) << "&";
   }
 
   if(m_physicalResourceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PhysicalResourceId=" << StringUtils::URLEncode(m_physicalResourceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".PhysicalResourceId=" << StringUtils::URLEncoded(m_physicalResourceId) << "&";
   }
 
   if(m_resourceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceType=" << StringUtils::URLEncode(m_resourceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceType=" << StringUtils::URLEncoded(m_resourceType) << "&";
   }
 
   if(m_timestampHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Timestamp=" << StringUtils::URLEncode(m_timestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".Timestamp=" << StringUtils::URLEncoded(m_timestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_resourceStatusHasBeenSet)
@@ -160,12 +160,12 @@ void StackResource::OutputToStream(Aws::OStream& oStream, const char* location,
 
   if(m_resourceStatusReasonHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceStatusReason=" << StringUtils::URLEncode(m_resourceStatusReason.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceStatusReason=" << StringUtils::URLEncoded(m_resourceStatusReason) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
 }
@@ -174,27 +174,27 @@ void StackResource::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_stackNameHasBeenSet)
   {
-      oStream << location << ".StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+      oStream << location << ".StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
   if(m_stackIdHasBeenSet)
   {
-      oStream << location << ".StackId=" << StringUtils::URLEncode(m_stackId.c_str()) << "&";
+      oStream << location << ".StackId=" << StringUtils::URLEncoded(m_stackId) << "&";
   }
   if(m_logicalResourceIdHasBeenSet)
   {
-      oStream << location << ".LogicalResourceId=" << StringUtils::URLEncode(m_logicalResourceId.c_str()) << "&";
+      oStream << location << ".LogicalResourceId=" << StringUtils::URLEncoded(m_logicalResourceId) << "&";
   }
   if(m_physicalResourceIdHasBeenSet)
   {
-      oStream << location << ".PhysicalResourceId=" << StringUtils::URLEncode(m_physicalResourceId.c_str()) << "&";
+      oStream << location << ".PhysicalResourceId=" << StringUtils::URLEncoded(m_physicalResourceId) << "&";
   }
   if(m_resourceTypeHasBeenSet)
   {
-      oStream << location << ".ResourceType=" << StringUtils::URLEncode(m_resourceType.c_str()) << "&";
+      oStream << location << ".ResourceType=" << StringUtils::URLEncoded(m_resourceType) << "&";
   }
   if(m_timestampHasBeenSet)
   {
-      oStream << location << ".Timestamp=" << StringUtils::URLEncode(m_timestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".Timestamp=" << StringUtils::URLEncoded(m_timestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_resourceStatusHasBeenSet)
   {
@@ -202,11 +202,11 @@ void StackResource::OutputToStream(Aws::OStream& oStream, const char* location)
   }
   if(m_resourceStatusReasonHasBeenSet)
   {
-      oStream << location << ".ResourceStatusReason=" << StringUtils::URLEncode(m_resourceStatusReason.c_str()) << "&";
+      oStream << location << ".ResourceStatusReason=" << StringUtils::URLEncoded(m_resourceStatusReason) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 }
 
@@ -59,37 +59,37 @@ StackResourceSummary& StackResourceSummary::operator =(const XmlNode& xmlNode)
     XmlNode logicalResourceIdNode = resultNode.FirstChild("LogicalResourceId");
     if(!logicalResourceIdNode.IsNull())
     {
-      m_logicalResourceId = StringUtils::Trim(logicalResourceIdNode.GetText().c_str());
+      m_logicalResourceId = logicalResourceIdNode.GetTextView().Trim().ToString();
       m_logicalResourceIdHasBeenSet = true;
     }
     XmlNode physicalResourceIdNode = resultNode.FirstChild("PhysicalResourceId");
     if(!physicalResourceIdNode.IsNull())
     {
-      m_physicalResourceId = StringUtils::Trim(physicalResourceIdNode.GetText().c_str());
+      m_physicalResourceId = physicalResourceIdNode.GetTextView().Trim().ToString();
       m_physicalResourceIdHasBeenSet = true;
     }
     XmlNode resourceTypeNode = resultNode.FirstChild("ResourceType");
     if(!resourceTypeNode.IsNull())
     {
-      m_resourceType = StringUtils::Trim(resourceTypeNode.GetText().c_str());
+      m_resourceType = resourceTypeNode.GetTextView().Trim().ToString();
       m_resourceTypeHasBeenSet = true;
     }
     XmlNode lastUpdatedTimestampNode = resultNode.FirstChild("LastUpdatedTimestamp");
     if(!lastUpdatedTimestampNode.IsNull())
     {
-      m_lastUpdatedTimestamp = DateTime(StringUtils::Trim(lastUpdatedTimestampNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_lastUpdatedTimestamp = DateTime(lastUpdatedTimestampNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_lastUpdatedTimestampHasBeenSet = true;
     }
     XmlNode resourceStatusNode = resultNode.FirstChild("ResourceStatus");
     if(!resourceStatusNode.IsNull())
     {
-      m_resourceStatus = ResourceStatusMapper::GetResourceStatusForName(StringUtils::Trim(resourceStatusNode.GetText().c_str()).c_str());
+      m_resourceStatus = ResourceStatusMapper::GetResourceStatusForName(resourceStatusNode.GetTextView().Trim().ToString().c_str());
       m_resourceStatusHasBeenSet = true;
     }
     XmlNode resourceStatusReasonNode = resultNode.FirstChild("ResourceStatusReason");
     if(!resourceStatusReasonNode.IsNull())
     {
-      m_resourceStatusReason = StringUtils::Trim(resourceStatusReasonNode.GetText().c_str());
+      m_resourceStatusReason = resourceStatusReasonNode.GetTextView().Trim().ToString();
       m_resourceStatusReasonHasBeenSet = true;
     }
   }
@@ -101,22 +101,22 @@ void StackResourceSummary::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_logicalResourceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LogicalResourceId=" << StringUtils::URLEncode(m_logicalResourceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".LogicalResourceId=" << StringUtils::URLEncoded(m_logicalResourceId) << "&";
   }
 
   if(m_physicalResourceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PhysicalResourceId=" << StringUtils::URLEncode(m_physicalResourceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".PhysicalResourceId=" << StringUtils::URLEncoded(m_physicalResourceId) << "&";
   }
 
   if(m_resourceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceType=" << StringUtils::URLEncode(m_resourceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceType=" << StringUtils::URLEncoded(m_resourceType) << "&";
   }
 
   if(m_lastUpdatedTimestampHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LastUpdatedTimestamp=" << StringUtils::URLEncode(m_lastUpdatedTimestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".LastUpdatedTimestamp=" << StringUtils::URLEncoded(m_lastUpdatedTimestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_resourceStatusHasBeenSet)
@@ -126,7 +126,7 @@ void StackResourceSummary::OutputToStream(Aws::OStream& oStream, const char* loc
 
   if(m_resourceStatusReasonHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceStatusReason=" << StringUtils::URLEncode(m_resourceStatusReason.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceStatusReason=" << StringUtils::URLEncoded(m_resourceStatusReason) << "&";
   }
 
 }
@@ -135,19 +135,19 @@ void StackResourceSummary::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_logicalResourceIdHasBeenSet)
   {
-      oStream << location << ".LogicalResourceId=" << StringUtils::URLEncode(m_logicalResourceId.c_str()) << "&";
+      oStream << location << ".LogicalResourceId=" << StringUtils::URLEncoded(m_logicalResourceId) << "&";
   }
   if(m_physicalResourceIdHasBeenSet)
   {
-      oStream << location << ".PhysicalResourceId=" << StringUtils::URLEncode(m_physicalResourceId.c_str()) << "&";
+      oStream << location << ".PhysicalResourceId=" << StringUtils::URLEncoded(m_physicalResourceId) << "&";
   }
   if(m_resourceTypeHasBeenSet)
   {
-      oStream << location << ".ResourceType=" << StringUtils::URLEncode(m_resourceType.c_str()) << "&";
+      oStream << location << ".ResourceType=" << StringUtils::URLEncoded(m_resourceType) << "&";
   }
   if(m_lastUpdatedTimestampHasBeenSet)
   {
-      oStream << location << ".LastUpdatedTimestamp=" << StringUtils::URLEncode(m_lastUpdatedTimestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".LastUpdatedTimestamp=" << StringUtils::URLEncoded(m_lastUpdatedTimestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_resourceStatusHasBeenSet)
   {
@@ -155,7 +155,7 @@ void StackResourceSummary::OutputToStream(Aws::OStream& oStream, const char* loc
   }
   if(m_resourceStatusReasonHasBeenSet)
   {
-      oStream << location << ".ResourceStatusReason=" << StringUtils::URLEncode(m_resourceStatusReason.c_str()) << "&";
+      oStream << location << ".ResourceStatusReason=" << StringUtils::URLEncoded(m_resourceStatusReason) << "&";
   }
 }
 
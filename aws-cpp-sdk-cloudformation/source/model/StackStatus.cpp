@@ -29,91 +29,71 @@ namespace Aws
       namespace StackStatusMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int CREATE_FAILED_HASH = HashingUtils::HashString("CREATE_FAILED");
-        static const int CREATE_COMPLETE_HASH = HashingUtils::HashString("CREATE_COMPLETE");
-        static const int ROLLBACK_IN_PROGRESS_HASH = HashingUtils::HashString("ROLLBACK_IN_PROGRESS");
-        static const int ROLLBACK_FAILED_HASH = HashingUtils::HashString("ROLLBACK_FAILED");
-        static const int ROLLBACK_COMPLETE_HASH = HashingUtils::HashString("ROLLBACK_COMPLETE");
-        static const int DELETE_IN_PROGRESS_HASH = HashingUtils::HashString("DELETE_IN_PROGRESS");
-        static const int DELETE_FAILED_HASH = HashingUtils::HashString("DELETE_FAILED");
-        static const int DELETE_COMPLETE_HASH = HashingUtils::HashString("DELETE_COMPLETE");
-        static const int UPDATE_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_IN_PROGRESS");
-        static const int UPDATE_COMPLETE_CLEANUP_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_COMPLETE_CLEANUP_IN_PROGRESS");
-        static const int UPDATE_COMPLETE_HASH = HashingUtils::HashString("UPDATE_COMPLETE");
-        static const int UPDATE_ROLLBACK_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_ROLLBACK_IN_PROGRESS");
-        static const int UPDATE_ROLLBACK_FAILED_HASH = HashingUtils::HashString("UPDATE_ROLLBACK_FAILED");
-        static const int UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS");
-        static const int UPDATE_ROLLBACK_COMPLETE_HASH = HashingUtils::HashString("UPDATE_ROLLBACK_COMPLETE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CREATE_IN_PROGRESS_HASH = 43560260;
+        static const int CREATE_FAILED_HASH = -835019552;
+        static const int CREATE_COMPLETE_HASH = -569796324;
+        static const int ROLLBACK_IN_PROGRESS_HASH = -1546949844;
+        static const int ROLLBACK_FAILED_HASH = 1450364408;
+        static const int ROLLBACK_COMPLETE_HASH = 955900980;
+        static const int DELETE_IN_PROGRESS_HASH = 1089799027;
+        static const int DELETE_FAILED_HASH = 1008657745;
+        static const int DELETE_COMPLETE_HASH = 1677560141;
+        static const int UPDATE_IN_PROGRESS_HASH = 1375009169;
+        static const int UPDATE_COMPLETE_CLEANUP_IN_PROGRESS_HASH = 1430234748;
+        static const int UPDATE_COMPLETE_HASH = 2100852719;
+        static const int UPDATE_ROLLBACK_IN_PROGRESS_HASH = -1611767582;
+        static const int UPDATE_ROLLBACK_FAILED_HASH = -1565614462;
+        static const int UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS_HASH = 2089397067;
+        static const int UPDATE_ROLLBACK_COMPLETE_HASH = 1703131710;
 
 
         StackStatus GetStackStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
+          switch (hashCode)
           {
+          case CREATE_IN_PROGRESS_HASH:
             return StackStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == CREATE_FAILED_HASH)
-          {
+          case CREATE_FAILED_HASH:
             return StackStatus::CREATE_FAILED;
-          }
-          else if (hashCode == CREATE_COMPLETE_HASH)
-          {
+          case CREATE_COMPLETE_HASH:
             return StackStatus::CREATE_COMPLETE;
-          }
-          else if (hashCode == ROLLBACK_IN_PROGRESS_HASH)
-          {
+          case ROLLBACK_IN_PROGRESS_HASH:
             return StackStatus::ROLLBACK_IN_PROGRESS;
-          }
-          else if (hashCode == ROLLBACK_FAILED_HASH)
-          {
+          case ROLLBACK_FAILED_HASH:
             return StackStatus::ROLLBACK_FAILED;
-          }
-          else if (hashCode == ROLLBACK_COMPLETE_HASH)
-          {
+          case ROLLBACK_COMPLETE_HASH:
             return StackStatus::ROLLBACK_COMPLETE;
-          }
-          else if (hashCode == DELETE_IN_PROGRESS_HASH)
-          {
+          case DELETE_IN_PROGRESS_HASH:
             return StackStatus::DELETE_IN_PROGRESS;
-          }
-          else if (hashCode == DELETE_FAILED_HASH)
-          {
+          case DELETE_FAILED_HASH:
             return StackStatus::DELETE_FAILED;
-          }
-          else if (hashCode == DELETE_COMPLETE_HASH)
-          {
+          case DELETE_COMPLETE_HASH:
             return StackStatus::DELETE_COMPLETE;
-          }
-          else if (hashCode == UPDATE_IN_PROGRESS_HASH)
-          {
+          case UPDATE_IN_PROGRESS_HASH:
             return StackStatus::UPDATE_IN_PROGRESS;
-          }
-          else if (hashCode == UPDATE_COMPLETE_CLEANUP_IN_PROGRESS_HASH)
-          {
+          case UPDATE_COMPLETE_CLEANUP_IN_PROGRESS_HASH:
             return StackStatus::UPDATE_COMPLETE_CLEANUP_IN_PROGRESS;
-          }
-          else if (hashCode == UPDATE_COMPLETE_HASH)
-          {
+          case UPDATE_COMPLETE_HASH:
             return StackStatus::UPDATE_COMPLETE;
-          }
-          else if (hashCode == UPDATE_ROLLBACK_IN_PROGRESS_HASH)
-          {
+          case UPDATE_ROLLBACK_IN_PROGRESS_HASH:
             return StackStatus::UPDATE_ROLLBACK_IN_PROGRESS;
-          }
-          else if (hashCode == UPDATE_ROLLBACK_FAILED_HASH)
-          {
+          case UPDATE_ROLLBACK_FAILED_HASH:
             return StackStatus::UPDATE_ROLLBACK_FAILED;
-          }
-          else if (hashCode == UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS_HASH)
-          {
+          case UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS_HASH:
             return StackStatus::UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS;
-          }
-          else if (hashCode == UPDATE_ROLLBACK_COMPLETE_HASH)
-          {
+          case UPDATE_ROLLBACK_COMPLETE_HASH:
             return StackStatus::UPDATE_ROLLBACK_COMPLETE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -63,49 +63,49 @@ StackSummary& StackSummary::operator =(const XmlNode& xmlNode)
     XmlNode stackIdNode = resultNode.FirstChild("StackId");
     if(!stackIdNode.IsNull())
     {
-      m_stackId = StringUtils::Trim(stackIdNode.GetText().c_str());
+      m_stackId = stackIdNode.GetTextView().Trim().ToString();
       m_stackIdHasBeenSet = true;
     }
     XmlNode stackNameNode = resultNode.FirstChild("StackName");
     if(!stackNameNode.IsNull())
     {
-      m_stackName = StringUtils::Trim(stackNameNode.GetText().c_str());
+      m_stackName = stackNameNode.GetTextView().Trim().ToString();
       m_stackNameHasBeenSet = true;
     }
     XmlNode templateDescriptionNode = resultNode.FirstChild("TemplateDescription");
     if(!templateDescriptionNode.IsNull())
     {
-      m_templateDescription = StringUtils::Trim(templateDescriptionNode.GetText().c_str());
+      m_templateDescription = templateDescriptionNode.GetTextView().Trim().ToString();
       m_templateDescriptionHasBeenSet = true;
     }
     XmlNode creationTimeNode = resultNode.FirstChild("CreationTime");
     if(!creationTimeNode.IsNull())
     {
-      m_creationTime = DateTime(StringUtils::Trim(creationTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_creationTime = DateTime(creationTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_creationTimeHasBeenSet = true;
     }
     XmlNode lastUpdatedTimeNode = resultNode.FirstChild("LastUpdatedTime");
     if(!lastUpdatedTimeNode.IsNull())
     {
-      m_lastUpdatedTime = DateTime(StringUtils::Trim(lastUpdatedTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_lastUpdatedTime = DateTime(lastUpdatedTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_lastUpdatedTimeHasBeenSet = true;
     }
     XmlNode deletionTimeNode = resultNode.FirstChild("DeletionTime");
     if(!deletionTimeNode.IsNull())
     {
-      m_deletionTime = DateTime(StringUtils::Trim(deletionTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_deletionTime = DateTime(deletionTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_deletionTimeHasBeenSet = true;
     }
     XmlNode stackStatusNode = resultNode.FirstChild("StackStatus");
     if(!stackStatusNode.IsNull())
     {
-      m_stackStatus = StackStatusMapper::GetStackStatusForName(StringUtils::Trim(stackStatusNode.GetText().c_str()).c_str());
+      m_stackStatus = StackStatusMapper::GetStackStatusForName(stackStatusNode.GetTextView().Trim().ToString().c_str());
       m_stackStatusHasBeenSet = true;
     }
     XmlNode stackStatusReasonNode = resultNode.FirstChild("StackStatusReason");
     if(!stackStatusReasonNode.IsNull())
     {
-      m_stackStatusReason = StringUtils::Trim(stackStatusReasonNode.GetText().c_str());
+      m_stackStatusReason = stackStatusReasonNode.GetTextView().Trim().ToString();
       m_stackStatusReasonHasBeenSet = true;
     }
   }
@@ -117,32 +117,32 @@ void StackSummary::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_stackIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StackId=" << StringUtils::URLEncode(m_stackId.c_str()) << "&";
+      oStream << location << index << locationValue << ".StackId=" << StringUtils::URLEncoded(m_stackId) << "&";
   }
 
   if(m_stackNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+      oStream << location << index << locationValue << ".StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
 
   if(m_templateDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TemplateDescription=" << StringUtils::URLEncode(m_templateDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".TemplateDescription=" << StringUtils::URLEncoded(m_templateDescription) << "&";
   }
 
   if(m_creationTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreationTime=" << StringUtils::URLEncode(m_creationTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreationTime=" << StringUtils::URLEncoded(m_creationTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_lastUpdatedTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LastUpdatedTime=" << StringUtils::URLEncode(m_lastUpdatedTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".LastUpdatedTime=" << StringUtils::URLEncoded(m_lastUpdatedTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_deletionTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DeletionTime=" << StringUtils::URLEncode(m_deletionTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".DeletionTime=" << StringUtils::URLEncoded(m_deletionTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_stackStatusHasBeenSet)
@@ -152,7 +152,7 @@ void StackSummary::OutputToStream(Aws::OStream& oStream, const char* location, u
 
   if(m_stackStatusReasonHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StackStatusReason=" << StringUtils::URLEncode(m_stackStatusReason.c_str()) << "&";
+      oStream << location << index << locationValue << ".StackStatusReason=" << StringUtils::URLEncoded(m_stackStatusReason) << "&";
   }
 
 }
@@ -161,27 +161,27 @@ void StackSummary::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_stackIdHasBeenSet)
   {
-      oStream << location << ".StackId=" << StringUtils::URLEncode(m_stackId.c_str()) << "&";
+      oStream << location << ".StackId=" << StringUtils::URLEncoded(m_stackId) << "&";
   }
   if(m_stackNameHasBeenSet)
   {
-      oStream << location << ".StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+      oStream << location << ".StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
   if(m_templateDescriptionHasBeenSet)
   {
-      oStream << location << ".TemplateDescription=" << StringUtils::URLEncode(m_templateDescription.c_str()) << "&";
+      oStream << location << ".TemplateDescription=" << StringUtils::URLEncoded(m_templateDescription) << "&";
   }
   if(m_creationTimeHasBeenSet)
   {
-      oStream << location << ".CreationTime=" << StringUtils::URLEncode(m_creationTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreationTime=" << StringUtils::URLEncoded(m_creationTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_lastUpdatedTimeHasBeenSet)
   {
-      oStream << location << ".LastUpdatedTime=" << StringUtils::URLEncode(m_lastUpdatedTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".LastUpdatedTime=" << StringUtils::URLEncoded(m_lastUpdatedTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_deletionTimeHasBeenSet)
   {
-      oStream << location << ".DeletionTime=" << StringUtils::URLEncode(m_deletionTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".DeletionTime=" << StringUtils::URLEncoded(m_deletionTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_stackStatusHasBeenSet)
   {
@@ -189,7 +189,7 @@ void StackSummary::OutputToStream(Aws::OStream& oStream, const char* location) c
   }
   if(m_stackStatusReasonHasBeenSet)
   {
-      oStream << location << ".StackStatusReason=" << StringUtils::URLEncode(m_stackStatusReason.c_str()) << "&";
+      oStream << location << ".StackStatusReason=" << StringUtils::URLEncoded(m_stackStatusReason) << "&";
   }
 }
 
@@ -57,25 +57,25 @@ TemplateParameter& TemplateParameter::operator =(const XmlNode& xmlNode)
     XmlNode parameterKeyNode = resultNode.FirstChild("ParameterKey");
     if(!parameterKeyNode.IsNull())
     {
-      m_parameterKey = StringUtils::Trim(parameterKeyNode.GetText().c_str());
+      m_parameterKey = parameterKeyNode.GetTextView().Trim().ToString();
       m_parameterKeyHasBeenSet = true;
     }
     XmlNode defaultValueNode = resultNode.FirstChild("DefaultValue");
     if(!defaultValueNode.IsNull())
     {
-      m_defaultValue = StringUtils::Trim(defaultValueNode.GetText().c_str());
+      m_defaultValue = defaultValueNode.GetTextView().Trim().ToString();
       m_defaultValueHasBeenSet = true;
     }
     XmlNode noEchoNode = resultNode.FirstChild("NoEcho");
     if(!noEchoNode.IsNull())
     {
-      m_noEcho = StringUtils::ConvertToBool(StringUtils::Trim(noEchoNode.GetText().c_str()).c_str());
+      m_noEcho = StringUtils::ConvertToBool(noEchoNode.GetTextView().Trim().ToString().c_str());
       m_noEchoHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
   }
@@ -87,12 +87,12 @@ void TemplateParameter::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_parameterKeyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterKey=" << StringUtils::URLEncode(m_parameterKey.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterKey=" << StringUtils::URLEncoded(m_parameterKey) << "&";
   }
 
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
 
   if(m_noEchoHasBeenSet)
@@ -102,7 +102,7 @@ void TemplateParameter::OutputToStream(Aws::OStream& oStream, const char* locati
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
 }
@@ -111,11 +111,11 @@ void TemplateParameter::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_parameterKeyHasBeenSet)
   {
-      oStream << location << ".ParameterKey=" << StringUtils::URLEncode(m_parameterKey.c_str()) << "&";
+      oStream << location << ".ParameterKey=" << StringUtils::URLEncoded(m_parameterKey) << "&";
   }
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
   if(m_noEchoHasBeenSet)
   {
@@ -123,7 +123,7 @@ void TemplateParameter::OutputToStream(Aws::OStream& oStream, const char* locati
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 }
 
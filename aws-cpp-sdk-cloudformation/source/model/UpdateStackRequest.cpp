@@ -15,6 +15,7 @@
 #include <aws/cloudformation/model/UpdateStackRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudFormation::Model;
 using namespace Aws::Utils;
@@ -39,21 +40,21 @@ UpdateStackRequest::UpdateStackRequest() :
 
 Aws::String UpdateStackRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UpdateStack&";
   if(m_stackNameHasBeenSet)
   {
-    ss << "StackName=" << StringUtils::URLEncode(m_stackName.c_str()) << "&";
+    ss << "StackName=" << StringUtils::URLEncoded(m_stackName) << "&";
   }
 
   if(m_templateBodyHasBeenSet)
   {
-    ss << "TemplateBody=" << StringUtils::URLEncode(m_templateBody.c_str()) << "&";
+    ss << "TemplateBody=" << StringUtils::URLEncoded(m_templateBody) << "&";
   }
 
   if(m_templateURLHasBeenSet)
   {
-    ss << "TemplateURL=" << StringUtils::URLEncode(m_templateURL.c_str()) << "&";
+    ss << "TemplateURL=" << StringUtils::URLEncoded(m_templateURL) << "&";
   }
 
   if(m_usePreviousTemplateHasBeenSet)
@@ -63,12 +64,12 @@ Aws::String UpdateStackRequest::SerializePayload() const
 
   if(m_stackPolicyDuringUpdateBodyHasBeenSet)
   {
-    ss << "StackPolicyDuringUpdateBody=" << StringUtils::URLEncode(m_stackPolicyDuringUpdateBody.c_str()) << "&";
+    ss << "StackPolicyDuringUpdateBody=" << StringUtils::URLEncoded(m_stackPolicyDuringUpdateBody) << "&";
   }
 
   if(m_stackPolicyDuringUpdateURLHasBeenSet)
   {
-    ss << "StackPolicyDuringUpdateURL=" << StringUtils::URLEncode(m_stackPolicyDuringUpdateURL.c_str()) << "&";
+    ss << "StackPolicyDuringUpdateURL=" << StringUtils::URLEncoded(m_stackPolicyDuringUpdateURL) << "&";
   }
 
   if(m_parametersHasBeenSet)
@@ -87,7 +88,7 @@ Aws::String UpdateStackRequest::SerializePayload() const
     for(auto& item : m_capabilities)
     {
       ss << "Capabilities.member." << capabilitiesCount << "="
-          << StringUtils::URLEncode(CapabilityMapper::GetNameForCapability(item).c_str()) << "&";
+          << StringUtils::URLEncoded(CapabilityMapper::GetNameForCapability(item)) << "&";
       capabilitiesCount++;
     }
   }
@@ -98,19 +99,19 @@ Aws::String UpdateStackRequest::SerializePayload() const
     for(auto& item : m_resourceTypes)
     {
       ss << "ResourceTypes.member." << resourceTypesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       resourceTypesCount++;
     }
   }
 
   if(m_stackPolicyBodyHasBeenSet)
   {
-    ss << "StackPolicyBody=" << StringUtils::URLEncode(m_stackPolicyBody.c_str()) << "&";
+    ss << "StackPolicyBody=" << StringUtils::URLEncoded(m_stackPolicyBody) << "&";
   }
 
   if(m_stackPolicyURLHasBeenSet)
   {
-    ss << "StackPolicyURL=" << StringUtils::URLEncode(m_stackPolicyURL.c_str()) << "&";
+    ss << "StackPolicyURL=" << StringUtils::URLEncoded(m_stackPolicyURL) << "&";
   }
 
   if(m_notificationARNsHasBeenSet)
@@ -119,7 +120,7 @@ Aws::String UpdateStackRequest::SerializePayload() const
     for(auto& item : m_notificationARNs)
     {
       ss << "NotificationARNs.member." << notificationARNsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       notificationARNsCount++;
     }
   }
@@ -135,6 +136,6 @@ Aws::String UpdateStackRequest::SerializePayload() const
   }
 
   ss << "Version=2010-05-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ UpdateStackResult& UpdateStackResult::operator =(const AmazonWebServiceResult<Xm
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "UpdateStackResult")
+  if (rootNode.GetNameView() != "UpdateStackResult")
   {
     resultNode = rootNode.FirstChild("UpdateStackResult");
   }
@@ -50,7 +50,7 @@ UpdateStackResult& UpdateStackResult::operator =(const AmazonWebServiceResult<Xm
     XmlNode stackIdNode = resultNode.FirstChild("StackId");
     if(!stackIdNode.IsNull())
     {
-      m_stackId = StringUtils::Trim(stackIdNode.GetText().c_str());
+      m_stackId = stackIdNode.GetTextView().Trim().ToString();
     }
   }
 
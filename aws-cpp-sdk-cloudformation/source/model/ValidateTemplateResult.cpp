@@ -40,7 +40,7 @@ ValidateTemplateResult& ValidateTemplateResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ValidateTemplateResult")
+  if (rootNode.GetNameView() != "ValidateTemplateResult")
   {
     resultNode = rootNode.FirstChild("ValidateTemplateResult");
   }
@@ -61,7 +61,7 @@ ValidateTemplateResult& ValidateTemplateResult::operator =(const AmazonWebServic
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
     }
     XmlNode capabilitiesNode = resultNode.FirstChild("Capabilities");
     if(!capabilitiesNode.IsNull())
@@ -69,7 +69,7 @@ ValidateTemplateResult& ValidateTemplateResult::operator =(const AmazonWebServic
       XmlNode capabilitiesMember = capabilitiesNode.FirstChild("member");
       while(!capabilitiesMember.IsNull())
       {
-        m_capabilities.push_back(CapabilityMapper::GetCapabilityForName(StringUtils::Trim(capabilitiesMember.GetText().c_str())));
+        m_capabilities.push_back(CapabilityMapper::GetCapabilityForName(capabilitiesMember.GetTextView().Trim().ToString()));
         capabilitiesMember = capabilitiesMember.NextNode("member");
       }
 
@@ -77,7 +77,7 @@ ValidateTemplateResult& ValidateTemplateResult::operator =(const AmazonWebServic
     XmlNode capabilitiesReasonNode = resultNode.FirstChild("CapabilitiesReason");
     if(!capabilitiesReasonNode.IsNull())
     {
-      m_capabilitiesReason = StringUtils::Trim(capabilitiesReasonNode.GetText().c_str());
+      m_capabilitiesReason = capabilitiesReasonNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -41,6 +41,9 @@
 #include <aws/cloudfront/model/UpdateStreamingDistribution2016_01_28Result.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -225,6 +228,18 @@ namespace Model
          */
         virtual void CreateCloudFrontOriginAccessIdentity2016_01_28Async(const Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request& request, const CreateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCloudFrontOriginAccessIdentity2016_01_28Callable(const Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CreateCloudFrontOriginAccessIdentity2016_01_28Callable(Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request&& request) const;
+
+        /**
+         * Same as CreateCloudFrontOriginAccessIdentity2016_01_28Async(const Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateCloudFrontOriginAccessIdentity2016_01_28Async(Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request&& request, const CreateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Create a new distribution.
          */
@@ -244,6 +259,18 @@ namespace Model
          */
         virtual void CreateDistribution2016_01_28Async(const Model::CreateDistribution2016_01_28Request& request, const CreateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDistribution2016_01_28Callable(const Model::CreateDistribution2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDistribution2016_01_28OutcomeCallable CreateDistribution2016_01_28Callable(Model::CreateDistribution2016_01_28Request&& request) const;
+
+        /**
+         * Same as CreateDistribution2016_01_28Async(const Model::CreateDistribution2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDistribution2016_01_28Async(Model::CreateDistribution2016_01_28Request&& request, const CreateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Create a new invalidation.
          */
@@ -263,6 +290,18 @@ namespace Model
          */
         virtual void CreateInvalidation2016_01_28Async(const Model::CreateInvalidation2016_01_28Request& request, const CreateInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateInvalidation2016_01_28Callable(const Model::CreateInvalidation2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateInvalidation2016_01_28OutcomeCallable CreateInvalidation2016_01_28Callable(Model::CreateInvalidation2016_01_28Request&& request) const;
+
+        /**
+         * Same as CreateInvalidation2016_01_28Async(const Model::CreateInvalidation2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateInvalidation2016_01_28Async(Model::CreateInvalidation2016_01_28Request&& request, const CreateInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Create a new streaming distribution.
          */
@@ -282,6 +321,18 @@ namespace Model
          */
         virtual void CreateStreamingDistribution2016_01_28Async(const Model::CreateStreamingDistribution2016_01_28Request& request, const CreateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateStreamingDistribution2016_01_28Callable(const Model::CreateStreamingDistribution2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateStreamingDistribution2016_01_28OutcomeCallable CreateStreamingDistribution2016_01_28Callable(Model::CreateStreamingDistribution2016_01_28Request&& request) const;
+
+        /**
+         * Same as CreateStreamingDistribution2016_01_28Async(const Model::CreateStreamingDistribution2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateStreamingDistribution2016_01_28Async(Model::CreateStreamingDistribution2016_01_28Request&& request, const CreateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Delete an origin access identity.
          */
@@ -301,6 +352,18 @@ namespace Model
          */
         virtual void DeleteCloudFrontOriginAccessIdentity2016_01_28Async(const Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request, const DeleteCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCloudFrontOriginAccessIdentity2016_01_28Callable(const Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable DeleteCloudFrontOriginAccessIdentity2016_01_28Callable(Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request&& request) const;
+
+        /**
+         * Same as DeleteCloudFrontOriginAccessIdentity2016_01_28Async(const Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteCloudFrontOriginAccessIdentity2016_01_28Async(Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request&& request, const DeleteCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Delete a distribution.
          */
@@ -320,6 +383,18 @@ namespace Model
          */
         virtual void DeleteDistribution2016_01_28Async(const Model::DeleteDistribution2016_01_28Request& request, const DeleteDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDistribution2016_01_28Callable(const Model::DeleteDistribution2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDistribution2016_01_28OutcomeCallable DeleteDistribution2016_01_28Callable(Model::DeleteDistribution2016_01_28Request&& request) const;
+
+        /**
+         * Same as DeleteDistribution2016_01_28Async(const Model::DeleteDistribution2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDistribution2016_01_28Async(Model::DeleteDistribution2016_01_28Request&& request, const DeleteDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Delete a streaming distribution.
          */
@@ -339,6 +414,18 @@ namespace Model
          */
         virtual void DeleteStreamingDistribution2016_01_28Async(const Model::DeleteStreamingDistribution2016_01_28Request& request, const DeleteStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteStreamingDistribution2016_01_28Callable(const Model::DeleteStreamingDistribution2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteStreamingDistribution2016_01_28OutcomeCallable DeleteStreamingDistribution2016_01_28Callable(Model::DeleteStreamingDistribution2016_01_28Request&& request) const;
+
+        /**
+         * Same as DeleteStreamingDistribution2016_01_28Async(const Model::DeleteStreamingDistribution2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteStreamingDistribution2016_01_28Async(Model::DeleteStreamingDistribution2016_01_28Request&& request, const DeleteStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Get the information about an origin access identity.
          */
@@ -358,6 +445,18 @@ namespace Model
          */
         virtual void GetCloudFrontOriginAccessIdentity2016_01_28Async(const Model::GetCloudFrontOriginAccessIdentity2016_01_28Request& request, const GetCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCloudFrontOriginAccessIdentity2016_01_28Callable(const Model::GetCloudFrontOriginAccessIdentity2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable GetCloudFrontOriginAccessIdentity2016_01_28Callable(Model::GetCloudFrontOriginAccessIdentity2016_01_28Request&& request) const;
+
+        /**
+         * Same as GetCloudFrontOriginAccessIdentity2016_01_28Async(const Model::GetCloudFrontOriginAccessIdentity2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetCloudFrontOriginAccessIdentity2016_01_28Async(Model::GetCloudFrontOriginAccessIdentity2016_01_28Request&& request, const GetCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Get the configuration information about an origin access identity.
          */
@@ -377,6 +476,18 @@ namespace Model
          */
         virtual void GetCloudFrontOriginAccessIdentityConfig2016_01_28Async(const Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request, const GetCloudFrontOriginAccessIdentityConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCloudFrontOriginAccessIdentityConfig2016_01_28Callable(const Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28OutcomeCallable GetCloudFrontOriginAccessIdentityConfig2016_01_28Callable(Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request&& request) const;
+
+        /**
+         * Same as GetCloudFrontOriginAccessIdentityConfig2016_01_28Async(const Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetCloudFrontOriginAccessIdentityConfig2016_01_28Async(Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request&& request, const GetCloudFrontOriginAccessIdentityConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Get the information about a distribution.
          */
@@ -396,6 +507,18 @@ namespace Model
          */
         virtual void GetDistribution2016_01_28Async(const Model::GetDistribution2016_01_28Request& request, const GetDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDistribution2016_01_28Callable(const Model::GetDistribution2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDistribution2016_01_28OutcomeCallable GetDistribution2016_01_28Callable(Model::GetDistribution2016_01_28Request&& request) const;
+
+        /**
+         * Same as GetDistribution2016_01_28Async(const Model::GetDistribution2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDistribution2016_01_28Async(Model::GetDistribution2016_01_28Request&& request, const GetDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Get the configuration information about a distribution.
          */
@@ -415,6 +538,18 @@ namespace Model
          */
         virtual void GetDistributionConfig2016_01_28Async(const Model::GetDistributionConfig2016_01_28Request& request, const GetDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDistributionConfig2016_01_28Callable(const Model::GetDistributionConfig2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDistributionConfig2016_01_28OutcomeCallable GetDistributionConfig2016_01_28Callable(Model::GetDistributionConfig2016_01_28Request&& request) const;
+
+        /**
+         * Same as GetDistributionConfig2016_01_28Async(const Model::GetDistributionConfig2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDistributionConfig2016_01_28Async(Model::GetDistributionConfig2016_01_28Request&& request, const GetDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Get the information about an invalidation.
          */
@@ -434,6 +569,18 @@ namespace Model
          */
         virtual void GetInvalidation2016_01_28Async(const Model::GetInvalidation2016_01_28Request& request, const GetInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetInvalidation2016_01_28Callable(const Model::GetInvalidation2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetInvalidation2016_01_28OutcomeCallable GetInvalidation2016_01_28Callable(Model::GetInvalidation2016_01_28Request&& request) const;
+
+        /**
+         * Same as GetInvalidation2016_01_28Async(const Model::GetInvalidation2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetInvalidation2016_01_28Async(Model::GetInvalidation2016_01_28Request&& request, const GetInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Get the information about a streaming distribution.
          */
@@ -453,6 +600,18 @@ namespace Model
          */
         virtual void GetStreamingDistribution2016_01_28Async(const Model::GetStreamingDistribution2016_01_28Request& request, const GetStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetStreamingDistribution2016_01_28Callable(const Model::GetStreamingDistribution2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetStreamingDistribution2016_01_28OutcomeCallable GetStreamingDistribution2016_01_28Callable(Model::GetStreamingDistribution2016_01_28Request&& request) const;
+
+        /**
+         * Same as GetStreamingDistribution2016_01_28Async(const Model::GetStreamingDistribution2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetStreamingDistribution2016_01_28Async(Model::GetStreamingDistribution2016_01_28Request&& request, const GetStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Get the configuration information about a streaming distribution.
          */
@@ -472,6 +631,18 @@ namespace Model
          */
         virtual void GetStreamingDistributionConfig2016_01_28Async(const Model::GetStreamingDistributionConfig2016_01_28Request& request, const GetStreamingDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetStreamingDistributionConfig2016_01_28Callable(const Model::GetStreamingDistributionConfig2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetStreamingDistributionConfig2016_01_28OutcomeCallable GetStreamingDistributionConfig2016_01_28Callable(Model::GetStreamingDistributionConfig2016_01_28Request&& request) const;
+
+        /**
+         * Same as GetStreamingDistributionConfig2016_01_28Async(const Model::GetStreamingDistributionConfig2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetStreamingDistributionConfig2016_01_28Async(Model::GetStreamingDistributionConfig2016_01_28Request&& request, const GetStreamingDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * List origin access identities.
          */
@@ -491,6 +662,18 @@ namespace Model
          */
         virtual void ListCloudFrontOriginAccessIdentities2016_01_28Async(const Model::ListCloudFrontOriginAccessIdentities2016_01_28Request& request, const ListCloudFrontOriginAccessIdentities2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListCloudFrontOriginAccessIdentities2016_01_28Callable(const Model::ListCloudFrontOriginAccessIdentities2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListCloudFrontOriginAccessIdentities2016_01_28OutcomeCallable ListCloudFrontOriginAccessIdentities2016_01_28Callable(Model::ListCloudFrontOriginAccessIdentities2016_01_28Request&& request) const;
+
+        /**
+         * Same as ListCloudFrontOriginAccessIdentities2016_01_28Async(const Model::ListCloudFrontOriginAccessIdentities2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListCloudFrontOriginAccessIdentities2016_01_28Async(Model::ListCloudFrontOriginAccessIdentities2016_01_28Request&& request, const ListCloudFrontOriginAccessIdentities2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * List distributions.
          */
@@ -510,6 +693,18 @@ namespace Model
          */
         virtual void ListDistributions2016_01_28Async(const Model::ListDistributions2016_01_28Request& request, const ListDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDistributions2016_01_28Callable(const Model::ListDistributions2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDistributions2016_01_28OutcomeCallable ListDistributions2016_01_28Callable(Model::ListDistributions2016_01_28Request&& request) const;
+
+        /**
+         * Same as ListDistributions2016_01_28Async(const Model::ListDistributions2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDistributions2016_01_28Async(Model::ListDistributions2016_01_28Request&& request, const ListDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * List the distributions that are associated with a specified AWS WAF web ACL.
          */
@@ -529,6 +724,18 @@ namespace Model
          */
         virtual void ListDistributionsByWebACLId2016_01_28Async(const Model::ListDistributionsByWebACLId2016_01_28Request& request, const ListDistributionsByWebACLId2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDistributionsByWebACLId2016_01_28Callable(const Model::ListDistributionsByWebACLId2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDistributionsByWebACLId2016_01_28OutcomeCallable ListDistributionsByWebACLId2016_01_28Callable(Model::ListDistributionsByWebACLId2016_01_28Request&& request) const;
+
+        /**
+         * Same as ListDistributionsByWebACLId2016_01_28Async(const Model::ListDistributionsByWebACLId2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDistributionsByWebACLId2016_01_28Async(Model::ListDistributionsByWebACLId2016_01_28Request&& request, const ListDistributionsByWebACLId2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * List invalidation batches.
          */
@@ -548,6 +755,18 @@ namespace Model
          */
         virtual void ListInvalidations2016_01_28Async(const Model::ListInvalidations2016_01_28Request& request, const ListInvalidations2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListInvalidations2016_01_28Callable(const Model::ListInvalidations2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListInvalidations2016_01_28OutcomeCallable ListInvalidations2016_01_28Callable(Model::ListInvalidations2016_01_28Request&& request) const;
+
+        /**
+         * Same as ListInvalidations2016_01_28Async(const Model::ListInvalidations2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListInvalidations2016_01_28Async(Model::ListInvalidations2016_01_28Request&& request, const ListInvalidations2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * List streaming distributions.
          */
@@ -567,6 +786,18 @@ namespace Model
          */
         virtual void ListStreamingDistributions2016_01_28Async(const Model::ListStreamingDistributions2016_01_28Request& request, const ListStreamingDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListStreamingDistributions2016_01_28Callable(const Model::ListStreamingDistributions2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListStreamingDistributions2016_01_28OutcomeCallable ListStreamingDistributions2016_01_28Callable(Model::ListStreamingDistributions2016_01_28Request&& request) const;
+
+        /**
+         * Same as ListStreamingDistributions2016_01_28Async(const Model::ListStreamingDistributions2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListStreamingDistributions2016_01_28Async(Model::ListStreamingDistributions2016_01_28Request&& request, const ListStreamingDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Update an origin access identity.
          */
@@ -586,6 +817,18 @@ namespace Model
          */
         virtual void UpdateCloudFrontOriginAccessIdentity2016_01_28Async(const Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request, const UpdateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateCloudFrontOriginAccessIdentity2016_01_28Callable(const Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable UpdateCloudFrontOriginAccessIdentity2016_01_28Callable(Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request&& request) const;
+
+        /**
+         * Same as UpdateCloudFrontOriginAccessIdentity2016_01_28Async(const Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateCloudFrontOriginAccessIdentity2016_01_28Async(Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request&& request, const UpdateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Update a distribution.
          */
@@ -605,6 +848,18 @@ namespace Model
          */
         virtual void UpdateDistribution2016_01_28Async(const Model::UpdateDistribution2016_01_28Request& request, const UpdateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDistribution2016_01_28Callable(const Model::UpdateDistribution2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateDistribution2016_01_28OutcomeCallable UpdateDistribution2016_01_28Callable(Model::UpdateDistribution2016_01_28Request&& request) const;
+
+        /**
+         * Same as UpdateDistribution2016_01_28Async(const Model::UpdateDistribution2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateDistribution2016_01_28Async(Model::UpdateDistribution2016_01_28Request&& request, const UpdateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Update a streaming distribution.
          */
@@ -624,6 +879,130 @@ namespace Model
          */
         virtual void UpdateStreamingDistribution2016_01_28Async(const Model::UpdateStreamingDistribution2016_01_28Request& request, const UpdateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateStreamingDistribution2016_01_28Callable(const Model::UpdateStreamingDistribution2016_01_28Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateStreamingDistribution2016_01_28OutcomeCallable UpdateStreamingDistribution2016_01_28Callable(Model::UpdateStreamingDistribution2016_01_28Request&& request) const;
+
+        /**
+         * Same as UpdateStreamingDistribution2016_01_28Async(const Model::UpdateStreamingDistribution2016_01_28Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateStreamingDistribution2016_01_28Async(Model::UpdateStreamingDistribution2016_01_28Request&& request, const UpdateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CreateCloudFrontOriginAccessIdentity2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request, Model::CreateCloudFrontOriginAccessIdentity2016_01_28Outcome> CreateCloudFrontOriginAccessIdentity2016_01_28Awaitable(Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of CreateDistribution2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::CreateDistribution2016_01_28Request, Model::CreateDistribution2016_01_28Outcome> CreateDistribution2016_01_28Awaitable(Model::CreateDistribution2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of CreateInvalidation2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::CreateInvalidation2016_01_28Request, Model::CreateInvalidation2016_01_28Outcome> CreateInvalidation2016_01_28Awaitable(Model::CreateInvalidation2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of CreateStreamingDistribution2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::CreateStreamingDistribution2016_01_28Request, Model::CreateStreamingDistribution2016_01_28Outcome> CreateStreamingDistribution2016_01_28Awaitable(Model::CreateStreamingDistribution2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of DeleteCloudFrontOriginAccessIdentity2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request, Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome> DeleteCloudFrontOriginAccessIdentity2016_01_28Awaitable(Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of DeleteDistribution2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::DeleteDistribution2016_01_28Request, Model::DeleteDistribution2016_01_28Outcome> DeleteDistribution2016_01_28Awaitable(Model::DeleteDistribution2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of DeleteStreamingDistribution2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::DeleteStreamingDistribution2016_01_28Request, Model::DeleteStreamingDistribution2016_01_28Outcome> DeleteStreamingDistribution2016_01_28Awaitable(Model::DeleteStreamingDistribution2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of GetCloudFrontOriginAccessIdentity2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::GetCloudFrontOriginAccessIdentity2016_01_28Request, Model::GetCloudFrontOriginAccessIdentity2016_01_28Outcome> GetCloudFrontOriginAccessIdentity2016_01_28Awaitable(Model::GetCloudFrontOriginAccessIdentity2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of GetCloudFrontOriginAccessIdentityConfig2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request, Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome> GetCloudFrontOriginAccessIdentityConfig2016_01_28Awaitable(Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of GetDistribution2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::GetDistribution2016_01_28Request, Model::GetDistribution2016_01_28Outcome> GetDistribution2016_01_28Awaitable(Model::GetDistribution2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of GetDistributionConfig2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::GetDistributionConfig2016_01_28Request, Model::GetDistributionConfig2016_01_28Outcome> GetDistributionConfig2016_01_28Awaitable(Model::GetDistributionConfig2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of GetInvalidation2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::GetInvalidation2016_01_28Request, Model::GetInvalidation2016_01_28Outcome> GetInvalidation2016_01_28Awaitable(Model::GetInvalidation2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of GetStreamingDistribution2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::GetStreamingDistribution2016_01_28Request, Model::GetStreamingDistribution2016_01_28Outcome> GetStreamingDistribution2016_01_28Awaitable(Model::GetStreamingDistribution2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of GetStreamingDistributionConfig2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::GetStreamingDistributionConfig2016_01_28Request, Model::GetStreamingDistributionConfig2016_01_28Outcome> GetStreamingDistributionConfig2016_01_28Awaitable(Model::GetStreamingDistributionConfig2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of ListCloudFrontOriginAccessIdentities2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::ListCloudFrontOriginAccessIdentities2016_01_28Request, Model::ListCloudFrontOriginAccessIdentities2016_01_28Outcome> ListCloudFrontOriginAccessIdentities2016_01_28Awaitable(Model::ListCloudFrontOriginAccessIdentities2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of ListDistributions2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::ListDistributions2016_01_28Request, Model::ListDistributions2016_01_28Outcome> ListDistributions2016_01_28Awaitable(Model::ListDistributions2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of ListDistributionsByWebACLId2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::ListDistributionsByWebACLId2016_01_28Request, Model::ListDistributionsByWebACLId2016_01_28Outcome> ListDistributionsByWebACLId2016_01_28Awaitable(Model::ListDistributionsByWebACLId2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of ListInvalidations2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::ListInvalidations2016_01_28Request, Model::ListInvalidations2016_01_28Outcome> ListInvalidations2016_01_28Awaitable(Model::ListInvalidations2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of ListStreamingDistributions2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::ListStreamingDistributions2016_01_28Request, Model::ListStreamingDistributions2016_01_28Outcome> ListStreamingDistributions2016_01_28Awaitable(Model::ListStreamingDistributions2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of UpdateCloudFrontOriginAccessIdentity2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request, Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome> UpdateCloudFrontOriginAccessIdentity2016_01_28Awaitable(Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of UpdateDistribution2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::UpdateDistribution2016_01_28Request, Model::UpdateDistribution2016_01_28Outcome> UpdateDistribution2016_01_28Awaitable(Model::UpdateDistribution2016_01_28Request request) const;
+
+        /**
+         * co_await-able form of UpdateStreamingDistribution2016_01_28(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudFrontClient, Model::UpdateStreamingDistribution2016_01_28Request, Model::UpdateStreamingDistribution2016_01_28Outcome> UpdateStreamingDistribution2016_01_28Awaitable(Model::UpdateStreamingDistribution2016_01_28Request request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateInvalidation2016_01_28Request();
+    inline const char* GetServiceRequestName() const override { return "CreateInvalidation2016_01_28"; }
+
     Aws::String SerializePayload() const override;
 
     /**
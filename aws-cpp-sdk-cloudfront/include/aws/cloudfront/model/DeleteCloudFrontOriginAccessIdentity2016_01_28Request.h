@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteCloudFrontOriginAccessIdentity2016_01_28Request();
+    inline const char* GetServiceRequestName() const override { return "DeleteCloudFrontOriginAccessIdentity2016_01_28"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
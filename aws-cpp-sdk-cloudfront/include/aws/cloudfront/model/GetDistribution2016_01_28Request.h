@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetDistribution2016_01_28Request();
+    inline const char* GetServiceRequestName() const override { return "GetDistribution2016_01_28"; }
+
     Aws::String SerializePayload() const override;
 
     /**
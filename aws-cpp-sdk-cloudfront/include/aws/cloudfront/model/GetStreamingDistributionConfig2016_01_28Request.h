@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetStreamingDistributionConfig2016_01_28Request();
+    inline const char* GetServiceRequestName() const override { return "GetStreamingDistributionConfig2016_01_28"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListDistributions2016_01_28Request();
+    inline const char* GetServiceRequestName() const override { return "ListDistributions2016_01_28"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     ListDistributionsByWebACLId2016_01_28Request();
+    inline const char* GetServiceRequestName() const override { return "ListDistributionsByWebACLId2016_01_28"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateCloudFrontOriginAccessIdentity2016_01_28Request();
+    inline const char* GetServiceRequestName() const override { return "UpdateCloudFrontOriginAccessIdentity2016_01_28"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
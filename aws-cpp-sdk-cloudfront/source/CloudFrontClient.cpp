@@ -131,7 +131,7 @@ CreateCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::CreateCl
 
 CreateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28Callable(const CreateCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateCloudFrontOriginAccessIdentity2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateCloudFrontOriginAccessIdentity2016_01_28( request ); } );
 }
 
 void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28Async(const CreateCloudFrontOriginAccessIdentity2016_01_28Request& request, const CreateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -139,6 +139,16 @@ void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28Async(const
   m_executor->Submit( [this, request, handler, context](){ this->CreateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+CreateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28Callable(CreateCloudFrontOriginAccessIdentity2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28Async(CreateCloudFrontOriginAccessIdentity2016_01_28Request&& request, const CreateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const CreateCloudFrontOriginAccessIdentity2016_01_28Request& request, const CreateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateCloudFrontOriginAccessIdentity2016_01_28(request), context);
@@ -161,7 +171,7 @@ CreateDistribution2016_01_28Outcome CloudFrontClient::CreateDistribution2016_01_
 
 CreateDistribution2016_01_28OutcomeCallable CloudFrontClient::CreateDistribution2016_01_28Callable(const CreateDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDistribution2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDistribution2016_01_28( request ); } );
 }
 
 void CloudFrontClient::CreateDistribution2016_01_28Async(const CreateDistribution2016_01_28Request& request, const CreateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -169,6 +179,16 @@ void CloudFrontClient::CreateDistribution2016_01_28Async(const CreateDistributio
   m_executor->Submit( [this, request, handler, context](){ this->CreateDistribution2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+CreateDistribution2016_01_28OutcomeCallable CloudFrontClient::CreateDistribution2016_01_28Callable(CreateDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::CreateDistribution2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::CreateDistribution2016_01_28Async(CreateDistribution2016_01_28Request&& request, const CreateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::CreateDistribution2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::CreateDistribution2016_01_28AsyncHelper(const CreateDistribution2016_01_28Request& request, const CreateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDistribution2016_01_28(request), context);
@@ -193,7 +213,7 @@ CreateInvalidation2016_01_28Outcome CloudFrontClient::CreateInvalidation2016_01_
 
 CreateInvalidation2016_01_28OutcomeCallable CloudFrontClient::CreateInvalidation2016_01_28Callable(const CreateInvalidation2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateInvalidation2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateInvalidation2016_01_28( request ); } );
 }
 
 void CloudFrontClient::CreateInvalidation2016_01_28Async(const CreateInvalidation2016_01_28Request& request, const CreateInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -201,6 +221,16 @@ void CloudFrontClient::CreateInvalidation2016_01_28Async(const CreateInvalidatio
   m_executor->Submit( [this, request, handler, context](){ this->CreateInvalidation2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+CreateInvalidation2016_01_28OutcomeCallable CloudFrontClient::CreateInvalidation2016_01_28Callable(CreateInvalidation2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::CreateInvalidation2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::CreateInvalidation2016_01_28Async(CreateInvalidation2016_01_28Request&& request, const CreateInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::CreateInvalidation2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::CreateInvalidation2016_01_28AsyncHelper(const CreateInvalidation2016_01_28Request& request, const CreateInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateInvalidation2016_01_28(request), context);
@@ -223,7 +253,7 @@ CreateStreamingDistribution2016_01_28Outcome CloudFrontClient::CreateStreamingDi
 
 CreateStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::CreateStreamingDistribution2016_01_28Callable(const CreateStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateStreamingDistribution2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateStreamingDistribution2016_01_28( request ); } );
 }
 
 void CloudFrontClient::CreateStreamingDistribution2016_01_28Async(const CreateStreamingDistribution2016_01_28Request& request, const CreateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -231,6 +261,16 @@ void CloudFrontClient::CreateStreamingDistribution2016_01_28Async(const CreateSt
   m_executor->Submit( [this, request, handler, context](){ this->CreateStreamingDistribution2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+CreateStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::CreateStreamingDistribution2016_01_28Callable(CreateStreamingDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::CreateStreamingDistribution2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::CreateStreamingDistribution2016_01_28Async(CreateStreamingDistribution2016_01_28Request&& request, const CreateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::CreateStreamingDistribution2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::CreateStreamingDistribution2016_01_28AsyncHelper(const CreateStreamingDistribution2016_01_28Request& request, const CreateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateStreamingDistribution2016_01_28(request), context);
@@ -254,7 +294,7 @@ DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::DeleteCl
 
 DeleteCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28Callable(const DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteCloudFrontOriginAccessIdentity2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteCloudFrontOriginAccessIdentity2016_01_28( request ); } );
 }
 
 void CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28Async(const DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request, const DeleteCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -262,6 +302,16 @@ void CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28Async(const
   m_executor->Submit( [this, request, handler, context](){ this->DeleteCloudFrontOriginAccessIdentity2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+DeleteCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28Callable(DeleteCloudFrontOriginAccessIdentity2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28Async(DeleteCloudFrontOriginAccessIdentity2016_01_28Request&& request, const DeleteCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request, const DeleteCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteCloudFrontOriginAccessIdentity2016_01_28(request), context);
@@ -285,7 +335,7 @@ DeleteDistribution2016_01_28Outcome CloudFrontClient::DeleteDistribution2016_01_
 
 DeleteDistribution2016_01_28OutcomeCallable CloudFrontClient::DeleteDistribution2016_01_28Callable(const DeleteDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDistribution2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDistribution2016_01_28( request ); } );
 }
 
 void CloudFrontClient::DeleteDistribution2016_01_28Async(const DeleteDistribution2016_01_28Request& request, const DeleteDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -293,6 +343,16 @@ void CloudFrontClient::DeleteDistribution2016_01_28Async(const DeleteDistributio
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDistribution2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+DeleteDistribution2016_01_28OutcomeCallable CloudFrontClient::DeleteDistribution2016_01_28Callable(DeleteDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::DeleteDistribution2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::DeleteDistribution2016_01_28Async(DeleteDistribution2016_01_28Request&& request, const DeleteDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::DeleteDistribution2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::DeleteDistribution2016_01_28AsyncHelper(const DeleteDistribution2016_01_28Request& request, const DeleteDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDistribution2016_01_28(request), context);
@@ -316,7 +376,7 @@ DeleteStreamingDistribution2016_01_28Outcome CloudFrontClient::DeleteStreamingDi
 
 DeleteStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::DeleteStreamingDistribution2016_01_28Callable(const DeleteStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteStreamingDistribution2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteStreamingDistribution2016_01_28( request ); } );
 }
 
 void CloudFrontClient::DeleteStreamingDistribution2016_01_28Async(const DeleteStreamingDistribution2016_01_28Request& request, const DeleteStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -324,6 +384,16 @@ void CloudFrontClient::DeleteStreamingDistribution2016_01_28Async(const DeleteSt
   m_executor->Submit( [this, request, handler, context](){ this->DeleteStreamingDistribution2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+DeleteStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::DeleteStreamingDistribution2016_01_28Callable(DeleteStreamingDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::DeleteStreamingDistribution2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::DeleteStreamingDistribution2016_01_28Async(DeleteStreamingDistribution2016_01_28Request&& request, const DeleteStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::DeleteStreamingDistribution2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::DeleteStreamingDistribution2016_01_28AsyncHelper(const DeleteStreamingDistribution2016_01_28Request& request, const DeleteStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteStreamingDistribution2016_01_28(request), context);
@@ -347,7 +417,7 @@ GetCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::GetCloudFro
 
 GetCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28Callable(const GetCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetCloudFrontOriginAccessIdentity2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetCloudFrontOriginAccessIdentity2016_01_28( request ); } );
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28Async(const GetCloudFrontOriginAccessIdentity2016_01_28Request& request, const GetCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -355,6 +425,16 @@ void CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28Async(const Ge
   m_executor->Submit( [this, request, handler, context](){ this->GetCloudFrontOriginAccessIdentity2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+GetCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28Callable(GetCloudFrontOriginAccessIdentity2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28Async(GetCloudFrontOriginAccessIdentity2016_01_28Request&& request, const GetCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const GetCloudFrontOriginAccessIdentity2016_01_28Request& request, const GetCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetCloudFrontOriginAccessIdentity2016_01_28(request), context);
@@ -379,7 +459,7 @@ GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome CloudFrontClient::GetCl
 
 GetCloudFrontOriginAccessIdentityConfig2016_01_28OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28Callable(const GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetCloudFrontOriginAccessIdentityConfig2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetCloudFrontOriginAccessIdentityConfig2016_01_28( request ); } );
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28Async(const GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request, const GetCloudFrontOriginAccessIdentityConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -387,6 +467,16 @@ void CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28Async(co
   m_executor->Submit( [this, request, handler, context](){ this->GetCloudFrontOriginAccessIdentityConfig2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+GetCloudFrontOriginAccessIdentityConfig2016_01_28OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28Callable(GetCloudFrontOriginAccessIdentityConfig2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28Async(GetCloudFrontOriginAccessIdentityConfig2016_01_28Request&& request, const GetCloudFrontOriginAccessIdentityConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28AsyncHelper(const GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request, const GetCloudFrontOriginAccessIdentityConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetCloudFrontOriginAccessIdentityConfig2016_01_28(request), context);
@@ -410,7 +500,7 @@ GetDistribution2016_01_28Outcome CloudFrontClient::GetDistribution2016_01_28(con
 
 GetDistribution2016_01_28OutcomeCallable CloudFrontClient::GetDistribution2016_01_28Callable(const GetDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDistribution2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDistribution2016_01_28( request ); } );
 }
 
 void CloudFrontClient::GetDistribution2016_01_28Async(const GetDistribution2016_01_28Request& request, const GetDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -418,6 +508,16 @@ void CloudFrontClient::GetDistribution2016_01_28Async(const GetDistribution2016_
   m_executor->Submit( [this, request, handler, context](){ this->GetDistribution2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+GetDistribution2016_01_28OutcomeCallable CloudFrontClient::GetDistribution2016_01_28Callable(GetDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::GetDistribution2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::GetDistribution2016_01_28Async(GetDistribution2016_01_28Request&& request, const GetDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::GetDistribution2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::GetDistribution2016_01_28AsyncHelper(const GetDistribution2016_01_28Request& request, const GetDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDistribution2016_01_28(request), context);
@@ -442,7 +542,7 @@ GetDistributionConfig2016_01_28Outcome CloudFrontClient::GetDistributionConfig20
 
 GetDistributionConfig2016_01_28OutcomeCallable CloudFrontClient::GetDistributionConfig2016_01_28Callable(const GetDistributionConfig2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDistributionConfig2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDistributionConfig2016_01_28( request ); } );
 }
 
 void CloudFrontClient::GetDistributionConfig2016_01_28Async(const GetDistributionConfig2016_01_28Request& request, const GetDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -450,6 +550,16 @@ void CloudFrontClient::GetDistributionConfig2016_01_28Async(const GetDistributio
   m_executor->Submit( [this, request, handler, context](){ this->GetDistributionConfig2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+GetDistributionConfig2016_01_28OutcomeCallable CloudFrontClient::GetDistributionConfig2016_01_28Callable(GetDistributionConfig2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::GetDistributionConfig2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::GetDistributionConfig2016_01_28Async(GetDistributionConfig2016_01_28Request&& request, const GetDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::GetDistributionConfig2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::GetDistributionConfig2016_01_28AsyncHelper(const GetDistributionConfig2016_01_28Request& request, const GetDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDistributionConfig2016_01_28(request), context);
@@ -475,7 +585,7 @@ GetInvalidation2016_01_28Outcome CloudFrontClient::GetInvalidation2016_01_28(con
 
 GetInvalidation2016_01_28OutcomeCallable CloudFrontClient::GetInvalidation2016_01_28Callable(const GetInvalidation2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetInvalidation2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetInvalidation2016_01_28( request ); } );
 }
 
 void CloudFrontClient::GetInvalidation2016_01_28Async(const GetInvalidation2016_01_28Request& request, const GetInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -483,6 +593,16 @@ void CloudFrontClient::GetInvalidation2016_01_28Async(const GetInvalidation2016_
   m_executor->Submit( [this, request, handler, context](){ this->GetInvalidation2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+GetInvalidation2016_01_28OutcomeCallable CloudFrontClient::GetInvalidation2016_01_28Callable(GetInvalidation2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::GetInvalidation2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::GetInvalidation2016_01_28Async(GetInvalidation2016_01_28Request&& request, const GetInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::GetInvalidation2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::GetInvalidation2016_01_28AsyncHelper(const GetInvalidation2016_01_28Request& request, const GetInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetInvalidation2016_01_28(request), context);
@@ -506,7 +626,7 @@ GetStreamingDistribution2016_01_28Outcome CloudFrontClient::GetStreamingDistribu
 
 GetStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::GetStreamingDistribution2016_01_28Callable(const GetStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetStreamingDistribution2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetStreamingDistribution2016_01_28( request ); } );
 }
 
 void CloudFrontClient::GetStreamingDistribution2016_01_28Async(const GetStreamingDistribution2016_01_28Request& request, const GetStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -514,6 +634,16 @@ void CloudFrontClient::GetStreamingDistribution2016_01_28Async(const GetStreamin
   m_executor->Submit( [this, request, handler, context](){ this->GetStreamingDistribution2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+GetStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::GetStreamingDistribution2016_01_28Callable(GetStreamingDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::GetStreamingDistribution2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::GetStreamingDistribution2016_01_28Async(GetStreamingDistribution2016_01_28Request&& request, const GetStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::GetStreamingDistribution2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::GetStreamingDistribution2016_01_28AsyncHelper(const GetStreamingDistribution2016_01_28Request& request, const GetStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetStreamingDistribution2016_01_28(request), context);
@@ -538,7 +668,7 @@ GetStreamingDistributionConfig2016_01_28Outcome CloudFrontClient::GetStreamingDi
 
 GetStreamingDistributionConfig2016_01_28OutcomeCallable CloudFrontClient::GetStreamingDistributionConfig2016_01_28Callable(const GetStreamingDistributionConfig2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetStreamingDistributionConfig2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetStreamingDistributionConfig2016_01_28( request ); } );
 }
 
 void CloudFrontClient::GetStreamingDistributionConfig2016_01_28Async(const GetStreamingDistributionConfig2016_01_28Request& request, const GetStreamingDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -546,6 +676,16 @@ void CloudFrontClient::GetStreamingDistributionConfig2016_01_28Async(const GetSt
   m_executor->Submit( [this, request, handler, context](){ this->GetStreamingDistributionConfig2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+GetStreamingDistributionConfig2016_01_28OutcomeCallable CloudFrontClient::GetStreamingDistributionConfig2016_01_28Callable(GetStreamingDistributionConfig2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::GetStreamingDistributionConfig2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::GetStreamingDistributionConfig2016_01_28Async(GetStreamingDistributionConfig2016_01_28Request&& request, const GetStreamingDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::GetStreamingDistributionConfig2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::GetStreamingDistributionConfig2016_01_28AsyncHelper(const GetStreamingDistributionConfig2016_01_28Request& request, const GetStreamingDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetStreamingDistributionConfig2016_01_28(request), context);
@@ -568,7 +708,7 @@ ListCloudFrontOriginAccessIdentities2016_01_28Outcome CloudFrontClient::ListClou
 
 ListCloudFrontOriginAccessIdentities2016_01_28OutcomeCallable CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28Callable(const ListCloudFrontOriginAccessIdentities2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListCloudFrontOriginAccessIdentities2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListCloudFrontOriginAccessIdentities2016_01_28( request ); } );
 }
 
 void CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28Async(const ListCloudFrontOriginAccessIdentities2016_01_28Request& request, const ListCloudFrontOriginAccessIdentities2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -576,6 +716,16 @@ void CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28Async(const
   m_executor->Submit( [this, request, handler, context](){ this->ListCloudFrontOriginAccessIdentities2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+ListCloudFrontOriginAccessIdentities2016_01_28OutcomeCallable CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28Callable(ListCloudFrontOriginAccessIdentities2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28Async(ListCloudFrontOriginAccessIdentities2016_01_28Request&& request, const ListCloudFrontOriginAccessIdentities2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28AsyncHelper(const ListCloudFrontOriginAccessIdentities2016_01_28Request& request, const ListCloudFrontOriginAccessIdentities2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListCloudFrontOriginAccessIdentities2016_01_28(request), context);
@@ -598,7 +748,7 @@ ListDistributions2016_01_28Outcome CloudFrontClient::ListDistributions2016_01_28
 
 ListDistributions2016_01_28OutcomeCallable CloudFrontClient::ListDistributions2016_01_28Callable(const ListDistributions2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDistributions2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDistributions2016_01_28( request ); } );
 }
 
 void CloudFrontClient::ListDistributions2016_01_28Async(const ListDistributions2016_01_28Request& request, const ListDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -606,6 +756,16 @@ void CloudFrontClient::ListDistributions2016_01_28Async(const ListDistributions2
   m_executor->Submit( [this, request, handler, context](){ this->ListDistributions2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+ListDistributions2016_01_28OutcomeCallable CloudFrontClient::ListDistributions2016_01_28Callable(ListDistributions2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::ListDistributions2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::ListDistributions2016_01_28Async(ListDistributions2016_01_28Request&& request, const ListDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::ListDistributions2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::ListDistributions2016_01_28AsyncHelper(const ListDistributions2016_01_28Request& request, const ListDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDistributions2016_01_28(request), context);
@@ -629,7 +789,7 @@ ListDistributionsByWebACLId2016_01_28Outcome CloudFrontClient::ListDistributions
 
 ListDistributionsByWebACLId2016_01_28OutcomeCallable CloudFrontClient::ListDistributionsByWebACLId2016_01_28Callable(const ListDistributionsByWebACLId2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDistributionsByWebACLId2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDistributionsByWebACLId2016_01_28( request ); } );
 }
 
 void CloudFrontClient::ListDistributionsByWebACLId2016_01_28Async(const ListDistributionsByWebACLId2016_01_28Request& request, const ListDistributionsByWebACLId2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -637,6 +797,16 @@ void CloudFrontClient::ListDistributionsByWebACLId2016_01_28Async(const ListDist
   m_executor->Submit( [this, request, handler, context](){ this->ListDistributionsByWebACLId2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+ListDistributionsByWebACLId2016_01_28OutcomeCallable CloudFrontClient::ListDistributionsByWebACLId2016_01_28Callable(ListDistributionsByWebACLId2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::ListDistributionsByWebACLId2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::ListDistributionsByWebACLId2016_01_28Async(ListDistributionsByWebACLId2016_01_28Request&& request, const ListDistributionsByWebACLId2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::ListDistributionsByWebACLId2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::ListDistributionsByWebACLId2016_01_28AsyncHelper(const ListDistributionsByWebACLId2016_01_28Request& request, const ListDistributionsByWebACLId2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDistributionsByWebACLId2016_01_28(request), context);
@@ -661,7 +831,7 @@ ListInvalidations2016_01_28Outcome CloudFrontClient::ListInvalidations2016_01_28
 
 ListInvalidations2016_01_28OutcomeCallable CloudFrontClient::ListInvalidations2016_01_28Callable(const ListInvalidations2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListInvalidations2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListInvalidations2016_01_28( request ); } );
 }
 
 void CloudFrontClient::ListInvalidations2016_01_28Async(const ListInvalidations2016_01_28Request& request, const ListInvalidations2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -669,6 +839,16 @@ void CloudFrontClient::ListInvalidations2016_01_28Async(const ListInvalidations2
   m_executor->Submit( [this, request, handler, context](){ this->ListInvalidations2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+ListInvalidations2016_01_28OutcomeCallable CloudFrontClient::ListInvalidations2016_01_28Callable(ListInvalidations2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::ListInvalidations2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::ListInvalidations2016_01_28Async(ListInvalidations2016_01_28Request&& request, const ListInvalidations2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::ListInvalidations2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::ListInvalidations2016_01_28AsyncHelper(const ListInvalidations2016_01_28Request& request, const ListInvalidations2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListInvalidations2016_01_28(request), context);
@@ -691,7 +871,7 @@ ListStreamingDistributions2016_01_28Outcome CloudFrontClient::ListStreamingDistr
 
 ListStreamingDistributions2016_01_28OutcomeCallable CloudFrontClient::ListStreamingDistributions2016_01_28Callable(const ListStreamingDistributions2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListStreamingDistributions2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListStreamingDistributions2016_01_28( request ); } );
 }
 
 void CloudFrontClient::ListStreamingDistributions2016_01_28Async(const ListStreamingDistributions2016_01_28Request& request, const ListStreamingDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -699,6 +879,16 @@ void CloudFrontClient::ListStreamingDistributions2016_01_28Async(const ListStrea
   m_executor->Submit( [this, request, handler, context](){ this->ListStreamingDistributions2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+ListStreamingDistributions2016_01_28OutcomeCallable CloudFrontClient::ListStreamingDistributions2016_01_28Callable(ListStreamingDistributions2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::ListStreamingDistributions2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::ListStreamingDistributions2016_01_28Async(ListStreamingDistributions2016_01_28Request&& request, const ListStreamingDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::ListStreamingDistributions2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::ListStreamingDistributions2016_01_28AsyncHelper(const ListStreamingDistributions2016_01_28Request& request, const ListStreamingDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListStreamingDistributions2016_01_28(request), context);
@@ -723,7 +913,7 @@ UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::UpdateCl
 
 UpdateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28Callable(const UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateCloudFrontOriginAccessIdentity2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateCloudFrontOriginAccessIdentity2016_01_28( request ); } );
 }
 
 void CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28Async(const UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request, const UpdateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -731,6 +921,16 @@ void CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28Async(const
   m_executor->Submit( [this, request, handler, context](){ this->UpdateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+UpdateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28Callable(UpdateCloudFrontOriginAccessIdentity2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28Async(UpdateCloudFrontOriginAccessIdentity2016_01_28Request&& request, const UpdateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request, const UpdateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateCloudFrontOriginAccessIdentity2016_01_28(request), context);
@@ -755,7 +955,7 @@ UpdateDistribution2016_01_28Outcome CloudFrontClient::UpdateDistribution2016_01_
 
 UpdateDistribution2016_01_28OutcomeCallable CloudFrontClient::UpdateDistribution2016_01_28Callable(const UpdateDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateDistribution2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateDistribution2016_01_28( request ); } );
 }
 
 void CloudFrontClient::UpdateDistribution2016_01_28Async(const UpdateDistribution2016_01_28Request& request, const UpdateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -763,6 +963,16 @@ void CloudFrontClient::UpdateDistribution2016_01_28Async(const UpdateDistributio
   m_executor->Submit( [this, request, handler, context](){ this->UpdateDistribution2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+UpdateDistribution2016_01_28OutcomeCallable CloudFrontClient::UpdateDistribution2016_01_28Callable(UpdateDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::UpdateDistribution2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::UpdateDistribution2016_01_28Async(UpdateDistribution2016_01_28Request&& request, const UpdateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::UpdateDistribution2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::UpdateDistribution2016_01_28AsyncHelper(const UpdateDistribution2016_01_28Request& request, const UpdateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateDistribution2016_01_28(request), context);
@@ -787,7 +997,7 @@ UpdateStreamingDistribution2016_01_28Outcome CloudFrontClient::UpdateStreamingDi
 
 UpdateStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::UpdateStreamingDistribution2016_01_28Callable(const UpdateStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateStreamingDistribution2016_01_28( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateStreamingDistribution2016_01_28( request ); } );
 }
 
 void CloudFrontClient::UpdateStreamingDistribution2016_01_28Async(const UpdateStreamingDistribution2016_01_28Request& request, const UpdateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -795,8 +1005,130 @@ void CloudFrontClient::UpdateStreamingDistribution2016_01_28Async(const UpdateSt
   m_executor->Submit( [this, request, handler, context](){ this->UpdateStreamingDistribution2016_01_28AsyncHelper( request, handler, context ); } );
 }
 
+UpdateStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::UpdateStreamingDistribution2016_01_28Callable(UpdateStreamingDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudFrontClient::UpdateStreamingDistribution2016_01_28, this, std::move(request)));
+}
+
+void CloudFrontClient::UpdateStreamingDistribution2016_01_28Async(UpdateStreamingDistribution2016_01_28Request&& request, const UpdateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudFrontClient::UpdateStreamingDistribution2016_01_28AsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudFrontClient::UpdateStreamingDistribution2016_01_28AsyncHelper(const UpdateStreamingDistribution2016_01_28Request& request, const UpdateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateStreamingDistribution2016_01_28(request), context);
 }
 
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<CloudFrontClient, CreateCloudFrontOriginAccessIdentity2016_01_28Request, CreateCloudFrontOriginAccessIdentity2016_01_28Outcome> CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28Awaitable(CreateCloudFrontOriginAccessIdentity2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, CreateDistribution2016_01_28Request, CreateDistribution2016_01_28Outcome> CloudFrontClient::CreateDistribution2016_01_28Awaitable(CreateDistribution2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::CreateDistribution2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, CreateInvalidation2016_01_28Request, CreateInvalidation2016_01_28Outcome> CloudFrontClient::CreateInvalidation2016_01_28Awaitable(CreateInvalidation2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::CreateInvalidation2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, CreateStreamingDistribution2016_01_28Request, CreateStreamingDistribution2016_01_28Outcome> CloudFrontClient::CreateStreamingDistribution2016_01_28Awaitable(CreateStreamingDistribution2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::CreateStreamingDistribution2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, DeleteCloudFrontOriginAccessIdentity2016_01_28Request, DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome> CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28Awaitable(DeleteCloudFrontOriginAccessIdentity2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, DeleteDistribution2016_01_28Request, DeleteDistribution2016_01_28Outcome> CloudFrontClient::DeleteDistribution2016_01_28Awaitable(DeleteDistribution2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::DeleteDistribution2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, DeleteStreamingDistribution2016_01_28Request, DeleteStreamingDistribution2016_01_28Outcome> CloudFrontClient::DeleteStreamingDistribution2016_01_28Awaitable(DeleteStreamingDistribution2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::DeleteStreamingDistribution2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, GetCloudFrontOriginAccessIdentity2016_01_28Request, GetCloudFrontOriginAccessIdentity2016_01_28Outcome> CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28Awaitable(GetCloudFrontOriginAccessIdentity2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, GetCloudFrontOriginAccessIdentityConfig2016_01_28Request, GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome> CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28Awaitable(GetCloudFrontOriginAccessIdentityConfig2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, GetDistribution2016_01_28Request, GetDistribution2016_01_28Outcome> CloudFrontClient::GetDistribution2016_01_28Awaitable(GetDistribution2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::GetDistribution2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, GetDistributionConfig2016_01_28Request, GetDistributionConfig2016_01_28Outcome> CloudFrontClient::GetDistributionConfig2016_01_28Awaitable(GetDistributionConfig2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::GetDistributionConfig2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, GetInvalidation2016_01_28Request, GetInvalidation2016_01_28Outcome> CloudFrontClient::GetInvalidation2016_01_28Awaitable(GetInvalidation2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::GetInvalidation2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, GetStreamingDistribution2016_01_28Request, GetStreamingDistribution2016_01_28Outcome> CloudFrontClient::GetStreamingDistribution2016_01_28Awaitable(GetStreamingDistribution2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::GetStreamingDistribution2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, GetStreamingDistributionConfig2016_01_28Request, GetStreamingDistributionConfig2016_01_28Outcome> CloudFrontClient::GetStreamingDistributionConfig2016_01_28Awaitable(GetStreamingDistributionConfig2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::GetStreamingDistributionConfig2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, ListCloudFrontOriginAccessIdentities2016_01_28Request, ListCloudFrontOriginAccessIdentities2016_01_28Outcome> CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28Awaitable(ListCloudFrontOriginAccessIdentities2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, ListDistributions2016_01_28Request, ListDistributions2016_01_28Outcome> CloudFrontClient::ListDistributions2016_01_28Awaitable(ListDistributions2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::ListDistributions2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, ListDistributionsByWebACLId2016_01_28Request, ListDistributionsByWebACLId2016_01_28Outcome> CloudFrontClient::ListDistributionsByWebACLId2016_01_28Awaitable(ListDistributionsByWebACLId2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::ListDistributionsByWebACLId2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, ListInvalidations2016_01_28Request, ListInvalidations2016_01_28Outcome> CloudFrontClient::ListInvalidations2016_01_28Awaitable(ListInvalidations2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::ListInvalidations2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, ListStreamingDistributions2016_01_28Request, ListStreamingDistributions2016_01_28Outcome> CloudFrontClient::ListStreamingDistributions2016_01_28Awaitable(ListStreamingDistributions2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::ListStreamingDistributions2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, UpdateCloudFrontOriginAccessIdentity2016_01_28Request, UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome> CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28Awaitable(UpdateCloudFrontOriginAccessIdentity2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, UpdateDistribution2016_01_28Request, UpdateDistribution2016_01_28Outcome> CloudFrontClient::UpdateDistribution2016_01_28Awaitable(UpdateDistribution2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::UpdateDistribution2016_01_28, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudFrontClient, UpdateStreamingDistribution2016_01_28Request, UpdateStreamingDistribution2016_01_28Outcome> CloudFrontClient::UpdateStreamingDistribution2016_01_28Awaitable(UpdateStreamingDistribution2016_01_28Request request) const
+{
+  return { m_executor.get(), { this, &CloudFrontClient::UpdateStreamingDistribution2016_01_28, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -79,13 +79,13 @@ CacheBehavior& CacheBehavior::operator =(const XmlNode& xmlNode)
     XmlNode pathPatternNode = resultNode.FirstChild("PathPattern");
     if(!pathPatternNode.IsNull())
     {
-      m_pathPattern = StringUtils::Trim(pathPatternNode.GetText().c_str());
+      m_pathPattern = pathPatternNode.GetTextView().Trim().ToString();
       m_pathPatternHasBeenSet = true;
     }
     XmlNode targetOriginIdNode = resultNode.FirstChild("TargetOriginId");
     if(!targetOriginIdNode.IsNull())
     {
-      m_targetOriginId = StringUtils::Trim(targetOriginIdNode.GetText().c_str());
+      m_targetOriginId = targetOriginIdNode.GetTextView().Trim().ToString();
       m_targetOriginIdHasBeenSet = true;
     }
     XmlNode forwardedValuesNode = resultNode.FirstChild("ForwardedValues");
@@ -103,13 +103,13 @@ CacheBehavior& CacheBehavior::operator =(const XmlNode& xmlNode)
     XmlNode viewerProtocolPolicyNode = resultNode.FirstChild("ViewerProtocolPolicy");
     if(!viewerProtocolPolicyNode.IsNull())
     {
-      m_viewerProtocolPolicy = ViewerProtocolPolicyMapper::GetViewerProtocolPolicyForName(StringUtils::Trim(viewerProtocolPolicyNode.GetText().c_str()).c_str());
+      m_viewerProtocolPolicy = ViewerProtocolPolicyMapper::GetViewerProtocolPolicyForName(viewerProtocolPolicyNode.GetTextView().Trim().ToString().c_str());
       m_viewerProtocolPolicyHasBeenSet = true;
     }
     XmlNode minTTLNode = resultNode.FirstChild("MinTTL");
     if(!minTTLNode.IsNull())
     {
-      m_minTTL = StringUtils::ConvertToInt64(StringUtils::Trim(minTTLNode.GetText().c_str()).c_str());
+      m_minTTL = StringUtils::ConvertToInt64(minTTLNode.GetTextView().Trim().ToString().c_str());
       m_minTTLHasBeenSet = true;
     }
     XmlNode allowedMethodsNode = resultNode.FirstChild("AllowedMethods");
@@ -121,25 +121,25 @@ CacheBehavior& CacheBehavior::operator =(const XmlNode& xmlNode)
     XmlNode smoothStreamingNode = resultNode.FirstChild("SmoothStreaming");
     if(!smoothStreamingNode.IsNull())
     {
-      m_smoothStreaming = StringUtils::ConvertToBool(StringUtils::Trim(smoothStreamingNode.GetText().c_str()).c_str());
+      m_smoothStreaming = StringUtils::ConvertToBool(smoothStreamingNode.GetTextView().Trim().ToString().c_str());
       m_smoothStreamingHasBeenSet = true;
     }
     XmlNode defaultTTLNode = resultNode.FirstChild("DefaultTTL");
     if(!defaultTTLNode.IsNull())
     {
-      m_defaultTTL = StringUtils::ConvertToInt64(StringUtils::Trim(defaultTTLNode.GetText().c_str()).c_str());
+      m_defaultTTL = StringUtils::ConvertToInt64(defaultTTLNode.GetTextView().Trim().ToString().c_str());
       m_defaultTTLHasBeenSet = true;
     }
     XmlNode maxTTLNode = resultNode.FirstChild("MaxTTL");
     if(!maxTTLNode.IsNull())
     {
-      m_maxTTL = StringUtils::ConvertToInt64(StringUtils::Trim(maxTTLNode.GetText().c_str()).c_str());
+      m_maxTTL = StringUtils::ConvertToInt64(maxTTLNode.GetTextView().Trim().ToString().c_str());
       m_maxTTLHasBeenSet = true;
     }
     XmlNode compressNode = resultNode.FirstChild("Compress");
     if(!compressNode.IsNull())
     {
-      m_compress = StringUtils::ConvertToBool(StringUtils::Trim(compressNode.GetText().c_str()).c_str());
+      m_compress = StringUtils::ConvertToBool(compressNode.GetTextView().Trim().ToString().c_str());
       m_compressHasBeenSet = true;
     }
   }
@@ -53,7 +53,7 @@ CachedMethods& CachedMethods::operator =(const XmlNode& xmlNode)
     XmlNode quantityNode = resultNode.FirstChild("Quantity");
     if(!quantityNode.IsNull())
     {
-      m_quantity = StringUtils::ConvertToInt32(StringUtils::Trim(quantityNode.GetText().c_str()).c_str());
+      m_quantity = StringUtils::ConvertToInt32(quantityNode.GetTextView().Trim().ToString().c_str());
       m_quantityHasBeenSet = true;
     }
     XmlNode itemsNode = resultNode.FirstChild("Items");
@@ -62,7 +62,7 @@ CachedMethods& CachedMethods::operator =(const XmlNode& xmlNode)
       XmlNode itemsMember = itemsNode.FirstChild("Method");
       while(!itemsMember.IsNull())
       {
-        m_items.push_back(MethodMapper::GetMethodForName(StringUtils::Trim(itemsMember.GetText().c_str())));
+        m_items.push_back(MethodMapper::GetMethodForName(itemsMember.GetTextView().Trim().ToString()));
         itemsMember = itemsMember.NextNode("Method");
       }
 
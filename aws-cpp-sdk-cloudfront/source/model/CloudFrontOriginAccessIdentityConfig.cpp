@@ -51,13 +51,13 @@ CloudFrontOriginAccessIdentityConfig& CloudFrontOriginAccessIdentityConfig::oper
     XmlNode callerReferenceNode = resultNode.FirstChild("CallerReference");
     if(!callerReferenceNode.IsNull())
     {
-      m_callerReference = StringUtils::Trim(callerReferenceNode.GetText().c_str());
+      m_callerReference = callerReferenceNode.GetTextView().Trim().ToString();
       m_callerReferenceHasBeenSet = true;
     }
     XmlNode commentNode = resultNode.FirstChild("Comment");
     if(!commentNode.IsNull())
     {
-      m_comment = StringUtils::Trim(commentNode.GetText().c_str());
+      m_comment = commentNode.GetTextView().Trim().ToString();
       m_commentHasBeenSet = true;
     }
   }
@@ -53,19 +53,19 @@ CloudFrontOriginAccessIdentitySummary& CloudFrontOriginAccessIdentitySummary::op
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode s3CanonicalUserIdNode = resultNode.FirstChild("S3CanonicalUserId");
     if(!s3CanonicalUserIdNode.IsNull())
     {
-      m_s3CanonicalUserId = StringUtils::Trim(s3CanonicalUserIdNode.GetText().c_str());
+      m_s3CanonicalUserId = s3CanonicalUserIdNode.GetTextView().Trim().ToString();
       m_s3CanonicalUserIdHasBeenSet = true;
     }
     XmlNode commentNode = resultNode.FirstChild("Comment");
     if(!commentNode.IsNull())
     {
-      m_comment = StringUtils::Trim(commentNode.GetText().c_str());
+      m_comment = commentNode.GetTextView().Trim().ToString();
       m_commentHasBeenSet = true;
     }
   }
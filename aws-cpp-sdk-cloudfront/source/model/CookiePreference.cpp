@@ -51,7 +51,7 @@ CookiePreference& CookiePreference::operator =(const XmlNode& xmlNode)
     XmlNode forwardNode = resultNode.FirstChild("Forward");
     if(!forwardNode.IsNull())
     {
-      m_forward = ItemSelectionMapper::GetItemSelectionForName(StringUtils::Trim(forwardNode.GetText().c_str()).c_str());
+      m_forward = ItemSelectionMapper::GetItemSelectionForName(forwardNode.GetTextView().Trim().ToString().c_str());
       m_forwardHasBeenSet = true;
     }
     XmlNode whitelistedNamesNode = resultNode.FirstChild("WhitelistedNames");
@@ -59,25 +59,25 @@ CustomErrorResponse& CustomErrorResponse::operator =(const XmlNode& xmlNode)
     XmlNode errorCodeNode = resultNode.FirstChild("ErrorCode");
     if(!errorCodeNode.IsNull())
     {
-      m_errorCode = StringUtils::ConvertToInt32(StringUtils::Trim(errorCodeNode.GetText().c_str()).c_str());
+      m_errorCode = StringUtils::ConvertToInt32(errorCodeNode.GetTextView().Trim().ToString().c_str());
       m_errorCodeHasBeenSet = true;
     }
     XmlNode responsePagePathNode = resultNode.FirstChild("ResponsePagePath");
     if(!responsePagePathNode.IsNull())
     {
-      m_responsePagePath = StringUtils::Trim(responsePagePathNode.GetText().c_str());
+      m_responsePagePath = responsePagePathNode.GetTextView().Trim().ToString();
       m_responsePagePathHasBeenSet = true;
     }
     XmlNode responseCodeNode = resultNode.FirstChild("ResponseCode");
     if(!responseCodeNode.IsNull())
     {
-      m_responseCode = StringUtils::Trim(responseCodeNode.GetText().c_str());
+      m_responseCode = responseCodeNode.GetTextView().Trim().ToString();
       m_responseCodeHasBeenSet = true;
     }
     XmlNode errorCachingMinTTLNode = resultNode.FirstChild("ErrorCachingMinTTL");
     if(!errorCachingMinTTLNode.IsNull())
     {
-      m_errorCachingMinTTL = StringUtils::ConvertToInt64(StringUtils::Trim(errorCachingMinTTLNode.GetText().c_str()).c_str());
+      m_errorCachingMinTTL = StringUtils::ConvertToInt64(errorCachingMinTTLNode.GetTextView().Trim().ToString().c_str());
       m_errorCachingMinTTLHasBeenSet = true;
     }
   }
@@ -59,19 +59,19 @@ CustomOriginConfig& CustomOriginConfig::operator =(const XmlNode& xmlNode)
     XmlNode hTTPPortNode = resultNode.FirstChild("HTTPPort");
     if(!hTTPPortNode.IsNull())
     {
-      m_hTTPPort = StringUtils::ConvertToInt32(StringUtils::Trim(hTTPPortNode.GetText().c_str()).c_str());
+      m_hTTPPort = StringUtils::ConvertToInt32(hTTPPortNode.GetTextView().Trim().ToString().c_str());
       m_hTTPPortHasBeenSet = true;
     }
     XmlNode hTTPSPortNode = resultNode.FirstChild("HTTPSPort");
     if(!hTTPSPortNode.IsNull())
     {
-      m_hTTPSPort = StringUtils::ConvertToInt32(StringUtils::Trim(hTTPSPortNode.GetText().c_str()).c_str());
+      m_hTTPSPort = StringUtils::ConvertToInt32(hTTPSPortNode.GetTextView().Trim().ToString().c_str());
       m_hTTPSPortHasBeenSet = true;
     }
     XmlNode originProtocolPolicyNode = resultNode.FirstChild("OriginProtocolPolicy");
     if(!originProtocolPolicyNode.IsNull())
     {
-      m_originProtocolPolicy = OriginProtocolPolicyMapper::GetOriginProtocolPolicyForName(StringUtils::Trim(originProtocolPolicyNode.GetText().c_str()).c_str());
+      m_originProtocolPolicy = OriginProtocolPolicyMapper::GetOriginProtocolPolicyForName(originProtocolPolicyNode.GetTextView().Trim().ToString().c_str());
       m_originProtocolPolicyHasBeenSet = true;
     }
     XmlNode originSslProtocolsNode = resultNode.FirstChild("OriginSslProtocols");
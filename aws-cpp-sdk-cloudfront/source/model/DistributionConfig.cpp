@@ -77,7 +77,7 @@ DistributionConfig& DistributionConfig::operator =(const XmlNode& xmlNode)
     XmlNode callerReferenceNode = resultNode.FirstChild("CallerReference");
     if(!callerReferenceNode.IsNull())
     {
-      m_callerReference = StringUtils::Trim(callerReferenceNode.GetText().c_str());
+      m_callerReference = callerReferenceNode.GetTextView().Trim().ToString();
       m_callerReferenceHasBeenSet = true;
     }
     XmlNode aliasesNode = resultNode.FirstChild("Aliases");
@@ -89,7 +89,7 @@ DistributionConfig& DistributionConfig::operator =(const XmlNode& xmlNode)
     XmlNode defaultRootObjectNode = resultNode.FirstChild("DefaultRootObject");
     if(!defaultRootObjectNode.IsNull())
     {
-      m_defaultRootObject = StringUtils::Trim(defaultRootObjectNode.GetText().c_str());
+      m_defaultRootObject = defaultRootObjectNode.GetTextView().Trim().ToString();
       m_defaultRootObjectHasBeenSet = true;
     }
     XmlNode originsNode = resultNode.FirstChild("Origins");
@@ -119,7 +119,7 @@ DistributionConfig& DistributionConfig::operator =(const XmlNode& xmlNode)
     XmlNode commentNode = resultNode.FirstChild("Comment");
     if(!commentNode.IsNull())
     {
-      m_comment = StringUtils::Trim(commentNode.GetText().c_str());
+      m_comment = commentNode.GetTextView().Trim().ToString();
       m_commentHasBeenSet = true;
     }
     XmlNode loggingNode = resultNode.FirstChild("Logging");
@@ -131,13 +131,13 @@ DistributionConfig& DistributionConfig::operator =(const XmlNode& xmlNode)
     XmlNode priceClassNode = resultNode.FirstChild("PriceClass");
     if(!priceClassNode.IsNull())
     {
-      m_priceClass = PriceClassMapper::GetPriceClassForName(StringUtils::Trim(priceClassNode.GetText().c_str()).c_str());
+      m_priceClass = PriceClassMapper::GetPriceClassForName(priceClassNode.GetTextView().Trim().ToString().c_str());
       m_priceClassHasBeenSet = true;
     }
     XmlNode enabledNode = resultNode.FirstChild("Enabled");
     if(!enabledNode.IsNull())
     {
-      m_enabled = StringUtils::ConvertToBool(StringUtils::Trim(enabledNode.GetText().c_str()).c_str());
+      m_enabled = StringUtils::ConvertToBool(enabledNode.GetTextView().Trim().ToString().c_str());
       m_enabledHasBeenSet = true;
     }
     XmlNode viewerCertificateNode = resultNode.FirstChild("ViewerCertificate");
@@ -155,7 +155,7 @@ DistributionConfig& DistributionConfig::operator =(const XmlNode& xmlNode)
     XmlNode webACLIdNode = resultNode.FirstChild("WebACLId");
     if(!webACLIdNode.IsNull())
     {
-      m_webACLId = StringUtils::Trim(webACLIdNode.GetText().c_str());
+      m_webACLId = webACLIdNode.GetTextView().Trim().ToString();
       m_webACLIdHasBeenSet = true;
     }
   }
@@ -55,13 +55,13 @@ GeoRestriction& GeoRestriction::operator =(const XmlNode& xmlNode)
     XmlNode restrictionTypeNode = resultNode.FirstChild("RestrictionType");
     if(!restrictionTypeNode.IsNull())
     {
-      m_restrictionType = GeoRestrictionTypeMapper::GetGeoRestrictionTypeForName(StringUtils::Trim(restrictionTypeNode.GetText().c_str()).c_str());
+      m_restrictionType = GeoRestrictionTypeMapper::GetGeoRestrictionTypeForName(restrictionTypeNode.GetTextView().Trim().ToString().c_str());
       m_restrictionTypeHasBeenSet = true;
     }
     XmlNode quantityNode = resultNode.FirstChild("Quantity");
     if(!quantityNode.IsNull())
     {
-      m_quantity = StringUtils::ConvertToInt32(StringUtils::Trim(quantityNode.GetText().c_str()).c_str());
+      m_quantity = StringUtils::ConvertToInt32(quantityNode.GetTextView().Trim().ToString().c_str());
       m_quantityHasBeenSet = true;
     }
     XmlNode itemsNode = resultNode.FirstChild("Items");
@@ -70,7 +70,7 @@ GeoRestriction& GeoRestriction::operator =(const XmlNode& xmlNode)
       XmlNode itemsMember = itemsNode.FirstChild("Location");
       while(!itemsMember.IsNull())
       {
-        m_items.push_back(StringUtils::Trim(itemsMember.GetText().c_str()));
+        m_items.push_back(itemsMember.GetTextView().Trim().ToString());
         itemsMember = itemsMember.NextNode("Location");
       }
 
@@ -29,26 +29,32 @@ namespace Aws
       namespace GeoRestrictionTypeMapper
       {
 
-        static const int blacklist_HASH = HashingUtils::HashString("blacklist");
-        static const int whitelist_HASH = HashingUtils::HashString("whitelist");
-        static const int none_HASH = HashingUtils::HashString("none");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int blacklist_HASH = 1333012765;
+        static const int whitelist_HASH = -1653850041;
+        static const int none_HASH = 3387192;
 
 
         GeoRestrictionType GetGeoRestrictionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == blacklist_HASH)
+          switch (hashCode)
           {
+          case blacklist_HASH:
             return GeoRestrictionType::blacklist;
-          }
-          else if (hashCode == whitelist_HASH)
-          {
+          case whitelist_HASH:
             return GeoRestrictionType::whitelist;
-          }
-          else if (hashCode == none_HASH)
-          {
+          case none_HASH:
             return GeoRestrictionType::none;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace ItemSelectionMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int whitelist_HASH = HashingUtils::HashString("whitelist");
-        static const int all_HASH = HashingUtils::HashString("all");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int none_HASH = 3387192;
+        static const int whitelist_HASH = -1653850041;
+        static const int all_HASH = 96673;
 
 
         ItemSelection GetItemSelectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
+          switch (hashCode)
           {
+          case none_HASH:
             return ItemSelection::none;
-          }
-          else if (hashCode == whitelist_HASH)
-          {
+          case whitelist_HASH:
             return ItemSelection::whitelist;
-          }
-          else if (hashCode == all_HASH)
-          {
+          case all_HASH:
             return ItemSelection::all;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -59,25 +59,25 @@ LoggingConfig& LoggingConfig::operator =(const XmlNode& xmlNode)
     XmlNode enabledNode = resultNode.FirstChild("Enabled");
     if(!enabledNode.IsNull())
     {
-      m_enabled = StringUtils::ConvertToBool(StringUtils::Trim(enabledNode.GetText().c_str()).c_str());
+      m_enabled = StringUtils::ConvertToBool(enabledNode.GetTextView().Trim().ToString().c_str());
       m_enabledHasBeenSet = true;
     }
     XmlNode includeCookiesNode = resultNode.FirstChild("IncludeCookies");
     if(!includeCookiesNode.IsNull())
     {
-      m_includeCookies = StringUtils::ConvertToBool(StringUtils::Trim(includeCookiesNode.GetText().c_str()).c_str());
+      m_includeCookies = StringUtils::ConvertToBool(includeCookiesNode.GetTextView().Trim().ToString().c_str());
       m_includeCookiesHasBeenSet = true;
     }
     XmlNode bucketNode = resultNode.FirstChild("Bucket");
     if(!bucketNode.IsNull())
     {
-      m_bucket = StringUtils::Trim(bucketNode.GetText().c_str());
+      m_bucket = bucketNode.GetTextView().Trim().ToString();
       m_bucketHasBeenSet = true;
     }
     XmlNode prefixNode = resultNode.FirstChild("Prefix");
     if(!prefixNode.IsNull())
     {
-      m_prefix = StringUtils::Trim(prefixNode.GetText().c_str());
+      m_prefix = prefixNode.GetTextView().Trim().ToString();
       m_prefixHasBeenSet = true;
     }
   }
@@ -29,46 +29,44 @@ namespace Aws
       namespace MethodMapper
       {
 
-        static const int GET__HASH = HashingUtils::HashString("GET");
-        static const int HEAD_HASH = HashingUtils::HashString("HEAD");
-        static const int POST_HASH = HashingUtils::HashString("POST");
-        static const int PUT_HASH = HashingUtils::HashString("PUT");
-        static const int PATCH_HASH = HashingUtils::HashString("PATCH");
-        static const int OPTIONS_HASH = HashingUtils::HashString("OPTIONS");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int GET__HASH = 70454;
+        static const int HEAD_HASH = 2213344;
+        static const int POST_HASH = 2461856;
+        static const int PUT_HASH = 79599;
+        static const int PATCH_HASH = 75900968;
+        static const int OPTIONS_HASH = -531492226;
+        static const int DELETE__HASH = 2012838315;
 
 
         Method GetMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GET__HASH)
+          switch (hashCode)
           {
+          case GET__HASH:
             return Method::GET_;
-          }
-          else if (hashCode == HEAD_HASH)
-          {
+          case HEAD_HASH:
             return Method::HEAD;
-          }
-          else if (hashCode == POST_HASH)
-          {
+          case POST_HASH:
             return Method::POST;
-          }
-          else if (hashCode == PUT_HASH)
-          {
+          case PUT_HASH:
             return Method::PUT;
-          }
-          else if (hashCode == PATCH_HASH)
-          {
+          case PATCH_HASH:
             return Method::PATCH;
-          }
-          else if (hashCode == OPTIONS_HASH)
-          {
+          case OPTIONS_HASH:
             return Method::OPTIONS;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
+          case DELETE__HASH:
             return Method::DELETE_;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace MinimumProtocolVersionMapper
       {
 
-        static const int SSLv3_HASH = HashingUtils::HashString("SSLv3");
-        static const int TLSv1_HASH = HashingUtils::HashString("TLSv1");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int SSLv3_HASH = 79201641;
+        static const int TLSv1_HASH = 79923350;
 
 
         MinimumProtocolVersion GetMinimumProtocolVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SSLv3_HASH)
+          switch (hashCode)
           {
+          case SSLv3_HASH:
             return MinimumProtocolVersion::SSLv3;
-          }
-          else if (hashCode == TLSv1_HASH)
-          {
+          case TLSv1_HASH:
             return MinimumProtocolVersion::TLSv1;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -59,19 +59,19 @@ Origin& Origin::operator =(const XmlNode& xmlNode)
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode domainNameNode = resultNode.FirstChild("DomainName");
     if(!domainNameNode.IsNull())
     {
-      m_domainName = StringUtils::Trim(domainNameNode.GetText().c_str());
+      m_domainName = domainNameNode.GetTextView().Trim().ToString();
       m_domainNameHasBeenSet = true;
     }
     XmlNode originPathNode = resultNode.FirstChild("OriginPath");
     if(!originPathNode.IsNull())
     {
-      m_originPath = StringUtils::Trim(originPathNode.GetText().c_str());
+      m_originPath = originPathNode.GetTextView().Trim().ToString();
       m_originPathHasBeenSet = true;
     }
     XmlNode customHeadersNode = resultNode.FirstChild("CustomHeaders");
@@ -51,13 +51,13 @@ OriginCustomHeader& OriginCustomHeader::operator =(const XmlNode& xmlNode)
     XmlNode headerNameNode = resultNode.FirstChild("HeaderName");
     if(!headerNameNode.IsNull())
     {
-      m_headerName = StringUtils::Trim(headerNameNode.GetText().c_str());
+      m_headerName = headerNameNode.GetTextView().Trim().ToString();
       m_headerNameHasBeenSet = true;
     }
     XmlNode headerValueNode = resultNode.FirstChild("HeaderValue");
     if(!headerValueNode.IsNull())
     {
-      m_headerValue = StringUtils::Trim(headerValueNode.GetText().c_str());
+      m_headerValue = headerValueNode.GetTextView().Trim().ToString();
       m_headerValueHasBeenSet = true;
     }
   }
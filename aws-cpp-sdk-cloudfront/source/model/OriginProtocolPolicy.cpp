@@ -29,26 +29,32 @@ namespace Aws
       namespace OriginProtocolPolicyMapper
       {
 
-        static const int http_only_HASH = HashingUtils::HashString("http-only");
-        static const int match_viewer_HASH = HashingUtils::HashString("match-viewer");
-        static const int https_only_HASH = HashingUtils::HashString("https-only");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int http_only_HASH = 133516753;
+        static const int match_viewer_HASH = 139406106;
+        static const int https_only_HASH = 1787171662;
 
 
         OriginProtocolPolicy GetOriginProtocolPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == http_only_HASH)
+          switch (hashCode)
           {
+          case http_only_HASH:
             return OriginProtocolPolicy::http_only;
-          }
-          else if (hashCode == match_viewer_HASH)
-          {
+          case match_viewer_HASH:
             return OriginProtocolPolicy::match_viewer;
-          }
-          else if (hashCode == https_only_HASH)
-          {
+          case https_only_HASH:
             return OriginProtocolPolicy::https_only;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -53,7 +53,7 @@ OriginSslProtocols& OriginSslProtocols::operator =(const XmlNode& xmlNode)
     XmlNode quantityNode = resultNode.FirstChild("Quantity");
     if(!quantityNode.IsNull())
     {
-      m_quantity = StringUtils::ConvertToInt32(StringUtils::Trim(quantityNode.GetText().c_str()).c_str());
+      m_quantity = StringUtils::ConvertToInt32(quantityNode.GetTextView().Trim().ToString().c_str());
       m_quantityHasBeenSet = true;
     }
     XmlNode itemsNode = resultNode.FirstChild("Items");
@@ -62,7 +62,7 @@ OriginSslProtocols& OriginSslProtocols::operator =(const XmlNode& xmlNode)
       XmlNode itemsMember = itemsNode.FirstChild("SslProtocol");
       while(!itemsMember.IsNull())
       {
-        m_items.push_back(SslProtocolMapper::GetSslProtocolForName(StringUtils::Trim(itemsMember.GetText().c_str())));
+        m_items.push_back(SslProtocolMapper::GetSslProtocolForName(itemsMember.GetTextView().Trim().ToString()));
         itemsMember = itemsMember.NextNode("SslProtocol");
       }
 
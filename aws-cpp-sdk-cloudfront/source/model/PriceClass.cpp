@@ -29,26 +29,32 @@ namespace Aws
       namespace PriceClassMapper
       {
 
-        static const int PriceClass_100_HASH = HashingUtils::HashString("PriceClass_100");
-        static const int PriceClass_200_HASH = HashingUtils::HashString("PriceClass_200");
-        static const int PriceClass_All_HASH = HashingUtils::HashString("PriceClass_All");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PriceClass_100_HASH = 1607579521;
+        static const int PriceClass_200_HASH = 1607580482;
+        static const int PriceClass_All_HASH = 1607596817;
 
 
         PriceClass GetPriceClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PriceClass_100_HASH)
+          switch (hashCode)
           {
+          case PriceClass_100_HASH:
             return PriceClass::PriceClass_100;
-          }
-          else if (hashCode == PriceClass_200_HASH)
-          {
+          case PriceClass_200_HASH:
             return PriceClass::PriceClass_200;
-          }
-          else if (hashCode == PriceClass_All_HASH)
-          {
+          case PriceClass_All_HASH:
             return PriceClass::PriceClass_All;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
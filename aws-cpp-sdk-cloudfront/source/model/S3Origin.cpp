@@ -51,13 +51,13 @@ S3Origin& S3Origin::operator =(const XmlNode& xmlNode)
     XmlNode domainNameNode = resultNode.FirstChild("DomainName");
     if(!domainNameNode.IsNull())
     {
-      m_domainName = StringUtils::Trim(domainNameNode.GetText().c_str());
+      m_domainName = domainNameNode.GetTextView().Trim().ToString();
       m_domainNameHasBeenSet = true;
     }
     XmlNode originAccessIdentityNode = resultNode.FirstChild("OriginAccessIdentity");
     if(!originAccessIdentityNode.IsNull())
     {
-      m_originAccessIdentity = StringUtils::Trim(originAccessIdentityNode.GetText().c_str());
+      m_originAccessIdentity = originAccessIdentityNode.GetTextView().Trim().ToString();
       m_originAccessIdentityHasBeenSet = true;
     }
   }
@@ -29,21 +29,29 @@ namespace Aws
       namespace SSLSupportMethodMapper
       {
 
-        static const int sni_only_HASH = HashingUtils::HashString("sni-only");
-        static const int vip_HASH = HashingUtils::HashString("vip");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int sni_only_HASH = 451917995;
+        static const int vip_HASH = 116765;
 
 
         SSLSupportMethod GetSSLSupportMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == sni_only_HASH)
+          switch (hashCode)
           {
+          case sni_only_HASH:
             return SSLSupportMethod::sni_only;
-          }
-          else if (hashCode == vip_HASH)
-          {
+          case vip_HASH:
             return SSLSupportMethod::vip;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -51,7 +51,7 @@ Signer& Signer::operator =(const XmlNode& xmlNode)
     XmlNode awsAccountNumberNode = resultNode.FirstChild("AwsAccountNumber");
     if(!awsAccountNumberNode.IsNull())
     {
-      m_awsAccountNumber = StringUtils::Trim(awsAccountNumberNode.GetText().c_str());
+      m_awsAccountNumber = awsAccountNumberNode.GetTextView().Trim().ToString();
       m_awsAccountNumberHasBeenSet = true;
     }
     XmlNode keyPairIdsNode = resultNode.FirstChild("KeyPairIds");
@@ -29,31 +29,35 @@ namespace Aws
       namespace SslProtocolMapper
       {
 
-        static const int SSLv3_HASH = HashingUtils::HashString("SSLv3");
-        static const int TLSv1_HASH = HashingUtils::HashString("TLSv1");
-        static const int TLSv1_1_HASH = HashingUtils::HashString("TLSv1.1");
-        static const int TLSv1_2_HASH = HashingUtils::HashString("TLSv1.2");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int SSLv3_HASH = 79201641;
+        static const int TLSv1_HASH = 79923350;
+        static const int TLSv1_1_HASH = -503070503;
+        static const int TLSv1_2_HASH = -503070502;
 
 
         SslProtocol GetSslProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SSLv3_HASH)
+          switch (hashCode)
           {
+          case SSLv3_HASH:
             return SslProtocol::SSLv3;
-          }
-          else if (hashCode == TLSv1_HASH)
-          {
+          case TLSv1_HASH:
             return SslProtocol::TLSv1;
-          }
-          else if (hashCode == TLSv1_1_HASH)
-          {
+          case TLSv1_1_HASH:
             return SslProtocol::TLSv1_1;
-          }
-          else if (hashCode == TLSv1_2_HASH)
-          {
+          case TLSv1_2_HASH:
             return SslProtocol::TLSv1_2;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -59,31 +59,31 @@ ViewerCertificate& ViewerCertificate::operator =(const XmlNode& xmlNode)
     XmlNode cloudFrontDefaultCertificateNode = resultNode.FirstChild("CloudFrontDefaultCertificate");
     if(!cloudFrontDefaultCertificateNode.IsNull())
     {
-      m_cloudFrontDefaultCertificate = StringUtils::ConvertToBool(StringUtils::Trim(cloudFrontDefaultCertificateNode.GetText().c_str()).c_str());
+      m_cloudFrontDefaultCertificate = StringUtils::ConvertToBool(cloudFrontDefaultCertificateNode.GetTextView().Trim().ToString().c_str());
       m_cloudFrontDefaultCertificateHasBeenSet = true;
     }
     XmlNode iAMCertificateIdNode = resultNode.FirstChild("IAMCertificateId");
     if(!iAMCertificateIdNode.IsNull())
     {
-      m_iAMCertificateId = StringUtils::Trim(iAMCertificateIdNode.GetText().c_str());
+      m_iAMCertificateId = iAMCertificateIdNode.GetTextView().Trim().ToString();
       m_iAMCertificateIdHasBeenSet = true;
     }
     XmlNode aCMCertificateArnNode = resultNode.FirstChild("ACMCertificateArn");
     if(!aCMCertificateArnNode.IsNull())
     {
-      m_aCMCertificateArn = StringUtils::Trim(aCMCertificateArnNode.GetText().c_str());
+      m_aCMCertificateArn = aCMCertificateArnNode.GetTextView().Trim().ToString();
       m_aCMCertificateArnHasBeenSet = true;
     }
     XmlNode sSLSupportMethodNode = resultNode.FirstChild("SSLSupportMethod");
     if(!sSLSupportMethodNode.IsNull())
     {
-      m_sSLSupportMethod = SSLSupportMethodMapper::GetSSLSupportMethodForName(StringUtils::Trim(sSLSupportMethodNode.GetText().c_str()).c_str());
+      m_sSLSupportMethod = SSLSupportMethodMapper::GetSSLSupportMethodForName(sSLSupportMethodNode.GetTextView().Trim().ToString().c_str());
       m_sSLSupportMethodHasBeenSet = true;
     }
     XmlNode minimumProtocolVersionNode = resultNode.FirstChild("MinimumProtocolVersion");
     if(!minimumProtocolVersionNode.IsNull())
     {
-      m_minimumProtocolVersion = MinimumProtocolVersionMapper::GetMinimumProtocolVersionForName(StringUtils::Trim(minimumProtocolVersionNode.GetText().c_str()).c_str());
+      m_minimumProtocolVersion = MinimumProtocolVersionMapper::GetMinimumProtocolVersionForName(minimumProtocolVersionNode.GetTextView().Trim().ToString().c_str());
       m_minimumProtocolVersionHasBeenSet = true;
     }
   }
@@ -29,26 +29,32 @@ namespace Aws
       namespace ViewerProtocolPolicyMapper
       {
 
-        static const int allow_all_HASH = HashingUtils::HashString("allow-all");
-        static const int https_only_HASH = HashingUtils::HashString("https-only");
-        static const int redirect_to_https_HASH = HashingUtils::HashString("redirect-to-https");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int allow_all_HASH = 370853149;
+        static const int https_only_HASH = 1787171662;
+        static const int redirect_to_https_HASH = -1851537942;
 
 
         ViewerProtocolPolicy GetViewerProtocolPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == allow_all_HASH)
+          switch (hashCode)
           {
+          case allow_all_HASH:
             return ViewerProtocolPolicy::allow_all;
-          }
-          else if (hashCode == https_only_HASH)
-          {
+          case https_only_HASH:
             return ViewerProtocolPolicy::https_only;
-          }
-          else if (hashCode == redirect_to_https_HASH)
-          {
+          case redirect_to_https_HASH:
             return ViewerProtocolPolicy::redirect_to_https;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
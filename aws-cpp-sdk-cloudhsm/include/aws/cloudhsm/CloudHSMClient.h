@@ -41,6 +41,9 @@
 #include <aws/cloudhsm/model/ModifyLunaClientResult.h>
 #include <aws/cloudhsm/model/RemoveTagsFromResourceResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -226,6 +229,18 @@ namespace Model
          */
         virtual void AddTagsToResourceAsync(const Model::AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToResourceCallable(const Model::AddTagsToResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsToResourceOutcomeCallable AddTagsToResourceCallable(Model::AddTagsToResourceRequest&& request) const;
+
+        /**
+         * Same as AddTagsToResourceAsync(const Model::AddTagsToResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsToResourceAsync(Model::AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a high-availability partition group. A high-availability partition
          * group is a group of partitions that spans multiple physical HSMs.</p>
@@ -248,6 +263,18 @@ namespace Model
          */
         virtual void CreateHapgAsync(const Model::CreateHapgRequest& request, const CreateHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateHapgCallable(const Model::CreateHapgRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateHapgOutcomeCallable CreateHapgCallable(Model::CreateHapgRequest&& request) const;
+
+        /**
+         * Same as CreateHapgAsync(const Model::CreateHapgRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateHapgAsync(Model::CreateHapgRequest&& request, const CreateHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an uninitialized HSM instance.</p> <p>There is an upfront fee charged
          * for each HSM instance that you create with the <a>CreateHsm</a> operation. If
@@ -294,6 +321,18 @@ namespace Model
          */
         virtual void CreateHsmAsync(const Model::CreateHsmRequest& request, const CreateHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateHsmCallable(const Model::CreateHsmRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateHsmOutcomeCallable CreateHsmCallable(Model::CreateHsmRequest&& request) const;
+
+        /**
+         * Same as CreateHsmAsync(const Model::CreateHsmRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateHsmAsync(Model::CreateHsmRequest&& request, const CreateHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an HSM client.</p>
          */
@@ -313,6 +352,18 @@ namespace Model
          */
         virtual void CreateLunaClientAsync(const Model::CreateLunaClientRequest& request, const CreateLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLunaClientCallable(const Model::CreateLunaClientRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateLunaClientOutcomeCallable CreateLunaClientCallable(Model::CreateLunaClientRequest&& request) const;
+
+        /**
+         * Same as CreateLunaClientAsync(const Model::CreateLunaClientRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateLunaClientAsync(Model::CreateLunaClientRequest&& request, const CreateLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a high-availability partition group.</p>
          */
@@ -332,6 +383,18 @@ namespace Model
          */
         virtual void DeleteHapgAsync(const Model::DeleteHapgRequest& request, const DeleteHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteHapgCallable(const Model::DeleteHapgRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteHapgOutcomeCallable DeleteHapgCallable(Model::DeleteHapgRequest&& request) const;
+
+        /**
+         * Same as DeleteHapgAsync(const Model::DeleteHapgRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteHapgAsync(Model::DeleteHapgRequest&& request, const DeleteHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an HSM. After completion, this operation cannot be undone and your
          * key material cannot be recovered.</p>
@@ -354,6 +417,18 @@ namespace Model
          */
         virtual void DeleteHsmAsync(const Model::DeleteHsmRequest& request, const DeleteHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteHsmCallable(const Model::DeleteHsmRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteHsmOutcomeCallable DeleteHsmCallable(Model::DeleteHsmRequest&& request) const;
+
+        /**
+         * Same as DeleteHsmAsync(const Model::DeleteHsmRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteHsmAsync(Model::DeleteHsmRequest&& request, const DeleteHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a client.</p>
          */
@@ -373,6 +448,18 @@ namespace Model
          */
         virtual void DeleteLunaClientAsync(const Model::DeleteLunaClientRequest& request, const DeleteLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLunaClientCallable(const Model::DeleteLunaClientRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteLunaClientOutcomeCallable DeleteLunaClientCallable(Model::DeleteLunaClientRequest&& request) const;
+
+        /**
+         * Same as DeleteLunaClientAsync(const Model::DeleteLunaClientRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteLunaClientAsync(Model::DeleteLunaClientRequest&& request, const DeleteLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about a high-availability partition group.</p>
          */
@@ -392,6 +479,18 @@ namespace Model
          */
         virtual void DescribeHapgAsync(const Model::DescribeHapgRequest& request, const DescribeHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeHapgCallable(const Model::DescribeHapgRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeHapgOutcomeCallable DescribeHapgCallable(Model::DescribeHapgRequest&& request) const;
+
+        /**
+         * Same as DescribeHapgAsync(const Model::DescribeHapgRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeHapgAsync(Model::DescribeHapgRequest&& request, const DescribeHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about an HSM. You can identify the HSM by its ARN or
          * its serial number.</p>
@@ -414,6 +513,18 @@ namespace Model
          */
         virtual void DescribeHsmAsync(const Model::DescribeHsmRequest& request, const DescribeHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeHsmCallable(const Model::DescribeHsmRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeHsmOutcomeCallable DescribeHsmCallable(Model::DescribeHsmRequest&& request) const;
+
+        /**
+         * Same as DescribeHsmAsync(const Model::DescribeHsmRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeHsmAsync(Model::DescribeHsmRequest&& request, const DescribeHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about an HSM client.</p>
          */
@@ -433,6 +544,18 @@ namespace Model
          */
         virtual void DescribeLunaClientAsync(const Model::DescribeLunaClientRequest& request, const DescribeLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLunaClientCallable(const Model::DescribeLunaClientRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLunaClientOutcomeCallable DescribeLunaClientCallable(Model::DescribeLunaClientRequest&& request) const;
+
+        /**
+         * Same as DescribeLunaClientAsync(const Model::DescribeLunaClientRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLunaClientAsync(Model::DescribeLunaClientRequest&& request, const DescribeLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the configuration files necessary to connect to all high availability
          * partition groups the client is associated with.</p>
@@ -455,6 +578,18 @@ namespace Model
          */
         virtual void GetConfigAsync(const Model::GetConfigRequest& request, const GetConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetConfigCallable(const Model::GetConfigRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetConfigOutcomeCallable GetConfigCallable(Model::GetConfigRequest&& request) const;
+
+        /**
+         * Same as GetConfigAsync(const Model::GetConfigRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetConfigAsync(Model::GetConfigRequest&& request, const GetConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the Availability Zones that have available AWS CloudHSM capacity.</p>
          */
@@ -474,6 +609,18 @@ namespace Model
          */
         virtual void ListAvailableZonesAsync(const Model::ListAvailableZonesRequest& request, const ListAvailableZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAvailableZonesCallable(const Model::ListAvailableZonesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAvailableZonesOutcomeCallable ListAvailableZonesCallable(Model::ListAvailableZonesRequest&& request) const;
+
+        /**
+         * Same as ListAvailableZonesAsync(const Model::ListAvailableZonesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAvailableZonesAsync(Model::ListAvailableZonesRequest&& request, const ListAvailableZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the high-availability partition groups for the account.</p> <p>This
          * operation supports pagination with the use of the <i>NextToken</i> member. If
@@ -505,6 +652,18 @@ namespace Model
          */
         virtual void ListHapgsAsync(const Model::ListHapgsRequest& request, const ListHapgsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListHapgsCallable(const Model::ListHapgsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListHapgsOutcomeCallable ListHapgsCallable(Model::ListHapgsRequest&& request) const;
+
+        /**
+         * Same as ListHapgsAsync(const Model::ListHapgsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListHapgsAsync(Model::ListHapgsRequest&& request, const ListHapgsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the identifiers of all of the HSMs provisioned for the current
          * customer.</p> <p>This operation supports pagination with the use of the
@@ -536,6 +695,18 @@ namespace Model
          */
         virtual void ListHsmsAsync(const Model::ListHsmsRequest& request, const ListHsmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListHsmsCallable(const Model::ListHsmsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListHsmsOutcomeCallable ListHsmsCallable(Model::ListHsmsRequest&& request) const;
+
+        /**
+         * Same as ListHsmsAsync(const Model::ListHsmsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListHsmsAsync(Model::ListHsmsRequest&& request, const ListHsmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all of the clients.</p> <p>This operation supports pagination with the
          * use of the <i>NextToken</i> member. If more results are available, the
@@ -564,6 +735,18 @@ namespace Model
          */
         virtual void ListLunaClientsAsync(const Model::ListLunaClientsRequest& request, const ListLunaClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListLunaClientsCallable(const Model::ListLunaClientsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListLunaClientsOutcomeCallable ListLunaClientsCallable(Model::ListLunaClientsRequest&& request) const;
+
+        /**
+         * Same as ListLunaClientsAsync(const Model::ListLunaClientsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListLunaClientsAsync(Model::ListLunaClientsRequest&& request, const ListLunaClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of all tags for the specified AWS CloudHSM resource.</p>
          */
@@ -583,6 +766,18 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourceCallable(const Model::ListTagsForResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(Model::ListTagsForResourceRequest&& request) const;
+
+        /**
+         * Same as ListTagsForResourceAsync(const Model::ListTagsForResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsForResourceAsync(Model::ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies an existing high-availability partition group.</p>
          */
@@ -602,6 +797,18 @@ namespace Model
          */
         virtual void ModifyHapgAsync(const Model::ModifyHapgRequest& request, const ModifyHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyHapgCallable(const Model::ModifyHapgRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyHapgOutcomeCallable ModifyHapgCallable(Model::ModifyHapgRequest&& request) const;
+
+        /**
+         * Same as ModifyHapgAsync(const Model::ModifyHapgRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyHapgAsync(Model::ModifyHapgRequest&& request, const ModifyHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies an HSM.</p> <important> <p>This operation can result in the HSM
          * being offline for up to 15 minutes while the AWS CloudHSM service is
@@ -633,6 +840,18 @@ namespace Model
          */
         virtual void ModifyHsmAsync(const Model::ModifyHsmRequest& request, const ModifyHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyHsmCallable(const Model::ModifyHsmRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyHsmOutcomeCallable ModifyHsmCallable(Model::ModifyHsmRequest&& request) const;
+
+        /**
+         * Same as ModifyHsmAsync(const Model::ModifyHsmRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyHsmAsync(Model::ModifyHsmRequest&& request, const ModifyHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the certificate used by the client.</p> <p>This action can
          * potentially start a workflow to install the new certificate on the client's
@@ -658,6 +877,18 @@ namespace Model
          */
         virtual void ModifyLunaClientAsync(const Model::ModifyLunaClientRequest& request, const ModifyLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyLunaClientCallable(const Model::ModifyLunaClientRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyLunaClientOutcomeCallable ModifyLunaClientCallable(Model::ModifyLunaClientRequest&& request) const;
+
+        /**
+         * Same as ModifyLunaClientAsync(const Model::ModifyLunaClientRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyLunaClientAsync(Model::ModifyLunaClientRequest&& request, const ModifyLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes one or more tags from the specified AWS CloudHSM resource.</p> <p>To
          * remove a tag, specify only the tag key to remove (not the value). To overwrite
@@ -683,6 +914,135 @@ namespace Model
          */
         virtual void RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromResourceCallable(const Model::RemoveTagsFromResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsFromResourceOutcomeCallable RemoveTagsFromResourceCallable(Model::RemoveTagsFromResourceRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsFromResourceAsync(Model::RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListHapgs(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudHSMClient, Model::ListHapgsRequest, Model::ListHapgsOutcome> ListHapgsPaginator(const Model::ListHapgsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListHsms(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudHSMClient, Model::ListHsmsRequest, Model::ListHsmsOutcome> ListHsmsPaginator(const Model::ListHsmsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListLunaClients(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudHSMClient, Model::ListLunaClientsRequest, Model::ListLunaClientsOutcome> ListLunaClientsPaginator(const Model::ListLunaClientsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddTagsToResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::AddTagsToResourceRequest, Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(Model::AddTagsToResourceRequest request) const;
+
+        /**
+         * co_await-able form of CreateHapg(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::CreateHapgRequest, Model::CreateHapgOutcome> CreateHapgAwaitable(Model::CreateHapgRequest request) const;
+
+        /**
+         * co_await-able form of CreateHsm(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::CreateHsmRequest, Model::CreateHsmOutcome> CreateHsmAwaitable(Model::CreateHsmRequest request) const;
+
+        /**
+         * co_await-able form of CreateLunaClient(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::CreateLunaClientRequest, Model::CreateLunaClientOutcome> CreateLunaClientAwaitable(Model::CreateLunaClientRequest request) const;
+
+        /**
+         * co_await-able form of DeleteHapg(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::DeleteHapgRequest, Model::DeleteHapgOutcome> DeleteHapgAwaitable(Model::DeleteHapgRequest request) const;
+
+        /**
+         * co_await-able form of DeleteHsm(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::DeleteHsmRequest, Model::DeleteHsmOutcome> DeleteHsmAwaitable(Model::DeleteHsmRequest request) const;
+
+        /**
+         * co_await-able form of DeleteLunaClient(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::DeleteLunaClientRequest, Model::DeleteLunaClientOutcome> DeleteLunaClientAwaitable(Model::DeleteLunaClientRequest request) const;
+
+        /**
+         * co_await-able form of DescribeHapg(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::DescribeHapgRequest, Model::DescribeHapgOutcome> DescribeHapgAwaitable(Model::DescribeHapgRequest request) const;
+
+        /**
+         * co_await-able form of DescribeHsm(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::DescribeHsmRequest, Model::DescribeHsmOutcome> DescribeHsmAwaitable(Model::DescribeHsmRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLunaClient(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::DescribeLunaClientRequest, Model::DescribeLunaClientOutcome> DescribeLunaClientAwaitable(Model::DescribeLunaClientRequest request) const;
+
+        /**
+         * co_await-able form of GetConfig(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::GetConfigRequest, Model::GetConfigOutcome> GetConfigAwaitable(Model::GetConfigRequest request) const;
+
+        /**
+         * co_await-able form of ListAvailableZones(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::ListAvailableZonesRequest, Model::ListAvailableZonesOutcome> ListAvailableZonesAwaitable(Model::ListAvailableZonesRequest request) const;
+
+        /**
+         * co_await-able form of ListHapgs(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::ListHapgsRequest, Model::ListHapgsOutcome> ListHapgsAwaitable(Model::ListHapgsRequest request) const;
+
+        /**
+         * co_await-able form of ListHsms(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::ListHsmsRequest, Model::ListHsmsOutcome> ListHsmsAwaitable(Model::ListHsmsRequest request) const;
+
+        /**
+         * co_await-able form of ListLunaClients(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::ListLunaClientsRequest, Model::ListLunaClientsOutcome> ListLunaClientsAwaitable(Model::ListLunaClientsRequest request) const;
+
+        /**
+         * co_await-able form of ListTagsForResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::ListTagsForResourceRequest, Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(Model::ListTagsForResourceRequest request) const;
+
+        /**
+         * co_await-able form of ModifyHapg(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::ModifyHapgRequest, Model::ModifyHapgOutcome> ModifyHapgAwaitable(Model::ModifyHapgRequest request) const;
+
+        /**
+         * co_await-able form of ModifyHsm(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::ModifyHsmRequest, Model::ModifyHsmOutcome> ModifyHsmAwaitable(Model::ModifyHsmRequest request) const;
+
+        /**
+         * co_await-able form of ModifyLunaClient(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::ModifyLunaClientRequest, Model::ModifyLunaClientOutcome> ModifyLunaClientAwaitable(Model::ModifyLunaClientRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTagsFromResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudHSMClient, Model::RemoveTagsFromResourceRequest, Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(Model::RemoveTagsFromResourceRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateHapgRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateHapg"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
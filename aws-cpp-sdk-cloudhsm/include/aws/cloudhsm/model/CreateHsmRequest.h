@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateHsmRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateHsm"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
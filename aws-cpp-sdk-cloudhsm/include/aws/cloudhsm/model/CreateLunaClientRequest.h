@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateLunaClientRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateLunaClient"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
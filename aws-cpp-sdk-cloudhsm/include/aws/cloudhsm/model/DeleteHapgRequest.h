@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteHapgRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteHapg"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteHsmRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteHsm"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
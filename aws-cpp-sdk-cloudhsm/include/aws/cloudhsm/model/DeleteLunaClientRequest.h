@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteLunaClientRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteLunaClient"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeHapgRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeHapg"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
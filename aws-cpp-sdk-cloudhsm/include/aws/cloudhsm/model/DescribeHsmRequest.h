@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeHsmRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeHsm"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeLunaClientRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLunaClient"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetConfigRequest();
+    inline const char* GetServiceRequestName() const override { return "GetConfig"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
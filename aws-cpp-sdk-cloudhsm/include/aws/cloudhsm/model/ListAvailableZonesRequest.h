@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListAvailableZonesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListAvailableZones"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListHapgsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListHapgs"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
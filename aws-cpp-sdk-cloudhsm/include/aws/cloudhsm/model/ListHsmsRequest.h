@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListHsmsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListHsms"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
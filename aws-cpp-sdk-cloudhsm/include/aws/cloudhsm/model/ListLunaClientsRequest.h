@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListLunaClientsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListLunaClients"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ModifyHapgRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyHapg"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
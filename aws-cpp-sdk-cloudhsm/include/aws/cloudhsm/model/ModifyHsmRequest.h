@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ModifyHsmRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyHsm"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
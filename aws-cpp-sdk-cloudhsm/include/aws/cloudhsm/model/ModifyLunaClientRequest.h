@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ModifyLunaClientRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyLunaClient"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -129,7 +129,7 @@ AddTagsToResourceOutcome CloudHSMClient::AddTagsToResource(const AddTagsToResour
 
 AddTagsToResourceOutcomeCallable CloudHSMClient::AddTagsToResourceCallable(const AddTagsToResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTagsToResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTagsToResource(request); } );
 }
 
 void CloudHSMClient::AddTagsToResourceAsync(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -137,6 +137,16 @@ void CloudHSMClient::AddTagsToResourceAsync(const AddTagsToResourceRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsToResourceAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsToResourceOutcomeCallable CloudHSMClient::AddTagsToResourceCallable(AddTagsToResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::AddTagsToResource, this, std::move(request)));
+}
+
+void CloudHSMClient::AddTagsToResourceAsync(AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::AddTagsToResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::AddTagsToResourceAsyncHelper(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTagsToResource(request), context);
@@ -160,7 +170,7 @@ CreateHapgOutcome CloudHSMClient::CreateHapg(const CreateHapgRequest& request) c
 
 CreateHapgOutcomeCallable CloudHSMClient::CreateHapgCallable(const CreateHapgRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateHapg(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateHapg(request); } );
 }
 
 void CloudHSMClient::CreateHapgAsync(const CreateHapgRequest& request, const CreateHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -168,6 +178,16 @@ void CloudHSMClient::CreateHapgAsync(const CreateHapgRequest& request, const Cre
   m_executor->Submit( [this, request, handler, context](){ this->CreateHapgAsyncHelper( request, handler, context ); } );
 }
 
+CreateHapgOutcomeCallable CloudHSMClient::CreateHapgCallable(CreateHapgRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::CreateHapg, this, std::move(request)));
+}
+
+void CloudHSMClient::CreateHapgAsync(CreateHapgRequest&& request, const CreateHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::CreateHapgAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::CreateHapgAsyncHelper(const CreateHapgRequest& request, const CreateHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateHapg(request), context);
@@ -191,7 +211,7 @@ CreateHsmOutcome CloudHSMClient::CreateHsm(const CreateHsmRequest& request) cons
 
 CreateHsmOutcomeCallable CloudHSMClient::CreateHsmCallable(const CreateHsmRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateHsm(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateHsm(request); } );
 }
 
 void CloudHSMClient::CreateHsmAsync(const CreateHsmRequest& request, const CreateHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -199,6 +219,16 @@ void CloudHSMClient::CreateHsmAsync(const CreateHsmRequest& request, const Creat
   m_executor->Submit( [this, request, handler, context](){ this->CreateHsmAsyncHelper( request, handler, context ); } );
 }
 
+CreateHsmOutcomeCallable CloudHSMClient::CreateHsmCallable(CreateHsmRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::CreateHsm, this, std::move(request)));
+}
+
+void CloudHSMClient::CreateHsmAsync(CreateHsmRequest&& request, const CreateHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::CreateHsmAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::CreateHsmAsyncHelper(const CreateHsmRequest& request, const CreateHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateHsm(request), context);
@@ -222,7 +252,7 @@ CreateLunaClientOutcome CloudHSMClient::CreateLunaClient(const CreateLunaClientR
 
 CreateLunaClientOutcomeCallable CloudHSMClient::CreateLunaClientCallable(const CreateLunaClientRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateLunaClient(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateLunaClient(request); } );
 }
 
 void CloudHSMClient::CreateLunaClientAsync(const CreateLunaClientRequest& request, const CreateLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -230,6 +260,16 @@ void CloudHSMClient::CreateLunaClientAsync(const CreateLunaClientRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->CreateLunaClientAsyncHelper( request, handler, context ); } );
 }
 
+CreateLunaClientOutcomeCallable CloudHSMClient::CreateLunaClientCallable(CreateLunaClientRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::CreateLunaClient, this, std::move(request)));
+}
+
+void CloudHSMClient::CreateLunaClientAsync(CreateLunaClientRequest&& request, const CreateLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::CreateLunaClientAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::CreateLunaClientAsyncHelper(const CreateLunaClientRequest& request, const CreateLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateLunaClient(request), context);
@@ -253,7 +293,7 @@ DeleteHapgOutcome CloudHSMClient::DeleteHapg(const DeleteHapgRequest& request) c
 
 DeleteHapgOutcomeCallable CloudHSMClient::DeleteHapgCallable(const DeleteHapgRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteHapg(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteHapg(request); } );
 }
 
 void CloudHSMClient::DeleteHapgAsync(const DeleteHapgRequest& request, const DeleteHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -261,6 +301,16 @@ void CloudHSMClient::DeleteHapgAsync(const DeleteHapgRequest& request, const Del
   m_executor->Submit( [this, request, handler, context](){ this->DeleteHapgAsyncHelper( request, handler, context ); } );
 }
 
+DeleteHapgOutcomeCallable CloudHSMClient::DeleteHapgCallable(DeleteHapgRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::DeleteHapg, this, std::move(request)));
+}
+
+void CloudHSMClient::DeleteHapgAsync(DeleteHapgRequest&& request, const DeleteHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::DeleteHapgAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::DeleteHapgAsyncHelper(const DeleteHapgRequest& request, const DeleteHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteHapg(request), context);
@@ -284,7 +334,7 @@ DeleteHsmOutcome CloudHSMClient::DeleteHsm(const DeleteHsmRequest& request) cons
 
 DeleteHsmOutcomeCallable CloudHSMClient::DeleteHsmCallable(const DeleteHsmRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteHsm(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteHsm(request); } );
 }
 
 void CloudHSMClient::DeleteHsmAsync(const DeleteHsmRequest& request, const DeleteHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -292,6 +342,16 @@ void CloudHSMClient::DeleteHsmAsync(const DeleteHsmRequest& request, const Delet
   m_executor->Submit( [this, request, handler, context](){ this->DeleteHsmAsyncHelper( request, handler, context ); } );
 }
 
+DeleteHsmOutcomeCallable CloudHSMClient::DeleteHsmCallable(DeleteHsmRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::DeleteHsm, this, std::move(request)));
+}
+
+void CloudHSMClient::DeleteHsmAsync(DeleteHsmRequest&& request, const DeleteHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::DeleteHsmAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::DeleteHsmAsyncHelper(const DeleteHsmRequest& request, const DeleteHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteHsm(request), context);
@@ -315,7 +375,7 @@ DeleteLunaClientOutcome CloudHSMClient::DeleteLunaClient(const DeleteLunaClientR
 
 DeleteLunaClientOutcomeCallable CloudHSMClient::DeleteLunaClientCallable(const DeleteLunaClientRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteLunaClient(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteLunaClient(request); } );
 }
 
 void CloudHSMClient::DeleteLunaClientAsync(const DeleteLunaClientRequest& request, const DeleteLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -323,6 +383,16 @@ void CloudHSMClient::DeleteLunaClientAsync(const DeleteLunaClientRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->DeleteLunaClientAsyncHelper( request, handler, context ); } );
 }
 
+DeleteLunaClientOutcomeCallable CloudHSMClient::DeleteLunaClientCallable(DeleteLunaClientRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::DeleteLunaClient, this, std::move(request)));
+}
+
+void CloudHSMClient::DeleteLunaClientAsync(DeleteLunaClientRequest&& request, const DeleteLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::DeleteLunaClientAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::DeleteLunaClientAsyncHelper(const DeleteLunaClientRequest& request, const DeleteLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteLunaClient(request), context);
@@ -346,7 +416,7 @@ DescribeHapgOutcome CloudHSMClient::DescribeHapg(const DescribeHapgRequest& requ
 
 DescribeHapgOutcomeCallable CloudHSMClient::DescribeHapgCallable(const DescribeHapgRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeHapg(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeHapg(request); } );
 }
 
 void CloudHSMClient::DescribeHapgAsync(const DescribeHapgRequest& request, const DescribeHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -354,6 +424,16 @@ void CloudHSMClient::DescribeHapgAsync(const DescribeHapgRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DescribeHapgAsyncHelper( request, handler, context ); } );
 }
 
+DescribeHapgOutcomeCallable CloudHSMClient::DescribeHapgCallable(DescribeHapgRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::DescribeHapg, this, std::move(request)));
+}
+
+void CloudHSMClient::DescribeHapgAsync(DescribeHapgRequest&& request, const DescribeHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::DescribeHapgAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::DescribeHapgAsyncHelper(const DescribeHapgRequest& request, const DescribeHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeHapg(request), context);
@@ -377,7 +457,7 @@ DescribeHsmOutcome CloudHSMClient::DescribeHsm(const DescribeHsmRequest& request
 
 DescribeHsmOutcomeCallable CloudHSMClient::DescribeHsmCallable(const DescribeHsmRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeHsm(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeHsm(request); } );
 }
 
 void CloudHSMClient::DescribeHsmAsync(const DescribeHsmRequest& request, const DescribeHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -385,6 +465,16 @@ void CloudHSMClient::DescribeHsmAsync(const DescribeHsmRequest& request, const D
   m_executor->Submit( [this, request, handler, context](){ this->DescribeHsmAsyncHelper( request, handler, context ); } );
 }
 
+DescribeHsmOutcomeCallable CloudHSMClient::DescribeHsmCallable(DescribeHsmRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::DescribeHsm, this, std::move(request)));
+}
+
+void CloudHSMClient::DescribeHsmAsync(DescribeHsmRequest&& request, const DescribeHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::DescribeHsmAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::DescribeHsmAsyncHelper(const DescribeHsmRequest& request, const DescribeHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeHsm(request), context);
@@ -408,7 +498,7 @@ DescribeLunaClientOutcome CloudHSMClient::DescribeLunaClient(const DescribeLunaC
 
 DescribeLunaClientOutcomeCallable CloudHSMClient::DescribeLunaClientCallable(const DescribeLunaClientRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLunaClient(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLunaClient(request); } );
 }
 
 void CloudHSMClient::DescribeLunaClientAsync(const DescribeLunaClientRequest& request, const DescribeLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -416,6 +506,16 @@ void CloudHSMClient::DescribeLunaClientAsync(const DescribeLunaClientRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLunaClientAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLunaClientOutcomeCallable CloudHSMClient::DescribeLunaClientCallable(DescribeLunaClientRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::DescribeLunaClient, this, std::move(request)));
+}
+
+void CloudHSMClient::DescribeLunaClientAsync(DescribeLunaClientRequest&& request, const DescribeLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::DescribeLunaClientAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::DescribeLunaClientAsyncHelper(const DescribeLunaClientRequest& request, const DescribeLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLunaClient(request), context);
@@ -439,7 +539,7 @@ GetConfigOutcome CloudHSMClient::GetConfig(const GetConfigRequest& request) cons
 
 GetConfigOutcomeCallable CloudHSMClient::GetConfigCallable(const GetConfigRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetConfig(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetConfig(request); } );
 }
 
 void CloudHSMClient::GetConfigAsync(const GetConfigRequest& request, const GetConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -447,6 +547,16 @@ void CloudHSMClient::GetConfigAsync(const GetConfigRequest& request, const GetCo
   m_executor->Submit( [this, request, handler, context](){ this->GetConfigAsyncHelper( request, handler, context ); } );
 }
 
+GetConfigOutcomeCallable CloudHSMClient::GetConfigCallable(GetConfigRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::GetConfig, this, std::move(request)));
+}
+
+void CloudHSMClient::GetConfigAsync(GetConfigRequest&& request, const GetConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::GetConfigAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::GetConfigAsyncHelper(const GetConfigRequest& request, const GetConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetConfig(request), context);
@@ -470,7 +580,7 @@ ListAvailableZonesOutcome CloudHSMClient::ListAvailableZones(const ListAvailable
 
 ListAvailableZonesOutcomeCallable CloudHSMClient::ListAvailableZonesCallable(const ListAvailableZonesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAvailableZones(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAvailableZones(request); } );
 }
 
 void CloudHSMClient::ListAvailableZonesAsync(const ListAvailableZonesRequest& request, const ListAvailableZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -478,6 +588,16 @@ void CloudHSMClient::ListAvailableZonesAsync(const ListAvailableZonesRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->ListAvailableZonesAsyncHelper( request, handler, context ); } );
 }
 
+ListAvailableZonesOutcomeCallable CloudHSMClient::ListAvailableZonesCallable(ListAvailableZonesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::ListAvailableZones, this, std::move(request)));
+}
+
+void CloudHSMClient::ListAvailableZonesAsync(ListAvailableZonesRequest&& request, const ListAvailableZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::ListAvailableZonesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::ListAvailableZonesAsyncHelper(const ListAvailableZonesRequest& request, const ListAvailableZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAvailableZones(request), context);
@@ -501,7 +621,7 @@ ListHapgsOutcome CloudHSMClient::ListHapgs(const ListHapgsRequest& request) cons
 
 ListHapgsOutcomeCallable CloudHSMClient::ListHapgsCallable(const ListHapgsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListHapgs(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListHapgs(request); } );
 }
 
 void CloudHSMClient::ListHapgsAsync(const ListHapgsRequest& request, const ListHapgsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -509,6 +629,16 @@ void CloudHSMClient::ListHapgsAsync(const ListHapgsRequest& request, const ListH
   m_executor->Submit( [this, request, handler, context](){ this->ListHapgsAsyncHelper( request, handler, context ); } );
 }
 
+ListHapgsOutcomeCallable CloudHSMClient::ListHapgsCallable(ListHapgsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::ListHapgs, this, std::move(request)));
+}
+
+void CloudHSMClient::ListHapgsAsync(ListHapgsRequest&& request, const ListHapgsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::ListHapgsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::ListHapgsAsyncHelper(const ListHapgsRequest& request, const ListHapgsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListHapgs(request), context);
@@ -532,7 +662,7 @@ ListHsmsOutcome CloudHSMClient::ListHsms(const ListHsmsRequest& request) const
 
 ListHsmsOutcomeCallable CloudHSMClient::ListHsmsCallable(const ListHsmsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListHsms(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListHsms(request); } );
 }
 
 void CloudHSMClient::ListHsmsAsync(const ListHsmsRequest& request, const ListHsmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -540,6 +670,16 @@ void CloudHSMClient::ListHsmsAsync(const ListHsmsRequest& request, const ListHsm
   m_executor->Submit( [this, request, handler, context](){ this->ListHsmsAsyncHelper( request, handler, context ); } );
 }
 
+ListHsmsOutcomeCallable CloudHSMClient::ListHsmsCallable(ListHsmsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::ListHsms, this, std::move(request)));
+}
+
+void CloudHSMClient::ListHsmsAsync(ListHsmsRequest&& request, const ListHsmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::ListHsmsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::ListHsmsAsyncHelper(const ListHsmsRequest& request, const ListHsmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListHsms(request), context);
@@ -563,7 +703,7 @@ ListLunaClientsOutcome CloudHSMClient::ListLunaClients(const ListLunaClientsRequ
 
 ListLunaClientsOutcomeCallable CloudHSMClient::ListLunaClientsCallable(const ListLunaClientsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListLunaClients(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListLunaClients(request); } );
 }
 
 void CloudHSMClient::ListLunaClientsAsync(const ListLunaClientsRequest& request, const ListLunaClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -571,6 +711,16 @@ void CloudHSMClient::ListLunaClientsAsync(const ListLunaClientsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ListLunaClientsAsyncHelper( request, handler, context ); } );
 }
 
+ListLunaClientsOutcomeCallable CloudHSMClient::ListLunaClientsCallable(ListLunaClientsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::ListLunaClients, this, std::move(request)));
+}
+
+void CloudHSMClient::ListLunaClientsAsync(ListLunaClientsRequest&& request, const ListLunaClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::ListLunaClientsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::ListLunaClientsAsyncHelper(const ListLunaClientsRequest& request, const ListLunaClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListLunaClients(request), context);
@@ -594,7 +744,7 @@ ListTagsForResourceOutcome CloudHSMClient::ListTagsForResource(const ListTagsFor
 
 ListTagsForResourceOutcomeCallable CloudHSMClient::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTagsForResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTagsForResource(request); } );
 }
 
 void CloudHSMClient::ListTagsForResourceAsync(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -602,6 +752,16 @@ void CloudHSMClient::ListTagsForResourceAsync(const ListTagsForResourceRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsForResourceAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsForResourceOutcomeCallable CloudHSMClient::ListTagsForResourceCallable(ListTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::ListTagsForResource, this, std::move(request)));
+}
+
+void CloudHSMClient::ListTagsForResourceAsync(ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::ListTagsForResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTagsForResource(request), context);
@@ -625,7 +785,7 @@ ModifyHapgOutcome CloudHSMClient::ModifyHapg(const ModifyHapgRequest& request) c
 
 ModifyHapgOutcomeCallable CloudHSMClient::ModifyHapgCallable(const ModifyHapgRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyHapg(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyHapg(request); } );
 }
 
 void CloudHSMClient::ModifyHapgAsync(const ModifyHapgRequest& request, const ModifyHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -633,6 +793,16 @@ void CloudHSMClient::ModifyHapgAsync(const ModifyHapgRequest& request, const Mod
   m_executor->Submit( [this, request, handler, context](){ this->ModifyHapgAsyncHelper( request, handler, context ); } );
 }
 
+ModifyHapgOutcomeCallable CloudHSMClient::ModifyHapgCallable(ModifyHapgRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::ModifyHapg, this, std::move(request)));
+}
+
+void CloudHSMClient::ModifyHapgAsync(ModifyHapgRequest&& request, const ModifyHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::ModifyHapgAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::ModifyHapgAsyncHelper(const ModifyHapgRequest& request, const ModifyHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyHapg(request), context);
@@ -656,7 +826,7 @@ ModifyHsmOutcome CloudHSMClient::ModifyHsm(const ModifyHsmRequest& request) cons
 
 ModifyHsmOutcomeCallable CloudHSMClient::ModifyHsmCallable(const ModifyHsmRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyHsm(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyHsm(request); } );
 }
 
 void CloudHSMClient::ModifyHsmAsync(const ModifyHsmRequest& request, const ModifyHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -664,6 +834,16 @@ void CloudHSMClient::ModifyHsmAsync(const ModifyHsmRequest& request, const Modif
   m_executor->Submit( [this, request, handler, context](){ this->ModifyHsmAsyncHelper( request, handler, context ); } );
 }
 
+ModifyHsmOutcomeCallable CloudHSMClient::ModifyHsmCallable(ModifyHsmRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::ModifyHsm, this, std::move(request)));
+}
+
+void CloudHSMClient::ModifyHsmAsync(ModifyHsmRequest&& request, const ModifyHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::ModifyHsmAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::ModifyHsmAsyncHelper(const ModifyHsmRequest& request, const ModifyHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyHsm(request), context);
@@ -687,7 +867,7 @@ ModifyLunaClientOutcome CloudHSMClient::ModifyLunaClient(const ModifyLunaClientR
 
 ModifyLunaClientOutcomeCallable CloudHSMClient::ModifyLunaClientCallable(const ModifyLunaClientRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyLunaClient(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyLunaClient(request); } );
 }
 
 void CloudHSMClient::ModifyLunaClientAsync(const ModifyLunaClientRequest& request, const ModifyLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -695,6 +875,16 @@ void CloudHSMClient::ModifyLunaClientAsync(const ModifyLunaClientRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->ModifyLunaClientAsyncHelper( request, handler, context ); } );
 }
 
+ModifyLunaClientOutcomeCallable CloudHSMClient::ModifyLunaClientCallable(ModifyLunaClientRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::ModifyLunaClient, this, std::move(request)));
+}
+
+void CloudHSMClient::ModifyLunaClientAsync(ModifyLunaClientRequest&& request, const ModifyLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::ModifyLunaClientAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::ModifyLunaClientAsyncHelper(const ModifyLunaClientRequest& request, const ModifyLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyLunaClient(request), context);
@@ -718,7 +908,7 @@ RemoveTagsFromResourceOutcome CloudHSMClient::RemoveTagsFromResource(const Remov
 
 RemoveTagsFromResourceOutcomeCallable CloudHSMClient::RemoveTagsFromResourceCallable(const RemoveTagsFromResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTagsFromResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTagsFromResource(request); } );
 }
 
 void CloudHSMClient::RemoveTagsFromResourceAsync(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -726,8 +916,171 @@ void CloudHSMClient::RemoveTagsFromResourceAsync(const RemoveTagsFromResourceReq
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsFromResourceAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsFromResourceOutcomeCallable CloudHSMClient::RemoveTagsFromResourceCallable(RemoveTagsFromResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudHSMClient::RemoveTagsFromResource, this, std::move(request)));
+}
+
+void CloudHSMClient::RemoveTagsFromResourceAsync(RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudHSMClient::RemoveTagsFromResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudHSMClient::RemoveTagsFromResourceAsyncHelper(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTagsFromResource(request), context);
 }
 
+Paginator<CloudHSMClient, ListHapgsRequest, ListHapgsOutcome> CloudHSMClient::ListHapgsPaginator(const ListHapgsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudHSMClient, ListHapgsRequest, ListHapgsOutcome>(this, &CloudHSMClient::ListHapgs, request,
+    [](const ListHapgsRequest& current, const ListHapgsOutcome& outcome, ListHapgsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudHSMClient, ListHsmsRequest, ListHsmsOutcome> CloudHSMClient::ListHsmsPaginator(const ListHsmsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudHSMClient, ListHsmsRequest, ListHsmsOutcome>(this, &CloudHSMClient::ListHsms, request,
+    [](const ListHsmsRequest& current, const ListHsmsOutcome& outcome, ListHsmsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudHSMClient, ListLunaClientsRequest, ListLunaClientsOutcome> CloudHSMClient::ListLunaClientsPaginator(const ListLunaClientsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudHSMClient, ListLunaClientsRequest, ListLunaClientsOutcome>(this, &CloudHSMClient::ListLunaClients, request,
+    [](const ListLunaClientsRequest& current, const ListLunaClientsOutcome& outcome, ListLunaClientsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<CloudHSMClient, AddTagsToResourceRequest, AddTagsToResourceOutcome> CloudHSMClient::AddTagsToResourceAwaitable(AddTagsToResourceRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::AddTagsToResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, CreateHapgRequest, CreateHapgOutcome> CloudHSMClient::CreateHapgAwaitable(CreateHapgRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::CreateHapg, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, CreateHsmRequest, CreateHsmOutcome> CloudHSMClient::CreateHsmAwaitable(CreateHsmRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::CreateHsm, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, CreateLunaClientRequest, CreateLunaClientOutcome> CloudHSMClient::CreateLunaClientAwaitable(CreateLunaClientRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::CreateLunaClient, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, DeleteHapgRequest, DeleteHapgOutcome> CloudHSMClient::DeleteHapgAwaitable(DeleteHapgRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::DeleteHapg, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, DeleteHsmRequest, DeleteHsmOutcome> CloudHSMClient::DeleteHsmAwaitable(DeleteHsmRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::DeleteHsm, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, DeleteLunaClientRequest, DeleteLunaClientOutcome> CloudHSMClient::DeleteLunaClientAwaitable(DeleteLunaClientRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::DeleteLunaClient, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, DescribeHapgRequest, DescribeHapgOutcome> CloudHSMClient::DescribeHapgAwaitable(DescribeHapgRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::DescribeHapg, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, DescribeHsmRequest, DescribeHsmOutcome> CloudHSMClient::DescribeHsmAwaitable(DescribeHsmRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::DescribeHsm, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, DescribeLunaClientRequest, DescribeLunaClientOutcome> CloudHSMClient::DescribeLunaClientAwaitable(DescribeLunaClientRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::DescribeLunaClient, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, GetConfigRequest, GetConfigOutcome> CloudHSMClient::GetConfigAwaitable(GetConfigRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::GetConfig, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, ListAvailableZonesRequest, ListAvailableZonesOutcome> CloudHSMClient::ListAvailableZonesAwaitable(ListAvailableZonesRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::ListAvailableZones, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, ListHapgsRequest, ListHapgsOutcome> CloudHSMClient::ListHapgsAwaitable(ListHapgsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::ListHapgs, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, ListHsmsRequest, ListHsmsOutcome> CloudHSMClient::ListHsmsAwaitable(ListHsmsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::ListHsms, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, ListLunaClientsRequest, ListLunaClientsOutcome> CloudHSMClient::ListLunaClientsAwaitable(ListLunaClientsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::ListLunaClients, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, ListTagsForResourceRequest, ListTagsForResourceOutcome> CloudHSMClient::ListTagsForResourceAwaitable(ListTagsForResourceRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::ListTagsForResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, ModifyHapgRequest, ModifyHapgOutcome> CloudHSMClient::ModifyHapgAwaitable(ModifyHapgRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::ModifyHapg, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, ModifyHsmRequest, ModifyHsmOutcome> CloudHSMClient::ModifyHsmAwaitable(ModifyHsmRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::ModifyHsm, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, ModifyLunaClientRequest, ModifyLunaClientOutcome> CloudHSMClient::ModifyLunaClientAwaitable(ModifyLunaClientRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::ModifyLunaClient, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudHSMClient, RemoveTagsFromResourceRequest, RemoveTagsFromResourceOutcome> CloudHSMClient::RemoveTagsFromResourceAwaitable(RemoveTagsFromResourceRequest request) const
+{
+  return { m_executor.get(), { this, &CloudHSMClient::RemoveTagsFromResource, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,21 +29,29 @@ namespace Aws
       namespace ClientVersionMapper
       {
 
-        static const int _5_1_HASH = HashingUtils::HashString("5.1");
-        static const int _5_3_HASH = HashingUtils::HashString("5.3");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int _5_1_HASH = 52408;
+        static const int _5_3_HASH = 52410;
 
 
         ClientVersion GetClientVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == _5_1_HASH)
+          switch (hashCode)
           {
+          case _5_1_HASH:
             return ClientVersion::_5_1;
-          }
-          else if (hashCode == _5_3_HASH)
-          {
+          case _5_3_HASH:
             return ClientVersion::_5_3;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace CloudHsmObjectStateMapper
       {
 
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DEGRADED_HASH = HashingUtils::HashString("DEGRADED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int READY_HASH = 77848963;
+        static const int UPDATING_HASH = 2105227078;
+        static const int DEGRADED_HASH = 1470632750;
 
 
         CloudHsmObjectState GetCloudHsmObjectStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == READY_HASH)
+          switch (hashCode)
           {
+          case READY_HASH:
             return CloudHsmObjectState::READY;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
+          case UPDATING_HASH:
             return CloudHsmObjectState::UPDATING;
-          }
-          else if (hashCode == DEGRADED_HASH)
-          {
+          case DEGRADED_HASH:
             return CloudHsmObjectState::DEGRADED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
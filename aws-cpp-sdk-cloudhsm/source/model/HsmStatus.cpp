@@ -29,46 +29,44 @@ namespace Aws
       namespace HsmStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int SUSPENDED_HASH = HashingUtils::HashString("SUSPENDED");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int DEGRADED_HASH = HashingUtils::HashString("DEGRADED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PENDING_HASH = 35394935;
+        static const int RUNNING_HASH = -2026200673;
+        static const int UPDATING_HASH = 2105227078;
+        static const int SUSPENDED_HASH = 1124965819;
+        static const int TERMINATING_HASH = 234379966;
+        static const int TERMINATED_HASH = -823723485;
+        static const int DEGRADED_HASH = 1470632750;
 
 
         HsmStatus GetHsmStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          switch (hashCode)
           {
+          case PENDING_HASH:
             return HsmStatus::PENDING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
+          case RUNNING_HASH:
             return HsmStatus::RUNNING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
+          case UPDATING_HASH:
             return HsmStatus::UPDATING;
-          }
-          else if (hashCode == SUSPENDED_HASH)
-          {
+          case SUSPENDED_HASH:
             return HsmStatus::SUSPENDED;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
+          case TERMINATING_HASH:
             return HsmStatus::TERMINATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
+          case TERMINATED_HASH:
             return HsmStatus::TERMINATED;
-          }
-          else if (hashCode == DEGRADED_HASH)
-          {
+          case DEGRADED_HASH:
             return HsmStatus::DEGRADED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace SubscriptionTypeMapper
       {
 
-        static const int PRODUCTION_HASH = HashingUtils::HashString("PRODUCTION");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PRODUCTION_HASH = -2056856391;
 
 
         SubscriptionType GetSubscriptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRODUCTION_HASH)
+          switch (hashCode)
           {
+          case PRODUCTION_HASH:
             return SubscriptionType::PRODUCTION;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -45,6 +45,9 @@
 #include <aws/cloudsearch/model/UpdateScalingParametersResult.h>
 #include <aws/cloudsearch/model/UpdateServiceAccessPoliciesResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -256,6 +259,18 @@ namespace Model
          */
         virtual void BuildSuggestersAsync(const Model::BuildSuggestersRequest& request, const BuildSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BuildSuggestersCallable(const Model::BuildSuggestersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BuildSuggestersOutcomeCallable BuildSuggestersCallable(Model::BuildSuggestersRequest&& request) const;
+
+        /**
+         * Same as BuildSuggestersAsync(const Model::BuildSuggestersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BuildSuggestersAsync(Model::BuildSuggestersRequest&& request, const BuildSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new search domain. For more information, see <a
          * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/creating-domains.html"
@@ -284,6 +299,18 @@ namespace Model
          */
         virtual void CreateDomainAsync(const Model::CreateDomainRequest& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDomainCallable(const Model::CreateDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDomainOutcomeCallable CreateDomainCallable(Model::CreateDomainRequest&& request) const;
+
+        /**
+         * Same as CreateDomainAsync(const Model::CreateDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDomainAsync(Model::CreateDomainRequest&& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures an analysis scheme that can be applied to a <code>text</code> or
          * <code>text-array</code> field to define language-specific text processing
@@ -318,6 +345,18 @@ namespace Model
          */
         virtual void DefineAnalysisSchemeAsync(const Model::DefineAnalysisSchemeRequest& request, const DefineAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DefineAnalysisSchemeCallable(const Model::DefineAnalysisSchemeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DefineAnalysisSchemeOutcomeCallable DefineAnalysisSchemeCallable(Model::DefineAnalysisSchemeRequest&& request) const;
+
+        /**
+         * Same as DefineAnalysisSchemeAsync(const Model::DefineAnalysisSchemeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DefineAnalysisSchemeAsync(Model::DefineAnalysisSchemeRequest&& request, const DefineAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures an <code><a>Expression</a></code> for the search domain. Used to
          * create new expressions and modify existing ones. If the expression exists, the
@@ -352,6 +391,18 @@ namespace Model
          */
         virtual void DefineExpressionAsync(const Model::DefineExpressionRequest& request, const DefineExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DefineExpressionCallable(const Model::DefineExpressionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DefineExpressionOutcomeCallable DefineExpressionCallable(Model::DefineExpressionRequest&& request) const;
+
+        /**
+         * Same as DefineExpressionAsync(const Model::DefineExpressionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DefineExpressionAsync(Model::DefineExpressionRequest&& request, const DefineExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures an <code><a>IndexField</a></code> for the search domain. Used to
          * create new fields and modify existing ones. You must specify the name of the
@@ -398,6 +449,18 @@ namespace Model
          */
         virtual void DefineIndexFieldAsync(const Model::DefineIndexFieldRequest& request, const DefineIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DefineIndexFieldCallable(const Model::DefineIndexFieldRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DefineIndexFieldOutcomeCallable DefineIndexFieldCallable(Model::DefineIndexFieldRequest&& request) const;
+
+        /**
+         * Same as DefineIndexFieldAsync(const Model::DefineIndexFieldRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DefineIndexFieldAsync(Model::DefineIndexFieldRequest&& request, const DefineIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures a suggester for a domain. A suggester enables you to display
          * possible matches before users finish typing their queries. When you configure a
@@ -438,6 +501,18 @@ namespace Model
          */
         virtual void DefineSuggesterAsync(const Model::DefineSuggesterRequest& request, const DefineSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DefineSuggesterCallable(const Model::DefineSuggesterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DefineSuggesterOutcomeCallable DefineSuggesterCallable(Model::DefineSuggesterRequest&& request) const;
+
+        /**
+         * Same as DefineSuggesterAsync(const Model::DefineSuggesterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DefineSuggesterAsync(Model::DefineSuggesterRequest&& request, const DefineSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an analysis scheme. For more information, see <a
          * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-analysis-schemes.html"
@@ -466,6 +541,18 @@ namespace Model
          */
         virtual void DeleteAnalysisSchemeAsync(const Model::DeleteAnalysisSchemeRequest& request, const DeleteAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAnalysisSchemeCallable(const Model::DeleteAnalysisSchemeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteAnalysisSchemeOutcomeCallable DeleteAnalysisSchemeCallable(Model::DeleteAnalysisSchemeRequest&& request) const;
+
+        /**
+         * Same as DeleteAnalysisSchemeAsync(const Model::DeleteAnalysisSchemeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteAnalysisSchemeAsync(Model::DeleteAnalysisSchemeRequest&& request, const DeleteAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes a search domain and all of its data. Once a domain has
          * been deleted, it cannot be recovered. For more information, see <a
@@ -497,6 +584,18 @@ namespace Model
          */
         virtual void DeleteDomainAsync(const Model::DeleteDomainRequest& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDomainCallable(const Model::DeleteDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDomainOutcomeCallable DeleteDomainCallable(Model::DeleteDomainRequest&& request) const;
+
+        /**
+         * Same as DeleteDomainAsync(const Model::DeleteDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDomainAsync(Model::DeleteDomainRequest&& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes an <code><a>Expression</a></code> from the search domain. For more
          * information, see <a
@@ -528,6 +627,18 @@ namespace Model
          */
         virtual void DeleteExpressionAsync(const Model::DeleteExpressionRequest& request, const DeleteExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteExpressionCallable(const Model::DeleteExpressionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteExpressionOutcomeCallable DeleteExpressionCallable(Model::DeleteExpressionRequest&& request) const;
+
+        /**
+         * Same as DeleteExpressionAsync(const Model::DeleteExpressionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteExpressionAsync(Model::DeleteExpressionRequest&& request, const DeleteExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes an <code><a>IndexField</a></code> from the search domain. For more
          * information, see <a
@@ -559,6 +670,18 @@ namespace Model
          */
         virtual void DeleteIndexFieldAsync(const Model::DeleteIndexFieldRequest& request, const DeleteIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIndexFieldCallable(const Model::DeleteIndexFieldRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteIndexFieldOutcomeCallable DeleteIndexFieldCallable(Model::DeleteIndexFieldRequest&& request) const;
+
+        /**
+         * Same as DeleteIndexFieldAsync(const Model::DeleteIndexFieldRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteIndexFieldAsync(Model::DeleteIndexFieldRequest&& request, const DeleteIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a suggester. For more information, see <a
          * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/getting-suggestions.html"
@@ -587,6 +710,18 @@ namespace Model
          */
         virtual void DeleteSuggesterAsync(const Model::DeleteSuggesterRequest& request, const DeleteSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSuggesterCallable(const Model::DeleteSuggesterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteSuggesterOutcomeCallable DeleteSuggesterCallable(Model::DeleteSuggesterRequest&& request) const;
+
+        /**
+         * Same as DeleteSuggesterAsync(const Model::DeleteSuggesterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteSuggesterAsync(Model::DeleteSuggesterRequest&& request, const DeleteSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the analysis schemes configured for a domain. An analysis scheme defines
          * language-specific text processing options for a <code>text</code> field. Can be
@@ -630,6 +765,18 @@ namespace Model
          */
         virtual void DescribeAnalysisSchemesAsync(const Model::DescribeAnalysisSchemesRequest& request, const DescribeAnalysisSchemesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAnalysisSchemesCallable(const Model::DescribeAnalysisSchemesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAnalysisSchemesOutcomeCallable DescribeAnalysisSchemesCallable(Model::DescribeAnalysisSchemesRequest&& request) const;
+
+        /**
+         * Same as DescribeAnalysisSchemesAsync(const Model::DescribeAnalysisSchemesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAnalysisSchemesAsync(Model::DescribeAnalysisSchemesRequest&& request, const DescribeAnalysisSchemesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the availability options configured for a domain. By default, shows the
          * configuration with any pending changes. Set the <code>Deployed</code> option to
@@ -667,6 +814,18 @@ namespace Model
          */
         virtual void DescribeAvailabilityOptionsAsync(const Model::DescribeAvailabilityOptionsRequest& request, const DescribeAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAvailabilityOptionsCallable(const Model::DescribeAvailabilityOptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAvailabilityOptionsOutcomeCallable DescribeAvailabilityOptionsCallable(Model::DescribeAvailabilityOptionsRequest&& request) const;
+
+        /**
+         * Same as DescribeAvailabilityOptionsAsync(const Model::DescribeAvailabilityOptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAvailabilityOptionsAsync(Model::DescribeAvailabilityOptionsRequest&& request, const DescribeAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the search domains owned by this account. Can be
          * limited to specific domains. Shows all domains by default. To get the number of
@@ -710,6 +869,18 @@ namespace Model
          */
         virtual void DescribeDomainsAsync(const Model::DescribeDomainsRequest& request, const DescribeDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDomainsCallable(const Model::DescribeDomainsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDomainsOutcomeCallable DescribeDomainsCallable(Model::DescribeDomainsRequest&& request) const;
+
+        /**
+         * Same as DescribeDomainsAsync(const Model::DescribeDomainsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDomainsAsync(Model::DescribeDomainsRequest&& request, const DescribeDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the expressions configured for the search domain. Can be limited to
          * specific expressions by name. By default, shows all expressions and includes any
@@ -750,6 +921,18 @@ namespace Model
          */
         virtual void DescribeExpressionsAsync(const Model::DescribeExpressionsRequest& request, const DescribeExpressionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeExpressionsCallable(const Model::DescribeExpressionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeExpressionsOutcomeCallable DescribeExpressionsCallable(Model::DescribeExpressionsRequest&& request) const;
+
+        /**
+         * Same as DescribeExpressionsAsync(const Model::DescribeExpressionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeExpressionsAsync(Model::DescribeExpressionsRequest&& request, const DescribeExpressionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the index fields configured for the search domain. Can
          * be limited to specific fields by name. By default, shows all fields and includes
@@ -790,6 +973,18 @@ namespace Model
          */
         virtual void DescribeIndexFieldsAsync(const Model::DescribeIndexFieldsRequest& request, const DescribeIndexFieldsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeIndexFieldsCallable(const Model::DescribeIndexFieldsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeIndexFieldsOutcomeCallable DescribeIndexFieldsCallable(Model::DescribeIndexFieldsRequest&& request) const;
+
+        /**
+         * Same as DescribeIndexFieldsAsync(const Model::DescribeIndexFieldsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeIndexFieldsAsync(Model::DescribeIndexFieldsRequest&& request, const DescribeIndexFieldsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the scaling parameters configured for a domain. A domain's scaling
          * parameters specify the desired search instance type and replication count. For
@@ -824,6 +1019,18 @@ namespace Model
          */
         virtual void DescribeScalingParametersAsync(const Model::DescribeScalingParametersRequest& request, const DescribeScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScalingParametersCallable(const Model::DescribeScalingParametersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeScalingParametersOutcomeCallable DescribeScalingParametersCallable(Model::DescribeScalingParametersRequest&& request) const;
+
+        /**
+         * Same as DescribeScalingParametersAsync(const Model::DescribeScalingParametersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeScalingParametersAsync(Model::DescribeScalingParametersRequest&& request, const DescribeScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the access policies that control access to the
          * domain's document and search endpoints. By default, shows the configuration with
@@ -864,6 +1071,18 @@ namespace Model
          */
         virtual void DescribeServiceAccessPoliciesAsync(const Model::DescribeServiceAccessPoliciesRequest& request, const DescribeServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeServiceAccessPoliciesCallable(const Model::DescribeServiceAccessPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeServiceAccessPoliciesOutcomeCallable DescribeServiceAccessPoliciesCallable(Model::DescribeServiceAccessPoliciesRequest&& request) const;
+
+        /**
+         * Same as DescribeServiceAccessPoliciesAsync(const Model::DescribeServiceAccessPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeServiceAccessPoliciesAsync(Model::DescribeServiceAccessPoliciesRequest&& request, const DescribeServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the suggesters configured for a domain. A suggester enables you to
          * display possible matches before users finish typing their queries. Can be
@@ -907,6 +1126,18 @@ namespace Model
          */
         virtual void DescribeSuggestersAsync(const Model::DescribeSuggestersRequest& request, const DescribeSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSuggestersCallable(const Model::DescribeSuggestersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSuggestersOutcomeCallable DescribeSuggestersCallable(Model::DescribeSuggestersRequest&& request) const;
+
+        /**
+         * Same as DescribeSuggestersAsync(const Model::DescribeSuggestersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSuggestersAsync(Model::DescribeSuggestersRequest&& request, const DescribeSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Tells the search domain to start indexing its documents using the latest
          * indexing options. This operation must be invoked to activate options whose
@@ -932,6 +1163,18 @@ namespace Model
          */
         virtual void IndexDocumentsAsync(const Model::IndexDocumentsRequest& request, const IndexDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as IndexDocumentsCallable(const Model::IndexDocumentsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::IndexDocumentsOutcomeCallable IndexDocumentsCallable(Model::IndexDocumentsRequest&& request) const;
+
+        /**
+         * Same as IndexDocumentsAsync(const Model::IndexDocumentsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void IndexDocumentsAsync(Model::IndexDocumentsRequest&& request, const IndexDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all search domains owned by an account.</p>
          */
@@ -951,6 +1194,18 @@ namespace Model
          */
         virtual void ListDomainNamesAsync(const Model::ListDomainNamesRequest& request, const ListDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDomainNamesCallable(const Model::ListDomainNamesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDomainNamesOutcomeCallable ListDomainNamesCallable(Model::ListDomainNamesRequest&& request) const;
+
+        /**
+         * Same as ListDomainNamesAsync(const Model::ListDomainNamesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDomainNamesAsync(Model::ListDomainNamesRequest&& request, const ListDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures the availability options for a domain. Enabling the Multi-AZ
          * option expands an Amazon CloudSearch domain to an additional Availability Zone
@@ -991,6 +1246,18 @@ namespace Model
          */
         virtual void UpdateAvailabilityOptionsAsync(const Model::UpdateAvailabilityOptionsRequest& request, const UpdateAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAvailabilityOptionsCallable(const Model::UpdateAvailabilityOptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateAvailabilityOptionsOutcomeCallable UpdateAvailabilityOptionsCallable(Model::UpdateAvailabilityOptionsRequest&& request) const;
+
+        /**
+         * Same as UpdateAvailabilityOptionsAsync(const Model::UpdateAvailabilityOptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateAvailabilityOptionsAsync(Model::UpdateAvailabilityOptionsRequest&& request, const UpdateAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures scaling parameters for a domain. A domain's scaling parameters
          * specify the desired search instance type and replication count. Amazon
@@ -1034,6 +1301,18 @@ namespace Model
          */
         virtual void UpdateScalingParametersAsync(const Model::UpdateScalingParametersRequest& request, const UpdateScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateScalingParametersCallable(const Model::UpdateScalingParametersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateScalingParametersOutcomeCallable UpdateScalingParametersCallable(Model::UpdateScalingParametersRequest&& request) const;
+
+        /**
+         * Same as UpdateScalingParametersAsync(const Model::UpdateScalingParametersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateScalingParametersAsync(Model::UpdateScalingParametersRequest&& request, const UpdateScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures the access rules that control access to the domain's document and
          * search endpoints. For more information, see <a
@@ -1062,6 +1341,140 @@ namespace Model
          */
         virtual void UpdateServiceAccessPoliciesAsync(const Model::UpdateServiceAccessPoliciesRequest& request, const UpdateServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateServiceAccessPoliciesCallable(const Model::UpdateServiceAccessPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateServiceAccessPoliciesOutcomeCallable UpdateServiceAccessPoliciesCallable(Model::UpdateServiceAccessPoliciesRequest&& request) const;
+
+        /**
+         * Same as UpdateServiceAccessPoliciesAsync(const Model::UpdateServiceAccessPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateServiceAccessPoliciesAsync(Model::UpdateServiceAccessPoliciesRequest&& request, const UpdateServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of BuildSuggesters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::BuildSuggestersRequest, Model::BuildSuggestersOutcome> BuildSuggestersAwaitable(Model::BuildSuggestersRequest request) const;
+
+        /**
+         * co_await-able form of CreateDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::CreateDomainRequest, Model::CreateDomainOutcome> CreateDomainAwaitable(Model::CreateDomainRequest request) const;
+
+        /**
+         * co_await-able form of DefineAnalysisScheme(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DefineAnalysisSchemeRequest, Model::DefineAnalysisSchemeOutcome> DefineAnalysisSchemeAwaitable(Model::DefineAnalysisSchemeRequest request) const;
+
+        /**
+         * co_await-able form of DefineExpression(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DefineExpressionRequest, Model::DefineExpressionOutcome> DefineExpressionAwaitable(Model::DefineExpressionRequest request) const;
+
+        /**
+         * co_await-able form of DefineIndexField(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DefineIndexFieldRequest, Model::DefineIndexFieldOutcome> DefineIndexFieldAwaitable(Model::DefineIndexFieldRequest request) const;
+
+        /**
+         * co_await-able form of DefineSuggester(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DefineSuggesterRequest, Model::DefineSuggesterOutcome> DefineSuggesterAwaitable(Model::DefineSuggesterRequest request) const;
+
+        /**
+         * co_await-able form of DeleteAnalysisScheme(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DeleteAnalysisSchemeRequest, Model::DeleteAnalysisSchemeOutcome> DeleteAnalysisSchemeAwaitable(Model::DeleteAnalysisSchemeRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DeleteDomainRequest, Model::DeleteDomainOutcome> DeleteDomainAwaitable(Model::DeleteDomainRequest request) const;
+
+        /**
+         * co_await-able form of DeleteExpression(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DeleteExpressionRequest, Model::DeleteExpressionOutcome> DeleteExpressionAwaitable(Model::DeleteExpressionRequest request) const;
+
+        /**
+         * co_await-able form of DeleteIndexField(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DeleteIndexFieldRequest, Model::DeleteIndexFieldOutcome> DeleteIndexFieldAwaitable(Model::DeleteIndexFieldRequest request) const;
+
+        /**
+         * co_await-able form of DeleteSuggester(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DeleteSuggesterRequest, Model::DeleteSuggesterOutcome> DeleteSuggesterAwaitable(Model::DeleteSuggesterRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAnalysisSchemes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DescribeAnalysisSchemesRequest, Model::DescribeAnalysisSchemesOutcome> DescribeAnalysisSchemesAwaitable(Model::DescribeAnalysisSchemesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAvailabilityOptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DescribeAvailabilityOptionsRequest, Model::DescribeAvailabilityOptionsOutcome> DescribeAvailabilityOptionsAwaitable(Model::DescribeAvailabilityOptionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDomains(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DescribeDomainsRequest, Model::DescribeDomainsOutcome> DescribeDomainsAwaitable(Model::DescribeDomainsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeExpressions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DescribeExpressionsRequest, Model::DescribeExpressionsOutcome> DescribeExpressionsAwaitable(Model::DescribeExpressionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeIndexFields(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DescribeIndexFieldsRequest, Model::DescribeIndexFieldsOutcome> DescribeIndexFieldsAwaitable(Model::DescribeIndexFieldsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeScalingParameters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DescribeScalingParametersRequest, Model::DescribeScalingParametersOutcome> DescribeScalingParametersAwaitable(Model::DescribeScalingParametersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeServiceAccessPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DescribeServiceAccessPoliciesRequest, Model::DescribeServiceAccessPoliciesOutcome> DescribeServiceAccessPoliciesAwaitable(Model::DescribeServiceAccessPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSuggesters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::DescribeSuggestersRequest, Model::DescribeSuggestersOutcome> DescribeSuggestersAwaitable(Model::DescribeSuggestersRequest request) const;
+
+        /**
+         * co_await-able form of IndexDocuments(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::IndexDocumentsRequest, Model::IndexDocumentsOutcome> IndexDocumentsAwaitable(Model::IndexDocumentsRequest request) const;
+
+        /**
+         * co_await-able form of ListDomainNames(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::ListDomainNamesRequest, Model::ListDomainNamesOutcome> ListDomainNamesAwaitable(Model::ListDomainNamesRequest request) const;
+
+        /**
+         * co_await-able form of UpdateAvailabilityOptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::UpdateAvailabilityOptionsRequest, Model::UpdateAvailabilityOptionsOutcome> UpdateAvailabilityOptionsAwaitable(Model::UpdateAvailabilityOptionsRequest request) const;
+
+        /**
+         * co_await-able form of UpdateScalingParameters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::UpdateScalingParametersRequest, Model::UpdateScalingParametersOutcome> UpdateScalingParametersAwaitable(Model::UpdateScalingParametersRequest request) const;
+
+        /**
+         * co_await-able form of UpdateServiceAccessPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchClient, Model::UpdateServiceAccessPoliciesRequest, Model::UpdateServiceAccessPoliciesOutcome> UpdateServiceAccessPoliciesAwaitable(Model::UpdateServiceAccessPoliciesRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
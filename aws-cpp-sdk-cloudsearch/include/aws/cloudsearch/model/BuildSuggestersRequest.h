@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     BuildSuggestersRequest();
+    inline const char* GetServiceRequestName() const override { return "BuildSuggesters"; }
+
     Aws::String SerializePayload() const override;
 
     
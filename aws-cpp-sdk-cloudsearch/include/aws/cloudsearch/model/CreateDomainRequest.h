@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateDomainRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDomain"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     DefineAnalysisSchemeRequest();
+    inline const char* GetServiceRequestName() const override { return "DefineAnalysisScheme"; }
+
     Aws::String SerializePayload() const override;
 
     
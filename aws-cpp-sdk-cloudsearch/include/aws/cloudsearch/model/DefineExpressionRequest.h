@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     DefineExpressionRequest();
+    inline const char* GetServiceRequestName() const override { return "DefineExpression"; }
+
     Aws::String SerializePayload() const override;
 
     
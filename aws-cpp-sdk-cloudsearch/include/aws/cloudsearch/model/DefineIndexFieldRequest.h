@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     DefineIndexFieldRequest();
+    inline const char* GetServiceRequestName() const override { return "DefineIndexField"; }
+
     Aws::String SerializePayload() const override;
 
     
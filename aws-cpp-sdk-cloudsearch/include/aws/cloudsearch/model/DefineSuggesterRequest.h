@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     DefineSuggesterRequest();
+    inline const char* GetServiceRequestName() const override { return "DefineSuggester"; }
+
     Aws::String SerializePayload() const override;
 
     
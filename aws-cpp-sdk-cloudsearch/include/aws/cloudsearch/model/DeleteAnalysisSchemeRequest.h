@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DeleteAnalysisSchemeRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteAnalysisScheme"; }
+
     Aws::String SerializePayload() const override;
 
     
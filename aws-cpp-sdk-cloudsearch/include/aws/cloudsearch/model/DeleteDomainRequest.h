@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteDomainRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDomain"; }
+
     Aws::String SerializePayload() const override;
 
     /**
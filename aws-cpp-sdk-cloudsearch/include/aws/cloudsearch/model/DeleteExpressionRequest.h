@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DeleteExpressionRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteExpression"; }
+
     Aws::String SerializePayload() const override;
 
     
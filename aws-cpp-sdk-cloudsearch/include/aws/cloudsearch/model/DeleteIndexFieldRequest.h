@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DeleteIndexFieldRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteIndexField"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DeleteSuggesterRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteSuggester"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     DescribeAnalysisSchemesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAnalysisSchemes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
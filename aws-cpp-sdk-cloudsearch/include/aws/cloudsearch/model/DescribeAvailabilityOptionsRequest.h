@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     DescribeAvailabilityOptionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAvailabilityOptions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     DescribeDomainsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDomains"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     DescribeExpressionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeExpressions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     DescribeIndexFieldsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeIndexFields"; }
+
     Aws::String SerializePayload() const override;
 
     /**
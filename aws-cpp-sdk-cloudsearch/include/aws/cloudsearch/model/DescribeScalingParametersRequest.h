@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeScalingParametersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeScalingParameters"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     DescribeServiceAccessPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeServiceAccessPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     /**
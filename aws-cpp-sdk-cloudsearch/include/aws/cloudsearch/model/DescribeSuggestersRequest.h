@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     DescribeSuggestersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSuggesters"; }
+
     Aws::String SerializePayload() const override;
 
     /**
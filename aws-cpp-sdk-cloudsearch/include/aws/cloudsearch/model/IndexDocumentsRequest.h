@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     IndexDocumentsRequest();
+    inline const char* GetServiceRequestName() const override { return "IndexDocuments"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     ListDomainNamesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListDomainNames"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateAvailabilityOptionsRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateAvailabilityOptions"; }
+
     Aws::String SerializePayload() const override;
 
     
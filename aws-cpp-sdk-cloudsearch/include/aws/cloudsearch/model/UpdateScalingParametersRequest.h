@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     UpdateScalingParametersRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateScalingParameters"; }
+
     Aws::String SerializePayload() const override;
 
     
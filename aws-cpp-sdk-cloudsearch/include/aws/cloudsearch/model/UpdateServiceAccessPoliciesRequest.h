@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateServiceAccessPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateServiceAccessPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -133,7 +133,7 @@ BuildSuggestersOutcome CloudSearchClient::BuildSuggesters(const BuildSuggestersR
 
 BuildSuggestersOutcomeCallable CloudSearchClient::BuildSuggestersCallable(const BuildSuggestersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BuildSuggesters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BuildSuggesters( request ); } );
 }
 
 void CloudSearchClient::BuildSuggestersAsync(const BuildSuggestersRequest& request, const BuildSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -141,6 +141,16 @@ void CloudSearchClient::BuildSuggestersAsync(const BuildSuggestersRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->BuildSuggestersAsyncHelper( request, handler, context ); } );
 }
 
+BuildSuggestersOutcomeCallable CloudSearchClient::BuildSuggestersCallable(BuildSuggestersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::BuildSuggesters, this, std::move(request)));
+}
+
+void CloudSearchClient::BuildSuggestersAsync(BuildSuggestersRequest&& request, const BuildSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::BuildSuggestersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::BuildSuggestersAsyncHelper(const BuildSuggestersRequest& request, const BuildSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BuildSuggesters(request), context);
@@ -163,7 +173,7 @@ CreateDomainOutcome CloudSearchClient::CreateDomain(const CreateDomainRequest& r
 
 CreateDomainOutcomeCallable CloudSearchClient::CreateDomainCallable(const CreateDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDomain( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDomain( request ); } );
 }
 
 void CloudSearchClient::CreateDomainAsync(const CreateDomainRequest& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -171,6 +181,16 @@ void CloudSearchClient::CreateDomainAsync(const CreateDomainRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CreateDomainAsyncHelper( request, handler, context ); } );
 }
 
+CreateDomainOutcomeCallable CloudSearchClient::CreateDomainCallable(CreateDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::CreateDomain, this, std::move(request)));
+}
+
+void CloudSearchClient::CreateDomainAsync(CreateDomainRequest&& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::CreateDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::CreateDomainAsyncHelper(const CreateDomainRequest& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDomain(request), context);
@@ -193,7 +213,7 @@ DefineAnalysisSchemeOutcome CloudSearchClient::DefineAnalysisScheme(const Define
 
 DefineAnalysisSchemeOutcomeCallable CloudSearchClient::DefineAnalysisSchemeCallable(const DefineAnalysisSchemeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DefineAnalysisScheme( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DefineAnalysisScheme( request ); } );
 }
 
 void CloudSearchClient::DefineAnalysisSchemeAsync(const DefineAnalysisSchemeRequest& request, const DefineAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -201,6 +221,16 @@ void CloudSearchClient::DefineAnalysisSchemeAsync(const DefineAnalysisSchemeRequ
   m_executor->Submit( [this, request, handler, context](){ this->DefineAnalysisSchemeAsyncHelper( request, handler, context ); } );
 }
 
+DefineAnalysisSchemeOutcomeCallable CloudSearchClient::DefineAnalysisSchemeCallable(DefineAnalysisSchemeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DefineAnalysisScheme, this, std::move(request)));
+}
+
+void CloudSearchClient::DefineAnalysisSchemeAsync(DefineAnalysisSchemeRequest&& request, const DefineAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DefineAnalysisSchemeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DefineAnalysisSchemeAsyncHelper(const DefineAnalysisSchemeRequest& request, const DefineAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DefineAnalysisScheme(request), context);
@@ -223,7 +253,7 @@ DefineExpressionOutcome CloudSearchClient::DefineExpression(const DefineExpressi
 
 DefineExpressionOutcomeCallable CloudSearchClient::DefineExpressionCallable(const DefineExpressionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DefineExpression( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DefineExpression( request ); } );
 }
 
 void CloudSearchClient::DefineExpressionAsync(const DefineExpressionRequest& request, const DefineExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -231,6 +261,16 @@ void CloudSearchClient::DefineExpressionAsync(const DefineExpressionRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DefineExpressionAsyncHelper( request, handler, context ); } );
 }
 
+DefineExpressionOutcomeCallable CloudSearchClient::DefineExpressionCallable(DefineExpressionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DefineExpression, this, std::move(request)));
+}
+
+void CloudSearchClient::DefineExpressionAsync(DefineExpressionRequest&& request, const DefineExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DefineExpressionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DefineExpressionAsyncHelper(const DefineExpressionRequest& request, const DefineExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DefineExpression(request), context);
@@ -253,7 +293,7 @@ DefineIndexFieldOutcome CloudSearchClient::DefineIndexField(const DefineIndexFie
 
 DefineIndexFieldOutcomeCallable CloudSearchClient::DefineIndexFieldCallable(const DefineIndexFieldRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DefineIndexField( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DefineIndexField( request ); } );
 }
 
 void CloudSearchClient::DefineIndexFieldAsync(const DefineIndexFieldRequest& request, const DefineIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -261,6 +301,16 @@ void CloudSearchClient::DefineIndexFieldAsync(const DefineIndexFieldRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DefineIndexFieldAsyncHelper( request, handler, context ); } );
 }
 
+DefineIndexFieldOutcomeCallable CloudSearchClient::DefineIndexFieldCallable(DefineIndexFieldRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DefineIndexField, this, std::move(request)));
+}
+
+void CloudSearchClient::DefineIndexFieldAsync(DefineIndexFieldRequest&& request, const DefineIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DefineIndexFieldAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DefineIndexFieldAsyncHelper(const DefineIndexFieldRequest& request, const DefineIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DefineIndexField(request), context);
@@ -283,7 +333,7 @@ DefineSuggesterOutcome CloudSearchClient::DefineSuggester(const DefineSuggesterR
 
 DefineSuggesterOutcomeCallable CloudSearchClient::DefineSuggesterCallable(const DefineSuggesterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DefineSuggester( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DefineSuggester( request ); } );
 }
 
 void CloudSearchClient::DefineSuggesterAsync(const DefineSuggesterRequest& request, const DefineSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -291,6 +341,16 @@ void CloudSearchClient::DefineSuggesterAsync(const DefineSuggesterRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DefineSuggesterAsyncHelper( request, handler, context ); } );
 }
 
+DefineSuggesterOutcomeCallable CloudSearchClient::DefineSuggesterCallable(DefineSuggesterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DefineSuggester, this, std::move(request)));
+}
+
+void CloudSearchClient::DefineSuggesterAsync(DefineSuggesterRequest&& request, const DefineSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DefineSuggesterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DefineSuggesterAsyncHelper(const DefineSuggesterRequest& request, const DefineSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DefineSuggester(request), context);
@@ -313,7 +373,7 @@ DeleteAnalysisSchemeOutcome CloudSearchClient::DeleteAnalysisScheme(const Delete
 
 DeleteAnalysisSchemeOutcomeCallable CloudSearchClient::DeleteAnalysisSchemeCallable(const DeleteAnalysisSchemeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteAnalysisScheme( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteAnalysisScheme( request ); } );
 }
 
 void CloudSearchClient::DeleteAnalysisSchemeAsync(const DeleteAnalysisSchemeRequest& request, const DeleteAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -321,6 +381,16 @@ void CloudSearchClient::DeleteAnalysisSchemeAsync(const DeleteAnalysisSchemeRequ
   m_executor->Submit( [this, request, handler, context](){ this->DeleteAnalysisSchemeAsyncHelper( request, handler, context ); } );
 }
 
+DeleteAnalysisSchemeOutcomeCallable CloudSearchClient::DeleteAnalysisSchemeCallable(DeleteAnalysisSchemeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DeleteAnalysisScheme, this, std::move(request)));
+}
+
+void CloudSearchClient::DeleteAnalysisSchemeAsync(DeleteAnalysisSchemeRequest&& request, const DeleteAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DeleteAnalysisSchemeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DeleteAnalysisSchemeAsyncHelper(const DeleteAnalysisSchemeRequest& request, const DeleteAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteAnalysisScheme(request), context);
@@ -343,7 +413,7 @@ DeleteDomainOutcome CloudSearchClient::DeleteDomain(const DeleteDomainRequest& r
 
 DeleteDomainOutcomeCallable CloudSearchClient::DeleteDomainCallable(const DeleteDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDomain( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDomain( request ); } );
 }
 
 void CloudSearchClient::DeleteDomainAsync(const DeleteDomainRequest& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -351,6 +421,16 @@ void CloudSearchClient::DeleteDomainAsync(const DeleteDomainRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDomainAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDomainOutcomeCallable CloudSearchClient::DeleteDomainCallable(DeleteDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DeleteDomain, this, std::move(request)));
+}
+
+void CloudSearchClient::DeleteDomainAsync(DeleteDomainRequest&& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DeleteDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DeleteDomainAsyncHelper(const DeleteDomainRequest& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDomain(request), context);
@@ -373,7 +453,7 @@ DeleteExpressionOutcome CloudSearchClient::DeleteExpression(const DeleteExpressi
 
 DeleteExpressionOutcomeCallable CloudSearchClient::DeleteExpressionCallable(const DeleteExpressionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteExpression( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteExpression( request ); } );
 }
 
 void CloudSearchClient::DeleteExpressionAsync(const DeleteExpressionRequest& request, const DeleteExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -381,6 +461,16 @@ void CloudSearchClient::DeleteExpressionAsync(const DeleteExpressionRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DeleteExpressionAsyncHelper( request, handler, context ); } );
 }
 
+DeleteExpressionOutcomeCallable CloudSearchClient::DeleteExpressionCallable(DeleteExpressionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DeleteExpression, this, std::move(request)));
+}
+
+void CloudSearchClient::DeleteExpressionAsync(DeleteExpressionRequest&& request, const DeleteExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DeleteExpressionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DeleteExpressionAsyncHelper(const DeleteExpressionRequest& request, const DeleteExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteExpression(request), context);
@@ -403,7 +493,7 @@ DeleteIndexFieldOutcome CloudSearchClient::DeleteIndexField(const DeleteIndexFie
 
 DeleteIndexFieldOutcomeCallable CloudSearchClient::DeleteIndexFieldCallable(const DeleteIndexFieldRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteIndexField( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteIndexField( request ); } );
 }
 
 void CloudSearchClient::DeleteIndexFieldAsync(const DeleteIndexFieldRequest& request, const DeleteIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -411,6 +501,16 @@ void CloudSearchClient::DeleteIndexFieldAsync(const DeleteIndexFieldRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DeleteIndexFieldAsyncHelper( request, handler, context ); } );
 }
 
+DeleteIndexFieldOutcomeCallable CloudSearchClient::DeleteIndexFieldCallable(DeleteIndexFieldRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DeleteIndexField, this, std::move(request)));
+}
+
+void CloudSearchClient::DeleteIndexFieldAsync(DeleteIndexFieldRequest&& request, const DeleteIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DeleteIndexFieldAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DeleteIndexFieldAsyncHelper(const DeleteIndexFieldRequest& request, const DeleteIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteIndexField(request), context);
@@ -433,7 +533,7 @@ DeleteSuggesterOutcome CloudSearchClient::DeleteSuggester(const DeleteSuggesterR
 
 DeleteSuggesterOutcomeCallable CloudSearchClient::DeleteSuggesterCallable(const DeleteSuggesterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteSuggester( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteSuggester( request ); } );
 }
 
 void CloudSearchClient::DeleteSuggesterAsync(const DeleteSuggesterRequest& request, const DeleteSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -441,6 +541,16 @@ void CloudSearchClient::DeleteSuggesterAsync(const DeleteSuggesterRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DeleteSuggesterAsyncHelper( request, handler, context ); } );
 }
 
+DeleteSuggesterOutcomeCallable CloudSearchClient::DeleteSuggesterCallable(DeleteSuggesterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DeleteSuggester, this, std::move(request)));
+}
+
+void CloudSearchClient::DeleteSuggesterAsync(DeleteSuggesterRequest&& request, const DeleteSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DeleteSuggesterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DeleteSuggesterAsyncHelper(const DeleteSuggesterRequest& request, const DeleteSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteSuggester(request), context);
@@ -463,7 +573,7 @@ DescribeAnalysisSchemesOutcome CloudSearchClient::DescribeAnalysisSchemes(const
 
 DescribeAnalysisSchemesOutcomeCallable CloudSearchClient::DescribeAnalysisSchemesCallable(const DescribeAnalysisSchemesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAnalysisSchemes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAnalysisSchemes( request ); } );
 }
 
 void CloudSearchClient::DescribeAnalysisSchemesAsync(const DescribeAnalysisSchemesRequest& request, const DescribeAnalysisSchemesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -471,6 +581,16 @@ void CloudSearchClient::DescribeAnalysisSchemesAsync(const DescribeAnalysisSchem
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAnalysisSchemesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAnalysisSchemesOutcomeCallable CloudSearchClient::DescribeAnalysisSchemesCallable(DescribeAnalysisSchemesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DescribeAnalysisSchemes, this, std::move(request)));
+}
+
+void CloudSearchClient::DescribeAnalysisSchemesAsync(DescribeAnalysisSchemesRequest&& request, const DescribeAnalysisSchemesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DescribeAnalysisSchemesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DescribeAnalysisSchemesAsyncHelper(const DescribeAnalysisSchemesRequest& request, const DescribeAnalysisSchemesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAnalysisSchemes(request), context);
@@ -493,7 +613,7 @@ DescribeAvailabilityOptionsOutcome CloudSearchClient::DescribeAvailabilityOption
 
 DescribeAvailabilityOptionsOutcomeCallable CloudSearchClient::DescribeAvailabilityOptionsCallable(const DescribeAvailabilityOptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAvailabilityOptions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAvailabilityOptions( request ); } );
 }
 
 void CloudSearchClient::DescribeAvailabilityOptionsAsync(const DescribeAvailabilityOptionsRequest& request, const DescribeAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -501,6 +621,16 @@ void CloudSearchClient::DescribeAvailabilityOptionsAsync(const DescribeAvailabil
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAvailabilityOptionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAvailabilityOptionsOutcomeCallable CloudSearchClient::DescribeAvailabilityOptionsCallable(DescribeAvailabilityOptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DescribeAvailabilityOptions, this, std::move(request)));
+}
+
+void CloudSearchClient::DescribeAvailabilityOptionsAsync(DescribeAvailabilityOptionsRequest&& request, const DescribeAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DescribeAvailabilityOptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DescribeAvailabilityOptionsAsyncHelper(const DescribeAvailabilityOptionsRequest& request, const DescribeAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAvailabilityOptions(request), context);
@@ -523,7 +653,7 @@ DescribeDomainsOutcome CloudSearchClient::DescribeDomains(const DescribeDomainsR
 
 DescribeDomainsOutcomeCallable CloudSearchClient::DescribeDomainsCallable(const DescribeDomainsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDomains( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDomains( request ); } );
 }
 
 void CloudSearchClient::DescribeDomainsAsync(const DescribeDomainsRequest& request, const DescribeDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -531,6 +661,16 @@ void CloudSearchClient::DescribeDomainsAsync(const DescribeDomainsRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDomainsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDomainsOutcomeCallable CloudSearchClient::DescribeDomainsCallable(DescribeDomainsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DescribeDomains, this, std::move(request)));
+}
+
+void CloudSearchClient::DescribeDomainsAsync(DescribeDomainsRequest&& request, const DescribeDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DescribeDomainsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DescribeDomainsAsyncHelper(const DescribeDomainsRequest& request, const DescribeDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDomains(request), context);
@@ -553,7 +693,7 @@ DescribeExpressionsOutcome CloudSearchClient::DescribeExpressions(const Describe
 
 DescribeExpressionsOutcomeCallable CloudSearchClient::DescribeExpressionsCallable(const DescribeExpressionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeExpressions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeExpressions( request ); } );
 }
 
 void CloudSearchClient::DescribeExpressionsAsync(const DescribeExpressionsRequest& request, const DescribeExpressionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -561,6 +701,16 @@ void CloudSearchClient::DescribeExpressionsAsync(const DescribeExpressionsReques
   m_executor->Submit( [this, request, handler, context](){ this->DescribeExpressionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeExpressionsOutcomeCallable CloudSearchClient::DescribeExpressionsCallable(DescribeExpressionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DescribeExpressions, this, std::move(request)));
+}
+
+void CloudSearchClient::DescribeExpressionsAsync(DescribeExpressionsRequest&& request, const DescribeExpressionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DescribeExpressionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DescribeExpressionsAsyncHelper(const DescribeExpressionsRequest& request, const DescribeExpressionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeExpressions(request), context);
@@ -583,7 +733,7 @@ DescribeIndexFieldsOutcome CloudSearchClient::DescribeIndexFields(const Describe
 
 DescribeIndexFieldsOutcomeCallable CloudSearchClient::DescribeIndexFieldsCallable(const DescribeIndexFieldsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeIndexFields( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeIndexFields( request ); } );
 }
 
 void CloudSearchClient::DescribeIndexFieldsAsync(const DescribeIndexFieldsRequest& request, const DescribeIndexFieldsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -591,6 +741,16 @@ void CloudSearchClient::DescribeIndexFieldsAsync(const DescribeIndexFieldsReques
   m_executor->Submit( [this, request, handler, context](){ this->DescribeIndexFieldsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeIndexFieldsOutcomeCallable CloudSearchClient::DescribeIndexFieldsCallable(DescribeIndexFieldsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DescribeIndexFields, this, std::move(request)));
+}
+
+void CloudSearchClient::DescribeIndexFieldsAsync(DescribeIndexFieldsRequest&& request, const DescribeIndexFieldsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DescribeIndexFieldsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DescribeIndexFieldsAsyncHelper(const DescribeIndexFieldsRequest& request, const DescribeIndexFieldsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeIndexFields(request), context);
@@ -613,7 +773,7 @@ DescribeScalingParametersOutcome CloudSearchClient::DescribeScalingParameters(co
 
 DescribeScalingParametersOutcomeCallable CloudSearchClient::DescribeScalingParametersCallable(const DescribeScalingParametersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeScalingParameters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeScalingParameters( request ); } );
 }
 
 void CloudSearchClient::DescribeScalingParametersAsync(const DescribeScalingParametersRequest& request, const DescribeScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -621,6 +781,16 @@ void CloudSearchClient::DescribeScalingParametersAsync(const DescribeScalingPara
   m_executor->Submit( [this, request, handler, context](){ this->DescribeScalingParametersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeScalingParametersOutcomeCallable CloudSearchClient::DescribeScalingParametersCallable(DescribeScalingParametersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DescribeScalingParameters, this, std::move(request)));
+}
+
+void CloudSearchClient::DescribeScalingParametersAsync(DescribeScalingParametersRequest&& request, const DescribeScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DescribeScalingParametersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DescribeScalingParametersAsyncHelper(const DescribeScalingParametersRequest& request, const DescribeScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeScalingParameters(request), context);
@@ -643,7 +813,7 @@ DescribeServiceAccessPoliciesOutcome CloudSearchClient::DescribeServiceAccessPol
 
 DescribeServiceAccessPoliciesOutcomeCallable CloudSearchClient::DescribeServiceAccessPoliciesCallable(const DescribeServiceAccessPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeServiceAccessPolicies( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeServiceAccessPolicies( request ); } );
 }
 
 void CloudSearchClient::DescribeServiceAccessPoliciesAsync(const DescribeServiceAccessPoliciesRequest& request, const DescribeServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -651,6 +821,16 @@ void CloudSearchClient::DescribeServiceAccessPoliciesAsync(const DescribeService
   m_executor->Submit( [this, request, handler, context](){ this->DescribeServiceAccessPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeServiceAccessPoliciesOutcomeCallable CloudSearchClient::DescribeServiceAccessPoliciesCallable(DescribeServiceAccessPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DescribeServiceAccessPolicies, this, std::move(request)));
+}
+
+void CloudSearchClient::DescribeServiceAccessPoliciesAsync(DescribeServiceAccessPoliciesRequest&& request, const DescribeServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DescribeServiceAccessPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DescribeServiceAccessPoliciesAsyncHelper(const DescribeServiceAccessPoliciesRequest& request, const DescribeServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeServiceAccessPolicies(request), context);
@@ -673,7 +853,7 @@ DescribeSuggestersOutcome CloudSearchClient::DescribeSuggesters(const DescribeSu
 
 DescribeSuggestersOutcomeCallable CloudSearchClient::DescribeSuggestersCallable(const DescribeSuggestersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSuggesters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSuggesters( request ); } );
 }
 
 void CloudSearchClient::DescribeSuggestersAsync(const DescribeSuggestersRequest& request, const DescribeSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -681,6 +861,16 @@ void CloudSearchClient::DescribeSuggestersAsync(const DescribeSuggestersRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSuggestersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSuggestersOutcomeCallable CloudSearchClient::DescribeSuggestersCallable(DescribeSuggestersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::DescribeSuggesters, this, std::move(request)));
+}
+
+void CloudSearchClient::DescribeSuggestersAsync(DescribeSuggestersRequest&& request, const DescribeSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::DescribeSuggestersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::DescribeSuggestersAsyncHelper(const DescribeSuggestersRequest& request, const DescribeSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSuggesters(request), context);
@@ -703,7 +893,7 @@ IndexDocumentsOutcome CloudSearchClient::IndexDocuments(const IndexDocumentsRequ
 
 IndexDocumentsOutcomeCallable CloudSearchClient::IndexDocumentsCallable(const IndexDocumentsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->IndexDocuments( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->IndexDocuments( request ); } );
 }
 
 void CloudSearchClient::IndexDocumentsAsync(const IndexDocumentsRequest& request, const IndexDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -711,6 +901,16 @@ void CloudSearchClient::IndexDocumentsAsync(const IndexDocumentsRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->IndexDocumentsAsyncHelper( request, handler, context ); } );
 }
 
+IndexDocumentsOutcomeCallable CloudSearchClient::IndexDocumentsCallable(IndexDocumentsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::IndexDocuments, this, std::move(request)));
+}
+
+void CloudSearchClient::IndexDocumentsAsync(IndexDocumentsRequest&& request, const IndexDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::IndexDocumentsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::IndexDocumentsAsyncHelper(const IndexDocumentsRequest& request, const IndexDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, IndexDocuments(request), context);
@@ -733,7 +933,7 @@ ListDomainNamesOutcome CloudSearchClient::ListDomainNames(const ListDomainNamesR
 
 ListDomainNamesOutcomeCallable CloudSearchClient::ListDomainNamesCallable(const ListDomainNamesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDomainNames( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDomainNames( request ); } );
 }
 
 void CloudSearchClient::ListDomainNamesAsync(const ListDomainNamesRequest& request, const ListDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -741,6 +941,16 @@ void CloudSearchClient::ListDomainNamesAsync(const ListDomainNamesRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ListDomainNamesAsyncHelper( request, handler, context ); } );
 }
 
+ListDomainNamesOutcomeCallable CloudSearchClient::ListDomainNamesCallable(ListDomainNamesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::ListDomainNames, this, std::move(request)));
+}
+
+void CloudSearchClient::ListDomainNamesAsync(ListDomainNamesRequest&& request, const ListDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::ListDomainNamesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::ListDomainNamesAsyncHelper(const ListDomainNamesRequest& request, const ListDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDomainNames(request), context);
@@ -763,7 +973,7 @@ UpdateAvailabilityOptionsOutcome CloudSearchClient::UpdateAvailabilityOptions(co
 
 UpdateAvailabilityOptionsOutcomeCallable CloudSearchClient::UpdateAvailabilityOptionsCallable(const UpdateAvailabilityOptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateAvailabilityOptions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateAvailabilityOptions( request ); } );
 }
 
 void CloudSearchClient::UpdateAvailabilityOptionsAsync(const UpdateAvailabilityOptionsRequest& request, const UpdateAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -771,6 +981,16 @@ void CloudSearchClient::UpdateAvailabilityOptionsAsync(const UpdateAvailabilityO
   m_executor->Submit( [this, request, handler, context](){ this->UpdateAvailabilityOptionsAsyncHelper( request, handler, context ); } );
 }
 
+UpdateAvailabilityOptionsOutcomeCallable CloudSearchClient::UpdateAvailabilityOptionsCallable(UpdateAvailabilityOptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::UpdateAvailabilityOptions, this, std::move(request)));
+}
+
+void CloudSearchClient::UpdateAvailabilityOptionsAsync(UpdateAvailabilityOptionsRequest&& request, const UpdateAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::UpdateAvailabilityOptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::UpdateAvailabilityOptionsAsyncHelper(const UpdateAvailabilityOptionsRequest& request, const UpdateAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateAvailabilityOptions(request), context);
@@ -793,7 +1013,7 @@ UpdateScalingParametersOutcome CloudSearchClient::UpdateScalingParameters(const
 
 UpdateScalingParametersOutcomeCallable CloudSearchClient::UpdateScalingParametersCallable(const UpdateScalingParametersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateScalingParameters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateScalingParameters( request ); } );
 }
 
 void CloudSearchClient::UpdateScalingParametersAsync(const UpdateScalingParametersRequest& request, const UpdateScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -801,6 +1021,16 @@ void CloudSearchClient::UpdateScalingParametersAsync(const UpdateScalingParamete
   m_executor->Submit( [this, request, handler, context](){ this->UpdateScalingParametersAsyncHelper( request, handler, context ); } );
 }
 
+UpdateScalingParametersOutcomeCallable CloudSearchClient::UpdateScalingParametersCallable(UpdateScalingParametersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::UpdateScalingParameters, this, std::move(request)));
+}
+
+void CloudSearchClient::UpdateScalingParametersAsync(UpdateScalingParametersRequest&& request, const UpdateScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::UpdateScalingParametersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::UpdateScalingParametersAsyncHelper(const UpdateScalingParametersRequest& request, const UpdateScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateScalingParameters(request), context);
@@ -823,7 +1053,7 @@ UpdateServiceAccessPoliciesOutcome CloudSearchClient::UpdateServiceAccessPolicie
 
 UpdateServiceAccessPoliciesOutcomeCallable CloudSearchClient::UpdateServiceAccessPoliciesCallable(const UpdateServiceAccessPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateServiceAccessPolicies( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateServiceAccessPolicies( request ); } );
 }
 
 void CloudSearchClient::UpdateServiceAccessPoliciesAsync(const UpdateServiceAccessPoliciesRequest& request, const UpdateServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -831,8 +1061,140 @@ void CloudSearchClient::UpdateServiceAccessPoliciesAsync(const UpdateServiceAcce
   m_executor->Submit( [this, request, handler, context](){ this->UpdateServiceAccessPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+UpdateServiceAccessPoliciesOutcomeCallable CloudSearchClient::UpdateServiceAccessPoliciesCallable(UpdateServiceAccessPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchClient::UpdateServiceAccessPolicies, this, std::move(request)));
+}
+
+void CloudSearchClient::UpdateServiceAccessPoliciesAsync(UpdateServiceAccessPoliciesRequest&& request, const UpdateServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchClient::UpdateServiceAccessPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchClient::UpdateServiceAccessPoliciesAsyncHelper(const UpdateServiceAccessPoliciesRequest& request, const UpdateServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateServiceAccessPolicies(request), context);
 }
 
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<CloudSearchClient, BuildSuggestersRequest, BuildSuggestersOutcome> CloudSearchClient::BuildSuggestersAwaitable(BuildSuggestersRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::BuildSuggesters, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, CreateDomainRequest, CreateDomainOutcome> CloudSearchClient::CreateDomainAwaitable(CreateDomainRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::CreateDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DefineAnalysisSchemeRequest, DefineAnalysisSchemeOutcome> CloudSearchClient::DefineAnalysisSchemeAwaitable(DefineAnalysisSchemeRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DefineAnalysisScheme, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DefineExpressionRequest, DefineExpressionOutcome> CloudSearchClient::DefineExpressionAwaitable(DefineExpressionRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DefineExpression, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DefineIndexFieldRequest, DefineIndexFieldOutcome> CloudSearchClient::DefineIndexFieldAwaitable(DefineIndexFieldRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DefineIndexField, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DefineSuggesterRequest, DefineSuggesterOutcome> CloudSearchClient::DefineSuggesterAwaitable(DefineSuggesterRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DefineSuggester, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DeleteAnalysisSchemeRequest, DeleteAnalysisSchemeOutcome> CloudSearchClient::DeleteAnalysisSchemeAwaitable(DeleteAnalysisSchemeRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DeleteAnalysisScheme, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DeleteDomainRequest, DeleteDomainOutcome> CloudSearchClient::DeleteDomainAwaitable(DeleteDomainRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DeleteDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DeleteExpressionRequest, DeleteExpressionOutcome> CloudSearchClient::DeleteExpressionAwaitable(DeleteExpressionRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DeleteExpression, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DeleteIndexFieldRequest, DeleteIndexFieldOutcome> CloudSearchClient::DeleteIndexFieldAwaitable(DeleteIndexFieldRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DeleteIndexField, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DeleteSuggesterRequest, DeleteSuggesterOutcome> CloudSearchClient::DeleteSuggesterAwaitable(DeleteSuggesterRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DeleteSuggester, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DescribeAnalysisSchemesRequest, DescribeAnalysisSchemesOutcome> CloudSearchClient::DescribeAnalysisSchemesAwaitable(DescribeAnalysisSchemesRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DescribeAnalysisSchemes, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DescribeAvailabilityOptionsRequest, DescribeAvailabilityOptionsOutcome> CloudSearchClient::DescribeAvailabilityOptionsAwaitable(DescribeAvailabilityOptionsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DescribeAvailabilityOptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DescribeDomainsRequest, DescribeDomainsOutcome> CloudSearchClient::DescribeDomainsAwaitable(DescribeDomainsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DescribeDomains, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DescribeExpressionsRequest, DescribeExpressionsOutcome> CloudSearchClient::DescribeExpressionsAwaitable(DescribeExpressionsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DescribeExpressions, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DescribeIndexFieldsRequest, DescribeIndexFieldsOutcome> CloudSearchClient::DescribeIndexFieldsAwaitable(DescribeIndexFieldsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DescribeIndexFields, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DescribeScalingParametersRequest, DescribeScalingParametersOutcome> CloudSearchClient::DescribeScalingParametersAwaitable(DescribeScalingParametersRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DescribeScalingParameters, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DescribeServiceAccessPoliciesRequest, DescribeServiceAccessPoliciesOutcome> CloudSearchClient::DescribeServiceAccessPoliciesAwaitable(DescribeServiceAccessPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DescribeServiceAccessPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, DescribeSuggestersRequest, DescribeSuggestersOutcome> CloudSearchClient::DescribeSuggestersAwaitable(DescribeSuggestersRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::DescribeSuggesters, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, IndexDocumentsRequest, IndexDocumentsOutcome> CloudSearchClient::IndexDocumentsAwaitable(IndexDocumentsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::IndexDocuments, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, ListDomainNamesRequest, ListDomainNamesOutcome> CloudSearchClient::ListDomainNamesAwaitable(ListDomainNamesRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::ListDomainNames, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, UpdateAvailabilityOptionsRequest, UpdateAvailabilityOptionsOutcome> CloudSearchClient::UpdateAvailabilityOptionsAwaitable(UpdateAvailabilityOptionsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::UpdateAvailabilityOptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, UpdateScalingParametersRequest, UpdateScalingParametersOutcome> CloudSearchClient::UpdateScalingParametersAwaitable(UpdateScalingParametersRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::UpdateScalingParameters, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchClient, UpdateServiceAccessPoliciesRequest, UpdateServiceAccessPoliciesOutcome> CloudSearchClient::UpdateServiceAccessPoliciesAwaitable(UpdateServiceAccessPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchClient::UpdateServiceAccessPolicies, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ AccessPoliciesStatus& AccessPoliciesStatus::operator =(const XmlNode& xmlNode)
     XmlNode optionsNode = resultNode.FirstChild("Options");
     if(!optionsNode.IsNull())
     {
-      m_options = StringUtils::Trim(optionsNode.GetText().c_str());
+      m_options = optionsNode.GetTextView().Trim().ToString();
       m_optionsHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
@@ -69,14 +70,14 @@ void AccessPoliciesStatus::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_optionsHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Options=" << StringUtils::URLEncode(m_options.c_str()) << "&";
+      oStream << location << index << locationValue << ".Options=" << StringUtils::URLEncoded(m_options) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      Aws::StringStream statusLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream statusLocationAndMemberSs;
       statusLocationAndMemberSs << location << index << locationValue << ".Status";
-      m_status.OutputToStream(oStream, statusLocationAndMemberSs.str().c_str());
+      m_status.OutputToStream(oStream, statusLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -85,7 +86,7 @@ void AccessPoliciesStatus::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_optionsHasBeenSet)
   {
-      oStream << location << ".Options=" << StringUtils::URLEncode(m_options.c_str()) << "&";
+      oStream << location << ".Options=" << StringUtils::URLEncoded(m_options) << "&";
   }
   if(m_statusHasBeenSet)
   {
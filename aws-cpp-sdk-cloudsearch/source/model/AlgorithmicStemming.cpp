@@ -29,31 +29,35 @@ namespace Aws
       namespace AlgorithmicStemmingMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int minimal_HASH = HashingUtils::HashString("minimal");
-        static const int light_HASH = HashingUtils::HashString("light");
-        static const int full_HASH = HashingUtils::HashString("full");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int none_HASH = 3387192;
+        static const int minimal_HASH = 1064537505;
+        static const int light_HASH = 102970646;
+        static const int full_HASH = 3154575;
 
 
         AlgorithmicStemming GetAlgorithmicStemmingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
+          switch (hashCode)
           {
+          case none_HASH:
             return AlgorithmicStemming::none;
-          }
-          else if (hashCode == minimal_HASH)
-          {
+          case minimal_HASH:
             return AlgorithmicStemming::minimal;
-          }
-          else if (hashCode == light_HASH)
-          {
+          case light_HASH:
             return AlgorithmicStemming::light;
-          }
-          else if (hashCode == full_HASH)
-          {
+          case full_HASH:
             return AlgorithmicStemming::full;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -57,31 +57,31 @@ AnalysisOptions& AnalysisOptions::operator =(const XmlNode& xmlNode)
     XmlNode synonymsNode = resultNode.FirstChild("Synonyms");
     if(!synonymsNode.IsNull())
     {
-      m_synonyms = StringUtils::Trim(synonymsNode.GetText().c_str());
+      m_synonyms = synonymsNode.GetTextView().Trim().ToString();
       m_synonymsHasBeenSet = true;
     }
     XmlNode stopwordsNode = resultNode.FirstChild("Stopwords");
     if(!stopwordsNode.IsNull())
     {
-      m_stopwords = StringUtils::Trim(stopwordsNode.GetText().c_str());
+      m_stopwords = stopwordsNode.GetTextView().Trim().ToString();
       m_stopwordsHasBeenSet = true;
     }
     XmlNode stemmingDictionaryNode = resultNode.FirstChild("StemmingDictionary");
     if(!stemmingDictionaryNode.IsNull())
     {
-      m_stemmingDictionary = StringUtils::Trim(stemmingDictionaryNode.GetText().c_str());
+      m_stemmingDictionary = stemmingDictionaryNode.GetTextView().Trim().ToString();
       m_stemmingDictionaryHasBeenSet = true;
     }
     XmlNode japaneseTokenizationDictionaryNode = resultNode.FirstChild("JapaneseTokenizationDictionary");
     if(!japaneseTokenizationDictionaryNode.IsNull())
     {
-      m_japaneseTokenizationDictionary = StringUtils::Trim(japaneseTokenizationDictionaryNode.GetText().c_str());
+      m_japaneseTokenizationDictionary = japaneseTokenizationDictionaryNode.GetTextView().Trim().ToString();
       m_japaneseTokenizationDictionaryHasBeenSet = true;
     }
     XmlNode algorithmicStemmingNode = resultNode.FirstChild("AlgorithmicStemming");
     if(!algorithmicStemmingNode.IsNull())
     {
-      m_algorithmicStemming = AlgorithmicStemmingMapper::GetAlgorithmicStemmingForName(StringUtils::Trim(algorithmicStemmingNode.GetText().c_str()).c_str());
+      m_algorithmicStemming = AlgorithmicStemmingMapper::GetAlgorithmicStemmingForName(algorithmicStemmingNode.GetTextView().Trim().ToString().c_str());
       m_algorithmicStemmingHasBeenSet = true;
     }
   }
@@ -93,22 +93,22 @@ void AnalysisOptions::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_synonymsHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Synonyms=" << StringUtils::URLEncode(m_synonyms.c_str()) << "&";
+      oStream << location << index << locationValue << ".Synonyms=" << StringUtils::URLEncoded(m_synonyms) << "&";
   }
 
   if(m_stopwordsHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Stopwords=" << StringUtils::URLEncode(m_stopwords.c_str()) << "&";
+      oStream << location << index << locationValue << ".Stopwords=" << StringUtils::URLEncoded(m_stopwords) << "&";
   }
 
   if(m_stemmingDictionaryHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StemmingDictionary=" << StringUtils::URLEncode(m_stemmingDictionary.c_str()) << "&";
+      oStream << location << index << locationValue << ".StemmingDictionary=" << StringUtils::URLEncoded(m_stemmingDictionary) << "&";
   }
 
   if(m_japaneseTokenizationDictionaryHasBeenSet)
   {
-      oStream << location << index << locationValue << ".JapaneseTokenizationDictionary=" << StringUtils::URLEncode(m_japaneseTokenizationDictionary.c_str()) << "&";
+      oStream << location << index << locationValue << ".JapaneseTokenizationDictionary=" << StringUtils::URLEncoded(m_japaneseTokenizationDictionary) << "&";
   }
 
   if(m_algorithmicStemmingHasBeenSet)
@@ -122,19 +122,19 @@ void AnalysisOptions::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_synonymsHasBeenSet)
   {
-      oStream << location << ".Synonyms=" << StringUtils::URLEncode(m_synonyms.c_str()) << "&";
+      oStream << location << ".Synonyms=" << StringUtils::URLEncoded(m_synonyms) << "&";
   }
   if(m_stopwordsHasBeenSet)
   {
-      oStream << location << ".Stopwords=" << StringUtils::URLEncode(m_stopwords.c_str()) << "&";
+      oStream << location << ".Stopwords=" << StringUtils::URLEncoded(m_stopwords) << "&";
   }
   if(m_stemmingDictionaryHasBeenSet)
   {
-      oStream << location << ".StemmingDictionary=" << StringUtils::URLEncode(m_stemmingDictionary.c_str()) << "&";
+      oStream << location << ".StemmingDictionary=" << StringUtils::URLEncoded(m_stemmingDictionary) << "&";
   }
   if(m_japaneseTokenizationDictionaryHasBeenSet)
   {
-      oStream << location << ".JapaneseTokenizationDictionary=" << StringUtils::URLEncode(m_japaneseTokenizationDictionary.c_str()) << "&";
+      oStream << location << ".JapaneseTokenizationDictionary=" << StringUtils::URLEncoded(m_japaneseTokenizationDictionary) << "&";
   }
   if(m_algorithmicStemmingHasBeenSet)
   {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,13 +54,13 @@ AnalysisScheme& AnalysisScheme::operator =(const XmlNode& xmlNode)
     XmlNode analysisSchemeNameNode = resultNode.FirstChild("AnalysisSchemeName");
     if(!analysisSchemeNameNode.IsNull())
     {
-      m_analysisSchemeName = StringUtils::Trim(analysisSchemeNameNode.GetText().c_str());
+      m_analysisSchemeName = analysisSchemeNameNode.GetTextView().Trim().ToString();
       m_analysisSchemeNameHasBeenSet = true;
     }
     XmlNode analysisSchemeLanguageNode = resultNode.FirstChild("AnalysisSchemeLanguage");
     if(!analysisSchemeLanguageNode.IsNull())
     {
-      m_analysisSchemeLanguage = AnalysisSchemeLanguageMapper::GetAnalysisSchemeLanguageForName(StringUtils::Trim(analysisSchemeLanguageNode.GetText().c_str()).c_str());
+      m_analysisSchemeLanguage = AnalysisSchemeLanguageMapper::GetAnalysisSchemeLanguageForName(analysisSchemeLanguageNode.GetTextView().Trim().ToString().c_str());
       m_analysisSchemeLanguageHasBeenSet = true;
     }
     XmlNode analysisOptionsNode = resultNode.FirstChild("AnalysisOptions");
@@ -77,7 +78,7 @@ void AnalysisScheme::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_analysisSchemeNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AnalysisSchemeName=" << StringUtils::URLEncode(m_analysisSchemeName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AnalysisSchemeName=" << StringUtils::URLEncoded(m_analysisSchemeName) << "&";
   }
 
   if(m_analysisSchemeLanguageHasBeenSet)
@@ -87,9 +88,9 @@ void AnalysisScheme::OutputToStream(Aws::OStream& oStream, const char* location,
 
   if(m_analysisOptionsHasBeenSet)
   {
-      Aws::StringStream analysisOptionsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream analysisOptionsLocationAndMemberSs;
       analysisOptionsLocationAndMemberSs << location << index << locationValue << ".AnalysisOptions";
-      m_analysisOptions.OutputToStream(oStream, analysisOptionsLocationAndMemberSs.str().c_str());
+      m_analysisOptions.OutputToStream(oStream, analysisOptionsLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -98,7 +99,7 @@ void AnalysisScheme::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_analysisSchemeNameHasBeenSet)
   {
-      oStream << location << ".AnalysisSchemeName=" << StringUtils::URLEncode(m_analysisSchemeName.c_str()) << "&";
+      oStream << location << ".AnalysisSchemeName=" << StringUtils::URLEncoded(m_analysisSchemeName) << "&";
   }
   if(m_analysisSchemeLanguageHasBeenSet)
   {
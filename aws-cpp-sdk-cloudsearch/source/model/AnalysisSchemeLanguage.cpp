@@ -29,186 +29,128 @@ namespace Aws
       namespace AnalysisSchemeLanguageMapper
       {
 
-        static const int ar_HASH = HashingUtils::HashString("ar");
-        static const int bg_HASH = HashingUtils::HashString("bg");
-        static const int ca_HASH = HashingUtils::HashString("ca");
-        static const int cs_HASH = HashingUtils::HashString("cs");
-        static const int da_HASH = HashingUtils::HashString("da");
-        static const int de_HASH = HashingUtils::HashString("de");
-        static const int el_HASH = HashingUtils::HashString("el");
-        static const int en_HASH = HashingUtils::HashString("en");
-        static const int es_HASH = HashingUtils::HashString("es");
-        static const int eu_HASH = HashingUtils::HashString("eu");
-        static const int fa_HASH = HashingUtils::HashString("fa");
-        static const int fi_HASH = HashingUtils::HashString("fi");
-        static const int fr_HASH = HashingUtils::HashString("fr");
-        static const int ga_HASH = HashingUtils::HashString("ga");
-        static const int gl_HASH = HashingUtils::HashString("gl");
-        static const int he_HASH = HashingUtils::HashString("he");
-        static const int hi_HASH = HashingUtils::HashString("hi");
-        static const int hu_HASH = HashingUtils::HashString("hu");
-        static const int hy_HASH = HashingUtils::HashString("hy");
-        static const int id_HASH = HashingUtils::HashString("id");
-        static const int it_HASH = HashingUtils::HashString("it");
-        static const int ja_HASH = HashingUtils::HashString("ja");
-        static const int ko_HASH = HashingUtils::HashString("ko");
-        static const int lv_HASH = HashingUtils::HashString("lv");
-        static const int mul_HASH = HashingUtils::HashString("mul");
-        static const int nl_HASH = HashingUtils::HashString("nl");
-        static const int no_HASH = HashingUtils::HashString("no");
-        static const int pt_HASH = HashingUtils::HashString("pt");
-        static const int ro_HASH = HashingUtils::HashString("ro");
-        static const int ru_HASH = HashingUtils::HashString("ru");
-        static const int sv_HASH = HashingUtils::HashString("sv");
-        static const int th_HASH = HashingUtils::HashString("th");
-        static const int tr_HASH = HashingUtils::HashString("tr");
-        static const int zh_Hans_HASH = HashingUtils::HashString("zh-Hans");
-        static const int zh_Hant_HASH = HashingUtils::HashString("zh-Hant");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ar_HASH = 3121;
+        static const int bg_HASH = 3141;
+        static const int ca_HASH = 3166;
+        static const int cs_HASH = 3184;
+        static const int da_HASH = 3197;
+        static const int de_HASH = 3201;
+        static const int el_HASH = 3239;
+        static const int en_HASH = 3241;
+        static const int es_HASH = 3246;
+        static const int eu_HASH = 3248;
+        static const int fa_HASH = 3259;
+        static const int fi_HASH = 3267;
+        static const int fr_HASH = 3276;
+        static const int ga_HASH = 3290;
+        static const int gl_HASH = 3301;
+        static const int he_HASH = 3325;
+        static const int hi_HASH = 3329;
+        static const int hu_HASH = 3341;
+        static const int hy_HASH = 3345;
+        static const int id_HASH = 3355;
+        static const int it_HASH = 3371;
+        static const int ja_HASH = 3383;
+        static const int ko_HASH = 3428;
+        static const int lv_HASH = 3466;
+        static const int mul_HASH = 108484;
+        static const int nl_HASH = 3518;
+        static const int no_HASH = 3521;
+        static const int pt_HASH = 3588;
+        static const int ro_HASH = 3645;
+        static const int ru_HASH = 3651;
+        static const int sv_HASH = 3683;
+        static const int th_HASH = 3700;
+        static const int tr_HASH = 3710;
+        static const int zh_Hans_HASH = -372468771;
+        static const int zh_Hant_HASH = -372468770;
 
 
         AnalysisSchemeLanguage GetAnalysisSchemeLanguageForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ar_HASH)
+          switch (hashCode)
           {
+          case ar_HASH:
             return AnalysisSchemeLanguage::ar;
-          }
-          else if (hashCode == bg_HASH)
-          {
+          case bg_HASH:
             return AnalysisSchemeLanguage::bg;
-          }
-          else if (hashCode == ca_HASH)
-          {
+          case ca_HASH:
             return AnalysisSchemeLanguage::ca;
-          }
-          else if (hashCode == cs_HASH)
-          {
+          case cs_HASH:
             return AnalysisSchemeLanguage::cs;
-          }
-          else if (hashCode == da_HASH)
-          {
+          case da_HASH:
             return AnalysisSchemeLanguage::da;
-          }
-          else if (hashCode == de_HASH)
-          {
+          case de_HASH:
             return AnalysisSchemeLanguage::de;
-          }
-          else if (hashCode == el_HASH)
-          {
+          case el_HASH:
             return AnalysisSchemeLanguage::el;
-          }
-          else if (hashCode == en_HASH)
-          {
+          case en_HASH:
             return AnalysisSchemeLanguage::en;
-          }
-          else if (hashCode == es_HASH)
-          {
+          case es_HASH:
             return AnalysisSchemeLanguage::es;
-          }
-          else if (hashCode == eu_HASH)
-          {
+          case eu_HASH:
             return AnalysisSchemeLanguage::eu;
-          }
-          else if (hashCode == fa_HASH)
-          {
+          case fa_HASH:
             return AnalysisSchemeLanguage::fa;
-          }
-          else if (hashCode == fi_HASH)
-          {
+          case fi_HASH:
             return AnalysisSchemeLanguage::fi;
-          }
-          else if (hashCode == fr_HASH)
-          {
+          case fr_HASH:
             return AnalysisSchemeLanguage::fr;
-          }
-          else if (hashCode == ga_HASH)
-          {
+          case ga_HASH:
             return AnalysisSchemeLanguage::ga;
-          }
-          else if (hashCode == gl_HASH)
-          {
+          case gl_HASH:
             return AnalysisSchemeLanguage::gl;
-          }
-          else if (hashCode == he_HASH)
-          {
+          case he_HASH:
             return AnalysisSchemeLanguage::he;
-          }
-          else if (hashCode == hi_HASH)
-          {
+          case hi_HASH:
             return AnalysisSchemeLanguage::hi;
-          }
-          else if (hashCode == hu_HASH)
-          {
+          case hu_HASH:
             return AnalysisSchemeLanguage::hu;
-          }
-          else if (hashCode == hy_HASH)
-          {
+          case hy_HASH:
             return AnalysisSchemeLanguage::hy;
-          }
-          else if (hashCode == id_HASH)
-          {
+          case id_HASH:
             return AnalysisSchemeLanguage::id;
-          }
-          else if (hashCode == it_HASH)
-          {
+          case it_HASH:
             return AnalysisSchemeLanguage::it;
-          }
-          else if (hashCode == ja_HASH)
-          {
+          case ja_HASH:
             return AnalysisSchemeLanguage::ja;
-          }
-          else if (hashCode == ko_HASH)
-          {
+          case ko_HASH:
             return AnalysisSchemeLanguage::ko;
-          }
-          else if (hashCode == lv_HASH)
-          {
+          case lv_HASH:
             return AnalysisSchemeLanguage::lv;
-          }
-          else if (hashCode == mul_HASH)
-          {
+          case mul_HASH:
             return AnalysisSchemeLanguage::mul;
-          }
-          else if (hashCode == nl_HASH)
-          {
+          case nl_HASH:
             return AnalysisSchemeLanguage::nl;
-          }
-          else if (hashCode == no_HASH)
-          {
+          case no_HASH:
             return AnalysisSchemeLanguage::no;
-          }
-          else if (hashCode == pt_HASH)
-          {
+          case pt_HASH:
             return AnalysisSchemeLanguage::pt;
-          }
-          else if (hashCode == ro_HASH)
-          {
+          case ro_HASH:
             return AnalysisSchemeLanguage::ro;
-          }
-          else if (hashCode == ru_HASH)
-          {
+          case ru_HASH:
             return AnalysisSchemeLanguage::ru;
-          }
-          else if (hashCode == sv_HASH)
-          {
+          case sv_HASH:
             return AnalysisSchemeLanguage::sv;
-          }
-          else if (hashCode == th_HASH)
-          {
+          case th_HASH:
             return AnalysisSchemeLanguage::th;
-          }
-          else if (hashCode == tr_HASH)
-          {
+          case tr_HASH:
             return AnalysisSchemeLanguage::tr;
-          }
-          else if (hashCode == zh_Hans_HASH)
-          {
+          case zh_Hans_HASH:
             return AnalysisSchemeLanguage::zh_Hans;
-          }
-          else if (hashCode == zh_Hant_HASH)
-          {
+          case zh_Hant_HASH:
             return AnalysisSchemeLanguage::zh_Hant;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,7 +54,7 @@ AvailabilityOptionsStatus& AvailabilityOptionsStatus::operator =(const XmlNode&
     XmlNode optionsNode = resultNode.FirstChild("Options");
     if(!optionsNode.IsNull())
     {
-      m_options = StringUtils::ConvertToBool(StringUtils::Trim(optionsNode.GetText().c_str()).c_str());
+      m_options = StringUtils::ConvertToBool(optionsNode.GetTextView().Trim().ToString().c_str());
       m_optionsHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
@@ -76,9 +77,9 @@ void AvailabilityOptionsStatus::OutputToStream(Aws::OStream& oStream, const char
 
   if(m_statusHasBeenSet)
   {
-      Aws::StringStream statusLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream statusLocationAndMemberSs;
       statusLocationAndMemberSs << location << index << locationValue << ".Status";
-      m_status.OutputToStream(oStream, statusLocationAndMemberSs.str().c_str());
+      m_status.OutputToStream(oStream, statusLocationAndMemberSs.GetString().c_str());
   }
 
 }
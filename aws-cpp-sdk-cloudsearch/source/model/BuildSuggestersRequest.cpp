@@ -15,6 +15,7 @@
 #include <aws/cloudsearch/model/BuildSuggestersRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudSearch::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ BuildSuggestersRequest::BuildSuggestersRequest() :
 
 Aws::String BuildSuggestersRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=BuildSuggesters&";
   if(m_domainNameHasBeenSet)
   {
-    ss << "DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+    ss << "DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
 
   ss << "Version=2013-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ BuildSuggestersResult& BuildSuggestersResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "BuildSuggestersResult")
+  if (rootNode.GetNameView() != "BuildSuggestersResult")
   {
     resultNode = rootNode.FirstChild("BuildSuggestersResult");
   }
@@ -53,7 +53,7 @@ BuildSuggestersResult& BuildSuggestersResult::operator =(const AmazonWebServiceR
       XmlNode fieldNamesMember = fieldNamesNode.FirstChild("member");
       while(!fieldNamesMember.IsNull())
       {
-        m_fieldNames.push_back(StringUtils::Trim(fieldNamesMember.GetText().c_str()));
+        m_fieldNames.push_back(fieldNamesMember.GetTextView().Trim().ToString());
         fieldNamesMember = fieldNamesMember.NextNode("member");
       }
 
@@ -40,7 +40,7 @@ CreateDomainResult& CreateDomainResult::operator =(const AmazonWebServiceResult<
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateDomainResult")
+  if (rootNode.GetNameView() != "CreateDomainResult")
   {
     resultNode = rootNode.FirstChild("CreateDomainResult");
   }
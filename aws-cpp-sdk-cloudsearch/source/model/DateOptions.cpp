@@ -67,37 +67,37 @@ DateOptions& DateOptions::operator =(const XmlNode& xmlNode)
     XmlNode defaultValueNode = resultNode.FirstChild("DefaultValue");
     if(!defaultValueNode.IsNull())
     {
-      m_defaultValue = StringUtils::Trim(defaultValueNode.GetText().c_str());
+      m_defaultValue = defaultValueNode.GetTextView().Trim().ToString();
       m_defaultValueHasBeenSet = true;
     }
     XmlNode sourceFieldNode = resultNode.FirstChild("SourceField");
     if(!sourceFieldNode.IsNull())
     {
-      m_sourceField = StringUtils::Trim(sourceFieldNode.GetText().c_str());
+      m_sourceField = sourceFieldNode.GetTextView().Trim().ToString();
       m_sourceFieldHasBeenSet = true;
     }
     XmlNode facetEnabledNode = resultNode.FirstChild("FacetEnabled");
     if(!facetEnabledNode.IsNull())
     {
-      m_facetEnabled = StringUtils::ConvertToBool(StringUtils::Trim(facetEnabledNode.GetText().c_str()).c_str());
+      m_facetEnabled = StringUtils::ConvertToBool(facetEnabledNode.GetTextView().Trim().ToString().c_str());
       m_facetEnabledHasBeenSet = true;
     }
     XmlNode searchEnabledNode = resultNode.FirstChild("SearchEnabled");
     if(!searchEnabledNode.IsNull())
     {
-      m_searchEnabled = StringUtils::ConvertToBool(StringUtils::Trim(searchEnabledNode.GetText().c_str()).c_str());
+      m_searchEnabled = StringUtils::ConvertToBool(searchEnabledNode.GetTextView().Trim().ToString().c_str());
       m_searchEnabledHasBeenSet = true;
     }
     XmlNode returnEnabledNode = resultNode.FirstChild("ReturnEnabled");
     if(!returnEnabledNode.IsNull())
     {
-      m_returnEnabled = StringUtils::ConvertToBool(StringUtils::Trim(returnEnabledNode.GetText().c_str()).c_str());
+      m_returnEnabled = StringUtils::ConvertToBool(returnEnabledNode.GetTextView().Trim().ToString().c_str());
       m_returnEnabledHasBeenSet = true;
     }
     XmlNode sortEnabledNode = resultNode.FirstChild("SortEnabled");
     if(!sortEnabledNode.IsNull())
     {
-      m_sortEnabled = StringUtils::ConvertToBool(StringUtils::Trim(sortEnabledNode.GetText().c_str()).c_str());
+      m_sortEnabled = StringUtils::ConvertToBool(sortEnabledNode.GetTextView().Trim().ToString().c_str());
       m_sortEnabledHasBeenSet = true;
     }
   }
@@ -109,12 +109,12 @@ void DateOptions::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
 
   if(m_sourceFieldHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceField=" << StringUtils::URLEncode(m_sourceField.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceField=" << StringUtils::URLEncoded(m_sourceField) << "&";
   }
 
   if(m_facetEnabledHasBeenSet)
@@ -143,11 +143,11 @@ void DateOptions::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
   if(m_sourceFieldHasBeenSet)
   {
-      oStream << location << ".SourceField=" << StringUtils::URLEncode(m_sourceField.c_str()) << "&";
+      oStream << location << ".SourceField=" << StringUtils::URLEncoded(m_sourceField) << "&";
   }
   if(m_facetEnabledHasBeenSet)
   {
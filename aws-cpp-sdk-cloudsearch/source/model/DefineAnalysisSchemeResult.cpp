@@ -40,7 +40,7 @@ DefineAnalysisSchemeResult& DefineAnalysisSchemeResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DefineAnalysisSchemeResult")
+  if (rootNode.GetNameView() != "DefineAnalysisSchemeResult")
   {
     resultNode = rootNode.FirstChild("DefineAnalysisSchemeResult");
   }
@@ -40,7 +40,7 @@ DefineExpressionResult& DefineExpressionResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DefineExpressionResult")
+  if (rootNode.GetNameView() != "DefineExpressionResult")
   {
     resultNode = rootNode.FirstChild("DefineExpressionResult");
   }
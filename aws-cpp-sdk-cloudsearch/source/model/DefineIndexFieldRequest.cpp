@@ -15,6 +15,7 @@
 #include <aws/cloudsearch/model/DefineIndexFieldRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudSearch::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ DefineIndexFieldRequest::DefineIndexFieldRequest() :
 
 Aws::String DefineIndexFieldRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DefineIndexField&";
   if(m_domainNameHasBeenSet)
   {
-    ss << "DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+    ss << "DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
 
   if(m_indexFieldHasBeenSet)
@@ -40,6 +41,6 @@ Aws::String DefineIndexFieldRequest::SerializePayload() const
   }
 
   ss << "Version=2013-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
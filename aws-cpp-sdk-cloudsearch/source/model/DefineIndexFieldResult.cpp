@@ -40,7 +40,7 @@ DefineIndexFieldResult& DefineIndexFieldResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DefineIndexFieldResult")
+  if (rootNode.GetNameView() != "DefineIndexFieldResult")
   {
     resultNode = rootNode.FirstChild("DefineIndexFieldResult");
   }
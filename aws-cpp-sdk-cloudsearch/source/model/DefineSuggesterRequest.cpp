@@ -15,6 +15,7 @@
 #include <aws/cloudsearch/model/DefineSuggesterRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudSearch::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ DefineSuggesterRequest::DefineSuggesterRequest() :
 
 Aws::String DefineSuggesterRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DefineSuggester&";
   if(m_domainNameHasBeenSet)
   {
-    ss << "DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+    ss << "DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
 
   if(m_suggesterHasBeenSet)
@@ -40,6 +41,6 @@ Aws::String DefineSuggesterRequest::SerializePayload() const
   }
 
   ss << "Version=2013-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DefineSuggesterResult& DefineSuggesterResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DefineSuggesterResult")
+  if (rootNode.GetNameView() != "DefineSuggesterResult")
   {
     resultNode = rootNode.FirstChild("DefineSuggesterResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/cloudsearch/model/DeleteAnalysisSchemeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudSearch::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ DeleteAnalysisSchemeRequest::DeleteAnalysisSchemeRequest() :
 
 Aws::String DeleteAnalysisSchemeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteAnalysisScheme&";
   if(m_domainNameHasBeenSet)
   {
-    ss << "DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+    ss << "DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
 
   if(m_analysisSchemeNameHasBeenSet)
   {
-    ss << "AnalysisSchemeName=" << StringUtils::URLEncode(m_analysisSchemeName.c_str()) << "&";
+    ss << "AnalysisSchemeName=" << StringUtils::URLEncoded(m_analysisSchemeName) << "&";
   }
 
   ss << "Version=2013-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
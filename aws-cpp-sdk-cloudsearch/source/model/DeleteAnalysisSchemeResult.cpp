@@ -40,7 +40,7 @@ DeleteAnalysisSchemeResult& DeleteAnalysisSchemeResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteAnalysisSchemeResult")
+  if (rootNode.GetNameView() != "DeleteAnalysisSchemeResult")
   {
     resultNode = rootNode.FirstChild("DeleteAnalysisSchemeResult");
   }
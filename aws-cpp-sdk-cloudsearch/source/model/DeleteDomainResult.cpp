@@ -40,7 +40,7 @@ DeleteDomainResult& DeleteDomainResult::operator =(const AmazonWebServiceResult<
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteDomainResult")
+  if (rootNode.GetNameView() != "DeleteDomainResult")
   {
     resultNode = rootNode.FirstChild("DeleteDomainResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/cloudsearch/model/DeleteExpressionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudSearch::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ DeleteExpressionRequest::DeleteExpressionRequest() :
 
 Aws::String DeleteExpressionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteExpression&";
   if(m_domainNameHasBeenSet)
   {
-    ss << "DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+    ss << "DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
 
   if(m_expressionNameHasBeenSet)
   {
-    ss << "ExpressionName=" << StringUtils::URLEncode(m_expressionName.c_str()) << "&";
+    ss << "ExpressionName=" << StringUtils::URLEncoded(m_expressionName) << "&";
   }
 
   ss << "Version=2013-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DeleteExpressionResult& DeleteExpressionResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteExpressionResult")
+  if (rootNode.GetNameView() != "DeleteExpressionResult")
   {
     resultNode = rootNode.FirstChild("DeleteExpressionResult");
   }
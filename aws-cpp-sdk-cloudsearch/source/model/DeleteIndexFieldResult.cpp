@@ -40,7 +40,7 @@ DeleteIndexFieldResult& DeleteIndexFieldResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteIndexFieldResult")
+  if (rootNode.GetNameView() != "DeleteIndexFieldResult")
   {
     resultNode = rootNode.FirstChild("DeleteIndexFieldResult");
   }
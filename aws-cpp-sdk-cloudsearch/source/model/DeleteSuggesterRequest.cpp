@@ -15,6 +15,7 @@
 #include <aws/cloudsearch/model/DeleteSuggesterRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudSearch::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ DeleteSuggesterRequest::DeleteSuggesterRequest() :
 
 Aws::String DeleteSuggesterRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteSuggester&";
   if(m_domainNameHasBeenSet)
   {
-    ss << "DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+    ss << "DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
 
   if(m_suggesterNameHasBeenSet)
   {
-    ss << "SuggesterName=" << StringUtils::URLEncode(m_suggesterName.c_str()) << "&";
+    ss << "SuggesterName=" << StringUtils::URLEncoded(m_suggesterName) << "&";
   }
 
   ss << "Version=2013-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DeleteSuggesterResult& DeleteSuggesterResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteSuggesterResult")
+  if (rootNode.GetNameView() != "DeleteSuggesterResult")
   {
     resultNode = rootNode.FirstChild("DeleteSuggesterResult");
   }
@@ -40,7 +40,7 @@ DescribeAnalysisSchemesResult& DescribeAnalysisSchemesResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeAnalysisSchemesResult")
+  if (rootNode.GetNameView() != "DescribeAnalysisSchemesResult")
   {
     resultNode = rootNode.FirstChild("DescribeAnalysisSchemesResult");
   }
@@ -40,7 +40,7 @@ DescribeAvailabilityOptionsResult& DescribeAvailabilityOptionsResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeAvailabilityOptionsResult")
+  if (rootNode.GetNameView() != "DescribeAvailabilityOptionsResult")
   {
     resultNode = rootNode.FirstChild("DescribeAvailabilityOptionsResult");
   }
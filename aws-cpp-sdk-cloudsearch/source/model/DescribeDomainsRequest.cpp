@@ -15,6 +15,7 @@
 #include <aws/cloudsearch/model/DescribeDomainsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudSearch::Model;
 using namespace Aws::Utils;
@@ -26,7 +27,7 @@ DescribeDomainsRequest::DescribeDomainsRequest() :
 
 Aws::String DescribeDomainsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeDomains&";
   if(m_domainNamesHasBeenSet)
   {
@@ -34,12 +35,12 @@ Aws::String DescribeDomainsRequest::SerializePayload() const
     for(auto& item : m_domainNames)
     {
       ss << "DomainNames.member." << domainNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       domainNamesCount++;
     }
   }
 
   ss << "Version=2013-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeDomainsResult& DescribeDomainsResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDomainsResult")
+  if (rootNode.GetNameView() != "DescribeDomainsResult")
   {
     resultNode = rootNode.FirstChild("DescribeDomainsResult");
   }
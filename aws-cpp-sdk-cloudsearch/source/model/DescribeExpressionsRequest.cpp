@@ -15,6 +15,7 @@
 #include <aws/cloudsearch/model/DescribeExpressionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudSearch::Model;
 using namespace Aws::Utils;
@@ -29,11 +30,11 @@ DescribeExpressionsRequest::DescribeExpressionsRequest() :
 
 Aws::String DescribeExpressionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeExpressions&";
   if(m_domainNameHasBeenSet)
   {
-    ss << "DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+    ss << "DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
 
   if(m_expressionNamesHasBeenSet)
@@ -42,7 +43,7 @@ Aws::String DescribeExpressionsRequest::SerializePayload() const
     for(auto& item : m_expressionNames)
     {
       ss << "ExpressionNames.member." << expressionNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       expressionNamesCount++;
     }
   }
@@ -53,6 +54,6 @@ Aws::String DescribeExpressionsRequest::SerializePayload() const
   }
 
   ss << "Version=2013-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeExpressionsResult& DescribeExpressionsResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeExpressionsResult")
+  if (rootNode.GetNameView() != "DescribeExpressionsResult")
   {
     resultNode = rootNode.FirstChild("DescribeExpressionsResult");
   }
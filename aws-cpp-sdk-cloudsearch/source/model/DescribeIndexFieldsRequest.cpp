@@ -15,6 +15,7 @@
 #include <aws/cloudsearch/model/DescribeIndexFieldsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudSearch::Model;
 using namespace Aws::Utils;
@@ -29,11 +30,11 @@ DescribeIndexFieldsRequest::DescribeIndexFieldsRequest() :
 
 Aws::String DescribeIndexFieldsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeIndexFields&";
   if(m_domainNameHasBeenSet)
   {
-    ss << "DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+    ss << "DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
 
   if(m_fieldNamesHasBeenSet)
@@ -42,7 +43,7 @@ Aws::String DescribeIndexFieldsRequest::SerializePayload() const
     for(auto& item : m_fieldNames)
     {
       ss << "FieldNames.member." << fieldNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       fieldNamesCount++;
     }
   }
@@ -53,6 +54,6 @@ Aws::String DescribeIndexFieldsRequest::SerializePayload() const
   }
 
   ss << "Version=2013-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
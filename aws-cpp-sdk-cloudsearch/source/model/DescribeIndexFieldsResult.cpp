@@ -40,7 +40,7 @@ DescribeIndexFieldsResult& DescribeIndexFieldsResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeIndexFieldsResult")
+  if (rootNode.GetNameView() != "DescribeIndexFieldsResult")
   {
     resultNode = rootNode.FirstChild("DescribeIndexFieldsResult");
   }
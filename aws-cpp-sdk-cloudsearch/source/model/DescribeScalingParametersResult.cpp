@@ -40,7 +40,7 @@ DescribeScalingParametersResult& DescribeScalingParametersResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeScalingParametersResult")
+  if (rootNode.GetNameView() != "DescribeScalingParametersResult")
   {
     resultNode = rootNode.FirstChild("DescribeScalingParametersResult");
   }
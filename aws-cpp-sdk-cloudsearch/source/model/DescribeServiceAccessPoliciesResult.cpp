@@ -40,7 +40,7 @@ DescribeServiceAccessPoliciesResult& DescribeServiceAccessPoliciesResult::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeServiceAccessPoliciesResult")
+  if (rootNode.GetNameView() != "DescribeServiceAccessPoliciesResult")
   {
     resultNode = rootNode.FirstChild("DescribeServiceAccessPoliciesResult");
   }
@@ -40,7 +40,7 @@ DescribeSuggestersResult& DescribeSuggestersResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeSuggestersResult")
+  if (rootNode.GetNameView() != "DescribeSuggestersResult")
   {
     resultNode = rootNode.FirstChild("DescribeSuggestersResult");
   }
@@ -53,19 +53,19 @@ DocumentSuggesterOptions& DocumentSuggesterOptions::operator =(const XmlNode& xm
     XmlNode sourceFieldNode = resultNode.FirstChild("SourceField");
     if(!sourceFieldNode.IsNull())
     {
-      m_sourceField = StringUtils::Trim(sourceFieldNode.GetText().c_str());
+      m_sourceField = sourceFieldNode.GetTextView().Trim().ToString();
       m_sourceFieldHasBeenSet = true;
     }
     XmlNode fuzzyMatchingNode = resultNode.FirstChild("FuzzyMatching");
     if(!fuzzyMatchingNode.IsNull())
     {
-      m_fuzzyMatching = SuggesterFuzzyMatchingMapper::GetSuggesterFuzzyMatchingForName(StringUtils::Trim(fuzzyMatchingNode.GetText().c_str()).c_str());
+      m_fuzzyMatching = SuggesterFuzzyMatchingMapper::GetSuggesterFuzzyMatchingForName(fuzzyMatchingNode.GetTextView().Trim().ToString().c_str());
       m_fuzzyMatchingHasBeenSet = true;
     }
     XmlNode sortExpressionNode = resultNode.FirstChild("SortExpression");
     if(!sortExpressionNode.IsNull())
     {
-      m_sortExpression = StringUtils::Trim(sortExpressionNode.GetText().c_str());
+      m_sortExpression = sortExpressionNode.GetTextView().Trim().ToString();
       m_sortExpressionHasBeenSet = true;
     }
   }
@@ -77,7 +77,7 @@ void DocumentSuggesterOptions::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_sourceFieldHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceField=" << StringUtils::URLEncode(m_sourceField.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceField=" << StringUtils::URLEncoded(m_sourceField) << "&";
   }
 
   if(m_fuzzyMatchingHasBeenSet)
@@ -87,7 +87,7 @@ void DocumentSuggesterOptions::OutputToStream(Aws::OStream& oStream, const char*
 
   if(m_sortExpressionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SortExpression=" << StringUtils::URLEncode(m_sortExpression.c_str()) << "&";
+      oStream << location << index << locationValue << ".SortExpression=" << StringUtils::URLEncoded(m_sortExpression) << "&";
   }
 
 }
@@ -96,7 +96,7 @@ void DocumentSuggesterOptions::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_sourceFieldHasBeenSet)
   {
-      oStream << location << ".SourceField=" << StringUtils::URLEncode(m_sourceField.c_str()) << "&";
+      oStream << location << ".SourceField=" << StringUtils::URLEncoded(m_sourceField) << "&";
   }
   if(m_fuzzyMatchingHasBeenSet)
   {
@@ -104,7 +104,7 @@ void DocumentSuggesterOptions::OutputToStream(Aws::OStream& oStream, const char*
   }
   if(m_sortExpressionHasBeenSet)
   {
-      oStream << location << ".SortExpression=" << StringUtils::URLEncode(m_sortExpression.c_str()) << "&";
+      oStream << location << ".SortExpression=" << StringUtils::URLEncoded(m_sortExpression) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -85,31 +86,31 @@ DomainStatus& DomainStatus::operator =(const XmlNode& xmlNode)
     XmlNode domainIdNode = resultNode.FirstChild("DomainId");
     if(!domainIdNode.IsNull())
     {
-      m_domainId = StringUtils::Trim(domainIdNode.GetText().c_str());
+      m_domainId = domainIdNode.GetTextView().Trim().ToString();
       m_domainIdHasBeenSet = true;
     }
     XmlNode domainNameNode = resultNode.FirstChild("DomainName");
     if(!domainNameNode.IsNull())
     {
-      m_domainName = StringUtils::Trim(domainNameNode.GetText().c_str());
+      m_domainName = domainNameNode.GetTextView().Trim().ToString();
       m_domainNameHasBeenSet = true;
     }
     XmlNode aRNNode = resultNode.FirstChild("ARN");
     if(!aRNNode.IsNull())
     {
-      m_aRN = StringUtils::Trim(aRNNode.GetText().c_str());
+      m_aRN = aRNNode.GetTextView().Trim().ToString();
       m_aRNHasBeenSet = true;
     }
     XmlNode createdNode = resultNode.FirstChild("Created");
     if(!createdNode.IsNull())
     {
-      m_created = StringUtils::ConvertToBool(StringUtils::Trim(createdNode.GetText().c_str()).c_str());
+      m_created = StringUtils::ConvertToBool(createdNode.GetTextView().Trim().ToString().c_str());
       m_createdHasBeenSet = true;
     }
     XmlNode deletedNode = resultNode.FirstChild("Deleted");
     if(!deletedNode.IsNull())
     {
-      m_deleted = StringUtils::ConvertToBool(StringUtils::Trim(deletedNode.GetText().c_str()).c_str());
+      m_deleted = StringUtils::ConvertToBool(deletedNode.GetTextView().Trim().ToString().c_str());
       m_deletedHasBeenSet = true;
     }
     XmlNode docServiceNode = resultNode.FirstChild("DocService");
@@ -127,31 +128,31 @@ DomainStatus& DomainStatus::operator =(const XmlNode& xmlNode)
     XmlNode requiresIndexDocumentsNode = resultNode.FirstChild("RequiresIndexDocuments");
     if(!requiresIndexDocumentsNode.IsNull())
     {
-      m_requiresIndexDocuments = StringUtils::ConvertToBool(StringUtils::Trim(requiresIndexDocumentsNode.GetText().c_str()).c_str());
+      m_requiresIndexDocuments = StringUtils::ConvertToBool(requiresIndexDocumentsNode.GetTextView().Trim().ToString().c_str());
       m_requiresIndexDocumentsHasBeenSet = true;
     }
     XmlNode processingNode = resultNode.FirstChild("Processing");
     if(!processingNode.IsNull())
     {
-      m_processing = StringUtils::ConvertToBool(StringUtils::Trim(processingNode.GetText().c_str()).c_str());
+      m_processing = StringUtils::ConvertToBool(processingNode.GetTextView().Trim().ToString().c_str());
       m_processingHasBeenSet = true;
     }
     XmlNode searchInstanceTypeNode = resultNode.FirstChild("SearchInstanceType");
     if(!searchInstanceTypeNode.IsNull())
     {
-      m_searchInstanceType = StringUtils::Trim(searchInstanceTypeNode.GetText().c_str());
+      m_searchInstanceType = searchInstanceTypeNode.GetTextView().Trim().ToString();
       m_searchInstanceTypeHasBeenSet = true;
     }
     XmlNode searchPartitionCountNode = resultNode.FirstChild("SearchPartitionCount");
     if(!searchPartitionCountNode.IsNull())
     {
-      m_searchPartitionCount = StringUtils::ConvertToInt32(StringUtils::Trim(searchPartitionCountNode.GetText().c_str()).c_str());
+      m_searchPartitionCount = StringUtils::ConvertToInt32(searchPartitionCountNode.GetTextView().Trim().ToString().c_str());
       m_searchPartitionCountHasBeenSet = true;
     }
     XmlNode searchInstanceCountNode = resultNode.FirstChild("SearchInstanceCount");
     if(!searchInstanceCountNode.IsNull())
     {
-      m_searchInstanceCount = StringUtils::ConvertToInt32(StringUtils::Trim(searchInstanceCountNode.GetText().c_str()).c_str());
+      m_searchInstanceCount = StringUtils::ConvertToInt32(searchInstanceCountNode.GetTextView().Trim().ToString().c_str());
       m_searchInstanceCountHasBeenSet = true;
     }
     XmlNode limitsNode = resultNode.FirstChild("Limits");
@@ -169,17 +170,17 @@ void DomainStatus::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_domainIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DomainId=" << StringUtils::URLEncode(m_domainId.c_str()) << "&";
+      oStream << location << index << locationValue << ".DomainId=" << StringUtils::URLEncoded(m_domainId) << "&";
   }
 
   if(m_domainNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
 
   if(m_aRNHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ARN=" << StringUtils::URLEncode(m_aRN.c_str()) << "&";
+      oStream << location << index << locationValue << ".ARN=" << StringUtils::URLEncoded(m_aRN) << "&";
   }
 
   if(m_createdHasBeenSet)
@@ -194,16 +195,16 @@ void DomainStatus::OutputToStream(Aws::OStream& oStream, const char* location, u
 
   if(m_docServiceHasBeenSet)
   {
-      Aws::StringStream docServiceLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream docServiceLocationAndMemberSs;
       docServiceLocationAndMemberSs << location << index << locationValue << ".DocService";
-      m_docService.OutputToStream(oStream, docServiceLocationAndMemberSs.str().c_str());
+      m_docService.OutputToStream(oStream, docServiceLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_searchServiceHasBeenSet)
   {
-      Aws::StringStream searchServiceLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream searchServiceLocationAndMemberSs;
       searchServiceLocationAndMemberSs << location << index << locationValue << ".SearchService";
-      m_searchService.OutputToStream(oStream, searchServiceLocationAndMemberSs.str().c_str());
+      m_searchService.OutputToStream(oStream, searchServiceLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_requiresIndexDocumentsHasBeenSet)
@@ -218,7 +219,7 @@ void DomainStatus::OutputToStream(Aws::OStream& oStream, const char* location, u
 
   if(m_searchInstanceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SearchInstanceType=" << StringUtils::URLEncode(m_searchInstanceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".SearchInstanceType=" << StringUtils::URLEncoded(m_searchInstanceType) << "&";
   }
 
   if(m_searchPartitionCountHasBeenSet)
@@ -233,9 +234,9 @@ void DomainStatus::OutputToStream(Aws::OStream& oStream, const char* location, u
 
   if(m_limitsHasBeenSet)
   {
-      Aws::StringStream limitsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream limitsLocationAndMemberSs;
       limitsLocationAndMemberSs << location << index << locationValue << ".Limits";
-      m_limits.OutputToStream(oStream, limitsLocationAndMemberSs.str().c_str());
+      m_limits.OutputToStream(oStream, limitsLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -244,15 +245,15 @@ void DomainStatus::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_domainIdHasBeenSet)
   {
-      oStream << location << ".DomainId=" << StringUtils::URLEncode(m_domainId.c_str()) << "&";
+      oStream << location << ".DomainId=" << StringUtils::URLEncoded(m_domainId) << "&";
   }
   if(m_domainNameHasBeenSet)
   {
-      oStream << location << ".DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+      oStream << location << ".DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
   if(m_aRNHasBeenSet)
   {
-      oStream << location << ".ARN=" << StringUtils::URLEncode(m_aRN.c_str()) << "&";
+      oStream << location << ".ARN=" << StringUtils::URLEncoded(m_aRN) << "&";
   }
   if(m_createdHasBeenSet)
   {
@@ -284,7 +285,7 @@ void DomainStatus::OutputToStream(Aws::OStream& oStream, const char* location) c
   }
   if(m_searchInstanceTypeHasBeenSet)
   {
-      oStream << location << ".SearchInstanceType=" << StringUtils::URLEncode(m_searchInstanceType.c_str()) << "&";
+      oStream << location << ".SearchInstanceType=" << StringUtils::URLEncoded(m_searchInstanceType) << "&";
   }
   if(m_searchPartitionCountHasBeenSet)
   {
@@ -65,31 +65,31 @@ DoubleArrayOptions& DoubleArrayOptions::operator =(const XmlNode& xmlNode)
     XmlNode defaultValueNode = resultNode.FirstChild("DefaultValue");
     if(!defaultValueNode.IsNull())
     {
-      m_defaultValue = StringUtils::ConvertToDouble(StringUtils::Trim(defaultValueNode.GetText().c_str()).c_str());
+      m_defaultValue = StringUtils::ConvertToDouble(defaultValueNode.GetTextView().Trim().ToString().c_str());
       m_defaultValueHasBeenSet = true;
     }
     XmlNode sourceFieldsNode = resultNode.FirstChild("SourceFields");
     if(!sourceFieldsNode.IsNull())
     {
-      m_sourceFields = StringUtils::Trim(sourceFieldsNode.GetText().c_str());
+      m_sourceFields = sourceFieldsNode.GetTextView().Trim().ToString();
       m_sourceFieldsHasBeenSet = true;
     }
     XmlNode facetEnabledNode = resultNode.FirstChild("FacetEnabled");
     if(!facetEnabledNode.IsNull())
     {
-      m_facetEnabled = StringUtils::ConvertToBool(StringUtils::Trim(facetEnabledNode.GetText().c_str()).c_str());
+      m_facetEnabled = StringUtils::ConvertToBool(facetEnabledNode.GetTextView().Trim().ToString().c_str());
       m_facetEnabledHasBeenSet = true;
     }
     XmlNode searchEnabledNode = resultNode.FirstChild("SearchEnabled");
     if(!searchEnabledNode.IsNull())
     {
-      m_searchEnabled = StringUtils::ConvertToBool(StringUtils::Trim(searchEnabledNode.GetText().c_str()).c_str());
+      m_searchEnabled = StringUtils::ConvertToBool(searchEnabledNode.GetTextView().Trim().ToString().c_str());
       m_searchEnabledHasBeenSet = true;
     }
     XmlNode returnEnabledNode = resultNode.FirstChild("ReturnEnabled");
     if(!returnEnabledNode.IsNull())
     {
-      m_returnEnabled = StringUtils::ConvertToBool(StringUtils::Trim(returnEnabledNode.GetText().c_str()).c_str());
+      m_returnEnabled = StringUtils::ConvertToBool(returnEnabledNode.GetTextView().Trim().ToString().c_str());
       m_returnEnabledHasBeenSet = true;
     }
   }
@@ -106,7 +106,7 @@ void DoubleArrayOptions::OutputToStream(Aws::OStream& oStream, const char* locat
 
   if(m_sourceFieldsHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceFields=" << StringUtils::URLEncode(m_sourceFields.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceFields=" << StringUtils::URLEncoded(m_sourceFields) << "&";
   }
 
   if(m_facetEnabledHasBeenSet)
@@ -134,7 +134,7 @@ void DoubleArrayOptions::OutputToStream(Aws::OStream& oStream, const char* locat
   }
   if(m_sourceFieldsHasBeenSet)
   {
-      oStream << location << ".SourceFields=" << StringUtils::URLEncode(m_sourceFields.c_str()) << "&";
+      oStream << location << ".SourceFields=" << StringUtils::URLEncoded(m_sourceFields) << "&";
   }
   if(m_facetEnabledHasBeenSet)
   {
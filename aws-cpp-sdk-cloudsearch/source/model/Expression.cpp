@@ -51,13 +51,13 @@ Expression& Expression::operator =(const XmlNode& xmlNode)
     XmlNode expressionNameNode = resultNode.FirstChild("ExpressionName");
     if(!expressionNameNode.IsNull())
     {
-      m_expressionName = StringUtils::Trim(expressionNameNode.GetText().c_str());
+      m_expressionName = expressionNameNode.GetTextView().Trim().ToString();
       m_expressionNameHasBeenSet = true;
     }
     XmlNode expressionValueNode = resultNode.FirstChild("ExpressionValue");
     if(!expressionValueNode.IsNull())
     {
-      m_expressionValue = StringUtils::Trim(expressionValueNode.GetText().c_str());
+      m_expressionValue = expressionValueNode.GetTextView().Trim().ToString();
       m_expressionValueHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void Expression::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_expressionNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ExpressionName=" << StringUtils::URLEncode(m_expressionName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ExpressionName=" << StringUtils::URLEncoded(m_expressionName) << "&";
   }
 
   if(m_expressionValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ExpressionValue=" << StringUtils::URLEncode(m_expressionValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".ExpressionValue=" << StringUtils::URLEncoded(m_expressionValue) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void Expression::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_expressionNameHasBeenSet)
   {
-      oStream << location << ".ExpressionName=" << StringUtils::URLEncode(m_expressionName.c_str()) << "&";
+      oStream << location << ".ExpressionName=" << StringUtils::URLEncoded(m_expressionName) << "&";
   }
   if(m_expressionValueHasBeenSet)
   {
-      oStream << location << ".ExpressionValue=" << StringUtils::URLEncode(m_expressionValue.c_str()) << "&";
+      oStream << location << ".ExpressionValue=" << StringUtils::URLEncoded(m_expressionValue) << "&";
   }
 }
 
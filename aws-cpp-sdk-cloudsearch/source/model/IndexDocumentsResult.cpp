@@ -40,7 +40,7 @@ IndexDocumentsResult& IndexDocumentsResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "IndexDocumentsResult")
+  if (rootNode.GetNameView() != "IndexDocumentsResult")
   {
     resultNode = rootNode.FirstChild("IndexDocumentsResult");
   }
@@ -53,7 +53,7 @@ IndexDocumentsResult& IndexDocumentsResult::operator =(const AmazonWebServiceRes
       XmlNode fieldNamesMember = fieldNamesNode.FirstChild("member");
       while(!fieldNamesMember.IsNull())
       {
-        m_fieldNames.push_back(StringUtils::Trim(fieldNamesMember.GetText().c_str()));
+        m_fieldNames.push_back(fieldNamesMember.GetTextView().Trim().ToString());
         fieldNamesMember = fieldNamesMember.NextNode("member");
       }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -73,13 +74,13 @@ IndexField& IndexField::operator =(const XmlNode& xmlNode)
     XmlNode indexFieldNameNode = resultNode.FirstChild("IndexFieldName");
     if(!indexFieldNameNode.IsNull())
     {
-      m_indexFieldName = StringUtils::Trim(indexFieldNameNode.GetText().c_str());
+      m_indexFieldName = indexFieldNameNode.GetTextView().Trim().ToString();
       m_indexFieldNameHasBeenSet = true;
     }
     XmlNode indexFieldTypeNode = resultNode.FirstChild("IndexFieldType");
     if(!indexFieldTypeNode.IsNull())
     {
-      m_indexFieldType = IndexFieldTypeMapper::GetIndexFieldTypeForName(StringUtils::Trim(indexFieldTypeNode.GetText().c_str()).c_str());
+      m_indexFieldType = IndexFieldTypeMapper::GetIndexFieldTypeForName(indexFieldTypeNode.GetTextView().Trim().ToString().c_str());
       m_indexFieldTypeHasBeenSet = true;
     }
     XmlNode intOptionsNode = resultNode.FirstChild("IntOptions");
@@ -157,7 +158,7 @@ void IndexField::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_indexFieldNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".IndexFieldName=" << StringUtils::URLEncode(m_indexFieldName.c_str()) << "&";
+      oStream << location << index << locationValue << ".IndexFieldName=" << StringUtils::URLEncoded(m_indexFieldName) << "&";
   }
 
   if(m_indexFieldTypeHasBeenSet)
@@ -167,79 +168,79 @@ void IndexField::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_intOptionsHasBeenSet)
   {
-      Aws::StringStream intOptionsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream intOptionsLocationAndMemberSs;
       intOptionsLocationAndMemberSs << location << index << locationValue << ".IntOptions";
-      m_intOptions.OutputToStream(oStream, intOptionsLocationAndMemberSs.str().c_str());
+      m_intOptions.OutputToStream(oStream, intOptionsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_doubleOptionsHasBeenSet)
   {
-      Aws::StringStream doubleOptionsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream doubleOptionsLocationAndMemberSs;
       doubleOptionsLocationAndMemberSs << location << index << locationValue << ".DoubleOptions";
-      m_doubleOptions.OutputToStream(oStream, doubleOptionsLocationAndMemberSs.str().c_str());
+      m_doubleOptions.OutputToStream(oStream, doubleOptionsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_literalOptionsHasBeenSet)
   {
-      Aws::StringStream literalOptionsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream literalOptionsLocationAndMemberSs;
       literalOptionsLocationAndMemberSs << location << index << locationValue << ".LiteralOptions";
-      m_literalOptions.OutputToStream(oStream, literalOptionsLocationAndMemberSs.str().c_str());
+      m_literalOptions.OutputToStream(oStream, literalOptionsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_textOptionsHasBeenSet)
   {
-      Aws::StringStream textOptionsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream textOptionsLocationAndMemberSs;
       textOptionsLocationAndMemberSs << location << index << locationValue << ".TextOptions";
-      m_textOptions.OutputToStream(oStream, textOptionsLocationAndMemberSs.str().c_str());
+      m_textOptions.OutputToStream(oStream, textOptionsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_dateOptionsHasBeenSet)
   {
-      Aws::StringStream dateOptionsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream dateOptionsLocationAndMemberSs;
       dateOptionsLocationAndMemberSs << location << index << locationValue << ".DateOptions";
-      m_dateOptions.OutputToStream(oStream, dateOptionsLocationAndMemberSs.str().c_str());
+      m_dateOptions.OutputToStream(oStream, dateOptionsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_latLonOptionsHasBeenSet)
   {
-      Aws::StringStream latLonOptionsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream latLonOptionsLocationAndMemberSs;
       latLonOptionsLocationAndMemberSs << location << index << locationValue << ".LatLonOptions";
-      m_latLonOptions.OutputToStream(oStream, latLonOptionsLocationAndMemberSs.str().c_str());
+      m_latLonOptions.OutputToStream(oStream, latLonOptionsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_intArrayOptionsHasBeenSet)
   {
-      Aws::StringStream intArrayOptionsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream intArrayOptionsLocationAndMemberSs;
       intArrayOptionsLocationAndMemberSs << location << index << locationValue << ".IntArrayOptions";
-      m_intArrayOptions.OutputToStream(oStream, intArrayOptionsLocationAndMemberSs.str().c_str());
+      m_intArrayOptions.OutputToStream(oStream, intArrayOptionsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_doubleArrayOptionsHasBeenSet)
   {
-      Aws::StringStream doubleArrayOptionsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream doubleArrayOptionsLocationAndMemberSs;
       doubleArrayOptionsLocationAndMemberSs << location << index << locationValue << ".DoubleArrayOptions";
-      m_doubleArrayOptions.OutputToStream(oStream, doubleArrayOptionsLocationAndMemberSs.str().c_str());
+      m_doubleArrayOptions.OutputToStream(oStream, doubleArrayOptionsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_literalArrayOptionsHasBeenSet)
   {
-      Aws::StringStream literalArrayOptionsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream literalArrayOptionsLocationAndMemberSs;
       literalArrayOptionsLocationAndMemberSs << location << index << locationValue << ".LiteralArrayOptions";
-      m_literalArrayOptions.OutputToStream(oStream, literalArrayOptionsLocationAndMemberSs.str().c_str());
+      m_literalArrayOptions.OutputToStream(oStream, literalArrayOptionsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_textArrayOptionsHasBeenSet)
   {
-      Aws::StringStream textArrayOptionsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream textArrayOptionsLocationAndMemberSs;
       textArrayOptionsLocationAndMemberSs << location << index << locationValue << ".TextArrayOptions";
-      m_textArrayOptions.OutputToStream(oStream, textArrayOptionsLocationAndMemberSs.str().c_str());
+      m_textArrayOptions.OutputToStream(oStream, textArrayOptionsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_dateArrayOptionsHasBeenSet)
   {
-      Aws::StringStream dateArrayOptionsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream dateArrayOptionsLocationAndMemberSs;
       dateArrayOptionsLocationAndMemberSs << location << index << locationValue << ".DateArrayOptions";
-      m_dateArrayOptions.OutputToStream(oStream, dateArrayOptionsLocationAndMemberSs.str().c_str());
+      m_dateArrayOptions.OutputToStream(oStream, dateArrayOptionsLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -248,7 +249,7 @@ void IndexField::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_indexFieldNameHasBeenSet)
   {
-      oStream << location << ".IndexFieldName=" << StringUtils::URLEncode(m_indexFieldName.c_str()) << "&";
+      oStream << location << ".IndexFieldName=" << StringUtils::URLEncoded(m_indexFieldName) << "&";
   }
   if(m_indexFieldTypeHasBeenSet)
   {
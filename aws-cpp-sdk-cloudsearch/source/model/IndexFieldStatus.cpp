@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -69,16 +70,16 @@ void IndexFieldStatus::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_optionsHasBeenSet)
   {
-      Aws::StringStream optionsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream optionsLocationAndMemberSs;
       optionsLocationAndMemberSs << location << index << locationValue << ".Options";
-      m_options.OutputToStream(oStream, optionsLocationAndMemberSs.str().c_str());
+      m_options.OutputToStream(oStream, optionsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_statusHasBeenSet)
   {
-      Aws::StringStream statusLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream statusLocationAndMemberSs;
       statusLocationAndMemberSs << location << index << locationValue << ".Status";
-      m_status.OutputToStream(oStream, statusLocationAndMemberSs.str().c_str());
+      m_status.OutputToStream(oStream, statusLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -29,66 +29,56 @@ namespace Aws
       namespace IndexFieldTypeMapper
       {
 
-        static const int int__HASH = HashingUtils::HashString("int");
-        static const int double__HASH = HashingUtils::HashString("double");
-        static const int literal_HASH = HashingUtils::HashString("literal");
-        static const int text_HASH = HashingUtils::HashString("text");
-        static const int date_HASH = HashingUtils::HashString("date");
-        static const int latlon_HASH = HashingUtils::HashString("latlon");
-        static const int int_array_HASH = HashingUtils::HashString("int-array");
-        static const int double_array_HASH = HashingUtils::HashString("double-array");
-        static const int literal_array_HASH = HashingUtils::HashString("literal-array");
-        static const int text_array_HASH = HashingUtils::HashString("text-array");
-        static const int date_array_HASH = HashingUtils::HashString("date-array");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int int__HASH = 104431;
+        static const int double__HASH = -1325958191;
+        static const int literal_HASH = 182460591;
+        static const int text_HASH = 3556653;
+        static const int date_HASH = 3076014;
+        static const int latlon_HASH = -1109874356;
+        static const int int_array_HASH = -1115934981;
+        static const int double_array_HASH = -58973859;
+        static const int literal_array_HASH = -1509873733;
+        static const int text_array_HASH = 746419641;
+        static const int date_array_HASH = -573408390;
 
 
         IndexFieldType GetIndexFieldTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == int__HASH)
+          switch (hashCode)
           {
+          case int__HASH:
             return IndexFieldType::int_;
-          }
-          else if (hashCode == double__HASH)
-          {
+          case double__HASH:
             return IndexFieldType::double_;
-          }
-          else if (hashCode == literal_HASH)
-          {
+          case literal_HASH:
             return IndexFieldType::literal;
-          }
-          else if (hashCode == text_HASH)
-          {
+          case text_HASH:
             return IndexFieldType::text;
-          }
-          else if (hashCode == date_HASH)
-          {
+          case date_HASH:
             return IndexFieldType::date;
-          }
-          else if (hashCode == latlon_HASH)
-          {
+          case latlon_HASH:
             return IndexFieldType::latlon;
-          }
-          else if (hashCode == int_array_HASH)
-          {
+          case int_array_HASH:
             return IndexFieldType::int_array;
-          }
-          else if (hashCode == double_array_HASH)
-          {
+          case double_array_HASH:
             return IndexFieldType::double_array;
-          }
-          else if (hashCode == literal_array_HASH)
-          {
+          case literal_array_HASH:
             return IndexFieldType::literal_array;
-          }
-          else if (hashCode == text_array_HASH)
-          {
+          case text_array_HASH:
             return IndexFieldType::text_array;
-          }
-          else if (hashCode == date_array_HASH)
-          {
+          case date_array_HASH:
             return IndexFieldType::date_array;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -55,13 +55,13 @@ Limits& Limits::operator =(const XmlNode& xmlNode)
     XmlNode maximumReplicationCountNode = resultNode.FirstChild("MaximumReplicationCount");
     if(!maximumReplicationCountNode.IsNull())
     {
-      m_maximumReplicationCount = StringUtils::ConvertToInt32(StringUtils::Trim(maximumReplicationCountNode.GetText().c_str()).c_str());
+      m_maximumReplicationCount = StringUtils::ConvertToInt32(maximumReplicationCountNode.GetTextView().Trim().ToString().c_str());
       m_maximumReplicationCountHasBeenSet = true;
     }
     XmlNode maximumPartitionCountNode = resultNode.FirstChild("MaximumPartitionCount");
     if(!maximumPartitionCountNode.IsNull())
     {
-      m_maximumPartitionCount = StringUtils::ConvertToInt32(StringUtils::Trim(maximumPartitionCountNode.GetText().c_str()).c_str());
+      m_maximumPartitionCount = StringUtils::ConvertToInt32(maximumPartitionCountNode.GetTextView().Trim().ToString().c_str());
       m_maximumPartitionCountHasBeenSet = true;
     }
   }
@@ -15,6 +15,7 @@
 #include <aws/cloudsearch/model/ListDomainNamesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudSearch::Model;
 using namespace Aws::Utils;
@@ -25,9 +26,9 @@ ListDomainNamesRequest::ListDomainNamesRequest()
 
 Aws::String ListDomainNamesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListDomainNames&";
   ss << "Version=2013-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
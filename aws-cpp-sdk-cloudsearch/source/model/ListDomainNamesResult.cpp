@@ -40,7 +40,7 @@ ListDomainNamesResult& ListDomainNamesResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListDomainNamesResult")
+  if (rootNode.GetNameView() != "ListDomainNamesResult")
   {
     resultNode = rootNode.FirstChild("ListDomainNamesResult");
   }
@@ -56,8 +56,8 @@ ListDomainNamesResult& ListDomainNamesResult::operator =(const AmazonWebServiceR
       {
         XmlNode keyNode = domainNamesEntry.FirstChild("key");
         XmlNode valueNode = domainNamesEntry.FirstChild("value");
-        m_domainNames[StringUtils::Trim(keyNode.GetText().c_str())] =
-            StringUtils::Trim(valueNode.GetText().c_str());
+        m_domainNames[keyNode.GetTextView().Trim().ToString()] =
+            valueNode.GetTextView().Trim().ToString();
         domainNamesEntry = domainNamesEntry.NextNode("entry");
       }
 
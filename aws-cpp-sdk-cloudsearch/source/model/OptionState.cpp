@@ -29,31 +29,35 @@ namespace Aws
       namespace OptionStateMapper
       {
 
-        static const int RequiresIndexDocuments_HASH = HashingUtils::HashString("RequiresIndexDocuments");
-        static const int Processing_HASH = HashingUtils::HashString("Processing");
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int FailedToValidate_HASH = HashingUtils::HashString("FailedToValidate");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int RequiresIndexDocuments_HASH = 173781364;
+        static const int Processing_HASH = -1879307469;
+        static const int Active_HASH = 1955883814;
+        static const int FailedToValidate_HASH = 1352215790;
 
 
         OptionState GetOptionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RequiresIndexDocuments_HASH)
+          switch (hashCode)
           {
+          case RequiresIndexDocuments_HASH:
             return OptionState::RequiresIndexDocuments;
-          }
-          else if (hashCode == Processing_HASH)
-          {
+          case Processing_HASH:
             return OptionState::Processing;
-          }
-          else if (hashCode == Active_HASH)
-          {
+          case Active_HASH:
             return OptionState::Active;
-          }
-          else if (hashCode == FailedToValidate_HASH)
-          {
+          case FailedToValidate_HASH:
             return OptionState::FailedToValidate;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
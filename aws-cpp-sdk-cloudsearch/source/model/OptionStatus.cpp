@@ -61,31 +61,31 @@ OptionStatus& OptionStatus::operator =(const XmlNode& xmlNode)
     XmlNode creationDateNode = resultNode.FirstChild("CreationDate");
     if(!creationDateNode.IsNull())
     {
-      m_creationDate = DateTime(StringUtils::Trim(creationDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_creationDate = DateTime(creationDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_creationDateHasBeenSet = true;
     }
     XmlNode updateDateNode = resultNode.FirstChild("UpdateDate");
     if(!updateDateNode.IsNull())
     {
-      m_updateDate = DateTime(StringUtils::Trim(updateDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_updateDate = DateTime(updateDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_updateDateHasBeenSet = true;
     }
     XmlNode updateVersionNode = resultNode.FirstChild("UpdateVersion");
     if(!updateVersionNode.IsNull())
     {
-      m_updateVersion = StringUtils::ConvertToInt32(StringUtils::Trim(updateVersionNode.GetText().c_str()).c_str());
+      m_updateVersion = StringUtils::ConvertToInt32(updateVersionNode.GetTextView().Trim().ToString().c_str());
       m_updateVersionHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("State");
     if(!stateNode.IsNull())
     {
-      m_state = OptionStateMapper::GetOptionStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = OptionStateMapper::GetOptionStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode pendingDeletionNode = resultNode.FirstChild("PendingDeletion");
     if(!pendingDeletionNode.IsNull())
     {
-      m_pendingDeletion = StringUtils::ConvertToBool(StringUtils::Trim(pendingDeletionNode.GetText().c_str()).c_str());
+      m_pendingDeletion = StringUtils::ConvertToBool(pendingDeletionNode.GetTextView().Trim().ToString().c_str());
       m_pendingDeletionHasBeenSet = true;
     }
   }
@@ -97,12 +97,12 @@ void OptionStatus::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_creationDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreationDate=" << StringUtils::URLEncode(m_creationDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreationDate=" << StringUtils::URLEncoded(m_creationDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_updateDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UpdateDate=" << StringUtils::URLEncode(m_updateDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".UpdateDate=" << StringUtils::URLEncoded(m_updateDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_updateVersionHasBeenSet)
@@ -126,11 +126,11 @@ void OptionStatus::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_creationDateHasBeenSet)
   {
-      oStream << location << ".CreationDate=" << StringUtils::URLEncode(m_creationDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreationDate=" << StringUtils::URLEncoded(m_creationDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_updateDateHasBeenSet)
   {
-      oStream << location << ".UpdateDate=" << StringUtils::URLEncode(m_updateDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".UpdateDate=" << StringUtils::URLEncoded(m_updateDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_updateVersionHasBeenSet)
   {
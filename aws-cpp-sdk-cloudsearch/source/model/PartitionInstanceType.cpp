@@ -29,51 +29,47 @@ namespace Aws
       namespace PartitionInstanceTypeMapper
       {
 
-        static const int search_m1_small_HASH = HashingUtils::HashString("search.m1.small");
-        static const int search_m1_large_HASH = HashingUtils::HashString("search.m1.large");
-        static const int search_m2_xlarge_HASH = HashingUtils::HashString("search.m2.xlarge");
-        static const int search_m2_2xlarge_HASH = HashingUtils::HashString("search.m2.2xlarge");
-        static const int search_m3_medium_HASH = HashingUtils::HashString("search.m3.medium");
-        static const int search_m3_large_HASH = HashingUtils::HashString("search.m3.large");
-        static const int search_m3_xlarge_HASH = HashingUtils::HashString("search.m3.xlarge");
-        static const int search_m3_2xlarge_HASH = HashingUtils::HashString("search.m3.2xlarge");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int search_m1_small_HASH = 1834835331;
+        static const int search_m1_large_HASH = 1828029367;
+        static const int search_m2_xlarge_HASH = -1364608602;
+        static const int search_m2_2xlarge_HASH = -995696398;
+        static const int search_m3_medium_HASH = 56897591;
+        static const int search_m3_large_HASH = -691930567;
+        static const int search_m3_xlarge_HASH = 378201733;
+        static const int search_m3_2xlarge_HASH = 1491816435;
 
 
         PartitionInstanceType GetPartitionInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == search_m1_small_HASH)
+          switch (hashCode)
           {
+          case search_m1_small_HASH:
             return PartitionInstanceType::search_m1_small;
-          }
-          else if (hashCode == search_m1_large_HASH)
-          {
+          case search_m1_large_HASH:
             return PartitionInstanceType::search_m1_large;
-          }
-          else if (hashCode == search_m2_xlarge_HASH)
-          {
+          case search_m2_xlarge_HASH:
             return PartitionInstanceType::search_m2_xlarge;
-          }
-          else if (hashCode == search_m2_2xlarge_HASH)
-          {
+          case search_m2_2xlarge_HASH:
             return PartitionInstanceType::search_m2_2xlarge;
-          }
-          else if (hashCode == search_m3_medium_HASH)
-          {
+          case search_m3_medium_HASH:
             return PartitionInstanceType::search_m3_medium;
-          }
-          else if (hashCode == search_m3_large_HASH)
-          {
+          case search_m3_large_HASH:
             return PartitionInstanceType::search_m3_large;
-          }
-          else if (hashCode == search_m3_xlarge_HASH)
-          {
+          case search_m3_xlarge_HASH:
             return PartitionInstanceType::search_m3_xlarge;
-          }
-          else if (hashCode == search_m3_2xlarge_HASH)
-          {
+          case search_m3_2xlarge_HASH:
             return PartitionInstanceType::search_m3_2xlarge;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -49,7 +49,7 @@ ServiceEndpoint& ServiceEndpoint::operator =(const XmlNode& xmlNode)
     XmlNode endpointNode = resultNode.FirstChild("Endpoint");
     if(!endpointNode.IsNull())
     {
-      m_endpoint = StringUtils::Trim(endpointNode.GetText().c_str());
+      m_endpoint = endpointNode.GetTextView().Trim().ToString();
       m_endpointHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void ServiceEndpoint::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_endpointHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Endpoint=" << StringUtils::URLEncode(m_endpoint.c_str()) << "&";
+      oStream << location << index << locationValue << ".Endpoint=" << StringUtils::URLEncoded(m_endpoint) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void ServiceEndpoint::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_endpointHasBeenSet)
   {
-      oStream << location << ".Endpoint=" << StringUtils::URLEncode(m_endpoint.c_str()) << "&";
+      oStream << location << ".Endpoint=" << StringUtils::URLEncoded(m_endpoint) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ Suggester& Suggester::operator =(const XmlNode& xmlNode)
     XmlNode suggesterNameNode = resultNode.FirstChild("SuggesterName");
     if(!suggesterNameNode.IsNull())
     {
-      m_suggesterName = StringUtils::Trim(suggesterNameNode.GetText().c_str());
+      m_suggesterName = suggesterNameNode.GetTextView().Trim().ToString();
       m_suggesterNameHasBeenSet = true;
     }
     XmlNode documentSuggesterOptionsNode = resultNode.FirstChild("DocumentSuggesterOptions");
@@ -69,14 +70,14 @@ void Suggester::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 {
   if(m_suggesterNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SuggesterName=" << StringUtils::URLEncode(m_suggesterName.c_str()) << "&";
+      oStream << location << index << locationValue << ".SuggesterName=" << StringUtils::URLEncoded(m_suggesterName) << "&";
   }
 
   if(m_documentSuggesterOptionsHasBeenSet)
   {
-      Aws::StringStream documentSuggesterOptionsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream documentSuggesterOptionsLocationAndMemberSs;
       documentSuggesterOptionsLocationAndMemberSs << location << index << locationValue << ".DocumentSuggesterOptions";
-      m_documentSuggesterOptions.OutputToStream(oStream, documentSuggesterOptionsLocationAndMemberSs.str().c_str());
+      m_documentSuggesterOptions.OutputToStream(oStream, documentSuggesterOptionsLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -85,7 +86,7 @@ void Suggester::OutputToStream(Aws::OStream& oStream, const char* location) cons
 {
   if(m_suggesterNameHasBeenSet)
   {
-      oStream << location << ".SuggesterName=" << StringUtils::URLEncode(m_suggesterName.c_str()) << "&";
+      oStream << location << ".SuggesterName=" << StringUtils::URLEncoded(m_suggesterName) << "&";
   }
   if(m_documentSuggesterOptionsHasBeenSet)
   {
@@ -29,26 +29,32 @@ namespace Aws
       namespace SuggesterFuzzyMatchingMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int low_HASH = HashingUtils::HashString("low");
-        static const int high_HASH = HashingUtils::HashString("high");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int none_HASH = 3387192;
+        static const int low_HASH = 107348;
+        static const int high_HASH = 3202466;
 
 
         SuggesterFuzzyMatching GetSuggesterFuzzyMatchingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
+          switch (hashCode)
           {
+          case none_HASH:
             return SuggesterFuzzyMatching::none;
-          }
-          else if (hashCode == low_HASH)
-          {
+          case low_HASH:
             return SuggesterFuzzyMatching::low;
-          }
-          else if (hashCode == high_HASH)
-          {
+          case high_HASH:
             return SuggesterFuzzyMatching::high;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
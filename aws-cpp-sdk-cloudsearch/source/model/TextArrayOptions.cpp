@@ -61,31 +61,31 @@ TextArrayOptions& TextArrayOptions::operator =(const XmlNode& xmlNode)
     XmlNode defaultValueNode = resultNode.FirstChild("DefaultValue");
     if(!defaultValueNode.IsNull())
     {
-      m_defaultValue = StringUtils::Trim(defaultValueNode.GetText().c_str());
+      m_defaultValue = defaultValueNode.GetTextView().Trim().ToString();
       m_defaultValueHasBeenSet = true;
     }
     XmlNode sourceFieldsNode = resultNode.FirstChild("SourceFields");
     if(!sourceFieldsNode.IsNull())
     {
-      m_sourceFields = StringUtils::Trim(sourceFieldsNode.GetText().c_str());
+      m_sourceFields = sourceFieldsNode.GetTextView().Trim().ToString();
       m_sourceFieldsHasBeenSet = true;
     }
     XmlNode returnEnabledNode = resultNode.FirstChild("ReturnEnabled");
     if(!returnEnabledNode.IsNull())
     {
-      m_returnEnabled = StringUtils::ConvertToBool(StringUtils::Trim(returnEnabledNode.GetText().c_str()).c_str());
+      m_returnEnabled = StringUtils::ConvertToBool(returnEnabledNode.GetTextView().Trim().ToString().c_str());
       m_returnEnabledHasBeenSet = true;
     }
     XmlNode highlightEnabledNode = resultNode.FirstChild("HighlightEnabled");
     if(!highlightEnabledNode.IsNull())
     {
-      m_highlightEnabled = StringUtils::ConvertToBool(StringUtils::Trim(highlightEnabledNode.GetText().c_str()).c_str());
+      m_highlightEnabled = StringUtils::ConvertToBool(highlightEnabledNode.GetTextView().Trim().ToString().c_str());
       m_highlightEnabledHasBeenSet = true;
     }
     XmlNode analysisSchemeNode = resultNode.FirstChild("AnalysisScheme");
     if(!analysisSchemeNode.IsNull())
     {
-      m_analysisScheme = StringUtils::Trim(analysisSchemeNode.GetText().c_str());
+      m_analysisScheme = analysisSchemeNode.GetTextView().Trim().ToString();
       m_analysisSchemeHasBeenSet = true;
     }
   }
@@ -97,12 +97,12 @@ void TextArrayOptions::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
 
   if(m_sourceFieldsHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceFields=" << StringUtils::URLEncode(m_sourceFields.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceFields=" << StringUtils::URLEncoded(m_sourceFields) << "&";
   }
 
   if(m_returnEnabledHasBeenSet)
@@ -117,7 +117,7 @@ void TextArrayOptions::OutputToStream(Aws::OStream& oStream, const char* locatio
 
   if(m_analysisSchemeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AnalysisScheme=" << StringUtils::URLEncode(m_analysisScheme.c_str()) << "&";
+      oStream << location << index << locationValue << ".AnalysisScheme=" << StringUtils::URLEncoded(m_analysisScheme) << "&";
   }
 
 }
@@ -126,11 +126,11 @@ void TextArrayOptions::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
   if(m_sourceFieldsHasBeenSet)
   {
-      oStream << location << ".SourceFields=" << StringUtils::URLEncode(m_sourceFields.c_str()) << "&";
+      oStream << location << ".SourceFields=" << StringUtils::URLEncoded(m_sourceFields) << "&";
   }
   if(m_returnEnabledHasBeenSet)
   {
@@ -142,7 +142,7 @@ void TextArrayOptions::OutputToStream(Aws::OStream& oStream, const char* locatio
   }
   if(m_analysisSchemeHasBeenSet)
   {
-      oStream << location << ".AnalysisScheme=" << StringUtils::URLEncode(m_analysisScheme.c_str()) << "&";
+      oStream << location << ".AnalysisScheme=" << StringUtils::URLEncoded(m_analysisScheme) << "&";
   }
 }
 
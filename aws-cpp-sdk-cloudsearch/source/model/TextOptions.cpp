@@ -65,37 +65,37 @@ TextOptions& TextOptions::operator =(const XmlNode& xmlNode)
     XmlNode defaultValueNode = resultNode.FirstChild("DefaultValue");
     if(!defaultValueNode.IsNull())
     {
-      m_defaultValue = StringUtils::Trim(defaultValueNode.GetText().c_str());
+      m_defaultValue = defaultValueNode.GetTextView().Trim().ToString();
       m_defaultValueHasBeenSet = true;
     }
     XmlNode sourceFieldNode = resultNode.FirstChild("SourceField");
     if(!sourceFieldNode.IsNull())
     {
-      m_sourceField = StringUtils::Trim(sourceFieldNode.GetText().c_str());
+      m_sourceField = sourceFieldNode.GetTextView().Trim().ToString();
       m_sourceFieldHasBeenSet = true;
     }
     XmlNode returnEnabledNode = resultNode.FirstChild("ReturnEnabled");
     if(!returnEnabledNode.IsNull())
     {
-      m_returnEnabled = StringUtils::ConvertToBool(StringUtils::Trim(returnEnabledNode.GetText().c_str()).c_str());
+      m_returnEnabled = StringUtils::ConvertToBool(returnEnabledNode.GetTextView().Trim().ToString().c_str());
       m_returnEnabledHasBeenSet = true;
     }
     XmlNode sortEnabledNode = resultNode.FirstChild("SortEnabled");
     if(!sortEnabledNode.IsNull())
     {
-      m_sortEnabled = StringUtils::ConvertToBool(StringUtils::Trim(sortEnabledNode.GetText().c_str()).c_str());
+      m_sortEnabled = StringUtils::ConvertToBool(sortEnabledNode.GetTextView().Trim().ToString().c_str());
       m_sortEnabledHasBeenSet = true;
     }
     XmlNode highlightEnabledNode = resultNode.FirstChild("HighlightEnabled");
     if(!highlightEnabledNode.IsNull())
     {
-      m_highlightEnabled = StringUtils::ConvertToBool(StringUtils::Trim(highlightEnabledNode.GetText().c_str()).c_str());
+      m_highlightEnabled = StringUtils::ConvertToBool(highlightEnabledNode.GetTextView().Trim().ToString().c_str());
       m_highlightEnabledHasBeenSet = true;
     }
     XmlNode analysisSchemeNode = resultNode.FirstChild("AnalysisScheme");
     if(!analysisSchemeNode.IsNull())
     {
-      m_analysisScheme = StringUtils::Trim(analysisSchemeNode.GetText().c_str());
+      m_analysisScheme = analysisSchemeNode.GetTextView().Trim().ToString();
       m_analysisSchemeHasBeenSet = true;
     }
   }
@@ -107,12 +107,12 @@ void TextOptions::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
 
   if(m_sourceFieldHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceField=" << StringUtils::URLEncode(m_sourceField.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceField=" << StringUtils::URLEncoded(m_sourceField) << "&";
   }
 
   if(m_returnEnabledHasBeenSet)
@@ -132,7 +132,7 @@ void TextOptions::OutputToStream(Aws::OStream& oStream, const char* location, un
 
   if(m_analysisSchemeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AnalysisScheme=" << StringUtils::URLEncode(m_analysisScheme.c_str()) << "&";
+      oStream << location << index << locationValue << ".AnalysisScheme=" << StringUtils::URLEncoded(m_analysisScheme) << "&";
   }
 
 }
@@ -141,11 +141,11 @@ void TextOptions::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
   if(m_sourceFieldHasBeenSet)
   {
-      oStream << location << ".SourceField=" << StringUtils::URLEncode(m_sourceField.c_str()) << "&";
+      oStream << location << ".SourceField=" << StringUtils::URLEncoded(m_sourceField) << "&";
   }
   if(m_returnEnabledHasBeenSet)
   {
@@ -161,7 +161,7 @@ void TextOptions::OutputToStream(Aws::OStream& oStream, const char* location) co
   }
   if(m_analysisSchemeHasBeenSet)
   {
-      oStream << location << ".AnalysisScheme=" << StringUtils::URLEncode(m_analysisScheme.c_str()) << "&";
+      oStream << location << ".AnalysisScheme=" << StringUtils::URLEncoded(m_analysisScheme) << "&";
   }
 }
 
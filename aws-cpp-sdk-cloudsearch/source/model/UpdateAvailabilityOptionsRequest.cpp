@@ -15,6 +15,7 @@
 #include <aws/cloudsearch/model/UpdateAvailabilityOptionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudSearch::Model;
 using namespace Aws::Utils;
@@ -28,11 +29,11 @@ UpdateAvailabilityOptionsRequest::UpdateAvailabilityOptionsRequest() :
 
 Aws::String UpdateAvailabilityOptionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UpdateAvailabilityOptions&";
   if(m_domainNameHasBeenSet)
   {
-    ss << "DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+    ss << "DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
 
   if(m_multiAZHasBeenSet)
@@ -41,6 +42,6 @@ Aws::String UpdateAvailabilityOptionsRequest::SerializePayload() const
   }
 
   ss << "Version=2013-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
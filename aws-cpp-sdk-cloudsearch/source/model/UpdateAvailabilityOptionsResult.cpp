@@ -40,7 +40,7 @@ UpdateAvailabilityOptionsResult& UpdateAvailabilityOptionsResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "UpdateAvailabilityOptionsResult")
+  if (rootNode.GetNameView() != "UpdateAvailabilityOptionsResult")
   {
     resultNode = rootNode.FirstChild("UpdateAvailabilityOptionsResult");
   }
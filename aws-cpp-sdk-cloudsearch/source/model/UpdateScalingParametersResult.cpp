@@ -40,7 +40,7 @@ UpdateScalingParametersResult& UpdateScalingParametersResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "UpdateScalingParametersResult")
+  if (rootNode.GetNameView() != "UpdateScalingParametersResult")
   {
     resultNode = rootNode.FirstChild("UpdateScalingParametersResult");
   }
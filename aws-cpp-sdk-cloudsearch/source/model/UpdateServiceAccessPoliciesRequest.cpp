@@ -15,6 +15,7 @@
 #include <aws/cloudsearch/model/UpdateServiceAccessPoliciesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudSearch::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ UpdateServiceAccessPoliciesRequest::UpdateServiceAccessPoliciesRequest() :
 
 Aws::String UpdateServiceAccessPoliciesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UpdateServiceAccessPolicies&";
   if(m_domainNameHasBeenSet)
   {
-    ss << "DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+    ss << "DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
 
   if(m_accessPoliciesHasBeenSet)
   {
-    ss << "AccessPolicies=" << StringUtils::URLEncode(m_accessPolicies.c_str()) << "&";
+    ss << "AccessPolicies=" << StringUtils::URLEncoded(m_accessPolicies) << "&";
   }
 
   ss << "Version=2013-01-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
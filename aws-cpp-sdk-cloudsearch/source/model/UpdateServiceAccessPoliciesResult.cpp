@@ -40,7 +40,7 @@ UpdateServiceAccessPoliciesResult& UpdateServiceAccessPoliciesResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "UpdateServiceAccessPoliciesResult")
+  if (rootNode.GetNameView() != "UpdateServiceAccessPoliciesResult")
   {
     resultNode = rootNode.FirstChild("UpdateServiceAccessPoliciesResult");
   }
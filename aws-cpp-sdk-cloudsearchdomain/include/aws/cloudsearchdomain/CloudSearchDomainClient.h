@@ -24,6 +24,9 @@
 #include <aws/cloudsearchdomain/model/SuggestResult.h>
 #include <aws/cloudsearchdomain/model/UploadDocumentsResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -198,6 +201,18 @@ namespace Model
          */
         virtual void SearchAsync(const Model::SearchRequest& request, const SearchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SearchCallable(const Model::SearchRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SearchOutcomeCallable SearchCallable(Model::SearchRequest&& request) const;
+
+        /**
+         * Same as SearchAsync(const Model::SearchRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SearchAsync(Model::SearchRequest&& request, const SearchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves autocomplete suggestions for a partial query string. You can use
          * suggestions enable you to display likely matches before users finish typing. In
@@ -259,6 +274,18 @@ namespace Model
          */
         virtual void SuggestAsync(const Model::SuggestRequest& request, const SuggestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SuggestCallable(const Model::SuggestRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SuggestOutcomeCallable SuggestCallable(Model::SuggestRequest&& request) const;
+
+        /**
+         * Same as SuggestAsync(const Model::SuggestRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SuggestAsync(Model::SuggestRequest&& request, const SuggestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Posts a batch of documents to a search domain for indexing. A document batch
          * is a collection of add and delete operations that represent the documents you
@@ -338,6 +365,35 @@ namespace Model
          */
         virtual void UploadDocumentsAsync(const Model::UploadDocumentsRequest& request, const UploadDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadDocumentsCallable(const Model::UploadDocumentsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UploadDocumentsOutcomeCallable UploadDocumentsCallable(Model::UploadDocumentsRequest&& request) const;
+
+        /**
+         * Same as UploadDocumentsAsync(const Model::UploadDocumentsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UploadDocumentsAsync(Model::UploadDocumentsRequest&& request, const UploadDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of Search(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchDomainClient, Model::SearchRequest, Model::SearchOutcome> SearchAwaitable(Model::SearchRequest request) const;
+
+        /**
+         * co_await-able form of Suggest(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchDomainClient, Model::SuggestRequest, Model::SuggestOutcome> SuggestAwaitable(Model::SuggestRequest request) const;
+
+        /**
+         * co_await-able form of UploadDocuments(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudSearchDomainClient, Model::UploadDocumentsRequest, Model::UploadDocumentsOutcome> UploadDocumentsAwaitable(Model::UploadDocumentsRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     SearchRequest();
+    inline const char* GetServiceRequestName() const override { return "Search"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
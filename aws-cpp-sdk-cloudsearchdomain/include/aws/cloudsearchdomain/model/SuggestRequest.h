@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     SuggestRequest();
+    inline const char* GetServiceRequestName() const override { return "Suggest"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UploadDocumentsRequest();
+    inline const char* GetServiceRequestName() const override { return "UploadDocuments"; }
+
   private:
   };
 
@@ -112,7 +112,7 @@ SearchOutcome CloudSearchDomainClient::Search(const SearchRequest& request) cons
 
 SearchOutcomeCallable CloudSearchDomainClient::SearchCallable(const SearchRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->Search(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->Search(request); } );
 }
 
 void CloudSearchDomainClient::SearchAsync(const SearchRequest& request, const SearchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -120,6 +120,16 @@ void CloudSearchDomainClient::SearchAsync(const SearchRequest& request, const Se
   m_executor->Submit( [this, request, handler, context](){ this->SearchAsyncHelper( request, handler, context ); } );
 }
 
+SearchOutcomeCallable CloudSearchDomainClient::SearchCallable(SearchRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchDomainClient::Search, this, std::move(request)));
+}
+
+void CloudSearchDomainClient::SearchAsync(SearchRequest&& request, const SearchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchDomainClient::SearchAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchDomainClient::SearchAsyncHelper(const SearchRequest& request, const SearchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, Search(request), context);
@@ -143,7 +153,7 @@ SuggestOutcome CloudSearchDomainClient::Suggest(const SuggestRequest& request) c
 
 SuggestOutcomeCallable CloudSearchDomainClient::SuggestCallable(const SuggestRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->Suggest(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->Suggest(request); } );
 }
 
 void CloudSearchDomainClient::SuggestAsync(const SuggestRequest& request, const SuggestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -151,6 +161,16 @@ void CloudSearchDomainClient::SuggestAsync(const SuggestRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->SuggestAsyncHelper( request, handler, context ); } );
 }
 
+SuggestOutcomeCallable CloudSearchDomainClient::SuggestCallable(SuggestRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchDomainClient::Suggest, this, std::move(request)));
+}
+
+void CloudSearchDomainClient::SuggestAsync(SuggestRequest&& request, const SuggestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchDomainClient::SuggestAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchDomainClient::SuggestAsyncHelper(const SuggestRequest& request, const SuggestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, Suggest(request), context);
@@ -174,7 +194,7 @@ UploadDocumentsOutcome CloudSearchDomainClient::UploadDocuments(const UploadDocu
 
 UploadDocumentsOutcomeCallable CloudSearchDomainClient::UploadDocumentsCallable(const UploadDocumentsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UploadDocuments(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UploadDocuments(request); } );
 }
 
 void CloudSearchDomainClient::UploadDocumentsAsync(const UploadDocumentsRequest& request, const UploadDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -182,8 +202,35 @@ void CloudSearchDomainClient::UploadDocumentsAsync(const UploadDocumentsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->UploadDocumentsAsyncHelper( request, handler, context ); } );
 }
 
+UploadDocumentsOutcomeCallable CloudSearchDomainClient::UploadDocumentsCallable(UploadDocumentsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudSearchDomainClient::UploadDocuments, this, std::move(request)));
+}
+
+void CloudSearchDomainClient::UploadDocumentsAsync(UploadDocumentsRequest&& request, const UploadDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudSearchDomainClient::UploadDocumentsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudSearchDomainClient::UploadDocumentsAsyncHelper(const UploadDocumentsRequest& request, const UploadDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UploadDocuments(request), context);
 }
 
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<CloudSearchDomainClient, SearchRequest, SearchOutcome> CloudSearchDomainClient::SearchAwaitable(SearchRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchDomainClient::Search, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchDomainClient, SuggestRequest, SuggestOutcome> CloudSearchDomainClient::SuggestAwaitable(SuggestRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchDomainClient::Suggest, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudSearchDomainClient, UploadDocumentsRequest, UploadDocumentsOutcome> CloudSearchDomainClient::UploadDocumentsAwaitable(UploadDocumentsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudSearchDomainClient::UploadDocuments, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
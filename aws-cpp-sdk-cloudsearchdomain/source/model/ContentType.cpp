@@ -29,21 +29,29 @@ namespace Aws
       namespace ContentTypeMapper
       {
 
-        static const int application_json_HASH = HashingUtils::HashString("application/json");
-        static const int application_xml_HASH = HashingUtils::HashString("application/xml");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int application_json_HASH = -43840953;
+        static const int application_xml_HASH = -1248326952;
 
 
         ContentType GetContentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == application_json_HASH)
+          switch (hashCode)
           {
+          case application_json_HASH:
             return ContentType::application_json;
-          }
-          else if (hashCode == application_xml_HASH)
-          {
+          case application_xml_HASH:
             return ContentType::application_xml;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,31 +29,35 @@ namespace Aws
       namespace QueryParserMapper
       {
 
-        static const int simple_HASH = HashingUtils::HashString("simple");
-        static const int structured_HASH = HashingUtils::HashString("structured");
-        static const int lucene_HASH = HashingUtils::HashString("lucene");
-        static const int dismax_HASH = HashingUtils::HashString("dismax");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int simple_HASH = -902286926;
+        static const int structured_HASH = 185106769;
+        static const int lucene_HASH = -1091917150;
+        static const int dismax_HASH = -1331548650;
 
 
         QueryParser GetQueryParserForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == simple_HASH)
+          switch (hashCode)
           {
+          case simple_HASH:
             return QueryParser::simple;
-          }
-          else if (hashCode == structured_HASH)
-          {
+          case structured_HASH:
             return QueryParser::structured;
-          }
-          else if (hashCode == lucene_HASH)
-          {
+          case lucene_HASH:
             return QueryParser::lucene;
-          }
-          else if (hashCode == dismax_HASH)
-          {
+          case dismax_HASH:
             return QueryParser::dismax;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -33,6 +33,9 @@
 #include <aws/cloudtrail/model/StopLoggingResult.h>
 #include <aws/cloudtrail/model/UpdateTrailResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -210,6 +213,18 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsCallable(const Model::AddTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsOutcomeCallable AddTagsCallable(Model::AddTagsRequest&& request) const;
+
+        /**
+         * Same as AddTagsAsync(const Model::AddTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsAsync(Model::AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a trail that specifies the settings for delivery of log data to an
          * Amazon S3 bucket. A maximum of five trails can exist in a region, irrespective
@@ -235,6 +250,18 @@ namespace Model
          */
         virtual void CreateTrailAsync(const Model::CreateTrailRequest& request, const CreateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTrailCallable(const Model::CreateTrailRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateTrailOutcomeCallable CreateTrailCallable(Model::CreateTrailRequest&& request) const;
+
+        /**
+         * Same as CreateTrailAsync(const Model::CreateTrailRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateTrailAsync(Model::CreateTrailRequest&& request, const CreateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a trail. This operation must be called from the region in which the
          * trail was created. <code>DeleteTrail</code> cannot be called on the shadow
@@ -263,6 +290,18 @@ namespace Model
          */
         virtual void DeleteTrailAsync(const Model::DeleteTrailRequest& request, const DeleteTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTrailCallable(const Model::DeleteTrailRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTrailOutcomeCallable DeleteTrailCallable(Model::DeleteTrailRequest&& request) const;
+
+        /**
+         * Same as DeleteTrailAsync(const Model::DeleteTrailRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTrailAsync(Model::DeleteTrailRequest&& request, const DeleteTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves settings for the trail associated with the current region for your
          * account.</p>
@@ -285,6 +324,18 @@ namespace Model
          */
         virtual void DescribeTrailsAsync(const Model::DescribeTrailsRequest& request, const DescribeTrailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTrailsCallable(const Model::DescribeTrailsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTrailsOutcomeCallable DescribeTrailsCallable(Model::DescribeTrailsRequest&& request) const;
+
+        /**
+         * Same as DescribeTrailsAsync(const Model::DescribeTrailsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTrailsAsync(Model::DescribeTrailsRequest&& request, const DescribeTrailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a JSON-formatted list of information about the specified trail.
          * Fields include information on delivery errors, Amazon SNS and Amazon S3 errors,
@@ -316,6 +367,18 @@ namespace Model
          */
         virtual void GetTrailStatusAsync(const Model::GetTrailStatusRequest& request, const GetTrailStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTrailStatusCallable(const Model::GetTrailStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetTrailStatusOutcomeCallable GetTrailStatusCallable(Model::GetTrailStatusRequest&& request) const;
+
+        /**
+         * Same as GetTrailStatusAsync(const Model::GetTrailStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetTrailStatusAsync(Model::GetTrailStatusRequest&& request, const GetTrailStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns all public keys whose private keys were used to sign the digest files
          * within the specified time range. The public key is needed to validate digest
@@ -353,6 +416,18 @@ namespace Model
          */
         virtual void ListPublicKeysAsync(const Model::ListPublicKeysRequest& request, const ListPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPublicKeysCallable(const Model::ListPublicKeysRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListPublicKeysOutcomeCallable ListPublicKeysCallable(Model::ListPublicKeysRequest&& request) const;
+
+        /**
+         * Same as ListPublicKeysAsync(const Model::ListPublicKeysRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPublicKeysAsync(Model::ListPublicKeysRequest&& request, const ListPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the tags for the trail in the current region.</p>
          */
@@ -372,6 +447,18 @@ namespace Model
          */
         virtual void ListTagsAsync(const Model::ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsCallable(const Model::ListTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsOutcomeCallable ListTagsCallable(Model::ListTagsRequest&& request) const;
+
+        /**
+         * Same as ListTagsAsync(const Model::ListTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsAsync(Model::ListTagsRequest&& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Looks up API activity events captured by CloudTrail that create, update, or
          * delete resources in your account. Events for a region can be looked up for the
@@ -430,6 +517,18 @@ namespace Model
          */
         virtual void LookupEventsAsync(const Model::LookupEventsRequest& request, const LookupEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as LookupEventsCallable(const Model::LookupEventsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::LookupEventsOutcomeCallable LookupEventsCallable(Model::LookupEventsRequest&& request) const;
+
+        /**
+         * Same as LookupEventsAsync(const Model::LookupEventsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void LookupEventsAsync(Model::LookupEventsRequest&& request, const LookupEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified tags from a trail.</p>
          */
@@ -449,6 +548,18 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsCallable(const Model::RemoveTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(Model::RemoveTagsRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsAsync(const Model::RemoveTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsAsync(Model::RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts the recording of AWS API calls and log file delivery for a trail. For
          * a trail that is enabled in all regions, this operation must be called from the
@@ -480,6 +591,18 @@ namespace Model
          */
         virtual void StartLoggingAsync(const Model::StartLoggingRequest& request, const StartLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartLoggingCallable(const Model::StartLoggingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StartLoggingOutcomeCallable StartLoggingCallable(Model::StartLoggingRequest&& request) const;
+
+        /**
+         * Same as StartLoggingAsync(const Model::StartLoggingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StartLoggingAsync(Model::StartLoggingRequest&& request, const StartLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Suspends the recording of AWS API calls and log file delivery for the
          * specified trail. Under most circumstances, there is no need to use this action.
@@ -520,6 +643,18 @@ namespace Model
          */
         virtual void StopLoggingAsync(const Model::StopLoggingRequest& request, const StopLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopLoggingCallable(const Model::StopLoggingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StopLoggingOutcomeCallable StopLoggingCallable(Model::StopLoggingRequest&& request) const;
+
+        /**
+         * Same as StopLoggingAsync(const Model::StopLoggingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StopLoggingAsync(Model::StopLoggingRequest&& request, const StopLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the settings that specify delivery of log files. Changes to a trail
          * do not require stopping the CloudTrail service. Use this action to designate an
@@ -554,6 +689,95 @@ namespace Model
          */
         virtual void UpdateTrailAsync(const Model::UpdateTrailRequest& request, const UpdateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateTrailCallable(const Model::UpdateTrailRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateTrailOutcomeCallable UpdateTrailCallable(Model::UpdateTrailRequest&& request) const;
+
+        /**
+         * Same as UpdateTrailAsync(const Model::UpdateTrailRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateTrailAsync(Model::UpdateTrailRequest&& request, const UpdateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListPublicKeys(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudTrailClient, Model::ListPublicKeysRequest, Model::ListPublicKeysOutcome> ListPublicKeysPaginator(const Model::ListPublicKeysRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListTags(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudTrailClient, Model::ListTagsRequest, Model::ListTagsOutcome> ListTagsPaginator(const Model::ListTagsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through LookupEvents(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudTrailClient, Model::LookupEventsRequest, Model::LookupEventsOutcome> LookupEventsPaginator(const Model::LookupEventsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudTrailClient, Model::AddTagsRequest, Model::AddTagsOutcome> AddTagsAwaitable(Model::AddTagsRequest request) const;
+
+        /**
+         * co_await-able form of CreateTrail(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudTrailClient, Model::CreateTrailRequest, Model::CreateTrailOutcome> CreateTrailAwaitable(Model::CreateTrailRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTrail(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudTrailClient, Model::DeleteTrailRequest, Model::DeleteTrailOutcome> DeleteTrailAwaitable(Model::DeleteTrailRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTrails(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudTrailClient, Model::DescribeTrailsRequest, Model::DescribeTrailsOutcome> DescribeTrailsAwaitable(Model::DescribeTrailsRequest request) const;
+
+        /**
+         * co_await-able form of GetTrailStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudTrailClient, Model::GetTrailStatusRequest, Model::GetTrailStatusOutcome> GetTrailStatusAwaitable(Model::GetTrailStatusRequest request) const;
+
+        /**
+         * co_await-able form of ListPublicKeys(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudTrailClient, Model::ListPublicKeysRequest, Model::ListPublicKeysOutcome> ListPublicKeysAwaitable(Model::ListPublicKeysRequest request) const;
+
+        /**
+         * co_await-able form of ListTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudTrailClient, Model::ListTagsRequest, Model::ListTagsOutcome> ListTagsAwaitable(Model::ListTagsRequest request) const;
+
+        /**
+         * co_await-able form of LookupEvents(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudTrailClient, Model::LookupEventsRequest, Model::LookupEventsOutcome> LookupEventsAwaitable(Model::LookupEventsRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudTrailClient, Model::RemoveTagsRequest, Model::RemoveTagsOutcome> RemoveTagsAwaitable(Model::RemoveTagsRequest request) const;
+
+        /**
+         * co_await-able form of StartLogging(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudTrailClient, Model::StartLoggingRequest, Model::StartLoggingOutcome> StartLoggingAwaitable(Model::StartLoggingRequest request) const;
+
+        /**
+         * co_await-able form of StopLogging(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudTrailClient, Model::StopLoggingRequest, Model::StopLoggingOutcome> StopLoggingAwaitable(Model::StopLoggingRequest request) const;
+
+        /**
+         * co_await-able form of UpdateTrail(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudTrailClient, Model::UpdateTrailRequest, Model::UpdateTrailOutcome> UpdateTrailAwaitable(Model::UpdateTrailRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
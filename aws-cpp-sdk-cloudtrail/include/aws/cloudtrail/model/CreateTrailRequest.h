@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateTrailRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateTrail"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
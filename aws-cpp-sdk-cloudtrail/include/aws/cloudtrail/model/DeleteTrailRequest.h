@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteTrailRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteTrail"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
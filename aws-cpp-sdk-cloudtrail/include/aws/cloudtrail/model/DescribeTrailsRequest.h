@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeTrailsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTrails"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetTrailStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "GetTrailStatus"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListPublicKeysRequest();
+    inline const char* GetServiceRequestName() const override { return "ListPublicKeys"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListTagsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTags"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     LookupEventsRequest();
+    inline const char* GetServiceRequestName() const override { return "LookupEvents"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     StartLoggingRequest();
+    inline const char* GetServiceRequestName() const override { return "StartLogging"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
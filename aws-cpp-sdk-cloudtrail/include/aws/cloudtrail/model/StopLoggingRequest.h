@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     StopLoggingRequest();
+    inline const char* GetServiceRequestName() const override { return "StopLogging"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
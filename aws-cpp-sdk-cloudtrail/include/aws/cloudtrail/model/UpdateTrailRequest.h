@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateTrailRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateTrail"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
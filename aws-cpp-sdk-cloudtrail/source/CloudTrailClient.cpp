@@ -121,7 +121,7 @@ AddTagsOutcome CloudTrailClient::AddTags(const AddTagsRequest& request) const
 
 AddTagsOutcomeCallable CloudTrailClient::AddTagsCallable(const AddTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTags(request); } );
 }
 
 void CloudTrailClient::AddTagsAsync(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -129,6 +129,16 @@ void CloudTrailClient::AddTagsAsync(const AddTagsRequest& request, const AddTags
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsOutcomeCallable CloudTrailClient::AddTagsCallable(AddTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudTrailClient::AddTags, this, std::move(request)));
+}
+
+void CloudTrailClient::AddTagsAsync(AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudTrailClient::AddTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudTrailClient::AddTagsAsyncHelper(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTags(request), context);
@@ -152,7 +162,7 @@ CreateTrailOutcome CloudTrailClient::CreateTrail(const CreateTrailRequest& reque
 
 CreateTrailOutcomeCallable CloudTrailClient::CreateTrailCallable(const CreateTrailRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateTrail(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateTrail(request); } );
 }
 
 void CloudTrailClient::CreateTrailAsync(const CreateTrailRequest& request, const CreateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -160,6 +170,16 @@ void CloudTrailClient::CreateTrailAsync(const CreateTrailRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->CreateTrailAsyncHelper( request, handler, context ); } );
 }
 
+CreateTrailOutcomeCallable CloudTrailClient::CreateTrailCallable(CreateTrailRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudTrailClient::CreateTrail, this, std::move(request)));
+}
+
+void CloudTrailClient::CreateTrailAsync(CreateTrailRequest&& request, const CreateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudTrailClient::CreateTrailAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudTrailClient::CreateTrailAsyncHelper(const CreateTrailRequest& request, const CreateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateTrail(request), context);
@@ -183,7 +203,7 @@ DeleteTrailOutcome CloudTrailClient::DeleteTrail(const DeleteTrailRequest& reque
 
 DeleteTrailOutcomeCallable CloudTrailClient::DeleteTrailCallable(const DeleteTrailRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTrail(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTrail(request); } );
 }
 
 void CloudTrailClient::DeleteTrailAsync(const DeleteTrailRequest& request, const DeleteTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -191,6 +211,16 @@ void CloudTrailClient::DeleteTrailAsync(const DeleteTrailRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTrailAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTrailOutcomeCallable CloudTrailClient::DeleteTrailCallable(DeleteTrailRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudTrailClient::DeleteTrail, this, std::move(request)));
+}
+
+void CloudTrailClient::DeleteTrailAsync(DeleteTrailRequest&& request, const DeleteTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudTrailClient::DeleteTrailAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudTrailClient::DeleteTrailAsyncHelper(const DeleteTrailRequest& request, const DeleteTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTrail(request), context);
@@ -214,7 +244,7 @@ DescribeTrailsOutcome CloudTrailClient::DescribeTrails(const DescribeTrailsReque
 
 DescribeTrailsOutcomeCallable CloudTrailClient::DescribeTrailsCallable(const DescribeTrailsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTrails(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTrails(request); } );
 }
 
 void CloudTrailClient::DescribeTrailsAsync(const DescribeTrailsRequest& request, const DescribeTrailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -222,6 +252,16 @@ void CloudTrailClient::DescribeTrailsAsync(const DescribeTrailsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTrailsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTrailsOutcomeCallable CloudTrailClient::DescribeTrailsCallable(DescribeTrailsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudTrailClient::DescribeTrails, this, std::move(request)));
+}
+
+void CloudTrailClient::DescribeTrailsAsync(DescribeTrailsRequest&& request, const DescribeTrailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudTrailClient::DescribeTrailsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudTrailClient::DescribeTrailsAsyncHelper(const DescribeTrailsRequest& request, const DescribeTrailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTrails(request), context);
@@ -245,7 +285,7 @@ GetTrailStatusOutcome CloudTrailClient::GetTrailStatus(const GetTrailStatusReque
 
 GetTrailStatusOutcomeCallable CloudTrailClient::GetTrailStatusCallable(const GetTrailStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetTrailStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetTrailStatus(request); } );
 }
 
 void CloudTrailClient::GetTrailStatusAsync(const GetTrailStatusRequest& request, const GetTrailStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -253,6 +293,16 @@ void CloudTrailClient::GetTrailStatusAsync(const GetTrailStatusRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->GetTrailStatusAsyncHelper( request, handler, context ); } );
 }
 
+GetTrailStatusOutcomeCallable CloudTrailClient::GetTrailStatusCallable(GetTrailStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudTrailClient::GetTrailStatus, this, std::move(request)));
+}
+
+void CloudTrailClient::GetTrailStatusAsync(GetTrailStatusRequest&& request, const GetTrailStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudTrailClient::GetTrailStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudTrailClient::GetTrailStatusAsyncHelper(const GetTrailStatusRequest& request, const GetTrailStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetTrailStatus(request), context);
@@ -276,7 +326,7 @@ ListPublicKeysOutcome CloudTrailClient::ListPublicKeys(const ListPublicKeysReque
 
 ListPublicKeysOutcomeCallable CloudTrailClient::ListPublicKeysCallable(const ListPublicKeysRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListPublicKeys(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListPublicKeys(request); } );
 }
 
 void CloudTrailClient::ListPublicKeysAsync(const ListPublicKeysRequest& request, const ListPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -284,6 +334,16 @@ void CloudTrailClient::ListPublicKeysAsync(const ListPublicKeysRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ListPublicKeysAsyncHelper( request, handler, context ); } );
 }
 
+ListPublicKeysOutcomeCallable CloudTrailClient::ListPublicKeysCallable(ListPublicKeysRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudTrailClient::ListPublicKeys, this, std::move(request)));
+}
+
+void CloudTrailClient::ListPublicKeysAsync(ListPublicKeysRequest&& request, const ListPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudTrailClient::ListPublicKeysAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudTrailClient::ListPublicKeysAsyncHelper(const ListPublicKeysRequest& request, const ListPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListPublicKeys(request), context);
@@ -307,7 +367,7 @@ ListTagsOutcome CloudTrailClient::ListTags(const ListTagsRequest& request) const
 
 ListTagsOutcomeCallable CloudTrailClient::ListTagsCallable(const ListTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTags(request); } );
 }
 
 void CloudTrailClient::ListTagsAsync(const ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -315,6 +375,16 @@ void CloudTrailClient::ListTagsAsync(const ListTagsRequest& request, const ListT
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsOutcomeCallable CloudTrailClient::ListTagsCallable(ListTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudTrailClient::ListTags, this, std::move(request)));
+}
+
+void CloudTrailClient::ListTagsAsync(ListTagsRequest&& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudTrailClient::ListTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudTrailClient::ListTagsAsyncHelper(const ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTags(request), context);
@@ -338,7 +408,7 @@ LookupEventsOutcome CloudTrailClient::LookupEvents(const LookupEventsRequest& re
 
 LookupEventsOutcomeCallable CloudTrailClient::LookupEventsCallable(const LookupEventsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->LookupEvents(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->LookupEvents(request); } );
 }
 
 void CloudTrailClient::LookupEventsAsync(const LookupEventsRequest& request, const LookupEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -346,6 +416,16 @@ void CloudTrailClient::LookupEventsAsync(const LookupEventsRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->LookupEventsAsyncHelper( request, handler, context ); } );
 }
 
+LookupEventsOutcomeCallable CloudTrailClient::LookupEventsCallable(LookupEventsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudTrailClient::LookupEvents, this, std::move(request)));
+}
+
+void CloudTrailClient::LookupEventsAsync(LookupEventsRequest&& request, const LookupEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudTrailClient::LookupEventsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudTrailClient::LookupEventsAsyncHelper(const LookupEventsRequest& request, const LookupEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, LookupEvents(request), context);
@@ -369,7 +449,7 @@ RemoveTagsOutcome CloudTrailClient::RemoveTags(const RemoveTagsRequest& request)
 
 RemoveTagsOutcomeCallable CloudTrailClient::RemoveTagsCallable(const RemoveTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTags(request); } );
 }
 
 void CloudTrailClient::RemoveTagsAsync(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -377,6 +457,16 @@ void CloudTrailClient::RemoveTagsAsync(const RemoveTagsRequest& request, const R
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsOutcomeCallable CloudTrailClient::RemoveTagsCallable(RemoveTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudTrailClient::RemoveTags, this, std::move(request)));
+}
+
+void CloudTrailClient::RemoveTagsAsync(RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudTrailClient::RemoveTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudTrailClient::RemoveTagsAsyncHelper(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTags(request), context);
@@ -400,7 +490,7 @@ StartLoggingOutcome CloudTrailClient::StartLogging(const StartLoggingRequest& re
 
 StartLoggingOutcomeCallable CloudTrailClient::StartLoggingCallable(const StartLoggingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StartLogging(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StartLogging(request); } );
 }
 
 void CloudTrailClient::StartLoggingAsync(const StartLoggingRequest& request, const StartLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -408,6 +498,16 @@ void CloudTrailClient::StartLoggingAsync(const StartLoggingRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->StartLoggingAsyncHelper( request, handler, context ); } );
 }
 
+StartLoggingOutcomeCallable CloudTrailClient::StartLoggingCallable(StartLoggingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudTrailClient::StartLogging, this, std::move(request)));
+}
+
+void CloudTrailClient::StartLoggingAsync(StartLoggingRequest&& request, const StartLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudTrailClient::StartLoggingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudTrailClient::StartLoggingAsyncHelper(const StartLoggingRequest& request, const StartLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StartLogging(request), context);
@@ -431,7 +531,7 @@ StopLoggingOutcome CloudTrailClient::StopLogging(const StopLoggingRequest& reque
 
 StopLoggingOutcomeCallable CloudTrailClient::StopLoggingCallable(const StopLoggingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StopLogging(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StopLogging(request); } );
 }
 
 void CloudTrailClient::StopLoggingAsync(const StopLoggingRequest& request, const StopLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -439,6 +539,16 @@ void CloudTrailClient::StopLoggingAsync(const StopLoggingRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->StopLoggingAsyncHelper( request, handler, context ); } );
 }
 
+StopLoggingOutcomeCallable CloudTrailClient::StopLoggingCallable(StopLoggingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudTrailClient::StopLogging, this, std::move(request)));
+}
+
+void CloudTrailClient::StopLoggingAsync(StopLoggingRequest&& request, const StopLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudTrailClient::StopLoggingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudTrailClient::StopLoggingAsyncHelper(const StopLoggingRequest& request, const StopLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StopLogging(request), context);
@@ -462,7 +572,7 @@ UpdateTrailOutcome CloudTrailClient::UpdateTrail(const UpdateTrailRequest& reque
 
 UpdateTrailOutcomeCallable CloudTrailClient::UpdateTrailCallable(const UpdateTrailRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateTrail(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateTrail(request); } );
 }
 
 void CloudTrailClient::UpdateTrailAsync(const UpdateTrailRequest& request, const UpdateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -470,8 +580,131 @@ void CloudTrailClient::UpdateTrailAsync(const UpdateTrailRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->UpdateTrailAsyncHelper( request, handler, context ); } );
 }
 
+UpdateTrailOutcomeCallable CloudTrailClient::UpdateTrailCallable(UpdateTrailRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudTrailClient::UpdateTrail, this, std::move(request)));
+}
+
+void CloudTrailClient::UpdateTrailAsync(UpdateTrailRequest&& request, const UpdateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudTrailClient::UpdateTrailAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudTrailClient::UpdateTrailAsyncHelper(const UpdateTrailRequest& request, const UpdateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateTrail(request), context);
 }
 
+Paginator<CloudTrailClient, ListPublicKeysRequest, ListPublicKeysOutcome> CloudTrailClient::ListPublicKeysPaginator(const ListPublicKeysRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudTrailClient, ListPublicKeysRequest, ListPublicKeysOutcome>(this, &CloudTrailClient::ListPublicKeys, request,
+    [](const ListPublicKeysRequest& current, const ListPublicKeysOutcome& outcome, ListPublicKeysRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudTrailClient, ListTagsRequest, ListTagsOutcome> CloudTrailClient::ListTagsPaginator(const ListTagsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudTrailClient, ListTagsRequest, ListTagsOutcome>(this, &CloudTrailClient::ListTags, request,
+    [](const ListTagsRequest& current, const ListTagsOutcome& outcome, ListTagsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudTrailClient, LookupEventsRequest, LookupEventsOutcome> CloudTrailClient::LookupEventsPaginator(const LookupEventsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudTrailClient, LookupEventsRequest, LookupEventsOutcome>(this, &CloudTrailClient::LookupEvents, request,
+    [](const LookupEventsRequest& current, const LookupEventsOutcome& outcome, LookupEventsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<CloudTrailClient, AddTagsRequest, AddTagsOutcome> CloudTrailClient::AddTagsAwaitable(AddTagsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudTrailClient::AddTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudTrailClient, CreateTrailRequest, CreateTrailOutcome> CloudTrailClient::CreateTrailAwaitable(CreateTrailRequest request) const
+{
+  return { m_executor.get(), { this, &CloudTrailClient::CreateTrail, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudTrailClient, DeleteTrailRequest, DeleteTrailOutcome> CloudTrailClient::DeleteTrailAwaitable(DeleteTrailRequest request) const
+{
+  return { m_executor.get(), { this, &CloudTrailClient::DeleteTrail, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudTrailClient, DescribeTrailsRequest, DescribeTrailsOutcome> CloudTrailClient::DescribeTrailsAwaitable(DescribeTrailsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudTrailClient::DescribeTrails, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudTrailClient, GetTrailStatusRequest, GetTrailStatusOutcome> CloudTrailClient::GetTrailStatusAwaitable(GetTrailStatusRequest request) const
+{
+  return { m_executor.get(), { this, &CloudTrailClient::GetTrailStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudTrailClient, ListPublicKeysRequest, ListPublicKeysOutcome> CloudTrailClient::ListPublicKeysAwaitable(ListPublicKeysRequest request) const
+{
+  return { m_executor.get(), { this, &CloudTrailClient::ListPublicKeys, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudTrailClient, ListTagsRequest, ListTagsOutcome> CloudTrailClient::ListTagsAwaitable(ListTagsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudTrailClient::ListTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudTrailClient, LookupEventsRequest, LookupEventsOutcome> CloudTrailClient::LookupEventsAwaitable(LookupEventsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudTrailClient::LookupEvents, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudTrailClient, RemoveTagsRequest, RemoveTagsOutcome> CloudTrailClient::RemoveTagsAwaitable(RemoveTagsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudTrailClient::RemoveTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudTrailClient, StartLoggingRequest, StartLoggingOutcome> CloudTrailClient::StartLoggingAwaitable(StartLoggingRequest request) const
+{
+  return { m_executor.get(), { this, &CloudTrailClient::StartLogging, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudTrailClient, StopLoggingRequest, StopLoggingOutcome> CloudTrailClient::StopLoggingAwaitable(StopLoggingRequest request) const
+{
+  return { m_executor.get(), { this, &CloudTrailClient::StopLogging, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudTrailClient, UpdateTrailRequest, UpdateTrailOutcome> CloudTrailClient::UpdateTrailAwaitable(UpdateTrailRequest request) const
+{
+  return { m_executor.get(), { this, &CloudTrailClient::UpdateTrail, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,36 +29,38 @@ namespace Aws
       namespace LookupAttributeKeyMapper
       {
 
-        static const int EventId_HASH = HashingUtils::HashString("EventId");
-        static const int EventName_HASH = HashingUtils::HashString("EventName");
-        static const int Username_HASH = HashingUtils::HashString("Username");
-        static const int ResourceType_HASH = HashingUtils::HashString("ResourceType");
-        static const int ResourceName_HASH = HashingUtils::HashString("ResourceName");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int EventId_HASH = 288150837;
+        static const int EventName_HASH = 2035196965;
+        static const int Username_HASH = -201069322;
+        static const int ResourceType_HASH = -220044152;
+        static const int ResourceName_HASH = -220246055;
 
 
         LookupAttributeKey GetLookupAttributeKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EventId_HASH)
+          switch (hashCode)
           {
+          case EventId_HASH:
             return LookupAttributeKey::EventId;
-          }
-          else if (hashCode == EventName_HASH)
-          {
+          case EventName_HASH:
             return LookupAttributeKey::EventName;
-          }
-          else if (hashCode == Username_HASH)
-          {
+          case Username_HASH:
             return LookupAttributeKey::Username;
-          }
-          else if (hashCode == ResourceType_HASH)
-          {
+          case ResourceType_HASH:
             return LookupAttributeKey::ResourceType;
-          }
-          else if (hashCode == ResourceName_HASH)
-          {
+          case ResourceName_HASH:
             return LookupAttributeKey::ResourceName;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -33,6 +33,9 @@
 #include <aws/codecommit/model/TestRepositoryTriggersResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -238,6 +241,18 @@ namespace Model
          */
         virtual void BatchGetRepositoriesAsync(const Model::BatchGetRepositoriesRequest& request, const BatchGetRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetRepositoriesCallable(const Model::BatchGetRepositoriesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BatchGetRepositoriesOutcomeCallable BatchGetRepositoriesCallable(Model::BatchGetRepositoriesRequest&& request) const;
+
+        /**
+         * Same as BatchGetRepositoriesAsync(const Model::BatchGetRepositoriesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BatchGetRepositoriesAsync(Model::BatchGetRepositoriesRequest&& request, const BatchGetRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new branch in a repository and points the branch to a commit.</p>
          * <note><p>Calling the create branch operation does not set a repository's default
@@ -263,6 +278,18 @@ namespace Model
          */
         virtual void CreateBranchAsync(const Model::CreateBranchRequest& request, const CreateBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateBranchCallable(const Model::CreateBranchRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateBranchOutcomeCallable CreateBranchCallable(Model::CreateBranchRequest&& request) const;
+
+        /**
+         * Same as CreateBranchAsync(const Model::CreateBranchRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateBranchAsync(Model::CreateBranchRequest&& request, const CreateBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new, empty repository.</p>
          */
@@ -282,6 +309,18 @@ namespace Model
          */
         virtual void CreateRepositoryAsync(const Model::CreateRepositoryRequest& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRepositoryCallable(const Model::CreateRepositoryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateRepositoryOutcomeCallable CreateRepositoryCallable(Model::CreateRepositoryRequest&& request) const;
+
+        /**
+         * Same as CreateRepositoryAsync(const Model::CreateRepositoryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateRepositoryAsync(Model::CreateRepositoryRequest&& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a repository. If a specified repository was already deleted, a null
          * repository ID will be returned.</p> <important>Deleting a repository also
@@ -310,6 +349,18 @@ namespace Model
          */
         virtual void DeleteRepositoryAsync(const Model::DeleteRepositoryRequest& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRepositoryCallable(const Model::DeleteRepositoryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRepositoryOutcomeCallable DeleteRepositoryCallable(Model::DeleteRepositoryRequest&& request) const;
+
+        /**
+         * Same as DeleteRepositoryAsync(const Model::DeleteRepositoryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRepositoryAsync(Model::DeleteRepositoryRequest&& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about a repository branch, including its name and the
          * last commit ID.</p>
@@ -332,6 +383,18 @@ namespace Model
          */
         virtual void GetBranchAsync(const Model::GetBranchRequest& request, const GetBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBranchCallable(const Model::GetBranchRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBranchOutcomeCallable GetBranchCallable(Model::GetBranchRequest&& request) const;
+
+        /**
+         * Same as GetBranchAsync(const Model::GetBranchRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBranchAsync(Model::GetBranchRequest&& request, const GetBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about a commit, including commit message and committer
          * information.</p>
@@ -354,6 +417,18 @@ namespace Model
          */
         virtual void GetCommitAsync(const Model::GetCommitRequest& request, const GetCommitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCommitCallable(const Model::GetCommitRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetCommitOutcomeCallable GetCommitCallable(Model::GetCommitRequest&& request) const;
+
+        /**
+         * Same as GetCommitAsync(const Model::GetCommitRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetCommitAsync(Model::GetCommitRequest&& request, const GetCommitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about a repository.</p> <note><p>The description field
          * for a repository accepts all HTML characters and all valid Unicode characters.
@@ -388,6 +463,18 @@ namespace Model
          */
         virtual void GetRepositoryAsync(const Model::GetRepositoryRequest& request, const GetRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRepositoryCallable(const Model::GetRepositoryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetRepositoryOutcomeCallable GetRepositoryCallable(Model::GetRepositoryRequest&& request) const;
+
+        /**
+         * Same as GetRepositoryAsync(const Model::GetRepositoryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetRepositoryAsync(Model::GetRepositoryRequest&& request, const GetRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about triggers configured for a repository.</p>
          */
@@ -407,6 +494,18 @@ namespace Model
          */
         virtual void GetRepositoryTriggersAsync(const Model::GetRepositoryTriggersRequest& request, const GetRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRepositoryTriggersCallable(const Model::GetRepositoryTriggersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetRepositoryTriggersOutcomeCallable GetRepositoryTriggersCallable(Model::GetRepositoryTriggersRequest&& request) const;
+
+        /**
+         * Same as GetRepositoryTriggersAsync(const Model::GetRepositoryTriggersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetRepositoryTriggersAsync(Model::GetRepositoryTriggersRequest&& request, const GetRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more branches in a repository.</p>
          */
@@ -426,6 +525,18 @@ namespace Model
          */
         virtual void ListBranchesAsync(const Model::ListBranchesRequest& request, const ListBranchesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListBranchesCallable(const Model::ListBranchesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListBranchesOutcomeCallable ListBranchesCallable(Model::ListBranchesRequest&& request) const;
+
+        /**
+         * Same as ListBranchesAsync(const Model::ListBranchesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListBranchesAsync(Model::ListBranchesRequest&& request, const ListBranchesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more repositories.</p>
          */
@@ -445,6 +556,18 @@ namespace Model
          */
         virtual void ListRepositoriesAsync(const Model::ListRepositoriesRequest& request, const ListRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRepositoriesCallable(const Model::ListRepositoriesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListRepositoriesOutcomeCallable ListRepositoriesCallable(Model::ListRepositoriesRequest&& request) const;
+
+        /**
+         * Same as ListRepositoriesAsync(const Model::ListRepositoriesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListRepositoriesAsync(Model::ListRepositoriesRequest&& request, const ListRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Replaces all triggers for a repository. This can be used to create or delete
          * triggers.</p>
@@ -467,6 +590,18 @@ namespace Model
          */
         virtual void PutRepositoryTriggersAsync(const Model::PutRepositoryTriggersRequest& request, const PutRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRepositoryTriggersCallable(const Model::PutRepositoryTriggersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutRepositoryTriggersOutcomeCallable PutRepositoryTriggersCallable(Model::PutRepositoryTriggersRequest&& request) const;
+
+        /**
+         * Same as PutRepositoryTriggersAsync(const Model::PutRepositoryTriggersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutRepositoryTriggersAsync(Model::PutRepositoryTriggersRequest&& request, const PutRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Tests the functionality of repository triggers by sending information to the
          * trigger target. If real data is available in the repository, the test will send
@@ -495,6 +630,18 @@ namespace Model
          */
         virtual void TestRepositoryTriggersAsync(const Model::TestRepositoryTriggersRequest& request, const TestRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TestRepositoryTriggersCallable(const Model::TestRepositoryTriggersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TestRepositoryTriggersOutcomeCallable TestRepositoryTriggersCallable(Model::TestRepositoryTriggersRequest&& request) const;
+
+        /**
+         * Same as TestRepositoryTriggersAsync(const Model::TestRepositoryTriggersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TestRepositoryTriggersAsync(Model::TestRepositoryTriggersRequest&& request, const TestRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets or changes the default branch name for the specified repository.</p>
          * <note><p>If you use this operation to change the default branch name to the
@@ -523,6 +670,18 @@ namespace Model
          */
         virtual void UpdateDefaultBranchAsync(const Model::UpdateDefaultBranchRequest& request, const UpdateDefaultBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDefaultBranchCallable(const Model::UpdateDefaultBranchRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateDefaultBranchOutcomeCallable UpdateDefaultBranchCallable(Model::UpdateDefaultBranchRequest&& request) const;
+
+        /**
+         * Same as UpdateDefaultBranchAsync(const Model::UpdateDefaultBranchRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateDefaultBranchAsync(Model::UpdateDefaultBranchRequest&& request, const UpdateDefaultBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets or changes the comment or description for a repository.</p> <note><p>The
          * description field for a repository accepts all HTML characters and all valid
@@ -557,6 +716,18 @@ namespace Model
          */
         virtual void UpdateRepositoryDescriptionAsync(const Model::UpdateRepositoryDescriptionRequest& request, const UpdateRepositoryDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateRepositoryDescriptionCallable(const Model::UpdateRepositoryDescriptionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateRepositoryDescriptionOutcomeCallable UpdateRepositoryDescriptionCallable(Model::UpdateRepositoryDescriptionRequest&& request) const;
+
+        /**
+         * Same as UpdateRepositoryDescriptionAsync(const Model::UpdateRepositoryDescriptionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateRepositoryDescriptionAsync(Model::UpdateRepositoryDescriptionRequest&& request, const UpdateRepositoryDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Renames a repository. The repository name must be unique across the calling
          * AWS account. In addition, repository names are limited to 100 alphanumeric,
@@ -594,6 +765,105 @@ namespace Model
          */
         virtual void UpdateRepositoryNameAsync(const Model::UpdateRepositoryNameRequest& request, const UpdateRepositoryNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateRepositoryNameCallable(const Model::UpdateRepositoryNameRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateRepositoryNameOutcomeCallable UpdateRepositoryNameCallable(Model::UpdateRepositoryNameRequest&& request) const;
+
+        /**
+         * Same as UpdateRepositoryNameAsync(const Model::UpdateRepositoryNameRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateRepositoryNameAsync(Model::UpdateRepositoryNameRequest&& request, const UpdateRepositoryNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListBranches(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CodeCommitClient, Model::ListBranchesRequest, Model::ListBranchesOutcome> ListBranchesPaginator(const Model::ListBranchesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListRepositories(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CodeCommitClient, Model::ListRepositoriesRequest, Model::ListRepositoriesOutcome> ListRepositoriesPaginator(const Model::ListRepositoriesRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of BatchGetRepositories(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeCommitClient, Model::BatchGetRepositoriesRequest, Model::BatchGetRepositoriesOutcome> BatchGetRepositoriesAwaitable(Model::BatchGetRepositoriesRequest request) const;
+
+        /**
+         * co_await-able form of CreateBranch(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeCommitClient, Model::CreateBranchRequest, Model::CreateBranchOutcome> CreateBranchAwaitable(Model::CreateBranchRequest request) const;
+
+        /**
+         * co_await-able form of CreateRepository(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeCommitClient, Model::CreateRepositoryRequest, Model::CreateRepositoryOutcome> CreateRepositoryAwaitable(Model::CreateRepositoryRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRepository(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeCommitClient, Model::DeleteRepositoryRequest, Model::DeleteRepositoryOutcome> DeleteRepositoryAwaitable(Model::DeleteRepositoryRequest request) const;
+
+        /**
+         * co_await-able form of GetBranch(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeCommitClient, Model::GetBranchRequest, Model::GetBranchOutcome> GetBranchAwaitable(Model::GetBranchRequest request) const;
+
+        /**
+         * co_await-able form of GetCommit(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeCommitClient, Model::GetCommitRequest, Model::GetCommitOutcome> GetCommitAwaitable(Model::GetCommitRequest request) const;
+
+        /**
+         * co_await-able form of GetRepository(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeCommitClient, Model::GetRepositoryRequest, Model::GetRepositoryOutcome> GetRepositoryAwaitable(Model::GetRepositoryRequest request) const;
+
+        /**
+         * co_await-able form of GetRepositoryTriggers(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeCommitClient, Model::GetRepositoryTriggersRequest, Model::GetRepositoryTriggersOutcome> GetRepositoryTriggersAwaitable(Model::GetRepositoryTriggersRequest request) const;
+
+        /**
+         * co_await-able form of ListBranches(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeCommitClient, Model::ListBranchesRequest, Model::ListBranchesOutcome> ListBranchesAwaitable(Model::ListBranchesRequest request) const;
+
+        /**
+         * co_await-able form of ListRepositories(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeCommitClient, Model::ListRepositoriesRequest, Model::ListRepositoriesOutcome> ListRepositoriesAwaitable(Model::ListRepositoriesRequest request) const;
+
+        /**
+         * co_await-able form of PutRepositoryTriggers(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeCommitClient, Model::PutRepositoryTriggersRequest, Model::PutRepositoryTriggersOutcome> PutRepositoryTriggersAwaitable(Model::PutRepositoryTriggersRequest request) const;
+
+        /**
+         * co_await-able form of TestRepositoryTriggers(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeCommitClient, Model::TestRepositoryTriggersRequest, Model::TestRepositoryTriggersOutcome> TestRepositoryTriggersAwaitable(Model::TestRepositoryTriggersRequest request) const;
+
+        /**
+         * co_await-able form of UpdateDefaultBranch(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeCommitClient, Model::UpdateDefaultBranchRequest, Model::UpdateDefaultBranchOutcome> UpdateDefaultBranchAwaitable(Model::UpdateDefaultBranchRequest request) const;
+
+        /**
+         * co_await-able form of UpdateRepositoryDescription(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeCommitClient, Model::UpdateRepositoryDescriptionRequest, Model::UpdateRepositoryDescriptionOutcome> UpdateRepositoryDescriptionAwaitable(Model::UpdateRepositoryDescriptionRequest request) const;
+
+        /**
+         * co_await-able form of UpdateRepositoryName(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeCommitClient, Model::UpdateRepositoryNameRequest, Model::UpdateRepositoryNameOutcome> UpdateRepositoryNameAwaitable(Model::UpdateRepositoryNameRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     BatchGetRepositoriesRequest();
+    inline const char* GetServiceRequestName() const override { return "BatchGetRepositories"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateBranchRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateBranch"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
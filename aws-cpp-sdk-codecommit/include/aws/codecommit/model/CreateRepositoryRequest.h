@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateRepositoryRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateRepository"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteRepositoryRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteRepository"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetBranchRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBranch"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetCommitRequest();
+    inline const char* GetServiceRequestName() const override { return "GetCommit"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetRepositoryRequest();
+    inline const char* GetServiceRequestName() const override { return "GetRepository"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetRepositoryTriggersRequest();
+    inline const char* GetServiceRequestName() const override { return "GetRepositoryTriggers"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
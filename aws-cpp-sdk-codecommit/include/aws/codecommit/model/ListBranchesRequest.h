@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListBranchesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListBranches"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
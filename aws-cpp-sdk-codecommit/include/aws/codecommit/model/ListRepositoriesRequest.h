@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ListRepositoriesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListRepositories"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
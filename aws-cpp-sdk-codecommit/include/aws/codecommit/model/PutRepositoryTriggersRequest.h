@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     PutRepositoryTriggersRequest();
+    inline const char* GetServiceRequestName() const override { return "PutRepositoryTriggers"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
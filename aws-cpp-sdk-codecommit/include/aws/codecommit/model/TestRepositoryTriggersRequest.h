@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     TestRepositoryTriggersRequest();
+    inline const char* GetServiceRequestName() const override { return "TestRepositoryTriggers"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
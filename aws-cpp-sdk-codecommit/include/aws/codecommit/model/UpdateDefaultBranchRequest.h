@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateDefaultBranchRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateDefaultBranch"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
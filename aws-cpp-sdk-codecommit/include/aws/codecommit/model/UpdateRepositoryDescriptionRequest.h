@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateRepositoryDescriptionRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateRepositoryDescription"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
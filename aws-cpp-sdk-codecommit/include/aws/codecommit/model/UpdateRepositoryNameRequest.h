@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateRepositoryNameRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateRepositoryName"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -124,7 +124,7 @@ BatchGetRepositoriesOutcome CodeCommitClient::BatchGetRepositories(const BatchGe
 
 BatchGetRepositoriesOutcomeCallable CodeCommitClient::BatchGetRepositoriesCallable(const BatchGetRepositoriesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BatchGetRepositories(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BatchGetRepositories(request); } );
 }
 
 void CodeCommitClient::BatchGetRepositoriesAsync(const BatchGetRepositoriesRequest& request, const BatchGetRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -132,6 +132,16 @@ void CodeCommitClient::BatchGetRepositoriesAsync(const BatchGetRepositoriesReque
   m_executor->Submit( [this, request, handler, context](){ this->BatchGetRepositoriesAsyncHelper( request, handler, context ); } );
 }
 
+BatchGetRepositoriesOutcomeCallable CodeCommitClient::BatchGetRepositoriesCallable(BatchGetRepositoriesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeCommitClient::BatchGetRepositories, this, std::move(request)));
+}
+
+void CodeCommitClient::BatchGetRepositoriesAsync(BatchGetRepositoriesRequest&& request, const BatchGetRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeCommitClient::BatchGetRepositoriesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeCommitClient::BatchGetRepositoriesAsyncHelper(const BatchGetRepositoriesRequest& request, const BatchGetRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BatchGetRepositories(request), context);
@@ -155,7 +165,7 @@ CreateBranchOutcome CodeCommitClient::CreateBranch(const CreateBranchRequest& re
 
 CreateBranchOutcomeCallable CodeCommitClient::CreateBranchCallable(const CreateBranchRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateBranch(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateBranch(request); } );
 }
 
 void CodeCommitClient::CreateBranchAsync(const CreateBranchRequest& request, const CreateBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -163,6 +173,16 @@ void CodeCommitClient::CreateBranchAsync(const CreateBranchRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->CreateBranchAsyncHelper( request, handler, context ); } );
 }
 
+CreateBranchOutcomeCallable CodeCommitClient::CreateBranchCallable(CreateBranchRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeCommitClient::CreateBranch, this, std::move(request)));
+}
+
+void CodeCommitClient::CreateBranchAsync(CreateBranchRequest&& request, const CreateBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeCommitClient::CreateBranchAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeCommitClient::CreateBranchAsyncHelper(const CreateBranchRequest& request, const CreateBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateBranch(request), context);
@@ -186,7 +206,7 @@ CreateRepositoryOutcome CodeCommitClient::CreateRepository(const CreateRepositor
 
 CreateRepositoryOutcomeCallable CodeCommitClient::CreateRepositoryCallable(const CreateRepositoryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateRepository(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateRepository(request); } );
 }
 
 void CodeCommitClient::CreateRepositoryAsync(const CreateRepositoryRequest& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -194,6 +214,16 @@ void CodeCommitClient::CreateRepositoryAsync(const CreateRepositoryRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->CreateRepositoryAsyncHelper( request, handler, context ); } );
 }
 
+CreateRepositoryOutcomeCallable CodeCommitClient::CreateRepositoryCallable(CreateRepositoryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeCommitClient::CreateRepository, this, std::move(request)));
+}
+
+void CodeCommitClient::CreateRepositoryAsync(CreateRepositoryRequest&& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeCommitClient::CreateRepositoryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeCommitClient::CreateRepositoryAsyncHelper(const CreateRepositoryRequest& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateRepository(request), context);
@@ -217,7 +247,7 @@ DeleteRepositoryOutcome CodeCommitClient::DeleteRepository(const DeleteRepositor
 
 DeleteRepositoryOutcomeCallable CodeCommitClient::DeleteRepositoryCallable(const DeleteRepositoryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRepository(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRepository(request); } );
 }
 
 void CodeCommitClient::DeleteRepositoryAsync(const DeleteRepositoryRequest& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -225,6 +255,16 @@ void CodeCommitClient::DeleteRepositoryAsync(const DeleteRepositoryRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRepositoryAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRepositoryOutcomeCallable CodeCommitClient::DeleteRepositoryCallable(DeleteRepositoryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeCommitClient::DeleteRepository, this, std::move(request)));
+}
+
+void CodeCommitClient::DeleteRepositoryAsync(DeleteRepositoryRequest&& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeCommitClient::DeleteRepositoryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeCommitClient::DeleteRepositoryAsyncHelper(const DeleteRepositoryRequest& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRepository(request), context);
@@ -248,7 +288,7 @@ GetBranchOutcome CodeCommitClient::GetBranch(const GetBranchRequest& request) co
 
 GetBranchOutcomeCallable CodeCommitClient::GetBranchCallable(const GetBranchRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBranch(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBranch(request); } );
 }
 
 void CodeCommitClient::GetBranchAsync(const GetBranchRequest& request, const GetBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -256,6 +296,16 @@ void CodeCommitClient::GetBranchAsync(const GetBranchRequest& request, const Get
   m_executor->Submit( [this, request, handler, context](){ this->GetBranchAsyncHelper( request, handler, context ); } );
 }
 
+GetBranchOutcomeCallable CodeCommitClient::GetBranchCallable(GetBranchRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeCommitClient::GetBranch, this, std::move(request)));
+}
+
+void CodeCommitClient::GetBranchAsync(GetBranchRequest&& request, const GetBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeCommitClient::GetBranchAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeCommitClient::GetBranchAsyncHelper(const GetBranchRequest& request, const GetBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBranch(request), context);
@@ -279,7 +329,7 @@ GetCommitOutcome CodeCommitClient::GetCommit(const GetCommitRequest& request) co
 
 GetCommitOutcomeCallable CodeCommitClient::GetCommitCallable(const GetCommitRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetCommit(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetCommit(request); } );
 }
 
 void CodeCommitClient::GetCommitAsync(const GetCommitRequest& request, const GetCommitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -287,6 +337,16 @@ void CodeCommitClient::GetCommitAsync(const GetCommitRequest& request, const Get
   m_executor->Submit( [this, request, handler, context](){ this->GetCommitAsyncHelper( request, handler, context ); } );
 }
 
+GetCommitOutcomeCallable CodeCommitClient::GetCommitCallable(GetCommitRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeCommitClient::GetCommit, this, std::move(request)));
+}
+
+void CodeCommitClient::GetCommitAsync(GetCommitRequest&& request, const GetCommitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeCommitClient::GetCommitAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeCommitClient::GetCommitAsyncHelper(const GetCommitRequest& request, const GetCommitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetCommit(request), context);
@@ -310,7 +370,7 @@ GetRepositoryOutcome CodeCommitClient::GetRepository(const GetRepositoryRequest&
 
 GetRepositoryOutcomeCallable CodeCommitClient::GetRepositoryCallable(const GetRepositoryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetRepository(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetRepository(request); } );
 }
 
 void CodeCommitClient::GetRepositoryAsync(const GetRepositoryRequest& request, const GetRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -318,6 +378,16 @@ void CodeCommitClient::GetRepositoryAsync(const GetRepositoryRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->GetRepositoryAsyncHelper( request, handler, context ); } );
 }
 
+GetRepositoryOutcomeCallable CodeCommitClient::GetRepositoryCallable(GetRepositoryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeCommitClient::GetRepository, this, std::move(request)));
+}
+
+void CodeCommitClient::GetRepositoryAsync(GetRepositoryRequest&& request, const GetRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeCommitClient::GetRepositoryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeCommitClient::GetRepositoryAsyncHelper(const GetRepositoryRequest& request, const GetRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetRepository(request), context);
@@ -341,7 +411,7 @@ GetRepositoryTriggersOutcome CodeCommitClient::GetRepositoryTriggers(const GetRe
 
 GetRepositoryTriggersOutcomeCallable CodeCommitClient::GetRepositoryTriggersCallable(const GetRepositoryTriggersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetRepositoryTriggers(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetRepositoryTriggers(request); } );
 }
 
 void CodeCommitClient::GetRepositoryTriggersAsync(const GetRepositoryTriggersRequest& request, const GetRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -349,6 +419,16 @@ void CodeCommitClient::GetRepositoryTriggersAsync(const GetRepositoryTriggersReq
   m_executor->Submit( [this, request, handler, context](){ this->GetRepositoryTriggersAsyncHelper( request, handler, context ); } );
 }
 
+GetRepositoryTriggersOutcomeCallable CodeCommitClient::GetRepositoryTriggersCallable(GetRepositoryTriggersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeCommitClient::GetRepositoryTriggers, this, std::move(request)));
+}
+
+void CodeCommitClient::GetRepositoryTriggersAsync(GetRepositoryTriggersRequest&& request, const GetRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeCommitClient::GetRepositoryTriggersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeCommitClient::GetRepositoryTriggersAsyncHelper(const GetRepositoryTriggersRequest& request, const GetRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetRepositoryTriggers(request), context);
@@ -372,7 +452,7 @@ ListBranchesOutcome CodeCommitClient::ListBranches(const ListBranchesRequest& re
 
 ListBranchesOutcomeCallable CodeCommitClient::ListBranchesCallable(const ListBranchesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListBranches(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListBranches(request); } );
 }
 
 void CodeCommitClient::ListBranchesAsync(const ListBranchesRequest& request, const ListBranchesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -380,6 +460,16 @@ void CodeCommitClient::ListBranchesAsync(const ListBranchesRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->ListBranchesAsyncHelper( request, handler, context ); } );
 }
 
+ListBranchesOutcomeCallable CodeCommitClient::ListBranchesCallable(ListBranchesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeCommitClient::ListBranches, this, std::move(request)));
+}
+
+void CodeCommitClient::ListBranchesAsync(ListBranchesRequest&& request, const ListBranchesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeCommitClient::ListBranchesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeCommitClient::ListBranchesAsyncHelper(const ListBranchesRequest& request, const ListBranchesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListBranches(request), context);
@@ -403,7 +493,7 @@ ListRepositoriesOutcome CodeCommitClient::ListRepositories(const ListRepositorie
 
 ListRepositoriesOutcomeCallable CodeCommitClient::ListRepositoriesCallable(const ListRepositoriesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListRepositories(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListRepositories(request); } );
 }
 
 void CodeCommitClient::ListRepositoriesAsync(const ListRepositoriesRequest& request, const ListRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -411,6 +501,16 @@ void CodeCommitClient::ListRepositoriesAsync(const ListRepositoriesRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->ListRepositoriesAsyncHelper( request, handler, context ); } );
 }
 
+ListRepositoriesOutcomeCallable CodeCommitClient::ListRepositoriesCallable(ListRepositoriesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeCommitClient::ListRepositories, this, std::move(request)));
+}
+
+void CodeCommitClient::ListRepositoriesAsync(ListRepositoriesRequest&& request, const ListRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeCommitClient::ListRepositoriesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeCommitClient::ListRepositoriesAsyncHelper(const ListRepositoriesRequest& request, const ListRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListRepositories(request), context);
@@ -434,7 +534,7 @@ PutRepositoryTriggersOutcome CodeCommitClient::PutRepositoryTriggers(const PutRe
 
 PutRepositoryTriggersOutcomeCallable CodeCommitClient::PutRepositoryTriggersCallable(const PutRepositoryTriggersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutRepositoryTriggers(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutRepositoryTriggers(request); } );
 }
 
 void CodeCommitClient::PutRepositoryTriggersAsync(const PutRepositoryTriggersRequest& request, const PutRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -442,6 +542,16 @@ void CodeCommitClient::PutRepositoryTriggersAsync(const PutRepositoryTriggersReq
   m_executor->Submit( [this, request, handler, context](){ this->PutRepositoryTriggersAsyncHelper( request, handler, context ); } );
 }
 
+PutRepositoryTriggersOutcomeCallable CodeCommitClient::PutRepositoryTriggersCallable(PutRepositoryTriggersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeCommitClient::PutRepositoryTriggers, this, std::move(request)));
+}
+
+void CodeCommitClient::PutRepositoryTriggersAsync(PutRepositoryTriggersRequest&& request, const PutRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeCommitClient::PutRepositoryTriggersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeCommitClient::PutRepositoryTriggersAsyncHelper(const PutRepositoryTriggersRequest& request, const PutRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutRepositoryTriggers(request), context);
@@ -465,7 +575,7 @@ TestRepositoryTriggersOutcome CodeCommitClient::TestRepositoryTriggers(const Tes
 
 TestRepositoryTriggersOutcomeCallable CodeCommitClient::TestRepositoryTriggersCallable(const TestRepositoryTriggersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TestRepositoryTriggers(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TestRepositoryTriggers(request); } );
 }
 
 void CodeCommitClient::TestRepositoryTriggersAsync(const TestRepositoryTriggersRequest& request, const TestRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -473,6 +583,16 @@ void CodeCommitClient::TestRepositoryTriggersAsync(const TestRepositoryTriggersR
   m_executor->Submit( [this, request, handler, context](){ this->TestRepositoryTriggersAsyncHelper( request, handler, context ); } );
 }
 
+TestRepositoryTriggersOutcomeCallable CodeCommitClient::TestRepositoryTriggersCallable(TestRepositoryTriggersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeCommitClient::TestRepositoryTriggers, this, std::move(request)));
+}
+
+void CodeCommitClient::TestRepositoryTriggersAsync(TestRepositoryTriggersRequest&& request, const TestRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeCommitClient::TestRepositoryTriggersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeCommitClient::TestRepositoryTriggersAsyncHelper(const TestRepositoryTriggersRequest& request, const TestRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TestRepositoryTriggers(request), context);
@@ -496,7 +616,7 @@ UpdateDefaultBranchOutcome CodeCommitClient::UpdateDefaultBranch(const UpdateDef
 
 UpdateDefaultBranchOutcomeCallable CodeCommitClient::UpdateDefaultBranchCallable(const UpdateDefaultBranchRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateDefaultBranch(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateDefaultBranch(request); } );
 }
 
 void CodeCommitClient::UpdateDefaultBranchAsync(const UpdateDefaultBranchRequest& request, const UpdateDefaultBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -504,6 +624,16 @@ void CodeCommitClient::UpdateDefaultBranchAsync(const UpdateDefaultBranchRequest
   m_executor->Submit( [this, request, handler, context](){ this->UpdateDefaultBranchAsyncHelper( request, handler, context ); } );
 }
 
+UpdateDefaultBranchOutcomeCallable CodeCommitClient::UpdateDefaultBranchCallable(UpdateDefaultBranchRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeCommitClient::UpdateDefaultBranch, this, std::move(request)));
+}
+
+void CodeCommitClient::UpdateDefaultBranchAsync(UpdateDefaultBranchRequest&& request, const UpdateDefaultBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeCommitClient::UpdateDefaultBranchAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeCommitClient::UpdateDefaultBranchAsyncHelper(const UpdateDefaultBranchRequest& request, const UpdateDefaultBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateDefaultBranch(request), context);
@@ -527,7 +657,7 @@ UpdateRepositoryDescriptionOutcome CodeCommitClient::UpdateRepositoryDescription
 
 UpdateRepositoryDescriptionOutcomeCallable CodeCommitClient::UpdateRepositoryDescriptionCallable(const UpdateRepositoryDescriptionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateRepositoryDescription(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateRepositoryDescription(request); } );
 }
 
 void CodeCommitClient::UpdateRepositoryDescriptionAsync(const UpdateRepositoryDescriptionRequest& request, const UpdateRepositoryDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -535,6 +665,16 @@ void CodeCommitClient::UpdateRepositoryDescriptionAsync(const UpdateRepositoryDe
   m_executor->Submit( [this, request, handler, context](){ this->UpdateRepositoryDescriptionAsyncHelper( request, handler, context ); } );
 }
 
+UpdateRepositoryDescriptionOutcomeCallable CodeCommitClient::UpdateRepositoryDescriptionCallable(UpdateRepositoryDescriptionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeCommitClient::UpdateRepositoryDescription, this, std::move(request)));
+}
+
+void CodeCommitClient::UpdateRepositoryDescriptionAsync(UpdateRepositoryDescriptionRequest&& request, const UpdateRepositoryDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeCommitClient::UpdateRepositoryDescriptionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeCommitClient::UpdateRepositoryDescriptionAsyncHelper(const UpdateRepositoryDescriptionRequest& request, const UpdateRepositoryDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateRepositoryDescription(request), context);
@@ -558,7 +698,7 @@ UpdateRepositoryNameOutcome CodeCommitClient::UpdateRepositoryName(const UpdateR
 
 UpdateRepositoryNameOutcomeCallable CodeCommitClient::UpdateRepositoryNameCallable(const UpdateRepositoryNameRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateRepositoryName(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateRepositoryName(request); } );
 }
 
 void CodeCommitClient::UpdateRepositoryNameAsync(const UpdateRepositoryNameRequest& request, const UpdateRepositoryNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -566,8 +706,129 @@ void CodeCommitClient::UpdateRepositoryNameAsync(const UpdateRepositoryNameReque
   m_executor->Submit( [this, request, handler, context](){ this->UpdateRepositoryNameAsyncHelper( request, handler, context ); } );
 }
 
+UpdateRepositoryNameOutcomeCallable CodeCommitClient::UpdateRepositoryNameCallable(UpdateRepositoryNameRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeCommitClient::UpdateRepositoryName, this, std::move(request)));
+}
+
+void CodeCommitClient::UpdateRepositoryNameAsync(UpdateRepositoryNameRequest&& request, const UpdateRepositoryNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeCommitClient::UpdateRepositoryNameAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeCommitClient::UpdateRepositoryNameAsyncHelper(const UpdateRepositoryNameRequest& request, const UpdateRepositoryNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateRepositoryName(request), context);
 }
 
+Paginator<CodeCommitClient, ListBranchesRequest, ListBranchesOutcome> CodeCommitClient::ListBranchesPaginator(const ListBranchesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CodeCommitClient, ListBranchesRequest, ListBranchesOutcome>(this, &CodeCommitClient::ListBranches, request,
+    [](const ListBranchesRequest& current, const ListBranchesOutcome& outcome, ListBranchesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CodeCommitClient, ListRepositoriesRequest, ListRepositoriesOutcome> CodeCommitClient::ListRepositoriesPaginator(const ListRepositoriesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CodeCommitClient, ListRepositoriesRequest, ListRepositoriesOutcome>(this, &CodeCommitClient::ListRepositories, request,
+    [](const ListRepositoriesRequest& current, const ListRepositoriesOutcome& outcome, ListRepositoriesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<CodeCommitClient, BatchGetRepositoriesRequest, BatchGetRepositoriesOutcome> CodeCommitClient::BatchGetRepositoriesAwaitable(BatchGetRepositoriesRequest request) const
+{
+  return { m_executor.get(), { this, &CodeCommitClient::BatchGetRepositories, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeCommitClient, CreateBranchRequest, CreateBranchOutcome> CodeCommitClient::CreateBranchAwaitable(CreateBranchRequest request) const
+{
+  return { m_executor.get(), { this, &CodeCommitClient::CreateBranch, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeCommitClient, CreateRepositoryRequest, CreateRepositoryOutcome> CodeCommitClient::CreateRepositoryAwaitable(CreateRepositoryRequest request) const
+{
+  return { m_executor.get(), { this, &CodeCommitClient::CreateRepository, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeCommitClient, DeleteRepositoryRequest, DeleteRepositoryOutcome> CodeCommitClient::DeleteRepositoryAwaitable(DeleteRepositoryRequest request) const
+{
+  return { m_executor.get(), { this, &CodeCommitClient::DeleteRepository, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeCommitClient, GetBranchRequest, GetBranchOutcome> CodeCommitClient::GetBranchAwaitable(GetBranchRequest request) const
+{
+  return { m_executor.get(), { this, &CodeCommitClient::GetBranch, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeCommitClient, GetCommitRequest, GetCommitOutcome> CodeCommitClient::GetCommitAwaitable(GetCommitRequest request) const
+{
+  return { m_executor.get(), { this, &CodeCommitClient::GetCommit, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeCommitClient, GetRepositoryRequest, GetRepositoryOutcome> CodeCommitClient::GetRepositoryAwaitable(GetRepositoryRequest request) const
+{
+  return { m_executor.get(), { this, &CodeCommitClient::GetRepository, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeCommitClient, GetRepositoryTriggersRequest, GetRepositoryTriggersOutcome> CodeCommitClient::GetRepositoryTriggersAwaitable(GetRepositoryTriggersRequest request) const
+{
+  return { m_executor.get(), { this, &CodeCommitClient::GetRepositoryTriggers, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeCommitClient, ListBranchesRequest, ListBranchesOutcome> CodeCommitClient::ListBranchesAwaitable(ListBranchesRequest request) const
+{
+  return { m_executor.get(), { this, &CodeCommitClient::ListBranches, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeCommitClient, ListRepositoriesRequest, ListRepositoriesOutcome> CodeCommitClient::ListRepositoriesAwaitable(ListRepositoriesRequest request) const
+{
+  return { m_executor.get(), { this, &CodeCommitClient::ListRepositories, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeCommitClient, PutRepositoryTriggersRequest, PutRepositoryTriggersOutcome> CodeCommitClient::PutRepositoryTriggersAwaitable(PutRepositoryTriggersRequest request) const
+{
+  return { m_executor.get(), { this, &CodeCommitClient::PutRepositoryTriggers, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeCommitClient, TestRepositoryTriggersRequest, TestRepositoryTriggersOutcome> CodeCommitClient::TestRepositoryTriggersAwaitable(TestRepositoryTriggersRequest request) const
+{
+  return { m_executor.get(), { this, &CodeCommitClient::TestRepositoryTriggers, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeCommitClient, UpdateDefaultBranchRequest, UpdateDefaultBranchOutcome> CodeCommitClient::UpdateDefaultBranchAwaitable(UpdateDefaultBranchRequest request) const
+{
+  return { m_executor.get(), { this, &CodeCommitClient::UpdateDefaultBranch, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeCommitClient, UpdateRepositoryDescriptionRequest, UpdateRepositoryDescriptionOutcome> CodeCommitClient::UpdateRepositoryDescriptionAwaitable(UpdateRepositoryDescriptionRequest request) const
+{
+  return { m_executor.get(), { this, &CodeCommitClient::UpdateRepositoryDescription, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeCommitClient, UpdateRepositoryNameRequest, UpdateRepositoryNameOutcome> CodeCommitClient::UpdateRepositoryNameAwaitable(UpdateRepositoryNameRequest request) const
+{
+  return { m_executor.get(), { this, &CodeCommitClient::UpdateRepositoryName, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,21 +29,29 @@ namespace Aws
       namespace OrderEnumMapper
       {
 
-        static const int ascending_HASH = HashingUtils::HashString("ascending");
-        static const int descending_HASH = HashingUtils::HashString("descending");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ascending_HASH = -4931880;
+        static const int descending_HASH = -1116296456;
 
 
         OrderEnum GetOrderEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ascending_HASH)
+          switch (hashCode)
           {
+          case ascending_HASH:
             return OrderEnum::ascending;
-          }
-          else if (hashCode == descending_HASH)
-          {
+          case descending_HASH:
             return OrderEnum::descending;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
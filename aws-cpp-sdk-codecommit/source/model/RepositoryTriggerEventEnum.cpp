@@ -29,31 +29,35 @@ namespace Aws
       namespace RepositoryTriggerEventEnumMapper
       {
 
-        static const int all_HASH = HashingUtils::HashString("all");
-        static const int updateReference_HASH = HashingUtils::HashString("updateReference");
-        static const int createReference_HASH = HashingUtils::HashString("createReference");
-        static const int deleteReference_HASH = HashingUtils::HashString("deleteReference");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int all_HASH = 96673;
+        static const int updateReference_HASH = 280361090;
+        static const int createReference_HASH = 1904679343;
+        static const int deleteReference_HASH = -142931488;
 
 
         RepositoryTriggerEventEnum GetRepositoryTriggerEventEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == all_HASH)
+          switch (hashCode)
           {
+          case all_HASH:
             return RepositoryTriggerEventEnum::all;
-          }
-          else if (hashCode == updateReference_HASH)
-          {
+          case updateReference_HASH:
             return RepositoryTriggerEventEnum::updateReference;
-          }
-          else if (hashCode == createReference_HASH)
-          {
+          case createReference_HASH:
             return RepositoryTriggerEventEnum::createReference;
-          }
-          else if (hashCode == deleteReference_HASH)
-          {
+          case deleteReference_HASH:
             return RepositoryTriggerEventEnum::deleteReference;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace SortByEnumMapper
       {
 
-        static const int repositoryName_HASH = HashingUtils::HashString("repositoryName");
-        static const int lastModifiedDate_HASH = HashingUtils::HashString("lastModifiedDate");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int repositoryName_HASH = -208071435;
+        static const int lastModifiedDate_HASH = -1540845619;
 
 
         SortByEnum GetSortByEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == repositoryName_HASH)
+          switch (hashCode)
           {
+          case repositoryName_HASH:
             return SortByEnum::repositoryName;
-          }
-          else if (hashCode == lastModifiedDate_HASH)
-          {
+          case lastModifiedDate_HASH:
             return SortByEnum::lastModifiedDate;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -49,6 +49,9 @@
 #include <aws/codedeploy/model/UpdateDeploymentGroupResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -320,6 +323,18 @@ namespace Model
          */
         virtual void AddTagsToOnPremisesInstancesAsync(const Model::AddTagsToOnPremisesInstancesRequest& request, const AddTagsToOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToOnPremisesInstancesCallable(const Model::AddTagsToOnPremisesInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsToOnPremisesInstancesOutcomeCallable AddTagsToOnPremisesInstancesCallable(Model::AddTagsToOnPremisesInstancesRequest&& request) const;
+
+        /**
+         * Same as AddTagsToOnPremisesInstancesAsync(const Model::AddTagsToOnPremisesInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsToOnPremisesInstancesAsync(Model::AddTagsToOnPremisesInstancesRequest&& request, const AddTagsToOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more application revisions.</p>
          */
@@ -339,6 +354,18 @@ namespace Model
          */
         virtual void BatchGetApplicationRevisionsAsync(const Model::BatchGetApplicationRevisionsRequest& request, const BatchGetApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetApplicationRevisionsCallable(const Model::BatchGetApplicationRevisionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BatchGetApplicationRevisionsOutcomeCallable BatchGetApplicationRevisionsCallable(Model::BatchGetApplicationRevisionsRequest&& request) const;
+
+        /**
+         * Same as BatchGetApplicationRevisionsAsync(const Model::BatchGetApplicationRevisionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BatchGetApplicationRevisionsAsync(Model::BatchGetApplicationRevisionsRequest&& request, const BatchGetApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more applications.</p>
          */
@@ -358,6 +385,18 @@ namespace Model
          */
         virtual void BatchGetApplicationsAsync(const Model::BatchGetApplicationsRequest& request, const BatchGetApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetApplicationsCallable(const Model::BatchGetApplicationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BatchGetApplicationsOutcomeCallable BatchGetApplicationsCallable(Model::BatchGetApplicationsRequest&& request) const;
+
+        /**
+         * Same as BatchGetApplicationsAsync(const Model::BatchGetApplicationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BatchGetApplicationsAsync(Model::BatchGetApplicationsRequest&& request, const BatchGetApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Get information about one or more deployment groups.</p>
          */
@@ -377,6 +416,18 @@ namespace Model
          */
         virtual void BatchGetDeploymentGroupsAsync(const Model::BatchGetDeploymentGroupsRequest& request, const BatchGetDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetDeploymentGroupsCallable(const Model::BatchGetDeploymentGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BatchGetDeploymentGroupsOutcomeCallable BatchGetDeploymentGroupsCallable(Model::BatchGetDeploymentGroupsRequest&& request) const;
+
+        /**
+         * Same as BatchGetDeploymentGroupsAsync(const Model::BatchGetDeploymentGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BatchGetDeploymentGroupsAsync(Model::BatchGetDeploymentGroupsRequest&& request, const BatchGetDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more instance that are part of a deployment
          * group.</p>
@@ -399,6 +450,18 @@ namespace Model
          */
         virtual void BatchGetDeploymentInstancesAsync(const Model::BatchGetDeploymentInstancesRequest& request, const BatchGetDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetDeploymentInstancesCallable(const Model::BatchGetDeploymentInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BatchGetDeploymentInstancesOutcomeCallable BatchGetDeploymentInstancesCallable(Model::BatchGetDeploymentInstancesRequest&& request) const;
+
+        /**
+         * Same as BatchGetDeploymentInstancesAsync(const Model::BatchGetDeploymentInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BatchGetDeploymentInstancesAsync(Model::BatchGetDeploymentInstancesRequest&& request, const BatchGetDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more deployments.</p>
          */
@@ -418,6 +481,18 @@ namespace Model
          */
         virtual void BatchGetDeploymentsAsync(const Model::BatchGetDeploymentsRequest& request, const BatchGetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetDeploymentsCallable(const Model::BatchGetDeploymentsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BatchGetDeploymentsOutcomeCallable BatchGetDeploymentsCallable(Model::BatchGetDeploymentsRequest&& request) const;
+
+        /**
+         * Same as BatchGetDeploymentsAsync(const Model::BatchGetDeploymentsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BatchGetDeploymentsAsync(Model::BatchGetDeploymentsRequest&& request, const BatchGetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more on-premises instances.</p>
          */
@@ -437,6 +512,18 @@ namespace Model
          */
         virtual void BatchGetOnPremisesInstancesAsync(const Model::BatchGetOnPremisesInstancesRequest& request, const BatchGetOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetOnPremisesInstancesCallable(const Model::BatchGetOnPremisesInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BatchGetOnPremisesInstancesOutcomeCallable BatchGetOnPremisesInstancesCallable(Model::BatchGetOnPremisesInstancesRequest&& request) const;
+
+        /**
+         * Same as BatchGetOnPremisesInstancesAsync(const Model::BatchGetOnPremisesInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BatchGetOnPremisesInstancesAsync(Model::BatchGetOnPremisesInstancesRequest&& request, const BatchGetOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an application.</p>
          */
@@ -456,6 +543,18 @@ namespace Model
          */
         virtual void CreateApplicationAsync(const Model::CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateApplicationCallable(const Model::CreateApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateApplicationOutcomeCallable CreateApplicationCallable(Model::CreateApplicationRequest&& request) const;
+
+        /**
+         * Same as CreateApplicationAsync(const Model::CreateApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateApplicationAsync(Model::CreateApplicationRequest&& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deploys an application revision through the specified deployment group.</p>
          */
@@ -475,6 +574,18 @@ namespace Model
          */
         virtual void CreateDeploymentAsync(const Model::CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDeploymentCallable(const Model::CreateDeploymentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDeploymentOutcomeCallable CreateDeploymentCallable(Model::CreateDeploymentRequest&& request) const;
+
+        /**
+         * Same as CreateDeploymentAsync(const Model::CreateDeploymentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDeploymentAsync(Model::CreateDeploymentRequest&& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a deployment configuration.</p>
          */
@@ -494,6 +605,18 @@ namespace Model
          */
         virtual void CreateDeploymentConfigAsync(const Model::CreateDeploymentConfigRequest& request, const CreateDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDeploymentConfigCallable(const Model::CreateDeploymentConfigRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDeploymentConfigOutcomeCallable CreateDeploymentConfigCallable(Model::CreateDeploymentConfigRequest&& request) const;
+
+        /**
+         * Same as CreateDeploymentConfigAsync(const Model::CreateDeploymentConfigRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDeploymentConfigAsync(Model::CreateDeploymentConfigRequest&& request, const CreateDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a deployment group to which application revisions will be
          * deployed.</p>
@@ -516,6 +639,18 @@ namespace Model
          */
         virtual void CreateDeploymentGroupAsync(const Model::CreateDeploymentGroupRequest& request, const CreateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDeploymentGroupCallable(const Model::CreateDeploymentGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDeploymentGroupOutcomeCallable CreateDeploymentGroupCallable(Model::CreateDeploymentGroupRequest&& request) const;
+
+        /**
+         * Same as CreateDeploymentGroupAsync(const Model::CreateDeploymentGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDeploymentGroupAsync(Model::CreateDeploymentGroupRequest&& request, const CreateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an application.</p>
          */
@@ -535,6 +670,18 @@ namespace Model
          */
         virtual void DeleteApplicationAsync(const Model::DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteApplicationCallable(const Model::DeleteApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteApplicationOutcomeCallable DeleteApplicationCallable(Model::DeleteApplicationRequest&& request) const;
+
+        /**
+         * Same as DeleteApplicationAsync(const Model::DeleteApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteApplicationAsync(Model::DeleteApplicationRequest&& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a deployment configuration.</p> <note>A deployment configuration
          * cannot be deleted if it is currently in use. Predefined configurations cannot be
@@ -560,6 +707,18 @@ namespace Model
          */
         virtual void DeleteDeploymentConfigAsync(const Model::DeleteDeploymentConfigRequest& request, const DeleteDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDeploymentConfigCallable(const Model::DeleteDeploymentConfigRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDeploymentConfigOutcomeCallable DeleteDeploymentConfigCallable(Model::DeleteDeploymentConfigRequest&& request) const;
+
+        /**
+         * Same as DeleteDeploymentConfigAsync(const Model::DeleteDeploymentConfigRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDeploymentConfigAsync(Model::DeleteDeploymentConfigRequest&& request, const DeleteDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a deployment group.</p>
          */
@@ -579,6 +738,18 @@ namespace Model
          */
         virtual void DeleteDeploymentGroupAsync(const Model::DeleteDeploymentGroupRequest& request, const DeleteDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDeploymentGroupCallable(const Model::DeleteDeploymentGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDeploymentGroupOutcomeCallable DeleteDeploymentGroupCallable(Model::DeleteDeploymentGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteDeploymentGroupAsync(const Model::DeleteDeploymentGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDeploymentGroupAsync(Model::DeleteDeploymentGroupRequest&& request, const DeleteDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters an on-premises instance.</p>
          */
@@ -598,6 +769,18 @@ namespace Model
          */
         virtual void DeregisterOnPremisesInstanceAsync(const Model::DeregisterOnPremisesInstanceRequest& request, const DeregisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterOnPremisesInstanceCallable(const Model::DeregisterOnPremisesInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeregisterOnPremisesInstanceOutcomeCallable DeregisterOnPremisesInstanceCallable(Model::DeregisterOnPremisesInstanceRequest&& request) const;
+
+        /**
+         * Same as DeregisterOnPremisesInstanceAsync(const Model::DeregisterOnPremisesInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeregisterOnPremisesInstanceAsync(Model::DeregisterOnPremisesInstanceRequest&& request, const DeregisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about an application.</p>
          */
@@ -617,6 +800,18 @@ namespace Model
          */
         virtual void GetApplicationAsync(const Model::GetApplicationRequest& request, const GetApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetApplicationCallable(const Model::GetApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetApplicationOutcomeCallable GetApplicationCallable(Model::GetApplicationRequest&& request) const;
+
+        /**
+         * Same as GetApplicationAsync(const Model::GetApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetApplicationAsync(Model::GetApplicationRequest&& request, const GetApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about an application revision.</p>
          */
@@ -636,6 +831,18 @@ namespace Model
          */
         virtual void GetApplicationRevisionAsync(const Model::GetApplicationRevisionRequest& request, const GetApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetApplicationRevisionCallable(const Model::GetApplicationRevisionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetApplicationRevisionOutcomeCallable GetApplicationRevisionCallable(Model::GetApplicationRevisionRequest&& request) const;
+
+        /**
+         * Same as GetApplicationRevisionAsync(const Model::GetApplicationRevisionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetApplicationRevisionAsync(Model::GetApplicationRevisionRequest&& request, const GetApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a deployment.</p>
          */
@@ -655,6 +862,18 @@ namespace Model
          */
         virtual void GetDeploymentAsync(const Model::GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDeploymentCallable(const Model::GetDeploymentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDeploymentOutcomeCallable GetDeploymentCallable(Model::GetDeploymentRequest&& request) const;
+
+        /**
+         * Same as GetDeploymentAsync(const Model::GetDeploymentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDeploymentAsync(Model::GetDeploymentRequest&& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a deployment configuration.</p>
          */
@@ -674,6 +893,18 @@ namespace Model
          */
         virtual void GetDeploymentConfigAsync(const Model::GetDeploymentConfigRequest& request, const GetDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDeploymentConfigCallable(const Model::GetDeploymentConfigRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDeploymentConfigOutcomeCallable GetDeploymentConfigCallable(Model::GetDeploymentConfigRequest&& request) const;
+
+        /**
+         * Same as GetDeploymentConfigAsync(const Model::GetDeploymentConfigRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDeploymentConfigAsync(Model::GetDeploymentConfigRequest&& request, const GetDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a deployment group.</p>
          */
@@ -693,6 +924,18 @@ namespace Model
          */
         virtual void GetDeploymentGroupAsync(const Model::GetDeploymentGroupRequest& request, const GetDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDeploymentGroupCallable(const Model::GetDeploymentGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDeploymentGroupOutcomeCallable GetDeploymentGroupCallable(Model::GetDeploymentGroupRequest&& request) const;
+
+        /**
+         * Same as GetDeploymentGroupAsync(const Model::GetDeploymentGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDeploymentGroupAsync(Model::GetDeploymentGroupRequest&& request, const GetDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about an instance as part of a deployment.</p>
          */
@@ -712,6 +955,18 @@ namespace Model
          */
         virtual void GetDeploymentInstanceAsync(const Model::GetDeploymentInstanceRequest& request, const GetDeploymentInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDeploymentInstanceCallable(const Model::GetDeploymentInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDeploymentInstanceOutcomeCallable GetDeploymentInstanceCallable(Model::GetDeploymentInstanceRequest&& request) const;
+
+        /**
+         * Same as GetDeploymentInstanceAsync(const Model::GetDeploymentInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDeploymentInstanceAsync(Model::GetDeploymentInstanceRequest&& request, const GetDeploymentInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about an on-premises instance.</p>
          */
@@ -731,6 +986,18 @@ namespace Model
          */
         virtual void GetOnPremisesInstanceAsync(const Model::GetOnPremisesInstanceRequest& request, const GetOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetOnPremisesInstanceCallable(const Model::GetOnPremisesInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetOnPremisesInstanceOutcomeCallable GetOnPremisesInstanceCallable(Model::GetOnPremisesInstanceRequest&& request) const;
+
+        /**
+         * Same as GetOnPremisesInstanceAsync(const Model::GetOnPremisesInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetOnPremisesInstanceAsync(Model::GetOnPremisesInstanceRequest&& request, const GetOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists information about revisions for an application.</p>
          */
@@ -750,6 +1017,18 @@ namespace Model
          */
         virtual void ListApplicationRevisionsAsync(const Model::ListApplicationRevisionsRequest& request, const ListApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListApplicationRevisionsCallable(const Model::ListApplicationRevisionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListApplicationRevisionsOutcomeCallable ListApplicationRevisionsCallable(Model::ListApplicationRevisionsRequest&& request) const;
+
+        /**
+         * Same as ListApplicationRevisionsAsync(const Model::ListApplicationRevisionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListApplicationRevisionsAsync(Model::ListApplicationRevisionsRequest&& request, const ListApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the applications registered with the applicable IAM user or AWS
          * account.</p>
@@ -772,6 +1051,18 @@ namespace Model
          */
         virtual void ListApplicationsAsync(const Model::ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListApplicationsCallable(const Model::ListApplicationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListApplicationsOutcomeCallable ListApplicationsCallable(Model::ListApplicationsRequest&& request) const;
+
+        /**
+         * Same as ListApplicationsAsync(const Model::ListApplicationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListApplicationsAsync(Model::ListApplicationsRequest&& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the deployment configurations with the applicable IAM user or AWS
          * account.</p>
@@ -794,6 +1085,18 @@ namespace Model
          */
         virtual void ListDeploymentConfigsAsync(const Model::ListDeploymentConfigsRequest& request, const ListDeploymentConfigsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDeploymentConfigsCallable(const Model::ListDeploymentConfigsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDeploymentConfigsOutcomeCallable ListDeploymentConfigsCallable(Model::ListDeploymentConfigsRequest&& request) const;
+
+        /**
+         * Same as ListDeploymentConfigsAsync(const Model::ListDeploymentConfigsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDeploymentConfigsAsync(Model::ListDeploymentConfigsRequest&& request, const ListDeploymentConfigsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the deployment groups for an application registered with the applicable
          * IAM user or AWS account.</p>
@@ -816,6 +1119,18 @@ namespace Model
          */
         virtual void ListDeploymentGroupsAsync(const Model::ListDeploymentGroupsRequest& request, const ListDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDeploymentGroupsCallable(const Model::ListDeploymentGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDeploymentGroupsOutcomeCallable ListDeploymentGroupsCallable(Model::ListDeploymentGroupsRequest&& request) const;
+
+        /**
+         * Same as ListDeploymentGroupsAsync(const Model::ListDeploymentGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDeploymentGroupsAsync(Model::ListDeploymentGroupsRequest&& request, const ListDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the instance for a deployment associated with the applicable IAM user
          * or AWS account.</p>
@@ -838,6 +1153,18 @@ namespace Model
          */
         virtual void ListDeploymentInstancesAsync(const Model::ListDeploymentInstancesRequest& request, const ListDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDeploymentInstancesCallable(const Model::ListDeploymentInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDeploymentInstancesOutcomeCallable ListDeploymentInstancesCallable(Model::ListDeploymentInstancesRequest&& request) const;
+
+        /**
+         * Same as ListDeploymentInstancesAsync(const Model::ListDeploymentInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDeploymentInstancesAsync(Model::ListDeploymentInstancesRequest&& request, const ListDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the deployments in a deployment group for an application registered
          * with the applicable IAM user or AWS account.</p>
@@ -860,6 +1187,18 @@ namespace Model
          */
         virtual void ListDeploymentsAsync(const Model::ListDeploymentsRequest& request, const ListDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDeploymentsCallable(const Model::ListDeploymentsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDeploymentsOutcomeCallable ListDeploymentsCallable(Model::ListDeploymentsRequest&& request) const;
+
+        /**
+         * Same as ListDeploymentsAsync(const Model::ListDeploymentsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDeploymentsAsync(Model::ListDeploymentsRequest&& request, const ListDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a list of names for one or more on-premises instances.</p> <p>Unless
          * otherwise specified, both registered and deregistered on-premises instance names
@@ -888,6 +1227,18 @@ namespace Model
          */
         virtual void ListOnPremisesInstancesAsync(const Model::ListOnPremisesInstancesRequest& request, const ListOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListOnPremisesInstancesCallable(const Model::ListOnPremisesInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListOnPremisesInstancesOutcomeCallable ListOnPremisesInstancesCallable(Model::ListOnPremisesInstancesRequest&& request) const;
+
+        /**
+         * Same as ListOnPremisesInstancesAsync(const Model::ListOnPremisesInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListOnPremisesInstancesAsync(Model::ListOnPremisesInstancesRequest&& request, const ListOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers with AWS CodeDeploy a revision for the specified application.</p>
          */
@@ -907,6 +1258,18 @@ namespace Model
          */
         virtual void RegisterApplicationRevisionAsync(const Model::RegisterApplicationRevisionRequest& request, const RegisterApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterApplicationRevisionCallable(const Model::RegisterApplicationRevisionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterApplicationRevisionOutcomeCallable RegisterApplicationRevisionCallable(Model::RegisterApplicationRevisionRequest&& request) const;
+
+        /**
+         * Same as RegisterApplicationRevisionAsync(const Model::RegisterApplicationRevisionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterApplicationRevisionAsync(Model::RegisterApplicationRevisionRequest&& request, const RegisterApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers an on-premises instance.</p>
          */
@@ -926,6 +1289,18 @@ namespace Model
          */
         virtual void RegisterOnPremisesInstanceAsync(const Model::RegisterOnPremisesInstanceRequest& request, const RegisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterOnPremisesInstanceCallable(const Model::RegisterOnPremisesInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterOnPremisesInstanceOutcomeCallable RegisterOnPremisesInstanceCallable(Model::RegisterOnPremisesInstanceRequest&& request) const;
+
+        /**
+         * Same as RegisterOnPremisesInstanceAsync(const Model::RegisterOnPremisesInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterOnPremisesInstanceAsync(Model::RegisterOnPremisesInstanceRequest&& request, const RegisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes one or more tags from one or more on-premises instances.</p>
          */
@@ -945,6 +1320,18 @@ namespace Model
          */
         virtual void RemoveTagsFromOnPremisesInstancesAsync(const Model::RemoveTagsFromOnPremisesInstancesRequest& request, const RemoveTagsFromOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromOnPremisesInstancesCallable(const Model::RemoveTagsFromOnPremisesInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsFromOnPremisesInstancesOutcomeCallable RemoveTagsFromOnPremisesInstancesCallable(Model::RemoveTagsFromOnPremisesInstancesRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsFromOnPremisesInstancesAsync(const Model::RemoveTagsFromOnPremisesInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsFromOnPremisesInstancesAsync(Model::RemoveTagsFromOnPremisesInstancesRequest&& request, const RemoveTagsFromOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attempts to stop an ongoing deployment.</p>
          */
@@ -964,6 +1351,18 @@ namespace Model
          */
         virtual void StopDeploymentAsync(const Model::StopDeploymentRequest& request, const StopDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopDeploymentCallable(const Model::StopDeploymentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StopDeploymentOutcomeCallable StopDeploymentCallable(Model::StopDeploymentRequest&& request) const;
+
+        /**
+         * Same as StopDeploymentAsync(const Model::StopDeploymentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StopDeploymentAsync(Model::StopDeploymentRequest&& request, const StopDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the name of an application.</p>
          */
@@ -983,6 +1382,18 @@ namespace Model
          */
         virtual void UpdateApplicationAsync(const Model::UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateApplicationCallable(const Model::UpdateApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateApplicationOutcomeCallable UpdateApplicationCallable(Model::UpdateApplicationRequest&& request) const;
+
+        /**
+         * Same as UpdateApplicationAsync(const Model::UpdateApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateApplicationAsync(Model::UpdateApplicationRequest&& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about a deployment group.</p>
          */
@@ -1002,6 +1413,230 @@ namespace Model
          */
         virtual void UpdateDeploymentGroupAsync(const Model::UpdateDeploymentGroupRequest& request, const UpdateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDeploymentGroupCallable(const Model::UpdateDeploymentGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateDeploymentGroupOutcomeCallable UpdateDeploymentGroupCallable(Model::UpdateDeploymentGroupRequest&& request) const;
+
+        /**
+         * Same as UpdateDeploymentGroupAsync(const Model::UpdateDeploymentGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateDeploymentGroupAsync(Model::UpdateDeploymentGroupRequest&& request, const UpdateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListApplicationRevisions(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CodeDeployClient, Model::ListApplicationRevisionsRequest, Model::ListApplicationRevisionsOutcome> ListApplicationRevisionsPaginator(const Model::ListApplicationRevisionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListApplications(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CodeDeployClient, Model::ListApplicationsRequest, Model::ListApplicationsOutcome> ListApplicationsPaginator(const Model::ListApplicationsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListDeploymentConfigs(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CodeDeployClient, Model::ListDeploymentConfigsRequest, Model::ListDeploymentConfigsOutcome> ListDeploymentConfigsPaginator(const Model::ListDeploymentConfigsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListDeploymentGroups(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CodeDeployClient, Model::ListDeploymentGroupsRequest, Model::ListDeploymentGroupsOutcome> ListDeploymentGroupsPaginator(const Model::ListDeploymentGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListDeploymentInstances(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CodeDeployClient, Model::ListDeploymentInstancesRequest, Model::ListDeploymentInstancesOutcome> ListDeploymentInstancesPaginator(const Model::ListDeploymentInstancesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListDeployments(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CodeDeployClient, Model::ListDeploymentsRequest, Model::ListDeploymentsOutcome> ListDeploymentsPaginator(const Model::ListDeploymentsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListOnPremisesInstances(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CodeDeployClient, Model::ListOnPremisesInstancesRequest, Model::ListOnPremisesInstancesOutcome> ListOnPremisesInstancesPaginator(const Model::ListOnPremisesInstancesRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddTagsToOnPremisesInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::AddTagsToOnPremisesInstancesRequest, Model::AddTagsToOnPremisesInstancesOutcome> AddTagsToOnPremisesInstancesAwaitable(Model::AddTagsToOnPremisesInstancesRequest request) const;
+
+        /**
+         * co_await-able form of BatchGetApplicationRevisions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::BatchGetApplicationRevisionsRequest, Model::BatchGetApplicationRevisionsOutcome> BatchGetApplicationRevisionsAwaitable(Model::BatchGetApplicationRevisionsRequest request) const;
+
+        /**
+         * co_await-able form of BatchGetApplications(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::BatchGetApplicationsRequest, Model::BatchGetApplicationsOutcome> BatchGetApplicationsAwaitable(Model::BatchGetApplicationsRequest request) const;
+
+        /**
+         * co_await-able form of BatchGetDeploymentGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::BatchGetDeploymentGroupsRequest, Model::BatchGetDeploymentGroupsOutcome> BatchGetDeploymentGroupsAwaitable(Model::BatchGetDeploymentGroupsRequest request) const;
+
+        /**
+         * co_await-able form of BatchGetDeploymentInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::BatchGetDeploymentInstancesRequest, Model::BatchGetDeploymentInstancesOutcome> BatchGetDeploymentInstancesAwaitable(Model::BatchGetDeploymentInstancesRequest request) const;
+
+        /**
+         * co_await-able form of BatchGetDeployments(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::BatchGetDeploymentsRequest, Model::BatchGetDeploymentsOutcome> BatchGetDeploymentsAwaitable(Model::BatchGetDeploymentsRequest request) const;
+
+        /**
+         * co_await-able form of BatchGetOnPremisesInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::BatchGetOnPremisesInstancesRequest, Model::BatchGetOnPremisesInstancesOutcome> BatchGetOnPremisesInstancesAwaitable(Model::BatchGetOnPremisesInstancesRequest request) const;
+
+        /**
+         * co_await-able form of CreateApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::CreateApplicationRequest, Model::CreateApplicationOutcome> CreateApplicationAwaitable(Model::CreateApplicationRequest request) const;
+
+        /**
+         * co_await-able form of CreateDeployment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::CreateDeploymentRequest, Model::CreateDeploymentOutcome> CreateDeploymentAwaitable(Model::CreateDeploymentRequest request) const;
+
+        /**
+         * co_await-able form of CreateDeploymentConfig(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::CreateDeploymentConfigRequest, Model::CreateDeploymentConfigOutcome> CreateDeploymentConfigAwaitable(Model::CreateDeploymentConfigRequest request) const;
+
+        /**
+         * co_await-able form of CreateDeploymentGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::CreateDeploymentGroupRequest, Model::CreateDeploymentGroupOutcome> CreateDeploymentGroupAwaitable(Model::CreateDeploymentGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::DeleteApplicationRequest, Model::DeleteApplicationOutcome> DeleteApplicationAwaitable(Model::DeleteApplicationRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDeploymentConfig(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::DeleteDeploymentConfigRequest, Model::DeleteDeploymentConfigOutcome> DeleteDeploymentConfigAwaitable(Model::DeleteDeploymentConfigRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDeploymentGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::DeleteDeploymentGroupRequest, Model::DeleteDeploymentGroupOutcome> DeleteDeploymentGroupAwaitable(Model::DeleteDeploymentGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeregisterOnPremisesInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::DeregisterOnPremisesInstanceRequest, Model::DeregisterOnPremisesInstanceOutcome> DeregisterOnPremisesInstanceAwaitable(Model::DeregisterOnPremisesInstanceRequest request) const;
+
+        /**
+         * co_await-able form of GetApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::GetApplicationRequest, Model::GetApplicationOutcome> GetApplicationAwaitable(Model::GetApplicationRequest request) const;
+
+        /**
+         * co_await-able form of GetApplicationRevision(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::GetApplicationRevisionRequest, Model::GetApplicationRevisionOutcome> GetApplicationRevisionAwaitable(Model::GetApplicationRevisionRequest request) const;
+
+        /**
+         * co_await-able form of GetDeployment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::GetDeploymentRequest, Model::GetDeploymentOutcome> GetDeploymentAwaitable(Model::GetDeploymentRequest request) const;
+
+        /**
+         * co_await-able form of GetDeploymentConfig(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::GetDeploymentConfigRequest, Model::GetDeploymentConfigOutcome> GetDeploymentConfigAwaitable(Model::GetDeploymentConfigRequest request) const;
+
+        /**
+         * co_await-able form of GetDeploymentGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::GetDeploymentGroupRequest, Model::GetDeploymentGroupOutcome> GetDeploymentGroupAwaitable(Model::GetDeploymentGroupRequest request) const;
+
+        /**
+         * co_await-able form of GetDeploymentInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::GetDeploymentInstanceRequest, Model::GetDeploymentInstanceOutcome> GetDeploymentInstanceAwaitable(Model::GetDeploymentInstanceRequest request) const;
+
+        /**
+         * co_await-able form of GetOnPremisesInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::GetOnPremisesInstanceRequest, Model::GetOnPremisesInstanceOutcome> GetOnPremisesInstanceAwaitable(Model::GetOnPremisesInstanceRequest request) const;
+
+        /**
+         * co_await-able form of ListApplicationRevisions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::ListApplicationRevisionsRequest, Model::ListApplicationRevisionsOutcome> ListApplicationRevisionsAwaitable(Model::ListApplicationRevisionsRequest request) const;
+
+        /**
+         * co_await-able form of ListApplications(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::ListApplicationsRequest, Model::ListApplicationsOutcome> ListApplicationsAwaitable(Model::ListApplicationsRequest request) const;
+
+        /**
+         * co_await-able form of ListDeploymentConfigs(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::ListDeploymentConfigsRequest, Model::ListDeploymentConfigsOutcome> ListDeploymentConfigsAwaitable(Model::ListDeploymentConfigsRequest request) const;
+
+        /**
+         * co_await-able form of ListDeploymentGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::ListDeploymentGroupsRequest, Model::ListDeploymentGroupsOutcome> ListDeploymentGroupsAwaitable(Model::ListDeploymentGroupsRequest request) const;
+
+        /**
+         * co_await-able form of ListDeploymentInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::ListDeploymentInstancesRequest, Model::ListDeploymentInstancesOutcome> ListDeploymentInstancesAwaitable(Model::ListDeploymentInstancesRequest request) const;
+
+        /**
+         * co_await-able form of ListDeployments(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::ListDeploymentsRequest, Model::ListDeploymentsOutcome> ListDeploymentsAwaitable(Model::ListDeploymentsRequest request) const;
+
+        /**
+         * co_await-able form of ListOnPremisesInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::ListOnPremisesInstancesRequest, Model::ListOnPremisesInstancesOutcome> ListOnPremisesInstancesAwaitable(Model::ListOnPremisesInstancesRequest request) const;
+
+        /**
+         * co_await-able form of RegisterApplicationRevision(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::RegisterApplicationRevisionRequest, Model::RegisterApplicationRevisionOutcome> RegisterApplicationRevisionAwaitable(Model::RegisterApplicationRevisionRequest request) const;
+
+        /**
+         * co_await-able form of RegisterOnPremisesInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::RegisterOnPremisesInstanceRequest, Model::RegisterOnPremisesInstanceOutcome> RegisterOnPremisesInstanceAwaitable(Model::RegisterOnPremisesInstanceRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTagsFromOnPremisesInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::RemoveTagsFromOnPremisesInstancesRequest, Model::RemoveTagsFromOnPremisesInstancesOutcome> RemoveTagsFromOnPremisesInstancesAwaitable(Model::RemoveTagsFromOnPremisesInstancesRequest request) const;
+
+        /**
+         * co_await-able form of StopDeployment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::StopDeploymentRequest, Model::StopDeploymentOutcome> StopDeploymentAwaitable(Model::StopDeploymentRequest request) const;
+
+        /**
+         * co_await-able form of UpdateApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::UpdateApplicationRequest, Model::UpdateApplicationOutcome> UpdateApplicationAwaitable(Model::UpdateApplicationRequest request) const;
+
+        /**
+         * co_await-able form of UpdateDeploymentGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodeDeployClient, Model::UpdateDeploymentGroupRequest, Model::UpdateDeploymentGroupOutcome> UpdateDeploymentGroupAwaitable(Model::UpdateDeploymentGroupRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
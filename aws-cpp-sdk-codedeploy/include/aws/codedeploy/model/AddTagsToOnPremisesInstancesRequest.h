@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     AddTagsToOnPremisesInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "AddTagsToOnPremisesInstances"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
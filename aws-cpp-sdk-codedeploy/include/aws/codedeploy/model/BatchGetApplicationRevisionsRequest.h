@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     BatchGetApplicationRevisionsRequest();
+    inline const char* GetServiceRequestName() const override { return "BatchGetApplicationRevisions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
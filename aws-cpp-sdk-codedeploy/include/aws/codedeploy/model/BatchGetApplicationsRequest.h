@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     BatchGetApplicationsRequest();
+    inline const char* GetServiceRequestName() const override { return "BatchGetApplications"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
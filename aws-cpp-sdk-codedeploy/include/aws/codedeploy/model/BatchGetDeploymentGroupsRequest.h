@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     BatchGetDeploymentGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "BatchGetDeploymentGroups"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
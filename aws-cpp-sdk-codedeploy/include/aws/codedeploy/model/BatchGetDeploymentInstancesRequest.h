@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     BatchGetDeploymentInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "BatchGetDeploymentInstances"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
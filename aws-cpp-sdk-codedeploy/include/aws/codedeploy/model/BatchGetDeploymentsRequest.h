@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     BatchGetDeploymentsRequest();
+    inline const char* GetServiceRequestName() const override { return "BatchGetDeployments"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
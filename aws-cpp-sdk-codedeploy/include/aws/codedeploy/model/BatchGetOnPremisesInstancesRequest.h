@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     BatchGetOnPremisesInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "BatchGetOnPremisesInstances"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
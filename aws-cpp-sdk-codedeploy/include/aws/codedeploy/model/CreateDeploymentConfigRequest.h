@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateDeploymentConfigRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDeploymentConfig"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
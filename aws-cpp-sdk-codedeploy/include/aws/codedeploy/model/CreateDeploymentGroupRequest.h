@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     CreateDeploymentGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDeploymentGroup"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDeploymentConfigRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDeploymentConfig"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDeploymentGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDeploymentGroup"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeregisterOnPremisesInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeregisterOnPremisesInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetApplicationRequest();
+    inline const char* GetServiceRequestName() const override { return "GetApplication"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetApplicationRevisionRequest();
+    inline const char* GetServiceRequestName() const override { return "GetApplicationRevision"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
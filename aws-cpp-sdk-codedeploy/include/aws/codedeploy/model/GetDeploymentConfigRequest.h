@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetDeploymentConfigRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDeploymentConfig"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetDeploymentGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDeploymentGroup"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetDeploymentInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDeploymentInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetDeploymentRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDeployment"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
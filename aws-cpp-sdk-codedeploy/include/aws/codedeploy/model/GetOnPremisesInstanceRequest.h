@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetOnPremisesInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "GetOnPremisesInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
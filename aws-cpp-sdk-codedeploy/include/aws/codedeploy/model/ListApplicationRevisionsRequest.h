@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     ListApplicationRevisionsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListApplicationRevisions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListDeploymentConfigsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListDeploymentConfigs"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListDeploymentGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListDeploymentGroups"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ListDeploymentInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListDeploymentInstances"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     ListDeploymentsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListDeployments"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
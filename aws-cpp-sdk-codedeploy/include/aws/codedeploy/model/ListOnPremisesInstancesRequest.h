@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     ListOnPremisesInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListOnPremisesInstances"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RegisterApplicationRevisionRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterApplicationRevision"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RegisterOnPremisesInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterOnPremisesInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
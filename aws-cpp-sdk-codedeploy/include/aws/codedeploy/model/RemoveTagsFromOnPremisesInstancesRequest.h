@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     RemoveTagsFromOnPremisesInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "RemoveTagsFromOnPremisesInstances"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
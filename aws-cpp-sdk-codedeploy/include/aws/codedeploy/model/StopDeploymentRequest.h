@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     StopDeploymentRequest();
+    inline const char* GetServiceRequestName() const override { return "StopDeployment"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
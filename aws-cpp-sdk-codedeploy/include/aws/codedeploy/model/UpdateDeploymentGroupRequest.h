@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     UpdateDeploymentGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateDeploymentGroup"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -144,7 +144,7 @@ AddTagsToOnPremisesInstancesOutcome CodeDeployClient::AddTagsToOnPremisesInstanc
 
 AddTagsToOnPremisesInstancesOutcomeCallable CodeDeployClient::AddTagsToOnPremisesInstancesCallable(const AddTagsToOnPremisesInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTagsToOnPremisesInstances(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTagsToOnPremisesInstances(request); } );
 }
 
 void CodeDeployClient::AddTagsToOnPremisesInstancesAsync(const AddTagsToOnPremisesInstancesRequest& request, const AddTagsToOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -152,6 +152,16 @@ void CodeDeployClient::AddTagsToOnPremisesInstancesAsync(const AddTagsToOnPremis
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsToOnPremisesInstancesAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsToOnPremisesInstancesOutcomeCallable CodeDeployClient::AddTagsToOnPremisesInstancesCallable(AddTagsToOnPremisesInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::AddTagsToOnPremisesInstances, this, std::move(request)));
+}
+
+void CodeDeployClient::AddTagsToOnPremisesInstancesAsync(AddTagsToOnPremisesInstancesRequest&& request, const AddTagsToOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::AddTagsToOnPremisesInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::AddTagsToOnPremisesInstancesAsyncHelper(const AddTagsToOnPremisesInstancesRequest& request, const AddTagsToOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTagsToOnPremisesInstances(request), context);
@@ -175,7 +185,7 @@ BatchGetApplicationRevisionsOutcome CodeDeployClient::BatchGetApplicationRevisio
 
 BatchGetApplicationRevisionsOutcomeCallable CodeDeployClient::BatchGetApplicationRevisionsCallable(const BatchGetApplicationRevisionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BatchGetApplicationRevisions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BatchGetApplicationRevisions(request); } );
 }
 
 void CodeDeployClient::BatchGetApplicationRevisionsAsync(const BatchGetApplicationRevisionsRequest& request, const BatchGetApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -183,6 +193,16 @@ void CodeDeployClient::BatchGetApplicationRevisionsAsync(const BatchGetApplicati
   m_executor->Submit( [this, request, handler, context](){ this->BatchGetApplicationRevisionsAsyncHelper( request, handler, context ); } );
 }
 
+BatchGetApplicationRevisionsOutcomeCallable CodeDeployClient::BatchGetApplicationRevisionsCallable(BatchGetApplicationRevisionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::BatchGetApplicationRevisions, this, std::move(request)));
+}
+
+void CodeDeployClient::BatchGetApplicationRevisionsAsync(BatchGetApplicationRevisionsRequest&& request, const BatchGetApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::BatchGetApplicationRevisionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::BatchGetApplicationRevisionsAsyncHelper(const BatchGetApplicationRevisionsRequest& request, const BatchGetApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BatchGetApplicationRevisions(request), context);
@@ -206,7 +226,7 @@ BatchGetApplicationsOutcome CodeDeployClient::BatchGetApplications(const BatchGe
 
 BatchGetApplicationsOutcomeCallable CodeDeployClient::BatchGetApplicationsCallable(const BatchGetApplicationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BatchGetApplications(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BatchGetApplications(request); } );
 }
 
 void CodeDeployClient::BatchGetApplicationsAsync(const BatchGetApplicationsRequest& request, const BatchGetApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -214,6 +234,16 @@ void CodeDeployClient::BatchGetApplicationsAsync(const BatchGetApplicationsReque
   m_executor->Submit( [this, request, handler, context](){ this->BatchGetApplicationsAsyncHelper( request, handler, context ); } );
 }
 
+BatchGetApplicationsOutcomeCallable CodeDeployClient::BatchGetApplicationsCallable(BatchGetApplicationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::BatchGetApplications, this, std::move(request)));
+}
+
+void CodeDeployClient::BatchGetApplicationsAsync(BatchGetApplicationsRequest&& request, const BatchGetApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::BatchGetApplicationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::BatchGetApplicationsAsyncHelper(const BatchGetApplicationsRequest& request, const BatchGetApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BatchGetApplications(request), context);
@@ -237,7 +267,7 @@ BatchGetDeploymentGroupsOutcome CodeDeployClient::BatchGetDeploymentGroups(const
 
 BatchGetDeploymentGroupsOutcomeCallable CodeDeployClient::BatchGetDeploymentGroupsCallable(const BatchGetDeploymentGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BatchGetDeploymentGroups(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BatchGetDeploymentGroups(request); } );
 }
 
 void CodeDeployClient::BatchGetDeploymentGroupsAsync(const BatchGetDeploymentGroupsRequest& request, const BatchGetDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -245,6 +275,16 @@ void CodeDeployClient::BatchGetDeploymentGroupsAsync(const BatchGetDeploymentGro
   m_executor->Submit( [this, request, handler, context](){ this->BatchGetDeploymentGroupsAsyncHelper( request, handler, context ); } );
 }
 
+BatchGetDeploymentGroupsOutcomeCallable CodeDeployClient::BatchGetDeploymentGroupsCallable(BatchGetDeploymentGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::BatchGetDeploymentGroups, this, std::move(request)));
+}
+
+void CodeDeployClient::BatchGetDeploymentGroupsAsync(BatchGetDeploymentGroupsRequest&& request, const BatchGetDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::BatchGetDeploymentGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::BatchGetDeploymentGroupsAsyncHelper(const BatchGetDeploymentGroupsRequest& request, const BatchGetDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BatchGetDeploymentGroups(request), context);
@@ -268,7 +308,7 @@ BatchGetDeploymentInstancesOutcome CodeDeployClient::BatchGetDeploymentInstances
 
 BatchGetDeploymentInstancesOutcomeCallable CodeDeployClient::BatchGetDeploymentInstancesCallable(const BatchGetDeploymentInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BatchGetDeploymentInstances(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BatchGetDeploymentInstances(request); } );
 }
 
 void CodeDeployClient::BatchGetDeploymentInstancesAsync(const BatchGetDeploymentInstancesRequest& request, const BatchGetDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -276,6 +316,16 @@ void CodeDeployClient::BatchGetDeploymentInstancesAsync(const BatchGetDeployment
   m_executor->Submit( [this, request, handler, context](){ this->BatchGetDeploymentInstancesAsyncHelper( request, handler, context ); } );
 }
 
+BatchGetDeploymentInstancesOutcomeCallable CodeDeployClient::BatchGetDeploymentInstancesCallable(BatchGetDeploymentInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::BatchGetDeploymentInstances, this, std::move(request)));
+}
+
+void CodeDeployClient::BatchGetDeploymentInstancesAsync(BatchGetDeploymentInstancesRequest&& request, const BatchGetDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::BatchGetDeploymentInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::BatchGetDeploymentInstancesAsyncHelper(const BatchGetDeploymentInstancesRequest& request, const BatchGetDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BatchGetDeploymentInstances(request), context);
@@ -299,7 +349,7 @@ BatchGetDeploymentsOutcome CodeDeployClient::BatchGetDeployments(const BatchGetD
 
 BatchGetDeploymentsOutcomeCallable CodeDeployClient::BatchGetDeploymentsCallable(const BatchGetDeploymentsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BatchGetDeployments(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BatchGetDeployments(request); } );
 }
 
 void CodeDeployClient::BatchGetDeploymentsAsync(const BatchGetDeploymentsRequest& request, const BatchGetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -307,6 +357,16 @@ void CodeDeployClient::BatchGetDeploymentsAsync(const BatchGetDeploymentsRequest
   m_executor->Submit( [this, request, handler, context](){ this->BatchGetDeploymentsAsyncHelper( request, handler, context ); } );
 }
 
+BatchGetDeploymentsOutcomeCallable CodeDeployClient::BatchGetDeploymentsCallable(BatchGetDeploymentsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::BatchGetDeployments, this, std::move(request)));
+}
+
+void CodeDeployClient::BatchGetDeploymentsAsync(BatchGetDeploymentsRequest&& request, const BatchGetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::BatchGetDeploymentsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::BatchGetDeploymentsAsyncHelper(const BatchGetDeploymentsRequest& request, const BatchGetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BatchGetDeployments(request), context);
@@ -330,7 +390,7 @@ BatchGetOnPremisesInstancesOutcome CodeDeployClient::BatchGetOnPremisesInstances
 
 BatchGetOnPremisesInstancesOutcomeCallable CodeDeployClient::BatchGetOnPremisesInstancesCallable(const BatchGetOnPremisesInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BatchGetOnPremisesInstances(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BatchGetOnPremisesInstances(request); } );
 }
 
 void CodeDeployClient::BatchGetOnPremisesInstancesAsync(const BatchGetOnPremisesInstancesRequest& request, const BatchGetOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -338,6 +398,16 @@ void CodeDeployClient::BatchGetOnPremisesInstancesAsync(const BatchGetOnPremises
   m_executor->Submit( [this, request, handler, context](){ this->BatchGetOnPremisesInstancesAsyncHelper( request, handler, context ); } );
 }
 
+BatchGetOnPremisesInstancesOutcomeCallable CodeDeployClient::BatchGetOnPremisesInstancesCallable(BatchGetOnPremisesInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::BatchGetOnPremisesInstances, this, std::move(request)));
+}
+
+void CodeDeployClient::BatchGetOnPremisesInstancesAsync(BatchGetOnPremisesInstancesRequest&& request, const BatchGetOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::BatchGetOnPremisesInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::BatchGetOnPremisesInstancesAsyncHelper(const BatchGetOnPremisesInstancesRequest& request, const BatchGetOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BatchGetOnPremisesInstances(request), context);
@@ -361,7 +431,7 @@ CreateApplicationOutcome CodeDeployClient::CreateApplication(const CreateApplica
 
 CreateApplicationOutcomeCallable CodeDeployClient::CreateApplicationCallable(const CreateApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateApplication(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateApplication(request); } );
 }
 
 void CodeDeployClient::CreateApplicationAsync(const CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -369,6 +439,16 @@ void CodeDeployClient::CreateApplicationAsync(const CreateApplicationRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->CreateApplicationAsyncHelper( request, handler, context ); } );
 }
 
+CreateApplicationOutcomeCallable CodeDeployClient::CreateApplicationCallable(CreateApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::CreateApplication, this, std::move(request)));
+}
+
+void CodeDeployClient::CreateApplicationAsync(CreateApplicationRequest&& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::CreateApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::CreateApplicationAsyncHelper(const CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateApplication(request), context);
@@ -392,7 +472,7 @@ CreateDeploymentOutcome CodeDeployClient::CreateDeployment(const CreateDeploymen
 
 CreateDeploymentOutcomeCallable CodeDeployClient::CreateDeploymentCallable(const CreateDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDeployment(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDeployment(request); } );
 }
 
 void CodeDeployClient::CreateDeploymentAsync(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -400,6 +480,16 @@ void CodeDeployClient::CreateDeploymentAsync(const CreateDeploymentRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->CreateDeploymentAsyncHelper( request, handler, context ); } );
 }
 
+CreateDeploymentOutcomeCallable CodeDeployClient::CreateDeploymentCallable(CreateDeploymentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::CreateDeployment, this, std::move(request)));
+}
+
+void CodeDeployClient::CreateDeploymentAsync(CreateDeploymentRequest&& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::CreateDeploymentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::CreateDeploymentAsyncHelper(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDeployment(request), context);
@@ -423,7 +513,7 @@ CreateDeploymentConfigOutcome CodeDeployClient::CreateDeploymentConfig(const Cre
 
 CreateDeploymentConfigOutcomeCallable CodeDeployClient::CreateDeploymentConfigCallable(const CreateDeploymentConfigRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDeploymentConfig(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDeploymentConfig(request); } );
 }
 
 void CodeDeployClient::CreateDeploymentConfigAsync(const CreateDeploymentConfigRequest& request, const CreateDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -431,6 +521,16 @@ void CodeDeployClient::CreateDeploymentConfigAsync(const CreateDeploymentConfigR
   m_executor->Submit( [this, request, handler, context](){ this->CreateDeploymentConfigAsyncHelper( request, handler, context ); } );
 }
 
+CreateDeploymentConfigOutcomeCallable CodeDeployClient::CreateDeploymentConfigCallable(CreateDeploymentConfigRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::CreateDeploymentConfig, this, std::move(request)));
+}
+
+void CodeDeployClient::CreateDeploymentConfigAsync(CreateDeploymentConfigRequest&& request, const CreateDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::CreateDeploymentConfigAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::CreateDeploymentConfigAsyncHelper(const CreateDeploymentConfigRequest& request, const CreateDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDeploymentConfig(request), context);
@@ -454,7 +554,7 @@ CreateDeploymentGroupOutcome CodeDeployClient::CreateDeploymentGroup(const Creat
 
 CreateDeploymentGroupOutcomeCallable CodeDeployClient::CreateDeploymentGroupCallable(const CreateDeploymentGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDeploymentGroup(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDeploymentGroup(request); } );
 }
 
 void CodeDeployClient::CreateDeploymentGroupAsync(const CreateDeploymentGroupRequest& request, const CreateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -462,6 +562,16 @@ void CodeDeployClient::CreateDeploymentGroupAsync(const CreateDeploymentGroupReq
   m_executor->Submit( [this, request, handler, context](){ this->CreateDeploymentGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateDeploymentGroupOutcomeCallable CodeDeployClient::CreateDeploymentGroupCallable(CreateDeploymentGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::CreateDeploymentGroup, this, std::move(request)));
+}
+
+void CodeDeployClient::CreateDeploymentGroupAsync(CreateDeploymentGroupRequest&& request, const CreateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::CreateDeploymentGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::CreateDeploymentGroupAsyncHelper(const CreateDeploymentGroupRequest& request, const CreateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDeploymentGroup(request), context);
@@ -485,7 +595,7 @@ DeleteApplicationOutcome CodeDeployClient::DeleteApplication(const DeleteApplica
 
 DeleteApplicationOutcomeCallable CodeDeployClient::DeleteApplicationCallable(const DeleteApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteApplication(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteApplication(request); } );
 }
 
 void CodeDeployClient::DeleteApplicationAsync(const DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -493,6 +603,16 @@ void CodeDeployClient::DeleteApplicationAsync(const DeleteApplicationRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->DeleteApplicationAsyncHelper( request, handler, context ); } );
 }
 
+DeleteApplicationOutcomeCallable CodeDeployClient::DeleteApplicationCallable(DeleteApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::DeleteApplication, this, std::move(request)));
+}
+
+void CodeDeployClient::DeleteApplicationAsync(DeleteApplicationRequest&& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::DeleteApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::DeleteApplicationAsyncHelper(const DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteApplication(request), context);
@@ -516,7 +636,7 @@ DeleteDeploymentConfigOutcome CodeDeployClient::DeleteDeploymentConfig(const Del
 
 DeleteDeploymentConfigOutcomeCallable CodeDeployClient::DeleteDeploymentConfigCallable(const DeleteDeploymentConfigRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDeploymentConfig(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDeploymentConfig(request); } );
 }
 
 void CodeDeployClient::DeleteDeploymentConfigAsync(const DeleteDeploymentConfigRequest& request, const DeleteDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -524,6 +644,16 @@ void CodeDeployClient::DeleteDeploymentConfigAsync(const DeleteDeploymentConfigR
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDeploymentConfigAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDeploymentConfigOutcomeCallable CodeDeployClient::DeleteDeploymentConfigCallable(DeleteDeploymentConfigRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::DeleteDeploymentConfig, this, std::move(request)));
+}
+
+void CodeDeployClient::DeleteDeploymentConfigAsync(DeleteDeploymentConfigRequest&& request, const DeleteDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::DeleteDeploymentConfigAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::DeleteDeploymentConfigAsyncHelper(const DeleteDeploymentConfigRequest& request, const DeleteDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDeploymentConfig(request), context);
@@ -547,7 +677,7 @@ DeleteDeploymentGroupOutcome CodeDeployClient::DeleteDeploymentGroup(const Delet
 
 DeleteDeploymentGroupOutcomeCallable CodeDeployClient::DeleteDeploymentGroupCallable(const DeleteDeploymentGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDeploymentGroup(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDeploymentGroup(request); } );
 }
 
 void CodeDeployClient::DeleteDeploymentGroupAsync(const DeleteDeploymentGroupRequest& request, const DeleteDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -555,6 +685,16 @@ void CodeDeployClient::DeleteDeploymentGroupAsync(const DeleteDeploymentGroupReq
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDeploymentGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDeploymentGroupOutcomeCallable CodeDeployClient::DeleteDeploymentGroupCallable(DeleteDeploymentGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::DeleteDeploymentGroup, this, std::move(request)));
+}
+
+void CodeDeployClient::DeleteDeploymentGroupAsync(DeleteDeploymentGroupRequest&& request, const DeleteDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::DeleteDeploymentGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::DeleteDeploymentGroupAsyncHelper(const DeleteDeploymentGroupRequest& request, const DeleteDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDeploymentGroup(request), context);
@@ -578,7 +718,7 @@ DeregisterOnPremisesInstanceOutcome CodeDeployClient::DeregisterOnPremisesInstan
 
 DeregisterOnPremisesInstanceOutcomeCallable CodeDeployClient::DeregisterOnPremisesInstanceCallable(const DeregisterOnPremisesInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeregisterOnPremisesInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeregisterOnPremisesInstance(request); } );
 }
 
 void CodeDeployClient::DeregisterOnPremisesInstanceAsync(const DeregisterOnPremisesInstanceRequest& request, const DeregisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -586,6 +726,16 @@ void CodeDeployClient::DeregisterOnPremisesInstanceAsync(const DeregisterOnPremi
   m_executor->Submit( [this, request, handler, context](){ this->DeregisterOnPremisesInstanceAsyncHelper( request, handler, context ); } );
 }
 
+DeregisterOnPremisesInstanceOutcomeCallable CodeDeployClient::DeregisterOnPremisesInstanceCallable(DeregisterOnPremisesInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::DeregisterOnPremisesInstance, this, std::move(request)));
+}
+
+void CodeDeployClient::DeregisterOnPremisesInstanceAsync(DeregisterOnPremisesInstanceRequest&& request, const DeregisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::DeregisterOnPremisesInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::DeregisterOnPremisesInstanceAsyncHelper(const DeregisterOnPremisesInstanceRequest& request, const DeregisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeregisterOnPremisesInstance(request), context);
@@ -609,7 +759,7 @@ GetApplicationOutcome CodeDeployClient::GetApplication(const GetApplicationReque
 
 GetApplicationOutcomeCallable CodeDeployClient::GetApplicationCallable(const GetApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetApplication(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetApplication(request); } );
 }
 
 void CodeDeployClient::GetApplicationAsync(const GetApplicationRequest& request, const GetApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -617,6 +767,16 @@ void CodeDeployClient::GetApplicationAsync(const GetApplicationRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->GetApplicationAsyncHelper( request, handler, context ); } );
 }
 
+GetApplicationOutcomeCallable CodeDeployClient::GetApplicationCallable(GetApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::GetApplication, this, std::move(request)));
+}
+
+void CodeDeployClient::GetApplicationAsync(GetApplicationRequest&& request, const GetApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::GetApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::GetApplicationAsyncHelper(const GetApplicationRequest& request, const GetApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetApplication(request), context);
@@ -640,7 +800,7 @@ GetApplicationRevisionOutcome CodeDeployClient::GetApplicationRevision(const Get
 
 GetApplicationRevisionOutcomeCallable CodeDeployClient::GetApplicationRevisionCallable(const GetApplicationRevisionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetApplicationRevision(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetApplicationRevision(request); } );
 }
 
 void CodeDeployClient::GetApplicationRevisionAsync(const GetApplicationRevisionRequest& request, const GetApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -648,6 +808,16 @@ void CodeDeployClient::GetApplicationRevisionAsync(const GetApplicationRevisionR
   m_executor->Submit( [this, request, handler, context](){ this->GetApplicationRevisionAsyncHelper( request, handler, context ); } );
 }
 
+GetApplicationRevisionOutcomeCallable CodeDeployClient::GetApplicationRevisionCallable(GetApplicationRevisionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::GetApplicationRevision, this, std::move(request)));
+}
+
+void CodeDeployClient::GetApplicationRevisionAsync(GetApplicationRevisionRequest&& request, const GetApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::GetApplicationRevisionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::GetApplicationRevisionAsyncHelper(const GetApplicationRevisionRequest& request, const GetApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetApplicationRevision(request), context);
@@ -671,7 +841,7 @@ GetDeploymentOutcome CodeDeployClient::GetDeployment(const GetDeploymentRequest&
 
 GetDeploymentOutcomeCallable CodeDeployClient::GetDeploymentCallable(const GetDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDeployment(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDeployment(request); } );
 }
 
 void CodeDeployClient::GetDeploymentAsync(const GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -679,6 +849,16 @@ void CodeDeployClient::GetDeploymentAsync(const GetDeploymentRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->GetDeploymentAsyncHelper( request, handler, context ); } );
 }
 
+GetDeploymentOutcomeCallable CodeDeployClient::GetDeploymentCallable(GetDeploymentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::GetDeployment, this, std::move(request)));
+}
+
+void CodeDeployClient::GetDeploymentAsync(GetDeploymentRequest&& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::GetDeploymentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::GetDeploymentAsyncHelper(const GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDeployment(request), context);
@@ -702,7 +882,7 @@ GetDeploymentConfigOutcome CodeDeployClient::GetDeploymentConfig(const GetDeploy
 
 GetDeploymentConfigOutcomeCallable CodeDeployClient::GetDeploymentConfigCallable(const GetDeploymentConfigRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDeploymentConfig(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDeploymentConfig(request); } );
 }
 
 void CodeDeployClient::GetDeploymentConfigAsync(const GetDeploymentConfigRequest& request, const GetDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -710,6 +890,16 @@ void CodeDeployClient::GetDeploymentConfigAsync(const GetDeploymentConfigRequest
   m_executor->Submit( [this, request, handler, context](){ this->GetDeploymentConfigAsyncHelper( request, handler, context ); } );
 }
 
+GetDeploymentConfigOutcomeCallable CodeDeployClient::GetDeploymentConfigCallable(GetDeploymentConfigRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::GetDeploymentConfig, this, std::move(request)));
+}
+
+void CodeDeployClient::GetDeploymentConfigAsync(GetDeploymentConfigRequest&& request, const GetDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::GetDeploymentConfigAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::GetDeploymentConfigAsyncHelper(const GetDeploymentConfigRequest& request, const GetDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDeploymentConfig(request), context);
@@ -733,7 +923,7 @@ GetDeploymentGroupOutcome CodeDeployClient::GetDeploymentGroup(const GetDeployme
 
 GetDeploymentGroupOutcomeCallable CodeDeployClient::GetDeploymentGroupCallable(const GetDeploymentGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDeploymentGroup(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDeploymentGroup(request); } );
 }
 
 void CodeDeployClient::GetDeploymentGroupAsync(const GetDeploymentGroupRequest& request, const GetDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -741,6 +931,16 @@ void CodeDeployClient::GetDeploymentGroupAsync(const GetDeploymentGroupRequest&
   m_executor->Submit( [this, request, handler, context](){ this->GetDeploymentGroupAsyncHelper( request, handler, context ); } );
 }
 
+GetDeploymentGroupOutcomeCallable CodeDeployClient::GetDeploymentGroupCallable(GetDeploymentGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::GetDeploymentGroup, this, std::move(request)));
+}
+
+void CodeDeployClient::GetDeploymentGroupAsync(GetDeploymentGroupRequest&& request, const GetDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::GetDeploymentGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::GetDeploymentGroupAsyncHelper(const GetDeploymentGroupRequest& request, const GetDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDeploymentGroup(request), context);
@@ -764,7 +964,7 @@ GetDeploymentInstanceOutcome CodeDeployClient::GetDeploymentInstance(const GetDe
 
 GetDeploymentInstanceOutcomeCallable CodeDeployClient::GetDeploymentInstanceCallable(const GetDeploymentInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDeploymentInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDeploymentInstance(request); } );
 }
 
 void CodeDeployClient::GetDeploymentInstanceAsync(const GetDeploymentInstanceRequest& request, const GetDeploymentInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -772,6 +972,16 @@ void CodeDeployClient::GetDeploymentInstanceAsync(const GetDeploymentInstanceReq
   m_executor->Submit( [this, request, handler, context](){ this->GetDeploymentInstanceAsyncHelper( request, handler, context ); } );
 }
 
+GetDeploymentInstanceOutcomeCallable CodeDeployClient::GetDeploymentInstanceCallable(GetDeploymentInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::GetDeploymentInstance, this, std::move(request)));
+}
+
+void CodeDeployClient::GetDeploymentInstanceAsync(GetDeploymentInstanceRequest&& request, const GetDeploymentInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::GetDeploymentInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::GetDeploymentInstanceAsyncHelper(const GetDeploymentInstanceRequest& request, const GetDeploymentInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDeploymentInstance(request), context);
@@ -795,7 +1005,7 @@ GetOnPremisesInstanceOutcome CodeDeployClient::GetOnPremisesInstance(const GetOn
 
 GetOnPremisesInstanceOutcomeCallable CodeDeployClient::GetOnPremisesInstanceCallable(const GetOnPremisesInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetOnPremisesInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetOnPremisesInstance(request); } );
 }
 
 void CodeDeployClient::GetOnPremisesInstanceAsync(const GetOnPremisesInstanceRequest& request, const GetOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -803,6 +1013,16 @@ void CodeDeployClient::GetOnPremisesInstanceAsync(const GetOnPremisesInstanceReq
   m_executor->Submit( [this, request, handler, context](){ this->GetOnPremisesInstanceAsyncHelper( request, handler, context ); } );
 }
 
+GetOnPremisesInstanceOutcomeCallable CodeDeployClient::GetOnPremisesInstanceCallable(GetOnPremisesInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::GetOnPremisesInstance, this, std::move(request)));
+}
+
+void CodeDeployClient::GetOnPremisesInstanceAsync(GetOnPremisesInstanceRequest&& request, const GetOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::GetOnPremisesInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::GetOnPremisesInstanceAsyncHelper(const GetOnPremisesInstanceRequest& request, const GetOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetOnPremisesInstance(request), context);
@@ -826,7 +1046,7 @@ ListApplicationRevisionsOutcome CodeDeployClient::ListApplicationRevisions(const
 
 ListApplicationRevisionsOutcomeCallable CodeDeployClient::ListApplicationRevisionsCallable(const ListApplicationRevisionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListApplicationRevisions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListApplicationRevisions(request); } );
 }
 
 void CodeDeployClient::ListApplicationRevisionsAsync(const ListApplicationRevisionsRequest& request, const ListApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -834,6 +1054,16 @@ void CodeDeployClient::ListApplicationRevisionsAsync(const ListApplicationRevisi
   m_executor->Submit( [this, request, handler, context](){ this->ListApplicationRevisionsAsyncHelper( request, handler, context ); } );
 }
 
+ListApplicationRevisionsOutcomeCallable CodeDeployClient::ListApplicationRevisionsCallable(ListApplicationRevisionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::ListApplicationRevisions, this, std::move(request)));
+}
+
+void CodeDeployClient::ListApplicationRevisionsAsync(ListApplicationRevisionsRequest&& request, const ListApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::ListApplicationRevisionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::ListApplicationRevisionsAsyncHelper(const ListApplicationRevisionsRequest& request, const ListApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListApplicationRevisions(request), context);
@@ -857,7 +1087,7 @@ ListApplicationsOutcome CodeDeployClient::ListApplications(const ListApplication
 
 ListApplicationsOutcomeCallable CodeDeployClient::ListApplicationsCallable(const ListApplicationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListApplications(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListApplications(request); } );
 }
 
 void CodeDeployClient::ListApplicationsAsync(const ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -865,6 +1095,16 @@ void CodeDeployClient::ListApplicationsAsync(const ListApplicationsRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->ListApplicationsAsyncHelper( request, handler, context ); } );
 }
 
+ListApplicationsOutcomeCallable CodeDeployClient::ListApplicationsCallable(ListApplicationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::ListApplications, this, std::move(request)));
+}
+
+void CodeDeployClient::ListApplicationsAsync(ListApplicationsRequest&& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::ListApplicationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::ListApplicationsAsyncHelper(const ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListApplications(request), context);
@@ -888,7 +1128,7 @@ ListDeploymentConfigsOutcome CodeDeployClient::ListDeploymentConfigs(const ListD
 
 ListDeploymentConfigsOutcomeCallable CodeDeployClient::ListDeploymentConfigsCallable(const ListDeploymentConfigsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDeploymentConfigs(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDeploymentConfigs(request); } );
 }
 
 void CodeDeployClient::ListDeploymentConfigsAsync(const ListDeploymentConfigsRequest& request, const ListDeploymentConfigsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -896,6 +1136,16 @@ void CodeDeployClient::ListDeploymentConfigsAsync(const ListDeploymentConfigsReq
   m_executor->Submit( [this, request, handler, context](){ this->ListDeploymentConfigsAsyncHelper( request, handler, context ); } );
 }
 
+ListDeploymentConfigsOutcomeCallable CodeDeployClient::ListDeploymentConfigsCallable(ListDeploymentConfigsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::ListDeploymentConfigs, this, std::move(request)));
+}
+
+void CodeDeployClient::ListDeploymentConfigsAsync(ListDeploymentConfigsRequest&& request, const ListDeploymentConfigsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::ListDeploymentConfigsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::ListDeploymentConfigsAsyncHelper(const ListDeploymentConfigsRequest& request, const ListDeploymentConfigsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDeploymentConfigs(request), context);
@@ -919,7 +1169,7 @@ ListDeploymentGroupsOutcome CodeDeployClient::ListDeploymentGroups(const ListDep
 
 ListDeploymentGroupsOutcomeCallable CodeDeployClient::ListDeploymentGroupsCallable(const ListDeploymentGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDeploymentGroups(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDeploymentGroups(request); } );
 }
 
 void CodeDeployClient::ListDeploymentGroupsAsync(const ListDeploymentGroupsRequest& request, const ListDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -927,6 +1177,16 @@ void CodeDeployClient::ListDeploymentGroupsAsync(const ListDeploymentGroupsReque
   m_executor->Submit( [this, request, handler, context](){ this->ListDeploymentGroupsAsyncHelper( request, handler, context ); } );
 }
 
+ListDeploymentGroupsOutcomeCallable CodeDeployClient::ListDeploymentGroupsCallable(ListDeploymentGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::ListDeploymentGroups, this, std::move(request)));
+}
+
+void CodeDeployClient::ListDeploymentGroupsAsync(ListDeploymentGroupsRequest&& request, const ListDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::ListDeploymentGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::ListDeploymentGroupsAsyncHelper(const ListDeploymentGroupsRequest& request, const ListDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDeploymentGroups(request), context);
@@ -950,7 +1210,7 @@ ListDeploymentInstancesOutcome CodeDeployClient::ListDeploymentInstances(const L
 
 ListDeploymentInstancesOutcomeCallable CodeDeployClient::ListDeploymentInstancesCallable(const ListDeploymentInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDeploymentInstances(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDeploymentInstances(request); } );
 }
 
 void CodeDeployClient::ListDeploymentInstancesAsync(const ListDeploymentInstancesRequest& request, const ListDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -958,6 +1218,16 @@ void CodeDeployClient::ListDeploymentInstancesAsync(const ListDeploymentInstance
   m_executor->Submit( [this, request, handler, context](){ this->ListDeploymentInstancesAsyncHelper( request, handler, context ); } );
 }
 
+ListDeploymentInstancesOutcomeCallable CodeDeployClient::ListDeploymentInstancesCallable(ListDeploymentInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::ListDeploymentInstances, this, std::move(request)));
+}
+
+void CodeDeployClient::ListDeploymentInstancesAsync(ListDeploymentInstancesRequest&& request, const ListDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::ListDeploymentInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::ListDeploymentInstancesAsyncHelper(const ListDeploymentInstancesRequest& request, const ListDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDeploymentInstances(request), context);
@@ -981,7 +1251,7 @@ ListDeploymentsOutcome CodeDeployClient::ListDeployments(const ListDeploymentsRe
 
 ListDeploymentsOutcomeCallable CodeDeployClient::ListDeploymentsCallable(const ListDeploymentsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDeployments(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDeployments(request); } );
 }
 
 void CodeDeployClient::ListDeploymentsAsync(const ListDeploymentsRequest& request, const ListDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -989,6 +1259,16 @@ void CodeDeployClient::ListDeploymentsAsync(const ListDeploymentsRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->ListDeploymentsAsyncHelper( request, handler, context ); } );
 }
 
+ListDeploymentsOutcomeCallable CodeDeployClient::ListDeploymentsCallable(ListDeploymentsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::ListDeployments, this, std::move(request)));
+}
+
+void CodeDeployClient::ListDeploymentsAsync(ListDeploymentsRequest&& request, const ListDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::ListDeploymentsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::ListDeploymentsAsyncHelper(const ListDeploymentsRequest& request, const ListDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDeployments(request), context);
@@ -1012,7 +1292,7 @@ ListOnPremisesInstancesOutcome CodeDeployClient::ListOnPremisesInstances(const L
 
 ListOnPremisesInstancesOutcomeCallable CodeDeployClient::ListOnPremisesInstancesCallable(const ListOnPremisesInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListOnPremisesInstances(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListOnPremisesInstances(request); } );
 }
 
 void CodeDeployClient::ListOnPremisesInstancesAsync(const ListOnPremisesInstancesRequest& request, const ListOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1020,6 +1300,16 @@ void CodeDeployClient::ListOnPremisesInstancesAsync(const ListOnPremisesInstance
   m_executor->Submit( [this, request, handler, context](){ this->ListOnPremisesInstancesAsyncHelper( request, handler, context ); } );
 }
 
+ListOnPremisesInstancesOutcomeCallable CodeDeployClient::ListOnPremisesInstancesCallable(ListOnPremisesInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::ListOnPremisesInstances, this, std::move(request)));
+}
+
+void CodeDeployClient::ListOnPremisesInstancesAsync(ListOnPremisesInstancesRequest&& request, const ListOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::ListOnPremisesInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::ListOnPremisesInstancesAsyncHelper(const ListOnPremisesInstancesRequest& request, const ListOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListOnPremisesInstances(request), context);
@@ -1043,7 +1333,7 @@ RegisterApplicationRevisionOutcome CodeDeployClient::RegisterApplicationRevision
 
 RegisterApplicationRevisionOutcomeCallable CodeDeployClient::RegisterApplicationRevisionCallable(const RegisterApplicationRevisionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterApplicationRevision(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterApplicationRevision(request); } );
 }
 
 void CodeDeployClient::RegisterApplicationRevisionAsync(const RegisterApplicationRevisionRequest& request, const RegisterApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1051,6 +1341,16 @@ void CodeDeployClient::RegisterApplicationRevisionAsync(const RegisterApplicatio
   m_executor->Submit( [this, request, handler, context](){ this->RegisterApplicationRevisionAsyncHelper( request, handler, context ); } );
 }
 
+RegisterApplicationRevisionOutcomeCallable CodeDeployClient::RegisterApplicationRevisionCallable(RegisterApplicationRevisionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::RegisterApplicationRevision, this, std::move(request)));
+}
+
+void CodeDeployClient::RegisterApplicationRevisionAsync(RegisterApplicationRevisionRequest&& request, const RegisterApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::RegisterApplicationRevisionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::RegisterApplicationRevisionAsyncHelper(const RegisterApplicationRevisionRequest& request, const RegisterApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterApplicationRevision(request), context);
@@ -1074,7 +1374,7 @@ RegisterOnPremisesInstanceOutcome CodeDeployClient::RegisterOnPremisesInstance(c
 
 RegisterOnPremisesInstanceOutcomeCallable CodeDeployClient::RegisterOnPremisesInstanceCallable(const RegisterOnPremisesInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterOnPremisesInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterOnPremisesInstance(request); } );
 }
 
 void CodeDeployClient::RegisterOnPremisesInstanceAsync(const RegisterOnPremisesInstanceRequest& request, const RegisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1082,6 +1382,16 @@ void CodeDeployClient::RegisterOnPremisesInstanceAsync(const RegisterOnPremisesI
   m_executor->Submit( [this, request, handler, context](){ this->RegisterOnPremisesInstanceAsyncHelper( request, handler, context ); } );
 }
 
+RegisterOnPremisesInstanceOutcomeCallable CodeDeployClient::RegisterOnPremisesInstanceCallable(RegisterOnPremisesInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::RegisterOnPremisesInstance, this, std::move(request)));
+}
+
+void CodeDeployClient::RegisterOnPremisesInstanceAsync(RegisterOnPremisesInstanceRequest&& request, const RegisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::RegisterOnPremisesInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::RegisterOnPremisesInstanceAsyncHelper(const RegisterOnPremisesInstanceRequest& request, const RegisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterOnPremisesInstance(request), context);
@@ -1105,7 +1415,7 @@ RemoveTagsFromOnPremisesInstancesOutcome CodeDeployClient::RemoveTagsFromOnPremi
 
 RemoveTagsFromOnPremisesInstancesOutcomeCallable CodeDeployClient::RemoveTagsFromOnPremisesInstancesCallable(const RemoveTagsFromOnPremisesInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTagsFromOnPremisesInstances(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTagsFromOnPremisesInstances(request); } );
 }
 
 void CodeDeployClient::RemoveTagsFromOnPremisesInstancesAsync(const RemoveTagsFromOnPremisesInstancesRequest& request, const RemoveTagsFromOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1113,6 +1423,16 @@ void CodeDeployClient::RemoveTagsFromOnPremisesInstancesAsync(const RemoveTagsFr
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsFromOnPremisesInstancesAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsFromOnPremisesInstancesOutcomeCallable CodeDeployClient::RemoveTagsFromOnPremisesInstancesCallable(RemoveTagsFromOnPremisesInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::RemoveTagsFromOnPremisesInstances, this, std::move(request)));
+}
+
+void CodeDeployClient::RemoveTagsFromOnPremisesInstancesAsync(RemoveTagsFromOnPremisesInstancesRequest&& request, const RemoveTagsFromOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::RemoveTagsFromOnPremisesInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::RemoveTagsFromOnPremisesInstancesAsyncHelper(const RemoveTagsFromOnPremisesInstancesRequest& request, const RemoveTagsFromOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTagsFromOnPremisesInstances(request), context);
@@ -1136,7 +1456,7 @@ StopDeploymentOutcome CodeDeployClient::StopDeployment(const StopDeploymentReque
 
 StopDeploymentOutcomeCallable CodeDeployClient::StopDeploymentCallable(const StopDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StopDeployment(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StopDeployment(request); } );
 }
 
 void CodeDeployClient::StopDeploymentAsync(const StopDeploymentRequest& request, const StopDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1144,6 +1464,16 @@ void CodeDeployClient::StopDeploymentAsync(const StopDeploymentRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->StopDeploymentAsyncHelper( request, handler, context ); } );
 }
 
+StopDeploymentOutcomeCallable CodeDeployClient::StopDeploymentCallable(StopDeploymentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::StopDeployment, this, std::move(request)));
+}
+
+void CodeDeployClient::StopDeploymentAsync(StopDeploymentRequest&& request, const StopDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::StopDeploymentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::StopDeploymentAsyncHelper(const StopDeploymentRequest& request, const StopDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StopDeployment(request), context);
@@ -1167,7 +1497,7 @@ UpdateApplicationOutcome CodeDeployClient::UpdateApplication(const UpdateApplica
 
 UpdateApplicationOutcomeCallable CodeDeployClient::UpdateApplicationCallable(const UpdateApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateApplication(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateApplication(request); } );
 }
 
 void CodeDeployClient::UpdateApplicationAsync(const UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1175,6 +1505,16 @@ void CodeDeployClient::UpdateApplicationAsync(const UpdateApplicationRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->UpdateApplicationAsyncHelper( request, handler, context ); } );
 }
 
+UpdateApplicationOutcomeCallable CodeDeployClient::UpdateApplicationCallable(UpdateApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::UpdateApplication, this, std::move(request)));
+}
+
+void CodeDeployClient::UpdateApplicationAsync(UpdateApplicationRequest&& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::UpdateApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::UpdateApplicationAsyncHelper(const UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateApplication(request), context);
@@ -1198,7 +1538,7 @@ UpdateDeploymentGroupOutcome CodeDeployClient::UpdateDeploymentGroup(const Updat
 
 UpdateDeploymentGroupOutcomeCallable CodeDeployClient::UpdateDeploymentGroupCallable(const UpdateDeploymentGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateDeploymentGroup(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateDeploymentGroup(request); } );
 }
 
 void CodeDeployClient::UpdateDeploymentGroupAsync(const UpdateDeploymentGroupRequest& request, const UpdateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1206,8 +1546,314 @@ void CodeDeployClient::UpdateDeploymentGroupAsync(const UpdateDeploymentGroupReq
   m_executor->Submit( [this, request, handler, context](){ this->UpdateDeploymentGroupAsyncHelper( request, handler, context ); } );
 }
 
+UpdateDeploymentGroupOutcomeCallable CodeDeployClient::UpdateDeploymentGroupCallable(UpdateDeploymentGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodeDeployClient::UpdateDeploymentGroup, this, std::move(request)));
+}
+
+void CodeDeployClient::UpdateDeploymentGroupAsync(UpdateDeploymentGroupRequest&& request, const UpdateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodeDeployClient::UpdateDeploymentGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodeDeployClient::UpdateDeploymentGroupAsyncHelper(const UpdateDeploymentGroupRequest& request, const UpdateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateDeploymentGroup(request), context);
 }
 
+Paginator<CodeDeployClient, ListApplicationRevisionsRequest, ListApplicationRevisionsOutcome> CodeDeployClient::ListApplicationRevisionsPaginator(const ListApplicationRevisionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CodeDeployClient, ListApplicationRevisionsRequest, ListApplicationRevisionsOutcome>(this, &CodeDeployClient::ListApplicationRevisions, request,
+    [](const ListApplicationRevisionsRequest& current, const ListApplicationRevisionsOutcome& outcome, ListApplicationRevisionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CodeDeployClient, ListApplicationsRequest, ListApplicationsOutcome> CodeDeployClient::ListApplicationsPaginator(const ListApplicationsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CodeDeployClient, ListApplicationsRequest, ListApplicationsOutcome>(this, &CodeDeployClient::ListApplications, request,
+    [](const ListApplicationsRequest& current, const ListApplicationsOutcome& outcome, ListApplicationsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CodeDeployClient, ListDeploymentConfigsRequest, ListDeploymentConfigsOutcome> CodeDeployClient::ListDeploymentConfigsPaginator(const ListDeploymentConfigsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CodeDeployClient, ListDeploymentConfigsRequest, ListDeploymentConfigsOutcome>(this, &CodeDeployClient::ListDeploymentConfigs, request,
+    [](const ListDeploymentConfigsRequest& current, const ListDeploymentConfigsOutcome& outcome, ListDeploymentConfigsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CodeDeployClient, ListDeploymentGroupsRequest, ListDeploymentGroupsOutcome> CodeDeployClient::ListDeploymentGroupsPaginator(const ListDeploymentGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CodeDeployClient, ListDeploymentGroupsRequest, ListDeploymentGroupsOutcome>(this, &CodeDeployClient::ListDeploymentGroups, request,
+    [](const ListDeploymentGroupsRequest& current, const ListDeploymentGroupsOutcome& outcome, ListDeploymentGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CodeDeployClient, ListDeploymentInstancesRequest, ListDeploymentInstancesOutcome> CodeDeployClient::ListDeploymentInstancesPaginator(const ListDeploymentInstancesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CodeDeployClient, ListDeploymentInstancesRequest, ListDeploymentInstancesOutcome>(this, &CodeDeployClient::ListDeploymentInstances, request,
+    [](const ListDeploymentInstancesRequest& current, const ListDeploymentInstancesOutcome& outcome, ListDeploymentInstancesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CodeDeployClient, ListDeploymentsRequest, ListDeploymentsOutcome> CodeDeployClient::ListDeploymentsPaginator(const ListDeploymentsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CodeDeployClient, ListDeploymentsRequest, ListDeploymentsOutcome>(this, &CodeDeployClient::ListDeployments, request,
+    [](const ListDeploymentsRequest& current, const ListDeploymentsOutcome& outcome, ListDeploymentsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CodeDeployClient, ListOnPremisesInstancesRequest, ListOnPremisesInstancesOutcome> CodeDeployClient::ListOnPremisesInstancesPaginator(const ListOnPremisesInstancesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CodeDeployClient, ListOnPremisesInstancesRequest, ListOnPremisesInstancesOutcome>(this, &CodeDeployClient::ListOnPremisesInstances, request,
+    [](const ListOnPremisesInstancesRequest& current, const ListOnPremisesInstancesOutcome& outcome, ListOnPremisesInstancesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<CodeDeployClient, AddTagsToOnPremisesInstancesRequest, AddTagsToOnPremisesInstancesOutcome> CodeDeployClient::AddTagsToOnPremisesInstancesAwaitable(AddTagsToOnPremisesInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::AddTagsToOnPremisesInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, BatchGetApplicationRevisionsRequest, BatchGetApplicationRevisionsOutcome> CodeDeployClient::BatchGetApplicationRevisionsAwaitable(BatchGetApplicationRevisionsRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::BatchGetApplicationRevisions, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, BatchGetApplicationsRequest, BatchGetApplicationsOutcome> CodeDeployClient::BatchGetApplicationsAwaitable(BatchGetApplicationsRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::BatchGetApplications, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, BatchGetDeploymentGroupsRequest, BatchGetDeploymentGroupsOutcome> CodeDeployClient::BatchGetDeploymentGroupsAwaitable(BatchGetDeploymentGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::BatchGetDeploymentGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, BatchGetDeploymentInstancesRequest, BatchGetDeploymentInstancesOutcome> CodeDeployClient::BatchGetDeploymentInstancesAwaitable(BatchGetDeploymentInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::BatchGetDeploymentInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, BatchGetDeploymentsRequest, BatchGetDeploymentsOutcome> CodeDeployClient::BatchGetDeploymentsAwaitable(BatchGetDeploymentsRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::BatchGetDeployments, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, BatchGetOnPremisesInstancesRequest, BatchGetOnPremisesInstancesOutcome> CodeDeployClient::BatchGetOnPremisesInstancesAwaitable(BatchGetOnPremisesInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::BatchGetOnPremisesInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, CreateApplicationRequest, CreateApplicationOutcome> CodeDeployClient::CreateApplicationAwaitable(CreateApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::CreateApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, CreateDeploymentRequest, CreateDeploymentOutcome> CodeDeployClient::CreateDeploymentAwaitable(CreateDeploymentRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::CreateDeployment, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, CreateDeploymentConfigRequest, CreateDeploymentConfigOutcome> CodeDeployClient::CreateDeploymentConfigAwaitable(CreateDeploymentConfigRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::CreateDeploymentConfig, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, CreateDeploymentGroupRequest, CreateDeploymentGroupOutcome> CodeDeployClient::CreateDeploymentGroupAwaitable(CreateDeploymentGroupRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::CreateDeploymentGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, DeleteApplicationRequest, DeleteApplicationOutcome> CodeDeployClient::DeleteApplicationAwaitable(DeleteApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::DeleteApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, DeleteDeploymentConfigRequest, DeleteDeploymentConfigOutcome> CodeDeployClient::DeleteDeploymentConfigAwaitable(DeleteDeploymentConfigRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::DeleteDeploymentConfig, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, DeleteDeploymentGroupRequest, DeleteDeploymentGroupOutcome> CodeDeployClient::DeleteDeploymentGroupAwaitable(DeleteDeploymentGroupRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::DeleteDeploymentGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, DeregisterOnPremisesInstanceRequest, DeregisterOnPremisesInstanceOutcome> CodeDeployClient::DeregisterOnPremisesInstanceAwaitable(DeregisterOnPremisesInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::DeregisterOnPremisesInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, GetApplicationRequest, GetApplicationOutcome> CodeDeployClient::GetApplicationAwaitable(GetApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::GetApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, GetApplicationRevisionRequest, GetApplicationRevisionOutcome> CodeDeployClient::GetApplicationRevisionAwaitable(GetApplicationRevisionRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::GetApplicationRevision, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, GetDeploymentRequest, GetDeploymentOutcome> CodeDeployClient::GetDeploymentAwaitable(GetDeploymentRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::GetDeployment, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, GetDeploymentConfigRequest, GetDeploymentConfigOutcome> CodeDeployClient::GetDeploymentConfigAwaitable(GetDeploymentConfigRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::GetDeploymentConfig, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, GetDeploymentGroupRequest, GetDeploymentGroupOutcome> CodeDeployClient::GetDeploymentGroupAwaitable(GetDeploymentGroupRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::GetDeploymentGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, GetDeploymentInstanceRequest, GetDeploymentInstanceOutcome> CodeDeployClient::GetDeploymentInstanceAwaitable(GetDeploymentInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::GetDeploymentInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, GetOnPremisesInstanceRequest, GetOnPremisesInstanceOutcome> CodeDeployClient::GetOnPremisesInstanceAwaitable(GetOnPremisesInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::GetOnPremisesInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, ListApplicationRevisionsRequest, ListApplicationRevisionsOutcome> CodeDeployClient::ListApplicationRevisionsAwaitable(ListApplicationRevisionsRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::ListApplicationRevisions, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, ListApplicationsRequest, ListApplicationsOutcome> CodeDeployClient::ListApplicationsAwaitable(ListApplicationsRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::ListApplications, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, ListDeploymentConfigsRequest, ListDeploymentConfigsOutcome> CodeDeployClient::ListDeploymentConfigsAwaitable(ListDeploymentConfigsRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::ListDeploymentConfigs, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, ListDeploymentGroupsRequest, ListDeploymentGroupsOutcome> CodeDeployClient::ListDeploymentGroupsAwaitable(ListDeploymentGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::ListDeploymentGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, ListDeploymentInstancesRequest, ListDeploymentInstancesOutcome> CodeDeployClient::ListDeploymentInstancesAwaitable(ListDeploymentInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::ListDeploymentInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, ListDeploymentsRequest, ListDeploymentsOutcome> CodeDeployClient::ListDeploymentsAwaitable(ListDeploymentsRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::ListDeployments, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, ListOnPremisesInstancesRequest, ListOnPremisesInstancesOutcome> CodeDeployClient::ListOnPremisesInstancesAwaitable(ListOnPremisesInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::ListOnPremisesInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, RegisterApplicationRevisionRequest, RegisterApplicationRevisionOutcome> CodeDeployClient::RegisterApplicationRevisionAwaitable(RegisterApplicationRevisionRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::RegisterApplicationRevision, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, RegisterOnPremisesInstanceRequest, RegisterOnPremisesInstanceOutcome> CodeDeployClient::RegisterOnPremisesInstanceAwaitable(RegisterOnPremisesInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::RegisterOnPremisesInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, RemoveTagsFromOnPremisesInstancesRequest, RemoveTagsFromOnPremisesInstancesOutcome> CodeDeployClient::RemoveTagsFromOnPremisesInstancesAwaitable(RemoveTagsFromOnPremisesInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::RemoveTagsFromOnPremisesInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, StopDeploymentRequest, StopDeploymentOutcome> CodeDeployClient::StopDeploymentAwaitable(StopDeploymentRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::StopDeployment, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, UpdateApplicationRequest, UpdateApplicationOutcome> CodeDeployClient::UpdateApplicationAwaitable(UpdateApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::UpdateApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodeDeployClient, UpdateDeploymentGroupRequest, UpdateDeploymentGroupOutcome> CodeDeployClient::UpdateDeploymentGroupAwaitable(UpdateDeploymentGroupRequest request) const
+{
+  return { m_executor.get(), { this, &CodeDeployClient::UpdateDeploymentGroup, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
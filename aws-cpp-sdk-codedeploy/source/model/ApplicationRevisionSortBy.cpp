@@ -29,26 +29,32 @@ namespace Aws
       namespace ApplicationRevisionSortByMapper
       {
 
-        static const int registerTime_HASH = HashingUtils::HashString("registerTime");
-        static const int firstUsedTime_HASH = HashingUtils::HashString("firstUsedTime");
-        static const int lastUsedTime_HASH = HashingUtils::HashString("lastUsedTime");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int registerTime_HASH = -1707742192;
+        static const int firstUsedTime_HASH = 1562120954;
+        static const int lastUsedTime_HASH = -1999860512;
 
 
         ApplicationRevisionSortBy GetApplicationRevisionSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == registerTime_HASH)
+          switch (hashCode)
           {
+          case registerTime_HASH:
             return ApplicationRevisionSortBy::registerTime;
-          }
-          else if (hashCode == firstUsedTime_HASH)
-          {
+          case firstUsedTime_HASH:
             return ApplicationRevisionSortBy::firstUsedTime;
-          }
-          else if (hashCode == lastUsedTime_HASH)
-          {
+          case lastUsedTime_HASH:
             return ApplicationRevisionSortBy::lastUsedTime;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
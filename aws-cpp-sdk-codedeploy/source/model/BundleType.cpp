@@ -29,26 +29,32 @@ namespace Aws
       namespace BundleTypeMapper
       {
 
-        static const int tar_HASH = HashingUtils::HashString("tar");
-        static const int tgz_HASH = HashingUtils::HashString("tgz");
-        static const int zip_HASH = HashingUtils::HashString("zip");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int tar_HASH = 114597;
+        static const int tgz_HASH = 114791;
+        static const int zip_HASH = 120609;
 
 
         BundleType GetBundleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == tar_HASH)
+          switch (hashCode)
           {
+          case tar_HASH:
             return BundleType::tar;
-          }
-          else if (hashCode == tgz_HASH)
-          {
+          case tgz_HASH:
             return BundleType::tgz;
-          }
-          else if (hashCode == zip_HASH)
-          {
+          case zip_HASH:
             return BundleType::zip;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
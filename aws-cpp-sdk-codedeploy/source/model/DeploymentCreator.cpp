@@ -29,21 +29,29 @@ namespace Aws
       namespace DeploymentCreatorMapper
       {
 
-        static const int user_HASH = HashingUtils::HashString("user");
-        static const int autoscaling_HASH = HashingUtils::HashString("autoscaling");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int user_HASH = 3599307;
+        static const int autoscaling_HASH = -1144837384;
 
 
         DeploymentCreator GetDeploymentCreatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == user_HASH)
+          switch (hashCode)
           {
+          case user_HASH:
             return DeploymentCreator::user;
-          }
-          else if (hashCode == autoscaling_HASH)
-          {
+          case autoscaling_HASH:
             return DeploymentCreator::autoscaling;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
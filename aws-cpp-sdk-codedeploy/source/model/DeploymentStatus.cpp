@@ -29,41 +29,41 @@ namespace Aws
       namespace DeploymentStatusMapper
       {
 
-        static const int Created_HASH = HashingUtils::HashString("Created");
-        static const int Queued_HASH = HashingUtils::HashString("Queued");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Stopped_HASH = HashingUtils::HashString("Stopped");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Created_HASH = -1601759544;
+        static const int Queued_HASH = -1864829549;
+        static const int InProgress_HASH = 646453906;
+        static const int Succeeded_HASH = -1345265087;
+        static const int Failed_HASH = 2096857181;
+        static const int Stopped_HASH = -219666003;
 
 
         DeploymentStatus GetDeploymentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Created_HASH)
+          switch (hashCode)
           {
+          case Created_HASH:
             return DeploymentStatus::Created;
-          }
-          else if (hashCode == Queued_HASH)
-          {
+          case Queued_HASH:
             return DeploymentStatus::Queued;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
+          case InProgress_HASH:
             return DeploymentStatus::InProgress;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
+          case Succeeded_HASH:
             return DeploymentStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return DeploymentStatus::Failed;
-          }
-          else if (hashCode == Stopped_HASH)
-          {
+          case Stopped_HASH:
             return DeploymentStatus::Stopped;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace EC2TagFilterTypeMapper
       {
 
-        static const int KEY_ONLY_HASH = HashingUtils::HashString("KEY_ONLY");
-        static const int VALUE_ONLY_HASH = HashingUtils::HashString("VALUE_ONLY");
-        static const int KEY_AND_VALUE_HASH = HashingUtils::HashString("KEY_AND_VALUE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int KEY_ONLY_HASH = 1313160620;
+        static const int VALUE_ONLY_HASH = -1737137702;
+        static const int KEY_AND_VALUE_HASH = 1579298505;
 
 
         EC2TagFilterType GetEC2TagFilterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == KEY_ONLY_HASH)
+          switch (hashCode)
           {
+          case KEY_ONLY_HASH:
             return EC2TagFilterType::KEY_ONLY;
-          }
-          else if (hashCode == VALUE_ONLY_HASH)
-          {
+          case VALUE_ONLY_HASH:
             return EC2TagFilterType::VALUE_ONLY;
-          }
-          else if (hashCode == KEY_AND_VALUE_HASH)
-          {
+          case KEY_AND_VALUE_HASH:
             return EC2TagFilterType::KEY_AND_VALUE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
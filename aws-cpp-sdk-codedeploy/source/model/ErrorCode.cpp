@@ -29,76 +29,62 @@ namespace Aws
       namespace ErrorCodeMapper
       {
 
-        static const int DEPLOYMENT_GROUP_MISSING_HASH = HashingUtils::HashString("DEPLOYMENT_GROUP_MISSING");
-        static const int APPLICATION_MISSING_HASH = HashingUtils::HashString("APPLICATION_MISSING");
-        static const int REVISION_MISSING_HASH = HashingUtils::HashString("REVISION_MISSING");
-        static const int IAM_ROLE_MISSING_HASH = HashingUtils::HashString("IAM_ROLE_MISSING");
-        static const int IAM_ROLE_PERMISSIONS_HASH = HashingUtils::HashString("IAM_ROLE_PERMISSIONS");
-        static const int NO_EC2_SUBSCRIPTION_HASH = HashingUtils::HashString("NO_EC2_SUBSCRIPTION");
-        static const int OVER_MAX_INSTANCES_HASH = HashingUtils::HashString("OVER_MAX_INSTANCES");
-        static const int NO_INSTANCES_HASH = HashingUtils::HashString("NO_INSTANCES");
-        static const int TIMEOUT_HASH = HashingUtils::HashString("TIMEOUT");
-        static const int HEALTH_CONSTRAINTS_INVALID_HASH = HashingUtils::HashString("HEALTH_CONSTRAINTS_INVALID");
-        static const int HEALTH_CONSTRAINTS_HASH = HashingUtils::HashString("HEALTH_CONSTRAINTS");
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-        static const int THROTTLED_HASH = HashingUtils::HashString("THROTTLED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int DEPLOYMENT_GROUP_MISSING_HASH = -1874813076;
+        static const int APPLICATION_MISSING_HASH = -1606607561;
+        static const int REVISION_MISSING_HASH = -685223710;
+        static const int IAM_ROLE_MISSING_HASH = 1920377927;
+        static const int IAM_ROLE_PERMISSIONS_HASH = 1170061029;
+        static const int NO_EC2_SUBSCRIPTION_HASH = -786720026;
+        static const int OVER_MAX_INSTANCES_HASH = 1462923512;
+        static const int NO_INSTANCES_HASH = -1714907808;
+        static const int TIMEOUT_HASH = -595928767;
+        static const int HEALTH_CONSTRAINTS_INVALID_HASH = 1509533259;
+        static const int HEALTH_CONSTRAINTS_HASH = 655942835;
+        static const int INTERNAL_ERROR_HASH = -485608986;
+        static const int THROTTLED_HASH = 1528687194;
 
 
         ErrorCode GetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEPLOYMENT_GROUP_MISSING_HASH)
+          switch (hashCode)
           {
+          case DEPLOYMENT_GROUP_MISSING_HASH:
             return ErrorCode::DEPLOYMENT_GROUP_MISSING;
-          }
-          else if (hashCode == APPLICATION_MISSING_HASH)
-          {
+          case APPLICATION_MISSING_HASH:
             return ErrorCode::APPLICATION_MISSING;
-          }
-          else if (hashCode == REVISION_MISSING_HASH)
-          {
+          case REVISION_MISSING_HASH:
             return ErrorCode::REVISION_MISSING;
-          }
-          else if (hashCode == IAM_ROLE_MISSING_HASH)
-          {
+          case IAM_ROLE_MISSING_HASH:
             return ErrorCode::IAM_ROLE_MISSING;
-          }
-          else if (hashCode == IAM_ROLE_PERMISSIONS_HASH)
-          {
+          case IAM_ROLE_PERMISSIONS_HASH:
             return ErrorCode::IAM_ROLE_PERMISSIONS;
-          }
-          else if (hashCode == NO_EC2_SUBSCRIPTION_HASH)
-          {
+          case NO_EC2_SUBSCRIPTION_HASH:
             return ErrorCode::NO_EC2_SUBSCRIPTION;
-          }
-          else if (hashCode == OVER_MAX_INSTANCES_HASH)
-          {
+          case OVER_MAX_INSTANCES_HASH:
             return ErrorCode::OVER_MAX_INSTANCES;
-          }
-          else if (hashCode == NO_INSTANCES_HASH)
-          {
+          case NO_INSTANCES_HASH:
             return ErrorCode::NO_INSTANCES;
-          }
-          else if (hashCode == TIMEOUT_HASH)
-          {
+          case TIMEOUT_HASH:
             return ErrorCode::TIMEOUT;
-          }
-          else if (hashCode == HEALTH_CONSTRAINTS_INVALID_HASH)
-          {
+          case HEALTH_CONSTRAINTS_INVALID_HASH:
             return ErrorCode::HEALTH_CONSTRAINTS_INVALID;
-          }
-          else if (hashCode == HEALTH_CONSTRAINTS_HASH)
-          {
+          case HEALTH_CONSTRAINTS_HASH:
             return ErrorCode::HEALTH_CONSTRAINTS;
-          }
-          else if (hashCode == INTERNAL_ERROR_HASH)
-          {
+          case INTERNAL_ERROR_HASH:
             return ErrorCode::INTERNAL_ERROR;
-          }
-          else if (hashCode == THROTTLED_HASH)
-          {
+          case THROTTLED_HASH:
             return ErrorCode::THROTTLED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
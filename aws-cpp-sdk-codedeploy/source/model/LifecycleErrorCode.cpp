@@ -29,41 +29,41 @@ namespace Aws
       namespace LifecycleErrorCodeMapper
       {
 
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int ScriptMissing_HASH = HashingUtils::HashString("ScriptMissing");
-        static const int ScriptNotExecutable_HASH = HashingUtils::HashString("ScriptNotExecutable");
-        static const int ScriptTimedOut_HASH = HashingUtils::HashString("ScriptTimedOut");
-        static const int ScriptFailed_HASH = HashingUtils::HashString("ScriptFailed");
-        static const int UnknownError_HASH = HashingUtils::HashString("UnknownError");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Success_HASH = -202516509;
+        static const int ScriptMissing_HASH = 1628769787;
+        static const int ScriptNotExecutable_HASH = -601298862;
+        static const int ScriptTimedOut_HASH = -1917856094;
+        static const int ScriptFailed_HASH = -1818124024;
+        static const int UnknownError_HASH = -1179015170;
 
 
         LifecycleErrorCode GetLifecycleErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Success_HASH)
+          switch (hashCode)
           {
+          case Success_HASH:
             return LifecycleErrorCode::Success;
-          }
-          else if (hashCode == ScriptMissing_HASH)
-          {
+          case ScriptMissing_HASH:
             return LifecycleErrorCode::ScriptMissing;
-          }
-          else if (hashCode == ScriptNotExecutable_HASH)
-          {
+          case ScriptNotExecutable_HASH:
             return LifecycleErrorCode::ScriptNotExecutable;
-          }
-          else if (hashCode == ScriptTimedOut_HASH)
-          {
+          case ScriptTimedOut_HASH:
             return LifecycleErrorCode::ScriptTimedOut;
-          }
-          else if (hashCode == ScriptFailed_HASH)
-          {
+          case ScriptFailed_HASH:
             return LifecycleErrorCode::ScriptFailed;
-          }
-          else if (hashCode == UnknownError_HASH)
-          {
+          case UnknownError_HASH:
             return LifecycleErrorCode::UnknownError;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
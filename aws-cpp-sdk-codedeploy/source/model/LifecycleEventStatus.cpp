@@ -29,41 +29,41 @@ namespace Aws
       namespace LifecycleEventStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Skipped_HASH = HashingUtils::HashString("Skipped");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Pending_HASH = 982065527;
+        static const int InProgress_HASH = 646453906;
+        static const int Succeeded_HASH = -1345265087;
+        static const int Failed_HASH = 2096857181;
+        static const int Skipped_HASH = -482869488;
+        static const int Unknown_HASH = 1379812394;
 
 
         LifecycleEventStatus GetLifecycleEventStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          switch (hashCode)
           {
+          case Pending_HASH:
             return LifecycleEventStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
+          case InProgress_HASH:
             return LifecycleEventStatus::InProgress;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
+          case Succeeded_HASH:
             return LifecycleEventStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return LifecycleEventStatus::Failed;
-          }
-          else if (hashCode == Skipped_HASH)
-          {
+          case Skipped_HASH:
             return LifecycleEventStatus::Skipped;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
+          case Unknown_HASH:
             return LifecycleEventStatus::Unknown;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace ListStateFilterActionMapper
       {
 
-        static const int include_HASH = HashingUtils::HashString("include");
-        static const int exclude_HASH = HashingUtils::HashString("exclude");
-        static const int ignore_HASH = HashingUtils::HashString("ignore");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int include_HASH = 1942574248;
+        static const int exclude_HASH = -1321148966;
+        static const int ignore_HASH = -1190396462;
 
 
         ListStateFilterAction GetListStateFilterActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == include_HASH)
+          switch (hashCode)
           {
+          case include_HASH:
             return ListStateFilterAction::include;
-          }
-          else if (hashCode == exclude_HASH)
-          {
+          case exclude_HASH:
             return ListStateFilterAction::exclude;
-          }
-          else if (hashCode == ignore_HASH)
-          {
+          case ignore_HASH:
             return ListStateFilterAction::ignore;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
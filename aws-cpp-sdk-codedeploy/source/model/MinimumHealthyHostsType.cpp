@@ -29,21 +29,29 @@ namespace Aws
       namespace MinimumHealthyHostsTypeMapper
       {
 
-        static const int HOST_COUNT_HASH = HashingUtils::HashString("HOST_COUNT");
-        static const int FLEET_PERCENT_HASH = HashingUtils::HashString("FLEET_PERCENT");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int HOST_COUNT_HASH = 625265560;
+        static const int FLEET_PERCENT_HASH = -1353150956;
 
 
         MinimumHealthyHostsType GetMinimumHealthyHostsTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HOST_COUNT_HASH)
+          switch (hashCode)
           {
+          case HOST_COUNT_HASH:
             return MinimumHealthyHostsType::HOST_COUNT;
-          }
-          else if (hashCode == FLEET_PERCENT_HASH)
-          {
+          case FLEET_PERCENT_HASH:
             return MinimumHealthyHostsType::FLEET_PERCENT;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace RegistrationStatusMapper
       {
 
-        static const int Registered_HASH = HashingUtils::HashString("Registered");
-        static const int Deregistered_HASH = HashingUtils::HashString("Deregistered");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Registered_HASH = 123533986;
+        static const int Deregistered_HASH = 1509265891;
 
 
         RegistrationStatus GetRegistrationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Registered_HASH)
+          switch (hashCode)
           {
+          case Registered_HASH:
             return RegistrationStatus::Registered;
-          }
-          else if (hashCode == Deregistered_HASH)
-          {
+          case Deregistered_HASH:
             return RegistrationStatus::Deregistered;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
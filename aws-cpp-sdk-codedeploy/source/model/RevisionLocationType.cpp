@@ -29,21 +29,29 @@ namespace Aws
       namespace RevisionLocationTypeMapper
       {
 
-        static const int S3_HASH = HashingUtils::HashString("S3");
-        static const int GitHub_HASH = HashingUtils::HashString("GitHub");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int S3_HASH = 2624;
+        static const int GitHub_HASH = 2133168099;
 
 
         RevisionLocationType GetRevisionLocationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == S3_HASH)
+          switch (hashCode)
           {
+          case S3_HASH:
             return RevisionLocationType::S3;
-          }
-          else if (hashCode == GitHub_HASH)
-          {
+          case GitHub_HASH:
             return RevisionLocationType::GitHub;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace StopStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Pending_HASH = 982065527;
+        static const int Succeeded_HASH = -1345265087;
 
 
         StopStatus GetStopStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          switch (hashCode)
           {
+          case Pending_HASH:
             return StopStatus::Pending;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
+          case Succeeded_HASH:
             return StopStatus::Succeeded;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
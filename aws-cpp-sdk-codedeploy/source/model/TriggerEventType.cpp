@@ -29,46 +29,44 @@ namespace Aws
       namespace TriggerEventTypeMapper
       {
 
-        static const int DeploymentStart_HASH = HashingUtils::HashString("DeploymentStart");
-        static const int DeploymentSuccess_HASH = HashingUtils::HashString("DeploymentSuccess");
-        static const int DeploymentFailure_HASH = HashingUtils::HashString("DeploymentFailure");
-        static const int DeploymentStop_HASH = HashingUtils::HashString("DeploymentStop");
-        static const int InstanceStart_HASH = HashingUtils::HashString("InstanceStart");
-        static const int InstanceSuccess_HASH = HashingUtils::HashString("InstanceSuccess");
-        static const int InstanceFailure_HASH = HashingUtils::HashString("InstanceFailure");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int DeploymentStart_HASH = 999212157;
+        static const int DeploymentSuccess_HASH = -1799772834;
+        static const int DeploymentFailure_HASH = -1019177243;
+        static const int DeploymentStop_HASH = 586422407;
+        static const int InstanceStart_HASH = -594606931;
+        static const int InstanceSuccess_HASH = -156591730;
+        static const int InstanceFailure_HASH = 624003861;
 
 
         TriggerEventType GetTriggerEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DeploymentStart_HASH)
+          switch (hashCode)
           {
+          case DeploymentStart_HASH:
             return TriggerEventType::DeploymentStart;
-          }
-          else if (hashCode == DeploymentSuccess_HASH)
-          {
+          case DeploymentSuccess_HASH:
             return TriggerEventType::DeploymentSuccess;
-          }
-          else if (hashCode == DeploymentFailure_HASH)
-          {
+          case DeploymentFailure_HASH:
             return TriggerEventType::DeploymentFailure;
-          }
-          else if (hashCode == DeploymentStop_HASH)
-          {
+          case DeploymentStop_HASH:
             return TriggerEventType::DeploymentStop;
-          }
-          else if (hashCode == InstanceStart_HASH)
-          {
+          case InstanceStart_HASH:
             return TriggerEventType::InstanceStart;
-          }
-          else if (hashCode == InstanceSuccess_HASH)
-          {
+          case InstanceSuccess_HASH:
             return TriggerEventType::InstanceSuccess;
-          }
-          else if (hashCode == InstanceFailure_HASH)
-          {
+          case InstanceFailure_HASH:
             return TriggerEventType::InstanceFailure;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -39,6 +39,9 @@
 #include <aws/codepipeline/model/UpdatePipelineResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -309,6 +312,18 @@ namespace Model
          */
         virtual void AcknowledgeJobAsync(const Model::AcknowledgeJobRequest& request, const AcknowledgeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AcknowledgeJobCallable(const Model::AcknowledgeJobRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AcknowledgeJobOutcomeCallable AcknowledgeJobCallable(Model::AcknowledgeJobRequest&& request) const;
+
+        /**
+         * Same as AcknowledgeJobAsync(const Model::AcknowledgeJobRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AcknowledgeJobAsync(Model::AcknowledgeJobRequest&& request, const AcknowledgeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Confirms a job worker has received the specified job. Only used for partner
          * actions.</p>
@@ -331,6 +346,18 @@ namespace Model
          */
         virtual void AcknowledgeThirdPartyJobAsync(const Model::AcknowledgeThirdPartyJobRequest& request, const AcknowledgeThirdPartyJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AcknowledgeThirdPartyJobCallable(const Model::AcknowledgeThirdPartyJobRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AcknowledgeThirdPartyJobOutcomeCallable AcknowledgeThirdPartyJobCallable(Model::AcknowledgeThirdPartyJobRequest&& request) const;
+
+        /**
+         * Same as AcknowledgeThirdPartyJobAsync(const Model::AcknowledgeThirdPartyJobRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AcknowledgeThirdPartyJobAsync(Model::AcknowledgeThirdPartyJobRequest&& request, const AcknowledgeThirdPartyJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new custom action that can be used in all pipelines associated with
          * the AWS account. Only used for custom actions.</p>
@@ -353,6 +380,18 @@ namespace Model
          */
         virtual void CreateCustomActionTypeAsync(const Model::CreateCustomActionTypeRequest& request, const CreateCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCustomActionTypeCallable(const Model::CreateCustomActionTypeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateCustomActionTypeOutcomeCallable CreateCustomActionTypeCallable(Model::CreateCustomActionTypeRequest&& request) const;
+
+        /**
+         * Same as CreateCustomActionTypeAsync(const Model::CreateCustomActionTypeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateCustomActionTypeAsync(Model::CreateCustomActionTypeRequest&& request, const CreateCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a pipeline.</p>
          */
@@ -372,6 +411,18 @@ namespace Model
          */
         virtual void CreatePipelineAsync(const Model::CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePipelineCallable(const Model::CreatePipelineRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreatePipelineOutcomeCallable CreatePipelineCallable(Model::CreatePipelineRequest&& request) const;
+
+        /**
+         * Same as CreatePipelineAsync(const Model::CreatePipelineRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreatePipelineAsync(Model::CreatePipelineRequest&& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Marks a custom action as deleted. PollForJobs for the custom action will fail
          * after the action is marked for deletion. Only used for custom actions.</p>
@@ -400,6 +451,18 @@ namespace Model
          */
         virtual void DeleteCustomActionTypeAsync(const Model::DeleteCustomActionTypeRequest& request, const DeleteCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCustomActionTypeCallable(const Model::DeleteCustomActionTypeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteCustomActionTypeOutcomeCallable DeleteCustomActionTypeCallable(Model::DeleteCustomActionTypeRequest&& request) const;
+
+        /**
+         * Same as DeleteCustomActionTypeAsync(const Model::DeleteCustomActionTypeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteCustomActionTypeAsync(Model::DeleteCustomActionTypeRequest&& request, const DeleteCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified pipeline.</p>
          */
@@ -419,6 +482,18 @@ namespace Model
          */
         virtual void DeletePipelineAsync(const Model::DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePipelineCallable(const Model::DeletePipelineRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeletePipelineOutcomeCallable DeletePipelineCallable(Model::DeletePipelineRequest&& request) const;
+
+        /**
+         * Same as DeletePipelineAsync(const Model::DeletePipelineRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeletePipelineAsync(Model::DeletePipelineRequest&& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Prevents artifacts in a pipeline from transitioning to the next stage in the
          * pipeline.</p>
@@ -441,6 +516,18 @@ namespace Model
          */
         virtual void DisableStageTransitionAsync(const Model::DisableStageTransitionRequest& request, const DisableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableStageTransitionCallable(const Model::DisableStageTransitionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableStageTransitionOutcomeCallable DisableStageTransitionCallable(Model::DisableStageTransitionRequest&& request) const;
+
+        /**
+         * Same as DisableStageTransitionAsync(const Model::DisableStageTransitionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableStageTransitionAsync(Model::DisableStageTransitionRequest&& request, const DisableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables artifacts in a pipeline to transition to a stage in a pipeline.</p>
          */
@@ -460,6 +547,18 @@ namespace Model
          */
         virtual void EnableStageTransitionAsync(const Model::EnableStageTransitionRequest& request, const EnableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableStageTransitionCallable(const Model::EnableStageTransitionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableStageTransitionOutcomeCallable EnableStageTransitionCallable(Model::EnableStageTransitionRequest&& request) const;
+
+        /**
+         * Same as EnableStageTransitionAsync(const Model::EnableStageTransitionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableStageTransitionAsync(Model::EnableStageTransitionRequest&& request, const EnableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about a job. Only used for custom actions.</p>
          * <important> <p>When this API is called, AWS CodePipeline returns temporary
@@ -494,6 +593,18 @@ namespace Model
          */
         virtual void GetJobDetailsAsync(const Model::GetJobDetailsRequest& request, const GetJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetJobDetailsCallable(const Model::GetJobDetailsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetJobDetailsOutcomeCallable GetJobDetailsCallable(Model::GetJobDetailsRequest&& request) const;
+
+        /**
+         * Same as GetJobDetailsAsync(const Model::GetJobDetailsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetJobDetailsAsync(Model::GetJobDetailsRequest&& request, const GetJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the metadata, structure, stages, and actions of a pipeline. Can be
          * used to return the entire structure of a pipeline in JSON format, which can then
@@ -522,6 +633,18 @@ namespace Model
          */
         virtual void GetPipelineAsync(const Model::GetPipelineRequest& request, const GetPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPipelineCallable(const Model::GetPipelineRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetPipelineOutcomeCallable GetPipelineCallable(Model::GetPipelineRequest&& request) const;
+
+        /**
+         * Same as GetPipelineAsync(const Model::GetPipelineRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetPipelineAsync(Model::GetPipelineRequest&& request, const GetPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the state of a pipeline, including the stages and
          * actions.</p>
@@ -544,6 +667,18 @@ namespace Model
          */
         virtual void GetPipelineStateAsync(const Model::GetPipelineStateRequest& request, const GetPipelineStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPipelineStateCallable(const Model::GetPipelineStateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetPipelineStateOutcomeCallable GetPipelineStateCallable(Model::GetPipelineStateRequest&& request) const;
+
+        /**
+         * Same as GetPipelineStateAsync(const Model::GetPipelineStateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetPipelineStateAsync(Model::GetPipelineStateRequest&& request, const GetPipelineStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests the details of a job for a third party action. Only used for partner
          * actions.</p> <important> <p>When this API is called, AWS CodePipeline returns
@@ -578,6 +713,18 @@ namespace Model
          */
         virtual void GetThirdPartyJobDetailsAsync(const Model::GetThirdPartyJobDetailsRequest& request, const GetThirdPartyJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetThirdPartyJobDetailsCallable(const Model::GetThirdPartyJobDetailsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetThirdPartyJobDetailsOutcomeCallable GetThirdPartyJobDetailsCallable(Model::GetThirdPartyJobDetailsRequest&& request) const;
+
+        /**
+         * Same as GetThirdPartyJobDetailsAsync(const Model::GetThirdPartyJobDetailsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetThirdPartyJobDetailsAsync(Model::GetThirdPartyJobDetailsRequest&& request, const GetThirdPartyJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a summary of all AWS CodePipeline action types associated with your
          * account.</p>
@@ -600,6 +747,18 @@ namespace Model
          */
         virtual void ListActionTypesAsync(const Model::ListActionTypesRequest& request, const ListActionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListActionTypesCallable(const Model::ListActionTypesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListActionTypesOutcomeCallable ListActionTypesCallable(Model::ListActionTypesRequest&& request) const;
+
+        /**
+         * Same as ListActionTypesAsync(const Model::ListActionTypesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListActionTypesAsync(Model::ListActionTypesRequest&& request, const ListActionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a summary of all of the pipelines associated with your account.</p>
          */
@@ -619,6 +778,18 @@ namespace Model
          */
         virtual void ListPipelinesAsync(const Model::ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPipelinesCallable(const Model::ListPipelinesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListPipelinesOutcomeCallable ListPipelinesCallable(Model::ListPipelinesRequest&& request) const;
+
+        /**
+         * Same as ListPipelinesAsync(const Model::ListPipelinesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPipelinesAsync(Model::ListPipelinesRequest&& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about any jobs for AWS CodePipeline to act upon.</p>
          * <important> <p>When this API is called, AWS CodePipeline returns temporary
@@ -653,6 +824,18 @@ namespace Model
          */
         virtual void PollForJobsAsync(const Model::PollForJobsRequest& request, const PollForJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PollForJobsCallable(const Model::PollForJobsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PollForJobsOutcomeCallable PollForJobsCallable(Model::PollForJobsRequest&& request) const;
+
+        /**
+         * Same as PollForJobsAsync(const Model::PollForJobsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PollForJobsAsync(Model::PollForJobsRequest&& request, const PollForJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Determines whether there are any third party jobs for a job worker to act on.
          * Only used for partner actions.</p> <important> <p>When this API is called, AWS
@@ -684,6 +867,18 @@ namespace Model
          */
         virtual void PollForThirdPartyJobsAsync(const Model::PollForThirdPartyJobsRequest& request, const PollForThirdPartyJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PollForThirdPartyJobsCallable(const Model::PollForThirdPartyJobsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PollForThirdPartyJobsOutcomeCallable PollForThirdPartyJobsCallable(Model::PollForThirdPartyJobsRequest&& request) const;
+
+        /**
+         * Same as PollForThirdPartyJobsAsync(const Model::PollForThirdPartyJobsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PollForThirdPartyJobsAsync(Model::PollForThirdPartyJobsRequest&& request, const PollForThirdPartyJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides information to AWS CodePipeline about new revisions to a source.</p>
          */
@@ -703,6 +898,18 @@ namespace Model
          */
         virtual void PutActionRevisionAsync(const Model::PutActionRevisionRequest& request, const PutActionRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutActionRevisionCallable(const Model::PutActionRevisionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutActionRevisionOutcomeCallable PutActionRevisionCallable(Model::PutActionRevisionRequest&& request) const;
+
+        /**
+         * Same as PutActionRevisionAsync(const Model::PutActionRevisionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutActionRevisionAsync(Model::PutActionRevisionRequest&& request, const PutActionRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides the response to a manual approval request to AWS CodePipeline. Valid
          * responses include Approved and Rejected.</p>
@@ -725,6 +932,18 @@ namespace Model
          */
         virtual void PutApprovalResultAsync(const Model::PutApprovalResultRequest& request, const PutApprovalResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutApprovalResultCallable(const Model::PutApprovalResultRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutApprovalResultOutcomeCallable PutApprovalResultCallable(Model::PutApprovalResultRequest&& request) const;
+
+        /**
+         * Same as PutApprovalResultAsync(const Model::PutApprovalResultRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutApprovalResultAsync(Model::PutApprovalResultRequest&& request, const PutApprovalResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents the failure of a job as returned to the pipeline by a job worker.
          * Only used for custom actions.</p>
@@ -747,6 +966,18 @@ namespace Model
          */
         virtual void PutJobFailureResultAsync(const Model::PutJobFailureResultRequest& request, const PutJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutJobFailureResultCallable(const Model::PutJobFailureResultRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutJobFailureResultOutcomeCallable PutJobFailureResultCallable(Model::PutJobFailureResultRequest&& request) const;
+
+        /**
+         * Same as PutJobFailureResultAsync(const Model::PutJobFailureResultRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutJobFailureResultAsync(Model::PutJobFailureResultRequest&& request, const PutJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents the success of a job as returned to the pipeline by a job worker.
          * Only used for custom actions.</p>
@@ -769,6 +1000,18 @@ namespace Model
          */
         virtual void PutJobSuccessResultAsync(const Model::PutJobSuccessResultRequest& request, const PutJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutJobSuccessResultCallable(const Model::PutJobSuccessResultRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutJobSuccessResultOutcomeCallable PutJobSuccessResultCallable(Model::PutJobSuccessResultRequest&& request) const;
+
+        /**
+         * Same as PutJobSuccessResultAsync(const Model::PutJobSuccessResultRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutJobSuccessResultAsync(Model::PutJobSuccessResultRequest&& request, const PutJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents the failure of a third party job as returned to the pipeline by a
          * job worker. Only used for partner actions.</p>
@@ -791,6 +1034,18 @@ namespace Model
          */
         virtual void PutThirdPartyJobFailureResultAsync(const Model::PutThirdPartyJobFailureResultRequest& request, const PutThirdPartyJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutThirdPartyJobFailureResultCallable(const Model::PutThirdPartyJobFailureResultRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutThirdPartyJobFailureResultOutcomeCallable PutThirdPartyJobFailureResultCallable(Model::PutThirdPartyJobFailureResultRequest&& request) const;
+
+        /**
+         * Same as PutThirdPartyJobFailureResultAsync(const Model::PutThirdPartyJobFailureResultRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutThirdPartyJobFailureResultAsync(Model::PutThirdPartyJobFailureResultRequest&& request, const PutThirdPartyJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents the success of a third party job as returned to the pipeline by a
          * job worker. Only used for partner actions.</p>
@@ -813,6 +1068,18 @@ namespace Model
          */
         virtual void PutThirdPartyJobSuccessResultAsync(const Model::PutThirdPartyJobSuccessResultRequest& request, const PutThirdPartyJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutThirdPartyJobSuccessResultCallable(const Model::PutThirdPartyJobSuccessResultRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutThirdPartyJobSuccessResultOutcomeCallable PutThirdPartyJobSuccessResultCallable(Model::PutThirdPartyJobSuccessResultRequest&& request) const;
+
+        /**
+         * Same as PutThirdPartyJobSuccessResultAsync(const Model::PutThirdPartyJobSuccessResultRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutThirdPartyJobSuccessResultAsync(Model::PutThirdPartyJobSuccessResultRequest&& request, const PutThirdPartyJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Resumes the pipeline execution by retrying the last failed actions in a
          * stage.</p>
@@ -835,6 +1102,18 @@ namespace Model
          */
         virtual void RetryStageExecutionAsync(const Model::RetryStageExecutionRequest& request, const RetryStageExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RetryStageExecutionCallable(const Model::RetryStageExecutionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RetryStageExecutionOutcomeCallable RetryStageExecutionCallable(Model::RetryStageExecutionRequest&& request) const;
+
+        /**
+         * Same as RetryStageExecutionAsync(const Model::RetryStageExecutionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RetryStageExecutionAsync(Model::RetryStageExecutionRequest&& request, const RetryStageExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts the specified pipeline. Specifically, it begins processing the latest
          * commit to the source location specified as part of the pipeline.</p>
@@ -857,6 +1136,18 @@ namespace Model
          */
         virtual void StartPipelineExecutionAsync(const Model::StartPipelineExecutionRequest& request, const StartPipelineExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartPipelineExecutionCallable(const Model::StartPipelineExecutionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StartPipelineExecutionOutcomeCallable StartPipelineExecutionCallable(Model::StartPipelineExecutionRequest&& request) const;
+
+        /**
+         * Same as StartPipelineExecutionAsync(const Model::StartPipelineExecutionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StartPipelineExecutionAsync(Model::StartPipelineExecutionRequest&& request, const StartPipelineExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a specified pipeline with edits or changes to its structure. Use a
          * JSON file with the pipeline structure in conjunction with UpdatePipeline to
@@ -885,6 +1176,155 @@ namespace Model
          */
         virtual void UpdatePipelineAsync(const Model::UpdatePipelineRequest& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdatePipelineCallable(const Model::UpdatePipelineRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdatePipelineOutcomeCallable UpdatePipelineCallable(Model::UpdatePipelineRequest&& request) const;
+
+        /**
+         * Same as UpdatePipelineAsync(const Model::UpdatePipelineRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdatePipelineAsync(Model::UpdatePipelineRequest&& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListActionTypes(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CodePipelineClient, Model::ListActionTypesRequest, Model::ListActionTypesOutcome> ListActionTypesPaginator(const Model::ListActionTypesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListPipelines(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CodePipelineClient, Model::ListPipelinesRequest, Model::ListPipelinesOutcome> ListPipelinesPaginator(const Model::ListPipelinesRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AcknowledgeJob(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::AcknowledgeJobRequest, Model::AcknowledgeJobOutcome> AcknowledgeJobAwaitable(Model::AcknowledgeJobRequest request) const;
+
+        /**
+         * co_await-able form of AcknowledgeThirdPartyJob(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::AcknowledgeThirdPartyJobRequest, Model::AcknowledgeThirdPartyJobOutcome> AcknowledgeThirdPartyJobAwaitable(Model::AcknowledgeThirdPartyJobRequest request) const;
+
+        /**
+         * co_await-able form of CreateCustomActionType(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::CreateCustomActionTypeRequest, Model::CreateCustomActionTypeOutcome> CreateCustomActionTypeAwaitable(Model::CreateCustomActionTypeRequest request) const;
+
+        /**
+         * co_await-able form of CreatePipeline(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::CreatePipelineRequest, Model::CreatePipelineOutcome> CreatePipelineAwaitable(Model::CreatePipelineRequest request) const;
+
+        /**
+         * co_await-able form of DeleteCustomActionType(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::DeleteCustomActionTypeRequest, Model::DeleteCustomActionTypeOutcome> DeleteCustomActionTypeAwaitable(Model::DeleteCustomActionTypeRequest request) const;
+
+        /**
+         * co_await-able form of DeletePipeline(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::DeletePipelineRequest, Model::DeletePipelineOutcome> DeletePipelineAwaitable(Model::DeletePipelineRequest request) const;
+
+        /**
+         * co_await-able form of DisableStageTransition(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::DisableStageTransitionRequest, Model::DisableStageTransitionOutcome> DisableStageTransitionAwaitable(Model::DisableStageTransitionRequest request) const;
+
+        /**
+         * co_await-able form of EnableStageTransition(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::EnableStageTransitionRequest, Model::EnableStageTransitionOutcome> EnableStageTransitionAwaitable(Model::EnableStageTransitionRequest request) const;
+
+        /**
+         * co_await-able form of GetJobDetails(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::GetJobDetailsRequest, Model::GetJobDetailsOutcome> GetJobDetailsAwaitable(Model::GetJobDetailsRequest request) const;
+
+        /**
+         * co_await-able form of GetPipeline(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::GetPipelineRequest, Model::GetPipelineOutcome> GetPipelineAwaitable(Model::GetPipelineRequest request) const;
+
+        /**
+         * co_await-able form of GetPipelineState(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::GetPipelineStateRequest, Model::GetPipelineStateOutcome> GetPipelineStateAwaitable(Model::GetPipelineStateRequest request) const;
+
+        /**
+         * co_await-able form of GetThirdPartyJobDetails(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::GetThirdPartyJobDetailsRequest, Model::GetThirdPartyJobDetailsOutcome> GetThirdPartyJobDetailsAwaitable(Model::GetThirdPartyJobDetailsRequest request) const;
+
+        /**
+         * co_await-able form of ListActionTypes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::ListActionTypesRequest, Model::ListActionTypesOutcome> ListActionTypesAwaitable(Model::ListActionTypesRequest request) const;
+
+        /**
+         * co_await-able form of ListPipelines(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::ListPipelinesRequest, Model::ListPipelinesOutcome> ListPipelinesAwaitable(Model::ListPipelinesRequest request) const;
+
+        /**
+         * co_await-able form of PollForJobs(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::PollForJobsRequest, Model::PollForJobsOutcome> PollForJobsAwaitable(Model::PollForJobsRequest request) const;
+
+        /**
+         * co_await-able form of PollForThirdPartyJobs(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::PollForThirdPartyJobsRequest, Model::PollForThirdPartyJobsOutcome> PollForThirdPartyJobsAwaitable(Model::PollForThirdPartyJobsRequest request) const;
+
+        /**
+         * co_await-able form of PutActionRevision(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::PutActionRevisionRequest, Model::PutActionRevisionOutcome> PutActionRevisionAwaitable(Model::PutActionRevisionRequest request) const;
+
+        /**
+         * co_await-able form of PutApprovalResult(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::PutApprovalResultRequest, Model::PutApprovalResultOutcome> PutApprovalResultAwaitable(Model::PutApprovalResultRequest request) const;
+
+        /**
+         * co_await-able form of PutJobFailureResult(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::PutJobFailureResultRequest, Model::PutJobFailureResultOutcome> PutJobFailureResultAwaitable(Model::PutJobFailureResultRequest request) const;
+
+        /**
+         * co_await-able form of PutJobSuccessResult(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::PutJobSuccessResultRequest, Model::PutJobSuccessResultOutcome> PutJobSuccessResultAwaitable(Model::PutJobSuccessResultRequest request) const;
+
+        /**
+         * co_await-able form of PutThirdPartyJobFailureResult(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::PutThirdPartyJobFailureResultRequest, Model::PutThirdPartyJobFailureResultOutcome> PutThirdPartyJobFailureResultAwaitable(Model::PutThirdPartyJobFailureResultRequest request) const;
+
+        /**
+         * co_await-able form of PutThirdPartyJobSuccessResult(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::PutThirdPartyJobSuccessResultRequest, Model::PutThirdPartyJobSuccessResultOutcome> PutThirdPartyJobSuccessResultAwaitable(Model::PutThirdPartyJobSuccessResultRequest request) const;
+
+        /**
+         * co_await-able form of RetryStageExecution(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::RetryStageExecutionRequest, Model::RetryStageExecutionOutcome> RetryStageExecutionAwaitable(Model::RetryStageExecutionRequest request) const;
+
+        /**
+         * co_await-able form of StartPipelineExecution(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::StartPipelineExecutionRequest, Model::StartPipelineExecutionOutcome> StartPipelineExecutionAwaitable(Model::StartPipelineExecutionRequest request) const;
+
+        /**
+         * co_await-able form of UpdatePipeline(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CodePipelineClient, Model::UpdatePipelineRequest, Model::UpdatePipelineOutcome> UpdatePipelineAwaitable(Model::UpdatePipelineRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
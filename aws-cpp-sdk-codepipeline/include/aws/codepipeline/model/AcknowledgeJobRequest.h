@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AcknowledgeJobRequest();
+    inline const char* GetServiceRequestName() const override { return "AcknowledgeJob"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
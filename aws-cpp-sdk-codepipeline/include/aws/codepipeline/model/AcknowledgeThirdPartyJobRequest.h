@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AcknowledgeThirdPartyJobRequest();
+    inline const char* GetServiceRequestName() const override { return "AcknowledgeThirdPartyJob"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     CreateCustomActionTypeRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateCustomActionType"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
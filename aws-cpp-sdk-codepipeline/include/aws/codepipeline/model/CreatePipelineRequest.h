@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreatePipelineRequest();
+    inline const char* GetServiceRequestName() const override { return "CreatePipeline"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DeleteCustomActionTypeRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteCustomActionType"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
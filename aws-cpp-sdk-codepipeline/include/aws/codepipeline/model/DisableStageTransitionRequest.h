@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DisableStageTransitionRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableStageTransition"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
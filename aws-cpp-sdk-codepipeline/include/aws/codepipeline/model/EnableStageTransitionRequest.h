@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     EnableStageTransitionRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableStageTransition"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
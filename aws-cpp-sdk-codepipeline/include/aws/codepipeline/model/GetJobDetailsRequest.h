@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetJobDetailsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetJobDetails"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetPipelineRequest();
+    inline const char* GetServiceRequestName() const override { return "GetPipeline"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
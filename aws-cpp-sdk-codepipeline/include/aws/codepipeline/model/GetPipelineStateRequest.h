@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetPipelineStateRequest();
+    inline const char* GetServiceRequestName() const override { return "GetPipelineState"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
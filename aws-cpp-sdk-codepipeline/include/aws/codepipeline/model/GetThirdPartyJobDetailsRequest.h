@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetThirdPartyJobDetailsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetThirdPartyJobDetails"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
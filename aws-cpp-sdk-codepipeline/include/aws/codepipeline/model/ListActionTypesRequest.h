@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListActionTypesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListActionTypes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
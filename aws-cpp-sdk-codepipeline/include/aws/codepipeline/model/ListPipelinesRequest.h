@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListPipelinesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListPipelines"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
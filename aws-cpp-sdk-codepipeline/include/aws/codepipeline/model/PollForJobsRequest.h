@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     PollForJobsRequest();
+    inline const char* GetServiceRequestName() const override { return "PollForJobs"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
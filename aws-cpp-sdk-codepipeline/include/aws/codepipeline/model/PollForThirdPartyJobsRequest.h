@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PollForThirdPartyJobsRequest();
+    inline const char* GetServiceRequestName() const override { return "PollForThirdPartyJobs"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
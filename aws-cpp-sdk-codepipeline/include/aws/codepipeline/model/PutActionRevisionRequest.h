@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PutActionRevisionRequest();
+    inline const char* GetServiceRequestName() const override { return "PutActionRevision"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
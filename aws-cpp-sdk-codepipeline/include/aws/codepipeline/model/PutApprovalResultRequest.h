@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PutApprovalResultRequest();
+    inline const char* GetServiceRequestName() const override { return "PutApprovalResult"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PutJobFailureResultRequest();
+    inline const char* GetServiceRequestName() const override { return "PutJobFailureResult"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
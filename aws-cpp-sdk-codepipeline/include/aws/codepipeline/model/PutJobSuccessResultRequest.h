@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     PutJobSuccessResultRequest();
+    inline const char* GetServiceRequestName() const override { return "PutJobSuccessResult"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PutThirdPartyJobFailureResultRequest();
+    inline const char* GetServiceRequestName() const override { return "PutThirdPartyJobFailureResult"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
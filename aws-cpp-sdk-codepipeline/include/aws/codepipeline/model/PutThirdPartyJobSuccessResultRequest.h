@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     PutThirdPartyJobSuccessResultRequest();
+    inline const char* GetServiceRequestName() const override { return "PutThirdPartyJobSuccessResult"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
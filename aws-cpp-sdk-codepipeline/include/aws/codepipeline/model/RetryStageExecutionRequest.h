@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RetryStageExecutionRequest();
+    inline const char* GetServiceRequestName() const override { return "RetryStageExecution"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     StartPipelineExecutionRequest();
+    inline const char* GetServiceRequestName() const override { return "StartPipelineExecution"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
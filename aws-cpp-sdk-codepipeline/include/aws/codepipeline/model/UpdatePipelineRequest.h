@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdatePipelineRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdatePipeline"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -134,7 +134,7 @@ AcknowledgeJobOutcome CodePipelineClient::AcknowledgeJob(const AcknowledgeJobReq
 
 AcknowledgeJobOutcomeCallable CodePipelineClient::AcknowledgeJobCallable(const AcknowledgeJobRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AcknowledgeJob(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AcknowledgeJob(request); } );
 }
 
 void CodePipelineClient::AcknowledgeJobAsync(const AcknowledgeJobRequest& request, const AcknowledgeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -142,6 +142,16 @@ void CodePipelineClient::AcknowledgeJobAsync(const AcknowledgeJobRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->AcknowledgeJobAsyncHelper( request, handler, context ); } );
 }
 
+AcknowledgeJobOutcomeCallable CodePipelineClient::AcknowledgeJobCallable(AcknowledgeJobRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::AcknowledgeJob, this, std::move(request)));
+}
+
+void CodePipelineClient::AcknowledgeJobAsync(AcknowledgeJobRequest&& request, const AcknowledgeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::AcknowledgeJobAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::AcknowledgeJobAsyncHelper(const AcknowledgeJobRequest& request, const AcknowledgeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AcknowledgeJob(request), context);
@@ -165,7 +175,7 @@ AcknowledgeThirdPartyJobOutcome CodePipelineClient::AcknowledgeThirdPartyJob(con
 
 AcknowledgeThirdPartyJobOutcomeCallable CodePipelineClient::AcknowledgeThirdPartyJobCallable(const AcknowledgeThirdPartyJobRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AcknowledgeThirdPartyJob(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AcknowledgeThirdPartyJob(request); } );
 }
 
 void CodePipelineClient::AcknowledgeThirdPartyJobAsync(const AcknowledgeThirdPartyJobRequest& request, const AcknowledgeThirdPartyJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -173,6 +183,16 @@ void CodePipelineClient::AcknowledgeThirdPartyJobAsync(const AcknowledgeThirdPar
   m_executor->Submit( [this, request, handler, context](){ this->AcknowledgeThirdPartyJobAsyncHelper( request, handler, context ); } );
 }
 
+AcknowledgeThirdPartyJobOutcomeCallable CodePipelineClient::AcknowledgeThirdPartyJobCallable(AcknowledgeThirdPartyJobRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::AcknowledgeThirdPartyJob, this, std::move(request)));
+}
+
+void CodePipelineClient::AcknowledgeThirdPartyJobAsync(AcknowledgeThirdPartyJobRequest&& request, const AcknowledgeThirdPartyJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::AcknowledgeThirdPartyJobAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::AcknowledgeThirdPartyJobAsyncHelper(const AcknowledgeThirdPartyJobRequest& request, const AcknowledgeThirdPartyJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AcknowledgeThirdPartyJob(request), context);
@@ -196,7 +216,7 @@ CreateCustomActionTypeOutcome CodePipelineClient::CreateCustomActionType(const C
 
 CreateCustomActionTypeOutcomeCallable CodePipelineClient::CreateCustomActionTypeCallable(const CreateCustomActionTypeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateCustomActionType(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateCustomActionType(request); } );
 }
 
 void CodePipelineClient::CreateCustomActionTypeAsync(const CreateCustomActionTypeRequest& request, const CreateCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -204,6 +224,16 @@ void CodePipelineClient::CreateCustomActionTypeAsync(const CreateCustomActionTyp
   m_executor->Submit( [this, request, handler, context](){ this->CreateCustomActionTypeAsyncHelper( request, handler, context ); } );
 }
 
+CreateCustomActionTypeOutcomeCallable CodePipelineClient::CreateCustomActionTypeCallable(CreateCustomActionTypeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::CreateCustomActionType, this, std::move(request)));
+}
+
+void CodePipelineClient::CreateCustomActionTypeAsync(CreateCustomActionTypeRequest&& request, const CreateCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::CreateCustomActionTypeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::CreateCustomActionTypeAsyncHelper(const CreateCustomActionTypeRequest& request, const CreateCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateCustomActionType(request), context);
@@ -227,7 +257,7 @@ CreatePipelineOutcome CodePipelineClient::CreatePipeline(const CreatePipelineReq
 
 CreatePipelineOutcomeCallable CodePipelineClient::CreatePipelineCallable(const CreatePipelineRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreatePipeline(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreatePipeline(request); } );
 }
 
 void CodePipelineClient::CreatePipelineAsync(const CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -235,6 +265,16 @@ void CodePipelineClient::CreatePipelineAsync(const CreatePipelineRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->CreatePipelineAsyncHelper( request, handler, context ); } );
 }
 
+CreatePipelineOutcomeCallable CodePipelineClient::CreatePipelineCallable(CreatePipelineRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::CreatePipeline, this, std::move(request)));
+}
+
+void CodePipelineClient::CreatePipelineAsync(CreatePipelineRequest&& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::CreatePipelineAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::CreatePipelineAsyncHelper(const CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreatePipeline(request), context);
@@ -258,7 +298,7 @@ DeleteCustomActionTypeOutcome CodePipelineClient::DeleteCustomActionType(const D
 
 DeleteCustomActionTypeOutcomeCallable CodePipelineClient::DeleteCustomActionTypeCallable(const DeleteCustomActionTypeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteCustomActionType(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteCustomActionType(request); } );
 }
 
 void CodePipelineClient::DeleteCustomActionTypeAsync(const DeleteCustomActionTypeRequest& request, const DeleteCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -266,6 +306,16 @@ void CodePipelineClient::DeleteCustomActionTypeAsync(const DeleteCustomActionTyp
   m_executor->Submit( [this, request, handler, context](){ this->DeleteCustomActionTypeAsyncHelper( request, handler, context ); } );
 }
 
+DeleteCustomActionTypeOutcomeCallable CodePipelineClient::DeleteCustomActionTypeCallable(DeleteCustomActionTypeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::DeleteCustomActionType, this, std::move(request)));
+}
+
+void CodePipelineClient::DeleteCustomActionTypeAsync(DeleteCustomActionTypeRequest&& request, const DeleteCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::DeleteCustomActionTypeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::DeleteCustomActionTypeAsyncHelper(const DeleteCustomActionTypeRequest& request, const DeleteCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteCustomActionType(request), context);
@@ -289,7 +339,7 @@ DeletePipelineOutcome CodePipelineClient::DeletePipeline(const DeletePipelineReq
 
 DeletePipelineOutcomeCallable CodePipelineClient::DeletePipelineCallable(const DeletePipelineRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeletePipeline(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeletePipeline(request); } );
 }
 
 void CodePipelineClient::DeletePipelineAsync(const DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -297,6 +347,16 @@ void CodePipelineClient::DeletePipelineAsync(const DeletePipelineRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->DeletePipelineAsyncHelper( request, handler, context ); } );
 }
 
+DeletePipelineOutcomeCallable CodePipelineClient::DeletePipelineCallable(DeletePipelineRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::DeletePipeline, this, std::move(request)));
+}
+
+void CodePipelineClient::DeletePipelineAsync(DeletePipelineRequest&& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::DeletePipelineAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::DeletePipelineAsyncHelper(const DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeletePipeline(request), context);
@@ -320,7 +380,7 @@ DisableStageTransitionOutcome CodePipelineClient::DisableStageTransition(const D
 
 DisableStageTransitionOutcomeCallable CodePipelineClient::DisableStageTransitionCallable(const DisableStageTransitionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableStageTransition(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableStageTransition(request); } );
 }
 
 void CodePipelineClient::DisableStageTransitionAsync(const DisableStageTransitionRequest& request, const DisableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -328,6 +388,16 @@ void CodePipelineClient::DisableStageTransitionAsync(const DisableStageTransitio
   m_executor->Submit( [this, request, handler, context](){ this->DisableStageTransitionAsyncHelper( request, handler, context ); } );
 }
 
+DisableStageTransitionOutcomeCallable CodePipelineClient::DisableStageTransitionCallable(DisableStageTransitionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::DisableStageTransition, this, std::move(request)));
+}
+
+void CodePipelineClient::DisableStageTransitionAsync(DisableStageTransitionRequest&& request, const DisableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::DisableStageTransitionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::DisableStageTransitionAsyncHelper(const DisableStageTransitionRequest& request, const DisableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableStageTransition(request), context);
@@ -351,7 +421,7 @@ EnableStageTransitionOutcome CodePipelineClient::EnableStageTransition(const Ena
 
 EnableStageTransitionOutcomeCallable CodePipelineClient::EnableStageTransitionCallable(const EnableStageTransitionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableStageTransition(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableStageTransition(request); } );
 }
 
 void CodePipelineClient::EnableStageTransitionAsync(const EnableStageTransitionRequest& request, const EnableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -359,6 +429,16 @@ void CodePipelineClient::EnableStageTransitionAsync(const EnableStageTransitionR
   m_executor->Submit( [this, request, handler, context](){ this->EnableStageTransitionAsyncHelper( request, handler, context ); } );
 }
 
+EnableStageTransitionOutcomeCallable CodePipelineClient::EnableStageTransitionCallable(EnableStageTransitionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::EnableStageTransition, this, std::move(request)));
+}
+
+void CodePipelineClient::EnableStageTransitionAsync(EnableStageTransitionRequest&& request, const EnableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::EnableStageTransitionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::EnableStageTransitionAsyncHelper(const EnableStageTransitionRequest& request, const EnableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableStageTransition(request), context);
@@ -382,7 +462,7 @@ GetJobDetailsOutcome CodePipelineClient::GetJobDetails(const GetJobDetailsReques
 
 GetJobDetailsOutcomeCallable CodePipelineClient::GetJobDetailsCallable(const GetJobDetailsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetJobDetails(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetJobDetails(request); } );
 }
 
 void CodePipelineClient::GetJobDetailsAsync(const GetJobDetailsRequest& request, const GetJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -390,6 +470,16 @@ void CodePipelineClient::GetJobDetailsAsync(const GetJobDetailsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->GetJobDetailsAsyncHelper( request, handler, context ); } );
 }
 
+GetJobDetailsOutcomeCallable CodePipelineClient::GetJobDetailsCallable(GetJobDetailsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::GetJobDetails, this, std::move(request)));
+}
+
+void CodePipelineClient::GetJobDetailsAsync(GetJobDetailsRequest&& request, const GetJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::GetJobDetailsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::GetJobDetailsAsyncHelper(const GetJobDetailsRequest& request, const GetJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetJobDetails(request), context);
@@ -413,7 +503,7 @@ GetPipelineOutcome CodePipelineClient::GetPipeline(const GetPipelineRequest& req
 
 GetPipelineOutcomeCallable CodePipelineClient::GetPipelineCallable(const GetPipelineRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetPipeline(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetPipeline(request); } );
 }
 
 void CodePipelineClient::GetPipelineAsync(const GetPipelineRequest& request, const GetPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -421,6 +511,16 @@ void CodePipelineClient::GetPipelineAsync(const GetPipelineRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->GetPipelineAsyncHelper( request, handler, context ); } );
 }
 
+GetPipelineOutcomeCallable CodePipelineClient::GetPipelineCallable(GetPipelineRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::GetPipeline, this, std::move(request)));
+}
+
+void CodePipelineClient::GetPipelineAsync(GetPipelineRequest&& request, const GetPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::GetPipelineAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::GetPipelineAsyncHelper(const GetPipelineRequest& request, const GetPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetPipeline(request), context);
@@ -444,7 +544,7 @@ GetPipelineStateOutcome CodePipelineClient::GetPipelineState(const GetPipelineSt
 
 GetPipelineStateOutcomeCallable CodePipelineClient::GetPipelineStateCallable(const GetPipelineStateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetPipelineState(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetPipelineState(request); } );
 }
 
 void CodePipelineClient::GetPipelineStateAsync(const GetPipelineStateRequest& request, const GetPipelineStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -452,6 +552,16 @@ void CodePipelineClient::GetPipelineStateAsync(const GetPipelineStateRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->GetPipelineStateAsyncHelper( request, handler, context ); } );
 }
 
+GetPipelineStateOutcomeCallable CodePipelineClient::GetPipelineStateCallable(GetPipelineStateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::GetPipelineState, this, std::move(request)));
+}
+
+void CodePipelineClient::GetPipelineStateAsync(GetPipelineStateRequest&& request, const GetPipelineStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::GetPipelineStateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::GetPipelineStateAsyncHelper(const GetPipelineStateRequest& request, const GetPipelineStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetPipelineState(request), context);
@@ -475,7 +585,7 @@ GetThirdPartyJobDetailsOutcome CodePipelineClient::GetThirdPartyJobDetails(const
 
 GetThirdPartyJobDetailsOutcomeCallable CodePipelineClient::GetThirdPartyJobDetailsCallable(const GetThirdPartyJobDetailsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetThirdPartyJobDetails(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetThirdPartyJobDetails(request); } );
 }
 
 void CodePipelineClient::GetThirdPartyJobDetailsAsync(const GetThirdPartyJobDetailsRequest& request, const GetThirdPartyJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -483,6 +593,16 @@ void CodePipelineClient::GetThirdPartyJobDetailsAsync(const GetThirdPartyJobDeta
   m_executor->Submit( [this, request, handler, context](){ this->GetThirdPartyJobDetailsAsyncHelper( request, handler, context ); } );
 }
 
+GetThirdPartyJobDetailsOutcomeCallable CodePipelineClient::GetThirdPartyJobDetailsCallable(GetThirdPartyJobDetailsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::GetThirdPartyJobDetails, this, std::move(request)));
+}
+
+void CodePipelineClient::GetThirdPartyJobDetailsAsync(GetThirdPartyJobDetailsRequest&& request, const GetThirdPartyJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::GetThirdPartyJobDetailsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::GetThirdPartyJobDetailsAsyncHelper(const GetThirdPartyJobDetailsRequest& request, const GetThirdPartyJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetThirdPartyJobDetails(request), context);
@@ -506,7 +626,7 @@ ListActionTypesOutcome CodePipelineClient::ListActionTypes(const ListActionTypes
 
 ListActionTypesOutcomeCallable CodePipelineClient::ListActionTypesCallable(const ListActionTypesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListActionTypes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListActionTypes(request); } );
 }
 
 void CodePipelineClient::ListActionTypesAsync(const ListActionTypesRequest& request, const ListActionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -514,6 +634,16 @@ void CodePipelineClient::ListActionTypesAsync(const ListActionTypesRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->ListActionTypesAsyncHelper( request, handler, context ); } );
 }
 
+ListActionTypesOutcomeCallable CodePipelineClient::ListActionTypesCallable(ListActionTypesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::ListActionTypes, this, std::move(request)));
+}
+
+void CodePipelineClient::ListActionTypesAsync(ListActionTypesRequest&& request, const ListActionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::ListActionTypesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::ListActionTypesAsyncHelper(const ListActionTypesRequest& request, const ListActionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListActionTypes(request), context);
@@ -537,7 +667,7 @@ ListPipelinesOutcome CodePipelineClient::ListPipelines(const ListPipelinesReques
 
 ListPipelinesOutcomeCallable CodePipelineClient::ListPipelinesCallable(const ListPipelinesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListPipelines(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListPipelines(request); } );
 }
 
 void CodePipelineClient::ListPipelinesAsync(const ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -545,6 +675,16 @@ void CodePipelineClient::ListPipelinesAsync(const ListPipelinesRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ListPipelinesAsyncHelper( request, handler, context ); } );
 }
 
+ListPipelinesOutcomeCallable CodePipelineClient::ListPipelinesCallable(ListPipelinesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::ListPipelines, this, std::move(request)));
+}
+
+void CodePipelineClient::ListPipelinesAsync(ListPipelinesRequest&& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::ListPipelinesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::ListPipelinesAsyncHelper(const ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListPipelines(request), context);
@@ -568,7 +708,7 @@ PollForJobsOutcome CodePipelineClient::PollForJobs(const PollForJobsRequest& req
 
 PollForJobsOutcomeCallable CodePipelineClient::PollForJobsCallable(const PollForJobsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PollForJobs(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PollForJobs(request); } );
 }
 
 void CodePipelineClient::PollForJobsAsync(const PollForJobsRequest& request, const PollForJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -576,6 +716,16 @@ void CodePipelineClient::PollForJobsAsync(const PollForJobsRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->PollForJobsAsyncHelper( request, handler, context ); } );
 }
 
+PollForJobsOutcomeCallable CodePipelineClient::PollForJobsCallable(PollForJobsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::PollForJobs, this, std::move(request)));
+}
+
+void CodePipelineClient::PollForJobsAsync(PollForJobsRequest&& request, const PollForJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::PollForJobsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::PollForJobsAsyncHelper(const PollForJobsRequest& request, const PollForJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PollForJobs(request), context);
@@ -599,7 +749,7 @@ PollForThirdPartyJobsOutcome CodePipelineClient::PollForThirdPartyJobs(const Pol
 
 PollForThirdPartyJobsOutcomeCallable CodePipelineClient::PollForThirdPartyJobsCallable(const PollForThirdPartyJobsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PollForThirdPartyJobs(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PollForThirdPartyJobs(request); } );
 }
 
 void CodePipelineClient::PollForThirdPartyJobsAsync(const PollForThirdPartyJobsRequest& request, const PollForThirdPartyJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -607,6 +757,16 @@ void CodePipelineClient::PollForThirdPartyJobsAsync(const PollForThirdPartyJobsR
   m_executor->Submit( [this, request, handler, context](){ this->PollForThirdPartyJobsAsyncHelper( request, handler, context ); } );
 }
 
+PollForThirdPartyJobsOutcomeCallable CodePipelineClient::PollForThirdPartyJobsCallable(PollForThirdPartyJobsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::PollForThirdPartyJobs, this, std::move(request)));
+}
+
+void CodePipelineClient::PollForThirdPartyJobsAsync(PollForThirdPartyJobsRequest&& request, const PollForThirdPartyJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::PollForThirdPartyJobsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::PollForThirdPartyJobsAsyncHelper(const PollForThirdPartyJobsRequest& request, const PollForThirdPartyJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PollForThirdPartyJobs(request), context);
@@ -630,7 +790,7 @@ PutActionRevisionOutcome CodePipelineClient::PutActionRevision(const PutActionRe
 
 PutActionRevisionOutcomeCallable CodePipelineClient::PutActionRevisionCallable(const PutActionRevisionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutActionRevision(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutActionRevision(request); } );
 }
 
 void CodePipelineClient::PutActionRevisionAsync(const PutActionRevisionRequest& request, const PutActionRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -638,6 +798,16 @@ void CodePipelineClient::PutActionRevisionAsync(const PutActionRevisionRequest&
   m_executor->Submit( [this, request, handler, context](){ this->PutActionRevisionAsyncHelper( request, handler, context ); } );
 }
 
+PutActionRevisionOutcomeCallable CodePipelineClient::PutActionRevisionCallable(PutActionRevisionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::PutActionRevision, this, std::move(request)));
+}
+
+void CodePipelineClient::PutActionRevisionAsync(PutActionRevisionRequest&& request, const PutActionRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::PutActionRevisionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::PutActionRevisionAsyncHelper(const PutActionRevisionRequest& request, const PutActionRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutActionRevision(request), context);
@@ -661,7 +831,7 @@ PutApprovalResultOutcome CodePipelineClient::PutApprovalResult(const PutApproval
 
 PutApprovalResultOutcomeCallable CodePipelineClient::PutApprovalResultCallable(const PutApprovalResultRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutApprovalResult(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutApprovalResult(request); } );
 }
 
 void CodePipelineClient::PutApprovalResultAsync(const PutApprovalResultRequest& request, const PutApprovalResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -669,6 +839,16 @@ void CodePipelineClient::PutApprovalResultAsync(const PutApprovalResultRequest&
   m_executor->Submit( [this, request, handler, context](){ this->PutApprovalResultAsyncHelper( request, handler, context ); } );
 }
 
+PutApprovalResultOutcomeCallable CodePipelineClient::PutApprovalResultCallable(PutApprovalResultRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::PutApprovalResult, this, std::move(request)));
+}
+
+void CodePipelineClient::PutApprovalResultAsync(PutApprovalResultRequest&& request, const PutApprovalResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::PutApprovalResultAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::PutApprovalResultAsyncHelper(const PutApprovalResultRequest& request, const PutApprovalResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutApprovalResult(request), context);
@@ -692,7 +872,7 @@ PutJobFailureResultOutcome CodePipelineClient::PutJobFailureResult(const PutJobF
 
 PutJobFailureResultOutcomeCallable CodePipelineClient::PutJobFailureResultCallable(const PutJobFailureResultRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutJobFailureResult(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutJobFailureResult(request); } );
 }
 
 void CodePipelineClient::PutJobFailureResultAsync(const PutJobFailureResultRequest& request, const PutJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -700,6 +880,16 @@ void CodePipelineClient::PutJobFailureResultAsync(const PutJobFailureResultReque
   m_executor->Submit( [this, request, handler, context](){ this->PutJobFailureResultAsyncHelper( request, handler, context ); } );
 }
 
+PutJobFailureResultOutcomeCallable CodePipelineClient::PutJobFailureResultCallable(PutJobFailureResultRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::PutJobFailureResult, this, std::move(request)));
+}
+
+void CodePipelineClient::PutJobFailureResultAsync(PutJobFailureResultRequest&& request, const PutJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::PutJobFailureResultAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::PutJobFailureResultAsyncHelper(const PutJobFailureResultRequest& request, const PutJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutJobFailureResult(request), context);
@@ -723,7 +913,7 @@ PutJobSuccessResultOutcome CodePipelineClient::PutJobSuccessResult(const PutJobS
 
 PutJobSuccessResultOutcomeCallable CodePipelineClient::PutJobSuccessResultCallable(const PutJobSuccessResultRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutJobSuccessResult(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutJobSuccessResult(request); } );
 }
 
 void CodePipelineClient::PutJobSuccessResultAsync(const PutJobSuccessResultRequest& request, const PutJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -731,6 +921,16 @@ void CodePipelineClient::PutJobSuccessResultAsync(const PutJobSuccessResultReque
   m_executor->Submit( [this, request, handler, context](){ this->PutJobSuccessResultAsyncHelper( request, handler, context ); } );
 }
 
+PutJobSuccessResultOutcomeCallable CodePipelineClient::PutJobSuccessResultCallable(PutJobSuccessResultRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::PutJobSuccessResult, this, std::move(request)));
+}
+
+void CodePipelineClient::PutJobSuccessResultAsync(PutJobSuccessResultRequest&& request, const PutJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::PutJobSuccessResultAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::PutJobSuccessResultAsyncHelper(const PutJobSuccessResultRequest& request, const PutJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutJobSuccessResult(request), context);
@@ -754,7 +954,7 @@ PutThirdPartyJobFailureResultOutcome CodePipelineClient::PutThirdPartyJobFailure
 
 PutThirdPartyJobFailureResultOutcomeCallable CodePipelineClient::PutThirdPartyJobFailureResultCallable(const PutThirdPartyJobFailureResultRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutThirdPartyJobFailureResult(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutThirdPartyJobFailureResult(request); } );
 }
 
 void CodePipelineClient::PutThirdPartyJobFailureResultAsync(const PutThirdPartyJobFailureResultRequest& request, const PutThirdPartyJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -762,6 +962,16 @@ void CodePipelineClient::PutThirdPartyJobFailureResultAsync(const PutThirdPartyJ
   m_executor->Submit( [this, request, handler, context](){ this->PutThirdPartyJobFailureResultAsyncHelper( request, handler, context ); } );
 }
 
+PutThirdPartyJobFailureResultOutcomeCallable CodePipelineClient::PutThirdPartyJobFailureResultCallable(PutThirdPartyJobFailureResultRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::PutThirdPartyJobFailureResult, this, std::move(request)));
+}
+
+void CodePipelineClient::PutThirdPartyJobFailureResultAsync(PutThirdPartyJobFailureResultRequest&& request, const PutThirdPartyJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::PutThirdPartyJobFailureResultAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::PutThirdPartyJobFailureResultAsyncHelper(const PutThirdPartyJobFailureResultRequest& request, const PutThirdPartyJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutThirdPartyJobFailureResult(request), context);
@@ -785,7 +995,7 @@ PutThirdPartyJobSuccessResultOutcome CodePipelineClient::PutThirdPartyJobSuccess
 
 PutThirdPartyJobSuccessResultOutcomeCallable CodePipelineClient::PutThirdPartyJobSuccessResultCallable(const PutThirdPartyJobSuccessResultRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutThirdPartyJobSuccessResult(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutThirdPartyJobSuccessResult(request); } );
 }
 
 void CodePipelineClient::PutThirdPartyJobSuccessResultAsync(const PutThirdPartyJobSuccessResultRequest& request, const PutThirdPartyJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -793,6 +1003,16 @@ void CodePipelineClient::PutThirdPartyJobSuccessResultAsync(const PutThirdPartyJ
   m_executor->Submit( [this, request, handler, context](){ this->PutThirdPartyJobSuccessResultAsyncHelper( request, handler, context ); } );
 }
 
+PutThirdPartyJobSuccessResultOutcomeCallable CodePipelineClient::PutThirdPartyJobSuccessResultCallable(PutThirdPartyJobSuccessResultRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::PutThirdPartyJobSuccessResult, this, std::move(request)));
+}
+
+void CodePipelineClient::PutThirdPartyJobSuccessResultAsync(PutThirdPartyJobSuccessResultRequest&& request, const PutThirdPartyJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::PutThirdPartyJobSuccessResultAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::PutThirdPartyJobSuccessResultAsyncHelper(const PutThirdPartyJobSuccessResultRequest& request, const PutThirdPartyJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutThirdPartyJobSuccessResult(request), context);
@@ -816,7 +1036,7 @@ RetryStageExecutionOutcome CodePipelineClient::RetryStageExecution(const RetrySt
 
 RetryStageExecutionOutcomeCallable CodePipelineClient::RetryStageExecutionCallable(const RetryStageExecutionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RetryStageExecution(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RetryStageExecution(request); } );
 }
 
 void CodePipelineClient::RetryStageExecutionAsync(const RetryStageExecutionRequest& request, const RetryStageExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -824,6 +1044,16 @@ void CodePipelineClient::RetryStageExecutionAsync(const RetryStageExecutionReque
   m_executor->Submit( [this, request, handler, context](){ this->RetryStageExecutionAsyncHelper( request, handler, context ); } );
 }
 
+RetryStageExecutionOutcomeCallable CodePipelineClient::RetryStageExecutionCallable(RetryStageExecutionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::RetryStageExecution, this, std::move(request)));
+}
+
+void CodePipelineClient::RetryStageExecutionAsync(RetryStageExecutionRequest&& request, const RetryStageExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::RetryStageExecutionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::RetryStageExecutionAsyncHelper(const RetryStageExecutionRequest& request, const RetryStageExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RetryStageExecution(request), context);
@@ -847,7 +1077,7 @@ StartPipelineExecutionOutcome CodePipelineClient::StartPipelineExecution(const S
 
 StartPipelineExecutionOutcomeCallable CodePipelineClient::StartPipelineExecutionCallable(const StartPipelineExecutionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StartPipelineExecution(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StartPipelineExecution(request); } );
 }
 
 void CodePipelineClient::StartPipelineExecutionAsync(const StartPipelineExecutionRequest& request, const StartPipelineExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -855,6 +1085,16 @@ void CodePipelineClient::StartPipelineExecutionAsync(const StartPipelineExecutio
   m_executor->Submit( [this, request, handler, context](){ this->StartPipelineExecutionAsyncHelper( request, handler, context ); } );
 }
 
+StartPipelineExecutionOutcomeCallable CodePipelineClient::StartPipelineExecutionCallable(StartPipelineExecutionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::StartPipelineExecution, this, std::move(request)));
+}
+
+void CodePipelineClient::StartPipelineExecutionAsync(StartPipelineExecutionRequest&& request, const StartPipelineExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::StartPipelineExecutionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::StartPipelineExecutionAsyncHelper(const StartPipelineExecutionRequest& request, const StartPipelineExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StartPipelineExecution(request), context);
@@ -878,7 +1118,7 @@ UpdatePipelineOutcome CodePipelineClient::UpdatePipeline(const UpdatePipelineReq
 
 UpdatePipelineOutcomeCallable CodePipelineClient::UpdatePipelineCallable(const UpdatePipelineRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdatePipeline(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdatePipeline(request); } );
 }
 
 void CodePipelineClient::UpdatePipelineAsync(const UpdatePipelineRequest& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -886,8 +1126,179 @@ void CodePipelineClient::UpdatePipelineAsync(const UpdatePipelineRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->UpdatePipelineAsyncHelper( request, handler, context ); } );
 }
 
+UpdatePipelineOutcomeCallable CodePipelineClient::UpdatePipelineCallable(UpdatePipelineRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CodePipelineClient::UpdatePipeline, this, std::move(request)));
+}
+
+void CodePipelineClient::UpdatePipelineAsync(UpdatePipelineRequest&& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CodePipelineClient::UpdatePipelineAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CodePipelineClient::UpdatePipelineAsyncHelper(const UpdatePipelineRequest& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdatePipeline(request), context);
 }
 
+Paginator<CodePipelineClient, ListActionTypesRequest, ListActionTypesOutcome> CodePipelineClient::ListActionTypesPaginator(const ListActionTypesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CodePipelineClient, ListActionTypesRequest, ListActionTypesOutcome>(this, &CodePipelineClient::ListActionTypes, request,
+    [](const ListActionTypesRequest& current, const ListActionTypesOutcome& outcome, ListActionTypesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CodePipelineClient, ListPipelinesRequest, ListPipelinesOutcome> CodePipelineClient::ListPipelinesPaginator(const ListPipelinesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CodePipelineClient, ListPipelinesRequest, ListPipelinesOutcome>(this, &CodePipelineClient::ListPipelines, request,
+    [](const ListPipelinesRequest& current, const ListPipelinesOutcome& outcome, ListPipelinesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<CodePipelineClient, AcknowledgeJobRequest, AcknowledgeJobOutcome> CodePipelineClient::AcknowledgeJobAwaitable(AcknowledgeJobRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::AcknowledgeJob, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, AcknowledgeThirdPartyJobRequest, AcknowledgeThirdPartyJobOutcome> CodePipelineClient::AcknowledgeThirdPartyJobAwaitable(AcknowledgeThirdPartyJobRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::AcknowledgeThirdPartyJob, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, CreateCustomActionTypeRequest, CreateCustomActionTypeOutcome> CodePipelineClient::CreateCustomActionTypeAwaitable(CreateCustomActionTypeRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::CreateCustomActionType, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, CreatePipelineRequest, CreatePipelineOutcome> CodePipelineClient::CreatePipelineAwaitable(CreatePipelineRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::CreatePipeline, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, DeleteCustomActionTypeRequest, DeleteCustomActionTypeOutcome> CodePipelineClient::DeleteCustomActionTypeAwaitable(DeleteCustomActionTypeRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::DeleteCustomActionType, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, DeletePipelineRequest, DeletePipelineOutcome> CodePipelineClient::DeletePipelineAwaitable(DeletePipelineRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::DeletePipeline, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, DisableStageTransitionRequest, DisableStageTransitionOutcome> CodePipelineClient::DisableStageTransitionAwaitable(DisableStageTransitionRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::DisableStageTransition, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, EnableStageTransitionRequest, EnableStageTransitionOutcome> CodePipelineClient::EnableStageTransitionAwaitable(EnableStageTransitionRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::EnableStageTransition, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, GetJobDetailsRequest, GetJobDetailsOutcome> CodePipelineClient::GetJobDetailsAwaitable(GetJobDetailsRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::GetJobDetails, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, GetPipelineRequest, GetPipelineOutcome> CodePipelineClient::GetPipelineAwaitable(GetPipelineRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::GetPipeline, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, GetPipelineStateRequest, GetPipelineStateOutcome> CodePipelineClient::GetPipelineStateAwaitable(GetPipelineStateRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::GetPipelineState, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, GetThirdPartyJobDetailsRequest, GetThirdPartyJobDetailsOutcome> CodePipelineClient::GetThirdPartyJobDetailsAwaitable(GetThirdPartyJobDetailsRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::GetThirdPartyJobDetails, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, ListActionTypesRequest, ListActionTypesOutcome> CodePipelineClient::ListActionTypesAwaitable(ListActionTypesRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::ListActionTypes, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, ListPipelinesRequest, ListPipelinesOutcome> CodePipelineClient::ListPipelinesAwaitable(ListPipelinesRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::ListPipelines, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, PollForJobsRequest, PollForJobsOutcome> CodePipelineClient::PollForJobsAwaitable(PollForJobsRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::PollForJobs, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, PollForThirdPartyJobsRequest, PollForThirdPartyJobsOutcome> CodePipelineClient::PollForThirdPartyJobsAwaitable(PollForThirdPartyJobsRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::PollForThirdPartyJobs, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, PutActionRevisionRequest, PutActionRevisionOutcome> CodePipelineClient::PutActionRevisionAwaitable(PutActionRevisionRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::PutActionRevision, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, PutApprovalResultRequest, PutApprovalResultOutcome> CodePipelineClient::PutApprovalResultAwaitable(PutApprovalResultRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::PutApprovalResult, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, PutJobFailureResultRequest, PutJobFailureResultOutcome> CodePipelineClient::PutJobFailureResultAwaitable(PutJobFailureResultRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::PutJobFailureResult, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, PutJobSuccessResultRequest, PutJobSuccessResultOutcome> CodePipelineClient::PutJobSuccessResultAwaitable(PutJobSuccessResultRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::PutJobSuccessResult, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, PutThirdPartyJobFailureResultRequest, PutThirdPartyJobFailureResultOutcome> CodePipelineClient::PutThirdPartyJobFailureResultAwaitable(PutThirdPartyJobFailureResultRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::PutThirdPartyJobFailureResult, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, PutThirdPartyJobSuccessResultRequest, PutThirdPartyJobSuccessResultOutcome> CodePipelineClient::PutThirdPartyJobSuccessResultAwaitable(PutThirdPartyJobSuccessResultRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::PutThirdPartyJobSuccessResult, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, RetryStageExecutionRequest, RetryStageExecutionOutcome> CodePipelineClient::RetryStageExecutionAwaitable(RetryStageExecutionRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::RetryStageExecution, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, StartPipelineExecutionRequest, StartPipelineExecutionOutcome> CodePipelineClient::StartPipelineExecutionAwaitable(StartPipelineExecutionRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::StartPipelineExecution, std::move(request) } };
+}
+
+ClientOperationAwaitable<CodePipelineClient, UpdatePipelineRequest, UpdatePipelineOutcome> CodePipelineClient::UpdatePipelineAwaitable(UpdatePipelineRequest request) const
+{
+  return { m_executor.get(), { this, &CodePipelineClient::UpdatePipeline, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,41 +29,41 @@ namespace Aws
       namespace ActionCategoryMapper
       {
 
-        static const int Source_HASH = HashingUtils::HashString("Source");
-        static const int Build_HASH = HashingUtils::HashString("Build");
-        static const int Deploy_HASH = HashingUtils::HashString("Deploy");
-        static const int Test_HASH = HashingUtils::HashString("Test");
-        static const int Invoke_HASH = HashingUtils::HashString("Invoke");
-        static const int Approval_HASH = HashingUtils::HashString("Approval");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Source_HASH = -1812638661;
+        static const int Build_HASH = 64542286;
+        static const int Deploy_HASH = 2043501831;
+        static const int Test_HASH = 2603186;
+        static const int Invoke_HASH = -2099826536;
+        static const int Approval_HASH = 1249888867;
 
 
         ActionCategory GetActionCategoryForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Source_HASH)
+          switch (hashCode)
           {
+          case Source_HASH:
             return ActionCategory::Source;
-          }
-          else if (hashCode == Build_HASH)
-          {
+          case Build_HASH:
             return ActionCategory::Build;
-          }
-          else if (hashCode == Deploy_HASH)
-          {
+          case Deploy_HASH:
             return ActionCategory::Deploy;
-          }
-          else if (hashCode == Test_HASH)
-          {
+          case Test_HASH:
             return ActionCategory::Test;
-          }
-          else if (hashCode == Invoke_HASH)
-          {
+          case Invoke_HASH:
             return ActionCategory::Invoke;
-          }
-          else if (hashCode == Approval_HASH)
-          {
+          case Approval_HASH:
             return ActionCategory::Approval;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
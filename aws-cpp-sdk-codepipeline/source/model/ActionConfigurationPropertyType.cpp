@@ -29,26 +29,32 @@ namespace Aws
       namespace ActionConfigurationPropertyTypeMapper
       {
 
-        static const int String_HASH = HashingUtils::HashString("String");
-        static const int Number_HASH = HashingUtils::HashString("Number");
-        static const int Boolean_HASH = HashingUtils::HashString("Boolean");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int String_HASH = -1808118735;
+        static const int Number_HASH = -1950496919;
+        static const int Boolean_HASH = 1729365000;
 
 
         ActionConfigurationPropertyType GetActionConfigurationPropertyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == String_HASH)
+          switch (hashCode)
           {
+          case String_HASH:
             return ActionConfigurationPropertyType::String;
-          }
-          else if (hashCode == Number_HASH)
-          {
+          case Number_HASH:
             return ActionConfigurationPropertyType::Number;
-          }
-          else if (hashCode == Boolean_HASH)
-          {
+          case Boolean_HASH:
             return ActionConfigurationPropertyType::Boolean;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace ActionExecutionStatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int InProgress_HASH = 646453906;
+        static const int Succeeded_HASH = -1345265087;
+        static const int Failed_HASH = 2096857181;
 
 
         ActionExecutionStatus GetActionExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
+          switch (hashCode)
           {
+          case InProgress_HASH:
             return ActionExecutionStatus::InProgress;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
+          case Succeeded_HASH:
             return ActionExecutionStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return ActionExecutionStatus::Failed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
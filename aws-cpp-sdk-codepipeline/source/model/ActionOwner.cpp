@@ -29,26 +29,32 @@ namespace Aws
       namespace ActionOwnerMapper
       {
 
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
-        static const int ThirdParty_HASH = HashingUtils::HashString("ThirdParty");
-        static const int Custom_HASH = HashingUtils::HashString("Custom");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int AWS_HASH = 65245;
+        static const int ThirdParty_HASH = 1023527391;
+        static const int Custom_HASH = 2029746065;
 
 
         ActionOwner GetActionOwnerForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_HASH)
+          switch (hashCode)
           {
+          case AWS_HASH:
             return ActionOwner::AWS;
-          }
-          else if (hashCode == ThirdParty_HASH)
-          {
+          case ThirdParty_HASH:
             return ActionOwner::ThirdParty;
-          }
-          else if (hashCode == Custom_HASH)
-          {
+          case Custom_HASH:
             return ActionOwner::Custom;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace ApprovalStatusMapper
       {
 
-        static const int Approved_HASH = HashingUtils::HashString("Approved");
-        static const int Rejected_HASH = HashingUtils::HashString("Rejected");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Approved_HASH = 1249888983;
+        static const int Rejected_HASH = -543852386;
 
 
         ApprovalStatus GetApprovalStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Approved_HASH)
+          switch (hashCode)
           {
+          case Approved_HASH:
             return ApprovalStatus::Approved;
-          }
-          else if (hashCode == Rejected_HASH)
-          {
+          case Rejected_HASH:
             return ApprovalStatus::Rejected;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
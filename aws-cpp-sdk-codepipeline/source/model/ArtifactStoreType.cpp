@@ -29,16 +29,26 @@ namespace Aws
       namespace ArtifactStoreTypeMapper
       {
 
-        static const int S3_HASH = HashingUtils::HashString("S3");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int S3_HASH = 2624;
 
 
         ArtifactStoreType GetArtifactStoreTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == S3_HASH)
+          switch (hashCode)
           {
+          case S3_HASH:
             return ArtifactStoreType::S3;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace BlockerTypeMapper
       {
 
-        static const int Schedule_HASH = HashingUtils::HashString("Schedule");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Schedule_HASH = -633276745;
 
 
         BlockerType GetBlockerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Schedule_HASH)
+          switch (hashCode)
           {
+          case Schedule_HASH:
             return BlockerType::Schedule;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
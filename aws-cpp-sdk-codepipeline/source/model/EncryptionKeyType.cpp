@@ -29,16 +29,26 @@ namespace Aws
       namespace EncryptionKeyTypeMapper
       {
 
-        static const int KMS_HASH = HashingUtils::HashString("KMS");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int KMS_HASH = 74545;
 
 
         EncryptionKeyType GetEncryptionKeyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == KMS_HASH)
+          switch (hashCode)
           {
+          case KMS_HASH:
             return EncryptionKeyType::KMS;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,41 +29,41 @@ namespace Aws
       namespace FailureTypeMapper
       {
 
-        static const int JobFailed_HASH = HashingUtils::HashString("JobFailed");
-        static const int ConfigurationError_HASH = HashingUtils::HashString("ConfigurationError");
-        static const int PermissionError_HASH = HashingUtils::HashString("PermissionError");
-        static const int RevisionOutOfSync_HASH = HashingUtils::HashString("RevisionOutOfSync");
-        static const int RevisionUnavailable_HASH = HashingUtils::HashString("RevisionUnavailable");
-        static const int SystemUnavailable_HASH = HashingUtils::HashString("SystemUnavailable");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int JobFailed_HASH = -1551320518;
+        static const int ConfigurationError_HASH = -1671245102;
+        static const int PermissionError_HASH = 1652366681;
+        static const int RevisionOutOfSync_HASH = 2003800133;
+        static const int RevisionUnavailable_HASH = 397322581;
+        static const int SystemUnavailable_HASH = 388590209;
 
 
         FailureType GetFailureTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JobFailed_HASH)
+          switch (hashCode)
           {
+          case JobFailed_HASH:
             return FailureType::JobFailed;
-          }
-          else if (hashCode == ConfigurationError_HASH)
-          {
+          case ConfigurationError_HASH:
             return FailureType::ConfigurationError;
-          }
-          else if (hashCode == PermissionError_HASH)
-          {
+          case PermissionError_HASH:
             return FailureType::PermissionError;
-          }
-          else if (hashCode == RevisionOutOfSync_HASH)
-          {
+          case RevisionOutOfSync_HASH:
             return FailureType::RevisionOutOfSync;
-          }
-          else if (hashCode == RevisionUnavailable_HASH)
-          {
+          case RevisionUnavailable_HASH:
             return FailureType::RevisionUnavailable;
-          }
-          else if (hashCode == SystemUnavailable_HASH)
-          {
+          case SystemUnavailable_HASH:
             return FailureType::SystemUnavailable;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,46 +29,44 @@ namespace Aws
       namespace JobStatusMapper
       {
 
-        static const int Created_HASH = HashingUtils::HashString("Created");
-        static const int Queued_HASH = HashingUtils::HashString("Queued");
-        static const int Dispatched_HASH = HashingUtils::HashString("Dispatched");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int TimedOut_HASH = HashingUtils::HashString("TimedOut");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Created_HASH = -1601759544;
+        static const int Queued_HASH = -1864829549;
+        static const int Dispatched_HASH = 780924601;
+        static const int InProgress_HASH = 646453906;
+        static const int TimedOut_HASH = -2012269385;
+        static const int Succeeded_HASH = -1345265087;
+        static const int Failed_HASH = 2096857181;
 
 
         JobStatus GetJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Created_HASH)
+          switch (hashCode)
           {
+          case Created_HASH:
             return JobStatus::Created;
-          }
-          else if (hashCode == Queued_HASH)
-          {
+          case Queued_HASH:
             return JobStatus::Queued;
-          }
-          else if (hashCode == Dispatched_HASH)
-          {
+          case Dispatched_HASH:
             return JobStatus::Dispatched;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
+          case InProgress_HASH:
             return JobStatus::InProgress;
-          }
-          else if (hashCode == TimedOut_HASH)
-          {
+          case TimedOut_HASH:
             return JobStatus::TimedOut;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
+          case Succeeded_HASH:
             return JobStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return JobStatus::Failed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
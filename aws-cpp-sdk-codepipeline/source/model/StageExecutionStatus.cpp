@@ -29,26 +29,32 @@ namespace Aws
       namespace StageExecutionStatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int InProgress_HASH = 646453906;
+        static const int Failed_HASH = 2096857181;
+        static const int Succeeded_HASH = -1345265087;
 
 
         StageExecutionStatus GetStageExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
+          switch (hashCode)
           {
+          case InProgress_HASH:
             return StageExecutionStatus::InProgress;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return StageExecutionStatus::Failed;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
+          case Succeeded_HASH:
             return StageExecutionStatus::Succeeded;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace StageRetryModeMapper
       {
 
-        static const int FAILED_ACTIONS_HASH = HashingUtils::HashString("FAILED_ACTIONS");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int FAILED_ACTIONS_HASH = 1670084315;
 
 
         StageRetryMode GetStageRetryModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FAILED_ACTIONS_HASH)
+          switch (hashCode)
           {
+          case FAILED_ACTIONS_HASH:
             return StageRetryMode::FAILED_ACTIONS;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
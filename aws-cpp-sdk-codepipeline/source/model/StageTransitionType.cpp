@@ -29,21 +29,29 @@ namespace Aws
       namespace StageTransitionTypeMapper
       {
 
-        static const int Inbound_HASH = HashingUtils::HashString("Inbound");
-        static const int Outbound_HASH = HashingUtils::HashString("Outbound");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Inbound_HASH = -688573607;
+        static const int Outbound_HASH = 121720592;
 
 
         StageTransitionType GetStageTransitionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Inbound_HASH)
+          switch (hashCode)
           {
+          case Inbound_HASH:
             return StageTransitionType::Inbound;
-          }
-          else if (hashCode == Outbound_HASH)
-          {
+          case Outbound_HASH:
             return StageTransitionType::Outbound;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
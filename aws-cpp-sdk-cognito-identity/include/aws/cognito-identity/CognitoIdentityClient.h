@@ -36,6 +36,9 @@
 #include <aws/cognito-identity/model/UpdateIdentityPoolResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -258,6 +261,18 @@ namespace Model
          */
         virtual void CreateIdentityPoolAsync(const Model::CreateIdentityPoolRequest& request, const CreateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateIdentityPoolCallable(const Model::CreateIdentityPoolRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateIdentityPoolOutcomeCallable CreateIdentityPoolCallable(Model::CreateIdentityPoolRequest&& request) const;
+
+        /**
+         * Same as CreateIdentityPoolAsync(const Model::CreateIdentityPoolRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateIdentityPoolAsync(Model::CreateIdentityPoolRequest&& request, const CreateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes identities from an identity pool. You can specify a list of 1-60
          * identities that you want to delete.</p><p>You must use AWS Developer credentials
@@ -283,6 +298,18 @@ namespace Model
          */
         virtual void DeleteIdentitiesAsync(const Model::DeleteIdentitiesRequest& request, const DeleteIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIdentitiesCallable(const Model::DeleteIdentitiesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteIdentitiesOutcomeCallable DeleteIdentitiesCallable(Model::DeleteIdentitiesRequest&& request) const;
+
+        /**
+         * Same as DeleteIdentitiesAsync(const Model::DeleteIdentitiesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteIdentitiesAsync(Model::DeleteIdentitiesRequest&& request, const DeleteIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a user pool. Once a pool is deleted, users will not be able to
          * authenticate with the pool.</p><p>You must use AWS Developer credentials to call
@@ -308,6 +335,18 @@ namespace Model
          */
         virtual void DeleteIdentityPoolAsync(const Model::DeleteIdentityPoolRequest& request, const DeleteIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIdentityPoolCallable(const Model::DeleteIdentityPoolRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteIdentityPoolOutcomeCallable DeleteIdentityPoolCallable(Model::DeleteIdentityPoolRequest&& request) const;
+
+        /**
+         * Same as DeleteIdentityPoolAsync(const Model::DeleteIdentityPoolRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteIdentityPoolAsync(Model::DeleteIdentityPoolRequest&& request, const DeleteIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns metadata related to the given identity, including when the identity
          * was created and any associated linked logins.</p><p>You must use AWS Developer
@@ -333,6 +372,18 @@ namespace Model
          */
         virtual void DescribeIdentityAsync(const Model::DescribeIdentityRequest& request, const DescribeIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeIdentityCallable(const Model::DescribeIdentityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeIdentityOutcomeCallable DescribeIdentityCallable(Model::DescribeIdentityRequest&& request) const;
+
+        /**
+         * Same as DescribeIdentityAsync(const Model::DescribeIdentityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeIdentityAsync(Model::DescribeIdentityRequest&& request, const DescribeIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets details about a particular identity pool, including the pool name, ID
          * description, creation date, and current number of users.</p><p>You must use AWS
@@ -358,6 +409,18 @@ namespace Model
          */
         virtual void DescribeIdentityPoolAsync(const Model::DescribeIdentityPoolRequest& request, const DescribeIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeIdentityPoolCallable(const Model::DescribeIdentityPoolRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeIdentityPoolOutcomeCallable DescribeIdentityPoolCallable(Model::DescribeIdentityPoolRequest&& request) const;
+
+        /**
+         * Same as DescribeIdentityPoolAsync(const Model::DescribeIdentityPoolRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeIdentityPoolAsync(Model::DescribeIdentityPoolRequest&& request, const DescribeIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns credentials for the provided identity ID. Any provided logins will be
          * validated against supported login providers. If the token is for
@@ -389,6 +452,18 @@ namespace Model
          */
         virtual void GetCredentialsForIdentityAsync(const Model::GetCredentialsForIdentityRequest& request, const GetCredentialsForIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCredentialsForIdentityCallable(const Model::GetCredentialsForIdentityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetCredentialsForIdentityOutcomeCallable GetCredentialsForIdentityCallable(Model::GetCredentialsForIdentityRequest&& request) const;
+
+        /**
+         * Same as GetCredentialsForIdentityAsync(const Model::GetCredentialsForIdentityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetCredentialsForIdentityAsync(Model::GetCredentialsForIdentityRequest&& request, const GetCredentialsForIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates (or retrieves) a Cognito ID. Supplying multiple logins will create
          * an implicit linked account.</p><p>This is a public API. You do not need any
@@ -414,6 +489,18 @@ namespace Model
          */
         virtual void GetIdAsync(const Model::GetIdRequest& request, const GetIdResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIdCallable(const Model::GetIdRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetIdOutcomeCallable GetIdCallable(Model::GetIdRequest&& request) const;
+
+        /**
+         * Same as GetIdAsync(const Model::GetIdRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetIdAsync(Model::GetIdRequest&& request, const GetIdResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the roles for an identity pool.</p><p>You must use AWS Developer
          * credentials to call this API.</p>
@@ -436,6 +523,18 @@ namespace Model
          */
         virtual void GetIdentityPoolRolesAsync(const Model::GetIdentityPoolRolesRequest& request, const GetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIdentityPoolRolesCallable(const Model::GetIdentityPoolRolesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetIdentityPoolRolesOutcomeCallable GetIdentityPoolRolesCallable(Model::GetIdentityPoolRolesRequest&& request) const;
+
+        /**
+         * Same as GetIdentityPoolRolesAsync(const Model::GetIdentityPoolRolesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetIdentityPoolRolesAsync(Model::GetIdentityPoolRolesRequest&& request, const GetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets an OpenID token, using a known Cognito ID. This known Cognito ID is
          * returned by <a>GetId</a>. You can optionally add additional logins for the
@@ -467,6 +566,18 @@ namespace Model
          */
         virtual void GetOpenIdTokenAsync(const Model::GetOpenIdTokenRequest& request, const GetOpenIdTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetOpenIdTokenCallable(const Model::GetOpenIdTokenRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetOpenIdTokenOutcomeCallable GetOpenIdTokenCallable(Model::GetOpenIdTokenRequest&& request) const;
+
+        /**
+         * Same as GetOpenIdTokenAsync(const Model::GetOpenIdTokenRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetOpenIdTokenAsync(Model::GetOpenIdTokenRequest&& request, const GetOpenIdTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers (or retrieves) a Cognito <code>IdentityId</code> and an OpenID
          * Connect token for a user authenticated by your backend authentication process.
@@ -525,6 +636,18 @@ namespace Model
          */
         virtual void GetOpenIdTokenForDeveloperIdentityAsync(const Model::GetOpenIdTokenForDeveloperIdentityRequest& request, const GetOpenIdTokenForDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetOpenIdTokenForDeveloperIdentityCallable(const Model::GetOpenIdTokenForDeveloperIdentityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetOpenIdTokenForDeveloperIdentityOutcomeCallable GetOpenIdTokenForDeveloperIdentityCallable(Model::GetOpenIdTokenForDeveloperIdentityRequest&& request) const;
+
+        /**
+         * Same as GetOpenIdTokenForDeveloperIdentityAsync(const Model::GetOpenIdTokenForDeveloperIdentityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetOpenIdTokenForDeveloperIdentityAsync(Model::GetOpenIdTokenForDeveloperIdentityRequest&& request, const GetOpenIdTokenForDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the identities in a pool.</p><p>You must use AWS Developer credentials
          * to call this API.</p>
@@ -547,6 +670,18 @@ namespace Model
          */
         virtual void ListIdentitiesAsync(const Model::ListIdentitiesRequest& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListIdentitiesCallable(const Model::ListIdentitiesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListIdentitiesOutcomeCallable ListIdentitiesCallable(Model::ListIdentitiesRequest&& request) const;
+
+        /**
+         * Same as ListIdentitiesAsync(const Model::ListIdentitiesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListIdentitiesAsync(Model::ListIdentitiesRequest&& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all of the Cognito identity pools registered for your
          * account.</p><p>You must use AWS Developer credentials to call this API.</p>
@@ -569,6 +704,18 @@ namespace Model
          */
         virtual void ListIdentityPoolsAsync(const Model::ListIdentityPoolsRequest& request, const ListIdentityPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListIdentityPoolsCallable(const Model::ListIdentityPoolsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListIdentityPoolsOutcomeCallable ListIdentityPoolsCallable(Model::ListIdentityPoolsRequest&& request) const;
+
+        /**
+         * Same as ListIdentityPoolsAsync(const Model::ListIdentityPoolsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListIdentityPoolsAsync(Model::ListIdentityPoolsRequest&& request, const ListIdentityPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the <code>IdentityID</code> associated with a
          * <code>DeveloperUserIdentifier</code> or the list of
@@ -618,6 +765,18 @@ namespace Model
          */
         virtual void LookupDeveloperIdentityAsync(const Model::LookupDeveloperIdentityRequest& request, const LookupDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as LookupDeveloperIdentityCallable(const Model::LookupDeveloperIdentityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::LookupDeveloperIdentityOutcomeCallable LookupDeveloperIdentityCallable(Model::LookupDeveloperIdentityRequest&& request) const;
+
+        /**
+         * Same as LookupDeveloperIdentityAsync(const Model::LookupDeveloperIdentityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void LookupDeveloperIdentityAsync(Model::LookupDeveloperIdentityRequest&& request, const LookupDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Merges two users having different <code>IdentityId</code>s, existing in the
          * same identity pool, and identified by the same developer provider. You can use
@@ -661,6 +820,18 @@ namespace Model
          */
         virtual void MergeDeveloperIdentitiesAsync(const Model::MergeDeveloperIdentitiesRequest& request, const MergeDeveloperIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as MergeDeveloperIdentitiesCallable(const Model::MergeDeveloperIdentitiesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::MergeDeveloperIdentitiesOutcomeCallable MergeDeveloperIdentitiesCallable(Model::MergeDeveloperIdentitiesRequest&& request) const;
+
+        /**
+         * Same as MergeDeveloperIdentitiesAsync(const Model::MergeDeveloperIdentitiesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void MergeDeveloperIdentitiesAsync(Model::MergeDeveloperIdentitiesRequest&& request, const MergeDeveloperIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the roles for an identity pool. These roles are used when making calls
          * to <code>GetCredentialsForIdentity</code> action.</p><p>You must use AWS
@@ -686,6 +857,18 @@ namespace Model
          */
         virtual void SetIdentityPoolRolesAsync(const Model::SetIdentityPoolRolesRequest& request, const SetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetIdentityPoolRolesCallable(const Model::SetIdentityPoolRolesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetIdentityPoolRolesOutcomeCallable SetIdentityPoolRolesCallable(Model::SetIdentityPoolRolesRequest&& request) const;
+
+        /**
+         * Same as SetIdentityPoolRolesAsync(const Model::SetIdentityPoolRolesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetIdentityPoolRolesAsync(Model::SetIdentityPoolRolesRequest&& request, const SetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Unlinks a <code>DeveloperUserIdentifier</code> from an existing identity.
          * Unlinked developer users will be considered new identities next time they are
@@ -717,6 +900,18 @@ namespace Model
          */
         virtual void UnlinkDeveloperIdentityAsync(const Model::UnlinkDeveloperIdentityRequest& request, const UnlinkDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnlinkDeveloperIdentityCallable(const Model::UnlinkDeveloperIdentityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UnlinkDeveloperIdentityOutcomeCallable UnlinkDeveloperIdentityCallable(Model::UnlinkDeveloperIdentityRequest&& request) const;
+
+        /**
+         * Same as UnlinkDeveloperIdentityAsync(const Model::UnlinkDeveloperIdentityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UnlinkDeveloperIdentityAsync(Model::UnlinkDeveloperIdentityRequest&& request, const UnlinkDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Unlinks a federated identity from an existing account. Unlinked logins will
          * be considered new identities next time they are seen. Removing the last linked
@@ -745,6 +940,18 @@ namespace Model
          */
         virtual void UnlinkIdentityAsync(const Model::UnlinkIdentityRequest& request, const UnlinkIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnlinkIdentityCallable(const Model::UnlinkIdentityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UnlinkIdentityOutcomeCallable UnlinkIdentityCallable(Model::UnlinkIdentityRequest&& request) const;
+
+        /**
+         * Same as UnlinkIdentityAsync(const Model::UnlinkIdentityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UnlinkIdentityAsync(Model::UnlinkIdentityRequest&& request, const UnlinkIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a user pool.</p><p>You must use AWS Developer credentials to call
          * this API.</p>
@@ -767,6 +974,125 @@ namespace Model
          */
         virtual void UpdateIdentityPoolAsync(const Model::UpdateIdentityPoolRequest& request, const UpdateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateIdentityPoolCallable(const Model::UpdateIdentityPoolRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateIdentityPoolOutcomeCallable UpdateIdentityPoolCallable(Model::UpdateIdentityPoolRequest&& request) const;
+
+        /**
+         * Same as UpdateIdentityPoolAsync(const Model::UpdateIdentityPoolRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateIdentityPoolAsync(Model::UpdateIdentityPoolRequest&& request, const UpdateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListIdentities(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CognitoIdentityClient, Model::ListIdentitiesRequest, Model::ListIdentitiesOutcome> ListIdentitiesPaginator(const Model::ListIdentitiesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListIdentityPools(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CognitoIdentityClient, Model::ListIdentityPoolsRequest, Model::ListIdentityPoolsOutcome> ListIdentityPoolsPaginator(const Model::ListIdentityPoolsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through LookupDeveloperIdentity(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CognitoIdentityClient, Model::LookupDeveloperIdentityRequest, Model::LookupDeveloperIdentityOutcome> LookupDeveloperIdentityPaginator(const Model::LookupDeveloperIdentityRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CreateIdentityPool(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::CreateIdentityPoolRequest, Model::CreateIdentityPoolOutcome> CreateIdentityPoolAwaitable(Model::CreateIdentityPoolRequest request) const;
+
+        /**
+         * co_await-able form of DeleteIdentities(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::DeleteIdentitiesRequest, Model::DeleteIdentitiesOutcome> DeleteIdentitiesAwaitable(Model::DeleteIdentitiesRequest request) const;
+
+        /**
+         * co_await-able form of DeleteIdentityPool(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::DeleteIdentityPoolRequest, Model::DeleteIdentityPoolOutcome> DeleteIdentityPoolAwaitable(Model::DeleteIdentityPoolRequest request) const;
+
+        /**
+         * co_await-able form of DescribeIdentity(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::DescribeIdentityRequest, Model::DescribeIdentityOutcome> DescribeIdentityAwaitable(Model::DescribeIdentityRequest request) const;
+
+        /**
+         * co_await-able form of DescribeIdentityPool(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::DescribeIdentityPoolRequest, Model::DescribeIdentityPoolOutcome> DescribeIdentityPoolAwaitable(Model::DescribeIdentityPoolRequest request) const;
+
+        /**
+         * co_await-able form of GetCredentialsForIdentity(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::GetCredentialsForIdentityRequest, Model::GetCredentialsForIdentityOutcome> GetCredentialsForIdentityAwaitable(Model::GetCredentialsForIdentityRequest request) const;
+
+        /**
+         * co_await-able form of GetId(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::GetIdRequest, Model::GetIdOutcome> GetIdAwaitable(Model::GetIdRequest request) const;
+
+        /**
+         * co_await-able form of GetIdentityPoolRoles(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::GetIdentityPoolRolesRequest, Model::GetIdentityPoolRolesOutcome> GetIdentityPoolRolesAwaitable(Model::GetIdentityPoolRolesRequest request) const;
+
+        /**
+         * co_await-able form of GetOpenIdToken(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::GetOpenIdTokenRequest, Model::GetOpenIdTokenOutcome> GetOpenIdTokenAwaitable(Model::GetOpenIdTokenRequest request) const;
+
+        /**
+         * co_await-able form of GetOpenIdTokenForDeveloperIdentity(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::GetOpenIdTokenForDeveloperIdentityRequest, Model::GetOpenIdTokenForDeveloperIdentityOutcome> GetOpenIdTokenForDeveloperIdentityAwaitable(Model::GetOpenIdTokenForDeveloperIdentityRequest request) const;
+
+        /**
+         * co_await-able form of ListIdentities(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::ListIdentitiesRequest, Model::ListIdentitiesOutcome> ListIdentitiesAwaitable(Model::ListIdentitiesRequest request) const;
+
+        /**
+         * co_await-able form of ListIdentityPools(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::ListIdentityPoolsRequest, Model::ListIdentityPoolsOutcome> ListIdentityPoolsAwaitable(Model::ListIdentityPoolsRequest request) const;
+
+        /**
+         * co_await-able form of LookupDeveloperIdentity(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::LookupDeveloperIdentityRequest, Model::LookupDeveloperIdentityOutcome> LookupDeveloperIdentityAwaitable(Model::LookupDeveloperIdentityRequest request) const;
+
+        /**
+         * co_await-able form of MergeDeveloperIdentities(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::MergeDeveloperIdentitiesRequest, Model::MergeDeveloperIdentitiesOutcome> MergeDeveloperIdentitiesAwaitable(Model::MergeDeveloperIdentitiesRequest request) const;
+
+        /**
+         * co_await-able form of SetIdentityPoolRoles(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::SetIdentityPoolRolesRequest, Model::SetIdentityPoolRolesOutcome> SetIdentityPoolRolesAwaitable(Model::SetIdentityPoolRolesRequest request) const;
+
+        /**
+         * co_await-able form of UnlinkDeveloperIdentity(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::UnlinkDeveloperIdentityRequest, Model::UnlinkDeveloperIdentityOutcome> UnlinkDeveloperIdentityAwaitable(Model::UnlinkDeveloperIdentityRequest request) const;
+
+        /**
+         * co_await-able form of UnlinkIdentity(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::UnlinkIdentityRequest, Model::UnlinkIdentityOutcome> UnlinkIdentityAwaitable(Model::UnlinkIdentityRequest request) const;
+
+        /**
+         * co_await-able form of UpdateIdentityPool(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityClient, Model::UpdateIdentityPoolRequest, Model::UpdateIdentityPoolOutcome> UpdateIdentityPoolAwaitable(Model::UpdateIdentityPoolRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateIdentityPoolRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateIdentityPool"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
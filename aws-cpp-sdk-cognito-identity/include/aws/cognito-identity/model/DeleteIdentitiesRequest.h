@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteIdentitiesRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteIdentities"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
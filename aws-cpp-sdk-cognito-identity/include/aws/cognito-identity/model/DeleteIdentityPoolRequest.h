@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteIdentityPoolRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteIdentityPool"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeIdentityPoolRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeIdentityPool"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeIdentityRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeIdentity"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
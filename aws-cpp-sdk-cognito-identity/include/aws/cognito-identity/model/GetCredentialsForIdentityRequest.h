@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetCredentialsForIdentityRequest();
+    inline const char* GetServiceRequestName() const override { return "GetCredentialsForIdentity"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetIdRequest();
+    inline const char* GetServiceRequestName() const override { return "GetId"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
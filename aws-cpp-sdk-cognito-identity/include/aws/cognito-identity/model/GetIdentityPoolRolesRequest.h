@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetIdentityPoolRolesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetIdentityPoolRoles"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
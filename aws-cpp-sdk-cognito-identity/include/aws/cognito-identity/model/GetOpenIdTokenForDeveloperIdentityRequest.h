@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetOpenIdTokenForDeveloperIdentityRequest();
+    inline const char* GetServiceRequestName() const override { return "GetOpenIdTokenForDeveloperIdentity"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
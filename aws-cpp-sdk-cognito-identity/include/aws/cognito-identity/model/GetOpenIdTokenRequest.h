@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetOpenIdTokenRequest();
+    inline const char* GetServiceRequestName() const override { return "GetOpenIdToken"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
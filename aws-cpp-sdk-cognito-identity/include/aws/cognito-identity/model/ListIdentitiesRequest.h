@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListIdentitiesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListIdentities"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
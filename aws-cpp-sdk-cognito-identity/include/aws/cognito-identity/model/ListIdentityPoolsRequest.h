@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListIdentityPoolsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListIdentityPools"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     LookupDeveloperIdentityRequest();
+    inline const char* GetServiceRequestName() const override { return "LookupDeveloperIdentity"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
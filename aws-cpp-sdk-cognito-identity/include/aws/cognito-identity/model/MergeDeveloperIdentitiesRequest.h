@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     MergeDeveloperIdentitiesRequest();
+    inline const char* GetServiceRequestName() const override { return "MergeDeveloperIdentities"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetIdentityPoolRolesRequest();
+    inline const char* GetServiceRequestName() const override { return "SetIdentityPoolRoles"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
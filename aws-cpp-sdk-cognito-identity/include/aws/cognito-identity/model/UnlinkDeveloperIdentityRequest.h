@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UnlinkDeveloperIdentityRequest();
+    inline const char* GetServiceRequestName() const override { return "UnlinkDeveloperIdentity"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
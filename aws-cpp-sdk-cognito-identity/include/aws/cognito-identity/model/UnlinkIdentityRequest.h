@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UnlinkIdentityRequest();
+    inline const char* GetServiceRequestName() const override { return "UnlinkIdentity"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
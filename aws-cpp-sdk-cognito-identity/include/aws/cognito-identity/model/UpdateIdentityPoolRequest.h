@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     UpdateIdentityPoolRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateIdentityPool"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
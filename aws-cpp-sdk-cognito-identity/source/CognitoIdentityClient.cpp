@@ -127,7 +127,7 @@ CreateIdentityPoolOutcome CognitoIdentityClient::CreateIdentityPool(const Create
 
 CreateIdentityPoolOutcomeCallable CognitoIdentityClient::CreateIdentityPoolCallable(const CreateIdentityPoolRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateIdentityPool(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateIdentityPool(request); } );
 }
 
 void CognitoIdentityClient::CreateIdentityPoolAsync(const CreateIdentityPoolRequest& request, const CreateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -135,6 +135,16 @@ void CognitoIdentityClient::CreateIdentityPoolAsync(const CreateIdentityPoolRequ
   m_executor->Submit( [this, request, handler, context](){ this->CreateIdentityPoolAsyncHelper( request, handler, context ); } );
 }
 
+CreateIdentityPoolOutcomeCallable CognitoIdentityClient::CreateIdentityPoolCallable(CreateIdentityPoolRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::CreateIdentityPool, this, std::move(request)));
+}
+
+void CognitoIdentityClient::CreateIdentityPoolAsync(CreateIdentityPoolRequest&& request, const CreateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::CreateIdentityPoolAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::CreateIdentityPoolAsyncHelper(const CreateIdentityPoolRequest& request, const CreateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateIdentityPool(request), context);
@@ -158,7 +168,7 @@ DeleteIdentitiesOutcome CognitoIdentityClient::DeleteIdentities(const DeleteIden
 
 DeleteIdentitiesOutcomeCallable CognitoIdentityClient::DeleteIdentitiesCallable(const DeleteIdentitiesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteIdentities(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteIdentities(request); } );
 }
 
 void CognitoIdentityClient::DeleteIdentitiesAsync(const DeleteIdentitiesRequest& request, const DeleteIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -166,6 +176,16 @@ void CognitoIdentityClient::DeleteIdentitiesAsync(const DeleteIdentitiesRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DeleteIdentitiesAsyncHelper( request, handler, context ); } );
 }
 
+DeleteIdentitiesOutcomeCallable CognitoIdentityClient::DeleteIdentitiesCallable(DeleteIdentitiesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::DeleteIdentities, this, std::move(request)));
+}
+
+void CognitoIdentityClient::DeleteIdentitiesAsync(DeleteIdentitiesRequest&& request, const DeleteIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::DeleteIdentitiesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::DeleteIdentitiesAsyncHelper(const DeleteIdentitiesRequest& request, const DeleteIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteIdentities(request), context);
@@ -189,7 +209,7 @@ DeleteIdentityPoolOutcome CognitoIdentityClient::DeleteIdentityPool(const Delete
 
 DeleteIdentityPoolOutcomeCallable CognitoIdentityClient::DeleteIdentityPoolCallable(const DeleteIdentityPoolRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteIdentityPool(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteIdentityPool(request); } );
 }
 
 void CognitoIdentityClient::DeleteIdentityPoolAsync(const DeleteIdentityPoolRequest& request, const DeleteIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -197,6 +217,16 @@ void CognitoIdentityClient::DeleteIdentityPoolAsync(const DeleteIdentityPoolRequ
   m_executor->Submit( [this, request, handler, context](){ this->DeleteIdentityPoolAsyncHelper( request, handler, context ); } );
 }
 
+DeleteIdentityPoolOutcomeCallable CognitoIdentityClient::DeleteIdentityPoolCallable(DeleteIdentityPoolRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::DeleteIdentityPool, this, std::move(request)));
+}
+
+void CognitoIdentityClient::DeleteIdentityPoolAsync(DeleteIdentityPoolRequest&& request, const DeleteIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::DeleteIdentityPoolAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::DeleteIdentityPoolAsyncHelper(const DeleteIdentityPoolRequest& request, const DeleteIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteIdentityPool(request), context);
@@ -220,7 +250,7 @@ DescribeIdentityOutcome CognitoIdentityClient::DescribeIdentity(const DescribeId
 
 DescribeIdentityOutcomeCallable CognitoIdentityClient::DescribeIdentityCallable(const DescribeIdentityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeIdentity(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeIdentity(request); } );
 }
 
 void CognitoIdentityClient::DescribeIdentityAsync(const DescribeIdentityRequest& request, const DescribeIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -228,6 +258,16 @@ void CognitoIdentityClient::DescribeIdentityAsync(const DescribeIdentityRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeIdentityAsyncHelper( request, handler, context ); } );
 }
 
+DescribeIdentityOutcomeCallable CognitoIdentityClient::DescribeIdentityCallable(DescribeIdentityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::DescribeIdentity, this, std::move(request)));
+}
+
+void CognitoIdentityClient::DescribeIdentityAsync(DescribeIdentityRequest&& request, const DescribeIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::DescribeIdentityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::DescribeIdentityAsyncHelper(const DescribeIdentityRequest& request, const DescribeIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeIdentity(request), context);
@@ -251,7 +291,7 @@ DescribeIdentityPoolOutcome CognitoIdentityClient::DescribeIdentityPool(const De
 
 DescribeIdentityPoolOutcomeCallable CognitoIdentityClient::DescribeIdentityPoolCallable(const DescribeIdentityPoolRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeIdentityPool(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeIdentityPool(request); } );
 }
 
 void CognitoIdentityClient::DescribeIdentityPoolAsync(const DescribeIdentityPoolRequest& request, const DescribeIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -259,6 +299,16 @@ void CognitoIdentityClient::DescribeIdentityPoolAsync(const DescribeIdentityPool
   m_executor->Submit( [this, request, handler, context](){ this->DescribeIdentityPoolAsyncHelper( request, handler, context ); } );
 }
 
+DescribeIdentityPoolOutcomeCallable CognitoIdentityClient::DescribeIdentityPoolCallable(DescribeIdentityPoolRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::DescribeIdentityPool, this, std::move(request)));
+}
+
+void CognitoIdentityClient::DescribeIdentityPoolAsync(DescribeIdentityPoolRequest&& request, const DescribeIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::DescribeIdentityPoolAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::DescribeIdentityPoolAsyncHelper(const DescribeIdentityPoolRequest& request, const DescribeIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeIdentityPool(request), context);
@@ -282,7 +332,7 @@ GetCredentialsForIdentityOutcome CognitoIdentityClient::GetCredentialsForIdentit
 
 GetCredentialsForIdentityOutcomeCallable CognitoIdentityClient::GetCredentialsForIdentityCallable(const GetCredentialsForIdentityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetCredentialsForIdentity(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetCredentialsForIdentity(request); } );
 }
 
 void CognitoIdentityClient::GetCredentialsForIdentityAsync(const GetCredentialsForIdentityRequest& request, const GetCredentialsForIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -290,6 +340,16 @@ void CognitoIdentityClient::GetCredentialsForIdentityAsync(const GetCredentialsF
   m_executor->Submit( [this, request, handler, context](){ this->GetCredentialsForIdentityAsyncHelper( request, handler, context ); } );
 }
 
+GetCredentialsForIdentityOutcomeCallable CognitoIdentityClient::GetCredentialsForIdentityCallable(GetCredentialsForIdentityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::GetCredentialsForIdentity, this, std::move(request)));
+}
+
+void CognitoIdentityClient::GetCredentialsForIdentityAsync(GetCredentialsForIdentityRequest&& request, const GetCredentialsForIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::GetCredentialsForIdentityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::GetCredentialsForIdentityAsyncHelper(const GetCredentialsForIdentityRequest& request, const GetCredentialsForIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetCredentialsForIdentity(request), context);
@@ -313,7 +373,7 @@ GetIdOutcome CognitoIdentityClient::GetId(const GetIdRequest& request) const
 
 GetIdOutcomeCallable CognitoIdentityClient::GetIdCallable(const GetIdRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetId(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetId(request); } );
 }
 
 void CognitoIdentityClient::GetIdAsync(const GetIdRequest& request, const GetIdResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -321,6 +381,16 @@ void CognitoIdentityClient::GetIdAsync(const GetIdRequest& request, const GetIdR
   m_executor->Submit( [this, request, handler, context](){ this->GetIdAsyncHelper( request, handler, context ); } );
 }
 
+GetIdOutcomeCallable CognitoIdentityClient::GetIdCallable(GetIdRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::GetId, this, std::move(request)));
+}
+
+void CognitoIdentityClient::GetIdAsync(GetIdRequest&& request, const GetIdResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::GetIdAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::GetIdAsyncHelper(const GetIdRequest& request, const GetIdResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetId(request), context);
@@ -344,7 +414,7 @@ GetIdentityPoolRolesOutcome CognitoIdentityClient::GetIdentityPoolRoles(const Ge
 
 GetIdentityPoolRolesOutcomeCallable CognitoIdentityClient::GetIdentityPoolRolesCallable(const GetIdentityPoolRolesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetIdentityPoolRoles(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetIdentityPoolRoles(request); } );
 }
 
 void CognitoIdentityClient::GetIdentityPoolRolesAsync(const GetIdentityPoolRolesRequest& request, const GetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -352,6 +422,16 @@ void CognitoIdentityClient::GetIdentityPoolRolesAsync(const GetIdentityPoolRoles
   m_executor->Submit( [this, request, handler, context](){ this->GetIdentityPoolRolesAsyncHelper( request, handler, context ); } );
 }
 
+GetIdentityPoolRolesOutcomeCallable CognitoIdentityClient::GetIdentityPoolRolesCallable(GetIdentityPoolRolesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::GetIdentityPoolRoles, this, std::move(request)));
+}
+
+void CognitoIdentityClient::GetIdentityPoolRolesAsync(GetIdentityPoolRolesRequest&& request, const GetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::GetIdentityPoolRolesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::GetIdentityPoolRolesAsyncHelper(const GetIdentityPoolRolesRequest& request, const GetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetIdentityPoolRoles(request), context);
@@ -375,7 +455,7 @@ GetOpenIdTokenOutcome CognitoIdentityClient::GetOpenIdToken(const GetOpenIdToken
 
 GetOpenIdTokenOutcomeCallable CognitoIdentityClient::GetOpenIdTokenCallable(const GetOpenIdTokenRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetOpenIdToken(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetOpenIdToken(request); } );
 }
 
 void CognitoIdentityClient::GetOpenIdTokenAsync(const GetOpenIdTokenRequest& request, const GetOpenIdTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -383,6 +463,16 @@ void CognitoIdentityClient::GetOpenIdTokenAsync(const GetOpenIdTokenRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->GetOpenIdTokenAsyncHelper( request, handler, context ); } );
 }
 
+GetOpenIdTokenOutcomeCallable CognitoIdentityClient::GetOpenIdTokenCallable(GetOpenIdTokenRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::GetOpenIdToken, this, std::move(request)));
+}
+
+void CognitoIdentityClient::GetOpenIdTokenAsync(GetOpenIdTokenRequest&& request, const GetOpenIdTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::GetOpenIdTokenAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::GetOpenIdTokenAsyncHelper(const GetOpenIdTokenRequest& request, const GetOpenIdTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetOpenIdToken(request), context);
@@ -406,7 +496,7 @@ GetOpenIdTokenForDeveloperIdentityOutcome CognitoIdentityClient::GetOpenIdTokenF
 
 GetOpenIdTokenForDeveloperIdentityOutcomeCallable CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityCallable(const GetOpenIdTokenForDeveloperIdentityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetOpenIdTokenForDeveloperIdentity(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetOpenIdTokenForDeveloperIdentity(request); } );
 }
 
 void CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityAsync(const GetOpenIdTokenForDeveloperIdentityRequest& request, const GetOpenIdTokenForDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -414,6 +504,16 @@ void CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityAsync(const GetOpe
   m_executor->Submit( [this, request, handler, context](){ this->GetOpenIdTokenForDeveloperIdentityAsyncHelper( request, handler, context ); } );
 }
 
+GetOpenIdTokenForDeveloperIdentityOutcomeCallable CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityCallable(GetOpenIdTokenForDeveloperIdentityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentity, this, std::move(request)));
+}
+
+void CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityAsync(GetOpenIdTokenForDeveloperIdentityRequest&& request, const GetOpenIdTokenForDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityAsyncHelper(const GetOpenIdTokenForDeveloperIdentityRequest& request, const GetOpenIdTokenForDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetOpenIdTokenForDeveloperIdentity(request), context);
@@ -437,7 +537,7 @@ ListIdentitiesOutcome CognitoIdentityClient::ListIdentities(const ListIdentities
 
 ListIdentitiesOutcomeCallable CognitoIdentityClient::ListIdentitiesCallable(const ListIdentitiesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListIdentities(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListIdentities(request); } );
 }
 
 void CognitoIdentityClient::ListIdentitiesAsync(const ListIdentitiesRequest& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -445,6 +545,16 @@ void CognitoIdentityClient::ListIdentitiesAsync(const ListIdentitiesRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->ListIdentitiesAsyncHelper( request, handler, context ); } );
 }
 
+ListIdentitiesOutcomeCallable CognitoIdentityClient::ListIdentitiesCallable(ListIdentitiesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::ListIdentities, this, std::move(request)));
+}
+
+void CognitoIdentityClient::ListIdentitiesAsync(ListIdentitiesRequest&& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::ListIdentitiesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::ListIdentitiesAsyncHelper(const ListIdentitiesRequest& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListIdentities(request), context);
@@ -468,7 +578,7 @@ ListIdentityPoolsOutcome CognitoIdentityClient::ListIdentityPools(const ListIden
 
 ListIdentityPoolsOutcomeCallable CognitoIdentityClient::ListIdentityPoolsCallable(const ListIdentityPoolsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListIdentityPools(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListIdentityPools(request); } );
 }
 
 void CognitoIdentityClient::ListIdentityPoolsAsync(const ListIdentityPoolsRequest& request, const ListIdentityPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -476,6 +586,16 @@ void CognitoIdentityClient::ListIdentityPoolsAsync(const ListIdentityPoolsReques
   m_executor->Submit( [this, request, handler, context](){ this->ListIdentityPoolsAsyncHelper( request, handler, context ); } );
 }
 
+ListIdentityPoolsOutcomeCallable CognitoIdentityClient::ListIdentityPoolsCallable(ListIdentityPoolsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::ListIdentityPools, this, std::move(request)));
+}
+
+void CognitoIdentityClient::ListIdentityPoolsAsync(ListIdentityPoolsRequest&& request, const ListIdentityPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::ListIdentityPoolsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::ListIdentityPoolsAsyncHelper(const ListIdentityPoolsRequest& request, const ListIdentityPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListIdentityPools(request), context);
@@ -499,7 +619,7 @@ LookupDeveloperIdentityOutcome CognitoIdentityClient::LookupDeveloperIdentity(co
 
 LookupDeveloperIdentityOutcomeCallable CognitoIdentityClient::LookupDeveloperIdentityCallable(const LookupDeveloperIdentityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->LookupDeveloperIdentity(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->LookupDeveloperIdentity(request); } );
 }
 
 void CognitoIdentityClient::LookupDeveloperIdentityAsync(const LookupDeveloperIdentityRequest& request, const LookupDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -507,6 +627,16 @@ void CognitoIdentityClient::LookupDeveloperIdentityAsync(const LookupDeveloperId
   m_executor->Submit( [this, request, handler, context](){ this->LookupDeveloperIdentityAsyncHelper( request, handler, context ); } );
 }
 
+LookupDeveloperIdentityOutcomeCallable CognitoIdentityClient::LookupDeveloperIdentityCallable(LookupDeveloperIdentityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::LookupDeveloperIdentity, this, std::move(request)));
+}
+
+void CognitoIdentityClient::LookupDeveloperIdentityAsync(LookupDeveloperIdentityRequest&& request, const LookupDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::LookupDeveloperIdentityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::LookupDeveloperIdentityAsyncHelper(const LookupDeveloperIdentityRequest& request, const LookupDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, LookupDeveloperIdentity(request), context);
@@ -530,7 +660,7 @@ MergeDeveloperIdentitiesOutcome CognitoIdentityClient::MergeDeveloperIdentities(
 
 MergeDeveloperIdentitiesOutcomeCallable CognitoIdentityClient::MergeDeveloperIdentitiesCallable(const MergeDeveloperIdentitiesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->MergeDeveloperIdentities(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->MergeDeveloperIdentities(request); } );
 }
 
 void CognitoIdentityClient::MergeDeveloperIdentitiesAsync(const MergeDeveloperIdentitiesRequest& request, const MergeDeveloperIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -538,6 +668,16 @@ void CognitoIdentityClient::MergeDeveloperIdentitiesAsync(const MergeDeveloperId
   m_executor->Submit( [this, request, handler, context](){ this->MergeDeveloperIdentitiesAsyncHelper( request, handler, context ); } );
 }
 
+MergeDeveloperIdentitiesOutcomeCallable CognitoIdentityClient::MergeDeveloperIdentitiesCallable(MergeDeveloperIdentitiesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::MergeDeveloperIdentities, this, std::move(request)));
+}
+
+void CognitoIdentityClient::MergeDeveloperIdentitiesAsync(MergeDeveloperIdentitiesRequest&& request, const MergeDeveloperIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::MergeDeveloperIdentitiesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::MergeDeveloperIdentitiesAsyncHelper(const MergeDeveloperIdentitiesRequest& request, const MergeDeveloperIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, MergeDeveloperIdentities(request), context);
@@ -561,7 +701,7 @@ SetIdentityPoolRolesOutcome CognitoIdentityClient::SetIdentityPoolRoles(const Se
 
 SetIdentityPoolRolesOutcomeCallable CognitoIdentityClient::SetIdentityPoolRolesCallable(const SetIdentityPoolRolesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetIdentityPoolRoles(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetIdentityPoolRoles(request); } );
 }
 
 void CognitoIdentityClient::SetIdentityPoolRolesAsync(const SetIdentityPoolRolesRequest& request, const SetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -569,6 +709,16 @@ void CognitoIdentityClient::SetIdentityPoolRolesAsync(const SetIdentityPoolRoles
   m_executor->Submit( [this, request, handler, context](){ this->SetIdentityPoolRolesAsyncHelper( request, handler, context ); } );
 }
 
+SetIdentityPoolRolesOutcomeCallable CognitoIdentityClient::SetIdentityPoolRolesCallable(SetIdentityPoolRolesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::SetIdentityPoolRoles, this, std::move(request)));
+}
+
+void CognitoIdentityClient::SetIdentityPoolRolesAsync(SetIdentityPoolRolesRequest&& request, const SetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::SetIdentityPoolRolesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::SetIdentityPoolRolesAsyncHelper(const SetIdentityPoolRolesRequest& request, const SetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetIdentityPoolRoles(request), context);
@@ -592,7 +742,7 @@ UnlinkDeveloperIdentityOutcome CognitoIdentityClient::UnlinkDeveloperIdentity(co
 
 UnlinkDeveloperIdentityOutcomeCallable CognitoIdentityClient::UnlinkDeveloperIdentityCallable(const UnlinkDeveloperIdentityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UnlinkDeveloperIdentity(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UnlinkDeveloperIdentity(request); } );
 }
 
 void CognitoIdentityClient::UnlinkDeveloperIdentityAsync(const UnlinkDeveloperIdentityRequest& request, const UnlinkDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -600,6 +750,16 @@ void CognitoIdentityClient::UnlinkDeveloperIdentityAsync(const UnlinkDeveloperId
   m_executor->Submit( [this, request, handler, context](){ this->UnlinkDeveloperIdentityAsyncHelper( request, handler, context ); } );
 }
 
+UnlinkDeveloperIdentityOutcomeCallable CognitoIdentityClient::UnlinkDeveloperIdentityCallable(UnlinkDeveloperIdentityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::UnlinkDeveloperIdentity, this, std::move(request)));
+}
+
+void CognitoIdentityClient::UnlinkDeveloperIdentityAsync(UnlinkDeveloperIdentityRequest&& request, const UnlinkDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::UnlinkDeveloperIdentityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::UnlinkDeveloperIdentityAsyncHelper(const UnlinkDeveloperIdentityRequest& request, const UnlinkDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UnlinkDeveloperIdentity(request), context);
@@ -623,7 +783,7 @@ UnlinkIdentityOutcome CognitoIdentityClient::UnlinkIdentity(const UnlinkIdentity
 
 UnlinkIdentityOutcomeCallable CognitoIdentityClient::UnlinkIdentityCallable(const UnlinkIdentityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UnlinkIdentity(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UnlinkIdentity(request); } );
 }
 
 void CognitoIdentityClient::UnlinkIdentityAsync(const UnlinkIdentityRequest& request, const UnlinkIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -631,6 +791,16 @@ void CognitoIdentityClient::UnlinkIdentityAsync(const UnlinkIdentityRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->UnlinkIdentityAsyncHelper( request, handler, context ); } );
 }
 
+UnlinkIdentityOutcomeCallable CognitoIdentityClient::UnlinkIdentityCallable(UnlinkIdentityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::UnlinkIdentity, this, std::move(request)));
+}
+
+void CognitoIdentityClient::UnlinkIdentityAsync(UnlinkIdentityRequest&& request, const UnlinkIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::UnlinkIdentityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::UnlinkIdentityAsyncHelper(const UnlinkIdentityRequest& request, const UnlinkIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UnlinkIdentity(request), context);
@@ -654,7 +824,7 @@ UpdateIdentityPoolOutcome CognitoIdentityClient::UpdateIdentityPool(const Update
 
 UpdateIdentityPoolOutcomeCallable CognitoIdentityClient::UpdateIdentityPoolCallable(const UpdateIdentityPoolRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateIdentityPool(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateIdentityPool(request); } );
 }
 
 void CognitoIdentityClient::UpdateIdentityPoolAsync(const UpdateIdentityPoolRequest& request, const UpdateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -662,8 +832,161 @@ void CognitoIdentityClient::UpdateIdentityPoolAsync(const UpdateIdentityPoolRequ
   m_executor->Submit( [this, request, handler, context](){ this->UpdateIdentityPoolAsyncHelper( request, handler, context ); } );
 }
 
+UpdateIdentityPoolOutcomeCallable CognitoIdentityClient::UpdateIdentityPoolCallable(UpdateIdentityPoolRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityClient::UpdateIdentityPool, this, std::move(request)));
+}
+
+void CognitoIdentityClient::UpdateIdentityPoolAsync(UpdateIdentityPoolRequest&& request, const UpdateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityClient::UpdateIdentityPoolAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityClient::UpdateIdentityPoolAsyncHelper(const UpdateIdentityPoolRequest& request, const UpdateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateIdentityPool(request), context);
 }
 
+Paginator<CognitoIdentityClient, ListIdentitiesRequest, ListIdentitiesOutcome> CognitoIdentityClient::ListIdentitiesPaginator(const ListIdentitiesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CognitoIdentityClient, ListIdentitiesRequest, ListIdentitiesOutcome>(this, &CognitoIdentityClient::ListIdentities, request,
+    [](const ListIdentitiesRequest& current, const ListIdentitiesOutcome& outcome, ListIdentitiesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CognitoIdentityClient, ListIdentityPoolsRequest, ListIdentityPoolsOutcome> CognitoIdentityClient::ListIdentityPoolsPaginator(const ListIdentityPoolsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CognitoIdentityClient, ListIdentityPoolsRequest, ListIdentityPoolsOutcome>(this, &CognitoIdentityClient::ListIdentityPools, request,
+    [](const ListIdentityPoolsRequest& current, const ListIdentityPoolsOutcome& outcome, ListIdentityPoolsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CognitoIdentityClient, LookupDeveloperIdentityRequest, LookupDeveloperIdentityOutcome> CognitoIdentityClient::LookupDeveloperIdentityPaginator(const LookupDeveloperIdentityRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CognitoIdentityClient, LookupDeveloperIdentityRequest, LookupDeveloperIdentityOutcome>(this, &CognitoIdentityClient::LookupDeveloperIdentity, request,
+    [](const LookupDeveloperIdentityRequest& current, const LookupDeveloperIdentityOutcome& outcome, LookupDeveloperIdentityRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<CognitoIdentityClient, CreateIdentityPoolRequest, CreateIdentityPoolOutcome> CognitoIdentityClient::CreateIdentityPoolAwaitable(CreateIdentityPoolRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::CreateIdentityPool, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, DeleteIdentitiesRequest, DeleteIdentitiesOutcome> CognitoIdentityClient::DeleteIdentitiesAwaitable(DeleteIdentitiesRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::DeleteIdentities, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, DeleteIdentityPoolRequest, DeleteIdentityPoolOutcome> CognitoIdentityClient::DeleteIdentityPoolAwaitable(DeleteIdentityPoolRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::DeleteIdentityPool, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, DescribeIdentityRequest, DescribeIdentityOutcome> CognitoIdentityClient::DescribeIdentityAwaitable(DescribeIdentityRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::DescribeIdentity, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, DescribeIdentityPoolRequest, DescribeIdentityPoolOutcome> CognitoIdentityClient::DescribeIdentityPoolAwaitable(DescribeIdentityPoolRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::DescribeIdentityPool, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, GetCredentialsForIdentityRequest, GetCredentialsForIdentityOutcome> CognitoIdentityClient::GetCredentialsForIdentityAwaitable(GetCredentialsForIdentityRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::GetCredentialsForIdentity, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, GetIdRequest, GetIdOutcome> CognitoIdentityClient::GetIdAwaitable(GetIdRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::GetId, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, GetIdentityPoolRolesRequest, GetIdentityPoolRolesOutcome> CognitoIdentityClient::GetIdentityPoolRolesAwaitable(GetIdentityPoolRolesRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::GetIdentityPoolRoles, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, GetOpenIdTokenRequest, GetOpenIdTokenOutcome> CognitoIdentityClient::GetOpenIdTokenAwaitable(GetOpenIdTokenRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::GetOpenIdToken, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, GetOpenIdTokenForDeveloperIdentityRequest, GetOpenIdTokenForDeveloperIdentityOutcome> CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityAwaitable(GetOpenIdTokenForDeveloperIdentityRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentity, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, ListIdentitiesRequest, ListIdentitiesOutcome> CognitoIdentityClient::ListIdentitiesAwaitable(ListIdentitiesRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::ListIdentities, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, ListIdentityPoolsRequest, ListIdentityPoolsOutcome> CognitoIdentityClient::ListIdentityPoolsAwaitable(ListIdentityPoolsRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::ListIdentityPools, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, LookupDeveloperIdentityRequest, LookupDeveloperIdentityOutcome> CognitoIdentityClient::LookupDeveloperIdentityAwaitable(LookupDeveloperIdentityRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::LookupDeveloperIdentity, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, MergeDeveloperIdentitiesRequest, MergeDeveloperIdentitiesOutcome> CognitoIdentityClient::MergeDeveloperIdentitiesAwaitable(MergeDeveloperIdentitiesRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::MergeDeveloperIdentities, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, SetIdentityPoolRolesRequest, SetIdentityPoolRolesOutcome> CognitoIdentityClient::SetIdentityPoolRolesAwaitable(SetIdentityPoolRolesRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::SetIdentityPoolRoles, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, UnlinkDeveloperIdentityRequest, UnlinkDeveloperIdentityOutcome> CognitoIdentityClient::UnlinkDeveloperIdentityAwaitable(UnlinkDeveloperIdentityRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::UnlinkDeveloperIdentity, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, UnlinkIdentityRequest, UnlinkIdentityOutcome> CognitoIdentityClient::UnlinkIdentityAwaitable(UnlinkIdentityRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::UnlinkIdentity, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityClient, UpdateIdentityPoolRequest, UpdateIdentityPoolOutcome> CognitoIdentityClient::UpdateIdentityPoolAwaitable(UpdateIdentityPoolRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityClient::UpdateIdentityPool, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
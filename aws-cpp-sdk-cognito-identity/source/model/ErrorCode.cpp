@@ -29,21 +29,29 @@ namespace Aws
       namespace ErrorCodeMapper
       {
 
-        static const int AccessDenied_HASH = HashingUtils::HashString("AccessDenied");
-        static const int InternalServerError_HASH = HashingUtils::HashString("InternalServerError");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int AccessDenied_HASH = 1733482047;
+        static const int InternalServerError_HASH = -1943616152;
 
 
         ErrorCode GetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AccessDenied_HASH)
+          switch (hashCode)
           {
+          case AccessDenied_HASH:
             return ErrorCode::AccessDenied;
-          }
-          else if (hashCode == InternalServerError_HASH)
-          {
+          case InternalServerError_HASH:
             return ErrorCode::InternalServerError;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
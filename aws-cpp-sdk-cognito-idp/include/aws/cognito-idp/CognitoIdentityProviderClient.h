@@ -65,6 +65,9 @@
 #include <aws/cognito-idp/model/VerifyUserAttributeResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -364,6 +367,18 @@ namespace Model
          */
         virtual void AddCustomAttributesAsync(const Model::AddCustomAttributesRequest& request, const AddCustomAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddCustomAttributesCallable(const Model::AddCustomAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddCustomAttributesOutcomeCallable AddCustomAttributesCallable(Model::AddCustomAttributesRequest&& request) const;
+
+        /**
+         * Same as AddCustomAttributesAsync(const Model::AddCustomAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddCustomAttributesAsync(Model::AddCustomAttributesRequest&& request, const AddCustomAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Confirms user registration as an admin without using a confirmation code.
          * Works on any user.</p>
@@ -386,6 +401,18 @@ namespace Model
          */
         virtual void AdminConfirmSignUpAsync(const Model::AdminConfirmSignUpRequest& request, const AdminConfirmSignUpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminConfirmSignUpCallable(const Model::AdminConfirmSignUpRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminConfirmSignUpOutcomeCallable AdminConfirmSignUpCallable(Model::AdminConfirmSignUpRequest&& request) const;
+
+        /**
+         * Same as AdminConfirmSignUpAsync(const Model::AdminConfirmSignUpRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminConfirmSignUpAsync(Model::AdminConfirmSignUpRequest&& request, const AdminConfirmSignUpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a user as an administrator. Works on any user.</p>
          */
@@ -405,6 +432,18 @@ namespace Model
          */
         virtual void AdminDeleteUserAsync(const Model::AdminDeleteUserRequest& request, const AdminDeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminDeleteUserCallable(const Model::AdminDeleteUserRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminDeleteUserOutcomeCallable AdminDeleteUserCallable(Model::AdminDeleteUserRequest&& request) const;
+
+        /**
+         * Same as AdminDeleteUserAsync(const Model::AdminDeleteUserRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminDeleteUserAsync(Model::AdminDeleteUserRequest&& request, const AdminDeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the user attributes in a user pool as an administrator. Works on any
          * user.</p>
@@ -427,6 +466,18 @@ namespace Model
          */
         virtual void AdminDeleteUserAttributesAsync(const Model::AdminDeleteUserAttributesRequest& request, const AdminDeleteUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminDeleteUserAttributesCallable(const Model::AdminDeleteUserAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminDeleteUserAttributesOutcomeCallable AdminDeleteUserAttributesCallable(Model::AdminDeleteUserAttributesRequest&& request) const;
+
+        /**
+         * Same as AdminDeleteUserAttributesAsync(const Model::AdminDeleteUserAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminDeleteUserAttributesAsync(Model::AdminDeleteUserAttributesRequest&& request, const AdminDeleteUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables the specified user as an administrator. Works on any user.</p>
          */
@@ -446,6 +497,18 @@ namespace Model
          */
         virtual void AdminDisableUserAsync(const Model::AdminDisableUserRequest& request, const AdminDisableUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminDisableUserCallable(const Model::AdminDisableUserRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminDisableUserOutcomeCallable AdminDisableUserCallable(Model::AdminDisableUserRequest&& request) const;
+
+        /**
+         * Same as AdminDisableUserAsync(const Model::AdminDisableUserRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminDisableUserAsync(Model::AdminDisableUserRequest&& request, const AdminDisableUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables the specified user as an administrator. Works on any user.</p>
          */
@@ -465,6 +528,18 @@ namespace Model
          */
         virtual void AdminEnableUserAsync(const Model::AdminEnableUserRequest& request, const AdminEnableUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminEnableUserCallable(const Model::AdminEnableUserRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminEnableUserOutcomeCallable AdminEnableUserCallable(Model::AdminEnableUserRequest&& request) const;
+
+        /**
+         * Same as AdminEnableUserAsync(const Model::AdminEnableUserRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminEnableUserAsync(Model::AdminEnableUserRequest&& request, const AdminEnableUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Forgets the device, as an administrator.</p>
          */
@@ -484,6 +559,18 @@ namespace Model
          */
         virtual void AdminForgetDeviceAsync(const Model::AdminForgetDeviceRequest& request, const AdminForgetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminForgetDeviceCallable(const Model::AdminForgetDeviceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminForgetDeviceOutcomeCallable AdminForgetDeviceCallable(Model::AdminForgetDeviceRequest&& request) const;
+
+        /**
+         * Same as AdminForgetDeviceAsync(const Model::AdminForgetDeviceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminForgetDeviceAsync(Model::AdminForgetDeviceRequest&& request, const AdminForgetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the device, as an administrator.</p>
          */
@@ -503,6 +590,18 @@ namespace Model
          */
         virtual void AdminGetDeviceAsync(const Model::AdminGetDeviceRequest& request, const AdminGetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminGetDeviceCallable(const Model::AdminGetDeviceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminGetDeviceOutcomeCallable AdminGetDeviceCallable(Model::AdminGetDeviceRequest&& request) const;
+
+        /**
+         * Same as AdminGetDeviceAsync(const Model::AdminGetDeviceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminGetDeviceAsync(Model::AdminGetDeviceRequest&& request, const AdminGetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the specified user by user name in a user pool as an administrator.
          * Works on any user.</p>
@@ -525,6 +624,18 @@ namespace Model
          */
         virtual void AdminGetUserAsync(const Model::AdminGetUserRequest& request, const AdminGetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminGetUserCallable(const Model::AdminGetUserRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminGetUserOutcomeCallable AdminGetUserCallable(Model::AdminGetUserRequest&& request) const;
+
+        /**
+         * Same as AdminGetUserAsync(const Model::AdminGetUserRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminGetUserAsync(Model::AdminGetUserRequest&& request, const AdminGetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Initiates the authentication flow, as an administrator.</p>
          */
@@ -544,6 +655,18 @@ namespace Model
          */
         virtual void AdminInitiateAuthAsync(const Model::AdminInitiateAuthRequest& request, const AdminInitiateAuthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminInitiateAuthCallable(const Model::AdminInitiateAuthRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminInitiateAuthOutcomeCallable AdminInitiateAuthCallable(Model::AdminInitiateAuthRequest&& request) const;
+
+        /**
+         * Same as AdminInitiateAuthAsync(const Model::AdminInitiateAuthRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminInitiateAuthAsync(Model::AdminInitiateAuthRequest&& request, const AdminInitiateAuthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists devices, as an administrator.</p>
          */
@@ -563,6 +686,18 @@ namespace Model
          */
         virtual void AdminListDevicesAsync(const Model::AdminListDevicesRequest& request, const AdminListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminListDevicesCallable(const Model::AdminListDevicesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminListDevicesOutcomeCallable AdminListDevicesCallable(Model::AdminListDevicesRequest&& request) const;
+
+        /**
+         * Same as AdminListDevicesAsync(const Model::AdminListDevicesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminListDevicesAsync(Model::AdminListDevicesRequest&& request, const AdminListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Resets the specified user's password in a user pool as an administrator.
          * Works on any user.</p>
@@ -585,6 +720,18 @@ namespace Model
          */
         virtual void AdminResetUserPasswordAsync(const Model::AdminResetUserPasswordRequest& request, const AdminResetUserPasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminResetUserPasswordCallable(const Model::AdminResetUserPasswordRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminResetUserPasswordOutcomeCallable AdminResetUserPasswordCallable(Model::AdminResetUserPasswordRequest&& request) const;
+
+        /**
+         * Same as AdminResetUserPasswordAsync(const Model::AdminResetUserPasswordRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminResetUserPasswordAsync(Model::AdminResetUserPasswordRequest&& request, const AdminResetUserPasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Responds to an authentication challenge, as an administrator.</p>
          */
@@ -604,6 +751,18 @@ namespace Model
          */
         virtual void AdminRespondToAuthChallengeAsync(const Model::AdminRespondToAuthChallengeRequest& request, const AdminRespondToAuthChallengeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminRespondToAuthChallengeCallable(const Model::AdminRespondToAuthChallengeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminRespondToAuthChallengeOutcomeCallable AdminRespondToAuthChallengeCallable(Model::AdminRespondToAuthChallengeRequest&& request) const;
+
+        /**
+         * Same as AdminRespondToAuthChallengeAsync(const Model::AdminRespondToAuthChallengeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminRespondToAuthChallengeAsync(Model::AdminRespondToAuthChallengeRequest&& request, const AdminRespondToAuthChallengeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets all the user settings for a specified user name. Works on any user.</p>
          */
@@ -623,6 +782,18 @@ namespace Model
          */
         virtual void AdminSetUserSettingsAsync(const Model::AdminSetUserSettingsRequest& request, const AdminSetUserSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminSetUserSettingsCallable(const Model::AdminSetUserSettingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminSetUserSettingsOutcomeCallable AdminSetUserSettingsCallable(Model::AdminSetUserSettingsRequest&& request) const;
+
+        /**
+         * Same as AdminSetUserSettingsAsync(const Model::AdminSetUserSettingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminSetUserSettingsAsync(Model::AdminSetUserSettingsRequest&& request, const AdminSetUserSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the device status as an administrator.</p>
          */
@@ -642,6 +813,18 @@ namespace Model
          */
         virtual void AdminUpdateDeviceStatusAsync(const Model::AdminUpdateDeviceStatusRequest& request, const AdminUpdateDeviceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminUpdateDeviceStatusCallable(const Model::AdminUpdateDeviceStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminUpdateDeviceStatusOutcomeCallable AdminUpdateDeviceStatusCallable(Model::AdminUpdateDeviceStatusRequest&& request) const;
+
+        /**
+         * Same as AdminUpdateDeviceStatusAsync(const Model::AdminUpdateDeviceStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminUpdateDeviceStatusAsync(Model::AdminUpdateDeviceStatusRequest&& request, const AdminUpdateDeviceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the specified user's attributes, including developer attributes, as
          * an administrator. Works on any user.</p>
@@ -664,6 +847,18 @@ namespace Model
          */
         virtual void AdminUpdateUserAttributesAsync(const Model::AdminUpdateUserAttributesRequest& request, const AdminUpdateUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminUpdateUserAttributesCallable(const Model::AdminUpdateUserAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminUpdateUserAttributesOutcomeCallable AdminUpdateUserAttributesCallable(Model::AdminUpdateUserAttributesRequest&& request) const;
+
+        /**
+         * Same as AdminUpdateUserAttributesAsync(const Model::AdminUpdateUserAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminUpdateUserAttributesAsync(Model::AdminUpdateUserAttributesRequest&& request, const AdminUpdateUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Signs out users from all devices, as an administrator.</p>
          */
@@ -683,6 +878,18 @@ namespace Model
          */
         virtual void AdminUserGlobalSignOutAsync(const Model::AdminUserGlobalSignOutRequest& request, const AdminUserGlobalSignOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AdminUserGlobalSignOutCallable(const Model::AdminUserGlobalSignOutRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AdminUserGlobalSignOutOutcomeCallable AdminUserGlobalSignOutCallable(Model::AdminUserGlobalSignOutRequest&& request) const;
+
+        /**
+         * Same as AdminUserGlobalSignOutAsync(const Model::AdminUserGlobalSignOutRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AdminUserGlobalSignOutAsync(Model::AdminUserGlobalSignOutRequest&& request, const AdminUserGlobalSignOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the password for a specified user in a user pool.</p>
          */
@@ -702,6 +909,18 @@ namespace Model
          */
         virtual void ChangePasswordAsync(const Model::ChangePasswordRequest& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ChangePasswordCallable(const Model::ChangePasswordRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ChangePasswordOutcomeCallable ChangePasswordCallable(Model::ChangePasswordRequest&& request) const;
+
+        /**
+         * Same as ChangePasswordAsync(const Model::ChangePasswordRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ChangePasswordAsync(Model::ChangePasswordRequest&& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Confirms tracking of the device. This API call is the call that beings device
          * tracking.</p>
@@ -724,6 +943,18 @@ namespace Model
          */
         virtual void ConfirmDeviceAsync(const Model::ConfirmDeviceRequest& request, const ConfirmDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConfirmDeviceCallable(const Model::ConfirmDeviceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ConfirmDeviceOutcomeCallable ConfirmDeviceCallable(Model::ConfirmDeviceRequest&& request) const;
+
+        /**
+         * Same as ConfirmDeviceAsync(const Model::ConfirmDeviceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ConfirmDeviceAsync(Model::ConfirmDeviceRequest&& request, const ConfirmDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Allows a user to enter a code provided when they reset their password to
          * update their password.</p>
@@ -746,6 +977,18 @@ namespace Model
          */
         virtual void ConfirmForgotPasswordAsync(const Model::ConfirmForgotPasswordRequest& request, const ConfirmForgotPasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConfirmForgotPasswordCallable(const Model::ConfirmForgotPasswordRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ConfirmForgotPasswordOutcomeCallable ConfirmForgotPasswordCallable(Model::ConfirmForgotPasswordRequest&& request) const;
+
+        /**
+         * Same as ConfirmForgotPasswordAsync(const Model::ConfirmForgotPasswordRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ConfirmForgotPasswordAsync(Model::ConfirmForgotPasswordRequest&& request, const ConfirmForgotPasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Confirms registration of a user and handles the existing alias from a
          * previous user.</p>
@@ -768,6 +1011,18 @@ namespace Model
          */
         virtual void ConfirmSignUpAsync(const Model::ConfirmSignUpRequest& request, const ConfirmSignUpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConfirmSignUpCallable(const Model::ConfirmSignUpRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ConfirmSignUpOutcomeCallable ConfirmSignUpCallable(Model::ConfirmSignUpRequest&& request) const;
+
+        /**
+         * Same as ConfirmSignUpAsync(const Model::ConfirmSignUpRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ConfirmSignUpAsync(Model::ConfirmSignUpRequest&& request, const ConfirmSignUpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new Amazon Cognito user pool and sets the password policy for the
          * pool.</p>
@@ -790,6 +1045,18 @@ namespace Model
          */
         virtual void CreateUserPoolAsync(const Model::CreateUserPoolRequest& request, const CreateUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateUserPoolCallable(const Model::CreateUserPoolRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateUserPoolOutcomeCallable CreateUserPoolCallable(Model::CreateUserPoolRequest&& request) const;
+
+        /**
+         * Same as CreateUserPoolAsync(const Model::CreateUserPoolRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateUserPoolAsync(Model::CreateUserPoolRequest&& request, const CreateUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates the user pool client.</p>
          */
@@ -809,6 +1076,18 @@ namespace Model
          */
         virtual void CreateUserPoolClientAsync(const Model::CreateUserPoolClientRequest& request, const CreateUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateUserPoolClientCallable(const Model::CreateUserPoolClientRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateUserPoolClientOutcomeCallable CreateUserPoolClientCallable(Model::CreateUserPoolClientRequest&& request) const;
+
+        /**
+         * Same as CreateUserPoolClientAsync(const Model::CreateUserPoolClientRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateUserPoolClientAsync(Model::CreateUserPoolClientRequest&& request, const CreateUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Allows a user to delete one's self.</p>
          */
@@ -828,6 +1107,18 @@ namespace Model
          */
         virtual void DeleteUserAsync(const Model::DeleteUserRequest& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteUserCallable(const Model::DeleteUserRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteUserOutcomeCallable DeleteUserCallable(Model::DeleteUserRequest&& request) const;
+
+        /**
+         * Same as DeleteUserAsync(const Model::DeleteUserRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteUserAsync(Model::DeleteUserRequest&& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the attributes for a user.</p>
          */
@@ -847,6 +1138,18 @@ namespace Model
          */
         virtual void DeleteUserAttributesAsync(const Model::DeleteUserAttributesRequest& request, const DeleteUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteUserAttributesCallable(const Model::DeleteUserAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteUserAttributesOutcomeCallable DeleteUserAttributesCallable(Model::DeleteUserAttributesRequest&& request) const;
+
+        /**
+         * Same as DeleteUserAttributesAsync(const Model::DeleteUserAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteUserAttributesAsync(Model::DeleteUserAttributesRequest&& request, const DeleteUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified Amazon Cognito user pool.</p>
          */
@@ -866,6 +1169,18 @@ namespace Model
          */
         virtual void DeleteUserPoolAsync(const Model::DeleteUserPoolRequest& request, const DeleteUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteUserPoolCallable(const Model::DeleteUserPoolRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteUserPoolOutcomeCallable DeleteUserPoolCallable(Model::DeleteUserPoolRequest&& request) const;
+
+        /**
+         * Same as DeleteUserPoolAsync(const Model::DeleteUserPoolRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteUserPoolAsync(Model::DeleteUserPoolRequest&& request, const DeleteUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Allows the developer to delete the user pool client.</p>
          */
@@ -885,6 +1200,18 @@ namespace Model
          */
         virtual void DeleteUserPoolClientAsync(const Model::DeleteUserPoolClientRequest& request, const DeleteUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteUserPoolClientCallable(const Model::DeleteUserPoolClientRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteUserPoolClientOutcomeCallable DeleteUserPoolClientCallable(Model::DeleteUserPoolClientRequest&& request) const;
+
+        /**
+         * Same as DeleteUserPoolClientAsync(const Model::DeleteUserPoolClientRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteUserPoolClientAsync(Model::DeleteUserPoolClientRequest&& request, const DeleteUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the configuration information and metadata of the specified user
          * pool.</p>
@@ -907,6 +1234,18 @@ namespace Model
          */
         virtual void DescribeUserPoolAsync(const Model::DescribeUserPoolRequest& request, const DescribeUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeUserPoolCallable(const Model::DescribeUserPoolRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeUserPoolOutcomeCallable DescribeUserPoolCallable(Model::DescribeUserPoolRequest&& request) const;
+
+        /**
+         * Same as DescribeUserPoolAsync(const Model::DescribeUserPoolRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeUserPoolAsync(Model::DescribeUserPoolRequest&& request, const DescribeUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Client method for returning the configuration information and metadata of the
          * specified user pool client.</p>
@@ -929,6 +1268,18 @@ namespace Model
          */
         virtual void DescribeUserPoolClientAsync(const Model::DescribeUserPoolClientRequest& request, const DescribeUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeUserPoolClientCallable(const Model::DescribeUserPoolClientRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeUserPoolClientOutcomeCallable DescribeUserPoolClientCallable(Model::DescribeUserPoolClientRequest&& request) const;
+
+        /**
+         * Same as DescribeUserPoolClientAsync(const Model::DescribeUserPoolClientRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeUserPoolClientAsync(Model::DescribeUserPoolClientRequest&& request, const DescribeUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Forgets the specified device.</p>
          */
@@ -948,6 +1299,18 @@ namespace Model
          */
         virtual void ForgetDeviceAsync(const Model::ForgetDeviceRequest& request, const ForgetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ForgetDeviceCallable(const Model::ForgetDeviceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ForgetDeviceOutcomeCallable ForgetDeviceCallable(Model::ForgetDeviceRequest&& request) const;
+
+        /**
+         * Same as ForgetDeviceAsync(const Model::ForgetDeviceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ForgetDeviceAsync(Model::ForgetDeviceRequest&& request, const ForgetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the password for the specified client ID or username.</p>
          */
@@ -967,6 +1330,18 @@ namespace Model
          */
         virtual void ForgotPasswordAsync(const Model::ForgotPasswordRequest& request, const ForgotPasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ForgotPasswordCallable(const Model::ForgotPasswordRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ForgotPasswordOutcomeCallable ForgotPasswordCallable(Model::ForgotPasswordRequest&& request) const;
+
+        /**
+         * Same as ForgotPasswordAsync(const Model::ForgotPasswordRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ForgotPasswordAsync(Model::ForgotPasswordRequest&& request, const ForgotPasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the device.</p>
          */
@@ -986,6 +1361,18 @@ namespace Model
          */
         virtual void GetDeviceAsync(const Model::GetDeviceRequest& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDeviceCallable(const Model::GetDeviceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDeviceOutcomeCallable GetDeviceCallable(Model::GetDeviceRequest&& request) const;
+
+        /**
+         * Same as GetDeviceAsync(const Model::GetDeviceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDeviceAsync(Model::GetDeviceRequest&& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the user attributes and metadata for a user.</p>
          */
@@ -1005,6 +1392,18 @@ namespace Model
          */
         virtual void GetUserAsync(const Model::GetUserRequest& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetUserCallable(const Model::GetUserRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetUserOutcomeCallable GetUserCallable(Model::GetUserRequest&& request) const;
+
+        /**
+         * Same as GetUserAsync(const Model::GetUserRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetUserAsync(Model::GetUserRequest&& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the user attribute verification code for the specified attribute
          * name.</p>
@@ -1027,6 +1426,18 @@ namespace Model
          */
         virtual void GetUserAttributeVerificationCodeAsync(const Model::GetUserAttributeVerificationCodeRequest& request, const GetUserAttributeVerificationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetUserAttributeVerificationCodeCallable(const Model::GetUserAttributeVerificationCodeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetUserAttributeVerificationCodeOutcomeCallable GetUserAttributeVerificationCodeCallable(Model::GetUserAttributeVerificationCodeRequest&& request) const;
+
+        /**
+         * Same as GetUserAttributeVerificationCodeAsync(const Model::GetUserAttributeVerificationCodeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetUserAttributeVerificationCodeAsync(Model::GetUserAttributeVerificationCodeRequest&& request, const GetUserAttributeVerificationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Signs out users from all devices.</p>
          */
@@ -1046,6 +1457,18 @@ namespace Model
          */
         virtual void GlobalSignOutAsync(const Model::GlobalSignOutRequest& request, const GlobalSignOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GlobalSignOutCallable(const Model::GlobalSignOutRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GlobalSignOutOutcomeCallable GlobalSignOutCallable(Model::GlobalSignOutRequest&& request) const;
+
+        /**
+         * Same as GlobalSignOutAsync(const Model::GlobalSignOutRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GlobalSignOutAsync(Model::GlobalSignOutRequest&& request, const GlobalSignOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Initiates the authentication flow.</p>
          */
@@ -1065,6 +1488,18 @@ namespace Model
          */
         virtual void InitiateAuthAsync(const Model::InitiateAuthRequest& request, const InitiateAuthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as InitiateAuthCallable(const Model::InitiateAuthRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::InitiateAuthOutcomeCallable InitiateAuthCallable(Model::InitiateAuthRequest&& request) const;
+
+        /**
+         * Same as InitiateAuthAsync(const Model::InitiateAuthRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void InitiateAuthAsync(Model::InitiateAuthRequest&& request, const InitiateAuthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the devices.</p>
          */
@@ -1084,6 +1519,18 @@ namespace Model
          */
         virtual void ListDevicesAsync(const Model::ListDevicesRequest& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDevicesCallable(const Model::ListDevicesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDevicesOutcomeCallable ListDevicesCallable(Model::ListDevicesRequest&& request) const;
+
+        /**
+         * Same as ListDevicesAsync(const Model::ListDevicesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDevicesAsync(Model::ListDevicesRequest&& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the clients that have been created for the specified user pool.</p>
          */
@@ -1103,6 +1550,18 @@ namespace Model
          */
         virtual void ListUserPoolClientsAsync(const Model::ListUserPoolClientsRequest& request, const ListUserPoolClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListUserPoolClientsCallable(const Model::ListUserPoolClientsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListUserPoolClientsOutcomeCallable ListUserPoolClientsCallable(Model::ListUserPoolClientsRequest&& request) const;
+
+        /**
+         * Same as ListUserPoolClientsAsync(const Model::ListUserPoolClientsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListUserPoolClientsAsync(Model::ListUserPoolClientsRequest&& request, const ListUserPoolClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the user pools associated with an AWS account.</p>
          */
@@ -1122,6 +1581,18 @@ namespace Model
          */
         virtual void ListUserPoolsAsync(const Model::ListUserPoolsRequest& request, const ListUserPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListUserPoolsCallable(const Model::ListUserPoolsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListUserPoolsOutcomeCallable ListUserPoolsCallable(Model::ListUserPoolsRequest&& request) const;
+
+        /**
+         * Same as ListUserPoolsAsync(const Model::ListUserPoolsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListUserPoolsAsync(Model::ListUserPoolsRequest&& request, const ListUserPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the users in the Amazon Cognito user pool.</p>
          */
@@ -1141,6 +1612,18 @@ namespace Model
          */
         virtual void ListUsersAsync(const Model::ListUsersRequest& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListUsersCallable(const Model::ListUsersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListUsersOutcomeCallable ListUsersCallable(Model::ListUsersRequest&& request) const;
+
+        /**
+         * Same as ListUsersAsync(const Model::ListUsersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListUsersAsync(Model::ListUsersRequest&& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Resends the confirmation (for confirmation of registration) to a specific
          * user in the user pool.</p>
@@ -1163,6 +1646,18 @@ namespace Model
          */
         virtual void ResendConfirmationCodeAsync(const Model::ResendConfirmationCodeRequest& request, const ResendConfirmationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResendConfirmationCodeCallable(const Model::ResendConfirmationCodeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResendConfirmationCodeOutcomeCallable ResendConfirmationCodeCallable(Model::ResendConfirmationCodeRequest&& request) const;
+
+        /**
+         * Same as ResendConfirmationCodeAsync(const Model::ResendConfirmationCodeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResendConfirmationCodeAsync(Model::ResendConfirmationCodeRequest&& request, const ResendConfirmationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Responds to the authentication challenge.</p>
          */
@@ -1182,6 +1677,18 @@ namespace Model
          */
         virtual void RespondToAuthChallengeAsync(const Model::RespondToAuthChallengeRequest& request, const RespondToAuthChallengeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RespondToAuthChallengeCallable(const Model::RespondToAuthChallengeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RespondToAuthChallengeOutcomeCallable RespondToAuthChallengeCallable(Model::RespondToAuthChallengeRequest&& request) const;
+
+        /**
+         * Same as RespondToAuthChallengeAsync(const Model::RespondToAuthChallengeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RespondToAuthChallengeAsync(Model::RespondToAuthChallengeRequest&& request, const RespondToAuthChallengeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the user settings like multi-factor authentication (MFA). If MFA is to
          * be removed for a particular attribute pass the attribute with code delivery as
@@ -1207,6 +1714,18 @@ namespace Model
          */
         virtual void SetUserSettingsAsync(const Model::SetUserSettingsRequest& request, const SetUserSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetUserSettingsCallable(const Model::SetUserSettingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetUserSettingsOutcomeCallable SetUserSettingsCallable(Model::SetUserSettingsRequest&& request) const;
+
+        /**
+         * Same as SetUserSettingsAsync(const Model::SetUserSettingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetUserSettingsAsync(Model::SetUserSettingsRequest&& request, const SetUserSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers the user in the specified user pool and creates a user name,
          * password, and user attributes.</p>
@@ -1229,6 +1748,18 @@ namespace Model
          */
         virtual void SignUpAsync(const Model::SignUpRequest& request, const SignUpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SignUpCallable(const Model::SignUpRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SignUpOutcomeCallable SignUpCallable(Model::SignUpRequest&& request) const;
+
+        /**
+         * Same as SignUpAsync(const Model::SignUpRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SignUpAsync(Model::SignUpRequest&& request, const SignUpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the device status.</p>
          */
@@ -1248,6 +1779,18 @@ namespace Model
          */
         virtual void UpdateDeviceStatusAsync(const Model::UpdateDeviceStatusRequest& request, const UpdateDeviceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDeviceStatusCallable(const Model::UpdateDeviceStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateDeviceStatusOutcomeCallable UpdateDeviceStatusCallable(Model::UpdateDeviceStatusRequest&& request) const;
+
+        /**
+         * Same as UpdateDeviceStatusAsync(const Model::UpdateDeviceStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateDeviceStatusAsync(Model::UpdateDeviceStatusRequest&& request, const UpdateDeviceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Allows a user to update a specific attribute (one at a time).</p>
          */
@@ -1267,6 +1810,18 @@ namespace Model
          */
         virtual void UpdateUserAttributesAsync(const Model::UpdateUserAttributesRequest& request, const UpdateUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateUserAttributesCallable(const Model::UpdateUserAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateUserAttributesOutcomeCallable UpdateUserAttributesCallable(Model::UpdateUserAttributesRequest&& request) const;
+
+        /**
+         * Same as UpdateUserAttributesAsync(const Model::UpdateUserAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateUserAttributesAsync(Model::UpdateUserAttributesRequest&& request, const UpdateUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the specified user pool with the specified attributes.</p>
          */
@@ -1286,6 +1841,18 @@ namespace Model
          */
         virtual void UpdateUserPoolAsync(const Model::UpdateUserPoolRequest& request, const UpdateUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateUserPoolCallable(const Model::UpdateUserPoolRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateUserPoolOutcomeCallable UpdateUserPoolCallable(Model::UpdateUserPoolRequest&& request) const;
+
+        /**
+         * Same as UpdateUserPoolAsync(const Model::UpdateUserPoolRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateUserPoolAsync(Model::UpdateUserPoolRequest&& request, const UpdateUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Allows the developer to update the specified user pool client and password
          * policy.</p>
@@ -1308,6 +1875,18 @@ namespace Model
          */
         virtual void UpdateUserPoolClientAsync(const Model::UpdateUserPoolClientRequest& request, const UpdateUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateUserPoolClientCallable(const Model::UpdateUserPoolClientRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateUserPoolClientOutcomeCallable UpdateUserPoolClientCallable(Model::UpdateUserPoolClientRequest&& request) const;
+
+        /**
+         * Same as UpdateUserPoolClientAsync(const Model::UpdateUserPoolClientRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateUserPoolClientAsync(Model::UpdateUserPoolClientRequest&& request, const UpdateUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Verifies the specified user attributes in the user pool.</p>
          */
@@ -1327,6 +1906,290 @@ namespace Model
          */
         virtual void VerifyUserAttributeAsync(const Model::VerifyUserAttributeRequest& request, const VerifyUserAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as VerifyUserAttributeCallable(const Model::VerifyUserAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::VerifyUserAttributeOutcomeCallable VerifyUserAttributeCallable(Model::VerifyUserAttributeRequest&& request) const;
+
+        /**
+         * Same as VerifyUserAttributeAsync(const Model::VerifyUserAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void VerifyUserAttributeAsync(Model::VerifyUserAttributeRequest&& request, const VerifyUserAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through AdminListDevices(), following PaginationToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CognitoIdentityProviderClient, Model::AdminListDevicesRequest, Model::AdminListDevicesOutcome> AdminListDevicesPaginator(const Model::AdminListDevicesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListDevices(), following PaginationToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CognitoIdentityProviderClient, Model::ListDevicesRequest, Model::ListDevicesOutcome> ListDevicesPaginator(const Model::ListDevicesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListUserPoolClients(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CognitoIdentityProviderClient, Model::ListUserPoolClientsRequest, Model::ListUserPoolClientsOutcome> ListUserPoolClientsPaginator(const Model::ListUserPoolClientsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListUserPools(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CognitoIdentityProviderClient, Model::ListUserPoolsRequest, Model::ListUserPoolsOutcome> ListUserPoolsPaginator(const Model::ListUserPoolsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListUsers(), following PaginationToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CognitoIdentityProviderClient, Model::ListUsersRequest, Model::ListUsersOutcome> ListUsersPaginator(const Model::ListUsersRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddCustomAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AddCustomAttributesRequest, Model::AddCustomAttributesOutcome> AddCustomAttributesAwaitable(Model::AddCustomAttributesRequest request) const;
+
+        /**
+         * co_await-able form of AdminConfirmSignUp(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminConfirmSignUpRequest, Model::AdminConfirmSignUpOutcome> AdminConfirmSignUpAwaitable(Model::AdminConfirmSignUpRequest request) const;
+
+        /**
+         * co_await-able form of AdminDeleteUser(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminDeleteUserRequest, Model::AdminDeleteUserOutcome> AdminDeleteUserAwaitable(Model::AdminDeleteUserRequest request) const;
+
+        /**
+         * co_await-able form of AdminDeleteUserAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminDeleteUserAttributesRequest, Model::AdminDeleteUserAttributesOutcome> AdminDeleteUserAttributesAwaitable(Model::AdminDeleteUserAttributesRequest request) const;
+
+        /**
+         * co_await-able form of AdminDisableUser(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminDisableUserRequest, Model::AdminDisableUserOutcome> AdminDisableUserAwaitable(Model::AdminDisableUserRequest request) const;
+
+        /**
+         * co_await-able form of AdminEnableUser(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminEnableUserRequest, Model::AdminEnableUserOutcome> AdminEnableUserAwaitable(Model::AdminEnableUserRequest request) const;
+
+        /**
+         * co_await-able form of AdminForgetDevice(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminForgetDeviceRequest, Model::AdminForgetDeviceOutcome> AdminForgetDeviceAwaitable(Model::AdminForgetDeviceRequest request) const;
+
+        /**
+         * co_await-able form of AdminGetDevice(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminGetDeviceRequest, Model::AdminGetDeviceOutcome> AdminGetDeviceAwaitable(Model::AdminGetDeviceRequest request) const;
+
+        /**
+         * co_await-able form of AdminGetUser(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminGetUserRequest, Model::AdminGetUserOutcome> AdminGetUserAwaitable(Model::AdminGetUserRequest request) const;
+
+        /**
+         * co_await-able form of AdminInitiateAuth(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminInitiateAuthRequest, Model::AdminInitiateAuthOutcome> AdminInitiateAuthAwaitable(Model::AdminInitiateAuthRequest request) const;
+
+        /**
+         * co_await-able form of AdminListDevices(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminListDevicesRequest, Model::AdminListDevicesOutcome> AdminListDevicesAwaitable(Model::AdminListDevicesRequest request) const;
+
+        /**
+         * co_await-able form of AdminResetUserPassword(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminResetUserPasswordRequest, Model::AdminResetUserPasswordOutcome> AdminResetUserPasswordAwaitable(Model::AdminResetUserPasswordRequest request) const;
+
+        /**
+         * co_await-able form of AdminRespondToAuthChallenge(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminRespondToAuthChallengeRequest, Model::AdminRespondToAuthChallengeOutcome> AdminRespondToAuthChallengeAwaitable(Model::AdminRespondToAuthChallengeRequest request) const;
+
+        /**
+         * co_await-able form of AdminSetUserSettings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminSetUserSettingsRequest, Model::AdminSetUserSettingsOutcome> AdminSetUserSettingsAwaitable(Model::AdminSetUserSettingsRequest request) const;
+
+        /**
+         * co_await-able form of AdminUpdateDeviceStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminUpdateDeviceStatusRequest, Model::AdminUpdateDeviceStatusOutcome> AdminUpdateDeviceStatusAwaitable(Model::AdminUpdateDeviceStatusRequest request) const;
+
+        /**
+         * co_await-able form of AdminUpdateUserAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminUpdateUserAttributesRequest, Model::AdminUpdateUserAttributesOutcome> AdminUpdateUserAttributesAwaitable(Model::AdminUpdateUserAttributesRequest request) const;
+
+        /**
+         * co_await-able form of AdminUserGlobalSignOut(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::AdminUserGlobalSignOutRequest, Model::AdminUserGlobalSignOutOutcome> AdminUserGlobalSignOutAwaitable(Model::AdminUserGlobalSignOutRequest request) const;
+
+        /**
+         * co_await-able form of ChangePassword(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::ChangePasswordRequest, Model::ChangePasswordOutcome> ChangePasswordAwaitable(Model::ChangePasswordRequest request) const;
+
+        /**
+         * co_await-able form of ConfirmDevice(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::ConfirmDeviceRequest, Model::ConfirmDeviceOutcome> ConfirmDeviceAwaitable(Model::ConfirmDeviceRequest request) const;
+
+        /**
+         * co_await-able form of ConfirmForgotPassword(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::ConfirmForgotPasswordRequest, Model::ConfirmForgotPasswordOutcome> ConfirmForgotPasswordAwaitable(Model::ConfirmForgotPasswordRequest request) const;
+
+        /**
+         * co_await-able form of ConfirmSignUp(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::ConfirmSignUpRequest, Model::ConfirmSignUpOutcome> ConfirmSignUpAwaitable(Model::ConfirmSignUpRequest request) const;
+
+        /**
+         * co_await-able form of CreateUserPool(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::CreateUserPoolRequest, Model::CreateUserPoolOutcome> CreateUserPoolAwaitable(Model::CreateUserPoolRequest request) const;
+
+        /**
+         * co_await-able form of CreateUserPoolClient(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::CreateUserPoolClientRequest, Model::CreateUserPoolClientOutcome> CreateUserPoolClientAwaitable(Model::CreateUserPoolClientRequest request) const;
+
+        /**
+         * co_await-able form of DeleteUser(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::DeleteUserRequest, Model::DeleteUserOutcome> DeleteUserAwaitable(Model::DeleteUserRequest request) const;
+
+        /**
+         * co_await-able form of DeleteUserAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::DeleteUserAttributesRequest, Model::DeleteUserAttributesOutcome> DeleteUserAttributesAwaitable(Model::DeleteUserAttributesRequest request) const;
+
+        /**
+         * co_await-able form of DeleteUserPool(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::DeleteUserPoolRequest, Model::DeleteUserPoolOutcome> DeleteUserPoolAwaitable(Model::DeleteUserPoolRequest request) const;
+
+        /**
+         * co_await-able form of DeleteUserPoolClient(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::DeleteUserPoolClientRequest, Model::DeleteUserPoolClientOutcome> DeleteUserPoolClientAwaitable(Model::DeleteUserPoolClientRequest request) const;
+
+        /**
+         * co_await-able form of DescribeUserPool(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::DescribeUserPoolRequest, Model::DescribeUserPoolOutcome> DescribeUserPoolAwaitable(Model::DescribeUserPoolRequest request) const;
+
+        /**
+         * co_await-able form of DescribeUserPoolClient(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::DescribeUserPoolClientRequest, Model::DescribeUserPoolClientOutcome> DescribeUserPoolClientAwaitable(Model::DescribeUserPoolClientRequest request) const;
+
+        /**
+         * co_await-able form of ForgetDevice(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::ForgetDeviceRequest, Model::ForgetDeviceOutcome> ForgetDeviceAwaitable(Model::ForgetDeviceRequest request) const;
+
+        /**
+         * co_await-able form of ForgotPassword(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::ForgotPasswordRequest, Model::ForgotPasswordOutcome> ForgotPasswordAwaitable(Model::ForgotPasswordRequest request) const;
+
+        /**
+         * co_await-able form of GetDevice(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::GetDeviceRequest, Model::GetDeviceOutcome> GetDeviceAwaitable(Model::GetDeviceRequest request) const;
+
+        /**
+         * co_await-able form of GetUser(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::GetUserRequest, Model::GetUserOutcome> GetUserAwaitable(Model::GetUserRequest request) const;
+
+        /**
+         * co_await-able form of GetUserAttributeVerificationCode(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::GetUserAttributeVerificationCodeRequest, Model::GetUserAttributeVerificationCodeOutcome> GetUserAttributeVerificationCodeAwaitable(Model::GetUserAttributeVerificationCodeRequest request) const;
+
+        /**
+         * co_await-able form of GlobalSignOut(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::GlobalSignOutRequest, Model::GlobalSignOutOutcome> GlobalSignOutAwaitable(Model::GlobalSignOutRequest request) const;
+
+        /**
+         * co_await-able form of InitiateAuth(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::InitiateAuthRequest, Model::InitiateAuthOutcome> InitiateAuthAwaitable(Model::InitiateAuthRequest request) const;
+
+        /**
+         * co_await-able form of ListDevices(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::ListDevicesRequest, Model::ListDevicesOutcome> ListDevicesAwaitable(Model::ListDevicesRequest request) const;
+
+        /**
+         * co_await-able form of ListUserPoolClients(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::ListUserPoolClientsRequest, Model::ListUserPoolClientsOutcome> ListUserPoolClientsAwaitable(Model::ListUserPoolClientsRequest request) const;
+
+        /**
+         * co_await-able form of ListUserPools(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::ListUserPoolsRequest, Model::ListUserPoolsOutcome> ListUserPoolsAwaitable(Model::ListUserPoolsRequest request) const;
+
+        /**
+         * co_await-able form of ListUsers(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::ListUsersRequest, Model::ListUsersOutcome> ListUsersAwaitable(Model::ListUsersRequest request) const;
+
+        /**
+         * co_await-able form of ResendConfirmationCode(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::ResendConfirmationCodeRequest, Model::ResendConfirmationCodeOutcome> ResendConfirmationCodeAwaitable(Model::ResendConfirmationCodeRequest request) const;
+
+        /**
+         * co_await-able form of RespondToAuthChallenge(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::RespondToAuthChallengeRequest, Model::RespondToAuthChallengeOutcome> RespondToAuthChallengeAwaitable(Model::RespondToAuthChallengeRequest request) const;
+
+        /**
+         * co_await-able form of SetUserSettings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::SetUserSettingsRequest, Model::SetUserSettingsOutcome> SetUserSettingsAwaitable(Model::SetUserSettingsRequest request) const;
+
+        /**
+         * co_await-able form of SignUp(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::SignUpRequest, Model::SignUpOutcome> SignUpAwaitable(Model::SignUpRequest request) const;
+
+        /**
+         * co_await-able form of UpdateDeviceStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::UpdateDeviceStatusRequest, Model::UpdateDeviceStatusOutcome> UpdateDeviceStatusAwaitable(Model::UpdateDeviceStatusRequest request) const;
+
+        /**
+         * co_await-able form of UpdateUserAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::UpdateUserAttributesRequest, Model::UpdateUserAttributesOutcome> UpdateUserAttributesAwaitable(Model::UpdateUserAttributesRequest request) const;
+
+        /**
+         * co_await-able form of UpdateUserPool(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::UpdateUserPoolRequest, Model::UpdateUserPoolOutcome> UpdateUserPoolAwaitable(Model::UpdateUserPoolRequest request) const;
+
+        /**
+         * co_await-able form of UpdateUserPoolClient(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::UpdateUserPoolClientRequest, Model::UpdateUserPoolClientOutcome> UpdateUserPoolClientAwaitable(Model::UpdateUserPoolClientRequest request) const;
+
+        /**
+         * co_await-able form of VerifyUserAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoIdentityProviderClient, Model::VerifyUserAttributeRequest, Model::VerifyUserAttributeOutcome> VerifyUserAttributeAwaitable(Model::VerifyUserAttributeRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
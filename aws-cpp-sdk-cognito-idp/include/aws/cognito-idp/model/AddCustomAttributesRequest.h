@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     AddCustomAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "AddCustomAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
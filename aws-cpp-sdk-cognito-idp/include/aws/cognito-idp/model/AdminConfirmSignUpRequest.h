@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AdminConfirmSignUpRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminConfirmSignUp"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
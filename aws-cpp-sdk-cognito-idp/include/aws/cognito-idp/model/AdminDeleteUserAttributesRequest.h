@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AdminDeleteUserAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminDeleteUserAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AdminDeleteUserRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminDeleteUser"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AdminDisableUserRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminDisableUser"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AdminEnableUserRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminEnableUser"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
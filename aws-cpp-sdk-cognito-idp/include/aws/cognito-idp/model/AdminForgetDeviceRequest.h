@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AdminForgetDeviceRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminForgetDevice"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AdminGetDeviceRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminGetDevice"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AdminGetUserRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminGetUser"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     AdminInitiateAuthRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminInitiateAuth"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AdminListDevicesRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminListDevices"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
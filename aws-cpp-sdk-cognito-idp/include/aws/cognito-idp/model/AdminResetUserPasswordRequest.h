@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AdminResetUserPasswordRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminResetUserPassword"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
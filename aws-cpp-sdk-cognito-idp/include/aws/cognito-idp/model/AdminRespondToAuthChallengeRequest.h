@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     AdminRespondToAuthChallengeRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminRespondToAuthChallenge"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     AdminSetUserSettingsRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminSetUserSettings"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AdminUpdateDeviceStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminUpdateDeviceStatus"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
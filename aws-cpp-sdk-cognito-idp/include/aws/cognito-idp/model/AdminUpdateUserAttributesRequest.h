@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     AdminUpdateUserAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminUpdateUserAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
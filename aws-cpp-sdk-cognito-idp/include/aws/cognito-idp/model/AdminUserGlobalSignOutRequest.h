@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AdminUserGlobalSignOutRequest();
+    inline const char* GetServiceRequestName() const override { return "AdminUserGlobalSignOut"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ChangePasswordRequest();
+    inline const char* GetServiceRequestName() const override { return "ChangePassword"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ConfirmDeviceRequest();
+    inline const char* GetServiceRequestName() const override { return "ConfirmDevice"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
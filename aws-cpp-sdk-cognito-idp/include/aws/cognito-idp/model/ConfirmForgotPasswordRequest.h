@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ConfirmForgotPasswordRequest();
+    inline const char* GetServiceRequestName() const override { return "ConfirmForgotPassword"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
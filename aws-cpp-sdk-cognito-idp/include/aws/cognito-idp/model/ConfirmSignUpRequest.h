@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ConfirmSignUpRequest();
+    inline const char* GetServiceRequestName() const override { return "ConfirmSignUp"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
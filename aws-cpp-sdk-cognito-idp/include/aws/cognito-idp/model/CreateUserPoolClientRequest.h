@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateUserPoolClientRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateUserPoolClient"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
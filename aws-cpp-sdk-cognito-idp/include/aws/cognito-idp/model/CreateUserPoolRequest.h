@@ -40,6 +40,8 @@ namespace Model
   {
   public:
     CreateUserPoolRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateUserPool"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
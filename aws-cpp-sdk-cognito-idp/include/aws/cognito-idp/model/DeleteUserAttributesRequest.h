@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteUserAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteUserAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteUserPoolClientRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteUserPoolClient"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteUserPoolRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteUserPool"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
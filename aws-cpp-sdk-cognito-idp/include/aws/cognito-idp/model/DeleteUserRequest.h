@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteUserRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteUser"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeUserPoolClientRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeUserPoolClient"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
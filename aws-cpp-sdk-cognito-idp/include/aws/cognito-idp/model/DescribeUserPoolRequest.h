@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeUserPoolRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeUserPool"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ForgetDeviceRequest();
+    inline const char* GetServiceRequestName() const override { return "ForgetDevice"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ForgotPasswordRequest();
+    inline const char* GetServiceRequestName() const override { return "ForgotPassword"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
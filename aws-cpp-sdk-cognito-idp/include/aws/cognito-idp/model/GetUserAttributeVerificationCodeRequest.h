@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetUserAttributeVerificationCodeRequest();
+    inline const char* GetServiceRequestName() const override { return "GetUserAttributeVerificationCode"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
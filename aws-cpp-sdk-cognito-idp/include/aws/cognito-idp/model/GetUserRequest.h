@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetUserRequest();
+    inline const char* GetServiceRequestName() const override { return "GetUser"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
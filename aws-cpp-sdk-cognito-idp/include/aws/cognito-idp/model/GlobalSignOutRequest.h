@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GlobalSignOutRequest();
+    inline const char* GetServiceRequestName() const override { return "GlobalSignOut"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
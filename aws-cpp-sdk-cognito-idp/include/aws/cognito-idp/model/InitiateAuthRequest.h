@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     InitiateAuthRequest();
+    inline const char* GetServiceRequestName() const override { return "InitiateAuth"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListUserPoolClientsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListUserPoolClients"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListUserPoolsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListUserPools"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
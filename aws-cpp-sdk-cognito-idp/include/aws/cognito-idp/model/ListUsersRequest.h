@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListUsersRequest();
+    inline const char* GetServiceRequestName() const override { return "ListUsers"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ResendConfirmationCodeRequest();
+    inline const char* GetServiceRequestName() const override { return "ResendConfirmationCode"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     RespondToAuthChallengeRequest();
+    inline const char* GetServiceRequestName() const override { return "RespondToAuthChallenge"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
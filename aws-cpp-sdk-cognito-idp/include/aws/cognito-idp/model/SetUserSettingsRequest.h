@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     SetUserSettingsRequest();
+    inline const char* GetServiceRequestName() const override { return "SetUserSettings"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     SignUpRequest();
+    inline const char* GetServiceRequestName() const override { return "SignUp"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
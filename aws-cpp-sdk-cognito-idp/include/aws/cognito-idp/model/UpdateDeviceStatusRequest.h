@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateDeviceStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateDeviceStatus"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateUserAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateUserAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateUserPoolClientRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateUserPoolClient"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -39,6 +39,8 @@ namespace Model
   {
   public:
     UpdateUserPoolRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateUserPool"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
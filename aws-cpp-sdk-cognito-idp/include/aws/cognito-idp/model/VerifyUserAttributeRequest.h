@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     VerifyUserAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "VerifyUserAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -158,7 +158,7 @@ AddCustomAttributesOutcome CognitoIdentityProviderClient::AddCustomAttributes(co
 
 AddCustomAttributesOutcomeCallable CognitoIdentityProviderClient::AddCustomAttributesCallable(const AddCustomAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddCustomAttributes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddCustomAttributes(request); } );
 }
 
 void CognitoIdentityProviderClient::AddCustomAttributesAsync(const AddCustomAttributesRequest& request, const AddCustomAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -166,6 +166,16 @@ void CognitoIdentityProviderClient::AddCustomAttributesAsync(const AddCustomAttr
   m_executor->Submit( [this, request, handler, context](){ this->AddCustomAttributesAsyncHelper( request, handler, context ); } );
 }
 
+AddCustomAttributesOutcomeCallable CognitoIdentityProviderClient::AddCustomAttributesCallable(AddCustomAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AddCustomAttributes, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AddCustomAttributesAsync(AddCustomAttributesRequest&& request, const AddCustomAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AddCustomAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AddCustomAttributesAsyncHelper(const AddCustomAttributesRequest& request, const AddCustomAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddCustomAttributes(request), context);
@@ -189,7 +199,7 @@ AdminConfirmSignUpOutcome CognitoIdentityProviderClient::AdminConfirmSignUp(cons
 
 AdminConfirmSignUpOutcomeCallable CognitoIdentityProviderClient::AdminConfirmSignUpCallable(const AdminConfirmSignUpRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminConfirmSignUp(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminConfirmSignUp(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminConfirmSignUpAsync(const AdminConfirmSignUpRequest& request, const AdminConfirmSignUpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -197,6 +207,16 @@ void CognitoIdentityProviderClient::AdminConfirmSignUpAsync(const AdminConfirmSi
   m_executor->Submit( [this, request, handler, context](){ this->AdminConfirmSignUpAsyncHelper( request, handler, context ); } );
 }
 
+AdminConfirmSignUpOutcomeCallable CognitoIdentityProviderClient::AdminConfirmSignUpCallable(AdminConfirmSignUpRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminConfirmSignUp, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminConfirmSignUpAsync(AdminConfirmSignUpRequest&& request, const AdminConfirmSignUpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminConfirmSignUpAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminConfirmSignUpAsyncHelper(const AdminConfirmSignUpRequest& request, const AdminConfirmSignUpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminConfirmSignUp(request), context);
@@ -220,7 +240,7 @@ AdminDeleteUserOutcome CognitoIdentityProviderClient::AdminDeleteUser(const Admi
 
 AdminDeleteUserOutcomeCallable CognitoIdentityProviderClient::AdminDeleteUserCallable(const AdminDeleteUserRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminDeleteUser(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminDeleteUser(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminDeleteUserAsync(const AdminDeleteUserRequest& request, const AdminDeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -228,6 +248,16 @@ void CognitoIdentityProviderClient::AdminDeleteUserAsync(const AdminDeleteUserRe
   m_executor->Submit( [this, request, handler, context](){ this->AdminDeleteUserAsyncHelper( request, handler, context ); } );
 }
 
+AdminDeleteUserOutcomeCallable CognitoIdentityProviderClient::AdminDeleteUserCallable(AdminDeleteUserRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminDeleteUser, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminDeleteUserAsync(AdminDeleteUserRequest&& request, const AdminDeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminDeleteUserAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminDeleteUserAsyncHelper(const AdminDeleteUserRequest& request, const AdminDeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminDeleteUser(request), context);
@@ -251,7 +281,7 @@ AdminDeleteUserAttributesOutcome CognitoIdentityProviderClient::AdminDeleteUserA
 
 AdminDeleteUserAttributesOutcomeCallable CognitoIdentityProviderClient::AdminDeleteUserAttributesCallable(const AdminDeleteUserAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminDeleteUserAttributes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminDeleteUserAttributes(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminDeleteUserAttributesAsync(const AdminDeleteUserAttributesRequest& request, const AdminDeleteUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -259,6 +289,16 @@ void CognitoIdentityProviderClient::AdminDeleteUserAttributesAsync(const AdminDe
   m_executor->Submit( [this, request, handler, context](){ this->AdminDeleteUserAttributesAsyncHelper( request, handler, context ); } );
 }
 
+AdminDeleteUserAttributesOutcomeCallable CognitoIdentityProviderClient::AdminDeleteUserAttributesCallable(AdminDeleteUserAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminDeleteUserAttributes, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminDeleteUserAttributesAsync(AdminDeleteUserAttributesRequest&& request, const AdminDeleteUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminDeleteUserAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminDeleteUserAttributesAsyncHelper(const AdminDeleteUserAttributesRequest& request, const AdminDeleteUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminDeleteUserAttributes(request), context);
@@ -282,7 +322,7 @@ AdminDisableUserOutcome CognitoIdentityProviderClient::AdminDisableUser(const Ad
 
 AdminDisableUserOutcomeCallable CognitoIdentityProviderClient::AdminDisableUserCallable(const AdminDisableUserRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminDisableUser(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminDisableUser(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminDisableUserAsync(const AdminDisableUserRequest& request, const AdminDisableUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -290,6 +330,16 @@ void CognitoIdentityProviderClient::AdminDisableUserAsync(const AdminDisableUser
   m_executor->Submit( [this, request, handler, context](){ this->AdminDisableUserAsyncHelper( request, handler, context ); } );
 }
 
+AdminDisableUserOutcomeCallable CognitoIdentityProviderClient::AdminDisableUserCallable(AdminDisableUserRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminDisableUser, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminDisableUserAsync(AdminDisableUserRequest&& request, const AdminDisableUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminDisableUserAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminDisableUserAsyncHelper(const AdminDisableUserRequest& request, const AdminDisableUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminDisableUser(request), context);
@@ -313,7 +363,7 @@ AdminEnableUserOutcome CognitoIdentityProviderClient::AdminEnableUser(const Admi
 
 AdminEnableUserOutcomeCallable CognitoIdentityProviderClient::AdminEnableUserCallable(const AdminEnableUserRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminEnableUser(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminEnableUser(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminEnableUserAsync(const AdminEnableUserRequest& request, const AdminEnableUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -321,6 +371,16 @@ void CognitoIdentityProviderClient::AdminEnableUserAsync(const AdminEnableUserRe
   m_executor->Submit( [this, request, handler, context](){ this->AdminEnableUserAsyncHelper( request, handler, context ); } );
 }
 
+AdminEnableUserOutcomeCallable CognitoIdentityProviderClient::AdminEnableUserCallable(AdminEnableUserRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminEnableUser, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminEnableUserAsync(AdminEnableUserRequest&& request, const AdminEnableUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminEnableUserAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminEnableUserAsyncHelper(const AdminEnableUserRequest& request, const AdminEnableUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminEnableUser(request), context);
@@ -344,7 +404,7 @@ AdminForgetDeviceOutcome CognitoIdentityProviderClient::AdminForgetDevice(const
 
 AdminForgetDeviceOutcomeCallable CognitoIdentityProviderClient::AdminForgetDeviceCallable(const AdminForgetDeviceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminForgetDevice(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminForgetDevice(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminForgetDeviceAsync(const AdminForgetDeviceRequest& request, const AdminForgetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -352,6 +412,16 @@ void CognitoIdentityProviderClient::AdminForgetDeviceAsync(const AdminForgetDevi
   m_executor->Submit( [this, request, handler, context](){ this->AdminForgetDeviceAsyncHelper( request, handler, context ); } );
 }
 
+AdminForgetDeviceOutcomeCallable CognitoIdentityProviderClient::AdminForgetDeviceCallable(AdminForgetDeviceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminForgetDevice, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminForgetDeviceAsync(AdminForgetDeviceRequest&& request, const AdminForgetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminForgetDeviceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminForgetDeviceAsyncHelper(const AdminForgetDeviceRequest& request, const AdminForgetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminForgetDevice(request), context);
@@ -375,7 +445,7 @@ AdminGetDeviceOutcome CognitoIdentityProviderClient::AdminGetDevice(const AdminG
 
 AdminGetDeviceOutcomeCallable CognitoIdentityProviderClient::AdminGetDeviceCallable(const AdminGetDeviceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminGetDevice(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminGetDevice(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminGetDeviceAsync(const AdminGetDeviceRequest& request, const AdminGetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -383,6 +453,16 @@ void CognitoIdentityProviderClient::AdminGetDeviceAsync(const AdminGetDeviceRequ
   m_executor->Submit( [this, request, handler, context](){ this->AdminGetDeviceAsyncHelper( request, handler, context ); } );
 }
 
+AdminGetDeviceOutcomeCallable CognitoIdentityProviderClient::AdminGetDeviceCallable(AdminGetDeviceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminGetDevice, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminGetDeviceAsync(AdminGetDeviceRequest&& request, const AdminGetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminGetDeviceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminGetDeviceAsyncHelper(const AdminGetDeviceRequest& request, const AdminGetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminGetDevice(request), context);
@@ -406,7 +486,7 @@ AdminGetUserOutcome CognitoIdentityProviderClient::AdminGetUser(const AdminGetUs
 
 AdminGetUserOutcomeCallable CognitoIdentityProviderClient::AdminGetUserCallable(const AdminGetUserRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminGetUser(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminGetUser(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminGetUserAsync(const AdminGetUserRequest& request, const AdminGetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -414,6 +494,16 @@ void CognitoIdentityProviderClient::AdminGetUserAsync(const AdminGetUserRequest&
   m_executor->Submit( [this, request, handler, context](){ this->AdminGetUserAsyncHelper( request, handler, context ); } );
 }
 
+AdminGetUserOutcomeCallable CognitoIdentityProviderClient::AdminGetUserCallable(AdminGetUserRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminGetUser, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminGetUserAsync(AdminGetUserRequest&& request, const AdminGetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminGetUserAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminGetUserAsyncHelper(const AdminGetUserRequest& request, const AdminGetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminGetUser(request), context);
@@ -437,7 +527,7 @@ AdminInitiateAuthOutcome CognitoIdentityProviderClient::AdminInitiateAuth(const
 
 AdminInitiateAuthOutcomeCallable CognitoIdentityProviderClient::AdminInitiateAuthCallable(const AdminInitiateAuthRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminInitiateAuth(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminInitiateAuth(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminInitiateAuthAsync(const AdminInitiateAuthRequest& request, const AdminInitiateAuthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -445,6 +535,16 @@ void CognitoIdentityProviderClient::AdminInitiateAuthAsync(const AdminInitiateAu
   m_executor->Submit( [this, request, handler, context](){ this->AdminInitiateAuthAsyncHelper( request, handler, context ); } );
 }
 
+AdminInitiateAuthOutcomeCallable CognitoIdentityProviderClient::AdminInitiateAuthCallable(AdminInitiateAuthRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminInitiateAuth, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminInitiateAuthAsync(AdminInitiateAuthRequest&& request, const AdminInitiateAuthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminInitiateAuthAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminInitiateAuthAsyncHelper(const AdminInitiateAuthRequest& request, const AdminInitiateAuthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminInitiateAuth(request), context);
@@ -468,7 +568,7 @@ AdminListDevicesOutcome CognitoIdentityProviderClient::AdminListDevices(const Ad
 
 AdminListDevicesOutcomeCallable CognitoIdentityProviderClient::AdminListDevicesCallable(const AdminListDevicesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminListDevices(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminListDevices(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminListDevicesAsync(const AdminListDevicesRequest& request, const AdminListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -476,6 +576,16 @@ void CognitoIdentityProviderClient::AdminListDevicesAsync(const AdminListDevices
   m_executor->Submit( [this, request, handler, context](){ this->AdminListDevicesAsyncHelper( request, handler, context ); } );
 }
 
+AdminListDevicesOutcomeCallable CognitoIdentityProviderClient::AdminListDevicesCallable(AdminListDevicesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminListDevices, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminListDevicesAsync(AdminListDevicesRequest&& request, const AdminListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminListDevicesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminListDevicesAsyncHelper(const AdminListDevicesRequest& request, const AdminListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminListDevices(request), context);
@@ -499,7 +609,7 @@ AdminResetUserPasswordOutcome CognitoIdentityProviderClient::AdminResetUserPassw
 
 AdminResetUserPasswordOutcomeCallable CognitoIdentityProviderClient::AdminResetUserPasswordCallable(const AdminResetUserPasswordRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminResetUserPassword(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminResetUserPassword(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminResetUserPasswordAsync(const AdminResetUserPasswordRequest& request, const AdminResetUserPasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -507,6 +617,16 @@ void CognitoIdentityProviderClient::AdminResetUserPasswordAsync(const AdminReset
   m_executor->Submit( [this, request, handler, context](){ this->AdminResetUserPasswordAsyncHelper( request, handler, context ); } );
 }
 
+AdminResetUserPasswordOutcomeCallable CognitoIdentityProviderClient::AdminResetUserPasswordCallable(AdminResetUserPasswordRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminResetUserPassword, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminResetUserPasswordAsync(AdminResetUserPasswordRequest&& request, const AdminResetUserPasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminResetUserPasswordAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminResetUserPasswordAsyncHelper(const AdminResetUserPasswordRequest& request, const AdminResetUserPasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminResetUserPassword(request), context);
@@ -530,7 +650,7 @@ AdminRespondToAuthChallengeOutcome CognitoIdentityProviderClient::AdminRespondTo
 
 AdminRespondToAuthChallengeOutcomeCallable CognitoIdentityProviderClient::AdminRespondToAuthChallengeCallable(const AdminRespondToAuthChallengeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminRespondToAuthChallenge(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminRespondToAuthChallenge(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminRespondToAuthChallengeAsync(const AdminRespondToAuthChallengeRequest& request, const AdminRespondToAuthChallengeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -538,6 +658,16 @@ void CognitoIdentityProviderClient::AdminRespondToAuthChallengeAsync(const Admin
   m_executor->Submit( [this, request, handler, context](){ this->AdminRespondToAuthChallengeAsyncHelper( request, handler, context ); } );
 }
 
+AdminRespondToAuthChallengeOutcomeCallable CognitoIdentityProviderClient::AdminRespondToAuthChallengeCallable(AdminRespondToAuthChallengeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminRespondToAuthChallenge, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminRespondToAuthChallengeAsync(AdminRespondToAuthChallengeRequest&& request, const AdminRespondToAuthChallengeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminRespondToAuthChallengeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminRespondToAuthChallengeAsyncHelper(const AdminRespondToAuthChallengeRequest& request, const AdminRespondToAuthChallengeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminRespondToAuthChallenge(request), context);
@@ -561,7 +691,7 @@ AdminSetUserSettingsOutcome CognitoIdentityProviderClient::AdminSetUserSettings(
 
 AdminSetUserSettingsOutcomeCallable CognitoIdentityProviderClient::AdminSetUserSettingsCallable(const AdminSetUserSettingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminSetUserSettings(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminSetUserSettings(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminSetUserSettingsAsync(const AdminSetUserSettingsRequest& request, const AdminSetUserSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -569,6 +699,16 @@ void CognitoIdentityProviderClient::AdminSetUserSettingsAsync(const AdminSetUser
   m_executor->Submit( [this, request, handler, context](){ this->AdminSetUserSettingsAsyncHelper( request, handler, context ); } );
 }
 
+AdminSetUserSettingsOutcomeCallable CognitoIdentityProviderClient::AdminSetUserSettingsCallable(AdminSetUserSettingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminSetUserSettings, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminSetUserSettingsAsync(AdminSetUserSettingsRequest&& request, const AdminSetUserSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminSetUserSettingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminSetUserSettingsAsyncHelper(const AdminSetUserSettingsRequest& request, const AdminSetUserSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminSetUserSettings(request), context);
@@ -592,7 +732,7 @@ AdminUpdateDeviceStatusOutcome CognitoIdentityProviderClient::AdminUpdateDeviceS
 
 AdminUpdateDeviceStatusOutcomeCallable CognitoIdentityProviderClient::AdminUpdateDeviceStatusCallable(const AdminUpdateDeviceStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminUpdateDeviceStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminUpdateDeviceStatus(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminUpdateDeviceStatusAsync(const AdminUpdateDeviceStatusRequest& request, const AdminUpdateDeviceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -600,6 +740,16 @@ void CognitoIdentityProviderClient::AdminUpdateDeviceStatusAsync(const AdminUpda
   m_executor->Submit( [this, request, handler, context](){ this->AdminUpdateDeviceStatusAsyncHelper( request, handler, context ); } );
 }
 
+AdminUpdateDeviceStatusOutcomeCallable CognitoIdentityProviderClient::AdminUpdateDeviceStatusCallable(AdminUpdateDeviceStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminUpdateDeviceStatus, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminUpdateDeviceStatusAsync(AdminUpdateDeviceStatusRequest&& request, const AdminUpdateDeviceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminUpdateDeviceStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminUpdateDeviceStatusAsyncHelper(const AdminUpdateDeviceStatusRequest& request, const AdminUpdateDeviceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminUpdateDeviceStatus(request), context);
@@ -623,7 +773,7 @@ AdminUpdateUserAttributesOutcome CognitoIdentityProviderClient::AdminUpdateUserA
 
 AdminUpdateUserAttributesOutcomeCallable CognitoIdentityProviderClient::AdminUpdateUserAttributesCallable(const AdminUpdateUserAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminUpdateUserAttributes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminUpdateUserAttributes(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminUpdateUserAttributesAsync(const AdminUpdateUserAttributesRequest& request, const AdminUpdateUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -631,6 +781,16 @@ void CognitoIdentityProviderClient::AdminUpdateUserAttributesAsync(const AdminUp
   m_executor->Submit( [this, request, handler, context](){ this->AdminUpdateUserAttributesAsyncHelper( request, handler, context ); } );
 }
 
+AdminUpdateUserAttributesOutcomeCallable CognitoIdentityProviderClient::AdminUpdateUserAttributesCallable(AdminUpdateUserAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminUpdateUserAttributes, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminUpdateUserAttributesAsync(AdminUpdateUserAttributesRequest&& request, const AdminUpdateUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminUpdateUserAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminUpdateUserAttributesAsyncHelper(const AdminUpdateUserAttributesRequest& request, const AdminUpdateUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminUpdateUserAttributes(request), context);
@@ -654,7 +814,7 @@ AdminUserGlobalSignOutOutcome CognitoIdentityProviderClient::AdminUserGlobalSign
 
 AdminUserGlobalSignOutOutcomeCallable CognitoIdentityProviderClient::AdminUserGlobalSignOutCallable(const AdminUserGlobalSignOutRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AdminUserGlobalSignOut(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AdminUserGlobalSignOut(request); } );
 }
 
 void CognitoIdentityProviderClient::AdminUserGlobalSignOutAsync(const AdminUserGlobalSignOutRequest& request, const AdminUserGlobalSignOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -662,6 +822,16 @@ void CognitoIdentityProviderClient::AdminUserGlobalSignOutAsync(const AdminUserG
   m_executor->Submit( [this, request, handler, context](){ this->AdminUserGlobalSignOutAsyncHelper( request, handler, context ); } );
 }
 
+AdminUserGlobalSignOutOutcomeCallable CognitoIdentityProviderClient::AdminUserGlobalSignOutCallable(AdminUserGlobalSignOutRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::AdminUserGlobalSignOut, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::AdminUserGlobalSignOutAsync(AdminUserGlobalSignOutRequest&& request, const AdminUserGlobalSignOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::AdminUserGlobalSignOutAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::AdminUserGlobalSignOutAsyncHelper(const AdminUserGlobalSignOutRequest& request, const AdminUserGlobalSignOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AdminUserGlobalSignOut(request), context);
@@ -685,7 +855,7 @@ ChangePasswordOutcome CognitoIdentityProviderClient::ChangePassword(const Change
 
 ChangePasswordOutcomeCallable CognitoIdentityProviderClient::ChangePasswordCallable(const ChangePasswordRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ChangePassword(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ChangePassword(request); } );
 }
 
 void CognitoIdentityProviderClient::ChangePasswordAsync(const ChangePasswordRequest& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -693,6 +863,16 @@ void CognitoIdentityProviderClient::ChangePasswordAsync(const ChangePasswordRequ
   m_executor->Submit( [this, request, handler, context](){ this->ChangePasswordAsyncHelper( request, handler, context ); } );
 }
 
+ChangePasswordOutcomeCallable CognitoIdentityProviderClient::ChangePasswordCallable(ChangePasswordRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::ChangePassword, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::ChangePasswordAsync(ChangePasswordRequest&& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::ChangePasswordAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::ChangePasswordAsyncHelper(const ChangePasswordRequest& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ChangePassword(request), context);
@@ -716,7 +896,7 @@ ConfirmDeviceOutcome CognitoIdentityProviderClient::ConfirmDevice(const ConfirmD
 
 ConfirmDeviceOutcomeCallable CognitoIdentityProviderClient::ConfirmDeviceCallable(const ConfirmDeviceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ConfirmDevice(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ConfirmDevice(request); } );
 }
 
 void CognitoIdentityProviderClient::ConfirmDeviceAsync(const ConfirmDeviceRequest& request, const ConfirmDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -724,6 +904,16 @@ void CognitoIdentityProviderClient::ConfirmDeviceAsync(const ConfirmDeviceReques
   m_executor->Submit( [this, request, handler, context](){ this->ConfirmDeviceAsyncHelper( request, handler, context ); } );
 }
 
+ConfirmDeviceOutcomeCallable CognitoIdentityProviderClient::ConfirmDeviceCallable(ConfirmDeviceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::ConfirmDevice, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::ConfirmDeviceAsync(ConfirmDeviceRequest&& request, const ConfirmDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::ConfirmDeviceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::ConfirmDeviceAsyncHelper(const ConfirmDeviceRequest& request, const ConfirmDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ConfirmDevice(request), context);
@@ -747,7 +937,7 @@ ConfirmForgotPasswordOutcome CognitoIdentityProviderClient::ConfirmForgotPasswor
 
 ConfirmForgotPasswordOutcomeCallable CognitoIdentityProviderClient::ConfirmForgotPasswordCallable(const ConfirmForgotPasswordRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ConfirmForgotPassword(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ConfirmForgotPassword(request); } );
 }
 
 void CognitoIdentityProviderClient::ConfirmForgotPasswordAsync(const ConfirmForgotPasswordRequest& request, const ConfirmForgotPasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -755,6 +945,16 @@ void CognitoIdentityProviderClient::ConfirmForgotPasswordAsync(const ConfirmForg
   m_executor->Submit( [this, request, handler, context](){ this->ConfirmForgotPasswordAsyncHelper( request, handler, context ); } );
 }
 
+ConfirmForgotPasswordOutcomeCallable CognitoIdentityProviderClient::ConfirmForgotPasswordCallable(ConfirmForgotPasswordRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::ConfirmForgotPassword, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::ConfirmForgotPasswordAsync(ConfirmForgotPasswordRequest&& request, const ConfirmForgotPasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::ConfirmForgotPasswordAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::ConfirmForgotPasswordAsyncHelper(const ConfirmForgotPasswordRequest& request, const ConfirmForgotPasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ConfirmForgotPassword(request), context);
@@ -778,7 +978,7 @@ ConfirmSignUpOutcome CognitoIdentityProviderClient::ConfirmSignUp(const ConfirmS
 
 ConfirmSignUpOutcomeCallable CognitoIdentityProviderClient::ConfirmSignUpCallable(const ConfirmSignUpRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ConfirmSignUp(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ConfirmSignUp(request); } );
 }
 
 void CognitoIdentityProviderClient::ConfirmSignUpAsync(const ConfirmSignUpRequest& request, const ConfirmSignUpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -786,6 +986,16 @@ void CognitoIdentityProviderClient::ConfirmSignUpAsync(const ConfirmSignUpReques
   m_executor->Submit( [this, request, handler, context](){ this->ConfirmSignUpAsyncHelper( request, handler, context ); } );
 }
 
+ConfirmSignUpOutcomeCallable CognitoIdentityProviderClient::ConfirmSignUpCallable(ConfirmSignUpRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::ConfirmSignUp, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::ConfirmSignUpAsync(ConfirmSignUpRequest&& request, const ConfirmSignUpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::ConfirmSignUpAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::ConfirmSignUpAsyncHelper(const ConfirmSignUpRequest& request, const ConfirmSignUpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ConfirmSignUp(request), context);
@@ -809,7 +1019,7 @@ CreateUserPoolOutcome CognitoIdentityProviderClient::CreateUserPool(const Create
 
 CreateUserPoolOutcomeCallable CognitoIdentityProviderClient::CreateUserPoolCallable(const CreateUserPoolRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateUserPool(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateUserPool(request); } );
 }
 
 void CognitoIdentityProviderClient::CreateUserPoolAsync(const CreateUserPoolRequest& request, const CreateUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -817,6 +1027,16 @@ void CognitoIdentityProviderClient::CreateUserPoolAsync(const CreateUserPoolRequ
   m_executor->Submit( [this, request, handler, context](){ this->CreateUserPoolAsyncHelper( request, handler, context ); } );
 }
 
+CreateUserPoolOutcomeCallable CognitoIdentityProviderClient::CreateUserPoolCallable(CreateUserPoolRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::CreateUserPool, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::CreateUserPoolAsync(CreateUserPoolRequest&& request, const CreateUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::CreateUserPoolAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::CreateUserPoolAsyncHelper(const CreateUserPoolRequest& request, const CreateUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateUserPool(request), context);
@@ -840,7 +1060,7 @@ CreateUserPoolClientOutcome CognitoIdentityProviderClient::CreateUserPoolClient(
 
 CreateUserPoolClientOutcomeCallable CognitoIdentityProviderClient::CreateUserPoolClientCallable(const CreateUserPoolClientRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateUserPoolClient(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateUserPoolClient(request); } );
 }
 
 void CognitoIdentityProviderClient::CreateUserPoolClientAsync(const CreateUserPoolClientRequest& request, const CreateUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -848,6 +1068,16 @@ void CognitoIdentityProviderClient::CreateUserPoolClientAsync(const CreateUserPo
   m_executor->Submit( [this, request, handler, context](){ this->CreateUserPoolClientAsyncHelper( request, handler, context ); } );
 }
 
+CreateUserPoolClientOutcomeCallable CognitoIdentityProviderClient::CreateUserPoolClientCallable(CreateUserPoolClientRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::CreateUserPoolClient, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::CreateUserPoolClientAsync(CreateUserPoolClientRequest&& request, const CreateUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::CreateUserPoolClientAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::CreateUserPoolClientAsyncHelper(const CreateUserPoolClientRequest& request, const CreateUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateUserPoolClient(request), context);
@@ -871,7 +1101,7 @@ DeleteUserOutcome CognitoIdentityProviderClient::DeleteUser(const DeleteUserRequ
 
 DeleteUserOutcomeCallable CognitoIdentityProviderClient::DeleteUserCallable(const DeleteUserRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteUser(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteUser(request); } );
 }
 
 void CognitoIdentityProviderClient::DeleteUserAsync(const DeleteUserRequest& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -879,6 +1109,16 @@ void CognitoIdentityProviderClient::DeleteUserAsync(const DeleteUserRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DeleteUserAsyncHelper( request, handler, context ); } );
 }
 
+DeleteUserOutcomeCallable CognitoIdentityProviderClient::DeleteUserCallable(DeleteUserRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::DeleteUser, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::DeleteUserAsync(DeleteUserRequest&& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::DeleteUserAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::DeleteUserAsyncHelper(const DeleteUserRequest& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteUser(request), context);
@@ -902,7 +1142,7 @@ DeleteUserAttributesOutcome CognitoIdentityProviderClient::DeleteUserAttributes(
 
 DeleteUserAttributesOutcomeCallable CognitoIdentityProviderClient::DeleteUserAttributesCallable(const DeleteUserAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteUserAttributes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteUserAttributes(request); } );
 }
 
 void CognitoIdentityProviderClient::DeleteUserAttributesAsync(const DeleteUserAttributesRequest& request, const DeleteUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -910,6 +1150,16 @@ void CognitoIdentityProviderClient::DeleteUserAttributesAsync(const DeleteUserAt
   m_executor->Submit( [this, request, handler, context](){ this->DeleteUserAttributesAsyncHelper( request, handler, context ); } );
 }
 
+DeleteUserAttributesOutcomeCallable CognitoIdentityProviderClient::DeleteUserAttributesCallable(DeleteUserAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::DeleteUserAttributes, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::DeleteUserAttributesAsync(DeleteUserAttributesRequest&& request, const DeleteUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::DeleteUserAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::DeleteUserAttributesAsyncHelper(const DeleteUserAttributesRequest& request, const DeleteUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteUserAttributes(request), context);
@@ -933,7 +1183,7 @@ DeleteUserPoolOutcome CognitoIdentityProviderClient::DeleteUserPool(const Delete
 
 DeleteUserPoolOutcomeCallable CognitoIdentityProviderClient::DeleteUserPoolCallable(const DeleteUserPoolRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteUserPool(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteUserPool(request); } );
 }
 
 void CognitoIdentityProviderClient::DeleteUserPoolAsync(const DeleteUserPoolRequest& request, const DeleteUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -941,6 +1191,16 @@ void CognitoIdentityProviderClient::DeleteUserPoolAsync(const DeleteUserPoolRequ
   m_executor->Submit( [this, request, handler, context](){ this->DeleteUserPoolAsyncHelper( request, handler, context ); } );
 }
 
+DeleteUserPoolOutcomeCallable CognitoIdentityProviderClient::DeleteUserPoolCallable(DeleteUserPoolRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::DeleteUserPool, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::DeleteUserPoolAsync(DeleteUserPoolRequest&& request, const DeleteUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::DeleteUserPoolAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::DeleteUserPoolAsyncHelper(const DeleteUserPoolRequest& request, const DeleteUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteUserPool(request), context);
@@ -964,7 +1224,7 @@ DeleteUserPoolClientOutcome CognitoIdentityProviderClient::DeleteUserPoolClient(
 
 DeleteUserPoolClientOutcomeCallable CognitoIdentityProviderClient::DeleteUserPoolClientCallable(const DeleteUserPoolClientRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteUserPoolClient(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteUserPoolClient(request); } );
 }
 
 void CognitoIdentityProviderClient::DeleteUserPoolClientAsync(const DeleteUserPoolClientRequest& request, const DeleteUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -972,6 +1232,16 @@ void CognitoIdentityProviderClient::DeleteUserPoolClientAsync(const DeleteUserPo
   m_executor->Submit( [this, request, handler, context](){ this->DeleteUserPoolClientAsyncHelper( request, handler, context ); } );
 }
 
+DeleteUserPoolClientOutcomeCallable CognitoIdentityProviderClient::DeleteUserPoolClientCallable(DeleteUserPoolClientRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::DeleteUserPoolClient, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::DeleteUserPoolClientAsync(DeleteUserPoolClientRequest&& request, const DeleteUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::DeleteUserPoolClientAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::DeleteUserPoolClientAsyncHelper(const DeleteUserPoolClientRequest& request, const DeleteUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteUserPoolClient(request), context);
@@ -995,7 +1265,7 @@ DescribeUserPoolOutcome CognitoIdentityProviderClient::DescribeUserPool(const De
 
 DescribeUserPoolOutcomeCallable CognitoIdentityProviderClient::DescribeUserPoolCallable(const DescribeUserPoolRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeUserPool(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeUserPool(request); } );
 }
 
 void CognitoIdentityProviderClient::DescribeUserPoolAsync(const DescribeUserPoolRequest& request, const DescribeUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1003,6 +1273,16 @@ void CognitoIdentityProviderClient::DescribeUserPoolAsync(const DescribeUserPool
   m_executor->Submit( [this, request, handler, context](){ this->DescribeUserPoolAsyncHelper( request, handler, context ); } );
 }
 
+DescribeUserPoolOutcomeCallable CognitoIdentityProviderClient::DescribeUserPoolCallable(DescribeUserPoolRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::DescribeUserPool, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::DescribeUserPoolAsync(DescribeUserPoolRequest&& request, const DescribeUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::DescribeUserPoolAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::DescribeUserPoolAsyncHelper(const DescribeUserPoolRequest& request, const DescribeUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeUserPool(request), context);
@@ -1026,7 +1306,7 @@ DescribeUserPoolClientOutcome CognitoIdentityProviderClient::DescribeUserPoolCli
 
 DescribeUserPoolClientOutcomeCallable CognitoIdentityProviderClient::DescribeUserPoolClientCallable(const DescribeUserPoolClientRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeUserPoolClient(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeUserPoolClient(request); } );
 }
 
 void CognitoIdentityProviderClient::DescribeUserPoolClientAsync(const DescribeUserPoolClientRequest& request, const DescribeUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1034,6 +1314,16 @@ void CognitoIdentityProviderClient::DescribeUserPoolClientAsync(const DescribeUs
   m_executor->Submit( [this, request, handler, context](){ this->DescribeUserPoolClientAsyncHelper( request, handler, context ); } );
 }
 
+DescribeUserPoolClientOutcomeCallable CognitoIdentityProviderClient::DescribeUserPoolClientCallable(DescribeUserPoolClientRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::DescribeUserPoolClient, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::DescribeUserPoolClientAsync(DescribeUserPoolClientRequest&& request, const DescribeUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::DescribeUserPoolClientAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::DescribeUserPoolClientAsyncHelper(const DescribeUserPoolClientRequest& request, const DescribeUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeUserPoolClient(request), context);
@@ -1057,7 +1347,7 @@ ForgetDeviceOutcome CognitoIdentityProviderClient::ForgetDevice(const ForgetDevi
 
 ForgetDeviceOutcomeCallable CognitoIdentityProviderClient::ForgetDeviceCallable(const ForgetDeviceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ForgetDevice(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ForgetDevice(request); } );
 }
 
 void CognitoIdentityProviderClient::ForgetDeviceAsync(const ForgetDeviceRequest& request, const ForgetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1065,6 +1355,16 @@ void CognitoIdentityProviderClient::ForgetDeviceAsync(const ForgetDeviceRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ForgetDeviceAsyncHelper( request, handler, context ); } );
 }
 
+ForgetDeviceOutcomeCallable CognitoIdentityProviderClient::ForgetDeviceCallable(ForgetDeviceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::ForgetDevice, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::ForgetDeviceAsync(ForgetDeviceRequest&& request, const ForgetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::ForgetDeviceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::ForgetDeviceAsyncHelper(const ForgetDeviceRequest& request, const ForgetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ForgetDevice(request), context);
@@ -1088,7 +1388,7 @@ ForgotPasswordOutcome CognitoIdentityProviderClient::ForgotPassword(const Forgot
 
 ForgotPasswordOutcomeCallable CognitoIdentityProviderClient::ForgotPasswordCallable(const ForgotPasswordRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ForgotPassword(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ForgotPassword(request); } );
 }
 
 void CognitoIdentityProviderClient::ForgotPasswordAsync(const ForgotPasswordRequest& request, const ForgotPasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1096,6 +1396,16 @@ void CognitoIdentityProviderClient::ForgotPasswordAsync(const ForgotPasswordRequ
   m_executor->Submit( [this, request, handler, context](){ this->ForgotPasswordAsyncHelper( request, handler, context ); } );
 }
 
+ForgotPasswordOutcomeCallable CognitoIdentityProviderClient::ForgotPasswordCallable(ForgotPasswordRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::ForgotPassword, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::ForgotPasswordAsync(ForgotPasswordRequest&& request, const ForgotPasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::ForgotPasswordAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::ForgotPasswordAsyncHelper(const ForgotPasswordRequest& request, const ForgotPasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ForgotPassword(request), context);
@@ -1119,7 +1429,7 @@ GetDeviceOutcome CognitoIdentityProviderClient::GetDevice(const GetDeviceRequest
 
 GetDeviceOutcomeCallable CognitoIdentityProviderClient::GetDeviceCallable(const GetDeviceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDevice(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDevice(request); } );
 }
 
 void CognitoIdentityProviderClient::GetDeviceAsync(const GetDeviceRequest& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1127,6 +1437,16 @@ void CognitoIdentityProviderClient::GetDeviceAsync(const GetDeviceRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->GetDeviceAsyncHelper( request, handler, context ); } );
 }
 
+GetDeviceOutcomeCallable CognitoIdentityProviderClient::GetDeviceCallable(GetDeviceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::GetDevice, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::GetDeviceAsync(GetDeviceRequest&& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::GetDeviceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::GetDeviceAsyncHelper(const GetDeviceRequest& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDevice(request), context);
@@ -1150,7 +1470,7 @@ GetUserOutcome CognitoIdentityProviderClient::GetUser(const GetUserRequest& requ
 
 GetUserOutcomeCallable CognitoIdentityProviderClient::GetUserCallable(const GetUserRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetUser(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetUser(request); } );
 }
 
 void CognitoIdentityProviderClient::GetUserAsync(const GetUserRequest& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1158,6 +1478,16 @@ void CognitoIdentityProviderClient::GetUserAsync(const GetUserRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->GetUserAsyncHelper( request, handler, context ); } );
 }
 
+GetUserOutcomeCallable CognitoIdentityProviderClient::GetUserCallable(GetUserRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::GetUser, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::GetUserAsync(GetUserRequest&& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::GetUserAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::GetUserAsyncHelper(const GetUserRequest& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetUser(request), context);
@@ -1181,7 +1511,7 @@ GetUserAttributeVerificationCodeOutcome CognitoIdentityProviderClient::GetUserAt
 
 GetUserAttributeVerificationCodeOutcomeCallable CognitoIdentityProviderClient::GetUserAttributeVerificationCodeCallable(const GetUserAttributeVerificationCodeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetUserAttributeVerificationCode(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetUserAttributeVerificationCode(request); } );
 }
 
 void CognitoIdentityProviderClient::GetUserAttributeVerificationCodeAsync(const GetUserAttributeVerificationCodeRequest& request, const GetUserAttributeVerificationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1189,6 +1519,16 @@ void CognitoIdentityProviderClient::GetUserAttributeVerificationCodeAsync(const
   m_executor->Submit( [this, request, handler, context](){ this->GetUserAttributeVerificationCodeAsyncHelper( request, handler, context ); } );
 }
 
+GetUserAttributeVerificationCodeOutcomeCallable CognitoIdentityProviderClient::GetUserAttributeVerificationCodeCallable(GetUserAttributeVerificationCodeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::GetUserAttributeVerificationCode, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::GetUserAttributeVerificationCodeAsync(GetUserAttributeVerificationCodeRequest&& request, const GetUserAttributeVerificationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::GetUserAttributeVerificationCodeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::GetUserAttributeVerificationCodeAsyncHelper(const GetUserAttributeVerificationCodeRequest& request, const GetUserAttributeVerificationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetUserAttributeVerificationCode(request), context);
@@ -1212,7 +1552,7 @@ GlobalSignOutOutcome CognitoIdentityProviderClient::GlobalSignOut(const GlobalSi
 
 GlobalSignOutOutcomeCallable CognitoIdentityProviderClient::GlobalSignOutCallable(const GlobalSignOutRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GlobalSignOut(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GlobalSignOut(request); } );
 }
 
 void CognitoIdentityProviderClient::GlobalSignOutAsync(const GlobalSignOutRequest& request, const GlobalSignOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1220,6 +1560,16 @@ void CognitoIdentityProviderClient::GlobalSignOutAsync(const GlobalSignOutReques
   m_executor->Submit( [this, request, handler, context](){ this->GlobalSignOutAsyncHelper( request, handler, context ); } );
 }
 
+GlobalSignOutOutcomeCallable CognitoIdentityProviderClient::GlobalSignOutCallable(GlobalSignOutRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::GlobalSignOut, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::GlobalSignOutAsync(GlobalSignOutRequest&& request, const GlobalSignOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::GlobalSignOutAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::GlobalSignOutAsyncHelper(const GlobalSignOutRequest& request, const GlobalSignOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GlobalSignOut(request), context);
@@ -1243,7 +1593,7 @@ InitiateAuthOutcome CognitoIdentityProviderClient::InitiateAuth(const InitiateAu
 
 InitiateAuthOutcomeCallable CognitoIdentityProviderClient::InitiateAuthCallable(const InitiateAuthRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->InitiateAuth(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->InitiateAuth(request); } );
 }
 
 void CognitoIdentityProviderClient::InitiateAuthAsync(const InitiateAuthRequest& request, const InitiateAuthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1251,6 +1601,16 @@ void CognitoIdentityProviderClient::InitiateAuthAsync(const InitiateAuthRequest&
   m_executor->Submit( [this, request, handler, context](){ this->InitiateAuthAsyncHelper( request, handler, context ); } );
 }
 
+InitiateAuthOutcomeCallable CognitoIdentityProviderClient::InitiateAuthCallable(InitiateAuthRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::InitiateAuth, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::InitiateAuthAsync(InitiateAuthRequest&& request, const InitiateAuthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::InitiateAuthAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::InitiateAuthAsyncHelper(const InitiateAuthRequest& request, const InitiateAuthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, InitiateAuth(request), context);
@@ -1274,7 +1634,7 @@ ListDevicesOutcome CognitoIdentityProviderClient::ListDevices(const ListDevicesR
 
 ListDevicesOutcomeCallable CognitoIdentityProviderClient::ListDevicesCallable(const ListDevicesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDevices(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDevices(request); } );
 }
 
 void CognitoIdentityProviderClient::ListDevicesAsync(const ListDevicesRequest& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1282,6 +1642,16 @@ void CognitoIdentityProviderClient::ListDevicesAsync(const ListDevicesRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->ListDevicesAsyncHelper( request, handler, context ); } );
 }
 
+ListDevicesOutcomeCallable CognitoIdentityProviderClient::ListDevicesCallable(ListDevicesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::ListDevices, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::ListDevicesAsync(ListDevicesRequest&& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::ListDevicesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::ListDevicesAsyncHelper(const ListDevicesRequest& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDevices(request), context);
@@ -1305,7 +1675,7 @@ ListUserPoolClientsOutcome CognitoIdentityProviderClient::ListUserPoolClients(co
 
 ListUserPoolClientsOutcomeCallable CognitoIdentityProviderClient::ListUserPoolClientsCallable(const ListUserPoolClientsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListUserPoolClients(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListUserPoolClients(request); } );
 }
 
 void CognitoIdentityProviderClient::ListUserPoolClientsAsync(const ListUserPoolClientsRequest& request, const ListUserPoolClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1313,6 +1683,16 @@ void CognitoIdentityProviderClient::ListUserPoolClientsAsync(const ListUserPoolC
   m_executor->Submit( [this, request, handler, context](){ this->ListUserPoolClientsAsyncHelper( request, handler, context ); } );
 }
 
+ListUserPoolClientsOutcomeCallable CognitoIdentityProviderClient::ListUserPoolClientsCallable(ListUserPoolClientsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::ListUserPoolClients, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::ListUserPoolClientsAsync(ListUserPoolClientsRequest&& request, const ListUserPoolClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::ListUserPoolClientsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::ListUserPoolClientsAsyncHelper(const ListUserPoolClientsRequest& request, const ListUserPoolClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListUserPoolClients(request), context);
@@ -1336,7 +1716,7 @@ ListUserPoolsOutcome CognitoIdentityProviderClient::ListUserPools(const ListUser
 
 ListUserPoolsOutcomeCallable CognitoIdentityProviderClient::ListUserPoolsCallable(const ListUserPoolsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListUserPools(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListUserPools(request); } );
 }
 
 void CognitoIdentityProviderClient::ListUserPoolsAsync(const ListUserPoolsRequest& request, const ListUserPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1344,6 +1724,16 @@ void CognitoIdentityProviderClient::ListUserPoolsAsync(const ListUserPoolsReques
   m_executor->Submit( [this, request, handler, context](){ this->ListUserPoolsAsyncHelper( request, handler, context ); } );
 }
 
+ListUserPoolsOutcomeCallable CognitoIdentityProviderClient::ListUserPoolsCallable(ListUserPoolsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::ListUserPools, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::ListUserPoolsAsync(ListUserPoolsRequest&& request, const ListUserPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::ListUserPoolsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::ListUserPoolsAsyncHelper(const ListUserPoolsRequest& request, const ListUserPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListUserPools(request), context);
@@ -1367,7 +1757,7 @@ ListUsersOutcome CognitoIdentityProviderClient::ListUsers(const ListUsersRequest
 
 ListUsersOutcomeCallable CognitoIdentityProviderClient::ListUsersCallable(const ListUsersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListUsers(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListUsers(request); } );
 }
 
 void CognitoIdentityProviderClient::ListUsersAsync(const ListUsersRequest& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1375,6 +1765,16 @@ void CognitoIdentityProviderClient::ListUsersAsync(const ListUsersRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ListUsersAsyncHelper( request, handler, context ); } );
 }
 
+ListUsersOutcomeCallable CognitoIdentityProviderClient::ListUsersCallable(ListUsersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::ListUsers, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::ListUsersAsync(ListUsersRequest&& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::ListUsersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::ListUsersAsyncHelper(const ListUsersRequest& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListUsers(request), context);
@@ -1398,7 +1798,7 @@ ResendConfirmationCodeOutcome CognitoIdentityProviderClient::ResendConfirmationC
 
 ResendConfirmationCodeOutcomeCallable CognitoIdentityProviderClient::ResendConfirmationCodeCallable(const ResendConfirmationCodeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResendConfirmationCode(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResendConfirmationCode(request); } );
 }
 
 void CognitoIdentityProviderClient::ResendConfirmationCodeAsync(const ResendConfirmationCodeRequest& request, const ResendConfirmationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1406,6 +1806,16 @@ void CognitoIdentityProviderClient::ResendConfirmationCodeAsync(const ResendConf
   m_executor->Submit( [this, request, handler, context](){ this->ResendConfirmationCodeAsyncHelper( request, handler, context ); } );
 }
 
+ResendConfirmationCodeOutcomeCallable CognitoIdentityProviderClient::ResendConfirmationCodeCallable(ResendConfirmationCodeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::ResendConfirmationCode, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::ResendConfirmationCodeAsync(ResendConfirmationCodeRequest&& request, const ResendConfirmationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::ResendConfirmationCodeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::ResendConfirmationCodeAsyncHelper(const ResendConfirmationCodeRequest& request, const ResendConfirmationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResendConfirmationCode(request), context);
@@ -1429,7 +1839,7 @@ RespondToAuthChallengeOutcome CognitoIdentityProviderClient::RespondToAuthChalle
 
 RespondToAuthChallengeOutcomeCallable CognitoIdentityProviderClient::RespondToAuthChallengeCallable(const RespondToAuthChallengeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RespondToAuthChallenge(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RespondToAuthChallenge(request); } );
 }
 
 void CognitoIdentityProviderClient::RespondToAuthChallengeAsync(const RespondToAuthChallengeRequest& request, const RespondToAuthChallengeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1437,6 +1847,16 @@ void CognitoIdentityProviderClient::RespondToAuthChallengeAsync(const RespondToA
   m_executor->Submit( [this, request, handler, context](){ this->RespondToAuthChallengeAsyncHelper( request, handler, context ); } );
 }
 
+RespondToAuthChallengeOutcomeCallable CognitoIdentityProviderClient::RespondToAuthChallengeCallable(RespondToAuthChallengeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::RespondToAuthChallenge, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::RespondToAuthChallengeAsync(RespondToAuthChallengeRequest&& request, const RespondToAuthChallengeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::RespondToAuthChallengeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::RespondToAuthChallengeAsyncHelper(const RespondToAuthChallengeRequest& request, const RespondToAuthChallengeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RespondToAuthChallenge(request), context);
@@ -1460,7 +1880,7 @@ SetUserSettingsOutcome CognitoIdentityProviderClient::SetUserSettings(const SetU
 
 SetUserSettingsOutcomeCallable CognitoIdentityProviderClient::SetUserSettingsCallable(const SetUserSettingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetUserSettings(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetUserSettings(request); } );
 }
 
 void CognitoIdentityProviderClient::SetUserSettingsAsync(const SetUserSettingsRequest& request, const SetUserSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1468,6 +1888,16 @@ void CognitoIdentityProviderClient::SetUserSettingsAsync(const SetUserSettingsRe
   m_executor->Submit( [this, request, handler, context](){ this->SetUserSettingsAsyncHelper( request, handler, context ); } );
 }
 
+SetUserSettingsOutcomeCallable CognitoIdentityProviderClient::SetUserSettingsCallable(SetUserSettingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::SetUserSettings, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::SetUserSettingsAsync(SetUserSettingsRequest&& request, const SetUserSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::SetUserSettingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::SetUserSettingsAsyncHelper(const SetUserSettingsRequest& request, const SetUserSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetUserSettings(request), context);
@@ -1491,7 +1921,7 @@ SignUpOutcome CognitoIdentityProviderClient::SignUp(const SignUpRequest& request
 
 SignUpOutcomeCallable CognitoIdentityProviderClient::SignUpCallable(const SignUpRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SignUp(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SignUp(request); } );
 }
 
 void CognitoIdentityProviderClient::SignUpAsync(const SignUpRequest& request, const SignUpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1499,6 +1929,16 @@ void CognitoIdentityProviderClient::SignUpAsync(const SignUpRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->SignUpAsyncHelper( request, handler, context ); } );
 }
 
+SignUpOutcomeCallable CognitoIdentityProviderClient::SignUpCallable(SignUpRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::SignUp, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::SignUpAsync(SignUpRequest&& request, const SignUpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::SignUpAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::SignUpAsyncHelper(const SignUpRequest& request, const SignUpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SignUp(request), context);
@@ -1522,7 +1962,7 @@ UpdateDeviceStatusOutcome CognitoIdentityProviderClient::UpdateDeviceStatus(cons
 
 UpdateDeviceStatusOutcomeCallable CognitoIdentityProviderClient::UpdateDeviceStatusCallable(const UpdateDeviceStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateDeviceStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateDeviceStatus(request); } );
 }
 
 void CognitoIdentityProviderClient::UpdateDeviceStatusAsync(const UpdateDeviceStatusRequest& request, const UpdateDeviceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1530,6 +1970,16 @@ void CognitoIdentityProviderClient::UpdateDeviceStatusAsync(const UpdateDeviceSt
   m_executor->Submit( [this, request, handler, context](){ this->UpdateDeviceStatusAsyncHelper( request, handler, context ); } );
 }
 
+UpdateDeviceStatusOutcomeCallable CognitoIdentityProviderClient::UpdateDeviceStatusCallable(UpdateDeviceStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::UpdateDeviceStatus, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::UpdateDeviceStatusAsync(UpdateDeviceStatusRequest&& request, const UpdateDeviceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::UpdateDeviceStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::UpdateDeviceStatusAsyncHelper(const UpdateDeviceStatusRequest& request, const UpdateDeviceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateDeviceStatus(request), context);
@@ -1553,7 +2003,7 @@ UpdateUserAttributesOutcome CognitoIdentityProviderClient::UpdateUserAttributes(
 
 UpdateUserAttributesOutcomeCallable CognitoIdentityProviderClient::UpdateUserAttributesCallable(const UpdateUserAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateUserAttributes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateUserAttributes(request); } );
 }
 
 void CognitoIdentityProviderClient::UpdateUserAttributesAsync(const UpdateUserAttributesRequest& request, const UpdateUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1561,6 +2011,16 @@ void CognitoIdentityProviderClient::UpdateUserAttributesAsync(const UpdateUserAt
   m_executor->Submit( [this, request, handler, context](){ this->UpdateUserAttributesAsyncHelper( request, handler, context ); } );
 }
 
+UpdateUserAttributesOutcomeCallable CognitoIdentityProviderClient::UpdateUserAttributesCallable(UpdateUserAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::UpdateUserAttributes, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::UpdateUserAttributesAsync(UpdateUserAttributesRequest&& request, const UpdateUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::UpdateUserAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::UpdateUserAttributesAsyncHelper(const UpdateUserAttributesRequest& request, const UpdateUserAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateUserAttributes(request), context);
@@ -1584,7 +2044,7 @@ UpdateUserPoolOutcome CognitoIdentityProviderClient::UpdateUserPool(const Update
 
 UpdateUserPoolOutcomeCallable CognitoIdentityProviderClient::UpdateUserPoolCallable(const UpdateUserPoolRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateUserPool(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateUserPool(request); } );
 }
 
 void CognitoIdentityProviderClient::UpdateUserPoolAsync(const UpdateUserPoolRequest& request, const UpdateUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1592,6 +2052,16 @@ void CognitoIdentityProviderClient::UpdateUserPoolAsync(const UpdateUserPoolRequ
   m_executor->Submit( [this, request, handler, context](){ this->UpdateUserPoolAsyncHelper( request, handler, context ); } );
 }
 
+UpdateUserPoolOutcomeCallable CognitoIdentityProviderClient::UpdateUserPoolCallable(UpdateUserPoolRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::UpdateUserPool, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::UpdateUserPoolAsync(UpdateUserPoolRequest&& request, const UpdateUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::UpdateUserPoolAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::UpdateUserPoolAsyncHelper(const UpdateUserPoolRequest& request, const UpdateUserPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateUserPool(request), context);
@@ -1615,7 +2085,7 @@ UpdateUserPoolClientOutcome CognitoIdentityProviderClient::UpdateUserPoolClient(
 
 UpdateUserPoolClientOutcomeCallable CognitoIdentityProviderClient::UpdateUserPoolClientCallable(const UpdateUserPoolClientRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateUserPoolClient(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateUserPoolClient(request); } );
 }
 
 void CognitoIdentityProviderClient::UpdateUserPoolClientAsync(const UpdateUserPoolClientRequest& request, const UpdateUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1623,6 +2093,16 @@ void CognitoIdentityProviderClient::UpdateUserPoolClientAsync(const UpdateUserPo
   m_executor->Submit( [this, request, handler, context](){ this->UpdateUserPoolClientAsyncHelper( request, handler, context ); } );
 }
 
+UpdateUserPoolClientOutcomeCallable CognitoIdentityProviderClient::UpdateUserPoolClientCallable(UpdateUserPoolClientRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::UpdateUserPoolClient, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::UpdateUserPoolClientAsync(UpdateUserPoolClientRequest&& request, const UpdateUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::UpdateUserPoolClientAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::UpdateUserPoolClientAsyncHelper(const UpdateUserPoolClientRequest& request, const UpdateUserPoolClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateUserPoolClient(request), context);
@@ -1646,7 +2126,7 @@ VerifyUserAttributeOutcome CognitoIdentityProviderClient::VerifyUserAttribute(co
 
 VerifyUserAttributeOutcomeCallable CognitoIdentityProviderClient::VerifyUserAttributeCallable(const VerifyUserAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->VerifyUserAttribute(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->VerifyUserAttribute(request); } );
 }
 
 void CognitoIdentityProviderClient::VerifyUserAttributeAsync(const VerifyUserAttributeRequest& request, const VerifyUserAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1654,8 +2134,350 @@ void CognitoIdentityProviderClient::VerifyUserAttributeAsync(const VerifyUserAtt
   m_executor->Submit( [this, request, handler, context](){ this->VerifyUserAttributeAsyncHelper( request, handler, context ); } );
 }
 
+VerifyUserAttributeOutcomeCallable CognitoIdentityProviderClient::VerifyUserAttributeCallable(VerifyUserAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoIdentityProviderClient::VerifyUserAttribute, this, std::move(request)));
+}
+
+void CognitoIdentityProviderClient::VerifyUserAttributeAsync(VerifyUserAttributeRequest&& request, const VerifyUserAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoIdentityProviderClient::VerifyUserAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoIdentityProviderClient::VerifyUserAttributeAsyncHelper(const VerifyUserAttributeRequest& request, const VerifyUserAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, VerifyUserAttribute(request), context);
 }
 
+Paginator<CognitoIdentityProviderClient, AdminListDevicesRequest, AdminListDevicesOutcome> CognitoIdentityProviderClient::AdminListDevicesPaginator(const AdminListDevicesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CognitoIdentityProviderClient, AdminListDevicesRequest, AdminListDevicesOutcome>(this, &CognitoIdentityProviderClient::AdminListDevices, request,
+    [](const AdminListDevicesRequest& current, const AdminListDevicesOutcome& outcome, AdminListDevicesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetPaginationToken();
+      if(token.empty() || token == current.GetPaginationToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPaginationToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CognitoIdentityProviderClient, ListDevicesRequest, ListDevicesOutcome> CognitoIdentityProviderClient::ListDevicesPaginator(const ListDevicesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CognitoIdentityProviderClient, ListDevicesRequest, ListDevicesOutcome>(this, &CognitoIdentityProviderClient::ListDevices, request,
+    [](const ListDevicesRequest& current, const ListDevicesOutcome& outcome, ListDevicesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetPaginationToken();
+      if(token.empty() || token == current.GetPaginationToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPaginationToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CognitoIdentityProviderClient, ListUserPoolClientsRequest, ListUserPoolClientsOutcome> CognitoIdentityProviderClient::ListUserPoolClientsPaginator(const ListUserPoolClientsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CognitoIdentityProviderClient, ListUserPoolClientsRequest, ListUserPoolClientsOutcome>(this, &CognitoIdentityProviderClient::ListUserPoolClients, request,
+    [](const ListUserPoolClientsRequest& current, const ListUserPoolClientsOutcome& outcome, ListUserPoolClientsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CognitoIdentityProviderClient, ListUserPoolsRequest, ListUserPoolsOutcome> CognitoIdentityProviderClient::ListUserPoolsPaginator(const ListUserPoolsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CognitoIdentityProviderClient, ListUserPoolsRequest, ListUserPoolsOutcome>(this, &CognitoIdentityProviderClient::ListUserPools, request,
+    [](const ListUserPoolsRequest& current, const ListUserPoolsOutcome& outcome, ListUserPoolsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CognitoIdentityProviderClient, ListUsersRequest, ListUsersOutcome> CognitoIdentityProviderClient::ListUsersPaginator(const ListUsersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CognitoIdentityProviderClient, ListUsersRequest, ListUsersOutcome>(this, &CognitoIdentityProviderClient::ListUsers, request,
+    [](const ListUsersRequest& current, const ListUsersOutcome& outcome, ListUsersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetPaginationToken();
+      if(token.empty() || token == current.GetPaginationToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPaginationToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<CognitoIdentityProviderClient, AddCustomAttributesRequest, AddCustomAttributesOutcome> CognitoIdentityProviderClient::AddCustomAttributesAwaitable(AddCustomAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AddCustomAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminConfirmSignUpRequest, AdminConfirmSignUpOutcome> CognitoIdentityProviderClient::AdminConfirmSignUpAwaitable(AdminConfirmSignUpRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminConfirmSignUp, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminDeleteUserRequest, AdminDeleteUserOutcome> CognitoIdentityProviderClient::AdminDeleteUserAwaitable(AdminDeleteUserRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminDeleteUser, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminDeleteUserAttributesRequest, AdminDeleteUserAttributesOutcome> CognitoIdentityProviderClient::AdminDeleteUserAttributesAwaitable(AdminDeleteUserAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminDeleteUserAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminDisableUserRequest, AdminDisableUserOutcome> CognitoIdentityProviderClient::AdminDisableUserAwaitable(AdminDisableUserRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminDisableUser, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminEnableUserRequest, AdminEnableUserOutcome> CognitoIdentityProviderClient::AdminEnableUserAwaitable(AdminEnableUserRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminEnableUser, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminForgetDeviceRequest, AdminForgetDeviceOutcome> CognitoIdentityProviderClient::AdminForgetDeviceAwaitable(AdminForgetDeviceRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminForgetDevice, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminGetDeviceRequest, AdminGetDeviceOutcome> CognitoIdentityProviderClient::AdminGetDeviceAwaitable(AdminGetDeviceRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminGetDevice, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminGetUserRequest, AdminGetUserOutcome> CognitoIdentityProviderClient::AdminGetUserAwaitable(AdminGetUserRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminGetUser, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminInitiateAuthRequest, AdminInitiateAuthOutcome> CognitoIdentityProviderClient::AdminInitiateAuthAwaitable(AdminInitiateAuthRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminInitiateAuth, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminListDevicesRequest, AdminListDevicesOutcome> CognitoIdentityProviderClient::AdminListDevicesAwaitable(AdminListDevicesRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminListDevices, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminResetUserPasswordRequest, AdminResetUserPasswordOutcome> CognitoIdentityProviderClient::AdminResetUserPasswordAwaitable(AdminResetUserPasswordRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminResetUserPassword, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminRespondToAuthChallengeRequest, AdminRespondToAuthChallengeOutcome> CognitoIdentityProviderClient::AdminRespondToAuthChallengeAwaitable(AdminRespondToAuthChallengeRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminRespondToAuthChallenge, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminSetUserSettingsRequest, AdminSetUserSettingsOutcome> CognitoIdentityProviderClient::AdminSetUserSettingsAwaitable(AdminSetUserSettingsRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminSetUserSettings, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminUpdateDeviceStatusRequest, AdminUpdateDeviceStatusOutcome> CognitoIdentityProviderClient::AdminUpdateDeviceStatusAwaitable(AdminUpdateDeviceStatusRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminUpdateDeviceStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminUpdateUserAttributesRequest, AdminUpdateUserAttributesOutcome> CognitoIdentityProviderClient::AdminUpdateUserAttributesAwaitable(AdminUpdateUserAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminUpdateUserAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, AdminUserGlobalSignOutRequest, AdminUserGlobalSignOutOutcome> CognitoIdentityProviderClient::AdminUserGlobalSignOutAwaitable(AdminUserGlobalSignOutRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::AdminUserGlobalSignOut, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, ChangePasswordRequest, ChangePasswordOutcome> CognitoIdentityProviderClient::ChangePasswordAwaitable(ChangePasswordRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::ChangePassword, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, ConfirmDeviceRequest, ConfirmDeviceOutcome> CognitoIdentityProviderClient::ConfirmDeviceAwaitable(ConfirmDeviceRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::ConfirmDevice, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, ConfirmForgotPasswordRequest, ConfirmForgotPasswordOutcome> CognitoIdentityProviderClient::ConfirmForgotPasswordAwaitable(ConfirmForgotPasswordRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::ConfirmForgotPassword, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, ConfirmSignUpRequest, ConfirmSignUpOutcome> CognitoIdentityProviderClient::ConfirmSignUpAwaitable(ConfirmSignUpRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::ConfirmSignUp, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, CreateUserPoolRequest, CreateUserPoolOutcome> CognitoIdentityProviderClient::CreateUserPoolAwaitable(CreateUserPoolRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::CreateUserPool, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, CreateUserPoolClientRequest, CreateUserPoolClientOutcome> CognitoIdentityProviderClient::CreateUserPoolClientAwaitable(CreateUserPoolClientRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::CreateUserPoolClient, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, DeleteUserRequest, DeleteUserOutcome> CognitoIdentityProviderClient::DeleteUserAwaitable(DeleteUserRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::DeleteUser, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, DeleteUserAttributesRequest, DeleteUserAttributesOutcome> CognitoIdentityProviderClient::DeleteUserAttributesAwaitable(DeleteUserAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::DeleteUserAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, DeleteUserPoolRequest, DeleteUserPoolOutcome> CognitoIdentityProviderClient::DeleteUserPoolAwaitable(DeleteUserPoolRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::DeleteUserPool, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, DeleteUserPoolClientRequest, DeleteUserPoolClientOutcome> CognitoIdentityProviderClient::DeleteUserPoolClientAwaitable(DeleteUserPoolClientRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::DeleteUserPoolClient, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, DescribeUserPoolRequest, DescribeUserPoolOutcome> CognitoIdentityProviderClient::DescribeUserPoolAwaitable(DescribeUserPoolRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::DescribeUserPool, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, DescribeUserPoolClientRequest, DescribeUserPoolClientOutcome> CognitoIdentityProviderClient::DescribeUserPoolClientAwaitable(DescribeUserPoolClientRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::DescribeUserPoolClient, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, ForgetDeviceRequest, ForgetDeviceOutcome> CognitoIdentityProviderClient::ForgetDeviceAwaitable(ForgetDeviceRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::ForgetDevice, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, ForgotPasswordRequest, ForgotPasswordOutcome> CognitoIdentityProviderClient::ForgotPasswordAwaitable(ForgotPasswordRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::ForgotPassword, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, GetDeviceRequest, GetDeviceOutcome> CognitoIdentityProviderClient::GetDeviceAwaitable(GetDeviceRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::GetDevice, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, GetUserRequest, GetUserOutcome> CognitoIdentityProviderClient::GetUserAwaitable(GetUserRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::GetUser, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, GetUserAttributeVerificationCodeRequest, GetUserAttributeVerificationCodeOutcome> CognitoIdentityProviderClient::GetUserAttributeVerificationCodeAwaitable(GetUserAttributeVerificationCodeRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::GetUserAttributeVerificationCode, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, GlobalSignOutRequest, GlobalSignOutOutcome> CognitoIdentityProviderClient::GlobalSignOutAwaitable(GlobalSignOutRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::GlobalSignOut, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, InitiateAuthRequest, InitiateAuthOutcome> CognitoIdentityProviderClient::InitiateAuthAwaitable(InitiateAuthRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::InitiateAuth, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, ListDevicesRequest, ListDevicesOutcome> CognitoIdentityProviderClient::ListDevicesAwaitable(ListDevicesRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::ListDevices, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, ListUserPoolClientsRequest, ListUserPoolClientsOutcome> CognitoIdentityProviderClient::ListUserPoolClientsAwaitable(ListUserPoolClientsRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::ListUserPoolClients, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, ListUserPoolsRequest, ListUserPoolsOutcome> CognitoIdentityProviderClient::ListUserPoolsAwaitable(ListUserPoolsRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::ListUserPools, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, ListUsersRequest, ListUsersOutcome> CognitoIdentityProviderClient::ListUsersAwaitable(ListUsersRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::ListUsers, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, ResendConfirmationCodeRequest, ResendConfirmationCodeOutcome> CognitoIdentityProviderClient::ResendConfirmationCodeAwaitable(ResendConfirmationCodeRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::ResendConfirmationCode, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, RespondToAuthChallengeRequest, RespondToAuthChallengeOutcome> CognitoIdentityProviderClient::RespondToAuthChallengeAwaitable(RespondToAuthChallengeRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::RespondToAuthChallenge, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, SetUserSettingsRequest, SetUserSettingsOutcome> CognitoIdentityProviderClient::SetUserSettingsAwaitable(SetUserSettingsRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::SetUserSettings, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, SignUpRequest, SignUpOutcome> CognitoIdentityProviderClient::SignUpAwaitable(SignUpRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::SignUp, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, UpdateDeviceStatusRequest, UpdateDeviceStatusOutcome> CognitoIdentityProviderClient::UpdateDeviceStatusAwaitable(UpdateDeviceStatusRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::UpdateDeviceStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, UpdateUserAttributesRequest, UpdateUserAttributesOutcome> CognitoIdentityProviderClient::UpdateUserAttributesAwaitable(UpdateUserAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::UpdateUserAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, UpdateUserPoolRequest, UpdateUserPoolOutcome> CognitoIdentityProviderClient::UpdateUserPoolAwaitable(UpdateUserPoolRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::UpdateUserPool, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, UpdateUserPoolClientRequest, UpdateUserPoolClientOutcome> CognitoIdentityProviderClient::UpdateUserPoolClientAwaitable(UpdateUserPoolClientRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::UpdateUserPoolClient, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoIdentityProviderClient, VerifyUserAttributeRequest, VerifyUserAttributeOutcome> CognitoIdentityProviderClient::VerifyUserAttributeAwaitable(VerifyUserAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoIdentityProviderClient::VerifyUserAttribute, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,26 +29,32 @@ namespace Aws
       namespace AliasAttributeTypeMapper
       {
 
-        static const int phone_number_HASH = HashingUtils::HashString("phone_number");
-        static const int email_HASH = HashingUtils::HashString("email");
-        static const int preferred_username_HASH = HashingUtils::HashString("preferred_username");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int phone_number_HASH = -612351174;
+        static const int email_HASH = 96619420;
+        static const int preferred_username_HASH = -1746981164;
 
 
         AliasAttributeType GetAliasAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == phone_number_HASH)
+          switch (hashCode)
           {
+          case phone_number_HASH:
             return AliasAttributeType::phone_number;
-          }
-          else if (hashCode == email_HASH)
-          {
+          case email_HASH:
             return AliasAttributeType::email;
-          }
-          else if (hashCode == preferred_username_HASH)
-          {
+          case preferred_username_HASH:
             return AliasAttributeType::preferred_username;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
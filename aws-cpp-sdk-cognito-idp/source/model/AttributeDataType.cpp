@@ -29,31 +29,35 @@ namespace Aws
       namespace AttributeDataTypeMapper
       {
 
-        static const int String_HASH = HashingUtils::HashString("String");
-        static const int Number_HASH = HashingUtils::HashString("Number");
-        static const int DateTime_HASH = HashingUtils::HashString("DateTime");
-        static const int Boolean_HASH = HashingUtils::HashString("Boolean");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int String_HASH = -1808118735;
+        static const int Number_HASH = -1950496919;
+        static const int DateTime_HASH = 1857393595;
+        static const int Boolean_HASH = 1729365000;
 
 
         AttributeDataType GetAttributeDataTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == String_HASH)
+          switch (hashCode)
           {
+          case String_HASH:
             return AttributeDataType::String;
-          }
-          else if (hashCode == Number_HASH)
-          {
+          case Number_HASH:
             return AttributeDataType::Number;
-          }
-          else if (hashCode == DateTime_HASH)
-          {
+          case DateTime_HASH:
             return AttributeDataType::DateTime;
-          }
-          else if (hashCode == Boolean_HASH)
-          {
+          case Boolean_HASH:
             return AttributeDataType::Boolean;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
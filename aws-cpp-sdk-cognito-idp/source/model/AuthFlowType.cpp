@@ -29,31 +29,35 @@ namespace Aws
       namespace AuthFlowTypeMapper
       {
 
-        static const int USER_SRP_AUTH_HASH = HashingUtils::HashString("USER_SRP_AUTH");
-        static const int REFRESH_TOKEN_AUTH_HASH = HashingUtils::HashString("REFRESH_TOKEN_AUTH");
-        static const int CUSTOM_AUTH_HASH = HashingUtils::HashString("CUSTOM_AUTH");
-        static const int ADMIN_NO_SRP_AUTH_HASH = HashingUtils::HashString("ADMIN_NO_SRP_AUTH");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int USER_SRP_AUTH_HASH = 1145514314;
+        static const int REFRESH_TOKEN_AUTH_HASH = -277458862;
+        static const int CUSTOM_AUTH_HASH = 404426166;
+        static const int ADMIN_NO_SRP_AUTH_HASH = 1330737924;
 
 
         AuthFlowType GetAuthFlowTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_SRP_AUTH_HASH)
+          switch (hashCode)
           {
+          case USER_SRP_AUTH_HASH:
             return AuthFlowType::USER_SRP_AUTH;
-          }
-          else if (hashCode == REFRESH_TOKEN_AUTH_HASH)
-          {
+          case REFRESH_TOKEN_AUTH_HASH:
             return AuthFlowType::REFRESH_TOKEN_AUTH;
-          }
-          else if (hashCode == CUSTOM_AUTH_HASH)
-          {
+          case CUSTOM_AUTH_HASH:
             return AuthFlowType::CUSTOM_AUTH;
-          }
-          else if (hashCode == ADMIN_NO_SRP_AUTH_HASH)
-          {
+          case ADMIN_NO_SRP_AUTH_HASH:
             return AuthFlowType::ADMIN_NO_SRP_AUTH;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
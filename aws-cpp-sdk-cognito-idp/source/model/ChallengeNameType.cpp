@@ -29,41 +29,41 @@ namespace Aws
       namespace ChallengeNameTypeMapper
       {
 
-        static const int SMS_MFA_HASH = HashingUtils::HashString("SMS_MFA");
-        static const int PASSWORD_VERIFIER_HASH = HashingUtils::HashString("PASSWORD_VERIFIER");
-        static const int CUSTOM_CHALLENGE_HASH = HashingUtils::HashString("CUSTOM_CHALLENGE");
-        static const int DEVICE_SRP_AUTH_HASH = HashingUtils::HashString("DEVICE_SRP_AUTH");
-        static const int DEVICE_PASSWORD_VERIFIER_HASH = HashingUtils::HashString("DEVICE_PASSWORD_VERIFIER");
-        static const int ADMIN_NO_SRP_AUTH_HASH = HashingUtils::HashString("ADMIN_NO_SRP_AUTH");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int SMS_MFA_HASH = -1362602558;
+        static const int PASSWORD_VERIFIER_HASH = -1737337862;
+        static const int CUSTOM_CHALLENGE_HASH = 645737717;
+        static const int DEVICE_SRP_AUTH_HASH = 325396255;
+        static const int DEVICE_PASSWORD_VERIFIER_HASH = 1362077265;
+        static const int ADMIN_NO_SRP_AUTH_HASH = 1330737924;
 
 
         ChallengeNameType GetChallengeNameTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SMS_MFA_HASH)
+          switch (hashCode)
           {
+          case SMS_MFA_HASH:
             return ChallengeNameType::SMS_MFA;
-          }
-          else if (hashCode == PASSWORD_VERIFIER_HASH)
-          {
+          case PASSWORD_VERIFIER_HASH:
             return ChallengeNameType::PASSWORD_VERIFIER;
-          }
-          else if (hashCode == CUSTOM_CHALLENGE_HASH)
-          {
+          case CUSTOM_CHALLENGE_HASH:
             return ChallengeNameType::CUSTOM_CHALLENGE;
-          }
-          else if (hashCode == DEVICE_SRP_AUTH_HASH)
-          {
+          case DEVICE_SRP_AUTH_HASH:
             return ChallengeNameType::DEVICE_SRP_AUTH;
-          }
-          else if (hashCode == DEVICE_PASSWORD_VERIFIER_HASH)
-          {
+          case DEVICE_PASSWORD_VERIFIER_HASH:
             return ChallengeNameType::DEVICE_PASSWORD_VERIFIER;
-          }
-          else if (hashCode == ADMIN_NO_SRP_AUTH_HASH)
-          {
+          case ADMIN_NO_SRP_AUTH_HASH:
             return ChallengeNameType::ADMIN_NO_SRP_AUTH;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace DeliveryMediumTypeMapper
       {
 
-        static const int SMS_HASH = HashingUtils::HashString("SMS");
-        static const int EMAIL_HASH = HashingUtils::HashString("EMAIL");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int SMS_HASH = 82233;
+        static const int EMAIL_HASH = 66081660;
 
 
         DeliveryMediumType GetDeliveryMediumTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SMS_HASH)
+          switch (hashCode)
           {
+          case SMS_HASH:
             return DeliveryMediumType::SMS;
-          }
-          else if (hashCode == EMAIL_HASH)
-          {
+          case EMAIL_HASH:
             return DeliveryMediumType::EMAIL;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
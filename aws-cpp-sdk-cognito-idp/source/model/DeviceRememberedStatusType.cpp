@@ -29,21 +29,29 @@ namespace Aws
       namespace DeviceRememberedStatusTypeMapper
       {
 
-        static const int remembered_HASH = HashingUtils::HashString("remembered");
-        static const int not_remembered_HASH = HashingUtils::HashString("not_remembered");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int remembered_HASH = 553550828;
+        static const int not_remembered_HASH = 1450720472;
 
 
         DeviceRememberedStatusType GetDeviceRememberedStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == remembered_HASH)
+          switch (hashCode)
           {
+          case remembered_HASH:
             return DeviceRememberedStatusType::remembered;
-          }
-          else if (hashCode == not_remembered_HASH)
-          {
+          case not_remembered_HASH:
             return DeviceRememberedStatusType::not_remembered;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace ExplicitAuthFlowsTypeMapper
       {
 
-        static const int ADMIN_NO_SRP_AUTH_HASH = HashingUtils::HashString("ADMIN_NO_SRP_AUTH");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ADMIN_NO_SRP_AUTH_HASH = 1330737924;
 
 
         ExplicitAuthFlowsType GetExplicitAuthFlowsTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADMIN_NO_SRP_AUTH_HASH)
+          switch (hashCode)
           {
+          case ADMIN_NO_SRP_AUTH_HASH:
             return ExplicitAuthFlowsType::ADMIN_NO_SRP_AUTH;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
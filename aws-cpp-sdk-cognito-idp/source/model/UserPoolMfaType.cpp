@@ -29,26 +29,32 @@ namespace Aws
       namespace UserPoolMfaTypeMapper
       {
 
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-        static const int ON_HASH = HashingUtils::HashString("ON");
-        static const int OPTIONAL_HASH = HashingUtils::HashString("OPTIONAL");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int OFF_HASH = 78159;
+        static const int ON_HASH = 2527;
+        static const int OPTIONAL_HASH = 703609696;
 
 
         UserPoolMfaType GetUserPoolMfaTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OFF_HASH)
+          switch (hashCode)
           {
+          case OFF_HASH:
             return UserPoolMfaType::OFF;
-          }
-          else if (hashCode == ON_HASH)
-          {
+          case ON_HASH:
             return UserPoolMfaType::ON;
-          }
-          else if (hashCode == OPTIONAL_HASH)
-          {
+          case OPTIONAL_HASH:
             return UserPoolMfaType::OPTIONAL;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
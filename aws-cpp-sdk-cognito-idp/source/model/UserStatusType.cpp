@@ -29,41 +29,41 @@ namespace Aws
       namespace UserStatusTypeMapper
       {
 
-        static const int UNCONFIRMED_HASH = HashingUtils::HashString("UNCONFIRMED");
-        static const int CONFIRMED_HASH = HashingUtils::HashString("CONFIRMED");
-        static const int ARCHIVED_HASH = HashingUtils::HashString("ARCHIVED");
-        static const int COMPROMISED_HASH = HashingUtils::HashString("COMPROMISED");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-        static const int RESET_REQUIRED_HASH = HashingUtils::HashString("RESET_REQUIRED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int UNCONFIRMED_HASH = 1417290950;
+        static const int CONFIRMED_HASH = 1982485311;
+        static const int ARCHIVED_HASH = -933681182;
+        static const int COMPROMISED_HASH = -429560054;
+        static const int UNKNOWN_HASH = 433141802;
+        static const int RESET_REQUIRED_HASH = -2024960849;
 
 
         UserStatusType GetUserStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNCONFIRMED_HASH)
+          switch (hashCode)
           {
+          case UNCONFIRMED_HASH:
             return UserStatusType::UNCONFIRMED;
-          }
-          else if (hashCode == CONFIRMED_HASH)
-          {
+          case CONFIRMED_HASH:
             return UserStatusType::CONFIRMED;
-          }
-          else if (hashCode == ARCHIVED_HASH)
-          {
+          case ARCHIVED_HASH:
             return UserStatusType::ARCHIVED;
-          }
-          else if (hashCode == COMPROMISED_HASH)
-          {
+          case COMPROMISED_HASH:
             return UserStatusType::COMPROMISED;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
+          case UNKNOWN_HASH:
             return UserStatusType::UNKNOWN;
-          }
-          else if (hashCode == RESET_REQUIRED_HASH)
-          {
+          case RESET_REQUIRED_HASH:
             return UserStatusType::RESET_REQUIRED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -38,6 +38,9 @@
 #include <aws/cognito-sync/model/UpdateRecordsResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -239,6 +242,18 @@ namespace Model
          */
         virtual void BulkPublishAsync(const Model::BulkPublishRequest& request, const BulkPublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BulkPublishCallable(const Model::BulkPublishRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BulkPublishOutcomeCallable BulkPublishCallable(Model::BulkPublishRequest&& request) const;
+
+        /**
+         * Same as BulkPublishAsync(const Model::BulkPublishRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BulkPublishAsync(Model::BulkPublishRequest&& request, const BulkPublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specific dataset. The dataset will be deleted permanently, and
          * the action can't be undone. Datasets that this dataset was merged with will no
@@ -270,6 +285,18 @@ namespace Model
          */
         virtual void DeleteDatasetAsync(const Model::DeleteDatasetRequest& request, const DeleteDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDatasetCallable(const Model::DeleteDatasetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDatasetOutcomeCallable DeleteDatasetCallable(Model::DeleteDatasetRequest&& request) const;
+
+        /**
+         * Same as DeleteDatasetAsync(const Model::DeleteDatasetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDatasetAsync(Model::DeleteDatasetRequest&& request, const DeleteDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets meta data about a dataset by identity and dataset name. With Amazon
          * Cognito Sync, each identity has access only to its own data. Thus, the
@@ -304,6 +331,18 @@ namespace Model
          */
         virtual void DescribeDatasetAsync(const Model::DescribeDatasetRequest& request, const DescribeDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDatasetCallable(const Model::DescribeDatasetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDatasetOutcomeCallable DescribeDatasetCallable(Model::DescribeDatasetRequest&& request) const;
+
+        /**
+         * Same as DescribeDatasetAsync(const Model::DescribeDatasetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDatasetAsync(Model::DescribeDatasetRequest&& request, const DescribeDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets usage details (for example, data storage) about a particular identity
          * pool.</p> <p>This API can only be called with developer credentials. You cannot
@@ -332,6 +371,18 @@ namespace Model
          */
         virtual void DescribeIdentityPoolUsageAsync(const Model::DescribeIdentityPoolUsageRequest& request, const DescribeIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeIdentityPoolUsageCallable(const Model::DescribeIdentityPoolUsageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeIdentityPoolUsageOutcomeCallable DescribeIdentityPoolUsageCallable(Model::DescribeIdentityPoolUsageRequest&& request) const;
+
+        /**
+         * Same as DescribeIdentityPoolUsageAsync(const Model::DescribeIdentityPoolUsageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeIdentityPoolUsageAsync(Model::DescribeIdentityPoolUsageRequest&& request, const DescribeIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets usage information for an identity, including number of datasets and data
          * usage.</p> <p>This API can be called with temporary user credentials provided by
@@ -357,6 +408,18 @@ namespace Model
          */
         virtual void DescribeIdentityUsageAsync(const Model::DescribeIdentityUsageRequest& request, const DescribeIdentityUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeIdentityUsageCallable(const Model::DescribeIdentityUsageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeIdentityUsageOutcomeCallable DescribeIdentityUsageCallable(Model::DescribeIdentityUsageRequest&& request) const;
+
+        /**
+         * Same as DescribeIdentityUsageAsync(const Model::DescribeIdentityUsageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeIdentityUsageAsync(Model::DescribeIdentityUsageRequest&& request, const DescribeIdentityUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Get the status of the last BulkPublish operation for an identity pool.</p>
          * <p>This API can only be called with developer credentials. You cannot call this
@@ -382,6 +445,18 @@ namespace Model
          */
         virtual void GetBulkPublishDetailsAsync(const Model::GetBulkPublishDetailsRequest& request, const GetBulkPublishDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBulkPublishDetailsCallable(const Model::GetBulkPublishDetailsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBulkPublishDetailsOutcomeCallable GetBulkPublishDetailsCallable(Model::GetBulkPublishDetailsRequest&& request) const;
+
+        /**
+         * Same as GetBulkPublishDetailsAsync(const Model::GetBulkPublishDetailsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBulkPublishDetailsAsync(Model::GetBulkPublishDetailsRequest&& request, const GetBulkPublishDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the events and the corresponding Lambda functions associated with an
          * identity pool.</p> <p>This API can only be called with developer credentials.
@@ -410,6 +485,18 @@ namespace Model
          */
         virtual void GetCognitoEventsAsync(const Model::GetCognitoEventsRequest& request, const GetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCognitoEventsCallable(const Model::GetCognitoEventsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetCognitoEventsOutcomeCallable GetCognitoEventsCallable(Model::GetCognitoEventsRequest&& request) const;
+
+        /**
+         * Same as GetCognitoEventsAsync(const Model::GetCognitoEventsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetCognitoEventsAsync(Model::GetCognitoEventsRequest&& request, const GetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the configuration settings of an identity pool.</p> <p>This API can only
          * be called with developer credentials. You cannot call this API with the
@@ -435,6 +522,18 @@ namespace Model
          */
         virtual void GetIdentityPoolConfigurationAsync(const Model::GetIdentityPoolConfigurationRequest& request, const GetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIdentityPoolConfigurationCallable(const Model::GetIdentityPoolConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetIdentityPoolConfigurationOutcomeCallable GetIdentityPoolConfigurationCallable(Model::GetIdentityPoolConfigurationRequest&& request) const;
+
+        /**
+         * Same as GetIdentityPoolConfigurationAsync(const Model::GetIdentityPoolConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetIdentityPoolConfigurationAsync(Model::GetIdentityPoolConfigurationRequest&& request, const GetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists datasets for an identity. With Amazon Cognito Sync, each identity has
          * access only to its own data. Thus, the credentials used to make this API call
@@ -469,6 +568,18 @@ namespace Model
          */
         virtual void ListDatasetsAsync(const Model::ListDatasetsRequest& request, const ListDatasetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDatasetsCallable(const Model::ListDatasetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDatasetsOutcomeCallable ListDatasetsCallable(Model::ListDatasetsRequest&& request) const;
+
+        /**
+         * Same as ListDatasetsAsync(const Model::ListDatasetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDatasetsAsync(Model::ListDatasetsRequest&& request, const ListDatasetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a list of identity pools registered with Cognito.</p>
          * <p>ListIdentityPoolUsage can only be called with developer credentials. You
@@ -497,6 +608,18 @@ namespace Model
          */
         virtual void ListIdentityPoolUsageAsync(const Model::ListIdentityPoolUsageRequest& request, const ListIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListIdentityPoolUsageCallable(const Model::ListIdentityPoolUsageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListIdentityPoolUsageOutcomeCallable ListIdentityPoolUsageCallable(Model::ListIdentityPoolUsageRequest&& request) const;
+
+        /**
+         * Same as ListIdentityPoolUsageAsync(const Model::ListIdentityPoolUsageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListIdentityPoolUsageAsync(Model::ListIdentityPoolUsageRequest&& request, const ListIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets paginated records, optionally changed after a particular sync count for
          * a dataset and identity. With Amazon Cognito Sync, each identity has access only
@@ -531,6 +654,18 @@ namespace Model
          */
         virtual void ListRecordsAsync(const Model::ListRecordsRequest& request, const ListRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRecordsCallable(const Model::ListRecordsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListRecordsOutcomeCallable ListRecordsCallable(Model::ListRecordsRequest&& request) const;
+
+        /**
+         * Same as ListRecordsAsync(const Model::ListRecordsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListRecordsAsync(Model::ListRecordsRequest&& request, const ListRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers a device to receive push sync notifications.</p> <p>This API can
          * only be called with temporary credentials provided by Cognito Identity. You
@@ -556,6 +691,18 @@ namespace Model
          */
         virtual void RegisterDeviceAsync(const Model::RegisterDeviceRequest& request, const RegisterDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterDeviceCallable(const Model::RegisterDeviceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterDeviceOutcomeCallable RegisterDeviceCallable(Model::RegisterDeviceRequest&& request) const;
+
+        /**
+         * Same as RegisterDeviceAsync(const Model::RegisterDeviceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterDeviceAsync(Model::RegisterDeviceRequest&& request, const RegisterDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the AWS Lambda function for a given event type for an identity pool.
          * This request only updates the key/value pair specified. Other key/values pairs
@@ -590,6 +737,18 @@ namespace Model
          */
         virtual void SetCognitoEventsAsync(const Model::SetCognitoEventsRequest& request, const SetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetCognitoEventsCallable(const Model::SetCognitoEventsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetCognitoEventsOutcomeCallable SetCognitoEventsCallable(Model::SetCognitoEventsRequest&& request) const;
+
+        /**
+         * Same as SetCognitoEventsAsync(const Model::SetCognitoEventsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetCognitoEventsAsync(Model::SetCognitoEventsRequest&& request, const SetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the necessary configuration for push sync.</p> <p>This API can only be
          * called with developer credentials. You cannot call this API with the temporary
@@ -615,6 +774,18 @@ namespace Model
          */
         virtual void SetIdentityPoolConfigurationAsync(const Model::SetIdentityPoolConfigurationRequest& request, const SetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetIdentityPoolConfigurationCallable(const Model::SetIdentityPoolConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetIdentityPoolConfigurationOutcomeCallable SetIdentityPoolConfigurationCallable(Model::SetIdentityPoolConfigurationRequest&& request) const;
+
+        /**
+         * Same as SetIdentityPoolConfigurationAsync(const Model::SetIdentityPoolConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetIdentityPoolConfigurationAsync(Model::SetIdentityPoolConfigurationRequest&& request, const SetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Subscribes to receive notifications when a dataset is modified by another
          * device.</p> <p>This API can only be called with temporary credentials provided
@@ -640,6 +811,18 @@ namespace Model
          */
         virtual void SubscribeToDatasetAsync(const Model::SubscribeToDatasetRequest& request, const SubscribeToDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SubscribeToDatasetCallable(const Model::SubscribeToDatasetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SubscribeToDatasetOutcomeCallable SubscribeToDatasetCallable(Model::SubscribeToDatasetRequest&& request) const;
+
+        /**
+         * Same as SubscribeToDatasetAsync(const Model::SubscribeToDatasetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SubscribeToDatasetAsync(Model::SubscribeToDatasetRequest&& request, const SubscribeToDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Unsubscribes from receiving notifications when a dataset is modified by
          * another device.</p> <p>This API can only be called with temporary credentials
@@ -668,6 +851,18 @@ namespace Model
          */
         virtual void UnsubscribeFromDatasetAsync(const Model::UnsubscribeFromDatasetRequest& request, const UnsubscribeFromDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnsubscribeFromDatasetCallable(const Model::UnsubscribeFromDatasetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UnsubscribeFromDatasetOutcomeCallable UnsubscribeFromDatasetCallable(Model::UnsubscribeFromDatasetRequest&& request) const;
+
+        /**
+         * Same as UnsubscribeFromDatasetAsync(const Model::UnsubscribeFromDatasetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UnsubscribeFromDatasetAsync(Model::UnsubscribeFromDatasetRequest&& request, const UnsubscribeFromDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Posts updates to records and adds and deletes records for a dataset and
          * user.</p> <p>The sync count in the record patch is your last known sync count
@@ -720,6 +915,120 @@ namespace Model
          */
         virtual void UpdateRecordsAsync(const Model::UpdateRecordsRequest& request, const UpdateRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateRecordsCallable(const Model::UpdateRecordsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateRecordsOutcomeCallable UpdateRecordsCallable(Model::UpdateRecordsRequest&& request) const;
+
+        /**
+         * Same as UpdateRecordsAsync(const Model::UpdateRecordsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateRecordsAsync(Model::UpdateRecordsRequest&& request, const UpdateRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListDatasets(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CognitoSyncClient, Model::ListDatasetsRequest, Model::ListDatasetsOutcome> ListDatasetsPaginator(const Model::ListDatasetsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListIdentityPoolUsage(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CognitoSyncClient, Model::ListIdentityPoolUsageRequest, Model::ListIdentityPoolUsageOutcome> ListIdentityPoolUsagePaginator(const Model::ListIdentityPoolUsageRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListRecords(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CognitoSyncClient, Model::ListRecordsRequest, Model::ListRecordsOutcome> ListRecordsPaginator(const Model::ListRecordsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of BulkPublish(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::BulkPublishRequest, Model::BulkPublishOutcome> BulkPublishAwaitable(Model::BulkPublishRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDataset(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::DeleteDatasetRequest, Model::DeleteDatasetOutcome> DeleteDatasetAwaitable(Model::DeleteDatasetRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDataset(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::DescribeDatasetRequest, Model::DescribeDatasetOutcome> DescribeDatasetAwaitable(Model::DescribeDatasetRequest request) const;
+
+        /**
+         * co_await-able form of DescribeIdentityPoolUsage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::DescribeIdentityPoolUsageRequest, Model::DescribeIdentityPoolUsageOutcome> DescribeIdentityPoolUsageAwaitable(Model::DescribeIdentityPoolUsageRequest request) const;
+
+        /**
+         * co_await-able form of DescribeIdentityUsage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::DescribeIdentityUsageRequest, Model::DescribeIdentityUsageOutcome> DescribeIdentityUsageAwaitable(Model::DescribeIdentityUsageRequest request) const;
+
+        /**
+         * co_await-able form of GetBulkPublishDetails(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::GetBulkPublishDetailsRequest, Model::GetBulkPublishDetailsOutcome> GetBulkPublishDetailsAwaitable(Model::GetBulkPublishDetailsRequest request) const;
+
+        /**
+         * co_await-able form of GetCognitoEvents(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::GetCognitoEventsRequest, Model::GetCognitoEventsOutcome> GetCognitoEventsAwaitable(Model::GetCognitoEventsRequest request) const;
+
+        /**
+         * co_await-able form of GetIdentityPoolConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::GetIdentityPoolConfigurationRequest, Model::GetIdentityPoolConfigurationOutcome> GetIdentityPoolConfigurationAwaitable(Model::GetIdentityPoolConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of ListDatasets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::ListDatasetsRequest, Model::ListDatasetsOutcome> ListDatasetsAwaitable(Model::ListDatasetsRequest request) const;
+
+        /**
+         * co_await-able form of ListIdentityPoolUsage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::ListIdentityPoolUsageRequest, Model::ListIdentityPoolUsageOutcome> ListIdentityPoolUsageAwaitable(Model::ListIdentityPoolUsageRequest request) const;
+
+        /**
+         * co_await-able form of ListRecords(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::ListRecordsRequest, Model::ListRecordsOutcome> ListRecordsAwaitable(Model::ListRecordsRequest request) const;
+
+        /**
+         * co_await-able form of RegisterDevice(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::RegisterDeviceRequest, Model::RegisterDeviceOutcome> RegisterDeviceAwaitable(Model::RegisterDeviceRequest request) const;
+
+        /**
+         * co_await-able form of SetCognitoEvents(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::SetCognitoEventsRequest, Model::SetCognitoEventsOutcome> SetCognitoEventsAwaitable(Model::SetCognitoEventsRequest request) const;
+
+        /**
+         * co_await-able form of SetIdentityPoolConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::SetIdentityPoolConfigurationRequest, Model::SetIdentityPoolConfigurationOutcome> SetIdentityPoolConfigurationAwaitable(Model::SetIdentityPoolConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of SubscribeToDataset(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::SubscribeToDatasetRequest, Model::SubscribeToDatasetOutcome> SubscribeToDatasetAwaitable(Model::SubscribeToDatasetRequest request) const;
+
+        /**
+         * co_await-able form of UnsubscribeFromDataset(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::UnsubscribeFromDatasetRequest, Model::UnsubscribeFromDatasetOutcome> UnsubscribeFromDatasetAwaitable(Model::UnsubscribeFromDatasetRequest request) const;
+
+        /**
+         * co_await-able form of UpdateRecords(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CognitoSyncClient, Model::UpdateRecordsRequest, Model::UpdateRecordsOutcome> UpdateRecordsAwaitable(Model::UpdateRecordsRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     BulkPublishRequest();
+    inline const char* GetServiceRequestName() const override { return "BulkPublish"; }
+
     Aws::String SerializePayload() const override;
 
     /**
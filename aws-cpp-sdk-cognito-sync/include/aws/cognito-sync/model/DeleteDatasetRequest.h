@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDatasetRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDataset"; }
+
     Aws::String SerializePayload() const override;
 
     /**
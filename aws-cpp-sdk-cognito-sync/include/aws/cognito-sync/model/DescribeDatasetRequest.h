@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeDatasetRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDataset"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeIdentityPoolUsageRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeIdentityPoolUsage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeIdentityUsageRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeIdentityUsage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
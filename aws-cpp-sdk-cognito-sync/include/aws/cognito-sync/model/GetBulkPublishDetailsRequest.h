@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetBulkPublishDetailsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBulkPublishDetails"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetCognitoEventsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetCognitoEvents"; }
+
     Aws::String SerializePayload() const override;
 
     /**
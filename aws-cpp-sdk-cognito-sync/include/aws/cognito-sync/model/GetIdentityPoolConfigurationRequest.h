@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetIdentityPoolConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "GetIdentityPoolConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
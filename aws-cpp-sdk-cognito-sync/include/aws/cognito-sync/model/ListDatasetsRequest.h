@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListDatasetsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListDatasets"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
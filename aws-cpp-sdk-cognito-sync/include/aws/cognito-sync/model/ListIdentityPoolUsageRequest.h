@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListIdentityPoolUsageRequest();
+    inline const char* GetServiceRequestName() const override { return "ListIdentityPoolUsage"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
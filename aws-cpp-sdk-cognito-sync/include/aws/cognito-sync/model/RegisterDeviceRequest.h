@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RegisterDeviceRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterDevice"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetCognitoEventsRequest();
+    inline const char* GetServiceRequestName() const override { return "SetCognitoEvents"; }
+
     Aws::String SerializePayload() const override;
 
     /**
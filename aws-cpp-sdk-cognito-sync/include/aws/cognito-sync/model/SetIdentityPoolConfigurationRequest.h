@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     SetIdentityPoolConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "SetIdentityPoolConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     SubscribeToDatasetRequest();
+    inline const char* GetServiceRequestName() const override { return "SubscribeToDataset"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UnsubscribeFromDatasetRequest();
+    inline const char* GetServiceRequestName() const override { return "UnsubscribeFromDataset"; }
+
     Aws::String SerializePayload() const override;
 
     /**
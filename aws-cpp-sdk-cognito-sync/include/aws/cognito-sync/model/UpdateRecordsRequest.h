@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     UpdateRecordsRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateRecords"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
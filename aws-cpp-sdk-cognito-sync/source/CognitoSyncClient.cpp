@@ -128,7 +128,7 @@ BulkPublishOutcome CognitoSyncClient::BulkPublish(const BulkPublishRequest& requ
 
 BulkPublishOutcomeCallable CognitoSyncClient::BulkPublishCallable(const BulkPublishRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BulkPublish(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BulkPublish(request); } );
 }
 
 void CognitoSyncClient::BulkPublishAsync(const BulkPublishRequest& request, const BulkPublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -136,6 +136,16 @@ void CognitoSyncClient::BulkPublishAsync(const BulkPublishRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->BulkPublishAsyncHelper( request, handler, context ); } );
 }
 
+BulkPublishOutcomeCallable CognitoSyncClient::BulkPublishCallable(BulkPublishRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::BulkPublish, this, std::move(request)));
+}
+
+void CognitoSyncClient::BulkPublishAsync(BulkPublishRequest&& request, const BulkPublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::BulkPublishAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::BulkPublishAsyncHelper(const BulkPublishRequest& request, const BulkPublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BulkPublish(request), context);
@@ -164,7 +174,7 @@ DeleteDatasetOutcome CognitoSyncClient::DeleteDataset(const DeleteDatasetRequest
 
 DeleteDatasetOutcomeCallable CognitoSyncClient::DeleteDatasetCallable(const DeleteDatasetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDataset(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDataset(request); } );
 }
 
 void CognitoSyncClient::DeleteDatasetAsync(const DeleteDatasetRequest& request, const DeleteDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -172,6 +182,16 @@ void CognitoSyncClient::DeleteDatasetAsync(const DeleteDatasetRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDatasetAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDatasetOutcomeCallable CognitoSyncClient::DeleteDatasetCallable(DeleteDatasetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::DeleteDataset, this, std::move(request)));
+}
+
+void CognitoSyncClient::DeleteDatasetAsync(DeleteDatasetRequest&& request, const DeleteDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::DeleteDatasetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::DeleteDatasetAsyncHelper(const DeleteDatasetRequest& request, const DeleteDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDataset(request), context);
@@ -200,7 +220,7 @@ DescribeDatasetOutcome CognitoSyncClient::DescribeDataset(const DescribeDatasetR
 
 DescribeDatasetOutcomeCallable CognitoSyncClient::DescribeDatasetCallable(const DescribeDatasetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDataset(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDataset(request); } );
 }
 
 void CognitoSyncClient::DescribeDatasetAsync(const DescribeDatasetRequest& request, const DescribeDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -208,6 +228,16 @@ void CognitoSyncClient::DescribeDatasetAsync(const DescribeDatasetRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDatasetAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDatasetOutcomeCallable CognitoSyncClient::DescribeDatasetCallable(DescribeDatasetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::DescribeDataset, this, std::move(request)));
+}
+
+void CognitoSyncClient::DescribeDatasetAsync(DescribeDatasetRequest&& request, const DescribeDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::DescribeDatasetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::DescribeDatasetAsyncHelper(const DescribeDatasetRequest& request, const DescribeDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDataset(request), context);
@@ -232,7 +262,7 @@ DescribeIdentityPoolUsageOutcome CognitoSyncClient::DescribeIdentityPoolUsage(co
 
 DescribeIdentityPoolUsageOutcomeCallable CognitoSyncClient::DescribeIdentityPoolUsageCallable(const DescribeIdentityPoolUsageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeIdentityPoolUsage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeIdentityPoolUsage(request); } );
 }
 
 void CognitoSyncClient::DescribeIdentityPoolUsageAsync(const DescribeIdentityPoolUsageRequest& request, const DescribeIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -240,6 +270,16 @@ void CognitoSyncClient::DescribeIdentityPoolUsageAsync(const DescribeIdentityPoo
   m_executor->Submit( [this, request, handler, context](){ this->DescribeIdentityPoolUsageAsyncHelper( request, handler, context ); } );
 }
 
+DescribeIdentityPoolUsageOutcomeCallable CognitoSyncClient::DescribeIdentityPoolUsageCallable(DescribeIdentityPoolUsageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::DescribeIdentityPoolUsage, this, std::move(request)));
+}
+
+void CognitoSyncClient::DescribeIdentityPoolUsageAsync(DescribeIdentityPoolUsageRequest&& request, const DescribeIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::DescribeIdentityPoolUsageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::DescribeIdentityPoolUsageAsyncHelper(const DescribeIdentityPoolUsageRequest& request, const DescribeIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeIdentityPoolUsage(request), context);
@@ -266,7 +306,7 @@ DescribeIdentityUsageOutcome CognitoSyncClient::DescribeIdentityUsage(const Desc
 
 DescribeIdentityUsageOutcomeCallable CognitoSyncClient::DescribeIdentityUsageCallable(const DescribeIdentityUsageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeIdentityUsage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeIdentityUsage(request); } );
 }
 
 void CognitoSyncClient::DescribeIdentityUsageAsync(const DescribeIdentityUsageRequest& request, const DescribeIdentityUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -274,6 +314,16 @@ void CognitoSyncClient::DescribeIdentityUsageAsync(const DescribeIdentityUsageRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeIdentityUsageAsyncHelper( request, handler, context ); } );
 }
 
+DescribeIdentityUsageOutcomeCallable CognitoSyncClient::DescribeIdentityUsageCallable(DescribeIdentityUsageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::DescribeIdentityUsage, this, std::move(request)));
+}
+
+void CognitoSyncClient::DescribeIdentityUsageAsync(DescribeIdentityUsageRequest&& request, const DescribeIdentityUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::DescribeIdentityUsageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::DescribeIdentityUsageAsyncHelper(const DescribeIdentityUsageRequest& request, const DescribeIdentityUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeIdentityUsage(request), context);
@@ -299,7 +349,7 @@ GetBulkPublishDetailsOutcome CognitoSyncClient::GetBulkPublishDetails(const GetB
 
 GetBulkPublishDetailsOutcomeCallable CognitoSyncClient::GetBulkPublishDetailsCallable(const GetBulkPublishDetailsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBulkPublishDetails(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBulkPublishDetails(request); } );
 }
 
 void CognitoSyncClient::GetBulkPublishDetailsAsync(const GetBulkPublishDetailsRequest& request, const GetBulkPublishDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -307,6 +357,16 @@ void CognitoSyncClient::GetBulkPublishDetailsAsync(const GetBulkPublishDetailsRe
   m_executor->Submit( [this, request, handler, context](){ this->GetBulkPublishDetailsAsyncHelper( request, handler, context ); } );
 }
 
+GetBulkPublishDetailsOutcomeCallable CognitoSyncClient::GetBulkPublishDetailsCallable(GetBulkPublishDetailsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::GetBulkPublishDetails, this, std::move(request)));
+}
+
+void CognitoSyncClient::GetBulkPublishDetailsAsync(GetBulkPublishDetailsRequest&& request, const GetBulkPublishDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::GetBulkPublishDetailsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::GetBulkPublishDetailsAsyncHelper(const GetBulkPublishDetailsRequest& request, const GetBulkPublishDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBulkPublishDetails(request), context);
@@ -332,7 +392,7 @@ GetCognitoEventsOutcome CognitoSyncClient::GetCognitoEvents(const GetCognitoEven
 
 GetCognitoEventsOutcomeCallable CognitoSyncClient::GetCognitoEventsCallable(const GetCognitoEventsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetCognitoEvents(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetCognitoEvents(request); } );
 }
 
 void CognitoSyncClient::GetCognitoEventsAsync(const GetCognitoEventsRequest& request, const GetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -340,6 +400,16 @@ void CognitoSyncClient::GetCognitoEventsAsync(const GetCognitoEventsRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->GetCognitoEventsAsyncHelper( request, handler, context ); } );
 }
 
+GetCognitoEventsOutcomeCallable CognitoSyncClient::GetCognitoEventsCallable(GetCognitoEventsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::GetCognitoEvents, this, std::move(request)));
+}
+
+void CognitoSyncClient::GetCognitoEventsAsync(GetCognitoEventsRequest&& request, const GetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::GetCognitoEventsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::GetCognitoEventsAsyncHelper(const GetCognitoEventsRequest& request, const GetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetCognitoEvents(request), context);
@@ -365,7 +435,7 @@ GetIdentityPoolConfigurationOutcome CognitoSyncClient::GetIdentityPoolConfigurat
 
 GetIdentityPoolConfigurationOutcomeCallable CognitoSyncClient::GetIdentityPoolConfigurationCallable(const GetIdentityPoolConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetIdentityPoolConfiguration(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetIdentityPoolConfiguration(request); } );
 }
 
 void CognitoSyncClient::GetIdentityPoolConfigurationAsync(const GetIdentityPoolConfigurationRequest& request, const GetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -373,6 +443,16 @@ void CognitoSyncClient::GetIdentityPoolConfigurationAsync(const GetIdentityPoolC
   m_executor->Submit( [this, request, handler, context](){ this->GetIdentityPoolConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+GetIdentityPoolConfigurationOutcomeCallable CognitoSyncClient::GetIdentityPoolConfigurationCallable(GetIdentityPoolConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::GetIdentityPoolConfiguration, this, std::move(request)));
+}
+
+void CognitoSyncClient::GetIdentityPoolConfigurationAsync(GetIdentityPoolConfigurationRequest&& request, const GetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::GetIdentityPoolConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::GetIdentityPoolConfigurationAsyncHelper(const GetIdentityPoolConfigurationRequest& request, const GetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetIdentityPoolConfiguration(request), context);
@@ -400,7 +480,7 @@ ListDatasetsOutcome CognitoSyncClient::ListDatasets(const ListDatasetsRequest& r
 
 ListDatasetsOutcomeCallable CognitoSyncClient::ListDatasetsCallable(const ListDatasetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDatasets(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDatasets(request); } );
 }
 
 void CognitoSyncClient::ListDatasetsAsync(const ListDatasetsRequest& request, const ListDatasetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -408,6 +488,16 @@ void CognitoSyncClient::ListDatasetsAsync(const ListDatasetsRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->ListDatasetsAsyncHelper( request, handler, context ); } );
 }
 
+ListDatasetsOutcomeCallable CognitoSyncClient::ListDatasetsCallable(ListDatasetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::ListDatasets, this, std::move(request)));
+}
+
+void CognitoSyncClient::ListDatasetsAsync(ListDatasetsRequest&& request, const ListDatasetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::ListDatasetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::ListDatasetsAsyncHelper(const ListDatasetsRequest& request, const ListDatasetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDatasets(request), context);
@@ -431,7 +521,7 @@ ListIdentityPoolUsageOutcome CognitoSyncClient::ListIdentityPoolUsage(const List
 
 ListIdentityPoolUsageOutcomeCallable CognitoSyncClient::ListIdentityPoolUsageCallable(const ListIdentityPoolUsageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListIdentityPoolUsage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListIdentityPoolUsage(request); } );
 }
 
 void CognitoSyncClient::ListIdentityPoolUsageAsync(const ListIdentityPoolUsageRequest& request, const ListIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -439,6 +529,16 @@ void CognitoSyncClient::ListIdentityPoolUsageAsync(const ListIdentityPoolUsageRe
   m_executor->Submit( [this, request, handler, context](){ this->ListIdentityPoolUsageAsyncHelper( request, handler, context ); } );
 }
 
+ListIdentityPoolUsageOutcomeCallable CognitoSyncClient::ListIdentityPoolUsageCallable(ListIdentityPoolUsageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::ListIdentityPoolUsage, this, std::move(request)));
+}
+
+void CognitoSyncClient::ListIdentityPoolUsageAsync(ListIdentityPoolUsageRequest&& request, const ListIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::ListIdentityPoolUsageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::ListIdentityPoolUsageAsyncHelper(const ListIdentityPoolUsageRequest& request, const ListIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListIdentityPoolUsage(request), context);
@@ -468,7 +568,7 @@ ListRecordsOutcome CognitoSyncClient::ListRecords(const ListRecordsRequest& requ
 
 ListRecordsOutcomeCallable CognitoSyncClient::ListRecordsCallable(const ListRecordsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListRecords(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListRecords(request); } );
 }
 
 void CognitoSyncClient::ListRecordsAsync(const ListRecordsRequest& request, const ListRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -476,6 +576,16 @@ void CognitoSyncClient::ListRecordsAsync(const ListRecordsRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->ListRecordsAsyncHelper( request, handler, context ); } );
 }
 
+ListRecordsOutcomeCallable CognitoSyncClient::ListRecordsCallable(ListRecordsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::ListRecords, this, std::move(request)));
+}
+
+void CognitoSyncClient::ListRecordsAsync(ListRecordsRequest&& request, const ListRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::ListRecordsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::ListRecordsAsyncHelper(const ListRecordsRequest& request, const ListRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListRecords(request), context);
@@ -503,7 +613,7 @@ RegisterDeviceOutcome CognitoSyncClient::RegisterDevice(const RegisterDeviceRequ
 
 RegisterDeviceOutcomeCallable CognitoSyncClient::RegisterDeviceCallable(const RegisterDeviceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterDevice(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterDevice(request); } );
 }
 
 void CognitoSyncClient::RegisterDeviceAsync(const RegisterDeviceRequest& request, const RegisterDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -511,6 +621,16 @@ void CognitoSyncClient::RegisterDeviceAsync(const RegisterDeviceRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->RegisterDeviceAsyncHelper( request, handler, context ); } );
 }
 
+RegisterDeviceOutcomeCallable CognitoSyncClient::RegisterDeviceCallable(RegisterDeviceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::RegisterDevice, this, std::move(request)));
+}
+
+void CognitoSyncClient::RegisterDeviceAsync(RegisterDeviceRequest&& request, const RegisterDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::RegisterDeviceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::RegisterDeviceAsyncHelper(const RegisterDeviceRequest& request, const RegisterDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterDevice(request), context);
@@ -536,7 +656,7 @@ SetCognitoEventsOutcome CognitoSyncClient::SetCognitoEvents(const SetCognitoEven
 
 SetCognitoEventsOutcomeCallable CognitoSyncClient::SetCognitoEventsCallable(const SetCognitoEventsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetCognitoEvents(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetCognitoEvents(request); } );
 }
 
 void CognitoSyncClient::SetCognitoEventsAsync(const SetCognitoEventsRequest& request, const SetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -544,6 +664,16 @@ void CognitoSyncClient::SetCognitoEventsAsync(const SetCognitoEventsRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->SetCognitoEventsAsyncHelper( request, handler, context ); } );
 }
 
+SetCognitoEventsOutcomeCallable CognitoSyncClient::SetCognitoEventsCallable(SetCognitoEventsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::SetCognitoEvents, this, std::move(request)));
+}
+
+void CognitoSyncClient::SetCognitoEventsAsync(SetCognitoEventsRequest&& request, const SetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::SetCognitoEventsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::SetCognitoEventsAsyncHelper(const SetCognitoEventsRequest& request, const SetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetCognitoEvents(request), context);
@@ -569,7 +699,7 @@ SetIdentityPoolConfigurationOutcome CognitoSyncClient::SetIdentityPoolConfigurat
 
 SetIdentityPoolConfigurationOutcomeCallable CognitoSyncClient::SetIdentityPoolConfigurationCallable(const SetIdentityPoolConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetIdentityPoolConfiguration(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetIdentityPoolConfiguration(request); } );
 }
 
 void CognitoSyncClient::SetIdentityPoolConfigurationAsync(const SetIdentityPoolConfigurationRequest& request, const SetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -577,6 +707,16 @@ void CognitoSyncClient::SetIdentityPoolConfigurationAsync(const SetIdentityPoolC
   m_executor->Submit( [this, request, handler, context](){ this->SetIdentityPoolConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+SetIdentityPoolConfigurationOutcomeCallable CognitoSyncClient::SetIdentityPoolConfigurationCallable(SetIdentityPoolConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::SetIdentityPoolConfiguration, this, std::move(request)));
+}
+
+void CognitoSyncClient::SetIdentityPoolConfigurationAsync(SetIdentityPoolConfigurationRequest&& request, const SetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::SetIdentityPoolConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::SetIdentityPoolConfigurationAsyncHelper(const SetIdentityPoolConfigurationRequest& request, const SetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetIdentityPoolConfiguration(request), context);
@@ -607,7 +747,7 @@ SubscribeToDatasetOutcome CognitoSyncClient::SubscribeToDataset(const SubscribeT
 
 SubscribeToDatasetOutcomeCallable CognitoSyncClient::SubscribeToDatasetCallable(const SubscribeToDatasetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SubscribeToDataset(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SubscribeToDataset(request); } );
 }
 
 void CognitoSyncClient::SubscribeToDatasetAsync(const SubscribeToDatasetRequest& request, const SubscribeToDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -615,6 +755,16 @@ void CognitoSyncClient::SubscribeToDatasetAsync(const SubscribeToDatasetRequest&
   m_executor->Submit( [this, request, handler, context](){ this->SubscribeToDatasetAsyncHelper( request, handler, context ); } );
 }
 
+SubscribeToDatasetOutcomeCallable CognitoSyncClient::SubscribeToDatasetCallable(SubscribeToDatasetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::SubscribeToDataset, this, std::move(request)));
+}
+
+void CognitoSyncClient::SubscribeToDatasetAsync(SubscribeToDatasetRequest&& request, const SubscribeToDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::SubscribeToDatasetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::SubscribeToDatasetAsyncHelper(const SubscribeToDatasetRequest& request, const SubscribeToDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SubscribeToDataset(request), context);
@@ -645,7 +795,7 @@ UnsubscribeFromDatasetOutcome CognitoSyncClient::UnsubscribeFromDataset(const Un
 
 UnsubscribeFromDatasetOutcomeCallable CognitoSyncClient::UnsubscribeFromDatasetCallable(const UnsubscribeFromDatasetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UnsubscribeFromDataset(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UnsubscribeFromDataset(request); } );
 }
 
 void CognitoSyncClient::UnsubscribeFromDatasetAsync(const UnsubscribeFromDatasetRequest& request, const UnsubscribeFromDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -653,6 +803,16 @@ void CognitoSyncClient::UnsubscribeFromDatasetAsync(const UnsubscribeFromDataset
   m_executor->Submit( [this, request, handler, context](){ this->UnsubscribeFromDatasetAsyncHelper( request, handler, context ); } );
 }
 
+UnsubscribeFromDatasetOutcomeCallable CognitoSyncClient::UnsubscribeFromDatasetCallable(UnsubscribeFromDatasetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::UnsubscribeFromDataset, this, std::move(request)));
+}
+
+void CognitoSyncClient::UnsubscribeFromDatasetAsync(UnsubscribeFromDatasetRequest&& request, const UnsubscribeFromDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::UnsubscribeFromDatasetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::UnsubscribeFromDatasetAsyncHelper(const UnsubscribeFromDatasetRequest& request, const UnsubscribeFromDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UnsubscribeFromDataset(request), context);
@@ -681,7 +841,7 @@ UpdateRecordsOutcome CognitoSyncClient::UpdateRecords(const UpdateRecordsRequest
 
 UpdateRecordsOutcomeCallable CognitoSyncClient::UpdateRecordsCallable(const UpdateRecordsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateRecords(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateRecords(request); } );
 }
 
 void CognitoSyncClient::UpdateRecordsAsync(const UpdateRecordsRequest& request, const UpdateRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -689,8 +849,156 @@ void CognitoSyncClient::UpdateRecordsAsync(const UpdateRecordsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->UpdateRecordsAsyncHelper( request, handler, context ); } );
 }
 
+UpdateRecordsOutcomeCallable CognitoSyncClient::UpdateRecordsCallable(UpdateRecordsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CognitoSyncClient::UpdateRecords, this, std::move(request)));
+}
+
+void CognitoSyncClient::UpdateRecordsAsync(UpdateRecordsRequest&& request, const UpdateRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CognitoSyncClient::UpdateRecordsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CognitoSyncClient::UpdateRecordsAsyncHelper(const UpdateRecordsRequest& request, const UpdateRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateRecords(request), context);
 }
 
+Paginator<CognitoSyncClient, ListDatasetsRequest, ListDatasetsOutcome> CognitoSyncClient::ListDatasetsPaginator(const ListDatasetsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CognitoSyncClient, ListDatasetsRequest, ListDatasetsOutcome>(this, &CognitoSyncClient::ListDatasets, request,
+    [](const ListDatasetsRequest& current, const ListDatasetsOutcome& outcome, ListDatasetsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CognitoSyncClient, ListIdentityPoolUsageRequest, ListIdentityPoolUsageOutcome> CognitoSyncClient::ListIdentityPoolUsagePaginator(const ListIdentityPoolUsageRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CognitoSyncClient, ListIdentityPoolUsageRequest, ListIdentityPoolUsageOutcome>(this, &CognitoSyncClient::ListIdentityPoolUsage, request,
+    [](const ListIdentityPoolUsageRequest& current, const ListIdentityPoolUsageOutcome& outcome, ListIdentityPoolUsageRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CognitoSyncClient, ListRecordsRequest, ListRecordsOutcome> CognitoSyncClient::ListRecordsPaginator(const ListRecordsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CognitoSyncClient, ListRecordsRequest, ListRecordsOutcome>(this, &CognitoSyncClient::ListRecords, request,
+    [](const ListRecordsRequest& current, const ListRecordsOutcome& outcome, ListRecordsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<CognitoSyncClient, BulkPublishRequest, BulkPublishOutcome> CognitoSyncClient::BulkPublishAwaitable(BulkPublishRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::BulkPublish, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, DeleteDatasetRequest, DeleteDatasetOutcome> CognitoSyncClient::DeleteDatasetAwaitable(DeleteDatasetRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::DeleteDataset, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, DescribeDatasetRequest, DescribeDatasetOutcome> CognitoSyncClient::DescribeDatasetAwaitable(DescribeDatasetRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::DescribeDataset, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, DescribeIdentityPoolUsageRequest, DescribeIdentityPoolUsageOutcome> CognitoSyncClient::DescribeIdentityPoolUsageAwaitable(DescribeIdentityPoolUsageRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::DescribeIdentityPoolUsage, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, DescribeIdentityUsageRequest, DescribeIdentityUsageOutcome> CognitoSyncClient::DescribeIdentityUsageAwaitable(DescribeIdentityUsageRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::DescribeIdentityUsage, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, GetBulkPublishDetailsRequest, GetBulkPublishDetailsOutcome> CognitoSyncClient::GetBulkPublishDetailsAwaitable(GetBulkPublishDetailsRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::GetBulkPublishDetails, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, GetCognitoEventsRequest, GetCognitoEventsOutcome> CognitoSyncClient::GetCognitoEventsAwaitable(GetCognitoEventsRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::GetCognitoEvents, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, GetIdentityPoolConfigurationRequest, GetIdentityPoolConfigurationOutcome> CognitoSyncClient::GetIdentityPoolConfigurationAwaitable(GetIdentityPoolConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::GetIdentityPoolConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, ListDatasetsRequest, ListDatasetsOutcome> CognitoSyncClient::ListDatasetsAwaitable(ListDatasetsRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::ListDatasets, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, ListIdentityPoolUsageRequest, ListIdentityPoolUsageOutcome> CognitoSyncClient::ListIdentityPoolUsageAwaitable(ListIdentityPoolUsageRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::ListIdentityPoolUsage, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, ListRecordsRequest, ListRecordsOutcome> CognitoSyncClient::ListRecordsAwaitable(ListRecordsRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::ListRecords, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, RegisterDeviceRequest, RegisterDeviceOutcome> CognitoSyncClient::RegisterDeviceAwaitable(RegisterDeviceRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::RegisterDevice, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, SetCognitoEventsRequest, SetCognitoEventsOutcome> CognitoSyncClient::SetCognitoEventsAwaitable(SetCognitoEventsRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::SetCognitoEvents, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, SetIdentityPoolConfigurationRequest, SetIdentityPoolConfigurationOutcome> CognitoSyncClient::SetIdentityPoolConfigurationAwaitable(SetIdentityPoolConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::SetIdentityPoolConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, SubscribeToDatasetRequest, SubscribeToDatasetOutcome> CognitoSyncClient::SubscribeToDatasetAwaitable(SubscribeToDatasetRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::SubscribeToDataset, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, UnsubscribeFromDatasetRequest, UnsubscribeFromDatasetOutcome> CognitoSyncClient::UnsubscribeFromDatasetAwaitable(UnsubscribeFromDatasetRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::UnsubscribeFromDataset, std::move(request) } };
+}
+
+ClientOperationAwaitable<CognitoSyncClient, UpdateRecordsRequest, UpdateRecordsOutcome> CognitoSyncClient::UpdateRecordsAwaitable(UpdateRecordsRequest request) const
+{
+  return { m_executor.get(), { this, &CognitoSyncClient::UpdateRecords, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,31 +29,35 @@ namespace Aws
       namespace BulkPublishStatusMapper
       {
 
-        static const int NOT_STARTED_HASH = HashingUtils::HashString("NOT_STARTED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int NOT_STARTED_HASH = -1391247659;
+        static const int IN_PROGRESS_HASH = -604548089;
+        static const int FAILED_HASH = 2066319421;
+        static const int SUCCEEDED_HASH = -562638271;
 
 
         BulkPublishStatus GetBulkPublishStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOT_STARTED_HASH)
+          switch (hashCode)
           {
+          case NOT_STARTED_HASH:
             return BulkPublishStatus::NOT_STARTED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
+          case IN_PROGRESS_HASH:
             return BulkPublishStatus::IN_PROGRESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return BulkPublishStatus::FAILED;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
+          case SUCCEEDED_HASH:
             return BulkPublishStatus::SUCCEEDED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
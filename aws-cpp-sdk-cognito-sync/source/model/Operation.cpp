@@ -29,21 +29,29 @@ namespace Aws
       namespace OperationMapper
       {
 
-        static const int replace_HASH = HashingUtils::HashString("replace");
-        static const int remove_HASH = HashingUtils::HashString("remove");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int replace_HASH = 1094496948;
+        static const int remove_HASH = -934610812;
 
 
         Operation GetOperationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == replace_HASH)
+          switch (hashCode)
           {
+          case replace_HASH:
             return Operation::replace;
-          }
-          else if (hashCode == remove_HASH)
-          {
+          case remove_HASH:
             return Operation::remove;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,31 +29,35 @@ namespace Aws
       namespace PlatformMapper
       {
 
-        static const int APNS_HASH = HashingUtils::HashString("APNS");
-        static const int APNS_SANDBOX_HASH = HashingUtils::HashString("APNS_SANDBOX");
-        static const int GCM_HASH = HashingUtils::HashString("GCM");
-        static const int ADM_HASH = HashingUtils::HashString("ADM");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int APNS_HASH = 2015796;
+        static const int APNS_SANDBOX_HASH = 581844892;
+        static const int GCM_HASH = 70385;
+        static const int ADM_HASH = 64650;
 
 
         Platform GetPlatformForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == APNS_HASH)
+          switch (hashCode)
           {
+          case APNS_HASH:
             return Platform::APNS;
-          }
-          else if (hashCode == APNS_SANDBOX_HASH)
-          {
+          case APNS_SANDBOX_HASH:
             return Platform::APNS_SANDBOX;
-          }
-          else if (hashCode == GCM_HASH)
-          {
+          case GCM_HASH:
             return Platform::GCM;
-          }
-          else if (hashCode == ADM_HASH)
-          {
+          case ADM_HASH:
             return Platform::ADM;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
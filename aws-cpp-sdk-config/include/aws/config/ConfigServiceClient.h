@@ -40,6 +40,9 @@
 #include <aws/config/model/StartConfigRulesEvaluationResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -281,6 +284,18 @@ namespace Model
          */
         virtual void DeleteConfigRuleAsync(const Model::DeleteConfigRuleRequest& request, const DeleteConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteConfigRuleCallable(const Model::DeleteConfigRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteConfigRuleOutcomeCallable DeleteConfigRuleCallable(Model::DeleteConfigRuleRequest&& request) const;
+
+        /**
+         * Same as DeleteConfigRuleAsync(const Model::DeleteConfigRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteConfigRuleAsync(Model::DeleteConfigRuleRequest&& request, const DeleteConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the configuration recorder.</p> <p>After the configuration recorder
          * is deleted, AWS Config will not record resource configuration changes until you
@@ -321,6 +336,18 @@ namespace Model
          */
         virtual void DeleteConfigurationRecorderAsync(const Model::DeleteConfigurationRecorderRequest& request, const DeleteConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteConfigurationRecorderCallable(const Model::DeleteConfigurationRecorderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteConfigurationRecorderOutcomeCallable DeleteConfigurationRecorderCallable(Model::DeleteConfigurationRecorderRequest&& request) const;
+
+        /**
+         * Same as DeleteConfigurationRecorderAsync(const Model::DeleteConfigurationRecorderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteConfigurationRecorderAsync(Model::DeleteConfigurationRecorderRequest&& request, const DeleteConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the delivery channel.</p> <p>Before you can delete the delivery
          * channel, you must stop the configuration recorder by using the
@@ -346,6 +373,18 @@ namespace Model
          */
         virtual void DeleteDeliveryChannelAsync(const Model::DeleteDeliveryChannelRequest& request, const DeleteDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDeliveryChannelCallable(const Model::DeleteDeliveryChannelRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDeliveryChannelOutcomeCallable DeleteDeliveryChannelCallable(Model::DeleteDeliveryChannelRequest&& request) const;
+
+        /**
+         * Same as DeleteDeliveryChannelAsync(const Model::DeleteDeliveryChannelRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDeliveryChannelAsync(Model::DeleteDeliveryChannelRequest&& request, const DeleteDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the evaluation results for the specified Config rule. You can specify
          * one Config rule per request. After you delete the evaluation results, you can
@@ -374,6 +413,18 @@ namespace Model
          */
         virtual void DeleteEvaluationResultsAsync(const Model::DeleteEvaluationResultsRequest& request, const DeleteEvaluationResultsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteEvaluationResultsCallable(const Model::DeleteEvaluationResultsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteEvaluationResultsOutcomeCallable DeleteEvaluationResultsCallable(Model::DeleteEvaluationResultsRequest&& request) const;
+
+        /**
+         * Same as DeleteEvaluationResultsAsync(const Model::DeleteEvaluationResultsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteEvaluationResultsAsync(Model::DeleteEvaluationResultsRequest&& request, const DeleteEvaluationResultsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Schedules delivery of a configuration snapshot to the Amazon S3 bucket in the
          * specified delivery channel. After the delivery has started, AWS Config sends
@@ -411,6 +462,18 @@ namespace Model
          */
         virtual void DeliverConfigSnapshotAsync(const Model::DeliverConfigSnapshotRequest& request, const DeliverConfigSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeliverConfigSnapshotCallable(const Model::DeliverConfigSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeliverConfigSnapshotOutcomeCallable DeliverConfigSnapshotCallable(Model::DeliverConfigSnapshotRequest&& request) const;
+
+        /**
+         * Same as DeliverConfigSnapshotAsync(const Model::DeliverConfigSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeliverConfigSnapshotAsync(Model::DeliverConfigSnapshotRequest&& request, const DeliverConfigSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Indicates whether the specified AWS Config rules are compliant. If a rule is
          * noncompliant, this action returns the number of AWS resources that do not comply
@@ -484,6 +547,18 @@ namespace Model
          */
         virtual void DescribeComplianceByConfigRuleAsync(const Model::DescribeComplianceByConfigRuleRequest& request, const DescribeComplianceByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeComplianceByConfigRuleCallable(const Model::DescribeComplianceByConfigRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeComplianceByConfigRuleOutcomeCallable DescribeComplianceByConfigRuleCallable(Model::DescribeComplianceByConfigRuleRequest&& request) const;
+
+        /**
+         * Same as DescribeComplianceByConfigRuleAsync(const Model::DescribeComplianceByConfigRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeComplianceByConfigRuleAsync(Model::DescribeComplianceByConfigRuleRequest&& request, const DescribeComplianceByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Indicates whether the specified AWS resources are compliant. If a resource is
          * noncompliant, this action returns the number of AWS Config rules that the
@@ -560,6 +635,18 @@ namespace Model
          */
         virtual void DescribeComplianceByResourceAsync(const Model::DescribeComplianceByResourceRequest& request, const DescribeComplianceByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeComplianceByResourceCallable(const Model::DescribeComplianceByResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeComplianceByResourceOutcomeCallable DescribeComplianceByResourceCallable(Model::DescribeComplianceByResourceRequest&& request) const;
+
+        /**
+         * Same as DescribeComplianceByResourceAsync(const Model::DescribeComplianceByResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeComplianceByResourceAsync(Model::DescribeComplianceByResourceRequest&& request, const DescribeComplianceByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns status information for each of your AWS managed Config rules. The
          * status includes information such as the last time AWS Config invoked the rule,
@@ -588,6 +675,18 @@ namespace Model
          */
         virtual void DescribeConfigRuleEvaluationStatusAsync(const Model::DescribeConfigRuleEvaluationStatusRequest& request, const DescribeConfigRuleEvaluationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConfigRuleEvaluationStatusCallable(const Model::DescribeConfigRuleEvaluationStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeConfigRuleEvaluationStatusOutcomeCallable DescribeConfigRuleEvaluationStatusCallable(Model::DescribeConfigRuleEvaluationStatusRequest&& request) const;
+
+        /**
+         * Same as DescribeConfigRuleEvaluationStatusAsync(const Model::DescribeConfigRuleEvaluationStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeConfigRuleEvaluationStatusAsync(Model::DescribeConfigRuleEvaluationStatusRequest&& request, const DescribeConfigRuleEvaluationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns details about your AWS Config rules.</p>
          */
@@ -607,6 +706,18 @@ namespace Model
          */
         virtual void DescribeConfigRulesAsync(const Model::DescribeConfigRulesRequest& request, const DescribeConfigRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConfigRulesCallable(const Model::DescribeConfigRulesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeConfigRulesOutcomeCallable DescribeConfigRulesCallable(Model::DescribeConfigRulesRequest&& request) const;
+
+        /**
+         * Same as DescribeConfigRulesAsync(const Model::DescribeConfigRulesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeConfigRulesAsync(Model::DescribeConfigRulesRequest&& request, const DescribeConfigRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the current status of the specified configuration recorder. If a
          * configuration recorder is not specified, this action returns the status of all
@@ -635,6 +746,18 @@ namespace Model
          */
         virtual void DescribeConfigurationRecorderStatusAsync(const Model::DescribeConfigurationRecorderStatusRequest& request, const DescribeConfigurationRecorderStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConfigurationRecorderStatusCallable(const Model::DescribeConfigurationRecorderStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeConfigurationRecorderStatusOutcomeCallable DescribeConfigurationRecorderStatusCallable(Model::DescribeConfigurationRecorderStatusRequest&& request) const;
+
+        /**
+         * Same as DescribeConfigurationRecorderStatusAsync(const Model::DescribeConfigurationRecorderStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeConfigurationRecorderStatusAsync(Model::DescribeConfigurationRecorderStatusRequest&& request, const DescribeConfigurationRecorderStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the name of one or more specified configuration recorders. If the
          * recorder name is not specified, this action returns the names of all the
@@ -663,6 +786,18 @@ namespace Model
          */
         virtual void DescribeConfigurationRecordersAsync(const Model::DescribeConfigurationRecordersRequest& request, const DescribeConfigurationRecordersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConfigurationRecordersCallable(const Model::DescribeConfigurationRecordersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeConfigurationRecordersOutcomeCallable DescribeConfigurationRecordersCallable(Model::DescribeConfigurationRecordersRequest&& request) const;
+
+        /**
+         * Same as DescribeConfigurationRecordersAsync(const Model::DescribeConfigurationRecordersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeConfigurationRecordersAsync(Model::DescribeConfigurationRecordersRequest&& request, const DescribeConfigurationRecordersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the current status of the specified delivery channel. If a delivery
          * channel is not specified, this action returns the current status of all delivery
@@ -691,6 +826,18 @@ namespace Model
          */
         virtual void DescribeDeliveryChannelStatusAsync(const Model::DescribeDeliveryChannelStatusRequest& request, const DescribeDeliveryChannelStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDeliveryChannelStatusCallable(const Model::DescribeDeliveryChannelStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDeliveryChannelStatusOutcomeCallable DescribeDeliveryChannelStatusCallable(Model::DescribeDeliveryChannelStatusRequest&& request) const;
+
+        /**
+         * Same as DescribeDeliveryChannelStatusAsync(const Model::DescribeDeliveryChannelStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDeliveryChannelStatusAsync(Model::DescribeDeliveryChannelStatusRequest&& request, const DescribeDeliveryChannelStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns details about the specified delivery channel. If a delivery channel
          * is not specified, this action returns the details of all delivery channels
@@ -719,6 +866,18 @@ namespace Model
          */
         virtual void DescribeDeliveryChannelsAsync(const Model::DescribeDeliveryChannelsRequest& request, const DescribeDeliveryChannelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDeliveryChannelsCallable(const Model::DescribeDeliveryChannelsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDeliveryChannelsOutcomeCallable DescribeDeliveryChannelsCallable(Model::DescribeDeliveryChannelsRequest&& request) const;
+
+        /**
+         * Same as DescribeDeliveryChannelsAsync(const Model::DescribeDeliveryChannelsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDeliveryChannelsAsync(Model::DescribeDeliveryChannelsRequest&& request, const DescribeDeliveryChannelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the evaluation results for the specified AWS Config rule. The results
          * indicate which AWS resources were evaluated by the rule, when each resource was
@@ -744,6 +903,18 @@ namespace Model
          */
         virtual void GetComplianceDetailsByConfigRuleAsync(const Model::GetComplianceDetailsByConfigRuleRequest& request, const GetComplianceDetailsByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetComplianceDetailsByConfigRuleCallable(const Model::GetComplianceDetailsByConfigRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetComplianceDetailsByConfigRuleOutcomeCallable GetComplianceDetailsByConfigRuleCallable(Model::GetComplianceDetailsByConfigRuleRequest&& request) const;
+
+        /**
+         * Same as GetComplianceDetailsByConfigRuleAsync(const Model::GetComplianceDetailsByConfigRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetComplianceDetailsByConfigRuleAsync(Model::GetComplianceDetailsByConfigRuleRequest&& request, const GetComplianceDetailsByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the evaluation results for the specified AWS resource. The results
          * indicate which AWS Config rules were used to evaluate the resource, when each
@@ -769,6 +940,18 @@ namespace Model
          */
         virtual void GetComplianceDetailsByResourceAsync(const Model::GetComplianceDetailsByResourceRequest& request, const GetComplianceDetailsByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetComplianceDetailsByResourceCallable(const Model::GetComplianceDetailsByResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetComplianceDetailsByResourceOutcomeCallable GetComplianceDetailsByResourceCallable(Model::GetComplianceDetailsByResourceRequest&& request) const;
+
+        /**
+         * Same as GetComplianceDetailsByResourceAsync(const Model::GetComplianceDetailsByResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetComplianceDetailsByResourceAsync(Model::GetComplianceDetailsByResourceRequest&& request, const GetComplianceDetailsByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the number of AWS Config rules that are compliant and noncompliant,
          * up to a maximum of 25 for each.</p>
@@ -815,6 +998,18 @@ namespace Model
          */
         virtual void GetComplianceSummaryByResourceTypeAsync(const Model::GetComplianceSummaryByResourceTypeRequest& request, const GetComplianceSummaryByResourceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetComplianceSummaryByResourceTypeCallable(const Model::GetComplianceSummaryByResourceTypeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetComplianceSummaryByResourceTypeOutcomeCallable GetComplianceSummaryByResourceTypeCallable(Model::GetComplianceSummaryByResourceTypeRequest&& request) const;
+
+        /**
+         * Same as GetComplianceSummaryByResourceTypeAsync(const Model::GetComplianceSummaryByResourceTypeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetComplianceSummaryByResourceTypeAsync(Model::GetComplianceSummaryByResourceTypeRequest&& request, const GetComplianceSummaryByResourceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of configuration items for the specified resource. The list
          * contains details about each state of the resource during the specified time
@@ -864,6 +1059,18 @@ namespace Model
          */
         virtual void GetResourceConfigHistoryAsync(const Model::GetResourceConfigHistoryRequest& request, const GetResourceConfigHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetResourceConfigHistoryCallable(const Model::GetResourceConfigHistoryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetResourceConfigHistoryOutcomeCallable GetResourceConfigHistoryCallable(Model::GetResourceConfigHistoryRequest&& request) const;
+
+        /**
+         * Same as GetResourceConfigHistoryAsync(const Model::GetResourceConfigHistoryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetResourceConfigHistoryAsync(Model::GetResourceConfigHistoryRequest&& request, const GetResourceConfigHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Accepts a resource type and returns a list of resource identifiers for the
          * resources of that type. A resource identifier includes the resource type, ID,
@@ -916,6 +1123,18 @@ namespace Model
          */
         virtual void ListDiscoveredResourcesAsync(const Model::ListDiscoveredResourcesRequest& request, const ListDiscoveredResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDiscoveredResourcesCallable(const Model::ListDiscoveredResourcesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDiscoveredResourcesOutcomeCallable ListDiscoveredResourcesCallable(Model::ListDiscoveredResourcesRequest&& request) const;
+
+        /**
+         * Same as ListDiscoveredResourcesAsync(const Model::ListDiscoveredResourcesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDiscoveredResourcesAsync(Model::ListDiscoveredResourcesRequest&& request, const ListDiscoveredResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds or updates an AWS Config rule for evaluating whether your AWS resources
          * comply with your desired configurations. </p> <p>You can use this action for
@@ -1016,6 +1235,18 @@ namespace Model
          */
         virtual void PutConfigRuleAsync(const Model::PutConfigRuleRequest& request, const PutConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutConfigRuleCallable(const Model::PutConfigRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutConfigRuleOutcomeCallable PutConfigRuleCallable(Model::PutConfigRuleRequest&& request) const;
+
+        /**
+         * Same as PutConfigRuleAsync(const Model::PutConfigRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutConfigRuleAsync(Model::PutConfigRuleRequest&& request, const PutConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new configuration recorder to record the selected resource
          * configurations.</p> <p>You can use this action to change the role
@@ -1056,6 +1287,18 @@ namespace Model
          */
         virtual void PutConfigurationRecorderAsync(const Model::PutConfigurationRecorderRequest& request, const PutConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutConfigurationRecorderCallable(const Model::PutConfigurationRecorderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutConfigurationRecorderOutcomeCallable PutConfigurationRecorderCallable(Model::PutConfigurationRecorderRequest&& request) const;
+
+        /**
+         * Same as PutConfigurationRecorderAsync(const Model::PutConfigurationRecorderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutConfigurationRecorderAsync(Model::PutConfigurationRecorderRequest&& request, const PutConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a delivery channel object to deliver configuration information to an
          * Amazon S3 bucket and Amazon SNS topic.</p> <p>Before you can create a delivery
@@ -1099,6 +1342,18 @@ namespace Model
          */
         virtual void PutDeliveryChannelAsync(const Model::PutDeliveryChannelRequest& request, const PutDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutDeliveryChannelCallable(const Model::PutDeliveryChannelRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutDeliveryChannelOutcomeCallable PutDeliveryChannelCallable(Model::PutDeliveryChannelRequest&& request) const;
+
+        /**
+         * Same as PutDeliveryChannelAsync(const Model::PutDeliveryChannelRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutDeliveryChannelAsync(Model::PutDeliveryChannelRequest&& request, const PutDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by an AWS Lambda function to deliver evaluation results to AWS Config.
          * This action is required in every AWS Lambda function that is invoked by an AWS
@@ -1124,6 +1379,18 @@ namespace Model
          */
         virtual void PutEvaluationsAsync(const Model::PutEvaluationsRequest& request, const PutEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutEvaluationsCallable(const Model::PutEvaluationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutEvaluationsOutcomeCallable PutEvaluationsCallable(Model::PutEvaluationsRequest&& request) const;
+
+        /**
+         * Same as PutEvaluationsAsync(const Model::PutEvaluationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutEvaluationsAsync(Model::PutEvaluationsRequest&& request, const PutEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Evaluates your resources against the specified Config rules. You can specify
          * up to 25 Config rules per request.</p> <p>An existing
@@ -1158,6 +1425,18 @@ namespace Model
          */
         virtual void StartConfigRulesEvaluationAsync(const Model::StartConfigRulesEvaluationRequest& request, const StartConfigRulesEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartConfigRulesEvaluationCallable(const Model::StartConfigRulesEvaluationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StartConfigRulesEvaluationOutcomeCallable StartConfigRulesEvaluationCallable(Model::StartConfigRulesEvaluationRequest&& request) const;
+
+        /**
+         * Same as StartConfigRulesEvaluationAsync(const Model::StartConfigRulesEvaluationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StartConfigRulesEvaluationAsync(Model::StartConfigRulesEvaluationRequest&& request, const StartConfigRulesEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts recording configurations of the AWS resources you have selected to
          * record in your AWS account.</p> <p>You must have created at least one delivery
@@ -1183,6 +1462,18 @@ namespace Model
          */
         virtual void StartConfigurationRecorderAsync(const Model::StartConfigurationRecorderRequest& request, const StartConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartConfigurationRecorderCallable(const Model::StartConfigurationRecorderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StartConfigurationRecorderOutcomeCallable StartConfigurationRecorderCallable(Model::StartConfigurationRecorderRequest&& request) const;
+
+        /**
+         * Same as StartConfigurationRecorderAsync(const Model::StartConfigurationRecorderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StartConfigurationRecorderAsync(Model::StartConfigurationRecorderRequest&& request, const StartConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stops recording configurations of the AWS resources you have selected to
          * record in your AWS account.</p>
@@ -1205,6 +1496,185 @@ namespace Model
          */
         virtual void StopConfigurationRecorderAsync(const Model::StopConfigurationRecorderRequest& request, const StopConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopConfigurationRecorderCallable(const Model::StopConfigurationRecorderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StopConfigurationRecorderOutcomeCallable StopConfigurationRecorderCallable(Model::StopConfigurationRecorderRequest&& request) const;
+
+        /**
+         * Same as StopConfigurationRecorderAsync(const Model::StopConfigurationRecorderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StopConfigurationRecorderAsync(Model::StopConfigurationRecorderRequest&& request, const StopConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeComplianceByConfigRule(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ConfigServiceClient, Model::DescribeComplianceByConfigRuleRequest, Model::DescribeComplianceByConfigRuleOutcome> DescribeComplianceByConfigRulePaginator(const Model::DescribeComplianceByConfigRuleRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeComplianceByResource(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ConfigServiceClient, Model::DescribeComplianceByResourceRequest, Model::DescribeComplianceByResourceOutcome> DescribeComplianceByResourcePaginator(const Model::DescribeComplianceByResourceRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeConfigRules(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ConfigServiceClient, Model::DescribeConfigRulesRequest, Model::DescribeConfigRulesOutcome> DescribeConfigRulesPaginator(const Model::DescribeConfigRulesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through GetComplianceDetailsByConfigRule(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ConfigServiceClient, Model::GetComplianceDetailsByConfigRuleRequest, Model::GetComplianceDetailsByConfigRuleOutcome> GetComplianceDetailsByConfigRulePaginator(const Model::GetComplianceDetailsByConfigRuleRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through GetComplianceDetailsByResource(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ConfigServiceClient, Model::GetComplianceDetailsByResourceRequest, Model::GetComplianceDetailsByResourceOutcome> GetComplianceDetailsByResourcePaginator(const Model::GetComplianceDetailsByResourceRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through GetResourceConfigHistory(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ConfigServiceClient, Model::GetResourceConfigHistoryRequest, Model::GetResourceConfigHistoryOutcome> GetResourceConfigHistoryPaginator(const Model::GetResourceConfigHistoryRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListDiscoveredResources(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ConfigServiceClient, Model::ListDiscoveredResourcesRequest, Model::ListDiscoveredResourcesOutcome> ListDiscoveredResourcesPaginator(const Model::ListDiscoveredResourcesRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of DeleteConfigRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::DeleteConfigRuleRequest, Model::DeleteConfigRuleOutcome> DeleteConfigRuleAwaitable(Model::DeleteConfigRuleRequest request) const;
+
+        /**
+         * co_await-able form of DeleteConfigurationRecorder(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::DeleteConfigurationRecorderRequest, Model::DeleteConfigurationRecorderOutcome> DeleteConfigurationRecorderAwaitable(Model::DeleteConfigurationRecorderRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDeliveryChannel(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::DeleteDeliveryChannelRequest, Model::DeleteDeliveryChannelOutcome> DeleteDeliveryChannelAwaitable(Model::DeleteDeliveryChannelRequest request) const;
+
+        /**
+         * co_await-able form of DeleteEvaluationResults(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::DeleteEvaluationResultsRequest, Model::DeleteEvaluationResultsOutcome> DeleteEvaluationResultsAwaitable(Model::DeleteEvaluationResultsRequest request) const;
+
+        /**
+         * co_await-able form of DeliverConfigSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::DeliverConfigSnapshotRequest, Model::DeliverConfigSnapshotOutcome> DeliverConfigSnapshotAwaitable(Model::DeliverConfigSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of DescribeComplianceByConfigRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::DescribeComplianceByConfigRuleRequest, Model::DescribeComplianceByConfigRuleOutcome> DescribeComplianceByConfigRuleAwaitable(Model::DescribeComplianceByConfigRuleRequest request) const;
+
+        /**
+         * co_await-able form of DescribeComplianceByResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::DescribeComplianceByResourceRequest, Model::DescribeComplianceByResourceOutcome> DescribeComplianceByResourceAwaitable(Model::DescribeComplianceByResourceRequest request) const;
+
+        /**
+         * co_await-able form of DescribeConfigRuleEvaluationStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::DescribeConfigRuleEvaluationStatusRequest, Model::DescribeConfigRuleEvaluationStatusOutcome> DescribeConfigRuleEvaluationStatusAwaitable(Model::DescribeConfigRuleEvaluationStatusRequest request) const;
+
+        /**
+         * co_await-able form of DescribeConfigRules(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::DescribeConfigRulesRequest, Model::DescribeConfigRulesOutcome> DescribeConfigRulesAwaitable(Model::DescribeConfigRulesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeConfigurationRecorderStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::DescribeConfigurationRecorderStatusRequest, Model::DescribeConfigurationRecorderStatusOutcome> DescribeConfigurationRecorderStatusAwaitable(Model::DescribeConfigurationRecorderStatusRequest request) const;
+
+        /**
+         * co_await-able form of DescribeConfigurationRecorders(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::DescribeConfigurationRecordersRequest, Model::DescribeConfigurationRecordersOutcome> DescribeConfigurationRecordersAwaitable(Model::DescribeConfigurationRecordersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDeliveryChannelStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::DescribeDeliveryChannelStatusRequest, Model::DescribeDeliveryChannelStatusOutcome> DescribeDeliveryChannelStatusAwaitable(Model::DescribeDeliveryChannelStatusRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDeliveryChannels(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::DescribeDeliveryChannelsRequest, Model::DescribeDeliveryChannelsOutcome> DescribeDeliveryChannelsAwaitable(Model::DescribeDeliveryChannelsRequest request) const;
+
+        /**
+         * co_await-able form of GetComplianceDetailsByConfigRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::GetComplianceDetailsByConfigRuleRequest, Model::GetComplianceDetailsByConfigRuleOutcome> GetComplianceDetailsByConfigRuleAwaitable(Model::GetComplianceDetailsByConfigRuleRequest request) const;
+
+        /**
+         * co_await-able form of GetComplianceDetailsByResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::GetComplianceDetailsByResourceRequest, Model::GetComplianceDetailsByResourceOutcome> GetComplianceDetailsByResourceAwaitable(Model::GetComplianceDetailsByResourceRequest request) const;
+
+        /**
+         * co_await-able form of GetComplianceSummaryByConfigRule(): the operation runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, void, Model::GetComplianceSummaryByConfigRuleOutcome> GetComplianceSummaryByConfigRuleAwaitable() const;
+
+        /**
+         * co_await-able form of GetComplianceSummaryByResourceType(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::GetComplianceSummaryByResourceTypeRequest, Model::GetComplianceSummaryByResourceTypeOutcome> GetComplianceSummaryByResourceTypeAwaitable(Model::GetComplianceSummaryByResourceTypeRequest request) const;
+
+        /**
+         * co_await-able form of GetResourceConfigHistory(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::GetResourceConfigHistoryRequest, Model::GetResourceConfigHistoryOutcome> GetResourceConfigHistoryAwaitable(Model::GetResourceConfigHistoryRequest request) const;
+
+        /**
+         * co_await-able form of ListDiscoveredResources(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::ListDiscoveredResourcesRequest, Model::ListDiscoveredResourcesOutcome> ListDiscoveredResourcesAwaitable(Model::ListDiscoveredResourcesRequest request) const;
+
+        /**
+         * co_await-able form of PutConfigRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::PutConfigRuleRequest, Model::PutConfigRuleOutcome> PutConfigRuleAwaitable(Model::PutConfigRuleRequest request) const;
+
+        /**
+         * co_await-able form of PutConfigurationRecorder(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::PutConfigurationRecorderRequest, Model::PutConfigurationRecorderOutcome> PutConfigurationRecorderAwaitable(Model::PutConfigurationRecorderRequest request) const;
+
+        /**
+         * co_await-able form of PutDeliveryChannel(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::PutDeliveryChannelRequest, Model::PutDeliveryChannelOutcome> PutDeliveryChannelAwaitable(Model::PutDeliveryChannelRequest request) const;
+
+        /**
+         * co_await-able form of PutEvaluations(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::PutEvaluationsRequest, Model::PutEvaluationsOutcome> PutEvaluationsAwaitable(Model::PutEvaluationsRequest request) const;
+
+        /**
+         * co_await-able form of StartConfigRulesEvaluation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::StartConfigRulesEvaluationRequest, Model::StartConfigRulesEvaluationOutcome> StartConfigRulesEvaluationAwaitable(Model::StartConfigRulesEvaluationRequest request) const;
+
+        /**
+         * co_await-able form of StartConfigurationRecorder(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::StartConfigurationRecorderRequest, Model::StartConfigurationRecorderOutcome> StartConfigurationRecorderAwaitable(Model::StartConfigurationRecorderRequest request) const;
+
+        /**
+         * co_await-able form of StopConfigurationRecorder(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ConfigServiceClient, Model::StopConfigurationRecorderRequest, Model::StopConfigurationRecorderOutcome> StopConfigurationRecorderAwaitable(Model::StopConfigurationRecorderRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteConfigRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteConfigRule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
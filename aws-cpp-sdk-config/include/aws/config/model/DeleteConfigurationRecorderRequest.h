@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteConfigurationRecorderRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteConfigurationRecorder"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteDeliveryChannelRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDeliveryChannel"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
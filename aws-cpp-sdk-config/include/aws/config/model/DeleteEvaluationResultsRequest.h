@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteEvaluationResultsRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteEvaluationResults"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeliverConfigSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "DeliverConfigSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeComplianceByConfigRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeComplianceByConfigRule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeComplianceByResourceRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeComplianceByResource"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
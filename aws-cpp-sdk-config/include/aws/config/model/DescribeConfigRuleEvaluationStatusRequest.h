@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeConfigRuleEvaluationStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeConfigRuleEvaluationStatus"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeConfigRulesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeConfigRules"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
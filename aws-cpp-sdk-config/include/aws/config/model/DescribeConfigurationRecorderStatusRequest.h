@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeConfigurationRecorderStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeConfigurationRecorderStatus"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
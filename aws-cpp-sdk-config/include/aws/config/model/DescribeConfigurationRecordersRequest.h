@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeConfigurationRecordersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeConfigurationRecorders"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeDeliveryChannelStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDeliveryChannelStatus"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeDeliveryChannelsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDeliveryChannels"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
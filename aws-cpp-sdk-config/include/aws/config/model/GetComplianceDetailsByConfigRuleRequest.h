@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetComplianceDetailsByConfigRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "GetComplianceDetailsByConfigRule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
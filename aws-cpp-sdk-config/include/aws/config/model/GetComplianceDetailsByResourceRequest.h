@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetComplianceDetailsByResourceRequest();
+    inline const char* GetServiceRequestName() const override { return "GetComplianceDetailsByResource"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
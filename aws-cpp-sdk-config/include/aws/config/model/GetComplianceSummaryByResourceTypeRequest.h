@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetComplianceSummaryByResourceTypeRequest();
+    inline const char* GetServiceRequestName() const override { return "GetComplianceSummaryByResourceType"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
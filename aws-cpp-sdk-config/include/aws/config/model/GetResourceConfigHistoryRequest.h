@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     GetResourceConfigHistoryRequest();
+    inline const char* GetServiceRequestName() const override { return "GetResourceConfigHistory"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
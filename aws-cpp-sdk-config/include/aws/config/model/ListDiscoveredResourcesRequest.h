@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListDiscoveredResourcesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListDiscoveredResources"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
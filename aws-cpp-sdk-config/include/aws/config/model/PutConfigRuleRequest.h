@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     PutConfigRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "PutConfigRule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
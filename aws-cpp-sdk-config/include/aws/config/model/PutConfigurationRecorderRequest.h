@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PutConfigurationRecorderRequest();
+    inline const char* GetServiceRequestName() const override { return "PutConfigurationRecorder"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PutDeliveryChannelRequest();
+    inline const char* GetServiceRequestName() const override { return "PutDeliveryChannel"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PutEvaluationsRequest();
+    inline const char* GetServiceRequestName() const override { return "PutEvaluations"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
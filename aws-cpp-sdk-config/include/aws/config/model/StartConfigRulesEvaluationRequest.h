@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     StartConfigRulesEvaluationRequest();
+    inline const char* GetServiceRequestName() const override { return "StartConfigRulesEvaluation"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
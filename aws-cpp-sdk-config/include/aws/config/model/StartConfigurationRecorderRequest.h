@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     StartConfigurationRecorderRequest();
+    inline const char* GetServiceRequestName() const override { return "StartConfigurationRecorder"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     StopConfigurationRecorderRequest();
+    inline const char* GetServiceRequestName() const override { return "StopConfigurationRecorder"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
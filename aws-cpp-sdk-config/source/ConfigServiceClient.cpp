@@ -134,7 +134,7 @@ DeleteConfigRuleOutcome ConfigServiceClient::DeleteConfigRule(const DeleteConfig
 
 DeleteConfigRuleOutcomeCallable ConfigServiceClient::DeleteConfigRuleCallable(const DeleteConfigRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteConfigRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteConfigRule(request); } );
 }
 
 void ConfigServiceClient::DeleteConfigRuleAsync(const DeleteConfigRuleRequest& request, const DeleteConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -142,6 +142,16 @@ void ConfigServiceClient::DeleteConfigRuleAsync(const DeleteConfigRuleRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DeleteConfigRuleAsyncHelper( request, handler, context ); } );
 }
 
+DeleteConfigRuleOutcomeCallable ConfigServiceClient::DeleteConfigRuleCallable(DeleteConfigRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::DeleteConfigRule, this, std::move(request)));
+}
+
+void ConfigServiceClient::DeleteConfigRuleAsync(DeleteConfigRuleRequest&& request, const DeleteConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::DeleteConfigRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::DeleteConfigRuleAsyncHelper(const DeleteConfigRuleRequest& request, const DeleteConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteConfigRule(request), context);
@@ -165,7 +175,7 @@ DeleteConfigurationRecorderOutcome ConfigServiceClient::DeleteConfigurationRecor
 
 DeleteConfigurationRecorderOutcomeCallable ConfigServiceClient::DeleteConfigurationRecorderCallable(const DeleteConfigurationRecorderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteConfigurationRecorder(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteConfigurationRecorder(request); } );
 }
 
 void ConfigServiceClient::DeleteConfigurationRecorderAsync(const DeleteConfigurationRecorderRequest& request, const DeleteConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -173,6 +183,16 @@ void ConfigServiceClient::DeleteConfigurationRecorderAsync(const DeleteConfigura
   m_executor->Submit( [this, request, handler, context](){ this->DeleteConfigurationRecorderAsyncHelper( request, handler, context ); } );
 }
 
+DeleteConfigurationRecorderOutcomeCallable ConfigServiceClient::DeleteConfigurationRecorderCallable(DeleteConfigurationRecorderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::DeleteConfigurationRecorder, this, std::move(request)));
+}
+
+void ConfigServiceClient::DeleteConfigurationRecorderAsync(DeleteConfigurationRecorderRequest&& request, const DeleteConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::DeleteConfigurationRecorderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::DeleteConfigurationRecorderAsyncHelper(const DeleteConfigurationRecorderRequest& request, const DeleteConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteConfigurationRecorder(request), context);
@@ -196,7 +216,7 @@ DeleteDeliveryChannelOutcome ConfigServiceClient::DeleteDeliveryChannel(const De
 
 DeleteDeliveryChannelOutcomeCallable ConfigServiceClient::DeleteDeliveryChannelCallable(const DeleteDeliveryChannelRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDeliveryChannel(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDeliveryChannel(request); } );
 }
 
 void ConfigServiceClient::DeleteDeliveryChannelAsync(const DeleteDeliveryChannelRequest& request, const DeleteDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -204,6 +224,16 @@ void ConfigServiceClient::DeleteDeliveryChannelAsync(const DeleteDeliveryChannel
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDeliveryChannelAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDeliveryChannelOutcomeCallable ConfigServiceClient::DeleteDeliveryChannelCallable(DeleteDeliveryChannelRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::DeleteDeliveryChannel, this, std::move(request)));
+}
+
+void ConfigServiceClient::DeleteDeliveryChannelAsync(DeleteDeliveryChannelRequest&& request, const DeleteDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::DeleteDeliveryChannelAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::DeleteDeliveryChannelAsyncHelper(const DeleteDeliveryChannelRequest& request, const DeleteDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDeliveryChannel(request), context);
@@ -227,7 +257,7 @@ DeleteEvaluationResultsOutcome ConfigServiceClient::DeleteEvaluationResults(cons
 
 DeleteEvaluationResultsOutcomeCallable ConfigServiceClient::DeleteEvaluationResultsCallable(const DeleteEvaluationResultsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteEvaluationResults(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteEvaluationResults(request); } );
 }
 
 void ConfigServiceClient::DeleteEvaluationResultsAsync(const DeleteEvaluationResultsRequest& request, const DeleteEvaluationResultsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -235,6 +265,16 @@ void ConfigServiceClient::DeleteEvaluationResultsAsync(const DeleteEvaluationRes
   m_executor->Submit( [this, request, handler, context](){ this->DeleteEvaluationResultsAsyncHelper( request, handler, context ); } );
 }
 
+DeleteEvaluationResultsOutcomeCallable ConfigServiceClient::DeleteEvaluationResultsCallable(DeleteEvaluationResultsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::DeleteEvaluationResults, this, std::move(request)));
+}
+
+void ConfigServiceClient::DeleteEvaluationResultsAsync(DeleteEvaluationResultsRequest&& request, const DeleteEvaluationResultsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::DeleteEvaluationResultsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::DeleteEvaluationResultsAsyncHelper(const DeleteEvaluationResultsRequest& request, const DeleteEvaluationResultsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteEvaluationResults(request), context);
@@ -258,7 +298,7 @@ DeliverConfigSnapshotOutcome ConfigServiceClient::DeliverConfigSnapshot(const De
 
 DeliverConfigSnapshotOutcomeCallable ConfigServiceClient::DeliverConfigSnapshotCallable(const DeliverConfigSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeliverConfigSnapshot(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeliverConfigSnapshot(request); } );
 }
 
 void ConfigServiceClient::DeliverConfigSnapshotAsync(const DeliverConfigSnapshotRequest& request, const DeliverConfigSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -266,6 +306,16 @@ void ConfigServiceClient::DeliverConfigSnapshotAsync(const DeliverConfigSnapshot
   m_executor->Submit( [this, request, handler, context](){ this->DeliverConfigSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+DeliverConfigSnapshotOutcomeCallable ConfigServiceClient::DeliverConfigSnapshotCallable(DeliverConfigSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::DeliverConfigSnapshot, this, std::move(request)));
+}
+
+void ConfigServiceClient::DeliverConfigSnapshotAsync(DeliverConfigSnapshotRequest&& request, const DeliverConfigSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::DeliverConfigSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::DeliverConfigSnapshotAsyncHelper(const DeliverConfigSnapshotRequest& request, const DeliverConfigSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeliverConfigSnapshot(request), context);
@@ -289,7 +339,7 @@ DescribeComplianceByConfigRuleOutcome ConfigServiceClient::DescribeComplianceByC
 
 DescribeComplianceByConfigRuleOutcomeCallable ConfigServiceClient::DescribeComplianceByConfigRuleCallable(const DescribeComplianceByConfigRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeComplianceByConfigRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeComplianceByConfigRule(request); } );
 }
 
 void ConfigServiceClient::DescribeComplianceByConfigRuleAsync(const DescribeComplianceByConfigRuleRequest& request, const DescribeComplianceByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -297,6 +347,16 @@ void ConfigServiceClient::DescribeComplianceByConfigRuleAsync(const DescribeComp
   m_executor->Submit( [this, request, handler, context](){ this->DescribeComplianceByConfigRuleAsyncHelper( request, handler, context ); } );
 }
 
+DescribeComplianceByConfigRuleOutcomeCallable ConfigServiceClient::DescribeComplianceByConfigRuleCallable(DescribeComplianceByConfigRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::DescribeComplianceByConfigRule, this, std::move(request)));
+}
+
+void ConfigServiceClient::DescribeComplianceByConfigRuleAsync(DescribeComplianceByConfigRuleRequest&& request, const DescribeComplianceByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::DescribeComplianceByConfigRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::DescribeComplianceByConfigRuleAsyncHelper(const DescribeComplianceByConfigRuleRequest& request, const DescribeComplianceByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeComplianceByConfigRule(request), context);
@@ -320,7 +380,7 @@ DescribeComplianceByResourceOutcome ConfigServiceClient::DescribeComplianceByRes
 
 DescribeComplianceByResourceOutcomeCallable ConfigServiceClient::DescribeComplianceByResourceCallable(const DescribeComplianceByResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeComplianceByResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeComplianceByResource(request); } );
 }
 
 void ConfigServiceClient::DescribeComplianceByResourceAsync(const DescribeComplianceByResourceRequest& request, const DescribeComplianceByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -328,6 +388,16 @@ void ConfigServiceClient::DescribeComplianceByResourceAsync(const DescribeCompli
   m_executor->Submit( [this, request, handler, context](){ this->DescribeComplianceByResourceAsyncHelper( request, handler, context ); } );
 }
 
+DescribeComplianceByResourceOutcomeCallable ConfigServiceClient::DescribeComplianceByResourceCallable(DescribeComplianceByResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::DescribeComplianceByResource, this, std::move(request)));
+}
+
+void ConfigServiceClient::DescribeComplianceByResourceAsync(DescribeComplianceByResourceRequest&& request, const DescribeComplianceByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::DescribeComplianceByResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::DescribeComplianceByResourceAsyncHelper(const DescribeComplianceByResourceRequest& request, const DescribeComplianceByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeComplianceByResource(request), context);
@@ -351,7 +421,7 @@ DescribeConfigRuleEvaluationStatusOutcome ConfigServiceClient::DescribeConfigRul
 
 DescribeConfigRuleEvaluationStatusOutcomeCallable ConfigServiceClient::DescribeConfigRuleEvaluationStatusCallable(const DescribeConfigRuleEvaluationStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeConfigRuleEvaluationStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeConfigRuleEvaluationStatus(request); } );
 }
 
 void ConfigServiceClient::DescribeConfigRuleEvaluationStatusAsync(const DescribeConfigRuleEvaluationStatusRequest& request, const DescribeConfigRuleEvaluationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -359,6 +429,16 @@ void ConfigServiceClient::DescribeConfigRuleEvaluationStatusAsync(const Describe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeConfigRuleEvaluationStatusAsyncHelper( request, handler, context ); } );
 }
 
+DescribeConfigRuleEvaluationStatusOutcomeCallable ConfigServiceClient::DescribeConfigRuleEvaluationStatusCallable(DescribeConfigRuleEvaluationStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::DescribeConfigRuleEvaluationStatus, this, std::move(request)));
+}
+
+void ConfigServiceClient::DescribeConfigRuleEvaluationStatusAsync(DescribeConfigRuleEvaluationStatusRequest&& request, const DescribeConfigRuleEvaluationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::DescribeConfigRuleEvaluationStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::DescribeConfigRuleEvaluationStatusAsyncHelper(const DescribeConfigRuleEvaluationStatusRequest& request, const DescribeConfigRuleEvaluationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeConfigRuleEvaluationStatus(request), context);
@@ -382,7 +462,7 @@ DescribeConfigRulesOutcome ConfigServiceClient::DescribeConfigRules(const Descri
 
 DescribeConfigRulesOutcomeCallable ConfigServiceClient::DescribeConfigRulesCallable(const DescribeConfigRulesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeConfigRules(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeConfigRules(request); } );
 }
 
 void ConfigServiceClient::DescribeConfigRulesAsync(const DescribeConfigRulesRequest& request, const DescribeConfigRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -390,6 +470,16 @@ void ConfigServiceClient::DescribeConfigRulesAsync(const DescribeConfigRulesRequ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeConfigRulesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeConfigRulesOutcomeCallable ConfigServiceClient::DescribeConfigRulesCallable(DescribeConfigRulesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::DescribeConfigRules, this, std::move(request)));
+}
+
+void ConfigServiceClient::DescribeConfigRulesAsync(DescribeConfigRulesRequest&& request, const DescribeConfigRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::DescribeConfigRulesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::DescribeConfigRulesAsyncHelper(const DescribeConfigRulesRequest& request, const DescribeConfigRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeConfigRules(request), context);
@@ -413,7 +503,7 @@ DescribeConfigurationRecorderStatusOutcome ConfigServiceClient::DescribeConfigur
 
 DescribeConfigurationRecorderStatusOutcomeCallable ConfigServiceClient::DescribeConfigurationRecorderStatusCallable(const DescribeConfigurationRecorderStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeConfigurationRecorderStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeConfigurationRecorderStatus(request); } );
 }
 
 void ConfigServiceClient::DescribeConfigurationRecorderStatusAsync(const DescribeConfigurationRecorderStatusRequest& request, const DescribeConfigurationRecorderStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -421,6 +511,16 @@ void ConfigServiceClient::DescribeConfigurationRecorderStatusAsync(const Describ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeConfigurationRecorderStatusAsyncHelper( request, handler, context ); } );
 }
 
+DescribeConfigurationRecorderStatusOutcomeCallable ConfigServiceClient::DescribeConfigurationRecorderStatusCallable(DescribeConfigurationRecorderStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::DescribeConfigurationRecorderStatus, this, std::move(request)));
+}
+
+void ConfigServiceClient::DescribeConfigurationRecorderStatusAsync(DescribeConfigurationRecorderStatusRequest&& request, const DescribeConfigurationRecorderStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::DescribeConfigurationRecorderStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::DescribeConfigurationRecorderStatusAsyncHelper(const DescribeConfigurationRecorderStatusRequest& request, const DescribeConfigurationRecorderStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeConfigurationRecorderStatus(request), context);
@@ -444,7 +544,7 @@ DescribeConfigurationRecordersOutcome ConfigServiceClient::DescribeConfiguration
 
 DescribeConfigurationRecordersOutcomeCallable ConfigServiceClient::DescribeConfigurationRecordersCallable(const DescribeConfigurationRecordersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeConfigurationRecorders(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeConfigurationRecorders(request); } );
 }
 
 void ConfigServiceClient::DescribeConfigurationRecordersAsync(const DescribeConfigurationRecordersRequest& request, const DescribeConfigurationRecordersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -452,6 +552,16 @@ void ConfigServiceClient::DescribeConfigurationRecordersAsync(const DescribeConf
   m_executor->Submit( [this, request, handler, context](){ this->DescribeConfigurationRecordersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeConfigurationRecordersOutcomeCallable ConfigServiceClient::DescribeConfigurationRecordersCallable(DescribeConfigurationRecordersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::DescribeConfigurationRecorders, this, std::move(request)));
+}
+
+void ConfigServiceClient::DescribeConfigurationRecordersAsync(DescribeConfigurationRecordersRequest&& request, const DescribeConfigurationRecordersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::DescribeConfigurationRecordersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::DescribeConfigurationRecordersAsyncHelper(const DescribeConfigurationRecordersRequest& request, const DescribeConfigurationRecordersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeConfigurationRecorders(request), context);
@@ -475,7 +585,7 @@ DescribeDeliveryChannelStatusOutcome ConfigServiceClient::DescribeDeliveryChanne
 
 DescribeDeliveryChannelStatusOutcomeCallable ConfigServiceClient::DescribeDeliveryChannelStatusCallable(const DescribeDeliveryChannelStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDeliveryChannelStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDeliveryChannelStatus(request); } );
 }
 
 void ConfigServiceClient::DescribeDeliveryChannelStatusAsync(const DescribeDeliveryChannelStatusRequest& request, const DescribeDeliveryChannelStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -483,6 +593,16 @@ void ConfigServiceClient::DescribeDeliveryChannelStatusAsync(const DescribeDeliv
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDeliveryChannelStatusAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDeliveryChannelStatusOutcomeCallable ConfigServiceClient::DescribeDeliveryChannelStatusCallable(DescribeDeliveryChannelStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::DescribeDeliveryChannelStatus, this, std::move(request)));
+}
+
+void ConfigServiceClient::DescribeDeliveryChannelStatusAsync(DescribeDeliveryChannelStatusRequest&& request, const DescribeDeliveryChannelStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::DescribeDeliveryChannelStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::DescribeDeliveryChannelStatusAsyncHelper(const DescribeDeliveryChannelStatusRequest& request, const DescribeDeliveryChannelStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDeliveryChannelStatus(request), context);
@@ -506,7 +626,7 @@ DescribeDeliveryChannelsOutcome ConfigServiceClient::DescribeDeliveryChannels(co
 
 DescribeDeliveryChannelsOutcomeCallable ConfigServiceClient::DescribeDeliveryChannelsCallable(const DescribeDeliveryChannelsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDeliveryChannels(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDeliveryChannels(request); } );
 }
 
 void ConfigServiceClient::DescribeDeliveryChannelsAsync(const DescribeDeliveryChannelsRequest& request, const DescribeDeliveryChannelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -514,6 +634,16 @@ void ConfigServiceClient::DescribeDeliveryChannelsAsync(const DescribeDeliveryCh
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDeliveryChannelsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDeliveryChannelsOutcomeCallable ConfigServiceClient::DescribeDeliveryChannelsCallable(DescribeDeliveryChannelsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::DescribeDeliveryChannels, this, std::move(request)));
+}
+
+void ConfigServiceClient::DescribeDeliveryChannelsAsync(DescribeDeliveryChannelsRequest&& request, const DescribeDeliveryChannelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::DescribeDeliveryChannelsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::DescribeDeliveryChannelsAsyncHelper(const DescribeDeliveryChannelsRequest& request, const DescribeDeliveryChannelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDeliveryChannels(request), context);
@@ -537,7 +667,7 @@ GetComplianceDetailsByConfigRuleOutcome ConfigServiceClient::GetComplianceDetail
 
 GetComplianceDetailsByConfigRuleOutcomeCallable ConfigServiceClient::GetComplianceDetailsByConfigRuleCallable(const GetComplianceDetailsByConfigRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetComplianceDetailsByConfigRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetComplianceDetailsByConfigRule(request); } );
 }
 
 void ConfigServiceClient::GetComplianceDetailsByConfigRuleAsync(const GetComplianceDetailsByConfigRuleRequest& request, const GetComplianceDetailsByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -545,6 +675,16 @@ void ConfigServiceClient::GetComplianceDetailsByConfigRuleAsync(const GetComplia
   m_executor->Submit( [this, request, handler, context](){ this->GetComplianceDetailsByConfigRuleAsyncHelper( request, handler, context ); } );
 }
 
+GetComplianceDetailsByConfigRuleOutcomeCallable ConfigServiceClient::GetComplianceDetailsByConfigRuleCallable(GetComplianceDetailsByConfigRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::GetComplianceDetailsByConfigRule, this, std::move(request)));
+}
+
+void ConfigServiceClient::GetComplianceDetailsByConfigRuleAsync(GetComplianceDetailsByConfigRuleRequest&& request, const GetComplianceDetailsByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::GetComplianceDetailsByConfigRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::GetComplianceDetailsByConfigRuleAsyncHelper(const GetComplianceDetailsByConfigRuleRequest& request, const GetComplianceDetailsByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetComplianceDetailsByConfigRule(request), context);
@@ -568,7 +708,7 @@ GetComplianceDetailsByResourceOutcome ConfigServiceClient::GetComplianceDetailsB
 
 GetComplianceDetailsByResourceOutcomeCallable ConfigServiceClient::GetComplianceDetailsByResourceCallable(const GetComplianceDetailsByResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetComplianceDetailsByResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetComplianceDetailsByResource(request); } );
 }
 
 void ConfigServiceClient::GetComplianceDetailsByResourceAsync(const GetComplianceDetailsByResourceRequest& request, const GetComplianceDetailsByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -576,6 +716,16 @@ void ConfigServiceClient::GetComplianceDetailsByResourceAsync(const GetComplianc
   m_executor->Submit( [this, request, handler, context](){ this->GetComplianceDetailsByResourceAsyncHelper( request, handler, context ); } );
 }
 
+GetComplianceDetailsByResourceOutcomeCallable ConfigServiceClient::GetComplianceDetailsByResourceCallable(GetComplianceDetailsByResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::GetComplianceDetailsByResource, this, std::move(request)));
+}
+
+void ConfigServiceClient::GetComplianceDetailsByResourceAsync(GetComplianceDetailsByResourceRequest&& request, const GetComplianceDetailsByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::GetComplianceDetailsByResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::GetComplianceDetailsByResourceAsyncHelper(const GetComplianceDetailsByResourceRequest& request, const GetComplianceDetailsByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetComplianceDetailsByResource(request), context);
@@ -599,7 +749,7 @@ GetComplianceSummaryByConfigRuleOutcome ConfigServiceClient::GetComplianceSummar
 
 GetComplianceSummaryByConfigRuleOutcomeCallable ConfigServiceClient::GetComplianceSummaryByConfigRuleCallable() const
 {
-  return std::async(std::launch::async, [this](){ return this->GetComplianceSummaryByConfigRule(); } );
+  return m_executor->SubmitCallable([this](){ return this->GetComplianceSummaryByConfigRule(); } );
 }
 
 void ConfigServiceClient::GetComplianceSummaryByConfigRuleAsync(const GetComplianceSummaryByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -630,7 +780,7 @@ GetComplianceSummaryByResourceTypeOutcome ConfigServiceClient::GetComplianceSumm
 
 GetComplianceSummaryByResourceTypeOutcomeCallable ConfigServiceClient::GetComplianceSummaryByResourceTypeCallable(const GetComplianceSummaryByResourceTypeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetComplianceSummaryByResourceType(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetComplianceSummaryByResourceType(request); } );
 }
 
 void ConfigServiceClient::GetComplianceSummaryByResourceTypeAsync(const GetComplianceSummaryByResourceTypeRequest& request, const GetComplianceSummaryByResourceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -638,6 +788,16 @@ void ConfigServiceClient::GetComplianceSummaryByResourceTypeAsync(const GetCompl
   m_executor->Submit( [this, request, handler, context](){ this->GetComplianceSummaryByResourceTypeAsyncHelper( request, handler, context ); } );
 }
 
+GetComplianceSummaryByResourceTypeOutcomeCallable ConfigServiceClient::GetComplianceSummaryByResourceTypeCallable(GetComplianceSummaryByResourceTypeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::GetComplianceSummaryByResourceType, this, std::move(request)));
+}
+
+void ConfigServiceClient::GetComplianceSummaryByResourceTypeAsync(GetComplianceSummaryByResourceTypeRequest&& request, const GetComplianceSummaryByResourceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::GetComplianceSummaryByResourceTypeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::GetComplianceSummaryByResourceTypeAsyncHelper(const GetComplianceSummaryByResourceTypeRequest& request, const GetComplianceSummaryByResourceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetComplianceSummaryByResourceType(request), context);
@@ -661,7 +821,7 @@ GetResourceConfigHistoryOutcome ConfigServiceClient::GetResourceConfigHistory(co
 
 GetResourceConfigHistoryOutcomeCallable ConfigServiceClient::GetResourceConfigHistoryCallable(const GetResourceConfigHistoryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetResourceConfigHistory(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetResourceConfigHistory(request); } );
 }
 
 void ConfigServiceClient::GetResourceConfigHistoryAsync(const GetResourceConfigHistoryRequest& request, const GetResourceConfigHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -669,6 +829,16 @@ void ConfigServiceClient::GetResourceConfigHistoryAsync(const GetResourceConfigH
   m_executor->Submit( [this, request, handler, context](){ this->GetResourceConfigHistoryAsyncHelper( request, handler, context ); } );
 }
 
+GetResourceConfigHistoryOutcomeCallable ConfigServiceClient::GetResourceConfigHistoryCallable(GetResourceConfigHistoryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::GetResourceConfigHistory, this, std::move(request)));
+}
+
+void ConfigServiceClient::GetResourceConfigHistoryAsync(GetResourceConfigHistoryRequest&& request, const GetResourceConfigHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::GetResourceConfigHistoryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::GetResourceConfigHistoryAsyncHelper(const GetResourceConfigHistoryRequest& request, const GetResourceConfigHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetResourceConfigHistory(request), context);
@@ -692,7 +862,7 @@ ListDiscoveredResourcesOutcome ConfigServiceClient::ListDiscoveredResources(cons
 
 ListDiscoveredResourcesOutcomeCallable ConfigServiceClient::ListDiscoveredResourcesCallable(const ListDiscoveredResourcesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDiscoveredResources(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDiscoveredResources(request); } );
 }
 
 void ConfigServiceClient::ListDiscoveredResourcesAsync(const ListDiscoveredResourcesRequest& request, const ListDiscoveredResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -700,6 +870,16 @@ void ConfigServiceClient::ListDiscoveredResourcesAsync(const ListDiscoveredResou
   m_executor->Submit( [this, request, handler, context](){ this->ListDiscoveredResourcesAsyncHelper( request, handler, context ); } );
 }
 
+ListDiscoveredResourcesOutcomeCallable ConfigServiceClient::ListDiscoveredResourcesCallable(ListDiscoveredResourcesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::ListDiscoveredResources, this, std::move(request)));
+}
+
+void ConfigServiceClient::ListDiscoveredResourcesAsync(ListDiscoveredResourcesRequest&& request, const ListDiscoveredResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::ListDiscoveredResourcesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::ListDiscoveredResourcesAsyncHelper(const ListDiscoveredResourcesRequest& request, const ListDiscoveredResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDiscoveredResources(request), context);
@@ -723,7 +903,7 @@ PutConfigRuleOutcome ConfigServiceClient::PutConfigRule(const PutConfigRuleReque
 
 PutConfigRuleOutcomeCallable ConfigServiceClient::PutConfigRuleCallable(const PutConfigRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutConfigRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutConfigRule(request); } );
 }
 
 void ConfigServiceClient::PutConfigRuleAsync(const PutConfigRuleRequest& request, const PutConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -731,6 +911,16 @@ void ConfigServiceClient::PutConfigRuleAsync(const PutConfigRuleRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->PutConfigRuleAsyncHelper( request, handler, context ); } );
 }
 
+PutConfigRuleOutcomeCallable ConfigServiceClient::PutConfigRuleCallable(PutConfigRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::PutConfigRule, this, std::move(request)));
+}
+
+void ConfigServiceClient::PutConfigRuleAsync(PutConfigRuleRequest&& request, const PutConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::PutConfigRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::PutConfigRuleAsyncHelper(const PutConfigRuleRequest& request, const PutConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutConfigRule(request), context);
@@ -754,7 +944,7 @@ PutConfigurationRecorderOutcome ConfigServiceClient::PutConfigurationRecorder(co
 
 PutConfigurationRecorderOutcomeCallable ConfigServiceClient::PutConfigurationRecorderCallable(const PutConfigurationRecorderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutConfigurationRecorder(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutConfigurationRecorder(request); } );
 }
 
 void ConfigServiceClient::PutConfigurationRecorderAsync(const PutConfigurationRecorderRequest& request, const PutConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -762,6 +952,16 @@ void ConfigServiceClient::PutConfigurationRecorderAsync(const PutConfigurationRe
   m_executor->Submit( [this, request, handler, context](){ this->PutConfigurationRecorderAsyncHelper( request, handler, context ); } );
 }
 
+PutConfigurationRecorderOutcomeCallable ConfigServiceClient::PutConfigurationRecorderCallable(PutConfigurationRecorderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::PutConfigurationRecorder, this, std::move(request)));
+}
+
+void ConfigServiceClient::PutConfigurationRecorderAsync(PutConfigurationRecorderRequest&& request, const PutConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::PutConfigurationRecorderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::PutConfigurationRecorderAsyncHelper(const PutConfigurationRecorderRequest& request, const PutConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutConfigurationRecorder(request), context);
@@ -785,7 +985,7 @@ PutDeliveryChannelOutcome ConfigServiceClient::PutDeliveryChannel(const PutDeliv
 
 PutDeliveryChannelOutcomeCallable ConfigServiceClient::PutDeliveryChannelCallable(const PutDeliveryChannelRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutDeliveryChannel(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutDeliveryChannel(request); } );
 }
 
 void ConfigServiceClient::PutDeliveryChannelAsync(const PutDeliveryChannelRequest& request, const PutDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -793,6 +993,16 @@ void ConfigServiceClient::PutDeliveryChannelAsync(const PutDeliveryChannelReques
   m_executor->Submit( [this, request, handler, context](){ this->PutDeliveryChannelAsyncHelper( request, handler, context ); } );
 }
 
+PutDeliveryChannelOutcomeCallable ConfigServiceClient::PutDeliveryChannelCallable(PutDeliveryChannelRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::PutDeliveryChannel, this, std::move(request)));
+}
+
+void ConfigServiceClient::PutDeliveryChannelAsync(PutDeliveryChannelRequest&& request, const PutDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::PutDeliveryChannelAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::PutDeliveryChannelAsyncHelper(const PutDeliveryChannelRequest& request, const PutDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutDeliveryChannel(request), context);
@@ -816,7 +1026,7 @@ PutEvaluationsOutcome ConfigServiceClient::PutEvaluations(const PutEvaluationsRe
 
 PutEvaluationsOutcomeCallable ConfigServiceClient::PutEvaluationsCallable(const PutEvaluationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutEvaluations(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutEvaluations(request); } );
 }
 
 void ConfigServiceClient::PutEvaluationsAsync(const PutEvaluationsRequest& request, const PutEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -824,6 +1034,16 @@ void ConfigServiceClient::PutEvaluationsAsync(const PutEvaluationsRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->PutEvaluationsAsyncHelper( request, handler, context ); } );
 }
 
+PutEvaluationsOutcomeCallable ConfigServiceClient::PutEvaluationsCallable(PutEvaluationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::PutEvaluations, this, std::move(request)));
+}
+
+void ConfigServiceClient::PutEvaluationsAsync(PutEvaluationsRequest&& request, const PutEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::PutEvaluationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::PutEvaluationsAsyncHelper(const PutEvaluationsRequest& request, const PutEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutEvaluations(request), context);
@@ -847,7 +1067,7 @@ StartConfigRulesEvaluationOutcome ConfigServiceClient::StartConfigRulesEvaluatio
 
 StartConfigRulesEvaluationOutcomeCallable ConfigServiceClient::StartConfigRulesEvaluationCallable(const StartConfigRulesEvaluationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StartConfigRulesEvaluation(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StartConfigRulesEvaluation(request); } );
 }
 
 void ConfigServiceClient::StartConfigRulesEvaluationAsync(const StartConfigRulesEvaluationRequest& request, const StartConfigRulesEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -855,6 +1075,16 @@ void ConfigServiceClient::StartConfigRulesEvaluationAsync(const StartConfigRules
   m_executor->Submit( [this, request, handler, context](){ this->StartConfigRulesEvaluationAsyncHelper( request, handler, context ); } );
 }
 
+StartConfigRulesEvaluationOutcomeCallable ConfigServiceClient::StartConfigRulesEvaluationCallable(StartConfigRulesEvaluationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::StartConfigRulesEvaluation, this, std::move(request)));
+}
+
+void ConfigServiceClient::StartConfigRulesEvaluationAsync(StartConfigRulesEvaluationRequest&& request, const StartConfigRulesEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::StartConfigRulesEvaluationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::StartConfigRulesEvaluationAsyncHelper(const StartConfigRulesEvaluationRequest& request, const StartConfigRulesEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StartConfigRulesEvaluation(request), context);
@@ -878,7 +1108,7 @@ StartConfigurationRecorderOutcome ConfigServiceClient::StartConfigurationRecorde
 
 StartConfigurationRecorderOutcomeCallable ConfigServiceClient::StartConfigurationRecorderCallable(const StartConfigurationRecorderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StartConfigurationRecorder(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StartConfigurationRecorder(request); } );
 }
 
 void ConfigServiceClient::StartConfigurationRecorderAsync(const StartConfigurationRecorderRequest& request, const StartConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -886,6 +1116,16 @@ void ConfigServiceClient::StartConfigurationRecorderAsync(const StartConfigurati
   m_executor->Submit( [this, request, handler, context](){ this->StartConfigurationRecorderAsyncHelper( request, handler, context ); } );
 }
 
+StartConfigurationRecorderOutcomeCallable ConfigServiceClient::StartConfigurationRecorderCallable(StartConfigurationRecorderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::StartConfigurationRecorder, this, std::move(request)));
+}
+
+void ConfigServiceClient::StartConfigurationRecorderAsync(StartConfigurationRecorderRequest&& request, const StartConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::StartConfigurationRecorderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::StartConfigurationRecorderAsyncHelper(const StartConfigurationRecorderRequest& request, const StartConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StartConfigurationRecorder(request), context);
@@ -909,7 +1149,7 @@ StopConfigurationRecorderOutcome ConfigServiceClient::StopConfigurationRecorder(
 
 StopConfigurationRecorderOutcomeCallable ConfigServiceClient::StopConfigurationRecorderCallable(const StopConfigurationRecorderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StopConfigurationRecorder(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StopConfigurationRecorder(request); } );
 }
 
 void ConfigServiceClient::StopConfigurationRecorderAsync(const StopConfigurationRecorderRequest& request, const StopConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -917,8 +1157,269 @@ void ConfigServiceClient::StopConfigurationRecorderAsync(const StopConfiguration
   m_executor->Submit( [this, request, handler, context](){ this->StopConfigurationRecorderAsyncHelper( request, handler, context ); } );
 }
 
+StopConfigurationRecorderOutcomeCallable ConfigServiceClient::StopConfigurationRecorderCallable(StopConfigurationRecorderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ConfigServiceClient::StopConfigurationRecorder, this, std::move(request)));
+}
+
+void ConfigServiceClient::StopConfigurationRecorderAsync(StopConfigurationRecorderRequest&& request, const StopConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ConfigServiceClient::StopConfigurationRecorderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ConfigServiceClient::StopConfigurationRecorderAsyncHelper(const StopConfigurationRecorderRequest& request, const StopConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StopConfigurationRecorder(request), context);
 }
 
+Paginator<ConfigServiceClient, DescribeComplianceByConfigRuleRequest, DescribeComplianceByConfigRuleOutcome> ConfigServiceClient::DescribeComplianceByConfigRulePaginator(const DescribeComplianceByConfigRuleRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ConfigServiceClient, DescribeComplianceByConfigRuleRequest, DescribeComplianceByConfigRuleOutcome>(this, &ConfigServiceClient::DescribeComplianceByConfigRule, request,
+    [](const DescribeComplianceByConfigRuleRequest& current, const DescribeComplianceByConfigRuleOutcome& outcome, DescribeComplianceByConfigRuleRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ConfigServiceClient, DescribeComplianceByResourceRequest, DescribeComplianceByResourceOutcome> ConfigServiceClient::DescribeComplianceByResourcePaginator(const DescribeComplianceByResourceRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ConfigServiceClient, DescribeComplianceByResourceRequest, DescribeComplianceByResourceOutcome>(this, &ConfigServiceClient::DescribeComplianceByResource, request,
+    [](const DescribeComplianceByResourceRequest& current, const DescribeComplianceByResourceOutcome& outcome, DescribeComplianceByResourceRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ConfigServiceClient, DescribeConfigRulesRequest, DescribeConfigRulesOutcome> ConfigServiceClient::DescribeConfigRulesPaginator(const DescribeConfigRulesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ConfigServiceClient, DescribeConfigRulesRequest, DescribeConfigRulesOutcome>(this, &ConfigServiceClient::DescribeConfigRules, request,
+    [](const DescribeConfigRulesRequest& current, const DescribeConfigRulesOutcome& outcome, DescribeConfigRulesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ConfigServiceClient, GetComplianceDetailsByConfigRuleRequest, GetComplianceDetailsByConfigRuleOutcome> ConfigServiceClient::GetComplianceDetailsByConfigRulePaginator(const GetComplianceDetailsByConfigRuleRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ConfigServiceClient, GetComplianceDetailsByConfigRuleRequest, GetComplianceDetailsByConfigRuleOutcome>(this, &ConfigServiceClient::GetComplianceDetailsByConfigRule, request,
+    [](const GetComplianceDetailsByConfigRuleRequest& current, const GetComplianceDetailsByConfigRuleOutcome& outcome, GetComplianceDetailsByConfigRuleRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ConfigServiceClient, GetComplianceDetailsByResourceRequest, GetComplianceDetailsByResourceOutcome> ConfigServiceClient::GetComplianceDetailsByResourcePaginator(const GetComplianceDetailsByResourceRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ConfigServiceClient, GetComplianceDetailsByResourceRequest, GetComplianceDetailsByResourceOutcome>(this, &ConfigServiceClient::GetComplianceDetailsByResource, request,
+    [](const GetComplianceDetailsByResourceRequest& current, const GetComplianceDetailsByResourceOutcome& outcome, GetComplianceDetailsByResourceRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ConfigServiceClient, GetResourceConfigHistoryRequest, GetResourceConfigHistoryOutcome> ConfigServiceClient::GetResourceConfigHistoryPaginator(const GetResourceConfigHistoryRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ConfigServiceClient, GetResourceConfigHistoryRequest, GetResourceConfigHistoryOutcome>(this, &ConfigServiceClient::GetResourceConfigHistory, request,
+    [](const GetResourceConfigHistoryRequest& current, const GetResourceConfigHistoryOutcome& outcome, GetResourceConfigHistoryRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ConfigServiceClient, ListDiscoveredResourcesRequest, ListDiscoveredResourcesOutcome> ConfigServiceClient::ListDiscoveredResourcesPaginator(const ListDiscoveredResourcesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ConfigServiceClient, ListDiscoveredResourcesRequest, ListDiscoveredResourcesOutcome>(this, &ConfigServiceClient::ListDiscoveredResources, request,
+    [](const ListDiscoveredResourcesRequest& current, const ListDiscoveredResourcesOutcome& outcome, ListDiscoveredResourcesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<ConfigServiceClient, DeleteConfigRuleRequest, DeleteConfigRuleOutcome> ConfigServiceClient::DeleteConfigRuleAwaitable(DeleteConfigRuleRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::DeleteConfigRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, DeleteConfigurationRecorderRequest, DeleteConfigurationRecorderOutcome> ConfigServiceClient::DeleteConfigurationRecorderAwaitable(DeleteConfigurationRecorderRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::DeleteConfigurationRecorder, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, DeleteDeliveryChannelRequest, DeleteDeliveryChannelOutcome> ConfigServiceClient::DeleteDeliveryChannelAwaitable(DeleteDeliveryChannelRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::DeleteDeliveryChannel, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, DeleteEvaluationResultsRequest, DeleteEvaluationResultsOutcome> ConfigServiceClient::DeleteEvaluationResultsAwaitable(DeleteEvaluationResultsRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::DeleteEvaluationResults, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, DeliverConfigSnapshotRequest, DeliverConfigSnapshotOutcome> ConfigServiceClient::DeliverConfigSnapshotAwaitable(DeliverConfigSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::DeliverConfigSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, DescribeComplianceByConfigRuleRequest, DescribeComplianceByConfigRuleOutcome> ConfigServiceClient::DescribeComplianceByConfigRuleAwaitable(DescribeComplianceByConfigRuleRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::DescribeComplianceByConfigRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, DescribeComplianceByResourceRequest, DescribeComplianceByResourceOutcome> ConfigServiceClient::DescribeComplianceByResourceAwaitable(DescribeComplianceByResourceRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::DescribeComplianceByResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, DescribeConfigRuleEvaluationStatusRequest, DescribeConfigRuleEvaluationStatusOutcome> ConfigServiceClient::DescribeConfigRuleEvaluationStatusAwaitable(DescribeConfigRuleEvaluationStatusRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::DescribeConfigRuleEvaluationStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, DescribeConfigRulesRequest, DescribeConfigRulesOutcome> ConfigServiceClient::DescribeConfigRulesAwaitable(DescribeConfigRulesRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::DescribeConfigRules, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, DescribeConfigurationRecorderStatusRequest, DescribeConfigurationRecorderStatusOutcome> ConfigServiceClient::DescribeConfigurationRecorderStatusAwaitable(DescribeConfigurationRecorderStatusRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::DescribeConfigurationRecorderStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, DescribeConfigurationRecordersRequest, DescribeConfigurationRecordersOutcome> ConfigServiceClient::DescribeConfigurationRecordersAwaitable(DescribeConfigurationRecordersRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::DescribeConfigurationRecorders, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, DescribeDeliveryChannelStatusRequest, DescribeDeliveryChannelStatusOutcome> ConfigServiceClient::DescribeDeliveryChannelStatusAwaitable(DescribeDeliveryChannelStatusRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::DescribeDeliveryChannelStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, DescribeDeliveryChannelsRequest, DescribeDeliveryChannelsOutcome> ConfigServiceClient::DescribeDeliveryChannelsAwaitable(DescribeDeliveryChannelsRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::DescribeDeliveryChannels, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, GetComplianceDetailsByConfigRuleRequest, GetComplianceDetailsByConfigRuleOutcome> ConfigServiceClient::GetComplianceDetailsByConfigRuleAwaitable(GetComplianceDetailsByConfigRuleRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::GetComplianceDetailsByConfigRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, GetComplianceDetailsByResourceRequest, GetComplianceDetailsByResourceOutcome> ConfigServiceClient::GetComplianceDetailsByResourceAwaitable(GetComplianceDetailsByResourceRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::GetComplianceDetailsByResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, void, GetComplianceSummaryByConfigRuleOutcome> ConfigServiceClient::GetComplianceSummaryByConfigRuleAwaitable() const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::GetComplianceSummaryByConfigRule } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, GetComplianceSummaryByResourceTypeRequest, GetComplianceSummaryByResourceTypeOutcome> ConfigServiceClient::GetComplianceSummaryByResourceTypeAwaitable(GetComplianceSummaryByResourceTypeRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::GetComplianceSummaryByResourceType, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, GetResourceConfigHistoryRequest, GetResourceConfigHistoryOutcome> ConfigServiceClient::GetResourceConfigHistoryAwaitable(GetResourceConfigHistoryRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::GetResourceConfigHistory, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, ListDiscoveredResourcesRequest, ListDiscoveredResourcesOutcome> ConfigServiceClient::ListDiscoveredResourcesAwaitable(ListDiscoveredResourcesRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::ListDiscoveredResources, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, PutConfigRuleRequest, PutConfigRuleOutcome> ConfigServiceClient::PutConfigRuleAwaitable(PutConfigRuleRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::PutConfigRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, PutConfigurationRecorderRequest, PutConfigurationRecorderOutcome> ConfigServiceClient::PutConfigurationRecorderAwaitable(PutConfigurationRecorderRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::PutConfigurationRecorder, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, PutDeliveryChannelRequest, PutDeliveryChannelOutcome> ConfigServiceClient::PutDeliveryChannelAwaitable(PutDeliveryChannelRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::PutDeliveryChannel, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, PutEvaluationsRequest, PutEvaluationsOutcome> ConfigServiceClient::PutEvaluationsAwaitable(PutEvaluationsRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::PutEvaluations, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, StartConfigRulesEvaluationRequest, StartConfigRulesEvaluationOutcome> ConfigServiceClient::StartConfigRulesEvaluationAwaitable(StartConfigRulesEvaluationRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::StartConfigRulesEvaluation, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, StartConfigurationRecorderRequest, StartConfigurationRecorderOutcome> ConfigServiceClient::StartConfigurationRecorderAwaitable(StartConfigurationRecorderRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::StartConfigurationRecorder, std::move(request) } };
+}
+
+ClientOperationAwaitable<ConfigServiceClient, StopConfigurationRecorderRequest, StopConfigurationRecorderOutcome> ConfigServiceClient::StopConfigurationRecorderAwaitable(StopConfigurationRecorderRequest request) const
+{
+  return { m_executor.get(), { this, &ConfigServiceClient::StopConfigurationRecorder, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
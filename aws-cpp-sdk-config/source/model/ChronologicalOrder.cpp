@@ -29,21 +29,29 @@ namespace Aws
       namespace ChronologicalOrderMapper
       {
 
-        static const int Reverse_HASH = HashingUtils::HashString("Reverse");
-        static const int Forward_HASH = HashingUtils::HashString("Forward");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Reverse_HASH = -1530467646;
+        static const int Forward_HASH = 987507365;
 
 
         ChronologicalOrder GetChronologicalOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Reverse_HASH)
+          switch (hashCode)
           {
+          case Reverse_HASH:
             return ChronologicalOrder::Reverse;
-          }
-          else if (hashCode == Forward_HASH)
-          {
+          case Forward_HASH:
             return ChronologicalOrder::Forward;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
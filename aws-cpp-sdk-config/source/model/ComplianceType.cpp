@@ -29,31 +29,35 @@ namespace Aws
       namespace ComplianceTypeMapper
       {
 
-        static const int COMPLIANT_HASH = HashingUtils::HashString("COMPLIANT");
-        static const int NON_COMPLIANT_HASH = HashingUtils::HashString("NON_COMPLIANT");
-        static const int NOT_APPLICABLE_HASH = HashingUtils::HashString("NOT_APPLICABLE");
-        static const int INSUFFICIENT_DATA_HASH = HashingUtils::HashString("INSUFFICIENT_DATA");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int COMPLIANT_HASH = 1383764347;
+        static const int NON_COMPLIANT_HASH = 1663567465;
+        static const int NOT_APPLICABLE_HASH = 978028715;
+        static const int INSUFFICIENT_DATA_HASH = -1936956826;
 
 
         ComplianceType GetComplianceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMPLIANT_HASH)
+          switch (hashCode)
           {
+          case COMPLIANT_HASH:
             return ComplianceType::COMPLIANT;
-          }
-          else if (hashCode == NON_COMPLIANT_HASH)
-          {
+          case NON_COMPLIANT_HASH:
             return ComplianceType::NON_COMPLIANT;
-          }
-          else if (hashCode == NOT_APPLICABLE_HASH)
-          {
+          case NOT_APPLICABLE_HASH:
             return ComplianceType::NOT_APPLICABLE;
-          }
-          else if (hashCode == INSUFFICIENT_DATA_HASH)
-          {
+          case INSUFFICIENT_DATA_HASH:
             return ComplianceType::INSUFFICIENT_DATA;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
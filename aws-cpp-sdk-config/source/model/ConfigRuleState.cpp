@@ -29,31 +29,35 @@ namespace Aws
       namespace ConfigRuleStateMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETING_RESULTS_HASH = HashingUtils::HashString("DELETING_RESULTS");
-        static const int EVALUATING_HASH = HashingUtils::HashString("EVALUATING");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ACTIVE_HASH = 1925346054;
+        static const int DELETING_HASH = 1602343848;
+        static const int DELETING_RESULTS_HASH = -72476097;
+        static const int EVALUATING_HASH = 1343615766;
 
 
         ConfigRuleState GetConfigRuleStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          switch (hashCode)
           {
+          case ACTIVE_HASH:
             return ConfigRuleState::ACTIVE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
+          case DELETING_HASH:
             return ConfigRuleState::DELETING;
-          }
-          else if (hashCode == DELETING_RESULTS_HASH)
-          {
+          case DELETING_RESULTS_HASH:
             return ConfigRuleState::DELETING_RESULTS;
-          }
-          else if (hashCode == EVALUATING_HASH)
-          {
+          case EVALUATING_HASH:
             return ConfigRuleState::EVALUATING;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,31 +29,35 @@ namespace Aws
       namespace ConfigurationItemStatusMapper
       {
 
-        static const int Ok_HASH = HashingUtils::HashString("Ok");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Discovered_HASH = HashingUtils::HashString("Discovered");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Ok_HASH = 2556;
+        static const int Failed_HASH = 2096857181;
+        static const int Discovered_HASH = -1763964312;
+        static const int Deleted_HASH = -1079851015;
 
 
         ConfigurationItemStatus GetConfigurationItemStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Ok_HASH)
+          switch (hashCode)
           {
+          case Ok_HASH:
             return ConfigurationItemStatus::Ok;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return ConfigurationItemStatus::Failed;
-          }
-          else if (hashCode == Discovered_HASH)
-          {
+          case Discovered_HASH:
             return ConfigurationItemStatus::Discovered;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
+          case Deleted_HASH:
             return ConfigurationItemStatus::Deleted;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
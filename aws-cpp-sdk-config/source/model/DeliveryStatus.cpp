@@ -29,26 +29,32 @@ namespace Aws
       namespace DeliveryStatusMapper
       {
 
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Failure_HASH = HashingUtils::HashString("Failure");
-        static const int Not_Applicable_HASH = HashingUtils::HashString("Not_Applicable");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Success_HASH = -202516509;
+        static const int Failure_HASH = 578079082;
+        static const int Not_Applicable_HASH = 1523119307;
 
 
         DeliveryStatus GetDeliveryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Success_HASH)
+          switch (hashCode)
           {
+          case Success_HASH:
             return DeliveryStatus::Success;
-          }
-          else if (hashCode == Failure_HASH)
-          {
+          case Failure_HASH:
             return DeliveryStatus::Failure;
-          }
-          else if (hashCode == Not_Applicable_HASH)
-          {
+          case Not_Applicable_HASH:
             return DeliveryStatus::Not_Applicable;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
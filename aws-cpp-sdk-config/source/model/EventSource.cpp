@@ -29,16 +29,26 @@ namespace Aws
       namespace EventSourceMapper
       {
 
-        static const int aws_config_HASH = HashingUtils::HashString("aws.config");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int aws_config_HASH = 1449707347;
 
 
         EventSource GetEventSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == aws_config_HASH)
+          switch (hashCode)
           {
+          case aws_config_HASH:
             return EventSource::aws_config;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
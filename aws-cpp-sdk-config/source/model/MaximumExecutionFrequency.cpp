@@ -29,36 +29,38 @@ namespace Aws
       namespace MaximumExecutionFrequencyMapper
       {
 
-        static const int One_Hour_HASH = HashingUtils::HashString("One_Hour");
-        static const int Three_Hours_HASH = HashingUtils::HashString("Three_Hours");
-        static const int Six_Hours_HASH = HashingUtils::HashString("Six_Hours");
-        static const int Twelve_Hours_HASH = HashingUtils::HashString("Twelve_Hours");
-        static const int TwentyFour_Hours_HASH = HashingUtils::HashString("TwentyFour_Hours");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int One_Hour_HASH = 2065754205;
+        static const int Three_Hours_HASH = -1605543698;
+        static const int Six_Hours_HASH = 532571442;
+        static const int Twelve_Hours_HASH = 291052009;
+        static const int TwentyFour_Hours_HASH = 45622151;
 
 
         MaximumExecutionFrequency GetMaximumExecutionFrequencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == One_Hour_HASH)
+          switch (hashCode)
           {
+          case One_Hour_HASH:
             return MaximumExecutionFrequency::One_Hour;
-          }
-          else if (hashCode == Three_Hours_HASH)
-          {
+          case Three_Hours_HASH:
             return MaximumExecutionFrequency::Three_Hours;
-          }
-          else if (hashCode == Six_Hours_HASH)
-          {
+          case Six_Hours_HASH:
             return MaximumExecutionFrequency::Six_Hours;
-          }
-          else if (hashCode == Twelve_Hours_HASH)
-          {
+          case Twelve_Hours_HASH:
             return MaximumExecutionFrequency::Twelve_Hours;
-          }
-          else if (hashCode == TwentyFour_Hours_HASH)
-          {
+          case TwentyFour_Hours_HASH:
             return MaximumExecutionFrequency::TwentyFour_Hours;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace MessageTypeMapper
       {
 
-        static const int ConfigurationItemChangeNotification_HASH = HashingUtils::HashString("ConfigurationItemChangeNotification");
-        static const int ConfigurationSnapshotDeliveryCompleted_HASH = HashingUtils::HashString("ConfigurationSnapshotDeliveryCompleted");
-        static const int ScheduledNotification_HASH = HashingUtils::HashString("ScheduledNotification");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ConfigurationItemChangeNotification_HASH = 498929060;
+        static const int ConfigurationSnapshotDeliveryCompleted_HASH = -1988423907;
+        static const int ScheduledNotification_HASH = -1149349352;
 
 
         MessageType GetMessageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ConfigurationItemChangeNotification_HASH)
+          switch (hashCode)
           {
+          case ConfigurationItemChangeNotification_HASH:
             return MessageType::ConfigurationItemChangeNotification;
-          }
-          else if (hashCode == ConfigurationSnapshotDeliveryCompleted_HASH)
-          {
+          case ConfigurationSnapshotDeliveryCompleted_HASH:
             return MessageType::ConfigurationSnapshotDeliveryCompleted;
-          }
-          else if (hashCode == ScheduledNotification_HASH)
-          {
+          case ScheduledNotification_HASH:
             return MessageType::ScheduledNotification;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
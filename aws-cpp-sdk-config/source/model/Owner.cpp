@@ -29,21 +29,29 @@ namespace Aws
       namespace OwnerMapper
       {
 
-        static const int CUSTOM_LAMBDA_HASH = HashingUtils::HashString("CUSTOM_LAMBDA");
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CUSTOM_LAMBDA_HASH = -1892240299;
+        static const int AWS_HASH = 65245;
 
 
         Owner GetOwnerForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CUSTOM_LAMBDA_HASH)
+          switch (hashCode)
           {
+          case CUSTOM_LAMBDA_HASH:
             return Owner::CUSTOM_LAMBDA;
-          }
-          else if (hashCode == AWS_HASH)
-          {
+          case AWS_HASH:
             return Owner::AWS;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
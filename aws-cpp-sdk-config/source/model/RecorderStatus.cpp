@@ -29,26 +29,32 @@ namespace Aws
       namespace RecorderStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Failure_HASH = HashingUtils::HashString("Failure");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Pending_HASH = 982065527;
+        static const int Success_HASH = -202516509;
+        static const int Failure_HASH = 578079082;
 
 
         RecorderStatus GetRecorderStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          switch (hashCode)
           {
+          case Pending_HASH:
             return RecorderStatus::Pending;
-          }
-          else if (hashCode == Success_HASH)
-          {
+          case Success_HASH:
             return RecorderStatus::Success;
-          }
-          else if (hashCode == Failure_HASH)
-          {
+          case Failure_HASH:
             return RecorderStatus::Failure;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,136 +29,98 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int AWS_EC2_CustomerGateway_HASH = HashingUtils::HashString("AWS::EC2::CustomerGateway");
-        static const int AWS_EC2_EIP_HASH = HashingUtils::HashString("AWS::EC2::EIP");
-        static const int AWS_EC2_Host_HASH = HashingUtils::HashString("AWS::EC2::Host");
-        static const int AWS_EC2_Instance_HASH = HashingUtils::HashString("AWS::EC2::Instance");
-        static const int AWS_EC2_InternetGateway_HASH = HashingUtils::HashString("AWS::EC2::InternetGateway");
-        static const int AWS_EC2_NetworkAcl_HASH = HashingUtils::HashString("AWS::EC2::NetworkAcl");
-        static const int AWS_EC2_NetworkInterface_HASH = HashingUtils::HashString("AWS::EC2::NetworkInterface");
-        static const int AWS_EC2_RouteTable_HASH = HashingUtils::HashString("AWS::EC2::RouteTable");
-        static const int AWS_EC2_SecurityGroup_HASH = HashingUtils::HashString("AWS::EC2::SecurityGroup");
-        static const int AWS_EC2_Subnet_HASH = HashingUtils::HashString("AWS::EC2::Subnet");
-        static const int AWS_CloudTrail_Trail_HASH = HashingUtils::HashString("AWS::CloudTrail::Trail");
-        static const int AWS_EC2_Volume_HASH = HashingUtils::HashString("AWS::EC2::Volume");
-        static const int AWS_EC2_VPC_HASH = HashingUtils::HashString("AWS::EC2::VPC");
-        static const int AWS_EC2_VPNConnection_HASH = HashingUtils::HashString("AWS::EC2::VPNConnection");
-        static const int AWS_EC2_VPNGateway_HASH = HashingUtils::HashString("AWS::EC2::VPNGateway");
-        static const int AWS_IAM_Group_HASH = HashingUtils::HashString("AWS::IAM::Group");
-        static const int AWS_IAM_Policy_HASH = HashingUtils::HashString("AWS::IAM::Policy");
-        static const int AWS_IAM_Role_HASH = HashingUtils::HashString("AWS::IAM::Role");
-        static const int AWS_IAM_User_HASH = HashingUtils::HashString("AWS::IAM::User");
-        static const int AWS_ACM_Certificate_HASH = HashingUtils::HashString("AWS::ACM::Certificate");
-        static const int AWS_RDS_DBInstance_HASH = HashingUtils::HashString("AWS::RDS::DBInstance");
-        static const int AWS_RDS_DBSubnetGroup_HASH = HashingUtils::HashString("AWS::RDS::DBSubnetGroup");
-        static const int AWS_RDS_DBSecurityGroup_HASH = HashingUtils::HashString("AWS::RDS::DBSecurityGroup");
-        static const int AWS_RDS_DBSnapshot_HASH = HashingUtils::HashString("AWS::RDS::DBSnapshot");
-        static const int AWS_RDS_EventSubscription_HASH = HashingUtils::HashString("AWS::RDS::EventSubscription");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int AWS_EC2_CustomerGateway_HASH = -1411585361;
+        static const int AWS_EC2_EIP_HASH = -1820312587;
+        static const int AWS_EC2_Host_HASH = -594988257;
+        static const int AWS_EC2_Instance_HASH = 1939160716;
+        static const int AWS_EC2_InternetGateway_HASH = -1748689428;
+        static const int AWS_EC2_NetworkAcl_HASH = -1862641741;
+        static const int AWS_EC2_NetworkInterface_HASH = 459966882;
+        static const int AWS_EC2_RouteTable_HASH = -482367684;
+        static const int AWS_EC2_SecurityGroup_HASH = 1769213832;
+        static const int AWS_EC2_Subnet_HASH = -233111788;
+        static const int AWS_CloudTrail_Trail_HASH = -1212490920;
+        static const int AWS_EC2_Volume_HASH = -152460591;
+        static const int AWS_EC2_VPC_HASH = -1820296046;
+        static const int AWS_EC2_VPNConnection_HASH = -1829931173;
+        static const int AWS_EC2_VPNGateway_HASH = -1689819417;
+        static const int AWS_IAM_Group_HASH = 1374489063;
+        static const int AWS_IAM_Policy_HASH = -85721398;
+        static const int AWS_IAM_Role_HASH = -232431602;
+        static const int AWS_IAM_User_HASH = -232338589;
+        static const int AWS_ACM_Certificate_HASH = -1031730039;
+        static const int AWS_RDS_DBInstance_HASH = -1448618793;
+        static const int AWS_RDS_DBSubnetGroup_HASH = 355145120;
+        static const int AWS_RDS_DBSecurityGroup_HASH = -1517637603;
+        static const int AWS_RDS_DBSnapshot_HASH = -1718872570;
+        static const int AWS_RDS_EventSubscription_HASH = 95073939;
 
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_EC2_CustomerGateway_HASH)
+          switch (hashCode)
           {
+          case AWS_EC2_CustomerGateway_HASH:
             return ResourceType::AWS_EC2_CustomerGateway;
-          }
-          else if (hashCode == AWS_EC2_EIP_HASH)
-          {
+          case AWS_EC2_EIP_HASH:
             return ResourceType::AWS_EC2_EIP;
-          }
-          else if (hashCode == AWS_EC2_Host_HASH)
-          {
+          case AWS_EC2_Host_HASH:
             return ResourceType::AWS_EC2_Host;
-          }
-          else if (hashCode == AWS_EC2_Instance_HASH)
-          {
+          case AWS_EC2_Instance_HASH:
             return ResourceType::AWS_EC2_Instance;
-          }
-          else if (hashCode == AWS_EC2_InternetGateway_HASH)
-          {
+          case AWS_EC2_InternetGateway_HASH:
             return ResourceType::AWS_EC2_InternetGateway;
-          }
-          else if (hashCode == AWS_EC2_NetworkAcl_HASH)
-          {
+          case AWS_EC2_NetworkAcl_HASH:
             return ResourceType::AWS_EC2_NetworkAcl;
-          }
-          else if (hashCode == AWS_EC2_NetworkInterface_HASH)
-          {
+          case AWS_EC2_NetworkInterface_HASH:
             return ResourceType::AWS_EC2_NetworkInterface;
-          }
-          else if (hashCode == AWS_EC2_RouteTable_HASH)
-          {
+          case AWS_EC2_RouteTable_HASH:
             return ResourceType::AWS_EC2_RouteTable;
-          }
-          else if (hashCode == AWS_EC2_SecurityGroup_HASH)
-          {
+          case AWS_EC2_SecurityGroup_HASH:
             return ResourceType::AWS_EC2_SecurityGroup;
-          }
-          else if (hashCode == AWS_EC2_Subnet_HASH)
-          {
+          case AWS_EC2_Subnet_HASH:
             return ResourceType::AWS_EC2_Subnet;
-          }
-          else if (hashCode == AWS_CloudTrail_Trail_HASH)
-          {
+          case AWS_CloudTrail_Trail_HASH:
             return ResourceType::AWS_CloudTrail_Trail;
-          }
-          else if (hashCode == AWS_EC2_Volume_HASH)
-          {
+          case AWS_EC2_Volume_HASH:
             return ResourceType::AWS_EC2_Volume;
-          }
-          else if (hashCode == AWS_EC2_VPC_HASH)
-          {
+          case AWS_EC2_VPC_HASH:
             return ResourceType::AWS_EC2_VPC;
-          }
-          else if (hashCode == AWS_EC2_VPNConnection_HASH)
-          {
+          case AWS_EC2_VPNConnection_HASH:
             return ResourceType::AWS_EC2_VPNConnection;
-          }
-          else if (hashCode == AWS_EC2_VPNGateway_HASH)
-          {
+          case AWS_EC2_VPNGateway_HASH:
             return ResourceType::AWS_EC2_VPNGateway;
-          }
-          else if (hashCode == AWS_IAM_Group_HASH)
-          {
+          case AWS_IAM_Group_HASH:
             return ResourceType::AWS_IAM_Group;
-          }
-          else if (hashCode == AWS_IAM_Policy_HASH)
-          {
+          case AWS_IAM_Policy_HASH:
             return ResourceType::AWS_IAM_Policy;
-          }
-          else if (hashCode == AWS_IAM_Role_HASH)
-          {
+          case AWS_IAM_Role_HASH:
             return ResourceType::AWS_IAM_Role;
-          }
-          else if (hashCode == AWS_IAM_User_HASH)
-          {
+          case AWS_IAM_User_HASH:
             return ResourceType::AWS_IAM_User;
-          }
-          else if (hashCode == AWS_ACM_Certificate_HASH)
-          {
+          case AWS_ACM_Certificate_HASH:
             return ResourceType::AWS_ACM_Certificate;
-          }
-          else if (hashCode == AWS_RDS_DBInstance_HASH)
-          {
+          case AWS_RDS_DBInstance_HASH:
             return ResourceType::AWS_RDS_DBInstance;
-          }
-          else if (hashCode == AWS_RDS_DBSubnetGroup_HASH)
-          {
+          case AWS_RDS_DBSubnetGroup_HASH:
             return ResourceType::AWS_RDS_DBSubnetGroup;
-          }
-          else if (hashCode == AWS_RDS_DBSecurityGroup_HASH)
-          {
+          case AWS_RDS_DBSecurityGroup_HASH:
             return ResourceType::AWS_RDS_DBSecurityGroup;
-          }
-          else if (hashCode == AWS_RDS_DBSnapshot_HASH)
-          {
+          case AWS_RDS_DBSnapshot_HASH:
             return ResourceType::AWS_RDS_DBSnapshot;
-          }
-          else if (hashCode == AWS_RDS_EventSubscription_HASH)
-          {
+          case AWS_RDS_EventSubscription_HASH:
             return ResourceType::AWS_RDS_EventSubscription;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
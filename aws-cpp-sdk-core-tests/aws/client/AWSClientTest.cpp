@@ -45,6 +45,12 @@ public:
         BuildHttpRequest(request, httpRequest);
     }
 
+    void InvokeBuildHttpRequest(const AmazonWebServiceRequest& request, const std::shared_ptr<Aws::IOStream>& body,
+        const HeaderValueCollection& headers, const std::shared_ptr<HttpRequest>& httpRequest) const
+    {
+        BuildHttpRequest(request, body, headers, httpRequest);
+    }
+
 protected:
     //we don't actually need this for anything, it's just here so we can compile.
     AWSError<CoreErrors> BuildAWSError(const std::shared_ptr<Aws::Http::HttpResponse>& response) const override
@@ -57,18 +63,20 @@ protected:
 class AmazonWebServiceRequestMock : public AmazonWebServiceRequest
 {
 public:
-    AmazonWebServiceRequestMock() : m_shouldComputeMd5(false) { }
-    std::shared_ptr<Aws::IOStream> GetBody() const override { return m_body; }
+    AmazonWebServiceRequestMock() : m_shouldComputeMd5(false), m_getBodyCount(0) { }
+    std::shared_ptr<Aws::IOStream> GetBody() const override { ++m_getBodyCount; return m_body; }
     void SetBody(const std::shared_ptr<Aws::IOStream>& body) { m_body = body; }
     HeaderValueCollection GetHeaders() const override { return m_headers; }
     void SetHeaders(const HeaderValueCollection& value) { m_headers = value; }
     bool ShouldComputeContentMd5() const override { return m_shouldComputeMd5; }
     void SetComputeContentMd5(bool value) { m_shouldComputeMd5 = value; }
+    size_t GetBodyCallCount() const { return m_getBodyCount; }
 
 private:
     std::shared_ptr<Aws::IOStream> m_body;
     HeaderValueCollection m_headers;
     bool m_shouldComputeMd5;
+    mutable size_t m_getBodyCount;
 };
 
 TEST(AWSClientTest, TestBuildHttpRequestWithHeadersOnly)
@@ -170,3 +178,37 @@ TEST(AWSClientTest, TestBuildHttpRequestWithHeadersAndBody)
 
     AWS_END_MEMORY_TEST
 }
+
+TEST(AWSClientTest, TestBuildHttpRequestWithPreparedPayload)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    AmazonWebServiceRequestMock amazonWebServiceRequest;
+
+    std::shared_ptr<Aws::StringStream> ss = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *ss << "test";
+
+    HeaderValueCollection preparedHeaders;
+    preparedHeaders["test1"] = "testValue1";
+    preparedHeaders[Http::X_AMZ_CONTENT_SHA256_HEADER] = "precomputed";
+
+    URI uri("http://www.uri.com");
+    AccessViolatingAWSClient awsClient;
+
+    //every attempt built from the prepared payload shares the same body and never re-serializes the request.
+    for (unsigned attempt = 0; attempt < 3; ++attempt)
+    {
+        std::shared_ptr<Standard::StandardHttpRequest> httpRequest =
+            Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, uri, HttpMethod::HTTP_POST);
+        awsClient.InvokeBuildHttpRequest(amazonWebServiceRequest, ss, preparedHeaders, httpRequest);
+
+        ASSERT_EQ(ss, httpRequest->GetContentBody());
+        ASSERT_EQ("testValue1", httpRequest->GetHeaderValue("test1"));
+        ASSERT_EQ("precomputed", httpRequest->GetHeaderValue(Http::X_AMZ_CONTENT_SHA256_HEADER));
+        ASSERT_EQ("4", httpRequest->GetHeaderValue(Http::CONTENT_LENGTH_HEADER));
+    }
+
+    ASSERT_EQ(0u, amazonWebServiceRequest.GetBodyCallCount());
+
+    AWS_END_MEMORY_TEST
+}
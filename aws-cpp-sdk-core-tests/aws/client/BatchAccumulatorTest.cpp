@@ -0,0 +1,288 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/RetryStrategy.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Client;
+
+namespace
+{
+    struct BatchRequest
+    {
+        Aws::String queue;
+    };
+
+    typedef BatchAccumulator<BatchRequest, Aws::String> StringAccumulator;
+
+    // records every call; entries starting with "retry" fail retryably, entries starting with "bad" fail for good
+    class RecordingBatchApi
+    {
+    public:
+        void Send(const BatchRequest& request, Aws::Vector<Aws::String>&& batch, Aws::Vector<BatchEntryFailure<Aws::String>>& failures)
+        {
+            std::lock_guard<std::mutex> locker(m_mutex);
+            m_queues.push_back(request.queue);
+            m_batches.push_back(batch);
+            for (size_t i = 0; i < batch.size(); ++i)
+            {
+                if (batch[i].find("retry") == 0)
+                {
+                    failures.emplace_back(i, std::move(batch[i]), "throttled", true);
+                }
+                else if (batch[i].find("bad") == 0)
+                {
+                    failures.emplace_back(i, std::move(batch[i]), "invalid", false);
+                }
+            }
+        }
+
+        StringAccumulator::SendBatchFunction Function()
+        {
+            return [this](const BatchRequest& request, Aws::Vector<Aws::String>&& batch, Aws::Vector<BatchEntryFailure<Aws::String>>& failures)
+            {
+                Send(request, std::move(batch), failures);
+            };
+        }
+
+        Aws::Vector<Aws::Vector<Aws::String>> GetBatches()
+        {
+            std::lock_guard<std::mutex> locker(m_mutex);
+            return m_batches;
+        }
+
+        Aws::Vector<Aws::String> m_queues;
+
+    private:
+        std::mutex m_mutex;
+        Aws::Vector<Aws::Vector<Aws::String>> m_batches;
+    };
+
+    size_t StringSize(const Aws::String& entry)
+    {
+        return entry.size();
+    }
+
+    // the same delay before every retry, or none
+    class FixedDelayRetryStrategy : public RetryStrategy
+    {
+    public:
+        FixedDelayRetryStrategy(long delay) : m_delay(delay) {}
+
+        bool ShouldRetry(const AWSError<CoreErrors>&, long) const override { return true; }
+        long CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>&, long) const override { return m_delay; }
+
+    private:
+        long m_delay;
+    };
+
+    BatchAccumulatorConfiguration SlowLinger()
+    {
+        BatchAccumulatorConfiguration config;
+        config.lingerTime = std::chrono::milliseconds(60000);
+        return config;
+    }
+
+    template<typename Predicate>
+    bool WaitFor(Predicate predicate)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!predicate() && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return predicate();
+    }
+}
+
+TEST(BatchAccumulatorTest, FullBatchesAreSentWithoutWaitingForTheLinger)
+{
+    RecordingBatchApi api;
+    BatchRequest request;
+    request.queue = "orders";
+    StringAccumulator accumulator(request, 3, 0, SlowLinger(), StringSize, api.Function());
+
+    for (int i = 0; i < 7; ++i)
+    {
+        accumulator.Add("entry");
+    }
+    ASSERT_TRUE(WaitFor([&]() { return api.GetBatches().size() == 2; }));
+
+    accumulator.Flush();
+    auto batches = api.GetBatches();
+    ASSERT_EQ(3u, batches.size());
+    ASSERT_EQ(3u, batches[0].size());
+    ASSERT_EQ(3u, batches[1].size());
+    ASSERT_EQ(1u, batches[2].size());
+    ASSERT_EQ(Aws::Vector<Aws::String>({"orders", "orders", "orders"}), api.m_queues);
+    ASSERT_EQ(7u, accumulator.GetStats().entriesSent);
+}
+
+TEST(BatchAccumulatorTest, BatchesStayWithinTheByteLimit)
+{
+    RecordingBatchApi api;
+    BatchAccumulatorConfiguration config = SlowLinger();
+    // above the service limit, so the service limit applies
+    config.maxBytesPerBatch = 1000;
+    StringAccumulator accumulator(BatchRequest(), 10, 10, config, StringSize, api.Function());
+
+    accumulator.Add("aaaa");
+    accumulator.Add("bbbb");
+    accumulator.Add("cccc");
+    accumulator.Add("an entry over the limit");
+    accumulator.Flush();
+
+    auto batches = api.GetBatches();
+    ASSERT_EQ(3u, batches.size());
+    ASSERT_EQ(Aws::Vector<Aws::String>({"aaaa", "bbbb"}), batches[0]);
+    ASSERT_EQ(Aws::Vector<Aws::String>({"cccc"}), batches[1]);
+    ASSERT_EQ(Aws::Vector<Aws::String>({"an entry over the limit"}), batches[2]);
+}
+
+TEST(BatchAccumulatorTest, PartialBatchIsSentAfterTheLinger)
+{
+    RecordingBatchApi api;
+    BatchAccumulatorConfiguration config;
+    config.lingerTime = std::chrono::milliseconds(20);
+    StringAccumulator accumulator(BatchRequest(), 10, 0, config, StringSize, api.Function());
+
+    accumulator.Add("lonely");
+    ASSERT_TRUE(WaitFor([&]() { return api.GetBatches().size() == 1; }));
+    ASSERT_EQ(Aws::Vector<Aws::String>({"lonely"}), api.GetBatches()[0]);
+}
+
+TEST(BatchAccumulatorTest, RetryableFailuresAreRequeuedUntilOutOfAttempts)
+{
+    RecordingBatchApi api;
+    BatchAccumulatorConfiguration config = SlowLinger();
+    config.maxAttempts = 3;
+    StringAccumulator accumulator(BatchRequest(), 10, 0, config, StringSize, api.Function());
+
+    Aws::Vector<Aws::String> failed;
+    accumulator.SetFailedEntryHandler([&](const Aws::String& entry, const Aws::String& error) { failed.push_back(entry + ":" + error); });
+
+    accumulator.Add("ok");
+    accumulator.Add("retry");
+    accumulator.Add("bad");
+    accumulator.Flush();
+
+    auto batches = api.GetBatches();
+    ASSERT_EQ(3u, batches.size());
+    ASSERT_EQ(Aws::Vector<Aws::String>({"ok", "retry", "bad"}), batches[0]);
+    ASSERT_EQ(Aws::Vector<Aws::String>({"retry"}), batches[1]);
+    ASSERT_EQ(Aws::Vector<Aws::String>({"retry"}), batches[2]);
+    ASSERT_EQ(Aws::Vector<Aws::String>({"bad:invalid", "retry:throttled"}), failed);
+
+    auto stats = accumulator.GetStats();
+    ASSERT_EQ(3u, stats.batchesSent);
+    ASSERT_EQ(1u, stats.entriesSent);
+    ASSERT_EQ(2u, stats.entriesRetried);
+    ASSERT_EQ(2u, stats.entriesFailed);
+}
+
+TEST(BatchAccumulatorTest, AttemptsAreCountedPerEntry)
+{
+    BatchAccumulatorConfiguration config = SlowLinger();
+    config.maxAttempts = 3;
+    Aws::Vector<Aws::Vector<Aws::String>> batches;
+    StringAccumulator* target = nullptr;
+
+    // "retry" always fails; "fresh" joins the queue during the second call and fails only on its first attempt,
+    // so it shares the third call with "retry"'s last attempt
+    auto send = [&](const BatchRequest&, Aws::Vector<Aws::String>&& batch, Aws::Vector<BatchEntryFailure<Aws::String>>& failures)
+    {
+        batches.push_back(batch);
+        if (batches.size() == 2)
+        {
+            target->Add("fresh");
+        }
+        for (size_t i = 0; i < batch.size(); ++i)
+        {
+            if (batch[i] == "retry" || (batch[i] == "fresh" && batches.size() == 3))
+            {
+                failures.emplace_back(i, std::move(batch[i]), "throttled", true);
+            }
+        }
+    };
+
+    StringAccumulator accumulator(BatchRequest(), 10, 0, config, StringSize, send, Aws::MakeShared<FixedDelayRetryStrategy>("BatchAccumulatorTest", 0));
+    target = &accumulator;
+    Aws::Vector<Aws::String> failed;
+    accumulator.SetFailedEntryHandler([&](const Aws::String& entry, const Aws::String&) { failed.push_back(entry); });
+
+    accumulator.Add("retry");
+    accumulator.Flush();
+
+    ASSERT_EQ(4u, batches.size());
+    ASSERT_EQ(Aws::Vector<Aws::String>({"retry", "fresh"}), batches[2]);
+    ASSERT_EQ(Aws::Vector<Aws::String>({"fresh"}), batches[3]);
+    ASSERT_EQ(Aws::Vector<Aws::String>({"retry"}), failed);
+    ASSERT_EQ(1u, accumulator.GetStats().entriesSent);
+}
+
+TEST(BatchAccumulatorTest, RetriesWaitOutTheRetryStrategysDelay)
+{
+    BatchAccumulatorConfiguration config = SlowLinger();
+    config.maxAttempts = 2;
+    Aws::Vector<Aws::Vector<Aws::String>> batches;
+    Aws::Vector<std::chrono::steady_clock::time_point> sentAt;
+    StringAccumulator* target = nullptr;
+
+    // "retry" fails once; "fresh" is added right after, while "retry" is backing off, and must not wait behind it
+    auto send = [&](const BatchRequest&, Aws::Vector<Aws::String>&& batch, Aws::Vector<BatchEntryFailure<Aws::String>>& failures)
+    {
+        batches.push_back(batch);
+        sentAt.push_back(std::chrono::steady_clock::now());
+        if (batches.size() == 1)
+        {
+            failures.emplace_back(0, std::move(batch[0]), "throttled", true);
+            target->Add("fresh");
+        }
+    };
+
+    StringAccumulator accumulator(BatchRequest(), 10, 0, config, StringSize, send, Aws::MakeShared<FixedDelayRetryStrategy>("BatchAccumulatorTest", 200));
+    target = &accumulator;
+    accumulator.Add("retry");
+    accumulator.Flush();
+
+    ASSERT_EQ(3u, batches.size());
+    ASSERT_EQ(Aws::Vector<Aws::String>({"fresh"}), batches[1]);
+    ASSERT_EQ(Aws::Vector<Aws::String>({"retry"}), batches[2]);
+    // equal jitter keeps at least half of the strategy's delay
+    ASSERT_GE(sentAt[2] - sentAt[0], std::chrono::milliseconds(100));
+    ASSERT_EQ(1u, accumulator.GetStats().entriesRetried);
+    ASSERT_EQ(2u, accumulator.GetStats().entriesSent);
+}
+
+TEST(BatchAccumulatorTest, DestructionSendsQueuedEntries)
+{
+    RecordingBatchApi api;
+    {
+        StringAccumulator accumulator(BatchRequest(), 10, 0, SlowLinger(), StringSize, api.Function());
+        accumulator.Add("first");
+        accumulator.Add("second");
+    }
+
+    auto batches = api.GetBatches();
+    ASSERT_EQ(1u, batches.size());
+    ASSERT_EQ(Aws::Vector<Aws::String>({"first", "second"}), batches[0]);
+}
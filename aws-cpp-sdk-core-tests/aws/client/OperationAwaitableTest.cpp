@@ -0,0 +1,103 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/client/OperationAwaitable.h>
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+
+#include <aws/core/utils/threading/Executor.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace Aws::Client;
+using namespace Aws::Utils::Threading;
+
+namespace
+{
+    // starts eagerly and destroys itself when done; the tests observe it through the captured state
+    struct DetachedCoroutine
+    {
+        struct promise_type
+        {
+            DetachedCoroutine get_return_object() { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception() { std::terminate(); }
+        };
+    };
+
+    struct AwaitResult
+    {
+        AwaitResult() : value(0), done(false) {}
+
+        int value;
+        std::thread::id operationThread;
+        std::thread::id resumedThread;
+        std::atomic<bool> done;
+    };
+
+    DetachedCoroutine AwaitOperation(Executor* executor, AwaitResult& result)
+    {
+        result.value = co_await MakeOperationAwaitable(executor, [&result]()
+        {
+            result.operationThread = std::this_thread::get_id();
+            return 42;
+        });
+        result.resumedThread = std::this_thread::get_id();
+        result.done = true;
+    }
+
+    class RejectingExecutor : public Executor
+    {
+    protected:
+        bool SubmitToThread(std::function<void()>&&) override { return false; }
+    };
+}
+
+TEST(OperationAwaitableTest, ResumesOnTheThreadThatRanTheOperation)
+{
+    PooledThreadExecutor executor(1);
+    AwaitResult result;
+    AwaitOperation(&executor, result);
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (!result.done && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::yield();
+    }
+
+    ASSERT_TRUE(result.done);
+    ASSERT_EQ(42, result.value);
+    ASSERT_NE(std::this_thread::get_id(), result.operationThread);
+    ASSERT_EQ(result.operationThread, result.resumedThread);
+}
+
+TEST(OperationAwaitableTest, RunsInlineWhenTheExecutorRejects)
+{
+    RejectingExecutor executor;
+    AwaitResult result;
+    AwaitOperation(&executor, result);
+
+    ASSERT_TRUE(result.done);
+    ASSERT_EQ(42, result.value);
+    ASSERT_EQ(std::this_thread::get_id(), result.operationThread);
+    ASSERT_EQ(std::this_thread::get_id(), result.resumedThread);
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
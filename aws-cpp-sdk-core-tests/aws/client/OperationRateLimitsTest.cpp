@@ -0,0 +1,102 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/client/OperationRateLimits.h>
+#include <aws/core/AmazonWebServiceRequest.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+using namespace Aws::Client;
+using namespace Aws::Utils::Json;
+using namespace Aws::Utils::RateLimits;
+
+static const char* ALLOCATION_TAG = "OperationRateLimitsTest";
+
+namespace
+{
+    class RecordingRateLimiter : public RateLimiterInterface
+    {
+    public:
+        DelayType ApplyCost(int64_t cost) override { m_applied.push_back(cost); return DelayType(0); }
+        void ApplyAndPayForCost(int64_t cost) override { m_paid.push_back(cost); }
+        void SetRate(int64_t, bool) override {}
+
+        Aws::Vector<int64_t> m_applied;
+        Aws::Vector<int64_t> m_paid;
+    };
+
+    class NamedRequest : public Aws::AmazonWebServiceRequest
+    {
+    public:
+        NamedRequest(const char* name, const char* table = "") : m_name(name), m_table(table) {}
+
+        std::shared_ptr<Aws::IOStream> GetBody() const override { return nullptr; }
+        Aws::Http::HeaderValueCollection GetHeaders() const override { return Aws::Http::HeaderValueCollection(); }
+        const char* GetServiceRequestName() const override { return m_name; }
+
+        const char* m_name;
+        Aws::String m_table;
+    };
+}
+
+TEST(OperationRateLimitsTest, RequestCostsAreChargedToMatchingLimits)
+{
+    auto getItem = Aws::MakeShared<RecordingRateLimiter>(ALLOCATION_TAG);
+    auto everything = Aws::MakeShared<RecordingRateLimiter>(ALLOCATION_TAG);
+    auto ordersTable = Aws::MakeShared<RecordingRateLimiter>(ALLOCATION_TAG);
+
+    OperationRateLimits limits;
+    limits.AddLimit("GetItem", getItem);
+    limits.AddLimit(OperationRateLimits::ALL_OPERATIONS, everything, OperationRateLimits::CostPerRequest(3));
+    limits.AddLimit("GetItem", ordersTable, [](const Aws::AmazonWebServiceRequest& request) -> int64_t
+    {
+        return static_cast<const NamedRequest&>(request).m_table == "orders" ? 1 : -1;
+    });
+    ASSERT_FALSE(limits.HasResponseCosts());
+
+    limits.ChargeRequest(NamedRequest("GetItem", "orders"));
+    limits.ChargeRequest(NamedRequest("GetItem", "users"));
+    limits.ChargeRequest(NamedRequest("PutItem"));
+
+    ASSERT_EQ(2u, getItem->m_paid.size());
+    ASSERT_EQ(3u, everything->m_paid.size());
+    ASSERT_EQ(3, everything->m_paid[2]);
+    ASSERT_EQ(1u, ordersTable->m_paid.size());
+    ASSERT_TRUE(getItem->m_applied.empty());
+}
+
+TEST(OperationRateLimitsTest, ConsumedCapacityIsChargedAfterTheResponse)
+{
+    auto readCapacity = Aws::MakeShared<RecordingRateLimiter>(ALLOCATION_TAG);
+
+    OperationRateLimits limits;
+    limits.AddLimit(OperationRateLimits::ALL_OPERATIONS, readCapacity, nullptr, OperationRateLimits::ConsumedCapacityUnits(2));
+    ASSERT_TRUE(limits.HasResponseCosts());
+
+    NamedRequest getItem("GetItem");
+    limits.ChargeRequest(getItem);
+    ASSERT_EQ(1u, readCapacity->m_paid.size());
+    ASSERT_EQ(0, readCapacity->m_paid[0]);
+
+    limits.ChargeResponse(getItem, JsonValue(Aws::String("{\"Item\":{},\"ConsumedCapacity\":{\"TableName\":\"t\",\"CapacityUnits\":1.5}}")));
+    limits.ChargeResponse(getItem, JsonValue(Aws::String("{\"ConsumedCapacity\":[{\"CapacityUnits\":0.5},{\"CapacityUnits\":2.25}]}")));
+    limits.ChargeResponse(getItem, JsonValue(Aws::String("{\"Item\":{}}")));
+
+    ASSERT_EQ(2u, readCapacity->m_applied.size());
+    ASSERT_EQ(3, readCapacity->m_applied[0]);
+    ASSERT_EQ(6, readCapacity->m_applied[1]);
+}
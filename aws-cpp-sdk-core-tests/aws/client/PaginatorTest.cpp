@@ -0,0 +1,193 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/client/Paginator.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/PriorityExecutor.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+using namespace Aws::Client;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Threading;
+
+namespace
+{
+    struct PageRequest
+    {
+        Aws::String token;
+    };
+
+    struct PageResult
+    {
+        int page;
+        Aws::String nextToken;
+    };
+
+    typedef Outcome<PageResult, int> PageOutcome;
+
+    // serves pages 0 to pageCount - 1; the token of page n is "n"
+    class PagedClient
+    {
+    public:
+        PagedClient(int pageCount, int failingPage = -1) : m_pageCount(pageCount), m_failingPage(failingPage), m_calls(0) {}
+
+        PageOutcome ListPages(const PageRequest& request) const
+        {
+            ++m_calls;
+            int page = request.token.empty() ? 0 : StringUtils::ConvertToInt32(request.token.c_str());
+            if (page == m_failingPage)
+            {
+                return PageOutcome(page);
+            }
+
+            PageResult result;
+            result.page = page;
+            result.nextToken = page + 1 < m_pageCount ? StringUtils::to_string(page + 1) : "";
+            return PageOutcome(result);
+        }
+
+        int GetCalls() const { return m_calls.load(); }
+
+    private:
+        int m_pageCount;
+        int m_failingPage;
+        mutable std::atomic<int> m_calls;
+    };
+
+    typedef Paginator<PagedClient, PageRequest, PageOutcome> PagePaginator;
+
+    bool NextPage(const PageRequest&, const PageOutcome& outcome, PageRequest& next)
+    {
+        if (outcome.GetResult().nextToken.empty())
+        {
+            return false;
+        }
+        next.token = outcome.GetResult().nextToken;
+        return true;
+    }
+}
+
+TEST(PaginatorTest, VisitsEveryPageInOrder)
+{
+    PooledThreadExecutor executor(2);
+    for (size_t prefetchDepth = 0; prefetchDepth < 4; ++prefetchDepth)
+    {
+        PagedClient client(5);
+        PagePaginator paginator(&client, &PagedClient::ListPages, PageRequest(), NextPage, &executor, prefetchDepth);
+
+        Aws::Vector<int> pages;
+        for (auto& outcome : paginator)
+        {
+            ASSERT_TRUE(outcome.IsSuccess());
+            pages.push_back(outcome.GetResult().page);
+        }
+
+        ASSERT_EQ(Aws::Vector<int>({0, 1, 2, 3, 4}), pages);
+        ASSERT_FALSE(paginator.HasMorePages());
+        ASSERT_EQ(5, client.GetCalls());
+    }
+}
+
+TEST(PaginatorTest, PrefetchesUpToTheConfiguredDepth)
+{
+    PooledThreadExecutor executor(2);
+    PagedClient client(10);
+    PagePaginator paginator(&client, &PagedClient::ListPages, PageRequest(), NextPage, &executor, 2);
+
+    ASSERT_EQ(0, paginator.GetNextPage().GetResult().page);
+
+    // the two pages after the one being consumed are fetched in the background, and no more
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (client.GetCalls() < 3 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(3, client.GetCalls());
+
+    ASSERT_EQ(1, paginator.GetNextPage().GetResult().page);
+    ASSERT_EQ(2, paginator.GetNextPage().GetResult().page);
+}
+
+TEST(PaginatorTest, FailedPageEndsThePagination)
+{
+    PooledThreadExecutor executor(1);
+    PagedClient client(5, 2);
+    PagePaginator paginator(&client, &PagedClient::ListPages, PageRequest(), NextPage, &executor, 1);
+
+    ASSERT_TRUE(paginator.GetNextPage().IsSuccess());
+    ASSERT_TRUE(paginator.GetNextPage().IsSuccess());
+    auto failed = paginator.GetNextPage();
+    ASSERT_FALSE(failed.IsSuccess());
+    ASSERT_EQ(2, failed.GetError());
+    ASSERT_FALSE(paginator.HasMorePages());
+    ASSERT_EQ(3, client.GetCalls());
+}
+
+TEST(PaginatorTest, CanBeDrivenFromTheExecutorsOnlyThread)
+{
+    PooledThreadExecutor executor(1);
+    PagedClient client(5);
+
+    // the prefetches queue behind this task on the single thread, so waiting for them would never return
+    std::future<size_t> pageCount = executor.SubmitCallable([&client, &executor]()
+    {
+        PagePaginator paginator(&client, &PagedClient::ListPages, PageRequest(), NextPage, &executor, 1);
+        size_t pages = 0;
+        for (auto& outcome : paginator)
+        {
+            pages += outcome.IsSuccess() ? 1 : 0;
+        }
+        return pages;
+    });
+
+    ASSERT_EQ(std::future_status::ready, pageCount.wait_for(std::chrono::seconds(10)));
+    ASSERT_EQ(5u, pageCount.get());
+    ASSERT_EQ(5, client.GetCalls());
+}
+
+TEST(PaginatorTest, WorksWithExecutorsThatRunTasksOnTheCaller)
+{
+    PriorityExecutor executor(1, 1, BackpressurePolicy::CallerRuns);
+    std::promise<void> entered;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    ASSERT_TRUE(executor.Submit([&entered, released]() { entered.set_value(); released.wait(); }));
+    entered.get_future().wait();
+    // the worker is busy and the queue is full, so every prefetch runs on the thread submitting it
+    ASSERT_TRUE(executor.Submit([]() {}));
+
+    PagedClient client(5);
+    Aws::Vector<int> pages;
+    {
+        PagePaginator paginator(&client, &PagedClient::ListPages, PageRequest(), NextPage, &executor, 2);
+        for (auto& outcome : paginator)
+        {
+            pages.push_back(outcome.IsSuccess() ? outcome.GetResult().page : -1);
+        }
+    }
+    release.set_value();
+
+    ASSERT_EQ(Aws::Vector<int>({0, 1, 2, 3, 4}), pages);
+    ASSERT_EQ(5, client.GetCalls());
+}
@@ -0,0 +1,418 @@
+/*
+* Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/external/gtest.h>
+#include <aws/core/AmazonSerializableWebServiceRequest.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/client/AWSClient.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/AWSErrorMarshaller.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/client/PreparedRequest.h>
+#include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/memory/MemoryArena.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/stream/SpillingResponseStream.h>
+
+using namespace Aws::Auth;
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Utils::Json;
+
+static const char* PREPARED_TEST_TAG = "PreparedRequestTest";
+static const char* TEST_ENDPOINT = "https://dynamodb.us-east-1.amazonaws.com/";
+
+namespace
+{
+
+struct SentRequest
+{
+    HeaderValueCollection headers;
+    Aws::String body;
+};
+
+class RecordingHttpClient : public HttpClient
+{
+public:
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
+    {
+        AWS_UNREFERENCED_PARAM(readLimiter);
+        AWS_UNREFERENCED_PARAM(writeLimiter);
+
+        SentRequest sent;
+        sent.headers = request.GetHeaders();
+        if (request.GetContentBody())
+        {
+            Aws::StringStream ss;
+            ss << request.GetContentBody()->rdbuf();
+            sent.body = ss.str();
+        }
+        m_sent.push_back(sent);
+
+        auto response = Aws::MakeShared<Standard::StandardHttpResponse>(PREPARED_TEST_TAG, request);
+        if (m_sent.size() <= m_failuresBeforeSuccess)
+        {
+            response->SetResponseCode(HttpResponseCode::BAD_REQUEST);
+            response->GetResponseBody() << "{\"__type\":\"ThrottlingException\",\"message\":\"Rate exceeded\"}";
+        }
+        else
+        {
+            response->SetResponseCode(HttpResponseCode::OK);
+            response->GetResponseBody() << "{\"Item\":{\"id\":{\"S\":\"a\"}}}";
+        }
+        return response;
+    }
+
+    const Aws::Vector<SentRequest>& GetSent() const { return m_sent; }
+    void SetFailuresBeforeSuccess(size_t failures) { m_failuresBeforeSuccess = failures; }
+
+private:
+    mutable Aws::Vector<SentRequest> m_sent;
+    size_t m_failuresBeforeSuccess = 0;
+};
+
+class RecordingHttpClientFactory : public HttpClientFactory
+{
+public:
+    RecordingHttpClientFactory(const std::shared_ptr<RecordingHttpClient>& client) : m_client(client) {}
+
+    std::shared_ptr<HttpClient> CreateHttpClient(const ClientConfiguration& clientConfiguration) const override
+    {
+        AWS_UNREFERENCED_PARAM(clientConfiguration);
+        return m_client;
+    }
+
+    std::shared_ptr<HttpRequest> CreateHttpRequest(const Aws::String& uri, HttpMethod method, const Aws::IOStreamFactory& streamFactory) const override
+    {
+        return CreateHttpRequest(URI(uri), method, streamFactory);
+    }
+
+    std::shared_ptr<HttpRequest> CreateHttpRequest(const URI& uri, HttpMethod method, const Aws::IOStreamFactory& streamFactory) const override
+    {
+        auto request = Aws::MakeShared<Standard::StandardHttpRequest>(PREPARED_TEST_TAG, uri, method);
+        request->SetResponseStreamFactory(streamFactory);
+        return request;
+    }
+
+private:
+    std::shared_ptr<RecordingHttpClient> m_client;
+};
+
+/*
+ * Stands in for the v4 signer, which needs a crypto backend: records the canonical prefix it was handed and, like the v4
+ * signer, only computes a payload hash when the caller did not pass one in.
+ */
+class RecordingSigner : public AWSAuthSigner
+{
+public:
+    RecordingSigner() : m_payloadHashes(0) {}
+
+    bool SignRequest(HttpRequest& request) const override
+    {
+        Aws::String payloadHash;
+        return SignRequest(request, payloadHash);
+    }
+
+    bool SignRequest(HttpRequest& request, Aws::String& payloadHash) const override
+    {
+        return SignPreparedRequest(request, PrepareCanonicalRequest(request), payloadHash);
+    }
+
+    bool PresignRequest(HttpRequest& request, long long expirationInSeconds) const override
+    {
+        AWS_UNREFERENCED_PARAM(request);
+        AWS_UNREFERENCED_PARAM(expirationInSeconds);
+        return false;
+    }
+
+    Aws::String PrepareCanonicalRequest(HttpRequest& request) const override
+    {
+        return "POST " + request.GetUri().GetPath();
+    }
+
+    bool SignPreparedRequest(HttpRequest& request, const Aws::String& canonicalRequestPrefix) const override
+    {
+        Aws::String payloadHash;
+        return SignPreparedRequest(request, canonicalRequestPrefix, payloadHash);
+    }
+
+    bool SignPreparedRequest(HttpRequest& request, const Aws::String& canonicalRequestPrefix, Aws::String& payloadHash) const override
+    {
+        if (payloadHash.empty())
+        {
+            payloadHash = "hash" + Aws::Utils::StringUtils::to_string(++m_payloadHashes);
+        }
+        request.SetHeaderValue(X_AMZ_CONTENT_SHA256_HEADER, payloadHash);
+        request.SetHeaderValue("x-test-canonical-prefix", canonicalRequestPrefix);
+        return true;
+    }
+
+private:
+    mutable size_t m_payloadHashes;
+};
+
+class GetItemStyleRequest : public Aws::AmazonSerializableWebServiceRequest
+{
+public:
+    Aws::String SerializePayload() const override { return m_payload.WriteCompact(); }
+
+    HeaderValueCollection GetHeaders() const override
+    {
+        HeaderValueCollection headers;
+        headers.insert(HeaderValuePair("X-Amz-Target", "DynamoDB_20120810.GetItem"));
+        headers.insert(HeaderValuePair(CONTENT_TYPE_HEADER, Aws::AMZN_JSON_CONTENT_TYPE_1_0));
+        if (!m_contentSha256.empty())
+        {
+            headers.insert(HeaderValuePair(X_AMZ_CONTENT_SHA256_HEADER, m_contentSha256));
+        }
+        return headers;
+    }
+
+    JsonValue& GetPayload() { return m_payload; }
+    void SetContentSha256(const Aws::String& contentSha256) { m_contentSha256 = contentSha256; }
+
+private:
+    JsonValue m_payload;
+    Aws::String m_contentSha256;
+};
+
+class PreparingJsonClient : public AWSJsonClient
+{
+public:
+    PreparingJsonClient(const ClientConfiguration& configuration) :
+        AWSJsonClient(configuration, Aws::MakeShared<RecordingSigner>(PREPARED_TEST_TAG),
+            Aws::MakeShared<AWSErrorMarshaller>(PREPARED_TEST_TAG))
+    {
+    }
+
+    PreparedRequest Prepare(const GetItemStyleRequest& requestTemplate) const
+    {
+        return PrepareJsonRequest(TEST_ENDPOINT, Aws::MakeShared<GetItemStyleRequest>(PREPARED_TEST_TAG, requestTemplate), "Key");
+    }
+
+    bool Invoke(const PreparedRequest& preparedRequest, const JsonValue& key) const
+    {
+        return MakeRequest(preparedRequest, key).IsSuccess();
+    }
+
+    bool Invoke(const GetItemStyleRequest& request) const
+    {
+        return MakeRequest(TEST_ENDPOINT, request).IsSuccess();
+    }
+
+    Aws::String GetItemId(const GetItemStyleRequest& request) const
+    {
+        JsonOutcome outcome = MakeRequest(TEST_ENDPOINT, request);
+        return outcome.IsSuccess() ? outcome.GetResult().GetPayload().GetObject("Item").GetObject("id").GetString("S") : "";
+    }
+
+    Aws::String GetItemId(const PreparedRequest& preparedRequest, const JsonValue& key) const
+    {
+        JsonOutcome outcome = MakeRequest(preparedRequest, key);
+        return outcome.IsSuccess() ? outcome.GetResult().GetPayload().GetObject("Item").GetObject("id").GetString("S") : "";
+    }
+};
+
+class PreparedRequestTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_httpClient = Aws::MakeShared<RecordingHttpClient>(PREPARED_TEST_TAG);
+        SetHttpClientFactory(Aws::MakeShared<RecordingHttpClientFactory>(PREPARED_TEST_TAG, m_httpClient));
+    }
+
+    void TearDown() override
+    {
+        m_httpClient = nullptr;
+        SetHttpClientFactory(nullptr);
+        InitHttp();
+    }
+
+    static JsonValue MakeKey(const char* id)
+    {
+        JsonValue key;
+        key.WithObject("id", JsonValue().WithString("S", id));
+        return key;
+    }
+
+    static GetItemStyleRequest MakeTemplate()
+    {
+        GetItemStyleRequest requestTemplate;
+        requestTemplate.GetPayload().WithString("TableName", "Users").WithString("ProjectionExpression", "id, email")
+            .WithObject("Key", MakeKey("ignored"));
+        return requestTemplate;
+    }
+
+    std::shared_ptr<RecordingHttpClient> m_httpClient;
+};
+
+} // anonymous namespace
+
+TEST_F(PreparedRequestTest, TestBodyCarriesTemplateMembersAndCallKey)
+{
+    PreparingJsonClient client((ClientConfiguration()));
+    PreparedRequest preparedRequest = client.Prepare(MakeTemplate());
+
+    ASSERT_TRUE(client.Invoke(preparedRequest, MakeKey("first")));
+    ASSERT_TRUE(client.Invoke(preparedRequest, MakeKey("second")));
+    ASSERT_EQ(2u, m_httpClient->GetSent().size());
+
+    const char* expectedIds[] = { "first", "second" };
+    for (size_t i = 0; i < 2; ++i)
+    {
+        const SentRequest& sent = m_httpClient->GetSent()[i];
+        JsonValue body(sent.body);
+        ASSERT_TRUE(body.WasParseSuccessful()) << sent.body;
+        ASSERT_EQ("Users", body.GetString("TableName"));
+        ASSERT_EQ("id, email", body.GetString("ProjectionExpression"));
+        ASSERT_EQ(expectedIds[i], body.GetObject("Key").GetObject("id").GetString("S"));
+        ASSERT_EQ(3u, body.GetAllObjects().size());
+
+        ASSERT_EQ("DynamoDB_20120810.GetItem", sent.headers.at("x-amz-target"));
+        ASSERT_EQ(Aws::AMZN_JSON_CONTENT_TYPE_1_0, sent.headers.at("content-type"));
+        ASSERT_EQ(Aws::Utils::StringUtils::to_string(sent.body.size()), sent.headers.at(CONTENT_LENGTH_HEADER));
+        ASSERT_FALSE(sent.headers.at(USER_AGENT_HEADER).empty());
+        ASSERT_EQ("POST /", sent.headers.at("x-test-canonical-prefix"));
+    }
+}
+
+TEST_F(PreparedRequestTest, TestTemplateWithOnlyTheMember)
+{
+    PreparingJsonClient client((ClientConfiguration()));
+    PreparedRequest preparedRequest = client.Prepare(GetItemStyleRequest());
+
+    ASSERT_TRUE(client.Invoke(preparedRequest, MakeKey("only")));
+    JsonValue body(m_httpClient->GetSent()[0].body);
+    ASSERT_TRUE(body.WasParseSuccessful()) << m_httpClient->GetSent()[0].body;
+    ASSERT_EQ(1u, body.GetAllObjects().size());
+    ASSERT_EQ("only", body.GetObject("Key").GetObject("id").GetString("S"));
+}
+
+TEST_F(PreparedRequestTest, TestPreparedSignatureMatchesSignRequest)
+{
+    AWSAuthV4Signer signer(Aws::MakeShared<SimpleAWSCredentialsProvider>(PREPARED_TEST_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY"),
+        "dynamodb", "us-east-1");
+    URI uri("https://dynamodb.us-east-1.amazonaws.com/path/to?b=2&a=1");
+
+    Standard::StandardHttpRequest preparedRequest(uri, HttpMethod::HTTP_POST);
+    Aws::String canonicalRequestPrefix = signer.PrepareCanonicalRequest(preparedRequest);
+    ASSERT_EQ(0u, canonicalRequestPrefix.find("POST\n"));
+
+    //the signature covers x-amz-date, so only a pair of requests signed within the same second can be compared.
+    for (int attempt = 0; attempt < 5; ++attempt)
+    {
+        Standard::StandardHttpRequest unprepared(uri, HttpMethod::HTTP_POST);
+        Standard::StandardHttpRequest prepared(preparedRequest.GetUri(), HttpMethod::HTTP_POST);
+        for (auto request : { &unprepared, &prepared })
+        {
+            request->SetHeaderValue("x-amz-target", "DynamoDB_20120810.GetItem");
+            request->AddContentBody(Aws::MakeShared<Aws::StringStream>(PREPARED_TEST_TAG, "{\"TableName\":\"Users\"}"));
+        }
+
+        ASSERT_TRUE(signer.SignRequest(unprepared));
+        ASSERT_TRUE(signer.SignPreparedRequest(prepared, canonicalRequestPrefix));
+        if (unprepared.GetHeaderValue(AWS_DATE_HEADER) == prepared.GetHeaderValue(AWS_DATE_HEADER))
+        {
+            ASSERT_EQ(unprepared.GetHeaderValue(AWS_AUTHORIZATION_HEADER), prepared.GetHeaderValue(AWS_AUTHORIZATION_HEADER));
+            return;
+        }
+    }
+    FAIL() << "could not sign two requests within the same second";
+}
+
+TEST_F(PreparedRequestTest, TestRetriesResendTheSameBody)
+{
+    PreparingJsonClient client((ClientConfiguration()));
+    PreparedRequest preparedRequest = client.Prepare(MakeTemplate());
+    m_httpClient->SetFailuresBeforeSuccess(1);
+
+    ASSERT_TRUE(client.Invoke(preparedRequest, MakeKey("retried")));
+    const Aws::Vector<SentRequest>& sent = m_httpClient->GetSent();
+    ASSERT_EQ(2u, sent.size());
+    ASSERT_EQ(sent[0].body, sent[1].body);
+    ASSERT_EQ("hash1", sent[0].headers.at(X_AMZ_CONTENT_SHA256_HEADER));
+    ASSERT_EQ("hash1", sent[1].headers.at(X_AMZ_CONTENT_SHA256_HEADER));
+}
+
+TEST_F(PreparedRequestTest, TestContentSha256HeaderOnTheRequestIsNotTrusted)
+{
+    PreparingJsonClient client((ClientConfiguration()));
+    GetItemStyleRequest request = MakeTemplate();
+    request.SetContentSha256("stale");
+    m_httpClient->SetFailuresBeforeSuccess(1);
+
+    ASSERT_TRUE(client.Invoke(request));
+    ASSERT_TRUE(client.Invoke(client.Prepare(request), MakeKey("prepared")));
+    const Aws::Vector<SentRequest>& sent = m_httpClient->GetSent();
+    ASSERT_EQ(3u, sent.size());
+    ASSERT_EQ("hash1", sent[0].headers.at(X_AMZ_CONTENT_SHA256_HEADER));
+    ASSERT_EQ("hash1", sent[1].headers.at(X_AMZ_CONTENT_SHA256_HEADER));
+    ASSERT_EQ("hash2", sent[2].headers.at(X_AMZ_CONTENT_SHA256_HEADER));
+}
+
+TEST_F(PreparedRequestTest, TestRequestArenaCoversParsingTheResponse)
+{
+    ClientConfiguration config;
+    config.useRequestScopedArena = true;
+    PreparingJsonClient client(config);
+    m_httpClient->SetFailuresBeforeSuccess(1);
+
+    //the first attempt's error body and the final response body are both parsed while the arena is installed.
+    ASSERT_EQ("a", client.GetItemId(MakeTemplate()));
+    ASSERT_EQ("a", client.GetItemId(client.Prepare(MakeTemplate()), MakeKey("prepared")));
+    ASSERT_EQ(3u, m_httpClient->GetSent().size());
+    ASSERT_EQ(nullptr, Aws::Utils::Memory::GetThreadMemoryArena());
+}
+
+TEST_F(PreparedRequestTest, TestResponseStreamsComeFromTheConfigurationUnlessTheRequestSetsOne)
+{
+    Aws::IOStream* defaultStream = ClientConfiguration().responseStreamFactory();
+    ASSERT_NE(nullptr, dynamic_cast<Aws::Utils::Stream::SpillingResponseStream*>(defaultStream));
+    Aws::Delete(defaultStream);
+
+    size_t configuredStreams = 0;
+    size_t requestStreams = 0;
+    ClientConfiguration config;
+    config.responseStreamFactory = [&configuredStreams]() -> Aws::IOStream*
+    {
+        ++configuredStreams;
+        return Aws::New<Aws::StringStream>(PREPARED_TEST_TAG);
+    };
+    PreparingJsonClient client(config);
+
+    ASSERT_TRUE(client.Invoke(client.Prepare(MakeTemplate()), MakeKey("configured")));
+    ASSERT_EQ(1u, configuredStreams);
+
+    GetItemStyleRequest requestTemplate = MakeTemplate();
+    requestTemplate.SetResponseStreamFactory([&requestStreams]() -> Aws::IOStream*
+    {
+        ++requestStreams;
+        return Aws::New<Aws::StringStream>(PREPARED_TEST_TAG);
+    });
+    ASSERT_TRUE(client.Invoke(client.Prepare(requestTemplate), MakeKey("own")));
+    ASSERT_EQ(1u, configuredStreams);
+    ASSERT_EQ(1u, requestStreams);
+}
@@ -0,0 +1,143 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+/*
+ * Compares WorkStealingExecutor against PooledThreadExecutor on many small tasks, the shape of a burst of
+ * GetItemAsync/SendMessageAsync calls.
+ *
+ * Two workloads are timed for each executor:
+ *   external - several application threads submit tiny tasks concurrently
+ *   nested   - tasks submit follow-up tasks, as response handlers that issue the next call do
+ *
+ * usage: ExecutorBenchmark [tasks per submitter] [submitters] [pool size]
+ */
+
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/WorkStealingExecutor.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace Aws::Utils::Threading;
+
+namespace
+{
+    void WaitForCount(const std::atomic<unsigned>& counter, unsigned expected)
+    {
+        while (counter.load() < expected)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // a few hundred nanoseconds of work, so the executor overhead is what gets measured
+    void SmallWork(std::atomic<unsigned>& completed)
+    {
+        volatile unsigned value = 0;
+        for (unsigned i = 0; i < 64; ++i)
+        {
+            value = value + i;
+        }
+        ++completed;
+    }
+
+    double RunExternal(Executor& executor, unsigned tasksPerSubmitter, unsigned submitters)
+    {
+        std::atomic<unsigned> completed(0);
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < submitters; ++t)
+        {
+            threads.emplace_back([&]()
+            {
+                for (unsigned i = 0; i < tasksPerSubmitter; ++i)
+                {
+                    executor.Submit([&completed]() { SmallWork(completed); });
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        WaitForCount(completed, tasksPerSubmitter * submitters);
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    void SubmitChain(Executor& executor, std::atomic<unsigned>& completed, unsigned remaining)
+    {
+        SmallWork(completed);
+        if (remaining > 1)
+        {
+            executor.Submit([&executor, &completed, remaining]() { SubmitChain(executor, completed, remaining - 1); });
+        }
+    }
+
+    double RunNested(Executor& executor, unsigned tasksPerSubmitter, unsigned submitters)
+    {
+        static const unsigned CHAIN_LENGTH = 16;
+        std::atomic<unsigned> completed(0);
+        unsigned chains = tasksPerSubmitter * submitters / CHAIN_LENGTH;
+        auto start = std::chrono::steady_clock::now();
+
+        for (unsigned i = 0; i < chains; ++i)
+        {
+            executor.Submit([&executor, &completed]() { SubmitChain(executor, completed, CHAIN_LENGTH); });
+        }
+        WaitForCount(completed, chains * CHAIN_LENGTH);
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    void Report(const char* executorName, const char* workload, unsigned tasks, double ms)
+    {
+        printf("%-22s %-10s %12.2f %14.0f\n", executorName, workload, ms, tasks / (ms / 1000.0));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    unsigned tasksPerSubmitter = argc > 1 ? static_cast<unsigned>(atoi(argv[1])) : 200000;
+    unsigned submitters = argc > 2 ? static_cast<unsigned>(atoi(argv[2])) : 4;
+    unsigned poolSize = argc > 3 ? static_cast<unsigned>(atoi(argv[3])) : std::thread::hardware_concurrency();
+    poolSize = poolSize > 0 ? poolSize : 4;
+    unsigned tasks = tasksPerSubmitter * submitters;
+
+    printf("%u tasks, %u submitters, pool of %u\n", tasks, submitters, poolSize);
+    printf("%-22s %-10s %12s %14s\n", "executor", "workload", "total ms", "tasks/second");
+
+    {
+        PooledThreadExecutor pooled(poolSize);
+        Report("PooledThreadExecutor", "external", tasks, RunExternal(pooled, tasksPerSubmitter, submitters));
+        Report("PooledThreadExecutor", "nested", tasks, RunNested(pooled, tasksPerSubmitter, submitters));
+    }
+
+    {
+        WorkStealingExecutor stealing(poolSize);
+        Report("WorkStealingExecutor", "external", tasks, RunExternal(stealing, tasksPerSubmitter, submitters));
+        Report("WorkStealingExecutor", "nested", tasks, RunNested(stealing, tasksPerSubmitter, submitters));
+        printf("steals: %zu\n", stealing.GetStealCount());
+    }
+
+    return 0;
+}
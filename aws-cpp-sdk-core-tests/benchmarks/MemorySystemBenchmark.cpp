@@ -0,0 +1,231 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+/*
+ * Compares ThreadCachingMemorySystem against plain malloc/free on a recorded SDK workload.
+ *
+ * The workload is captured by running representative request/response work (URI building, header maps, JSON and
+ * XML round trips) under a recording memory system, which logs every allocation size and free in order. The log
+ * is then replayed against each allocator, from one thread and from several threads at once.
+ *
+ * usage: MemorySystemBenchmark [replays per thread] [threads]
+ */
+
+#include <aws/core/http/URI.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/ThreadCachingMemorySystem.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/xml/XmlSerializer.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace Aws::Utils::Memory;
+
+namespace
+{
+    struct AllocationEvent
+    {
+        bool isAllocation;
+        std::size_t size;
+        std::size_t slot;
+    };
+
+    /**
+     * Records the size and order of every allocation and free made through the SDK.
+     */
+    class RecordingMemorySystem : public MemorySystemInterface
+    {
+    public:
+        void Begin() override {}
+        void End() override {}
+
+        void* AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag) override
+        {
+            (void)alignment;
+            (void)allocationTag;
+
+            // the slot index rides in front of the block so frees can be matched to their allocation
+            std::size_t* memory = static_cast<std::size_t*>(malloc(blockSize + 16));
+            memory[0] = m_events.size();
+            m_events.push_back(AllocationEvent{ true, blockSize, m_events.size() });
+            return reinterpret_cast<char*>(memory) + 16;
+        }
+
+        void FreeMemory(void* memoryPtr) override
+        {
+            std::size_t* memory = reinterpret_cast<std::size_t*>(static_cast<char*>(memoryPtr) - 16);
+            m_events.push_back(AllocationEvent{ false, 0, memory[0] });
+            free(memory);
+        }
+
+        const std::vector<AllocationEvent>& GetEvents() const { return m_events; }
+
+    private:
+        std::vector<AllocationEvent> m_events;
+    };
+
+    void RunRequestWorkload()
+    {
+        static const char* TAG = "MemorySystemBenchmark";
+
+        Aws::Http::URI uri("https://sqs.us-east-1.amazonaws.com/123456789012/benchmark-queue");
+        uri.AddQueryStringParameter("Action", "ReceiveMessage");
+        uri.AddQueryStringParameter("MaxNumberOfMessages", "10");
+        uri.AddQueryStringParameter("AttributeName.1", "All");
+        uri.CanonicalizeQueryString();
+
+        auto request = Aws::MakeShared<Aws::Http::Standard::StandardHttpRequest>(TAG, uri, Aws::Http::HttpMethod::HTTP_POST);
+        request->SetHeaderValue("content-type", "application/x-amz-json-1.0");
+        request->SetHeaderValue("x-amz-target", "DynamoDB_20120810.GetItem");
+        request->SetHeaderValue("x-amz-date", "20160101T000000Z");
+        request->SetHeaderValue("user-agent", "aws-sdk-cpp/benchmark");
+
+        Aws::Utils::Json::JsonValue key;
+        key.WithObject("id", Aws::Utils::Json::JsonValue().WithString("S", "item-0001"));
+        Aws::Utils::Json::JsonValue body;
+        body.WithString("TableName", "benchmark-table").WithObject("Key", key).WithBool("ConsistentRead", true);
+        Aws::String payload = body.WriteCompact();
+
+        Aws::Utils::Json::JsonValue response(Aws::String("{\"Item\":{\"id\":{\"S\":\"item-0001\"},\"count\":{\"N\":\"42\"},"
+            "\"name\":{\"S\":\"a reasonably long attribute value that does not fit in a small string buffer\"}}}"));
+        Aws::Map<Aws::String, Aws::String> attributes;
+        for (auto& item : response.GetObject("Item").GetAllObjects())
+        {
+            attributes[item.first] = item.second.GetAllObjects().begin()->second.AsString();
+        }
+
+        auto document = Aws::Utils::Xml::XmlDocument::CreateFromXmlString(
+            "<ReceiveMessageResponse><ReceiveMessageResult>"
+            "<Message><MessageId>5fea7756-0ea4-451a-a703-a558b933e274</MessageId><Body>first message body</Body></Message>"
+            "<Message><MessageId>6a1559560-f7e2-4b2c-bbc0-0ce6da8b2c21</MessageId><Body>second message body</Body></Message>"
+            "</ReceiveMessageResult><ResponseMetadata><RequestId>b6633655-283d-45b4-aee4-4e84e0ae6afa</RequestId>"
+            "</ResponseMetadata></ReceiveMessageResponse>");
+        Aws::Vector<Aws::String> messageBodies;
+        auto message = document.GetRootElement().FirstChild("ReceiveMessageResult").FirstChild("Message");
+        while (!message.IsNull())
+        {
+            messageBodies.push_back(message.FirstChild("Body").GetText());
+            message = message.NextNode("Message");
+        }
+    }
+
+    template<typename Allocate, typename Free>
+    double ReplayPerThread(const std::vector<AllocationEvent>& events, std::size_t slotCount, unsigned replays, unsigned threads,
+        Allocate allocate, Free release)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> workers;
+        for (unsigned t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&]()
+            {
+                std::vector<void*> slots(slotCount, nullptr);
+                for (unsigned replay = 0; replay < replays; ++replay)
+                {
+                    for (const AllocationEvent& event : events)
+                    {
+                        if (event.isAllocation)
+                        {
+                            slots[event.slot] = allocate(event.size);
+                            static_cast<char*>(slots[event.slot])[0] = 1;
+                        }
+                        else
+                        {
+                            release(slots[event.slot]);
+                        }
+                    }
+                }
+            });
+        }
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    unsigned replays = argc > 1 ? static_cast<unsigned>(atoi(argv[1])) : 2000;
+    unsigned threadCount = argc > 2 ? static_cast<unsigned>(atoi(argv[2])) : 4;
+
+    // every object the workload creates is gone before the recorder is uninstalled
+    RecordingMemorySystem recorder;
+    InitializeAWSMemorySystem(recorder);
+    RunRequestWorkload();
+    ShutdownAWSMemorySystem();
+    const std::vector<AllocationEvent>& events = recorder.GetEvents();
+
+    // keep only allocations that were also freed by the workload, so every replay starts and ends empty
+    std::vector<bool> freed(events.size(), false);
+    for (const AllocationEvent& event : events)
+    {
+        if (!event.isAllocation)
+        {
+            freed[event.slot] = true;
+        }
+    }
+
+    std::vector<AllocationEvent> workload;
+    std::size_t allocationCount = 0;
+    std::size_t allocatedBytes = 0;
+    for (const AllocationEvent& event : events)
+    {
+        if (freed[event.slot])
+        {
+            workload.push_back(event);
+            if (event.isAllocation)
+            {
+                ++allocationCount;
+                allocatedBytes += event.size;
+            }
+        }
+    }
+
+    printf("recorded workload: %zu allocations, %zu bytes per request\n", allocationCount, allocatedBytes);
+    printf("%-28s %8s %12s %14s\n", "allocator", "threads", "total ms", "ns/allocation");
+
+    ThreadCachingMemorySystem pool;
+    auto mallocAllocate = [](std::size_t size) { return malloc(size); };
+    auto mallocFree = [](void* memory) { free(memory); };
+    auto poolAllocate = [&pool](std::size_t size) { return pool.AllocateMemory(size, 1); };
+    auto poolFree = [&pool](void* memory) { pool.FreeMemory(memory); };
+
+    unsigned threadCounts[] = { 1, threadCount };
+    for (unsigned threads : threadCounts)
+    {
+        double allocations = static_cast<double>(allocationCount) * replays * threads;
+
+        double mallocMs = ReplayPerThread(workload, freed.size(), replays, threads, mallocAllocate, mallocFree);
+        printf("%-28s %8u %12.2f %14.2f\n", "malloc", threads, mallocMs, mallocMs * 1e6 / allocations);
+
+        double poolMs = ReplayPerThread(workload, freed.size(), replays, threads, poolAllocate, poolFree);
+        printf("%-28s %8u %12.2f %14.2f\n", "ThreadCachingMemorySystem", threads, poolMs, poolMs * 1e6 / allocations);
+    }
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+/*
+ * Measures ApplyCost throughput when many threads share one limiter, the way concurrent downloads share
+ * ClientConfiguration::readRateLimiter (CurlHttpClient charges it once per received chunk).
+ *
+ * The rate is set high enough that no call is delayed, so only the cost of the bookkeeping is measured.
+ *
+ * usage: RateLimiterBenchmark [calls per thread] [threads]
+ */
+
+#include <aws/core/utils/ratelimiter/DefaultRateLimiter.h>
+#include <aws/core/utils/ratelimiter/AtomicRateLimiter.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace Aws::Utils::RateLimits;
+
+namespace
+{
+    double Run(RateLimiterInterface& limiter, unsigned callsPerThread, unsigned threadCount)
+    {
+        std::atomic<unsigned> ready(0);
+        std::atomic<bool> go(false);
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&]()
+            {
+                ++ready;
+                while (!go.load())
+                {
+                    std::this_thread::yield();
+                }
+                for (unsigned i = 0; i < callsPerThread; ++i)
+                {
+                    limiter.ApplyCost(16384);
+                }
+            });
+        }
+
+        while (ready.load() < threadCount)
+        {
+            std::this_thread::yield();
+        }
+        auto start = std::chrono::steady_clock::now();
+        go = true;
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    void Report(const char* limiterName, unsigned calls, double ms)
+    {
+        printf("%-20s %12.2f %14.0f %10.1f\n", limiterName, ms, calls / (ms / 1000.0), ms * 1000000.0 / calls);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    unsigned callsPerThread = argc > 1 ? static_cast<unsigned>(atoi(argv[1])) : 100000;
+    unsigned threadCount = argc > 2 ? static_cast<unsigned>(atoi(argv[2])) : 64;
+    unsigned calls = callsPerThread * threadCount;
+    const int64_t rate = static_cast<int64_t>(1) << 40;
+
+    printf("%u calls, %u threads\n", calls, threadCount);
+    printf("%-20s %12s %14s %10s\n", "limiter", "total ms", "calls/second", "ns/call");
+
+    {
+        DefaultRateLimiter<> limiter(rate);
+        Report("DefaultRateLimiter", calls, Run(limiter, callsPerThread, threadCount));
+    }
+
+    {
+        AtomicRateLimiter<> limiter(rate);
+        Report("AtomicRateLimiter", calls, Run(limiter, callsPerThread, threadCount));
+    }
+
+    return 0;
+}
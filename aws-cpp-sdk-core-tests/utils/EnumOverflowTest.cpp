@@ -16,6 +16,9 @@
 #include <aws/external/gtest.h>
 #include <aws/core/utils/EnumParseOverflowContainer.h>
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/StringUtils.h>
+#include <thread>
+#include <vector>
 
 using namespace Aws::Utils;
 
@@ -44,4 +47,70 @@ TEST(EnumOverflowTest, TestUseWithEnum)
 
     TestEnum nonModeledValue = static_cast<TestEnum>(hashCode);
     ASSERT_EQ("VALUE4", container.RetrieveOverflow(static_cast<int>(nonModeledValue)));
-}
\ No newline at end of file
+}
+
+TEST(EnumOverflowTest, TestStoreSameHashTwice)
+{
+    EnumParseOverflowContainer container;
+    container.StoreOverflow(15, "fifteen");
+    container.StoreOverflow(15, "fifteen");
+    ASSERT_EQ("fifteen", container.RetrieveOverflow(15));
+
+    container.StoreOverflow(15, "FIFTEEN");
+    ASSERT_EQ("FIFTEEN", container.RetrieveOverflow(15));
+}
+
+TEST(EnumOverflowTest, TestAlternatingCollidingValues)
+{
+    EnumParseOverflowContainer container;
+    int hashCode = HashingUtils::HashString("Aa");
+    ASSERT_EQ(hashCode, HashingUtils::HashString("BB"));
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        container.StoreOverflow(hashCode, i % 2 ? "BB" : "Aa");
+    }
+
+    // both values keep their first entry; the newer of the two answers for the shared hash
+    ASSERT_EQ("BB", container.RetrieveOverflow(hashCode));
+}
+
+TEST(EnumOverflowTest, TestConcurrentStoreAndRetrieve)
+{
+    EnumParseOverflowContainer container;
+    static const int THREAD_COUNT = 8;
+    static const int VALUES_PER_THREAD = 200;
+
+    std::vector<std::thread> threads;
+    for (int threadIndex = 0; threadIndex < THREAD_COUNT; ++threadIndex)
+    {
+        threads.emplace_back([&container, threadIndex]()
+        {
+            for (int i = 0; i < VALUES_PER_THREAD; ++i)
+            {
+                int hashCode = threadIndex * VALUES_PER_THREAD + i;
+                container.StoreOverflow(hashCode, StringUtils::to_string(hashCode));
+                container.RetrieveOverflow(hashCode % (VALUES_PER_THREAD / 2));
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int hashCode = 0; hashCode < THREAD_COUNT * VALUES_PER_THREAD; ++hashCode)
+    {
+        ASSERT_EQ(StringUtils::to_string(hashCode), container.RetrieveOverflow(hashCode));
+    }
+}
+
+// generated enum mappers switch on hashes the code generator computed, so the runtime hash must not change.
+TEST(EnumOverflowTest, TestHashMatchesGeneratedConstants)
+{
+    ASSERT_EQ(2402104, HashingUtils::HashString("NONE"));
+    ASSERT_EQ(-192891319, HashingUtils::HashString("ALL_OLD"));
+    ASSERT_EQ(1584466019, HashingUtils::HashString("UPDATED_OLD"));
+    ASSERT_EQ(0, HashingUtils::HashString(""));
+}
@@ -30,6 +30,21 @@ TEST(FileTest, HomeDirectory)
     ASSERT_TRUE(homeDirectory.size() > 0);
 }
 
+TEST(FileTest, TempDirectory)
+{
+    auto tempDirectory = Aws::FileSystem::GetTempDirectory();
+
+    ASSERT_TRUE(tempDirectory.size() > 0);
+    ASSERT_TRUE(tempDirectory.size() == 1 || tempDirectory.back() != Aws::FileSystem::PATH_DELIM);
+
+    Aws::String filePath = tempDirectory + Aws::FileSystem::PATH_DELIM + "FileTestTempDirectory";
+    {
+        std::ofstream file(filePath.c_str());
+        ASSERT_TRUE(file.good());
+    }
+    ASSERT_TRUE(Aws::FileSystem::RemoveFileIfExists(filePath.c_str()));
+}
+
 TEST(FileTest, TempFile)
 {
     Aws::String filePath; 
@@ -20,6 +20,7 @@
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <climits>
+#include <cstring>
 
 using namespace Aws::Utils;
 
@@ -181,6 +182,31 @@ TEST(StringUtilsTest, TestURLEncodeAndDecode)
     AWS_END_MEMORY_TEST
 }
 
+TEST(StringUtilsTest, TestURLEncodeLongRunsAndAppend)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    //long enough to exercise the block scan, with characters needing encoding at block boundaries and in the tail.
+    Aws::String toEncode = "abcdefghijklmnopqrstuvwxyzABCDEF0123456789-_.~ABCDEFG/HIJKLMNOPQRSTUV+\xC3\xA9\x7F tail";
+    Aws::String encoded = StringUtils::URLEncode(toEncode.c_str());
+    ASSERT_STREQ("abcdefghijklmnopqrstuvwxyzABCDEF0123456789-_.~ABCDEFG%2FHIJKLMNOPQRSTUV%2B%C3%A9%7F%20tail", encoded.c_str());
+    ASSERT_EQ(toEncode, StringUtils::URLDecode(encoded.c_str()));
+
+    //every byte outside the unreserved set is escaped, including the ones that look harmless.
+    ASSERT_STREQ("%21%2A%27%28%29%3B%3A%40%26%3D%2B%24%2C%2F%3F%23%5B%5D%60%7B%7D%7C%5C%5E%22%3C%3E",
+        StringUtils::URLEncode("!*'();:@&=+$,/?#[]`{}|\\^\"<>").c_str());
+    ASSERT_STREQ("", StringUtils::URLEncode("").c_str());
+
+    Aws::String output = "Action=SendMessage&MessageBody=";
+    const char* body = "hello world&more";
+    StringUtils::URLEncode(body, 11, output);
+    output.append("&");
+    StringUtils::URLEncode(body, strlen(body), output);
+    ASSERT_STREQ("Action=SendMessage&MessageBody=hello%20world&hello%20world%26more", output.c_str());
+
+    AWS_END_MEMORY_TEST
+}
+
 TEST(StringUtilsTest, TestInt64Conversion)
 {
     long long bigIntValue = LLONG_MAX - 1;
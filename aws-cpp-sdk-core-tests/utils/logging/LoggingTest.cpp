@@ -18,11 +18,21 @@
 #include <aws/external/gtest.h>
 #include <aws/testing/MemoryTesting.h>
 
+#include <aws/core/utils/logging/BinaryLogSystem.h>
 #include <aws/core/utils/logging/DefaultLogSystem.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/logging/LogFormatCapture.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/StringUtils.h>
-
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/platform/FileSystem.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <condition_variable>
+#include <cstdarg>
+#include <cstring>
+#include <fstream>
+#include <mutex>
 #include <thread>
 
 using namespace Aws::Utils;
@@ -164,3 +174,323 @@ TEST(LoggingTest, testTraceLogLevel)
 
     AWS_END_MEMORY_TEST
 }
+
+// holds the logging thread inside its first write until released, so the queue can be filled deterministically
+class GatedStreamBuf : public std::streambuf
+{
+    public:
+        GatedStreamBuf() : m_writeEntered(false), m_released(false) {}
+
+        void WaitForWrite()
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_signal.wait(locker, [this](){ return m_writeEntered; });
+        }
+
+        void Release()
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_released = true;
+            m_signal.notify_all();
+        }
+
+        const Aws::String& GetContents() const { return m_contents; }
+
+    protected:
+        std::streamsize xsputn(const char* s, std::streamsize n) override
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_writeEntered = true;
+            m_signal.notify_all();
+            m_signal.wait(locker, [this](){ return m_released; });
+            m_contents.append(s, static_cast<size_t>(n));
+            return n;
+        }
+
+    private:
+        std::mutex m_lock;
+        std::condition_variable m_signal;
+        bool m_writeEntered;
+        bool m_released;
+        Aws::String m_contents;
+};
+
+TEST(LoggingTest, testDropPolicyCountsDroppedLines)
+{
+    GatedStreamBuf gate;
+    auto gatedStream = Aws::MakeShared<Aws::OStream>(AllocationTag, &gate);
+
+    DefaultLogSystemOptions options;
+    options.queueCapacity = 2;
+    options.overflowPolicy = LogOverflowPolicy::Drop;
+
+    uint64_t dropped = 0;
+    uint64_t written = 0;
+    {
+        DefaultLogSystem logSystem(LogLevel::Info, gatedStream, options);
+        logSystem.Log(LogLevel::Info, "LoggingTest", "first");
+        gate.WaitForWrite();
+
+        for (int i = 0; i < 10; ++i)
+        {
+            logSystem.Log(LogLevel::Info, "LoggingTest", "queued %d", i);
+        }
+        dropped = logSystem.GetDroppedLineCount();
+        gate.Release();
+
+        // block policy is the default, so destruction drains what made it into the queue
+        while (logSystem.GetWrittenLineCount() < 3)
+        {
+            std::this_thread::yield();
+        }
+        written = logSystem.GetWrittenLineCount();
+    }
+
+    ASSERT_EQ(8u, dropped);
+    ASSERT_EQ(3u, written);
+    Aws::Vector<Aws::String> lines = StringUtils::SplitOnLine(gate.GetContents());
+    ASSERT_EQ(3u, lines.size());
+    ASSERT_NE(Aws::String::npos, lines[0].find("first"));
+    ASSERT_NE(Aws::String::npos, lines[1].find("queued 0"));
+    ASSERT_NE(Aws::String::npos, lines[2].find("queued 1"));
+}
+
+TEST(LoggingTest, testBlockPolicyKeepsEveryLine)
+{
+    auto ss = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+
+    DefaultLogSystemOptions options;
+    options.queueCapacity = 4;
+
+    static const int THREAD_COUNT = 4;
+    static const int LINES_PER_THREAD = 500;
+    {
+        DefaultLogSystem logSystem(LogLevel::Info, ss, options);
+        Aws::Vector<std::thread> threads;
+        for (int t = 0; t < THREAD_COUNT; ++t)
+        {
+            threads.emplace_back([&logSystem, t]()
+            {
+                for (int i = 0; i < LINES_PER_THREAD; ++i)
+                {
+                    logSystem.Log(LogLevel::Info, "LoggingTest", "thread %d line %d", t, i);
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        ASSERT_EQ(0u, logSystem.GetDroppedLineCount());
+    }
+
+    ASSERT_EQ(static_cast<size_t>(THREAD_COUNT * LINES_PER_THREAD), StringUtils::SplitOnLine(ss->str()).size());
+}
+
+TEST(LoggingTest, testSizeBasedRolling)
+{
+    Aws::String prefix = Aws::FileSystem::CreateTempFilePath() + "_roll_";
+    Aws::String hour = DateTime::CalculateLocalTimestampAsString("%Y-%m-%d-%H");
+
+    DefaultLogSystemOptions options;
+    options.maxFileSizeBytes = 200;
+    {
+        DefaultLogSystem logSystem(LogLevel::Info, prefix, options);
+        for (int i = 0; i < 6; ++i)
+        {
+            logSystem.Log(LogLevel::Info, "LoggingTest", "a line long enough that two of them do not fit in one small file %d", i);
+            while (logSystem.GetWrittenLineCount() < static_cast<uint64_t>(i + 1))
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    // every file other than the first starts with a line that would have pushed the previous one past the limit
+    Aws::IFStream first((prefix + hour + ".log").c_str());
+    Aws::IFStream second((prefix + hour + ".1.log").c_str());
+    ASSERT_TRUE(first.good());
+    ASSERT_TRUE(second.good());
+    first.close();
+    second.close();
+
+    for (int i = 0; i < 6; ++i)
+    {
+        Aws::String fileName = prefix + hour + (i == 0 ? Aws::String() : "." + StringUtils::to_string(i)) + ".log";
+        Aws::FileSystem::RemoveFileIfExists(fileName.c_str());
+    }
+}
+
+static void LogMixedConversions(LogSystemInterface& logSystem, const Aws::String& longArgument)
+{
+    int value = 42;
+    logSystem.Log(LogLevel::Info, "LoggingTest", "ints %d %i %u %x %X %o %hhd %hu %ld %lld %zu %%", -7, 8, 9u, 255u, 255u, 8u,
+        static_cast<signed char>(-3), static_cast<unsigned short>(65535), -123456L, -1234567890123LL, static_cast<size_t>(77));
+    logSystem.Log(LogLevel::Info, "LoggingTest", "floats %5.2f %e %g %Lf %a", 3.14159, 1.5e10, 0.0001, static_cast<long double>(2.5), 1.0);
+    logSystem.Log(LogLevel::Info, "LoggingTest", "strings %s|%-10s|%.3s|%*d|%.*f|%c|%p", "plain", "left", "truncated", 6, 12, 2, 1.23456, 'z',
+        static_cast<void*>(&value));
+    logSystem.Log(LogLevel::Info, "LoggingTest", "wide %ls falls back to eager formatting", L"text");
+    logSystem.Log(LogLevel::Info, "LoggingTest", "long %s end", longArgument.c_str());
+}
+
+// drops "[LEVEL] timestamp tag [thread] " so lines logged in different seconds compare equal
+static Aws::String StripLogPrefix(const Aws::String& line)
+{
+    size_t levelEnd = line.find("] ");
+    size_t threadEnd = line.find("] ", levelEnd + 2);
+    return threadEnd == Aws::String::npos ? line : line.substr(threadEnd + 2);
+}
+
+TEST(LoggingTest, testDeferredFormattingMatchesEagerFormatting)
+{
+    Aws::String longArgument(3000, 'x');
+    auto eagerStream = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    auto deferredStream = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+
+    DefaultLogSystemOptions deferredOptions;
+    deferredOptions.deferFormatting = true;
+    {
+        DefaultLogSystem eager(LogLevel::Info, eagerStream);
+        DefaultLogSystem deferred(LogLevel::Info, deferredStream, deferredOptions);
+        LogMixedConversions(eager, longArgument);
+        LogMixedConversions(deferred, longArgument);
+    }
+
+    Aws::Vector<Aws::String> eagerLines = StringUtils::SplitOnLine(eagerStream->str());
+    Aws::Vector<Aws::String> deferredLines = StringUtils::SplitOnLine(deferredStream->str());
+    ASSERT_EQ(5u, eagerLines.size());
+    ASSERT_EQ(eagerLines.size(), deferredLines.size());
+    for (size_t i = 0; i < eagerLines.size(); ++i)
+    {
+        ASSERT_EQ(eagerLines[i].substr(0, eagerLines[i].find(' ')), deferredLines[i].substr(0, deferredLines[i].find(' ')));
+        ASSERT_EQ(StripLogPrefix(eagerLines[i]), StripLogPrefix(deferredLines[i]));
+    }
+
+    ASSERT_EQ("ints -7 8 9 ff FF 10 -3 65535 -123456 -1234567890123 77 %", StripLogPrefix(eagerLines[0]));
+    ASSERT_EQ("wide text falls back to eager formatting", StripLogPrefix(deferredLines[3]));
+    ASSERT_EQ("long " + longArgument + " end", StripLogPrefix(eagerLines[4]));
+    ASSERT_NE(Aws::String::npos, eagerLines[0].find("LoggingTest ["));
+}
+
+TEST(LoggingTest, testFormatCaptureOutlivesArguments)
+{
+    Aws::String record;
+    {
+        char scratch[16];
+        std::strcpy(scratch, "transient");
+        auto capture = [&record](const char* formatStr, ...)
+        {
+            va_list args;
+            va_start(args, formatStr);
+            bool captured = CaptureFormatArguments(formatStr, args, record);
+            va_end(args);
+            return captured;
+        };
+        ASSERT_TRUE(capture("%s=%d", scratch, 5));
+        std::strcpy(scratch, "overwritten");
+        ASSERT_FALSE(capture("%n", static_cast<int*>(nullptr)));
+    }
+
+    Aws::String text;
+    const char* cursor = record.c_str();
+    ASSERT_TRUE(FormatCapturedArguments(cursor, record.c_str() + record.size(), text));
+    ASSERT_EQ("transient=5", text);
+    ASSERT_EQ(record.c_str() + record.size(), cursor);
+
+    cursor = record.c_str();
+    ASSERT_FALSE(FormatCapturedArguments(cursor, record.c_str() + record.size() - 1, text));
+}
+
+TEST(LoggingTest, testFormatCaptureHonorsStringPrecision)
+{
+    // no terminator anywhere in the buffer: a precision is the only thing bounding the read
+    char unterminated[8];
+    std::memset(unterminated, 'a', sizeof(unterminated));
+    unterminated[1] = 'b';
+    char terminated[8];
+    std::strcpy(terminated, "xy");
+
+    Aws::String record;
+    auto capture = [&record](const char* formatStr, ...)
+    {
+        va_list args;
+        va_start(args, formatStr);
+        bool captured = CaptureFormatArguments(formatStr, args, record);
+        va_end(args);
+        return captured;
+    };
+    ASSERT_TRUE(capture("[%.3s][%.*s][%5.*s][%-*.*s]", unterminated, 8, unterminated, 2, unterminated, 4, 2, unterminated));
+    ASSERT_TRUE(capture("[%.6s][%.*s]", terminated, -1, terminated));
+
+    Aws::String text;
+    const char* cursor = record.c_str();
+    const char* end = record.c_str() + record.size();
+    ASSERT_TRUE(FormatCapturedArguments(cursor, end, text));
+    ASSERT_EQ("[aba][abaaaaaa][   ab][ab  ]", text);
+    text.clear();
+    ASSERT_TRUE(FormatCapturedArguments(cursor, end, text));
+    ASSERT_EQ("[xy][xy]", text);
+    ASSERT_EQ(end, cursor);
+}
+
+TEST(LoggingTest, testBinaryLogDecodesToTextLayout)
+{
+    Aws::String longArgument(3000, 'y');
+    auto textStream = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    auto binaryStream = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    {
+        DefaultLogSystem text(LogLevel::Info, textStream);
+        // a tiny threshold flushes in between records and definitions
+        BinaryLogSystem binary(LogLevel::Info, binaryStream, 64);
+        LogMixedConversions(text, longArgument);
+        LogMixedConversions(binary, longArgument);
+
+        Aws::OStringStream message;
+        message << "streamed " << 17;
+        binary.LogStream(LogLevel::Warn, "StreamTag", message);
+        binary.Log(LogLevel::Error, "LoggingTest", "ints %d %i %u %x %X %o %hhd %hu %ld %lld %zu %%", 1, 2, 3u, 4u, 5u, 6u,
+            static_cast<signed char>(7), static_cast<unsigned short>(8), 9L, 10LL, static_cast<size_t>(11));
+    }
+
+    Aws::String encoded = binaryStream->str();
+    Aws::StringStream decodedStream;
+    Aws::StringStream input(encoded);
+    ASSERT_TRUE(DecodeBinaryLog(input, decodedStream));
+
+    Aws::Vector<Aws::String> textLines = StringUtils::SplitOnLine(textStream->str());
+    Aws::Vector<Aws::String> decodedLines = StringUtils::SplitOnLine(decodedStream.str());
+    ASSERT_EQ(5u, textLines.size());
+    ASSERT_EQ(7u, decodedLines.size());
+    for (size_t i = 0; i < textLines.size(); ++i)
+    {
+        ASSERT_EQ(0u, decodedLines[i].find("[INFO] "));
+        ASSERT_NE(Aws::String::npos, decodedLines[i].find(" LoggingTest ["));
+        ASSERT_EQ(StripLogPrefix(textLines[i]), StripLogPrefix(decodedLines[i]));
+    }
+    ASSERT_EQ(0u, decodedLines[5].find("[WARN] "));
+    ASSERT_EQ("streamed 17", StripLogPrefix(decodedLines[5]));
+    ASSERT_EQ("ints 1 2 3 4 5 6 7 8 9 10 11 %", StripLogPrefix(decodedLines[6]));
+
+    // after its first use a format string costs only its arguments
+    auto repeatedText = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    auto repeatedBinary = Aws::MakeShared<Aws::StringStream>(AllocationTag);
+    {
+        DefaultLogSystem text(LogLevel::Info, repeatedText);
+        BinaryLogSystem binary(LogLevel::Info, repeatedBinary);
+        for (int i = 0; i < 100; ++i)
+        {
+            text.Log(LogLevel::Info, "LoggingTest", "request %d finished with status %d after %d retries", i, 200, 0);
+            binary.Log(LogLevel::Info, "LoggingTest", "request %d finished with status %d after %d retries", i, 200, 0);
+        }
+    }
+    ASSERT_LT(repeatedBinary->str().size() * 2, repeatedText->str().size());
+
+    Aws::StringStream truncated(encoded.substr(0, encoded.size() - 3));
+    Aws::StringStream partial;
+    ASSERT_FALSE(DecodeBinaryLog(truncated, partial));
+    ASSERT_EQ(6u, StringUtils::SplitOnLine(partial.str()).size());
+
+    Aws::StringStream notBinary("[INFO] plain text log\n");
+    ASSERT_FALSE(DecodeBinaryLog(notBinary, partial));
+}
@@ -23,12 +23,20 @@
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/BufferPool.h>
+#include <aws/core/utils/memory/MemoryArena.h>
+#include <aws/core/utils/memory/TagProfilingMemorySystem.h>
+#include <aws/core/utils/memory/ThreadCachingMemorySystem.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/testing/mocks/http/MockHttpClient.h>
 
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
 TEST(MemoryTest, trivialTest)
 {
     AWS_BEGIN_MEMORY_TEST(16, 10)
@@ -139,3 +147,305 @@ TEST(MemoryTest, DefaultCredentialsProvider)
 
 }
 
+TEST(MemoryTest, ThreadCachingMemorySystemSizesAndAlignment)
+{
+    Aws::Utils::Memory::ThreadCachingMemorySystem memorySystem;
+
+    Aws::Vector<void*> blocks;
+    for (std::size_t size = 0; size <= Aws::Utils::Memory::ThreadCachingMemorySystem::GetMaxPooledBlockSize() + 64; size += 7)
+    {
+        void* memory = memorySystem.AllocateMemory(size, 1);
+        ASSERT_NE(nullptr, memory);
+        ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(memory) % 16);
+        memset(memory, static_cast<int>(size & 0xFF), size);
+        blocks.push_back(memory);
+    }
+
+    //blocks never overlap: every block still holds the pattern written into it.
+    std::size_t size = 0;
+    for (void* memory : blocks)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            ASSERT_EQ(static_cast<unsigned char>(size & 0xFF), static_cast<unsigned char*>(memory)[i]);
+        }
+        memorySystem.FreeMemory(memory);
+        size += 7;
+    }
+
+    void* overAligned = memorySystem.AllocateMemory(24, 64);
+    ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(overAligned) % 64);
+    memorySystem.FreeMemory(overAligned);
+
+    //freed blocks are reused rather than growing the pools.
+    std::size_t pooledBytes = memorySystem.GetPooledBytes();
+    for (int i = 0; i < 1000; ++i)
+    {
+        memorySystem.FreeMemory(memorySystem.AllocateMemory(40, 1));
+    }
+    ASSERT_EQ(pooledBytes, memorySystem.GetPooledBytes());
+}
+
+TEST(MemoryTest, ThreadCachingMemorySystemCrossThreadFrees)
+{
+    Aws::Utils::Memory::ThreadCachingMemorySystem memorySystem;
+
+    const std::size_t blockCount = 20000;
+    Aws::Vector<void*> blocks(blockCount, nullptr);
+
+    //one thread allocates, others free, so blocks migrate between thread caches and the central lists.
+    std::thread producer([&]()
+    {
+        for (std::size_t i = 0; i < blockCount; ++i)
+        {
+            blocks[i] = memorySystem.AllocateMemory(16 + (i % 300), 1);
+            *static_cast<std::size_t*>(blocks[i]) = i;
+        }
+    });
+    producer.join();
+
+    Aws::Vector<std::thread> consumers;
+    for (std::size_t t = 0; t < 4; ++t)
+    {
+        consumers.emplace_back([&, t]()
+        {
+            for (std::size_t i = t; i < blockCount; i += 4)
+            {
+                ASSERT_EQ(i, *static_cast<std::size_t*>(blocks[i]));
+                memorySystem.FreeMemory(blocks[i]);
+                memorySystem.FreeMemory(memorySystem.AllocateMemory(16 + (i % 300), 1));
+            }
+        });
+    }
+
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+}
+
+TEST(MemoryTest, ThreadCachingMemorySystemBacksSdkAllocations)
+{
+    Aws::Utils::Memory::ThreadCachingMemorySystem memorySystem;
+    std::size_t splitCount = 0;
+    std::string roundTripped;
+
+    //nothing may assert while the pool is installed, or it would be destroyed with allocations outstanding.
+    Aws::Utils::Memory::InitializeAWSMemorySystem(memorySystem);
+    {
+        Aws::Vector<Aws::String> splits = Aws::Utils::StringUtils::Split("test1,test2,test3,test4", ',');
+        splitCount = splits.size();
+
+        Aws::Utils::Json::JsonValue json;
+        json.WithString("IdentityPoolId", "SomeGUID");
+        roundTripped = Aws::Utils::Json::JsonValue(json.WriteCompact()).GetString("IdentityPoolId").c_str();
+    }
+    Aws::Utils::Memory::ShutdownAWSMemorySystem();
+
+    ASSERT_EQ(4u, splitCount);
+    ASSERT_EQ("SomeGUID", roundTripped);
+    ASSERT_GT(memorySystem.GetPooledBytes(), 0u);
+}
+
+
+TEST(MemoryTest, MemoryArenaBumpAllocation)
+{
+    Aws::Utils::Memory::MemoryArena arena(1024);
+
+    void* first = arena.AllocateMemory(10, 1);
+    void* second = arena.AllocateMemory(10, 1);
+    ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(first) % 16);
+    ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(second) % 16);
+    ASSERT_TRUE(arena.Owns(first));
+    ASSERT_TRUE(arena.Owns(second));
+    ASSERT_EQ(1u, arena.GetChunkCount());
+
+    //freeing the newest block hands its space to the next allocation; older blocks are only released with the arena.
+    arena.FreeMemory(second);
+    ASSERT_EQ(second, arena.AllocateMemory(10, 1));
+    arena.FreeMemory(first);
+    ASSERT_NE(first, arena.AllocateMemory(10, 1));
+
+    void* aligned = arena.AllocateMemory(8, 64);
+    ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(aligned) % 64);
+
+    void* large = arena.AllocateMemory(4096, 1);
+    ASSERT_TRUE(arena.Owns(large));
+    std::memset(large, 0xAB, 4096);
+    ASSERT_EQ(2u, arena.GetChunkCount());
+
+    int onStack = 0;
+    ASSERT_FALSE(arena.Owns(&onStack));
+    ASSERT_EQ(6u, arena.GetAllocationCount());
+}
+
+TEST(MemoryTest, ScopedMemoryArenaRoutesThreadAllocations)
+{
+    void* outside = nullptr;
+    void* inside = nullptr;
+    bool insideOwned = false;
+    bool outsideOwned = true;
+    bool stringOwned = false;
+    Aws::Utils::Memory::MemoryArena* installedArena = nullptr;
+
+    {
+        Aws::Utils::Memory::ScopedMemoryArena requestArena;
+        installedArena = Aws::Utils::Memory::GetThreadMemoryArena();
+        {
+            Aws::Utils::Memory::ArenaAllocationScope arenaScope;
+            inside = Aws::Malloc("ArenaTest", 32);
+        }
+        outside = Aws::Malloc("ArenaTest", 32);
+        insideOwned = requestArena.GetArena().Owns(inside);
+        outsideOwned = requestArena.GetArena().Owns(outside);
+
+        std::shared_ptr<Aws::String> serialized;
+        {
+            Aws::Utils::Memory::ArenaAllocationScope arenaScope;
+            serialized = Aws::MakeShared<Aws::String>("ArenaTest", 256, 'x');
+        }
+        stringOwned = requestArena.GetArena().Owns(serialized.get());
+        ASSERT_EQ(installedArena, &requestArena.GetArena());
+
+        //arena blocks freed after allocation has stopped being routed still find their way back to the arena.
+        Aws::Free(inside);
+        serialized = nullptr;
+
+        Aws::Utils::Memory::ScopedMemoryArena disabledArena(Aws::Utils::Memory::MemoryArena::DEFAULT_CHUNK_SIZE, false);
+        ASSERT_EQ(installedArena, Aws::Utils::Memory::GetThreadMemoryArena());
+    }
+
+    ASSERT_EQ(nullptr, Aws::Utils::Memory::GetThreadMemoryArena());
+    ASSERT_TRUE(insideOwned);
+    ASSERT_FALSE(outsideOwned);
+    ASSERT_TRUE(stringOwned);
+    Aws::Free(outside);
+
+    {
+        Aws::Utils::Memory::ArenaAllocationScope arenaScope;
+        ASSERT_EQ(nullptr, Aws::Utils::Memory::GetThreadAllocationArena());
+    }
+}
+
+TEST(MemoryTest, TagProfilingMemorySystemTracksTags)
+{
+    static const char* CLIENT_TAG = "ProfiledClient";
+    static const char* PARSER_TAG = "ProfiledParser";
+
+    Aws::Utils::Memory::TagProfilingMemorySystem profiler;
+    Aws::Utils::Memory::MemoryProfileSnapshot empty = profiler.TakeSnapshot();
+
+    void* clientBlock = profiler.AllocateMemory(100, 1, CLIENT_TAG);
+    void* parserBlock = profiler.AllocateMemory(300, 1, PARSER_TAG);
+    void* alignedBlock = profiler.AllocateMemory(40, 64, PARSER_TAG);
+    void* untagged = profiler.AllocateMemory(8, 1);
+    ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(clientBlock) % 16);
+    ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(alignedBlock) % 64);
+    std::memset(parserBlock, 0xCD, 300);
+
+    Aws::Utils::Memory::MemoryProfileSnapshot busy = profiler.TakeSnapshot();
+    ASSERT_EQ(448, busy.GetLiveBytes());
+    ASSERT_EQ(4, busy.GetLiveAllocations());
+    ASSERT_EQ(Aws::String(PARSER_TAG), busy.GetTags().front().tag);
+    ASSERT_EQ(340, busy.Find(PARSER_TAG)->liveBytes);
+    ASSERT_EQ(2, busy.Find(PARSER_TAG)->liveAllocations);
+    ASSERT_EQ(8, busy.Find(Aws::Utils::Memory::TagProfilingMemorySystem::UNTAGGED_TAG)->liveBytes);
+
+    profiler.FreeMemory(parserBlock);
+    profiler.FreeMemory(alignedBlock);
+    profiler.FreeMemory(untagged);
+
+    Aws::Utils::Memory::MemoryProfileSnapshot after = profiler.TakeSnapshot();
+    const Aws::Utils::Memory::TagMemoryStats* parserStats = after.Find(PARSER_TAG);
+    ASSERT_EQ(0, parserStats->liveBytes);
+    ASSERT_EQ(340, parserStats->highWaterBytes);
+    ASSERT_EQ(2, parserStats->totalAllocations);
+
+    Aws::Utils::Memory::MemoryProfileSnapshot growth = after.Diff(empty);
+    ASSERT_EQ(100, growth.GetLiveBytes());
+    ASSERT_EQ(Aws::String(CLIENT_TAG), growth.GetTags().front().tag);
+
+    Aws::Utils::Memory::MemoryProfileSnapshot released = after.Diff(busy);
+    ASSERT_EQ(-348, released.GetLiveBytes());
+    ASSERT_EQ(nullptr, released.Find(CLIENT_TAG));
+    ASSERT_NE(Aws::String::npos, after.ToString().find("ProfiledClient: live bytes 100"));
+
+    profiler.FreeMemory(clientBlock);
+    ASSERT_EQ(0, profiler.TakeSnapshot().GetLiveBytes());
+}
+
+TEST(MemoryTest, TagProfilingMemorySystemAttributesSdkAllocations)
+{
+    static const char* TEST_TAG = "TagProfilingTest";
+
+    Aws::Utils::Memory::ThreadCachingMemorySystem pool;
+    Aws::Utils::Memory::TagProfilingMemorySystem profiler(&pool);
+    int64_t liveWhileHeld = 0;
+    int64_t liveAfterRelease = -1;
+    auto liveBytesFor = [&profiler](const char* tag)
+    {
+        const Aws::Utils::Memory::TagMemoryStats* stats = profiler.TakeSnapshot().Find(tag);
+        return stats ? stats->liveBytes : -1;
+    };
+
+    //nothing may assert while the profiler is installed, or it would be destroyed with allocations outstanding.
+    Aws::Utils::Memory::InitializeAWSMemorySystem(profiler);
+    {
+        Aws::Vector<int>* held = Aws::New<Aws::Vector<int>>(TEST_TAG, 64);
+        liveWhileHeld = liveBytesFor(TEST_TAG);
+        Aws::Delete(held);
+        liveAfterRelease = liveBytesFor(TEST_TAG);
+    }
+    Aws::Utils::Memory::ShutdownAWSMemorySystem();
+
+    ASSERT_EQ(static_cast<int64_t>(sizeof(Aws::Vector<int>)), liveWhileHeld);
+    ASSERT_EQ(0, liveAfterRelease);
+}
+
+TEST(MemoryTest, BufferPoolSizeClassesAndRetention)
+{
+    Aws::Utils::Memory::BufferPool pool(64 * 1024, 40 * 1024, 2);
+
+    auto small = pool.Lease(100);
+    ASSERT_EQ(Aws::Utils::Memory::BufferPool::MIN_BUFFER_SIZE, small.GetCapacity());
+    auto medium = pool.Lease(5000);
+    ASSERT_EQ(8u * 1024u, medium.GetCapacity());
+    auto oversized = pool.Lease(100 * 1024);
+    ASSERT_EQ(100u * 1024u, oversized.GetCapacity());
+    std::memset(oversized.GetData(), 0, oversized.GetCapacity());
+
+    unsigned char* smallData = small.GetData();
+    small.Release();
+    ASSERT_FALSE(small);
+    auto reused = pool.Lease(4096);
+    ASSERT_EQ(smallData, reused.GetData());
+
+    //oversized buffers are never kept; the rest are bounded per class and by total bytes.
+    oversized.Release();
+    {
+        auto first = pool.Lease(32 * 1024);
+        auto second = pool.Lease(32 * 1024);
+    }
+    medium = Aws::Utils::Memory::PooledBuffer();
+    reused.Release();
+
+    Aws::Utils::Memory::BufferPoolStats stats = pool.GetStats();
+    ASSERT_EQ(1u, stats.hits);
+    ASSERT_EQ(5u, stats.misses);
+    ASSERT_EQ(3u, stats.retained);
+    ASSERT_EQ(3u, stats.dropped);
+    ASSERT_EQ(40u * 1024u, stats.retainedBytes);
+    ASSERT_DOUBLE_EQ(1.0 / 6.0, stats.GetHitRate());
+
+    pool.Trim();
+    ASSERT_EQ(0u, pool.GetStats().retainedBytes);
+
+    Aws::Utils::Memory::BufferPool singlePerClass(64 * 1024, 1024 * 1024, 1);
+    {
+        auto first = singlePerClass.Lease(10);
+        auto second = singlePerClass.Lease(10);
+    }
+    ASSERT_EQ(1u, singlePerClass.GetStats().retained);
+    ASSERT_EQ(1u, singlePerClass.GetStats().dropped);
+    ASSERT_EQ(4u * 1024u, singlePerClass.GetStats().retainedBytes);
+}
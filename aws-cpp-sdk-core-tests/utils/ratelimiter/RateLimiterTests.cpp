@@ -17,6 +17,12 @@
 #include <aws/testing/MemoryTesting.h>
 
 #include <aws/core/utils/ratelimiter/DefaultRateLimiter.h>
+#include <aws/core/utils/ratelimiter/AtomicRateLimiter.h>
+#include <aws/core/utils/ratelimiter/SharedMemoryRateLimiter.h>
+#include <aws/core/utils/UUID.h>
+
+#include <thread>
+#include <vector>
 
 using namespace Aws::Utils::RateLimits;
 
@@ -321,4 +327,194 @@ TEST_F(DefaultRateLimitTest, fractionalLimitTest)
     ASSERT_TRUE(delay.count() == 0);
 
     AWS_END_MEMORY_TEST
-}
\ No newline at end of file
+}
+
+using TestAtomicRateLimiter = AtomicRateLimiter<>;
+
+class AtomicRateLimitTest : public DefaultRateLimitTest
+{
+};
+
+TEST_F(AtomicRateLimitTest, doubleLimitTest)
+{
+    TestAtomicRateLimiter limiter(10, DefaultRateLimitTest::GetTestTime);
+
+    auto delay = limiter.ApplyCost(20);
+    ASSERT_EQ(0, delay.count());
+
+    delay = limiter.ApplyCost(0);
+    ASSERT_EQ(1000, delay.count());
+}
+
+TEST_F(AtomicRateLimitTest, delayedOverLimitTest)
+{
+    TestAtomicRateLimiter limiter(10, DefaultRateLimitTest::GetTestTime);
+    limiter.ApplyCost(10);
+
+    SetMillisecondsElapsed(500);
+
+    auto delay = limiter.ApplyCost(6);
+    ASSERT_EQ(0, delay.count());
+
+    delay = limiter.ApplyCost(0);
+    ASSERT_EQ(100, delay.count());
+
+    // a long idle period refills the bucket to one second's worth and no more
+    SetMillisecondsElapsed(100000);
+    ASSERT_EQ(0, limiter.ApplyCost(15).count());
+    ASSERT_EQ(500, limiter.ApplyCost(0).count());
+}
+
+TEST_F(AtomicRateLimitTest, rateChangePreservesDelayTest)
+{
+    // same steps as renormalizedChangeRateLimitTest
+    TestAtomicRateLimiter limiter(100, DefaultRateLimitTest::GetTestTime);
+
+    limiter.ApplyCost(700);
+    ASSERT_EQ(6000, limiter.ApplyCost(0).count());
+
+    SetMillisecondsElapsed(1000);
+    limiter.SetRate(10);
+    limiter.ApplyCost(5);
+    ASSERT_EQ(5500, limiter.ApplyCost(0).count());
+
+    SetMillisecondsElapsed(1200);
+    ASSERT_EQ(5300, limiter.ApplyCost(0).count());
+
+    SetMillisecondsElapsed(1400);
+    limiter.SetRate(100);
+    limiter.ApplyCost(60);
+
+    SetMillisecondsElapsed(2100);
+    ASSERT_EQ(5000, limiter.ApplyCost(0).count());
+}
+
+TEST_F(AtomicRateLimitTest, tryAcquireTest)
+{
+    TestAtomicRateLimiter limiter(100, DefaultRateLimitTest::GetTestTime);
+
+    ASSERT_TRUE(limiter.TryAcquire(150));
+    ASSERT_EQ(500, limiter.GetTimeUntilAvailable().count());
+    ASSERT_FALSE(limiter.TryAcquire(1));
+
+    // the failed attempt was not charged
+    SetMillisecondsElapsed(499);
+    ASSERT_EQ(1, limiter.GetTimeUntilAvailable().count());
+    ASSERT_FALSE(limiter.TryAcquire(1));
+
+    SetMillisecondsElapsed(500);
+    ASSERT_EQ(0, limiter.GetTimeUntilAvailable().count());
+    ASSERT_TRUE(limiter.TryAcquire(1));
+    ASSERT_FALSE(limiter.TryAcquire(1));
+}
+
+TEST_F(AtomicRateLimitTest, timeUntilAvailableRoundsUpTest)
+{
+    TestAtomicRateLimiter limiter(1000, DefaultRateLimitTest::GetTestTime);
+    limiter.ApplyCost(1000);
+    limiter.ApplyCost(1);
+
+    m_currentTime += std::chrono::microseconds(500);
+    ASSERT_EQ(0, limiter.ApplyCost(0).count());
+    ASSERT_EQ(1, limiter.GetTimeUntilAvailable().count());
+}
+
+TEST_F(AtomicRateLimitTest, defaultTryAcquireTest)
+{
+    TestDefaultRateLimiter limiter(10, DefaultRateLimitTest::GetTestTime);
+
+    ASSERT_TRUE(limiter.TryAcquire(20));
+    ASSERT_EQ(1000, limiter.GetTimeUntilAvailable().count());
+    ASSERT_FALSE(limiter.TryAcquire(1));
+    ASSERT_EQ(1000, limiter.GetTimeUntilAvailable().count());
+}
+
+TEST_F(AtomicRateLimitTest, concurrentCostsAreAllChargedTest)
+{
+    static const int THREADS = 8;
+    static const int CALLS_PER_THREAD = 1000;
+    TestAtomicRateLimiter limiter(1000, DefaultRateLimitTest::GetTestTime);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < THREADS; ++i)
+    {
+        threads.emplace_back([&limiter]()
+        {
+            for (int call = 0; call < CALLS_PER_THREAD; ++call)
+            {
+                limiter.ApplyCost(1);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // 8000 units against a full bucket of 1000 at 1000/s
+    ASSERT_EQ(7000, limiter.ApplyCost(0).count());
+}
+
+class SharedMemoryRateLimitTest : public ::testing::Test
+{
+public:
+
+    static SharedMemoryRateLimiter::InternalTimePointType GetTestTime() { return m_currentTime; }
+
+    static void SetMillisecondsElapsed(int64_t millisecondsElapsed)
+    {
+        // well past the clock epoch, so that a zeroed segment reads as a full bucket
+        m_currentTime = SharedMemoryRateLimiter::InternalTimePointType(std::chrono::seconds(1000) + std::chrono::milliseconds(millisecondsElapsed));
+    }
+
+protected:
+
+    void SetUp()
+    {
+        SetMillisecondsElapsed(0);
+        m_name = "aws-sdk-cpp-test-" + Aws::String(Aws::Utils::UUID::RandomUUID());
+    }
+
+    void TearDown()
+    {
+        SharedMemoryRateLimiter::Remove(m_name.c_str());
+    }
+
+    static SharedMemoryRateLimiter::InternalTimePointType m_currentTime;
+    Aws::String m_name;
+};
+
+SharedMemoryRateLimiter::InternalTimePointType SharedMemoryRateLimitTest::m_currentTime;
+
+TEST_F(SharedMemoryRateLimitTest, limitersWithTheSameNameShareABudgetTest)
+{
+    SharedMemoryRateLimiter first(m_name.c_str(), 100, SharedMemoryRateLimitTest::GetTestTime);
+    SharedMemoryRateLimiter second(m_name.c_str(), 100, SharedMemoryRateLimitTest::GetTestTime);
+    ASSERT_TRUE(first.IsShared());
+    ASSERT_TRUE(second.IsShared());
+
+    ASSERT_TRUE(first.TryAcquire(150));
+    ASSERT_FALSE(second.TryAcquire(1));
+    ASSERT_EQ(500, second.GetTimeUntilAvailable().count());
+
+    SetMillisecondsElapsed(500);
+    ASSERT_TRUE(second.TryAcquire(50));
+    ASSERT_EQ(500, first.GetTimeUntilAvailable().count());
+}
+
+TEST_F(SharedMemoryRateLimitTest, outstandingCostOutlivesTheLimiterTest)
+{
+    {
+        // stands in for a worker process that exits without any cleanup
+        SharedMemoryRateLimiter worker(m_name.c_str(), 100, SharedMemoryRateLimitTest::GetTestTime);
+        worker.ApplyCost(300);
+    }
+
+    SharedMemoryRateLimiter replacement(m_name.c_str(), 100, SharedMemoryRateLimitTest::GetTestTime);
+    ASSERT_EQ(2000, replacement.ApplyCost(0).count());
+
+    ASSERT_TRUE(SharedMemoryRateLimiter::Remove(m_name.c_str()));
+    SharedMemoryRateLimiter fresh(m_name.c_str(), 100, SharedMemoryRateLimitTest::GetTestTime);
+    ASSERT_EQ(0, fresh.ApplyCost(100).count());
+    ASSERT_EQ(2000, replacement.ApplyCost(0).count());
+}
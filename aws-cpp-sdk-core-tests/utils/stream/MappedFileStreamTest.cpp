@@ -0,0 +1,73 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/stream/MappedFileStream.h>
+#include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+TEST(MappedFileStreamTest, TestReadAndSeek)
+{
+    TempFile file(std::ios_base::out | std::ios_base::trunc);
+    ASSERT_TRUE(file.good());
+    file << "mapped file contents";
+    file.flush();
+
+    MappedFileStream stream(file.GetFileName().c_str());
+    ASSERT_TRUE(stream.IsMapped());
+    ASSERT_TRUE(stream.good());
+    ASSERT_EQ(20u, stream.GetLength());
+
+    stream.seekg(0, std::ios_base::end);
+    ASSERT_EQ(20, static_cast<int>(stream.tellg()));
+    stream.seekg(0, std::ios_base::beg);
+
+    Aws::String word;
+    stream >> word;
+    ASSERT_EQ("mapped", word);
+
+    //rewinding works the way signers and retries use it.
+    Aws::String all;
+    stream.seekg(0);
+    std::getline(stream, all);
+    ASSERT_EQ("mapped file contents", all);
+    stream.clear();
+    stream.seekg(7);
+    stream >> word;
+    ASSERT_EQ("file", word);
+
+    //the mapping is read-only.
+    stream << "x";
+    ASSERT_TRUE(stream.bad());
+}
+
+TEST(MappedFileStreamTest, TestEmptyAndMissingFiles)
+{
+    TempFile file(std::ios_base::out | std::ios_base::trunc);
+    ASSERT_TRUE(file.good());
+
+    MappedFileStream empty(file.GetFileName().c_str());
+    ASSERT_TRUE(empty.IsMapped());
+    ASSERT_EQ(0u, empty.GetLength());
+    ASSERT_EQ(std::char_traits<char>::eof(), empty.peek());
+
+    MappedFileStream missing("this/file/does/not/exist");
+    ASSERT_FALSE(missing.IsMapped());
+    ASSERT_TRUE(missing.bad());
+}
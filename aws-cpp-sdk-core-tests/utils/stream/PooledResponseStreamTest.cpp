@@ -0,0 +1,93 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/stream/PooledResponseStream.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/StringUtils.h>
+
+using namespace Aws::Utils::Memory;
+using namespace Aws::Utils::Stream;
+
+TEST(PooledResponseStreamTest, TestGrowsAndReadsBack)
+{
+    BufferPool pool;
+    Aws::String body;
+    for (int i = 0; i < 4000; ++i)
+    {
+        body += "line " + Aws::Utils::StringUtils::to_string(i) + "\n";
+    }
+
+    {
+        PooledResponseStream stream(pool);
+        stream << "first";
+        stream.write(body.c_str(), body.size());
+        stream.put('!');
+        ASSERT_EQ(5 + body.size() + 1, stream.GetSize());
+
+        Aws::String first(5, '\0');
+        stream.read(&first[0], 5);
+        ASSERT_EQ("first", first);
+
+        Aws::String rest(body.size(), '\0');
+        stream.read(&rest[0], rest.size());
+        ASSERT_EQ(body, rest);
+        ASSERT_EQ('!', stream.get());
+        ASSERT_EQ(std::char_traits<char>::eof(), stream.get());
+
+        stream.clear();
+        stream.seekg(0, std::ios_base::beg);
+        ASSERT_EQ('f', stream.get());
+        stream.seekg(-1, std::ios_base::end);
+        ASSERT_EQ('!', stream.get());
+        stream.clear();
+        stream.seekg(static_cast<std::streamoff>(stream.GetSize() + 1));
+        ASSERT_TRUE(stream.fail());
+    }
+
+    //growing leased a 64KB buffer and handed the first 4KB one back; both are retained once the stream is gone.
+    BufferPoolStats stats = pool.GetStats();
+    ASSERT_EQ(2u, stats.misses);
+    ASSERT_EQ(2u, stats.retained);
+    ASSERT_EQ(68u * 1024u, stats.retainedBytes);
+
+    uint64_t missesBefore = stats.misses;
+    {
+        PooledResponseStream stream(pool);
+        stream << "reuse";
+        Aws::String read;
+        stream >> read;
+        ASSERT_EQ("reuse", read);
+    }
+    ASSERT_EQ(missesBefore, pool.GetStats().misses);
+}
+
+TEST(PooledResponseStreamTest, TestEmptyStreamLeasesNothing)
+{
+    BufferPool pool;
+    {
+        PooledResponseStream stream(pool);
+        ASSERT_EQ(0u, stream.GetSize());
+        ASSERT_EQ(std::char_traits<char>::eof(), stream.get());
+    }
+
+    ASSERT_EQ(0u, pool.GetStats().misses);
+
+    Aws::IOStream* fromFactory = BuildPooledResponseStreamFactory(pool)();
+    *fromFactory << "payload";
+    Aws::Delete(fromFactory);
+    ASSERT_EQ(1u, pool.GetStats().retained);
+}
@@ -0,0 +1,116 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+#include <aws/core/utils/stream/ByteBufferStream.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstring>
+
+using namespace Aws::Utils::Stream;
+
+TEST(PreallocatedStreamBufTest, TestReadAndRewind)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    unsigned char buffer[] = "hello world";
+    PreallocatedStreamBuf streamBuf(buffer, 11);
+    Aws::IOStream stream(&streamBuf);
+
+    Aws::String first;
+    stream >> first;
+    ASSERT_EQ("hello", first);
+
+    stream.seekg(0, std::ios_base::end);
+    ASSERT_EQ(11, static_cast<int>(stream.tellg()));
+
+    //reading to the end sets eof; a retry clears it and seeks back to the start.
+    Aws::String all;
+    stream.seekg(0);
+    std::getline(stream, all);
+    ASSERT_EQ("hello world", all);
+    ASSERT_TRUE(stream.eof());
+
+    stream.clear();
+    stream.seekg(6);
+    Aws::String second;
+    stream >> second;
+    ASSERT_EQ("world", second);
+
+    stream.clear();
+    ASSERT_EQ(-1, static_cast<int>(stream.seekg(12).tellg()));
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(PreallocatedStreamBufTest, TestWriteStaysInBuffer)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    unsigned char buffer[8];
+    memset(buffer, 0, sizeof(buffer));
+    PreallocatedStreamBuf streamBuf(buffer, sizeof(buffer));
+    Aws::IOStream stream(&streamBuf);
+
+    stream << "abcd";
+    ASSERT_EQ(0, memcmp(buffer, "abcd", 4));
+    ASSERT_TRUE(stream.good());
+
+    stream.seekp(2);
+    stream << "XY";
+    ASSERT_EQ(0, memcmp(buffer, "abXY", 4));
+
+    //the buffer never grows, so writing past its end fails instead of reallocating.
+    stream.seekp(6);
+    stream << "123";
+    ASSERT_TRUE(stream.bad());
+    ASSERT_EQ(streamBuf.GetBuffer(), buffer);
+    ASSERT_EQ(sizeof(buffer), streamBuf.GetLength());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(PreallocatedStreamBufTest, TestByteBufferStream)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::Utils::ByteBuffer buffer(reinterpret_cast<const unsigned char*>("payload"), 7);
+    ByteBufferStream stream(buffer);
+    ASSERT_EQ(7u, stream.GetLength());
+
+    Aws::String read;
+    stream >> read;
+    ASSERT_EQ("payload", read);
+
+    //writes land in the caller's buffer.
+    stream.clear();
+    stream.seekp(0);
+    stream << "P";
+    ASSERT_EQ('P', buffer[0]);
+
+    const unsigned char readOnly[] = { 'a', 'b', 'c' };
+    ByteBufferStream readOnlyStream(readOnly, sizeof(readOnly));
+    ASSERT_EQ('a', readOnlyStream.get());
+    readOnlyStream << "z";
+    ASSERT_TRUE(readOnlyStream.bad());
+    ASSERT_EQ('a', readOnly[0]);
+
+    AWS_END_MEMORY_TEST
+}
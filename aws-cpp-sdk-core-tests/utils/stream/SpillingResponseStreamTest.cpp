@@ -0,0 +1,91 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/stream/SpillingResponseStream.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+using namespace Aws::Utils::Stream;
+
+TEST(SpillingResponseStreamTest, TestSmallBodyStaysInMemory)
+{
+    ResponseMemoryBudget budget(1024);
+    {
+        SpillingResponseStream stream(64, budget);
+        stream << "small body";
+        ASSERT_FALSE(stream.HasSpilled());
+        ASSERT_EQ(10u, budget.GetBytesInUse());
+
+        Aws::String read;
+        std::getline(stream, read);
+        ASSERT_EQ("small body", read);
+    }
+
+    ASSERT_EQ(0u, budget.GetBytesInUse());
+}
+
+TEST(SpillingResponseStreamTest, TestLargeBodySpillsAndReadsBack)
+{
+    ResponseMemoryBudget budget(1024);
+    SpillingResponseStream stream(16, budget);
+
+    Aws::StringStream expected;
+    for (int i = 0; i < 2000; ++i)
+    {
+        expected << "line " << i << "\n";
+    }
+    Aws::String expectedBody = expected.str();
+
+    stream.write(expectedBody.c_str(), 8);
+    ASSERT_FALSE(stream.HasSpilled());
+    stream.write(expectedBody.c_str() + 8, expectedBody.size() - 8);
+    ASSERT_TRUE(stream.good());
+    ASSERT_TRUE(stream.HasSpilled());
+    ASSERT_EQ(0u, budget.GetBytesInUse());
+
+    Aws::StringStream actual;
+    actual << stream.rdbuf();
+    ASSERT_EQ(expectedBody, actual.str());
+
+    //seeks work the same after spilling.
+    stream.clear();
+    stream.seekg(0, std::ios_base::end);
+    ASSERT_EQ(static_cast<std::streamoff>(expectedBody.size()), static_cast<std::streamoff>(stream.tellg()));
+    stream.seekg(5);
+    int lineNumber = -1;
+    stream >> lineNumber;
+    ASSERT_EQ(0, lineNumber);
+}
+
+TEST(SpillingResponseStreamTest, TestBudgetIsSharedAcrossStreams)
+{
+    ResponseMemoryBudget budget(20);
+
+    SpillingResponseStream first(1024, budget);
+    first << "0123456789abcdef";
+    ASSERT_FALSE(first.HasSpilled());
+    ASSERT_EQ(16u, budget.GetBytesInUse());
+
+    //the second stream is far under its own threshold, but the shared budget is exhausted.
+    SpillingResponseStream second(1024, budget);
+    second << "0123456789";
+    ASSERT_TRUE(second.HasSpilled());
+    ASSERT_EQ(16u, budget.GetBytesInUse());
+
+    Aws::String read;
+    second >> read;
+    ASSERT_EQ("0123456789", read);
+}
@@ -0,0 +1,65 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/stream/StringOutputStream.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+TEST(StringOutputStreamTest, TestWritesAppendToTheString)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    StringOutputStream ss;
+    ss << "Action=SendMessageBatch&" << "Entry." << 12u << ".DelaySeconds=" << -3 << "&";
+    ss.put('x');
+    ss.write("yz", 2);
+    ASSERT_TRUE(ss.good());
+    ASSERT_EQ("Action=SendMessageBatch&Entry.12.DelaySeconds=-3&xyz", ss.GetString());
+
+    Aws::String taken = ss.TakeString();
+    ASSERT_EQ("Action=SendMessageBatch&Entry.12.DelaySeconds=-3&xyz", taken);
+    ASSERT_TRUE(ss.GetString().empty());
+
+    ss << "Version=2012-11-05";
+    ASSERT_EQ("Version=2012-11-05", ss.TakeString());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(StringOutputStreamTest, TestURLEncodedInsertionMatchesURLEncode)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    //long runs on both sides, and more escapes in a row than are written out at once.
+    Aws::String unsafe = "abcdefghijklmnopqrstuvwxyz0123456789 tail/" + Aws::String(40, '&') + "\xC3\xA9-_.~end";
+    Aws::String expected = StringUtils::URLEncode(unsafe.c_str());
+
+    StringOutputStream ss(0);
+    ss << "MessageBody=" << StringUtils::URLEncoded(unsafe) << "&";
+    ASSERT_EQ("MessageBody=" + expected + "&", ss.GetString());
+
+    //any other stream gets the same bytes.
+    Aws::StringStream other;
+    other << "MessageBody=" << StringUtils::URLEncoded(unsafe) << "&" << StringUtils::URLEncoded(Aws::String());
+    ASSERT_EQ(ss.GetString(), other.str());
+
+    AWS_END_MEMORY_TEST
+}
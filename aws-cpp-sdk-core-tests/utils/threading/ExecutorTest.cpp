@@ -0,0 +1,174 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+namespace
+{
+    // stands in for a large batch request: counts deep copies
+    struct CopyCountingRequest
+    {
+        CopyCountingRequest(std::atomic<int>& copies) : m_copies(&copies), m_entries(500, 'x') {}
+        CopyCountingRequest(const CopyCountingRequest& other) : m_copies(other.m_copies), m_entries(other.m_entries) { ++*m_copies; }
+        CopyCountingRequest(CopyCountingRequest&& other) : m_copies(other.m_copies), m_entries(std::move(other.m_entries)) {}
+
+        std::atomic<int>* m_copies;
+        Aws::String m_entries;
+    };
+
+    size_t CountEntries(const CopyCountingRequest& request)
+    {
+        return request.m_entries.size();
+    }
+
+    class RejectingExecutor : public Executor
+    {
+    protected:
+        bool SubmitToThread(std::function<void()>&&) override { return false; }
+    };
+}
+
+TEST(ExecutorTest, SubmitCallableRunsOnThePool)
+{
+    static const int CALLS = 200;
+    std::mutex threadsLock;
+    Aws::Set<std::thread::id> threads;
+    {
+        PooledThreadExecutor executor(2);
+        Aws::Vector<std::future<int>> results;
+        for (int i = 0; i < CALLS; ++i)
+        {
+            results.push_back(executor.SubmitCallable([i, &threadsLock, &threads]()
+            {
+                std::lock_guard<std::mutex> locker(threadsLock);
+                threads.insert(std::this_thread::get_id());
+                return i * 2;
+            }));
+        }
+
+        for (int i = 0; i < CALLS; ++i)
+        {
+            ASSERT_EQ(i * 2, results[i].get());
+        }
+    }
+
+    ASSERT_LE(threads.size(), 2u);
+    ASSERT_EQ(0u, threads.count(std::this_thread::get_id()));
+}
+
+TEST(ExecutorTest, DefaultClientExecutorIsBounded)
+{
+    static const size_t CALLS = Aws::Client::ClientConfiguration::DEFAULT_EXECUTOR_POOL_SIZE * 4;
+    std::mutex threadsLock;
+    Aws::Set<std::thread::id> threads;
+    {
+        Aws::Client::ClientConfiguration configuration;
+        Aws::Vector<std::future<void>> results;
+        for (size_t i = 0; i < CALLS; ++i)
+        {
+            results.push_back(configuration.executor->SubmitCallable([&threadsLock, &threads]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                std::lock_guard<std::mutex> locker(threadsLock);
+                threads.insert(std::this_thread::get_id());
+            }));
+        }
+
+        for (auto& result : results)
+        {
+            result.get();
+        }
+    }
+
+    ASSERT_LE(threads.size(), static_cast<size_t>(Aws::Client::ClientConfiguration::DEFAULT_EXECUTOR_POOL_SIZE));
+    ASSERT_EQ(0u, threads.count(std::this_thread::get_id()));
+}
+
+TEST(ExecutorTest, SubmitCallableRunsInlineWhenRejected)
+{
+    RejectingExecutor executor;
+    std::thread::id ranOn;
+    std::future<void> result = executor.SubmitCallable([&ranOn]() { ranOn = std::this_thread::get_id(); });
+
+    ASSERT_EQ(std::future_status::ready, result.wait_for(std::chrono::seconds(0)));
+    ASSERT_EQ(std::this_thread::get_id(), ranOn);
+}
+
+TEST(ExecutorTest, RejectImmediatelyPoolAcceptsWhileQueueHasRoom)
+{
+    PooledThreadExecutor executor(1, OverflowPolicy::REJECT_IMMEDIATELY);
+    std::future<std::thread::id> ranOn = executor.SubmitCallable([]() { return std::this_thread::get_id(); });
+
+    ASSERT_NE(std::this_thread::get_id(), ranOn.get());
+}
+
+TEST(ExecutorTest, MovedRequestsAreNotCopiedOnDispatch)
+{
+    std::atomic<int> copies(0);
+    std::atomic<size_t> asyncEntries(0);
+    {
+        PooledThreadExecutor executor(1);
+
+        // the shape generated *Callable(Request&&) and *Async(Request&&) overloads use
+        CopyCountingRequest callableRequest(copies);
+        std::future<size_t> result = executor.SubmitCallable(std::bind(&CountEntries, std::move(callableRequest)));
+        ASSERT_EQ(500u, result.get());
+
+        CopyCountingRequest asyncRequest(copies);
+        std::promise<void> done;
+        executor.Submit([&asyncEntries, &done](const CopyCountingRequest& request)
+        {
+            asyncEntries = CountEntries(request);
+            done.set_value();
+        }, std::move(asyncRequest));
+        done.get_future().wait();
+    }
+
+    ASSERT_EQ(500u, asyncEntries.load());
+    ASSERT_EQ(0, copies.load());
+}
+
+TEST(ExecutorTest, MovedRequestsAreNotCopiedOnDefaultExecutorDispatch)
+{
+    std::atomic<int> copies(0);
+    DefaultExecutor executor;
+
+    CopyCountingRequest callableRequest(copies);
+    std::future<size_t> result = executor.SubmitCallable(std::bind(&CountEntries, std::move(callableRequest)));
+    ASSERT_EQ(500u, result.get());
+
+    // the detached thread may outlive this test, so it only touches state it shares ownership of
+    auto asyncEntries = Aws::MakeShared<std::promise<size_t>>("ExecutorTest");
+    CopyCountingRequest asyncRequest(copies);
+    executor.Submit([asyncEntries](const CopyCountingRequest& request)
+    {
+        asyncEntries->set_value(CountEntries(request));
+    }, std::move(asyncRequest));
+
+    ASSERT_EQ(500u, asyncEntries->get_future().get());
+    ASSERT_EQ(0, copies.load());
+}
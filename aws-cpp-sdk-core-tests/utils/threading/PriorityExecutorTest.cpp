@@ -0,0 +1,235 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/threading/PriorityExecutor.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+namespace
+{
+    bool WaitForCount(const std::atomic<int>& counter, int expected)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (counter.load() < expected)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    // holds the only worker of a pool so the test can line up queued tasks
+    class Gate
+    {
+    public:
+        Gate() : m_entered(false), m_open(false) {}
+
+        void EnterAndWait()
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_entered = true;
+            m_signal.notify_all();
+            m_signal.wait(locker, [this]() { return m_open; });
+        }
+
+        void WaitUntilEntered()
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_signal.wait(locker, [this]() { return m_entered; });
+        }
+
+        void Open()
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_open = true;
+            m_signal.notify_all();
+        }
+
+    private:
+        std::mutex m_lock;
+        std::condition_variable m_signal;
+        bool m_entered;
+        bool m_open;
+    };
+
+    class OrderRecorder
+    {
+    public:
+        std::function<void()> Task(char name)
+        {
+            return [this, name]()
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                m_order.push_back(name);
+                ++m_count;
+            };
+        }
+
+        Aws::String GetOrder()
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_order;
+        }
+
+        std::atomic<int> m_count{0};
+
+    private:
+        std::mutex m_lock;
+        Aws::String m_order;
+    };
+}
+
+TEST(PriorityExecutorTest, LatencyHistogramBucketsByPowerOfTwo)
+{
+    LatencyHistogram histogram;
+    histogram.Record(std::chrono::microseconds(0));
+    histogram.Record(std::chrono::microseconds(1));
+    histogram.Record(std::chrono::microseconds(3));
+    histogram.Record(std::chrono::microseconds(1000));
+
+    LatencyHistogramSnapshot snapshot = histogram.GetSnapshot();
+    ASSERT_EQ(4u, snapshot.GetCount());
+    ASSERT_EQ(1u, snapshot.counts[0]);
+    ASSERT_EQ(1u, snapshot.counts[1]);
+    ASSERT_EQ(1u, snapshot.counts[2]);
+    ASSERT_EQ(1u, snapshot.counts[10]);
+    ASSERT_EQ(4u, snapshot.GetPercentileUpperBoundMicros(75));
+    ASSERT_EQ(1024u, snapshot.GetPercentileUpperBoundMicros(100));
+    ASSERT_EQ(0u, LatencyHistogramSnapshot().GetPercentileUpperBoundMicros(50));
+}
+
+TEST(PriorityExecutorTest, RunsMoreUrgentLanesFirst)
+{
+    Gate gate;
+    OrderRecorder recorder;
+    PriorityExecutor executor(1, 0, BackpressurePolicy::Block, 0);
+    ASSERT_TRUE(executor.Submit([&gate]() { gate.EnterAndWait(); }));
+    gate.WaitUntilEntered();
+
+    {
+        ScopedTaskPriority bulk(TaskPriority::Low);
+        ASSERT_TRUE(executor.Submit(recorder.Task('L')));
+        {
+            ScopedTaskPriority interactive(TaskPriority::High);
+            ASSERT_TRUE(executor.Submit(recorder.Task('H')));
+        }
+        ASSERT_EQ(TaskPriority::Low, ScopedTaskPriority::GetCurrent());
+    }
+    ASSERT_TRUE(executor.Submit(recorder.Task('N')));
+    ASSERT_TRUE(executor.SubmitWithPriority(TaskPriority::High, recorder.Task('h')));
+
+    PriorityExecutorMetrics metrics = executor.GetMetrics();
+    ASSERT_EQ(2u, metrics.queueDepth[static_cast<size_t>(TaskPriority::High)]);
+    ASSERT_EQ(1u, metrics.queueDepth[static_cast<size_t>(TaskPriority::Normal)]);
+    ASSERT_EQ(1u, metrics.queueDepth[static_cast<size_t>(TaskPriority::Low)]);
+
+    gate.Open();
+    ASSERT_TRUE(WaitForCount(recorder.m_count, 4));
+    ASSERT_EQ("HhNL", recorder.GetOrder());
+
+    metrics = executor.GetMetrics();
+    ASSERT_EQ(5u, metrics.submitted);
+    ASSERT_EQ(5u, metrics.queueWait.GetCount());
+}
+
+TEST(PriorityExecutorTest, StarvationGuardLetsBulkWorkThrough)
+{
+    Gate gate;
+    OrderRecorder recorder;
+    // the gate task is the first pick, so the third pick is the one that goes to the least urgent lane
+    PriorityExecutor executor(1, 0, BackpressurePolicy::Block, 3);
+    ASSERT_TRUE(executor.Submit([&gate]() { gate.EnterAndWait(); }));
+    gate.WaitUntilEntered();
+
+    ASSERT_TRUE(executor.SubmitWithPriority(TaskPriority::Low, recorder.Task('L')));
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(executor.SubmitWithPriority(TaskPriority::High, recorder.Task('H')));
+    }
+
+    gate.Open();
+    ASSERT_TRUE(WaitForCount(recorder.m_count, 4));
+    ASSERT_EQ("HLHH", recorder.GetOrder());
+}
+
+TEST(PriorityExecutorTest, BoundedQueueAppliesBackpressurePolicy)
+{
+    std::atomic<int> completed(0);
+    {
+        Gate gate;
+        PriorityExecutor executor(1, 1, BackpressurePolicy::Reject);
+        ASSERT_TRUE(executor.Submit([&gate]() { gate.EnterAndWait(); }));
+        gate.WaitUntilEntered();
+        ASSERT_TRUE(executor.Submit([&completed]() { ++completed; }));
+        ASSERT_FALSE(executor.Submit([&completed]() { ++completed; }));
+        ASSERT_EQ(1u, executor.GetMetrics().rejected);
+        gate.Open();
+        ASSERT_TRUE(WaitForCount(completed, 1));
+    }
+
+    {
+        Gate gate;
+        PriorityExecutor executor(1, 1, BackpressurePolicy::CallerRuns);
+        ASSERT_TRUE(executor.Submit([&gate]() { gate.EnterAndWait(); }));
+        gate.WaitUntilEntered();
+        ASSERT_TRUE(executor.Submit([&completed]() { ++completed; }));
+
+        std::thread::id ranOn;
+        ASSERT_TRUE(executor.Submit([&ranOn]() { ranOn = std::this_thread::get_id(); }));
+        ASSERT_EQ(std::this_thread::get_id(), ranOn);
+        ASSERT_EQ(1u, executor.GetMetrics().ranOnCaller);
+        gate.Open();
+        ASSERT_TRUE(WaitForCount(completed, 2));
+    }
+
+    {
+        Gate gate;
+        PriorityExecutor executor(1, 1, BackpressurePolicy::Block);
+        ASSERT_TRUE(executor.Submit([&gate]() { gate.EnterAndWait(); }));
+        gate.WaitUntilEntered();
+        ASSERT_TRUE(executor.Submit([&completed]() { ++completed; }));
+
+        std::atomic<int> submitted(0);
+        std::thread producer([&executor, &completed, &submitted]()
+        {
+            executor.Submit([&completed]() { ++completed; });
+            ++submitted;
+        });
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (executor.GetMetrics().blockedSubmissions == 0 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+        ASSERT_EQ(1u, executor.GetMetrics().blockedSubmissions);
+        ASSERT_EQ(0, submitted.load());
+
+        gate.Open();
+        producer.join();
+        ASSERT_TRUE(WaitForCount(completed, 4));
+        ASSERT_EQ(1, submitted.load());
+    }
+}
@@ -0,0 +1,171 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/threading/WorkStealingExecutor.h>
+#include <aws/core/utils/threading/SmallTask.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+namespace
+{
+    // waits for a counter with a generous timeout so a hang fails the test instead of the run
+    bool WaitForCount(const std::atomic<int>& counter, int expected)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (counter.load() < expected)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    class Gate
+    {
+    public:
+        Gate() : m_entered(false), m_open(false) {}
+
+        void EnterAndWait()
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_entered = true;
+            m_signal.notify_all();
+            m_signal.wait(locker, [this]() { return m_open; });
+        }
+
+        void WaitUntilEntered()
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_signal.wait(locker, [this]() { return m_entered; });
+        }
+
+        void Open()
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_open = true;
+            m_signal.notify_all();
+        }
+
+    private:
+        std::mutex m_lock;
+        std::condition_variable m_signal;
+        bool m_entered;
+        bool m_open;
+    };
+}
+
+TEST(WorkStealingExecutorTest, SmallTaskKeepsSmallFunctorsInline)
+{
+    int calls = 0;
+    SmallTask small([&calls]() { ++calls; });
+    ASSERT_TRUE(static_cast<bool>(small));
+    ASSERT_FALSE(small.IsHeapAllocated());
+
+    char large[SmallTask::INLINE_SIZE * 2] = { 1 };
+    SmallTask big([&calls, large]() { calls += large[0]; });
+    ASSERT_TRUE(big.IsHeapAllocated());
+
+    SmallTask wrapped(std::function<void()>([&calls]() { calls += 10; }));
+    ASSERT_FALSE(wrapped.IsHeapAllocated());
+
+    SmallTask moved(std::move(big));
+    ASSERT_FALSE(static_cast<bool>(big));
+    small();
+    moved();
+    wrapped();
+    ASSERT_EQ(12, calls);
+
+    moved = std::move(small);
+    moved();
+    ASSERT_EQ(13, calls);
+}
+
+TEST(WorkStealingExecutorTest, RunsEverySubmittedTask)
+{
+    static const int SUBMITTERS = 4;
+    static const int TASKS_PER_SUBMITTER = 2000;
+    std::atomic<int> completed(0);
+    {
+        WorkStealingExecutor executor(3);
+        Aws::Vector<std::thread> submitters;
+        for (int i = 0; i < SUBMITTERS; ++i)
+        {
+            submitters.emplace_back([&executor, &completed]()
+            {
+                for (int j = 0; j < TASKS_PER_SUBMITTER; ++j)
+                {
+                    ASSERT_TRUE(executor.Submit([&completed]() { ++completed; }));
+                }
+            });
+        }
+        for (auto& submitter : submitters)
+        {
+            submitter.join();
+        }
+        ASSERT_TRUE(WaitForCount(completed, SUBMITTERS * TASKS_PER_SUBMITTER));
+    }
+    ASSERT_EQ(SUBMITTERS * TASKS_PER_SUBMITTER, completed.load());
+}
+
+TEST(WorkStealingExecutorTest, IdleWorkersStealFromABusyWorker)
+{
+    static const int CHILDREN = 16;
+    std::atomic<int> completed(0);
+    WorkStealingExecutor executor(2);
+
+    // the parent queues its children on its own deque and then blocks until they finish, so only a thief can run them
+    std::atomic<int> parentDone(0);
+    executor.Post([&executor, &completed, &parentDone]()
+    {
+        for (int i = 0; i < CHILDREN; ++i)
+        {
+            executor.Post([&completed]() { ++completed; });
+        }
+        WaitForCount(completed, CHILDREN);
+        ++parentDone;
+    });
+
+    ASSERT_TRUE(WaitForCount(parentDone, 1));
+    ASSERT_EQ(CHILDREN, completed.load());
+    ASSERT_GE(executor.GetStealCount(), static_cast<size_t>(CHILDREN));
+}
+
+TEST(WorkStealingExecutorTest, RejectsWhenQueueIsFull)
+{
+    Gate gate;
+    std::atomic<int> completed(0);
+    {
+        WorkStealingExecutor executor(1, OverflowPolicy::REJECT_IMMEDIATELY);
+        ASSERT_TRUE(executor.Submit([&gate]() { gate.EnterAndWait(); }));
+        gate.WaitUntilEntered();
+
+        ASSERT_TRUE(executor.Submit([&completed]() { ++completed; }));
+        ASSERT_FALSE(executor.Submit([&completed]() { ++completed; }));
+
+        gate.Open();
+        ASSERT_TRUE(WaitForCount(completed, 1));
+    }
+    ASSERT_EQ(1, completed.load());
+}
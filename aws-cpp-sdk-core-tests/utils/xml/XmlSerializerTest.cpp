@@ -110,3 +110,54 @@ TEST(XmlSerializerTest, TestXmlHasChildren)
     AWS_END_MEMORY_TEST
 }
     
+
+TEST(XmlSerializerTest, TestXmlNodeViews)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    const char* testXml = "<?xml version=\"1.0\" ?>\n"
+        "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">\n"
+        "<Key>  a &amp; &lt;b&gt; &quot;c&quot; </Key>\n"
+        "<Size>1024</Size>\n"
+        "<Empty></Empty>\n"
+        "<Mixed>text <b>bold</b></Mixed>\n"
+        "</ListBucketResult>";
+
+    XmlDocument doc = XmlDocument::CreateFromXmlString(testXml);
+    ASSERT_TRUE(doc.WasParseSuccessful());
+
+    XmlNode rootElement = doc.GetRootElement();
+    ASSERT_TRUE(rootElement.GetNameView() == "ListBucketResult");
+    ASSERT_FALSE(rootElement.GetNameView() != "ListBucketResult");
+    ASSERT_TRUE(rootElement.GetNameView() != "ListBucket");
+    ASSERT_TRUE(rootElement.GetAttributeValueView("xmlns") == "http://s3.amazonaws.com/doc/2006-03-01/");
+    ASSERT_TRUE(rootElement.GetAttributeValueView("missing").IsEmpty());
+
+    XmlNode keyNode = rootElement.FirstChild("Key");
+    ASSERT_EQ("  a & <b> \"c\" ", keyNode.GetTextView().ToString());
+    ASSERT_EQ("a & <b> \"c\"", keyNode.GetTextView().Trim().ToString());
+
+    XmlNode sizeNode = rootElement.FirstChild("Size");
+    ASSERT_EQ(4u, sizeNode.GetTextView().GetLength());
+    ASSERT_TRUE(sizeNode.GetTextView() == Aws::String("1024"));
+
+    ASSERT_TRUE(rootElement.FirstChild("Empty").GetTextView().IsEmpty());
+    ASSERT_TRUE(rootElement.FirstChild("Mixed").GetTextView().IsEmpty());
+    ASSERT_EQ("text <b>bold</b>\n", rootElement.FirstChild("Mixed").GetText());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(XmlSerializerTest, TestDecodeEscapedXmlText)
+{
+    ASSERT_EQ("", DecodeEscapedXmlText(""));
+    ASSERT_EQ("no entities here", DecodeEscapedXmlText("no entities here"));
+    ASSERT_EQ("\"'<>&", DecodeEscapedXmlText("&quot;&apos;&lt;&gt;&amp;"));
+    ASSERT_EQ("a & b; c", DecodeEscapedXmlText("a &amp; b; c"));
+    ASSERT_EQ("&amp;", DecodeEscapedXmlText("&amp;amp;"));
+    ASSERT_EQ("unknown &nbsp; and trailing &", DecodeEscapedXmlText("unknown &nbsp; and trailing &"));
+    ASSERT_EQ("&l", DecodeEscapedXmlText("&l"));
+
+    const char* partial = "x&lt;y&gt;";
+    ASSERT_EQ("x<y", DecodeEscapedXmlText(partial, 6));
+}
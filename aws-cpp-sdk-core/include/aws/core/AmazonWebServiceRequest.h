@@ -61,9 +61,13 @@ namespace Aws
          */
         const Aws::IOStreamFactory& GetResponseStreamFactory() const { return m_responseStreamFactory; }
         /**
-         * Set the response stream factory.
+         * Set the response stream factory. It takes precedence over the client's configured response stream factory.
          */
-        void SetResponseStreamFactory(const Aws::IOStreamFactory& factory) { m_responseStreamFactory = AWS_BUILD_FUNCTION(factory); }
+        void SetResponseStreamFactory(const Aws::IOStreamFactory& factory) { m_responseStreamFactory = AWS_BUILD_FUNCTION(factory); m_hasResponseStreamFactory = true; }
+        /**
+         * True once SetResponseStreamFactory has been called; otherwise clients use their configured factory.
+         */
+        bool HasResponseStreamFactory() const { return m_hasResponseStreamFactory; }
         /**
          * Register closure for data recieved event.
          */
@@ -92,11 +96,16 @@ namespace Aws
          * If this is set to true, content-md5 needs to be computed and set on the request
          */
         inline virtual bool ShouldComputeContentMd5() const { return false; }
+        /**
+         * Name of the operation this request is sent to, e.g. "GetItem". Generated requests override this; empty otherwise.
+         */
+        inline virtual const char* GetServiceRequestName() const { return ""; }
 
 
     private:
 
         Aws::IOStreamFactory m_responseStreamFactory;
+        bool m_hasResponseStreamFactory;
 
         Aws::Http::DataReceivedEventHandler m_onDataReceived;
         Aws::Http::DataSentEventHandler m_onDataSent;
@@ -62,11 +62,52 @@ namespace Aws
              */
             virtual bool SignRequest(Aws::Http::HttpRequest& request) const = 0;
 
+            /**
+             * Signs the request like SignRequest(request), for a body whose hex encoded sha256 may already be known from an
+             * earlier attempt. Signers that hash the payload use a non-empty payloadHash as is, and store the hash they
+             * compute in an empty one so the next attempt can pass it back. By default the hash is ignored.
+             */
+            virtual bool SignRequest(Aws::Http::HttpRequest& request, Aws::String& payloadHash) const
+            {
+                AWS_UNREFERENCED_PARAM(payloadHash);
+                return SignRequest(request);
+            }
+
             /**
              * Takes a request and signs the URI based on the HttpMethod, URI and other info from the request.
              * The URI can then be used in a normal HTTP call until expiration.
              */
             virtual bool PresignRequest(Aws::Http::HttpRequest& request, long long expirationInSeconds) const = 0;
+
+            /**
+             * Canonicalizes the parts of the request that a prepared request keeps fixed between calls (method, path and
+             * query string) so they can be handed back to SignPreparedRequest(). Signers without such a step return an empty string.
+             */
+            virtual Aws::String PrepareCanonicalRequest(Aws::Http::HttpRequest& request) const
+            {
+                AWS_UNREFERENCED_PARAM(request);
+                return "";
+            }
+
+            /**
+             * Signs a request built from a prepared request, reusing the result of PrepareCanonicalRequest() instead of
+             * canonicalizing the uri again. By default this is just SignRequest().
+             */
+            virtual bool SignPreparedRequest(Aws::Http::HttpRequest& request, const Aws::String& canonicalRequestPrefix) const
+            {
+                AWS_UNREFERENCED_PARAM(canonicalRequestPrefix);
+                return SignRequest(request);
+            }
+
+            /**
+             * Signs a request built from a prepared request, with a payload hash that is used and filled in as for
+             * SignRequest(request, payloadHash). By default the hash is ignored.
+             */
+            virtual bool SignPreparedRequest(Aws::Http::HttpRequest& request, const Aws::String& canonicalRequestPrefix, Aws::String& payloadHash) const
+            {
+                AWS_UNREFERENCED_PARAM(payloadHash);
+                return SignPreparedRequest(request, canonicalRequestPrefix);
+            }
         };
 
         /**
@@ -96,6 +137,12 @@ namespace Aws
             */
             bool SignRequest(Aws::Http::HttpRequest& request) const override;
 
+            /**
+            * Signs the request with payloadHash as the body's sha256, hashing the body into payloadHash when it is empty.
+            * The request's own x-amz-content-sha256 header is never trusted.
+            */
+            bool SignRequest(Aws::Http::HttpRequest& request, Aws::String& payloadHash) const override;
+
             /**
             * Takes a request and signs the URI based on the HttpMethod, URI and other info from the request.
             * The URI can then be used in a normal HTTP call until expiration.
@@ -104,6 +151,22 @@ namespace Aws
             */
             bool PresignRequest(Aws::Http::HttpRequest& request, long long expirationInSeconds = 0) const override;
 
+            /**
+            * Returns the canonical method, path and query string lines of the request, canonicalizing its query string in place.
+            */
+            Aws::String PrepareCanonicalRequest(Aws::Http::HttpRequest& request) const override;
+
+            /**
+            * Signs the request like SignRequest(), with the method, path and query string taken from canonicalRequestPrefix.
+            * The request's uri must already be canonical, as it is when it was copied from the request that was prepared.
+            */
+            bool SignPreparedRequest(Aws::Http::HttpRequest& request, const Aws::String& canonicalRequestPrefix) const override;
+
+            /**
+            * Signs a prepared request with payloadHash as the body's sha256, hashing the body into payloadHash when it is empty.
+            */
+            bool SignPreparedRequest(Aws::Http::HttpRequest& request, const Aws::String& canonicalRequestPrefix, Aws::String& payloadHash) const override;
+
         private:
             Aws::String GenerateSignature(const Aws::Auth::AWSCredentials& credentials, const Aws::String& stringToSign, const Aws::String& simpleDate) const;
             Aws::String ComputePayloadHash(Aws::Http::HttpRequest&) const;
@@ -17,6 +17,7 @@
 
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/PreparedRequest.h>
 #include <aws/core/http/HttpTypes.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/AmazonWebServiceResult.h>
@@ -64,6 +65,7 @@ namespace Aws
     } // namespace Http
 
     class AmazonWebServiceRequest;
+    class AmazonSerializableWebServiceRequest;
 
     namespace Client
     {
@@ -74,6 +76,7 @@ namespace Aws
         class AWSAuthSigner;
         struct ClientConfiguration;
         class RetryStrategy;
+        class OperationRateLimits;
 
         typedef Utils::Outcome<std::shared_ptr<Aws::Http::HttpResponse>, AWSError<CoreErrors>> HttpResponseOutcome;
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Stream::ResponseStream>, AWSError<CoreErrors>> StreamOutcome;
@@ -141,6 +144,22 @@ namespace Aws
             */
             HttpResponseOutcome AttemptOneRequest(const Aws::String& uri, Http::HttpMethod httpMethod) const;
 
+            /**
+             * Freezes everything about requestTemplate except the part of its body that goes between bodyPrefix and bodySuffix:
+             * the uri with the template's query string applied, the template's headers plus the common ones, and the signer's
+             * canonical request prefix. Send the result with AttemptExhaustively(const PreparedRequest&, ...).
+             */
+            PreparedRequest PrepareRequest(const Aws::String& uri,
+                const std::shared_ptr<const Aws::AmazonWebServiceRequest>& requestTemplate,
+                const Aws::String& bodyPrefix, const Aws::String& bodySuffix,
+                Http::HttpMethod httpMethod) const;
+
+            /**
+             * Sends preparedRequest with variablePart spliced into its body, retrying the same way the other overloads do.
+             * Only the content-length, date and signature are computed per call.
+             */
+            HttpResponseOutcome AttemptExhaustively(const PreparedRequest& preparedRequest, const Aws::String& variablePart) const;
+
             /**
              * This is used for structureless response payloads (file streams, binary data etc...). It calls AttemptExhaustively, but upon
              * return transfers ownership of the underlying stream for the http response to the caller.
@@ -160,6 +179,15 @@ namespace Aws
             virtual void BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
                 const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest) const;
 
+            /**
+             * Transforms the AmazonWebServicesResult object into an HttpRequest, using a body and header collection that were
+             * already produced by PrepareRequestPayload(). This is what retries use, so the payload is only serialized once.
+             */
+            virtual void BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
+                const std::shared_ptr<Aws::IOStream>& body,
+                const Http::HeaderValueCollection& headers,
+                const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest) const;
+
             /**
              *  Gets the underlying ErrorMarshaller for subclasses to use.
              */
@@ -168,11 +196,56 @@ namespace Aws
                 return m_errorMarshaller;
             }
 
+            /**
+             * Gets the per-operation throttles from the client configuration; may be null.
+             */
+            const std::shared_ptr<OperationRateLimits>& GetOperationRateLimits() const
+            {
+                return m_operationRateLimits;
+            }
+
+            /**
+             * Gets the retry strategy from the client configuration, for work the client retries outside of MakeRequest.
+             */
+            const std::shared_ptr<RetryStrategy>& GetRetryStrategy() const
+            {
+                return m_retryStrategy;
+            }
+
+            /**
+             * True if the configuration asks for a per-request arena and the calling thread does not already have one, in
+             * which case the caller should install one around sending the request and parsing its response.
+             */
+            bool NeedsRequestArena() const;
+
+            /**
+             * Copies what is left of a response body into a string for a parser to read. Inside a request arena the copy is
+             * allocated from it, so it must not outlive the arena; the parsed document must be built outside it.
+             */
+            Aws::String ReadResponseBody(Aws::IOStream& responseBody) const;
+
         private:
+            /**
+             * Serializes the request body and collects its headers, adding content-md5 if the request needs it.
+             * The result is shared by every attempt of one logical request.
+             */
+            void PrepareRequestPayload(const Aws::AmazonWebServiceRequest& request,
+                std::shared_ptr<Aws::IOStream>& body, Http::HeaderValueCollection& headers) const;
+            HttpResponseOutcome AttemptOneRequest(const Aws::String& uri,
+                const Aws::AmazonWebServiceRequest& request,
+                const std::shared_ptr<Aws::IOStream>& body,
+                const Http::HeaderValueCollection& headers,
+                Aws::String& payloadHash,
+                Http::HttpMethod httpMethod) const;
+            HttpResponseOutcome AttemptOneRequest(const PreparedRequest& preparedRequest,
+                const std::shared_ptr<Aws::IOStream>& body,
+                const Http::HeaderValueCollection& headers,
+                Aws::String& payloadHash) const;
             void AddHeadersToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest, const Http::HeaderValueCollection& headerValues) const;
             void AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest,
                                          const std::shared_ptr<Aws::IOStream>& body, bool needsContentMd5 = false) const;
             void AddCommonHeaders(Aws::Http::HttpRequest& httpRequest) const;
+            const Aws::IOStreamFactory& GetResponseStreamFactory(const Aws::AmazonWebServiceRequest& request) const;
             void InitializeGlobalStatics();
             void CleanupGlobalStatics();
 
@@ -182,8 +255,11 @@ namespace Aws
             std::shared_ptr<RetryStrategy> m_retryStrategy;
             std::shared_ptr<Aws::Utils::RateLimits::RateLimiterInterface> m_writeRateLimiter;
             std::shared_ptr<Aws::Utils::RateLimits::RateLimiterInterface> m_readRateLimiter;
+            std::shared_ptr<OperationRateLimits> m_operationRateLimits;
             Aws::String m_userAgent;
             std::shared_ptr<Aws::Utils::Crypto::Hash> m_hash;
+            bool m_useRequestScopedArena;
+            Aws::IOStreamFactory m_responseStreamFactory;
             static std::atomic<int> s_refCount;
         };
 
@@ -232,6 +308,24 @@ namespace Aws
             JsonOutcome MakeRequest(const Aws::String& uri,
                 Http::HttpMethod method = Http::HttpMethod::HTTP_POST) const;
 
+            /**
+             * Prepares requestTemplate for repeated calls that change only its top level member memberName, which is left
+             * out of the frozen body whether or not the template sets it.
+             */
+            PreparedRequest PrepareJsonRequest(const Aws::String& uri,
+                const std::shared_ptr<const Aws::AmazonSerializableWebServiceRequest>& requestTemplate,
+                const char* memberName,
+                Http::HttpMethod method = Http::HttpMethod::HTTP_POST) const;
+
+            /**
+             * Returns a Json document or an error from a request made by PrepareJsonRequest(), with memberValue as the value of
+             * the member that was left out.
+             */
+            JsonOutcome MakeRequest(const PreparedRequest& preparedRequest,
+                const Utils::Json::JsonValue& memberValue) const;
+
+        private:
+            JsonOutcome ParseJsonResponse(const Aws::AmazonWebServiceRequest& request, const HttpResponseOutcome& httpOutcome) const;
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Xml::XmlDocument>, AWSError<CoreErrors>> XmlOutcome;
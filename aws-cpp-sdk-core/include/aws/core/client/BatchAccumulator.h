@@ -0,0 +1,422 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/DefaultRetryStrategy.h>
+#include <aws/core/client/RetryStrategy.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSFunction.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <utility>
+
+namespace Aws
+{
+    namespace Client
+    {
+        /**
+         * Tuning for a BatchAccumulator. Limits above what the service accepts are capped at the service limits.
+         */
+        struct BatchAccumulatorConfiguration
+        {
+            BatchAccumulatorConfiguration() :
+                maxEntriesPerBatch(0), maxBytesPerBatch(0), lingerTime(50), maxAttempts(3), maxPendingEntries(10000)
+            {
+            }
+
+            /**
+             * Most entries sent in one call; 0 means the service limit.
+             */
+            size_t maxEntriesPerBatch;
+            /**
+             * Most entry bytes sent in one call; 0 means the service limit.
+             */
+            size_t maxBytesPerBatch;
+            /**
+             * How long an entry waits for its batch to fill up before a partial batch is sent.
+             */
+            std::chrono::milliseconds lingerTime;
+            /**
+             * Calls an entry may take part in before a retryable failure is reported as final.
+             */
+            size_t maxAttempts;
+            /**
+             * Add() blocks while this many entries are waiting to be sent; 0 for no bound.
+             */
+            size_t maxPendingEntries;
+        };
+
+        /**
+         * Counters of a BatchAccumulator since it was created.
+         */
+        struct BatchAccumulatorStats
+        {
+            BatchAccumulatorStats() : batchesSent(0), entriesSent(0), entriesRetried(0), entriesFailed(0) {}
+
+            size_t batchesSent;
+            size_t entriesSent;
+            size_t entriesRetried;
+            size_t entriesFailed;
+        };
+
+        /**
+         * An entry a batch call did not process, as reported by a BatchAccumulator's send function. batchIndex is the
+         * entry's position in the batch the send function was given, and is how the accumulator finds the entry's attempt
+         * count; an out of range index charges the entry the most attempts of any entry in that batch.
+         */
+        template<typename EntryT>
+        struct BatchEntryFailure
+        {
+            BatchEntryFailure(size_t batchIndex, EntryT&& failedEntry, const Aws::String& failure, bool canRetry) :
+                index(batchIndex), entry(std::move(failedEntry)), error(failure), retryable(canRetry)
+            {
+            }
+
+            size_t index;
+            EntryT entry;
+            Aws::String error;
+            bool retryable;
+        };
+
+        /**
+         * Collects single entries for a batch API (SQS SendMessageBatch, Kinesis PutRecords, ...) and sends them from a
+         * background thread, one call per batch. A batch is sent as soon as it reaches the entry or byte limit, or once its
+         * oldest entry has waited lingerTime. Entries the service reports as failed with a retryable error are held back for
+         * the retry strategy's delay, with jitter, and then go to the front of the queue; other failures, and entries out
+         * of attempts, go to the failed entry handler.
+         *
+         * Generated clients provide ready-made accumulators (e.g. SQSClient::SendMessageBatchAccumulator) that know each
+         * operation's limits and how it reports partial failures. Destroying the accumulator sends whatever is still queued.
+         */
+        template<typename RequestT, typename EntryT>
+        class BatchAccumulator
+        {
+        public:
+            /**
+             * Bytes an entry adds to a batch, as counted against the byte limit.
+             */
+            typedef std::function<size_t(const EntryT& entry)> EntrySizeFunction;
+
+            /**
+             * Sends batch in a copy of requestTemplate, and moves the entries that were not processed into failures, along
+             * with their positions in batch.
+             */
+            typedef std::function<void(const RequestT& requestTemplate, Aws::Vector<EntryT>&& batch, Aws::Vector<BatchEntryFailure<EntryT>>& failures)> SendBatchFunction;
+
+            typedef std::function<void(const EntryT& entry, const Aws::String& error)> FailedEntryHandler;
+
+            /**
+             * serviceMaxEntries and serviceMaxBytes are the limits of the batch operation; a serviceMaxBytes of 0 means the
+             * operation has no byte limit. retryStrategy, normally the client's, spaces out the attempts of failed entries;
+             * without one a DefaultRetryStrategy is used.
+             */
+            BatchAccumulator(const RequestT& requestTemplate, size_t serviceMaxEntries, size_t serviceMaxBytes,
+                    const BatchAccumulatorConfiguration& config, EntrySizeFunction entrySize, SendBatchFunction sendBatch,
+                    const std::shared_ptr<RetryStrategy>& retryStrategy = nullptr) :
+                m_requestTemplate(requestTemplate),
+                m_maxEntries(CapLimit(config.maxEntriesPerBatch, serviceMaxEntries)),
+                m_maxBytes(CapLimit(config.maxBytesPerBatch, serviceMaxBytes)),
+                m_lingerTime(config.lingerTime),
+                m_maxAttempts(std::max(config.maxAttempts, static_cast<size_t>(1))),
+                m_maxPendingEntries(config.maxPendingEntries),
+                m_entrySize(entrySize),
+                m_sendBatch(sendBatch),
+                m_retryStrategy(retryStrategy ? retryStrategy : Aws::MakeShared<DefaultRetryStrategy>("BatchAccumulator")),
+                m_random(std::random_device()()),
+                m_pendingBytes(0),
+                m_inFlight(0),
+                m_flushRequests(0),
+                m_stopping(false)
+            {
+                m_thread = std::thread(&BatchAccumulator::Run, this);
+            }
+
+            BatchAccumulator(const BatchAccumulator&) = delete;
+            BatchAccumulator& operator=(const BatchAccumulator&) = delete;
+
+            /**
+             * Sends everything still queued, including retries, before returning.
+             */
+            ~BatchAccumulator()
+            {
+                {
+                    std::lock_guard<std::mutex> locker(m_mutex);
+                    m_stopping = true;
+                }
+                m_signal.notify_all();
+                m_thread.join();
+            }
+
+            /**
+             * Queues an entry, waiting first if maxPendingEntries entries are already queued.
+             */
+            void Add(const EntryT& entry)
+            {
+                Add(EntryT(entry));
+            }
+
+            void Add(EntryT&& entry)
+            {
+                size_t size = m_entrySize(entry);
+                std::unique_lock<std::mutex> locker(m_mutex);
+                m_signal.wait(locker, [this]() { return m_maxPendingEntries == 0 || m_pending.size() + m_retrying.size() < m_maxPendingEntries; });
+
+                m_pending.push_back(PendingEntry(std::move(entry), size, 0));
+                m_pendingBytes += size;
+                if (m_pending.size() == 1 || IsBatchFull())
+                {
+                    m_signal.notify_all();
+                }
+            }
+
+            /**
+             * Sends every queued entry now, and returns once they have all been sent (or reported as failed).
+             */
+            void Flush()
+            {
+                std::unique_lock<std::mutex> locker(m_mutex);
+                ++m_flushRequests;
+                m_signal.notify_all();
+                m_signal.wait(locker, [this]() { return m_pending.empty() && m_retrying.empty() && m_inFlight == 0; });
+                --m_flushRequests;
+            }
+
+            /**
+             * Called, on the sending thread, for every entry that finally failed. Without a handler such entries are dropped.
+             */
+            void SetFailedEntryHandler(const FailedEntryHandler& handler)
+            {
+                std::lock_guard<std::mutex> locker(m_mutex);
+                m_failedEntryHandler = handler;
+            }
+
+            BatchAccumulatorStats GetStats() const
+            {
+                std::lock_guard<std::mutex> locker(m_mutex);
+                return m_stats;
+            }
+
+        private:
+            struct PendingEntry
+            {
+                PendingEntry(EntryT&& pendingEntry, size_t entrySize, size_t previousAttempts) :
+                    entry(std::move(pendingEntry)), size(entrySize), attempts(previousAttempts), enqueued(std::chrono::steady_clock::now()),
+                    readyAt(enqueued)
+                {
+                }
+
+                PendingEntry(EntryT&& pendingEntry, size_t entrySize, size_t previousAttempts,
+                        std::chrono::steady_clock::time_point firstEnqueued, std::chrono::steady_clock::time_point retryAt) :
+                    entry(std::move(pendingEntry)), size(entrySize), attempts(previousAttempts), enqueued(firstEnqueued), readyAt(retryAt)
+                {
+                }
+
+                EntryT entry;
+                size_t size;
+                size_t attempts;
+                std::chrono::steady_clock::time_point enqueued;
+                // when a retried entry may go out again
+                std::chrono::steady_clock::time_point readyAt;
+            };
+
+            static size_t CapLimit(size_t configured, size_t serviceLimit)
+            {
+                if (serviceLimit == 0)
+                {
+                    serviceLimit = (std::numeric_limits<size_t>::max)();
+                }
+                return configured == 0 ? serviceLimit : (std::min)(configured, serviceLimit);
+            }
+
+            bool IsBatchFull() const
+            {
+                return m_pending.size() >= m_maxEntries || m_pendingBytes >= m_maxBytes;
+            }
+
+            /**
+             * Moves the retries whose delay has passed to the front of the queue, ahead of entries added since.
+             */
+            void ReleaseRetries(std::chrono::steady_clock::time_point now)
+            {
+                auto ready = m_retrying.begin();
+                while (ready != m_retrying.end() && ready->readyAt <= now)
+                {
+                    m_pendingBytes += ready->size;
+                    ++ready;
+                }
+                m_pending.insert(m_pending.begin(), std::make_move_iterator(m_retrying.begin()), std::make_move_iterator(ready));
+                m_retrying.erase(m_retrying.begin(), ready);
+            }
+
+            void Run()
+            {
+                std::unique_lock<std::mutex> locker(m_mutex);
+                for (;;)
+                {
+                    auto now = std::chrono::steady_clock::now();
+                    ReleaseRetries(now);
+                    if (m_pending.empty())
+                    {
+                        if (!m_retrying.empty())
+                        {
+                            m_signal.wait_until(locker, m_retrying.front().readyAt);
+                            continue;
+                        }
+                        if (m_stopping)
+                        {
+                            return;
+                        }
+                        m_signal.wait(locker);
+                        continue;
+                    }
+
+                    auto due = m_pending.front().enqueued + m_lingerTime;
+                    if (!m_stopping && m_flushRequests == 0 && !IsBatchFull() && now < due)
+                    {
+                        m_signal.wait_until(locker, m_retrying.empty() ? due : (std::min)(due, m_retrying.front().readyAt));
+                        continue;
+                    }
+
+                    SendBatch(locker);
+                }
+            }
+
+            void SendBatch(std::unique_lock<std::mutex>& locker)
+            {
+                Aws::Vector<EntryT> batch;
+                Aws::Vector<size_t> attempts;
+                Aws::Vector<std::chrono::steady_clock::time_point> enqueued;
+                size_t bytes = 0;
+                size_t mostAttempts = 0;
+                while (!m_pending.empty() && batch.size() < m_maxEntries)
+                {
+                    PendingEntry& next = m_pending.front();
+                    // an entry larger than the byte limit still goes out, on its own, for the service to reject
+                    if (!batch.empty() && bytes + next.size > m_maxBytes)
+                    {
+                        break;
+                    }
+                    bytes += next.size;
+                    attempts.push_back(next.attempts + 1);
+                    enqueued.push_back(next.enqueued);
+                    mostAttempts = (std::max)(mostAttempts, next.attempts + 1);
+                    batch.push_back(std::move(next.entry));
+                    m_pendingBytes -= next.size;
+                    m_pending.pop_front();
+                }
+                ++m_inFlight;
+                m_signal.notify_all();
+
+                size_t batchSize = batch.size();
+                Aws::Vector<BatchEntryFailure<EntryT>> failures;
+                locker.unlock();
+                m_sendBatch(m_requestTemplate, std::move(batch), failures);
+                locker.lock();
+
+                --m_inFlight;
+                ++m_stats.batchesSent;
+                m_stats.entriesSent += batchSize - failures.size();
+
+                Aws::Vector<BatchEntryFailure<EntryT>> finalFailures;
+                auto now = std::chrono::steady_clock::now();
+                // one draw per call, so entries that failed together on the same attempt come back together, in order
+                double jitter = std::uniform_real_distribution<double>(0.0, 1.0)(m_random);
+                for (auto failure = failures.rbegin(); failure != failures.rend(); ++failure)
+                {
+                    bool known = failure->index < attempts.size();
+                    size_t entryAttempts = known ? attempts[failure->index] : mostAttempts;
+                    if (failure->retryable && entryAttempts < m_maxAttempts)
+                    {
+                        AWSError<CoreErrors> error(CoreErrors::UNKNOWN, "", failure->error, true);
+                        auto retryAt = now + RetryDelay(error, entryAttempts, jitter);
+                        size_t size = m_entrySize(failure->entry);
+                        // failures are walked backwards, so inserting ahead of equal times keeps the original order
+                        auto position = std::lower_bound(m_retrying.begin(), m_retrying.end(), retryAt,
+                            [](const PendingEntry& entry, const std::chrono::steady_clock::time_point& time) { return entry.readyAt < time; });
+                        m_retrying.insert(position, PendingEntry(std::move(failure->entry), size, entryAttempts,
+                            known ? enqueued[failure->index] : now, retryAt));
+                        ++m_stats.entriesRetried;
+                    }
+                    else
+                    {
+                        finalFailures.push_back(std::move(*failure));
+                    }
+                }
+                m_stats.entriesFailed += finalFailures.size();
+
+                if (!finalFailures.empty() && m_failedEntryHandler)
+                {
+                    FailedEntryHandler handler = m_failedEntryHandler;
+                    locker.unlock();
+                    for (auto failure = finalFailures.rbegin(); failure != finalFailures.rend(); ++failure)
+                    {
+                        handler(failure->entry, failure->error);
+                    }
+                    locker.lock();
+                }
+                m_signal.notify_all();
+            }
+
+            /**
+             * The retry strategy's delay after an entry's attempts-th call, with equal jitter (jitter in [0, 1) scales the
+             * upper half) so that accumulators throttled at the same moment do not all come back at once.
+             */
+            std::chrono::milliseconds RetryDelay(const AWSError<CoreErrors>& error, size_t attempts, double jitter) const
+            {
+                long delay = (std::max)(m_retryStrategy->CalculateDelayBeforeNextRetry(error, static_cast<long>(attempts)), 0L);
+                long half = delay / 2;
+                return std::chrono::milliseconds(delay - half + static_cast<long>(half * jitter));
+            }
+
+            const RequestT m_requestTemplate;
+            const size_t m_maxEntries;
+            const size_t m_maxBytes;
+            const std::chrono::milliseconds m_lingerTime;
+            const size_t m_maxAttempts;
+            const size_t m_maxPendingEntries;
+            EntrySizeFunction m_entrySize;
+            SendBatchFunction m_sendBatch;
+            std::shared_ptr<RetryStrategy> m_retryStrategy;
+            std::minstd_rand m_random;
+            FailedEntryHandler m_failedEntryHandler;
+
+            mutable std::mutex m_mutex;
+            std::condition_variable m_signal;
+            Aws::Deque<PendingEntry> m_pending;
+            // retryable failures waiting out their delay, soonest first
+            Aws::Deque<PendingEntry> m_retrying;
+            size_t m_pendingBytes;
+            size_t m_inFlight;
+            size_t m_flushRequests;
+            bool m_stopping;
+            BatchAccumulatorStats m_stats;
+            std::thread m_thread;
+        };
+
+    } // namespace Client
+} // namespace Aws
@@ -19,6 +19,7 @@
 #include <aws/core/http/Scheme.h>
 #include <aws/core/Region.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/http/HttpTypes.h>
 #include <memory>
 
@@ -40,6 +41,7 @@ namespace Aws
     namespace Client
     {
         class RetryStrategy; // forward declare
+        class OperationRateLimits;
 
         /**
           * This mutable structure is used to configure any of the AWS clients.
@@ -47,6 +49,12 @@ namespace Aws
           */
         struct AWS_CORE_API ClientConfiguration
         {
+            /**
+             * Thread count of the default executor; the same as the default maxConnections, since more concurrent requests
+             * than that would only wait for a connection.
+             */
+            static const size_t DEFAULT_EXECUTOR_POOL_SIZE = 25;
+
             ClientConfiguration();
             /**
              * User Agent string user for http calls. This is filled in for you in the constructor. Don't override this unless you have a really good reason.
@@ -102,7 +110,9 @@ namespace Aws
             */
             Aws::String proxyPassword;
             /**
-            * Threading Executor implementation. Default uses std::thread::detach()
+            * Threading Executor implementation, used by the *Async and *Callable methods. Default is a thread pool of
+            * DEFAULT_EXECUTOR_POOL_SIZE threads, started as tasks arrive and shared by every client built from this
+            * configuration; further tasks queue for a free thread.
             */
             std::shared_ptr<Aws::Utils::Threading::Executor> executor;
             /**
@@ -117,10 +127,13 @@ namespace Aws
             Aws::String caPath;
             /**
              * Rate Limiter implementation for outgoing bandwidth. Default is wide-open.
+             * A SharedMemoryRateLimiter makes every process on the host that uses the same name share the budget.
              */
             std::shared_ptr<Aws::Utils::RateLimits::RateLimiterInterface> writeRateLimiter;
             /**
             * Rate Limiter implementation for incoming bandwidth. Default is wide-open.
+            * It is charged for every received chunk; when many downloads share one limiter, AtomicRateLimiter avoids
+            * serializing them on a lock.
             */
             std::shared_ptr<Aws::Utils::RateLimits::RateLimiterInterface> readRateLimiter;
             /**
@@ -131,6 +144,23 @@ namespace Aws
              * If set to true the http stack will follow 300 redirect codes.
              */
             bool followRedirects;
+            /**
+             * If set to true, the request body and headers are serialized into a per-request memory arena that is released
+             * in one step once the request completes. The signer's canonical request and the copy of the response body the
+             * parser reads from come from the same arena. Only enable this if your requests do not cache or share anything
+             * they allocate while serializing. Default is false.
+             */
+            bool useRequestScopedArena;
+            /**
+             * Request-rate and capacity throttles keyed by operation name, applied before requests are sent. May be shared
+             * between clients. Default is none.
+             */
+            std::shared_ptr<OperationRateLimits> operationRateLimits;
+            /**
+             * Factory for response body streams, used for every request that has not set its own. Default is a
+             * SpillingResponseStream, which keeps bodies in memory up to a threshold and spills the rest to a temporary file.
+             */
+            Aws::IOStreamFactory responseStreamFactory;
         };
 
     } // namespace Client
@@ -0,0 +1,125 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+
+#include <aws/core/utils/threading/Executor.h>
+
+#include <coroutine>
+#include <utility>
+
+namespace Aws
+{
+    namespace Client
+    {
+        /**
+         * Awaitable that runs an operation on an executor. Awaiting it resumes the awaiting coroutine on the executor thread
+         * that ran the operation, as soon as the outcome is ready; there is no handler, caller context or second executor hop.
+         * If the executor rejects the task, the operation runs on the awaiting thread without suspending.
+         */
+        template<typename OutcomeT, typename OperationT>
+        class OperationAwaitable
+        {
+        public:
+            OperationAwaitable(Aws::Utils::Threading::Executor* executor, OperationT operation) :
+                m_executor(executor), m_operation(std::move(operation))
+            {
+            }
+
+            OperationAwaitable(OperationAwaitable&&) = default;
+            OperationAwaitable(const OperationAwaitable&) = delete;
+            OperationAwaitable& operator=(const OperationAwaitable&) = delete;
+
+            bool await_ready() const noexcept { return false; }
+
+            bool await_suspend(std::coroutine_handle<> awaiting)
+            {
+                // the awaitable lives in the suspended coroutine frame until await_resume, so the task may refer to it
+                if (m_executor->Submit([this, awaiting]() { m_outcome = m_operation(); awaiting.resume(); }))
+                {
+                    return true;
+                }
+
+                m_outcome = m_operation();
+                return false;
+            }
+
+            OutcomeT await_resume() { return std::move(m_outcome); }
+
+        private:
+            Aws::Utils::Threading::Executor* m_executor;
+            OperationT m_operation;
+            OutcomeT m_outcome;
+        };
+
+        template<typename OperationT>
+        auto MakeOperationAwaitable(Aws::Utils::Threading::Executor* executor, OperationT&& operation)
+        {
+            return OperationAwaitable<decltype(operation()), std::decay_t<OperationT>>(executor, std::forward<OperationT>(operation));
+        }
+
+        /**
+         * A client operation bound to its client and request. A nameable type, so that generated clients can declare their
+         * *Awaitable methods against forward-declared requests.
+         */
+        template<typename ClientT, typename RequestT, typename OutcomeT>
+        class BoundClientOperation
+        {
+        public:
+            typedef OutcomeT (ClientT::*Operation)(const RequestT&) const;
+
+            BoundClientOperation(const ClientT* client, Operation operation, RequestT&& request) :
+                m_client(client), m_operation(operation), m_request(std::move(request))
+            {
+            }
+
+            OutcomeT operator()() const { return (m_client->*m_operation)(m_request); }
+
+        private:
+            const ClientT* m_client;
+            Operation m_operation;
+            RequestT m_request;
+        };
+
+        /**
+         * Operations that take no request.
+         */
+        template<typename ClientT, typename OutcomeT>
+        class BoundClientOperation<ClientT, void, OutcomeT>
+        {
+        public:
+            typedef OutcomeT (ClientT::*Operation)() const;
+
+            BoundClientOperation(const ClientT* client, Operation operation) : m_client(client), m_operation(operation) {}
+
+            OutcomeT operator()() const { return (m_client->*m_operation)(); }
+
+        private:
+            const ClientT* m_client;
+            Operation m_operation;
+        };
+
+        /**
+         * Return type of the generated *Awaitable methods.
+         */
+        template<typename ClientT, typename RequestT, typename OutcomeT>
+        using ClientOperationAwaitable = OperationAwaitable<OutcomeT, BoundClientOperation<ClientT, RequestT, OutcomeT>>;
+
+    } // namespace Client
+} // namespace Aws
+
+#endif // AWS_SDK_ENABLE_COROUTINES
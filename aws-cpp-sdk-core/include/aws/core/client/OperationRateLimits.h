@@ -0,0 +1,125 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSFunction.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <memory>
+#include <stdint.h>
+
+namespace Aws
+{
+    class AmazonWebServiceRequest;
+
+    namespace Utils
+    {
+        namespace Json
+        {
+            class JsonValue;
+        } // namespace Json
+
+        namespace RateLimits
+        {
+            class RateLimiterInterface;
+        } // namespace RateLimits
+    } // namespace Utils
+
+    namespace Client
+    {
+        /**
+         * Request-rate and capacity throttles for service clients, set through ClientConfiguration::operationRateLimits.
+         * Each limit is a rate limiter attached to one operation name (AmazonWebServiceRequest::GetServiceRequestName()) or
+         * to ALL_OPERATIONS, plus cost functions that say how much of the limiter a call uses:
+         *
+         *   - the request cost is charged before every attempt is sent, and the attempt waits for any outstanding cost;
+         *   - the response cost is charged once a JSON-protocol call succeeds, e.g. the capacity units DynamoDB reports,
+         *     and is paid for by the calls that follow it.
+         *
+         * A cost function returning a negative cost exempts that call from the limit, which is how a limit is scoped to, say,
+         * one table. Limits must be added before the configuration is used to construct clients.
+         *
+         * Example, 100 GetItem calls per second and 500 read capacity units per second on one table:
+         *
+         *   auto limits = Aws::MakeShared<OperationRateLimits>(tag);
+         *   limits->AddLimit("GetItem", Aws::MakeShared<AtomicRateLimiter<>>(tag, 100));
+         *   limits->AddLimit("GetItem", Aws::MakeShared<AtomicRateLimiter<>>(tag, 500), OperationRateLimits::CostPerRequest(0),
+         *       OperationRateLimits::ConsumedCapacityUnits());
+         */
+        class AWS_CORE_API OperationRateLimits
+        {
+        public:
+            typedef std::function<int64_t(const Aws::AmazonWebServiceRequest&)> RequestCostFunction;
+            typedef std::function<int64_t(const Aws::AmazonWebServiceRequest&, const Aws::Utils::Json::JsonValue&)> ResponseCostFunction;
+
+            /**
+             * Operation name that matches every request.
+             */
+            static const char* ALL_OPERATIONS;
+
+            OperationRateLimits() : m_hasResponseCosts(false) {}
+
+            /**
+             * A null requestCost charges nothing up front (the call still waits for outstanding cost); a null responseCost
+             * charges nothing afterwards.
+             */
+            void AddLimit(const Aws::String& operationName, const std::shared_ptr<Aws::Utils::RateLimits::RateLimiterInterface>& limiter,
+                const RequestCostFunction& requestCost = CostPerRequest(1), const ResponseCostFunction& responseCost = nullptr);
+
+            /**
+             * Charges the same cost for every request.
+             */
+            static RequestCostFunction CostPerRequest(int64_t cost);
+
+            /**
+             * Capacity units from a DynamoDB response's ConsumedCapacity (a single entry or a list of them), multiplied by
+             * scale and rounded up; use a scale of 2 to count eventually consistent half units exactly. The request must
+             * set ReturnConsumedCapacity, otherwise the response carries no capacity and costs nothing.
+             */
+            static ResponseCostFunction ConsumedCapacityUnits(int64_t scale = 1);
+
+            /**
+             * Charges the request cost of every matching limit, sleeping until the limiters allow the request through.
+             */
+            void ChargeRequest(const Aws::AmazonWebServiceRequest& request) const;
+
+            /**
+             * Charges the response cost of every matching limit.
+             */
+            void ChargeResponse(const Aws::AmazonWebServiceRequest& request, const Aws::Utils::Json::JsonValue& response) const;
+
+            bool HasResponseCosts() const { return m_hasResponseCosts; }
+
+        private:
+            struct Limit
+            {
+                std::shared_ptr<Aws::Utils::RateLimits::RateLimiterInterface> m_limiter;
+                RequestCostFunction m_requestCost;
+                ResponseCostFunction m_responseCost;
+            };
+
+            template<typename Fn>
+            void ForEachMatchingLimit(const Aws::AmazonWebServiceRequest& request, const Fn& fn) const;
+
+            Aws::Map<Aws::String, Aws::Vector<Limit>> m_limits;
+            bool m_hasResponseCosts;
+        };
+
+    } // namespace Client
+} // namespace Aws
@@ -0,0 +1,259 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace Aws
+{
+    namespace Client
+    {
+        /**
+         * Pages through a paginated operation, following its pagination token. Page N+1 can only be requested once page N has
+         * arrived, so while the caller works on one page up to prefetchDepth further pages are fetched on the client executor;
+         * a prefetchDepth of zero fetches each page on the calling thread when it is asked for.
+         *
+         * A failed outcome is returned like any other page and ends the pagination. The client must outlive the paginator;
+         * destroying the paginator waits for a prefetch that is still in flight.
+         *
+         * A prefetch that has not started yet is never waited for: GetNextPage() fetches that page itself instead. So the
+         * paginator can be driven from a task on the client executor (an async handler, say) even when that task holds the
+         * executor's only thread.
+         */
+        template<typename ClientT, typename RequestT, typename OutcomeT>
+        class Paginator
+        {
+        public:
+            typedef OutcomeT (ClientT::*Operation)(const RequestT&) const;
+
+            /**
+             * Fills next with the request for the page following the one outcome answers current with;
+             * returns false if outcome holds the last page.
+             */
+            typedef bool (*NextRequestFunction)(const RequestT& current, const OutcomeT& outcome, RequestT& next);
+
+            Paginator(const ClientT* client, Operation operation, const RequestT& firstRequest, NextRequestFunction nextRequest,
+                    Aws::Utils::Threading::Executor* executor, size_t prefetchDepth) :
+                m_state(Aws::MakeShared<State>("Paginator", client, operation, firstRequest, nextRequest, executor, prefetchDepth))
+            {
+                std::unique_lock<std::mutex> locker(m_state->mutex);
+                PrefetchIfNeeded(m_state, locker);
+            }
+
+            Paginator(Paginator&& other) : m_state(std::move(other.m_state))
+            {
+            }
+
+            Paginator(const Paginator&) = delete;
+            Paginator& operator=(const Paginator&) = delete;
+
+            ~Paginator()
+            {
+                if (m_state)
+                {
+                    std::unique_lock<std::mutex> locker(m_state->mutex);
+                    m_state->cancelled = true;
+                    // a prefetch that has not started will see cancelled and do nothing, so only a running one is waited for
+                    m_state->signal.wait(locker, [this]() { return !m_state->fetching; });
+                }
+            }
+
+            /**
+             * True until the outcome holding the last page (or the first failure) has been returned by GetNextPage().
+             */
+            bool HasMorePages() const
+            {
+                std::lock_guard<std::mutex> locker(m_state->mutex);
+                return !m_state->pages.empty() || m_state->fetching || m_state->prefetchQueued || m_state->hasNextRequest;
+            }
+
+            /**
+             * Returns the next page, waiting for it if it has not arrived yet. Only call while HasMorePages() is true.
+             */
+            OutcomeT GetNextPage()
+            {
+                std::unique_lock<std::mutex> locker(m_state->mutex);
+                if (m_state->pages.empty() && !m_state->fetching && m_state->hasNextRequest)
+                {
+                    // a queued prefetch may be waiting behind the caller itself on the executor, so take its page over
+                    m_state->prefetchQueued = false;
+                    Fetch(m_state, locker);
+                }
+                m_state->signal.wait(locker, [this]() { return !m_state->pages.empty(); });
+
+                OutcomeT page = std::move(m_state->pages.front());
+                m_state->pages.pop_front();
+                PrefetchIfNeeded(m_state, locker);
+                return page;
+            }
+
+            /**
+             * Input iterator over the pages, so that a paginator can drive a range-based for loop.
+             */
+            class Iterator
+            {
+            public:
+                typedef std::input_iterator_tag iterator_category;
+                typedef OutcomeT value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef OutcomeT* pointer;
+                typedef OutcomeT& reference;
+
+                Iterator() : m_paginator(nullptr) {}
+
+                explicit Iterator(Paginator* paginator) : m_paginator(paginator)
+                {
+                    Advance();
+                }
+
+                OutcomeT& operator*() { return m_page; }
+                OutcomeT* operator->() { return &m_page; }
+
+                Iterator& operator++()
+                {
+                    Advance();
+                    return *this;
+                }
+
+                bool operator==(const Iterator& other) const { return m_paginator == other.m_paginator; }
+                bool operator!=(const Iterator& other) const { return m_paginator != other.m_paginator; }
+
+            private:
+                void Advance()
+                {
+                    if (m_paginator->HasMorePages())
+                    {
+                        m_page = m_paginator->GetNextPage();
+                    }
+                    else
+                    {
+                        m_paginator = nullptr;
+                    }
+                }
+
+                Paginator* m_paginator;
+                OutcomeT m_page;
+            };
+
+            Iterator begin() { return Iterator(this); }
+            Iterator end() { return Iterator(); }
+
+        private:
+            struct State
+            {
+                State(const ClientT* client, Operation operation, const RequestT& firstRequest, NextRequestFunction nextRequest,
+                        Aws::Utils::Threading::Executor* executor, size_t prefetchDepth) :
+                    client(client), operation(operation), nextRequestFunction(nextRequest), executor(executor),
+                    prefetchDepth(prefetchDepth), nextRequest(firstRequest), hasNextRequest(true), fetching(false),
+                    prefetchQueued(false), prefetchGeneration(0), cancelled(false)
+                {
+                }
+
+                const ClientT* client;
+                Operation operation;
+                NextRequestFunction nextRequestFunction;
+                Aws::Utils::Threading::Executor* executor;
+                size_t prefetchDepth;
+
+                std::mutex mutex;
+                std::condition_variable signal;
+                Aws::Deque<OutcomeT> pages;
+                RequestT nextRequest;
+                bool hasNextRequest;
+                // a page is being fetched, inline or on the executor
+                bool fetching;
+                // a prefetch task is waiting for an executor thread; tasks from an older generation were taken over
+                bool prefetchQueued;
+                size_t prefetchGeneration;
+                bool cancelled;
+            };
+
+            /**
+             * Starts fetching the next page on the executor if fewer than prefetchDepth pages are waiting for the caller.
+             * If the executor rejects the task, or GetNextPage() asks for the page before the task starts, the page is fetched
+             * inline instead and the task does nothing. The lock is released around Submit(), since an executor may run the
+             * task on the calling thread.
+             */
+            static void PrefetchIfNeeded(const std::shared_ptr<State>& state, std::unique_lock<std::mutex>& locker)
+            {
+                if (state->cancelled || state->fetching || state->prefetchQueued || !state->hasNextRequest ||
+                    state->pages.size() >= state->prefetchDepth)
+                {
+                    return;
+                }
+
+                size_t generation = ++state->prefetchGeneration;
+                state->prefetchQueued = true;
+
+                locker.unlock();
+                bool submitted = state->executor->Submit([state, generation]()
+                    {
+                        std::unique_lock<std::mutex> taskLocker(state->mutex);
+                        if (state->cancelled || !state->prefetchQueued || state->prefetchGeneration != generation)
+                        {
+                            return;
+                        }
+                        state->prefetchQueued = false;
+                        Fetch(state, taskLocker);
+                        PrefetchIfNeeded(state, taskLocker);
+                    });
+                locker.lock();
+
+                if (!submitted && state->prefetchGeneration == generation)
+                {
+                    state->prefetchQueued = false;
+                }
+            }
+
+            /**
+             * Fetches the page for nextRequest with the lock released, then queues it and records the request after it.
+             */
+            static void Fetch(const std::shared_ptr<State>& state, std::unique_lock<std::mutex>& locker)
+            {
+                RequestT request(std::move(state->nextRequest));
+                state->hasNextRequest = false;
+                state->fetching = true;
+
+                locker.unlock();
+                OutcomeT outcome = (state->client->*state->operation)(request);
+                RequestT next;
+                bool hasNext = outcome.IsSuccess() && state->nextRequestFunction(request, outcome, next);
+                locker.lock();
+
+                state->pages.push_back(std::move(outcome));
+                if (hasNext)
+                {
+                    state->nextRequest = std::move(next);
+                    state->hasNextRequest = true;
+                }
+                state->fetching = false;
+                state->signal.notify_all();
+            }
+
+            std::shared_ptr<State> m_state;
+        };
+
+    } // namespace Client
+} // namespace Aws
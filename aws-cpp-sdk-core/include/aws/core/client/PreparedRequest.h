@@ -0,0 +1,86 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/http/HttpTypes.h>
+#include <aws/core/http/URI.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <memory>
+
+namespace Aws
+{
+    class AmazonWebServiceRequest;
+
+    namespace Client
+    {
+        /**
+         * The parts of a request that stay the same when it is sent over and over with only one payload member changing:
+         * the parsed endpoint, the request headers, the canonical method, path and query string used for signing, and
+         * the serialized body on either side of the changing member.
+         *
+         * Generated clients hand these out from Prepare<Operation>() and accept them in <Operation>Prepared(), which takes
+         * only the changing member, e.g. DynamoDBClient::PrepareGetItem() and GetItemPrepared(preparedRequest, key).
+         * A prepared request is immutable, so one instance can be shared by any number of threads.
+         */
+        class AWS_CORE_API PreparedRequest
+        {
+        public:
+            /**
+             * requestTemplate is the request the frozen parts were taken from; it still supplies the operation name, the
+             * response stream factory and the data event handlers for every call.
+             */
+            PreparedRequest(const std::shared_ptr<const Aws::AmazonWebServiceRequest>& requestTemplate,
+                const Aws::Http::URI& uri, Aws::Http::HttpMethod method, const Aws::Http::HeaderValueCollection& headers,
+                const Aws::String& canonicalRequestPrefix, const Aws::String& bodyPrefix, const Aws::String& bodySuffix);
+
+            const Aws::AmazonWebServiceRequest& GetRequestTemplate() const { return *m_requestTemplate; }
+
+            /**
+             * Endpoint with the template's query string already applied and canonicalized.
+             */
+            const Aws::Http::URI& GetUri() const { return m_uri; }
+
+            Aws::Http::HttpMethod GetMethod() const { return m_method; }
+
+            /**
+             * Template headers plus the client's common headers; content-length and signing headers are added per call.
+             */
+            const Aws::Http::HeaderValueCollection& GetHeaders() const { return m_headers; }
+
+            /**
+             * What AWSAuthSigner::PrepareCanonicalRequest() returned for this request; empty if the signer does not use it.
+             */
+            const Aws::String& GetCanonicalRequestPrefix() const { return m_canonicalRequestPrefix; }
+
+            /**
+             * Returns the request body with the serialized changing member placed between the frozen prefix and suffix.
+             */
+            Aws::String BuildBody(const Aws::String& variablePart) const;
+
+        private:
+            std::shared_ptr<const Aws::AmazonWebServiceRequest> m_requestTemplate;
+            Aws::Http::URI m_uri;
+            Aws::Http::HttpMethod m_method;
+            Aws::Http::HeaderValueCollection m_headers;
+            Aws::String m_canonicalRequestPrefix;
+            Aws::String m_bodyPrefix;
+            Aws::String m_bodySuffix;
+        };
+
+    } // namespace Client
+} // namespace Aws
@@ -54,5 +54,39 @@ namespace FileSystem
     */
     AWS_CORE_API Aws::String CreateTempFilePath();
 
+    /**
+    * Returns the system's directory for temporary files, without a trailing delimiter.
+    */
+    AWS_CORE_API Aws::String GetTempDirectory();
+
+    /**
+    * Maps an entire file read-only into memory. On success, data and length describe the mapping and handle holds
+    * whatever the platform needs to release it; an empty file succeeds with a null data pointer. Returns false on failure.
+    */
+    AWS_CORE_API bool MapFileForRead(const char* path, const unsigned char*& data, size_t& length, void*& handle);
+
+    /**
+    * Releases a mapping created by MapFileForRead.
+    */
+    AWS_CORE_API void UnmapFile(const unsigned char* data, size_t length, void* handle);
+
+    /**
+    * Opens, creating it if needed, a named shared memory segment of at least size bytes that every process on the host
+    * opening the same name maps read/write. A newly created segment is zero filled; created reports whether this call made it.
+    * Returns null on failure or where the platform has no named shared memory.
+    */
+    AWS_CORE_API void* OpenSharedMemory(const char* name, size_t size, bool& created, void*& handle);
+
+    /**
+    * Releases a mapping created by OpenSharedMemory. The segment itself lives on until RemoveSharedMemory is called
+    * (or, on Windows, until the last process closes it).
+    */
+    AWS_CORE_API void CloseSharedMemory(void* data, size_t size, void* handle);
+
+    /**
+    * Removes the name of a shared memory segment; processes that still have it mapped keep working on the old segment.
+    */
+    AWS_CORE_API bool RemoveSharedMemory(const char* name);
+
 } // namespace FileSystem
 } // namespace Aws
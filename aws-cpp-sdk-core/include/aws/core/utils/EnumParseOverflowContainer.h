@@ -15,10 +15,9 @@
 
 #pragma once
 
-#include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/Core_EXPORTS.h>
-#include <mutex>
+#include <atomic>
 
 namespace Aws
 {
@@ -26,18 +25,40 @@ namespace Aws
     {
         /**
          * This container is for storing unknown enum values that are encountered during parsing.
-         * This is to work around the round-tripping enums problem. It's really just a simple thread-safe
-         * hashmap.
+         * This is to work around the round-tripping enums problem. It's a lock-free, insert-only hashmap:
+         * every enum mapper in every client goes through the one global instance, so lookups never block.
+         * Entries live until the container is destroyed, which keeps the returned references valid.
          */
         class AWS_CORE_API EnumParseOverflowContainer
         {
         public:
+            EnumParseOverflowContainer();
+            ~EnumParseOverflowContainer();
+
+            EnumParseOverflowContainer(const EnumParseOverflowContainer&) = delete;
+            EnumParseOverflowContainer& operator=(const EnumParseOverflowContainer&) = delete;
+
             const Aws::String& RetrieveOverflow(int hashCode) const;
             void StoreOverflow(int hashCode, const Aws::String& value);
 
         private:
-            mutable std::mutex m_overflowLock;
-            Aws::Map<int, Aws::String> m_overflowMap;
+            struct OverflowEntry
+            {
+                int hashCode;
+                Aws::String value;
+                OverflowEntry* next;
+            };
+
+            static const size_t BUCKET_COUNT = 64;
+
+            std::atomic<OverflowEntry*>& GetBucket(int hashCode) const;
+
+            /**
+             * Whether an entry between from (inclusive) and until (exclusive) already holds this hash and value.
+             */
+            static bool HasEntry(const OverflowEntry* from, const OverflowEntry* until, int hashCode, const Aws::String& value);
+
+            mutable std::atomic<OverflowEntry*> m_buckets[BUCKET_COUNT];
             Aws::String m_emptyString;
         };
     }
@@ -23,6 +23,7 @@
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 
 
 
@@ -30,6 +31,20 @@ namespace Aws
 {
     namespace Utils
     {
+        /**
+        * A string to be URL encoded when inserted into a stream; see StringUtils::URLEncoded.
+        */
+        struct URLEncodedValue
+        {
+            const char* value;
+            size_t length;
+        };
+
+        /**
+        * Writes the URL encoding of value straight into oStream, without building the encoded string first.
+        */
+        AWS_CORE_API Aws::OStream& operator<<(Aws::OStream& oStream, const URLEncodedValue& value);
+
         /**
         * All the things the c++ stdlib is missing for string operations that I needed.
         */
@@ -62,6 +77,28 @@ namespace Aws
             */
             static Aws::String URLEncode(const char* unsafe);
 
+            /**
+            * URL encodes length bytes of unsafe and appends the result to output (uses %20 not + for spaces).
+            * Runs of characters that need no encoding are copied in bulk, so output can be reused across calls
+            * to build a form body or query string without intermediate allocations.
+            */
+            static void URLEncode(const char* unsafe, size_t length, Aws::String& output);
+
+            /**
+            * URL encodes length bytes of unsafe and writes the result to output (uses %20 not + for spaces).
+            */
+            static void URLEncode(const char* unsafe, size_t length, Aws::OStream& output);
+
+            /**
+            * Wraps unsafe so that stream insertion URL encodes it, e.g. ss << "Key=" << StringUtils::URLEncoded(value).
+            * The result refers to unsafe and must be inserted before unsafe goes away.
+            */
+            static URLEncodedValue URLEncoded(const Aws::String& unsafe)
+            {
+                URLEncodedValue encoded = { unsafe.c_str(), unsafe.size() };
+                return encoded;
+            }
+
             /**
             * Http Clients tend to escape some characters but not all. Escaping all of them causes problems, because the client
             * will also try to escape them.
@@ -0,0 +1,99 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/logging/LogSystemInterface.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/core/utils/memory/stl/AWSList.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            /**
+             * Logger that writes compact binary records instead of text. Tags and format strings are written once, the first
+             * time they are seen, and later records refer to them by id; printf arguments are stored unformatted. Use
+             * DecodeBinaryLog() (or the aws-binary-log-decoder tool) to turn the output into the text DefaultLogSystem
+             * would have written.
+             *
+             * Records are buffered and written out once the buffer reaches flushThresholdBytes, on Flush() and on destruction.
+             */
+            class AWS_CORE_API BinaryLogSystem : public LogSystemInterface
+            {
+            public:
+                static const size_t DEFAULT_FLUSH_THRESHOLD = 64 * 1024;
+
+                BinaryLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& output, size_t flushThresholdBytes = DEFAULT_FLUSH_THRESHOLD);
+                virtual ~BinaryLogSystem();
+
+                virtual LogLevel GetLogLevel(void) const override { return m_logLevel; }
+                void SetLogLevel(LogLevel logLevel) { m_logLevel.store(logLevel); }
+
+                /**
+                 * Records the format id and a copy of the arguments. Formats that cannot be captured are formatted and stored as text.
+                 */
+                virtual void Log(LogLevel logLevel, const char* tag, const char* formatStr, ...) override;
+
+                /**
+                 * Records the stream contents as text.
+                 */
+                virtual void LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream &messageStream) override;
+
+                /**
+                 * Writes buffered records to the output stream and flushes it.
+                 */
+                void Flush();
+
+            private:
+                BinaryLogSystem(const BinaryLogSystem&) = delete;
+                BinaryLogSystem& operator=(const BinaryLogSystem&) = delete;
+
+                uint32_t InternLocked(const char* text, char definitionType, Aws::CStringMap<uint32_t>& ids);
+                size_t BeginRecordLocked(char recordType, LogLevel logLevel, uint32_t tagId);
+                void EndRecordLocked(size_t recordStart);
+                void FlushLocked();
+
+                std::atomic<LogLevel> m_logLevel;
+                std::shared_ptr<Aws::OStream> m_output;
+                size_t m_flushThreshold;
+
+                std::mutex m_lock;
+                Aws::String m_buffer;
+                // keys point into m_internedText, whose elements never move
+                Aws::List<Aws::String> m_internedText;
+                Aws::CStringMap<uint32_t> m_tagIds;
+                Aws::CStringMap<uint32_t> m_formatIds;
+            };
+
+            /**
+             * Reads a BinaryLogSystem stream and writes one text line per record, in the DefaultLogSystem layout.
+             * Returns false if the input is not a binary log or ends in a damaged record; lines decoded up to that point are kept.
+             */
+            AWS_CORE_API bool DecodeBinaryLog(Aws::IStream& input, Aws::OStream& output);
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
@@ -19,7 +19,7 @@
 
 #include <aws/core/utils/logging/FormattedLogSystem.h>
 #include <aws/core/utils/logging/LogLevel.h>
-#include <aws/core/utils/memory/stl/AWSQueue.h>
+#include <aws/core/utils/logging/LogMessageRing.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 
@@ -36,8 +36,48 @@ namespace Aws
         namespace Logging
         {
             /**
-             * Default behavior logger. It has a background thread that reads a log queue and prints the messages
-             * out to file as quickly as possible.  This implementation also rolls the file every hour.
+             * What a logging call does when the log queue is full.
+             */
+            enum class LogOverflowPolicy
+            {
+                /**
+                 * Wait for the logging thread to make room. No lines are lost.
+                 */
+                Block,
+                /**
+                 * Discard the line and count it; see DefaultLogSystem::GetDroppedLineCount().
+                 */
+                Drop
+            };
+
+            /**
+             * Tuning for DefaultLogSystem.
+             */
+            struct AWS_CORE_API DefaultLogSystemOptions
+            {
+                DefaultLogSystemOptions() : queueCapacity(8192), overflowPolicy(LogOverflowPolicy::Block), maxFileSizeBytes(0), deferFormatting(false) {}
+
+                /**
+                 * Number of lines that can be waiting for the logging thread. Rounded up to a power of two.
+                 */
+                size_t queueCapacity;
+                LogOverflowPolicy overflowPolicy;
+                /**
+                 * When logging to a computed file path, start a new file once the current one would grow past this size.
+                 * 0 disables size-based rolling; the file still rolls every hour.
+                 */
+                size_t maxFileSizeBytes;
+                /**
+                 * Log() calls only copy their arguments; the printf formatting runs on the logging thread.
+                 * Calls using conversions that cannot be captured (%n, wide strings) are still formatted by the caller.
+                 */
+                bool deferFormatting;
+            };
+
+            /**
+             * Default behavior logger. Logging threads hand lines to a bounded lock-free queue, and a background thread
+             * drains it and writes each batch to file with a single write and flush. This implementation also rolls the
+             * file every hour, and optionally once it reaches a size limit.
              */
             class AWS_CORE_API DefaultLogSystem : public FormattedLogSystem
             {
@@ -47,26 +87,47 @@ namespace Aws
                 /**
                  * Initialize the logging system to write to the supplied logfile output. Creates logging thread on construction.
                  */
-                DefaultLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile);
+                DefaultLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile,
+                    const DefaultLogSystemOptions& options = DefaultLogSystemOptions());
                 /**
                  * Initialize the logging system to write to a computed file path filenamePrefix + "timestamp.log". Creates logging thread
                  * on construction.
                  */
-                DefaultLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix);
+                DefaultLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix,
+                    const DefaultLogSystemOptions& options = DefaultLogSystemOptions());
                 virtual ~DefaultLogSystem();
 
                 /**
-                 * Structure containing semaphores, queue etc... 
+                 * Number of lines discarded because the queue was full, under LogOverflowPolicy::Drop.
+                 */
+                uint64_t GetDroppedLineCount() const { return m_syncData.m_droppedLines.load(); }
+
+                /**
+                 * Number of lines written out by the logging thread.
+                 */
+                uint64_t GetWrittenLineCount() const { return m_syncData.m_writtenLines.load(); }
+
+                /**
+                 * Structure containing the queue, semaphores etc...
+                 * The mutexes are only taken to sleep or wake up; handing a line to the logging thread is lock free.
                  */
                 struct LogSynchronizationData
                 {
                 public:
-                    LogSynchronizationData() : m_stopLogging(false) {}
+                    LogSynchronizationData(size_t queueCapacity) :
+                        m_queuedLogMessages(queueCapacity), m_stopLogging(false), m_loggerSleeping(false), m_blockedProducers(0),
+                        m_droppedLines(0), m_writtenLines(0) {}
 
+                    LogMessageRing m_queuedLogMessages;
                     std::mutex m_logQueueMutex;
                     std::condition_variable m_queueSignal;
-                    Aws::Queue<Aws::String> m_queuedLogMessages;
+                    std::mutex m_spaceMutex;
+                    std::condition_variable m_spaceSignal;
                     std::atomic<bool> m_stopLogging;
+                    std::atomic<bool> m_loggerSleeping;
+                    std::atomic<uint32_t> m_blockedProducers;
+                    std::atomic<uint64_t> m_droppedLines;
+                    std::atomic<uint64_t> m_writtenLines;
 
                 private:
                     LogSynchronizationData(const LogSynchronizationData& rhs) = delete;
@@ -75,15 +136,21 @@ namespace Aws
 
             protected:
                 /**
-                 * Pushes log onto the queue and notifies the background thread.
+                 * Pushes log onto the queue and wakes the background thread if it is asleep.
                  */
                 virtual void ProcessFormattedStatement(Aws::String&& statement) override;
 
+                /**
+                 * Queues the captured record as is; the background thread expands it.
+                 */
+                virtual void ProcessDeferredStatement(Aws::String&& record) override;
+
             private:
                 DefaultLogSystem(const DefaultLogSystem& rhs) = delete;
                 DefaultLogSystem& operator =(const DefaultLogSystem& rhs) = delete;
 
                 LogSynchronizationData m_syncData;
+                LogOverflowPolicy m_overflowPolicy;
 
                 std::thread m_loggingThread;
             };
@@ -18,6 +18,7 @@
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/utils/logging/LogSystemInterface.h>
 #include <aws/core/utils/logging/LogLevel.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
 
 #include <atomic>
 
@@ -36,9 +37,10 @@ namespace Aws
                 using Base = LogSystemInterface;
 
                 /**
-                 * Initializes log system with logLevel
+                 * Initializes log system with logLevel. With deferFormatting, Log() only captures its arguments and the text is
+                 * produced by ProcessDeferredStatement(), which implementations can move off the calling thread.
                  */
-                FormattedLogSystem(LogLevel logLevel);
+                FormattedLogSystem(LogLevel logLevel, bool deferFormatting = false);
                 virtual ~FormattedLogSystem() = default;
 
                 /**
@@ -60,6 +62,16 @@ namespace Aws
                  */
                 virtual void LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream &messageStream) override;
 
+                /**
+                 * True if statement is a captured record rather than a formatted line.
+                 */
+                static bool IsDeferredStatement(const Aws::String& statement) { return !statement.empty() && statement[0] == '\0'; }
+
+                /**
+                 * Appends the formatted line for a captured record to out. Returns false if the record is malformed.
+                 */
+                static bool ExpandDeferredStatement(const Aws::String& record, Aws::String& out);
+
             protected:
                 /**
                  * This is the method that most logger implementations will want to override.
@@ -67,8 +79,17 @@ namespace Aws
                  */                
                 virtual void ProcessFormattedStatement(Aws::String&& statement) = 0;
 
+                /**
+                 * Receives the captured form of a Log() call when formatting is deferred. The default implementation expands
+                 * it right away and passes the result to ProcessFormattedStatement.
+                 */
+                virtual void ProcessDeferredStatement(Aws::String&& record);
+
+                bool IsFormattingDeferred() const { return m_deferFormatting; }
+
             private:
                 std::atomic<LogLevel> m_logLevel;
+                bool m_deferFormatting;
             };
 
         } // namespace Logging
@@ -0,0 +1,57 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstdarg>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            /**
+             * Appends a self-contained copy of a printf style format string and its arguments to record, so the text can be
+             * produced later, on another thread or in another process. String arguments are copied, so the caller's buffers
+             * need not outlive the call.
+             * Returns false, leaving record unchanged, if the format uses a conversion that cannot be captured (%n, wide
+             * characters and wide strings); format eagerly in that case.
+             */
+            AWS_CORE_API bool CaptureFormatArguments(const char* formatStr, va_list args, Aws::String& record);
+
+            /**
+             * Formats a capture written by CaptureFormatArguments starting at cursor, appending the text to out.
+             * On success cursor is advanced past the capture. Returns false if the capture is truncated or malformed.
+             */
+            AWS_CORE_API bool FormatCapturedArguments(const char*& cursor, const char* end, Aws::String& out);
+
+            /**
+             * Like CaptureFormatArguments, but only the arguments are appended; the caller keeps track of the format string.
+             */
+            AWS_CORE_API bool CaptureArguments(const char* formatStr, va_list args, Aws::String& record);
+
+            /**
+             * Formats arguments written by CaptureArguments against the same format string.
+             */
+            AWS_CORE_API bool FormatCapturedArguments(const char* formatStr, size_t formatLength, const char*& cursor, const char* end,
+                Aws::String& out);
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,80 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <atomic>
+#include <cstddef>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            /**
+             * A bounded multi-producer, single-consumer queue of log lines. Producers claim a slot with a single compare-and-swap
+             * and never take a lock; the consumer is the logging thread. Capacity is rounded up to a power of two.
+             */
+            class AWS_CORE_API LogMessageRing
+            {
+            public:
+                LogMessageRing(std::size_t capacity);
+                ~LogMessageRing();
+
+                LogMessageRing(const LogMessageRing&) = delete;
+                LogMessageRing& operator=(const LogMessageRing&) = delete;
+
+                /**
+                 * Moves message into the ring. Returns false, leaving message untouched, if the ring is full. Safe to call from
+                 * any number of threads.
+                 */
+                bool TryPush(Aws::String&& message);
+
+                /**
+                 * Moves the oldest message into message. Returns false if the ring is empty. Only one thread may pop.
+                 */
+                bool TryPop(Aws::String& message);
+
+                /**
+                 * True if there is nothing to pop. Only meaningful on the consumer thread.
+                 */
+                bool IsEmpty() const;
+
+                std::size_t GetCapacity() const { return m_mask + 1; }
+
+            private:
+                struct Slot
+                {
+                    std::atomic<std::size_t> sequence;
+                    Aws::String message;
+                };
+
+                Slot* m_slots;
+                std::size_t m_mask;
+
+                // producers and the consumer write different cache lines
+                char m_padding0[64];
+                std::atomic<std::size_t> m_enqueuePosition;
+                char m_padding1[64];
+                std::size_t m_dequeuePosition;
+            };
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,178 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Memory
+        {
+            class BufferPool;
+
+            /**
+             * Counters reported by BufferPool::GetStats().
+             */
+            struct AWS_CORE_API BufferPoolStats
+            {
+                BufferPoolStats() : hits(0), misses(0), retained(0), dropped(0), retainedBytes(0) {}
+
+                /**
+                 * Leases served from a retained buffer.
+                 */
+                uint64_t hits;
+                /**
+                 * Leases that had to allocate.
+                 */
+                uint64_t misses;
+                /**
+                 * Returned buffers kept for reuse.
+                 */
+                uint64_t retained;
+                /**
+                 * Returned buffers freed because the pool was full or they were too large to pool.
+                 */
+                uint64_t dropped;
+                /**
+                 * Bytes currently held by the pool.
+                 */
+                std::size_t retainedBytes;
+
+                /**
+                 * Fraction of leases served without allocating, between 0 and 1.
+                 */
+                double GetHitRate() const { return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(hits + misses); }
+            };
+
+            /**
+             * A buffer leased from a BufferPool. Move-only; the buffer goes back to its pool when this is destroyed or Release()d.
+             * The contents of a freshly leased buffer are unspecified.
+             */
+            class AWS_CORE_API PooledBuffer
+            {
+            public:
+                PooledBuffer() : m_data(nullptr), m_capacity(0), m_pool(nullptr) {}
+                PooledBuffer(PooledBuffer&& other);
+                PooledBuffer& operator=(PooledBuffer&& other);
+                ~PooledBuffer() { Release(); }
+
+                PooledBuffer(const PooledBuffer&) = delete;
+                PooledBuffer& operator=(const PooledBuffer&) = delete;
+
+                unsigned char* GetData() const { return m_data; }
+                std::size_t GetCapacity() const { return m_capacity; }
+                explicit operator bool() const { return m_data != nullptr; }
+
+                /**
+                 * Hands the buffer back to the pool early. Afterwards this object is empty.
+                 */
+                void Release();
+
+            private:
+                PooledBuffer(unsigned char* data, std::size_t capacity, BufferPool* pool) : m_data(data), m_capacity(capacity), m_pool(pool) {}
+
+                unsigned char* m_data;
+                std::size_t m_capacity;
+                BufferPool* m_pool;
+
+                friend class BufferPool;
+            };
+
+            /**
+             * A thread-safe pool of large byte buffers, for bodies and transfer buffers that would otherwise be allocated and freed
+             * on every call. Buffers come in power-of-two size classes from 4KB up to the pool's largest class; a lease gets the
+             * smallest class that fits, and larger leases are allocated exactly and never retained. Retention is bounded both per
+             * class and in total bytes, so an idle pool never holds more than maxRetainedBytes. Every lease must be returned
+             * before the pool is destroyed.
+             */
+            class AWS_CORE_API BufferPool
+            {
+            public:
+                static const std::size_t MIN_BUFFER_SIZE = 4 * 1024;
+                static const std::size_t DEFAULT_MAX_BUFFER_SIZE = 16 * 1024 * 1024;
+                static const std::size_t DEFAULT_MAX_RETAINED_BYTES = 64 * 1024 * 1024;
+                static const std::size_t DEFAULT_MAX_BUFFERS_PER_CLASS = 64;
+
+                /**
+                 * maxBufferSize is rounded up to a power of two and is the largest size that is pooled.
+                 */
+                BufferPool(std::size_t maxBufferSize = DEFAULT_MAX_BUFFER_SIZE, std::size_t maxRetainedBytes = DEFAULT_MAX_RETAINED_BYTES,
+                    std::size_t maxBuffersPerClass = DEFAULT_MAX_BUFFERS_PER_CLASS);
+                ~BufferPool();
+
+                BufferPool(const BufferPool&) = delete;
+                BufferPool& operator=(const BufferPool&) = delete;
+
+                /**
+                 * Leases a buffer of at least minimumSize bytes. Returns an empty PooledBuffer only if allocation fails.
+                 */
+                PooledBuffer Lease(std::size_t minimumSize);
+
+                BufferPoolStats GetStats() const;
+
+                /**
+                 * Frees every retained buffer. Outstanding leases are unaffected.
+                 */
+                void Trim();
+
+            private:
+                static const std::size_t MAX_SIZE_CLASSES = 24;
+
+                struct FreeBuffer
+                {
+                    FreeBuffer* next;
+                };
+
+                struct SizeClass
+                {
+                    SizeClass() : head(nullptr), count(0) {}
+
+                    std::mutex lock;
+                    FreeBuffer* head;
+                    std::size_t count;
+                };
+
+                std::size_t SizeClassFor(std::size_t size) const;
+                void Return(unsigned char* data, std::size_t capacity);
+
+                friend class PooledBuffer;
+
+                SizeClass m_classes[MAX_SIZE_CLASSES];
+                std::size_t m_classCount;
+                std::size_t m_maxRetainedBytes;
+                std::size_t m_maxBuffersPerClass;
+                std::atomic<std::size_t> m_retainedBytes;
+                std::atomic<uint64_t> m_hits;
+                std::atomic<uint64_t> m_misses;
+                std::atomic<uint64_t> m_retained;
+                std::atomic<uint64_t> m_dropped;
+            };
+
+            /**
+             * Process-wide pool used by the SDK's pooled streams. Its retained buffers are freed by Aws::ShutdownAPI.
+             */
+            AWS_CORE_API BufferPool& GetDefaultBufferPool();
+
+        } // namespace Memory
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,159 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/MemorySystemInterface.h>
+
+#include <cstddef>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Memory
+        {
+            /**
+             * A bump-pointer arena for short-lived allocations. Allocating is a pointer increment; freeing only reclaims the most
+             * recent block, and everything else is released at once when the arena is destroyed. Not thread safe.
+             */
+            class AWS_CORE_API MemoryArena : public MemorySystemInterface
+            {
+            public:
+                static const std::size_t DEFAULT_CHUNK_SIZE = 16 * 1024;
+
+                MemoryArena(std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+                ~MemoryArena();
+
+                MemoryArena(const MemoryArena&) = delete;
+                MemoryArena& operator=(const MemoryArena&) = delete;
+
+                void Begin() override {}
+                void End() override {}
+
+                void* AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag = nullptr) override;
+                void FreeMemory(void* memoryPtr) override;
+
+                /**
+                 * Returns true if memoryPtr was handed out by this arena. Blocks outside the address range spanned by the
+                 * arena's chunks, which is everything on a thread's Aws::Free path that did not come from an arena, are
+                 * turned away by that one range check; the chunk list is only walked for addresses inside it.
+                 */
+                bool Owns(const void* memoryPtr) const
+                {
+                    const char* address = static_cast<const char*>(memoryPtr);
+                    return address >= m_lowestAddress && address < m_highestAddress && OwnsWithinRange(address);
+                }
+
+                /**
+                 * Number of blocks handed out since construction.
+                 */
+                std::size_t GetAllocationCount() const { return m_allocationCount; }
+
+                /**
+                 * Number of chunks obtained from the system allocator since construction.
+                 */
+                std::size_t GetChunkCount() const { return m_chunkCount; }
+
+                /**
+                 * The arena that was installed on this thread when this one was, or nullptr.
+                 */
+                MemoryArena* GetOuterArena() const { return m_outerArena; }
+
+            private:
+                struct Chunk
+                {
+                    Chunk* next;
+                    std::size_t size;
+                };
+
+                void* AllocateChunk(std::size_t minimumSize);
+                bool OwnsWithinRange(const char* address) const;
+
+                std::size_t m_chunkSize;
+                Chunk* m_chunks;
+                char* m_cursor;
+                char* m_limit;
+                char* m_lastAllocation;
+                const char* m_lowestAddress;
+                const char* m_highestAddress;
+                std::size_t m_allocationCount;
+                std::size_t m_chunkCount;
+
+                MemoryArena* m_outerArena;
+                friend class ScopedMemoryArena;
+            };
+
+            /**
+             * Installs an arena on the calling thread for the lifetime of this object. Blocks from the arena that are freed
+             * through Aws::Free on this thread go back to it; allocations are only routed to it inside an ArenaAllocationScope.
+             * Anything allocated from the arena must be freed, on this thread, before this object is destroyed.
+             * When enabled is false nothing is installed and the object does nothing.
+             */
+            class AWS_CORE_API ScopedMemoryArena
+            {
+            public:
+                ScopedMemoryArena(std::size_t chunkSize = MemoryArena::DEFAULT_CHUNK_SIZE, bool enabled = true);
+                ~ScopedMemoryArena();
+
+                ScopedMemoryArena(const ScopedMemoryArena&) = delete;
+                ScopedMemoryArena& operator=(const ScopedMemoryArena&) = delete;
+
+                MemoryArena& GetArena() { return m_arena; }
+
+            private:
+                MemoryArena m_arena;
+                bool m_enabled;
+                bool m_outerRouting;
+            };
+
+            /**
+             * Routes the calling thread's Aws::Malloc calls to its installed arena for the lifetime of this object. Only wrap
+             * code whose allocations stay on this thread and do not outlive the arena; in particular nothing that logs or
+             * updates shared caches. Does nothing if no arena is installed, or when enabled is false.
+             */
+            class AWS_CORE_API ArenaAllocationScope
+            {
+            public:
+                ArenaAllocationScope(bool enabled = true);
+                ~ArenaAllocationScope();
+
+                ArenaAllocationScope(const ArenaAllocationScope&) = delete;
+                ArenaAllocationScope& operator=(const ArenaAllocationScope&) = delete;
+
+            private:
+                bool m_enabled;
+                bool m_outerRouting;
+            };
+
+            /**
+             * The arena installed on the calling thread, or nullptr.
+             */
+            AWS_CORE_API MemoryArena* GetThreadMemoryArena();
+
+            /**
+             * The arena allocations on the calling thread are currently routed to, or nullptr.
+             */
+            AWS_CORE_API MemoryArena* GetThreadAllocationArena();
+
+            /**
+             * The installed arena, or one it is nested in, that owns memoryPtr; nullptr if the block came from elsewhere.
+             */
+            AWS_CORE_API MemoryArena* FindOwningThreadArena(const void* memoryPtr);
+
+        } // namespace Memory
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,142 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/MemorySystemInterface.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Memory
+        {
+            /**
+             * Aggregate allocation statistics for one allocation tag. In a diff every field is the change between two snapshots.
+             */
+            struct AWS_CORE_API TagMemoryStats
+            {
+                TagMemoryStats() : liveBytes(0), liveAllocations(0), totalBytes(0), totalAllocations(0), highWaterBytes(0) {}
+
+                Aws::String tag;
+                int64_t liveBytes;
+                int64_t liveAllocations;
+                int64_t totalBytes;
+                int64_t totalAllocations;
+                int64_t highWaterBytes;
+            };
+
+            /**
+             * Point-in-time copy of the per-tag statistics of a TagProfilingMemorySystem, ordered by live bytes, largest first.
+             */
+            class AWS_CORE_API MemoryProfileSnapshot
+            {
+            public:
+                const Aws::Vector<TagMemoryStats>& GetTags() const { return m_tags; }
+
+                /**
+                 * Stats for tag, or nullptr if nothing was allocated with it.
+                 */
+                const TagMemoryStats* Find(const Aws::String& tag) const;
+
+                int64_t GetLiveBytes() const;
+                int64_t GetLiveAllocations() const;
+
+                /**
+                 * Per-tag change from earlier to this snapshot. Tags that did not change are left out.
+                 */
+                MemoryProfileSnapshot Diff(const MemoryProfileSnapshot& earlier) const;
+
+                /**
+                 * One line per tag, suitable for logging.
+                 */
+                Aws::String ToString() const;
+
+            private:
+                void Sort();
+
+                Aws::Vector<TagMemoryStats> m_tags;
+                friend class TagProfilingMemorySystem;
+            };
+
+            /**
+             * A memory system for use with InitializeAWSMemorySystem() that attributes every allocation to its allocation tag
+             * ("AWSClient", "CurlHttpClient", ...) and keeps live bytes, allocation counts and high-water marks per tag, so growth
+             * can be traced back to the subsystem responsible. Tags are tracked in shards with their own locks. Memory comes from
+             * the wrapped memory system if one is given, otherwise from malloc. Tags are identified by pointer, and are expected
+             * to be string literals; at most MAX_TAGS distinct tag pointers are tracked and the rest are reported as OVERFLOW_TAG.
+             */
+            class AWS_CORE_API TagProfilingMemorySystem : public MemorySystemInterface
+            {
+            public:
+                static const std::size_t MAX_TAGS = 1024;
+                static const char* OVERFLOW_TAG;
+                static const char* UNTAGGED_TAG;
+
+                TagProfilingMemorySystem(MemorySystemInterface* wrappedSystem = nullptr);
+
+                TagProfilingMemorySystem(const TagProfilingMemorySystem&) = delete;
+                TagProfilingMemorySystem& operator=(const TagProfilingMemorySystem&) = delete;
+
+                void Begin() override;
+                void End() override;
+
+                void* AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag = nullptr) override;
+                void FreeMemory(void* memoryPtr) override;
+
+                /**
+                 * Copies the current statistics. Tags that share the same text are merged.
+                 */
+                MemoryProfileSnapshot TakeSnapshot() const;
+
+            private:
+                static const std::size_t SHARD_COUNT = 16;
+                static const std::size_t SLOTS_PER_SHARD = MAX_TAGS / SHARD_COUNT;
+
+                struct TagSlot
+                {
+                    const char* tag;
+                    bool used;
+                    int64_t liveBytes;
+                    int64_t liveAllocations;
+                    int64_t totalBytes;
+                    int64_t totalAllocations;
+                    int64_t highWaterBytes;
+                };
+
+                struct Shard
+                {
+                    mutable std::mutex lock;
+                    TagSlot slots[SLOTS_PER_SHARD];
+                    TagSlot overflow;
+                };
+
+                uint32_t Record(const char* allocationTag, std::size_t blockSize);
+                void Release(uint32_t slotIndex, std::size_t blockSize);
+
+                MemorySystemInterface* m_wrappedSystem;
+                Shard m_shards[SHARD_COUNT];
+            };
+
+        } // namespace Memory
+    } // namespace Utils
+} // namespace Aws
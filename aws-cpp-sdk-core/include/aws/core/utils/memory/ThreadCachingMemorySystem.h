@@ -0,0 +1,107 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/MemorySystemInterface.h>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Memory
+        {
+            /**
+             * A pooling memory system for use with InitializeAWSMemorySystem(). Small blocks, which make up nearly all of the SDK's
+             * allocations (strings, map nodes, shared_ptr control blocks), are served from size classes of up to 1KB. Each thread
+             * keeps its own free lists per class, so the common path takes no locks; threads trade blocks with a shared pool in
+             * batches. Larger blocks go straight to malloc. Memory held by the pools is returned to the system on destruction,
+             * so the instance must outlive every allocation made through it.
+             */
+            class AWS_CORE_API ThreadCachingMemorySystem : public MemorySystemInterface
+            {
+            public:
+                ThreadCachingMemorySystem();
+                ~ThreadCachingMemorySystem();
+
+                ThreadCachingMemorySystem(const ThreadCachingMemorySystem&) = delete;
+                ThreadCachingMemorySystem& operator=(const ThreadCachingMemorySystem&) = delete;
+
+                void Begin() override {}
+                void End() override {}
+
+                void* AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag = nullptr) override;
+                void FreeMemory(void* memoryPtr) override;
+
+                /**
+                 * Bytes obtained from malloc to back the size-class pools.
+                 */
+                std::size_t GetPooledBytes() const { return m_pooledBytes.load(); }
+
+                /**
+                 * Largest block size served from the pools; anything bigger is allocated directly.
+                 */
+                static std::size_t GetMaxPooledBlockSize();
+
+            private:
+                static const std::size_t SIZE_CLASS_COUNT = 20;
+
+                struct Block
+                {
+                    Block* next;
+                };
+
+                struct ThreadCache
+                {
+                    ThreadCachingMemorySystem* owner;
+                    ThreadCache* previousCache;
+                    ThreadCache* nextCache;
+                    Block* freeLists[SIZE_CLASS_COUNT];
+                    std::size_t freeCounts[SIZE_CLASS_COUNT];
+                };
+
+                struct CentralFreeList
+                {
+                    CentralFreeList() : head(nullptr), count(0) {}
+
+                    std::mutex lock;
+                    Block* head;
+                    std::size_t count;
+                };
+
+                ThreadCache* GetThreadCache();
+                ThreadCache* AttachThreadCache();
+                void DetachThreadCache(ThreadCache* cache);
+                Block* AllocateFromCentral(std::size_t sizeClass, ThreadCache* cache);
+                void ReturnToCentral(std::size_t sizeClass, Block* head, Block* tail, std::size_t count);
+                Block* CarveSpan(std::size_t sizeClass, Block*& tail, std::size_t& count);
+
+                friend struct ThreadCacheHolder;
+
+                CentralFreeList m_centralLists[SIZE_CLASS_COUNT];
+                std::mutex m_spanLock;
+                void* m_spans;
+                std::atomic<std::size_t> m_pooledBytes;
+                ThreadCache* m_threadCaches;
+            };
+
+        } // namespace Memory
+    } // namespace Utils
+} // namespace Aws
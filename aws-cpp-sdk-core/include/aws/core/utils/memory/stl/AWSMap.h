@@ -35,6 +35,6 @@ struct CompareStrings
     }
 };
 
-template<typename V> using CStringMap = std::map<const char*, V, CompareStrings, Aws::Allocator<std::pair<const char*, V> > >;
+template<typename V> using CStringMap = std::map<const char*, V, CompareStrings, Aws::Allocator<std::pair<const char* const, V> > >;
 
 } // namespace Aws
@@ -0,0 +1,212 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+#include <aws/core/utils/memory/stl/AWSFunction.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace RateLimits
+        {
+            /**
+             * The complete mutable state of an AtomicRateLimiter. Both fields are plain lock-free atomics, so the state can
+             * live in memory shared by several processes; all zero is a valid state.
+             */
+            struct AtomicRateLimiterState
+            {
+                AtomicRateLimiterState() : paidUntil(0), ticksPerUnit(0) {}
+
+                /// Clock time at which every cost applied so far is paid for; at most one DUR in the past (a full bucket)
+                std::atomic<int64_t> paidUntil;
+
+                /// Clock ticks one unit of cost takes to replenish at the current rate
+                std::atomic<int64_t> ticksPerUnit;
+            };
+
+            /**
+             * Lock-free rate limiter with the same budget semantics as DefaultRateLimiter (with rate renormalization): a full
+             * bucket holds one DUR worth of rate, and the cost of a call is paid by the calls after it.
+             *
+             * Instead of an accumulator guarded by a mutex, the whole state is a single atomic: the time at which the
+             * outstanding cost will have been paid off. ApplyCost, TryAcquire and GetTimeUntilAvailable are one
+             * compare-and-swap each, so concurrent transfers sharing a limiter never block one another.
+             */
+            template<typename CLOCK = std::chrono::high_resolution_clock, typename DUR = std::chrono::seconds>
+            class AtomicRateLimiter : public RateLimiterInterface
+            {
+            public:
+                using Base = RateLimiterInterface;
+
+                using InternalTimePointType = std::chrono::time_point<CLOCK>;
+                using ElapsedTimeFunctionType = std::function< InternalTimePointType() >;
+
+                AtomicRateLimiter(int64_t maxRate, ElapsedTimeFunctionType elapsedTimeFunction = AWS_BUILD_FUNCTION(CLOCK::now)) :
+                    m_elapsedTimeFunction(elapsedTimeFunction),
+                    m_ownState(),
+                    m_state(&m_ownState)
+                {
+                    static_assert(std::chrono::duration_cast<typename CLOCK::duration>(DUR(1)).count() > 0, "Rate duration must be at least one clock tick");
+
+                    SetRate(maxRate, true);
+                }
+
+                virtual ~AtomicRateLimiter() = default;
+
+                /**
+                 * Calculates time in milliseconds that should be delayed before letting anymore data through.
+                 */
+                virtual DelayType ApplyCost(int64_t cost) override
+                {
+                    int64_t now = Now();
+                    int64_t costTicks = CostToTicks(cost, m_state->ticksPerUnit.load(std::memory_order_relaxed));
+                    int64_t paidUntil = m_state->paidUntil.load(std::memory_order_relaxed);
+                    int64_t start;
+                    do
+                    {
+                        start = std::max(paidUntil, now - BucketTicks());
+                    } while (!m_state->paidUntil.compare_exchange_weak(paidUntil, start + costTicks, std::memory_order_relaxed));
+
+                    return TicksToDelay(start - now, false);
+                }
+
+                /**
+                 * Same as ApplyCost() but then goes ahead and sleeps the current thread.
+                 */
+                virtual void ApplyAndPayForCost(int64_t cost) override
+                {
+                    DelayType delay = ApplyCost(cost);
+                    if (delay.count() > 0)
+                    {
+                        std::this_thread::sleep_for(delay);
+                    }
+                }
+
+                /**
+                 * Applies the cost only if no earlier cost is still outstanding; never charges on failure.
+                 */
+                virtual bool TryAcquire(int64_t cost) override
+                {
+                    int64_t now = Now();
+                    int64_t costTicks = CostToTicks(cost, m_state->ticksPerUnit.load(std::memory_order_relaxed));
+                    int64_t paidUntil = m_state->paidUntil.load(std::memory_order_relaxed);
+                    int64_t start;
+                    do
+                    {
+                        start = std::max(paidUntil, now - BucketTicks());
+                        if (start > now)
+                        {
+                            return false;
+                        }
+                    } while (!m_state->paidUntil.compare_exchange_weak(paidUntil, start + costTicks, std::memory_order_relaxed));
+
+                    return true;
+                }
+
+                /**
+                 * Rounded up, so that a TryAcquire() made once the delay has passed succeeds.
+                 */
+                virtual DelayType GetTimeUntilAvailable() override
+                {
+                    return TicksToDelay(m_state->paidUntil.load(std::memory_order_relaxed) - Now(), true);
+                }
+
+                /**
+                 * Update the bandwidth rate to allow. The outstanding delay is preserved across rate changes.
+                 */
+                virtual void SetRate(int64_t rate, bool resetAccumulator = false) override
+                {
+                    // rate must always be positive
+                    rate = std::max(static_cast<int64_t>(1), rate);
+                    m_state->ticksPerUnit.store((BucketTicks() << FRACTION_BITS) / rate, std::memory_order_relaxed);
+
+                    if (resetAccumulator)
+                    {
+                        m_state->paidUntil.store(Now() - BucketTicks(), std::memory_order_relaxed);
+                    }
+                }
+
+            protected:
+                /**
+                 * Runs against externally owned state, which must outlive the limiter. Unless resetState is set, the
+                 * outstanding delay already recorded in the state is kept.
+                 */
+                AtomicRateLimiter(AtomicRateLimiterState* state, int64_t maxRate, bool resetState, ElapsedTimeFunctionType elapsedTimeFunction = AWS_BUILD_FUNCTION(CLOCK::now)) :
+                    m_elapsedTimeFunction(elapsedTimeFunction),
+                    m_ownState(),
+                    m_state(state ? state : &m_ownState)
+                {
+                    SetRate(maxRate, resetState);
+                }
+
+            private:
+                /// ticksPerUnit is fixed point with this many fractional bits
+                static const int FRACTION_BITS = 16;
+
+                static int64_t BucketTicks()
+                {
+                    return std::chrono::duration_cast<typename CLOCK::duration>(DUR(1)).count();
+                }
+
+                static int64_t CostToTicks(int64_t cost, int64_t ticksPerUnit)
+                {
+                    const int64_t fractionMask = (static_cast<int64_t>(1) << FRACTION_BITS) - 1;
+                    // split so that large costs do not overflow before the shift
+                    return (cost >> FRACTION_BITS) * ticksPerUnit + (((cost & fractionMask) * ticksPerUnit) >> FRACTION_BITS);
+                }
+
+                static DelayType TicksToDelay(int64_t ticks, bool roundUp)
+                {
+                    if (ticks <= 0)
+                    {
+                        return DelayType(0);
+                    }
+
+                    typename CLOCK::duration duration(ticks);
+                    DelayType delay = std::chrono::duration_cast<DelayType>(duration);
+                    if (roundUp && delay < duration)
+                    {
+                        ++delay;
+                    }
+                    return delay;
+                }
+
+                int64_t Now() const
+                {
+                    return m_elapsedTimeFunction().time_since_epoch().count();
+                }
+
+                /// Function that returns the current time
+                ElapsedTimeFunctionType m_elapsedTimeFunction;
+
+                /// State used when none is supplied by a derived class
+                AtomicRateLimiterState m_ownState;
+
+                /// State every operation works on
+                AtomicRateLimiterState* m_state;
+            };
+
+        } // namespace RateLimits
+    } // namespace Utils
+} // namespace Aws
@@ -48,6 +48,23 @@ namespace Aws
                 * Update the bandwidth rate to allow.
                 */
                 virtual void SetRate(int64_t rate, bool resetAccumulator = false) = 0;
+                /**
+                * Applies the cost only if doing so would not require a delay, and reports whether it did. Lets transports that
+                * must not block reschedule instead of sleeping. The default is built on ApplyCost() and is not atomic.
+                */
+                virtual bool TryAcquire(int64_t cost)
+                {
+                    if (ApplyCost(0).count() > 0)
+                    {
+                        return false;
+                    }
+                    ApplyCost(cost);
+                    return true;
+                }
+                /**
+                * Time until TryAcquire() can next succeed.
+                */
+                virtual DelayType GetTimeUntilAvailable() { return ApplyCost(0); }
             };
 
         } // namespace RateLimits
@@ -0,0 +1,90 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/ratelimiter/AtomicRateLimiter.h>
+
+#include <chrono>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace RateLimits
+        {
+            /**
+             * Maps the named segment holding the state of a SharedMemoryRateLimiter, and unmaps it on destruction.
+             */
+            class AWS_CORE_API SharedRateLimiterSegment
+            {
+            public:
+                SharedRateLimiterSegment(const char* name);
+                ~SharedRateLimiterSegment();
+
+                SharedRateLimiterSegment(const SharedRateLimiterSegment&) = delete;
+                SharedRateLimiterSegment& operator=(const SharedRateLimiterSegment&) = delete;
+
+                /**
+                 * The limiter state inside the segment, or null if the segment could not be mapped.
+                 */
+                AtomicRateLimiterState* GetState() const { return m_state; }
+
+            private:
+                void* m_data;
+                void* m_handle;
+                AtomicRateLimiterState* m_state;
+            };
+
+            /**
+             * AtomicRateLimiter whose state lives in a named shared memory segment, so that every process on the host
+             * constructing a limiter with the same name draws from one budget (e.g. one per service egress or RPS budget).
+             *
+             * The state is updated only with single compare-and-swaps on steady clock time, which every process on the host
+             * agrees on, and no lock is ever held across processes: a process dying mid-call leaves either its whole charge
+             * or none of it, and never blocks the survivors. Every process should be configured with the same rate; the
+             * most recent constructor or SetRate() call wins. If the segment cannot be mapped, the failure is logged and the
+             * limiter falls back to limiting only the current process.
+             */
+            class AWS_CORE_API SharedMemoryRateLimiter : private SharedRateLimiterSegment, public AtomicRateLimiter<std::chrono::steady_clock, std::chrono::seconds>
+            {
+            public:
+                using Base = AtomicRateLimiter<std::chrono::steady_clock, std::chrono::seconds>;
+
+                /**
+                 * Joins (or creates) the budget called name. Names follow the platform's rules for shared memory objects:
+                 * no path separators, and a "Global\\" prefix on Windows to share across sessions.
+                 */
+                SharedMemoryRateLimiter(const char* name, int64_t maxRate, ElapsedTimeFunctionType elapsedTimeFunction = AWS_BUILD_FUNCTION(std::chrono::steady_clock::now));
+
+                virtual ~SharedMemoryRateLimiter() = default;
+
+                /**
+                 * False if the segment could not be mapped and this limiter only limits the current process.
+                 */
+                bool IsShared() const { return GetState() != nullptr; }
+
+                /**
+                 * Removes the segment called name, e.g. on deployment teardown. Processes still attached keep sharing the
+                 * old segment, while processes attaching afterwards start a new, full budget.
+                 */
+                static bool Remove(const char* name);
+            };
+
+        } // namespace RateLimits
+    } // namespace Utils
+} // namespace Aws
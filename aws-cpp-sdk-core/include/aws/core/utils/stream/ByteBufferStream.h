@@ -0,0 +1,62 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * A seekable iostream that reads and writes a caller-owned buffer in place, so an in-memory payload can be
+             * sent as a request body without being copied into a stringbuf. The buffer must outlive the stream.
+             */
+            class AWS_CORE_API ByteBufferStream : public Aws::IOStream
+            {
+            public:
+                /**
+                 * Streams over the contents of buffer.
+                 */
+                ByteBufferStream(Aws::Utils::ByteBuffer& buffer);
+                /**
+                 * Streams over length bytes starting at buffer.
+                 */
+                ByteBufferStream(unsigned char* buffer, size_t length);
+                /**
+                 * Streams over length read-only bytes starting at buffer; writes to the stream fail.
+                 */
+                ByteBufferStream(const unsigned char* buffer, size_t length);
+
+                ByteBufferStream(const ByteBufferStream&) = delete;
+                ByteBufferStream& operator=(const ByteBufferStream&) = delete;
+
+                /**
+                 * Number of bytes visible through this stream.
+                 */
+                size_t GetLength() const { return m_streamBuf.GetLength(); }
+
+            private:
+                PreallocatedStreamBuf m_streamBuf;
+            };
+        } //namespace Stream
+    } //namespace Utils
+} //namespace Aws
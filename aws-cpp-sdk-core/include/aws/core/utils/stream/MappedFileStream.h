@@ -0,0 +1,71 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * A read-only, seekable iostream over a memory-mapped file. Large uploads read straight from the page cache
+             * instead of going through buffered ifstream reads, and rewinding for signing or retries is free.
+             * If the file cannot be mapped the stream starts in a bad state.
+             */
+            class AWS_CORE_API MappedFileStream : public Aws::IOStream
+            {
+            public:
+                /**
+                 * Maps the file at path for reading.
+                 */
+                MappedFileStream(const char* path);
+                ~MappedFileStream();
+
+                MappedFileStream(const MappedFileStream&) = delete;
+                MappedFileStream& operator=(const MappedFileStream&) = delete;
+
+                /**
+                 * Returns true if the file was mapped successfully.
+                 */
+                bool IsMapped() const { return m_region.mapped; }
+
+                /**
+                 * Size of the mapped file in bytes.
+                 */
+                size_t GetLength() const { return m_region.length; }
+
+            private:
+                struct MappedRegion
+                {
+                    const unsigned char* data;
+                    size_t length;
+                    void* handle;
+                    bool mapped;
+                };
+
+                static MappedRegion MapRegion(const char* path);
+
+                MappedRegion m_region;
+                PreallocatedStreamBuf m_streamBuf;
+            };
+        } //namespace Stream
+    } //namespace Utils
+} //namespace Aws
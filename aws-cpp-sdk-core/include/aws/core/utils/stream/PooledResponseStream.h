@@ -0,0 +1,92 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/BufferPool.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <streambuf>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * A seekable, growable stream buffer whose storage is leased from a BufferPool instead of being allocated per
+             * stream. Growing leases the next size class and copies the content over; the lease goes back to the pool when
+             * the buffer is destroyed. Nothing is leased until the first write.
+             */
+            class AWS_CORE_API PooledStreamBuf : public std::streambuf
+            {
+            public:
+                PooledStreamBuf(Aws::Utils::Memory::BufferPool& pool = Aws::Utils::Memory::GetDefaultBufferPool());
+
+                PooledStreamBuf(const PooledStreamBuf&) = delete;
+                PooledStreamBuf& operator=(const PooledStreamBuf&) = delete;
+
+                /**
+                 * Total number of bytes written so far.
+                 */
+                size_t GetSize() const;
+
+            protected:
+                int_type underflow() override;
+                int_type overflow(int_type c) override;
+                std::streamsize xsputn(const char* s, std::streamsize n) override;
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+
+            private:
+                void UpdateSize();
+                bool Reserve(size_t capacity);
+                void SetAreas(size_t readPosition, size_t writePosition);
+
+                Aws::Utils::Memory::BufferPool& m_pool;
+                Aws::Utils::Memory::PooledBuffer m_buffer;
+                size_t m_size;
+            };
+
+            /**
+             * A response stream backed by a PooledStreamBuf. Useful for operations issued at high rates, where allocating
+             * and growing a fresh body buffer for every response shows up in allocator profiles.
+             */
+            class AWS_CORE_API PooledResponseStream : public Aws::IOStream
+            {
+            public:
+                PooledResponseStream(Aws::Utils::Memory::BufferPool& pool = Aws::Utils::Memory::GetDefaultBufferPool());
+
+                size_t GetSize() const { return m_streamBuf.GetSize(); }
+
+            private:
+                PooledStreamBuf m_streamBuf;
+            };
+
+            /**
+             * Response stream factory method that creates a PooledResponseStream over the default buffer pool.
+             */
+            AWS_CORE_API Aws::IOStream* PooledResponseStreamFactoryMethod();
+
+            /**
+             * Builds a response stream factory over the given pool, which must outlive every stream the factory creates.
+             */
+            AWS_CORE_API Aws::IOStreamFactory BuildPooledResponseStreamFactory(Aws::Utils::Memory::BufferPool& pool);
+
+        } //namespace Stream
+    } //namespace Utils
+} //namespace Aws
@@ -0,0 +1,76 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <streambuf>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * A stream buffer that reads and writes directly into a buffer it does not own. Nothing is copied and
+             * nothing grows: writes past the end of the buffer fail. Get and put positions are both seekable, so
+             * signers can hash the content and retries can rewind it. The buffer must outlive this object.
+             */
+            class AWS_CORE_API PreallocatedStreamBuf : public std::streambuf
+            {
+            public:
+                /**
+                 * Wraps lengthToUse bytes starting at buffer. Reads start at the beginning and see the whole buffer.
+                 */
+                PreallocatedStreamBuf(unsigned char* buffer, size_t lengthToUse);
+
+                /**
+                 * Wraps lengthToUse read-only bytes starting at buffer. There is no put area, so writes and output seeks fail.
+                 */
+                PreallocatedStreamBuf(const unsigned char* buffer, size_t lengthToUse);
+
+                PreallocatedStreamBuf(const PreallocatedStreamBuf&) = delete;
+                PreallocatedStreamBuf& operator=(const PreallocatedStreamBuf&) = delete;
+
+                /**
+                 * Get the buffer that is being used by this stream buffer.
+                 */
+                unsigned char* GetBuffer() { return m_underlyingBuffer; }
+
+                /**
+                 * Returns true if this stream buffer was created over read-only memory.
+                 */
+                bool IsReadOnly() const { return m_readOnly; }
+
+                /**
+                 * Get the length of the buffer that is being used by this stream buffer.
+                 */
+                size_t GetLength() const { return m_lengthToUse; }
+
+            protected:
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+
+            private:
+                unsigned char* m_underlyingBuffer;
+                size_t m_lengthToUse;
+                bool m_readOnly;
+            };
+        } //namespace Stream
+    } //namespace Utils
+} //namespace Aws
@@ -0,0 +1,166 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <atomic>
+#include <streambuf>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        class FStreamWithFileName;
+
+        namespace Stream
+        {
+            /**
+             * Bytes a single spilling response stream keeps in memory before moving to disk, unless told otherwise.
+             */
+            static const size_t DEFAULT_SPILL_MEMORY_THRESHOLD = 8 * 1024 * 1024;
+
+            /**
+             * A process-wide cap on the memory held by response bodies. Streams reserve bytes before buffering them and
+             * spill to disk once a reservation fails. Thread safe.
+             */
+            class AWS_CORE_API ResponseMemoryBudget
+            {
+            public:
+                ResponseMemoryBudget(size_t limitInBytes);
+
+                /**
+                 * Reserves bytes against the budget. Returns false, reserving nothing, if that would exceed the limit.
+                 */
+                bool TryReserve(size_t bytes);
+
+                /**
+                 * Returns bytes previously reserved with TryReserve.
+                 */
+                void Release(size_t bytes);
+
+                /**
+                 * Changes the limit. Reservations already granted are kept even if they now exceed it.
+                 */
+                void SetLimit(size_t limitInBytes) { m_limit.store(limitInBytes); }
+                size_t GetLimit() const { return m_limit.load(); }
+                size_t GetBytesInUse() const { return m_bytesInUse.load(); }
+
+            private:
+                std::atomic<size_t> m_limit;
+                std::atomic<size_t> m_bytesInUse;
+            };
+
+            /**
+             * The budget shared by spilling response streams that are not given one explicitly. Defaults to 64MB.
+             */
+            AWS_CORE_API ResponseMemoryBudget& GetDefaultResponseMemoryBudget();
+
+            /**
+             * A seekable stream buffer that keeps its content in memory until either its own threshold or the shared budget
+             * is reached, then moves everything written so far into a temporary file and continues there. The temporary
+             * file is removed when the buffer is destroyed. If the file cannot be created, content stays in memory.
+             */
+            class AWS_CORE_API SpillingStreamBuf : public std::streambuf
+            {
+            public:
+                /**
+                 * spillFilePrefix is prepended to the temporary file name, and may include a directory. When it is empty, the file
+                 * goes in the system temp directory (Aws::FileSystem::GetTempDirectory()).
+                 */
+                SpillingStreamBuf(size_t memoryThreshold, ResponseMemoryBudget& budget, const Aws::String& spillFilePrefix = "");
+                ~SpillingStreamBuf();
+
+                SpillingStreamBuf(const SpillingStreamBuf&) = delete;
+                SpillingStreamBuf& operator=(const SpillingStreamBuf&) = delete;
+
+                /**
+                 * Returns true once the content has moved to a temporary file.
+                 */
+                bool HasSpilled() const { return m_spillFile != nullptr; }
+
+                /**
+                 * Total number of bytes written so far.
+                 */
+                size_t GetSize() const { return m_size; }
+
+            protected:
+                int_type underflow() override;
+                int_type pbackfail(int_type c) override;
+                std::streamsize showmanyc() override;
+                int_type overflow(int_type c) override;
+                std::streamsize xsputn(const char* s, std::streamsize n) override;
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                int sync() override;
+
+            private:
+                size_t GetReadPosition() const;
+                void ResetGetArea(size_t readPosition);
+                bool ReserveMemory(size_t newSize);
+                bool Spill();
+
+                size_t m_memoryThreshold;
+                ResponseMemoryBudget& m_budget;
+                Aws::String m_spillFilePrefix;
+
+                Aws::String m_memory;
+                size_t m_reservedBytes;
+                bool m_spillFailed;
+
+                Aws::UniquePtr<Aws::Utils::FStreamWithFileName> m_spillFile;
+                char m_readBuffer[4096];
+
+                size_t m_size;
+                size_t m_readPosition;
+                size_t m_writePosition;
+                size_t m_getAreaOffset;
+            };
+
+            /**
+             * A response stream that buffers small bodies in memory and transparently spills large ones to disk, so callers
+             * don't have to pick a stream type per call to keep process memory bounded.
+             */
+            class AWS_CORE_API SpillingResponseStream : public Aws::IOStream
+            {
+            public:
+                SpillingResponseStream(size_t memoryThreshold = DEFAULT_SPILL_MEMORY_THRESHOLD,
+                    ResponseMemoryBudget& budget = GetDefaultResponseMemoryBudget(), const Aws::String& spillFilePrefix = "");
+
+                bool HasSpilled() const { return m_streamBuf.HasSpilled(); }
+
+            private:
+                SpillingStreamBuf m_streamBuf;
+            };
+
+            /**
+             * Response stream factory method that creates a SpillingResponseStream with the default threshold and budget.
+             */
+            AWS_CORE_API Aws::IOStream* SpillingResponseStreamFactoryMethod();
+
+            /**
+             * Builds a response stream factory with a custom threshold, budget and temporary file prefix. The budget must
+             * outlive every stream the factory creates.
+             */
+            AWS_CORE_API Aws::IOStreamFactory BuildSpillingResponseStreamFactory(size_t memoryThreshold,
+                ResponseMemoryBudget& budget = GetDefaultResponseMemoryBudget(), const Aws::String& spillFilePrefix = "");
+
+        } //namespace Stream
+    } //namespace Utils
+} //namespace Aws
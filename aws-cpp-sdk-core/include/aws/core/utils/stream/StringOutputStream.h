@@ -0,0 +1,86 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <streambuf>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * A write-only stream buffer that appends everything written to it to an Aws::String it owns. There is no
+             * intermediate put area, so the string always holds exactly what has been written and can be handed out
+             * without the copy stringbuf::str() makes.
+             */
+            class AWS_CORE_API StringAppendStreamBuf : public std::streambuf
+            {
+            public:
+                /**
+                 * Reserves initialCapacity bytes up front.
+                 */
+                StringAppendStreamBuf(size_t initialCapacity);
+
+                StringAppendStreamBuf(const StringAppendStreamBuf&) = delete;
+                StringAppendStreamBuf& operator=(const StringAppendStreamBuf&) = delete;
+
+                const Aws::String& GetString() const { return m_buffer; }
+                Aws::String& GetString() { return m_buffer; }
+
+            protected:
+                int_type overflow(int_type ch) override;
+                std::streamsize xsputn(const char_type* s, std::streamsize n) override;
+
+            private:
+                Aws::String m_buffer;
+            };
+
+            /**
+             * Output stream for building a string, e.g. a form encoded request body, in one preallocated buffer.
+             * Unlike Aws::StringStream the result is moved out rather than copied.
+             */
+            class AWS_CORE_API StringOutputStream : public Aws::OStream
+            {
+            public:
+                StringOutputStream(size_t initialCapacity = DEFAULT_INITIAL_CAPACITY);
+
+                StringOutputStream(const StringOutputStream&) = delete;
+                StringOutputStream& operator=(const StringOutputStream&) = delete;
+
+                /**
+                 * Everything written so far.
+                 */
+                const Aws::String& GetString() const { return m_streamBuf.GetString(); }
+
+                /**
+                 * Moves the contents out, leaving the stream empty.
+                 */
+                Aws::String TakeString();
+
+                static const size_t DEFAULT_INITIAL_CAPACITY = 256;
+
+            private:
+                StringAppendStreamBuf m_streamBuf;
+            };
+        } //namespace Stream
+    } //namespace Utils
+} //namespace Aws
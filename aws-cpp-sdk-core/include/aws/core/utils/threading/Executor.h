@@ -19,7 +19,9 @@
 #include <aws/core/utils/memory/stl/AWSFunction.h>
 #include <aws/core/utils/memory/stl/AWSQueue.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/memory/AWSMemory.h>
 #include <functional>
+#include <future>
 #include <mutex>
 #include <condition_variable>
 
@@ -49,6 +51,26 @@ namespace Aws
                     return SubmitToThread(AWS_BUILD_TYPED_FUNCTION(std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...), void()));
                 }
 
+                /**
+                 * Runs fn on this executor and returns a future for its result; this is what the *Callable client methods use
+                 * instead of std::async, so they share the client's threads.
+                 * If the executor rejects the task, fn runs on the calling thread before this returns, so the future is always
+                 * satisfied.
+                 */
+                template<class Fn>
+                auto SubmitCallable(Fn&& fn) -> std::future<decltype(fn())>
+                {
+                    typedef decltype(fn()) ResultType;
+                    // std::function needs a copyable target, and packaged_task is move only
+                    auto task = Aws::MakeShared<std::packaged_task<ResultType()>>("Executor", std::forward<Fn>(fn));
+                    std::future<ResultType> result = task->get_future();
+                    if (!Submit([task]() { (*task)(); }))
+                    {
+                        (*task)();
+                    }
+                    return result;
+                }
+
 
             protected:
                 /**
@@ -76,7 +98,7 @@ namespace Aws
             };
 
             /**
-            * Thread Pool Executor implementation.
+            * Thread Pool Executor implementation. Threads are started as tasks are submitted, up to poolSize.
             */
             class AWS_CORE_API PooledThreadExecutor : public Executor
             {
@@ -0,0 +1,212 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/SmallTask.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+             * Lanes of a PriorityExecutor, most urgent first.
+             */
+            enum class TaskPriority
+            {
+                High = 0,
+                Normal = 1,
+                Low = 2
+            };
+
+            static const size_t TASK_PRIORITY_COUNT = 3;
+
+            /**
+             * Sets the priority of everything this thread submits to a PriorityExecutor while the scope is alive, including
+             * the tasks queued by client *Async and *Callable calls. Scopes nest.
+             */
+            class AWS_CORE_API ScopedTaskPriority
+            {
+            public:
+                ScopedTaskPriority(TaskPriority priority);
+                ~ScopedTaskPriority();
+
+                ScopedTaskPriority(const ScopedTaskPriority&) = delete;
+                ScopedTaskPriority& operator=(const ScopedTaskPriority&) = delete;
+
+                /**
+                 * Priority of the innermost scope on this thread; Normal outside any scope.
+                 */
+                static TaskPriority GetCurrent();
+
+            private:
+                TaskPriority m_previous;
+            };
+
+            /**
+             * What Submit() does when a bounded PriorityExecutor is full.
+             */
+            enum class BackpressurePolicy
+            {
+                /**
+                 * Wait for room. Submissions from the executor's own workers run on the caller instead, since waiting there
+                 * could deadlock the pool.
+                 */
+                Block,
+                /**
+                 * Run the task on the submitting thread, which naturally slows the producer down.
+                 */
+                CallerRuns,
+                /**
+                 * Fail the submission.
+                 */
+                Reject
+            };
+
+            /**
+             * Point-in-time copy of a LatencyHistogram. Bucket i counts samples below 2^i microseconds (and at least 2^(i-1)).
+             */
+            struct AWS_CORE_API LatencyHistogramSnapshot
+            {
+                static const size_t BUCKET_COUNT = 40;
+
+                LatencyHistogramSnapshot();
+
+                uint64_t GetCount() const;
+                /**
+                 * Upper bound, in microseconds, of the bucket holding the given percentile (0-100). 0 when empty.
+                 */
+                uint64_t GetPercentileUpperBoundMicros(double percentile) const;
+                Aws::String ToString() const;
+
+                uint64_t counts[BUCKET_COUNT];
+            };
+
+            /**
+             * Lock-free power-of-two latency histogram.
+             */
+            class AWS_CORE_API LatencyHistogram
+            {
+            public:
+                LatencyHistogram();
+
+                void Record(std::chrono::microseconds latency);
+                LatencyHistogramSnapshot GetSnapshot() const;
+
+            private:
+                std::atomic<uint64_t> m_counts[LatencyHistogramSnapshot::BUCKET_COUNT];
+            };
+
+            struct AWS_CORE_API PriorityExecutorMetrics
+            {
+                PriorityExecutorMetrics();
+
+                size_t queueDepth[TASK_PRIORITY_COUNT];
+                uint64_t submitted;
+                uint64_t rejected;
+                uint64_t ranOnCaller;
+                uint64_t blockedSubmissions;
+                /**
+                 * Time from submission until a worker picked the task up.
+                 */
+                LatencyHistogramSnapshot queueWait;
+                LatencyHistogramSnapshot runTime;
+            };
+
+            /**
+            * Thread pool executor with priority lanes and an optional bound on queued tasks.
+            * Workers always take the most urgent queued task, except that every starvationGuard-th pick goes to the least
+            * urgent non-empty lane, so bulk work keeps moving under sustained interactive load.
+            * Submit() uses the priority of the current ScopedTaskPriority; SubmitWithPriority() names it explicitly.
+            * As with PooledThreadExecutor, tasks still queued at destruction are discarded.
+            */
+            class AWS_CORE_API PriorityExecutor : public Executor
+            {
+            public:
+                /**
+                 * maxQueuedTasks of 0 means unbounded.
+                 */
+                PriorityExecutor(size_t poolSize, size_t maxQueuedTasks = 0, BackpressurePolicy backpressurePolicy = BackpressurePolicy::Block,
+                    size_t starvationGuard = 16);
+                ~PriorityExecutor();
+
+                PriorityExecutor(const PriorityExecutor&) = delete;
+                PriorityExecutor& operator =(const PriorityExecutor&) = delete;
+                PriorityExecutor(PriorityExecutor&&) = delete;
+                PriorityExecutor& operator =(PriorityExecutor&&) = delete;
+
+                template<class Fn>
+                bool SubmitWithPriority(TaskPriority priority, Fn&& fn)
+                {
+                    return Enqueue(priority, SmallTask(std::forward<Fn>(fn)));
+                }
+
+                PriorityExecutorMetrics GetMetrics() const;
+
+            protected:
+                bool SubmitToThread(std::function<void()>&&) override;
+
+            private:
+                struct QueuedTask
+                {
+                    QueuedTask() {}
+                    QueuedTask(SmallTask&& task) : m_task(std::move(task)), m_enqueued(std::chrono::steady_clock::now()) {}
+
+                    SmallTask m_task;
+                    std::chrono::steady_clock::time_point m_enqueued;
+                };
+
+                bool Enqueue(TaskPriority priority, SmallTask&& task);
+                bool PopLocked(QueuedTask& task);
+                void RunTimed(SmallTask& task);
+                void WorkerLoop();
+
+                Aws::Deque<QueuedTask> m_lanes[TASK_PRIORITY_COUNT];
+                size_t m_queuedTasks;
+                size_t m_picksSinceStarvationGuard;
+                const size_t m_maxQueuedTasks;
+                const BackpressurePolicy m_backpressurePolicy;
+                const size_t m_starvationGuard;
+                bool m_stop;
+
+                mutable std::mutex m_lock;
+                std::condition_variable m_workAvailable;
+                std::condition_variable m_spaceAvailable;
+                Aws::Vector<std::thread> m_workers;
+
+                std::atomic<uint64_t> m_submitted;
+                std::atomic<uint64_t> m_rejected;
+                std::atomic<uint64_t> m_ranOnCaller;
+                std::atomic<uint64_t> m_blockedSubmissions;
+                LatencyHistogram m_queueWait;
+                LatencyHistogram m_runTime;
+            };
+
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
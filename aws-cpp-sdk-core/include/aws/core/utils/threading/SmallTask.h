@@ -0,0 +1,173 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+             * Move-only void() callable that keeps small functors, including a moved-in std::function, inside the object
+             * instead of on the heap. Larger functors fall back to Aws::New.
+             */
+            class SmallTask
+            {
+            public:
+                static const size_t INLINE_SIZE = 48;
+
+                SmallTask() : m_ops(nullptr) {}
+
+                template<typename Fn, typename = typename std::enable_if<!std::is_same<typename std::decay<Fn>::type, SmallTask>::value>::type>
+                SmallTask(Fn&& fn) : m_ops(nullptr)
+                {
+                    typedef typename std::decay<Fn>::type Functor;
+                    Emplace<Functor>(std::forward<Fn>(fn), std::integral_constant<bool, FitsInline<Functor>::value>());
+                }
+
+                SmallTask(SmallTask&& other) : m_ops(nullptr)
+                {
+                    MoveFrom(other);
+                }
+
+                SmallTask& operator=(SmallTask&& other)
+                {
+                    if (this != &other)
+                    {
+                        Reset();
+                        MoveFrom(other);
+                    }
+                    return *this;
+                }
+
+                ~SmallTask()
+                {
+                    Reset();
+                }
+
+                SmallTask(const SmallTask&) = delete;
+                SmallTask& operator=(const SmallTask&) = delete;
+
+                void operator()()
+                {
+                    m_ops->invoke(&m_storage);
+                }
+
+                explicit operator bool() const { return m_ops != nullptr; }
+
+                /**
+                 * True if the functor lives on the heap rather than inside this object.
+                 */
+                bool IsHeapAllocated() const { return m_ops != nullptr && m_ops->heap; }
+
+                void Reset()
+                {
+                    if (m_ops)
+                    {
+                        m_ops->destroy(&m_storage);
+                        m_ops = nullptr;
+                    }
+                }
+
+            private:
+                typedef std::aligned_storage<INLINE_SIZE>::type Storage;
+
+                struct Operations
+                {
+                    void (*invoke)(void* storage);
+                    void (*move)(void* from, void* to);
+                    void (*destroy)(void* storage);
+                    bool heap;
+                };
+
+                template<typename Functor>
+                struct FitsInline
+                {
+                    static const bool value = sizeof(Functor) <= sizeof(Storage) &&
+                        std::alignment_of<Storage>::value % std::alignment_of<Functor>::value == 0 &&
+                        std::is_nothrow_move_constructible<Functor>::value;
+                };
+
+                template<typename Functor>
+                struct InlineOperations
+                {
+                    static void Invoke(void* storage) { (*static_cast<Functor*>(storage))(); }
+                    static void Move(void* from, void* to)
+                    {
+                        new (to) Functor(std::move(*static_cast<Functor*>(from)));
+                        static_cast<Functor*>(from)->~Functor();
+                    }
+                    static void Destroy(void* storage) { static_cast<Functor*>(storage)->~Functor(); }
+                    static const Operations* Get()
+                    {
+                        static const Operations operations = { &Invoke, &Move, &Destroy, false };
+                        return &operations;
+                    }
+                };
+
+                template<typename Functor>
+                struct HeapOperations
+                {
+                    static void Invoke(void* storage) { (**static_cast<Functor**>(storage))(); }
+                    static void Move(void* from, void* to) { *static_cast<Functor**>(to) = *static_cast<Functor**>(from); }
+                    static void Destroy(void* storage) { Aws::Delete(*static_cast<Functor**>(storage)); }
+                    static const Operations* Get()
+                    {
+                        static const Operations operations = { &Invoke, &Move, &Destroy, true };
+                        return &operations;
+                    }
+                };
+
+                template<typename Functor, typename Fn>
+                void Emplace(Fn&& fn, std::true_type)
+                {
+                    new (&m_storage) Functor(std::forward<Fn>(fn));
+                    m_ops = InlineOperations<Functor>::Get();
+                }
+
+                template<typename Functor, typename Fn>
+                void Emplace(Fn&& fn, std::false_type)
+                {
+                    *reinterpret_cast<Functor**>(&m_storage) = Aws::New<Functor>("SmallTask", std::forward<Fn>(fn));
+                    m_ops = HeapOperations<Functor>::Get();
+                }
+
+                void MoveFrom(SmallTask& other)
+                {
+                    if (other.m_ops)
+                    {
+                        other.m_ops->move(&other.m_storage, &m_storage);
+                        m_ops = other.m_ops;
+                        other.m_ops = nullptr;
+                    }
+                }
+
+                Storage m_storage;
+                const Operations* m_ops;
+            };
+
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,100 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/SmallTask.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+            * Thread pool executor where every worker owns a task deque. Work submitted from outside the pool is spread
+            * round robin over the workers; work submitted from inside a task goes to the current worker's own deque.
+            * Workers take their own newest task first, steal the oldest task of another worker when they run dry, spin
+            * briefly and then park. Tasks are stored by value in SmallTask, so submitting does not allocate a node per task.
+            *
+            * A drop-in alternative to PooledThreadExecutor: as there, tasks still queued at destruction are discarded.
+            */
+            class AWS_CORE_API WorkStealingExecutor : public Executor
+            {
+            public:
+                /**
+                 * With OverflowPolicy::REJECT_IMMEDIATELY, Submit() fails once poolSize tasks are waiting to run.
+                 */
+                WorkStealingExecutor(size_t poolSize, OverflowPolicy overflowPolicy = OverflowPolicy::QUEUE_TASKS_EVENLY_ACCROSS_THREADS);
+                ~WorkStealingExecutor();
+
+                WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+                WorkStealingExecutor& operator =(const WorkStealingExecutor&) = delete;
+                WorkStealingExecutor(WorkStealingExecutor&&) = delete;
+                WorkStealingExecutor& operator =(WorkStealingExecutor&&) = delete;
+
+                /**
+                 * Queues a functor without wrapping it in std::function first.
+                 */
+                template<class Fn>
+                bool Post(Fn&& fn)
+                {
+                    return Enqueue(SmallTask(std::forward<Fn>(fn)));
+                }
+
+                /**
+                 * Number of tasks a worker took from another worker's deque.
+                 */
+                size_t GetStealCount() const { return m_steals.load(); }
+
+            protected:
+                bool SubmitToThread(std::function<void()>&&) override;
+
+            private:
+                struct Worker
+                {
+                    std::mutex m_lock;
+                    Aws::Deque<SmallTask> m_tasks;
+                    std::thread m_thread;
+                };
+
+                bool Enqueue(SmallTask&& task);
+                bool TryPopOwn(size_t workerIndex, SmallTask& task);
+                bool TrySteal(size_t thiefIndex, SmallTask& task);
+                void WorkerLoop(size_t workerIndex);
+
+                Aws::Vector<Worker*> m_workers;
+                OverflowPolicy m_overflowPolicy;
+                std::atomic<bool> m_stop;
+                std::atomic<size_t> m_pendingTasks;
+                std::atomic<size_t> m_nextWorker;
+                std::atomic<size_t> m_sleepingWorkers;
+                std::atomic<size_t> m_steals;
+                std::mutex m_parkLock;
+                std::condition_variable m_parkSignal;
+            };
+
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
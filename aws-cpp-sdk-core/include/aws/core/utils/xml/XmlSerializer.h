@@ -21,6 +21,8 @@
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
+#include <cstring>
+
 namespace Aws
 {
     namespace External
@@ -54,8 +56,75 @@ namespace Aws
              */
             AWS_CORE_API Aws::String DecodeEscapedXmlText(const Aws::String& textToDecode);
 
+            /**
+             * Converts escaped xml text back to the original characters in a single pass over textToDecode.
+             */
+            AWS_CORE_API Aws::String DecodeEscapedXmlText(const char* textToDecode, size_t length);
+
             class XmlDocument;
 
+            /**
+             * Non-owning pointer plus length into character data that lives inside an XmlDocument.
+             * Only valid as long as the document it came from is alive and the node is not modified.
+             */
+            class XmlStringView
+            {
+            public:
+                XmlStringView() : m_data(""), m_length(0) {}
+
+                XmlStringView(const char* data, size_t length) : m_data(data), m_length(length) {}
+
+                const char* GetData() const { return m_data; }
+
+                size_t GetLength() const { return m_length; }
+
+                bool IsEmpty() const { return m_length == 0; }
+
+                /**
+                 * Returns a view with leading and trailing whitespace removed. Does not allocate.
+                 */
+                XmlStringView Trim() const
+                {
+                    const char* begin = m_data;
+                    const char* end = m_data + m_length;
+                    while (begin != end && IsSpace(*begin))
+                    {
+                        ++begin;
+                    }
+                    while (end != begin && IsSpace(*(end - 1)))
+                    {
+                        --end;
+                    }
+
+                    return XmlStringView(begin, static_cast<size_t>(end - begin));
+                }
+
+                /**
+                 * Copies the viewed characters into a new string.
+                 */
+                Aws::String ToString() const { return Aws::String(m_data, m_length); }
+
+                bool operator==(const char* other) const
+                {
+                    return std::strlen(other) == m_length && std::memcmp(m_data, other, m_length) == 0;
+                }
+
+                bool operator!=(const char* other) const { return !(*this == other); }
+
+                bool operator==(const Aws::String& other) const
+                {
+                    return other.size() == m_length && std::memcmp(m_data, other.c_str(), m_length) == 0;
+                }
+
+                bool operator!=(const Aws::String& other) const { return !(*this == other); }
+
+            private:
+                static bool IsSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f'; }
+
+                const char* m_data;
+                size_t m_length;
+            };
+
             /**
              * Node in an Xml Document
              */
@@ -74,6 +143,10 @@ namespace Aws
                  * Get the name of the node.
                  */
                 const Aws::String GetName() const;
+                /**
+                 * Get the name of the node without copying it out of the document.
+                 */
+                XmlStringView GetNameView() const;
                 /**
                  * Set the name of the node.
                  */
@@ -82,6 +155,11 @@ namespace Aws
                  * Get Value of an attribute specified by name.
                  */
                 const Aws::String GetAttributeValue(const Aws::String& name) const;
+                /**
+                 * Get Value of an attribute specified by name without copying it out of the document.
+                 * Returns an empty view if the attribute does not exist.
+                 */
+                XmlStringView GetAttributeValueView(const char* name) const;
                 /**
                  * Set an attribute at name to value
                  */
@@ -90,6 +168,12 @@ namespace Aws
                  * Get the inner text of the node (potentially includes other nodes)
                  */
                 Aws::String GetText() const;
+                /**
+                 * Get the text of a node that contains only character data (the common leaf value case) without
+                 * copying it out of the document. Entities are already decoded by the parser.
+                 * Returns an empty view if the node is empty or has child elements; use GetText() for mixed content.
+                 */
+                XmlStringView GetTextView() const;
                 /**
                  * Set the inner text of the node
                  */
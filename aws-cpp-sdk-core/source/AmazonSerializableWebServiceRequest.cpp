@@ -15,20 +15,43 @@
 
 #include <aws/core/AmazonSerializableWebServiceRequest.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
 
 using namespace Aws;
 
+namespace
+{
+    static const char* SERIALIZABLE_REQUEST_TAG = "AmazonSerializableWebServiceRequest";
+
+    /**
+     * Owns the serialized payload and reads straight out of it, so the body is never copied into a stringbuf.
+     */
+    class SerializedPayloadStream : public Aws::IOStream
+    {
+    public:
+        SerializedPayloadStream(Aws::String&& payload) :
+            Aws::IOStream(nullptr),
+            m_payload(std::move(payload)),
+            m_streamBuf(reinterpret_cast<unsigned char*>(&m_payload[0]), m_payload.size())
+        {
+            rdbuf(&m_streamBuf);
+        }
+
+    private:
+        Aws::String m_payload;
+        Aws::Utils::Stream::PreallocatedStreamBuf m_streamBuf;
+    };
+} // anonymous namespace
+
 std::shared_ptr<Aws::IOStream> AmazonSerializableWebServiceRequest::GetBody() const
 {
-    Aws::String&& payload = SerializePayload();
+    Aws::String payload = SerializePayload();
     std::shared_ptr<Aws::IOStream> payloadBody;
 
     if (!payload.empty())
     {
-      payloadBody = Aws::MakeShared<Aws::StringStream>("AmazonSerializableWebServiceRequest");
-      *payloadBody << payload;
+      payloadBody = Aws::MakeShared<SerializedPayloadStream>(SERIALIZABLE_REQUEST_TAG, std::move(payload));
     }
 
     return payloadBody;
 }
-
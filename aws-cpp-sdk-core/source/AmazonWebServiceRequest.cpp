@@ -21,6 +21,7 @@ using namespace Aws;
 
 AmazonWebServiceRequest::AmazonWebServiceRequest() :
     m_responseStreamFactory(AWS_BUILD_FUNCTION(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod)),
+    m_hasResponseStreamFactory(false),
     m_onDataReceived(nullptr),
     m_onDataSent(nullptr)
 {
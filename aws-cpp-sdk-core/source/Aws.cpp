@@ -15,6 +15,7 @@
 #include <aws/core/Aws.h>
 #include <aws/core/utils/logging/AWSLogging.h>
 #include <aws/core/utils/logging/DefaultLogSystem.h>
+#include <aws/core/utils/memory/BufferPool.h>
 
 namespace Aws
 {
@@ -104,6 +105,9 @@ namespace Aws
             Aws::Utils::Logging::ShutdownAWSLogging();
         }
 
+        //retained buffers must go back to the memory system that allocated them.
+        Aws::Utils::Memory::GetDefaultBufferPool().Trim();
+
 #ifdef USE_AWS_MEMORY_MANAGEMENT
         if(options.memoryManagementOptions.memoryManager)
         {
@@ -25,6 +25,7 @@
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/MemoryArena.h>
 #include <aws/core/utils/crypto/Sha256.h>
 #include <aws/core/utils/crypto/Sha256HMAC.h>
 
@@ -104,6 +105,28 @@ AWSAuthV4Signer::~AWSAuthV4Signer()
 }
 
 bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
+{
+    Aws::String payloadHash;
+    return SignRequest(request, payloadHash);
+}
+
+bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, Aws::String& payloadHash) const
+{
+    return SignPreparedRequest(request, CanonicalizeRequestSigningString(request, m_urlEscapePath), payloadHash);
+}
+
+Aws::String AWSAuthV4Signer::PrepareCanonicalRequest(Aws::Http::HttpRequest& request) const
+{
+    return CanonicalizeRequestSigningString(request, m_urlEscapePath);
+}
+
+bool AWSAuthV4Signer::SignPreparedRequest(Aws::Http::HttpRequest& request, const Aws::String& canonicalRequestPrefix) const
+{
+    Aws::String payloadHash;
+    return SignPreparedRequest(request, canonicalRequestPrefix, payloadHash);
+}
+
+bool AWSAuthV4Signer::SignPreparedRequest(Aws::Http::HttpRequest& request, const Aws::String& canonicalRequestPrefix, Aws::String& payloadHash) const
 {
     AWSCredentials credentials = m_credentialsProvider->GetAWSCredentials();
 
@@ -118,14 +141,19 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
         request.SetAwsSessionToken(credentials.GetSessionToken());
     }
 
-    Aws::String payloadHash(UNSIGNED_PAYLOAD);
+    Aws::String contentSha256(UNSIGNED_PAYLOAD);
     if(m_signPayloads || request.GetUri().GetScheme() != Http::Scheme::HTTPS)
     {
-        payloadHash.assign(ComputePayloadHash(request));
+        //a retry of the same payload passes in the hash from the previous attempt.
         if (payloadHash.empty())
         {
-            return false;
+            payloadHash = ComputePayloadHash(request);
+            if (payloadHash.empty())
+            {
+                return false;
+            }
         }
+        contentSha256 = payloadHash;
     }
     else
     {
@@ -133,40 +161,37 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
                 << " http scheme=" << Http::SchemeMapper::ToString(request.GetUri().GetScheme()));
     }
 
-    request.SetHeaderValue("x-amz-content-sha256", payloadHash);
+    request.SetHeaderValue(X_AMZ_CONTENT_SHA256_HEADER, contentSha256);
 
     //calculate date header to use in internal signature (this also goes into date header).
     Aws::String dateHeaderValue = DateTime::CalculateGmtTimestampAsString(LONG_DATE_FORMAT_STR);
     request.SetHeaderValue(AWS_DATE_HEADER, dateHeaderValue);
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
-
-    for (const auto& header : request.GetHeaders())
+    //the canonical request starts with the method, path and query string lines; the header lines go straight in after them.
+    //it is scratch space, so when the caller installed a request arena it is built there. Credentials, the cached signing
+    //key and logging stay outside that scope.
+    Aws::String canonicalRequestString;
+    Aws::String signedHeadersValue;
     {
-        headersStream << header.first << ":" << header.second << NEWLINE;
-        signedHeadersStream << header.first << ";";
-    }
-
-    Aws::String canonicalHeadersString = headersStream.str();
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
-
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue = signedHeadersStream.str();
-    //remove that last semi-colon
-    signedHeadersValue.erase(signedHeadersValue.length() - 1);
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value:" << signedHeadersValue);
+        Aws::Utils::Memory::ArenaAllocationScope arenaScope;
+        canonicalRequestString.assign(canonicalRequestPrefix);
+        for (const auto& header : request.GetHeaders())
+        {
+            canonicalRequestString.append(header.first).append(":").append(header.second).append(NEWLINE);
+            signedHeadersValue.append(header.first).append(";");
+        }
 
-    //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, m_urlEscapePath);
+        //remove that last semi-colon
+        signedHeadersValue.erase(signedHeadersValue.length() - 1);
 
-    //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(signedHeadersValue);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(payloadHash);
+        //append v4 stuff to the canonical request string.
+        canonicalRequestString.append(NEWLINE);
+        canonicalRequestString.append(signedHeadersValue);
+        canonicalRequestString.append(NEWLINE);
+        canonicalRequestString.append(contentSha256);
+    }
 
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value:" << signedHeadersValue);
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequestString);
 
     //now compute sha256 on that request string
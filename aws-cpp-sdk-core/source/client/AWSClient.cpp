@@ -15,15 +15,18 @@
 
 #include <aws/core/client/AWSClient.h>
 #include <aws/core/AmazonWebServiceRequest.h>
+#include <aws/core/AmazonSerializableWebServiceRequest.h>
 #include <aws/core/auth/AWSAuthSigner.h>
 #include <aws/core/client/AWSError.h>
 #include <aws/core/client/AWSErrorMarshaller.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/OperationRateLimits.h>
 #include <aws/core/client/RetryStrategy.h>
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/http/HttpResponse.h>
+#include <aws/core/utils/stream/ByteBufferStream.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/core/utils/Outcome.h>
@@ -37,6 +40,7 @@
 #include <thread>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/crypto/Factories.h>
+#include <aws/core/utils/memory/MemoryArena.h>
 
 
 using namespace Aws;
@@ -100,8 +104,11 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     m_retryStrategy(configuration.retryStrategy),
     m_writeRateLimiter(configuration.writeRateLimiter),
     m_readRateLimiter(configuration.readRateLimiter),
+    m_operationRateLimits(configuration.operationRateLimits),
     m_userAgent(configuration.userAgent),
-    m_hash(Aws::Utils::Crypto::CreateMD5Implementation())
+    m_hash(Aws::Utils::Crypto::CreateMD5Implementation()),
+    m_useRequestScopedArena(configuration.useRequestScopedArena),
+    m_responseStreamFactory(configuration.responseStreamFactory)
 {
     InitializeGlobalStatics();
 }
@@ -125,9 +132,20 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri,
     const Aws::AmazonWebServiceRequest& request,
     HttpMethod method) const
 {
+    //the arena must outlive body and headers, which may have been allocated from it. Callers that parse the response
+    //install it themselves, so that it covers the parse as well.
+    Aws::Utils::Memory::ScopedMemoryArena requestArena(Aws::Utils::Memory::MemoryArena::DEFAULT_CHUNK_SIZE, NeedsRequestArena());
+
+    //serialize the payload and compute its digests once; every attempt below sends the same body.
+    std::shared_ptr<Aws::IOStream> body;
+    Http::HeaderValueCollection headers;
+    PrepareRequestPayload(request, body, headers);
+    //filled in by the first signing and handed back to the signer on every retry.
+    Aws::String payloadHash;
+
     for (long retries = 0;; retries++)
     {
-        HttpResponseOutcome outcome = AttemptOneRequest(uri, request, method);
+        HttpResponseOutcome outcome = AttemptOneRequest(uri, request, body, headers, payloadHash, method);
         if (outcome.IsSuccess() || !m_retryStrategy->ShouldRetry(outcome.GetError(), retries))
         {
             AWS_LOG_TRACE(AWS_CLIENT_LOG_TAG, "Request was either successful, or we are now out of retries.");
@@ -142,10 +160,10 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri,
         {
             long sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), retries);
             AWS_LOG_WARN(AWS_CLIENT_LOG_TAG, "Request failed, now waiting %d ms before attempting again.", sleepMillis);
-            if(request.GetBody())
+            if(body)
             {
-                request.GetBody()->clear();
-                request.GetBody()->seekg(0);
+                body->clear();
+                body->seekg(0);
             }
 
             m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
@@ -153,6 +171,53 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri,
     }
 }
 
+HttpResponseOutcome AWSClient::AttemptExhaustively(const PreparedRequest& preparedRequest, const Aws::String& variablePart) const
+{
+    //the payload string must outlive body, which reads it in place.
+    Aws::String payload = preparedRequest.BuildBody(variablePart);
+    std::shared_ptr<Aws::IOStream> body = Aws::MakeShared<Aws::Utils::Stream::ByteBufferStream>(AWS_CLIENT_LOG_TAG,
+        reinterpret_cast<const unsigned char*>(payload.c_str()), payload.size());
+
+    Http::HeaderValueCollection headers;
+    headers[Http::CONTENT_LENGTH_HEADER] = StringUtils::to_string(payload.size());
+    if (preparedRequest.GetRequestTemplate().ShouldComputeContentMd5())
+    {
+        auto md5HashResult = const_cast<AWSClient*>(this)->m_hash->Calculate(*body);
+        body->clear();
+        body->seekg(0);
+        if(md5HashResult.IsSuccess())
+        {
+            headers[Http::CONTENT_MD5_HEADER] = HashingUtils::Base64Encode(md5HashResult.GetResult());
+        }
+    }
+
+    Aws::String payloadHash;
+
+    for (long retries = 0;; retries++)
+    {
+        HttpResponseOutcome outcome = AttemptOneRequest(preparedRequest, body, headers, payloadHash);
+        if (outcome.IsSuccess() || !m_retryStrategy->ShouldRetry(outcome.GetError(), retries))
+        {
+            AWS_LOG_TRACE(AWS_CLIENT_LOG_TAG, "Prepared request was either successful, or we are now out of retries.");
+            return outcome;
+        }
+        else if(!m_httpClient->IsRequestProcessingEnabled())
+        {
+            AWS_LOG_TRACE(AWS_CLIENT_LOG_TAG, "Prepared request was cancelled externally.");
+            return outcome;
+        }
+        else
+        {
+            long sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), retries);
+            AWS_LOG_WARN(AWS_CLIENT_LOG_TAG, "Prepared request failed, now waiting %d ms before attempting again.", sleepMillis);
+            body->clear();
+            body->seekg(0);
+
+            m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
+        }
+    }
+}
+
 HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri, HttpMethod method) const
 {
     for (long retries = 0;; retries++)
@@ -184,10 +249,32 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri,
     const Aws::AmazonWebServiceRequest& request,
     HttpMethod method) const
 {
-    std::shared_ptr<HttpRequest> httpRequest(CreateHttpRequest(uri, method, request.GetResponseStreamFactory()));
-    BuildHttpRequest(request, httpRequest);
+    std::shared_ptr<Aws::IOStream> body;
+    Http::HeaderValueCollection headers;
+    PrepareRequestPayload(request, body, headers);
+    Aws::String payloadHash;
 
-    if (!m_signer->SignRequest(*httpRequest))
+    return AttemptOneRequest(uri, request, body, headers, payloadHash, method);
+}
+
+HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri,
+    const Aws::AmazonWebServiceRequest& request,
+    const std::shared_ptr<Aws::IOStream>& body,
+    const Http::HeaderValueCollection& headers,
+    Aws::String& payloadHash,
+    HttpMethod method) const
+{
+    //wait for the operation throttles before signing, so a long wait cannot age the signature.
+    if (m_operationRateLimits)
+    {
+        m_operationRateLimits->ChargeRequest(request);
+    }
+
+    std::shared_ptr<HttpRequest> httpRequest(CreateHttpRequest(uri, method, GetResponseStreamFactory(request)));
+    BuildHttpRequest(request, body, headers, httpRequest);
+
+    //the body does not change between attempts, so the payload hash from the first signing is reused by the next ones.
+    if (!m_signer->SignRequest(*httpRequest, payloadHash))
     {
         AWS_LOG_ERROR(AWS_CLIENT_LOG_TAG, "Request signing failed. Returning error.");
         return HttpResponseOutcome(); // TODO: make a real error when error revamp reaches branch (SIGNING_ERROR)
@@ -208,9 +295,55 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri,
     return HttpResponseOutcome(httpResponse);
 }
 
+HttpResponseOutcome AWSClient::AttemptOneRequest(const PreparedRequest& preparedRequest,
+    const std::shared_ptr<Aws::IOStream>& body,
+    const Http::HeaderValueCollection& headers,
+    Aws::String& payloadHash) const
+{
+    const Aws::AmazonWebServiceRequest& request = preparedRequest.GetRequestTemplate();
+    if (m_operationRateLimits)
+    {
+        m_operationRateLimits->ChargeRequest(request);
+    }
+
+    //the uri is copied rather than parsed, and the headers need no serialization or common header pass.
+    std::shared_ptr<HttpRequest> httpRequest(CreateHttpRequest(preparedRequest.GetUri(), preparedRequest.GetMethod(), GetResponseStreamFactory(request)));
+    for (auto const& headerValue : preparedRequest.GetHeaders())
+    {
+        httpRequest->SetHeaderValue(headerValue.first, headerValue.second);
+    }
+    for (auto const& headerValue : headers)
+    {
+        httpRequest->SetHeaderValue(headerValue.first, headerValue.second);
+    }
+    httpRequest->AddContentBody(body);
+    httpRequest->SetDataReceivedEventHandler(request.GetDataReceivedEventHandler());
+    httpRequest->SetDataSentEventHandler(request.GetDataSentEventHandler());
+
+    if (!m_signer->SignPreparedRequest(*httpRequest, preparedRequest.GetCanonicalRequestPrefix(), payloadHash))
+    {
+        AWS_LOG_ERROR(AWS_CLIENT_LOG_TAG, "Request signing failed. Returning error.");
+        return HttpResponseOutcome(); // TODO: make a real error when error revamp reaches branch (SIGNING_ERROR)
+    }
+
+    AWS_LOG_DEBUG(AWS_CLIENT_LOG_TAG, "Prepared request successfully signed");
+    std::shared_ptr<HttpResponse> httpResponse(
+        m_httpClient->MakeRequest(*httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+
+    if (DoesResponseGenerateError(httpResponse))
+    {
+        AWS_LOG_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
+        return HttpResponseOutcome(BuildAWSError(httpResponse));
+    }
+
+    AWS_LOG_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned successful response.");
+
+    return HttpResponseOutcome(httpResponse);
+}
+
 HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri, HttpMethod method) const
 {
-    std::shared_ptr<HttpRequest> httpRequest(CreateHttpRequest(uri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod));
+    std::shared_ptr<HttpRequest> httpRequest(CreateHttpRequest(uri, method, m_responseStreamFactory ? m_responseStreamFactory : Aws::Utils::Stream::DefaultResponseStreamFactoryMethod));
     AddCommonHeaders(*httpRequest);
 
     if (!m_signer->SignRequest(*httpRequest))
@@ -313,12 +446,79 @@ void AWSClient::AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpReq
     }
 }
 
+bool AWSClient::NeedsRequestArena() const
+{
+    return m_useRequestScopedArena && Aws::Utils::Memory::GetThreadMemoryArena() == nullptr;
+}
+
+Aws::String AWSClient::ReadResponseBody(Aws::IOStream& responseBody) const
+{
+    //everything written is an upper bound on what is left to read, so the copy is sized once and reading allocates nothing.
+    std::streamoff written = responseBody.tellp();
+    Aws::String body;
+    if (written > 0)
+    {
+        Aws::Utils::Memory::ArenaAllocationScope arenaScope(m_useRequestScopedArena);
+        body.resize(static_cast<size_t>(written));
+    }
+
+    responseBody.read(&body[0], static_cast<std::streamsize>(body.size()));
+    body.resize(static_cast<size_t>(responseBody.gcount()));
+    if (responseBody.good())
+    {
+        //a stream that cannot report its size; whatever is left grows the copy outside the arena.
+        body.append(Aws::IStreamBufIterator(responseBody), Aws::IStreamBufIterator());
+    }
+    return body;
+}
+
+void AWSClient::PrepareRequestPayload(const Aws::AmazonWebServiceRequest& request,
+    std::shared_ptr<Aws::IOStream>& body, Http::HeaderValueCollection& headers) const
+{
+    {
+        //serialization is routed to the request arena; logging and the http client allocate normally.
+        Aws::Utils::Memory::ArenaAllocationScope arenaScope(m_useRequestScopedArena);
+        body = request.GetBody();
+        headers = request.GetHeaders();
+    }
+
+    if (request.ShouldComputeContentMd5() && body && headers.find(Http::CONTENT_MD5_HEADER) == headers.end())
+    {
+        AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Found body, and content-md5 needs to be set" <<
+           ", attempting to compute content-md5");
+
+        //changing the internal state of the hash computation is not a logical state
+        //change as far as constness goes for this class. Due to the platform specificness
+        //of hash computations, we can't control the fact that computing a hash mutates
+        //state on some platforms such as windows (but that isn't a concern of this class.
+        auto md5HashResult = const_cast<AWSClient*>(this)->m_hash->Calculate(*body);
+        body->clear();
+        body->seekg(0);
+        if(md5HashResult.IsSuccess())
+        {
+            headers[Http::CONTENT_MD5_HEADER] = HashingUtils::Base64Encode(md5HashResult.GetResult());
+        }
+    }
+}
+
 void AWSClient::BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
     const std::shared_ptr<HttpRequest>& httpRequest) const
+{
+    std::shared_ptr<Aws::IOStream> body;
+    Http::HeaderValueCollection headers;
+    PrepareRequestPayload(request, body, headers);
+
+    BuildHttpRequest(request, body, headers, httpRequest);
+}
+
+void AWSClient::BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
+    const std::shared_ptr<Aws::IOStream>& body,
+    const Http::HeaderValueCollection& headers,
+    const std::shared_ptr<HttpRequest>& httpRequest) const
 {
     //do headers first since the request likely will set content-length as it's own header.
-    AddHeadersToRequest(httpRequest, request.GetHeaders());
-    AddContentBodyToRequest(httpRequest, request.GetBody(), request.ShouldComputeContentMd5());
+    AddHeadersToRequest(httpRequest, headers);
+    AddContentBodyToRequest(httpRequest, body, request.ShouldComputeContentMd5());
 
     // Pass along handlers for processing data sent/received in bytes
     httpRequest->SetDataReceivedEventHandler(request.GetDataReceivedEventHandler());
@@ -327,11 +527,32 @@ void AWSClient::BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
     request.AddQueryStringParameters(httpRequest->GetUri());
 }
 
+PreparedRequest AWSClient::PrepareRequest(const Aws::String& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& requestTemplate,
+    const Aws::String& bodyPrefix, const Aws::String& bodySuffix,
+    HttpMethod method) const
+{
+    //build the request the way an attempt would, minus the body, and keep what every call will share.
+    std::shared_ptr<HttpRequest> httpRequest(CreateHttpRequest(uri, method, GetResponseStreamFactory(*requestTemplate)));
+    AddHeadersToRequest(httpRequest, requestTemplate->GetHeaders());
+    requestTemplate->AddQueryStringParameters(httpRequest->GetUri());
+    Aws::String canonicalRequestPrefix = m_signer->PrepareCanonicalRequest(*httpRequest);
+
+    return PreparedRequest(requestTemplate, httpRequest->GetUri(), method, httpRequest->GetHeaders(),
+        canonicalRequestPrefix, bodyPrefix, bodySuffix);
+}
+
 void AWSClient::AddCommonHeaders(HttpRequest& httpRequest) const
 {
     httpRequest.SetUserAgent(m_userAgent);
 }
 
+const Aws::IOStreamFactory& AWSClient::GetResponseStreamFactory(const Aws::AmazonWebServiceRequest& request) const
+{
+    //a factory set on the request wins; a configuration that cleared its factory falls back to the request's default.
+    return request.HasResponseStreamFactory() || !m_responseStreamFactory ? request.GetResponseStreamFactory() : m_responseStreamFactory;
+}
+
 Aws::String AWSClient::GeneratePresignedUrl(URI& uri, HttpMethod method, long long expirationInSeconds)
 {
     std::shared_ptr<HttpRequest> request = CreateHttpRequest(uri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
@@ -355,17 +576,66 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::String& uri,
     const Aws::AmazonWebServiceRequest& request,
     Http::HttpMethod method) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method));
+    Aws::Utils::Memory::ScopedMemoryArena requestArena(Aws::Utils::Memory::MemoryArena::DEFAULT_CHUNK_SIZE, NeedsRequestArena());
+    return ParseJsonResponse(request, BASECLASS::AttemptExhaustively(uri, request, method));
+}
+
+PreparedRequest AWSJsonClient::PrepareJsonRequest(const Aws::String& uri,
+    const std::shared_ptr<const Aws::AmazonSerializableWebServiceRequest>& requestTemplate,
+    const char* memberName,
+    Http::HttpMethod method) const
+{
+    //re-serialize the template without memberName, then open the object back up so the member can be appended last.
+    JsonValue payload(requestTemplate->SerializePayload());
+    JsonValue frozenPayload;
+    for (const auto& member : payload.GetAllObjects())
+    {
+        if (member.first != memberName)
+        {
+            frozenPayload.WithObject(member.first, member.second);
+        }
+    }
+
+    Aws::String bodyPrefix = frozenPayload.WriteCompact();
+    bodyPrefix.erase(bodyPrefix.find_last_of('}'));
+    if (bodyPrefix.find_first_not_of(" \t\r\n{") != Aws::String::npos)
+    {
+        bodyPrefix.append(",");
+    }
+    bodyPrefix.append("\"").append(memberName).append("\":");
+
+    return BASECLASS::PrepareRequest(uri, requestTemplate, bodyPrefix, "}", method);
+}
+
+JsonOutcome AWSJsonClient::MakeRequest(const PreparedRequest& preparedRequest,
+    const Utils::Json::JsonValue& memberValue) const
+{
+    Aws::Utils::Memory::ScopedMemoryArena requestArena(Aws::Utils::Memory::MemoryArena::DEFAULT_CHUNK_SIZE, NeedsRequestArena());
+    return ParseJsonResponse(preparedRequest.GetRequestTemplate(),
+        BASECLASS::AttemptExhaustively(preparedRequest, memberValue.WriteCompact()));
+}
+
+JsonOutcome AWSJsonClient::ParseJsonResponse(const Aws::AmazonWebServiceRequest& request, const HttpResponseOutcome& httpOutcome) const
+{
     if (!httpOutcome.IsSuccess())
     {
         return JsonOutcome(httpOutcome.GetError());
     }
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
+    {
+        JsonValue response(ReadResponseBody(httpOutcome.GetResult()->GetResponseBody()));
+        const std::shared_ptr<OperationRateLimits>& operationRateLimits = GetOperationRateLimits();
+        if (operationRateLimits && operationRateLimits->HasResponseCosts())
+        {
+            operationRateLimits->ChargeResponse(request, response);
+        }
+
         //this is stupid, but gcc doesn't pick up the covariant on the dereference so we have to give it a little hint.
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(httpOutcome.GetResult()->GetResponseBody()),
+        return JsonOutcome(AmazonWebServiceResult<JsonValue>(std::move(response),
         httpOutcome.GetResult()->GetHeaders(),
         httpOutcome.GetResult()->GetResponseCode()));
+    }
 
     else
         return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
@@ -374,6 +644,7 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::String& uri,
 JsonOutcome AWSJsonClient::MakeRequest(const Aws::String& uri,
     Http::HttpMethod method) const
 {
+    Aws::Utils::Memory::ScopedMemoryArena requestArena(Aws::Utils::Memory::MemoryArena::DEFAULT_CHUNK_SIZE, NeedsRequestArena());
     HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method));
     if (!httpOutcome.IsSuccess())
     {
@@ -382,7 +653,7 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::String& uri,
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
-        JsonValue jsonValue(httpOutcome.GetResult()->GetResponseBody());
+        JsonValue jsonValue(ReadResponseBody(httpOutcome.GetResult()->GetResponseBody()));
         if (!jsonValue.WasParseSuccessful())
         {
             return JsonOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", jsonValue.GetErrorMessage(), false));
@@ -421,7 +692,7 @@ AWSError<CoreErrors> AWSJsonClient::BuildAWSError(
     assert(httpResponse->GetResponseCode() != HttpResponseCode::OK);
 
     //this is stupid, but gcc doesn't pick up the covariant on the dereference so we have to give it a little hint.
-    JsonValue exceptionPayload(httpResponse->GetResponseBody());
+    JsonValue exceptionPayload(ReadResponseBody(httpResponse->GetResponseBody()));
     AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Error response is " << exceptionPayload.WriteReadable());
 
     Aws::String message(exceptionPayload.ValueExists(MESSAGE_CAMEL_CASE) ? exceptionPayload.GetString(MESSAGE_CAMEL_CASE) :
@@ -452,6 +723,7 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
     const Aws::AmazonWebServiceRequest& request,
     Http::HttpMethod method) const
 {
+    Aws::Utils::Memory::ScopedMemoryArena requestArena(Aws::Utils::Memory::MemoryArena::DEFAULT_CHUNK_SIZE, NeedsRequestArena());
     HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method));
     if (!httpOutcome.IsSuccess())
     {
@@ -460,7 +732,7 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
-        XmlDocument xmlDoc = XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody());
+        XmlDocument xmlDoc = XmlDocument::CreateFromXmlString(ReadResponseBody(httpOutcome.GetResult()->GetResponseBody()));
 
         if (!xmlDoc.WasParseSuccessful())
         {
@@ -478,6 +750,7 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
 XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
     Http::HttpMethod method) const
 {
+    Aws::Utils::Memory::ScopedMemoryArena requestArena(Aws::Utils::Memory::MemoryArena::DEFAULT_CHUNK_SIZE, NeedsRequestArena());
     HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method));
     if (!httpOutcome.IsSuccess())
     {
@@ -487,7 +760,7 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::String& uri,
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
         return XmlOutcome(AmazonWebServiceResult<XmlDocument>(
-            XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody()),
+            XmlDocument::CreateFromXmlString(ReadResponseBody(httpOutcome.GetResult()->GetResponseBody())),
             httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()));
     }
 
@@ -519,12 +792,12 @@ AWSError<CoreErrors> AWSXMLClient::BuildAWSError(const std::shared_ptr<Http::Htt
         httpResponse->GetResponseBody().seekg(0);
     }
 
-    XmlDocument doc = XmlDocument::CreateFromXmlStream(httpResponse->GetResponseBody());
+    XmlDocument doc = XmlDocument::CreateFromXmlString(ReadResponseBody(httpResponse->GetResponseBody()));
     AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Error response is " << doc.ConvertToString());
     if (doc.WasParseSuccessful())
     {
         XmlNode errorNode = doc.GetRootElement();
-        if (errorNode.GetName() != "Error")
+        if (errorNode.GetNameView() != "Error")
         {
             errorNode = doc.GetRootElement().FirstChild("Error");
         }
@@ -536,8 +809,8 @@ AWSError<CoreErrors> AWSXMLClient::BuildAWSError(const std::shared_ptr<Http::Htt
 
             if (!(codeNode.IsNull() || messageNode.IsNull()))
             {
-                return GetErrorMarshaller()->Marshall(StringUtils::Trim(codeNode.GetText().c_str()),
-                    StringUtils::Trim(messageNode.GetText().c_str()));
+                return GetErrorMarshaller()->Marshall(codeNode.GetTextView().Trim().ToString(),
+                    messageNode.GetTextView().Trim().ToString());
             }
         }
     }
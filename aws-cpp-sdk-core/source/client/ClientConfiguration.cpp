@@ -19,6 +19,7 @@
 #include <aws/core/platform/OSVersionInfo.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/stream/SpillingResponseStream.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/Version.h>
 
@@ -46,12 +47,16 @@ ClientConfiguration::ClientConfiguration() :
     connectTimeoutMs(1000),
     retryStrategy(Aws::MakeShared<DefaultRetryStrategy>(CLIENT_CONFIGURATION_ALLOCATION_TAG)),
     proxyPort(0),
-    executor(Aws::MakeShared<Aws::Utils::Threading::DefaultExecutor>(CLIENT_CONFIGURATION_ALLOCATION_TAG)),
+    executor(Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(CLIENT_CONFIGURATION_ALLOCATION_TAG,
+        static_cast<size_t>(DEFAULT_EXECUTOR_POOL_SIZE))),
     verifySSL(true),
     writeRateLimiter(nullptr),
     readRateLimiter(nullptr),
     httpLibOverride(Aws::Http::TransferLibType::DEFAULT_CLIENT),
-    followRedirects(true)
+    followRedirects(true),
+    useRequestScopedArena(false),
+    operationRateLimits(nullptr),
+    responseStreamFactory(Aws::Utils::Stream::SpillingResponseStreamFactoryMethod)
 {
 }
 
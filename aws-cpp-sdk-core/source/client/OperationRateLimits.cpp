@@ -0,0 +1,123 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/OperationRateLimits.h>
+#include <aws/core/AmazonWebServiceRequest.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+
+#include <cmath>
+
+using namespace Aws::Client;
+using namespace Aws::Utils::Json;
+using namespace Aws::Utils::RateLimits;
+
+const char* OperationRateLimits::ALL_OPERATIONS = "*";
+
+void OperationRateLimits::AddLimit(const Aws::String& operationName, const std::shared_ptr<RateLimiterInterface>& limiter,
+    const RequestCostFunction& requestCost, const ResponseCostFunction& responseCost)
+{
+    Limit limit;
+    limit.m_limiter = limiter;
+    limit.m_requestCost = requestCost;
+    limit.m_responseCost = responseCost;
+    m_limits[operationName].push_back(limit);
+    m_hasResponseCosts = m_hasResponseCosts || static_cast<bool>(responseCost);
+}
+
+OperationRateLimits::RequestCostFunction OperationRateLimits::CostPerRequest(int64_t cost)
+{
+    return [cost](const Aws::AmazonWebServiceRequest&) { return cost; };
+}
+
+static double SumCapacityUnits(const JsonValue& consumedCapacity)
+{
+    return consumedCapacity.ValueExists("CapacityUnits") ? consumedCapacity.GetDouble("CapacityUnits") : 0.0;
+}
+
+OperationRateLimits::ResponseCostFunction OperationRateLimits::ConsumedCapacityUnits(int64_t scale)
+{
+    return [scale](const Aws::AmazonWebServiceRequest&, const JsonValue& response) -> int64_t
+    {
+        if (!response.ValueExists("ConsumedCapacity"))
+        {
+            return 0;
+        }
+
+        double units = 0.0;
+        JsonValue consumedCapacity = response.GetObject("ConsumedCapacity");
+        if (consumedCapacity.IsListType())
+        {
+            // batch operations report one entry per table
+            Aws::Utils::Array<JsonValue> entries = consumedCapacity.AsArray();
+            for (size_t i = 0; i < entries.GetLength(); ++i)
+            {
+                units += SumCapacityUnits(entries[i]);
+            }
+        }
+        else
+        {
+            units = SumCapacityUnits(consumedCapacity);
+        }
+
+        return static_cast<int64_t>(std::ceil(units * scale));
+    };
+}
+
+template<typename Fn>
+void OperationRateLimits::ForEachMatchingLimit(const Aws::AmazonWebServiceRequest& request, const Fn& fn) const
+{
+    const char* names[] = { request.GetServiceRequestName(), ALL_OPERATIONS };
+    for (const char* name : names)
+    {
+        auto limits = m_limits.find(name);
+        if (limits != m_limits.end())
+        {
+            for (const Limit& limit : limits->second)
+            {
+                fn(limit);
+            }
+        }
+    }
+}
+
+void OperationRateLimits::ChargeRequest(const Aws::AmazonWebServiceRequest& request) const
+{
+    ForEachMatchingLimit(request, [&request](const Limit& limit)
+    {
+        int64_t cost = limit.m_requestCost ? limit.m_requestCost(request) : 0;
+        if (cost >= 0)
+        {
+            limit.m_limiter->ApplyAndPayForCost(cost);
+        }
+    });
+}
+
+void OperationRateLimits::ChargeResponse(const Aws::AmazonWebServiceRequest& request, const JsonValue& response) const
+{
+    ForEachMatchingLimit(request, [&request, &response](const Limit& limit)
+    {
+        if (!limit.m_responseCost)
+        {
+            return;
+        }
+
+        int64_t cost = limit.m_responseCost(request, response);
+        if (cost > 0)
+        {
+            limit.m_limiter->ApplyCost(cost);
+        }
+    });
+}
@@ -0,0 +1,40 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/PreparedRequest.h>
+#include <aws/core/AmazonWebServiceRequest.h>
+
+using namespace Aws::Client;
+
+PreparedRequest::PreparedRequest(const std::shared_ptr<const Aws::AmazonWebServiceRequest>& requestTemplate,
+    const Aws::Http::URI& uri, Aws::Http::HttpMethod method, const Aws::Http::HeaderValueCollection& headers,
+    const Aws::String& canonicalRequestPrefix, const Aws::String& bodyPrefix, const Aws::String& bodySuffix) :
+    m_requestTemplate(requestTemplate),
+    m_uri(uri),
+    m_method(method),
+    m_headers(headers),
+    m_canonicalRequestPrefix(canonicalRequestPrefix),
+    m_bodyPrefix(bodyPrefix),
+    m_bodySuffix(bodySuffix)
+{
+}
+
+Aws::String PreparedRequest::BuildBody(const Aws::String& variablePart) const
+{
+    Aws::String body;
+    body.reserve(m_bodyPrefix.size() + variablePart.size() + m_bodySuffix.size());
+    body.append(m_bodyPrefix).append(variablePart).append(m_bodySuffix);
+    return body;
+}
@@ -22,6 +22,7 @@
 #include <cctype>
 #include <cassert>
 #include <algorithm>
+#include <cstring>
 
 using namespace Aws::Http;
 using namespace Aws::Utils;
@@ -185,45 +186,31 @@ QueryStringParameterCollection URI::GetQueryStringParameters(bool decode) const
 void URI::CanonicalizeQueryString()
 {
     QueryStringParameterCollection sortedParameters = GetQueryStringParameters(false);
-    Aws::StringStream queryStringStream;
-
-    bool first = true;
-
-    if(sortedParameters.size() > 0)
-    {
-        queryStringStream << "?";
-    }
 
     if(m_queryString.find("=") != std::string::npos)
     {
+        // the canonical form is a reordering of the same key=value pairs, so it is about as long as the original
+        Aws::String canonicalQueryString;
+        canonicalQueryString.reserve(m_queryString.size());
+
         for (QueryStringParameterCollection::iterator iter = sortedParameters.begin();
              iter != sortedParameters.end(); ++iter)
         {
-            if (!first)
-            {
-                queryStringStream << "&";
-            }
-
-            first = false;
-            queryStringStream << iter->first << "=" << iter->second;
+            canonicalQueryString.append(1, canonicalQueryString.empty() ? '?' : '&');
+            canonicalQueryString.append(iter->first).append(1, '=').append(iter->second);
         }
 
-        m_queryString = queryStringStream.str();
+        m_queryString.swap(canonicalQueryString);
     }
 }
 
 void URI::AddQueryStringParameter(const char* key, const Aws::String& value)
 {
-    if (m_queryString.size() <= 0)
-    {
-        m_queryString.append("?");
-    }
-    else
-    {
-        m_queryString.append("&");
-    }
+    m_queryString.append(1, m_queryString.size() <= 0 ? '?' : '&');
 
-    m_queryString.append(StringUtils::URLEncode(key) + "=" + StringUtils::URLEncode(value.c_str()));
+    StringUtils::URLEncode(key, strlen(key), m_queryString);
+    m_queryString.append(1, '=');
+    StringUtils::URLEncode(value.c_str(), value.size(), m_queryString);
 }
 
 Aws::String URI::GetURIString(bool includeQueryString) const
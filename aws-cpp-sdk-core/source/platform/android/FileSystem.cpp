@@ -17,9 +17,12 @@
 #include <aws/core/platform/Android.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/UnreferencedParam.h>
 
 #include <unistd.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <cerrno>
 
 #include <mutex>
@@ -81,6 +84,88 @@ Aws::String CreateTempFilePath()
     return pathStream.str();
 }
 
+Aws::String GetTempDirectory()
+{
+    return Aws::Platform::GetCacheDirectory();
+}
+
+bool MapFileForRead(const char* path, const unsigned char*& data, size_t& length, void*& handle)
+{
+    AWS_LOGSTREAM_DEBUG(FILE_SYSTEM_UTILS_LOG_TAG, "Mapping file " << path << " for read");
+
+    data = nullptr;
+    length = 0;
+    handle = nullptr;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to open file " << path << " for mapping, error code: " << errno);
+        return false;
+    }
+
+    struct stat fileInfo;
+    if (fstat(fd, &fileInfo) != 0)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to stat file " << path << ", error code: " << errno);
+        close(fd);
+        return false;
+    }
+
+    //mmap rejects zero-length mappings, but an empty file is still a valid (empty) body.
+    if (fileInfo.st_size > 0)
+    {
+        void* mapped = mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED)
+        {
+            AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to map file " << path << ", error code: " << errno);
+            close(fd);
+            return false;
+        }
+
+        data = static_cast<const unsigned char*>(mapped);
+        length = static_cast<size_t>(fileInfo.st_size);
+    }
+
+    //the mapping keeps its own reference to the file.
+    close(fd);
+    return true;
+}
+
+void UnmapFile(const unsigned char* data, size_t length, void* handle)
+{
+    AWS_UNREFERENCED_PARAM(handle);
+
+    if (data)
+    {
+        munmap(const_cast<unsigned char*>(data), length);
+    }
+}
+
+//bionic has no shm_open; processes that need to share memory on Android use a bound service instead.
+void* OpenSharedMemory(const char* name, size_t size, bool& created, void*& handle)
+{
+    AWS_UNREFERENCED_PARAM(size);
+
+    created = false;
+    handle = nullptr;
+    AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Named shared memory is not supported on Android, unable to open " << name);
+    return nullptr;
+}
+
+void CloseSharedMemory(void* data, size_t size, void* handle)
+{
+    AWS_UNREFERENCED_PARAM(data);
+    AWS_UNREFERENCED_PARAM(size);
+    AWS_UNREFERENCED_PARAM(handle);
+}
+
+bool RemoveSharedMemory(const char* name)
+{
+    AWS_UNREFERENCED_PARAM(name);
+
+    return true;
+}
+
 } // namespace FileSystem
 } // namespace Aws
-
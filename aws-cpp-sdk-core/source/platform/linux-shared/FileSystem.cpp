@@ -19,10 +19,13 @@
 #include <aws/core/utils/DateTime.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/UnreferencedParam.h>
 
 #include <unistd.h>
 #include <pwd.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 
 namespace Aws
 {
@@ -112,5 +115,144 @@ Aws::String CreateTempFilePath()
     return tempFile;
 }
 
+Aws::String GetTempDirectory()
+{
+    static const char* TEMP_DIR_ENV_VAR = "TMPDIR";
+
+    Aws::String tempDir = Aws::Environment::GetEnv(TEMP_DIR_ENV_VAR);
+    if(tempDir.empty())
+    {
+        tempDir = "/tmp";
+    }
+
+    while(tempDir.size() > 1 && tempDir.back() == PATH_DELIM)
+    {
+        tempDir.pop_back();
+    }
+
+    return tempDir;
+}
+
+bool MapFileForRead(const char* path, const unsigned char*& data, size_t& length, void*& handle)
+{
+    AWS_LOGSTREAM_DEBUG(FILE_SYSTEM_UTILS_LOG_TAG, "Mapping file " << path << " for read");
+
+    data = nullptr;
+    length = 0;
+    handle = nullptr;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to open file " << path << " for mapping, error code: " << errno);
+        return false;
+    }
+
+    struct stat fileInfo;
+    if (fstat(fd, &fileInfo) != 0)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to stat file " << path << ", error code: " << errno);
+        close(fd);
+        return false;
+    }
+
+    //mmap rejects zero-length mappings, but an empty file is still a valid (empty) body.
+    if (fileInfo.st_size > 0)
+    {
+        void* mapped = mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED)
+        {
+            AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to map file " << path << ", error code: " << errno);
+            close(fd);
+            return false;
+        }
+
+        data = static_cast<const unsigned char*>(mapped);
+        length = static_cast<size_t>(fileInfo.st_size);
+    }
+
+    //the mapping keeps its own reference to the file.
+    close(fd);
+    return true;
+}
+
+void UnmapFile(const unsigned char* data, size_t length, void* handle)
+{
+    AWS_UNREFERENCED_PARAM(handle);
+
+    if (data)
+    {
+        munmap(const_cast<unsigned char*>(data), length);
+    }
+}
+
+//shm_open names are a single leading slash followed by no further slashes.
+static Aws::String SharedMemoryName(const char* name)
+{
+    return name[0] == '/' ? Aws::String(name) : "/" + Aws::String(name);
+}
+
+void* OpenSharedMemory(const char* name, size_t size, bool& created, void*& handle)
+{
+    AWS_LOGSTREAM_DEBUG(FILE_SYSTEM_UTILS_LOG_TAG, "Opening shared memory segment " << name);
+
+    created = false;
+    handle = nullptr;
+    Aws::String segmentName = SharedMemoryName(name);
+
+    int fd = shm_open(segmentName.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd >= 0)
+    {
+        created = true;
+    }
+    else if (errno == EEXIST)
+    {
+        fd = shm_open(segmentName.c_str(), O_RDWR, 0);
+    }
+
+    if (fd < 0)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to open shared memory segment " << name << ", error code: " << errno);
+        return nullptr;
+    }
+
+    //the creator may not have sized the segment yet (or died before doing so); growing it is idempotent and zero fills.
+    struct stat segmentInfo;
+    if (fstat(fd, &segmentInfo) != 0 || (static_cast<size_t>(segmentInfo.st_size) < size && ftruncate(fd, static_cast<off_t>(size)) != 0))
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to size shared memory segment " << name << ", error code: " << errno);
+        close(fd);
+        return nullptr;
+    }
+
+    void* mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    //the mapping keeps its own reference to the segment.
+    close(fd);
+    if (mapped == MAP_FAILED)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to map shared memory segment " << name << ", error code: " << errno);
+        return nullptr;
+    }
+
+    return mapped;
+}
+
+void CloseSharedMemory(void* data, size_t size, void* handle)
+{
+    AWS_UNREFERENCED_PARAM(handle);
+
+    if (data)
+    {
+        munmap(data, size);
+    }
+}
+
+bool RemoveSharedMemory(const char* name)
+{
+    AWS_LOGSTREAM_INFO(FILE_SYSTEM_UTILS_LOG_TAG, "Removing shared memory segment " << name);
+
+    return shm_unlink(SharedMemoryName(name).c_str()) == 0 || errno == ENOENT;
+}
+
 } // namespace FileSystem
 } // namespace Aws
@@ -17,6 +17,7 @@
 #include <aws/core/platform/Environment.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/UnreferencedParam.h>
 
 #include <Userenv.h>
 
@@ -146,5 +147,146 @@ Aws::String CreateTempFilePath()
     return s_tempName;
 }
 
+Aws::String GetTempDirectory()
+{
+    char tempPath[MAX_PATH + 1];
+    DWORD length = GetTempPathA(sizeof(tempPath), tempPath);
+    if(length == 0 || length > MAX_PATH)
+    {
+        AWS_LOGSTREAM_WARN(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to get the temp directory, error code: " << GetLastError() << ". Using the current directory.");
+        return ".";
+    }
+
+    Aws::String tempDir(tempPath, length);
+    while(tempDir.size() > 1 && tempDir.back() == PATH_DELIM)
+    {
+        tempDir.pop_back();
+    }
+
+    return tempDir;
+}
+
+bool MapFileForRead(const char* path, const unsigned char*& data, size_t& length, void*& handle)
+{
+    AWS_LOGSTREAM_DEBUG(FILE_SYSTEM_UTILS_LOG_TAG, "Mapping file " << path << " for read");
+
+    data = nullptr;
+    length = 0;
+    handle = nullptr;
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to open file " << path << " for mapping, error code: " << GetLastError());
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to size file " << path << ", error code: " << GetLastError());
+        CloseHandle(file);
+        return false;
+    }
+
+    //CreateFileMapping rejects empty files, but an empty file is still a valid (empty) body.
+    if (fileSize.QuadPart > 0)
+    {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to map file " << path << ", error code: " << GetLastError());
+            CloseHandle(file);
+            return false;
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view)
+        {
+            AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to map a view of file " << path << ", error code: " << GetLastError());
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        data = static_cast<const unsigned char*>(view);
+        length = static_cast<size_t>(fileSize.QuadPart);
+        handle = mapping;
+    }
+
+    //the mapping keeps its own reference to the file.
+    CloseHandle(file);
+    return true;
+}
+
+void UnmapFile(const unsigned char* data, size_t length, void* handle)
+{
+    AWS_UNREFERENCED_PARAM(length);
+
+    if (data)
+    {
+        UnmapViewOfFile(data);
+    }
+
+    if (handle)
+    {
+        CloseHandle(static_cast<HANDLE>(handle));
+    }
+}
+
+void* OpenSharedMemory(const char* name, size_t size, bool& created, void*& handle)
+{
+    AWS_LOGSTREAM_DEBUG(FILE_SYSTEM_UTILS_LOG_TAG, "Opening shared memory segment " << name);
+
+    created = false;
+    handle = nullptr;
+
+    //pagefile backed mappings are zero filled and go away with the last handle to them.
+    uint64_t mappingSize = static_cast<uint64_t>(size);
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+        static_cast<DWORD>(mappingSize >> 32), static_cast<DWORD>(mappingSize & 0xFFFFFFFF), name);
+    if (!mapping)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to open shared memory segment " << name << ", error code: " << GetLastError());
+        return nullptr;
+    }
+    created = GetLastError() != ERROR_ALREADY_EXISTS;
+
+    void* mapped = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (!mapped)
+    {
+        AWS_LOGSTREAM_ERROR(FILE_SYSTEM_UTILS_LOG_TAG, "Unable to map shared memory segment " << name << ", error code: " << GetLastError());
+        CloseHandle(mapping);
+        created = false;
+        return nullptr;
+    }
+
+    handle = mapping;
+    return mapped;
+}
+
+void CloseSharedMemory(void* data, size_t size, void* handle)
+{
+    AWS_UNREFERENCED_PARAM(size);
+
+    if (data)
+    {
+        UnmapViewOfFile(data);
+    }
+
+    if (handle)
+    {
+        CloseHandle(static_cast<HANDLE>(handle));
+    }
+}
+
+bool RemoveSharedMemory(const char* name)
+{
+    //named mappings have no persistent name to remove; the segment is freed once every handle is closed.
+    AWS_UNREFERENCED_PARAM(name);
+
+    return true;
+}
+
 } // namespace FileSystem
 } // namespace Aws
@@ -12,33 +12,93 @@
 * express or implied. See the License for the specific language governing
 * permissions and limitations under the License.
 */
-
 #include <aws/core/utils/EnumParseOverflowContainer.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
 
 using namespace Aws::Utils;
 
 static const char* LOG_TAG = "EnumParseOverflowContainer";
 
+EnumParseOverflowContainer::EnumParseOverflowContainer()
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+EnumParseOverflowContainer::~EnumParseOverflowContainer()
+{
+    for (auto& bucket : m_buckets)
+    {
+        OverflowEntry* entry = bucket.load(std::memory_order_relaxed);
+        while (entry)
+        {
+            OverflowEntry* next = entry->next;
+            Aws::Delete(entry);
+            entry = next;
+        }
+    }
+}
+
+std::atomic<EnumParseOverflowContainer::OverflowEntry*>& EnumParseOverflowContainer::GetBucket(int hashCode) const
+{
+    return m_buckets[static_cast<unsigned>(hashCode) % BUCKET_COUNT];
+}
+
 const Aws::String& EnumParseOverflowContainer::RetrieveOverflow(int hashCode) const
 {
+    for (const OverflowEntry* entry = GetBucket(hashCode).load(std::memory_order_acquire); entry; entry = entry->next)
     {
-        std::lock_guard<std::mutex> locker(m_overflowLock);
-        auto foundIter = m_overflowMap.find(hashCode);
-        if (foundIter != m_overflowMap.end())
+        if (entry->hashCode == hashCode)
         {
-            AWS_LOGSTREAM_DEBUG(LOG_TAG, "Found value " << foundIter->second << " for hash " << hashCode << " from enum overflow container.");
-            return foundIter->second;
-        } 
-    }  
+            AWS_LOGSTREAM_DEBUG(LOG_TAG, "Found value " << entry->value << " for hash " << hashCode << " from enum overflow container.");
+            return entry->value;
+        }
+    }
 
     AWS_LOGSTREAM_ERROR(LOG_TAG, "Could not find a previously stored overflow value for hash " << hashCode << ". This will likely break some requests.");
     return m_emptyString;
 }
 
+bool EnumParseOverflowContainer::HasEntry(const OverflowEntry* from, const OverflowEntry* until, int hashCode, const Aws::String& value)
+{
+    for (const OverflowEntry* entry = from; entry != until; entry = entry->next)
+    {
+        if (entry->hashCode == hashCode && entry->value == value)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 void EnumParseOverflowContainer::StoreOverflow(int hashCode, const Aws::String& value)
 {
+    std::atomic<OverflowEntry*>& bucket = GetBucket(hashCode);
+    OverflowEntry* head = bucket.load(std::memory_order_acquire);
+
+    // the whole chain is checked, so values whose hashes collide each get one entry however often they alternate.
+    if (HasEntry(head, nullptr, hashCode, value))
+    {
+        return;
+    }
+
     AWS_LOGSTREAM_WARN(LOG_TAG, "Encountered enum member " << value << " which is not modeled in your clients. You should update your clients when you get a chance.");
-    std::lock_guard<std::mutex> locker(m_overflowLock);
-    m_overflowMap[hashCode] = value;
-}
\ No newline at end of file
+    OverflowEntry* newEntry = Aws::New<OverflowEntry>(LOG_TAG);
+    newEntry->hashCode = hashCode;
+    newEntry->value = value;
+    newEntry->next = head;
+
+    while (!bucket.compare_exchange_weak(newEntry->next, newEntry, std::memory_order_release, std::memory_order_acquire))
+    {
+        // another thread got in first; only the entries it pushed since our last look can duplicate this one.
+        if (HasEntry(newEntry->next, head, hashCode, value))
+        {
+            Aws::Delete(newEntry);
+            return;
+        }
+        head = newEntry->next;
+    }
+}
@@ -0,0 +1,90 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/ratelimiter/SharedMemoryRateLimiter.h>
+#include <aws/core/platform/FileSystem.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <type_traits>
+
+using namespace Aws::Utils::RateLimits;
+
+static const char* SHARED_RATE_LIMITER_LOG_TAG = "SharedMemoryRateLimiter";
+
+//identifies the segment layout below; bump it whenever the layout changes so old and new binaries never share a segment.
+static const uint64_t SHARED_RATE_LIMITER_LAYOUT = 0x4157534c494d0001ULL;
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared rate limiter state requires address-free 64 bit atomics");
+
+namespace
+{
+    struct SharedRateLimiterLayout
+    {
+        std::atomic<uint64_t> layout;
+        AtomicRateLimiterState state;
+    };
+
+    static_assert(std::is_standard_layout<SharedRateLimiterLayout>::value, "Shared rate limiter state must have a fixed layout");
+}
+
+SharedRateLimiterSegment::SharedRateLimiterSegment(const char* name) :
+    m_data(nullptr),
+    m_handle(nullptr),
+    m_state(nullptr)
+{
+    bool created = false;
+    m_data = Aws::FileSystem::OpenSharedMemory(name, sizeof(SharedRateLimiterLayout), created, m_handle);
+    if (!m_data)
+    {
+        AWS_LOGSTREAM_ERROR(SHARED_RATE_LIMITER_LOG_TAG, "Unable to map rate limiter segment " << name << ", limiting this process only");
+        return;
+    }
+
+    //a fresh segment is all zeros, which is a valid limiter state (a full bucket); claiming the layout is a single CAS, so a
+    //creator that dies right after creating the segment leaves nothing half initialized.
+    SharedRateLimiterLayout* segment = static_cast<SharedRateLimiterLayout*>(m_data);
+    uint64_t layout = 0;
+    if (!segment->layout.compare_exchange_strong(layout, SHARED_RATE_LIMITER_LAYOUT) && layout != SHARED_RATE_LIMITER_LAYOUT)
+    {
+        AWS_LOGSTREAM_ERROR(SHARED_RATE_LIMITER_LOG_TAG, "Rate limiter segment " << name << " has an incompatible layout " << layout
+                << ", limiting this process only");
+        Aws::FileSystem::CloseSharedMemory(m_data, sizeof(SharedRateLimiterLayout), m_handle);
+        m_data = nullptr;
+        m_handle = nullptr;
+        return;
+    }
+
+    AWS_LOGSTREAM_INFO(SHARED_RATE_LIMITER_LOG_TAG, (created ? "Created" : "Attached to") << " rate limiter segment " << name);
+    m_state = &segment->state;
+}
+
+SharedRateLimiterSegment::~SharedRateLimiterSegment()
+{
+    if (m_data)
+    {
+        Aws::FileSystem::CloseSharedMemory(m_data, sizeof(SharedRateLimiterLayout), m_handle);
+    }
+}
+
+SharedMemoryRateLimiter::SharedMemoryRateLimiter(const char* name, int64_t maxRate, ElapsedTimeFunctionType elapsedTimeFunction) :
+    SharedRateLimiterSegment(name),
+    Base(GetState(), maxRate, false, elapsedTimeFunction)
+{
+}
+
+bool SharedMemoryRateLimiter::Remove(const char* name)
+{
+    return Aws::FileSystem::RemoveSharedMemory(name);
+}
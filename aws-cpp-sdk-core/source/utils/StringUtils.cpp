@@ -22,6 +22,11 @@
 #include <cstring>
 #include <functional>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AWS_HAS_SSE2
+#endif
+
 using namespace Aws::Utils;
 
 void StringUtils::Replace(Aws::String& s, const char* search, const char* replace)
@@ -113,30 +118,127 @@ Aws::Vector<Aws::String> StringUtils::SplitOnLine(const Aws::String& toSplit)
 }
 
 
-Aws::String StringUtils::URLEncode(const char* unsafe)
+/**
+ * Lookup table for the unreserved characters of RFC 3986 (ALPHA / DIGIT / "-" / "." / "_" / "~").
+ * Everything else, including all bytes >= 0x80, gets percent encoded.
+ */
+static const bool URL_UNRESERVED_CHARACTERS[256] =
 {
-    Aws::StringStream escaped;
-    escaped.fill('0');
-    escaped << std::hex << std::uppercase;
+    //        0      1      2      3      4      5      6      7      8      9      A      B      C      D      E      F
+    /* 0 */ false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false,
+    /* 1 */ false, false, false, false, false, false, false, false, false, false, false, false, false, false, false, false,
+    /* 2 */ false, false, false, false, false, false, false, false, false, false, false, false, false, true,  true,  false,
+    /* 3 */ true,  true,  true,  true,  true,  true,  true,  true,  true,  true,  false, false, false, false, false, false,
+    /* 4 */ false, true,  true,  true,  true,  true,  true,  true,  true,  true,  true,  true,  true,  true,  true,  true,
+    /* 5 */ true,  true,  true,  true,  true,  true,  true,  true,  true,  true,  true,  false, false, false, false, true,
+    /* 6 */ false, true,  true,  true,  true,  true,  true,  true,  true,  true,  true,  true,  true,  true,  true,  true,
+    /* 7 */ true,  true,  true,  true,  true,  true,  true,  true,  true,  true,  true,  false, false, false, true,  false
+    // 0x80 - 0xFF are value-initialized to false
+};
+
+static const char URL_HEX_DIGITS[] = "0123456789ABCDEF";
+
+/**
+ * Returns a pointer to the first character in [begin, end) that needs to be percent encoded, or end.
+ */
+static const char* FindFirstCharacterToEncode(const char* begin, const char* end)
+{
+    const char* current = begin;
+#ifdef AWS_HAS_SSE2
+    // 16 bytes at a time: a byte is unreserved if it falls in one of the alnum ranges or is one of - . _ ~.
+    // Bytes >= 0x80 are negative as signed chars and fail every range check, so they always need encoding.
+    const __m128i beforeDigits = _mm_set1_epi8('0' - 1), afterDigits = _mm_set1_epi8('9' + 1);
+    const __m128i beforeUpper = _mm_set1_epi8('A' - 1), afterUpper = _mm_set1_epi8('Z' + 1);
+    const __m128i beforeLower = _mm_set1_epi8('a' - 1), afterLower = _mm_set1_epi8('z' + 1);
+    const __m128i dash = _mm_set1_epi8('-'), dot = _mm_set1_epi8('.'), underscore = _mm_set1_epi8('_'), tilde = _mm_set1_epi8('~');
+    while (end - current >= 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+        __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(block, beforeDigits), _mm_cmplt_epi8(block, afterDigits));
+        __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(block, beforeUpper), _mm_cmplt_epi8(block, afterUpper));
+        __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(block, beforeLower), _mm_cmplt_epi8(block, afterLower));
+        __m128i marks = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, dash), _mm_cmpeq_epi8(block, dot)),
+                                     _mm_or_si128(_mm_cmpeq_epi8(block, underscore), _mm_cmpeq_epi8(block, tilde)));
+        int safeMask = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(digits, upper), _mm_or_si128(lower, marks)));
+        if (safeMask != 0xFFFF)
+        {
+            break;
+        }
+        current += 16;
+    }
+#endif // AWS_HAS_SSE2
 
-    size_t unsafeLength = strlen(unsafe);
-    for (auto i = unsafe, n = unsafe + unsafeLength; i != n; ++i)
+    while (current != end && URL_UNRESERVED_CHARACTERS[static_cast<unsigned char>(*current)])
     {
-        int c = *i;
-		//MSVC 2015 has an assertion that c is positive in isalnum(). This breaks unicode support.
-		//bypass that with the first check.
-        if (c >= 0 && (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~'))
+        ++current;
+    }
+
+    return current;
+}
+
+void StringUtils::URLEncode(const char* unsafe, size_t length, Aws::String& output)
+{
+    const char* current = unsafe;
+    const char* end = unsafe + length;
+    while (current != end)
+    {
+        const char* runEnd = FindFirstCharacterToEncode(current, end);
+        output.append(current, runEnd);
+        current = runEnd;
+
+        while (current != end && !URL_UNRESERVED_CHARACTERS[static_cast<unsigned char>(*current)])
         {
-            escaped << (char)c;
+            unsigned char c = static_cast<unsigned char>(*current++);
+            char escaped[3] = { '%', URL_HEX_DIGITS[c >> 4], URL_HEX_DIGITS[c & 0x0F] };
+            output.append(escaped, sizeof(escaped));
         }
-        else
+    }
+}
+
+void StringUtils::URLEncode(const char* unsafe, size_t length, Aws::OStream& output)
+{
+    const char* current = unsafe;
+    const char* end = unsafe + length;
+    while (current != end)
+    {
+        const char* runEnd = FindFirstCharacterToEncode(current, end);
+        if (runEnd != current)
         {
-            //this unsigned char cast allows us to handle unicode characters.
-            escaped << '%' << std::setw(2) << int((unsigned char)c) << std::setw(0);
+            output.write(current, runEnd - current);
+            current = runEnd;
+        }
+
+        //collect a run of escapes so it goes out in one write.
+        char escaped[48];
+        size_t escapedLength = 0;
+        while (current != end && escapedLength < sizeof(escaped) && !URL_UNRESERVED_CHARACTERS[static_cast<unsigned char>(*current)])
+        {
+            unsigned char c = static_cast<unsigned char>(*current++);
+            escaped[escapedLength++] = '%';
+            escaped[escapedLength++] = URL_HEX_DIGITS[c >> 4];
+            escaped[escapedLength++] = URL_HEX_DIGITS[c & 0x0F];
+        }
+        if (escapedLength > 0)
+        {
+            output.write(escaped, escapedLength);
         }
     }
+}
 
-    return escaped.str();
+Aws::OStream& Aws::Utils::operator<<(Aws::OStream& oStream, const URLEncodedValue& value)
+{
+    StringUtils::URLEncode(value.value, value.length, oStream);
+    return oStream;
+}
+
+Aws::String StringUtils::URLEncode(const char* unsafe)
+{
+    size_t unsafeLength = strlen(unsafe);
+    Aws::String escaped;
+    escaped.reserve(unsafeLength + unsafeLength / 2);
+    URLEncode(unsafe, unsafeLength, escaped);
+
+    return escaped;
 }
 
 Aws::String StringUtils::UTF8Escape(const char* unicodeString, const char* delimiter)
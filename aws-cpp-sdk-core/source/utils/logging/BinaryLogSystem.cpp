@@ -0,0 +1,314 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/logging/BinaryLogSystem.h>
+
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/logging/LogFormatCapture.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <stdio.h>
+#include <thread>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Logging;
+
+/*
+ * Layout: the 8 byte magic, then records of [type:1][payload length:4][payload].
+ *   tag / format definition: [id:4][text]
+ *   formatted record:        [micros since epoch:8][level:1][tag id:4][thread id:8][format id:4][captured arguments]
+ *   text record:             [micros since epoch:8][level:1][tag id:4][thread id:8][text]
+ * Integers are in host byte order; decode on a machine with the same endianness.
+ */
+static const char BINARY_LOG_MAGIC[8] = { 'A', 'W', 'S', 'B', 'L', 'O', 'G', '\x01' };
+static const char TAG_DEFINITION = 'T';
+static const char FORMAT_DEFINITION = 'F';
+static const char FORMATTED_RECORD = 'R';
+static const char TEXT_RECORD = 'S';
+
+const size_t BinaryLogSystem::DEFAULT_FLUSH_THRESHOLD;
+
+template<typename T>
+static void AppendRaw(Aws::String& buffer, const T& value)
+{
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+static bool ReadRaw(const char*& cursor, const char* end, T& value)
+{
+    if (static_cast<size_t>(end - cursor) < sizeof(T))
+    {
+        return false;
+    }
+    std::memcpy(&value, cursor, sizeof(T));
+    cursor += sizeof(T);
+    return true;
+}
+
+BinaryLogSystem::BinaryLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& output, size_t flushThresholdBytes) :
+    m_logLevel(logLevel),
+    m_output(output),
+    m_flushThreshold(flushThresholdBytes)
+{
+    m_buffer.reserve(m_flushThreshold + 1024);
+    m_buffer.append(BINARY_LOG_MAGIC, sizeof(BINARY_LOG_MAGIC));
+}
+
+BinaryLogSystem::~BinaryLogSystem()
+{
+    Flush();
+}
+
+void BinaryLogSystem::Log(LogLevel logLevel, const char* tag, const char* formatStr, ...)
+{
+    std::va_list args;
+    va_start(args, formatStr);
+
+    std::lock_guard<std::mutex> locker(m_lock);
+    uint32_t tagId = InternLocked(tag, TAG_DEFINITION, m_tagIds);
+    uint32_t formatId = InternLocked(formatStr, FORMAT_DEFINITION, m_formatIds);
+
+    size_t recordStart = BeginRecordLocked(FORMATTED_RECORD, logLevel, tagId);
+    AppendRaw(m_buffer, formatId);
+
+    va_list captureArgs;
+    va_copy(captureArgs, args);
+    bool captured = CaptureArguments(formatStr, captureArgs, m_buffer);
+    va_end(captureArgs);
+
+    if (!captured)
+    {
+        // the format definition stays behind unused; the decoder does not mind
+        m_buffer.resize(recordStart);
+        recordStart = BeginRecordLocked(TEXT_RECORD, logLevel, tagId);
+
+        va_list measureArgs;
+        va_copy(measureArgs, args);
+        #ifdef WIN32
+            int length = _vscprintf(formatStr, measureArgs);
+        #else
+            int length = vsnprintf(nullptr, 0, formatStr, measureArgs);
+        #endif // WIN32
+        va_end(measureArgs);
+
+        if (length > 0)
+        {
+            size_t textStart = m_buffer.size();
+            m_buffer.resize(textStart + static_cast<size_t>(length) + 1);
+            #ifdef WIN32
+                vsnprintf_s(&m_buffer[textStart], static_cast<size_t>(length) + 1, _TRUNCATE, formatStr, args);
+            #else
+                vsnprintf(&m_buffer[textStart], static_cast<size_t>(length) + 1, formatStr, args);
+            #endif // WIN32
+            m_buffer.resize(textStart + static_cast<size_t>(length));
+        }
+    }
+    va_end(args);
+
+    EndRecordLocked(recordStart);
+}
+
+void BinaryLogSystem::LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream &messageStream)
+{
+    const Aws::String message = messageStream.str();
+
+    std::lock_guard<std::mutex> locker(m_lock);
+    size_t recordStart = BeginRecordLocked(TEXT_RECORD, logLevel, InternLocked(tag, TAG_DEFINITION, m_tagIds));
+    m_buffer += message;
+    EndRecordLocked(recordStart);
+}
+
+void BinaryLogSystem::Flush()
+{
+    std::lock_guard<std::mutex> locker(m_lock);
+    FlushLocked();
+}
+
+uint32_t BinaryLogSystem::InternLocked(const char* text, char definitionType, Aws::CStringMap<uint32_t>& ids)
+{
+    auto found = ids.find(text);
+    if (found != ids.end())
+    {
+        return found->second;
+    }
+
+    m_internedText.emplace_back(text);
+    uint32_t id = static_cast<uint32_t>(ids.size());
+    ids[m_internedText.back().c_str()] = id;
+
+    size_t recordStart = m_buffer.size();
+    m_buffer.push_back(definitionType);
+    AppendRaw(m_buffer, static_cast<uint32_t>(0));
+    AppendRaw(m_buffer, id);
+    m_buffer += m_internedText.back();
+    EndRecordLocked(recordStart);
+    return id;
+}
+
+size_t BinaryLogSystem::BeginRecordLocked(char recordType, LogLevel logLevel, uint32_t tagId)
+{
+    size_t recordStart = m_buffer.size();
+    m_buffer.push_back(recordType);
+    AppendRaw(m_buffer, static_cast<uint32_t>(0));
+
+    int64_t micros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    AppendRaw(m_buffer, micros);
+    m_buffer.push_back(static_cast<char>(logLevel));
+    AppendRaw(m_buffer, tagId);
+    AppendRaw(m_buffer, static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+    return recordStart;
+}
+
+void BinaryLogSystem::EndRecordLocked(size_t recordStart)
+{
+    uint32_t payloadLength = static_cast<uint32_t>(m_buffer.size() - recordStart - 1 - sizeof(uint32_t));
+    std::memcpy(&m_buffer[recordStart + 1], &payloadLength, sizeof(payloadLength));
+
+    if (m_buffer.size() >= m_flushThreshold)
+    {
+        FlushLocked();
+    }
+}
+
+void BinaryLogSystem::FlushLocked()
+{
+    if (!m_buffer.empty())
+    {
+        m_output->write(m_buffer.c_str(), static_cast<std::streamsize>(m_buffer.size()));
+        m_buffer.clear();
+    }
+    m_output->flush();
+}
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            bool DecodeBinaryLog(Aws::IStream& input, Aws::OStream& output)
+            {
+                char magic[sizeof(BINARY_LOG_MAGIC)];
+                if (!input.read(magic, sizeof(magic)) || std::memcmp(magic, BINARY_LOG_MAGIC, sizeof(magic)) != 0)
+                {
+                    return false;
+                }
+
+                Aws::Map<uint32_t, Aws::String> tags;
+                Aws::Map<uint32_t, Aws::String> formats;
+                Aws::String payload;
+                Aws::String line;
+                while (true)
+                {
+                    char recordType = 0;
+                    if (!input.get(recordType))
+                    {
+                        return true;
+                    }
+
+                    uint32_t payloadLength = 0;
+                    if (!input.read(reinterpret_cast<char*>(&payloadLength), sizeof(payloadLength)))
+                    {
+                        return false;
+                    }
+                    payload.resize(payloadLength);
+                    if (payloadLength > 0 && !input.read(&payload[0], payloadLength))
+                    {
+                        return false;
+                    }
+
+                    const char* cursor = payload.c_str();
+                    const char* end = cursor + payload.size();
+                    if (recordType == TAG_DEFINITION || recordType == FORMAT_DEFINITION)
+                    {
+                        uint32_t id = 0;
+                        if (!ReadRaw(cursor, end, id))
+                        {
+                            return false;
+                        }
+                        (recordType == TAG_DEFINITION ? tags : formats)[id] = Aws::String(cursor, end);
+                        continue;
+                    }
+
+                    if (recordType != FORMATTED_RECORD && recordType != TEXT_RECORD)
+                    {
+                        // written by a newer version; skip it
+                        continue;
+                    }
+
+                    int64_t micros = 0;
+                    uint32_t tagId = 0;
+                    uint64_t threadId = 0;
+                    if (!ReadRaw(cursor, end, micros) || cursor == end)
+                    {
+                        return false;
+                    }
+                    LogLevel logLevel = static_cast<LogLevel>(*cursor++);
+                    if (!ReadRaw(cursor, end, tagId) || !ReadRaw(cursor, end, threadId))
+                    {
+                        return false;
+                    }
+
+                    auto tag = tags.find(tagId);
+                    if (tag == tags.end())
+                    {
+                        return false;
+                    }
+
+                    line.clear();
+                    line += "[";
+                    line += (logLevel >= LogLevel::Fatal && logLevel <= LogLevel::Trace) ? GetLogLevelName(logLevel) : "UNKNOWN";
+                    line += "] ";
+                    line += DateTime(static_cast<int64_t>(micros / 1000)).ToLocalTimeString("%Y-%m-%d %H:%M:%S");
+                    line += " ";
+                    line += tag->second;
+                    line += " [";
+                    line += StringUtils::to_string(threadId);
+                    line += "] ";
+
+                    if (recordType == TEXT_RECORD)
+                    {
+                        line.append(cursor, end);
+                    }
+                    else
+                    {
+                        uint32_t formatId = 0;
+                        if (!ReadRaw(cursor, end, formatId))
+                        {
+                            return false;
+                        }
+                        auto format = formats.find(formatId);
+                        if (format == formats.end() ||
+                            !FormatCapturedArguments(format->second.c_str(), format->second.size(), cursor, end, line))
+                        {
+                            return false;
+                        }
+                    }
+
+                    line += "\n";
+                    output.write(line.c_str(), static_cast<std::streamsize>(line.size()));
+                }
+            }
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
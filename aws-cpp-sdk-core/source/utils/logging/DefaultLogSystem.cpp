@@ -17,8 +17,9 @@
 #include <aws/core/utils/logging/DefaultLogSystem.h>
 
 #include <aws/core/utils/DateTime.h>
-#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/StringUtils.h>
 
+#include <chrono>
 #include <fstream>
 
 using namespace Aws::Utils;
@@ -26,71 +27,125 @@ using namespace Aws::Utils::Logging;
 
 static const char* AllocationTag = "DefaultLogSystem";
 
-static std::shared_ptr<Aws::OFStream> MakeDefaultLogFile(const Aws::String filenamePrefix)
+static const size_t MAX_LINES_PER_BATCH = 1024;
+static const std::chrono::milliseconds LOGGER_IDLE_WAIT(100);
+static const std::chrono::milliseconds PRODUCER_FULL_WAIT(10);
+
+static std::shared_ptr<Aws::OFStream> MakeDefaultLogFile(const Aws::String filenamePrefix, uint32_t sizeRollIndex = 0)
 {
-    Aws::String newFileName = filenamePrefix + DateTime::CalculateLocalTimestampAsString("%Y-%m-%d-%H") + ".log";
+    Aws::String newFileName = filenamePrefix + DateTime::CalculateLocalTimestampAsString("%Y-%m-%d-%H");
+    if (sizeRollIndex > 0)
+    {
+        newFileName += "." + StringUtils::to_string(sizeRollIndex);
+    }
+    newFileName += ".log";
+
     return Aws::MakeShared<Aws::OFStream>(AllocationTag, newFileName.c_str(), Aws::OFStream::out | Aws::OFStream::app);
 }
 
-static void LogThread(DefaultLogSystem::LogSynchronizationData* syncData, const std::shared_ptr<Aws::OStream>& logFile, const Aws::String& filenamePrefix, bool rollLog)
+static size_t GetCurrentFileSize(Aws::OStream& log)
+{
+    log.seekp(0, std::ios_base::end);
+    std::streampos size = log.tellp();
+    log.clear();
+    return size > 0 ? static_cast<size_t>(size) : 0;
+}
+
+static void LogThread(DefaultLogSystem::LogSynchronizationData* syncData, const std::shared_ptr<Aws::OStream>& logFile,
+    const Aws::String& filenamePrefix, bool rollLog, size_t maxFileSize)
 {
     bool done = false;
     int32_t lastRolledHour = DateTime::CalculateCurrentHour();
+    uint32_t sizeRollIndex = 0;
     std::shared_ptr<Aws::OStream> log = logFile;
+    size_t fileSize = (rollLog && maxFileSize > 0) ? GetCurrentFileSize(*log) : 0;
 
+    Aws::String message;
+    Aws::String batch;
     while(!done)
     {
-        std::unique_lock<std::mutex> locker(syncData->m_logQueueMutex);
-        if(syncData->m_stopLogging.load() == false && syncData->m_queuedLogMessages.size() == 0)
+        if(syncData->m_queuedLogMessages.IsEmpty())
         {
-            syncData->m_queueSignal.wait(locker, [&](){ return syncData->m_stopLogging.load() == true || syncData->m_queuedLogMessages.size() > 0; } );
+            // announce that we are going to sleep, then look again: a producer either sees the flag or we see its line
+            std::unique_lock<std::mutex> locker(syncData->m_logQueueMutex);
+            syncData->m_loggerSleeping.store(true);
+            if(syncData->m_queuedLogMessages.IsEmpty() && !syncData->m_stopLogging.load())
+            {
+                syncData->m_queueSignal.wait_for(locker, LOGGER_IDLE_WAIT);
+            }
+            syncData->m_loggerSleeping.store(false);
         }
 
-        Aws::Vector<Aws::String> messages;
-        while(!syncData->m_queuedLogMessages.empty())
+        done = syncData->m_stopLogging.load();
+
+        size_t lineCount = 0;
+        batch.clear();
+        while(lineCount < MAX_LINES_PER_BATCH && syncData->m_queuedLogMessages.TryPop(message))
         {
-            messages.push_back(syncData->m_queuedLogMessages.front());
-            syncData->m_queuedLogMessages.pop();
+            if(FormattedLogSystem::IsDeferredStatement(message))
+            {
+                FormattedLogSystem::ExpandDeferredStatement(message, batch);
+            }
+            else
+            {
+                batch += message;
+            }
+            ++lineCount;
         }
 
-        done = syncData->m_stopLogging.load() && syncData->m_queuedLogMessages.size() == 0;
-        locker.unlock();
+        if(syncData->m_blockedProducers.load() > 0)
+        {
+            std::lock_guard<std::mutex> locker(syncData->m_spaceMutex);
+            syncData->m_spaceSignal.notify_all();
+        }
 
-        if(messages.size() > 0)
+        // keep going until everything queued before the stop request is written
+        if(lineCount > 0)
         {
+            done = false;
+
             if (rollLog)
             {
                 int32_t currentHour = DateTime::CalculateCurrentHour();
                 if (currentHour != lastRolledHour)
                 {
+                    sizeRollIndex = 0;
                     log = MakeDefaultLogFile(filenamePrefix);
+                    fileSize = maxFileSize > 0 ? GetCurrentFileSize(*log) : 0;
                     lastRolledHour = currentHour;
                 }
-            }
 
-            for (uint32_t i = 0; i < messages.size(); ++i)
-            {
-                (*log) << messages[i];
+                if (maxFileSize > 0 && fileSize > 0 && fileSize + batch.size() > maxFileSize)
+                {
+                    log = MakeDefaultLogFile(filenamePrefix, ++sizeRollIndex);
+                    fileSize = GetCurrentFileSize(*log);
+                }
             }
+
+            log->write(batch.c_str(), static_cast<std::streamsize>(batch.size()));
             log->flush();
+            fileSize += batch.size();
+            syncData->m_writtenLines += lineCount;
         }
     }
 }
 
-DefaultLogSystem::DefaultLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile) :
-    Base(logLevel),
-    m_syncData(),
+DefaultLogSystem::DefaultLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile, const DefaultLogSystemOptions& options) :
+    Base(logLevel, options.deferFormatting),
+    m_syncData(options.queueCapacity),
+    m_overflowPolicy(options.overflowPolicy),
     m_loggingThread()
 {
-    m_loggingThread = std::thread(LogThread, &m_syncData, logFile, "", false);
+    m_loggingThread = std::thread(LogThread, &m_syncData, logFile, "", false, options.maxFileSizeBytes);
 }
 
-DefaultLogSystem::DefaultLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix) :
-    Base(logLevel),
-    m_syncData(),
+DefaultLogSystem::DefaultLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix, const DefaultLogSystemOptions& options) :
+    Base(logLevel, options.deferFormatting),
+    m_syncData(options.queueCapacity),
+    m_overflowPolicy(options.overflowPolicy),
     m_loggingThread()
 {
-    m_loggingThread = std::thread(LogThread, &m_syncData, MakeDefaultLogFile(filenamePrefix), filenamePrefix, true);
+    m_loggingThread = std::thread(LogThread, &m_syncData, MakeDefaultLogFile(filenamePrefix), filenamePrefix, true, options.maxFileSizeBytes);
 }
 
 DefaultLogSystem::~DefaultLogSystem()
@@ -105,13 +160,33 @@ DefaultLogSystem::~DefaultLogSystem()
     m_loggingThread.join();
 }
 
+void DefaultLogSystem::ProcessDeferredStatement(Aws::String&& record)
+{
+    ProcessFormattedStatement(std::move(record));
+}
+
 void DefaultLogSystem::ProcessFormattedStatement(Aws::String&& statement)
 {
+    while(!m_syncData.m_queuedLogMessages.TryPush(std::move(statement)))
     {
-        std::lock_guard<std::mutex> locker(m_syncData.m_logQueueMutex);
-        m_syncData.m_queuedLogMessages.push(std::move(statement));
+        if(m_overflowPolicy == LogOverflowPolicy::Drop)
+        {
+            ++m_syncData.m_droppedLines;
+            return;
+        }
+
+        // full: wait for the logging thread to drain a batch; the timeout covers a wakeup racing with our registration
+        ++m_syncData.m_blockedProducers;
+        {
+            std::unique_lock<std::mutex> locker(m_syncData.m_spaceMutex);
+            m_syncData.m_spaceSignal.wait_for(locker, PRODUCER_FULL_WAIT);
+        }
+        --m_syncData.m_blockedProducers;
     }
 
-    m_syncData.m_queueSignal.notify_one();
+    if(m_syncData.m_loggerSleeping.load())
+    {
+        std::lock_guard<std::mutex> locker(m_syncData.m_logQueueMutex);
+        m_syncData.m_queueSignal.notify_one();
+    }
 }
-
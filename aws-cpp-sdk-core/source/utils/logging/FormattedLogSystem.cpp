@@ -13,100 +13,298 @@
   * permissions and limitations under the License.
   */
 
-
 #include <aws/core/utils/logging/FormattedLogSystem.h>
 
 #include <aws/core/utils/DateTime.h>
-#include <aws/core/utils/Array.h>
+#include <aws/core/utils/logging/LogFormatCapture.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
 
-#include <fstream>
+#include <algorithm>
+#include <chrono>
 #include <cstdarg>
+#include <cstdint>
+#include <cstring>
 #include <stdio.h>
 #include <thread>
 
 using namespace Aws::Utils;
 using namespace Aws::Utils::Logging;
 
-static Aws::String CreateLogPrefixLine(LogLevel logLevel, const char* tag)
+namespace
 {
-    Aws::StringStream ss;
+    const size_t THREAD_FORMAT_BUFFER_SIZE = 1024;
+    const size_t MAX_THREAD_ID_LENGTH = 48;
+    const size_t TIMESTAMP_BUFFER_SIZE = 32;
+    // level, timestamp and the separators around tag and thread id
+    const size_t FIXED_PREFIX_LENGTH = 40;
+
+    // plain arrays only: thread_local objects that own Aws allocations would be freed after the memory system is gone
+    struct TimestampCache
+    {
+        int64_t second;
+        size_t length;
+        char text[TIMESTAMP_BUFFER_SIZE];
+    };
+
+    struct ThreadIdCache
+    {
+        size_t length;
+        char text[MAX_THREAD_ID_LENGTH];
+    };
+
+    thread_local TimestampCache s_timestampCache = { -1, 0, { 0 } };
+    thread_local ThreadIdCache s_threadIdCache = { 0, { 0 } };
+    thread_local char s_formatBuffer[THREAD_FORMAT_BUFFER_SIZE];
+
+    const char* GetLevelPrefix(LogLevel logLevel)
+    {
+        switch(logLevel)
+        {
+            case LogLevel::Error:
+                return "[ERROR] ";
+            case LogLevel::Fatal:
+                return "[FATAL] ";
+            case LogLevel::Warn:
+                return "[WARN] ";
+            case LogLevel::Info:
+                return "[INFO] ";
+            case LogLevel::Debug:
+                return "[DEBUG] ";
+            case LogLevel::Trace:
+                return "[TRACE] ";
+            default:
+                return "[UNKOWN] ";
+        }
+    }
 
-    switch(logLevel)
+    int64_t GetCurrentSecond()
     {
-        case LogLevel::Error:
-            ss << "[ERROR] ";
-            break;
+        return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    }
 
-        case LogLevel::Fatal:
-            ss << "[FATAL] ";
-            break;
+    /**
+     * strftime and localtime only run when the second changes on this thread.
+     */
+    const TimestampCache& GetTimestamp(int64_t second)
+    {
+        if (s_timestampCache.second != second)
+        {
+            Aws::String text = DateTime(static_cast<int64_t>(second * 1000)).ToLocalTimeString("%Y-%m-%d %H:%M:%S");
+            s_timestampCache.length = (std::min)(text.size(), TIMESTAMP_BUFFER_SIZE);
+            std::memcpy(s_timestampCache.text, text.c_str(), s_timestampCache.length);
+            s_timestampCache.second = second;
+        }
+        return s_timestampCache;
+    }
 
-        case LogLevel::Warn:
-            ss << "[WARN] ";
-            break;
+    const ThreadIdCache& GetThreadId()
+    {
+        if (s_threadIdCache.length == 0)
+        {
+            Aws::StringStream ss;
+            ss << std::this_thread::get_id();
+            Aws::String text = ss.str();
+            s_threadIdCache.length = (std::min)(text.size(), MAX_THREAD_ID_LENGTH);
+            std::memcpy(s_threadIdCache.text, text.c_str(), s_threadIdCache.length);
+        }
+        return s_threadIdCache;
+    }
 
-        case LogLevel::Info:
-            ss << "[INFO] ";
-            break;
+    void AppendLogPrefix(Aws::String& out, LogLevel logLevel, int64_t second, const char* threadId, size_t threadIdLength,
+        const char* tag, size_t tagLength)
+    {
+        const TimestampCache& timestamp = GetTimestamp(second);
+        out += GetLevelPrefix(logLevel);
+        out.append(timestamp.text, timestamp.length);
+        out.push_back(' ');
+        out.append(tag, tagLength);
+        out.append(" [", 2);
+        out.append(threadId, threadIdLength);
+        out.append("] ", 2);
+    }
 
-        case LogLevel::Debug:
-            ss << "[DEBUG] ";
-            break;
+    void AppendLogPrefix(Aws::String& out, LogLevel logLevel, const char* tag, size_t tagLength)
+    {
+        const ThreadIdCache& threadId = GetThreadId();
+        AppendLogPrefix(out, logLevel, GetCurrentSecond(), threadId.text, threadId.length, tag, tagLength);
+    }
 
-        case LogLevel::Trace:
-            ss << "[TRACE] ";
-            break;
+    template<typename T>
+    void AppendRaw(Aws::String& record, const T& value)
+    {
+        record.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
 
-        default:
-            ss << "[UNKOWN] ";
-            break;
+    template<typename T>
+    bool ReadRaw(const char*& cursor, const char* end, T& value)
+    {
+        if (static_cast<size_t>(end - cursor) < sizeof(T))
+        {
+            return false;
+        }
+        std::memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return true;
     }
 
-    ss << DateTime::CalculateLocalTimestampAsString("%Y-%m-%d %H:%M:%S") << " " << tag << " [" << std::this_thread::get_id() << "] ";
+    /**
+     * Formats into the thread's scratch buffer and copies once into an exactly sized line; only messages longer than
+     * the scratch buffer are formatted a second time.
+     */
+    Aws::String FormatStatement(LogLevel logLevel, const char* tag, const char* formatStr, va_list args)
+    {
+        va_list retryArgs;
+        va_copy(retryArgs, args);
+
+        #ifdef WIN32
+            int length = _vsnprintf_s(s_formatBuffer, THREAD_FORMAT_BUFFER_SIZE, _TRUNCATE, formatStr, args);
+            if (length < 0)
+            {
+                va_list measureArgs;
+                va_copy(measureArgs, retryArgs);
+                length = _vscprintf(formatStr, measureArgs);
+                va_end(measureArgs);
+            }
+        #else
+            int length = vsnprintf(s_formatBuffer, THREAD_FORMAT_BUFFER_SIZE, formatStr, args);
+        #endif // WIN32
+        const size_t messageLength = length > 0 ? static_cast<size_t>(length) : 0;
+
+        const size_t tagLength = std::strlen(tag);
+        Aws::String statement;
+        statement.reserve(FIXED_PREFIX_LENGTH + MAX_THREAD_ID_LENGTH + tagLength + messageLength + 1);
+        AppendLogPrefix(statement, logLevel, tag, tagLength);
+
+        if (messageLength < THREAD_FORMAT_BUFFER_SIZE)
+        {
+            statement.append(s_formatBuffer, messageLength);
+        }
+        else
+        {
+            size_t prefixLength = statement.size();
+            statement.resize(prefixLength + messageLength + 1);
+            #ifdef WIN32
+                vsnprintf_s(&statement[prefixLength], messageLength + 1, _TRUNCATE, formatStr, retryArgs);
+            #else
+                vsnprintf(&statement[prefixLength], messageLength + 1, formatStr, retryArgs);
+            #endif // WIN32
+            statement.resize(prefixLength + messageLength);
+        }
+        va_end(retryArgs);
 
-    return ss.str();
+        statement.push_back('\n');
+        return statement;
+    }
 }
 
-FormattedLogSystem::FormattedLogSystem(LogLevel logLevel) :
-    m_logLevel(logLevel)
+FormattedLogSystem::FormattedLogSystem(LogLevel logLevel, bool deferFormatting) :
+    m_logLevel(logLevel),
+    m_deferFormatting(deferFormatting)
 {
 }
 
 void FormattedLogSystem::Log(LogLevel logLevel, const char* tag, const char* formatStr, ...)
 {
-    Aws::StringStream ss;
-    ss << CreateLogPrefixLine(logLevel, tag);
-
     std::va_list args;
     va_start(args, formatStr);
 
-    va_list tmp_args; //unfortunately you cannot consume a va_list twice
-    va_copy(tmp_args, args); //so we have to copy it
-    #ifdef WIN32
-        const int requiredLength = _vscprintf(formatStr, tmp_args) + 1;
-    #else
-        const int requiredLength = vsnprintf(nullptr, 0, formatStr, tmp_args) + 1;
-    #endif
-    va_end(tmp_args);
-
-    Array<char> outputBuff(requiredLength);
-    #ifdef WIN32
-        vsnprintf_s(outputBuff.GetUnderlyingData(), requiredLength, _TRUNCATE, formatStr, args);
-    #else
-        vsnprintf(outputBuff.GetUnderlyingData(), requiredLength, formatStr, args);
-    #endif // WIN32
-
-    ss << outputBuff.GetUnderlyingData() << std::endl;  
-  
-    ProcessFormattedStatement(ss.str());
+    if (m_deferFormatting)
+    {
+        // marker, level, second, thread id and tag; the logging side rebuilds the prefix from these
+        const ThreadIdCache& threadId = GetThreadId();
+        const size_t tagLength = std::strlen(tag);
+        Aws::String record;
+        record.reserve(FIXED_PREFIX_LENGTH + threadId.length + tagLength + std::strlen(formatStr));
+        record.push_back('\0');
+        record.push_back(static_cast<char>(logLevel));
+        AppendRaw(record, GetCurrentSecond());
+        record.push_back(static_cast<char>(threadId.length));
+        record.append(threadId.text, threadId.length);
+        AppendRaw(record, static_cast<uint32_t>(tagLength));
+        record.append(tag, tagLength);
+
+        va_list captureArgs;
+        va_copy(captureArgs, args);
+        bool captured = CaptureFormatArguments(formatStr, captureArgs, record);
+        va_end(captureArgs);
+
+        if (captured)
+        {
+            va_end(args);
+            ProcessDeferredStatement(std::move(record));
+            return;
+        }
+    }
 
+    Aws::String statement = FormatStatement(logLevel, tag, formatStr, args);
     va_end(args);
+
+    ProcessFormattedStatement(std::move(statement));
 }
 
 void FormattedLogSystem::LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream &message_stream)
 {
-    Aws::StringStream ss;
-    ss << CreateLogPrefixLine(logLevel, tag) << message_stream.rdbuf()->str() << std::endl;
+    const Aws::String message = message_stream.str();
+    const size_t tagLength = std::strlen(tag);
+
+    Aws::String statement;
+    statement.reserve(FIXED_PREFIX_LENGTH + MAX_THREAD_ID_LENGTH + tagLength + message.size() + 1);
+    AppendLogPrefix(statement, logLevel, tag, tagLength);
+    statement += message;
+    statement.push_back('\n');
+
+    ProcessFormattedStatement(std::move(statement));
+}
+
+bool FormattedLogSystem::ExpandDeferredStatement(const Aws::String& record, Aws::String& out)
+{
+    if (!IsDeferredStatement(record) || record.size() < 2)
+    {
+        return false;
+    }
+
+    const char* cursor = record.c_str() + 1;
+    const char* end = record.c_str() + record.size();
+    const LogLevel logLevel = static_cast<LogLevel>(*cursor++);
+
+    int64_t second = 0;
+    if (!ReadRaw(cursor, end, second) || cursor == end)
+    {
+        return false;
+    }
+
+    const size_t threadIdLength = static_cast<unsigned char>(*cursor++);
+    if (static_cast<size_t>(end - cursor) < threadIdLength)
+    {
+        return false;
+    }
+    const char* threadId = cursor;
+    cursor += threadIdLength;
+
+    uint32_t tagLength = 0;
+    if (!ReadRaw(cursor, end, tagLength) || static_cast<size_t>(end - cursor) < tagLength)
+    {
+        return false;
+    }
+    const char* tag = cursor;
+    cursor += tagLength;
 
-    ProcessFormattedStatement(ss.str());
+    const size_t originalSize = out.size();
+    AppendLogPrefix(out, logLevel, second, threadId, threadIdLength, tag, tagLength);
+    if (!FormatCapturedArguments(cursor, end, out))
+    {
+        out.resize(originalSize);
+        return false;
+    }
+    out.push_back('\n');
+    return true;
+}
+
+void FormattedLogSystem::ProcessDeferredStatement(Aws::String&& record)
+{
+    Aws::String statement;
+    if (ExpandDeferredStatement(record, statement))
+    {
+        ProcessFormattedStatement(std::move(statement));
+    }
 }
@@ -0,0 +1,597 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/logging/LogFormatCapture.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cstddef>
+#include <limits>
+
+using namespace Aws::Utils::Logging;
+
+namespace
+{
+    // longest single conversion, e.g. "%-+#0123.456lld", that we are willing to replay
+    const size_t MAX_CONVERSION_LENGTH = 32;
+    const size_t STACK_FORMAT_BUFFER_SIZE = 256;
+
+    enum class ArgumentLength
+    {
+        Default,
+        Char,
+        Short,
+        Long,
+        LongLong,
+        IntMax,
+        Size,
+        PtrDiff,
+        LongDouble
+    };
+
+    struct Conversion
+    {
+        const char* begin;
+        size_t length;
+        int starCount;
+        // -1 when no precision was given; for ".*" the value comes from the last star argument
+        int precision;
+        bool precisionFromStar;
+        ArgumentLength argumentLength;
+        char specifier;
+    };
+
+    bool IsDigit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    /**
+     * Parses the conversion whose '%' is at position. Returns false for anything that cannot be captured and replayed.
+     */
+    bool ParseConversion(const char* position, Conversion& conversion)
+    {
+        conversion.begin = position;
+        conversion.starCount = 0;
+        conversion.precision = -1;
+        conversion.precisionFromStar = false;
+        conversion.argumentLength = ArgumentLength::Default;
+
+        const char* cursor = position + 1;
+        while (*cursor != '\0' && std::strchr("-+ #0'", *cursor) != nullptr)
+        {
+            ++cursor;
+        }
+
+        if (*cursor == '*')
+        {
+            ++conversion.starCount;
+            ++cursor;
+        }
+        while (IsDigit(*cursor))
+        {
+            ++cursor;
+        }
+
+        if (*cursor == '.')
+        {
+            ++cursor;
+            conversion.precision = 0;
+            if (*cursor == '*')
+            {
+                ++conversion.starCount;
+                conversion.precisionFromStar = true;
+                ++cursor;
+            }
+            while (IsDigit(*cursor))
+            {
+                if (conversion.precision < (std::numeric_limits<int>::max)() / 10)
+                {
+                    conversion.precision = conversion.precision * 10 + (*cursor - '0');
+                }
+                ++cursor;
+            }
+        }
+
+        switch (*cursor)
+        {
+            case 'h':
+                ++cursor;
+                conversion.argumentLength = ArgumentLength::Short;
+                if (*cursor == 'h')
+                {
+                    ++cursor;
+                    conversion.argumentLength = ArgumentLength::Char;
+                }
+                break;
+            case 'l':
+                ++cursor;
+                conversion.argumentLength = ArgumentLength::Long;
+                if (*cursor == 'l')
+                {
+                    ++cursor;
+                    conversion.argumentLength = ArgumentLength::LongLong;
+                }
+                break;
+            case 'j':
+                ++cursor;
+                conversion.argumentLength = ArgumentLength::IntMax;
+                break;
+            case 'z':
+                ++cursor;
+                conversion.argumentLength = ArgumentLength::Size;
+                break;
+            case 't':
+                ++cursor;
+                conversion.argumentLength = ArgumentLength::PtrDiff;
+                break;
+            case 'L':
+                ++cursor;
+                conversion.argumentLength = ArgumentLength::LongDouble;
+                break;
+            default:
+                break;
+        }
+
+        conversion.specifier = *cursor;
+        conversion.length = static_cast<size_t>(cursor + 1 - position);
+        if (conversion.specifier == '\0' || conversion.length >= MAX_CONVERSION_LENGTH)
+        {
+            return false;
+        }
+
+        switch (conversion.specifier)
+        {
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                return conversion.argumentLength != ArgumentLength::LongDouble;
+            case 'c':
+            case 's':
+            case 'p':
+                return conversion.argumentLength == ArgumentLength::Default;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                return conversion.argumentLength == ArgumentLength::Default || conversion.argumentLength == ArgumentLength::Long ||
+                    conversion.argumentLength == ArgumentLength::LongDouble;
+            default:
+                return false;
+        }
+    }
+
+    bool IsSigned(char specifier)
+    {
+        return specifier == 'd' || specifier == 'i';
+    }
+
+    bool IsInteger(char specifier)
+    {
+        return specifier == 'd' || specifier == 'i' || specifier == 'u' || specifier == 'o' || specifier == 'x' || specifier == 'X' ||
+            specifier == 'c';
+    }
+
+    template<typename T>
+    void AppendRaw(Aws::String& record, const T& value)
+    {
+        record.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool ReadRaw(const char*& cursor, const char* end, T& value)
+    {
+        if (static_cast<size_t>(end - cursor) < sizeof(T))
+        {
+            return false;
+        }
+        std::memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return true;
+    }
+
+    /**
+     * Integers, string lengths and pointers are stored as LEB128 varints, signed values zigzag encoded first, so the
+     * typical small argument takes one or two bytes.
+     */
+    void AppendVarint(Aws::String& record, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            record.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        record.push_back(static_cast<char>(value));
+    }
+
+    bool ReadVarint(const char*& cursor, const char* end, uint64_t& value)
+    {
+        value = 0;
+        for (unsigned shift = 0; cursor < end && shift < 64; shift += 7)
+        {
+            uint8_t byte = static_cast<uint8_t>(*cursor++);
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint64_t ZigZagEncode(int64_t value)
+    {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    int64_t ZigZagDecode(uint64_t value)
+    {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    template<typename... Args>
+    void AppendPrintf(Aws::String& out, const char* conversion, Args... args)
+    {
+        char buffer[STACK_FORMAT_BUFFER_SIZE];
+        int length = snprintf(buffer, sizeof(buffer), conversion, args...);
+        if (length < 0)
+        {
+            return;
+        }
+        if (static_cast<size_t>(length) < sizeof(buffer))
+        {
+            out.append(buffer, static_cast<size_t>(length));
+            return;
+        }
+
+        size_t oldSize = out.size();
+        out.resize(oldSize + static_cast<size_t>(length) + 1);
+        snprintf(&out[oldSize], static_cast<size_t>(length) + 1, conversion, args...);
+        out.resize(oldSize + static_cast<size_t>(length));
+    }
+
+    template<typename T>
+    void AppendConversion(Aws::String& out, const char* conversion, const int* stars, int starCount, T value)
+    {
+        switch (starCount)
+        {
+            case 0:
+                AppendPrintf(out, conversion, value);
+                break;
+            case 1:
+                AppendPrintf(out, conversion, stars[0], value);
+                break;
+            default:
+                AppendPrintf(out, conversion, stars[0], stars[1], value);
+                break;
+        }
+    }
+
+    void AppendInteger(Aws::String& out, const char* conversion, const int* stars, const Conversion& parsed, uint64_t bits)
+    {
+        if (parsed.specifier == 'c')
+        {
+            AppendConversion(out, conversion, stars, parsed.starCount, static_cast<int>(bits));
+            return;
+        }
+
+        bool isSigned = IsSigned(parsed.specifier);
+        int64_t signedValue = static_cast<int64_t>(bits);
+        switch (parsed.argumentLength)
+        {
+            case ArgumentLength::Long:
+                isSigned ? AppendConversion(out, conversion, stars, parsed.starCount, static_cast<long>(signedValue))
+                         : AppendConversion(out, conversion, stars, parsed.starCount, static_cast<unsigned long>(bits));
+                break;
+            case ArgumentLength::LongLong:
+                isSigned ? AppendConversion(out, conversion, stars, parsed.starCount, static_cast<long long>(signedValue))
+                         : AppendConversion(out, conversion, stars, parsed.starCount, static_cast<unsigned long long>(bits));
+                break;
+            case ArgumentLength::IntMax:
+                isSigned ? AppendConversion(out, conversion, stars, parsed.starCount, static_cast<intmax_t>(signedValue))
+                         : AppendConversion(out, conversion, stars, parsed.starCount, static_cast<uintmax_t>(bits));
+                break;
+            case ArgumentLength::Size:
+            case ArgumentLength::PtrDiff:
+                isSigned ? AppendConversion(out, conversion, stars, parsed.starCount, static_cast<ptrdiff_t>(signedValue))
+                         : AppendConversion(out, conversion, stars, parsed.starCount, static_cast<size_t>(bits));
+                break;
+            default:
+                // char and short arguments are promoted to int; printf narrows them again
+                isSigned ? AppendConversion(out, conversion, stars, parsed.starCount, static_cast<int>(signedValue))
+                         : AppendConversion(out, conversion, stars, parsed.starCount, static_cast<unsigned int>(bits));
+                break;
+        }
+    }
+}
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            bool CaptureFormatArguments(const char* formatStr, va_list args, Aws::String& record)
+            {
+                const size_t originalSize = record.size();
+                const size_t formatLength = std::strlen(formatStr);
+                if (formatLength > std::numeric_limits<uint32_t>::max())
+                {
+                    return false;
+                }
+
+                AppendRaw(record, static_cast<uint32_t>(formatLength));
+                record.append(formatStr, formatLength);
+                if (!CaptureArguments(formatStr, args, record))
+                {
+                    record.resize(originalSize);
+                    return false;
+                }
+                return true;
+            }
+
+            bool CaptureArguments(const char* formatStr, va_list args, Aws::String& record)
+            {
+                const size_t originalSize = record.size();
+                const char* cursor = formatStr;
+                while ((cursor = std::strchr(cursor, '%')) != nullptr)
+                {
+                    if (cursor[1] == '%')
+                    {
+                        cursor += 2;
+                        continue;
+                    }
+
+                    Conversion conversion;
+                    if (!ParseConversion(cursor, conversion))
+                    {
+                        record.resize(originalSize);
+                        return false;
+                    }
+                    cursor += conversion.length;
+
+                    int precision = conversion.precision;
+                    for (int i = 0; i < conversion.starCount; ++i)
+                    {
+                        int star = va_arg(args, int);
+                        if (conversion.precisionFromStar && i == conversion.starCount - 1)
+                        {
+                            // a negative precision argument is taken as if the precision were omitted
+                            precision = star;
+                        }
+                        AppendVarint(record, ZigZagEncode(star));
+                    }
+
+                    if (conversion.specifier == 's')
+                    {
+                        const char* value = va_arg(args, const char*);
+                        if (value == nullptr)
+                        {
+                            // lengths are stored plus one; zero marks a null pointer
+                            AppendVarint(record, 0);
+                            continue;
+                        }
+                        // with a precision the argument need not be null terminated, so never read past it
+                        size_t valueLength = 0;
+                        if (precision >= 0)
+                        {
+                            const void* terminator = std::memchr(value, '\0', static_cast<size_t>(precision));
+                            valueLength = terminator ? static_cast<size_t>(static_cast<const char*>(terminator) - value) : static_cast<size_t>(precision);
+                        }
+                        else
+                        {
+                            valueLength = std::strlen(value);
+                        }
+                        AppendVarint(record, static_cast<uint64_t>(valueLength) + 1);
+                        record.append(value, valueLength);
+                    }
+                    else if (conversion.specifier == 'p')
+                    {
+                        AppendVarint(record, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(va_arg(args, void*))));
+                    }
+                    else if (IsInteger(conversion.specifier))
+                    {
+                        bool isSigned = IsSigned(conversion.specifier) || conversion.specifier == 'c';
+                        uint64_t bits = 0;
+                        switch (conversion.argumentLength)
+                        {
+                            case ArgumentLength::Long:
+                                bits = isSigned ? static_cast<uint64_t>(va_arg(args, long)) : static_cast<uint64_t>(va_arg(args, unsigned long));
+                                break;
+                            case ArgumentLength::LongLong:
+                                bits = isSigned ? static_cast<uint64_t>(va_arg(args, long long)) : static_cast<uint64_t>(va_arg(args, unsigned long long));
+                                break;
+                            case ArgumentLength::IntMax:
+                                bits = isSigned ? static_cast<uint64_t>(va_arg(args, intmax_t)) : static_cast<uint64_t>(va_arg(args, uintmax_t));
+                                break;
+                            case ArgumentLength::Size:
+                            case ArgumentLength::PtrDiff:
+                                bits = isSigned ? static_cast<uint64_t>(va_arg(args, ptrdiff_t)) : static_cast<uint64_t>(va_arg(args, size_t));
+                                break;
+                            default:
+                                bits = isSigned ? static_cast<uint64_t>(static_cast<int64_t>(va_arg(args, int))) : static_cast<uint64_t>(va_arg(args, unsigned int));
+                                break;
+                        }
+                        AppendVarint(record, isSigned ? ZigZagEncode(static_cast<int64_t>(bits)) : bits);
+                    }
+                    else if (conversion.argumentLength == ArgumentLength::LongDouble)
+                    {
+                        AppendRaw(record, va_arg(args, long double));
+                    }
+                    else
+                    {
+                        AppendRaw(record, va_arg(args, double));
+                    }
+                }
+
+                return true;
+            }
+
+            bool FormatCapturedArguments(const char*& cursor, const char* end, Aws::String& out)
+            {
+                const char* position = cursor;
+                uint32_t formatLength = 0;
+                if (!ReadRaw(position, end, formatLength) || static_cast<size_t>(end - position) < formatLength)
+                {
+                    return false;
+                }
+
+                const char* format = position;
+                position += formatLength;
+                if (!FormatCapturedArguments(format, formatLength, position, end, out))
+                {
+                    return false;
+                }
+                cursor = position;
+                return true;
+            }
+
+            bool FormatCapturedArguments(const char* formatStr, size_t formatLength, const char*& cursor, const char* end, Aws::String& out)
+            {
+                const char* position = cursor;
+                const char* format = formatStr;
+                const char* formatEnd = format + formatLength;
+
+                const size_t originalSize = out.size();
+                char conversionText[MAX_CONVERSION_LENGTH];
+                const char* literal = format;
+                while (literal < formatEnd)
+                {
+                    const char* percent = static_cast<const char*>(std::memchr(literal, '%', static_cast<size_t>(formatEnd - literal)));
+                    if (percent == nullptr)
+                    {
+                        out.append(literal, static_cast<size_t>(formatEnd - literal));
+                        break;
+                    }
+
+                    out.append(literal, static_cast<size_t>(percent - literal));
+                    if (percent + 1 < formatEnd && percent[1] == '%')
+                    {
+                        out.push_back('%');
+                        literal = percent + 2;
+                        continue;
+                    }
+
+                    // the stored format is not null terminated, so parse from a bounded copy
+                    size_t available = std::min(static_cast<size_t>(formatEnd - percent), MAX_CONVERSION_LENGTH - 1);
+                    std::memcpy(conversionText, percent, available);
+                    conversionText[available] = '\0';
+
+                    Conversion conversion;
+                    if (!ParseConversion(conversionText, conversion))
+                    {
+                        out.resize(originalSize);
+                        return false;
+                    }
+                    conversionText[conversion.length] = '\0';
+                    literal = percent + conversion.length;
+
+                    int stars[2] = { 0, 0 };
+                    for (int i = 0; i < conversion.starCount; ++i)
+                    {
+                        uint64_t star = 0;
+                        if (!ReadVarint(position, end, star))
+                        {
+                            out.resize(originalSize);
+                            return false;
+                        }
+                        stars[i] = static_cast<int>(ZigZagDecode(star));
+                    }
+
+                    bool ok = true;
+                    if (conversion.specifier == 's')
+                    {
+                        uint64_t storedLength = 0;
+                        ok = ReadVarint(position, end, storedLength);
+                        const size_t valueLength = ok && storedLength > 0 ? static_cast<size_t>(storedLength - 1) : 0;
+                        if (ok && storedLength == 0)
+                        {
+                            AppendConversion(out, conversionText, stars, conversion.starCount, "(null)");
+                        }
+                        else if (ok && static_cast<size_t>(end - position) >= valueLength)
+                        {
+                            Aws::String value(position, valueLength);
+                            position += valueLength;
+                            AppendConversion(out, conversionText, stars, conversion.starCount, value.c_str());
+                        }
+                        else
+                        {
+                            ok = false;
+                        }
+                    }
+                    else if (conversion.specifier == 'p')
+                    {
+                        uint64_t bits = 0;
+                        ok = ReadVarint(position, end, bits);
+                        if (ok)
+                        {
+                            AppendConversion(out, conversionText, stars, conversion.starCount, reinterpret_cast<void*>(static_cast<uintptr_t>(bits)));
+                        }
+                    }
+                    else if (IsInteger(conversion.specifier))
+                    {
+                        uint64_t bits = 0;
+                        ok = ReadVarint(position, end, bits);
+                        if (ok)
+                        {
+                            if (IsSigned(conversion.specifier) || conversion.specifier == 'c')
+                            {
+                                bits = static_cast<uint64_t>(ZigZagDecode(bits));
+                            }
+                            AppendInteger(out, conversionText, stars, conversion, bits);
+                        }
+                    }
+                    else if (conversion.argumentLength == ArgumentLength::LongDouble)
+                    {
+                        long double value = 0;
+                        ok = ReadRaw(position, end, value);
+                        if (ok)
+                        {
+                            AppendConversion(out, conversionText, stars, conversion.starCount, value);
+                        }
+                    }
+                    else
+                    {
+                        double value = 0;
+                        ok = ReadRaw(position, end, value);
+                        if (ok)
+                        {
+                            AppendConversion(out, conversionText, stars, conversion.starCount, value);
+                        }
+                    }
+
+                    if (!ok)
+                    {
+                        out.resize(originalSize);
+                        return false;
+                    }
+                }
+
+                cursor = position;
+                return true;
+            }
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
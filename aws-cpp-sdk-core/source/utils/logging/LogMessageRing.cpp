@@ -0,0 +1,99 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/logging/LogMessageRing.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <cstdint>
+
+using namespace Aws::Utils::Logging;
+
+static const char* LOG_RING_TAG = "LogMessageRing";
+
+LogMessageRing::LogMessageRing(std::size_t capacity) :
+    m_slots(nullptr),
+    m_mask(0),
+    m_enqueuePosition(0),
+    m_dequeuePosition(0)
+{
+    std::size_t roundedCapacity = 2;
+    while (roundedCapacity < capacity)
+    {
+        roundedCapacity <<= 1;
+    }
+
+    m_mask = roundedCapacity - 1;
+    m_slots = Aws::NewArray<Slot>(roundedCapacity, LOG_RING_TAG);
+    for (std::size_t i = 0; i < roundedCapacity; ++i)
+    {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+LogMessageRing::~LogMessageRing()
+{
+    Aws::DeleteArray(m_slots);
+}
+
+bool LogMessageRing::TryPush(Aws::String&& message)
+{
+    std::size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    for (;;)
+    {
+        slot = &m_slots[position & m_mask];
+        std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+        if (difference == 0)
+        {
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            // the consumer has not freed this slot since the last lap
+            return false;
+        }
+        else
+        {
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->message = std::move(message);
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+bool LogMessageRing::TryPop(Aws::String& message)
+{
+    Slot& slot = m_slots[m_dequeuePosition & m_mask];
+    if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1)
+    {
+        return false;
+    }
+
+    message = std::move(slot.message);
+    slot.sequence.store(m_dequeuePosition + m_mask + 1, std::memory_order_release);
+    ++m_dequeuePosition;
+    return true;
+}
+
+bool LogMessageRing::IsEmpty() const
+{
+    return m_slots[m_dequeuePosition & m_mask].sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1;
+}
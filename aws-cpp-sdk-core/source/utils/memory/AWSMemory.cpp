@@ -16,6 +16,7 @@
 #include <aws/core/utils/memory/AWSMemory.h>
 
 #include <aws/core/utils/memory/MemorySystemInterface.h>
+#include <aws/core/utils/memory/MemoryArena.h>
 
 #include <atomic>
 
@@ -73,7 +74,11 @@ MemorySystemInterface* GetMemorySystem()
 
 void* Malloc(const char* allocationTag, size_t allocationSize)
 {
-    Aws::Utils::Memory::MemorySystemInterface* memorySystem = Aws::Utils::Memory::GetMemorySystem();
+    Aws::Utils::Memory::MemorySystemInterface* memorySystem = Aws::Utils::Memory::GetThreadAllocationArena();
+    if(memorySystem == nullptr)
+    {
+        memorySystem = Aws::Utils::Memory::GetMemorySystem();
+    }
 
     void* rawMemory = nullptr;
     if(memorySystem != nullptr)
@@ -96,6 +101,16 @@ void Free(void* memoryPtr)
         return;
     }
 
+    if(Aws::Utils::Memory::GetThreadMemoryArena() != nullptr)
+    {
+        Aws::Utils::Memory::MemoryArena* arena = Aws::Utils::Memory::FindOwningThreadArena(memoryPtr);
+        if(arena != nullptr)
+        {
+            arena->FreeMemory(memoryPtr);
+            return;
+        }
+    }
+
     Aws::Utils::Memory::MemorySystemInterface* memorySystem = Aws::Utils::Memory::GetMemorySystem();
     if(memorySystem != nullptr)
     {
@@ -0,0 +1,216 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/memory/BufferPool.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+using namespace Aws::Utils::Memory;
+
+static const char* BUFFER_POOL_TAG = "BufferPool";
+
+const std::size_t BufferPool::MIN_BUFFER_SIZE;
+const std::size_t BufferPool::DEFAULT_MAX_BUFFER_SIZE;
+const std::size_t BufferPool::DEFAULT_MAX_RETAINED_BYTES;
+const std::size_t BufferPool::DEFAULT_MAX_BUFFERS_PER_CLASS;
+
+PooledBuffer::PooledBuffer(PooledBuffer&& other) :
+    m_data(other.m_data),
+    m_capacity(other.m_capacity),
+    m_pool(other.m_pool)
+{
+    other.m_data = nullptr;
+    other.m_capacity = 0;
+    other.m_pool = nullptr;
+}
+
+PooledBuffer& PooledBuffer::operator=(PooledBuffer&& other)
+{
+    if (this != &other)
+    {
+        Release();
+        m_data = other.m_data;
+        m_capacity = other.m_capacity;
+        m_pool = other.m_pool;
+        other.m_data = nullptr;
+        other.m_capacity = 0;
+        other.m_pool = nullptr;
+    }
+
+    return *this;
+}
+
+void PooledBuffer::Release()
+{
+    if (m_data)
+    {
+        m_pool->Return(m_data, m_capacity);
+        m_data = nullptr;
+        m_capacity = 0;
+        m_pool = nullptr;
+    }
+}
+
+BufferPool::BufferPool(std::size_t maxBufferSize, std::size_t maxRetainedBytes, std::size_t maxBuffersPerClass) :
+    m_classCount(1),
+    m_maxRetainedBytes(maxRetainedBytes),
+    m_maxBuffersPerClass(maxBuffersPerClass),
+    m_retainedBytes(0),
+    m_hits(0),
+    m_misses(0),
+    m_retained(0),
+    m_dropped(0)
+{
+    while (m_classCount < MAX_SIZE_CLASSES && (MIN_BUFFER_SIZE << (m_classCount - 1)) < maxBufferSize)
+    {
+        ++m_classCount;
+    }
+}
+
+BufferPool::~BufferPool()
+{
+    Trim();
+}
+
+std::size_t BufferPool::SizeClassFor(std::size_t size) const
+{
+    std::size_t sizeClass = 0;
+    while (sizeClass < m_classCount && (MIN_BUFFER_SIZE << sizeClass) < size)
+    {
+        ++sizeClass;
+    }
+
+    return sizeClass;
+}
+
+PooledBuffer BufferPool::Lease(std::size_t minimumSize)
+{
+    std::size_t sizeClass = SizeClassFor(minimumSize);
+    if (sizeClass == m_classCount)
+    {
+        ++m_misses;
+        unsigned char* data = static_cast<unsigned char*>(Aws::Malloc(BUFFER_POOL_TAG, minimumSize));
+        return data ? PooledBuffer(data, minimumSize, this) : PooledBuffer();
+    }
+
+    std::size_t capacity = MIN_BUFFER_SIZE << sizeClass;
+    FreeBuffer* buffer = nullptr;
+    {
+        SizeClass& freeList = m_classes[sizeClass];
+        std::lock_guard<std::mutex> locker(freeList.lock);
+        buffer = freeList.head;
+        if (buffer)
+        {
+            freeList.head = buffer->next;
+            --freeList.count;
+        }
+    }
+
+    if (buffer)
+    {
+        m_retainedBytes -= capacity;
+        ++m_hits;
+        return PooledBuffer(reinterpret_cast<unsigned char*>(buffer), capacity, this);
+    }
+
+    ++m_misses;
+    unsigned char* data = static_cast<unsigned char*>(Aws::Malloc(BUFFER_POOL_TAG, capacity));
+    return data ? PooledBuffer(data, capacity, this) : PooledBuffer();
+}
+
+void BufferPool::Return(unsigned char* data, std::size_t capacity)
+{
+    std::size_t sizeClass = SizeClassFor(capacity);
+    bool pooledSize = sizeClass < m_classCount && (MIN_BUFFER_SIZE << sizeClass) == capacity;
+
+    if (pooledSize)
+    {
+        // reserve room in the byte budget first, so concurrent returns cannot overshoot it
+        std::size_t retainedBytes = m_retainedBytes.load();
+        bool reserved = false;
+        while (retainedBytes + capacity <= m_maxRetainedBytes)
+        {
+            if (m_retainedBytes.compare_exchange_weak(retainedBytes, retainedBytes + capacity))
+            {
+                reserved = true;
+                break;
+            }
+        }
+
+        if (reserved)
+        {
+            SizeClass& freeList = m_classes[sizeClass];
+            std::lock_guard<std::mutex> locker(freeList.lock);
+            if (freeList.count < m_maxBuffersPerClass)
+            {
+                FreeBuffer* buffer = reinterpret_cast<FreeBuffer*>(data);
+                buffer->next = freeList.head;
+                freeList.head = buffer;
+                ++freeList.count;
+                ++m_retained;
+                return;
+            }
+        }
+
+        if (reserved)
+        {
+            m_retainedBytes -= capacity;
+        }
+    }
+
+    ++m_dropped;
+    Aws::Free(data);
+}
+
+BufferPoolStats BufferPool::GetStats() const
+{
+    BufferPoolStats stats;
+    stats.hits = m_hits.load();
+    stats.misses = m_misses.load();
+    stats.retained = m_retained.load();
+    stats.dropped = m_dropped.load();
+    stats.retainedBytes = m_retainedBytes.load();
+    return stats;
+}
+
+void BufferPool::Trim()
+{
+    for (std::size_t sizeClass = 0; sizeClass < m_classCount; ++sizeClass)
+    {
+        FreeBuffer* head = nullptr;
+        std::size_t count = 0;
+        {
+            SizeClass& freeList = m_classes[sizeClass];
+            std::lock_guard<std::mutex> locker(freeList.lock);
+            head = freeList.head;
+            count = freeList.count;
+            freeList.head = nullptr;
+            freeList.count = 0;
+        }
+
+        m_retainedBytes -= count * (MIN_BUFFER_SIZE << sizeClass);
+        while (head)
+        {
+            FreeBuffer* next = head->next;
+            Aws::Free(head);
+            head = next;
+        }
+    }
+}
+
+BufferPool& Aws::Utils::Memory::GetDefaultBufferPool()
+{
+    static BufferPool defaultPool;
+    return defaultPool;
+}
@@ -0,0 +1,235 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/memory/MemoryArena.h>
+#include <aws/core/utils/UnreferencedParam.h>
+
+#include <cstdint>
+#include <cstdlib>
+
+using namespace Aws::Utils::Memory;
+
+namespace
+{
+    const std::size_t ARENA_ALIGNMENT = 16;
+
+    thread_local MemoryArena* s_threadArena = nullptr;
+    thread_local bool s_routeToArena = false;
+
+    // one default-sized chunk is kept per thread, so a steady stream of requests does not touch the system allocator
+    struct SpareChunk
+    {
+        void* chunk = nullptr;
+
+        ~SpareChunk()
+        {
+            free(chunk);
+        }
+    };
+
+    thread_local SpareChunk s_spareChunk;
+
+    std::size_t AlignUp(std::size_t value, std::size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+MemoryArena::MemoryArena(std::size_t chunkSize) :
+    m_chunkSize(chunkSize),
+    m_chunks(nullptr),
+    m_cursor(nullptr),
+    m_limit(nullptr),
+    m_lastAllocation(nullptr),
+    m_lowestAddress(nullptr),
+    m_highestAddress(nullptr),
+    m_allocationCount(0),
+    m_chunkCount(0),
+    m_outerArena(nullptr)
+{
+}
+
+MemoryArena::~MemoryArena()
+{
+    while (m_chunks)
+    {
+        Chunk* next = m_chunks->next;
+        if (m_chunks->size == DEFAULT_CHUNK_SIZE && !s_spareChunk.chunk)
+        {
+            s_spareChunk.chunk = m_chunks;
+        }
+        else
+        {
+            free(m_chunks);
+        }
+        m_chunks = next;
+    }
+}
+
+void* MemoryArena::AllocateChunk(std::size_t minimumSize)
+{
+    std::size_t headerSize = AlignUp(sizeof(Chunk), ARENA_ALIGNMENT);
+    std::size_t chunkSize = minimumSize + headerSize > m_chunkSize ? minimumSize + headerSize : m_chunkSize;
+
+    Chunk* chunk = nullptr;
+    if (chunkSize == DEFAULT_CHUNK_SIZE && s_spareChunk.chunk)
+    {
+        chunk = static_cast<Chunk*>(s_spareChunk.chunk);
+        s_spareChunk.chunk = nullptr;
+    }
+    else
+    {
+        chunk = static_cast<Chunk*>(malloc(chunkSize));
+        if (!chunk)
+        {
+            return nullptr;
+        }
+        ++m_chunkCount;
+    }
+
+    chunk->next = m_chunks;
+    chunk->size = chunkSize;
+    m_chunks = chunk;
+
+    m_cursor = reinterpret_cast<char*>(chunk) + headerSize;
+    m_limit = reinterpret_cast<char*>(chunk) + chunkSize;
+
+    // widen the range Owns checks first; this is the only place it changes, once per chunk
+    if (!m_lowestAddress || reinterpret_cast<char*>(chunk) < m_lowestAddress)
+    {
+        m_lowestAddress = reinterpret_cast<char*>(chunk);
+    }
+    if (!m_highestAddress || m_limit > m_highestAddress)
+    {
+        m_highestAddress = m_limit;
+    }
+    return m_cursor;
+}
+
+void* MemoryArena::AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag)
+{
+    AWS_UNREFERENCED_PARAM(allocationTag);
+
+    std::size_t effectiveAlignment = alignment > ARENA_ALIGNMENT ? alignment : ARENA_ALIGNMENT;
+    std::size_t size = blockSize == 0 ? 1 : blockSize;
+
+    char* start = nullptr;
+    if (m_cursor)
+    {
+        start = reinterpret_cast<char*>(AlignUp(reinterpret_cast<std::uintptr_t>(m_cursor), effectiveAlignment));
+    }
+
+    if (!start || start + size > m_limit || start + size < start)
+    {
+        if (!AllocateChunk(size + effectiveAlignment))
+        {
+            return nullptr;
+        }
+        start = reinterpret_cast<char*>(AlignUp(reinterpret_cast<std::uintptr_t>(m_cursor), effectiveAlignment));
+    }
+
+    m_cursor = start + size;
+    m_lastAllocation = start;
+    ++m_allocationCount;
+    return start;
+}
+
+void MemoryArena::FreeMemory(void* memoryPtr)
+{
+    // only the most recent block can be given back; everything else waits for the arena to go away
+    if (memoryPtr && memoryPtr == m_lastAllocation)
+    {
+        m_cursor = m_lastAllocation;
+        m_lastAllocation = nullptr;
+    }
+}
+
+bool MemoryArena::OwnsWithinRange(const char* address) const
+{
+    // the newest chunk comes first, and it is the one recent blocks, the only ones FreeMemory can reclaim, live in
+    for (const Chunk* chunk = m_chunks; chunk != nullptr; chunk = chunk->next)
+    {
+        const char* begin = reinterpret_cast<const char*>(chunk);
+        if (address >= begin && address < begin + chunk->size)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+ScopedMemoryArena::ScopedMemoryArena(std::size_t chunkSize, bool enabled) :
+    m_arena(chunkSize),
+    m_enabled(enabled),
+    m_outerRouting(s_routeToArena)
+{
+    if (m_enabled)
+    {
+        m_arena.m_outerArena = s_threadArena;
+        s_threadArena = &m_arena;
+        s_routeToArena = false;
+    }
+}
+
+ScopedMemoryArena::~ScopedMemoryArena()
+{
+    if (m_enabled)
+    {
+        s_threadArena = m_arena.m_outerArena;
+        s_routeToArena = m_outerRouting;
+    }
+}
+
+ArenaAllocationScope::ArenaAllocationScope(bool enabled) :
+    m_enabled(enabled),
+    m_outerRouting(s_routeToArena)
+{
+    if (m_enabled)
+    {
+        s_routeToArena = true;
+    }
+}
+
+ArenaAllocationScope::~ArenaAllocationScope()
+{
+    if (m_enabled)
+    {
+        s_routeToArena = m_outerRouting;
+    }
+}
+
+MemoryArena* Aws::Utils::Memory::GetThreadMemoryArena()
+{
+    return s_threadArena;
+}
+
+MemoryArena* Aws::Utils::Memory::GetThreadAllocationArena()
+{
+    return s_routeToArena ? s_threadArena : nullptr;
+}
+
+MemoryArena* Aws::Utils::Memory::FindOwningThreadArena(const void* memoryPtr)
+{
+    for (MemoryArena* arena = s_threadArena; arena != nullptr; arena = arena->GetOuterArena())
+    {
+        if (arena->Owns(memoryPtr))
+        {
+            return arena;
+        }
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,311 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/memory/TagProfilingMemorySystem.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace Aws::Utils::Memory;
+
+const char* TagProfilingMemorySystem::OVERFLOW_TAG = "<overflow>";
+const char* TagProfilingMemorySystem::UNTAGGED_TAG = "<untagged>";
+
+namespace
+{
+    const std::size_t HEADER_SIZE = 16;
+
+    // sits immediately in front of every block handed out, so a free can be attributed without a lookup
+    struct AllocationHeader
+    {
+        uint64_t size;
+        uint32_t slot;
+        uint32_t offsetFromAllocation;
+    };
+
+    static_assert(sizeof(AllocationHeader) <= HEADER_SIZE, "allocation header must fit in front of the block");
+
+    std::size_t ShardFor(const char* tag, std::size_t shardCount)
+    {
+        std::size_t address = reinterpret_cast<std::size_t>(tag);
+        address ^= address >> 17;
+        address *= 0x9E3779B1u;
+        return (address >> 7) % shardCount;
+    }
+
+    void Accumulate(TagMemoryStats& into, const TagMemoryStats& from)
+    {
+        into.liveBytes += from.liveBytes;
+        into.liveAllocations += from.liveAllocations;
+        into.totalBytes += from.totalBytes;
+        into.totalAllocations += from.totalAllocations;
+        into.highWaterBytes += from.highWaterBytes;
+    }
+}
+
+const TagMemoryStats* MemoryProfileSnapshot::Find(const Aws::String& tag) const
+{
+    for (const auto& stats : m_tags)
+    {
+        if (stats.tag == tag)
+        {
+            return &stats;
+        }
+    }
+
+    return nullptr;
+}
+
+int64_t MemoryProfileSnapshot::GetLiveBytes() const
+{
+    int64_t liveBytes = 0;
+    for (const auto& stats : m_tags)
+    {
+        liveBytes += stats.liveBytes;
+    }
+
+    return liveBytes;
+}
+
+int64_t MemoryProfileSnapshot::GetLiveAllocations() const
+{
+    int64_t liveAllocations = 0;
+    for (const auto& stats : m_tags)
+    {
+        liveAllocations += stats.liveAllocations;
+    }
+
+    return liveAllocations;
+}
+
+MemoryProfileSnapshot MemoryProfileSnapshot::Diff(const MemoryProfileSnapshot& earlier) const
+{
+    MemoryProfileSnapshot diff;
+    for (const auto& stats : m_tags)
+    {
+        TagMemoryStats delta = stats;
+        const TagMemoryStats* before = earlier.Find(stats.tag);
+        if (before)
+        {
+            delta.liveBytes -= before->liveBytes;
+            delta.liveAllocations -= before->liveAllocations;
+            delta.totalBytes -= before->totalBytes;
+            delta.totalAllocations -= before->totalAllocations;
+            delta.highWaterBytes -= before->highWaterBytes;
+        }
+
+        if (delta.liveBytes != 0 || delta.liveAllocations != 0 || delta.totalAllocations != 0 || delta.highWaterBytes != 0)
+        {
+            diff.m_tags.push_back(delta);
+        }
+    }
+
+    diff.Sort();
+    return diff;
+}
+
+Aws::String MemoryProfileSnapshot::ToString() const
+{
+    Aws::StringStream ss;
+    for (const auto& stats : m_tags)
+    {
+        ss << stats.tag << ": live bytes " << stats.liveBytes << ", live allocations " << stats.liveAllocations
+            << ", total bytes " << stats.totalBytes << ", total allocations " << stats.totalAllocations
+            << ", high-water bytes " << stats.highWaterBytes << "\n";
+    }
+
+    return ss.str();
+}
+
+void MemoryProfileSnapshot::Sort()
+{
+    std::stable_sort(m_tags.begin(), m_tags.end(), [](const TagMemoryStats& left, const TagMemoryStats& right)
+    {
+        return left.liveBytes > right.liveBytes;
+    });
+}
+
+TagProfilingMemorySystem::TagProfilingMemorySystem(MemorySystemInterface* wrappedSystem) :
+    m_wrappedSystem(wrappedSystem)
+{
+    for (auto& shard : m_shards)
+    {
+        std::memset(shard.slots, 0, sizeof(shard.slots));
+        std::memset(&shard.overflow, 0, sizeof(shard.overflow));
+        shard.overflow.tag = OVERFLOW_TAG;
+        shard.overflow.used = true;
+    }
+}
+
+void TagProfilingMemorySystem::Begin()
+{
+    if (m_wrappedSystem)
+    {
+        m_wrappedSystem->Begin();
+    }
+}
+
+void TagProfilingMemorySystem::End()
+{
+    if (m_wrappedSystem)
+    {
+        m_wrappedSystem->End();
+    }
+}
+
+uint32_t TagProfilingMemorySystem::Record(const char* allocationTag, std::size_t blockSize)
+{
+    const char* tag = allocationTag ? allocationTag : UNTAGGED_TAG;
+    std::size_t shardIndex = ShardFor(tag, SHARD_COUNT);
+    Shard& shard = m_shards[shardIndex];
+
+    std::lock_guard<std::mutex> locker(shard.lock);
+
+    std::size_t probe = (reinterpret_cast<std::size_t>(tag) >> 4) % SLOTS_PER_SHARD;
+    TagSlot* slot = &shard.overflow;
+    std::size_t slotIndex = SLOTS_PER_SHARD;
+    for (std::size_t i = 0; i < SLOTS_PER_SHARD; ++i, probe = (probe + 1) % SLOTS_PER_SHARD)
+    {
+        TagSlot& candidate = shard.slots[probe];
+        if (!candidate.used)
+        {
+            candidate.used = true;
+            candidate.tag = tag;
+        }
+
+        if (candidate.tag == tag)
+        {
+            slot = &candidate;
+            slotIndex = probe;
+            break;
+        }
+    }
+
+    slot->liveBytes += blockSize;
+    slot->liveAllocations++;
+    slot->totalBytes += blockSize;
+    slot->totalAllocations++;
+    slot->highWaterBytes = (std::max)(slot->highWaterBytes, slot->liveBytes);
+
+    return static_cast<uint32_t>(shardIndex * (SLOTS_PER_SHARD + 1) + slotIndex);
+}
+
+void TagProfilingMemorySystem::Release(uint32_t slotIndex, std::size_t blockSize)
+{
+    Shard& shard = m_shards[slotIndex / (SLOTS_PER_SHARD + 1)];
+    std::size_t indexInShard = slotIndex % (SLOTS_PER_SHARD + 1);
+
+    std::lock_guard<std::mutex> locker(shard.lock);
+    TagSlot& slot = indexInShard == SLOTS_PER_SHARD ? shard.overflow : shard.slots[indexInShard];
+    slot.liveBytes -= blockSize;
+    slot.liveAllocations--;
+}
+
+void* TagProfilingMemorySystem::AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag)
+{
+    std::size_t effectiveAlignment = alignment > HEADER_SIZE ? alignment : HEADER_SIZE;
+    std::size_t totalSize = blockSize + HEADER_SIZE + (effectiveAlignment - HEADER_SIZE);
+
+    void* rawMemory = m_wrappedSystem ? m_wrappedSystem->AllocateMemory(totalSize, 1, allocationTag) : malloc(totalSize);
+    if (!rawMemory)
+    {
+        return nullptr;
+    }
+
+    std::size_t address = reinterpret_cast<std::size_t>(rawMemory) + HEADER_SIZE;
+    address = (address + effectiveAlignment - 1) & ~(effectiveAlignment - 1);
+    char* userMemory = reinterpret_cast<char*>(address);
+
+    AllocationHeader* header = reinterpret_cast<AllocationHeader*>(userMemory - HEADER_SIZE);
+    header->size = blockSize;
+    header->slot = Record(allocationTag, blockSize);
+    header->offsetFromAllocation = static_cast<uint32_t>(userMemory - static_cast<char*>(rawMemory));
+
+    return userMemory;
+}
+
+void TagProfilingMemorySystem::FreeMemory(void* memoryPtr)
+{
+    if (!memoryPtr)
+    {
+        return;
+    }
+
+    char* userMemory = static_cast<char*>(memoryPtr);
+    AllocationHeader* header = reinterpret_cast<AllocationHeader*>(userMemory - HEADER_SIZE);
+    Release(header->slot, static_cast<std::size_t>(header->size));
+
+    void* rawMemory = userMemory - header->offsetFromAllocation;
+    if (m_wrappedSystem)
+    {
+        m_wrappedSystem->FreeMemory(rawMemory);
+    }
+    else
+    {
+        free(rawMemory);
+    }
+}
+
+MemoryProfileSnapshot TagProfilingMemorySystem::TakeSnapshot() const
+{
+    // copy the raw slots out first; building the snapshot allocates through this memory system, so no shard lock may be held
+    std::vector<TagSlot> slots;
+    slots.reserve(MAX_TAGS + SHARD_COUNT);
+    for (const auto& shard : m_shards)
+    {
+        std::lock_guard<std::mutex> locker(shard.lock);
+        for (const auto& slot : shard.slots)
+        {
+            if (slot.used)
+            {
+                slots.push_back(slot);
+            }
+        }
+
+        if (shard.overflow.totalAllocations > 0)
+        {
+            slots.push_back(shard.overflow);
+        }
+    }
+
+    Aws::Map<Aws::String, TagMemoryStats> merged;
+    for (const auto& slot : slots)
+    {
+        TagMemoryStats stats;
+        stats.liveBytes = slot.liveBytes;
+        stats.liveAllocations = slot.liveAllocations;
+        stats.totalBytes = slot.totalBytes;
+        stats.totalAllocations = slot.totalAllocations;
+        stats.highWaterBytes = slot.highWaterBytes;
+
+        TagMemoryStats& entry = merged[slot.tag];
+        entry.tag = slot.tag;
+        Accumulate(entry, stats);
+    }
+
+    MemoryProfileSnapshot snapshot;
+    snapshot.m_tags.reserve(merged.size());
+    for (const auto& entry : merged)
+    {
+        snapshot.m_tags.push_back(entry.second);
+    }
+
+    snapshot.Sort();
+    return snapshot;
+}
@@ -0,0 +1,436 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/memory/ThreadCachingMemorySystem.h>
+#include <aws/core/utils/UnreferencedParam.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+using namespace Aws::Utils::Memory;
+
+namespace
+{
+    // every block is preceded by a header recording where it came from; 16 bytes keeps the user pointer 16-byte aligned
+    const std::size_t BLOCK_HEADER_SIZE = 16;
+    const std::size_t SPAN_SIZE = 64 * 1024;
+    const std::uint32_t UNPOOLED_BLOCK = 0xFFFFFFFF;
+
+    // granularity doubles every few classes so the waste stays under ~20% while small sizes stay exact
+    const std::size_t SIZE_CLASSES[] = { 16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512, 640, 768, 896, 1024 };
+    const std::size_t MAX_POOLED_BLOCK_SIZE = 1024;
+
+    struct BlockHeader
+    {
+        std::uint32_t sizeClass;
+        std::uint32_t offsetFromAllocation;
+    };
+
+    std::size_t SizeClassFor(std::size_t size)
+    {
+        if (size <= 128)
+        {
+            return size == 0 ? 0 : (size - 1) / 16;
+        }
+        if (size <= 256)
+        {
+            return 8 + (size - 129) / 32;
+        }
+        if (size <= 512)
+        {
+            return 12 + (size - 257) / 64;
+        }
+        return 16 + (size - 513) / 128;
+    }
+
+    // blocks moved between a thread cache and the central list at once (about 8KB, clamped to 8..64); a cache holds at most two batches
+    const std::size_t BATCH_SIZES[] = { 64, 64, 64, 64, 64, 64, 64, 64, 51, 42, 36, 32, 25, 21, 18, 16, 12, 10, 9, 8 };
+
+    std::size_t BatchSizeFor(std::size_t sizeClass)
+    {
+        return BATCH_SIZES[sizeClass];
+    }
+
+    BlockHeader* HeaderOf(void* memoryPtr)
+    {
+        return reinterpret_cast<BlockHeader*>(static_cast<char*>(memoryPtr) - BLOCK_HEADER_SIZE);
+    }
+
+    // guards every system's thread cache list, so a thread exiting and a system being destroyed never race
+    std::mutex s_threadCacheRegistryLock;
+}
+
+namespace Aws
+{
+namespace Utils
+{
+namespace Memory
+{
+    /**
+     * Hands a thread's cached blocks back to their system when the thread exits.
+     */
+    struct ThreadCacheHolder
+    {
+        ThreadCacheHolder() : cache(nullptr) {}
+
+        ~ThreadCacheHolder()
+        {
+            // allocations made by later thread_local destructors go to the central lists
+            current = nullptr;
+            exited = true;
+
+            if (cache)
+            {
+                std::lock_guard<std::mutex> registryLock(s_threadCacheRegistryLock);
+                if (cache->owner)
+                {
+                    cache->owner->DetachThreadCache(cache);
+                }
+                free(cache);
+            }
+        }
+
+        ThreadCachingMemorySystem::ThreadCache* cache;
+
+        // the fast path only reads these trivially-initialized values, never the holder itself
+        static thread_local ThreadCachingMemorySystem::ThreadCache* current;
+        static thread_local bool exited;
+    };
+
+    thread_local ThreadCachingMemorySystem::ThreadCache* ThreadCacheHolder::current = nullptr;
+    thread_local bool ThreadCacheHolder::exited = false;
+} // namespace Memory
+} // namespace Utils
+} // namespace Aws
+
+static thread_local ThreadCacheHolder s_threadCacheHolder;
+
+ThreadCachingMemorySystem::ThreadCachingMemorySystem() :
+    m_spans(nullptr),
+    m_pooledBytes(0),
+    m_threadCaches(nullptr)
+{
+    static_assert(sizeof(SIZE_CLASSES) / sizeof(SIZE_CLASSES[0]) == SIZE_CLASS_COUNT, "size class table does not match SIZE_CLASS_COUNT");
+    static_assert(sizeof(BATCH_SIZES) / sizeof(BATCH_SIZES[0]) == SIZE_CLASS_COUNT, "batch size table does not match SIZE_CLASS_COUNT");
+    static_assert(sizeof(BlockHeader) <= BLOCK_HEADER_SIZE, "block header does not fit in its reserved space");
+}
+
+ThreadCachingMemorySystem::~ThreadCachingMemorySystem()
+{
+    {
+        // cached blocks live in our spans, so caches are simply emptied and left for their threads to free
+        std::lock_guard<std::mutex> registryLock(s_threadCacheRegistryLock);
+        for (ThreadCache* cache = m_threadCaches; cache != nullptr; cache = cache->nextCache)
+        {
+            cache->owner = nullptr;
+            memset(cache->freeLists, 0, sizeof(cache->freeLists));
+            memset(cache->freeCounts, 0, sizeof(cache->freeCounts));
+        }
+        m_threadCaches = nullptr;
+    }
+
+    while (m_spans)
+    {
+        void* nextSpan = *static_cast<void**>(m_spans);
+        free(m_spans);
+        m_spans = nextSpan;
+    }
+}
+
+std::size_t ThreadCachingMemorySystem::GetMaxPooledBlockSize()
+{
+    return MAX_POOLED_BLOCK_SIZE;
+}
+
+void* ThreadCachingMemorySystem::AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag)
+{
+    AWS_UNREFERENCED_PARAM(allocationTag);
+
+    if (blockSize > MAX_POOLED_BLOCK_SIZE || alignment > BLOCK_HEADER_SIZE)
+    {
+        std::size_t padding = alignment > BLOCK_HEADER_SIZE ? alignment : 0;
+        char* allocation = static_cast<char*>(malloc(blockSize + BLOCK_HEADER_SIZE + padding));
+        if (!allocation)
+        {
+            return nullptr;
+        }
+
+        std::uintptr_t userAddress = reinterpret_cast<std::uintptr_t>(allocation) + BLOCK_HEADER_SIZE;
+        if (padding)
+        {
+            userAddress = (userAddress + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+        }
+
+        void* memoryPtr = reinterpret_cast<void*>(userAddress);
+        BlockHeader* header = HeaderOf(memoryPtr);
+        header->sizeClass = UNPOOLED_BLOCK;
+        header->offsetFromAllocation = static_cast<std::uint32_t>(static_cast<char*>(memoryPtr) - allocation);
+        return memoryPtr;
+    }
+
+    std::size_t sizeClass = SizeClassFor(blockSize);
+    ThreadCache* cache = GetThreadCache();
+
+    Block* block = nullptr;
+    if (cache && cache->freeLists[sizeClass])
+    {
+        block = cache->freeLists[sizeClass];
+        cache->freeLists[sizeClass] = block->next;
+        --cache->freeCounts[sizeClass];
+    }
+    else
+    {
+        block = AllocateFromCentral(sizeClass, cache);
+        if (!block)
+        {
+            return nullptr;
+        }
+    }
+
+    BlockHeader* header = reinterpret_cast<BlockHeader*>(block);
+    header->sizeClass = static_cast<std::uint32_t>(sizeClass);
+    header->offsetFromAllocation = 0;
+    return reinterpret_cast<char*>(block) + BLOCK_HEADER_SIZE;
+}
+
+void ThreadCachingMemorySystem::FreeMemory(void* memoryPtr)
+{
+    if (!memoryPtr)
+    {
+        return;
+    }
+
+    BlockHeader* header = HeaderOf(memoryPtr);
+    if (header->sizeClass == UNPOOLED_BLOCK)
+    {
+        free(static_cast<char*>(memoryPtr) - header->offsetFromAllocation);
+        return;
+    }
+
+    std::size_t sizeClass = header->sizeClass;
+    Block* block = reinterpret_cast<Block*>(header);
+    ThreadCache* cache = GetThreadCache();
+    if (!cache)
+    {
+        ReturnToCentral(sizeClass, block, block, 1);
+        return;
+    }
+
+    block->next = cache->freeLists[sizeClass];
+    cache->freeLists[sizeClass] = block;
+
+    std::size_t batchSize = BatchSizeFor(sizeClass);
+    if (++cache->freeCounts[sizeClass] > 2 * batchSize)
+    {
+        // keep the most recently freed (cache-warm) blocks and hand an older batch back to other threads
+        Block* keepTail = cache->freeLists[sizeClass];
+        for (std::size_t i = 1; i < batchSize; ++i)
+        {
+            keepTail = keepTail->next;
+        }
+
+        Block* returnHead = keepTail->next;
+        Block* returnTail = returnHead;
+        std::size_t returnCount = cache->freeCounts[sizeClass] - batchSize;
+        for (std::size_t i = 1; i < returnCount; ++i)
+        {
+            returnTail = returnTail->next;
+        }
+
+        keepTail->next = nullptr;
+        cache->freeCounts[sizeClass] = batchSize;
+        ReturnToCentral(sizeClass, returnHead, returnTail, returnCount);
+    }
+}
+
+ThreadCachingMemorySystem::ThreadCache* ThreadCachingMemorySystem::GetThreadCache()
+{
+    ThreadCache* cache = ThreadCacheHolder::current;
+    if (cache && cache->owner == this)
+    {
+        return cache;
+    }
+
+    return AttachThreadCache();
+}
+
+ThreadCachingMemorySystem::ThreadCache* ThreadCachingMemorySystem::AttachThreadCache()
+{
+    if (ThreadCacheHolder::exited)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> registryLock(s_threadCacheRegistryLock);
+
+    ThreadCache* cache = s_threadCacheHolder.cache;
+    if (!cache)
+    {
+        cache = static_cast<ThreadCache*>(calloc(1, sizeof(ThreadCache)));
+        if (!cache)
+        {
+            return nullptr;
+        }
+        s_threadCacheHolder.cache = cache;
+        ThreadCacheHolder::current = cache;
+    }
+
+    // a thread caches for one system at a time; threads already caching for another one use the central lists
+    if (cache->owner && cache->owner != this)
+    {
+        return nullptr;
+    }
+
+    cache->owner = this;
+    cache->previousCache = nullptr;
+    cache->nextCache = m_threadCaches;
+    if (m_threadCaches)
+    {
+        m_threadCaches->previousCache = cache;
+    }
+    m_threadCaches = cache;
+
+    return cache;
+}
+
+void ThreadCachingMemorySystem::DetachThreadCache(ThreadCache* cache)
+{
+    for (std::size_t sizeClass = 0; sizeClass < SIZE_CLASS_COUNT; ++sizeClass)
+    {
+        Block* head = cache->freeLists[sizeClass];
+        if (head)
+        {
+            Block* tail = head;
+            while (tail->next)
+            {
+                tail = tail->next;
+            }
+            ReturnToCentral(sizeClass, head, tail, cache->freeCounts[sizeClass]);
+        }
+    }
+
+    if (cache->previousCache)
+    {
+        cache->previousCache->nextCache = cache->nextCache;
+    }
+    else
+    {
+        m_threadCaches = cache->nextCache;
+    }
+
+    if (cache->nextCache)
+    {
+        cache->nextCache->previousCache = cache->previousCache;
+    }
+
+    memset(cache, 0, sizeof(ThreadCache));
+}
+
+ThreadCachingMemorySystem::Block* ThreadCachingMemorySystem::AllocateFromCentral(std::size_t sizeClass, ThreadCache* cache)
+{
+    std::size_t wanted = cache ? BatchSizeFor(sizeClass) : 1;
+    Block* head = nullptr;
+    Block* tail = nullptr;
+    std::size_t count = 0;
+
+    {
+        CentralFreeList& central = m_centralLists[sizeClass];
+        std::lock_guard<std::mutex> centralLock(central.lock);
+        if (central.head)
+        {
+            head = central.head;
+            tail = head;
+            count = 1;
+            while (count < wanted && tail->next)
+            {
+                tail = tail->next;
+                ++count;
+            }
+
+            central.head = tail->next;
+            central.count -= count;
+            tail->next = nullptr;
+        }
+    }
+
+    if (!head)
+    {
+        head = CarveSpan(sizeClass, tail, count);
+        if (!head)
+        {
+            return nullptr;
+        }
+    }
+
+    Block* block = head;
+    Block* rest = head->next;
+    if (rest)
+    {
+        if (cache)
+        {
+            tail->next = cache->freeLists[sizeClass];
+            cache->freeLists[sizeClass] = rest;
+            cache->freeCounts[sizeClass] += count - 1;
+        }
+        else
+        {
+            ReturnToCentral(sizeClass, rest, tail, count - 1);
+        }
+    }
+
+    block->next = nullptr;
+    return block;
+}
+
+void ThreadCachingMemorySystem::ReturnToCentral(std::size_t sizeClass, Block* head, Block* tail, std::size_t count)
+{
+    CentralFreeList& central = m_centralLists[sizeClass];
+    std::lock_guard<std::mutex> centralLock(central.lock);
+    tail->next = central.head;
+    central.head = head;
+    central.count += count;
+}
+
+ThreadCachingMemorySystem::Block* ThreadCachingMemorySystem::CarveSpan(std::size_t sizeClass, Block*& tail, std::size_t& count)
+{
+    char* span = static_cast<char*>(malloc(SPAN_SIZE));
+    if (!span)
+    {
+        return nullptr;
+    }
+
+    {
+        // the first header-sized slot of each span links it into the list that is freed on destruction
+        std::lock_guard<std::mutex> spanLock(m_spanLock);
+        *reinterpret_cast<void**>(span) = m_spans;
+        m_spans = span;
+    }
+    m_pooledBytes += SPAN_SIZE;
+
+    std::size_t stride = BLOCK_HEADER_SIZE + SIZE_CLASSES[sizeClass];
+    count = (SPAN_SIZE - BLOCK_HEADER_SIZE) / stride;
+
+    char* first = span + BLOCK_HEADER_SIZE;
+    for (std::size_t i = 0; i + 1 < count; ++i)
+    {
+        reinterpret_cast<Block*>(first + i * stride)->next = reinterpret_cast<Block*>(first + (i + 1) * stride);
+    }
+
+    tail = reinterpret_cast<Block*>(first + (count - 1) * stride);
+    tail->next = nullptr;
+    return reinterpret_cast<Block*>(first);
+}
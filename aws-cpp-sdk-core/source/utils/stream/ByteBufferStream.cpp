@@ -0,0 +1,40 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/stream/ByteBufferStream.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+ByteBufferStream::ByteBufferStream(ByteBuffer& buffer) :
+    Aws::IOStream(nullptr),
+    m_streamBuf(buffer.GetUnderlyingData(), buffer.GetLength())
+{
+    rdbuf(&m_streamBuf);
+}
+
+ByteBufferStream::ByteBufferStream(unsigned char* buffer, size_t length) :
+    Aws::IOStream(nullptr),
+    m_streamBuf(buffer, length)
+{
+    rdbuf(&m_streamBuf);
+}
+
+ByteBufferStream::ByteBufferStream(const unsigned char* buffer, size_t length) :
+    Aws::IOStream(nullptr),
+    m_streamBuf(buffer, length)
+{
+    rdbuf(&m_streamBuf);
+}
@@ -0,0 +1,47 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/stream/MappedFileStream.h>
+#include <aws/core/platform/FileSystem.h>
+
+using namespace Aws::Utils::Stream;
+
+MappedFileStream::MappedRegion MappedFileStream::MapRegion(const char* path)
+{
+    MappedRegion region;
+    region.mapped = Aws::FileSystem::MapFileForRead(path, region.data, region.length, region.handle);
+    return region;
+}
+
+MappedFileStream::MappedFileStream(const char* path) :
+    Aws::IOStream(nullptr),
+    m_region(MapRegion(path)),
+    m_streamBuf(m_region.data, m_region.length)
+{
+    rdbuf(&m_streamBuf);
+
+    if (!m_region.mapped)
+    {
+        setstate(std::ios_base::badbit);
+    }
+}
+
+MappedFileStream::~MappedFileStream()
+{
+    if (m_region.mapped)
+    {
+        Aws::FileSystem::UnmapFile(m_region.data, m_region.length, m_region.handle);
+    }
+}
@@ -0,0 +1,201 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/stream/PooledResponseStream.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+using namespace Aws::Utils::Memory;
+using namespace Aws::Utils::Stream;
+
+static const char* POOLED_STREAM_TAG = "PooledResponseStream";
+
+PooledStreamBuf::PooledStreamBuf(BufferPool& pool) :
+    m_pool(pool),
+    m_size(0)
+{
+    setg(nullptr, nullptr, nullptr);
+    setp(nullptr, nullptr);
+}
+
+size_t PooledStreamBuf::GetSize() const
+{
+    return pptr() ? (std::max)(m_size, static_cast<size_t>(pptr() - pbase())) : m_size;
+}
+
+void PooledStreamBuf::UpdateSize()
+{
+    m_size = GetSize();
+}
+
+void PooledStreamBuf::SetAreas(size_t readPosition, size_t writePosition)
+{
+    char* base = reinterpret_cast<char*>(m_buffer.GetData());
+    setg(base, base + readPosition, base + m_size);
+    setp(base, base + m_buffer.GetCapacity());
+
+    // pbump only takes an int
+    while (writePosition > 0)
+    {
+        int step = static_cast<int>((std::min)(writePosition, static_cast<size_t>((std::numeric_limits<int>::max)())));
+        pbump(step);
+        writePosition -= step;
+    }
+}
+
+bool PooledStreamBuf::Reserve(size_t capacity)
+{
+    if (capacity <= m_buffer.GetCapacity())
+    {
+        return true;
+    }
+
+    UpdateSize();
+    size_t readPosition = eback() ? static_cast<size_t>(gptr() - eback()) : 0;
+    size_t writePosition = pbase() ? static_cast<size_t>(pptr() - pbase()) : 0;
+
+    size_t newCapacity = (std::max)(capacity, m_buffer.GetCapacity() * 2);
+    PooledBuffer grown = m_pool.Lease(newCapacity);
+    if (!grown)
+    {
+        return false;
+    }
+
+    if (m_size > 0)
+    {
+        std::memcpy(grown.GetData(), m_buffer.GetData(), m_size);
+    }
+
+    m_buffer = std::move(grown);
+    SetAreas(readPosition, writePosition);
+    return true;
+}
+
+PooledStreamBuf::int_type PooledStreamBuf::underflow()
+{
+    UpdateSize();
+    if (!eback())
+    {
+        return traits_type::eof();
+    }
+
+    // make everything written so far readable
+    setg(eback(), gptr(), eback() + m_size);
+    return gptr() < egptr() ? traits_type::to_int_type(*gptr()) : traits_type::eof();
+}
+
+PooledStreamBuf::int_type PooledStreamBuf::overflow(int_type c)
+{
+    if (traits_type::eq_int_type(c, traits_type::eof()))
+    {
+        return traits_type::not_eof(c);
+    }
+
+    size_t writePosition = pbase() ? static_cast<size_t>(pptr() - pbase()) : 0;
+    if (!Reserve(writePosition + 1))
+    {
+        return traits_type::eof();
+    }
+
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+    return c;
+}
+
+std::streamsize PooledStreamBuf::xsputn(const char* s, std::streamsize n)
+{
+    if (n <= 0)
+    {
+        return 0;
+    }
+
+    size_t writePosition = pbase() ? static_cast<size_t>(pptr() - pbase()) : 0;
+    if (!Reserve(writePosition + static_cast<size_t>(n)))
+    {
+        return 0;
+    }
+
+    std::memcpy(pptr(), s, static_cast<size_t>(n));
+    SetAreas(static_cast<size_t>(gptr() - eback()), writePosition + static_cast<size_t>(n));
+    UpdateSize();
+    return n;
+}
+
+PooledStreamBuf::pos_type PooledStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+    UpdateSize();
+
+    off_type readPosition = eback() ? gptr() - eback() : 0;
+    off_type writePosition = pbase() ? pptr() - pbase() : 0;
+    off_type base = 0;
+    if (dir == std::ios_base::cur)
+    {
+        if ((which & std::ios_base::in) && (which & std::ios_base::out))
+        {
+            return pos_type(off_type(-1));
+        }
+        base = (which & std::ios_base::in) ? readPosition : writePosition;
+    }
+    else if (dir == std::ios_base::end)
+    {
+        base = static_cast<off_type>(m_size);
+    }
+
+    return seekpos(pos_type(base + off), which);
+}
+
+PooledStreamBuf::pos_type PooledStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    UpdateSize();
+
+    off_type target = off_type(pos);
+    if (target < 0 || static_cast<size_t>(target) > m_size || !(which & (std::ios_base::in | std::ios_base::out)))
+    {
+        return pos_type(off_type(-1));
+    }
+
+    if (!eback())
+    {
+        return pos_type(off_type(0));
+    }
+
+    size_t readPosition = (which & std::ios_base::in) ? static_cast<size_t>(target) : static_cast<size_t>(gptr() - eback());
+    size_t writePosition = (which & std::ios_base::out) ? static_cast<size_t>(target) : static_cast<size_t>(pptr() - pbase());
+    SetAreas(readPosition, writePosition);
+    return pos;
+}
+
+PooledResponseStream::PooledResponseStream(BufferPool& pool) :
+    Aws::IOStream(nullptr),
+    m_streamBuf(pool)
+{
+    rdbuf(&m_streamBuf);
+}
+
+Aws::IOStream* Aws::Utils::Stream::PooledResponseStreamFactoryMethod()
+{
+    return Aws::New<PooledResponseStream>(POOLED_STREAM_TAG);
+}
+
+Aws::IOStreamFactory Aws::Utils::Stream::BuildPooledResponseStreamFactory(BufferPool& pool)
+{
+    return [&pool]() -> Aws::IOStream*
+    {
+        return Aws::New<PooledResponseStream>(POOLED_STREAM_TAG, pool);
+    };
+}
@@ -0,0 +1,97 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+
+#include <climits>
+
+using namespace Aws::Utils::Stream;
+
+PreallocatedStreamBuf::PreallocatedStreamBuf(unsigned char* buffer, size_t lengthToUse) :
+    m_underlyingBuffer(buffer), m_lengthToUse(lengthToUse), m_readOnly(false)
+{
+    char* begin = reinterpret_cast<char*>(m_underlyingBuffer);
+    char* end = begin + m_lengthToUse;
+
+    setp(begin, end);
+    setg(begin, begin, end);
+}
+
+PreallocatedStreamBuf::PreallocatedStreamBuf(const unsigned char* buffer, size_t lengthToUse) :
+    m_underlyingBuffer(const_cast<unsigned char*>(buffer)), m_lengthToUse(lengthToUse), m_readOnly(true)
+{
+    // the get area never writes through this pointer and the put area stays empty, so the memory is never modified
+    char* begin = reinterpret_cast<char*>(m_underlyingBuffer);
+    char* end = begin + m_lengthToUse;
+
+    setg(begin, begin, end);
+}
+
+PreallocatedStreamBuf::pos_type PreallocatedStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+    if (dir == std::ios_base::beg)
+    {
+        return seekpos(off, which);
+    }
+
+    if (dir == std::ios_base::end)
+    {
+        return seekpos(static_cast<off_type>(m_lengthToUse) + off, which);
+    }
+
+    // a relative seek is only meaningful for a single area, since the get and put positions move independently
+    if (which == std::ios_base::in)
+    {
+        return seekpos((gptr() - eback()) + off, which);
+    }
+
+    if (which == std::ios_base::out)
+    {
+        return seekpos((pptr() - pbase()) + off, which);
+    }
+
+    return pos_type(off_type(-1));
+}
+
+PreallocatedStreamBuf::pos_type PreallocatedStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    off_type offset = static_cast<off_type>(pos);
+    if (offset < 0 || static_cast<size_t>(offset) > m_lengthToUse || (m_readOnly && !(which & std::ios_base::in)))
+    {
+        return pos_type(off_type(-1));
+    }
+
+    char* begin = reinterpret_cast<char*>(m_underlyingBuffer);
+    char* end = begin + m_lengthToUse;
+
+    if (which & std::ios_base::in)
+    {
+        setg(begin, begin + offset, end);
+    }
+
+    if ((which & std::ios_base::out) && !m_readOnly)
+    {
+        setp(begin, end);
+        // pbump only takes an int, so advance in steps for buffers larger than INT_MAX
+        while (offset > 0)
+        {
+            int step = offset > static_cast<off_type>(INT_MAX) ? INT_MAX : static_cast<int>(offset);
+            pbump(step);
+            offset -= step;
+        }
+    }
+
+    return pos;
+}
@@ -0,0 +1,330 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/stream/SpillingResponseStream.h>
+#include <aws/core/platform/FileSystem.h>
+#include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/UUID.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+static const char* SPILLING_STREAM_TAG = "SpillingResponseStream";
+static const size_t DEFAULT_RESPONSE_MEMORY_BUDGET = 64 * 1024 * 1024;
+
+ResponseMemoryBudget::ResponseMemoryBudget(size_t limitInBytes) :
+    m_limit(limitInBytes), m_bytesInUse(0)
+{
+}
+
+bool ResponseMemoryBudget::TryReserve(size_t bytes)
+{
+    size_t inUse = m_bytesInUse.load();
+    do
+    {
+        size_t limit = m_limit.load();
+        if (inUse > limit || bytes > limit - inUse)
+        {
+            return false;
+        }
+    } while (!m_bytesInUse.compare_exchange_weak(inUse, inUse + bytes));
+
+    return true;
+}
+
+void ResponseMemoryBudget::Release(size_t bytes)
+{
+    m_bytesInUse.fetch_sub(bytes);
+}
+
+ResponseMemoryBudget& Aws::Utils::Stream::GetDefaultResponseMemoryBudget()
+{
+    static ResponseMemoryBudget defaultBudget(DEFAULT_RESPONSE_MEMORY_BUDGET);
+    return defaultBudget;
+}
+
+SpillingStreamBuf::SpillingStreamBuf(size_t memoryThreshold, ResponseMemoryBudget& budget, const Aws::String& spillFilePrefix) :
+    m_memoryThreshold(memoryThreshold),
+    m_budget(budget),
+    m_spillFilePrefix(spillFilePrefix),
+    m_reservedBytes(0),
+    m_spillFailed(false),
+    m_spillFile(nullptr),
+    m_size(0),
+    m_readPosition(0),
+    m_writePosition(0),
+    m_getAreaOffset(0)
+{
+}
+
+SpillingStreamBuf::~SpillingStreamBuf()
+{
+    m_budget.Release(m_reservedBytes);
+    if (m_spillFile)
+    {
+        // close before removing, some platforms won't delete an open file
+        Aws::String fileName = m_spillFile->GetFileName();
+        m_spillFile.reset();
+        Aws::FileSystem::RemoveFileIfExists(fileName.c_str());
+    }
+}
+
+size_t SpillingStreamBuf::GetReadPosition() const
+{
+    return eback() ? m_getAreaOffset + static_cast<size_t>(gptr() - eback()) : m_readPosition;
+}
+
+void SpillingStreamBuf::ResetGetArea(size_t readPosition)
+{
+    // the get area points into storage that writes and spills may move, so it is refilled lazily by underflow
+    setg(nullptr, nullptr, nullptr);
+    m_readPosition = readPosition;
+    m_getAreaOffset = readPosition;
+}
+
+SpillingStreamBuf::int_type SpillingStreamBuf::underflow()
+{
+    size_t position = GetReadPosition();
+    ResetGetArea(position);
+
+    if (position >= m_size)
+    {
+        return traits_type::eof();
+    }
+
+    if (!m_spillFile)
+    {
+        char* begin = &m_memory[0];
+        setg(begin, begin + position, begin + m_size);
+        m_getAreaOffset = 0;
+    }
+    else
+    {
+        std::streambuf* file = m_spillFile->rdbuf();
+        file->pubseekpos(position, std::ios_base::in);
+        std::streamsize toRead = static_cast<std::streamsize>((std::min)(sizeof(m_readBuffer), m_size - position));
+        std::streamsize read = file->sgetn(m_readBuffer, toRead);
+        if (read <= 0)
+        {
+            return traits_type::eof();
+        }
+
+        setg(m_readBuffer, m_readBuffer, m_readBuffer + read);
+    }
+
+    return traits_type::to_int_type(*gptr());
+}
+
+SpillingStreamBuf::int_type SpillingStreamBuf::pbackfail(int_type c)
+{
+    size_t position = GetReadPosition();
+    if (position == 0)
+    {
+        return traits_type::eof();
+    }
+
+    ResetGetArea(position - 1);
+    int_type previous = underflow();
+    if (!traits_type::eq_int_type(c, traits_type::eof()) && !traits_type::eq_int_type(c, previous))
+    {
+        ResetGetArea(position);
+        return traits_type::eof();
+    }
+
+    return previous;
+}
+
+std::streamsize SpillingStreamBuf::showmanyc()
+{
+    size_t position = GetReadPosition();
+    return position < m_size ? static_cast<std::streamsize>(m_size - position) : -1;
+}
+
+SpillingStreamBuf::int_type SpillingStreamBuf::overflow(int_type c)
+{
+    if (traits_type::eq_int_type(c, traits_type::eof()))
+    {
+        return traits_type::not_eof(c);
+    }
+
+    char toWrite = traits_type::to_char_type(c);
+    return xsputn(&toWrite, 1) == 1 ? c : traits_type::eof();
+}
+
+bool SpillingStreamBuf::ReserveMemory(size_t newSize)
+{
+    if (newSize <= m_reservedBytes)
+    {
+        return true;
+    }
+
+    if (newSize > m_memoryThreshold || !m_budget.TryReserve(newSize - m_reservedBytes))
+    {
+        return false;
+    }
+
+    m_reservedBytes = newSize;
+    return true;
+}
+
+bool SpillingStreamBuf::Spill()
+{
+    Aws::String fileName = m_spillFilePrefix.empty() ? Aws::FileSystem::GetTempDirectory() + Aws::FileSystem::PATH_DELIM : m_spillFilePrefix;
+    fileName += static_cast<Aws::String>(UUID::RandomUUID());
+    auto spillFile = Aws::MakeUnique<FStreamWithFileName>(SPILLING_STREAM_TAG, fileName,
+        std::ios_base::in | std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+
+    if (!spillFile->good() ||
+        spillFile->rdbuf()->sputn(m_memory.data(), static_cast<std::streamsize>(m_size)) != static_cast<std::streamsize>(m_size))
+    {
+        AWS_LOGSTREAM_ERROR(SPILLING_STREAM_TAG, "Unable to spill response to " << spillFile->GetFileName()
+            << ", keeping the remaining " << m_size << "+ bytes in memory.");
+        spillFile.reset();
+        Aws::FileSystem::RemoveFileIfExists(fileName.c_str());
+        return false;
+    }
+
+    AWS_LOGSTREAM_DEBUG(SPILLING_STREAM_TAG, "Spilled " << m_size << " bytes of response to " << spillFile->GetFileName());
+
+    ResetGetArea(GetReadPosition());
+    m_spillFile = std::move(spillFile);
+    Aws::String().swap(m_memory);
+    m_budget.Release(m_reservedBytes);
+    m_reservedBytes = 0;
+    return true;
+}
+
+std::streamsize SpillingStreamBuf::xsputn(const char* s, std::streamsize n)
+{
+    if (n <= 0)
+    {
+        return 0;
+    }
+
+    ResetGetArea(GetReadPosition());
+    size_t count = static_cast<size_t>(n);
+    size_t newSize = (std::max)(m_size, m_writePosition + count);
+
+    if (!m_spillFile && !ReserveMemory(newSize) && !m_spillFailed && !Spill())
+    {
+        // there is nowhere else to put the data, so it is kept in memory rather than losing the response
+        m_spillFailed = true;
+    }
+
+    if (!m_spillFile)
+    {
+        if (newSize > m_memory.size())
+        {
+            m_memory.resize(newSize);
+        }
+
+        memcpy(&m_memory[m_writePosition], s, count);
+    }
+    else
+    {
+        std::streambuf* file = m_spillFile->rdbuf();
+        file->pubseekpos(m_writePosition, std::ios_base::out);
+        std::streamsize written = file->sputn(s, n);
+        if (written <= 0)
+        {
+            return 0;
+        }
+
+        count = static_cast<size_t>(written);
+        newSize = (std::max)(m_size, m_writePosition + count);
+    }
+
+    m_writePosition += count;
+    m_size = newSize;
+    return static_cast<std::streamsize>(count);
+}
+
+SpillingStreamBuf::pos_type SpillingStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+    off_type base = 0;
+    if (dir == std::ios_base::end)
+    {
+        base = static_cast<off_type>(m_size);
+    }
+    else if (dir == std::ios_base::cur)
+    {
+        // a relative seek is only meaningful for a single area, since the get and put positions move independently
+        if (which == std::ios_base::in)
+        {
+            base = static_cast<off_type>(GetReadPosition());
+        }
+        else if (which == std::ios_base::out)
+        {
+            base = static_cast<off_type>(m_writePosition);
+        }
+        else
+        {
+            return pos_type(off_type(-1));
+        }
+    }
+
+    return seekpos(base + off, which);
+}
+
+SpillingStreamBuf::pos_type SpillingStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    off_type offset = static_cast<off_type>(pos);
+    if (offset < 0 || static_cast<size_t>(offset) > m_size)
+    {
+        return pos_type(off_type(-1));
+    }
+
+    if (which & std::ios_base::in)
+    {
+        ResetGetArea(static_cast<size_t>(offset));
+    }
+
+    if (which & std::ios_base::out)
+    {
+        m_writePosition = static_cast<size_t>(offset);
+    }
+
+    return pos;
+}
+
+int SpillingStreamBuf::sync()
+{
+    return m_spillFile ? m_spillFile->rdbuf()->pubsync() : 0;
+}
+
+SpillingResponseStream::SpillingResponseStream(size_t memoryThreshold, ResponseMemoryBudget& budget, const Aws::String& spillFilePrefix) :
+    Aws::IOStream(nullptr),
+    m_streamBuf(memoryThreshold, budget, spillFilePrefix)
+{
+    rdbuf(&m_streamBuf);
+}
+
+Aws::IOStream* Aws::Utils::Stream::SpillingResponseStreamFactoryMethod()
+{
+    return Aws::New<SpillingResponseStream>(SPILLING_STREAM_TAG);
+}
+
+Aws::IOStreamFactory Aws::Utils::Stream::BuildSpillingResponseStreamFactory(size_t memoryThreshold,
+    ResponseMemoryBudget& budget, const Aws::String& spillFilePrefix)
+{
+    return [memoryThreshold, &budget, spillFilePrefix]() -> Aws::IOStream*
+    {
+        return Aws::New<SpillingResponseStream>(SPILLING_STREAM_TAG, memoryThreshold, budget, spillFilePrefix);
+    };
+}
@@ -0,0 +1,56 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/stream/StringOutputStream.h>
+
+#include <utility>
+
+using namespace Aws::Utils::Stream;
+
+StringAppendStreamBuf::StringAppendStreamBuf(size_t initialCapacity)
+{
+    m_buffer.reserve(initialCapacity);
+}
+
+StringAppendStreamBuf::int_type StringAppendStreamBuf::overflow(int_type ch)
+{
+    if (traits_type::eq_int_type(ch, traits_type::eof()))
+    {
+        return traits_type::not_eof(ch);
+    }
+
+    m_buffer.push_back(traits_type::to_char_type(ch));
+    return ch;
+}
+
+std::streamsize StringAppendStreamBuf::xsputn(const char_type* s, std::streamsize n)
+{
+    m_buffer.append(s, static_cast<size_t>(n));
+    return n;
+}
+
+StringOutputStream::StringOutputStream(size_t initialCapacity) :
+    Aws::OStream(nullptr),
+    m_streamBuf(initialCapacity)
+{
+    rdbuf(&m_streamBuf);
+}
+
+Aws::String StringOutputStream::TakeString()
+{
+    Aws::String result(std::move(m_streamBuf.GetString()));
+    m_streamBuf.GetString().clear();
+    return result;
+}
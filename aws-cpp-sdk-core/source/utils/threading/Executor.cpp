@@ -23,7 +23,7 @@ using namespace Aws::Utils::Threading;
 
 bool DefaultExecutor::SubmitToThread(std::function<void()>&&  fx)
 {
-    std::thread t(fx);
+    std::thread t(std::move(fx));
     t.detach();
     return true;
 }
@@ -31,17 +31,19 @@ bool DefaultExecutor::SubmitToThread(std::function<void()>&&  fx)
 PooledThreadExecutor::PooledThreadExecutor(size_t poolSize, OverflowPolicy overflowPolicy) :
     m_poolSize(poolSize), m_overflowPolicy(overflowPolicy)
 {
-    for (size_t index = 0; index < m_poolSize; ++index)
-    {
-        m_threadTaskHandles.push_back(Aws::New<ThreadTask>(POOLED_CLASS_TAG, *this));
-    }
+    //threads are started by SubmitToThread as work arrives, so a pool that is never used costs nothing.
+    m_threadTaskHandles.reserve(m_poolSize);
 }
 
 PooledThreadExecutor::~PooledThreadExecutor()
 {
-    for(auto threadTask : m_threadTaskHandles)
     {
-        threadTask->StopProcessingWork();       
+        //a worker checks whether to keep going under this lock before it waits, so it cannot miss the notification below.
+        std::lock_guard<std::mutex> locker(m_syncPointLock);
+        for(auto threadTask : m_threadTaskHandles)
+        {
+            threadTask->StopProcessingWork();
+        }
     }
 
     m_syncPoint.notify_all();
@@ -72,14 +74,25 @@ bool PooledThreadExecutor::SubmitToThread(std::function<void()>&& fn)
     {
         std::lock_guard<std::mutex> locker(m_queueLock);
 
-        if (m_overflowPolicy == OverflowPolicy::REJECT_IMMEDIATELY && m_poolSize >= m_tasks.size())
+        if (m_overflowPolicy == OverflowPolicy::REJECT_IMMEDIATELY && m_tasks.size() >= m_poolSize)
         {
+            Aws::Delete(fnCpy);
             return false;
         }
 
         m_tasks.push(fnCpy);
+
+        if (m_threadTaskHandles.size() < m_poolSize)
+        {
+            m_threadTaskHandles.push_back(Aws::New<ThreadTask>(POOLED_CLASS_TAG, *this));
+        }
     }
 
+    {
+        //an idle worker checks for tasks under this lock before it waits, so taking it here means the worker either sees
+        //the task or is already waiting for the notification.
+        std::lock_guard<std::mutex> locker(m_syncPointLock);
+    }
     m_syncPoint.notify_one();
   
     return true;
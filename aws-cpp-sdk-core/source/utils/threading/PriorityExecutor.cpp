@@ -0,0 +1,286 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/threading/PriorityExecutor.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+using namespace Aws::Utils::Threading;
+
+static thread_local TaskPriority s_currentPriority = TaskPriority::Normal;
+// lets a Block submission made from inside a task detect that waiting would starve its own pool
+static thread_local const PriorityExecutor* s_currentExecutor = nullptr;
+
+ScopedTaskPriority::ScopedTaskPriority(TaskPriority priority) : m_previous(s_currentPriority)
+{
+    s_currentPriority = priority;
+}
+
+ScopedTaskPriority::~ScopedTaskPriority()
+{
+    s_currentPriority = m_previous;
+}
+
+TaskPriority ScopedTaskPriority::GetCurrent()
+{
+    return s_currentPriority;
+}
+
+LatencyHistogramSnapshot::LatencyHistogramSnapshot()
+{
+    for (size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        counts[i] = 0;
+    }
+}
+
+uint64_t LatencyHistogramSnapshot::GetCount() const
+{
+    uint64_t total = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        total += counts[i];
+    }
+    return total;
+}
+
+uint64_t LatencyHistogramSnapshot::GetPercentileUpperBoundMicros(double percentile) const
+{
+    uint64_t total = GetCount();
+    if (total == 0)
+    {
+        return 0;
+    }
+
+    double wanted = total * percentile / 100.0;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        seen += counts[i];
+        if (counts[i] > 0 && seen >= wanted)
+        {
+            return static_cast<uint64_t>(1) << i;
+        }
+    }
+    return static_cast<uint64_t>(1) << (BUCKET_COUNT - 1);
+}
+
+Aws::String LatencyHistogramSnapshot::ToString() const
+{
+    Aws::StringStream ss;
+    ss << "count=" << GetCount() << " p50<" << GetPercentileUpperBoundMicros(50) << "us p99<" << GetPercentileUpperBoundMicros(99)
+       << "us p999<" << GetPercentileUpperBoundMicros(99.9) << "us";
+    return ss.str();
+}
+
+LatencyHistogram::LatencyHistogram()
+{
+    for (size_t i = 0; i < LatencyHistogramSnapshot::BUCKET_COUNT; ++i)
+    {
+        m_counts[i] = 0;
+    }
+}
+
+void LatencyHistogram::Record(std::chrono::microseconds latency)
+{
+    uint64_t micros = latency.count() > 0 ? static_cast<uint64_t>(latency.count()) : 0;
+    size_t bucket = 0;
+    while (micros > 0 && bucket < LatencyHistogramSnapshot::BUCKET_COUNT - 1)
+    {
+        micros >>= 1;
+        ++bucket;
+    }
+    m_counts[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+LatencyHistogramSnapshot LatencyHistogram::GetSnapshot() const
+{
+    LatencyHistogramSnapshot snapshot;
+    for (size_t i = 0; i < LatencyHistogramSnapshot::BUCKET_COUNT; ++i)
+    {
+        snapshot.counts[i] = m_counts[i].load(std::memory_order_relaxed);
+    }
+    return snapshot;
+}
+
+PriorityExecutorMetrics::PriorityExecutorMetrics() : submitted(0), rejected(0), ranOnCaller(0), blockedSubmissions(0)
+{
+    for (size_t i = 0; i < TASK_PRIORITY_COUNT; ++i)
+    {
+        queueDepth[i] = 0;
+    }
+}
+
+PriorityExecutor::PriorityExecutor(size_t poolSize, size_t maxQueuedTasks, BackpressurePolicy backpressurePolicy, size_t starvationGuard) :
+    m_queuedTasks(0), m_picksSinceStarvationGuard(0), m_maxQueuedTasks(maxQueuedTasks), m_backpressurePolicy(backpressurePolicy),
+    m_starvationGuard(starvationGuard), m_stop(false), m_submitted(0), m_rejected(0), m_ranOnCaller(0), m_blockedSubmissions(0)
+{
+    poolSize = poolSize > 0 ? poolSize : 1;
+    for (size_t index = 0; index < poolSize; ++index)
+    {
+        m_workers.push_back(std::thread(&PriorityExecutor::WorkerLoop, this));
+    }
+}
+
+PriorityExecutor::~PriorityExecutor()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_stop = true;
+    }
+    m_workAvailable.notify_all();
+    m_spaceAvailable.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+bool PriorityExecutor::SubmitToThread(std::function<void()>&& fn)
+{
+    return Enqueue(ScopedTaskPriority::GetCurrent(), SmallTask(std::move(fn)));
+}
+
+bool PriorityExecutor::Enqueue(TaskPriority priority, SmallTask&& task)
+{
+    std::unique_lock<std::mutex> locker(m_lock);
+    if (m_stop)
+    {
+        ++m_rejected;
+        return false;
+    }
+
+    if (m_maxQueuedTasks > 0 && m_queuedTasks >= m_maxQueuedTasks)
+    {
+        BackpressurePolicy policy = m_backpressurePolicy;
+        if (policy == BackpressurePolicy::Block && s_currentExecutor == this)
+        {
+            policy = BackpressurePolicy::CallerRuns;
+        }
+
+        switch (policy)
+        {
+        case BackpressurePolicy::Reject:
+            ++m_rejected;
+            return false;
+        case BackpressurePolicy::CallerRuns:
+            locker.unlock();
+            ++m_submitted;
+            ++m_ranOnCaller;
+            m_queueWait.Record(std::chrono::microseconds(0));
+            RunTimed(task);
+            return true;
+        case BackpressurePolicy::Block:
+            ++m_blockedSubmissions;
+            m_spaceAvailable.wait(locker, [this] { return m_stop || m_queuedTasks < m_maxQueuedTasks; });
+            if (m_stop)
+            {
+                ++m_rejected;
+                return false;
+            }
+            break;
+        }
+    }
+
+    m_lanes[static_cast<size_t>(priority)].push_back(QueuedTask(std::move(task)));
+    ++m_queuedTasks;
+    ++m_submitted;
+    locker.unlock();
+    m_workAvailable.notify_one();
+    return true;
+}
+
+bool PriorityExecutor::PopLocked(QueuedTask& task)
+{
+    if (m_queuedTasks == 0)
+    {
+        return false;
+    }
+
+    size_t lane = 0;
+    if (m_starvationGuard > 0 && ++m_picksSinceStarvationGuard >= m_starvationGuard)
+    {
+        m_picksSinceStarvationGuard = 0;
+        lane = TASK_PRIORITY_COUNT - 1;
+        while (m_lanes[lane].empty())
+        {
+            --lane;
+        }
+    }
+    else
+    {
+        while (m_lanes[lane].empty())
+        {
+            ++lane;
+        }
+    }
+
+    task = std::move(m_lanes[lane].front());
+    m_lanes[lane].pop_front();
+    --m_queuedTasks;
+    return true;
+}
+
+void PriorityExecutor::RunTimed(SmallTask& task)
+{
+    auto start = std::chrono::steady_clock::now();
+    task();
+    m_runTime.Record(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+}
+
+void PriorityExecutor::WorkerLoop()
+{
+    s_currentExecutor = this;
+    QueuedTask task;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_workAvailable.wait(locker, [this] { return m_stop || m_queuedTasks > 0; });
+            if (m_stop)
+            {
+                return;
+            }
+            PopLocked(task);
+        }
+        if (m_maxQueuedTasks > 0)
+        {
+            m_spaceAvailable.notify_one();
+        }
+
+        m_queueWait.Record(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - task.m_enqueued));
+        RunTimed(task.m_task);
+        task.m_task.Reset();
+    }
+}
+
+PriorityExecutorMetrics PriorityExecutor::GetMetrics() const
+{
+    PriorityExecutorMetrics metrics;
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        for (size_t i = 0; i < TASK_PRIORITY_COUNT; ++i)
+        {
+            metrics.queueDepth[i] = m_lanes[i].size();
+        }
+    }
+    metrics.submitted = m_submitted.load();
+    metrics.rejected = m_rejected.load();
+    metrics.ranOnCaller = m_ranOnCaller.load();
+    metrics.blockedSubmissions = m_blockedSubmissions.load();
+    metrics.queueWait = m_queueWait.GetSnapshot();
+    metrics.runTime = m_runTime.GetSnapshot();
+    return metrics;
+}
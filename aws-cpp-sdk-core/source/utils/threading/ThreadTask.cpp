@@ -44,7 +44,7 @@ void ThreadTask::MainTaskRunner()
         }
      
         std::unique_lock<std::mutex> locker(m_executor.m_syncPointLock);
-        if(m_continue)
+        if(m_continue && !m_executor.HasTasks())
         {
             m_executor.m_syncPoint.wait(locker);    
         }
@@ -0,0 +1,162 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/threading/WorkStealingExecutor.h>
+
+static const char* WORK_STEALING_CLASS_TAG = "WorkStealingExecutor";
+// yields a worker makes after finding no work before it parks
+static const unsigned IDLE_SPINS_BEFORE_PARKING = 64;
+
+using namespace Aws::Utils::Threading;
+
+// lets Submit() from inside a task find the deque of the worker running it
+static thread_local const WorkStealingExecutor* s_currentExecutor = nullptr;
+static thread_local size_t s_currentWorker = 0;
+
+WorkStealingExecutor::WorkStealingExecutor(size_t poolSize, OverflowPolicy overflowPolicy) :
+    m_overflowPolicy(overflowPolicy), m_stop(false), m_pendingTasks(0), m_nextWorker(0), m_sleepingWorkers(0), m_steals(0)
+{
+    poolSize = poolSize > 0 ? poolSize : 1;
+    for (size_t index = 0; index < poolSize; ++index)
+    {
+        m_workers.push_back(Aws::New<Worker>(WORK_STEALING_CLASS_TAG));
+    }
+
+    // every deque exists before any worker can try to steal from it
+    for (size_t index = 0; index < poolSize; ++index)
+    {
+        m_workers[index]->m_thread = std::thread(&WorkStealingExecutor::WorkerLoop, this, index);
+    }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_parkLock);
+        m_stop = true;
+    }
+    m_parkSignal.notify_all();
+
+    for (auto worker : m_workers)
+    {
+        worker->m_thread.join();
+    }
+
+    for (auto worker : m_workers)
+    {
+        Aws::Delete(worker);
+    }
+}
+
+bool WorkStealingExecutor::SubmitToThread(std::function<void()>&& fn)
+{
+    return Enqueue(SmallTask(std::move(fn)));
+}
+
+bool WorkStealingExecutor::Enqueue(SmallTask&& task)
+{
+    if (m_overflowPolicy == OverflowPolicy::REJECT_IMMEDIATELY && m_pendingTasks.load() >= m_workers.size())
+    {
+        return false;
+    }
+
+    size_t target = s_currentExecutor == this ? s_currentWorker : m_nextWorker++ % m_workers.size();
+
+    // counted before it is visible so a worker deciding whether to park cannot miss it
+    ++m_pendingTasks;
+    {
+        std::lock_guard<std::mutex> locker(m_workers[target]->m_lock);
+        m_workers[target]->m_tasks.push_back(std::move(task));
+    }
+
+    if (m_sleepingWorkers.load() > 0)
+    {
+        std::lock_guard<std::mutex> locker(m_parkLock);
+        m_parkSignal.notify_one();
+    }
+
+    return true;
+}
+
+bool WorkStealingExecutor::TryPopOwn(size_t workerIndex, SmallTask& task)
+{
+    Worker* worker = m_workers[workerIndex];
+    std::lock_guard<std::mutex> locker(worker->m_lock);
+    if (worker->m_tasks.empty())
+    {
+        return false;
+    }
+
+    // newest first: it is the most likely to still be in cache
+    task = std::move(worker->m_tasks.back());
+    worker->m_tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingExecutor::TrySteal(size_t thiefIndex, SmallTask& task)
+{
+    const size_t workerCount = m_workers.size();
+    for (size_t offset = 1; offset < workerCount; ++offset)
+    {
+        Worker* victim = m_workers[(thiefIndex + offset) % workerCount];
+        std::unique_lock<std::mutex> locker(victim->m_lock, std::try_to_lock);
+        if (locker.owns_lock() && !victim->m_tasks.empty())
+        {
+            task = std::move(victim->m_tasks.front());
+            victim->m_tasks.pop_front();
+            ++m_steals;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void WorkStealingExecutor::WorkerLoop(size_t workerIndex)
+{
+    s_currentExecutor = this;
+    s_currentWorker = workerIndex;
+
+    SmallTask task;
+    unsigned idleSpins = 0;
+    while (!m_stop.load())
+    {
+        if (TryPopOwn(workerIndex, task) || TrySteal(workerIndex, task))
+        {
+            --m_pendingTasks;
+            task();
+            task.Reset();
+            idleSpins = 0;
+            continue;
+        }
+
+        if (++idleSpins < IDLE_SPINS_BEFORE_PARKING)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        idleSpins = 0;
+        std::unique_lock<std::mutex> locker(m_parkLock);
+        ++m_sleepingWorkers;
+        if (m_pendingTasks.load() == 0 && !m_stop.load())
+        {
+            m_parkSignal.wait(locker);
+        }
+        --m_sleepingWorkers;
+    }
+
+    s_currentExecutor = nullptr;
+}
@@ -21,18 +21,68 @@
 #include <utility>
 #include <algorithm>
 #include <iostream>
+#include <cstring>
 
 using namespace Aws::Utils::Xml;
 using namespace Aws::Utils;
 
+struct XmlEntity
+{
+    const char* name;
+    size_t length;
+    char value;
+};
+
+static const XmlEntity XML_ENTITIES[] =
+{
+    { "&quot;", 6, '"' },
+    { "&apos;", 6, '\'' },
+    { "&lt;", 4, '<' },
+    { "&gt;", 4, '>' },
+    { "&amp;", 5, '&' }
+};
+
 Aws::String Aws::Utils::Xml::DecodeEscapedXmlText(const Aws::String& textToDecode)
 {
-    Aws::String decodedString = textToDecode;
-    StringUtils::Replace(decodedString, "&quot;", "\"");
-    StringUtils::Replace(decodedString, "&apos;", "'");
-    StringUtils::Replace(decodedString, "&lt;", "<");
-    StringUtils::Replace(decodedString, "&gt;", ">");
-    StringUtils::Replace(decodedString, "&amp;;", "&");
+    return DecodeEscapedXmlText(textToDecode.c_str(), textToDecode.size());
+}
+
+Aws::String Aws::Utils::Xml::DecodeEscapedXmlText(const char* textToDecode, size_t length)
+{
+    Aws::String decodedString;
+    decodedString.reserve(length);
+
+    const char* current = textToDecode;
+    const char* end = textToDecode + length;
+    while (current != end)
+    {
+        const char* ampersand = static_cast<const char*>(memchr(current, '&', end - current));
+        if (ampersand == nullptr)
+        {
+            decodedString.append(current, end);
+            break;
+        }
+
+        decodedString.append(current, ampersand);
+        current = ampersand;
+
+        bool matched = false;
+        for (const auto& entity : XML_ENTITIES)
+        {
+            if (static_cast<size_t>(end - current) >= entity.length && strncmp(current, entity.name, entity.length) == 0)
+            {
+                decodedString.push_back(entity.value);
+                current += entity.length;
+                matched = true;
+                break;
+            }
+        }
+
+        if (!matched)
+        {
+            decodedString.push_back(*current++);
+        }
+    }
 
     return decodedString;
 }
@@ -59,6 +109,12 @@ const Aws::String XmlNode::GetName() const
     return m_node->Value();
 }
 
+XmlStringView XmlNode::GetNameView() const
+{
+    const char* name = m_node->Value();
+    return XmlStringView(name, strlen(name));
+}
+
 void XmlNode::SetName(const Aws::String& name)
 {
     m_node->SetValue(name.c_str(), false);
@@ -69,6 +125,12 @@ const Aws::String XmlNode::GetAttributeValue(const Aws::String& name) const
     return m_node->ToElement()->Attribute(name.c_str(), nullptr);
 }
 
+XmlStringView XmlNode::GetAttributeValueView(const char* name) const
+{
+    const char* value = m_node->ToElement()->Attribute(name, nullptr);
+    return value != nullptr ? XmlStringView(value, strlen(value)) : XmlStringView();
+}
+
 void XmlNode::SetAttributeValue(const Aws::String& name, const Aws::String& value)
 {
     m_node->ToElement()->SetAttribute(name.c_str(), value.c_str());
@@ -137,6 +199,21 @@ Aws::String XmlNode::GetText() const
     return "";
 }
 
+XmlStringView XmlNode::GetTextView() const
+{
+    if (m_node != nullptr)
+    {
+        const Aws::External::tinyxml2::XMLNode* child = m_node->FirstChild();
+        if (child != nullptr && child->ToText() != nullptr && child->NextSibling() == nullptr)
+        {
+            const char* text = child->Value();
+            return XmlStringView(text, strlen(text));
+        }
+    }
+
+    return XmlStringView();
+}
+
 void XmlNode::SetText(const Aws::String& textValue)
 {
     if (m_node != nullptr)
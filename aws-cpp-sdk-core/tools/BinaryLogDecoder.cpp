@@ -0,0 +1,71 @@
+/*
+  * Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+/*
+ * Turns a file written by Aws::Utils::Logging::BinaryLogSystem back into text.
+ *
+ * usage: aws-binary-log-decoder <binary log> [text output]
+ * Without an output path the text goes to stdout.
+ */
+
+#include <aws/core/Aws.h>
+#include <aws/core/utils/logging/BinaryLogSystem.h>
+
+#include <fstream>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3)
+    {
+        std::cerr << "usage: " << argv[0] << " <binary log> [text output]" << std::endl;
+        return 2;
+    }
+
+    Aws::SDKOptions options;
+    Aws::InitAPI(options);
+
+    int result = 0;
+    {
+        Aws::IFStream input(argv[1], std::ios_base::in | std::ios_base::binary);
+        if (!input.good())
+        {
+            std::cerr << "cannot open " << argv[1] << std::endl;
+            result = 1;
+        }
+        else
+        {
+            bool decoded = false;
+            if (argc == 3)
+            {
+                Aws::OFStream output(argv[2], std::ios_base::out | std::ios_base::trunc);
+                decoded = Aws::Utils::Logging::DecodeBinaryLog(input, output);
+            }
+            else
+            {
+                decoded = Aws::Utils::Logging::DecodeBinaryLog(input, std::cout);
+            }
+
+            if (!decoded)
+            {
+                std::cerr << argv[1] << " is not a binary log or contains a damaged record" << std::endl;
+                result = 1;
+            }
+        }
+    }
+
+    Aws::ShutdownAPI(options);
+    return result;
+}
@@ -39,6 +39,9 @@
 #include <aws/datapipeline/model/ValidatePipelineDefinitionResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -243,6 +246,18 @@ namespace Model
          */
         virtual void ActivatePipelineAsync(const Model::ActivatePipelineRequest& request, const ActivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ActivatePipelineCallable(const Model::ActivatePipelineRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ActivatePipelineOutcomeCallable ActivatePipelineCallable(Model::ActivatePipelineRequest&& request) const;
+
+        /**
+         * Same as ActivatePipelineAsync(const Model::ActivatePipelineRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ActivatePipelineAsync(Model::ActivatePipelineRequest&& request, const ActivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds or modifies tags for the specified pipeline.</p>
          */
@@ -262,6 +277,18 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsCallable(const Model::AddTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsOutcomeCallable AddTagsCallable(Model::AddTagsRequest&& request) const;
+
+        /**
+         * Same as AddTagsAsync(const Model::AddTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsAsync(Model::AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new, empty pipeline. Use <a>PutPipelineDefinition</a> to populate
          * the pipeline.</p>
@@ -284,6 +311,18 @@ namespace Model
          */
         virtual void CreatePipelineAsync(const Model::CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePipelineCallable(const Model::CreatePipelineRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreatePipelineOutcomeCallable CreatePipelineCallable(Model::CreatePipelineRequest&& request) const;
+
+        /**
+         * Same as CreatePipelineAsync(const Model::CreatePipelineRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreatePipelineAsync(Model::CreatePipelineRequest&& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deactivates the specified running pipeline. The pipeline is set to the
          * <code>DEACTIVATING</code> state until the deactivation process completes.</p>
@@ -315,6 +354,18 @@ namespace Model
          */
         virtual void DeactivatePipelineAsync(const Model::DeactivatePipelineRequest& request, const DeactivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeactivatePipelineCallable(const Model::DeactivatePipelineRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeactivatePipelineOutcomeCallable DeactivatePipelineCallable(Model::DeactivatePipelineRequest&& request) const;
+
+        /**
+         * Same as DeactivatePipelineAsync(const Model::DeactivatePipelineRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeactivatePipelineAsync(Model::DeactivatePipelineRequest&& request, const DeactivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a pipeline, its pipeline definition, and its run history. AWS Data
          * Pipeline attempts to cancel instances associated with the pipeline that are
@@ -352,6 +403,18 @@ namespace Model
          */
         virtual void DeletePipelineAsync(const Model::DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePipelineCallable(const Model::DeletePipelineRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeletePipelineOutcomeCallable DeletePipelineCallable(Model::DeletePipelineRequest&& request) const;
+
+        /**
+         * Same as DeletePipelineAsync(const Model::DeletePipelineRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeletePipelineAsync(Model::DeletePipelineRequest&& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the object definitions for a set of objects associated with the
          * pipeline. Object definitions are composed of a set of fields that define the
@@ -377,6 +440,18 @@ namespace Model
          */
         virtual void DescribeObjectsAsync(const Model::DescribeObjectsRequest& request, const DescribeObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeObjectsCallable(const Model::DescribeObjectsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeObjectsOutcomeCallable DescribeObjectsCallable(Model::DescribeObjectsRequest&& request) const;
+
+        /**
+         * Same as DescribeObjectsAsync(const Model::DescribeObjectsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeObjectsAsync(Model::DescribeObjectsRequest&& request, const DescribeObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves metadata about one or more pipelines. The information retrieved
          * includes the name of the pipeline, the pipeline identifier, its current state,
@@ -417,6 +492,18 @@ namespace Model
          */
         virtual void DescribePipelinesAsync(const Model::DescribePipelinesRequest& request, const DescribePipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribePipelinesCallable(const Model::DescribePipelinesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribePipelinesOutcomeCallable DescribePipelinesCallable(Model::DescribePipelinesRequest&& request) const;
+
+        /**
+         * Same as DescribePipelinesAsync(const Model::DescribePipelinesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribePipelinesAsync(Model::DescribePipelinesRequest&& request, const DescribePipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Task runners call <code>EvaluateExpression</code> to evaluate a string in the
          * context of the specified object. For example, a task runner can evaluate SQL
@@ -442,6 +529,18 @@ namespace Model
          */
         virtual void EvaluateExpressionAsync(const Model::EvaluateExpressionRequest& request, const EvaluateExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EvaluateExpressionCallable(const Model::EvaluateExpressionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EvaluateExpressionOutcomeCallable EvaluateExpressionCallable(Model::EvaluateExpressionRequest&& request) const;
+
+        /**
+         * Same as EvaluateExpressionAsync(const Model::EvaluateExpressionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EvaluateExpressionAsync(Model::EvaluateExpressionRequest&& request, const EvaluateExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the definition of the specified pipeline. You can call
          * <code>GetPipelineDefinition</code> to retrieve the pipeline definition that you
@@ -467,6 +566,18 @@ namespace Model
          */
         virtual void GetPipelineDefinitionAsync(const Model::GetPipelineDefinitionRequest& request, const GetPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPipelineDefinitionCallable(const Model::GetPipelineDefinitionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetPipelineDefinitionOutcomeCallable GetPipelineDefinitionCallable(Model::GetPipelineDefinitionRequest&& request) const;
+
+        /**
+         * Same as GetPipelineDefinitionAsync(const Model::GetPipelineDefinitionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetPipelineDefinitionAsync(Model::GetPipelineDefinitionRequest&& request, const GetPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the pipeline identifiers for all active pipelines that you have
          * permission to access.</p>
@@ -489,6 +600,18 @@ namespace Model
          */
         virtual void ListPipelinesAsync(const Model::ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPipelinesCallable(const Model::ListPipelinesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListPipelinesOutcomeCallable ListPipelinesCallable(Model::ListPipelinesRequest&& request) const;
+
+        /**
+         * Same as ListPipelinesAsync(const Model::ListPipelinesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPipelinesAsync(Model::ListPipelinesRequest&& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Task runners call <code>PollForTask</code> to receive a task to perform from
          * AWS Data Pipeline. The task runner specifies which tasks it can perform by
@@ -544,6 +667,18 @@ namespace Model
          */
         virtual void PollForTaskAsync(const Model::PollForTaskRequest& request, const PollForTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PollForTaskCallable(const Model::PollForTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PollForTaskOutcomeCallable PollForTaskCallable(Model::PollForTaskRequest&& request) const;
+
+        /**
+         * Same as PollForTaskAsync(const Model::PollForTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PollForTaskAsync(Model::PollForTaskRequest&& request, const PollForTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds tasks, schedules, and preconditions to the specified pipeline. You can
          * use <code>PutPipelineDefinition</code> to populate a new pipeline.</p> <p>
@@ -593,6 +728,18 @@ namespace Model
          */
         virtual void PutPipelineDefinitionAsync(const Model::PutPipelineDefinitionRequest& request, const PutPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutPipelineDefinitionCallable(const Model::PutPipelineDefinitionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutPipelineDefinitionOutcomeCallable PutPipelineDefinitionCallable(Model::PutPipelineDefinitionRequest&& request) const;
+
+        /**
+         * Same as PutPipelineDefinitionAsync(const Model::PutPipelineDefinitionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutPipelineDefinitionAsync(Model::PutPipelineDefinitionRequest&& request, const PutPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Queries the specified pipeline for the names of objects that match the
          * specified set of conditions.</p>
@@ -615,6 +762,18 @@ namespace Model
          */
         virtual void QueryObjectsAsync(const Model::QueryObjectsRequest& request, const QueryObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as QueryObjectsCallable(const Model::QueryObjectsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::QueryObjectsOutcomeCallable QueryObjectsCallable(Model::QueryObjectsRequest&& request) const;
+
+        /**
+         * Same as QueryObjectsAsync(const Model::QueryObjectsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void QueryObjectsAsync(Model::QueryObjectsRequest&& request, const QueryObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes existing tags from the specified pipeline.</p>
          */
@@ -634,6 +793,18 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsCallable(const Model::RemoveTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(Model::RemoveTagsRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsAsync(const Model::RemoveTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsAsync(Model::RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Task runners call <code>ReportTaskProgress</code> when assigned a task to
          * acknowledge that it has the task. If the web service does not receive this
@@ -683,6 +854,18 @@ namespace Model
          */
         virtual void ReportTaskProgressAsync(const Model::ReportTaskProgressRequest& request, const ReportTaskProgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReportTaskProgressCallable(const Model::ReportTaskProgressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReportTaskProgressOutcomeCallable ReportTaskProgressCallable(Model::ReportTaskProgressRequest&& request) const;
+
+        /**
+         * Same as ReportTaskProgressAsync(const Model::ReportTaskProgressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReportTaskProgressAsync(Model::ReportTaskProgressRequest&& request, const ReportTaskProgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Task runners call <code>ReportTaskRunnerHeartbeat</code> every 15 minutes to
          * indicate that they are operational. If the AWS Data Pipeline Task Runner is
@@ -714,6 +897,18 @@ namespace Model
          */
         virtual void ReportTaskRunnerHeartbeatAsync(const Model::ReportTaskRunnerHeartbeatRequest& request, const ReportTaskRunnerHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReportTaskRunnerHeartbeatCallable(const Model::ReportTaskRunnerHeartbeatRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReportTaskRunnerHeartbeatOutcomeCallable ReportTaskRunnerHeartbeatCallable(Model::ReportTaskRunnerHeartbeatRequest&& request) const;
+
+        /**
+         * Same as ReportTaskRunnerHeartbeatAsync(const Model::ReportTaskRunnerHeartbeatRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReportTaskRunnerHeartbeatAsync(Model::ReportTaskRunnerHeartbeatRequest&& request, const ReportTaskRunnerHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests that the status of the specified physical or logical pipeline
          * objects be updated in the specified pipeline. This update might not occur
@@ -748,6 +943,18 @@ namespace Model
          */
         virtual void SetStatusAsync(const Model::SetStatusRequest& request, const SetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetStatusCallable(const Model::SetStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetStatusOutcomeCallable SetStatusCallable(Model::SetStatusRequest&& request) const;
+
+        /**
+         * Same as SetStatusAsync(const Model::SetStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetStatusAsync(Model::SetStatusRequest&& request, const SetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Task runners call <code>SetTaskStatus</code> to notify AWS Data Pipeline that
          * a task is completed and provide information about the final status. A task
@@ -779,6 +986,18 @@ namespace Model
          */
         virtual void SetTaskStatusAsync(const Model::SetTaskStatusRequest& request, const SetTaskStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetTaskStatusCallable(const Model::SetTaskStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetTaskStatusOutcomeCallable SetTaskStatusCallable(Model::SetTaskStatusRequest&& request) const;
+
+        /**
+         * Same as SetTaskStatusAsync(const Model::SetTaskStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetTaskStatusAsync(Model::SetTaskStatusRequest&& request, const SetTaskStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Validates the specified pipeline definition to ensure that it is well formed
          * and can be run without error.</p>
@@ -801,6 +1020,130 @@ namespace Model
          */
         virtual void ValidatePipelineDefinitionAsync(const Model::ValidatePipelineDefinitionRequest& request, const ValidatePipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ValidatePipelineDefinitionCallable(const Model::ValidatePipelineDefinitionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ValidatePipelineDefinitionOutcomeCallable ValidatePipelineDefinitionCallable(Model::ValidatePipelineDefinitionRequest&& request) const;
+
+        /**
+         * Same as ValidatePipelineDefinitionAsync(const Model::ValidatePipelineDefinitionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ValidatePipelineDefinitionAsync(Model::ValidatePipelineDefinitionRequest&& request, const ValidatePipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeObjects(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DataPipelineClient, Model::DescribeObjectsRequest, Model::DescribeObjectsOutcome> DescribeObjectsPaginator(const Model::DescribeObjectsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListPipelines(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DataPipelineClient, Model::ListPipelinesRequest, Model::ListPipelinesOutcome> ListPipelinesPaginator(const Model::ListPipelinesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through QueryObjects(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DataPipelineClient, Model::QueryObjectsRequest, Model::QueryObjectsOutcome> QueryObjectsPaginator(const Model::QueryObjectsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of ActivatePipeline(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::ActivatePipelineRequest, Model::ActivatePipelineOutcome> ActivatePipelineAwaitable(Model::ActivatePipelineRequest request) const;
+
+        /**
+         * co_await-able form of AddTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::AddTagsRequest, Model::AddTagsOutcome> AddTagsAwaitable(Model::AddTagsRequest request) const;
+
+        /**
+         * co_await-able form of CreatePipeline(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::CreatePipelineRequest, Model::CreatePipelineOutcome> CreatePipelineAwaitable(Model::CreatePipelineRequest request) const;
+
+        /**
+         * co_await-able form of DeactivatePipeline(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::DeactivatePipelineRequest, Model::DeactivatePipelineOutcome> DeactivatePipelineAwaitable(Model::DeactivatePipelineRequest request) const;
+
+        /**
+         * co_await-able form of DeletePipeline(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::DeletePipelineRequest, Model::DeletePipelineOutcome> DeletePipelineAwaitable(Model::DeletePipelineRequest request) const;
+
+        /**
+         * co_await-able form of DescribeObjects(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::DescribeObjectsRequest, Model::DescribeObjectsOutcome> DescribeObjectsAwaitable(Model::DescribeObjectsRequest request) const;
+
+        /**
+         * co_await-able form of DescribePipelines(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::DescribePipelinesRequest, Model::DescribePipelinesOutcome> DescribePipelinesAwaitable(Model::DescribePipelinesRequest request) const;
+
+        /**
+         * co_await-able form of EvaluateExpression(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::EvaluateExpressionRequest, Model::EvaluateExpressionOutcome> EvaluateExpressionAwaitable(Model::EvaluateExpressionRequest request) const;
+
+        /**
+         * co_await-able form of GetPipelineDefinition(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::GetPipelineDefinitionRequest, Model::GetPipelineDefinitionOutcome> GetPipelineDefinitionAwaitable(Model::GetPipelineDefinitionRequest request) const;
+
+        /**
+         * co_await-able form of ListPipelines(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::ListPipelinesRequest, Model::ListPipelinesOutcome> ListPipelinesAwaitable(Model::ListPipelinesRequest request) const;
+
+        /**
+         * co_await-able form of PollForTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::PollForTaskRequest, Model::PollForTaskOutcome> PollForTaskAwaitable(Model::PollForTaskRequest request) const;
+
+        /**
+         * co_await-able form of PutPipelineDefinition(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::PutPipelineDefinitionRequest, Model::PutPipelineDefinitionOutcome> PutPipelineDefinitionAwaitable(Model::PutPipelineDefinitionRequest request) const;
+
+        /**
+         * co_await-able form of QueryObjects(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::QueryObjectsRequest, Model::QueryObjectsOutcome> QueryObjectsAwaitable(Model::QueryObjectsRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::RemoveTagsRequest, Model::RemoveTagsOutcome> RemoveTagsAwaitable(Model::RemoveTagsRequest request) const;
+
+        /**
+         * co_await-able form of ReportTaskProgress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::ReportTaskProgressRequest, Model::ReportTaskProgressOutcome> ReportTaskProgressAwaitable(Model::ReportTaskProgressRequest request) const;
+
+        /**
+         * co_await-able form of ReportTaskRunnerHeartbeat(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::ReportTaskRunnerHeartbeatRequest, Model::ReportTaskRunnerHeartbeatOutcome> ReportTaskRunnerHeartbeatAwaitable(Model::ReportTaskRunnerHeartbeatRequest request) const;
+
+        /**
+         * co_await-able form of SetStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::SetStatusRequest, Model::SetStatusOutcome> SetStatusAwaitable(Model::SetStatusRequest request) const;
+
+        /**
+         * co_await-able form of SetTaskStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::SetTaskStatusRequest, Model::SetTaskStatusOutcome> SetTaskStatusAwaitable(Model::SetTaskStatusRequest request) const;
+
+        /**
+         * co_await-able form of ValidatePipelineDefinition(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DataPipelineClient, Model::ValidatePipelineDefinitionRequest, Model::ValidatePipelineDefinitionOutcome> ValidatePipelineDefinitionAwaitable(Model::ValidatePipelineDefinitionRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     ActivatePipelineRequest();
+    inline const char* GetServiceRequestName() const override { return "ActivatePipeline"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeactivatePipelineRequest();
+    inline const char* GetServiceRequestName() const override { return "DeactivatePipeline"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeObjectsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeObjects"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribePipelinesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribePipelines"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
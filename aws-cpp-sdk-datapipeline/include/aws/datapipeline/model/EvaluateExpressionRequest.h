@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     EvaluateExpressionRequest();
+    inline const char* GetServiceRequestName() const override { return "EvaluateExpression"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
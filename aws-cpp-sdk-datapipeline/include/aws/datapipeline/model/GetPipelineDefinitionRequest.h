@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetPipelineDefinitionRequest();
+    inline const char* GetServiceRequestName() const override { return "GetPipelineDefinition"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
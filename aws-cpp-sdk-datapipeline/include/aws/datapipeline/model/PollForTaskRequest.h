@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PollForTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "PollForTask"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     PutPipelineDefinitionRequest();
+    inline const char* GetServiceRequestName() const override { return "PutPipelineDefinition"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     QueryObjectsRequest();
+    inline const char* GetServiceRequestName() const override { return "QueryObjects"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RemoveTagsRequest();
+    inline const char* GetServiceRequestName() const override { return "RemoveTags"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
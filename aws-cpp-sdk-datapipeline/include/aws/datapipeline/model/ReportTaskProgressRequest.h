@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ReportTaskProgressRequest();
+    inline const char* GetServiceRequestName() const override { return "ReportTaskProgress"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
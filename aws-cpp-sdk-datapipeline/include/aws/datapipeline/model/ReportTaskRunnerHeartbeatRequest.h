@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ReportTaskRunnerHeartbeatRequest();
+    inline const char* GetServiceRequestName() const override { return "ReportTaskRunnerHeartbeat"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "SetStatus"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetTaskStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "SetTaskStatus"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ValidatePipelineDefinitionRequest();
+    inline const char* GetServiceRequestName() const override { return "ValidatePipelineDefinition"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
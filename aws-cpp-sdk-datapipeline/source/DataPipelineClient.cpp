@@ -128,7 +128,7 @@ ActivatePipelineOutcome DataPipelineClient::ActivatePipeline(const ActivatePipel
 
 ActivatePipelineOutcomeCallable DataPipelineClient::ActivatePipelineCallable(const ActivatePipelineRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ActivatePipeline(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ActivatePipeline(request); } );
 }
 
 void DataPipelineClient::ActivatePipelineAsync(const ActivatePipelineRequest& request, const ActivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -136,6 +136,16 @@ void DataPipelineClient::ActivatePipelineAsync(const ActivatePipelineRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->ActivatePipelineAsyncHelper( request, handler, context ); } );
 }
 
+ActivatePipelineOutcomeCallable DataPipelineClient::ActivatePipelineCallable(ActivatePipelineRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::ActivatePipeline, this, std::move(request)));
+}
+
+void DataPipelineClient::ActivatePipelineAsync(ActivatePipelineRequest&& request, const ActivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::ActivatePipelineAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::ActivatePipelineAsyncHelper(const ActivatePipelineRequest& request, const ActivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ActivatePipeline(request), context);
@@ -159,7 +169,7 @@ AddTagsOutcome DataPipelineClient::AddTags(const AddTagsRequest& request) const
 
 AddTagsOutcomeCallable DataPipelineClient::AddTagsCallable(const AddTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTags(request); } );
 }
 
 void DataPipelineClient::AddTagsAsync(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -167,6 +177,16 @@ void DataPipelineClient::AddTagsAsync(const AddTagsRequest& request, const AddTa
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsOutcomeCallable DataPipelineClient::AddTagsCallable(AddTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::AddTags, this, std::move(request)));
+}
+
+void DataPipelineClient::AddTagsAsync(AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::AddTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::AddTagsAsyncHelper(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTags(request), context);
@@ -190,7 +210,7 @@ CreatePipelineOutcome DataPipelineClient::CreatePipeline(const CreatePipelineReq
 
 CreatePipelineOutcomeCallable DataPipelineClient::CreatePipelineCallable(const CreatePipelineRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreatePipeline(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreatePipeline(request); } );
 }
 
 void DataPipelineClient::CreatePipelineAsync(const CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -198,6 +218,16 @@ void DataPipelineClient::CreatePipelineAsync(const CreatePipelineRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->CreatePipelineAsyncHelper( request, handler, context ); } );
 }
 
+CreatePipelineOutcomeCallable DataPipelineClient::CreatePipelineCallable(CreatePipelineRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::CreatePipeline, this, std::move(request)));
+}
+
+void DataPipelineClient::CreatePipelineAsync(CreatePipelineRequest&& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::CreatePipelineAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::CreatePipelineAsyncHelper(const CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreatePipeline(request), context);
@@ -221,7 +251,7 @@ DeactivatePipelineOutcome DataPipelineClient::DeactivatePipeline(const Deactivat
 
 DeactivatePipelineOutcomeCallable DataPipelineClient::DeactivatePipelineCallable(const DeactivatePipelineRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeactivatePipeline(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeactivatePipeline(request); } );
 }
 
 void DataPipelineClient::DeactivatePipelineAsync(const DeactivatePipelineRequest& request, const DeactivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -229,6 +259,16 @@ void DataPipelineClient::DeactivatePipelineAsync(const DeactivatePipelineRequest
   m_executor->Submit( [this, request, handler, context](){ this->DeactivatePipelineAsyncHelper( request, handler, context ); } );
 }
 
+DeactivatePipelineOutcomeCallable DataPipelineClient::DeactivatePipelineCallable(DeactivatePipelineRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::DeactivatePipeline, this, std::move(request)));
+}
+
+void DataPipelineClient::DeactivatePipelineAsync(DeactivatePipelineRequest&& request, const DeactivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::DeactivatePipelineAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::DeactivatePipelineAsyncHelper(const DeactivatePipelineRequest& request, const DeactivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeactivatePipeline(request), context);
@@ -252,7 +292,7 @@ DeletePipelineOutcome DataPipelineClient::DeletePipeline(const DeletePipelineReq
 
 DeletePipelineOutcomeCallable DataPipelineClient::DeletePipelineCallable(const DeletePipelineRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeletePipeline(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeletePipeline(request); } );
 }
 
 void DataPipelineClient::DeletePipelineAsync(const DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -260,6 +300,16 @@ void DataPipelineClient::DeletePipelineAsync(const DeletePipelineRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->DeletePipelineAsyncHelper( request, handler, context ); } );
 }
 
+DeletePipelineOutcomeCallable DataPipelineClient::DeletePipelineCallable(DeletePipelineRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::DeletePipeline, this, std::move(request)));
+}
+
+void DataPipelineClient::DeletePipelineAsync(DeletePipelineRequest&& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::DeletePipelineAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::DeletePipelineAsyncHelper(const DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeletePipeline(request), context);
@@ -283,7 +333,7 @@ DescribeObjectsOutcome DataPipelineClient::DescribeObjects(const DescribeObjects
 
 DescribeObjectsOutcomeCallable DataPipelineClient::DescribeObjectsCallable(const DescribeObjectsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeObjects(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeObjects(request); } );
 }
 
 void DataPipelineClient::DescribeObjectsAsync(const DescribeObjectsRequest& request, const DescribeObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -291,6 +341,16 @@ void DataPipelineClient::DescribeObjectsAsync(const DescribeObjectsRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeObjectsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeObjectsOutcomeCallable DataPipelineClient::DescribeObjectsCallable(DescribeObjectsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::DescribeObjects, this, std::move(request)));
+}
+
+void DataPipelineClient::DescribeObjectsAsync(DescribeObjectsRequest&& request, const DescribeObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::DescribeObjectsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::DescribeObjectsAsyncHelper(const DescribeObjectsRequest& request, const DescribeObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeObjects(request), context);
@@ -314,7 +374,7 @@ DescribePipelinesOutcome DataPipelineClient::DescribePipelines(const DescribePip
 
 DescribePipelinesOutcomeCallable DataPipelineClient::DescribePipelinesCallable(const DescribePipelinesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribePipelines(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribePipelines(request); } );
 }
 
 void DataPipelineClient::DescribePipelinesAsync(const DescribePipelinesRequest& request, const DescribePipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -322,6 +382,16 @@ void DataPipelineClient::DescribePipelinesAsync(const DescribePipelinesRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribePipelinesAsyncHelper( request, handler, context ); } );
 }
 
+DescribePipelinesOutcomeCallable DataPipelineClient::DescribePipelinesCallable(DescribePipelinesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::DescribePipelines, this, std::move(request)));
+}
+
+void DataPipelineClient::DescribePipelinesAsync(DescribePipelinesRequest&& request, const DescribePipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::DescribePipelinesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::DescribePipelinesAsyncHelper(const DescribePipelinesRequest& request, const DescribePipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribePipelines(request), context);
@@ -345,7 +415,7 @@ EvaluateExpressionOutcome DataPipelineClient::EvaluateExpression(const EvaluateE
 
 EvaluateExpressionOutcomeCallable DataPipelineClient::EvaluateExpressionCallable(const EvaluateExpressionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EvaluateExpression(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EvaluateExpression(request); } );
 }
 
 void DataPipelineClient::EvaluateExpressionAsync(const EvaluateExpressionRequest& request, const EvaluateExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -353,6 +423,16 @@ void DataPipelineClient::EvaluateExpressionAsync(const EvaluateExpressionRequest
   m_executor->Submit( [this, request, handler, context](){ this->EvaluateExpressionAsyncHelper( request, handler, context ); } );
 }
 
+EvaluateExpressionOutcomeCallable DataPipelineClient::EvaluateExpressionCallable(EvaluateExpressionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::EvaluateExpression, this, std::move(request)));
+}
+
+void DataPipelineClient::EvaluateExpressionAsync(EvaluateExpressionRequest&& request, const EvaluateExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::EvaluateExpressionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::EvaluateExpressionAsyncHelper(const EvaluateExpressionRequest& request, const EvaluateExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EvaluateExpression(request), context);
@@ -376,7 +456,7 @@ GetPipelineDefinitionOutcome DataPipelineClient::GetPipelineDefinition(const Get
 
 GetPipelineDefinitionOutcomeCallable DataPipelineClient::GetPipelineDefinitionCallable(const GetPipelineDefinitionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetPipelineDefinition(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetPipelineDefinition(request); } );
 }
 
 void DataPipelineClient::GetPipelineDefinitionAsync(const GetPipelineDefinitionRequest& request, const GetPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -384,6 +464,16 @@ void DataPipelineClient::GetPipelineDefinitionAsync(const GetPipelineDefinitionR
   m_executor->Submit( [this, request, handler, context](){ this->GetPipelineDefinitionAsyncHelper( request, handler, context ); } );
 }
 
+GetPipelineDefinitionOutcomeCallable DataPipelineClient::GetPipelineDefinitionCallable(GetPipelineDefinitionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::GetPipelineDefinition, this, std::move(request)));
+}
+
+void DataPipelineClient::GetPipelineDefinitionAsync(GetPipelineDefinitionRequest&& request, const GetPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::GetPipelineDefinitionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::GetPipelineDefinitionAsyncHelper(const GetPipelineDefinitionRequest& request, const GetPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetPipelineDefinition(request), context);
@@ -407,7 +497,7 @@ ListPipelinesOutcome DataPipelineClient::ListPipelines(const ListPipelinesReques
 
 ListPipelinesOutcomeCallable DataPipelineClient::ListPipelinesCallable(const ListPipelinesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListPipelines(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListPipelines(request); } );
 }
 
 void DataPipelineClient::ListPipelinesAsync(const ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -415,6 +505,16 @@ void DataPipelineClient::ListPipelinesAsync(const ListPipelinesRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ListPipelinesAsyncHelper( request, handler, context ); } );
 }
 
+ListPipelinesOutcomeCallable DataPipelineClient::ListPipelinesCallable(ListPipelinesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::ListPipelines, this, std::move(request)));
+}
+
+void DataPipelineClient::ListPipelinesAsync(ListPipelinesRequest&& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::ListPipelinesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::ListPipelinesAsyncHelper(const ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListPipelines(request), context);
@@ -438,7 +538,7 @@ PollForTaskOutcome DataPipelineClient::PollForTask(const PollForTaskRequest& req
 
 PollForTaskOutcomeCallable DataPipelineClient::PollForTaskCallable(const PollForTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PollForTask(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PollForTask(request); } );
 }
 
 void DataPipelineClient::PollForTaskAsync(const PollForTaskRequest& request, const PollForTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -446,6 +546,16 @@ void DataPipelineClient::PollForTaskAsync(const PollForTaskRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->PollForTaskAsyncHelper( request, handler, context ); } );
 }
 
+PollForTaskOutcomeCallable DataPipelineClient::PollForTaskCallable(PollForTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::PollForTask, this, std::move(request)));
+}
+
+void DataPipelineClient::PollForTaskAsync(PollForTaskRequest&& request, const PollForTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::PollForTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::PollForTaskAsyncHelper(const PollForTaskRequest& request, const PollForTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PollForTask(request), context);
@@ -469,7 +579,7 @@ PutPipelineDefinitionOutcome DataPipelineClient::PutPipelineDefinition(const Put
 
 PutPipelineDefinitionOutcomeCallable DataPipelineClient::PutPipelineDefinitionCallable(const PutPipelineDefinitionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutPipelineDefinition(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutPipelineDefinition(request); } );
 }
 
 void DataPipelineClient::PutPipelineDefinitionAsync(const PutPipelineDefinitionRequest& request, const PutPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -477,6 +587,16 @@ void DataPipelineClient::PutPipelineDefinitionAsync(const PutPipelineDefinitionR
   m_executor->Submit( [this, request, handler, context](){ this->PutPipelineDefinitionAsyncHelper( request, handler, context ); } );
 }
 
+PutPipelineDefinitionOutcomeCallable DataPipelineClient::PutPipelineDefinitionCallable(PutPipelineDefinitionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::PutPipelineDefinition, this, std::move(request)));
+}
+
+void DataPipelineClient::PutPipelineDefinitionAsync(PutPipelineDefinitionRequest&& request, const PutPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::PutPipelineDefinitionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::PutPipelineDefinitionAsyncHelper(const PutPipelineDefinitionRequest& request, const PutPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutPipelineDefinition(request), context);
@@ -500,7 +620,7 @@ QueryObjectsOutcome DataPipelineClient::QueryObjects(const QueryObjectsRequest&
 
 QueryObjectsOutcomeCallable DataPipelineClient::QueryObjectsCallable(const QueryObjectsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->QueryObjects(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->QueryObjects(request); } );
 }
 
 void DataPipelineClient::QueryObjectsAsync(const QueryObjectsRequest& request, const QueryObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -508,6 +628,16 @@ void DataPipelineClient::QueryObjectsAsync(const QueryObjectsRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->QueryObjectsAsyncHelper( request, handler, context ); } );
 }
 
+QueryObjectsOutcomeCallable DataPipelineClient::QueryObjectsCallable(QueryObjectsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::QueryObjects, this, std::move(request)));
+}
+
+void DataPipelineClient::QueryObjectsAsync(QueryObjectsRequest&& request, const QueryObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::QueryObjectsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::QueryObjectsAsyncHelper(const QueryObjectsRequest& request, const QueryObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, QueryObjects(request), context);
@@ -531,7 +661,7 @@ RemoveTagsOutcome DataPipelineClient::RemoveTags(const RemoveTagsRequest& reques
 
 RemoveTagsOutcomeCallable DataPipelineClient::RemoveTagsCallable(const RemoveTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTags(request); } );
 }
 
 void DataPipelineClient::RemoveTagsAsync(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -539,6 +669,16 @@ void DataPipelineClient::RemoveTagsAsync(const RemoveTagsRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsOutcomeCallable DataPipelineClient::RemoveTagsCallable(RemoveTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::RemoveTags, this, std::move(request)));
+}
+
+void DataPipelineClient::RemoveTagsAsync(RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::RemoveTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::RemoveTagsAsyncHelper(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTags(request), context);
@@ -562,7 +702,7 @@ ReportTaskProgressOutcome DataPipelineClient::ReportTaskProgress(const ReportTas
 
 ReportTaskProgressOutcomeCallable DataPipelineClient::ReportTaskProgressCallable(const ReportTaskProgressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReportTaskProgress(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ReportTaskProgress(request); } );
 }
 
 void DataPipelineClient::ReportTaskProgressAsync(const ReportTaskProgressRequest& request, const ReportTaskProgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -570,6 +710,16 @@ void DataPipelineClient::ReportTaskProgressAsync(const ReportTaskProgressRequest
   m_executor->Submit( [this, request, handler, context](){ this->ReportTaskProgressAsyncHelper( request, handler, context ); } );
 }
 
+ReportTaskProgressOutcomeCallable DataPipelineClient::ReportTaskProgressCallable(ReportTaskProgressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::ReportTaskProgress, this, std::move(request)));
+}
+
+void DataPipelineClient::ReportTaskProgressAsync(ReportTaskProgressRequest&& request, const ReportTaskProgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::ReportTaskProgressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::ReportTaskProgressAsyncHelper(const ReportTaskProgressRequest& request, const ReportTaskProgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReportTaskProgress(request), context);
@@ -593,7 +743,7 @@ ReportTaskRunnerHeartbeatOutcome DataPipelineClient::ReportTaskRunnerHeartbeat(c
 
 ReportTaskRunnerHeartbeatOutcomeCallable DataPipelineClient::ReportTaskRunnerHeartbeatCallable(const ReportTaskRunnerHeartbeatRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReportTaskRunnerHeartbeat(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ReportTaskRunnerHeartbeat(request); } );
 }
 
 void DataPipelineClient::ReportTaskRunnerHeartbeatAsync(const ReportTaskRunnerHeartbeatRequest& request, const ReportTaskRunnerHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -601,6 +751,16 @@ void DataPipelineClient::ReportTaskRunnerHeartbeatAsync(const ReportTaskRunnerHe
   m_executor->Submit( [this, request, handler, context](){ this->ReportTaskRunnerHeartbeatAsyncHelper( request, handler, context ); } );
 }
 
+ReportTaskRunnerHeartbeatOutcomeCallable DataPipelineClient::ReportTaskRunnerHeartbeatCallable(ReportTaskRunnerHeartbeatRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::ReportTaskRunnerHeartbeat, this, std::move(request)));
+}
+
+void DataPipelineClient::ReportTaskRunnerHeartbeatAsync(ReportTaskRunnerHeartbeatRequest&& request, const ReportTaskRunnerHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::ReportTaskRunnerHeartbeatAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::ReportTaskRunnerHeartbeatAsyncHelper(const ReportTaskRunnerHeartbeatRequest& request, const ReportTaskRunnerHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReportTaskRunnerHeartbeat(request), context);
@@ -624,7 +784,7 @@ SetStatusOutcome DataPipelineClient::SetStatus(const SetStatusRequest& request)
 
 SetStatusOutcomeCallable DataPipelineClient::SetStatusCallable(const SetStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetStatus(request); } );
 }
 
 void DataPipelineClient::SetStatusAsync(const SetStatusRequest& request, const SetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -632,6 +792,16 @@ void DataPipelineClient::SetStatusAsync(const SetStatusRequest& request, const S
   m_executor->Submit( [this, request, handler, context](){ this->SetStatusAsyncHelper( request, handler, context ); } );
 }
 
+SetStatusOutcomeCallable DataPipelineClient::SetStatusCallable(SetStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::SetStatus, this, std::move(request)));
+}
+
+void DataPipelineClient::SetStatusAsync(SetStatusRequest&& request, const SetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::SetStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::SetStatusAsyncHelper(const SetStatusRequest& request, const SetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetStatus(request), context);
@@ -655,7 +825,7 @@ SetTaskStatusOutcome DataPipelineClient::SetTaskStatus(const SetTaskStatusReques
 
 SetTaskStatusOutcomeCallable DataPipelineClient::SetTaskStatusCallable(const SetTaskStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetTaskStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetTaskStatus(request); } );
 }
 
 void DataPipelineClient::SetTaskStatusAsync(const SetTaskStatusRequest& request, const SetTaskStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -663,6 +833,16 @@ void DataPipelineClient::SetTaskStatusAsync(const SetTaskStatusRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->SetTaskStatusAsyncHelper( request, handler, context ); } );
 }
 
+SetTaskStatusOutcomeCallable DataPipelineClient::SetTaskStatusCallable(SetTaskStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::SetTaskStatus, this, std::move(request)));
+}
+
+void DataPipelineClient::SetTaskStatusAsync(SetTaskStatusRequest&& request, const SetTaskStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::SetTaskStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::SetTaskStatusAsyncHelper(const SetTaskStatusRequest& request, const SetTaskStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetTaskStatus(request), context);
@@ -686,7 +866,7 @@ ValidatePipelineDefinitionOutcome DataPipelineClient::ValidatePipelineDefinition
 
 ValidatePipelineDefinitionOutcomeCallable DataPipelineClient::ValidatePipelineDefinitionCallable(const ValidatePipelineDefinitionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ValidatePipelineDefinition(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ValidatePipelineDefinition(request); } );
 }
 
 void DataPipelineClient::ValidatePipelineDefinitionAsync(const ValidatePipelineDefinitionRequest& request, const ValidatePipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -694,8 +874,166 @@ void DataPipelineClient::ValidatePipelineDefinitionAsync(const ValidatePipelineD
   m_executor->Submit( [this, request, handler, context](){ this->ValidatePipelineDefinitionAsyncHelper( request, handler, context ); } );
 }
 
+ValidatePipelineDefinitionOutcomeCallable DataPipelineClient::ValidatePipelineDefinitionCallable(ValidatePipelineDefinitionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DataPipelineClient::ValidatePipelineDefinition, this, std::move(request)));
+}
+
+void DataPipelineClient::ValidatePipelineDefinitionAsync(ValidatePipelineDefinitionRequest&& request, const ValidatePipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DataPipelineClient::ValidatePipelineDefinitionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DataPipelineClient::ValidatePipelineDefinitionAsyncHelper(const ValidatePipelineDefinitionRequest& request, const ValidatePipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ValidatePipelineDefinition(request), context);
 }
 
+Paginator<DataPipelineClient, DescribeObjectsRequest, DescribeObjectsOutcome> DataPipelineClient::DescribeObjectsPaginator(const DescribeObjectsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DataPipelineClient, DescribeObjectsRequest, DescribeObjectsOutcome>(this, &DataPipelineClient::DescribeObjects, request,
+    [](const DescribeObjectsRequest& current, const DescribeObjectsOutcome& outcome, DescribeObjectsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DataPipelineClient, ListPipelinesRequest, ListPipelinesOutcome> DataPipelineClient::ListPipelinesPaginator(const ListPipelinesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DataPipelineClient, ListPipelinesRequest, ListPipelinesOutcome>(this, &DataPipelineClient::ListPipelines, request,
+    [](const ListPipelinesRequest& current, const ListPipelinesOutcome& outcome, ListPipelinesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DataPipelineClient, QueryObjectsRequest, QueryObjectsOutcome> DataPipelineClient::QueryObjectsPaginator(const QueryObjectsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DataPipelineClient, QueryObjectsRequest, QueryObjectsOutcome>(this, &DataPipelineClient::QueryObjects, request,
+    [](const QueryObjectsRequest& current, const QueryObjectsOutcome& outcome, QueryObjectsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<DataPipelineClient, ActivatePipelineRequest, ActivatePipelineOutcome> DataPipelineClient::ActivatePipelineAwaitable(ActivatePipelineRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::ActivatePipeline, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, AddTagsRequest, AddTagsOutcome> DataPipelineClient::AddTagsAwaitable(AddTagsRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::AddTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, CreatePipelineRequest, CreatePipelineOutcome> DataPipelineClient::CreatePipelineAwaitable(CreatePipelineRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::CreatePipeline, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, DeactivatePipelineRequest, DeactivatePipelineOutcome> DataPipelineClient::DeactivatePipelineAwaitable(DeactivatePipelineRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::DeactivatePipeline, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, DeletePipelineRequest, DeletePipelineOutcome> DataPipelineClient::DeletePipelineAwaitable(DeletePipelineRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::DeletePipeline, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, DescribeObjectsRequest, DescribeObjectsOutcome> DataPipelineClient::DescribeObjectsAwaitable(DescribeObjectsRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::DescribeObjects, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, DescribePipelinesRequest, DescribePipelinesOutcome> DataPipelineClient::DescribePipelinesAwaitable(DescribePipelinesRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::DescribePipelines, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, EvaluateExpressionRequest, EvaluateExpressionOutcome> DataPipelineClient::EvaluateExpressionAwaitable(EvaluateExpressionRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::EvaluateExpression, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, GetPipelineDefinitionRequest, GetPipelineDefinitionOutcome> DataPipelineClient::GetPipelineDefinitionAwaitable(GetPipelineDefinitionRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::GetPipelineDefinition, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, ListPipelinesRequest, ListPipelinesOutcome> DataPipelineClient::ListPipelinesAwaitable(ListPipelinesRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::ListPipelines, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, PollForTaskRequest, PollForTaskOutcome> DataPipelineClient::PollForTaskAwaitable(PollForTaskRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::PollForTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, PutPipelineDefinitionRequest, PutPipelineDefinitionOutcome> DataPipelineClient::PutPipelineDefinitionAwaitable(PutPipelineDefinitionRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::PutPipelineDefinition, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, QueryObjectsRequest, QueryObjectsOutcome> DataPipelineClient::QueryObjectsAwaitable(QueryObjectsRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::QueryObjects, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, RemoveTagsRequest, RemoveTagsOutcome> DataPipelineClient::RemoveTagsAwaitable(RemoveTagsRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::RemoveTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, ReportTaskProgressRequest, ReportTaskProgressOutcome> DataPipelineClient::ReportTaskProgressAwaitable(ReportTaskProgressRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::ReportTaskProgress, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, ReportTaskRunnerHeartbeatRequest, ReportTaskRunnerHeartbeatOutcome> DataPipelineClient::ReportTaskRunnerHeartbeatAwaitable(ReportTaskRunnerHeartbeatRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::ReportTaskRunnerHeartbeat, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, SetStatusRequest, SetStatusOutcome> DataPipelineClient::SetStatusAwaitable(SetStatusRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::SetStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, SetTaskStatusRequest, SetTaskStatusOutcome> DataPipelineClient::SetTaskStatusAwaitable(SetTaskStatusRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::SetTaskStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<DataPipelineClient, ValidatePipelineDefinitionRequest, ValidatePipelineDefinitionOutcome> DataPipelineClient::ValidatePipelineDefinitionAwaitable(ValidatePipelineDefinitionRequest request) const
+{
+  return { m_executor.get(), { this, &DataPipelineClient::ValidatePipelineDefinition, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,36 +29,38 @@ namespace Aws
       namespace OperatorTypeMapper
       {
 
-        static const int EQ_HASH = HashingUtils::HashString("EQ");
-        static const int REF_EQ_HASH = HashingUtils::HashString("REF_EQ");
-        static const int LE_HASH = HashingUtils::HashString("LE");
-        static const int GE_HASH = HashingUtils::HashString("GE");
-        static const int BETWEEN_HASH = HashingUtils::HashString("BETWEEN");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int EQ_HASH = 2220;
+        static const int REF_EQ_HASH = -1881475080;
+        static const int LE_HASH = 2425;
+        static const int GE_HASH = 2270;
+        static const int BETWEEN_HASH = 501348328;
 
 
         OperatorType GetOperatorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQ_HASH)
+          switch (hashCode)
           {
+          case EQ_HASH:
             return OperatorType::EQ;
-          }
-          else if (hashCode == REF_EQ_HASH)
-          {
+          case REF_EQ_HASH:
             return OperatorType::REF_EQ;
-          }
-          else if (hashCode == LE_HASH)
-          {
+          case LE_HASH:
             return OperatorType::LE;
-          }
-          else if (hashCode == GE_HASH)
-          {
+          case GE_HASH:
             return OperatorType::GE;
-          }
-          else if (hashCode == BETWEEN_HASH)
-          {
+          case BETWEEN_HASH:
             return OperatorType::BETWEEN;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
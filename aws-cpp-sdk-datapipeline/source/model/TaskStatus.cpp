@@ -29,26 +29,32 @@ namespace Aws
       namespace TaskStatusMapper
       {
 
-        static const int FINISHED_HASH = HashingUtils::HashString("FINISHED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int FALSE_HASH = HashingUtils::HashString("FALSE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int FINISHED_HASH = 108966002;
+        static const int FAILED_HASH = 2066319421;
+        static const int FALSE_HASH = 66658563;
 
 
         TaskStatus GetTaskStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FINISHED_HASH)
+          switch (hashCode)
           {
+          case FINISHED_HASH:
             return TaskStatus::FINISHED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return TaskStatus::FAILED;
-          }
-          else if (hashCode == FALSE_HASH)
-          {
+          case FALSE_HASH:
             return TaskStatus::FALSE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -64,6 +64,9 @@
 #include <aws/devicefarm/model/UpdateDevicePoolResult.h>
 #include <aws/devicefarm/model/UpdateProjectResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -337,6 +340,18 @@ namespace Model
          */
         virtual void CreateDevicePoolAsync(const Model::CreateDevicePoolRequest& request, const CreateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDevicePoolCallable(const Model::CreateDevicePoolRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDevicePoolOutcomeCallable CreateDevicePoolCallable(Model::CreateDevicePoolRequest&& request) const;
+
+        /**
+         * Same as CreateDevicePoolAsync(const Model::CreateDevicePoolRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDevicePoolAsync(Model::CreateDevicePoolRequest&& request, const CreateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new project.</p>
          */
@@ -356,6 +371,18 @@ namespace Model
          */
         virtual void CreateProjectAsync(const Model::CreateProjectRequest& request, const CreateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateProjectCallable(const Model::CreateProjectRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateProjectOutcomeCallable CreateProjectCallable(Model::CreateProjectRequest&& request) const;
+
+        /**
+         * Same as CreateProjectAsync(const Model::CreateProjectRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateProjectAsync(Model::CreateProjectRequest&& request, const CreateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Specifies and starts a remote access session.</p>
          */
@@ -375,6 +402,18 @@ namespace Model
          */
         virtual void CreateRemoteAccessSessionAsync(const Model::CreateRemoteAccessSessionRequest& request, const CreateRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRemoteAccessSessionCallable(const Model::CreateRemoteAccessSessionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateRemoteAccessSessionOutcomeCallable CreateRemoteAccessSessionCallable(Model::CreateRemoteAccessSessionRequest&& request) const;
+
+        /**
+         * Same as CreateRemoteAccessSessionAsync(const Model::CreateRemoteAccessSessionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateRemoteAccessSessionAsync(Model::CreateRemoteAccessSessionRequest&& request, const CreateRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Uploads an app or test scripts.</p>
          */
@@ -394,6 +433,18 @@ namespace Model
          */
         virtual void CreateUploadAsync(const Model::CreateUploadRequest& request, const CreateUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateUploadCallable(const Model::CreateUploadRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateUploadOutcomeCallable CreateUploadCallable(Model::CreateUploadRequest&& request) const;
+
+        /**
+         * Same as CreateUploadAsync(const Model::CreateUploadRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateUploadAsync(Model::CreateUploadRequest&& request, const CreateUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a device pool given the pool ARN. Does not allow deletion of curated
          * pools owned by the system.</p>
@@ -416,6 +467,18 @@ namespace Model
          */
         virtual void DeleteDevicePoolAsync(const Model::DeleteDevicePoolRequest& request, const DeleteDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDevicePoolCallable(const Model::DeleteDevicePoolRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDevicePoolOutcomeCallable DeleteDevicePoolCallable(Model::DeleteDevicePoolRequest&& request) const;
+
+        /**
+         * Same as DeleteDevicePoolAsync(const Model::DeleteDevicePoolRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDevicePoolAsync(Model::DeleteDevicePoolRequest&& request, const DeleteDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an AWS Device Farm project, given the project ARN.</p> <p><b>Note</b>
          * Deleting this resource does not stop an in-progress run.</p>
@@ -438,6 +501,18 @@ namespace Model
          */
         virtual void DeleteProjectAsync(const Model::DeleteProjectRequest& request, const DeleteProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteProjectCallable(const Model::DeleteProjectRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteProjectOutcomeCallable DeleteProjectCallable(Model::DeleteProjectRequest&& request) const;
+
+        /**
+         * Same as DeleteProjectAsync(const Model::DeleteProjectRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteProjectAsync(Model::DeleteProjectRequest&& request, const DeleteProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a completed remote access session and its results.</p>
          */
@@ -457,6 +532,18 @@ namespace Model
          */
         virtual void DeleteRemoteAccessSessionAsync(const Model::DeleteRemoteAccessSessionRequest& request, const DeleteRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRemoteAccessSessionCallable(const Model::DeleteRemoteAccessSessionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRemoteAccessSessionOutcomeCallable DeleteRemoteAccessSessionCallable(Model::DeleteRemoteAccessSessionRequest&& request) const;
+
+        /**
+         * Same as DeleteRemoteAccessSessionAsync(const Model::DeleteRemoteAccessSessionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRemoteAccessSessionAsync(Model::DeleteRemoteAccessSessionRequest&& request, const DeleteRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the run, given the run ARN.</p> <p><b>Note</b> Deleting this resource
          * does not stop an in-progress run.</p>
@@ -479,6 +566,18 @@ namespace Model
          */
         virtual void DeleteRunAsync(const Model::DeleteRunRequest& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRunCallable(const Model::DeleteRunRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRunOutcomeCallable DeleteRunCallable(Model::DeleteRunRequest&& request) const;
+
+        /**
+         * Same as DeleteRunAsync(const Model::DeleteRunRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRunAsync(Model::DeleteRunRequest&& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an upload given the upload ARN.</p>
          */
@@ -498,6 +597,18 @@ namespace Model
          */
         virtual void DeleteUploadAsync(const Model::DeleteUploadRequest& request, const DeleteUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteUploadCallable(const Model::DeleteUploadRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteUploadOutcomeCallable DeleteUploadCallable(Model::DeleteUploadRequest&& request) const;
+
+        /**
+         * Same as DeleteUploadAsync(const Model::DeleteUploadRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteUploadAsync(Model::DeleteUploadRequest&& request, const DeleteUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the number of unmetered iOS and/or unmetered Android devices that
          * have been purchased by the account.</p>
@@ -520,6 +631,18 @@ namespace Model
          */
         virtual void GetAccountSettingsAsync(const Model::GetAccountSettingsRequest& request, const GetAccountSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAccountSettingsCallable(const Model::GetAccountSettingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetAccountSettingsOutcomeCallable GetAccountSettingsCallable(Model::GetAccountSettingsRequest&& request) const;
+
+        /**
+         * Same as GetAccountSettingsAsync(const Model::GetAccountSettingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetAccountSettingsAsync(Model::GetAccountSettingsRequest&& request, const GetAccountSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a unique device type.</p>
          */
@@ -539,6 +662,18 @@ namespace Model
          */
         virtual void GetDeviceAsync(const Model::GetDeviceRequest& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDeviceCallable(const Model::GetDeviceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDeviceOutcomeCallable GetDeviceCallable(Model::GetDeviceRequest&& request) const;
+
+        /**
+         * Same as GetDeviceAsync(const Model::GetDeviceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDeviceAsync(Model::GetDeviceRequest&& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a device pool.</p>
          */
@@ -558,6 +693,18 @@ namespace Model
          */
         virtual void GetDevicePoolAsync(const Model::GetDevicePoolRequest& request, const GetDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDevicePoolCallable(const Model::GetDevicePoolRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDevicePoolOutcomeCallable GetDevicePoolCallable(Model::GetDevicePoolRequest&& request) const;
+
+        /**
+         * Same as GetDevicePoolAsync(const Model::GetDevicePoolRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDevicePoolAsync(Model::GetDevicePoolRequest&& request, const GetDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about compatibility with a device pool.</p>
          */
@@ -577,6 +724,18 @@ namespace Model
          */
         virtual void GetDevicePoolCompatibilityAsync(const Model::GetDevicePoolCompatibilityRequest& request, const GetDevicePoolCompatibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDevicePoolCompatibilityCallable(const Model::GetDevicePoolCompatibilityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDevicePoolCompatibilityOutcomeCallable GetDevicePoolCompatibilityCallable(Model::GetDevicePoolCompatibilityRequest&& request) const;
+
+        /**
+         * Same as GetDevicePoolCompatibilityAsync(const Model::GetDevicePoolCompatibilityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDevicePoolCompatibilityAsync(Model::GetDevicePoolCompatibilityRequest&& request, const GetDevicePoolCompatibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a job.</p>
          */
@@ -596,6 +755,18 @@ namespace Model
          */
         virtual void GetJobAsync(const Model::GetJobRequest& request, const GetJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetJobCallable(const Model::GetJobRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetJobOutcomeCallable GetJobCallable(Model::GetJobRequest&& request) const;
+
+        /**
+         * Same as GetJobAsync(const Model::GetJobRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetJobAsync(Model::GetJobRequest&& request, const GetJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the current status and future status of all offerings purchased by an
          * AWS account. The response indicates how many offerings are currently available
@@ -633,6 +804,18 @@ namespace Model
          */
         virtual void GetOfferingStatusAsync(const Model::GetOfferingStatusRequest& request, const GetOfferingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetOfferingStatusCallable(const Model::GetOfferingStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetOfferingStatusOutcomeCallable GetOfferingStatusCallable(Model::GetOfferingStatusRequest&& request) const;
+
+        /**
+         * Same as GetOfferingStatusAsync(const Model::GetOfferingStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetOfferingStatusAsync(Model::GetOfferingStatusRequest&& request, const GetOfferingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a project.</p>
          */
@@ -652,6 +835,18 @@ namespace Model
          */
         virtual void GetProjectAsync(const Model::GetProjectRequest& request, const GetProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetProjectCallable(const Model::GetProjectRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetProjectOutcomeCallable GetProjectCallable(Model::GetProjectRequest&& request) const;
+
+        /**
+         * Same as GetProjectAsync(const Model::GetProjectRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetProjectAsync(Model::GetProjectRequest&& request, const GetProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a link to a currently running remote access session.</p>
          */
@@ -671,6 +866,18 @@ namespace Model
          */
         virtual void GetRemoteAccessSessionAsync(const Model::GetRemoteAccessSessionRequest& request, const GetRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRemoteAccessSessionCallable(const Model::GetRemoteAccessSessionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetRemoteAccessSessionOutcomeCallable GetRemoteAccessSessionCallable(Model::GetRemoteAccessSessionRequest&& request) const;
+
+        /**
+         * Same as GetRemoteAccessSessionAsync(const Model::GetRemoteAccessSessionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetRemoteAccessSessionAsync(Model::GetRemoteAccessSessionRequest&& request, const GetRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a run.</p>
          */
@@ -690,6 +897,18 @@ namespace Model
          */
         virtual void GetRunAsync(const Model::GetRunRequest& request, const GetRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRunCallable(const Model::GetRunRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetRunOutcomeCallable GetRunCallable(Model::GetRunRequest&& request) const;
+
+        /**
+         * Same as GetRunAsync(const Model::GetRunRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetRunAsync(Model::GetRunRequest&& request, const GetRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a suite.</p>
          */
@@ -709,6 +928,18 @@ namespace Model
          */
         virtual void GetSuiteAsync(const Model::GetSuiteRequest& request, const GetSuiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSuiteCallable(const Model::GetSuiteRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetSuiteOutcomeCallable GetSuiteCallable(Model::GetSuiteRequest&& request) const;
+
+        /**
+         * Same as GetSuiteAsync(const Model::GetSuiteRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetSuiteAsync(Model::GetSuiteRequest&& request, const GetSuiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a test.</p>
          */
@@ -728,6 +959,18 @@ namespace Model
          */
         virtual void GetTestAsync(const Model::GetTestRequest& request, const GetTestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTestCallable(const Model::GetTestRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetTestOutcomeCallable GetTestCallable(Model::GetTestRequest&& request) const;
+
+        /**
+         * Same as GetTestAsync(const Model::GetTestRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetTestAsync(Model::GetTestRequest&& request, const GetTestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about an upload.</p>
          */
@@ -747,6 +990,18 @@ namespace Model
          */
         virtual void GetUploadAsync(const Model::GetUploadRequest& request, const GetUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetUploadCallable(const Model::GetUploadRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetUploadOutcomeCallable GetUploadCallable(Model::GetUploadRequest&& request) const;
+
+        /**
+         * Same as GetUploadAsync(const Model::GetUploadRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetUploadAsync(Model::GetUploadRequest&& request, const GetUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Installs an application to the device in a remote access session. For Android
          * applications, the file must be in .apk format. For iOS applications, the file
@@ -772,6 +1027,18 @@ namespace Model
          */
         virtual void InstallToRemoteAccessSessionAsync(const Model::InstallToRemoteAccessSessionRequest& request, const InstallToRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as InstallToRemoteAccessSessionCallable(const Model::InstallToRemoteAccessSessionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::InstallToRemoteAccessSessionOutcomeCallable InstallToRemoteAccessSessionCallable(Model::InstallToRemoteAccessSessionRequest&& request) const;
+
+        /**
+         * Same as InstallToRemoteAccessSessionAsync(const Model::InstallToRemoteAccessSessionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void InstallToRemoteAccessSessionAsync(Model::InstallToRemoteAccessSessionRequest&& request, const InstallToRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about artifacts.</p>
          */
@@ -791,6 +1058,18 @@ namespace Model
          */
         virtual void ListArtifactsAsync(const Model::ListArtifactsRequest& request, const ListArtifactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListArtifactsCallable(const Model::ListArtifactsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListArtifactsOutcomeCallable ListArtifactsCallable(Model::ListArtifactsRequest&& request) const;
+
+        /**
+         * Same as ListArtifactsAsync(const Model::ListArtifactsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListArtifactsAsync(Model::ListArtifactsRequest&& request, const ListArtifactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about device pools.</p>
          */
@@ -810,6 +1089,18 @@ namespace Model
          */
         virtual void ListDevicePoolsAsync(const Model::ListDevicePoolsRequest& request, const ListDevicePoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDevicePoolsCallable(const Model::ListDevicePoolsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDevicePoolsOutcomeCallable ListDevicePoolsCallable(Model::ListDevicePoolsRequest&& request) const;
+
+        /**
+         * Same as ListDevicePoolsAsync(const Model::ListDevicePoolsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDevicePoolsAsync(Model::ListDevicePoolsRequest&& request, const ListDevicePoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about unique device types.</p>
          */
@@ -829,6 +1120,18 @@ namespace Model
          */
         virtual void ListDevicesAsync(const Model::ListDevicesRequest& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDevicesCallable(const Model::ListDevicesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDevicesOutcomeCallable ListDevicesCallable(Model::ListDevicesRequest&& request) const;
+
+        /**
+         * Same as ListDevicesAsync(const Model::ListDevicesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDevicesAsync(Model::ListDevicesRequest&& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about jobs.</p>
          */
@@ -848,6 +1151,18 @@ namespace Model
          */
         virtual void ListJobsAsync(const Model::ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListJobsCallable(const Model::ListJobsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListJobsOutcomeCallable ListJobsCallable(Model::ListJobsRequest&& request) const;
+
+        /**
+         * Same as ListJobsAsync(const Model::ListJobsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListJobsAsync(Model::ListJobsRequest&& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of all historical purchases, renewals, and system renewal
          * transactions for an AWS account. The list is paginated and ordered by a
@@ -885,6 +1200,18 @@ namespace Model
          */
         virtual void ListOfferingTransactionsAsync(const Model::ListOfferingTransactionsRequest& request, const ListOfferingTransactionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListOfferingTransactionsCallable(const Model::ListOfferingTransactionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListOfferingTransactionsOutcomeCallable ListOfferingTransactionsCallable(Model::ListOfferingTransactionsRequest&& request) const;
+
+        /**
+         * Same as ListOfferingTransactionsAsync(const Model::ListOfferingTransactionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListOfferingTransactionsAsync(Model::ListOfferingTransactionsRequest&& request, const ListOfferingTransactionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of products or offerings that the user can manage through the
          * API. Each offering record indicates the recurring price per unit and the
@@ -919,6 +1246,18 @@ namespace Model
          */
         virtual void ListOfferingsAsync(const Model::ListOfferingsRequest& request, const ListOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListOfferingsCallable(const Model::ListOfferingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListOfferingsOutcomeCallable ListOfferingsCallable(Model::ListOfferingsRequest&& request) const;
+
+        /**
+         * Same as ListOfferingsAsync(const Model::ListOfferingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListOfferingsAsync(Model::ListOfferingsRequest&& request, const ListOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about projects.</p>
          */
@@ -938,6 +1277,18 @@ namespace Model
          */
         virtual void ListProjectsAsync(const Model::ListProjectsRequest& request, const ListProjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListProjectsCallable(const Model::ListProjectsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListProjectsOutcomeCallable ListProjectsCallable(Model::ListProjectsRequest&& request) const;
+
+        /**
+         * Same as ListProjectsAsync(const Model::ListProjectsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListProjectsAsync(Model::ListProjectsRequest&& request, const ListProjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of all currently running remote access sessions.</p>
          */
@@ -957,6 +1308,18 @@ namespace Model
          */
         virtual void ListRemoteAccessSessionsAsync(const Model::ListRemoteAccessSessionsRequest& request, const ListRemoteAccessSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRemoteAccessSessionsCallable(const Model::ListRemoteAccessSessionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListRemoteAccessSessionsOutcomeCallable ListRemoteAccessSessionsCallable(Model::ListRemoteAccessSessionsRequest&& request) const;
+
+        /**
+         * Same as ListRemoteAccessSessionsAsync(const Model::ListRemoteAccessSessionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListRemoteAccessSessionsAsync(Model::ListRemoteAccessSessionsRequest&& request, const ListRemoteAccessSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about runs.</p>
          */
@@ -976,6 +1339,18 @@ namespace Model
          */
         virtual void ListRunsAsync(const Model::ListRunsRequest& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRunsCallable(const Model::ListRunsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListRunsOutcomeCallable ListRunsCallable(Model::ListRunsRequest&& request) const;
+
+        /**
+         * Same as ListRunsAsync(const Model::ListRunsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListRunsAsync(Model::ListRunsRequest&& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about samples.</p>
          */
@@ -995,6 +1370,18 @@ namespace Model
          */
         virtual void ListSamplesAsync(const Model::ListSamplesRequest& request, const ListSamplesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSamplesCallable(const Model::ListSamplesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListSamplesOutcomeCallable ListSamplesCallable(Model::ListSamplesRequest&& request) const;
+
+        /**
+         * Same as ListSamplesAsync(const Model::ListSamplesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListSamplesAsync(Model::ListSamplesRequest&& request, const ListSamplesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about suites.</p>
          */
@@ -1014,6 +1401,18 @@ namespace Model
          */
         virtual void ListSuitesAsync(const Model::ListSuitesRequest& request, const ListSuitesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSuitesCallable(const Model::ListSuitesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListSuitesOutcomeCallable ListSuitesCallable(Model::ListSuitesRequest&& request) const;
+
+        /**
+         * Same as ListSuitesAsync(const Model::ListSuitesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListSuitesAsync(Model::ListSuitesRequest&& request, const ListSuitesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about tests.</p>
          */
@@ -1033,6 +1432,18 @@ namespace Model
          */
         virtual void ListTestsAsync(const Model::ListTestsRequest& request, const ListTestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTestsCallable(const Model::ListTestsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTestsOutcomeCallable ListTestsCallable(Model::ListTestsRequest&& request) const;
+
+        /**
+         * Same as ListTestsAsync(const Model::ListTestsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTestsAsync(Model::ListTestsRequest&& request, const ListTestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about unique problems.</p>
          */
@@ -1052,6 +1463,18 @@ namespace Model
          */
         virtual void ListUniqueProblemsAsync(const Model::ListUniqueProblemsRequest& request, const ListUniqueProblemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListUniqueProblemsCallable(const Model::ListUniqueProblemsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListUniqueProblemsOutcomeCallable ListUniqueProblemsCallable(Model::ListUniqueProblemsRequest&& request) const;
+
+        /**
+         * Same as ListUniqueProblemsAsync(const Model::ListUniqueProblemsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListUniqueProblemsAsync(Model::ListUniqueProblemsRequest&& request, const ListUniqueProblemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about uploads.</p>
          */
@@ -1071,6 +1494,18 @@ namespace Model
          */
         virtual void ListUploadsAsync(const Model::ListUploadsRequest& request, const ListUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListUploadsCallable(const Model::ListUploadsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListUploadsOutcomeCallable ListUploadsCallable(Model::ListUploadsRequest&& request) const;
+
+        /**
+         * Same as ListUploadsAsync(const Model::ListUploadsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListUploadsAsync(Model::ListUploadsRequest&& request, const ListUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Immediately purchases offerings for an AWS account. Offerings renew with the
          * latest total purchased quantity for an offering, unless the renewal was
@@ -1105,6 +1540,18 @@ namespace Model
          */
         virtual void PurchaseOfferingAsync(const Model::PurchaseOfferingRequest& request, const PurchaseOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PurchaseOfferingCallable(const Model::PurchaseOfferingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PurchaseOfferingOutcomeCallable PurchaseOfferingCallable(Model::PurchaseOfferingRequest&& request) const;
+
+        /**
+         * Same as PurchaseOfferingAsync(const Model::PurchaseOfferingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PurchaseOfferingAsync(Model::PurchaseOfferingRequest&& request, const PurchaseOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Explicitly sets the quantity of devices to renew for an offering, starting
          * from the <code>effectiveDate</code> of the next period. The API returns a
@@ -1139,6 +1586,18 @@ namespace Model
          */
         virtual void RenewOfferingAsync(const Model::RenewOfferingRequest& request, const RenewOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RenewOfferingCallable(const Model::RenewOfferingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RenewOfferingOutcomeCallable RenewOfferingCallable(Model::RenewOfferingRequest&& request) const;
+
+        /**
+         * Same as RenewOfferingAsync(const Model::RenewOfferingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RenewOfferingAsync(Model::RenewOfferingRequest&& request, const RenewOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Schedules a run.</p>
          */
@@ -1158,6 +1617,18 @@ namespace Model
          */
         virtual void ScheduleRunAsync(const Model::ScheduleRunRequest& request, const ScheduleRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ScheduleRunCallable(const Model::ScheduleRunRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ScheduleRunOutcomeCallable ScheduleRunCallable(Model::ScheduleRunRequest&& request) const;
+
+        /**
+         * Same as ScheduleRunAsync(const Model::ScheduleRunRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ScheduleRunAsync(Model::ScheduleRunRequest&& request, const ScheduleRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Ends a specified remote access session.</p>
          */
@@ -1177,6 +1648,18 @@ namespace Model
          */
         virtual void StopRemoteAccessSessionAsync(const Model::StopRemoteAccessSessionRequest& request, const StopRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopRemoteAccessSessionCallable(const Model::StopRemoteAccessSessionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StopRemoteAccessSessionOutcomeCallable StopRemoteAccessSessionCallable(Model::StopRemoteAccessSessionRequest&& request) const;
+
+        /**
+         * Same as StopRemoteAccessSessionAsync(const Model::StopRemoteAccessSessionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StopRemoteAccessSessionAsync(Model::StopRemoteAccessSessionRequest&& request, const StopRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Initiates a stop request for the current test run. AWS Device Farm will
          * immediately stop the run on devices where tests have not started executing, and
@@ -1211,6 +1694,18 @@ namespace Model
          */
         virtual void StopRunAsync(const Model::StopRunRequest& request, const StopRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopRunCallable(const Model::StopRunRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StopRunOutcomeCallable StopRunCallable(Model::StopRunRequest&& request) const;
+
+        /**
+         * Same as StopRunAsync(const Model::StopRunRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StopRunAsync(Model::StopRunRequest&& request, const StopRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the name, description, and rules in a device pool given the
          * attributes and the pool ARN. Rule updates are all-or-nothing, meaning they can
@@ -1236,6 +1731,18 @@ namespace Model
          */
         virtual void UpdateDevicePoolAsync(const Model::UpdateDevicePoolRequest& request, const UpdateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDevicePoolCallable(const Model::UpdateDevicePoolRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateDevicePoolOutcomeCallable UpdateDevicePoolCallable(Model::UpdateDevicePoolRequest&& request) const;
+
+        /**
+         * Same as UpdateDevicePoolAsync(const Model::UpdateDevicePoolRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateDevicePoolAsync(Model::UpdateDevicePoolRequest&& request, const UpdateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified project name, given the project ARN and a new
          * name.</p>
@@ -1258,6 +1765,310 @@ namespace Model
          */
         virtual void UpdateProjectAsync(const Model::UpdateProjectRequest& request, const UpdateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateProjectCallable(const Model::UpdateProjectRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateProjectOutcomeCallable UpdateProjectCallable(Model::UpdateProjectRequest&& request) const;
+
+        /**
+         * Same as UpdateProjectAsync(const Model::UpdateProjectRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateProjectAsync(Model::UpdateProjectRequest&& request, const UpdateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through GetOfferingStatus(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DeviceFarmClient, Model::GetOfferingStatusRequest, Model::GetOfferingStatusOutcome> GetOfferingStatusPaginator(const Model::GetOfferingStatusRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListArtifacts(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DeviceFarmClient, Model::ListArtifactsRequest, Model::ListArtifactsOutcome> ListArtifactsPaginator(const Model::ListArtifactsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListDevicePools(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DeviceFarmClient, Model::ListDevicePoolsRequest, Model::ListDevicePoolsOutcome> ListDevicePoolsPaginator(const Model::ListDevicePoolsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListDevices(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DeviceFarmClient, Model::ListDevicesRequest, Model::ListDevicesOutcome> ListDevicesPaginator(const Model::ListDevicesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListJobs(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DeviceFarmClient, Model::ListJobsRequest, Model::ListJobsOutcome> ListJobsPaginator(const Model::ListJobsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListOfferingTransactions(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DeviceFarmClient, Model::ListOfferingTransactionsRequest, Model::ListOfferingTransactionsOutcome> ListOfferingTransactionsPaginator(const Model::ListOfferingTransactionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListOfferings(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DeviceFarmClient, Model::ListOfferingsRequest, Model::ListOfferingsOutcome> ListOfferingsPaginator(const Model::ListOfferingsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListProjects(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DeviceFarmClient, Model::ListProjectsRequest, Model::ListProjectsOutcome> ListProjectsPaginator(const Model::ListProjectsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListRemoteAccessSessions(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DeviceFarmClient, Model::ListRemoteAccessSessionsRequest, Model::ListRemoteAccessSessionsOutcome> ListRemoteAccessSessionsPaginator(const Model::ListRemoteAccessSessionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListRuns(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DeviceFarmClient, Model::ListRunsRequest, Model::ListRunsOutcome> ListRunsPaginator(const Model::ListRunsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListSamples(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DeviceFarmClient, Model::ListSamplesRequest, Model::ListSamplesOutcome> ListSamplesPaginator(const Model::ListSamplesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListSuites(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DeviceFarmClient, Model::ListSuitesRequest, Model::ListSuitesOutcome> ListSuitesPaginator(const Model::ListSuitesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListTests(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DeviceFarmClient, Model::ListTestsRequest, Model::ListTestsOutcome> ListTestsPaginator(const Model::ListTestsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListUniqueProblems(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DeviceFarmClient, Model::ListUniqueProblemsRequest, Model::ListUniqueProblemsOutcome> ListUniqueProblemsPaginator(const Model::ListUniqueProblemsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListUploads(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DeviceFarmClient, Model::ListUploadsRequest, Model::ListUploadsOutcome> ListUploadsPaginator(const Model::ListUploadsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CreateDevicePool(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::CreateDevicePoolRequest, Model::CreateDevicePoolOutcome> CreateDevicePoolAwaitable(Model::CreateDevicePoolRequest request) const;
+
+        /**
+         * co_await-able form of CreateProject(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::CreateProjectRequest, Model::CreateProjectOutcome> CreateProjectAwaitable(Model::CreateProjectRequest request) const;
+
+        /**
+         * co_await-able form of CreateRemoteAccessSession(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::CreateRemoteAccessSessionRequest, Model::CreateRemoteAccessSessionOutcome> CreateRemoteAccessSessionAwaitable(Model::CreateRemoteAccessSessionRequest request) const;
+
+        /**
+         * co_await-able form of CreateUpload(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::CreateUploadRequest, Model::CreateUploadOutcome> CreateUploadAwaitable(Model::CreateUploadRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDevicePool(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::DeleteDevicePoolRequest, Model::DeleteDevicePoolOutcome> DeleteDevicePoolAwaitable(Model::DeleteDevicePoolRequest request) const;
+
+        /**
+         * co_await-able form of DeleteProject(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::DeleteProjectRequest, Model::DeleteProjectOutcome> DeleteProjectAwaitable(Model::DeleteProjectRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRemoteAccessSession(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::DeleteRemoteAccessSessionRequest, Model::DeleteRemoteAccessSessionOutcome> DeleteRemoteAccessSessionAwaitable(Model::DeleteRemoteAccessSessionRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRun(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::DeleteRunRequest, Model::DeleteRunOutcome> DeleteRunAwaitable(Model::DeleteRunRequest request) const;
+
+        /**
+         * co_await-able form of DeleteUpload(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::DeleteUploadRequest, Model::DeleteUploadOutcome> DeleteUploadAwaitable(Model::DeleteUploadRequest request) const;
+
+        /**
+         * co_await-able form of GetAccountSettings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::GetAccountSettingsRequest, Model::GetAccountSettingsOutcome> GetAccountSettingsAwaitable(Model::GetAccountSettingsRequest request) const;
+
+        /**
+         * co_await-able form of GetDevice(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::GetDeviceRequest, Model::GetDeviceOutcome> GetDeviceAwaitable(Model::GetDeviceRequest request) const;
+
+        /**
+         * co_await-able form of GetDevicePool(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::GetDevicePoolRequest, Model::GetDevicePoolOutcome> GetDevicePoolAwaitable(Model::GetDevicePoolRequest request) const;
+
+        /**
+         * co_await-able form of GetDevicePoolCompatibility(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::GetDevicePoolCompatibilityRequest, Model::GetDevicePoolCompatibilityOutcome> GetDevicePoolCompatibilityAwaitable(Model::GetDevicePoolCompatibilityRequest request) const;
+
+        /**
+         * co_await-able form of GetJob(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::GetJobRequest, Model::GetJobOutcome> GetJobAwaitable(Model::GetJobRequest request) const;
+
+        /**
+         * co_await-able form of GetOfferingStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::GetOfferingStatusRequest, Model::GetOfferingStatusOutcome> GetOfferingStatusAwaitable(Model::GetOfferingStatusRequest request) const;
+
+        /**
+         * co_await-able form of GetProject(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::GetProjectRequest, Model::GetProjectOutcome> GetProjectAwaitable(Model::GetProjectRequest request) const;
+
+        /**
+         * co_await-able form of GetRemoteAccessSession(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::GetRemoteAccessSessionRequest, Model::GetRemoteAccessSessionOutcome> GetRemoteAccessSessionAwaitable(Model::GetRemoteAccessSessionRequest request) const;
+
+        /**
+         * co_await-able form of GetRun(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::GetRunRequest, Model::GetRunOutcome> GetRunAwaitable(Model::GetRunRequest request) const;
+
+        /**
+         * co_await-able form of GetSuite(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::GetSuiteRequest, Model::GetSuiteOutcome> GetSuiteAwaitable(Model::GetSuiteRequest request) const;
+
+        /**
+         * co_await-able form of GetTest(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::GetTestRequest, Model::GetTestOutcome> GetTestAwaitable(Model::GetTestRequest request) const;
+
+        /**
+         * co_await-able form of GetUpload(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::GetUploadRequest, Model::GetUploadOutcome> GetUploadAwaitable(Model::GetUploadRequest request) const;
+
+        /**
+         * co_await-able form of InstallToRemoteAccessSession(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::InstallToRemoteAccessSessionRequest, Model::InstallToRemoteAccessSessionOutcome> InstallToRemoteAccessSessionAwaitable(Model::InstallToRemoteAccessSessionRequest request) const;
+
+        /**
+         * co_await-able form of ListArtifacts(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::ListArtifactsRequest, Model::ListArtifactsOutcome> ListArtifactsAwaitable(Model::ListArtifactsRequest request) const;
+
+        /**
+         * co_await-able form of ListDevicePools(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::ListDevicePoolsRequest, Model::ListDevicePoolsOutcome> ListDevicePoolsAwaitable(Model::ListDevicePoolsRequest request) const;
+
+        /**
+         * co_await-able form of ListDevices(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::ListDevicesRequest, Model::ListDevicesOutcome> ListDevicesAwaitable(Model::ListDevicesRequest request) const;
+
+        /**
+         * co_await-able form of ListJobs(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::ListJobsRequest, Model::ListJobsOutcome> ListJobsAwaitable(Model::ListJobsRequest request) const;
+
+        /**
+         * co_await-able form of ListOfferingTransactions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::ListOfferingTransactionsRequest, Model::ListOfferingTransactionsOutcome> ListOfferingTransactionsAwaitable(Model::ListOfferingTransactionsRequest request) const;
+
+        /**
+         * co_await-able form of ListOfferings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::ListOfferingsRequest, Model::ListOfferingsOutcome> ListOfferingsAwaitable(Model::ListOfferingsRequest request) const;
+
+        /**
+         * co_await-able form of ListProjects(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::ListProjectsRequest, Model::ListProjectsOutcome> ListProjectsAwaitable(Model::ListProjectsRequest request) const;
+
+        /**
+         * co_await-able form of ListRemoteAccessSessions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::ListRemoteAccessSessionsRequest, Model::ListRemoteAccessSessionsOutcome> ListRemoteAccessSessionsAwaitable(Model::ListRemoteAccessSessionsRequest request) const;
+
+        /**
+         * co_await-able form of ListRuns(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::ListRunsRequest, Model::ListRunsOutcome> ListRunsAwaitable(Model::ListRunsRequest request) const;
+
+        /**
+         * co_await-able form of ListSamples(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::ListSamplesRequest, Model::ListSamplesOutcome> ListSamplesAwaitable(Model::ListSamplesRequest request) const;
+
+        /**
+         * co_await-able form of ListSuites(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::ListSuitesRequest, Model::ListSuitesOutcome> ListSuitesAwaitable(Model::ListSuitesRequest request) const;
+
+        /**
+         * co_await-able form of ListTests(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::ListTestsRequest, Model::ListTestsOutcome> ListTestsAwaitable(Model::ListTestsRequest request) const;
+
+        /**
+         * co_await-able form of ListUniqueProblems(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::ListUniqueProblemsRequest, Model::ListUniqueProblemsOutcome> ListUniqueProblemsAwaitable(Model::ListUniqueProblemsRequest request) const;
+
+        /**
+         * co_await-able form of ListUploads(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::ListUploadsRequest, Model::ListUploadsOutcome> ListUploadsAwaitable(Model::ListUploadsRequest request) const;
+
+        /**
+         * co_await-able form of PurchaseOffering(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::PurchaseOfferingRequest, Model::PurchaseOfferingOutcome> PurchaseOfferingAwaitable(Model::PurchaseOfferingRequest request) const;
+
+        /**
+         * co_await-able form of RenewOffering(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::RenewOfferingRequest, Model::RenewOfferingOutcome> RenewOfferingAwaitable(Model::RenewOfferingRequest request) const;
+
+        /**
+         * co_await-able form of ScheduleRun(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::ScheduleRunRequest, Model::ScheduleRunOutcome> ScheduleRunAwaitable(Model::ScheduleRunRequest request) const;
+
+        /**
+         * co_await-able form of StopRemoteAccessSession(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::StopRemoteAccessSessionRequest, Model::StopRemoteAccessSessionOutcome> StopRemoteAccessSessionAwaitable(Model::StopRemoteAccessSessionRequest request) const;
+
+        /**
+         * co_await-able form of StopRun(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::StopRunRequest, Model::StopRunOutcome> StopRunAwaitable(Model::StopRunRequest request) const;
+
+        /**
+         * co_await-able form of UpdateDevicePool(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::UpdateDevicePoolRequest, Model::UpdateDevicePoolOutcome> UpdateDevicePoolAwaitable(Model::UpdateDevicePoolRequest request) const;
+
+        /**
+         * co_await-able form of UpdateProject(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DeviceFarmClient, Model::UpdateProjectRequest, Model::UpdateProjectOutcome> UpdateProjectAwaitable(Model::UpdateProjectRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
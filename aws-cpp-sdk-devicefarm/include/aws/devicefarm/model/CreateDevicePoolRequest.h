@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateDevicePoolRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDevicePool"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
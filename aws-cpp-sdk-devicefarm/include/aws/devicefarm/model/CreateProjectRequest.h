@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateProjectRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateProject"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateRemoteAccessSessionRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateRemoteAccessSession"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
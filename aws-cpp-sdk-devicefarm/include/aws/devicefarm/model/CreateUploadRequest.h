@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateUploadRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateUpload"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDevicePoolRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDevicePool"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
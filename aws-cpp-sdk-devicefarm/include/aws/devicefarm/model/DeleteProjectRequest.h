@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteProjectRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteProject"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteRemoteAccessSessionRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteRemoteAccessSession"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteRunRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteRun"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteUploadRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteUpload"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
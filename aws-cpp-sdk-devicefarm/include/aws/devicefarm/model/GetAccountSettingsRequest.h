@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetAccountSettingsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetAccountSettings"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
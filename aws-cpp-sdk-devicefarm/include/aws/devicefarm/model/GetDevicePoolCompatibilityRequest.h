@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetDevicePoolCompatibilityRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDevicePoolCompatibility"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetDevicePoolRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDevicePool"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetDeviceRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDevice"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
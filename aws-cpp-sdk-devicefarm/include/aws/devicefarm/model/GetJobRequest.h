@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetJobRequest();
+    inline const char* GetServiceRequestName() const override { return "GetJob"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetOfferingStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "GetOfferingStatus"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
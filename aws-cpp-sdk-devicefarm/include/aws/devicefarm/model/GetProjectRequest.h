@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetProjectRequest();
+    inline const char* GetServiceRequestName() const override { return "GetProject"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetRemoteAccessSessionRequest();
+    inline const char* GetServiceRequestName() const override { return "GetRemoteAccessSession"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
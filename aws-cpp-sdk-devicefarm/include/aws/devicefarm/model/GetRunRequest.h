@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetRunRequest();
+    inline const char* GetServiceRequestName() const override { return "GetRun"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetSuiteRequest();
+    inline const char* GetServiceRequestName() const override { return "GetSuite"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
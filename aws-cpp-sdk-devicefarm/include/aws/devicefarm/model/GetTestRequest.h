@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetTestRequest();
+    inline const char* GetServiceRequestName() const override { return "GetTest"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetUploadRequest();
+    inline const char* GetServiceRequestName() const override { return "GetUpload"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     InstallToRemoteAccessSessionRequest();
+    inline const char* GetServiceRequestName() const override { return "InstallToRemoteAccessSession"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListArtifactsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListArtifacts"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListDevicePoolsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListDevicePools"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListDevicesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListDevices"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListOfferingTransactionsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListOfferingTransactions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
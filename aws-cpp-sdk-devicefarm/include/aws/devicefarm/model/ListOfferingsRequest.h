@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListOfferingsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListOfferings"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
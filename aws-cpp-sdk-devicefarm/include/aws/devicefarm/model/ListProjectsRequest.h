@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListProjectsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListProjects"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListRemoteAccessSessionsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListRemoteAccessSessions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
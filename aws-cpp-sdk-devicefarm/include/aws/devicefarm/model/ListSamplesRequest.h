@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListSamplesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListSamples"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
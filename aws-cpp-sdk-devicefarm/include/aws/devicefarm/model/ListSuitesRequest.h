@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListSuitesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListSuites"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListTestsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTests"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListUniqueProblemsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListUniqueProblems"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
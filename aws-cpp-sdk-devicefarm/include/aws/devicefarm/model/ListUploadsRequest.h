@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListUploadsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListUploads"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
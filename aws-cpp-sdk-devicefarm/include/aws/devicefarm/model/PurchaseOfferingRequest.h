@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PurchaseOfferingRequest();
+    inline const char* GetServiceRequestName() const override { return "PurchaseOffering"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RenewOfferingRequest();
+    inline const char* GetServiceRequestName() const override { return "RenewOffering"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ScheduleRunRequest();
+    inline const char* GetServiceRequestName() const override { return "ScheduleRun"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
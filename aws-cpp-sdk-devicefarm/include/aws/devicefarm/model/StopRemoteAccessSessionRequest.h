@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     StopRemoteAccessSessionRequest();
+    inline const char* GetServiceRequestName() const override { return "StopRemoteAccessSession"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     StopRunRequest();
+    inline const char* GetServiceRequestName() const override { return "StopRun"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
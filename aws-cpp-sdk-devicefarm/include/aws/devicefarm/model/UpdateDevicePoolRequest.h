@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateDevicePoolRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateDevicePool"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateProjectRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateProject"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
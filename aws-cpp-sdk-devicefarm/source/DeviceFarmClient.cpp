@@ -152,7 +152,7 @@ CreateDevicePoolOutcome DeviceFarmClient::CreateDevicePool(const CreateDevicePoo
 
 CreateDevicePoolOutcomeCallable DeviceFarmClient::CreateDevicePoolCallable(const CreateDevicePoolRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDevicePool(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDevicePool(request); } );
 }
 
 void DeviceFarmClient::CreateDevicePoolAsync(const CreateDevicePoolRequest& request, const CreateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -160,6 +160,16 @@ void DeviceFarmClient::CreateDevicePoolAsync(const CreateDevicePoolRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->CreateDevicePoolAsyncHelper( request, handler, context ); } );
 }
 
+CreateDevicePoolOutcomeCallable DeviceFarmClient::CreateDevicePoolCallable(CreateDevicePoolRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::CreateDevicePool, this, std::move(request)));
+}
+
+void DeviceFarmClient::CreateDevicePoolAsync(CreateDevicePoolRequest&& request, const CreateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::CreateDevicePoolAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::CreateDevicePoolAsyncHelper(const CreateDevicePoolRequest& request, const CreateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDevicePool(request), context);
@@ -183,7 +193,7 @@ CreateProjectOutcome DeviceFarmClient::CreateProject(const CreateProjectRequest&
 
 CreateProjectOutcomeCallable DeviceFarmClient::CreateProjectCallable(const CreateProjectRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateProject(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateProject(request); } );
 }
 
 void DeviceFarmClient::CreateProjectAsync(const CreateProjectRequest& request, const CreateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -191,6 +201,16 @@ void DeviceFarmClient::CreateProjectAsync(const CreateProjectRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->CreateProjectAsyncHelper( request, handler, context ); } );
 }
 
+CreateProjectOutcomeCallable DeviceFarmClient::CreateProjectCallable(CreateProjectRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::CreateProject, this, std::move(request)));
+}
+
+void DeviceFarmClient::CreateProjectAsync(CreateProjectRequest&& request, const CreateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::CreateProjectAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::CreateProjectAsyncHelper(const CreateProjectRequest& request, const CreateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateProject(request), context);
@@ -214,7 +234,7 @@ CreateRemoteAccessSessionOutcome DeviceFarmClient::CreateRemoteAccessSession(con
 
 CreateRemoteAccessSessionOutcomeCallable DeviceFarmClient::CreateRemoteAccessSessionCallable(const CreateRemoteAccessSessionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateRemoteAccessSession(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateRemoteAccessSession(request); } );
 }
 
 void DeviceFarmClient::CreateRemoteAccessSessionAsync(const CreateRemoteAccessSessionRequest& request, const CreateRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -222,6 +242,16 @@ void DeviceFarmClient::CreateRemoteAccessSessionAsync(const CreateRemoteAccessSe
   m_executor->Submit( [this, request, handler, context](){ this->CreateRemoteAccessSessionAsyncHelper( request, handler, context ); } );
 }
 
+CreateRemoteAccessSessionOutcomeCallable DeviceFarmClient::CreateRemoteAccessSessionCallable(CreateRemoteAccessSessionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::CreateRemoteAccessSession, this, std::move(request)));
+}
+
+void DeviceFarmClient::CreateRemoteAccessSessionAsync(CreateRemoteAccessSessionRequest&& request, const CreateRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::CreateRemoteAccessSessionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::CreateRemoteAccessSessionAsyncHelper(const CreateRemoteAccessSessionRequest& request, const CreateRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateRemoteAccessSession(request), context);
@@ -245,7 +275,7 @@ CreateUploadOutcome DeviceFarmClient::CreateUpload(const CreateUploadRequest& re
 
 CreateUploadOutcomeCallable DeviceFarmClient::CreateUploadCallable(const CreateUploadRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateUpload(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateUpload(request); } );
 }
 
 void DeviceFarmClient::CreateUploadAsync(const CreateUploadRequest& request, const CreateUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -253,6 +283,16 @@ void DeviceFarmClient::CreateUploadAsync(const CreateUploadRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->CreateUploadAsyncHelper( request, handler, context ); } );
 }
 
+CreateUploadOutcomeCallable DeviceFarmClient::CreateUploadCallable(CreateUploadRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::CreateUpload, this, std::move(request)));
+}
+
+void DeviceFarmClient::CreateUploadAsync(CreateUploadRequest&& request, const CreateUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::CreateUploadAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::CreateUploadAsyncHelper(const CreateUploadRequest& request, const CreateUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateUpload(request), context);
@@ -276,7 +316,7 @@ DeleteDevicePoolOutcome DeviceFarmClient::DeleteDevicePool(const DeleteDevicePoo
 
 DeleteDevicePoolOutcomeCallable DeviceFarmClient::DeleteDevicePoolCallable(const DeleteDevicePoolRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDevicePool(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDevicePool(request); } );
 }
 
 void DeviceFarmClient::DeleteDevicePoolAsync(const DeleteDevicePoolRequest& request, const DeleteDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -284,6 +324,16 @@ void DeviceFarmClient::DeleteDevicePoolAsync(const DeleteDevicePoolRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDevicePoolAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDevicePoolOutcomeCallable DeviceFarmClient::DeleteDevicePoolCallable(DeleteDevicePoolRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::DeleteDevicePool, this, std::move(request)));
+}
+
+void DeviceFarmClient::DeleteDevicePoolAsync(DeleteDevicePoolRequest&& request, const DeleteDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::DeleteDevicePoolAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::DeleteDevicePoolAsyncHelper(const DeleteDevicePoolRequest& request, const DeleteDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDevicePool(request), context);
@@ -307,7 +357,7 @@ DeleteProjectOutcome DeviceFarmClient::DeleteProject(const DeleteProjectRequest&
 
 DeleteProjectOutcomeCallable DeviceFarmClient::DeleteProjectCallable(const DeleteProjectRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteProject(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteProject(request); } );
 }
 
 void DeviceFarmClient::DeleteProjectAsync(const DeleteProjectRequest& request, const DeleteProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -315,6 +365,16 @@ void DeviceFarmClient::DeleteProjectAsync(const DeleteProjectRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->DeleteProjectAsyncHelper( request, handler, context ); } );
 }
 
+DeleteProjectOutcomeCallable DeviceFarmClient::DeleteProjectCallable(DeleteProjectRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::DeleteProject, this, std::move(request)));
+}
+
+void DeviceFarmClient::DeleteProjectAsync(DeleteProjectRequest&& request, const DeleteProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::DeleteProjectAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::DeleteProjectAsyncHelper(const DeleteProjectRequest& request, const DeleteProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteProject(request), context);
@@ -338,7 +398,7 @@ DeleteRemoteAccessSessionOutcome DeviceFarmClient::DeleteRemoteAccessSession(con
 
 DeleteRemoteAccessSessionOutcomeCallable DeviceFarmClient::DeleteRemoteAccessSessionCallable(const DeleteRemoteAccessSessionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRemoteAccessSession(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRemoteAccessSession(request); } );
 }
 
 void DeviceFarmClient::DeleteRemoteAccessSessionAsync(const DeleteRemoteAccessSessionRequest& request, const DeleteRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -346,6 +406,16 @@ void DeviceFarmClient::DeleteRemoteAccessSessionAsync(const DeleteRemoteAccessSe
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRemoteAccessSessionAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRemoteAccessSessionOutcomeCallable DeviceFarmClient::DeleteRemoteAccessSessionCallable(DeleteRemoteAccessSessionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::DeleteRemoteAccessSession, this, std::move(request)));
+}
+
+void DeviceFarmClient::DeleteRemoteAccessSessionAsync(DeleteRemoteAccessSessionRequest&& request, const DeleteRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::DeleteRemoteAccessSessionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::DeleteRemoteAccessSessionAsyncHelper(const DeleteRemoteAccessSessionRequest& request, const DeleteRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRemoteAccessSession(request), context);
@@ -369,7 +439,7 @@ DeleteRunOutcome DeviceFarmClient::DeleteRun(const DeleteRunRequest& request) co
 
 DeleteRunOutcomeCallable DeviceFarmClient::DeleteRunCallable(const DeleteRunRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRun(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRun(request); } );
 }
 
 void DeviceFarmClient::DeleteRunAsync(const DeleteRunRequest& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -377,6 +447,16 @@ void DeviceFarmClient::DeleteRunAsync(const DeleteRunRequest& request, const Del
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRunAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRunOutcomeCallable DeviceFarmClient::DeleteRunCallable(DeleteRunRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::DeleteRun, this, std::move(request)));
+}
+
+void DeviceFarmClient::DeleteRunAsync(DeleteRunRequest&& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::DeleteRunAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::DeleteRunAsyncHelper(const DeleteRunRequest& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRun(request), context);
@@ -400,7 +480,7 @@ DeleteUploadOutcome DeviceFarmClient::DeleteUpload(const DeleteUploadRequest& re
 
 DeleteUploadOutcomeCallable DeviceFarmClient::DeleteUploadCallable(const DeleteUploadRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteUpload(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteUpload(request); } );
 }
 
 void DeviceFarmClient::DeleteUploadAsync(const DeleteUploadRequest& request, const DeleteUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -408,6 +488,16 @@ void DeviceFarmClient::DeleteUploadAsync(const DeleteUploadRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->DeleteUploadAsyncHelper( request, handler, context ); } );
 }
 
+DeleteUploadOutcomeCallable DeviceFarmClient::DeleteUploadCallable(DeleteUploadRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::DeleteUpload, this, std::move(request)));
+}
+
+void DeviceFarmClient::DeleteUploadAsync(DeleteUploadRequest&& request, const DeleteUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::DeleteUploadAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::DeleteUploadAsyncHelper(const DeleteUploadRequest& request, const DeleteUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteUpload(request), context);
@@ -431,7 +521,7 @@ GetAccountSettingsOutcome DeviceFarmClient::GetAccountSettings(const GetAccountS
 
 GetAccountSettingsOutcomeCallable DeviceFarmClient::GetAccountSettingsCallable(const GetAccountSettingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetAccountSettings(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetAccountSettings(request); } );
 }
 
 void DeviceFarmClient::GetAccountSettingsAsync(const GetAccountSettingsRequest& request, const GetAccountSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -439,6 +529,16 @@ void DeviceFarmClient::GetAccountSettingsAsync(const GetAccountSettingsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->GetAccountSettingsAsyncHelper( request, handler, context ); } );
 }
 
+GetAccountSettingsOutcomeCallable DeviceFarmClient::GetAccountSettingsCallable(GetAccountSettingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::GetAccountSettings, this, std::move(request)));
+}
+
+void DeviceFarmClient::GetAccountSettingsAsync(GetAccountSettingsRequest&& request, const GetAccountSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::GetAccountSettingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::GetAccountSettingsAsyncHelper(const GetAccountSettingsRequest& request, const GetAccountSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetAccountSettings(request), context);
@@ -462,7 +562,7 @@ GetDeviceOutcome DeviceFarmClient::GetDevice(const GetDeviceRequest& request) co
 
 GetDeviceOutcomeCallable DeviceFarmClient::GetDeviceCallable(const GetDeviceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDevice(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDevice(request); } );
 }
 
 void DeviceFarmClient::GetDeviceAsync(const GetDeviceRequest& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -470,6 +570,16 @@ void DeviceFarmClient::GetDeviceAsync(const GetDeviceRequest& request, const Get
   m_executor->Submit( [this, request, handler, context](){ this->GetDeviceAsyncHelper( request, handler, context ); } );
 }
 
+GetDeviceOutcomeCallable DeviceFarmClient::GetDeviceCallable(GetDeviceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::GetDevice, this, std::move(request)));
+}
+
+void DeviceFarmClient::GetDeviceAsync(GetDeviceRequest&& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::GetDeviceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::GetDeviceAsyncHelper(const GetDeviceRequest& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDevice(request), context);
@@ -493,7 +603,7 @@ GetDevicePoolOutcome DeviceFarmClient::GetDevicePool(const GetDevicePoolRequest&
 
 GetDevicePoolOutcomeCallable DeviceFarmClient::GetDevicePoolCallable(const GetDevicePoolRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDevicePool(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDevicePool(request); } );
 }
 
 void DeviceFarmClient::GetDevicePoolAsync(const GetDevicePoolRequest& request, const GetDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -501,6 +611,16 @@ void DeviceFarmClient::GetDevicePoolAsync(const GetDevicePoolRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->GetDevicePoolAsyncHelper( request, handler, context ); } );
 }
 
+GetDevicePoolOutcomeCallable DeviceFarmClient::GetDevicePoolCallable(GetDevicePoolRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::GetDevicePool, this, std::move(request)));
+}
+
+void DeviceFarmClient::GetDevicePoolAsync(GetDevicePoolRequest&& request, const GetDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::GetDevicePoolAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::GetDevicePoolAsyncHelper(const GetDevicePoolRequest& request, const GetDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDevicePool(request), context);
@@ -524,7 +644,7 @@ GetDevicePoolCompatibilityOutcome DeviceFarmClient::GetDevicePoolCompatibility(c
 
 GetDevicePoolCompatibilityOutcomeCallable DeviceFarmClient::GetDevicePoolCompatibilityCallable(const GetDevicePoolCompatibilityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDevicePoolCompatibility(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDevicePoolCompatibility(request); } );
 }
 
 void DeviceFarmClient::GetDevicePoolCompatibilityAsync(const GetDevicePoolCompatibilityRequest& request, const GetDevicePoolCompatibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -532,6 +652,16 @@ void DeviceFarmClient::GetDevicePoolCompatibilityAsync(const GetDevicePoolCompat
   m_executor->Submit( [this, request, handler, context](){ this->GetDevicePoolCompatibilityAsyncHelper( request, handler, context ); } );
 }
 
+GetDevicePoolCompatibilityOutcomeCallable DeviceFarmClient::GetDevicePoolCompatibilityCallable(GetDevicePoolCompatibilityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::GetDevicePoolCompatibility, this, std::move(request)));
+}
+
+void DeviceFarmClient::GetDevicePoolCompatibilityAsync(GetDevicePoolCompatibilityRequest&& request, const GetDevicePoolCompatibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::GetDevicePoolCompatibilityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::GetDevicePoolCompatibilityAsyncHelper(const GetDevicePoolCompatibilityRequest& request, const GetDevicePoolCompatibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDevicePoolCompatibility(request), context);
@@ -555,7 +685,7 @@ GetJobOutcome DeviceFarmClient::GetJob(const GetJobRequest& request) const
 
 GetJobOutcomeCallable DeviceFarmClient::GetJobCallable(const GetJobRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetJob(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetJob(request); } );
 }
 
 void DeviceFarmClient::GetJobAsync(const GetJobRequest& request, const GetJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -563,6 +693,16 @@ void DeviceFarmClient::GetJobAsync(const GetJobRequest& request, const GetJobRes
   m_executor->Submit( [this, request, handler, context](){ this->GetJobAsyncHelper( request, handler, context ); } );
 }
 
+GetJobOutcomeCallable DeviceFarmClient::GetJobCallable(GetJobRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::GetJob, this, std::move(request)));
+}
+
+void DeviceFarmClient::GetJobAsync(GetJobRequest&& request, const GetJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::GetJobAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::GetJobAsyncHelper(const GetJobRequest& request, const GetJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetJob(request), context);
@@ -586,7 +726,7 @@ GetOfferingStatusOutcome DeviceFarmClient::GetOfferingStatus(const GetOfferingSt
 
 GetOfferingStatusOutcomeCallable DeviceFarmClient::GetOfferingStatusCallable(const GetOfferingStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetOfferingStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetOfferingStatus(request); } );
 }
 
 void DeviceFarmClient::GetOfferingStatusAsync(const GetOfferingStatusRequest& request, const GetOfferingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -594,6 +734,16 @@ void DeviceFarmClient::GetOfferingStatusAsync(const GetOfferingStatusRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->GetOfferingStatusAsyncHelper( request, handler, context ); } );
 }
 
+GetOfferingStatusOutcomeCallable DeviceFarmClient::GetOfferingStatusCallable(GetOfferingStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::GetOfferingStatus, this, std::move(request)));
+}
+
+void DeviceFarmClient::GetOfferingStatusAsync(GetOfferingStatusRequest&& request, const GetOfferingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::GetOfferingStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::GetOfferingStatusAsyncHelper(const GetOfferingStatusRequest& request, const GetOfferingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetOfferingStatus(request), context);
@@ -617,7 +767,7 @@ GetProjectOutcome DeviceFarmClient::GetProject(const GetProjectRequest& request)
 
 GetProjectOutcomeCallable DeviceFarmClient::GetProjectCallable(const GetProjectRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetProject(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetProject(request); } );
 }
 
 void DeviceFarmClient::GetProjectAsync(const GetProjectRequest& request, const GetProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -625,6 +775,16 @@ void DeviceFarmClient::GetProjectAsync(const GetProjectRequest& request, const G
   m_executor->Submit( [this, request, handler, context](){ this->GetProjectAsyncHelper( request, handler, context ); } );
 }
 
+GetProjectOutcomeCallable DeviceFarmClient::GetProjectCallable(GetProjectRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::GetProject, this, std::move(request)));
+}
+
+void DeviceFarmClient::GetProjectAsync(GetProjectRequest&& request, const GetProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::GetProjectAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::GetProjectAsyncHelper(const GetProjectRequest& request, const GetProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetProject(request), context);
@@ -648,7 +808,7 @@ GetRemoteAccessSessionOutcome DeviceFarmClient::GetRemoteAccessSession(const Get
 
 GetRemoteAccessSessionOutcomeCallable DeviceFarmClient::GetRemoteAccessSessionCallable(const GetRemoteAccessSessionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetRemoteAccessSession(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetRemoteAccessSession(request); } );
 }
 
 void DeviceFarmClient::GetRemoteAccessSessionAsync(const GetRemoteAccessSessionRequest& request, const GetRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -656,6 +816,16 @@ void DeviceFarmClient::GetRemoteAccessSessionAsync(const GetRemoteAccessSessionR
   m_executor->Submit( [this, request, handler, context](){ this->GetRemoteAccessSessionAsyncHelper( request, handler, context ); } );
 }
 
+GetRemoteAccessSessionOutcomeCallable DeviceFarmClient::GetRemoteAccessSessionCallable(GetRemoteAccessSessionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::GetRemoteAccessSession, this, std::move(request)));
+}
+
+void DeviceFarmClient::GetRemoteAccessSessionAsync(GetRemoteAccessSessionRequest&& request, const GetRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::GetRemoteAccessSessionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::GetRemoteAccessSessionAsyncHelper(const GetRemoteAccessSessionRequest& request, const GetRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetRemoteAccessSession(request), context);
@@ -679,7 +849,7 @@ GetRunOutcome DeviceFarmClient::GetRun(const GetRunRequest& request) const
 
 GetRunOutcomeCallable DeviceFarmClient::GetRunCallable(const GetRunRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetRun(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetRun(request); } );
 }
 
 void DeviceFarmClient::GetRunAsync(const GetRunRequest& request, const GetRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -687,6 +857,16 @@ void DeviceFarmClient::GetRunAsync(const GetRunRequest& request, const GetRunRes
   m_executor->Submit( [this, request, handler, context](){ this->GetRunAsyncHelper( request, handler, context ); } );
 }
 
+GetRunOutcomeCallable DeviceFarmClient::GetRunCallable(GetRunRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::GetRun, this, std::move(request)));
+}
+
+void DeviceFarmClient::GetRunAsync(GetRunRequest&& request, const GetRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::GetRunAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::GetRunAsyncHelper(const GetRunRequest& request, const GetRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetRun(request), context);
@@ -710,7 +890,7 @@ GetSuiteOutcome DeviceFarmClient::GetSuite(const GetSuiteRequest& request) const
 
 GetSuiteOutcomeCallable DeviceFarmClient::GetSuiteCallable(const GetSuiteRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetSuite(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetSuite(request); } );
 }
 
 void DeviceFarmClient::GetSuiteAsync(const GetSuiteRequest& request, const GetSuiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -718,6 +898,16 @@ void DeviceFarmClient::GetSuiteAsync(const GetSuiteRequest& request, const GetSu
   m_executor->Submit( [this, request, handler, context](){ this->GetSuiteAsyncHelper( request, handler, context ); } );
 }
 
+GetSuiteOutcomeCallable DeviceFarmClient::GetSuiteCallable(GetSuiteRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::GetSuite, this, std::move(request)));
+}
+
+void DeviceFarmClient::GetSuiteAsync(GetSuiteRequest&& request, const GetSuiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::GetSuiteAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::GetSuiteAsyncHelper(const GetSuiteRequest& request, const GetSuiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetSuite(request), context);
@@ -741,7 +931,7 @@ GetTestOutcome DeviceFarmClient::GetTest(const GetTestRequest& request) const
 
 GetTestOutcomeCallable DeviceFarmClient::GetTestCallable(const GetTestRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetTest(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetTest(request); } );
 }
 
 void DeviceFarmClient::GetTestAsync(const GetTestRequest& request, const GetTestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -749,6 +939,16 @@ void DeviceFarmClient::GetTestAsync(const GetTestRequest& request, const GetTest
   m_executor->Submit( [this, request, handler, context](){ this->GetTestAsyncHelper( request, handler, context ); } );
 }
 
+GetTestOutcomeCallable DeviceFarmClient::GetTestCallable(GetTestRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::GetTest, this, std::move(request)));
+}
+
+void DeviceFarmClient::GetTestAsync(GetTestRequest&& request, const GetTestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::GetTestAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::GetTestAsyncHelper(const GetTestRequest& request, const GetTestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetTest(request), context);
@@ -772,7 +972,7 @@ GetUploadOutcome DeviceFarmClient::GetUpload(const GetUploadRequest& request) co
 
 GetUploadOutcomeCallable DeviceFarmClient::GetUploadCallable(const GetUploadRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetUpload(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetUpload(request); } );
 }
 
 void DeviceFarmClient::GetUploadAsync(const GetUploadRequest& request, const GetUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -780,6 +980,16 @@ void DeviceFarmClient::GetUploadAsync(const GetUploadRequest& request, const Get
   m_executor->Submit( [this, request, handler, context](){ this->GetUploadAsyncHelper( request, handler, context ); } );
 }
 
+GetUploadOutcomeCallable DeviceFarmClient::GetUploadCallable(GetUploadRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::GetUpload, this, std::move(request)));
+}
+
+void DeviceFarmClient::GetUploadAsync(GetUploadRequest&& request, const GetUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::GetUploadAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::GetUploadAsyncHelper(const GetUploadRequest& request, const GetUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetUpload(request), context);
@@ -803,7 +1013,7 @@ InstallToRemoteAccessSessionOutcome DeviceFarmClient::InstallToRemoteAccessSessi
 
 InstallToRemoteAccessSessionOutcomeCallable DeviceFarmClient::InstallToRemoteAccessSessionCallable(const InstallToRemoteAccessSessionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->InstallToRemoteAccessSession(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->InstallToRemoteAccessSession(request); } );
 }
 
 void DeviceFarmClient::InstallToRemoteAccessSessionAsync(const InstallToRemoteAccessSessionRequest& request, const InstallToRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -811,6 +1021,16 @@ void DeviceFarmClient::InstallToRemoteAccessSessionAsync(const InstallToRemoteAc
   m_executor->Submit( [this, request, handler, context](){ this->InstallToRemoteAccessSessionAsyncHelper( request, handler, context ); } );
 }
 
+InstallToRemoteAccessSessionOutcomeCallable DeviceFarmClient::InstallToRemoteAccessSessionCallable(InstallToRemoteAccessSessionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::InstallToRemoteAccessSession, this, std::move(request)));
+}
+
+void DeviceFarmClient::InstallToRemoteAccessSessionAsync(InstallToRemoteAccessSessionRequest&& request, const InstallToRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::InstallToRemoteAccessSessionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::InstallToRemoteAccessSessionAsyncHelper(const InstallToRemoteAccessSessionRequest& request, const InstallToRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, InstallToRemoteAccessSession(request), context);
@@ -834,7 +1054,7 @@ ListArtifactsOutcome DeviceFarmClient::ListArtifacts(const ListArtifactsRequest&
 
 ListArtifactsOutcomeCallable DeviceFarmClient::ListArtifactsCallable(const ListArtifactsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListArtifacts(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListArtifacts(request); } );
 }
 
 void DeviceFarmClient::ListArtifactsAsync(const ListArtifactsRequest& request, const ListArtifactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -842,6 +1062,16 @@ void DeviceFarmClient::ListArtifactsAsync(const ListArtifactsRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->ListArtifactsAsyncHelper( request, handler, context ); } );
 }
 
+ListArtifactsOutcomeCallable DeviceFarmClient::ListArtifactsCallable(ListArtifactsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::ListArtifacts, this, std::move(request)));
+}
+
+void DeviceFarmClient::ListArtifactsAsync(ListArtifactsRequest&& request, const ListArtifactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::ListArtifactsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::ListArtifactsAsyncHelper(const ListArtifactsRequest& request, const ListArtifactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListArtifacts(request), context);
@@ -865,7 +1095,7 @@ ListDevicePoolsOutcome DeviceFarmClient::ListDevicePools(const ListDevicePoolsRe
 
 ListDevicePoolsOutcomeCallable DeviceFarmClient::ListDevicePoolsCallable(const ListDevicePoolsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDevicePools(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDevicePools(request); } );
 }
 
 void DeviceFarmClient::ListDevicePoolsAsync(const ListDevicePoolsRequest& request, const ListDevicePoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -873,6 +1103,16 @@ void DeviceFarmClient::ListDevicePoolsAsync(const ListDevicePoolsRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->ListDevicePoolsAsyncHelper( request, handler, context ); } );
 }
 
+ListDevicePoolsOutcomeCallable DeviceFarmClient::ListDevicePoolsCallable(ListDevicePoolsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::ListDevicePools, this, std::move(request)));
+}
+
+void DeviceFarmClient::ListDevicePoolsAsync(ListDevicePoolsRequest&& request, const ListDevicePoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::ListDevicePoolsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::ListDevicePoolsAsyncHelper(const ListDevicePoolsRequest& request, const ListDevicePoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDevicePools(request), context);
@@ -896,7 +1136,7 @@ ListDevicesOutcome DeviceFarmClient::ListDevices(const ListDevicesRequest& reque
 
 ListDevicesOutcomeCallable DeviceFarmClient::ListDevicesCallable(const ListDevicesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDevices(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDevices(request); } );
 }
 
 void DeviceFarmClient::ListDevicesAsync(const ListDevicesRequest& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -904,6 +1144,16 @@ void DeviceFarmClient::ListDevicesAsync(const ListDevicesRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ListDevicesAsyncHelper( request, handler, context ); } );
 }
 
+ListDevicesOutcomeCallable DeviceFarmClient::ListDevicesCallable(ListDevicesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::ListDevices, this, std::move(request)));
+}
+
+void DeviceFarmClient::ListDevicesAsync(ListDevicesRequest&& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::ListDevicesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::ListDevicesAsyncHelper(const ListDevicesRequest& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDevices(request), context);
@@ -927,7 +1177,7 @@ ListJobsOutcome DeviceFarmClient::ListJobs(const ListJobsRequest& request) const
 
 ListJobsOutcomeCallable DeviceFarmClient::ListJobsCallable(const ListJobsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListJobs(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListJobs(request); } );
 }
 
 void DeviceFarmClient::ListJobsAsync(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -935,6 +1185,16 @@ void DeviceFarmClient::ListJobsAsync(const ListJobsRequest& request, const ListJ
   m_executor->Submit( [this, request, handler, context](){ this->ListJobsAsyncHelper( request, handler, context ); } );
 }
 
+ListJobsOutcomeCallable DeviceFarmClient::ListJobsCallable(ListJobsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::ListJobs, this, std::move(request)));
+}
+
+void DeviceFarmClient::ListJobsAsync(ListJobsRequest&& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::ListJobsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::ListJobsAsyncHelper(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListJobs(request), context);
@@ -958,7 +1218,7 @@ ListOfferingTransactionsOutcome DeviceFarmClient::ListOfferingTransactions(const
 
 ListOfferingTransactionsOutcomeCallable DeviceFarmClient::ListOfferingTransactionsCallable(const ListOfferingTransactionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListOfferingTransactions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListOfferingTransactions(request); } );
 }
 
 void DeviceFarmClient::ListOfferingTransactionsAsync(const ListOfferingTransactionsRequest& request, const ListOfferingTransactionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -966,6 +1226,16 @@ void DeviceFarmClient::ListOfferingTransactionsAsync(const ListOfferingTransacti
   m_executor->Submit( [this, request, handler, context](){ this->ListOfferingTransactionsAsyncHelper( request, handler, context ); } );
 }
 
+ListOfferingTransactionsOutcomeCallable DeviceFarmClient::ListOfferingTransactionsCallable(ListOfferingTransactionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::ListOfferingTransactions, this, std::move(request)));
+}
+
+void DeviceFarmClient::ListOfferingTransactionsAsync(ListOfferingTransactionsRequest&& request, const ListOfferingTransactionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::ListOfferingTransactionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::ListOfferingTransactionsAsyncHelper(const ListOfferingTransactionsRequest& request, const ListOfferingTransactionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListOfferingTransactions(request), context);
@@ -989,7 +1259,7 @@ ListOfferingsOutcome DeviceFarmClient::ListOfferings(const ListOfferingsRequest&
 
 ListOfferingsOutcomeCallable DeviceFarmClient::ListOfferingsCallable(const ListOfferingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListOfferings(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListOfferings(request); } );
 }
 
 void DeviceFarmClient::ListOfferingsAsync(const ListOfferingsRequest& request, const ListOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -997,6 +1267,16 @@ void DeviceFarmClient::ListOfferingsAsync(const ListOfferingsRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->ListOfferingsAsyncHelper( request, handler, context ); } );
 }
 
+ListOfferingsOutcomeCallable DeviceFarmClient::ListOfferingsCallable(ListOfferingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::ListOfferings, this, std::move(request)));
+}
+
+void DeviceFarmClient::ListOfferingsAsync(ListOfferingsRequest&& request, const ListOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::ListOfferingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::ListOfferingsAsyncHelper(const ListOfferingsRequest& request, const ListOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListOfferings(request), context);
@@ -1020,7 +1300,7 @@ ListProjectsOutcome DeviceFarmClient::ListProjects(const ListProjectsRequest& re
 
 ListProjectsOutcomeCallable DeviceFarmClient::ListProjectsCallable(const ListProjectsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListProjects(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListProjects(request); } );
 }
 
 void DeviceFarmClient::ListProjectsAsync(const ListProjectsRequest& request, const ListProjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1028,6 +1308,16 @@ void DeviceFarmClient::ListProjectsAsync(const ListProjectsRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->ListProjectsAsyncHelper( request, handler, context ); } );
 }
 
+ListProjectsOutcomeCallable DeviceFarmClient::ListProjectsCallable(ListProjectsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::ListProjects, this, std::move(request)));
+}
+
+void DeviceFarmClient::ListProjectsAsync(ListProjectsRequest&& request, const ListProjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::ListProjectsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::ListProjectsAsyncHelper(const ListProjectsRequest& request, const ListProjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListProjects(request), context);
@@ -1051,7 +1341,7 @@ ListRemoteAccessSessionsOutcome DeviceFarmClient::ListRemoteAccessSessions(const
 
 ListRemoteAccessSessionsOutcomeCallable DeviceFarmClient::ListRemoteAccessSessionsCallable(const ListRemoteAccessSessionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListRemoteAccessSessions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListRemoteAccessSessions(request); } );
 }
 
 void DeviceFarmClient::ListRemoteAccessSessionsAsync(const ListRemoteAccessSessionsRequest& request, const ListRemoteAccessSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1059,6 +1349,16 @@ void DeviceFarmClient::ListRemoteAccessSessionsAsync(const ListRemoteAccessSessi
   m_executor->Submit( [this, request, handler, context](){ this->ListRemoteAccessSessionsAsyncHelper( request, handler, context ); } );
 }
 
+ListRemoteAccessSessionsOutcomeCallable DeviceFarmClient::ListRemoteAccessSessionsCallable(ListRemoteAccessSessionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::ListRemoteAccessSessions, this, std::move(request)));
+}
+
+void DeviceFarmClient::ListRemoteAccessSessionsAsync(ListRemoteAccessSessionsRequest&& request, const ListRemoteAccessSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::ListRemoteAccessSessionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::ListRemoteAccessSessionsAsyncHelper(const ListRemoteAccessSessionsRequest& request, const ListRemoteAccessSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListRemoteAccessSessions(request), context);
@@ -1082,7 +1382,7 @@ ListRunsOutcome DeviceFarmClient::ListRuns(const ListRunsRequest& request) const
 
 ListRunsOutcomeCallable DeviceFarmClient::ListRunsCallable(const ListRunsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListRuns(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListRuns(request); } );
 }
 
 void DeviceFarmClient::ListRunsAsync(const ListRunsRequest& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1090,6 +1390,16 @@ void DeviceFarmClient::ListRunsAsync(const ListRunsRequest& request, const ListR
   m_executor->Submit( [this, request, handler, context](){ this->ListRunsAsyncHelper( request, handler, context ); } );
 }
 
+ListRunsOutcomeCallable DeviceFarmClient::ListRunsCallable(ListRunsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::ListRuns, this, std::move(request)));
+}
+
+void DeviceFarmClient::ListRunsAsync(ListRunsRequest&& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::ListRunsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::ListRunsAsyncHelper(const ListRunsRequest& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListRuns(request), context);
@@ -1113,7 +1423,7 @@ ListSamplesOutcome DeviceFarmClient::ListSamples(const ListSamplesRequest& reque
 
 ListSamplesOutcomeCallable DeviceFarmClient::ListSamplesCallable(const ListSamplesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListSamples(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListSamples(request); } );
 }
 
 void DeviceFarmClient::ListSamplesAsync(const ListSamplesRequest& request, const ListSamplesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1121,6 +1431,16 @@ void DeviceFarmClient::ListSamplesAsync(const ListSamplesRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ListSamplesAsyncHelper( request, handler, context ); } );
 }
 
+ListSamplesOutcomeCallable DeviceFarmClient::ListSamplesCallable(ListSamplesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::ListSamples, this, std::move(request)));
+}
+
+void DeviceFarmClient::ListSamplesAsync(ListSamplesRequest&& request, const ListSamplesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::ListSamplesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::ListSamplesAsyncHelper(const ListSamplesRequest& request, const ListSamplesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListSamples(request), context);
@@ -1144,7 +1464,7 @@ ListSuitesOutcome DeviceFarmClient::ListSuites(const ListSuitesRequest& request)
 
 ListSuitesOutcomeCallable DeviceFarmClient::ListSuitesCallable(const ListSuitesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListSuites(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListSuites(request); } );
 }
 
 void DeviceFarmClient::ListSuitesAsync(const ListSuitesRequest& request, const ListSuitesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1152,6 +1472,16 @@ void DeviceFarmClient::ListSuitesAsync(const ListSuitesRequest& request, const L
   m_executor->Submit( [this, request, handler, context](){ this->ListSuitesAsyncHelper( request, handler, context ); } );
 }
 
+ListSuitesOutcomeCallable DeviceFarmClient::ListSuitesCallable(ListSuitesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::ListSuites, this, std::move(request)));
+}
+
+void DeviceFarmClient::ListSuitesAsync(ListSuitesRequest&& request, const ListSuitesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::ListSuitesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::ListSuitesAsyncHelper(const ListSuitesRequest& request, const ListSuitesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListSuites(request), context);
@@ -1175,7 +1505,7 @@ ListTestsOutcome DeviceFarmClient::ListTests(const ListTestsRequest& request) co
 
 ListTestsOutcomeCallable DeviceFarmClient::ListTestsCallable(const ListTestsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTests(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTests(request); } );
 }
 
 void DeviceFarmClient::ListTestsAsync(const ListTestsRequest& request, const ListTestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1183,6 +1513,16 @@ void DeviceFarmClient::ListTestsAsync(const ListTestsRequest& request, const Lis
   m_executor->Submit( [this, request, handler, context](){ this->ListTestsAsyncHelper( request, handler, context ); } );
 }
 
+ListTestsOutcomeCallable DeviceFarmClient::ListTestsCallable(ListTestsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::ListTests, this, std::move(request)));
+}
+
+void DeviceFarmClient::ListTestsAsync(ListTestsRequest&& request, const ListTestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::ListTestsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::ListTestsAsyncHelper(const ListTestsRequest& request, const ListTestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTests(request), context);
@@ -1206,7 +1546,7 @@ ListUniqueProblemsOutcome DeviceFarmClient::ListUniqueProblems(const ListUniqueP
 
 ListUniqueProblemsOutcomeCallable DeviceFarmClient::ListUniqueProblemsCallable(const ListUniqueProblemsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListUniqueProblems(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListUniqueProblems(request); } );
 }
 
 void DeviceFarmClient::ListUniqueProblemsAsync(const ListUniqueProblemsRequest& request, const ListUniqueProblemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1214,6 +1554,16 @@ void DeviceFarmClient::ListUniqueProblemsAsync(const ListUniqueProblemsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ListUniqueProblemsAsyncHelper( request, handler, context ); } );
 }
 
+ListUniqueProblemsOutcomeCallable DeviceFarmClient::ListUniqueProblemsCallable(ListUniqueProblemsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::ListUniqueProblems, this, std::move(request)));
+}
+
+void DeviceFarmClient::ListUniqueProblemsAsync(ListUniqueProblemsRequest&& request, const ListUniqueProblemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::ListUniqueProblemsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::ListUniqueProblemsAsyncHelper(const ListUniqueProblemsRequest& request, const ListUniqueProblemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListUniqueProblems(request), context);
@@ -1237,7 +1587,7 @@ ListUploadsOutcome DeviceFarmClient::ListUploads(const ListUploadsRequest& reque
 
 ListUploadsOutcomeCallable DeviceFarmClient::ListUploadsCallable(const ListUploadsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListUploads(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListUploads(request); } );
 }
 
 void DeviceFarmClient::ListUploadsAsync(const ListUploadsRequest& request, const ListUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1245,6 +1595,16 @@ void DeviceFarmClient::ListUploadsAsync(const ListUploadsRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ListUploadsAsyncHelper( request, handler, context ); } );
 }
 
+ListUploadsOutcomeCallable DeviceFarmClient::ListUploadsCallable(ListUploadsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::ListUploads, this, std::move(request)));
+}
+
+void DeviceFarmClient::ListUploadsAsync(ListUploadsRequest&& request, const ListUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::ListUploadsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::ListUploadsAsyncHelper(const ListUploadsRequest& request, const ListUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListUploads(request), context);
@@ -1268,7 +1628,7 @@ PurchaseOfferingOutcome DeviceFarmClient::PurchaseOffering(const PurchaseOfferin
 
 PurchaseOfferingOutcomeCallable DeviceFarmClient::PurchaseOfferingCallable(const PurchaseOfferingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PurchaseOffering(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PurchaseOffering(request); } );
 }
 
 void DeviceFarmClient::PurchaseOfferingAsync(const PurchaseOfferingRequest& request, const PurchaseOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1276,6 +1636,16 @@ void DeviceFarmClient::PurchaseOfferingAsync(const PurchaseOfferingRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->PurchaseOfferingAsyncHelper( request, handler, context ); } );
 }
 
+PurchaseOfferingOutcomeCallable DeviceFarmClient::PurchaseOfferingCallable(PurchaseOfferingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::PurchaseOffering, this, std::move(request)));
+}
+
+void DeviceFarmClient::PurchaseOfferingAsync(PurchaseOfferingRequest&& request, const PurchaseOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::PurchaseOfferingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::PurchaseOfferingAsyncHelper(const PurchaseOfferingRequest& request, const PurchaseOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PurchaseOffering(request), context);
@@ -1299,7 +1669,7 @@ RenewOfferingOutcome DeviceFarmClient::RenewOffering(const RenewOfferingRequest&
 
 RenewOfferingOutcomeCallable DeviceFarmClient::RenewOfferingCallable(const RenewOfferingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RenewOffering(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RenewOffering(request); } );
 }
 
 void DeviceFarmClient::RenewOfferingAsync(const RenewOfferingRequest& request, const RenewOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1307,6 +1677,16 @@ void DeviceFarmClient::RenewOfferingAsync(const RenewOfferingRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->RenewOfferingAsyncHelper( request, handler, context ); } );
 }
 
+RenewOfferingOutcomeCallable DeviceFarmClient::RenewOfferingCallable(RenewOfferingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::RenewOffering, this, std::move(request)));
+}
+
+void DeviceFarmClient::RenewOfferingAsync(RenewOfferingRequest&& request, const RenewOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::RenewOfferingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::RenewOfferingAsyncHelper(const RenewOfferingRequest& request, const RenewOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RenewOffering(request), context);
@@ -1330,7 +1710,7 @@ ScheduleRunOutcome DeviceFarmClient::ScheduleRun(const ScheduleRunRequest& reque
 
 ScheduleRunOutcomeCallable DeviceFarmClient::ScheduleRunCallable(const ScheduleRunRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ScheduleRun(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ScheduleRun(request); } );
 }
 
 void DeviceFarmClient::ScheduleRunAsync(const ScheduleRunRequest& request, const ScheduleRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1338,6 +1718,16 @@ void DeviceFarmClient::ScheduleRunAsync(const ScheduleRunRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ScheduleRunAsyncHelper( request, handler, context ); } );
 }
 
+ScheduleRunOutcomeCallable DeviceFarmClient::ScheduleRunCallable(ScheduleRunRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::ScheduleRun, this, std::move(request)));
+}
+
+void DeviceFarmClient::ScheduleRunAsync(ScheduleRunRequest&& request, const ScheduleRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::ScheduleRunAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::ScheduleRunAsyncHelper(const ScheduleRunRequest& request, const ScheduleRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ScheduleRun(request), context);
@@ -1361,7 +1751,7 @@ StopRemoteAccessSessionOutcome DeviceFarmClient::StopRemoteAccessSession(const S
 
 StopRemoteAccessSessionOutcomeCallable DeviceFarmClient::StopRemoteAccessSessionCallable(const StopRemoteAccessSessionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StopRemoteAccessSession(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StopRemoteAccessSession(request); } );
 }
 
 void DeviceFarmClient::StopRemoteAccessSessionAsync(const StopRemoteAccessSessionRequest& request, const StopRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1369,6 +1759,16 @@ void DeviceFarmClient::StopRemoteAccessSessionAsync(const StopRemoteAccessSessio
   m_executor->Submit( [this, request, handler, context](){ this->StopRemoteAccessSessionAsyncHelper( request, handler, context ); } );
 }
 
+StopRemoteAccessSessionOutcomeCallable DeviceFarmClient::StopRemoteAccessSessionCallable(StopRemoteAccessSessionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::StopRemoteAccessSession, this, std::move(request)));
+}
+
+void DeviceFarmClient::StopRemoteAccessSessionAsync(StopRemoteAccessSessionRequest&& request, const StopRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::StopRemoteAccessSessionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::StopRemoteAccessSessionAsyncHelper(const StopRemoteAccessSessionRequest& request, const StopRemoteAccessSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StopRemoteAccessSession(request), context);
@@ -1392,7 +1792,7 @@ StopRunOutcome DeviceFarmClient::StopRun(const StopRunRequest& request) const
 
 StopRunOutcomeCallable DeviceFarmClient::StopRunCallable(const StopRunRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StopRun(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StopRun(request); } );
 }
 
 void DeviceFarmClient::StopRunAsync(const StopRunRequest& request, const StopRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1400,6 +1800,16 @@ void DeviceFarmClient::StopRunAsync(const StopRunRequest& request, const StopRun
   m_executor->Submit( [this, request, handler, context](){ this->StopRunAsyncHelper( request, handler, context ); } );
 }
 
+StopRunOutcomeCallable DeviceFarmClient::StopRunCallable(StopRunRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::StopRun, this, std::move(request)));
+}
+
+void DeviceFarmClient::StopRunAsync(StopRunRequest&& request, const StopRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::StopRunAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::StopRunAsyncHelper(const StopRunRequest& request, const StopRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StopRun(request), context);
@@ -1423,7 +1833,7 @@ UpdateDevicePoolOutcome DeviceFarmClient::UpdateDevicePool(const UpdateDevicePoo
 
 UpdateDevicePoolOutcomeCallable DeviceFarmClient::UpdateDevicePoolCallable(const UpdateDevicePoolRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateDevicePool(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateDevicePool(request); } );
 }
 
 void DeviceFarmClient::UpdateDevicePoolAsync(const UpdateDevicePoolRequest& request, const UpdateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1431,6 +1841,16 @@ void DeviceFarmClient::UpdateDevicePoolAsync(const UpdateDevicePoolRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->UpdateDevicePoolAsyncHelper( request, handler, context ); } );
 }
 
+UpdateDevicePoolOutcomeCallable DeviceFarmClient::UpdateDevicePoolCallable(UpdateDevicePoolRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::UpdateDevicePool, this, std::move(request)));
+}
+
+void DeviceFarmClient::UpdateDevicePoolAsync(UpdateDevicePoolRequest&& request, const UpdateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::UpdateDevicePoolAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::UpdateDevicePoolAsyncHelper(const UpdateDevicePoolRequest& request, const UpdateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateDevicePool(request), context);
@@ -1454,7 +1874,7 @@ UpdateProjectOutcome DeviceFarmClient::UpdateProject(const UpdateProjectRequest&
 
 UpdateProjectOutcomeCallable DeviceFarmClient::UpdateProjectCallable(const UpdateProjectRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateProject(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateProject(request); } );
 }
 
 void DeviceFarmClient::UpdateProjectAsync(const UpdateProjectRequest& request, const UpdateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1462,8 +1882,490 @@ void DeviceFarmClient::UpdateProjectAsync(const UpdateProjectRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->UpdateProjectAsyncHelper( request, handler, context ); } );
 }
 
+UpdateProjectOutcomeCallable DeviceFarmClient::UpdateProjectCallable(UpdateProjectRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DeviceFarmClient::UpdateProject, this, std::move(request)));
+}
+
+void DeviceFarmClient::UpdateProjectAsync(UpdateProjectRequest&& request, const UpdateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DeviceFarmClient::UpdateProjectAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DeviceFarmClient::UpdateProjectAsyncHelper(const UpdateProjectRequest& request, const UpdateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateProject(request), context);
 }
 
+Paginator<DeviceFarmClient, GetOfferingStatusRequest, GetOfferingStatusOutcome> DeviceFarmClient::GetOfferingStatusPaginator(const GetOfferingStatusRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DeviceFarmClient, GetOfferingStatusRequest, GetOfferingStatusOutcome>(this, &DeviceFarmClient::GetOfferingStatus, request,
+    [](const GetOfferingStatusRequest& current, const GetOfferingStatusOutcome& outcome, GetOfferingStatusRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DeviceFarmClient, ListArtifactsRequest, ListArtifactsOutcome> DeviceFarmClient::ListArtifactsPaginator(const ListArtifactsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DeviceFarmClient, ListArtifactsRequest, ListArtifactsOutcome>(this, &DeviceFarmClient::ListArtifacts, request,
+    [](const ListArtifactsRequest& current, const ListArtifactsOutcome& outcome, ListArtifactsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DeviceFarmClient, ListDevicePoolsRequest, ListDevicePoolsOutcome> DeviceFarmClient::ListDevicePoolsPaginator(const ListDevicePoolsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DeviceFarmClient, ListDevicePoolsRequest, ListDevicePoolsOutcome>(this, &DeviceFarmClient::ListDevicePools, request,
+    [](const ListDevicePoolsRequest& current, const ListDevicePoolsOutcome& outcome, ListDevicePoolsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DeviceFarmClient, ListDevicesRequest, ListDevicesOutcome> DeviceFarmClient::ListDevicesPaginator(const ListDevicesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DeviceFarmClient, ListDevicesRequest, ListDevicesOutcome>(this, &DeviceFarmClient::ListDevices, request,
+    [](const ListDevicesRequest& current, const ListDevicesOutcome& outcome, ListDevicesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DeviceFarmClient, ListJobsRequest, ListJobsOutcome> DeviceFarmClient::ListJobsPaginator(const ListJobsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DeviceFarmClient, ListJobsRequest, ListJobsOutcome>(this, &DeviceFarmClient::ListJobs, request,
+    [](const ListJobsRequest& current, const ListJobsOutcome& outcome, ListJobsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DeviceFarmClient, ListOfferingTransactionsRequest, ListOfferingTransactionsOutcome> DeviceFarmClient::ListOfferingTransactionsPaginator(const ListOfferingTransactionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DeviceFarmClient, ListOfferingTransactionsRequest, ListOfferingTransactionsOutcome>(this, &DeviceFarmClient::ListOfferingTransactions, request,
+    [](const ListOfferingTransactionsRequest& current, const ListOfferingTransactionsOutcome& outcome, ListOfferingTransactionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DeviceFarmClient, ListOfferingsRequest, ListOfferingsOutcome> DeviceFarmClient::ListOfferingsPaginator(const ListOfferingsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DeviceFarmClient, ListOfferingsRequest, ListOfferingsOutcome>(this, &DeviceFarmClient::ListOfferings, request,
+    [](const ListOfferingsRequest& current, const ListOfferingsOutcome& outcome, ListOfferingsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DeviceFarmClient, ListProjectsRequest, ListProjectsOutcome> DeviceFarmClient::ListProjectsPaginator(const ListProjectsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DeviceFarmClient, ListProjectsRequest, ListProjectsOutcome>(this, &DeviceFarmClient::ListProjects, request,
+    [](const ListProjectsRequest& current, const ListProjectsOutcome& outcome, ListProjectsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DeviceFarmClient, ListRemoteAccessSessionsRequest, ListRemoteAccessSessionsOutcome> DeviceFarmClient::ListRemoteAccessSessionsPaginator(const ListRemoteAccessSessionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DeviceFarmClient, ListRemoteAccessSessionsRequest, ListRemoteAccessSessionsOutcome>(this, &DeviceFarmClient::ListRemoteAccessSessions, request,
+    [](const ListRemoteAccessSessionsRequest& current, const ListRemoteAccessSessionsOutcome& outcome, ListRemoteAccessSessionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DeviceFarmClient, ListRunsRequest, ListRunsOutcome> DeviceFarmClient::ListRunsPaginator(const ListRunsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DeviceFarmClient, ListRunsRequest, ListRunsOutcome>(this, &DeviceFarmClient::ListRuns, request,
+    [](const ListRunsRequest& current, const ListRunsOutcome& outcome, ListRunsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DeviceFarmClient, ListSamplesRequest, ListSamplesOutcome> DeviceFarmClient::ListSamplesPaginator(const ListSamplesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DeviceFarmClient, ListSamplesRequest, ListSamplesOutcome>(this, &DeviceFarmClient::ListSamples, request,
+    [](const ListSamplesRequest& current, const ListSamplesOutcome& outcome, ListSamplesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DeviceFarmClient, ListSuitesRequest, ListSuitesOutcome> DeviceFarmClient::ListSuitesPaginator(const ListSuitesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DeviceFarmClient, ListSuitesRequest, ListSuitesOutcome>(this, &DeviceFarmClient::ListSuites, request,
+    [](const ListSuitesRequest& current, const ListSuitesOutcome& outcome, ListSuitesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DeviceFarmClient, ListTestsRequest, ListTestsOutcome> DeviceFarmClient::ListTestsPaginator(const ListTestsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DeviceFarmClient, ListTestsRequest, ListTestsOutcome>(this, &DeviceFarmClient::ListTests, request,
+    [](const ListTestsRequest& current, const ListTestsOutcome& outcome, ListTestsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DeviceFarmClient, ListUniqueProblemsRequest, ListUniqueProblemsOutcome> DeviceFarmClient::ListUniqueProblemsPaginator(const ListUniqueProblemsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DeviceFarmClient, ListUniqueProblemsRequest, ListUniqueProblemsOutcome>(this, &DeviceFarmClient::ListUniqueProblems, request,
+    [](const ListUniqueProblemsRequest& current, const ListUniqueProblemsOutcome& outcome, ListUniqueProblemsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DeviceFarmClient, ListUploadsRequest, ListUploadsOutcome> DeviceFarmClient::ListUploadsPaginator(const ListUploadsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DeviceFarmClient, ListUploadsRequest, ListUploadsOutcome>(this, &DeviceFarmClient::ListUploads, request,
+    [](const ListUploadsRequest& current, const ListUploadsOutcome& outcome, ListUploadsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<DeviceFarmClient, CreateDevicePoolRequest, CreateDevicePoolOutcome> DeviceFarmClient::CreateDevicePoolAwaitable(CreateDevicePoolRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::CreateDevicePool, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, CreateProjectRequest, CreateProjectOutcome> DeviceFarmClient::CreateProjectAwaitable(CreateProjectRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::CreateProject, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, CreateRemoteAccessSessionRequest, CreateRemoteAccessSessionOutcome> DeviceFarmClient::CreateRemoteAccessSessionAwaitable(CreateRemoteAccessSessionRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::CreateRemoteAccessSession, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, CreateUploadRequest, CreateUploadOutcome> DeviceFarmClient::CreateUploadAwaitable(CreateUploadRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::CreateUpload, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, DeleteDevicePoolRequest, DeleteDevicePoolOutcome> DeviceFarmClient::DeleteDevicePoolAwaitable(DeleteDevicePoolRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::DeleteDevicePool, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, DeleteProjectRequest, DeleteProjectOutcome> DeviceFarmClient::DeleteProjectAwaitable(DeleteProjectRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::DeleteProject, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, DeleteRemoteAccessSessionRequest, DeleteRemoteAccessSessionOutcome> DeviceFarmClient::DeleteRemoteAccessSessionAwaitable(DeleteRemoteAccessSessionRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::DeleteRemoteAccessSession, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, DeleteRunRequest, DeleteRunOutcome> DeviceFarmClient::DeleteRunAwaitable(DeleteRunRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::DeleteRun, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, DeleteUploadRequest, DeleteUploadOutcome> DeviceFarmClient::DeleteUploadAwaitable(DeleteUploadRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::DeleteUpload, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, GetAccountSettingsRequest, GetAccountSettingsOutcome> DeviceFarmClient::GetAccountSettingsAwaitable(GetAccountSettingsRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::GetAccountSettings, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, GetDeviceRequest, GetDeviceOutcome> DeviceFarmClient::GetDeviceAwaitable(GetDeviceRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::GetDevice, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, GetDevicePoolRequest, GetDevicePoolOutcome> DeviceFarmClient::GetDevicePoolAwaitable(GetDevicePoolRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::GetDevicePool, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, GetDevicePoolCompatibilityRequest, GetDevicePoolCompatibilityOutcome> DeviceFarmClient::GetDevicePoolCompatibilityAwaitable(GetDevicePoolCompatibilityRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::GetDevicePoolCompatibility, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, GetJobRequest, GetJobOutcome> DeviceFarmClient::GetJobAwaitable(GetJobRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::GetJob, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, GetOfferingStatusRequest, GetOfferingStatusOutcome> DeviceFarmClient::GetOfferingStatusAwaitable(GetOfferingStatusRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::GetOfferingStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, GetProjectRequest, GetProjectOutcome> DeviceFarmClient::GetProjectAwaitable(GetProjectRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::GetProject, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, GetRemoteAccessSessionRequest, GetRemoteAccessSessionOutcome> DeviceFarmClient::GetRemoteAccessSessionAwaitable(GetRemoteAccessSessionRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::GetRemoteAccessSession, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, GetRunRequest, GetRunOutcome> DeviceFarmClient::GetRunAwaitable(GetRunRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::GetRun, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, GetSuiteRequest, GetSuiteOutcome> DeviceFarmClient::GetSuiteAwaitable(GetSuiteRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::GetSuite, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, GetTestRequest, GetTestOutcome> DeviceFarmClient::GetTestAwaitable(GetTestRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::GetTest, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, GetUploadRequest, GetUploadOutcome> DeviceFarmClient::GetUploadAwaitable(GetUploadRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::GetUpload, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, InstallToRemoteAccessSessionRequest, InstallToRemoteAccessSessionOutcome> DeviceFarmClient::InstallToRemoteAccessSessionAwaitable(InstallToRemoteAccessSessionRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::InstallToRemoteAccessSession, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, ListArtifactsRequest, ListArtifactsOutcome> DeviceFarmClient::ListArtifactsAwaitable(ListArtifactsRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::ListArtifacts, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, ListDevicePoolsRequest, ListDevicePoolsOutcome> DeviceFarmClient::ListDevicePoolsAwaitable(ListDevicePoolsRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::ListDevicePools, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, ListDevicesRequest, ListDevicesOutcome> DeviceFarmClient::ListDevicesAwaitable(ListDevicesRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::ListDevices, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, ListJobsRequest, ListJobsOutcome> DeviceFarmClient::ListJobsAwaitable(ListJobsRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::ListJobs, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, ListOfferingTransactionsRequest, ListOfferingTransactionsOutcome> DeviceFarmClient::ListOfferingTransactionsAwaitable(ListOfferingTransactionsRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::ListOfferingTransactions, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, ListOfferingsRequest, ListOfferingsOutcome> DeviceFarmClient::ListOfferingsAwaitable(ListOfferingsRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::ListOfferings, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, ListProjectsRequest, ListProjectsOutcome> DeviceFarmClient::ListProjectsAwaitable(ListProjectsRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::ListProjects, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, ListRemoteAccessSessionsRequest, ListRemoteAccessSessionsOutcome> DeviceFarmClient::ListRemoteAccessSessionsAwaitable(ListRemoteAccessSessionsRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::ListRemoteAccessSessions, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, ListRunsRequest, ListRunsOutcome> DeviceFarmClient::ListRunsAwaitable(ListRunsRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::ListRuns, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, ListSamplesRequest, ListSamplesOutcome> DeviceFarmClient::ListSamplesAwaitable(ListSamplesRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::ListSamples, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, ListSuitesRequest, ListSuitesOutcome> DeviceFarmClient::ListSuitesAwaitable(ListSuitesRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::ListSuites, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, ListTestsRequest, ListTestsOutcome> DeviceFarmClient::ListTestsAwaitable(ListTestsRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::ListTests, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, ListUniqueProblemsRequest, ListUniqueProblemsOutcome> DeviceFarmClient::ListUniqueProblemsAwaitable(ListUniqueProblemsRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::ListUniqueProblems, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, ListUploadsRequest, ListUploadsOutcome> DeviceFarmClient::ListUploadsAwaitable(ListUploadsRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::ListUploads, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, PurchaseOfferingRequest, PurchaseOfferingOutcome> DeviceFarmClient::PurchaseOfferingAwaitable(PurchaseOfferingRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::PurchaseOffering, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, RenewOfferingRequest, RenewOfferingOutcome> DeviceFarmClient::RenewOfferingAwaitable(RenewOfferingRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::RenewOffering, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, ScheduleRunRequest, ScheduleRunOutcome> DeviceFarmClient::ScheduleRunAwaitable(ScheduleRunRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::ScheduleRun, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, StopRemoteAccessSessionRequest, StopRemoteAccessSessionOutcome> DeviceFarmClient::StopRemoteAccessSessionAwaitable(StopRemoteAccessSessionRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::StopRemoteAccessSession, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, StopRunRequest, StopRunOutcome> DeviceFarmClient::StopRunAwaitable(StopRunRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::StopRun, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, UpdateDevicePoolRequest, UpdateDevicePoolOutcome> DeviceFarmClient::UpdateDevicePoolAwaitable(UpdateDevicePoolRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::UpdateDevicePool, std::move(request) } };
+}
+
+ClientOperationAwaitable<DeviceFarmClient, UpdateProjectRequest, UpdateProjectOutcome> DeviceFarmClient::UpdateProjectAwaitable(UpdateProjectRequest request) const
+{
+  return { m_executor.get(), { this, &DeviceFarmClient::UpdateProject, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,26 +29,32 @@ namespace Aws
       namespace ArtifactCategoryMapper
       {
 
-        static const int SCREENSHOT_HASH = HashingUtils::HashString("SCREENSHOT");
-        static const int FILE_HASH = HashingUtils::HashString("FILE");
-        static const int LOG_HASH = HashingUtils::HashString("LOG");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int SCREENSHOT_HASH = 68645222;
+        static const int FILE_HASH = 2157948;
+        static const int LOG_HASH = 75556;
 
 
         ArtifactCategory GetArtifactCategoryForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SCREENSHOT_HASH)
+          switch (hashCode)
           {
+          case SCREENSHOT_HASH:
             return ArtifactCategory::SCREENSHOT;
-          }
-          else if (hashCode == FILE_HASH)
-          {
+          case FILE_HASH:
             return ArtifactCategory::FILE;
-          }
-          else if (hashCode == LOG_HASH)
-          {
+          case LOG_HASH:
             return ArtifactCategory::LOG;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
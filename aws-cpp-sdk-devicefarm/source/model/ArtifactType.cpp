@@ -29,136 +29,98 @@ namespace Aws
       namespace ArtifactTypeMapper
       {
 
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-        static const int SCREENSHOT_HASH = HashingUtils::HashString("SCREENSHOT");
-        static const int DEVICE_LOG_HASH = HashingUtils::HashString("DEVICE_LOG");
-        static const int MESSAGE_LOG_HASH = HashingUtils::HashString("MESSAGE_LOG");
-        static const int VIDEO_LOG_HASH = HashingUtils::HashString("VIDEO_LOG");
-        static const int RESULT_LOG_HASH = HashingUtils::HashString("RESULT_LOG");
-        static const int SERVICE_LOG_HASH = HashingUtils::HashString("SERVICE_LOG");
-        static const int WEBKIT_LOG_HASH = HashingUtils::HashString("WEBKIT_LOG");
-        static const int INSTRUMENTATION_OUTPUT_HASH = HashingUtils::HashString("INSTRUMENTATION_OUTPUT");
-        static const int EXERCISER_MONKEY_OUTPUT_HASH = HashingUtils::HashString("EXERCISER_MONKEY_OUTPUT");
-        static const int CALABASH_JSON_OUTPUT_HASH = HashingUtils::HashString("CALABASH_JSON_OUTPUT");
-        static const int CALABASH_PRETTY_OUTPUT_HASH = HashingUtils::HashString("CALABASH_PRETTY_OUTPUT");
-        static const int CALABASH_STANDARD_OUTPUT_HASH = HashingUtils::HashString("CALABASH_STANDARD_OUTPUT");
-        static const int CALABASH_JAVA_XML_OUTPUT_HASH = HashingUtils::HashString("CALABASH_JAVA_XML_OUTPUT");
-        static const int AUTOMATION_OUTPUT_HASH = HashingUtils::HashString("AUTOMATION_OUTPUT");
-        static const int APPIUM_SERVER_OUTPUT_HASH = HashingUtils::HashString("APPIUM_SERVER_OUTPUT");
-        static const int APPIUM_JAVA_OUTPUT_HASH = HashingUtils::HashString("APPIUM_JAVA_OUTPUT");
-        static const int APPIUM_JAVA_XML_OUTPUT_HASH = HashingUtils::HashString("APPIUM_JAVA_XML_OUTPUT");
-        static const int APPIUM_PYTHON_OUTPUT_HASH = HashingUtils::HashString("APPIUM_PYTHON_OUTPUT");
-        static const int APPIUM_PYTHON_XML_OUTPUT_HASH = HashingUtils::HashString("APPIUM_PYTHON_XML_OUTPUT");
-        static const int EXPLORER_EVENT_LOG_HASH = HashingUtils::HashString("EXPLORER_EVENT_LOG");
-        static const int EXPLORER_SUMMARY_LOG_HASH = HashingUtils::HashString("EXPLORER_SUMMARY_LOG");
-        static const int APPLICATION_CRASH_REPORT_HASH = HashingUtils::HashString("APPLICATION_CRASH_REPORT");
-        static const int XCTEST_LOG_HASH = HashingUtils::HashString("XCTEST_LOG");
-        static const int VIDEO_HASH = HashingUtils::HashString("VIDEO");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int UNKNOWN_HASH = 433141802;
+        static const int SCREENSHOT_HASH = 68645222;
+        static const int DEVICE_LOG_HASH = 1267551675;
+        static const int MESSAGE_LOG_HASH = 1281136332;
+        static const int VIDEO_LOG_HASH = -174142144;
+        static const int RESULT_LOG_HASH = -85476350;
+        static const int SERVICE_LOG_HASH = 225859194;
+        static const int WEBKIT_LOG_HASH = -1002038169;
+        static const int INSTRUMENTATION_OUTPUT_HASH = -1179088110;
+        static const int EXERCISER_MONKEY_OUTPUT_HASH = -1882315544;
+        static const int CALABASH_JSON_OUTPUT_HASH = -1547207776;
+        static const int CALABASH_PRETTY_OUTPUT_HASH = 9981522;
+        static const int CALABASH_STANDARD_OUTPUT_HASH = -96627669;
+        static const int CALABASH_JAVA_XML_OUTPUT_HASH = 993412078;
+        static const int AUTOMATION_OUTPUT_HASH = 1515057449;
+        static const int APPIUM_SERVER_OUTPUT_HASH = -737629570;
+        static const int APPIUM_JAVA_OUTPUT_HASH = 1061080831;
+        static const int APPIUM_JAVA_XML_OUTPUT_HASH = -1710279353;
+        static const int APPIUM_PYTHON_OUTPUT_HASH = -1689429307;
+        static const int APPIUM_PYTHON_XML_OUTPUT_HASH = -255431155;
+        static const int EXPLORER_EVENT_LOG_HASH = 222774239;
+        static const int EXPLORER_SUMMARY_LOG_HASH = 1081710315;
+        static const int APPLICATION_CRASH_REPORT_HASH = -866688101;
+        static const int XCTEST_LOG_HASH = -1316558366;
+        static const int VIDEO_HASH = 81665115;
 
 
         ArtifactType GetArtifactTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNKNOWN_HASH)
+          switch (hashCode)
           {
+          case UNKNOWN_HASH:
             return ArtifactType::UNKNOWN;
-          }
-          else if (hashCode == SCREENSHOT_HASH)
-          {
+          case SCREENSHOT_HASH:
             return ArtifactType::SCREENSHOT;
-          }
-          else if (hashCode == DEVICE_LOG_HASH)
-          {
+          case DEVICE_LOG_HASH:
             return ArtifactType::DEVICE_LOG;
-          }
-          else if (hashCode == MESSAGE_LOG_HASH)
-          {
+          case MESSAGE_LOG_HASH:
             return ArtifactType::MESSAGE_LOG;
-          }
-          else if (hashCode == VIDEO_LOG_HASH)
-          {
+          case VIDEO_LOG_HASH:
             return ArtifactType::VIDEO_LOG;
-          }
-          else if (hashCode == RESULT_LOG_HASH)
-          {
+          case RESULT_LOG_HASH:
             return ArtifactType::RESULT_LOG;
-          }
-          else if (hashCode == SERVICE_LOG_HASH)
-          {
+          case SERVICE_LOG_HASH:
             return ArtifactType::SERVICE_LOG;
-          }
-          else if (hashCode == WEBKIT_LOG_HASH)
-          {
+          case WEBKIT_LOG_HASH:
             return ArtifactType::WEBKIT_LOG;
-          }
-          else if (hashCode == INSTRUMENTATION_OUTPUT_HASH)
-          {
+          case INSTRUMENTATION_OUTPUT_HASH:
             return ArtifactType::INSTRUMENTATION_OUTPUT;
-          }
-          else if (hashCode == EXERCISER_MONKEY_OUTPUT_HASH)
-          {
+          case EXERCISER_MONKEY_OUTPUT_HASH:
             return ArtifactType::EXERCISER_MONKEY_OUTPUT;
-          }
-          else if (hashCode == CALABASH_JSON_OUTPUT_HASH)
-          {
+          case CALABASH_JSON_OUTPUT_HASH:
             return ArtifactType::CALABASH_JSON_OUTPUT;
-          }
-          else if (hashCode == CALABASH_PRETTY_OUTPUT_HASH)
-          {
+          case CALABASH_PRETTY_OUTPUT_HASH:
             return ArtifactType::CALABASH_PRETTY_OUTPUT;
-          }
-          else if (hashCode == CALABASH_STANDARD_OUTPUT_HASH)
-          {
+          case CALABASH_STANDARD_OUTPUT_HASH:
             return ArtifactType::CALABASH_STANDARD_OUTPUT;
-          }
-          else if (hashCode == CALABASH_JAVA_XML_OUTPUT_HASH)
-          {
+          case CALABASH_JAVA_XML_OUTPUT_HASH:
             return ArtifactType::CALABASH_JAVA_XML_OUTPUT;
-          }
-          else if (hashCode == AUTOMATION_OUTPUT_HASH)
-          {
+          case AUTOMATION_OUTPUT_HASH:
             return ArtifactType::AUTOMATION_OUTPUT;
-          }
-          else if (hashCode == APPIUM_SERVER_OUTPUT_HASH)
-          {
+          case APPIUM_SERVER_OUTPUT_HASH:
             return ArtifactType::APPIUM_SERVER_OUTPUT;
-          }
-          else if (hashCode == APPIUM_JAVA_OUTPUT_HASH)
-          {
+          case APPIUM_JAVA_OUTPUT_HASH:
             return ArtifactType::APPIUM_JAVA_OUTPUT;
-          }
-          else if (hashCode == APPIUM_JAVA_XML_OUTPUT_HASH)
-          {
+          case APPIUM_JAVA_XML_OUTPUT_HASH:
             return ArtifactType::APPIUM_JAVA_XML_OUTPUT;
-          }
-          else if (hashCode == APPIUM_PYTHON_OUTPUT_HASH)
-          {
+          case APPIUM_PYTHON_OUTPUT_HASH:
             return ArtifactType::APPIUM_PYTHON_OUTPUT;
-          }
-          else if (hashCode == APPIUM_PYTHON_XML_OUTPUT_HASH)
-          {
+          case APPIUM_PYTHON_XML_OUTPUT_HASH:
             return ArtifactType::APPIUM_PYTHON_XML_OUTPUT;
-          }
-          else if (hashCode == EXPLORER_EVENT_LOG_HASH)
-          {
+          case EXPLORER_EVENT_LOG_HASH:
             return ArtifactType::EXPLORER_EVENT_LOG;
-          }
-          else if (hashCode == EXPLORER_SUMMARY_LOG_HASH)
-          {
+          case EXPLORER_SUMMARY_LOG_HASH:
             return ArtifactType::EXPLORER_SUMMARY_LOG;
-          }
-          else if (hashCode == APPLICATION_CRASH_REPORT_HASH)
-          {
+          case APPLICATION_CRASH_REPORT_HASH:
             return ArtifactType::APPLICATION_CRASH_REPORT;
-          }
-          else if (hashCode == XCTEST_LOG_HASH)
-          {
+          case XCTEST_LOG_HASH:
             return ArtifactType::XCTEST_LOG;
-          }
-          else if (hashCode == VIDEO_HASH)
-          {
+          case VIDEO_HASH:
             return ArtifactType::VIDEO;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace BillingMethodMapper
       {
 
-        static const int METERED_HASH = HashingUtils::HashString("METERED");
-        static const int UNMETERED_HASH = HashingUtils::HashString("UNMETERED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int METERED_HASH = 1673430472;
+        static const int UNMETERED_HASH = 1158876431;
 
 
         BillingMethod GetBillingMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == METERED_HASH)
+          switch (hashCode)
           {
+          case METERED_HASH:
             return BillingMethod::METERED;
-          }
-          else if (hashCode == UNMETERED_HASH)
-          {
+          case UNMETERED_HASH:
             return BillingMethod::UNMETERED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
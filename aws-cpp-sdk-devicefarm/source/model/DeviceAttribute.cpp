@@ -29,36 +29,38 @@ namespace Aws
       namespace DeviceAttributeMapper
       {
 
-        static const int ARN_HASH = HashingUtils::HashString("ARN");
-        static const int PLATFORM_HASH = HashingUtils::HashString("PLATFORM");
-        static const int FORM_FACTOR_HASH = HashingUtils::HashString("FORM_FACTOR");
-        static const int MANUFACTURER_HASH = HashingUtils::HashString("MANUFACTURER");
-        static const int REMOTE_ACCESS_ENABLED_HASH = HashingUtils::HashString("REMOTE_ACCESS_ENABLED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ARN_HASH = 65085;
+        static const int PLATFORM_HASH = -1637656461;
+        static const int FORM_FACTOR_HASH = -227557078;
+        static const int MANUFACTURER_HASH = 347933649;
+        static const int REMOTE_ACCESS_ENABLED_HASH = 562262111;
 
 
         DeviceAttribute GetDeviceAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ARN_HASH)
+          switch (hashCode)
           {
+          case ARN_HASH:
             return DeviceAttribute::ARN;
-          }
-          else if (hashCode == PLATFORM_HASH)
-          {
+          case PLATFORM_HASH:
             return DeviceAttribute::PLATFORM;
-          }
-          else if (hashCode == FORM_FACTOR_HASH)
-          {
+          case FORM_FACTOR_HASH:
             return DeviceAttribute::FORM_FACTOR;
-          }
-          else if (hashCode == MANUFACTURER_HASH)
-          {
+          case MANUFACTURER_HASH:
             return DeviceAttribute::MANUFACTURER;
-          }
-          else if (hashCode == REMOTE_ACCESS_ENABLED_HASH)
-          {
+          case REMOTE_ACCESS_ENABLED_HASH:
             return DeviceAttribute::REMOTE_ACCESS_ENABLED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
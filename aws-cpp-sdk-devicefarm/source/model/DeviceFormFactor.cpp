@@ -29,21 +29,29 @@ namespace Aws
       namespace DeviceFormFactorMapper
       {
 
-        static const int PHONE_HASH = HashingUtils::HashString("PHONE");
-        static const int TABLET_HASH = HashingUtils::HashString("TABLET");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PHONE_HASH = 76105038;
+        static const int TABLET_HASH = -1828048282;
 
 
         DeviceFormFactor GetDeviceFormFactorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PHONE_HASH)
+          switch (hashCode)
           {
+          case PHONE_HASH:
             return DeviceFormFactor::PHONE;
-          }
-          else if (hashCode == TABLET_HASH)
-          {
+          case TABLET_HASH:
             return DeviceFormFactor::TABLET;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace DevicePlatformMapper
       {
 
-        static const int ANDROID__HASH = HashingUtils::HashString("ANDROID");
-        static const int IOS_HASH = HashingUtils::HashString("IOS");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ANDROID__HASH = -143408561;
+        static const int IOS_HASH = 72685;
 
 
         DevicePlatform GetDevicePlatformForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ANDROID__HASH)
+          switch (hashCode)
           {
+          case ANDROID__HASH:
             return DevicePlatform::ANDROID_;
-          }
-          else if (hashCode == IOS_HASH)
-          {
+          case IOS_HASH:
             return DevicePlatform::IOS;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace DevicePoolTypeMapper
       {
 
-        static const int CURATED_HASH = HashingUtils::HashString("CURATED");
-        static const int PRIVATE__HASH = HashingUtils::HashString("PRIVATE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CURATED_HASH = 1844430386;
+        static const int PRIVATE__HASH = 403485027;
 
 
         DevicePoolType GetDevicePoolTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CURATED_HASH)
+          switch (hashCode)
           {
+          case CURATED_HASH:
             return DevicePoolType::CURATED;
-          }
-          else if (hashCode == PRIVATE__HASH)
-          {
+          case PRIVATE__HASH:
             return DevicePoolType::PRIVATE_;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
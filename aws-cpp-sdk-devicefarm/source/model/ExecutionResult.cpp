@@ -29,46 +29,44 @@ namespace Aws
       namespace ExecutionResultMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int PASSED_HASH = HashingUtils::HashString("PASSED");
-        static const int WARNED_HASH = HashingUtils::HashString("WARNED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int SKIPPED_HASH = HashingUtils::HashString("SKIPPED");
-        static const int ERRORED_HASH = HashingUtils::HashString("ERRORED");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PENDING_HASH = 35394935;
+        static const int PASSED_HASH = -1942051728;
+        static const int WARNED_HASH = -1741682267;
+        static const int FAILED_HASH = 2066319421;
+        static const int SKIPPED_HASH = -1429540080;
+        static const int ERRORED_HASH = -761001849;
+        static const int STOPPED_HASH = -1166336595;
 
 
         ExecutionResult GetExecutionResultForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          switch (hashCode)
           {
+          case PENDING_HASH:
             return ExecutionResult::PENDING;
-          }
-          else if (hashCode == PASSED_HASH)
-          {
+          case PASSED_HASH:
             return ExecutionResult::PASSED;
-          }
-          else if (hashCode == WARNED_HASH)
-          {
+          case WARNED_HASH:
             return ExecutionResult::WARNED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return ExecutionResult::FAILED;
-          }
-          else if (hashCode == SKIPPED_HASH)
-          {
+          case SKIPPED_HASH:
             return ExecutionResult::SKIPPED;
-          }
-          else if (hashCode == ERRORED_HASH)
-          {
+          case ERRORED_HASH:
             return ExecutionResult::ERRORED;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
+          case STOPPED_HASH:
             return ExecutionResult::STOPPED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,56 +29,50 @@ namespace Aws
       namespace ExecutionStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int PENDING_CONCURRENCY_HASH = HashingUtils::HashString("PENDING_CONCURRENCY");
-        static const int PENDING_DEVICE_HASH = HashingUtils::HashString("PENDING_DEVICE");
-        static const int PROCESSING_HASH = HashingUtils::HashString("PROCESSING");
-        static const int SCHEDULING_HASH = HashingUtils::HashString("SCHEDULING");
-        static const int PREPARING_HASH = HashingUtils::HashString("PREPARING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PENDING_HASH = 35394935;
+        static const int PENDING_CONCURRENCY_HASH = 164191403;
+        static const int PENDING_DEVICE_HASH = -2111031778;
+        static const int PROCESSING_HASH = 907287315;
+        static const int SCHEDULING_HASH = -201961068;
+        static const int PREPARING_HASH = 1775178724;
+        static const int RUNNING_HASH = -2026200673;
+        static const int COMPLETED_HASH = 1383663147;
+        static const int STOPPING_HASH = -1796691852;
 
 
         ExecutionStatus GetExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          switch (hashCode)
           {
+          case PENDING_HASH:
             return ExecutionStatus::PENDING;
-          }
-          else if (hashCode == PENDING_CONCURRENCY_HASH)
-          {
+          case PENDING_CONCURRENCY_HASH:
             return ExecutionStatus::PENDING_CONCURRENCY;
-          }
-          else if (hashCode == PENDING_DEVICE_HASH)
-          {
+          case PENDING_DEVICE_HASH:
             return ExecutionStatus::PENDING_DEVICE;
-          }
-          else if (hashCode == PROCESSING_HASH)
-          {
+          case PROCESSING_HASH:
             return ExecutionStatus::PROCESSING;
-          }
-          else if (hashCode == SCHEDULING_HASH)
-          {
+          case SCHEDULING_HASH:
             return ExecutionStatus::SCHEDULING;
-          }
-          else if (hashCode == PREPARING_HASH)
-          {
+          case PREPARING_HASH:
             return ExecutionStatus::PREPARING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
+          case RUNNING_HASH:
             return ExecutionStatus::RUNNING;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
+          case COMPLETED_HASH:
             return ExecutionStatus::COMPLETED;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
+          case STOPPING_HASH:
             return ExecutionStatus::STOPPING;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace OfferingTransactionTypeMapper
       {
 
-        static const int PURCHASE_HASH = HashingUtils::HashString("PURCHASE");
-        static const int RENEW_HASH = HashingUtils::HashString("RENEW");
-        static const int SYSTEM_HASH = HashingUtils::HashString("SYSTEM");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PURCHASE_HASH = -1769016063;
+        static const int RENEW_HASH = 77861485;
+        static const int SYSTEM_HASH = -1833998801;
 
 
         OfferingTransactionType GetOfferingTransactionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PURCHASE_HASH)
+          switch (hashCode)
           {
+          case PURCHASE_HASH:
             return OfferingTransactionType::PURCHASE;
-          }
-          else if (hashCode == RENEW_HASH)
-          {
+          case RENEW_HASH:
             return OfferingTransactionType::RENEW;
-          }
-          else if (hashCode == SYSTEM_HASH)
-          {
+          case SYSTEM_HASH:
             return OfferingTransactionType::SYSTEM;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
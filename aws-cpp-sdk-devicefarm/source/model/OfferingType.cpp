@@ -29,16 +29,26 @@ namespace Aws
       namespace OfferingTypeMapper
       {
 
-        static const int RECURRING_HASH = HashingUtils::HashString("RECURRING");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int RECURRING_HASH = -342622531;
 
 
         OfferingType GetOfferingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RECURRING_HASH)
+          switch (hashCode)
           {
+          case RECURRING_HASH:
             return OfferingType::RECURRING;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace RecurringChargeFrequencyMapper
       {
 
-        static const int MONTHLY_HASH = HashingUtils::HashString("MONTHLY");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int MONTHLY_HASH = 1954618349;
 
 
         RecurringChargeFrequency GetRecurringChargeFrequencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MONTHLY_HASH)
+          switch (hashCode)
           {
+          case MONTHLY_HASH:
             return RecurringChargeFrequency::MONTHLY;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
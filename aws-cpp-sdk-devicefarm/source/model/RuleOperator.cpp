@@ -29,36 +29,38 @@ namespace Aws
       namespace RuleOperatorMapper
       {
 
-        static const int EQUALS_HASH = HashingUtils::HashString("EQUALS");
-        static const int LESS_THAN_HASH = HashingUtils::HashString("LESS_THAN");
-        static const int GREATER_THAN_HASH = HashingUtils::HashString("GREATER_THAN");
-        static const int IN_HASH = HashingUtils::HashString("IN");
-        static const int NOT_IN_HASH = HashingUtils::HashString("NOT_IN");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int EQUALS_HASH = 2052813759;
+        static const int LESS_THAN_HASH = -1112834937;
+        static const int GREATER_THAN_HASH = 972152550;
+        static const int IN_HASH = 2341;
+        static const int NOT_IN_HASH = -1986339279;
 
 
         RuleOperator GetRuleOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQUALS_HASH)
+          switch (hashCode)
           {
+          case EQUALS_HASH:
             return RuleOperator::EQUALS;
-          }
-          else if (hashCode == LESS_THAN_HASH)
-          {
+          case LESS_THAN_HASH:
             return RuleOperator::LESS_THAN;
-          }
-          else if (hashCode == GREATER_THAN_HASH)
-          {
+          case GREATER_THAN_HASH:
             return RuleOperator::GREATER_THAN;
-          }
-          else if (hashCode == IN_HASH)
-          {
+          case IN_HASH:
             return RuleOperator::IN;
-          }
-          else if (hashCode == NOT_IN_HASH)
-          {
+          case NOT_IN_HASH:
             return RuleOperator::NOT_IN;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
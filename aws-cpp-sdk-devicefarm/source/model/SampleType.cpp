@@ -29,96 +29,74 @@ namespace Aws
       namespace SampleTypeMapper
       {
 
-        static const int CPU_HASH = HashingUtils::HashString("CPU");
-        static const int MEMORY_HASH = HashingUtils::HashString("MEMORY");
-        static const int THREADS_HASH = HashingUtils::HashString("THREADS");
-        static const int RX_RATE_HASH = HashingUtils::HashString("RX_RATE");
-        static const int TX_RATE_HASH = HashingUtils::HashString("TX_RATE");
-        static const int RX_HASH = HashingUtils::HashString("RX");
-        static const int TX_HASH = HashingUtils::HashString("TX");
-        static const int NATIVE_FRAMES_HASH = HashingUtils::HashString("NATIVE_FRAMES");
-        static const int NATIVE_FPS_HASH = HashingUtils::HashString("NATIVE_FPS");
-        static const int NATIVE_MIN_DRAWTIME_HASH = HashingUtils::HashString("NATIVE_MIN_DRAWTIME");
-        static const int NATIVE_AVG_DRAWTIME_HASH = HashingUtils::HashString("NATIVE_AVG_DRAWTIME");
-        static const int NATIVE_MAX_DRAWTIME_HASH = HashingUtils::HashString("NATIVE_MAX_DRAWTIME");
-        static const int OPENGL_FRAMES_HASH = HashingUtils::HashString("OPENGL_FRAMES");
-        static const int OPENGL_FPS_HASH = HashingUtils::HashString("OPENGL_FPS");
-        static const int OPENGL_MIN_DRAWTIME_HASH = HashingUtils::HashString("OPENGL_MIN_DRAWTIME");
-        static const int OPENGL_AVG_DRAWTIME_HASH = HashingUtils::HashString("OPENGL_AVG_DRAWTIME");
-        static const int OPENGL_MAX_DRAWTIME_HASH = HashingUtils::HashString("OPENGL_MAX_DRAWTIME");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CPU_HASH = 66952;
+        static const int MEMORY_HASH = -2024427263;
+        static const int THREADS_HASH = -619954295;
+        static const int RX_RATE_HASH = -1924501703;
+        static const int TX_RATE_HASH = -149494341;
+        static const int RX_HASH = 2630;
+        static const int TX_HASH = 2692;
+        static const int NATIVE_FRAMES_HASH = 272021966;
+        static const int NATIVE_FPS_HASH = -704405343;
+        static const int NATIVE_MIN_DRAWTIME_HASH = 658264230;
+        static const int NATIVE_AVG_DRAWTIME_HASH = -1400665050;
+        static const int NATIVE_MAX_DRAWTIME_HASH = 183838164;
+        static const int OPENGL_FRAMES_HASH = -1521424842;
+        static const int OPENGL_FPS_HASH = 1399262521;
+        static const int OPENGL_MIN_DRAWTIME_HASH = 277712654;
+        static const int OPENGL_AVG_DRAWTIME_HASH = -1781216626;
+        static const int OPENGL_MAX_DRAWTIME_HASH = -196713412;
 
 
         SampleType GetSampleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CPU_HASH)
+          switch (hashCode)
           {
+          case CPU_HASH:
             return SampleType::CPU;
-          }
-          else if (hashCode == MEMORY_HASH)
-          {
+          case MEMORY_HASH:
             return SampleType::MEMORY;
-          }
-          else if (hashCode == THREADS_HASH)
-          {
+          case THREADS_HASH:
             return SampleType::THREADS;
-          }
-          else if (hashCode == RX_RATE_HASH)
-          {
+          case RX_RATE_HASH:
             return SampleType::RX_RATE;
-          }
-          else if (hashCode == TX_RATE_HASH)
-          {
+          case TX_RATE_HASH:
             return SampleType::TX_RATE;
-          }
-          else if (hashCode == RX_HASH)
-          {
+          case RX_HASH:
             return SampleType::RX;
-          }
-          else if (hashCode == TX_HASH)
-          {
+          case TX_HASH:
             return SampleType::TX;
-          }
-          else if (hashCode == NATIVE_FRAMES_HASH)
-          {
+          case NATIVE_FRAMES_HASH:
             return SampleType::NATIVE_FRAMES;
-          }
-          else if (hashCode == NATIVE_FPS_HASH)
-          {
+          case NATIVE_FPS_HASH:
             return SampleType::NATIVE_FPS;
-          }
-          else if (hashCode == NATIVE_MIN_DRAWTIME_HASH)
-          {
+          case NATIVE_MIN_DRAWTIME_HASH:
             return SampleType::NATIVE_MIN_DRAWTIME;
-          }
-          else if (hashCode == NATIVE_AVG_DRAWTIME_HASH)
-          {
+          case NATIVE_AVG_DRAWTIME_HASH:
             return SampleType::NATIVE_AVG_DRAWTIME;
-          }
-          else if (hashCode == NATIVE_MAX_DRAWTIME_HASH)
-          {
+          case NATIVE_MAX_DRAWTIME_HASH:
             return SampleType::NATIVE_MAX_DRAWTIME;
-          }
-          else if (hashCode == OPENGL_FRAMES_HASH)
-          {
+          case OPENGL_FRAMES_HASH:
             return SampleType::OPENGL_FRAMES;
-          }
-          else if (hashCode == OPENGL_FPS_HASH)
-          {
+          case OPENGL_FPS_HASH:
             return SampleType::OPENGL_FPS;
-          }
-          else if (hashCode == OPENGL_MIN_DRAWTIME_HASH)
-          {
+          case OPENGL_MIN_DRAWTIME_HASH:
             return SampleType::OPENGL_MIN_DRAWTIME;
-          }
-          else if (hashCode == OPENGL_AVG_DRAWTIME_HASH)
-          {
+          case OPENGL_AVG_DRAWTIME_HASH:
             return SampleType::OPENGL_AVG_DRAWTIME;
-          }
-          else if (hashCode == OPENGL_MAX_DRAWTIME_HASH)
-          {
+          case OPENGL_MAX_DRAWTIME_HASH:
             return SampleType::OPENGL_MAX_DRAWTIME;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
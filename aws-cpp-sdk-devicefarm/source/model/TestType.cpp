@@ -29,81 +29,65 @@ namespace Aws
       namespace TestTypeMapper
       {
 
-        static const int BUILTIN_FUZZ_HASH = HashingUtils::HashString("BUILTIN_FUZZ");
-        static const int BUILTIN_EXPLORER_HASH = HashingUtils::HashString("BUILTIN_EXPLORER");
-        static const int APPIUM_JAVA_JUNIT_HASH = HashingUtils::HashString("APPIUM_JAVA_JUNIT");
-        static const int APPIUM_JAVA_TESTNG_HASH = HashingUtils::HashString("APPIUM_JAVA_TESTNG");
-        static const int APPIUM_PYTHON_HASH = HashingUtils::HashString("APPIUM_PYTHON");
-        static const int APPIUM_WEB_JAVA_JUNIT_HASH = HashingUtils::HashString("APPIUM_WEB_JAVA_JUNIT");
-        static const int APPIUM_WEB_JAVA_TESTNG_HASH = HashingUtils::HashString("APPIUM_WEB_JAVA_TESTNG");
-        static const int APPIUM_WEB_PYTHON_HASH = HashingUtils::HashString("APPIUM_WEB_PYTHON");
-        static const int CALABASH_HASH = HashingUtils::HashString("CALABASH");
-        static const int INSTRUMENTATION_HASH = HashingUtils::HashString("INSTRUMENTATION");
-        static const int UIAUTOMATION_HASH = HashingUtils::HashString("UIAUTOMATION");
-        static const int UIAUTOMATOR_HASH = HashingUtils::HashString("UIAUTOMATOR");
-        static const int XCTEST_HASH = HashingUtils::HashString("XCTEST");
-        static const int XCTEST_UI_HASH = HashingUtils::HashString("XCTEST_UI");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int BUILTIN_FUZZ_HASH = -822237429;
+        static const int BUILTIN_EXPLORER_HASH = 1603147003;
+        static const int APPIUM_JAVA_JUNIT_HASH = 1969267472;
+        static const int APPIUM_JAVA_TESTNG_HASH = 1189424073;
+        static const int APPIUM_PYTHON_HASH = -811208965;
+        static const int APPIUM_WEB_JAVA_JUNIT_HASH = 1734048123;
+        static const int APPIUM_WEB_JAVA_TESTNG_HASH = -1807408450;
+        static const int APPIUM_WEB_PYTHON_HASH = 717927142;
+        static const int CALABASH_HASH = 600248231;
+        static const int INSTRUMENTATION_HASH = 1661782862;
+        static const int UIAUTOMATION_HASH = 882959019;
+        static const int UIAUTOMATOR_HASH = 582672064;
+        static const int XCTEST_HASH = -1711154691;
+        static const int XCTEST_UI_HASH = -42469354;
 
 
         TestType GetTestTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BUILTIN_FUZZ_HASH)
+          switch (hashCode)
           {
+          case BUILTIN_FUZZ_HASH:
             return TestType::BUILTIN_FUZZ;
-          }
-          else if (hashCode == BUILTIN_EXPLORER_HASH)
-          {
+          case BUILTIN_EXPLORER_HASH:
             return TestType::BUILTIN_EXPLORER;
-          }
-          else if (hashCode == APPIUM_JAVA_JUNIT_HASH)
-          {
+          case APPIUM_JAVA_JUNIT_HASH:
             return TestType::APPIUM_JAVA_JUNIT;
-          }
-          else if (hashCode == APPIUM_JAVA_TESTNG_HASH)
-          {
+          case APPIUM_JAVA_TESTNG_HASH:
             return TestType::APPIUM_JAVA_TESTNG;
-          }
-          else if (hashCode == APPIUM_PYTHON_HASH)
-          {
+          case APPIUM_PYTHON_HASH:
             return TestType::APPIUM_PYTHON;
-          }
-          else if (hashCode == APPIUM_WEB_JAVA_JUNIT_HASH)
-          {
+          case APPIUM_WEB_JAVA_JUNIT_HASH:
             return TestType::APPIUM_WEB_JAVA_JUNIT;
-          }
-          else if (hashCode == APPIUM_WEB_JAVA_TESTNG_HASH)
-          {
+          case APPIUM_WEB_JAVA_TESTNG_HASH:
             return TestType::APPIUM_WEB_JAVA_TESTNG;
-          }
-          else if (hashCode == APPIUM_WEB_PYTHON_HASH)
-          {
+          case APPIUM_WEB_PYTHON_HASH:
             return TestType::APPIUM_WEB_PYTHON;
-          }
-          else if (hashCode == CALABASH_HASH)
-          {
+          case CALABASH_HASH:
             return TestType::CALABASH;
-          }
-          else if (hashCode == INSTRUMENTATION_HASH)
-          {
+          case INSTRUMENTATION_HASH:
             return TestType::INSTRUMENTATION;
-          }
-          else if (hashCode == UIAUTOMATION_HASH)
-          {
+          case UIAUTOMATION_HASH:
             return TestType::UIAUTOMATION;
-          }
-          else if (hashCode == UIAUTOMATOR_HASH)
-          {
+          case UIAUTOMATOR_HASH:
             return TestType::UIAUTOMATOR;
-          }
-          else if (hashCode == XCTEST_HASH)
-          {
+          case XCTEST_HASH:
             return TestType::XCTEST;
-          }
-          else if (hashCode == XCTEST_UI_HASH)
-          {
+          case XCTEST_UI_HASH:
             return TestType::XCTEST_UI;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
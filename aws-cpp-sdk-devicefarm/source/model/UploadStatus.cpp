@@ -29,31 +29,35 @@ namespace Aws
       namespace UploadStatusMapper
       {
 
-        static const int INITIALIZED_HASH = HashingUtils::HashString("INITIALIZED");
-        static const int PROCESSING_HASH = HashingUtils::HashString("PROCESSING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int INITIALIZED_HASH = -907986252;
+        static const int PROCESSING_HASH = 907287315;
+        static const int SUCCEEDED_HASH = -562638271;
+        static const int FAILED_HASH = 2066319421;
 
 
         UploadStatus GetUploadStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIALIZED_HASH)
+          switch (hashCode)
           {
+          case INITIALIZED_HASH:
             return UploadStatus::INITIALIZED;
-          }
-          else if (hashCode == PROCESSING_HASH)
-          {
+          case PROCESSING_HASH:
             return UploadStatus::PROCESSING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
+          case SUCCEEDED_HASH:
             return UploadStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return UploadStatus::FAILED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
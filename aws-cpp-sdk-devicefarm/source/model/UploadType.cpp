@@ -29,91 +29,71 @@ namespace Aws
       namespace UploadTypeMapper
       {
 
-        static const int ANDROID_APP_HASH = HashingUtils::HashString("ANDROID_APP");
-        static const int IOS_APP_HASH = HashingUtils::HashString("IOS_APP");
-        static const int WEB_APP_HASH = HashingUtils::HashString("WEB_APP");
-        static const int EXTERNAL_DATA_HASH = HashingUtils::HashString("EXTERNAL_DATA");
-        static const int APPIUM_JAVA_JUNIT_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_JAVA_JUNIT_TEST_PACKAGE");
-        static const int APPIUM_JAVA_TESTNG_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_JAVA_TESTNG_TEST_PACKAGE");
-        static const int APPIUM_PYTHON_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_PYTHON_TEST_PACKAGE");
-        static const int APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE");
-        static const int APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE");
-        static const int APPIUM_WEB_PYTHON_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_WEB_PYTHON_TEST_PACKAGE");
-        static const int CALABASH_TEST_PACKAGE_HASH = HashingUtils::HashString("CALABASH_TEST_PACKAGE");
-        static const int INSTRUMENTATION_TEST_PACKAGE_HASH = HashingUtils::HashString("INSTRUMENTATION_TEST_PACKAGE");
-        static const int UIAUTOMATION_TEST_PACKAGE_HASH = HashingUtils::HashString("UIAUTOMATION_TEST_PACKAGE");
-        static const int UIAUTOMATOR_TEST_PACKAGE_HASH = HashingUtils::HashString("UIAUTOMATOR_TEST_PACKAGE");
-        static const int XCTEST_TEST_PACKAGE_HASH = HashingUtils::HashString("XCTEST_TEST_PACKAGE");
-        static const int XCTEST_UI_TEST_PACKAGE_HASH = HashingUtils::HashString("XCTEST_UI_TEST_PACKAGE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ANDROID_APP_HASH = -1203228655;
+        static const int IOS_APP_HASH = -1590457681;
+        static const int WEB_APP_HASH = 1942667894;
+        static const int EXTERNAL_DATA_HASH = -1153502306;
+        static const int APPIUM_JAVA_JUNIT_TEST_PACKAGE_HASH = 669987400;
+        static const int APPIUM_JAVA_TESTNG_TEST_PACKAGE_HASH = -112304593;
+        static const int APPIUM_PYTHON_TEST_PACKAGE_HASH = -1233920963;
+        static const int APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE_HASH = -1972149827;
+        static const int APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE_HASH = -414180006;
+        static const int APPIUM_WEB_PYTHON_TEST_PACKAGE_HASH = -587461070;
+        static const int CALABASH_TEST_PACKAGE_HASH = 1512715025;
+        static const int INSTRUMENTATION_TEST_PACKAGE_HASH = 754638538;
+        static const int UIAUTOMATION_TEST_PACKAGE_HASH = -2036963699;
+        static const int UIAUTOMATOR_TEST_PACKAGE_HASH = -490244968;
+        static const int XCTEST_TEST_PACKAGE_HASH = 868836475;
+        static const int XCTEST_UI_TEST_PACKAGE_HASH = -1403209982;
 
 
         UploadType GetUploadTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ANDROID_APP_HASH)
+          switch (hashCode)
           {
+          case ANDROID_APP_HASH:
             return UploadType::ANDROID_APP;
-          }
-          else if (hashCode == IOS_APP_HASH)
-          {
+          case IOS_APP_HASH:
             return UploadType::IOS_APP;
-          }
-          else if (hashCode == WEB_APP_HASH)
-          {
+          case WEB_APP_HASH:
             return UploadType::WEB_APP;
-          }
-          else if (hashCode == EXTERNAL_DATA_HASH)
-          {
+          case EXTERNAL_DATA_HASH:
             return UploadType::EXTERNAL_DATA;
-          }
-          else if (hashCode == APPIUM_JAVA_JUNIT_TEST_PACKAGE_HASH)
-          {
+          case APPIUM_JAVA_JUNIT_TEST_PACKAGE_HASH:
             return UploadType::APPIUM_JAVA_JUNIT_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_JAVA_TESTNG_TEST_PACKAGE_HASH)
-          {
+          case APPIUM_JAVA_TESTNG_TEST_PACKAGE_HASH:
             return UploadType::APPIUM_JAVA_TESTNG_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_PYTHON_TEST_PACKAGE_HASH)
-          {
+          case APPIUM_PYTHON_TEST_PACKAGE_HASH:
             return UploadType::APPIUM_PYTHON_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE_HASH)
-          {
+          case APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE_HASH:
             return UploadType::APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE_HASH)
-          {
+          case APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE_HASH:
             return UploadType::APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_WEB_PYTHON_TEST_PACKAGE_HASH)
-          {
+          case APPIUM_WEB_PYTHON_TEST_PACKAGE_HASH:
             return UploadType::APPIUM_WEB_PYTHON_TEST_PACKAGE;
-          }
-          else if (hashCode == CALABASH_TEST_PACKAGE_HASH)
-          {
+          case CALABASH_TEST_PACKAGE_HASH:
             return UploadType::CALABASH_TEST_PACKAGE;
-          }
-          else if (hashCode == INSTRUMENTATION_TEST_PACKAGE_HASH)
-          {
+          case INSTRUMENTATION_TEST_PACKAGE_HASH:
             return UploadType::INSTRUMENTATION_TEST_PACKAGE;
-          }
-          else if (hashCode == UIAUTOMATION_TEST_PACKAGE_HASH)
-          {
+          case UIAUTOMATION_TEST_PACKAGE_HASH:
             return UploadType::UIAUTOMATION_TEST_PACKAGE;
-          }
-          else if (hashCode == UIAUTOMATOR_TEST_PACKAGE_HASH)
-          {
+          case UIAUTOMATOR_TEST_PACKAGE_HASH:
             return UploadType::UIAUTOMATOR_TEST_PACKAGE;
-          }
-          else if (hashCode == XCTEST_TEST_PACKAGE_HASH)
-          {
+          case XCTEST_TEST_PACKAGE_HASH:
             return UploadType::XCTEST_TEST_PACKAGE;
-          }
-          else if (hashCode == XCTEST_UI_TEST_PACKAGE_HASH)
-          {
+          case XCTEST_UI_TEST_PACKAGE_HASH:
             return UploadType::XCTEST_UI_TEST_PACKAGE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
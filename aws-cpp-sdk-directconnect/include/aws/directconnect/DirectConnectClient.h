@@ -42,6 +42,9 @@
 #include <aws/directconnect/model/DescribeVirtualGatewaysResult.h>
 #include <aws/directconnect/model/DescribeVirtualInterfacesResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -243,6 +246,18 @@ namespace Model
          */
         virtual void AllocateConnectionOnInterconnectAsync(const Model::AllocateConnectionOnInterconnectRequest& request, const AllocateConnectionOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AllocateConnectionOnInterconnectCallable(const Model::AllocateConnectionOnInterconnectRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AllocateConnectionOnInterconnectOutcomeCallable AllocateConnectionOnInterconnectCallable(Model::AllocateConnectionOnInterconnectRequest&& request) const;
+
+        /**
+         * Same as AllocateConnectionOnInterconnectAsync(const Model::AllocateConnectionOnInterconnectRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AllocateConnectionOnInterconnectAsync(Model::AllocateConnectionOnInterconnectRequest&& request, const AllocateConnectionOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provisions a private virtual interface to be owned by a different
          * customer.</p> <p>The owner of a connection calls this function to provision a
@@ -280,6 +295,18 @@ namespace Model
          */
         virtual void AllocatePrivateVirtualInterfaceAsync(const Model::AllocatePrivateVirtualInterfaceRequest& request, const AllocatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AllocatePrivateVirtualInterfaceCallable(const Model::AllocatePrivateVirtualInterfaceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AllocatePrivateVirtualInterfaceOutcomeCallable AllocatePrivateVirtualInterfaceCallable(Model::AllocatePrivateVirtualInterfaceRequest&& request) const;
+
+        /**
+         * Same as AllocatePrivateVirtualInterfaceAsync(const Model::AllocatePrivateVirtualInterfaceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AllocatePrivateVirtualInterfaceAsync(Model::AllocatePrivateVirtualInterfaceRequest&& request, const AllocatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provisions a public virtual interface to be owned by a different
          * customer.</p> <p>The owner of a connection calls this function to provision a
@@ -317,6 +344,18 @@ namespace Model
          */
         virtual void AllocatePublicVirtualInterfaceAsync(const Model::AllocatePublicVirtualInterfaceRequest& request, const AllocatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AllocatePublicVirtualInterfaceCallable(const Model::AllocatePublicVirtualInterfaceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AllocatePublicVirtualInterfaceOutcomeCallable AllocatePublicVirtualInterfaceCallable(Model::AllocatePublicVirtualInterfaceRequest&& request) const;
+
+        /**
+         * Same as AllocatePublicVirtualInterfaceAsync(const Model::AllocatePublicVirtualInterfaceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AllocatePublicVirtualInterfaceAsync(Model::AllocatePublicVirtualInterfaceRequest&& request, const AllocatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Confirm the creation of a hosted connection on an interconnect.</p> <p>Upon
          * creation, the hosted connection is initially in the 'Ordering' state, and will
@@ -345,6 +384,18 @@ namespace Model
          */
         virtual void ConfirmConnectionAsync(const Model::ConfirmConnectionRequest& request, const ConfirmConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConfirmConnectionCallable(const Model::ConfirmConnectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ConfirmConnectionOutcomeCallable ConfirmConnectionCallable(Model::ConfirmConnectionRequest&& request) const;
+
+        /**
+         * Same as ConfirmConnectionAsync(const Model::ConfirmConnectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ConfirmConnectionAsync(Model::ConfirmConnectionRequest&& request, const ConfirmConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Accept ownership of a private virtual interface created by another
          * customer.</p> <p>After the virtual interface owner calls this function, the
@@ -373,6 +424,18 @@ namespace Model
          */
         virtual void ConfirmPrivateVirtualInterfaceAsync(const Model::ConfirmPrivateVirtualInterfaceRequest& request, const ConfirmPrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConfirmPrivateVirtualInterfaceCallable(const Model::ConfirmPrivateVirtualInterfaceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ConfirmPrivateVirtualInterfaceOutcomeCallable ConfirmPrivateVirtualInterfaceCallable(Model::ConfirmPrivateVirtualInterfaceRequest&& request) const;
+
+        /**
+         * Same as ConfirmPrivateVirtualInterfaceAsync(const Model::ConfirmPrivateVirtualInterfaceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ConfirmPrivateVirtualInterfaceAsync(Model::ConfirmPrivateVirtualInterfaceRequest&& request, const ConfirmPrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Accept ownership of a public virtual interface created by another
          * customer.</p> <p>After the virtual interface owner calls this function, the
@@ -401,6 +464,18 @@ namespace Model
          */
         virtual void ConfirmPublicVirtualInterfaceAsync(const Model::ConfirmPublicVirtualInterfaceRequest& request, const ConfirmPublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConfirmPublicVirtualInterfaceCallable(const Model::ConfirmPublicVirtualInterfaceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ConfirmPublicVirtualInterfaceOutcomeCallable ConfirmPublicVirtualInterfaceCallable(Model::ConfirmPublicVirtualInterfaceRequest&& request) const;
+
+        /**
+         * Same as ConfirmPublicVirtualInterfaceAsync(const Model::ConfirmPublicVirtualInterfaceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ConfirmPublicVirtualInterfaceAsync(Model::ConfirmPublicVirtualInterfaceRequest&& request, const ConfirmPublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new connection between the customer network and a specific AWS
          * Direct Connect location.</p> <p>A connection links your internal network to an
@@ -441,6 +516,18 @@ namespace Model
          */
         virtual void CreateConnectionAsync(const Model::CreateConnectionRequest& request, const CreateConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateConnectionCallable(const Model::CreateConnectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateConnectionOutcomeCallable CreateConnectionCallable(Model::CreateConnectionRequest&& request) const;
+
+        /**
+         * Same as CreateConnectionAsync(const Model::CreateConnectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateConnectionAsync(Model::CreateConnectionRequest&& request, const CreateConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new interconnect between a AWS Direct Connect partner's network and
          * a specific AWS Direct Connect location.</p> <p>An interconnect is a connection
@@ -499,6 +586,18 @@ namespace Model
          */
         virtual void CreateInterconnectAsync(const Model::CreateInterconnectRequest& request, const CreateInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateInterconnectCallable(const Model::CreateInterconnectRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateInterconnectOutcomeCallable CreateInterconnectCallable(Model::CreateInterconnectRequest&& request) const;
+
+        /**
+         * Same as CreateInterconnectAsync(const Model::CreateInterconnectRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateInterconnectAsync(Model::CreateInterconnectRequest&& request, const CreateInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new private virtual interface. A virtual interface is the VLAN that
          * transports AWS Direct Connect traffic. A private virtual interface supports
@@ -524,6 +623,18 @@ namespace Model
          */
         virtual void CreatePrivateVirtualInterfaceAsync(const Model::CreatePrivateVirtualInterfaceRequest& request, const CreatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePrivateVirtualInterfaceCallable(const Model::CreatePrivateVirtualInterfaceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreatePrivateVirtualInterfaceOutcomeCallable CreatePrivateVirtualInterfaceCallable(Model::CreatePrivateVirtualInterfaceRequest&& request) const;
+
+        /**
+         * Same as CreatePrivateVirtualInterfaceAsync(const Model::CreatePrivateVirtualInterfaceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreatePrivateVirtualInterfaceAsync(Model::CreatePrivateVirtualInterfaceRequest&& request, const CreatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new public virtual interface. A virtual interface is the VLAN that
          * transports AWS Direct Connect traffic. A public virtual interface supports
@@ -552,6 +663,18 @@ namespace Model
          */
         virtual void CreatePublicVirtualInterfaceAsync(const Model::CreatePublicVirtualInterfaceRequest& request, const CreatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePublicVirtualInterfaceCallable(const Model::CreatePublicVirtualInterfaceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreatePublicVirtualInterfaceOutcomeCallable CreatePublicVirtualInterfaceCallable(Model::CreatePublicVirtualInterfaceRequest&& request) const;
+
+        /**
+         * Same as CreatePublicVirtualInterfaceAsync(const Model::CreatePublicVirtualInterfaceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreatePublicVirtualInterfaceAsync(Model::CreatePublicVirtualInterfaceRequest&& request, const CreatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the connection.</p> <p>Deleting a connection only stops the AWS
          * Direct Connect port hour and data transfer charges. You need to cancel
@@ -580,6 +703,18 @@ namespace Model
          */
         virtual void DeleteConnectionAsync(const Model::DeleteConnectionRequest& request, const DeleteConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteConnectionCallable(const Model::DeleteConnectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteConnectionOutcomeCallable DeleteConnectionCallable(Model::DeleteConnectionRequest&& request) const;
+
+        /**
+         * Same as DeleteConnectionAsync(const Model::DeleteConnectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteConnectionAsync(Model::DeleteConnectionRequest&& request, const DeleteConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified interconnect.</p> <note> <p>This is intended for use by
          * AWS Direct Connect partners only.</p> </note>
@@ -602,6 +737,18 @@ namespace Model
          */
         virtual void DeleteInterconnectAsync(const Model::DeleteInterconnectRequest& request, const DeleteInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteInterconnectCallable(const Model::DeleteInterconnectRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteInterconnectOutcomeCallable DeleteInterconnectCallable(Model::DeleteInterconnectRequest&& request) const;
+
+        /**
+         * Same as DeleteInterconnectAsync(const Model::DeleteInterconnectRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteInterconnectAsync(Model::DeleteInterconnectRequest&& request, const DeleteInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a virtual interface.</p>
          */
@@ -621,6 +768,18 @@ namespace Model
          */
         virtual void DeleteVirtualInterfaceAsync(const Model::DeleteVirtualInterfaceRequest& request, const DeleteVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVirtualInterfaceCallable(const Model::DeleteVirtualInterfaceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteVirtualInterfaceOutcomeCallable DeleteVirtualInterfaceCallable(Model::DeleteVirtualInterfaceRequest&& request) const;
+
+        /**
+         * Same as DeleteVirtualInterfaceAsync(const Model::DeleteVirtualInterfaceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteVirtualInterfaceAsync(Model::DeleteVirtualInterfaceRequest&& request, const DeleteVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the LOA-CFA for a Connection.</p> <p>The Letter of Authorization -
          * Connecting Facility Assignment (LOA-CFA) is a document that your APN partner or
@@ -658,6 +817,18 @@ namespace Model
          */
         virtual void DescribeConnectionLoaAsync(const Model::DescribeConnectionLoaRequest& request, const DescribeConnectionLoaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConnectionLoaCallable(const Model::DescribeConnectionLoaRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeConnectionLoaOutcomeCallable DescribeConnectionLoaCallable(Model::DescribeConnectionLoaRequest&& request) const;
+
+        /**
+         * Same as DescribeConnectionLoaAsync(const Model::DescribeConnectionLoaRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeConnectionLoaAsync(Model::DescribeConnectionLoaRequest&& request, const DescribeConnectionLoaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Displays all connections in this region.</p> <p>If a connection ID is
          * provided, the call returns only that particular connection.</p>
@@ -680,6 +851,18 @@ namespace Model
          */
         virtual void DescribeConnectionsAsync(const Model::DescribeConnectionsRequest& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConnectionsCallable(const Model::DescribeConnectionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeConnectionsOutcomeCallable DescribeConnectionsCallable(Model::DescribeConnectionsRequest&& request) const;
+
+        /**
+         * Same as DescribeConnectionsAsync(const Model::DescribeConnectionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeConnectionsAsync(Model::DescribeConnectionsRequest&& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Return a list of connections that have been provisioned on the given
          * interconnect.</p> <note> <p>This is intended for use by AWS Direct Connect
@@ -705,6 +888,18 @@ namespace Model
          */
         virtual void DescribeConnectionsOnInterconnectAsync(const Model::DescribeConnectionsOnInterconnectRequest& request, const DescribeConnectionsOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConnectionsOnInterconnectCallable(const Model::DescribeConnectionsOnInterconnectRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeConnectionsOnInterconnectOutcomeCallable DescribeConnectionsOnInterconnectCallable(Model::DescribeConnectionsOnInterconnectRequest&& request) const;
+
+        /**
+         * Same as DescribeConnectionsOnInterconnectAsync(const Model::DescribeConnectionsOnInterconnectRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeConnectionsOnInterconnectAsync(Model::DescribeConnectionsOnInterconnectRequest&& request, const DescribeConnectionsOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the LOA-CFA for an Interconnect.</p> <p>The Letter of Authorization -
          * Connecting Facility Assignment (LOA-CFA) is a document that is used when
@@ -742,6 +937,18 @@ namespace Model
          */
         virtual void DescribeInterconnectLoaAsync(const Model::DescribeInterconnectLoaRequest& request, const DescribeInterconnectLoaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInterconnectLoaCallable(const Model::DescribeInterconnectLoaRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeInterconnectLoaOutcomeCallable DescribeInterconnectLoaCallable(Model::DescribeInterconnectLoaRequest&& request) const;
+
+        /**
+         * Same as DescribeInterconnectLoaAsync(const Model::DescribeInterconnectLoaRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeInterconnectLoaAsync(Model::DescribeInterconnectLoaRequest&& request, const DescribeInterconnectLoaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of interconnects owned by the AWS account.</p> <p>If an
          * interconnect ID is provided, it will only return this particular
@@ -767,6 +974,18 @@ namespace Model
          */
         virtual void DescribeInterconnectsAsync(const Model::DescribeInterconnectsRequest& request, const DescribeInterconnectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInterconnectsCallable(const Model::DescribeInterconnectsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeInterconnectsOutcomeCallable DescribeInterconnectsCallable(Model::DescribeInterconnectsRequest&& request) const;
+
+        /**
+         * Same as DescribeInterconnectsAsync(const Model::DescribeInterconnectsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeInterconnectsAsync(Model::DescribeInterconnectsRequest&& request, const DescribeInterconnectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the list of AWS Direct Connect locations in the current AWS region.
          * These are the locations that may be selected when calling CreateConnection or
@@ -867,6 +1086,125 @@ namespace Model
          */
         virtual void DescribeVirtualInterfacesAsync(const Model::DescribeVirtualInterfacesRequest& request, const DescribeVirtualInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVirtualInterfacesCallable(const Model::DescribeVirtualInterfacesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVirtualInterfacesOutcomeCallable DescribeVirtualInterfacesCallable(Model::DescribeVirtualInterfacesRequest&& request) const;
+
+        /**
+         * Same as DescribeVirtualInterfacesAsync(const Model::DescribeVirtualInterfacesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVirtualInterfacesAsync(Model::DescribeVirtualInterfacesRequest&& request, const DescribeVirtualInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AllocateConnectionOnInterconnect(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::AllocateConnectionOnInterconnectRequest, Model::AllocateConnectionOnInterconnectOutcome> AllocateConnectionOnInterconnectAwaitable(Model::AllocateConnectionOnInterconnectRequest request) const;
+
+        /**
+         * co_await-able form of AllocatePrivateVirtualInterface(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::AllocatePrivateVirtualInterfaceRequest, Model::AllocatePrivateVirtualInterfaceOutcome> AllocatePrivateVirtualInterfaceAwaitable(Model::AllocatePrivateVirtualInterfaceRequest request) const;
+
+        /**
+         * co_await-able form of AllocatePublicVirtualInterface(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::AllocatePublicVirtualInterfaceRequest, Model::AllocatePublicVirtualInterfaceOutcome> AllocatePublicVirtualInterfaceAwaitable(Model::AllocatePublicVirtualInterfaceRequest request) const;
+
+        /**
+         * co_await-able form of ConfirmConnection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::ConfirmConnectionRequest, Model::ConfirmConnectionOutcome> ConfirmConnectionAwaitable(Model::ConfirmConnectionRequest request) const;
+
+        /**
+         * co_await-able form of ConfirmPrivateVirtualInterface(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::ConfirmPrivateVirtualInterfaceRequest, Model::ConfirmPrivateVirtualInterfaceOutcome> ConfirmPrivateVirtualInterfaceAwaitable(Model::ConfirmPrivateVirtualInterfaceRequest request) const;
+
+        /**
+         * co_await-able form of ConfirmPublicVirtualInterface(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::ConfirmPublicVirtualInterfaceRequest, Model::ConfirmPublicVirtualInterfaceOutcome> ConfirmPublicVirtualInterfaceAwaitable(Model::ConfirmPublicVirtualInterfaceRequest request) const;
+
+        /**
+         * co_await-able form of CreateConnection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::CreateConnectionRequest, Model::CreateConnectionOutcome> CreateConnectionAwaitable(Model::CreateConnectionRequest request) const;
+
+        /**
+         * co_await-able form of CreateInterconnect(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::CreateInterconnectRequest, Model::CreateInterconnectOutcome> CreateInterconnectAwaitable(Model::CreateInterconnectRequest request) const;
+
+        /**
+         * co_await-able form of CreatePrivateVirtualInterface(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::CreatePrivateVirtualInterfaceRequest, Model::CreatePrivateVirtualInterfaceOutcome> CreatePrivateVirtualInterfaceAwaitable(Model::CreatePrivateVirtualInterfaceRequest request) const;
+
+        /**
+         * co_await-able form of CreatePublicVirtualInterface(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::CreatePublicVirtualInterfaceRequest, Model::CreatePublicVirtualInterfaceOutcome> CreatePublicVirtualInterfaceAwaitable(Model::CreatePublicVirtualInterfaceRequest request) const;
+
+        /**
+         * co_await-able form of DeleteConnection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::DeleteConnectionRequest, Model::DeleteConnectionOutcome> DeleteConnectionAwaitable(Model::DeleteConnectionRequest request) const;
+
+        /**
+         * co_await-able form of DeleteInterconnect(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::DeleteInterconnectRequest, Model::DeleteInterconnectOutcome> DeleteInterconnectAwaitable(Model::DeleteInterconnectRequest request) const;
+
+        /**
+         * co_await-able form of DeleteVirtualInterface(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::DeleteVirtualInterfaceRequest, Model::DeleteVirtualInterfaceOutcome> DeleteVirtualInterfaceAwaitable(Model::DeleteVirtualInterfaceRequest request) const;
+
+        /**
+         * co_await-able form of DescribeConnectionLoa(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::DescribeConnectionLoaRequest, Model::DescribeConnectionLoaOutcome> DescribeConnectionLoaAwaitable(Model::DescribeConnectionLoaRequest request) const;
+
+        /**
+         * co_await-able form of DescribeConnections(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::DescribeConnectionsRequest, Model::DescribeConnectionsOutcome> DescribeConnectionsAwaitable(Model::DescribeConnectionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeConnectionsOnInterconnect(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::DescribeConnectionsOnInterconnectRequest, Model::DescribeConnectionsOnInterconnectOutcome> DescribeConnectionsOnInterconnectAwaitable(Model::DescribeConnectionsOnInterconnectRequest request) const;
+
+        /**
+         * co_await-able form of DescribeInterconnectLoa(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::DescribeInterconnectLoaRequest, Model::DescribeInterconnectLoaOutcome> DescribeInterconnectLoaAwaitable(Model::DescribeInterconnectLoaRequest request) const;
+
+        /**
+         * co_await-able form of DescribeInterconnects(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::DescribeInterconnectsRequest, Model::DescribeInterconnectsOutcome> DescribeInterconnectsAwaitable(Model::DescribeInterconnectsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLocations(): the operation runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, void, Model::DescribeLocationsOutcome> DescribeLocationsAwaitable() const;
+
+        /**
+         * co_await-able form of DescribeVirtualGateways(): the operation runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, void, Model::DescribeVirtualGatewaysOutcome> DescribeVirtualGatewaysAwaitable() const;
+
+        /**
+         * co_await-able form of DescribeVirtualInterfaces(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectConnectClient, Model::DescribeVirtualInterfacesRequest, Model::DescribeVirtualInterfacesOutcome> DescribeVirtualInterfacesAwaitable(Model::DescribeVirtualInterfacesRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AllocateConnectionOnInterconnectRequest();
+    inline const char* GetServiceRequestName() const override { return "AllocateConnectionOnInterconnect"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     AllocatePrivateVirtualInterfaceRequest();
+    inline const char* GetServiceRequestName() const override { return "AllocatePrivateVirtualInterface"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
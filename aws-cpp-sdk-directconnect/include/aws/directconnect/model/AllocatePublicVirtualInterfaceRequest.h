@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     AllocatePublicVirtualInterfaceRequest();
+    inline const char* GetServiceRequestName() const override { return "AllocatePublicVirtualInterface"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
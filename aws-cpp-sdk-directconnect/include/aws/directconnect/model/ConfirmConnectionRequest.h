@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ConfirmConnectionRequest();
+    inline const char* GetServiceRequestName() const override { return "ConfirmConnection"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
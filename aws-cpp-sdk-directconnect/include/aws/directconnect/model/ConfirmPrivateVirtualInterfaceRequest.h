@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ConfirmPrivateVirtualInterfaceRequest();
+    inline const char* GetServiceRequestName() const override { return "ConfirmPrivateVirtualInterface"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
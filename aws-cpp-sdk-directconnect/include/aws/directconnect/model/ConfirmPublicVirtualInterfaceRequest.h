@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ConfirmPublicVirtualInterfaceRequest();
+    inline const char* GetServiceRequestName() const override { return "ConfirmPublicVirtualInterface"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
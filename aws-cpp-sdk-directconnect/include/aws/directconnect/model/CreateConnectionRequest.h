@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateConnectionRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateConnection"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
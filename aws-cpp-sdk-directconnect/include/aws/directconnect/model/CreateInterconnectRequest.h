@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateInterconnectRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateInterconnect"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreatePrivateVirtualInterfaceRequest();
+    inline const char* GetServiceRequestName() const override { return "CreatePrivateVirtualInterface"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
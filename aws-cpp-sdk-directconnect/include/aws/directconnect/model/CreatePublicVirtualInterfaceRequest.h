@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreatePublicVirtualInterfaceRequest();
+    inline const char* GetServiceRequestName() const override { return "CreatePublicVirtualInterface"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteConnectionRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteConnection"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteInterconnectRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteInterconnect"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteVirtualInterfaceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteVirtualInterface"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
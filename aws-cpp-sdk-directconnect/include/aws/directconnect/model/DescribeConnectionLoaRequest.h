@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeConnectionLoaRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeConnectionLoa"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeConnectionsOnInterconnectRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeConnectionsOnInterconnect"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
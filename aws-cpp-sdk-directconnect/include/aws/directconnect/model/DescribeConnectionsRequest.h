@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeConnectionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeConnections"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeInterconnectLoaRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeInterconnectLoa"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeInterconnectsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeInterconnects"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
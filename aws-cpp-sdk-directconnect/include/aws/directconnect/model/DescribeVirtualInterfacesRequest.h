@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeVirtualInterfacesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVirtualInterfaces"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -128,7 +128,7 @@ AllocateConnectionOnInterconnectOutcome DirectConnectClient::AllocateConnectionO
 
 AllocateConnectionOnInterconnectOutcomeCallable DirectConnectClient::AllocateConnectionOnInterconnectCallable(const AllocateConnectionOnInterconnectRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AllocateConnectionOnInterconnect(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AllocateConnectionOnInterconnect(request); } );
 }
 
 void DirectConnectClient::AllocateConnectionOnInterconnectAsync(const AllocateConnectionOnInterconnectRequest& request, const AllocateConnectionOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -136,6 +136,16 @@ void DirectConnectClient::AllocateConnectionOnInterconnectAsync(const AllocateCo
   m_executor->Submit( [this, request, handler, context](){ this->AllocateConnectionOnInterconnectAsyncHelper( request, handler, context ); } );
 }
 
+AllocateConnectionOnInterconnectOutcomeCallable DirectConnectClient::AllocateConnectionOnInterconnectCallable(AllocateConnectionOnInterconnectRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::AllocateConnectionOnInterconnect, this, std::move(request)));
+}
+
+void DirectConnectClient::AllocateConnectionOnInterconnectAsync(AllocateConnectionOnInterconnectRequest&& request, const AllocateConnectionOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::AllocateConnectionOnInterconnectAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::AllocateConnectionOnInterconnectAsyncHelper(const AllocateConnectionOnInterconnectRequest& request, const AllocateConnectionOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AllocateConnectionOnInterconnect(request), context);
@@ -159,7 +169,7 @@ AllocatePrivateVirtualInterfaceOutcome DirectConnectClient::AllocatePrivateVirtu
 
 AllocatePrivateVirtualInterfaceOutcomeCallable DirectConnectClient::AllocatePrivateVirtualInterfaceCallable(const AllocatePrivateVirtualInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AllocatePrivateVirtualInterface(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AllocatePrivateVirtualInterface(request); } );
 }
 
 void DirectConnectClient::AllocatePrivateVirtualInterfaceAsync(const AllocatePrivateVirtualInterfaceRequest& request, const AllocatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -167,6 +177,16 @@ void DirectConnectClient::AllocatePrivateVirtualInterfaceAsync(const AllocatePri
   m_executor->Submit( [this, request, handler, context](){ this->AllocatePrivateVirtualInterfaceAsyncHelper( request, handler, context ); } );
 }
 
+AllocatePrivateVirtualInterfaceOutcomeCallable DirectConnectClient::AllocatePrivateVirtualInterfaceCallable(AllocatePrivateVirtualInterfaceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::AllocatePrivateVirtualInterface, this, std::move(request)));
+}
+
+void DirectConnectClient::AllocatePrivateVirtualInterfaceAsync(AllocatePrivateVirtualInterfaceRequest&& request, const AllocatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::AllocatePrivateVirtualInterfaceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::AllocatePrivateVirtualInterfaceAsyncHelper(const AllocatePrivateVirtualInterfaceRequest& request, const AllocatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AllocatePrivateVirtualInterface(request), context);
@@ -190,7 +210,7 @@ AllocatePublicVirtualInterfaceOutcome DirectConnectClient::AllocatePublicVirtual
 
 AllocatePublicVirtualInterfaceOutcomeCallable DirectConnectClient::AllocatePublicVirtualInterfaceCallable(const AllocatePublicVirtualInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AllocatePublicVirtualInterface(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AllocatePublicVirtualInterface(request); } );
 }
 
 void DirectConnectClient::AllocatePublicVirtualInterfaceAsync(const AllocatePublicVirtualInterfaceRequest& request, const AllocatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -198,6 +218,16 @@ void DirectConnectClient::AllocatePublicVirtualInterfaceAsync(const AllocatePubl
   m_executor->Submit( [this, request, handler, context](){ this->AllocatePublicVirtualInterfaceAsyncHelper( request, handler, context ); } );
 }
 
+AllocatePublicVirtualInterfaceOutcomeCallable DirectConnectClient::AllocatePublicVirtualInterfaceCallable(AllocatePublicVirtualInterfaceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::AllocatePublicVirtualInterface, this, std::move(request)));
+}
+
+void DirectConnectClient::AllocatePublicVirtualInterfaceAsync(AllocatePublicVirtualInterfaceRequest&& request, const AllocatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::AllocatePublicVirtualInterfaceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::AllocatePublicVirtualInterfaceAsyncHelper(const AllocatePublicVirtualInterfaceRequest& request, const AllocatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AllocatePublicVirtualInterface(request), context);
@@ -221,7 +251,7 @@ ConfirmConnectionOutcome DirectConnectClient::ConfirmConnection(const ConfirmCon
 
 ConfirmConnectionOutcomeCallable DirectConnectClient::ConfirmConnectionCallable(const ConfirmConnectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ConfirmConnection(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ConfirmConnection(request); } );
 }
 
 void DirectConnectClient::ConfirmConnectionAsync(const ConfirmConnectionRequest& request, const ConfirmConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -229,6 +259,16 @@ void DirectConnectClient::ConfirmConnectionAsync(const ConfirmConnectionRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ConfirmConnectionAsyncHelper( request, handler, context ); } );
 }
 
+ConfirmConnectionOutcomeCallable DirectConnectClient::ConfirmConnectionCallable(ConfirmConnectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::ConfirmConnection, this, std::move(request)));
+}
+
+void DirectConnectClient::ConfirmConnectionAsync(ConfirmConnectionRequest&& request, const ConfirmConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::ConfirmConnectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::ConfirmConnectionAsyncHelper(const ConfirmConnectionRequest& request, const ConfirmConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ConfirmConnection(request), context);
@@ -252,7 +292,7 @@ ConfirmPrivateVirtualInterfaceOutcome DirectConnectClient::ConfirmPrivateVirtual
 
 ConfirmPrivateVirtualInterfaceOutcomeCallable DirectConnectClient::ConfirmPrivateVirtualInterfaceCallable(const ConfirmPrivateVirtualInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ConfirmPrivateVirtualInterface(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ConfirmPrivateVirtualInterface(request); } );
 }
 
 void DirectConnectClient::ConfirmPrivateVirtualInterfaceAsync(const ConfirmPrivateVirtualInterfaceRequest& request, const ConfirmPrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -260,6 +300,16 @@ void DirectConnectClient::ConfirmPrivateVirtualInterfaceAsync(const ConfirmPriva
   m_executor->Submit( [this, request, handler, context](){ this->ConfirmPrivateVirtualInterfaceAsyncHelper( request, handler, context ); } );
 }
 
+ConfirmPrivateVirtualInterfaceOutcomeCallable DirectConnectClient::ConfirmPrivateVirtualInterfaceCallable(ConfirmPrivateVirtualInterfaceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::ConfirmPrivateVirtualInterface, this, std::move(request)));
+}
+
+void DirectConnectClient::ConfirmPrivateVirtualInterfaceAsync(ConfirmPrivateVirtualInterfaceRequest&& request, const ConfirmPrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::ConfirmPrivateVirtualInterfaceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::ConfirmPrivateVirtualInterfaceAsyncHelper(const ConfirmPrivateVirtualInterfaceRequest& request, const ConfirmPrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ConfirmPrivateVirtualInterface(request), context);
@@ -283,7 +333,7 @@ ConfirmPublicVirtualInterfaceOutcome DirectConnectClient::ConfirmPublicVirtualIn
 
 ConfirmPublicVirtualInterfaceOutcomeCallable DirectConnectClient::ConfirmPublicVirtualInterfaceCallable(const ConfirmPublicVirtualInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ConfirmPublicVirtualInterface(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ConfirmPublicVirtualInterface(request); } );
 }
 
 void DirectConnectClient::ConfirmPublicVirtualInterfaceAsync(const ConfirmPublicVirtualInterfaceRequest& request, const ConfirmPublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -291,6 +341,16 @@ void DirectConnectClient::ConfirmPublicVirtualInterfaceAsync(const ConfirmPublic
   m_executor->Submit( [this, request, handler, context](){ this->ConfirmPublicVirtualInterfaceAsyncHelper( request, handler, context ); } );
 }
 
+ConfirmPublicVirtualInterfaceOutcomeCallable DirectConnectClient::ConfirmPublicVirtualInterfaceCallable(ConfirmPublicVirtualInterfaceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::ConfirmPublicVirtualInterface, this, std::move(request)));
+}
+
+void DirectConnectClient::ConfirmPublicVirtualInterfaceAsync(ConfirmPublicVirtualInterfaceRequest&& request, const ConfirmPublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::ConfirmPublicVirtualInterfaceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::ConfirmPublicVirtualInterfaceAsyncHelper(const ConfirmPublicVirtualInterfaceRequest& request, const ConfirmPublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ConfirmPublicVirtualInterface(request), context);
@@ -314,7 +374,7 @@ CreateConnectionOutcome DirectConnectClient::CreateConnection(const CreateConnec
 
 CreateConnectionOutcomeCallable DirectConnectClient::CreateConnectionCallable(const CreateConnectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateConnection(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateConnection(request); } );
 }
 
 void DirectConnectClient::CreateConnectionAsync(const CreateConnectionRequest& request, const CreateConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -322,6 +382,16 @@ void DirectConnectClient::CreateConnectionAsync(const CreateConnectionRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->CreateConnectionAsyncHelper( request, handler, context ); } );
 }
 
+CreateConnectionOutcomeCallable DirectConnectClient::CreateConnectionCallable(CreateConnectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::CreateConnection, this, std::move(request)));
+}
+
+void DirectConnectClient::CreateConnectionAsync(CreateConnectionRequest&& request, const CreateConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::CreateConnectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::CreateConnectionAsyncHelper(const CreateConnectionRequest& request, const CreateConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateConnection(request), context);
@@ -345,7 +415,7 @@ CreateInterconnectOutcome DirectConnectClient::CreateInterconnect(const CreateIn
 
 CreateInterconnectOutcomeCallable DirectConnectClient::CreateInterconnectCallable(const CreateInterconnectRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateInterconnect(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateInterconnect(request); } );
 }
 
 void DirectConnectClient::CreateInterconnectAsync(const CreateInterconnectRequest& request, const CreateInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -353,6 +423,16 @@ void DirectConnectClient::CreateInterconnectAsync(const CreateInterconnectReques
   m_executor->Submit( [this, request, handler, context](){ this->CreateInterconnectAsyncHelper( request, handler, context ); } );
 }
 
+CreateInterconnectOutcomeCallable DirectConnectClient::CreateInterconnectCallable(CreateInterconnectRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::CreateInterconnect, this, std::move(request)));
+}
+
+void DirectConnectClient::CreateInterconnectAsync(CreateInterconnectRequest&& request, const CreateInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::CreateInterconnectAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::CreateInterconnectAsyncHelper(const CreateInterconnectRequest& request, const CreateInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateInterconnect(request), context);
@@ -376,7 +456,7 @@ CreatePrivateVirtualInterfaceOutcome DirectConnectClient::CreatePrivateVirtualIn
 
 CreatePrivateVirtualInterfaceOutcomeCallable DirectConnectClient::CreatePrivateVirtualInterfaceCallable(const CreatePrivateVirtualInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreatePrivateVirtualInterface(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreatePrivateVirtualInterface(request); } );
 }
 
 void DirectConnectClient::CreatePrivateVirtualInterfaceAsync(const CreatePrivateVirtualInterfaceRequest& request, const CreatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -384,6 +464,16 @@ void DirectConnectClient::CreatePrivateVirtualInterfaceAsync(const CreatePrivate
   m_executor->Submit( [this, request, handler, context](){ this->CreatePrivateVirtualInterfaceAsyncHelper( request, handler, context ); } );
 }
 
+CreatePrivateVirtualInterfaceOutcomeCallable DirectConnectClient::CreatePrivateVirtualInterfaceCallable(CreatePrivateVirtualInterfaceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::CreatePrivateVirtualInterface, this, std::move(request)));
+}
+
+void DirectConnectClient::CreatePrivateVirtualInterfaceAsync(CreatePrivateVirtualInterfaceRequest&& request, const CreatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::CreatePrivateVirtualInterfaceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::CreatePrivateVirtualInterfaceAsyncHelper(const CreatePrivateVirtualInterfaceRequest& request, const CreatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreatePrivateVirtualInterface(request), context);
@@ -407,7 +497,7 @@ CreatePublicVirtualInterfaceOutcome DirectConnectClient::CreatePublicVirtualInte
 
 CreatePublicVirtualInterfaceOutcomeCallable DirectConnectClient::CreatePublicVirtualInterfaceCallable(const CreatePublicVirtualInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreatePublicVirtualInterface(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreatePublicVirtualInterface(request); } );
 }
 
 void DirectConnectClient::CreatePublicVirtualInterfaceAsync(const CreatePublicVirtualInterfaceRequest& request, const CreatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -415,6 +505,16 @@ void DirectConnectClient::CreatePublicVirtualInterfaceAsync(const CreatePublicVi
   m_executor->Submit( [this, request, handler, context](){ this->CreatePublicVirtualInterfaceAsyncHelper( request, handler, context ); } );
 }
 
+CreatePublicVirtualInterfaceOutcomeCallable DirectConnectClient::CreatePublicVirtualInterfaceCallable(CreatePublicVirtualInterfaceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::CreatePublicVirtualInterface, this, std::move(request)));
+}
+
+void DirectConnectClient::CreatePublicVirtualInterfaceAsync(CreatePublicVirtualInterfaceRequest&& request, const CreatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::CreatePublicVirtualInterfaceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::CreatePublicVirtualInterfaceAsyncHelper(const CreatePublicVirtualInterfaceRequest& request, const CreatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreatePublicVirtualInterface(request), context);
@@ -438,7 +538,7 @@ DeleteConnectionOutcome DirectConnectClient::DeleteConnection(const DeleteConnec
 
 DeleteConnectionOutcomeCallable DirectConnectClient::DeleteConnectionCallable(const DeleteConnectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteConnection(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteConnection(request); } );
 }
 
 void DirectConnectClient::DeleteConnectionAsync(const DeleteConnectionRequest& request, const DeleteConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -446,6 +546,16 @@ void DirectConnectClient::DeleteConnectionAsync(const DeleteConnectionRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DeleteConnectionAsyncHelper( request, handler, context ); } );
 }
 
+DeleteConnectionOutcomeCallable DirectConnectClient::DeleteConnectionCallable(DeleteConnectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::DeleteConnection, this, std::move(request)));
+}
+
+void DirectConnectClient::DeleteConnectionAsync(DeleteConnectionRequest&& request, const DeleteConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::DeleteConnectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::DeleteConnectionAsyncHelper(const DeleteConnectionRequest& request, const DeleteConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteConnection(request), context);
@@ -469,7 +579,7 @@ DeleteInterconnectOutcome DirectConnectClient::DeleteInterconnect(const DeleteIn
 
 DeleteInterconnectOutcomeCallable DirectConnectClient::DeleteInterconnectCallable(const DeleteInterconnectRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteInterconnect(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteInterconnect(request); } );
 }
 
 void DirectConnectClient::DeleteInterconnectAsync(const DeleteInterconnectRequest& request, const DeleteInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -477,6 +587,16 @@ void DirectConnectClient::DeleteInterconnectAsync(const DeleteInterconnectReques
   m_executor->Submit( [this, request, handler, context](){ this->DeleteInterconnectAsyncHelper( request, handler, context ); } );
 }
 
+DeleteInterconnectOutcomeCallable DirectConnectClient::DeleteInterconnectCallable(DeleteInterconnectRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::DeleteInterconnect, this, std::move(request)));
+}
+
+void DirectConnectClient::DeleteInterconnectAsync(DeleteInterconnectRequest&& request, const DeleteInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::DeleteInterconnectAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::DeleteInterconnectAsyncHelper(const DeleteInterconnectRequest& request, const DeleteInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteInterconnect(request), context);
@@ -500,7 +620,7 @@ DeleteVirtualInterfaceOutcome DirectConnectClient::DeleteVirtualInterface(const
 
 DeleteVirtualInterfaceOutcomeCallable DirectConnectClient::DeleteVirtualInterfaceCallable(const DeleteVirtualInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteVirtualInterface(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteVirtualInterface(request); } );
 }
 
 void DirectConnectClient::DeleteVirtualInterfaceAsync(const DeleteVirtualInterfaceRequest& request, const DeleteVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -508,6 +628,16 @@ void DirectConnectClient::DeleteVirtualInterfaceAsync(const DeleteVirtualInterfa
   m_executor->Submit( [this, request, handler, context](){ this->DeleteVirtualInterfaceAsyncHelper( request, handler, context ); } );
 }
 
+DeleteVirtualInterfaceOutcomeCallable DirectConnectClient::DeleteVirtualInterfaceCallable(DeleteVirtualInterfaceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::DeleteVirtualInterface, this, std::move(request)));
+}
+
+void DirectConnectClient::DeleteVirtualInterfaceAsync(DeleteVirtualInterfaceRequest&& request, const DeleteVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::DeleteVirtualInterfaceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::DeleteVirtualInterfaceAsyncHelper(const DeleteVirtualInterfaceRequest& request, const DeleteVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteVirtualInterface(request), context);
@@ -531,7 +661,7 @@ DescribeConnectionLoaOutcome DirectConnectClient::DescribeConnectionLoa(const De
 
 DescribeConnectionLoaOutcomeCallable DirectConnectClient::DescribeConnectionLoaCallable(const DescribeConnectionLoaRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeConnectionLoa(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeConnectionLoa(request); } );
 }
 
 void DirectConnectClient::DescribeConnectionLoaAsync(const DescribeConnectionLoaRequest& request, const DescribeConnectionLoaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -539,6 +669,16 @@ void DirectConnectClient::DescribeConnectionLoaAsync(const DescribeConnectionLoa
   m_executor->Submit( [this, request, handler, context](){ this->DescribeConnectionLoaAsyncHelper( request, handler, context ); } );
 }
 
+DescribeConnectionLoaOutcomeCallable DirectConnectClient::DescribeConnectionLoaCallable(DescribeConnectionLoaRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::DescribeConnectionLoa, this, std::move(request)));
+}
+
+void DirectConnectClient::DescribeConnectionLoaAsync(DescribeConnectionLoaRequest&& request, const DescribeConnectionLoaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::DescribeConnectionLoaAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::DescribeConnectionLoaAsyncHelper(const DescribeConnectionLoaRequest& request, const DescribeConnectionLoaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeConnectionLoa(request), context);
@@ -562,7 +702,7 @@ DescribeConnectionsOutcome DirectConnectClient::DescribeConnections(const Descri
 
 DescribeConnectionsOutcomeCallable DirectConnectClient::DescribeConnectionsCallable(const DescribeConnectionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeConnections(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeConnections(request); } );
 }
 
 void DirectConnectClient::DescribeConnectionsAsync(const DescribeConnectionsRequest& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -570,6 +710,16 @@ void DirectConnectClient::DescribeConnectionsAsync(const DescribeConnectionsRequ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeConnectionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeConnectionsOutcomeCallable DirectConnectClient::DescribeConnectionsCallable(DescribeConnectionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::DescribeConnections, this, std::move(request)));
+}
+
+void DirectConnectClient::DescribeConnectionsAsync(DescribeConnectionsRequest&& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::DescribeConnectionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::DescribeConnectionsAsyncHelper(const DescribeConnectionsRequest& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeConnections(request), context);
@@ -593,7 +743,7 @@ DescribeConnectionsOnInterconnectOutcome DirectConnectClient::DescribeConnection
 
 DescribeConnectionsOnInterconnectOutcomeCallable DirectConnectClient::DescribeConnectionsOnInterconnectCallable(const DescribeConnectionsOnInterconnectRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeConnectionsOnInterconnect(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeConnectionsOnInterconnect(request); } );
 }
 
 void DirectConnectClient::DescribeConnectionsOnInterconnectAsync(const DescribeConnectionsOnInterconnectRequest& request, const DescribeConnectionsOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -601,6 +751,16 @@ void DirectConnectClient::DescribeConnectionsOnInterconnectAsync(const DescribeC
   m_executor->Submit( [this, request, handler, context](){ this->DescribeConnectionsOnInterconnectAsyncHelper( request, handler, context ); } );
 }
 
+DescribeConnectionsOnInterconnectOutcomeCallable DirectConnectClient::DescribeConnectionsOnInterconnectCallable(DescribeConnectionsOnInterconnectRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::DescribeConnectionsOnInterconnect, this, std::move(request)));
+}
+
+void DirectConnectClient::DescribeConnectionsOnInterconnectAsync(DescribeConnectionsOnInterconnectRequest&& request, const DescribeConnectionsOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::DescribeConnectionsOnInterconnectAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::DescribeConnectionsOnInterconnectAsyncHelper(const DescribeConnectionsOnInterconnectRequest& request, const DescribeConnectionsOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeConnectionsOnInterconnect(request), context);
@@ -624,7 +784,7 @@ DescribeInterconnectLoaOutcome DirectConnectClient::DescribeInterconnectLoa(cons
 
 DescribeInterconnectLoaOutcomeCallable DirectConnectClient::DescribeInterconnectLoaCallable(const DescribeInterconnectLoaRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeInterconnectLoa(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeInterconnectLoa(request); } );
 }
 
 void DirectConnectClient::DescribeInterconnectLoaAsync(const DescribeInterconnectLoaRequest& request, const DescribeInterconnectLoaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -632,6 +792,16 @@ void DirectConnectClient::DescribeInterconnectLoaAsync(const DescribeInterconnec
   m_executor->Submit( [this, request, handler, context](){ this->DescribeInterconnectLoaAsyncHelper( request, handler, context ); } );
 }
 
+DescribeInterconnectLoaOutcomeCallable DirectConnectClient::DescribeInterconnectLoaCallable(DescribeInterconnectLoaRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::DescribeInterconnectLoa, this, std::move(request)));
+}
+
+void DirectConnectClient::DescribeInterconnectLoaAsync(DescribeInterconnectLoaRequest&& request, const DescribeInterconnectLoaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::DescribeInterconnectLoaAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::DescribeInterconnectLoaAsyncHelper(const DescribeInterconnectLoaRequest& request, const DescribeInterconnectLoaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeInterconnectLoa(request), context);
@@ -655,7 +825,7 @@ DescribeInterconnectsOutcome DirectConnectClient::DescribeInterconnects(const De
 
 DescribeInterconnectsOutcomeCallable DirectConnectClient::DescribeInterconnectsCallable(const DescribeInterconnectsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeInterconnects(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeInterconnects(request); } );
 }
 
 void DirectConnectClient::DescribeInterconnectsAsync(const DescribeInterconnectsRequest& request, const DescribeInterconnectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -663,6 +833,16 @@ void DirectConnectClient::DescribeInterconnectsAsync(const DescribeInterconnects
   m_executor->Submit( [this, request, handler, context](){ this->DescribeInterconnectsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeInterconnectsOutcomeCallable DirectConnectClient::DescribeInterconnectsCallable(DescribeInterconnectsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::DescribeInterconnects, this, std::move(request)));
+}
+
+void DirectConnectClient::DescribeInterconnectsAsync(DescribeInterconnectsRequest&& request, const DescribeInterconnectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::DescribeInterconnectsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::DescribeInterconnectsAsyncHelper(const DescribeInterconnectsRequest& request, const DescribeInterconnectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeInterconnects(request), context);
@@ -686,7 +866,7 @@ DescribeLocationsOutcome DirectConnectClient::DescribeLocations() const
 
 DescribeLocationsOutcomeCallable DirectConnectClient::DescribeLocationsCallable() const
 {
-  return std::async(std::launch::async, [this](){ return this->DescribeLocations(); } );
+  return m_executor->SubmitCallable([this](){ return this->DescribeLocations(); } );
 }
 
 void DirectConnectClient::DescribeLocationsAsync(const DescribeLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -717,7 +897,7 @@ DescribeVirtualGatewaysOutcome DirectConnectClient::DescribeVirtualGateways() co
 
 DescribeVirtualGatewaysOutcomeCallable DirectConnectClient::DescribeVirtualGatewaysCallable() const
 {
-  return std::async(std::launch::async, [this](){ return this->DescribeVirtualGateways(); } );
+  return m_executor->SubmitCallable([this](){ return this->DescribeVirtualGateways(); } );
 }
 
 void DirectConnectClient::DescribeVirtualGatewaysAsync(const DescribeVirtualGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -748,7 +928,7 @@ DescribeVirtualInterfacesOutcome DirectConnectClient::DescribeVirtualInterfaces(
 
 DescribeVirtualInterfacesOutcomeCallable DirectConnectClient::DescribeVirtualInterfacesCallable(const DescribeVirtualInterfacesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVirtualInterfaces(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVirtualInterfaces(request); } );
 }
 
 void DirectConnectClient::DescribeVirtualInterfacesAsync(const DescribeVirtualInterfacesRequest& request, const DescribeVirtualInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -756,8 +936,125 @@ void DirectConnectClient::DescribeVirtualInterfacesAsync(const DescribeVirtualIn
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVirtualInterfacesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeVirtualInterfacesOutcomeCallable DirectConnectClient::DescribeVirtualInterfacesCallable(DescribeVirtualInterfacesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectConnectClient::DescribeVirtualInterfaces, this, std::move(request)));
+}
+
+void DirectConnectClient::DescribeVirtualInterfacesAsync(DescribeVirtualInterfacesRequest&& request, const DescribeVirtualInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectConnectClient::DescribeVirtualInterfacesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectConnectClient::DescribeVirtualInterfacesAsyncHelper(const DescribeVirtualInterfacesRequest& request, const DescribeVirtualInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeVirtualInterfaces(request), context);
 }
 
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<DirectConnectClient, AllocateConnectionOnInterconnectRequest, AllocateConnectionOnInterconnectOutcome> DirectConnectClient::AllocateConnectionOnInterconnectAwaitable(AllocateConnectionOnInterconnectRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::AllocateConnectionOnInterconnect, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, AllocatePrivateVirtualInterfaceRequest, AllocatePrivateVirtualInterfaceOutcome> DirectConnectClient::AllocatePrivateVirtualInterfaceAwaitable(AllocatePrivateVirtualInterfaceRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::AllocatePrivateVirtualInterface, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, AllocatePublicVirtualInterfaceRequest, AllocatePublicVirtualInterfaceOutcome> DirectConnectClient::AllocatePublicVirtualInterfaceAwaitable(AllocatePublicVirtualInterfaceRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::AllocatePublicVirtualInterface, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, ConfirmConnectionRequest, ConfirmConnectionOutcome> DirectConnectClient::ConfirmConnectionAwaitable(ConfirmConnectionRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::ConfirmConnection, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, ConfirmPrivateVirtualInterfaceRequest, ConfirmPrivateVirtualInterfaceOutcome> DirectConnectClient::ConfirmPrivateVirtualInterfaceAwaitable(ConfirmPrivateVirtualInterfaceRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::ConfirmPrivateVirtualInterface, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, ConfirmPublicVirtualInterfaceRequest, ConfirmPublicVirtualInterfaceOutcome> DirectConnectClient::ConfirmPublicVirtualInterfaceAwaitable(ConfirmPublicVirtualInterfaceRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::ConfirmPublicVirtualInterface, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, CreateConnectionRequest, CreateConnectionOutcome> DirectConnectClient::CreateConnectionAwaitable(CreateConnectionRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::CreateConnection, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, CreateInterconnectRequest, CreateInterconnectOutcome> DirectConnectClient::CreateInterconnectAwaitable(CreateInterconnectRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::CreateInterconnect, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, CreatePrivateVirtualInterfaceRequest, CreatePrivateVirtualInterfaceOutcome> DirectConnectClient::CreatePrivateVirtualInterfaceAwaitable(CreatePrivateVirtualInterfaceRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::CreatePrivateVirtualInterface, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, CreatePublicVirtualInterfaceRequest, CreatePublicVirtualInterfaceOutcome> DirectConnectClient::CreatePublicVirtualInterfaceAwaitable(CreatePublicVirtualInterfaceRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::CreatePublicVirtualInterface, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, DeleteConnectionRequest, DeleteConnectionOutcome> DirectConnectClient::DeleteConnectionAwaitable(DeleteConnectionRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::DeleteConnection, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, DeleteInterconnectRequest, DeleteInterconnectOutcome> DirectConnectClient::DeleteInterconnectAwaitable(DeleteInterconnectRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::DeleteInterconnect, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, DeleteVirtualInterfaceRequest, DeleteVirtualInterfaceOutcome> DirectConnectClient::DeleteVirtualInterfaceAwaitable(DeleteVirtualInterfaceRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::DeleteVirtualInterface, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, DescribeConnectionLoaRequest, DescribeConnectionLoaOutcome> DirectConnectClient::DescribeConnectionLoaAwaitable(DescribeConnectionLoaRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::DescribeConnectionLoa, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, DescribeConnectionsRequest, DescribeConnectionsOutcome> DirectConnectClient::DescribeConnectionsAwaitable(DescribeConnectionsRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::DescribeConnections, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, DescribeConnectionsOnInterconnectRequest, DescribeConnectionsOnInterconnectOutcome> DirectConnectClient::DescribeConnectionsOnInterconnectAwaitable(DescribeConnectionsOnInterconnectRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::DescribeConnectionsOnInterconnect, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, DescribeInterconnectLoaRequest, DescribeInterconnectLoaOutcome> DirectConnectClient::DescribeInterconnectLoaAwaitable(DescribeInterconnectLoaRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::DescribeInterconnectLoa, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, DescribeInterconnectsRequest, DescribeInterconnectsOutcome> DirectConnectClient::DescribeInterconnectsAwaitable(DescribeInterconnectsRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::DescribeInterconnects, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, void, DescribeLocationsOutcome> DirectConnectClient::DescribeLocationsAwaitable() const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::DescribeLocations } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, void, DescribeVirtualGatewaysOutcome> DirectConnectClient::DescribeVirtualGatewaysAwaitable() const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::DescribeVirtualGateways } };
+}
+
+ClientOperationAwaitable<DirectConnectClient, DescribeVirtualInterfacesRequest, DescribeVirtualInterfacesOutcome> DirectConnectClient::DescribeVirtualInterfacesAwaitable(DescribeVirtualInterfacesRequest request) const
+{
+  return { m_executor.get(), { this, &DirectConnectClient::DescribeVirtualInterfaces, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
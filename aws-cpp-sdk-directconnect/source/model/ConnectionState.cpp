@@ -29,51 +29,47 @@ namespace Aws
       namespace ConnectionStateMapper
       {
 
-        static const int ordering_HASH = HashingUtils::HashString("ordering");
-        static const int requested_HASH = HashingUtils::HashString("requested");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int down_HASH = HashingUtils::HashString("down");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-        static const int rejected_HASH = HashingUtils::HashString("rejected");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ordering_HASH = 1234314708;
+        static const int requested_HASH = 693933934;
+        static const int pending_HASH = -682587753;
+        static const int available_HASH = -733902135;
+        static const int down_HASH = 3089570;
+        static const int deleting_HASH = 819717032;
+        static const int deleted_HASH = 1550463001;
+        static const int rejected_HASH = -608496514;
 
 
         ConnectionState GetConnectionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ordering_HASH)
+          switch (hashCode)
           {
+          case ordering_HASH:
             return ConnectionState::ordering;
-          }
-          else if (hashCode == requested_HASH)
-          {
+          case requested_HASH:
             return ConnectionState::requested;
-          }
-          else if (hashCode == pending_HASH)
-          {
+          case pending_HASH:
             return ConnectionState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
+          case available_HASH:
             return ConnectionState::available;
-          }
-          else if (hashCode == down_HASH)
-          {
+          case down_HASH:
             return ConnectionState::down;
-          }
-          else if (hashCode == deleting_HASH)
-          {
+          case deleting_HASH:
             return ConnectionState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
+          case deleted_HASH:
             return ConnectionState::deleted;
-          }
-          else if (hashCode == rejected_HASH)
-          {
+          case rejected_HASH:
             return ConnectionState::rejected;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace LoaContentTypeMapper
       {
 
-        static const int application_pdf_HASH = HashingUtils::HashString("application/pdf");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int application_pdf_HASH = -1248334925;
 
 
         LoaContentType GetLoaContentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == application_pdf_HASH)
+          switch (hashCode)
           {
+          case application_pdf_HASH:
             return LoaContentType::application_pdf;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
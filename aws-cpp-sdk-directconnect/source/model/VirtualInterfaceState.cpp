@@ -29,51 +29,47 @@ namespace Aws
       namespace VirtualInterfaceStateMapper
       {
 
-        static const int confirming_HASH = HashingUtils::HashString("confirming");
-        static const int verifying_HASH = HashingUtils::HashString("verifying");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int down_HASH = HashingUtils::HashString("down");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-        static const int rejected_HASH = HashingUtils::HashString("rejected");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int confirming_HASH = 842414370;
+        static const int verifying_HASH = -1695870775;
+        static const int pending_HASH = -682587753;
+        static const int available_HASH = -733902135;
+        static const int down_HASH = 3089570;
+        static const int deleting_HASH = 819717032;
+        static const int deleted_HASH = 1550463001;
+        static const int rejected_HASH = -608496514;
 
 
         VirtualInterfaceState GetVirtualInterfaceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == confirming_HASH)
+          switch (hashCode)
           {
+          case confirming_HASH:
             return VirtualInterfaceState::confirming;
-          }
-          else if (hashCode == verifying_HASH)
-          {
+          case verifying_HASH:
             return VirtualInterfaceState::verifying;
-          }
-          else if (hashCode == pending_HASH)
-          {
+          case pending_HASH:
             return VirtualInterfaceState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
+          case available_HASH:
             return VirtualInterfaceState::available;
-          }
-          else if (hashCode == down_HASH)
-          {
+          case down_HASH:
             return VirtualInterfaceState::down;
-          }
-          else if (hashCode == deleting_HASH)
-          {
+          case deleting_HASH:
             return VirtualInterfaceState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
+          case deleted_HASH:
             return VirtualInterfaceState::deleted;
-          }
-          else if (hashCode == rejected_HASH)
-          {
+          case rejected_HASH:
             return VirtualInterfaceState::rejected;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
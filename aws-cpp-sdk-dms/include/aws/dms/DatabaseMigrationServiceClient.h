@@ -53,6 +53,9 @@
 #include <aws/dms/model/StopReplicationTaskResult.h>
 #include <aws/dms/model/TestConnectionResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -295,6 +298,18 @@ namespace Model
          */
         virtual void AddTagsToResourceAsync(const Model::AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToResourceCallable(const Model::AddTagsToResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsToResourceOutcomeCallable AddTagsToResourceCallable(Model::AddTagsToResourceRequest&& request) const;
+
+        /**
+         * Same as AddTagsToResourceAsync(const Model::AddTagsToResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsToResourceAsync(Model::AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an endpoint using the provided settings.</p>
          */
@@ -314,6 +329,18 @@ namespace Model
          */
         virtual void CreateEndpointAsync(const Model::CreateEndpointRequest& request, const CreateEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateEndpointCallable(const Model::CreateEndpointRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateEndpointOutcomeCallable CreateEndpointCallable(Model::CreateEndpointRequest&& request) const;
+
+        /**
+         * Same as CreateEndpointAsync(const Model::CreateEndpointRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateEndpointAsync(Model::CreateEndpointRequest&& request, const CreateEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates the replication instance using the specified parameters.</p>
          */
@@ -333,6 +360,18 @@ namespace Model
          */
         virtual void CreateReplicationInstanceAsync(const Model::CreateReplicationInstanceRequest& request, const CreateReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateReplicationInstanceCallable(const Model::CreateReplicationInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateReplicationInstanceOutcomeCallable CreateReplicationInstanceCallable(Model::CreateReplicationInstanceRequest&& request) const;
+
+        /**
+         * Same as CreateReplicationInstanceAsync(const Model::CreateReplicationInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateReplicationInstanceAsync(Model::CreateReplicationInstanceRequest&& request, const CreateReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a replication subnet group given a list of the subnet IDs in a
          * VPC.</p>
@@ -355,6 +394,18 @@ namespace Model
          */
         virtual void CreateReplicationSubnetGroupAsync(const Model::CreateReplicationSubnetGroupRequest& request, const CreateReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateReplicationSubnetGroupCallable(const Model::CreateReplicationSubnetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateReplicationSubnetGroupOutcomeCallable CreateReplicationSubnetGroupCallable(Model::CreateReplicationSubnetGroupRequest&& request) const;
+
+        /**
+         * Same as CreateReplicationSubnetGroupAsync(const Model::CreateReplicationSubnetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateReplicationSubnetGroupAsync(Model::CreateReplicationSubnetGroupRequest&& request, const CreateReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a replication task using the specified parameters.</p>
          */
@@ -374,6 +425,18 @@ namespace Model
          */
         virtual void CreateReplicationTaskAsync(const Model::CreateReplicationTaskRequest& request, const CreateReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateReplicationTaskCallable(const Model::CreateReplicationTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateReplicationTaskOutcomeCallable CreateReplicationTaskCallable(Model::CreateReplicationTaskRequest&& request) const;
+
+        /**
+         * Same as CreateReplicationTaskAsync(const Model::CreateReplicationTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateReplicationTaskAsync(Model::CreateReplicationTaskRequest&& request, const CreateReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified certificate. </p>
          */
@@ -393,6 +456,18 @@ namespace Model
          */
         virtual void DeleteCertificateAsync(const Model::DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCertificateCallable(const Model::DeleteCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteCertificateOutcomeCallable DeleteCertificateCallable(Model::DeleteCertificateRequest&& request) const;
+
+        /**
+         * Same as DeleteCertificateAsync(const Model::DeleteCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteCertificateAsync(Model::DeleteCertificateRequest&& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified endpoint.</p> <note> <p>All tasks associated with the
          * endpoint must be deleted before you can delete the endpoint.</p> </note> <p/>
@@ -415,6 +490,18 @@ namespace Model
          */
         virtual void DeleteEndpointAsync(const Model::DeleteEndpointRequest& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteEndpointCallable(const Model::DeleteEndpointRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteEndpointOutcomeCallable DeleteEndpointCallable(Model::DeleteEndpointRequest&& request) const;
+
+        /**
+         * Same as DeleteEndpointAsync(const Model::DeleteEndpointRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteEndpointAsync(Model::DeleteEndpointRequest&& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified replication instance.</p> <note> <p>You must delete any
          * migration tasks that are associated with the replication instance before you can
@@ -440,6 +527,18 @@ namespace Model
          */
         virtual void DeleteReplicationInstanceAsync(const Model::DeleteReplicationInstanceRequest& request, const DeleteReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteReplicationInstanceCallable(const Model::DeleteReplicationInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteReplicationInstanceOutcomeCallable DeleteReplicationInstanceCallable(Model::DeleteReplicationInstanceRequest&& request) const;
+
+        /**
+         * Same as DeleteReplicationInstanceAsync(const Model::DeleteReplicationInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteReplicationInstanceAsync(Model::DeleteReplicationInstanceRequest&& request, const DeleteReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a subnet group.</p>
          */
@@ -459,6 +558,18 @@ namespace Model
          */
         virtual void DeleteReplicationSubnetGroupAsync(const Model::DeleteReplicationSubnetGroupRequest& request, const DeleteReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteReplicationSubnetGroupCallable(const Model::DeleteReplicationSubnetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteReplicationSubnetGroupOutcomeCallable DeleteReplicationSubnetGroupCallable(Model::DeleteReplicationSubnetGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteReplicationSubnetGroupAsync(const Model::DeleteReplicationSubnetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteReplicationSubnetGroupAsync(Model::DeleteReplicationSubnetGroupRequest&& request, const DeleteReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified replication task.</p>
          */
@@ -478,6 +589,18 @@ namespace Model
          */
         virtual void DeleteReplicationTaskAsync(const Model::DeleteReplicationTaskRequest& request, const DeleteReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteReplicationTaskCallable(const Model::DeleteReplicationTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteReplicationTaskOutcomeCallable DeleteReplicationTaskCallable(Model::DeleteReplicationTaskRequest&& request) const;
+
+        /**
+         * Same as DeleteReplicationTaskAsync(const Model::DeleteReplicationTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteReplicationTaskAsync(Model::DeleteReplicationTaskRequest&& request, const DeleteReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all of the AWS DMS attributes for a customer account. The attributes
          * include AWS DMS quotas for the account, such as the number of replication
@@ -509,6 +632,18 @@ namespace Model
          */
         virtual void DescribeAccountAttributesAsync(const Model::DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAccountAttributesCallable(const Model::DescribeAccountAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAccountAttributesOutcomeCallable DescribeAccountAttributesCallable(Model::DescribeAccountAttributesRequest&& request) const;
+
+        /**
+         * Same as DescribeAccountAttributesAsync(const Model::DescribeAccountAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAccountAttributesAsync(Model::DescribeAccountAttributesRequest&& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides a description of the certificate.</p>
          */
@@ -528,6 +663,18 @@ namespace Model
          */
         virtual void DescribeCertificatesAsync(const Model::DescribeCertificatesRequest& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCertificatesCallable(const Model::DescribeCertificatesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCertificatesOutcomeCallable DescribeCertificatesCallable(Model::DescribeCertificatesRequest&& request) const;
+
+        /**
+         * Same as DescribeCertificatesAsync(const Model::DescribeCertificatesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCertificatesAsync(Model::DescribeCertificatesRequest&& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the status of the connections that have been made between the
          * replication instance and an endpoint. Connections are created when you test an
@@ -553,6 +700,18 @@ namespace Model
          */
         virtual void DescribeConnectionsAsync(const Model::DescribeConnectionsRequest& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConnectionsCallable(const Model::DescribeConnectionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeConnectionsOutcomeCallable DescribeConnectionsCallable(Model::DescribeConnectionsRequest&& request) const;
+
+        /**
+         * Same as DescribeConnectionsAsync(const Model::DescribeConnectionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeConnectionsAsync(Model::DescribeConnectionsRequest&& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the type of endpoints available.</p>
          */
@@ -572,6 +731,18 @@ namespace Model
          */
         virtual void DescribeEndpointTypesAsync(const Model::DescribeEndpointTypesRequest& request, const DescribeEndpointTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEndpointTypesCallable(const Model::DescribeEndpointTypesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEndpointTypesOutcomeCallable DescribeEndpointTypesCallable(Model::DescribeEndpointTypesRequest&& request) const;
+
+        /**
+         * Same as DescribeEndpointTypesAsync(const Model::DescribeEndpointTypesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEndpointTypesAsync(Model::DescribeEndpointTypesRequest&& request, const DescribeEndpointTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the endpoints for your account in the current
          * region.</p>
@@ -594,6 +765,18 @@ namespace Model
          */
         virtual void DescribeEndpointsAsync(const Model::DescribeEndpointsRequest& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEndpointsCallable(const Model::DescribeEndpointsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEndpointsOutcomeCallable DescribeEndpointsCallable(Model::DescribeEndpointsRequest&& request) const;
+
+        /**
+         * Same as DescribeEndpointsAsync(const Model::DescribeEndpointsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEndpointsAsync(Model::DescribeEndpointsRequest&& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the replication instance types that can be created
          * in the specified region.</p>
@@ -616,6 +799,18 @@ namespace Model
          */
         virtual void DescribeOrderableReplicationInstancesAsync(const Model::DescribeOrderableReplicationInstancesRequest& request, const DescribeOrderableReplicationInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeOrderableReplicationInstancesCallable(const Model::DescribeOrderableReplicationInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeOrderableReplicationInstancesOutcomeCallable DescribeOrderableReplicationInstancesCallable(Model::DescribeOrderableReplicationInstancesRequest&& request) const;
+
+        /**
+         * Same as DescribeOrderableReplicationInstancesAsync(const Model::DescribeOrderableReplicationInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeOrderableReplicationInstancesAsync(Model::DescribeOrderableReplicationInstancesRequest&& request, const DescribeOrderableReplicationInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the status of the RefreshSchemas operation.</p>
          */
@@ -635,6 +830,18 @@ namespace Model
          */
         virtual void DescribeRefreshSchemasStatusAsync(const Model::DescribeRefreshSchemasStatusRequest& request, const DescribeRefreshSchemasStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRefreshSchemasStatusCallable(const Model::DescribeRefreshSchemasStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeRefreshSchemasStatusOutcomeCallable DescribeRefreshSchemasStatusCallable(Model::DescribeRefreshSchemasStatusRequest&& request) const;
+
+        /**
+         * Same as DescribeRefreshSchemasStatusAsync(const Model::DescribeRefreshSchemasStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeRefreshSchemasStatusAsync(Model::DescribeRefreshSchemasStatusRequest&& request, const DescribeRefreshSchemasStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about replication instances for your account in the
          * current region.</p>
@@ -657,6 +864,18 @@ namespace Model
          */
         virtual void DescribeReplicationInstancesAsync(const Model::DescribeReplicationInstancesRequest& request, const DescribeReplicationInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReplicationInstancesCallable(const Model::DescribeReplicationInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReplicationInstancesOutcomeCallable DescribeReplicationInstancesCallable(Model::DescribeReplicationInstancesRequest&& request) const;
+
+        /**
+         * Same as DescribeReplicationInstancesAsync(const Model::DescribeReplicationInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReplicationInstancesAsync(Model::DescribeReplicationInstancesRequest&& request, const DescribeReplicationInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the replication subnet groups.</p>
          */
@@ -676,6 +895,18 @@ namespace Model
          */
         virtual void DescribeReplicationSubnetGroupsAsync(const Model::DescribeReplicationSubnetGroupsRequest& request, const DescribeReplicationSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReplicationSubnetGroupsCallable(const Model::DescribeReplicationSubnetGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReplicationSubnetGroupsOutcomeCallable DescribeReplicationSubnetGroupsCallable(Model::DescribeReplicationSubnetGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeReplicationSubnetGroupsAsync(const Model::DescribeReplicationSubnetGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReplicationSubnetGroupsAsync(Model::DescribeReplicationSubnetGroupsRequest&& request, const DescribeReplicationSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about replication tasks for your account in the current
          * region.</p>
@@ -698,6 +929,18 @@ namespace Model
          */
         virtual void DescribeReplicationTasksAsync(const Model::DescribeReplicationTasksRequest& request, const DescribeReplicationTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReplicationTasksCallable(const Model::DescribeReplicationTasksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReplicationTasksOutcomeCallable DescribeReplicationTasksCallable(Model::DescribeReplicationTasksRequest&& request) const;
+
+        /**
+         * Same as DescribeReplicationTasksAsync(const Model::DescribeReplicationTasksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReplicationTasksAsync(Model::DescribeReplicationTasksRequest&& request, const DescribeReplicationTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the schema for the specified endpoint.</p> <p/>
          */
@@ -717,6 +960,18 @@ namespace Model
          */
         virtual void DescribeSchemasAsync(const Model::DescribeSchemasRequest& request, const DescribeSchemasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSchemasCallable(const Model::DescribeSchemasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSchemasOutcomeCallable DescribeSchemasCallable(Model::DescribeSchemasRequest&& request) const;
+
+        /**
+         * Same as DescribeSchemasAsync(const Model::DescribeSchemasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSchemasAsync(Model::DescribeSchemasRequest&& request, const DescribeSchemasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns table statistics on the database migration task, including table
          * name, rows inserted, rows updated, and rows deleted.</p>
@@ -739,6 +994,18 @@ namespace Model
          */
         virtual void DescribeTableStatisticsAsync(const Model::DescribeTableStatisticsRequest& request, const DescribeTableStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTableStatisticsCallable(const Model::DescribeTableStatisticsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTableStatisticsOutcomeCallable DescribeTableStatisticsCallable(Model::DescribeTableStatisticsRequest&& request) const;
+
+        /**
+         * Same as DescribeTableStatisticsAsync(const Model::DescribeTableStatisticsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTableStatisticsAsync(Model::DescribeTableStatisticsRequest&& request, const DescribeTableStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Uploads the specified certificate.</p>
          */
@@ -758,6 +1025,18 @@ namespace Model
          */
         virtual void ImportCertificateAsync(const Model::ImportCertificateRequest& request, const ImportCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ImportCertificateCallable(const Model::ImportCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ImportCertificateOutcomeCallable ImportCertificateCallable(Model::ImportCertificateRequest&& request) const;
+
+        /**
+         * Same as ImportCertificateAsync(const Model::ImportCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ImportCertificateAsync(Model::ImportCertificateRequest&& request, const ImportCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all tags for an AWS DMS resource.</p>
          */
@@ -777,6 +1056,18 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourceCallable(const Model::ListTagsForResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(Model::ListTagsForResourceRequest&& request) const;
+
+        /**
+         * Same as ListTagsForResourceAsync(const Model::ListTagsForResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsForResourceAsync(Model::ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified endpoint.</p>
          */
@@ -796,6 +1087,18 @@ namespace Model
          */
         virtual void ModifyEndpointAsync(const Model::ModifyEndpointRequest& request, const ModifyEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyEndpointCallable(const Model::ModifyEndpointRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyEndpointOutcomeCallable ModifyEndpointCallable(Model::ModifyEndpointRequest&& request) const;
+
+        /**
+         * Same as ModifyEndpointAsync(const Model::ModifyEndpointRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyEndpointAsync(Model::ModifyEndpointRequest&& request, const ModifyEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the replication instance to apply new settings. You can change one
          * or more parameters by specifying these parameters and the new values in the
@@ -824,6 +1127,18 @@ namespace Model
          */
         virtual void ModifyReplicationInstanceAsync(const Model::ModifyReplicationInstanceRequest& request, const ModifyReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyReplicationInstanceCallable(const Model::ModifyReplicationInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyReplicationInstanceOutcomeCallable ModifyReplicationInstanceCallable(Model::ModifyReplicationInstanceRequest&& request) const;
+
+        /**
+         * Same as ModifyReplicationInstanceAsync(const Model::ModifyReplicationInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyReplicationInstanceAsync(Model::ModifyReplicationInstanceRequest&& request, const ModifyReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the settings for the specified replication subnet group.</p>
          */
@@ -843,6 +1158,18 @@ namespace Model
          */
         virtual void ModifyReplicationSubnetGroupAsync(const Model::ModifyReplicationSubnetGroupRequest& request, const ModifyReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyReplicationSubnetGroupCallable(const Model::ModifyReplicationSubnetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyReplicationSubnetGroupOutcomeCallable ModifyReplicationSubnetGroupCallable(Model::ModifyReplicationSubnetGroupRequest&& request) const;
+
+        /**
+         * Same as ModifyReplicationSubnetGroupAsync(const Model::ModifyReplicationSubnetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyReplicationSubnetGroupAsync(Model::ModifyReplicationSubnetGroupRequest&& request, const ModifyReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Populates the schema for the specified endpoint. This is an asynchronous
          * operation and can take several minutes. You can check the status of this
@@ -868,6 +1195,18 @@ namespace Model
          */
         virtual void RefreshSchemasAsync(const Model::RefreshSchemasRequest& request, const RefreshSchemasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RefreshSchemasCallable(const Model::RefreshSchemasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RefreshSchemasOutcomeCallable RefreshSchemasCallable(Model::RefreshSchemasRequest&& request) const;
+
+        /**
+         * Same as RefreshSchemasAsync(const Model::RefreshSchemasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RefreshSchemasAsync(Model::RefreshSchemasRequest&& request, const RefreshSchemasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes metadata tags from a DMS resource.</p>
          */
@@ -887,6 +1226,18 @@ namespace Model
          */
         virtual void RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromResourceCallable(const Model::RemoveTagsFromResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsFromResourceOutcomeCallable RemoveTagsFromResourceCallable(Model::RemoveTagsFromResourceRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsFromResourceAsync(Model::RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts the replication task.</p>
          */
@@ -906,6 +1257,18 @@ namespace Model
          */
         virtual void StartReplicationTaskAsync(const Model::StartReplicationTaskRequest& request, const StartReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartReplicationTaskCallable(const Model::StartReplicationTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StartReplicationTaskOutcomeCallable StartReplicationTaskCallable(Model::StartReplicationTaskRequest&& request) const;
+
+        /**
+         * Same as StartReplicationTaskAsync(const Model::StartReplicationTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StartReplicationTaskAsync(Model::StartReplicationTaskRequest&& request, const StartReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stops the replication task.</p> <p/>
          */
@@ -925,6 +1288,18 @@ namespace Model
          */
         virtual void StopReplicationTaskAsync(const Model::StopReplicationTaskRequest& request, const StopReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopReplicationTaskCallable(const Model::StopReplicationTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StopReplicationTaskOutcomeCallable StopReplicationTaskCallable(Model::StopReplicationTaskRequest&& request) const;
+
+        /**
+         * Same as StopReplicationTaskAsync(const Model::StopReplicationTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StopReplicationTaskAsync(Model::StopReplicationTaskRequest&& request, const StopReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Tests the connection between the replication instance and the endpoint.</p>
          */
@@ -944,6 +1319,230 @@ namespace Model
          */
         virtual void TestConnectionAsync(const Model::TestConnectionRequest& request, const TestConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TestConnectionCallable(const Model::TestConnectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TestConnectionOutcomeCallable TestConnectionCallable(Model::TestConnectionRequest&& request) const;
+
+        /**
+         * Same as TestConnectionAsync(const Model::TestConnectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TestConnectionAsync(Model::TestConnectionRequest&& request, const TestConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeCertificates(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DatabaseMigrationServiceClient, Model::DescribeCertificatesRequest, Model::DescribeCertificatesOutcome> DescribeCertificatesPaginator(const Model::DescribeCertificatesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeConnections(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DatabaseMigrationServiceClient, Model::DescribeConnectionsRequest, Model::DescribeConnectionsOutcome> DescribeConnectionsPaginator(const Model::DescribeConnectionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeEndpointTypes(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DatabaseMigrationServiceClient, Model::DescribeEndpointTypesRequest, Model::DescribeEndpointTypesOutcome> DescribeEndpointTypesPaginator(const Model::DescribeEndpointTypesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeEndpoints(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DatabaseMigrationServiceClient, Model::DescribeEndpointsRequest, Model::DescribeEndpointsOutcome> DescribeEndpointsPaginator(const Model::DescribeEndpointsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeOrderableReplicationInstances(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DatabaseMigrationServiceClient, Model::DescribeOrderableReplicationInstancesRequest, Model::DescribeOrderableReplicationInstancesOutcome> DescribeOrderableReplicationInstancesPaginator(const Model::DescribeOrderableReplicationInstancesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeReplicationInstances(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DatabaseMigrationServiceClient, Model::DescribeReplicationInstancesRequest, Model::DescribeReplicationInstancesOutcome> DescribeReplicationInstancesPaginator(const Model::DescribeReplicationInstancesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeReplicationSubnetGroups(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DatabaseMigrationServiceClient, Model::DescribeReplicationSubnetGroupsRequest, Model::DescribeReplicationSubnetGroupsOutcome> DescribeReplicationSubnetGroupsPaginator(const Model::DescribeReplicationSubnetGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeReplicationTasks(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DatabaseMigrationServiceClient, Model::DescribeReplicationTasksRequest, Model::DescribeReplicationTasksOutcome> DescribeReplicationTasksPaginator(const Model::DescribeReplicationTasksRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeSchemas(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DatabaseMigrationServiceClient, Model::DescribeSchemasRequest, Model::DescribeSchemasOutcome> DescribeSchemasPaginator(const Model::DescribeSchemasRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeTableStatistics(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DatabaseMigrationServiceClient, Model::DescribeTableStatisticsRequest, Model::DescribeTableStatisticsOutcome> DescribeTableStatisticsPaginator(const Model::DescribeTableStatisticsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddTagsToResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::AddTagsToResourceRequest, Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(Model::AddTagsToResourceRequest request) const;
+
+        /**
+         * co_await-able form of CreateEndpoint(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::CreateEndpointRequest, Model::CreateEndpointOutcome> CreateEndpointAwaitable(Model::CreateEndpointRequest request) const;
+
+        /**
+         * co_await-able form of CreateReplicationInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::CreateReplicationInstanceRequest, Model::CreateReplicationInstanceOutcome> CreateReplicationInstanceAwaitable(Model::CreateReplicationInstanceRequest request) const;
+
+        /**
+         * co_await-able form of CreateReplicationSubnetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::CreateReplicationSubnetGroupRequest, Model::CreateReplicationSubnetGroupOutcome> CreateReplicationSubnetGroupAwaitable(Model::CreateReplicationSubnetGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateReplicationTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::CreateReplicationTaskRequest, Model::CreateReplicationTaskOutcome> CreateReplicationTaskAwaitable(Model::CreateReplicationTaskRequest request) const;
+
+        /**
+         * co_await-able form of DeleteCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DeleteCertificateRequest, Model::DeleteCertificateOutcome> DeleteCertificateAwaitable(Model::DeleteCertificateRequest request) const;
+
+        /**
+         * co_await-able form of DeleteEndpoint(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DeleteEndpointRequest, Model::DeleteEndpointOutcome> DeleteEndpointAwaitable(Model::DeleteEndpointRequest request) const;
+
+        /**
+         * co_await-able form of DeleteReplicationInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DeleteReplicationInstanceRequest, Model::DeleteReplicationInstanceOutcome> DeleteReplicationInstanceAwaitable(Model::DeleteReplicationInstanceRequest request) const;
+
+        /**
+         * co_await-able form of DeleteReplicationSubnetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DeleteReplicationSubnetGroupRequest, Model::DeleteReplicationSubnetGroupOutcome> DeleteReplicationSubnetGroupAwaitable(Model::DeleteReplicationSubnetGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteReplicationTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DeleteReplicationTaskRequest, Model::DeleteReplicationTaskOutcome> DeleteReplicationTaskAwaitable(Model::DeleteReplicationTaskRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAccountAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DescribeAccountAttributesRequest, Model::DescribeAccountAttributesOutcome> DescribeAccountAttributesAwaitable(Model::DescribeAccountAttributesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCertificates(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DescribeCertificatesRequest, Model::DescribeCertificatesOutcome> DescribeCertificatesAwaitable(Model::DescribeCertificatesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeConnections(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DescribeConnectionsRequest, Model::DescribeConnectionsOutcome> DescribeConnectionsAwaitable(Model::DescribeConnectionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEndpointTypes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DescribeEndpointTypesRequest, Model::DescribeEndpointTypesOutcome> DescribeEndpointTypesAwaitable(Model::DescribeEndpointTypesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEndpoints(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DescribeEndpointsRequest, Model::DescribeEndpointsOutcome> DescribeEndpointsAwaitable(Model::DescribeEndpointsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeOrderableReplicationInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DescribeOrderableReplicationInstancesRequest, Model::DescribeOrderableReplicationInstancesOutcome> DescribeOrderableReplicationInstancesAwaitable(Model::DescribeOrderableReplicationInstancesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeRefreshSchemasStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DescribeRefreshSchemasStatusRequest, Model::DescribeRefreshSchemasStatusOutcome> DescribeRefreshSchemasStatusAwaitable(Model::DescribeRefreshSchemasStatusRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReplicationInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DescribeReplicationInstancesRequest, Model::DescribeReplicationInstancesOutcome> DescribeReplicationInstancesAwaitable(Model::DescribeReplicationInstancesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReplicationSubnetGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DescribeReplicationSubnetGroupsRequest, Model::DescribeReplicationSubnetGroupsOutcome> DescribeReplicationSubnetGroupsAwaitable(Model::DescribeReplicationSubnetGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReplicationTasks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DescribeReplicationTasksRequest, Model::DescribeReplicationTasksOutcome> DescribeReplicationTasksAwaitable(Model::DescribeReplicationTasksRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSchemas(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DescribeSchemasRequest, Model::DescribeSchemasOutcome> DescribeSchemasAwaitable(Model::DescribeSchemasRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTableStatistics(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::DescribeTableStatisticsRequest, Model::DescribeTableStatisticsOutcome> DescribeTableStatisticsAwaitable(Model::DescribeTableStatisticsRequest request) const;
+
+        /**
+         * co_await-able form of ImportCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::ImportCertificateRequest, Model::ImportCertificateOutcome> ImportCertificateAwaitable(Model::ImportCertificateRequest request) const;
+
+        /**
+         * co_await-able form of ListTagsForResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::ListTagsForResourceRequest, Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(Model::ListTagsForResourceRequest request) const;
+
+        /**
+         * co_await-able form of ModifyEndpoint(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::ModifyEndpointRequest, Model::ModifyEndpointOutcome> ModifyEndpointAwaitable(Model::ModifyEndpointRequest request) const;
+
+        /**
+         * co_await-able form of ModifyReplicationInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::ModifyReplicationInstanceRequest, Model::ModifyReplicationInstanceOutcome> ModifyReplicationInstanceAwaitable(Model::ModifyReplicationInstanceRequest request) const;
+
+        /**
+         * co_await-able form of ModifyReplicationSubnetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::ModifyReplicationSubnetGroupRequest, Model::ModifyReplicationSubnetGroupOutcome> ModifyReplicationSubnetGroupAwaitable(Model::ModifyReplicationSubnetGroupRequest request) const;
+
+        /**
+         * co_await-able form of RefreshSchemas(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::RefreshSchemasRequest, Model::RefreshSchemasOutcome> RefreshSchemasAwaitable(Model::RefreshSchemasRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTagsFromResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::RemoveTagsFromResourceRequest, Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(Model::RemoveTagsFromResourceRequest request) const;
+
+        /**
+         * co_await-able form of StartReplicationTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::StartReplicationTaskRequest, Model::StartReplicationTaskOutcome> StartReplicationTaskAwaitable(Model::StartReplicationTaskRequest request) const;
+
+        /**
+         * co_await-able form of StopReplicationTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::StopReplicationTaskRequest, Model::StopReplicationTaskOutcome> StopReplicationTaskAwaitable(Model::StopReplicationTaskRequest request) const;
+
+        /**
+         * co_await-able form of TestConnection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DatabaseMigrationServiceClient, Model::TestConnectionRequest, Model::TestConnectionOutcome> TestConnectionAwaitable(Model::TestConnectionRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     CreateEndpointRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateEndpoint"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateReplicationInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateReplicationInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
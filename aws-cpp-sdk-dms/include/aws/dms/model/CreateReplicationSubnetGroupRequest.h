@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateReplicationSubnetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateReplicationSubnetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
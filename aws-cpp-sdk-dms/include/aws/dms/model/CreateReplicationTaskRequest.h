@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     CreateReplicationTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateReplicationTask"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
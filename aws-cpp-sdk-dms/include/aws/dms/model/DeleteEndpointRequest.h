@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteEndpointRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteEndpoint"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
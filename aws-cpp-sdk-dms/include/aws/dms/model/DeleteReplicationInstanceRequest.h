@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteReplicationInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteReplicationInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
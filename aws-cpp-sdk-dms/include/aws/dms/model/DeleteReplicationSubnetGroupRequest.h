@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteReplicationSubnetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteReplicationSubnetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
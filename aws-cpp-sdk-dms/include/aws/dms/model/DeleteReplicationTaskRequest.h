@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteReplicationTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteReplicationTask"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeAccountAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAccountAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
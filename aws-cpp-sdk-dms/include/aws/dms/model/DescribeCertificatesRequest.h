@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeCertificatesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCertificates"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeEndpointTypesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEndpointTypes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeEndpointsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEndpoints"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
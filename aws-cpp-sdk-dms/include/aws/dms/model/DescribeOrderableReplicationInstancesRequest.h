@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeOrderableReplicationInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeOrderableReplicationInstances"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeRefreshSchemasStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeRefreshSchemasStatus"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
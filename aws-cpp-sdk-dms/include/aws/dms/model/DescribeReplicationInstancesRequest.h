@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeReplicationInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReplicationInstances"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeReplicationSubnetGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReplicationSubnetGroups"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
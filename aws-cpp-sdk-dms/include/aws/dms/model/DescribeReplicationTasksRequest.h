@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeReplicationTasksRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReplicationTasks"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
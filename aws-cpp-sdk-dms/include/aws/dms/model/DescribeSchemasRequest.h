@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeSchemasRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSchemas"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
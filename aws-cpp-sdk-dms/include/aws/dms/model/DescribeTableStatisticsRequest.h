@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeTableStatisticsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTableStatistics"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ImportCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "ImportCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ModifyEndpointRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyEndpoint"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyReplicationInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyReplicationInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
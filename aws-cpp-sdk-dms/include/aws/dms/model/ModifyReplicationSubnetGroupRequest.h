@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyReplicationSubnetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyReplicationSubnetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
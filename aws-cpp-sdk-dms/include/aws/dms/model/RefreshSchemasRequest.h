@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RefreshSchemasRequest();
+    inline const char* GetServiceRequestName() const override { return "RefreshSchemas"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RemoveTagsFromResourceRequest();
+    inline const char* GetServiceRequestName() const override { return "RemoveTagsFromResource"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
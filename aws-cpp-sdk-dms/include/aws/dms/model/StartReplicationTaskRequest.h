@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     StartReplicationTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "StartReplicationTask"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     StopReplicationTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "StopReplicationTask"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
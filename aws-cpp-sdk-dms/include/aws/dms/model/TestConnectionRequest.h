@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     TestConnectionRequest();
+    inline const char* GetServiceRequestName() const override { return "TestConnection"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
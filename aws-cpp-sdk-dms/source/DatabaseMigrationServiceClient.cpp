@@ -141,7 +141,7 @@ AddTagsToResourceOutcome DatabaseMigrationServiceClient::AddTagsToResource(const
 
 AddTagsToResourceOutcomeCallable DatabaseMigrationServiceClient::AddTagsToResourceCallable(const AddTagsToResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTagsToResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTagsToResource(request); } );
 }
 
 void DatabaseMigrationServiceClient::AddTagsToResourceAsync(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -149,6 +149,16 @@ void DatabaseMigrationServiceClient::AddTagsToResourceAsync(const AddTagsToResou
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsToResourceAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsToResourceOutcomeCallable DatabaseMigrationServiceClient::AddTagsToResourceCallable(AddTagsToResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::AddTagsToResource, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::AddTagsToResourceAsync(AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::AddTagsToResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::AddTagsToResourceAsyncHelper(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTagsToResource(request), context);
@@ -172,7 +182,7 @@ CreateEndpointOutcome DatabaseMigrationServiceClient::CreateEndpoint(const Creat
 
 CreateEndpointOutcomeCallable DatabaseMigrationServiceClient::CreateEndpointCallable(const CreateEndpointRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateEndpoint(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateEndpoint(request); } );
 }
 
 void DatabaseMigrationServiceClient::CreateEndpointAsync(const CreateEndpointRequest& request, const CreateEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -180,6 +190,16 @@ void DatabaseMigrationServiceClient::CreateEndpointAsync(const CreateEndpointReq
   m_executor->Submit( [this, request, handler, context](){ this->CreateEndpointAsyncHelper( request, handler, context ); } );
 }
 
+CreateEndpointOutcomeCallable DatabaseMigrationServiceClient::CreateEndpointCallable(CreateEndpointRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::CreateEndpoint, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::CreateEndpointAsync(CreateEndpointRequest&& request, const CreateEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::CreateEndpointAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::CreateEndpointAsyncHelper(const CreateEndpointRequest& request, const CreateEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateEndpoint(request), context);
@@ -203,7 +223,7 @@ CreateReplicationInstanceOutcome DatabaseMigrationServiceClient::CreateReplicati
 
 CreateReplicationInstanceOutcomeCallable DatabaseMigrationServiceClient::CreateReplicationInstanceCallable(const CreateReplicationInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateReplicationInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateReplicationInstance(request); } );
 }
 
 void DatabaseMigrationServiceClient::CreateReplicationInstanceAsync(const CreateReplicationInstanceRequest& request, const CreateReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -211,6 +231,16 @@ void DatabaseMigrationServiceClient::CreateReplicationInstanceAsync(const Create
   m_executor->Submit( [this, request, handler, context](){ this->CreateReplicationInstanceAsyncHelper( request, handler, context ); } );
 }
 
+CreateReplicationInstanceOutcomeCallable DatabaseMigrationServiceClient::CreateReplicationInstanceCallable(CreateReplicationInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::CreateReplicationInstance, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::CreateReplicationInstanceAsync(CreateReplicationInstanceRequest&& request, const CreateReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::CreateReplicationInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::CreateReplicationInstanceAsyncHelper(const CreateReplicationInstanceRequest& request, const CreateReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateReplicationInstance(request), context);
@@ -234,7 +264,7 @@ CreateReplicationSubnetGroupOutcome DatabaseMigrationServiceClient::CreateReplic
 
 CreateReplicationSubnetGroupOutcomeCallable DatabaseMigrationServiceClient::CreateReplicationSubnetGroupCallable(const CreateReplicationSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateReplicationSubnetGroup(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateReplicationSubnetGroup(request); } );
 }
 
 void DatabaseMigrationServiceClient::CreateReplicationSubnetGroupAsync(const CreateReplicationSubnetGroupRequest& request, const CreateReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -242,6 +272,16 @@ void DatabaseMigrationServiceClient::CreateReplicationSubnetGroupAsync(const Cre
   m_executor->Submit( [this, request, handler, context](){ this->CreateReplicationSubnetGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateReplicationSubnetGroupOutcomeCallable DatabaseMigrationServiceClient::CreateReplicationSubnetGroupCallable(CreateReplicationSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::CreateReplicationSubnetGroup, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::CreateReplicationSubnetGroupAsync(CreateReplicationSubnetGroupRequest&& request, const CreateReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::CreateReplicationSubnetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::CreateReplicationSubnetGroupAsyncHelper(const CreateReplicationSubnetGroupRequest& request, const CreateReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateReplicationSubnetGroup(request), context);
@@ -265,7 +305,7 @@ CreateReplicationTaskOutcome DatabaseMigrationServiceClient::CreateReplicationTa
 
 CreateReplicationTaskOutcomeCallable DatabaseMigrationServiceClient::CreateReplicationTaskCallable(const CreateReplicationTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateReplicationTask(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateReplicationTask(request); } );
 }
 
 void DatabaseMigrationServiceClient::CreateReplicationTaskAsync(const CreateReplicationTaskRequest& request, const CreateReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -273,6 +313,16 @@ void DatabaseMigrationServiceClient::CreateReplicationTaskAsync(const CreateRepl
   m_executor->Submit( [this, request, handler, context](){ this->CreateReplicationTaskAsyncHelper( request, handler, context ); } );
 }
 
+CreateReplicationTaskOutcomeCallable DatabaseMigrationServiceClient::CreateReplicationTaskCallable(CreateReplicationTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::CreateReplicationTask, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::CreateReplicationTaskAsync(CreateReplicationTaskRequest&& request, const CreateReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::CreateReplicationTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::CreateReplicationTaskAsyncHelper(const CreateReplicationTaskRequest& request, const CreateReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateReplicationTask(request), context);
@@ -296,7 +346,7 @@ DeleteCertificateOutcome DatabaseMigrationServiceClient::DeleteCertificate(const
 
 DeleteCertificateOutcomeCallable DatabaseMigrationServiceClient::DeleteCertificateCallable(const DeleteCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteCertificate(request); } );
 }
 
 void DatabaseMigrationServiceClient::DeleteCertificateAsync(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -304,6 +354,16 @@ void DatabaseMigrationServiceClient::DeleteCertificateAsync(const DeleteCertific
   m_executor->Submit( [this, request, handler, context](){ this->DeleteCertificateAsyncHelper( request, handler, context ); } );
 }
 
+DeleteCertificateOutcomeCallable DatabaseMigrationServiceClient::DeleteCertificateCallable(DeleteCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DeleteCertificate, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DeleteCertificateAsync(DeleteCertificateRequest&& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DeleteCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DeleteCertificateAsyncHelper(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteCertificate(request), context);
@@ -327,7 +387,7 @@ DeleteEndpointOutcome DatabaseMigrationServiceClient::DeleteEndpoint(const Delet
 
 DeleteEndpointOutcomeCallable DatabaseMigrationServiceClient::DeleteEndpointCallable(const DeleteEndpointRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteEndpoint(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteEndpoint(request); } );
 }
 
 void DatabaseMigrationServiceClient::DeleteEndpointAsync(const DeleteEndpointRequest& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -335,6 +395,16 @@ void DatabaseMigrationServiceClient::DeleteEndpointAsync(const DeleteEndpointReq
   m_executor->Submit( [this, request, handler, context](){ this->DeleteEndpointAsyncHelper( request, handler, context ); } );
 }
 
+DeleteEndpointOutcomeCallable DatabaseMigrationServiceClient::DeleteEndpointCallable(DeleteEndpointRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DeleteEndpoint, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DeleteEndpointAsync(DeleteEndpointRequest&& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DeleteEndpointAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DeleteEndpointAsyncHelper(const DeleteEndpointRequest& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteEndpoint(request), context);
@@ -358,7 +428,7 @@ DeleteReplicationInstanceOutcome DatabaseMigrationServiceClient::DeleteReplicati
 
 DeleteReplicationInstanceOutcomeCallable DatabaseMigrationServiceClient::DeleteReplicationInstanceCallable(const DeleteReplicationInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteReplicationInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteReplicationInstance(request); } );
 }
 
 void DatabaseMigrationServiceClient::DeleteReplicationInstanceAsync(const DeleteReplicationInstanceRequest& request, const DeleteReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -366,6 +436,16 @@ void DatabaseMigrationServiceClient::DeleteReplicationInstanceAsync(const Delete
   m_executor->Submit( [this, request, handler, context](){ this->DeleteReplicationInstanceAsyncHelper( request, handler, context ); } );
 }
 
+DeleteReplicationInstanceOutcomeCallable DatabaseMigrationServiceClient::DeleteReplicationInstanceCallable(DeleteReplicationInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DeleteReplicationInstance, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DeleteReplicationInstanceAsync(DeleteReplicationInstanceRequest&& request, const DeleteReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DeleteReplicationInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DeleteReplicationInstanceAsyncHelper(const DeleteReplicationInstanceRequest& request, const DeleteReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteReplicationInstance(request), context);
@@ -389,7 +469,7 @@ DeleteReplicationSubnetGroupOutcome DatabaseMigrationServiceClient::DeleteReplic
 
 DeleteReplicationSubnetGroupOutcomeCallable DatabaseMigrationServiceClient::DeleteReplicationSubnetGroupCallable(const DeleteReplicationSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteReplicationSubnetGroup(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteReplicationSubnetGroup(request); } );
 }
 
 void DatabaseMigrationServiceClient::DeleteReplicationSubnetGroupAsync(const DeleteReplicationSubnetGroupRequest& request, const DeleteReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -397,6 +477,16 @@ void DatabaseMigrationServiceClient::DeleteReplicationSubnetGroupAsync(const Del
   m_executor->Submit( [this, request, handler, context](){ this->DeleteReplicationSubnetGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteReplicationSubnetGroupOutcomeCallable DatabaseMigrationServiceClient::DeleteReplicationSubnetGroupCallable(DeleteReplicationSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DeleteReplicationSubnetGroup, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DeleteReplicationSubnetGroupAsync(DeleteReplicationSubnetGroupRequest&& request, const DeleteReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DeleteReplicationSubnetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DeleteReplicationSubnetGroupAsyncHelper(const DeleteReplicationSubnetGroupRequest& request, const DeleteReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteReplicationSubnetGroup(request), context);
@@ -420,7 +510,7 @@ DeleteReplicationTaskOutcome DatabaseMigrationServiceClient::DeleteReplicationTa
 
 DeleteReplicationTaskOutcomeCallable DatabaseMigrationServiceClient::DeleteReplicationTaskCallable(const DeleteReplicationTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteReplicationTask(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteReplicationTask(request); } );
 }
 
 void DatabaseMigrationServiceClient::DeleteReplicationTaskAsync(const DeleteReplicationTaskRequest& request, const DeleteReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -428,6 +518,16 @@ void DatabaseMigrationServiceClient::DeleteReplicationTaskAsync(const DeleteRepl
   m_executor->Submit( [this, request, handler, context](){ this->DeleteReplicationTaskAsyncHelper( request, handler, context ); } );
 }
 
+DeleteReplicationTaskOutcomeCallable DatabaseMigrationServiceClient::DeleteReplicationTaskCallable(DeleteReplicationTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DeleteReplicationTask, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DeleteReplicationTaskAsync(DeleteReplicationTaskRequest&& request, const DeleteReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DeleteReplicationTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DeleteReplicationTaskAsyncHelper(const DeleteReplicationTaskRequest& request, const DeleteReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteReplicationTask(request), context);
@@ -451,7 +551,7 @@ DescribeAccountAttributesOutcome DatabaseMigrationServiceClient::DescribeAccount
 
 DescribeAccountAttributesOutcomeCallable DatabaseMigrationServiceClient::DescribeAccountAttributesCallable(const DescribeAccountAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAccountAttributes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAccountAttributes(request); } );
 }
 
 void DatabaseMigrationServiceClient::DescribeAccountAttributesAsync(const DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -459,6 +559,16 @@ void DatabaseMigrationServiceClient::DescribeAccountAttributesAsync(const Descri
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAccountAttributesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAccountAttributesOutcomeCallable DatabaseMigrationServiceClient::DescribeAccountAttributesCallable(DescribeAccountAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DescribeAccountAttributes, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DescribeAccountAttributesAsync(DescribeAccountAttributesRequest&& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DescribeAccountAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DescribeAccountAttributesAsyncHelper(const DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAccountAttributes(request), context);
@@ -482,7 +592,7 @@ DescribeCertificatesOutcome DatabaseMigrationServiceClient::DescribeCertificates
 
 DescribeCertificatesOutcomeCallable DatabaseMigrationServiceClient::DescribeCertificatesCallable(const DescribeCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCertificates(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCertificates(request); } );
 }
 
 void DatabaseMigrationServiceClient::DescribeCertificatesAsync(const DescribeCertificatesRequest& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -490,6 +600,16 @@ void DatabaseMigrationServiceClient::DescribeCertificatesAsync(const DescribeCer
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCertificatesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCertificatesOutcomeCallable DatabaseMigrationServiceClient::DescribeCertificatesCallable(DescribeCertificatesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DescribeCertificates, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DescribeCertificatesAsync(DescribeCertificatesRequest&& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DescribeCertificatesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DescribeCertificatesAsyncHelper(const DescribeCertificatesRequest& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCertificates(request), context);
@@ -513,7 +633,7 @@ DescribeConnectionsOutcome DatabaseMigrationServiceClient::DescribeConnections(c
 
 DescribeConnectionsOutcomeCallable DatabaseMigrationServiceClient::DescribeConnectionsCallable(const DescribeConnectionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeConnections(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeConnections(request); } );
 }
 
 void DatabaseMigrationServiceClient::DescribeConnectionsAsync(const DescribeConnectionsRequest& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -521,6 +641,16 @@ void DatabaseMigrationServiceClient::DescribeConnectionsAsync(const DescribeConn
   m_executor->Submit( [this, request, handler, context](){ this->DescribeConnectionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeConnectionsOutcomeCallable DatabaseMigrationServiceClient::DescribeConnectionsCallable(DescribeConnectionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DescribeConnections, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DescribeConnectionsAsync(DescribeConnectionsRequest&& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DescribeConnectionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DescribeConnectionsAsyncHelper(const DescribeConnectionsRequest& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeConnections(request), context);
@@ -544,7 +674,7 @@ DescribeEndpointTypesOutcome DatabaseMigrationServiceClient::DescribeEndpointTyp
 
 DescribeEndpointTypesOutcomeCallable DatabaseMigrationServiceClient::DescribeEndpointTypesCallable(const DescribeEndpointTypesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEndpointTypes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEndpointTypes(request); } );
 }
 
 void DatabaseMigrationServiceClient::DescribeEndpointTypesAsync(const DescribeEndpointTypesRequest& request, const DescribeEndpointTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -552,6 +682,16 @@ void DatabaseMigrationServiceClient::DescribeEndpointTypesAsync(const DescribeEn
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEndpointTypesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEndpointTypesOutcomeCallable DatabaseMigrationServiceClient::DescribeEndpointTypesCallable(DescribeEndpointTypesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DescribeEndpointTypes, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DescribeEndpointTypesAsync(DescribeEndpointTypesRequest&& request, const DescribeEndpointTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DescribeEndpointTypesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DescribeEndpointTypesAsyncHelper(const DescribeEndpointTypesRequest& request, const DescribeEndpointTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEndpointTypes(request), context);
@@ -575,7 +715,7 @@ DescribeEndpointsOutcome DatabaseMigrationServiceClient::DescribeEndpoints(const
 
 DescribeEndpointsOutcomeCallable DatabaseMigrationServiceClient::DescribeEndpointsCallable(const DescribeEndpointsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEndpoints(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEndpoints(request); } );
 }
 
 void DatabaseMigrationServiceClient::DescribeEndpointsAsync(const DescribeEndpointsRequest& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -583,6 +723,16 @@ void DatabaseMigrationServiceClient::DescribeEndpointsAsync(const DescribeEndpoi
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEndpointsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEndpointsOutcomeCallable DatabaseMigrationServiceClient::DescribeEndpointsCallable(DescribeEndpointsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DescribeEndpoints, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DescribeEndpointsAsync(DescribeEndpointsRequest&& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DescribeEndpointsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DescribeEndpointsAsyncHelper(const DescribeEndpointsRequest& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEndpoints(request), context);
@@ -606,7 +756,7 @@ DescribeOrderableReplicationInstancesOutcome DatabaseMigrationServiceClient::Des
 
 DescribeOrderableReplicationInstancesOutcomeCallable DatabaseMigrationServiceClient::DescribeOrderableReplicationInstancesCallable(const DescribeOrderableReplicationInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeOrderableReplicationInstances(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeOrderableReplicationInstances(request); } );
 }
 
 void DatabaseMigrationServiceClient::DescribeOrderableReplicationInstancesAsync(const DescribeOrderableReplicationInstancesRequest& request, const DescribeOrderableReplicationInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -614,6 +764,16 @@ void DatabaseMigrationServiceClient::DescribeOrderableReplicationInstancesAsync(
   m_executor->Submit( [this, request, handler, context](){ this->DescribeOrderableReplicationInstancesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeOrderableReplicationInstancesOutcomeCallable DatabaseMigrationServiceClient::DescribeOrderableReplicationInstancesCallable(DescribeOrderableReplicationInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DescribeOrderableReplicationInstances, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DescribeOrderableReplicationInstancesAsync(DescribeOrderableReplicationInstancesRequest&& request, const DescribeOrderableReplicationInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DescribeOrderableReplicationInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DescribeOrderableReplicationInstancesAsyncHelper(const DescribeOrderableReplicationInstancesRequest& request, const DescribeOrderableReplicationInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeOrderableReplicationInstances(request), context);
@@ -637,7 +797,7 @@ DescribeRefreshSchemasStatusOutcome DatabaseMigrationServiceClient::DescribeRefr
 
 DescribeRefreshSchemasStatusOutcomeCallable DatabaseMigrationServiceClient::DescribeRefreshSchemasStatusCallable(const DescribeRefreshSchemasStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeRefreshSchemasStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeRefreshSchemasStatus(request); } );
 }
 
 void DatabaseMigrationServiceClient::DescribeRefreshSchemasStatusAsync(const DescribeRefreshSchemasStatusRequest& request, const DescribeRefreshSchemasStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -645,6 +805,16 @@ void DatabaseMigrationServiceClient::DescribeRefreshSchemasStatusAsync(const Des
   m_executor->Submit( [this, request, handler, context](){ this->DescribeRefreshSchemasStatusAsyncHelper( request, handler, context ); } );
 }
 
+DescribeRefreshSchemasStatusOutcomeCallable DatabaseMigrationServiceClient::DescribeRefreshSchemasStatusCallable(DescribeRefreshSchemasStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DescribeRefreshSchemasStatus, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DescribeRefreshSchemasStatusAsync(DescribeRefreshSchemasStatusRequest&& request, const DescribeRefreshSchemasStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DescribeRefreshSchemasStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DescribeRefreshSchemasStatusAsyncHelper(const DescribeRefreshSchemasStatusRequest& request, const DescribeRefreshSchemasStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeRefreshSchemasStatus(request), context);
@@ -668,7 +838,7 @@ DescribeReplicationInstancesOutcome DatabaseMigrationServiceClient::DescribeRepl
 
 DescribeReplicationInstancesOutcomeCallable DatabaseMigrationServiceClient::DescribeReplicationInstancesCallable(const DescribeReplicationInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReplicationInstances(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReplicationInstances(request); } );
 }
 
 void DatabaseMigrationServiceClient::DescribeReplicationInstancesAsync(const DescribeReplicationInstancesRequest& request, const DescribeReplicationInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -676,6 +846,16 @@ void DatabaseMigrationServiceClient::DescribeReplicationInstancesAsync(const Des
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReplicationInstancesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReplicationInstancesOutcomeCallable DatabaseMigrationServiceClient::DescribeReplicationInstancesCallable(DescribeReplicationInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DescribeReplicationInstances, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DescribeReplicationInstancesAsync(DescribeReplicationInstancesRequest&& request, const DescribeReplicationInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DescribeReplicationInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DescribeReplicationInstancesAsyncHelper(const DescribeReplicationInstancesRequest& request, const DescribeReplicationInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReplicationInstances(request), context);
@@ -699,7 +879,7 @@ DescribeReplicationSubnetGroupsOutcome DatabaseMigrationServiceClient::DescribeR
 
 DescribeReplicationSubnetGroupsOutcomeCallable DatabaseMigrationServiceClient::DescribeReplicationSubnetGroupsCallable(const DescribeReplicationSubnetGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReplicationSubnetGroups(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReplicationSubnetGroups(request); } );
 }
 
 void DatabaseMigrationServiceClient::DescribeReplicationSubnetGroupsAsync(const DescribeReplicationSubnetGroupsRequest& request, const DescribeReplicationSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -707,6 +887,16 @@ void DatabaseMigrationServiceClient::DescribeReplicationSubnetGroupsAsync(const
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReplicationSubnetGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReplicationSubnetGroupsOutcomeCallable DatabaseMigrationServiceClient::DescribeReplicationSubnetGroupsCallable(DescribeReplicationSubnetGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DescribeReplicationSubnetGroups, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DescribeReplicationSubnetGroupsAsync(DescribeReplicationSubnetGroupsRequest&& request, const DescribeReplicationSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DescribeReplicationSubnetGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DescribeReplicationSubnetGroupsAsyncHelper(const DescribeReplicationSubnetGroupsRequest& request, const DescribeReplicationSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReplicationSubnetGroups(request), context);
@@ -730,7 +920,7 @@ DescribeReplicationTasksOutcome DatabaseMigrationServiceClient::DescribeReplicat
 
 DescribeReplicationTasksOutcomeCallable DatabaseMigrationServiceClient::DescribeReplicationTasksCallable(const DescribeReplicationTasksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReplicationTasks(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReplicationTasks(request); } );
 }
 
 void DatabaseMigrationServiceClient::DescribeReplicationTasksAsync(const DescribeReplicationTasksRequest& request, const DescribeReplicationTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -738,6 +928,16 @@ void DatabaseMigrationServiceClient::DescribeReplicationTasksAsync(const Describ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReplicationTasksAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReplicationTasksOutcomeCallable DatabaseMigrationServiceClient::DescribeReplicationTasksCallable(DescribeReplicationTasksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DescribeReplicationTasks, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DescribeReplicationTasksAsync(DescribeReplicationTasksRequest&& request, const DescribeReplicationTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DescribeReplicationTasksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DescribeReplicationTasksAsyncHelper(const DescribeReplicationTasksRequest& request, const DescribeReplicationTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReplicationTasks(request), context);
@@ -761,7 +961,7 @@ DescribeSchemasOutcome DatabaseMigrationServiceClient::DescribeSchemas(const Des
 
 DescribeSchemasOutcomeCallable DatabaseMigrationServiceClient::DescribeSchemasCallable(const DescribeSchemasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSchemas(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSchemas(request); } );
 }
 
 void DatabaseMigrationServiceClient::DescribeSchemasAsync(const DescribeSchemasRequest& request, const DescribeSchemasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -769,6 +969,16 @@ void DatabaseMigrationServiceClient::DescribeSchemasAsync(const DescribeSchemasR
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSchemasAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSchemasOutcomeCallable DatabaseMigrationServiceClient::DescribeSchemasCallable(DescribeSchemasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DescribeSchemas, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DescribeSchemasAsync(DescribeSchemasRequest&& request, const DescribeSchemasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DescribeSchemasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DescribeSchemasAsyncHelper(const DescribeSchemasRequest& request, const DescribeSchemasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSchemas(request), context);
@@ -792,7 +1002,7 @@ DescribeTableStatisticsOutcome DatabaseMigrationServiceClient::DescribeTableStat
 
 DescribeTableStatisticsOutcomeCallable DatabaseMigrationServiceClient::DescribeTableStatisticsCallable(const DescribeTableStatisticsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTableStatistics(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTableStatistics(request); } );
 }
 
 void DatabaseMigrationServiceClient::DescribeTableStatisticsAsync(const DescribeTableStatisticsRequest& request, const DescribeTableStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -800,6 +1010,16 @@ void DatabaseMigrationServiceClient::DescribeTableStatisticsAsync(const Describe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTableStatisticsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTableStatisticsOutcomeCallable DatabaseMigrationServiceClient::DescribeTableStatisticsCallable(DescribeTableStatisticsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::DescribeTableStatistics, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::DescribeTableStatisticsAsync(DescribeTableStatisticsRequest&& request, const DescribeTableStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::DescribeTableStatisticsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::DescribeTableStatisticsAsyncHelper(const DescribeTableStatisticsRequest& request, const DescribeTableStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTableStatistics(request), context);
@@ -823,7 +1043,7 @@ ImportCertificateOutcome DatabaseMigrationServiceClient::ImportCertificate(const
 
 ImportCertificateOutcomeCallable DatabaseMigrationServiceClient::ImportCertificateCallable(const ImportCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ImportCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ImportCertificate(request); } );
 }
 
 void DatabaseMigrationServiceClient::ImportCertificateAsync(const ImportCertificateRequest& request, const ImportCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -831,6 +1051,16 @@ void DatabaseMigrationServiceClient::ImportCertificateAsync(const ImportCertific
   m_executor->Submit( [this, request, handler, context](){ this->ImportCertificateAsyncHelper( request, handler, context ); } );
 }
 
+ImportCertificateOutcomeCallable DatabaseMigrationServiceClient::ImportCertificateCallable(ImportCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::ImportCertificate, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::ImportCertificateAsync(ImportCertificateRequest&& request, const ImportCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::ImportCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::ImportCertificateAsyncHelper(const ImportCertificateRequest& request, const ImportCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ImportCertificate(request), context);
@@ -854,7 +1084,7 @@ ListTagsForResourceOutcome DatabaseMigrationServiceClient::ListTagsForResource(c
 
 ListTagsForResourceOutcomeCallable DatabaseMigrationServiceClient::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTagsForResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTagsForResource(request); } );
 }
 
 void DatabaseMigrationServiceClient::ListTagsForResourceAsync(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -862,6 +1092,16 @@ void DatabaseMigrationServiceClient::ListTagsForResourceAsync(const ListTagsForR
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsForResourceAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsForResourceOutcomeCallable DatabaseMigrationServiceClient::ListTagsForResourceCallable(ListTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::ListTagsForResource, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::ListTagsForResourceAsync(ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::ListTagsForResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTagsForResource(request), context);
@@ -885,7 +1125,7 @@ ModifyEndpointOutcome DatabaseMigrationServiceClient::ModifyEndpoint(const Modif
 
 ModifyEndpointOutcomeCallable DatabaseMigrationServiceClient::ModifyEndpointCallable(const ModifyEndpointRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyEndpoint(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyEndpoint(request); } );
 }
 
 void DatabaseMigrationServiceClient::ModifyEndpointAsync(const ModifyEndpointRequest& request, const ModifyEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -893,6 +1133,16 @@ void DatabaseMigrationServiceClient::ModifyEndpointAsync(const ModifyEndpointReq
   m_executor->Submit( [this, request, handler, context](){ this->ModifyEndpointAsyncHelper( request, handler, context ); } );
 }
 
+ModifyEndpointOutcomeCallable DatabaseMigrationServiceClient::ModifyEndpointCallable(ModifyEndpointRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::ModifyEndpoint, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::ModifyEndpointAsync(ModifyEndpointRequest&& request, const ModifyEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::ModifyEndpointAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::ModifyEndpointAsyncHelper(const ModifyEndpointRequest& request, const ModifyEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyEndpoint(request), context);
@@ -916,7 +1166,7 @@ ModifyReplicationInstanceOutcome DatabaseMigrationServiceClient::ModifyReplicati
 
 ModifyReplicationInstanceOutcomeCallable DatabaseMigrationServiceClient::ModifyReplicationInstanceCallable(const ModifyReplicationInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyReplicationInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyReplicationInstance(request); } );
 }
 
 void DatabaseMigrationServiceClient::ModifyReplicationInstanceAsync(const ModifyReplicationInstanceRequest& request, const ModifyReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -924,6 +1174,16 @@ void DatabaseMigrationServiceClient::ModifyReplicationInstanceAsync(const Modify
   m_executor->Submit( [this, request, handler, context](){ this->ModifyReplicationInstanceAsyncHelper( request, handler, context ); } );
 }
 
+ModifyReplicationInstanceOutcomeCallable DatabaseMigrationServiceClient::ModifyReplicationInstanceCallable(ModifyReplicationInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::ModifyReplicationInstance, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::ModifyReplicationInstanceAsync(ModifyReplicationInstanceRequest&& request, const ModifyReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::ModifyReplicationInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::ModifyReplicationInstanceAsyncHelper(const ModifyReplicationInstanceRequest& request, const ModifyReplicationInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyReplicationInstance(request), context);
@@ -947,7 +1207,7 @@ ModifyReplicationSubnetGroupOutcome DatabaseMigrationServiceClient::ModifyReplic
 
 ModifyReplicationSubnetGroupOutcomeCallable DatabaseMigrationServiceClient::ModifyReplicationSubnetGroupCallable(const ModifyReplicationSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyReplicationSubnetGroup(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyReplicationSubnetGroup(request); } );
 }
 
 void DatabaseMigrationServiceClient::ModifyReplicationSubnetGroupAsync(const ModifyReplicationSubnetGroupRequest& request, const ModifyReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -955,6 +1215,16 @@ void DatabaseMigrationServiceClient::ModifyReplicationSubnetGroupAsync(const Mod
   m_executor->Submit( [this, request, handler, context](){ this->ModifyReplicationSubnetGroupAsyncHelper( request, handler, context ); } );
 }
 
+ModifyReplicationSubnetGroupOutcomeCallable DatabaseMigrationServiceClient::ModifyReplicationSubnetGroupCallable(ModifyReplicationSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::ModifyReplicationSubnetGroup, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::ModifyReplicationSubnetGroupAsync(ModifyReplicationSubnetGroupRequest&& request, const ModifyReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::ModifyReplicationSubnetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::ModifyReplicationSubnetGroupAsyncHelper(const ModifyReplicationSubnetGroupRequest& request, const ModifyReplicationSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyReplicationSubnetGroup(request), context);
@@ -978,7 +1248,7 @@ RefreshSchemasOutcome DatabaseMigrationServiceClient::RefreshSchemas(const Refre
 
 RefreshSchemasOutcomeCallable DatabaseMigrationServiceClient::RefreshSchemasCallable(const RefreshSchemasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RefreshSchemas(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RefreshSchemas(request); } );
 }
 
 void DatabaseMigrationServiceClient::RefreshSchemasAsync(const RefreshSchemasRequest& request, const RefreshSchemasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -986,6 +1256,16 @@ void DatabaseMigrationServiceClient::RefreshSchemasAsync(const RefreshSchemasReq
   m_executor->Submit( [this, request, handler, context](){ this->RefreshSchemasAsyncHelper( request, handler, context ); } );
 }
 
+RefreshSchemasOutcomeCallable DatabaseMigrationServiceClient::RefreshSchemasCallable(RefreshSchemasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::RefreshSchemas, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::RefreshSchemasAsync(RefreshSchemasRequest&& request, const RefreshSchemasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::RefreshSchemasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::RefreshSchemasAsyncHelper(const RefreshSchemasRequest& request, const RefreshSchemasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RefreshSchemas(request), context);
@@ -1009,7 +1289,7 @@ RemoveTagsFromResourceOutcome DatabaseMigrationServiceClient::RemoveTagsFromReso
 
 RemoveTagsFromResourceOutcomeCallable DatabaseMigrationServiceClient::RemoveTagsFromResourceCallable(const RemoveTagsFromResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTagsFromResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTagsFromResource(request); } );
 }
 
 void DatabaseMigrationServiceClient::RemoveTagsFromResourceAsync(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1017,6 +1297,16 @@ void DatabaseMigrationServiceClient::RemoveTagsFromResourceAsync(const RemoveTag
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsFromResourceAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsFromResourceOutcomeCallable DatabaseMigrationServiceClient::RemoveTagsFromResourceCallable(RemoveTagsFromResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::RemoveTagsFromResource, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::RemoveTagsFromResourceAsync(RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::RemoveTagsFromResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::RemoveTagsFromResourceAsyncHelper(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTagsFromResource(request), context);
@@ -1040,7 +1330,7 @@ StartReplicationTaskOutcome DatabaseMigrationServiceClient::StartReplicationTask
 
 StartReplicationTaskOutcomeCallable DatabaseMigrationServiceClient::StartReplicationTaskCallable(const StartReplicationTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StartReplicationTask(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StartReplicationTask(request); } );
 }
 
 void DatabaseMigrationServiceClient::StartReplicationTaskAsync(const StartReplicationTaskRequest& request, const StartReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1048,6 +1338,16 @@ void DatabaseMigrationServiceClient::StartReplicationTaskAsync(const StartReplic
   m_executor->Submit( [this, request, handler, context](){ this->StartReplicationTaskAsyncHelper( request, handler, context ); } );
 }
 
+StartReplicationTaskOutcomeCallable DatabaseMigrationServiceClient::StartReplicationTaskCallable(StartReplicationTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::StartReplicationTask, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::StartReplicationTaskAsync(StartReplicationTaskRequest&& request, const StartReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::StartReplicationTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::StartReplicationTaskAsyncHelper(const StartReplicationTaskRequest& request, const StartReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StartReplicationTask(request), context);
@@ -1071,7 +1371,7 @@ StopReplicationTaskOutcome DatabaseMigrationServiceClient::StopReplicationTask(c
 
 StopReplicationTaskOutcomeCallable DatabaseMigrationServiceClient::StopReplicationTaskCallable(const StopReplicationTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StopReplicationTask(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StopReplicationTask(request); } );
 }
 
 void DatabaseMigrationServiceClient::StopReplicationTaskAsync(const StopReplicationTaskRequest& request, const StopReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1079,6 +1379,16 @@ void DatabaseMigrationServiceClient::StopReplicationTaskAsync(const StopReplicat
   m_executor->Submit( [this, request, handler, context](){ this->StopReplicationTaskAsyncHelper( request, handler, context ); } );
 }
 
+StopReplicationTaskOutcomeCallable DatabaseMigrationServiceClient::StopReplicationTaskCallable(StopReplicationTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::StopReplicationTask, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::StopReplicationTaskAsync(StopReplicationTaskRequest&& request, const StopReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::StopReplicationTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::StopReplicationTaskAsyncHelper(const StopReplicationTaskRequest& request, const StopReplicationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StopReplicationTask(request), context);
@@ -1102,7 +1412,7 @@ TestConnectionOutcome DatabaseMigrationServiceClient::TestConnection(const TestC
 
 TestConnectionOutcomeCallable DatabaseMigrationServiceClient::TestConnectionCallable(const TestConnectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TestConnection(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TestConnection(request); } );
 }
 
 void DatabaseMigrationServiceClient::TestConnectionAsync(const TestConnectionRequest& request, const TestConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1110,8 +1420,350 @@ void DatabaseMigrationServiceClient::TestConnectionAsync(const TestConnectionReq
   m_executor->Submit( [this, request, handler, context](){ this->TestConnectionAsyncHelper( request, handler, context ); } );
 }
 
+TestConnectionOutcomeCallable DatabaseMigrationServiceClient::TestConnectionCallable(TestConnectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DatabaseMigrationServiceClient::TestConnection, this, std::move(request)));
+}
+
+void DatabaseMigrationServiceClient::TestConnectionAsync(TestConnectionRequest&& request, const TestConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DatabaseMigrationServiceClient::TestConnectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DatabaseMigrationServiceClient::TestConnectionAsyncHelper(const TestConnectionRequest& request, const TestConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TestConnection(request), context);
 }
 
+Paginator<DatabaseMigrationServiceClient, DescribeCertificatesRequest, DescribeCertificatesOutcome> DatabaseMigrationServiceClient::DescribeCertificatesPaginator(const DescribeCertificatesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DatabaseMigrationServiceClient, DescribeCertificatesRequest, DescribeCertificatesOutcome>(this, &DatabaseMigrationServiceClient::DescribeCertificates, request,
+    [](const DescribeCertificatesRequest& current, const DescribeCertificatesOutcome& outcome, DescribeCertificatesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DatabaseMigrationServiceClient, DescribeConnectionsRequest, DescribeConnectionsOutcome> DatabaseMigrationServiceClient::DescribeConnectionsPaginator(const DescribeConnectionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DatabaseMigrationServiceClient, DescribeConnectionsRequest, DescribeConnectionsOutcome>(this, &DatabaseMigrationServiceClient::DescribeConnections, request,
+    [](const DescribeConnectionsRequest& current, const DescribeConnectionsOutcome& outcome, DescribeConnectionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DatabaseMigrationServiceClient, DescribeEndpointTypesRequest, DescribeEndpointTypesOutcome> DatabaseMigrationServiceClient::DescribeEndpointTypesPaginator(const DescribeEndpointTypesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DatabaseMigrationServiceClient, DescribeEndpointTypesRequest, DescribeEndpointTypesOutcome>(this, &DatabaseMigrationServiceClient::DescribeEndpointTypes, request,
+    [](const DescribeEndpointTypesRequest& current, const DescribeEndpointTypesOutcome& outcome, DescribeEndpointTypesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DatabaseMigrationServiceClient, DescribeEndpointsRequest, DescribeEndpointsOutcome> DatabaseMigrationServiceClient::DescribeEndpointsPaginator(const DescribeEndpointsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DatabaseMigrationServiceClient, DescribeEndpointsRequest, DescribeEndpointsOutcome>(this, &DatabaseMigrationServiceClient::DescribeEndpoints, request,
+    [](const DescribeEndpointsRequest& current, const DescribeEndpointsOutcome& outcome, DescribeEndpointsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DatabaseMigrationServiceClient, DescribeOrderableReplicationInstancesRequest, DescribeOrderableReplicationInstancesOutcome> DatabaseMigrationServiceClient::DescribeOrderableReplicationInstancesPaginator(const DescribeOrderableReplicationInstancesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DatabaseMigrationServiceClient, DescribeOrderableReplicationInstancesRequest, DescribeOrderableReplicationInstancesOutcome>(this, &DatabaseMigrationServiceClient::DescribeOrderableReplicationInstances, request,
+    [](const DescribeOrderableReplicationInstancesRequest& current, const DescribeOrderableReplicationInstancesOutcome& outcome, DescribeOrderableReplicationInstancesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DatabaseMigrationServiceClient, DescribeReplicationInstancesRequest, DescribeReplicationInstancesOutcome> DatabaseMigrationServiceClient::DescribeReplicationInstancesPaginator(const DescribeReplicationInstancesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DatabaseMigrationServiceClient, DescribeReplicationInstancesRequest, DescribeReplicationInstancesOutcome>(this, &DatabaseMigrationServiceClient::DescribeReplicationInstances, request,
+    [](const DescribeReplicationInstancesRequest& current, const DescribeReplicationInstancesOutcome& outcome, DescribeReplicationInstancesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DatabaseMigrationServiceClient, DescribeReplicationSubnetGroupsRequest, DescribeReplicationSubnetGroupsOutcome> DatabaseMigrationServiceClient::DescribeReplicationSubnetGroupsPaginator(const DescribeReplicationSubnetGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DatabaseMigrationServiceClient, DescribeReplicationSubnetGroupsRequest, DescribeReplicationSubnetGroupsOutcome>(this, &DatabaseMigrationServiceClient::DescribeReplicationSubnetGroups, request,
+    [](const DescribeReplicationSubnetGroupsRequest& current, const DescribeReplicationSubnetGroupsOutcome& outcome, DescribeReplicationSubnetGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DatabaseMigrationServiceClient, DescribeReplicationTasksRequest, DescribeReplicationTasksOutcome> DatabaseMigrationServiceClient::DescribeReplicationTasksPaginator(const DescribeReplicationTasksRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DatabaseMigrationServiceClient, DescribeReplicationTasksRequest, DescribeReplicationTasksOutcome>(this, &DatabaseMigrationServiceClient::DescribeReplicationTasks, request,
+    [](const DescribeReplicationTasksRequest& current, const DescribeReplicationTasksOutcome& outcome, DescribeReplicationTasksRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DatabaseMigrationServiceClient, DescribeSchemasRequest, DescribeSchemasOutcome> DatabaseMigrationServiceClient::DescribeSchemasPaginator(const DescribeSchemasRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DatabaseMigrationServiceClient, DescribeSchemasRequest, DescribeSchemasOutcome>(this, &DatabaseMigrationServiceClient::DescribeSchemas, request,
+    [](const DescribeSchemasRequest& current, const DescribeSchemasOutcome& outcome, DescribeSchemasRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DatabaseMigrationServiceClient, DescribeTableStatisticsRequest, DescribeTableStatisticsOutcome> DatabaseMigrationServiceClient::DescribeTableStatisticsPaginator(const DescribeTableStatisticsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DatabaseMigrationServiceClient, DescribeTableStatisticsRequest, DescribeTableStatisticsOutcome>(this, &DatabaseMigrationServiceClient::DescribeTableStatistics, request,
+    [](const DescribeTableStatisticsRequest& current, const DescribeTableStatisticsOutcome& outcome, DescribeTableStatisticsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<DatabaseMigrationServiceClient, AddTagsToResourceRequest, AddTagsToResourceOutcome> DatabaseMigrationServiceClient::AddTagsToResourceAwaitable(AddTagsToResourceRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::AddTagsToResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, CreateEndpointRequest, CreateEndpointOutcome> DatabaseMigrationServiceClient::CreateEndpointAwaitable(CreateEndpointRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::CreateEndpoint, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, CreateReplicationInstanceRequest, CreateReplicationInstanceOutcome> DatabaseMigrationServiceClient::CreateReplicationInstanceAwaitable(CreateReplicationInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::CreateReplicationInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, CreateReplicationSubnetGroupRequest, CreateReplicationSubnetGroupOutcome> DatabaseMigrationServiceClient::CreateReplicationSubnetGroupAwaitable(CreateReplicationSubnetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::CreateReplicationSubnetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, CreateReplicationTaskRequest, CreateReplicationTaskOutcome> DatabaseMigrationServiceClient::CreateReplicationTaskAwaitable(CreateReplicationTaskRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::CreateReplicationTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DeleteCertificateRequest, DeleteCertificateOutcome> DatabaseMigrationServiceClient::DeleteCertificateAwaitable(DeleteCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DeleteCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DeleteEndpointRequest, DeleteEndpointOutcome> DatabaseMigrationServiceClient::DeleteEndpointAwaitable(DeleteEndpointRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DeleteEndpoint, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DeleteReplicationInstanceRequest, DeleteReplicationInstanceOutcome> DatabaseMigrationServiceClient::DeleteReplicationInstanceAwaitable(DeleteReplicationInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DeleteReplicationInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DeleteReplicationSubnetGroupRequest, DeleteReplicationSubnetGroupOutcome> DatabaseMigrationServiceClient::DeleteReplicationSubnetGroupAwaitable(DeleteReplicationSubnetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DeleteReplicationSubnetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DeleteReplicationTaskRequest, DeleteReplicationTaskOutcome> DatabaseMigrationServiceClient::DeleteReplicationTaskAwaitable(DeleteReplicationTaskRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DeleteReplicationTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DescribeAccountAttributesRequest, DescribeAccountAttributesOutcome> DatabaseMigrationServiceClient::DescribeAccountAttributesAwaitable(DescribeAccountAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DescribeAccountAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DescribeCertificatesRequest, DescribeCertificatesOutcome> DatabaseMigrationServiceClient::DescribeCertificatesAwaitable(DescribeCertificatesRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DescribeCertificates, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DescribeConnectionsRequest, DescribeConnectionsOutcome> DatabaseMigrationServiceClient::DescribeConnectionsAwaitable(DescribeConnectionsRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DescribeConnections, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DescribeEndpointTypesRequest, DescribeEndpointTypesOutcome> DatabaseMigrationServiceClient::DescribeEndpointTypesAwaitable(DescribeEndpointTypesRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DescribeEndpointTypes, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DescribeEndpointsRequest, DescribeEndpointsOutcome> DatabaseMigrationServiceClient::DescribeEndpointsAwaitable(DescribeEndpointsRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DescribeEndpoints, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DescribeOrderableReplicationInstancesRequest, DescribeOrderableReplicationInstancesOutcome> DatabaseMigrationServiceClient::DescribeOrderableReplicationInstancesAwaitable(DescribeOrderableReplicationInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DescribeOrderableReplicationInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DescribeRefreshSchemasStatusRequest, DescribeRefreshSchemasStatusOutcome> DatabaseMigrationServiceClient::DescribeRefreshSchemasStatusAwaitable(DescribeRefreshSchemasStatusRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DescribeRefreshSchemasStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DescribeReplicationInstancesRequest, DescribeReplicationInstancesOutcome> DatabaseMigrationServiceClient::DescribeReplicationInstancesAwaitable(DescribeReplicationInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DescribeReplicationInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DescribeReplicationSubnetGroupsRequest, DescribeReplicationSubnetGroupsOutcome> DatabaseMigrationServiceClient::DescribeReplicationSubnetGroupsAwaitable(DescribeReplicationSubnetGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DescribeReplicationSubnetGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DescribeReplicationTasksRequest, DescribeReplicationTasksOutcome> DatabaseMigrationServiceClient::DescribeReplicationTasksAwaitable(DescribeReplicationTasksRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DescribeReplicationTasks, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DescribeSchemasRequest, DescribeSchemasOutcome> DatabaseMigrationServiceClient::DescribeSchemasAwaitable(DescribeSchemasRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DescribeSchemas, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, DescribeTableStatisticsRequest, DescribeTableStatisticsOutcome> DatabaseMigrationServiceClient::DescribeTableStatisticsAwaitable(DescribeTableStatisticsRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::DescribeTableStatistics, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, ImportCertificateRequest, ImportCertificateOutcome> DatabaseMigrationServiceClient::ImportCertificateAwaitable(ImportCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::ImportCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, ListTagsForResourceRequest, ListTagsForResourceOutcome> DatabaseMigrationServiceClient::ListTagsForResourceAwaitable(ListTagsForResourceRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::ListTagsForResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, ModifyEndpointRequest, ModifyEndpointOutcome> DatabaseMigrationServiceClient::ModifyEndpointAwaitable(ModifyEndpointRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::ModifyEndpoint, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, ModifyReplicationInstanceRequest, ModifyReplicationInstanceOutcome> DatabaseMigrationServiceClient::ModifyReplicationInstanceAwaitable(ModifyReplicationInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::ModifyReplicationInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, ModifyReplicationSubnetGroupRequest, ModifyReplicationSubnetGroupOutcome> DatabaseMigrationServiceClient::ModifyReplicationSubnetGroupAwaitable(ModifyReplicationSubnetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::ModifyReplicationSubnetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, RefreshSchemasRequest, RefreshSchemasOutcome> DatabaseMigrationServiceClient::RefreshSchemasAwaitable(RefreshSchemasRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::RefreshSchemas, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, RemoveTagsFromResourceRequest, RemoveTagsFromResourceOutcome> DatabaseMigrationServiceClient::RemoveTagsFromResourceAwaitable(RemoveTagsFromResourceRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::RemoveTagsFromResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, StartReplicationTaskRequest, StartReplicationTaskOutcome> DatabaseMigrationServiceClient::StartReplicationTaskAwaitable(StartReplicationTaskRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::StartReplicationTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, StopReplicationTaskRequest, StopReplicationTaskOutcome> DatabaseMigrationServiceClient::StopReplicationTaskAwaitable(StopReplicationTaskRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::StopReplicationTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<DatabaseMigrationServiceClient, TestConnectionRequest, TestConnectionOutcome> DatabaseMigrationServiceClient::TestConnectionAwaitable(TestConnectionRequest request) const
+{
+  return { m_executor.get(), { this, &DatabaseMigrationServiceClient::TestConnection, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
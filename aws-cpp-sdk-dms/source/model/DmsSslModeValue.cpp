@@ -29,31 +29,35 @@ namespace Aws
       namespace DmsSslModeValueMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int require_HASH = HashingUtils::HashString("require");
-        static const int verify_ca_HASH = HashingUtils::HashString("verify-ca");
-        static const int verify_full_HASH = HashingUtils::HashString("verify-full");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int none_HASH = 3387192;
+        static const int require_HASH = 1095696741;
+        static const int verify_ca_HASH = -1695928782;
+        static const int verify_full_HASH = -1994842269;
 
 
         DmsSslModeValue GetDmsSslModeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
+          switch (hashCode)
           {
+          case none_HASH:
             return DmsSslModeValue::none;
-          }
-          else if (hashCode == require_HASH)
-          {
+          case require_HASH:
             return DmsSslModeValue::require;
-          }
-          else if (hashCode == verify_ca_HASH)
-          {
+          case verify_ca_HASH:
             return DmsSslModeValue::verify_ca;
-          }
-          else if (hashCode == verify_full_HASH)
-          {
+          case verify_full_HASH:
             return DmsSslModeValue::verify_full;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace MigrationTypeValueMapper
       {
 
-        static const int full_load_HASH = HashingUtils::HashString("full-load");
-        static const int cdc_HASH = HashingUtils::HashString("cdc");
-        static const int full_load_and_cdc_HASH = HashingUtils::HashString("full-load-and-cdc");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int full_load_HASH = -1723398812;
+        static const int cdc_HASH = 98338;
+        static const int full_load_and_cdc_HASH = -1303711805;
 
 
         MigrationTypeValue GetMigrationTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == full_load_HASH)
+          switch (hashCode)
           {
+          case full_load_HASH:
             return MigrationTypeValue::full_load;
-          }
-          else if (hashCode == cdc_HASH)
-          {
+          case cdc_HASH:
             return MigrationTypeValue::cdc;
-          }
-          else if (hashCode == full_load_and_cdc_HASH)
-          {
+          case full_load_and_cdc_HASH:
             return MigrationTypeValue::full_load_and_cdc;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
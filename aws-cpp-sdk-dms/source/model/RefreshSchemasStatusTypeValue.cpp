@@ -29,26 +29,32 @@ namespace Aws
       namespace RefreshSchemasStatusTypeValueMapper
       {
 
-        static const int successful_HASH = HashingUtils::HashString("successful");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int refreshing_HASH = HashingUtils::HashString("refreshing");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int successful_HASH = -733631846;
+        static const int failed_HASH = -1281977283;
+        static const int refreshing_HASH = -321826009;
 
 
         RefreshSchemasStatusTypeValue GetRefreshSchemasStatusTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == successful_HASH)
+          switch (hashCode)
           {
+          case successful_HASH:
             return RefreshSchemasStatusTypeValue::successful;
-          }
-          else if (hashCode == failed_HASH)
-          {
+          case failed_HASH:
             return RefreshSchemasStatusTypeValue::failed;
-          }
-          else if (hashCode == refreshing_HASH)
-          {
+          case refreshing_HASH:
             return RefreshSchemasStatusTypeValue::refreshing;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
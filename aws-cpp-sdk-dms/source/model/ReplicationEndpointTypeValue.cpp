@@ -29,21 +29,29 @@ namespace Aws
       namespace ReplicationEndpointTypeValueMapper
       {
 
-        static const int source_HASH = HashingUtils::HashString("source");
-        static const int target_HASH = HashingUtils::HashString("target");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int source_HASH = -896505829;
+        static const int target_HASH = -880905839;
 
 
         ReplicationEndpointTypeValue GetReplicationEndpointTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == source_HASH)
+          switch (hashCode)
           {
+          case source_HASH:
             return ReplicationEndpointTypeValue::source;
-          }
-          else if (hashCode == target_HASH)
-          {
+          case target_HASH:
             return ReplicationEndpointTypeValue::target;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace StartReplicationTaskTypeValueMapper
       {
 
-        static const int start_replication_HASH = HashingUtils::HashString("start-replication");
-        static const int resume_processing_HASH = HashingUtils::HashString("resume-processing");
-        static const int reload_target_HASH = HashingUtils::HashString("reload-target");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int start_replication_HASH = 1100176097;
+        static const int resume_processing_HASH = 1583146163;
+        static const int reload_target_HASH = -711127995;
 
 
         StartReplicationTaskTypeValue GetStartReplicationTaskTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == start_replication_HASH)
+          switch (hashCode)
           {
+          case start_replication_HASH:
             return StartReplicationTaskTypeValue::start_replication;
-          }
-          else if (hashCode == resume_processing_HASH)
-          {
+          case resume_processing_HASH:
             return StartReplicationTaskTypeValue::resume_processing;
-          }
-          else if (hashCode == reload_target_HASH)
-          {
+          case reload_target_HASH:
             return StartReplicationTaskTypeValue::reload_target;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -56,6 +56,9 @@
 #include <aws/ds/model/UpdateRadiusResult.h>
 #include <aws/ds/model/VerifyTrustResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -309,6 +312,18 @@ namespace Model
          */
         virtual void AddIpRoutesAsync(const Model::AddIpRoutesRequest& request, const AddIpRoutesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddIpRoutesCallable(const Model::AddIpRoutesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddIpRoutesOutcomeCallable AddIpRoutesCallable(Model::AddIpRoutesRequest&& request) const;
+
+        /**
+         * Same as AddIpRoutesAsync(const Model::AddIpRoutesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddIpRoutesAsync(Model::AddIpRoutesRequest&& request, const AddIpRoutesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds or overwrites one or more tags for the specified Amazon Directory
          * Services directory. Each directory can have a maximum of 10 tags. Each tag
@@ -337,6 +352,18 @@ namespace Model
          */
         virtual void AddTagsToResourceAsync(const Model::AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToResourceCallable(const Model::AddTagsToResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsToResourceOutcomeCallable AddTagsToResourceCallable(Model::AddTagsToResourceRequest&& request) const;
+
+        /**
+         * Same as AddTagsToResourceAsync(const Model::AddTagsToResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsToResourceAsync(Model::AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an AD Connector to connect to an on-premises directory.</p>
          */
@@ -356,6 +383,18 @@ namespace Model
          */
         virtual void ConnectDirectoryAsync(const Model::ConnectDirectoryRequest& request, const ConnectDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConnectDirectoryCallable(const Model::ConnectDirectoryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ConnectDirectoryOutcomeCallable ConnectDirectoryCallable(Model::ConnectDirectoryRequest&& request) const;
+
+        /**
+         * Same as ConnectDirectoryAsync(const Model::ConnectDirectoryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ConnectDirectoryAsync(Model::ConnectDirectoryRequest&& request, const ConnectDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an alias for a directory and assigns the alias to the directory. The
          * alias is used to construct the access URL for the directory, such as
@@ -387,6 +426,18 @@ namespace Model
          */
         virtual void CreateAliasAsync(const Model::CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAliasCallable(const Model::CreateAliasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateAliasOutcomeCallable CreateAliasCallable(Model::CreateAliasRequest&& request) const;
+
+        /**
+         * Same as CreateAliasAsync(const Model::CreateAliasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateAliasAsync(Model::CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a computer account in the specified directory, and joins the computer
          * to the directory.</p>
@@ -409,6 +460,18 @@ namespace Model
          */
         virtual void CreateComputerAsync(const Model::CreateComputerRequest& request, const CreateComputerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateComputerCallable(const Model::CreateComputerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateComputerOutcomeCallable CreateComputerCallable(Model::CreateComputerRequest&& request) const;
+
+        /**
+         * Same as CreateComputerAsync(const Model::CreateComputerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateComputerAsync(Model::CreateComputerRequest&& request, const CreateComputerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a conditional forwarder associated with your AWS directory.
          * Conditional forwarders are required in order to set up a trust relationship with
@@ -434,6 +497,18 @@ namespace Model
          */
         virtual void CreateConditionalForwarderAsync(const Model::CreateConditionalForwarderRequest& request, const CreateConditionalForwarderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateConditionalForwarderCallable(const Model::CreateConditionalForwarderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateConditionalForwarderOutcomeCallable CreateConditionalForwarderCallable(Model::CreateConditionalForwarderRequest&& request) const;
+
+        /**
+         * Same as CreateConditionalForwarderAsync(const Model::CreateConditionalForwarderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateConditionalForwarderAsync(Model::CreateConditionalForwarderRequest&& request, const CreateConditionalForwarderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a Simple AD directory.</p>
          */
@@ -453,6 +528,18 @@ namespace Model
          */
         virtual void CreateDirectoryAsync(const Model::CreateDirectoryRequest& request, const CreateDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDirectoryCallable(const Model::CreateDirectoryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDirectoryOutcomeCallable CreateDirectoryCallable(Model::CreateDirectoryRequest&& request) const;
+
+        /**
+         * Same as CreateDirectoryAsync(const Model::CreateDirectoryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDirectoryAsync(Model::CreateDirectoryRequest&& request, const CreateDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a Microsoft AD in the AWS cloud.</p>
          */
@@ -472,6 +559,18 @@ namespace Model
          */
         virtual void CreateMicrosoftADAsync(const Model::CreateMicrosoftADRequest& request, const CreateMicrosoftADResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateMicrosoftADCallable(const Model::CreateMicrosoftADRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateMicrosoftADOutcomeCallable CreateMicrosoftADCallable(Model::CreateMicrosoftADRequest&& request) const;
+
+        /**
+         * Same as CreateMicrosoftADAsync(const Model::CreateMicrosoftADRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateMicrosoftADAsync(Model::CreateMicrosoftADRequest&& request, const CreateMicrosoftADResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a snapshot of a Simple AD or Microsoft AD directory in the AWS
          * cloud.</p> <note> <p>You cannot take snapshots of AD Connector directories.</p>
@@ -497,6 +596,18 @@ namespace Model
          */
         virtual void CreateSnapshotAsync(const Model::CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSnapshotCallable(const Model::CreateSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateSnapshotOutcomeCallable CreateSnapshotCallable(Model::CreateSnapshotRequest&& request) const;
+
+        /**
+         * Same as CreateSnapshotAsync(const Model::CreateSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateSnapshotAsync(Model::CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>AWS Directory Service for Microsoft Active Directory allows you to configure
          * trust relationships. For example, you can establish a trust between your
@@ -534,6 +645,18 @@ namespace Model
          */
         virtual void CreateTrustAsync(const Model::CreateTrustRequest& request, const CreateTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTrustCallable(const Model::CreateTrustRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateTrustOutcomeCallable CreateTrustCallable(Model::CreateTrustRequest&& request) const;
+
+        /**
+         * Same as CreateTrustAsync(const Model::CreateTrustRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateTrustAsync(Model::CreateTrustRequest&& request, const CreateTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a conditional forwarder that has been set up for your AWS
          * directory.</p>
@@ -556,6 +679,18 @@ namespace Model
          */
         virtual void DeleteConditionalForwarderAsync(const Model::DeleteConditionalForwarderRequest& request, const DeleteConditionalForwarderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteConditionalForwarderCallable(const Model::DeleteConditionalForwarderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteConditionalForwarderOutcomeCallable DeleteConditionalForwarderCallable(Model::DeleteConditionalForwarderRequest&& request) const;
+
+        /**
+         * Same as DeleteConditionalForwarderAsync(const Model::DeleteConditionalForwarderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteConditionalForwarderAsync(Model::DeleteConditionalForwarderRequest&& request, const DeleteConditionalForwarderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an AWS Directory Service directory.</p>
          */
@@ -575,6 +710,18 @@ namespace Model
          */
         virtual void DeleteDirectoryAsync(const Model::DeleteDirectoryRequest& request, const DeleteDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDirectoryCallable(const Model::DeleteDirectoryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDirectoryOutcomeCallable DeleteDirectoryCallable(Model::DeleteDirectoryRequest&& request) const;
+
+        /**
+         * Same as DeleteDirectoryAsync(const Model::DeleteDirectoryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDirectoryAsync(Model::DeleteDirectoryRequest&& request, const DeleteDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a directory snapshot.</p>
          */
@@ -594,6 +741,18 @@ namespace Model
          */
         virtual void DeleteSnapshotAsync(const Model::DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSnapshotCallable(const Model::DeleteSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteSnapshotOutcomeCallable DeleteSnapshotCallable(Model::DeleteSnapshotRequest&& request) const;
+
+        /**
+         * Same as DeleteSnapshotAsync(const Model::DeleteSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteSnapshotAsync(Model::DeleteSnapshotRequest&& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an existing trust relationship between your Microsoft AD in the AWS
          * cloud and an external domain.</p>
@@ -616,6 +775,18 @@ namespace Model
          */
         virtual void DeleteTrustAsync(const Model::DeleteTrustRequest& request, const DeleteTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTrustCallable(const Model::DeleteTrustRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTrustOutcomeCallable DeleteTrustCallable(Model::DeleteTrustRequest&& request) const;
+
+        /**
+         * Same as DeleteTrustAsync(const Model::DeleteTrustRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTrustAsync(Model::DeleteTrustRequest&& request, const DeleteTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified directory as a publisher to the specified SNS
          * topic.</p>
@@ -638,6 +809,18 @@ namespace Model
          */
         virtual void DeregisterEventTopicAsync(const Model::DeregisterEventTopicRequest& request, const DeregisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterEventTopicCallable(const Model::DeregisterEventTopicRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeregisterEventTopicOutcomeCallable DeregisterEventTopicCallable(Model::DeregisterEventTopicRequest&& request) const;
+
+        /**
+         * Same as DeregisterEventTopicAsync(const Model::DeregisterEventTopicRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeregisterEventTopicAsync(Model::DeregisterEventTopicRequest&& request, const DeregisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains information about the conditional forwarders for this account.</p>
          * <p>If no input parameters are provided for RemoteDomainNames, this request
@@ -663,6 +846,18 @@ namespace Model
          */
         virtual void DescribeConditionalForwardersAsync(const Model::DescribeConditionalForwardersRequest& request, const DescribeConditionalForwardersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConditionalForwardersCallable(const Model::DescribeConditionalForwardersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeConditionalForwardersOutcomeCallable DescribeConditionalForwardersCallable(Model::DescribeConditionalForwardersRequest&& request) const;
+
+        /**
+         * Same as DescribeConditionalForwardersAsync(const Model::DescribeConditionalForwardersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeConditionalForwardersAsync(Model::DescribeConditionalForwardersRequest&& request, const DescribeConditionalForwardersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains information about the directories that belong to this account.</p>
          * <p>You can retrieve information about specific directories by passing the
@@ -709,6 +904,18 @@ namespace Model
          */
         virtual void DescribeDirectoriesAsync(const Model::DescribeDirectoriesRequest& request, const DescribeDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDirectoriesCallable(const Model::DescribeDirectoriesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDirectoriesOutcomeCallable DescribeDirectoriesCallable(Model::DescribeDirectoriesRequest&& request) const;
+
+        /**
+         * Same as DescribeDirectoriesAsync(const Model::DescribeDirectoriesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDirectoriesAsync(Model::DescribeDirectoriesRequest&& request, const DescribeDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains information about which SNS topics receive status messages from the
          * specified directory.</p> <p>If no input parameters are provided, such as
@@ -737,6 +944,18 @@ namespace Model
          */
         virtual void DescribeEventTopicsAsync(const Model::DescribeEventTopicsRequest& request, const DescribeEventTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventTopicsCallable(const Model::DescribeEventTopicsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEventTopicsOutcomeCallable DescribeEventTopicsCallable(Model::DescribeEventTopicsRequest&& request) const;
+
+        /**
+         * Same as DescribeEventTopicsAsync(const Model::DescribeEventTopicsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEventTopicsAsync(Model::DescribeEventTopicsRequest&& request, const DescribeEventTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains information about the directory snapshots that belong to this
          * account.</p> <p>This operation supports pagination with the use of the
@@ -774,6 +993,18 @@ namespace Model
          */
         virtual void DescribeSnapshotsAsync(const Model::DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSnapshotsCallable(const Model::DescribeSnapshotsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSnapshotsOutcomeCallable DescribeSnapshotsCallable(Model::DescribeSnapshotsRequest&& request) const;
+
+        /**
+         * Same as DescribeSnapshotsAsync(const Model::DescribeSnapshotsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSnapshotsAsync(Model::DescribeSnapshotsRequest&& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains information about the trust relationships for this account.</p> <p>If
          * no input parameters are provided, such as DirectoryId or TrustIds, this request
@@ -799,6 +1030,18 @@ namespace Model
          */
         virtual void DescribeTrustsAsync(const Model::DescribeTrustsRequest& request, const DescribeTrustsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTrustsCallable(const Model::DescribeTrustsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTrustsOutcomeCallable DescribeTrustsCallable(Model::DescribeTrustsRequest&& request) const;
+
+        /**
+         * Same as DescribeTrustsAsync(const Model::DescribeTrustsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTrustsAsync(Model::DescribeTrustsRequest&& request, const DescribeTrustsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables multi-factor authentication (MFA) with the Remote Authentication
          * Dial In User Service (RADIUS) server for an AD Connector directory.</p>
@@ -821,6 +1064,18 @@ namespace Model
          */
         virtual void DisableRadiusAsync(const Model::DisableRadiusRequest& request, const DisableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableRadiusCallable(const Model::DisableRadiusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableRadiusOutcomeCallable DisableRadiusCallable(Model::DisableRadiusRequest&& request) const;
+
+        /**
+         * Same as DisableRadiusAsync(const Model::DisableRadiusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableRadiusAsync(Model::DisableRadiusRequest&& request, const DisableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables single-sign on for a directory.</p>
          */
@@ -840,6 +1095,18 @@ namespace Model
          */
         virtual void DisableSsoAsync(const Model::DisableSsoRequest& request, const DisableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableSsoCallable(const Model::DisableSsoRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableSsoOutcomeCallable DisableSsoCallable(Model::DisableSsoRequest&& request) const;
+
+        /**
+         * Same as DisableSsoAsync(const Model::DisableSsoRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableSsoAsync(Model::DisableSsoRequest&& request, const DisableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables multi-factor authentication (MFA) with the Remote Authentication Dial
          * In User Service (RADIUS) server for an AD Connector directory.</p>
@@ -862,6 +1129,18 @@ namespace Model
          */
         virtual void EnableRadiusAsync(const Model::EnableRadiusRequest& request, const EnableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableRadiusCallable(const Model::EnableRadiusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableRadiusOutcomeCallable EnableRadiusCallable(Model::EnableRadiusRequest&& request) const;
+
+        /**
+         * Same as EnableRadiusAsync(const Model::EnableRadiusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableRadiusAsync(Model::EnableRadiusRequest&& request, const EnableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables single-sign on for a directory.</p>
          */
@@ -881,6 +1160,18 @@ namespace Model
          */
         virtual void EnableSsoAsync(const Model::EnableSsoRequest& request, const EnableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableSsoCallable(const Model::EnableSsoRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableSsoOutcomeCallable EnableSsoCallable(Model::EnableSsoRequest&& request) const;
+
+        /**
+         * Same as EnableSsoAsync(const Model::EnableSsoRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableSsoAsync(Model::EnableSsoRequest&& request, const EnableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains directory limit information for the current region.</p>
          */
@@ -900,6 +1191,18 @@ namespace Model
          */
         virtual void GetDirectoryLimitsAsync(const Model::GetDirectoryLimitsRequest& request, const GetDirectoryLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDirectoryLimitsCallable(const Model::GetDirectoryLimitsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDirectoryLimitsOutcomeCallable GetDirectoryLimitsCallable(Model::GetDirectoryLimitsRequest&& request) const;
+
+        /**
+         * Same as GetDirectoryLimitsAsync(const Model::GetDirectoryLimitsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDirectoryLimitsAsync(Model::GetDirectoryLimitsRequest&& request, const GetDirectoryLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains the manual snapshot limits for a directory.</p>
          */
@@ -919,6 +1222,18 @@ namespace Model
          */
         virtual void GetSnapshotLimitsAsync(const Model::GetSnapshotLimitsRequest& request, const GetSnapshotLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSnapshotLimitsCallable(const Model::GetSnapshotLimitsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetSnapshotLimitsOutcomeCallable GetSnapshotLimitsCallable(Model::GetSnapshotLimitsRequest&& request) const;
+
+        /**
+         * Same as GetSnapshotLimitsAsync(const Model::GetSnapshotLimitsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetSnapshotLimitsAsync(Model::GetSnapshotLimitsRequest&& request, const GetSnapshotLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the address blocks that you have added to a directory.</p>
          */
@@ -938,6 +1253,18 @@ namespace Model
          */
         virtual void ListIpRoutesAsync(const Model::ListIpRoutesRequest& request, const ListIpRoutesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListIpRoutesCallable(const Model::ListIpRoutesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListIpRoutesOutcomeCallable ListIpRoutesCallable(Model::ListIpRoutesRequest&& request) const;
+
+        /**
+         * Same as ListIpRoutesAsync(const Model::ListIpRoutesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListIpRoutesAsync(Model::ListIpRoutesRequest&& request, const ListIpRoutesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all tags on an Amazon Directory Services directory.</p>
          */
@@ -957,6 +1284,18 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourceCallable(const Model::ListTagsForResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(Model::ListTagsForResourceRequest&& request) const;
+
+        /**
+         * Same as ListTagsForResourceAsync(const Model::ListTagsForResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsForResourceAsync(Model::ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates a directory with an SNS topic. This establishes the directory as a
          * publisher to the specified SNS topic. You can then receive email or text (SMS)
@@ -988,6 +1327,18 @@ namespace Model
          */
         virtual void RegisterEventTopicAsync(const Model::RegisterEventTopicRequest& request, const RegisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterEventTopicCallable(const Model::RegisterEventTopicRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterEventTopicOutcomeCallable RegisterEventTopicCallable(Model::RegisterEventTopicRequest&& request) const;
+
+        /**
+         * Same as RegisterEventTopicAsync(const Model::RegisterEventTopicRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterEventTopicAsync(Model::RegisterEventTopicRequest&& request, const RegisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes IP address blocks from a directory.</p>
          */
@@ -1007,6 +1358,18 @@ namespace Model
          */
         virtual void RemoveIpRoutesAsync(const Model::RemoveIpRoutesRequest& request, const RemoveIpRoutesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveIpRoutesCallable(const Model::RemoveIpRoutesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveIpRoutesOutcomeCallable RemoveIpRoutesCallable(Model::RemoveIpRoutesRequest&& request) const;
+
+        /**
+         * Same as RemoveIpRoutesAsync(const Model::RemoveIpRoutesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveIpRoutesAsync(Model::RemoveIpRoutesRequest&& request, const RemoveIpRoutesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes tags from an Amazon Directory Services directory.</p>
          */
@@ -1026,6 +1389,18 @@ namespace Model
          */
         virtual void RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromResourceCallable(const Model::RemoveTagsFromResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsFromResourceOutcomeCallable RemoveTagsFromResourceCallable(Model::RemoveTagsFromResourceRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsFromResourceAsync(Model::RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Restores a directory using an existing directory snapshot.</p> <p>When you
          * restore a directory from a snapshot, any changes made to the directory after the
@@ -1063,6 +1438,18 @@ namespace Model
          */
         virtual void RestoreFromSnapshotAsync(const Model::RestoreFromSnapshotRequest& request, const RestoreFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreFromSnapshotCallable(const Model::RestoreFromSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RestoreFromSnapshotOutcomeCallable RestoreFromSnapshotCallable(Model::RestoreFromSnapshotRequest&& request) const;
+
+        /**
+         * Same as RestoreFromSnapshotAsync(const Model::RestoreFromSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RestoreFromSnapshotAsync(Model::RestoreFromSnapshotRequest&& request, const RestoreFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a conditional forwarder that has been set up for your AWS
          * directory.</p>
@@ -1085,6 +1472,18 @@ namespace Model
          */
         virtual void UpdateConditionalForwarderAsync(const Model::UpdateConditionalForwarderRequest& request, const UpdateConditionalForwarderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateConditionalForwarderCallable(const Model::UpdateConditionalForwarderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateConditionalForwarderOutcomeCallable UpdateConditionalForwarderCallable(Model::UpdateConditionalForwarderRequest&& request) const;
+
+        /**
+         * Same as UpdateConditionalForwarderAsync(const Model::UpdateConditionalForwarderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateConditionalForwarderAsync(Model::UpdateConditionalForwarderRequest&& request, const UpdateConditionalForwarderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the Remote Authentication Dial In User Service (RADIUS) server
          * information for an AD Connector directory.</p>
@@ -1107,6 +1506,18 @@ namespace Model
          */
         virtual void UpdateRadiusAsync(const Model::UpdateRadiusRequest& request, const UpdateRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateRadiusCallable(const Model::UpdateRadiusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateRadiusOutcomeCallable UpdateRadiusCallable(Model::UpdateRadiusRequest&& request) const;
+
+        /**
+         * Same as UpdateRadiusAsync(const Model::UpdateRadiusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateRadiusAsync(Model::UpdateRadiusRequest&& request, const UpdateRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>AWS Directory Service for Microsoft Active Directory allows you to configure
          * and verify trust relationships.</p> <p>This action verifies a trust relationship
@@ -1132,6 +1543,220 @@ namespace Model
          */
         virtual void VerifyTrustAsync(const Model::VerifyTrustRequest& request, const VerifyTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as VerifyTrustCallable(const Model::VerifyTrustRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::VerifyTrustOutcomeCallable VerifyTrustCallable(Model::VerifyTrustRequest&& request) const;
+
+        /**
+         * Same as VerifyTrustAsync(const Model::VerifyTrustRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void VerifyTrustAsync(Model::VerifyTrustRequest&& request, const VerifyTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeDirectories(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DirectoryServiceClient, Model::DescribeDirectoriesRequest, Model::DescribeDirectoriesOutcome> DescribeDirectoriesPaginator(const Model::DescribeDirectoriesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeSnapshots(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DirectoryServiceClient, Model::DescribeSnapshotsRequest, Model::DescribeSnapshotsOutcome> DescribeSnapshotsPaginator(const Model::DescribeSnapshotsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeTrusts(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DirectoryServiceClient, Model::DescribeTrustsRequest, Model::DescribeTrustsOutcome> DescribeTrustsPaginator(const Model::DescribeTrustsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListIpRoutes(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DirectoryServiceClient, Model::ListIpRoutesRequest, Model::ListIpRoutesOutcome> ListIpRoutesPaginator(const Model::ListIpRoutesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListTagsForResource(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DirectoryServiceClient, Model::ListTagsForResourceRequest, Model::ListTagsForResourceOutcome> ListTagsForResourcePaginator(const Model::ListTagsForResourceRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddIpRoutes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::AddIpRoutesRequest, Model::AddIpRoutesOutcome> AddIpRoutesAwaitable(Model::AddIpRoutesRequest request) const;
+
+        /**
+         * co_await-able form of AddTagsToResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::AddTagsToResourceRequest, Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(Model::AddTagsToResourceRequest request) const;
+
+        /**
+         * co_await-able form of ConnectDirectory(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::ConnectDirectoryRequest, Model::ConnectDirectoryOutcome> ConnectDirectoryAwaitable(Model::ConnectDirectoryRequest request) const;
+
+        /**
+         * co_await-able form of CreateAlias(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::CreateAliasRequest, Model::CreateAliasOutcome> CreateAliasAwaitable(Model::CreateAliasRequest request) const;
+
+        /**
+         * co_await-able form of CreateComputer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::CreateComputerRequest, Model::CreateComputerOutcome> CreateComputerAwaitable(Model::CreateComputerRequest request) const;
+
+        /**
+         * co_await-able form of CreateConditionalForwarder(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::CreateConditionalForwarderRequest, Model::CreateConditionalForwarderOutcome> CreateConditionalForwarderAwaitable(Model::CreateConditionalForwarderRequest request) const;
+
+        /**
+         * co_await-able form of CreateDirectory(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::CreateDirectoryRequest, Model::CreateDirectoryOutcome> CreateDirectoryAwaitable(Model::CreateDirectoryRequest request) const;
+
+        /**
+         * co_await-able form of CreateMicrosoftAD(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::CreateMicrosoftADRequest, Model::CreateMicrosoftADOutcome> CreateMicrosoftADAwaitable(Model::CreateMicrosoftADRequest request) const;
+
+        /**
+         * co_await-able form of CreateSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::CreateSnapshotRequest, Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(Model::CreateSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of CreateTrust(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::CreateTrustRequest, Model::CreateTrustOutcome> CreateTrustAwaitable(Model::CreateTrustRequest request) const;
+
+        /**
+         * co_await-able form of DeleteConditionalForwarder(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::DeleteConditionalForwarderRequest, Model::DeleteConditionalForwarderOutcome> DeleteConditionalForwarderAwaitable(Model::DeleteConditionalForwarderRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDirectory(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::DeleteDirectoryRequest, Model::DeleteDirectoryOutcome> DeleteDirectoryAwaitable(Model::DeleteDirectoryRequest request) const;
+
+        /**
+         * co_await-able form of DeleteSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::DeleteSnapshotRequest, Model::DeleteSnapshotOutcome> DeleteSnapshotAwaitable(Model::DeleteSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTrust(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::DeleteTrustRequest, Model::DeleteTrustOutcome> DeleteTrustAwaitable(Model::DeleteTrustRequest request) const;
+
+        /**
+         * co_await-able form of DeregisterEventTopic(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::DeregisterEventTopicRequest, Model::DeregisterEventTopicOutcome> DeregisterEventTopicAwaitable(Model::DeregisterEventTopicRequest request) const;
+
+        /**
+         * co_await-able form of DescribeConditionalForwarders(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::DescribeConditionalForwardersRequest, Model::DescribeConditionalForwardersOutcome> DescribeConditionalForwardersAwaitable(Model::DescribeConditionalForwardersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDirectories(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::DescribeDirectoriesRequest, Model::DescribeDirectoriesOutcome> DescribeDirectoriesAwaitable(Model::DescribeDirectoriesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEventTopics(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::DescribeEventTopicsRequest, Model::DescribeEventTopicsOutcome> DescribeEventTopicsAwaitable(Model::DescribeEventTopicsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSnapshots(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::DescribeSnapshotsRequest, Model::DescribeSnapshotsOutcome> DescribeSnapshotsAwaitable(Model::DescribeSnapshotsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTrusts(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::DescribeTrustsRequest, Model::DescribeTrustsOutcome> DescribeTrustsAwaitable(Model::DescribeTrustsRequest request) const;
+
+        /**
+         * co_await-able form of DisableRadius(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::DisableRadiusRequest, Model::DisableRadiusOutcome> DisableRadiusAwaitable(Model::DisableRadiusRequest request) const;
+
+        /**
+         * co_await-able form of DisableSso(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::DisableSsoRequest, Model::DisableSsoOutcome> DisableSsoAwaitable(Model::DisableSsoRequest request) const;
+
+        /**
+         * co_await-able form of EnableRadius(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::EnableRadiusRequest, Model::EnableRadiusOutcome> EnableRadiusAwaitable(Model::EnableRadiusRequest request) const;
+
+        /**
+         * co_await-able form of EnableSso(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::EnableSsoRequest, Model::EnableSsoOutcome> EnableSsoAwaitable(Model::EnableSsoRequest request) const;
+
+        /**
+         * co_await-able form of GetDirectoryLimits(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::GetDirectoryLimitsRequest, Model::GetDirectoryLimitsOutcome> GetDirectoryLimitsAwaitable(Model::GetDirectoryLimitsRequest request) const;
+
+        /**
+         * co_await-able form of GetSnapshotLimits(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::GetSnapshotLimitsRequest, Model::GetSnapshotLimitsOutcome> GetSnapshotLimitsAwaitable(Model::GetSnapshotLimitsRequest request) const;
+
+        /**
+         * co_await-able form of ListIpRoutes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::ListIpRoutesRequest, Model::ListIpRoutesOutcome> ListIpRoutesAwaitable(Model::ListIpRoutesRequest request) const;
+
+        /**
+         * co_await-able form of ListTagsForResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::ListTagsForResourceRequest, Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(Model::ListTagsForResourceRequest request) const;
+
+        /**
+         * co_await-able form of RegisterEventTopic(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::RegisterEventTopicRequest, Model::RegisterEventTopicOutcome> RegisterEventTopicAwaitable(Model::RegisterEventTopicRequest request) const;
+
+        /**
+         * co_await-able form of RemoveIpRoutes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::RemoveIpRoutesRequest, Model::RemoveIpRoutesOutcome> RemoveIpRoutesAwaitable(Model::RemoveIpRoutesRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTagsFromResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::RemoveTagsFromResourceRequest, Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(Model::RemoveTagsFromResourceRequest request) const;
+
+        /**
+         * co_await-able form of RestoreFromSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::RestoreFromSnapshotRequest, Model::RestoreFromSnapshotOutcome> RestoreFromSnapshotAwaitable(Model::RestoreFromSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of UpdateConditionalForwarder(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::UpdateConditionalForwarderRequest, Model::UpdateConditionalForwarderOutcome> UpdateConditionalForwarderAwaitable(Model::UpdateConditionalForwarderRequest request) const;
+
+        /**
+         * co_await-able form of UpdateRadius(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::UpdateRadiusRequest, Model::UpdateRadiusOutcome> UpdateRadiusAwaitable(Model::UpdateRadiusRequest request) const;
+
+        /**
+         * co_await-able form of VerifyTrust(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DirectoryServiceClient, Model::VerifyTrustRequest, Model::VerifyTrustOutcome> VerifyTrustAwaitable(Model::VerifyTrustRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
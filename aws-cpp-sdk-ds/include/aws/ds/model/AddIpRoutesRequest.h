@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AddIpRoutesRequest();
+    inline const char* GetServiceRequestName() const override { return "AddIpRoutes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ConnectDirectoryRequest();
+    inline const char* GetServiceRequestName() const override { return "ConnectDirectory"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
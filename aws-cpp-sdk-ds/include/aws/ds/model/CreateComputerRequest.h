@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateComputerRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateComputer"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateConditionalForwarderRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateConditionalForwarder"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateDirectoryRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDirectory"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
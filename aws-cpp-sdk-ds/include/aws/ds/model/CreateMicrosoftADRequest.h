@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateMicrosoftADRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateMicrosoftAD"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
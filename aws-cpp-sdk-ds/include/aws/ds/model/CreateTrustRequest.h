@@ -40,6 +40,8 @@ namespace Model
   {
   public:
     CreateTrustRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateTrust"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
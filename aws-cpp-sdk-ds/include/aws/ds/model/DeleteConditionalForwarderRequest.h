@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteConditionalForwarderRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteConditionalForwarder"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDirectoryRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDirectory"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteTrustRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteTrust"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeregisterEventTopicRequest();
+    inline const char* GetServiceRequestName() const override { return "DeregisterEventTopic"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
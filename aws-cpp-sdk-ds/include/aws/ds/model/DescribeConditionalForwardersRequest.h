@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeConditionalForwardersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeConditionalForwarders"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
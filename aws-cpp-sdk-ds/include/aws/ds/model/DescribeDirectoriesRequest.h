@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeDirectoriesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDirectories"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeEventTopicsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEventTopics"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeSnapshotsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSnapshots"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
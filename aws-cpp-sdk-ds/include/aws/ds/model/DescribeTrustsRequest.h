@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     DescribeTrustsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTrusts"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
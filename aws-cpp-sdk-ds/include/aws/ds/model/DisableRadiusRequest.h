@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DisableRadiusRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableRadius"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
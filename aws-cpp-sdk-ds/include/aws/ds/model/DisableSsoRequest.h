@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DisableSsoRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableSso"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     EnableRadiusRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableRadius"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     EnableSsoRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableSso"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetDirectoryLimitsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDirectoryLimits"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
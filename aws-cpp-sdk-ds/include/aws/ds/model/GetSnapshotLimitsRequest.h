@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetSnapshotLimitsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetSnapshotLimits"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
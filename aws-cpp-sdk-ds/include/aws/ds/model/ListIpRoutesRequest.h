@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListIpRoutesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListIpRoutes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RegisterEventTopicRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterEventTopic"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
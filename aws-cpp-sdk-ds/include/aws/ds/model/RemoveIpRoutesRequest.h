@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RemoveIpRoutesRequest();
+    inline const char* GetServiceRequestName() const override { return "RemoveIpRoutes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
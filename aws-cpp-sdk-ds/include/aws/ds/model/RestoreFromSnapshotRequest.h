@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RestoreFromSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "RestoreFromSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
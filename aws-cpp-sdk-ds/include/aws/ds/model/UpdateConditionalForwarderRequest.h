@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateConditionalForwarderRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateConditionalForwarder"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateRadiusRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateRadius"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
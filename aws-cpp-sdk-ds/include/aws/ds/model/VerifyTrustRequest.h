@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     VerifyTrustRequest();
+    inline const char* GetServiceRequestName() const override { return "VerifyTrust"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
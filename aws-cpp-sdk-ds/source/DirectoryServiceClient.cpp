@@ -144,7 +144,7 @@ AddIpRoutesOutcome DirectoryServiceClient::AddIpRoutes(const AddIpRoutesRequest&
 
 AddIpRoutesOutcomeCallable DirectoryServiceClient::AddIpRoutesCallable(const AddIpRoutesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddIpRoutes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddIpRoutes(request); } );
 }
 
 void DirectoryServiceClient::AddIpRoutesAsync(const AddIpRoutesRequest& request, const AddIpRoutesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -152,6 +152,16 @@ void DirectoryServiceClient::AddIpRoutesAsync(const AddIpRoutesRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->AddIpRoutesAsyncHelper( request, handler, context ); } );
 }
 
+AddIpRoutesOutcomeCallable DirectoryServiceClient::AddIpRoutesCallable(AddIpRoutesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::AddIpRoutes, this, std::move(request)));
+}
+
+void DirectoryServiceClient::AddIpRoutesAsync(AddIpRoutesRequest&& request, const AddIpRoutesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::AddIpRoutesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::AddIpRoutesAsyncHelper(const AddIpRoutesRequest& request, const AddIpRoutesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddIpRoutes(request), context);
@@ -175,7 +185,7 @@ AddTagsToResourceOutcome DirectoryServiceClient::AddTagsToResource(const AddTags
 
 AddTagsToResourceOutcomeCallable DirectoryServiceClient::AddTagsToResourceCallable(const AddTagsToResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTagsToResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTagsToResource(request); } );
 }
 
 void DirectoryServiceClient::AddTagsToResourceAsync(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -183,6 +193,16 @@ void DirectoryServiceClient::AddTagsToResourceAsync(const AddTagsToResourceReque
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsToResourceAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsToResourceOutcomeCallable DirectoryServiceClient::AddTagsToResourceCallable(AddTagsToResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::AddTagsToResource, this, std::move(request)));
+}
+
+void DirectoryServiceClient::AddTagsToResourceAsync(AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::AddTagsToResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::AddTagsToResourceAsyncHelper(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTagsToResource(request), context);
@@ -206,7 +226,7 @@ ConnectDirectoryOutcome DirectoryServiceClient::ConnectDirectory(const ConnectDi
 
 ConnectDirectoryOutcomeCallable DirectoryServiceClient::ConnectDirectoryCallable(const ConnectDirectoryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ConnectDirectory(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ConnectDirectory(request); } );
 }
 
 void DirectoryServiceClient::ConnectDirectoryAsync(const ConnectDirectoryRequest& request, const ConnectDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -214,6 +234,16 @@ void DirectoryServiceClient::ConnectDirectoryAsync(const ConnectDirectoryRequest
   m_executor->Submit( [this, request, handler, context](){ this->ConnectDirectoryAsyncHelper( request, handler, context ); } );
 }
 
+ConnectDirectoryOutcomeCallable DirectoryServiceClient::ConnectDirectoryCallable(ConnectDirectoryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::ConnectDirectory, this, std::move(request)));
+}
+
+void DirectoryServiceClient::ConnectDirectoryAsync(ConnectDirectoryRequest&& request, const ConnectDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::ConnectDirectoryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::ConnectDirectoryAsyncHelper(const ConnectDirectoryRequest& request, const ConnectDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ConnectDirectory(request), context);
@@ -237,7 +267,7 @@ CreateAliasOutcome DirectoryServiceClient::CreateAlias(const CreateAliasRequest&
 
 CreateAliasOutcomeCallable DirectoryServiceClient::CreateAliasCallable(const CreateAliasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateAlias(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateAlias(request); } );
 }
 
 void DirectoryServiceClient::CreateAliasAsync(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -245,6 +275,16 @@ void DirectoryServiceClient::CreateAliasAsync(const CreateAliasRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->CreateAliasAsyncHelper( request, handler, context ); } );
 }
 
+CreateAliasOutcomeCallable DirectoryServiceClient::CreateAliasCallable(CreateAliasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::CreateAlias, this, std::move(request)));
+}
+
+void DirectoryServiceClient::CreateAliasAsync(CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::CreateAliasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::CreateAliasAsyncHelper(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateAlias(request), context);
@@ -268,7 +308,7 @@ CreateComputerOutcome DirectoryServiceClient::CreateComputer(const CreateCompute
 
 CreateComputerOutcomeCallable DirectoryServiceClient::CreateComputerCallable(const CreateComputerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateComputer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateComputer(request); } );
 }
 
 void DirectoryServiceClient::CreateComputerAsync(const CreateComputerRequest& request, const CreateComputerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -276,6 +316,16 @@ void DirectoryServiceClient::CreateComputerAsync(const CreateComputerRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->CreateComputerAsyncHelper( request, handler, context ); } );
 }
 
+CreateComputerOutcomeCallable DirectoryServiceClient::CreateComputerCallable(CreateComputerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::CreateComputer, this, std::move(request)));
+}
+
+void DirectoryServiceClient::CreateComputerAsync(CreateComputerRequest&& request, const CreateComputerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::CreateComputerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::CreateComputerAsyncHelper(const CreateComputerRequest& request, const CreateComputerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateComputer(request), context);
@@ -299,7 +349,7 @@ CreateConditionalForwarderOutcome DirectoryServiceClient::CreateConditionalForwa
 
 CreateConditionalForwarderOutcomeCallable DirectoryServiceClient::CreateConditionalForwarderCallable(const CreateConditionalForwarderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateConditionalForwarder(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateConditionalForwarder(request); } );
 }
 
 void DirectoryServiceClient::CreateConditionalForwarderAsync(const CreateConditionalForwarderRequest& request, const CreateConditionalForwarderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -307,6 +357,16 @@ void DirectoryServiceClient::CreateConditionalForwarderAsync(const CreateConditi
   m_executor->Submit( [this, request, handler, context](){ this->CreateConditionalForwarderAsyncHelper( request, handler, context ); } );
 }
 
+CreateConditionalForwarderOutcomeCallable DirectoryServiceClient::CreateConditionalForwarderCallable(CreateConditionalForwarderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::CreateConditionalForwarder, this, std::move(request)));
+}
+
+void DirectoryServiceClient::CreateConditionalForwarderAsync(CreateConditionalForwarderRequest&& request, const CreateConditionalForwarderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::CreateConditionalForwarderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::CreateConditionalForwarderAsyncHelper(const CreateConditionalForwarderRequest& request, const CreateConditionalForwarderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateConditionalForwarder(request), context);
@@ -330,7 +390,7 @@ CreateDirectoryOutcome DirectoryServiceClient::CreateDirectory(const CreateDirec
 
 CreateDirectoryOutcomeCallable DirectoryServiceClient::CreateDirectoryCallable(const CreateDirectoryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDirectory(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDirectory(request); } );
 }
 
 void DirectoryServiceClient::CreateDirectoryAsync(const CreateDirectoryRequest& request, const CreateDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -338,6 +398,16 @@ void DirectoryServiceClient::CreateDirectoryAsync(const CreateDirectoryRequest&
   m_executor->Submit( [this, request, handler, context](){ this->CreateDirectoryAsyncHelper( request, handler, context ); } );
 }
 
+CreateDirectoryOutcomeCallable DirectoryServiceClient::CreateDirectoryCallable(CreateDirectoryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::CreateDirectory, this, std::move(request)));
+}
+
+void DirectoryServiceClient::CreateDirectoryAsync(CreateDirectoryRequest&& request, const CreateDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::CreateDirectoryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::CreateDirectoryAsyncHelper(const CreateDirectoryRequest& request, const CreateDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDirectory(request), context);
@@ -361,7 +431,7 @@ CreateMicrosoftADOutcome DirectoryServiceClient::CreateMicrosoftAD(const CreateM
 
 CreateMicrosoftADOutcomeCallable DirectoryServiceClient::CreateMicrosoftADCallable(const CreateMicrosoftADRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateMicrosoftAD(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateMicrosoftAD(request); } );
 }
 
 void DirectoryServiceClient::CreateMicrosoftADAsync(const CreateMicrosoftADRequest& request, const CreateMicrosoftADResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -369,6 +439,16 @@ void DirectoryServiceClient::CreateMicrosoftADAsync(const CreateMicrosoftADReque
   m_executor->Submit( [this, request, handler, context](){ this->CreateMicrosoftADAsyncHelper( request, handler, context ); } );
 }
 
+CreateMicrosoftADOutcomeCallable DirectoryServiceClient::CreateMicrosoftADCallable(CreateMicrosoftADRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::CreateMicrosoftAD, this, std::move(request)));
+}
+
+void DirectoryServiceClient::CreateMicrosoftADAsync(CreateMicrosoftADRequest&& request, const CreateMicrosoftADResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::CreateMicrosoftADAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::CreateMicrosoftADAsyncHelper(const CreateMicrosoftADRequest& request, const CreateMicrosoftADResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateMicrosoftAD(request), context);
@@ -392,7 +472,7 @@ CreateSnapshotOutcome DirectoryServiceClient::CreateSnapshot(const CreateSnapsho
 
 CreateSnapshotOutcomeCallable DirectoryServiceClient::CreateSnapshotCallable(const CreateSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateSnapshot(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateSnapshot(request); } );
 }
 
 void DirectoryServiceClient::CreateSnapshotAsync(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -400,6 +480,16 @@ void DirectoryServiceClient::CreateSnapshotAsync(const CreateSnapshotRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->CreateSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+CreateSnapshotOutcomeCallable DirectoryServiceClient::CreateSnapshotCallable(CreateSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::CreateSnapshot, this, std::move(request)));
+}
+
+void DirectoryServiceClient::CreateSnapshotAsync(CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::CreateSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::CreateSnapshotAsyncHelper(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateSnapshot(request), context);
@@ -423,7 +513,7 @@ CreateTrustOutcome DirectoryServiceClient::CreateTrust(const CreateTrustRequest&
 
 CreateTrustOutcomeCallable DirectoryServiceClient::CreateTrustCallable(const CreateTrustRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateTrust(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateTrust(request); } );
 }
 
 void DirectoryServiceClient::CreateTrustAsync(const CreateTrustRequest& request, const CreateTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -431,6 +521,16 @@ void DirectoryServiceClient::CreateTrustAsync(const CreateTrustRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->CreateTrustAsyncHelper( request, handler, context ); } );
 }
 
+CreateTrustOutcomeCallable DirectoryServiceClient::CreateTrustCallable(CreateTrustRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::CreateTrust, this, std::move(request)));
+}
+
+void DirectoryServiceClient::CreateTrustAsync(CreateTrustRequest&& request, const CreateTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::CreateTrustAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::CreateTrustAsyncHelper(const CreateTrustRequest& request, const CreateTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateTrust(request), context);
@@ -454,7 +554,7 @@ DeleteConditionalForwarderOutcome DirectoryServiceClient::DeleteConditionalForwa
 
 DeleteConditionalForwarderOutcomeCallable DirectoryServiceClient::DeleteConditionalForwarderCallable(const DeleteConditionalForwarderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteConditionalForwarder(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteConditionalForwarder(request); } );
 }
 
 void DirectoryServiceClient::DeleteConditionalForwarderAsync(const DeleteConditionalForwarderRequest& request, const DeleteConditionalForwarderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -462,6 +562,16 @@ void DirectoryServiceClient::DeleteConditionalForwarderAsync(const DeleteConditi
   m_executor->Submit( [this, request, handler, context](){ this->DeleteConditionalForwarderAsyncHelper( request, handler, context ); } );
 }
 
+DeleteConditionalForwarderOutcomeCallable DirectoryServiceClient::DeleteConditionalForwarderCallable(DeleteConditionalForwarderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::DeleteConditionalForwarder, this, std::move(request)));
+}
+
+void DirectoryServiceClient::DeleteConditionalForwarderAsync(DeleteConditionalForwarderRequest&& request, const DeleteConditionalForwarderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::DeleteConditionalForwarderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::DeleteConditionalForwarderAsyncHelper(const DeleteConditionalForwarderRequest& request, const DeleteConditionalForwarderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteConditionalForwarder(request), context);
@@ -485,7 +595,7 @@ DeleteDirectoryOutcome DirectoryServiceClient::DeleteDirectory(const DeleteDirec
 
 DeleteDirectoryOutcomeCallable DirectoryServiceClient::DeleteDirectoryCallable(const DeleteDirectoryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDirectory(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDirectory(request); } );
 }
 
 void DirectoryServiceClient::DeleteDirectoryAsync(const DeleteDirectoryRequest& request, const DeleteDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -493,6 +603,16 @@ void DirectoryServiceClient::DeleteDirectoryAsync(const DeleteDirectoryRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDirectoryAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDirectoryOutcomeCallable DirectoryServiceClient::DeleteDirectoryCallable(DeleteDirectoryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::DeleteDirectory, this, std::move(request)));
+}
+
+void DirectoryServiceClient::DeleteDirectoryAsync(DeleteDirectoryRequest&& request, const DeleteDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::DeleteDirectoryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::DeleteDirectoryAsyncHelper(const DeleteDirectoryRequest& request, const DeleteDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDirectory(request), context);
@@ -516,7 +636,7 @@ DeleteSnapshotOutcome DirectoryServiceClient::DeleteSnapshot(const DeleteSnapsho
 
 DeleteSnapshotOutcomeCallable DirectoryServiceClient::DeleteSnapshotCallable(const DeleteSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteSnapshot(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteSnapshot(request); } );
 }
 
 void DirectoryServiceClient::DeleteSnapshotAsync(const DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -524,6 +644,16 @@ void DirectoryServiceClient::DeleteSnapshotAsync(const DeleteSnapshotRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->DeleteSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+DeleteSnapshotOutcomeCallable DirectoryServiceClient::DeleteSnapshotCallable(DeleteSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::DeleteSnapshot, this, std::move(request)));
+}
+
+void DirectoryServiceClient::DeleteSnapshotAsync(DeleteSnapshotRequest&& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::DeleteSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::DeleteSnapshotAsyncHelper(const DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteSnapshot(request), context);
@@ -547,7 +677,7 @@ DeleteTrustOutcome DirectoryServiceClient::DeleteTrust(const DeleteTrustRequest&
 
 DeleteTrustOutcomeCallable DirectoryServiceClient::DeleteTrustCallable(const DeleteTrustRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTrust(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTrust(request); } );
 }
 
 void DirectoryServiceClient::DeleteTrustAsync(const DeleteTrustRequest& request, const DeleteTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -555,6 +685,16 @@ void DirectoryServiceClient::DeleteTrustAsync(const DeleteTrustRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTrustAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTrustOutcomeCallable DirectoryServiceClient::DeleteTrustCallable(DeleteTrustRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::DeleteTrust, this, std::move(request)));
+}
+
+void DirectoryServiceClient::DeleteTrustAsync(DeleteTrustRequest&& request, const DeleteTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::DeleteTrustAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::DeleteTrustAsyncHelper(const DeleteTrustRequest& request, const DeleteTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTrust(request), context);
@@ -578,7 +718,7 @@ DeregisterEventTopicOutcome DirectoryServiceClient::DeregisterEventTopic(const D
 
 DeregisterEventTopicOutcomeCallable DirectoryServiceClient::DeregisterEventTopicCallable(const DeregisterEventTopicRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeregisterEventTopic(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeregisterEventTopic(request); } );
 }
 
 void DirectoryServiceClient::DeregisterEventTopicAsync(const DeregisterEventTopicRequest& request, const DeregisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -586,6 +726,16 @@ void DirectoryServiceClient::DeregisterEventTopicAsync(const DeregisterEventTopi
   m_executor->Submit( [this, request, handler, context](){ this->DeregisterEventTopicAsyncHelper( request, handler, context ); } );
 }
 
+DeregisterEventTopicOutcomeCallable DirectoryServiceClient::DeregisterEventTopicCallable(DeregisterEventTopicRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::DeregisterEventTopic, this, std::move(request)));
+}
+
+void DirectoryServiceClient::DeregisterEventTopicAsync(DeregisterEventTopicRequest&& request, const DeregisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::DeregisterEventTopicAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::DeregisterEventTopicAsyncHelper(const DeregisterEventTopicRequest& request, const DeregisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeregisterEventTopic(request), context);
@@ -609,7 +759,7 @@ DescribeConditionalForwardersOutcome DirectoryServiceClient::DescribeConditional
 
 DescribeConditionalForwardersOutcomeCallable DirectoryServiceClient::DescribeConditionalForwardersCallable(const DescribeConditionalForwardersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeConditionalForwarders(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeConditionalForwarders(request); } );
 }
 
 void DirectoryServiceClient::DescribeConditionalForwardersAsync(const DescribeConditionalForwardersRequest& request, const DescribeConditionalForwardersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -617,6 +767,16 @@ void DirectoryServiceClient::DescribeConditionalForwardersAsync(const DescribeCo
   m_executor->Submit( [this, request, handler, context](){ this->DescribeConditionalForwardersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeConditionalForwardersOutcomeCallable DirectoryServiceClient::DescribeConditionalForwardersCallable(DescribeConditionalForwardersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::DescribeConditionalForwarders, this, std::move(request)));
+}
+
+void DirectoryServiceClient::DescribeConditionalForwardersAsync(DescribeConditionalForwardersRequest&& request, const DescribeConditionalForwardersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::DescribeConditionalForwardersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::DescribeConditionalForwardersAsyncHelper(const DescribeConditionalForwardersRequest& request, const DescribeConditionalForwardersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeConditionalForwarders(request), context);
@@ -640,7 +800,7 @@ DescribeDirectoriesOutcome DirectoryServiceClient::DescribeDirectories(const Des
 
 DescribeDirectoriesOutcomeCallable DirectoryServiceClient::DescribeDirectoriesCallable(const DescribeDirectoriesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDirectories(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDirectories(request); } );
 }
 
 void DirectoryServiceClient::DescribeDirectoriesAsync(const DescribeDirectoriesRequest& request, const DescribeDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -648,6 +808,16 @@ void DirectoryServiceClient::DescribeDirectoriesAsync(const DescribeDirectoriesR
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDirectoriesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDirectoriesOutcomeCallable DirectoryServiceClient::DescribeDirectoriesCallable(DescribeDirectoriesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::DescribeDirectories, this, std::move(request)));
+}
+
+void DirectoryServiceClient::DescribeDirectoriesAsync(DescribeDirectoriesRequest&& request, const DescribeDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::DescribeDirectoriesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::DescribeDirectoriesAsyncHelper(const DescribeDirectoriesRequest& request, const DescribeDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDirectories(request), context);
@@ -671,7 +841,7 @@ DescribeEventTopicsOutcome DirectoryServiceClient::DescribeEventTopics(const Des
 
 DescribeEventTopicsOutcomeCallable DirectoryServiceClient::DescribeEventTopicsCallable(const DescribeEventTopicsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEventTopics(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEventTopics(request); } );
 }
 
 void DirectoryServiceClient::DescribeEventTopicsAsync(const DescribeEventTopicsRequest& request, const DescribeEventTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -679,6 +849,16 @@ void DirectoryServiceClient::DescribeEventTopicsAsync(const DescribeEventTopicsR
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEventTopicsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEventTopicsOutcomeCallable DirectoryServiceClient::DescribeEventTopicsCallable(DescribeEventTopicsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::DescribeEventTopics, this, std::move(request)));
+}
+
+void DirectoryServiceClient::DescribeEventTopicsAsync(DescribeEventTopicsRequest&& request, const DescribeEventTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::DescribeEventTopicsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::DescribeEventTopicsAsyncHelper(const DescribeEventTopicsRequest& request, const DescribeEventTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEventTopics(request), context);
@@ -702,7 +882,7 @@ DescribeSnapshotsOutcome DirectoryServiceClient::DescribeSnapshots(const Describ
 
 DescribeSnapshotsOutcomeCallable DirectoryServiceClient::DescribeSnapshotsCallable(const DescribeSnapshotsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSnapshots(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSnapshots(request); } );
 }
 
 void DirectoryServiceClient::DescribeSnapshotsAsync(const DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -710,6 +890,16 @@ void DirectoryServiceClient::DescribeSnapshotsAsync(const DescribeSnapshotsReque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSnapshotsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSnapshotsOutcomeCallable DirectoryServiceClient::DescribeSnapshotsCallable(DescribeSnapshotsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::DescribeSnapshots, this, std::move(request)));
+}
+
+void DirectoryServiceClient::DescribeSnapshotsAsync(DescribeSnapshotsRequest&& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::DescribeSnapshotsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::DescribeSnapshotsAsyncHelper(const DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSnapshots(request), context);
@@ -733,7 +923,7 @@ DescribeTrustsOutcome DirectoryServiceClient::DescribeTrusts(const DescribeTrust
 
 DescribeTrustsOutcomeCallable DirectoryServiceClient::DescribeTrustsCallable(const DescribeTrustsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTrusts(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTrusts(request); } );
 }
 
 void DirectoryServiceClient::DescribeTrustsAsync(const DescribeTrustsRequest& request, const DescribeTrustsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -741,6 +931,16 @@ void DirectoryServiceClient::DescribeTrustsAsync(const DescribeTrustsRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTrustsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTrustsOutcomeCallable DirectoryServiceClient::DescribeTrustsCallable(DescribeTrustsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::DescribeTrusts, this, std::move(request)));
+}
+
+void DirectoryServiceClient::DescribeTrustsAsync(DescribeTrustsRequest&& request, const DescribeTrustsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::DescribeTrustsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::DescribeTrustsAsyncHelper(const DescribeTrustsRequest& request, const DescribeTrustsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTrusts(request), context);
@@ -764,7 +964,7 @@ DisableRadiusOutcome DirectoryServiceClient::DisableRadius(const DisableRadiusRe
 
 DisableRadiusOutcomeCallable DirectoryServiceClient::DisableRadiusCallable(const DisableRadiusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableRadius(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableRadius(request); } );
 }
 
 void DirectoryServiceClient::DisableRadiusAsync(const DisableRadiusRequest& request, const DisableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -772,6 +972,16 @@ void DirectoryServiceClient::DisableRadiusAsync(const DisableRadiusRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->DisableRadiusAsyncHelper( request, handler, context ); } );
 }
 
+DisableRadiusOutcomeCallable DirectoryServiceClient::DisableRadiusCallable(DisableRadiusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::DisableRadius, this, std::move(request)));
+}
+
+void DirectoryServiceClient::DisableRadiusAsync(DisableRadiusRequest&& request, const DisableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::DisableRadiusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::DisableRadiusAsyncHelper(const DisableRadiusRequest& request, const DisableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableRadius(request), context);
@@ -795,7 +1005,7 @@ DisableSsoOutcome DirectoryServiceClient::DisableSso(const DisableSsoRequest& re
 
 DisableSsoOutcomeCallable DirectoryServiceClient::DisableSsoCallable(const DisableSsoRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableSso(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableSso(request); } );
 }
 
 void DirectoryServiceClient::DisableSsoAsync(const DisableSsoRequest& request, const DisableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -803,6 +1013,16 @@ void DirectoryServiceClient::DisableSsoAsync(const DisableSsoRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->DisableSsoAsyncHelper( request, handler, context ); } );
 }
 
+DisableSsoOutcomeCallable DirectoryServiceClient::DisableSsoCallable(DisableSsoRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::DisableSso, this, std::move(request)));
+}
+
+void DirectoryServiceClient::DisableSsoAsync(DisableSsoRequest&& request, const DisableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::DisableSsoAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::DisableSsoAsyncHelper(const DisableSsoRequest& request, const DisableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableSso(request), context);
@@ -826,7 +1046,7 @@ EnableRadiusOutcome DirectoryServiceClient::EnableRadius(const EnableRadiusReque
 
 EnableRadiusOutcomeCallable DirectoryServiceClient::EnableRadiusCallable(const EnableRadiusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableRadius(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableRadius(request); } );
 }
 
 void DirectoryServiceClient::EnableRadiusAsync(const EnableRadiusRequest& request, const EnableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -834,6 +1054,16 @@ void DirectoryServiceClient::EnableRadiusAsync(const EnableRadiusRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->EnableRadiusAsyncHelper( request, handler, context ); } );
 }
 
+EnableRadiusOutcomeCallable DirectoryServiceClient::EnableRadiusCallable(EnableRadiusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::EnableRadius, this, std::move(request)));
+}
+
+void DirectoryServiceClient::EnableRadiusAsync(EnableRadiusRequest&& request, const EnableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::EnableRadiusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::EnableRadiusAsyncHelper(const EnableRadiusRequest& request, const EnableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableRadius(request), context);
@@ -857,7 +1087,7 @@ EnableSsoOutcome DirectoryServiceClient::EnableSso(const EnableSsoRequest& reque
 
 EnableSsoOutcomeCallable DirectoryServiceClient::EnableSsoCallable(const EnableSsoRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableSso(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableSso(request); } );
 }
 
 void DirectoryServiceClient::EnableSsoAsync(const EnableSsoRequest& request, const EnableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -865,6 +1095,16 @@ void DirectoryServiceClient::EnableSsoAsync(const EnableSsoRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->EnableSsoAsyncHelper( request, handler, context ); } );
 }
 
+EnableSsoOutcomeCallable DirectoryServiceClient::EnableSsoCallable(EnableSsoRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::EnableSso, this, std::move(request)));
+}
+
+void DirectoryServiceClient::EnableSsoAsync(EnableSsoRequest&& request, const EnableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::EnableSsoAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::EnableSsoAsyncHelper(const EnableSsoRequest& request, const EnableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableSso(request), context);
@@ -888,7 +1128,7 @@ GetDirectoryLimitsOutcome DirectoryServiceClient::GetDirectoryLimits(const GetDi
 
 GetDirectoryLimitsOutcomeCallable DirectoryServiceClient::GetDirectoryLimitsCallable(const GetDirectoryLimitsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDirectoryLimits(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDirectoryLimits(request); } );
 }
 
 void DirectoryServiceClient::GetDirectoryLimitsAsync(const GetDirectoryLimitsRequest& request, const GetDirectoryLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -896,6 +1136,16 @@ void DirectoryServiceClient::GetDirectoryLimitsAsync(const GetDirectoryLimitsReq
   m_executor->Submit( [this, request, handler, context](){ this->GetDirectoryLimitsAsyncHelper( request, handler, context ); } );
 }
 
+GetDirectoryLimitsOutcomeCallable DirectoryServiceClient::GetDirectoryLimitsCallable(GetDirectoryLimitsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::GetDirectoryLimits, this, std::move(request)));
+}
+
+void DirectoryServiceClient::GetDirectoryLimitsAsync(GetDirectoryLimitsRequest&& request, const GetDirectoryLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::GetDirectoryLimitsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::GetDirectoryLimitsAsyncHelper(const GetDirectoryLimitsRequest& request, const GetDirectoryLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDirectoryLimits(request), context);
@@ -919,7 +1169,7 @@ GetSnapshotLimitsOutcome DirectoryServiceClient::GetSnapshotLimits(const GetSnap
 
 GetSnapshotLimitsOutcomeCallable DirectoryServiceClient::GetSnapshotLimitsCallable(const GetSnapshotLimitsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetSnapshotLimits(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetSnapshotLimits(request); } );
 }
 
 void DirectoryServiceClient::GetSnapshotLimitsAsync(const GetSnapshotLimitsRequest& request, const GetSnapshotLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -927,6 +1177,16 @@ void DirectoryServiceClient::GetSnapshotLimitsAsync(const GetSnapshotLimitsReque
   m_executor->Submit( [this, request, handler, context](){ this->GetSnapshotLimitsAsyncHelper( request, handler, context ); } );
 }
 
+GetSnapshotLimitsOutcomeCallable DirectoryServiceClient::GetSnapshotLimitsCallable(GetSnapshotLimitsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::GetSnapshotLimits, this, std::move(request)));
+}
+
+void DirectoryServiceClient::GetSnapshotLimitsAsync(GetSnapshotLimitsRequest&& request, const GetSnapshotLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::GetSnapshotLimitsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::GetSnapshotLimitsAsyncHelper(const GetSnapshotLimitsRequest& request, const GetSnapshotLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetSnapshotLimits(request), context);
@@ -950,7 +1210,7 @@ ListIpRoutesOutcome DirectoryServiceClient::ListIpRoutes(const ListIpRoutesReque
 
 ListIpRoutesOutcomeCallable DirectoryServiceClient::ListIpRoutesCallable(const ListIpRoutesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListIpRoutes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListIpRoutes(request); } );
 }
 
 void DirectoryServiceClient::ListIpRoutesAsync(const ListIpRoutesRequest& request, const ListIpRoutesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -958,6 +1218,16 @@ void DirectoryServiceClient::ListIpRoutesAsync(const ListIpRoutesRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->ListIpRoutesAsyncHelper( request, handler, context ); } );
 }
 
+ListIpRoutesOutcomeCallable DirectoryServiceClient::ListIpRoutesCallable(ListIpRoutesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::ListIpRoutes, this, std::move(request)));
+}
+
+void DirectoryServiceClient::ListIpRoutesAsync(ListIpRoutesRequest&& request, const ListIpRoutesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::ListIpRoutesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::ListIpRoutesAsyncHelper(const ListIpRoutesRequest& request, const ListIpRoutesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListIpRoutes(request), context);
@@ -981,7 +1251,7 @@ ListTagsForResourceOutcome DirectoryServiceClient::ListTagsForResource(const Lis
 
 ListTagsForResourceOutcomeCallable DirectoryServiceClient::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTagsForResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTagsForResource(request); } );
 }
 
 void DirectoryServiceClient::ListTagsForResourceAsync(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -989,6 +1259,16 @@ void DirectoryServiceClient::ListTagsForResourceAsync(const ListTagsForResourceR
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsForResourceAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsForResourceOutcomeCallable DirectoryServiceClient::ListTagsForResourceCallable(ListTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::ListTagsForResource, this, std::move(request)));
+}
+
+void DirectoryServiceClient::ListTagsForResourceAsync(ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::ListTagsForResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTagsForResource(request), context);
@@ -1012,7 +1292,7 @@ RegisterEventTopicOutcome DirectoryServiceClient::RegisterEventTopic(const Regis
 
 RegisterEventTopicOutcomeCallable DirectoryServiceClient::RegisterEventTopicCallable(const RegisterEventTopicRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterEventTopic(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterEventTopic(request); } );
 }
 
 void DirectoryServiceClient::RegisterEventTopicAsync(const RegisterEventTopicRequest& request, const RegisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1020,6 +1300,16 @@ void DirectoryServiceClient::RegisterEventTopicAsync(const RegisterEventTopicReq
   m_executor->Submit( [this, request, handler, context](){ this->RegisterEventTopicAsyncHelper( request, handler, context ); } );
 }
 
+RegisterEventTopicOutcomeCallable DirectoryServiceClient::RegisterEventTopicCallable(RegisterEventTopicRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::RegisterEventTopic, this, std::move(request)));
+}
+
+void DirectoryServiceClient::RegisterEventTopicAsync(RegisterEventTopicRequest&& request, const RegisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::RegisterEventTopicAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::RegisterEventTopicAsyncHelper(const RegisterEventTopicRequest& request, const RegisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterEventTopic(request), context);
@@ -1043,7 +1333,7 @@ RemoveIpRoutesOutcome DirectoryServiceClient::RemoveIpRoutes(const RemoveIpRoute
 
 RemoveIpRoutesOutcomeCallable DirectoryServiceClient::RemoveIpRoutesCallable(const RemoveIpRoutesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveIpRoutes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveIpRoutes(request); } );
 }
 
 void DirectoryServiceClient::RemoveIpRoutesAsync(const RemoveIpRoutesRequest& request, const RemoveIpRoutesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1051,6 +1341,16 @@ void DirectoryServiceClient::RemoveIpRoutesAsync(const RemoveIpRoutesRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->RemoveIpRoutesAsyncHelper( request, handler, context ); } );
 }
 
+RemoveIpRoutesOutcomeCallable DirectoryServiceClient::RemoveIpRoutesCallable(RemoveIpRoutesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::RemoveIpRoutes, this, std::move(request)));
+}
+
+void DirectoryServiceClient::RemoveIpRoutesAsync(RemoveIpRoutesRequest&& request, const RemoveIpRoutesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::RemoveIpRoutesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::RemoveIpRoutesAsyncHelper(const RemoveIpRoutesRequest& request, const RemoveIpRoutesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveIpRoutes(request), context);
@@ -1074,7 +1374,7 @@ RemoveTagsFromResourceOutcome DirectoryServiceClient::RemoveTagsFromResource(con
 
 RemoveTagsFromResourceOutcomeCallable DirectoryServiceClient::RemoveTagsFromResourceCallable(const RemoveTagsFromResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTagsFromResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTagsFromResource(request); } );
 }
 
 void DirectoryServiceClient::RemoveTagsFromResourceAsync(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1082,6 +1382,16 @@ void DirectoryServiceClient::RemoveTagsFromResourceAsync(const RemoveTagsFromRes
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsFromResourceAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsFromResourceOutcomeCallable DirectoryServiceClient::RemoveTagsFromResourceCallable(RemoveTagsFromResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::RemoveTagsFromResource, this, std::move(request)));
+}
+
+void DirectoryServiceClient::RemoveTagsFromResourceAsync(RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::RemoveTagsFromResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::RemoveTagsFromResourceAsyncHelper(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTagsFromResource(request), context);
@@ -1105,7 +1415,7 @@ RestoreFromSnapshotOutcome DirectoryServiceClient::RestoreFromSnapshot(const Res
 
 RestoreFromSnapshotOutcomeCallable DirectoryServiceClient::RestoreFromSnapshotCallable(const RestoreFromSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RestoreFromSnapshot(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RestoreFromSnapshot(request); } );
 }
 
 void DirectoryServiceClient::RestoreFromSnapshotAsync(const RestoreFromSnapshotRequest& request, const RestoreFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1113,6 +1423,16 @@ void DirectoryServiceClient::RestoreFromSnapshotAsync(const RestoreFromSnapshotR
   m_executor->Submit( [this, request, handler, context](){ this->RestoreFromSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+RestoreFromSnapshotOutcomeCallable DirectoryServiceClient::RestoreFromSnapshotCallable(RestoreFromSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::RestoreFromSnapshot, this, std::move(request)));
+}
+
+void DirectoryServiceClient::RestoreFromSnapshotAsync(RestoreFromSnapshotRequest&& request, const RestoreFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::RestoreFromSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::RestoreFromSnapshotAsyncHelper(const RestoreFromSnapshotRequest& request, const RestoreFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RestoreFromSnapshot(request), context);
@@ -1136,7 +1456,7 @@ UpdateConditionalForwarderOutcome DirectoryServiceClient::UpdateConditionalForwa
 
 UpdateConditionalForwarderOutcomeCallable DirectoryServiceClient::UpdateConditionalForwarderCallable(const UpdateConditionalForwarderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateConditionalForwarder(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateConditionalForwarder(request); } );
 }
 
 void DirectoryServiceClient::UpdateConditionalForwarderAsync(const UpdateConditionalForwarderRequest& request, const UpdateConditionalForwarderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1144,6 +1464,16 @@ void DirectoryServiceClient::UpdateConditionalForwarderAsync(const UpdateConditi
   m_executor->Submit( [this, request, handler, context](){ this->UpdateConditionalForwarderAsyncHelper( request, handler, context ); } );
 }
 
+UpdateConditionalForwarderOutcomeCallable DirectoryServiceClient::UpdateConditionalForwarderCallable(UpdateConditionalForwarderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::UpdateConditionalForwarder, this, std::move(request)));
+}
+
+void DirectoryServiceClient::UpdateConditionalForwarderAsync(UpdateConditionalForwarderRequest&& request, const UpdateConditionalForwarderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::UpdateConditionalForwarderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::UpdateConditionalForwarderAsyncHelper(const UpdateConditionalForwarderRequest& request, const UpdateConditionalForwarderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateConditionalForwarder(request), context);
@@ -1167,7 +1497,7 @@ UpdateRadiusOutcome DirectoryServiceClient::UpdateRadius(const UpdateRadiusReque
 
 UpdateRadiusOutcomeCallable DirectoryServiceClient::UpdateRadiusCallable(const UpdateRadiusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateRadius(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateRadius(request); } );
 }
 
 void DirectoryServiceClient::UpdateRadiusAsync(const UpdateRadiusRequest& request, const UpdateRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1175,6 +1505,16 @@ void DirectoryServiceClient::UpdateRadiusAsync(const UpdateRadiusRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->UpdateRadiusAsyncHelper( request, handler, context ); } );
 }
 
+UpdateRadiusOutcomeCallable DirectoryServiceClient::UpdateRadiusCallable(UpdateRadiusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::UpdateRadius, this, std::move(request)));
+}
+
+void DirectoryServiceClient::UpdateRadiusAsync(UpdateRadiusRequest&& request, const UpdateRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::UpdateRadiusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::UpdateRadiusAsyncHelper(const UpdateRadiusRequest& request, const UpdateRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateRadius(request), context);
@@ -1198,7 +1538,7 @@ VerifyTrustOutcome DirectoryServiceClient::VerifyTrust(const VerifyTrustRequest&
 
 VerifyTrustOutcomeCallable DirectoryServiceClient::VerifyTrustCallable(const VerifyTrustRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->VerifyTrust(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->VerifyTrust(request); } );
 }
 
 void DirectoryServiceClient::VerifyTrustAsync(const VerifyTrustRequest& request, const VerifyTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1206,8 +1546,280 @@ void DirectoryServiceClient::VerifyTrustAsync(const VerifyTrustRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->VerifyTrustAsyncHelper( request, handler, context ); } );
 }
 
+VerifyTrustOutcomeCallable DirectoryServiceClient::VerifyTrustCallable(VerifyTrustRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DirectoryServiceClient::VerifyTrust, this, std::move(request)));
+}
+
+void DirectoryServiceClient::VerifyTrustAsync(VerifyTrustRequest&& request, const VerifyTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DirectoryServiceClient::VerifyTrustAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DirectoryServiceClient::VerifyTrustAsyncHelper(const VerifyTrustRequest& request, const VerifyTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, VerifyTrust(request), context);
 }
 
+Paginator<DirectoryServiceClient, DescribeDirectoriesRequest, DescribeDirectoriesOutcome> DirectoryServiceClient::DescribeDirectoriesPaginator(const DescribeDirectoriesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DirectoryServiceClient, DescribeDirectoriesRequest, DescribeDirectoriesOutcome>(this, &DirectoryServiceClient::DescribeDirectories, request,
+    [](const DescribeDirectoriesRequest& current, const DescribeDirectoriesOutcome& outcome, DescribeDirectoriesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DirectoryServiceClient, DescribeSnapshotsRequest, DescribeSnapshotsOutcome> DirectoryServiceClient::DescribeSnapshotsPaginator(const DescribeSnapshotsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DirectoryServiceClient, DescribeSnapshotsRequest, DescribeSnapshotsOutcome>(this, &DirectoryServiceClient::DescribeSnapshots, request,
+    [](const DescribeSnapshotsRequest& current, const DescribeSnapshotsOutcome& outcome, DescribeSnapshotsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DirectoryServiceClient, DescribeTrustsRequest, DescribeTrustsOutcome> DirectoryServiceClient::DescribeTrustsPaginator(const DescribeTrustsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DirectoryServiceClient, DescribeTrustsRequest, DescribeTrustsOutcome>(this, &DirectoryServiceClient::DescribeTrusts, request,
+    [](const DescribeTrustsRequest& current, const DescribeTrustsOutcome& outcome, DescribeTrustsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DirectoryServiceClient, ListIpRoutesRequest, ListIpRoutesOutcome> DirectoryServiceClient::ListIpRoutesPaginator(const ListIpRoutesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DirectoryServiceClient, ListIpRoutesRequest, ListIpRoutesOutcome>(this, &DirectoryServiceClient::ListIpRoutes, request,
+    [](const ListIpRoutesRequest& current, const ListIpRoutesOutcome& outcome, ListIpRoutesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DirectoryServiceClient, ListTagsForResourceRequest, ListTagsForResourceOutcome> DirectoryServiceClient::ListTagsForResourcePaginator(const ListTagsForResourceRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DirectoryServiceClient, ListTagsForResourceRequest, ListTagsForResourceOutcome>(this, &DirectoryServiceClient::ListTagsForResource, request,
+    [](const ListTagsForResourceRequest& current, const ListTagsForResourceOutcome& outcome, ListTagsForResourceRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<DirectoryServiceClient, AddIpRoutesRequest, AddIpRoutesOutcome> DirectoryServiceClient::AddIpRoutesAwaitable(AddIpRoutesRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::AddIpRoutes, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, AddTagsToResourceRequest, AddTagsToResourceOutcome> DirectoryServiceClient::AddTagsToResourceAwaitable(AddTagsToResourceRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::AddTagsToResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, ConnectDirectoryRequest, ConnectDirectoryOutcome> DirectoryServiceClient::ConnectDirectoryAwaitable(ConnectDirectoryRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::ConnectDirectory, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, CreateAliasRequest, CreateAliasOutcome> DirectoryServiceClient::CreateAliasAwaitable(CreateAliasRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::CreateAlias, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, CreateComputerRequest, CreateComputerOutcome> DirectoryServiceClient::CreateComputerAwaitable(CreateComputerRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::CreateComputer, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, CreateConditionalForwarderRequest, CreateConditionalForwarderOutcome> DirectoryServiceClient::CreateConditionalForwarderAwaitable(CreateConditionalForwarderRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::CreateConditionalForwarder, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, CreateDirectoryRequest, CreateDirectoryOutcome> DirectoryServiceClient::CreateDirectoryAwaitable(CreateDirectoryRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::CreateDirectory, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, CreateMicrosoftADRequest, CreateMicrosoftADOutcome> DirectoryServiceClient::CreateMicrosoftADAwaitable(CreateMicrosoftADRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::CreateMicrosoftAD, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, CreateSnapshotRequest, CreateSnapshotOutcome> DirectoryServiceClient::CreateSnapshotAwaitable(CreateSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::CreateSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, CreateTrustRequest, CreateTrustOutcome> DirectoryServiceClient::CreateTrustAwaitable(CreateTrustRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::CreateTrust, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, DeleteConditionalForwarderRequest, DeleteConditionalForwarderOutcome> DirectoryServiceClient::DeleteConditionalForwarderAwaitable(DeleteConditionalForwarderRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::DeleteConditionalForwarder, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, DeleteDirectoryRequest, DeleteDirectoryOutcome> DirectoryServiceClient::DeleteDirectoryAwaitable(DeleteDirectoryRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::DeleteDirectory, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, DeleteSnapshotRequest, DeleteSnapshotOutcome> DirectoryServiceClient::DeleteSnapshotAwaitable(DeleteSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::DeleteSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, DeleteTrustRequest, DeleteTrustOutcome> DirectoryServiceClient::DeleteTrustAwaitable(DeleteTrustRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::DeleteTrust, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, DeregisterEventTopicRequest, DeregisterEventTopicOutcome> DirectoryServiceClient::DeregisterEventTopicAwaitable(DeregisterEventTopicRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::DeregisterEventTopic, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, DescribeConditionalForwardersRequest, DescribeConditionalForwardersOutcome> DirectoryServiceClient::DescribeConditionalForwardersAwaitable(DescribeConditionalForwardersRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::DescribeConditionalForwarders, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, DescribeDirectoriesRequest, DescribeDirectoriesOutcome> DirectoryServiceClient::DescribeDirectoriesAwaitable(DescribeDirectoriesRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::DescribeDirectories, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, DescribeEventTopicsRequest, DescribeEventTopicsOutcome> DirectoryServiceClient::DescribeEventTopicsAwaitable(DescribeEventTopicsRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::DescribeEventTopics, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, DescribeSnapshotsRequest, DescribeSnapshotsOutcome> DirectoryServiceClient::DescribeSnapshotsAwaitable(DescribeSnapshotsRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::DescribeSnapshots, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, DescribeTrustsRequest, DescribeTrustsOutcome> DirectoryServiceClient::DescribeTrustsAwaitable(DescribeTrustsRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::DescribeTrusts, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, DisableRadiusRequest, DisableRadiusOutcome> DirectoryServiceClient::DisableRadiusAwaitable(DisableRadiusRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::DisableRadius, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, DisableSsoRequest, DisableSsoOutcome> DirectoryServiceClient::DisableSsoAwaitable(DisableSsoRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::DisableSso, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, EnableRadiusRequest, EnableRadiusOutcome> DirectoryServiceClient::EnableRadiusAwaitable(EnableRadiusRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::EnableRadius, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, EnableSsoRequest, EnableSsoOutcome> DirectoryServiceClient::EnableSsoAwaitable(EnableSsoRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::EnableSso, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, GetDirectoryLimitsRequest, GetDirectoryLimitsOutcome> DirectoryServiceClient::GetDirectoryLimitsAwaitable(GetDirectoryLimitsRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::GetDirectoryLimits, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, GetSnapshotLimitsRequest, GetSnapshotLimitsOutcome> DirectoryServiceClient::GetSnapshotLimitsAwaitable(GetSnapshotLimitsRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::GetSnapshotLimits, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, ListIpRoutesRequest, ListIpRoutesOutcome> DirectoryServiceClient::ListIpRoutesAwaitable(ListIpRoutesRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::ListIpRoutes, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, ListTagsForResourceRequest, ListTagsForResourceOutcome> DirectoryServiceClient::ListTagsForResourceAwaitable(ListTagsForResourceRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::ListTagsForResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, RegisterEventTopicRequest, RegisterEventTopicOutcome> DirectoryServiceClient::RegisterEventTopicAwaitable(RegisterEventTopicRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::RegisterEventTopic, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, RemoveIpRoutesRequest, RemoveIpRoutesOutcome> DirectoryServiceClient::RemoveIpRoutesAwaitable(RemoveIpRoutesRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::RemoveIpRoutes, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, RemoveTagsFromResourceRequest, RemoveTagsFromResourceOutcome> DirectoryServiceClient::RemoveTagsFromResourceAwaitable(RemoveTagsFromResourceRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::RemoveTagsFromResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, RestoreFromSnapshotRequest, RestoreFromSnapshotOutcome> DirectoryServiceClient::RestoreFromSnapshotAwaitable(RestoreFromSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::RestoreFromSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, UpdateConditionalForwarderRequest, UpdateConditionalForwarderOutcome> DirectoryServiceClient::UpdateConditionalForwarderAwaitable(UpdateConditionalForwarderRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::UpdateConditionalForwarder, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, UpdateRadiusRequest, UpdateRadiusOutcome> DirectoryServiceClient::UpdateRadiusAwaitable(UpdateRadiusRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::UpdateRadius, std::move(request) } };
+}
+
+ClientOperationAwaitable<DirectoryServiceClient, VerifyTrustRequest, VerifyTrustOutcome> DirectoryServiceClient::VerifyTrustAwaitable(VerifyTrustRequest request) const
+{
+  return { m_executor.get(), { this, &DirectoryServiceClient::VerifyTrust, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,21 +29,29 @@ namespace Aws
       namespace DirectorySizeMapper
       {
 
-        static const int Small_HASH = HashingUtils::HashString("Small");
-        static const int Large_HASH = HashingUtils::HashString("Large");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Small_HASH = 79996135;
+        static const int Large_HASH = 73190171;
 
 
         DirectorySize GetDirectorySizeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Small_HASH)
+          switch (hashCode)
           {
+          case Small_HASH:
             return DirectorySize::Small;
-          }
-          else if (hashCode == Large_HASH)
-          {
+          case Large_HASH:
             return DirectorySize::Large;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
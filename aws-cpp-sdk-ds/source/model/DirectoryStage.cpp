@@ -29,66 +29,56 @@ namespace Aws
       namespace DirectoryStageMapper
       {
 
-        static const int Requested_HASH = HashingUtils::HashString("Requested");
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Created_HASH = HashingUtils::HashString("Created");
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int Inoperable_HASH = HashingUtils::HashString("Inoperable");
-        static const int Impaired_HASH = HashingUtils::HashString("Impaired");
-        static const int Restoring_HASH = HashingUtils::HashString("Restoring");
-        static const int RestoreFailed_HASH = HashingUtils::HashString("RestoreFailed");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Requested_HASH = -1597065394;
+        static const int Creating_HASH = 1885065945;
+        static const int Created_HASH = -1601759544;
+        static const int Active_HASH = 1955883814;
+        static const int Inoperable_HASH = 1082317037;
+        static const int Impaired_HASH = -370923715;
+        static const int Restoring_HASH = 158507947;
+        static const int RestoreFailed_HASH = -355147701;
+        static const int Deleting_HASH = 884361160;
+        static const int Deleted_HASH = -1079851015;
+        static const int Failed_HASH = 2096857181;
 
 
         DirectoryStage GetDirectoryStageForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Requested_HASH)
+          switch (hashCode)
           {
+          case Requested_HASH:
             return DirectoryStage::Requested;
-          }
-          else if (hashCode == Creating_HASH)
-          {
+          case Creating_HASH:
             return DirectoryStage::Creating;
-          }
-          else if (hashCode == Created_HASH)
-          {
+          case Created_HASH:
             return DirectoryStage::Created;
-          }
-          else if (hashCode == Active_HASH)
-          {
+          case Active_HASH:
             return DirectoryStage::Active;
-          }
-          else if (hashCode == Inoperable_HASH)
-          {
+          case Inoperable_HASH:
             return DirectoryStage::Inoperable;
-          }
-          else if (hashCode == Impaired_HASH)
-          {
+          case Impaired_HASH:
             return DirectoryStage::Impaired;
-          }
-          else if (hashCode == Restoring_HASH)
-          {
+          case Restoring_HASH:
             return DirectoryStage::Restoring;
-          }
-          else if (hashCode == RestoreFailed_HASH)
-          {
+          case RestoreFailed_HASH:
             return DirectoryStage::RestoreFailed;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
+          case Deleting_HASH:
             return DirectoryStage::Deleting;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
+          case Deleted_HASH:
             return DirectoryStage::Deleted;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return DirectoryStage::Failed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace DirectoryTypeMapper
       {
 
-        static const int SimpleAD_HASH = HashingUtils::HashString("SimpleAD");
-        static const int ADConnector_HASH = HashingUtils::HashString("ADConnector");
-        static const int MicrosoftAD_HASH = HashingUtils::HashString("MicrosoftAD");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int SimpleAD_HASH = 550304117;
+        static const int ADConnector_HASH = 109020010;
+        static const int MicrosoftAD_HASH = 1308843377;
 
 
         DirectoryType GetDirectoryTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SimpleAD_HASH)
+          switch (hashCode)
           {
+          case SimpleAD_HASH:
             return DirectoryType::SimpleAD;
-          }
-          else if (hashCode == ADConnector_HASH)
-          {
+          case ADConnector_HASH:
             return DirectoryType::ADConnector;
-          }
-          else if (hashCode == MicrosoftAD_HASH)
-          {
+          case MicrosoftAD_HASH:
             return DirectoryType::MicrosoftAD;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,41 +29,41 @@ namespace Aws
       namespace IpRouteStatusMsgMapper
       {
 
-        static const int Adding_HASH = HashingUtils::HashString("Adding");
-        static const int Added_HASH = HashingUtils::HashString("Added");
-        static const int Removing_HASH = HashingUtils::HashString("Removing");
-        static const int Removed_HASH = HashingUtils::HashString("Removed");
-        static const int AddFailed_HASH = HashingUtils::HashString("AddFailed");
-        static const int RemoveFailed_HASH = HashingUtils::HashString("RemoveFailed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Adding_HASH = 1956330433;
+        static const int Added_HASH = 63107296;
+        static const int Removing_HASH = -448173983;
+        static const int Removed_HASH = -1538478016;
+        static const int AddFailed_HASH = 1614830622;
+        static const int RemoveFailed_HASH = -1079092735;
 
 
         IpRouteStatusMsg GetIpRouteStatusMsgForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Adding_HASH)
+          switch (hashCode)
           {
+          case Adding_HASH:
             return IpRouteStatusMsg::Adding;
-          }
-          else if (hashCode == Added_HASH)
-          {
+          case Added_HASH:
             return IpRouteStatusMsg::Added;
-          }
-          else if (hashCode == Removing_HASH)
-          {
+          case Removing_HASH:
             return IpRouteStatusMsg::Removing;
-          }
-          else if (hashCode == Removed_HASH)
-          {
+          case Removed_HASH:
             return IpRouteStatusMsg::Removed;
-          }
-          else if (hashCode == AddFailed_HASH)
-          {
+          case AddFailed_HASH:
             return IpRouteStatusMsg::AddFailed;
-          }
-          else if (hashCode == RemoveFailed_HASH)
-          {
+          case RemoveFailed_HASH:
             return IpRouteStatusMsg::RemoveFailed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
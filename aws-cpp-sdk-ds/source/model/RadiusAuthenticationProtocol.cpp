@@ -29,31 +29,35 @@ namespace Aws
       namespace RadiusAuthenticationProtocolMapper
       {
 
-        static const int PAP_HASH = HashingUtils::HashString("PAP");
-        static const int CHAP_HASH = HashingUtils::HashString("CHAP");
-        static const int MS_CHAPv1_HASH = HashingUtils::HashString("MS-CHAPv1");
-        static const int MS_CHAPv2_HASH = HashingUtils::HashString("MS-CHAPv2");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PAP_HASH = 78975;
+        static const int CHAP_HASH = 2067284;
+        static const int MS_CHAPv1_HASH = 158953174;
+        static const int MS_CHAPv2_HASH = 158953175;
 
 
         RadiusAuthenticationProtocol GetRadiusAuthenticationProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PAP_HASH)
+          switch (hashCode)
           {
+          case PAP_HASH:
             return RadiusAuthenticationProtocol::PAP;
-          }
-          else if (hashCode == CHAP_HASH)
-          {
+          case CHAP_HASH:
             return RadiusAuthenticationProtocol::CHAP;
-          }
-          else if (hashCode == MS_CHAPv1_HASH)
-          {
+          case MS_CHAPv1_HASH:
             return RadiusAuthenticationProtocol::MS_CHAPv1;
-          }
-          else if (hashCode == MS_CHAPv2_HASH)
-          {
+          case MS_CHAPv2_HASH:
             return RadiusAuthenticationProtocol::MS_CHAPv2;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
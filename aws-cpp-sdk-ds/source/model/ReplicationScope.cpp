@@ -29,16 +29,26 @@ namespace Aws
       namespace ReplicationScopeMapper
       {
 
-        static const int Domain_HASH = HashingUtils::HashString("Domain");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Domain_HASH = 2052636900;
 
 
         ReplicationScope GetReplicationScopeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Domain_HASH)
+          switch (hashCode)
           {
+          case Domain_HASH:
             return ReplicationScope::Domain;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace SnapshotStatusMapper
       {
 
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Creating_HASH = 1885065945;
+        static const int Completed_HASH = 601036331;
+        static const int Failed_HASH = 2096857181;
 
 
         SnapshotStatus GetSnapshotStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Creating_HASH)
+          switch (hashCode)
           {
+          case Creating_HASH:
             return SnapshotStatus::Creating;
-          }
-          else if (hashCode == Completed_HASH)
-          {
+          case Completed_HASH:
             return SnapshotStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return SnapshotStatus::Failed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
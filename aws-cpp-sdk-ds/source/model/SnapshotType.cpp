@@ -29,21 +29,29 @@ namespace Aws
       namespace SnapshotTypeMapper
       {
 
-        static const int Auto_HASH = HashingUtils::HashString("Auto");
-        static const int Manual_HASH = HashingUtils::HashString("Manual");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Auto_HASH = 2052559;
+        static const int Manual_HASH = -1997548570;
 
 
         SnapshotType GetSnapshotTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Auto_HASH)
+          switch (hashCode)
           {
+          case Auto_HASH:
             return SnapshotType::Auto;
-          }
-          else if (hashCode == Manual_HASH)
-          {
+          case Manual_HASH:
             return SnapshotType::Manual;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
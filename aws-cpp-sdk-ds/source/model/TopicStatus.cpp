@@ -29,31 +29,35 @@ namespace Aws
       namespace TopicStatusMapper
       {
 
-        static const int Registered_HASH = HashingUtils::HashString("Registered");
-        static const int Topic_not_found_HASH = HashingUtils::HashString("Topic not found");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Registered_HASH = 123533986;
+        static const int Topic_not_found_HASH = -20847068;
+        static const int Failed_HASH = 2096857181;
+        static const int Deleted_HASH = -1079851015;
 
 
         TopicStatus GetTopicStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Registered_HASH)
+          switch (hashCode)
           {
+          case Registered_HASH:
             return TopicStatus::Registered;
-          }
-          else if (hashCode == Topic_not_found_HASH)
-          {
+          case Topic_not_found_HASH:
             return TopicStatus::Topic_not_found;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return TopicStatus::Failed;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
+          case Deleted_HASH:
             return TopicStatus::Deleted;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
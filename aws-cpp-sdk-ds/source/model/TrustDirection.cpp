@@ -29,26 +29,32 @@ namespace Aws
       namespace TrustDirectionMapper
       {
 
-        static const int One_Way_Outgoing_HASH = HashingUtils::HashString("One-Way: Outgoing");
-        static const int One_Way_Incoming_HASH = HashingUtils::HashString("One-Way: Incoming");
-        static const int Two_Way_HASH = HashingUtils::HashString("Two-Way");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int One_Way_Outgoing_HASH = 978233722;
+        static const int One_Way_Incoming_HASH = 1009348148;
+        static const int Two_Way_HASH = 751705006;
 
 
         TrustDirection GetTrustDirectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == One_Way_Outgoing_HASH)
+          switch (hashCode)
           {
+          case One_Way_Outgoing_HASH:
             return TrustDirection::One_Way_Outgoing;
-          }
-          else if (hashCode == One_Way_Incoming_HASH)
-          {
+          case One_Way_Incoming_HASH:
             return TrustDirection::One_Way_Incoming;
-          }
-          else if (hashCode == Two_Way_HASH)
-          {
+          case Two_Way_HASH:
             return TrustDirection::Two_Way;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,51 +29,47 @@ namespace Aws
       namespace TrustStateMapper
       {
 
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Created_HASH = HashingUtils::HashString("Created");
-        static const int Verifying_HASH = HashingUtils::HashString("Verifying");
-        static const int VerifyFailed_HASH = HashingUtils::HashString("VerifyFailed");
-        static const int Verified_HASH = HashingUtils::HashString("Verified");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Creating_HASH = 1885065945;
+        static const int Created_HASH = -1601759544;
+        static const int Verifying_HASH = 308097193;
+        static const int VerifyFailed_HASH = -835494346;
+        static const int Verified_HASH = -1929739544;
+        static const int Deleting_HASH = 884361160;
+        static const int Deleted_HASH = -1079851015;
+        static const int Failed_HASH = 2096857181;
 
 
         TrustState GetTrustStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Creating_HASH)
+          switch (hashCode)
           {
+          case Creating_HASH:
             return TrustState::Creating;
-          }
-          else if (hashCode == Created_HASH)
-          {
+          case Created_HASH:
             return TrustState::Created;
-          }
-          else if (hashCode == Verifying_HASH)
-          {
+          case Verifying_HASH:
             return TrustState::Verifying;
-          }
-          else if (hashCode == VerifyFailed_HASH)
-          {
+          case VerifyFailed_HASH:
             return TrustState::VerifyFailed;
-          }
-          else if (hashCode == Verified_HASH)
-          {
+          case Verified_HASH:
             return TrustState::Verified;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
+          case Deleting_HASH:
             return TrustState::Deleting;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
+          case Deleted_HASH:
             return TrustState::Deleted;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return TrustState::Failed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
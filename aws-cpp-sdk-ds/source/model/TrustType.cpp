@@ -29,16 +29,26 @@ namespace Aws
       namespace TrustTypeMapper
       {
 
-        static const int Forest_HASH = HashingUtils::HashString("Forest");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Forest_HASH = 2110048317;
 
 
         TrustType GetTrustTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Forest_HASH)
+          switch (hashCode)
           {
+          case Forest_HASH:
             return TrustType::Forest;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
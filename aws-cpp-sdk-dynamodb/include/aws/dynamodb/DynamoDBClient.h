@@ -35,6 +35,9 @@
 #include <aws/dynamodb/model/UpdateItemResult.h>
 #include <aws/dynamodb/model/UpdateTableResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -93,6 +96,7 @@ namespace Model
         class ScanRequest;
         class UpdateItemRequest;
         class UpdateTableRequest;
+        class WriteRequest;
 
         typedef Aws::Utils::Outcome<BatchGetItemResult, Aws::Client::AWSError<DynamoDBErrors>> BatchGetItemOutcome;
         typedef Aws::Utils::Outcome<BatchWriteItemResult, Aws::Client::AWSError<DynamoDBErrors>> BatchWriteItemOutcome;
@@ -406,6 +410,18 @@ namespace Model
          */
         virtual void BatchGetItemAsync(const Model::BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetItemCallable(const Model::BatchGetItemRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BatchGetItemOutcomeCallable BatchGetItemCallable(Model::BatchGetItemRequest&& request) const;
+
+        /**
+         * Same as BatchGetItemAsync(const Model::BatchGetItemRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BatchGetItemAsync(Model::BatchGetItemRequest&& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>BatchWriteItem</i> operation puts or deletes multiple items in one or
          * more tables. A single call to <i>BatchWriteItem</i> can write up to 16 MB of
@@ -584,6 +600,18 @@ namespace Model
          */
         virtual void BatchWriteItemAsync(const Model::BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchWriteItemCallable(const Model::BatchWriteItemRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BatchWriteItemOutcomeCallable BatchWriteItemCallable(Model::BatchWriteItemRequest&& request) const;
+
+        /**
+         * Same as BatchWriteItemAsync(const Model::BatchWriteItemRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BatchWriteItemAsync(Model::BatchWriteItemRequest&& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CreateTable</i> operation adds a new table to your account. In an AWS
          * account, table names must be unique within each region. That is, you can have
@@ -642,6 +670,18 @@ namespace Model
          */
         virtual void CreateTableAsync(const Model::CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTableCallable(const Model::CreateTableRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateTableOutcomeCallable CreateTableCallable(Model::CreateTableRequest&& request) const;
+
+        /**
+         * Same as CreateTableAsync(const Model::CreateTableRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateTableAsync(Model::CreateTableRequest&& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a single item in a table by primary key. You can perform a
          * conditional delete operation that deletes the item if it exists, or if it has an
@@ -688,6 +728,18 @@ namespace Model
          */
         virtual void DeleteItemAsync(const Model::DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteItemCallable(const Model::DeleteItemRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteItemOutcomeCallable DeleteItemCallable(Model::DeleteItemRequest&& request) const;
+
+        /**
+         * Same as DeleteItemAsync(const Model::DeleteItemRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteItemAsync(Model::DeleteItemRequest&& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DeleteTable</i> operation deletes a table and all of its items. After
          * a <i>DeleteTable</i> request, the specified table is in the
@@ -752,6 +804,18 @@ namespace Model
          */
         virtual void DeleteTableAsync(const Model::DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTableCallable(const Model::DeleteTableRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTableOutcomeCallable DeleteTableCallable(Model::DeleteTableRequest&& request) const;
+
+        /**
+         * Same as DeleteTableAsync(const Model::DeleteTableRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTableAsync(Model::DeleteTableRequest&& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the current provisioned-capacity limits for your AWS account in a
          * region, both for the region as a whole and for any one DynamoDB table that you
@@ -888,6 +952,18 @@ namespace Model
          */
         virtual void DescribeLimitsAsync(const Model::DescribeLimitsRequest& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLimitsCallable(const Model::DescribeLimitsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLimitsOutcomeCallable DescribeLimitsCallable(Model::DescribeLimitsRequest&& request) const;
+
+        /**
+         * Same as DescribeLimitsAsync(const Model::DescribeLimitsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLimitsAsync(Model::DescribeLimitsRequest&& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the table, including the current status of the
          * table, when it was created, the primary key schema, and any indexes on the
@@ -928,6 +1004,18 @@ namespace Model
          */
         virtual void DescribeTableAsync(const Model::DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTableCallable(const Model::DescribeTableRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTableOutcomeCallable DescribeTableCallable(Model::DescribeTableRequest&& request) const;
+
+        /**
+         * Same as DescribeTableAsync(const Model::DescribeTableRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTableAsync(Model::DescribeTableRequest&& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>GetItem</i> operation returns a set of attributes for the item with
          * the given primary key. If there is no matching item, <i>GetItem</i> does not
@@ -965,6 +1053,18 @@ namespace Model
          */
         virtual void GetItemAsync(const Model::GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetItemCallable(const Model::GetItemRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetItemOutcomeCallable GetItemCallable(Model::GetItemRequest&& request) const;
+
+        /**
+         * Same as GetItemAsync(const Model::GetItemRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetItemAsync(Model::GetItemRequest&& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of table names associated with the current account and
          * endpoint. The output from <i>ListTables</i> is paginated, with each page
@@ -990,6 +1090,18 @@ namespace Model
          */
         virtual void ListTablesAsync(const Model::ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTablesCallable(const Model::ListTablesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTablesOutcomeCallable ListTablesCallable(Model::ListTablesRequest&& request) const;
+
+        /**
+         * Same as ListTablesAsync(const Model::ListTablesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTablesAsync(Model::ListTablesRequest&& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new item, or replaces an old item with a new item. If an item that
          * has the same primary key as the new item already exists in the specified table,
@@ -1075,6 +1187,18 @@ namespace Model
          */
         virtual void PutItemAsync(const Model::PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutItemCallable(const Model::PutItemRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutItemOutcomeCallable PutItemCallable(Model::PutItemRequest&& request) const;
+
+        /**
+         * Same as PutItemAsync(const Model::PutItemRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutItemAsync(Model::PutItemRequest&& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>A <i>Query</i> operation uses the primary key of a table or a secondary index
          * to directly access items from that table or index.</p> <p>Use the
@@ -1157,6 +1281,18 @@ namespace Model
          */
         virtual void QueryAsync(const Model::QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as QueryCallable(const Model::QueryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::QueryOutcomeCallable QueryCallable(Model::QueryRequest&& request) const;
+
+        /**
+         * Same as QueryAsync(const Model::QueryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void QueryAsync(Model::QueryRequest&& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>Scan</i> operation returns one or more items and item attributes by
          * accessing every item in a table or a secondary index. To have DynamoDB return
@@ -1230,6 +1366,18 @@ namespace Model
          */
         virtual void ScanAsync(const Model::ScanRequest& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ScanCallable(const Model::ScanRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ScanOutcomeCallable ScanCallable(Model::ScanRequest&& request) const;
+
+        /**
+         * Same as ScanAsync(const Model::ScanRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ScanAsync(Model::ScanRequest&& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Edits an existing item's attributes, or adds a new item to the table if it
          * does not already exist. You can put, delete, or add attribute values. You can
@@ -1267,6 +1415,18 @@ namespace Model
          */
         virtual void UpdateItemAsync(const Model::UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateItemCallable(const Model::UpdateItemRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateItemOutcomeCallable UpdateItemCallable(Model::UpdateItemRequest&& request) const;
+
+        /**
+         * Same as UpdateItemAsync(const Model::UpdateItemRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateItemAsync(Model::UpdateItemRequest&& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the provisioned throughput settings, global secondary indexes, or
          * DynamoDB Streams settings for a given table.</p> <p>You can only perform one of
@@ -1319,6 +1479,140 @@ namespace Model
          */
         virtual void UpdateTableAsync(const Model::UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateTableCallable(const Model::UpdateTableRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateTableOutcomeCallable UpdateTableCallable(Model::UpdateTableRequest&& request) const;
+
+        /**
+         * Same as UpdateTableAsync(const Model::UpdateTableRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateTableAsync(Model::UpdateTableRequest&& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListTables(), following LastEvaluatedTableName; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DynamoDBClient, Model::ListTablesRequest, Model::ListTablesOutcome> ListTablesPaginator(const Model::ListTablesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through Query(), following LastEvaluatedKey; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DynamoDBClient, Model::QueryRequest, Model::QueryOutcome> QueryPaginator(const Model::QueryRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through Scan(), following LastEvaluatedKey; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<DynamoDBClient, Model::ScanRequest, Model::ScanOutcome> ScanPaginator(const Model::ScanRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Collects WriteRequest entries and sends them with BatchWriteItem() in calls of at most 25 entries and 16777216 bytes, re-queueing the entries the service could not process. The client must outlive the accumulator.
+         */
+        std::shared_ptr<Aws::Client::BatchAccumulator<Model::BatchWriteItemRequest, Model::WriteRequest>> BatchWriteItemAccumulator(const Model::BatchWriteItemRequest& requestTemplate, const Aws::String& tableName, const Aws::Client::BatchAccumulatorConfiguration& config = Aws::Client::BatchAccumulatorConfiguration()) const;
+
+        /**
+         * Freezes the endpoint, headers and every member of requestTemplate except Key, for repeated calls to DeleteItemPrepared() that differ only in their Key. The result may be shared between threads.
+         */
+        Aws::Client::PreparedRequest PrepareDeleteItem(const Model::DeleteItemRequest& requestTemplate) const;
+
+        /**
+         * Same as DeleteItem(const Model::DeleteItemRequest&) for the template given to PrepareDeleteItem() with Key set to key; only key is serialized on each call.
+         */
+        Model::DeleteItemOutcome DeleteItemPrepared(const Aws::Client::PreparedRequest& preparedRequest, const Aws::Map<Aws::String, Model::AttributeValue>& key) const;
+
+        /**
+         * Freezes the endpoint, headers and every member of requestTemplate except Key, for repeated calls to GetItemPrepared() that differ only in their Key. The result may be shared between threads.
+         */
+        Aws::Client::PreparedRequest PrepareGetItem(const Model::GetItemRequest& requestTemplate) const;
+
+        /**
+         * Same as GetItem(const Model::GetItemRequest&) for the template given to PrepareGetItem() with Key set to key; only key is serialized on each call.
+         */
+        Model::GetItemOutcome GetItemPrepared(const Aws::Client::PreparedRequest& preparedRequest, const Aws::Map<Aws::String, Model::AttributeValue>& key) const;
+
+        /**
+         * Freezes the endpoint, headers and every member of requestTemplate except Item, for repeated calls to PutItemPrepared() that differ only in their Item. The result may be shared between threads.
+         */
+        Aws::Client::PreparedRequest PreparePutItem(const Model::PutItemRequest& requestTemplate) const;
+
+        /**
+         * Same as PutItem(const Model::PutItemRequest&) for the template given to PreparePutItem() with Item set to item; only item is serialized on each call.
+         */
+        Model::PutItemOutcome PutItemPrepared(const Aws::Client::PreparedRequest& preparedRequest, const Aws::Map<Aws::String, Model::AttributeValue>& item) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of BatchGetItem(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DynamoDBClient, Model::BatchGetItemRequest, Model::BatchGetItemOutcome> BatchGetItemAwaitable(Model::BatchGetItemRequest request) const;
+
+        /**
+         * co_await-able form of BatchWriteItem(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DynamoDBClient, Model::BatchWriteItemRequest, Model::BatchWriteItemOutcome> BatchWriteItemAwaitable(Model::BatchWriteItemRequest request) const;
+
+        /**
+         * co_await-able form of CreateTable(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DynamoDBClient, Model::CreateTableRequest, Model::CreateTableOutcome> CreateTableAwaitable(Model::CreateTableRequest request) const;
+
+        /**
+         * co_await-able form of DeleteItem(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DynamoDBClient, Model::DeleteItemRequest, Model::DeleteItemOutcome> DeleteItemAwaitable(Model::DeleteItemRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTable(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DynamoDBClient, Model::DeleteTableRequest, Model::DeleteTableOutcome> DeleteTableAwaitable(Model::DeleteTableRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLimits(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DynamoDBClient, Model::DescribeLimitsRequest, Model::DescribeLimitsOutcome> DescribeLimitsAwaitable(Model::DescribeLimitsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTable(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DynamoDBClient, Model::DescribeTableRequest, Model::DescribeTableOutcome> DescribeTableAwaitable(Model::DescribeTableRequest request) const;
+
+        /**
+         * co_await-able form of GetItem(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DynamoDBClient, Model::GetItemRequest, Model::GetItemOutcome> GetItemAwaitable(Model::GetItemRequest request) const;
+
+        /**
+         * co_await-able form of ListTables(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DynamoDBClient, Model::ListTablesRequest, Model::ListTablesOutcome> ListTablesAwaitable(Model::ListTablesRequest request) const;
+
+        /**
+         * co_await-able form of PutItem(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DynamoDBClient, Model::PutItemRequest, Model::PutItemOutcome> PutItemAwaitable(Model::PutItemRequest request) const;
+
+        /**
+         * co_await-able form of Query(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DynamoDBClient, Model::QueryRequest, Model::QueryOutcome> QueryAwaitable(Model::QueryRequest request) const;
+
+        /**
+         * co_await-able form of Scan(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DynamoDBClient, Model::ScanRequest, Model::ScanOutcome> ScanAwaitable(Model::ScanRequest request) const;
+
+        /**
+         * co_await-able form of UpdateItem(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DynamoDBClient, Model::UpdateItemRequest, Model::UpdateItemOutcome> UpdateItemAwaitable(Model::UpdateItemRequest request) const;
+
+        /**
+         * co_await-able form of UpdateTable(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<DynamoDBClient, Model::UpdateTableRequest, Model::UpdateTableOutcome> UpdateTableAwaitable(Model::UpdateTableRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     BatchGetItemRequest();
+    inline const char* GetServiceRequestName() const override { return "BatchGetItem"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     BatchWriteItemRequest();
+    inline const char* GetServiceRequestName() const override { return "BatchWriteItem"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -38,6 +38,8 @@ namespace Model
   {
   public:
     CreateTableRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateTable"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
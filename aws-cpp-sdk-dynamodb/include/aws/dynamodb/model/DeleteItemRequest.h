@@ -38,6 +38,8 @@ namespace Model
   {
   public:
     DeleteItemRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteItem"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteTableRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteTable"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeLimitsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLimits"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeTableRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTable"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
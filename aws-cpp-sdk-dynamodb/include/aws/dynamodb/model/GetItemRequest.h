@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     GetItemRequest();
+    inline const char* GetServiceRequestName() const override { return "GetItem"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListTablesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTables"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
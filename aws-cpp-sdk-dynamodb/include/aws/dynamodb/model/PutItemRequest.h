@@ -38,6 +38,8 @@ namespace Model
   {
   public:
     PutItemRequest();
+    inline const char* GetServiceRequestName() const override { return "PutItem"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
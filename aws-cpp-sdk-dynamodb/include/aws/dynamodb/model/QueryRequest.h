@@ -38,6 +38,8 @@ namespace Model
   {
   public:
     QueryRequest();
+    inline const char* GetServiceRequestName() const override { return "Query"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
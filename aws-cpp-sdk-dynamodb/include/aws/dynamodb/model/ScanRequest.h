@@ -38,6 +38,8 @@ namespace Model
   {
   public:
     ScanRequest();
+    inline const char* GetServiceRequestName() const override { return "Scan"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -39,6 +39,8 @@ namespace Model
   {
   public:
     UpdateItemRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateItem"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     UpdateTableRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateTable"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
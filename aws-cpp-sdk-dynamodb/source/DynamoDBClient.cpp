@@ -123,7 +123,7 @@ BatchGetItemOutcome DynamoDBClient::BatchGetItem(const BatchGetItemRequest& requ
 
 BatchGetItemOutcomeCallable DynamoDBClient::BatchGetItemCallable(const BatchGetItemRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BatchGetItem(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BatchGetItem(request); } );
 }
 
 void DynamoDBClient::BatchGetItemAsync(const BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -131,6 +131,16 @@ void DynamoDBClient::BatchGetItemAsync(const BatchGetItemRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->BatchGetItemAsyncHelper( request, handler, context ); } );
 }
 
+BatchGetItemOutcomeCallable DynamoDBClient::BatchGetItemCallable(BatchGetItemRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DynamoDBClient::BatchGetItem, this, std::move(request)));
+}
+
+void DynamoDBClient::BatchGetItemAsync(BatchGetItemRequest&& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DynamoDBClient::BatchGetItemAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DynamoDBClient::BatchGetItemAsyncHelper(const BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BatchGetItem(request), context);
@@ -154,7 +164,7 @@ BatchWriteItemOutcome DynamoDBClient::BatchWriteItem(const BatchWriteItemRequest
 
 BatchWriteItemOutcomeCallable DynamoDBClient::BatchWriteItemCallable(const BatchWriteItemRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BatchWriteItem(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BatchWriteItem(request); } );
 }
 
 void DynamoDBClient::BatchWriteItemAsync(const BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -162,6 +172,16 @@ void DynamoDBClient::BatchWriteItemAsync(const BatchWriteItemRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->BatchWriteItemAsyncHelper( request, handler, context ); } );
 }
 
+BatchWriteItemOutcomeCallable DynamoDBClient::BatchWriteItemCallable(BatchWriteItemRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DynamoDBClient::BatchWriteItem, this, std::move(request)));
+}
+
+void DynamoDBClient::BatchWriteItemAsync(BatchWriteItemRequest&& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DynamoDBClient::BatchWriteItemAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DynamoDBClient::BatchWriteItemAsyncHelper(const BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BatchWriteItem(request), context);
@@ -185,7 +205,7 @@ CreateTableOutcome DynamoDBClient::CreateTable(const CreateTableRequest& request
 
 CreateTableOutcomeCallable DynamoDBClient::CreateTableCallable(const CreateTableRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateTable(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateTable(request); } );
 }
 
 void DynamoDBClient::CreateTableAsync(const CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -193,6 +213,16 @@ void DynamoDBClient::CreateTableAsync(const CreateTableRequest& request, const C
   m_executor->Submit( [this, request, handler, context](){ this->CreateTableAsyncHelper( request, handler, context ); } );
 }
 
+CreateTableOutcomeCallable DynamoDBClient::CreateTableCallable(CreateTableRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DynamoDBClient::CreateTable, this, std::move(request)));
+}
+
+void DynamoDBClient::CreateTableAsync(CreateTableRequest&& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DynamoDBClient::CreateTableAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DynamoDBClient::CreateTableAsyncHelper(const CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateTable(request), context);
@@ -216,7 +246,7 @@ DeleteItemOutcome DynamoDBClient::DeleteItem(const DeleteItemRequest& request) c
 
 DeleteItemOutcomeCallable DynamoDBClient::DeleteItemCallable(const DeleteItemRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteItem(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteItem(request); } );
 }
 
 void DynamoDBClient::DeleteItemAsync(const DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -224,6 +254,16 @@ void DynamoDBClient::DeleteItemAsync(const DeleteItemRequest& request, const Del
   m_executor->Submit( [this, request, handler, context](){ this->DeleteItemAsyncHelper( request, handler, context ); } );
 }
 
+DeleteItemOutcomeCallable DynamoDBClient::DeleteItemCallable(DeleteItemRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DynamoDBClient::DeleteItem, this, std::move(request)));
+}
+
+void DynamoDBClient::DeleteItemAsync(DeleteItemRequest&& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DynamoDBClient::DeleteItemAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DynamoDBClient::DeleteItemAsyncHelper(const DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteItem(request), context);
@@ -247,7 +287,7 @@ DeleteTableOutcome DynamoDBClient::DeleteTable(const DeleteTableRequest& request
 
 DeleteTableOutcomeCallable DynamoDBClient::DeleteTableCallable(const DeleteTableRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTable(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTable(request); } );
 }
 
 void DynamoDBClient::DeleteTableAsync(const DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -255,6 +295,16 @@ void DynamoDBClient::DeleteTableAsync(const DeleteTableRequest& request, const D
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTableAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTableOutcomeCallable DynamoDBClient::DeleteTableCallable(DeleteTableRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DynamoDBClient::DeleteTable, this, std::move(request)));
+}
+
+void DynamoDBClient::DeleteTableAsync(DeleteTableRequest&& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DynamoDBClient::DeleteTableAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DynamoDBClient::DeleteTableAsyncHelper(const DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTable(request), context);
@@ -278,7 +328,7 @@ DescribeLimitsOutcome DynamoDBClient::DescribeLimits(const DescribeLimitsRequest
 
 DescribeLimitsOutcomeCallable DynamoDBClient::DescribeLimitsCallable(const DescribeLimitsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLimits(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLimits(request); } );
 }
 
 void DynamoDBClient::DescribeLimitsAsync(const DescribeLimitsRequest& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -286,6 +336,16 @@ void DynamoDBClient::DescribeLimitsAsync(const DescribeLimitsRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLimitsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLimitsOutcomeCallable DynamoDBClient::DescribeLimitsCallable(DescribeLimitsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DynamoDBClient::DescribeLimits, this, std::move(request)));
+}
+
+void DynamoDBClient::DescribeLimitsAsync(DescribeLimitsRequest&& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DynamoDBClient::DescribeLimitsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DynamoDBClient::DescribeLimitsAsyncHelper(const DescribeLimitsRequest& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLimits(request), context);
@@ -309,7 +369,7 @@ DescribeTableOutcome DynamoDBClient::DescribeTable(const DescribeTableRequest& r
 
 DescribeTableOutcomeCallable DynamoDBClient::DescribeTableCallable(const DescribeTableRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTable(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTable(request); } );
 }
 
 void DynamoDBClient::DescribeTableAsync(const DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -317,6 +377,16 @@ void DynamoDBClient::DescribeTableAsync(const DescribeTableRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTableAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTableOutcomeCallable DynamoDBClient::DescribeTableCallable(DescribeTableRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DynamoDBClient::DescribeTable, this, std::move(request)));
+}
+
+void DynamoDBClient::DescribeTableAsync(DescribeTableRequest&& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DynamoDBClient::DescribeTableAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DynamoDBClient::DescribeTableAsyncHelper(const DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTable(request), context);
@@ -340,7 +410,7 @@ GetItemOutcome DynamoDBClient::GetItem(const GetItemRequest& request) const
 
 GetItemOutcomeCallable DynamoDBClient::GetItemCallable(const GetItemRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetItem(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetItem(request); } );
 }
 
 void DynamoDBClient::GetItemAsync(const GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -348,6 +418,16 @@ void DynamoDBClient::GetItemAsync(const GetItemRequest& request, const GetItemRe
   m_executor->Submit( [this, request, handler, context](){ this->GetItemAsyncHelper( request, handler, context ); } );
 }
 
+GetItemOutcomeCallable DynamoDBClient::GetItemCallable(GetItemRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DynamoDBClient::GetItem, this, std::move(request)));
+}
+
+void DynamoDBClient::GetItemAsync(GetItemRequest&& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DynamoDBClient::GetItemAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DynamoDBClient::GetItemAsyncHelper(const GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetItem(request), context);
@@ -371,7 +451,7 @@ ListTablesOutcome DynamoDBClient::ListTables(const ListTablesRequest& request) c
 
 ListTablesOutcomeCallable DynamoDBClient::ListTablesCallable(const ListTablesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTables(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTables(request); } );
 }
 
 void DynamoDBClient::ListTablesAsync(const ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -379,6 +459,16 @@ void DynamoDBClient::ListTablesAsync(const ListTablesRequest& request, const Lis
   m_executor->Submit( [this, request, handler, context](){ this->ListTablesAsyncHelper( request, handler, context ); } );
 }
 
+ListTablesOutcomeCallable DynamoDBClient::ListTablesCallable(ListTablesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DynamoDBClient::ListTables, this, std::move(request)));
+}
+
+void DynamoDBClient::ListTablesAsync(ListTablesRequest&& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DynamoDBClient::ListTablesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DynamoDBClient::ListTablesAsyncHelper(const ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTables(request), context);
@@ -402,7 +492,7 @@ PutItemOutcome DynamoDBClient::PutItem(const PutItemRequest& request) const
 
 PutItemOutcomeCallable DynamoDBClient::PutItemCallable(const PutItemRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutItem(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutItem(request); } );
 }
 
 void DynamoDBClient::PutItemAsync(const PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -410,6 +500,16 @@ void DynamoDBClient::PutItemAsync(const PutItemRequest& request, const PutItemRe
   m_executor->Submit( [this, request, handler, context](){ this->PutItemAsyncHelper( request, handler, context ); } );
 }
 
+PutItemOutcomeCallable DynamoDBClient::PutItemCallable(PutItemRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DynamoDBClient::PutItem, this, std::move(request)));
+}
+
+void DynamoDBClient::PutItemAsync(PutItemRequest&& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DynamoDBClient::PutItemAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DynamoDBClient::PutItemAsyncHelper(const PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutItem(request), context);
@@ -433,7 +533,7 @@ QueryOutcome DynamoDBClient::Query(const QueryRequest& request) const
 
 QueryOutcomeCallable DynamoDBClient::QueryCallable(const QueryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->Query(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->Query(request); } );
 }
 
 void DynamoDBClient::QueryAsync(const QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -441,6 +541,16 @@ void DynamoDBClient::QueryAsync(const QueryRequest& request, const QueryResponse
   m_executor->Submit( [this, request, handler, context](){ this->QueryAsyncHelper( request, handler, context ); } );
 }
 
+QueryOutcomeCallable DynamoDBClient::QueryCallable(QueryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DynamoDBClient::Query, this, std::move(request)));
+}
+
+void DynamoDBClient::QueryAsync(QueryRequest&& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DynamoDBClient::QueryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DynamoDBClient::QueryAsyncHelper(const QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, Query(request), context);
@@ -464,7 +574,7 @@ ScanOutcome DynamoDBClient::Scan(const ScanRequest& request) const
 
 ScanOutcomeCallable DynamoDBClient::ScanCallable(const ScanRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->Scan(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->Scan(request); } );
 }
 
 void DynamoDBClient::ScanAsync(const ScanRequest& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -472,6 +582,16 @@ void DynamoDBClient::ScanAsync(const ScanRequest& request, const ScanResponseRec
   m_executor->Submit( [this, request, handler, context](){ this->ScanAsyncHelper( request, handler, context ); } );
 }
 
+ScanOutcomeCallable DynamoDBClient::ScanCallable(ScanRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DynamoDBClient::Scan, this, std::move(request)));
+}
+
+void DynamoDBClient::ScanAsync(ScanRequest&& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DynamoDBClient::ScanAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DynamoDBClient::ScanAsyncHelper(const ScanRequest& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, Scan(request), context);
@@ -495,7 +615,7 @@ UpdateItemOutcome DynamoDBClient::UpdateItem(const UpdateItemRequest& request) c
 
 UpdateItemOutcomeCallable DynamoDBClient::UpdateItemCallable(const UpdateItemRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateItem(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateItem(request); } );
 }
 
 void DynamoDBClient::UpdateItemAsync(const UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -503,6 +623,16 @@ void DynamoDBClient::UpdateItemAsync(const UpdateItemRequest& request, const Upd
   m_executor->Submit( [this, request, handler, context](){ this->UpdateItemAsyncHelper( request, handler, context ); } );
 }
 
+UpdateItemOutcomeCallable DynamoDBClient::UpdateItemCallable(UpdateItemRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DynamoDBClient::UpdateItem, this, std::move(request)));
+}
+
+void DynamoDBClient::UpdateItemAsync(UpdateItemRequest&& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DynamoDBClient::UpdateItemAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DynamoDBClient::UpdateItemAsyncHelper(const UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateItem(request), context);
@@ -526,7 +656,7 @@ UpdateTableOutcome DynamoDBClient::UpdateTable(const UpdateTableRequest& request
 
 UpdateTableOutcomeCallable DynamoDBClient::UpdateTableCallable(const UpdateTableRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateTable(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateTable(request); } );
 }
 
 void DynamoDBClient::UpdateTableAsync(const UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -534,8 +664,266 @@ void DynamoDBClient::UpdateTableAsync(const UpdateTableRequest& request, const U
   m_executor->Submit( [this, request, handler, context](){ this->UpdateTableAsyncHelper( request, handler, context ); } );
 }
 
+UpdateTableOutcomeCallable DynamoDBClient::UpdateTableCallable(UpdateTableRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&DynamoDBClient::UpdateTable, this, std::move(request)));
+}
+
+void DynamoDBClient::UpdateTableAsync(UpdateTableRequest&& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&DynamoDBClient::UpdateTableAsyncHelper, this, std::move(request), handler, context);
+}
+
 void DynamoDBClient::UpdateTableAsyncHelper(const UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateTable(request), context);
 }
 
+Paginator<DynamoDBClient, ListTablesRequest, ListTablesOutcome> DynamoDBClient::ListTablesPaginator(const ListTablesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DynamoDBClient, ListTablesRequest, ListTablesOutcome>(this, &DynamoDBClient::ListTables, request,
+    [](const ListTablesRequest& current, const ListTablesOutcome& outcome, ListTablesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetLastEvaluatedTableName();
+      if(token.empty() || token == current.GetExclusiveStartTableName())
+      {
+        return false;
+      }
+      next = current;
+      next.SetExclusiveStartTableName(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DynamoDBClient, QueryRequest, QueryOutcome> DynamoDBClient::QueryPaginator(const QueryRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DynamoDBClient, QueryRequest, QueryOutcome>(this, &DynamoDBClient::Query, request,
+    [](const QueryRequest& current, const QueryOutcome& outcome, QueryRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetLastEvaluatedKey();
+      if(token.empty())
+      {
+        return false;
+      }
+      next = current;
+      next.SetExclusiveStartKey(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<DynamoDBClient, ScanRequest, ScanOutcome> DynamoDBClient::ScanPaginator(const ScanRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<DynamoDBClient, ScanRequest, ScanOutcome>(this, &DynamoDBClient::Scan, request,
+    [](const ScanRequest& current, const ScanOutcome& outcome, ScanRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetLastEvaluatedKey();
+      if(token.empty())
+      {
+        return false;
+      }
+      next = current;
+      next.SetExclusiveStartKey(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+std::shared_ptr<BatchAccumulator<BatchWriteItemRequest, WriteRequest>> DynamoDBClient::BatchWriteItemAccumulator(const BatchWriteItemRequest& requestTemplate, const Aws::String& tableName, const BatchAccumulatorConfiguration& config) const
+{
+  return Aws::MakeShared<BatchAccumulator<BatchWriteItemRequest, WriteRequest>>(ALLOCATION_TAG, requestTemplate, 25, 16777216, config,
+    [](const WriteRequest& entry) { return entry.Jsonize().WriteCompact().size(); },
+    [this, tableName](const BatchWriteItemRequest& requestTemplate, Aws::Vector<WriteRequest>&& batch, Aws::Vector<BatchEntryFailure<WriteRequest>>& failures)
+    {
+      BatchWriteItemRequest request(requestTemplate);
+      request.AddRequestItems(tableName, batch);
+      auto outcome = BatchWriteItem(request);
+      if(!outcome.IsSuccess())
+      {
+        for(size_t i = 0; i < batch.size(); ++i)
+        {
+          failures.emplace_back(i, std::move(batch[i]), outcome.GetError().GetMessage(), outcome.GetError().ShouldRetry());
+        }
+        return;
+      }
+      const auto& unprocessed = outcome.GetResult().GetUnprocessedItems();
+      auto tableEntries = unprocessed.find(tableName);
+      if(tableEntries != unprocessed.end() && !tableEntries->second.empty())
+      {
+        // unprocessed entries come back as copies, so they are matched to their batch positions by their serialized form
+        Aws::Vector<Aws::String> sent;
+        sent.reserve(batch.size());
+        for(const auto& entry : batch)
+        {
+          sent.push_back(entry.Jsonize().WriteCompact());
+        }
+        for(const auto& entry : tableEntries->second)
+        {
+          auto position = std::find(sent.begin(), sent.end(), entry.Jsonize().WriteCompact());
+          if(position == sent.end())
+          {
+            failures.emplace_back(batch.size(), WriteRequest(entry), "Not processed by the service", true);
+            continue;
+          }
+          size_t index = static_cast<size_t>(position - sent.begin());
+          position->clear();
+          failures.emplace_back(index, std::move(batch[index]), "Not processed by the service", true);
+        }
+      }
+    }, GetRetryStrategy());
+}
+
+PreparedRequest DynamoDBClient::PrepareDeleteItem(const DeleteItemRequest& requestTemplate) const
+{
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+
+  return PrepareJsonRequest(ss.str(), Aws::MakeShared<DeleteItemRequest>(ALLOCATION_TAG, requestTemplate), "Key", HttpMethod::HTTP_POST);
+}
+
+DeleteItemOutcome DynamoDBClient::DeleteItemPrepared(const PreparedRequest& preparedRequest, const Aws::Map<Aws::String, Model::AttributeValue>& key) const
+{
+  JsonValue keyJsonMap;
+  for(auto& keyItem : key)
+  {
+    keyJsonMap.WithObject(keyItem.first, keyItem.second.Jsonize());
+  }
+
+  JsonOutcome outcome = MakeRequest(preparedRequest, keyJsonMap);
+  if(outcome.IsSuccess())
+  {
+    return DeleteItemOutcome(DeleteItemResult(outcome.GetResult()));
+  }
+  else
+  {
+    return DeleteItemOutcome(outcome.GetError());
+  }
+}
+
+PreparedRequest DynamoDBClient::PrepareGetItem(const GetItemRequest& requestTemplate) const
+{
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+
+  return PrepareJsonRequest(ss.str(), Aws::MakeShared<GetItemRequest>(ALLOCATION_TAG, requestTemplate), "Key", HttpMethod::HTTP_POST);
+}
+
+GetItemOutcome DynamoDBClient::GetItemPrepared(const PreparedRequest& preparedRequest, const Aws::Map<Aws::String, Model::AttributeValue>& key) const
+{
+  JsonValue keyJsonMap;
+  for(auto& keyItem : key)
+  {
+    keyJsonMap.WithObject(keyItem.first, keyItem.second.Jsonize());
+  }
+
+  JsonOutcome outcome = MakeRequest(preparedRequest, keyJsonMap);
+  if(outcome.IsSuccess())
+  {
+    return GetItemOutcome(GetItemResult(outcome.GetResult()));
+  }
+  else
+  {
+    return GetItemOutcome(outcome.GetError());
+  }
+}
+
+PreparedRequest DynamoDBClient::PreparePutItem(const PutItemRequest& requestTemplate) const
+{
+  Aws::StringStream ss;
+  ss << m_uri << "/";
+
+  return PrepareJsonRequest(ss.str(), Aws::MakeShared<PutItemRequest>(ALLOCATION_TAG, requestTemplate), "Item", HttpMethod::HTTP_POST);
+}
+
+PutItemOutcome DynamoDBClient::PutItemPrepared(const PreparedRequest& preparedRequest, const Aws::Map<Aws::String, Model::AttributeValue>& item) const
+{
+  JsonValue itemJsonMap;
+  for(auto& itemItem : item)
+  {
+    itemJsonMap.WithObject(itemItem.first, itemItem.second.Jsonize());
+  }
+
+  JsonOutcome outcome = MakeRequest(preparedRequest, itemJsonMap);
+  if(outcome.IsSuccess())
+  {
+    return PutItemOutcome(PutItemResult(outcome.GetResult()));
+  }
+  else
+  {
+    return PutItemOutcome(outcome.GetError());
+  }
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<DynamoDBClient, BatchGetItemRequest, BatchGetItemOutcome> DynamoDBClient::BatchGetItemAwaitable(BatchGetItemRequest request) const
+{
+  return { m_executor.get(), { this, &DynamoDBClient::BatchGetItem, std::move(request) } };
+}
+
+ClientOperationAwaitable<DynamoDBClient, BatchWriteItemRequest, BatchWriteItemOutcome> DynamoDBClient::BatchWriteItemAwaitable(BatchWriteItemRequest request) const
+{
+  return { m_executor.get(), { this, &DynamoDBClient::BatchWriteItem, std::move(request) } };
+}
+
+ClientOperationAwaitable<DynamoDBClient, CreateTableRequest, CreateTableOutcome> DynamoDBClient::CreateTableAwaitable(CreateTableRequest request) const
+{
+  return { m_executor.get(), { this, &DynamoDBClient::CreateTable, std::move(request) } };
+}
+
+ClientOperationAwaitable<DynamoDBClient, DeleteItemRequest, DeleteItemOutcome> DynamoDBClient::DeleteItemAwaitable(DeleteItemRequest request) const
+{
+  return { m_executor.get(), { this, &DynamoDBClient::DeleteItem, std::move(request) } };
+}
+
+ClientOperationAwaitable<DynamoDBClient, DeleteTableRequest, DeleteTableOutcome> DynamoDBClient::DeleteTableAwaitable(DeleteTableRequest request) const
+{
+  return { m_executor.get(), { this, &DynamoDBClient::DeleteTable, std::move(request) } };
+}
+
+ClientOperationAwaitable<DynamoDBClient, DescribeLimitsRequest, DescribeLimitsOutcome> DynamoDBClient::DescribeLimitsAwaitable(DescribeLimitsRequest request) const
+{
+  return { m_executor.get(), { this, &DynamoDBClient::DescribeLimits, std::move(request) } };
+}
+
+ClientOperationAwaitable<DynamoDBClient, DescribeTableRequest, DescribeTableOutcome> DynamoDBClient::DescribeTableAwaitable(DescribeTableRequest request) const
+{
+  return { m_executor.get(), { this, &DynamoDBClient::DescribeTable, std::move(request) } };
+}
+
+ClientOperationAwaitable<DynamoDBClient, GetItemRequest, GetItemOutcome> DynamoDBClient::GetItemAwaitable(GetItemRequest request) const
+{
+  return { m_executor.get(), { this, &DynamoDBClient::GetItem, std::move(request) } };
+}
+
+ClientOperationAwaitable<DynamoDBClient, ListTablesRequest, ListTablesOutcome> DynamoDBClient::ListTablesAwaitable(ListTablesRequest request) const
+{
+  return { m_executor.get(), { this, &DynamoDBClient::ListTables, std::move(request) } };
+}
+
+ClientOperationAwaitable<DynamoDBClient, PutItemRequest, PutItemOutcome> DynamoDBClient::PutItemAwaitable(PutItemRequest request) const
+{
+  return { m_executor.get(), { this, &DynamoDBClient::PutItem, std::move(request) } };
+}
+
+ClientOperationAwaitable<DynamoDBClient, QueryRequest, QueryOutcome> DynamoDBClient::QueryAwaitable(QueryRequest request) const
+{
+  return { m_executor.get(), { this, &DynamoDBClient::Query, std::move(request) } };
+}
+
+ClientOperationAwaitable<DynamoDBClient, ScanRequest, ScanOutcome> DynamoDBClient::ScanAwaitable(ScanRequest request) const
+{
+  return { m_executor.get(), { this, &DynamoDBClient::Scan, std::move(request) } };
+}
+
+ClientOperationAwaitable<DynamoDBClient, UpdateItemRequest, UpdateItemOutcome> DynamoDBClient::UpdateItemAwaitable(UpdateItemRequest request) const
+{
+  return { m_executor.get(), { this, &DynamoDBClient::UpdateItem, std::move(request) } };
+}
+
+ClientOperationAwaitable<DynamoDBClient, UpdateTableRequest, UpdateTableOutcome> DynamoDBClient::UpdateTableAwaitable(UpdateTableRequest request) const
+{
+  return { m_executor.get(), { this, &DynamoDBClient::UpdateTable, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,26 +29,32 @@ namespace Aws
       namespace AttributeActionMapper
       {
 
-        static const int ADD_HASH = HashingUtils::HashString("ADD");
-        static const int PUT_HASH = HashingUtils::HashString("PUT");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ADD_HASH = 64641;
+        static const int PUT_HASH = 79599;
+        static const int DELETE__HASH = 2012838315;
 
 
         AttributeAction GetAttributeActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADD_HASH)
+          switch (hashCode)
           {
+          case ADD_HASH:
             return AttributeAction::ADD;
-          }
-          else if (hashCode == PUT_HASH)
-          {
+          case PUT_HASH:
             return AttributeAction::PUT;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
+          case DELETE__HASH:
             return AttributeAction::DELETE_;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
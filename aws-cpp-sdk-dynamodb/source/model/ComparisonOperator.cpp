@@ -29,76 +29,62 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int EQ_HASH = HashingUtils::HashString("EQ");
-        static const int NE_HASH = HashingUtils::HashString("NE");
-        static const int IN_HASH = HashingUtils::HashString("IN");
-        static const int LE_HASH = HashingUtils::HashString("LE");
-        static const int LT_HASH = HashingUtils::HashString("LT");
-        static const int GE_HASH = HashingUtils::HashString("GE");
-        static const int GT_HASH = HashingUtils::HashString("GT");
-        static const int BETWEEN_HASH = HashingUtils::HashString("BETWEEN");
-        static const int NOT_NULL_HASH = HashingUtils::HashString("NOT_NULL");
-        static const int NULL__HASH = HashingUtils::HashString("NULL");
-        static const int CONTAINS_HASH = HashingUtils::HashString("CONTAINS");
-        static const int NOT_CONTAINS_HASH = HashingUtils::HashString("NOT_CONTAINS");
-        static const int BEGINS_WITH_HASH = HashingUtils::HashString("BEGINS_WITH");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int EQ_HASH = 2220;
+        static const int NE_HASH = 2487;
+        static const int IN_HASH = 2341;
+        static const int LE_HASH = 2425;
+        static const int LT_HASH = 2440;
+        static const int GE_HASH = 2270;
+        static const int GT_HASH = 2285;
+        static const int BETWEEN_HASH = 501348328;
+        static const int NOT_NULL_HASH = -1906409581;
+        static const int NULL__HASH = 2407815;
+        static const int CONTAINS_HASH = 215180831;
+        static const int NOT_CONTAINS_HASH = -2063252949;
+        static const int BEGINS_WITH_HASH = -1440886021;
 
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQ_HASH)
+          switch (hashCode)
           {
+          case EQ_HASH:
             return ComparisonOperator::EQ;
-          }
-          else if (hashCode == NE_HASH)
-          {
+          case NE_HASH:
             return ComparisonOperator::NE;
-          }
-          else if (hashCode == IN_HASH)
-          {
+          case IN_HASH:
             return ComparisonOperator::IN;
-          }
-          else if (hashCode == LE_HASH)
-          {
+          case LE_HASH:
             return ComparisonOperator::LE;
-          }
-          else if (hashCode == LT_HASH)
-          {
+          case LT_HASH:
             return ComparisonOperator::LT;
-          }
-          else if (hashCode == GE_HASH)
-          {
+          case GE_HASH:
             return ComparisonOperator::GE;
-          }
-          else if (hashCode == GT_HASH)
-          {
+          case GT_HASH:
             return ComparisonOperator::GT;
-          }
-          else if (hashCode == BETWEEN_HASH)
-          {
+          case BETWEEN_HASH:
             return ComparisonOperator::BETWEEN;
-          }
-          else if (hashCode == NOT_NULL_HASH)
-          {
+          case NOT_NULL_HASH:
             return ComparisonOperator::NOT_NULL;
-          }
-          else if (hashCode == NULL__HASH)
-          {
+          case NULL__HASH:
             return ComparisonOperator::NULL_;
-          }
-          else if (hashCode == CONTAINS_HASH)
-          {
+          case CONTAINS_HASH:
             return ComparisonOperator::CONTAINS;
-          }
-          else if (hashCode == NOT_CONTAINS_HASH)
-          {
+          case NOT_CONTAINS_HASH:
             return ComparisonOperator::NOT_CONTAINS;
-          }
-          else if (hashCode == BEGINS_WITH_HASH)
-          {
+          case BEGINS_WITH_HASH:
             return ComparisonOperator::BEGINS_WITH;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace ConditionalOperatorMapper
       {
 
-        static const int AND_HASH = HashingUtils::HashString("AND");
-        static const int OR_HASH = HashingUtils::HashString("OR");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int AND_HASH = 64951;
+        static const int OR_HASH = 2531;
 
 
         ConditionalOperator GetConditionalOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AND_HASH)
+          switch (hashCode)
           {
+          case AND_HASH:
             return ConditionalOperator::AND;
-          }
-          else if (hashCode == OR_HASH)
-          {
+          case OR_HASH:
             return ConditionalOperator::OR;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,31 +29,35 @@ namespace Aws
       namespace IndexStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CREATING_HASH = -1691918663;
+        static const int UPDATING_HASH = 2105227078;
+        static const int DELETING_HASH = 1602343848;
+        static const int ACTIVE_HASH = 1925346054;
 
 
         IndexStatus GetIndexStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
+          switch (hashCode)
           {
+          case CREATING_HASH:
             return IndexStatus::CREATING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
+          case UPDATING_HASH:
             return IndexStatus::UPDATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
+          case DELETING_HASH:
             return IndexStatus::DELETING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
+          case ACTIVE_HASH:
             return IndexStatus::ACTIVE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace KeyTypeMapper
       {
 
-        static const int HASH_HASH = HashingUtils::HashString("HASH");
-        static const int RANGE_HASH = HashingUtils::HashString("RANGE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int HASH_HASH = 2210062;
+        static const int RANGE_HASH = 77742365;
 
 
         KeyType GetKeyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HASH_HASH)
+          switch (hashCode)
           {
+          case HASH_HASH:
             return KeyType::HASH;
-          }
-          else if (hashCode == RANGE_HASH)
-          {
+          case RANGE_HASH:
             return KeyType::RANGE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace ProjectionTypeMapper
       {
 
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-        static const int KEYS_ONLY_HASH = HashingUtils::HashString("KEYS_ONLY");
-        static const int INCLUDE_HASH = HashingUtils::HashString("INCLUDE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ALL_HASH = 64897;
+        static const int KEYS_ONLY_HASH = 1724531479;
+        static const int INCLUDE_HASH = -1634410360;
 
 
         ProjectionType GetProjectionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_HASH)
+          switch (hashCode)
           {
+          case ALL_HASH:
             return ProjectionType::ALL;
-          }
-          else if (hashCode == KEYS_ONLY_HASH)
-          {
+          case KEYS_ONLY_HASH:
             return ProjectionType::KEYS_ONLY;
-          }
-          else if (hashCode == INCLUDE_HASH)
-          {
+          case INCLUDE_HASH:
             return ProjectionType::INCLUDE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace ReturnConsumedCapacityMapper
       {
 
-        static const int INDEXES_HASH = HashingUtils::HashString("INDEXES");
-        static const int TOTAL_HASH = HashingUtils::HashString("TOTAL");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int INDEXES_HASH = -1633692448;
+        static const int TOTAL_HASH = 80012068;
+        static const int NONE_HASH = 2402104;
 
 
         ReturnConsumedCapacity GetReturnConsumedCapacityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INDEXES_HASH)
+          switch (hashCode)
           {
+          case INDEXES_HASH:
             return ReturnConsumedCapacity::INDEXES;
-          }
-          else if (hashCode == TOTAL_HASH)
-          {
+          case TOTAL_HASH:
             return ReturnConsumedCapacity::TOTAL;
-          }
-          else if (hashCode == NONE_HASH)
-          {
+          case NONE_HASH:
             return ReturnConsumedCapacity::NONE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
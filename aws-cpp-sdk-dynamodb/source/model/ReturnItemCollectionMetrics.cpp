@@ -29,21 +29,29 @@ namespace Aws
       namespace ReturnItemCollectionMetricsMapper
       {
 
-        static const int SIZE_HASH = HashingUtils::HashString("SIZE");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int SIZE_HASH = 2545665;
+        static const int NONE_HASH = 2402104;
 
 
         ReturnItemCollectionMetrics GetReturnItemCollectionMetricsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SIZE_HASH)
+          switch (hashCode)
           {
+          case SIZE_HASH:
             return ReturnItemCollectionMetrics::SIZE;
-          }
-          else if (hashCode == NONE_HASH)
-          {
+          case NONE_HASH:
             return ReturnItemCollectionMetrics::NONE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,36 +29,38 @@ namespace Aws
       namespace ReturnValueMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int ALL_OLD_HASH = HashingUtils::HashString("ALL_OLD");
-        static const int UPDATED_OLD_HASH = HashingUtils::HashString("UPDATED_OLD");
-        static const int ALL_NEW_HASH = HashingUtils::HashString("ALL_NEW");
-        static const int UPDATED_NEW_HASH = HashingUtils::HashString("UPDATED_NEW");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int NONE_HASH = 2402104;
+        static const int ALL_OLD_HASH = -192891319;
+        static const int UPDATED_OLD_HASH = 1584466019;
+        static const int ALL_NEW_HASH = -192892478;
+        static const int UPDATED_NEW_HASH = 1584464860;
 
 
         ReturnValue GetReturnValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          switch (hashCode)
           {
+          case NONE_HASH:
             return ReturnValue::NONE;
-          }
-          else if (hashCode == ALL_OLD_HASH)
-          {
+          case ALL_OLD_HASH:
             return ReturnValue::ALL_OLD;
-          }
-          else if (hashCode == UPDATED_OLD_HASH)
-          {
+          case UPDATED_OLD_HASH:
             return ReturnValue::UPDATED_OLD;
-          }
-          else if (hashCode == ALL_NEW_HASH)
-          {
+          case ALL_NEW_HASH:
             return ReturnValue::ALL_NEW;
-          }
-          else if (hashCode == UPDATED_NEW_HASH)
-          {
+          case UPDATED_NEW_HASH:
             return ReturnValue::UPDATED_NEW;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
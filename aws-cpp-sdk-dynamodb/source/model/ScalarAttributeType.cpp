@@ -29,26 +29,32 @@ namespace Aws
       namespace ScalarAttributeTypeMapper
       {
 
-        static const int S_HASH = HashingUtils::HashString("S");
-        static const int N_HASH = HashingUtils::HashString("N");
-        static const int B_HASH = HashingUtils::HashString("B");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int S_HASH = 83;
+        static const int N_HASH = 78;
+        static const int B_HASH = 66;
 
 
         ScalarAttributeType GetScalarAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == S_HASH)
+          switch (hashCode)
           {
+          case S_HASH:
             return ScalarAttributeType::S;
-          }
-          else if (hashCode == N_HASH)
-          {
+          case N_HASH:
             return ScalarAttributeType::N;
-          }
-          else if (hashCode == B_HASH)
-          {
+          case B_HASH:
             return ScalarAttributeType::B;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,31 +29,35 @@ namespace Aws
       namespace SelectMapper
       {
 
-        static const int ALL_ATTRIBUTES_HASH = HashingUtils::HashString("ALL_ATTRIBUTES");
-        static const int ALL_PROJECTED_ATTRIBUTES_HASH = HashingUtils::HashString("ALL_PROJECTED_ATTRIBUTES");
-        static const int SPECIFIC_ATTRIBUTES_HASH = HashingUtils::HashString("SPECIFIC_ATTRIBUTES");
-        static const int COUNT_HASH = HashingUtils::HashString("COUNT");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ALL_ATTRIBUTES_HASH = -420928811;
+        static const int ALL_PROJECTED_ATTRIBUTES_HASH = 349496988;
+        static const int SPECIFIC_ATTRIBUTES_HASH = -1043218812;
+        static const int COUNT_HASH = 64313583;
 
 
         Select GetSelectForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_ATTRIBUTES_HASH)
+          switch (hashCode)
           {
+          case ALL_ATTRIBUTES_HASH:
             return Select::ALL_ATTRIBUTES;
-          }
-          else if (hashCode == ALL_PROJECTED_ATTRIBUTES_HASH)
-          {
+          case ALL_PROJECTED_ATTRIBUTES_HASH:
             return Select::ALL_PROJECTED_ATTRIBUTES;
-          }
-          else if (hashCode == SPECIFIC_ATTRIBUTES_HASH)
-          {
+          case SPECIFIC_ATTRIBUTES_HASH:
             return Select::SPECIFIC_ATTRIBUTES;
-          }
-          else if (hashCode == COUNT_HASH)
-          {
+          case COUNT_HASH:
             return Select::COUNT;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
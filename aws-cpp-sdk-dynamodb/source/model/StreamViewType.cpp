@@ -29,31 +29,35 @@ namespace Aws
       namespace StreamViewTypeMapper
       {
 
-        static const int NEW_IMAGE_HASH = HashingUtils::HashString("NEW_IMAGE");
-        static const int OLD_IMAGE_HASH = HashingUtils::HashString("OLD_IMAGE");
-        static const int NEW_AND_OLD_IMAGES_HASH = HashingUtils::HashString("NEW_AND_OLD_IMAGES");
-        static const int KEYS_ONLY_HASH = HashingUtils::HashString("KEYS_ONLY");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int NEW_IMAGE_HASH = -854711876;
+        static const int OLD_IMAGE_HASH = 1264870659;
+        static const int NEW_AND_OLD_IMAGES_HASH = 363674583;
+        static const int KEYS_ONLY_HASH = 1724531479;
 
 
         StreamViewType GetStreamViewTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NEW_IMAGE_HASH)
+          switch (hashCode)
           {
+          case NEW_IMAGE_HASH:
             return StreamViewType::NEW_IMAGE;
-          }
-          else if (hashCode == OLD_IMAGE_HASH)
-          {
+          case OLD_IMAGE_HASH:
             return StreamViewType::OLD_IMAGE;
-          }
-          else if (hashCode == NEW_AND_OLD_IMAGES_HASH)
-          {
+          case NEW_AND_OLD_IMAGES_HASH:
             return StreamViewType::NEW_AND_OLD_IMAGES;
-          }
-          else if (hashCode == KEYS_ONLY_HASH)
-          {
+          case KEYS_ONLY_HASH:
             return StreamViewType::KEYS_ONLY;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -166,6 +166,9 @@
 #include <aws/ec2/model/UnmonitorInstancesResponse.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -1093,6 +1096,18 @@ namespace Model
          */
         virtual void AcceptVpcPeeringConnectionAsync(const Model::AcceptVpcPeeringConnectionRequest& request, const AcceptVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AcceptVpcPeeringConnectionCallable(const Model::AcceptVpcPeeringConnectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AcceptVpcPeeringConnectionOutcomeCallable AcceptVpcPeeringConnectionCallable(Model::AcceptVpcPeeringConnectionRequest&& request) const;
+
+        /**
+         * Same as AcceptVpcPeeringConnectionAsync(const Model::AcceptVpcPeeringConnectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AcceptVpcPeeringConnectionAsync(Model::AcceptVpcPeeringConnectionRequest&& request, const AcceptVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Acquires an Elastic IP address.</p> <p>An Elastic IP address is for use
          * either in the EC2-Classic platform or in a VPC. For more information, see <a
@@ -1121,6 +1136,18 @@ namespace Model
          */
         virtual void AllocateAddressAsync(const Model::AllocateAddressRequest& request, const AllocateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AllocateAddressCallable(const Model::AllocateAddressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AllocateAddressOutcomeCallable AllocateAddressCallable(Model::AllocateAddressRequest&& request) const;
+
+        /**
+         * Same as AllocateAddressAsync(const Model::AllocateAddressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AllocateAddressAsync(Model::AllocateAddressRequest&& request, const AllocateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Allocates a Dedicated host to your account. At minimum you need to specify
          * the instance size type, Availability Zone, and quantity of hosts you want to
@@ -1146,6 +1173,18 @@ namespace Model
          */
         virtual void AllocateHostsAsync(const Model::AllocateHostsRequest& request, const AllocateHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AllocateHostsCallable(const Model::AllocateHostsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AllocateHostsOutcomeCallable AllocateHostsCallable(Model::AllocateHostsRequest&& request) const;
+
+        /**
+         * Same as AllocateHostsAsync(const Model::AllocateHostsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AllocateHostsAsync(Model::AllocateHostsRequest&& request, const AllocateHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Assigns one or more secondary private IP addresses to the specified network
          * interface. You can specify one or more specific secondary IP addresses, or you
@@ -1198,6 +1237,18 @@ namespace Model
          */
         virtual void AssignPrivateIpAddressesAsync(const Model::AssignPrivateIpAddressesRequest& request, const AssignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssignPrivateIpAddressesCallable(const Model::AssignPrivateIpAddressesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AssignPrivateIpAddressesOutcomeCallable AssignPrivateIpAddressesCallable(Model::AssignPrivateIpAddressesRequest&& request) const;
+
+        /**
+         * Same as AssignPrivateIpAddressesAsync(const Model::AssignPrivateIpAddressesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AssignPrivateIpAddressesAsync(Model::AssignPrivateIpAddressesRequest&& request, const AssignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates an Elastic IP address with an instance or a network interface.</p>
          * <p>An Elastic IP address is for use in either the EC2-Classic platform or in a
@@ -1256,6 +1307,18 @@ namespace Model
          */
         virtual void AssociateAddressAsync(const Model::AssociateAddressRequest& request, const AssociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssociateAddressCallable(const Model::AssociateAddressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AssociateAddressOutcomeCallable AssociateAddressCallable(Model::AssociateAddressRequest&& request) const;
+
+        /**
+         * Same as AssociateAddressAsync(const Model::AssociateAddressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AssociateAddressAsync(Model::AssociateAddressRequest&& request, const AssociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates a set of DHCP options (that you've previously created) with the
          * specified VPC, or associates no DHCP options with the VPC.</p> <p>After you
@@ -1302,6 +1365,18 @@ namespace Model
          */
         virtual void AssociateDhcpOptionsAsync(const Model::AssociateDhcpOptionsRequest& request, const AssociateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssociateDhcpOptionsCallable(const Model::AssociateDhcpOptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AssociateDhcpOptionsOutcomeCallable AssociateDhcpOptionsCallable(Model::AssociateDhcpOptionsRequest&& request) const;
+
+        /**
+         * Same as AssociateDhcpOptionsAsync(const Model::AssociateDhcpOptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AssociateDhcpOptionsAsync(Model::AssociateDhcpOptionsRequest&& request, const AssociateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates a subnet with a route table. The subnet and route table must be in
          * the same VPC. This association causes traffic originating from the subnet to be
@@ -1342,6 +1417,18 @@ namespace Model
          */
         virtual void AssociateRouteTableAsync(const Model::AssociateRouteTableRequest& request, const AssociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssociateRouteTableCallable(const Model::AssociateRouteTableRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AssociateRouteTableOutcomeCallable AssociateRouteTableCallable(Model::AssociateRouteTableRequest&& request) const;
+
+        /**
+         * Same as AssociateRouteTableAsync(const Model::AssociateRouteTableRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AssociateRouteTableAsync(Model::AssociateRouteTableRequest&& request, const AssociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Links an EC2-Classic instance to a ClassicLink-enabled VPC through one or
          * more of the VPC's security groups. You cannot link an EC2-Classic instance to
@@ -1385,6 +1472,18 @@ namespace Model
          */
         virtual void AttachClassicLinkVpcAsync(const Model::AttachClassicLinkVpcRequest& request, const AttachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachClassicLinkVpcCallable(const Model::AttachClassicLinkVpcRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachClassicLinkVpcOutcomeCallable AttachClassicLinkVpcCallable(Model::AttachClassicLinkVpcRequest&& request) const;
+
+        /**
+         * Same as AttachClassicLinkVpcAsync(const Model::AttachClassicLinkVpcRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachClassicLinkVpcAsync(Model::AttachClassicLinkVpcRequest&& request, const AttachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches an Internet gateway to a VPC, enabling connectivity between the
          * Internet and the VPC. For more information about your VPC and Internet gateway,
@@ -1413,6 +1512,18 @@ namespace Model
          */
         virtual void AttachInternetGatewayAsync(const Model::AttachInternetGatewayRequest& request, const AttachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachInternetGatewayCallable(const Model::AttachInternetGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachInternetGatewayOutcomeCallable AttachInternetGatewayCallable(Model::AttachInternetGatewayRequest&& request) const;
+
+        /**
+         * Same as AttachInternetGatewayAsync(const Model::AttachInternetGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachInternetGatewayAsync(Model::AttachInternetGatewayRequest&& request, const AttachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches a network interface to an instance.</p>
          */
@@ -1432,6 +1543,18 @@ namespace Model
          */
         virtual void AttachNetworkInterfaceAsync(const Model::AttachNetworkInterfaceRequest& request, const AttachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachNetworkInterfaceCallable(const Model::AttachNetworkInterfaceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachNetworkInterfaceOutcomeCallable AttachNetworkInterfaceCallable(Model::AttachNetworkInterfaceRequest&& request) const;
+
+        /**
+         * Same as AttachNetworkInterfaceAsync(const Model::AttachNetworkInterfaceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachNetworkInterfaceAsync(Model::AttachNetworkInterfaceRequest&& request, const AttachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches an EBS volume to a running or stopped instance and exposes it to the
          * instance with the specified device name.</p> <p>Encrypted EBS volumes may only
@@ -1520,6 +1643,18 @@ namespace Model
          */
         virtual void AttachVolumeAsync(const Model::AttachVolumeRequest& request, const AttachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachVolumeCallable(const Model::AttachVolumeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachVolumeOutcomeCallable AttachVolumeCallable(Model::AttachVolumeRequest&& request) const;
+
+        /**
+         * Same as AttachVolumeAsync(const Model::AttachVolumeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachVolumeAsync(Model::AttachVolumeRequest&& request, const AttachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches a virtual private gateway to a VPC. For more information, see <a
          * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_VPN.html">Adding
@@ -1548,6 +1683,18 @@ namespace Model
          */
         virtual void AttachVpnGatewayAsync(const Model::AttachVpnGatewayRequest& request, const AttachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachVpnGatewayCallable(const Model::AttachVpnGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachVpnGatewayOutcomeCallable AttachVpnGatewayCallable(Model::AttachVpnGatewayRequest&& request) const;
+
+        /**
+         * Same as AttachVpnGatewayAsync(const Model::AttachVpnGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachVpnGatewayAsync(Model::AttachVpnGatewayRequest&& request, const AttachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>[EC2-VPC only] Adds one or more egress rules to a security group for use with
          * a VPC. Specifically, this action permits instances to send traffic to one or
@@ -1609,6 +1756,18 @@ namespace Model
          */
         virtual void AuthorizeSecurityGroupEgressAsync(const Model::AuthorizeSecurityGroupEgressRequest& request, const AuthorizeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AuthorizeSecurityGroupEgressCallable(const Model::AuthorizeSecurityGroupEgressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AuthorizeSecurityGroupEgressOutcomeCallable AuthorizeSecurityGroupEgressCallable(Model::AuthorizeSecurityGroupEgressRequest&& request) const;
+
+        /**
+         * Same as AuthorizeSecurityGroupEgressAsync(const Model::AuthorizeSecurityGroupEgressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AuthorizeSecurityGroupEgressAsync(Model::AuthorizeSecurityGroupEgressRequest&& request, const AuthorizeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds one or more ingress rules to a security group.</p> <important>
          * <p>EC2-Classic: You can have up to 100 rules per group.</p> <p>EC2-VPC: You can
@@ -1664,6 +1823,18 @@ namespace Model
          */
         virtual void AuthorizeSecurityGroupIngressAsync(const Model::AuthorizeSecurityGroupIngressRequest& request, const AuthorizeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AuthorizeSecurityGroupIngressCallable(const Model::AuthorizeSecurityGroupIngressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AuthorizeSecurityGroupIngressOutcomeCallable AuthorizeSecurityGroupIngressCallable(Model::AuthorizeSecurityGroupIngressRequest&& request) const;
+
+        /**
+         * Same as AuthorizeSecurityGroupIngressAsync(const Model::AuthorizeSecurityGroupIngressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AuthorizeSecurityGroupIngressAsync(Model::AuthorizeSecurityGroupIngressRequest&& request, const AuthorizeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Bundles an Amazon instance store-backed Windows instance.</p> <p>During
          * bundling, only the root device volume (C:\) is bundled. Data on other instance
@@ -1701,6 +1872,18 @@ namespace Model
          */
         virtual void BundleInstanceAsync(const Model::BundleInstanceRequest& request, const BundleInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BundleInstanceCallable(const Model::BundleInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BundleInstanceOutcomeCallable BundleInstanceCallable(Model::BundleInstanceRequest&& request) const;
+
+        /**
+         * Same as BundleInstanceAsync(const Model::BundleInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BundleInstanceAsync(Model::BundleInstanceRequest&& request, const BundleInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels a bundling operation for an instance store-backed Windows
          * instance.</p>
@@ -1723,6 +1906,18 @@ namespace Model
          */
         virtual void CancelBundleTaskAsync(const Model::CancelBundleTaskRequest& request, const CancelBundleTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelBundleTaskCallable(const Model::CancelBundleTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelBundleTaskOutcomeCallable CancelBundleTaskCallable(Model::CancelBundleTaskRequest&& request) const;
+
+        /**
+         * Same as CancelBundleTaskAsync(const Model::CancelBundleTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelBundleTaskAsync(Model::CancelBundleTaskRequest&& request, const CancelBundleTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels an active conversion task. The task can be the import of an instance
          * or volume. The action removes all artifacts of the conversion, including a
@@ -1763,6 +1958,18 @@ namespace Model
          */
         virtual void CancelConversionTaskAsync(const Model::CancelConversionTaskRequest& request, const CancelConversionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelConversionTaskCallable(const Model::CancelConversionTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelConversionTaskOutcomeCallable CancelConversionTaskCallable(Model::CancelConversionTaskRequest&& request) const;
+
+        /**
+         * Same as CancelConversionTaskAsync(const Model::CancelConversionTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelConversionTaskAsync(Model::CancelConversionTaskRequest&& request, const CancelConversionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels an active export task. The request removes all artifacts of the
          * export, including any partially-created Amazon S3 objects. If the export task is
@@ -1791,6 +1998,18 @@ namespace Model
          */
         virtual void CancelExportTaskAsync(const Model::CancelExportTaskRequest& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelExportTaskCallable(const Model::CancelExportTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelExportTaskOutcomeCallable CancelExportTaskCallable(Model::CancelExportTaskRequest&& request) const;
+
+        /**
+         * Same as CancelExportTaskAsync(const Model::CancelExportTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelExportTaskAsync(Model::CancelExportTaskRequest&& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels an in-process import virtual machine or import snapshot task.</p>
          */
@@ -1810,6 +2029,18 @@ namespace Model
          */
         virtual void CancelImportTaskAsync(const Model::CancelImportTaskRequest& request, const CancelImportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelImportTaskCallable(const Model::CancelImportTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelImportTaskOutcomeCallable CancelImportTaskCallable(Model::CancelImportTaskRequest&& request) const;
+
+        /**
+         * Same as CancelImportTaskAsync(const Model::CancelImportTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelImportTaskAsync(Model::CancelImportTaskRequest&& request, const CancelImportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels the specified Reserved Instance listing in the Reserved Instance
          * Marketplace.</p> <p>For more information, see <a
@@ -1841,6 +2072,18 @@ namespace Model
          */
         virtual void CancelReservedInstancesListingAsync(const Model::CancelReservedInstancesListingRequest& request, const CancelReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelReservedInstancesListingCallable(const Model::CancelReservedInstancesListingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelReservedInstancesListingOutcomeCallable CancelReservedInstancesListingCallable(Model::CancelReservedInstancesListingRequest&& request) const;
+
+        /**
+         * Same as CancelReservedInstancesListingAsync(const Model::CancelReservedInstancesListingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelReservedInstancesListingAsync(Model::CancelReservedInstancesListingRequest&& request, const CancelReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels the specified Spot fleet requests.</p> <p>After you cancel a Spot
          * fleet request, the Spot fleet launches no new Spot instances. You must specify
@@ -1878,6 +2121,18 @@ namespace Model
          */
         virtual void CancelSpotFleetRequestsAsync(const Model::CancelSpotFleetRequestsRequest& request, const CancelSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelSpotFleetRequestsCallable(const Model::CancelSpotFleetRequestsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelSpotFleetRequestsOutcomeCallable CancelSpotFleetRequestsCallable(Model::CancelSpotFleetRequestsRequest&& request) const;
+
+        /**
+         * Same as CancelSpotFleetRequestsAsync(const Model::CancelSpotFleetRequestsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelSpotFleetRequestsAsync(Model::CancelSpotFleetRequestsRequest&& request, const CancelSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels one or more Spot instance requests. Spot instances are instances that
          * Amazon EC2 starts on your behalf when the bid price that you specify exceeds the
@@ -1921,6 +2176,18 @@ namespace Model
          */
         virtual void CancelSpotInstanceRequestsAsync(const Model::CancelSpotInstanceRequestsRequest& request, const CancelSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelSpotInstanceRequestsCallable(const Model::CancelSpotInstanceRequestsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelSpotInstanceRequestsOutcomeCallable CancelSpotInstanceRequestsCallable(Model::CancelSpotInstanceRequestsRequest&& request) const;
+
+        /**
+         * Same as CancelSpotInstanceRequestsAsync(const Model::CancelSpotInstanceRequestsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelSpotInstanceRequestsAsync(Model::CancelSpotInstanceRequestsRequest&& request, const CancelSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Determines whether a product code is associated with an instance. This action
          * can only be used by the owner of the product code. It is useful when a product
@@ -1949,6 +2216,18 @@ namespace Model
          */
         virtual void ConfirmProductInstanceAsync(const Model::ConfirmProductInstanceRequest& request, const ConfirmProductInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConfirmProductInstanceCallable(const Model::ConfirmProductInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ConfirmProductInstanceOutcomeCallable ConfirmProductInstanceCallable(Model::ConfirmProductInstanceRequest&& request) const;
+
+        /**
+         * Same as ConfirmProductInstanceAsync(const Model::ConfirmProductInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ConfirmProductInstanceAsync(Model::ConfirmProductInstanceRequest&& request, const ConfirmProductInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Initiates the copy of an AMI from the specified source region to the current
          * region. You specify the destination region by using its endpoint when making the
@@ -1980,6 +2259,18 @@ namespace Model
          */
         virtual void CopyImageAsync(const Model::CopyImageRequest& request, const CopyImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopyImageCallable(const Model::CopyImageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CopyImageOutcomeCallable CopyImageCallable(Model::CopyImageRequest&& request) const;
+
+        /**
+         * Same as CopyImageAsync(const Model::CopyImageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CopyImageAsync(Model::CopyImageRequest&& request, const CopyImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Copies a point-in-time snapshot of an EBS volume and stores it in Amazon S3.
          * You can copy the snapshot within the same region or from one region to another.
@@ -2035,6 +2326,18 @@ namespace Model
          */
         virtual void CopySnapshotAsync(const Model::CopySnapshotRequest& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopySnapshotCallable(const Model::CopySnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CopySnapshotOutcomeCallable CopySnapshotCallable(Model::CopySnapshotRequest&& request) const;
+
+        /**
+         * Same as CopySnapshotAsync(const Model::CopySnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CopySnapshotAsync(Model::CopySnapshotRequest&& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides information to AWS about your VPN customer gateway device. The
          * customer gateway is the appliance at your end of the VPN connection. (The device
@@ -2114,6 +2417,18 @@ namespace Model
          */
         virtual void CreateCustomerGatewayAsync(const Model::CreateCustomerGatewayRequest& request, const CreateCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCustomerGatewayCallable(const Model::CreateCustomerGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateCustomerGatewayOutcomeCallable CreateCustomerGatewayCallable(Model::CreateCustomerGatewayRequest&& request) const;
+
+        /**
+         * Same as CreateCustomerGatewayAsync(const Model::CreateCustomerGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateCustomerGatewayAsync(Model::CreateCustomerGatewayRequest&& request, const CreateCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a set of DHCP options for your VPC. After creating the set, you must
          * associate it with the VPC, causing all existing and new instances that you
@@ -2229,6 +2544,18 @@ namespace Model
          */
         virtual void CreateDhcpOptionsAsync(const Model::CreateDhcpOptionsRequest& request, const CreateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDhcpOptionsCallable(const Model::CreateDhcpOptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDhcpOptionsOutcomeCallable CreateDhcpOptionsCallable(Model::CreateDhcpOptionsRequest&& request) const;
+
+        /**
+         * Same as CreateDhcpOptionsAsync(const Model::CreateDhcpOptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDhcpOptionsAsync(Model::CreateDhcpOptionsRequest&& request, const CreateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates one or more flow logs to capture IP traffic for a specific network
          * interface, subnet, or VPC. Flow logs are delivered to a specified log group in
@@ -2269,6 +2596,18 @@ namespace Model
          */
         virtual void CreateFlowLogsAsync(const Model::CreateFlowLogsRequest& request, const CreateFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateFlowLogsCallable(const Model::CreateFlowLogsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateFlowLogsOutcomeCallable CreateFlowLogsCallable(Model::CreateFlowLogsRequest&& request) const;
+
+        /**
+         * Same as CreateFlowLogsAsync(const Model::CreateFlowLogsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateFlowLogsAsync(Model::CreateFlowLogsRequest&& request, const CreateFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an Amazon EBS-backed AMI from an Amazon EBS-backed instance that is
          * either running or stopped.</p> <p>If you customized your instance with instance
@@ -2312,6 +2651,18 @@ namespace Model
          */
         virtual void CreateImageAsync(const Model::CreateImageRequest& request, const CreateImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateImageCallable(const Model::CreateImageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateImageOutcomeCallable CreateImageCallable(Model::CreateImageRequest&& request) const;
+
+        /**
+         * Same as CreateImageAsync(const Model::CreateImageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateImageAsync(Model::CreateImageRequest&& request, const CreateImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Exports a running or stopped instance to an S3 bucket.</p> <p>For information
          * about the supported operating systems, image formats, and known limitations for
@@ -2343,6 +2694,18 @@ namespace Model
          */
         virtual void CreateInstanceExportTaskAsync(const Model::CreateInstanceExportTaskRequest& request, const CreateInstanceExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateInstanceExportTaskCallable(const Model::CreateInstanceExportTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateInstanceExportTaskOutcomeCallable CreateInstanceExportTaskCallable(Model::CreateInstanceExportTaskRequest&& request) const;
+
+        /**
+         * Same as CreateInstanceExportTaskAsync(const Model::CreateInstanceExportTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateInstanceExportTaskAsync(Model::CreateInstanceExportTaskRequest&& request, const CreateInstanceExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an Internet gateway for use with a VPC. After creating the Internet
          * gateway, you attach it to a VPC using <a>AttachInternetGateway</a>.</p> <p>For
@@ -2374,6 +2737,18 @@ namespace Model
          */
         virtual void CreateInternetGatewayAsync(const Model::CreateInternetGatewayRequest& request, const CreateInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateInternetGatewayCallable(const Model::CreateInternetGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateInternetGatewayOutcomeCallable CreateInternetGatewayCallable(Model::CreateInternetGatewayRequest&& request) const;
+
+        /**
+         * Same as CreateInternetGatewayAsync(const Model::CreateInternetGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateInternetGatewayAsync(Model::CreateInternetGatewayRequest&& request, const CreateInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a 2048-bit RSA key pair with the specified name. Amazon EC2 stores
          * the public key and displays the private key for you to save to a file. The
@@ -2420,6 +2795,18 @@ namespace Model
          */
         virtual void CreateKeyPairAsync(const Model::CreateKeyPairRequest& request, const CreateKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateKeyPairCallable(const Model::CreateKeyPairRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateKeyPairOutcomeCallable CreateKeyPairCallable(Model::CreateKeyPairRequest&& request) const;
+
+        /**
+         * Same as CreateKeyPairAsync(const Model::CreateKeyPairRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateKeyPairAsync(Model::CreateKeyPairRequest&& request, const CreateKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a NAT gateway in the specified subnet. A NAT gateway can be used to
          * enable instances in a private subnet to connect to the Internet. This action
@@ -2454,6 +2841,18 @@ namespace Model
          */
         virtual void CreateNatGatewayAsync(const Model::CreateNatGatewayRequest& request, const CreateNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateNatGatewayCallable(const Model::CreateNatGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateNatGatewayOutcomeCallable CreateNatGatewayCallable(Model::CreateNatGatewayRequest&& request) const;
+
+        /**
+         * Same as CreateNatGatewayAsync(const Model::CreateNatGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateNatGatewayAsync(Model::CreateNatGatewayRequest&& request, const CreateNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a network ACL in a VPC. Network ACLs provide an optional layer of
          * security (in addition to security groups) for the instances in your VPC.</p>
@@ -2485,6 +2884,18 @@ namespace Model
          */
         virtual void CreateNetworkAclAsync(const Model::CreateNetworkAclRequest& request, const CreateNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateNetworkAclCallable(const Model::CreateNetworkAclRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateNetworkAclOutcomeCallable CreateNetworkAclCallable(Model::CreateNetworkAclRequest&& request) const;
+
+        /**
+         * Same as CreateNetworkAclAsync(const Model::CreateNetworkAclRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateNetworkAclAsync(Model::CreateNetworkAclRequest&& request, const CreateNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an entry (a rule) in a network ACL with the specified rule number.
          * Each network ACL has a set of numbered ingress rules and a separate set of
@@ -2543,6 +2954,18 @@ namespace Model
          */
         virtual void CreateNetworkAclEntryAsync(const Model::CreateNetworkAclEntryRequest& request, const CreateNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateNetworkAclEntryCallable(const Model::CreateNetworkAclEntryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateNetworkAclEntryOutcomeCallable CreateNetworkAclEntryCallable(Model::CreateNetworkAclEntryRequest&& request) const;
+
+        /**
+         * Same as CreateNetworkAclEntryAsync(const Model::CreateNetworkAclEntryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateNetworkAclEntryAsync(Model::CreateNetworkAclEntryRequest&& request, const CreateNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a network interface in the specified subnet.</p> <p>For more
          * information about network interfaces, see <a
@@ -2574,6 +2997,18 @@ namespace Model
          */
         virtual void CreateNetworkInterfaceAsync(const Model::CreateNetworkInterfaceRequest& request, const CreateNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateNetworkInterfaceCallable(const Model::CreateNetworkInterfaceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateNetworkInterfaceOutcomeCallable CreateNetworkInterfaceCallable(Model::CreateNetworkInterfaceRequest&& request) const;
+
+        /**
+         * Same as CreateNetworkInterfaceAsync(const Model::CreateNetworkInterfaceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateNetworkInterfaceAsync(Model::CreateNetworkInterfaceRequest&& request, const CreateNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a placement group that you launch cluster instances into. You must
          * give the group a name that's unique within the scope of your account.</p> <p>For
@@ -2605,6 +3040,18 @@ namespace Model
          */
         virtual void CreatePlacementGroupAsync(const Model::CreatePlacementGroupRequest& request, const CreatePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePlacementGroupCallable(const Model::CreatePlacementGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreatePlacementGroupOutcomeCallable CreatePlacementGroupCallable(Model::CreatePlacementGroupRequest&& request) const;
+
+        /**
+         * Same as CreatePlacementGroupAsync(const Model::CreatePlacementGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreatePlacementGroupAsync(Model::CreatePlacementGroupRequest&& request, const CreatePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a listing for Amazon EC2 Reserved Instances to be sold in the
          * Reserved Instance Marketplace. You can submit one Reserved Instance listing at a
@@ -2675,6 +3122,18 @@ namespace Model
          */
         virtual void CreateReservedInstancesListingAsync(const Model::CreateReservedInstancesListingRequest& request, const CreateReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateReservedInstancesListingCallable(const Model::CreateReservedInstancesListingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateReservedInstancesListingOutcomeCallable CreateReservedInstancesListingCallable(Model::CreateReservedInstancesListingRequest&& request) const;
+
+        /**
+         * Same as CreateReservedInstancesListingAsync(const Model::CreateReservedInstancesListingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateReservedInstancesListingAsync(Model::CreateReservedInstancesListingRequest&& request, const CreateReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a route in a route table within a VPC.</p> <p>You must specify one of
          * the following targets: Internet gateway or virtual private gateway, NAT
@@ -2733,6 +3192,18 @@ namespace Model
          */
         virtual void CreateRouteAsync(const Model::CreateRouteRequest& request, const CreateRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRouteCallable(const Model::CreateRouteRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateRouteOutcomeCallable CreateRouteCallable(Model::CreateRouteRequest&& request) const;
+
+        /**
+         * Same as CreateRouteAsync(const Model::CreateRouteRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateRouteAsync(Model::CreateRouteRequest&& request, const CreateRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a route table for the specified VPC. After you create a route table,
          * you can add routes and associate the table with a subnet.</p> <p>For more
@@ -2764,6 +3235,18 @@ namespace Model
          */
         virtual void CreateRouteTableAsync(const Model::CreateRouteTableRequest& request, const CreateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRouteTableCallable(const Model::CreateRouteTableRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateRouteTableOutcomeCallable CreateRouteTableCallable(Model::CreateRouteTableRequest&& request) const;
+
+        /**
+         * Same as CreateRouteTableAsync(const Model::CreateRouteTableRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateRouteTableAsync(Model::CreateRouteTableRequest&& request, const CreateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a security group.</p> <p>A security group is for use with instances
          * either in the EC2-Classic platform or in a specific VPC. For more information,
@@ -2846,6 +3329,18 @@ namespace Model
          */
         virtual void CreateSecurityGroupAsync(const Model::CreateSecurityGroupRequest& request, const CreateSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSecurityGroupCallable(const Model::CreateSecurityGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateSecurityGroupOutcomeCallable CreateSecurityGroupCallable(Model::CreateSecurityGroupRequest&& request) const;
+
+        /**
+         * Same as CreateSecurityGroupAsync(const Model::CreateSecurityGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateSecurityGroupAsync(Model::CreateSecurityGroupRequest&& request, const CreateSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a snapshot of an EBS volume and stores it in Amazon S3. You can use
          * snapshots for backups, to make copies of EBS volumes, and to save data before
@@ -2931,6 +3426,18 @@ namespace Model
          */
         virtual void CreateSnapshotAsync(const Model::CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSnapshotCallable(const Model::CreateSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateSnapshotOutcomeCallable CreateSnapshotCallable(Model::CreateSnapshotRequest&& request) const;
+
+        /**
+         * Same as CreateSnapshotAsync(const Model::CreateSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateSnapshotAsync(Model::CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a data feed for Spot instances, enabling you to view Spot instance
          * usage logs. You can create one data feed per AWS account. For more information,
@@ -2966,10 +3473,22 @@ namespace Model
         virtual void CreateSpotDatafeedSubscriptionAsync(const Model::CreateSpotDatafeedSubscriptionRequest& request, const CreateSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
         /**
-         * <p>Creates a subnet in an existing VPC.</p> <p>When you create each subnet, you
-         * provide the VPC ID and the CIDR block you want for the subnet. After you create
-         * a subnet, you can't change its CIDR block. The subnet's CIDR block can be the
-         * same as the VPC's CIDR block (assuming you want only a single subnet in the
+         * Same as CreateSpotDatafeedSubscriptionCallable(const Model::CreateSpotDatafeedSubscriptionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateSpotDatafeedSubscriptionOutcomeCallable CreateSpotDatafeedSubscriptionCallable(Model::CreateSpotDatafeedSubscriptionRequest&& request) const;
+
+        /**
+         * Same as CreateSpotDatafeedSubscriptionAsync(const Model::CreateSpotDatafeedSubscriptionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateSpotDatafeedSubscriptionAsync(Model::CreateSpotDatafeedSubscriptionRequest&& request, const CreateSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+        /**
+         * <p>Creates a subnet in an existing VPC.</p> <p>When you create each subnet, you
+         * provide the VPC ID and the CIDR block you want for the subnet. After you create
+         * a subnet, you can't change its CIDR block. The subnet's CIDR block can be the
+         * same as the VPC's CIDR block (assuming you want only a single subnet in the
          * VPC), or a subset of the VPC's CIDR block. If you create more than one subnet in
          * a VPC, the subnets' CIDR blocks must not overlap. The smallest subnet (and VPC)
          * you can create uses a /28 netmask (16 IP addresses), and the largest uses a /16
@@ -3038,6 +3557,18 @@ namespace Model
          */
         virtual void CreateSubnetAsync(const Model::CreateSubnetRequest& request, const CreateSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSubnetCallable(const Model::CreateSubnetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateSubnetOutcomeCallable CreateSubnetCallable(Model::CreateSubnetRequest&& request) const;
+
+        /**
+         * Same as CreateSubnetAsync(const Model::CreateSubnetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateSubnetAsync(Model::CreateSubnetRequest&& request, const CreateSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds or overwrites one or more tags for the specified Amazon EC2 resource or
          * resources. Each resource can have a maximum of 10 tags. Each tag consists of a
@@ -3087,6 +3618,18 @@ namespace Model
          */
         virtual void CreateTagsAsync(const Model::CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTagsCallable(const Model::CreateTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateTagsOutcomeCallable CreateTagsCallable(Model::CreateTagsRequest&& request) const;
+
+        /**
+         * Same as CreateTagsAsync(const Model::CreateTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateTagsAsync(Model::CreateTagsRequest&& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an EBS volume that can be attached to an instance in the same
          * Availability Zone. The volume is created in the regional endpoint that you send
@@ -3154,6 +3697,18 @@ namespace Model
          */
         virtual void CreateVolumeAsync(const Model::CreateVolumeRequest& request, const CreateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVolumeCallable(const Model::CreateVolumeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateVolumeOutcomeCallable CreateVolumeCallable(Model::CreateVolumeRequest&& request) const;
+
+        /**
+         * Same as CreateVolumeAsync(const Model::CreateVolumeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateVolumeAsync(Model::CreateVolumeRequest&& request, const CreateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a VPC with the specified CIDR block.</p> <p>The smallest VPC you can
          * create uses a /28 netmask (16 IP addresses), and the largest uses a /16 netmask
@@ -3215,6 +3770,18 @@ namespace Model
          */
         virtual void CreateVpcAsync(const Model::CreateVpcRequest& request, const CreateVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVpcCallable(const Model::CreateVpcRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateVpcOutcomeCallable CreateVpcCallable(Model::CreateVpcRequest&& request) const;
+
+        /**
+         * Same as CreateVpcAsync(const Model::CreateVpcRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateVpcAsync(Model::CreateVpcRequest&& request, const CreateVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a VPC endpoint for a specified AWS service. An endpoint enables you
          * to create a private connection between your VPC and another AWS service in your
@@ -3249,6 +3816,18 @@ namespace Model
          */
         virtual void CreateVpcEndpointAsync(const Model::CreateVpcEndpointRequest& request, const CreateVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVpcEndpointCallable(const Model::CreateVpcEndpointRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateVpcEndpointOutcomeCallable CreateVpcEndpointCallable(Model::CreateVpcEndpointRequest&& request) const;
+
+        /**
+         * Same as CreateVpcEndpointAsync(const Model::CreateVpcEndpointRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateVpcEndpointAsync(Model::CreateVpcEndpointRequest&& request, const CreateVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a VPC peering connection between two VPCs: a requester VPC that you
          * own and a peer VPC with which to create the connection. The peer VPC can belong
@@ -3292,6 +3871,18 @@ namespace Model
          */
         virtual void CreateVpcPeeringConnectionAsync(const Model::CreateVpcPeeringConnectionRequest& request, const CreateVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVpcPeeringConnectionCallable(const Model::CreateVpcPeeringConnectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateVpcPeeringConnectionOutcomeCallable CreateVpcPeeringConnectionCallable(Model::CreateVpcPeeringConnectionRequest&& request) const;
+
+        /**
+         * Same as CreateVpcPeeringConnectionAsync(const Model::CreateVpcPeeringConnectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateVpcPeeringConnectionAsync(Model::CreateVpcPeeringConnectionRequest&& request, const CreateVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a VPN connection between an existing virtual private gateway and a
          * VPN customer gateway. The only supported connection type is
@@ -3353,6 +3944,18 @@ namespace Model
          */
         virtual void CreateVpnConnectionAsync(const Model::CreateVpnConnectionRequest& request, const CreateVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVpnConnectionCallable(const Model::CreateVpnConnectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateVpnConnectionOutcomeCallable CreateVpnConnectionCallable(Model::CreateVpnConnectionRequest&& request) const;
+
+        /**
+         * Same as CreateVpnConnectionAsync(const Model::CreateVpnConnectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateVpnConnectionAsync(Model::CreateVpnConnectionRequest&& request, const CreateVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a static route associated with a VPN connection between an existing
          * virtual private gateway and a VPN customer gateway. The static route allows
@@ -3390,6 +3993,18 @@ namespace Model
          */
         virtual void CreateVpnConnectionRouteAsync(const Model::CreateVpnConnectionRouteRequest& request, const CreateVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVpnConnectionRouteCallable(const Model::CreateVpnConnectionRouteRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateVpnConnectionRouteOutcomeCallable CreateVpnConnectionRouteCallable(Model::CreateVpnConnectionRouteRequest&& request) const;
+
+        /**
+         * Same as CreateVpnConnectionRouteAsync(const Model::CreateVpnConnectionRouteRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateVpnConnectionRouteAsync(Model::CreateVpnConnectionRouteRequest&& request, const CreateVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a virtual private gateway. A virtual private gateway is the endpoint
          * on the VPC side of your VPN connection. You can create a virtual private gateway
@@ -3427,6 +4042,18 @@ namespace Model
          */
         virtual void CreateVpnGatewayAsync(const Model::CreateVpnGatewayRequest& request, const CreateVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVpnGatewayCallable(const Model::CreateVpnGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateVpnGatewayOutcomeCallable CreateVpnGatewayCallable(Model::CreateVpnGatewayRequest&& request) const;
+
+        /**
+         * Same as CreateVpnGatewayAsync(const Model::CreateVpnGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateVpnGatewayAsync(Model::CreateVpnGatewayRequest&& request, const CreateVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified customer gateway. You must delete the VPN connection
          * before you can delete the customer gateway.</p>
@@ -3449,6 +4076,18 @@ namespace Model
          */
         virtual void DeleteCustomerGatewayAsync(const Model::DeleteCustomerGatewayRequest& request, const DeleteCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCustomerGatewayCallable(const Model::DeleteCustomerGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteCustomerGatewayOutcomeCallable DeleteCustomerGatewayCallable(Model::DeleteCustomerGatewayRequest&& request) const;
+
+        /**
+         * Same as DeleteCustomerGatewayAsync(const Model::DeleteCustomerGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteCustomerGatewayAsync(Model::DeleteCustomerGatewayRequest&& request, const DeleteCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified set of DHCP options. You must disassociate the set of
          * DHCP options before you can delete it. You can disassociate the set of DHCP
@@ -3477,6 +4116,18 @@ namespace Model
          */
         virtual void DeleteDhcpOptionsAsync(const Model::DeleteDhcpOptionsRequest& request, const DeleteDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDhcpOptionsCallable(const Model::DeleteDhcpOptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDhcpOptionsOutcomeCallable DeleteDhcpOptionsCallable(Model::DeleteDhcpOptionsRequest&& request) const;
+
+        /**
+         * Same as DeleteDhcpOptionsAsync(const Model::DeleteDhcpOptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDhcpOptionsAsync(Model::DeleteDhcpOptionsRequest&& request, const DeleteDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes one or more flow logs.</p>
          */
@@ -3496,6 +4147,18 @@ namespace Model
          */
         virtual void DeleteFlowLogsAsync(const Model::DeleteFlowLogsRequest& request, const DeleteFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteFlowLogsCallable(const Model::DeleteFlowLogsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteFlowLogsOutcomeCallable DeleteFlowLogsCallable(Model::DeleteFlowLogsRequest&& request) const;
+
+        /**
+         * Same as DeleteFlowLogsAsync(const Model::DeleteFlowLogsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteFlowLogsAsync(Model::DeleteFlowLogsRequest&& request, const DeleteFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified Internet gateway. You must detach the Internet gateway
          * from the VPC before you can delete it.</p>
@@ -3518,6 +4181,18 @@ namespace Model
          */
         virtual void DeleteInternetGatewayAsync(const Model::DeleteInternetGatewayRequest& request, const DeleteInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteInternetGatewayCallable(const Model::DeleteInternetGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteInternetGatewayOutcomeCallable DeleteInternetGatewayCallable(Model::DeleteInternetGatewayRequest&& request) const;
+
+        /**
+         * Same as DeleteInternetGatewayAsync(const Model::DeleteInternetGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteInternetGatewayAsync(Model::DeleteInternetGatewayRequest&& request, const DeleteInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified key pair, by removing the public key from Amazon
          * EC2.</p>
@@ -3540,6 +4215,18 @@ namespace Model
          */
         virtual void DeleteKeyPairAsync(const Model::DeleteKeyPairRequest& request, const DeleteKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteKeyPairCallable(const Model::DeleteKeyPairRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteKeyPairOutcomeCallable DeleteKeyPairCallable(Model::DeleteKeyPairRequest&& request) const;
+
+        /**
+         * Same as DeleteKeyPairAsync(const Model::DeleteKeyPairRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteKeyPairAsync(Model::DeleteKeyPairRequest&& request, const DeleteKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified NAT gateway. Deleting a NAT gateway disassociates its
          * Elastic IP address, but does not release the address from your account. Deleting
@@ -3565,6 +4252,18 @@ namespace Model
          */
         virtual void DeleteNatGatewayAsync(const Model::DeleteNatGatewayRequest& request, const DeleteNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteNatGatewayCallable(const Model::DeleteNatGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteNatGatewayOutcomeCallable DeleteNatGatewayCallable(Model::DeleteNatGatewayRequest&& request) const;
+
+        /**
+         * Same as DeleteNatGatewayAsync(const Model::DeleteNatGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteNatGatewayAsync(Model::DeleteNatGatewayRequest&& request, const DeleteNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified network ACL. You can't delete the ACL if it's
          * associated with any subnets. You can't delete the default network ACL.</p>
@@ -3587,6 +4286,18 @@ namespace Model
          */
         virtual void DeleteNetworkAclAsync(const Model::DeleteNetworkAclRequest& request, const DeleteNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteNetworkAclCallable(const Model::DeleteNetworkAclRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteNetworkAclOutcomeCallable DeleteNetworkAclCallable(Model::DeleteNetworkAclRequest&& request) const;
+
+        /**
+         * Same as DeleteNetworkAclAsync(const Model::DeleteNetworkAclRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteNetworkAclAsync(Model::DeleteNetworkAclRequest&& request, const DeleteNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified ingress or egress entry (rule) from the specified
          * network ACL.</p>
@@ -3609,6 +4320,18 @@ namespace Model
          */
         virtual void DeleteNetworkAclEntryAsync(const Model::DeleteNetworkAclEntryRequest& request, const DeleteNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteNetworkAclEntryCallable(const Model::DeleteNetworkAclEntryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteNetworkAclEntryOutcomeCallable DeleteNetworkAclEntryCallable(Model::DeleteNetworkAclEntryRequest&& request) const;
+
+        /**
+         * Same as DeleteNetworkAclEntryAsync(const Model::DeleteNetworkAclEntryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteNetworkAclEntryAsync(Model::DeleteNetworkAclEntryRequest&& request, const DeleteNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified network interface. You must detach the network
          * interface before you can delete it.</p>
@@ -3631,6 +4354,18 @@ namespace Model
          */
         virtual void DeleteNetworkInterfaceAsync(const Model::DeleteNetworkInterfaceRequest& request, const DeleteNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteNetworkInterfaceCallable(const Model::DeleteNetworkInterfaceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteNetworkInterfaceOutcomeCallable DeleteNetworkInterfaceCallable(Model::DeleteNetworkInterfaceRequest&& request) const;
+
+        /**
+         * Same as DeleteNetworkInterfaceAsync(const Model::DeleteNetworkInterfaceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteNetworkInterfaceAsync(Model::DeleteNetworkInterfaceRequest&& request, const DeleteNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified placement group. You must terminate all instances in
          * the placement group before you can delete the placement group. For more
@@ -3662,6 +4397,18 @@ namespace Model
          */
         virtual void DeletePlacementGroupAsync(const Model::DeletePlacementGroupRequest& request, const DeletePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePlacementGroupCallable(const Model::DeletePlacementGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeletePlacementGroupOutcomeCallable DeletePlacementGroupCallable(Model::DeletePlacementGroupRequest&& request) const;
+
+        /**
+         * Same as DeletePlacementGroupAsync(const Model::DeletePlacementGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeletePlacementGroupAsync(Model::DeletePlacementGroupRequest&& request, const DeletePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified route from the specified route table.</p>
          */
@@ -3681,6 +4428,18 @@ namespace Model
          */
         virtual void DeleteRouteAsync(const Model::DeleteRouteRequest& request, const DeleteRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRouteCallable(const Model::DeleteRouteRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRouteOutcomeCallable DeleteRouteCallable(Model::DeleteRouteRequest&& request) const;
+
+        /**
+         * Same as DeleteRouteAsync(const Model::DeleteRouteRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRouteAsync(Model::DeleteRouteRequest&& request, const DeleteRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified route table. You must disassociate the route table from
          * any subnets before you can delete it. You can't delete the main route table.</p>
@@ -3703,6 +4462,18 @@ namespace Model
          */
         virtual void DeleteRouteTableAsync(const Model::DeleteRouteTableRequest& request, const DeleteRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRouteTableCallable(const Model::DeleteRouteTableRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRouteTableOutcomeCallable DeleteRouteTableCallable(Model::DeleteRouteTableRequest&& request) const;
+
+        /**
+         * Same as DeleteRouteTableAsync(const Model::DeleteRouteTableRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRouteTableAsync(Model::DeleteRouteTableRequest&& request, const DeleteRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a security group.</p> <p>If you attempt to delete a security group
          * that is associated with an instance, or is referenced by another security group,
@@ -3731,6 +4502,18 @@ namespace Model
          */
         virtual void DeleteSecurityGroupAsync(const Model::DeleteSecurityGroupRequest& request, const DeleteSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSecurityGroupCallable(const Model::DeleteSecurityGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteSecurityGroupOutcomeCallable DeleteSecurityGroupCallable(Model::DeleteSecurityGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteSecurityGroupAsync(const Model::DeleteSecurityGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteSecurityGroupAsync(Model::DeleteSecurityGroupRequest&& request, const DeleteSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified snapshot.</p> <p>When you make periodic snapshots of a
          * volume, the snapshots are incremental, and only the blocks on the device that
@@ -3783,6 +4566,18 @@ namespace Model
          */
         virtual void DeleteSnapshotAsync(const Model::DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSnapshotCallable(const Model::DeleteSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteSnapshotOutcomeCallable DeleteSnapshotCallable(Model::DeleteSnapshotRequest&& request) const;
+
+        /**
+         * Same as DeleteSnapshotAsync(const Model::DeleteSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteSnapshotAsync(Model::DeleteSnapshotRequest&& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the data feed for Spot instances.</p>
          */
@@ -3802,6 +4597,18 @@ namespace Model
          */
         virtual void DeleteSpotDatafeedSubscriptionAsync(const Model::DeleteSpotDatafeedSubscriptionRequest& request, const DeleteSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSpotDatafeedSubscriptionCallable(const Model::DeleteSpotDatafeedSubscriptionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteSpotDatafeedSubscriptionOutcomeCallable DeleteSpotDatafeedSubscriptionCallable(Model::DeleteSpotDatafeedSubscriptionRequest&& request) const;
+
+        /**
+         * Same as DeleteSpotDatafeedSubscriptionAsync(const Model::DeleteSpotDatafeedSubscriptionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteSpotDatafeedSubscriptionAsync(Model::DeleteSpotDatafeedSubscriptionRequest&& request, const DeleteSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified subnet. You must terminate all running instances in the
          * subnet before you can delete the subnet.</p>
@@ -3824,6 +4631,18 @@ namespace Model
          */
         virtual void DeleteSubnetAsync(const Model::DeleteSubnetRequest& request, const DeleteSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSubnetCallable(const Model::DeleteSubnetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteSubnetOutcomeCallable DeleteSubnetCallable(Model::DeleteSubnetRequest&& request) const;
+
+        /**
+         * Same as DeleteSubnetAsync(const Model::DeleteSubnetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteSubnetAsync(Model::DeleteSubnetRequest&& request, const DeleteSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified set of tags from the specified set of resources. This
          * call is designed to follow a <code>DescribeTags</code> request.</p> <p>For more
@@ -3855,6 +4674,18 @@ namespace Model
          */
         virtual void DeleteTagsAsync(const Model::DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTagsCallable(const Model::DeleteTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTagsOutcomeCallable DeleteTagsCallable(Model::DeleteTagsRequest&& request) const;
+
+        /**
+         * Same as DeleteTagsAsync(const Model::DeleteTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTagsAsync(Model::DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified EBS volume. The volume must be in the
          * <code>available</code> state (not attached to an instance).</p> <note> <p>The
@@ -3892,6 +4723,18 @@ namespace Model
          */
         virtual void DeleteVolumeAsync(const Model::DeleteVolumeRequest& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVolumeCallable(const Model::DeleteVolumeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteVolumeOutcomeCallable DeleteVolumeCallable(Model::DeleteVolumeRequest&& request) const;
+
+        /**
+         * Same as DeleteVolumeAsync(const Model::DeleteVolumeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteVolumeAsync(Model::DeleteVolumeRequest&& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified VPC. You must detach or delete all gateways and
          * resources that are associated with the VPC before you can delete it. For
@@ -3923,6 +4766,18 @@ namespace Model
          */
         virtual void DeleteVpcAsync(const Model::DeleteVpcRequest& request, const DeleteVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVpcCallable(const Model::DeleteVpcRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteVpcOutcomeCallable DeleteVpcCallable(Model::DeleteVpcRequest&& request) const;
+
+        /**
+         * Same as DeleteVpcAsync(const Model::DeleteVpcRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteVpcAsync(Model::DeleteVpcRequest&& request, const DeleteVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes one or more specified VPC endpoints. Deleting the endpoint also
          * deletes the endpoint routes in the route tables that were associated with the
@@ -3948,6 +4803,18 @@ namespace Model
          */
         virtual void DeleteVpcEndpointsAsync(const Model::DeleteVpcEndpointsRequest& request, const DeleteVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVpcEndpointsCallable(const Model::DeleteVpcEndpointsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteVpcEndpointsOutcomeCallable DeleteVpcEndpointsCallable(Model::DeleteVpcEndpointsRequest&& request) const;
+
+        /**
+         * Same as DeleteVpcEndpointsAsync(const Model::DeleteVpcEndpointsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteVpcEndpointsAsync(Model::DeleteVpcEndpointsRequest&& request, const DeleteVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a VPC peering connection. Either the owner of the requester VPC or
          * the owner of the peer VPC can delete the VPC peering connection if it's in the
@@ -3976,6 +4843,18 @@ namespace Model
          */
         virtual void DeleteVpcPeeringConnectionAsync(const Model::DeleteVpcPeeringConnectionRequest& request, const DeleteVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVpcPeeringConnectionCallable(const Model::DeleteVpcPeeringConnectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteVpcPeeringConnectionOutcomeCallable DeleteVpcPeeringConnectionCallable(Model::DeleteVpcPeeringConnectionRequest&& request) const;
+
+        /**
+         * Same as DeleteVpcPeeringConnectionAsync(const Model::DeleteVpcPeeringConnectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteVpcPeeringConnectionAsync(Model::DeleteVpcPeeringConnectionRequest&& request, const DeleteVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified VPN connection.</p> <p>If you're deleting the VPC and
          * its associated components, we recommend that you detach the virtual private
@@ -4016,6 +4895,18 @@ namespace Model
          */
         virtual void DeleteVpnConnectionAsync(const Model::DeleteVpnConnectionRequest& request, const DeleteVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVpnConnectionCallable(const Model::DeleteVpnConnectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteVpnConnectionOutcomeCallable DeleteVpnConnectionCallable(Model::DeleteVpnConnectionRequest&& request) const;
+
+        /**
+         * Same as DeleteVpnConnectionAsync(const Model::DeleteVpnConnectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteVpnConnectionAsync(Model::DeleteVpnConnectionRequest&& request, const DeleteVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified static route associated with a VPN connection between
          * an existing virtual private gateway and a VPN customer gateway. The static route
@@ -4044,6 +4935,18 @@ namespace Model
          */
         virtual void DeleteVpnConnectionRouteAsync(const Model::DeleteVpnConnectionRouteRequest& request, const DeleteVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVpnConnectionRouteCallable(const Model::DeleteVpnConnectionRouteRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteVpnConnectionRouteOutcomeCallable DeleteVpnConnectionRouteCallable(Model::DeleteVpnConnectionRouteRequest&& request) const;
+
+        /**
+         * Same as DeleteVpnConnectionRouteAsync(const Model::DeleteVpnConnectionRouteRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteVpnConnectionRouteAsync(Model::DeleteVpnConnectionRouteRequest&& request, const DeleteVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified virtual private gateway. We recommend that before you
          * delete a virtual private gateway, you detach it from the VPC and delete the VPN
@@ -4075,6 +4978,18 @@ namespace Model
          */
         virtual void DeleteVpnGatewayAsync(const Model::DeleteVpnGatewayRequest& request, const DeleteVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVpnGatewayCallable(const Model::DeleteVpnGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteVpnGatewayOutcomeCallable DeleteVpnGatewayCallable(Model::DeleteVpnGatewayRequest&& request) const;
+
+        /**
+         * Same as DeleteVpnGatewayAsync(const Model::DeleteVpnGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteVpnGatewayAsync(Model::DeleteVpnGatewayRequest&& request, const DeleteVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters the specified AMI. After you deregister an AMI, it can't be used
          * to launch new instances.</p> <p>This command does not delete the AMI.</p>
@@ -4097,6 +5012,18 @@ namespace Model
          */
         virtual void DeregisterImageAsync(const Model::DeregisterImageRequest& request, const DeregisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterImageCallable(const Model::DeregisterImageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeregisterImageOutcomeCallable DeregisterImageCallable(Model::DeregisterImageRequest&& request) const;
+
+        /**
+         * Same as DeregisterImageAsync(const Model::DeregisterImageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeregisterImageAsync(Model::DeregisterImageRequest&& request, const DeregisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes attributes of your AWS account. The following are the supported
          * account attributes:</p> <ul> <li> <p><code>supported-platforms</code>: Indicates
@@ -4152,6 +5079,18 @@ namespace Model
          */
         virtual void DescribeAccountAttributesAsync(const Model::DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAccountAttributesCallable(const Model::DescribeAccountAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAccountAttributesOutcomeCallable DescribeAccountAttributesCallable(Model::DescribeAccountAttributesRequest&& request) const;
+
+        /**
+         * Same as DescribeAccountAttributesAsync(const Model::DescribeAccountAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAccountAttributesAsync(Model::DescribeAccountAttributesRequest&& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your Elastic IP addresses.</p> <p>An Elastic IP
          * address is for use in either the EC2-Classic platform or in a VPC. For more
@@ -4183,6 +5122,18 @@ namespace Model
          */
         virtual void DescribeAddressesAsync(const Model::DescribeAddressesRequest& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAddressesCallable(const Model::DescribeAddressesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAddressesOutcomeCallable DescribeAddressesCallable(Model::DescribeAddressesRequest&& request) const;
+
+        /**
+         * Same as DescribeAddressesAsync(const Model::DescribeAddressesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAddressesAsync(Model::DescribeAddressesRequest&& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of the Availability Zones that are available to you.
          * The results include zones only for the region you're currently using. If there
@@ -4223,6 +5174,18 @@ namespace Model
          */
         virtual void DescribeAvailabilityZonesAsync(const Model::DescribeAvailabilityZonesRequest& request, const DescribeAvailabilityZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAvailabilityZonesCallable(const Model::DescribeAvailabilityZonesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAvailabilityZonesOutcomeCallable DescribeAvailabilityZonesCallable(Model::DescribeAvailabilityZonesRequest&& request) const;
+
+        /**
+         * Same as DescribeAvailabilityZonesAsync(const Model::DescribeAvailabilityZonesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAvailabilityZonesAsync(Model::DescribeAvailabilityZonesRequest&& request, const DescribeAvailabilityZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your bundling tasks.</p> <note><p>Completed bundle
          * tasks are listed for only a limited time. If your bundle task is no longer in
@@ -4254,6 +5217,18 @@ namespace Model
          */
         virtual void DescribeBundleTasksAsync(const Model::DescribeBundleTasksRequest& request, const DescribeBundleTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeBundleTasksCallable(const Model::DescribeBundleTasksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeBundleTasksOutcomeCallable DescribeBundleTasksCallable(Model::DescribeBundleTasksRequest&& request) const;
+
+        /**
+         * Same as DescribeBundleTasksAsync(const Model::DescribeBundleTasksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeBundleTasksAsync(Model::DescribeBundleTasksRequest&& request, const DescribeBundleTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your linked EC2-Classic instances. This request only
          * returns information about EC2-Classic instances linked to a VPC through
@@ -4282,6 +5257,18 @@ namespace Model
          */
         virtual void DescribeClassicLinkInstancesAsync(const Model::DescribeClassicLinkInstancesRequest& request, const DescribeClassicLinkInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClassicLinkInstancesCallable(const Model::DescribeClassicLinkInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeClassicLinkInstancesOutcomeCallable DescribeClassicLinkInstancesCallable(Model::DescribeClassicLinkInstancesRequest&& request) const;
+
+        /**
+         * Same as DescribeClassicLinkInstancesAsync(const Model::DescribeClassicLinkInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeClassicLinkInstancesAsync(Model::DescribeClassicLinkInstancesRequest&& request, const DescribeClassicLinkInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your conversion tasks. For more information, see <a
          * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/UploadingYourInstancesandVolumes.html">Using
@@ -4319,6 +5306,18 @@ namespace Model
          */
         virtual void DescribeConversionTasksAsync(const Model::DescribeConversionTasksRequest& request, const DescribeConversionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConversionTasksCallable(const Model::DescribeConversionTasksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeConversionTasksOutcomeCallable DescribeConversionTasksCallable(Model::DescribeConversionTasksRequest&& request) const;
+
+        /**
+         * Same as DescribeConversionTasksAsync(const Model::DescribeConversionTasksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeConversionTasksAsync(Model::DescribeConversionTasksRequest&& request, const DescribeConversionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your VPN customer gateways.</p> <p>For more
          * information about VPN customer gateways, see <a
@@ -4350,6 +5349,18 @@ namespace Model
          */
         virtual void DescribeCustomerGatewaysAsync(const Model::DescribeCustomerGatewaysRequest& request, const DescribeCustomerGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCustomerGatewaysCallable(const Model::DescribeCustomerGatewaysRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCustomerGatewaysOutcomeCallable DescribeCustomerGatewaysCallable(Model::DescribeCustomerGatewaysRequest&& request) const;
+
+        /**
+         * Same as DescribeCustomerGatewaysAsync(const Model::DescribeCustomerGatewaysRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCustomerGatewaysAsync(Model::DescribeCustomerGatewaysRequest&& request, const DescribeCustomerGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your DHCP options sets.</p> <p>For more information
          * about DHCP options sets, see <a
@@ -4378,6 +5389,18 @@ namespace Model
          */
         virtual void DescribeDhcpOptionsAsync(const Model::DescribeDhcpOptionsRequest& request, const DescribeDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDhcpOptionsCallable(const Model::DescribeDhcpOptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDhcpOptionsOutcomeCallable DescribeDhcpOptionsCallable(Model::DescribeDhcpOptionsRequest&& request) const;
+
+        /**
+         * Same as DescribeDhcpOptionsAsync(const Model::DescribeDhcpOptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDhcpOptionsAsync(Model::DescribeDhcpOptionsRequest&& request, const DescribeDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your export tasks.</p>
          */
@@ -4397,6 +5420,18 @@ namespace Model
          */
         virtual void DescribeExportTasksAsync(const Model::DescribeExportTasksRequest& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeExportTasksCallable(const Model::DescribeExportTasksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeExportTasksOutcomeCallable DescribeExportTasksCallable(Model::DescribeExportTasksRequest&& request) const;
+
+        /**
+         * Same as DescribeExportTasksAsync(const Model::DescribeExportTasksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeExportTasksAsync(Model::DescribeExportTasksRequest&& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more flow logs. To view the information in your flow logs
          * (the log streams for the network interfaces), you must use the CloudWatch Logs
@@ -4422,6 +5457,18 @@ namespace Model
          */
         virtual void DescribeFlowLogsAsync(const Model::DescribeFlowLogsRequest& request, const DescribeFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFlowLogsCallable(const Model::DescribeFlowLogsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeFlowLogsOutcomeCallable DescribeFlowLogsCallable(Model::DescribeFlowLogsRequest&& request) const;
+
+        /**
+         * Same as DescribeFlowLogsAsync(const Model::DescribeFlowLogsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeFlowLogsAsync(Model::DescribeFlowLogsRequest&& request, const DescribeFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your Dedicated hosts.</p> <p>The results describe
          * only the Dedicated hosts in the region you're currently using. All listed
@@ -4450,6 +5497,18 @@ namespace Model
          */
         virtual void DescribeHostsAsync(const Model::DescribeHostsRequest& request, const DescribeHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeHostsCallable(const Model::DescribeHostsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeHostsOutcomeCallable DescribeHostsCallable(Model::DescribeHostsRequest&& request) const;
+
+        /**
+         * Same as DescribeHostsAsync(const Model::DescribeHostsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeHostsAsync(Model::DescribeHostsRequest&& request, const DescribeHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the ID format settings for your resources on a per-region basis,
          * for example, to view which resource types are enabled for longer IDs. This
@@ -4505,6 +5564,18 @@ namespace Model
          */
         virtual void DescribeIdFormatAsync(const Model::DescribeIdFormatRequest& request, const DescribeIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeIdFormatCallable(const Model::DescribeIdFormatRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeIdFormatOutcomeCallable DescribeIdFormatCallable(Model::DescribeIdFormatRequest&& request) const;
+
+        /**
+         * Same as DescribeIdFormatAsync(const Model::DescribeIdFormatRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeIdFormatAsync(Model::DescribeIdFormatRequest&& request, const DescribeIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified attribute of the specified AMI. You can specify only
          * one attribute at a time.</p>
@@ -4527,6 +5598,18 @@ namespace Model
          */
         virtual void DescribeImageAttributeAsync(const Model::DescribeImageAttributeRequest& request, const DescribeImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeImageAttributeCallable(const Model::DescribeImageAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeImageAttributeOutcomeCallable DescribeImageAttributeCallable(Model::DescribeImageAttributeRequest&& request) const;
+
+        /**
+         * Same as DescribeImageAttributeAsync(const Model::DescribeImageAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeImageAttributeAsync(Model::DescribeImageAttributeRequest&& request, const DescribeImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of the images (AMIs, AKIs, and ARIs) available to you.
          * Images available to you include public images, private images that you own, and
@@ -4558,6 +5641,18 @@ namespace Model
          */
         virtual void DescribeImagesAsync(const Model::DescribeImagesRequest& request, const DescribeImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeImagesCallable(const Model::DescribeImagesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeImagesOutcomeCallable DescribeImagesCallable(Model::DescribeImagesRequest&& request) const;
+
+        /**
+         * Same as DescribeImagesAsync(const Model::DescribeImagesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeImagesAsync(Model::DescribeImagesRequest&& request, const DescribeImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Displays details about an import virtual machine or import snapshot tasks
          * that are already created.</p>
@@ -4580,6 +5675,18 @@ namespace Model
          */
         virtual void DescribeImportImageTasksAsync(const Model::DescribeImportImageTasksRequest& request, const DescribeImportImageTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeImportImageTasksCallable(const Model::DescribeImportImageTasksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeImportImageTasksOutcomeCallable DescribeImportImageTasksCallable(Model::DescribeImportImageTasksRequest&& request) const;
+
+        /**
+         * Same as DescribeImportImageTasksAsync(const Model::DescribeImportImageTasksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeImportImageTasksAsync(Model::DescribeImportImageTasksRequest&& request, const DescribeImportImageTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes your import snapshot tasks.</p>
          */
@@ -4599,6 +5706,18 @@ namespace Model
          */
         virtual void DescribeImportSnapshotTasksAsync(const Model::DescribeImportSnapshotTasksRequest& request, const DescribeImportSnapshotTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeImportSnapshotTasksCallable(const Model::DescribeImportSnapshotTasksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeImportSnapshotTasksOutcomeCallable DescribeImportSnapshotTasksCallable(Model::DescribeImportSnapshotTasksRequest&& request) const;
+
+        /**
+         * Same as DescribeImportSnapshotTasksAsync(const Model::DescribeImportSnapshotTasksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeImportSnapshotTasksAsync(Model::DescribeImportSnapshotTasksRequest&& request, const DescribeImportSnapshotTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified attribute of the specified instance. You can specify
          * only one attribute at a time. Valid attribute values are:
@@ -4639,6 +5758,18 @@ namespace Model
          */
         virtual void DescribeInstanceAttributeAsync(const Model::DescribeInstanceAttributeRequest& request, const DescribeInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInstanceAttributeCallable(const Model::DescribeInstanceAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeInstanceAttributeOutcomeCallable DescribeInstanceAttributeCallable(Model::DescribeInstanceAttributeRequest&& request) const;
+
+        /**
+         * Same as DescribeInstanceAttributeAsync(const Model::DescribeInstanceAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeInstanceAttributeAsync(Model::DescribeInstanceAttributeRequest&& request, const DescribeInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the status of one or more instances. By default, only running
          * instances are described, unless specified otherwise.</p> <p>Instance status
@@ -4718,6 +5849,18 @@ namespace Model
          */
         virtual void DescribeInstanceStatusAsync(const Model::DescribeInstanceStatusRequest& request, const DescribeInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInstanceStatusCallable(const Model::DescribeInstanceStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeInstanceStatusOutcomeCallable DescribeInstanceStatusCallable(Model::DescribeInstanceStatusRequest&& request) const;
+
+        /**
+         * Same as DescribeInstanceStatusAsync(const Model::DescribeInstanceStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeInstanceStatusAsync(Model::DescribeInstanceStatusRequest&& request, const DescribeInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your instances.</p> <p>If you specify one or more
          * instance IDs, Amazon EC2 returns information for those instances. If you do not
@@ -4755,6 +5898,18 @@ namespace Model
          */
         virtual void DescribeInstancesAsync(const Model::DescribeInstancesRequest& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInstancesCallable(const Model::DescribeInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeInstancesOutcomeCallable DescribeInstancesCallable(Model::DescribeInstancesRequest&& request) const;
+
+        /**
+         * Same as DescribeInstancesAsync(const Model::DescribeInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeInstancesAsync(Model::DescribeInstancesRequest&& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your Internet gateways.</p>
          */
@@ -4774,6 +5929,18 @@ namespace Model
          */
         virtual void DescribeInternetGatewaysAsync(const Model::DescribeInternetGatewaysRequest& request, const DescribeInternetGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInternetGatewaysCallable(const Model::DescribeInternetGatewaysRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeInternetGatewaysOutcomeCallable DescribeInternetGatewaysCallable(Model::DescribeInternetGatewaysRequest&& request) const;
+
+        /**
+         * Same as DescribeInternetGatewaysAsync(const Model::DescribeInternetGatewaysRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeInternetGatewaysAsync(Model::DescribeInternetGatewaysRequest&& request, const DescribeInternetGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your key pairs.</p> <p>For more information about
          * key pairs, see <a
@@ -4802,6 +5969,18 @@ namespace Model
          */
         virtual void DescribeKeyPairsAsync(const Model::DescribeKeyPairsRequest& request, const DescribeKeyPairsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeKeyPairsCallable(const Model::DescribeKeyPairsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeKeyPairsOutcomeCallable DescribeKeyPairsCallable(Model::DescribeKeyPairsRequest&& request) const;
+
+        /**
+         * Same as DescribeKeyPairsAsync(const Model::DescribeKeyPairsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeKeyPairsAsync(Model::DescribeKeyPairsRequest&& request, const DescribeKeyPairsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes your Elastic IP addresses that are being moved to the EC2-VPC
          * platform, or that are being restored to the EC2-Classic platform. This request
@@ -4830,6 +6009,18 @@ namespace Model
          */
         virtual void DescribeMovingAddressesAsync(const Model::DescribeMovingAddressesRequest& request, const DescribeMovingAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeMovingAddressesCallable(const Model::DescribeMovingAddressesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeMovingAddressesOutcomeCallable DescribeMovingAddressesCallable(Model::DescribeMovingAddressesRequest&& request) const;
+
+        /**
+         * Same as DescribeMovingAddressesAsync(const Model::DescribeMovingAddressesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeMovingAddressesAsync(Model::DescribeMovingAddressesRequest&& request, const DescribeMovingAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of the your NAT gateways.</p>
          */
@@ -4849,6 +6040,18 @@ namespace Model
          */
         virtual void DescribeNatGatewaysAsync(const Model::DescribeNatGatewaysRequest& request, const DescribeNatGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeNatGatewaysCallable(const Model::DescribeNatGatewaysRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeNatGatewaysOutcomeCallable DescribeNatGatewaysCallable(Model::DescribeNatGatewaysRequest&& request) const;
+
+        /**
+         * Same as DescribeNatGatewaysAsync(const Model::DescribeNatGatewaysRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeNatGatewaysAsync(Model::DescribeNatGatewaysRequest&& request, const DescribeNatGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your network ACLs.</p> <p>For more information about
          * network ACLs, see <a
@@ -4877,6 +6080,18 @@ namespace Model
          */
         virtual void DescribeNetworkAclsAsync(const Model::DescribeNetworkAclsRequest& request, const DescribeNetworkAclsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeNetworkAclsCallable(const Model::DescribeNetworkAclsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeNetworkAclsOutcomeCallable DescribeNetworkAclsCallable(Model::DescribeNetworkAclsRequest&& request) const;
+
+        /**
+         * Same as DescribeNetworkAclsAsync(const Model::DescribeNetworkAclsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeNetworkAclsAsync(Model::DescribeNetworkAclsRequest&& request, const DescribeNetworkAclsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes a network interface attribute. You can specify only one attribute
          * at a time.</p>
@@ -4899,6 +6114,18 @@ namespace Model
          */
         virtual void DescribeNetworkInterfaceAttributeAsync(const Model::DescribeNetworkInterfaceAttributeRequest& request, const DescribeNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeNetworkInterfaceAttributeCallable(const Model::DescribeNetworkInterfaceAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeNetworkInterfaceAttributeOutcomeCallable DescribeNetworkInterfaceAttributeCallable(Model::DescribeNetworkInterfaceAttributeRequest&& request) const;
+
+        /**
+         * Same as DescribeNetworkInterfaceAttributeAsync(const Model::DescribeNetworkInterfaceAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeNetworkInterfaceAttributeAsync(Model::DescribeNetworkInterfaceAttributeRequest&& request, const DescribeNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your network interfaces.</p>
          */
@@ -4918,6 +6145,18 @@ namespace Model
          */
         virtual void DescribeNetworkInterfacesAsync(const Model::DescribeNetworkInterfacesRequest& request, const DescribeNetworkInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeNetworkInterfacesCallable(const Model::DescribeNetworkInterfacesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeNetworkInterfacesOutcomeCallable DescribeNetworkInterfacesCallable(Model::DescribeNetworkInterfacesRequest&& request) const;
+
+        /**
+         * Same as DescribeNetworkInterfacesAsync(const Model::DescribeNetworkInterfacesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeNetworkInterfacesAsync(Model::DescribeNetworkInterfacesRequest&& request, const DescribeNetworkInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your placement groups. For more information about
          * placement groups and cluster instances, see <a
@@ -4946,6 +6185,18 @@ namespace Model
          */
         virtual void DescribePlacementGroupsAsync(const Model::DescribePlacementGroupsRequest& request, const DescribePlacementGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribePlacementGroupsCallable(const Model::DescribePlacementGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribePlacementGroupsOutcomeCallable DescribePlacementGroupsCallable(Model::DescribePlacementGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribePlacementGroupsAsync(const Model::DescribePlacementGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribePlacementGroupsAsync(Model::DescribePlacementGroupsRequest&& request, const DescribePlacementGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes available AWS services in a prefix list format, which includes the
          * prefix list name and prefix list ID of the service and the IP address range for
@@ -4977,6 +6228,18 @@ namespace Model
          */
         virtual void DescribePrefixListsAsync(const Model::DescribePrefixListsRequest& request, const DescribePrefixListsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribePrefixListsCallable(const Model::DescribePrefixListsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribePrefixListsOutcomeCallable DescribePrefixListsCallable(Model::DescribePrefixListsRequest&& request) const;
+
+        /**
+         * Same as DescribePrefixListsAsync(const Model::DescribePrefixListsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribePrefixListsAsync(Model::DescribePrefixListsRequest&& request, const DescribePrefixListsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more regions that are currently available to you.</p> <p>For
          * a list of the regions supported by Amazon EC2, see <a
@@ -5005,6 +6268,18 @@ namespace Model
          */
         virtual void DescribeRegionsAsync(const Model::DescribeRegionsRequest& request, const DescribeRegionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRegionsCallable(const Model::DescribeRegionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeRegionsOutcomeCallable DescribeRegionsCallable(Model::DescribeRegionsRequest&& request) const;
+
+        /**
+         * Same as DescribeRegionsAsync(const Model::DescribeRegionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeRegionsAsync(Model::DescribeRegionsRequest&& request, const DescribeRegionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of the Reserved Instances that you purchased.</p>
          * <p>For more information about Reserved Instances, see <a
@@ -5033,6 +6308,18 @@ namespace Model
          */
         virtual void DescribeReservedInstancesAsync(const Model::DescribeReservedInstancesRequest& request, const DescribeReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedInstancesCallable(const Model::DescribeReservedInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReservedInstancesOutcomeCallable DescribeReservedInstancesCallable(Model::DescribeReservedInstancesRequest&& request) const;
+
+        /**
+         * Same as DescribeReservedInstancesAsync(const Model::DescribeReservedInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReservedInstancesAsync(Model::DescribeReservedInstancesRequest&& request, const DescribeReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes your account's Reserved Instance listings in the Reserved Instance
          * Marketplace.</p> <p>The Reserved Instance Marketplace matches sellers who want
@@ -5100,6 +6387,18 @@ namespace Model
          */
         virtual void DescribeReservedInstancesListingsAsync(const Model::DescribeReservedInstancesListingsRequest& request, const DescribeReservedInstancesListingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedInstancesListingsCallable(const Model::DescribeReservedInstancesListingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReservedInstancesListingsOutcomeCallable DescribeReservedInstancesListingsCallable(Model::DescribeReservedInstancesListingsRequest&& request) const;
+
+        /**
+         * Same as DescribeReservedInstancesListingsAsync(const Model::DescribeReservedInstancesListingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReservedInstancesListingsAsync(Model::DescribeReservedInstancesListingsRequest&& request, const DescribeReservedInstancesListingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the modifications made to your Reserved Instances. If no parameter
          * is specified, information about all your Reserved Instances modification
@@ -5134,6 +6433,18 @@ namespace Model
          */
         virtual void DescribeReservedInstancesModificationsAsync(const Model::DescribeReservedInstancesModificationsRequest& request, const DescribeReservedInstancesModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedInstancesModificationsCallable(const Model::DescribeReservedInstancesModificationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReservedInstancesModificationsOutcomeCallable DescribeReservedInstancesModificationsCallable(Model::DescribeReservedInstancesModificationsRequest&& request) const;
+
+        /**
+         * Same as DescribeReservedInstancesModificationsAsync(const Model::DescribeReservedInstancesModificationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReservedInstancesModificationsAsync(Model::DescribeReservedInstancesModificationsRequest&& request, const DescribeReservedInstancesModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes Reserved Instance offerings that are available for purchase. With
          * Reserved Instances, you purchase the right to launch instances for a period of
@@ -5183,6 +6494,18 @@ namespace Model
          */
         virtual void DescribeReservedInstancesOfferingsAsync(const Model::DescribeReservedInstancesOfferingsRequest& request, const DescribeReservedInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedInstancesOfferingsCallable(const Model::DescribeReservedInstancesOfferingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReservedInstancesOfferingsOutcomeCallable DescribeReservedInstancesOfferingsCallable(Model::DescribeReservedInstancesOfferingsRequest&& request) const;
+
+        /**
+         * Same as DescribeReservedInstancesOfferingsAsync(const Model::DescribeReservedInstancesOfferingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReservedInstancesOfferingsAsync(Model::DescribeReservedInstancesOfferingsRequest&& request, const DescribeReservedInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your route tables. </p> <p>Each subnet in your VPC
          * must be associated with a route table. If a subnet is not explicitly associated
@@ -5220,6 +6543,18 @@ namespace Model
          */
         virtual void DescribeRouteTablesAsync(const Model::DescribeRouteTablesRequest& request, const DescribeRouteTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRouteTablesCallable(const Model::DescribeRouteTablesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeRouteTablesOutcomeCallable DescribeRouteTablesCallable(Model::DescribeRouteTablesRequest&& request) const;
+
+        /**
+         * Same as DescribeRouteTablesAsync(const Model::DescribeRouteTablesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeRouteTablesAsync(Model::DescribeRouteTablesRequest&& request, const DescribeRouteTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Finds available schedules that meet the specified criteria.</p> <p>You can
          * search for an available schedule no more than 3 months in advance. You must meet
@@ -5257,6 +6592,18 @@ namespace Model
          */
         virtual void DescribeScheduledInstanceAvailabilityAsync(const Model::DescribeScheduledInstanceAvailabilityRequest& request, const DescribeScheduledInstanceAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScheduledInstanceAvailabilityCallable(const Model::DescribeScheduledInstanceAvailabilityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeScheduledInstanceAvailabilityOutcomeCallable DescribeScheduledInstanceAvailabilityCallable(Model::DescribeScheduledInstanceAvailabilityRequest&& request) const;
+
+        /**
+         * Same as DescribeScheduledInstanceAvailabilityAsync(const Model::DescribeScheduledInstanceAvailabilityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeScheduledInstanceAvailabilityAsync(Model::DescribeScheduledInstanceAvailabilityRequest&& request, const DescribeScheduledInstanceAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your Scheduled Instances.</p>
          */
@@ -5276,6 +6623,18 @@ namespace Model
          */
         virtual void DescribeScheduledInstancesAsync(const Model::DescribeScheduledInstancesRequest& request, const DescribeScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScheduledInstancesCallable(const Model::DescribeScheduledInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeScheduledInstancesOutcomeCallable DescribeScheduledInstancesCallable(Model::DescribeScheduledInstancesRequest&& request) const;
+
+        /**
+         * Same as DescribeScheduledInstancesAsync(const Model::DescribeScheduledInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeScheduledInstancesAsync(Model::DescribeScheduledInstancesRequest&& request, const DescribeScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>[EC2-VPC only] Describes the VPCs on the other side of a VPC peering
          * connection that are referencing the security groups you've specified in this
@@ -5301,6 +6660,18 @@ namespace Model
          */
         virtual void DescribeSecurityGroupReferencesAsync(const Model::DescribeSecurityGroupReferencesRequest& request, const DescribeSecurityGroupReferencesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSecurityGroupReferencesCallable(const Model::DescribeSecurityGroupReferencesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSecurityGroupReferencesOutcomeCallable DescribeSecurityGroupReferencesCallable(Model::DescribeSecurityGroupReferencesRequest&& request) const;
+
+        /**
+         * Same as DescribeSecurityGroupReferencesAsync(const Model::DescribeSecurityGroupReferencesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSecurityGroupReferencesAsync(Model::DescribeSecurityGroupReferencesRequest&& request, const DescribeSecurityGroupReferencesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your security groups.</p> <p>A security group is for
          * use with instances either in the EC2-Classic platform or in a specific VPC. For
@@ -5344,6 +6715,18 @@ namespace Model
          */
         virtual void DescribeSecurityGroupsAsync(const Model::DescribeSecurityGroupsRequest& request, const DescribeSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSecurityGroupsCallable(const Model::DescribeSecurityGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSecurityGroupsOutcomeCallable DescribeSecurityGroupsCallable(Model::DescribeSecurityGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeSecurityGroupsAsync(const Model::DescribeSecurityGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSecurityGroupsAsync(Model::DescribeSecurityGroupsRequest&& request, const DescribeSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified attribute of the specified snapshot. You can specify
          * only one attribute at a time.</p> <p>For more information about EBS snapshots,
@@ -5375,6 +6758,18 @@ namespace Model
          */
         virtual void DescribeSnapshotAttributeAsync(const Model::DescribeSnapshotAttributeRequest& request, const DescribeSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSnapshotAttributeCallable(const Model::DescribeSnapshotAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSnapshotAttributeOutcomeCallable DescribeSnapshotAttributeCallable(Model::DescribeSnapshotAttributeRequest&& request) const;
+
+        /**
+         * Same as DescribeSnapshotAttributeAsync(const Model::DescribeSnapshotAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSnapshotAttributeAsync(Model::DescribeSnapshotAttributeRequest&& request, const DescribeSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of the EBS snapshots available to you. Available
          * snapshots include public snapshots available for any AWS account to launch,
@@ -5496,6 +6891,18 @@ namespace Model
          */
         virtual void DescribeSnapshotsAsync(const Model::DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSnapshotsCallable(const Model::DescribeSnapshotsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSnapshotsOutcomeCallable DescribeSnapshotsCallable(Model::DescribeSnapshotsRequest&& request) const;
+
+        /**
+         * Same as DescribeSnapshotsAsync(const Model::DescribeSnapshotsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSnapshotsAsync(Model::DescribeSnapshotsRequest&& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the data feed for Spot instances. For more information, see <a
          * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/spot-data-feeds.html">Spot
@@ -5524,6 +6931,18 @@ namespace Model
          */
         virtual void DescribeSpotDatafeedSubscriptionAsync(const Model::DescribeSpotDatafeedSubscriptionRequest& request, const DescribeSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSpotDatafeedSubscriptionCallable(const Model::DescribeSpotDatafeedSubscriptionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSpotDatafeedSubscriptionOutcomeCallable DescribeSpotDatafeedSubscriptionCallable(Model::DescribeSpotDatafeedSubscriptionRequest&& request) const;
+
+        /**
+         * Same as DescribeSpotDatafeedSubscriptionAsync(const Model::DescribeSpotDatafeedSubscriptionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSpotDatafeedSubscriptionAsync(Model::DescribeSpotDatafeedSubscriptionRequest&& request, const DescribeSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the running instances for the specified Spot fleet.</p>
          */
@@ -5543,6 +6962,18 @@ namespace Model
          */
         virtual void DescribeSpotFleetInstancesAsync(const Model::DescribeSpotFleetInstancesRequest& request, const DescribeSpotFleetInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSpotFleetInstancesCallable(const Model::DescribeSpotFleetInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSpotFleetInstancesOutcomeCallable DescribeSpotFleetInstancesCallable(Model::DescribeSpotFleetInstancesRequest&& request) const;
+
+        /**
+         * Same as DescribeSpotFleetInstancesAsync(const Model::DescribeSpotFleetInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSpotFleetInstancesAsync(Model::DescribeSpotFleetInstancesRequest&& request, const DescribeSpotFleetInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the events for the specified Spot fleet request during the
          * specified time.</p> <p>Spot fleet events are delayed by up to 30 seconds before
@@ -5571,6 +7002,18 @@ namespace Model
          */
         virtual void DescribeSpotFleetRequestHistoryAsync(const Model::DescribeSpotFleetRequestHistoryRequest& request, const DescribeSpotFleetRequestHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSpotFleetRequestHistoryCallable(const Model::DescribeSpotFleetRequestHistoryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSpotFleetRequestHistoryOutcomeCallable DescribeSpotFleetRequestHistoryCallable(Model::DescribeSpotFleetRequestHistoryRequest&& request) const;
+
+        /**
+         * Same as DescribeSpotFleetRequestHistoryAsync(const Model::DescribeSpotFleetRequestHistoryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSpotFleetRequestHistoryAsync(Model::DescribeSpotFleetRequestHistoryRequest&& request, const DescribeSpotFleetRequestHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes your Spot fleet requests.</p>
          */
@@ -5590,6 +7033,18 @@ namespace Model
          */
         virtual void DescribeSpotFleetRequestsAsync(const Model::DescribeSpotFleetRequestsRequest& request, const DescribeSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSpotFleetRequestsCallable(const Model::DescribeSpotFleetRequestsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSpotFleetRequestsOutcomeCallable DescribeSpotFleetRequestsCallable(Model::DescribeSpotFleetRequestsRequest&& request) const;
+
+        /**
+         * Same as DescribeSpotFleetRequestsAsync(const Model::DescribeSpotFleetRequestsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSpotFleetRequestsAsync(Model::DescribeSpotFleetRequestsRequest&& request, const DescribeSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the Spot instance requests that belong to your account. Spot
          * instances are instances that Amazon EC2 launches when the bid price that you
@@ -5645,6 +7100,18 @@ namespace Model
          */
         virtual void DescribeSpotInstanceRequestsAsync(const Model::DescribeSpotInstanceRequestsRequest& request, const DescribeSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSpotInstanceRequestsCallable(const Model::DescribeSpotInstanceRequestsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSpotInstanceRequestsOutcomeCallable DescribeSpotInstanceRequestsCallable(Model::DescribeSpotInstanceRequestsRequest&& request) const;
+
+        /**
+         * Same as DescribeSpotInstanceRequestsAsync(const Model::DescribeSpotInstanceRequestsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSpotInstanceRequestsAsync(Model::DescribeSpotInstanceRequestsRequest&& request, const DescribeSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the Spot price history. The prices returned are listed in
          * chronological order, from the oldest to the most recent, for up to the past 90
@@ -5691,6 +7158,18 @@ namespace Model
          */
         virtual void DescribeSpotPriceHistoryAsync(const Model::DescribeSpotPriceHistoryRequest& request, const DescribeSpotPriceHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSpotPriceHistoryCallable(const Model::DescribeSpotPriceHistoryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSpotPriceHistoryOutcomeCallable DescribeSpotPriceHistoryCallable(Model::DescribeSpotPriceHistoryRequest&& request) const;
+
+        /**
+         * Same as DescribeSpotPriceHistoryAsync(const Model::DescribeSpotPriceHistoryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSpotPriceHistoryAsync(Model::DescribeSpotPriceHistoryRequest&& request, const DescribeSpotPriceHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>[EC2-VPC only] Describes the stale security group rules for security groups
          * in a specified VPC. Rules are stale when they reference a deleted security group
@@ -5719,6 +7198,18 @@ namespace Model
          */
         virtual void DescribeStaleSecurityGroupsAsync(const Model::DescribeStaleSecurityGroupsRequest& request, const DescribeStaleSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStaleSecurityGroupsCallable(const Model::DescribeStaleSecurityGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeStaleSecurityGroupsOutcomeCallable DescribeStaleSecurityGroupsCallable(Model::DescribeStaleSecurityGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeStaleSecurityGroupsAsync(const Model::DescribeStaleSecurityGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeStaleSecurityGroupsAsync(Model::DescribeStaleSecurityGroupsRequest&& request, const DescribeStaleSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your subnets.</p> <p>For more information about
          * subnets, see <a
@@ -5747,6 +7238,18 @@ namespace Model
          */
         virtual void DescribeSubnetsAsync(const Model::DescribeSubnetsRequest& request, const DescribeSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSubnetsCallable(const Model::DescribeSubnetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSubnetsOutcomeCallable DescribeSubnetsCallable(Model::DescribeSubnetsRequest&& request) const;
+
+        /**
+         * Same as DescribeSubnetsAsync(const Model::DescribeSubnetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSubnetsAsync(Model::DescribeSubnetsRequest&& request, const DescribeSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of the tags for your EC2 resources.</p> <p>For more
          * information about tags, see <a
@@ -5775,6 +7278,18 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTagsCallable(const Model::DescribeTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(Model::DescribeTagsRequest&& request) const;
+
+        /**
+         * Same as DescribeTagsAsync(const Model::DescribeTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTagsAsync(Model::DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified attribute of the specified volume. You can specify
          * only one attribute at a time.</p> <p>For more information about EBS volumes, see
@@ -5807,10 +7322,22 @@ namespace Model
         virtual void DescribeVolumeAttributeAsync(const Model::DescribeVolumeAttributeRequest& request, const DescribeVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
         /**
-         * <p>Describes the status of the specified volumes. Volume status provides the
-         * result of the checks performed on your volumes to determine events that can
-         * impair the performance of your volumes. The performance of a volume can be
-         * affected if an issue occurs on the volume's underlying host. If the volume's
+         * Same as DescribeVolumeAttributeCallable(const Model::DescribeVolumeAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVolumeAttributeOutcomeCallable DescribeVolumeAttributeCallable(Model::DescribeVolumeAttributeRequest&& request) const;
+
+        /**
+         * Same as DescribeVolumeAttributeAsync(const Model::DescribeVolumeAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVolumeAttributeAsync(Model::DescribeVolumeAttributeRequest&& request, const DescribeVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+        /**
+         * <p>Describes the status of the specified volumes. Volume status provides the
+         * result of the checks performed on your volumes to determine events that can
+         * impair the performance of your volumes. The performance of a volume can be
+         * affected if an issue occurs on the volume's underlying host. If the volume's
          * underlying host experiences a power outage or system issue, after the system is
          * restored, there could be data inconsistencies on the volume. Volume events
          * notify you if this occurs. Volume actions notify you if any action needs to be
@@ -5918,6 +7445,18 @@ namespace Model
          */
         virtual void DescribeVolumeStatusAsync(const Model::DescribeVolumeStatusRequest& request, const DescribeVolumeStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVolumeStatusCallable(const Model::DescribeVolumeStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVolumeStatusOutcomeCallable DescribeVolumeStatusCallable(Model::DescribeVolumeStatusRequest&& request) const;
+
+        /**
+         * Same as DescribeVolumeStatusAsync(const Model::DescribeVolumeStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVolumeStatusAsync(Model::DescribeVolumeStatusRequest&& request, const DescribeVolumeStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified EBS volumes.</p> <p>If you are describing a long list
          * of volumes, you can paginate the output to make the list more manageable. The
@@ -5964,6 +7503,18 @@ namespace Model
          */
         virtual void DescribeVolumesAsync(const Model::DescribeVolumesRequest& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVolumesCallable(const Model::DescribeVolumesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVolumesOutcomeCallable DescribeVolumesCallable(Model::DescribeVolumesRequest&& request) const;
+
+        /**
+         * Same as DescribeVolumesAsync(const Model::DescribeVolumesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVolumesAsync(Model::DescribeVolumesRequest&& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified attribute of the specified VPC. You can specify only
          * one attribute at a time.</p>
@@ -5986,6 +7537,18 @@ namespace Model
          */
         virtual void DescribeVpcAttributeAsync(const Model::DescribeVpcAttributeRequest& request, const DescribeVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpcAttributeCallable(const Model::DescribeVpcAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVpcAttributeOutcomeCallable DescribeVpcAttributeCallable(Model::DescribeVpcAttributeRequest&& request) const;
+
+        /**
+         * Same as DescribeVpcAttributeAsync(const Model::DescribeVpcAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVpcAttributeAsync(Model::DescribeVpcAttributeRequest&& request, const DescribeVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the ClassicLink status of one or more VPCs. </p>
          */
@@ -6005,6 +7568,18 @@ namespace Model
          */
         virtual void DescribeVpcClassicLinkAsync(const Model::DescribeVpcClassicLinkRequest& request, const DescribeVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpcClassicLinkCallable(const Model::DescribeVpcClassicLinkRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVpcClassicLinkOutcomeCallable DescribeVpcClassicLinkCallable(Model::DescribeVpcClassicLinkRequest&& request) const;
+
+        /**
+         * Same as DescribeVpcClassicLinkAsync(const Model::DescribeVpcClassicLinkRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVpcClassicLinkAsync(Model::DescribeVpcClassicLinkRequest&& request, const DescribeVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the ClassicLink DNS support status of one or more VPCs. If enabled,
          * the DNS hostname of a linked EC2-Classic instance resolves to its private IP
@@ -6045,6 +7620,18 @@ namespace Model
          */
         virtual void DescribeVpcClassicLinkDnsSupportAsync(const Model::DescribeVpcClassicLinkDnsSupportRequest& request, const DescribeVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpcClassicLinkDnsSupportCallable(const Model::DescribeVpcClassicLinkDnsSupportRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVpcClassicLinkDnsSupportOutcomeCallable DescribeVpcClassicLinkDnsSupportCallable(Model::DescribeVpcClassicLinkDnsSupportRequest&& request) const;
+
+        /**
+         * Same as DescribeVpcClassicLinkDnsSupportAsync(const Model::DescribeVpcClassicLinkDnsSupportRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVpcClassicLinkDnsSupportAsync(Model::DescribeVpcClassicLinkDnsSupportRequest&& request, const DescribeVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes all supported AWS services that can be specified when creating a
          * VPC endpoint.</p>
@@ -6067,6 +7654,18 @@ namespace Model
          */
         virtual void DescribeVpcEndpointServicesAsync(const Model::DescribeVpcEndpointServicesRequest& request, const DescribeVpcEndpointServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpcEndpointServicesCallable(const Model::DescribeVpcEndpointServicesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVpcEndpointServicesOutcomeCallable DescribeVpcEndpointServicesCallable(Model::DescribeVpcEndpointServicesRequest&& request) const;
+
+        /**
+         * Same as DescribeVpcEndpointServicesAsync(const Model::DescribeVpcEndpointServicesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVpcEndpointServicesAsync(Model::DescribeVpcEndpointServicesRequest&& request, const DescribeVpcEndpointServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your VPC endpoints.</p>
          */
@@ -6086,6 +7685,18 @@ namespace Model
          */
         virtual void DescribeVpcEndpointsAsync(const Model::DescribeVpcEndpointsRequest& request, const DescribeVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpcEndpointsCallable(const Model::DescribeVpcEndpointsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVpcEndpointsOutcomeCallable DescribeVpcEndpointsCallable(Model::DescribeVpcEndpointsRequest&& request) const;
+
+        /**
+         * Same as DescribeVpcEndpointsAsync(const Model::DescribeVpcEndpointsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVpcEndpointsAsync(Model::DescribeVpcEndpointsRequest&& request, const DescribeVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your VPC peering connections.</p>
          */
@@ -6105,6 +7716,18 @@ namespace Model
          */
         virtual void DescribeVpcPeeringConnectionsAsync(const Model::DescribeVpcPeeringConnectionsRequest& request, const DescribeVpcPeeringConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpcPeeringConnectionsCallable(const Model::DescribeVpcPeeringConnectionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVpcPeeringConnectionsOutcomeCallable DescribeVpcPeeringConnectionsCallable(Model::DescribeVpcPeeringConnectionsRequest&& request) const;
+
+        /**
+         * Same as DescribeVpcPeeringConnectionsAsync(const Model::DescribeVpcPeeringConnectionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVpcPeeringConnectionsAsync(Model::DescribeVpcPeeringConnectionsRequest&& request, const DescribeVpcPeeringConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your VPCs.</p>
          */
@@ -6124,6 +7747,18 @@ namespace Model
          */
         virtual void DescribeVpcsAsync(const Model::DescribeVpcsRequest& request, const DescribeVpcsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpcsCallable(const Model::DescribeVpcsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVpcsOutcomeCallable DescribeVpcsCallable(Model::DescribeVpcsRequest&& request) const;
+
+        /**
+         * Same as DescribeVpcsAsync(const Model::DescribeVpcsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVpcsAsync(Model::DescribeVpcsRequest&& request, const DescribeVpcsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your VPN connections.</p> <p>For more information
          * about VPN connections, see <a
@@ -6155,6 +7790,18 @@ namespace Model
          */
         virtual void DescribeVpnConnectionsAsync(const Model::DescribeVpnConnectionsRequest& request, const DescribeVpnConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpnConnectionsCallable(const Model::DescribeVpnConnectionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVpnConnectionsOutcomeCallable DescribeVpnConnectionsCallable(Model::DescribeVpnConnectionsRequest&& request) const;
+
+        /**
+         * Same as DescribeVpnConnectionsAsync(const Model::DescribeVpnConnectionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVpnConnectionsAsync(Model::DescribeVpnConnectionsRequest&& request, const DescribeVpnConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your virtual private gateways.</p> <p>For more
          * information about virtual private gateways, see <a
@@ -6186,6 +7833,18 @@ namespace Model
          */
         virtual void DescribeVpnGatewaysAsync(const Model::DescribeVpnGatewaysRequest& request, const DescribeVpnGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpnGatewaysCallable(const Model::DescribeVpnGatewaysRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVpnGatewaysOutcomeCallable DescribeVpnGatewaysCallable(Model::DescribeVpnGatewaysRequest&& request) const;
+
+        /**
+         * Same as DescribeVpnGatewaysAsync(const Model::DescribeVpnGatewaysRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVpnGatewaysAsync(Model::DescribeVpnGatewaysRequest&& request, const DescribeVpnGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Unlinks (detaches) a linked EC2-Classic instance from a VPC. After the
          * instance has been unlinked, the VPC security groups are no longer associated
@@ -6211,6 +7870,18 @@ namespace Model
          */
         virtual void DetachClassicLinkVpcAsync(const Model::DetachClassicLinkVpcRequest& request, const DetachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachClassicLinkVpcCallable(const Model::DetachClassicLinkVpcRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachClassicLinkVpcOutcomeCallable DetachClassicLinkVpcCallable(Model::DetachClassicLinkVpcRequest&& request) const;
+
+        /**
+         * Same as DetachClassicLinkVpcAsync(const Model::DetachClassicLinkVpcRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachClassicLinkVpcAsync(Model::DetachClassicLinkVpcRequest&& request, const DetachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches an Internet gateway from a VPC, disabling connectivity between the
          * Internet and the VPC. The VPC must not contain any running instances with
@@ -6236,6 +7907,18 @@ namespace Model
          */
         virtual void DetachInternetGatewayAsync(const Model::DetachInternetGatewayRequest& request, const DetachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachInternetGatewayCallable(const Model::DetachInternetGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachInternetGatewayOutcomeCallable DetachInternetGatewayCallable(Model::DetachInternetGatewayRequest&& request) const;
+
+        /**
+         * Same as DetachInternetGatewayAsync(const Model::DetachInternetGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachInternetGatewayAsync(Model::DetachInternetGatewayRequest&& request, const DetachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches a network interface from an instance.</p>
          */
@@ -6255,6 +7938,18 @@ namespace Model
          */
         virtual void DetachNetworkInterfaceAsync(const Model::DetachNetworkInterfaceRequest& request, const DetachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachNetworkInterfaceCallable(const Model::DetachNetworkInterfaceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachNetworkInterfaceOutcomeCallable DetachNetworkInterfaceCallable(Model::DetachNetworkInterfaceRequest&& request) const;
+
+        /**
+         * Same as DetachNetworkInterfaceAsync(const Model::DetachNetworkInterfaceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachNetworkInterfaceAsync(Model::DetachNetworkInterfaceRequest&& request, const DetachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches an EBS volume from an instance. Make sure to unmount any file
          * systems on the device within your operating system before detaching the volume.
@@ -6304,6 +7999,18 @@ namespace Model
          */
         virtual void DetachVolumeAsync(const Model::DetachVolumeRequest& request, const DetachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachVolumeCallable(const Model::DetachVolumeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachVolumeOutcomeCallable DetachVolumeCallable(Model::DetachVolumeRequest&& request) const;
+
+        /**
+         * Same as DetachVolumeAsync(const Model::DetachVolumeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachVolumeAsync(Model::DetachVolumeRequest&& request, const DetachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches a virtual private gateway from a VPC. You do this if you're planning
          * to turn off the VPC and not use it anymore. You can confirm a virtual private
@@ -6341,6 +8048,18 @@ namespace Model
          */
         virtual void DetachVpnGatewayAsync(const Model::DetachVpnGatewayRequest& request, const DetachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachVpnGatewayCallable(const Model::DetachVpnGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachVpnGatewayOutcomeCallable DetachVpnGatewayCallable(Model::DetachVpnGatewayRequest&& request) const;
+
+        /**
+         * Same as DetachVpnGatewayAsync(const Model::DetachVpnGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachVpnGatewayAsync(Model::DetachVpnGatewayRequest&& request, const DetachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables a virtual private gateway (VGW) from propagating routes to a
          * specified route table of a VPC.</p>
@@ -6363,6 +8082,18 @@ namespace Model
          */
         virtual void DisableVgwRoutePropagationAsync(const Model::DisableVgwRoutePropagationRequest& request, const DisableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableVgwRoutePropagationCallable(const Model::DisableVgwRoutePropagationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableVgwRoutePropagationOutcomeCallable DisableVgwRoutePropagationCallable(Model::DisableVgwRoutePropagationRequest&& request) const;
+
+        /**
+         * Same as DisableVgwRoutePropagationAsync(const Model::DisableVgwRoutePropagationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableVgwRoutePropagationAsync(Model::DisableVgwRoutePropagationRequest&& request, const DisableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables ClassicLink for a VPC. You cannot disable ClassicLink for a VPC that
          * has EC2-Classic instances linked to it.</p>
@@ -6385,6 +8116,18 @@ namespace Model
          */
         virtual void DisableVpcClassicLinkAsync(const Model::DisableVpcClassicLinkRequest& request, const DisableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableVpcClassicLinkCallable(const Model::DisableVpcClassicLinkRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableVpcClassicLinkOutcomeCallable DisableVpcClassicLinkCallable(Model::DisableVpcClassicLinkRequest&& request) const;
+
+        /**
+         * Same as DisableVpcClassicLinkAsync(const Model::DisableVpcClassicLinkRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableVpcClassicLinkAsync(Model::DisableVpcClassicLinkRequest&& request, const DisableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables ClassicLink DNS support for a VPC. If disabled, DNS hostnames
          * resolve to public IP addresses when addressed between a linked EC2-Classic
@@ -6419,6 +8162,18 @@ namespace Model
          */
         virtual void DisableVpcClassicLinkDnsSupportAsync(const Model::DisableVpcClassicLinkDnsSupportRequest& request, const DisableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableVpcClassicLinkDnsSupportCallable(const Model::DisableVpcClassicLinkDnsSupportRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableVpcClassicLinkDnsSupportOutcomeCallable DisableVpcClassicLinkDnsSupportCallable(Model::DisableVpcClassicLinkDnsSupportRequest&& request) const;
+
+        /**
+         * Same as DisableVpcClassicLinkDnsSupportAsync(const Model::DisableVpcClassicLinkDnsSupportRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableVpcClassicLinkDnsSupportAsync(Model::DisableVpcClassicLinkDnsSupportRequest&& request, const DisableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disassociates an Elastic IP address from the instance or network interface
          * it's associated with.</p> <p>An Elastic IP address is for use in either the
@@ -6456,6 +8211,18 @@ namespace Model
          */
         virtual void DisassociateAddressAsync(const Model::DisassociateAddressRequest& request, const DisassociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisassociateAddressCallable(const Model::DisassociateAddressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisassociateAddressOutcomeCallable DisassociateAddressCallable(Model::DisassociateAddressRequest&& request) const;
+
+        /**
+         * Same as DisassociateAddressAsync(const Model::DisassociateAddressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisassociateAddressAsync(Model::DisassociateAddressRequest&& request, const DisassociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disassociates a subnet from a route table.</p> <p>After you perform this
          * action, the subnet no longer uses the routes in the route table. Instead, it
@@ -6490,6 +8257,18 @@ namespace Model
          */
         virtual void DisassociateRouteTableAsync(const Model::DisassociateRouteTableRequest& request, const DisassociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisassociateRouteTableCallable(const Model::DisassociateRouteTableRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisassociateRouteTableOutcomeCallable DisassociateRouteTableCallable(Model::DisassociateRouteTableRequest&& request) const;
+
+        /**
+         * Same as DisassociateRouteTableAsync(const Model::DisassociateRouteTableRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisassociateRouteTableAsync(Model::DisassociateRouteTableRequest&& request, const DisassociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables a virtual private gateway (VGW) to propagate routes to the specified
          * route table of a VPC.</p>
@@ -6512,6 +8291,18 @@ namespace Model
          */
         virtual void EnableVgwRoutePropagationAsync(const Model::EnableVgwRoutePropagationRequest& request, const EnableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableVgwRoutePropagationCallable(const Model::EnableVgwRoutePropagationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableVgwRoutePropagationOutcomeCallable EnableVgwRoutePropagationCallable(Model::EnableVgwRoutePropagationRequest&& request) const;
+
+        /**
+         * Same as EnableVgwRoutePropagationAsync(const Model::EnableVgwRoutePropagationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableVgwRoutePropagationAsync(Model::EnableVgwRoutePropagationRequest&& request, const EnableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables I/O operations for a volume that had I/O operations disabled because
          * the data on the volume was potentially inconsistent.</p>
@@ -6534,6 +8325,18 @@ namespace Model
          */
         virtual void EnableVolumeIOAsync(const Model::EnableVolumeIORequest& request, const EnableVolumeIOResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableVolumeIOCallable(const Model::EnableVolumeIORequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableVolumeIOOutcomeCallable EnableVolumeIOCallable(Model::EnableVolumeIORequest&& request) const;
+
+        /**
+         * Same as EnableVolumeIOAsync(const Model::EnableVolumeIORequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableVolumeIOAsync(Model::EnableVolumeIORequest&& request, const EnableVolumeIOResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables a VPC for ClassicLink. You can then link EC2-Classic instances to
          * your ClassicLink-enabled VPC to allow communication over private IP addresses.
@@ -6574,6 +8377,18 @@ namespace Model
          */
         virtual void EnableVpcClassicLinkAsync(const Model::EnableVpcClassicLinkRequest& request, const EnableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableVpcClassicLinkCallable(const Model::EnableVpcClassicLinkRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableVpcClassicLinkOutcomeCallable EnableVpcClassicLinkCallable(Model::EnableVpcClassicLinkRequest&& request) const;
+
+        /**
+         * Same as EnableVpcClassicLinkAsync(const Model::EnableVpcClassicLinkRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableVpcClassicLinkAsync(Model::EnableVpcClassicLinkRequest&& request, const EnableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables a VPC to support DNS hostname resolution for ClassicLink. If enabled,
          * the DNS hostname of a linked EC2-Classic instance resolves to its private IP
@@ -6614,6 +8429,18 @@ namespace Model
          */
         virtual void EnableVpcClassicLinkDnsSupportAsync(const Model::EnableVpcClassicLinkDnsSupportRequest& request, const EnableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableVpcClassicLinkDnsSupportCallable(const Model::EnableVpcClassicLinkDnsSupportRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableVpcClassicLinkDnsSupportOutcomeCallable EnableVpcClassicLinkDnsSupportCallable(Model::EnableVpcClassicLinkDnsSupportRequest&& request) const;
+
+        /**
+         * Same as EnableVpcClassicLinkDnsSupportAsync(const Model::EnableVpcClassicLinkDnsSupportRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableVpcClassicLinkDnsSupportAsync(Model::EnableVpcClassicLinkDnsSupportRequest&& request, const EnableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the console output for the specified instance.</p> <p>Instances do not
          * have a physical monitor through which you can view their console output. They
@@ -6669,6 +8496,18 @@ namespace Model
          */
         virtual void GetConsoleOutputAsync(const Model::GetConsoleOutputRequest& request, const GetConsoleOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetConsoleOutputCallable(const Model::GetConsoleOutputRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetConsoleOutputOutcomeCallable GetConsoleOutputCallable(Model::GetConsoleOutputRequest&& request) const;
+
+        /**
+         * Same as GetConsoleOutputAsync(const Model::GetConsoleOutputRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetConsoleOutputAsync(Model::GetConsoleOutputRequest&& request, const GetConsoleOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieve a JPG-format screenshot of a running instance to help with
          * troubleshooting.</p> <p>The returned content is base64-encoded.</p>
@@ -6691,6 +8530,18 @@ namespace Model
          */
         virtual void GetConsoleScreenshotAsync(const Model::GetConsoleScreenshotRequest& request, const GetConsoleScreenshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetConsoleScreenshotCallable(const Model::GetConsoleScreenshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetConsoleScreenshotOutcomeCallable GetConsoleScreenshotCallable(Model::GetConsoleScreenshotRequest&& request) const;
+
+        /**
+         * Same as GetConsoleScreenshotAsync(const Model::GetConsoleScreenshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetConsoleScreenshotAsync(Model::GetConsoleScreenshotRequest&& request, const GetConsoleScreenshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the encrypted administrator password for an instance running
          * Windows.</p> <p>The Windows password is generated at boot if the
@@ -6740,6 +8591,18 @@ namespace Model
          */
         virtual void GetPasswordDataAsync(const Model::GetPasswordDataRequest& request, const GetPasswordDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPasswordDataCallable(const Model::GetPasswordDataRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetPasswordDataOutcomeCallable GetPasswordDataCallable(Model::GetPasswordDataRequest&& request) const;
+
+        /**
+         * Same as GetPasswordDataAsync(const Model::GetPasswordDataRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetPasswordDataAsync(Model::GetPasswordDataRequest&& request, const GetPasswordDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Import single or multi-volume disk images or EBS snapshots into an Amazon
          * Machine Image (AMI).</p>
@@ -6762,6 +8625,18 @@ namespace Model
          */
         virtual void ImportImageAsync(const Model::ImportImageRequest& request, const ImportImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ImportImageCallable(const Model::ImportImageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ImportImageOutcomeCallable ImportImageCallable(Model::ImportImageRequest&& request) const;
+
+        /**
+         * Same as ImportImageAsync(const Model::ImportImageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ImportImageAsync(Model::ImportImageRequest&& request, const ImportImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an import instance task using metadata from the specified disk image.
          * <code>ImportInstance</code> only supports single-volume VMs. To import
@@ -6811,6 +8686,18 @@ namespace Model
          */
         virtual void ImportInstanceAsync(const Model::ImportInstanceRequest& request, const ImportInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ImportInstanceCallable(const Model::ImportInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ImportInstanceOutcomeCallable ImportInstanceCallable(Model::ImportInstanceRequest&& request) const;
+
+        /**
+         * Same as ImportInstanceAsync(const Model::ImportInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ImportInstanceAsync(Model::ImportInstanceRequest&& request, const ImportInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Imports the public key from an RSA key pair that you created with a
          * third-party tool. Compare this with <a>CreateKeyPair</a>, in which AWS creates
@@ -6851,6 +8738,18 @@ namespace Model
          */
         virtual void ImportKeyPairAsync(const Model::ImportKeyPairRequest& request, const ImportKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ImportKeyPairCallable(const Model::ImportKeyPairRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ImportKeyPairOutcomeCallable ImportKeyPairCallable(Model::ImportKeyPairRequest&& request) const;
+
+        /**
+         * Same as ImportKeyPairAsync(const Model::ImportKeyPairRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ImportKeyPairAsync(Model::ImportKeyPairRequest&& request, const ImportKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Imports a disk into an EBS snapshot.</p>
          */
@@ -6870,6 +8769,18 @@ namespace Model
          */
         virtual void ImportSnapshotAsync(const Model::ImportSnapshotRequest& request, const ImportSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ImportSnapshotCallable(const Model::ImportSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ImportSnapshotOutcomeCallable ImportSnapshotCallable(Model::ImportSnapshotRequest&& request) const;
+
+        /**
+         * Same as ImportSnapshotAsync(const Model::ImportSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ImportSnapshotAsync(Model::ImportSnapshotRequest&& request, const ImportSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an import volume task using metadata from the specified disk image.
          * After importing the image, you then upload it using the
@@ -6916,6 +8827,18 @@ namespace Model
          */
         virtual void ImportVolumeAsync(const Model::ImportVolumeRequest& request, const ImportVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ImportVolumeCallable(const Model::ImportVolumeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ImportVolumeOutcomeCallable ImportVolumeCallable(Model::ImportVolumeRequest&& request) const;
+
+        /**
+         * Same as ImportVolumeAsync(const Model::ImportVolumeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ImportVolumeAsync(Model::ImportVolumeRequest&& request, const ImportVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modify the auto-placement setting of a Dedicated host. When auto-placement is
          * enabled, AWS will place instances that you launch with a tenancy of
@@ -6953,6 +8876,18 @@ namespace Model
          */
         virtual void ModifyHostsAsync(const Model::ModifyHostsRequest& request, const ModifyHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyHostsCallable(const Model::ModifyHostsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyHostsOutcomeCallable ModifyHostsCallable(Model::ModifyHostsRequest&& request) const;
+
+        /**
+         * Same as ModifyHostsAsync(const Model::ModifyHostsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyHostsAsync(Model::ModifyHostsRequest&& request, const ModifyHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the ID format for the specified resource on a per-region basis. You
          * can specify that resources should receive longer IDs (17-character IDs) when
@@ -7014,6 +8949,18 @@ namespace Model
          */
         virtual void ModifyIdFormatAsync(const Model::ModifyIdFormatRequest& request, const ModifyIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyIdFormatCallable(const Model::ModifyIdFormatRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyIdFormatOutcomeCallable ModifyIdFormatCallable(Model::ModifyIdFormatRequest&& request) const;
+
+        /**
+         * Same as ModifyIdFormatAsync(const Model::ModifyIdFormatRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyIdFormatAsync(Model::ModifyIdFormatRequest&& request, const ModifyIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified attribute of the specified AMI. You can specify only
          * one attribute at a time.</p> <note><p>AWS Marketplace product codes cannot be
@@ -7042,6 +8989,18 @@ namespace Model
          */
         virtual void ModifyImageAttributeAsync(const Model::ModifyImageAttributeRequest& request, const ModifyImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyImageAttributeCallable(const Model::ModifyImageAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyImageAttributeOutcomeCallable ModifyImageAttributeCallable(Model::ModifyImageAttributeRequest&& request) const;
+
+        /**
+         * Same as ModifyImageAttributeAsync(const Model::ModifyImageAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyImageAttributeAsync(Model::ModifyImageAttributeRequest&& request, const ModifyImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified attribute of the specified instance. You can specify
          * only one attribute at a time.</p> <p>To modify some attributes, the instance
@@ -7076,6 +9035,18 @@ namespace Model
          */
         virtual void ModifyInstanceAttributeAsync(const Model::ModifyInstanceAttributeRequest& request, const ModifyInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyInstanceAttributeCallable(const Model::ModifyInstanceAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyInstanceAttributeOutcomeCallable ModifyInstanceAttributeCallable(Model::ModifyInstanceAttributeRequest&& request) const;
+
+        /**
+         * Same as ModifyInstanceAttributeAsync(const Model::ModifyInstanceAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyInstanceAttributeAsync(Model::ModifyInstanceAttributeRequest&& request, const ModifyInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Set the instance affinity value for a specific stopped instance and modify
          * the instance tenancy setting.</p> <p>Instance affinity is disabled by default.
@@ -7131,6 +9102,18 @@ namespace Model
          */
         virtual void ModifyInstancePlacementAsync(const Model::ModifyInstancePlacementRequest& request, const ModifyInstancePlacementResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyInstancePlacementCallable(const Model::ModifyInstancePlacementRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyInstancePlacementOutcomeCallable ModifyInstancePlacementCallable(Model::ModifyInstancePlacementRequest&& request) const;
+
+        /**
+         * Same as ModifyInstancePlacementAsync(const Model::ModifyInstancePlacementRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyInstancePlacementAsync(Model::ModifyInstancePlacementRequest&& request, const ModifyInstancePlacementResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified network interface attribute. You can specify only one
          * attribute at a time.</p>
@@ -7153,6 +9136,18 @@ namespace Model
          */
         virtual void ModifyNetworkInterfaceAttributeAsync(const Model::ModifyNetworkInterfaceAttributeRequest& request, const ModifyNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyNetworkInterfaceAttributeCallable(const Model::ModifyNetworkInterfaceAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyNetworkInterfaceAttributeOutcomeCallable ModifyNetworkInterfaceAttributeCallable(Model::ModifyNetworkInterfaceAttributeRequest&& request) const;
+
+        /**
+         * Same as ModifyNetworkInterfaceAttributeAsync(const Model::ModifyNetworkInterfaceAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyNetworkInterfaceAttributeAsync(Model::ModifyNetworkInterfaceAttributeRequest&& request, const ModifyNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the Availability Zone, instance count, instance type, or network
          * platform (EC2-Classic or EC2-VPC) of your Reserved Instances. The Reserved
@@ -7187,6 +9182,18 @@ namespace Model
          */
         virtual void ModifyReservedInstancesAsync(const Model::ModifyReservedInstancesRequest& request, const ModifyReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyReservedInstancesCallable(const Model::ModifyReservedInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyReservedInstancesOutcomeCallable ModifyReservedInstancesCallable(Model::ModifyReservedInstancesRequest&& request) const;
+
+        /**
+         * Same as ModifyReservedInstancesAsync(const Model::ModifyReservedInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyReservedInstancesAsync(Model::ModifyReservedInstancesRequest&& request, const ModifyReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds or removes permission settings for the specified snapshot. You may add
          * or remove specified AWS account IDs from a snapshot's list of create volume
@@ -7230,6 +9237,18 @@ namespace Model
          */
         virtual void ModifySnapshotAttributeAsync(const Model::ModifySnapshotAttributeRequest& request, const ModifySnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifySnapshotAttributeCallable(const Model::ModifySnapshotAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifySnapshotAttributeOutcomeCallable ModifySnapshotAttributeCallable(Model::ModifySnapshotAttributeRequest&& request) const;
+
+        /**
+         * Same as ModifySnapshotAttributeAsync(const Model::ModifySnapshotAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifySnapshotAttributeAsync(Model::ModifySnapshotAttributeRequest&& request, const ModifySnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified Spot fleet request.</p> <p>While the Spot fleet
          * request is being modified, it is in the <code>modifying</code> state.</p> <p>To
@@ -7297,6 +9316,18 @@ namespace Model
          */
         virtual void ModifySpotFleetRequestAsync(const Model::ModifySpotFleetRequestRequest& request, const ModifySpotFleetRequestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifySpotFleetRequestCallable(const Model::ModifySpotFleetRequestRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifySpotFleetRequestOutcomeCallable ModifySpotFleetRequestCallable(Model::ModifySpotFleetRequestRequest&& request) const;
+
+        /**
+         * Same as ModifySpotFleetRequestAsync(const Model::ModifySpotFleetRequestRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifySpotFleetRequestAsync(Model::ModifySpotFleetRequestRequest&& request, const ModifySpotFleetRequestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies a subnet attribute.</p>
          */
@@ -7316,6 +9347,18 @@ namespace Model
          */
         virtual void ModifySubnetAttributeAsync(const Model::ModifySubnetAttributeRequest& request, const ModifySubnetAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifySubnetAttributeCallable(const Model::ModifySubnetAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifySubnetAttributeOutcomeCallable ModifySubnetAttributeCallable(Model::ModifySubnetAttributeRequest&& request) const;
+
+        /**
+         * Same as ModifySubnetAttributeAsync(const Model::ModifySubnetAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifySubnetAttributeAsync(Model::ModifySubnetAttributeRequest&& request, const ModifySubnetAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies a volume attribute.</p> <p>By default, all I/O operations for the
          * volume are suspended when the data on the volume is determined to be potentially
@@ -7353,6 +9396,18 @@ namespace Model
          */
         virtual void ModifyVolumeAttributeAsync(const Model::ModifyVolumeAttributeRequest& request, const ModifyVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyVolumeAttributeCallable(const Model::ModifyVolumeAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyVolumeAttributeOutcomeCallable ModifyVolumeAttributeCallable(Model::ModifyVolumeAttributeRequest&& request) const;
+
+        /**
+         * Same as ModifyVolumeAttributeAsync(const Model::ModifyVolumeAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyVolumeAttributeAsync(Model::ModifyVolumeAttributeRequest&& request, const ModifyVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified attribute of the specified VPC.</p>
          */
@@ -7372,6 +9427,18 @@ namespace Model
          */
         virtual void ModifyVpcAttributeAsync(const Model::ModifyVpcAttributeRequest& request, const ModifyVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyVpcAttributeCallable(const Model::ModifyVpcAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyVpcAttributeOutcomeCallable ModifyVpcAttributeCallable(Model::ModifyVpcAttributeRequest&& request) const;
+
+        /**
+         * Same as ModifyVpcAttributeAsync(const Model::ModifyVpcAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyVpcAttributeAsync(Model::ModifyVpcAttributeRequest&& request, const ModifyVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies attributes of a specified VPC endpoint. You can modify the policy
          * associated with the endpoint, and you can add and remove route tables associated
@@ -7397,6 +9464,18 @@ namespace Model
          */
         virtual void ModifyVpcEndpointAsync(const Model::ModifyVpcEndpointRequest& request, const ModifyVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyVpcEndpointCallable(const Model::ModifyVpcEndpointRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyVpcEndpointOutcomeCallable ModifyVpcEndpointCallable(Model::ModifyVpcEndpointRequest&& request) const;
+
+        /**
+         * Same as ModifyVpcEndpointAsync(const Model::ModifyVpcEndpointRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyVpcEndpointAsync(Model::ModifyVpcEndpointRequest&& request, const ModifyVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the VPC peering connection options on one side of a VPC peering
          * connection. You can do the following:</p> <ul> <li><p>Enable/disable
@@ -7452,6 +9531,18 @@ namespace Model
          */
         virtual void ModifyVpcPeeringConnectionOptionsAsync(const Model::ModifyVpcPeeringConnectionOptionsRequest& request, const ModifyVpcPeeringConnectionOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyVpcPeeringConnectionOptionsCallable(const Model::ModifyVpcPeeringConnectionOptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyVpcPeeringConnectionOptionsOutcomeCallable ModifyVpcPeeringConnectionOptionsCallable(Model::ModifyVpcPeeringConnectionOptionsRequest&& request) const;
+
+        /**
+         * Same as ModifyVpcPeeringConnectionOptionsAsync(const Model::ModifyVpcPeeringConnectionOptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyVpcPeeringConnectionOptionsAsync(Model::ModifyVpcPeeringConnectionOptionsRequest&& request, const ModifyVpcPeeringConnectionOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables monitoring for a running instance. For more information about
          * monitoring instances, see <a
@@ -7483,6 +9574,18 @@ namespace Model
          */
         virtual void MonitorInstancesAsync(const Model::MonitorInstancesRequest& request, const MonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as MonitorInstancesCallable(const Model::MonitorInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::MonitorInstancesOutcomeCallable MonitorInstancesCallable(Model::MonitorInstancesRequest&& request) const;
+
+        /**
+         * Same as MonitorInstancesAsync(const Model::MonitorInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void MonitorInstancesAsync(Model::MonitorInstancesRequest&& request, const MonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Moves an Elastic IP address from the EC2-Classic platform to the EC2-VPC
          * platform. The Elastic IP address must be allocated to your account for more than
@@ -7520,6 +9623,18 @@ namespace Model
          */
         virtual void MoveAddressToVpcAsync(const Model::MoveAddressToVpcRequest& request, const MoveAddressToVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as MoveAddressToVpcCallable(const Model::MoveAddressToVpcRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::MoveAddressToVpcOutcomeCallable MoveAddressToVpcCallable(Model::MoveAddressToVpcRequest&& request) const;
+
+        /**
+         * Same as MoveAddressToVpcAsync(const Model::MoveAddressToVpcRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void MoveAddressToVpcAsync(Model::MoveAddressToVpcRequest&& request, const MoveAddressToVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Purchases a Reserved Instance for use with your account. With Reserved
          * Instances, you obtain a capacity reservation for a certain instance
@@ -7575,6 +9690,18 @@ namespace Model
          */
         virtual void PurchaseReservedInstancesOfferingAsync(const Model::PurchaseReservedInstancesOfferingRequest& request, const PurchaseReservedInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PurchaseReservedInstancesOfferingCallable(const Model::PurchaseReservedInstancesOfferingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PurchaseReservedInstancesOfferingOutcomeCallable PurchaseReservedInstancesOfferingCallable(Model::PurchaseReservedInstancesOfferingRequest&& request) const;
+
+        /**
+         * Same as PurchaseReservedInstancesOfferingAsync(const Model::PurchaseReservedInstancesOfferingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PurchaseReservedInstancesOfferingAsync(Model::PurchaseReservedInstancesOfferingRequest&& request, const PurchaseReservedInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Purchases one or more Scheduled Instances with the specified schedule.</p>
          * <p>Scheduled Instances enable you to purchase Amazon EC2 compute capacity by the
@@ -7615,6 +9742,18 @@ namespace Model
          */
         virtual void PurchaseScheduledInstancesAsync(const Model::PurchaseScheduledInstancesRequest& request, const PurchaseScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PurchaseScheduledInstancesCallable(const Model::PurchaseScheduledInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PurchaseScheduledInstancesOutcomeCallable PurchaseScheduledInstancesCallable(Model::PurchaseScheduledInstancesRequest&& request) const;
+
+        /**
+         * Same as PurchaseScheduledInstancesAsync(const Model::PurchaseScheduledInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PurchaseScheduledInstancesAsync(Model::PurchaseScheduledInstancesRequest&& request, const PurchaseScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a reboot of one or more instances. This operation is asynchronous;
          * it only queues a request to reboot the specified instances. The operation
@@ -7658,6 +9797,18 @@ namespace Model
          */
         virtual void RebootInstancesAsync(const Model::RebootInstancesRequest& request, const RebootInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebootInstancesCallable(const Model::RebootInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RebootInstancesOutcomeCallable RebootInstancesCallable(Model::RebootInstancesRequest&& request) const;
+
+        /**
+         * Same as RebootInstancesAsync(const Model::RebootInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RebootInstancesAsync(Model::RebootInstancesRequest&& request, const RebootInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers an AMI. When you're creating an AMI, this is the final step you
          * must complete before you can launch an instance from the AMI. For more
@@ -7755,6 +9906,18 @@ namespace Model
          */
         virtual void RegisterImageAsync(const Model::RegisterImageRequest& request, const RegisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterImageCallable(const Model::RegisterImageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterImageOutcomeCallable RegisterImageCallable(Model::RegisterImageRequest&& request) const;
+
+        /**
+         * Same as RegisterImageAsync(const Model::RegisterImageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterImageAsync(Model::RegisterImageRequest&& request, const RegisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Rejects a VPC peering connection request. The VPC peering connection must be
          * in the <code>pending-acceptance</code> state. Use the
@@ -7789,6 +9952,18 @@ namespace Model
          */
         virtual void RejectVpcPeeringConnectionAsync(const Model::RejectVpcPeeringConnectionRequest& request, const RejectVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RejectVpcPeeringConnectionCallable(const Model::RejectVpcPeeringConnectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RejectVpcPeeringConnectionOutcomeCallable RejectVpcPeeringConnectionCallable(Model::RejectVpcPeeringConnectionRequest&& request) const;
+
+        /**
+         * Same as RejectVpcPeeringConnectionAsync(const Model::RejectVpcPeeringConnectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RejectVpcPeeringConnectionAsync(Model::RejectVpcPeeringConnectionRequest&& request, const RejectVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Releases the specified Elastic IP address.</p> <p>After releasing an Elastic
          * IP address, it is released to the IP address pool and might be unavailable to
@@ -7841,6 +10016,18 @@ namespace Model
          */
         virtual void ReleaseAddressAsync(const Model::ReleaseAddressRequest& request, const ReleaseAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReleaseAddressCallable(const Model::ReleaseAddressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReleaseAddressOutcomeCallable ReleaseAddressCallable(Model::ReleaseAddressRequest&& request) const;
+
+        /**
+         * Same as ReleaseAddressAsync(const Model::ReleaseAddressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReleaseAddressAsync(Model::ReleaseAddressRequest&& request, const ReleaseAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>When you no longer want to use a Dedicated host it can be released. On-Demand
          * billing is stopped and the host goes into <code>released</code> state. The host
@@ -7884,6 +10071,18 @@ namespace Model
          */
         virtual void ReleaseHostsAsync(const Model::ReleaseHostsRequest& request, const ReleaseHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReleaseHostsCallable(const Model::ReleaseHostsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReleaseHostsOutcomeCallable ReleaseHostsCallable(Model::ReleaseHostsRequest&& request) const;
+
+        /**
+         * Same as ReleaseHostsAsync(const Model::ReleaseHostsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReleaseHostsAsync(Model::ReleaseHostsRequest&& request, const ReleaseHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes which network ACL a subnet is associated with. By default when you
          * create a subnet, it's automatically associated with the default network ACL. For
@@ -7915,6 +10114,18 @@ namespace Model
          */
         virtual void ReplaceNetworkAclAssociationAsync(const Model::ReplaceNetworkAclAssociationRequest& request, const ReplaceNetworkAclAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReplaceNetworkAclAssociationCallable(const Model::ReplaceNetworkAclAssociationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReplaceNetworkAclAssociationOutcomeCallable ReplaceNetworkAclAssociationCallable(Model::ReplaceNetworkAclAssociationRequest&& request) const;
+
+        /**
+         * Same as ReplaceNetworkAclAssociationAsync(const Model::ReplaceNetworkAclAssociationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReplaceNetworkAclAssociationAsync(Model::ReplaceNetworkAclAssociationRequest&& request, const ReplaceNetworkAclAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Replaces an entry (rule) in a network ACL. For more information about network
          * ACLs, see <a
@@ -7943,6 +10154,18 @@ namespace Model
          */
         virtual void ReplaceNetworkAclEntryAsync(const Model::ReplaceNetworkAclEntryRequest& request, const ReplaceNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReplaceNetworkAclEntryCallable(const Model::ReplaceNetworkAclEntryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReplaceNetworkAclEntryOutcomeCallable ReplaceNetworkAclEntryCallable(Model::ReplaceNetworkAclEntryRequest&& request) const;
+
+        /**
+         * Same as ReplaceNetworkAclEntryAsync(const Model::ReplaceNetworkAclEntryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReplaceNetworkAclEntryAsync(Model::ReplaceNetworkAclEntryRequest&& request, const ReplaceNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Replaces an existing route within a route table in a VPC. You must provide
          * only one of the following: Internet gateway or virtual private gateway, NAT
@@ -7977,6 +10200,18 @@ namespace Model
          */
         virtual void ReplaceRouteAsync(const Model::ReplaceRouteRequest& request, const ReplaceRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReplaceRouteCallable(const Model::ReplaceRouteRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReplaceRouteOutcomeCallable ReplaceRouteCallable(Model::ReplaceRouteRequest&& request) const;
+
+        /**
+         * Same as ReplaceRouteAsync(const Model::ReplaceRouteRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReplaceRouteAsync(Model::ReplaceRouteRequest&& request, const ReplaceRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the route table associated with a given subnet in a VPC. After the
          * operation completes, the subnet uses the routes in the new route table it's
@@ -8017,6 +10252,18 @@ namespace Model
          */
         virtual void ReplaceRouteTableAssociationAsync(const Model::ReplaceRouteTableAssociationRequest& request, const ReplaceRouteTableAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReplaceRouteTableAssociationCallable(const Model::ReplaceRouteTableAssociationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReplaceRouteTableAssociationOutcomeCallable ReplaceRouteTableAssociationCallable(Model::ReplaceRouteTableAssociationRequest&& request) const;
+
+        /**
+         * Same as ReplaceRouteTableAssociationAsync(const Model::ReplaceRouteTableAssociationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReplaceRouteTableAssociationAsync(Model::ReplaceRouteTableAssociationRequest&& request, const ReplaceRouteTableAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Submits feedback about the status of an instance. The instance must be in the
          * <code>running</code> state. If your experience with the instance differs from
@@ -8054,6 +10301,18 @@ namespace Model
          */
         virtual void ReportInstanceStatusAsync(const Model::ReportInstanceStatusRequest& request, const ReportInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReportInstanceStatusCallable(const Model::ReportInstanceStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReportInstanceStatusOutcomeCallable ReportInstanceStatusCallable(Model::ReportInstanceStatusRequest&& request) const;
+
+        /**
+         * Same as ReportInstanceStatusAsync(const Model::ReportInstanceStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReportInstanceStatusAsync(Model::ReportInstanceStatusRequest&& request, const ReportInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a Spot fleet request.</p> <p>You can submit a single request that
          * includes multiple launch specifications that vary by instance type, AMI,
@@ -8106,6 +10365,18 @@ namespace Model
          */
         virtual void RequestSpotFleetAsync(const Model::RequestSpotFleetRequest& request, const RequestSpotFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RequestSpotFleetCallable(const Model::RequestSpotFleetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RequestSpotFleetOutcomeCallable RequestSpotFleetCallable(Model::RequestSpotFleetRequest&& request) const;
+
+        /**
+         * Same as RequestSpotFleetAsync(const Model::RequestSpotFleetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RequestSpotFleetAsync(Model::RequestSpotFleetRequest&& request, const RequestSpotFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a Spot instance request. Spot instances are instances that Amazon EC2
          * launches when the bid price that you specify exceeds the current Spot price.
@@ -8140,6 +10411,18 @@ namespace Model
          */
         virtual void RequestSpotInstancesAsync(const Model::RequestSpotInstancesRequest& request, const RequestSpotInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RequestSpotInstancesCallable(const Model::RequestSpotInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RequestSpotInstancesOutcomeCallable RequestSpotInstancesCallable(Model::RequestSpotInstancesRequest&& request) const;
+
+        /**
+         * Same as RequestSpotInstancesAsync(const Model::RequestSpotInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RequestSpotInstancesAsync(Model::RequestSpotInstancesRequest&& request, const RequestSpotInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Resets an attribute of an AMI to its default value.</p> <note><p> The
          * productCodes attribute can't be reset. </p></note>
@@ -8162,6 +10445,18 @@ namespace Model
          */
         virtual void ResetImageAttributeAsync(const Model::ResetImageAttributeRequest& request, const ResetImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetImageAttributeCallable(const Model::ResetImageAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResetImageAttributeOutcomeCallable ResetImageAttributeCallable(Model::ResetImageAttributeRequest&& request) const;
+
+        /**
+         * Same as ResetImageAttributeAsync(const Model::ResetImageAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResetImageAttributeAsync(Model::ResetImageAttributeRequest&& request, const ResetImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Resets an attribute of an instance to its default value. To reset the
          * <code>kernel</code> or <code>ramdisk</code>, the instance must be in a stopped
@@ -8208,6 +10503,18 @@ namespace Model
          */
         virtual void ResetInstanceAttributeAsync(const Model::ResetInstanceAttributeRequest& request, const ResetInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetInstanceAttributeCallable(const Model::ResetInstanceAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResetInstanceAttributeOutcomeCallable ResetInstanceAttributeCallable(Model::ResetInstanceAttributeRequest&& request) const;
+
+        /**
+         * Same as ResetInstanceAttributeAsync(const Model::ResetInstanceAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResetInstanceAttributeAsync(Model::ResetInstanceAttributeRequest&& request, const ResetInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Resets a network interface attribute. You can specify only one attribute at a
          * time.</p>
@@ -8230,6 +10537,18 @@ namespace Model
          */
         virtual void ResetNetworkInterfaceAttributeAsync(const Model::ResetNetworkInterfaceAttributeRequest& request, const ResetNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetNetworkInterfaceAttributeCallable(const Model::ResetNetworkInterfaceAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResetNetworkInterfaceAttributeOutcomeCallable ResetNetworkInterfaceAttributeCallable(Model::ResetNetworkInterfaceAttributeRequest&& request) const;
+
+        /**
+         * Same as ResetNetworkInterfaceAttributeAsync(const Model::ResetNetworkInterfaceAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResetNetworkInterfaceAttributeAsync(Model::ResetNetworkInterfaceAttributeRequest&& request, const ResetNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Resets permission settings for the specified snapshot.</p> <p>For more
          * information on modifying snapshot permissions, see <a
@@ -8258,6 +10577,18 @@ namespace Model
          */
         virtual void ResetSnapshotAttributeAsync(const Model::ResetSnapshotAttributeRequest& request, const ResetSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetSnapshotAttributeCallable(const Model::ResetSnapshotAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResetSnapshotAttributeOutcomeCallable ResetSnapshotAttributeCallable(Model::ResetSnapshotAttributeRequest&& request) const;
+
+        /**
+         * Same as ResetSnapshotAttributeAsync(const Model::ResetSnapshotAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResetSnapshotAttributeAsync(Model::ResetSnapshotAttributeRequest&& request, const ResetSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Restores an Elastic IP address that was previously moved to the EC2-VPC
          * platform back to the EC2-Classic platform. You cannot move an Elastic IP address
@@ -8286,6 +10617,18 @@ namespace Model
          */
         virtual void RestoreAddressToClassicAsync(const Model::RestoreAddressToClassicRequest& request, const RestoreAddressToClassicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreAddressToClassicCallable(const Model::RestoreAddressToClassicRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RestoreAddressToClassicOutcomeCallable RestoreAddressToClassicCallable(Model::RestoreAddressToClassicRequest&& request) const;
+
+        /**
+         * Same as RestoreAddressToClassicAsync(const Model::RestoreAddressToClassicRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RestoreAddressToClassicAsync(Model::RestoreAddressToClassicRequest&& request, const RestoreAddressToClassicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>[EC2-VPC only] Removes one or more egress rules from a security group for
          * EC2-VPC. This action doesn't apply to security groups for use in EC2-Classic.
@@ -8329,6 +10672,18 @@ namespace Model
          */
         virtual void RevokeSecurityGroupEgressAsync(const Model::RevokeSecurityGroupEgressRequest& request, const RevokeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RevokeSecurityGroupEgressCallable(const Model::RevokeSecurityGroupEgressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RevokeSecurityGroupEgressOutcomeCallable RevokeSecurityGroupEgressCallable(Model::RevokeSecurityGroupEgressRequest&& request) const;
+
+        /**
+         * Same as RevokeSecurityGroupEgressAsync(const Model::RevokeSecurityGroupEgressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RevokeSecurityGroupEgressAsync(Model::RevokeSecurityGroupEgressRequest&& request, const RevokeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes one or more ingress rules from a security group. The values that you
          * specify in the revoke request (for example, ports) must match the existing
@@ -8369,6 +10724,18 @@ namespace Model
          */
         virtual void RevokeSecurityGroupIngressAsync(const Model::RevokeSecurityGroupIngressRequest& request, const RevokeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RevokeSecurityGroupIngressCallable(const Model::RevokeSecurityGroupIngressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RevokeSecurityGroupIngressOutcomeCallable RevokeSecurityGroupIngressCallable(Model::RevokeSecurityGroupIngressRequest&& request) const;
+
+        /**
+         * Same as RevokeSecurityGroupIngressAsync(const Model::RevokeSecurityGroupIngressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RevokeSecurityGroupIngressAsync(Model::RevokeSecurityGroupIngressRequest&& request, const RevokeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Launches the specified number of instances using an AMI for which you have
          * permissions.</p> <p>When you launch an instance, it enters the
@@ -8511,6 +10878,18 @@ namespace Model
          */
         virtual void RunInstancesAsync(const Model::RunInstancesRequest& request, const RunInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RunInstancesCallable(const Model::RunInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RunInstancesOutcomeCallable RunInstancesCallable(Model::RunInstancesRequest&& request) const;
+
+        /**
+         * Same as RunInstancesAsync(const Model::RunInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RunInstancesAsync(Model::RunInstancesRequest&& request, const RunInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Launches the specified Scheduled Instances.</p> <p>Before you can launch a
          * Scheduled Instance, you must purchase it and obtain an identifier using
@@ -8554,6 +10933,18 @@ namespace Model
          */
         virtual void RunScheduledInstancesAsync(const Model::RunScheduledInstancesRequest& request, const RunScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RunScheduledInstancesCallable(const Model::RunScheduledInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RunScheduledInstancesOutcomeCallable RunScheduledInstancesCallable(Model::RunScheduledInstancesRequest&& request) const;
+
+        /**
+         * Same as RunScheduledInstancesAsync(const Model::RunScheduledInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RunScheduledInstancesAsync(Model::RunScheduledInstancesRequest&& request, const RunScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts an Amazon EBS-backed AMI that you've previously stopped.</p>
          * <p>Instances that use Amazon EBS volumes as their root devices can be quickly
@@ -8612,6 +11003,18 @@ namespace Model
          */
         virtual void StartInstancesAsync(const Model::StartInstancesRequest& request, const StartInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartInstancesCallable(const Model::StartInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StartInstancesOutcomeCallable StartInstancesCallable(Model::StartInstancesRequest&& request) const;
+
+        /**
+         * Same as StartInstancesAsync(const Model::StartInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StartInstancesAsync(Model::StartInstancesRequest&& request, const StartInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stops an Amazon EBS-backed instance. </p> <p>We don't charge hourly usage for
          * a stopped instance, or data transfer fees; however, your root partition Amazon
@@ -8703,6 +11106,18 @@ namespace Model
          */
         virtual void StopInstancesAsync(const Model::StopInstancesRequest& request, const StopInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopInstancesCallable(const Model::StopInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StopInstancesOutcomeCallable StopInstancesCallable(Model::StopInstancesRequest&& request) const;
+
+        /**
+         * Same as StopInstancesAsync(const Model::StopInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StopInstancesAsync(Model::StopInstancesRequest&& request, const StopInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Shuts down one or more instances. This operation is idempotent; if you
          * terminate an instance more than once, each call succeeds.</p> <p>Terminated
@@ -8776,6 +11191,18 @@ namespace Model
          */
         virtual void TerminateInstancesAsync(const Model::TerminateInstancesRequest& request, const TerminateInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TerminateInstancesCallable(const Model::TerminateInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TerminateInstancesOutcomeCallable TerminateInstancesCallable(Model::TerminateInstancesRequest&& request) const;
+
+        /**
+         * Same as TerminateInstancesAsync(const Model::TerminateInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TerminateInstancesAsync(Model::TerminateInstancesRequest&& request, const TerminateInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Unassigns one or more secondary private IP addresses from a network
          * interface.</p>
@@ -8798,6 +11225,18 @@ namespace Model
          */
         virtual void UnassignPrivateIpAddressesAsync(const Model::UnassignPrivateIpAddressesRequest& request, const UnassignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnassignPrivateIpAddressesCallable(const Model::UnassignPrivateIpAddressesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UnassignPrivateIpAddressesOutcomeCallable UnassignPrivateIpAddressesCallable(Model::UnassignPrivateIpAddressesRequest&& request) const;
+
+        /**
+         * Same as UnassignPrivateIpAddressesAsync(const Model::UnassignPrivateIpAddressesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UnassignPrivateIpAddressesAsync(Model::UnassignPrivateIpAddressesRequest&& request, const UnassignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables monitoring for a running instance. For more information about
          * monitoring instances, see <a
@@ -8829,6 +11268,1170 @@ namespace Model
          */
         virtual void UnmonitorInstancesAsync(const Model::UnmonitorInstancesRequest& request, const UnmonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnmonitorInstancesCallable(const Model::UnmonitorInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UnmonitorInstancesOutcomeCallable UnmonitorInstancesCallable(Model::UnmonitorInstancesRequest&& request) const;
+
+        /**
+         * Same as UnmonitorInstancesAsync(const Model::UnmonitorInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UnmonitorInstancesAsync(Model::UnmonitorInstancesRequest&& request, const UnmonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeClassicLinkInstances(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeClassicLinkInstancesRequest, Model::DescribeClassicLinkInstancesOutcome> DescribeClassicLinkInstancesPaginator(const Model::DescribeClassicLinkInstancesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeFlowLogs(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeFlowLogsRequest, Model::DescribeFlowLogsOutcome> DescribeFlowLogsPaginator(const Model::DescribeFlowLogsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeHosts(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeHostsRequest, Model::DescribeHostsOutcome> DescribeHostsPaginator(const Model::DescribeHostsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeImportImageTasks(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeImportImageTasksRequest, Model::DescribeImportImageTasksOutcome> DescribeImportImageTasksPaginator(const Model::DescribeImportImageTasksRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeImportSnapshotTasks(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeImportSnapshotTasksRequest, Model::DescribeImportSnapshotTasksOutcome> DescribeImportSnapshotTasksPaginator(const Model::DescribeImportSnapshotTasksRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeInstanceStatus(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeInstanceStatusRequest, Model::DescribeInstanceStatusOutcome> DescribeInstanceStatusPaginator(const Model::DescribeInstanceStatusRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeInstances(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeInstancesRequest, Model::DescribeInstancesOutcome> DescribeInstancesPaginator(const Model::DescribeInstancesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeMovingAddresses(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeMovingAddressesRequest, Model::DescribeMovingAddressesOutcome> DescribeMovingAddressesPaginator(const Model::DescribeMovingAddressesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeNatGateways(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeNatGatewaysRequest, Model::DescribeNatGatewaysOutcome> DescribeNatGatewaysPaginator(const Model::DescribeNatGatewaysRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribePrefixLists(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribePrefixListsRequest, Model::DescribePrefixListsOutcome> DescribePrefixListsPaginator(const Model::DescribePrefixListsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeReservedInstancesModifications(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeReservedInstancesModificationsRequest, Model::DescribeReservedInstancesModificationsOutcome> DescribeReservedInstancesModificationsPaginator(const Model::DescribeReservedInstancesModificationsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeReservedInstancesOfferings(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeReservedInstancesOfferingsRequest, Model::DescribeReservedInstancesOfferingsOutcome> DescribeReservedInstancesOfferingsPaginator(const Model::DescribeReservedInstancesOfferingsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeScheduledInstanceAvailability(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeScheduledInstanceAvailabilityRequest, Model::DescribeScheduledInstanceAvailabilityOutcome> DescribeScheduledInstanceAvailabilityPaginator(const Model::DescribeScheduledInstanceAvailabilityRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeScheduledInstances(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeScheduledInstancesRequest, Model::DescribeScheduledInstancesOutcome> DescribeScheduledInstancesPaginator(const Model::DescribeScheduledInstancesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeSnapshots(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeSnapshotsRequest, Model::DescribeSnapshotsOutcome> DescribeSnapshotsPaginator(const Model::DescribeSnapshotsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeSpotFleetInstances(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeSpotFleetInstancesRequest, Model::DescribeSpotFleetInstancesOutcome> DescribeSpotFleetInstancesPaginator(const Model::DescribeSpotFleetInstancesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeSpotFleetRequestHistory(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeSpotFleetRequestHistoryRequest, Model::DescribeSpotFleetRequestHistoryOutcome> DescribeSpotFleetRequestHistoryPaginator(const Model::DescribeSpotFleetRequestHistoryRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeSpotFleetRequests(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeSpotFleetRequestsRequest, Model::DescribeSpotFleetRequestsOutcome> DescribeSpotFleetRequestsPaginator(const Model::DescribeSpotFleetRequestsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeSpotPriceHistory(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeSpotPriceHistoryRequest, Model::DescribeSpotPriceHistoryOutcome> DescribeSpotPriceHistoryPaginator(const Model::DescribeSpotPriceHistoryRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeStaleSecurityGroups(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeStaleSecurityGroupsRequest, Model::DescribeStaleSecurityGroupsOutcome> DescribeStaleSecurityGroupsPaginator(const Model::DescribeStaleSecurityGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeTags(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeTagsRequest, Model::DescribeTagsOutcome> DescribeTagsPaginator(const Model::DescribeTagsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeVolumeStatus(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeVolumeStatusRequest, Model::DescribeVolumeStatusOutcome> DescribeVolumeStatusPaginator(const Model::DescribeVolumeStatusRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeVolumes(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeVolumesRequest, Model::DescribeVolumesOutcome> DescribeVolumesPaginator(const Model::DescribeVolumesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeVpcClassicLinkDnsSupport(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeVpcClassicLinkDnsSupportRequest, Model::DescribeVpcClassicLinkDnsSupportOutcome> DescribeVpcClassicLinkDnsSupportPaginator(const Model::DescribeVpcClassicLinkDnsSupportRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeVpcEndpointServices(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeVpcEndpointServicesRequest, Model::DescribeVpcEndpointServicesOutcome> DescribeVpcEndpointServicesPaginator(const Model::DescribeVpcEndpointServicesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeVpcEndpoints(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EC2Client, Model::DescribeVpcEndpointsRequest, Model::DescribeVpcEndpointsOutcome> DescribeVpcEndpointsPaginator(const Model::DescribeVpcEndpointsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AcceptVpcPeeringConnection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::AcceptVpcPeeringConnectionRequest, Model::AcceptVpcPeeringConnectionOutcome> AcceptVpcPeeringConnectionAwaitable(Model::AcceptVpcPeeringConnectionRequest request) const;
+
+        /**
+         * co_await-able form of AllocateAddress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::AllocateAddressRequest, Model::AllocateAddressOutcome> AllocateAddressAwaitable(Model::AllocateAddressRequest request) const;
+
+        /**
+         * co_await-able form of AllocateHosts(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::AllocateHostsRequest, Model::AllocateHostsOutcome> AllocateHostsAwaitable(Model::AllocateHostsRequest request) const;
+
+        /**
+         * co_await-able form of AssignPrivateIpAddresses(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::AssignPrivateIpAddressesRequest, Model::AssignPrivateIpAddressesOutcome> AssignPrivateIpAddressesAwaitable(Model::AssignPrivateIpAddressesRequest request) const;
+
+        /**
+         * co_await-able form of AssociateAddress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::AssociateAddressRequest, Model::AssociateAddressOutcome> AssociateAddressAwaitable(Model::AssociateAddressRequest request) const;
+
+        /**
+         * co_await-able form of AssociateDhcpOptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::AssociateDhcpOptionsRequest, Model::AssociateDhcpOptionsOutcome> AssociateDhcpOptionsAwaitable(Model::AssociateDhcpOptionsRequest request) const;
+
+        /**
+         * co_await-able form of AssociateRouteTable(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::AssociateRouteTableRequest, Model::AssociateRouteTableOutcome> AssociateRouteTableAwaitable(Model::AssociateRouteTableRequest request) const;
+
+        /**
+         * co_await-able form of AttachClassicLinkVpc(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::AttachClassicLinkVpcRequest, Model::AttachClassicLinkVpcOutcome> AttachClassicLinkVpcAwaitable(Model::AttachClassicLinkVpcRequest request) const;
+
+        /**
+         * co_await-able form of AttachInternetGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::AttachInternetGatewayRequest, Model::AttachInternetGatewayOutcome> AttachInternetGatewayAwaitable(Model::AttachInternetGatewayRequest request) const;
+
+        /**
+         * co_await-able form of AttachNetworkInterface(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::AttachNetworkInterfaceRequest, Model::AttachNetworkInterfaceOutcome> AttachNetworkInterfaceAwaitable(Model::AttachNetworkInterfaceRequest request) const;
+
+        /**
+         * co_await-able form of AttachVolume(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::AttachVolumeRequest, Model::AttachVolumeOutcome> AttachVolumeAwaitable(Model::AttachVolumeRequest request) const;
+
+        /**
+         * co_await-able form of AttachVpnGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::AttachVpnGatewayRequest, Model::AttachVpnGatewayOutcome> AttachVpnGatewayAwaitable(Model::AttachVpnGatewayRequest request) const;
+
+        /**
+         * co_await-able form of AuthorizeSecurityGroupEgress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::AuthorizeSecurityGroupEgressRequest, Model::AuthorizeSecurityGroupEgressOutcome> AuthorizeSecurityGroupEgressAwaitable(Model::AuthorizeSecurityGroupEgressRequest request) const;
+
+        /**
+         * co_await-able form of AuthorizeSecurityGroupIngress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::AuthorizeSecurityGroupIngressRequest, Model::AuthorizeSecurityGroupIngressOutcome> AuthorizeSecurityGroupIngressAwaitable(Model::AuthorizeSecurityGroupIngressRequest request) const;
+
+        /**
+         * co_await-able form of BundleInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::BundleInstanceRequest, Model::BundleInstanceOutcome> BundleInstanceAwaitable(Model::BundleInstanceRequest request) const;
+
+        /**
+         * co_await-able form of CancelBundleTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CancelBundleTaskRequest, Model::CancelBundleTaskOutcome> CancelBundleTaskAwaitable(Model::CancelBundleTaskRequest request) const;
+
+        /**
+         * co_await-able form of CancelConversionTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CancelConversionTaskRequest, Model::CancelConversionTaskOutcome> CancelConversionTaskAwaitable(Model::CancelConversionTaskRequest request) const;
+
+        /**
+         * co_await-able form of CancelExportTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CancelExportTaskRequest, Model::CancelExportTaskOutcome> CancelExportTaskAwaitable(Model::CancelExportTaskRequest request) const;
+
+        /**
+         * co_await-able form of CancelImportTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CancelImportTaskRequest, Model::CancelImportTaskOutcome> CancelImportTaskAwaitable(Model::CancelImportTaskRequest request) const;
+
+        /**
+         * co_await-able form of CancelReservedInstancesListing(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CancelReservedInstancesListingRequest, Model::CancelReservedInstancesListingOutcome> CancelReservedInstancesListingAwaitable(Model::CancelReservedInstancesListingRequest request) const;
+
+        /**
+         * co_await-able form of CancelSpotFleetRequests(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CancelSpotFleetRequestsRequest, Model::CancelSpotFleetRequestsOutcome> CancelSpotFleetRequestsAwaitable(Model::CancelSpotFleetRequestsRequest request) const;
+
+        /**
+         * co_await-able form of CancelSpotInstanceRequests(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CancelSpotInstanceRequestsRequest, Model::CancelSpotInstanceRequestsOutcome> CancelSpotInstanceRequestsAwaitable(Model::CancelSpotInstanceRequestsRequest request) const;
+
+        /**
+         * co_await-able form of ConfirmProductInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ConfirmProductInstanceRequest, Model::ConfirmProductInstanceOutcome> ConfirmProductInstanceAwaitable(Model::ConfirmProductInstanceRequest request) const;
+
+        /**
+         * co_await-able form of CopyImage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CopyImageRequest, Model::CopyImageOutcome> CopyImageAwaitable(Model::CopyImageRequest request) const;
+
+        /**
+         * co_await-able form of CopySnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CopySnapshotRequest, Model::CopySnapshotOutcome> CopySnapshotAwaitable(Model::CopySnapshotRequest request) const;
+
+        /**
+         * co_await-able form of CreateCustomerGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateCustomerGatewayRequest, Model::CreateCustomerGatewayOutcome> CreateCustomerGatewayAwaitable(Model::CreateCustomerGatewayRequest request) const;
+
+        /**
+         * co_await-able form of CreateDhcpOptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateDhcpOptionsRequest, Model::CreateDhcpOptionsOutcome> CreateDhcpOptionsAwaitable(Model::CreateDhcpOptionsRequest request) const;
+
+        /**
+         * co_await-able form of CreateFlowLogs(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateFlowLogsRequest, Model::CreateFlowLogsOutcome> CreateFlowLogsAwaitable(Model::CreateFlowLogsRequest request) const;
+
+        /**
+         * co_await-able form of CreateImage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateImageRequest, Model::CreateImageOutcome> CreateImageAwaitable(Model::CreateImageRequest request) const;
+
+        /**
+         * co_await-able form of CreateInstanceExportTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateInstanceExportTaskRequest, Model::CreateInstanceExportTaskOutcome> CreateInstanceExportTaskAwaitable(Model::CreateInstanceExportTaskRequest request) const;
+
+        /**
+         * co_await-able form of CreateInternetGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateInternetGatewayRequest, Model::CreateInternetGatewayOutcome> CreateInternetGatewayAwaitable(Model::CreateInternetGatewayRequest request) const;
+
+        /**
+         * co_await-able form of CreateKeyPair(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateKeyPairRequest, Model::CreateKeyPairOutcome> CreateKeyPairAwaitable(Model::CreateKeyPairRequest request) const;
+
+        /**
+         * co_await-able form of CreateNatGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateNatGatewayRequest, Model::CreateNatGatewayOutcome> CreateNatGatewayAwaitable(Model::CreateNatGatewayRequest request) const;
+
+        /**
+         * co_await-able form of CreateNetworkAcl(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateNetworkAclRequest, Model::CreateNetworkAclOutcome> CreateNetworkAclAwaitable(Model::CreateNetworkAclRequest request) const;
+
+        /**
+         * co_await-able form of CreateNetworkAclEntry(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateNetworkAclEntryRequest, Model::CreateNetworkAclEntryOutcome> CreateNetworkAclEntryAwaitable(Model::CreateNetworkAclEntryRequest request) const;
+
+        /**
+         * co_await-able form of CreateNetworkInterface(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateNetworkInterfaceRequest, Model::CreateNetworkInterfaceOutcome> CreateNetworkInterfaceAwaitable(Model::CreateNetworkInterfaceRequest request) const;
+
+        /**
+         * co_await-able form of CreatePlacementGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreatePlacementGroupRequest, Model::CreatePlacementGroupOutcome> CreatePlacementGroupAwaitable(Model::CreatePlacementGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateReservedInstancesListing(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateReservedInstancesListingRequest, Model::CreateReservedInstancesListingOutcome> CreateReservedInstancesListingAwaitable(Model::CreateReservedInstancesListingRequest request) const;
+
+        /**
+         * co_await-able form of CreateRoute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateRouteRequest, Model::CreateRouteOutcome> CreateRouteAwaitable(Model::CreateRouteRequest request) const;
+
+        /**
+         * co_await-able form of CreateRouteTable(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateRouteTableRequest, Model::CreateRouteTableOutcome> CreateRouteTableAwaitable(Model::CreateRouteTableRequest request) const;
+
+        /**
+         * co_await-able form of CreateSecurityGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateSecurityGroupRequest, Model::CreateSecurityGroupOutcome> CreateSecurityGroupAwaitable(Model::CreateSecurityGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateSnapshotRequest, Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(Model::CreateSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of CreateSpotDatafeedSubscription(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateSpotDatafeedSubscriptionRequest, Model::CreateSpotDatafeedSubscriptionOutcome> CreateSpotDatafeedSubscriptionAwaitable(Model::CreateSpotDatafeedSubscriptionRequest request) const;
+
+        /**
+         * co_await-able form of CreateSubnet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateSubnetRequest, Model::CreateSubnetOutcome> CreateSubnetAwaitable(Model::CreateSubnetRequest request) const;
+
+        /**
+         * co_await-able form of CreateTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateTagsRequest, Model::CreateTagsOutcome> CreateTagsAwaitable(Model::CreateTagsRequest request) const;
+
+        /**
+         * co_await-able form of CreateVolume(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateVolumeRequest, Model::CreateVolumeOutcome> CreateVolumeAwaitable(Model::CreateVolumeRequest request) const;
+
+        /**
+         * co_await-able form of CreateVpc(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateVpcRequest, Model::CreateVpcOutcome> CreateVpcAwaitable(Model::CreateVpcRequest request) const;
+
+        /**
+         * co_await-able form of CreateVpcEndpoint(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateVpcEndpointRequest, Model::CreateVpcEndpointOutcome> CreateVpcEndpointAwaitable(Model::CreateVpcEndpointRequest request) const;
+
+        /**
+         * co_await-able form of CreateVpcPeeringConnection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateVpcPeeringConnectionRequest, Model::CreateVpcPeeringConnectionOutcome> CreateVpcPeeringConnectionAwaitable(Model::CreateVpcPeeringConnectionRequest request) const;
+
+        /**
+         * co_await-able form of CreateVpnConnection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateVpnConnectionRequest, Model::CreateVpnConnectionOutcome> CreateVpnConnectionAwaitable(Model::CreateVpnConnectionRequest request) const;
+
+        /**
+         * co_await-able form of CreateVpnConnectionRoute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateVpnConnectionRouteRequest, Model::CreateVpnConnectionRouteOutcome> CreateVpnConnectionRouteAwaitable(Model::CreateVpnConnectionRouteRequest request) const;
+
+        /**
+         * co_await-able form of CreateVpnGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::CreateVpnGatewayRequest, Model::CreateVpnGatewayOutcome> CreateVpnGatewayAwaitable(Model::CreateVpnGatewayRequest request) const;
+
+        /**
+         * co_await-able form of DeleteCustomerGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteCustomerGatewayRequest, Model::DeleteCustomerGatewayOutcome> DeleteCustomerGatewayAwaitable(Model::DeleteCustomerGatewayRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDhcpOptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteDhcpOptionsRequest, Model::DeleteDhcpOptionsOutcome> DeleteDhcpOptionsAwaitable(Model::DeleteDhcpOptionsRequest request) const;
+
+        /**
+         * co_await-able form of DeleteFlowLogs(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteFlowLogsRequest, Model::DeleteFlowLogsOutcome> DeleteFlowLogsAwaitable(Model::DeleteFlowLogsRequest request) const;
+
+        /**
+         * co_await-able form of DeleteInternetGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteInternetGatewayRequest, Model::DeleteInternetGatewayOutcome> DeleteInternetGatewayAwaitable(Model::DeleteInternetGatewayRequest request) const;
+
+        /**
+         * co_await-able form of DeleteKeyPair(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteKeyPairRequest, Model::DeleteKeyPairOutcome> DeleteKeyPairAwaitable(Model::DeleteKeyPairRequest request) const;
+
+        /**
+         * co_await-able form of DeleteNatGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteNatGatewayRequest, Model::DeleteNatGatewayOutcome> DeleteNatGatewayAwaitable(Model::DeleteNatGatewayRequest request) const;
+
+        /**
+         * co_await-able form of DeleteNetworkAcl(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteNetworkAclRequest, Model::DeleteNetworkAclOutcome> DeleteNetworkAclAwaitable(Model::DeleteNetworkAclRequest request) const;
+
+        /**
+         * co_await-able form of DeleteNetworkAclEntry(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteNetworkAclEntryRequest, Model::DeleteNetworkAclEntryOutcome> DeleteNetworkAclEntryAwaitable(Model::DeleteNetworkAclEntryRequest request) const;
+
+        /**
+         * co_await-able form of DeleteNetworkInterface(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteNetworkInterfaceRequest, Model::DeleteNetworkInterfaceOutcome> DeleteNetworkInterfaceAwaitable(Model::DeleteNetworkInterfaceRequest request) const;
+
+        /**
+         * co_await-able form of DeletePlacementGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeletePlacementGroupRequest, Model::DeletePlacementGroupOutcome> DeletePlacementGroupAwaitable(Model::DeletePlacementGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRoute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteRouteRequest, Model::DeleteRouteOutcome> DeleteRouteAwaitable(Model::DeleteRouteRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRouteTable(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteRouteTableRequest, Model::DeleteRouteTableOutcome> DeleteRouteTableAwaitable(Model::DeleteRouteTableRequest request) const;
+
+        /**
+         * co_await-able form of DeleteSecurityGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteSecurityGroupRequest, Model::DeleteSecurityGroupOutcome> DeleteSecurityGroupAwaitable(Model::DeleteSecurityGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteSnapshotRequest, Model::DeleteSnapshotOutcome> DeleteSnapshotAwaitable(Model::DeleteSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of DeleteSpotDatafeedSubscription(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteSpotDatafeedSubscriptionRequest, Model::DeleteSpotDatafeedSubscriptionOutcome> DeleteSpotDatafeedSubscriptionAwaitable(Model::DeleteSpotDatafeedSubscriptionRequest request) const;
+
+        /**
+         * co_await-able form of DeleteSubnet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteSubnetRequest, Model::DeleteSubnetOutcome> DeleteSubnetAwaitable(Model::DeleteSubnetRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteTagsRequest, Model::DeleteTagsOutcome> DeleteTagsAwaitable(Model::DeleteTagsRequest request) const;
+
+        /**
+         * co_await-able form of DeleteVolume(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteVolumeRequest, Model::DeleteVolumeOutcome> DeleteVolumeAwaitable(Model::DeleteVolumeRequest request) const;
+
+        /**
+         * co_await-able form of DeleteVpc(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteVpcRequest, Model::DeleteVpcOutcome> DeleteVpcAwaitable(Model::DeleteVpcRequest request) const;
+
+        /**
+         * co_await-able form of DeleteVpcEndpoints(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteVpcEndpointsRequest, Model::DeleteVpcEndpointsOutcome> DeleteVpcEndpointsAwaitable(Model::DeleteVpcEndpointsRequest request) const;
+
+        /**
+         * co_await-able form of DeleteVpcPeeringConnection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteVpcPeeringConnectionRequest, Model::DeleteVpcPeeringConnectionOutcome> DeleteVpcPeeringConnectionAwaitable(Model::DeleteVpcPeeringConnectionRequest request) const;
+
+        /**
+         * co_await-able form of DeleteVpnConnection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteVpnConnectionRequest, Model::DeleteVpnConnectionOutcome> DeleteVpnConnectionAwaitable(Model::DeleteVpnConnectionRequest request) const;
+
+        /**
+         * co_await-able form of DeleteVpnConnectionRoute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteVpnConnectionRouteRequest, Model::DeleteVpnConnectionRouteOutcome> DeleteVpnConnectionRouteAwaitable(Model::DeleteVpnConnectionRouteRequest request) const;
+
+        /**
+         * co_await-able form of DeleteVpnGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeleteVpnGatewayRequest, Model::DeleteVpnGatewayOutcome> DeleteVpnGatewayAwaitable(Model::DeleteVpnGatewayRequest request) const;
+
+        /**
+         * co_await-able form of DeregisterImage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DeregisterImageRequest, Model::DeregisterImageOutcome> DeregisterImageAwaitable(Model::DeregisterImageRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAccountAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeAccountAttributesRequest, Model::DescribeAccountAttributesOutcome> DescribeAccountAttributesAwaitable(Model::DescribeAccountAttributesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAddresses(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeAddressesRequest, Model::DescribeAddressesOutcome> DescribeAddressesAwaitable(Model::DescribeAddressesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAvailabilityZones(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeAvailabilityZonesRequest, Model::DescribeAvailabilityZonesOutcome> DescribeAvailabilityZonesAwaitable(Model::DescribeAvailabilityZonesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeBundleTasks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeBundleTasksRequest, Model::DescribeBundleTasksOutcome> DescribeBundleTasksAwaitable(Model::DescribeBundleTasksRequest request) const;
+
+        /**
+         * co_await-able form of DescribeClassicLinkInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeClassicLinkInstancesRequest, Model::DescribeClassicLinkInstancesOutcome> DescribeClassicLinkInstancesAwaitable(Model::DescribeClassicLinkInstancesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeConversionTasks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeConversionTasksRequest, Model::DescribeConversionTasksOutcome> DescribeConversionTasksAwaitable(Model::DescribeConversionTasksRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCustomerGateways(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeCustomerGatewaysRequest, Model::DescribeCustomerGatewaysOutcome> DescribeCustomerGatewaysAwaitable(Model::DescribeCustomerGatewaysRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDhcpOptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeDhcpOptionsRequest, Model::DescribeDhcpOptionsOutcome> DescribeDhcpOptionsAwaitable(Model::DescribeDhcpOptionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeExportTasks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeExportTasksRequest, Model::DescribeExportTasksOutcome> DescribeExportTasksAwaitable(Model::DescribeExportTasksRequest request) const;
+
+        /**
+         * co_await-able form of DescribeFlowLogs(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeFlowLogsRequest, Model::DescribeFlowLogsOutcome> DescribeFlowLogsAwaitable(Model::DescribeFlowLogsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeHosts(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeHostsRequest, Model::DescribeHostsOutcome> DescribeHostsAwaitable(Model::DescribeHostsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeIdFormat(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeIdFormatRequest, Model::DescribeIdFormatOutcome> DescribeIdFormatAwaitable(Model::DescribeIdFormatRequest request) const;
+
+        /**
+         * co_await-able form of DescribeImageAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeImageAttributeRequest, Model::DescribeImageAttributeOutcome> DescribeImageAttributeAwaitable(Model::DescribeImageAttributeRequest request) const;
+
+        /**
+         * co_await-able form of DescribeImages(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeImagesRequest, Model::DescribeImagesOutcome> DescribeImagesAwaitable(Model::DescribeImagesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeImportImageTasks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeImportImageTasksRequest, Model::DescribeImportImageTasksOutcome> DescribeImportImageTasksAwaitable(Model::DescribeImportImageTasksRequest request) const;
+
+        /**
+         * co_await-able form of DescribeImportSnapshotTasks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeImportSnapshotTasksRequest, Model::DescribeImportSnapshotTasksOutcome> DescribeImportSnapshotTasksAwaitable(Model::DescribeImportSnapshotTasksRequest request) const;
+
+        /**
+         * co_await-able form of DescribeInstanceAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeInstanceAttributeRequest, Model::DescribeInstanceAttributeOutcome> DescribeInstanceAttributeAwaitable(Model::DescribeInstanceAttributeRequest request) const;
+
+        /**
+         * co_await-able form of DescribeInstanceStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeInstanceStatusRequest, Model::DescribeInstanceStatusOutcome> DescribeInstanceStatusAwaitable(Model::DescribeInstanceStatusRequest request) const;
+
+        /**
+         * co_await-able form of DescribeInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeInstancesRequest, Model::DescribeInstancesOutcome> DescribeInstancesAwaitable(Model::DescribeInstancesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeInternetGateways(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeInternetGatewaysRequest, Model::DescribeInternetGatewaysOutcome> DescribeInternetGatewaysAwaitable(Model::DescribeInternetGatewaysRequest request) const;
+
+        /**
+         * co_await-able form of DescribeKeyPairs(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeKeyPairsRequest, Model::DescribeKeyPairsOutcome> DescribeKeyPairsAwaitable(Model::DescribeKeyPairsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeMovingAddresses(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeMovingAddressesRequest, Model::DescribeMovingAddressesOutcome> DescribeMovingAddressesAwaitable(Model::DescribeMovingAddressesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeNatGateways(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeNatGatewaysRequest, Model::DescribeNatGatewaysOutcome> DescribeNatGatewaysAwaitable(Model::DescribeNatGatewaysRequest request) const;
+
+        /**
+         * co_await-able form of DescribeNetworkAcls(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeNetworkAclsRequest, Model::DescribeNetworkAclsOutcome> DescribeNetworkAclsAwaitable(Model::DescribeNetworkAclsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeNetworkInterfaceAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeNetworkInterfaceAttributeRequest, Model::DescribeNetworkInterfaceAttributeOutcome> DescribeNetworkInterfaceAttributeAwaitable(Model::DescribeNetworkInterfaceAttributeRequest request) const;
+
+        /**
+         * co_await-able form of DescribeNetworkInterfaces(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeNetworkInterfacesRequest, Model::DescribeNetworkInterfacesOutcome> DescribeNetworkInterfacesAwaitable(Model::DescribeNetworkInterfacesRequest request) const;
+
+        /**
+         * co_await-able form of DescribePlacementGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribePlacementGroupsRequest, Model::DescribePlacementGroupsOutcome> DescribePlacementGroupsAwaitable(Model::DescribePlacementGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribePrefixLists(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribePrefixListsRequest, Model::DescribePrefixListsOutcome> DescribePrefixListsAwaitable(Model::DescribePrefixListsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeRegions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeRegionsRequest, Model::DescribeRegionsOutcome> DescribeRegionsAwaitable(Model::DescribeRegionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReservedInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeReservedInstancesRequest, Model::DescribeReservedInstancesOutcome> DescribeReservedInstancesAwaitable(Model::DescribeReservedInstancesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReservedInstancesListings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeReservedInstancesListingsRequest, Model::DescribeReservedInstancesListingsOutcome> DescribeReservedInstancesListingsAwaitable(Model::DescribeReservedInstancesListingsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReservedInstancesModifications(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeReservedInstancesModificationsRequest, Model::DescribeReservedInstancesModificationsOutcome> DescribeReservedInstancesModificationsAwaitable(Model::DescribeReservedInstancesModificationsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReservedInstancesOfferings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeReservedInstancesOfferingsRequest, Model::DescribeReservedInstancesOfferingsOutcome> DescribeReservedInstancesOfferingsAwaitable(Model::DescribeReservedInstancesOfferingsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeRouteTables(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeRouteTablesRequest, Model::DescribeRouteTablesOutcome> DescribeRouteTablesAwaitable(Model::DescribeRouteTablesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeScheduledInstanceAvailability(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeScheduledInstanceAvailabilityRequest, Model::DescribeScheduledInstanceAvailabilityOutcome> DescribeScheduledInstanceAvailabilityAwaitable(Model::DescribeScheduledInstanceAvailabilityRequest request) const;
+
+        /**
+         * co_await-able form of DescribeScheduledInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeScheduledInstancesRequest, Model::DescribeScheduledInstancesOutcome> DescribeScheduledInstancesAwaitable(Model::DescribeScheduledInstancesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSecurityGroupReferences(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeSecurityGroupReferencesRequest, Model::DescribeSecurityGroupReferencesOutcome> DescribeSecurityGroupReferencesAwaitable(Model::DescribeSecurityGroupReferencesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSecurityGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeSecurityGroupsRequest, Model::DescribeSecurityGroupsOutcome> DescribeSecurityGroupsAwaitable(Model::DescribeSecurityGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSnapshotAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeSnapshotAttributeRequest, Model::DescribeSnapshotAttributeOutcome> DescribeSnapshotAttributeAwaitable(Model::DescribeSnapshotAttributeRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSnapshots(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeSnapshotsRequest, Model::DescribeSnapshotsOutcome> DescribeSnapshotsAwaitable(Model::DescribeSnapshotsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSpotDatafeedSubscription(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeSpotDatafeedSubscriptionRequest, Model::DescribeSpotDatafeedSubscriptionOutcome> DescribeSpotDatafeedSubscriptionAwaitable(Model::DescribeSpotDatafeedSubscriptionRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSpotFleetInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeSpotFleetInstancesRequest, Model::DescribeSpotFleetInstancesOutcome> DescribeSpotFleetInstancesAwaitable(Model::DescribeSpotFleetInstancesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSpotFleetRequestHistory(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeSpotFleetRequestHistoryRequest, Model::DescribeSpotFleetRequestHistoryOutcome> DescribeSpotFleetRequestHistoryAwaitable(Model::DescribeSpotFleetRequestHistoryRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSpotFleetRequests(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeSpotFleetRequestsRequest, Model::DescribeSpotFleetRequestsOutcome> DescribeSpotFleetRequestsAwaitable(Model::DescribeSpotFleetRequestsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSpotInstanceRequests(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeSpotInstanceRequestsRequest, Model::DescribeSpotInstanceRequestsOutcome> DescribeSpotInstanceRequestsAwaitable(Model::DescribeSpotInstanceRequestsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSpotPriceHistory(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeSpotPriceHistoryRequest, Model::DescribeSpotPriceHistoryOutcome> DescribeSpotPriceHistoryAwaitable(Model::DescribeSpotPriceHistoryRequest request) const;
+
+        /**
+         * co_await-able form of DescribeStaleSecurityGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeStaleSecurityGroupsRequest, Model::DescribeStaleSecurityGroupsOutcome> DescribeStaleSecurityGroupsAwaitable(Model::DescribeStaleSecurityGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSubnets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeSubnetsRequest, Model::DescribeSubnetsOutcome> DescribeSubnetsAwaitable(Model::DescribeSubnetsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeTagsRequest, Model::DescribeTagsOutcome> DescribeTagsAwaitable(Model::DescribeTagsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeVolumeAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeVolumeAttributeRequest, Model::DescribeVolumeAttributeOutcome> DescribeVolumeAttributeAwaitable(Model::DescribeVolumeAttributeRequest request) const;
+
+        /**
+         * co_await-able form of DescribeVolumeStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeVolumeStatusRequest, Model::DescribeVolumeStatusOutcome> DescribeVolumeStatusAwaitable(Model::DescribeVolumeStatusRequest request) const;
+
+        /**
+         * co_await-able form of DescribeVolumes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeVolumesRequest, Model::DescribeVolumesOutcome> DescribeVolumesAwaitable(Model::DescribeVolumesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeVpcAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeVpcAttributeRequest, Model::DescribeVpcAttributeOutcome> DescribeVpcAttributeAwaitable(Model::DescribeVpcAttributeRequest request) const;
+
+        /**
+         * co_await-able form of DescribeVpcClassicLink(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeVpcClassicLinkRequest, Model::DescribeVpcClassicLinkOutcome> DescribeVpcClassicLinkAwaitable(Model::DescribeVpcClassicLinkRequest request) const;
+
+        /**
+         * co_await-able form of DescribeVpcClassicLinkDnsSupport(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeVpcClassicLinkDnsSupportRequest, Model::DescribeVpcClassicLinkDnsSupportOutcome> DescribeVpcClassicLinkDnsSupportAwaitable(Model::DescribeVpcClassicLinkDnsSupportRequest request) const;
+
+        /**
+         * co_await-able form of DescribeVpcEndpointServices(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeVpcEndpointServicesRequest, Model::DescribeVpcEndpointServicesOutcome> DescribeVpcEndpointServicesAwaitable(Model::DescribeVpcEndpointServicesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeVpcEndpoints(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeVpcEndpointsRequest, Model::DescribeVpcEndpointsOutcome> DescribeVpcEndpointsAwaitable(Model::DescribeVpcEndpointsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeVpcPeeringConnections(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeVpcPeeringConnectionsRequest, Model::DescribeVpcPeeringConnectionsOutcome> DescribeVpcPeeringConnectionsAwaitable(Model::DescribeVpcPeeringConnectionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeVpcs(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeVpcsRequest, Model::DescribeVpcsOutcome> DescribeVpcsAwaitable(Model::DescribeVpcsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeVpnConnections(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeVpnConnectionsRequest, Model::DescribeVpnConnectionsOutcome> DescribeVpnConnectionsAwaitable(Model::DescribeVpnConnectionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeVpnGateways(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DescribeVpnGatewaysRequest, Model::DescribeVpnGatewaysOutcome> DescribeVpnGatewaysAwaitable(Model::DescribeVpnGatewaysRequest request) const;
+
+        /**
+         * co_await-able form of DetachClassicLinkVpc(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DetachClassicLinkVpcRequest, Model::DetachClassicLinkVpcOutcome> DetachClassicLinkVpcAwaitable(Model::DetachClassicLinkVpcRequest request) const;
+
+        /**
+         * co_await-able form of DetachInternetGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DetachInternetGatewayRequest, Model::DetachInternetGatewayOutcome> DetachInternetGatewayAwaitable(Model::DetachInternetGatewayRequest request) const;
+
+        /**
+         * co_await-able form of DetachNetworkInterface(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DetachNetworkInterfaceRequest, Model::DetachNetworkInterfaceOutcome> DetachNetworkInterfaceAwaitable(Model::DetachNetworkInterfaceRequest request) const;
+
+        /**
+         * co_await-able form of DetachVolume(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DetachVolumeRequest, Model::DetachVolumeOutcome> DetachVolumeAwaitable(Model::DetachVolumeRequest request) const;
+
+        /**
+         * co_await-able form of DetachVpnGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DetachVpnGatewayRequest, Model::DetachVpnGatewayOutcome> DetachVpnGatewayAwaitable(Model::DetachVpnGatewayRequest request) const;
+
+        /**
+         * co_await-able form of DisableVgwRoutePropagation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DisableVgwRoutePropagationRequest, Model::DisableVgwRoutePropagationOutcome> DisableVgwRoutePropagationAwaitable(Model::DisableVgwRoutePropagationRequest request) const;
+
+        /**
+         * co_await-able form of DisableVpcClassicLink(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DisableVpcClassicLinkRequest, Model::DisableVpcClassicLinkOutcome> DisableVpcClassicLinkAwaitable(Model::DisableVpcClassicLinkRequest request) const;
+
+        /**
+         * co_await-able form of DisableVpcClassicLinkDnsSupport(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DisableVpcClassicLinkDnsSupportRequest, Model::DisableVpcClassicLinkDnsSupportOutcome> DisableVpcClassicLinkDnsSupportAwaitable(Model::DisableVpcClassicLinkDnsSupportRequest request) const;
+
+        /**
+         * co_await-able form of DisassociateAddress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DisassociateAddressRequest, Model::DisassociateAddressOutcome> DisassociateAddressAwaitable(Model::DisassociateAddressRequest request) const;
+
+        /**
+         * co_await-able form of DisassociateRouteTable(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::DisassociateRouteTableRequest, Model::DisassociateRouteTableOutcome> DisassociateRouteTableAwaitable(Model::DisassociateRouteTableRequest request) const;
+
+        /**
+         * co_await-able form of EnableVgwRoutePropagation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::EnableVgwRoutePropagationRequest, Model::EnableVgwRoutePropagationOutcome> EnableVgwRoutePropagationAwaitable(Model::EnableVgwRoutePropagationRequest request) const;
+
+        /**
+         * co_await-able form of EnableVolumeIO(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::EnableVolumeIORequest, Model::EnableVolumeIOOutcome> EnableVolumeIOAwaitable(Model::EnableVolumeIORequest request) const;
+
+        /**
+         * co_await-able form of EnableVpcClassicLink(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::EnableVpcClassicLinkRequest, Model::EnableVpcClassicLinkOutcome> EnableVpcClassicLinkAwaitable(Model::EnableVpcClassicLinkRequest request) const;
+
+        /**
+         * co_await-able form of EnableVpcClassicLinkDnsSupport(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::EnableVpcClassicLinkDnsSupportRequest, Model::EnableVpcClassicLinkDnsSupportOutcome> EnableVpcClassicLinkDnsSupportAwaitable(Model::EnableVpcClassicLinkDnsSupportRequest request) const;
+
+        /**
+         * co_await-able form of GetConsoleOutput(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::GetConsoleOutputRequest, Model::GetConsoleOutputOutcome> GetConsoleOutputAwaitable(Model::GetConsoleOutputRequest request) const;
+
+        /**
+         * co_await-able form of GetConsoleScreenshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::GetConsoleScreenshotRequest, Model::GetConsoleScreenshotOutcome> GetConsoleScreenshotAwaitable(Model::GetConsoleScreenshotRequest request) const;
+
+        /**
+         * co_await-able form of GetPasswordData(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::GetPasswordDataRequest, Model::GetPasswordDataOutcome> GetPasswordDataAwaitable(Model::GetPasswordDataRequest request) const;
+
+        /**
+         * co_await-able form of ImportImage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ImportImageRequest, Model::ImportImageOutcome> ImportImageAwaitable(Model::ImportImageRequest request) const;
+
+        /**
+         * co_await-able form of ImportInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ImportInstanceRequest, Model::ImportInstanceOutcome> ImportInstanceAwaitable(Model::ImportInstanceRequest request) const;
+
+        /**
+         * co_await-able form of ImportKeyPair(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ImportKeyPairRequest, Model::ImportKeyPairOutcome> ImportKeyPairAwaitable(Model::ImportKeyPairRequest request) const;
+
+        /**
+         * co_await-able form of ImportSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ImportSnapshotRequest, Model::ImportSnapshotOutcome> ImportSnapshotAwaitable(Model::ImportSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of ImportVolume(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ImportVolumeRequest, Model::ImportVolumeOutcome> ImportVolumeAwaitable(Model::ImportVolumeRequest request) const;
+
+        /**
+         * co_await-able form of ModifyHosts(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ModifyHostsRequest, Model::ModifyHostsOutcome> ModifyHostsAwaitable(Model::ModifyHostsRequest request) const;
+
+        /**
+         * co_await-able form of ModifyIdFormat(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ModifyIdFormatRequest, Model::ModifyIdFormatOutcome> ModifyIdFormatAwaitable(Model::ModifyIdFormatRequest request) const;
+
+        /**
+         * co_await-able form of ModifyImageAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ModifyImageAttributeRequest, Model::ModifyImageAttributeOutcome> ModifyImageAttributeAwaitable(Model::ModifyImageAttributeRequest request) const;
+
+        /**
+         * co_await-able form of ModifyInstanceAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ModifyInstanceAttributeRequest, Model::ModifyInstanceAttributeOutcome> ModifyInstanceAttributeAwaitable(Model::ModifyInstanceAttributeRequest request) const;
+
+        /**
+         * co_await-able form of ModifyInstancePlacement(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ModifyInstancePlacementRequest, Model::ModifyInstancePlacementOutcome> ModifyInstancePlacementAwaitable(Model::ModifyInstancePlacementRequest request) const;
+
+        /**
+         * co_await-able form of ModifyNetworkInterfaceAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ModifyNetworkInterfaceAttributeRequest, Model::ModifyNetworkInterfaceAttributeOutcome> ModifyNetworkInterfaceAttributeAwaitable(Model::ModifyNetworkInterfaceAttributeRequest request) const;
+
+        /**
+         * co_await-able form of ModifyReservedInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ModifyReservedInstancesRequest, Model::ModifyReservedInstancesOutcome> ModifyReservedInstancesAwaitable(Model::ModifyReservedInstancesRequest request) const;
+
+        /**
+         * co_await-able form of ModifySnapshotAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ModifySnapshotAttributeRequest, Model::ModifySnapshotAttributeOutcome> ModifySnapshotAttributeAwaitable(Model::ModifySnapshotAttributeRequest request) const;
+
+        /**
+         * co_await-able form of ModifySpotFleetRequest(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ModifySpotFleetRequestRequest, Model::ModifySpotFleetRequestOutcome> ModifySpotFleetRequestAwaitable(Model::ModifySpotFleetRequestRequest request) const;
+
+        /**
+         * co_await-able form of ModifySubnetAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ModifySubnetAttributeRequest, Model::ModifySubnetAttributeOutcome> ModifySubnetAttributeAwaitable(Model::ModifySubnetAttributeRequest request) const;
+
+        /**
+         * co_await-able form of ModifyVolumeAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ModifyVolumeAttributeRequest, Model::ModifyVolumeAttributeOutcome> ModifyVolumeAttributeAwaitable(Model::ModifyVolumeAttributeRequest request) const;
+
+        /**
+         * co_await-able form of ModifyVpcAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ModifyVpcAttributeRequest, Model::ModifyVpcAttributeOutcome> ModifyVpcAttributeAwaitable(Model::ModifyVpcAttributeRequest request) const;
+
+        /**
+         * co_await-able form of ModifyVpcEndpoint(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ModifyVpcEndpointRequest, Model::ModifyVpcEndpointOutcome> ModifyVpcEndpointAwaitable(Model::ModifyVpcEndpointRequest request) const;
+
+        /**
+         * co_await-able form of ModifyVpcPeeringConnectionOptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ModifyVpcPeeringConnectionOptionsRequest, Model::ModifyVpcPeeringConnectionOptionsOutcome> ModifyVpcPeeringConnectionOptionsAwaitable(Model::ModifyVpcPeeringConnectionOptionsRequest request) const;
+
+        /**
+         * co_await-able form of MonitorInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::MonitorInstancesRequest, Model::MonitorInstancesOutcome> MonitorInstancesAwaitable(Model::MonitorInstancesRequest request) const;
+
+        /**
+         * co_await-able form of MoveAddressToVpc(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::MoveAddressToVpcRequest, Model::MoveAddressToVpcOutcome> MoveAddressToVpcAwaitable(Model::MoveAddressToVpcRequest request) const;
+
+        /**
+         * co_await-able form of PurchaseReservedInstancesOffering(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::PurchaseReservedInstancesOfferingRequest, Model::PurchaseReservedInstancesOfferingOutcome> PurchaseReservedInstancesOfferingAwaitable(Model::PurchaseReservedInstancesOfferingRequest request) const;
+
+        /**
+         * co_await-able form of PurchaseScheduledInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::PurchaseScheduledInstancesRequest, Model::PurchaseScheduledInstancesOutcome> PurchaseScheduledInstancesAwaitable(Model::PurchaseScheduledInstancesRequest request) const;
+
+        /**
+         * co_await-able form of RebootInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::RebootInstancesRequest, Model::RebootInstancesOutcome> RebootInstancesAwaitable(Model::RebootInstancesRequest request) const;
+
+        /**
+         * co_await-able form of RegisterImage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::RegisterImageRequest, Model::RegisterImageOutcome> RegisterImageAwaitable(Model::RegisterImageRequest request) const;
+
+        /**
+         * co_await-able form of RejectVpcPeeringConnection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::RejectVpcPeeringConnectionRequest, Model::RejectVpcPeeringConnectionOutcome> RejectVpcPeeringConnectionAwaitable(Model::RejectVpcPeeringConnectionRequest request) const;
+
+        /**
+         * co_await-able form of ReleaseAddress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ReleaseAddressRequest, Model::ReleaseAddressOutcome> ReleaseAddressAwaitable(Model::ReleaseAddressRequest request) const;
+
+        /**
+         * co_await-able form of ReleaseHosts(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ReleaseHostsRequest, Model::ReleaseHostsOutcome> ReleaseHostsAwaitable(Model::ReleaseHostsRequest request) const;
+
+        /**
+         * co_await-able form of ReplaceNetworkAclAssociation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ReplaceNetworkAclAssociationRequest, Model::ReplaceNetworkAclAssociationOutcome> ReplaceNetworkAclAssociationAwaitable(Model::ReplaceNetworkAclAssociationRequest request) const;
+
+        /**
+         * co_await-able form of ReplaceNetworkAclEntry(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ReplaceNetworkAclEntryRequest, Model::ReplaceNetworkAclEntryOutcome> ReplaceNetworkAclEntryAwaitable(Model::ReplaceNetworkAclEntryRequest request) const;
+
+        /**
+         * co_await-able form of ReplaceRoute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ReplaceRouteRequest, Model::ReplaceRouteOutcome> ReplaceRouteAwaitable(Model::ReplaceRouteRequest request) const;
+
+        /**
+         * co_await-able form of ReplaceRouteTableAssociation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ReplaceRouteTableAssociationRequest, Model::ReplaceRouteTableAssociationOutcome> ReplaceRouteTableAssociationAwaitable(Model::ReplaceRouteTableAssociationRequest request) const;
+
+        /**
+         * co_await-able form of ReportInstanceStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ReportInstanceStatusRequest, Model::ReportInstanceStatusOutcome> ReportInstanceStatusAwaitable(Model::ReportInstanceStatusRequest request) const;
+
+        /**
+         * co_await-able form of RequestSpotFleet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::RequestSpotFleetRequest, Model::RequestSpotFleetOutcome> RequestSpotFleetAwaitable(Model::RequestSpotFleetRequest request) const;
+
+        /**
+         * co_await-able form of RequestSpotInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::RequestSpotInstancesRequest, Model::RequestSpotInstancesOutcome> RequestSpotInstancesAwaitable(Model::RequestSpotInstancesRequest request) const;
+
+        /**
+         * co_await-able form of ResetImageAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ResetImageAttributeRequest, Model::ResetImageAttributeOutcome> ResetImageAttributeAwaitable(Model::ResetImageAttributeRequest request) const;
+
+        /**
+         * co_await-able form of ResetInstanceAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ResetInstanceAttributeRequest, Model::ResetInstanceAttributeOutcome> ResetInstanceAttributeAwaitable(Model::ResetInstanceAttributeRequest request) const;
+
+        /**
+         * co_await-able form of ResetNetworkInterfaceAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ResetNetworkInterfaceAttributeRequest, Model::ResetNetworkInterfaceAttributeOutcome> ResetNetworkInterfaceAttributeAwaitable(Model::ResetNetworkInterfaceAttributeRequest request) const;
+
+        /**
+         * co_await-able form of ResetSnapshotAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::ResetSnapshotAttributeRequest, Model::ResetSnapshotAttributeOutcome> ResetSnapshotAttributeAwaitable(Model::ResetSnapshotAttributeRequest request) const;
+
+        /**
+         * co_await-able form of RestoreAddressToClassic(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::RestoreAddressToClassicRequest, Model::RestoreAddressToClassicOutcome> RestoreAddressToClassicAwaitable(Model::RestoreAddressToClassicRequest request) const;
+
+        /**
+         * co_await-able form of RevokeSecurityGroupEgress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::RevokeSecurityGroupEgressRequest, Model::RevokeSecurityGroupEgressOutcome> RevokeSecurityGroupEgressAwaitable(Model::RevokeSecurityGroupEgressRequest request) const;
+
+        /**
+         * co_await-able form of RevokeSecurityGroupIngress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::RevokeSecurityGroupIngressRequest, Model::RevokeSecurityGroupIngressOutcome> RevokeSecurityGroupIngressAwaitable(Model::RevokeSecurityGroupIngressRequest request) const;
+
+        /**
+         * co_await-able form of RunInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::RunInstancesRequest, Model::RunInstancesOutcome> RunInstancesAwaitable(Model::RunInstancesRequest request) const;
+
+        /**
+         * co_await-able form of RunScheduledInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::RunScheduledInstancesRequest, Model::RunScheduledInstancesOutcome> RunScheduledInstancesAwaitable(Model::RunScheduledInstancesRequest request) const;
+
+        /**
+         * co_await-able form of StartInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::StartInstancesRequest, Model::StartInstancesOutcome> StartInstancesAwaitable(Model::StartInstancesRequest request) const;
+
+        /**
+         * co_await-able form of StopInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::StopInstancesRequest, Model::StopInstancesOutcome> StopInstancesAwaitable(Model::StopInstancesRequest request) const;
+
+        /**
+         * co_await-able form of TerminateInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::TerminateInstancesRequest, Model::TerminateInstancesOutcome> TerminateInstancesAwaitable(Model::TerminateInstancesRequest request) const;
+
+        /**
+         * co_await-able form of UnassignPrivateIpAddresses(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::UnassignPrivateIpAddressesRequest, Model::UnassignPrivateIpAddressesOutcome> UnassignPrivateIpAddressesAwaitable(Model::UnassignPrivateIpAddressesRequest request) const;
+
+        /**
+         * co_await-able form of UnmonitorInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EC2Client, Model::UnmonitorInstancesRequest, Model::UnmonitorInstancesOutcome> UnmonitorInstancesAwaitable(Model::UnmonitorInstancesRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AcceptVpcPeeringConnectionRequest();
+    inline const char* GetServiceRequestName() const override { return "AcceptVpcPeeringConnection"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AllocateAddressRequest();
+    inline const char* GetServiceRequestName() const override { return "AllocateAddress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
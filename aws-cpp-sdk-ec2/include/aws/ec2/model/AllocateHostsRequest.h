@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AllocateHostsRequest();
+    inline const char* GetServiceRequestName() const override { return "AllocateHosts"; }
+
     Aws::String SerializePayload() const override;
 
     /**
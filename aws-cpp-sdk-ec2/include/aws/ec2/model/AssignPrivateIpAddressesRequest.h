@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AssignPrivateIpAddressesRequest();
+    inline const char* GetServiceRequestName() const override { return "AssignPrivateIpAddresses"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AssociateAddressRequest();
+    inline const char* GetServiceRequestName() const override { return "AssociateAddress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
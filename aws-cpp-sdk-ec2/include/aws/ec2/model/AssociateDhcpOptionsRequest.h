@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AssociateDhcpOptionsRequest();
+    inline const char* GetServiceRequestName() const override { return "AssociateDhcpOptions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AssociateRouteTableRequest();
+    inline const char* GetServiceRequestName() const override { return "AssociateRouteTable"; }
+
     Aws::String SerializePayload() const override;
 
     /**
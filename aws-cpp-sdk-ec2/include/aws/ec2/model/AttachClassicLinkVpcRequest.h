@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AttachClassicLinkVpcRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachClassicLinkVpc"; }
+
     Aws::String SerializePayload() const override;
 
     /**
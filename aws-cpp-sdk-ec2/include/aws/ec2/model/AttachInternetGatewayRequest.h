@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AttachInternetGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachInternetGateway"; }
+
     Aws::String SerializePayload() const override;
 
     /**
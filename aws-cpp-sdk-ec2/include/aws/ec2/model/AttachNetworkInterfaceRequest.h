@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AttachNetworkInterfaceRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachNetworkInterface"; }
+
     Aws::String SerializePayload() const override;
 
     /**
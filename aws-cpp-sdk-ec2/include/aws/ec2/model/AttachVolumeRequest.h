@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AttachVolumeRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachVolume"; }
+
     Aws::String SerializePayload() const override;
 
     /**
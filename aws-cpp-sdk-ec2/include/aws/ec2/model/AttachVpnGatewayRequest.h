@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AttachVpnGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachVpnGateway"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     AuthorizeSecurityGroupEgressRequest();
+    inline const char* GetServiceRequestName() const override { return "AuthorizeSecurityGroupEgress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     AuthorizeSecurityGroupIngressRequest();
+    inline const char* GetServiceRequestName() const override { return "AuthorizeSecurityGroupIngress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     BundleInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "BundleInstance"; }
+
     Aws::String SerializePayload() const override;
 
     /**
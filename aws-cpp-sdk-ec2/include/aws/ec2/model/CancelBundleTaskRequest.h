@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CancelBundleTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelBundleTask"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CancelConversionTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelConversionTask"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CancelExportTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelExportTask"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CancelImportTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelImportTask"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CancelReservedInstancesListingRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelReservedInstancesListing"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CancelSpotFleetRequestsRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelSpotFleetRequests"; }
+
     Aws::String SerializePayload() const override;
 
     /**
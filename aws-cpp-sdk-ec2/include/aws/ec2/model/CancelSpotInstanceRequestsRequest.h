@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CancelSpotInstanceRequestsRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelSpotInstanceRequests"; }
+
     Aws::String SerializePayload() const override;
 
     /**
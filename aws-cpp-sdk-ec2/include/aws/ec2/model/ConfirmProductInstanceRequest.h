@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ConfirmProductInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "ConfirmProductInstance"; }
+
     Aws::String SerializePayload() const override;
 
     /**
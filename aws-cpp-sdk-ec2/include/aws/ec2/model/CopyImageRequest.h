@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CopyImageRequest();
+    inline const char* GetServiceRequestName() const override { return "CopyImage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
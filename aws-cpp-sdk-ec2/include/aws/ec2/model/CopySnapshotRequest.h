@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CopySnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "CopySnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
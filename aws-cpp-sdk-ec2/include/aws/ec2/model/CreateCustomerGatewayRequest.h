@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateCustomerGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateCustomerGateway"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateDhcpOptionsRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDhcpOptions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateFlowLogsRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateFlowLogs"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateImageRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateImage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateInstanceExportTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateInstanceExportTask"; }
+
     Aws::String SerializePayload() const override;
 
     /**
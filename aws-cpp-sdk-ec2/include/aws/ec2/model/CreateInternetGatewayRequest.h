@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateInternetGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateInternetGateway"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateKeyPairRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateKeyPair"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateNatGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateNatGateway"; }
+
     Aws::String SerializePayload() const override;
 
     /**
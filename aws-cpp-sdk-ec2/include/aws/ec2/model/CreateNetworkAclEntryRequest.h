@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateNetworkAclEntryRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateNetworkAclEntry"; }
+
     Aws::String SerializePayload() const override;
 
     /**
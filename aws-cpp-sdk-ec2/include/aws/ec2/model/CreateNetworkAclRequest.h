@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateNetworkAclRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateNetworkAcl"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateNetworkInterfaceRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateNetworkInterface"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreatePlacementGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreatePlacementGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateReservedInstancesListingRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateReservedInstancesListing"; }
+
     Aws::String SerializePayload() const override;
 
     /**
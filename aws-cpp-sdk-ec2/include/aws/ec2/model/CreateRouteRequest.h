@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateRouteRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateRoute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
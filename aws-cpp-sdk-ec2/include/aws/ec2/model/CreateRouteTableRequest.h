@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateRouteTableRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateRouteTable"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateSecurityGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateSecurityGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
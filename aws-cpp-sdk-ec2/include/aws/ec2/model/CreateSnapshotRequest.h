@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateSpotDatafeedSubscriptionRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateSpotDatafeedSubscription"; }
+
     Aws::String SerializePayload() const override;
 
     /**
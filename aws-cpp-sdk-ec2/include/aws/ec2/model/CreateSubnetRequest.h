@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateSubnetRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateSubnet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateVolumeRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateVolume"; }
+
     Aws::String SerializePayload() const override;
 
     /**
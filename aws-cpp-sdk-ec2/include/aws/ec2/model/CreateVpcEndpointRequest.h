@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateVpcEndpointRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateVpcEndpoint"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateVpcPeeringConnectionRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateVpcPeeringConnection"; }
+
     Aws::String SerializePayload() const override;
 
     /**
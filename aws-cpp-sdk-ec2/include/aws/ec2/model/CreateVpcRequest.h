@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateVpcRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateVpc"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateVpnConnectionRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateVpnConnection"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateVpnConnectionRouteRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateVpnConnectionRoute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateVpnGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateVpnGateway"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteCustomerGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteCustomerGateway"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDhcpOptionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDhcpOptions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
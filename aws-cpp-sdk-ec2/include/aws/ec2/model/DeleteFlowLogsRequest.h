@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteFlowLogsRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteFlowLogs"; }
+
     Aws::String SerializePayload() const override;
 
     /**
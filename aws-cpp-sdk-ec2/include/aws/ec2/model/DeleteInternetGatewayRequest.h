@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteInternetGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteInternetGateway"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteKeyPairRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteKeyPair"; }
+
     Aws::String SerializePayload() const override;
 
     /**
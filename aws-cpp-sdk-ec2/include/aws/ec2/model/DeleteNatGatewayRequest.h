@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteNatGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteNatGateway"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteNetworkAclEntryRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteNetworkAclEntry"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteNetworkAclRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteNetworkAcl"; }
+
     Aws::String SerializePayload() const override;
 
     /**
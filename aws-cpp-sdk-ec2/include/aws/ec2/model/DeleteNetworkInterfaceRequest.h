@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteNetworkInterfaceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteNetworkInterface"; }
+
     Aws::String SerializePayload() const override;
 
     /**
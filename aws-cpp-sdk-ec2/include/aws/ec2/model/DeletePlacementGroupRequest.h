@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeletePlacementGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeletePlacementGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
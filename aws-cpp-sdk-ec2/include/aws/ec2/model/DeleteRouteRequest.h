@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteRouteRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteRoute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
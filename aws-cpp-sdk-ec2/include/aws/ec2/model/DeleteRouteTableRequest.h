@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteRouteTableRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteRouteTable"; }
+
     Aws::String SerializePayload() const override;
 
     /**
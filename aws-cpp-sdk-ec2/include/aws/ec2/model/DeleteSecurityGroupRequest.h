@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteSecurityGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteSecurityGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteSpotDatafeedSubscriptionRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteSpotDatafeedSubscription"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteSubnetRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteSubnet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DeleteTagsRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteTags"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteVolumeRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteVolume"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteVpcEndpointsRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteVpcEndpoints"; }
+
     Aws::String SerializePayload() const override;
 
     /**
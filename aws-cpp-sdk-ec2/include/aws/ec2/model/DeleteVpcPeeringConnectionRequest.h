@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteVpcPeeringConnectionRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteVpcPeeringConnection"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteVpcRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteVpc"; }
+
     Aws::String SerializePayload() const override;
 
     /**
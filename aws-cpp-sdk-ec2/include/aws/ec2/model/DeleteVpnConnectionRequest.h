@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteVpnConnectionRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteVpnConnection"; }
+
     Aws::String SerializePayload() const override;
 
     /**
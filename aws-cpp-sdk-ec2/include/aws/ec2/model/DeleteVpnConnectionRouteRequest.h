@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteVpnConnectionRouteRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteVpnConnectionRoute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteVpnGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteVpnGateway"; }
+
     Aws::String SerializePayload() const override;
 
     /**
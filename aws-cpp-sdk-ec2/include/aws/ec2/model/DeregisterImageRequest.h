@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeregisterImageRequest();
+    inline const char* GetServiceRequestName() const override { return "DeregisterImage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeAccountAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAccountAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
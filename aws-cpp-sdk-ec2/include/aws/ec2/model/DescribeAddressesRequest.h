@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeAddressesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAddresses"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeAvailabilityZonesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAvailabilityZones"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeBundleTasksRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeBundleTasks"; }
+
     Aws::String SerializePayload() const override;
 
     /**
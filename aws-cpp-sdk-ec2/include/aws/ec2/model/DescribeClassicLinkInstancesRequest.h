@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeClassicLinkInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeClassicLinkInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeConversionTasksRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeConversionTasks"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeCustomerGatewaysRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCustomerGateways"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeDhcpOptionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDhcpOptions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
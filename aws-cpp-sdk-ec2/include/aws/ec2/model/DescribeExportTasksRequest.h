@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeExportTasksRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeExportTasks"; }
+
     Aws::String SerializePayload() const override;
 
     /**
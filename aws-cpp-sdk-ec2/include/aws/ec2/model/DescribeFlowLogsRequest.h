@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeFlowLogsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeFlowLogs"; }
+
     Aws::String SerializePayload() const override;
 
     /**
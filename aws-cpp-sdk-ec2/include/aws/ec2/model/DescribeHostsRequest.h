@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeHostsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeHosts"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeIdFormatRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeIdFormat"; }
+
     Aws::String SerializePayload() const override;
 
     /**
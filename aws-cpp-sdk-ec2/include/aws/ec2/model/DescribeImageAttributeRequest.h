@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeImageAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeImageAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeImagesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeImages"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeImportImageTasksRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeImportImageTasks"; }
+
     Aws::String SerializePayload() const override;
 
     /**
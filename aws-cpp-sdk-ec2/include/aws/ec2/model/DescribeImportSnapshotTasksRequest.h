@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeImportSnapshotTasksRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeImportSnapshotTasks"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeInstanceAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeInstanceAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
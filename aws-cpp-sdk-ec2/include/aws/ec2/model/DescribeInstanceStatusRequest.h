@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeInstanceStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeInstanceStatus"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
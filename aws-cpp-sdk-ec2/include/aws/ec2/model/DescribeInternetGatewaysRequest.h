@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeInternetGatewaysRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeInternetGateways"; }
+
     Aws::String SerializePayload() const override;
 
     /**
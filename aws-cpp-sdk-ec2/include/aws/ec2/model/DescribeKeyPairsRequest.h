@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeKeyPairsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeKeyPairs"; }
+
     Aws::String SerializePayload() const override;
 
     /**
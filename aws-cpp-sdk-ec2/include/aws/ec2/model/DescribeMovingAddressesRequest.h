@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeMovingAddressesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeMovingAddresses"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeNatGatewaysRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeNatGateways"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeNetworkAclsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeNetworkAcls"; }
+
     Aws::String SerializePayload() const override;
 
     /**
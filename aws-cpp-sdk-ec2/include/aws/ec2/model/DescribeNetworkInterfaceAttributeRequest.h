@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeNetworkInterfaceAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeNetworkInterfaceAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeNetworkInterfacesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeNetworkInterfaces"; }
+
     Aws::String SerializePayload() const override;
 
     /**
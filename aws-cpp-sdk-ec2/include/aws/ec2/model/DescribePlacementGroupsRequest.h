@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribePlacementGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribePlacementGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
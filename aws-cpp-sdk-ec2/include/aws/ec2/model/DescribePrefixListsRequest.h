@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribePrefixListsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribePrefixLists"; }
+
     Aws::String SerializePayload() const override;
 
     /**
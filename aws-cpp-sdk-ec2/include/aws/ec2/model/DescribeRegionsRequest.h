@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeRegionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeRegions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeReservedInstancesListingsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReservedInstancesListings"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeReservedInstancesModificationsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReservedInstancesModifications"; }
+
     Aws::String SerializePayload() const override;
 
     /**
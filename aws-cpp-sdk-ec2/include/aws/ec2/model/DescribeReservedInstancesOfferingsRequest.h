@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     DescribeReservedInstancesOfferingsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReservedInstancesOfferings"; }
+
     Aws::String SerializePayload() const override;
 
     /**
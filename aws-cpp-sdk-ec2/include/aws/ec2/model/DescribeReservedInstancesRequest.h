@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     DescribeReservedInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReservedInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
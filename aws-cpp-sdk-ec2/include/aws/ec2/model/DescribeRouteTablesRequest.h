@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeRouteTablesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeRouteTables"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     DescribeScheduledInstanceAvailabilityRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeScheduledInstanceAvailability"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     DescribeScheduledInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeScheduledInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeSecurityGroupReferencesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSecurityGroupReferences"; }
+
     Aws::String SerializePayload() const override;
 
     /**
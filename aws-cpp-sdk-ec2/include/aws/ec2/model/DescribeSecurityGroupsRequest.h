@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeSecurityGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSecurityGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeSnapshotAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSnapshotAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeSnapshotsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSnapshots"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeSpotDatafeedSubscriptionRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSpotDatafeedSubscription"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeSpotFleetInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSpotFleetInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
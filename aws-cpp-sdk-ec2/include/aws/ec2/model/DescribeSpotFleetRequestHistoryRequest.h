@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeSpotFleetRequestHistoryRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSpotFleetRequestHistory"; }
+
     Aws::String SerializePayload() const override;
 
     /**
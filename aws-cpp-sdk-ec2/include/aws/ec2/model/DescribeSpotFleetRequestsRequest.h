@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeSpotFleetRequestsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSpotFleetRequests"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeSpotInstanceRequestsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSpotInstanceRequests"; }
+
     Aws::String SerializePayload() const override;
 
     /**
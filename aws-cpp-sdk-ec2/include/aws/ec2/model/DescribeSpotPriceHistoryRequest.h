@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     DescribeSpotPriceHistoryRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSpotPriceHistory"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeStaleSecurityGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeStaleSecurityGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
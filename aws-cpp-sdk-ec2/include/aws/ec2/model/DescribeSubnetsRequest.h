@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeSubnetsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSubnets"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeVolumeAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVolumeAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
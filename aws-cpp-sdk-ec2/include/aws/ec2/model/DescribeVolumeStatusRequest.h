@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeVolumeStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVolumeStatus"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeVolumesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVolumes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeVpcAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVpcAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
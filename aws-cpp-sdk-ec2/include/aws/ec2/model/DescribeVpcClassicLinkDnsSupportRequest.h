@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeVpcClassicLinkDnsSupportRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVpcClassicLinkDnsSupport"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeVpcClassicLinkRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVpcClassicLink"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeVpcEndpointServicesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVpcEndpointServices"; }
+
     Aws::String SerializePayload() const override;
 
     /**
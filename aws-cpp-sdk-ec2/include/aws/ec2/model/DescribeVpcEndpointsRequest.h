@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeVpcEndpointsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVpcEndpoints"; }
+
     Aws::String SerializePayload() const override;
 
     /**
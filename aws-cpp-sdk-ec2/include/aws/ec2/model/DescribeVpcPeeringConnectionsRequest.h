@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeVpcPeeringConnectionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVpcPeeringConnections"; }
+
     Aws::String SerializePayload() const override;
 
     /**
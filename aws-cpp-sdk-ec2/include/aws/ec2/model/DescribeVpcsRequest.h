@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeVpcsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVpcs"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeVpnConnectionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVpnConnections"; }
+
     Aws::String SerializePayload() const override;
 
     /**
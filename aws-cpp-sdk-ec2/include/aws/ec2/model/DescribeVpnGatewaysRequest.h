@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeVpnGatewaysRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVpnGateways"; }
+
     Aws::String SerializePayload() const override;
 
     /**
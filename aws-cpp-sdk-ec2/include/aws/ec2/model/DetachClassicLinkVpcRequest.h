@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DetachClassicLinkVpcRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachClassicLinkVpc"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DetachInternetGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachInternetGateway"; }
+
     Aws::String SerializePayload() const override;
 
     /**
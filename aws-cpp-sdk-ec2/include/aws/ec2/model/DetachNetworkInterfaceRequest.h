@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DetachNetworkInterfaceRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachNetworkInterface"; }
+
     Aws::String SerializePayload() const override;
 
     /**
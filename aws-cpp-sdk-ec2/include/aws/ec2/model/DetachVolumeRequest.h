@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DetachVolumeRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachVolume"; }
+
     Aws::String SerializePayload() const override;
 
     /**
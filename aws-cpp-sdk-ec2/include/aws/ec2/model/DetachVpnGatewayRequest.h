@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DetachVpnGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachVpnGateway"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DisableVgwRoutePropagationRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableVgwRoutePropagation"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DisableVpcClassicLinkDnsSupportRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableVpcClassicLinkDnsSupport"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DisableVpcClassicLinkRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableVpcClassicLink"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DisassociateAddressRequest();
+    inline const char* GetServiceRequestName() const override { return "DisassociateAddress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DisassociateRouteTableRequest();
+    inline const char* GetServiceRequestName() const override { return "DisassociateRouteTable"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     EnableVgwRoutePropagationRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableVgwRoutePropagation"; }
+
     Aws::String SerializePayload() const override;
 
     /**
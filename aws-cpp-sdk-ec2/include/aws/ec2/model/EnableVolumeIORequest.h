@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     EnableVolumeIORequest();
+    inline const char* GetServiceRequestName() const override { return "EnableVolumeIO"; }
+
     Aws::String SerializePayload() const override;
 
     /**
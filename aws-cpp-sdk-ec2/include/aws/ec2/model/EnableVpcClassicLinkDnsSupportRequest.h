@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     EnableVpcClassicLinkDnsSupportRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableVpcClassicLinkDnsSupport"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     EnableVpcClassicLinkRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableVpcClassicLink"; }
+
     Aws::String SerializePayload() const override;
 
     /**
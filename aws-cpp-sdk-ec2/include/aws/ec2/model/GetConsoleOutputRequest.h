@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetConsoleOutputRequest();
+    inline const char* GetServiceRequestName() const override { return "GetConsoleOutput"; }
+
     Aws::String SerializePayload() const override;
 
     /**
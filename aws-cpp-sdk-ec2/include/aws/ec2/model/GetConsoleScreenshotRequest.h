@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetConsoleScreenshotRequest();
+    inline const char* GetServiceRequestName() const override { return "GetConsoleScreenshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetPasswordDataRequest();
+    inline const char* GetServiceRequestName() const override { return "GetPasswordData"; }
+
     Aws::String SerializePayload() const override;
 
     /**
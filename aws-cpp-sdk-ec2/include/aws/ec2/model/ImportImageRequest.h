@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     ImportImageRequest();
+    inline const char* GetServiceRequestName() const override { return "ImportImage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
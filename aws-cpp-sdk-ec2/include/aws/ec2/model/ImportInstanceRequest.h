@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ImportInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "ImportInstance"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ImportKeyPairRequest();
+    inline const char* GetServiceRequestName() const override { return "ImportKeyPair"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ImportSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "ImportSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ImportVolumeRequest();
+    inline const char* GetServiceRequestName() const override { return "ImportVolume"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ModifyHostsRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyHosts"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ModifyIdFormatRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyIdFormat"; }
+
     Aws::String SerializePayload() const override;
 
     /**
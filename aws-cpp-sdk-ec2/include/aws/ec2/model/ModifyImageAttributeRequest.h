@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ModifyImageAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyImageAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     ModifyInstanceAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyInstanceAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
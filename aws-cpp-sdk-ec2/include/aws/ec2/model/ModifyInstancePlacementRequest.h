@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ModifyInstancePlacementRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyInstancePlacement"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ModifyNetworkInterfaceAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyNetworkInterfaceAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ModifyReservedInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyReservedInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
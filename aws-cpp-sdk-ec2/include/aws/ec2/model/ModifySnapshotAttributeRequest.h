@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ModifySnapshotAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifySnapshotAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
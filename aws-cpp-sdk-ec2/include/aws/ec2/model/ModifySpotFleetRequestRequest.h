@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifySpotFleetRequestRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifySpotFleetRequest"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifySubnetAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifySubnetAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
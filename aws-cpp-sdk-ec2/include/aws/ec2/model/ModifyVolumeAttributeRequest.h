@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyVolumeAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyVolumeAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
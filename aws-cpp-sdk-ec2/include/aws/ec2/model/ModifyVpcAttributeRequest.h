@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyVpcAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyVpcAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
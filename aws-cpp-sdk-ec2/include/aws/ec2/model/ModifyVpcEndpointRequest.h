@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyVpcEndpointRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyVpcEndpoint"; }
+
     Aws::String SerializePayload() const override;
 
     /**
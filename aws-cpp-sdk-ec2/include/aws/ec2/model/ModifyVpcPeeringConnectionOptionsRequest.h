@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ModifyVpcPeeringConnectionOptionsRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyVpcPeeringConnectionOptions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
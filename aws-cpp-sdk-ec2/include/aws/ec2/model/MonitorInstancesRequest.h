@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     MonitorInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "MonitorInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
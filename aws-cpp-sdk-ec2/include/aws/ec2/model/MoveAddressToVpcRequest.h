@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     MoveAddressToVpcRequest();
+    inline const char* GetServiceRequestName() const override { return "MoveAddressToVpc"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PurchaseReservedInstancesOfferingRequest();
+    inline const char* GetServiceRequestName() const override { return "PurchaseReservedInstancesOffering"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     PurchaseScheduledInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "PurchaseScheduledInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RebootInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "RebootInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
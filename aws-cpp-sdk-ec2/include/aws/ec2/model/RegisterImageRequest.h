@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     RegisterImageRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterImage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
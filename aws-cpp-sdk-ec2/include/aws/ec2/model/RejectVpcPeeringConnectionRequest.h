@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RejectVpcPeeringConnectionRequest();
+    inline const char* GetServiceRequestName() const override { return "RejectVpcPeeringConnection"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ReleaseAddressRequest();
+    inline const char* GetServiceRequestName() const override { return "ReleaseAddress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ReleaseHostsRequest();
+    inline const char* GetServiceRequestName() const override { return "ReleaseHosts"; }
+
     Aws::String SerializePayload() const override;
 
     /**
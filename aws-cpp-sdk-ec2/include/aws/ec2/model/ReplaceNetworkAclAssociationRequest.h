@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ReplaceNetworkAclAssociationRequest();
+    inline const char* GetServiceRequestName() const override { return "ReplaceNetworkAclAssociation"; }
+
     Aws::String SerializePayload() const override;
 
     /**
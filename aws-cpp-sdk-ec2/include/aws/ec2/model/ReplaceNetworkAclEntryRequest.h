@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     ReplaceNetworkAclEntryRequest();
+    inline const char* GetServiceRequestName() const override { return "ReplaceNetworkAclEntry"; }
+
     Aws::String SerializePayload() const override;
 
     /**
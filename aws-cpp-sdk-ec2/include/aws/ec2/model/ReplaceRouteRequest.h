@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ReplaceRouteRequest();
+    inline const char* GetServiceRequestName() const override { return "ReplaceRoute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ReplaceRouteTableAssociationRequest();
+    inline const char* GetServiceRequestName() const override { return "ReplaceRouteTableAssociation"; }
+
     Aws::String SerializePayload() const override;
 
     /**
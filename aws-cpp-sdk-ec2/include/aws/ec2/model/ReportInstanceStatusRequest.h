@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ReportInstanceStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "ReportInstanceStatus"; }
+
     Aws::String SerializePayload() const override;
 
     /**
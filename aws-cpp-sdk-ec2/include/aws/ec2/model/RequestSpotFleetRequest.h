@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RequestSpotFleetRequest();
+    inline const char* GetServiceRequestName() const override { return "RequestSpotFleet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     RequestSpotInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "RequestSpotInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ResetImageAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "ResetImageAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
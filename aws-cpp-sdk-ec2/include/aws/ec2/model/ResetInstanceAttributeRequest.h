@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ResetInstanceAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "ResetInstanceAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
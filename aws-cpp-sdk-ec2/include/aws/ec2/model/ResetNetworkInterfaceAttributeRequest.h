@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ResetNetworkInterfaceAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "ResetNetworkInterfaceAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ResetSnapshotAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "ResetSnapshotAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RestoreAddressToClassicRequest();
+    inline const char* GetServiceRequestName() const override { return "RestoreAddressToClassic"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     RevokeSecurityGroupEgressRequest();
+    inline const char* GetServiceRequestName() const override { return "RevokeSecurityGroupEgress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     RevokeSecurityGroupIngressRequest();
+    inline const char* GetServiceRequestName() const override { return "RevokeSecurityGroupIngress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
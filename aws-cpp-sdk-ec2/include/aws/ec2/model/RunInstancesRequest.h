@@ -39,6 +39,8 @@ namespace Model
   {
   public:
     RunInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "RunInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RunScheduledInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "RunScheduledInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     StartInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "StartInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     StopInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "StopInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
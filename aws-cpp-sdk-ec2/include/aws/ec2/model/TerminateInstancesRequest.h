@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     TerminateInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "TerminateInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UnassignPrivateIpAddressesRequest();
+    inline const char* GetServiceRequestName() const override { return "UnassignPrivateIpAddresses"; }
+
     Aws::String SerializePayload() const override;
 
     /**
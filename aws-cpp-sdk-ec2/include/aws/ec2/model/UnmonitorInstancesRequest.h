@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UnmonitorInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "UnmonitorInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -313,7 +313,7 @@ AcceptVpcPeeringConnectionOutcome EC2Client::AcceptVpcPeeringConnection(const Ac
 
 AcceptVpcPeeringConnectionOutcomeCallable EC2Client::AcceptVpcPeeringConnectionCallable(const AcceptVpcPeeringConnectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AcceptVpcPeeringConnection( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AcceptVpcPeeringConnection( request ); } );
 }
 
 void EC2Client::AcceptVpcPeeringConnectionAsync(const AcceptVpcPeeringConnectionRequest& request, const AcceptVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -321,6 +321,16 @@ void EC2Client::AcceptVpcPeeringConnectionAsync(const AcceptVpcPeeringConnection
   m_executor->Submit( [this, request, handler, context](){ this->AcceptVpcPeeringConnectionAsyncHelper( request, handler, context ); } );
 }
 
+AcceptVpcPeeringConnectionOutcomeCallable EC2Client::AcceptVpcPeeringConnectionCallable(AcceptVpcPeeringConnectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::AcceptVpcPeeringConnection, this, std::move(request)));
+}
+
+void EC2Client::AcceptVpcPeeringConnectionAsync(AcceptVpcPeeringConnectionRequest&& request, const AcceptVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::AcceptVpcPeeringConnectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::AcceptVpcPeeringConnectionAsyncHelper(const AcceptVpcPeeringConnectionRequest& request, const AcceptVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AcceptVpcPeeringConnection(request), context);
@@ -343,7 +353,7 @@ AllocateAddressOutcome EC2Client::AllocateAddress(const AllocateAddressRequest&
 
 AllocateAddressOutcomeCallable EC2Client::AllocateAddressCallable(const AllocateAddressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AllocateAddress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AllocateAddress( request ); } );
 }
 
 void EC2Client::AllocateAddressAsync(const AllocateAddressRequest& request, const AllocateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -351,6 +361,16 @@ void EC2Client::AllocateAddressAsync(const AllocateAddressRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->AllocateAddressAsyncHelper( request, handler, context ); } );
 }
 
+AllocateAddressOutcomeCallable EC2Client::AllocateAddressCallable(AllocateAddressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::AllocateAddress, this, std::move(request)));
+}
+
+void EC2Client::AllocateAddressAsync(AllocateAddressRequest&& request, const AllocateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::AllocateAddressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::AllocateAddressAsyncHelper(const AllocateAddressRequest& request, const AllocateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AllocateAddress(request), context);
@@ -373,7 +393,7 @@ AllocateHostsOutcome EC2Client::AllocateHosts(const AllocateHostsRequest& reques
 
 AllocateHostsOutcomeCallable EC2Client::AllocateHostsCallable(const AllocateHostsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AllocateHosts( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AllocateHosts( request ); } );
 }
 
 void EC2Client::AllocateHostsAsync(const AllocateHostsRequest& request, const AllocateHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -381,6 +401,16 @@ void EC2Client::AllocateHostsAsync(const AllocateHostsRequest& request, const Al
   m_executor->Submit( [this, request, handler, context](){ this->AllocateHostsAsyncHelper( request, handler, context ); } );
 }
 
+AllocateHostsOutcomeCallable EC2Client::AllocateHostsCallable(AllocateHostsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::AllocateHosts, this, std::move(request)));
+}
+
+void EC2Client::AllocateHostsAsync(AllocateHostsRequest&& request, const AllocateHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::AllocateHostsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::AllocateHostsAsyncHelper(const AllocateHostsRequest& request, const AllocateHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AllocateHosts(request), context);
@@ -403,7 +433,7 @@ AssignPrivateIpAddressesOutcome EC2Client::AssignPrivateIpAddresses(const Assign
 
 AssignPrivateIpAddressesOutcomeCallable EC2Client::AssignPrivateIpAddressesCallable(const AssignPrivateIpAddressesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AssignPrivateIpAddresses( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AssignPrivateIpAddresses( request ); } );
 }
 
 void EC2Client::AssignPrivateIpAddressesAsync(const AssignPrivateIpAddressesRequest& request, const AssignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -411,6 +441,16 @@ void EC2Client::AssignPrivateIpAddressesAsync(const AssignPrivateIpAddressesRequ
   m_executor->Submit( [this, request, handler, context](){ this->AssignPrivateIpAddressesAsyncHelper( request, handler, context ); } );
 }
 
+AssignPrivateIpAddressesOutcomeCallable EC2Client::AssignPrivateIpAddressesCallable(AssignPrivateIpAddressesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::AssignPrivateIpAddresses, this, std::move(request)));
+}
+
+void EC2Client::AssignPrivateIpAddressesAsync(AssignPrivateIpAddressesRequest&& request, const AssignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::AssignPrivateIpAddressesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::AssignPrivateIpAddressesAsyncHelper(const AssignPrivateIpAddressesRequest& request, const AssignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AssignPrivateIpAddresses(request), context);
@@ -433,7 +473,7 @@ AssociateAddressOutcome EC2Client::AssociateAddress(const AssociateAddressReques
 
 AssociateAddressOutcomeCallable EC2Client::AssociateAddressCallable(const AssociateAddressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AssociateAddress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AssociateAddress( request ); } );
 }
 
 void EC2Client::AssociateAddressAsync(const AssociateAddressRequest& request, const AssociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -441,6 +481,16 @@ void EC2Client::AssociateAddressAsync(const AssociateAddressRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->AssociateAddressAsyncHelper( request, handler, context ); } );
 }
 
+AssociateAddressOutcomeCallable EC2Client::AssociateAddressCallable(AssociateAddressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::AssociateAddress, this, std::move(request)));
+}
+
+void EC2Client::AssociateAddressAsync(AssociateAddressRequest&& request, const AssociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::AssociateAddressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::AssociateAddressAsyncHelper(const AssociateAddressRequest& request, const AssociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AssociateAddress(request), context);
@@ -463,7 +513,7 @@ AssociateDhcpOptionsOutcome EC2Client::AssociateDhcpOptions(const AssociateDhcpO
 
 AssociateDhcpOptionsOutcomeCallable EC2Client::AssociateDhcpOptionsCallable(const AssociateDhcpOptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AssociateDhcpOptions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AssociateDhcpOptions( request ); } );
 }
 
 void EC2Client::AssociateDhcpOptionsAsync(const AssociateDhcpOptionsRequest& request, const AssociateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -471,6 +521,16 @@ void EC2Client::AssociateDhcpOptionsAsync(const AssociateDhcpOptionsRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->AssociateDhcpOptionsAsyncHelper( request, handler, context ); } );
 }
 
+AssociateDhcpOptionsOutcomeCallable EC2Client::AssociateDhcpOptionsCallable(AssociateDhcpOptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::AssociateDhcpOptions, this, std::move(request)));
+}
+
+void EC2Client::AssociateDhcpOptionsAsync(AssociateDhcpOptionsRequest&& request, const AssociateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::AssociateDhcpOptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::AssociateDhcpOptionsAsyncHelper(const AssociateDhcpOptionsRequest& request, const AssociateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AssociateDhcpOptions(request), context);
@@ -493,7 +553,7 @@ AssociateRouteTableOutcome EC2Client::AssociateRouteTable(const AssociateRouteTa
 
 AssociateRouteTableOutcomeCallable EC2Client::AssociateRouteTableCallable(const AssociateRouteTableRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AssociateRouteTable( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AssociateRouteTable( request ); } );
 }
 
 void EC2Client::AssociateRouteTableAsync(const AssociateRouteTableRequest& request, const AssociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -501,6 +561,16 @@ void EC2Client::AssociateRouteTableAsync(const AssociateRouteTableRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->AssociateRouteTableAsyncHelper( request, handler, context ); } );
 }
 
+AssociateRouteTableOutcomeCallable EC2Client::AssociateRouteTableCallable(AssociateRouteTableRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::AssociateRouteTable, this, std::move(request)));
+}
+
+void EC2Client::AssociateRouteTableAsync(AssociateRouteTableRequest&& request, const AssociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::AssociateRouteTableAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::AssociateRouteTableAsyncHelper(const AssociateRouteTableRequest& request, const AssociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AssociateRouteTable(request), context);
@@ -523,7 +593,7 @@ AttachClassicLinkVpcOutcome EC2Client::AttachClassicLinkVpc(const AttachClassicL
 
 AttachClassicLinkVpcOutcomeCallable EC2Client::AttachClassicLinkVpcCallable(const AttachClassicLinkVpcRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachClassicLinkVpc( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachClassicLinkVpc( request ); } );
 }
 
 void EC2Client::AttachClassicLinkVpcAsync(const AttachClassicLinkVpcRequest& request, const AttachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -531,6 +601,16 @@ void EC2Client::AttachClassicLinkVpcAsync(const AttachClassicLinkVpcRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->AttachClassicLinkVpcAsyncHelper( request, handler, context ); } );
 }
 
+AttachClassicLinkVpcOutcomeCallable EC2Client::AttachClassicLinkVpcCallable(AttachClassicLinkVpcRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::AttachClassicLinkVpc, this, std::move(request)));
+}
+
+void EC2Client::AttachClassicLinkVpcAsync(AttachClassicLinkVpcRequest&& request, const AttachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::AttachClassicLinkVpcAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::AttachClassicLinkVpcAsyncHelper(const AttachClassicLinkVpcRequest& request, const AttachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachClassicLinkVpc(request), context);
@@ -553,7 +633,7 @@ AttachInternetGatewayOutcome EC2Client::AttachInternetGateway(const AttachIntern
 
 AttachInternetGatewayOutcomeCallable EC2Client::AttachInternetGatewayCallable(const AttachInternetGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachInternetGateway( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachInternetGateway( request ); } );
 }
 
 void EC2Client::AttachInternetGatewayAsync(const AttachInternetGatewayRequest& request, const AttachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -561,6 +641,16 @@ void EC2Client::AttachInternetGatewayAsync(const AttachInternetGatewayRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->AttachInternetGatewayAsyncHelper( request, handler, context ); } );
 }
 
+AttachInternetGatewayOutcomeCallable EC2Client::AttachInternetGatewayCallable(AttachInternetGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::AttachInternetGateway, this, std::move(request)));
+}
+
+void EC2Client::AttachInternetGatewayAsync(AttachInternetGatewayRequest&& request, const AttachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::AttachInternetGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::AttachInternetGatewayAsyncHelper(const AttachInternetGatewayRequest& request, const AttachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachInternetGateway(request), context);
@@ -583,7 +673,7 @@ AttachNetworkInterfaceOutcome EC2Client::AttachNetworkInterface(const AttachNetw
 
 AttachNetworkInterfaceOutcomeCallable EC2Client::AttachNetworkInterfaceCallable(const AttachNetworkInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachNetworkInterface( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachNetworkInterface( request ); } );
 }
 
 void EC2Client::AttachNetworkInterfaceAsync(const AttachNetworkInterfaceRequest& request, const AttachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -591,6 +681,16 @@ void EC2Client::AttachNetworkInterfaceAsync(const AttachNetworkInterfaceRequest&
   m_executor->Submit( [this, request, handler, context](){ this->AttachNetworkInterfaceAsyncHelper( request, handler, context ); } );
 }
 
+AttachNetworkInterfaceOutcomeCallable EC2Client::AttachNetworkInterfaceCallable(AttachNetworkInterfaceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::AttachNetworkInterface, this, std::move(request)));
+}
+
+void EC2Client::AttachNetworkInterfaceAsync(AttachNetworkInterfaceRequest&& request, const AttachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::AttachNetworkInterfaceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::AttachNetworkInterfaceAsyncHelper(const AttachNetworkInterfaceRequest& request, const AttachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachNetworkInterface(request), context);
@@ -613,7 +713,7 @@ AttachVolumeOutcome EC2Client::AttachVolume(const AttachVolumeRequest& request)
 
 AttachVolumeOutcomeCallable EC2Client::AttachVolumeCallable(const AttachVolumeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachVolume( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachVolume( request ); } );
 }
 
 void EC2Client::AttachVolumeAsync(const AttachVolumeRequest& request, const AttachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -621,6 +721,16 @@ void EC2Client::AttachVolumeAsync(const AttachVolumeRequest& request, const Atta
   m_executor->Submit( [this, request, handler, context](){ this->AttachVolumeAsyncHelper( request, handler, context ); } );
 }
 
+AttachVolumeOutcomeCallable EC2Client::AttachVolumeCallable(AttachVolumeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::AttachVolume, this, std::move(request)));
+}
+
+void EC2Client::AttachVolumeAsync(AttachVolumeRequest&& request, const AttachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::AttachVolumeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::AttachVolumeAsyncHelper(const AttachVolumeRequest& request, const AttachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachVolume(request), context);
@@ -643,7 +753,7 @@ AttachVpnGatewayOutcome EC2Client::AttachVpnGateway(const AttachVpnGatewayReques
 
 AttachVpnGatewayOutcomeCallable EC2Client::AttachVpnGatewayCallable(const AttachVpnGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachVpnGateway( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachVpnGateway( request ); } );
 }
 
 void EC2Client::AttachVpnGatewayAsync(const AttachVpnGatewayRequest& request, const AttachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -651,6 +761,16 @@ void EC2Client::AttachVpnGatewayAsync(const AttachVpnGatewayRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->AttachVpnGatewayAsyncHelper( request, handler, context ); } );
 }
 
+AttachVpnGatewayOutcomeCallable EC2Client::AttachVpnGatewayCallable(AttachVpnGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::AttachVpnGateway, this, std::move(request)));
+}
+
+void EC2Client::AttachVpnGatewayAsync(AttachVpnGatewayRequest&& request, const AttachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::AttachVpnGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::AttachVpnGatewayAsyncHelper(const AttachVpnGatewayRequest& request, const AttachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachVpnGateway(request), context);
@@ -673,7 +793,7 @@ AuthorizeSecurityGroupEgressOutcome EC2Client::AuthorizeSecurityGroupEgress(cons
 
 AuthorizeSecurityGroupEgressOutcomeCallable EC2Client::AuthorizeSecurityGroupEgressCallable(const AuthorizeSecurityGroupEgressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AuthorizeSecurityGroupEgress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AuthorizeSecurityGroupEgress( request ); } );
 }
 
 void EC2Client::AuthorizeSecurityGroupEgressAsync(const AuthorizeSecurityGroupEgressRequest& request, const AuthorizeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -681,6 +801,16 @@ void EC2Client::AuthorizeSecurityGroupEgressAsync(const AuthorizeSecurityGroupEg
   m_executor->Submit( [this, request, handler, context](){ this->AuthorizeSecurityGroupEgressAsyncHelper( request, handler, context ); } );
 }
 
+AuthorizeSecurityGroupEgressOutcomeCallable EC2Client::AuthorizeSecurityGroupEgressCallable(AuthorizeSecurityGroupEgressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::AuthorizeSecurityGroupEgress, this, std::move(request)));
+}
+
+void EC2Client::AuthorizeSecurityGroupEgressAsync(AuthorizeSecurityGroupEgressRequest&& request, const AuthorizeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::AuthorizeSecurityGroupEgressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::AuthorizeSecurityGroupEgressAsyncHelper(const AuthorizeSecurityGroupEgressRequest& request, const AuthorizeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AuthorizeSecurityGroupEgress(request), context);
@@ -703,7 +833,7 @@ AuthorizeSecurityGroupIngressOutcome EC2Client::AuthorizeSecurityGroupIngress(co
 
 AuthorizeSecurityGroupIngressOutcomeCallable EC2Client::AuthorizeSecurityGroupIngressCallable(const AuthorizeSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AuthorizeSecurityGroupIngress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AuthorizeSecurityGroupIngress( request ); } );
 }
 
 void EC2Client::AuthorizeSecurityGroupIngressAsync(const AuthorizeSecurityGroupIngressRequest& request, const AuthorizeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -711,6 +841,16 @@ void EC2Client::AuthorizeSecurityGroupIngressAsync(const AuthorizeSecurityGroupI
   m_executor->Submit( [this, request, handler, context](){ this->AuthorizeSecurityGroupIngressAsyncHelper( request, handler, context ); } );
 }
 
+AuthorizeSecurityGroupIngressOutcomeCallable EC2Client::AuthorizeSecurityGroupIngressCallable(AuthorizeSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::AuthorizeSecurityGroupIngress, this, std::move(request)));
+}
+
+void EC2Client::AuthorizeSecurityGroupIngressAsync(AuthorizeSecurityGroupIngressRequest&& request, const AuthorizeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::AuthorizeSecurityGroupIngressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::AuthorizeSecurityGroupIngressAsyncHelper(const AuthorizeSecurityGroupIngressRequest& request, const AuthorizeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AuthorizeSecurityGroupIngress(request), context);
@@ -733,7 +873,7 @@ BundleInstanceOutcome EC2Client::BundleInstance(const BundleInstanceRequest& req
 
 BundleInstanceOutcomeCallable EC2Client::BundleInstanceCallable(const BundleInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BundleInstance( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BundleInstance( request ); } );
 }
 
 void EC2Client::BundleInstanceAsync(const BundleInstanceRequest& request, const BundleInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -741,6 +881,16 @@ void EC2Client::BundleInstanceAsync(const BundleInstanceRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->BundleInstanceAsyncHelper( request, handler, context ); } );
 }
 
+BundleInstanceOutcomeCallable EC2Client::BundleInstanceCallable(BundleInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::BundleInstance, this, std::move(request)));
+}
+
+void EC2Client::BundleInstanceAsync(BundleInstanceRequest&& request, const BundleInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::BundleInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::BundleInstanceAsyncHelper(const BundleInstanceRequest& request, const BundleInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BundleInstance(request), context);
@@ -763,7 +913,7 @@ CancelBundleTaskOutcome EC2Client::CancelBundleTask(const CancelBundleTaskReques
 
 CancelBundleTaskOutcomeCallable EC2Client::CancelBundleTaskCallable(const CancelBundleTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelBundleTask( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelBundleTask( request ); } );
 }
 
 void EC2Client::CancelBundleTaskAsync(const CancelBundleTaskRequest& request, const CancelBundleTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -771,6 +921,16 @@ void EC2Client::CancelBundleTaskAsync(const CancelBundleTaskRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CancelBundleTaskAsyncHelper( request, handler, context ); } );
 }
 
+CancelBundleTaskOutcomeCallable EC2Client::CancelBundleTaskCallable(CancelBundleTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CancelBundleTask, this, std::move(request)));
+}
+
+void EC2Client::CancelBundleTaskAsync(CancelBundleTaskRequest&& request, const CancelBundleTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CancelBundleTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CancelBundleTaskAsyncHelper(const CancelBundleTaskRequest& request, const CancelBundleTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelBundleTask(request), context);
@@ -793,7 +953,7 @@ CancelConversionTaskOutcome EC2Client::CancelConversionTask(const CancelConversi
 
 CancelConversionTaskOutcomeCallable EC2Client::CancelConversionTaskCallable(const CancelConversionTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelConversionTask( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelConversionTask( request ); } );
 }
 
 void EC2Client::CancelConversionTaskAsync(const CancelConversionTaskRequest& request, const CancelConversionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -801,6 +961,16 @@ void EC2Client::CancelConversionTaskAsync(const CancelConversionTaskRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->CancelConversionTaskAsyncHelper( request, handler, context ); } );
 }
 
+CancelConversionTaskOutcomeCallable EC2Client::CancelConversionTaskCallable(CancelConversionTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CancelConversionTask, this, std::move(request)));
+}
+
+void EC2Client::CancelConversionTaskAsync(CancelConversionTaskRequest&& request, const CancelConversionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CancelConversionTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CancelConversionTaskAsyncHelper(const CancelConversionTaskRequest& request, const CancelConversionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelConversionTask(request), context);
@@ -823,7 +993,7 @@ CancelExportTaskOutcome EC2Client::CancelExportTask(const CancelExportTaskReques
 
 CancelExportTaskOutcomeCallable EC2Client::CancelExportTaskCallable(const CancelExportTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelExportTask( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelExportTask( request ); } );
 }
 
 void EC2Client::CancelExportTaskAsync(const CancelExportTaskRequest& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -831,6 +1001,16 @@ void EC2Client::CancelExportTaskAsync(const CancelExportTaskRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CancelExportTaskAsyncHelper( request, handler, context ); } );
 }
 
+CancelExportTaskOutcomeCallable EC2Client::CancelExportTaskCallable(CancelExportTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CancelExportTask, this, std::move(request)));
+}
+
+void EC2Client::CancelExportTaskAsync(CancelExportTaskRequest&& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CancelExportTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CancelExportTaskAsyncHelper(const CancelExportTaskRequest& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelExportTask(request), context);
@@ -853,7 +1033,7 @@ CancelImportTaskOutcome EC2Client::CancelImportTask(const CancelImportTaskReques
 
 CancelImportTaskOutcomeCallable EC2Client::CancelImportTaskCallable(const CancelImportTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelImportTask( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelImportTask( request ); } );
 }
 
 void EC2Client::CancelImportTaskAsync(const CancelImportTaskRequest& request, const CancelImportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -861,6 +1041,16 @@ void EC2Client::CancelImportTaskAsync(const CancelImportTaskRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CancelImportTaskAsyncHelper( request, handler, context ); } );
 }
 
+CancelImportTaskOutcomeCallable EC2Client::CancelImportTaskCallable(CancelImportTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CancelImportTask, this, std::move(request)));
+}
+
+void EC2Client::CancelImportTaskAsync(CancelImportTaskRequest&& request, const CancelImportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CancelImportTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CancelImportTaskAsyncHelper(const CancelImportTaskRequest& request, const CancelImportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelImportTask(request), context);
@@ -883,7 +1073,7 @@ CancelReservedInstancesListingOutcome EC2Client::CancelReservedInstancesListing(
 
 CancelReservedInstancesListingOutcomeCallable EC2Client::CancelReservedInstancesListingCallable(const CancelReservedInstancesListingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelReservedInstancesListing( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelReservedInstancesListing( request ); } );
 }
 
 void EC2Client::CancelReservedInstancesListingAsync(const CancelReservedInstancesListingRequest& request, const CancelReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -891,6 +1081,16 @@ void EC2Client::CancelReservedInstancesListingAsync(const CancelReservedInstance
   m_executor->Submit( [this, request, handler, context](){ this->CancelReservedInstancesListingAsyncHelper( request, handler, context ); } );
 }
 
+CancelReservedInstancesListingOutcomeCallable EC2Client::CancelReservedInstancesListingCallable(CancelReservedInstancesListingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CancelReservedInstancesListing, this, std::move(request)));
+}
+
+void EC2Client::CancelReservedInstancesListingAsync(CancelReservedInstancesListingRequest&& request, const CancelReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CancelReservedInstancesListingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CancelReservedInstancesListingAsyncHelper(const CancelReservedInstancesListingRequest& request, const CancelReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelReservedInstancesListing(request), context);
@@ -913,7 +1113,7 @@ CancelSpotFleetRequestsOutcome EC2Client::CancelSpotFleetRequests(const CancelSp
 
 CancelSpotFleetRequestsOutcomeCallable EC2Client::CancelSpotFleetRequestsCallable(const CancelSpotFleetRequestsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelSpotFleetRequests( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelSpotFleetRequests( request ); } );
 }
 
 void EC2Client::CancelSpotFleetRequestsAsync(const CancelSpotFleetRequestsRequest& request, const CancelSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -921,6 +1121,16 @@ void EC2Client::CancelSpotFleetRequestsAsync(const CancelSpotFleetRequestsReques
   m_executor->Submit( [this, request, handler, context](){ this->CancelSpotFleetRequestsAsyncHelper( request, handler, context ); } );
 }
 
+CancelSpotFleetRequestsOutcomeCallable EC2Client::CancelSpotFleetRequestsCallable(CancelSpotFleetRequestsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CancelSpotFleetRequests, this, std::move(request)));
+}
+
+void EC2Client::CancelSpotFleetRequestsAsync(CancelSpotFleetRequestsRequest&& request, const CancelSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CancelSpotFleetRequestsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CancelSpotFleetRequestsAsyncHelper(const CancelSpotFleetRequestsRequest& request, const CancelSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelSpotFleetRequests(request), context);
@@ -943,7 +1153,7 @@ CancelSpotInstanceRequestsOutcome EC2Client::CancelSpotInstanceRequests(const Ca
 
 CancelSpotInstanceRequestsOutcomeCallable EC2Client::CancelSpotInstanceRequestsCallable(const CancelSpotInstanceRequestsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelSpotInstanceRequests( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelSpotInstanceRequests( request ); } );
 }
 
 void EC2Client::CancelSpotInstanceRequestsAsync(const CancelSpotInstanceRequestsRequest& request, const CancelSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -951,6 +1161,16 @@ void EC2Client::CancelSpotInstanceRequestsAsync(const CancelSpotInstanceRequests
   m_executor->Submit( [this, request, handler, context](){ this->CancelSpotInstanceRequestsAsyncHelper( request, handler, context ); } );
 }
 
+CancelSpotInstanceRequestsOutcomeCallable EC2Client::CancelSpotInstanceRequestsCallable(CancelSpotInstanceRequestsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CancelSpotInstanceRequests, this, std::move(request)));
+}
+
+void EC2Client::CancelSpotInstanceRequestsAsync(CancelSpotInstanceRequestsRequest&& request, const CancelSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CancelSpotInstanceRequestsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CancelSpotInstanceRequestsAsyncHelper(const CancelSpotInstanceRequestsRequest& request, const CancelSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelSpotInstanceRequests(request), context);
@@ -973,7 +1193,7 @@ ConfirmProductInstanceOutcome EC2Client::ConfirmProductInstance(const ConfirmPro
 
 ConfirmProductInstanceOutcomeCallable EC2Client::ConfirmProductInstanceCallable(const ConfirmProductInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ConfirmProductInstance( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ConfirmProductInstance( request ); } );
 }
 
 void EC2Client::ConfirmProductInstanceAsync(const ConfirmProductInstanceRequest& request, const ConfirmProductInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -981,6 +1201,16 @@ void EC2Client::ConfirmProductInstanceAsync(const ConfirmProductInstanceRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ConfirmProductInstanceAsyncHelper( request, handler, context ); } );
 }
 
+ConfirmProductInstanceOutcomeCallable EC2Client::ConfirmProductInstanceCallable(ConfirmProductInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ConfirmProductInstance, this, std::move(request)));
+}
+
+void EC2Client::ConfirmProductInstanceAsync(ConfirmProductInstanceRequest&& request, const ConfirmProductInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ConfirmProductInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ConfirmProductInstanceAsyncHelper(const ConfirmProductInstanceRequest& request, const ConfirmProductInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ConfirmProductInstance(request), context);
@@ -1003,7 +1233,7 @@ CopyImageOutcome EC2Client::CopyImage(const CopyImageRequest& request) const
 
 CopyImageOutcomeCallable EC2Client::CopyImageCallable(const CopyImageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CopyImage( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CopyImage( request ); } );
 }
 
 void EC2Client::CopyImageAsync(const CopyImageRequest& request, const CopyImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1011,6 +1241,16 @@ void EC2Client::CopyImageAsync(const CopyImageRequest& request, const CopyImageR
   m_executor->Submit( [this, request, handler, context](){ this->CopyImageAsyncHelper( request, handler, context ); } );
 }
 
+CopyImageOutcomeCallable EC2Client::CopyImageCallable(CopyImageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CopyImage, this, std::move(request)));
+}
+
+void EC2Client::CopyImageAsync(CopyImageRequest&& request, const CopyImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CopyImageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CopyImageAsyncHelper(const CopyImageRequest& request, const CopyImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CopyImage(request), context);
@@ -1033,7 +1273,7 @@ CopySnapshotOutcome EC2Client::CopySnapshot(const CopySnapshotRequest& request)
 
 CopySnapshotOutcomeCallable EC2Client::CopySnapshotCallable(const CopySnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CopySnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CopySnapshot( request ); } );
 }
 
 void EC2Client::CopySnapshotAsync(const CopySnapshotRequest& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1041,6 +1281,16 @@ void EC2Client::CopySnapshotAsync(const CopySnapshotRequest& request, const Copy
   m_executor->Submit( [this, request, handler, context](){ this->CopySnapshotAsyncHelper( request, handler, context ); } );
 }
 
+CopySnapshotOutcomeCallable EC2Client::CopySnapshotCallable(CopySnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CopySnapshot, this, std::move(request)));
+}
+
+void EC2Client::CopySnapshotAsync(CopySnapshotRequest&& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CopySnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CopySnapshotAsyncHelper(const CopySnapshotRequest& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CopySnapshot(request), context);
@@ -1063,7 +1313,7 @@ CreateCustomerGatewayOutcome EC2Client::CreateCustomerGateway(const CreateCustom
 
 CreateCustomerGatewayOutcomeCallable EC2Client::CreateCustomerGatewayCallable(const CreateCustomerGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateCustomerGateway( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateCustomerGateway( request ); } );
 }
 
 void EC2Client::CreateCustomerGatewayAsync(const CreateCustomerGatewayRequest& request, const CreateCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1071,6 +1321,16 @@ void EC2Client::CreateCustomerGatewayAsync(const CreateCustomerGatewayRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->CreateCustomerGatewayAsyncHelper( request, handler, context ); } );
 }
 
+CreateCustomerGatewayOutcomeCallable EC2Client::CreateCustomerGatewayCallable(CreateCustomerGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateCustomerGateway, this, std::move(request)));
+}
+
+void EC2Client::CreateCustomerGatewayAsync(CreateCustomerGatewayRequest&& request, const CreateCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateCustomerGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateCustomerGatewayAsyncHelper(const CreateCustomerGatewayRequest& request, const CreateCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateCustomerGateway(request), context);
@@ -1093,7 +1353,7 @@ CreateDhcpOptionsOutcome EC2Client::CreateDhcpOptions(const CreateDhcpOptionsReq
 
 CreateDhcpOptionsOutcomeCallable EC2Client::CreateDhcpOptionsCallable(const CreateDhcpOptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDhcpOptions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDhcpOptions( request ); } );
 }
 
 void EC2Client::CreateDhcpOptionsAsync(const CreateDhcpOptionsRequest& request, const CreateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1101,6 +1361,16 @@ void EC2Client::CreateDhcpOptionsAsync(const CreateDhcpOptionsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->CreateDhcpOptionsAsyncHelper( request, handler, context ); } );
 }
 
+CreateDhcpOptionsOutcomeCallable EC2Client::CreateDhcpOptionsCallable(CreateDhcpOptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateDhcpOptions, this, std::move(request)));
+}
+
+void EC2Client::CreateDhcpOptionsAsync(CreateDhcpOptionsRequest&& request, const CreateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateDhcpOptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateDhcpOptionsAsyncHelper(const CreateDhcpOptionsRequest& request, const CreateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDhcpOptions(request), context);
@@ -1123,7 +1393,7 @@ CreateFlowLogsOutcome EC2Client::CreateFlowLogs(const CreateFlowLogsRequest& req
 
 CreateFlowLogsOutcomeCallable EC2Client::CreateFlowLogsCallable(const CreateFlowLogsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateFlowLogs( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateFlowLogs( request ); } );
 }
 
 void EC2Client::CreateFlowLogsAsync(const CreateFlowLogsRequest& request, const CreateFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1131,6 +1401,16 @@ void EC2Client::CreateFlowLogsAsync(const CreateFlowLogsRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->CreateFlowLogsAsyncHelper( request, handler, context ); } );
 }
 
+CreateFlowLogsOutcomeCallable EC2Client::CreateFlowLogsCallable(CreateFlowLogsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateFlowLogs, this, std::move(request)));
+}
+
+void EC2Client::CreateFlowLogsAsync(CreateFlowLogsRequest&& request, const CreateFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateFlowLogsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateFlowLogsAsyncHelper(const CreateFlowLogsRequest& request, const CreateFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateFlowLogs(request), context);
@@ -1153,7 +1433,7 @@ CreateImageOutcome EC2Client::CreateImage(const CreateImageRequest& request) con
 
 CreateImageOutcomeCallable EC2Client::CreateImageCallable(const CreateImageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateImage( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateImage( request ); } );
 }
 
 void EC2Client::CreateImageAsync(const CreateImageRequest& request, const CreateImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1161,6 +1441,16 @@ void EC2Client::CreateImageAsync(const CreateImageRequest& request, const Create
   m_executor->Submit( [this, request, handler, context](){ this->CreateImageAsyncHelper( request, handler, context ); } );
 }
 
+CreateImageOutcomeCallable EC2Client::CreateImageCallable(CreateImageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateImage, this, std::move(request)));
+}
+
+void EC2Client::CreateImageAsync(CreateImageRequest&& request, const CreateImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateImageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateImageAsyncHelper(const CreateImageRequest& request, const CreateImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateImage(request), context);
@@ -1183,7 +1473,7 @@ CreateInstanceExportTaskOutcome EC2Client::CreateInstanceExportTask(const Create
 
 CreateInstanceExportTaskOutcomeCallable EC2Client::CreateInstanceExportTaskCallable(const CreateInstanceExportTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateInstanceExportTask( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateInstanceExportTask( request ); } );
 }
 
 void EC2Client::CreateInstanceExportTaskAsync(const CreateInstanceExportTaskRequest& request, const CreateInstanceExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1191,6 +1481,16 @@ void EC2Client::CreateInstanceExportTaskAsync(const CreateInstanceExportTaskRequ
   m_executor->Submit( [this, request, handler, context](){ this->CreateInstanceExportTaskAsyncHelper( request, handler, context ); } );
 }
 
+CreateInstanceExportTaskOutcomeCallable EC2Client::CreateInstanceExportTaskCallable(CreateInstanceExportTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateInstanceExportTask, this, std::move(request)));
+}
+
+void EC2Client::CreateInstanceExportTaskAsync(CreateInstanceExportTaskRequest&& request, const CreateInstanceExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateInstanceExportTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateInstanceExportTaskAsyncHelper(const CreateInstanceExportTaskRequest& request, const CreateInstanceExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateInstanceExportTask(request), context);
@@ -1213,7 +1513,7 @@ CreateInternetGatewayOutcome EC2Client::CreateInternetGateway(const CreateIntern
 
 CreateInternetGatewayOutcomeCallable EC2Client::CreateInternetGatewayCallable(const CreateInternetGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateInternetGateway( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateInternetGateway( request ); } );
 }
 
 void EC2Client::CreateInternetGatewayAsync(const CreateInternetGatewayRequest& request, const CreateInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1221,6 +1521,16 @@ void EC2Client::CreateInternetGatewayAsync(const CreateInternetGatewayRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->CreateInternetGatewayAsyncHelper( request, handler, context ); } );
 }
 
+CreateInternetGatewayOutcomeCallable EC2Client::CreateInternetGatewayCallable(CreateInternetGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateInternetGateway, this, std::move(request)));
+}
+
+void EC2Client::CreateInternetGatewayAsync(CreateInternetGatewayRequest&& request, const CreateInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateInternetGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateInternetGatewayAsyncHelper(const CreateInternetGatewayRequest& request, const CreateInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateInternetGateway(request), context);
@@ -1243,7 +1553,7 @@ CreateKeyPairOutcome EC2Client::CreateKeyPair(const CreateKeyPairRequest& reques
 
 CreateKeyPairOutcomeCallable EC2Client::CreateKeyPairCallable(const CreateKeyPairRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateKeyPair( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateKeyPair( request ); } );
 }
 
 void EC2Client::CreateKeyPairAsync(const CreateKeyPairRequest& request, const CreateKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1251,6 +1561,16 @@ void EC2Client::CreateKeyPairAsync(const CreateKeyPairRequest& request, const Cr
   m_executor->Submit( [this, request, handler, context](){ this->CreateKeyPairAsyncHelper( request, handler, context ); } );
 }
 
+CreateKeyPairOutcomeCallable EC2Client::CreateKeyPairCallable(CreateKeyPairRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateKeyPair, this, std::move(request)));
+}
+
+void EC2Client::CreateKeyPairAsync(CreateKeyPairRequest&& request, const CreateKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateKeyPairAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateKeyPairAsyncHelper(const CreateKeyPairRequest& request, const CreateKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateKeyPair(request), context);
@@ -1273,7 +1593,7 @@ CreateNatGatewayOutcome EC2Client::CreateNatGateway(const CreateNatGatewayReques
 
 CreateNatGatewayOutcomeCallable EC2Client::CreateNatGatewayCallable(const CreateNatGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateNatGateway( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateNatGateway( request ); } );
 }
 
 void EC2Client::CreateNatGatewayAsync(const CreateNatGatewayRequest& request, const CreateNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1281,6 +1601,16 @@ void EC2Client::CreateNatGatewayAsync(const CreateNatGatewayRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CreateNatGatewayAsyncHelper( request, handler, context ); } );
 }
 
+CreateNatGatewayOutcomeCallable EC2Client::CreateNatGatewayCallable(CreateNatGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateNatGateway, this, std::move(request)));
+}
+
+void EC2Client::CreateNatGatewayAsync(CreateNatGatewayRequest&& request, const CreateNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateNatGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateNatGatewayAsyncHelper(const CreateNatGatewayRequest& request, const CreateNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateNatGateway(request), context);
@@ -1303,7 +1633,7 @@ CreateNetworkAclOutcome EC2Client::CreateNetworkAcl(const CreateNetworkAclReques
 
 CreateNetworkAclOutcomeCallable EC2Client::CreateNetworkAclCallable(const CreateNetworkAclRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateNetworkAcl( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateNetworkAcl( request ); } );
 }
 
 void EC2Client::CreateNetworkAclAsync(const CreateNetworkAclRequest& request, const CreateNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1311,6 +1641,16 @@ void EC2Client::CreateNetworkAclAsync(const CreateNetworkAclRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CreateNetworkAclAsyncHelper( request, handler, context ); } );
 }
 
+CreateNetworkAclOutcomeCallable EC2Client::CreateNetworkAclCallable(CreateNetworkAclRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateNetworkAcl, this, std::move(request)));
+}
+
+void EC2Client::CreateNetworkAclAsync(CreateNetworkAclRequest&& request, const CreateNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateNetworkAclAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateNetworkAclAsyncHelper(const CreateNetworkAclRequest& request, const CreateNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateNetworkAcl(request), context);
@@ -1333,7 +1673,7 @@ CreateNetworkAclEntryOutcome EC2Client::CreateNetworkAclEntry(const CreateNetwor
 
 CreateNetworkAclEntryOutcomeCallable EC2Client::CreateNetworkAclEntryCallable(const CreateNetworkAclEntryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateNetworkAclEntry( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateNetworkAclEntry( request ); } );
 }
 
 void EC2Client::CreateNetworkAclEntryAsync(const CreateNetworkAclEntryRequest& request, const CreateNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1341,6 +1681,16 @@ void EC2Client::CreateNetworkAclEntryAsync(const CreateNetworkAclEntryRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->CreateNetworkAclEntryAsyncHelper( request, handler, context ); } );
 }
 
+CreateNetworkAclEntryOutcomeCallable EC2Client::CreateNetworkAclEntryCallable(CreateNetworkAclEntryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateNetworkAclEntry, this, std::move(request)));
+}
+
+void EC2Client::CreateNetworkAclEntryAsync(CreateNetworkAclEntryRequest&& request, const CreateNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateNetworkAclEntryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateNetworkAclEntryAsyncHelper(const CreateNetworkAclEntryRequest& request, const CreateNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateNetworkAclEntry(request), context);
@@ -1363,7 +1713,7 @@ CreateNetworkInterfaceOutcome EC2Client::CreateNetworkInterface(const CreateNetw
 
 CreateNetworkInterfaceOutcomeCallable EC2Client::CreateNetworkInterfaceCallable(const CreateNetworkInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateNetworkInterface( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateNetworkInterface( request ); } );
 }
 
 void EC2Client::CreateNetworkInterfaceAsync(const CreateNetworkInterfaceRequest& request, const CreateNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1371,6 +1721,16 @@ void EC2Client::CreateNetworkInterfaceAsync(const CreateNetworkInterfaceRequest&
   m_executor->Submit( [this, request, handler, context](){ this->CreateNetworkInterfaceAsyncHelper( request, handler, context ); } );
 }
 
+CreateNetworkInterfaceOutcomeCallable EC2Client::CreateNetworkInterfaceCallable(CreateNetworkInterfaceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateNetworkInterface, this, std::move(request)));
+}
+
+void EC2Client::CreateNetworkInterfaceAsync(CreateNetworkInterfaceRequest&& request, const CreateNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateNetworkInterfaceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateNetworkInterfaceAsyncHelper(const CreateNetworkInterfaceRequest& request, const CreateNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateNetworkInterface(request), context);
@@ -1393,7 +1753,7 @@ CreatePlacementGroupOutcome EC2Client::CreatePlacementGroup(const CreatePlacemen
 
 CreatePlacementGroupOutcomeCallable EC2Client::CreatePlacementGroupCallable(const CreatePlacementGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreatePlacementGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreatePlacementGroup( request ); } );
 }
 
 void EC2Client::CreatePlacementGroupAsync(const CreatePlacementGroupRequest& request, const CreatePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1401,6 +1761,16 @@ void EC2Client::CreatePlacementGroupAsync(const CreatePlacementGroupRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->CreatePlacementGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreatePlacementGroupOutcomeCallable EC2Client::CreatePlacementGroupCallable(CreatePlacementGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreatePlacementGroup, this, std::move(request)));
+}
+
+void EC2Client::CreatePlacementGroupAsync(CreatePlacementGroupRequest&& request, const CreatePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreatePlacementGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreatePlacementGroupAsyncHelper(const CreatePlacementGroupRequest& request, const CreatePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreatePlacementGroup(request), context);
@@ -1423,7 +1793,7 @@ CreateReservedInstancesListingOutcome EC2Client::CreateReservedInstancesListing(
 
 CreateReservedInstancesListingOutcomeCallable EC2Client::CreateReservedInstancesListingCallable(const CreateReservedInstancesListingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateReservedInstancesListing( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateReservedInstancesListing( request ); } );
 }
 
 void EC2Client::CreateReservedInstancesListingAsync(const CreateReservedInstancesListingRequest& request, const CreateReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1431,6 +1801,16 @@ void EC2Client::CreateReservedInstancesListingAsync(const CreateReservedInstance
   m_executor->Submit( [this, request, handler, context](){ this->CreateReservedInstancesListingAsyncHelper( request, handler, context ); } );
 }
 
+CreateReservedInstancesListingOutcomeCallable EC2Client::CreateReservedInstancesListingCallable(CreateReservedInstancesListingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateReservedInstancesListing, this, std::move(request)));
+}
+
+void EC2Client::CreateReservedInstancesListingAsync(CreateReservedInstancesListingRequest&& request, const CreateReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateReservedInstancesListingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateReservedInstancesListingAsyncHelper(const CreateReservedInstancesListingRequest& request, const CreateReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateReservedInstancesListing(request), context);
@@ -1453,7 +1833,7 @@ CreateRouteOutcome EC2Client::CreateRoute(const CreateRouteRequest& request) con
 
 CreateRouteOutcomeCallable EC2Client::CreateRouteCallable(const CreateRouteRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateRoute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateRoute( request ); } );
 }
 
 void EC2Client::CreateRouteAsync(const CreateRouteRequest& request, const CreateRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1461,6 +1841,16 @@ void EC2Client::CreateRouteAsync(const CreateRouteRequest& request, const Create
   m_executor->Submit( [this, request, handler, context](){ this->CreateRouteAsyncHelper( request, handler, context ); } );
 }
 
+CreateRouteOutcomeCallable EC2Client::CreateRouteCallable(CreateRouteRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateRoute, this, std::move(request)));
+}
+
+void EC2Client::CreateRouteAsync(CreateRouteRequest&& request, const CreateRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateRouteAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateRouteAsyncHelper(const CreateRouteRequest& request, const CreateRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateRoute(request), context);
@@ -1483,7 +1873,7 @@ CreateRouteTableOutcome EC2Client::CreateRouteTable(const CreateRouteTableReques
 
 CreateRouteTableOutcomeCallable EC2Client::CreateRouteTableCallable(const CreateRouteTableRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateRouteTable( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateRouteTable( request ); } );
 }
 
 void EC2Client::CreateRouteTableAsync(const CreateRouteTableRequest& request, const CreateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1491,6 +1881,16 @@ void EC2Client::CreateRouteTableAsync(const CreateRouteTableRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CreateRouteTableAsyncHelper( request, handler, context ); } );
 }
 
+CreateRouteTableOutcomeCallable EC2Client::CreateRouteTableCallable(CreateRouteTableRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateRouteTable, this, std::move(request)));
+}
+
+void EC2Client::CreateRouteTableAsync(CreateRouteTableRequest&& request, const CreateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateRouteTableAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateRouteTableAsyncHelper(const CreateRouteTableRequest& request, const CreateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateRouteTable(request), context);
@@ -1513,7 +1913,7 @@ CreateSecurityGroupOutcome EC2Client::CreateSecurityGroup(const CreateSecurityGr
 
 CreateSecurityGroupOutcomeCallable EC2Client::CreateSecurityGroupCallable(const CreateSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateSecurityGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateSecurityGroup( request ); } );
 }
 
 void EC2Client::CreateSecurityGroupAsync(const CreateSecurityGroupRequest& request, const CreateSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1521,6 +1921,16 @@ void EC2Client::CreateSecurityGroupAsync(const CreateSecurityGroupRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->CreateSecurityGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateSecurityGroupOutcomeCallable EC2Client::CreateSecurityGroupCallable(CreateSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateSecurityGroup, this, std::move(request)));
+}
+
+void EC2Client::CreateSecurityGroupAsync(CreateSecurityGroupRequest&& request, const CreateSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateSecurityGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateSecurityGroupAsyncHelper(const CreateSecurityGroupRequest& request, const CreateSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateSecurityGroup(request), context);
@@ -1543,7 +1953,7 @@ CreateSnapshotOutcome EC2Client::CreateSnapshot(const CreateSnapshotRequest& req
 
 CreateSnapshotOutcomeCallable EC2Client::CreateSnapshotCallable(const CreateSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateSnapshot( request ); } );
 }
 
 void EC2Client::CreateSnapshotAsync(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1551,6 +1961,16 @@ void EC2Client::CreateSnapshotAsync(const CreateSnapshotRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->CreateSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+CreateSnapshotOutcomeCallable EC2Client::CreateSnapshotCallable(CreateSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateSnapshot, this, std::move(request)));
+}
+
+void EC2Client::CreateSnapshotAsync(CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateSnapshotAsyncHelper(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateSnapshot(request), context);
@@ -1573,7 +1993,7 @@ CreateSpotDatafeedSubscriptionOutcome EC2Client::CreateSpotDatafeedSubscription(
 
 CreateSpotDatafeedSubscriptionOutcomeCallable EC2Client::CreateSpotDatafeedSubscriptionCallable(const CreateSpotDatafeedSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateSpotDatafeedSubscription( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateSpotDatafeedSubscription( request ); } );
 }
 
 void EC2Client::CreateSpotDatafeedSubscriptionAsync(const CreateSpotDatafeedSubscriptionRequest& request, const CreateSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1581,14 +2001,24 @@ void EC2Client::CreateSpotDatafeedSubscriptionAsync(const CreateSpotDatafeedSubs
   m_executor->Submit( [this, request, handler, context](){ this->CreateSpotDatafeedSubscriptionAsyncHelper( request, handler, context ); } );
 }
 
-void EC2Client::CreateSpotDatafeedSubscriptionAsyncHelper(const CreateSpotDatafeedSubscriptionRequest& request, const CreateSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+CreateSpotDatafeedSubscriptionOutcomeCallable EC2Client::CreateSpotDatafeedSubscriptionCallable(CreateSpotDatafeedSubscriptionRequest&& request) const
 {
-  handler(this, request, CreateSpotDatafeedSubscription(request), context);
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateSpotDatafeedSubscription, this, std::move(request)));
 }
 
-CreateSubnetOutcome EC2Client::CreateSubnet(const CreateSubnetRequest& request) const
+void EC2Client::CreateSpotDatafeedSubscriptionAsync(CreateSpotDatafeedSubscriptionRequest&& request, const CreateSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  Aws::StringStream ss;
+  m_executor->Submit(&EC2Client::CreateSpotDatafeedSubscriptionAsyncHelper, this, std::move(request), handler, context);
+}
+
+void EC2Client::CreateSpotDatafeedSubscriptionAsyncHelper(const CreateSpotDatafeedSubscriptionRequest& request, const CreateSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  handler(this, request, CreateSpotDatafeedSubscription(request), context);
+}
+
+CreateSubnetOutcome EC2Client::CreateSubnet(const CreateSubnetRequest& request) const
+{
+  Aws::StringStream ss;
   ss << m_uri << "/";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
@@ -1603,7 +2033,7 @@ CreateSubnetOutcome EC2Client::CreateSubnet(const CreateSubnetRequest& request)
 
 CreateSubnetOutcomeCallable EC2Client::CreateSubnetCallable(const CreateSubnetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateSubnet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateSubnet( request ); } );
 }
 
 void EC2Client::CreateSubnetAsync(const CreateSubnetRequest& request, const CreateSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1611,6 +2041,16 @@ void EC2Client::CreateSubnetAsync(const CreateSubnetRequest& request, const Crea
   m_executor->Submit( [this, request, handler, context](){ this->CreateSubnetAsyncHelper( request, handler, context ); } );
 }
 
+CreateSubnetOutcomeCallable EC2Client::CreateSubnetCallable(CreateSubnetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateSubnet, this, std::move(request)));
+}
+
+void EC2Client::CreateSubnetAsync(CreateSubnetRequest&& request, const CreateSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateSubnetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateSubnetAsyncHelper(const CreateSubnetRequest& request, const CreateSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateSubnet(request), context);
@@ -1633,7 +2073,7 @@ CreateTagsOutcome EC2Client::CreateTags(const CreateTagsRequest& request) const
 
 CreateTagsOutcomeCallable EC2Client::CreateTagsCallable(const CreateTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateTags( request ); } );
 }
 
 void EC2Client::CreateTagsAsync(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1641,6 +2081,16 @@ void EC2Client::CreateTagsAsync(const CreateTagsRequest& request, const CreateTa
   m_executor->Submit( [this, request, handler, context](){ this->CreateTagsAsyncHelper( request, handler, context ); } );
 }
 
+CreateTagsOutcomeCallable EC2Client::CreateTagsCallable(CreateTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateTags, this, std::move(request)));
+}
+
+void EC2Client::CreateTagsAsync(CreateTagsRequest&& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateTagsAsyncHelper(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateTags(request), context);
@@ -1663,7 +2113,7 @@ CreateVolumeOutcome EC2Client::CreateVolume(const CreateVolumeRequest& request)
 
 CreateVolumeOutcomeCallable EC2Client::CreateVolumeCallable(const CreateVolumeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateVolume( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateVolume( request ); } );
 }
 
 void EC2Client::CreateVolumeAsync(const CreateVolumeRequest& request, const CreateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1671,6 +2121,16 @@ void EC2Client::CreateVolumeAsync(const CreateVolumeRequest& request, const Crea
   m_executor->Submit( [this, request, handler, context](){ this->CreateVolumeAsyncHelper( request, handler, context ); } );
 }
 
+CreateVolumeOutcomeCallable EC2Client::CreateVolumeCallable(CreateVolumeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateVolume, this, std::move(request)));
+}
+
+void EC2Client::CreateVolumeAsync(CreateVolumeRequest&& request, const CreateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateVolumeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateVolumeAsyncHelper(const CreateVolumeRequest& request, const CreateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateVolume(request), context);
@@ -1693,7 +2153,7 @@ CreateVpcOutcome EC2Client::CreateVpc(const CreateVpcRequest& request) const
 
 CreateVpcOutcomeCallable EC2Client::CreateVpcCallable(const CreateVpcRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateVpc( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateVpc( request ); } );
 }
 
 void EC2Client::CreateVpcAsync(const CreateVpcRequest& request, const CreateVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1701,6 +2161,16 @@ void EC2Client::CreateVpcAsync(const CreateVpcRequest& request, const CreateVpcR
   m_executor->Submit( [this, request, handler, context](){ this->CreateVpcAsyncHelper( request, handler, context ); } );
 }
 
+CreateVpcOutcomeCallable EC2Client::CreateVpcCallable(CreateVpcRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateVpc, this, std::move(request)));
+}
+
+void EC2Client::CreateVpcAsync(CreateVpcRequest&& request, const CreateVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateVpcAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateVpcAsyncHelper(const CreateVpcRequest& request, const CreateVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateVpc(request), context);
@@ -1723,7 +2193,7 @@ CreateVpcEndpointOutcome EC2Client::CreateVpcEndpoint(const CreateVpcEndpointReq
 
 CreateVpcEndpointOutcomeCallable EC2Client::CreateVpcEndpointCallable(const CreateVpcEndpointRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateVpcEndpoint( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateVpcEndpoint( request ); } );
 }
 
 void EC2Client::CreateVpcEndpointAsync(const CreateVpcEndpointRequest& request, const CreateVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1731,6 +2201,16 @@ void EC2Client::CreateVpcEndpointAsync(const CreateVpcEndpointRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->CreateVpcEndpointAsyncHelper( request, handler, context ); } );
 }
 
+CreateVpcEndpointOutcomeCallable EC2Client::CreateVpcEndpointCallable(CreateVpcEndpointRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateVpcEndpoint, this, std::move(request)));
+}
+
+void EC2Client::CreateVpcEndpointAsync(CreateVpcEndpointRequest&& request, const CreateVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateVpcEndpointAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateVpcEndpointAsyncHelper(const CreateVpcEndpointRequest& request, const CreateVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateVpcEndpoint(request), context);
@@ -1753,7 +2233,7 @@ CreateVpcPeeringConnectionOutcome EC2Client::CreateVpcPeeringConnection(const Cr
 
 CreateVpcPeeringConnectionOutcomeCallable EC2Client::CreateVpcPeeringConnectionCallable(const CreateVpcPeeringConnectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateVpcPeeringConnection( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateVpcPeeringConnection( request ); } );
 }
 
 void EC2Client::CreateVpcPeeringConnectionAsync(const CreateVpcPeeringConnectionRequest& request, const CreateVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1761,6 +2241,16 @@ void EC2Client::CreateVpcPeeringConnectionAsync(const CreateVpcPeeringConnection
   m_executor->Submit( [this, request, handler, context](){ this->CreateVpcPeeringConnectionAsyncHelper( request, handler, context ); } );
 }
 
+CreateVpcPeeringConnectionOutcomeCallable EC2Client::CreateVpcPeeringConnectionCallable(CreateVpcPeeringConnectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateVpcPeeringConnection, this, std::move(request)));
+}
+
+void EC2Client::CreateVpcPeeringConnectionAsync(CreateVpcPeeringConnectionRequest&& request, const CreateVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateVpcPeeringConnectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateVpcPeeringConnectionAsyncHelper(const CreateVpcPeeringConnectionRequest& request, const CreateVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateVpcPeeringConnection(request), context);
@@ -1783,7 +2273,7 @@ CreateVpnConnectionOutcome EC2Client::CreateVpnConnection(const CreateVpnConnect
 
 CreateVpnConnectionOutcomeCallable EC2Client::CreateVpnConnectionCallable(const CreateVpnConnectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateVpnConnection( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateVpnConnection( request ); } );
 }
 
 void EC2Client::CreateVpnConnectionAsync(const CreateVpnConnectionRequest& request, const CreateVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1791,6 +2281,16 @@ void EC2Client::CreateVpnConnectionAsync(const CreateVpnConnectionRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->CreateVpnConnectionAsyncHelper( request, handler, context ); } );
 }
 
+CreateVpnConnectionOutcomeCallable EC2Client::CreateVpnConnectionCallable(CreateVpnConnectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateVpnConnection, this, std::move(request)));
+}
+
+void EC2Client::CreateVpnConnectionAsync(CreateVpnConnectionRequest&& request, const CreateVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateVpnConnectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateVpnConnectionAsyncHelper(const CreateVpnConnectionRequest& request, const CreateVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateVpnConnection(request), context);
@@ -1813,7 +2313,7 @@ CreateVpnConnectionRouteOutcome EC2Client::CreateVpnConnectionRoute(const Create
 
 CreateVpnConnectionRouteOutcomeCallable EC2Client::CreateVpnConnectionRouteCallable(const CreateVpnConnectionRouteRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateVpnConnectionRoute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateVpnConnectionRoute( request ); } );
 }
 
 void EC2Client::CreateVpnConnectionRouteAsync(const CreateVpnConnectionRouteRequest& request, const CreateVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1821,6 +2321,16 @@ void EC2Client::CreateVpnConnectionRouteAsync(const CreateVpnConnectionRouteRequ
   m_executor->Submit( [this, request, handler, context](){ this->CreateVpnConnectionRouteAsyncHelper( request, handler, context ); } );
 }
 
+CreateVpnConnectionRouteOutcomeCallable EC2Client::CreateVpnConnectionRouteCallable(CreateVpnConnectionRouteRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateVpnConnectionRoute, this, std::move(request)));
+}
+
+void EC2Client::CreateVpnConnectionRouteAsync(CreateVpnConnectionRouteRequest&& request, const CreateVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateVpnConnectionRouteAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateVpnConnectionRouteAsyncHelper(const CreateVpnConnectionRouteRequest& request, const CreateVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateVpnConnectionRoute(request), context);
@@ -1843,7 +2353,7 @@ CreateVpnGatewayOutcome EC2Client::CreateVpnGateway(const CreateVpnGatewayReques
 
 CreateVpnGatewayOutcomeCallable EC2Client::CreateVpnGatewayCallable(const CreateVpnGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateVpnGateway( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateVpnGateway( request ); } );
 }
 
 void EC2Client::CreateVpnGatewayAsync(const CreateVpnGatewayRequest& request, const CreateVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1851,6 +2361,16 @@ void EC2Client::CreateVpnGatewayAsync(const CreateVpnGatewayRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CreateVpnGatewayAsyncHelper( request, handler, context ); } );
 }
 
+CreateVpnGatewayOutcomeCallable EC2Client::CreateVpnGatewayCallable(CreateVpnGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::CreateVpnGateway, this, std::move(request)));
+}
+
+void EC2Client::CreateVpnGatewayAsync(CreateVpnGatewayRequest&& request, const CreateVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::CreateVpnGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::CreateVpnGatewayAsyncHelper(const CreateVpnGatewayRequest& request, const CreateVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateVpnGateway(request), context);
@@ -1873,7 +2393,7 @@ DeleteCustomerGatewayOutcome EC2Client::DeleteCustomerGateway(const DeleteCustom
 
 DeleteCustomerGatewayOutcomeCallable EC2Client::DeleteCustomerGatewayCallable(const DeleteCustomerGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteCustomerGateway( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteCustomerGateway( request ); } );
 }
 
 void EC2Client::DeleteCustomerGatewayAsync(const DeleteCustomerGatewayRequest& request, const DeleteCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1881,6 +2401,16 @@ void EC2Client::DeleteCustomerGatewayAsync(const DeleteCustomerGatewayRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DeleteCustomerGatewayAsyncHelper( request, handler, context ); } );
 }
 
+DeleteCustomerGatewayOutcomeCallable EC2Client::DeleteCustomerGatewayCallable(DeleteCustomerGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteCustomerGateway, this, std::move(request)));
+}
+
+void EC2Client::DeleteCustomerGatewayAsync(DeleteCustomerGatewayRequest&& request, const DeleteCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteCustomerGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteCustomerGatewayAsyncHelper(const DeleteCustomerGatewayRequest& request, const DeleteCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteCustomerGateway(request), context);
@@ -1903,7 +2433,7 @@ DeleteDhcpOptionsOutcome EC2Client::DeleteDhcpOptions(const DeleteDhcpOptionsReq
 
 DeleteDhcpOptionsOutcomeCallable EC2Client::DeleteDhcpOptionsCallable(const DeleteDhcpOptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDhcpOptions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDhcpOptions( request ); } );
 }
 
 void EC2Client::DeleteDhcpOptionsAsync(const DeleteDhcpOptionsRequest& request, const DeleteDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1911,6 +2441,16 @@ void EC2Client::DeleteDhcpOptionsAsync(const DeleteDhcpOptionsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDhcpOptionsAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDhcpOptionsOutcomeCallable EC2Client::DeleteDhcpOptionsCallable(DeleteDhcpOptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteDhcpOptions, this, std::move(request)));
+}
+
+void EC2Client::DeleteDhcpOptionsAsync(DeleteDhcpOptionsRequest&& request, const DeleteDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteDhcpOptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteDhcpOptionsAsyncHelper(const DeleteDhcpOptionsRequest& request, const DeleteDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDhcpOptions(request), context);
@@ -1933,7 +2473,7 @@ DeleteFlowLogsOutcome EC2Client::DeleteFlowLogs(const DeleteFlowLogsRequest& req
 
 DeleteFlowLogsOutcomeCallable EC2Client::DeleteFlowLogsCallable(const DeleteFlowLogsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteFlowLogs( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteFlowLogs( request ); } );
 }
 
 void EC2Client::DeleteFlowLogsAsync(const DeleteFlowLogsRequest& request, const DeleteFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1941,6 +2481,16 @@ void EC2Client::DeleteFlowLogsAsync(const DeleteFlowLogsRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DeleteFlowLogsAsyncHelper( request, handler, context ); } );
 }
 
+DeleteFlowLogsOutcomeCallable EC2Client::DeleteFlowLogsCallable(DeleteFlowLogsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteFlowLogs, this, std::move(request)));
+}
+
+void EC2Client::DeleteFlowLogsAsync(DeleteFlowLogsRequest&& request, const DeleteFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteFlowLogsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteFlowLogsAsyncHelper(const DeleteFlowLogsRequest& request, const DeleteFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteFlowLogs(request), context);
@@ -1963,7 +2513,7 @@ DeleteInternetGatewayOutcome EC2Client::DeleteInternetGateway(const DeleteIntern
 
 DeleteInternetGatewayOutcomeCallable EC2Client::DeleteInternetGatewayCallable(const DeleteInternetGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteInternetGateway( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteInternetGateway( request ); } );
 }
 
 void EC2Client::DeleteInternetGatewayAsync(const DeleteInternetGatewayRequest& request, const DeleteInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1971,6 +2521,16 @@ void EC2Client::DeleteInternetGatewayAsync(const DeleteInternetGatewayRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DeleteInternetGatewayAsyncHelper( request, handler, context ); } );
 }
 
+DeleteInternetGatewayOutcomeCallable EC2Client::DeleteInternetGatewayCallable(DeleteInternetGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteInternetGateway, this, std::move(request)));
+}
+
+void EC2Client::DeleteInternetGatewayAsync(DeleteInternetGatewayRequest&& request, const DeleteInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteInternetGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteInternetGatewayAsyncHelper(const DeleteInternetGatewayRequest& request, const DeleteInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteInternetGateway(request), context);
@@ -1993,7 +2553,7 @@ DeleteKeyPairOutcome EC2Client::DeleteKeyPair(const DeleteKeyPairRequest& reques
 
 DeleteKeyPairOutcomeCallable EC2Client::DeleteKeyPairCallable(const DeleteKeyPairRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteKeyPair( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteKeyPair( request ); } );
 }
 
 void EC2Client::DeleteKeyPairAsync(const DeleteKeyPairRequest& request, const DeleteKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2001,6 +2561,16 @@ void EC2Client::DeleteKeyPairAsync(const DeleteKeyPairRequest& request, const De
   m_executor->Submit( [this, request, handler, context](){ this->DeleteKeyPairAsyncHelper( request, handler, context ); } );
 }
 
+DeleteKeyPairOutcomeCallable EC2Client::DeleteKeyPairCallable(DeleteKeyPairRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteKeyPair, this, std::move(request)));
+}
+
+void EC2Client::DeleteKeyPairAsync(DeleteKeyPairRequest&& request, const DeleteKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteKeyPairAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteKeyPairAsyncHelper(const DeleteKeyPairRequest& request, const DeleteKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteKeyPair(request), context);
@@ -2023,7 +2593,7 @@ DeleteNatGatewayOutcome EC2Client::DeleteNatGateway(const DeleteNatGatewayReques
 
 DeleteNatGatewayOutcomeCallable EC2Client::DeleteNatGatewayCallable(const DeleteNatGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteNatGateway( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteNatGateway( request ); } );
 }
 
 void EC2Client::DeleteNatGatewayAsync(const DeleteNatGatewayRequest& request, const DeleteNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2031,6 +2601,16 @@ void EC2Client::DeleteNatGatewayAsync(const DeleteNatGatewayRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DeleteNatGatewayAsyncHelper( request, handler, context ); } );
 }
 
+DeleteNatGatewayOutcomeCallable EC2Client::DeleteNatGatewayCallable(DeleteNatGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteNatGateway, this, std::move(request)));
+}
+
+void EC2Client::DeleteNatGatewayAsync(DeleteNatGatewayRequest&& request, const DeleteNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteNatGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteNatGatewayAsyncHelper(const DeleteNatGatewayRequest& request, const DeleteNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteNatGateway(request), context);
@@ -2053,7 +2633,7 @@ DeleteNetworkAclOutcome EC2Client::DeleteNetworkAcl(const DeleteNetworkAclReques
 
 DeleteNetworkAclOutcomeCallable EC2Client::DeleteNetworkAclCallable(const DeleteNetworkAclRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteNetworkAcl( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteNetworkAcl( request ); } );
 }
 
 void EC2Client::DeleteNetworkAclAsync(const DeleteNetworkAclRequest& request, const DeleteNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2061,6 +2641,16 @@ void EC2Client::DeleteNetworkAclAsync(const DeleteNetworkAclRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DeleteNetworkAclAsyncHelper( request, handler, context ); } );
 }
 
+DeleteNetworkAclOutcomeCallable EC2Client::DeleteNetworkAclCallable(DeleteNetworkAclRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteNetworkAcl, this, std::move(request)));
+}
+
+void EC2Client::DeleteNetworkAclAsync(DeleteNetworkAclRequest&& request, const DeleteNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteNetworkAclAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteNetworkAclAsyncHelper(const DeleteNetworkAclRequest& request, const DeleteNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteNetworkAcl(request), context);
@@ -2083,7 +2673,7 @@ DeleteNetworkAclEntryOutcome EC2Client::DeleteNetworkAclEntry(const DeleteNetwor
 
 DeleteNetworkAclEntryOutcomeCallable EC2Client::DeleteNetworkAclEntryCallable(const DeleteNetworkAclEntryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteNetworkAclEntry( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteNetworkAclEntry( request ); } );
 }
 
 void EC2Client::DeleteNetworkAclEntryAsync(const DeleteNetworkAclEntryRequest& request, const DeleteNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2091,6 +2681,16 @@ void EC2Client::DeleteNetworkAclEntryAsync(const DeleteNetworkAclEntryRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DeleteNetworkAclEntryAsyncHelper( request, handler, context ); } );
 }
 
+DeleteNetworkAclEntryOutcomeCallable EC2Client::DeleteNetworkAclEntryCallable(DeleteNetworkAclEntryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteNetworkAclEntry, this, std::move(request)));
+}
+
+void EC2Client::DeleteNetworkAclEntryAsync(DeleteNetworkAclEntryRequest&& request, const DeleteNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteNetworkAclEntryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteNetworkAclEntryAsyncHelper(const DeleteNetworkAclEntryRequest& request, const DeleteNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteNetworkAclEntry(request), context);
@@ -2113,7 +2713,7 @@ DeleteNetworkInterfaceOutcome EC2Client::DeleteNetworkInterface(const DeleteNetw
 
 DeleteNetworkInterfaceOutcomeCallable EC2Client::DeleteNetworkInterfaceCallable(const DeleteNetworkInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteNetworkInterface( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteNetworkInterface( request ); } );
 }
 
 void EC2Client::DeleteNetworkInterfaceAsync(const DeleteNetworkInterfaceRequest& request, const DeleteNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2121,6 +2721,16 @@ void EC2Client::DeleteNetworkInterfaceAsync(const DeleteNetworkInterfaceRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DeleteNetworkInterfaceAsyncHelper( request, handler, context ); } );
 }
 
+DeleteNetworkInterfaceOutcomeCallable EC2Client::DeleteNetworkInterfaceCallable(DeleteNetworkInterfaceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteNetworkInterface, this, std::move(request)));
+}
+
+void EC2Client::DeleteNetworkInterfaceAsync(DeleteNetworkInterfaceRequest&& request, const DeleteNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteNetworkInterfaceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteNetworkInterfaceAsyncHelper(const DeleteNetworkInterfaceRequest& request, const DeleteNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteNetworkInterface(request), context);
@@ -2143,7 +2753,7 @@ DeletePlacementGroupOutcome EC2Client::DeletePlacementGroup(const DeletePlacemen
 
 DeletePlacementGroupOutcomeCallable EC2Client::DeletePlacementGroupCallable(const DeletePlacementGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeletePlacementGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeletePlacementGroup( request ); } );
 }
 
 void EC2Client::DeletePlacementGroupAsync(const DeletePlacementGroupRequest& request, const DeletePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2151,6 +2761,16 @@ void EC2Client::DeletePlacementGroupAsync(const DeletePlacementGroupRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DeletePlacementGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeletePlacementGroupOutcomeCallable EC2Client::DeletePlacementGroupCallable(DeletePlacementGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeletePlacementGroup, this, std::move(request)));
+}
+
+void EC2Client::DeletePlacementGroupAsync(DeletePlacementGroupRequest&& request, const DeletePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeletePlacementGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeletePlacementGroupAsyncHelper(const DeletePlacementGroupRequest& request, const DeletePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeletePlacementGroup(request), context);
@@ -2173,7 +2793,7 @@ DeleteRouteOutcome EC2Client::DeleteRoute(const DeleteRouteRequest& request) con
 
 DeleteRouteOutcomeCallable EC2Client::DeleteRouteCallable(const DeleteRouteRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRoute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRoute( request ); } );
 }
 
 void EC2Client::DeleteRouteAsync(const DeleteRouteRequest& request, const DeleteRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2181,6 +2801,16 @@ void EC2Client::DeleteRouteAsync(const DeleteRouteRequest& request, const Delete
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRouteAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRouteOutcomeCallable EC2Client::DeleteRouteCallable(DeleteRouteRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteRoute, this, std::move(request)));
+}
+
+void EC2Client::DeleteRouteAsync(DeleteRouteRequest&& request, const DeleteRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteRouteAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteRouteAsyncHelper(const DeleteRouteRequest& request, const DeleteRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRoute(request), context);
@@ -2203,7 +2833,7 @@ DeleteRouteTableOutcome EC2Client::DeleteRouteTable(const DeleteRouteTableReques
 
 DeleteRouteTableOutcomeCallable EC2Client::DeleteRouteTableCallable(const DeleteRouteTableRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRouteTable( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRouteTable( request ); } );
 }
 
 void EC2Client::DeleteRouteTableAsync(const DeleteRouteTableRequest& request, const DeleteRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2211,6 +2841,16 @@ void EC2Client::DeleteRouteTableAsync(const DeleteRouteTableRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRouteTableAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRouteTableOutcomeCallable EC2Client::DeleteRouteTableCallable(DeleteRouteTableRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteRouteTable, this, std::move(request)));
+}
+
+void EC2Client::DeleteRouteTableAsync(DeleteRouteTableRequest&& request, const DeleteRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteRouteTableAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteRouteTableAsyncHelper(const DeleteRouteTableRequest& request, const DeleteRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRouteTable(request), context);
@@ -2233,7 +2873,7 @@ DeleteSecurityGroupOutcome EC2Client::DeleteSecurityGroup(const DeleteSecurityGr
 
 DeleteSecurityGroupOutcomeCallable EC2Client::DeleteSecurityGroupCallable(const DeleteSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteSecurityGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteSecurityGroup( request ); } );
 }
 
 void EC2Client::DeleteSecurityGroupAsync(const DeleteSecurityGroupRequest& request, const DeleteSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2241,6 +2881,16 @@ void EC2Client::DeleteSecurityGroupAsync(const DeleteSecurityGroupRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DeleteSecurityGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteSecurityGroupOutcomeCallable EC2Client::DeleteSecurityGroupCallable(DeleteSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteSecurityGroup, this, std::move(request)));
+}
+
+void EC2Client::DeleteSecurityGroupAsync(DeleteSecurityGroupRequest&& request, const DeleteSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteSecurityGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteSecurityGroupAsyncHelper(const DeleteSecurityGroupRequest& request, const DeleteSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteSecurityGroup(request), context);
@@ -2263,7 +2913,7 @@ DeleteSnapshotOutcome EC2Client::DeleteSnapshot(const DeleteSnapshotRequest& req
 
 DeleteSnapshotOutcomeCallable EC2Client::DeleteSnapshotCallable(const DeleteSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteSnapshot( request ); } );
 }
 
 void EC2Client::DeleteSnapshotAsync(const DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2271,6 +2921,16 @@ void EC2Client::DeleteSnapshotAsync(const DeleteSnapshotRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DeleteSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+DeleteSnapshotOutcomeCallable EC2Client::DeleteSnapshotCallable(DeleteSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteSnapshot, this, std::move(request)));
+}
+
+void EC2Client::DeleteSnapshotAsync(DeleteSnapshotRequest&& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteSnapshotAsyncHelper(const DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteSnapshot(request), context);
@@ -2293,7 +2953,7 @@ DeleteSpotDatafeedSubscriptionOutcome EC2Client::DeleteSpotDatafeedSubscription(
 
 DeleteSpotDatafeedSubscriptionOutcomeCallable EC2Client::DeleteSpotDatafeedSubscriptionCallable(const DeleteSpotDatafeedSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteSpotDatafeedSubscription( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteSpotDatafeedSubscription( request ); } );
 }
 
 void EC2Client::DeleteSpotDatafeedSubscriptionAsync(const DeleteSpotDatafeedSubscriptionRequest& request, const DeleteSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2301,6 +2961,16 @@ void EC2Client::DeleteSpotDatafeedSubscriptionAsync(const DeleteSpotDatafeedSubs
   m_executor->Submit( [this, request, handler, context](){ this->DeleteSpotDatafeedSubscriptionAsyncHelper( request, handler, context ); } );
 }
 
+DeleteSpotDatafeedSubscriptionOutcomeCallable EC2Client::DeleteSpotDatafeedSubscriptionCallable(DeleteSpotDatafeedSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteSpotDatafeedSubscription, this, std::move(request)));
+}
+
+void EC2Client::DeleteSpotDatafeedSubscriptionAsync(DeleteSpotDatafeedSubscriptionRequest&& request, const DeleteSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteSpotDatafeedSubscriptionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteSpotDatafeedSubscriptionAsyncHelper(const DeleteSpotDatafeedSubscriptionRequest& request, const DeleteSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteSpotDatafeedSubscription(request), context);
@@ -2323,7 +2993,7 @@ DeleteSubnetOutcome EC2Client::DeleteSubnet(const DeleteSubnetRequest& request)
 
 DeleteSubnetOutcomeCallable EC2Client::DeleteSubnetCallable(const DeleteSubnetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteSubnet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteSubnet( request ); } );
 }
 
 void EC2Client::DeleteSubnetAsync(const DeleteSubnetRequest& request, const DeleteSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2331,6 +3001,16 @@ void EC2Client::DeleteSubnetAsync(const DeleteSubnetRequest& request, const Dele
   m_executor->Submit( [this, request, handler, context](){ this->DeleteSubnetAsyncHelper( request, handler, context ); } );
 }
 
+DeleteSubnetOutcomeCallable EC2Client::DeleteSubnetCallable(DeleteSubnetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteSubnet, this, std::move(request)));
+}
+
+void EC2Client::DeleteSubnetAsync(DeleteSubnetRequest&& request, const DeleteSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteSubnetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteSubnetAsyncHelper(const DeleteSubnetRequest& request, const DeleteSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteSubnet(request), context);
@@ -2353,7 +3033,7 @@ DeleteTagsOutcome EC2Client::DeleteTags(const DeleteTagsRequest& request) const
 
 DeleteTagsOutcomeCallable EC2Client::DeleteTagsCallable(const DeleteTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTags( request ); } );
 }
 
 void EC2Client::DeleteTagsAsync(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2361,6 +3041,16 @@ void EC2Client::DeleteTagsAsync(const DeleteTagsRequest& request, const DeleteTa
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTagsAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTagsOutcomeCallable EC2Client::DeleteTagsCallable(DeleteTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteTags, this, std::move(request)));
+}
+
+void EC2Client::DeleteTagsAsync(DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteTagsAsyncHelper(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTags(request), context);
@@ -2383,7 +3073,7 @@ DeleteVolumeOutcome EC2Client::DeleteVolume(const DeleteVolumeRequest& request)
 
 DeleteVolumeOutcomeCallable EC2Client::DeleteVolumeCallable(const DeleteVolumeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteVolume( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteVolume( request ); } );
 }
 
 void EC2Client::DeleteVolumeAsync(const DeleteVolumeRequest& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2391,6 +3081,16 @@ void EC2Client::DeleteVolumeAsync(const DeleteVolumeRequest& request, const Dele
   m_executor->Submit( [this, request, handler, context](){ this->DeleteVolumeAsyncHelper( request, handler, context ); } );
 }
 
+DeleteVolumeOutcomeCallable EC2Client::DeleteVolumeCallable(DeleteVolumeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteVolume, this, std::move(request)));
+}
+
+void EC2Client::DeleteVolumeAsync(DeleteVolumeRequest&& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteVolumeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteVolumeAsyncHelper(const DeleteVolumeRequest& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteVolume(request), context);
@@ -2413,7 +3113,7 @@ DeleteVpcOutcome EC2Client::DeleteVpc(const DeleteVpcRequest& request) const
 
 DeleteVpcOutcomeCallable EC2Client::DeleteVpcCallable(const DeleteVpcRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteVpc( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteVpc( request ); } );
 }
 
 void EC2Client::DeleteVpcAsync(const DeleteVpcRequest& request, const DeleteVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2421,6 +3121,16 @@ void EC2Client::DeleteVpcAsync(const DeleteVpcRequest& request, const DeleteVpcR
   m_executor->Submit( [this, request, handler, context](){ this->DeleteVpcAsyncHelper( request, handler, context ); } );
 }
 
+DeleteVpcOutcomeCallable EC2Client::DeleteVpcCallable(DeleteVpcRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteVpc, this, std::move(request)));
+}
+
+void EC2Client::DeleteVpcAsync(DeleteVpcRequest&& request, const DeleteVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteVpcAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteVpcAsyncHelper(const DeleteVpcRequest& request, const DeleteVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteVpc(request), context);
@@ -2443,7 +3153,7 @@ DeleteVpcEndpointsOutcome EC2Client::DeleteVpcEndpoints(const DeleteVpcEndpoints
 
 DeleteVpcEndpointsOutcomeCallable EC2Client::DeleteVpcEndpointsCallable(const DeleteVpcEndpointsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteVpcEndpoints( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteVpcEndpoints( request ); } );
 }
 
 void EC2Client::DeleteVpcEndpointsAsync(const DeleteVpcEndpointsRequest& request, const DeleteVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2451,6 +3161,16 @@ void EC2Client::DeleteVpcEndpointsAsync(const DeleteVpcEndpointsRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DeleteVpcEndpointsAsyncHelper( request, handler, context ); } );
 }
 
+DeleteVpcEndpointsOutcomeCallable EC2Client::DeleteVpcEndpointsCallable(DeleteVpcEndpointsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteVpcEndpoints, this, std::move(request)));
+}
+
+void EC2Client::DeleteVpcEndpointsAsync(DeleteVpcEndpointsRequest&& request, const DeleteVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteVpcEndpointsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteVpcEndpointsAsyncHelper(const DeleteVpcEndpointsRequest& request, const DeleteVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteVpcEndpoints(request), context);
@@ -2473,7 +3193,7 @@ DeleteVpcPeeringConnectionOutcome EC2Client::DeleteVpcPeeringConnection(const De
 
 DeleteVpcPeeringConnectionOutcomeCallable EC2Client::DeleteVpcPeeringConnectionCallable(const DeleteVpcPeeringConnectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteVpcPeeringConnection( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteVpcPeeringConnection( request ); } );
 }
 
 void EC2Client::DeleteVpcPeeringConnectionAsync(const DeleteVpcPeeringConnectionRequest& request, const DeleteVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2481,6 +3201,16 @@ void EC2Client::DeleteVpcPeeringConnectionAsync(const DeleteVpcPeeringConnection
   m_executor->Submit( [this, request, handler, context](){ this->DeleteVpcPeeringConnectionAsyncHelper( request, handler, context ); } );
 }
 
+DeleteVpcPeeringConnectionOutcomeCallable EC2Client::DeleteVpcPeeringConnectionCallable(DeleteVpcPeeringConnectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteVpcPeeringConnection, this, std::move(request)));
+}
+
+void EC2Client::DeleteVpcPeeringConnectionAsync(DeleteVpcPeeringConnectionRequest&& request, const DeleteVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteVpcPeeringConnectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteVpcPeeringConnectionAsyncHelper(const DeleteVpcPeeringConnectionRequest& request, const DeleteVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteVpcPeeringConnection(request), context);
@@ -2503,7 +3233,7 @@ DeleteVpnConnectionOutcome EC2Client::DeleteVpnConnection(const DeleteVpnConnect
 
 DeleteVpnConnectionOutcomeCallable EC2Client::DeleteVpnConnectionCallable(const DeleteVpnConnectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteVpnConnection( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteVpnConnection( request ); } );
 }
 
 void EC2Client::DeleteVpnConnectionAsync(const DeleteVpnConnectionRequest& request, const DeleteVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2511,6 +3241,16 @@ void EC2Client::DeleteVpnConnectionAsync(const DeleteVpnConnectionRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DeleteVpnConnectionAsyncHelper( request, handler, context ); } );
 }
 
+DeleteVpnConnectionOutcomeCallable EC2Client::DeleteVpnConnectionCallable(DeleteVpnConnectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteVpnConnection, this, std::move(request)));
+}
+
+void EC2Client::DeleteVpnConnectionAsync(DeleteVpnConnectionRequest&& request, const DeleteVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteVpnConnectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteVpnConnectionAsyncHelper(const DeleteVpnConnectionRequest& request, const DeleteVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteVpnConnection(request), context);
@@ -2533,7 +3273,7 @@ DeleteVpnConnectionRouteOutcome EC2Client::DeleteVpnConnectionRoute(const Delete
 
 DeleteVpnConnectionRouteOutcomeCallable EC2Client::DeleteVpnConnectionRouteCallable(const DeleteVpnConnectionRouteRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteVpnConnectionRoute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteVpnConnectionRoute( request ); } );
 }
 
 void EC2Client::DeleteVpnConnectionRouteAsync(const DeleteVpnConnectionRouteRequest& request, const DeleteVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2541,6 +3281,16 @@ void EC2Client::DeleteVpnConnectionRouteAsync(const DeleteVpnConnectionRouteRequ
   m_executor->Submit( [this, request, handler, context](){ this->DeleteVpnConnectionRouteAsyncHelper( request, handler, context ); } );
 }
 
+DeleteVpnConnectionRouteOutcomeCallable EC2Client::DeleteVpnConnectionRouteCallable(DeleteVpnConnectionRouteRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteVpnConnectionRoute, this, std::move(request)));
+}
+
+void EC2Client::DeleteVpnConnectionRouteAsync(DeleteVpnConnectionRouteRequest&& request, const DeleteVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteVpnConnectionRouteAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteVpnConnectionRouteAsyncHelper(const DeleteVpnConnectionRouteRequest& request, const DeleteVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteVpnConnectionRoute(request), context);
@@ -2563,7 +3313,7 @@ DeleteVpnGatewayOutcome EC2Client::DeleteVpnGateway(const DeleteVpnGatewayReques
 
 DeleteVpnGatewayOutcomeCallable EC2Client::DeleteVpnGatewayCallable(const DeleteVpnGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteVpnGateway( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteVpnGateway( request ); } );
 }
 
 void EC2Client::DeleteVpnGatewayAsync(const DeleteVpnGatewayRequest& request, const DeleteVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2571,6 +3321,16 @@ void EC2Client::DeleteVpnGatewayAsync(const DeleteVpnGatewayRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DeleteVpnGatewayAsyncHelper( request, handler, context ); } );
 }
 
+DeleteVpnGatewayOutcomeCallable EC2Client::DeleteVpnGatewayCallable(DeleteVpnGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeleteVpnGateway, this, std::move(request)));
+}
+
+void EC2Client::DeleteVpnGatewayAsync(DeleteVpnGatewayRequest&& request, const DeleteVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeleteVpnGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeleteVpnGatewayAsyncHelper(const DeleteVpnGatewayRequest& request, const DeleteVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteVpnGateway(request), context);
@@ -2593,7 +3353,7 @@ DeregisterImageOutcome EC2Client::DeregisterImage(const DeregisterImageRequest&
 
 DeregisterImageOutcomeCallable EC2Client::DeregisterImageCallable(const DeregisterImageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeregisterImage( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeregisterImage( request ); } );
 }
 
 void EC2Client::DeregisterImageAsync(const DeregisterImageRequest& request, const DeregisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2601,6 +3361,16 @@ void EC2Client::DeregisterImageAsync(const DeregisterImageRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->DeregisterImageAsyncHelper( request, handler, context ); } );
 }
 
+DeregisterImageOutcomeCallable EC2Client::DeregisterImageCallable(DeregisterImageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DeregisterImage, this, std::move(request)));
+}
+
+void EC2Client::DeregisterImageAsync(DeregisterImageRequest&& request, const DeregisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DeregisterImageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DeregisterImageAsyncHelper(const DeregisterImageRequest& request, const DeregisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeregisterImage(request), context);
@@ -2623,7 +3393,7 @@ DescribeAccountAttributesOutcome EC2Client::DescribeAccountAttributes(const Desc
 
 DescribeAccountAttributesOutcomeCallable EC2Client::DescribeAccountAttributesCallable(const DescribeAccountAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAccountAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAccountAttributes( request ); } );
 }
 
 void EC2Client::DescribeAccountAttributesAsync(const DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2631,6 +3401,16 @@ void EC2Client::DescribeAccountAttributesAsync(const DescribeAccountAttributesRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAccountAttributesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAccountAttributesOutcomeCallable EC2Client::DescribeAccountAttributesCallable(DescribeAccountAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeAccountAttributes, this, std::move(request)));
+}
+
+void EC2Client::DescribeAccountAttributesAsync(DescribeAccountAttributesRequest&& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeAccountAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeAccountAttributesAsyncHelper(const DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAccountAttributes(request), context);
@@ -2653,7 +3433,7 @@ DescribeAddressesOutcome EC2Client::DescribeAddresses(const DescribeAddressesReq
 
 DescribeAddressesOutcomeCallable EC2Client::DescribeAddressesCallable(const DescribeAddressesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAddresses( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAddresses( request ); } );
 }
 
 void EC2Client::DescribeAddressesAsync(const DescribeAddressesRequest& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2661,6 +3441,16 @@ void EC2Client::DescribeAddressesAsync(const DescribeAddressesRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAddressesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAddressesOutcomeCallable EC2Client::DescribeAddressesCallable(DescribeAddressesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeAddresses, this, std::move(request)));
+}
+
+void EC2Client::DescribeAddressesAsync(DescribeAddressesRequest&& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeAddressesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeAddressesAsyncHelper(const DescribeAddressesRequest& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAddresses(request), context);
@@ -2683,7 +3473,7 @@ DescribeAvailabilityZonesOutcome EC2Client::DescribeAvailabilityZones(const Desc
 
 DescribeAvailabilityZonesOutcomeCallable EC2Client::DescribeAvailabilityZonesCallable(const DescribeAvailabilityZonesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAvailabilityZones( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAvailabilityZones( request ); } );
 }
 
 void EC2Client::DescribeAvailabilityZonesAsync(const DescribeAvailabilityZonesRequest& request, const DescribeAvailabilityZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2691,6 +3481,16 @@ void EC2Client::DescribeAvailabilityZonesAsync(const DescribeAvailabilityZonesRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAvailabilityZonesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAvailabilityZonesOutcomeCallable EC2Client::DescribeAvailabilityZonesCallable(DescribeAvailabilityZonesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeAvailabilityZones, this, std::move(request)));
+}
+
+void EC2Client::DescribeAvailabilityZonesAsync(DescribeAvailabilityZonesRequest&& request, const DescribeAvailabilityZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeAvailabilityZonesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeAvailabilityZonesAsyncHelper(const DescribeAvailabilityZonesRequest& request, const DescribeAvailabilityZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAvailabilityZones(request), context);
@@ -2713,7 +3513,7 @@ DescribeBundleTasksOutcome EC2Client::DescribeBundleTasks(const DescribeBundleTa
 
 DescribeBundleTasksOutcomeCallable EC2Client::DescribeBundleTasksCallable(const DescribeBundleTasksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeBundleTasks( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeBundleTasks( request ); } );
 }
 
 void EC2Client::DescribeBundleTasksAsync(const DescribeBundleTasksRequest& request, const DescribeBundleTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2721,6 +3521,16 @@ void EC2Client::DescribeBundleTasksAsync(const DescribeBundleTasksRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeBundleTasksAsyncHelper( request, handler, context ); } );
 }
 
+DescribeBundleTasksOutcomeCallable EC2Client::DescribeBundleTasksCallable(DescribeBundleTasksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeBundleTasks, this, std::move(request)));
+}
+
+void EC2Client::DescribeBundleTasksAsync(DescribeBundleTasksRequest&& request, const DescribeBundleTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeBundleTasksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeBundleTasksAsyncHelper(const DescribeBundleTasksRequest& request, const DescribeBundleTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeBundleTasks(request), context);
@@ -2743,7 +3553,7 @@ DescribeClassicLinkInstancesOutcome EC2Client::DescribeClassicLinkInstances(cons
 
 DescribeClassicLinkInstancesOutcomeCallable EC2Client::DescribeClassicLinkInstancesCallable(const DescribeClassicLinkInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeClassicLinkInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeClassicLinkInstances( request ); } );
 }
 
 void EC2Client::DescribeClassicLinkInstancesAsync(const DescribeClassicLinkInstancesRequest& request, const DescribeClassicLinkInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2751,6 +3561,16 @@ void EC2Client::DescribeClassicLinkInstancesAsync(const DescribeClassicLinkInsta
   m_executor->Submit( [this, request, handler, context](){ this->DescribeClassicLinkInstancesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeClassicLinkInstancesOutcomeCallable EC2Client::DescribeClassicLinkInstancesCallable(DescribeClassicLinkInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeClassicLinkInstances, this, std::move(request)));
+}
+
+void EC2Client::DescribeClassicLinkInstancesAsync(DescribeClassicLinkInstancesRequest&& request, const DescribeClassicLinkInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeClassicLinkInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeClassicLinkInstancesAsyncHelper(const DescribeClassicLinkInstancesRequest& request, const DescribeClassicLinkInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeClassicLinkInstances(request), context);
@@ -2773,7 +3593,7 @@ DescribeConversionTasksOutcome EC2Client::DescribeConversionTasks(const Describe
 
 DescribeConversionTasksOutcomeCallable EC2Client::DescribeConversionTasksCallable(const DescribeConversionTasksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeConversionTasks( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeConversionTasks( request ); } );
 }
 
 void EC2Client::DescribeConversionTasksAsync(const DescribeConversionTasksRequest& request, const DescribeConversionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2781,6 +3601,16 @@ void EC2Client::DescribeConversionTasksAsync(const DescribeConversionTasksReques
   m_executor->Submit( [this, request, handler, context](){ this->DescribeConversionTasksAsyncHelper( request, handler, context ); } );
 }
 
+DescribeConversionTasksOutcomeCallable EC2Client::DescribeConversionTasksCallable(DescribeConversionTasksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeConversionTasks, this, std::move(request)));
+}
+
+void EC2Client::DescribeConversionTasksAsync(DescribeConversionTasksRequest&& request, const DescribeConversionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeConversionTasksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeConversionTasksAsyncHelper(const DescribeConversionTasksRequest& request, const DescribeConversionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeConversionTasks(request), context);
@@ -2803,7 +3633,7 @@ DescribeCustomerGatewaysOutcome EC2Client::DescribeCustomerGateways(const Descri
 
 DescribeCustomerGatewaysOutcomeCallable EC2Client::DescribeCustomerGatewaysCallable(const DescribeCustomerGatewaysRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCustomerGateways( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCustomerGateways( request ); } );
 }
 
 void EC2Client::DescribeCustomerGatewaysAsync(const DescribeCustomerGatewaysRequest& request, const DescribeCustomerGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2811,6 +3641,16 @@ void EC2Client::DescribeCustomerGatewaysAsync(const DescribeCustomerGatewaysRequ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCustomerGatewaysAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCustomerGatewaysOutcomeCallable EC2Client::DescribeCustomerGatewaysCallable(DescribeCustomerGatewaysRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeCustomerGateways, this, std::move(request)));
+}
+
+void EC2Client::DescribeCustomerGatewaysAsync(DescribeCustomerGatewaysRequest&& request, const DescribeCustomerGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeCustomerGatewaysAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeCustomerGatewaysAsyncHelper(const DescribeCustomerGatewaysRequest& request, const DescribeCustomerGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCustomerGateways(request), context);
@@ -2833,7 +3673,7 @@ DescribeDhcpOptionsOutcome EC2Client::DescribeDhcpOptions(const DescribeDhcpOpti
 
 DescribeDhcpOptionsOutcomeCallable EC2Client::DescribeDhcpOptionsCallable(const DescribeDhcpOptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDhcpOptions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDhcpOptions( request ); } );
 }
 
 void EC2Client::DescribeDhcpOptionsAsync(const DescribeDhcpOptionsRequest& request, const DescribeDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2841,6 +3681,16 @@ void EC2Client::DescribeDhcpOptionsAsync(const DescribeDhcpOptionsRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDhcpOptionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDhcpOptionsOutcomeCallable EC2Client::DescribeDhcpOptionsCallable(DescribeDhcpOptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeDhcpOptions, this, std::move(request)));
+}
+
+void EC2Client::DescribeDhcpOptionsAsync(DescribeDhcpOptionsRequest&& request, const DescribeDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeDhcpOptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeDhcpOptionsAsyncHelper(const DescribeDhcpOptionsRequest& request, const DescribeDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDhcpOptions(request), context);
@@ -2863,7 +3713,7 @@ DescribeExportTasksOutcome EC2Client::DescribeExportTasks(const DescribeExportTa
 
 DescribeExportTasksOutcomeCallable EC2Client::DescribeExportTasksCallable(const DescribeExportTasksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeExportTasks( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeExportTasks( request ); } );
 }
 
 void EC2Client::DescribeExportTasksAsync(const DescribeExportTasksRequest& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2871,6 +3721,16 @@ void EC2Client::DescribeExportTasksAsync(const DescribeExportTasksRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeExportTasksAsyncHelper( request, handler, context ); } );
 }
 
+DescribeExportTasksOutcomeCallable EC2Client::DescribeExportTasksCallable(DescribeExportTasksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeExportTasks, this, std::move(request)));
+}
+
+void EC2Client::DescribeExportTasksAsync(DescribeExportTasksRequest&& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeExportTasksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeExportTasksAsyncHelper(const DescribeExportTasksRequest& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeExportTasks(request), context);
@@ -2893,7 +3753,7 @@ DescribeFlowLogsOutcome EC2Client::DescribeFlowLogs(const DescribeFlowLogsReques
 
 DescribeFlowLogsOutcomeCallable EC2Client::DescribeFlowLogsCallable(const DescribeFlowLogsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeFlowLogs( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeFlowLogs( request ); } );
 }
 
 void EC2Client::DescribeFlowLogsAsync(const DescribeFlowLogsRequest& request, const DescribeFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2901,6 +3761,16 @@ void EC2Client::DescribeFlowLogsAsync(const DescribeFlowLogsRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DescribeFlowLogsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeFlowLogsOutcomeCallable EC2Client::DescribeFlowLogsCallable(DescribeFlowLogsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeFlowLogs, this, std::move(request)));
+}
+
+void EC2Client::DescribeFlowLogsAsync(DescribeFlowLogsRequest&& request, const DescribeFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeFlowLogsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeFlowLogsAsyncHelper(const DescribeFlowLogsRequest& request, const DescribeFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeFlowLogs(request), context);
@@ -2923,7 +3793,7 @@ DescribeHostsOutcome EC2Client::DescribeHosts(const DescribeHostsRequest& reques
 
 DescribeHostsOutcomeCallable EC2Client::DescribeHostsCallable(const DescribeHostsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeHosts( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeHosts( request ); } );
 }
 
 void EC2Client::DescribeHostsAsync(const DescribeHostsRequest& request, const DescribeHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2931,6 +3801,16 @@ void EC2Client::DescribeHostsAsync(const DescribeHostsRequest& request, const De
   m_executor->Submit( [this, request, handler, context](){ this->DescribeHostsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeHostsOutcomeCallable EC2Client::DescribeHostsCallable(DescribeHostsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeHosts, this, std::move(request)));
+}
+
+void EC2Client::DescribeHostsAsync(DescribeHostsRequest&& request, const DescribeHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeHostsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeHostsAsyncHelper(const DescribeHostsRequest& request, const DescribeHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeHosts(request), context);
@@ -2953,7 +3833,7 @@ DescribeIdFormatOutcome EC2Client::DescribeIdFormat(const DescribeIdFormatReques
 
 DescribeIdFormatOutcomeCallable EC2Client::DescribeIdFormatCallable(const DescribeIdFormatRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeIdFormat( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeIdFormat( request ); } );
 }
 
 void EC2Client::DescribeIdFormatAsync(const DescribeIdFormatRequest& request, const DescribeIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2961,6 +3841,16 @@ void EC2Client::DescribeIdFormatAsync(const DescribeIdFormatRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DescribeIdFormatAsyncHelper( request, handler, context ); } );
 }
 
+DescribeIdFormatOutcomeCallable EC2Client::DescribeIdFormatCallable(DescribeIdFormatRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeIdFormat, this, std::move(request)));
+}
+
+void EC2Client::DescribeIdFormatAsync(DescribeIdFormatRequest&& request, const DescribeIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeIdFormatAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeIdFormatAsyncHelper(const DescribeIdFormatRequest& request, const DescribeIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeIdFormat(request), context);
@@ -2983,7 +3873,7 @@ DescribeImageAttributeOutcome EC2Client::DescribeImageAttribute(const DescribeIm
 
 DescribeImageAttributeOutcomeCallable EC2Client::DescribeImageAttributeCallable(const DescribeImageAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeImageAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeImageAttribute( request ); } );
 }
 
 void EC2Client::DescribeImageAttributeAsync(const DescribeImageAttributeRequest& request, const DescribeImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2991,6 +3881,16 @@ void EC2Client::DescribeImageAttributeAsync(const DescribeImageAttributeRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeImageAttributeAsyncHelper( request, handler, context ); } );
 }
 
+DescribeImageAttributeOutcomeCallable EC2Client::DescribeImageAttributeCallable(DescribeImageAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeImageAttribute, this, std::move(request)));
+}
+
+void EC2Client::DescribeImageAttributeAsync(DescribeImageAttributeRequest&& request, const DescribeImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeImageAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeImageAttributeAsyncHelper(const DescribeImageAttributeRequest& request, const DescribeImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeImageAttribute(request), context);
@@ -3013,7 +3913,7 @@ DescribeImagesOutcome EC2Client::DescribeImages(const DescribeImagesRequest& req
 
 DescribeImagesOutcomeCallable EC2Client::DescribeImagesCallable(const DescribeImagesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeImages( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeImages( request ); } );
 }
 
 void EC2Client::DescribeImagesAsync(const DescribeImagesRequest& request, const DescribeImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3021,6 +3921,16 @@ void EC2Client::DescribeImagesAsync(const DescribeImagesRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DescribeImagesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeImagesOutcomeCallable EC2Client::DescribeImagesCallable(DescribeImagesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeImages, this, std::move(request)));
+}
+
+void EC2Client::DescribeImagesAsync(DescribeImagesRequest&& request, const DescribeImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeImagesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeImagesAsyncHelper(const DescribeImagesRequest& request, const DescribeImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeImages(request), context);
@@ -3043,7 +3953,7 @@ DescribeImportImageTasksOutcome EC2Client::DescribeImportImageTasks(const Descri
 
 DescribeImportImageTasksOutcomeCallable EC2Client::DescribeImportImageTasksCallable(const DescribeImportImageTasksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeImportImageTasks( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeImportImageTasks( request ); } );
 }
 
 void EC2Client::DescribeImportImageTasksAsync(const DescribeImportImageTasksRequest& request, const DescribeImportImageTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3051,6 +3961,16 @@ void EC2Client::DescribeImportImageTasksAsync(const DescribeImportImageTasksRequ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeImportImageTasksAsyncHelper( request, handler, context ); } );
 }
 
+DescribeImportImageTasksOutcomeCallable EC2Client::DescribeImportImageTasksCallable(DescribeImportImageTasksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeImportImageTasks, this, std::move(request)));
+}
+
+void EC2Client::DescribeImportImageTasksAsync(DescribeImportImageTasksRequest&& request, const DescribeImportImageTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeImportImageTasksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeImportImageTasksAsyncHelper(const DescribeImportImageTasksRequest& request, const DescribeImportImageTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeImportImageTasks(request), context);
@@ -3073,7 +3993,7 @@ DescribeImportSnapshotTasksOutcome EC2Client::DescribeImportSnapshotTasks(const
 
 DescribeImportSnapshotTasksOutcomeCallable EC2Client::DescribeImportSnapshotTasksCallable(const DescribeImportSnapshotTasksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeImportSnapshotTasks( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeImportSnapshotTasks( request ); } );
 }
 
 void EC2Client::DescribeImportSnapshotTasksAsync(const DescribeImportSnapshotTasksRequest& request, const DescribeImportSnapshotTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3081,6 +4001,16 @@ void EC2Client::DescribeImportSnapshotTasksAsync(const DescribeImportSnapshotTas
   m_executor->Submit( [this, request, handler, context](){ this->DescribeImportSnapshotTasksAsyncHelper( request, handler, context ); } );
 }
 
+DescribeImportSnapshotTasksOutcomeCallable EC2Client::DescribeImportSnapshotTasksCallable(DescribeImportSnapshotTasksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeImportSnapshotTasks, this, std::move(request)));
+}
+
+void EC2Client::DescribeImportSnapshotTasksAsync(DescribeImportSnapshotTasksRequest&& request, const DescribeImportSnapshotTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeImportSnapshotTasksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeImportSnapshotTasksAsyncHelper(const DescribeImportSnapshotTasksRequest& request, const DescribeImportSnapshotTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeImportSnapshotTasks(request), context);
@@ -3103,7 +4033,7 @@ DescribeInstanceAttributeOutcome EC2Client::DescribeInstanceAttribute(const Desc
 
 DescribeInstanceAttributeOutcomeCallable EC2Client::DescribeInstanceAttributeCallable(const DescribeInstanceAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeInstanceAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeInstanceAttribute( request ); } );
 }
 
 void EC2Client::DescribeInstanceAttributeAsync(const DescribeInstanceAttributeRequest& request, const DescribeInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3111,6 +4041,16 @@ void EC2Client::DescribeInstanceAttributeAsync(const DescribeInstanceAttributeRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeInstanceAttributeAsyncHelper( request, handler, context ); } );
 }
 
+DescribeInstanceAttributeOutcomeCallable EC2Client::DescribeInstanceAttributeCallable(DescribeInstanceAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeInstanceAttribute, this, std::move(request)));
+}
+
+void EC2Client::DescribeInstanceAttributeAsync(DescribeInstanceAttributeRequest&& request, const DescribeInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeInstanceAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeInstanceAttributeAsyncHelper(const DescribeInstanceAttributeRequest& request, const DescribeInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeInstanceAttribute(request), context);
@@ -3133,7 +4073,7 @@ DescribeInstanceStatusOutcome EC2Client::DescribeInstanceStatus(const DescribeIn
 
 DescribeInstanceStatusOutcomeCallable EC2Client::DescribeInstanceStatusCallable(const DescribeInstanceStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeInstanceStatus( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeInstanceStatus( request ); } );
 }
 
 void EC2Client::DescribeInstanceStatusAsync(const DescribeInstanceStatusRequest& request, const DescribeInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3141,6 +4081,16 @@ void EC2Client::DescribeInstanceStatusAsync(const DescribeInstanceStatusRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeInstanceStatusAsyncHelper( request, handler, context ); } );
 }
 
+DescribeInstanceStatusOutcomeCallable EC2Client::DescribeInstanceStatusCallable(DescribeInstanceStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeInstanceStatus, this, std::move(request)));
+}
+
+void EC2Client::DescribeInstanceStatusAsync(DescribeInstanceStatusRequest&& request, const DescribeInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeInstanceStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeInstanceStatusAsyncHelper(const DescribeInstanceStatusRequest& request, const DescribeInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeInstanceStatus(request), context);
@@ -3163,7 +4113,7 @@ DescribeInstancesOutcome EC2Client::DescribeInstances(const DescribeInstancesReq
 
 DescribeInstancesOutcomeCallable EC2Client::DescribeInstancesCallable(const DescribeInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeInstances( request ); } );
 }
 
 void EC2Client::DescribeInstancesAsync(const DescribeInstancesRequest& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3171,6 +4121,16 @@ void EC2Client::DescribeInstancesAsync(const DescribeInstancesRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DescribeInstancesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeInstancesOutcomeCallable EC2Client::DescribeInstancesCallable(DescribeInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeInstances, this, std::move(request)));
+}
+
+void EC2Client::DescribeInstancesAsync(DescribeInstancesRequest&& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeInstancesAsyncHelper(const DescribeInstancesRequest& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeInstances(request), context);
@@ -3193,7 +4153,7 @@ DescribeInternetGatewaysOutcome EC2Client::DescribeInternetGateways(const Descri
 
 DescribeInternetGatewaysOutcomeCallable EC2Client::DescribeInternetGatewaysCallable(const DescribeInternetGatewaysRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeInternetGateways( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeInternetGateways( request ); } );
 }
 
 void EC2Client::DescribeInternetGatewaysAsync(const DescribeInternetGatewaysRequest& request, const DescribeInternetGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3201,6 +4161,16 @@ void EC2Client::DescribeInternetGatewaysAsync(const DescribeInternetGatewaysRequ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeInternetGatewaysAsyncHelper( request, handler, context ); } );
 }
 
+DescribeInternetGatewaysOutcomeCallable EC2Client::DescribeInternetGatewaysCallable(DescribeInternetGatewaysRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeInternetGateways, this, std::move(request)));
+}
+
+void EC2Client::DescribeInternetGatewaysAsync(DescribeInternetGatewaysRequest&& request, const DescribeInternetGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeInternetGatewaysAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeInternetGatewaysAsyncHelper(const DescribeInternetGatewaysRequest& request, const DescribeInternetGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeInternetGateways(request), context);
@@ -3223,7 +4193,7 @@ DescribeKeyPairsOutcome EC2Client::DescribeKeyPairs(const DescribeKeyPairsReques
 
 DescribeKeyPairsOutcomeCallable EC2Client::DescribeKeyPairsCallable(const DescribeKeyPairsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeKeyPairs( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeKeyPairs( request ); } );
 }
 
 void EC2Client::DescribeKeyPairsAsync(const DescribeKeyPairsRequest& request, const DescribeKeyPairsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3231,6 +4201,16 @@ void EC2Client::DescribeKeyPairsAsync(const DescribeKeyPairsRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DescribeKeyPairsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeKeyPairsOutcomeCallable EC2Client::DescribeKeyPairsCallable(DescribeKeyPairsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeKeyPairs, this, std::move(request)));
+}
+
+void EC2Client::DescribeKeyPairsAsync(DescribeKeyPairsRequest&& request, const DescribeKeyPairsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeKeyPairsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeKeyPairsAsyncHelper(const DescribeKeyPairsRequest& request, const DescribeKeyPairsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeKeyPairs(request), context);
@@ -3253,7 +4233,7 @@ DescribeMovingAddressesOutcome EC2Client::DescribeMovingAddresses(const Describe
 
 DescribeMovingAddressesOutcomeCallable EC2Client::DescribeMovingAddressesCallable(const DescribeMovingAddressesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeMovingAddresses( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeMovingAddresses( request ); } );
 }
 
 void EC2Client::DescribeMovingAddressesAsync(const DescribeMovingAddressesRequest& request, const DescribeMovingAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3261,6 +4241,16 @@ void EC2Client::DescribeMovingAddressesAsync(const DescribeMovingAddressesReques
   m_executor->Submit( [this, request, handler, context](){ this->DescribeMovingAddressesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeMovingAddressesOutcomeCallable EC2Client::DescribeMovingAddressesCallable(DescribeMovingAddressesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeMovingAddresses, this, std::move(request)));
+}
+
+void EC2Client::DescribeMovingAddressesAsync(DescribeMovingAddressesRequest&& request, const DescribeMovingAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeMovingAddressesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeMovingAddressesAsyncHelper(const DescribeMovingAddressesRequest& request, const DescribeMovingAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeMovingAddresses(request), context);
@@ -3283,7 +4273,7 @@ DescribeNatGatewaysOutcome EC2Client::DescribeNatGateways(const DescribeNatGatew
 
 DescribeNatGatewaysOutcomeCallable EC2Client::DescribeNatGatewaysCallable(const DescribeNatGatewaysRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeNatGateways( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeNatGateways( request ); } );
 }
 
 void EC2Client::DescribeNatGatewaysAsync(const DescribeNatGatewaysRequest& request, const DescribeNatGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3291,6 +4281,16 @@ void EC2Client::DescribeNatGatewaysAsync(const DescribeNatGatewaysRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeNatGatewaysAsyncHelper( request, handler, context ); } );
 }
 
+DescribeNatGatewaysOutcomeCallable EC2Client::DescribeNatGatewaysCallable(DescribeNatGatewaysRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeNatGateways, this, std::move(request)));
+}
+
+void EC2Client::DescribeNatGatewaysAsync(DescribeNatGatewaysRequest&& request, const DescribeNatGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeNatGatewaysAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeNatGatewaysAsyncHelper(const DescribeNatGatewaysRequest& request, const DescribeNatGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeNatGateways(request), context);
@@ -3313,7 +4313,7 @@ DescribeNetworkAclsOutcome EC2Client::DescribeNetworkAcls(const DescribeNetworkA
 
 DescribeNetworkAclsOutcomeCallable EC2Client::DescribeNetworkAclsCallable(const DescribeNetworkAclsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeNetworkAcls( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeNetworkAcls( request ); } );
 }
 
 void EC2Client::DescribeNetworkAclsAsync(const DescribeNetworkAclsRequest& request, const DescribeNetworkAclsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3321,6 +4321,16 @@ void EC2Client::DescribeNetworkAclsAsync(const DescribeNetworkAclsRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeNetworkAclsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeNetworkAclsOutcomeCallable EC2Client::DescribeNetworkAclsCallable(DescribeNetworkAclsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeNetworkAcls, this, std::move(request)));
+}
+
+void EC2Client::DescribeNetworkAclsAsync(DescribeNetworkAclsRequest&& request, const DescribeNetworkAclsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeNetworkAclsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeNetworkAclsAsyncHelper(const DescribeNetworkAclsRequest& request, const DescribeNetworkAclsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeNetworkAcls(request), context);
@@ -3343,7 +4353,7 @@ DescribeNetworkInterfaceAttributeOutcome EC2Client::DescribeNetworkInterfaceAttr
 
 DescribeNetworkInterfaceAttributeOutcomeCallable EC2Client::DescribeNetworkInterfaceAttributeCallable(const DescribeNetworkInterfaceAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeNetworkInterfaceAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeNetworkInterfaceAttribute( request ); } );
 }
 
 void EC2Client::DescribeNetworkInterfaceAttributeAsync(const DescribeNetworkInterfaceAttributeRequest& request, const DescribeNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3351,6 +4361,16 @@ void EC2Client::DescribeNetworkInterfaceAttributeAsync(const DescribeNetworkInte
   m_executor->Submit( [this, request, handler, context](){ this->DescribeNetworkInterfaceAttributeAsyncHelper( request, handler, context ); } );
 }
 
+DescribeNetworkInterfaceAttributeOutcomeCallable EC2Client::DescribeNetworkInterfaceAttributeCallable(DescribeNetworkInterfaceAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeNetworkInterfaceAttribute, this, std::move(request)));
+}
+
+void EC2Client::DescribeNetworkInterfaceAttributeAsync(DescribeNetworkInterfaceAttributeRequest&& request, const DescribeNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeNetworkInterfaceAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeNetworkInterfaceAttributeAsyncHelper(const DescribeNetworkInterfaceAttributeRequest& request, const DescribeNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeNetworkInterfaceAttribute(request), context);
@@ -3373,7 +4393,7 @@ DescribeNetworkInterfacesOutcome EC2Client::DescribeNetworkInterfaces(const Desc
 
 DescribeNetworkInterfacesOutcomeCallable EC2Client::DescribeNetworkInterfacesCallable(const DescribeNetworkInterfacesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeNetworkInterfaces( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeNetworkInterfaces( request ); } );
 }
 
 void EC2Client::DescribeNetworkInterfacesAsync(const DescribeNetworkInterfacesRequest& request, const DescribeNetworkInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3381,6 +4401,16 @@ void EC2Client::DescribeNetworkInterfacesAsync(const DescribeNetworkInterfacesRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeNetworkInterfacesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeNetworkInterfacesOutcomeCallable EC2Client::DescribeNetworkInterfacesCallable(DescribeNetworkInterfacesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeNetworkInterfaces, this, std::move(request)));
+}
+
+void EC2Client::DescribeNetworkInterfacesAsync(DescribeNetworkInterfacesRequest&& request, const DescribeNetworkInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeNetworkInterfacesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeNetworkInterfacesAsyncHelper(const DescribeNetworkInterfacesRequest& request, const DescribeNetworkInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeNetworkInterfaces(request), context);
@@ -3403,7 +4433,7 @@ DescribePlacementGroupsOutcome EC2Client::DescribePlacementGroups(const Describe
 
 DescribePlacementGroupsOutcomeCallable EC2Client::DescribePlacementGroupsCallable(const DescribePlacementGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribePlacementGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribePlacementGroups( request ); } );
 }
 
 void EC2Client::DescribePlacementGroupsAsync(const DescribePlacementGroupsRequest& request, const DescribePlacementGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3411,6 +4441,16 @@ void EC2Client::DescribePlacementGroupsAsync(const DescribePlacementGroupsReques
   m_executor->Submit( [this, request, handler, context](){ this->DescribePlacementGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribePlacementGroupsOutcomeCallable EC2Client::DescribePlacementGroupsCallable(DescribePlacementGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribePlacementGroups, this, std::move(request)));
+}
+
+void EC2Client::DescribePlacementGroupsAsync(DescribePlacementGroupsRequest&& request, const DescribePlacementGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribePlacementGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribePlacementGroupsAsyncHelper(const DescribePlacementGroupsRequest& request, const DescribePlacementGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribePlacementGroups(request), context);
@@ -3433,7 +4473,7 @@ DescribePrefixListsOutcome EC2Client::DescribePrefixLists(const DescribePrefixLi
 
 DescribePrefixListsOutcomeCallable EC2Client::DescribePrefixListsCallable(const DescribePrefixListsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribePrefixLists( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribePrefixLists( request ); } );
 }
 
 void EC2Client::DescribePrefixListsAsync(const DescribePrefixListsRequest& request, const DescribePrefixListsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3441,6 +4481,16 @@ void EC2Client::DescribePrefixListsAsync(const DescribePrefixListsRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribePrefixListsAsyncHelper( request, handler, context ); } );
 }
 
+DescribePrefixListsOutcomeCallable EC2Client::DescribePrefixListsCallable(DescribePrefixListsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribePrefixLists, this, std::move(request)));
+}
+
+void EC2Client::DescribePrefixListsAsync(DescribePrefixListsRequest&& request, const DescribePrefixListsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribePrefixListsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribePrefixListsAsyncHelper(const DescribePrefixListsRequest& request, const DescribePrefixListsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribePrefixLists(request), context);
@@ -3463,7 +4513,7 @@ DescribeRegionsOutcome EC2Client::DescribeRegions(const DescribeRegionsRequest&
 
 DescribeRegionsOutcomeCallable EC2Client::DescribeRegionsCallable(const DescribeRegionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeRegions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeRegions( request ); } );
 }
 
 void EC2Client::DescribeRegionsAsync(const DescribeRegionsRequest& request, const DescribeRegionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3471,6 +4521,16 @@ void EC2Client::DescribeRegionsAsync(const DescribeRegionsRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->DescribeRegionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeRegionsOutcomeCallable EC2Client::DescribeRegionsCallable(DescribeRegionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeRegions, this, std::move(request)));
+}
+
+void EC2Client::DescribeRegionsAsync(DescribeRegionsRequest&& request, const DescribeRegionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeRegionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeRegionsAsyncHelper(const DescribeRegionsRequest& request, const DescribeRegionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeRegions(request), context);
@@ -3493,7 +4553,7 @@ DescribeReservedInstancesOutcome EC2Client::DescribeReservedInstances(const Desc
 
 DescribeReservedInstancesOutcomeCallable EC2Client::DescribeReservedInstancesCallable(const DescribeReservedInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReservedInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReservedInstances( request ); } );
 }
 
 void EC2Client::DescribeReservedInstancesAsync(const DescribeReservedInstancesRequest& request, const DescribeReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3501,6 +4561,16 @@ void EC2Client::DescribeReservedInstancesAsync(const DescribeReservedInstancesRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReservedInstancesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReservedInstancesOutcomeCallable EC2Client::DescribeReservedInstancesCallable(DescribeReservedInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeReservedInstances, this, std::move(request)));
+}
+
+void EC2Client::DescribeReservedInstancesAsync(DescribeReservedInstancesRequest&& request, const DescribeReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeReservedInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeReservedInstancesAsyncHelper(const DescribeReservedInstancesRequest& request, const DescribeReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReservedInstances(request), context);
@@ -3523,7 +4593,7 @@ DescribeReservedInstancesListingsOutcome EC2Client::DescribeReservedInstancesLis
 
 DescribeReservedInstancesListingsOutcomeCallable EC2Client::DescribeReservedInstancesListingsCallable(const DescribeReservedInstancesListingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReservedInstancesListings( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReservedInstancesListings( request ); } );
 }
 
 void EC2Client::DescribeReservedInstancesListingsAsync(const DescribeReservedInstancesListingsRequest& request, const DescribeReservedInstancesListingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3531,6 +4601,16 @@ void EC2Client::DescribeReservedInstancesListingsAsync(const DescribeReservedIns
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReservedInstancesListingsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReservedInstancesListingsOutcomeCallable EC2Client::DescribeReservedInstancesListingsCallable(DescribeReservedInstancesListingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeReservedInstancesListings, this, std::move(request)));
+}
+
+void EC2Client::DescribeReservedInstancesListingsAsync(DescribeReservedInstancesListingsRequest&& request, const DescribeReservedInstancesListingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeReservedInstancesListingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeReservedInstancesListingsAsyncHelper(const DescribeReservedInstancesListingsRequest& request, const DescribeReservedInstancesListingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReservedInstancesListings(request), context);
@@ -3553,7 +4633,7 @@ DescribeReservedInstancesModificationsOutcome EC2Client::DescribeReservedInstanc
 
 DescribeReservedInstancesModificationsOutcomeCallable EC2Client::DescribeReservedInstancesModificationsCallable(const DescribeReservedInstancesModificationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReservedInstancesModifications( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReservedInstancesModifications( request ); } );
 }
 
 void EC2Client::DescribeReservedInstancesModificationsAsync(const DescribeReservedInstancesModificationsRequest& request, const DescribeReservedInstancesModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3561,6 +4641,16 @@ void EC2Client::DescribeReservedInstancesModificationsAsync(const DescribeReserv
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReservedInstancesModificationsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReservedInstancesModificationsOutcomeCallable EC2Client::DescribeReservedInstancesModificationsCallable(DescribeReservedInstancesModificationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeReservedInstancesModifications, this, std::move(request)));
+}
+
+void EC2Client::DescribeReservedInstancesModificationsAsync(DescribeReservedInstancesModificationsRequest&& request, const DescribeReservedInstancesModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeReservedInstancesModificationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeReservedInstancesModificationsAsyncHelper(const DescribeReservedInstancesModificationsRequest& request, const DescribeReservedInstancesModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReservedInstancesModifications(request), context);
@@ -3583,7 +4673,7 @@ DescribeReservedInstancesOfferingsOutcome EC2Client::DescribeReservedInstancesOf
 
 DescribeReservedInstancesOfferingsOutcomeCallable EC2Client::DescribeReservedInstancesOfferingsCallable(const DescribeReservedInstancesOfferingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReservedInstancesOfferings( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReservedInstancesOfferings( request ); } );
 }
 
 void EC2Client::DescribeReservedInstancesOfferingsAsync(const DescribeReservedInstancesOfferingsRequest& request, const DescribeReservedInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3591,6 +4681,16 @@ void EC2Client::DescribeReservedInstancesOfferingsAsync(const DescribeReservedIn
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReservedInstancesOfferingsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReservedInstancesOfferingsOutcomeCallable EC2Client::DescribeReservedInstancesOfferingsCallable(DescribeReservedInstancesOfferingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeReservedInstancesOfferings, this, std::move(request)));
+}
+
+void EC2Client::DescribeReservedInstancesOfferingsAsync(DescribeReservedInstancesOfferingsRequest&& request, const DescribeReservedInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeReservedInstancesOfferingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeReservedInstancesOfferingsAsyncHelper(const DescribeReservedInstancesOfferingsRequest& request, const DescribeReservedInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReservedInstancesOfferings(request), context);
@@ -3613,7 +4713,7 @@ DescribeRouteTablesOutcome EC2Client::DescribeRouteTables(const DescribeRouteTab
 
 DescribeRouteTablesOutcomeCallable EC2Client::DescribeRouteTablesCallable(const DescribeRouteTablesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeRouteTables( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeRouteTables( request ); } );
 }
 
 void EC2Client::DescribeRouteTablesAsync(const DescribeRouteTablesRequest& request, const DescribeRouteTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3621,6 +4721,16 @@ void EC2Client::DescribeRouteTablesAsync(const DescribeRouteTablesRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeRouteTablesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeRouteTablesOutcomeCallable EC2Client::DescribeRouteTablesCallable(DescribeRouteTablesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeRouteTables, this, std::move(request)));
+}
+
+void EC2Client::DescribeRouteTablesAsync(DescribeRouteTablesRequest&& request, const DescribeRouteTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeRouteTablesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeRouteTablesAsyncHelper(const DescribeRouteTablesRequest& request, const DescribeRouteTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeRouteTables(request), context);
@@ -3643,7 +4753,7 @@ DescribeScheduledInstanceAvailabilityOutcome EC2Client::DescribeScheduledInstanc
 
 DescribeScheduledInstanceAvailabilityOutcomeCallable EC2Client::DescribeScheduledInstanceAvailabilityCallable(const DescribeScheduledInstanceAvailabilityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeScheduledInstanceAvailability( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeScheduledInstanceAvailability( request ); } );
 }
 
 void EC2Client::DescribeScheduledInstanceAvailabilityAsync(const DescribeScheduledInstanceAvailabilityRequest& request, const DescribeScheduledInstanceAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3651,6 +4761,16 @@ void EC2Client::DescribeScheduledInstanceAvailabilityAsync(const DescribeSchedul
   m_executor->Submit( [this, request, handler, context](){ this->DescribeScheduledInstanceAvailabilityAsyncHelper( request, handler, context ); } );
 }
 
+DescribeScheduledInstanceAvailabilityOutcomeCallable EC2Client::DescribeScheduledInstanceAvailabilityCallable(DescribeScheduledInstanceAvailabilityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeScheduledInstanceAvailability, this, std::move(request)));
+}
+
+void EC2Client::DescribeScheduledInstanceAvailabilityAsync(DescribeScheduledInstanceAvailabilityRequest&& request, const DescribeScheduledInstanceAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeScheduledInstanceAvailabilityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeScheduledInstanceAvailabilityAsyncHelper(const DescribeScheduledInstanceAvailabilityRequest& request, const DescribeScheduledInstanceAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeScheduledInstanceAvailability(request), context);
@@ -3673,7 +4793,7 @@ DescribeScheduledInstancesOutcome EC2Client::DescribeScheduledInstances(const De
 
 DescribeScheduledInstancesOutcomeCallable EC2Client::DescribeScheduledInstancesCallable(const DescribeScheduledInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeScheduledInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeScheduledInstances( request ); } );
 }
 
 void EC2Client::DescribeScheduledInstancesAsync(const DescribeScheduledInstancesRequest& request, const DescribeScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3681,6 +4801,16 @@ void EC2Client::DescribeScheduledInstancesAsync(const DescribeScheduledInstances
   m_executor->Submit( [this, request, handler, context](){ this->DescribeScheduledInstancesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeScheduledInstancesOutcomeCallable EC2Client::DescribeScheduledInstancesCallable(DescribeScheduledInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeScheduledInstances, this, std::move(request)));
+}
+
+void EC2Client::DescribeScheduledInstancesAsync(DescribeScheduledInstancesRequest&& request, const DescribeScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeScheduledInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeScheduledInstancesAsyncHelper(const DescribeScheduledInstancesRequest& request, const DescribeScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeScheduledInstances(request), context);
@@ -3703,7 +4833,7 @@ DescribeSecurityGroupReferencesOutcome EC2Client::DescribeSecurityGroupReference
 
 DescribeSecurityGroupReferencesOutcomeCallable EC2Client::DescribeSecurityGroupReferencesCallable(const DescribeSecurityGroupReferencesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSecurityGroupReferences( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSecurityGroupReferences( request ); } );
 }
 
 void EC2Client::DescribeSecurityGroupReferencesAsync(const DescribeSecurityGroupReferencesRequest& request, const DescribeSecurityGroupReferencesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3711,6 +4841,16 @@ void EC2Client::DescribeSecurityGroupReferencesAsync(const DescribeSecurityGroup
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSecurityGroupReferencesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSecurityGroupReferencesOutcomeCallable EC2Client::DescribeSecurityGroupReferencesCallable(DescribeSecurityGroupReferencesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeSecurityGroupReferences, this, std::move(request)));
+}
+
+void EC2Client::DescribeSecurityGroupReferencesAsync(DescribeSecurityGroupReferencesRequest&& request, const DescribeSecurityGroupReferencesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeSecurityGroupReferencesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeSecurityGroupReferencesAsyncHelper(const DescribeSecurityGroupReferencesRequest& request, const DescribeSecurityGroupReferencesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSecurityGroupReferences(request), context);
@@ -3733,7 +4873,7 @@ DescribeSecurityGroupsOutcome EC2Client::DescribeSecurityGroups(const DescribeSe
 
 DescribeSecurityGroupsOutcomeCallable EC2Client::DescribeSecurityGroupsCallable(const DescribeSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSecurityGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSecurityGroups( request ); } );
 }
 
 void EC2Client::DescribeSecurityGroupsAsync(const DescribeSecurityGroupsRequest& request, const DescribeSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3741,6 +4881,16 @@ void EC2Client::DescribeSecurityGroupsAsync(const DescribeSecurityGroupsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSecurityGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSecurityGroupsOutcomeCallable EC2Client::DescribeSecurityGroupsCallable(DescribeSecurityGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeSecurityGroups, this, std::move(request)));
+}
+
+void EC2Client::DescribeSecurityGroupsAsync(DescribeSecurityGroupsRequest&& request, const DescribeSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeSecurityGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeSecurityGroupsAsyncHelper(const DescribeSecurityGroupsRequest& request, const DescribeSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSecurityGroups(request), context);
@@ -3763,7 +4913,7 @@ DescribeSnapshotAttributeOutcome EC2Client::DescribeSnapshotAttribute(const Desc
 
 DescribeSnapshotAttributeOutcomeCallable EC2Client::DescribeSnapshotAttributeCallable(const DescribeSnapshotAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSnapshotAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSnapshotAttribute( request ); } );
 }
 
 void EC2Client::DescribeSnapshotAttributeAsync(const DescribeSnapshotAttributeRequest& request, const DescribeSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3771,6 +4921,16 @@ void EC2Client::DescribeSnapshotAttributeAsync(const DescribeSnapshotAttributeRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSnapshotAttributeAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSnapshotAttributeOutcomeCallable EC2Client::DescribeSnapshotAttributeCallable(DescribeSnapshotAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeSnapshotAttribute, this, std::move(request)));
+}
+
+void EC2Client::DescribeSnapshotAttributeAsync(DescribeSnapshotAttributeRequest&& request, const DescribeSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeSnapshotAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeSnapshotAttributeAsyncHelper(const DescribeSnapshotAttributeRequest& request, const DescribeSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSnapshotAttribute(request), context);
@@ -3793,7 +4953,7 @@ DescribeSnapshotsOutcome EC2Client::DescribeSnapshots(const DescribeSnapshotsReq
 
 DescribeSnapshotsOutcomeCallable EC2Client::DescribeSnapshotsCallable(const DescribeSnapshotsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSnapshots( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSnapshots( request ); } );
 }
 
 void EC2Client::DescribeSnapshotsAsync(const DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3801,6 +4961,16 @@ void EC2Client::DescribeSnapshotsAsync(const DescribeSnapshotsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSnapshotsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSnapshotsOutcomeCallable EC2Client::DescribeSnapshotsCallable(DescribeSnapshotsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeSnapshots, this, std::move(request)));
+}
+
+void EC2Client::DescribeSnapshotsAsync(DescribeSnapshotsRequest&& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeSnapshotsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeSnapshotsAsyncHelper(const DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSnapshots(request), context);
@@ -3823,7 +4993,7 @@ DescribeSpotDatafeedSubscriptionOutcome EC2Client::DescribeSpotDatafeedSubscript
 
 DescribeSpotDatafeedSubscriptionOutcomeCallable EC2Client::DescribeSpotDatafeedSubscriptionCallable(const DescribeSpotDatafeedSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSpotDatafeedSubscription( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSpotDatafeedSubscription( request ); } );
 }
 
 void EC2Client::DescribeSpotDatafeedSubscriptionAsync(const DescribeSpotDatafeedSubscriptionRequest& request, const DescribeSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3831,6 +5001,16 @@ void EC2Client::DescribeSpotDatafeedSubscriptionAsync(const DescribeSpotDatafeed
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSpotDatafeedSubscriptionAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSpotDatafeedSubscriptionOutcomeCallable EC2Client::DescribeSpotDatafeedSubscriptionCallable(DescribeSpotDatafeedSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeSpotDatafeedSubscription, this, std::move(request)));
+}
+
+void EC2Client::DescribeSpotDatafeedSubscriptionAsync(DescribeSpotDatafeedSubscriptionRequest&& request, const DescribeSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeSpotDatafeedSubscriptionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeSpotDatafeedSubscriptionAsyncHelper(const DescribeSpotDatafeedSubscriptionRequest& request, const DescribeSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSpotDatafeedSubscription(request), context);
@@ -3853,7 +5033,7 @@ DescribeSpotFleetInstancesOutcome EC2Client::DescribeSpotFleetInstances(const De
 
 DescribeSpotFleetInstancesOutcomeCallable EC2Client::DescribeSpotFleetInstancesCallable(const DescribeSpotFleetInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSpotFleetInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSpotFleetInstances( request ); } );
 }
 
 void EC2Client::DescribeSpotFleetInstancesAsync(const DescribeSpotFleetInstancesRequest& request, const DescribeSpotFleetInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3861,6 +5041,16 @@ void EC2Client::DescribeSpotFleetInstancesAsync(const DescribeSpotFleetInstances
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSpotFleetInstancesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSpotFleetInstancesOutcomeCallable EC2Client::DescribeSpotFleetInstancesCallable(DescribeSpotFleetInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeSpotFleetInstances, this, std::move(request)));
+}
+
+void EC2Client::DescribeSpotFleetInstancesAsync(DescribeSpotFleetInstancesRequest&& request, const DescribeSpotFleetInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeSpotFleetInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeSpotFleetInstancesAsyncHelper(const DescribeSpotFleetInstancesRequest& request, const DescribeSpotFleetInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSpotFleetInstances(request), context);
@@ -3883,7 +5073,7 @@ DescribeSpotFleetRequestHistoryOutcome EC2Client::DescribeSpotFleetRequestHistor
 
 DescribeSpotFleetRequestHistoryOutcomeCallable EC2Client::DescribeSpotFleetRequestHistoryCallable(const DescribeSpotFleetRequestHistoryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSpotFleetRequestHistory( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSpotFleetRequestHistory( request ); } );
 }
 
 void EC2Client::DescribeSpotFleetRequestHistoryAsync(const DescribeSpotFleetRequestHistoryRequest& request, const DescribeSpotFleetRequestHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3891,6 +5081,16 @@ void EC2Client::DescribeSpotFleetRequestHistoryAsync(const DescribeSpotFleetRequ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSpotFleetRequestHistoryAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSpotFleetRequestHistoryOutcomeCallable EC2Client::DescribeSpotFleetRequestHistoryCallable(DescribeSpotFleetRequestHistoryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeSpotFleetRequestHistory, this, std::move(request)));
+}
+
+void EC2Client::DescribeSpotFleetRequestHistoryAsync(DescribeSpotFleetRequestHistoryRequest&& request, const DescribeSpotFleetRequestHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeSpotFleetRequestHistoryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeSpotFleetRequestHistoryAsyncHelper(const DescribeSpotFleetRequestHistoryRequest& request, const DescribeSpotFleetRequestHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSpotFleetRequestHistory(request), context);
@@ -3913,7 +5113,7 @@ DescribeSpotFleetRequestsOutcome EC2Client::DescribeSpotFleetRequests(const Desc
 
 DescribeSpotFleetRequestsOutcomeCallable EC2Client::DescribeSpotFleetRequestsCallable(const DescribeSpotFleetRequestsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSpotFleetRequests( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSpotFleetRequests( request ); } );
 }
 
 void EC2Client::DescribeSpotFleetRequestsAsync(const DescribeSpotFleetRequestsRequest& request, const DescribeSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3921,6 +5121,16 @@ void EC2Client::DescribeSpotFleetRequestsAsync(const DescribeSpotFleetRequestsRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSpotFleetRequestsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSpotFleetRequestsOutcomeCallable EC2Client::DescribeSpotFleetRequestsCallable(DescribeSpotFleetRequestsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeSpotFleetRequests, this, std::move(request)));
+}
+
+void EC2Client::DescribeSpotFleetRequestsAsync(DescribeSpotFleetRequestsRequest&& request, const DescribeSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeSpotFleetRequestsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeSpotFleetRequestsAsyncHelper(const DescribeSpotFleetRequestsRequest& request, const DescribeSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSpotFleetRequests(request), context);
@@ -3943,7 +5153,7 @@ DescribeSpotInstanceRequestsOutcome EC2Client::DescribeSpotInstanceRequests(cons
 
 DescribeSpotInstanceRequestsOutcomeCallable EC2Client::DescribeSpotInstanceRequestsCallable(const DescribeSpotInstanceRequestsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSpotInstanceRequests( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSpotInstanceRequests( request ); } );
 }
 
 void EC2Client::DescribeSpotInstanceRequestsAsync(const DescribeSpotInstanceRequestsRequest& request, const DescribeSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3951,6 +5161,16 @@ void EC2Client::DescribeSpotInstanceRequestsAsync(const DescribeSpotInstanceRequ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSpotInstanceRequestsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSpotInstanceRequestsOutcomeCallable EC2Client::DescribeSpotInstanceRequestsCallable(DescribeSpotInstanceRequestsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeSpotInstanceRequests, this, std::move(request)));
+}
+
+void EC2Client::DescribeSpotInstanceRequestsAsync(DescribeSpotInstanceRequestsRequest&& request, const DescribeSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeSpotInstanceRequestsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeSpotInstanceRequestsAsyncHelper(const DescribeSpotInstanceRequestsRequest& request, const DescribeSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSpotInstanceRequests(request), context);
@@ -3973,7 +5193,7 @@ DescribeSpotPriceHistoryOutcome EC2Client::DescribeSpotPriceHistory(const Descri
 
 DescribeSpotPriceHistoryOutcomeCallable EC2Client::DescribeSpotPriceHistoryCallable(const DescribeSpotPriceHistoryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSpotPriceHistory( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSpotPriceHistory( request ); } );
 }
 
 void EC2Client::DescribeSpotPriceHistoryAsync(const DescribeSpotPriceHistoryRequest& request, const DescribeSpotPriceHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3981,6 +5201,16 @@ void EC2Client::DescribeSpotPriceHistoryAsync(const DescribeSpotPriceHistoryRequ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSpotPriceHistoryAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSpotPriceHistoryOutcomeCallable EC2Client::DescribeSpotPriceHistoryCallable(DescribeSpotPriceHistoryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeSpotPriceHistory, this, std::move(request)));
+}
+
+void EC2Client::DescribeSpotPriceHistoryAsync(DescribeSpotPriceHistoryRequest&& request, const DescribeSpotPriceHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeSpotPriceHistoryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeSpotPriceHistoryAsyncHelper(const DescribeSpotPriceHistoryRequest& request, const DescribeSpotPriceHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSpotPriceHistory(request), context);
@@ -4003,7 +5233,7 @@ DescribeStaleSecurityGroupsOutcome EC2Client::DescribeStaleSecurityGroups(const
 
 DescribeStaleSecurityGroupsOutcomeCallable EC2Client::DescribeStaleSecurityGroupsCallable(const DescribeStaleSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeStaleSecurityGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeStaleSecurityGroups( request ); } );
 }
 
 void EC2Client::DescribeStaleSecurityGroupsAsync(const DescribeStaleSecurityGroupsRequest& request, const DescribeStaleSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4011,6 +5241,16 @@ void EC2Client::DescribeStaleSecurityGroupsAsync(const DescribeStaleSecurityGrou
   m_executor->Submit( [this, request, handler, context](){ this->DescribeStaleSecurityGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeStaleSecurityGroupsOutcomeCallable EC2Client::DescribeStaleSecurityGroupsCallable(DescribeStaleSecurityGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeStaleSecurityGroups, this, std::move(request)));
+}
+
+void EC2Client::DescribeStaleSecurityGroupsAsync(DescribeStaleSecurityGroupsRequest&& request, const DescribeStaleSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeStaleSecurityGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeStaleSecurityGroupsAsyncHelper(const DescribeStaleSecurityGroupsRequest& request, const DescribeStaleSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeStaleSecurityGroups(request), context);
@@ -4033,7 +5273,7 @@ DescribeSubnetsOutcome EC2Client::DescribeSubnets(const DescribeSubnetsRequest&
 
 DescribeSubnetsOutcomeCallable EC2Client::DescribeSubnetsCallable(const DescribeSubnetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSubnets( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSubnets( request ); } );
 }
 
 void EC2Client::DescribeSubnetsAsync(const DescribeSubnetsRequest& request, const DescribeSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4041,6 +5281,16 @@ void EC2Client::DescribeSubnetsAsync(const DescribeSubnetsRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSubnetsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSubnetsOutcomeCallable EC2Client::DescribeSubnetsCallable(DescribeSubnetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeSubnets, this, std::move(request)));
+}
+
+void EC2Client::DescribeSubnetsAsync(DescribeSubnetsRequest&& request, const DescribeSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeSubnetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeSubnetsAsyncHelper(const DescribeSubnetsRequest& request, const DescribeSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSubnets(request), context);
@@ -4063,7 +5313,7 @@ DescribeTagsOutcome EC2Client::DescribeTags(const DescribeTagsRequest& request)
 
 DescribeTagsOutcomeCallable EC2Client::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTags( request ); } );
 }
 
 void EC2Client::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4071,6 +5321,16 @@ void EC2Client::DescribeTagsAsync(const DescribeTagsRequest& request, const Desc
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTagsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTagsOutcomeCallable EC2Client::DescribeTagsCallable(DescribeTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeTags, this, std::move(request)));
+}
+
+void EC2Client::DescribeTagsAsync(DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTags(request), context);
@@ -4093,7 +5353,7 @@ DescribeVolumeAttributeOutcome EC2Client::DescribeVolumeAttribute(const Describe
 
 DescribeVolumeAttributeOutcomeCallable EC2Client::DescribeVolumeAttributeCallable(const DescribeVolumeAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVolumeAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVolumeAttribute( request ); } );
 }
 
 void EC2Client::DescribeVolumeAttributeAsync(const DescribeVolumeAttributeRequest& request, const DescribeVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4101,14 +5361,24 @@ void EC2Client::DescribeVolumeAttributeAsync(const DescribeVolumeAttributeReques
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVolumeAttributeAsyncHelper( request, handler, context ); } );
 }
 
-void EC2Client::DescribeVolumeAttributeAsyncHelper(const DescribeVolumeAttributeRequest& request, const DescribeVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+DescribeVolumeAttributeOutcomeCallable EC2Client::DescribeVolumeAttributeCallable(DescribeVolumeAttributeRequest&& request) const
 {
-  handler(this, request, DescribeVolumeAttribute(request), context);
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeVolumeAttribute, this, std::move(request)));
 }
 
-DescribeVolumeStatusOutcome EC2Client::DescribeVolumeStatus(const DescribeVolumeStatusRequest& request) const
+void EC2Client::DescribeVolumeAttributeAsync(DescribeVolumeAttributeRequest&& request, const DescribeVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  Aws::StringStream ss;
+  m_executor->Submit(&EC2Client::DescribeVolumeAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
+void EC2Client::DescribeVolumeAttributeAsyncHelper(const DescribeVolumeAttributeRequest& request, const DescribeVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  handler(this, request, DescribeVolumeAttribute(request), context);
+}
+
+DescribeVolumeStatusOutcome EC2Client::DescribeVolumeStatus(const DescribeVolumeStatusRequest& request) const
+{
+  Aws::StringStream ss;
   ss << m_uri << "/";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
@@ -4123,7 +5393,7 @@ DescribeVolumeStatusOutcome EC2Client::DescribeVolumeStatus(const DescribeVolume
 
 DescribeVolumeStatusOutcomeCallable EC2Client::DescribeVolumeStatusCallable(const DescribeVolumeStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVolumeStatus( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVolumeStatus( request ); } );
 }
 
 void EC2Client::DescribeVolumeStatusAsync(const DescribeVolumeStatusRequest& request, const DescribeVolumeStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4131,6 +5401,16 @@ void EC2Client::DescribeVolumeStatusAsync(const DescribeVolumeStatusRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVolumeStatusAsyncHelper( request, handler, context ); } );
 }
 
+DescribeVolumeStatusOutcomeCallable EC2Client::DescribeVolumeStatusCallable(DescribeVolumeStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeVolumeStatus, this, std::move(request)));
+}
+
+void EC2Client::DescribeVolumeStatusAsync(DescribeVolumeStatusRequest&& request, const DescribeVolumeStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeVolumeStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeVolumeStatusAsyncHelper(const DescribeVolumeStatusRequest& request, const DescribeVolumeStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeVolumeStatus(request), context);
@@ -4153,7 +5433,7 @@ DescribeVolumesOutcome EC2Client::DescribeVolumes(const DescribeVolumesRequest&
 
 DescribeVolumesOutcomeCallable EC2Client::DescribeVolumesCallable(const DescribeVolumesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVolumes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVolumes( request ); } );
 }
 
 void EC2Client::DescribeVolumesAsync(const DescribeVolumesRequest& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4161,6 +5441,16 @@ void EC2Client::DescribeVolumesAsync(const DescribeVolumesRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVolumesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeVolumesOutcomeCallable EC2Client::DescribeVolumesCallable(DescribeVolumesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeVolumes, this, std::move(request)));
+}
+
+void EC2Client::DescribeVolumesAsync(DescribeVolumesRequest&& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeVolumesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeVolumesAsyncHelper(const DescribeVolumesRequest& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeVolumes(request), context);
@@ -4183,7 +5473,7 @@ DescribeVpcAttributeOutcome EC2Client::DescribeVpcAttribute(const DescribeVpcAtt
 
 DescribeVpcAttributeOutcomeCallable EC2Client::DescribeVpcAttributeCallable(const DescribeVpcAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVpcAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVpcAttribute( request ); } );
 }
 
 void EC2Client::DescribeVpcAttributeAsync(const DescribeVpcAttributeRequest& request, const DescribeVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4191,6 +5481,16 @@ void EC2Client::DescribeVpcAttributeAsync(const DescribeVpcAttributeRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVpcAttributeAsyncHelper( request, handler, context ); } );
 }
 
+DescribeVpcAttributeOutcomeCallable EC2Client::DescribeVpcAttributeCallable(DescribeVpcAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeVpcAttribute, this, std::move(request)));
+}
+
+void EC2Client::DescribeVpcAttributeAsync(DescribeVpcAttributeRequest&& request, const DescribeVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeVpcAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeVpcAttributeAsyncHelper(const DescribeVpcAttributeRequest& request, const DescribeVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeVpcAttribute(request), context);
@@ -4213,7 +5513,7 @@ DescribeVpcClassicLinkOutcome EC2Client::DescribeVpcClassicLink(const DescribeVp
 
 DescribeVpcClassicLinkOutcomeCallable EC2Client::DescribeVpcClassicLinkCallable(const DescribeVpcClassicLinkRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVpcClassicLink( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVpcClassicLink( request ); } );
 }
 
 void EC2Client::DescribeVpcClassicLinkAsync(const DescribeVpcClassicLinkRequest& request, const DescribeVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4221,6 +5521,16 @@ void EC2Client::DescribeVpcClassicLinkAsync(const DescribeVpcClassicLinkRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVpcClassicLinkAsyncHelper( request, handler, context ); } );
 }
 
+DescribeVpcClassicLinkOutcomeCallable EC2Client::DescribeVpcClassicLinkCallable(DescribeVpcClassicLinkRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeVpcClassicLink, this, std::move(request)));
+}
+
+void EC2Client::DescribeVpcClassicLinkAsync(DescribeVpcClassicLinkRequest&& request, const DescribeVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeVpcClassicLinkAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeVpcClassicLinkAsyncHelper(const DescribeVpcClassicLinkRequest& request, const DescribeVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeVpcClassicLink(request), context);
@@ -4243,7 +5553,7 @@ DescribeVpcClassicLinkDnsSupportOutcome EC2Client::DescribeVpcClassicLinkDnsSupp
 
 DescribeVpcClassicLinkDnsSupportOutcomeCallable EC2Client::DescribeVpcClassicLinkDnsSupportCallable(const DescribeVpcClassicLinkDnsSupportRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVpcClassicLinkDnsSupport( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVpcClassicLinkDnsSupport( request ); } );
 }
 
 void EC2Client::DescribeVpcClassicLinkDnsSupportAsync(const DescribeVpcClassicLinkDnsSupportRequest& request, const DescribeVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4251,6 +5561,16 @@ void EC2Client::DescribeVpcClassicLinkDnsSupportAsync(const DescribeVpcClassicLi
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVpcClassicLinkDnsSupportAsyncHelper( request, handler, context ); } );
 }
 
+DescribeVpcClassicLinkDnsSupportOutcomeCallable EC2Client::DescribeVpcClassicLinkDnsSupportCallable(DescribeVpcClassicLinkDnsSupportRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeVpcClassicLinkDnsSupport, this, std::move(request)));
+}
+
+void EC2Client::DescribeVpcClassicLinkDnsSupportAsync(DescribeVpcClassicLinkDnsSupportRequest&& request, const DescribeVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeVpcClassicLinkDnsSupportAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeVpcClassicLinkDnsSupportAsyncHelper(const DescribeVpcClassicLinkDnsSupportRequest& request, const DescribeVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeVpcClassicLinkDnsSupport(request), context);
@@ -4273,7 +5593,7 @@ DescribeVpcEndpointServicesOutcome EC2Client::DescribeVpcEndpointServices(const
 
 DescribeVpcEndpointServicesOutcomeCallable EC2Client::DescribeVpcEndpointServicesCallable(const DescribeVpcEndpointServicesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVpcEndpointServices( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVpcEndpointServices( request ); } );
 }
 
 void EC2Client::DescribeVpcEndpointServicesAsync(const DescribeVpcEndpointServicesRequest& request, const DescribeVpcEndpointServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4281,6 +5601,16 @@ void EC2Client::DescribeVpcEndpointServicesAsync(const DescribeVpcEndpointServic
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVpcEndpointServicesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeVpcEndpointServicesOutcomeCallable EC2Client::DescribeVpcEndpointServicesCallable(DescribeVpcEndpointServicesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeVpcEndpointServices, this, std::move(request)));
+}
+
+void EC2Client::DescribeVpcEndpointServicesAsync(DescribeVpcEndpointServicesRequest&& request, const DescribeVpcEndpointServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeVpcEndpointServicesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeVpcEndpointServicesAsyncHelper(const DescribeVpcEndpointServicesRequest& request, const DescribeVpcEndpointServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeVpcEndpointServices(request), context);
@@ -4303,7 +5633,7 @@ DescribeVpcEndpointsOutcome EC2Client::DescribeVpcEndpoints(const DescribeVpcEnd
 
 DescribeVpcEndpointsOutcomeCallable EC2Client::DescribeVpcEndpointsCallable(const DescribeVpcEndpointsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVpcEndpoints( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVpcEndpoints( request ); } );
 }
 
 void EC2Client::DescribeVpcEndpointsAsync(const DescribeVpcEndpointsRequest& request, const DescribeVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4311,6 +5641,16 @@ void EC2Client::DescribeVpcEndpointsAsync(const DescribeVpcEndpointsRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVpcEndpointsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeVpcEndpointsOutcomeCallable EC2Client::DescribeVpcEndpointsCallable(DescribeVpcEndpointsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeVpcEndpoints, this, std::move(request)));
+}
+
+void EC2Client::DescribeVpcEndpointsAsync(DescribeVpcEndpointsRequest&& request, const DescribeVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeVpcEndpointsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeVpcEndpointsAsyncHelper(const DescribeVpcEndpointsRequest& request, const DescribeVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeVpcEndpoints(request), context);
@@ -4333,7 +5673,7 @@ DescribeVpcPeeringConnectionsOutcome EC2Client::DescribeVpcPeeringConnections(co
 
 DescribeVpcPeeringConnectionsOutcomeCallable EC2Client::DescribeVpcPeeringConnectionsCallable(const DescribeVpcPeeringConnectionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVpcPeeringConnections( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVpcPeeringConnections( request ); } );
 }
 
 void EC2Client::DescribeVpcPeeringConnectionsAsync(const DescribeVpcPeeringConnectionsRequest& request, const DescribeVpcPeeringConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4341,6 +5681,16 @@ void EC2Client::DescribeVpcPeeringConnectionsAsync(const DescribeVpcPeeringConne
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVpcPeeringConnectionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeVpcPeeringConnectionsOutcomeCallable EC2Client::DescribeVpcPeeringConnectionsCallable(DescribeVpcPeeringConnectionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeVpcPeeringConnections, this, std::move(request)));
+}
+
+void EC2Client::DescribeVpcPeeringConnectionsAsync(DescribeVpcPeeringConnectionsRequest&& request, const DescribeVpcPeeringConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeVpcPeeringConnectionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeVpcPeeringConnectionsAsyncHelper(const DescribeVpcPeeringConnectionsRequest& request, const DescribeVpcPeeringConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeVpcPeeringConnections(request), context);
@@ -4363,7 +5713,7 @@ DescribeVpcsOutcome EC2Client::DescribeVpcs(const DescribeVpcsRequest& request)
 
 DescribeVpcsOutcomeCallable EC2Client::DescribeVpcsCallable(const DescribeVpcsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVpcs( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVpcs( request ); } );
 }
 
 void EC2Client::DescribeVpcsAsync(const DescribeVpcsRequest& request, const DescribeVpcsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4371,6 +5721,16 @@ void EC2Client::DescribeVpcsAsync(const DescribeVpcsRequest& request, const Desc
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVpcsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeVpcsOutcomeCallable EC2Client::DescribeVpcsCallable(DescribeVpcsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeVpcs, this, std::move(request)));
+}
+
+void EC2Client::DescribeVpcsAsync(DescribeVpcsRequest&& request, const DescribeVpcsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeVpcsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeVpcsAsyncHelper(const DescribeVpcsRequest& request, const DescribeVpcsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeVpcs(request), context);
@@ -4393,7 +5753,7 @@ DescribeVpnConnectionsOutcome EC2Client::DescribeVpnConnections(const DescribeVp
 
 DescribeVpnConnectionsOutcomeCallable EC2Client::DescribeVpnConnectionsCallable(const DescribeVpnConnectionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVpnConnections( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVpnConnections( request ); } );
 }
 
 void EC2Client::DescribeVpnConnectionsAsync(const DescribeVpnConnectionsRequest& request, const DescribeVpnConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4401,6 +5761,16 @@ void EC2Client::DescribeVpnConnectionsAsync(const DescribeVpnConnectionsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVpnConnectionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeVpnConnectionsOutcomeCallable EC2Client::DescribeVpnConnectionsCallable(DescribeVpnConnectionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeVpnConnections, this, std::move(request)));
+}
+
+void EC2Client::DescribeVpnConnectionsAsync(DescribeVpnConnectionsRequest&& request, const DescribeVpnConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeVpnConnectionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeVpnConnectionsAsyncHelper(const DescribeVpnConnectionsRequest& request, const DescribeVpnConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeVpnConnections(request), context);
@@ -4423,7 +5793,7 @@ DescribeVpnGatewaysOutcome EC2Client::DescribeVpnGateways(const DescribeVpnGatew
 
 DescribeVpnGatewaysOutcomeCallable EC2Client::DescribeVpnGatewaysCallable(const DescribeVpnGatewaysRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVpnGateways( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVpnGateways( request ); } );
 }
 
 void EC2Client::DescribeVpnGatewaysAsync(const DescribeVpnGatewaysRequest& request, const DescribeVpnGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4431,6 +5801,16 @@ void EC2Client::DescribeVpnGatewaysAsync(const DescribeVpnGatewaysRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVpnGatewaysAsyncHelper( request, handler, context ); } );
 }
 
+DescribeVpnGatewaysOutcomeCallable EC2Client::DescribeVpnGatewaysCallable(DescribeVpnGatewaysRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DescribeVpnGateways, this, std::move(request)));
+}
+
+void EC2Client::DescribeVpnGatewaysAsync(DescribeVpnGatewaysRequest&& request, const DescribeVpnGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DescribeVpnGatewaysAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DescribeVpnGatewaysAsyncHelper(const DescribeVpnGatewaysRequest& request, const DescribeVpnGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeVpnGateways(request), context);
@@ -4453,7 +5833,7 @@ DetachClassicLinkVpcOutcome EC2Client::DetachClassicLinkVpc(const DetachClassicL
 
 DetachClassicLinkVpcOutcomeCallable EC2Client::DetachClassicLinkVpcCallable(const DetachClassicLinkVpcRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachClassicLinkVpc( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachClassicLinkVpc( request ); } );
 }
 
 void EC2Client::DetachClassicLinkVpcAsync(const DetachClassicLinkVpcRequest& request, const DetachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4461,6 +5841,16 @@ void EC2Client::DetachClassicLinkVpcAsync(const DetachClassicLinkVpcRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DetachClassicLinkVpcAsyncHelper( request, handler, context ); } );
 }
 
+DetachClassicLinkVpcOutcomeCallable EC2Client::DetachClassicLinkVpcCallable(DetachClassicLinkVpcRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DetachClassicLinkVpc, this, std::move(request)));
+}
+
+void EC2Client::DetachClassicLinkVpcAsync(DetachClassicLinkVpcRequest&& request, const DetachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DetachClassicLinkVpcAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DetachClassicLinkVpcAsyncHelper(const DetachClassicLinkVpcRequest& request, const DetachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachClassicLinkVpc(request), context);
@@ -4483,7 +5873,7 @@ DetachInternetGatewayOutcome EC2Client::DetachInternetGateway(const DetachIntern
 
 DetachInternetGatewayOutcomeCallable EC2Client::DetachInternetGatewayCallable(const DetachInternetGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachInternetGateway( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachInternetGateway( request ); } );
 }
 
 void EC2Client::DetachInternetGatewayAsync(const DetachInternetGatewayRequest& request, const DetachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4491,6 +5881,16 @@ void EC2Client::DetachInternetGatewayAsync(const DetachInternetGatewayRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DetachInternetGatewayAsyncHelper( request, handler, context ); } );
 }
 
+DetachInternetGatewayOutcomeCallable EC2Client::DetachInternetGatewayCallable(DetachInternetGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DetachInternetGateway, this, std::move(request)));
+}
+
+void EC2Client::DetachInternetGatewayAsync(DetachInternetGatewayRequest&& request, const DetachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DetachInternetGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DetachInternetGatewayAsyncHelper(const DetachInternetGatewayRequest& request, const DetachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachInternetGateway(request), context);
@@ -4513,7 +5913,7 @@ DetachNetworkInterfaceOutcome EC2Client::DetachNetworkInterface(const DetachNetw
 
 DetachNetworkInterfaceOutcomeCallable EC2Client::DetachNetworkInterfaceCallable(const DetachNetworkInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachNetworkInterface( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachNetworkInterface( request ); } );
 }
 
 void EC2Client::DetachNetworkInterfaceAsync(const DetachNetworkInterfaceRequest& request, const DetachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4521,6 +5921,16 @@ void EC2Client::DetachNetworkInterfaceAsync(const DetachNetworkInterfaceRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DetachNetworkInterfaceAsyncHelper( request, handler, context ); } );
 }
 
+DetachNetworkInterfaceOutcomeCallable EC2Client::DetachNetworkInterfaceCallable(DetachNetworkInterfaceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DetachNetworkInterface, this, std::move(request)));
+}
+
+void EC2Client::DetachNetworkInterfaceAsync(DetachNetworkInterfaceRequest&& request, const DetachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DetachNetworkInterfaceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DetachNetworkInterfaceAsyncHelper(const DetachNetworkInterfaceRequest& request, const DetachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachNetworkInterface(request), context);
@@ -4543,7 +5953,7 @@ DetachVolumeOutcome EC2Client::DetachVolume(const DetachVolumeRequest& request)
 
 DetachVolumeOutcomeCallable EC2Client::DetachVolumeCallable(const DetachVolumeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachVolume( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachVolume( request ); } );
 }
 
 void EC2Client::DetachVolumeAsync(const DetachVolumeRequest& request, const DetachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4551,6 +5961,16 @@ void EC2Client::DetachVolumeAsync(const DetachVolumeRequest& request, const Deta
   m_executor->Submit( [this, request, handler, context](){ this->DetachVolumeAsyncHelper( request, handler, context ); } );
 }
 
+DetachVolumeOutcomeCallable EC2Client::DetachVolumeCallable(DetachVolumeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DetachVolume, this, std::move(request)));
+}
+
+void EC2Client::DetachVolumeAsync(DetachVolumeRequest&& request, const DetachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DetachVolumeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DetachVolumeAsyncHelper(const DetachVolumeRequest& request, const DetachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachVolume(request), context);
@@ -4573,7 +5993,7 @@ DetachVpnGatewayOutcome EC2Client::DetachVpnGateway(const DetachVpnGatewayReques
 
 DetachVpnGatewayOutcomeCallable EC2Client::DetachVpnGatewayCallable(const DetachVpnGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachVpnGateway( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachVpnGateway( request ); } );
 }
 
 void EC2Client::DetachVpnGatewayAsync(const DetachVpnGatewayRequest& request, const DetachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4581,6 +6001,16 @@ void EC2Client::DetachVpnGatewayAsync(const DetachVpnGatewayRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DetachVpnGatewayAsyncHelper( request, handler, context ); } );
 }
 
+DetachVpnGatewayOutcomeCallable EC2Client::DetachVpnGatewayCallable(DetachVpnGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DetachVpnGateway, this, std::move(request)));
+}
+
+void EC2Client::DetachVpnGatewayAsync(DetachVpnGatewayRequest&& request, const DetachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DetachVpnGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DetachVpnGatewayAsyncHelper(const DetachVpnGatewayRequest& request, const DetachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachVpnGateway(request), context);
@@ -4603,7 +6033,7 @@ DisableVgwRoutePropagationOutcome EC2Client::DisableVgwRoutePropagation(const Di
 
 DisableVgwRoutePropagationOutcomeCallable EC2Client::DisableVgwRoutePropagationCallable(const DisableVgwRoutePropagationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableVgwRoutePropagation( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableVgwRoutePropagation( request ); } );
 }
 
 void EC2Client::DisableVgwRoutePropagationAsync(const DisableVgwRoutePropagationRequest& request, const DisableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4611,6 +6041,16 @@ void EC2Client::DisableVgwRoutePropagationAsync(const DisableVgwRoutePropagation
   m_executor->Submit( [this, request, handler, context](){ this->DisableVgwRoutePropagationAsyncHelper( request, handler, context ); } );
 }
 
+DisableVgwRoutePropagationOutcomeCallable EC2Client::DisableVgwRoutePropagationCallable(DisableVgwRoutePropagationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DisableVgwRoutePropagation, this, std::move(request)));
+}
+
+void EC2Client::DisableVgwRoutePropagationAsync(DisableVgwRoutePropagationRequest&& request, const DisableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DisableVgwRoutePropagationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DisableVgwRoutePropagationAsyncHelper(const DisableVgwRoutePropagationRequest& request, const DisableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableVgwRoutePropagation(request), context);
@@ -4633,7 +6073,7 @@ DisableVpcClassicLinkOutcome EC2Client::DisableVpcClassicLink(const DisableVpcCl
 
 DisableVpcClassicLinkOutcomeCallable EC2Client::DisableVpcClassicLinkCallable(const DisableVpcClassicLinkRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableVpcClassicLink( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableVpcClassicLink( request ); } );
 }
 
 void EC2Client::DisableVpcClassicLinkAsync(const DisableVpcClassicLinkRequest& request, const DisableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4641,6 +6081,16 @@ void EC2Client::DisableVpcClassicLinkAsync(const DisableVpcClassicLinkRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DisableVpcClassicLinkAsyncHelper( request, handler, context ); } );
 }
 
+DisableVpcClassicLinkOutcomeCallable EC2Client::DisableVpcClassicLinkCallable(DisableVpcClassicLinkRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DisableVpcClassicLink, this, std::move(request)));
+}
+
+void EC2Client::DisableVpcClassicLinkAsync(DisableVpcClassicLinkRequest&& request, const DisableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DisableVpcClassicLinkAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DisableVpcClassicLinkAsyncHelper(const DisableVpcClassicLinkRequest& request, const DisableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableVpcClassicLink(request), context);
@@ -4663,7 +6113,7 @@ DisableVpcClassicLinkDnsSupportOutcome EC2Client::DisableVpcClassicLinkDnsSuppor
 
 DisableVpcClassicLinkDnsSupportOutcomeCallable EC2Client::DisableVpcClassicLinkDnsSupportCallable(const DisableVpcClassicLinkDnsSupportRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableVpcClassicLinkDnsSupport( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableVpcClassicLinkDnsSupport( request ); } );
 }
 
 void EC2Client::DisableVpcClassicLinkDnsSupportAsync(const DisableVpcClassicLinkDnsSupportRequest& request, const DisableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4671,6 +6121,16 @@ void EC2Client::DisableVpcClassicLinkDnsSupportAsync(const DisableVpcClassicLink
   m_executor->Submit( [this, request, handler, context](){ this->DisableVpcClassicLinkDnsSupportAsyncHelper( request, handler, context ); } );
 }
 
+DisableVpcClassicLinkDnsSupportOutcomeCallable EC2Client::DisableVpcClassicLinkDnsSupportCallable(DisableVpcClassicLinkDnsSupportRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DisableVpcClassicLinkDnsSupport, this, std::move(request)));
+}
+
+void EC2Client::DisableVpcClassicLinkDnsSupportAsync(DisableVpcClassicLinkDnsSupportRequest&& request, const DisableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DisableVpcClassicLinkDnsSupportAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DisableVpcClassicLinkDnsSupportAsyncHelper(const DisableVpcClassicLinkDnsSupportRequest& request, const DisableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableVpcClassicLinkDnsSupport(request), context);
@@ -4693,7 +6153,7 @@ DisassociateAddressOutcome EC2Client::DisassociateAddress(const DisassociateAddr
 
 DisassociateAddressOutcomeCallable EC2Client::DisassociateAddressCallable(const DisassociateAddressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisassociateAddress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisassociateAddress( request ); } );
 }
 
 void EC2Client::DisassociateAddressAsync(const DisassociateAddressRequest& request, const DisassociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4701,6 +6161,16 @@ void EC2Client::DisassociateAddressAsync(const DisassociateAddressRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DisassociateAddressAsyncHelper( request, handler, context ); } );
 }
 
+DisassociateAddressOutcomeCallable EC2Client::DisassociateAddressCallable(DisassociateAddressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DisassociateAddress, this, std::move(request)));
+}
+
+void EC2Client::DisassociateAddressAsync(DisassociateAddressRequest&& request, const DisassociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DisassociateAddressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DisassociateAddressAsyncHelper(const DisassociateAddressRequest& request, const DisassociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisassociateAddress(request), context);
@@ -4723,7 +6193,7 @@ DisassociateRouteTableOutcome EC2Client::DisassociateRouteTable(const Disassocia
 
 DisassociateRouteTableOutcomeCallable EC2Client::DisassociateRouteTableCallable(const DisassociateRouteTableRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisassociateRouteTable( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisassociateRouteTable( request ); } );
 }
 
 void EC2Client::DisassociateRouteTableAsync(const DisassociateRouteTableRequest& request, const DisassociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4731,6 +6201,16 @@ void EC2Client::DisassociateRouteTableAsync(const DisassociateRouteTableRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DisassociateRouteTableAsyncHelper( request, handler, context ); } );
 }
 
+DisassociateRouteTableOutcomeCallable EC2Client::DisassociateRouteTableCallable(DisassociateRouteTableRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::DisassociateRouteTable, this, std::move(request)));
+}
+
+void EC2Client::DisassociateRouteTableAsync(DisassociateRouteTableRequest&& request, const DisassociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::DisassociateRouteTableAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::DisassociateRouteTableAsyncHelper(const DisassociateRouteTableRequest& request, const DisassociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisassociateRouteTable(request), context);
@@ -4753,7 +6233,7 @@ EnableVgwRoutePropagationOutcome EC2Client::EnableVgwRoutePropagation(const Enab
 
 EnableVgwRoutePropagationOutcomeCallable EC2Client::EnableVgwRoutePropagationCallable(const EnableVgwRoutePropagationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableVgwRoutePropagation( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableVgwRoutePropagation( request ); } );
 }
 
 void EC2Client::EnableVgwRoutePropagationAsync(const EnableVgwRoutePropagationRequest& request, const EnableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4761,6 +6241,16 @@ void EC2Client::EnableVgwRoutePropagationAsync(const EnableVgwRoutePropagationRe
   m_executor->Submit( [this, request, handler, context](){ this->EnableVgwRoutePropagationAsyncHelper( request, handler, context ); } );
 }
 
+EnableVgwRoutePropagationOutcomeCallable EC2Client::EnableVgwRoutePropagationCallable(EnableVgwRoutePropagationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::EnableVgwRoutePropagation, this, std::move(request)));
+}
+
+void EC2Client::EnableVgwRoutePropagationAsync(EnableVgwRoutePropagationRequest&& request, const EnableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::EnableVgwRoutePropagationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::EnableVgwRoutePropagationAsyncHelper(const EnableVgwRoutePropagationRequest& request, const EnableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableVgwRoutePropagation(request), context);
@@ -4783,7 +6273,7 @@ EnableVolumeIOOutcome EC2Client::EnableVolumeIO(const EnableVolumeIORequest& req
 
 EnableVolumeIOOutcomeCallable EC2Client::EnableVolumeIOCallable(const EnableVolumeIORequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableVolumeIO( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableVolumeIO( request ); } );
 }
 
 void EC2Client::EnableVolumeIOAsync(const EnableVolumeIORequest& request, const EnableVolumeIOResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4791,6 +6281,16 @@ void EC2Client::EnableVolumeIOAsync(const EnableVolumeIORequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->EnableVolumeIOAsyncHelper( request, handler, context ); } );
 }
 
+EnableVolumeIOOutcomeCallable EC2Client::EnableVolumeIOCallable(EnableVolumeIORequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::EnableVolumeIO, this, std::move(request)));
+}
+
+void EC2Client::EnableVolumeIOAsync(EnableVolumeIORequest&& request, const EnableVolumeIOResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::EnableVolumeIOAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::EnableVolumeIOAsyncHelper(const EnableVolumeIORequest& request, const EnableVolumeIOResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableVolumeIO(request), context);
@@ -4813,7 +6313,7 @@ EnableVpcClassicLinkOutcome EC2Client::EnableVpcClassicLink(const EnableVpcClass
 
 EnableVpcClassicLinkOutcomeCallable EC2Client::EnableVpcClassicLinkCallable(const EnableVpcClassicLinkRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableVpcClassicLink( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableVpcClassicLink( request ); } );
 }
 
 void EC2Client::EnableVpcClassicLinkAsync(const EnableVpcClassicLinkRequest& request, const EnableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4821,6 +6321,16 @@ void EC2Client::EnableVpcClassicLinkAsync(const EnableVpcClassicLinkRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->EnableVpcClassicLinkAsyncHelper( request, handler, context ); } );
 }
 
+EnableVpcClassicLinkOutcomeCallable EC2Client::EnableVpcClassicLinkCallable(EnableVpcClassicLinkRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::EnableVpcClassicLink, this, std::move(request)));
+}
+
+void EC2Client::EnableVpcClassicLinkAsync(EnableVpcClassicLinkRequest&& request, const EnableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::EnableVpcClassicLinkAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::EnableVpcClassicLinkAsyncHelper(const EnableVpcClassicLinkRequest& request, const EnableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableVpcClassicLink(request), context);
@@ -4843,7 +6353,7 @@ EnableVpcClassicLinkDnsSupportOutcome EC2Client::EnableVpcClassicLinkDnsSupport(
 
 EnableVpcClassicLinkDnsSupportOutcomeCallable EC2Client::EnableVpcClassicLinkDnsSupportCallable(const EnableVpcClassicLinkDnsSupportRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableVpcClassicLinkDnsSupport( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableVpcClassicLinkDnsSupport( request ); } );
 }
 
 void EC2Client::EnableVpcClassicLinkDnsSupportAsync(const EnableVpcClassicLinkDnsSupportRequest& request, const EnableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4851,6 +6361,16 @@ void EC2Client::EnableVpcClassicLinkDnsSupportAsync(const EnableVpcClassicLinkDn
   m_executor->Submit( [this, request, handler, context](){ this->EnableVpcClassicLinkDnsSupportAsyncHelper( request, handler, context ); } );
 }
 
+EnableVpcClassicLinkDnsSupportOutcomeCallable EC2Client::EnableVpcClassicLinkDnsSupportCallable(EnableVpcClassicLinkDnsSupportRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::EnableVpcClassicLinkDnsSupport, this, std::move(request)));
+}
+
+void EC2Client::EnableVpcClassicLinkDnsSupportAsync(EnableVpcClassicLinkDnsSupportRequest&& request, const EnableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::EnableVpcClassicLinkDnsSupportAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::EnableVpcClassicLinkDnsSupportAsyncHelper(const EnableVpcClassicLinkDnsSupportRequest& request, const EnableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableVpcClassicLinkDnsSupport(request), context);
@@ -4873,7 +6393,7 @@ GetConsoleOutputOutcome EC2Client::GetConsoleOutput(const GetConsoleOutputReques
 
 GetConsoleOutputOutcomeCallable EC2Client::GetConsoleOutputCallable(const GetConsoleOutputRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetConsoleOutput( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetConsoleOutput( request ); } );
 }
 
 void EC2Client::GetConsoleOutputAsync(const GetConsoleOutputRequest& request, const GetConsoleOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4881,6 +6401,16 @@ void EC2Client::GetConsoleOutputAsync(const GetConsoleOutputRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->GetConsoleOutputAsyncHelper( request, handler, context ); } );
 }
 
+GetConsoleOutputOutcomeCallable EC2Client::GetConsoleOutputCallable(GetConsoleOutputRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::GetConsoleOutput, this, std::move(request)));
+}
+
+void EC2Client::GetConsoleOutputAsync(GetConsoleOutputRequest&& request, const GetConsoleOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::GetConsoleOutputAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::GetConsoleOutputAsyncHelper(const GetConsoleOutputRequest& request, const GetConsoleOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetConsoleOutput(request), context);
@@ -4903,7 +6433,7 @@ GetConsoleScreenshotOutcome EC2Client::GetConsoleScreenshot(const GetConsoleScre
 
 GetConsoleScreenshotOutcomeCallable EC2Client::GetConsoleScreenshotCallable(const GetConsoleScreenshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetConsoleScreenshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetConsoleScreenshot( request ); } );
 }
 
 void EC2Client::GetConsoleScreenshotAsync(const GetConsoleScreenshotRequest& request, const GetConsoleScreenshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4911,6 +6441,16 @@ void EC2Client::GetConsoleScreenshotAsync(const GetConsoleScreenshotRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->GetConsoleScreenshotAsyncHelper( request, handler, context ); } );
 }
 
+GetConsoleScreenshotOutcomeCallable EC2Client::GetConsoleScreenshotCallable(GetConsoleScreenshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::GetConsoleScreenshot, this, std::move(request)));
+}
+
+void EC2Client::GetConsoleScreenshotAsync(GetConsoleScreenshotRequest&& request, const GetConsoleScreenshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::GetConsoleScreenshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::GetConsoleScreenshotAsyncHelper(const GetConsoleScreenshotRequest& request, const GetConsoleScreenshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetConsoleScreenshot(request), context);
@@ -4933,7 +6473,7 @@ GetPasswordDataOutcome EC2Client::GetPasswordData(const GetPasswordDataRequest&
 
 GetPasswordDataOutcomeCallable EC2Client::GetPasswordDataCallable(const GetPasswordDataRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetPasswordData( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetPasswordData( request ); } );
 }
 
 void EC2Client::GetPasswordDataAsync(const GetPasswordDataRequest& request, const GetPasswordDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4941,6 +6481,16 @@ void EC2Client::GetPasswordDataAsync(const GetPasswordDataRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->GetPasswordDataAsyncHelper( request, handler, context ); } );
 }
 
+GetPasswordDataOutcomeCallable EC2Client::GetPasswordDataCallable(GetPasswordDataRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::GetPasswordData, this, std::move(request)));
+}
+
+void EC2Client::GetPasswordDataAsync(GetPasswordDataRequest&& request, const GetPasswordDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::GetPasswordDataAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::GetPasswordDataAsyncHelper(const GetPasswordDataRequest& request, const GetPasswordDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetPasswordData(request), context);
@@ -4963,7 +6513,7 @@ ImportImageOutcome EC2Client::ImportImage(const ImportImageRequest& request) con
 
 ImportImageOutcomeCallable EC2Client::ImportImageCallable(const ImportImageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ImportImage( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ImportImage( request ); } );
 }
 
 void EC2Client::ImportImageAsync(const ImportImageRequest& request, const ImportImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4971,6 +6521,16 @@ void EC2Client::ImportImageAsync(const ImportImageRequest& request, const Import
   m_executor->Submit( [this, request, handler, context](){ this->ImportImageAsyncHelper( request, handler, context ); } );
 }
 
+ImportImageOutcomeCallable EC2Client::ImportImageCallable(ImportImageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ImportImage, this, std::move(request)));
+}
+
+void EC2Client::ImportImageAsync(ImportImageRequest&& request, const ImportImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ImportImageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ImportImageAsyncHelper(const ImportImageRequest& request, const ImportImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ImportImage(request), context);
@@ -4993,7 +6553,7 @@ ImportInstanceOutcome EC2Client::ImportInstance(const ImportInstanceRequest& req
 
 ImportInstanceOutcomeCallable EC2Client::ImportInstanceCallable(const ImportInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ImportInstance( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ImportInstance( request ); } );
 }
 
 void EC2Client::ImportInstanceAsync(const ImportInstanceRequest& request, const ImportInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5001,6 +6561,16 @@ void EC2Client::ImportInstanceAsync(const ImportInstanceRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ImportInstanceAsyncHelper( request, handler, context ); } );
 }
 
+ImportInstanceOutcomeCallable EC2Client::ImportInstanceCallable(ImportInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ImportInstance, this, std::move(request)));
+}
+
+void EC2Client::ImportInstanceAsync(ImportInstanceRequest&& request, const ImportInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ImportInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ImportInstanceAsyncHelper(const ImportInstanceRequest& request, const ImportInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ImportInstance(request), context);
@@ -5023,7 +6593,7 @@ ImportKeyPairOutcome EC2Client::ImportKeyPair(const ImportKeyPairRequest& reques
 
 ImportKeyPairOutcomeCallable EC2Client::ImportKeyPairCallable(const ImportKeyPairRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ImportKeyPair( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ImportKeyPair( request ); } );
 }
 
 void EC2Client::ImportKeyPairAsync(const ImportKeyPairRequest& request, const ImportKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5031,6 +6601,16 @@ void EC2Client::ImportKeyPairAsync(const ImportKeyPairRequest& request, const Im
   m_executor->Submit( [this, request, handler, context](){ this->ImportKeyPairAsyncHelper( request, handler, context ); } );
 }
 
+ImportKeyPairOutcomeCallable EC2Client::ImportKeyPairCallable(ImportKeyPairRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ImportKeyPair, this, std::move(request)));
+}
+
+void EC2Client::ImportKeyPairAsync(ImportKeyPairRequest&& request, const ImportKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ImportKeyPairAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ImportKeyPairAsyncHelper(const ImportKeyPairRequest& request, const ImportKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ImportKeyPair(request), context);
@@ -5053,7 +6633,7 @@ ImportSnapshotOutcome EC2Client::ImportSnapshot(const ImportSnapshotRequest& req
 
 ImportSnapshotOutcomeCallable EC2Client::ImportSnapshotCallable(const ImportSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ImportSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ImportSnapshot( request ); } );
 }
 
 void EC2Client::ImportSnapshotAsync(const ImportSnapshotRequest& request, const ImportSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5061,6 +6641,16 @@ void EC2Client::ImportSnapshotAsync(const ImportSnapshotRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ImportSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+ImportSnapshotOutcomeCallable EC2Client::ImportSnapshotCallable(ImportSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ImportSnapshot, this, std::move(request)));
+}
+
+void EC2Client::ImportSnapshotAsync(ImportSnapshotRequest&& request, const ImportSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ImportSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ImportSnapshotAsyncHelper(const ImportSnapshotRequest& request, const ImportSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ImportSnapshot(request), context);
@@ -5083,7 +6673,7 @@ ImportVolumeOutcome EC2Client::ImportVolume(const ImportVolumeRequest& request)
 
 ImportVolumeOutcomeCallable EC2Client::ImportVolumeCallable(const ImportVolumeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ImportVolume( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ImportVolume( request ); } );
 }
 
 void EC2Client::ImportVolumeAsync(const ImportVolumeRequest& request, const ImportVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5091,6 +6681,16 @@ void EC2Client::ImportVolumeAsync(const ImportVolumeRequest& request, const Impo
   m_executor->Submit( [this, request, handler, context](){ this->ImportVolumeAsyncHelper( request, handler, context ); } );
 }
 
+ImportVolumeOutcomeCallable EC2Client::ImportVolumeCallable(ImportVolumeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ImportVolume, this, std::move(request)));
+}
+
+void EC2Client::ImportVolumeAsync(ImportVolumeRequest&& request, const ImportVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ImportVolumeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ImportVolumeAsyncHelper(const ImportVolumeRequest& request, const ImportVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ImportVolume(request), context);
@@ -5113,7 +6713,7 @@ ModifyHostsOutcome EC2Client::ModifyHosts(const ModifyHostsRequest& request) con
 
 ModifyHostsOutcomeCallable EC2Client::ModifyHostsCallable(const ModifyHostsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyHosts( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyHosts( request ); } );
 }
 
 void EC2Client::ModifyHostsAsync(const ModifyHostsRequest& request, const ModifyHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5121,6 +6721,16 @@ void EC2Client::ModifyHostsAsync(const ModifyHostsRequest& request, const Modify
   m_executor->Submit( [this, request, handler, context](){ this->ModifyHostsAsyncHelper( request, handler, context ); } );
 }
 
+ModifyHostsOutcomeCallable EC2Client::ModifyHostsCallable(ModifyHostsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ModifyHosts, this, std::move(request)));
+}
+
+void EC2Client::ModifyHostsAsync(ModifyHostsRequest&& request, const ModifyHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ModifyHostsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ModifyHostsAsyncHelper(const ModifyHostsRequest& request, const ModifyHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyHosts(request), context);
@@ -5143,7 +6753,7 @@ ModifyIdFormatOutcome EC2Client::ModifyIdFormat(const ModifyIdFormatRequest& req
 
 ModifyIdFormatOutcomeCallable EC2Client::ModifyIdFormatCallable(const ModifyIdFormatRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyIdFormat( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyIdFormat( request ); } );
 }
 
 void EC2Client::ModifyIdFormatAsync(const ModifyIdFormatRequest& request, const ModifyIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5151,6 +6761,16 @@ void EC2Client::ModifyIdFormatAsync(const ModifyIdFormatRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ModifyIdFormatAsyncHelper( request, handler, context ); } );
 }
 
+ModifyIdFormatOutcomeCallable EC2Client::ModifyIdFormatCallable(ModifyIdFormatRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ModifyIdFormat, this, std::move(request)));
+}
+
+void EC2Client::ModifyIdFormatAsync(ModifyIdFormatRequest&& request, const ModifyIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ModifyIdFormatAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ModifyIdFormatAsyncHelper(const ModifyIdFormatRequest& request, const ModifyIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyIdFormat(request), context);
@@ -5173,7 +6793,7 @@ ModifyImageAttributeOutcome EC2Client::ModifyImageAttribute(const ModifyImageAtt
 
 ModifyImageAttributeOutcomeCallable EC2Client::ModifyImageAttributeCallable(const ModifyImageAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyImageAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyImageAttribute( request ); } );
 }
 
 void EC2Client::ModifyImageAttributeAsync(const ModifyImageAttributeRequest& request, const ModifyImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5181,6 +6801,16 @@ void EC2Client::ModifyImageAttributeAsync(const ModifyImageAttributeRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->ModifyImageAttributeAsyncHelper( request, handler, context ); } );
 }
 
+ModifyImageAttributeOutcomeCallable EC2Client::ModifyImageAttributeCallable(ModifyImageAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ModifyImageAttribute, this, std::move(request)));
+}
+
+void EC2Client::ModifyImageAttributeAsync(ModifyImageAttributeRequest&& request, const ModifyImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ModifyImageAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ModifyImageAttributeAsyncHelper(const ModifyImageAttributeRequest& request, const ModifyImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyImageAttribute(request), context);
@@ -5203,7 +6833,7 @@ ModifyInstanceAttributeOutcome EC2Client::ModifyInstanceAttribute(const ModifyIn
 
 ModifyInstanceAttributeOutcomeCallable EC2Client::ModifyInstanceAttributeCallable(const ModifyInstanceAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyInstanceAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyInstanceAttribute( request ); } );
 }
 
 void EC2Client::ModifyInstanceAttributeAsync(const ModifyInstanceAttributeRequest& request, const ModifyInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5211,6 +6841,16 @@ void EC2Client::ModifyInstanceAttributeAsync(const ModifyInstanceAttributeReques
   m_executor->Submit( [this, request, handler, context](){ this->ModifyInstanceAttributeAsyncHelper( request, handler, context ); } );
 }
 
+ModifyInstanceAttributeOutcomeCallable EC2Client::ModifyInstanceAttributeCallable(ModifyInstanceAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ModifyInstanceAttribute, this, std::move(request)));
+}
+
+void EC2Client::ModifyInstanceAttributeAsync(ModifyInstanceAttributeRequest&& request, const ModifyInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ModifyInstanceAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ModifyInstanceAttributeAsyncHelper(const ModifyInstanceAttributeRequest& request, const ModifyInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyInstanceAttribute(request), context);
@@ -5233,7 +6873,7 @@ ModifyInstancePlacementOutcome EC2Client::ModifyInstancePlacement(const ModifyIn
 
 ModifyInstancePlacementOutcomeCallable EC2Client::ModifyInstancePlacementCallable(const ModifyInstancePlacementRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyInstancePlacement( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyInstancePlacement( request ); } );
 }
 
 void EC2Client::ModifyInstancePlacementAsync(const ModifyInstancePlacementRequest& request, const ModifyInstancePlacementResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5241,6 +6881,16 @@ void EC2Client::ModifyInstancePlacementAsync(const ModifyInstancePlacementReques
   m_executor->Submit( [this, request, handler, context](){ this->ModifyInstancePlacementAsyncHelper( request, handler, context ); } );
 }
 
+ModifyInstancePlacementOutcomeCallable EC2Client::ModifyInstancePlacementCallable(ModifyInstancePlacementRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ModifyInstancePlacement, this, std::move(request)));
+}
+
+void EC2Client::ModifyInstancePlacementAsync(ModifyInstancePlacementRequest&& request, const ModifyInstancePlacementResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ModifyInstancePlacementAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ModifyInstancePlacementAsyncHelper(const ModifyInstancePlacementRequest& request, const ModifyInstancePlacementResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyInstancePlacement(request), context);
@@ -5263,7 +6913,7 @@ ModifyNetworkInterfaceAttributeOutcome EC2Client::ModifyNetworkInterfaceAttribut
 
 ModifyNetworkInterfaceAttributeOutcomeCallable EC2Client::ModifyNetworkInterfaceAttributeCallable(const ModifyNetworkInterfaceAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyNetworkInterfaceAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyNetworkInterfaceAttribute( request ); } );
 }
 
 void EC2Client::ModifyNetworkInterfaceAttributeAsync(const ModifyNetworkInterfaceAttributeRequest& request, const ModifyNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5271,6 +6921,16 @@ void EC2Client::ModifyNetworkInterfaceAttributeAsync(const ModifyNetworkInterfac
   m_executor->Submit( [this, request, handler, context](){ this->ModifyNetworkInterfaceAttributeAsyncHelper( request, handler, context ); } );
 }
 
+ModifyNetworkInterfaceAttributeOutcomeCallable EC2Client::ModifyNetworkInterfaceAttributeCallable(ModifyNetworkInterfaceAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ModifyNetworkInterfaceAttribute, this, std::move(request)));
+}
+
+void EC2Client::ModifyNetworkInterfaceAttributeAsync(ModifyNetworkInterfaceAttributeRequest&& request, const ModifyNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ModifyNetworkInterfaceAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ModifyNetworkInterfaceAttributeAsyncHelper(const ModifyNetworkInterfaceAttributeRequest& request, const ModifyNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyNetworkInterfaceAttribute(request), context);
@@ -5293,7 +6953,7 @@ ModifyReservedInstancesOutcome EC2Client::ModifyReservedInstances(const ModifyRe
 
 ModifyReservedInstancesOutcomeCallable EC2Client::ModifyReservedInstancesCallable(const ModifyReservedInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyReservedInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyReservedInstances( request ); } );
 }
 
 void EC2Client::ModifyReservedInstancesAsync(const ModifyReservedInstancesRequest& request, const ModifyReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5301,6 +6961,16 @@ void EC2Client::ModifyReservedInstancesAsync(const ModifyReservedInstancesReques
   m_executor->Submit( [this, request, handler, context](){ this->ModifyReservedInstancesAsyncHelper( request, handler, context ); } );
 }
 
+ModifyReservedInstancesOutcomeCallable EC2Client::ModifyReservedInstancesCallable(ModifyReservedInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ModifyReservedInstances, this, std::move(request)));
+}
+
+void EC2Client::ModifyReservedInstancesAsync(ModifyReservedInstancesRequest&& request, const ModifyReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ModifyReservedInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ModifyReservedInstancesAsyncHelper(const ModifyReservedInstancesRequest& request, const ModifyReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyReservedInstances(request), context);
@@ -5323,7 +6993,7 @@ ModifySnapshotAttributeOutcome EC2Client::ModifySnapshotAttribute(const ModifySn
 
 ModifySnapshotAttributeOutcomeCallable EC2Client::ModifySnapshotAttributeCallable(const ModifySnapshotAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifySnapshotAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifySnapshotAttribute( request ); } );
 }
 
 void EC2Client::ModifySnapshotAttributeAsync(const ModifySnapshotAttributeRequest& request, const ModifySnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5331,6 +7001,16 @@ void EC2Client::ModifySnapshotAttributeAsync(const ModifySnapshotAttributeReques
   m_executor->Submit( [this, request, handler, context](){ this->ModifySnapshotAttributeAsyncHelper( request, handler, context ); } );
 }
 
+ModifySnapshotAttributeOutcomeCallable EC2Client::ModifySnapshotAttributeCallable(ModifySnapshotAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ModifySnapshotAttribute, this, std::move(request)));
+}
+
+void EC2Client::ModifySnapshotAttributeAsync(ModifySnapshotAttributeRequest&& request, const ModifySnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ModifySnapshotAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ModifySnapshotAttributeAsyncHelper(const ModifySnapshotAttributeRequest& request, const ModifySnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifySnapshotAttribute(request), context);
@@ -5353,7 +7033,7 @@ ModifySpotFleetRequestOutcome EC2Client::ModifySpotFleetRequest(const ModifySpot
 
 ModifySpotFleetRequestOutcomeCallable EC2Client::ModifySpotFleetRequestCallable(const ModifySpotFleetRequestRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifySpotFleetRequest( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifySpotFleetRequest( request ); } );
 }
 
 void EC2Client::ModifySpotFleetRequestAsync(const ModifySpotFleetRequestRequest& request, const ModifySpotFleetRequestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5361,6 +7041,16 @@ void EC2Client::ModifySpotFleetRequestAsync(const ModifySpotFleetRequestRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ModifySpotFleetRequestAsyncHelper( request, handler, context ); } );
 }
 
+ModifySpotFleetRequestOutcomeCallable EC2Client::ModifySpotFleetRequestCallable(ModifySpotFleetRequestRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ModifySpotFleetRequest, this, std::move(request)));
+}
+
+void EC2Client::ModifySpotFleetRequestAsync(ModifySpotFleetRequestRequest&& request, const ModifySpotFleetRequestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ModifySpotFleetRequestAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ModifySpotFleetRequestAsyncHelper(const ModifySpotFleetRequestRequest& request, const ModifySpotFleetRequestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifySpotFleetRequest(request), context);
@@ -5383,7 +7073,7 @@ ModifySubnetAttributeOutcome EC2Client::ModifySubnetAttribute(const ModifySubnet
 
 ModifySubnetAttributeOutcomeCallable EC2Client::ModifySubnetAttributeCallable(const ModifySubnetAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifySubnetAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifySubnetAttribute( request ); } );
 }
 
 void EC2Client::ModifySubnetAttributeAsync(const ModifySubnetAttributeRequest& request, const ModifySubnetAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5391,6 +7081,16 @@ void EC2Client::ModifySubnetAttributeAsync(const ModifySubnetAttributeRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->ModifySubnetAttributeAsyncHelper( request, handler, context ); } );
 }
 
+ModifySubnetAttributeOutcomeCallable EC2Client::ModifySubnetAttributeCallable(ModifySubnetAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ModifySubnetAttribute, this, std::move(request)));
+}
+
+void EC2Client::ModifySubnetAttributeAsync(ModifySubnetAttributeRequest&& request, const ModifySubnetAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ModifySubnetAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ModifySubnetAttributeAsyncHelper(const ModifySubnetAttributeRequest& request, const ModifySubnetAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifySubnetAttribute(request), context);
@@ -5413,7 +7113,7 @@ ModifyVolumeAttributeOutcome EC2Client::ModifyVolumeAttribute(const ModifyVolume
 
 ModifyVolumeAttributeOutcomeCallable EC2Client::ModifyVolumeAttributeCallable(const ModifyVolumeAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyVolumeAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyVolumeAttribute( request ); } );
 }
 
 void EC2Client::ModifyVolumeAttributeAsync(const ModifyVolumeAttributeRequest& request, const ModifyVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5421,6 +7121,16 @@ void EC2Client::ModifyVolumeAttributeAsync(const ModifyVolumeAttributeRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->ModifyVolumeAttributeAsyncHelper( request, handler, context ); } );
 }
 
+ModifyVolumeAttributeOutcomeCallable EC2Client::ModifyVolumeAttributeCallable(ModifyVolumeAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ModifyVolumeAttribute, this, std::move(request)));
+}
+
+void EC2Client::ModifyVolumeAttributeAsync(ModifyVolumeAttributeRequest&& request, const ModifyVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ModifyVolumeAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ModifyVolumeAttributeAsyncHelper(const ModifyVolumeAttributeRequest& request, const ModifyVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyVolumeAttribute(request), context);
@@ -5443,7 +7153,7 @@ ModifyVpcAttributeOutcome EC2Client::ModifyVpcAttribute(const ModifyVpcAttribute
 
 ModifyVpcAttributeOutcomeCallable EC2Client::ModifyVpcAttributeCallable(const ModifyVpcAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyVpcAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyVpcAttribute( request ); } );
 }
 
 void EC2Client::ModifyVpcAttributeAsync(const ModifyVpcAttributeRequest& request, const ModifyVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5451,6 +7161,16 @@ void EC2Client::ModifyVpcAttributeAsync(const ModifyVpcAttributeRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->ModifyVpcAttributeAsyncHelper( request, handler, context ); } );
 }
 
+ModifyVpcAttributeOutcomeCallable EC2Client::ModifyVpcAttributeCallable(ModifyVpcAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ModifyVpcAttribute, this, std::move(request)));
+}
+
+void EC2Client::ModifyVpcAttributeAsync(ModifyVpcAttributeRequest&& request, const ModifyVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ModifyVpcAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ModifyVpcAttributeAsyncHelper(const ModifyVpcAttributeRequest& request, const ModifyVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyVpcAttribute(request), context);
@@ -5473,7 +7193,7 @@ ModifyVpcEndpointOutcome EC2Client::ModifyVpcEndpoint(const ModifyVpcEndpointReq
 
 ModifyVpcEndpointOutcomeCallable EC2Client::ModifyVpcEndpointCallable(const ModifyVpcEndpointRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyVpcEndpoint( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyVpcEndpoint( request ); } );
 }
 
 void EC2Client::ModifyVpcEndpointAsync(const ModifyVpcEndpointRequest& request, const ModifyVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5481,6 +7201,16 @@ void EC2Client::ModifyVpcEndpointAsync(const ModifyVpcEndpointRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ModifyVpcEndpointAsyncHelper( request, handler, context ); } );
 }
 
+ModifyVpcEndpointOutcomeCallable EC2Client::ModifyVpcEndpointCallable(ModifyVpcEndpointRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ModifyVpcEndpoint, this, std::move(request)));
+}
+
+void EC2Client::ModifyVpcEndpointAsync(ModifyVpcEndpointRequest&& request, const ModifyVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ModifyVpcEndpointAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ModifyVpcEndpointAsyncHelper(const ModifyVpcEndpointRequest& request, const ModifyVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyVpcEndpoint(request), context);
@@ -5503,7 +7233,7 @@ ModifyVpcPeeringConnectionOptionsOutcome EC2Client::ModifyVpcPeeringConnectionOp
 
 ModifyVpcPeeringConnectionOptionsOutcomeCallable EC2Client::ModifyVpcPeeringConnectionOptionsCallable(const ModifyVpcPeeringConnectionOptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyVpcPeeringConnectionOptions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyVpcPeeringConnectionOptions( request ); } );
 }
 
 void EC2Client::ModifyVpcPeeringConnectionOptionsAsync(const ModifyVpcPeeringConnectionOptionsRequest& request, const ModifyVpcPeeringConnectionOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5511,6 +7241,16 @@ void EC2Client::ModifyVpcPeeringConnectionOptionsAsync(const ModifyVpcPeeringCon
   m_executor->Submit( [this, request, handler, context](){ this->ModifyVpcPeeringConnectionOptionsAsyncHelper( request, handler, context ); } );
 }
 
+ModifyVpcPeeringConnectionOptionsOutcomeCallable EC2Client::ModifyVpcPeeringConnectionOptionsCallable(ModifyVpcPeeringConnectionOptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ModifyVpcPeeringConnectionOptions, this, std::move(request)));
+}
+
+void EC2Client::ModifyVpcPeeringConnectionOptionsAsync(ModifyVpcPeeringConnectionOptionsRequest&& request, const ModifyVpcPeeringConnectionOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ModifyVpcPeeringConnectionOptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ModifyVpcPeeringConnectionOptionsAsyncHelper(const ModifyVpcPeeringConnectionOptionsRequest& request, const ModifyVpcPeeringConnectionOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyVpcPeeringConnectionOptions(request), context);
@@ -5533,7 +7273,7 @@ MonitorInstancesOutcome EC2Client::MonitorInstances(const MonitorInstancesReques
 
 MonitorInstancesOutcomeCallable EC2Client::MonitorInstancesCallable(const MonitorInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->MonitorInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->MonitorInstances( request ); } );
 }
 
 void EC2Client::MonitorInstancesAsync(const MonitorInstancesRequest& request, const MonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5541,6 +7281,16 @@ void EC2Client::MonitorInstancesAsync(const MonitorInstancesRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->MonitorInstancesAsyncHelper( request, handler, context ); } );
 }
 
+MonitorInstancesOutcomeCallable EC2Client::MonitorInstancesCallable(MonitorInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::MonitorInstances, this, std::move(request)));
+}
+
+void EC2Client::MonitorInstancesAsync(MonitorInstancesRequest&& request, const MonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::MonitorInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::MonitorInstancesAsyncHelper(const MonitorInstancesRequest& request, const MonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, MonitorInstances(request), context);
@@ -5563,7 +7313,7 @@ MoveAddressToVpcOutcome EC2Client::MoveAddressToVpc(const MoveAddressToVpcReques
 
 MoveAddressToVpcOutcomeCallable EC2Client::MoveAddressToVpcCallable(const MoveAddressToVpcRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->MoveAddressToVpc( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->MoveAddressToVpc( request ); } );
 }
 
 void EC2Client::MoveAddressToVpcAsync(const MoveAddressToVpcRequest& request, const MoveAddressToVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5571,6 +7321,16 @@ void EC2Client::MoveAddressToVpcAsync(const MoveAddressToVpcRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->MoveAddressToVpcAsyncHelper( request, handler, context ); } );
 }
 
+MoveAddressToVpcOutcomeCallable EC2Client::MoveAddressToVpcCallable(MoveAddressToVpcRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::MoveAddressToVpc, this, std::move(request)));
+}
+
+void EC2Client::MoveAddressToVpcAsync(MoveAddressToVpcRequest&& request, const MoveAddressToVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::MoveAddressToVpcAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::MoveAddressToVpcAsyncHelper(const MoveAddressToVpcRequest& request, const MoveAddressToVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, MoveAddressToVpc(request), context);
@@ -5593,7 +7353,7 @@ PurchaseReservedInstancesOfferingOutcome EC2Client::PurchaseReservedInstancesOff
 
 PurchaseReservedInstancesOfferingOutcomeCallable EC2Client::PurchaseReservedInstancesOfferingCallable(const PurchaseReservedInstancesOfferingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PurchaseReservedInstancesOffering( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PurchaseReservedInstancesOffering( request ); } );
 }
 
 void EC2Client::PurchaseReservedInstancesOfferingAsync(const PurchaseReservedInstancesOfferingRequest& request, const PurchaseReservedInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5601,6 +7361,16 @@ void EC2Client::PurchaseReservedInstancesOfferingAsync(const PurchaseReservedIns
   m_executor->Submit( [this, request, handler, context](){ this->PurchaseReservedInstancesOfferingAsyncHelper( request, handler, context ); } );
 }
 
+PurchaseReservedInstancesOfferingOutcomeCallable EC2Client::PurchaseReservedInstancesOfferingCallable(PurchaseReservedInstancesOfferingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::PurchaseReservedInstancesOffering, this, std::move(request)));
+}
+
+void EC2Client::PurchaseReservedInstancesOfferingAsync(PurchaseReservedInstancesOfferingRequest&& request, const PurchaseReservedInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::PurchaseReservedInstancesOfferingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::PurchaseReservedInstancesOfferingAsyncHelper(const PurchaseReservedInstancesOfferingRequest& request, const PurchaseReservedInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PurchaseReservedInstancesOffering(request), context);
@@ -5623,7 +7393,7 @@ PurchaseScheduledInstancesOutcome EC2Client::PurchaseScheduledInstances(const Pu
 
 PurchaseScheduledInstancesOutcomeCallable EC2Client::PurchaseScheduledInstancesCallable(const PurchaseScheduledInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PurchaseScheduledInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PurchaseScheduledInstances( request ); } );
 }
 
 void EC2Client::PurchaseScheduledInstancesAsync(const PurchaseScheduledInstancesRequest& request, const PurchaseScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5631,6 +7401,16 @@ void EC2Client::PurchaseScheduledInstancesAsync(const PurchaseScheduledInstances
   m_executor->Submit( [this, request, handler, context](){ this->PurchaseScheduledInstancesAsyncHelper( request, handler, context ); } );
 }
 
+PurchaseScheduledInstancesOutcomeCallable EC2Client::PurchaseScheduledInstancesCallable(PurchaseScheduledInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::PurchaseScheduledInstances, this, std::move(request)));
+}
+
+void EC2Client::PurchaseScheduledInstancesAsync(PurchaseScheduledInstancesRequest&& request, const PurchaseScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::PurchaseScheduledInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::PurchaseScheduledInstancesAsyncHelper(const PurchaseScheduledInstancesRequest& request, const PurchaseScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PurchaseScheduledInstances(request), context);
@@ -5653,7 +7433,7 @@ RebootInstancesOutcome EC2Client::RebootInstances(const RebootInstancesRequest&
 
 RebootInstancesOutcomeCallable EC2Client::RebootInstancesCallable(const RebootInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RebootInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RebootInstances( request ); } );
 }
 
 void EC2Client::RebootInstancesAsync(const RebootInstancesRequest& request, const RebootInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5661,6 +7441,16 @@ void EC2Client::RebootInstancesAsync(const RebootInstancesRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->RebootInstancesAsyncHelper( request, handler, context ); } );
 }
 
+RebootInstancesOutcomeCallable EC2Client::RebootInstancesCallable(RebootInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::RebootInstances, this, std::move(request)));
+}
+
+void EC2Client::RebootInstancesAsync(RebootInstancesRequest&& request, const RebootInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::RebootInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::RebootInstancesAsyncHelper(const RebootInstancesRequest& request, const RebootInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RebootInstances(request), context);
@@ -5683,7 +7473,7 @@ RegisterImageOutcome EC2Client::RegisterImage(const RegisterImageRequest& reques
 
 RegisterImageOutcomeCallable EC2Client::RegisterImageCallable(const RegisterImageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterImage( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterImage( request ); } );
 }
 
 void EC2Client::RegisterImageAsync(const RegisterImageRequest& request, const RegisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5691,6 +7481,16 @@ void EC2Client::RegisterImageAsync(const RegisterImageRequest& request, const Re
   m_executor->Submit( [this, request, handler, context](){ this->RegisterImageAsyncHelper( request, handler, context ); } );
 }
 
+RegisterImageOutcomeCallable EC2Client::RegisterImageCallable(RegisterImageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::RegisterImage, this, std::move(request)));
+}
+
+void EC2Client::RegisterImageAsync(RegisterImageRequest&& request, const RegisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::RegisterImageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::RegisterImageAsyncHelper(const RegisterImageRequest& request, const RegisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterImage(request), context);
@@ -5713,7 +7513,7 @@ RejectVpcPeeringConnectionOutcome EC2Client::RejectVpcPeeringConnection(const Re
 
 RejectVpcPeeringConnectionOutcomeCallable EC2Client::RejectVpcPeeringConnectionCallable(const RejectVpcPeeringConnectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RejectVpcPeeringConnection( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RejectVpcPeeringConnection( request ); } );
 }
 
 void EC2Client::RejectVpcPeeringConnectionAsync(const RejectVpcPeeringConnectionRequest& request, const RejectVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5721,6 +7521,16 @@ void EC2Client::RejectVpcPeeringConnectionAsync(const RejectVpcPeeringConnection
   m_executor->Submit( [this, request, handler, context](){ this->RejectVpcPeeringConnectionAsyncHelper( request, handler, context ); } );
 }
 
+RejectVpcPeeringConnectionOutcomeCallable EC2Client::RejectVpcPeeringConnectionCallable(RejectVpcPeeringConnectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::RejectVpcPeeringConnection, this, std::move(request)));
+}
+
+void EC2Client::RejectVpcPeeringConnectionAsync(RejectVpcPeeringConnectionRequest&& request, const RejectVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::RejectVpcPeeringConnectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::RejectVpcPeeringConnectionAsyncHelper(const RejectVpcPeeringConnectionRequest& request, const RejectVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RejectVpcPeeringConnection(request), context);
@@ -5743,7 +7553,7 @@ ReleaseAddressOutcome EC2Client::ReleaseAddress(const ReleaseAddressRequest& req
 
 ReleaseAddressOutcomeCallable EC2Client::ReleaseAddressCallable(const ReleaseAddressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReleaseAddress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ReleaseAddress( request ); } );
 }
 
 void EC2Client::ReleaseAddressAsync(const ReleaseAddressRequest& request, const ReleaseAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5751,6 +7561,16 @@ void EC2Client::ReleaseAddressAsync(const ReleaseAddressRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ReleaseAddressAsyncHelper( request, handler, context ); } );
 }
 
+ReleaseAddressOutcomeCallable EC2Client::ReleaseAddressCallable(ReleaseAddressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ReleaseAddress, this, std::move(request)));
+}
+
+void EC2Client::ReleaseAddressAsync(ReleaseAddressRequest&& request, const ReleaseAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ReleaseAddressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ReleaseAddressAsyncHelper(const ReleaseAddressRequest& request, const ReleaseAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReleaseAddress(request), context);
@@ -5773,7 +7593,7 @@ ReleaseHostsOutcome EC2Client::ReleaseHosts(const ReleaseHostsRequest& request)
 
 ReleaseHostsOutcomeCallable EC2Client::ReleaseHostsCallable(const ReleaseHostsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReleaseHosts( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ReleaseHosts( request ); } );
 }
 
 void EC2Client::ReleaseHostsAsync(const ReleaseHostsRequest& request, const ReleaseHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5781,6 +7601,16 @@ void EC2Client::ReleaseHostsAsync(const ReleaseHostsRequest& request, const Rele
   m_executor->Submit( [this, request, handler, context](){ this->ReleaseHostsAsyncHelper( request, handler, context ); } );
 }
 
+ReleaseHostsOutcomeCallable EC2Client::ReleaseHostsCallable(ReleaseHostsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ReleaseHosts, this, std::move(request)));
+}
+
+void EC2Client::ReleaseHostsAsync(ReleaseHostsRequest&& request, const ReleaseHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ReleaseHostsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ReleaseHostsAsyncHelper(const ReleaseHostsRequest& request, const ReleaseHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReleaseHosts(request), context);
@@ -5803,7 +7633,7 @@ ReplaceNetworkAclAssociationOutcome EC2Client::ReplaceNetworkAclAssociation(cons
 
 ReplaceNetworkAclAssociationOutcomeCallable EC2Client::ReplaceNetworkAclAssociationCallable(const ReplaceNetworkAclAssociationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReplaceNetworkAclAssociation( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ReplaceNetworkAclAssociation( request ); } );
 }
 
 void EC2Client::ReplaceNetworkAclAssociationAsync(const ReplaceNetworkAclAssociationRequest& request, const ReplaceNetworkAclAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5811,6 +7641,16 @@ void EC2Client::ReplaceNetworkAclAssociationAsync(const ReplaceNetworkAclAssocia
   m_executor->Submit( [this, request, handler, context](){ this->ReplaceNetworkAclAssociationAsyncHelper( request, handler, context ); } );
 }
 
+ReplaceNetworkAclAssociationOutcomeCallable EC2Client::ReplaceNetworkAclAssociationCallable(ReplaceNetworkAclAssociationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ReplaceNetworkAclAssociation, this, std::move(request)));
+}
+
+void EC2Client::ReplaceNetworkAclAssociationAsync(ReplaceNetworkAclAssociationRequest&& request, const ReplaceNetworkAclAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ReplaceNetworkAclAssociationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ReplaceNetworkAclAssociationAsyncHelper(const ReplaceNetworkAclAssociationRequest& request, const ReplaceNetworkAclAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReplaceNetworkAclAssociation(request), context);
@@ -5833,7 +7673,7 @@ ReplaceNetworkAclEntryOutcome EC2Client::ReplaceNetworkAclEntry(const ReplaceNet
 
 ReplaceNetworkAclEntryOutcomeCallable EC2Client::ReplaceNetworkAclEntryCallable(const ReplaceNetworkAclEntryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReplaceNetworkAclEntry( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ReplaceNetworkAclEntry( request ); } );
 }
 
 void EC2Client::ReplaceNetworkAclEntryAsync(const ReplaceNetworkAclEntryRequest& request, const ReplaceNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5841,6 +7681,16 @@ void EC2Client::ReplaceNetworkAclEntryAsync(const ReplaceNetworkAclEntryRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ReplaceNetworkAclEntryAsyncHelper( request, handler, context ); } );
 }
 
+ReplaceNetworkAclEntryOutcomeCallable EC2Client::ReplaceNetworkAclEntryCallable(ReplaceNetworkAclEntryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ReplaceNetworkAclEntry, this, std::move(request)));
+}
+
+void EC2Client::ReplaceNetworkAclEntryAsync(ReplaceNetworkAclEntryRequest&& request, const ReplaceNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ReplaceNetworkAclEntryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ReplaceNetworkAclEntryAsyncHelper(const ReplaceNetworkAclEntryRequest& request, const ReplaceNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReplaceNetworkAclEntry(request), context);
@@ -5863,7 +7713,7 @@ ReplaceRouteOutcome EC2Client::ReplaceRoute(const ReplaceRouteRequest& request)
 
 ReplaceRouteOutcomeCallable EC2Client::ReplaceRouteCallable(const ReplaceRouteRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReplaceRoute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ReplaceRoute( request ); } );
 }
 
 void EC2Client::ReplaceRouteAsync(const ReplaceRouteRequest& request, const ReplaceRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5871,6 +7721,16 @@ void EC2Client::ReplaceRouteAsync(const ReplaceRouteRequest& request, const Repl
   m_executor->Submit( [this, request, handler, context](){ this->ReplaceRouteAsyncHelper( request, handler, context ); } );
 }
 
+ReplaceRouteOutcomeCallable EC2Client::ReplaceRouteCallable(ReplaceRouteRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ReplaceRoute, this, std::move(request)));
+}
+
+void EC2Client::ReplaceRouteAsync(ReplaceRouteRequest&& request, const ReplaceRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ReplaceRouteAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ReplaceRouteAsyncHelper(const ReplaceRouteRequest& request, const ReplaceRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReplaceRoute(request), context);
@@ -5893,7 +7753,7 @@ ReplaceRouteTableAssociationOutcome EC2Client::ReplaceRouteTableAssociation(cons
 
 ReplaceRouteTableAssociationOutcomeCallable EC2Client::ReplaceRouteTableAssociationCallable(const ReplaceRouteTableAssociationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReplaceRouteTableAssociation( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ReplaceRouteTableAssociation( request ); } );
 }
 
 void EC2Client::ReplaceRouteTableAssociationAsync(const ReplaceRouteTableAssociationRequest& request, const ReplaceRouteTableAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5901,6 +7761,16 @@ void EC2Client::ReplaceRouteTableAssociationAsync(const ReplaceRouteTableAssocia
   m_executor->Submit( [this, request, handler, context](){ this->ReplaceRouteTableAssociationAsyncHelper( request, handler, context ); } );
 }
 
+ReplaceRouteTableAssociationOutcomeCallable EC2Client::ReplaceRouteTableAssociationCallable(ReplaceRouteTableAssociationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ReplaceRouteTableAssociation, this, std::move(request)));
+}
+
+void EC2Client::ReplaceRouteTableAssociationAsync(ReplaceRouteTableAssociationRequest&& request, const ReplaceRouteTableAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ReplaceRouteTableAssociationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ReplaceRouteTableAssociationAsyncHelper(const ReplaceRouteTableAssociationRequest& request, const ReplaceRouteTableAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReplaceRouteTableAssociation(request), context);
@@ -5923,7 +7793,7 @@ ReportInstanceStatusOutcome EC2Client::ReportInstanceStatus(const ReportInstance
 
 ReportInstanceStatusOutcomeCallable EC2Client::ReportInstanceStatusCallable(const ReportInstanceStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReportInstanceStatus( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ReportInstanceStatus( request ); } );
 }
 
 void EC2Client::ReportInstanceStatusAsync(const ReportInstanceStatusRequest& request, const ReportInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5931,6 +7801,16 @@ void EC2Client::ReportInstanceStatusAsync(const ReportInstanceStatusRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->ReportInstanceStatusAsyncHelper( request, handler, context ); } );
 }
 
+ReportInstanceStatusOutcomeCallable EC2Client::ReportInstanceStatusCallable(ReportInstanceStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ReportInstanceStatus, this, std::move(request)));
+}
+
+void EC2Client::ReportInstanceStatusAsync(ReportInstanceStatusRequest&& request, const ReportInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ReportInstanceStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ReportInstanceStatusAsyncHelper(const ReportInstanceStatusRequest& request, const ReportInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReportInstanceStatus(request), context);
@@ -5953,7 +7833,7 @@ RequestSpotFleetOutcome EC2Client::RequestSpotFleet(const RequestSpotFleetReques
 
 RequestSpotFleetOutcomeCallable EC2Client::RequestSpotFleetCallable(const RequestSpotFleetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RequestSpotFleet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RequestSpotFleet( request ); } );
 }
 
 void EC2Client::RequestSpotFleetAsync(const RequestSpotFleetRequest& request, const RequestSpotFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5961,6 +7841,16 @@ void EC2Client::RequestSpotFleetAsync(const RequestSpotFleetRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->RequestSpotFleetAsyncHelper( request, handler, context ); } );
 }
 
+RequestSpotFleetOutcomeCallable EC2Client::RequestSpotFleetCallable(RequestSpotFleetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::RequestSpotFleet, this, std::move(request)));
+}
+
+void EC2Client::RequestSpotFleetAsync(RequestSpotFleetRequest&& request, const RequestSpotFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::RequestSpotFleetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::RequestSpotFleetAsyncHelper(const RequestSpotFleetRequest& request, const RequestSpotFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RequestSpotFleet(request), context);
@@ -5983,7 +7873,7 @@ RequestSpotInstancesOutcome EC2Client::RequestSpotInstances(const RequestSpotIns
 
 RequestSpotInstancesOutcomeCallable EC2Client::RequestSpotInstancesCallable(const RequestSpotInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RequestSpotInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RequestSpotInstances( request ); } );
 }
 
 void EC2Client::RequestSpotInstancesAsync(const RequestSpotInstancesRequest& request, const RequestSpotInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5991,6 +7881,16 @@ void EC2Client::RequestSpotInstancesAsync(const RequestSpotInstancesRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->RequestSpotInstancesAsyncHelper( request, handler, context ); } );
 }
 
+RequestSpotInstancesOutcomeCallable EC2Client::RequestSpotInstancesCallable(RequestSpotInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::RequestSpotInstances, this, std::move(request)));
+}
+
+void EC2Client::RequestSpotInstancesAsync(RequestSpotInstancesRequest&& request, const RequestSpotInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::RequestSpotInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::RequestSpotInstancesAsyncHelper(const RequestSpotInstancesRequest& request, const RequestSpotInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RequestSpotInstances(request), context);
@@ -6013,7 +7913,7 @@ ResetImageAttributeOutcome EC2Client::ResetImageAttribute(const ResetImageAttrib
 
 ResetImageAttributeOutcomeCallable EC2Client::ResetImageAttributeCallable(const ResetImageAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResetImageAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResetImageAttribute( request ); } );
 }
 
 void EC2Client::ResetImageAttributeAsync(const ResetImageAttributeRequest& request, const ResetImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6021,6 +7921,16 @@ void EC2Client::ResetImageAttributeAsync(const ResetImageAttributeRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ResetImageAttributeAsyncHelper( request, handler, context ); } );
 }
 
+ResetImageAttributeOutcomeCallable EC2Client::ResetImageAttributeCallable(ResetImageAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ResetImageAttribute, this, std::move(request)));
+}
+
+void EC2Client::ResetImageAttributeAsync(ResetImageAttributeRequest&& request, const ResetImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ResetImageAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ResetImageAttributeAsyncHelper(const ResetImageAttributeRequest& request, const ResetImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResetImageAttribute(request), context);
@@ -6043,7 +7953,7 @@ ResetInstanceAttributeOutcome EC2Client::ResetInstanceAttribute(const ResetInsta
 
 ResetInstanceAttributeOutcomeCallable EC2Client::ResetInstanceAttributeCallable(const ResetInstanceAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResetInstanceAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResetInstanceAttribute( request ); } );
 }
 
 void EC2Client::ResetInstanceAttributeAsync(const ResetInstanceAttributeRequest& request, const ResetInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6051,6 +7961,16 @@ void EC2Client::ResetInstanceAttributeAsync(const ResetInstanceAttributeRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ResetInstanceAttributeAsyncHelper( request, handler, context ); } );
 }
 
+ResetInstanceAttributeOutcomeCallable EC2Client::ResetInstanceAttributeCallable(ResetInstanceAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ResetInstanceAttribute, this, std::move(request)));
+}
+
+void EC2Client::ResetInstanceAttributeAsync(ResetInstanceAttributeRequest&& request, const ResetInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ResetInstanceAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ResetInstanceAttributeAsyncHelper(const ResetInstanceAttributeRequest& request, const ResetInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResetInstanceAttribute(request), context);
@@ -6073,7 +7993,7 @@ ResetNetworkInterfaceAttributeOutcome EC2Client::ResetNetworkInterfaceAttribute(
 
 ResetNetworkInterfaceAttributeOutcomeCallable EC2Client::ResetNetworkInterfaceAttributeCallable(const ResetNetworkInterfaceAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResetNetworkInterfaceAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResetNetworkInterfaceAttribute( request ); } );
 }
 
 void EC2Client::ResetNetworkInterfaceAttributeAsync(const ResetNetworkInterfaceAttributeRequest& request, const ResetNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6081,6 +8001,16 @@ void EC2Client::ResetNetworkInterfaceAttributeAsync(const ResetNetworkInterfaceA
   m_executor->Submit( [this, request, handler, context](){ this->ResetNetworkInterfaceAttributeAsyncHelper( request, handler, context ); } );
 }
 
+ResetNetworkInterfaceAttributeOutcomeCallable EC2Client::ResetNetworkInterfaceAttributeCallable(ResetNetworkInterfaceAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ResetNetworkInterfaceAttribute, this, std::move(request)));
+}
+
+void EC2Client::ResetNetworkInterfaceAttributeAsync(ResetNetworkInterfaceAttributeRequest&& request, const ResetNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ResetNetworkInterfaceAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ResetNetworkInterfaceAttributeAsyncHelper(const ResetNetworkInterfaceAttributeRequest& request, const ResetNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResetNetworkInterfaceAttribute(request), context);
@@ -6103,7 +8033,7 @@ ResetSnapshotAttributeOutcome EC2Client::ResetSnapshotAttribute(const ResetSnaps
 
 ResetSnapshotAttributeOutcomeCallable EC2Client::ResetSnapshotAttributeCallable(const ResetSnapshotAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResetSnapshotAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResetSnapshotAttribute( request ); } );
 }
 
 void EC2Client::ResetSnapshotAttributeAsync(const ResetSnapshotAttributeRequest& request, const ResetSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6111,6 +8041,16 @@ void EC2Client::ResetSnapshotAttributeAsync(const ResetSnapshotAttributeRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ResetSnapshotAttributeAsyncHelper( request, handler, context ); } );
 }
 
+ResetSnapshotAttributeOutcomeCallable EC2Client::ResetSnapshotAttributeCallable(ResetSnapshotAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::ResetSnapshotAttribute, this, std::move(request)));
+}
+
+void EC2Client::ResetSnapshotAttributeAsync(ResetSnapshotAttributeRequest&& request, const ResetSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::ResetSnapshotAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::ResetSnapshotAttributeAsyncHelper(const ResetSnapshotAttributeRequest& request, const ResetSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResetSnapshotAttribute(request), context);
@@ -6133,7 +8073,7 @@ RestoreAddressToClassicOutcome EC2Client::RestoreAddressToClassic(const RestoreA
 
 RestoreAddressToClassicOutcomeCallable EC2Client::RestoreAddressToClassicCallable(const RestoreAddressToClassicRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RestoreAddressToClassic( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RestoreAddressToClassic( request ); } );
 }
 
 void EC2Client::RestoreAddressToClassicAsync(const RestoreAddressToClassicRequest& request, const RestoreAddressToClassicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6141,6 +8081,16 @@ void EC2Client::RestoreAddressToClassicAsync(const RestoreAddressToClassicReques
   m_executor->Submit( [this, request, handler, context](){ this->RestoreAddressToClassicAsyncHelper( request, handler, context ); } );
 }
 
+RestoreAddressToClassicOutcomeCallable EC2Client::RestoreAddressToClassicCallable(RestoreAddressToClassicRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::RestoreAddressToClassic, this, std::move(request)));
+}
+
+void EC2Client::RestoreAddressToClassicAsync(RestoreAddressToClassicRequest&& request, const RestoreAddressToClassicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::RestoreAddressToClassicAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::RestoreAddressToClassicAsyncHelper(const RestoreAddressToClassicRequest& request, const RestoreAddressToClassicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RestoreAddressToClassic(request), context);
@@ -6163,7 +8113,7 @@ RevokeSecurityGroupEgressOutcome EC2Client::RevokeSecurityGroupEgress(const Revo
 
 RevokeSecurityGroupEgressOutcomeCallable EC2Client::RevokeSecurityGroupEgressCallable(const RevokeSecurityGroupEgressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RevokeSecurityGroupEgress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RevokeSecurityGroupEgress( request ); } );
 }
 
 void EC2Client::RevokeSecurityGroupEgressAsync(const RevokeSecurityGroupEgressRequest& request, const RevokeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6171,6 +8121,16 @@ void EC2Client::RevokeSecurityGroupEgressAsync(const RevokeSecurityGroupEgressRe
   m_executor->Submit( [this, request, handler, context](){ this->RevokeSecurityGroupEgressAsyncHelper( request, handler, context ); } );
 }
 
+RevokeSecurityGroupEgressOutcomeCallable EC2Client::RevokeSecurityGroupEgressCallable(RevokeSecurityGroupEgressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::RevokeSecurityGroupEgress, this, std::move(request)));
+}
+
+void EC2Client::RevokeSecurityGroupEgressAsync(RevokeSecurityGroupEgressRequest&& request, const RevokeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::RevokeSecurityGroupEgressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::RevokeSecurityGroupEgressAsyncHelper(const RevokeSecurityGroupEgressRequest& request, const RevokeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RevokeSecurityGroupEgress(request), context);
@@ -6193,7 +8153,7 @@ RevokeSecurityGroupIngressOutcome EC2Client::RevokeSecurityGroupIngress(const Re
 
 RevokeSecurityGroupIngressOutcomeCallable EC2Client::RevokeSecurityGroupIngressCallable(const RevokeSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RevokeSecurityGroupIngress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RevokeSecurityGroupIngress( request ); } );
 }
 
 void EC2Client::RevokeSecurityGroupIngressAsync(const RevokeSecurityGroupIngressRequest& request, const RevokeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6201,6 +8161,16 @@ void EC2Client::RevokeSecurityGroupIngressAsync(const RevokeSecurityGroupIngress
   m_executor->Submit( [this, request, handler, context](){ this->RevokeSecurityGroupIngressAsyncHelper( request, handler, context ); } );
 }
 
+RevokeSecurityGroupIngressOutcomeCallable EC2Client::RevokeSecurityGroupIngressCallable(RevokeSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::RevokeSecurityGroupIngress, this, std::move(request)));
+}
+
+void EC2Client::RevokeSecurityGroupIngressAsync(RevokeSecurityGroupIngressRequest&& request, const RevokeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::RevokeSecurityGroupIngressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::RevokeSecurityGroupIngressAsyncHelper(const RevokeSecurityGroupIngressRequest& request, const RevokeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RevokeSecurityGroupIngress(request), context);
@@ -6223,7 +8193,7 @@ RunInstancesOutcome EC2Client::RunInstances(const RunInstancesRequest& request)
 
 RunInstancesOutcomeCallable EC2Client::RunInstancesCallable(const RunInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RunInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RunInstances( request ); } );
 }
 
 void EC2Client::RunInstancesAsync(const RunInstancesRequest& request, const RunInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6231,6 +8201,16 @@ void EC2Client::RunInstancesAsync(const RunInstancesRequest& request, const RunI
   m_executor->Submit( [this, request, handler, context](){ this->RunInstancesAsyncHelper( request, handler, context ); } );
 }
 
+RunInstancesOutcomeCallable EC2Client::RunInstancesCallable(RunInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::RunInstances, this, std::move(request)));
+}
+
+void EC2Client::RunInstancesAsync(RunInstancesRequest&& request, const RunInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::RunInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::RunInstancesAsyncHelper(const RunInstancesRequest& request, const RunInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RunInstances(request), context);
@@ -6253,7 +8233,7 @@ RunScheduledInstancesOutcome EC2Client::RunScheduledInstances(const RunScheduled
 
 RunScheduledInstancesOutcomeCallable EC2Client::RunScheduledInstancesCallable(const RunScheduledInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RunScheduledInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RunScheduledInstances( request ); } );
 }
 
 void EC2Client::RunScheduledInstancesAsync(const RunScheduledInstancesRequest& request, const RunScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6261,6 +8241,16 @@ void EC2Client::RunScheduledInstancesAsync(const RunScheduledInstancesRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->RunScheduledInstancesAsyncHelper( request, handler, context ); } );
 }
 
+RunScheduledInstancesOutcomeCallable EC2Client::RunScheduledInstancesCallable(RunScheduledInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::RunScheduledInstances, this, std::move(request)));
+}
+
+void EC2Client::RunScheduledInstancesAsync(RunScheduledInstancesRequest&& request, const RunScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::RunScheduledInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::RunScheduledInstancesAsyncHelper(const RunScheduledInstancesRequest& request, const RunScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RunScheduledInstances(request), context);
@@ -6283,7 +8273,7 @@ StartInstancesOutcome EC2Client::StartInstances(const StartInstancesRequest& req
 
 StartInstancesOutcomeCallable EC2Client::StartInstancesCallable(const StartInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StartInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StartInstances( request ); } );
 }
 
 void EC2Client::StartInstancesAsync(const StartInstancesRequest& request, const StartInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6291,6 +8281,16 @@ void EC2Client::StartInstancesAsync(const StartInstancesRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->StartInstancesAsyncHelper( request, handler, context ); } );
 }
 
+StartInstancesOutcomeCallable EC2Client::StartInstancesCallable(StartInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::StartInstances, this, std::move(request)));
+}
+
+void EC2Client::StartInstancesAsync(StartInstancesRequest&& request, const StartInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::StartInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::StartInstancesAsyncHelper(const StartInstancesRequest& request, const StartInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StartInstances(request), context);
@@ -6313,7 +8313,7 @@ StopInstancesOutcome EC2Client::StopInstances(const StopInstancesRequest& reques
 
 StopInstancesOutcomeCallable EC2Client::StopInstancesCallable(const StopInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StopInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StopInstances( request ); } );
 }
 
 void EC2Client::StopInstancesAsync(const StopInstancesRequest& request, const StopInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6321,6 +8321,16 @@ void EC2Client::StopInstancesAsync(const StopInstancesRequest& request, const St
   m_executor->Submit( [this, request, handler, context](){ this->StopInstancesAsyncHelper( request, handler, context ); } );
 }
 
+StopInstancesOutcomeCallable EC2Client::StopInstancesCallable(StopInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::StopInstances, this, std::move(request)));
+}
+
+void EC2Client::StopInstancesAsync(StopInstancesRequest&& request, const StopInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::StopInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::StopInstancesAsyncHelper(const StopInstancesRequest& request, const StopInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StopInstances(request), context);
@@ -6343,7 +8353,7 @@ TerminateInstancesOutcome EC2Client::TerminateInstances(const TerminateInstances
 
 TerminateInstancesOutcomeCallable EC2Client::TerminateInstancesCallable(const TerminateInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TerminateInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TerminateInstances( request ); } );
 }
 
 void EC2Client::TerminateInstancesAsync(const TerminateInstancesRequest& request, const TerminateInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6351,6 +8361,16 @@ void EC2Client::TerminateInstancesAsync(const TerminateInstancesRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->TerminateInstancesAsyncHelper( request, handler, context ); } );
 }
 
+TerminateInstancesOutcomeCallable EC2Client::TerminateInstancesCallable(TerminateInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::TerminateInstances, this, std::move(request)));
+}
+
+void EC2Client::TerminateInstancesAsync(TerminateInstancesRequest&& request, const TerminateInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::TerminateInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::TerminateInstancesAsyncHelper(const TerminateInstancesRequest& request, const TerminateInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TerminateInstances(request), context);
@@ -6373,7 +8393,7 @@ UnassignPrivateIpAddressesOutcome EC2Client::UnassignPrivateIpAddresses(const Un
 
 UnassignPrivateIpAddressesOutcomeCallable EC2Client::UnassignPrivateIpAddressesCallable(const UnassignPrivateIpAddressesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UnassignPrivateIpAddresses( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UnassignPrivateIpAddresses( request ); } );
 }
 
 void EC2Client::UnassignPrivateIpAddressesAsync(const UnassignPrivateIpAddressesRequest& request, const UnassignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6381,6 +8401,16 @@ void EC2Client::UnassignPrivateIpAddressesAsync(const UnassignPrivateIpAddresses
   m_executor->Submit( [this, request, handler, context](){ this->UnassignPrivateIpAddressesAsyncHelper( request, handler, context ); } );
 }
 
+UnassignPrivateIpAddressesOutcomeCallable EC2Client::UnassignPrivateIpAddressesCallable(UnassignPrivateIpAddressesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::UnassignPrivateIpAddresses, this, std::move(request)));
+}
+
+void EC2Client::UnassignPrivateIpAddressesAsync(UnassignPrivateIpAddressesRequest&& request, const UnassignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::UnassignPrivateIpAddressesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::UnassignPrivateIpAddressesAsyncHelper(const UnassignPrivateIpAddressesRequest& request, const UnassignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UnassignPrivateIpAddresses(request), context);
@@ -6403,7 +8433,7 @@ UnmonitorInstancesOutcome EC2Client::UnmonitorInstances(const UnmonitorInstances
 
 UnmonitorInstancesOutcomeCallable EC2Client::UnmonitorInstancesCallable(const UnmonitorInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UnmonitorInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UnmonitorInstances( request ); } );
 }
 
 void EC2Client::UnmonitorInstancesAsync(const UnmonitorInstancesRequest& request, const UnmonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6411,8 +8441,1482 @@ void EC2Client::UnmonitorInstancesAsync(const UnmonitorInstancesRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->UnmonitorInstancesAsyncHelper( request, handler, context ); } );
 }
 
+UnmonitorInstancesOutcomeCallable EC2Client::UnmonitorInstancesCallable(UnmonitorInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EC2Client::UnmonitorInstances, this, std::move(request)));
+}
+
+void EC2Client::UnmonitorInstancesAsync(UnmonitorInstancesRequest&& request, const UnmonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EC2Client::UnmonitorInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EC2Client::UnmonitorInstancesAsyncHelper(const UnmonitorInstancesRequest& request, const UnmonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UnmonitorInstances(request), context);
 }
 
+Paginator<EC2Client, DescribeClassicLinkInstancesRequest, DescribeClassicLinkInstancesOutcome> EC2Client::DescribeClassicLinkInstancesPaginator(const DescribeClassicLinkInstancesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeClassicLinkInstancesRequest, DescribeClassicLinkInstancesOutcome>(this, &EC2Client::DescribeClassicLinkInstances, request,
+    [](const DescribeClassicLinkInstancesRequest& current, const DescribeClassicLinkInstancesOutcome& outcome, DescribeClassicLinkInstancesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeFlowLogsRequest, DescribeFlowLogsOutcome> EC2Client::DescribeFlowLogsPaginator(const DescribeFlowLogsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeFlowLogsRequest, DescribeFlowLogsOutcome>(this, &EC2Client::DescribeFlowLogs, request,
+    [](const DescribeFlowLogsRequest& current, const DescribeFlowLogsOutcome& outcome, DescribeFlowLogsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeHostsRequest, DescribeHostsOutcome> EC2Client::DescribeHostsPaginator(const DescribeHostsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeHostsRequest, DescribeHostsOutcome>(this, &EC2Client::DescribeHosts, request,
+    [](const DescribeHostsRequest& current, const DescribeHostsOutcome& outcome, DescribeHostsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeImportImageTasksRequest, DescribeImportImageTasksOutcome> EC2Client::DescribeImportImageTasksPaginator(const DescribeImportImageTasksRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeImportImageTasksRequest, DescribeImportImageTasksOutcome>(this, &EC2Client::DescribeImportImageTasks, request,
+    [](const DescribeImportImageTasksRequest& current, const DescribeImportImageTasksOutcome& outcome, DescribeImportImageTasksRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeImportSnapshotTasksRequest, DescribeImportSnapshotTasksOutcome> EC2Client::DescribeImportSnapshotTasksPaginator(const DescribeImportSnapshotTasksRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeImportSnapshotTasksRequest, DescribeImportSnapshotTasksOutcome>(this, &EC2Client::DescribeImportSnapshotTasks, request,
+    [](const DescribeImportSnapshotTasksRequest& current, const DescribeImportSnapshotTasksOutcome& outcome, DescribeImportSnapshotTasksRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeInstanceStatusRequest, DescribeInstanceStatusOutcome> EC2Client::DescribeInstanceStatusPaginator(const DescribeInstanceStatusRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeInstanceStatusRequest, DescribeInstanceStatusOutcome>(this, &EC2Client::DescribeInstanceStatus, request,
+    [](const DescribeInstanceStatusRequest& current, const DescribeInstanceStatusOutcome& outcome, DescribeInstanceStatusRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeInstancesRequest, DescribeInstancesOutcome> EC2Client::DescribeInstancesPaginator(const DescribeInstancesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeInstancesRequest, DescribeInstancesOutcome>(this, &EC2Client::DescribeInstances, request,
+    [](const DescribeInstancesRequest& current, const DescribeInstancesOutcome& outcome, DescribeInstancesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeMovingAddressesRequest, DescribeMovingAddressesOutcome> EC2Client::DescribeMovingAddressesPaginator(const DescribeMovingAddressesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeMovingAddressesRequest, DescribeMovingAddressesOutcome>(this, &EC2Client::DescribeMovingAddresses, request,
+    [](const DescribeMovingAddressesRequest& current, const DescribeMovingAddressesOutcome& outcome, DescribeMovingAddressesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeNatGatewaysRequest, DescribeNatGatewaysOutcome> EC2Client::DescribeNatGatewaysPaginator(const DescribeNatGatewaysRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeNatGatewaysRequest, DescribeNatGatewaysOutcome>(this, &EC2Client::DescribeNatGateways, request,
+    [](const DescribeNatGatewaysRequest& current, const DescribeNatGatewaysOutcome& outcome, DescribeNatGatewaysRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribePrefixListsRequest, DescribePrefixListsOutcome> EC2Client::DescribePrefixListsPaginator(const DescribePrefixListsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribePrefixListsRequest, DescribePrefixListsOutcome>(this, &EC2Client::DescribePrefixLists, request,
+    [](const DescribePrefixListsRequest& current, const DescribePrefixListsOutcome& outcome, DescribePrefixListsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeReservedInstancesModificationsRequest, DescribeReservedInstancesModificationsOutcome> EC2Client::DescribeReservedInstancesModificationsPaginator(const DescribeReservedInstancesModificationsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeReservedInstancesModificationsRequest, DescribeReservedInstancesModificationsOutcome>(this, &EC2Client::DescribeReservedInstancesModifications, request,
+    [](const DescribeReservedInstancesModificationsRequest& current, const DescribeReservedInstancesModificationsOutcome& outcome, DescribeReservedInstancesModificationsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeReservedInstancesOfferingsRequest, DescribeReservedInstancesOfferingsOutcome> EC2Client::DescribeReservedInstancesOfferingsPaginator(const DescribeReservedInstancesOfferingsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeReservedInstancesOfferingsRequest, DescribeReservedInstancesOfferingsOutcome>(this, &EC2Client::DescribeReservedInstancesOfferings, request,
+    [](const DescribeReservedInstancesOfferingsRequest& current, const DescribeReservedInstancesOfferingsOutcome& outcome, DescribeReservedInstancesOfferingsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeScheduledInstanceAvailabilityRequest, DescribeScheduledInstanceAvailabilityOutcome> EC2Client::DescribeScheduledInstanceAvailabilityPaginator(const DescribeScheduledInstanceAvailabilityRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeScheduledInstanceAvailabilityRequest, DescribeScheduledInstanceAvailabilityOutcome>(this, &EC2Client::DescribeScheduledInstanceAvailability, request,
+    [](const DescribeScheduledInstanceAvailabilityRequest& current, const DescribeScheduledInstanceAvailabilityOutcome& outcome, DescribeScheduledInstanceAvailabilityRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeScheduledInstancesRequest, DescribeScheduledInstancesOutcome> EC2Client::DescribeScheduledInstancesPaginator(const DescribeScheduledInstancesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeScheduledInstancesRequest, DescribeScheduledInstancesOutcome>(this, &EC2Client::DescribeScheduledInstances, request,
+    [](const DescribeScheduledInstancesRequest& current, const DescribeScheduledInstancesOutcome& outcome, DescribeScheduledInstancesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeSnapshotsRequest, DescribeSnapshotsOutcome> EC2Client::DescribeSnapshotsPaginator(const DescribeSnapshotsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeSnapshotsRequest, DescribeSnapshotsOutcome>(this, &EC2Client::DescribeSnapshots, request,
+    [](const DescribeSnapshotsRequest& current, const DescribeSnapshotsOutcome& outcome, DescribeSnapshotsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeSpotFleetInstancesRequest, DescribeSpotFleetInstancesOutcome> EC2Client::DescribeSpotFleetInstancesPaginator(const DescribeSpotFleetInstancesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeSpotFleetInstancesRequest, DescribeSpotFleetInstancesOutcome>(this, &EC2Client::DescribeSpotFleetInstances, request,
+    [](const DescribeSpotFleetInstancesRequest& current, const DescribeSpotFleetInstancesOutcome& outcome, DescribeSpotFleetInstancesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeSpotFleetRequestHistoryRequest, DescribeSpotFleetRequestHistoryOutcome> EC2Client::DescribeSpotFleetRequestHistoryPaginator(const DescribeSpotFleetRequestHistoryRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeSpotFleetRequestHistoryRequest, DescribeSpotFleetRequestHistoryOutcome>(this, &EC2Client::DescribeSpotFleetRequestHistory, request,
+    [](const DescribeSpotFleetRequestHistoryRequest& current, const DescribeSpotFleetRequestHistoryOutcome& outcome, DescribeSpotFleetRequestHistoryRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeSpotFleetRequestsRequest, DescribeSpotFleetRequestsOutcome> EC2Client::DescribeSpotFleetRequestsPaginator(const DescribeSpotFleetRequestsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeSpotFleetRequestsRequest, DescribeSpotFleetRequestsOutcome>(this, &EC2Client::DescribeSpotFleetRequests, request,
+    [](const DescribeSpotFleetRequestsRequest& current, const DescribeSpotFleetRequestsOutcome& outcome, DescribeSpotFleetRequestsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeSpotPriceHistoryRequest, DescribeSpotPriceHistoryOutcome> EC2Client::DescribeSpotPriceHistoryPaginator(const DescribeSpotPriceHistoryRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeSpotPriceHistoryRequest, DescribeSpotPriceHistoryOutcome>(this, &EC2Client::DescribeSpotPriceHistory, request,
+    [](const DescribeSpotPriceHistoryRequest& current, const DescribeSpotPriceHistoryOutcome& outcome, DescribeSpotPriceHistoryRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeStaleSecurityGroupsRequest, DescribeStaleSecurityGroupsOutcome> EC2Client::DescribeStaleSecurityGroupsPaginator(const DescribeStaleSecurityGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeStaleSecurityGroupsRequest, DescribeStaleSecurityGroupsOutcome>(this, &EC2Client::DescribeStaleSecurityGroups, request,
+    [](const DescribeStaleSecurityGroupsRequest& current, const DescribeStaleSecurityGroupsOutcome& outcome, DescribeStaleSecurityGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeTagsRequest, DescribeTagsOutcome> EC2Client::DescribeTagsPaginator(const DescribeTagsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeTagsRequest, DescribeTagsOutcome>(this, &EC2Client::DescribeTags, request,
+    [](const DescribeTagsRequest& current, const DescribeTagsOutcome& outcome, DescribeTagsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeVolumeStatusRequest, DescribeVolumeStatusOutcome> EC2Client::DescribeVolumeStatusPaginator(const DescribeVolumeStatusRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeVolumeStatusRequest, DescribeVolumeStatusOutcome>(this, &EC2Client::DescribeVolumeStatus, request,
+    [](const DescribeVolumeStatusRequest& current, const DescribeVolumeStatusOutcome& outcome, DescribeVolumeStatusRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeVolumesRequest, DescribeVolumesOutcome> EC2Client::DescribeVolumesPaginator(const DescribeVolumesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeVolumesRequest, DescribeVolumesOutcome>(this, &EC2Client::DescribeVolumes, request,
+    [](const DescribeVolumesRequest& current, const DescribeVolumesOutcome& outcome, DescribeVolumesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeVpcClassicLinkDnsSupportRequest, DescribeVpcClassicLinkDnsSupportOutcome> EC2Client::DescribeVpcClassicLinkDnsSupportPaginator(const DescribeVpcClassicLinkDnsSupportRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeVpcClassicLinkDnsSupportRequest, DescribeVpcClassicLinkDnsSupportOutcome>(this, &EC2Client::DescribeVpcClassicLinkDnsSupport, request,
+    [](const DescribeVpcClassicLinkDnsSupportRequest& current, const DescribeVpcClassicLinkDnsSupportOutcome& outcome, DescribeVpcClassicLinkDnsSupportRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeVpcEndpointServicesRequest, DescribeVpcEndpointServicesOutcome> EC2Client::DescribeVpcEndpointServicesPaginator(const DescribeVpcEndpointServicesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeVpcEndpointServicesRequest, DescribeVpcEndpointServicesOutcome>(this, &EC2Client::DescribeVpcEndpointServices, request,
+    [](const DescribeVpcEndpointServicesRequest& current, const DescribeVpcEndpointServicesOutcome& outcome, DescribeVpcEndpointServicesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EC2Client, DescribeVpcEndpointsRequest, DescribeVpcEndpointsOutcome> EC2Client::DescribeVpcEndpointsPaginator(const DescribeVpcEndpointsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EC2Client, DescribeVpcEndpointsRequest, DescribeVpcEndpointsOutcome>(this, &EC2Client::DescribeVpcEndpoints, request,
+    [](const DescribeVpcEndpointsRequest& current, const DescribeVpcEndpointsOutcome& outcome, DescribeVpcEndpointsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<EC2Client, AcceptVpcPeeringConnectionRequest, AcceptVpcPeeringConnectionOutcome> EC2Client::AcceptVpcPeeringConnectionAwaitable(AcceptVpcPeeringConnectionRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::AcceptVpcPeeringConnection, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, AllocateAddressRequest, AllocateAddressOutcome> EC2Client::AllocateAddressAwaitable(AllocateAddressRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::AllocateAddress, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, AllocateHostsRequest, AllocateHostsOutcome> EC2Client::AllocateHostsAwaitable(AllocateHostsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::AllocateHosts, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, AssignPrivateIpAddressesRequest, AssignPrivateIpAddressesOutcome> EC2Client::AssignPrivateIpAddressesAwaitable(AssignPrivateIpAddressesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::AssignPrivateIpAddresses, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, AssociateAddressRequest, AssociateAddressOutcome> EC2Client::AssociateAddressAwaitable(AssociateAddressRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::AssociateAddress, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, AssociateDhcpOptionsRequest, AssociateDhcpOptionsOutcome> EC2Client::AssociateDhcpOptionsAwaitable(AssociateDhcpOptionsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::AssociateDhcpOptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, AssociateRouteTableRequest, AssociateRouteTableOutcome> EC2Client::AssociateRouteTableAwaitable(AssociateRouteTableRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::AssociateRouteTable, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, AttachClassicLinkVpcRequest, AttachClassicLinkVpcOutcome> EC2Client::AttachClassicLinkVpcAwaitable(AttachClassicLinkVpcRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::AttachClassicLinkVpc, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, AttachInternetGatewayRequest, AttachInternetGatewayOutcome> EC2Client::AttachInternetGatewayAwaitable(AttachInternetGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::AttachInternetGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, AttachNetworkInterfaceRequest, AttachNetworkInterfaceOutcome> EC2Client::AttachNetworkInterfaceAwaitable(AttachNetworkInterfaceRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::AttachNetworkInterface, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, AttachVolumeRequest, AttachVolumeOutcome> EC2Client::AttachVolumeAwaitable(AttachVolumeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::AttachVolume, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, AttachVpnGatewayRequest, AttachVpnGatewayOutcome> EC2Client::AttachVpnGatewayAwaitable(AttachVpnGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::AttachVpnGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, AuthorizeSecurityGroupEgressRequest, AuthorizeSecurityGroupEgressOutcome> EC2Client::AuthorizeSecurityGroupEgressAwaitable(AuthorizeSecurityGroupEgressRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::AuthorizeSecurityGroupEgress, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, AuthorizeSecurityGroupIngressRequest, AuthorizeSecurityGroupIngressOutcome> EC2Client::AuthorizeSecurityGroupIngressAwaitable(AuthorizeSecurityGroupIngressRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::AuthorizeSecurityGroupIngress, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, BundleInstanceRequest, BundleInstanceOutcome> EC2Client::BundleInstanceAwaitable(BundleInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::BundleInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CancelBundleTaskRequest, CancelBundleTaskOutcome> EC2Client::CancelBundleTaskAwaitable(CancelBundleTaskRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CancelBundleTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CancelConversionTaskRequest, CancelConversionTaskOutcome> EC2Client::CancelConversionTaskAwaitable(CancelConversionTaskRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CancelConversionTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CancelExportTaskRequest, CancelExportTaskOutcome> EC2Client::CancelExportTaskAwaitable(CancelExportTaskRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CancelExportTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CancelImportTaskRequest, CancelImportTaskOutcome> EC2Client::CancelImportTaskAwaitable(CancelImportTaskRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CancelImportTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CancelReservedInstancesListingRequest, CancelReservedInstancesListingOutcome> EC2Client::CancelReservedInstancesListingAwaitable(CancelReservedInstancesListingRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CancelReservedInstancesListing, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CancelSpotFleetRequestsRequest, CancelSpotFleetRequestsOutcome> EC2Client::CancelSpotFleetRequestsAwaitable(CancelSpotFleetRequestsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CancelSpotFleetRequests, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CancelSpotInstanceRequestsRequest, CancelSpotInstanceRequestsOutcome> EC2Client::CancelSpotInstanceRequestsAwaitable(CancelSpotInstanceRequestsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CancelSpotInstanceRequests, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ConfirmProductInstanceRequest, ConfirmProductInstanceOutcome> EC2Client::ConfirmProductInstanceAwaitable(ConfirmProductInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ConfirmProductInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CopyImageRequest, CopyImageOutcome> EC2Client::CopyImageAwaitable(CopyImageRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CopyImage, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CopySnapshotRequest, CopySnapshotOutcome> EC2Client::CopySnapshotAwaitable(CopySnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CopySnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateCustomerGatewayRequest, CreateCustomerGatewayOutcome> EC2Client::CreateCustomerGatewayAwaitable(CreateCustomerGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateCustomerGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateDhcpOptionsRequest, CreateDhcpOptionsOutcome> EC2Client::CreateDhcpOptionsAwaitable(CreateDhcpOptionsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateDhcpOptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateFlowLogsRequest, CreateFlowLogsOutcome> EC2Client::CreateFlowLogsAwaitable(CreateFlowLogsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateFlowLogs, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateImageRequest, CreateImageOutcome> EC2Client::CreateImageAwaitable(CreateImageRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateImage, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateInstanceExportTaskRequest, CreateInstanceExportTaskOutcome> EC2Client::CreateInstanceExportTaskAwaitable(CreateInstanceExportTaskRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateInstanceExportTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateInternetGatewayRequest, CreateInternetGatewayOutcome> EC2Client::CreateInternetGatewayAwaitable(CreateInternetGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateInternetGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateKeyPairRequest, CreateKeyPairOutcome> EC2Client::CreateKeyPairAwaitable(CreateKeyPairRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateKeyPair, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateNatGatewayRequest, CreateNatGatewayOutcome> EC2Client::CreateNatGatewayAwaitable(CreateNatGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateNatGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateNetworkAclRequest, CreateNetworkAclOutcome> EC2Client::CreateNetworkAclAwaitable(CreateNetworkAclRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateNetworkAcl, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateNetworkAclEntryRequest, CreateNetworkAclEntryOutcome> EC2Client::CreateNetworkAclEntryAwaitable(CreateNetworkAclEntryRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateNetworkAclEntry, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateNetworkInterfaceRequest, CreateNetworkInterfaceOutcome> EC2Client::CreateNetworkInterfaceAwaitable(CreateNetworkInterfaceRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateNetworkInterface, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreatePlacementGroupRequest, CreatePlacementGroupOutcome> EC2Client::CreatePlacementGroupAwaitable(CreatePlacementGroupRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreatePlacementGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateReservedInstancesListingRequest, CreateReservedInstancesListingOutcome> EC2Client::CreateReservedInstancesListingAwaitable(CreateReservedInstancesListingRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateReservedInstancesListing, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateRouteRequest, CreateRouteOutcome> EC2Client::CreateRouteAwaitable(CreateRouteRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateRoute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateRouteTableRequest, CreateRouteTableOutcome> EC2Client::CreateRouteTableAwaitable(CreateRouteTableRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateRouteTable, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateSecurityGroupRequest, CreateSecurityGroupOutcome> EC2Client::CreateSecurityGroupAwaitable(CreateSecurityGroupRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateSecurityGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateSnapshotRequest, CreateSnapshotOutcome> EC2Client::CreateSnapshotAwaitable(CreateSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateSpotDatafeedSubscriptionRequest, CreateSpotDatafeedSubscriptionOutcome> EC2Client::CreateSpotDatafeedSubscriptionAwaitable(CreateSpotDatafeedSubscriptionRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateSpotDatafeedSubscription, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateSubnetRequest, CreateSubnetOutcome> EC2Client::CreateSubnetAwaitable(CreateSubnetRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateSubnet, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateTagsRequest, CreateTagsOutcome> EC2Client::CreateTagsAwaitable(CreateTagsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateVolumeRequest, CreateVolumeOutcome> EC2Client::CreateVolumeAwaitable(CreateVolumeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateVolume, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateVpcRequest, CreateVpcOutcome> EC2Client::CreateVpcAwaitable(CreateVpcRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateVpc, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateVpcEndpointRequest, CreateVpcEndpointOutcome> EC2Client::CreateVpcEndpointAwaitable(CreateVpcEndpointRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateVpcEndpoint, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateVpcPeeringConnectionRequest, CreateVpcPeeringConnectionOutcome> EC2Client::CreateVpcPeeringConnectionAwaitable(CreateVpcPeeringConnectionRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateVpcPeeringConnection, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateVpnConnectionRequest, CreateVpnConnectionOutcome> EC2Client::CreateVpnConnectionAwaitable(CreateVpnConnectionRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateVpnConnection, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateVpnConnectionRouteRequest, CreateVpnConnectionRouteOutcome> EC2Client::CreateVpnConnectionRouteAwaitable(CreateVpnConnectionRouteRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateVpnConnectionRoute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, CreateVpnGatewayRequest, CreateVpnGatewayOutcome> EC2Client::CreateVpnGatewayAwaitable(CreateVpnGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::CreateVpnGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteCustomerGatewayRequest, DeleteCustomerGatewayOutcome> EC2Client::DeleteCustomerGatewayAwaitable(DeleteCustomerGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteCustomerGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteDhcpOptionsRequest, DeleteDhcpOptionsOutcome> EC2Client::DeleteDhcpOptionsAwaitable(DeleteDhcpOptionsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteDhcpOptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteFlowLogsRequest, DeleteFlowLogsOutcome> EC2Client::DeleteFlowLogsAwaitable(DeleteFlowLogsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteFlowLogs, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteInternetGatewayRequest, DeleteInternetGatewayOutcome> EC2Client::DeleteInternetGatewayAwaitable(DeleteInternetGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteInternetGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteKeyPairRequest, DeleteKeyPairOutcome> EC2Client::DeleteKeyPairAwaitable(DeleteKeyPairRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteKeyPair, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteNatGatewayRequest, DeleteNatGatewayOutcome> EC2Client::DeleteNatGatewayAwaitable(DeleteNatGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteNatGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteNetworkAclRequest, DeleteNetworkAclOutcome> EC2Client::DeleteNetworkAclAwaitable(DeleteNetworkAclRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteNetworkAcl, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteNetworkAclEntryRequest, DeleteNetworkAclEntryOutcome> EC2Client::DeleteNetworkAclEntryAwaitable(DeleteNetworkAclEntryRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteNetworkAclEntry, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteNetworkInterfaceRequest, DeleteNetworkInterfaceOutcome> EC2Client::DeleteNetworkInterfaceAwaitable(DeleteNetworkInterfaceRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteNetworkInterface, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeletePlacementGroupRequest, DeletePlacementGroupOutcome> EC2Client::DeletePlacementGroupAwaitable(DeletePlacementGroupRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeletePlacementGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteRouteRequest, DeleteRouteOutcome> EC2Client::DeleteRouteAwaitable(DeleteRouteRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteRoute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteRouteTableRequest, DeleteRouteTableOutcome> EC2Client::DeleteRouteTableAwaitable(DeleteRouteTableRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteRouteTable, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteSecurityGroupRequest, DeleteSecurityGroupOutcome> EC2Client::DeleteSecurityGroupAwaitable(DeleteSecurityGroupRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteSecurityGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteSnapshotRequest, DeleteSnapshotOutcome> EC2Client::DeleteSnapshotAwaitable(DeleteSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteSpotDatafeedSubscriptionRequest, DeleteSpotDatafeedSubscriptionOutcome> EC2Client::DeleteSpotDatafeedSubscriptionAwaitable(DeleteSpotDatafeedSubscriptionRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteSpotDatafeedSubscription, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteSubnetRequest, DeleteSubnetOutcome> EC2Client::DeleteSubnetAwaitable(DeleteSubnetRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteSubnet, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteTagsRequest, DeleteTagsOutcome> EC2Client::DeleteTagsAwaitable(DeleteTagsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteVolumeRequest, DeleteVolumeOutcome> EC2Client::DeleteVolumeAwaitable(DeleteVolumeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteVolume, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteVpcRequest, DeleteVpcOutcome> EC2Client::DeleteVpcAwaitable(DeleteVpcRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteVpc, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteVpcEndpointsRequest, DeleteVpcEndpointsOutcome> EC2Client::DeleteVpcEndpointsAwaitable(DeleteVpcEndpointsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteVpcEndpoints, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteVpcPeeringConnectionRequest, DeleteVpcPeeringConnectionOutcome> EC2Client::DeleteVpcPeeringConnectionAwaitable(DeleteVpcPeeringConnectionRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteVpcPeeringConnection, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteVpnConnectionRequest, DeleteVpnConnectionOutcome> EC2Client::DeleteVpnConnectionAwaitable(DeleteVpnConnectionRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteVpnConnection, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteVpnConnectionRouteRequest, DeleteVpnConnectionRouteOutcome> EC2Client::DeleteVpnConnectionRouteAwaitable(DeleteVpnConnectionRouteRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteVpnConnectionRoute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeleteVpnGatewayRequest, DeleteVpnGatewayOutcome> EC2Client::DeleteVpnGatewayAwaitable(DeleteVpnGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeleteVpnGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DeregisterImageRequest, DeregisterImageOutcome> EC2Client::DeregisterImageAwaitable(DeregisterImageRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DeregisterImage, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeAccountAttributesRequest, DescribeAccountAttributesOutcome> EC2Client::DescribeAccountAttributesAwaitable(DescribeAccountAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeAccountAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeAddressesRequest, DescribeAddressesOutcome> EC2Client::DescribeAddressesAwaitable(DescribeAddressesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeAddresses, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeAvailabilityZonesRequest, DescribeAvailabilityZonesOutcome> EC2Client::DescribeAvailabilityZonesAwaitable(DescribeAvailabilityZonesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeAvailabilityZones, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeBundleTasksRequest, DescribeBundleTasksOutcome> EC2Client::DescribeBundleTasksAwaitable(DescribeBundleTasksRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeBundleTasks, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeClassicLinkInstancesRequest, DescribeClassicLinkInstancesOutcome> EC2Client::DescribeClassicLinkInstancesAwaitable(DescribeClassicLinkInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeClassicLinkInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeConversionTasksRequest, DescribeConversionTasksOutcome> EC2Client::DescribeConversionTasksAwaitable(DescribeConversionTasksRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeConversionTasks, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeCustomerGatewaysRequest, DescribeCustomerGatewaysOutcome> EC2Client::DescribeCustomerGatewaysAwaitable(DescribeCustomerGatewaysRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeCustomerGateways, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeDhcpOptionsRequest, DescribeDhcpOptionsOutcome> EC2Client::DescribeDhcpOptionsAwaitable(DescribeDhcpOptionsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeDhcpOptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeExportTasksRequest, DescribeExportTasksOutcome> EC2Client::DescribeExportTasksAwaitable(DescribeExportTasksRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeExportTasks, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeFlowLogsRequest, DescribeFlowLogsOutcome> EC2Client::DescribeFlowLogsAwaitable(DescribeFlowLogsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeFlowLogs, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeHostsRequest, DescribeHostsOutcome> EC2Client::DescribeHostsAwaitable(DescribeHostsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeHosts, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeIdFormatRequest, DescribeIdFormatOutcome> EC2Client::DescribeIdFormatAwaitable(DescribeIdFormatRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeIdFormat, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeImageAttributeRequest, DescribeImageAttributeOutcome> EC2Client::DescribeImageAttributeAwaitable(DescribeImageAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeImageAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeImagesRequest, DescribeImagesOutcome> EC2Client::DescribeImagesAwaitable(DescribeImagesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeImages, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeImportImageTasksRequest, DescribeImportImageTasksOutcome> EC2Client::DescribeImportImageTasksAwaitable(DescribeImportImageTasksRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeImportImageTasks, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeImportSnapshotTasksRequest, DescribeImportSnapshotTasksOutcome> EC2Client::DescribeImportSnapshotTasksAwaitable(DescribeImportSnapshotTasksRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeImportSnapshotTasks, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeInstanceAttributeRequest, DescribeInstanceAttributeOutcome> EC2Client::DescribeInstanceAttributeAwaitable(DescribeInstanceAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeInstanceAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeInstanceStatusRequest, DescribeInstanceStatusOutcome> EC2Client::DescribeInstanceStatusAwaitable(DescribeInstanceStatusRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeInstanceStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeInstancesRequest, DescribeInstancesOutcome> EC2Client::DescribeInstancesAwaitable(DescribeInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeInternetGatewaysRequest, DescribeInternetGatewaysOutcome> EC2Client::DescribeInternetGatewaysAwaitable(DescribeInternetGatewaysRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeInternetGateways, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeKeyPairsRequest, DescribeKeyPairsOutcome> EC2Client::DescribeKeyPairsAwaitable(DescribeKeyPairsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeKeyPairs, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeMovingAddressesRequest, DescribeMovingAddressesOutcome> EC2Client::DescribeMovingAddressesAwaitable(DescribeMovingAddressesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeMovingAddresses, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeNatGatewaysRequest, DescribeNatGatewaysOutcome> EC2Client::DescribeNatGatewaysAwaitable(DescribeNatGatewaysRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeNatGateways, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeNetworkAclsRequest, DescribeNetworkAclsOutcome> EC2Client::DescribeNetworkAclsAwaitable(DescribeNetworkAclsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeNetworkAcls, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeNetworkInterfaceAttributeRequest, DescribeNetworkInterfaceAttributeOutcome> EC2Client::DescribeNetworkInterfaceAttributeAwaitable(DescribeNetworkInterfaceAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeNetworkInterfaceAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeNetworkInterfacesRequest, DescribeNetworkInterfacesOutcome> EC2Client::DescribeNetworkInterfacesAwaitable(DescribeNetworkInterfacesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeNetworkInterfaces, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribePlacementGroupsRequest, DescribePlacementGroupsOutcome> EC2Client::DescribePlacementGroupsAwaitable(DescribePlacementGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribePlacementGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribePrefixListsRequest, DescribePrefixListsOutcome> EC2Client::DescribePrefixListsAwaitable(DescribePrefixListsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribePrefixLists, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeRegionsRequest, DescribeRegionsOutcome> EC2Client::DescribeRegionsAwaitable(DescribeRegionsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeRegions, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeReservedInstancesRequest, DescribeReservedInstancesOutcome> EC2Client::DescribeReservedInstancesAwaitable(DescribeReservedInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeReservedInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeReservedInstancesListingsRequest, DescribeReservedInstancesListingsOutcome> EC2Client::DescribeReservedInstancesListingsAwaitable(DescribeReservedInstancesListingsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeReservedInstancesListings, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeReservedInstancesModificationsRequest, DescribeReservedInstancesModificationsOutcome> EC2Client::DescribeReservedInstancesModificationsAwaitable(DescribeReservedInstancesModificationsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeReservedInstancesModifications, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeReservedInstancesOfferingsRequest, DescribeReservedInstancesOfferingsOutcome> EC2Client::DescribeReservedInstancesOfferingsAwaitable(DescribeReservedInstancesOfferingsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeReservedInstancesOfferings, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeRouteTablesRequest, DescribeRouteTablesOutcome> EC2Client::DescribeRouteTablesAwaitable(DescribeRouteTablesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeRouteTables, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeScheduledInstanceAvailabilityRequest, DescribeScheduledInstanceAvailabilityOutcome> EC2Client::DescribeScheduledInstanceAvailabilityAwaitable(DescribeScheduledInstanceAvailabilityRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeScheduledInstanceAvailability, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeScheduledInstancesRequest, DescribeScheduledInstancesOutcome> EC2Client::DescribeScheduledInstancesAwaitable(DescribeScheduledInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeScheduledInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeSecurityGroupReferencesRequest, DescribeSecurityGroupReferencesOutcome> EC2Client::DescribeSecurityGroupReferencesAwaitable(DescribeSecurityGroupReferencesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeSecurityGroupReferences, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeSecurityGroupsRequest, DescribeSecurityGroupsOutcome> EC2Client::DescribeSecurityGroupsAwaitable(DescribeSecurityGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeSecurityGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeSnapshotAttributeRequest, DescribeSnapshotAttributeOutcome> EC2Client::DescribeSnapshotAttributeAwaitable(DescribeSnapshotAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeSnapshotAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeSnapshotsRequest, DescribeSnapshotsOutcome> EC2Client::DescribeSnapshotsAwaitable(DescribeSnapshotsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeSnapshots, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeSpotDatafeedSubscriptionRequest, DescribeSpotDatafeedSubscriptionOutcome> EC2Client::DescribeSpotDatafeedSubscriptionAwaitable(DescribeSpotDatafeedSubscriptionRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeSpotDatafeedSubscription, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeSpotFleetInstancesRequest, DescribeSpotFleetInstancesOutcome> EC2Client::DescribeSpotFleetInstancesAwaitable(DescribeSpotFleetInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeSpotFleetInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeSpotFleetRequestHistoryRequest, DescribeSpotFleetRequestHistoryOutcome> EC2Client::DescribeSpotFleetRequestHistoryAwaitable(DescribeSpotFleetRequestHistoryRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeSpotFleetRequestHistory, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeSpotFleetRequestsRequest, DescribeSpotFleetRequestsOutcome> EC2Client::DescribeSpotFleetRequestsAwaitable(DescribeSpotFleetRequestsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeSpotFleetRequests, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeSpotInstanceRequestsRequest, DescribeSpotInstanceRequestsOutcome> EC2Client::DescribeSpotInstanceRequestsAwaitable(DescribeSpotInstanceRequestsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeSpotInstanceRequests, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeSpotPriceHistoryRequest, DescribeSpotPriceHistoryOutcome> EC2Client::DescribeSpotPriceHistoryAwaitable(DescribeSpotPriceHistoryRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeSpotPriceHistory, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeStaleSecurityGroupsRequest, DescribeStaleSecurityGroupsOutcome> EC2Client::DescribeStaleSecurityGroupsAwaitable(DescribeStaleSecurityGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeStaleSecurityGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeSubnetsRequest, DescribeSubnetsOutcome> EC2Client::DescribeSubnetsAwaitable(DescribeSubnetsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeSubnets, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeTagsRequest, DescribeTagsOutcome> EC2Client::DescribeTagsAwaitable(DescribeTagsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeVolumeAttributeRequest, DescribeVolumeAttributeOutcome> EC2Client::DescribeVolumeAttributeAwaitable(DescribeVolumeAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeVolumeAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeVolumeStatusRequest, DescribeVolumeStatusOutcome> EC2Client::DescribeVolumeStatusAwaitable(DescribeVolumeStatusRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeVolumeStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeVolumesRequest, DescribeVolumesOutcome> EC2Client::DescribeVolumesAwaitable(DescribeVolumesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeVolumes, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeVpcAttributeRequest, DescribeVpcAttributeOutcome> EC2Client::DescribeVpcAttributeAwaitable(DescribeVpcAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeVpcAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeVpcClassicLinkRequest, DescribeVpcClassicLinkOutcome> EC2Client::DescribeVpcClassicLinkAwaitable(DescribeVpcClassicLinkRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeVpcClassicLink, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeVpcClassicLinkDnsSupportRequest, DescribeVpcClassicLinkDnsSupportOutcome> EC2Client::DescribeVpcClassicLinkDnsSupportAwaitable(DescribeVpcClassicLinkDnsSupportRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeVpcClassicLinkDnsSupport, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeVpcEndpointServicesRequest, DescribeVpcEndpointServicesOutcome> EC2Client::DescribeVpcEndpointServicesAwaitable(DescribeVpcEndpointServicesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeVpcEndpointServices, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeVpcEndpointsRequest, DescribeVpcEndpointsOutcome> EC2Client::DescribeVpcEndpointsAwaitable(DescribeVpcEndpointsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeVpcEndpoints, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeVpcPeeringConnectionsRequest, DescribeVpcPeeringConnectionsOutcome> EC2Client::DescribeVpcPeeringConnectionsAwaitable(DescribeVpcPeeringConnectionsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeVpcPeeringConnections, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeVpcsRequest, DescribeVpcsOutcome> EC2Client::DescribeVpcsAwaitable(DescribeVpcsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeVpcs, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeVpnConnectionsRequest, DescribeVpnConnectionsOutcome> EC2Client::DescribeVpnConnectionsAwaitable(DescribeVpnConnectionsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeVpnConnections, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DescribeVpnGatewaysRequest, DescribeVpnGatewaysOutcome> EC2Client::DescribeVpnGatewaysAwaitable(DescribeVpnGatewaysRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DescribeVpnGateways, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DetachClassicLinkVpcRequest, DetachClassicLinkVpcOutcome> EC2Client::DetachClassicLinkVpcAwaitable(DetachClassicLinkVpcRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DetachClassicLinkVpc, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DetachInternetGatewayRequest, DetachInternetGatewayOutcome> EC2Client::DetachInternetGatewayAwaitable(DetachInternetGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DetachInternetGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DetachNetworkInterfaceRequest, DetachNetworkInterfaceOutcome> EC2Client::DetachNetworkInterfaceAwaitable(DetachNetworkInterfaceRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DetachNetworkInterface, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DetachVolumeRequest, DetachVolumeOutcome> EC2Client::DetachVolumeAwaitable(DetachVolumeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DetachVolume, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DetachVpnGatewayRequest, DetachVpnGatewayOutcome> EC2Client::DetachVpnGatewayAwaitable(DetachVpnGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DetachVpnGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DisableVgwRoutePropagationRequest, DisableVgwRoutePropagationOutcome> EC2Client::DisableVgwRoutePropagationAwaitable(DisableVgwRoutePropagationRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DisableVgwRoutePropagation, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DisableVpcClassicLinkRequest, DisableVpcClassicLinkOutcome> EC2Client::DisableVpcClassicLinkAwaitable(DisableVpcClassicLinkRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DisableVpcClassicLink, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DisableVpcClassicLinkDnsSupportRequest, DisableVpcClassicLinkDnsSupportOutcome> EC2Client::DisableVpcClassicLinkDnsSupportAwaitable(DisableVpcClassicLinkDnsSupportRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DisableVpcClassicLinkDnsSupport, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DisassociateAddressRequest, DisassociateAddressOutcome> EC2Client::DisassociateAddressAwaitable(DisassociateAddressRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DisassociateAddress, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, DisassociateRouteTableRequest, DisassociateRouteTableOutcome> EC2Client::DisassociateRouteTableAwaitable(DisassociateRouteTableRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::DisassociateRouteTable, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, EnableVgwRoutePropagationRequest, EnableVgwRoutePropagationOutcome> EC2Client::EnableVgwRoutePropagationAwaitable(EnableVgwRoutePropagationRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::EnableVgwRoutePropagation, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, EnableVolumeIORequest, EnableVolumeIOOutcome> EC2Client::EnableVolumeIOAwaitable(EnableVolumeIORequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::EnableVolumeIO, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, EnableVpcClassicLinkRequest, EnableVpcClassicLinkOutcome> EC2Client::EnableVpcClassicLinkAwaitable(EnableVpcClassicLinkRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::EnableVpcClassicLink, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, EnableVpcClassicLinkDnsSupportRequest, EnableVpcClassicLinkDnsSupportOutcome> EC2Client::EnableVpcClassicLinkDnsSupportAwaitable(EnableVpcClassicLinkDnsSupportRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::EnableVpcClassicLinkDnsSupport, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, GetConsoleOutputRequest, GetConsoleOutputOutcome> EC2Client::GetConsoleOutputAwaitable(GetConsoleOutputRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::GetConsoleOutput, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, GetConsoleScreenshotRequest, GetConsoleScreenshotOutcome> EC2Client::GetConsoleScreenshotAwaitable(GetConsoleScreenshotRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::GetConsoleScreenshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, GetPasswordDataRequest, GetPasswordDataOutcome> EC2Client::GetPasswordDataAwaitable(GetPasswordDataRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::GetPasswordData, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ImportImageRequest, ImportImageOutcome> EC2Client::ImportImageAwaitable(ImportImageRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ImportImage, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ImportInstanceRequest, ImportInstanceOutcome> EC2Client::ImportInstanceAwaitable(ImportInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ImportInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ImportKeyPairRequest, ImportKeyPairOutcome> EC2Client::ImportKeyPairAwaitable(ImportKeyPairRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ImportKeyPair, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ImportSnapshotRequest, ImportSnapshotOutcome> EC2Client::ImportSnapshotAwaitable(ImportSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ImportSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ImportVolumeRequest, ImportVolumeOutcome> EC2Client::ImportVolumeAwaitable(ImportVolumeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ImportVolume, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ModifyHostsRequest, ModifyHostsOutcome> EC2Client::ModifyHostsAwaitable(ModifyHostsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ModifyHosts, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ModifyIdFormatRequest, ModifyIdFormatOutcome> EC2Client::ModifyIdFormatAwaitable(ModifyIdFormatRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ModifyIdFormat, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ModifyImageAttributeRequest, ModifyImageAttributeOutcome> EC2Client::ModifyImageAttributeAwaitable(ModifyImageAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ModifyImageAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ModifyInstanceAttributeRequest, ModifyInstanceAttributeOutcome> EC2Client::ModifyInstanceAttributeAwaitable(ModifyInstanceAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ModifyInstanceAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ModifyInstancePlacementRequest, ModifyInstancePlacementOutcome> EC2Client::ModifyInstancePlacementAwaitable(ModifyInstancePlacementRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ModifyInstancePlacement, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ModifyNetworkInterfaceAttributeRequest, ModifyNetworkInterfaceAttributeOutcome> EC2Client::ModifyNetworkInterfaceAttributeAwaitable(ModifyNetworkInterfaceAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ModifyNetworkInterfaceAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ModifyReservedInstancesRequest, ModifyReservedInstancesOutcome> EC2Client::ModifyReservedInstancesAwaitable(ModifyReservedInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ModifyReservedInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ModifySnapshotAttributeRequest, ModifySnapshotAttributeOutcome> EC2Client::ModifySnapshotAttributeAwaitable(ModifySnapshotAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ModifySnapshotAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ModifySpotFleetRequestRequest, ModifySpotFleetRequestOutcome> EC2Client::ModifySpotFleetRequestAwaitable(ModifySpotFleetRequestRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ModifySpotFleetRequest, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ModifySubnetAttributeRequest, ModifySubnetAttributeOutcome> EC2Client::ModifySubnetAttributeAwaitable(ModifySubnetAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ModifySubnetAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ModifyVolumeAttributeRequest, ModifyVolumeAttributeOutcome> EC2Client::ModifyVolumeAttributeAwaitable(ModifyVolumeAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ModifyVolumeAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ModifyVpcAttributeRequest, ModifyVpcAttributeOutcome> EC2Client::ModifyVpcAttributeAwaitable(ModifyVpcAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ModifyVpcAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ModifyVpcEndpointRequest, ModifyVpcEndpointOutcome> EC2Client::ModifyVpcEndpointAwaitable(ModifyVpcEndpointRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ModifyVpcEndpoint, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ModifyVpcPeeringConnectionOptionsRequest, ModifyVpcPeeringConnectionOptionsOutcome> EC2Client::ModifyVpcPeeringConnectionOptionsAwaitable(ModifyVpcPeeringConnectionOptionsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ModifyVpcPeeringConnectionOptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, MonitorInstancesRequest, MonitorInstancesOutcome> EC2Client::MonitorInstancesAwaitable(MonitorInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::MonitorInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, MoveAddressToVpcRequest, MoveAddressToVpcOutcome> EC2Client::MoveAddressToVpcAwaitable(MoveAddressToVpcRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::MoveAddressToVpc, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, PurchaseReservedInstancesOfferingRequest, PurchaseReservedInstancesOfferingOutcome> EC2Client::PurchaseReservedInstancesOfferingAwaitable(PurchaseReservedInstancesOfferingRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::PurchaseReservedInstancesOffering, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, PurchaseScheduledInstancesRequest, PurchaseScheduledInstancesOutcome> EC2Client::PurchaseScheduledInstancesAwaitable(PurchaseScheduledInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::PurchaseScheduledInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, RebootInstancesRequest, RebootInstancesOutcome> EC2Client::RebootInstancesAwaitable(RebootInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::RebootInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, RegisterImageRequest, RegisterImageOutcome> EC2Client::RegisterImageAwaitable(RegisterImageRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::RegisterImage, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, RejectVpcPeeringConnectionRequest, RejectVpcPeeringConnectionOutcome> EC2Client::RejectVpcPeeringConnectionAwaitable(RejectVpcPeeringConnectionRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::RejectVpcPeeringConnection, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ReleaseAddressRequest, ReleaseAddressOutcome> EC2Client::ReleaseAddressAwaitable(ReleaseAddressRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ReleaseAddress, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ReleaseHostsRequest, ReleaseHostsOutcome> EC2Client::ReleaseHostsAwaitable(ReleaseHostsRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ReleaseHosts, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ReplaceNetworkAclAssociationRequest, ReplaceNetworkAclAssociationOutcome> EC2Client::ReplaceNetworkAclAssociationAwaitable(ReplaceNetworkAclAssociationRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ReplaceNetworkAclAssociation, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ReplaceNetworkAclEntryRequest, ReplaceNetworkAclEntryOutcome> EC2Client::ReplaceNetworkAclEntryAwaitable(ReplaceNetworkAclEntryRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ReplaceNetworkAclEntry, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ReplaceRouteRequest, ReplaceRouteOutcome> EC2Client::ReplaceRouteAwaitable(ReplaceRouteRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ReplaceRoute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ReplaceRouteTableAssociationRequest, ReplaceRouteTableAssociationOutcome> EC2Client::ReplaceRouteTableAssociationAwaitable(ReplaceRouteTableAssociationRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ReplaceRouteTableAssociation, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ReportInstanceStatusRequest, ReportInstanceStatusOutcome> EC2Client::ReportInstanceStatusAwaitable(ReportInstanceStatusRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ReportInstanceStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, RequestSpotFleetRequest, RequestSpotFleetOutcome> EC2Client::RequestSpotFleetAwaitable(RequestSpotFleetRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::RequestSpotFleet, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, RequestSpotInstancesRequest, RequestSpotInstancesOutcome> EC2Client::RequestSpotInstancesAwaitable(RequestSpotInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::RequestSpotInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ResetImageAttributeRequest, ResetImageAttributeOutcome> EC2Client::ResetImageAttributeAwaitable(ResetImageAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ResetImageAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ResetInstanceAttributeRequest, ResetInstanceAttributeOutcome> EC2Client::ResetInstanceAttributeAwaitable(ResetInstanceAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ResetInstanceAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ResetNetworkInterfaceAttributeRequest, ResetNetworkInterfaceAttributeOutcome> EC2Client::ResetNetworkInterfaceAttributeAwaitable(ResetNetworkInterfaceAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ResetNetworkInterfaceAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, ResetSnapshotAttributeRequest, ResetSnapshotAttributeOutcome> EC2Client::ResetSnapshotAttributeAwaitable(ResetSnapshotAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::ResetSnapshotAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, RestoreAddressToClassicRequest, RestoreAddressToClassicOutcome> EC2Client::RestoreAddressToClassicAwaitable(RestoreAddressToClassicRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::RestoreAddressToClassic, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, RevokeSecurityGroupEgressRequest, RevokeSecurityGroupEgressOutcome> EC2Client::RevokeSecurityGroupEgressAwaitable(RevokeSecurityGroupEgressRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::RevokeSecurityGroupEgress, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, RevokeSecurityGroupIngressRequest, RevokeSecurityGroupIngressOutcome> EC2Client::RevokeSecurityGroupIngressAwaitable(RevokeSecurityGroupIngressRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::RevokeSecurityGroupIngress, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, RunInstancesRequest, RunInstancesOutcome> EC2Client::RunInstancesAwaitable(RunInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::RunInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, RunScheduledInstancesRequest, RunScheduledInstancesOutcome> EC2Client::RunScheduledInstancesAwaitable(RunScheduledInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::RunScheduledInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, StartInstancesRequest, StartInstancesOutcome> EC2Client::StartInstancesAwaitable(StartInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::StartInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, StopInstancesRequest, StopInstancesOutcome> EC2Client::StopInstancesAwaitable(StopInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::StopInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, TerminateInstancesRequest, TerminateInstancesOutcome> EC2Client::TerminateInstancesAwaitable(TerminateInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::TerminateInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, UnassignPrivateIpAddressesRequest, UnassignPrivateIpAddressesOutcome> EC2Client::UnassignPrivateIpAddressesAwaitable(UnassignPrivateIpAddressesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::UnassignPrivateIpAddresses, std::move(request) } };
+}
+
+ClientOperationAwaitable<EC2Client, UnmonitorInstancesRequest, UnmonitorInstancesOutcome> EC2Client::UnmonitorInstancesAwaitable(UnmonitorInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EC2Client::UnmonitorInstances, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
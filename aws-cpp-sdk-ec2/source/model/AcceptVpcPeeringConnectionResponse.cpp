@@ -40,7 +40,7 @@ AcceptVpcPeeringConnectionResponse& AcceptVpcPeeringConnectionResponse::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AcceptVpcPeeringConnectionResponse")
+  if (rootNode.GetNameView() != "AcceptVpcPeeringConnectionResponse")
   {
     resultNode = rootNode.FirstChild("AcceptVpcPeeringConnectionResponse");
   }
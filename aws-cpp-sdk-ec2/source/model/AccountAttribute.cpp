@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ AccountAttribute& AccountAttribute::operator =(const XmlNode& xmlNode)
     XmlNode attributeNameNode = resultNode.FirstChild("attributeName");
     if(!attributeNameNode.IsNull())
     {
-      m_attributeName = StringUtils::Trim(attributeNameNode.GetText().c_str());
+      m_attributeName = attributeNameNode.GetTextView().Trim().ToString();
       m_attributeNameHasBeenSet = true;
     }
     XmlNode attributeValuesNode = resultNode.FirstChild("attributeValueSet");
@@ -75,7 +76,7 @@ void AccountAttribute::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_attributeNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AttributeName=" << StringUtils::URLEncode(m_attributeName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AttributeName=" << StringUtils::URLEncoded(m_attributeName) << "&";
   }
 
   if(m_attributeValuesHasBeenSet)
@@ -83,9 +84,9 @@ void AccountAttribute::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned attributeValuesIdx = 1;
       for(auto& item : m_attributeValues)
       {
-        Aws::StringStream attributeValuesSs;
+        Aws::Utils::Stream::StringOutputStream attributeValuesSs;
         attributeValuesSs << location << index << locationValue << ".AttributeValueSet." << attributeValuesIdx++;
-        item.OutputToStream(oStream, attributeValuesSs.str().c_str());
+        item.OutputToStream(oStream, attributeValuesSs.GetString().c_str());
       }
   }
 
@@ -95,16 +96,16 @@ void AccountAttribute::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_attributeNameHasBeenSet)
   {
-      oStream << location << ".AttributeName=" << StringUtils::URLEncode(m_attributeName.c_str()) << "&";
+      oStream << location << ".AttributeName=" << StringUtils::URLEncoded(m_attributeName) << "&";
   }
   if(m_attributeValuesHasBeenSet)
   {
       unsigned attributeValuesIdx = 1;
       for(auto& item : m_attributeValues)
       {
-        Aws::StringStream attributeValuesSs;
+        Aws::Utils::Stream::StringOutputStream attributeValuesSs;
         attributeValuesSs << location <<  ".item." << attributeValuesIdx++;
-        item.OutputToStream(oStream, attributeValuesSs.str().c_str());
+        item.OutputToStream(oStream, attributeValuesSs.GetString().c_str());
       }
   }
 }
@@ -29,21 +29,29 @@ namespace Aws
       namespace AccountAttributeNameMapper
       {
 
-        static const int supported_platforms_HASH = HashingUtils::HashString("supported-platforms");
-        static const int default_vpc_HASH = HashingUtils::HashString("default-vpc");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int supported_platforms_HASH = 2112019457;
+        static const int default_vpc_HASH = -438105251;
 
 
         AccountAttributeName GetAccountAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == supported_platforms_HASH)
+          switch (hashCode)
           {
+          case supported_platforms_HASH:
             return AccountAttributeName::supported_platforms;
-          }
-          else if (hashCode == default_vpc_HASH)
-          {
+          case default_vpc_HASH:
             return AccountAttributeName::default_vpc;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -49,7 +49,7 @@ AccountAttributeValue& AccountAttributeValue::operator =(const XmlNode& xmlNode)
     XmlNode attributeValueNode = resultNode.FirstChild("attributeValue");
     if(!attributeValueNode.IsNull())
     {
-      m_attributeValue = StringUtils::Trim(attributeValueNode.GetText().c_str());
+      m_attributeValue = attributeValueNode.GetTextView().Trim().ToString();
       m_attributeValueHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void AccountAttributeValue::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_attributeValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AttributeValue=" << StringUtils::URLEncode(m_attributeValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".AttributeValue=" << StringUtils::URLEncoded(m_attributeValue) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void AccountAttributeValue::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_attributeValueHasBeenSet)
   {
-      oStream << location << ".AttributeValue=" << StringUtils::URLEncode(m_attributeValue.c_str()) << "&";
+      oStream << location << ".AttributeValue=" << StringUtils::URLEncoded(m_attributeValue) << "&";
   }
 }
 
@@ -53,19 +53,19 @@ ActiveInstance& ActiveInstance::operator =(const XmlNode& xmlNode)
     XmlNode instanceTypeNode = resultNode.FirstChild("instanceType");
     if(!instanceTypeNode.IsNull())
     {
-      m_instanceType = StringUtils::Trim(instanceTypeNode.GetText().c_str());
+      m_instanceType = instanceTypeNode.GetTextView().Trim().ToString();
       m_instanceTypeHasBeenSet = true;
     }
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode spotInstanceRequestIdNode = resultNode.FirstChild("spotInstanceRequestId");
     if(!spotInstanceRequestIdNode.IsNull())
     {
-      m_spotInstanceRequestId = StringUtils::Trim(spotInstanceRequestIdNode.GetText().c_str());
+      m_spotInstanceRequestId = spotInstanceRequestIdNode.GetTextView().Trim().ToString();
       m_spotInstanceRequestIdHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void ActiveInstance::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
 
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_spotInstanceRequestIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SpotInstanceRequestId=" << StringUtils::URLEncode(m_spotInstanceRequestId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SpotInstanceRequestId=" << StringUtils::URLEncoded(m_spotInstanceRequestId) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void ActiveInstance::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_spotInstanceRequestIdHasBeenSet)
   {
-      oStream << location << ".SpotInstanceRequestId=" << StringUtils::URLEncode(m_spotInstanceRequestId.c_str()) << "&";
+      oStream << location << ".SpotInstanceRequestId=" << StringUtils::URLEncoded(m_spotInstanceRequestId) << "&";
   }
 }
 
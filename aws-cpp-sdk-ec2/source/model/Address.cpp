@@ -63,49 +63,49 @@ Address& Address::operator =(const XmlNode& xmlNode)
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode publicIpNode = resultNode.FirstChild("publicIp");
     if(!publicIpNode.IsNull())
     {
-      m_publicIp = StringUtils::Trim(publicIpNode.GetText().c_str());
+      m_publicIp = publicIpNode.GetTextView().Trim().ToString();
       m_publicIpHasBeenSet = true;
     }
     XmlNode allocationIdNode = resultNode.FirstChild("allocationId");
     if(!allocationIdNode.IsNull())
     {
-      m_allocationId = StringUtils::Trim(allocationIdNode.GetText().c_str());
+      m_allocationId = allocationIdNode.GetTextView().Trim().ToString();
       m_allocationIdHasBeenSet = true;
     }
     XmlNode associationIdNode = resultNode.FirstChild("associationId");
     if(!associationIdNode.IsNull())
     {
-      m_associationId = StringUtils::Trim(associationIdNode.GetText().c_str());
+      m_associationId = associationIdNode.GetTextView().Trim().ToString();
       m_associationIdHasBeenSet = true;
     }
     XmlNode domainNode = resultNode.FirstChild("domain");
     if(!domainNode.IsNull())
     {
-      m_domain = DomainTypeMapper::GetDomainTypeForName(StringUtils::Trim(domainNode.GetText().c_str()).c_str());
+      m_domain = DomainTypeMapper::GetDomainTypeForName(domainNode.GetTextView().Trim().ToString().c_str());
       m_domainHasBeenSet = true;
     }
     XmlNode networkInterfaceIdNode = resultNode.FirstChild("networkInterfaceId");
     if(!networkInterfaceIdNode.IsNull())
     {
-      m_networkInterfaceId = StringUtils::Trim(networkInterfaceIdNode.GetText().c_str());
+      m_networkInterfaceId = networkInterfaceIdNode.GetTextView().Trim().ToString();
       m_networkInterfaceIdHasBeenSet = true;
     }
     XmlNode networkInterfaceOwnerIdNode = resultNode.FirstChild("networkInterfaceOwnerId");
     if(!networkInterfaceOwnerIdNode.IsNull())
     {
-      m_networkInterfaceOwnerId = StringUtils::Trim(networkInterfaceOwnerIdNode.GetText().c_str());
+      m_networkInterfaceOwnerId = networkInterfaceOwnerIdNode.GetTextView().Trim().ToString();
       m_networkInterfaceOwnerIdHasBeenSet = true;
     }
     XmlNode privateIpAddressNode = resultNode.FirstChild("privateIpAddress");
     if(!privateIpAddressNode.IsNull())
     {
-      m_privateIpAddress = StringUtils::Trim(privateIpAddressNode.GetText().c_str());
+      m_privateIpAddress = privateIpAddressNode.GetTextView().Trim().ToString();
       m_privateIpAddressHasBeenSet = true;
     }
   }
@@ -117,22 +117,22 @@ void Address::OutputToStream(Aws::OStream& oStream, const char* location, unsign
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_publicIpHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PublicIp=" << StringUtils::URLEncode(m_publicIp.c_str()) << "&";
+      oStream << location << index << locationValue << ".PublicIp=" << StringUtils::URLEncoded(m_publicIp) << "&";
   }
 
   if(m_allocationIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AllocationId=" << StringUtils::URLEncode(m_allocationId.c_str()) << "&";
+      oStream << location << index << locationValue << ".AllocationId=" << StringUtils::URLEncoded(m_allocationId) << "&";
   }
 
   if(m_associationIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AssociationId=" << StringUtils::URLEncode(m_associationId.c_str()) << "&";
+      oStream << location << index << locationValue << ".AssociationId=" << StringUtils::URLEncoded(m_associationId) << "&";
   }
 
   if(m_domainHasBeenSet)
@@ -142,17 +142,17 @@ void Address::OutputToStream(Aws::OStream& oStream, const char* location, unsign
 
   if(m_networkInterfaceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
 
   if(m_networkInterfaceOwnerIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NetworkInterfaceOwnerId=" << StringUtils::URLEncode(m_networkInterfaceOwnerId.c_str()) << "&";
+      oStream << location << index << locationValue << ".NetworkInterfaceOwnerId=" << StringUtils::URLEncoded(m_networkInterfaceOwnerId) << "&";
   }
 
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
 
 }
@@ -161,19 +161,19 @@ void Address::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_publicIpHasBeenSet)
   {
-      oStream << location << ".PublicIp=" << StringUtils::URLEncode(m_publicIp.c_str()) << "&";
+      oStream << location << ".PublicIp=" << StringUtils::URLEncoded(m_publicIp) << "&";
   }
   if(m_allocationIdHasBeenSet)
   {
-      oStream << location << ".AllocationId=" << StringUtils::URLEncode(m_allocationId.c_str()) << "&";
+      oStream << location << ".AllocationId=" << StringUtils::URLEncoded(m_allocationId) << "&";
   }
   if(m_associationIdHasBeenSet)
   {
-      oStream << location << ".AssociationId=" << StringUtils::URLEncode(m_associationId.c_str()) << "&";
+      oStream << location << ".AssociationId=" << StringUtils::URLEncoded(m_associationId) << "&";
   }
   if(m_domainHasBeenSet)
   {
@@ -181,15 +181,15 @@ void Address::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_networkInterfaceIdHasBeenSet)
   {
-      oStream << location << ".NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+      oStream << location << ".NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
   if(m_networkInterfaceOwnerIdHasBeenSet)
   {
-      oStream << location << ".NetworkInterfaceOwnerId=" << StringUtils::URLEncode(m_networkInterfaceOwnerId.c_str()) << "&";
+      oStream << location << ".NetworkInterfaceOwnerId=" << StringUtils::URLEncoded(m_networkInterfaceOwnerId) << "&";
   }
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
 }
 
@@ -29,21 +29,29 @@ namespace Aws
       namespace AffinityMapper
       {
 
-        static const int default__HASH = HashingUtils::HashString("default");
-        static const int host_HASH = HashingUtils::HashString("host");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int default__HASH = 1544803905;
+        static const int host_HASH = 3208616;
 
 
         Affinity GetAffinityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == default__HASH)
+          switch (hashCode)
           {
+          case default__HASH:
             return Affinity::default_;
-          }
-          else if (hashCode == host_HASH)
-          {
+          case host_HASH:
             return Affinity::host;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/AllocateAddressRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ AllocateAddressRequest::AllocateAddressRequest() :
 
 Aws::String AllocateAddressRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AllocateAddress&";
   if(m_dryRunHasBeenSet)
   {
@@ -41,6 +42,6 @@ Aws::String AllocateAddressRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ AllocateAddressResponse& AllocateAddressResponse::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AllocateAddressResponse")
+  if (rootNode.GetNameView() != "AllocateAddressResponse")
   {
     resultNode = rootNode.FirstChild("AllocateAddressResponse");
   }
@@ -50,17 +50,17 @@ AllocateAddressResponse& AllocateAddressResponse::operator =(const AmazonWebServ
     XmlNode publicIpNode = resultNode.FirstChild("publicIp");
     if(!publicIpNode.IsNull())
     {
-      m_publicIp = StringUtils::Trim(publicIpNode.GetText().c_str());
+      m_publicIp = publicIpNode.GetTextView().Trim().ToString();
     }
     XmlNode domainNode = resultNode.FirstChild("domain");
     if(!domainNode.IsNull())
     {
-      m_domain = DomainTypeMapper::GetDomainTypeForName(StringUtils::Trim(domainNode.GetText().c_str()).c_str());
+      m_domain = DomainTypeMapper::GetDomainTypeForName(domainNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode allocationIdNode = resultNode.FirstChild("allocationId");
     if(!allocationIdNode.IsNull())
     {
-      m_allocationId = StringUtils::Trim(allocationIdNode.GetText().c_str());
+      m_allocationId = allocationIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/AllocateHostsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -31,7 +32,7 @@ AllocateHostsRequest::AllocateHostsRequest() :
 
 Aws::String AllocateHostsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AllocateHosts&";
   if(m_autoPlacementHasBeenSet)
   {
@@ -40,12 +41,12 @@ Aws::String AllocateHostsRequest::SerializePayload() const
 
   if(m_clientTokenHasBeenSet)
   {
-    ss << "ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+    ss << "ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   if(m_instanceTypeHasBeenSet)
   {
-    ss << "InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+    ss << "InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
 
   if(m_quantityHasBeenSet)
@@ -55,10 +56,10 @@ Aws::String AllocateHostsRequest::SerializePayload() const
 
   if(m_availabilityZoneHasBeenSet)
   {
-    ss << "AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+    ss << "AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
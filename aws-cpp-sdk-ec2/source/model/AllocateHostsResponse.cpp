@@ -40,7 +40,7 @@ AllocateHostsResponse& AllocateHostsResponse::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AllocateHostsResponse")
+  if (rootNode.GetNameView() != "AllocateHostsResponse")
   {
     resultNode = rootNode.FirstChild("AllocateHostsResponse");
   }
@@ -53,7 +53,7 @@ AllocateHostsResponse& AllocateHostsResponse::operator =(const AmazonWebServiceR
       XmlNode hostIdsMember = hostIdsNode.FirstChild("item");
       while(!hostIdsMember.IsNull())
       {
-        m_hostIds.push_back(StringUtils::Trim(hostIdsMember.GetText().c_str()));
+        m_hostIds.push_back(hostIdsMember.GetTextView().Trim().ToString());
         hostIdsMember = hostIdsMember.NextNode("item");
       }
 
@@ -29,36 +29,38 @@ namespace Aws
       namespace AllocationStateMapper
       {
 
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int under_assessment_HASH = HashingUtils::HashString("under-assessment");
-        static const int permanent_failure_HASH = HashingUtils::HashString("permanent-failure");
-        static const int released_HASH = HashingUtils::HashString("released");
-        static const int released_permanent_failure_HASH = HashingUtils::HashString("released-permanent-failure");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int available_HASH = -733902135;
+        static const int under_assessment_HASH = 535341271;
+        static const int permanent_failure_HASH = 211344235;
+        static const int released_HASH = -551298755;
+        static const int released_permanent_failure_HASH = -2062123301;
 
 
         AllocationState GetAllocationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == available_HASH)
+          switch (hashCode)
           {
+          case available_HASH:
             return AllocationState::available;
-          }
-          else if (hashCode == under_assessment_HASH)
-          {
+          case under_assessment_HASH:
             return AllocationState::under_assessment;
-          }
-          else if (hashCode == permanent_failure_HASH)
-          {
+          case permanent_failure_HASH:
             return AllocationState::permanent_failure;
-          }
-          else if (hashCode == released_HASH)
-          {
+          case released_HASH:
             return AllocationState::released;
-          }
-          else if (hashCode == released_permanent_failure_HASH)
-          {
+          case released_permanent_failure_HASH:
             return AllocationState::released_permanent_failure;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace AllocationStrategyMapper
       {
 
-        static const int lowestPrice_HASH = HashingUtils::HashString("lowestPrice");
-        static const int diversified_HASH = HashingUtils::HashString("diversified");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int lowestPrice_HASH = 838159031;
+        static const int diversified_HASH = 127033974;
 
 
         AllocationStrategy GetAllocationStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == lowestPrice_HASH)
+          switch (hashCode)
           {
+          case lowestPrice_HASH:
             return AllocationStrategy::lowestPrice;
-          }
-          else if (hashCode == diversified_HASH)
-          {
+          case diversified_HASH:
             return AllocationStrategy::diversified;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
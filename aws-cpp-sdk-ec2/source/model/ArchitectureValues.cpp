@@ -29,21 +29,29 @@ namespace Aws
       namespace ArchitectureValuesMapper
       {
 
-        static const int i386_HASH = HashingUtils::HashString("i386");
-        static const int x86_64_HASH = HashingUtils::HashString("x86_64");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int i386_HASH = 3178856;
+        static const int x86_64_HASH = -806050265;
 
 
         ArchitectureValues GetArchitectureValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == i386_HASH)
+          switch (hashCode)
           {
+          case i386_HASH:
             return ArchitectureValues::i386;
-          }
-          else if (hashCode == x86_64_HASH)
-          {
+          case x86_64_HASH:
             return ArchitectureValues::x86_64;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/AssignPrivateIpAddressesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -31,11 +32,11 @@ AssignPrivateIpAddressesRequest::AssignPrivateIpAddressesRequest() :
 
 Aws::String AssignPrivateIpAddressesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AssignPrivateIpAddresses&";
   if(m_networkInterfaceIdHasBeenSet)
   {
-    ss << "NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+    ss << "NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
 
   if(m_privateIpAddressesHasBeenSet)
@@ -44,7 +45,7 @@ Aws::String AssignPrivateIpAddressesRequest::SerializePayload() const
     for(auto& item : m_privateIpAddresses)
     {
       ss << "PrivateIpAddress." << privateIpAddressesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       privateIpAddressesCount++;
     }
   }
@@ -60,6 +61,6 @@ Aws::String AssignPrivateIpAddressesRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
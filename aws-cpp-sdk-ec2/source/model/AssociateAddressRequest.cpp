@@ -15,6 +15,7 @@
 #include <aws/ec2/model/AssociateAddressRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -34,7 +35,7 @@ AssociateAddressRequest::AssociateAddressRequest() :
 
 Aws::String AssociateAddressRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AssociateAddress&";
   if(m_dryRunHasBeenSet)
   {
@@ -43,27 +44,27 @@ Aws::String AssociateAddressRequest::SerializePayload() const
 
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_publicIpHasBeenSet)
   {
-    ss << "PublicIp=" << StringUtils::URLEncode(m_publicIp.c_str()) << "&";
+    ss << "PublicIp=" << StringUtils::URLEncoded(m_publicIp) << "&";
   }
 
   if(m_allocationIdHasBeenSet)
   {
-    ss << "AllocationId=" << StringUtils::URLEncode(m_allocationId.c_str()) << "&";
+    ss << "AllocationId=" << StringUtils::URLEncoded(m_allocationId) << "&";
   }
 
   if(m_networkInterfaceIdHasBeenSet)
   {
-    ss << "NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+    ss << "NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
 
   if(m_privateIpAddressHasBeenSet)
   {
-    ss << "PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+    ss << "PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
 
   if(m_allowReassociationHasBeenSet)
@@ -72,6 +73,6 @@ Aws::String AssociateAddressRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
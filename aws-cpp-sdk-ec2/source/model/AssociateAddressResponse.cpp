@@ -40,7 +40,7 @@ AssociateAddressResponse& AssociateAddressResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AssociateAddressResponse")
+  if (rootNode.GetNameView() != "AssociateAddressResponse")
   {
     resultNode = rootNode.FirstChild("AssociateAddressResponse");
   }
@@ -50,7 +50,7 @@ AssociateAddressResponse& AssociateAddressResponse::operator =(const AmazonWebSe
     XmlNode associationIdNode = resultNode.FirstChild("associationId");
     if(!associationIdNode.IsNull())
     {
-      m_associationId = StringUtils::Trim(associationIdNode.GetText().c_str());
+      m_associationId = associationIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/AssociateDhcpOptionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ AssociateDhcpOptionsRequest::AssociateDhcpOptionsRequest() :
 
 Aws::String AssociateDhcpOptionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AssociateDhcpOptions&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String AssociateDhcpOptionsRequest::SerializePayload() const
 
   if(m_dhcpOptionsIdHasBeenSet)
   {
-    ss << "DhcpOptionsId=" << StringUtils::URLEncode(m_dhcpOptionsId.c_str()) << "&";
+    ss << "DhcpOptionsId=" << StringUtils::URLEncoded(m_dhcpOptionsId) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-    ss << "VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+    ss << "VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
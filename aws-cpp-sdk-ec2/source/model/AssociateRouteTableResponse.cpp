@@ -40,7 +40,7 @@ AssociateRouteTableResponse& AssociateRouteTableResponse::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AssociateRouteTableResponse")
+  if (rootNode.GetNameView() != "AssociateRouteTableResponse")
   {
     resultNode = rootNode.FirstChild("AssociateRouteTableResponse");
   }
@@ -50,7 +50,7 @@ AssociateRouteTableResponse& AssociateRouteTableResponse::operator =(const Amazo
     XmlNode associationIdNode = resultNode.FirstChild("associationId");
     if(!associationIdNode.IsNull())
     {
-      m_associationId = StringUtils::Trim(associationIdNode.GetText().c_str());
+      m_associationId = associationIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/AttachClassicLinkVpcRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ AttachClassicLinkVpcRequest::AttachClassicLinkVpcRequest() :
 
 Aws::String AttachClassicLinkVpcRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AttachClassicLinkVpc&";
   if(m_dryRunHasBeenSet)
   {
@@ -39,12 +40,12 @@ Aws::String AttachClassicLinkVpcRequest::SerializePayload() const
 
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-    ss << "VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+    ss << "VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_groupsHasBeenSet)
@@ -53,12 +54,12 @@ Aws::String AttachClassicLinkVpcRequest::SerializePayload() const
     for(auto& item : m_groups)
     {
       ss << "SecurityGroupId." << groupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       groupsCount++;
     }
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
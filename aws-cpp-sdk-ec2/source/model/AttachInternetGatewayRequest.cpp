@@ -15,6 +15,7 @@
 #include <aws/ec2/model/AttachInternetGatewayRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ AttachInternetGatewayRequest::AttachInternetGatewayRequest() :
 
 Aws::String AttachInternetGatewayRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AttachInternetGateway&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String AttachInternetGatewayRequest::SerializePayload() const
 
   if(m_internetGatewayIdHasBeenSet)
   {
-    ss << "InternetGatewayId=" << StringUtils::URLEncode(m_internetGatewayId.c_str()) << "&";
+    ss << "InternetGatewayId=" << StringUtils::URLEncoded(m_internetGatewayId) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-    ss << "VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+    ss << "VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/AttachNetworkInterfaceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -31,7 +32,7 @@ AttachNetworkInterfaceRequest::AttachNetworkInterfaceRequest() :
 
 Aws::String AttachNetworkInterfaceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AttachNetworkInterface&";
   if(m_dryRunHasBeenSet)
   {
@@ -40,12 +41,12 @@ Aws::String AttachNetworkInterfaceRequest::SerializePayload() const
 
   if(m_networkInterfaceIdHasBeenSet)
   {
-    ss << "NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+    ss << "NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
 
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_deviceIndexHasBeenSet)
@@ -54,6 +55,6 @@ Aws::String AttachNetworkInterfaceRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ AttachNetworkInterfaceResponse& AttachNetworkInterfaceResponse::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AttachNetworkInterfaceResponse")
+  if (rootNode.GetNameView() != "AttachNetworkInterfaceResponse")
   {
     resultNode = rootNode.FirstChild("AttachNetworkInterfaceResponse");
   }
@@ -50,7 +50,7 @@ AttachNetworkInterfaceResponse& AttachNetworkInterfaceResponse::operator =(const
     XmlNode attachmentIdNode = resultNode.FirstChild("attachmentId");
     if(!attachmentIdNode.IsNull())
     {
-      m_attachmentId = StringUtils::Trim(attachmentIdNode.GetText().c_str());
+      m_attachmentId = attachmentIdNode.GetTextView().Trim().ToString();
     }
   }
 
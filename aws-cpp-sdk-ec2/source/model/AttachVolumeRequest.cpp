@@ -15,6 +15,7 @@
 #include <aws/ec2/model/AttachVolumeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ AttachVolumeRequest::AttachVolumeRequest() :
 
 Aws::String AttachVolumeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AttachVolume&";
   if(m_dryRunHasBeenSet)
   {
@@ -39,20 +40,20 @@ Aws::String AttachVolumeRequest::SerializePayload() const
 
   if(m_volumeIdHasBeenSet)
   {
-    ss << "VolumeId=" << StringUtils::URLEncode(m_volumeId.c_str()) << "&";
+    ss << "VolumeId=" << StringUtils::URLEncoded(m_volumeId) << "&";
   }
 
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_deviceHasBeenSet)
   {
-    ss << "Device=" << StringUtils::URLEncode(m_device.c_str()) << "&";
+    ss << "Device=" << StringUtils::URLEncoded(m_device) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -42,7 +42,7 @@ AttachVolumeResponse& AttachVolumeResponse::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AttachVolumeResponse")
+  if (rootNode.GetNameView() != "AttachVolumeResponse")
   {
     resultNode = rootNode.FirstChild("AttachVolumeResponse");
   }
@@ -52,32 +52,32 @@ AttachVolumeResponse& AttachVolumeResponse::operator =(const AmazonWebServiceRes
     XmlNode volumeIdNode = resultNode.FirstChild("volumeId");
     if(!volumeIdNode.IsNull())
     {
-      m_volumeId = StringUtils::Trim(volumeIdNode.GetText().c_str());
+      m_volumeId = volumeIdNode.GetTextView().Trim().ToString();
     }
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
     }
     XmlNode deviceNode = resultNode.FirstChild("device");
     if(!deviceNode.IsNull())
     {
-      m_device = StringUtils::Trim(deviceNode.GetText().c_str());
+      m_device = deviceNode.GetTextView().Trim().ToString();
     }
     XmlNode stateNode = resultNode.FirstChild("status");
     if(!stateNode.IsNull())
     {
-      m_state = VolumeAttachmentStateMapper::GetVolumeAttachmentStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = VolumeAttachmentStateMapper::GetVolumeAttachmentStateForName(stateNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode attachTimeNode = resultNode.FirstChild("attachTime");
     if(!attachTimeNode.IsNull())
     {
-      m_attachTime = DateTime(StringUtils::Trim(attachTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_attachTime = DateTime(attachTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
     XmlNode deleteOnTerminationNode = resultNode.FirstChild("deleteOnTermination");
     if(!deleteOnTerminationNode.IsNull())
     {
-      m_deleteOnTermination = StringUtils::ConvertToBool(StringUtils::Trim(deleteOnTerminationNode.GetText().c_str()).c_str());
+      m_deleteOnTermination = StringUtils::ConvertToBool(deleteOnTerminationNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
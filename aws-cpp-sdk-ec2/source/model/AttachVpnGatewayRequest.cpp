@@ -15,6 +15,7 @@
 #include <aws/ec2/model/AttachVpnGatewayRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ AttachVpnGatewayRequest::AttachVpnGatewayRequest() :
 
 Aws::String AttachVpnGatewayRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AttachVpnGateway&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String AttachVpnGatewayRequest::SerializePayload() const
 
   if(m_vpnGatewayIdHasBeenSet)
   {
-    ss << "VpnGatewayId=" << StringUtils::URLEncode(m_vpnGatewayId.c_str()) << "&";
+    ss << "VpnGatewayId=" << StringUtils::URLEncoded(m_vpnGatewayId) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-    ss << "VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+    ss << "VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ AttachVpnGatewayResponse& AttachVpnGatewayResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AttachVpnGatewayResponse")
+  if (rootNode.GetNameView() != "AttachVpnGatewayResponse")
   {
     resultNode = rootNode.FirstChild("AttachVpnGatewayResponse");
   }
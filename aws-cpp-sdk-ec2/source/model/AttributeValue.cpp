@@ -49,7 +49,7 @@ AttributeValue& AttributeValue::operator =(const XmlNode& xmlNode)
     XmlNode valueNode = resultNode.FirstChild("value");
     if(!valueNode.IsNull())
     {
-      m_value = StringUtils::Trim(valueNode.GetText().c_str());
+      m_value = valueNode.GetTextView().Trim().ToString();
       m_valueHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void AttributeValue::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_valueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void AttributeValue::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_valueHasBeenSet)
   {
-      oStream << location << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 }
 
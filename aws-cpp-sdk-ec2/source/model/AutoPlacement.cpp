@@ -29,21 +29,29 @@ namespace Aws
       namespace AutoPlacementMapper
       {
 
-        static const int on_HASH = HashingUtils::HashString("on");
-        static const int off_HASH = HashingUtils::HashString("off");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int on_HASH = 3551;
+        static const int off_HASH = 109935;
 
 
         AutoPlacement GetAutoPlacementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == on_HASH)
+          switch (hashCode)
           {
+          case on_HASH:
             return AutoPlacement::on;
-          }
-          else if (hashCode == off_HASH)
-          {
+          case off_HASH:
             return AutoPlacement::off;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
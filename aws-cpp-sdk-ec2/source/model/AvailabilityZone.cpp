@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -55,19 +56,19 @@ AvailabilityZone& AvailabilityZone::operator =(const XmlNode& xmlNode)
     XmlNode zoneNameNode = resultNode.FirstChild("zoneName");
     if(!zoneNameNode.IsNull())
     {
-      m_zoneName = StringUtils::Trim(zoneNameNode.GetText().c_str());
+      m_zoneName = zoneNameNode.GetTextView().Trim().ToString();
       m_zoneNameHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("zoneState");
     if(!stateNode.IsNull())
     {
-      m_state = AvailabilityZoneStateMapper::GetAvailabilityZoneStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = AvailabilityZoneStateMapper::GetAvailabilityZoneStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode regionNameNode = resultNode.FirstChild("regionName");
     if(!regionNameNode.IsNull())
     {
-      m_regionName = StringUtils::Trim(regionNameNode.GetText().c_str());
+      m_regionName = regionNameNode.GetTextView().Trim().ToString();
       m_regionNameHasBeenSet = true;
     }
     XmlNode messagesNode = resultNode.FirstChild("messageSet");
@@ -91,7 +92,7 @@ void AvailabilityZone::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_zoneNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ZoneName=" << StringUtils::URLEncode(m_zoneName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ZoneName=" << StringUtils::URLEncoded(m_zoneName) << "&";
   }
 
   if(m_stateHasBeenSet)
@@ -101,7 +102,7 @@ void AvailabilityZone::OutputToStream(Aws::OStream& oStream, const char* locatio
 
   if(m_regionNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RegionName=" << StringUtils::URLEncode(m_regionName.c_str()) << "&";
+      oStream << location << index << locationValue << ".RegionName=" << StringUtils::URLEncoded(m_regionName) << "&";
   }
 
   if(m_messagesHasBeenSet)
@@ -109,9 +110,9 @@ void AvailabilityZone::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned messagesIdx = 1;
       for(auto& item : m_messages)
       {
-        Aws::StringStream messagesSs;
+        Aws::Utils::Stream::StringOutputStream messagesSs;
         messagesSs << location << index << locationValue << ".MessageSet." << messagesIdx++;
-        item.OutputToStream(oStream, messagesSs.str().c_str());
+        item.OutputToStream(oStream, messagesSs.GetString().c_str());
       }
   }
 
@@ -121,7 +122,7 @@ void AvailabilityZone::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_zoneNameHasBeenSet)
   {
-      oStream << location << ".ZoneName=" << StringUtils::URLEncode(m_zoneName.c_str()) << "&";
+      oStream << location << ".ZoneName=" << StringUtils::URLEncoded(m_zoneName) << "&";
   }
   if(m_stateHasBeenSet)
   {
@@ -129,16 +130,16 @@ void AvailabilityZone::OutputToStream(Aws::OStream& oStream, const char* locatio
   }
   if(m_regionNameHasBeenSet)
   {
-      oStream << location << ".RegionName=" << StringUtils::URLEncode(m_regionName.c_str()) << "&";
+      oStream << location << ".RegionName=" << StringUtils::URLEncoded(m_regionName) << "&";
   }
   if(m_messagesHasBeenSet)
   {
       unsigned messagesIdx = 1;
       for(auto& item : m_messages)
       {
-        Aws::StringStream messagesSs;
+        Aws::Utils::Stream::StringOutputStream messagesSs;
         messagesSs << location <<  ".item." << messagesIdx++;
-        item.OutputToStream(oStream, messagesSs.str().c_str());
+        item.OutputToStream(oStream, messagesSs.GetString().c_str());
       }
   }
 }
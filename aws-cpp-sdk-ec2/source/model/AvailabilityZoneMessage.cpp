@@ -49,7 +49,7 @@ AvailabilityZoneMessage& AvailabilityZoneMessage::operator =(const XmlNode& xmlN
     XmlNode messageNode = resultNode.FirstChild("message");
     if(!messageNode.IsNull())
     {
-      m_message = StringUtils::Trim(messageNode.GetText().c_str());
+      m_message = messageNode.GetTextView().Trim().ToString();
       m_messageHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void AvailabilityZoneMessage::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_messageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void AvailabilityZoneMessage::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_messageHasBeenSet)
   {
-      oStream << location << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 }
 
@@ -29,31 +29,35 @@ namespace Aws
       namespace AvailabilityZoneStateMapper
       {
 
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int information_HASH = HashingUtils::HashString("information");
-        static const int impaired_HASH = HashingUtils::HashString("impaired");
-        static const int unavailable_HASH = HashingUtils::HashString("unavailable");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int available_HASH = -733902135;
+        static const int information_HASH = 1968600364;
+        static const int impaired_HASH = -435567843;
+        static const int unavailable_HASH = -665462704;
 
 
         AvailabilityZoneState GetAvailabilityZoneStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == available_HASH)
+          switch (hashCode)
           {
+          case available_HASH:
             return AvailabilityZoneState::available;
-          }
-          else if (hashCode == information_HASH)
-          {
+          case information_HASH:
             return AvailabilityZoneState::information;
-          }
-          else if (hashCode == impaired_HASH)
-          {
+          case impaired_HASH:
             return AvailabilityZoneState::impaired;
-          }
-          else if (hashCode == unavailable_HASH)
-          {
+          case unavailable_HASH:
             return AvailabilityZoneState::unavailable;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -65,7 +66,7 @@ AvailableCapacity& AvailableCapacity::operator =(const XmlNode& xmlNode)
     XmlNode availableVCpusNode = resultNode.FirstChild("availableVCpus");
     if(!availableVCpusNode.IsNull())
     {
-      m_availableVCpus = StringUtils::ConvertToInt32(StringUtils::Trim(availableVCpusNode.GetText().c_str()).c_str());
+      m_availableVCpus = StringUtils::ConvertToInt32(availableVCpusNode.GetTextView().Trim().ToString().c_str());
       m_availableVCpusHasBeenSet = true;
     }
   }
@@ -80,9 +81,9 @@ void AvailableCapacity::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned availableInstanceCapacityIdx = 1;
       for(auto& item : m_availableInstanceCapacity)
       {
-        Aws::StringStream availableInstanceCapacitySs;
+        Aws::Utils::Stream::StringOutputStream availableInstanceCapacitySs;
         availableInstanceCapacitySs << location << index << locationValue << ".AvailableInstanceCapacity." << availableInstanceCapacityIdx++;
-        item.OutputToStream(oStream, availableInstanceCapacitySs.str().c_str());
+        item.OutputToStream(oStream, availableInstanceCapacitySs.GetString().c_str());
       }
   }
 
@@ -100,9 +101,9 @@ void AvailableCapacity::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned availableInstanceCapacityIdx = 1;
       for(auto& item : m_availableInstanceCapacity)
       {
-        Aws::StringStream availableInstanceCapacitySs;
+        Aws::Utils::Stream::StringOutputStream availableInstanceCapacitySs;
         availableInstanceCapacitySs << location <<  ".item." << availableInstanceCapacityIdx++;
-        item.OutputToStream(oStream, availableInstanceCapacitySs.str().c_str());
+        item.OutputToStream(oStream, availableInstanceCapacitySs.GetString().c_str());
       }
   }
   if(m_availableVCpusHasBeenSet)
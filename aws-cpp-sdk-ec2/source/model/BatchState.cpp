@@ -29,46 +29,44 @@ namespace Aws
       namespace BatchStateMapper
       {
 
-        static const int submitted_HASH = HashingUtils::HashString("submitted");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int cancelled_running_HASH = HashingUtils::HashString("cancelled_running");
-        static const int cancelled_terminating_HASH = HashingUtils::HashString("cancelled_terminating");
-        static const int modifying_HASH = HashingUtils::HashString("modifying");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int submitted_HASH = 348678395;
+        static const int active_HASH = -1422950650;
+        static const int cancelled_HASH = 476588369;
+        static const int failed_HASH = -1281977283;
+        static const int cancelled_running_HASH = -53148463;
+        static const int cancelled_terminating_HASH = -1669800720;
+        static const int modifying_HASH = -1900565272;
 
 
         BatchState GetBatchStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == submitted_HASH)
+          switch (hashCode)
           {
+          case submitted_HASH:
             return BatchState::submitted;
-          }
-          else if (hashCode == active_HASH)
-          {
+          case active_HASH:
             return BatchState::active;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
+          case cancelled_HASH:
             return BatchState::cancelled;
-          }
-          else if (hashCode == failed_HASH)
-          {
+          case failed_HASH:
             return BatchState::failed;
-          }
-          else if (hashCode == cancelled_running_HASH)
-          {
+          case cancelled_running_HASH:
             return BatchState::cancelled_running;
-          }
-          else if (hashCode == cancelled_terminating_HASH)
-          {
+          case cancelled_terminating_HASH:
             return BatchState::cancelled_terminating;
-          }
-          else if (hashCode == modifying_HASH)
-          {
+          case modifying_HASH:
             return BatchState::modifying;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -50,7 +50,7 @@ BlobAttributeValue& BlobAttributeValue::operator =(const XmlNode& xmlNode)
     XmlNode valueNode = resultNode.FirstChild("value");
     if(!valueNode.IsNull())
     {
-      m_value = HashingUtils::Base64Decode(StringUtils::Trim(valueNode.GetText().c_str()));
+      m_value = HashingUtils::Base64Decode(valueNode.GetTextView().Trim().ToString());
       m_valueHasBeenSet = true;
     }
   }
@@ -62,7 +62,7 @@ void BlobAttributeValue::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_valueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncode(HashingUtils::Base64Encode(m_value).c_str()) << "&";
+      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(m_value)) << "&";
   }
 
 }
@@ -71,7 +71,7 @@ void BlobAttributeValue::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_valueHasBeenSet)
   {
-      oStream << location << ".Value=" << StringUtils::URLEncode(HashingUtils::Base64Encode(m_value).c_str()) << "&";
+      oStream << location << ".Value=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(m_value)) << "&";
   }
 }
 
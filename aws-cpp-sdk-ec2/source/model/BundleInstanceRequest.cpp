@@ -15,6 +15,7 @@
 #include <aws/ec2/model/BundleInstanceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ BundleInstanceRequest::BundleInstanceRequest() :
 
 Aws::String BundleInstanceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=BundleInstance&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,7 +39,7 @@ Aws::String BundleInstanceRequest::SerializePayload() const
 
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_storageHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String BundleInstanceRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
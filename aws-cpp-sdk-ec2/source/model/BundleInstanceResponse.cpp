@@ -40,7 +40,7 @@ BundleInstanceResponse& BundleInstanceResponse::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "BundleInstanceResponse")
+  if (rootNode.GetNameView() != "BundleInstanceResponse")
   {
     resultNode = rootNode.FirstChild("BundleInstanceResponse");
   }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -63,31 +64,31 @@ BundleTask& BundleTask::operator =(const XmlNode& xmlNode)
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode bundleIdNode = resultNode.FirstChild("bundleId");
     if(!bundleIdNode.IsNull())
     {
-      m_bundleId = StringUtils::Trim(bundleIdNode.GetText().c_str());
+      m_bundleId = bundleIdNode.GetTextView().Trim().ToString();
       m_bundleIdHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = BundleTaskStateMapper::GetBundleTaskStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = BundleTaskStateMapper::GetBundleTaskStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode startTimeNode = resultNode.FirstChild("startTime");
     if(!startTimeNode.IsNull())
     {
-      m_startTime = DateTime(StringUtils::Trim(startTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_startTime = DateTime(startTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_startTimeHasBeenSet = true;
     }
     XmlNode updateTimeNode = resultNode.FirstChild("updateTime");
     if(!updateTimeNode.IsNull())
     {
-      m_updateTime = DateTime(StringUtils::Trim(updateTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_updateTime = DateTime(updateTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_updateTimeHasBeenSet = true;
     }
     XmlNode storageNode = resultNode.FirstChild("storage");
@@ -99,7 +100,7 @@ BundleTask& BundleTask::operator =(const XmlNode& xmlNode)
     XmlNode progressNode = resultNode.FirstChild("progress");
     if(!progressNode.IsNull())
     {
-      m_progress = StringUtils::Trim(progressNode.GetText().c_str());
+      m_progress = progressNode.GetTextView().Trim().ToString();
       m_progressHasBeenSet = true;
     }
     XmlNode bundleTaskErrorNode = resultNode.FirstChild("error");
@@ -117,12 +118,12 @@ void BundleTask::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_bundleIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".BundleId=" << StringUtils::URLEncode(m_bundleId.c_str()) << "&";
+      oStream << location << index << locationValue << ".BundleId=" << StringUtils::URLEncoded(m_bundleId) << "&";
   }
 
   if(m_stateHasBeenSet)
@@ -132,31 +133,31 @@ void BundleTask::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_startTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_updateTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UpdateTime=" << StringUtils::URLEncode(m_updateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".UpdateTime=" << StringUtils::URLEncoded(m_updateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_storageHasBeenSet)
   {
-      Aws::StringStream storageLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream storageLocationAndMemberSs;
       storageLocationAndMemberSs << location << index << locationValue << ".Storage";
-      m_storage.OutputToStream(oStream, storageLocationAndMemberSs.str().c_str());
+      m_storage.OutputToStream(oStream, storageLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_progressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Progress=" << StringUtils::URLEncode(m_progress.c_str()) << "&";
+      oStream << location << index << locationValue << ".Progress=" << StringUtils::URLEncoded(m_progress) << "&";
   }
 
   if(m_bundleTaskErrorHasBeenSet)
   {
-      Aws::StringStream bundleTaskErrorLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream bundleTaskErrorLocationAndMemberSs;
       bundleTaskErrorLocationAndMemberSs << location << index << locationValue << ".BundleTaskError";
-      m_bundleTaskError.OutputToStream(oStream, bundleTaskErrorLocationAndMemberSs.str().c_str());
+      m_bundleTaskError.OutputToStream(oStream, bundleTaskErrorLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -165,11 +166,11 @@ void BundleTask::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_bundleIdHasBeenSet)
   {
-      oStream << location << ".BundleId=" << StringUtils::URLEncode(m_bundleId.c_str()) << "&";
+      oStream << location << ".BundleId=" << StringUtils::URLEncoded(m_bundleId) << "&";
   }
   if(m_stateHasBeenSet)
   {
@@ -177,11 +178,11 @@ void BundleTask::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_startTimeHasBeenSet)
   {
-      oStream << location << ".StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_updateTimeHasBeenSet)
   {
-      oStream << location << ".UpdateTime=" << StringUtils::URLEncode(m_updateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".UpdateTime=" << StringUtils::URLEncoded(m_updateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_storageHasBeenSet)
   {
@@ -191,7 +192,7 @@ void BundleTask::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_progressHasBeenSet)
   {
-      oStream << location << ".Progress=" << StringUtils::URLEncode(m_progress.c_str()) << "&";
+      oStream << location << ".Progress=" << StringUtils::URLEncoded(m_progress) << "&";
   }
   if(m_bundleTaskErrorHasBeenSet)
   {
@@ -29,46 +29,44 @@ namespace Aws
       namespace BundleTaskStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int waiting_for_shutdown_HASH = HashingUtils::HashString("waiting-for-shutdown");
-        static const int bundling_HASH = HashingUtils::HashString("bundling");
-        static const int storing_HASH = HashingUtils::HashString("storing");
-        static const int cancelling_HASH = HashingUtils::HashString("cancelling");
-        static const int complete_HASH = HashingUtils::HashString("complete");
-        static const int failed_HASH = HashingUtils::HashString("failed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int pending_HASH = -682587753;
+        static const int waiting_for_shutdown_HASH = 596460122;
+        static const int bundling_HASH = -1294650177;
+        static const int storing_HASH = -1884266146;
+        static const int cancelling_HASH = 1889341808;
+        static const int complete_HASH = -599445191;
+        static const int failed_HASH = -1281977283;
 
 
         BundleTaskState GetBundleTaskStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          switch (hashCode)
           {
+          case pending_HASH:
             return BundleTaskState::pending;
-          }
-          else if (hashCode == waiting_for_shutdown_HASH)
-          {
+          case waiting_for_shutdown_HASH:
             return BundleTaskState::waiting_for_shutdown;
-          }
-          else if (hashCode == bundling_HASH)
-          {
+          case bundling_HASH:
             return BundleTaskState::bundling;
-          }
-          else if (hashCode == storing_HASH)
-          {
+          case storing_HASH:
             return BundleTaskState::storing;
-          }
-          else if (hashCode == cancelling_HASH)
-          {
+          case cancelling_HASH:
             return BundleTaskState::cancelling;
-          }
-          else if (hashCode == complete_HASH)
-          {
+          case complete_HASH:
             return BundleTaskState::complete;
-          }
-          else if (hashCode == failed_HASH)
-          {
+          case failed_HASH:
             return BundleTaskState::failed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
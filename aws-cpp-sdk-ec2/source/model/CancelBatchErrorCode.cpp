@@ -29,31 +29,35 @@ namespace Aws
       namespace CancelBatchErrorCodeMapper
       {
 
-        static const int fleetRequestIdDoesNotExist_HASH = HashingUtils::HashString("fleetRequestIdDoesNotExist");
-        static const int fleetRequestIdMalformed_HASH = HashingUtils::HashString("fleetRequestIdMalformed");
-        static const int fleetRequestNotInCancellableState_HASH = HashingUtils::HashString("fleetRequestNotInCancellableState");
-        static const int unexpectedError_HASH = HashingUtils::HashString("unexpectedError");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int fleetRequestIdDoesNotExist_HASH = -1688989191;
+        static const int fleetRequestIdMalformed_HASH = -483855169;
+        static const int fleetRequestNotInCancellableState_HASH = -290190596;
+        static const int unexpectedError_HASH = 1317945399;
 
 
         CancelBatchErrorCode GetCancelBatchErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == fleetRequestIdDoesNotExist_HASH)
+          switch (hashCode)
           {
+          case fleetRequestIdDoesNotExist_HASH:
             return CancelBatchErrorCode::fleetRequestIdDoesNotExist;
-          }
-          else if (hashCode == fleetRequestIdMalformed_HASH)
-          {
+          case fleetRequestIdMalformed_HASH:
             return CancelBatchErrorCode::fleetRequestIdMalformed;
-          }
-          else if (hashCode == fleetRequestNotInCancellableState_HASH)
-          {
+          case fleetRequestNotInCancellableState_HASH:
             return CancelBatchErrorCode::fleetRequestNotInCancellableState;
-          }
-          else if (hashCode == unexpectedError_HASH)
-          {
+          case unexpectedError_HASH:
             return CancelBatchErrorCode::unexpectedError;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
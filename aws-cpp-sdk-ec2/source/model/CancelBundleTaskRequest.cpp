@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CancelBundleTaskRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ CancelBundleTaskRequest::CancelBundleTaskRequest() :
 
 Aws::String CancelBundleTaskRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CancelBundleTask&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String CancelBundleTaskRequest::SerializePayload() const
 
   if(m_bundleIdHasBeenSet)
   {
-    ss << "BundleId=" << StringUtils::URLEncode(m_bundleId.c_str()) << "&";
+    ss << "BundleId=" << StringUtils::URLEncoded(m_bundleId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
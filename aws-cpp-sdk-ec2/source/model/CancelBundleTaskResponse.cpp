@@ -40,7 +40,7 @@ CancelBundleTaskResponse& CancelBundleTaskResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CancelBundleTaskResponse")
+  if (rootNode.GetNameView() != "CancelBundleTaskResponse")
   {
     resultNode = rootNode.FirstChild("CancelBundleTaskResponse");
   }
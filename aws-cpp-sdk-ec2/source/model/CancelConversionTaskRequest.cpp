@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CancelConversionTaskRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ CancelConversionTaskRequest::CancelConversionTaskRequest() :
 
 Aws::String CancelConversionTaskRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CancelConversionTask&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String CancelConversionTaskRequest::SerializePayload() const
 
   if(m_conversionTaskIdHasBeenSet)
   {
-    ss << "ConversionTaskId=" << StringUtils::URLEncode(m_conversionTaskId.c_str()) << "&";
+    ss << "ConversionTaskId=" << StringUtils::URLEncoded(m_conversionTaskId) << "&";
   }
 
   if(m_reasonMessageHasBeenSet)
   {
-    ss << "ReasonMessage=" << StringUtils::URLEncode(m_reasonMessage.c_str()) << "&";
+    ss << "ReasonMessage=" << StringUtils::URLEncoded(m_reasonMessage) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CancelExportTaskRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ CancelExportTaskRequest::CancelExportTaskRequest() :
 
 Aws::String CancelExportTaskRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CancelExportTask&";
   if(m_exportTaskIdHasBeenSet)
   {
-    ss << "ExportTaskId=" << StringUtils::URLEncode(m_exportTaskId.c_str()) << "&";
+    ss << "ExportTaskId=" << StringUtils::URLEncoded(m_exportTaskId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
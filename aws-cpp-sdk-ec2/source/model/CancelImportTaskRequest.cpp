@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CancelImportTaskRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ CancelImportTaskRequest::CancelImportTaskRequest() :
 
 Aws::String CancelImportTaskRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CancelImportTask&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String CancelImportTaskRequest::SerializePayload() const
 
   if(m_importTaskIdHasBeenSet)
   {
-    ss << "ImportTaskId=" << StringUtils::URLEncode(m_importTaskId.c_str()) << "&";
+    ss << "ImportTaskId=" << StringUtils::URLEncoded(m_importTaskId) << "&";
   }
 
   if(m_cancelReasonHasBeenSet)
   {
-    ss << "CancelReason=" << StringUtils::URLEncode(m_cancelReason.c_str()) << "&";
+    ss << "CancelReason=" << StringUtils::URLEncoded(m_cancelReason) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
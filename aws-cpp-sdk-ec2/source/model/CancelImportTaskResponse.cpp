@@ -40,7 +40,7 @@ CancelImportTaskResponse& CancelImportTaskResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CancelImportTaskResponse")
+  if (rootNode.GetNameView() != "CancelImportTaskResponse")
   {
     resultNode = rootNode.FirstChild("CancelImportTaskResponse");
   }
@@ -50,17 +50,17 @@ CancelImportTaskResponse& CancelImportTaskResponse::operator =(const AmazonWebSe
     XmlNode importTaskIdNode = resultNode.FirstChild("importTaskId");
     if(!importTaskIdNode.IsNull())
     {
-      m_importTaskId = StringUtils::Trim(importTaskIdNode.GetText().c_str());
+      m_importTaskId = importTaskIdNode.GetTextView().Trim().ToString();
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = StringUtils::Trim(stateNode.GetText().c_str());
+      m_state = stateNode.GetTextView().Trim().ToString();
     }
     XmlNode previousStateNode = resultNode.FirstChild("previousState");
     if(!previousStateNode.IsNull())
     {
-      m_previousState = StringUtils::Trim(previousStateNode.GetText().c_str());
+      m_previousState = previousStateNode.GetTextView().Trim().ToString();
     }
   }
 
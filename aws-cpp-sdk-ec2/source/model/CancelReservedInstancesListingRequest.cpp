@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CancelReservedInstancesListingRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ CancelReservedInstancesListingRequest::CancelReservedInstancesListingRequest() :
 
 Aws::String CancelReservedInstancesListingRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CancelReservedInstancesListing&";
   if(m_reservedInstancesListingIdHasBeenSet)
   {
-    ss << "ReservedInstancesListingId=" << StringUtils::URLEncode(m_reservedInstancesListingId.c_str()) << "&";
+    ss << "ReservedInstancesListingId=" << StringUtils::URLEncoded(m_reservedInstancesListingId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CancelReservedInstancesListingResponse& CancelReservedInstancesListingResponse::
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CancelReservedInstancesListingResponse")
+  if (rootNode.GetNameView() != "CancelReservedInstancesListingResponse")
   {
     resultNode = rootNode.FirstChild("CancelReservedInstancesListingResponse");
   }
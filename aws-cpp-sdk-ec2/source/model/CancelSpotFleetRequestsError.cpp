@@ -51,13 +51,13 @@ CancelSpotFleetRequestsError& CancelSpotFleetRequestsError::operator =(const Xml
     XmlNode codeNode = resultNode.FirstChild("code");
     if(!codeNode.IsNull())
     {
-      m_code = CancelBatchErrorCodeMapper::GetCancelBatchErrorCodeForName(StringUtils::Trim(codeNode.GetText().c_str()).c_str());
+      m_code = CancelBatchErrorCodeMapper::GetCancelBatchErrorCodeForName(codeNode.GetTextView().Trim().ToString().c_str());
       m_codeHasBeenSet = true;
     }
     XmlNode messageNode = resultNode.FirstChild("message");
     if(!messageNode.IsNull())
     {
-      m_message = StringUtils::Trim(messageNode.GetText().c_str());
+      m_message = messageNode.GetTextView().Trim().ToString();
       m_messageHasBeenSet = true;
     }
   }
@@ -74,7 +74,7 @@ void CancelSpotFleetRequestsError::OutputToStream(Aws::OStream& oStream, const c
 
   if(m_messageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 
 }
@@ -87,7 +87,7 @@ void CancelSpotFleetRequestsError::OutputToStream(Aws::OStream& oStream, const c
   }
   if(m_messageHasBeenSet)
   {
-      oStream << location << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ CancelSpotFleetRequestsErrorItem& CancelSpotFleetRequestsErrorItem::operator =(c
     XmlNode spotFleetRequestIdNode = resultNode.FirstChild("spotFleetRequestId");
     if(!spotFleetRequestIdNode.IsNull())
     {
-      m_spotFleetRequestId = StringUtils::Trim(spotFleetRequestIdNode.GetText().c_str());
+      m_spotFleetRequestId = spotFleetRequestIdNode.GetTextView().Trim().ToString();
       m_spotFleetRequestIdHasBeenSet = true;
     }
     XmlNode errorNode = resultNode.FirstChild("error");
@@ -69,14 +70,14 @@ void CancelSpotFleetRequestsErrorItem::OutputToStream(Aws::OStream& oStream, con
 {
   if(m_spotFleetRequestIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SpotFleetRequestId=" << StringUtils::URLEncode(m_spotFleetRequestId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SpotFleetRequestId=" << StringUtils::URLEncoded(m_spotFleetRequestId) << "&";
   }
 
   if(m_errorHasBeenSet)
   {
-      Aws::StringStream errorLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream errorLocationAndMemberSs;
       errorLocationAndMemberSs << location << index << locationValue << ".Error";
-      m_error.OutputToStream(oStream, errorLocationAndMemberSs.str().c_str());
+      m_error.OutputToStream(oStream, errorLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -85,7 +86,7 @@ void CancelSpotFleetRequestsErrorItem::OutputToStream(Aws::OStream& oStream, con
 {
   if(m_spotFleetRequestIdHasBeenSet)
   {
-      oStream << location << ".SpotFleetRequestId=" << StringUtils::URLEncode(m_spotFleetRequestId.c_str()) << "&";
+      oStream << location << ".SpotFleetRequestId=" << StringUtils::URLEncoded(m_spotFleetRequestId) << "&";
   }
   if(m_errorHasBeenSet)
   {
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CancelSpotFleetRequestsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ CancelSpotFleetRequestsRequest::CancelSpotFleetRequestsRequest() :
 
 Aws::String CancelSpotFleetRequestsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CancelSpotFleets&";
   if(m_dryRunHasBeenSet)
   {
@@ -43,7 +44,7 @@ Aws::String CancelSpotFleetRequestsRequest::SerializePayload() const
     for(auto& item : m_spotFleetRequestIds)
     {
       ss << "SpotFleetRequestId." << spotFleetRequestIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       spotFleetRequestIdsCount++;
     }
   }
@@ -54,6 +55,6 @@ Aws::String CancelSpotFleetRequestsRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CancelSpotFleetRequestsResponse& CancelSpotFleetRequestsResponse::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CancelSpotFleetRequestsResponse")
+  if (rootNode.GetNameView() != "CancelSpotFleetRequestsResponse")
   {
     resultNode = rootNode.FirstChild("CancelSpotFleetRequestsResponse");
   }
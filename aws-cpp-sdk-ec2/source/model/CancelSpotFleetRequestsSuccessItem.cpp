@@ -53,19 +53,19 @@ CancelSpotFleetRequestsSuccessItem& CancelSpotFleetRequestsSuccessItem::operator
     XmlNode spotFleetRequestIdNode = resultNode.FirstChild("spotFleetRequestId");
     if(!spotFleetRequestIdNode.IsNull())
     {
-      m_spotFleetRequestId = StringUtils::Trim(spotFleetRequestIdNode.GetText().c_str());
+      m_spotFleetRequestId = spotFleetRequestIdNode.GetTextView().Trim().ToString();
       m_spotFleetRequestIdHasBeenSet = true;
     }
     XmlNode currentSpotFleetRequestStateNode = resultNode.FirstChild("currentSpotFleetRequestState");
     if(!currentSpotFleetRequestStateNode.IsNull())
     {
-      m_currentSpotFleetRequestState = BatchStateMapper::GetBatchStateForName(StringUtils::Trim(currentSpotFleetRequestStateNode.GetText().c_str()).c_str());
+      m_currentSpotFleetRequestState = BatchStateMapper::GetBatchStateForName(currentSpotFleetRequestStateNode.GetTextView().Trim().ToString().c_str());
       m_currentSpotFleetRequestStateHasBeenSet = true;
     }
     XmlNode previousSpotFleetRequestStateNode = resultNode.FirstChild("previousSpotFleetRequestState");
     if(!previousSpotFleetRequestStateNode.IsNull())
     {
-      m_previousSpotFleetRequestState = BatchStateMapper::GetBatchStateForName(StringUtils::Trim(previousSpotFleetRequestStateNode.GetText().c_str()).c_str());
+      m_previousSpotFleetRequestState = BatchStateMapper::GetBatchStateForName(previousSpotFleetRequestStateNode.GetTextView().Trim().ToString().c_str());
       m_previousSpotFleetRequestStateHasBeenSet = true;
     }
   }
@@ -77,7 +77,7 @@ void CancelSpotFleetRequestsSuccessItem::OutputToStream(Aws::OStream& oStream, c
 {
   if(m_spotFleetRequestIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SpotFleetRequestId=" << StringUtils::URLEncode(m_spotFleetRequestId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SpotFleetRequestId=" << StringUtils::URLEncoded(m_spotFleetRequestId) << "&";
   }
 
   if(m_currentSpotFleetRequestStateHasBeenSet)
@@ -96,7 +96,7 @@ void CancelSpotFleetRequestsSuccessItem::OutputToStream(Aws::OStream& oStream, c
 {
   if(m_spotFleetRequestIdHasBeenSet)
   {
-      oStream << location << ".SpotFleetRequestId=" << StringUtils::URLEncode(m_spotFleetRequestId.c_str()) << "&";
+      oStream << location << ".SpotFleetRequestId=" << StringUtils::URLEncoded(m_spotFleetRequestId) << "&";
   }
   if(m_currentSpotFleetRequestStateHasBeenSet)
   {
@@ -29,36 +29,38 @@ namespace Aws
       namespace CancelSpotInstanceRequestStateMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int open_HASH = HashingUtils::HashString("open");
-        static const int closed_HASH = HashingUtils::HashString("closed");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int completed_HASH = HashingUtils::HashString("completed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int active_HASH = -1422950650;
+        static const int open_HASH = 3417674;
+        static const int closed_HASH = -1357520532;
+        static const int cancelled_HASH = 476588369;
+        static const int completed_HASH = -1402931637;
 
 
         CancelSpotInstanceRequestState GetCancelSpotInstanceRequestStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
+          switch (hashCode)
           {
+          case active_HASH:
             return CancelSpotInstanceRequestState::active;
-          }
-          else if (hashCode == open_HASH)
-          {
+          case open_HASH:
             return CancelSpotInstanceRequestState::open;
-          }
-          else if (hashCode == closed_HASH)
-          {
+          case closed_HASH:
             return CancelSpotInstanceRequestState::closed;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
+          case cancelled_HASH:
             return CancelSpotInstanceRequestState::cancelled;
-          }
-          else if (hashCode == completed_HASH)
-          {
+          case completed_HASH:
             return CancelSpotInstanceRequestState::completed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CancelSpotInstanceRequestsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ CancelSpotInstanceRequestsRequest::CancelSpotInstanceRequestsRequest() :
 
 Aws::String CancelSpotInstanceRequestsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CancelSpotInstances&";
   if(m_dryRunHasBeenSet)
   {
@@ -41,12 +42,12 @@ Aws::String CancelSpotInstanceRequestsRequest::SerializePayload() const
     for(auto& item : m_spotInstanceRequestIds)
     {
       ss << "SpotInstanceRequestId." << spotInstanceRequestIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       spotInstanceRequestIdsCount++;
     }
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CancelSpotInstanceRequestsResponse& CancelSpotInstanceRequestsResponse::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CancelSpotInstanceRequestsResponse")
+  if (rootNode.GetNameView() != "CancelSpotInstanceRequestsResponse")
   {
     resultNode = rootNode.FirstChild("CancelSpotInstanceRequestsResponse");
   }
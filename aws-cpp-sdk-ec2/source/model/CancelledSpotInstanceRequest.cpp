@@ -51,13 +51,13 @@ CancelledSpotInstanceRequest& CancelledSpotInstanceRequest::operator =(const Xml
     XmlNode spotInstanceRequestIdNode = resultNode.FirstChild("spotInstanceRequestId");
     if(!spotInstanceRequestIdNode.IsNull())
     {
-      m_spotInstanceRequestId = StringUtils::Trim(spotInstanceRequestIdNode.GetText().c_str());
+      m_spotInstanceRequestId = spotInstanceRequestIdNode.GetTextView().Trim().ToString();
       m_spotInstanceRequestIdHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = CancelSpotInstanceRequestStateMapper::GetCancelSpotInstanceRequestStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = CancelSpotInstanceRequestStateMapper::GetCancelSpotInstanceRequestStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
   }
@@ -69,7 +69,7 @@ void CancelledSpotInstanceRequest::OutputToStream(Aws::OStream& oStream, const c
 {
   if(m_spotInstanceRequestIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SpotInstanceRequestId=" << StringUtils::URLEncode(m_spotInstanceRequestId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SpotInstanceRequestId=" << StringUtils::URLEncoded(m_spotInstanceRequestId) << "&";
   }
 
   if(m_stateHasBeenSet)
@@ -83,7 +83,7 @@ void CancelledSpotInstanceRequest::OutputToStream(Aws::OStream& oStream, const c
 {
   if(m_spotInstanceRequestIdHasBeenSet)
   {
-      oStream << location << ".SpotInstanceRequestId=" << StringUtils::URLEncode(m_spotInstanceRequestId.c_str()) << "&";
+      oStream << location << ".SpotInstanceRequestId=" << StringUtils::URLEncoded(m_spotInstanceRequestId) << "&";
   }
   if(m_stateHasBeenSet)
   {
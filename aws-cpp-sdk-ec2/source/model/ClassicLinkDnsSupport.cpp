@@ -53,13 +53,13 @@ ClassicLinkDnsSupport& ClassicLinkDnsSupport::operator =(const XmlNode& xmlNode)
     XmlNode vpcIdNode = resultNode.FirstChild("vpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode classicLinkDnsSupportedNode = resultNode.FirstChild("classicLinkDnsSupported");
     if(!classicLinkDnsSupportedNode.IsNull())
     {
-      m_classicLinkDnsSupported = StringUtils::ConvertToBool(StringUtils::Trim(classicLinkDnsSupportedNode.GetText().c_str()).c_str());
+      m_classicLinkDnsSupported = StringUtils::ConvertToBool(classicLinkDnsSupportedNode.GetTextView().Trim().ToString().c_str());
       m_classicLinkDnsSupportedHasBeenSet = true;
     }
   }
@@ -71,7 +71,7 @@ void ClassicLinkDnsSupport::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_classicLinkDnsSupportedHasBeenSet)
@@ -85,7 +85,7 @@ void ClassicLinkDnsSupport::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_classicLinkDnsSupportedHasBeenSet)
   {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -55,13 +56,13 @@ ClassicLinkInstance& ClassicLinkInstance::operator =(const XmlNode& xmlNode)
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("vpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode groupsNode = resultNode.FirstChild("groupSet");
@@ -97,12 +98,12 @@ void ClassicLinkInstance::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_groupsHasBeenSet)
@@ -110,9 +111,9 @@ void ClassicLinkInstance::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned groupsIdx = 1;
       for(auto& item : m_groups)
       {
-        Aws::StringStream groupsSs;
+        Aws::Utils::Stream::StringOutputStream groupsSs;
         groupsSs << location << index << locationValue << ".GroupSet." << groupsIdx++;
-        item.OutputToStream(oStream, groupsSs.str().c_str());
+        item.OutputToStream(oStream, groupsSs.GetString().c_str());
       }
   }
 
@@ -121,9 +122,9 @@ void ClassicLinkInstance::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -133,20 +134,20 @@ void ClassicLinkInstance::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_groupsHasBeenSet)
   {
       unsigned groupsIdx = 1;
       for(auto& item : m_groups)
       {
-        Aws::StringStream groupsSs;
+        Aws::Utils::Stream::StringOutputStream groupsSs;
         groupsSs << location <<  ".item." << groupsIdx++;
-        item.OutputToStream(oStream, groupsSs.str().c_str());
+        item.OutputToStream(oStream, groupsSs.GetString().c_str());
       }
   }
   if(m_tagsHasBeenSet)
@@ -154,9 +155,9 @@ void ClassicLinkInstance::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
@@ -57,25 +57,25 @@ ClientData& ClientData::operator =(const XmlNode& xmlNode)
     XmlNode uploadStartNode = resultNode.FirstChild("UploadStart");
     if(!uploadStartNode.IsNull())
     {
-      m_uploadStart = DateTime(StringUtils::Trim(uploadStartNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_uploadStart = DateTime(uploadStartNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_uploadStartHasBeenSet = true;
     }
     XmlNode uploadEndNode = resultNode.FirstChild("UploadEnd");
     if(!uploadEndNode.IsNull())
     {
-      m_uploadEnd = DateTime(StringUtils::Trim(uploadEndNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_uploadEnd = DateTime(uploadEndNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_uploadEndHasBeenSet = true;
     }
     XmlNode uploadSizeNode = resultNode.FirstChild("UploadSize");
     if(!uploadSizeNode.IsNull())
     {
-      m_uploadSize = StringUtils::ConvertToDouble(StringUtils::Trim(uploadSizeNode.GetText().c_str()).c_str());
+      m_uploadSize = StringUtils::ConvertToDouble(uploadSizeNode.GetTextView().Trim().ToString().c_str());
       m_uploadSizeHasBeenSet = true;
     }
     XmlNode commentNode = resultNode.FirstChild("Comment");
     if(!commentNode.IsNull())
     {
-      m_comment = StringUtils::Trim(commentNode.GetText().c_str());
+      m_comment = commentNode.GetTextView().Trim().ToString();
       m_commentHasBeenSet = true;
     }
   }
@@ -87,12 +87,12 @@ void ClientData::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_uploadStartHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UploadStart=" << StringUtils::URLEncode(m_uploadStart.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".UploadStart=" << StringUtils::URLEncoded(m_uploadStart.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_uploadEndHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UploadEnd=" << StringUtils::URLEncode(m_uploadEnd.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".UploadEnd=" << StringUtils::URLEncoded(m_uploadEnd.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_uploadSizeHasBeenSet)
@@ -102,7 +102,7 @@ void ClientData::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_commentHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Comment=" << StringUtils::URLEncode(m_comment.c_str()) << "&";
+      oStream << location << index << locationValue << ".Comment=" << StringUtils::URLEncoded(m_comment) << "&";
   }
 
 }
@@ -111,11 +111,11 @@ void ClientData::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_uploadStartHasBeenSet)
   {
-      oStream << location << ".UploadStart=" << StringUtils::URLEncode(m_uploadStart.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".UploadStart=" << StringUtils::URLEncoded(m_uploadStart.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_uploadEndHasBeenSet)
   {
-      oStream << location << ".UploadEnd=" << StringUtils::URLEncode(m_uploadEnd.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".UploadEnd=" << StringUtils::URLEncoded(m_uploadEnd.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_uploadSizeHasBeenSet)
   {
@@ -123,7 +123,7 @@ void ClientData::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_commentHasBeenSet)
   {
-      oStream << location << ".Comment=" << StringUtils::URLEncode(m_comment.c_str()) << "&";
+      oStream << location << ".Comment=" << StringUtils::URLEncoded(m_comment) << "&";
   }
 }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ConfirmProductInstanceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ ConfirmProductInstanceRequest::ConfirmProductInstanceRequest() :
 
 Aws::String ConfirmProductInstanceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ConfirmProductInstance&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String ConfirmProductInstanceRequest::SerializePayload() const
 
   if(m_productCodeHasBeenSet)
   {
-    ss << "ProductCode=" << StringUtils::URLEncode(m_productCode.c_str()) << "&";
+    ss << "ProductCode=" << StringUtils::URLEncoded(m_productCode) << "&";
   }
 
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -42,7 +42,7 @@ ConfirmProductInstanceResponse& ConfirmProductInstanceResponse::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ConfirmProductInstanceResponse")
+  if (rootNode.GetNameView() != "ConfirmProductInstanceResponse")
   {
     resultNode = rootNode.FirstChild("ConfirmProductInstanceResponse");
   }
@@ -52,12 +52,12 @@ ConfirmProductInstanceResponse& ConfirmProductInstanceResponse::operator =(const
     XmlNode ownerIdNode = resultNode.FirstChild("ownerId");
     if(!ownerIdNode.IsNull())
     {
-      m_ownerId = StringUtils::Trim(ownerIdNode.GetText().c_str());
+      m_ownerId = ownerIdNode.GetTextView().Trim().ToString();
     }
     XmlNode returnNode = resultNode.FirstChild("return");
     if(!returnNode.IsNull())
     {
-      m_return = StringUtils::ConvertToBool(StringUtils::Trim(returnNode.GetText().c_str()).c_str());
+      m_return = StringUtils::ConvertToBool(returnNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
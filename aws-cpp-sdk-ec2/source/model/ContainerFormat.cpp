@@ -29,16 +29,26 @@ namespace Aws
       namespace ContainerFormatMapper
       {
 
-        static const int ova_HASH = HashingUtils::HashString("ova");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ova_HASH = 110426;
 
 
         ContainerFormat GetContainerFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ova_HASH)
+          switch (hashCode)
           {
+          case ova_HASH:
             return ContainerFormat::ova;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
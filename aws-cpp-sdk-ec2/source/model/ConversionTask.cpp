@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,13 +62,13 @@ ConversionTask& ConversionTask::operator =(const XmlNode& xmlNode)
     XmlNode conversionTaskIdNode = resultNode.FirstChild("conversionTaskId");
     if(!conversionTaskIdNode.IsNull())
     {
-      m_conversionTaskId = StringUtils::Trim(conversionTaskIdNode.GetText().c_str());
+      m_conversionTaskId = conversionTaskIdNode.GetTextView().Trim().ToString();
       m_conversionTaskIdHasBeenSet = true;
     }
     XmlNode expirationTimeNode = resultNode.FirstChild("expirationTime");
     if(!expirationTimeNode.IsNull())
     {
-      m_expirationTime = StringUtils::Trim(expirationTimeNode.GetText().c_str());
+      m_expirationTime = expirationTimeNode.GetTextView().Trim().ToString();
       m_expirationTimeHasBeenSet = true;
     }
     XmlNode importInstanceNode = resultNode.FirstChild("importInstance");
@@ -85,13 +86,13 @@ ConversionTask& ConversionTask::operator =(const XmlNode& xmlNode)
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = ConversionTaskStateMapper::GetConversionTaskStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = ConversionTaskStateMapper::GetConversionTaskStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode statusMessageNode = resultNode.FirstChild("statusMessage");
     if(!statusMessageNode.IsNull())
     {
-      m_statusMessage = StringUtils::Trim(statusMessageNode.GetText().c_str());
+      m_statusMessage = statusMessageNode.GetTextView().Trim().ToString();
       m_statusMessageHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("tagSet");
@@ -115,26 +116,26 @@ void ConversionTask::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_conversionTaskIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ConversionTaskId=" << StringUtils::URLEncode(m_conversionTaskId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ConversionTaskId=" << StringUtils::URLEncoded(m_conversionTaskId) << "&";
   }
 
   if(m_expirationTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ExpirationTime=" << StringUtils::URLEncode(m_expirationTime.c_str()) << "&";
+      oStream << location << index << locationValue << ".ExpirationTime=" << StringUtils::URLEncoded(m_expirationTime) << "&";
   }
 
   if(m_importInstanceHasBeenSet)
   {
-      Aws::StringStream importInstanceLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream importInstanceLocationAndMemberSs;
       importInstanceLocationAndMemberSs << location << index << locationValue << ".ImportInstance";
-      m_importInstance.OutputToStream(oStream, importInstanceLocationAndMemberSs.str().c_str());
+      m_importInstance.OutputToStream(oStream, importInstanceLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_importVolumeHasBeenSet)
   {
-      Aws::StringStream importVolumeLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream importVolumeLocationAndMemberSs;
       importVolumeLocationAndMemberSs << location << index << locationValue << ".ImportVolume";
-      m_importVolume.OutputToStream(oStream, importVolumeLocationAndMemberSs.str().c_str());
+      m_importVolume.OutputToStream(oStream, importVolumeLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_stateHasBeenSet)
@@ -144,7 +145,7 @@ void ConversionTask::OutputToStream(Aws::OStream& oStream, const char* location,
 
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -152,9 +153,9 @@ void ConversionTask::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -164,11 +165,11 @@ void ConversionTask::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_conversionTaskIdHasBeenSet)
   {
-      oStream << location << ".ConversionTaskId=" << StringUtils::URLEncode(m_conversionTaskId.c_str()) << "&";
+      oStream << location << ".ConversionTaskId=" << StringUtils::URLEncoded(m_conversionTaskId) << "&";
   }
   if(m_expirationTimeHasBeenSet)
   {
-      oStream << location << ".ExpirationTime=" << StringUtils::URLEncode(m_expirationTime.c_str()) << "&";
+      oStream << location << ".ExpirationTime=" << StringUtils::URLEncoded(m_expirationTime) << "&";
   }
   if(m_importInstanceHasBeenSet)
   {
@@ -188,16 +189,16 @@ void ConversionTask::OutputToStream(Aws::OStream& oStream, const char* location)
   }
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
   if(m_tagsHasBeenSet)
   {
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
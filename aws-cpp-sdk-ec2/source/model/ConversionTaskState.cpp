@@ -29,31 +29,35 @@ namespace Aws
       namespace ConversionTaskStateMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int cancelling_HASH = HashingUtils::HashString("cancelling");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int completed_HASH = HashingUtils::HashString("completed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int active_HASH = -1422950650;
+        static const int cancelling_HASH = 1889341808;
+        static const int cancelled_HASH = 476588369;
+        static const int completed_HASH = -1402931637;
 
 
         ConversionTaskState GetConversionTaskStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
+          switch (hashCode)
           {
+          case active_HASH:
             return ConversionTaskState::active;
-          }
-          else if (hashCode == cancelling_HASH)
-          {
+          case cancelling_HASH:
             return ConversionTaskState::cancelling;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
+          case cancelled_HASH:
             return ConversionTaskState::cancelled;
-          }
-          else if (hashCode == completed_HASH)
-          {
+          case completed_HASH:
             return ConversionTaskState::completed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CopyImageRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -35,7 +36,7 @@ CopyImageRequest::CopyImageRequest() :
 
 Aws::String CopyImageRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CopyImage&";
   if(m_dryRunHasBeenSet)
   {
@@ -44,27 +45,27 @@ Aws::String CopyImageRequest::SerializePayload() const
 
   if(m_sourceRegionHasBeenSet)
   {
-    ss << "SourceRegion=" << StringUtils::URLEncode(m_sourceRegion.c_str()) << "&";
+    ss << "SourceRegion=" << StringUtils::URLEncoded(m_sourceRegion) << "&";
   }
 
   if(m_sourceImageIdHasBeenSet)
   {
-    ss << "SourceImageId=" << StringUtils::URLEncode(m_sourceImageId.c_str()) << "&";
+    ss << "SourceImageId=" << StringUtils::URLEncoded(m_sourceImageId) << "&";
   }
 
   if(m_nameHasBeenSet)
   {
-    ss << "Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+    ss << "Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_clientTokenHasBeenSet)
   {
-    ss << "ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+    ss << "ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   if(m_encryptedHasBeenSet)
@@ -74,10 +75,10 @@ Aws::String CopyImageRequest::SerializePayload() const
 
   if(m_kmsKeyIdHasBeenSet)
   {
-    ss << "KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+    ss << "KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CopyImageResponse& CopyImageResponse::operator =(const AmazonWebServiceResult<Xm
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CopyImageResponse")
+  if (rootNode.GetNameView() != "CopyImageResponse")
   {
     resultNode = rootNode.FirstChild("CopyImageResponse");
   }
@@ -50,7 +50,7 @@ CopyImageResponse& CopyImageResponse::operator =(const AmazonWebServiceResult<Xm
     XmlNode imageIdNode = resultNode.FirstChild("imageId");
     if(!imageIdNode.IsNull())
     {
-      m_imageId = StringUtils::Trim(imageIdNode.GetText().c_str());
+      m_imageId = imageIdNode.GetTextView().Trim().ToString();
     }
   }
 
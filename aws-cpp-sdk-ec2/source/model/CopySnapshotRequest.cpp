@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CopySnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -35,7 +36,7 @@ CopySnapshotRequest::CopySnapshotRequest() :
 
 Aws::String CopySnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CopySnapshot&";
   if(m_dryRunHasBeenSet)
   {
@@ -44,27 +45,27 @@ Aws::String CopySnapshotRequest::SerializePayload() const
 
   if(m_sourceRegionHasBeenSet)
   {
-    ss << "SourceRegion=" << StringUtils::URLEncode(m_sourceRegion.c_str()) << "&";
+    ss << "SourceRegion=" << StringUtils::URLEncoded(m_sourceRegion) << "&";
   }
 
   if(m_sourceSnapshotIdHasBeenSet)
   {
-    ss << "SourceSnapshotId=" << StringUtils::URLEncode(m_sourceSnapshotId.c_str()) << "&";
+    ss << "SourceSnapshotId=" << StringUtils::URLEncoded(m_sourceSnapshotId) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_destinationRegionHasBeenSet)
   {
-    ss << "DestinationRegion=" << StringUtils::URLEncode(m_destinationRegion.c_str()) << "&";
+    ss << "DestinationRegion=" << StringUtils::URLEncoded(m_destinationRegion) << "&";
   }
 
   if(m_presignedUrlHasBeenSet)
   {
-    ss << "PresignedUrl=" << StringUtils::URLEncode(m_presignedUrl.c_str()) << "&";
+    ss << "PresignedUrl=" << StringUtils::URLEncoded(m_presignedUrl) << "&";
   }
 
   if(m_encryptedHasBeenSet)
@@ -74,10 +75,10 @@ Aws::String CopySnapshotRequest::SerializePayload() const
 
   if(m_kmsKeyIdHasBeenSet)
   {
-    ss << "KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+    ss << "KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CopySnapshotResponse& CopySnapshotResponse::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CopySnapshotResponse")
+  if (rootNode.GetNameView() != "CopySnapshotResponse")
   {
     resultNode = rootNode.FirstChild("CopySnapshotResponse");
   }
@@ -50,7 +50,7 @@ CopySnapshotResponse& CopySnapshotResponse::operator =(const AmazonWebServiceRes
     XmlNode snapshotIdNode = resultNode.FirstChild("snapshotId");
     if(!snapshotIdNode.IsNull())
     {
-      m_snapshotId = StringUtils::Trim(snapshotIdNode.GetText().c_str());
+      m_snapshotId = snapshotIdNode.GetTextView().Trim().ToString();
     }
   }
 
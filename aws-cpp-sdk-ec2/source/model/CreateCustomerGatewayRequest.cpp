@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateCustomerGatewayRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -31,7 +32,7 @@ CreateCustomerGatewayRequest::CreateCustomerGatewayRequest() :
 
 Aws::String CreateCustomerGatewayRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateCustomerGateway&";
   if(m_dryRunHasBeenSet)
   {
@@ -45,7 +46,7 @@ Aws::String CreateCustomerGatewayRequest::SerializePayload() const
 
   if(m_publicIpHasBeenSet)
   {
-    ss << "PublicIp=" << StringUtils::URLEncode(m_publicIp.c_str()) << "&";
+    ss << "PublicIp=" << StringUtils::URLEncoded(m_publicIp) << "&";
   }
 
   if(m_bgpAsnHasBeenSet)
@@ -54,6 +55,6 @@ Aws::String CreateCustomerGatewayRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
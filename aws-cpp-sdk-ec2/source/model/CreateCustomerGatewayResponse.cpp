@@ -40,7 +40,7 @@ CreateCustomerGatewayResponse& CreateCustomerGatewayResponse::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateCustomerGatewayResponse")
+  if (rootNode.GetNameView() != "CreateCustomerGatewayResponse")
   {
     resultNode = rootNode.FirstChild("CreateCustomerGatewayResponse");
   }
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateDhcpOptionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ CreateDhcpOptionsRequest::CreateDhcpOptionsRequest() :
 
 Aws::String CreateDhcpOptionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateDhcpOptions&";
   if(m_dryRunHasBeenSet)
   {
@@ -46,6 +47,6 @@ Aws::String CreateDhcpOptionsRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
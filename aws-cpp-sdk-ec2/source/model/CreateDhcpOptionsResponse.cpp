@@ -40,7 +40,7 @@ CreateDhcpOptionsResponse& CreateDhcpOptionsResponse::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateDhcpOptionsResponse")
+  if (rootNode.GetNameView() != "CreateDhcpOptionsResponse")
   {
     resultNode = rootNode.FirstChild("CreateDhcpOptionsResponse");
   }
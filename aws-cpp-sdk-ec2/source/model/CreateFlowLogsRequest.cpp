@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateFlowLogsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -31,7 +32,7 @@ CreateFlowLogsRequest::CreateFlowLogsRequest() :
 
 Aws::String CreateFlowLogsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateFlowLogs&";
   if(m_resourceIdsHasBeenSet)
   {
@@ -39,7 +40,7 @@ Aws::String CreateFlowLogsRequest::SerializePayload() const
     for(auto& item : m_resourceIds)
     {
       ss << "ResourceId." << resourceIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       resourceIdsCount++;
     }
   }
@@ -56,20 +57,20 @@ Aws::String CreateFlowLogsRequest::SerializePayload() const
 
   if(m_logGroupNameHasBeenSet)
   {
-    ss << "LogGroupName=" << StringUtils::URLEncode(m_logGroupName.c_str()) << "&";
+    ss << "LogGroupName=" << StringUtils::URLEncoded(m_logGroupName) << "&";
   }
 
   if(m_deliverLogsPermissionArnHasBeenSet)
   {
-    ss << "DeliverLogsPermissionArn=" << StringUtils::URLEncode(m_deliverLogsPermissionArn.c_str()) << "&";
+    ss << "DeliverLogsPermissionArn=" << StringUtils::URLEncoded(m_deliverLogsPermissionArn) << "&";
   }
 
   if(m_clientTokenHasBeenSet)
   {
-    ss << "ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+    ss << "ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateFlowLogsResponse& CreateFlowLogsResponse::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateFlowLogsResponse")
+  if (rootNode.GetNameView() != "CreateFlowLogsResponse")
   {
     resultNode = rootNode.FirstChild("CreateFlowLogsResponse");
   }
@@ -53,7 +53,7 @@ CreateFlowLogsResponse& CreateFlowLogsResponse::operator =(const AmazonWebServic
       XmlNode flowLogIdsMember = flowLogIdsNode.FirstChild("item");
       while(!flowLogIdsMember.IsNull())
       {
-        m_flowLogIds.push_back(StringUtils::Trim(flowLogIdsMember.GetText().c_str()));
+        m_flowLogIds.push_back(flowLogIdsMember.GetTextView().Trim().ToString());
         flowLogIdsMember = flowLogIdsMember.NextNode("item");
       }
 
@@ -61,7 +61,7 @@ CreateFlowLogsResponse& CreateFlowLogsResponse::operator =(const AmazonWebServic
     XmlNode clientTokenNode = resultNode.FirstChild("clientToken");
     if(!clientTokenNode.IsNull())
     {
-      m_clientToken = StringUtils::Trim(clientTokenNode.GetText().c_str());
+      m_clientToken = clientTokenNode.GetTextView().Trim().ToString();
     }
     XmlNode unsuccessfulNode = resultNode.FirstChild("unsuccessful");
     if(!unsuccessfulNode.IsNull())
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateImageRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -33,7 +34,7 @@ CreateImageRequest::CreateImageRequest() :
 
 Aws::String CreateImageRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateImage&";
   if(m_dryRunHasBeenSet)
   {
@@ -42,17 +43,17 @@ Aws::String CreateImageRequest::SerializePayload() const
 
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_nameHasBeenSet)
   {
-    ss << "Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+    ss << "Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_noRebootHasBeenSet)
@@ -71,6 +72,6 @@ Aws::String CreateImageRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateImageResponse& CreateImageResponse::operator =(const AmazonWebServiceResul
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateImageResponse")
+  if (rootNode.GetNameView() != "CreateImageResponse")
   {
     resultNode = rootNode.FirstChild("CreateImageResponse");
   }
@@ -50,7 +50,7 @@ CreateImageResponse& CreateImageResponse::operator =(const AmazonWebServiceResul
     XmlNode imageIdNode = resultNode.FirstChild("imageId");
     if(!imageIdNode.IsNull())
     {
-      m_imageId = StringUtils::Trim(imageIdNode.GetText().c_str());
+      m_imageId = imageIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ CreateInstanceExportTaskResponse& CreateInstanceExportTaskResponse::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateInstanceExportTaskResponse")
+  if (rootNode.GetNameView() != "CreateInstanceExportTaskResponse")
   {
     resultNode = rootNode.FirstChild("CreateInstanceExportTaskResponse");
   }
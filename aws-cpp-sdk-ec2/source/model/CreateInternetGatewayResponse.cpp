@@ -40,7 +40,7 @@ CreateInternetGatewayResponse& CreateInternetGatewayResponse::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateInternetGatewayResponse")
+  if (rootNode.GetNameView() != "CreateInternetGatewayResponse")
   {
     resultNode = rootNode.FirstChild("CreateInternetGatewayResponse");
   }
@@ -40,7 +40,7 @@ CreateKeyPairResponse& CreateKeyPairResponse::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateKeyPairResponse")
+  if (rootNode.GetNameView() != "CreateKeyPairResponse")
   {
     resultNode = rootNode.FirstChild("CreateKeyPairResponse");
   }
@@ -50,17 +50,17 @@ CreateKeyPairResponse& CreateKeyPairResponse::operator =(const AmazonWebServiceR
     XmlNode keyNameNode = resultNode.FirstChild("keyName");
     if(!keyNameNode.IsNull())
     {
-      m_keyName = StringUtils::Trim(keyNameNode.GetText().c_str());
+      m_keyName = keyNameNode.GetTextView().Trim().ToString();
     }
     XmlNode keyFingerprintNode = resultNode.FirstChild("keyFingerprint");
     if(!keyFingerprintNode.IsNull())
     {
-      m_keyFingerprint = StringUtils::Trim(keyFingerprintNode.GetText().c_str());
+      m_keyFingerprint = keyFingerprintNode.GetTextView().Trim().ToString();
     }
     XmlNode keyMaterialNode = resultNode.FirstChild("keyMaterial");
     if(!keyMaterialNode.IsNull())
     {
-      m_keyMaterial = StringUtils::Trim(keyMaterialNode.GetText().c_str());
+      m_keyMaterial = keyMaterialNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateNatGatewayRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ CreateNatGatewayRequest::CreateNatGatewayRequest() :
 
 Aws::String CreateNatGatewayRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateNatGateway&";
   if(m_subnetIdHasBeenSet)
   {
-    ss << "SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+    ss << "SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
   if(m_allocationIdHasBeenSet)
   {
-    ss << "AllocationId=" << StringUtils::URLEncode(m_allocationId.c_str()) << "&";
+    ss << "AllocationId=" << StringUtils::URLEncoded(m_allocationId) << "&";
   }
 
   if(m_clientTokenHasBeenSet)
   {
-    ss << "ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+    ss << "ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateNatGatewayResponse& CreateNatGatewayResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateNatGatewayResponse")
+  if (rootNode.GetNameView() != "CreateNatGatewayResponse")
   {
     resultNode = rootNode.FirstChild("CreateNatGatewayResponse");
   }
@@ -55,7 +55,7 @@ CreateNatGatewayResponse& CreateNatGatewayResponse::operator =(const AmazonWebSe
     XmlNode clientTokenNode = resultNode.FirstChild("clientToken");
     if(!clientTokenNode.IsNull())
     {
-      m_clientToken = StringUtils::Trim(clientTokenNode.GetText().c_str());
+      m_clientToken = clientTokenNode.GetTextView().Trim().ToString();
     }
   }
 
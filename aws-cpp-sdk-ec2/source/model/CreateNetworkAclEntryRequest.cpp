@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateNetworkAclEntryRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -37,7 +38,7 @@ CreateNetworkAclEntryRequest::CreateNetworkAclEntryRequest() :
 
 Aws::String CreateNetworkAclEntryRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateNetworkAclEntry&";
   if(m_dryRunHasBeenSet)
   {
@@ -46,7 +47,7 @@ Aws::String CreateNetworkAclEntryRequest::SerializePayload() const
 
   if(m_networkAclIdHasBeenSet)
   {
-    ss << "NetworkAclId=" << StringUtils::URLEncode(m_networkAclId.c_str()) << "&";
+    ss << "NetworkAclId=" << StringUtils::URLEncoded(m_networkAclId) << "&";
   }
 
   if(m_ruleNumberHasBeenSet)
@@ -56,7 +57,7 @@ Aws::String CreateNetworkAclEntryRequest::SerializePayload() const
 
   if(m_protocolHasBeenSet)
   {
-    ss << "Protocol=" << StringUtils::URLEncode(m_protocol.c_str()) << "&";
+    ss << "Protocol=" << StringUtils::URLEncoded(m_protocol) << "&";
   }
 
   if(m_ruleActionHasBeenSet)
@@ -71,7 +72,7 @@ Aws::String CreateNetworkAclEntryRequest::SerializePayload() const
 
   if(m_cidrBlockHasBeenSet)
   {
-    ss << "CidrBlock=" << StringUtils::URLEncode(m_cidrBlock.c_str()) << "&";
+    ss << "CidrBlock=" << StringUtils::URLEncoded(m_cidrBlock) << "&";
   }
 
   if(m_icmpTypeCodeHasBeenSet)
@@ -85,6 +86,6 @@ Aws::String CreateNetworkAclEntryRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
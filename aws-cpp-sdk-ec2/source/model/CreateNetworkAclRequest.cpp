@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateNetworkAclRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ CreateNetworkAclRequest::CreateNetworkAclRequest() :
 
 Aws::String CreateNetworkAclRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateNetworkAcl&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String CreateNetworkAclRequest::SerializePayload() const
 
   if(m_vpcIdHasBeenSet)
   {
-    ss << "VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+    ss << "VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateNetworkAclResponse& CreateNetworkAclResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateNetworkAclResponse")
+  if (rootNode.GetNameView() != "CreateNetworkAclResponse")
   {
     resultNode = rootNode.FirstChild("CreateNetworkAclResponse");
   }
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateNetworkInterfaceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -34,21 +35,21 @@ CreateNetworkInterfaceRequest::CreateNetworkInterfaceRequest() :
 
 Aws::String CreateNetworkInterfaceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateNetworkInterface&";
   if(m_subnetIdHasBeenSet)
   {
-    ss << "SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+    ss << "SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_privateIpAddressHasBeenSet)
   {
-    ss << "PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+    ss << "PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
 
   if(m_groupsHasBeenSet)
@@ -57,7 +58,7 @@ Aws::String CreateNetworkInterfaceRequest::SerializePayload() const
     for(auto& item : m_groups)
     {
       ss << "SecurityGroupId." << groupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       groupsCount++;
     }
   }
@@ -83,6 +84,6 @@ Aws::String CreateNetworkInterfaceRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
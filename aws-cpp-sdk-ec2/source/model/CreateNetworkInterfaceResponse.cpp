@@ -40,7 +40,7 @@ CreateNetworkInterfaceResponse& CreateNetworkInterfaceResponse::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateNetworkInterfaceResponse")
+  if (rootNode.GetNameView() != "CreateNetworkInterfaceResponse")
   {
     resultNode = rootNode.FirstChild("CreateNetworkInterfaceResponse");
   }
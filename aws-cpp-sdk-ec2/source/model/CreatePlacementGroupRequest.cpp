@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreatePlacementGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ CreatePlacementGroupRequest::CreatePlacementGroupRequest() :
 
 Aws::String CreatePlacementGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreatePlacementGroup&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,7 +39,7 @@ Aws::String CreatePlacementGroupRequest::SerializePayload() const
 
   if(m_groupNameHasBeenSet)
   {
-    ss << "GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+    ss << "GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   if(m_strategyHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String CreatePlacementGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
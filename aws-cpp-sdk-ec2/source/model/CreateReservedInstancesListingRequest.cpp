@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateReservedInstancesListingRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,11 +31,11 @@ CreateReservedInstancesListingRequest::CreateReservedInstancesListingRequest() :
 
 Aws::String CreateReservedInstancesListingRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateReservedInstancesListing&";
   if(m_reservedInstancesIdHasBeenSet)
   {
-    ss << "ReservedInstancesId=" << StringUtils::URLEncode(m_reservedInstancesId.c_str()) << "&";
+    ss << "ReservedInstancesId=" << StringUtils::URLEncoded(m_reservedInstancesId) << "&";
   }
 
   if(m_instanceCountHasBeenSet)
@@ -54,10 +55,10 @@ Aws::String CreateReservedInstancesListingRequest::SerializePayload() const
 
   if(m_clientTokenHasBeenSet)
   {
-    ss << "ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+    ss << "ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
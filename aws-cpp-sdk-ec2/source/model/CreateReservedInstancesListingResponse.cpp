@@ -40,7 +40,7 @@ CreateReservedInstancesListingResponse& CreateReservedInstancesListingResponse::
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateReservedInstancesListingResponse")
+  if (rootNode.GetNameView() != "CreateReservedInstancesListingResponse")
   {
     resultNode = rootNode.FirstChild("CreateReservedInstancesListingResponse");
   }
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateRouteRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -34,7 +35,7 @@ CreateRouteRequest::CreateRouteRequest() :
 
 Aws::String CreateRouteRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateRoute&";
   if(m_dryRunHasBeenSet)
   {
@@ -43,40 +44,40 @@ Aws::String CreateRouteRequest::SerializePayload() const
 
   if(m_routeTableIdHasBeenSet)
   {
-    ss << "RouteTableId=" << StringUtils::URLEncode(m_routeTableId.c_str()) << "&";
+    ss << "RouteTableId=" << StringUtils::URLEncoded(m_routeTableId) << "&";
   }
 
   if(m_destinationCidrBlockHasBeenSet)
   {
-    ss << "DestinationCidrBlock=" << StringUtils::URLEncode(m_destinationCidrBlock.c_str()) << "&";
+    ss << "DestinationCidrBlock=" << StringUtils::URLEncoded(m_destinationCidrBlock) << "&";
   }
 
   if(m_gatewayIdHasBeenSet)
   {
-    ss << "GatewayId=" << StringUtils::URLEncode(m_gatewayId.c_str()) << "&";
+    ss << "GatewayId=" << StringUtils::URLEncoded(m_gatewayId) << "&";
   }
 
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_networkInterfaceIdHasBeenSet)
   {
-    ss << "NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+    ss << "NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
 
   if(m_vpcPeeringConnectionIdHasBeenSet)
   {
-    ss << "VpcPeeringConnectionId=" << StringUtils::URLEncode(m_vpcPeeringConnectionId.c_str()) << "&";
+    ss << "VpcPeeringConnectionId=" << StringUtils::URLEncoded(m_vpcPeeringConnectionId) << "&";
   }
 
   if(m_natGatewayIdHasBeenSet)
   {
-    ss << "NatGatewayId=" << StringUtils::URLEncode(m_natGatewayId.c_str()) << "&";
+    ss << "NatGatewayId=" << StringUtils::URLEncoded(m_natGatewayId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
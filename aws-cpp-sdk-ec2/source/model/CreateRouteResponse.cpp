@@ -42,7 +42,7 @@ CreateRouteResponse& CreateRouteResponse::operator =(const AmazonWebServiceResul
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateRouteResponse")
+  if (rootNode.GetNameView() != "CreateRouteResponse")
   {
     resultNode = rootNode.FirstChild("CreateRouteResponse");
   }
@@ -52,7 +52,7 @@ CreateRouteResponse& CreateRouteResponse::operator =(const AmazonWebServiceResul
     XmlNode returnNode = resultNode.FirstChild("return");
     if(!returnNode.IsNull())
     {
-      m_return = StringUtils::ConvertToBool(StringUtils::Trim(returnNode.GetText().c_str()).c_str());
+      m_return = StringUtils::ConvertToBool(returnNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -40,7 +40,7 @@ CreateRouteTableResponse& CreateRouteTableResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateRouteTableResponse")
+  if (rootNode.GetNameView() != "CreateRouteTableResponse")
   {
     resultNode = rootNode.FirstChild("CreateRouteTableResponse");
   }
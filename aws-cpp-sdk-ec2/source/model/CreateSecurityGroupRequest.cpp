@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateSecurityGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ CreateSecurityGroupRequest::CreateSecurityGroupRequest() :
 
 Aws::String CreateSecurityGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateSecurityGroup&";
   if(m_dryRunHasBeenSet)
   {
@@ -39,20 +40,20 @@ Aws::String CreateSecurityGroupRequest::SerializePayload() const
 
   if(m_groupNameHasBeenSet)
   {
-    ss << "GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+    ss << "GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-    ss << "VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+    ss << "VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
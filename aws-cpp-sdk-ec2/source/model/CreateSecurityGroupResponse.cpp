@@ -40,7 +40,7 @@ CreateSecurityGroupResponse& CreateSecurityGroupResponse::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateSecurityGroupResponse")
+  if (rootNode.GetNameView() != "CreateSecurityGroupResponse")
   {
     resultNode = rootNode.FirstChild("CreateSecurityGroupResponse");
   }
@@ -50,7 +50,7 @@ CreateSecurityGroupResponse& CreateSecurityGroupResponse::operator =(const Amazo
     XmlNode groupIdNode = resultNode.FirstChild("groupId");
     if(!groupIdNode.IsNull())
     {
-      m_groupId = StringUtils::Trim(groupIdNode.GetText().c_str());
+      m_groupId = groupIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ CreateSnapshotRequest::CreateSnapshotRequest() :
 
 Aws::String CreateSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateSnapshot&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String CreateSnapshotRequest::SerializePayload() const
 
   if(m_volumeIdHasBeenSet)
   {
-    ss << "VolumeId=" << StringUtils::URLEncode(m_volumeId.c_str()) << "&";
+    ss << "VolumeId=" << StringUtils::URLEncoded(m_volumeId) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateSpotDatafeedSubscriptionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ CreateSpotDatafeedSubscriptionRequest::CreateSpotDatafeedSubscriptionRequest() :
 
 Aws::String CreateSpotDatafeedSubscriptionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateSpotDatafeedSubscription&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String CreateSpotDatafeedSubscriptionRequest::SerializePayload() const
 
   if(m_bucketHasBeenSet)
   {
-    ss << "Bucket=" << StringUtils::URLEncode(m_bucket.c_str()) << "&";
+    ss << "Bucket=" << StringUtils::URLEncoded(m_bucket) << "&";
   }
 
   if(m_prefixHasBeenSet)
   {
-    ss << "Prefix=" << StringUtils::URLEncode(m_prefix.c_str()) << "&";
+    ss << "Prefix=" << StringUtils::URLEncoded(m_prefix) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
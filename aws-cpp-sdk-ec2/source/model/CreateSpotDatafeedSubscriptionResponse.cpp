@@ -40,7 +40,7 @@ CreateSpotDatafeedSubscriptionResponse& CreateSpotDatafeedSubscriptionResponse::
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateSpotDatafeedSubscriptionResponse")
+  if (rootNode.GetNameView() != "CreateSpotDatafeedSubscriptionResponse")
   {
     resultNode = rootNode.FirstChild("CreateSpotDatafeedSubscriptionResponse");
   }
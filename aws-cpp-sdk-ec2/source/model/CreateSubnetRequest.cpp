@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateSubnetRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ CreateSubnetRequest::CreateSubnetRequest() :
 
 Aws::String CreateSubnetRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateSubnet&";
   if(m_dryRunHasBeenSet)
   {
@@ -39,20 +40,20 @@ Aws::String CreateSubnetRequest::SerializePayload() const
 
   if(m_vpcIdHasBeenSet)
   {
-    ss << "VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+    ss << "VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_cidrBlockHasBeenSet)
   {
-    ss << "CidrBlock=" << StringUtils::URLEncode(m_cidrBlock.c_str()) << "&";
+    ss << "CidrBlock=" << StringUtils::URLEncoded(m_cidrBlock) << "&";
   }
 
   if(m_availabilityZoneHasBeenSet)
   {
-    ss << "AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+    ss << "AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
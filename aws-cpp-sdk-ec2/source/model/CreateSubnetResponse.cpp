@@ -40,7 +40,7 @@ CreateSubnetResponse& CreateSubnetResponse::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateSubnetResponse")
+  if (rootNode.GetNameView() != "CreateSubnetResponse")
   {
     resultNode = rootNode.FirstChild("CreateSubnetResponse");
   }
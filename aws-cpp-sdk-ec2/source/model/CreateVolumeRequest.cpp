@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateVolumeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -37,7 +38,7 @@ CreateVolumeRequest::CreateVolumeRequest() :
 
 Aws::String CreateVolumeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateVolume&";
   if(m_dryRunHasBeenSet)
   {
@@ -51,12 +52,12 @@ Aws::String CreateVolumeRequest::SerializePayload() const
 
   if(m_snapshotIdHasBeenSet)
   {
-    ss << "SnapshotId=" << StringUtils::URLEncode(m_snapshotId.c_str()) << "&";
+    ss << "SnapshotId=" << StringUtils::URLEncoded(m_snapshotId) << "&";
   }
 
   if(m_availabilityZoneHasBeenSet)
   {
-    ss << "AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+    ss << "AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_volumeTypeHasBeenSet)
@@ -76,10 +77,10 @@ Aws::String CreateVolumeRequest::SerializePayload() const
 
   if(m_kmsKeyIdHasBeenSet)
   {
-    ss << "KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+    ss << "KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
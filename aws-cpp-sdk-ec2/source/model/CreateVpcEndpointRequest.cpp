@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateVpcEndpointRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -32,7 +33,7 @@ CreateVpcEndpointRequest::CreateVpcEndpointRequest() :
 
 Aws::String CreateVpcEndpointRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateVpcEndpoint&";
   if(m_dryRunHasBeenSet)
   {
@@ -41,17 +42,17 @@ Aws::String CreateVpcEndpointRequest::SerializePayload() const
 
   if(m_vpcIdHasBeenSet)
   {
-    ss << "VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+    ss << "VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_serviceNameHasBeenSet)
   {
-    ss << "ServiceName=" << StringUtils::URLEncode(m_serviceName.c_str()) << "&";
+    ss << "ServiceName=" << StringUtils::URLEncoded(m_serviceName) << "&";
   }
 
   if(m_policyDocumentHasBeenSet)
   {
-    ss << "PolicyDocument=" << StringUtils::URLEncode(m_policyDocument.c_str()) << "&";
+    ss << "PolicyDocument=" << StringUtils::URLEncoded(m_policyDocument) << "&";
   }
 
   if(m_routeTableIdsHasBeenSet)
@@ -60,17 +61,17 @@ Aws::String CreateVpcEndpointRequest::SerializePayload() const
     for(auto& item : m_routeTableIds)
     {
       ss << "RouteTableId." << routeTableIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       routeTableIdsCount++;
     }
   }
 
   if(m_clientTokenHasBeenSet)
   {
-    ss << "ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+    ss << "ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
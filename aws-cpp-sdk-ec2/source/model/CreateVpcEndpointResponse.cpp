@@ -40,7 +40,7 @@ CreateVpcEndpointResponse& CreateVpcEndpointResponse::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateVpcEndpointResponse")
+  if (rootNode.GetNameView() != "CreateVpcEndpointResponse")
   {
     resultNode = rootNode.FirstChild("CreateVpcEndpointResponse");
   }
@@ -55,7 +55,7 @@ CreateVpcEndpointResponse& CreateVpcEndpointResponse::operator =(const AmazonWeb
     XmlNode clientTokenNode = resultNode.FirstChild("clientToken");
     if(!clientTokenNode.IsNull())
     {
-      m_clientToken = StringUtils::Trim(clientTokenNode.GetText().c_str());
+      m_clientToken = clientTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateVpcPeeringConnectionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ CreateVpcPeeringConnectionRequest::CreateVpcPeeringConnectionRequest() :
 
 Aws::String CreateVpcPeeringConnectionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateVpcPeeringConnection&";
   if(m_dryRunHasBeenSet)
   {
@@ -39,20 +40,20 @@ Aws::String CreateVpcPeeringConnectionRequest::SerializePayload() const
 
   if(m_vpcIdHasBeenSet)
   {
-    ss << "VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+    ss << "VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_peerVpcIdHasBeenSet)
   {
-    ss << "PeerVpcId=" << StringUtils::URLEncode(m_peerVpcId.c_str()) << "&";
+    ss << "PeerVpcId=" << StringUtils::URLEncoded(m_peerVpcId) << "&";
   }
 
   if(m_peerOwnerIdHasBeenSet)
   {
-    ss << "PeerOwnerId=" << StringUtils::URLEncode(m_peerOwnerId.c_str()) << "&";
+    ss << "PeerOwnerId=" << StringUtils::URLEncoded(m_peerOwnerId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateVpcPeeringConnectionResponse& CreateVpcPeeringConnectionResponse::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateVpcPeeringConnectionResponse")
+  if (rootNode.GetNameView() != "CreateVpcPeeringConnectionResponse")
   {
     resultNode = rootNode.FirstChild("CreateVpcPeeringConnectionResponse");
   }
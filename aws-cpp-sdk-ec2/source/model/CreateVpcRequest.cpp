@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateVpcRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ CreateVpcRequest::CreateVpcRequest() :
 
 Aws::String CreateVpcRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateVpc&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,7 +39,7 @@ Aws::String CreateVpcRequest::SerializePayload() const
 
   if(m_cidrBlockHasBeenSet)
   {
-    ss << "CidrBlock=" << StringUtils::URLEncode(m_cidrBlock.c_str()) << "&";
+    ss << "CidrBlock=" << StringUtils::URLEncoded(m_cidrBlock) << "&";
   }
 
   if(m_instanceTenancyHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String CreateVpcRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateVpcResponse& CreateVpcResponse::operator =(const AmazonWebServiceResult<Xm
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateVpcResponse")
+  if (rootNode.GetNameView() != "CreateVpcResponse")
   {
     resultNode = rootNode.FirstChild("CreateVpcResponse");
   }
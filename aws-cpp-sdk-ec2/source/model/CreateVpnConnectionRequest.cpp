@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateVpnConnectionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -31,7 +32,7 @@ CreateVpnConnectionRequest::CreateVpnConnectionRequest() :
 
 Aws::String CreateVpnConnectionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateVpnConnection&";
   if(m_dryRunHasBeenSet)
   {
@@ -40,17 +41,17 @@ Aws::String CreateVpnConnectionRequest::SerializePayload() const
 
   if(m_typeHasBeenSet)
   {
-    ss << "Type=" << StringUtils::URLEncode(m_type.c_str()) << "&";
+    ss << "Type=" << StringUtils::URLEncoded(m_type) << "&";
   }
 
   if(m_customerGatewayIdHasBeenSet)
   {
-    ss << "CustomerGatewayId=" << StringUtils::URLEncode(m_customerGatewayId.c_str()) << "&";
+    ss << "CustomerGatewayId=" << StringUtils::URLEncoded(m_customerGatewayId) << "&";
   }
 
   if(m_vpnGatewayIdHasBeenSet)
   {
-    ss << "VpnGatewayId=" << StringUtils::URLEncode(m_vpnGatewayId.c_str()) << "&";
+    ss << "VpnGatewayId=" << StringUtils::URLEncoded(m_vpnGatewayId) << "&";
   }
 
   if(m_optionsHasBeenSet)
@@ -59,6 +60,6 @@ Aws::String CreateVpnConnectionRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
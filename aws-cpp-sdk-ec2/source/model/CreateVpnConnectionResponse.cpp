@@ -40,7 +40,7 @@ CreateVpnConnectionResponse& CreateVpnConnectionResponse::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateVpnConnectionResponse")
+  if (rootNode.GetNameView() != "CreateVpnConnectionResponse")
   {
     resultNode = rootNode.FirstChild("CreateVpnConnectionResponse");
   }
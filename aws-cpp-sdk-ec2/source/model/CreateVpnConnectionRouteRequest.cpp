@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateVpnConnectionRouteRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ CreateVpnConnectionRouteRequest::CreateVpnConnectionRouteRequest() :
 
 Aws::String CreateVpnConnectionRouteRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateVpnConnectionRoute&";
   if(m_vpnConnectionIdHasBeenSet)
   {
-    ss << "VpnConnectionId=" << StringUtils::URLEncode(m_vpnConnectionId.c_str()) << "&";
+    ss << "VpnConnectionId=" << StringUtils::URLEncoded(m_vpnConnectionId) << "&";
   }
 
   if(m_destinationCidrBlockHasBeenSet)
   {
-    ss << "DestinationCidrBlock=" << StringUtils::URLEncode(m_destinationCidrBlock.c_str()) << "&";
+    ss << "DestinationCidrBlock=" << StringUtils::URLEncoded(m_destinationCidrBlock) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
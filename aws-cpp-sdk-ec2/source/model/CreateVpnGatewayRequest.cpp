@@ -15,6 +15,7 @@
 #include <aws/ec2/model/CreateVpnGatewayRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ CreateVpnGatewayRequest::CreateVpnGatewayRequest() :
 
 Aws::String CreateVpnGatewayRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateVpnGateway&";
   if(m_dryRunHasBeenSet)
   {
@@ -43,10 +44,10 @@ Aws::String CreateVpnGatewayRequest::SerializePayload() const
 
   if(m_availabilityZoneHasBeenSet)
   {
-    ss << "AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+    ss << "AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
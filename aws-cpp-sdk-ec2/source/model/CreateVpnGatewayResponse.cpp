@@ -40,7 +40,7 @@ CreateVpnGatewayResponse& CreateVpnGatewayResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateVpnGatewayResponse")
+  if (rootNode.GetNameView() != "CreateVpnGatewayResponse")
   {
     resultNode = rootNode.FirstChild("CreateVpnGatewayResponse");
   }
@@ -29,16 +29,26 @@ namespace Aws
       namespace CurrencyCodeValuesMapper
       {
 
-        static const int USD_HASH = HashingUtils::HashString("USD");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int USD_HASH = 84326;
 
 
         CurrencyCodeValues GetCurrencyCodeValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USD_HASH)
+          switch (hashCode)
           {
+          case USD_HASH:
             return CurrencyCodeValues::USD;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,31 +60,31 @@ CustomerGateway& CustomerGateway::operator =(const XmlNode& xmlNode)
     XmlNode customerGatewayIdNode = resultNode.FirstChild("customerGatewayId");
     if(!customerGatewayIdNode.IsNull())
     {
-      m_customerGatewayId = StringUtils::Trim(customerGatewayIdNode.GetText().c_str());
+      m_customerGatewayId = customerGatewayIdNode.GetTextView().Trim().ToString();
       m_customerGatewayIdHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = StringUtils::Trim(stateNode.GetText().c_str());
+      m_state = stateNode.GetTextView().Trim().ToString();
       m_stateHasBeenSet = true;
     }
     XmlNode typeNode = resultNode.FirstChild("type");
     if(!typeNode.IsNull())
     {
-      m_type = StringUtils::Trim(typeNode.GetText().c_str());
+      m_type = typeNode.GetTextView().Trim().ToString();
       m_typeHasBeenSet = true;
     }
     XmlNode ipAddressNode = resultNode.FirstChild("ipAddress");
     if(!ipAddressNode.IsNull())
     {
-      m_ipAddress = StringUtils::Trim(ipAddressNode.GetText().c_str());
+      m_ipAddress = ipAddressNode.GetTextView().Trim().ToString();
       m_ipAddressHasBeenSet = true;
     }
     XmlNode bgpAsnNode = resultNode.FirstChild("bgpAsn");
     if(!bgpAsnNode.IsNull())
     {
-      m_bgpAsn = StringUtils::Trim(bgpAsnNode.GetText().c_str());
+      m_bgpAsn = bgpAsnNode.GetTextView().Trim().ToString();
       m_bgpAsnHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("tagSet");
@@ -107,27 +108,27 @@ void CustomerGateway::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_customerGatewayIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CustomerGatewayId=" << StringUtils::URLEncode(m_customerGatewayId.c_str()) << "&";
+      oStream << location << index << locationValue << ".CustomerGatewayId=" << StringUtils::URLEncoded(m_customerGatewayId) << "&";
   }
 
   if(m_stateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".State=" << StringUtils::URLEncode(m_state.c_str()) << "&";
+      oStream << location << index << locationValue << ".State=" << StringUtils::URLEncoded(m_state) << "&";
   }
 
   if(m_typeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Type=" << StringUtils::URLEncode(m_type.c_str()) << "&";
+      oStream << location << index << locationValue << ".Type=" << StringUtils::URLEncoded(m_type) << "&";
   }
 
   if(m_ipAddressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".IpAddress=" << StringUtils::URLEncode(m_ipAddress.c_str()) << "&";
+      oStream << location << index << locationValue << ".IpAddress=" << StringUtils::URLEncoded(m_ipAddress) << "&";
   }
 
   if(m_bgpAsnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".BgpAsn=" << StringUtils::URLEncode(m_bgpAsn.c_str()) << "&";
+      oStream << location << index << locationValue << ".BgpAsn=" << StringUtils::URLEncoded(m_bgpAsn) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -135,9 +136,9 @@ void CustomerGateway::OutputToStream(Aws::OStream& oStream, const char* location
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -147,32 +148,32 @@ void CustomerGateway::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_customerGatewayIdHasBeenSet)
   {
-      oStream << location << ".CustomerGatewayId=" << StringUtils::URLEncode(m_customerGatewayId.c_str()) << "&";
+      oStream << location << ".CustomerGatewayId=" << StringUtils::URLEncoded(m_customerGatewayId) << "&";
   }
   if(m_stateHasBeenSet)
   {
-      oStream << location << ".State=" << StringUtils::URLEncode(m_state.c_str()) << "&";
+      oStream << location << ".State=" << StringUtils::URLEncoded(m_state) << "&";
   }
   if(m_typeHasBeenSet)
   {
-      oStream << location << ".Type=" << StringUtils::URLEncode(m_type.c_str()) << "&";
+      oStream << location << ".Type=" << StringUtils::URLEncoded(m_type) << "&";
   }
   if(m_ipAddressHasBeenSet)
   {
-      oStream << location << ".IpAddress=" << StringUtils::URLEncode(m_ipAddress.c_str()) << "&";
+      oStream << location << ".IpAddress=" << StringUtils::URLEncoded(m_ipAddress) << "&";
   }
   if(m_bgpAsnHasBeenSet)
   {
-      oStream << location << ".BgpAsn=" << StringUtils::URLEncode(m_bgpAsn.c_str()) << "&";
+      oStream << location << ".BgpAsn=" << StringUtils::URLEncoded(m_bgpAsn) << "&";
   }
   if(m_tagsHasBeenSet)
   {
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
@@ -29,21 +29,29 @@ namespace Aws
       namespace DatafeedSubscriptionStateMapper
       {
 
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int Inactive_HASH = HashingUtils::HashString("Inactive");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Active_HASH = 1955883814;
+        static const int Inactive_HASH = 89309323;
 
 
         DatafeedSubscriptionState GetDatafeedSubscriptionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Active_HASH)
+          switch (hashCode)
           {
+          case Active_HASH:
             return DatafeedSubscriptionState::Active;
-          }
-          else if (hashCode == Inactive_HASH)
-          {
+          case Inactive_HASH:
             return DatafeedSubscriptionState::Inactive;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteCustomerGatewayRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DeleteCustomerGatewayRequest::DeleteCustomerGatewayRequest() :
 
 Aws::String DeleteCustomerGatewayRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteCustomerGateway&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String DeleteCustomerGatewayRequest::SerializePayload() const
 
   if(m_customerGatewayIdHasBeenSet)
   {
-    ss << "CustomerGatewayId=" << StringUtils::URLEncode(m_customerGatewayId.c_str()) << "&";
+    ss << "CustomerGatewayId=" << StringUtils::URLEncoded(m_customerGatewayId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
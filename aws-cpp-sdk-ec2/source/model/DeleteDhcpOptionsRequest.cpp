@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteDhcpOptionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DeleteDhcpOptionsRequest::DeleteDhcpOptionsRequest() :
 
 Aws::String DeleteDhcpOptionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteDhcpOptions&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String DeleteDhcpOptionsRequest::SerializePayload() const
 
   if(m_dhcpOptionsIdHasBeenSet)
   {
-    ss << "DhcpOptionsId=" << StringUtils::URLEncode(m_dhcpOptionsId.c_str()) << "&";
+    ss << "DhcpOptionsId=" << StringUtils::URLEncoded(m_dhcpOptionsId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
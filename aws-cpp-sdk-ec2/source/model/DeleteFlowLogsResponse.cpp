@@ -40,7 +40,7 @@ DeleteFlowLogsResponse& DeleteFlowLogsResponse::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteFlowLogsResponse")
+  if (rootNode.GetNameView() != "DeleteFlowLogsResponse")
   {
     resultNode = rootNode.FirstChild("DeleteFlowLogsResponse");
   }
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteInternetGatewayRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DeleteInternetGatewayRequest::DeleteInternetGatewayRequest() :
 
 Aws::String DeleteInternetGatewayRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteInternetGateway&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String DeleteInternetGatewayRequest::SerializePayload() const
 
   if(m_internetGatewayIdHasBeenSet)
   {
-    ss << "InternetGatewayId=" << StringUtils::URLEncode(m_internetGatewayId.c_str()) << "&";
+    ss << "InternetGatewayId=" << StringUtils::URLEncoded(m_internetGatewayId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
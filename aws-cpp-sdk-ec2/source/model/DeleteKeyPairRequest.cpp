@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteKeyPairRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DeleteKeyPairRequest::DeleteKeyPairRequest() :
 
 Aws::String DeleteKeyPairRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteKeyPair&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String DeleteKeyPairRequest::SerializePayload() const
 
   if(m_keyNameHasBeenSet)
   {
-    ss << "KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+    ss << "KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteNatGatewayRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteNatGatewayRequest::DeleteNatGatewayRequest() :
 
 Aws::String DeleteNatGatewayRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteNatGateway&";
   if(m_natGatewayIdHasBeenSet)
   {
-    ss << "NatGatewayId=" << StringUtils::URLEncode(m_natGatewayId.c_str()) << "&";
+    ss << "NatGatewayId=" << StringUtils::URLEncoded(m_natGatewayId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
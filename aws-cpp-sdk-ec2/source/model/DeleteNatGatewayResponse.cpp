@@ -40,7 +40,7 @@ DeleteNatGatewayResponse& DeleteNatGatewayResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteNatGatewayResponse")
+  if (rootNode.GetNameView() != "DeleteNatGatewayResponse")
   {
     resultNode = rootNode.FirstChild("DeleteNatGatewayResponse");
   }
@@ -50,7 +50,7 @@ DeleteNatGatewayResponse& DeleteNatGatewayResponse::operator =(const AmazonWebSe
     XmlNode natGatewayIdNode = resultNode.FirstChild("natGatewayId");
     if(!natGatewayIdNode.IsNull())
     {
-      m_natGatewayId = StringUtils::Trim(natGatewayIdNode.GetText().c_str());
+      m_natGatewayId = natGatewayIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteNetworkAclEntryRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -32,7 +33,7 @@ DeleteNetworkAclEntryRequest::DeleteNetworkAclEntryRequest() :
 
 Aws::String DeleteNetworkAclEntryRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteNetworkAclEntry&";
   if(m_dryRunHasBeenSet)
   {
@@ -41,7 +42,7 @@ Aws::String DeleteNetworkAclEntryRequest::SerializePayload() const
 
   if(m_networkAclIdHasBeenSet)
   {
-    ss << "NetworkAclId=" << StringUtils::URLEncode(m_networkAclId.c_str()) << "&";
+    ss << "NetworkAclId=" << StringUtils::URLEncoded(m_networkAclId) << "&";
   }
 
   if(m_ruleNumberHasBeenSet)
@@ -55,6 +56,6 @@ Aws::String DeleteNetworkAclEntryRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
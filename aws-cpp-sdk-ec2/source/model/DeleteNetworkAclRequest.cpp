@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteNetworkAclRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DeleteNetworkAclRequest::DeleteNetworkAclRequest() :
 
 Aws::String DeleteNetworkAclRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteNetworkAcl&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String DeleteNetworkAclRequest::SerializePayload() const
 
   if(m_networkAclIdHasBeenSet)
   {
-    ss << "NetworkAclId=" << StringUtils::URLEncode(m_networkAclId.c_str()) << "&";
+    ss << "NetworkAclId=" << StringUtils::URLEncoded(m_networkAclId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
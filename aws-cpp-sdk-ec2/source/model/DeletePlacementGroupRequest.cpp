@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeletePlacementGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DeletePlacementGroupRequest::DeletePlacementGroupRequest() :
 
 Aws::String DeletePlacementGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeletePlacementGroup&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String DeletePlacementGroupRequest::SerializePayload() const
 
   if(m_groupNameHasBeenSet)
   {
-    ss << "GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+    ss << "GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteRouteRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ DeleteRouteRequest::DeleteRouteRequest() :
 
 Aws::String DeleteRouteRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteRoute&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String DeleteRouteRequest::SerializePayload() const
 
   if(m_routeTableIdHasBeenSet)
   {
-    ss << "RouteTableId=" << StringUtils::URLEncode(m_routeTableId.c_str()) << "&";
+    ss << "RouteTableId=" << StringUtils::URLEncoded(m_routeTableId) << "&";
   }
 
   if(m_destinationCidrBlockHasBeenSet)
   {
-    ss << "DestinationCidrBlock=" << StringUtils::URLEncode(m_destinationCidrBlock.c_str()) << "&";
+    ss << "DestinationCidrBlock=" << StringUtils::URLEncoded(m_destinationCidrBlock) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
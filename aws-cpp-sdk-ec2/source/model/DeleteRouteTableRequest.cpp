@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteRouteTableRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DeleteRouteTableRequest::DeleteRouteTableRequest() :
 
 Aws::String DeleteRouteTableRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteRouteTable&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String DeleteRouteTableRequest::SerializePayload() const
 
   if(m_routeTableIdHasBeenSet)
   {
-    ss << "RouteTableId=" << StringUtils::URLEncode(m_routeTableId.c_str()) << "&";
+    ss << "RouteTableId=" << StringUtils::URLEncoded(m_routeTableId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
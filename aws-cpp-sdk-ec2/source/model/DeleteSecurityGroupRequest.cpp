@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteSecurityGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ DeleteSecurityGroupRequest::DeleteSecurityGroupRequest() :
 
 Aws::String DeleteSecurityGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteSecurityGroup&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String DeleteSecurityGroupRequest::SerializePayload() const
 
   if(m_groupNameHasBeenSet)
   {
-    ss << "GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+    ss << "GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   if(m_groupIdHasBeenSet)
   {
-    ss << "GroupId=" << StringUtils::URLEncode(m_groupId.c_str()) << "&";
+    ss << "GroupId=" << StringUtils::URLEncoded(m_groupId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DeleteSnapshotRequest::DeleteSnapshotRequest() :
 
 Aws::String DeleteSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteSnapshot&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String DeleteSnapshotRequest::SerializePayload() const
 
   if(m_snapshotIdHasBeenSet)
   {
-    ss << "SnapshotId=" << StringUtils::URLEncode(m_snapshotId.c_str()) << "&";
+    ss << "SnapshotId=" << StringUtils::URLEncoded(m_snapshotId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
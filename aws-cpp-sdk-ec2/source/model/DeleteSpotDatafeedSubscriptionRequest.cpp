@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteSpotDatafeedSubscriptionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -27,7 +28,7 @@ DeleteSpotDatafeedSubscriptionRequest::DeleteSpotDatafeedSubscriptionRequest() :
 
 Aws::String DeleteSpotDatafeedSubscriptionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteSpotDatafeedSubscription&";
   if(m_dryRunHasBeenSet)
   {
@@ -35,6 +36,6 @@ Aws::String DeleteSpotDatafeedSubscriptionRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
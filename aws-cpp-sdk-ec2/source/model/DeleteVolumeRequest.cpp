@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteVolumeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DeleteVolumeRequest::DeleteVolumeRequest() :
 
 Aws::String DeleteVolumeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteVolume&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String DeleteVolumeRequest::SerializePayload() const
 
   if(m_volumeIdHasBeenSet)
   {
-    ss << "VolumeId=" << StringUtils::URLEncode(m_volumeId.c_str()) << "&";
+    ss << "VolumeId=" << StringUtils::URLEncoded(m_volumeId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
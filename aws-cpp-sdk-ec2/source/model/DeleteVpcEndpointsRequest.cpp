@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteVpcEndpointsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DeleteVpcEndpointsRequest::DeleteVpcEndpointsRequest() :
 
 Aws::String DeleteVpcEndpointsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteVpcEndpoints&";
   if(m_dryRunHasBeenSet)
   {
@@ -41,12 +42,12 @@ Aws::String DeleteVpcEndpointsRequest::SerializePayload() const
     for(auto& item : m_vpcEndpointIds)
     {
       ss << "VpcEndpointId." << vpcEndpointIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       vpcEndpointIdsCount++;
     }
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
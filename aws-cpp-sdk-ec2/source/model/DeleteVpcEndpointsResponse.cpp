@@ -40,7 +40,7 @@ DeleteVpcEndpointsResponse& DeleteVpcEndpointsResponse::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteVpcEndpointsResponse")
+  if (rootNode.GetNameView() != "DeleteVpcEndpointsResponse")
   {
     resultNode = rootNode.FirstChild("DeleteVpcEndpointsResponse");
   }
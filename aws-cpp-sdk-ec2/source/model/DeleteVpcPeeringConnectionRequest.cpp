@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteVpcPeeringConnectionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DeleteVpcPeeringConnectionRequest::DeleteVpcPeeringConnectionRequest() :
 
 Aws::String DeleteVpcPeeringConnectionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteVpcPeeringConnection&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String DeleteVpcPeeringConnectionRequest::SerializePayload() const
 
   if(m_vpcPeeringConnectionIdHasBeenSet)
   {
-    ss << "VpcPeeringConnectionId=" << StringUtils::URLEncode(m_vpcPeeringConnectionId.c_str()) << "&";
+    ss << "VpcPeeringConnectionId=" << StringUtils::URLEncoded(m_vpcPeeringConnectionId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
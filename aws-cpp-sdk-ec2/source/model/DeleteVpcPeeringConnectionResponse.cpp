@@ -42,7 +42,7 @@ DeleteVpcPeeringConnectionResponse& DeleteVpcPeeringConnectionResponse::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteVpcPeeringConnectionResponse")
+  if (rootNode.GetNameView() != "DeleteVpcPeeringConnectionResponse")
   {
     resultNode = rootNode.FirstChild("DeleteVpcPeeringConnectionResponse");
   }
@@ -52,7 +52,7 @@ DeleteVpcPeeringConnectionResponse& DeleteVpcPeeringConnectionResponse::operator
     XmlNode returnNode = resultNode.FirstChild("return");
     if(!returnNode.IsNull())
     {
-      m_return = StringUtils::ConvertToBool(StringUtils::Trim(returnNode.GetText().c_str()).c_str());
+      m_return = StringUtils::ConvertToBool(returnNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
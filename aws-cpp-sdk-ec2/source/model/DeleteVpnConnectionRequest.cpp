@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteVpnConnectionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DeleteVpnConnectionRequest::DeleteVpnConnectionRequest() :
 
 Aws::String DeleteVpnConnectionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteVpnConnection&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String DeleteVpnConnectionRequest::SerializePayload() const
 
   if(m_vpnConnectionIdHasBeenSet)
   {
-    ss << "VpnConnectionId=" << StringUtils::URLEncode(m_vpnConnectionId.c_str()) << "&";
+    ss << "VpnConnectionId=" << StringUtils::URLEncoded(m_vpnConnectionId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeleteVpnGatewayRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DeleteVpnGatewayRequest::DeleteVpnGatewayRequest() :
 
 Aws::String DeleteVpnGatewayRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteVpnGateway&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String DeleteVpnGatewayRequest::SerializePayload() const
 
   if(m_vpnGatewayIdHasBeenSet)
   {
-    ss << "VpnGatewayId=" << StringUtils::URLEncode(m_vpnGatewayId.c_str()) << "&";
+    ss << "VpnGatewayId=" << StringUtils::URLEncoded(m_vpnGatewayId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
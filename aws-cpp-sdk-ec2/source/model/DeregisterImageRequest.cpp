@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DeregisterImageRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DeregisterImageRequest::DeregisterImageRequest() :
 
 Aws::String DeregisterImageRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeregisterImage&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String DeregisterImageRequest::SerializePayload() const
 
   if(m_imageIdHasBeenSet)
   {
-    ss << "ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+    ss << "ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeAccountAttributesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DescribeAccountAttributesRequest::DescribeAccountAttributesRequest() :
 
 Aws::String DescribeAccountAttributesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeAccountAttributes&";
   if(m_dryRunHasBeenSet)
   {
@@ -41,12 +42,12 @@ Aws::String DescribeAccountAttributesRequest::SerializePayload() const
     for(auto& item : m_attributeNames)
     {
       ss << "AttributeName." << attributeNamesCount << "="
-          << StringUtils::URLEncode(AccountAttributeNameMapper::GetNameForAccountAttributeName(item).c_str()) << "&";
+          << StringUtils::URLEncoded(AccountAttributeNameMapper::GetNameForAccountAttributeName(item)) << "&";
       attributeNamesCount++;
     }
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeAccountAttributesResponse& DescribeAccountAttributesResponse::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeAccountAttributesResponse")
+  if (rootNode.GetNameView() != "DescribeAccountAttributesResponse")
   {
     resultNode = rootNode.FirstChild("DescribeAccountAttributesResponse");
   }
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeAddressesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ DescribeAddressesRequest::DescribeAddressesRequest() :
 
 Aws::String DescribeAddressesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeAddresses&";
   if(m_dryRunHasBeenSet)
   {
@@ -43,7 +44,7 @@ Aws::String DescribeAddressesRequest::SerializePayload() const
     for(auto& item : m_publicIps)
     {
       ss << "PublicIp." << publicIpsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       publicIpsCount++;
     }
   }
@@ -64,12 +65,12 @@ Aws::String DescribeAddressesRequest::SerializePayload() const
     for(auto& item : m_allocationIds)
     {
       ss << "AllocationId." << allocationIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       allocationIdsCount++;
     }
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeAddressesResponse& DescribeAddressesResponse::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeAddressesResponse")
+  if (rootNode.GetNameView() != "DescribeAddressesResponse")
   {
     resultNode = rootNode.FirstChild("DescribeAddressesResponse");
   }
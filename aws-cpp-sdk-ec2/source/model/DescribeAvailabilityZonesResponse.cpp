@@ -40,7 +40,7 @@ DescribeAvailabilityZonesResponse& DescribeAvailabilityZonesResponse::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeAvailabilityZonesResponse")
+  if (rootNode.GetNameView() != "DescribeAvailabilityZonesResponse")
   {
     resultNode = rootNode.FirstChild("DescribeAvailabilityZonesResponse");
   }
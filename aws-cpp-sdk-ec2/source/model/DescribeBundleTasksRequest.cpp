@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeBundleTasksRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ DescribeBundleTasksRequest::DescribeBundleTasksRequest() :
 
 Aws::String DescribeBundleTasksRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeBundleTasks&";
   if(m_dryRunHasBeenSet)
   {
@@ -42,7 +43,7 @@ Aws::String DescribeBundleTasksRequest::SerializePayload() const
     for(auto& item : m_bundleIds)
     {
       ss << "BundleId." << bundleIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       bundleIdsCount++;
     }
   }
@@ -58,6 +59,6 @@ Aws::String DescribeBundleTasksRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeBundleTasksResponse& DescribeBundleTasksResponse::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeBundleTasksResponse")
+  if (rootNode.GetNameView() != "DescribeBundleTasksResponse")
   {
     resultNode = rootNode.FirstChild("DescribeBundleTasksResponse");
   }
@@ -40,7 +40,7 @@ DescribeClassicLinkInstancesResponse& DescribeClassicLinkInstancesResponse::oper
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeClassicLinkInstancesResponse")
+  if (rootNode.GetNameView() != "DescribeClassicLinkInstancesResponse")
   {
     resultNode = rootNode.FirstChild("DescribeClassicLinkInstancesResponse");
   }
@@ -61,7 +61,7 @@ DescribeClassicLinkInstancesResponse& DescribeClassicLinkInstancesResponse::oper
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
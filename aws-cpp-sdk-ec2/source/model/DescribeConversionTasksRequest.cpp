@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeConversionTasksRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ DescribeConversionTasksRequest::DescribeConversionTasksRequest() :
 
 Aws::String DescribeConversionTasksRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeConversionTasks&";
   if(m_dryRunHasBeenSet)
   {
@@ -52,12 +53,12 @@ Aws::String DescribeConversionTasksRequest::SerializePayload() const
     for(auto& item : m_conversionTaskIds)
     {
       ss << "ConversionTaskId." << conversionTaskIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       conversionTaskIdsCount++;
     }
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
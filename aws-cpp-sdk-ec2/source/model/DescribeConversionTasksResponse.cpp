@@ -40,7 +40,7 @@ DescribeConversionTasksResponse& DescribeConversionTasksResponse::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeConversionTasksResponse")
+  if (rootNode.GetNameView() != "DescribeConversionTasksResponse")
   {
     resultNode = rootNode.FirstChild("DescribeConversionTasksResponse");
   }
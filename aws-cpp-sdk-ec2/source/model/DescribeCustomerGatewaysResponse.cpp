@@ -40,7 +40,7 @@ DescribeCustomerGatewaysResponse& DescribeCustomerGatewaysResponse::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeCustomerGatewaysResponse")
+  if (rootNode.GetNameView() != "DescribeCustomerGatewaysResponse")
   {
     resultNode = rootNode.FirstChild("DescribeCustomerGatewaysResponse");
   }
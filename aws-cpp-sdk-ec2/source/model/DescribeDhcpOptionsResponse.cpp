@@ -40,7 +40,7 @@ DescribeDhcpOptionsResponse& DescribeDhcpOptionsResponse::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDhcpOptionsResponse")
+  if (rootNode.GetNameView() != "DescribeDhcpOptionsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeDhcpOptionsResponse");
   }
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeExportTasksRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -26,7 +27,7 @@ DescribeExportTasksRequest::DescribeExportTasksRequest() :
 
 Aws::String DescribeExportTasksRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeExportTasks&";
   if(m_exportTaskIdsHasBeenSet)
   {
@@ -34,12 +35,12 @@ Aws::String DescribeExportTasksRequest::SerializePayload() const
     for(auto& item : m_exportTaskIds)
     {
       ss << "ExportTaskId." << exportTaskIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       exportTaskIdsCount++;
     }
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeExportTasksResponse& DescribeExportTasksResponse::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeExportTasksResponse")
+  if (rootNode.GetNameView() != "DescribeExportTasksResponse")
   {
     resultNode = rootNode.FirstChild("DescribeExportTasksResponse");
   }
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeFlowLogsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ DescribeFlowLogsRequest::DescribeFlowLogsRequest() :
 
 Aws::String DescribeFlowLogsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeFlowLogs&";
   if(m_flowLogIdsHasBeenSet)
   {
@@ -38,7 +39,7 @@ Aws::String DescribeFlowLogsRequest::SerializePayload() const
     for(auto& item : m_flowLogIds)
     {
       ss << "FlowLogId." << flowLogIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       flowLogIdsCount++;
     }
   }
@@ -55,7 +56,7 @@ Aws::String DescribeFlowLogsRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxResultsHasBeenSet)
@@ -64,6 +65,6 @@ Aws::String DescribeFlowLogsRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeFlowLogsResponse& DescribeFlowLogsResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeFlowLogsResponse")
+  if (rootNode.GetNameView() != "DescribeFlowLogsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeFlowLogsResponse");
   }
@@ -61,7 +61,7 @@ DescribeFlowLogsResponse& DescribeFlowLogsResponse::operator =(const AmazonWebSe
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
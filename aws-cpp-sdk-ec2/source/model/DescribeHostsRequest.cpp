@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeHostsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ DescribeHostsRequest::DescribeHostsRequest() :
 
 Aws::String DescribeHostsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeHosts&";
   if(m_hostIdsHasBeenSet)
   {
@@ -38,14 +39,14 @@ Aws::String DescribeHostsRequest::SerializePayload() const
     for(auto& item : m_hostIds)
     {
       ss << "HostId." << hostIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       hostIdsCount++;
     }
   }
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxResultsHasBeenSet)
@@ -64,6 +65,6 @@ Aws::String DescribeHostsRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeHostsResponse& DescribeHostsResponse::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeHostsResponse")
+  if (rootNode.GetNameView() != "DescribeHostsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeHostsResponse");
   }
@@ -61,7 +61,7 @@ DescribeHostsResponse& DescribeHostsResponse::operator =(const AmazonWebServiceR
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
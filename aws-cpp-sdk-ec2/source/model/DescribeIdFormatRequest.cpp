@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeIdFormatRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DescribeIdFormatRequest::DescribeIdFormatRequest() :
 
 Aws::String DescribeIdFormatRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeIdFormat&";
   if(m_resourceHasBeenSet)
   {
-    ss << "Resource=" << StringUtils::URLEncode(m_resource.c_str()) << "&";
+    ss << "Resource=" << StringUtils::URLEncoded(m_resource) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeIdFormatResponse& DescribeIdFormatResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeIdFormatResponse")
+  if (rootNode.GetNameView() != "DescribeIdFormatResponse")
   {
     resultNode = rootNode.FirstChild("DescribeIdFormatResponse");
   }
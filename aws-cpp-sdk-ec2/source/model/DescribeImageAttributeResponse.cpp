@@ -40,7 +40,7 @@ DescribeImageAttributeResponse& DescribeImageAttributeResponse::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeImageAttributeResponse")
+  if (rootNode.GetNameView() != "DescribeImageAttributeResponse")
   {
     resultNode = rootNode.FirstChild("DescribeImageAttributeResponse");
   }
@@ -50,7 +50,7 @@ DescribeImageAttributeResponse& DescribeImageAttributeResponse::operator =(const
     XmlNode imageIdNode = resultNode.FirstChild("imageId");
     if(!imageIdNode.IsNull())
     {
-      m_imageId = StringUtils::Trim(imageIdNode.GetText().c_str());
+      m_imageId = imageIdNode.GetTextView().Trim().ToString();
     }
     XmlNode launchPermissionsNode = resultNode.FirstChild("launchPermission");
     if(!launchPermissionsNode.IsNull())
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeImagesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -31,7 +32,7 @@ DescribeImagesRequest::DescribeImagesRequest() :
 
 Aws::String DescribeImagesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeImages&";
   if(m_dryRunHasBeenSet)
   {
@@ -44,7 +45,7 @@ Aws::String DescribeImagesRequest::SerializePayload() const
     for(auto& item : m_imageIds)
     {
       ss << "ImageId." << imageIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       imageIdsCount++;
     }
   }
@@ -55,7 +56,7 @@ Aws::String DescribeImagesRequest::SerializePayload() const
     for(auto& item : m_owners)
     {
       ss << "Owner." << ownersCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       ownersCount++;
     }
   }
@@ -66,7 +67,7 @@ Aws::String DescribeImagesRequest::SerializePayload() const
     for(auto& item : m_executableUsers)
     {
       ss << "ExecutableBy." << executableUsersCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       executableUsersCount++;
     }
   }
@@ -82,6 +83,6 @@ Aws::String DescribeImagesRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
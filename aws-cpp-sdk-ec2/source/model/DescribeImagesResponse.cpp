@@ -40,7 +40,7 @@ DescribeImagesResponse& DescribeImagesResponse::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeImagesResponse")
+  if (rootNode.GetNameView() != "DescribeImagesResponse")
   {
     resultNode = rootNode.FirstChild("DescribeImagesResponse");
   }
@@ -40,7 +40,7 @@ DescribeImportImageTasksResponse& DescribeImportImageTasksResponse::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeImportImageTasksResponse")
+  if (rootNode.GetNameView() != "DescribeImportImageTasksResponse")
   {
     resultNode = rootNode.FirstChild("DescribeImportImageTasksResponse");
   }
@@ -61,7 +61,7 @@ DescribeImportImageTasksResponse& DescribeImportImageTasksResponse::operator =(c
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ DescribeImportSnapshotTasksResponse& DescribeImportSnapshotTasksResponse::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeImportSnapshotTasksResponse")
+  if (rootNode.GetNameView() != "DescribeImportSnapshotTasksResponse")
   {
     resultNode = rootNode.FirstChild("DescribeImportSnapshotTasksResponse");
   }
@@ -61,7 +61,7 @@ DescribeImportSnapshotTasksResponse& DescribeImportSnapshotTasksResponse::operat
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
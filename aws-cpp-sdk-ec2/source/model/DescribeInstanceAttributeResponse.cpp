@@ -40,7 +40,7 @@ DescribeInstanceAttributeResponse& DescribeInstanceAttributeResponse::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeInstanceAttributeResponse")
+  if (rootNode.GetNameView() != "DescribeInstanceAttributeResponse")
   {
     resultNode = rootNode.FirstChild("DescribeInstanceAttributeResponse");
   }
@@ -50,7 +50,7 @@ DescribeInstanceAttributeResponse& DescribeInstanceAttributeResponse::operator =
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
     }
     XmlNode instanceTypeNode = resultNode.FirstChild("instanceType");
     if(!instanceTypeNode.IsNull())
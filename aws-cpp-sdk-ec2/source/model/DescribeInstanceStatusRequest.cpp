@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeInstanceStatusRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -34,7 +35,7 @@ DescribeInstanceStatusRequest::DescribeInstanceStatusRequest() :
 
 Aws::String DescribeInstanceStatusRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeInstanceStatus&";
   if(m_dryRunHasBeenSet)
   {
@@ -47,7 +48,7 @@ Aws::String DescribeInstanceStatusRequest::SerializePayload() const
     for(auto& item : m_instanceIds)
     {
       ss << "InstanceId." << instanceIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       instanceIdsCount++;
     }
   }
@@ -64,7 +65,7 @@ Aws::String DescribeInstanceStatusRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxResultsHasBeenSet)
@@ -78,6 +79,6 @@ Aws::String DescribeInstanceStatusRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeInstanceStatusResponse& DescribeInstanceStatusResponse::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeInstanceStatusResponse")
+  if (rootNode.GetNameView() != "DescribeInstanceStatusResponse")
   {
     resultNode = rootNode.FirstChild("DescribeInstanceStatusResponse");
   }
@@ -61,7 +61,7 @@ DescribeInstanceStatusResponse& DescribeInstanceStatusResponse::operator =(const
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
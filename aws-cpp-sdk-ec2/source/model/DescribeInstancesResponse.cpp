@@ -40,7 +40,7 @@ DescribeInstancesResponse& DescribeInstancesResponse::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeInstancesResponse")
+  if (rootNode.GetNameView() != "DescribeInstancesResponse")
   {
     resultNode = rootNode.FirstChild("DescribeInstancesResponse");
   }
@@ -61,7 +61,7 @@ DescribeInstancesResponse& DescribeInstancesResponse::operator =(const AmazonWeb
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
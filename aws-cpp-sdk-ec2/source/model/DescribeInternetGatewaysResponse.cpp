@@ -40,7 +40,7 @@ DescribeInternetGatewaysResponse& DescribeInternetGatewaysResponse::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeInternetGatewaysResponse")
+  if (rootNode.GetNameView() != "DescribeInternetGatewaysResponse")
   {
     resultNode = rootNode.FirstChild("DescribeInternetGatewaysResponse");
   }
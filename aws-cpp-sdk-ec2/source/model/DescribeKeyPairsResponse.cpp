@@ -40,7 +40,7 @@ DescribeKeyPairsResponse& DescribeKeyPairsResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeKeyPairsResponse")
+  if (rootNode.GetNameView() != "DescribeKeyPairsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeKeyPairsResponse");
   }
@@ -40,7 +40,7 @@ DescribeMovingAddressesResponse& DescribeMovingAddressesResponse::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeMovingAddressesResponse")
+  if (rootNode.GetNameView() != "DescribeMovingAddressesResponse")
   {
     resultNode = rootNode.FirstChild("DescribeMovingAddressesResponse");
   }
@@ -61,7 +61,7 @@ DescribeMovingAddressesResponse& DescribeMovingAddressesResponse::operator =(con
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
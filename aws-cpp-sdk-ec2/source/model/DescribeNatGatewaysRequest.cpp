@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeNatGatewaysRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ DescribeNatGatewaysRequest::DescribeNatGatewaysRequest() :
 
 Aws::String DescribeNatGatewaysRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeNatGateways&";
   if(m_natGatewayIdsHasBeenSet)
   {
@@ -38,7 +39,7 @@ Aws::String DescribeNatGatewaysRequest::SerializePayload() const
     for(auto& item : m_natGatewayIds)
     {
       ss << "NatGatewayId." << natGatewayIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       natGatewayIdsCount++;
     }
   }
@@ -60,10 +61,10 @@ Aws::String DescribeNatGatewaysRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeNatGatewaysResponse& DescribeNatGatewaysResponse::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeNatGatewaysResponse")
+  if (rootNode.GetNameView() != "DescribeNatGatewaysResponse")
   {
     resultNode = rootNode.FirstChild("DescribeNatGatewaysResponse");
   }
@@ -61,7 +61,7 @@ DescribeNatGatewaysResponse& DescribeNatGatewaysResponse::operator =(const Amazo
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ DescribeNetworkAclsResponse& DescribeNetworkAclsResponse::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeNetworkAclsResponse")
+  if (rootNode.GetNameView() != "DescribeNetworkAclsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeNetworkAclsResponse");
   }
@@ -40,7 +40,7 @@ DescribeNetworkInterfacesResponse& DescribeNetworkInterfacesResponse::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeNetworkInterfacesResponse")
+  if (rootNode.GetNameView() != "DescribeNetworkInterfacesResponse")
   {
     resultNode = rootNode.FirstChild("DescribeNetworkInterfacesResponse");
   }
@@ -40,7 +40,7 @@ DescribePlacementGroupsResponse& DescribePlacementGroupsResponse::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribePlacementGroupsResponse")
+  if (rootNode.GetNameView() != "DescribePlacementGroupsResponse")
   {
     resultNode = rootNode.FirstChild("DescribePlacementGroupsResponse");
   }
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribePrefixListsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -32,7 +33,7 @@ DescribePrefixListsRequest::DescribePrefixListsRequest() :
 
 Aws::String DescribePrefixListsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribePrefixLists&";
   if(m_dryRunHasBeenSet)
   {
@@ -45,7 +46,7 @@ Aws::String DescribePrefixListsRequest::SerializePayload() const
     for(auto& item : m_prefixListIds)
     {
       ss << "PrefixListId." << prefixListIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       prefixListIdsCount++;
     }
   }
@@ -67,10 +68,10 @@ Aws::String DescribePrefixListsRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
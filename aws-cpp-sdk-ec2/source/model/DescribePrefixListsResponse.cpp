@@ -40,7 +40,7 @@ DescribePrefixListsResponse& DescribePrefixListsResponse::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribePrefixListsResponse")
+  if (rootNode.GetNameView() != "DescribePrefixListsResponse")
   {
     resultNode = rootNode.FirstChild("DescribePrefixListsResponse");
   }
@@ -61,7 +61,7 @@ DescribePrefixListsResponse& DescribePrefixListsResponse::operator =(const Amazo
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ DescribeRegionsResponse& DescribeRegionsResponse::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeRegionsResponse")
+  if (rootNode.GetNameView() != "DescribeRegionsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeRegionsResponse");
   }
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeReservedInstancesListingsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ DescribeReservedInstancesListingsRequest::DescribeReservedInstancesListingsReque
 
 Aws::String DescribeReservedInstancesListingsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeReservedInstancesListings&";
   if(m_reservedInstancesIdHasBeenSet)
   {
-    ss << "ReservedInstancesId=" << StringUtils::URLEncode(m_reservedInstancesId.c_str()) << "&";
+    ss << "ReservedInstancesId=" << StringUtils::URLEncoded(m_reservedInstancesId) << "&";
   }
 
   if(m_reservedInstancesListingIdHasBeenSet)
   {
-    ss << "ReservedInstancesListingId=" << StringUtils::URLEncode(m_reservedInstancesListingId.c_str()) << "&";
+    ss << "ReservedInstancesListingId=" << StringUtils::URLEncoded(m_reservedInstancesListingId) << "&";
   }
 
   if(m_filtersHasBeenSet)
@@ -51,6 +52,6 @@ Aws::String DescribeReservedInstancesListingsRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeReservedInstancesListingsResponse& DescribeReservedInstancesListingsResp
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeReservedInstancesListingsResponse")
+  if (rootNode.GetNameView() != "DescribeReservedInstancesListingsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeReservedInstancesListingsResponse");
   }
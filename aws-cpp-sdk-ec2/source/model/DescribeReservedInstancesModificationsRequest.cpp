@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeReservedInstancesModificationsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DescribeReservedInstancesModificationsRequest::DescribeReservedInstancesModifica
 
 Aws::String DescribeReservedInstancesModificationsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeReservedInstancesModifications&";
   if(m_reservedInstancesModificationIdsHasBeenSet)
   {
@@ -36,14 +37,14 @@ Aws::String DescribeReservedInstancesModificationsRequest::SerializePayload() co
     for(auto& item : m_reservedInstancesModificationIds)
     {
       ss << "ReservedInstancesModificationId." << reservedInstancesModificationIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       reservedInstancesModificationIdsCount++;
     }
   }
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_filtersHasBeenSet)
@@ -57,6 +58,6 @@ Aws::String DescribeReservedInstancesModificationsRequest::SerializePayload() co
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
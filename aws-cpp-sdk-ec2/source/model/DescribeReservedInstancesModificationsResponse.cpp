@@ -40,7 +40,7 @@ DescribeReservedInstancesModificationsResponse& DescribeReservedInstancesModific
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeReservedInstancesModificationsResponse")
+  if (rootNode.GetNameView() != "DescribeReservedInstancesModificationsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeReservedInstancesModificationsResponse");
   }
@@ -61,7 +61,7 @@ DescribeReservedInstancesModificationsResponse& DescribeReservedInstancesModific
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeReservedInstancesOfferingsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -45,7 +46,7 @@ DescribeReservedInstancesOfferingsRequest::DescribeReservedInstancesOfferingsReq
 
 Aws::String DescribeReservedInstancesOfferingsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeReservedInstancesOfferings&";
   if(m_dryRunHasBeenSet)
   {
@@ -58,7 +59,7 @@ Aws::String DescribeReservedInstancesOfferingsRequest::SerializePayload() const
     for(auto& item : m_reservedInstancesOfferingIds)
     {
       ss << "ReservedInstancesOfferingId." << reservedInstancesOfferingIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       reservedInstancesOfferingIdsCount++;
     }
   }
@@ -70,7 +71,7 @@ Aws::String DescribeReservedInstancesOfferingsRequest::SerializePayload() const
 
   if(m_availabilityZoneHasBeenSet)
   {
-    ss << "AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+    ss << "AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_productDescriptionHasBeenSet)
@@ -100,7 +101,7 @@ Aws::String DescribeReservedInstancesOfferingsRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxResultsHasBeenSet)
@@ -129,6 +130,6 @@ Aws::String DescribeReservedInstancesOfferingsRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
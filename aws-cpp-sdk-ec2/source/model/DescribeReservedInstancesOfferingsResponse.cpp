@@ -40,7 +40,7 @@ DescribeReservedInstancesOfferingsResponse& DescribeReservedInstancesOfferingsRe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeReservedInstancesOfferingsResponse")
+  if (rootNode.GetNameView() != "DescribeReservedInstancesOfferingsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeReservedInstancesOfferingsResponse");
   }
@@ -61,7 +61,7 @@ DescribeReservedInstancesOfferingsResponse& DescribeReservedInstancesOfferingsRe
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
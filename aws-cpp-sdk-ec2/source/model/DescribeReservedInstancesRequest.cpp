@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeReservedInstancesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ DescribeReservedInstancesRequest::DescribeReservedInstancesRequest() :
 
 Aws::String DescribeReservedInstancesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeReservedInstances&";
   if(m_dryRunHasBeenSet)
   {
@@ -43,7 +44,7 @@ Aws::String DescribeReservedInstancesRequest::SerializePayload() const
     for(auto& item : m_reservedInstancesIds)
     {
       ss << "ReservedInstancesId." << reservedInstancesIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       reservedInstancesIdsCount++;
     }
   }
@@ -64,6 +65,6 @@ Aws::String DescribeReservedInstancesRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
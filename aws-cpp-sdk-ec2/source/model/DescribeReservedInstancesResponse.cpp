@@ -40,7 +40,7 @@ DescribeReservedInstancesResponse& DescribeReservedInstancesResponse::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeReservedInstancesResponse")
+  if (rootNode.GetNameView() != "DescribeReservedInstancesResponse")
   {
     resultNode = rootNode.FirstChild("DescribeReservedInstancesResponse");
   }
@@ -40,7 +40,7 @@ DescribeRouteTablesResponse& DescribeRouteTablesResponse::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeRouteTablesResponse")
+  if (rootNode.GetNameView() != "DescribeRouteTablesResponse")
   {
     resultNode = rootNode.FirstChild("DescribeRouteTablesResponse");
   }
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeScheduledInstanceAvailabilityRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -37,7 +38,7 @@ DescribeScheduledInstanceAvailabilityRequest::DescribeScheduledInstanceAvailabil
 
 Aws::String DescribeScheduledInstanceAvailabilityRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeScheduledInstanceAvailability&";
   if(m_dryRunHasBeenSet)
   {
@@ -66,7 +67,7 @@ Aws::String DescribeScheduledInstanceAvailabilityRequest::SerializePayload() con
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxResultsHasBeenSet)
@@ -85,6 +86,6 @@ Aws::String DescribeScheduledInstanceAvailabilityRequest::SerializePayload() con
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeScheduledInstanceAvailabilityResponse& DescribeScheduledInstanceAvailabi
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeScheduledInstanceAvailabilityResponse")
+  if (rootNode.GetNameView() != "DescribeScheduledInstanceAvailabilityResponse")
   {
     resultNode = rootNode.FirstChild("DescribeScheduledInstanceAvailabilityResponse");
   }
@@ -50,7 +50,7 @@ DescribeScheduledInstanceAvailabilityResponse& DescribeScheduledInstanceAvailabi
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
     XmlNode scheduledInstanceAvailabilitySetNode = resultNode.FirstChild("scheduledInstanceAvailabilitySet");
     if(!scheduledInstanceAvailabilitySetNode.IsNull())
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeScheduledInstancesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -33,7 +34,7 @@ DescribeScheduledInstancesRequest::DescribeScheduledInstancesRequest() :
 
 Aws::String DescribeScheduledInstancesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeScheduledInstances&";
   if(m_dryRunHasBeenSet)
   {
@@ -46,7 +47,7 @@ Aws::String DescribeScheduledInstancesRequest::SerializePayload() const
     for(auto& item : m_scheduledInstanceIds)
     {
       ss << "ScheduledInstanceId." << scheduledInstanceIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       scheduledInstanceIdsCount++;
     }
   }
@@ -58,7 +59,7 @@ Aws::String DescribeScheduledInstancesRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxResultsHasBeenSet)
@@ -77,6 +78,6 @@ Aws::String DescribeScheduledInstancesRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeScheduledInstancesResponse& DescribeScheduledInstancesResponse::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeScheduledInstancesResponse")
+  if (rootNode.GetNameView() != "DescribeScheduledInstancesResponse")
   {
     resultNode = rootNode.FirstChild("DescribeScheduledInstancesResponse");
   }
@@ -50,7 +50,7 @@ DescribeScheduledInstancesResponse& DescribeScheduledInstancesResponse::operator
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
     XmlNode scheduledInstanceSetNode = resultNode.FirstChild("scheduledInstanceSet");
     if(!scheduledInstanceSetNode.IsNull())
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeSecurityGroupReferencesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DescribeSecurityGroupReferencesRequest::DescribeSecurityGroupReferencesRequest()
 
 Aws::String DescribeSecurityGroupReferencesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeSecurityGroupReferences&";
   if(m_dryRunHasBeenSet)
   {
@@ -41,12 +42,12 @@ Aws::String DescribeSecurityGroupReferencesRequest::SerializePayload() const
     for(auto& item : m_groupId)
     {
       ss << "GroupId.member." << groupIdCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       groupIdCount++;
     }
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeSecurityGroupReferencesResponse& DescribeSecurityGroupReferencesResponse
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeSecurityGroupReferencesResponse")
+  if (rootNode.GetNameView() != "DescribeSecurityGroupReferencesResponse")
   {
     resultNode = rootNode.FirstChild("DescribeSecurityGroupReferencesResponse");
   }
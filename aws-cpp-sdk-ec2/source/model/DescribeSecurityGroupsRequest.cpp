@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeSecurityGroupsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ DescribeSecurityGroupsRequest::DescribeSecurityGroupsRequest() :
 
 Aws::String DescribeSecurityGroupsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeSecurityGroups&";
   if(m_dryRunHasBeenSet)
   {
@@ -43,7 +44,7 @@ Aws::String DescribeSecurityGroupsRequest::SerializePayload() const
     for(auto& item : m_groupNames)
     {
       ss << "GroupName." << groupNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       groupNamesCount++;
     }
   }
@@ -54,7 +55,7 @@ Aws::String DescribeSecurityGroupsRequest::SerializePayload() const
     for(auto& item : m_groupIds)
     {
       ss << "GroupId." << groupIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       groupIdsCount++;
     }
   }
@@ -70,6 +71,6 @@ Aws::String DescribeSecurityGroupsRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeSecurityGroupsResponse& DescribeSecurityGroupsResponse::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeSecurityGroupsResponse")
+  if (rootNode.GetNameView() != "DescribeSecurityGroupsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeSecurityGroupsResponse");
   }
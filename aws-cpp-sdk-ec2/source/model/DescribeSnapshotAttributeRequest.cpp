@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeSnapshotAttributeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ DescribeSnapshotAttributeRequest::DescribeSnapshotAttributeRequest() :
 
 Aws::String DescribeSnapshotAttributeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeSnapshotAttribute&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,7 +39,7 @@ Aws::String DescribeSnapshotAttributeRequest::SerializePayload() const
 
   if(m_snapshotIdHasBeenSet)
   {
-    ss << "SnapshotId=" << StringUtils::URLEncode(m_snapshotId.c_str()) << "&";
+    ss << "SnapshotId=" << StringUtils::URLEncoded(m_snapshotId) << "&";
   }
 
   if(m_attributeHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String DescribeSnapshotAttributeRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeSnapshotAttributeResponse& DescribeSnapshotAttributeResponse::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeSnapshotAttributeResponse")
+  if (rootNode.GetNameView() != "DescribeSnapshotAttributeResponse")
   {
     resultNode = rootNode.FirstChild("DescribeSnapshotAttributeResponse");
   }
@@ -50,7 +50,7 @@ DescribeSnapshotAttributeResponse& DescribeSnapshotAttributeResponse::operator =
     XmlNode snapshotIdNode = resultNode.FirstChild("snapshotId");
     if(!snapshotIdNode.IsNull())
     {
-      m_snapshotId = StringUtils::Trim(snapshotIdNode.GetText().c_str());
+      m_snapshotId = snapshotIdNode.GetTextView().Trim().ToString();
     }
     XmlNode createVolumePermissionsNode = resultNode.FirstChild("createVolumePermission");
     if(!createVolumePermissionsNode.IsNull())
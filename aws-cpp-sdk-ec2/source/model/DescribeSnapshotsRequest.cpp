@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeSnapshotsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -34,7 +35,7 @@ DescribeSnapshotsRequest::DescribeSnapshotsRequest() :
 
 Aws::String DescribeSnapshotsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeSnapshots&";
   if(m_dryRunHasBeenSet)
   {
@@ -47,7 +48,7 @@ Aws::String DescribeSnapshotsRequest::SerializePayload() const
     for(auto& item : m_snapshotIds)
     {
       ss << "SnapshotId." << snapshotIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       snapshotIdsCount++;
     }
   }
@@ -58,7 +59,7 @@ Aws::String DescribeSnapshotsRequest::SerializePayload() const
     for(auto& item : m_ownerIds)
     {
       ss << "Owner." << ownerIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       ownerIdsCount++;
     }
   }
@@ -69,7 +70,7 @@ Aws::String DescribeSnapshotsRequest::SerializePayload() const
     for(auto& item : m_restorableByUserIds)
     {
       ss << "RestorableBy." << restorableByUserIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       restorableByUserIdsCount++;
     }
   }
@@ -86,7 +87,7 @@ Aws::String DescribeSnapshotsRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxResultsHasBeenSet)
@@ -95,6 +96,6 @@ Aws::String DescribeSnapshotsRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
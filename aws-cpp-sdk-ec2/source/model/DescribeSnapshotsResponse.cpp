@@ -40,7 +40,7 @@ DescribeSnapshotsResponse& DescribeSnapshotsResponse::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeSnapshotsResponse")
+  if (rootNode.GetNameView() != "DescribeSnapshotsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeSnapshotsResponse");
   }
@@ -61,7 +61,7 @@ DescribeSnapshotsResponse& DescribeSnapshotsResponse::operator =(const AmazonWeb
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
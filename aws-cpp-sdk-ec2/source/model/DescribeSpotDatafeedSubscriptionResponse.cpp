@@ -40,7 +40,7 @@ DescribeSpotDatafeedSubscriptionResponse& DescribeSpotDatafeedSubscriptionRespon
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeSpotDatafeedSubscriptionResponse")
+  if (rootNode.GetNameView() != "DescribeSpotDatafeedSubscriptionResponse")
   {
     resultNode = rootNode.FirstChild("DescribeSpotDatafeedSubscriptionResponse");
   }
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeSpotFleetInstancesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -31,7 +32,7 @@ DescribeSpotFleetInstancesRequest::DescribeSpotFleetInstancesRequest() :
 
 Aws::String DescribeSpotFleetInstancesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeSpotFleetInstances&";
   if(m_dryRunHasBeenSet)
   {
@@ -40,12 +41,12 @@ Aws::String DescribeSpotFleetInstancesRequest::SerializePayload() const
 
   if(m_spotFleetRequestIdHasBeenSet)
   {
-    ss << "SpotFleetRequestId=" << StringUtils::URLEncode(m_spotFleetRequestId.c_str()) << "&";
+    ss << "SpotFleetRequestId=" << StringUtils::URLEncoded(m_spotFleetRequestId) << "&";
   }
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxResultsHasBeenSet)
@@ -54,6 +55,6 @@ Aws::String DescribeSpotFleetInstancesRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
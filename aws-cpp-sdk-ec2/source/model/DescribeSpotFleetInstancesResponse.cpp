@@ -40,7 +40,7 @@ DescribeSpotFleetInstancesResponse& DescribeSpotFleetInstancesResponse::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeSpotFleetInstancesResponse")
+  if (rootNode.GetNameView() != "DescribeSpotFleetInstancesResponse")
   {
     resultNode = rootNode.FirstChild("DescribeSpotFleetInstancesResponse");
   }
@@ -50,7 +50,7 @@ DescribeSpotFleetInstancesResponse& DescribeSpotFleetInstancesResponse::operator
     XmlNode spotFleetRequestIdNode = resultNode.FirstChild("spotFleetRequestId");
     if(!spotFleetRequestIdNode.IsNull())
     {
-      m_spotFleetRequestId = StringUtils::Trim(spotFleetRequestIdNode.GetText().c_str());
+      m_spotFleetRequestId = spotFleetRequestIdNode.GetTextView().Trim().ToString();
     }
     XmlNode activeInstancesNode = resultNode.FirstChild("activeInstanceSet");
     if(!activeInstancesNode.IsNull())
@@ -66,7 +66,7 @@ DescribeSpotFleetInstancesResponse& DescribeSpotFleetInstancesResponse::operator
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
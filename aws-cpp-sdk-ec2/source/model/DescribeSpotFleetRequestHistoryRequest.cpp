@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeSpotFleetRequestHistoryRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -33,7 +34,7 @@ DescribeSpotFleetRequestHistoryRequest::DescribeSpotFleetRequestHistoryRequest()
 
 Aws::String DescribeSpotFleetRequestHistoryRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeSpotFleetHistory&";
   if(m_dryRunHasBeenSet)
   {
@@ -42,7 +43,7 @@ Aws::String DescribeSpotFleetRequestHistoryRequest::SerializePayload() const
 
   if(m_spotFleetRequestIdHasBeenSet)
   {
-    ss << "SpotFleetRequestId=" << StringUtils::URLEncode(m_spotFleetRequestId.c_str()) << "&";
+    ss << "SpotFleetRequestId=" << StringUtils::URLEncoded(m_spotFleetRequestId) << "&";
   }
 
   if(m_eventTypeHasBeenSet)
@@ -52,12 +53,12 @@ Aws::String DescribeSpotFleetRequestHistoryRequest::SerializePayload() const
 
   if(m_startTimeHasBeenSet)
   {
-    ss << "StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxResultsHasBeenSet)
@@ -66,6 +67,6 @@ Aws::String DescribeSpotFleetRequestHistoryRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeSpotFleetRequestHistoryResponse& DescribeSpotFleetRequestHistoryResponse
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeSpotFleetRequestHistoryResponse")
+  if (rootNode.GetNameView() != "DescribeSpotFleetRequestHistoryResponse")
   {
     resultNode = rootNode.FirstChild("DescribeSpotFleetRequestHistoryResponse");
   }
@@ -50,17 +50,17 @@ DescribeSpotFleetRequestHistoryResponse& DescribeSpotFleetRequestHistoryResponse
     XmlNode spotFleetRequestIdNode = resultNode.FirstChild("spotFleetRequestId");
     if(!spotFleetRequestIdNode.IsNull())
     {
-      m_spotFleetRequestId = StringUtils::Trim(spotFleetRequestIdNode.GetText().c_str());
+      m_spotFleetRequestId = spotFleetRequestIdNode.GetTextView().Trim().ToString();
     }
     XmlNode startTimeNode = resultNode.FirstChild("startTime");
     if(!startTimeNode.IsNull())
     {
-      m_startTime = DateTime(StringUtils::Trim(startTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_startTime = DateTime(startTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
     XmlNode lastEvaluatedTimeNode = resultNode.FirstChild("lastEvaluatedTime");
     if(!lastEvaluatedTimeNode.IsNull())
     {
-      m_lastEvaluatedTime = DateTime(StringUtils::Trim(lastEvaluatedTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_lastEvaluatedTime = DateTime(lastEvaluatedTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
     XmlNode historyRecordsNode = resultNode.FirstChild("historyRecordSet");
     if(!historyRecordsNode.IsNull())
@@ -76,7 +76,7 @@ DescribeSpotFleetRequestHistoryResponse& DescribeSpotFleetRequestHistoryResponse
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeSpotFleetRequestsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -31,7 +32,7 @@ DescribeSpotFleetRequestsRequest::DescribeSpotFleetRequestsRequest() :
 
 Aws::String DescribeSpotFleetRequestsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeSpotFleets&";
   if(m_dryRunHasBeenSet)
   {
@@ -44,14 +45,14 @@ Aws::String DescribeSpotFleetRequestsRequest::SerializePayload() const
     for(auto& item : m_spotFleetRequestIds)
     {
       ss << "SpotFleetRequestId." << spotFleetRequestIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       spotFleetRequestIdsCount++;
     }
   }
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxResultsHasBeenSet)
@@ -60,6 +61,6 @@ Aws::String DescribeSpotFleetRequestsRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
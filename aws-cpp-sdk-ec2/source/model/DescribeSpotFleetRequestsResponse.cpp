@@ -40,7 +40,7 @@ DescribeSpotFleetRequestsResponse& DescribeSpotFleetRequestsResponse::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeSpotFleetRequestsResponse")
+  if (rootNode.GetNameView() != "DescribeSpotFleetRequestsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeSpotFleetRequestsResponse");
   }
@@ -61,7 +61,7 @@ DescribeSpotFleetRequestsResponse& DescribeSpotFleetRequestsResponse::operator =
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ DescribeSpotInstanceRequestsResponse& DescribeSpotInstanceRequestsResponse::oper
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeSpotInstanceRequestsResponse")
+  if (rootNode.GetNameView() != "DescribeSpotInstanceRequestsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeSpotInstanceRequestsResponse");
   }
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeSpotPriceHistoryRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -36,7 +37,7 @@ DescribeSpotPriceHistoryRequest::DescribeSpotPriceHistoryRequest() :
 
 Aws::String DescribeSpotPriceHistoryRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeSpotPriceHistory&";
   if(m_dryRunHasBeenSet)
   {
@@ -45,12 +46,12 @@ Aws::String DescribeSpotPriceHistoryRequest::SerializePayload() const
 
   if(m_startTimeHasBeenSet)
   {
-    ss << "StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_endTimeHasBeenSet)
   {
-    ss << "EndTime=" << StringUtils::URLEncode(m_endTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "EndTime=" << StringUtils::URLEncoded(m_endTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_instanceTypesHasBeenSet)
@@ -59,7 +60,7 @@ Aws::String DescribeSpotPriceHistoryRequest::SerializePayload() const
     for(auto& item : m_instanceTypes)
     {
       ss << "InstanceType." << instanceTypesCount << "="
-          << StringUtils::URLEncode(InstanceTypeMapper::GetNameForInstanceType(item).c_str()) << "&";
+          << StringUtils::URLEncoded(InstanceTypeMapper::GetNameForInstanceType(item)) << "&";
       instanceTypesCount++;
     }
   }
@@ -70,7 +71,7 @@ Aws::String DescribeSpotPriceHistoryRequest::SerializePayload() const
     for(auto& item : m_productDescriptions)
     {
       ss << "ProductDescription." << productDescriptionsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       productDescriptionsCount++;
     }
   }
@@ -87,7 +88,7 @@ Aws::String DescribeSpotPriceHistoryRequest::SerializePayload() const
 
   if(m_availabilityZoneHasBeenSet)
   {
-    ss << "AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+    ss << "AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_maxResultsHasBeenSet)
@@ -97,10 +98,10 @@ Aws::String DescribeSpotPriceHistoryRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeSpotPriceHistoryResponse& DescribeSpotPriceHistoryResponse::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeSpotPriceHistoryResponse")
+  if (rootNode.GetNameView() != "DescribeSpotPriceHistoryResponse")
   {
     resultNode = rootNode.FirstChild("DescribeSpotPriceHistoryResponse");
   }
@@ -61,7 +61,7 @@ DescribeSpotPriceHistoryResponse& DescribeSpotPriceHistoryResponse::operator =(c
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
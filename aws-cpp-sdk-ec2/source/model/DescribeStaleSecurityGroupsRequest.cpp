@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeStaleSecurityGroupsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -31,7 +32,7 @@ DescribeStaleSecurityGroupsRequest::DescribeStaleSecurityGroupsRequest() :
 
 Aws::String DescribeStaleSecurityGroupsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeStaleSecurityGroups&";
   if(m_dryRunHasBeenSet)
   {
@@ -40,7 +41,7 @@ Aws::String DescribeStaleSecurityGroupsRequest::SerializePayload() const
 
   if(m_vpcIdHasBeenSet)
   {
-    ss << "VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+    ss << "VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_maxResultsHasBeenSet)
@@ -50,10 +51,10 @@ Aws::String DescribeStaleSecurityGroupsRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeStaleSecurityGroupsResponse& DescribeStaleSecurityGroupsResponse::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeStaleSecurityGroupsResponse")
+  if (rootNode.GetNameView() != "DescribeStaleSecurityGroupsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeStaleSecurityGroupsResponse");
   }
@@ -61,7 +61,7 @@ DescribeStaleSecurityGroupsResponse& DescribeStaleSecurityGroupsResponse::operat
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
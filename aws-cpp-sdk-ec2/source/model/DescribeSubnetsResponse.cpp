@@ -40,7 +40,7 @@ DescribeSubnetsResponse& DescribeSubnetsResponse::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeSubnetsResponse")
+  if (rootNode.GetNameView() != "DescribeSubnetsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeSubnetsResponse");
   }
@@ -40,7 +40,7 @@ DescribeTagsResponse& DescribeTagsResponse::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeTagsResponse")
+  if (rootNode.GetNameView() != "DescribeTagsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeTagsResponse");
   }
@@ -61,7 +61,7 @@ DescribeTagsResponse& DescribeTagsResponse::operator =(const AmazonWebServiceRes
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
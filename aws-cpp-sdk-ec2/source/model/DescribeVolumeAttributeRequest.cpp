@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeVolumeAttributeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ DescribeVolumeAttributeRequest::DescribeVolumeAttributeRequest() :
 
 Aws::String DescribeVolumeAttributeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeVolumeAttribute&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,7 +39,7 @@ Aws::String DescribeVolumeAttributeRequest::SerializePayload() const
 
   if(m_volumeIdHasBeenSet)
   {
-    ss << "VolumeId=" << StringUtils::URLEncode(m_volumeId.c_str()) << "&";
+    ss << "VolumeId=" << StringUtils::URLEncoded(m_volumeId) << "&";
   }
 
   if(m_attributeHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String DescribeVolumeAttributeRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
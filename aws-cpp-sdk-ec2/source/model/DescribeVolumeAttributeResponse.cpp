@@ -40,7 +40,7 @@ DescribeVolumeAttributeResponse& DescribeVolumeAttributeResponse::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeVolumeAttributeResponse")
+  if (rootNode.GetNameView() != "DescribeVolumeAttributeResponse")
   {
     resultNode = rootNode.FirstChild("DescribeVolumeAttributeResponse");
   }
@@ -50,7 +50,7 @@ DescribeVolumeAttributeResponse& DescribeVolumeAttributeResponse::operator =(con
     XmlNode volumeIdNode = resultNode.FirstChild("volumeId");
     if(!volumeIdNode.IsNull())
     {
-      m_volumeId = StringUtils::Trim(volumeIdNode.GetText().c_str());
+      m_volumeId = volumeIdNode.GetTextView().Trim().ToString();
     }
     XmlNode autoEnableIONode = resultNode.FirstChild("autoEnableIO");
     if(!autoEnableIONode.IsNull())
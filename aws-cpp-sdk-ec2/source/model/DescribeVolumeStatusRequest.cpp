@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeVolumeStatusRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -32,7 +33,7 @@ DescribeVolumeStatusRequest::DescribeVolumeStatusRequest() :
 
 Aws::String DescribeVolumeStatusRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeVolumeStatus&";
   if(m_dryRunHasBeenSet)
   {
@@ -45,7 +46,7 @@ Aws::String DescribeVolumeStatusRequest::SerializePayload() const
     for(auto& item : m_volumeIds)
     {
       ss << "VolumeId." << volumeIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       volumeIdsCount++;
     }
   }
@@ -62,7 +63,7 @@ Aws::String DescribeVolumeStatusRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxResultsHasBeenSet)
@@ -71,6 +72,6 @@ Aws::String DescribeVolumeStatusRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeVolumeStatusResponse& DescribeVolumeStatusResponse::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeVolumeStatusResponse")
+  if (rootNode.GetNameView() != "DescribeVolumeStatusResponse")
   {
     resultNode = rootNode.FirstChild("DescribeVolumeStatusResponse");
   }
@@ -61,7 +61,7 @@ DescribeVolumeStatusResponse& DescribeVolumeStatusResponse::operator =(const Ama
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ DescribeVolumesResponse& DescribeVolumesResponse::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeVolumesResponse")
+  if (rootNode.GetNameView() != "DescribeVolumesResponse")
   {
     resultNode = rootNode.FirstChild("DescribeVolumesResponse");
   }
@@ -61,7 +61,7 @@ DescribeVolumesResponse& DescribeVolumesResponse::operator =(const AmazonWebServ
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
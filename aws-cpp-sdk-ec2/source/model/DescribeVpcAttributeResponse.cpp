@@ -40,7 +40,7 @@ DescribeVpcAttributeResponse& DescribeVpcAttributeResponse::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeVpcAttributeResponse")
+  if (rootNode.GetNameView() != "DescribeVpcAttributeResponse")
   {
     resultNode = rootNode.FirstChild("DescribeVpcAttributeResponse");
   }
@@ -50,7 +50,7 @@ DescribeVpcAttributeResponse& DescribeVpcAttributeResponse::operator =(const Ama
     XmlNode vpcIdNode = resultNode.FirstChild("vpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
     }
     XmlNode enableDnsSupportNode = resultNode.FirstChild("enableDnsSupport");
     if(!enableDnsSupportNode.IsNull())
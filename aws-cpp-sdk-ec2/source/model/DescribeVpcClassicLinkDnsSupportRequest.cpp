@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeVpcClassicLinkDnsSupportRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ DescribeVpcClassicLinkDnsSupportRequest::DescribeVpcClassicLinkDnsSupportRequest
 
 Aws::String DescribeVpcClassicLinkDnsSupportRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeVpcClassicLinkDnsSupport&";
   if(m_vpcIdsHasBeenSet)
   {
@@ -37,7 +38,7 @@ Aws::String DescribeVpcClassicLinkDnsSupportRequest::SerializePayload() const
     for(auto& item : m_vpcIds)
     {
       ss << "VpcIds.member." << vpcIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       vpcIdsCount++;
     }
   }
@@ -49,10 +50,10 @@ Aws::String DescribeVpcClassicLinkDnsSupportRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
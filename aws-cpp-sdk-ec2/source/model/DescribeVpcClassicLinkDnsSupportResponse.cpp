@@ -40,7 +40,7 @@ DescribeVpcClassicLinkDnsSupportResponse& DescribeVpcClassicLinkDnsSupportRespon
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeVpcClassicLinkDnsSupportResponse")
+  if (rootNode.GetNameView() != "DescribeVpcClassicLinkDnsSupportResponse")
   {
     resultNode = rootNode.FirstChild("DescribeVpcClassicLinkDnsSupportResponse");
   }
@@ -61,7 +61,7 @@ DescribeVpcClassicLinkDnsSupportResponse& DescribeVpcClassicLinkDnsSupportRespon
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ DescribeVpcClassicLinkResponse& DescribeVpcClassicLinkResponse::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeVpcClassicLinkResponse")
+  if (rootNode.GetNameView() != "DescribeVpcClassicLinkResponse")
   {
     resultNode = rootNode.FirstChild("DescribeVpcClassicLinkResponse");
   }
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DescribeVpcEndpointServicesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ DescribeVpcEndpointServicesRequest::DescribeVpcEndpointServicesRequest() :
 
 Aws::String DescribeVpcEndpointServicesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeVpcEndpointServices&";
   if(m_dryRunHasBeenSet)
   {
@@ -44,10 +45,10 @@ Aws::String DescribeVpcEndpointServicesRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeVpcEndpointServicesResponse& DescribeVpcEndpointServicesResponse::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeVpcEndpointServicesResponse")
+  if (rootNode.GetNameView() != "DescribeVpcEndpointServicesResponse")
   {
     resultNode = rootNode.FirstChild("DescribeVpcEndpointServicesResponse");
   }
@@ -53,7 +53,7 @@ DescribeVpcEndpointServicesResponse& DescribeVpcEndpointServicesResponse::operat
       XmlNode serviceNamesMember = serviceNamesNode.FirstChild("item");
       while(!serviceNamesMember.IsNull())
       {
-        m_serviceNames.push_back(StringUtils::Trim(serviceNamesMember.GetText().c_str()));
+        m_serviceNames.push_back(serviceNamesMember.GetTextView().Trim().ToString());
         serviceNamesMember = serviceNamesMember.NextNode("item");
       }
 
@@ -61,7 +61,7 @@ DescribeVpcEndpointServicesResponse& DescribeVpcEndpointServicesResponse::operat
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
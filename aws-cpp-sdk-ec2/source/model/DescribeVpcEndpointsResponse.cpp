@@ -40,7 +40,7 @@ DescribeVpcEndpointsResponse& DescribeVpcEndpointsResponse::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeVpcEndpointsResponse")
+  if (rootNode.GetNameView() != "DescribeVpcEndpointsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeVpcEndpointsResponse");
   }
@@ -61,7 +61,7 @@ DescribeVpcEndpointsResponse& DescribeVpcEndpointsResponse::operator =(const Ama
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
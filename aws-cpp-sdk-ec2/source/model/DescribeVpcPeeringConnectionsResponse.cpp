@@ -40,7 +40,7 @@ DescribeVpcPeeringConnectionsResponse& DescribeVpcPeeringConnectionsResponse::op
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeVpcPeeringConnectionsResponse")
+  if (rootNode.GetNameView() != "DescribeVpcPeeringConnectionsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeVpcPeeringConnectionsResponse");
   }
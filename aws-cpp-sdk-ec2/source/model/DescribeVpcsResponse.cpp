@@ -40,7 +40,7 @@ DescribeVpcsResponse& DescribeVpcsResponse::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeVpcsResponse")
+  if (rootNode.GetNameView() != "DescribeVpcsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeVpcsResponse");
   }
@@ -40,7 +40,7 @@ DescribeVpnConnectionsResponse& DescribeVpnConnectionsResponse::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeVpnConnectionsResponse")
+  if (rootNode.GetNameView() != "DescribeVpnConnectionsResponse")
   {
     resultNode = rootNode.FirstChild("DescribeVpnConnectionsResponse");
   }
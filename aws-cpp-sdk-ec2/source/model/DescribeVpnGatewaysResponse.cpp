@@ -40,7 +40,7 @@ DescribeVpnGatewaysResponse& DescribeVpnGatewaysResponse::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeVpnGatewaysResponse")
+  if (rootNode.GetNameView() != "DescribeVpnGatewaysResponse")
   {
     resultNode = rootNode.FirstChild("DescribeVpnGatewaysResponse");
   }
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DetachNetworkInterfaceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ DetachNetworkInterfaceRequest::DetachNetworkInterfaceRequest() :
 
 Aws::String DetachNetworkInterfaceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DetachNetworkInterface&";
   if(m_dryRunHasBeenSet)
   {
@@ -39,7 +40,7 @@ Aws::String DetachNetworkInterfaceRequest::SerializePayload() const
 
   if(m_attachmentIdHasBeenSet)
   {
-    ss << "AttachmentId=" << StringUtils::URLEncode(m_attachmentId.c_str()) << "&";
+    ss << "AttachmentId=" << StringUtils::URLEncoded(m_attachmentId) << "&";
   }
 
   if(m_forceHasBeenSet)
@@ -48,6 +49,6 @@ Aws::String DetachNetworkInterfaceRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
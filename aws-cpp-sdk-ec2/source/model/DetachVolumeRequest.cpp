@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DetachVolumeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -32,7 +33,7 @@ DetachVolumeRequest::DetachVolumeRequest() :
 
 Aws::String DetachVolumeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DetachVolume&";
   if(m_dryRunHasBeenSet)
   {
@@ -41,17 +42,17 @@ Aws::String DetachVolumeRequest::SerializePayload() const
 
   if(m_volumeIdHasBeenSet)
   {
-    ss << "VolumeId=" << StringUtils::URLEncode(m_volumeId.c_str()) << "&";
+    ss << "VolumeId=" << StringUtils::URLEncoded(m_volumeId) << "&";
   }
 
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_deviceHasBeenSet)
   {
-    ss << "Device=" << StringUtils::URLEncode(m_device.c_str()) << "&";
+    ss << "Device=" << StringUtils::URLEncoded(m_device) << "&";
   }
 
   if(m_forceHasBeenSet)
@@ -60,6 +61,6 @@ Aws::String DetachVolumeRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ DhcpConfiguration& DhcpConfiguration::operator =(const XmlNode& xmlNode)
     XmlNode keyNode = resultNode.FirstChild("key");
     if(!keyNode.IsNull())
     {
-      m_key = StringUtils::Trim(keyNode.GetText().c_str());
+      m_key = keyNode.GetTextView().Trim().ToString();
       m_keyHasBeenSet = true;
     }
     XmlNode valuesNode = resultNode.FirstChild("valueSet");
@@ -75,7 +76,7 @@ void DhcpConfiguration::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_keyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Key=" << StringUtils::URLEncode(m_key.c_str()) << "&";
+      oStream << location << index << locationValue << ".Key=" << StringUtils::URLEncoded(m_key) << "&";
   }
 
   if(m_valuesHasBeenSet)
@@ -83,9 +84,9 @@ void DhcpConfiguration::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned valuesIdx = 1;
       for(auto& item : m_values)
       {
-        Aws::StringStream valuesSs;
+        Aws::Utils::Stream::StringOutputStream valuesSs;
         valuesSs << location << index << locationValue << ".ValueSet." << valuesIdx++;
-        item.OutputToStream(oStream, valuesSs.str().c_str());
+        item.OutputToStream(oStream, valuesSs.GetString().c_str());
       }
   }
 
@@ -95,16 +96,16 @@ void DhcpConfiguration::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_keyHasBeenSet)
   {
-      oStream << location << ".Key=" << StringUtils::URLEncode(m_key.c_str()) << "&";
+      oStream << location << ".Key=" << StringUtils::URLEncoded(m_key) << "&";
   }
   if(m_valuesHasBeenSet)
   {
       unsigned valuesIdx = 1;
       for(auto& item : m_values)
       {
-        Aws::StringStream valuesSs;
+        Aws::Utils::Stream::StringOutputStream valuesSs;
         valuesSs << location <<  ".item." << valuesIdx++;
-        item.OutputToStream(oStream, valuesSs.str().c_str());
+        item.OutputToStream(oStream, valuesSs.GetString().c_str());
       }
   }
 }
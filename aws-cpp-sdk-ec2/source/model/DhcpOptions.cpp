@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,7 +54,7 @@ DhcpOptions& DhcpOptions::operator =(const XmlNode& xmlNode)
     XmlNode dhcpOptionsIdNode = resultNode.FirstChild("dhcpOptionsId");
     if(!dhcpOptionsIdNode.IsNull())
     {
-      m_dhcpOptionsId = StringUtils::Trim(dhcpOptionsIdNode.GetText().c_str());
+      m_dhcpOptionsId = dhcpOptionsIdNode.GetTextView().Trim().ToString();
       m_dhcpOptionsIdHasBeenSet = true;
     }
     XmlNode dhcpConfigurationsNode = resultNode.FirstChild("dhcpConfigurationSet");
@@ -89,7 +90,7 @@ void DhcpOptions::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_dhcpOptionsIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DhcpOptionsId=" << StringUtils::URLEncode(m_dhcpOptionsId.c_str()) << "&";
+      oStream << location << index << locationValue << ".DhcpOptionsId=" << StringUtils::URLEncoded(m_dhcpOptionsId) << "&";
   }
 
   if(m_dhcpConfigurationsHasBeenSet)
@@ -97,9 +98,9 @@ void DhcpOptions::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned dhcpConfigurationsIdx = 1;
       for(auto& item : m_dhcpConfigurations)
       {
-        Aws::StringStream dhcpConfigurationsSs;
+        Aws::Utils::Stream::StringOutputStream dhcpConfigurationsSs;
         dhcpConfigurationsSs << location << index << locationValue << ".DhcpConfigurationSet." << dhcpConfigurationsIdx++;
-        item.OutputToStream(oStream, dhcpConfigurationsSs.str().c_str());
+        item.OutputToStream(oStream, dhcpConfigurationsSs.GetString().c_str());
       }
   }
 
@@ -108,9 +109,9 @@ void DhcpOptions::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -120,16 +121,16 @@ void DhcpOptions::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_dhcpOptionsIdHasBeenSet)
   {
-      oStream << location << ".DhcpOptionsId=" << StringUtils::URLEncode(m_dhcpOptionsId.c_str()) << "&";
+      oStream << location << ".DhcpOptionsId=" << StringUtils::URLEncoded(m_dhcpOptionsId) << "&";
   }
   if(m_dhcpConfigurationsHasBeenSet)
   {
       unsigned dhcpConfigurationsIdx = 1;
       for(auto& item : m_dhcpConfigurations)
       {
-        Aws::StringStream dhcpConfigurationsSs;
+        Aws::Utils::Stream::StringOutputStream dhcpConfigurationsSs;
         dhcpConfigurationsSs << location <<  ".item." << dhcpConfigurationsIdx++;
-        item.OutputToStream(oStream, dhcpConfigurationsSs.str().c_str());
+        item.OutputToStream(oStream, dhcpConfigurationsSs.GetString().c_str());
       }
   }
   if(m_tagsHasBeenSet)
@@ -137,9 +138,9 @@ void DhcpOptions::OutputToStream(Aws::OStream& oStream, const char* location) co
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
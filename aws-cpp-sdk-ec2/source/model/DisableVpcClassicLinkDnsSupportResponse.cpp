@@ -42,7 +42,7 @@ DisableVpcClassicLinkDnsSupportResponse& DisableVpcClassicLinkDnsSupportResponse
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DisableVpcClassicLinkDnsSupportResponse")
+  if (rootNode.GetNameView() != "DisableVpcClassicLinkDnsSupportResponse")
   {
     resultNode = rootNode.FirstChild("DisableVpcClassicLinkDnsSupportResponse");
   }
@@ -52,7 +52,7 @@ DisableVpcClassicLinkDnsSupportResponse& DisableVpcClassicLinkDnsSupportResponse
     XmlNode returnNode = resultNode.FirstChild("return");
     if(!returnNode.IsNull())
     {
-      m_return = StringUtils::ConvertToBool(StringUtils::Trim(returnNode.GetText().c_str()).c_str());
+      m_return = StringUtils::ConvertToBool(returnNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
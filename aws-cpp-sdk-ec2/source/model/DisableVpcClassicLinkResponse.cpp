@@ -42,7 +42,7 @@ DisableVpcClassicLinkResponse& DisableVpcClassicLinkResponse::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DisableVpcClassicLinkResponse")
+  if (rootNode.GetNameView() != "DisableVpcClassicLinkResponse")
   {
     resultNode = rootNode.FirstChild("DisableVpcClassicLinkResponse");
   }
@@ -52,7 +52,7 @@ DisableVpcClassicLinkResponse& DisableVpcClassicLinkResponse::operator =(const A
     XmlNode returnNode = resultNode.FirstChild("return");
     if(!returnNode.IsNull())
     {
-      m_return = StringUtils::ConvertToBool(StringUtils::Trim(returnNode.GetText().c_str()).c_str());
+      m_return = StringUtils::ConvertToBool(returnNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DisassociateAddressRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ DisassociateAddressRequest::DisassociateAddressRequest() :
 
 Aws::String DisassociateAddressRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DisassociateAddress&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String DisassociateAddressRequest::SerializePayload() const
 
   if(m_publicIpHasBeenSet)
   {
-    ss << "PublicIp=" << StringUtils::URLEncode(m_publicIp.c_str()) << "&";
+    ss << "PublicIp=" << StringUtils::URLEncoded(m_publicIp) << "&";
   }
 
   if(m_associationIdHasBeenSet)
   {
-    ss << "AssociationId=" << StringUtils::URLEncode(m_associationId.c_str()) << "&";
+    ss << "AssociationId=" << StringUtils::URLEncoded(m_associationId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
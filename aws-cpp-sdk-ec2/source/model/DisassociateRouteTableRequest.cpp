@@ -15,6 +15,7 @@
 #include <aws/ec2/model/DisassociateRouteTableRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,7 +29,7 @@ DisassociateRouteTableRequest::DisassociateRouteTableRequest() :
 
 Aws::String DisassociateRouteTableRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DisassociateRouteTable&";
   if(m_dryRunHasBeenSet)
   {
@@ -37,10 +38,10 @@ Aws::String DisassociateRouteTableRequest::SerializePayload() const
 
   if(m_associationIdHasBeenSet)
   {
-    ss << "AssociationId=" << StringUtils::URLEncode(m_associationId.c_str()) << "&";
+    ss << "AssociationId=" << StringUtils::URLEncoded(m_associationId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
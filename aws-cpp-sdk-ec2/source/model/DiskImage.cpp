@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,7 +60,7 @@ DiskImage& DiskImage::operator =(const XmlNode& xmlNode)
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode volumeNode = resultNode.FirstChild("Volume");
@@ -77,21 +78,21 @@ void DiskImage::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 {
   if(m_imageHasBeenSet)
   {
-      Aws::StringStream imageLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream imageLocationAndMemberSs;
       imageLocationAndMemberSs << location << index << locationValue << ".Image";
-      m_image.OutputToStream(oStream, imageLocationAndMemberSs.str().c_str());
+      m_image.OutputToStream(oStream, imageLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_volumeHasBeenSet)
   {
-      Aws::StringStream volumeLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream volumeLocationAndMemberSs;
       volumeLocationAndMemberSs << location << index << locationValue << ".Volume";
-      m_volume.OutputToStream(oStream, volumeLocationAndMemberSs.str().c_str());
+      m_volume.OutputToStream(oStream, volumeLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -106,7 +107,7 @@ void DiskImage::OutputToStream(Aws::OStream& oStream, const char* location) cons
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_volumeHasBeenSet)
   {
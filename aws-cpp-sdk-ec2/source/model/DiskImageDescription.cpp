@@ -57,25 +57,25 @@ DiskImageDescription& DiskImageDescription::operator =(const XmlNode& xmlNode)
     XmlNode formatNode = resultNode.FirstChild("format");
     if(!formatNode.IsNull())
     {
-      m_format = DiskImageFormatMapper::GetDiskImageFormatForName(StringUtils::Trim(formatNode.GetText().c_str()).c_str());
+      m_format = DiskImageFormatMapper::GetDiskImageFormatForName(formatNode.GetTextView().Trim().ToString().c_str());
       m_formatHasBeenSet = true;
     }
     XmlNode sizeNode = resultNode.FirstChild("size");
     if(!sizeNode.IsNull())
     {
-      m_size = StringUtils::ConvertToInt64(StringUtils::Trim(sizeNode.GetText().c_str()).c_str());
+      m_size = StringUtils::ConvertToInt64(sizeNode.GetTextView().Trim().ToString().c_str());
       m_sizeHasBeenSet = true;
     }
     XmlNode importManifestUrlNode = resultNode.FirstChild("importManifestUrl");
     if(!importManifestUrlNode.IsNull())
     {
-      m_importManifestUrl = StringUtils::Trim(importManifestUrlNode.GetText().c_str());
+      m_importManifestUrl = importManifestUrlNode.GetTextView().Trim().ToString();
       m_importManifestUrlHasBeenSet = true;
     }
     XmlNode checksumNode = resultNode.FirstChild("checksum");
     if(!checksumNode.IsNull())
     {
-      m_checksum = StringUtils::Trim(checksumNode.GetText().c_str());
+      m_checksum = checksumNode.GetTextView().Trim().ToString();
       m_checksumHasBeenSet = true;
     }
   }
@@ -97,12 +97,12 @@ void DiskImageDescription::OutputToStream(Aws::OStream& oStream, const char* loc
 
   if(m_importManifestUrlHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ImportManifestUrl=" << StringUtils::URLEncode(m_importManifestUrl.c_str()) << "&";
+      oStream << location << index << locationValue << ".ImportManifestUrl=" << StringUtils::URLEncoded(m_importManifestUrl) << "&";
   }
 
   if(m_checksumHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Checksum=" << StringUtils::URLEncode(m_checksum.c_str()) << "&";
+      oStream << location << index << locationValue << ".Checksum=" << StringUtils::URLEncoded(m_checksum) << "&";
   }
 
 }
@@ -119,11 +119,11 @@ void DiskImageDescription::OutputToStream(Aws::OStream& oStream, const char* loc
   }
   if(m_importManifestUrlHasBeenSet)
   {
-      oStream << location << ".ImportManifestUrl=" << StringUtils::URLEncode(m_importManifestUrl.c_str()) << "&";
+      oStream << location << ".ImportManifestUrl=" << StringUtils::URLEncoded(m_importManifestUrl) << "&";
   }
   if(m_checksumHasBeenSet)
   {
-      oStream << location << ".Checksum=" << StringUtils::URLEncode(m_checksum.c_str()) << "&";
+      oStream << location << ".Checksum=" << StringUtils::URLEncoded(m_checksum) << "&";
   }
 }
 
@@ -55,19 +55,19 @@ DiskImageDetail& DiskImageDetail::operator =(const XmlNode& xmlNode)
     XmlNode formatNode = resultNode.FirstChild("format");
     if(!formatNode.IsNull())
     {
-      m_format = DiskImageFormatMapper::GetDiskImageFormatForName(StringUtils::Trim(formatNode.GetText().c_str()).c_str());
+      m_format = DiskImageFormatMapper::GetDiskImageFormatForName(formatNode.GetTextView().Trim().ToString().c_str());
       m_formatHasBeenSet = true;
     }
     XmlNode bytesNode = resultNode.FirstChild("bytes");
     if(!bytesNode.IsNull())
     {
-      m_bytes = StringUtils::ConvertToInt64(StringUtils::Trim(bytesNode.GetText().c_str()).c_str());
+      m_bytes = StringUtils::ConvertToInt64(bytesNode.GetTextView().Trim().ToString().c_str());
       m_bytesHasBeenSet = true;
     }
     XmlNode importManifestUrlNode = resultNode.FirstChild("importManifestUrl");
     if(!importManifestUrlNode.IsNull())
     {
-      m_importManifestUrl = StringUtils::Trim(importManifestUrlNode.GetText().c_str());
+      m_importManifestUrl = importManifestUrlNode.GetTextView().Trim().ToString();
       m_importManifestUrlHasBeenSet = true;
     }
   }
@@ -89,7 +89,7 @@ void DiskImageDetail::OutputToStream(Aws::OStream& oStream, const char* location
 
   if(m_importManifestUrlHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ImportManifestUrl=" << StringUtils::URLEncode(m_importManifestUrl.c_str()) << "&";
+      oStream << location << index << locationValue << ".ImportManifestUrl=" << StringUtils::URLEncoded(m_importManifestUrl) << "&";
   }
 
 }
@@ -106,7 +106,7 @@ void DiskImageDetail::OutputToStream(Aws::OStream& oStream, const char* location
   }
   if(m_importManifestUrlHasBeenSet)
   {
-      oStream << location << ".ImportManifestUrl=" << StringUtils::URLEncode(m_importManifestUrl.c_str()) << "&";
+      oStream << location << ".ImportManifestUrl=" << StringUtils::URLEncoded(m_importManifestUrl) << "&";
   }
 }
 
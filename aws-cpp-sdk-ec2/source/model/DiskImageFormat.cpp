@@ -29,26 +29,32 @@ namespace Aws
       namespace DiskImageFormatMapper
       {
 
-        static const int VMDK_HASH = HashingUtils::HashString("VMDK");
-        static const int RAW_HASH = HashingUtils::HashString("RAW");
-        static const int VHD_HASH = HashingUtils::HashString("VHD");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int VMDK_HASH = 2638206;
+        static const int RAW_HASH = 80904;
+        static const int VHD_HASH = 84946;
 
 
         DiskImageFormat GetDiskImageFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VMDK_HASH)
+          switch (hashCode)
           {
+          case VMDK_HASH:
             return DiskImageFormat::VMDK;
-          }
-          else if (hashCode == RAW_HASH)
-          {
+          case RAW_HASH:
             return DiskImageFormat::RAW;
-          }
-          else if (hashCode == VHD_HASH)
-          {
+          case VHD_HASH:
             return DiskImageFormat::VHD;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -53,13 +53,13 @@ DiskImageVolumeDescription& DiskImageVolumeDescription::operator =(const XmlNode
     XmlNode sizeNode = resultNode.FirstChild("size");
     if(!sizeNode.IsNull())
     {
-      m_size = StringUtils::ConvertToInt64(StringUtils::Trim(sizeNode.GetText().c_str()).c_str());
+      m_size = StringUtils::ConvertToInt64(sizeNode.GetTextView().Trim().ToString().c_str());
       m_sizeHasBeenSet = true;
     }
     XmlNode idNode = resultNode.FirstChild("id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
   }
@@ -76,7 +76,7 @@ void DiskImageVolumeDescription::OutputToStream(Aws::OStream& oStream, const cha
 
   if(m_idHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
 
 }
@@ -89,7 +89,7 @@ void DiskImageVolumeDescription::OutputToStream(Aws::OStream& oStream, const cha
   }
   if(m_idHasBeenSet)
   {
-      oStream << location << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
 }
 
@@ -29,21 +29,29 @@ namespace Aws
       namespace DomainTypeMapper
       {
 
-        static const int vpc_HASH = HashingUtils::HashString("vpc");
-        static const int standard_HASH = HashingUtils::HashString("standard");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int vpc_HASH = 116969;
+        static const int standard_HASH = 1312628413;
 
 
         DomainType GetDomainTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == vpc_HASH)
+          switch (hashCode)
           {
+          case vpc_HASH:
             return DomainType::vpc;
-          }
-          else if (hashCode == standard_HASH)
-          {
+          case standard_HASH:
             return DomainType::standard;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
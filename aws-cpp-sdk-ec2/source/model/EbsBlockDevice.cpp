@@ -67,37 +67,37 @@ EbsBlockDevice& EbsBlockDevice::operator =(const XmlNode& xmlNode)
     XmlNode snapshotIdNode = resultNode.FirstChild("snapshotId");
     if(!snapshotIdNode.IsNull())
     {
-      m_snapshotId = StringUtils::Trim(snapshotIdNode.GetText().c_str());
+      m_snapshotId = snapshotIdNode.GetTextView().Trim().ToString();
       m_snapshotIdHasBeenSet = true;
     }
     XmlNode volumeSizeNode = resultNode.FirstChild("volumeSize");
     if(!volumeSizeNode.IsNull())
     {
-      m_volumeSize = StringUtils::ConvertToInt32(StringUtils::Trim(volumeSizeNode.GetText().c_str()).c_str());
+      m_volumeSize = StringUtils::ConvertToInt32(volumeSizeNode.GetTextView().Trim().ToString().c_str());
       m_volumeSizeHasBeenSet = true;
     }
     XmlNode deleteOnTerminationNode = resultNode.FirstChild("deleteOnTermination");
     if(!deleteOnTerminationNode.IsNull())
     {
-      m_deleteOnTermination = StringUtils::ConvertToBool(StringUtils::Trim(deleteOnTerminationNode.GetText().c_str()).c_str());
+      m_deleteOnTermination = StringUtils::ConvertToBool(deleteOnTerminationNode.GetTextView().Trim().ToString().c_str());
       m_deleteOnTerminationHasBeenSet = true;
     }
     XmlNode volumeTypeNode = resultNode.FirstChild("volumeType");
     if(!volumeTypeNode.IsNull())
     {
-      m_volumeType = VolumeTypeMapper::GetVolumeTypeForName(StringUtils::Trim(volumeTypeNode.GetText().c_str()).c_str());
+      m_volumeType = VolumeTypeMapper::GetVolumeTypeForName(volumeTypeNode.GetTextView().Trim().ToString().c_str());
       m_volumeTypeHasBeenSet = true;
     }
     XmlNode iopsNode = resultNode.FirstChild("iops");
     if(!iopsNode.IsNull())
     {
-      m_iops = StringUtils::ConvertToInt32(StringUtils::Trim(iopsNode.GetText().c_str()).c_str());
+      m_iops = StringUtils::ConvertToInt32(iopsNode.GetTextView().Trim().ToString().c_str());
       m_iopsHasBeenSet = true;
     }
     XmlNode encryptedNode = resultNode.FirstChild("encrypted");
     if(!encryptedNode.IsNull())
     {
-      m_encrypted = StringUtils::ConvertToBool(StringUtils::Trim(encryptedNode.GetText().c_str()).c_str());
+      m_encrypted = StringUtils::ConvertToBool(encryptedNode.GetTextView().Trim().ToString().c_str());
       m_encryptedHasBeenSet = true;
     }
   }
@@ -109,7 +109,7 @@ void EbsBlockDevice::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_snapshotIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotId=" << StringUtils::URLEncode(m_snapshotId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotId=" << StringUtils::URLEncoded(m_snapshotId) << "&";
   }
 
   if(m_volumeSizeHasBeenSet)
@@ -143,7 +143,7 @@ void EbsBlockDevice::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_snapshotIdHasBeenSet)
   {
-      oStream << location << ".SnapshotId=" << StringUtils::URLEncode(m_snapshotId.c_str()) << "&";
+      oStream << location << ".SnapshotId=" << StringUtils::URLEncoded(m_snapshotId) << "&";
   }
   if(m_volumeSizeHasBeenSet)
   {
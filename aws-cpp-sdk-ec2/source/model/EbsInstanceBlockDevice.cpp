@@ -57,25 +57,25 @@ EbsInstanceBlockDevice& EbsInstanceBlockDevice::operator =(const XmlNode& xmlNod
     XmlNode volumeIdNode = resultNode.FirstChild("volumeId");
     if(!volumeIdNode.IsNull())
     {
-      m_volumeId = StringUtils::Trim(volumeIdNode.GetText().c_str());
+      m_volumeId = volumeIdNode.GetTextView().Trim().ToString();
       m_volumeIdHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = AttachmentStatusMapper::GetAttachmentStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = AttachmentStatusMapper::GetAttachmentStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode attachTimeNode = resultNode.FirstChild("attachTime");
     if(!attachTimeNode.IsNull())
     {
-      m_attachTime = DateTime(StringUtils::Trim(attachTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_attachTime = DateTime(attachTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_attachTimeHasBeenSet = true;
     }
     XmlNode deleteOnTerminationNode = resultNode.FirstChild("deleteOnTermination");
     if(!deleteOnTerminationNode.IsNull())
     {
-      m_deleteOnTermination = StringUtils::ConvertToBool(StringUtils::Trim(deleteOnTerminationNode.GetText().c_str()).c_str());
+      m_deleteOnTermination = StringUtils::ConvertToBool(deleteOnTerminationNode.GetTextView().Trim().ToString().c_str());
       m_deleteOnTerminationHasBeenSet = true;
     }
   }
@@ -87,7 +87,7 @@ void EbsInstanceBlockDevice::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_volumeIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VolumeId=" << StringUtils::URLEncode(m_volumeId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VolumeId=" << StringUtils::URLEncoded(m_volumeId) << "&";
   }
 
   if(m_statusHasBeenSet)
@@ -97,7 +97,7 @@ void EbsInstanceBlockDevice::OutputToStream(Aws::OStream& oStream, const char* l
 
   if(m_attachTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AttachTime=" << StringUtils::URLEncode(m_attachTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".AttachTime=" << StringUtils::URLEncoded(m_attachTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_deleteOnTerminationHasBeenSet)
@@ -111,7 +111,7 @@ void EbsInstanceBlockDevice::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_volumeIdHasBeenSet)
   {
-      oStream << location << ".VolumeId=" << StringUtils::URLEncode(m_volumeId.c_str()) << "&";
+      oStream << location << ".VolumeId=" << StringUtils::URLEncoded(m_volumeId) << "&";
   }
   if(m_statusHasBeenSet)
   {
@@ -119,7 +119,7 @@ void EbsInstanceBlockDevice::OutputToStream(Aws::OStream& oStream, const char* l
   }
   if(m_attachTimeHasBeenSet)
   {
-      oStream << location << ".AttachTime=" << StringUtils::URLEncode(m_attachTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".AttachTime=" << StringUtils::URLEncoded(m_attachTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_deleteOnTerminationHasBeenSet)
   {
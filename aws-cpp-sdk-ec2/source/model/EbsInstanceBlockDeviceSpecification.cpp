@@ -53,13 +53,13 @@ EbsInstanceBlockDeviceSpecification& EbsInstanceBlockDeviceSpecification::operat
     XmlNode volumeIdNode = resultNode.FirstChild("volumeId");
     if(!volumeIdNode.IsNull())
     {
-      m_volumeId = StringUtils::Trim(volumeIdNode.GetText().c_str());
+      m_volumeId = volumeIdNode.GetTextView().Trim().ToString();
       m_volumeIdHasBeenSet = true;
     }
     XmlNode deleteOnTerminationNode = resultNode.FirstChild("deleteOnTermination");
     if(!deleteOnTerminationNode.IsNull())
     {
-      m_deleteOnTermination = StringUtils::ConvertToBool(StringUtils::Trim(deleteOnTerminationNode.GetText().c_str()).c_str());
+      m_deleteOnTermination = StringUtils::ConvertToBool(deleteOnTerminationNode.GetTextView().Trim().ToString().c_str());
       m_deleteOnTerminationHasBeenSet = true;
     }
   }
@@ -71,7 +71,7 @@ void EbsInstanceBlockDeviceSpecification::OutputToStream(Aws::OStream& oStream,
 {
   if(m_volumeIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VolumeId=" << StringUtils::URLEncode(m_volumeId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VolumeId=" << StringUtils::URLEncoded(m_volumeId) << "&";
   }
 
   if(m_deleteOnTerminationHasBeenSet)
@@ -85,7 +85,7 @@ void EbsInstanceBlockDeviceSpecification::OutputToStream(Aws::OStream& oStream,
 {
   if(m_volumeIdHasBeenSet)
   {
-      oStream << location << ".VolumeId=" << StringUtils::URLEncode(m_volumeId.c_str()) << "&";
+      oStream << location << ".VolumeId=" << StringUtils::URLEncoded(m_volumeId) << "&";
   }
   if(m_deleteOnTerminationHasBeenSet)
   {
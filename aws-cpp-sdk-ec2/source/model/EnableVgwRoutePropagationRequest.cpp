@@ -15,6 +15,7 @@
 #include <aws/ec2/model/EnableVgwRoutePropagationRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ EnableVgwRoutePropagationRequest::EnableVgwRoutePropagationRequest() :
 
 Aws::String EnableVgwRoutePropagationRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=EnableVgwRoutePropagation&";
   if(m_routeTableIdHasBeenSet)
   {
-    ss << "RouteTableId=" << StringUtils::URLEncode(m_routeTableId.c_str()) << "&";
+    ss << "RouteTableId=" << StringUtils::URLEncoded(m_routeTableId) << "&";
   }
 
   if(m_gatewayIdHasBeenSet)
   {
-    ss << "GatewayId=" << StringUtils::URLEncode(m_gatewayId.c_str()) << "&";
+    ss << "GatewayId=" << StringUtils::URLEncoded(m_gatewayId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -42,7 +42,7 @@ EnableVpcClassicLinkDnsSupportResponse& EnableVpcClassicLinkDnsSupportResponse::
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "EnableVpcClassicLinkDnsSupportResponse")
+  if (rootNode.GetNameView() != "EnableVpcClassicLinkDnsSupportResponse")
   {
     resultNode = rootNode.FirstChild("EnableVpcClassicLinkDnsSupportResponse");
   }
@@ -52,7 +52,7 @@ EnableVpcClassicLinkDnsSupportResponse& EnableVpcClassicLinkDnsSupportResponse::
     XmlNode returnNode = resultNode.FirstChild("return");
     if(!returnNode.IsNull())
     {
-      m_return = StringUtils::ConvertToBool(StringUtils::Trim(returnNode.GetText().c_str()).c_str());
+      m_return = StringUtils::ConvertToBool(returnNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
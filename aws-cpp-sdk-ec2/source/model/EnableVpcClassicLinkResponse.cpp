@@ -42,7 +42,7 @@ EnableVpcClassicLinkResponse& EnableVpcClassicLinkResponse::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "EnableVpcClassicLinkResponse")
+  if (rootNode.GetNameView() != "EnableVpcClassicLinkResponse")
   {
     resultNode = rootNode.FirstChild("EnableVpcClassicLinkResponse");
   }
@@ -52,7 +52,7 @@ EnableVpcClassicLinkResponse& EnableVpcClassicLinkResponse::operator =(const Ama
     XmlNode returnNode = resultNode.FirstChild("return");
     if(!returnNode.IsNull())
     {
-      m_return = StringUtils::ConvertToBool(StringUtils::Trim(returnNode.GetText().c_str()).c_str());
+      m_return = StringUtils::ConvertToBool(returnNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
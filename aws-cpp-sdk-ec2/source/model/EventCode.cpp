@@ -29,36 +29,38 @@ namespace Aws
       namespace EventCodeMapper
       {
 
-        static const int instance_reboot_HASH = HashingUtils::HashString("instance-reboot");
-        static const int system_reboot_HASH = HashingUtils::HashString("system-reboot");
-        static const int system_maintenance_HASH = HashingUtils::HashString("system-maintenance");
-        static const int instance_retirement_HASH = HashingUtils::HashString("instance-retirement");
-        static const int instance_stop_HASH = HashingUtils::HashString("instance-stop");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int instance_reboot_HASH = 1390963677;
+        static const int system_reboot_HASH = 712305923;
+        static const int system_maintenance_HASH = -1858557835;
+        static const int instance_retirement_HASH = -1546438607;
+        static const int instance_stop_HASH = -1428673990;
 
 
         EventCode GetEventCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instance_reboot_HASH)
+          switch (hashCode)
           {
+          case instance_reboot_HASH:
             return EventCode::instance_reboot;
-          }
-          else if (hashCode == system_reboot_HASH)
-          {
+          case system_reboot_HASH:
             return EventCode::system_reboot;
-          }
-          else if (hashCode == system_maintenance_HASH)
-          {
+          case system_maintenance_HASH:
             return EventCode::system_maintenance;
-          }
-          else if (hashCode == instance_retirement_HASH)
-          {
+          case instance_retirement_HASH:
             return EventCode::instance_retirement;
-          }
-          else if (hashCode == instance_stop_HASH)
-          {
+          case instance_stop_HASH:
             return EventCode::instance_stop;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -53,19 +53,19 @@ EventInformation& EventInformation::operator =(const XmlNode& xmlNode)
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode eventSubTypeNode = resultNode.FirstChild("eventSubType");
     if(!eventSubTypeNode.IsNull())
     {
-      m_eventSubType = StringUtils::Trim(eventSubTypeNode.GetText().c_str());
+      m_eventSubType = eventSubTypeNode.GetTextView().Trim().ToString();
       m_eventSubTypeHasBeenSet = true;
     }
     XmlNode eventDescriptionNode = resultNode.FirstChild("eventDescription");
     if(!eventDescriptionNode.IsNull())
     {
-      m_eventDescription = StringUtils::Trim(eventDescriptionNode.GetText().c_str());
+      m_eventDescription = eventDescriptionNode.GetTextView().Trim().ToString();
       m_eventDescriptionHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void EventInformation::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_eventSubTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EventSubType=" << StringUtils::URLEncode(m_eventSubType.c_str()) << "&";
+      oStream << location << index << locationValue << ".EventSubType=" << StringUtils::URLEncoded(m_eventSubType) << "&";
   }
 
   if(m_eventDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EventDescription=" << StringUtils::URLEncode(m_eventDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".EventDescription=" << StringUtils::URLEncoded(m_eventDescription) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void EventInformation::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_eventSubTypeHasBeenSet)
   {
-      oStream << location << ".EventSubType=" << StringUtils::URLEncode(m_eventSubType.c_str()) << "&";
+      oStream << location << ".EventSubType=" << StringUtils::URLEncoded(m_eventSubType) << "&";
   }
   if(m_eventDescriptionHasBeenSet)
   {
-      oStream << location << ".EventDescription=" << StringUtils::URLEncode(m_eventDescription.c_str()) << "&";
+      oStream << location << ".EventDescription=" << StringUtils::URLEncoded(m_eventDescription) << "&";
   }
 }
 
@@ -29,26 +29,32 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int instanceChange_HASH = HashingUtils::HashString("instanceChange");
-        static const int fleetRequestChange_HASH = HashingUtils::HashString("fleetRequestChange");
-        static const int error_HASH = HashingUtils::HashString("error");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int instanceChange_HASH = -720105307;
+        static const int fleetRequestChange_HASH = -1951511439;
+        static const int error_HASH = 96784904;
 
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instanceChange_HASH)
+          switch (hashCode)
           {
+          case instanceChange_HASH:
             return EventType::instanceChange;
-          }
-          else if (hashCode == fleetRequestChange_HASH)
-          {
+          case fleetRequestChange_HASH:
             return EventType::fleetRequestChange;
-          }
-          else if (hashCode == error_HASH)
-          {
+          case error_HASH:
             return EventType::error;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
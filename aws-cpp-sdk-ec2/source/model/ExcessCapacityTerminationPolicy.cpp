@@ -29,21 +29,29 @@ namespace Aws
       namespace ExcessCapacityTerminationPolicyMapper
       {
 
-        static const int noTermination_HASH = HashingUtils::HashString("noTermination");
-        static const int default__HASH = HashingUtils::HashString("default");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int noTermination_HASH = -1016992125;
+        static const int default__HASH = 1544803905;
 
 
         ExcessCapacityTerminationPolicy GetExcessCapacityTerminationPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == noTermination_HASH)
+          switch (hashCode)
           {
+          case noTermination_HASH:
             return ExcessCapacityTerminationPolicy::noTermination;
-          }
-          else if (hashCode == default__HASH)
-          {
+          case default__HASH:
             return ExcessCapacityTerminationPolicy::default_;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace ExportEnvironmentMapper
       {
 
-        static const int citrix_HASH = HashingUtils::HashString("citrix");
-        static const int vmware_HASH = HashingUtils::HashString("vmware");
-        static const int microsoft_HASH = HashingUtils::HashString("microsoft");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int citrix_HASH = -1360142957;
+        static const int vmware_HASH = -812421708;
+        static const int microsoft_HASH = -94228242;
 
 
         ExportEnvironment GetExportEnvironmentForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == citrix_HASH)
+          switch (hashCode)
           {
+          case citrix_HASH:
             return ExportEnvironment::citrix;
-          }
-          else if (hashCode == vmware_HASH)
-          {
+          case vmware_HASH:
             return ExportEnvironment::vmware;
-          }
-          else if (hashCode == microsoft_HASH)
-          {
+          case microsoft_HASH:
             return ExportEnvironment::microsoft;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,25 +60,25 @@ ExportTask& ExportTask::operator =(const XmlNode& xmlNode)
     XmlNode exportTaskIdNode = resultNode.FirstChild("exportTaskId");
     if(!exportTaskIdNode.IsNull())
     {
-      m_exportTaskId = StringUtils::Trim(exportTaskIdNode.GetText().c_str());
+      m_exportTaskId = exportTaskIdNode.GetTextView().Trim().ToString();
       m_exportTaskIdHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = ExportTaskStateMapper::GetExportTaskStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = ExportTaskStateMapper::GetExportTaskStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode statusMessageNode = resultNode.FirstChild("statusMessage");
     if(!statusMessageNode.IsNull())
     {
-      m_statusMessage = StringUtils::Trim(statusMessageNode.GetText().c_str());
+      m_statusMessage = statusMessageNode.GetTextView().Trim().ToString();
       m_statusMessageHasBeenSet = true;
     }
     XmlNode instanceExportDetailsNode = resultNode.FirstChild("instanceExport");
@@ -101,12 +102,12 @@ void ExportTask::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_exportTaskIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ExportTaskId=" << StringUtils::URLEncode(m_exportTaskId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ExportTaskId=" << StringUtils::URLEncoded(m_exportTaskId) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_stateHasBeenSet)
@@ -116,21 +117,21 @@ void ExportTask::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
 
   if(m_instanceExportDetailsHasBeenSet)
   {
-      Aws::StringStream instanceExportDetailsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream instanceExportDetailsLocationAndMemberSs;
       instanceExportDetailsLocationAndMemberSs << location << index << locationValue << ".InstanceExportDetails";
-      m_instanceExportDetails.OutputToStream(oStream, instanceExportDetailsLocationAndMemberSs.str().c_str());
+      m_instanceExportDetails.OutputToStream(oStream, instanceExportDetailsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_exportToS3TaskHasBeenSet)
   {
-      Aws::StringStream exportToS3TaskLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream exportToS3TaskLocationAndMemberSs;
       exportToS3TaskLocationAndMemberSs << location << index << locationValue << ".ExportToS3Task";
-      m_exportToS3Task.OutputToStream(oStream, exportToS3TaskLocationAndMemberSs.str().c_str());
+      m_exportToS3Task.OutputToStream(oStream, exportToS3TaskLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -139,11 +140,11 @@ void ExportTask::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_exportTaskIdHasBeenSet)
   {
-      oStream << location << ".ExportTaskId=" << StringUtils::URLEncode(m_exportTaskId.c_str()) << "&";
+      oStream << location << ".ExportTaskId=" << StringUtils::URLEncoded(m_exportTaskId) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_stateHasBeenSet)
   {
@@ -151,7 +152,7 @@ void ExportTask::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
   if(m_instanceExportDetailsHasBeenSet)
   {
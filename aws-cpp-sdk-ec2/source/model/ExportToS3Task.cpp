@@ -55,25 +55,25 @@ ExportToS3Task& ExportToS3Task::operator =(const XmlNode& xmlNode)
     XmlNode diskImageFormatNode = resultNode.FirstChild("diskImageFormat");
     if(!diskImageFormatNode.IsNull())
     {
-      m_diskImageFormat = DiskImageFormatMapper::GetDiskImageFormatForName(StringUtils::Trim(diskImageFormatNode.GetText().c_str()).c_str());
+      m_diskImageFormat = DiskImageFormatMapper::GetDiskImageFormatForName(diskImageFormatNode.GetTextView().Trim().ToString().c_str());
       m_diskImageFormatHasBeenSet = true;
     }
     XmlNode containerFormatNode = resultNode.FirstChild("containerFormat");
     if(!containerFormatNode.IsNull())
     {
-      m_containerFormat = ContainerFormatMapper::GetContainerFormatForName(StringUtils::Trim(containerFormatNode.GetText().c_str()).c_str());
+      m_containerFormat = ContainerFormatMapper::GetContainerFormatForName(containerFormatNode.GetTextView().Trim().ToString().c_str());
       m_containerFormatHasBeenSet = true;
     }
     XmlNode s3BucketNode = resultNode.FirstChild("s3Bucket");
     if(!s3BucketNode.IsNull())
     {
-      m_s3Bucket = StringUtils::Trim(s3BucketNode.GetText().c_str());
+      m_s3Bucket = s3BucketNode.GetTextView().Trim().ToString();
       m_s3BucketHasBeenSet = true;
     }
     XmlNode s3KeyNode = resultNode.FirstChild("s3Key");
     if(!s3KeyNode.IsNull())
     {
-      m_s3Key = StringUtils::Trim(s3KeyNode.GetText().c_str());
+      m_s3Key = s3KeyNode.GetTextView().Trim().ToString();
       m_s3KeyHasBeenSet = true;
     }
   }
@@ -95,12 +95,12 @@ void ExportToS3Task::OutputToStream(Aws::OStream& oStream, const char* location,
 
   if(m_s3BucketHasBeenSet)
   {
-      oStream << location << index << locationValue << ".S3Bucket=" << StringUtils::URLEncode(m_s3Bucket.c_str()) << "&";
+      oStream << location << index << locationValue << ".S3Bucket=" << StringUtils::URLEncoded(m_s3Bucket) << "&";
   }
 
   if(m_s3KeyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".S3Key=" << StringUtils::URLEncode(m_s3Key.c_str()) << "&";
+      oStream << location << index << locationValue << ".S3Key=" << StringUtils::URLEncoded(m_s3Key) << "&";
   }
 
 }
@@ -117,11 +117,11 @@ void ExportToS3Task::OutputToStream(Aws::OStream& oStream, const char* location)
   }
   if(m_s3BucketHasBeenSet)
   {
-      oStream << location << ".S3Bucket=" << StringUtils::URLEncode(m_s3Bucket.c_str()) << "&";
+      oStream << location << ".S3Bucket=" << StringUtils::URLEncoded(m_s3Bucket) << "&";
   }
   if(m_s3KeyHasBeenSet)
   {
-      oStream << location << ".S3Key=" << StringUtils::URLEncode(m_s3Key.c_str()) << "&";
+      oStream << location << ".S3Key=" << StringUtils::URLEncoded(m_s3Key) << "&";
   }
 }
 
@@ -55,25 +55,25 @@ ExportToS3TaskSpecification& ExportToS3TaskSpecification::operator =(const XmlNo
     XmlNode diskImageFormatNode = resultNode.FirstChild("diskImageFormat");
     if(!diskImageFormatNode.IsNull())
     {
-      m_diskImageFormat = DiskImageFormatMapper::GetDiskImageFormatForName(StringUtils::Trim(diskImageFormatNode.GetText().c_str()).c_str());
+      m_diskImageFormat = DiskImageFormatMapper::GetDiskImageFormatForName(diskImageFormatNode.GetTextView().Trim().ToString().c_str());
       m_diskImageFormatHasBeenSet = true;
     }
     XmlNode containerFormatNode = resultNode.FirstChild("containerFormat");
     if(!containerFormatNode.IsNull())
     {
-      m_containerFormat = ContainerFormatMapper::GetContainerFormatForName(StringUtils::Trim(containerFormatNode.GetText().c_str()).c_str());
+      m_containerFormat = ContainerFormatMapper::GetContainerFormatForName(containerFormatNode.GetTextView().Trim().ToString().c_str());
       m_containerFormatHasBeenSet = true;
     }
     XmlNode s3BucketNode = resultNode.FirstChild("s3Bucket");
     if(!s3BucketNode.IsNull())
     {
-      m_s3Bucket = StringUtils::Trim(s3BucketNode.GetText().c_str());
+      m_s3Bucket = s3BucketNode.GetTextView().Trim().ToString();
       m_s3BucketHasBeenSet = true;
     }
     XmlNode s3PrefixNode = resultNode.FirstChild("s3Prefix");
     if(!s3PrefixNode.IsNull())
     {
-      m_s3Prefix = StringUtils::Trim(s3PrefixNode.GetText().c_str());
+      m_s3Prefix = s3PrefixNode.GetTextView().Trim().ToString();
       m_s3PrefixHasBeenSet = true;
     }
   }
@@ -95,12 +95,12 @@ void ExportToS3TaskSpecification::OutputToStream(Aws::OStream& oStream, const ch
 
   if(m_s3BucketHasBeenSet)
   {
-      oStream << location << index << locationValue << ".S3Bucket=" << StringUtils::URLEncode(m_s3Bucket.c_str()) << "&";
+      oStream << location << index << locationValue << ".S3Bucket=" << StringUtils::URLEncoded(m_s3Bucket) << "&";
   }
 
   if(m_s3PrefixHasBeenSet)
   {
-      oStream << location << index << locationValue << ".S3Prefix=" << StringUtils::URLEncode(m_s3Prefix.c_str()) << "&";
+      oStream << location << index << locationValue << ".S3Prefix=" << StringUtils::URLEncoded(m_s3Prefix) << "&";
   }
 
 }
@@ -117,11 +117,11 @@ void ExportToS3TaskSpecification::OutputToStream(Aws::OStream& oStream, const ch
   }
   if(m_s3BucketHasBeenSet)
   {
-      oStream << location << ".S3Bucket=" << StringUtils::URLEncode(m_s3Bucket.c_str()) << "&";
+      oStream << location << ".S3Bucket=" << StringUtils::URLEncoded(m_s3Bucket) << "&";
   }
   if(m_s3PrefixHasBeenSet)
   {
-      oStream << location << ".S3Prefix=" << StringUtils::URLEncode(m_s3Prefix.c_str()) << "&";
+      oStream << location << ".S3Prefix=" << StringUtils::URLEncoded(m_s3Prefix) << "&";
   }
 }
 
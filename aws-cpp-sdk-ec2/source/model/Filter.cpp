@@ -51,7 +51,7 @@ Filter& Filter::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode valuesNode = resultNode.FirstChild("Value");
@@ -60,7 +60,7 @@ Filter& Filter::operator =(const XmlNode& xmlNode)
       XmlNode valuesMember = valuesNode.FirstChild("item");
       while(!valuesMember.IsNull())
       {
-        m_values.push_back(StringUtils::Trim(valuesMember.GetText().c_str()));
+        m_values.push_back(valuesMember.GetTextView().Trim().ToString());
         valuesMember = valuesMember.NextNode("item");
       }
 
@@ -75,7 +75,7 @@ void Filter::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_valuesHasBeenSet)
@@ -83,7 +83,7 @@ void Filter::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
       unsigned valuesIdx = 1;
       for(auto& item : m_values)
       {
-        oStream << location << index << locationValue << ".Value." << valuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".Value." << valuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -93,14 +93,14 @@ void Filter::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_valuesHasBeenSet)
   {
       unsigned valuesIdx = 1;
       for(auto& item : m_values)
       {
-        oStream << location << ".item." << valuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".item." << valuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
@@ -29,21 +29,29 @@ namespace Aws
       namespace FleetTypeMapper
       {
 
-        static const int request_HASH = HashingUtils::HashString("request");
-        static const int maintain_HASH = HashingUtils::HashString("maintain");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int request_HASH = 1095692943;
+        static const int maintain_HASH = -7490165;
 
 
         FleetType GetFleetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == request_HASH)
+          switch (hashCode)
           {
+          case request_HASH:
             return FleetType::request;
-          }
-          else if (hashCode == maintain_HASH)
-          {
+          case maintain_HASH:
             return FleetType::maintain;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -65,55 +65,55 @@ FlowLog& FlowLog::operator =(const XmlNode& xmlNode)
     XmlNode creationTimeNode = resultNode.FirstChild("creationTime");
     if(!creationTimeNode.IsNull())
     {
-      m_creationTime = DateTime(StringUtils::Trim(creationTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_creationTime = DateTime(creationTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_creationTimeHasBeenSet = true;
     }
     XmlNode flowLogIdNode = resultNode.FirstChild("flowLogId");
     if(!flowLogIdNode.IsNull())
     {
-      m_flowLogId = StringUtils::Trim(flowLogIdNode.GetText().c_str());
+      m_flowLogId = flowLogIdNode.GetTextView().Trim().ToString();
       m_flowLogIdHasBeenSet = true;
     }
     XmlNode flowLogStatusNode = resultNode.FirstChild("flowLogStatus");
     if(!flowLogStatusNode.IsNull())
     {
-      m_flowLogStatus = StringUtils::Trim(flowLogStatusNode.GetText().c_str());
+      m_flowLogStatus = flowLogStatusNode.GetTextView().Trim().ToString();
       m_flowLogStatusHasBeenSet = true;
     }
     XmlNode resourceIdNode = resultNode.FirstChild("resourceId");
     if(!resourceIdNode.IsNull())
     {
-      m_resourceId = StringUtils::Trim(resourceIdNode.GetText().c_str());
+      m_resourceId = resourceIdNode.GetTextView().Trim().ToString();
       m_resourceIdHasBeenSet = true;
     }
     XmlNode trafficTypeNode = resultNode.FirstChild("trafficType");
     if(!trafficTypeNode.IsNull())
     {
-      m_trafficType = TrafficTypeMapper::GetTrafficTypeForName(StringUtils::Trim(trafficTypeNode.GetText().c_str()).c_str());
+      m_trafficType = TrafficTypeMapper::GetTrafficTypeForName(trafficTypeNode.GetTextView().Trim().ToString().c_str());
       m_trafficTypeHasBeenSet = true;
     }
     XmlNode logGroupNameNode = resultNode.FirstChild("logGroupName");
     if(!logGroupNameNode.IsNull())
     {
-      m_logGroupName = StringUtils::Trim(logGroupNameNode.GetText().c_str());
+      m_logGroupName = logGroupNameNode.GetTextView().Trim().ToString();
       m_logGroupNameHasBeenSet = true;
     }
     XmlNode deliverLogsStatusNode = resultNode.FirstChild("deliverLogsStatus");
     if(!deliverLogsStatusNode.IsNull())
     {
-      m_deliverLogsStatus = StringUtils::Trim(deliverLogsStatusNode.GetText().c_str());
+      m_deliverLogsStatus = deliverLogsStatusNode.GetTextView().Trim().ToString();
       m_deliverLogsStatusHasBeenSet = true;
     }
     XmlNode deliverLogsErrorMessageNode = resultNode.FirstChild("deliverLogsErrorMessage");
     if(!deliverLogsErrorMessageNode.IsNull())
     {
-      m_deliverLogsErrorMessage = StringUtils::Trim(deliverLogsErrorMessageNode.GetText().c_str());
+      m_deliverLogsErrorMessage = deliverLogsErrorMessageNode.GetTextView().Trim().ToString();
       m_deliverLogsErrorMessageHasBeenSet = true;
     }
     XmlNode deliverLogsPermissionArnNode = resultNode.FirstChild("deliverLogsPermissionArn");
     if(!deliverLogsPermissionArnNode.IsNull())
     {
-      m_deliverLogsPermissionArn = StringUtils::Trim(deliverLogsPermissionArnNode.GetText().c_str());
+      m_deliverLogsPermissionArn = deliverLogsPermissionArnNode.GetTextView().Trim().ToString();
       m_deliverLogsPermissionArnHasBeenSet = true;
     }
   }
@@ -125,22 +125,22 @@ void FlowLog::OutputToStream(Aws::OStream& oStream, const char* location, unsign
 {
   if(m_creationTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreationTime=" << StringUtils::URLEncode(m_creationTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreationTime=" << StringUtils::URLEncoded(m_creationTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_flowLogIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".FlowLogId=" << StringUtils::URLEncode(m_flowLogId.c_str()) << "&";
+      oStream << location << index << locationValue << ".FlowLogId=" << StringUtils::URLEncoded(m_flowLogId) << "&";
   }
 
   if(m_flowLogStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".FlowLogStatus=" << StringUtils::URLEncode(m_flowLogStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".FlowLogStatus=" << StringUtils::URLEncoded(m_flowLogStatus) << "&";
   }
 
   if(m_resourceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceId=" << StringUtils::URLEncode(m_resourceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceId=" << StringUtils::URLEncoded(m_resourceId) << "&";
   }
 
   if(m_trafficTypeHasBeenSet)
@@ -150,22 +150,22 @@ void FlowLog::OutputToStream(Aws::OStream& oStream, const char* location, unsign
 
   if(m_logGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LogGroupName=" << StringUtils::URLEncode(m_logGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".LogGroupName=" << StringUtils::URLEncoded(m_logGroupName) << "&";
   }
 
   if(m_deliverLogsStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DeliverLogsStatus=" << StringUtils::URLEncode(m_deliverLogsStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".DeliverLogsStatus=" << StringUtils::URLEncoded(m_deliverLogsStatus) << "&";
   }
 
   if(m_deliverLogsErrorMessageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DeliverLogsErrorMessage=" << StringUtils::URLEncode(m_deliverLogsErrorMessage.c_str()) << "&";
+      oStream << location << index << locationValue << ".DeliverLogsErrorMessage=" << StringUtils::URLEncoded(m_deliverLogsErrorMessage) << "&";
   }
 
   if(m_deliverLogsPermissionArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DeliverLogsPermissionArn=" << StringUtils::URLEncode(m_deliverLogsPermissionArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".DeliverLogsPermissionArn=" << StringUtils::URLEncoded(m_deliverLogsPermissionArn) << "&";
   }
 
 }
@@ -174,19 +174,19 @@ void FlowLog::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_creationTimeHasBeenSet)
   {
-      oStream << location << ".CreationTime=" << StringUtils::URLEncode(m_creationTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreationTime=" << StringUtils::URLEncoded(m_creationTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_flowLogIdHasBeenSet)
   {
-      oStream << location << ".FlowLogId=" << StringUtils::URLEncode(m_flowLogId.c_str()) << "&";
+      oStream << location << ".FlowLogId=" << StringUtils::URLEncoded(m_flowLogId) << "&";
   }
   if(m_flowLogStatusHasBeenSet)
   {
-      oStream << location << ".FlowLogStatus=" << StringUtils::URLEncode(m_flowLogStatus.c_str()) << "&";
+      oStream << location << ".FlowLogStatus=" << StringUtils::URLEncoded(m_flowLogStatus) << "&";
   }
   if(m_resourceIdHasBeenSet)
   {
-      oStream << location << ".ResourceId=" << StringUtils::URLEncode(m_resourceId.c_str()) << "&";
+      oStream << location << ".ResourceId=" << StringUtils::URLEncoded(m_resourceId) << "&";
   }
   if(m_trafficTypeHasBeenSet)
   {
@@ -194,19 +194,19 @@ void FlowLog::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_logGroupNameHasBeenSet)
   {
-      oStream << location << ".LogGroupName=" << StringUtils::URLEncode(m_logGroupName.c_str()) << "&";
+      oStream << location << ".LogGroupName=" << StringUtils::URLEncoded(m_logGroupName) << "&";
   }
   if(m_deliverLogsStatusHasBeenSet)
   {
-      oStream << location << ".DeliverLogsStatus=" << StringUtils::URLEncode(m_deliverLogsStatus.c_str()) << "&";
+      oStream << location << ".DeliverLogsStatus=" << StringUtils::URLEncoded(m_deliverLogsStatus) << "&";
   }
   if(m_deliverLogsErrorMessageHasBeenSet)
   {
-      oStream << location << ".DeliverLogsErrorMessage=" << StringUtils::URLEncode(m_deliverLogsErrorMessage.c_str()) << "&";
+      oStream << location << ".DeliverLogsErrorMessage=" << StringUtils::URLEncoded(m_deliverLogsErrorMessage) << "&";
   }
   if(m_deliverLogsPermissionArnHasBeenSet)
   {
-      oStream << location << ".DeliverLogsPermissionArn=" << StringUtils::URLEncode(m_deliverLogsPermissionArn.c_str()) << "&";
+      oStream << location << ".DeliverLogsPermissionArn=" << StringUtils::URLEncoded(m_deliverLogsPermissionArn) << "&";
   }
 }
 
@@ -29,26 +29,32 @@ namespace Aws
       namespace FlowLogsResourceTypeMapper
       {
 
-        static const int VPC_HASH = HashingUtils::HashString("VPC");
-        static const int Subnet_HASH = HashingUtils::HashString("Subnet");
-        static const int NetworkInterface_HASH = HashingUtils::HashString("NetworkInterface");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int VPC_HASH = 85193;
+        static const int Subnet_HASH = -1807667331;
+        static const int NetworkInterface_HASH = -1184757045;
 
 
         FlowLogsResourceType GetFlowLogsResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VPC_HASH)
+          switch (hashCode)
           {
+          case VPC_HASH:
             return FlowLogsResourceType::VPC;
-          }
-          else if (hashCode == Subnet_HASH)
-          {
+          case Subnet_HASH:
             return FlowLogsResourceType::Subnet;
-          }
-          else if (hashCode == NetworkInterface_HASH)
-          {
+          case NetworkInterface_HASH:
             return FlowLogsResourceType::NetworkInterface;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
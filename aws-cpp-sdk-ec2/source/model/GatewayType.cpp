@@ -29,16 +29,26 @@ namespace Aws
       namespace GatewayTypeMapper
       {
 
-        static const int ipsec_1_HASH = HashingUtils::HashString("ipsec.1");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ipsec_1_HASH = 2014381325;
 
 
         GatewayType GetGatewayTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ipsec_1_HASH)
+          switch (hashCode)
           {
+          case ipsec_1_HASH:
             return GatewayType::ipsec_1;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -40,7 +40,7 @@ GetConsoleOutputResponse& GetConsoleOutputResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetConsoleOutputResponse")
+  if (rootNode.GetNameView() != "GetConsoleOutputResponse")
   {
     resultNode = rootNode.FirstChild("GetConsoleOutputResponse");
   }
@@ -50,17 +50,17 @@ GetConsoleOutputResponse& GetConsoleOutputResponse::operator =(const AmazonWebSe
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
     }
     XmlNode timestampNode = resultNode.FirstChild("timestamp");
     if(!timestampNode.IsNull())
     {
-      m_timestamp = DateTime(StringUtils::Trim(timestampNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_timestamp = DateTime(timestampNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
     XmlNode outputNode = resultNode.FirstChild("output");
     if(!outputNode.IsNull())
     {
-      m_output = StringUtils::Trim(outputNode.GetText().c_str());
+      m_output = outputNode.GetTextView().Trim().ToString();
     }
   }
 
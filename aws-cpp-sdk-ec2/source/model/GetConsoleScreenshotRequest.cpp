@@ -15,6 +15,7 @@
 #include <aws/ec2/model/GetConsoleScreenshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ GetConsoleScreenshotRequest::GetConsoleScreenshotRequest() :
 
 Aws::String GetConsoleScreenshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetConsoleScreenshot&";
   if(m_dryRunHasBeenSet)
   {
@@ -39,7 +40,7 @@ Aws::String GetConsoleScreenshotRequest::SerializePayload() const
 
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_wakeUpHasBeenSet)
@@ -48,6 +49,6 @@ Aws::String GetConsoleScreenshotRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
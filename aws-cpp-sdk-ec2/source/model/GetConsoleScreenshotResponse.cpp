@@ -40,7 +40,7 @@ GetConsoleScreenshotResponse& GetConsoleScreenshotResponse::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetConsoleScreenshotResponse")
+  if (rootNode.GetNameView() != "GetConsoleScreenshotResponse")
   {
     resultNode = rootNode.FirstChild("GetConsoleScreenshotResponse");
   }
@@ -50,12 +50,12 @@ GetConsoleScreenshotResponse& GetConsoleScreenshotResponse::operator =(const Ama
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
     }
     XmlNode imageDataNode = resultNode.FirstChild("imageData");
     if(!imageDataNode.IsNull())
     {
-      m_imageData = StringUtils::Trim(imageDataNode.GetText().c_str());
+      m_imageData = imageDataNode.GetTextView().Trim().ToString();
     }
   }
 
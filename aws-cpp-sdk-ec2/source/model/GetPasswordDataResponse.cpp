@@ -40,7 +40,7 @@ GetPasswordDataResponse& GetPasswordDataResponse::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetPasswordDataResponse")
+  if (rootNode.GetNameView() != "GetPasswordDataResponse")
   {
     resultNode = rootNode.FirstChild("GetPasswordDataResponse");
   }
@@ -50,17 +50,17 @@ GetPasswordDataResponse& GetPasswordDataResponse::operator =(const AmazonWebServ
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
     }
     XmlNode timestampNode = resultNode.FirstChild("timestamp");
     if(!timestampNode.IsNull())
     {
-      m_timestamp = DateTime(StringUtils::Trim(timestampNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_timestamp = DateTime(timestampNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
     XmlNode passwordDataNode = resultNode.FirstChild("passwordData");
     if(!passwordDataNode.IsNull())
     {
-      m_passwordData = StringUtils::Trim(passwordDataNode.GetText().c_str());
+      m_passwordData = passwordDataNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -51,13 +51,13 @@ GroupIdentifier& GroupIdentifier::operator =(const XmlNode& xmlNode)
     XmlNode groupNameNode = resultNode.FirstChild("groupName");
     if(!groupNameNode.IsNull())
     {
-      m_groupName = StringUtils::Trim(groupNameNode.GetText().c_str());
+      m_groupName = groupNameNode.GetTextView().Trim().ToString();
       m_groupNameHasBeenSet = true;
     }
     XmlNode groupIdNode = resultNode.FirstChild("groupId");
     if(!groupIdNode.IsNull())
     {
-      m_groupId = StringUtils::Trim(groupIdNode.GetText().c_str());
+      m_groupId = groupIdNode.GetTextView().Trim().ToString();
       m_groupIdHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void GroupIdentifier::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   if(m_groupIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".GroupId=" << StringUtils::URLEncode(m_groupId.c_str()) << "&";
+      oStream << location << index << locationValue << ".GroupId=" << StringUtils::URLEncoded(m_groupId) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void GroupIdentifier::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
   if(m_groupIdHasBeenSet)
   {
-      oStream << location << ".GroupId=" << StringUtils::URLEncode(m_groupId.c_str()) << "&";
+      oStream << location << ".GroupId=" << StringUtils::URLEncoded(m_groupId) << "&";
   }
 }
 
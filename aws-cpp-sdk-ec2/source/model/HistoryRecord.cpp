@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,13 +54,13 @@ HistoryRecord& HistoryRecord::operator =(const XmlNode& xmlNode)
     XmlNode timestampNode = resultNode.FirstChild("timestamp");
     if(!timestampNode.IsNull())
     {
-      m_timestamp = DateTime(StringUtils::Trim(timestampNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_timestamp = DateTime(timestampNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_timestampHasBeenSet = true;
     }
     XmlNode eventTypeNode = resultNode.FirstChild("eventType");
     if(!eventTypeNode.IsNull())
     {
-      m_eventType = EventTypeMapper::GetEventTypeForName(StringUtils::Trim(eventTypeNode.GetText().c_str()).c_str());
+      m_eventType = EventTypeMapper::GetEventTypeForName(eventTypeNode.GetTextView().Trim().ToString().c_str());
       m_eventTypeHasBeenSet = true;
     }
     XmlNode eventInformationNode = resultNode.FirstChild("eventInformation");
@@ -77,7 +78,7 @@ void HistoryRecord::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_timestampHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Timestamp=" << StringUtils::URLEncode(m_timestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".Timestamp=" << StringUtils::URLEncoded(m_timestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_eventTypeHasBeenSet)
@@ -87,9 +88,9 @@ void HistoryRecord::OutputToStream(Aws::OStream& oStream, const char* location,
 
   if(m_eventInformationHasBeenSet)
   {
-      Aws::StringStream eventInformationLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream eventInformationLocationAndMemberSs;
       eventInformationLocationAndMemberSs << location << index << locationValue << ".EventInformation";
-      m_eventInformation.OutputToStream(oStream, eventInformationLocationAndMemberSs.str().c_str());
+      m_eventInformation.OutputToStream(oStream, eventInformationLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -98,7 +99,7 @@ void HistoryRecord::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_timestampHasBeenSet)
   {
-      oStream << location << ".Timestamp=" << StringUtils::URLEncode(m_timestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".Timestamp=" << StringUtils::URLEncoded(m_timestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_eventTypeHasBeenSet)
   {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -65,25 +66,25 @@ Host& Host::operator =(const XmlNode& xmlNode)
     XmlNode hostIdNode = resultNode.FirstChild("hostId");
     if(!hostIdNode.IsNull())
     {
-      m_hostId = StringUtils::Trim(hostIdNode.GetText().c_str());
+      m_hostId = hostIdNode.GetTextView().Trim().ToString();
       m_hostIdHasBeenSet = true;
     }
     XmlNode autoPlacementNode = resultNode.FirstChild("autoPlacement");
     if(!autoPlacementNode.IsNull())
     {
-      m_autoPlacement = AutoPlacementMapper::GetAutoPlacementForName(StringUtils::Trim(autoPlacementNode.GetText().c_str()).c_str());
+      m_autoPlacement = AutoPlacementMapper::GetAutoPlacementForName(autoPlacementNode.GetTextView().Trim().ToString().c_str());
       m_autoPlacementHasBeenSet = true;
     }
     XmlNode hostReservationIdNode = resultNode.FirstChild("hostReservationId");
     if(!hostReservationIdNode.IsNull())
     {
-      m_hostReservationId = StringUtils::Trim(hostReservationIdNode.GetText().c_str());
+      m_hostReservationId = hostReservationIdNode.GetTextView().Trim().ToString();
       m_hostReservationIdHasBeenSet = true;
     }
     XmlNode clientTokenNode = resultNode.FirstChild("clientToken");
     if(!clientTokenNode.IsNull())
     {
-      m_clientToken = StringUtils::Trim(clientTokenNode.GetText().c_str());
+      m_clientToken = clientTokenNode.GetTextView().Trim().ToString();
       m_clientTokenHasBeenSet = true;
     }
     XmlNode hostPropertiesNode = resultNode.FirstChild("hostProperties");
@@ -95,13 +96,13 @@ Host& Host::operator =(const XmlNode& xmlNode)
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = AllocationStateMapper::GetAllocationStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = AllocationStateMapper::GetAllocationStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode availabilityZoneNode = resultNode.FirstChild("availabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode instancesNode = resultNode.FirstChild("instances");
@@ -131,7 +132,7 @@ void Host::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 {
   if(m_hostIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HostId=" << StringUtils::URLEncode(m_hostId.c_str()) << "&";
+      oStream << location << index << locationValue << ".HostId=" << StringUtils::URLEncoded(m_hostId) << "&";
   }
 
   if(m_autoPlacementHasBeenSet)
@@ -141,19 +142,19 @@ void Host::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 
   if(m_hostReservationIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HostReservationId=" << StringUtils::URLEncode(m_hostReservationId.c_str()) << "&";
+      oStream << location << index << locationValue << ".HostReservationId=" << StringUtils::URLEncoded(m_hostReservationId) << "&";
   }
 
   if(m_clientTokenHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   if(m_hostPropertiesHasBeenSet)
   {
-      Aws::StringStream hostPropertiesLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream hostPropertiesLocationAndMemberSs;
       hostPropertiesLocationAndMemberSs << location << index << locationValue << ".HostProperties";
-      m_hostProperties.OutputToStream(oStream, hostPropertiesLocationAndMemberSs.str().c_str());
+      m_hostProperties.OutputToStream(oStream, hostPropertiesLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_stateHasBeenSet)
@@ -163,7 +164,7 @@ void Host::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_instancesHasBeenSet)
@@ -171,17 +172,17 @@ void Host::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
       unsigned instancesIdx = 1;
       for(auto& item : m_instances)
       {
-        Aws::StringStream instancesSs;
+        Aws::Utils::Stream::StringOutputStream instancesSs;
         instancesSs << location << index << locationValue << ".Instances." << instancesIdx++;
-        item.OutputToStream(oStream, instancesSs.str().c_str());
+        item.OutputToStream(oStream, instancesSs.GetString().c_str());
       }
   }
 
   if(m_availableCapacityHasBeenSet)
   {
-      Aws::StringStream availableCapacityLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream availableCapacityLocationAndMemberSs;
       availableCapacityLocationAndMemberSs << location << index << locationValue << ".AvailableCapacity";
-      m_availableCapacity.OutputToStream(oStream, availableCapacityLocationAndMemberSs.str().c_str());
+      m_availableCapacity.OutputToStream(oStream, availableCapacityLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -190,7 +191,7 @@ void Host::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_hostIdHasBeenSet)
   {
-      oStream << location << ".HostId=" << StringUtils::URLEncode(m_hostId.c_str()) << "&";
+      oStream << location << ".HostId=" << StringUtils::URLEncoded(m_hostId) << "&";
   }
   if(m_autoPlacementHasBeenSet)
   {
@@ -198,11 +199,11 @@ void Host::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_hostReservationIdHasBeenSet)
   {
-      oStream << location << ".HostReservationId=" << StringUtils::URLEncode(m_hostReservationId.c_str()) << "&";
+      oStream << location << ".HostReservationId=" << StringUtils::URLEncoded(m_hostReservationId) << "&";
   }
   if(m_clientTokenHasBeenSet)
   {
-      oStream << location << ".ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+      oStream << location << ".ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
   if(m_hostPropertiesHasBeenSet)
   {
@@ -216,16 +217,16 @@ void Host::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_instancesHasBeenSet)
   {
       unsigned instancesIdx = 1;
       for(auto& item : m_instances)
       {
-        Aws::StringStream instancesSs;
+        Aws::Utils::Stream::StringOutputStream instancesSs;
         instancesSs << location <<  ".item." << instancesIdx++;
-        item.OutputToStream(oStream, instancesSs.str().c_str());
+        item.OutputToStream(oStream, instancesSs.GetString().c_str());
       }
   }
   if(m_availableCapacityHasBeenSet)
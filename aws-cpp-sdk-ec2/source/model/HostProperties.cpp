@@ -61,25 +61,25 @@ HostProperties& HostProperties::operator =(const XmlNode& xmlNode)
     XmlNode socketsNode = resultNode.FirstChild("sockets");
     if(!socketsNode.IsNull())
     {
-      m_sockets = StringUtils::ConvertToInt32(StringUtils::Trim(socketsNode.GetText().c_str()).c_str());
+      m_sockets = StringUtils::ConvertToInt32(socketsNode.GetTextView().Trim().ToString().c_str());
       m_socketsHasBeenSet = true;
     }
     XmlNode coresNode = resultNode.FirstChild("cores");
     if(!coresNode.IsNull())
     {
-      m_cores = StringUtils::ConvertToInt32(StringUtils::Trim(coresNode.GetText().c_str()).c_str());
+      m_cores = StringUtils::ConvertToInt32(coresNode.GetTextView().Trim().ToString().c_str());
       m_coresHasBeenSet = true;
     }
     XmlNode totalVCpusNode = resultNode.FirstChild("totalVCpus");
     if(!totalVCpusNode.IsNull())
     {
-      m_totalVCpus = StringUtils::ConvertToInt32(StringUtils::Trim(totalVCpusNode.GetText().c_str()).c_str());
+      m_totalVCpus = StringUtils::ConvertToInt32(totalVCpusNode.GetTextView().Trim().ToString().c_str());
       m_totalVCpusHasBeenSet = true;
     }
     XmlNode instanceTypeNode = resultNode.FirstChild("instanceType");
     if(!instanceTypeNode.IsNull())
     {
-      m_instanceType = StringUtils::Trim(instanceTypeNode.GetText().c_str());
+      m_instanceType = instanceTypeNode.GetTextView().Trim().ToString();
       m_instanceTypeHasBeenSet = true;
     }
   }
@@ -106,7 +106,7 @@ void HostProperties::OutputToStream(Aws::OStream& oStream, const char* location,
 
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
 
 }
@@ -127,7 +127,7 @@ void HostProperties::OutputToStream(Aws::OStream& oStream, const char* location)
   }
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
 }
 
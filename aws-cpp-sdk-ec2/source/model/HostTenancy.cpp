@@ -29,21 +29,29 @@ namespace Aws
       namespace HostTenancyMapper
       {
 
-        static const int dedicated_HASH = HashingUtils::HashString("dedicated");
-        static const int host_HASH = HashingUtils::HashString("host");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int dedicated_HASH = 1229913583;
+        static const int host_HASH = 3208616;
 
 
         HostTenancy GetHostTenancyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == dedicated_HASH)
+          switch (hashCode)
           {
+          case dedicated_HASH:
             return HostTenancy::dedicated;
-          }
-          else if (hashCode == host_HASH)
-          {
+          case host_HASH:
             return HostTenancy::host;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace HypervisorTypeMapper
       {
 
-        static const int ovm_HASH = HashingUtils::HashString("ovm");
-        static const int xen_HASH = HashingUtils::HashString("xen");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ovm_HASH = 110438;
+        static const int xen_HASH = 118561;
 
 
         HypervisorType GetHypervisorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ovm_HASH)
+          switch (hashCode)
           {
+          case ovm_HASH:
             return HypervisorType::ovm;
-          }
-          else if (hashCode == xen_HASH)
-          {
+          case xen_HASH:
             return HypervisorType::xen;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
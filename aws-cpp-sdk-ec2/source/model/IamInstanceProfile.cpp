@@ -51,13 +51,13 @@ IamInstanceProfile& IamInstanceProfile::operator =(const XmlNode& xmlNode)
     XmlNode arnNode = resultNode.FirstChild("arn");
     if(!arnNode.IsNull())
     {
-      m_arn = StringUtils::Trim(arnNode.GetText().c_str());
+      m_arn = arnNode.GetTextView().Trim().ToString();
       m_arnHasBeenSet = true;
     }
     XmlNode idNode = resultNode.FirstChild("id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void IamInstanceProfile::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_arnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
 
   if(m_idHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void IamInstanceProfile::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_arnHasBeenSet)
   {
-      oStream << location << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
   if(m_idHasBeenSet)
   {
-      oStream << location << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
 }
 
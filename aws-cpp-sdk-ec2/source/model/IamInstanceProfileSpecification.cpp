@@ -51,13 +51,13 @@ IamInstanceProfileSpecification& IamInstanceProfileSpecification::operator =(con
     XmlNode arnNode = resultNode.FirstChild("arn");
     if(!arnNode.IsNull())
     {
-      m_arn = StringUtils::Trim(arnNode.GetText().c_str());
+      m_arn = arnNode.GetTextView().Trim().ToString();
       m_arnHasBeenSet = true;
     }
     XmlNode nameNode = resultNode.FirstChild("name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void IamInstanceProfileSpecification::OutputToStream(Aws::OStream& oStream, cons
 {
   if(m_arnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
 
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void IamInstanceProfileSpecification::OutputToStream(Aws::OStream& oStream, cons
 {
   if(m_arnHasBeenSet)
   {
-      oStream << location << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 }
 
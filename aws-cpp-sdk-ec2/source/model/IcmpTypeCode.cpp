@@ -55,13 +55,13 @@ IcmpTypeCode& IcmpTypeCode::operator =(const XmlNode& xmlNode)
     XmlNode typeNode = resultNode.FirstChild("type");
     if(!typeNode.IsNull())
     {
-      m_type = StringUtils::ConvertToInt32(StringUtils::Trim(typeNode.GetText().c_str()).c_str());
+      m_type = StringUtils::ConvertToInt32(typeNode.GetTextView().Trim().ToString().c_str());
       m_typeHasBeenSet = true;
     }
     XmlNode codeNode = resultNode.FirstChild("code");
     if(!codeNode.IsNull())
     {
-      m_code = StringUtils::ConvertToInt32(StringUtils::Trim(codeNode.GetText().c_str()).c_str());
+      m_code = StringUtils::ConvertToInt32(codeNode.GetTextView().Trim().ToString().c_str());
       m_codeHasBeenSet = true;
     }
   }
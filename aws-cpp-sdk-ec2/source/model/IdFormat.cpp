@@ -55,19 +55,19 @@ IdFormat& IdFormat::operator =(const XmlNode& xmlNode)
     XmlNode resourceNode = resultNode.FirstChild("resource");
     if(!resourceNode.IsNull())
     {
-      m_resource = StringUtils::Trim(resourceNode.GetText().c_str());
+      m_resource = resourceNode.GetTextView().Trim().ToString();
       m_resourceHasBeenSet = true;
     }
     XmlNode useLongIdsNode = resultNode.FirstChild("useLongIds");
     if(!useLongIdsNode.IsNull())
     {
-      m_useLongIds = StringUtils::ConvertToBool(StringUtils::Trim(useLongIdsNode.GetText().c_str()).c_str());
+      m_useLongIds = StringUtils::ConvertToBool(useLongIdsNode.GetTextView().Trim().ToString().c_str());
       m_useLongIdsHasBeenSet = true;
     }
     XmlNode deadlineNode = resultNode.FirstChild("deadline");
     if(!deadlineNode.IsNull())
     {
-      m_deadline = DateTime(StringUtils::Trim(deadlineNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_deadline = DateTime(deadlineNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_deadlineHasBeenSet = true;
     }
   }
@@ -79,7 +79,7 @@ void IdFormat::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 {
   if(m_resourceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Resource=" << StringUtils::URLEncode(m_resource.c_str()) << "&";
+      oStream << location << index << locationValue << ".Resource=" << StringUtils::URLEncoded(m_resource) << "&";
   }
 
   if(m_useLongIdsHasBeenSet)
@@ -89,7 +89,7 @@ void IdFormat::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_deadlineHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Deadline=" << StringUtils::URLEncode(m_deadline.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".Deadline=" << StringUtils::URLEncoded(m_deadline.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -98,7 +98,7 @@ void IdFormat::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_resourceHasBeenSet)
   {
-      oStream << location << ".Resource=" << StringUtils::URLEncode(m_resource.c_str()) << "&";
+      oStream << location << ".Resource=" << StringUtils::URLEncoded(m_resource) << "&";
   }
   if(m_useLongIdsHasBeenSet)
   {
@@ -106,7 +106,7 @@ void IdFormat::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_deadlineHasBeenSet)
   {
-      oStream << location << ".Deadline=" << StringUtils::URLEncode(m_deadline.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".Deadline=" << StringUtils::URLEncoded(m_deadline.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
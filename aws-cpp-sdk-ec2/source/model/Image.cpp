@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -95,37 +96,37 @@ Image& Image::operator =(const XmlNode& xmlNode)
     XmlNode imageIdNode = resultNode.FirstChild("imageId");
     if(!imageIdNode.IsNull())
     {
-      m_imageId = StringUtils::Trim(imageIdNode.GetText().c_str());
+      m_imageId = imageIdNode.GetTextView().Trim().ToString();
       m_imageIdHasBeenSet = true;
     }
     XmlNode imageLocationNode = resultNode.FirstChild("imageLocation");
     if(!imageLocationNode.IsNull())
     {
-      m_imageLocation = StringUtils::Trim(imageLocationNode.GetText().c_str());
+      m_imageLocation = imageLocationNode.GetTextView().Trim().ToString();
       m_imageLocationHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("imageState");
     if(!stateNode.IsNull())
     {
-      m_state = ImageStateMapper::GetImageStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = ImageStateMapper::GetImageStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode ownerIdNode = resultNode.FirstChild("imageOwnerId");
     if(!ownerIdNode.IsNull())
     {
-      m_ownerId = StringUtils::Trim(ownerIdNode.GetText().c_str());
+      m_ownerId = ownerIdNode.GetTextView().Trim().ToString();
       m_ownerIdHasBeenSet = true;
     }
     XmlNode creationDateNode = resultNode.FirstChild("creationDate");
     if(!creationDateNode.IsNull())
     {
-      m_creationDate = StringUtils::Trim(creationDateNode.GetText().c_str());
+      m_creationDate = creationDateNode.GetTextView().Trim().ToString();
       m_creationDateHasBeenSet = true;
     }
     XmlNode publicNode = resultNode.FirstChild("isPublic");
     if(!publicNode.IsNull())
     {
-      m_public = StringUtils::ConvertToBool(StringUtils::Trim(publicNode.GetText().c_str()).c_str());
+      m_public = StringUtils::ConvertToBool(publicNode.GetTextView().Trim().ToString().c_str());
       m_publicHasBeenSet = true;
     }
     XmlNode productCodesNode = resultNode.FirstChild("productCodes");
@@ -143,37 +144,37 @@ Image& Image::operator =(const XmlNode& xmlNode)
     XmlNode architectureNode = resultNode.FirstChild("architecture");
     if(!architectureNode.IsNull())
     {
-      m_architecture = ArchitectureValuesMapper::GetArchitectureValuesForName(StringUtils::Trim(architectureNode.GetText().c_str()).c_str());
+      m_architecture = ArchitectureValuesMapper::GetArchitectureValuesForName(architectureNode.GetTextView().Trim().ToString().c_str());
       m_architectureHasBeenSet = true;
     }
     XmlNode imageTypeNode = resultNode.FirstChild("imageType");
     if(!imageTypeNode.IsNull())
     {
-      m_imageType = ImageTypeValuesMapper::GetImageTypeValuesForName(StringUtils::Trim(imageTypeNode.GetText().c_str()).c_str());
+      m_imageType = ImageTypeValuesMapper::GetImageTypeValuesForName(imageTypeNode.GetTextView().Trim().ToString().c_str());
       m_imageTypeHasBeenSet = true;
     }
     XmlNode kernelIdNode = resultNode.FirstChild("kernelId");
     if(!kernelIdNode.IsNull())
     {
-      m_kernelId = StringUtils::Trim(kernelIdNode.GetText().c_str());
+      m_kernelId = kernelIdNode.GetTextView().Trim().ToString();
       m_kernelIdHasBeenSet = true;
     }
     XmlNode ramdiskIdNode = resultNode.FirstChild("ramdiskId");
     if(!ramdiskIdNode.IsNull())
     {
-      m_ramdiskId = StringUtils::Trim(ramdiskIdNode.GetText().c_str());
+      m_ramdiskId = ramdiskIdNode.GetTextView().Trim().ToString();
       m_ramdiskIdHasBeenSet = true;
     }
     XmlNode platformNode = resultNode.FirstChild("platform");
     if(!platformNode.IsNull())
     {
-      m_platform = PlatformValuesMapper::GetPlatformValuesForName(StringUtils::Trim(platformNode.GetText().c_str()).c_str());
+      m_platform = PlatformValuesMapper::GetPlatformValuesForName(platformNode.GetTextView().Trim().ToString().c_str());
       m_platformHasBeenSet = true;
     }
     XmlNode sriovNetSupportNode = resultNode.FirstChild("sriovNetSupport");
     if(!sriovNetSupportNode.IsNull())
     {
-      m_sriovNetSupport = StringUtils::Trim(sriovNetSupportNode.GetText().c_str());
+      m_sriovNetSupport = sriovNetSupportNode.GetTextView().Trim().ToString();
       m_sriovNetSupportHasBeenSet = true;
     }
     XmlNode stateReasonNode = resultNode.FirstChild("stateReason");
@@ -185,31 +186,31 @@ Image& Image::operator =(const XmlNode& xmlNode)
     XmlNode imageOwnerAliasNode = resultNode.FirstChild("imageOwnerAlias");
     if(!imageOwnerAliasNode.IsNull())
     {
-      m_imageOwnerAlias = StringUtils::Trim(imageOwnerAliasNode.GetText().c_str());
+      m_imageOwnerAlias = imageOwnerAliasNode.GetTextView().Trim().ToString();
       m_imageOwnerAliasHasBeenSet = true;
     }
     XmlNode nameNode = resultNode.FirstChild("name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode rootDeviceTypeNode = resultNode.FirstChild("rootDeviceType");
     if(!rootDeviceTypeNode.IsNull())
     {
-      m_rootDeviceType = DeviceTypeMapper::GetDeviceTypeForName(StringUtils::Trim(rootDeviceTypeNode.GetText().c_str()).c_str());
+      m_rootDeviceType = DeviceTypeMapper::GetDeviceTypeForName(rootDeviceTypeNode.GetTextView().Trim().ToString().c_str());
       m_rootDeviceTypeHasBeenSet = true;
     }
     XmlNode rootDeviceNameNode = resultNode.FirstChild("rootDeviceName");
     if(!rootDeviceNameNode.IsNull())
     {
-      m_rootDeviceName = StringUtils::Trim(rootDeviceNameNode.GetText().c_str());
+      m_rootDeviceName = rootDeviceNameNode.GetTextView().Trim().ToString();
       m_rootDeviceNameHasBeenSet = true;
     }
     XmlNode blockDeviceMappingsNode = resultNode.FirstChild("blockDeviceMapping");
@@ -227,7 +228,7 @@ Image& Image::operator =(const XmlNode& xmlNode)
     XmlNode virtualizationTypeNode = resultNode.FirstChild("virtualizationType");
     if(!virtualizationTypeNode.IsNull())
     {
-      m_virtualizationType = VirtualizationTypeMapper::GetVirtualizationTypeForName(StringUtils::Trim(virtualizationTypeNode.GetText().c_str()).c_str());
+      m_virtualizationType = VirtualizationTypeMapper::GetVirtualizationTypeForName(virtualizationTypeNode.GetTextView().Trim().ToString().c_str());
       m_virtualizationTypeHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("tagSet");
@@ -245,7 +246,7 @@ Image& Image::operator =(const XmlNode& xmlNode)
     XmlNode hypervisorNode = resultNode.FirstChild("hypervisor");
     if(!hypervisorNode.IsNull())
     {
-      m_hypervisor = HypervisorTypeMapper::GetHypervisorTypeForName(StringUtils::Trim(hypervisorNode.GetText().c_str()).c_str());
+      m_hypervisor = HypervisorTypeMapper::GetHypervisorTypeForName(hypervisorNode.GetTextView().Trim().ToString().c_str());
       m_hypervisorHasBeenSet = true;
     }
   }
@@ -257,12 +258,12 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 {
   if(m_imageIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
 
   if(m_imageLocationHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ImageLocation=" << StringUtils::URLEncode(m_imageLocation.c_str()) << "&";
+      oStream << location << index << locationValue << ".ImageLocation=" << StringUtils::URLEncoded(m_imageLocation) << "&";
   }
 
   if(m_stateHasBeenSet)
@@ -272,12 +273,12 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 
   if(m_ownerIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OwnerId=" << StringUtils::URLEncode(m_ownerId.c_str()) << "&";
+      oStream << location << index << locationValue << ".OwnerId=" << StringUtils::URLEncoded(m_ownerId) << "&";
   }
 
   if(m_creationDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreationDate=" << StringUtils::URLEncode(m_creationDate.c_str()) << "&";
+      oStream << location << index << locationValue << ".CreationDate=" << StringUtils::URLEncoded(m_creationDate) << "&";
   }
 
   if(m_publicHasBeenSet)
@@ -290,9 +291,9 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
       unsigned productCodesIdx = 1;
       for(auto& item : m_productCodes)
       {
-        Aws::StringStream productCodesSs;
+        Aws::Utils::Stream::StringOutputStream productCodesSs;
         productCodesSs << location << index << locationValue << ".ProductCodes." << productCodesIdx++;
-        item.OutputToStream(oStream, productCodesSs.str().c_str());
+        item.OutputToStream(oStream, productCodesSs.GetString().c_str());
       }
   }
 
@@ -308,12 +309,12 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 
   if(m_kernelIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KernelId=" << StringUtils::URLEncode(m_kernelId.c_str()) << "&";
+      oStream << location << index << locationValue << ".KernelId=" << StringUtils::URLEncoded(m_kernelId) << "&";
   }
 
   if(m_ramdiskIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RamdiskId=" << StringUtils::URLEncode(m_ramdiskId.c_str()) << "&";
+      oStream << location << index << locationValue << ".RamdiskId=" << StringUtils::URLEncoded(m_ramdiskId) << "&";
   }
 
   if(m_platformHasBeenSet)
@@ -323,29 +324,29 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 
   if(m_sriovNetSupportHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SriovNetSupport=" << StringUtils::URLEncode(m_sriovNetSupport.c_str()) << "&";
+      oStream << location << index << locationValue << ".SriovNetSupport=" << StringUtils::URLEncoded(m_sriovNetSupport) << "&";
   }
 
   if(m_stateReasonHasBeenSet)
   {
-      Aws::StringStream stateReasonLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream stateReasonLocationAndMemberSs;
       stateReasonLocationAndMemberSs << location << index << locationValue << ".StateReason";
-      m_stateReason.OutputToStream(oStream, stateReasonLocationAndMemberSs.str().c_str());
+      m_stateReason.OutputToStream(oStream, stateReasonLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_imageOwnerAliasHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ImageOwnerAlias=" << StringUtils::URLEncode(m_imageOwnerAlias.c_str()) << "&";
+      oStream << location << index << locationValue << ".ImageOwnerAlias=" << StringUtils::URLEncoded(m_imageOwnerAlias) << "&";
   }
 
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_rootDeviceTypeHasBeenSet)
@@ -355,7 +356,7 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 
   if(m_rootDeviceNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RootDeviceName=" << StringUtils::URLEncode(m_rootDeviceName.c_str()) << "&";
+      oStream << location << index << locationValue << ".RootDeviceName=" << StringUtils::URLEncoded(m_rootDeviceName) << "&";
   }
 
   if(m_blockDeviceMappingsHasBeenSet)
@@ -363,9 +364,9 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
       unsigned blockDeviceMappingsIdx = 1;
       for(auto& item : m_blockDeviceMappings)
       {
-        Aws::StringStream blockDeviceMappingsSs;
+        Aws::Utils::Stream::StringOutputStream blockDeviceMappingsSs;
         blockDeviceMappingsSs << location << index << locationValue << ".BlockDeviceMapping." << blockDeviceMappingsIdx++;
-        item.OutputToStream(oStream, blockDeviceMappingsSs.str().c_str());
+        item.OutputToStream(oStream, blockDeviceMappingsSs.GetString().c_str());
       }
   }
 
@@ -379,9 +380,9 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -396,11 +397,11 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_imageIdHasBeenSet)
   {
-      oStream << location << ".ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+      oStream << location << ".ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
   if(m_imageLocationHasBeenSet)
   {
-      oStream << location << ".ImageLocation=" << StringUtils::URLEncode(m_imageLocation.c_str()) << "&";
+      oStream << location << ".ImageLocation=" << StringUtils::URLEncoded(m_imageLocation) << "&";
   }
   if(m_stateHasBeenSet)
   {
@@ -408,11 +409,11 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_ownerIdHasBeenSet)
   {
-      oStream << location << ".OwnerId=" << StringUtils::URLEncode(m_ownerId.c_str()) << "&";
+      oStream << location << ".OwnerId=" << StringUtils::URLEncoded(m_ownerId) << "&";
   }
   if(m_creationDateHasBeenSet)
   {
-      oStream << location << ".CreationDate=" << StringUtils::URLEncode(m_creationDate.c_str()) << "&";
+      oStream << location << ".CreationDate=" << StringUtils::URLEncoded(m_creationDate) << "&";
   }
   if(m_publicHasBeenSet)
   {
@@ -423,9 +424,9 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned productCodesIdx = 1;
       for(auto& item : m_productCodes)
       {
-        Aws::StringStream productCodesSs;
+        Aws::Utils::Stream::StringOutputStream productCodesSs;
         productCodesSs << location <<  ".item." << productCodesIdx++;
-        item.OutputToStream(oStream, productCodesSs.str().c_str());
+        item.OutputToStream(oStream, productCodesSs.GetString().c_str());
       }
   }
   if(m_architectureHasBeenSet)
@@ -438,11 +439,11 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_kernelIdHasBeenSet)
   {
-      oStream << location << ".KernelId=" << StringUtils::URLEncode(m_kernelId.c_str()) << "&";
+      oStream << location << ".KernelId=" << StringUtils::URLEncoded(m_kernelId) << "&";
   }
   if(m_ramdiskIdHasBeenSet)
   {
-      oStream << location << ".RamdiskId=" << StringUtils::URLEncode(m_ramdiskId.c_str()) << "&";
+      oStream << location << ".RamdiskId=" << StringUtils::URLEncoded(m_ramdiskId) << "&";
   }
   if(m_platformHasBeenSet)
   {
@@ -450,7 +451,7 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_sriovNetSupportHasBeenSet)
   {
-      oStream << location << ".SriovNetSupport=" << StringUtils::URLEncode(m_sriovNetSupport.c_str()) << "&";
+      oStream << location << ".SriovNetSupport=" << StringUtils::URLEncoded(m_sriovNetSupport) << "&";
   }
   if(m_stateReasonHasBeenSet)
   {
@@ -460,15 +461,15 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_imageOwnerAliasHasBeenSet)
   {
-      oStream << location << ".ImageOwnerAlias=" << StringUtils::URLEncode(m_imageOwnerAlias.c_str()) << "&";
+      oStream << location << ".ImageOwnerAlias=" << StringUtils::URLEncoded(m_imageOwnerAlias) << "&";
   }
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_rootDeviceTypeHasBeenSet)
   {
@@ -476,16 +477,16 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_rootDeviceNameHasBeenSet)
   {
-      oStream << location << ".RootDeviceName=" << StringUtils::URLEncode(m_rootDeviceName.c_str()) << "&";
+      oStream << location << ".RootDeviceName=" << StringUtils::URLEncoded(m_rootDeviceName) << "&";
   }
   if(m_blockDeviceMappingsHasBeenSet)
   {
       unsigned blockDeviceMappingsIdx = 1;
       for(auto& item : m_blockDeviceMappings)
       {
-        Aws::StringStream blockDeviceMappingsSs;
+        Aws::Utils::Stream::StringOutputStream blockDeviceMappingsSs;
         blockDeviceMappingsSs << location <<  ".item." << blockDeviceMappingsIdx++;
-        item.OutputToStream(oStream, blockDeviceMappingsSs.str().c_str());
+        item.OutputToStream(oStream, blockDeviceMappingsSs.GetString().c_str());
       }
   }
   if(m_virtualizationTypeHasBeenSet)
@@ -497,9 +498,9 @@ void Image::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
   if(m_hypervisorHasBeenSet)
@@ -29,46 +29,44 @@ namespace Aws
       namespace ImageAttributeNameMapper
       {
 
-        static const int description_HASH = HashingUtils::HashString("description");
-        static const int kernel_HASH = HashingUtils::HashString("kernel");
-        static const int ramdisk_HASH = HashingUtils::HashString("ramdisk");
-        static const int launchPermission_HASH = HashingUtils::HashString("launchPermission");
-        static const int productCodes_HASH = HashingUtils::HashString("productCodes");
-        static const int blockDeviceMapping_HASH = HashingUtils::HashString("blockDeviceMapping");
-        static const int sriovNetSupport_HASH = HashingUtils::HashString("sriovNetSupport");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int description_HASH = -1724546052;
+        static const int kernel_HASH = -1134867395;
+        static const int ramdisk_HASH = 976979643;
+        static const int launchPermission_HASH = -1159069214;
+        static const int productCodes_HASH = 988549239;
+        static const int blockDeviceMapping_HASH = 1546575371;
+        static const int sriovNetSupport_HASH = -1315506269;
 
 
         ImageAttributeName GetImageAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == description_HASH)
+          switch (hashCode)
           {
+          case description_HASH:
             return ImageAttributeName::description;
-          }
-          else if (hashCode == kernel_HASH)
-          {
+          case kernel_HASH:
             return ImageAttributeName::kernel;
-          }
-          else if (hashCode == ramdisk_HASH)
-          {
+          case ramdisk_HASH:
             return ImageAttributeName::ramdisk;
-          }
-          else if (hashCode == launchPermission_HASH)
-          {
+          case launchPermission_HASH:
             return ImageAttributeName::launchPermission;
-          }
-          else if (hashCode == productCodes_HASH)
-          {
+          case productCodes_HASH:
             return ImageAttributeName::productCodes;
-          }
-          else if (hashCode == blockDeviceMapping_HASH)
-          {
+          case blockDeviceMapping_HASH:
             return ImageAttributeName::blockDeviceMapping;
-          }
-          else if (hashCode == sriovNetSupport_HASH)
-          {
+          case sriovNetSupport_HASH:
             return ImageAttributeName::sriovNetSupport;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,19 +60,19 @@ ImageDiskContainer& ImageDiskContainer::operator =(const XmlNode& xmlNode)
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode formatNode = resultNode.FirstChild("Format");
     if(!formatNode.IsNull())
     {
-      m_format = StringUtils::Trim(formatNode.GetText().c_str());
+      m_format = formatNode.GetTextView().Trim().ToString();
       m_formatHasBeenSet = true;
     }
     XmlNode urlNode = resultNode.FirstChild("Url");
     if(!urlNode.IsNull())
     {
-      m_url = StringUtils::Trim(urlNode.GetText().c_str());
+      m_url = urlNode.GetTextView().Trim().ToString();
       m_urlHasBeenSet = true;
     }
     XmlNode userBucketNode = resultNode.FirstChild("UserBucket");
@@ -83,13 +84,13 @@ ImageDiskContainer& ImageDiskContainer::operator =(const XmlNode& xmlNode)
     XmlNode deviceNameNode = resultNode.FirstChild("DeviceName");
     if(!deviceNameNode.IsNull())
     {
-      m_deviceName = StringUtils::Trim(deviceNameNode.GetText().c_str());
+      m_deviceName = deviceNameNode.GetTextView().Trim().ToString();
       m_deviceNameHasBeenSet = true;
     }
     XmlNode snapshotIdNode = resultNode.FirstChild("SnapshotId");
     if(!snapshotIdNode.IsNull())
     {
-      m_snapshotId = StringUtils::Trim(snapshotIdNode.GetText().c_str());
+      m_snapshotId = snapshotIdNode.GetTextView().Trim().ToString();
       m_snapshotIdHasBeenSet = true;
     }
   }
@@ -101,34 +102,34 @@ void ImageDiskContainer::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_formatHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Format=" << StringUtils::URLEncode(m_format.c_str()) << "&";
+      oStream << location << index << locationValue << ".Format=" << StringUtils::URLEncoded(m_format) << "&";
   }
 
   if(m_urlHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Url=" << StringUtils::URLEncode(m_url.c_str()) << "&";
+      oStream << location << index << locationValue << ".Url=" << StringUtils::URLEncoded(m_url) << "&";
   }
 
   if(m_userBucketHasBeenSet)
   {
-      Aws::StringStream userBucketLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream userBucketLocationAndMemberSs;
       userBucketLocationAndMemberSs << location << index << locationValue << ".UserBucket";
-      m_userBucket.OutputToStream(oStream, userBucketLocationAndMemberSs.str().c_str());
+      m_userBucket.OutputToStream(oStream, userBucketLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_deviceNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DeviceName=" << StringUtils::URLEncode(m_deviceName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DeviceName=" << StringUtils::URLEncoded(m_deviceName) << "&";
   }
 
   if(m_snapshotIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotId=" << StringUtils::URLEncode(m_snapshotId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotId=" << StringUtils::URLEncoded(m_snapshotId) << "&";
   }
 
 }
@@ -137,15 +138,15 @@ void ImageDiskContainer::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_formatHasBeenSet)
   {
-      oStream << location << ".Format=" << StringUtils::URLEncode(m_format.c_str()) << "&";
+      oStream << location << ".Format=" << StringUtils::URLEncoded(m_format) << "&";
   }
   if(m_urlHasBeenSet)
   {
-      oStream << location << ".Url=" << StringUtils::URLEncode(m_url.c_str()) << "&";
+      oStream << location << ".Url=" << StringUtils::URLEncoded(m_url) << "&";
   }
   if(m_userBucketHasBeenSet)
   {
@@ -155,11 +156,11 @@ void ImageDiskContainer::OutputToStream(Aws::OStream& oStream, const char* locat
   }
   if(m_deviceNameHasBeenSet)
   {
-      oStream << location << ".DeviceName=" << StringUtils::URLEncode(m_deviceName.c_str()) << "&";
+      oStream << location << ".DeviceName=" << StringUtils::URLEncoded(m_deviceName) << "&";
   }
   if(m_snapshotIdHasBeenSet)
   {
-      oStream << location << ".SnapshotId=" << StringUtils::URLEncode(m_snapshotId.c_str()) << "&";
+      oStream << location << ".SnapshotId=" << StringUtils::URLEncoded(m_snapshotId) << "&";
   }
 }
 
@@ -29,46 +29,44 @@ namespace Aws
       namespace ImageStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int invalid_HASH = HashingUtils::HashString("invalid");
-        static const int deregistered_HASH = HashingUtils::HashString("deregistered");
-        static const int transient_HASH = HashingUtils::HashString("transient");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int error_HASH = HashingUtils::HashString("error");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int pending_HASH = -682587753;
+        static const int available_HASH = -733902135;
+        static const int invalid_HASH = 1959784951;
+        static const int deregistered_HASH = 1344945603;
+        static const int transient_HASH = 1052746378;
+        static const int failed_HASH = -1281977283;
+        static const int error_HASH = 96784904;
 
 
         ImageState GetImageStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          switch (hashCode)
           {
+          case pending_HASH:
             return ImageState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
+          case available_HASH:
             return ImageState::available;
-          }
-          else if (hashCode == invalid_HASH)
-          {
+          case invalid_HASH:
             return ImageState::invalid;
-          }
-          else if (hashCode == deregistered_HASH)
-          {
+          case deregistered_HASH:
             return ImageState::deregistered;
-          }
-          else if (hashCode == transient_HASH)
-          {
+          case transient_HASH:
             return ImageState::transient;
-          }
-          else if (hashCode == failed_HASH)
-          {
+          case failed_HASH:
             return ImageState::failed;
-          }
-          else if (hashCode == error_HASH)
-          {
+          case error_HASH:
             return ImageState::error;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace ImageTypeValuesMapper
       {
 
-        static const int machine_HASH = HashingUtils::HashString("machine");
-        static const int kernel_HASH = HashingUtils::HashString("kernel");
-        static const int ramdisk_HASH = HashingUtils::HashString("ramdisk");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int machine_HASH = 825312327;
+        static const int kernel_HASH = -1134867395;
+        static const int ramdisk_HASH = 976979643;
 
 
         ImageTypeValues GetImageTypeValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == machine_HASH)
+          switch (hashCode)
           {
+          case machine_HASH:
             return ImageTypeValues::machine;
-          }
-          else if (hashCode == kernel_HASH)
-          {
+          case kernel_HASH:
             return ImageTypeValues::kernel;
-          }
-          else if (hashCode == ramdisk_HASH)
-          {
+          case ramdisk_HASH:
             return ImageTypeValues::ramdisk;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ImportImageRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -36,7 +37,7 @@ ImportImageRequest::ImportImageRequest() :
 
 Aws::String ImportImageRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ImportImage&";
   if(m_dryRunHasBeenSet)
   {
@@ -45,7 +46,7 @@ Aws::String ImportImageRequest::SerializePayload() const
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_diskContainersHasBeenSet)
@@ -60,22 +61,22 @@ Aws::String ImportImageRequest::SerializePayload() const
 
   if(m_licenseTypeHasBeenSet)
   {
-    ss << "LicenseType=" << StringUtils::URLEncode(m_licenseType.c_str()) << "&";
+    ss << "LicenseType=" << StringUtils::URLEncoded(m_licenseType) << "&";
   }
 
   if(m_hypervisorHasBeenSet)
   {
-    ss << "Hypervisor=" << StringUtils::URLEncode(m_hypervisor.c_str()) << "&";
+    ss << "Hypervisor=" << StringUtils::URLEncoded(m_hypervisor) << "&";
   }
 
   if(m_architectureHasBeenSet)
   {
-    ss << "Architecture=" << StringUtils::URLEncode(m_architecture.c_str()) << "&";
+    ss << "Architecture=" << StringUtils::URLEncoded(m_architecture) << "&";
   }
 
   if(m_platformHasBeenSet)
   {
-    ss << "Platform=" << StringUtils::URLEncode(m_platform.c_str()) << "&";
+    ss << "Platform=" << StringUtils::URLEncoded(m_platform) << "&";
   }
 
   if(m_clientDataHasBeenSet)
@@ -85,15 +86,15 @@ Aws::String ImportImageRequest::SerializePayload() const
 
   if(m_clientTokenHasBeenSet)
   {
-    ss << "ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+    ss << "ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   if(m_roleNameHasBeenSet)
   {
-    ss << "RoleName=" << StringUtils::URLEncode(m_roleName.c_str()) << "&";
+    ss << "RoleName=" << StringUtils::URLEncoded(m_roleName) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
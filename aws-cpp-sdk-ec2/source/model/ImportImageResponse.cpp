@@ -40,7 +40,7 @@ ImportImageResponse& ImportImageResponse::operator =(const AmazonWebServiceResul
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ImportImageResponse")
+  if (rootNode.GetNameView() != "ImportImageResponse")
   {
     resultNode = rootNode.FirstChild("ImportImageResponse");
   }
@@ -50,32 +50,32 @@ ImportImageResponse& ImportImageResponse::operator =(const AmazonWebServiceResul
     XmlNode importTaskIdNode = resultNode.FirstChild("importTaskId");
     if(!importTaskIdNode.IsNull())
     {
-      m_importTaskId = StringUtils::Trim(importTaskIdNode.GetText().c_str());
+      m_importTaskId = importTaskIdNode.GetTextView().Trim().ToString();
     }
     XmlNode architectureNode = resultNode.FirstChild("architecture");
     if(!architectureNode.IsNull())
     {
-      m_architecture = StringUtils::Trim(architectureNode.GetText().c_str());
+      m_architecture = architectureNode.GetTextView().Trim().ToString();
     }
     XmlNode licenseTypeNode = resultNode.FirstChild("licenseType");
     if(!licenseTypeNode.IsNull())
     {
-      m_licenseType = StringUtils::Trim(licenseTypeNode.GetText().c_str());
+      m_licenseType = licenseTypeNode.GetTextView().Trim().ToString();
     }
     XmlNode platformNode = resultNode.FirstChild("platform");
     if(!platformNode.IsNull())
     {
-      m_platform = StringUtils::Trim(platformNode.GetText().c_str());
+      m_platform = platformNode.GetTextView().Trim().ToString();
     }
     XmlNode hypervisorNode = resultNode.FirstChild("hypervisor");
     if(!hypervisorNode.IsNull())
     {
-      m_hypervisor = StringUtils::Trim(hypervisorNode.GetText().c_str());
+      m_hypervisor = hypervisorNode.GetTextView().Trim().ToString();
     }
     XmlNode descriptionNode = resultNode.FirstChild("description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
     }
     XmlNode snapshotDetailsNode = resultNode.FirstChild("snapshotDetailSet");
     if(!snapshotDetailsNode.IsNull())
@@ -91,22 +91,22 @@ ImportImageResponse& ImportImageResponse::operator =(const AmazonWebServiceResul
     XmlNode imageIdNode = resultNode.FirstChild("imageId");
     if(!imageIdNode.IsNull())
     {
-      m_imageId = StringUtils::Trim(imageIdNode.GetText().c_str());
+      m_imageId = imageIdNode.GetTextView().Trim().ToString();
     }
     XmlNode progressNode = resultNode.FirstChild("progress");
     if(!progressNode.IsNull())
     {
-      m_progress = StringUtils::Trim(progressNode.GetText().c_str());
+      m_progress = progressNode.GetTextView().Trim().ToString();
     }
     XmlNode statusMessageNode = resultNode.FirstChild("statusMessage");
     if(!statusMessageNode.IsNull())
     {
-      m_statusMessage = StringUtils::Trim(statusMessageNode.GetText().c_str());
+      m_statusMessage = statusMessageNode.GetTextView().Trim().ToString();
     }
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -69,37 +70,37 @@ ImportImageTask& ImportImageTask::operator =(const XmlNode& xmlNode)
     XmlNode importTaskIdNode = resultNode.FirstChild("importTaskId");
     if(!importTaskIdNode.IsNull())
     {
-      m_importTaskId = StringUtils::Trim(importTaskIdNode.GetText().c_str());
+      m_importTaskId = importTaskIdNode.GetTextView().Trim().ToString();
       m_importTaskIdHasBeenSet = true;
     }
     XmlNode architectureNode = resultNode.FirstChild("architecture");
     if(!architectureNode.IsNull())
     {
-      m_architecture = StringUtils::Trim(architectureNode.GetText().c_str());
+      m_architecture = architectureNode.GetTextView().Trim().ToString();
       m_architectureHasBeenSet = true;
     }
     XmlNode licenseTypeNode = resultNode.FirstChild("licenseType");
     if(!licenseTypeNode.IsNull())
     {
-      m_licenseType = StringUtils::Trim(licenseTypeNode.GetText().c_str());
+      m_licenseType = licenseTypeNode.GetTextView().Trim().ToString();
       m_licenseTypeHasBeenSet = true;
     }
     XmlNode platformNode = resultNode.FirstChild("platform");
     if(!platformNode.IsNull())
     {
-      m_platform = StringUtils::Trim(platformNode.GetText().c_str());
+      m_platform = platformNode.GetTextView().Trim().ToString();
       m_platformHasBeenSet = true;
     }
     XmlNode hypervisorNode = resultNode.FirstChild("hypervisor");
     if(!hypervisorNode.IsNull())
     {
-      m_hypervisor = StringUtils::Trim(hypervisorNode.GetText().c_str());
+      m_hypervisor = hypervisorNode.GetTextView().Trim().ToString();
       m_hypervisorHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode snapshotDetailsNode = resultNode.FirstChild("snapshotDetailSet");
@@ -117,25 +118,25 @@ ImportImageTask& ImportImageTask::operator =(const XmlNode& xmlNode)
     XmlNode imageIdNode = resultNode.FirstChild("imageId");
     if(!imageIdNode.IsNull())
     {
-      m_imageId = StringUtils::Trim(imageIdNode.GetText().c_str());
+      m_imageId = imageIdNode.GetTextView().Trim().ToString();
       m_imageIdHasBeenSet = true;
     }
     XmlNode progressNode = resultNode.FirstChild("progress");
     if(!progressNode.IsNull())
     {
-      m_progress = StringUtils::Trim(progressNode.GetText().c_str());
+      m_progress = progressNode.GetTextView().Trim().ToString();
       m_progressHasBeenSet = true;
     }
     XmlNode statusMessageNode = resultNode.FirstChild("statusMessage");
     if(!statusMessageNode.IsNull())
     {
-      m_statusMessage = StringUtils::Trim(statusMessageNode.GetText().c_str());
+      m_statusMessage = statusMessageNode.GetTextView().Trim().ToString();
       m_statusMessageHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
   }
@@ -147,32 +148,32 @@ void ImportImageTask::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_importTaskIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ImportTaskId=" << StringUtils::URLEncode(m_importTaskId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ImportTaskId=" << StringUtils::URLEncoded(m_importTaskId) << "&";
   }
 
   if(m_architectureHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Architecture=" << StringUtils::URLEncode(m_architecture.c_str()) << "&";
+      oStream << location << index << locationValue << ".Architecture=" << StringUtils::URLEncoded(m_architecture) << "&";
   }
 
   if(m_licenseTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LicenseType=" << StringUtils::URLEncode(m_licenseType.c_str()) << "&";
+      oStream << location << index << locationValue << ".LicenseType=" << StringUtils::URLEncoded(m_licenseType) << "&";
   }
 
   if(m_platformHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Platform=" << StringUtils::URLEncode(m_platform.c_str()) << "&";
+      oStream << location << index << locationValue << ".Platform=" << StringUtils::URLEncoded(m_platform) << "&";
   }
 
   if(m_hypervisorHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Hypervisor=" << StringUtils::URLEncode(m_hypervisor.c_str()) << "&";
+      oStream << location << index << locationValue << ".Hypervisor=" << StringUtils::URLEncoded(m_hypervisor) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_snapshotDetailsHasBeenSet)
@@ -180,30 +181,30 @@ void ImportImageTask::OutputToStream(Aws::OStream& oStream, const char* location
       unsigned snapshotDetailsIdx = 1;
       for(auto& item : m_snapshotDetails)
       {
-        Aws::StringStream snapshotDetailsSs;
+        Aws::Utils::Stream::StringOutputStream snapshotDetailsSs;
         snapshotDetailsSs << location << index << locationValue << ".SnapshotDetailSet." << snapshotDetailsIdx++;
-        item.OutputToStream(oStream, snapshotDetailsSs.str().c_str());
+        item.OutputToStream(oStream, snapshotDetailsSs.GetString().c_str());
       }
   }
 
   if(m_imageIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
 
   if(m_progressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Progress=" << StringUtils::URLEncode(m_progress.c_str()) << "&";
+      oStream << location << index << locationValue << ".Progress=" << StringUtils::URLEncoded(m_progress) << "&";
   }
 
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
 }
@@ -212,53 +213,53 @@ void ImportImageTask::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_importTaskIdHasBeenSet)
   {
-      oStream << location << ".ImportTaskId=" << StringUtils::URLEncode(m_importTaskId.c_str()) << "&";
+      oStream << location << ".ImportTaskId=" << StringUtils::URLEncoded(m_importTaskId) << "&";
   }
   if(m_architectureHasBeenSet)
   {
-      oStream << location << ".Architecture=" << StringUtils::URLEncode(m_architecture.c_str()) << "&";
+      oStream << location << ".Architecture=" << StringUtils::URLEncoded(m_architecture) << "&";
   }
   if(m_licenseTypeHasBeenSet)
   {
-      oStream << location << ".LicenseType=" << StringUtils::URLEncode(m_licenseType.c_str()) << "&";
+      oStream << location << ".LicenseType=" << StringUtils::URLEncoded(m_licenseType) << "&";
   }
   if(m_platformHasBeenSet)
   {
-      oStream << location << ".Platform=" << StringUtils::URLEncode(m_platform.c_str()) << "&";
+      oStream << location << ".Platform=" << StringUtils::URLEncoded(m_platform) << "&";
   }
   if(m_hypervisorHasBeenSet)
   {
-      oStream << location << ".Hypervisor=" << StringUtils::URLEncode(m_hypervisor.c_str()) << "&";
+      oStream << location << ".Hypervisor=" << StringUtils::URLEncoded(m_hypervisor) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_snapshotDetailsHasBeenSet)
   {
       unsigned snapshotDetailsIdx = 1;
       for(auto& item : m_snapshotDetails)
       {
-        Aws::StringStream snapshotDetailsSs;
+        Aws::Utils::Stream::StringOutputStream snapshotDetailsSs;
         snapshotDetailsSs << location <<  ".item." << snapshotDetailsIdx++;
-        item.OutputToStream(oStream, snapshotDetailsSs.str().c_str());
+        item.OutputToStream(oStream, snapshotDetailsSs.GetString().c_str());
       }
   }
   if(m_imageIdHasBeenSet)
   {
-      oStream << location << ".ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+      oStream << location << ".ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
   if(m_progressHasBeenSet)
   {
-      oStream << location << ".Progress=" << StringUtils::URLEncode(m_progress.c_str()) << "&";
+      oStream << location << ".Progress=" << StringUtils::URLEncoded(m_progress) << "&";
   }
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 }
 
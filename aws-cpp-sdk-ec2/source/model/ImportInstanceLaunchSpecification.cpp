@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -71,7 +72,7 @@ ImportInstanceLaunchSpecification& ImportInstanceLaunchSpecification::operator =
     XmlNode architectureNode = resultNode.FirstChild("architecture");
     if(!architectureNode.IsNull())
     {
-      m_architecture = ArchitectureValuesMapper::GetArchitectureValuesForName(StringUtils::Trim(architectureNode.GetText().c_str()).c_str());
+      m_architecture = ArchitectureValuesMapper::GetArchitectureValuesForName(architectureNode.GetTextView().Trim().ToString().c_str());
       m_architectureHasBeenSet = true;
     }
     XmlNode groupNamesNode = resultNode.FirstChild("GroupName");
@@ -80,7 +81,7 @@ ImportInstanceLaunchSpecification& ImportInstanceLaunchSpecification::operator =
       XmlNode groupNamesMember = groupNamesNode.FirstChild("SecurityGroup");
       while(!groupNamesMember.IsNull())
       {
-        m_groupNames.push_back(StringUtils::Trim(groupNamesMember.GetText().c_str()));
+        m_groupNames.push_back(groupNamesMember.GetTextView().Trim().ToString());
         groupNamesMember = groupNamesMember.NextNode("SecurityGroup");
       }
 
@@ -92,7 +93,7 @@ ImportInstanceLaunchSpecification& ImportInstanceLaunchSpecification::operator =
       XmlNode groupIdsMember = groupIdsNode.FirstChild("SecurityGroupId");
       while(!groupIdsMember.IsNull())
       {
-        m_groupIds.push_back(StringUtils::Trim(groupIdsMember.GetText().c_str()));
+        m_groupIds.push_back(groupIdsMember.GetTextView().Trim().ToString());
         groupIdsMember = groupIdsMember.NextNode("SecurityGroupId");
       }
 
@@ -101,7 +102,7 @@ ImportInstanceLaunchSpecification& ImportInstanceLaunchSpecification::operator =
     XmlNode additionalInfoNode = resultNode.FirstChild("additionalInfo");
     if(!additionalInfoNode.IsNull())
     {
-      m_additionalInfo = StringUtils::Trim(additionalInfoNode.GetText().c_str());
+      m_additionalInfo = additionalInfoNode.GetTextView().Trim().ToString();
       m_additionalInfoHasBeenSet = true;
     }
     XmlNode userDataNode = resultNode.FirstChild("userData");
@@ -113,7 +114,7 @@ ImportInstanceLaunchSpecification& ImportInstanceLaunchSpecification::operator =
     XmlNode instanceTypeNode = resultNode.FirstChild("instanceType");
     if(!instanceTypeNode.IsNull())
     {
-      m_instanceType = InstanceTypeMapper::GetInstanceTypeForName(StringUtils::Trim(instanceTypeNode.GetText().c_str()).c_str());
+      m_instanceType = InstanceTypeMapper::GetInstanceTypeForName(instanceTypeNode.GetTextView().Trim().ToString().c_str());
       m_instanceTypeHasBeenSet = true;
     }
     XmlNode placementNode = resultNode.FirstChild("placement");
@@ -125,25 +126,25 @@ ImportInstanceLaunchSpecification& ImportInstanceLaunchSpecification::operator =
     XmlNode monitoringNode = resultNode.FirstChild("monitoring");
     if(!monitoringNode.IsNull())
     {
-      m_monitoring = StringUtils::ConvertToBool(StringUtils::Trim(monitoringNode.GetText().c_str()).c_str());
+      m_monitoring = StringUtils::ConvertToBool(monitoringNode.GetTextView().Trim().ToString().c_str());
       m_monitoringHasBeenSet = true;
     }
     XmlNode subnetIdNode = resultNode.FirstChild("subnetId");
     if(!subnetIdNode.IsNull())
     {
-      m_subnetId = StringUtils::Trim(subnetIdNode.GetText().c_str());
+      m_subnetId = subnetIdNode.GetTextView().Trim().ToString();
       m_subnetIdHasBeenSet = true;
     }
     XmlNode instanceInitiatedShutdownBehaviorNode = resultNode.FirstChild("instanceInitiatedShutdownBehavior");
     if(!instanceInitiatedShutdownBehaviorNode.IsNull())
     {
-      m_instanceInitiatedShutdownBehavior = ShutdownBehaviorMapper::GetShutdownBehaviorForName(StringUtils::Trim(instanceInitiatedShutdownBehaviorNode.GetText().c_str()).c_str());
+      m_instanceInitiatedShutdownBehavior = ShutdownBehaviorMapper::GetShutdownBehaviorForName(instanceInitiatedShutdownBehaviorNode.GetTextView().Trim().ToString().c_str());
       m_instanceInitiatedShutdownBehaviorHasBeenSet = true;
     }
     XmlNode privateIpAddressNode = resultNode.FirstChild("privateIpAddress");
     if(!privateIpAddressNode.IsNull())
     {
-      m_privateIpAddress = StringUtils::Trim(privateIpAddressNode.GetText().c_str());
+      m_privateIpAddress = privateIpAddressNode.GetTextView().Trim().ToString();
       m_privateIpAddressHasBeenSet = true;
     }
   }
@@ -163,7 +164,7 @@ void ImportInstanceLaunchSpecification::OutputToStream(Aws::OStream& oStream, co
       unsigned groupNamesIdx = 1;
       for(auto& item : m_groupNames)
       {
-        oStream << location << index << locationValue << ".GroupName." << groupNamesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".GroupName." << groupNamesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -172,20 +173,20 @@ void ImportInstanceLaunchSpecification::OutputToStream(Aws::OStream& oStream, co
       unsigned groupIdsIdx = 1;
       for(auto& item : m_groupIds)
       {
-        oStream << location << index << locationValue << ".GroupId." << groupIdsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".GroupId." << groupIdsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
   if(m_additionalInfoHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AdditionalInfo=" << StringUtils::URLEncode(m_additionalInfo.c_str()) << "&";
+      oStream << location << index << locationValue << ".AdditionalInfo=" << StringUtils::URLEncoded(m_additionalInfo) << "&";
   }
 
   if(m_userDataHasBeenSet)
   {
-      Aws::StringStream userDataLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream userDataLocationAndMemberSs;
       userDataLocationAndMemberSs << location << index << locationValue << ".UserData";
-      m_userData.OutputToStream(oStream, userDataLocationAndMemberSs.str().c_str());
+      m_userData.OutputToStream(oStream, userDataLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_instanceTypeHasBeenSet)
@@ -195,9 +196,9 @@ void ImportInstanceLaunchSpecification::OutputToStream(Aws::OStream& oStream, co
 
   if(m_placementHasBeenSet)
   {
-      Aws::StringStream placementLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream placementLocationAndMemberSs;
       placementLocationAndMemberSs << location << index << locationValue << ".Placement";
-      m_placement.OutputToStream(oStream, placementLocationAndMemberSs.str().c_str());
+      m_placement.OutputToStream(oStream, placementLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_monitoringHasBeenSet)
@@ -207,7 +208,7 @@ void ImportInstanceLaunchSpecification::OutputToStream(Aws::OStream& oStream, co
 
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
   if(m_instanceInitiatedShutdownBehaviorHasBeenSet)
@@ -217,7 +218,7 @@ void ImportInstanceLaunchSpecification::OutputToStream(Aws::OStream& oStream, co
 
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
 
 }
@@ -233,7 +234,7 @@ void ImportInstanceLaunchSpecification::OutputToStream(Aws::OStream& oStream, co
       unsigned groupNamesIdx = 1;
       for(auto& item : m_groupNames)
       {
-        oStream << location << ".SecurityGroup." << groupNamesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".SecurityGroup." << groupNamesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_groupIdsHasBeenSet)
@@ -241,12 +242,12 @@ void ImportInstanceLaunchSpecification::OutputToStream(Aws::OStream& oStream, co
       unsigned groupIdsIdx = 1;
       for(auto& item : m_groupIds)
       {
-        oStream << location << ".SecurityGroupId." << groupIdsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".SecurityGroupId." << groupIdsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_additionalInfoHasBeenSet)
   {
-      oStream << location << ".AdditionalInfo=" << StringUtils::URLEncode(m_additionalInfo.c_str()) << "&";
+      oStream << location << ".AdditionalInfo=" << StringUtils::URLEncoded(m_additionalInfo) << "&";
   }
   if(m_userDataHasBeenSet)
   {
@@ -270,7 +271,7 @@ void ImportInstanceLaunchSpecification::OutputToStream(Aws::OStream& oStream, co
   }
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
   if(m_instanceInitiatedShutdownBehaviorHasBeenSet)
   {
@@ -278,7 +279,7 @@ void ImportInstanceLaunchSpecification::OutputToStream(Aws::OStream& oStream, co
   }
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
 }
 
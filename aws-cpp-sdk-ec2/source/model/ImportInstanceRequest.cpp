@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ImportInstanceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -31,7 +32,7 @@ ImportInstanceRequest::ImportInstanceRequest() :
 
 Aws::String ImportInstanceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ImportInstance&";
   if(m_dryRunHasBeenSet)
   {
@@ -40,7 +41,7 @@ Aws::String ImportInstanceRequest::SerializePayload() const
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_launchSpecificationHasBeenSet)
@@ -64,6 +65,6 @@ Aws::String ImportInstanceRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
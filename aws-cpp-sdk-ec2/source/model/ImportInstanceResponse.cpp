@@ -40,7 +40,7 @@ ImportInstanceResponse& ImportInstanceResponse::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ImportInstanceResponse")
+  if (rootNode.GetNameView() != "ImportInstanceResponse")
   {
     resultNode = rootNode.FirstChild("ImportInstanceResponse");
   }
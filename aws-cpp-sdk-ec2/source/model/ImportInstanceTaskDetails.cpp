@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -67,19 +68,19 @@ ImportInstanceTaskDetails& ImportInstanceTaskDetails::operator =(const XmlNode&
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode platformNode = resultNode.FirstChild("platform");
     if(!platformNode.IsNull())
     {
-      m_platform = PlatformValuesMapper::GetPlatformValuesForName(StringUtils::Trim(platformNode.GetText().c_str()).c_str());
+      m_platform = PlatformValuesMapper::GetPlatformValuesForName(platformNode.GetTextView().Trim().ToString().c_str());
       m_platformHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
   }
@@ -94,15 +95,15 @@ void ImportInstanceTaskDetails::OutputToStream(Aws::OStream& oStream, const char
       unsigned volumesIdx = 1;
       for(auto& item : m_volumes)
       {
-        Aws::StringStream volumesSs;
+        Aws::Utils::Stream::StringOutputStream volumesSs;
         volumesSs << location << index << locationValue << ".Volumes." << volumesIdx++;
-        item.OutputToStream(oStream, volumesSs.str().c_str());
+        item.OutputToStream(oStream, volumesSs.GetString().c_str());
       }
   }
 
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_platformHasBeenSet)
@@ -112,7 +113,7 @@ void ImportInstanceTaskDetails::OutputToStream(Aws::OStream& oStream, const char
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
 }
@@ -124,14 +125,14 @@ void ImportInstanceTaskDetails::OutputToStream(Aws::OStream& oStream, const char
       unsigned volumesIdx = 1;
       for(auto& item : m_volumes)
       {
-        Aws::StringStream volumesSs;
+        Aws::Utils::Stream::StringOutputStream volumesSs;
         volumesSs << location <<  ".item." << volumesIdx++;
-        item.OutputToStream(oStream, volumesSs.str().c_str());
+        item.OutputToStream(oStream, volumesSs.GetString().c_str());
       }
   }
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_platformHasBeenSet)
   {
@@ -139,7 +140,7 @@ void ImportInstanceTaskDetails::OutputToStream(Aws::OStream& oStream, const char
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 }
 
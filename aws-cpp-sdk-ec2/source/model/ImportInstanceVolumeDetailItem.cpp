@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -63,13 +64,13 @@ ImportInstanceVolumeDetailItem& ImportInstanceVolumeDetailItem::operator =(const
     XmlNode bytesConvertedNode = resultNode.FirstChild("bytesConverted");
     if(!bytesConvertedNode.IsNull())
     {
-      m_bytesConverted = StringUtils::ConvertToInt64(StringUtils::Trim(bytesConvertedNode.GetText().c_str()).c_str());
+      m_bytesConverted = StringUtils::ConvertToInt64(bytesConvertedNode.GetTextView().Trim().ToString().c_str());
       m_bytesConvertedHasBeenSet = true;
     }
     XmlNode availabilityZoneNode = resultNode.FirstChild("availabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode imageNode = resultNode.FirstChild("image");
@@ -87,19 +88,19 @@ ImportInstanceVolumeDetailItem& ImportInstanceVolumeDetailItem::operator =(const
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode statusMessageNode = resultNode.FirstChild("statusMessage");
     if(!statusMessageNode.IsNull())
     {
-      m_statusMessage = StringUtils::Trim(statusMessageNode.GetText().c_str());
+      m_statusMessage = statusMessageNode.GetTextView().Trim().ToString();
       m_statusMessageHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
   }
@@ -116,36 +117,36 @@ void ImportInstanceVolumeDetailItem::OutputToStream(Aws::OStream& oStream, const
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_imageHasBeenSet)
   {
-      Aws::StringStream imageLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream imageLocationAndMemberSs;
       imageLocationAndMemberSs << location << index << locationValue << ".Image";
-      m_image.OutputToStream(oStream, imageLocationAndMemberSs.str().c_str());
+      m_image.OutputToStream(oStream, imageLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_volumeHasBeenSet)
   {
-      Aws::StringStream volumeLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream volumeLocationAndMemberSs;
       volumeLocationAndMemberSs << location << index << locationValue << ".Volume";
-      m_volume.OutputToStream(oStream, volumeLocationAndMemberSs.str().c_str());
+      m_volume.OutputToStream(oStream, volumeLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
 }
@@ -158,7 +159,7 @@ void ImportInstanceVolumeDetailItem::OutputToStream(Aws::OStream& oStream, const
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_imageHasBeenSet)
   {
@@ -174,15 +175,15 @@ void ImportInstanceVolumeDetailItem::OutputToStream(Aws::OStream& oStream, const
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ImportKeyPairRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 #include <aws/core/utils/HashingUtils.h>
 
 using namespace Aws::EC2::Model;
@@ -30,7 +31,7 @@ ImportKeyPairRequest::ImportKeyPairRequest() :
 
 Aws::String ImportKeyPairRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ImportKeyPair&";
   if(m_dryRunHasBeenSet)
   {
@@ -39,7 +40,7 @@ Aws::String ImportKeyPairRequest::SerializePayload() const
 
   if(m_keyNameHasBeenSet)
   {
-    ss << "KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+    ss << "KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
 
   if(m_publicKeyMaterialHasBeenSet)
@@ -48,6 +49,6 @@ Aws::String ImportKeyPairRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
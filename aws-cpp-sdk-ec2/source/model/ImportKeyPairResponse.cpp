@@ -40,7 +40,7 @@ ImportKeyPairResponse& ImportKeyPairResponse::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ImportKeyPairResponse")
+  if (rootNode.GetNameView() != "ImportKeyPairResponse")
   {
     resultNode = rootNode.FirstChild("ImportKeyPairResponse");
   }
@@ -50,12 +50,12 @@ ImportKeyPairResponse& ImportKeyPairResponse::operator =(const AmazonWebServiceR
     XmlNode keyNameNode = resultNode.FirstChild("keyName");
     if(!keyNameNode.IsNull())
     {
-      m_keyName = StringUtils::Trim(keyNameNode.GetText().c_str());
+      m_keyName = keyNameNode.GetTextView().Trim().ToString();
     }
     XmlNode keyFingerprintNode = resultNode.FirstChild("keyFingerprint");
     if(!keyFingerprintNode.IsNull())
     {
-      m_keyFingerprint = StringUtils::Trim(keyFingerprintNode.GetText().c_str());
+      m_keyFingerprint = keyFingerprintNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ImportSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -32,7 +33,7 @@ ImportSnapshotRequest::ImportSnapshotRequest() :
 
 Aws::String ImportSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ImportSnapshot&";
   if(m_dryRunHasBeenSet)
   {
@@ -41,7 +42,7 @@ Aws::String ImportSnapshotRequest::SerializePayload() const
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_diskContainerHasBeenSet)
@@ -56,15 +57,15 @@ Aws::String ImportSnapshotRequest::SerializePayload() const
 
   if(m_clientTokenHasBeenSet)
   {
-    ss << "ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+    ss << "ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   if(m_roleNameHasBeenSet)
   {
-    ss << "RoleName=" << StringUtils::URLEncode(m_roleName.c_str()) << "&";
+    ss << "RoleName=" << StringUtils::URLEncoded(m_roleName) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ImportSnapshotResponse& ImportSnapshotResponse::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ImportSnapshotResponse")
+  if (rootNode.GetNameView() != "ImportSnapshotResponse")
   {
     resultNode = rootNode.FirstChild("ImportSnapshotResponse");
   }
@@ -50,7 +50,7 @@ ImportSnapshotResponse& ImportSnapshotResponse::operator =(const AmazonWebServic
     XmlNode importTaskIdNode = resultNode.FirstChild("importTaskId");
     if(!importTaskIdNode.IsNull())
     {
-      m_importTaskId = StringUtils::Trim(importTaskIdNode.GetText().c_str());
+      m_importTaskId = importTaskIdNode.GetTextView().Trim().ToString();
     }
     XmlNode snapshotTaskDetailNode = resultNode.FirstChild("snapshotTaskDetail");
     if(!snapshotTaskDetailNode.IsNull())
@@ -60,7 +60,7 @@ ImportSnapshotResponse& ImportSnapshotResponse::operator =(const AmazonWebServic
     XmlNode descriptionNode = resultNode.FirstChild("description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,7 +54,7 @@ ImportSnapshotTask& ImportSnapshotTask::operator =(const XmlNode& xmlNode)
     XmlNode importTaskIdNode = resultNode.FirstChild("importTaskId");
     if(!importTaskIdNode.IsNull())
     {
-      m_importTaskId = StringUtils::Trim(importTaskIdNode.GetText().c_str());
+      m_importTaskId = importTaskIdNode.GetTextView().Trim().ToString();
       m_importTaskIdHasBeenSet = true;
     }
     XmlNode snapshotTaskDetailNode = resultNode.FirstChild("snapshotTaskDetail");
@@ -65,7 +66,7 @@ ImportSnapshotTask& ImportSnapshotTask::operator =(const XmlNode& xmlNode)
     XmlNode descriptionNode = resultNode.FirstChild("description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
   }
@@ -77,19 +78,19 @@ void ImportSnapshotTask::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_importTaskIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ImportTaskId=" << StringUtils::URLEncode(m_importTaskId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ImportTaskId=" << StringUtils::URLEncoded(m_importTaskId) << "&";
   }
 
   if(m_snapshotTaskDetailHasBeenSet)
   {
-      Aws::StringStream snapshotTaskDetailLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream snapshotTaskDetailLocationAndMemberSs;
       snapshotTaskDetailLocationAndMemberSs << location << index << locationValue << ".SnapshotTaskDetail";
-      m_snapshotTaskDetail.OutputToStream(oStream, snapshotTaskDetailLocationAndMemberSs.str().c_str());
+      m_snapshotTaskDetail.OutputToStream(oStream, snapshotTaskDetailLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
 }
@@ -98,7 +99,7 @@ void ImportSnapshotTask::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_importTaskIdHasBeenSet)
   {
-      oStream << location << ".ImportTaskId=" << StringUtils::URLEncode(m_importTaskId.c_str()) << "&";
+      oStream << location << ".ImportTaskId=" << StringUtils::URLEncoded(m_importTaskId) << "&";
   }
   if(m_snapshotTaskDetailHasBeenSet)
   {
@@ -108,7 +109,7 @@ void ImportSnapshotTask::OutputToStream(Aws::OStream& oStream, const char* locat
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ImportVolumeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -31,7 +32,7 @@ ImportVolumeRequest::ImportVolumeRequest() :
 
 Aws::String ImportVolumeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ImportVolume&";
   if(m_dryRunHasBeenSet)
   {
@@ -40,7 +41,7 @@ Aws::String ImportVolumeRequest::SerializePayload() const
 
   if(m_availabilityZoneHasBeenSet)
   {
-    ss << "AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+    ss << "AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_imageHasBeenSet)
@@ -50,7 +51,7 @@ Aws::String ImportVolumeRequest::SerializePayload() const
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_volumeHasBeenSet)
@@ -59,6 +60,6 @@ Aws::String ImportVolumeRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
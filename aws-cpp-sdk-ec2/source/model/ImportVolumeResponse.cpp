@@ -40,7 +40,7 @@ ImportVolumeResponse& ImportVolumeResponse::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ImportVolumeResponse")
+  if (rootNode.GetNameView() != "ImportVolumeResponse")
   {
     resultNode = rootNode.FirstChild("ImportVolumeResponse");
   }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,19 +60,19 @@ ImportVolumeTaskDetails& ImportVolumeTaskDetails::operator =(const XmlNode& xmlN
     XmlNode bytesConvertedNode = resultNode.FirstChild("bytesConverted");
     if(!bytesConvertedNode.IsNull())
     {
-      m_bytesConverted = StringUtils::ConvertToInt64(StringUtils::Trim(bytesConvertedNode.GetText().c_str()).c_str());
+      m_bytesConverted = StringUtils::ConvertToInt64(bytesConvertedNode.GetTextView().Trim().ToString().c_str());
       m_bytesConvertedHasBeenSet = true;
     }
     XmlNode availabilityZoneNode = resultNode.FirstChild("availabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode imageNode = resultNode.FirstChild("image");
@@ -100,26 +101,26 @@ void ImportVolumeTaskDetails::OutputToStream(Aws::OStream& oStream, const char*
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_imageHasBeenSet)
   {
-      Aws::StringStream imageLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream imageLocationAndMemberSs;
       imageLocationAndMemberSs << location << index << locationValue << ".Image";
-      m_image.OutputToStream(oStream, imageLocationAndMemberSs.str().c_str());
+      m_image.OutputToStream(oStream, imageLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_volumeHasBeenSet)
   {
-      Aws::StringStream volumeLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream volumeLocationAndMemberSs;
       volumeLocationAndMemberSs << location << index << locationValue << ".Volume";
-      m_volume.OutputToStream(oStream, volumeLocationAndMemberSs.str().c_str());
+      m_volume.OutputToStream(oStream, volumeLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -132,11 +133,11 @@ void ImportVolumeTaskDetails::OutputToStream(Aws::OStream& oStream, const char*
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_imageHasBeenSet)
   {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -127,13 +128,13 @@ Instance& Instance::operator =(const XmlNode& xmlNode)
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode imageIdNode = resultNode.FirstChild("imageId");
     if(!imageIdNode.IsNull())
     {
-      m_imageId = StringUtils::Trim(imageIdNode.GetText().c_str());
+      m_imageId = imageIdNode.GetTextView().Trim().ToString();
       m_imageIdHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("instanceState");
@@ -145,31 +146,31 @@ Instance& Instance::operator =(const XmlNode& xmlNode)
     XmlNode privateDnsNameNode = resultNode.FirstChild("privateDnsName");
     if(!privateDnsNameNode.IsNull())
     {
-      m_privateDnsName = StringUtils::Trim(privateDnsNameNode.GetText().c_str());
+      m_privateDnsName = privateDnsNameNode.GetTextView().Trim().ToString();
       m_privateDnsNameHasBeenSet = true;
     }
     XmlNode publicDnsNameNode = resultNode.FirstChild("dnsName");
     if(!publicDnsNameNode.IsNull())
     {
-      m_publicDnsName = StringUtils::Trim(publicDnsNameNode.GetText().c_str());
+      m_publicDnsName = publicDnsNameNode.GetTextView().Trim().ToString();
       m_publicDnsNameHasBeenSet = true;
     }
     XmlNode stateTransitionReasonNode = resultNode.FirstChild("reason");
     if(!stateTransitionReasonNode.IsNull())
     {
-      m_stateTransitionReason = StringUtils::Trim(stateTransitionReasonNode.GetText().c_str());
+      m_stateTransitionReason = stateTransitionReasonNode.GetTextView().Trim().ToString();
       m_stateTransitionReasonHasBeenSet = true;
     }
     XmlNode keyNameNode = resultNode.FirstChild("keyName");
     if(!keyNameNode.IsNull())
     {
-      m_keyName = StringUtils::Trim(keyNameNode.GetText().c_str());
+      m_keyName = keyNameNode.GetTextView().Trim().ToString();
       m_keyNameHasBeenSet = true;
     }
     XmlNode amiLaunchIndexNode = resultNode.FirstChild("amiLaunchIndex");
     if(!amiLaunchIndexNode.IsNull())
     {
-      m_amiLaunchIndex = StringUtils::ConvertToInt32(StringUtils::Trim(amiLaunchIndexNode.GetText().c_str()).c_str());
+      m_amiLaunchIndex = StringUtils::ConvertToInt32(amiLaunchIndexNode.GetTextView().Trim().ToString().c_str());
       m_amiLaunchIndexHasBeenSet = true;
     }
     XmlNode productCodesNode = resultNode.FirstChild("productCodes");
@@ -187,13 +188,13 @@ Instance& Instance::operator =(const XmlNode& xmlNode)
     XmlNode instanceTypeNode = resultNode.FirstChild("instanceType");
     if(!instanceTypeNode.IsNull())
     {
-      m_instanceType = InstanceTypeMapper::GetInstanceTypeForName(StringUtils::Trim(instanceTypeNode.GetText().c_str()).c_str());
+      m_instanceType = InstanceTypeMapper::GetInstanceTypeForName(instanceTypeNode.GetTextView().Trim().ToString().c_str());
       m_instanceTypeHasBeenSet = true;
     }
     XmlNode launchTimeNode = resultNode.FirstChild("launchTime");
     if(!launchTimeNode.IsNull())
     {
-      m_launchTime = DateTime(StringUtils::Trim(launchTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_launchTime = DateTime(launchTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_launchTimeHasBeenSet = true;
     }
     XmlNode placementNode = resultNode.FirstChild("placement");
@@ -205,19 +206,19 @@ Instance& Instance::operator =(const XmlNode& xmlNode)
     XmlNode kernelIdNode = resultNode.FirstChild("kernelId");
     if(!kernelIdNode.IsNull())
     {
-      m_kernelId = StringUtils::Trim(kernelIdNode.GetText().c_str());
+      m_kernelId = kernelIdNode.GetTextView().Trim().ToString();
       m_kernelIdHasBeenSet = true;
     }
     XmlNode ramdiskIdNode = resultNode.FirstChild("ramdiskId");
     if(!ramdiskIdNode.IsNull())
     {
-      m_ramdiskId = StringUtils::Trim(ramdiskIdNode.GetText().c_str());
+      m_ramdiskId = ramdiskIdNode.GetTextView().Trim().ToString();
       m_ramdiskIdHasBeenSet = true;
     }
     XmlNode platformNode = resultNode.FirstChild("platform");
     if(!platformNode.IsNull())
     {
-      m_platform = PlatformValuesMapper::GetPlatformValuesForName(StringUtils::Trim(platformNode.GetText().c_str()).c_str());
+      m_platform = PlatformValuesMapper::GetPlatformValuesForName(platformNode.GetTextView().Trim().ToString().c_str());
       m_platformHasBeenSet = true;
     }
     XmlNode monitoringNode = resultNode.FirstChild("monitoring");
@@ -229,25 +230,25 @@ Instance& Instance::operator =(const XmlNode& xmlNode)
     XmlNode subnetIdNode = resultNode.FirstChild("subnetId");
     if(!subnetIdNode.IsNull())
     {
-      m_subnetId = StringUtils::Trim(subnetIdNode.GetText().c_str());
+      m_subnetId = subnetIdNode.GetTextView().Trim().ToString();
       m_subnetIdHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("vpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode privateIpAddressNode = resultNode.FirstChild("privateIpAddress");
     if(!privateIpAddressNode.IsNull())
     {
-      m_privateIpAddress = StringUtils::Trim(privateIpAddressNode.GetText().c_str());
+      m_privateIpAddress = privateIpAddressNode.GetTextView().Trim().ToString();
       m_privateIpAddressHasBeenSet = true;
     }
     XmlNode publicIpAddressNode = resultNode.FirstChild("ipAddress");
     if(!publicIpAddressNode.IsNull())
     {
-      m_publicIpAddress = StringUtils::Trim(publicIpAddressNode.GetText().c_str());
+      m_publicIpAddress = publicIpAddressNode.GetTextView().Trim().ToString();
       m_publicIpAddressHasBeenSet = true;
     }
     XmlNode stateReasonNode = resultNode.FirstChild("stateReason");
@@ -259,19 +260,19 @@ Instance& Instance::operator =(const XmlNode& xmlNode)
     XmlNode architectureNode = resultNode.FirstChild("architecture");
     if(!architectureNode.IsNull())
     {
-      m_architecture = ArchitectureValuesMapper::GetArchitectureValuesForName(StringUtils::Trim(architectureNode.GetText().c_str()).c_str());
+      m_architecture = ArchitectureValuesMapper::GetArchitectureValuesForName(architectureNode.GetTextView().Trim().ToString().c_str());
       m_architectureHasBeenSet = true;
     }
     XmlNode rootDeviceTypeNode = resultNode.FirstChild("rootDeviceType");
     if(!rootDeviceTypeNode.IsNull())
     {
-      m_rootDeviceType = DeviceTypeMapper::GetDeviceTypeForName(StringUtils::Trim(rootDeviceTypeNode.GetText().c_str()).c_str());
+      m_rootDeviceType = DeviceTypeMapper::GetDeviceTypeForName(rootDeviceTypeNode.GetTextView().Trim().ToString().c_str());
       m_rootDeviceTypeHasBeenSet = true;
     }
     XmlNode rootDeviceNameNode = resultNode.FirstChild("rootDeviceName");
     if(!rootDeviceNameNode.IsNull())
     {
-      m_rootDeviceName = StringUtils::Trim(rootDeviceNameNode.GetText().c_str());
+      m_rootDeviceName = rootDeviceNameNode.GetTextView().Trim().ToString();
       m_rootDeviceNameHasBeenSet = true;
     }
     XmlNode blockDeviceMappingsNode = resultNode.FirstChild("blockDeviceMapping");
@@ -289,25 +290,25 @@ Instance& Instance::operator =(const XmlNode& xmlNode)
     XmlNode virtualizationTypeNode = resultNode.FirstChild("virtualizationType");
     if(!virtualizationTypeNode.IsNull())
     {
-      m_virtualizationType = VirtualizationTypeMapper::GetVirtualizationTypeForName(StringUtils::Trim(virtualizationTypeNode.GetText().c_str()).c_str());
+      m_virtualizationType = VirtualizationTypeMapper::GetVirtualizationTypeForName(virtualizationTypeNode.GetTextView().Trim().ToString().c_str());
       m_virtualizationTypeHasBeenSet = true;
     }
     XmlNode instanceLifecycleNode = resultNode.FirstChild("instanceLifecycle");
     if(!instanceLifecycleNode.IsNull())
     {
-      m_instanceLifecycle = InstanceLifecycleTypeMapper::GetInstanceLifecycleTypeForName(StringUtils::Trim(instanceLifecycleNode.GetText().c_str()).c_str());
+      m_instanceLifecycle = InstanceLifecycleTypeMapper::GetInstanceLifecycleTypeForName(instanceLifecycleNode.GetTextView().Trim().ToString().c_str());
       m_instanceLifecycleHasBeenSet = true;
     }
     XmlNode spotInstanceRequestIdNode = resultNode.FirstChild("spotInstanceRequestId");
     if(!spotInstanceRequestIdNode.IsNull())
     {
-      m_spotInstanceRequestId = StringUtils::Trim(spotInstanceRequestIdNode.GetText().c_str());
+      m_spotInstanceRequestId = spotInstanceRequestIdNode.GetTextView().Trim().ToString();
       m_spotInstanceRequestIdHasBeenSet = true;
     }
     XmlNode clientTokenNode = resultNode.FirstChild("clientToken");
     if(!clientTokenNode.IsNull())
     {
-      m_clientToken = StringUtils::Trim(clientTokenNode.GetText().c_str());
+      m_clientToken = clientTokenNode.GetTextView().Trim().ToString();
       m_clientTokenHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("tagSet");
@@ -337,13 +338,13 @@ Instance& Instance::operator =(const XmlNode& xmlNode)
     XmlNode sourceDestCheckNode = resultNode.FirstChild("sourceDestCheck");
     if(!sourceDestCheckNode.IsNull())
     {
-      m_sourceDestCheck = StringUtils::ConvertToBool(StringUtils::Trim(sourceDestCheckNode.GetText().c_str()).c_str());
+      m_sourceDestCheck = StringUtils::ConvertToBool(sourceDestCheckNode.GetTextView().Trim().ToString().c_str());
       m_sourceDestCheckHasBeenSet = true;
     }
     XmlNode hypervisorNode = resultNode.FirstChild("hypervisor");
     if(!hypervisorNode.IsNull())
     {
-      m_hypervisor = HypervisorTypeMapper::GetHypervisorTypeForName(StringUtils::Trim(hypervisorNode.GetText().c_str()).c_str());
+      m_hypervisor = HypervisorTypeMapper::GetHypervisorTypeForName(hypervisorNode.GetTextView().Trim().ToString().c_str());
       m_hypervisorHasBeenSet = true;
     }
     XmlNode networkInterfacesNode = resultNode.FirstChild("networkInterfaceSet");
@@ -367,13 +368,13 @@ Instance& Instance::operator =(const XmlNode& xmlNode)
     XmlNode ebsOptimizedNode = resultNode.FirstChild("ebsOptimized");
     if(!ebsOptimizedNode.IsNull())
     {
-      m_ebsOptimized = StringUtils::ConvertToBool(StringUtils::Trim(ebsOptimizedNode.GetText().c_str()).c_str());
+      m_ebsOptimized = StringUtils::ConvertToBool(ebsOptimizedNode.GetTextView().Trim().ToString().c_str());
       m_ebsOptimizedHasBeenSet = true;
     }
     XmlNode sriovNetSupportNode = resultNode.FirstChild("sriovNetSupport");
     if(!sriovNetSupportNode.IsNull())
     {
-      m_sriovNetSupport = StringUtils::Trim(sriovNetSupportNode.GetText().c_str());
+      m_sriovNetSupport = sriovNetSupportNode.GetTextView().Trim().ToString();
       m_sriovNetSupportHasBeenSet = true;
     }
   }
@@ -385,39 +386,39 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_imageIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
 
   if(m_stateHasBeenSet)
   {
-      Aws::StringStream stateLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream stateLocationAndMemberSs;
       stateLocationAndMemberSs << location << index << locationValue << ".State";
-      m_state.OutputToStream(oStream, stateLocationAndMemberSs.str().c_str());
+      m_state.OutputToStream(oStream, stateLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_privateDnsNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrivateDnsName=" << StringUtils::URLEncode(m_privateDnsName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrivateDnsName=" << StringUtils::URLEncoded(m_privateDnsName) << "&";
   }
 
   if(m_publicDnsNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PublicDnsName=" << StringUtils::URLEncode(m_publicDnsName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PublicDnsName=" << StringUtils::URLEncoded(m_publicDnsName) << "&";
   }
 
   if(m_stateTransitionReasonHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StateTransitionReason=" << StringUtils::URLEncode(m_stateTransitionReason.c_str()) << "&";
+      oStream << location << index << locationValue << ".StateTransitionReason=" << StringUtils::URLEncoded(m_stateTransitionReason) << "&";
   }
 
   if(m_keyNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+      oStream << location << index << locationValue << ".KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
 
   if(m_amiLaunchIndexHasBeenSet)
@@ -430,9 +431,9 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location, unsig
       unsigned productCodesIdx = 1;
       for(auto& item : m_productCodes)
       {
-        Aws::StringStream productCodesSs;
+        Aws::Utils::Stream::StringOutputStream productCodesSs;
         productCodesSs << location << index << locationValue << ".ProductCodes." << productCodesIdx++;
-        item.OutputToStream(oStream, productCodesSs.str().c_str());
+        item.OutputToStream(oStream, productCodesSs.GetString().c_str());
       }
   }
 
@@ -443,24 +444,24 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_launchTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LaunchTime=" << StringUtils::URLEncode(m_launchTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".LaunchTime=" << StringUtils::URLEncoded(m_launchTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_placementHasBeenSet)
   {
-      Aws::StringStream placementLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream placementLocationAndMemberSs;
       placementLocationAndMemberSs << location << index << locationValue << ".Placement";
-      m_placement.OutputToStream(oStream, placementLocationAndMemberSs.str().c_str());
+      m_placement.OutputToStream(oStream, placementLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_kernelIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KernelId=" << StringUtils::URLEncode(m_kernelId.c_str()) << "&";
+      oStream << location << index << locationValue << ".KernelId=" << StringUtils::URLEncoded(m_kernelId) << "&";
   }
 
   if(m_ramdiskIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RamdiskId=" << StringUtils::URLEncode(m_ramdiskId.c_str()) << "&";
+      oStream << location << index << locationValue << ".RamdiskId=" << StringUtils::URLEncoded(m_ramdiskId) << "&";
   }
 
   if(m_platformHasBeenSet)
@@ -470,36 +471,36 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_monitoringHasBeenSet)
   {
-      Aws::StringStream monitoringLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream monitoringLocationAndMemberSs;
       monitoringLocationAndMemberSs << location << index << locationValue << ".Monitoring";
-      m_monitoring.OutputToStream(oStream, monitoringLocationAndMemberSs.str().c_str());
+      m_monitoring.OutputToStream(oStream, monitoringLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
 
   if(m_publicIpAddressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PublicIpAddress=" << StringUtils::URLEncode(m_publicIpAddress.c_str()) << "&";
+      oStream << location << index << locationValue << ".PublicIpAddress=" << StringUtils::URLEncoded(m_publicIpAddress) << "&";
   }
 
   if(m_stateReasonHasBeenSet)
   {
-      Aws::StringStream stateReasonLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream stateReasonLocationAndMemberSs;
       stateReasonLocationAndMemberSs << location << index << locationValue << ".StateReason";
-      m_stateReason.OutputToStream(oStream, stateReasonLocationAndMemberSs.str().c_str());
+      m_stateReason.OutputToStream(oStream, stateReasonLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_architectureHasBeenSet)
@@ -514,7 +515,7 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_rootDeviceNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RootDeviceName=" << StringUtils::URLEncode(m_rootDeviceName.c_str()) << "&";
+      oStream << location << index << locationValue << ".RootDeviceName=" << StringUtils::URLEncoded(m_rootDeviceName) << "&";
   }
 
   if(m_blockDeviceMappingsHasBeenSet)
@@ -522,9 +523,9 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location, unsig
       unsigned blockDeviceMappingsIdx = 1;
       for(auto& item : m_blockDeviceMappings)
       {
-        Aws::StringStream blockDeviceMappingsSs;
+        Aws::Utils::Stream::StringOutputStream blockDeviceMappingsSs;
         blockDeviceMappingsSs << location << index << locationValue << ".BlockDeviceMapping." << blockDeviceMappingsIdx++;
-        item.OutputToStream(oStream, blockDeviceMappingsSs.str().c_str());
+        item.OutputToStream(oStream, blockDeviceMappingsSs.GetString().c_str());
       }
   }
 
@@ -540,12 +541,12 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_spotInstanceRequestIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SpotInstanceRequestId=" << StringUtils::URLEncode(m_spotInstanceRequestId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SpotInstanceRequestId=" << StringUtils::URLEncoded(m_spotInstanceRequestId) << "&";
   }
 
   if(m_clientTokenHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -553,9 +554,9 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location, unsig
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -564,9 +565,9 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location, unsig
       unsigned securityGroupsIdx = 1;
       for(auto& item : m_securityGroups)
       {
-        Aws::StringStream securityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream securityGroupsSs;
         securityGroupsSs << location << index << locationValue << ".GroupSet." << securityGroupsIdx++;
-        item.OutputToStream(oStream, securityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, securityGroupsSs.GetString().c_str());
       }
   }
 
@@ -585,17 +586,17 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location, unsig
       unsigned networkInterfacesIdx = 1;
       for(auto& item : m_networkInterfaces)
       {
-        Aws::StringStream networkInterfacesSs;
+        Aws::Utils::Stream::StringOutputStream networkInterfacesSs;
         networkInterfacesSs << location << index << locationValue << ".NetworkInterfaceSet." << networkInterfacesIdx++;
-        item.OutputToStream(oStream, networkInterfacesSs.str().c_str());
+        item.OutputToStream(oStream, networkInterfacesSs.GetString().c_str());
       }
   }
 
   if(m_iamInstanceProfileHasBeenSet)
   {
-      Aws::StringStream iamInstanceProfileLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream iamInstanceProfileLocationAndMemberSs;
       iamInstanceProfileLocationAndMemberSs << location << index << locationValue << ".IamInstanceProfile";
-      m_iamInstanceProfile.OutputToStream(oStream, iamInstanceProfileLocationAndMemberSs.str().c_str());
+      m_iamInstanceProfile.OutputToStream(oStream, iamInstanceProfileLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_ebsOptimizedHasBeenSet)
@@ -605,7 +606,7 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_sriovNetSupportHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SriovNetSupport=" << StringUtils::URLEncode(m_sriovNetSupport.c_str()) << "&";
+      oStream << location << index << locationValue << ".SriovNetSupport=" << StringUtils::URLEncoded(m_sriovNetSupport) << "&";
   }
 
 }
@@ -614,11 +615,11 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_imageIdHasBeenSet)
   {
-      oStream << location << ".ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+      oStream << location << ".ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
   if(m_stateHasBeenSet)
   {
@@ -628,19 +629,19 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_privateDnsNameHasBeenSet)
   {
-      oStream << location << ".PrivateDnsName=" << StringUtils::URLEncode(m_privateDnsName.c_str()) << "&";
+      oStream << location << ".PrivateDnsName=" << StringUtils::URLEncoded(m_privateDnsName) << "&";
   }
   if(m_publicDnsNameHasBeenSet)
   {
-      oStream << location << ".PublicDnsName=" << StringUtils::URLEncode(m_publicDnsName.c_str()) << "&";
+      oStream << location << ".PublicDnsName=" << StringUtils::URLEncoded(m_publicDnsName) << "&";
   }
   if(m_stateTransitionReasonHasBeenSet)
   {
-      oStream << location << ".StateTransitionReason=" << StringUtils::URLEncode(m_stateTransitionReason.c_str()) << "&";
+      oStream << location << ".StateTransitionReason=" << StringUtils::URLEncoded(m_stateTransitionReason) << "&";
   }
   if(m_keyNameHasBeenSet)
   {
-      oStream << location << ".KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+      oStream << location << ".KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
   if(m_amiLaunchIndexHasBeenSet)
   {
@@ -651,9 +652,9 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned productCodesIdx = 1;
       for(auto& item : m_productCodes)
       {
-        Aws::StringStream productCodesSs;
+        Aws::Utils::Stream::StringOutputStream productCodesSs;
         productCodesSs << location <<  ".item." << productCodesIdx++;
-        item.OutputToStream(oStream, productCodesSs.str().c_str());
+        item.OutputToStream(oStream, productCodesSs.GetString().c_str());
       }
   }
   if(m_instanceTypeHasBeenSet)
@@ -662,7 +663,7 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_launchTimeHasBeenSet)
   {
-      oStream << location << ".LaunchTime=" << StringUtils::URLEncode(m_launchTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".LaunchTime=" << StringUtils::URLEncoded(m_launchTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_placementHasBeenSet)
   {
@@ -672,11 +673,11 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_kernelIdHasBeenSet)
   {
-      oStream << location << ".KernelId=" << StringUtils::URLEncode(m_kernelId.c_str()) << "&";
+      oStream << location << ".KernelId=" << StringUtils::URLEncoded(m_kernelId) << "&";
   }
   if(m_ramdiskIdHasBeenSet)
   {
-      oStream << location << ".RamdiskId=" << StringUtils::URLEncode(m_ramdiskId.c_str()) << "&";
+      oStream << location << ".RamdiskId=" << StringUtils::URLEncoded(m_ramdiskId) << "&";
   }
   if(m_platformHasBeenSet)
   {
@@ -690,19 +691,19 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
   if(m_publicIpAddressHasBeenSet)
   {
-      oStream << location << ".PublicIpAddress=" << StringUtils::URLEncode(m_publicIpAddress.c_str()) << "&";
+      oStream << location << ".PublicIpAddress=" << StringUtils::URLEncoded(m_publicIpAddress) << "&";
   }
   if(m_stateReasonHasBeenSet)
   {
@@ -720,16 +721,16 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_rootDeviceNameHasBeenSet)
   {
-      oStream << location << ".RootDeviceName=" << StringUtils::URLEncode(m_rootDeviceName.c_str()) << "&";
+      oStream << location << ".RootDeviceName=" << StringUtils::URLEncoded(m_rootDeviceName) << "&";
   }
   if(m_blockDeviceMappingsHasBeenSet)
   {
       unsigned blockDeviceMappingsIdx = 1;
       for(auto& item : m_blockDeviceMappings)
       {
-        Aws::StringStream blockDeviceMappingsSs;
+        Aws::Utils::Stream::StringOutputStream blockDeviceMappingsSs;
         blockDeviceMappingsSs << location <<  ".item." << blockDeviceMappingsIdx++;
-        item.OutputToStream(oStream, blockDeviceMappingsSs.str().c_str());
+        item.OutputToStream(oStream, blockDeviceMappingsSs.GetString().c_str());
       }
   }
   if(m_virtualizationTypeHasBeenSet)
@@ -742,20 +743,20 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_spotInstanceRequestIdHasBeenSet)
   {
-      oStream << location << ".SpotInstanceRequestId=" << StringUtils::URLEncode(m_spotInstanceRequestId.c_str()) << "&";
+      oStream << location << ".SpotInstanceRequestId=" << StringUtils::URLEncoded(m_spotInstanceRequestId) << "&";
   }
   if(m_clientTokenHasBeenSet)
   {
-      oStream << location << ".ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+      oStream << location << ".ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
   if(m_tagsHasBeenSet)
   {
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
   if(m_securityGroupsHasBeenSet)
@@ -763,9 +764,9 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned securityGroupsIdx = 1;
       for(auto& item : m_securityGroups)
       {
-        Aws::StringStream securityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream securityGroupsSs;
         securityGroupsSs << location <<  ".item." << securityGroupsIdx++;
-        item.OutputToStream(oStream, securityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, securityGroupsSs.GetString().c_str());
       }
   }
   if(m_sourceDestCheckHasBeenSet)
@@ -781,9 +782,9 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned networkInterfacesIdx = 1;
       for(auto& item : m_networkInterfaces)
       {
-        Aws::StringStream networkInterfacesSs;
+        Aws::Utils::Stream::StringOutputStream networkInterfacesSs;
         networkInterfacesSs << location <<  ".item." << networkInterfacesIdx++;
-        item.OutputToStream(oStream, networkInterfacesSs.str().c_str());
+        item.OutputToStream(oStream, networkInterfacesSs.GetString().c_str());
       }
   }
   if(m_iamInstanceProfileHasBeenSet)
@@ -798,7 +799,7 @@ void Instance::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_sriovNetSupportHasBeenSet)
   {
-      oStream << location << ".SriovNetSupport=" << StringUtils::URLEncode(m_sriovNetSupport.c_str()) << "&";
+      oStream << location << ".SriovNetSupport=" << StringUtils::URLEncoded(m_sriovNetSupport) << "&";
   }
 }
 
@@ -29,76 +29,62 @@ namespace Aws
       namespace InstanceAttributeNameMapper
       {
 
-        static const int instanceType_HASH = HashingUtils::HashString("instanceType");
-        static const int kernel_HASH = HashingUtils::HashString("kernel");
-        static const int ramdisk_HASH = HashingUtils::HashString("ramdisk");
-        static const int userData_HASH = HashingUtils::HashString("userData");
-        static const int disableApiTermination_HASH = HashingUtils::HashString("disableApiTermination");
-        static const int instanceInitiatedShutdownBehavior_HASH = HashingUtils::HashString("instanceInitiatedShutdownBehavior");
-        static const int rootDeviceName_HASH = HashingUtils::HashString("rootDeviceName");
-        static const int blockDeviceMapping_HASH = HashingUtils::HashString("blockDeviceMapping");
-        static const int productCodes_HASH = HashingUtils::HashString("productCodes");
-        static const int sourceDestCheck_HASH = HashingUtils::HashString("sourceDestCheck");
-        static const int groupSet_HASH = HashingUtils::HashString("groupSet");
-        static const int ebsOptimized_HASH = HashingUtils::HashString("ebsOptimized");
-        static const int sriovNetSupport_HASH = HashingUtils::HashString("sriovNetSupport");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int instanceType_HASH = -737655441;
+        static const int kernel_HASH = -1134867395;
+        static const int ramdisk_HASH = 976979643;
+        static const int userData_HASH = -266964459;
+        static const int disableApiTermination_HASH = 362887570;
+        static const int instanceInitiatedShutdownBehavior_HASH = -1947213122;
+        static const int rootDeviceName_HASH = 1922702467;
+        static const int blockDeviceMapping_HASH = 1546575371;
+        static const int productCodes_HASH = 988549239;
+        static const int sourceDestCheck_HASH = -1670942293;
+        static const int groupSet_HASH = 506349923;
+        static const int ebsOptimized_HASH = -1426872751;
+        static const int sriovNetSupport_HASH = -1315506269;
 
 
         InstanceAttributeName GetInstanceAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instanceType_HASH)
+          switch (hashCode)
           {
+          case instanceType_HASH:
             return InstanceAttributeName::instanceType;
-          }
-          else if (hashCode == kernel_HASH)
-          {
+          case kernel_HASH:
             return InstanceAttributeName::kernel;
-          }
-          else if (hashCode == ramdisk_HASH)
-          {
+          case ramdisk_HASH:
             return InstanceAttributeName::ramdisk;
-          }
-          else if (hashCode == userData_HASH)
-          {
+          case userData_HASH:
             return InstanceAttributeName::userData;
-          }
-          else if (hashCode == disableApiTermination_HASH)
-          {
+          case disableApiTermination_HASH:
             return InstanceAttributeName::disableApiTermination;
-          }
-          else if (hashCode == instanceInitiatedShutdownBehavior_HASH)
-          {
+          case instanceInitiatedShutdownBehavior_HASH:
             return InstanceAttributeName::instanceInitiatedShutdownBehavior;
-          }
-          else if (hashCode == rootDeviceName_HASH)
-          {
+          case rootDeviceName_HASH:
             return InstanceAttributeName::rootDeviceName;
-          }
-          else if (hashCode == blockDeviceMapping_HASH)
-          {
+          case blockDeviceMapping_HASH:
             return InstanceAttributeName::blockDeviceMapping;
-          }
-          else if (hashCode == productCodes_HASH)
-          {
+          case productCodes_HASH:
             return InstanceAttributeName::productCodes;
-          }
-          else if (hashCode == sourceDestCheck_HASH)
-          {
+          case sourceDestCheck_HASH:
             return InstanceAttributeName::sourceDestCheck;
-          }
-          else if (hashCode == groupSet_HASH)
-          {
+          case groupSet_HASH:
             return InstanceAttributeName::groupSet;
-          }
-          else if (hashCode == ebsOptimized_HASH)
-          {
+          case ebsOptimized_HASH:
             return InstanceAttributeName::ebsOptimized;
-          }
-          else if (hashCode == sriovNetSupport_HASH)
-          {
+          case sriovNetSupport_HASH:
             return InstanceAttributeName::sriovNetSupport;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ InstanceBlockDeviceMapping& InstanceBlockDeviceMapping::operator =(const XmlNode
     XmlNode deviceNameNode = resultNode.FirstChild("deviceName");
     if(!deviceNameNode.IsNull())
     {
-      m_deviceName = StringUtils::Trim(deviceNameNode.GetText().c_str());
+      m_deviceName = deviceNameNode.GetTextView().Trim().ToString();
       m_deviceNameHasBeenSet = true;
     }
     XmlNode ebsNode = resultNode.FirstChild("ebs");
@@ -69,14 +70,14 @@ void InstanceBlockDeviceMapping::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_deviceNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DeviceName=" << StringUtils::URLEncode(m_deviceName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DeviceName=" << StringUtils::URLEncoded(m_deviceName) << "&";
   }
 
   if(m_ebsHasBeenSet)
   {
-      Aws::StringStream ebsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream ebsLocationAndMemberSs;
       ebsLocationAndMemberSs << location << index << locationValue << ".Ebs";
-      m_ebs.OutputToStream(oStream, ebsLocationAndMemberSs.str().c_str());
+      m_ebs.OutputToStream(oStream, ebsLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -85,7 +86,7 @@ void InstanceBlockDeviceMapping::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_deviceNameHasBeenSet)
   {
-      oStream << location << ".DeviceName=" << StringUtils::URLEncode(m_deviceName.c_str()) << "&";
+      oStream << location << ".DeviceName=" << StringUtils::URLEncoded(m_deviceName) << "&";
   }
   if(m_ebsHasBeenSet)
   {
@@ -57,19 +57,19 @@ InstanceCapacity& InstanceCapacity::operator =(const XmlNode& xmlNode)
     XmlNode instanceTypeNode = resultNode.FirstChild("instanceType");
     if(!instanceTypeNode.IsNull())
     {
-      m_instanceType = StringUtils::Trim(instanceTypeNode.GetText().c_str());
+      m_instanceType = instanceTypeNode.GetTextView().Trim().ToString();
       m_instanceTypeHasBeenSet = true;
     }
     XmlNode availableCapacityNode = resultNode.FirstChild("availableCapacity");
     if(!availableCapacityNode.IsNull())
     {
-      m_availableCapacity = StringUtils::ConvertToInt32(StringUtils::Trim(availableCapacityNode.GetText().c_str()).c_str());
+      m_availableCapacity = StringUtils::ConvertToInt32(availableCapacityNode.GetTextView().Trim().ToString().c_str());
       m_availableCapacityHasBeenSet = true;
     }
     XmlNode totalCapacityNode = resultNode.FirstChild("totalCapacity");
     if(!totalCapacityNode.IsNull())
     {
-      m_totalCapacity = StringUtils::ConvertToInt32(StringUtils::Trim(totalCapacityNode.GetText().c_str()).c_str());
+      m_totalCapacity = StringUtils::ConvertToInt32(totalCapacityNode.GetTextView().Trim().ToString().c_str());
       m_totalCapacityHasBeenSet = true;
     }
   }
@@ -81,7 +81,7 @@ void InstanceCapacity::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
 
   if(m_availableCapacityHasBeenSet)
@@ -100,7 +100,7 @@ void InstanceCapacity::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
   if(m_availableCapacityHasBeenSet)
   {
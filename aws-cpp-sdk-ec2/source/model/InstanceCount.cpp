@@ -53,13 +53,13 @@ InstanceCount& InstanceCount::operator =(const XmlNode& xmlNode)
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = ListingStateMapper::GetListingStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = ListingStateMapper::GetListingStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode instanceCountNode = resultNode.FirstChild("instanceCount");
     if(!instanceCountNode.IsNull())
     {
-      m_instanceCount = StringUtils::ConvertToInt32(StringUtils::Trim(instanceCountNode.GetText().c_str()).c_str());
+      m_instanceCount = StringUtils::ConvertToInt32(instanceCountNode.GetTextView().Trim().ToString().c_str());
       m_instanceCountHasBeenSet = true;
     }
   }
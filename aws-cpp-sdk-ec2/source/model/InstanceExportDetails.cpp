@@ -51,13 +51,13 @@ InstanceExportDetails& InstanceExportDetails::operator =(const XmlNode& xmlNode)
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode targetEnvironmentNode = resultNode.FirstChild("targetEnvironment");
     if(!targetEnvironmentNode.IsNull())
     {
-      m_targetEnvironment = ExportEnvironmentMapper::GetExportEnvironmentForName(StringUtils::Trim(targetEnvironmentNode.GetText().c_str()).c_str());
+      m_targetEnvironment = ExportEnvironmentMapper::GetExportEnvironmentForName(targetEnvironmentNode.GetTextView().Trim().ToString().c_str());
       m_targetEnvironmentHasBeenSet = true;
     }
   }
@@ -69,7 +69,7 @@ void InstanceExportDetails::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_targetEnvironmentHasBeenSet)
@@ -83,7 +83,7 @@ void InstanceExportDetails::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_targetEnvironmentHasBeenSet)
   {
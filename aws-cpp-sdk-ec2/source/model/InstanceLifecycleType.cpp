@@ -29,21 +29,29 @@ namespace Aws
       namespace InstanceLifecycleTypeMapper
       {
 
-        static const int spot_HASH = HashingUtils::HashString("spot");
-        static const int scheduled_HASH = HashingUtils::HashString("scheduled");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int spot_HASH = 3537154;
+        static const int scheduled_HASH = -160710483;
 
 
         InstanceLifecycleType GetInstanceLifecycleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == spot_HASH)
+          switch (hashCode)
           {
+          case spot_HASH:
             return InstanceLifecycleType::spot;
-          }
-          else if (hashCode == scheduled_HASH)
-          {
+          case scheduled_HASH:
             return InstanceLifecycleType::scheduled;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ InstanceMonitoring& InstanceMonitoring::operator =(const XmlNode& xmlNode)
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode monitoringNode = resultNode.FirstChild("monitoring");
@@ -69,14 +70,14 @@ void InstanceMonitoring::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_monitoringHasBeenSet)
   {
-      Aws::StringStream monitoringLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream monitoringLocationAndMemberSs;
       monitoringLocationAndMemberSs << location << index << locationValue << ".Monitoring";
-      m_monitoring.OutputToStream(oStream, monitoringLocationAndMemberSs.str().c_str());
+      m_monitoring.OutputToStream(oStream, monitoringLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -85,7 +86,7 @@ void InstanceMonitoring::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_monitoringHasBeenSet)
   {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -77,61 +78,61 @@ InstanceNetworkInterface& InstanceNetworkInterface::operator =(const XmlNode& xm
     XmlNode networkInterfaceIdNode = resultNode.FirstChild("networkInterfaceId");
     if(!networkInterfaceIdNode.IsNull())
     {
-      m_networkInterfaceId = StringUtils::Trim(networkInterfaceIdNode.GetText().c_str());
+      m_networkInterfaceId = networkInterfaceIdNode.GetTextView().Trim().ToString();
       m_networkInterfaceIdHasBeenSet = true;
     }
     XmlNode subnetIdNode = resultNode.FirstChild("subnetId");
     if(!subnetIdNode.IsNull())
     {
-      m_subnetId = StringUtils::Trim(subnetIdNode.GetText().c_str());
+      m_subnetId = subnetIdNode.GetTextView().Trim().ToString();
       m_subnetIdHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("vpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode ownerIdNode = resultNode.FirstChild("ownerId");
     if(!ownerIdNode.IsNull())
     {
-      m_ownerId = StringUtils::Trim(ownerIdNode.GetText().c_str());
+      m_ownerId = ownerIdNode.GetTextView().Trim().ToString();
       m_ownerIdHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = NetworkInterfaceStatusMapper::GetNetworkInterfaceStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = NetworkInterfaceStatusMapper::GetNetworkInterfaceStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode macAddressNode = resultNode.FirstChild("macAddress");
     if(!macAddressNode.IsNull())
     {
-      m_macAddress = StringUtils::Trim(macAddressNode.GetText().c_str());
+      m_macAddress = macAddressNode.GetTextView().Trim().ToString();
       m_macAddressHasBeenSet = true;
     }
     XmlNode privateIpAddressNode = resultNode.FirstChild("privateIpAddress");
     if(!privateIpAddressNode.IsNull())
     {
-      m_privateIpAddress = StringUtils::Trim(privateIpAddressNode.GetText().c_str());
+      m_privateIpAddress = privateIpAddressNode.GetTextView().Trim().ToString();
       m_privateIpAddressHasBeenSet = true;
     }
     XmlNode privateDnsNameNode = resultNode.FirstChild("privateDnsName");
     if(!privateDnsNameNode.IsNull())
     {
-      m_privateDnsName = StringUtils::Trim(privateDnsNameNode.GetText().c_str());
+      m_privateDnsName = privateDnsNameNode.GetTextView().Trim().ToString();
       m_privateDnsNameHasBeenSet = true;
     }
     XmlNode sourceDestCheckNode = resultNode.FirstChild("sourceDestCheck");
     if(!sourceDestCheckNode.IsNull())
     {
-      m_sourceDestCheck = StringUtils::ConvertToBool(StringUtils::Trim(sourceDestCheckNode.GetText().c_str()).c_str());
+      m_sourceDestCheck = StringUtils::ConvertToBool(sourceDestCheckNode.GetTextView().Trim().ToString().c_str());
       m_sourceDestCheckHasBeenSet = true;
     }
     XmlNode groupsNode = resultNode.FirstChild("groupSet");
@@ -179,27 +180,27 @@ void InstanceNetworkInterface::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_networkInterfaceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
 
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_ownerIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OwnerId=" << StringUtils::URLEncode(m_ownerId.c_str()) << "&";
+      oStream << location << index << locationValue << ".OwnerId=" << StringUtils::URLEncoded(m_ownerId) << "&";
   }
 
   if(m_statusHasBeenSet)
@@ -209,17 +210,17 @@ void InstanceNetworkInterface::OutputToStream(Aws::OStream& oStream, const char*
 
   if(m_macAddressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MacAddress=" << StringUtils::URLEncode(m_macAddress.c_str()) << "&";
+      oStream << location << index << locationValue << ".MacAddress=" << StringUtils::URLEncoded(m_macAddress) << "&";
   }
 
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
 
   if(m_privateDnsNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrivateDnsName=" << StringUtils::URLEncode(m_privateDnsName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrivateDnsName=" << StringUtils::URLEncoded(m_privateDnsName) << "&";
   }
 
   if(m_sourceDestCheckHasBeenSet)
@@ -232,24 +233,24 @@ void InstanceNetworkInterface::OutputToStream(Aws::OStream& oStream, const char*
       unsigned groupsIdx = 1;
       for(auto& item : m_groups)
       {
-        Aws::StringStream groupsSs;
+        Aws::Utils::Stream::StringOutputStream groupsSs;
         groupsSs << location << index << locationValue << ".GroupSet." << groupsIdx++;
-        item.OutputToStream(oStream, groupsSs.str().c_str());
+        item.OutputToStream(oStream, groupsSs.GetString().c_str());
       }
   }
 
   if(m_attachmentHasBeenSet)
   {
-      Aws::StringStream attachmentLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream attachmentLocationAndMemberSs;
       attachmentLocationAndMemberSs << location << index << locationValue << ".Attachment";
-      m_attachment.OutputToStream(oStream, attachmentLocationAndMemberSs.str().c_str());
+      m_attachment.OutputToStream(oStream, attachmentLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_associationHasBeenSet)
   {
-      Aws::StringStream associationLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream associationLocationAndMemberSs;
       associationLocationAndMemberSs << location << index << locationValue << ".Association";
-      m_association.OutputToStream(oStream, associationLocationAndMemberSs.str().c_str());
+      m_association.OutputToStream(oStream, associationLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_privateIpAddressesHasBeenSet)
@@ -257,9 +258,9 @@ void InstanceNetworkInterface::OutputToStream(Aws::OStream& oStream, const char*
       unsigned privateIpAddressesIdx = 1;
       for(auto& item : m_privateIpAddresses)
       {
-        Aws::StringStream privateIpAddressesSs;
+        Aws::Utils::Stream::StringOutputStream privateIpAddressesSs;
         privateIpAddressesSs << location << index << locationValue << ".PrivateIpAddressesSet." << privateIpAddressesIdx++;
-        item.OutputToStream(oStream, privateIpAddressesSs.str().c_str());
+        item.OutputToStream(oStream, privateIpAddressesSs.GetString().c_str());
       }
   }
 
@@ -269,23 +270,23 @@ void InstanceNetworkInterface::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_networkInterfaceIdHasBeenSet)
   {
-      oStream << location << ".NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+      oStream << location << ".NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_ownerIdHasBeenSet)
   {
-      oStream << location << ".OwnerId=" << StringUtils::URLEncode(m_ownerId.c_str()) << "&";
+      oStream << location << ".OwnerId=" << StringUtils::URLEncoded(m_ownerId) << "&";
   }
   if(m_statusHasBeenSet)
   {
@@ -293,15 +294,15 @@ void InstanceNetworkInterface::OutputToStream(Aws::OStream& oStream, const char*
   }
   if(m_macAddressHasBeenSet)
   {
-      oStream << location << ".MacAddress=" << StringUtils::URLEncode(m_macAddress.c_str()) << "&";
+      oStream << location << ".MacAddress=" << StringUtils::URLEncoded(m_macAddress) << "&";
   }
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
   if(m_privateDnsNameHasBeenSet)
   {
-      oStream << location << ".PrivateDnsName=" << StringUtils::URLEncode(m_privateDnsName.c_str()) << "&";
+      oStream << location << ".PrivateDnsName=" << StringUtils::URLEncoded(m_privateDnsName) << "&";
   }
   if(m_sourceDestCheckHasBeenSet)
   {
@@ -312,9 +313,9 @@ void InstanceNetworkInterface::OutputToStream(Aws::OStream& oStream, const char*
       unsigned groupsIdx = 1;
       for(auto& item : m_groups)
       {
-        Aws::StringStream groupsSs;
+        Aws::Utils::Stream::StringOutputStream groupsSs;
         groupsSs << location <<  ".item." << groupsIdx++;
-        item.OutputToStream(oStream, groupsSs.str().c_str());
+        item.OutputToStream(oStream, groupsSs.GetString().c_str());
       }
   }
   if(m_attachmentHasBeenSet)
@@ -334,9 +335,9 @@ void InstanceNetworkInterface::OutputToStream(Aws::OStream& oStream, const char*
       unsigned privateIpAddressesIdx = 1;
       for(auto& item : m_privateIpAddresses)
       {
-        Aws::StringStream privateIpAddressesSs;
+        Aws::Utils::Stream::StringOutputStream privateIpAddressesSs;
         privateIpAddressesSs << location <<  ".item." << privateIpAddressesIdx++;
-        item.OutputToStream(oStream, privateIpAddressesSs.str().c_str());
+        item.OutputToStream(oStream, privateIpAddressesSs.GetString().c_str());
       }
   }
 }
@@ -53,19 +53,19 @@ InstanceNetworkInterfaceAssociation& InstanceNetworkInterfaceAssociation::operat
     XmlNode publicIpNode = resultNode.FirstChild("publicIp");
     if(!publicIpNode.IsNull())
     {
-      m_publicIp = StringUtils::Trim(publicIpNode.GetText().c_str());
+      m_publicIp = publicIpNode.GetTextView().Trim().ToString();
       m_publicIpHasBeenSet = true;
     }
     XmlNode publicDnsNameNode = resultNode.FirstChild("publicDnsName");
     if(!publicDnsNameNode.IsNull())
     {
-      m_publicDnsName = StringUtils::Trim(publicDnsNameNode.GetText().c_str());
+      m_publicDnsName = publicDnsNameNode.GetTextView().Trim().ToString();
       m_publicDnsNameHasBeenSet = true;
     }
     XmlNode ipOwnerIdNode = resultNode.FirstChild("ipOwnerId");
     if(!ipOwnerIdNode.IsNull())
     {
-      m_ipOwnerId = StringUtils::Trim(ipOwnerIdNode.GetText().c_str());
+      m_ipOwnerId = ipOwnerIdNode.GetTextView().Trim().ToString();
       m_ipOwnerIdHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void InstanceNetworkInterfaceAssociation::OutputToStream(Aws::OStream& oStream,
 {
   if(m_publicIpHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PublicIp=" << StringUtils::URLEncode(m_publicIp.c_str()) << "&";
+      oStream << location << index << locationValue << ".PublicIp=" << StringUtils::URLEncoded(m_publicIp) << "&";
   }
 
   if(m_publicDnsNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PublicDnsName=" << StringUtils::URLEncode(m_publicDnsName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PublicDnsName=" << StringUtils::URLEncoded(m_publicDnsName) << "&";
   }
 
   if(m_ipOwnerIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".IpOwnerId=" << StringUtils::URLEncode(m_ipOwnerId.c_str()) << "&";
+      oStream << location << index << locationValue << ".IpOwnerId=" << StringUtils::URLEncoded(m_ipOwnerId) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void InstanceNetworkInterfaceAssociation::OutputToStream(Aws::OStream& oStream,
 {
   if(m_publicIpHasBeenSet)
   {
-      oStream << location << ".PublicIp=" << StringUtils::URLEncode(m_publicIp.c_str()) << "&";
+      oStream << location << ".PublicIp=" << StringUtils::URLEncoded(m_publicIp) << "&";
   }
   if(m_publicDnsNameHasBeenSet)
   {
-      oStream << location << ".PublicDnsName=" << StringUtils::URLEncode(m_publicDnsName.c_str()) << "&";
+      oStream << location << ".PublicDnsName=" << StringUtils::URLEncoded(m_publicDnsName) << "&";
   }
   if(m_ipOwnerIdHasBeenSet)
   {
-      oStream << location << ".IpOwnerId=" << StringUtils::URLEncode(m_ipOwnerId.c_str()) << "&";
+      oStream << location << ".IpOwnerId=" << StringUtils::URLEncoded(m_ipOwnerId) << "&";
   }
 }
 
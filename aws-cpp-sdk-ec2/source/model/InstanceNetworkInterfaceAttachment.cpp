@@ -61,31 +61,31 @@ InstanceNetworkInterfaceAttachment& InstanceNetworkInterfaceAttachment::operator
     XmlNode attachmentIdNode = resultNode.FirstChild("attachmentId");
     if(!attachmentIdNode.IsNull())
     {
-      m_attachmentId = StringUtils::Trim(attachmentIdNode.GetText().c_str());
+      m_attachmentId = attachmentIdNode.GetTextView().Trim().ToString();
       m_attachmentIdHasBeenSet = true;
     }
     XmlNode deviceIndexNode = resultNode.FirstChild("deviceIndex");
     if(!deviceIndexNode.IsNull())
     {
-      m_deviceIndex = StringUtils::ConvertToInt32(StringUtils::Trim(deviceIndexNode.GetText().c_str()).c_str());
+      m_deviceIndex = StringUtils::ConvertToInt32(deviceIndexNode.GetTextView().Trim().ToString().c_str());
       m_deviceIndexHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = AttachmentStatusMapper::GetAttachmentStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = AttachmentStatusMapper::GetAttachmentStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode attachTimeNode = resultNode.FirstChild("attachTime");
     if(!attachTimeNode.IsNull())
     {
-      m_attachTime = DateTime(StringUtils::Trim(attachTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_attachTime = DateTime(attachTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_attachTimeHasBeenSet = true;
     }
     XmlNode deleteOnTerminationNode = resultNode.FirstChild("deleteOnTermination");
     if(!deleteOnTerminationNode.IsNull())
     {
-      m_deleteOnTermination = StringUtils::ConvertToBool(StringUtils::Trim(deleteOnTerminationNode.GetText().c_str()).c_str());
+      m_deleteOnTermination = StringUtils::ConvertToBool(deleteOnTerminationNode.GetTextView().Trim().ToString().c_str());
       m_deleteOnTerminationHasBeenSet = true;
     }
   }
@@ -97,7 +97,7 @@ void InstanceNetworkInterfaceAttachment::OutputToStream(Aws::OStream& oStream, c
 {
   if(m_attachmentIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AttachmentId=" << StringUtils::URLEncode(m_attachmentId.c_str()) << "&";
+      oStream << location << index << locationValue << ".AttachmentId=" << StringUtils::URLEncoded(m_attachmentId) << "&";
   }
 
   if(m_deviceIndexHasBeenSet)
@@ -112,7 +112,7 @@ void InstanceNetworkInterfaceAttachment::OutputToStream(Aws::OStream& oStream, c
 
   if(m_attachTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AttachTime=" << StringUtils::URLEncode(m_attachTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".AttachTime=" << StringUtils::URLEncoded(m_attachTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_deleteOnTerminationHasBeenSet)
@@ -126,7 +126,7 @@ void InstanceNetworkInterfaceAttachment::OutputToStream(Aws::OStream& oStream, c
 {
   if(m_attachmentIdHasBeenSet)
   {
-      oStream << location << ".AttachmentId=" << StringUtils::URLEncode(m_attachmentId.c_str()) << "&";
+      oStream << location << ".AttachmentId=" << StringUtils::URLEncoded(m_attachmentId) << "&";
   }
   if(m_deviceIndexHasBeenSet)
   {
@@ -138,7 +138,7 @@ void InstanceNetworkInterfaceAttachment::OutputToStream(Aws::OStream& oStream, c
   }
   if(m_attachTimeHasBeenSet)
   {
-      oStream << location << ".AttachTime=" << StringUtils::URLEncode(m_attachTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".AttachTime=" << StringUtils::URLEncoded(m_attachTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_deleteOnTerminationHasBeenSet)
   {
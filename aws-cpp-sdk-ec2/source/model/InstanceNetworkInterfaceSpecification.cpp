@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -75,31 +76,31 @@ InstanceNetworkInterfaceSpecification& InstanceNetworkInterfaceSpecification::op
     XmlNode networkInterfaceIdNode = resultNode.FirstChild("networkInterfaceId");
     if(!networkInterfaceIdNode.IsNull())
     {
-      m_networkInterfaceId = StringUtils::Trim(networkInterfaceIdNode.GetText().c_str());
+      m_networkInterfaceId = networkInterfaceIdNode.GetTextView().Trim().ToString();
       m_networkInterfaceIdHasBeenSet = true;
     }
     XmlNode deviceIndexNode = resultNode.FirstChild("deviceIndex");
     if(!deviceIndexNode.IsNull())
     {
-      m_deviceIndex = StringUtils::ConvertToInt32(StringUtils::Trim(deviceIndexNode.GetText().c_str()).c_str());
+      m_deviceIndex = StringUtils::ConvertToInt32(deviceIndexNode.GetTextView().Trim().ToString().c_str());
       m_deviceIndexHasBeenSet = true;
     }
     XmlNode subnetIdNode = resultNode.FirstChild("subnetId");
     if(!subnetIdNode.IsNull())
     {
-      m_subnetId = StringUtils::Trim(subnetIdNode.GetText().c_str());
+      m_subnetId = subnetIdNode.GetTextView().Trim().ToString();
       m_subnetIdHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode privateIpAddressNode = resultNode.FirstChild("privateIpAddress");
     if(!privateIpAddressNode.IsNull())
     {
-      m_privateIpAddress = StringUtils::Trim(privateIpAddressNode.GetText().c_str());
+      m_privateIpAddress = privateIpAddressNode.GetTextView().Trim().ToString();
       m_privateIpAddressHasBeenSet = true;
     }
     XmlNode groupsNode = resultNode.FirstChild("SecurityGroupId");
@@ -108,7 +109,7 @@ InstanceNetworkInterfaceSpecification& InstanceNetworkInterfaceSpecification::op
       XmlNode groupsMember = groupsNode.FirstChild("SecurityGroupId");
       while(!groupsMember.IsNull())
       {
-        m_groups.push_back(StringUtils::Trim(groupsMember.GetText().c_str()));
+        m_groups.push_back(groupsMember.GetTextView().Trim().ToString());
         groupsMember = groupsMember.NextNode("SecurityGroupId");
       }
 
@@ -117,7 +118,7 @@ InstanceNetworkInterfaceSpecification& InstanceNetworkInterfaceSpecification::op
     XmlNode deleteOnTerminationNode = resultNode.FirstChild("deleteOnTermination");
     if(!deleteOnTerminationNode.IsNull())
     {
-      m_deleteOnTermination = StringUtils::ConvertToBool(StringUtils::Trim(deleteOnTerminationNode.GetText().c_str()).c_str());
+      m_deleteOnTermination = StringUtils::ConvertToBool(deleteOnTerminationNode.GetTextView().Trim().ToString().c_str());
       m_deleteOnTerminationHasBeenSet = true;
     }
     XmlNode privateIpAddressesNode = resultNode.FirstChild("privateIpAddressesSet");
@@ -135,13 +136,13 @@ InstanceNetworkInterfaceSpecification& InstanceNetworkInterfaceSpecification::op
     XmlNode secondaryPrivateIpAddressCountNode = resultNode.FirstChild("secondaryPrivateIpAddressCount");
     if(!secondaryPrivateIpAddressCountNode.IsNull())
     {
-      m_secondaryPrivateIpAddressCount = StringUtils::ConvertToInt32(StringUtils::Trim(secondaryPrivateIpAddressCountNode.GetText().c_str()).c_str());
+      m_secondaryPrivateIpAddressCount = StringUtils::ConvertToInt32(secondaryPrivateIpAddressCountNode.GetTextView().Trim().ToString().c_str());
       m_secondaryPrivateIpAddressCountHasBeenSet = true;
     }
     XmlNode associatePublicIpAddressNode = resultNode.FirstChild("associatePublicIpAddress");
     if(!associatePublicIpAddressNode.IsNull())
     {
-      m_associatePublicIpAddress = StringUtils::ConvertToBool(StringUtils::Trim(associatePublicIpAddressNode.GetText().c_str()).c_str());
+      m_associatePublicIpAddress = StringUtils::ConvertToBool(associatePublicIpAddressNode.GetTextView().Trim().ToString().c_str());
       m_associatePublicIpAddressHasBeenSet = true;
     }
   }
@@ -153,7 +154,7 @@ void InstanceNetworkInterfaceSpecification::OutputToStream(Aws::OStream& oStream
 {
   if(m_networkInterfaceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
 
   if(m_deviceIndexHasBeenSet)
@@ -163,17 +164,17 @@ void InstanceNetworkInterfaceSpecification::OutputToStream(Aws::OStream& oStream
 
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
 
   if(m_groupsHasBeenSet)
@@ -181,7 +182,7 @@ void InstanceNetworkInterfaceSpecification::OutputToStream(Aws::OStream& oStream
       unsigned groupsIdx = 1;
       for(auto& item : m_groups)
       {
-        oStream << location << index << locationValue << ".SecurityGroupId." << groupsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".SecurityGroupId." << groupsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -195,9 +196,9 @@ void InstanceNetworkInterfaceSpecification::OutputToStream(Aws::OStream& oStream
       unsigned privateIpAddressesIdx = 1;
       for(auto& item : m_privateIpAddresses)
       {
-        Aws::StringStream privateIpAddressesSs;
+        Aws::Utils::Stream::StringOutputStream privateIpAddressesSs;
         privateIpAddressesSs << location << index << locationValue << ".PrivateIpAddressesSet." << privateIpAddressesIdx++;
-        item.OutputToStream(oStream, privateIpAddressesSs.str().c_str());
+        item.OutputToStream(oStream, privateIpAddressesSs.GetString().c_str());
       }
   }
 
@@ -217,7 +218,7 @@ void InstanceNetworkInterfaceSpecification::OutputToStream(Aws::OStream& oStream
 {
   if(m_networkInterfaceIdHasBeenSet)
   {
-      oStream << location << ".NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+      oStream << location << ".NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
   if(m_deviceIndexHasBeenSet)
   {
@@ -225,22 +226,22 @@ void InstanceNetworkInterfaceSpecification::OutputToStream(Aws::OStream& oStream
   }
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
   if(m_groupsHasBeenSet)
   {
       unsigned groupsIdx = 1;
       for(auto& item : m_groups)
       {
-        oStream << location << ".SecurityGroupId." << groupsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".SecurityGroupId." << groupsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_deleteOnTerminationHasBeenSet)
@@ -252,9 +253,9 @@ void InstanceNetworkInterfaceSpecification::OutputToStream(Aws::OStream& oStream
       unsigned privateIpAddressesIdx = 1;
       for(auto& item : m_privateIpAddresses)
       {
-        Aws::StringStream privateIpAddressesSs;
+        Aws::Utils::Stream::StringOutputStream privateIpAddressesSs;
         privateIpAddressesSs << location <<  ".item." << privateIpAddressesIdx++;
-        item.OutputToStream(oStream, privateIpAddressesSs.str().c_str());
+        item.OutputToStream(oStream, privateIpAddressesSs.GetString().c_str());
       }
   }
   if(m_secondaryPrivateIpAddressCountHasBeenSet)
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,7 +54,7 @@ InstanceStateChange& InstanceStateChange::operator =(const XmlNode& xmlNode)
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode currentStateNode = resultNode.FirstChild("currentState");
@@ -77,21 +78,21 @@ void InstanceStateChange::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_currentStateHasBeenSet)
   {
-      Aws::StringStream currentStateLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream currentStateLocationAndMemberSs;
       currentStateLocationAndMemberSs << location << index << locationValue << ".CurrentState";
-      m_currentState.OutputToStream(oStream, currentStateLocationAndMemberSs.str().c_str());
+      m_currentState.OutputToStream(oStream, currentStateLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_previousStateHasBeenSet)
   {
-      Aws::StringStream previousStateLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream previousStateLocationAndMemberSs;
       previousStateLocationAndMemberSs << location << index << locationValue << ".PreviousState";
-      m_previousState.OutputToStream(oStream, previousStateLocationAndMemberSs.str().c_str());
+      m_previousState.OutputToStream(oStream, previousStateLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -100,7 +101,7 @@ void InstanceStateChange::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_currentStateHasBeenSet)
   {
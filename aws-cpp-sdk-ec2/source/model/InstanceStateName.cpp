@@ -29,41 +29,41 @@ namespace Aws
       namespace InstanceStateNameMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int running_HASH = HashingUtils::HashString("running");
-        static const int shutting_down_HASH = HashingUtils::HashString("shutting-down");
-        static const int terminated_HASH = HashingUtils::HashString("terminated");
-        static const int stopping_HASH = HashingUtils::HashString("stopping");
-        static const int stopped_HASH = HashingUtils::HashString("stopped");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int pending_HASH = -682587753;
+        static const int running_HASH = 1550783935;
+        static const int shutting_down_HASH = 982230765;
+        static const int terminated_HASH = -1308815837;
+        static const int stopping_HASH = 1715648628;
+        static const int stopped_HASH = -1884319283;
 
 
         InstanceStateName GetInstanceStateNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          switch (hashCode)
           {
+          case pending_HASH:
             return InstanceStateName::pending;
-          }
-          else if (hashCode == running_HASH)
-          {
+          case running_HASH:
             return InstanceStateName::running;
-          }
-          else if (hashCode == shutting_down_HASH)
-          {
+          case shutting_down_HASH:
             return InstanceStateName::shutting_down;
-          }
-          else if (hashCode == terminated_HASH)
-          {
+          case terminated_HASH:
             return InstanceStateName::terminated;
-          }
-          else if (hashCode == stopping_HASH)
-          {
+          case stopping_HASH:
             return InstanceStateName::stopping;
-          }
-          else if (hashCode == stopped_HASH)
-          {
+          case stopped_HASH:
             return InstanceStateName::stopped;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
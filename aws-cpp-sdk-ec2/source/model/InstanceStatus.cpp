@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,13 +60,13 @@ InstanceStatus& InstanceStatus::operator =(const XmlNode& xmlNode)
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode availabilityZoneNode = resultNode.FirstChild("availabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode eventsNode = resultNode.FirstChild("eventsSet");
@@ -107,12 +108,12 @@ void InstanceStatus::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_eventsHasBeenSet)
@@ -120,31 +121,31 @@ void InstanceStatus::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned eventsIdx = 1;
       for(auto& item : m_events)
       {
-        Aws::StringStream eventsSs;
+        Aws::Utils::Stream::StringOutputStream eventsSs;
         eventsSs << location << index << locationValue << ".EventsSet." << eventsIdx++;
-        item.OutputToStream(oStream, eventsSs.str().c_str());
+        item.OutputToStream(oStream, eventsSs.GetString().c_str());
       }
   }
 
   if(m_instanceStateHasBeenSet)
   {
-      Aws::StringStream instanceStateLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream instanceStateLocationAndMemberSs;
       instanceStateLocationAndMemberSs << location << index << locationValue << ".InstanceState";
-      m_instanceState.OutputToStream(oStream, instanceStateLocationAndMemberSs.str().c_str());
+      m_instanceState.OutputToStream(oStream, instanceStateLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_systemStatusHasBeenSet)
   {
-      Aws::StringStream systemStatusLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream systemStatusLocationAndMemberSs;
       systemStatusLocationAndMemberSs << location << index << locationValue << ".SystemStatus";
-      m_systemStatus.OutputToStream(oStream, systemStatusLocationAndMemberSs.str().c_str());
+      m_systemStatus.OutputToStream(oStream, systemStatusLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_instanceStatusHasBeenSet)
   {
-      Aws::StringStream instanceStatusLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream instanceStatusLocationAndMemberSs;
       instanceStatusLocationAndMemberSs << location << index << locationValue << ".InstanceStatus";
-      m_instanceStatus.OutputToStream(oStream, instanceStatusLocationAndMemberSs.str().c_str());
+      m_instanceStatus.OutputToStream(oStream, instanceStatusLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -153,20 +154,20 @@ void InstanceStatus::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_eventsHasBeenSet)
   {
       unsigned eventsIdx = 1;
       for(auto& item : m_events)
       {
-        Aws::StringStream eventsSs;
+        Aws::Utils::Stream::StringOutputStream eventsSs;
         eventsSs << location <<  ".item." << eventsIdx++;
-        item.OutputToStream(oStream, eventsSs.str().c_str());
+        item.OutputToStream(oStream, eventsSs.GetString().c_str());
       }
   }
   if(m_instanceStateHasBeenSet)
@@ -53,19 +53,19 @@ InstanceStatusDetails& InstanceStatusDetails::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("name");
     if(!nameNode.IsNull())
     {
-      m_name = StatusNameMapper::GetStatusNameForName(StringUtils::Trim(nameNode.GetText().c_str()).c_str());
+      m_name = StatusNameMapper::GetStatusNameForName(nameNode.GetTextView().Trim().ToString().c_str());
       m_nameHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = StatusTypeMapper::GetStatusTypeForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = StatusTypeMapper::GetStatusTypeForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode impairedSinceNode = resultNode.FirstChild("impairedSince");
     if(!impairedSinceNode.IsNull())
     {
-      m_impairedSince = DateTime(StringUtils::Trim(impairedSinceNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_impairedSince = DateTime(impairedSinceNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_impairedSinceHasBeenSet = true;
     }
   }
@@ -87,7 +87,7 @@ void InstanceStatusDetails::OutputToStream(Aws::OStream& oStream, const char* lo
 
   if(m_impairedSinceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ImpairedSince=" << StringUtils::URLEncode(m_impairedSince.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".ImpairedSince=" << StringUtils::URLEncoded(m_impairedSince.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -104,7 +104,7 @@ void InstanceStatusDetails::OutputToStream(Aws::OStream& oStream, const char* lo
   }
   if(m_impairedSinceHasBeenSet)
   {
-      oStream << location << ".ImpairedSince=" << StringUtils::URLEncode(m_impairedSince.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".ImpairedSince=" << StringUtils::URLEncoded(m_impairedSince.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
@@ -55,25 +55,25 @@ InstanceStatusEvent& InstanceStatusEvent::operator =(const XmlNode& xmlNode)
     XmlNode codeNode = resultNode.FirstChild("code");
     if(!codeNode.IsNull())
     {
-      m_code = EventCodeMapper::GetEventCodeForName(StringUtils::Trim(codeNode.GetText().c_str()).c_str());
+      m_code = EventCodeMapper::GetEventCodeForName(codeNode.GetTextView().Trim().ToString().c_str());
       m_codeHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode notBeforeNode = resultNode.FirstChild("notBefore");
     if(!notBeforeNode.IsNull())
     {
-      m_notBefore = DateTime(StringUtils::Trim(notBeforeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_notBefore = DateTime(notBeforeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_notBeforeHasBeenSet = true;
     }
     XmlNode notAfterNode = resultNode.FirstChild("notAfter");
     if(!notAfterNode.IsNull())
     {
-      m_notAfter = DateTime(StringUtils::Trim(notAfterNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_notAfter = DateTime(notAfterNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_notAfterHasBeenSet = true;
     }
   }
@@ -90,17 +90,17 @@ void InstanceStatusEvent::OutputToStream(Aws::OStream& oStream, const char* loca
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_notBeforeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NotBefore=" << StringUtils::URLEncode(m_notBefore.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".NotBefore=" << StringUtils::URLEncoded(m_notBefore.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_notAfterHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NotAfter=" << StringUtils::URLEncode(m_notAfter.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".NotAfter=" << StringUtils::URLEncoded(m_notAfter.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -113,15 +113,15 @@ void InstanceStatusEvent::OutputToStream(Aws::OStream& oStream, const char* loca
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_notBeforeHasBeenSet)
   {
-      oStream << location << ".NotBefore=" << StringUtils::URLEncode(m_notBefore.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".NotBefore=" << StringUtils::URLEncoded(m_notBefore.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_notAfterHasBeenSet)
   {
-      oStream << location << ".NotAfter=" << StringUtils::URLEncode(m_notAfter.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".NotAfter=" << StringUtils::URLEncoded(m_notAfter.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ InstanceStatusSummary& InstanceStatusSummary::operator =(const XmlNode& xmlNode)
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = SummaryStatusMapper::GetSummaryStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = SummaryStatusMapper::GetSummaryStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode detailsNode = resultNode.FirstChild("details");
@@ -83,9 +84,9 @@ void InstanceStatusSummary::OutputToStream(Aws::OStream& oStream, const char* lo
       unsigned detailsIdx = 1;
       for(auto& item : m_details)
       {
-        Aws::StringStream detailsSs;
+        Aws::Utils::Stream::StringOutputStream detailsSs;
         detailsSs << location << index << locationValue << ".Details." << detailsIdx++;
-        item.OutputToStream(oStream, detailsSs.str().c_str());
+        item.OutputToStream(oStream, detailsSs.GetString().c_str());
       }
   }
 
@@ -102,9 +103,9 @@ void InstanceStatusSummary::OutputToStream(Aws::OStream& oStream, const char* lo
       unsigned detailsIdx = 1;
       for(auto& item : m_details)
       {
-        Aws::StringStream detailsSs;
+        Aws::Utils::Stream::StringOutputStream detailsSs;
         detailsSs << location <<  ".item." << detailsIdx++;
-        item.OutputToStream(oStream, detailsSs.str().c_str());
+        item.OutputToStream(oStream, detailsSs.GetString().c_str());
       }
   }
 }
@@ -29,306 +29,200 @@ namespace Aws
       namespace InstanceTypeMapper
       {
 
-        static const int t1_micro_HASH = HashingUtils::HashString("t1.micro");
-        static const int m1_small_HASH = HashingUtils::HashString("m1.small");
-        static const int m1_medium_HASH = HashingUtils::HashString("m1.medium");
-        static const int m1_large_HASH = HashingUtils::HashString("m1.large");
-        static const int m1_xlarge_HASH = HashingUtils::HashString("m1.xlarge");
-        static const int m3_medium_HASH = HashingUtils::HashString("m3.medium");
-        static const int m3_large_HASH = HashingUtils::HashString("m3.large");
-        static const int m3_xlarge_HASH = HashingUtils::HashString("m3.xlarge");
-        static const int m3_2xlarge_HASH = HashingUtils::HashString("m3.2xlarge");
-        static const int m4_large_HASH = HashingUtils::HashString("m4.large");
-        static const int m4_xlarge_HASH = HashingUtils::HashString("m4.xlarge");
-        static const int m4_2xlarge_HASH = HashingUtils::HashString("m4.2xlarge");
-        static const int m4_4xlarge_HASH = HashingUtils::HashString("m4.4xlarge");
-        static const int m4_10xlarge_HASH = HashingUtils::HashString("m4.10xlarge");
-        static const int t2_nano_HASH = HashingUtils::HashString("t2.nano");
-        static const int t2_micro_HASH = HashingUtils::HashString("t2.micro");
-        static const int t2_small_HASH = HashingUtils::HashString("t2.small");
-        static const int t2_medium_HASH = HashingUtils::HashString("t2.medium");
-        static const int t2_large_HASH = HashingUtils::HashString("t2.large");
-        static const int m2_xlarge_HASH = HashingUtils::HashString("m2.xlarge");
-        static const int m2_2xlarge_HASH = HashingUtils::HashString("m2.2xlarge");
-        static const int m2_4xlarge_HASH = HashingUtils::HashString("m2.4xlarge");
-        static const int cr1_8xlarge_HASH = HashingUtils::HashString("cr1.8xlarge");
-        static const int x1_4xlarge_HASH = HashingUtils::HashString("x1.4xlarge");
-        static const int x1_8xlarge_HASH = HashingUtils::HashString("x1.8xlarge");
-        static const int x1_16xlarge_HASH = HashingUtils::HashString("x1.16xlarge");
-        static const int x1_32xlarge_HASH = HashingUtils::HashString("x1.32xlarge");
-        static const int i2_xlarge_HASH = HashingUtils::HashString("i2.xlarge");
-        static const int i2_2xlarge_HASH = HashingUtils::HashString("i2.2xlarge");
-        static const int i2_4xlarge_HASH = HashingUtils::HashString("i2.4xlarge");
-        static const int i2_8xlarge_HASH = HashingUtils::HashString("i2.8xlarge");
-        static const int hi1_4xlarge_HASH = HashingUtils::HashString("hi1.4xlarge");
-        static const int hs1_8xlarge_HASH = HashingUtils::HashString("hs1.8xlarge");
-        static const int c1_medium_HASH = HashingUtils::HashString("c1.medium");
-        static const int c1_xlarge_HASH = HashingUtils::HashString("c1.xlarge");
-        static const int c3_large_HASH = HashingUtils::HashString("c3.large");
-        static const int c3_xlarge_HASH = HashingUtils::HashString("c3.xlarge");
-        static const int c3_2xlarge_HASH = HashingUtils::HashString("c3.2xlarge");
-        static const int c3_4xlarge_HASH = HashingUtils::HashString("c3.4xlarge");
-        static const int c3_8xlarge_HASH = HashingUtils::HashString("c3.8xlarge");
-        static const int c4_large_HASH = HashingUtils::HashString("c4.large");
-        static const int c4_xlarge_HASH = HashingUtils::HashString("c4.xlarge");
-        static const int c4_2xlarge_HASH = HashingUtils::HashString("c4.2xlarge");
-        static const int c4_4xlarge_HASH = HashingUtils::HashString("c4.4xlarge");
-        static const int c4_8xlarge_HASH = HashingUtils::HashString("c4.8xlarge");
-        static const int cc1_4xlarge_HASH = HashingUtils::HashString("cc1.4xlarge");
-        static const int cc2_8xlarge_HASH = HashingUtils::HashString("cc2.8xlarge");
-        static const int g2_2xlarge_HASH = HashingUtils::HashString("g2.2xlarge");
-        static const int g2_8xlarge_HASH = HashingUtils::HashString("g2.8xlarge");
-        static const int cg1_4xlarge_HASH = HashingUtils::HashString("cg1.4xlarge");
-        static const int r3_large_HASH = HashingUtils::HashString("r3.large");
-        static const int r3_xlarge_HASH = HashingUtils::HashString("r3.xlarge");
-        static const int r3_2xlarge_HASH = HashingUtils::HashString("r3.2xlarge");
-        static const int r3_4xlarge_HASH = HashingUtils::HashString("r3.4xlarge");
-        static const int r3_8xlarge_HASH = HashingUtils::HashString("r3.8xlarge");
-        static const int d2_xlarge_HASH = HashingUtils::HashString("d2.xlarge");
-        static const int d2_2xlarge_HASH = HashingUtils::HashString("d2.2xlarge");
-        static const int d2_4xlarge_HASH = HashingUtils::HashString("d2.4xlarge");
-        static const int d2_8xlarge_HASH = HashingUtils::HashString("d2.8xlarge");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int t1_micro_HASH = -2033592365;
+        static const int m1_small_HASH = -1342704643;
+        static const int m1_medium_HASH = 1146752831;
+        static const int m1_large_HASH = -1349510607;
+        static const int m1_xlarge_HASH = 1468056973;
+        static const int m3_medium_HASH = 337406205;
+        static const int m3_large_HASH = 425496755;
+        static const int m3_xlarge_HASH = 658710347;
+        static const int m3_2xlarge_HASH = 1597648877;
+        static const int m4_large_HASH = 1313000436;
+        static const int m4_xlarge_HASH = -1893446614;
+        static const int m4_2xlarge_HASH = -209805586;
+        static const int m4_4xlarge_HASH = 1565201776;
+        static const int m4_10xlarge_HASH = 1220608329;
+        static const int t2_nano_HASH = 1348525156;
+        static const int t2_micro_HASH = -1146088684;
+        static const int t2_small_HASH = -1140430505;
+        static const int t2_medium_HASH = -1172683483;
+        static const int t2_large_HASH = -1147236469;
+        static const int m2_xlarge_HASH = -1084099988;
+        static const int m2_2xlarge_HASH = -889863956;
+        static const int m2_4xlarge_HASH = 885143406;
+        static const int cr1_8xlarge_HASH = -839447633;
+        static const int x1_4xlarge_HASH = 530949314;
+        static const int x1_8xlarge_HASH = -214003258;
+        static const int x1_16xlarge_HASH = 253607869;
+        static const int x1_32xlarge_HASH = 189213815;
+        static const int i2_xlarge_HASH = 1850750568;
+        static const int i2_2xlarge_HASH = -103809936;
+        static const int i2_4xlarge_HASH = 1671197426;
+        static const int i2_8xlarge_HASH = 926244854;
+        static const int hi1_4xlarge_HASH = 1279304281;
+        static const int hs1_8xlarge_HASH = -1430783341;
+        static const int c1_medium_HASH = 2041428277;
+        static const int c1_xlarge_HASH = -1932234877;
+        static const int c3_large_HASH = 177262589;
+        static const int c3_xlarge_HASH = 1553385793;
+        static const int c3_2xlarge_HASH = -732183369;
+        static const int c3_4xlarge_HASH = 1042823993;
+        static const int c3_8xlarge_HASH = 297871421;
+        static const int c4_large_HASH = 1064766270;
+        static const int c4_xlarge_HASH = -998771168;
+        static const int c4_2xlarge_HASH = 1755329464;
+        static const int c4_4xlarge_HASH = -764630470;
+        static const int c4_8xlarge_HASH = -1509583042;
+        static const int cc1_4xlarge_HASH = -1441759782;
+        static const int cc2_8xlarge_HASH = 300800479;
+        static const int g2_2xlarge_HASH = 289217074;
+        static const int g2_8xlarge_HASH = 1319271864;
+        static const int cg1_4xlarge_HASH = 2067153494;
+        static const int r3_large_HASH = 549613838;
+        static const int r3_xlarge_HASH = 211372624;
+        static const int r3_2xlarge_HASH = 615081352;
+        static const int r3_4xlarge_HASH = -1904878582;
+        static const int r3_8xlarge_HASH = 1645136142;
+        static const int d2_xlarge_HASH = -1996879005;
+        static const int d2_2xlarge_HASH = 878757589;
+        static const int d2_4xlarge_HASH = -1641202345;
+        static const int d2_8xlarge_HASH = 1908812379;
 
 
         InstanceType GetInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == t1_micro_HASH)
+          switch (hashCode)
           {
+          case t1_micro_HASH:
             return InstanceType::t1_micro;
-          }
-          else if (hashCode == m1_small_HASH)
-          {
+          case m1_small_HASH:
             return InstanceType::m1_small;
-          }
-          else if (hashCode == m1_medium_HASH)
-          {
+          case m1_medium_HASH:
             return InstanceType::m1_medium;
-          }
-          else if (hashCode == m1_large_HASH)
-          {
+          case m1_large_HASH:
             return InstanceType::m1_large;
-          }
-          else if (hashCode == m1_xlarge_HASH)
-          {
+          case m1_xlarge_HASH:
             return InstanceType::m1_xlarge;
-          }
-          else if (hashCode == m3_medium_HASH)
-          {
+          case m3_medium_HASH:
             return InstanceType::m3_medium;
-          }
-          else if (hashCode == m3_large_HASH)
-          {
+          case m3_large_HASH:
             return InstanceType::m3_large;
-          }
-          else if (hashCode == m3_xlarge_HASH)
-          {
+          case m3_xlarge_HASH:
             return InstanceType::m3_xlarge;
-          }
-          else if (hashCode == m3_2xlarge_HASH)
-          {
+          case m3_2xlarge_HASH:
             return InstanceType::m3_2xlarge;
-          }
-          else if (hashCode == m4_large_HASH)
-          {
+          case m4_large_HASH:
             return InstanceType::m4_large;
-          }
-          else if (hashCode == m4_xlarge_HASH)
-          {
+          case m4_xlarge_HASH:
             return InstanceType::m4_xlarge;
-          }
-          else if (hashCode == m4_2xlarge_HASH)
-          {
+          case m4_2xlarge_HASH:
             return InstanceType::m4_2xlarge;
-          }
-          else if (hashCode == m4_4xlarge_HASH)
-          {
+          case m4_4xlarge_HASH:
             return InstanceType::m4_4xlarge;
-          }
-          else if (hashCode == m4_10xlarge_HASH)
-          {
+          case m4_10xlarge_HASH:
             return InstanceType::m4_10xlarge;
-          }
-          else if (hashCode == t2_nano_HASH)
-          {
+          case t2_nano_HASH:
             return InstanceType::t2_nano;
-          }
-          else if (hashCode == t2_micro_HASH)
-          {
+          case t2_micro_HASH:
             return InstanceType::t2_micro;
-          }
-          else if (hashCode == t2_small_HASH)
-          {
+          case t2_small_HASH:
             return InstanceType::t2_small;
-          }
-          else if (hashCode == t2_medium_HASH)
-          {
+          case t2_medium_HASH:
             return InstanceType::t2_medium;
-          }
-          else if (hashCode == t2_large_HASH)
-          {
+          case t2_large_HASH:
             return InstanceType::t2_large;
-          }
-          else if (hashCode == m2_xlarge_HASH)
-          {
+          case m2_xlarge_HASH:
             return InstanceType::m2_xlarge;
-          }
-          else if (hashCode == m2_2xlarge_HASH)
-          {
+          case m2_2xlarge_HASH:
             return InstanceType::m2_2xlarge;
-          }
-          else if (hashCode == m2_4xlarge_HASH)
-          {
+          case m2_4xlarge_HASH:
             return InstanceType::m2_4xlarge;
-          }
-          else if (hashCode == cr1_8xlarge_HASH)
-          {
+          case cr1_8xlarge_HASH:
             return InstanceType::cr1_8xlarge;
-          }
-          else if (hashCode == x1_4xlarge_HASH)
-          {
+          case x1_4xlarge_HASH:
             return InstanceType::x1_4xlarge;
-          }
-          else if (hashCode == x1_8xlarge_HASH)
-          {
+          case x1_8xlarge_HASH:
             return InstanceType::x1_8xlarge;
-          }
-          else if (hashCode == x1_16xlarge_HASH)
-          {
+          case x1_16xlarge_HASH:
             return InstanceType::x1_16xlarge;
-          }
-          else if (hashCode == x1_32xlarge_HASH)
-          {
+          case x1_32xlarge_HASH:
             return InstanceType::x1_32xlarge;
-          }
-          else if (hashCode == i2_xlarge_HASH)
-          {
+          case i2_xlarge_HASH:
             return InstanceType::i2_xlarge;
-          }
-          else if (hashCode == i2_2xlarge_HASH)
-          {
+          case i2_2xlarge_HASH:
             return InstanceType::i2_2xlarge;
-          }
-          else if (hashCode == i2_4xlarge_HASH)
-          {
+          case i2_4xlarge_HASH:
             return InstanceType::i2_4xlarge;
-          }
-          else if (hashCode == i2_8xlarge_HASH)
-          {
+          case i2_8xlarge_HASH:
             return InstanceType::i2_8xlarge;
-          }
-          else if (hashCode == hi1_4xlarge_HASH)
-          {
+          case hi1_4xlarge_HASH:
             return InstanceType::hi1_4xlarge;
-          }
-          else if (hashCode == hs1_8xlarge_HASH)
-          {
+          case hs1_8xlarge_HASH:
             return InstanceType::hs1_8xlarge;
-          }
-          else if (hashCode == c1_medium_HASH)
-          {
+          case c1_medium_HASH:
             return InstanceType::c1_medium;
-          }
-          else if (hashCode == c1_xlarge_HASH)
-          {
+          case c1_xlarge_HASH:
             return InstanceType::c1_xlarge;
-          }
-          else if (hashCode == c3_large_HASH)
-          {
+          case c3_large_HASH:
             return InstanceType::c3_large;
-          }
-          else if (hashCode == c3_xlarge_HASH)
-          {
+          case c3_xlarge_HASH:
             return InstanceType::c3_xlarge;
-          }
-          else if (hashCode == c3_2xlarge_HASH)
-          {
+          case c3_2xlarge_HASH:
             return InstanceType::c3_2xlarge;
-          }
-          else if (hashCode == c3_4xlarge_HASH)
-          {
+          case c3_4xlarge_HASH:
             return InstanceType::c3_4xlarge;
-          }
-          else if (hashCode == c3_8xlarge_HASH)
-          {
+          case c3_8xlarge_HASH:
             return InstanceType::c3_8xlarge;
-          }
-          else if (hashCode == c4_large_HASH)
-          {
+          case c4_large_HASH:
             return InstanceType::c4_large;
-          }
-          else if (hashCode == c4_xlarge_HASH)
-          {
+          case c4_xlarge_HASH:
             return InstanceType::c4_xlarge;
-          }
-          else if (hashCode == c4_2xlarge_HASH)
-          {
+          case c4_2xlarge_HASH:
             return InstanceType::c4_2xlarge;
-          }
-          else if (hashCode == c4_4xlarge_HASH)
-          {
+          case c4_4xlarge_HASH:
             return InstanceType::c4_4xlarge;
-          }
-          else if (hashCode == c4_8xlarge_HASH)
-          {
+          case c4_8xlarge_HASH:
             return InstanceType::c4_8xlarge;
-          }
-          else if (hashCode == cc1_4xlarge_HASH)
-          {
+          case cc1_4xlarge_HASH:
             return InstanceType::cc1_4xlarge;
-          }
-          else if (hashCode == cc2_8xlarge_HASH)
-          {
+          case cc2_8xlarge_HASH:
             return InstanceType::cc2_8xlarge;
-          }
-          else if (hashCode == g2_2xlarge_HASH)
-          {
+          case g2_2xlarge_HASH:
             return InstanceType::g2_2xlarge;
-          }
-          else if (hashCode == g2_8xlarge_HASH)
-          {
+          case g2_8xlarge_HASH:
             return InstanceType::g2_8xlarge;
-          }
-          else if (hashCode == cg1_4xlarge_HASH)
-          {
+          case cg1_4xlarge_HASH:
             return InstanceType::cg1_4xlarge;
-          }
-          else if (hashCode == r3_large_HASH)
-          {
+          case r3_large_HASH:
             return InstanceType::r3_large;
-          }
-          else if (hashCode == r3_xlarge_HASH)
-          {
+          case r3_xlarge_HASH:
             return InstanceType::r3_xlarge;
-          }
-          else if (hashCode == r3_2xlarge_HASH)
-          {
+          case r3_2xlarge_HASH:
             return InstanceType::r3_2xlarge;
-          }
-          else if (hashCode == r3_4xlarge_HASH)
-          {
+          case r3_4xlarge_HASH:
             return InstanceType::r3_4xlarge;
-          }
-          else if (hashCode == r3_8xlarge_HASH)
-          {
+          case r3_8xlarge_HASH:
             return InstanceType::r3_8xlarge;
-          }
-          else if (hashCode == d2_xlarge_HASH)
-          {
+          case d2_xlarge_HASH:
             return InstanceType::d2_xlarge;
-          }
-          else if (hashCode == d2_2xlarge_HASH)
-          {
+          case d2_2xlarge_HASH:
             return InstanceType::d2_2xlarge;
-          }
-          else if (hashCode == d2_4xlarge_HASH)
-          {
+          case d2_4xlarge_HASH:
             return InstanceType::d2_4xlarge;
-          }
-          else if (hashCode == d2_8xlarge_HASH)
-          {
+          case d2_8xlarge_HASH:
             return InstanceType::d2_8xlarge;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
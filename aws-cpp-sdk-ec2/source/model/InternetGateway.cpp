@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,7 +54,7 @@ InternetGateway& InternetGateway::operator =(const XmlNode& xmlNode)
     XmlNode internetGatewayIdNode = resultNode.FirstChild("internetGatewayId");
     if(!internetGatewayIdNode.IsNull())
     {
-      m_internetGatewayId = StringUtils::Trim(internetGatewayIdNode.GetText().c_str());
+      m_internetGatewayId = internetGatewayIdNode.GetTextView().Trim().ToString();
       m_internetGatewayIdHasBeenSet = true;
     }
     XmlNode attachmentsNode = resultNode.FirstChild("attachmentSet");
@@ -89,7 +90,7 @@ void InternetGateway::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_internetGatewayIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InternetGatewayId=" << StringUtils::URLEncode(m_internetGatewayId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InternetGatewayId=" << StringUtils::URLEncoded(m_internetGatewayId) << "&";
   }
 
   if(m_attachmentsHasBeenSet)
@@ -97,9 +98,9 @@ void InternetGateway::OutputToStream(Aws::OStream& oStream, const char* location
       unsigned attachmentsIdx = 1;
       for(auto& item : m_attachments)
       {
-        Aws::StringStream attachmentsSs;
+        Aws::Utils::Stream::StringOutputStream attachmentsSs;
         attachmentsSs << location << index << locationValue << ".AttachmentSet." << attachmentsIdx++;
-        item.OutputToStream(oStream, attachmentsSs.str().c_str());
+        item.OutputToStream(oStream, attachmentsSs.GetString().c_str());
       }
   }
 
@@ -108,9 +109,9 @@ void InternetGateway::OutputToStream(Aws::OStream& oStream, const char* location
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -120,16 +121,16 @@ void InternetGateway::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_internetGatewayIdHasBeenSet)
   {
-      oStream << location << ".InternetGatewayId=" << StringUtils::URLEncode(m_internetGatewayId.c_str()) << "&";
+      oStream << location << ".InternetGatewayId=" << StringUtils::URLEncoded(m_internetGatewayId) << "&";
   }
   if(m_attachmentsHasBeenSet)
   {
       unsigned attachmentsIdx = 1;
       for(auto& item : m_attachments)
       {
-        Aws::StringStream attachmentsSs;
+        Aws::Utils::Stream::StringOutputStream attachmentsSs;
         attachmentsSs << location <<  ".item." << attachmentsIdx++;
-        item.OutputToStream(oStream, attachmentsSs.str().c_str());
+        item.OutputToStream(oStream, attachmentsSs.GetString().c_str());
       }
   }
   if(m_tagsHasBeenSet)
@@ -137,9 +138,9 @@ void InternetGateway::OutputToStream(Aws::OStream& oStream, const char* location
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
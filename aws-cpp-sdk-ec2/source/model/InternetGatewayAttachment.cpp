@@ -51,13 +51,13 @@ InternetGatewayAttachment& InternetGatewayAttachment::operator =(const XmlNode&
     XmlNode vpcIdNode = resultNode.FirstChild("vpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = AttachmentStatusMapper::GetAttachmentStatusForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = AttachmentStatusMapper::GetAttachmentStatusForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
   }
@@ -69,7 +69,7 @@ void InternetGatewayAttachment::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_stateHasBeenSet)
@@ -83,7 +83,7 @@ void InternetGatewayAttachment::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_stateHasBeenSet)
   {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -63,19 +64,19 @@ IpPermission& IpPermission::operator =(const XmlNode& xmlNode)
     XmlNode ipProtocolNode = resultNode.FirstChild("ipProtocol");
     if(!ipProtocolNode.IsNull())
     {
-      m_ipProtocol = StringUtils::Trim(ipProtocolNode.GetText().c_str());
+      m_ipProtocol = ipProtocolNode.GetTextView().Trim().ToString();
       m_ipProtocolHasBeenSet = true;
     }
     XmlNode fromPortNode = resultNode.FirstChild("fromPort");
     if(!fromPortNode.IsNull())
     {
-      m_fromPort = StringUtils::ConvertToInt32(StringUtils::Trim(fromPortNode.GetText().c_str()).c_str());
+      m_fromPort = StringUtils::ConvertToInt32(fromPortNode.GetTextView().Trim().ToString().c_str());
       m_fromPortHasBeenSet = true;
     }
     XmlNode toPortNode = resultNode.FirstChild("toPort");
     if(!toPortNode.IsNull())
     {
-      m_toPort = StringUtils::ConvertToInt32(StringUtils::Trim(toPortNode.GetText().c_str()).c_str());
+      m_toPort = StringUtils::ConvertToInt32(toPortNode.GetTextView().Trim().ToString().c_str());
       m_toPortHasBeenSet = true;
     }
     XmlNode userIdGroupPairsNode = resultNode.FirstChild("groups");
@@ -123,7 +124,7 @@ void IpPermission::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_ipProtocolHasBeenSet)
   {
-      oStream << location << index << locationValue << ".IpProtocol=" << StringUtils::URLEncode(m_ipProtocol.c_str()) << "&";
+      oStream << location << index << locationValue << ".IpProtocol=" << StringUtils::URLEncoded(m_ipProtocol) << "&";
   }
 
   if(m_fromPortHasBeenSet)
@@ -141,9 +142,9 @@ void IpPermission::OutputToStream(Aws::OStream& oStream, const char* location, u
       unsigned userIdGroupPairsIdx = 1;
       for(auto& item : m_userIdGroupPairs)
       {
-        Aws::StringStream userIdGroupPairsSs;
+        Aws::Utils::Stream::StringOutputStream userIdGroupPairsSs;
         userIdGroupPairsSs << location << index << locationValue << ".Groups." << userIdGroupPairsIdx++;
-        item.OutputToStream(oStream, userIdGroupPairsSs.str().c_str());
+        item.OutputToStream(oStream, userIdGroupPairsSs.GetString().c_str());
       }
   }
 
@@ -152,9 +153,9 @@ void IpPermission::OutputToStream(Aws::OStream& oStream, const char* location, u
       unsigned ipRangesIdx = 1;
       for(auto& item : m_ipRanges)
       {
-        Aws::StringStream ipRangesSs;
+        Aws::Utils::Stream::StringOutputStream ipRangesSs;
         ipRangesSs << location << index << locationValue << ".IpRanges." << ipRangesIdx++;
-        item.OutputToStream(oStream, ipRangesSs.str().c_str());
+        item.OutputToStream(oStream, ipRangesSs.GetString().c_str());
       }
   }
 
@@ -163,9 +164,9 @@ void IpPermission::OutputToStream(Aws::OStream& oStream, const char* location, u
       unsigned prefixListIdsIdx = 1;
       for(auto& item : m_prefixListIds)
       {
-        Aws::StringStream prefixListIdsSs;
+        Aws::Utils::Stream::StringOutputStream prefixListIdsSs;
         prefixListIdsSs << location << index << locationValue << ".PrefixListIds." << prefixListIdsIdx++;
-        item.OutputToStream(oStream, prefixListIdsSs.str().c_str());
+        item.OutputToStream(oStream, prefixListIdsSs.GetString().c_str());
       }
   }
 
@@ -175,7 +176,7 @@ void IpPermission::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_ipProtocolHasBeenSet)
   {
-      oStream << location << ".IpProtocol=" << StringUtils::URLEncode(m_ipProtocol.c_str()) << "&";
+      oStream << location << ".IpProtocol=" << StringUtils::URLEncoded(m_ipProtocol) << "&";
   }
   if(m_fromPortHasBeenSet)
   {
@@ -190,9 +191,9 @@ void IpPermission::OutputToStream(Aws::OStream& oStream, const char* location) c
       unsigned userIdGroupPairsIdx = 1;
       for(auto& item : m_userIdGroupPairs)
       {
-        Aws::StringStream userIdGroupPairsSs;
+        Aws::Utils::Stream::StringOutputStream userIdGroupPairsSs;
         userIdGroupPairsSs << location <<  ".item." << userIdGroupPairsIdx++;
-        item.OutputToStream(oStream, userIdGroupPairsSs.str().c_str());
+        item.OutputToStream(oStream, userIdGroupPairsSs.GetString().c_str());
       }
   }
   if(m_ipRangesHasBeenSet)
@@ -200,9 +201,9 @@ void IpPermission::OutputToStream(Aws::OStream& oStream, const char* location) c
       unsigned ipRangesIdx = 1;
       for(auto& item : m_ipRanges)
       {
-        Aws::StringStream ipRangesSs;
+        Aws::Utils::Stream::StringOutputStream ipRangesSs;
         ipRangesSs << location <<  ".item." << ipRangesIdx++;
-        item.OutputToStream(oStream, ipRangesSs.str().c_str());
+        item.OutputToStream(oStream, ipRangesSs.GetString().c_str());
       }
   }
   if(m_prefixListIdsHasBeenSet)
@@ -210,9 +211,9 @@ void IpPermission::OutputToStream(Aws::OStream& oStream, const char* location) c
       unsigned prefixListIdsIdx = 1;
       for(auto& item : m_prefixListIds)
       {
-        Aws::StringStream prefixListIdsSs;
+        Aws::Utils::Stream::StringOutputStream prefixListIdsSs;
         prefixListIdsSs << location <<  ".item." << prefixListIdsIdx++;
-        item.OutputToStream(oStream, prefixListIdsSs.str().c_str());
+        item.OutputToStream(oStream, prefixListIdsSs.GetString().c_str());
       }
   }
 }
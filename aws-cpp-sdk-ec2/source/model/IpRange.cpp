@@ -49,7 +49,7 @@ IpRange& IpRange::operator =(const XmlNode& xmlNode)
     XmlNode cidrIpNode = resultNode.FirstChild("cidrIp");
     if(!cidrIpNode.IsNull())
     {
-      m_cidrIp = StringUtils::Trim(cidrIpNode.GetText().c_str());
+      m_cidrIp = cidrIpNode.GetTextView().Trim().ToString();
       m_cidrIpHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void IpRange::OutputToStream(Aws::OStream& oStream, const char* location, unsign
 {
   if(m_cidrIpHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CidrIp=" << StringUtils::URLEncode(m_cidrIp.c_str()) << "&";
+      oStream << location << index << locationValue << ".CidrIp=" << StringUtils::URLEncoded(m_cidrIp) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void IpRange::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_cidrIpHasBeenSet)
   {
-      oStream << location << ".CidrIp=" << StringUtils::URLEncode(m_cidrIp.c_str()) << "&";
+      oStream << location << ".CidrIp=" << StringUtils::URLEncoded(m_cidrIp) << "&";
   }
 }
 
@@ -51,13 +51,13 @@ KeyPairInfo& KeyPairInfo::operator =(const XmlNode& xmlNode)
     XmlNode keyNameNode = resultNode.FirstChild("keyName");
     if(!keyNameNode.IsNull())
     {
-      m_keyName = StringUtils::Trim(keyNameNode.GetText().c_str());
+      m_keyName = keyNameNode.GetTextView().Trim().ToString();
       m_keyNameHasBeenSet = true;
     }
     XmlNode keyFingerprintNode = resultNode.FirstChild("keyFingerprint");
     if(!keyFingerprintNode.IsNull())
     {
-      m_keyFingerprint = StringUtils::Trim(keyFingerprintNode.GetText().c_str());
+      m_keyFingerprint = keyFingerprintNode.GetTextView().Trim().ToString();
       m_keyFingerprintHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void KeyPairInfo::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_keyNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+      oStream << location << index << locationValue << ".KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
 
   if(m_keyFingerprintHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KeyFingerprint=" << StringUtils::URLEncode(m_keyFingerprint.c_str()) << "&";
+      oStream << location << index << locationValue << ".KeyFingerprint=" << StringUtils::URLEncoded(m_keyFingerprint) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void KeyPairInfo::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_keyNameHasBeenSet)
   {
-      oStream << location << ".KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+      oStream << location << ".KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
   if(m_keyFingerprintHasBeenSet)
   {
-      oStream << location << ".KeyFingerprint=" << StringUtils::URLEncode(m_keyFingerprint.c_str()) << "&";
+      oStream << location << ".KeyFingerprint=" << StringUtils::URLEncoded(m_keyFingerprint) << "&";
   }
 }
 
@@ -51,13 +51,13 @@ LaunchPermission& LaunchPermission::operator =(const XmlNode& xmlNode)
     XmlNode userIdNode = resultNode.FirstChild("userId");
     if(!userIdNode.IsNull())
     {
-      m_userId = StringUtils::Trim(userIdNode.GetText().c_str());
+      m_userId = userIdNode.GetTextView().Trim().ToString();
       m_userIdHasBeenSet = true;
     }
     XmlNode groupNode = resultNode.FirstChild("group");
     if(!groupNode.IsNull())
     {
-      m_group = PermissionGroupMapper::GetPermissionGroupForName(StringUtils::Trim(groupNode.GetText().c_str()).c_str());
+      m_group = PermissionGroupMapper::GetPermissionGroupForName(groupNode.GetTextView().Trim().ToString().c_str());
       m_groupHasBeenSet = true;
     }
   }
@@ -69,7 +69,7 @@ void LaunchPermission::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_userIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UserId=" << StringUtils::URLEncode(m_userId.c_str()) << "&";
+      oStream << location << index << locationValue << ".UserId=" << StringUtils::URLEncoded(m_userId) << "&";
   }
 
   if(m_groupHasBeenSet)
@@ -83,7 +83,7 @@ void LaunchPermission::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_userIdHasBeenSet)
   {
-      oStream << location << ".UserId=" << StringUtils::URLEncode(m_userId.c_str()) << "&";
+      oStream << location << ".UserId=" << StringUtils::URLEncoded(m_userId) << "&";
   }
   if(m_groupHasBeenSet)
   {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -84,9 +85,9 @@ void LaunchPermissionModifications::OutputToStream(Aws::OStream& oStream, const
       unsigned addIdx = 1;
       for(auto& item : m_add)
       {
-        Aws::StringStream addSs;
+        Aws::Utils::Stream::StringOutputStream addSs;
         addSs << location << index << locationValue << ".Add." << addIdx++;
-        item.OutputToStream(oStream, addSs.str().c_str());
+        item.OutputToStream(oStream, addSs.GetString().c_str());
       }
   }
 
@@ -95,9 +96,9 @@ void LaunchPermissionModifications::OutputToStream(Aws::OStream& oStream, const
       unsigned removeIdx = 1;
       for(auto& item : m_remove)
       {
-        Aws::StringStream removeSs;
+        Aws::Utils::Stream::StringOutputStream removeSs;
         removeSs << location << index << locationValue << ".Remove." << removeIdx++;
-        item.OutputToStream(oStream, removeSs.str().c_str());
+        item.OutputToStream(oStream, removeSs.GetString().c_str());
       }
   }
 
@@ -110,9 +111,9 @@ void LaunchPermissionModifications::OutputToStream(Aws::OStream& oStream, const
       unsigned addIdx = 1;
       for(auto& item : m_add)
       {
-        Aws::StringStream addSs;
+        Aws::Utils::Stream::StringOutputStream addSs;
         addSs << location <<  ".item." << addIdx++;
-        item.OutputToStream(oStream, addSs.str().c_str());
+        item.OutputToStream(oStream, addSs.GetString().c_str());
       }
   }
   if(m_removeHasBeenSet)
@@ -120,9 +121,9 @@ void LaunchPermissionModifications::OutputToStream(Aws::OStream& oStream, const
       unsigned removeIdx = 1;
       for(auto& item : m_remove)
       {
-        Aws::StringStream removeSs;
+        Aws::Utils::Stream::StringOutputStream removeSs;
         removeSs << location <<  ".item." << removeIdx++;
-        item.OutputToStream(oStream, removeSs.str().c_str());
+        item.OutputToStream(oStream, removeSs.GetString().c_str());
       }
   }
 }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -79,13 +80,13 @@ LaunchSpecification& LaunchSpecification::operator =(const XmlNode& xmlNode)
     XmlNode imageIdNode = resultNode.FirstChild("imageId");
     if(!imageIdNode.IsNull())
     {
-      m_imageId = StringUtils::Trim(imageIdNode.GetText().c_str());
+      m_imageId = imageIdNode.GetTextView().Trim().ToString();
       m_imageIdHasBeenSet = true;
     }
     XmlNode keyNameNode = resultNode.FirstChild("keyName");
     if(!keyNameNode.IsNull())
     {
-      m_keyName = StringUtils::Trim(keyNameNode.GetText().c_str());
+      m_keyName = keyNameNode.GetTextView().Trim().ToString();
       m_keyNameHasBeenSet = true;
     }
     XmlNode securityGroupsNode = resultNode.FirstChild("groupSet");
@@ -103,19 +104,19 @@ LaunchSpecification& LaunchSpecification::operator =(const XmlNode& xmlNode)
     XmlNode userDataNode = resultNode.FirstChild("userData");
     if(!userDataNode.IsNull())
     {
-      m_userData = StringUtils::Trim(userDataNode.GetText().c_str());
+      m_userData = userDataNode.GetTextView().Trim().ToString();
       m_userDataHasBeenSet = true;
     }
     XmlNode addressingTypeNode = resultNode.FirstChild("addressingType");
     if(!addressingTypeNode.IsNull())
     {
-      m_addressingType = StringUtils::Trim(addressingTypeNode.GetText().c_str());
+      m_addressingType = addressingTypeNode.GetTextView().Trim().ToString();
       m_addressingTypeHasBeenSet = true;
     }
     XmlNode instanceTypeNode = resultNode.FirstChild("instanceType");
     if(!instanceTypeNode.IsNull())
     {
-      m_instanceType = InstanceTypeMapper::GetInstanceTypeForName(StringUtils::Trim(instanceTypeNode.GetText().c_str()).c_str());
+      m_instanceType = InstanceTypeMapper::GetInstanceTypeForName(instanceTypeNode.GetTextView().Trim().ToString().c_str());
       m_instanceTypeHasBeenSet = true;
     }
     XmlNode placementNode = resultNode.FirstChild("placement");
@@ -127,13 +128,13 @@ LaunchSpecification& LaunchSpecification::operator =(const XmlNode& xmlNode)
     XmlNode kernelIdNode = resultNode.FirstChild("kernelId");
     if(!kernelIdNode.IsNull())
     {
-      m_kernelId = StringUtils::Trim(kernelIdNode.GetText().c_str());
+      m_kernelId = kernelIdNode.GetTextView().Trim().ToString();
       m_kernelIdHasBeenSet = true;
     }
     XmlNode ramdiskIdNode = resultNode.FirstChild("ramdiskId");
     if(!ramdiskIdNode.IsNull())
     {
-      m_ramdiskId = StringUtils::Trim(ramdiskIdNode.GetText().c_str());
+      m_ramdiskId = ramdiskIdNode.GetTextView().Trim().ToString();
       m_ramdiskIdHasBeenSet = true;
     }
     XmlNode blockDeviceMappingsNode = resultNode.FirstChild("blockDeviceMapping");
@@ -151,7 +152,7 @@ LaunchSpecification& LaunchSpecification::operator =(const XmlNode& xmlNode)
     XmlNode subnetIdNode = resultNode.FirstChild("subnetId");
     if(!subnetIdNode.IsNull())
     {
-      m_subnetId = StringUtils::Trim(subnetIdNode.GetText().c_str());
+      m_subnetId = subnetIdNode.GetTextView().Trim().ToString();
       m_subnetIdHasBeenSet = true;
     }
     XmlNode networkInterfacesNode = resultNode.FirstChild("networkInterfaceSet");
@@ -175,7 +176,7 @@ LaunchSpecification& LaunchSpecification::operator =(const XmlNode& xmlNode)
     XmlNode ebsOptimizedNode = resultNode.FirstChild("ebsOptimized");
     if(!ebsOptimizedNode.IsNull())
     {
-      m_ebsOptimized = StringUtils::ConvertToBool(StringUtils::Trim(ebsOptimizedNode.GetText().c_str()).c_str());
+      m_ebsOptimized = StringUtils::ConvertToBool(ebsOptimizedNode.GetTextView().Trim().ToString().c_str());
       m_ebsOptimizedHasBeenSet = true;
     }
     XmlNode monitoringNode = resultNode.FirstChild("monitoring");
@@ -193,12 +194,12 @@ void LaunchSpecification::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_imageIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
 
   if(m_keyNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+      oStream << location << index << locationValue << ".KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
 
   if(m_securityGroupsHasBeenSet)
@@ -206,20 +207,20 @@ void LaunchSpecification::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned securityGroupsIdx = 1;
       for(auto& item : m_securityGroups)
       {
-        Aws::StringStream securityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream securityGroupsSs;
         securityGroupsSs << location << index << locationValue << ".GroupSet." << securityGroupsIdx++;
-        item.OutputToStream(oStream, securityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, securityGroupsSs.GetString().c_str());
       }
   }
 
   if(m_userDataHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UserData=" << StringUtils::URLEncode(m_userData.c_str()) << "&";
+      oStream << location << index << locationValue << ".UserData=" << StringUtils::URLEncoded(m_userData) << "&";
   }
 
   if(m_addressingTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AddressingType=" << StringUtils::URLEncode(m_addressingType.c_str()) << "&";
+      oStream << location << index << locationValue << ".AddressingType=" << StringUtils::URLEncoded(m_addressingType) << "&";
   }
 
   if(m_instanceTypeHasBeenSet)
@@ -229,19 +230,19 @@ void LaunchSpecification::OutputToStream(Aws::OStream& oStream, const char* loca
 
   if(m_placementHasBeenSet)
   {
-      Aws::StringStream placementLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream placementLocationAndMemberSs;
       placementLocationAndMemberSs << location << index << locationValue << ".Placement";
-      m_placement.OutputToStream(oStream, placementLocationAndMemberSs.str().c_str());
+      m_placement.OutputToStream(oStream, placementLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_kernelIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KernelId=" << StringUtils::URLEncode(m_kernelId.c_str()) << "&";
+      oStream << location << index << locationValue << ".KernelId=" << StringUtils::URLEncoded(m_kernelId) << "&";
   }
 
   if(m_ramdiskIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RamdiskId=" << StringUtils::URLEncode(m_ramdiskId.c_str()) << "&";
+      oStream << location << index << locationValue << ".RamdiskId=" << StringUtils::URLEncoded(m_ramdiskId) << "&";
   }
 
   if(m_blockDeviceMappingsHasBeenSet)
@@ -249,15 +250,15 @@ void LaunchSpecification::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned blockDeviceMappingsIdx = 1;
       for(auto& item : m_blockDeviceMappings)
       {
-        Aws::StringStream blockDeviceMappingsSs;
+        Aws::Utils::Stream::StringOutputStream blockDeviceMappingsSs;
         blockDeviceMappingsSs << location << index << locationValue << ".BlockDeviceMapping." << blockDeviceMappingsIdx++;
-        item.OutputToStream(oStream, blockDeviceMappingsSs.str().c_str());
+        item.OutputToStream(oStream, blockDeviceMappingsSs.GetString().c_str());
       }
   }
 
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
   if(m_networkInterfacesHasBeenSet)
@@ -265,17 +266,17 @@ void LaunchSpecification::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned networkInterfacesIdx = 1;
       for(auto& item : m_networkInterfaces)
       {
-        Aws::StringStream networkInterfacesSs;
+        Aws::Utils::Stream::StringOutputStream networkInterfacesSs;
         networkInterfacesSs << location << index << locationValue << ".NetworkInterfaceSet." << networkInterfacesIdx++;
-        item.OutputToStream(oStream, networkInterfacesSs.str().c_str());
+        item.OutputToStream(oStream, networkInterfacesSs.GetString().c_str());
       }
   }
 
   if(m_iamInstanceProfileHasBeenSet)
   {
-      Aws::StringStream iamInstanceProfileLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream iamInstanceProfileLocationAndMemberSs;
       iamInstanceProfileLocationAndMemberSs << location << index << locationValue << ".IamInstanceProfile";
-      m_iamInstanceProfile.OutputToStream(oStream, iamInstanceProfileLocationAndMemberSs.str().c_str());
+      m_iamInstanceProfile.OutputToStream(oStream, iamInstanceProfileLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_ebsOptimizedHasBeenSet)
@@ -285,9 +286,9 @@ void LaunchSpecification::OutputToStream(Aws::OStream& oStream, const char* loca
 
   if(m_monitoringHasBeenSet)
   {
-      Aws::StringStream monitoringLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream monitoringLocationAndMemberSs;
       monitoringLocationAndMemberSs << location << index << locationValue << ".Monitoring";
-      m_monitoring.OutputToStream(oStream, monitoringLocationAndMemberSs.str().c_str());
+      m_monitoring.OutputToStream(oStream, monitoringLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -296,29 +297,29 @@ void LaunchSpecification::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_imageIdHasBeenSet)
   {
-      oStream << location << ".ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+      oStream << location << ".ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
   if(m_keyNameHasBeenSet)
   {
-      oStream << location << ".KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+      oStream << location << ".KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
   if(m_securityGroupsHasBeenSet)
   {
       unsigned securityGroupsIdx = 1;
       for(auto& item : m_securityGroups)
       {
-        Aws::StringStream securityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream securityGroupsSs;
         securityGroupsSs << location <<  ".item." << securityGroupsIdx++;
-        item.OutputToStream(oStream, securityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, securityGroupsSs.GetString().c_str());
       }
   }
   if(m_userDataHasBeenSet)
   {
-      oStream << location << ".UserData=" << StringUtils::URLEncode(m_userData.c_str()) << "&";
+      oStream << location << ".UserData=" << StringUtils::URLEncoded(m_userData) << "&";
   }
   if(m_addressingTypeHasBeenSet)
   {
-      oStream << location << ".AddressingType=" << StringUtils::URLEncode(m_addressingType.c_str()) << "&";
+      oStream << location << ".AddressingType=" << StringUtils::URLEncoded(m_addressingType) << "&";
   }
   if(m_instanceTypeHasBeenSet)
   {
@@ -332,34 +333,34 @@ void LaunchSpecification::OutputToStream(Aws::OStream& oStream, const char* loca
   }
   if(m_kernelIdHasBeenSet)
   {
-      oStream << location << ".KernelId=" << StringUtils::URLEncode(m_kernelId.c_str()) << "&";
+      oStream << location << ".KernelId=" << StringUtils::URLEncoded(m_kernelId) << "&";
   }
   if(m_ramdiskIdHasBeenSet)
   {
-      oStream << location << ".RamdiskId=" << StringUtils::URLEncode(m_ramdiskId.c_str()) << "&";
+      oStream << location << ".RamdiskId=" << StringUtils::URLEncoded(m_ramdiskId) << "&";
   }
   if(m_blockDeviceMappingsHasBeenSet)
   {
       unsigned blockDeviceMappingsIdx = 1;
       for(auto& item : m_blockDeviceMappings)
       {
-        Aws::StringStream blockDeviceMappingsSs;
+        Aws::Utils::Stream::StringOutputStream blockDeviceMappingsSs;
         blockDeviceMappingsSs << location <<  ".item." << blockDeviceMappingsIdx++;
-        item.OutputToStream(oStream, blockDeviceMappingsSs.str().c_str());
+        item.OutputToStream(oStream, blockDeviceMappingsSs.GetString().c_str());
       }
   }
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
   if(m_networkInterfacesHasBeenSet)
   {
       unsigned networkInterfacesIdx = 1;
       for(auto& item : m_networkInterfaces)
       {
-        Aws::StringStream networkInterfacesSs;
+        Aws::Utils::Stream::StringOutputStream networkInterfacesSs;
         networkInterfacesSs << location <<  ".item." << networkInterfacesIdx++;
-        item.OutputToStream(oStream, networkInterfacesSs.str().c_str());
+        item.OutputToStream(oStream, networkInterfacesSs.GetString().c_str());
       }
   }
   if(m_iamInstanceProfileHasBeenSet)
@@ -29,31 +29,35 @@ namespace Aws
       namespace ListingStateMapper
       {
 
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int sold_HASH = HashingUtils::HashString("sold");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int pending_HASH = HashingUtils::HashString("pending");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int available_HASH = -733902135;
+        static const int sold_HASH = 3536084;
+        static const int cancelled_HASH = 476588369;
+        static const int pending_HASH = -682587753;
 
 
         ListingState GetListingStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == available_HASH)
+          switch (hashCode)
           {
+          case available_HASH:
             return ListingState::available;
-          }
-          else if (hashCode == sold_HASH)
-          {
+          case sold_HASH:
             return ListingState::sold;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
+          case cancelled_HASH:
             return ListingState::cancelled;
-          }
-          else if (hashCode == pending_HASH)
-          {
+          case pending_HASH:
             return ListingState::pending;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,31 +29,35 @@ namespace Aws
       namespace ListingStatusMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int closed_HASH = HashingUtils::HashString("closed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int active_HASH = -1422950650;
+        static const int pending_HASH = -682587753;
+        static const int cancelled_HASH = 476588369;
+        static const int closed_HASH = -1357520532;
 
 
         ListingStatus GetListingStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
+          switch (hashCode)
           {
+          case active_HASH:
             return ListingStatus::active;
-          }
-          else if (hashCode == pending_HASH)
-          {
+          case pending_HASH:
             return ListingStatus::pending;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
+          case cancelled_HASH:
             return ListingStatus::cancelled;
-          }
-          else if (hashCode == closed_HASH)
-          {
+          case closed_HASH:
             return ListingStatus::closed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ModifyHostsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -27,7 +28,7 @@ ModifyHostsRequest::ModifyHostsRequest() :
 
 Aws::String ModifyHostsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyHosts&";
   if(m_hostIdsHasBeenSet)
   {
@@ -35,7 +36,7 @@ Aws::String ModifyHostsRequest::SerializePayload() const
     for(auto& item : m_hostIds)
     {
       ss << "HostId." << hostIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       hostIdsCount++;
     }
   }
@@ -46,6 +47,6 @@ Aws::String ModifyHostsRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
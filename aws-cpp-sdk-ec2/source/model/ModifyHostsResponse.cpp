@@ -40,7 +40,7 @@ ModifyHostsResponse& ModifyHostsResponse::operator =(const AmazonWebServiceResul
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyHostsResponse")
+  if (rootNode.GetNameView() != "ModifyHostsResponse")
   {
     resultNode = rootNode.FirstChild("ModifyHostsResponse");
   }
@@ -53,7 +53,7 @@ ModifyHostsResponse& ModifyHostsResponse::operator =(const AmazonWebServiceResul
       XmlNode successfulMember = successfulNode.FirstChild("item");
       while(!successfulMember.IsNull())
       {
-        m_successful.push_back(StringUtils::Trim(successfulMember.GetText().c_str()));
+        m_successful.push_back(successfulMember.GetTextView().Trim().ToString());
         successfulMember = successfulMember.NextNode("item");
       }
 
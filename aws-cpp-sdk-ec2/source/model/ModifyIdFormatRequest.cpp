@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ModifyIdFormatRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,11 +29,11 @@ ModifyIdFormatRequest::ModifyIdFormatRequest() :
 
 Aws::String ModifyIdFormatRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyIdFormat&";
   if(m_resourceHasBeenSet)
   {
-    ss << "Resource=" << StringUtils::URLEncode(m_resource.c_str()) << "&";
+    ss << "Resource=" << StringUtils::URLEncoded(m_resource) << "&";
   }
 
   if(m_useLongIdsHasBeenSet)
@@ -41,6 +42,6 @@ Aws::String ModifyIdFormatRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
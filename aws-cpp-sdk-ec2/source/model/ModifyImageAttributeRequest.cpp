@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ModifyImageAttributeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -36,7 +37,7 @@ ModifyImageAttributeRequest::ModifyImageAttributeRequest() :
 
 Aws::String ModifyImageAttributeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyImageAttribute&";
   if(m_dryRunHasBeenSet)
   {
@@ -45,12 +46,12 @@ Aws::String ModifyImageAttributeRequest::SerializePayload() const
 
   if(m_imageIdHasBeenSet)
   {
-    ss << "ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+    ss << "ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
 
   if(m_attributeHasBeenSet)
   {
-    ss << "Attribute=" << StringUtils::URLEncode(m_attribute.c_str()) << "&";
+    ss << "Attribute=" << StringUtils::URLEncoded(m_attribute) << "&";
   }
 
   if(m_operationTypeHasBeenSet)
@@ -64,7 +65,7 @@ Aws::String ModifyImageAttributeRequest::SerializePayload() const
     for(auto& item : m_userIds)
     {
       ss << "UserId." << userIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       userIdsCount++;
     }
   }
@@ -75,7 +76,7 @@ Aws::String ModifyImageAttributeRequest::SerializePayload() const
     for(auto& item : m_userGroups)
     {
       ss << "UserGroup." << userGroupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       userGroupsCount++;
     }
   }
@@ -86,14 +87,14 @@ Aws::String ModifyImageAttributeRequest::SerializePayload() const
     for(auto& item : m_productCodes)
     {
       ss << "ProductCode." << productCodesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       productCodesCount++;
     }
   }
 
   if(m_valueHasBeenSet)
   {
-    ss << "Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+    ss << "Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 
   if(m_launchPermissionHasBeenSet)
@@ -107,6 +108,6 @@ Aws::String ModifyImageAttributeRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ModifyInstanceAttributeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -41,7 +42,7 @@ ModifyInstanceAttributeRequest::ModifyInstanceAttributeRequest() :
 
 Aws::String ModifyInstanceAttributeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyInstanceAttribute&";
   if(m_dryRunHasBeenSet)
   {
@@ -50,7 +51,7 @@ Aws::String ModifyInstanceAttributeRequest::SerializePayload() const
 
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_attributeHasBeenSet)
@@ -60,7 +61,7 @@ Aws::String ModifyInstanceAttributeRequest::SerializePayload() const
 
   if(m_valueHasBeenSet)
   {
-    ss << "Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+    ss << "Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 
   if(m_blockDeviceMappingsHasBeenSet)
@@ -114,7 +115,7 @@ Aws::String ModifyInstanceAttributeRequest::SerializePayload() const
     for(auto& item : m_groups)
     {
       ss << "GroupId." << groupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       groupsCount++;
     }
   }
@@ -130,6 +131,6 @@ Aws::String ModifyInstanceAttributeRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
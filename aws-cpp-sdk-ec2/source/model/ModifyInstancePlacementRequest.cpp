@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ModifyInstancePlacementRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,11 +30,11 @@ ModifyInstancePlacementRequest::ModifyInstancePlacementRequest() :
 
 Aws::String ModifyInstancePlacementRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyInstancePlacement&";
   if(m_instanceIdHasBeenSet)
   {
-    ss << "InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+    ss << "InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_tenancyHasBeenSet)
@@ -48,10 +49,10 @@ Aws::String ModifyInstancePlacementRequest::SerializePayload() const
 
   if(m_hostIdHasBeenSet)
   {
-    ss << "HostId=" << StringUtils::URLEncode(m_hostId.c_str()) << "&";
+    ss << "HostId=" << StringUtils::URLEncoded(m_hostId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
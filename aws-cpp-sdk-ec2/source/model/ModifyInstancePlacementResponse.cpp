@@ -42,7 +42,7 @@ ModifyInstancePlacementResponse& ModifyInstancePlacementResponse::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyInstancePlacementResponse")
+  if (rootNode.GetNameView() != "ModifyInstancePlacementResponse")
   {
     resultNode = rootNode.FirstChild("ModifyInstancePlacementResponse");
   }
@@ -52,7 +52,7 @@ ModifyInstancePlacementResponse& ModifyInstancePlacementResponse::operator =(con
     XmlNode returnNode = resultNode.FirstChild("return");
     if(!returnNode.IsNull())
     {
-      m_return = StringUtils::ConvertToBool(StringUtils::Trim(returnNode.GetText().c_str()).c_str());
+      m_return = StringUtils::ConvertToBool(returnNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
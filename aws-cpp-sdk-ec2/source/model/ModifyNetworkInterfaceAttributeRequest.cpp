@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ModifyNetworkInterfaceAttributeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -32,7 +33,7 @@ ModifyNetworkInterfaceAttributeRequest::ModifyNetworkInterfaceAttributeRequest()
 
 Aws::String ModifyNetworkInterfaceAttributeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyNetworkInterfaceAttribute&";
   if(m_dryRunHasBeenSet)
   {
@@ -41,7 +42,7 @@ Aws::String ModifyNetworkInterfaceAttributeRequest::SerializePayload() const
 
   if(m_networkInterfaceIdHasBeenSet)
   {
-    ss << "NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+    ss << "NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
 
   if(m_descriptionHasBeenSet)
@@ -60,7 +61,7 @@ Aws::String ModifyNetworkInterfaceAttributeRequest::SerializePayload() const
     for(auto& item : m_groups)
     {
       ss << "SecurityGroupId." << groupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       groupsCount++;
     }
   }
@@ -71,6 +72,6 @@ Aws::String ModifyNetworkInterfaceAttributeRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
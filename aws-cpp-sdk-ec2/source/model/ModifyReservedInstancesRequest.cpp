@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ModifyReservedInstancesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -28,11 +29,11 @@ ModifyReservedInstancesRequest::ModifyReservedInstancesRequest() :
 
 Aws::String ModifyReservedInstancesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyReservedInstances&";
   if(m_clientTokenHasBeenSet)
   {
-    ss << "ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+    ss << "ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   if(m_reservedInstancesIdsHasBeenSet)
@@ -41,7 +42,7 @@ Aws::String ModifyReservedInstancesRequest::SerializePayload() const
     for(auto& item : m_reservedInstancesIds)
     {
       ss << "ReservedInstancesId." << reservedInstancesIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       reservedInstancesIdsCount++;
     }
   }
@@ -57,6 +58,6 @@ Aws::String ModifyReservedInstancesRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ModifyReservedInstancesResponse& ModifyReservedInstancesResponse::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyReservedInstancesResponse")
+  if (rootNode.GetNameView() != "ModifyReservedInstancesResponse")
   {
     resultNode = rootNode.FirstChild("ModifyReservedInstancesResponse");
   }
@@ -50,7 +50,7 @@ ModifyReservedInstancesResponse& ModifyReservedInstancesResponse::operator =(con
     XmlNode reservedInstancesModificationIdNode = resultNode.FirstChild("reservedInstancesModificationId");
     if(!reservedInstancesModificationIdNode.IsNull())
     {
-      m_reservedInstancesModificationId = StringUtils::Trim(reservedInstancesModificationIdNode.GetText().c_str());
+      m_reservedInstancesModificationId = reservedInstancesModificationIdNode.GetTextView().Trim().ToString();
     }
   }
 
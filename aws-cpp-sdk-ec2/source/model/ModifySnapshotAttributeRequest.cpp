@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ModifySnapshotAttributeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -33,7 +34,7 @@ ModifySnapshotAttributeRequest::ModifySnapshotAttributeRequest() :
 
 Aws::String ModifySnapshotAttributeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifySnapshotAttribute&";
   if(m_dryRunHasBeenSet)
   {
@@ -42,7 +43,7 @@ Aws::String ModifySnapshotAttributeRequest::SerializePayload() const
 
   if(m_snapshotIdHasBeenSet)
   {
-    ss << "SnapshotId=" << StringUtils::URLEncode(m_snapshotId.c_str()) << "&";
+    ss << "SnapshotId=" << StringUtils::URLEncoded(m_snapshotId) << "&";
   }
 
   if(m_attributeHasBeenSet)
@@ -61,7 +62,7 @@ Aws::String ModifySnapshotAttributeRequest::SerializePayload() const
     for(auto& item : m_userIds)
     {
       ss << "UserId." << userIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       userIdsCount++;
     }
   }
@@ -72,7 +73,7 @@ Aws::String ModifySnapshotAttributeRequest::SerializePayload() const
     for(auto& item : m_groupNames)
     {
       ss << "UserGroup." << groupNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       groupNamesCount++;
     }
   }
@@ -83,6 +84,6 @@ Aws::String ModifySnapshotAttributeRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
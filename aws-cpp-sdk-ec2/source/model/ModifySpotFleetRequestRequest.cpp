@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ModifySpotFleetRequestRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,11 +30,11 @@ ModifySpotFleetRequestRequest::ModifySpotFleetRequestRequest() :
 
 Aws::String ModifySpotFleetRequestRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifySpotFleet&";
   if(m_spotFleetRequestIdHasBeenSet)
   {
-    ss << "SpotFleetRequestId=" << StringUtils::URLEncode(m_spotFleetRequestId.c_str()) << "&";
+    ss << "SpotFleetRequestId=" << StringUtils::URLEncoded(m_spotFleetRequestId) << "&";
   }
 
   if(m_targetCapacityHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String ModifySpotFleetRequestRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -42,7 +42,7 @@ ModifySpotFleetRequestResponse& ModifySpotFleetRequestResponse::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifySpotFleetRequestResponse")
+  if (rootNode.GetNameView() != "ModifySpotFleetRequestResponse")
   {
     resultNode = rootNode.FirstChild("ModifySpotFleetRequestResponse");
   }
@@ -52,7 +52,7 @@ ModifySpotFleetRequestResponse& ModifySpotFleetRequestResponse::operator =(const
     XmlNode returnNode = resultNode.FirstChild("return");
     if(!returnNode.IsNull())
     {
-      m_return = StringUtils::ConvertToBool(StringUtils::Trim(returnNode.GetText().c_str()).c_str());
+      m_return = StringUtils::ConvertToBool(returnNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
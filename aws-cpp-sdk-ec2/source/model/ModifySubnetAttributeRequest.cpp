@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ModifySubnetAttributeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ ModifySubnetAttributeRequest::ModifySubnetAttributeRequest() :
 
 Aws::String ModifySubnetAttributeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifySubnetAttribute&";
   if(m_subnetIdHasBeenSet)
   {
-    ss << "SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+    ss << "SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
   if(m_mapPublicIpOnLaunchHasBeenSet)
@@ -40,6 +41,6 @@ Aws::String ModifySubnetAttributeRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
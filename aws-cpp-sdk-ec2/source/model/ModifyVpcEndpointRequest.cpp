@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ModifyVpcEndpointRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -33,7 +34,7 @@ ModifyVpcEndpointRequest::ModifyVpcEndpointRequest() :
 
 Aws::String ModifyVpcEndpointRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyVpcEndpoint&";
   if(m_dryRunHasBeenSet)
   {
@@ -42,7 +43,7 @@ Aws::String ModifyVpcEndpointRequest::SerializePayload() const
 
   if(m_vpcEndpointIdHasBeenSet)
   {
-    ss << "VpcEndpointId=" << StringUtils::URLEncode(m_vpcEndpointId.c_str()) << "&";
+    ss << "VpcEndpointId=" << StringUtils::URLEncoded(m_vpcEndpointId) << "&";
   }
 
   if(m_resetPolicyHasBeenSet)
@@ -52,7 +53,7 @@ Aws::String ModifyVpcEndpointRequest::SerializePayload() const
 
   if(m_policyDocumentHasBeenSet)
   {
-    ss << "PolicyDocument=" << StringUtils::URLEncode(m_policyDocument.c_str()) << "&";
+    ss << "PolicyDocument=" << StringUtils::URLEncoded(m_policyDocument) << "&";
   }
 
   if(m_addRouteTableIdsHasBeenSet)
@@ -61,7 +62,7 @@ Aws::String ModifyVpcEndpointRequest::SerializePayload() const
     for(auto& item : m_addRouteTableIds)
     {
       ss << "AddRouteTableId." << addRouteTableIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       addRouteTableIdsCount++;
     }
   }
@@ -72,12 +73,12 @@ Aws::String ModifyVpcEndpointRequest::SerializePayload() const
     for(auto& item : m_removeRouteTableIds)
     {
       ss << "RemoveRouteTableId." << removeRouteTableIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       removeRouteTableIdsCount++;
     }
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
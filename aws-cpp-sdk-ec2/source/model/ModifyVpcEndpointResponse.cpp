@@ -42,7 +42,7 @@ ModifyVpcEndpointResponse& ModifyVpcEndpointResponse::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyVpcEndpointResponse")
+  if (rootNode.GetNameView() != "ModifyVpcEndpointResponse")
   {
     resultNode = rootNode.FirstChild("ModifyVpcEndpointResponse");
   }
@@ -52,7 +52,7 @@ ModifyVpcEndpointResponse& ModifyVpcEndpointResponse::operator =(const AmazonWeb
     XmlNode returnNode = resultNode.FirstChild("return");
     if(!returnNode.IsNull())
     {
-      m_return = StringUtils::ConvertToBool(StringUtils::Trim(returnNode.GetText().c_str()).c_str());
+      m_return = StringUtils::ConvertToBool(returnNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ModifyVpcPeeringConnectionOptionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ ModifyVpcPeeringConnectionOptionsRequest::ModifyVpcPeeringConnectionOptionsReque
 
 Aws::String ModifyVpcPeeringConnectionOptionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyVpcPeeringConnectionOptions&";
   if(m_dryRunHasBeenSet)
   {
@@ -39,7 +40,7 @@ Aws::String ModifyVpcPeeringConnectionOptionsRequest::SerializePayload() const
 
   if(m_vpcPeeringConnectionIdHasBeenSet)
   {
-    ss << "VpcPeeringConnectionId=" << StringUtils::URLEncode(m_vpcPeeringConnectionId.c_str()) << "&";
+    ss << "VpcPeeringConnectionId=" << StringUtils::URLEncoded(m_vpcPeeringConnectionId) << "&";
   }
 
   if(m_requesterPeeringConnectionOptionsHasBeenSet)
@@ -53,6 +54,6 @@ Aws::String ModifyVpcPeeringConnectionOptionsRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ModifyVpcPeeringConnectionOptionsResponse& ModifyVpcPeeringConnectionOptionsResp
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyVpcPeeringConnectionOptionsResponse")
+  if (rootNode.GetNameView() != "ModifyVpcPeeringConnectionOptionsResponse")
   {
     resultNode = rootNode.FirstChild("ModifyVpcPeeringConnectionOptionsResponse");
   }
@@ -40,7 +40,7 @@ MonitorInstancesResponse& MonitorInstancesResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "MonitorInstancesResponse")
+  if (rootNode.GetNameView() != "MonitorInstancesResponse")
   {
     resultNode = rootNode.FirstChild("MonitorInstancesResponse");
   }
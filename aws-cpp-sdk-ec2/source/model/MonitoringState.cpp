@@ -29,31 +29,35 @@ namespace Aws
       namespace MonitoringStateMapper
       {
 
-        static const int disabled_HASH = HashingUtils::HashString("disabled");
-        static const int disabling_HASH = HashingUtils::HashString("disabling");
-        static const int enabled_HASH = HashingUtils::HashString("enabled");
-        static const int pending_HASH = HashingUtils::HashString("pending");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int disabled_HASH = 270940796;
+        static const int disabling_HASH = -190765659;
+        static const int enabled_HASH = -1609594047;
+        static const int pending_HASH = -682587753;
 
 
         MonitoringState GetMonitoringStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == disabled_HASH)
+          switch (hashCode)
           {
+          case disabled_HASH:
             return MonitoringState::disabled;
-          }
-          else if (hashCode == disabling_HASH)
-          {
+          case disabling_HASH:
             return MonitoringState::disabling;
-          }
-          else if (hashCode == enabled_HASH)
-          {
+          case enabled_HASH:
             return MonitoringState::enabled;
-          }
-          else if (hashCode == pending_HASH)
-          {
+          case pending_HASH:
             return MonitoringState::pending;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
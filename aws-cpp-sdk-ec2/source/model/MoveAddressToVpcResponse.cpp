@@ -40,7 +40,7 @@ MoveAddressToVpcResponse& MoveAddressToVpcResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "MoveAddressToVpcResponse")
+  if (rootNode.GetNameView() != "MoveAddressToVpcResponse")
   {
     resultNode = rootNode.FirstChild("MoveAddressToVpcResponse");
   }
@@ -50,12 +50,12 @@ MoveAddressToVpcResponse& MoveAddressToVpcResponse::operator =(const AmazonWebSe
     XmlNode allocationIdNode = resultNode.FirstChild("allocationId");
     if(!allocationIdNode.IsNull())
     {
-      m_allocationId = StringUtils::Trim(allocationIdNode.GetText().c_str());
+      m_allocationId = allocationIdNode.GetTextView().Trim().ToString();
     }
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = StatusMapper::GetStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = StatusMapper::GetStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -29,21 +29,29 @@ namespace Aws
       namespace MoveStatusMapper
       {
 
-        static const int movingToVpc_HASH = HashingUtils::HashString("movingToVpc");
-        static const int restoringToClassic_HASH = HashingUtils::HashString("restoringToClassic");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int movingToVpc_HASH = -1281174336;
+        static const int restoringToClassic_HASH = 1079001612;
 
 
         MoveStatus GetMoveStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == movingToVpc_HASH)
+          switch (hashCode)
           {
+          case movingToVpc_HASH:
             return MoveStatus::movingToVpc;
-          }
-          else if (hashCode == restoringToClassic_HASH)
-          {
+          case restoringToClassic_HASH:
             return MoveStatus::restoringToClassic;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
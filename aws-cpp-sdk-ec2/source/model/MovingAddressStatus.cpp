@@ -51,13 +51,13 @@ MovingAddressStatus& MovingAddressStatus::operator =(const XmlNode& xmlNode)
     XmlNode publicIpNode = resultNode.FirstChild("publicIp");
     if(!publicIpNode.IsNull())
     {
-      m_publicIp = StringUtils::Trim(publicIpNode.GetText().c_str());
+      m_publicIp = publicIpNode.GetTextView().Trim().ToString();
       m_publicIpHasBeenSet = true;
     }
     XmlNode moveStatusNode = resultNode.FirstChild("moveStatus");
     if(!moveStatusNode.IsNull())
     {
-      m_moveStatus = MoveStatusMapper::GetMoveStatusForName(StringUtils::Trim(moveStatusNode.GetText().c_str()).c_str());
+      m_moveStatus = MoveStatusMapper::GetMoveStatusForName(moveStatusNode.GetTextView().Trim().ToString().c_str());
       m_moveStatusHasBeenSet = true;
     }
   }
@@ -69,7 +69,7 @@ void MovingAddressStatus::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_publicIpHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PublicIp=" << StringUtils::URLEncode(m_publicIp.c_str()) << "&";
+      oStream << location << index << locationValue << ".PublicIp=" << StringUtils::URLEncoded(m_publicIp) << "&";
   }
 
   if(m_moveStatusHasBeenSet)
@@ -83,7 +83,7 @@ void MovingAddressStatus::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_publicIpHasBeenSet)
   {
-      oStream << location << ".PublicIp=" << StringUtils::URLEncode(m_publicIp.c_str()) << "&";
+      oStream << location << ".PublicIp=" << StringUtils::URLEncoded(m_publicIp) << "&";
   }
   if(m_moveStatusHasBeenSet)
   {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -67,31 +68,31 @@ NatGateway& NatGateway::operator =(const XmlNode& xmlNode)
     XmlNode vpcIdNode = resultNode.FirstChild("vpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode subnetIdNode = resultNode.FirstChild("subnetId");
     if(!subnetIdNode.IsNull())
     {
-      m_subnetId = StringUtils::Trim(subnetIdNode.GetText().c_str());
+      m_subnetId = subnetIdNode.GetTextView().Trim().ToString();
       m_subnetIdHasBeenSet = true;
     }
     XmlNode natGatewayIdNode = resultNode.FirstChild("natGatewayId");
     if(!natGatewayIdNode.IsNull())
     {
-      m_natGatewayId = StringUtils::Trim(natGatewayIdNode.GetText().c_str());
+      m_natGatewayId = natGatewayIdNode.GetTextView().Trim().ToString();
       m_natGatewayIdHasBeenSet = true;
     }
     XmlNode createTimeNode = resultNode.FirstChild("createTime");
     if(!createTimeNode.IsNull())
     {
-      m_createTime = DateTime(StringUtils::Trim(createTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createTime = DateTime(createTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createTimeHasBeenSet = true;
     }
     XmlNode deleteTimeNode = resultNode.FirstChild("deleteTime");
     if(!deleteTimeNode.IsNull())
     {
-      m_deleteTime = DateTime(StringUtils::Trim(deleteTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_deleteTime = DateTime(deleteTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_deleteTimeHasBeenSet = true;
     }
     XmlNode natGatewayAddressesNode = resultNode.FirstChild("natGatewayAddressSet");
@@ -109,19 +110,19 @@ NatGateway& NatGateway::operator =(const XmlNode& xmlNode)
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = NatGatewayStateMapper::GetNatGatewayStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = NatGatewayStateMapper::GetNatGatewayStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode failureCodeNode = resultNode.FirstChild("failureCode");
     if(!failureCodeNode.IsNull())
     {
-      m_failureCode = StringUtils::Trim(failureCodeNode.GetText().c_str());
+      m_failureCode = failureCodeNode.GetTextView().Trim().ToString();
       m_failureCodeHasBeenSet = true;
     }
     XmlNode failureMessageNode = resultNode.FirstChild("failureMessage");
     if(!failureMessageNode.IsNull())
     {
-      m_failureMessage = StringUtils::Trim(failureMessageNode.GetText().c_str());
+      m_failureMessage = failureMessageNode.GetTextView().Trim().ToString();
       m_failureMessageHasBeenSet = true;
     }
     XmlNode provisionedBandwidthNode = resultNode.FirstChild("provisionedBandwidth");
@@ -139,27 +140,27 @@ void NatGateway::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
   if(m_natGatewayIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NatGatewayId=" << StringUtils::URLEncode(m_natGatewayId.c_str()) << "&";
+      oStream << location << index << locationValue << ".NatGatewayId=" << StringUtils::URLEncoded(m_natGatewayId) << "&";
   }
 
   if(m_createTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreateTime=" << StringUtils::URLEncode(m_createTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreateTime=" << StringUtils::URLEncoded(m_createTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_deleteTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DeleteTime=" << StringUtils::URLEncode(m_deleteTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".DeleteTime=" << StringUtils::URLEncoded(m_deleteTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_natGatewayAddressesHasBeenSet)
@@ -167,9 +168,9 @@ void NatGateway::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned natGatewayAddressesIdx = 1;
       for(auto& item : m_natGatewayAddresses)
       {
-        Aws::StringStream natGatewayAddressesSs;
+        Aws::Utils::Stream::StringOutputStream natGatewayAddressesSs;
         natGatewayAddressesSs << location << index << locationValue << ".NatGatewayAddressSet." << natGatewayAddressesIdx++;
-        item.OutputToStream(oStream, natGatewayAddressesSs.str().c_str());
+        item.OutputToStream(oStream, natGatewayAddressesSs.GetString().c_str());
       }
   }
 
@@ -180,19 +181,19 @@ void NatGateway::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_failureCodeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".FailureCode=" << StringUtils::URLEncode(m_failureCode.c_str()) << "&";
+      oStream << location << index << locationValue << ".FailureCode=" << StringUtils::URLEncoded(m_failureCode) << "&";
   }
 
   if(m_failureMessageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".FailureMessage=" << StringUtils::URLEncode(m_failureMessage.c_str()) << "&";
+      oStream << location << index << locationValue << ".FailureMessage=" << StringUtils::URLEncoded(m_failureMessage) << "&";
   }
 
   if(m_provisionedBandwidthHasBeenSet)
   {
-      Aws::StringStream provisionedBandwidthLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream provisionedBandwidthLocationAndMemberSs;
       provisionedBandwidthLocationAndMemberSs << location << index << locationValue << ".ProvisionedBandwidth";
-      m_provisionedBandwidth.OutputToStream(oStream, provisionedBandwidthLocationAndMemberSs.str().c_str());
+      m_provisionedBandwidth.OutputToStream(oStream, provisionedBandwidthLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -201,32 +202,32 @@ void NatGateway::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
   if(m_natGatewayIdHasBeenSet)
   {
-      oStream << location << ".NatGatewayId=" << StringUtils::URLEncode(m_natGatewayId.c_str()) << "&";
+      oStream << location << ".NatGatewayId=" << StringUtils::URLEncoded(m_natGatewayId) << "&";
   }
   if(m_createTimeHasBeenSet)
   {
-      oStream << location << ".CreateTime=" << StringUtils::URLEncode(m_createTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreateTime=" << StringUtils::URLEncoded(m_createTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_deleteTimeHasBeenSet)
   {
-      oStream << location << ".DeleteTime=" << StringUtils::URLEncode(m_deleteTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".DeleteTime=" << StringUtils::URLEncoded(m_deleteTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_natGatewayAddressesHasBeenSet)
   {
       unsigned natGatewayAddressesIdx = 1;
       for(auto& item : m_natGatewayAddresses)
       {
-        Aws::StringStream natGatewayAddressesSs;
+        Aws::Utils::Stream::StringOutputStream natGatewayAddressesSs;
         natGatewayAddressesSs << location <<  ".item." << natGatewayAddressesIdx++;
-        item.OutputToStream(oStream, natGatewayAddressesSs.str().c_str());
+        item.OutputToStream(oStream, natGatewayAddressesSs.GetString().c_str());
       }
   }
   if(m_stateHasBeenSet)
@@ -235,11 +236,11 @@ void NatGateway::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_failureCodeHasBeenSet)
   {
-      oStream << location << ".FailureCode=" << StringUtils::URLEncode(m_failureCode.c_str()) << "&";
+      oStream << location << ".FailureCode=" << StringUtils::URLEncoded(m_failureCode) << "&";
   }
   if(m_failureMessageHasBeenSet)
   {
-      oStream << location << ".FailureMessage=" << StringUtils::URLEncode(m_failureMessage.c_str()) << "&";
+      oStream << location << ".FailureMessage=" << StringUtils::URLEncoded(m_failureMessage) << "&";
   }
   if(m_provisionedBandwidthHasBeenSet)
   {
@@ -55,25 +55,25 @@ NatGatewayAddress& NatGatewayAddress::operator =(const XmlNode& xmlNode)
     XmlNode publicIpNode = resultNode.FirstChild("publicIp");
     if(!publicIpNode.IsNull())
     {
-      m_publicIp = StringUtils::Trim(publicIpNode.GetText().c_str());
+      m_publicIp = publicIpNode.GetTextView().Trim().ToString();
       m_publicIpHasBeenSet = true;
     }
     XmlNode allocationIdNode = resultNode.FirstChild("allocationId");
     if(!allocationIdNode.IsNull())
     {
-      m_allocationId = StringUtils::Trim(allocationIdNode.GetText().c_str());
+      m_allocationId = allocationIdNode.GetTextView().Trim().ToString();
       m_allocationIdHasBeenSet = true;
     }
     XmlNode privateIpNode = resultNode.FirstChild("privateIp");
     if(!privateIpNode.IsNull())
     {
-      m_privateIp = StringUtils::Trim(privateIpNode.GetText().c_str());
+      m_privateIp = privateIpNode.GetTextView().Trim().ToString();
       m_privateIpHasBeenSet = true;
     }
     XmlNode networkInterfaceIdNode = resultNode.FirstChild("networkInterfaceId");
     if(!networkInterfaceIdNode.IsNull())
     {
-      m_networkInterfaceId = StringUtils::Trim(networkInterfaceIdNode.GetText().c_str());
+      m_networkInterfaceId = networkInterfaceIdNode.GetTextView().Trim().ToString();
       m_networkInterfaceIdHasBeenSet = true;
     }
   }
@@ -85,22 +85,22 @@ void NatGatewayAddress::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_publicIpHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PublicIp=" << StringUtils::URLEncode(m_publicIp.c_str()) << "&";
+      oStream << location << index << locationValue << ".PublicIp=" << StringUtils::URLEncoded(m_publicIp) << "&";
   }
 
   if(m_allocationIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AllocationId=" << StringUtils::URLEncode(m_allocationId.c_str()) << "&";
+      oStream << location << index << locationValue << ".AllocationId=" << StringUtils::URLEncoded(m_allocationId) << "&";
   }
 
   if(m_privateIpHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrivateIp=" << StringUtils::URLEncode(m_privateIp.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrivateIp=" << StringUtils::URLEncoded(m_privateIp) << "&";
   }
 
   if(m_networkInterfaceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
 
 }
@@ -109,19 +109,19 @@ void NatGatewayAddress::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_publicIpHasBeenSet)
   {
-      oStream << location << ".PublicIp=" << StringUtils::URLEncode(m_publicIp.c_str()) << "&";
+      oStream << location << ".PublicIp=" << StringUtils::URLEncoded(m_publicIp) << "&";
   }
   if(m_allocationIdHasBeenSet)
   {
-      oStream << location << ".AllocationId=" << StringUtils::URLEncode(m_allocationId.c_str()) << "&";
+      oStream << location << ".AllocationId=" << StringUtils::URLEncoded(m_allocationId) << "&";
   }
   if(m_privateIpHasBeenSet)
   {
-      oStream << location << ".PrivateIp=" << StringUtils::URLEncode(m_privateIp.c_str()) << "&";
+      oStream << location << ".PrivateIp=" << StringUtils::URLEncoded(m_privateIp) << "&";
   }
   if(m_networkInterfaceIdHasBeenSet)
   {
-      oStream << location << ".NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+      oStream << location << ".NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,19 +62,19 @@ NetworkAcl& NetworkAcl::operator =(const XmlNode& xmlNode)
     XmlNode networkAclIdNode = resultNode.FirstChild("networkAclId");
     if(!networkAclIdNode.IsNull())
     {
-      m_networkAclId = StringUtils::Trim(networkAclIdNode.GetText().c_str());
+      m_networkAclId = networkAclIdNode.GetTextView().Trim().ToString();
       m_networkAclIdHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("vpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode isDefaultNode = resultNode.FirstChild("default");
     if(!isDefaultNode.IsNull())
     {
-      m_isDefault = StringUtils::ConvertToBool(StringUtils::Trim(isDefaultNode.GetText().c_str()).c_str());
+      m_isDefault = StringUtils::ConvertToBool(isDefaultNode.GetTextView().Trim().ToString().c_str());
       m_isDefaultHasBeenSet = true;
     }
     XmlNode entriesNode = resultNode.FirstChild("entrySet");
@@ -121,12 +122,12 @@ void NetworkAcl::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_networkAclIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NetworkAclId=" << StringUtils::URLEncode(m_networkAclId.c_str()) << "&";
+      oStream << location << index << locationValue << ".NetworkAclId=" << StringUtils::URLEncoded(m_networkAclId) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_isDefaultHasBeenSet)
@@ -139,9 +140,9 @@ void NetworkAcl::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned entriesIdx = 1;
       for(auto& item : m_entries)
       {
-        Aws::StringStream entriesSs;
+        Aws::Utils::Stream::StringOutputStream entriesSs;
         entriesSs << location << index << locationValue << ".EntrySet." << entriesIdx++;
-        item.OutputToStream(oStream, entriesSs.str().c_str());
+        item.OutputToStream(oStream, entriesSs.GetString().c_str());
       }
   }
 
@@ -150,9 +151,9 @@ void NetworkAcl::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned associationsIdx = 1;
       for(auto& item : m_associations)
       {
-        Aws::StringStream associationsSs;
+        Aws::Utils::Stream::StringOutputStream associationsSs;
         associationsSs << location << index << locationValue << ".AssociationSet." << associationsIdx++;
-        item.OutputToStream(oStream, associationsSs.str().c_str());
+        item.OutputToStream(oStream, associationsSs.GetString().c_str());
       }
   }
 
@@ -161,9 +162,9 @@ void NetworkAcl::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -173,11 +174,11 @@ void NetworkAcl::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_networkAclIdHasBeenSet)
   {
-      oStream << location << ".NetworkAclId=" << StringUtils::URLEncode(m_networkAclId.c_str()) << "&";
+      oStream << location << ".NetworkAclId=" << StringUtils::URLEncoded(m_networkAclId) << "&";
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_isDefaultHasBeenSet)
   {
@@ -188,9 +189,9 @@ void NetworkAcl::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned entriesIdx = 1;
       for(auto& item : m_entries)
       {
-        Aws::StringStream entriesSs;
+        Aws::Utils::Stream::StringOutputStream entriesSs;
         entriesSs << location <<  ".item." << entriesIdx++;
-        item.OutputToStream(oStream, entriesSs.str().c_str());
+        item.OutputToStream(oStream, entriesSs.GetString().c_str());
       }
   }
   if(m_associationsHasBeenSet)
@@ -198,9 +199,9 @@ void NetworkAcl::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned associationsIdx = 1;
       for(auto& item : m_associations)
       {
-        Aws::StringStream associationsSs;
+        Aws::Utils::Stream::StringOutputStream associationsSs;
         associationsSs << location <<  ".item." << associationsIdx++;
-        item.OutputToStream(oStream, associationsSs.str().c_str());
+        item.OutputToStream(oStream, associationsSs.GetString().c_str());
       }
   }
   if(m_tagsHasBeenSet)
@@ -208,9 +209,9 @@ void NetworkAcl::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
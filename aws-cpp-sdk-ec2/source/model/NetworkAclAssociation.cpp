@@ -53,19 +53,19 @@ NetworkAclAssociation& NetworkAclAssociation::operator =(const XmlNode& xmlNode)
     XmlNode networkAclAssociationIdNode = resultNode.FirstChild("networkAclAssociationId");
     if(!networkAclAssociationIdNode.IsNull())
     {
-      m_networkAclAssociationId = StringUtils::Trim(networkAclAssociationIdNode.GetText().c_str());
+      m_networkAclAssociationId = networkAclAssociationIdNode.GetTextView().Trim().ToString();
       m_networkAclAssociationIdHasBeenSet = true;
     }
     XmlNode networkAclIdNode = resultNode.FirstChild("networkAclId");
     if(!networkAclIdNode.IsNull())
     {
-      m_networkAclId = StringUtils::Trim(networkAclIdNode.GetText().c_str());
+      m_networkAclId = networkAclIdNode.GetTextView().Trim().ToString();
       m_networkAclIdHasBeenSet = true;
     }
     XmlNode subnetIdNode = resultNode.FirstChild("subnetId");
     if(!subnetIdNode.IsNull())
     {
-      m_subnetId = StringUtils::Trim(subnetIdNode.GetText().c_str());
+      m_subnetId = subnetIdNode.GetTextView().Trim().ToString();
       m_subnetIdHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void NetworkAclAssociation::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_networkAclAssociationIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NetworkAclAssociationId=" << StringUtils::URLEncode(m_networkAclAssociationId.c_str()) << "&";
+      oStream << location << index << locationValue << ".NetworkAclAssociationId=" << StringUtils::URLEncoded(m_networkAclAssociationId) << "&";
   }
 
   if(m_networkAclIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NetworkAclId=" << StringUtils::URLEncode(m_networkAclId.c_str()) << "&";
+      oStream << location << index << locationValue << ".NetworkAclId=" << StringUtils::URLEncoded(m_networkAclId) << "&";
   }
 
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void NetworkAclAssociation::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_networkAclAssociationIdHasBeenSet)
   {
-      oStream << location << ".NetworkAclAssociationId=" << StringUtils::URLEncode(m_networkAclAssociationId.c_str()) << "&";
+      oStream << location << ".NetworkAclAssociationId=" << StringUtils::URLEncoded(m_networkAclAssociationId) << "&";
   }
   if(m_networkAclIdHasBeenSet)
   {
-      oStream << location << ".NetworkAclId=" << StringUtils::URLEncode(m_networkAclId.c_str()) << "&";
+      oStream << location << ".NetworkAclId=" << StringUtils::URLEncoded(m_networkAclId) << "&";
   }
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -65,31 +66,31 @@ NetworkAclEntry& NetworkAclEntry::operator =(const XmlNode& xmlNode)
     XmlNode ruleNumberNode = resultNode.FirstChild("ruleNumber");
     if(!ruleNumberNode.IsNull())
     {
-      m_ruleNumber = StringUtils::ConvertToInt32(StringUtils::Trim(ruleNumberNode.GetText().c_str()).c_str());
+      m_ruleNumber = StringUtils::ConvertToInt32(ruleNumberNode.GetTextView().Trim().ToString().c_str());
       m_ruleNumberHasBeenSet = true;
     }
     XmlNode protocolNode = resultNode.FirstChild("protocol");
     if(!protocolNode.IsNull())
     {
-      m_protocol = StringUtils::Trim(protocolNode.GetText().c_str());
+      m_protocol = protocolNode.GetTextView().Trim().ToString();
       m_protocolHasBeenSet = true;
     }
     XmlNode ruleActionNode = resultNode.FirstChild("ruleAction");
     if(!ruleActionNode.IsNull())
     {
-      m_ruleAction = RuleActionMapper::GetRuleActionForName(StringUtils::Trim(ruleActionNode.GetText().c_str()).c_str());
+      m_ruleAction = RuleActionMapper::GetRuleActionForName(ruleActionNode.GetTextView().Trim().ToString().c_str());
       m_ruleActionHasBeenSet = true;
     }
     XmlNode egressNode = resultNode.FirstChild("egress");
     if(!egressNode.IsNull())
     {
-      m_egress = StringUtils::ConvertToBool(StringUtils::Trim(egressNode.GetText().c_str()).c_str());
+      m_egress = StringUtils::ConvertToBool(egressNode.GetTextView().Trim().ToString().c_str());
       m_egressHasBeenSet = true;
     }
     XmlNode cidrBlockNode = resultNode.FirstChild("cidrBlock");
     if(!cidrBlockNode.IsNull())
     {
-      m_cidrBlock = StringUtils::Trim(cidrBlockNode.GetText().c_str());
+      m_cidrBlock = cidrBlockNode.GetTextView().Trim().ToString();
       m_cidrBlockHasBeenSet = true;
     }
     XmlNode icmpTypeCodeNode = resultNode.FirstChild("icmpTypeCode");
@@ -118,7 +119,7 @@ void NetworkAclEntry::OutputToStream(Aws::OStream& oStream, const char* location
 
   if(m_protocolHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Protocol=" << StringUtils::URLEncode(m_protocol.c_str()) << "&";
+      oStream << location << index << locationValue << ".Protocol=" << StringUtils::URLEncoded(m_protocol) << "&";
   }
 
   if(m_ruleActionHasBeenSet)
@@ -133,21 +134,21 @@ void NetworkAclEntry::OutputToStream(Aws::OStream& oStream, const char* location
 
   if(m_cidrBlockHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CidrBlock=" << StringUtils::URLEncode(m_cidrBlock.c_str()) << "&";
+      oStream << location << index << locationValue << ".CidrBlock=" << StringUtils::URLEncoded(m_cidrBlock) << "&";
   }
 
   if(m_icmpTypeCodeHasBeenSet)
   {
-      Aws::StringStream icmpTypeCodeLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream icmpTypeCodeLocationAndMemberSs;
       icmpTypeCodeLocationAndMemberSs << location << index << locationValue << ".IcmpTypeCode";
-      m_icmpTypeCode.OutputToStream(oStream, icmpTypeCodeLocationAndMemberSs.str().c_str());
+      m_icmpTypeCode.OutputToStream(oStream, icmpTypeCodeLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_portRangeHasBeenSet)
   {
-      Aws::StringStream portRangeLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream portRangeLocationAndMemberSs;
       portRangeLocationAndMemberSs << location << index << locationValue << ".PortRange";
-      m_portRange.OutputToStream(oStream, portRangeLocationAndMemberSs.str().c_str());
+      m_portRange.OutputToStream(oStream, portRangeLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -160,7 +161,7 @@ void NetworkAclEntry::OutputToStream(Aws::OStream& oStream, const char* location
   }
   if(m_protocolHasBeenSet)
   {
-      oStream << location << ".Protocol=" << StringUtils::URLEncode(m_protocol.c_str()) << "&";
+      oStream << location << ".Protocol=" << StringUtils::URLEncoded(m_protocol) << "&";
   }
   if(m_ruleActionHasBeenSet)
   {
@@ -172,7 +173,7 @@ void NetworkAclEntry::OutputToStream(Aws::OStream& oStream, const char* location
   }
   if(m_cidrBlockHasBeenSet)
   {
-      oStream << location << ".CidrBlock=" << StringUtils::URLEncode(m_cidrBlock.c_str()) << "&";
+      oStream << location << ".CidrBlock=" << StringUtils::URLEncoded(m_cidrBlock) << "&";
   }
   if(m_icmpTypeCodeHasBeenSet)
   {
@@ -57,31 +57,31 @@ NetworkInterfaceAssociation& NetworkInterfaceAssociation::operator =(const XmlNo
     XmlNode publicIpNode = resultNode.FirstChild("publicIp");
     if(!publicIpNode.IsNull())
     {
-      m_publicIp = StringUtils::Trim(publicIpNode.GetText().c_str());
+      m_publicIp = publicIpNode.GetTextView().Trim().ToString();
       m_publicIpHasBeenSet = true;
     }
     XmlNode publicDnsNameNode = resultNode.FirstChild("publicDnsName");
     if(!publicDnsNameNode.IsNull())
     {
-      m_publicDnsName = StringUtils::Trim(publicDnsNameNode.GetText().c_str());
+      m_publicDnsName = publicDnsNameNode.GetTextView().Trim().ToString();
       m_publicDnsNameHasBeenSet = true;
     }
     XmlNode ipOwnerIdNode = resultNode.FirstChild("ipOwnerId");
     if(!ipOwnerIdNode.IsNull())
     {
-      m_ipOwnerId = StringUtils::Trim(ipOwnerIdNode.GetText().c_str());
+      m_ipOwnerId = ipOwnerIdNode.GetTextView().Trim().ToString();
       m_ipOwnerIdHasBeenSet = true;
     }
     XmlNode allocationIdNode = resultNode.FirstChild("allocationId");
     if(!allocationIdNode.IsNull())
     {
-      m_allocationId = StringUtils::Trim(allocationIdNode.GetText().c_str());
+      m_allocationId = allocationIdNode.GetTextView().Trim().ToString();
       m_allocationIdHasBeenSet = true;
     }
     XmlNode associationIdNode = resultNode.FirstChild("associationId");
     if(!associationIdNode.IsNull())
     {
-      m_associationId = StringUtils::Trim(associationIdNode.GetText().c_str());
+      m_associationId = associationIdNode.GetTextView().Trim().ToString();
       m_associationIdHasBeenSet = true;
     }
   }
@@ -93,27 +93,27 @@ void NetworkInterfaceAssociation::OutputToStream(Aws::OStream& oStream, const ch
 {
   if(m_publicIpHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PublicIp=" << StringUtils::URLEncode(m_publicIp.c_str()) << "&";
+      oStream << location << index << locationValue << ".PublicIp=" << StringUtils::URLEncoded(m_publicIp) << "&";
   }
 
   if(m_publicDnsNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PublicDnsName=" << StringUtils::URLEncode(m_publicDnsName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PublicDnsName=" << StringUtils::URLEncoded(m_publicDnsName) << "&";
   }
 
   if(m_ipOwnerIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".IpOwnerId=" << StringUtils::URLEncode(m_ipOwnerId.c_str()) << "&";
+      oStream << location << index << locationValue << ".IpOwnerId=" << StringUtils::URLEncoded(m_ipOwnerId) << "&";
   }
 
   if(m_allocationIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AllocationId=" << StringUtils::URLEncode(m_allocationId.c_str()) << "&";
+      oStream << location << index << locationValue << ".AllocationId=" << StringUtils::URLEncoded(m_allocationId) << "&";
   }
 
   if(m_associationIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AssociationId=" << StringUtils::URLEncode(m_associationId.c_str()) << "&";
+      oStream << location << index << locationValue << ".AssociationId=" << StringUtils::URLEncoded(m_associationId) << "&";
   }
 
 }
@@ -122,23 +122,23 @@ void NetworkInterfaceAssociation::OutputToStream(Aws::OStream& oStream, const ch
 {
   if(m_publicIpHasBeenSet)
   {
-      oStream << location << ".PublicIp=" << StringUtils::URLEncode(m_publicIp.c_str()) << "&";
+      oStream << location << ".PublicIp=" << StringUtils::URLEncoded(m_publicIp) << "&";
   }
   if(m_publicDnsNameHasBeenSet)
   {
-      oStream << location << ".PublicDnsName=" << StringUtils::URLEncode(m_publicDnsName.c_str()) << "&";
+      oStream << location << ".PublicDnsName=" << StringUtils::URLEncoded(m_publicDnsName) << "&";
   }
   if(m_ipOwnerIdHasBeenSet)
   {
-      oStream << location << ".IpOwnerId=" << StringUtils::URLEncode(m_ipOwnerId.c_str()) << "&";
+      oStream << location << ".IpOwnerId=" << StringUtils::URLEncoded(m_ipOwnerId) << "&";
   }
   if(m_allocationIdHasBeenSet)
   {
-      oStream << location << ".AllocationId=" << StringUtils::URLEncode(m_allocationId.c_str()) << "&";
+      oStream << location << ".AllocationId=" << StringUtils::URLEncoded(m_allocationId) << "&";
   }
   if(m_associationIdHasBeenSet)
   {
-      oStream << location << ".AssociationId=" << StringUtils::URLEncode(m_associationId.c_str()) << "&";
+      oStream << location << ".AssociationId=" << StringUtils::URLEncoded(m_associationId) << "&";
   }
 }
 
@@ -65,43 +65,43 @@ NetworkInterfaceAttachment& NetworkInterfaceAttachment::operator =(const XmlNode
     XmlNode attachmentIdNode = resultNode.FirstChild("attachmentId");
     if(!attachmentIdNode.IsNull())
     {
-      m_attachmentId = StringUtils::Trim(attachmentIdNode.GetText().c_str());
+      m_attachmentId = attachmentIdNode.GetTextView().Trim().ToString();
       m_attachmentIdHasBeenSet = true;
     }
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode instanceOwnerIdNode = resultNode.FirstChild("instanceOwnerId");
     if(!instanceOwnerIdNode.IsNull())
     {
-      m_instanceOwnerId = StringUtils::Trim(instanceOwnerIdNode.GetText().c_str());
+      m_instanceOwnerId = instanceOwnerIdNode.GetTextView().Trim().ToString();
       m_instanceOwnerIdHasBeenSet = true;
     }
     XmlNode deviceIndexNode = resultNode.FirstChild("deviceIndex");
     if(!deviceIndexNode.IsNull())
     {
-      m_deviceIndex = StringUtils::ConvertToInt32(StringUtils::Trim(deviceIndexNode.GetText().c_str()).c_str());
+      m_deviceIndex = StringUtils::ConvertToInt32(deviceIndexNode.GetTextView().Trim().ToString().c_str());
       m_deviceIndexHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = AttachmentStatusMapper::GetAttachmentStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = AttachmentStatusMapper::GetAttachmentStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode attachTimeNode = resultNode.FirstChild("attachTime");
     if(!attachTimeNode.IsNull())
     {
-      m_attachTime = DateTime(StringUtils::Trim(attachTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_attachTime = DateTime(attachTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_attachTimeHasBeenSet = true;
     }
     XmlNode deleteOnTerminationNode = resultNode.FirstChild("deleteOnTermination");
     if(!deleteOnTerminationNode.IsNull())
     {
-      m_deleteOnTermination = StringUtils::ConvertToBool(StringUtils::Trim(deleteOnTerminationNode.GetText().c_str()).c_str());
+      m_deleteOnTermination = StringUtils::ConvertToBool(deleteOnTerminationNode.GetTextView().Trim().ToString().c_str());
       m_deleteOnTerminationHasBeenSet = true;
     }
   }
@@ -113,17 +113,17 @@ void NetworkInterfaceAttachment::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_attachmentIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AttachmentId=" << StringUtils::URLEncode(m_attachmentId.c_str()) << "&";
+      oStream << location << index << locationValue << ".AttachmentId=" << StringUtils::URLEncoded(m_attachmentId) << "&";
   }
 
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_instanceOwnerIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceOwnerId=" << StringUtils::URLEncode(m_instanceOwnerId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceOwnerId=" << StringUtils::URLEncoded(m_instanceOwnerId) << "&";
   }
 
   if(m_deviceIndexHasBeenSet)
@@ -138,7 +138,7 @@ void NetworkInterfaceAttachment::OutputToStream(Aws::OStream& oStream, const cha
 
   if(m_attachTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AttachTime=" << StringUtils::URLEncode(m_attachTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".AttachTime=" << StringUtils::URLEncoded(m_attachTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_deleteOnTerminationHasBeenSet)
@@ -152,15 +152,15 @@ void NetworkInterfaceAttachment::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_attachmentIdHasBeenSet)
   {
-      oStream << location << ".AttachmentId=" << StringUtils::URLEncode(m_attachmentId.c_str()) << "&";
+      oStream << location << ".AttachmentId=" << StringUtils::URLEncoded(m_attachmentId) << "&";
   }
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_instanceOwnerIdHasBeenSet)
   {
-      oStream << location << ".InstanceOwnerId=" << StringUtils::URLEncode(m_instanceOwnerId.c_str()) << "&";
+      oStream << location << ".InstanceOwnerId=" << StringUtils::URLEncoded(m_instanceOwnerId) << "&";
   }
   if(m_deviceIndexHasBeenSet)
   {
@@ -172,7 +172,7 @@ void NetworkInterfaceAttachment::OutputToStream(Aws::OStream& oStream, const cha
   }
   if(m_attachTimeHasBeenSet)
   {
-      oStream << location << ".AttachTime=" << StringUtils::URLEncode(m_attachTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".AttachTime=" << StringUtils::URLEncoded(m_attachTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_deleteOnTerminationHasBeenSet)
   {
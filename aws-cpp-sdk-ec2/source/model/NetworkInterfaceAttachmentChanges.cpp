@@ -53,13 +53,13 @@ NetworkInterfaceAttachmentChanges& NetworkInterfaceAttachmentChanges::operator =
     XmlNode attachmentIdNode = resultNode.FirstChild("attachmentId");
     if(!attachmentIdNode.IsNull())
     {
-      m_attachmentId = StringUtils::Trim(attachmentIdNode.GetText().c_str());
+      m_attachmentId = attachmentIdNode.GetTextView().Trim().ToString();
       m_attachmentIdHasBeenSet = true;
     }
     XmlNode deleteOnTerminationNode = resultNode.FirstChild("deleteOnTermination");
     if(!deleteOnTerminationNode.IsNull())
     {
-      m_deleteOnTermination = StringUtils::ConvertToBool(StringUtils::Trim(deleteOnTerminationNode.GetText().c_str()).c_str());
+      m_deleteOnTermination = StringUtils::ConvertToBool(deleteOnTerminationNode.GetTextView().Trim().ToString().c_str());
       m_deleteOnTerminationHasBeenSet = true;
     }
   }
@@ -71,7 +71,7 @@ void NetworkInterfaceAttachmentChanges::OutputToStream(Aws::OStream& oStream, co
 {
   if(m_attachmentIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AttachmentId=" << StringUtils::URLEncode(m_attachmentId.c_str()) << "&";
+      oStream << location << index << locationValue << ".AttachmentId=" << StringUtils::URLEncoded(m_attachmentId) << "&";
   }
 
   if(m_deleteOnTerminationHasBeenSet)
@@ -85,7 +85,7 @@ void NetworkInterfaceAttachmentChanges::OutputToStream(Aws::OStream& oStream, co
 {
   if(m_attachmentIdHasBeenSet)
   {
-      oStream << location << ".AttachmentId=" << StringUtils::URLEncode(m_attachmentId.c_str()) << "&";
+      oStream << location << ".AttachmentId=" << StringUtils::URLEncoded(m_attachmentId) << "&";
   }
   if(m_deleteOnTerminationHasBeenSet)
   {
@@ -29,31 +29,35 @@ namespace Aws
       namespace NetworkInterfaceAttributeMapper
       {
 
-        static const int description_HASH = HashingUtils::HashString("description");
-        static const int groupSet_HASH = HashingUtils::HashString("groupSet");
-        static const int sourceDestCheck_HASH = HashingUtils::HashString("sourceDestCheck");
-        static const int attachment_HASH = HashingUtils::HashString("attachment");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int description_HASH = -1724546052;
+        static const int groupSet_HASH = 506349923;
+        static const int sourceDestCheck_HASH = -1670942293;
+        static const int attachment_HASH = -1963501277;
 
 
         NetworkInterfaceAttribute GetNetworkInterfaceAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == description_HASH)
+          switch (hashCode)
           {
+          case description_HASH:
             return NetworkInterfaceAttribute::description;
-          }
-          else if (hashCode == groupSet_HASH)
-          {
+          case groupSet_HASH:
             return NetworkInterfaceAttribute::groupSet;
-          }
-          else if (hashCode == sourceDestCheck_HASH)
-          {
+          case sourceDestCheck_HASH:
             return NetworkInterfaceAttribute::sourceDestCheck;
-          }
-          else if (hashCode == attachment_HASH)
-          {
+          case attachment_HASH:
             return NetworkInterfaceAttribute::attachment;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
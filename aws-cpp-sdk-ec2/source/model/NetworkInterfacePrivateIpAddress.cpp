@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -57,19 +58,19 @@ NetworkInterfacePrivateIpAddress& NetworkInterfacePrivateIpAddress::operator =(c
     XmlNode privateIpAddressNode = resultNode.FirstChild("privateIpAddress");
     if(!privateIpAddressNode.IsNull())
     {
-      m_privateIpAddress = StringUtils::Trim(privateIpAddressNode.GetText().c_str());
+      m_privateIpAddress = privateIpAddressNode.GetTextView().Trim().ToString();
       m_privateIpAddressHasBeenSet = true;
     }
     XmlNode privateDnsNameNode = resultNode.FirstChild("privateDnsName");
     if(!privateDnsNameNode.IsNull())
     {
-      m_privateDnsName = StringUtils::Trim(privateDnsNameNode.GetText().c_str());
+      m_privateDnsName = privateDnsNameNode.GetTextView().Trim().ToString();
       m_privateDnsNameHasBeenSet = true;
     }
     XmlNode primaryNode = resultNode.FirstChild("primary");
     if(!primaryNode.IsNull())
     {
-      m_primary = StringUtils::ConvertToBool(StringUtils::Trim(primaryNode.GetText().c_str()).c_str());
+      m_primary = StringUtils::ConvertToBool(primaryNode.GetTextView().Trim().ToString().c_str());
       m_primaryHasBeenSet = true;
     }
     XmlNode associationNode = resultNode.FirstChild("association");
@@ -87,12 +88,12 @@ void NetworkInterfacePrivateIpAddress::OutputToStream(Aws::OStream& oStream, con
 {
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
 
   if(m_privateDnsNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrivateDnsName=" << StringUtils::URLEncode(m_privateDnsName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrivateDnsName=" << StringUtils::URLEncoded(m_privateDnsName) << "&";
   }
 
   if(m_primaryHasBeenSet)
@@ -102,9 +103,9 @@ void NetworkInterfacePrivateIpAddress::OutputToStream(Aws::OStream& oStream, con
 
   if(m_associationHasBeenSet)
   {
-      Aws::StringStream associationLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream associationLocationAndMemberSs;
       associationLocationAndMemberSs << location << index << locationValue << ".Association";
-      m_association.OutputToStream(oStream, associationLocationAndMemberSs.str().c_str());
+      m_association.OutputToStream(oStream, associationLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -113,11 +114,11 @@ void NetworkInterfacePrivateIpAddress::OutputToStream(Aws::OStream& oStream, con
 {
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
   if(m_privateDnsNameHasBeenSet)
   {
-      oStream << location << ".PrivateDnsName=" << StringUtils::URLEncode(m_privateDnsName.c_str()) << "&";
+      oStream << location << ".PrivateDnsName=" << StringUtils::URLEncoded(m_privateDnsName) << "&";
   }
   if(m_primaryHasBeenSet)
   {
@@ -29,31 +29,35 @@ namespace Aws
       namespace NetworkInterfaceStatusMapper
       {
 
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int attaching_HASH = HashingUtils::HashString("attaching");
-        static const int in_use_HASH = HashingUtils::HashString("in-use");
-        static const int detaching_HASH = HashingUtils::HashString("detaching");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int available_HASH = -733902135;
+        static const int attaching_HASH = -478984323;
+        static const int in_use_HASH = -1185862433;
+        static const int detaching_HASH = -1978731665;
 
 
         NetworkInterfaceStatus GetNetworkInterfaceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == available_HASH)
+          switch (hashCode)
           {
+          case available_HASH:
             return NetworkInterfaceStatus::available;
-          }
-          else if (hashCode == attaching_HASH)
-          {
+          case attaching_HASH:
             return NetworkInterfaceStatus::attaching;
-          }
-          else if (hashCode == in_use_HASH)
-          {
+          case in_use_HASH:
             return NetworkInterfaceStatus::in_use;
-          }
-          else if (hashCode == detaching_HASH)
-          {
+          case detaching_HASH:
             return NetworkInterfaceStatus::detaching;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
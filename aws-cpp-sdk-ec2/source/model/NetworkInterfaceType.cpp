@@ -29,21 +29,29 @@ namespace Aws
       namespace NetworkInterfaceTypeMapper
       {
 
-        static const int interface_HASH = HashingUtils::HashString("interface");
-        static const int natGateway_HASH = HashingUtils::HashString("natGateway");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int interface_HASH = 502623545;
+        static const int natGateway_HASH = -1887969821;
 
 
         NetworkInterfaceType GetNetworkInterfaceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == interface_HASH)
+          switch (hashCode)
           {
+          case interface_HASH:
             return NetworkInterfaceType::interface;
-          }
-          else if (hashCode == natGateway_HASH)
-          {
+          case natGateway_HASH:
             return NetworkInterfaceType::natGateway;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
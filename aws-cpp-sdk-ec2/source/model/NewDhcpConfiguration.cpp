@@ -51,7 +51,7 @@ NewDhcpConfiguration& NewDhcpConfiguration::operator =(const XmlNode& xmlNode)
     XmlNode keyNode = resultNode.FirstChild("key");
     if(!keyNode.IsNull())
     {
-      m_key = StringUtils::Trim(keyNode.GetText().c_str());
+      m_key = keyNode.GetTextView().Trim().ToString();
       m_keyHasBeenSet = true;
     }
     XmlNode valuesNode = resultNode.FirstChild("Value");
@@ -60,7 +60,7 @@ NewDhcpConfiguration& NewDhcpConfiguration::operator =(const XmlNode& xmlNode)
       XmlNode valuesMember = valuesNode.FirstChild("item");
       while(!valuesMember.IsNull())
       {
-        m_values.push_back(StringUtils::Trim(valuesMember.GetText().c_str()));
+        m_values.push_back(valuesMember.GetTextView().Trim().ToString());
         valuesMember = valuesMember.NextNode("item");
       }
 
@@ -75,7 +75,7 @@ void NewDhcpConfiguration::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_keyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Key=" << StringUtils::URLEncode(m_key.c_str()) << "&";
+      oStream << location << index << locationValue << ".Key=" << StringUtils::URLEncoded(m_key) << "&";
   }
 
   if(m_valuesHasBeenSet)
@@ -83,7 +83,7 @@ void NewDhcpConfiguration::OutputToStream(Aws::OStream& oStream, const char* loc
       unsigned valuesIdx = 1;
       for(auto& item : m_values)
       {
-        oStream << location << index << locationValue << ".Value." << valuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".Value." << valuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -93,14 +93,14 @@ void NewDhcpConfiguration::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_keyHasBeenSet)
   {
-      oStream << location << ".Key=" << StringUtils::URLEncode(m_key.c_str()) << "&";
+      oStream << location << ".Key=" << StringUtils::URLEncoded(m_key) << "&";
   }
   if(m_valuesHasBeenSet)
   {
       unsigned valuesIdx = 1;
       for(auto& item : m_values)
       {
-        oStream << location << ".item." << valuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".item." << valuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
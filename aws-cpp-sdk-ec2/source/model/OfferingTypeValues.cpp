@@ -29,41 +29,41 @@ namespace Aws
       namespace OfferingTypeValuesMapper
       {
 
-        static const int Heavy_Utilization_HASH = HashingUtils::HashString("Heavy Utilization");
-        static const int Medium_Utilization_HASH = HashingUtils::HashString("Medium Utilization");
-        static const int Light_Utilization_HASH = HashingUtils::HashString("Light Utilization");
-        static const int No_Upfront_HASH = HashingUtils::HashString("No Upfront");
-        static const int Partial_Upfront_HASH = HashingUtils::HashString("Partial Upfront");
-        static const int All_Upfront_HASH = HashingUtils::HashString("All Upfront");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Heavy_Utilization_HASH = -716849143;
+        static const int Medium_Utilization_HASH = -173259273;
+        static const int Light_Utilization_HASH = -1230436904;
+        static const int No_Upfront_HASH = 160793871;
+        static const int Partial_Upfront_HASH = -595895153;
+        static const int All_Upfront_HASH = -1149969233;
 
 
         OfferingTypeValues GetOfferingTypeValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Heavy_Utilization_HASH)
+          switch (hashCode)
           {
+          case Heavy_Utilization_HASH:
             return OfferingTypeValues::Heavy_Utilization;
-          }
-          else if (hashCode == Medium_Utilization_HASH)
-          {
+          case Medium_Utilization_HASH:
             return OfferingTypeValues::Medium_Utilization;
-          }
-          else if (hashCode == Light_Utilization_HASH)
-          {
+          case Light_Utilization_HASH:
             return OfferingTypeValues::Light_Utilization;
-          }
-          else if (hashCode == No_Upfront_HASH)
-          {
+          case No_Upfront_HASH:
             return OfferingTypeValues::No_Upfront;
-          }
-          else if (hashCode == Partial_Upfront_HASH)
-          {
+          case Partial_Upfront_HASH:
             return OfferingTypeValues::Partial_Upfront;
-          }
-          else if (hashCode == All_Upfront_HASH)
-          {
+          case All_Upfront_HASH:
             return OfferingTypeValues::All_Upfront;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
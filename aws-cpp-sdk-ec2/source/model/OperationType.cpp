@@ -29,21 +29,29 @@ namespace Aws
       namespace OperationTypeMapper
       {
 
-        static const int add_HASH = HashingUtils::HashString("add");
-        static const int remove_HASH = HashingUtils::HashString("remove");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int add_HASH = 96417;
+        static const int remove_HASH = -934610812;
 
 
         OperationType GetOperationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == add_HASH)
+          switch (hashCode)
           {
+          case add_HASH:
             return OperationType::add;
-          }
-          else if (hashCode == remove_HASH)
-          {
+          case remove_HASH:
             return OperationType::remove;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
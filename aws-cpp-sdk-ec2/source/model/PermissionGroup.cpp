@@ -29,16 +29,26 @@ namespace Aws
       namespace PermissionGroupMapper
       {
 
-        static const int all_HASH = HashingUtils::HashString("all");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int all_HASH = 96673;
 
 
         PermissionGroup GetPermissionGroupForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == all_HASH)
+          switch (hashCode)
           {
+          case all_HASH:
             return PermissionGroup::all;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -57,31 +57,31 @@ Placement& Placement::operator =(const XmlNode& xmlNode)
     XmlNode availabilityZoneNode = resultNode.FirstChild("availabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode groupNameNode = resultNode.FirstChild("groupName");
     if(!groupNameNode.IsNull())
     {
-      m_groupName = StringUtils::Trim(groupNameNode.GetText().c_str());
+      m_groupName = groupNameNode.GetTextView().Trim().ToString();
       m_groupNameHasBeenSet = true;
     }
     XmlNode tenancyNode = resultNode.FirstChild("tenancy");
     if(!tenancyNode.IsNull())
     {
-      m_tenancy = TenancyMapper::GetTenancyForName(StringUtils::Trim(tenancyNode.GetText().c_str()).c_str());
+      m_tenancy = TenancyMapper::GetTenancyForName(tenancyNode.GetTextView().Trim().ToString().c_str());
       m_tenancyHasBeenSet = true;
     }
     XmlNode hostIdNode = resultNode.FirstChild("hostId");
     if(!hostIdNode.IsNull())
     {
-      m_hostId = StringUtils::Trim(hostIdNode.GetText().c_str());
+      m_hostId = hostIdNode.GetTextView().Trim().ToString();
       m_hostIdHasBeenSet = true;
     }
     XmlNode affinityNode = resultNode.FirstChild("affinity");
     if(!affinityNode.IsNull())
     {
-      m_affinity = StringUtils::Trim(affinityNode.GetText().c_str());
+      m_affinity = affinityNode.GetTextView().Trim().ToString();
       m_affinityHasBeenSet = true;
     }
   }
@@ -93,12 +93,12 @@ void Placement::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 {
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   if(m_tenancyHasBeenSet)
@@ -108,12 +108,12 @@ void Placement::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 
   if(m_hostIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HostId=" << StringUtils::URLEncode(m_hostId.c_str()) << "&";
+      oStream << location << index << locationValue << ".HostId=" << StringUtils::URLEncoded(m_hostId) << "&";
   }
 
   if(m_affinityHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Affinity=" << StringUtils::URLEncode(m_affinity.c_str()) << "&";
+      oStream << location << index << locationValue << ".Affinity=" << StringUtils::URLEncoded(m_affinity) << "&";
   }
 
 }
@@ -122,11 +122,11 @@ void Placement::OutputToStream(Aws::OStream& oStream, const char* location) cons
 {
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
   if(m_tenancyHasBeenSet)
   {
@@ -134,11 +134,11 @@ void Placement::OutputToStream(Aws::OStream& oStream, const char* location) cons
   }
   if(m_hostIdHasBeenSet)
   {
-      oStream << location << ".HostId=" << StringUtils::URLEncode(m_hostId.c_str()) << "&";
+      oStream << location << ".HostId=" << StringUtils::URLEncoded(m_hostId) << "&";
   }
   if(m_affinityHasBeenSet)
   {
-      oStream << location << ".Affinity=" << StringUtils::URLEncode(m_affinity.c_str()) << "&";
+      oStream << location << ".Affinity=" << StringUtils::URLEncoded(m_affinity) << "&";
   }
 }
 
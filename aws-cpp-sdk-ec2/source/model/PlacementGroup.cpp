@@ -53,19 +53,19 @@ PlacementGroup& PlacementGroup::operator =(const XmlNode& xmlNode)
     XmlNode groupNameNode = resultNode.FirstChild("groupName");
     if(!groupNameNode.IsNull())
     {
-      m_groupName = StringUtils::Trim(groupNameNode.GetText().c_str());
+      m_groupName = groupNameNode.GetTextView().Trim().ToString();
       m_groupNameHasBeenSet = true;
     }
     XmlNode strategyNode = resultNode.FirstChild("strategy");
     if(!strategyNode.IsNull())
     {
-      m_strategy = PlacementStrategyMapper::GetPlacementStrategyForName(StringUtils::Trim(strategyNode.GetText().c_str()).c_str());
+      m_strategy = PlacementStrategyMapper::GetPlacementStrategyForName(strategyNode.GetTextView().Trim().ToString().c_str());
       m_strategyHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = PlacementGroupStateMapper::GetPlacementGroupStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = PlacementGroupStateMapper::GetPlacementGroupStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
   }
@@ -77,7 +77,7 @@ void PlacementGroup::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   if(m_strategyHasBeenSet)
@@ -96,7 +96,7 @@ void PlacementGroup::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
   if(m_strategyHasBeenSet)
   {
@@ -29,31 +29,35 @@ namespace Aws
       namespace PlacementGroupStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int pending_HASH = -682587753;
+        static const int available_HASH = -733902135;
+        static const int deleting_HASH = 819717032;
+        static const int deleted_HASH = 1550463001;
 
 
         PlacementGroupState GetPlacementGroupStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          switch (hashCode)
           {
+          case pending_HASH:
             return PlacementGroupState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
+          case available_HASH:
             return PlacementGroupState::available;
-          }
-          else if (hashCode == deleting_HASH)
-          {
+          case deleting_HASH:
             return PlacementGroupState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
+          case deleted_HASH:
             return PlacementGroupState::deleted;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace PlacementStrategyMapper
       {
 
-        static const int cluster_HASH = HashingUtils::HashString("cluster");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int cluster_HASH = 872092154;
 
 
         PlacementStrategy GetPlacementStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == cluster_HASH)
+          switch (hashCode)
           {
+          case cluster_HASH:
             return PlacementStrategy::cluster;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
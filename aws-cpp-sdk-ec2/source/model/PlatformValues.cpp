@@ -29,16 +29,26 @@ namespace Aws
       namespace PlatformValuesMapper
       {
 
-        static const int Windows_HASH = HashingUtils::HashString("Windows");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Windows_HASH = -1280820637;
 
 
         PlatformValues GetPlatformValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Windows_HASH)
+          switch (hashCode)
           {
+          case Windows_HASH:
             return PlatformValues::Windows;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -53,13 +53,13 @@ PrefixList& PrefixList::operator =(const XmlNode& xmlNode)
     XmlNode prefixListIdNode = resultNode.FirstChild("prefixListId");
     if(!prefixListIdNode.IsNull())
     {
-      m_prefixListId = StringUtils::Trim(prefixListIdNode.GetText().c_str());
+      m_prefixListId = prefixListIdNode.GetTextView().Trim().ToString();
       m_prefixListIdHasBeenSet = true;
     }
     XmlNode prefixListNameNode = resultNode.FirstChild("prefixListName");
     if(!prefixListNameNode.IsNull())
     {
-      m_prefixListName = StringUtils::Trim(prefixListNameNode.GetText().c_str());
+      m_prefixListName = prefixListNameNode.GetTextView().Trim().ToString();
       m_prefixListNameHasBeenSet = true;
     }
     XmlNode cidrsNode = resultNode.FirstChild("cidrSet");
@@ -68,7 +68,7 @@ PrefixList& PrefixList::operator =(const XmlNode& xmlNode)
       XmlNode cidrsMember = cidrsNode.FirstChild("item");
       while(!cidrsMember.IsNull())
       {
-        m_cidrs.push_back(StringUtils::Trim(cidrsMember.GetText().c_str()));
+        m_cidrs.push_back(cidrsMember.GetTextView().Trim().ToString());
         cidrsMember = cidrsMember.NextNode("item");
       }
 
@@ -83,12 +83,12 @@ void PrefixList::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_prefixListIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrefixListId=" << StringUtils::URLEncode(m_prefixListId.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrefixListId=" << StringUtils::URLEncoded(m_prefixListId) << "&";
   }
 
   if(m_prefixListNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrefixListName=" << StringUtils::URLEncode(m_prefixListName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrefixListName=" << StringUtils::URLEncoded(m_prefixListName) << "&";
   }
 
   if(m_cidrsHasBeenSet)
@@ -96,7 +96,7 @@ void PrefixList::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned cidrsIdx = 1;
       for(auto& item : m_cidrs)
       {
-        oStream << location << index << locationValue << ".CidrSet." << cidrsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".CidrSet." << cidrsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -106,18 +106,18 @@ void PrefixList::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_prefixListIdHasBeenSet)
   {
-      oStream << location << ".PrefixListId=" << StringUtils::URLEncode(m_prefixListId.c_str()) << "&";
+      oStream << location << ".PrefixListId=" << StringUtils::URLEncoded(m_prefixListId) << "&";
   }
   if(m_prefixListNameHasBeenSet)
   {
-      oStream << location << ".PrefixListName=" << StringUtils::URLEncode(m_prefixListName.c_str()) << "&";
+      oStream << location << ".PrefixListName=" << StringUtils::URLEncoded(m_prefixListName) << "&";
   }
   if(m_cidrsHasBeenSet)
   {
       unsigned cidrsIdx = 1;
       for(auto& item : m_cidrs)
       {
-        oStream << location << ".item." << cidrsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".item." << cidrsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
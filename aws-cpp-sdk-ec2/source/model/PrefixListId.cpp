@@ -49,7 +49,7 @@ PrefixListId& PrefixListId::operator =(const XmlNode& xmlNode)
     XmlNode prefixListIdNode = resultNode.FirstChild("prefixListId");
     if(!prefixListIdNode.IsNull())
     {
-      m_prefixListId = StringUtils::Trim(prefixListIdNode.GetText().c_str());
+      m_prefixListId = prefixListIdNode.GetTextView().Trim().ToString();
       m_prefixListIdHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void PrefixListId::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_prefixListIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrefixListId=" << StringUtils::URLEncode(m_prefixListId.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrefixListId=" << StringUtils::URLEncoded(m_prefixListId) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void PrefixListId::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_prefixListIdHasBeenSet)
   {
-      oStream << location << ".PrefixListId=" << StringUtils::URLEncode(m_prefixListId.c_str()) << "&";
+      oStream << location << ".PrefixListId=" << StringUtils::URLEncoded(m_prefixListId) << "&";
   }
 }
 
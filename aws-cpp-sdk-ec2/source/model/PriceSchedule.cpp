@@ -61,25 +61,25 @@ PriceSchedule& PriceSchedule::operator =(const XmlNode& xmlNode)
     XmlNode termNode = resultNode.FirstChild("term");
     if(!termNode.IsNull())
     {
-      m_term = StringUtils::ConvertToInt64(StringUtils::Trim(termNode.GetText().c_str()).c_str());
+      m_term = StringUtils::ConvertToInt64(termNode.GetTextView().Trim().ToString().c_str());
       m_termHasBeenSet = true;
     }
     XmlNode priceNode = resultNode.FirstChild("price");
     if(!priceNode.IsNull())
     {
-      m_price = StringUtils::ConvertToDouble(StringUtils::Trim(priceNode.GetText().c_str()).c_str());
+      m_price = StringUtils::ConvertToDouble(priceNode.GetTextView().Trim().ToString().c_str());
       m_priceHasBeenSet = true;
     }
     XmlNode currencyCodeNode = resultNode.FirstChild("currencyCode");
     if(!currencyCodeNode.IsNull())
     {
-      m_currencyCode = CurrencyCodeValuesMapper::GetCurrencyCodeValuesForName(StringUtils::Trim(currencyCodeNode.GetText().c_str()).c_str());
+      m_currencyCode = CurrencyCodeValuesMapper::GetCurrencyCodeValuesForName(currencyCodeNode.GetTextView().Trim().ToString().c_str());
       m_currencyCodeHasBeenSet = true;
     }
     XmlNode activeNode = resultNode.FirstChild("active");
     if(!activeNode.IsNull())
     {
-      m_active = StringUtils::ConvertToBool(StringUtils::Trim(activeNode.GetText().c_str()).c_str());
+      m_active = StringUtils::ConvertToBool(activeNode.GetTextView().Trim().ToString().c_str());
       m_activeHasBeenSet = true;
     }
   }
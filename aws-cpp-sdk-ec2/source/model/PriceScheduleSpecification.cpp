@@ -57,19 +57,19 @@ PriceScheduleSpecification& PriceScheduleSpecification::operator =(const XmlNode
     XmlNode termNode = resultNode.FirstChild("term");
     if(!termNode.IsNull())
     {
-      m_term = StringUtils::ConvertToInt64(StringUtils::Trim(termNode.GetText().c_str()).c_str());
+      m_term = StringUtils::ConvertToInt64(termNode.GetTextView().Trim().ToString().c_str());
       m_termHasBeenSet = true;
     }
     XmlNode priceNode = resultNode.FirstChild("price");
     if(!priceNode.IsNull())
     {
-      m_price = StringUtils::ConvertToDouble(StringUtils::Trim(priceNode.GetText().c_str()).c_str());
+      m_price = StringUtils::ConvertToDouble(priceNode.GetTextView().Trim().ToString().c_str());
       m_priceHasBeenSet = true;
     }
     XmlNode currencyCodeNode = resultNode.FirstChild("currencyCode");
     if(!currencyCodeNode.IsNull())
     {
-      m_currencyCode = CurrencyCodeValuesMapper::GetCurrencyCodeValuesForName(StringUtils::Trim(currencyCodeNode.GetText().c_str()).c_str());
+      m_currencyCode = CurrencyCodeValuesMapper::GetCurrencyCodeValuesForName(currencyCodeNode.GetTextView().Trim().ToString().c_str());
       m_currencyCodeHasBeenSet = true;
     }
   }
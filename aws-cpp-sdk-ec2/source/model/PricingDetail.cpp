@@ -55,13 +55,13 @@ PricingDetail& PricingDetail::operator =(const XmlNode& xmlNode)
     XmlNode priceNode = resultNode.FirstChild("price");
     if(!priceNode.IsNull())
     {
-      m_price = StringUtils::ConvertToDouble(StringUtils::Trim(priceNode.GetText().c_str()).c_str());
+      m_price = StringUtils::ConvertToDouble(priceNode.GetTextView().Trim().ToString().c_str());
       m_priceHasBeenSet = true;
     }
     XmlNode countNode = resultNode.FirstChild("count");
     if(!countNode.IsNull())
     {
-      m_count = StringUtils::ConvertToInt32(StringUtils::Trim(countNode.GetText().c_str()).c_str());
+      m_count = StringUtils::ConvertToInt32(countNode.GetTextView().Trim().ToString().c_str());
       m_countHasBeenSet = true;
     }
   }
@@ -53,13 +53,13 @@ PrivateIpAddressSpecification& PrivateIpAddressSpecification::operator =(const X
     XmlNode privateIpAddressNode = resultNode.FirstChild("privateIpAddress");
     if(!privateIpAddressNode.IsNull())
     {
-      m_privateIpAddress = StringUtils::Trim(privateIpAddressNode.GetText().c_str());
+      m_privateIpAddress = privateIpAddressNode.GetTextView().Trim().ToString();
       m_privateIpAddressHasBeenSet = true;
     }
     XmlNode primaryNode = resultNode.FirstChild("primary");
     if(!primaryNode.IsNull())
     {
-      m_primary = StringUtils::ConvertToBool(StringUtils::Trim(primaryNode.GetText().c_str()).c_str());
+      m_primary = StringUtils::ConvertToBool(primaryNode.GetTextView().Trim().ToString().c_str());
       m_primaryHasBeenSet = true;
     }
   }
@@ -71,7 +71,7 @@ void PrivateIpAddressSpecification::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
 
   if(m_primaryHasBeenSet)
@@ -85,7 +85,7 @@ void PrivateIpAddressSpecification::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
   if(m_primaryHasBeenSet)
   {
@@ -51,13 +51,13 @@ ProductCode& ProductCode::operator =(const XmlNode& xmlNode)
     XmlNode productCodeIdNode = resultNode.FirstChild("productCode");
     if(!productCodeIdNode.IsNull())
     {
-      m_productCodeId = StringUtils::Trim(productCodeIdNode.GetText().c_str());
+      m_productCodeId = productCodeIdNode.GetTextView().Trim().ToString();
       m_productCodeIdHasBeenSet = true;
     }
     XmlNode productCodeTypeNode = resultNode.FirstChild("type");
     if(!productCodeTypeNode.IsNull())
     {
-      m_productCodeType = ProductCodeValuesMapper::GetProductCodeValuesForName(StringUtils::Trim(productCodeTypeNode.GetText().c_str()).c_str());
+      m_productCodeType = ProductCodeValuesMapper::GetProductCodeValuesForName(productCodeTypeNode.GetTextView().Trim().ToString().c_str());
       m_productCodeTypeHasBeenSet = true;
     }
   }
@@ -69,7 +69,7 @@ void ProductCode::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_productCodeIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ProductCodeId=" << StringUtils::URLEncode(m_productCodeId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ProductCodeId=" << StringUtils::URLEncoded(m_productCodeId) << "&";
   }
 
   if(m_productCodeTypeHasBeenSet)
@@ -83,7 +83,7 @@ void ProductCode::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_productCodeIdHasBeenSet)
   {
-      oStream << location << ".ProductCodeId=" << StringUtils::URLEncode(m_productCodeId.c_str()) << "&";
+      oStream << location << ".ProductCodeId=" << StringUtils::URLEncoded(m_productCodeId) << "&";
   }
   if(m_productCodeTypeHasBeenSet)
   {
@@ -29,21 +29,29 @@ namespace Aws
       namespace ProductCodeValuesMapper
       {
 
-        static const int devpay_HASH = HashingUtils::HashString("devpay");
-        static const int marketplace_HASH = HashingUtils::HashString("marketplace");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int devpay_HASH = -1335150477;
+        static const int marketplace_HASH = 300911179;
 
 
         ProductCodeValues GetProductCodeValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == devpay_HASH)
+          switch (hashCode)
           {
+          case devpay_HASH:
             return ProductCodeValues::devpay;
-          }
-          else if (hashCode == marketplace_HASH)
-          {
+          case marketplace_HASH:
             return ProductCodeValues::marketplace;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -49,7 +49,7 @@ PropagatingVgw& PropagatingVgw::operator =(const XmlNode& xmlNode)
     XmlNode gatewayIdNode = resultNode.FirstChild("gatewayId");
     if(!gatewayIdNode.IsNull())
     {
-      m_gatewayId = StringUtils::Trim(gatewayIdNode.GetText().c_str());
+      m_gatewayId = gatewayIdNode.GetTextView().Trim().ToString();
       m_gatewayIdHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void PropagatingVgw::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_gatewayIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".GatewayId=" << StringUtils::URLEncode(m_gatewayId.c_str()) << "&";
+      oStream << location << index << locationValue << ".GatewayId=" << StringUtils::URLEncoded(m_gatewayId) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void PropagatingVgw::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_gatewayIdHasBeenSet)
   {
-      oStream << location << ".GatewayId=" << StringUtils::URLEncode(m_gatewayId.c_str()) << "&";
+      oStream << location << ".GatewayId=" << StringUtils::URLEncoded(m_gatewayId) << "&";
   }
 }
 
@@ -57,31 +57,31 @@ ProvisionedBandwidth& ProvisionedBandwidth::operator =(const XmlNode& xmlNode)
     XmlNode provisionedNode = resultNode.FirstChild("provisioned");
     if(!provisionedNode.IsNull())
     {
-      m_provisioned = StringUtils::Trim(provisionedNode.GetText().c_str());
+      m_provisioned = provisionedNode.GetTextView().Trim().ToString();
       m_provisionedHasBeenSet = true;
     }
     XmlNode requestedNode = resultNode.FirstChild("requested");
     if(!requestedNode.IsNull())
     {
-      m_requested = StringUtils::Trim(requestedNode.GetText().c_str());
+      m_requested = requestedNode.GetTextView().Trim().ToString();
       m_requestedHasBeenSet = true;
     }
     XmlNode requestTimeNode = resultNode.FirstChild("requestTime");
     if(!requestTimeNode.IsNull())
     {
-      m_requestTime = DateTime(StringUtils::Trim(requestTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_requestTime = DateTime(requestTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_requestTimeHasBeenSet = true;
     }
     XmlNode provisionTimeNode = resultNode.FirstChild("provisionTime");
     if(!provisionTimeNode.IsNull())
     {
-      m_provisionTime = DateTime(StringUtils::Trim(provisionTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_provisionTime = DateTime(provisionTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_provisionTimeHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
   }
@@ -93,27 +93,27 @@ void ProvisionedBandwidth::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_provisionedHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Provisioned=" << StringUtils::URLEncode(m_provisioned.c_str()) << "&";
+      oStream << location << index << locationValue << ".Provisioned=" << StringUtils::URLEncoded(m_provisioned) << "&";
   }
 
   if(m_requestedHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Requested=" << StringUtils::URLEncode(m_requested.c_str()) << "&";
+      oStream << location << index << locationValue << ".Requested=" << StringUtils::URLEncoded(m_requested) << "&";
   }
 
   if(m_requestTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RequestTime=" << StringUtils::URLEncode(m_requestTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".RequestTime=" << StringUtils::URLEncoded(m_requestTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_provisionTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ProvisionTime=" << StringUtils::URLEncode(m_provisionTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".ProvisionTime=" << StringUtils::URLEncoded(m_provisionTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
 }
@@ -122,23 +122,23 @@ void ProvisionedBandwidth::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_provisionedHasBeenSet)
   {
-      oStream << location << ".Provisioned=" << StringUtils::URLEncode(m_provisioned.c_str()) << "&";
+      oStream << location << ".Provisioned=" << StringUtils::URLEncoded(m_provisioned) << "&";
   }
   if(m_requestedHasBeenSet)
   {
-      oStream << location << ".Requested=" << StringUtils::URLEncode(m_requested.c_str()) << "&";
+      oStream << location << ".Requested=" << StringUtils::URLEncoded(m_requested) << "&";
   }
   if(m_requestTimeHasBeenSet)
   {
-      oStream << location << ".RequestTime=" << StringUtils::URLEncode(m_requestTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".RequestTime=" << StringUtils::URLEncoded(m_requestTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_provisionTimeHasBeenSet)
   {
-      oStream << location << ".ProvisionTime=" << StringUtils::URLEncode(m_provisionTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".ProvisionTime=" << StringUtils::URLEncoded(m_provisionTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 }
 
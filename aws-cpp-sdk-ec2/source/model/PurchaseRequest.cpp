@@ -53,13 +53,13 @@ PurchaseRequest& PurchaseRequest::operator =(const XmlNode& xmlNode)
     XmlNode purchaseTokenNode = resultNode.FirstChild("PurchaseToken");
     if(!purchaseTokenNode.IsNull())
     {
-      m_purchaseToken = StringUtils::Trim(purchaseTokenNode.GetText().c_str());
+      m_purchaseToken = purchaseTokenNode.GetTextView().Trim().ToString();
       m_purchaseTokenHasBeenSet = true;
     }
     XmlNode instanceCountNode = resultNode.FirstChild("InstanceCount");
     if(!instanceCountNode.IsNull())
     {
-      m_instanceCount = StringUtils::ConvertToInt32(StringUtils::Trim(instanceCountNode.GetText().c_str()).c_str());
+      m_instanceCount = StringUtils::ConvertToInt32(instanceCountNode.GetTextView().Trim().ToString().c_str());
       m_instanceCountHasBeenSet = true;
     }
   }
@@ -71,7 +71,7 @@ void PurchaseRequest::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_purchaseTokenHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PurchaseToken=" << StringUtils::URLEncode(m_purchaseToken.c_str()) << "&";
+      oStream << location << index << locationValue << ".PurchaseToken=" << StringUtils::URLEncoded(m_purchaseToken) << "&";
   }
 
   if(m_instanceCountHasBeenSet)
@@ -85,7 +85,7 @@ void PurchaseRequest::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_purchaseTokenHasBeenSet)
   {
-      oStream << location << ".PurchaseToken=" << StringUtils::URLEncode(m_purchaseToken.c_str()) << "&";
+      oStream << location << ".PurchaseToken=" << StringUtils::URLEncoded(m_purchaseToken) << "&";
   }
   if(m_instanceCountHasBeenSet)
   {
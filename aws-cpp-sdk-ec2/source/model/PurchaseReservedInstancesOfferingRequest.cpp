@@ -15,6 +15,7 @@
 #include <aws/ec2/model/PurchaseReservedInstancesOfferingRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -31,7 +32,7 @@ PurchaseReservedInstancesOfferingRequest::PurchaseReservedInstancesOfferingReque
 
 Aws::String PurchaseReservedInstancesOfferingRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=PurchaseReservedInstancesOffering&";
   if(m_dryRunHasBeenSet)
   {
@@ -40,7 +41,7 @@ Aws::String PurchaseReservedInstancesOfferingRequest::SerializePayload() const
 
   if(m_reservedInstancesOfferingIdHasBeenSet)
   {
-    ss << "ReservedInstancesOfferingId=" << StringUtils::URLEncode(m_reservedInstancesOfferingId.c_str()) << "&";
+    ss << "ReservedInstancesOfferingId=" << StringUtils::URLEncoded(m_reservedInstancesOfferingId) << "&";
   }
 
   if(m_instanceCountHasBeenSet)
@@ -54,6 +55,6 @@ Aws::String PurchaseReservedInstancesOfferingRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ PurchaseReservedInstancesOfferingResponse& PurchaseReservedInstancesOfferingResp
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "PurchaseReservedInstancesOfferingResponse")
+  if (rootNode.GetNameView() != "PurchaseReservedInstancesOfferingResponse")
   {
     resultNode = rootNode.FirstChild("PurchaseReservedInstancesOfferingResponse");
   }
@@ -50,7 +50,7 @@ PurchaseReservedInstancesOfferingResponse& PurchaseReservedInstancesOfferingResp
     XmlNode reservedInstancesIdNode = resultNode.FirstChild("reservedInstancesId");
     if(!reservedInstancesIdNode.IsNull())
     {
-      m_reservedInstancesId = StringUtils::Trim(reservedInstancesIdNode.GetText().c_str());
+      m_reservedInstancesId = reservedInstancesIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ PurchaseScheduledInstancesResponse& PurchaseScheduledInstancesResponse::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "PurchaseScheduledInstancesResponse")
+  if (rootNode.GetNameView() != "PurchaseScheduledInstancesResponse")
   {
     resultNode = rootNode.FirstChild("PurchaseScheduledInstancesResponse");
   }
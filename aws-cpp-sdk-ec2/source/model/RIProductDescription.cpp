@@ -29,31 +29,35 @@ namespace Aws
       namespace RIProductDescriptionMapper
       {
 
-        static const int Linux_UNIX_HASH = HashingUtils::HashString("Linux/UNIX");
-        static const int Linux_UNIX_Amazon_VPC_HASH = HashingUtils::HashString("Linux/UNIX (Amazon VPC)");
-        static const int Windows_HASH = HashingUtils::HashString("Windows");
-        static const int Windows_Amazon_VPC_HASH = HashingUtils::HashString("Windows (Amazon VPC)");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Linux_UNIX_HASH = -178444829;
+        static const int Linux_UNIX_Amazon_VPC_HASH = -239375631;
+        static const int Windows_HASH = -1280820637;
+        static const int Windows_Amazon_VPC_HASH = 1207281265;
 
 
         RIProductDescription GetRIProductDescriptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Linux_UNIX_HASH)
+          switch (hashCode)
           {
+          case Linux_UNIX_HASH:
             return RIProductDescription::Linux_UNIX;
-          }
-          else if (hashCode == Linux_UNIX_Amazon_VPC_HASH)
-          {
+          case Linux_UNIX_Amazon_VPC_HASH:
             return RIProductDescription::Linux_UNIX_Amazon_VPC;
-          }
-          else if (hashCode == Windows_HASH)
-          {
+          case Windows_HASH:
             return RIProductDescription::Windows;
-          }
-          else if (hashCode == Windows_Amazon_VPC_HASH)
-          {
+          case Windows_Amazon_VPC_HASH:
             return RIProductDescription::Windows_Amazon_VPC;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -53,13 +53,13 @@ RecurringCharge& RecurringCharge::operator =(const XmlNode& xmlNode)
     XmlNode frequencyNode = resultNode.FirstChild("frequency");
     if(!frequencyNode.IsNull())
     {
-      m_frequency = RecurringChargeFrequencyMapper::GetRecurringChargeFrequencyForName(StringUtils::Trim(frequencyNode.GetText().c_str()).c_str());
+      m_frequency = RecurringChargeFrequencyMapper::GetRecurringChargeFrequencyForName(frequencyNode.GetTextView().Trim().ToString().c_str());
       m_frequencyHasBeenSet = true;
     }
     XmlNode amountNode = resultNode.FirstChild("amount");
     if(!amountNode.IsNull())
     {
-      m_amount = StringUtils::ConvertToDouble(StringUtils::Trim(amountNode.GetText().c_str()).c_str());
+      m_amount = StringUtils::ConvertToDouble(amountNode.GetTextView().Trim().ToString().c_str());
       m_amountHasBeenSet = true;
     }
   }
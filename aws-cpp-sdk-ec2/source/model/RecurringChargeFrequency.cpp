@@ -29,16 +29,26 @@ namespace Aws
       namespace RecurringChargeFrequencyMapper
       {
 
-        static const int Hourly_HASH = HashingUtils::HashString("Hourly");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Hourly_HASH = -2127559023;
 
 
         RecurringChargeFrequency GetRecurringChargeFrequencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Hourly_HASH)
+          switch (hashCode)
           {
+          case Hourly_HASH:
             return RecurringChargeFrequency::Hourly;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -51,13 +51,13 @@ Region& Region::operator =(const XmlNode& xmlNode)
     XmlNode regionNameNode = resultNode.FirstChild("regionName");
     if(!regionNameNode.IsNull())
     {
-      m_regionName = StringUtils::Trim(regionNameNode.GetText().c_str());
+      m_regionName = regionNameNode.GetTextView().Trim().ToString();
       m_regionNameHasBeenSet = true;
     }
     XmlNode endpointNode = resultNode.FirstChild("regionEndpoint");
     if(!endpointNode.IsNull())
     {
-      m_endpoint = StringUtils::Trim(endpointNode.GetText().c_str());
+      m_endpoint = endpointNode.GetTextView().Trim().ToString();
       m_endpointHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void Region::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
 {
   if(m_regionNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RegionName=" << StringUtils::URLEncode(m_regionName.c_str()) << "&";
+      oStream << location << index << locationValue << ".RegionName=" << StringUtils::URLEncoded(m_regionName) << "&";
   }
 
   if(m_endpointHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Endpoint=" << StringUtils::URLEncode(m_endpoint.c_str()) << "&";
+      oStream << location << index << locationValue << ".Endpoint=" << StringUtils::URLEncoded(m_endpoint) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void Region::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_regionNameHasBeenSet)
   {
-      oStream << location << ".RegionName=" << StringUtils::URLEncode(m_regionName.c_str()) << "&";
+      oStream << location << ".RegionName=" << StringUtils::URLEncoded(m_regionName) << "&";
   }
   if(m_endpointHasBeenSet)
   {
-      oStream << location << ".Endpoint=" << StringUtils::URLEncode(m_endpoint.c_str()) << "&";
+      oStream << location << ".Endpoint=" << StringUtils::URLEncoded(m_endpoint) << "&";
   }
 }
 
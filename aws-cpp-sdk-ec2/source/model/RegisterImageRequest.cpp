@@ -15,6 +15,7 @@
 #include <aws/ec2/model/RegisterImageRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -37,7 +38,7 @@ RegisterImageRequest::RegisterImageRequest() :
 
 Aws::String RegisterImageRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=RegisterImage&";
   if(m_dryRunHasBeenSet)
   {
@@ -46,17 +47,17 @@ Aws::String RegisterImageRequest::SerializePayload() const
 
   if(m_imageLocationHasBeenSet)
   {
-    ss << "ImageLocation=" << StringUtils::URLEncode(m_imageLocation.c_str()) << "&";
+    ss << "ImageLocation=" << StringUtils::URLEncoded(m_imageLocation) << "&";
   }
 
   if(m_nameHasBeenSet)
   {
-    ss << "Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+    ss << "Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_architectureHasBeenSet)
@@ -66,17 +67,17 @@ Aws::String RegisterImageRequest::SerializePayload() const
 
   if(m_kernelIdHasBeenSet)
   {
-    ss << "KernelId=" << StringUtils::URLEncode(m_kernelId.c_str()) << "&";
+    ss << "KernelId=" << StringUtils::URLEncoded(m_kernelId) << "&";
   }
 
   if(m_ramdiskIdHasBeenSet)
   {
-    ss << "RamdiskId=" << StringUtils::URLEncode(m_ramdiskId.c_str()) << "&";
+    ss << "RamdiskId=" << StringUtils::URLEncoded(m_ramdiskId) << "&";
   }
 
   if(m_rootDeviceNameHasBeenSet)
   {
-    ss << "RootDeviceName=" << StringUtils::URLEncode(m_rootDeviceName.c_str()) << "&";
+    ss << "RootDeviceName=" << StringUtils::URLEncoded(m_rootDeviceName) << "&";
   }
 
   if(m_blockDeviceMappingsHasBeenSet)
@@ -91,15 +92,15 @@ Aws::String RegisterImageRequest::SerializePayload() const
 
   if(m_virtualizationTypeHasBeenSet)
   {
-    ss << "VirtualizationType=" << StringUtils::URLEncode(m_virtualizationType.c_str()) << "&";
+    ss << "VirtualizationType=" << StringUtils::URLEncoded(m_virtualizationType) << "&";
   }
 
   if(m_sriovNetSupportHasBeenSet)
   {
-    ss << "SriovNetSupport=" << StringUtils::URLEncode(m_sriovNetSupport.c_str()) << "&";
+    ss << "SriovNetSupport=" << StringUtils::URLEncoded(m_sriovNetSupport) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ RegisterImageResponse& RegisterImageResponse::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RegisterImageResponse")
+  if (rootNode.GetNameView() != "RegisterImageResponse")
   {
     resultNode = rootNode.FirstChild("RegisterImageResponse");
   }
@@ -50,7 +50,7 @@ RegisterImageResponse& RegisterImageResponse::operator =(const AmazonWebServiceR
     XmlNode imageIdNode = resultNode.FirstChild("imageId");
     if(!imageIdNode.IsNull())
     {
-      m_imageId = StringUtils::Trim(imageIdNode.GetText().c_str());
+      m_imageId = imageIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -42,7 +42,7 @@ RejectVpcPeeringConnectionResponse& RejectVpcPeeringConnectionResponse::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RejectVpcPeeringConnectionResponse")
+  if (rootNode.GetNameView() != "RejectVpcPeeringConnectionResponse")
   {
     resultNode = rootNode.FirstChild("RejectVpcPeeringConnectionResponse");
   }
@@ -52,7 +52,7 @@ RejectVpcPeeringConnectionResponse& RejectVpcPeeringConnectionResponse::operator
     XmlNode returnNode = resultNode.FirstChild("return");
     if(!returnNode.IsNull())
     {
-      m_return = StringUtils::ConvertToBool(StringUtils::Trim(returnNode.GetText().c_str()).c_str());
+      m_return = StringUtils::ConvertToBool(returnNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ReleaseHostsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -26,7 +27,7 @@ ReleaseHostsRequest::ReleaseHostsRequest() :
 
 Aws::String ReleaseHostsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ReleaseHosts&";
   if(m_hostIdsHasBeenSet)
   {
@@ -34,12 +35,12 @@ Aws::String ReleaseHostsRequest::SerializePayload() const
     for(auto& item : m_hostIds)
     {
       ss << "HostId." << hostIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       hostIdsCount++;
     }
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ReleaseHostsResponse& ReleaseHostsResponse::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ReleaseHostsResponse")
+  if (rootNode.GetNameView() != "ReleaseHostsResponse")
   {
     resultNode = rootNode.FirstChild("ReleaseHostsResponse");
   }
@@ -53,7 +53,7 @@ ReleaseHostsResponse& ReleaseHostsResponse::operator =(const AmazonWebServiceRes
       XmlNode successfulMember = successfulNode.FirstChild("item");
       while(!successfulMember.IsNull())
       {
-        m_successful.push_back(StringUtils::Trim(successfulMember.GetText().c_str()));
+        m_successful.push_back(successfulMember.GetTextView().Trim().ToString());
         successfulMember = successfulMember.NextNode("item");
       }
 
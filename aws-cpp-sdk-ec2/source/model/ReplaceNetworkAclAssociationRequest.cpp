@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ReplaceNetworkAclAssociationRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ ReplaceNetworkAclAssociationRequest::ReplaceNetworkAclAssociationRequest() :
 
 Aws::String ReplaceNetworkAclAssociationRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ReplaceNetworkAclAssociation&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String ReplaceNetworkAclAssociationRequest::SerializePayload() const
 
   if(m_associationIdHasBeenSet)
   {
-    ss << "AssociationId=" << StringUtils::URLEncode(m_associationId.c_str()) << "&";
+    ss << "AssociationId=" << StringUtils::URLEncoded(m_associationId) << "&";
   }
 
   if(m_networkAclIdHasBeenSet)
   {
-    ss << "NetworkAclId=" << StringUtils::URLEncode(m_networkAclId.c_str()) << "&";
+    ss << "NetworkAclId=" << StringUtils::URLEncoded(m_networkAclId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
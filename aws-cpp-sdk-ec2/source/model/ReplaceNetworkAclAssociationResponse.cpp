@@ -40,7 +40,7 @@ ReplaceNetworkAclAssociationResponse& ReplaceNetworkAclAssociationResponse::oper
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ReplaceNetworkAclAssociationResponse")
+  if (rootNode.GetNameView() != "ReplaceNetworkAclAssociationResponse")
   {
     resultNode = rootNode.FirstChild("ReplaceNetworkAclAssociationResponse");
   }
@@ -50,7 +50,7 @@ ReplaceNetworkAclAssociationResponse& ReplaceNetworkAclAssociationResponse::oper
     XmlNode newAssociationIdNode = resultNode.FirstChild("newAssociationId");
     if(!newAssociationIdNode.IsNull())
     {
-      m_newAssociationId = StringUtils::Trim(newAssociationIdNode.GetText().c_str());
+      m_newAssociationId = newAssociationIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ReplaceRouteTableAssociationRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ ReplaceRouteTableAssociationRequest::ReplaceRouteTableAssociationRequest() :
 
 Aws::String ReplaceRouteTableAssociationRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ReplaceRouteTableAssociation&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String ReplaceRouteTableAssociationRequest::SerializePayload() const
 
   if(m_associationIdHasBeenSet)
   {
-    ss << "AssociationId=" << StringUtils::URLEncode(m_associationId.c_str()) << "&";
+    ss << "AssociationId=" << StringUtils::URLEncoded(m_associationId) << "&";
   }
 
   if(m_routeTableIdHasBeenSet)
   {
-    ss << "RouteTableId=" << StringUtils::URLEncode(m_routeTableId.c_str()) << "&";
+    ss << "RouteTableId=" << StringUtils::URLEncoded(m_routeTableId) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
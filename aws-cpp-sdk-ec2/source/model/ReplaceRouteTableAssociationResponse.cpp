@@ -40,7 +40,7 @@ ReplaceRouteTableAssociationResponse& ReplaceRouteTableAssociationResponse::oper
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ReplaceRouteTableAssociationResponse")
+  if (rootNode.GetNameView() != "ReplaceRouteTableAssociationResponse")
   {
     resultNode = rootNode.FirstChild("ReplaceRouteTableAssociationResponse");
   }
@@ -50,7 +50,7 @@ ReplaceRouteTableAssociationResponse& ReplaceRouteTableAssociationResponse::oper
     XmlNode newAssociationIdNode = resultNode.FirstChild("newAssociationId");
     if(!newAssociationIdNode.IsNull())
     {
-      m_newAssociationId = StringUtils::Trim(newAssociationIdNode.GetText().c_str());
+      m_newAssociationId = newAssociationIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -29,56 +29,50 @@ namespace Aws
       namespace ReportInstanceReasonCodesMapper
       {
 
-        static const int instance_stuck_in_state_HASH = HashingUtils::HashString("instance-stuck-in-state");
-        static const int unresponsive_HASH = HashingUtils::HashString("unresponsive");
-        static const int not_accepting_credentials_HASH = HashingUtils::HashString("not-accepting-credentials");
-        static const int password_not_available_HASH = HashingUtils::HashString("password-not-available");
-        static const int performance_network_HASH = HashingUtils::HashString("performance-network");
-        static const int performance_instance_store_HASH = HashingUtils::HashString("performance-instance-store");
-        static const int performance_ebs_volume_HASH = HashingUtils::HashString("performance-ebs-volume");
-        static const int performance_other_HASH = HashingUtils::HashString("performance-other");
-        static const int other_HASH = HashingUtils::HashString("other");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int instance_stuck_in_state_HASH = -1327466702;
+        static const int unresponsive_HASH = 1488488717;
+        static const int not_accepting_credentials_HASH = -1874465777;
+        static const int password_not_available_HASH = -1158615907;
+        static const int performance_network_HASH = -117564015;
+        static const int performance_instance_store_HASH = 1590908134;
+        static const int performance_ebs_volume_HASH = -1851001074;
+        static const int performance_other_HASH = 729726771;
+        static const int other_HASH = 106069776;
 
 
         ReportInstanceReasonCodes GetReportInstanceReasonCodesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instance_stuck_in_state_HASH)
+          switch (hashCode)
           {
+          case instance_stuck_in_state_HASH:
             return ReportInstanceReasonCodes::instance_stuck_in_state;
-          }
-          else if (hashCode == unresponsive_HASH)
-          {
+          case unresponsive_HASH:
             return ReportInstanceReasonCodes::unresponsive;
-          }
-          else if (hashCode == not_accepting_credentials_HASH)
-          {
+          case not_accepting_credentials_HASH:
             return ReportInstanceReasonCodes::not_accepting_credentials;
-          }
-          else if (hashCode == password_not_available_HASH)
-          {
+          case password_not_available_HASH:
             return ReportInstanceReasonCodes::password_not_available;
-          }
-          else if (hashCode == performance_network_HASH)
-          {
+          case performance_network_HASH:
             return ReportInstanceReasonCodes::performance_network;
-          }
-          else if (hashCode == performance_instance_store_HASH)
-          {
+          case performance_instance_store_HASH:
             return ReportInstanceReasonCodes::performance_instance_store;
-          }
-          else if (hashCode == performance_ebs_volume_HASH)
-          {
+          case performance_ebs_volume_HASH:
             return ReportInstanceReasonCodes::performance_ebs_volume;
-          }
-          else if (hashCode == performance_other_HASH)
-          {
+          case performance_other_HASH:
             return ReportInstanceReasonCodes::performance_other;
-          }
-          else if (hashCode == other_HASH)
-          {
+          case other_HASH:
             return ReportInstanceReasonCodes::other;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
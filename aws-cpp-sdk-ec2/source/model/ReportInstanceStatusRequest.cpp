@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ReportInstanceStatusRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -33,7 +34,7 @@ ReportInstanceStatusRequest::ReportInstanceStatusRequest() :
 
 Aws::String ReportInstanceStatusRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ReportInstanceStatus&";
   if(m_dryRunHasBeenSet)
   {
@@ -46,7 +47,7 @@ Aws::String ReportInstanceStatusRequest::SerializePayload() const
     for(auto& item : m_instances)
     {
       ss << "InstanceId." << instancesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       instancesCount++;
     }
   }
@@ -58,12 +59,12 @@ Aws::String ReportInstanceStatusRequest::SerializePayload() const
 
   if(m_startTimeHasBeenSet)
   {
-    ss << "StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_endTimeHasBeenSet)
   {
-    ss << "EndTime=" << StringUtils::URLEncode(m_endTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "EndTime=" << StringUtils::URLEncoded(m_endTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_reasonCodesHasBeenSet)
@@ -72,17 +73,17 @@ Aws::String ReportInstanceStatusRequest::SerializePayload() const
     for(auto& item : m_reasonCodes)
     {
       ss << "ReasonCode." << reasonCodesCount << "="
-          << StringUtils::URLEncode(ReportInstanceReasonCodesMapper::GetNameForReportInstanceReasonCodes(item).c_str()) << "&";
+          << StringUtils::URLEncoded(ReportInstanceReasonCodesMapper::GetNameForReportInstanceReasonCodes(item)) << "&";
       reasonCodesCount++;
     }
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -29,21 +29,29 @@ namespace Aws
       namespace ReportStatusTypeMapper
       {
 
-        static const int ok_HASH = HashingUtils::HashString("ok");
-        static const int impaired_HASH = HashingUtils::HashString("impaired");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ok_HASH = 3548;
+        static const int impaired_HASH = -435567843;
 
 
         ReportStatusType GetReportStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ok_HASH)
+          switch (hashCode)
           {
+          case ok_HASH:
             return ReportStatusType::ok;
-          }
-          else if (hashCode == impaired_HASH)
-          {
+          case impaired_HASH:
             return ReportStatusType::impaired;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
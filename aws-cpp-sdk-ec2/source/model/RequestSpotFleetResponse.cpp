@@ -40,7 +40,7 @@ RequestSpotFleetResponse& RequestSpotFleetResponse::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RequestSpotFleetResponse")
+  if (rootNode.GetNameView() != "RequestSpotFleetResponse")
   {
     resultNode = rootNode.FirstChild("RequestSpotFleetResponse");
   }
@@ -50,7 +50,7 @@ RequestSpotFleetResponse& RequestSpotFleetResponse::operator =(const AmazonWebSe
     XmlNode spotFleetRequestIdNode = resultNode.FirstChild("spotFleetRequestId");
     if(!spotFleetRequestIdNode.IsNull())
     {
-      m_spotFleetRequestId = StringUtils::Trim(spotFleetRequestIdNode.GetText().c_str());
+      m_spotFleetRequestId = spotFleetRequestIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/RequestSpotInstancesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -39,7 +40,7 @@ RequestSpotInstancesRequest::RequestSpotInstancesRequest() :
 
 Aws::String RequestSpotInstancesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SpotInstances&";
   if(m_dryRunHasBeenSet)
   {
@@ -48,12 +49,12 @@ Aws::String RequestSpotInstancesRequest::SerializePayload() const
 
   if(m_spotPriceHasBeenSet)
   {
-    ss << "SpotPrice=" << StringUtils::URLEncode(m_spotPrice.c_str()) << "&";
+    ss << "SpotPrice=" << StringUtils::URLEncoded(m_spotPrice) << "&";
   }
 
   if(m_clientTokenHasBeenSet)
   {
-    ss << "ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+    ss << "ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   if(m_instanceCountHasBeenSet)
@@ -68,22 +69,22 @@ Aws::String RequestSpotInstancesRequest::SerializePayload() const
 
   if(m_validFromHasBeenSet)
   {
-    ss << "ValidFrom=" << StringUtils::URLEncode(m_validFrom.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "ValidFrom=" << StringUtils::URLEncoded(m_validFrom.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_validUntilHasBeenSet)
   {
-    ss << "ValidUntil=" << StringUtils::URLEncode(m_validUntil.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "ValidUntil=" << StringUtils::URLEncoded(m_validUntil.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_launchGroupHasBeenSet)
   {
-    ss << "LaunchGroup=" << StringUtils::URLEncode(m_launchGroup.c_str()) << "&";
+    ss << "LaunchGroup=" << StringUtils::URLEncoded(m_launchGroup) << "&";
   }
 
   if(m_availabilityZoneGroupHasBeenSet)
   {
-    ss << "AvailabilityZoneGroup=" << StringUtils::URLEncode(m_availabilityZoneGroup.c_str()) << "&";
+    ss << "AvailabilityZoneGroup=" << StringUtils::URLEncoded(m_availabilityZoneGroup) << "&";
   }
 
   if(m_blockDurationMinutesHasBeenSet)
@@ -97,6 +98,6 @@ Aws::String RequestSpotInstancesRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
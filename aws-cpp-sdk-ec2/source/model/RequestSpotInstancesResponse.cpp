@@ -40,7 +40,7 @@ RequestSpotInstancesResponse& RequestSpotInstancesResponse::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RequestSpotInstancesResponse")
+  if (rootNode.GetNameView() != "RequestSpotInstancesResponse")
   {
     resultNode = rootNode.FirstChild("RequestSpotInstancesResponse");
   }
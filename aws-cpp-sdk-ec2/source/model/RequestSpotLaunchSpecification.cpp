@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -81,13 +82,13 @@ RequestSpotLaunchSpecification& RequestSpotLaunchSpecification::operator =(const
     XmlNode imageIdNode = resultNode.FirstChild("imageId");
     if(!imageIdNode.IsNull())
     {
-      m_imageId = StringUtils::Trim(imageIdNode.GetText().c_str());
+      m_imageId = imageIdNode.GetTextView().Trim().ToString();
       m_imageIdHasBeenSet = true;
     }
     XmlNode keyNameNode = resultNode.FirstChild("keyName");
     if(!keyNameNode.IsNull())
     {
-      m_keyName = StringUtils::Trim(keyNameNode.GetText().c_str());
+      m_keyName = keyNameNode.GetTextView().Trim().ToString();
       m_keyNameHasBeenSet = true;
     }
     XmlNode securityGroupsNode = resultNode.FirstChild("SecurityGroup");
@@ -96,7 +97,7 @@ RequestSpotLaunchSpecification& RequestSpotLaunchSpecification::operator =(const
       XmlNode securityGroupsMember = securityGroupsNode.FirstChild("item");
       while(!securityGroupsMember.IsNull())
       {
-        m_securityGroups.push_back(StringUtils::Trim(securityGroupsMember.GetText().c_str()));
+        m_securityGroups.push_back(securityGroupsMember.GetTextView().Trim().ToString());
         securityGroupsMember = securityGroupsMember.NextNode("item");
       }
 
@@ -105,19 +106,19 @@ RequestSpotLaunchSpecification& RequestSpotLaunchSpecification::operator =(const
     XmlNode userDataNode = resultNode.FirstChild("userData");
     if(!userDataNode.IsNull())
     {
-      m_userData = StringUtils::Trim(userDataNode.GetText().c_str());
+      m_userData = userDataNode.GetTextView().Trim().ToString();
       m_userDataHasBeenSet = true;
     }
     XmlNode addressingTypeNode = resultNode.FirstChild("addressingType");
     if(!addressingTypeNode.IsNull())
     {
-      m_addressingType = StringUtils::Trim(addressingTypeNode.GetText().c_str());
+      m_addressingType = addressingTypeNode.GetTextView().Trim().ToString();
       m_addressingTypeHasBeenSet = true;
     }
     XmlNode instanceTypeNode = resultNode.FirstChild("instanceType");
     if(!instanceTypeNode.IsNull())
     {
-      m_instanceType = InstanceTypeMapper::GetInstanceTypeForName(StringUtils::Trim(instanceTypeNode.GetText().c_str()).c_str());
+      m_instanceType = InstanceTypeMapper::GetInstanceTypeForName(instanceTypeNode.GetTextView().Trim().ToString().c_str());
       m_instanceTypeHasBeenSet = true;
     }
     XmlNode placementNode = resultNode.FirstChild("placement");
@@ -129,13 +130,13 @@ RequestSpotLaunchSpecification& RequestSpotLaunchSpecification::operator =(const
     XmlNode kernelIdNode = resultNode.FirstChild("kernelId");
     if(!kernelIdNode.IsNull())
     {
-      m_kernelId = StringUtils::Trim(kernelIdNode.GetText().c_str());
+      m_kernelId = kernelIdNode.GetTextView().Trim().ToString();
       m_kernelIdHasBeenSet = true;
     }
     XmlNode ramdiskIdNode = resultNode.FirstChild("ramdiskId");
     if(!ramdiskIdNode.IsNull())
     {
-      m_ramdiskId = StringUtils::Trim(ramdiskIdNode.GetText().c_str());
+      m_ramdiskId = ramdiskIdNode.GetTextView().Trim().ToString();
       m_ramdiskIdHasBeenSet = true;
     }
     XmlNode blockDeviceMappingsNode = resultNode.FirstChild("blockDeviceMapping");
@@ -153,7 +154,7 @@ RequestSpotLaunchSpecification& RequestSpotLaunchSpecification::operator =(const
     XmlNode subnetIdNode = resultNode.FirstChild("subnetId");
     if(!subnetIdNode.IsNull())
     {
-      m_subnetId = StringUtils::Trim(subnetIdNode.GetText().c_str());
+      m_subnetId = subnetIdNode.GetTextView().Trim().ToString();
       m_subnetIdHasBeenSet = true;
     }
     XmlNode networkInterfacesNode = resultNode.FirstChild("NetworkInterface");
@@ -177,7 +178,7 @@ RequestSpotLaunchSpecification& RequestSpotLaunchSpecification::operator =(const
     XmlNode ebsOptimizedNode = resultNode.FirstChild("ebsOptimized");
     if(!ebsOptimizedNode.IsNull())
     {
-      m_ebsOptimized = StringUtils::ConvertToBool(StringUtils::Trim(ebsOptimizedNode.GetText().c_str()).c_str());
+      m_ebsOptimized = StringUtils::ConvertToBool(ebsOptimizedNode.GetTextView().Trim().ToString().c_str());
       m_ebsOptimizedHasBeenSet = true;
     }
     XmlNode monitoringNode = resultNode.FirstChild("monitoring");
@@ -192,7 +193,7 @@ RequestSpotLaunchSpecification& RequestSpotLaunchSpecification::operator =(const
       XmlNode securityGroupIdsMember = securityGroupIdsNode.FirstChild("item");
       while(!securityGroupIdsMember.IsNull())
       {
-        m_securityGroupIds.push_back(StringUtils::Trim(securityGroupIdsMember.GetText().c_str()));
+        m_securityGroupIds.push_back(securityGroupIdsMember.GetTextView().Trim().ToString());
         securityGroupIdsMember = securityGroupIdsMember.NextNode("item");
       }
 
@@ -207,12 +208,12 @@ void RequestSpotLaunchSpecification::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_imageIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
 
   if(m_keyNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+      oStream << location << index << locationValue << ".KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
 
   if(m_securityGroupsHasBeenSet)
@@ -220,18 +221,18 @@ void RequestSpotLaunchSpecification::OutputToStream(Aws::OStream& oStream, const
       unsigned securityGroupsIdx = 1;
       for(auto& item : m_securityGroups)
       {
-        oStream << location << index << locationValue << ".SecurityGroup." << securityGroupsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".SecurityGroup." << securityGroupsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
   if(m_userDataHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UserData=" << StringUtils::URLEncode(m_userData.c_str()) << "&";
+      oStream << location << index << locationValue << ".UserData=" << StringUtils::URLEncoded(m_userData) << "&";
   }
 
   if(m_addressingTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AddressingType=" << StringUtils::URLEncode(m_addressingType.c_str()) << "&";
+      oStream << location << index << locationValue << ".AddressingType=" << StringUtils::URLEncoded(m_addressingType) << "&";
   }
 
   if(m_instanceTypeHasBeenSet)
@@ -241,19 +242,19 @@ void RequestSpotLaunchSpecification::OutputToStream(Aws::OStream& oStream, const
 
   if(m_placementHasBeenSet)
   {
-      Aws::StringStream placementLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream placementLocationAndMemberSs;
       placementLocationAndMemberSs << location << index << locationValue << ".Placement";
-      m_placement.OutputToStream(oStream, placementLocationAndMemberSs.str().c_str());
+      m_placement.OutputToStream(oStream, placementLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_kernelIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KernelId=" << StringUtils::URLEncode(m_kernelId.c_str()) << "&";
+      oStream << location << index << locationValue << ".KernelId=" << StringUtils::URLEncoded(m_kernelId) << "&";
   }
 
   if(m_ramdiskIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RamdiskId=" << StringUtils::URLEncode(m_ramdiskId.c_str()) << "&";
+      oStream << location << index << locationValue << ".RamdiskId=" << StringUtils::URLEncoded(m_ramdiskId) << "&";
   }
 
   if(m_blockDeviceMappingsHasBeenSet)
@@ -261,15 +262,15 @@ void RequestSpotLaunchSpecification::OutputToStream(Aws::OStream& oStream, const
       unsigned blockDeviceMappingsIdx = 1;
       for(auto& item : m_blockDeviceMappings)
       {
-        Aws::StringStream blockDeviceMappingsSs;
+        Aws::Utils::Stream::StringOutputStream blockDeviceMappingsSs;
         blockDeviceMappingsSs << location << index << locationValue << ".BlockDeviceMapping." << blockDeviceMappingsIdx++;
-        item.OutputToStream(oStream, blockDeviceMappingsSs.str().c_str());
+        item.OutputToStream(oStream, blockDeviceMappingsSs.GetString().c_str());
       }
   }
 
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
   if(m_networkInterfacesHasBeenSet)
@@ -277,17 +278,17 @@ void RequestSpotLaunchSpecification::OutputToStream(Aws::OStream& oStream, const
       unsigned networkInterfacesIdx = 1;
       for(auto& item : m_networkInterfaces)
       {
-        Aws::StringStream networkInterfacesSs;
+        Aws::Utils::Stream::StringOutputStream networkInterfacesSs;
         networkInterfacesSs << location << index << locationValue << ".NetworkInterface." << networkInterfacesIdx++;
-        item.OutputToStream(oStream, networkInterfacesSs.str().c_str());
+        item.OutputToStream(oStream, networkInterfacesSs.GetString().c_str());
       }
   }
 
   if(m_iamInstanceProfileHasBeenSet)
   {
-      Aws::StringStream iamInstanceProfileLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream iamInstanceProfileLocationAndMemberSs;
       iamInstanceProfileLocationAndMemberSs << location << index << locationValue << ".IamInstanceProfile";
-      m_iamInstanceProfile.OutputToStream(oStream, iamInstanceProfileLocationAndMemberSs.str().c_str());
+      m_iamInstanceProfile.OutputToStream(oStream, iamInstanceProfileLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_ebsOptimizedHasBeenSet)
@@ -297,9 +298,9 @@ void RequestSpotLaunchSpecification::OutputToStream(Aws::OStream& oStream, const
 
   if(m_monitoringHasBeenSet)
   {
-      Aws::StringStream monitoringLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream monitoringLocationAndMemberSs;
       monitoringLocationAndMemberSs << location << index << locationValue << ".Monitoring";
-      m_monitoring.OutputToStream(oStream, monitoringLocationAndMemberSs.str().c_str());
+      m_monitoring.OutputToStream(oStream, monitoringLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_securityGroupIdsHasBeenSet)
@@ -307,7 +308,7 @@ void RequestSpotLaunchSpecification::OutputToStream(Aws::OStream& oStream, const
       unsigned securityGroupIdsIdx = 1;
       for(auto& item : m_securityGroupIds)
       {
-        oStream << location << index << locationValue << ".SecurityGroupId." << securityGroupIdsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".SecurityGroupId." << securityGroupIdsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -317,27 +318,27 @@ void RequestSpotLaunchSpecification::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_imageIdHasBeenSet)
   {
-      oStream << location << ".ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+      oStream << location << ".ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
   if(m_keyNameHasBeenSet)
   {
-      oStream << location << ".KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+      oStream << location << ".KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
   if(m_securityGroupsHasBeenSet)
   {
       unsigned securityGroupsIdx = 1;
       for(auto& item : m_securityGroups)
       {
-        oStream << location << ".item." << securityGroupsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".item." << securityGroupsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_userDataHasBeenSet)
   {
-      oStream << location << ".UserData=" << StringUtils::URLEncode(m_userData.c_str()) << "&";
+      oStream << location << ".UserData=" << StringUtils::URLEncoded(m_userData) << "&";
   }
   if(m_addressingTypeHasBeenSet)
   {
-      oStream << location << ".AddressingType=" << StringUtils::URLEncode(m_addressingType.c_str()) << "&";
+      oStream << location << ".AddressingType=" << StringUtils::URLEncoded(m_addressingType) << "&";
   }
   if(m_instanceTypeHasBeenSet)
   {
@@ -351,34 +352,34 @@ void RequestSpotLaunchSpecification::OutputToStream(Aws::OStream& oStream, const
   }
   if(m_kernelIdHasBeenSet)
   {
-      oStream << location << ".KernelId=" << StringUtils::URLEncode(m_kernelId.c_str()) << "&";
+      oStream << location << ".KernelId=" << StringUtils::URLEncoded(m_kernelId) << "&";
   }
   if(m_ramdiskIdHasBeenSet)
   {
-      oStream << location << ".RamdiskId=" << StringUtils::URLEncode(m_ramdiskId.c_str()) << "&";
+      oStream << location << ".RamdiskId=" << StringUtils::URLEncoded(m_ramdiskId) << "&";
   }
   if(m_blockDeviceMappingsHasBeenSet)
   {
       unsigned blockDeviceMappingsIdx = 1;
       for(auto& item : m_blockDeviceMappings)
       {
-        Aws::StringStream blockDeviceMappingsSs;
+        Aws::Utils::Stream::StringOutputStream blockDeviceMappingsSs;
         blockDeviceMappingsSs << location <<  ".item." << blockDeviceMappingsIdx++;
-        item.OutputToStream(oStream, blockDeviceMappingsSs.str().c_str());
+        item.OutputToStream(oStream, blockDeviceMappingsSs.GetString().c_str());
       }
   }
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
   if(m_networkInterfacesHasBeenSet)
   {
       unsigned networkInterfacesIdx = 1;
       for(auto& item : m_networkInterfaces)
       {
-        Aws::StringStream networkInterfacesSs;
+        Aws::Utils::Stream::StringOutputStream networkInterfacesSs;
         networkInterfacesSs << location <<  ".item." << networkInterfacesIdx++;
-        item.OutputToStream(oStream, networkInterfacesSs.str().c_str());
+        item.OutputToStream(oStream, networkInterfacesSs.GetString().c_str());
       }
   }
   if(m_iamInstanceProfileHasBeenSet)
@@ -402,7 +403,7 @@ void RequestSpotLaunchSpecification::OutputToStream(Aws::OStream& oStream, const
       unsigned securityGroupIdsIdx = 1;
       for(auto& item : m_securityGroupIds)
       {
-        oStream << location << ".item." << securityGroupIdsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".item." << securityGroupIdsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
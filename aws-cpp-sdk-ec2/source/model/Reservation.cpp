@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,19 +60,19 @@ Reservation& Reservation::operator =(const XmlNode& xmlNode)
     XmlNode reservationIdNode = resultNode.FirstChild("reservationId");
     if(!reservationIdNode.IsNull())
     {
-      m_reservationId = StringUtils::Trim(reservationIdNode.GetText().c_str());
+      m_reservationId = reservationIdNode.GetTextView().Trim().ToString();
       m_reservationIdHasBeenSet = true;
     }
     XmlNode ownerIdNode = resultNode.FirstChild("ownerId");
     if(!ownerIdNode.IsNull())
     {
-      m_ownerId = StringUtils::Trim(ownerIdNode.GetText().c_str());
+      m_ownerId = ownerIdNode.GetTextView().Trim().ToString();
       m_ownerIdHasBeenSet = true;
     }
     XmlNode requesterIdNode = resultNode.FirstChild("requesterId");
     if(!requesterIdNode.IsNull())
     {
-      m_requesterId = StringUtils::Trim(requesterIdNode.GetText().c_str());
+      m_requesterId = requesterIdNode.GetTextView().Trim().ToString();
       m_requesterIdHasBeenSet = true;
     }
     XmlNode groupsNode = resultNode.FirstChild("groupSet");
@@ -107,17 +108,17 @@ void Reservation::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_reservationIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReservationId=" << StringUtils::URLEncode(m_reservationId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReservationId=" << StringUtils::URLEncoded(m_reservationId) << "&";
   }
 
   if(m_ownerIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OwnerId=" << StringUtils::URLEncode(m_ownerId.c_str()) << "&";
+      oStream << location << index << locationValue << ".OwnerId=" << StringUtils::URLEncoded(m_ownerId) << "&";
   }
 
   if(m_requesterIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RequesterId=" << StringUtils::URLEncode(m_requesterId.c_str()) << "&";
+      oStream << location << index << locationValue << ".RequesterId=" << StringUtils::URLEncoded(m_requesterId) << "&";
   }
 
   if(m_groupsHasBeenSet)
@@ -125,9 +126,9 @@ void Reservation::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned groupsIdx = 1;
       for(auto& item : m_groups)
       {
-        Aws::StringStream groupsSs;
+        Aws::Utils::Stream::StringOutputStream groupsSs;
         groupsSs << location << index << locationValue << ".GroupSet." << groupsIdx++;
-        item.OutputToStream(oStream, groupsSs.str().c_str());
+        item.OutputToStream(oStream, groupsSs.GetString().c_str());
       }
   }
 
@@ -136,17 +137,17 @@ void Reservation::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned instancesIdx = 1;
       for(auto& item : m_instances)
       {
-        Aws::StringStream instancesSs;
+        Aws::Utils::Stream::StringOutputStream instancesSs;
         instancesSs << location << index << locationValue << ".InstancesSet." << instancesIdx++;
-        item.OutputToStream(oStream, instancesSs.str().c_str());
+        item.OutputToStream(oStream, instancesSs.GetString().c_str());
       }
   }
 
   if(m_responseMetadataHasBeenSet)
   {
-      Aws::StringStream responseMetadataLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream responseMetadataLocationAndMemberSs;
       responseMetadataLocationAndMemberSs << location << index << locationValue << ".ResponseMetadata";
-      m_responseMetadata.OutputToStream(oStream, responseMetadataLocationAndMemberSs.str().c_str());
+      m_responseMetadata.OutputToStream(oStream, responseMetadataLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -155,24 +156,24 @@ void Reservation::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_reservationIdHasBeenSet)
   {
-      oStream << location << ".ReservationId=" << StringUtils::URLEncode(m_reservationId.c_str()) << "&";
+      oStream << location << ".ReservationId=" << StringUtils::URLEncoded(m_reservationId) << "&";
   }
   if(m_ownerIdHasBeenSet)
   {
-      oStream << location << ".OwnerId=" << StringUtils::URLEncode(m_ownerId.c_str()) << "&";
+      oStream << location << ".OwnerId=" << StringUtils::URLEncoded(m_ownerId) << "&";
   }
   if(m_requesterIdHasBeenSet)
   {
-      oStream << location << ".RequesterId=" << StringUtils::URLEncode(m_requesterId.c_str()) << "&";
+      oStream << location << ".RequesterId=" << StringUtils::URLEncoded(m_requesterId) << "&";
   }
   if(m_groupsHasBeenSet)
   {
       unsigned groupsIdx = 1;
       for(auto& item : m_groups)
       {
-        Aws::StringStream groupsSs;
+        Aws::Utils::Stream::StringOutputStream groupsSs;
         groupsSs << location <<  ".item." << groupsIdx++;
-        item.OutputToStream(oStream, groupsSs.str().c_str());
+        item.OutputToStream(oStream, groupsSs.GetString().c_str());
       }
   }
   if(m_instancesHasBeenSet)
@@ -180,9 +181,9 @@ void Reservation::OutputToStream(Aws::OStream& oStream, const char* location) co
       unsigned instancesIdx = 1;
       for(auto& item : m_instances)
       {
-        Aws::StringStream instancesSs;
+        Aws::Utils::Stream::StringOutputStream instancesSs;
         instancesSs << location <<  ".item." << instancesIdx++;
-        item.OutputToStream(oStream, instancesSs.str().c_str());
+        item.OutputToStream(oStream, instancesSs.GetString().c_str());
       }
   }
   if(m_responseMetadataHasBeenSet)
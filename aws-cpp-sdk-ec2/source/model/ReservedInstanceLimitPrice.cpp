@@ -53,13 +53,13 @@ ReservedInstanceLimitPrice& ReservedInstanceLimitPrice::operator =(const XmlNode
     XmlNode amountNode = resultNode.FirstChild("amount");
     if(!amountNode.IsNull())
     {
-      m_amount = StringUtils::ConvertToDouble(StringUtils::Trim(amountNode.GetText().c_str()).c_str());
+      m_amount = StringUtils::ConvertToDouble(amountNode.GetTextView().Trim().ToString().c_str());
       m_amountHasBeenSet = true;
     }
     XmlNode currencyCodeNode = resultNode.FirstChild("currencyCode");
     if(!currencyCodeNode.IsNull())
     {
-      m_currencyCode = CurrencyCodeValuesMapper::GetCurrencyCodeValuesForName(StringUtils::Trim(currencyCodeNode.GetText().c_str()).c_str());
+      m_currencyCode = CurrencyCodeValuesMapper::GetCurrencyCodeValuesForName(currencyCodeNode.GetTextView().Trim().ToString().c_str());
       m_currencyCodeHasBeenSet = true;
     }
   }
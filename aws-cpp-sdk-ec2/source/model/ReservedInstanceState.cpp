@@ -29,31 +29,35 @@ namespace Aws
       namespace ReservedInstanceStateMapper
       {
 
-        static const int payment_pending_HASH = HashingUtils::HashString("payment-pending");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int payment_failed_HASH = HashingUtils::HashString("payment-failed");
-        static const int retired_HASH = HashingUtils::HashString("retired");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int payment_pending_HASH = -431343408;
+        static const int active_HASH = -1422950650;
+        static const int payment_failed_HASH = 1635621348;
+        static const int retired_HASH = 1098118057;
 
 
         ReservedInstanceState GetReservedInstanceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == payment_pending_HASH)
+          switch (hashCode)
           {
+          case payment_pending_HASH:
             return ReservedInstanceState::payment_pending;
-          }
-          else if (hashCode == active_HASH)
-          {
+          case active_HASH:
             return ReservedInstanceState::active;
-          }
-          else if (hashCode == payment_failed_HASH)
-          {
+          case payment_failed_HASH:
             return ReservedInstanceState::payment_failed;
-          }
-          else if (hashCode == retired_HASH)
-          {
+          case retired_HASH:
             return ReservedInstanceState::retired;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
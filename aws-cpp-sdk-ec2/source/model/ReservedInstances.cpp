@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -87,67 +88,67 @@ ReservedInstances& ReservedInstances::operator =(const XmlNode& xmlNode)
     XmlNode reservedInstancesIdNode = resultNode.FirstChild("reservedInstancesId");
     if(!reservedInstancesIdNode.IsNull())
     {
-      m_reservedInstancesId = StringUtils::Trim(reservedInstancesIdNode.GetText().c_str());
+      m_reservedInstancesId = reservedInstancesIdNode.GetTextView().Trim().ToString();
       m_reservedInstancesIdHasBeenSet = true;
     }
     XmlNode instanceTypeNode = resultNode.FirstChild("instanceType");
     if(!instanceTypeNode.IsNull())
     {
-      m_instanceType = InstanceTypeMapper::GetInstanceTypeForName(StringUtils::Trim(instanceTypeNode.GetText().c_str()).c_str());
+      m_instanceType = InstanceTypeMapper::GetInstanceTypeForName(instanceTypeNode.GetTextView().Trim().ToString().c_str());
       m_instanceTypeHasBeenSet = true;
     }
     XmlNode availabilityZoneNode = resultNode.FirstChild("availabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode startNode = resultNode.FirstChild("start");
     if(!startNode.IsNull())
     {
-      m_start = DateTime(StringUtils::Trim(startNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_start = DateTime(startNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_startHasBeenSet = true;
     }
     XmlNode endNode = resultNode.FirstChild("end");
     if(!endNode.IsNull())
     {
-      m_end = DateTime(StringUtils::Trim(endNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_end = DateTime(endNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_endHasBeenSet = true;
     }
     XmlNode durationNode = resultNode.FirstChild("duration");
     if(!durationNode.IsNull())
     {
-      m_duration = StringUtils::ConvertToInt64(StringUtils::Trim(durationNode.GetText().c_str()).c_str());
+      m_duration = StringUtils::ConvertToInt64(durationNode.GetTextView().Trim().ToString().c_str());
       m_durationHasBeenSet = true;
     }
     XmlNode usagePriceNode = resultNode.FirstChild("usagePrice");
     if(!usagePriceNode.IsNull())
     {
-      m_usagePrice = StringUtils::ConvertToDouble(StringUtils::Trim(usagePriceNode.GetText().c_str()).c_str());
+      m_usagePrice = StringUtils::ConvertToDouble(usagePriceNode.GetTextView().Trim().ToString().c_str());
       m_usagePriceHasBeenSet = true;
     }
     XmlNode fixedPriceNode = resultNode.FirstChild("fixedPrice");
     if(!fixedPriceNode.IsNull())
     {
-      m_fixedPrice = StringUtils::ConvertToDouble(StringUtils::Trim(fixedPriceNode.GetText().c_str()).c_str());
+      m_fixedPrice = StringUtils::ConvertToDouble(fixedPriceNode.GetTextView().Trim().ToString().c_str());
       m_fixedPriceHasBeenSet = true;
     }
     XmlNode instanceCountNode = resultNode.FirstChild("instanceCount");
     if(!instanceCountNode.IsNull())
     {
-      m_instanceCount = StringUtils::ConvertToInt32(StringUtils::Trim(instanceCountNode.GetText().c_str()).c_str());
+      m_instanceCount = StringUtils::ConvertToInt32(instanceCountNode.GetTextView().Trim().ToString().c_str());
       m_instanceCountHasBeenSet = true;
     }
     XmlNode productDescriptionNode = resultNode.FirstChild("productDescription");
     if(!productDescriptionNode.IsNull())
     {
-      m_productDescription = RIProductDescriptionMapper::GetRIProductDescriptionForName(StringUtils::Trim(productDescriptionNode.GetText().c_str()).c_str());
+      m_productDescription = RIProductDescriptionMapper::GetRIProductDescriptionForName(productDescriptionNode.GetTextView().Trim().ToString().c_str());
       m_productDescriptionHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = ReservedInstanceStateMapper::GetReservedInstanceStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = ReservedInstanceStateMapper::GetReservedInstanceStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("tagSet");
@@ -165,19 +166,19 @@ ReservedInstances& ReservedInstances::operator =(const XmlNode& xmlNode)
     XmlNode instanceTenancyNode = resultNode.FirstChild("instanceTenancy");
     if(!instanceTenancyNode.IsNull())
     {
-      m_instanceTenancy = TenancyMapper::GetTenancyForName(StringUtils::Trim(instanceTenancyNode.GetText().c_str()).c_str());
+      m_instanceTenancy = TenancyMapper::GetTenancyForName(instanceTenancyNode.GetTextView().Trim().ToString().c_str());
       m_instanceTenancyHasBeenSet = true;
     }
     XmlNode currencyCodeNode = resultNode.FirstChild("currencyCode");
     if(!currencyCodeNode.IsNull())
     {
-      m_currencyCode = CurrencyCodeValuesMapper::GetCurrencyCodeValuesForName(StringUtils::Trim(currencyCodeNode.GetText().c_str()).c_str());
+      m_currencyCode = CurrencyCodeValuesMapper::GetCurrencyCodeValuesForName(currencyCodeNode.GetTextView().Trim().ToString().c_str());
       m_currencyCodeHasBeenSet = true;
     }
     XmlNode offeringTypeNode = resultNode.FirstChild("offeringType");
     if(!offeringTypeNode.IsNull())
     {
-      m_offeringType = OfferingTypeValuesMapper::GetOfferingTypeValuesForName(StringUtils::Trim(offeringTypeNode.GetText().c_str()).c_str());
+      m_offeringType = OfferingTypeValuesMapper::GetOfferingTypeValuesForName(offeringTypeNode.GetTextView().Trim().ToString().c_str());
       m_offeringTypeHasBeenSet = true;
     }
     XmlNode recurringChargesNode = resultNode.FirstChild("recurringCharges");
@@ -201,7 +202,7 @@ void ReservedInstances::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_reservedInstancesIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReservedInstancesId=" << StringUtils::URLEncode(m_reservedInstancesId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReservedInstancesId=" << StringUtils::URLEncoded(m_reservedInstancesId) << "&";
   }
 
   if(m_instanceTypeHasBeenSet)
@@ -211,17 +212,17 @@ void ReservedInstances::OutputToStream(Aws::OStream& oStream, const char* locati
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_startHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Start=" << StringUtils::URLEncode(m_start.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".Start=" << StringUtils::URLEncoded(m_start.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_endHasBeenSet)
   {
-      oStream << location << index << locationValue << ".End=" << StringUtils::URLEncode(m_end.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".End=" << StringUtils::URLEncoded(m_end.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_durationHasBeenSet)
@@ -259,9 +260,9 @@ void ReservedInstances::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -285,9 +286,9 @@ void ReservedInstances::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned recurringChargesIdx = 1;
       for(auto& item : m_recurringCharges)
       {
-        Aws::StringStream recurringChargesSs;
+        Aws::Utils::Stream::StringOutputStream recurringChargesSs;
         recurringChargesSs << location << index << locationValue << ".RecurringCharges." << recurringChargesIdx++;
-        item.OutputToStream(oStream, recurringChargesSs.str().c_str());
+        item.OutputToStream(oStream, recurringChargesSs.GetString().c_str());
       }
   }
 
@@ -297,7 +298,7 @@ void ReservedInstances::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_reservedInstancesIdHasBeenSet)
   {
-      oStream << location << ".ReservedInstancesId=" << StringUtils::URLEncode(m_reservedInstancesId.c_str()) << "&";
+      oStream << location << ".ReservedInstancesId=" << StringUtils::URLEncoded(m_reservedInstancesId) << "&";
   }
   if(m_instanceTypeHasBeenSet)
   {
@@ -305,15 +306,15 @@ void ReservedInstances::OutputToStream(Aws::OStream& oStream, const char* locati
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_startHasBeenSet)
   {
-      oStream << location << ".Start=" << StringUtils::URLEncode(m_start.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".Start=" << StringUtils::URLEncoded(m_start.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_endHasBeenSet)
   {
-      oStream << location << ".End=" << StringUtils::URLEncode(m_end.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".End=" << StringUtils::URLEncoded(m_end.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_durationHasBeenSet)
   {
@@ -344,9 +345,9 @@ void ReservedInstances::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
   if(m_instanceTenancyHasBeenSet)
@@ -366,9 +367,9 @@ void ReservedInstances::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned recurringChargesIdx = 1;
       for(auto& item : m_recurringCharges)
       {
-        Aws::StringStream recurringChargesSs;
+        Aws::Utils::Stream::StringOutputStream recurringChargesSs;
         recurringChargesSs << location <<  ".item." << recurringChargesIdx++;
-        item.OutputToStream(oStream, recurringChargesSs.str().c_str());
+        item.OutputToStream(oStream, recurringChargesSs.GetString().c_str());
       }
   }
 }
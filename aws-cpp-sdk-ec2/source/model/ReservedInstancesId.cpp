@@ -49,7 +49,7 @@ ReservedInstancesId& ReservedInstancesId::operator =(const XmlNode& xmlNode)
     XmlNode reservedInstancesIdNode = resultNode.FirstChild("reservedInstancesId");
     if(!reservedInstancesIdNode.IsNull())
     {
-      m_reservedInstancesId = StringUtils::Trim(reservedInstancesIdNode.GetText().c_str());
+      m_reservedInstancesId = reservedInstancesIdNode.GetTextView().Trim().ToString();
       m_reservedInstancesIdHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void ReservedInstancesId::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_reservedInstancesIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReservedInstancesId=" << StringUtils::URLEncode(m_reservedInstancesId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReservedInstancesId=" << StringUtils::URLEncoded(m_reservedInstancesId) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void ReservedInstancesId::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_reservedInstancesIdHasBeenSet)
   {
-      oStream << location << ".ReservedInstancesId=" << StringUtils::URLEncode(m_reservedInstancesId.c_str()) << "&";
+      oStream << location << ".ReservedInstancesId=" << StringUtils::URLEncoded(m_reservedInstancesId) << "&";
   }
 }
 
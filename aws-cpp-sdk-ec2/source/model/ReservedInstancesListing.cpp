@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -67,37 +68,37 @@ ReservedInstancesListing& ReservedInstancesListing::operator =(const XmlNode& xm
     XmlNode reservedInstancesListingIdNode = resultNode.FirstChild("reservedInstancesListingId");
     if(!reservedInstancesListingIdNode.IsNull())
     {
-      m_reservedInstancesListingId = StringUtils::Trim(reservedInstancesListingIdNode.GetText().c_str());
+      m_reservedInstancesListingId = reservedInstancesListingIdNode.GetTextView().Trim().ToString();
       m_reservedInstancesListingIdHasBeenSet = true;
     }
     XmlNode reservedInstancesIdNode = resultNode.FirstChild("reservedInstancesId");
     if(!reservedInstancesIdNode.IsNull())
     {
-      m_reservedInstancesId = StringUtils::Trim(reservedInstancesIdNode.GetText().c_str());
+      m_reservedInstancesId = reservedInstancesIdNode.GetTextView().Trim().ToString();
       m_reservedInstancesIdHasBeenSet = true;
     }
     XmlNode createDateNode = resultNode.FirstChild("createDate");
     if(!createDateNode.IsNull())
     {
-      m_createDate = DateTime(StringUtils::Trim(createDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createDate = DateTime(createDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createDateHasBeenSet = true;
     }
     XmlNode updateDateNode = resultNode.FirstChild("updateDate");
     if(!updateDateNode.IsNull())
     {
-      m_updateDate = DateTime(StringUtils::Trim(updateDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_updateDate = DateTime(updateDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_updateDateHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = ListingStatusMapper::GetListingStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = ListingStatusMapper::GetListingStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode statusMessageNode = resultNode.FirstChild("statusMessage");
     if(!statusMessageNode.IsNull())
     {
-      m_statusMessage = StringUtils::Trim(statusMessageNode.GetText().c_str());
+      m_statusMessage = statusMessageNode.GetTextView().Trim().ToString();
       m_statusMessageHasBeenSet = true;
     }
     XmlNode instanceCountsNode = resultNode.FirstChild("instanceCounts");
@@ -139,7 +140,7 @@ ReservedInstancesListing& ReservedInstancesListing::operator =(const XmlNode& xm
     XmlNode clientTokenNode = resultNode.FirstChild("clientToken");
     if(!clientTokenNode.IsNull())
     {
-      m_clientToken = StringUtils::Trim(clientTokenNode.GetText().c_str());
+      m_clientToken = clientTokenNode.GetTextView().Trim().ToString();
       m_clientTokenHasBeenSet = true;
     }
   }
@@ -151,22 +152,22 @@ void ReservedInstancesListing::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_reservedInstancesListingIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReservedInstancesListingId=" << StringUtils::URLEncode(m_reservedInstancesListingId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReservedInstancesListingId=" << StringUtils::URLEncoded(m_reservedInstancesListingId) << "&";
   }
 
   if(m_reservedInstancesIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReservedInstancesId=" << StringUtils::URLEncode(m_reservedInstancesId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReservedInstancesId=" << StringUtils::URLEncoded(m_reservedInstancesId) << "&";
   }
 
   if(m_createDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_updateDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UpdateDate=" << StringUtils::URLEncode(m_updateDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".UpdateDate=" << StringUtils::URLEncoded(m_updateDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_statusHasBeenSet)
@@ -176,7 +177,7 @@ void ReservedInstancesListing::OutputToStream(Aws::OStream& oStream, const char*
 
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
 
   if(m_instanceCountsHasBeenSet)
@@ -184,9 +185,9 @@ void ReservedInstancesListing::OutputToStream(Aws::OStream& oStream, const char*
       unsigned instanceCountsIdx = 1;
       for(auto& item : m_instanceCounts)
       {
-        Aws::StringStream instanceCountsSs;
+        Aws::Utils::Stream::StringOutputStream instanceCountsSs;
         instanceCountsSs << location << index << locationValue << ".InstanceCounts." << instanceCountsIdx++;
-        item.OutputToStream(oStream, instanceCountsSs.str().c_str());
+        item.OutputToStream(oStream, instanceCountsSs.GetString().c_str());
       }
   }
 
@@ -195,9 +196,9 @@ void ReservedInstancesListing::OutputToStream(Aws::OStream& oStream, const char*
       unsigned priceSchedulesIdx = 1;
       for(auto& item : m_priceSchedules)
       {
-        Aws::StringStream priceSchedulesSs;
+        Aws::Utils::Stream::StringOutputStream priceSchedulesSs;
         priceSchedulesSs << location << index << locationValue << ".PriceSchedules." << priceSchedulesIdx++;
-        item.OutputToStream(oStream, priceSchedulesSs.str().c_str());
+        item.OutputToStream(oStream, priceSchedulesSs.GetString().c_str());
       }
   }
 
@@ -206,15 +207,15 @@ void ReservedInstancesListing::OutputToStream(Aws::OStream& oStream, const char*
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
   if(m_clientTokenHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
 }
@@ -223,19 +224,19 @@ void ReservedInstancesListing::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_reservedInstancesListingIdHasBeenSet)
   {
-      oStream << location << ".ReservedInstancesListingId=" << StringUtils::URLEncode(m_reservedInstancesListingId.c_str()) << "&";
+      oStream << location << ".ReservedInstancesListingId=" << StringUtils::URLEncoded(m_reservedInstancesListingId) << "&";
   }
   if(m_reservedInstancesIdHasBeenSet)
   {
-      oStream << location << ".ReservedInstancesId=" << StringUtils::URLEncode(m_reservedInstancesId.c_str()) << "&";
+      oStream << location << ".ReservedInstancesId=" << StringUtils::URLEncoded(m_reservedInstancesId) << "&";
   }
   if(m_createDateHasBeenSet)
   {
-      oStream << location << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_updateDateHasBeenSet)
   {
-      oStream << location << ".UpdateDate=" << StringUtils::URLEncode(m_updateDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".UpdateDate=" << StringUtils::URLEncoded(m_updateDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_statusHasBeenSet)
   {
@@ -243,16 +244,16 @@ void ReservedInstancesListing::OutputToStream(Aws::OStream& oStream, const char*
   }
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
   if(m_instanceCountsHasBeenSet)
   {
       unsigned instanceCountsIdx = 1;
       for(auto& item : m_instanceCounts)
       {
-        Aws::StringStream instanceCountsSs;
+        Aws::Utils::Stream::StringOutputStream instanceCountsSs;
         instanceCountsSs << location <<  ".item." << instanceCountsIdx++;
-        item.OutputToStream(oStream, instanceCountsSs.str().c_str());
+        item.OutputToStream(oStream, instanceCountsSs.GetString().c_str());
       }
   }
   if(m_priceSchedulesHasBeenSet)
@@ -260,9 +261,9 @@ void ReservedInstancesListing::OutputToStream(Aws::OStream& oStream, const char*
       unsigned priceSchedulesIdx = 1;
       for(auto& item : m_priceSchedules)
       {
-        Aws::StringStream priceSchedulesSs;
+        Aws::Utils::Stream::StringOutputStream priceSchedulesSs;
         priceSchedulesSs << location <<  ".item." << priceSchedulesIdx++;
-        item.OutputToStream(oStream, priceSchedulesSs.str().c_str());
+        item.OutputToStream(oStream, priceSchedulesSs.GetString().c_str());
       }
   }
   if(m_tagsHasBeenSet)
@@ -270,14 +271,14 @@ void ReservedInstancesListing::OutputToStream(Aws::OStream& oStream, const char*
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
   if(m_clientTokenHasBeenSet)
   {
-      oStream << location << ".ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+      oStream << location << ".ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -65,7 +66,7 @@ ReservedInstancesModification& ReservedInstancesModification::operator =(const X
     XmlNode reservedInstancesModificationIdNode = resultNode.FirstChild("reservedInstancesModificationId");
     if(!reservedInstancesModificationIdNode.IsNull())
     {
-      m_reservedInstancesModificationId = StringUtils::Trim(reservedInstancesModificationIdNode.GetText().c_str());
+      m_reservedInstancesModificationId = reservedInstancesModificationIdNode.GetTextView().Trim().ToString();
       m_reservedInstancesModificationIdHasBeenSet = true;
     }
     XmlNode reservedInstancesIdsNode = resultNode.FirstChild("reservedInstancesSet");
@@ -95,37 +96,37 @@ ReservedInstancesModification& ReservedInstancesModification::operator =(const X
     XmlNode createDateNode = resultNode.FirstChild("createDate");
     if(!createDateNode.IsNull())
     {
-      m_createDate = DateTime(StringUtils::Trim(createDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createDate = DateTime(createDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createDateHasBeenSet = true;
     }
     XmlNode updateDateNode = resultNode.FirstChild("updateDate");
     if(!updateDateNode.IsNull())
     {
-      m_updateDate = DateTime(StringUtils::Trim(updateDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_updateDate = DateTime(updateDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_updateDateHasBeenSet = true;
     }
     XmlNode effectiveDateNode = resultNode.FirstChild("effectiveDate");
     if(!effectiveDateNode.IsNull())
     {
-      m_effectiveDate = DateTime(StringUtils::Trim(effectiveDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_effectiveDate = DateTime(effectiveDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_effectiveDateHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode statusMessageNode = resultNode.FirstChild("statusMessage");
     if(!statusMessageNode.IsNull())
     {
-      m_statusMessage = StringUtils::Trim(statusMessageNode.GetText().c_str());
+      m_statusMessage = statusMessageNode.GetTextView().Trim().ToString();
       m_statusMessageHasBeenSet = true;
     }
     XmlNode clientTokenNode = resultNode.FirstChild("clientToken");
     if(!clientTokenNode.IsNull())
     {
-      m_clientToken = StringUtils::Trim(clientTokenNode.GetText().c_str());
+      m_clientToken = clientTokenNode.GetTextView().Trim().ToString();
       m_clientTokenHasBeenSet = true;
     }
   }
@@ -137,7 +138,7 @@ void ReservedInstancesModification::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_reservedInstancesModificationIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReservedInstancesModificationId=" << StringUtils::URLEncode(m_reservedInstancesModificationId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReservedInstancesModificationId=" << StringUtils::URLEncoded(m_reservedInstancesModificationId) << "&";
   }
 
   if(m_reservedInstancesIdsHasBeenSet)
@@ -145,9 +146,9 @@ void ReservedInstancesModification::OutputToStream(Aws::OStream& oStream, const
       unsigned reservedInstancesIdsIdx = 1;
       for(auto& item : m_reservedInstancesIds)
       {
-        Aws::StringStream reservedInstancesIdsSs;
+        Aws::Utils::Stream::StringOutputStream reservedInstancesIdsSs;
         reservedInstancesIdsSs << location << index << locationValue << ".ReservedInstancesSet." << reservedInstancesIdsIdx++;
-        item.OutputToStream(oStream, reservedInstancesIdsSs.str().c_str());
+        item.OutputToStream(oStream, reservedInstancesIdsSs.GetString().c_str());
       }
   }
 
@@ -156,40 +157,40 @@ void ReservedInstancesModification::OutputToStream(Aws::OStream& oStream, const
       unsigned modificationResultsIdx = 1;
       for(auto& item : m_modificationResults)
       {
-        Aws::StringStream modificationResultsSs;
+        Aws::Utils::Stream::StringOutputStream modificationResultsSs;
         modificationResultsSs << location << index << locationValue << ".ModificationResultSet." << modificationResultsIdx++;
-        item.OutputToStream(oStream, modificationResultsSs.str().c_str());
+        item.OutputToStream(oStream, modificationResultsSs.GetString().c_str());
       }
   }
 
   if(m_createDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_updateDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UpdateDate=" << StringUtils::URLEncode(m_updateDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".UpdateDate=" << StringUtils::URLEncoded(m_updateDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_effectiveDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EffectiveDate=" << StringUtils::URLEncode(m_effectiveDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".EffectiveDate=" << StringUtils::URLEncoded(m_effectiveDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
 
   if(m_clientTokenHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
 }
@@ -198,16 +199,16 @@ void ReservedInstancesModification::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_reservedInstancesModificationIdHasBeenSet)
   {
-      oStream << location << ".ReservedInstancesModificationId=" << StringUtils::URLEncode(m_reservedInstancesModificationId.c_str()) << "&";
+      oStream << location << ".ReservedInstancesModificationId=" << StringUtils::URLEncoded(m_reservedInstancesModificationId) << "&";
   }
   if(m_reservedInstancesIdsHasBeenSet)
   {
       unsigned reservedInstancesIdsIdx = 1;
       for(auto& item : m_reservedInstancesIds)
       {
-        Aws::StringStream reservedInstancesIdsSs;
+        Aws::Utils::Stream::StringOutputStream reservedInstancesIdsSs;
         reservedInstancesIdsSs << location <<  ".item." << reservedInstancesIdsIdx++;
-        item.OutputToStream(oStream, reservedInstancesIdsSs.str().c_str());
+        item.OutputToStream(oStream, reservedInstancesIdsSs.GetString().c_str());
       }
   }
   if(m_modificationResultsHasBeenSet)
@@ -215,34 +216,34 @@ void ReservedInstancesModification::OutputToStream(Aws::OStream& oStream, const
       unsigned modificationResultsIdx = 1;
       for(auto& item : m_modificationResults)
       {
-        Aws::StringStream modificationResultsSs;
+        Aws::Utils::Stream::StringOutputStream modificationResultsSs;
         modificationResultsSs << location <<  ".item." << modificationResultsIdx++;
-        item.OutputToStream(oStream, modificationResultsSs.str().c_str());
+        item.OutputToStream(oStream, modificationResultsSs.GetString().c_str());
       }
   }
   if(m_createDateHasBeenSet)
   {
-      oStream << location << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_updateDateHasBeenSet)
   {
-      oStream << location << ".UpdateDate=" << StringUtils::URLEncode(m_updateDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".UpdateDate=" << StringUtils::URLEncoded(m_updateDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_effectiveDateHasBeenSet)
   {
-      oStream << location << ".EffectiveDate=" << StringUtils::URLEncode(m_effectiveDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".EffectiveDate=" << StringUtils::URLEncoded(m_effectiveDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
   if(m_clientTokenHasBeenSet)
   {
-      oStream << location << ".ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+      oStream << location << ".ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 }
 
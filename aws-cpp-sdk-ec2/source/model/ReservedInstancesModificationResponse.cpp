@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ ReservedInstancesModificationResponse& ReservedInstancesModificationResponse::op
     XmlNode reservedInstancesIdNode = resultNode.FirstChild("reservedInstancesId");
     if(!reservedInstancesIdNode.IsNull())
     {
-      m_reservedInstancesId = StringUtils::Trim(reservedInstancesIdNode.GetText().c_str());
+      m_reservedInstancesId = reservedInstancesIdNode.GetTextView().Trim().ToString();
       m_reservedInstancesIdHasBeenSet = true;
     }
     XmlNode targetConfigurationNode = resultNode.FirstChild("targetConfiguration");
@@ -69,14 +70,14 @@ void ReservedInstancesModificationResponse::OutputToStream(Aws::OStream& oStream
 {
   if(m_reservedInstancesIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReservedInstancesId=" << StringUtils::URLEncode(m_reservedInstancesId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReservedInstancesId=" << StringUtils::URLEncoded(m_reservedInstancesId) << "&";
   }
 
   if(m_targetConfigurationHasBeenSet)
   {
-      Aws::StringStream targetConfigurationLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream targetConfigurationLocationAndMemberSs;
       targetConfigurationLocationAndMemberSs << location << index << locationValue << ".TargetConfiguration";
-      m_targetConfiguration.OutputToStream(oStream, targetConfigurationLocationAndMemberSs.str().c_str());
+      m_targetConfiguration.OutputToStream(oStream, targetConfigurationLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -85,7 +86,7 @@ void ReservedInstancesModificationResponse::OutputToStream(Aws::OStream& oStream
 {
   if(m_reservedInstancesIdHasBeenSet)
   {
-      oStream << location << ".ReservedInstancesId=" << StringUtils::URLEncode(m_reservedInstancesId.c_str()) << "&";
+      oStream << location << ".ReservedInstancesId=" << StringUtils::URLEncoded(m_reservedInstancesId) << "&";
   }
   if(m_targetConfigurationHasBeenSet)
   {
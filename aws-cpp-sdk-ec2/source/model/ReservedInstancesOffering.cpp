@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -81,61 +82,61 @@ ReservedInstancesOffering& ReservedInstancesOffering::operator =(const XmlNode&
     XmlNode reservedInstancesOfferingIdNode = resultNode.FirstChild("reservedInstancesOfferingId");
     if(!reservedInstancesOfferingIdNode.IsNull())
     {
-      m_reservedInstancesOfferingId = StringUtils::Trim(reservedInstancesOfferingIdNode.GetText().c_str());
+      m_reservedInstancesOfferingId = reservedInstancesOfferingIdNode.GetTextView().Trim().ToString();
       m_reservedInstancesOfferingIdHasBeenSet = true;
     }
     XmlNode instanceTypeNode = resultNode.FirstChild("instanceType");
     if(!instanceTypeNode.IsNull())
     {
-      m_instanceType = InstanceTypeMapper::GetInstanceTypeForName(StringUtils::Trim(instanceTypeNode.GetText().c_str()).c_str());
+      m_instanceType = InstanceTypeMapper::GetInstanceTypeForName(instanceTypeNode.GetTextView().Trim().ToString().c_str());
       m_instanceTypeHasBeenSet = true;
     }
     XmlNode availabilityZoneNode = resultNode.FirstChild("availabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode durationNode = resultNode.FirstChild("duration");
     if(!durationNode.IsNull())
     {
-      m_duration = StringUtils::ConvertToInt64(StringUtils::Trim(durationNode.GetText().c_str()).c_str());
+      m_duration = StringUtils::ConvertToInt64(durationNode.GetTextView().Trim().ToString().c_str());
       m_durationHasBeenSet = true;
     }
     XmlNode usagePriceNode = resultNode.FirstChild("usagePrice");
     if(!usagePriceNode.IsNull())
     {
-      m_usagePrice = StringUtils::ConvertToDouble(StringUtils::Trim(usagePriceNode.GetText().c_str()).c_str());
+      m_usagePrice = StringUtils::ConvertToDouble(usagePriceNode.GetTextView().Trim().ToString().c_str());
       m_usagePriceHasBeenSet = true;
     }
     XmlNode fixedPriceNode = resultNode.FirstChild("fixedPrice");
     if(!fixedPriceNode.IsNull())
     {
-      m_fixedPrice = StringUtils::ConvertToDouble(StringUtils::Trim(fixedPriceNode.GetText().c_str()).c_str());
+      m_fixedPrice = StringUtils::ConvertToDouble(fixedPriceNode.GetTextView().Trim().ToString().c_str());
       m_fixedPriceHasBeenSet = true;
     }
     XmlNode productDescriptionNode = resultNode.FirstChild("productDescription");
     if(!productDescriptionNode.IsNull())
     {
-      m_productDescription = RIProductDescriptionMapper::GetRIProductDescriptionForName(StringUtils::Trim(productDescriptionNode.GetText().c_str()).c_str());
+      m_productDescription = RIProductDescriptionMapper::GetRIProductDescriptionForName(productDescriptionNode.GetTextView().Trim().ToString().c_str());
       m_productDescriptionHasBeenSet = true;
     }
     XmlNode instanceTenancyNode = resultNode.FirstChild("instanceTenancy");
     if(!instanceTenancyNode.IsNull())
     {
-      m_instanceTenancy = TenancyMapper::GetTenancyForName(StringUtils::Trim(instanceTenancyNode.GetText().c_str()).c_str());
+      m_instanceTenancy = TenancyMapper::GetTenancyForName(instanceTenancyNode.GetTextView().Trim().ToString().c_str());
       m_instanceTenancyHasBeenSet = true;
     }
     XmlNode currencyCodeNode = resultNode.FirstChild("currencyCode");
     if(!currencyCodeNode.IsNull())
     {
-      m_currencyCode = CurrencyCodeValuesMapper::GetCurrencyCodeValuesForName(StringUtils::Trim(currencyCodeNode.GetText().c_str()).c_str());
+      m_currencyCode = CurrencyCodeValuesMapper::GetCurrencyCodeValuesForName(currencyCodeNode.GetTextView().Trim().ToString().c_str());
       m_currencyCodeHasBeenSet = true;
     }
     XmlNode offeringTypeNode = resultNode.FirstChild("offeringType");
     if(!offeringTypeNode.IsNull())
     {
-      m_offeringType = OfferingTypeValuesMapper::GetOfferingTypeValuesForName(StringUtils::Trim(offeringTypeNode.GetText().c_str()).c_str());
+      m_offeringType = OfferingTypeValuesMapper::GetOfferingTypeValuesForName(offeringTypeNode.GetTextView().Trim().ToString().c_str());
       m_offeringTypeHasBeenSet = true;
     }
     XmlNode recurringChargesNode = resultNode.FirstChild("recurringCharges");
@@ -153,7 +154,7 @@ ReservedInstancesOffering& ReservedInstancesOffering::operator =(const XmlNode&
     XmlNode marketplaceNode = resultNode.FirstChild("marketplace");
     if(!marketplaceNode.IsNull())
     {
-      m_marketplace = StringUtils::ConvertToBool(StringUtils::Trim(marketplaceNode.GetText().c_str()).c_str());
+      m_marketplace = StringUtils::ConvertToBool(marketplaceNode.GetTextView().Trim().ToString().c_str());
       m_marketplaceHasBeenSet = true;
     }
     XmlNode pricingDetailsNode = resultNode.FirstChild("pricingDetailsSet");
@@ -177,7 +178,7 @@ void ReservedInstancesOffering::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_reservedInstancesOfferingIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReservedInstancesOfferingId=" << StringUtils::URLEncode(m_reservedInstancesOfferingId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReservedInstancesOfferingId=" << StringUtils::URLEncoded(m_reservedInstancesOfferingId) << "&";
   }
 
   if(m_instanceTypeHasBeenSet)
@@ -187,7 +188,7 @@ void ReservedInstancesOffering::OutputToStream(Aws::OStream& oStream, const char
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_durationHasBeenSet)
@@ -230,9 +231,9 @@ void ReservedInstancesOffering::OutputToStream(Aws::OStream& oStream, const char
       unsigned recurringChargesIdx = 1;
       for(auto& item : m_recurringCharges)
       {
-        Aws::StringStream recurringChargesSs;
+        Aws::Utils::Stream::StringOutputStream recurringChargesSs;
         recurringChargesSs << location << index << locationValue << ".RecurringCharges." << recurringChargesIdx++;
-        item.OutputToStream(oStream, recurringChargesSs.str().c_str());
+        item.OutputToStream(oStream, recurringChargesSs.GetString().c_str());
       }
   }
 
@@ -246,9 +247,9 @@ void ReservedInstancesOffering::OutputToStream(Aws::OStream& oStream, const char
       unsigned pricingDetailsIdx = 1;
       for(auto& item : m_pricingDetails)
       {
-        Aws::StringStream pricingDetailsSs;
+        Aws::Utils::Stream::StringOutputStream pricingDetailsSs;
         pricingDetailsSs << location << index << locationValue << ".PricingDetailsSet." << pricingDetailsIdx++;
-        item.OutputToStream(oStream, pricingDetailsSs.str().c_str());
+        item.OutputToStream(oStream, pricingDetailsSs.GetString().c_str());
       }
   }
 
@@ -258,7 +259,7 @@ void ReservedInstancesOffering::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_reservedInstancesOfferingIdHasBeenSet)
   {
-      oStream << location << ".ReservedInstancesOfferingId=" << StringUtils::URLEncode(m_reservedInstancesOfferingId.c_str()) << "&";
+      oStream << location << ".ReservedInstancesOfferingId=" << StringUtils::URLEncoded(m_reservedInstancesOfferingId) << "&";
   }
   if(m_instanceTypeHasBeenSet)
   {
@@ -266,7 +267,7 @@ void ReservedInstancesOffering::OutputToStream(Aws::OStream& oStream, const char
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_durationHasBeenSet)
   {
@@ -301,9 +302,9 @@ void ReservedInstancesOffering::OutputToStream(Aws::OStream& oStream, const char
       unsigned recurringChargesIdx = 1;
       for(auto& item : m_recurringCharges)
       {
-        Aws::StringStream recurringChargesSs;
+        Aws::Utils::Stream::StringOutputStream recurringChargesSs;
         recurringChargesSs << location <<  ".item." << recurringChargesIdx++;
-        item.OutputToStream(oStream, recurringChargesSs.str().c_str());
+        item.OutputToStream(oStream, recurringChargesSs.GetString().c_str());
       }
   }
   if(m_marketplaceHasBeenSet)
@@ -315,9 +316,9 @@ void ReservedInstancesOffering::OutputToStream(Aws::OStream& oStream, const char
       unsigned pricingDetailsIdx = 1;
       for(auto& item : m_pricingDetails)
       {
-        Aws::StringStream pricingDetailsSs;
+        Aws::Utils::Stream::StringOutputStream pricingDetailsSs;
         pricingDetailsSs << location <<  ".item." << pricingDetailsIdx++;
-        item.OutputToStream(oStream, pricingDetailsSs.str().c_str());
+        item.OutputToStream(oStream, pricingDetailsSs.GetString().c_str());
       }
   }
 }
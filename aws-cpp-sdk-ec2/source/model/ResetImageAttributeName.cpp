@@ -29,16 +29,26 @@ namespace Aws
       namespace ResetImageAttributeNameMapper
       {
 
-        static const int launchPermission_HASH = HashingUtils::HashString("launchPermission");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int launchPermission_HASH = -1159069214;
 
 
         ResetImageAttributeName GetResetImageAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == launchPermission_HASH)
+          switch (hashCode)
           {
+          case launchPermission_HASH:
             return ResetImageAttributeName::launchPermission;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
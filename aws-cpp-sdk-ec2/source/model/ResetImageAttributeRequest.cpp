@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ResetImageAttributeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ ResetImageAttributeRequest::ResetImageAttributeRequest() :
 
 Aws::String ResetImageAttributeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ResetImageAttribute&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,7 +39,7 @@ Aws::String ResetImageAttributeRequest::SerializePayload() const
 
   if(m_imageIdHasBeenSet)
   {
-    ss << "ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+    ss << "ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
 
   if(m_attributeHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String ResetImageAttributeRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/ResetNetworkInterfaceAttributeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ ResetNetworkInterfaceAttributeRequest::ResetNetworkInterfaceAttributeRequest() :
 
 Aws::String ResetNetworkInterfaceAttributeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ResetNetworkInterfaceAttribute&";
   if(m_dryRunHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String ResetNetworkInterfaceAttributeRequest::SerializePayload() const
 
   if(m_networkInterfaceIdHasBeenSet)
   {
-    ss << "NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+    ss << "NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
 
   if(m_sourceDestCheckHasBeenSet)
   {
-    ss << "SourceDestCheck=" << StringUtils::URLEncode(m_sourceDestCheck.c_str()) << "&";
+    ss << "SourceDestCheck=" << StringUtils::URLEncoded(m_sourceDestCheck) << "&";
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -29,96 +29,74 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int customer_gateway_HASH = HashingUtils::HashString("customer-gateway");
-        static const int dhcp_options_HASH = HashingUtils::HashString("dhcp-options");
-        static const int image_HASH = HashingUtils::HashString("image");
-        static const int instance_HASH = HashingUtils::HashString("instance");
-        static const int internet_gateway_HASH = HashingUtils::HashString("internet-gateway");
-        static const int network_acl_HASH = HashingUtils::HashString("network-acl");
-        static const int network_interface_HASH = HashingUtils::HashString("network-interface");
-        static const int reserved_instances_HASH = HashingUtils::HashString("reserved-instances");
-        static const int route_table_HASH = HashingUtils::HashString("route-table");
-        static const int snapshot_HASH = HashingUtils::HashString("snapshot");
-        static const int spot_instances_request_HASH = HashingUtils::HashString("spot-instances-request");
-        static const int subnet_HASH = HashingUtils::HashString("subnet");
-        static const int security_group_HASH = HashingUtils::HashString("security-group");
-        static const int volume_HASH = HashingUtils::HashString("volume");
-        static const int vpc_HASH = HashingUtils::HashString("vpc");
-        static const int vpn_connection_HASH = HashingUtils::HashString("vpn-connection");
-        static const int vpn_gateway_HASH = HashingUtils::HashString("vpn-gateway");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int customer_gateway_HASH = 819587925;
+        static const int dhcp_options_HASH = -859836222;
+        static const int image_HASH = 100313435;
+        static const int instance_HASH = 555127957;
+        static const int internet_gateway_HASH = -1040703560;
+        static const int network_acl_HASH = -1941798805;
+        static const int network_interface_HASH = 2137999450;
+        static const int reserved_instances_HASH = -833840615;
+        static const int route_table_HASH = 1093560138;
+        static const int snapshot_HASH = 284874180;
+        static const int spot_instances_request_HASH = -1720470987;
+        static const int subnet_HASH = -891534499;
+        static const int security_group_HASH = -1797844558;
+        static const int volume_HASH = -810883302;
+        static const int vpc_HASH = 116969;
+        static const int vpn_connection_HASH = -1042628265;
+        static const int vpn_gateway_HASH = 1849867883;
 
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == customer_gateway_HASH)
+          switch (hashCode)
           {
+          case customer_gateway_HASH:
             return ResourceType::customer_gateway;
-          }
-          else if (hashCode == dhcp_options_HASH)
-          {
+          case dhcp_options_HASH:
             return ResourceType::dhcp_options;
-          }
-          else if (hashCode == image_HASH)
-          {
+          case image_HASH:
             return ResourceType::image;
-          }
-          else if (hashCode == instance_HASH)
-          {
+          case instance_HASH:
             return ResourceType::instance;
-          }
-          else if (hashCode == internet_gateway_HASH)
-          {
+          case internet_gateway_HASH:
             return ResourceType::internet_gateway;
-          }
-          else if (hashCode == network_acl_HASH)
-          {
+          case network_acl_HASH:
             return ResourceType::network_acl;
-          }
-          else if (hashCode == network_interface_HASH)
-          {
+          case network_interface_HASH:
             return ResourceType::network_interface;
-          }
-          else if (hashCode == reserved_instances_HASH)
-          {
+          case reserved_instances_HASH:
             return ResourceType::reserved_instances;
-          }
-          else if (hashCode == route_table_HASH)
-          {
+          case route_table_HASH:
             return ResourceType::route_table;
-          }
-          else if (hashCode == snapshot_HASH)
-          {
+          case snapshot_HASH:
             return ResourceType::snapshot;
-          }
-          else if (hashCode == spot_instances_request_HASH)
-          {
+          case spot_instances_request_HASH:
             return ResourceType::spot_instances_request;
-          }
-          else if (hashCode == subnet_HASH)
-          {
+          case subnet_HASH:
             return ResourceType::subnet;
-          }
-          else if (hashCode == security_group_HASH)
-          {
+          case security_group_HASH:
             return ResourceType::security_group;
-          }
-          else if (hashCode == volume_HASH)
-          {
+          case volume_HASH:
             return ResourceType::volume;
-          }
-          else if (hashCode == vpc_HASH)
-          {
+          case vpc_HASH:
             return ResourceType::vpc;
-          }
-          else if (hashCode == vpn_connection_HASH)
-          {
+          case vpn_connection_HASH:
             return ResourceType::vpn_connection;
-          }
-          else if (hashCode == vpn_gateway_HASH)
-          {
+          case vpn_gateway_HASH:
             return ResourceType::vpn_gateway;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
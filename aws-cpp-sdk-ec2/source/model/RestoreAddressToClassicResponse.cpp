@@ -40,7 +40,7 @@ RestoreAddressToClassicResponse& RestoreAddressToClassicResponse::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RestoreAddressToClassicResponse")
+  if (rootNode.GetNameView() != "RestoreAddressToClassicResponse")
   {
     resultNode = rootNode.FirstChild("RestoreAddressToClassicResponse");
   }
@@ -50,12 +50,12 @@ RestoreAddressToClassicResponse& RestoreAddressToClassicResponse::operator =(con
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = StatusMapper::GetStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = StatusMapper::GetStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode publicIpNode = resultNode.FirstChild("publicIp");
     if(!publicIpNode.IsNull())
     {
-      m_publicIp = StringUtils::Trim(publicIpNode.GetText().c_str());
+      m_publicIp = publicIpNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/RevokeSecurityGroupEgressRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -37,7 +38,7 @@ RevokeSecurityGroupEgressRequest::RevokeSecurityGroupEgressRequest() :
 
 Aws::String RevokeSecurityGroupEgressRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=RevokeSecurityGroupEgress&";
   if(m_dryRunHasBeenSet)
   {
@@ -46,22 +47,22 @@ Aws::String RevokeSecurityGroupEgressRequest::SerializePayload() const
 
   if(m_groupIdHasBeenSet)
   {
-    ss << "GroupId=" << StringUtils::URLEncode(m_groupId.c_str()) << "&";
+    ss << "GroupId=" << StringUtils::URLEncoded(m_groupId) << "&";
   }
 
   if(m_sourceSecurityGroupNameHasBeenSet)
   {
-    ss << "SourceSecurityGroupName=" << StringUtils::URLEncode(m_sourceSecurityGroupName.c_str()) << "&";
+    ss << "SourceSecurityGroupName=" << StringUtils::URLEncoded(m_sourceSecurityGroupName) << "&";
   }
 
   if(m_sourceSecurityGroupOwnerIdHasBeenSet)
   {
-    ss << "SourceSecurityGroupOwnerId=" << StringUtils::URLEncode(m_sourceSecurityGroupOwnerId.c_str()) << "&";
+    ss << "SourceSecurityGroupOwnerId=" << StringUtils::URLEncoded(m_sourceSecurityGroupOwnerId) << "&";
   }
 
   if(m_ipProtocolHasBeenSet)
   {
-    ss << "IpProtocol=" << StringUtils::URLEncode(m_ipProtocol.c_str()) << "&";
+    ss << "IpProtocol=" << StringUtils::URLEncoded(m_ipProtocol) << "&";
   }
 
   if(m_fromPortHasBeenSet)
@@ -76,7 +77,7 @@ Aws::String RevokeSecurityGroupEgressRequest::SerializePayload() const
 
   if(m_cidrIpHasBeenSet)
   {
-    ss << "CidrIp=" << StringUtils::URLEncode(m_cidrIp.c_str()) << "&";
+    ss << "CidrIp=" << StringUtils::URLEncoded(m_cidrIp) << "&";
   }
 
   if(m_ipPermissionsHasBeenSet)
@@ -90,6 +91,6 @@ Aws::String RevokeSecurityGroupEgressRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
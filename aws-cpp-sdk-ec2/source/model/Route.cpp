@@ -67,61 +67,61 @@ Route& Route::operator =(const XmlNode& xmlNode)
     XmlNode destinationCidrBlockNode = resultNode.FirstChild("destinationCidrBlock");
     if(!destinationCidrBlockNode.IsNull())
     {
-      m_destinationCidrBlock = StringUtils::Trim(destinationCidrBlockNode.GetText().c_str());
+      m_destinationCidrBlock = destinationCidrBlockNode.GetTextView().Trim().ToString();
       m_destinationCidrBlockHasBeenSet = true;
     }
     XmlNode destinationPrefixListIdNode = resultNode.FirstChild("destinationPrefixListId");
     if(!destinationPrefixListIdNode.IsNull())
     {
-      m_destinationPrefixListId = StringUtils::Trim(destinationPrefixListIdNode.GetText().c_str());
+      m_destinationPrefixListId = destinationPrefixListIdNode.GetTextView().Trim().ToString();
       m_destinationPrefixListIdHasBeenSet = true;
     }
     XmlNode gatewayIdNode = resultNode.FirstChild("gatewayId");
     if(!gatewayIdNode.IsNull())
     {
-      m_gatewayId = StringUtils::Trim(gatewayIdNode.GetText().c_str());
+      m_gatewayId = gatewayIdNode.GetTextView().Trim().ToString();
       m_gatewayIdHasBeenSet = true;
     }
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode instanceOwnerIdNode = resultNode.FirstChild("instanceOwnerId");
     if(!instanceOwnerIdNode.IsNull())
     {
-      m_instanceOwnerId = StringUtils::Trim(instanceOwnerIdNode.GetText().c_str());
+      m_instanceOwnerId = instanceOwnerIdNode.GetTextView().Trim().ToString();
       m_instanceOwnerIdHasBeenSet = true;
     }
     XmlNode networkInterfaceIdNode = resultNode.FirstChild("networkInterfaceId");
     if(!networkInterfaceIdNode.IsNull())
     {
-      m_networkInterfaceId = StringUtils::Trim(networkInterfaceIdNode.GetText().c_str());
+      m_networkInterfaceId = networkInterfaceIdNode.GetTextView().Trim().ToString();
       m_networkInterfaceIdHasBeenSet = true;
     }
     XmlNode vpcPeeringConnectionIdNode = resultNode.FirstChild("vpcPeeringConnectionId");
     if(!vpcPeeringConnectionIdNode.IsNull())
     {
-      m_vpcPeeringConnectionId = StringUtils::Trim(vpcPeeringConnectionIdNode.GetText().c_str());
+      m_vpcPeeringConnectionId = vpcPeeringConnectionIdNode.GetTextView().Trim().ToString();
       m_vpcPeeringConnectionIdHasBeenSet = true;
     }
     XmlNode natGatewayIdNode = resultNode.FirstChild("natGatewayId");
     if(!natGatewayIdNode.IsNull())
     {
-      m_natGatewayId = StringUtils::Trim(natGatewayIdNode.GetText().c_str());
+      m_natGatewayId = natGatewayIdNode.GetTextView().Trim().ToString();
       m_natGatewayIdHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = RouteStateMapper::GetRouteStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = RouteStateMapper::GetRouteStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode originNode = resultNode.FirstChild("origin");
     if(!originNode.IsNull())
     {
-      m_origin = RouteOriginMapper::GetRouteOriginForName(StringUtils::Trim(originNode.GetText().c_str()).c_str());
+      m_origin = RouteOriginMapper::GetRouteOriginForName(originNode.GetTextView().Trim().ToString().c_str());
       m_originHasBeenSet = true;
     }
   }
@@ -133,42 +133,42 @@ void Route::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 {
   if(m_destinationCidrBlockHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DestinationCidrBlock=" << StringUtils::URLEncode(m_destinationCidrBlock.c_str()) << "&";
+      oStream << location << index << locationValue << ".DestinationCidrBlock=" << StringUtils::URLEncoded(m_destinationCidrBlock) << "&";
   }
 
   if(m_destinationPrefixListIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DestinationPrefixListId=" << StringUtils::URLEncode(m_destinationPrefixListId.c_str()) << "&";
+      oStream << location << index << locationValue << ".DestinationPrefixListId=" << StringUtils::URLEncoded(m_destinationPrefixListId) << "&";
   }
 
   if(m_gatewayIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".GatewayId=" << StringUtils::URLEncode(m_gatewayId.c_str()) << "&";
+      oStream << location << index << locationValue << ".GatewayId=" << StringUtils::URLEncoded(m_gatewayId) << "&";
   }
 
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_instanceOwnerIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceOwnerId=" << StringUtils::URLEncode(m_instanceOwnerId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceOwnerId=" << StringUtils::URLEncoded(m_instanceOwnerId) << "&";
   }
 
   if(m_networkInterfaceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
 
   if(m_vpcPeeringConnectionIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcPeeringConnectionId=" << StringUtils::URLEncode(m_vpcPeeringConnectionId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcPeeringConnectionId=" << StringUtils::URLEncoded(m_vpcPeeringConnectionId) << "&";
   }
 
   if(m_natGatewayIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NatGatewayId=" << StringUtils::URLEncode(m_natGatewayId.c_str()) << "&";
+      oStream << location << index << locationValue << ".NatGatewayId=" << StringUtils::URLEncoded(m_natGatewayId) << "&";
   }
 
   if(m_stateHasBeenSet)
@@ -187,35 +187,35 @@ void Route::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_destinationCidrBlockHasBeenSet)
   {
-      oStream << location << ".DestinationCidrBlock=" << StringUtils::URLEncode(m_destinationCidrBlock.c_str()) << "&";
+      oStream << location << ".DestinationCidrBlock=" << StringUtils::URLEncoded(m_destinationCidrBlock) << "&";
   }
   if(m_destinationPrefixListIdHasBeenSet)
   {
-      oStream << location << ".DestinationPrefixListId=" << StringUtils::URLEncode(m_destinationPrefixListId.c_str()) << "&";
+      oStream << location << ".DestinationPrefixListId=" << StringUtils::URLEncoded(m_destinationPrefixListId) << "&";
   }
   if(m_gatewayIdHasBeenSet)
   {
-      oStream << location << ".GatewayId=" << StringUtils::URLEncode(m_gatewayId.c_str()) << "&";
+      oStream << location << ".GatewayId=" << StringUtils::URLEncoded(m_gatewayId) << "&";
   }
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_instanceOwnerIdHasBeenSet)
   {
-      oStream << location << ".InstanceOwnerId=" << StringUtils::URLEncode(m_instanceOwnerId.c_str()) << "&";
+      oStream << location << ".InstanceOwnerId=" << StringUtils::URLEncoded(m_instanceOwnerId) << "&";
   }
   if(m_networkInterfaceIdHasBeenSet)
   {
-      oStream << location << ".NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+      oStream << location << ".NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
   if(m_vpcPeeringConnectionIdHasBeenSet)
   {
-      oStream << location << ".VpcPeeringConnectionId=" << StringUtils::URLEncode(m_vpcPeeringConnectionId.c_str()) << "&";
+      oStream << location << ".VpcPeeringConnectionId=" << StringUtils::URLEncoded(m_vpcPeeringConnectionId) << "&";
   }
   if(m_natGatewayIdHasBeenSet)
   {
-      oStream << location << ".NatGatewayId=" << StringUtils::URLEncode(m_natGatewayId.c_str()) << "&";
+      oStream << location << ".NatGatewayId=" << StringUtils::URLEncoded(m_natGatewayId) << "&";
   }
   if(m_stateHasBeenSet)
   {
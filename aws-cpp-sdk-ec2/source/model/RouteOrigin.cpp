@@ -29,26 +29,32 @@ namespace Aws
       namespace RouteOriginMapper
       {
 
-        static const int CreateRouteTable_HASH = HashingUtils::HashString("CreateRouteTable");
-        static const int CreateRoute_HASH = HashingUtils::HashString("CreateRoute");
-        static const int EnableVgwRoutePropagation_HASH = HashingUtils::HashString("EnableVgwRoutePropagation");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CreateRouteTable_HASH = 1884771649;
+        static const int CreateRoute_HASH = 1162151565;
+        static const int EnableVgwRoutePropagation_HASH = 1082794278;
 
 
         RouteOrigin GetRouteOriginForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CreateRouteTable_HASH)
+          switch (hashCode)
           {
+          case CreateRouteTable_HASH:
             return RouteOrigin::CreateRouteTable;
-          }
-          else if (hashCode == CreateRoute_HASH)
-          {
+          case CreateRoute_HASH:
             return RouteOrigin::CreateRoute;
-          }
-          else if (hashCode == EnableVgwRoutePropagation_HASH)
-          {
+          case EnableVgwRoutePropagation_HASH:
             return RouteOrigin::EnableVgwRoutePropagation;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
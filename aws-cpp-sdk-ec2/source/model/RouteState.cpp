@@ -29,21 +29,29 @@ namespace Aws
       namespace RouteStateMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int blackhole_HASH = HashingUtils::HashString("blackhole");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int active_HASH = -1422950650;
+        static const int blackhole_HASH = 1332899135;
 
 
         RouteState GetRouteStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
+          switch (hashCode)
           {
+          case active_HASH:
             return RouteState::active;
-          }
-          else if (hashCode == blackhole_HASH)
-          {
+          case blackhole_HASH:
             return RouteState::blackhole;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,13 +60,13 @@ RouteTable& RouteTable::operator =(const XmlNode& xmlNode)
     XmlNode routeTableIdNode = resultNode.FirstChild("routeTableId");
     if(!routeTableIdNode.IsNull())
     {
-      m_routeTableId = StringUtils::Trim(routeTableIdNode.GetText().c_str());
+      m_routeTableId = routeTableIdNode.GetTextView().Trim().ToString();
       m_routeTableIdHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("vpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode routesNode = resultNode.FirstChild("routeSet");
@@ -125,12 +126,12 @@ void RouteTable::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_routeTableIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RouteTableId=" << StringUtils::URLEncode(m_routeTableId.c_str()) << "&";
+      oStream << location << index << locationValue << ".RouteTableId=" << StringUtils::URLEncoded(m_routeTableId) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_routesHasBeenSet)
@@ -138,9 +139,9 @@ void RouteTable::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned routesIdx = 1;
       for(auto& item : m_routes)
       {
-        Aws::StringStream routesSs;
+        Aws::Utils::Stream::StringOutputStream routesSs;
         routesSs << location << index << locationValue << ".RouteSet." << routesIdx++;
-        item.OutputToStream(oStream, routesSs.str().c_str());
+        item.OutputToStream(oStream, routesSs.GetString().c_str());
       }
   }
 
@@ -149,9 +150,9 @@ void RouteTable::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned associationsIdx = 1;
       for(auto& item : m_associations)
       {
-        Aws::StringStream associationsSs;
+        Aws::Utils::Stream::StringOutputStream associationsSs;
         associationsSs << location << index << locationValue << ".AssociationSet." << associationsIdx++;
-        item.OutputToStream(oStream, associationsSs.str().c_str());
+        item.OutputToStream(oStream, associationsSs.GetString().c_str());
       }
   }
 
@@ -160,9 +161,9 @@ void RouteTable::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -171,9 +172,9 @@ void RouteTable::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned propagatingVgwsIdx = 1;
       for(auto& item : m_propagatingVgws)
       {
-        Aws::StringStream propagatingVgwsSs;
+        Aws::Utils::Stream::StringOutputStream propagatingVgwsSs;
         propagatingVgwsSs << location << index << locationValue << ".PropagatingVgwSet." << propagatingVgwsIdx++;
-        item.OutputToStream(oStream, propagatingVgwsSs.str().c_str());
+        item.OutputToStream(oStream, propagatingVgwsSs.GetString().c_str());
       }
   }
 
@@ -183,20 +184,20 @@ void RouteTable::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_routeTableIdHasBeenSet)
   {
-      oStream << location << ".RouteTableId=" << StringUtils::URLEncode(m_routeTableId.c_str()) << "&";
+      oStream << location << ".RouteTableId=" << StringUtils::URLEncoded(m_routeTableId) << "&";
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_routesHasBeenSet)
   {
       unsigned routesIdx = 1;
       for(auto& item : m_routes)
       {
-        Aws::StringStream routesSs;
+        Aws::Utils::Stream::StringOutputStream routesSs;
         routesSs << location <<  ".item." << routesIdx++;
-        item.OutputToStream(oStream, routesSs.str().c_str());
+        item.OutputToStream(oStream, routesSs.GetString().c_str());
       }
   }
   if(m_associationsHasBeenSet)
@@ -204,9 +205,9 @@ void RouteTable::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned associationsIdx = 1;
       for(auto& item : m_associations)
       {
-        Aws::StringStream associationsSs;
+        Aws::Utils::Stream::StringOutputStream associationsSs;
         associationsSs << location <<  ".item." << associationsIdx++;
-        item.OutputToStream(oStream, associationsSs.str().c_str());
+        item.OutputToStream(oStream, associationsSs.GetString().c_str());
       }
   }
   if(m_tagsHasBeenSet)
@@ -214,9 +215,9 @@ void RouteTable::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
   if(m_propagatingVgwsHasBeenSet)
@@ -224,9 +225,9 @@ void RouteTable::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned propagatingVgwsIdx = 1;
       for(auto& item : m_propagatingVgws)
       {
-        Aws::StringStream propagatingVgwsSs;
+        Aws::Utils::Stream::StringOutputStream propagatingVgwsSs;
         propagatingVgwsSs << location <<  ".item." << propagatingVgwsIdx++;
-        item.OutputToStream(oStream, propagatingVgwsSs.str().c_str());
+        item.OutputToStream(oStream, propagatingVgwsSs.GetString().c_str());
       }
   }
 }
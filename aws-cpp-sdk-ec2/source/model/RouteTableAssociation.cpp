@@ -57,25 +57,25 @@ RouteTableAssociation& RouteTableAssociation::operator =(const XmlNode& xmlNode)
     XmlNode routeTableAssociationIdNode = resultNode.FirstChild("routeTableAssociationId");
     if(!routeTableAssociationIdNode.IsNull())
     {
-      m_routeTableAssociationId = StringUtils::Trim(routeTableAssociationIdNode.GetText().c_str());
+      m_routeTableAssociationId = routeTableAssociationIdNode.GetTextView().Trim().ToString();
       m_routeTableAssociationIdHasBeenSet = true;
     }
     XmlNode routeTableIdNode = resultNode.FirstChild("routeTableId");
     if(!routeTableIdNode.IsNull())
     {
-      m_routeTableId = StringUtils::Trim(routeTableIdNode.GetText().c_str());
+      m_routeTableId = routeTableIdNode.GetTextView().Trim().ToString();
       m_routeTableIdHasBeenSet = true;
     }
     XmlNode subnetIdNode = resultNode.FirstChild("subnetId");
     if(!subnetIdNode.IsNull())
     {
-      m_subnetId = StringUtils::Trim(subnetIdNode.GetText().c_str());
+      m_subnetId = subnetIdNode.GetTextView().Trim().ToString();
       m_subnetIdHasBeenSet = true;
     }
     XmlNode mainNode = resultNode.FirstChild("main");
     if(!mainNode.IsNull())
     {
-      m_main = StringUtils::ConvertToBool(StringUtils::Trim(mainNode.GetText().c_str()).c_str());
+      m_main = StringUtils::ConvertToBool(mainNode.GetTextView().Trim().ToString().c_str());
       m_mainHasBeenSet = true;
     }
   }
@@ -87,17 +87,17 @@ void RouteTableAssociation::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_routeTableAssociationIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RouteTableAssociationId=" << StringUtils::URLEncode(m_routeTableAssociationId.c_str()) << "&";
+      oStream << location << index << locationValue << ".RouteTableAssociationId=" << StringUtils::URLEncoded(m_routeTableAssociationId) << "&";
   }
 
   if(m_routeTableIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RouteTableId=" << StringUtils::URLEncode(m_routeTableId.c_str()) << "&";
+      oStream << location << index << locationValue << ".RouteTableId=" << StringUtils::URLEncoded(m_routeTableId) << "&";
   }
 
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
   if(m_mainHasBeenSet)
@@ -111,15 +111,15 @@ void RouteTableAssociation::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_routeTableAssociationIdHasBeenSet)
   {
-      oStream << location << ".RouteTableAssociationId=" << StringUtils::URLEncode(m_routeTableAssociationId.c_str()) << "&";
+      oStream << location << ".RouteTableAssociationId=" << StringUtils::URLEncoded(m_routeTableAssociationId) << "&";
   }
   if(m_routeTableIdHasBeenSet)
   {
-      oStream << location << ".RouteTableId=" << StringUtils::URLEncode(m_routeTableId.c_str()) << "&";
+      oStream << location << ".RouteTableId=" << StringUtils::URLEncoded(m_routeTableId) << "&";
   }
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
   if(m_mainHasBeenSet)
   {
@@ -29,21 +29,29 @@ namespace Aws
       namespace RuleActionMapper
       {
 
-        static const int allow_HASH = HashingUtils::HashString("allow");
-        static const int deny_HASH = HashingUtils::HashString("deny");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int allow_HASH = 92906313;
+        static const int deny_HASH = 3079692;
 
 
         RuleAction GetRuleActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == allow_HASH)
+          switch (hashCode)
           {
+          case allow_HASH:
             return RuleAction::allow;
-          }
-          else if (hashCode == deny_HASH)
-          {
+          case deny_HASH:
             return RuleAction::deny;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
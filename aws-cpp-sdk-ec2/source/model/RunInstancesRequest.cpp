@@ -15,6 +15,7 @@
 #include <aws/ec2/model/RunInstancesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -53,7 +54,7 @@ RunInstancesRequest::RunInstancesRequest() :
 
 Aws::String RunInstancesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=RunInstances&";
   if(m_dryRunHasBeenSet)
   {
@@ -62,7 +63,7 @@ Aws::String RunInstancesRequest::SerializePayload() const
 
   if(m_imageIdHasBeenSet)
   {
-    ss << "ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+    ss << "ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
 
   if(m_minCountHasBeenSet)
@@ -77,7 +78,7 @@ Aws::String RunInstancesRequest::SerializePayload() const
 
   if(m_keyNameHasBeenSet)
   {
-    ss << "KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+    ss << "KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
 
   if(m_securityGroupsHasBeenSet)
@@ -86,7 +87,7 @@ Aws::String RunInstancesRequest::SerializePayload() const
     for(auto& item : m_securityGroups)
     {
       ss << "SecurityGroup." << securityGroupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       securityGroupsCount++;
     }
   }
@@ -97,14 +98,14 @@ Aws::String RunInstancesRequest::SerializePayload() const
     for(auto& item : m_securityGroupIds)
     {
       ss << "SecurityGroupId." << securityGroupIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       securityGroupIdsCount++;
     }
   }
 
   if(m_userDataHasBeenSet)
   {
-    ss << "UserData=" << StringUtils::URLEncode(m_userData.c_str()) << "&";
+    ss << "UserData=" << StringUtils::URLEncoded(m_userData) << "&";
   }
 
   if(m_instanceTypeHasBeenSet)
@@ -119,12 +120,12 @@ Aws::String RunInstancesRequest::SerializePayload() const
 
   if(m_kernelIdHasBeenSet)
   {
-    ss << "KernelId=" << StringUtils::URLEncode(m_kernelId.c_str()) << "&";
+    ss << "KernelId=" << StringUtils::URLEncoded(m_kernelId) << "&";
   }
 
   if(m_ramdiskIdHasBeenSet)
   {
-    ss << "RamdiskId=" << StringUtils::URLEncode(m_ramdiskId.c_str()) << "&";
+    ss << "RamdiskId=" << StringUtils::URLEncoded(m_ramdiskId) << "&";
   }
 
   if(m_blockDeviceMappingsHasBeenSet)
@@ -144,7 +145,7 @@ Aws::String RunInstancesRequest::SerializePayload() const
 
   if(m_subnetIdHasBeenSet)
   {
-    ss << "SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+    ss << "SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
   if(m_disableApiTerminationHasBeenSet)
@@ -159,17 +160,17 @@ Aws::String RunInstancesRequest::SerializePayload() const
 
   if(m_privateIpAddressHasBeenSet)
   {
-    ss << "PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+    ss << "PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
 
   if(m_clientTokenHasBeenSet)
   {
-    ss << "ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+    ss << "ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   if(m_additionalInfoHasBeenSet)
   {
-    ss << "AdditionalInfo=" << StringUtils::URLEncode(m_additionalInfo.c_str()) << "&";
+    ss << "AdditionalInfo=" << StringUtils::URLEncoded(m_additionalInfo) << "&";
   }
 
   if(m_networkInterfacesHasBeenSet)
@@ -193,6 +194,6 @@ Aws::String RunInstancesRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
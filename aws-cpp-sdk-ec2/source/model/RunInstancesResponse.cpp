@@ -40,7 +40,7 @@ RunInstancesResponse& RunInstancesResponse::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RunInstancesResponse")
+  if (rootNode.GetNameView() != "RunInstancesResponse")
   {
     resultNode = rootNode.FirstChild("RunInstancesResponse");
   }
@@ -50,17 +50,17 @@ RunInstancesResponse& RunInstancesResponse::operator =(const AmazonWebServiceRes
     XmlNode reservationIdNode = resultNode.FirstChild("reservationId");
     if(!reservationIdNode.IsNull())
     {
-      m_reservationId = StringUtils::Trim(reservationIdNode.GetText().c_str());
+      m_reservationId = reservationIdNode.GetTextView().Trim().ToString();
     }
     XmlNode ownerIdNode = resultNode.FirstChild("ownerId");
     if(!ownerIdNode.IsNull())
     {
-      m_ownerId = StringUtils::Trim(ownerIdNode.GetText().c_str());
+      m_ownerId = ownerIdNode.GetTextView().Trim().ToString();
     }
     XmlNode requesterIdNode = resultNode.FirstChild("requesterId");
     if(!requesterIdNode.IsNull())
     {
-      m_requesterId = StringUtils::Trim(requesterIdNode.GetText().c_str());
+      m_requesterId = requesterIdNode.GetTextView().Trim().ToString();
     }
     XmlNode groupsNode = resultNode.FirstChild("groupSet");
     if(!groupsNode.IsNull())
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/RunScheduledInstancesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -32,7 +33,7 @@ RunScheduledInstancesRequest::RunScheduledInstancesRequest() :
 
 Aws::String RunScheduledInstancesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=RunScheduledInstances&";
   if(m_dryRunHasBeenSet)
   {
@@ -41,7 +42,7 @@ Aws::String RunScheduledInstancesRequest::SerializePayload() const
 
   if(m_clientTokenHasBeenSet)
   {
-    ss << "ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+    ss << "ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   if(m_instanceCountHasBeenSet)
@@ -51,7 +52,7 @@ Aws::String RunScheduledInstancesRequest::SerializePayload() const
 
   if(m_scheduledInstanceIdHasBeenSet)
   {
-    ss << "ScheduledInstanceId=" << StringUtils::URLEncode(m_scheduledInstanceId.c_str()) << "&";
+    ss << "ScheduledInstanceId=" << StringUtils::URLEncoded(m_scheduledInstanceId) << "&";
   }
 
   if(m_launchSpecificationHasBeenSet)
@@ -60,6 +61,6 @@ Aws::String RunScheduledInstancesRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
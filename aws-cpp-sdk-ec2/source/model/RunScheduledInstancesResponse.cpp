@@ -40,7 +40,7 @@ RunScheduledInstancesResponse& RunScheduledInstancesResponse::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RunScheduledInstancesResponse")
+  if (rootNode.GetNameView() != "RunScheduledInstancesResponse")
   {
     resultNode = rootNode.FirstChild("RunScheduledInstancesResponse");
   }
@@ -53,7 +53,7 @@ RunScheduledInstancesResponse& RunScheduledInstancesResponse::operator =(const A
       XmlNode instanceIdSetMember = instanceIdSetNode.FirstChild("item");
       while(!instanceIdSetMember.IsNull())
       {
-        m_instanceIdSet.push_back(StringUtils::Trim(instanceIdSetMember.GetText().c_str()));
+        m_instanceIdSet.push_back(instanceIdSetMember.GetTextView().Trim().ToString());
         instanceIdSetMember = instanceIdSetMember.NextNode("item");
       }
 
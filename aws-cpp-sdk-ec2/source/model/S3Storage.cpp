@@ -58,31 +58,31 @@ S3Storage& S3Storage::operator =(const XmlNode& xmlNode)
     XmlNode bucketNode = resultNode.FirstChild("bucket");
     if(!bucketNode.IsNull())
     {
-      m_bucket = StringUtils::Trim(bucketNode.GetText().c_str());
+      m_bucket = bucketNode.GetTextView().Trim().ToString();
       m_bucketHasBeenSet = true;
     }
     XmlNode prefixNode = resultNode.FirstChild("prefix");
     if(!prefixNode.IsNull())
     {
-      m_prefix = StringUtils::Trim(prefixNode.GetText().c_str());
+      m_prefix = prefixNode.GetTextView().Trim().ToString();
       m_prefixHasBeenSet = true;
     }
     XmlNode aWSAccessKeyIdNode = resultNode.FirstChild("AWSAccessKeyId");
     if(!aWSAccessKeyIdNode.IsNull())
     {
-      m_aWSAccessKeyId = StringUtils::Trim(aWSAccessKeyIdNode.GetText().c_str());
+      m_aWSAccessKeyId = aWSAccessKeyIdNode.GetTextView().Trim().ToString();
       m_aWSAccessKeyIdHasBeenSet = true;
     }
     XmlNode uploadPolicyNode = resultNode.FirstChild("uploadPolicy");
     if(!uploadPolicyNode.IsNull())
     {
-      m_uploadPolicy = HashingUtils::Base64Decode(StringUtils::Trim(uploadPolicyNode.GetText().c_str()));
+      m_uploadPolicy = HashingUtils::Base64Decode(uploadPolicyNode.GetTextView().Trim().ToString());
       m_uploadPolicyHasBeenSet = true;
     }
     XmlNode uploadPolicySignatureNode = resultNode.FirstChild("uploadPolicySignature");
     if(!uploadPolicySignatureNode.IsNull())
     {
-      m_uploadPolicySignature = StringUtils::Trim(uploadPolicySignatureNode.GetText().c_str());
+      m_uploadPolicySignature = uploadPolicySignatureNode.GetTextView().Trim().ToString();
       m_uploadPolicySignatureHasBeenSet = true;
     }
   }
@@ -94,27 +94,27 @@ void S3Storage::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 {
   if(m_bucketHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Bucket=" << StringUtils::URLEncode(m_bucket.c_str()) << "&";
+      oStream << location << index << locationValue << ".Bucket=" << StringUtils::URLEncoded(m_bucket) << "&";
   }
 
   if(m_prefixHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Prefix=" << StringUtils::URLEncode(m_prefix.c_str()) << "&";
+      oStream << location << index << locationValue << ".Prefix=" << StringUtils::URLEncoded(m_prefix) << "&";
   }
 
   if(m_aWSAccessKeyIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AWSAccessKeyId=" << StringUtils::URLEncode(m_aWSAccessKeyId.c_str()) << "&";
+      oStream << location << index << locationValue << ".AWSAccessKeyId=" << StringUtils::URLEncoded(m_aWSAccessKeyId) << "&";
   }
 
   if(m_uploadPolicyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UploadPolicy=" << StringUtils::URLEncode(HashingUtils::Base64Encode(m_uploadPolicy).c_str()) << "&";
+      oStream << location << index << locationValue << ".UploadPolicy=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(m_uploadPolicy)) << "&";
   }
 
   if(m_uploadPolicySignatureHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UploadPolicySignature=" << StringUtils::URLEncode(m_uploadPolicySignature.c_str()) << "&";
+      oStream << location << index << locationValue << ".UploadPolicySignature=" << StringUtils::URLEncoded(m_uploadPolicySignature) << "&";
   }
 
 }
@@ -123,23 +123,23 @@ void S3Storage::OutputToStream(Aws::OStream& oStream, const char* location) cons
 {
   if(m_bucketHasBeenSet)
   {
-      oStream << location << ".Bucket=" << StringUtils::URLEncode(m_bucket.c_str()) << "&";
+      oStream << location << ".Bucket=" << StringUtils::URLEncoded(m_bucket) << "&";
   }
   if(m_prefixHasBeenSet)
   {
-      oStream << location << ".Prefix=" << StringUtils::URLEncode(m_prefix.c_str()) << "&";
+      oStream << location << ".Prefix=" << StringUtils::URLEncoded(m_prefix) << "&";
   }
   if(m_aWSAccessKeyIdHasBeenSet)
   {
-      oStream << location << ".AWSAccessKeyId=" << StringUtils::URLEncode(m_aWSAccessKeyId.c_str()) << "&";
+      oStream << location << ".AWSAccessKeyId=" << StringUtils::URLEncoded(m_aWSAccessKeyId) << "&";
   }
   if(m_uploadPolicyHasBeenSet)
   {
-      oStream << location << ".UploadPolicy=" << StringUtils::URLEncode(HashingUtils::Base64Encode(m_uploadPolicy).c_str()) << "&";
+      oStream << location << ".UploadPolicy=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(m_uploadPolicy)) << "&";
   }
   if(m_uploadPolicySignatureHasBeenSet)
   {
-      oStream << location << ".UploadPolicySignature=" << StringUtils::URLEncode(m_uploadPolicySignature.c_str()) << "&";
+      oStream << location << ".UploadPolicySignature=" << StringUtils::URLEncoded(m_uploadPolicySignature) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -83,37 +84,37 @@ ScheduledInstance& ScheduledInstance::operator =(const XmlNode& xmlNode)
     XmlNode scheduledInstanceIdNode = resultNode.FirstChild("scheduledInstanceId");
     if(!scheduledInstanceIdNode.IsNull())
     {
-      m_scheduledInstanceId = StringUtils::Trim(scheduledInstanceIdNode.GetText().c_str());
+      m_scheduledInstanceId = scheduledInstanceIdNode.GetTextView().Trim().ToString();
       m_scheduledInstanceIdHasBeenSet = true;
     }
     XmlNode instanceTypeNode = resultNode.FirstChild("instanceType");
     if(!instanceTypeNode.IsNull())
     {
-      m_instanceType = StringUtils::Trim(instanceTypeNode.GetText().c_str());
+      m_instanceType = instanceTypeNode.GetTextView().Trim().ToString();
       m_instanceTypeHasBeenSet = true;
     }
     XmlNode platformNode = resultNode.FirstChild("platform");
     if(!platformNode.IsNull())
     {
-      m_platform = StringUtils::Trim(platformNode.GetText().c_str());
+      m_platform = platformNode.GetTextView().Trim().ToString();
       m_platformHasBeenSet = true;
     }
     XmlNode networkPlatformNode = resultNode.FirstChild("networkPlatform");
     if(!networkPlatformNode.IsNull())
     {
-      m_networkPlatform = StringUtils::Trim(networkPlatformNode.GetText().c_str());
+      m_networkPlatform = networkPlatformNode.GetTextView().Trim().ToString();
       m_networkPlatformHasBeenSet = true;
     }
     XmlNode availabilityZoneNode = resultNode.FirstChild("availabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode slotDurationInHoursNode = resultNode.FirstChild("slotDurationInHours");
     if(!slotDurationInHoursNode.IsNull())
     {
-      m_slotDurationInHours = StringUtils::ConvertToInt32(StringUtils::Trim(slotDurationInHoursNode.GetText().c_str()).c_str());
+      m_slotDurationInHours = StringUtils::ConvertToInt32(slotDurationInHoursNode.GetTextView().Trim().ToString().c_str());
       m_slotDurationInHoursHasBeenSet = true;
     }
     XmlNode recurrenceNode = resultNode.FirstChild("recurrence");
@@ -125,49 +126,49 @@ ScheduledInstance& ScheduledInstance::operator =(const XmlNode& xmlNode)
     XmlNode previousSlotEndTimeNode = resultNode.FirstChild("previousSlotEndTime");
     if(!previousSlotEndTimeNode.IsNull())
     {
-      m_previousSlotEndTime = DateTime(StringUtils::Trim(previousSlotEndTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_previousSlotEndTime = DateTime(previousSlotEndTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_previousSlotEndTimeHasBeenSet = true;
     }
     XmlNode nextSlotStartTimeNode = resultNode.FirstChild("nextSlotStartTime");
     if(!nextSlotStartTimeNode.IsNull())
     {
-      m_nextSlotStartTime = DateTime(StringUtils::Trim(nextSlotStartTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_nextSlotStartTime = DateTime(nextSlotStartTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_nextSlotStartTimeHasBeenSet = true;
     }
     XmlNode hourlyPriceNode = resultNode.FirstChild("hourlyPrice");
     if(!hourlyPriceNode.IsNull())
     {
-      m_hourlyPrice = StringUtils::Trim(hourlyPriceNode.GetText().c_str());
+      m_hourlyPrice = hourlyPriceNode.GetTextView().Trim().ToString();
       m_hourlyPriceHasBeenSet = true;
     }
     XmlNode totalScheduledInstanceHoursNode = resultNode.FirstChild("totalScheduledInstanceHours");
     if(!totalScheduledInstanceHoursNode.IsNull())
     {
-      m_totalScheduledInstanceHours = StringUtils::ConvertToInt32(StringUtils::Trim(totalScheduledInstanceHoursNode.GetText().c_str()).c_str());
+      m_totalScheduledInstanceHours = StringUtils::ConvertToInt32(totalScheduledInstanceHoursNode.GetTextView().Trim().ToString().c_str());
       m_totalScheduledInstanceHoursHasBeenSet = true;
     }
     XmlNode instanceCountNode = resultNode.FirstChild("instanceCount");
     if(!instanceCountNode.IsNull())
     {
-      m_instanceCount = StringUtils::ConvertToInt32(StringUtils::Trim(instanceCountNode.GetText().c_str()).c_str());
+      m_instanceCount = StringUtils::ConvertToInt32(instanceCountNode.GetTextView().Trim().ToString().c_str());
       m_instanceCountHasBeenSet = true;
     }
     XmlNode termStartDateNode = resultNode.FirstChild("termStartDate");
     if(!termStartDateNode.IsNull())
     {
-      m_termStartDate = DateTime(StringUtils::Trim(termStartDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_termStartDate = DateTime(termStartDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_termStartDateHasBeenSet = true;
     }
     XmlNode termEndDateNode = resultNode.FirstChild("termEndDate");
     if(!termEndDateNode.IsNull())
     {
-      m_termEndDate = DateTime(StringUtils::Trim(termEndDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_termEndDate = DateTime(termEndDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_termEndDateHasBeenSet = true;
     }
     XmlNode createDateNode = resultNode.FirstChild("createDate");
     if(!createDateNode.IsNull())
     {
-      m_createDate = DateTime(StringUtils::Trim(createDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createDate = DateTime(createDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createDateHasBeenSet = true;
     }
   }
@@ -179,27 +180,27 @@ void ScheduledInstance::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_scheduledInstanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ScheduledInstanceId=" << StringUtils::URLEncode(m_scheduledInstanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ScheduledInstanceId=" << StringUtils::URLEncoded(m_scheduledInstanceId) << "&";
   }
 
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
 
   if(m_platformHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Platform=" << StringUtils::URLEncode(m_platform.c_str()) << "&";
+      oStream << location << index << locationValue << ".Platform=" << StringUtils::URLEncoded(m_platform) << "&";
   }
 
   if(m_networkPlatformHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NetworkPlatform=" << StringUtils::URLEncode(m_networkPlatform.c_str()) << "&";
+      oStream << location << index << locationValue << ".NetworkPlatform=" << StringUtils::URLEncoded(m_networkPlatform) << "&";
   }
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_slotDurationInHoursHasBeenSet)
@@ -209,24 +210,24 @@ void ScheduledInstance::OutputToStream(Aws::OStream& oStream, const char* locati
 
   if(m_recurrenceHasBeenSet)
   {
-      Aws::StringStream recurrenceLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream recurrenceLocationAndMemberSs;
       recurrenceLocationAndMemberSs << location << index << locationValue << ".Recurrence";
-      m_recurrence.OutputToStream(oStream, recurrenceLocationAndMemberSs.str().c_str());
+      m_recurrence.OutputToStream(oStream, recurrenceLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_previousSlotEndTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PreviousSlotEndTime=" << StringUtils::URLEncode(m_previousSlotEndTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".PreviousSlotEndTime=" << StringUtils::URLEncoded(m_previousSlotEndTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_nextSlotStartTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NextSlotStartTime=" << StringUtils::URLEncode(m_nextSlotStartTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".NextSlotStartTime=" << StringUtils::URLEncoded(m_nextSlotStartTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_hourlyPriceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HourlyPrice=" << StringUtils::URLEncode(m_hourlyPrice.c_str()) << "&";
+      oStream << location << index << locationValue << ".HourlyPrice=" << StringUtils::URLEncoded(m_hourlyPrice) << "&";
   }
 
   if(m_totalScheduledInstanceHoursHasBeenSet)
@@ -241,17 +242,17 @@ void ScheduledInstance::OutputToStream(Aws::OStream& oStream, const char* locati
 
   if(m_termStartDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TermStartDate=" << StringUtils::URLEncode(m_termStartDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".TermStartDate=" << StringUtils::URLEncoded(m_termStartDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_termEndDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TermEndDate=" << StringUtils::URLEncode(m_termEndDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".TermEndDate=" << StringUtils::URLEncoded(m_termEndDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_createDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -260,23 +261,23 @@ void ScheduledInstance::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_scheduledInstanceIdHasBeenSet)
   {
-      oStream << location << ".ScheduledInstanceId=" << StringUtils::URLEncode(m_scheduledInstanceId.c_str()) << "&";
+      oStream << location << ".ScheduledInstanceId=" << StringUtils::URLEncoded(m_scheduledInstanceId) << "&";
   }
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
   if(m_platformHasBeenSet)
   {
-      oStream << location << ".Platform=" << StringUtils::URLEncode(m_platform.c_str()) << "&";
+      oStream << location << ".Platform=" << StringUtils::URLEncoded(m_platform) << "&";
   }
   if(m_networkPlatformHasBeenSet)
   {
-      oStream << location << ".NetworkPlatform=" << StringUtils::URLEncode(m_networkPlatform.c_str()) << "&";
+      oStream << location << ".NetworkPlatform=" << StringUtils::URLEncoded(m_networkPlatform) << "&";
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_slotDurationInHoursHasBeenSet)
   {
@@ -290,15 +291,15 @@ void ScheduledInstance::OutputToStream(Aws::OStream& oStream, const char* locati
   }
   if(m_previousSlotEndTimeHasBeenSet)
   {
-      oStream << location << ".PreviousSlotEndTime=" << StringUtils::URLEncode(m_previousSlotEndTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".PreviousSlotEndTime=" << StringUtils::URLEncoded(m_previousSlotEndTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_nextSlotStartTimeHasBeenSet)
   {
-      oStream << location << ".NextSlotStartTime=" << StringUtils::URLEncode(m_nextSlotStartTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".NextSlotStartTime=" << StringUtils::URLEncoded(m_nextSlotStartTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_hourlyPriceHasBeenSet)
   {
-      oStream << location << ".HourlyPrice=" << StringUtils::URLEncode(m_hourlyPrice.c_str()) << "&";
+      oStream << location << ".HourlyPrice=" << StringUtils::URLEncoded(m_hourlyPrice) << "&";
   }
   if(m_totalScheduledInstanceHoursHasBeenSet)
   {
@@ -310,15 +311,15 @@ void ScheduledInstance::OutputToStream(Aws::OStream& oStream, const char* locati
   }
   if(m_termStartDateHasBeenSet)
   {
-      oStream << location << ".TermStartDate=" << StringUtils::URLEncode(m_termStartDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".TermStartDate=" << StringUtils::URLEncoded(m_termStartDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_termEndDateHasBeenSet)
   {
-      oStream << location << ".TermEndDate=" << StringUtils::URLEncode(m_termEndDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".TermEndDate=" << StringUtils::URLEncoded(m_termEndDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_createDateHasBeenSet)
   {
-      oStream << location << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -83,37 +84,37 @@ ScheduledInstanceAvailability& ScheduledInstanceAvailability::operator =(const X
     XmlNode instanceTypeNode = resultNode.FirstChild("instanceType");
     if(!instanceTypeNode.IsNull())
     {
-      m_instanceType = StringUtils::Trim(instanceTypeNode.GetText().c_str());
+      m_instanceType = instanceTypeNode.GetTextView().Trim().ToString();
       m_instanceTypeHasBeenSet = true;
     }
     XmlNode platformNode = resultNode.FirstChild("platform");
     if(!platformNode.IsNull())
     {
-      m_platform = StringUtils::Trim(platformNode.GetText().c_str());
+      m_platform = platformNode.GetTextView().Trim().ToString();
       m_platformHasBeenSet = true;
     }
     XmlNode networkPlatformNode = resultNode.FirstChild("networkPlatform");
     if(!networkPlatformNode.IsNull())
     {
-      m_networkPlatform = StringUtils::Trim(networkPlatformNode.GetText().c_str());
+      m_networkPlatform = networkPlatformNode.GetTextView().Trim().ToString();
       m_networkPlatformHasBeenSet = true;
     }
     XmlNode availabilityZoneNode = resultNode.FirstChild("availabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode purchaseTokenNode = resultNode.FirstChild("purchaseToken");
     if(!purchaseTokenNode.IsNull())
     {
-      m_purchaseToken = StringUtils::Trim(purchaseTokenNode.GetText().c_str());
+      m_purchaseToken = purchaseTokenNode.GetTextView().Trim().ToString();
       m_purchaseTokenHasBeenSet = true;
     }
     XmlNode slotDurationInHoursNode = resultNode.FirstChild("slotDurationInHours");
     if(!slotDurationInHoursNode.IsNull())
     {
-      m_slotDurationInHours = StringUtils::ConvertToInt32(StringUtils::Trim(slotDurationInHoursNode.GetText().c_str()).c_str());
+      m_slotDurationInHours = StringUtils::ConvertToInt32(slotDurationInHoursNode.GetTextView().Trim().ToString().c_str());
       m_slotDurationInHoursHasBeenSet = true;
     }
     XmlNode recurrenceNode = resultNode.FirstChild("recurrence");
@@ -125,37 +126,37 @@ ScheduledInstanceAvailability& ScheduledInstanceAvailability::operator =(const X
     XmlNode firstSlotStartTimeNode = resultNode.FirstChild("firstSlotStartTime");
     if(!firstSlotStartTimeNode.IsNull())
     {
-      m_firstSlotStartTime = DateTime(StringUtils::Trim(firstSlotStartTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_firstSlotStartTime = DateTime(firstSlotStartTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_firstSlotStartTimeHasBeenSet = true;
     }
     XmlNode hourlyPriceNode = resultNode.FirstChild("hourlyPrice");
     if(!hourlyPriceNode.IsNull())
     {
-      m_hourlyPrice = StringUtils::Trim(hourlyPriceNode.GetText().c_str());
+      m_hourlyPrice = hourlyPriceNode.GetTextView().Trim().ToString();
       m_hourlyPriceHasBeenSet = true;
     }
     XmlNode totalScheduledInstanceHoursNode = resultNode.FirstChild("totalScheduledInstanceHours");
     if(!totalScheduledInstanceHoursNode.IsNull())
     {
-      m_totalScheduledInstanceHours = StringUtils::ConvertToInt32(StringUtils::Trim(totalScheduledInstanceHoursNode.GetText().c_str()).c_str());
+      m_totalScheduledInstanceHours = StringUtils::ConvertToInt32(totalScheduledInstanceHoursNode.GetTextView().Trim().ToString().c_str());
       m_totalScheduledInstanceHoursHasBeenSet = true;
     }
     XmlNode availableInstanceCountNode = resultNode.FirstChild("availableInstanceCount");
     if(!availableInstanceCountNode.IsNull())
     {
-      m_availableInstanceCount = StringUtils::ConvertToInt32(StringUtils::Trim(availableInstanceCountNode.GetText().c_str()).c_str());
+      m_availableInstanceCount = StringUtils::ConvertToInt32(availableInstanceCountNode.GetTextView().Trim().ToString().c_str());
       m_availableInstanceCountHasBeenSet = true;
     }
     XmlNode minTermDurationInDaysNode = resultNode.FirstChild("minTermDurationInDays");
     if(!minTermDurationInDaysNode.IsNull())
     {
-      m_minTermDurationInDays = StringUtils::ConvertToInt32(StringUtils::Trim(minTermDurationInDaysNode.GetText().c_str()).c_str());
+      m_minTermDurationInDays = StringUtils::ConvertToInt32(minTermDurationInDaysNode.GetTextView().Trim().ToString().c_str());
       m_minTermDurationInDaysHasBeenSet = true;
     }
     XmlNode maxTermDurationInDaysNode = resultNode.FirstChild("maxTermDurationInDays");
     if(!maxTermDurationInDaysNode.IsNull())
     {
-      m_maxTermDurationInDays = StringUtils::ConvertToInt32(StringUtils::Trim(maxTermDurationInDaysNode.GetText().c_str()).c_str());
+      m_maxTermDurationInDays = StringUtils::ConvertToInt32(maxTermDurationInDaysNode.GetTextView().Trim().ToString().c_str());
       m_maxTermDurationInDaysHasBeenSet = true;
     }
   }
@@ -167,27 +168,27 @@ void ScheduledInstanceAvailability::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
 
   if(m_platformHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Platform=" << StringUtils::URLEncode(m_platform.c_str()) << "&";
+      oStream << location << index << locationValue << ".Platform=" << StringUtils::URLEncoded(m_platform) << "&";
   }
 
   if(m_networkPlatformHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NetworkPlatform=" << StringUtils::URLEncode(m_networkPlatform.c_str()) << "&";
+      oStream << location << index << locationValue << ".NetworkPlatform=" << StringUtils::URLEncoded(m_networkPlatform) << "&";
   }
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_purchaseTokenHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PurchaseToken=" << StringUtils::URLEncode(m_purchaseToken.c_str()) << "&";
+      oStream << location << index << locationValue << ".PurchaseToken=" << StringUtils::URLEncoded(m_purchaseToken) << "&";
   }
 
   if(m_slotDurationInHoursHasBeenSet)
@@ -197,19 +198,19 @@ void ScheduledInstanceAvailability::OutputToStream(Aws::OStream& oStream, const
 
   if(m_recurrenceHasBeenSet)
   {
-      Aws::StringStream recurrenceLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream recurrenceLocationAndMemberSs;
       recurrenceLocationAndMemberSs << location << index << locationValue << ".Recurrence";
-      m_recurrence.OutputToStream(oStream, recurrenceLocationAndMemberSs.str().c_str());
+      m_recurrence.OutputToStream(oStream, recurrenceLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_firstSlotStartTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".FirstSlotStartTime=" << StringUtils::URLEncode(m_firstSlotStartTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".FirstSlotStartTime=" << StringUtils::URLEncoded(m_firstSlotStartTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_hourlyPriceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HourlyPrice=" << StringUtils::URLEncode(m_hourlyPrice.c_str()) << "&";
+      oStream << location << index << locationValue << ".HourlyPrice=" << StringUtils::URLEncoded(m_hourlyPrice) << "&";
   }
 
   if(m_totalScheduledInstanceHoursHasBeenSet)
@@ -238,23 +239,23 @@ void ScheduledInstanceAvailability::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
   if(m_platformHasBeenSet)
   {
-      oStream << location << ".Platform=" << StringUtils::URLEncode(m_platform.c_str()) << "&";
+      oStream << location << ".Platform=" << StringUtils::URLEncoded(m_platform) << "&";
   }
   if(m_networkPlatformHasBeenSet)
   {
-      oStream << location << ".NetworkPlatform=" << StringUtils::URLEncode(m_networkPlatform.c_str()) << "&";
+      oStream << location << ".NetworkPlatform=" << StringUtils::URLEncoded(m_networkPlatform) << "&";
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_purchaseTokenHasBeenSet)
   {
-      oStream << location << ".PurchaseToken=" << StringUtils::URLEncode(m_purchaseToken.c_str()) << "&";
+      oStream << location << ".PurchaseToken=" << StringUtils::URLEncoded(m_purchaseToken) << "&";
   }
   if(m_slotDurationInHoursHasBeenSet)
   {
@@ -268,11 +269,11 @@ void ScheduledInstanceAvailability::OutputToStream(Aws::OStream& oStream, const
   }
   if(m_firstSlotStartTimeHasBeenSet)
   {
-      oStream << location << ".FirstSlotStartTime=" << StringUtils::URLEncode(m_firstSlotStartTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".FirstSlotStartTime=" << StringUtils::URLEncoded(m_firstSlotStartTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_hourlyPriceHasBeenSet)
   {
-      oStream << location << ".HourlyPrice=" << StringUtils::URLEncode(m_hourlyPrice.c_str()) << "&";
+      oStream << location << ".HourlyPrice=" << StringUtils::URLEncoded(m_hourlyPrice) << "&";
   }
   if(m_totalScheduledInstanceHoursHasBeenSet)
   {
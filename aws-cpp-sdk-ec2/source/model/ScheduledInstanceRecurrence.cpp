@@ -61,13 +61,13 @@ ScheduledInstanceRecurrence& ScheduledInstanceRecurrence::operator =(const XmlNo
     XmlNode frequencyNode = resultNode.FirstChild("frequency");
     if(!frequencyNode.IsNull())
     {
-      m_frequency = StringUtils::Trim(frequencyNode.GetText().c_str());
+      m_frequency = frequencyNode.GetTextView().Trim().ToString();
       m_frequencyHasBeenSet = true;
     }
     XmlNode intervalNode = resultNode.FirstChild("interval");
     if(!intervalNode.IsNull())
     {
-      m_interval = StringUtils::ConvertToInt32(StringUtils::Trim(intervalNode.GetText().c_str()).c_str());
+      m_interval = StringUtils::ConvertToInt32(intervalNode.GetTextView().Trim().ToString().c_str());
       m_intervalHasBeenSet = true;
     }
     XmlNode occurrenceDaySetNode = resultNode.FirstChild("occurrenceDaySet");
@@ -76,7 +76,7 @@ ScheduledInstanceRecurrence& ScheduledInstanceRecurrence::operator =(const XmlNo
       XmlNode occurrenceDaySetMember = occurrenceDaySetNode.FirstChild("item");
       while(!occurrenceDaySetMember.IsNull())
       {
-         m_occurrenceDaySet.push_back(StringUtils::ConvertToInt32(StringUtils::Trim(occurrenceDaySetMember.GetText().c_str()).c_str()));
+         m_occurrenceDaySet.push_back(StringUtils::ConvertToInt32(occurrenceDaySetMember.GetTextView().Trim().ToString().c_str()));
         occurrenceDaySetMember = occurrenceDaySetMember.NextNode("item");
       }
 
@@ -85,13 +85,13 @@ ScheduledInstanceRecurrence& ScheduledInstanceRecurrence::operator =(const XmlNo
     XmlNode occurrenceRelativeToEndNode = resultNode.FirstChild("occurrenceRelativeToEnd");
     if(!occurrenceRelativeToEndNode.IsNull())
     {
-      m_occurrenceRelativeToEnd = StringUtils::ConvertToBool(StringUtils::Trim(occurrenceRelativeToEndNode.GetText().c_str()).c_str());
+      m_occurrenceRelativeToEnd = StringUtils::ConvertToBool(occurrenceRelativeToEndNode.GetTextView().Trim().ToString().c_str());
       m_occurrenceRelativeToEndHasBeenSet = true;
     }
     XmlNode occurrenceUnitNode = resultNode.FirstChild("occurrenceUnit");
     if(!occurrenceUnitNode.IsNull())
     {
-      m_occurrenceUnit = StringUtils::Trim(occurrenceUnitNode.GetText().c_str());
+      m_occurrenceUnit = occurrenceUnitNode.GetTextView().Trim().ToString();
       m_occurrenceUnitHasBeenSet = true;
     }
   }
@@ -103,7 +103,7 @@ void ScheduledInstanceRecurrence::OutputToStream(Aws::OStream& oStream, const ch
 {
   if(m_frequencyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Frequency=" << StringUtils::URLEncode(m_frequency.c_str()) << "&";
+      oStream << location << index << locationValue << ".Frequency=" << StringUtils::URLEncoded(m_frequency) << "&";
   }
 
   if(m_intervalHasBeenSet)
@@ -127,7 +127,7 @@ void ScheduledInstanceRecurrence::OutputToStream(Aws::OStream& oStream, const ch
 
   if(m_occurrenceUnitHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OccurrenceUnit=" << StringUtils::URLEncode(m_occurrenceUnit.c_str()) << "&";
+      oStream << location << index << locationValue << ".OccurrenceUnit=" << StringUtils::URLEncoded(m_occurrenceUnit) << "&";
   }
 
 }
@@ -136,7 +136,7 @@ void ScheduledInstanceRecurrence::OutputToStream(Aws::OStream& oStream, const ch
 {
   if(m_frequencyHasBeenSet)
   {
-      oStream << location << ".Frequency=" << StringUtils::URLEncode(m_frequency.c_str()) << "&";
+      oStream << location << ".Frequency=" << StringUtils::URLEncoded(m_frequency) << "&";
   }
   if(m_intervalHasBeenSet)
   {
@@ -156,7 +156,7 @@ void ScheduledInstanceRecurrence::OutputToStream(Aws::OStream& oStream, const ch
   }
   if(m_occurrenceUnitHasBeenSet)
   {
-      oStream << location << ".OccurrenceUnit=" << StringUtils::URLEncode(m_occurrenceUnit.c_str()) << "&";
+      oStream << location << ".OccurrenceUnit=" << StringUtils::URLEncoded(m_occurrenceUnit) << "&";
   }
 }
 
@@ -61,13 +61,13 @@ ScheduledInstanceRecurrenceRequest& ScheduledInstanceRecurrenceRequest::operator
     XmlNode frequencyNode = resultNode.FirstChild("Frequency");
     if(!frequencyNode.IsNull())
     {
-      m_frequency = StringUtils::Trim(frequencyNode.GetText().c_str());
+      m_frequency = frequencyNode.GetTextView().Trim().ToString();
       m_frequencyHasBeenSet = true;
     }
     XmlNode intervalNode = resultNode.FirstChild("Interval");
     if(!intervalNode.IsNull())
     {
-      m_interval = StringUtils::ConvertToInt32(StringUtils::Trim(intervalNode.GetText().c_str()).c_str());
+      m_interval = StringUtils::ConvertToInt32(intervalNode.GetTextView().Trim().ToString().c_str());
       m_intervalHasBeenSet = true;
     }
     XmlNode occurrenceDaysNode = resultNode.FirstChild("OccurrenceDay");
@@ -76,7 +76,7 @@ ScheduledInstanceRecurrenceRequest& ScheduledInstanceRecurrenceRequest::operator
       XmlNode occurrenceDaysMember = occurrenceDaysNode.FirstChild("OccurenceDay");
       while(!occurrenceDaysMember.IsNull())
       {
-         m_occurrenceDays.push_back(StringUtils::ConvertToInt32(StringUtils::Trim(occurrenceDaysMember.GetText().c_str()).c_str()));
+         m_occurrenceDays.push_back(StringUtils::ConvertToInt32(occurrenceDaysMember.GetTextView().Trim().ToString().c_str()));
         occurrenceDaysMember = occurrenceDaysMember.NextNode("OccurenceDay");
       }
 
@@ -85,13 +85,13 @@ ScheduledInstanceRecurrenceRequest& ScheduledInstanceRecurrenceRequest::operator
     XmlNode occurrenceRelativeToEndNode = resultNode.FirstChild("OccurrenceRelativeToEnd");
     if(!occurrenceRelativeToEndNode.IsNull())
     {
-      m_occurrenceRelativeToEnd = StringUtils::ConvertToBool(StringUtils::Trim(occurrenceRelativeToEndNode.GetText().c_str()).c_str());
+      m_occurrenceRelativeToEnd = StringUtils::ConvertToBool(occurrenceRelativeToEndNode.GetTextView().Trim().ToString().c_str());
       m_occurrenceRelativeToEndHasBeenSet = true;
     }
     XmlNode occurrenceUnitNode = resultNode.FirstChild("OccurrenceUnit");
     if(!occurrenceUnitNode.IsNull())
     {
-      m_occurrenceUnit = StringUtils::Trim(occurrenceUnitNode.GetText().c_str());
+      m_occurrenceUnit = occurrenceUnitNode.GetTextView().Trim().ToString();
       m_occurrenceUnitHasBeenSet = true;
     }
   }
@@ -103,7 +103,7 @@ void ScheduledInstanceRecurrenceRequest::OutputToStream(Aws::OStream& oStream, c
 {
   if(m_frequencyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Frequency=" << StringUtils::URLEncode(m_frequency.c_str()) << "&";
+      oStream << location << index << locationValue << ".Frequency=" << StringUtils::URLEncoded(m_frequency) << "&";
   }
 
   if(m_intervalHasBeenSet)
@@ -127,7 +127,7 @@ void ScheduledInstanceRecurrenceRequest::OutputToStream(Aws::OStream& oStream, c
 
   if(m_occurrenceUnitHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OccurrenceUnit=" << StringUtils::URLEncode(m_occurrenceUnit.c_str()) << "&";
+      oStream << location << index << locationValue << ".OccurrenceUnit=" << StringUtils::URLEncoded(m_occurrenceUnit) << "&";
   }
 
 }
@@ -136,7 +136,7 @@ void ScheduledInstanceRecurrenceRequest::OutputToStream(Aws::OStream& oStream, c
 {
   if(m_frequencyHasBeenSet)
   {
-      oStream << location << ".Frequency=" << StringUtils::URLEncode(m_frequency.c_str()) << "&";
+      oStream << location << ".Frequency=" << StringUtils::URLEncoded(m_frequency) << "&";
   }
   if(m_intervalHasBeenSet)
   {
@@ -156,7 +156,7 @@ void ScheduledInstanceRecurrenceRequest::OutputToStream(Aws::OStream& oStream, c
   }
   if(m_occurrenceUnitHasBeenSet)
   {
-      oStream << location << ".OccurrenceUnit=" << StringUtils::URLEncode(m_occurrenceUnit.c_str()) << "&";
+      oStream << location << ".OccurrenceUnit=" << StringUtils::URLEncoded(m_occurrenceUnit) << "&";
   }
 }
 
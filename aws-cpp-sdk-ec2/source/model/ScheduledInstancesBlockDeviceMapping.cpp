@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -55,19 +56,19 @@ ScheduledInstancesBlockDeviceMapping& ScheduledInstancesBlockDeviceMapping::oper
     XmlNode deviceNameNode = resultNode.FirstChild("DeviceName");
     if(!deviceNameNode.IsNull())
     {
-      m_deviceName = StringUtils::Trim(deviceNameNode.GetText().c_str());
+      m_deviceName = deviceNameNode.GetTextView().Trim().ToString();
       m_deviceNameHasBeenSet = true;
     }
     XmlNode noDeviceNode = resultNode.FirstChild("NoDevice");
     if(!noDeviceNode.IsNull())
     {
-      m_noDevice = StringUtils::Trim(noDeviceNode.GetText().c_str());
+      m_noDevice = noDeviceNode.GetTextView().Trim().ToString();
       m_noDeviceHasBeenSet = true;
     }
     XmlNode virtualNameNode = resultNode.FirstChild("VirtualName");
     if(!virtualNameNode.IsNull())
     {
-      m_virtualName = StringUtils::Trim(virtualNameNode.GetText().c_str());
+      m_virtualName = virtualNameNode.GetTextView().Trim().ToString();
       m_virtualNameHasBeenSet = true;
     }
     XmlNode ebsNode = resultNode.FirstChild("Ebs");
@@ -85,24 +86,24 @@ void ScheduledInstancesBlockDeviceMapping::OutputToStream(Aws::OStream& oStream,
 {
   if(m_deviceNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DeviceName=" << StringUtils::URLEncode(m_deviceName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DeviceName=" << StringUtils::URLEncoded(m_deviceName) << "&";
   }
 
   if(m_noDeviceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NoDevice=" << StringUtils::URLEncode(m_noDevice.c_str()) << "&";
+      oStream << location << index << locationValue << ".NoDevice=" << StringUtils::URLEncoded(m_noDevice) << "&";
   }
 
   if(m_virtualNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VirtualName=" << StringUtils::URLEncode(m_virtualName.c_str()) << "&";
+      oStream << location << index << locationValue << ".VirtualName=" << StringUtils::URLEncoded(m_virtualName) << "&";
   }
 
   if(m_ebsHasBeenSet)
   {
-      Aws::StringStream ebsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream ebsLocationAndMemberSs;
       ebsLocationAndMemberSs << location << index << locationValue << ".Ebs";
-      m_ebs.OutputToStream(oStream, ebsLocationAndMemberSs.str().c_str());
+      m_ebs.OutputToStream(oStream, ebsLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -111,15 +112,15 @@ void ScheduledInstancesBlockDeviceMapping::OutputToStream(Aws::OStream& oStream,
 {
   if(m_deviceNameHasBeenSet)
   {
-      oStream << location << ".DeviceName=" << StringUtils::URLEncode(m_deviceName.c_str()) << "&";
+      oStream << location << ".DeviceName=" << StringUtils::URLEncoded(m_deviceName) << "&";
   }
   if(m_noDeviceHasBeenSet)
   {
-      oStream << location << ".NoDevice=" << StringUtils::URLEncode(m_noDevice.c_str()) << "&";
+      oStream << location << ".NoDevice=" << StringUtils::URLEncoded(m_noDevice) << "&";
   }
   if(m_virtualNameHasBeenSet)
   {
-      oStream << location << ".VirtualName=" << StringUtils::URLEncode(m_virtualName.c_str()) << "&";
+      oStream << location << ".VirtualName=" << StringUtils::URLEncoded(m_virtualName) << "&";
   }
   if(m_ebsHasBeenSet)
   {
@@ -67,37 +67,37 @@ ScheduledInstancesEbs& ScheduledInstancesEbs::operator =(const XmlNode& xmlNode)
     XmlNode snapshotIdNode = resultNode.FirstChild("SnapshotId");
     if(!snapshotIdNode.IsNull())
     {
-      m_snapshotId = StringUtils::Trim(snapshotIdNode.GetText().c_str());
+      m_snapshotId = snapshotIdNode.GetTextView().Trim().ToString();
       m_snapshotIdHasBeenSet = true;
     }
     XmlNode volumeSizeNode = resultNode.FirstChild("VolumeSize");
     if(!volumeSizeNode.IsNull())
     {
-      m_volumeSize = StringUtils::ConvertToInt32(StringUtils::Trim(volumeSizeNode.GetText().c_str()).c_str());
+      m_volumeSize = StringUtils::ConvertToInt32(volumeSizeNode.GetTextView().Trim().ToString().c_str());
       m_volumeSizeHasBeenSet = true;
     }
     XmlNode deleteOnTerminationNode = resultNode.FirstChild("DeleteOnTermination");
     if(!deleteOnTerminationNode.IsNull())
     {
-      m_deleteOnTermination = StringUtils::ConvertToBool(StringUtils::Trim(deleteOnTerminationNode.GetText().c_str()).c_str());
+      m_deleteOnTermination = StringUtils::ConvertToBool(deleteOnTerminationNode.GetTextView().Trim().ToString().c_str());
       m_deleteOnTerminationHasBeenSet = true;
     }
     XmlNode volumeTypeNode = resultNode.FirstChild("VolumeType");
     if(!volumeTypeNode.IsNull())
     {
-      m_volumeType = StringUtils::Trim(volumeTypeNode.GetText().c_str());
+      m_volumeType = volumeTypeNode.GetTextView().Trim().ToString();
       m_volumeTypeHasBeenSet = true;
     }
     XmlNode iopsNode = resultNode.FirstChild("Iops");
     if(!iopsNode.IsNull())
     {
-      m_iops = StringUtils::ConvertToInt32(StringUtils::Trim(iopsNode.GetText().c_str()).c_str());
+      m_iops = StringUtils::ConvertToInt32(iopsNode.GetTextView().Trim().ToString().c_str());
       m_iopsHasBeenSet = true;
     }
     XmlNode encryptedNode = resultNode.FirstChild("Encrypted");
     if(!encryptedNode.IsNull())
     {
-      m_encrypted = StringUtils::ConvertToBool(StringUtils::Trim(encryptedNode.GetText().c_str()).c_str());
+      m_encrypted = StringUtils::ConvertToBool(encryptedNode.GetTextView().Trim().ToString().c_str());
       m_encryptedHasBeenSet = true;
     }
   }
@@ -109,7 +109,7 @@ void ScheduledInstancesEbs::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_snapshotIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotId=" << StringUtils::URLEncode(m_snapshotId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotId=" << StringUtils::URLEncoded(m_snapshotId) << "&";
   }
 
   if(m_volumeSizeHasBeenSet)
@@ -124,7 +124,7 @@ void ScheduledInstancesEbs::OutputToStream(Aws::OStream& oStream, const char* lo
 
   if(m_volumeTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VolumeType=" << StringUtils::URLEncode(m_volumeType.c_str()) << "&";
+      oStream << location << index << locationValue << ".VolumeType=" << StringUtils::URLEncoded(m_volumeType) << "&";
   }
 
   if(m_iopsHasBeenSet)
@@ -143,7 +143,7 @@ void ScheduledInstancesEbs::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_snapshotIdHasBeenSet)
   {
-      oStream << location << ".SnapshotId=" << StringUtils::URLEncode(m_snapshotId.c_str()) << "&";
+      oStream << location << ".SnapshotId=" << StringUtils::URLEncoded(m_snapshotId) << "&";
   }
   if(m_volumeSizeHasBeenSet)
   {
@@ -155,7 +155,7 @@ void ScheduledInstancesEbs::OutputToStream(Aws::OStream& oStream, const char* lo
   }
   if(m_volumeTypeHasBeenSet)
   {
-      oStream << location << ".VolumeType=" << StringUtils::URLEncode(m_volumeType.c_str()) << "&";
+      oStream << location << ".VolumeType=" << StringUtils::URLEncoded(m_volumeType) << "&";
   }
   if(m_iopsHasBeenSet)
   {
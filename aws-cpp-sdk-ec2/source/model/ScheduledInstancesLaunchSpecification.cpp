@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -77,13 +78,13 @@ ScheduledInstancesLaunchSpecification& ScheduledInstancesLaunchSpecification::op
     XmlNode imageIdNode = resultNode.FirstChild("ImageId");
     if(!imageIdNode.IsNull())
     {
-      m_imageId = StringUtils::Trim(imageIdNode.GetText().c_str());
+      m_imageId = imageIdNode.GetTextView().Trim().ToString();
       m_imageIdHasBeenSet = true;
     }
     XmlNode keyNameNode = resultNode.FirstChild("KeyName");
     if(!keyNameNode.IsNull())
     {
-      m_keyName = StringUtils::Trim(keyNameNode.GetText().c_str());
+      m_keyName = keyNameNode.GetTextView().Trim().ToString();
       m_keyNameHasBeenSet = true;
     }
     XmlNode securityGroupIdsNode = resultNode.FirstChild("SecurityGroupId");
@@ -92,7 +93,7 @@ ScheduledInstancesLaunchSpecification& ScheduledInstancesLaunchSpecification::op
       XmlNode securityGroupIdsMember = securityGroupIdsNode.FirstChild("SecurityGroupId");
       while(!securityGroupIdsMember.IsNull())
       {
-        m_securityGroupIds.push_back(StringUtils::Trim(securityGroupIdsMember.GetText().c_str()));
+        m_securityGroupIds.push_back(securityGroupIdsMember.GetTextView().Trim().ToString());
         securityGroupIdsMember = securityGroupIdsMember.NextNode("SecurityGroupId");
       }
 
@@ -101,7 +102,7 @@ ScheduledInstancesLaunchSpecification& ScheduledInstancesLaunchSpecification::op
     XmlNode userDataNode = resultNode.FirstChild("UserData");
     if(!userDataNode.IsNull())
     {
-      m_userData = StringUtils::Trim(userDataNode.GetText().c_str());
+      m_userData = userDataNode.GetTextView().Trim().ToString();
       m_userDataHasBeenSet = true;
     }
     XmlNode placementNode = resultNode.FirstChild("Placement");
@@ -113,19 +114,19 @@ ScheduledInstancesLaunchSpecification& ScheduledInstancesLaunchSpecification::op
     XmlNode kernelIdNode = resultNode.FirstChild("KernelId");
     if(!kernelIdNode.IsNull())
     {
-      m_kernelId = StringUtils::Trim(kernelIdNode.GetText().c_str());
+      m_kernelId = kernelIdNode.GetTextView().Trim().ToString();
       m_kernelIdHasBeenSet = true;
     }
     XmlNode instanceTypeNode = resultNode.FirstChild("InstanceType");
     if(!instanceTypeNode.IsNull())
     {
-      m_instanceType = StringUtils::Trim(instanceTypeNode.GetText().c_str());
+      m_instanceType = instanceTypeNode.GetTextView().Trim().ToString();
       m_instanceTypeHasBeenSet = true;
     }
     XmlNode ramdiskIdNode = resultNode.FirstChild("RamdiskId");
     if(!ramdiskIdNode.IsNull())
     {
-      m_ramdiskId = StringUtils::Trim(ramdiskIdNode.GetText().c_str());
+      m_ramdiskId = ramdiskIdNode.GetTextView().Trim().ToString();
       m_ramdiskIdHasBeenSet = true;
     }
     XmlNode blockDeviceMappingsNode = resultNode.FirstChild("BlockDeviceMapping");
@@ -149,7 +150,7 @@ ScheduledInstancesLaunchSpecification& ScheduledInstancesLaunchSpecification::op
     XmlNode subnetIdNode = resultNode.FirstChild("SubnetId");
     if(!subnetIdNode.IsNull())
     {
-      m_subnetId = StringUtils::Trim(subnetIdNode.GetText().c_str());
+      m_subnetId = subnetIdNode.GetTextView().Trim().ToString();
       m_subnetIdHasBeenSet = true;
     }
     XmlNode networkInterfacesNode = resultNode.FirstChild("NetworkInterface");
@@ -173,7 +174,7 @@ ScheduledInstancesLaunchSpecification& ScheduledInstancesLaunchSpecification::op
     XmlNode ebsOptimizedNode = resultNode.FirstChild("EbsOptimized");
     if(!ebsOptimizedNode.IsNull())
     {
-      m_ebsOptimized = StringUtils::ConvertToBool(StringUtils::Trim(ebsOptimizedNode.GetText().c_str()).c_str());
+      m_ebsOptimized = StringUtils::ConvertToBool(ebsOptimizedNode.GetTextView().Trim().ToString().c_str());
       m_ebsOptimizedHasBeenSet = true;
     }
   }
@@ -185,12 +186,12 @@ void ScheduledInstancesLaunchSpecification::OutputToStream(Aws::OStream& oStream
 {
   if(m_imageIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
 
   if(m_keyNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+      oStream << location << index << locationValue << ".KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
 
   if(m_securityGroupIdsHasBeenSet)
@@ -198,35 +199,35 @@ void ScheduledInstancesLaunchSpecification::OutputToStream(Aws::OStream& oStream
       unsigned securityGroupIdsIdx = 1;
       for(auto& item : m_securityGroupIds)
       {
-        oStream << location << index << locationValue << ".SecurityGroupId." << securityGroupIdsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".SecurityGroupId." << securityGroupIdsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
   if(m_userDataHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UserData=" << StringUtils::URLEncode(m_userData.c_str()) << "&";
+      oStream << location << index << locationValue << ".UserData=" << StringUtils::URLEncoded(m_userData) << "&";
   }
 
   if(m_placementHasBeenSet)
   {
-      Aws::StringStream placementLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream placementLocationAndMemberSs;
       placementLocationAndMemberSs << location << index << locationValue << ".Placement";
-      m_placement.OutputToStream(oStream, placementLocationAndMemberSs.str().c_str());
+      m_placement.OutputToStream(oStream, placementLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_kernelIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KernelId=" << StringUtils::URLEncode(m_kernelId.c_str()) << "&";
+      oStream << location << index << locationValue << ".KernelId=" << StringUtils::URLEncoded(m_kernelId) << "&";
   }
 
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
 
   if(m_ramdiskIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RamdiskId=" << StringUtils::URLEncode(m_ramdiskId.c_str()) << "&";
+      oStream << location << index << locationValue << ".RamdiskId=" << StringUtils::URLEncoded(m_ramdiskId) << "&";
   }
 
   if(m_blockDeviceMappingsHasBeenSet)
@@ -234,22 +235,22 @@ void ScheduledInstancesLaunchSpecification::OutputToStream(Aws::OStream& oStream
       unsigned blockDeviceMappingsIdx = 1;
       for(auto& item : m_blockDeviceMappings)
       {
-        Aws::StringStream blockDeviceMappingsSs;
+        Aws::Utils::Stream::StringOutputStream blockDeviceMappingsSs;
         blockDeviceMappingsSs << location << index << locationValue << ".BlockDeviceMapping." << blockDeviceMappingsIdx++;
-        item.OutputToStream(oStream, blockDeviceMappingsSs.str().c_str());
+        item.OutputToStream(oStream, blockDeviceMappingsSs.GetString().c_str());
       }
   }
 
   if(m_monitoringHasBeenSet)
   {
-      Aws::StringStream monitoringLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream monitoringLocationAndMemberSs;
       monitoringLocationAndMemberSs << location << index << locationValue << ".Monitoring";
-      m_monitoring.OutputToStream(oStream, monitoringLocationAndMemberSs.str().c_str());
+      m_monitoring.OutputToStream(oStream, monitoringLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
   if(m_networkInterfacesHasBeenSet)
@@ -257,17 +258,17 @@ void ScheduledInstancesLaunchSpecification::OutputToStream(Aws::OStream& oStream
       unsigned networkInterfacesIdx = 1;
       for(auto& item : m_networkInterfaces)
       {
-        Aws::StringStream networkInterfacesSs;
+        Aws::Utils::Stream::StringOutputStream networkInterfacesSs;
         networkInterfacesSs << location << index << locationValue << ".NetworkInterface." << networkInterfacesIdx++;
-        item.OutputToStream(oStream, networkInterfacesSs.str().c_str());
+        item.OutputToStream(oStream, networkInterfacesSs.GetString().c_str());
       }
   }
 
   if(m_iamInstanceProfileHasBeenSet)
   {
-      Aws::StringStream iamInstanceProfileLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream iamInstanceProfileLocationAndMemberSs;
       iamInstanceProfileLocationAndMemberSs << location << index << locationValue << ".IamInstanceProfile";
-      m_iamInstanceProfile.OutputToStream(oStream, iamInstanceProfileLocationAndMemberSs.str().c_str());
+      m_iamInstanceProfile.OutputToStream(oStream, iamInstanceProfileLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_ebsOptimizedHasBeenSet)
@@ -281,23 +282,23 @@ void ScheduledInstancesLaunchSpecification::OutputToStream(Aws::OStream& oStream
 {
   if(m_imageIdHasBeenSet)
   {
-      oStream << location << ".ImageId=" << StringUtils::URLEncode(m_imageId.c_str()) << "&";
+      oStream << location << ".ImageId=" << StringUtils::URLEncoded(m_imageId) << "&";
   }
   if(m_keyNameHasBeenSet)
   {
-      oStream << location << ".KeyName=" << StringUtils::URLEncode(m_keyName.c_str()) << "&";
+      oStream << location << ".KeyName=" << StringUtils::URLEncoded(m_keyName) << "&";
   }
   if(m_securityGroupIdsHasBeenSet)
   {
       unsigned securityGroupIdsIdx = 1;
       for(auto& item : m_securityGroupIds)
       {
-        oStream << location << ".SecurityGroupId." << securityGroupIdsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".SecurityGroupId." << securityGroupIdsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_userDataHasBeenSet)
   {
-      oStream << location << ".UserData=" << StringUtils::URLEncode(m_userData.c_str()) << "&";
+      oStream << location << ".UserData=" << StringUtils::URLEncoded(m_userData) << "&";
   }
   if(m_placementHasBeenSet)
   {
@@ -307,24 +308,24 @@ void ScheduledInstancesLaunchSpecification::OutputToStream(Aws::OStream& oStream
   }
   if(m_kernelIdHasBeenSet)
   {
-      oStream << location << ".KernelId=" << StringUtils::URLEncode(m_kernelId.c_str()) << "&";
+      oStream << location << ".KernelId=" << StringUtils::URLEncoded(m_kernelId) << "&";
   }
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
   if(m_ramdiskIdHasBeenSet)
   {
-      oStream << location << ".RamdiskId=" << StringUtils::URLEncode(m_ramdiskId.c_str()) << "&";
+      oStream << location << ".RamdiskId=" << StringUtils::URLEncoded(m_ramdiskId) << "&";
   }
   if(m_blockDeviceMappingsHasBeenSet)
   {
       unsigned blockDeviceMappingsIdx = 1;
       for(auto& item : m_blockDeviceMappings)
       {
-        Aws::StringStream blockDeviceMappingsSs;
+        Aws::Utils::Stream::StringOutputStream blockDeviceMappingsSs;
         blockDeviceMappingsSs << location <<  ".BlockDeviceMapping." << blockDeviceMappingsIdx++;
-        item.OutputToStream(oStream, blockDeviceMappingsSs.str().c_str());
+        item.OutputToStream(oStream, blockDeviceMappingsSs.GetString().c_str());
       }
   }
   if(m_monitoringHasBeenSet)
@@ -335,16 +336,16 @@ void ScheduledInstancesLaunchSpecification::OutputToStream(Aws::OStream& oStream
   }
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
   if(m_networkInterfacesHasBeenSet)
   {
       unsigned networkInterfacesIdx = 1;
       for(auto& item : m_networkInterfaces)
       {
-        Aws::StringStream networkInterfacesSs;
+        Aws::Utils::Stream::StringOutputStream networkInterfacesSs;
         networkInterfacesSs << location <<  ".NetworkInterface." << networkInterfacesIdx++;
-        item.OutputToStream(oStream, networkInterfacesSs.str().c_str());
+        item.OutputToStream(oStream, networkInterfacesSs.GetString().c_str());
       }
   }
   if(m_iamInstanceProfileHasBeenSet)
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -75,31 +76,31 @@ ScheduledInstancesNetworkInterface& ScheduledInstancesNetworkInterface::operator
     XmlNode networkInterfaceIdNode = resultNode.FirstChild("NetworkInterfaceId");
     if(!networkInterfaceIdNode.IsNull())
     {
-      m_networkInterfaceId = StringUtils::Trim(networkInterfaceIdNode.GetText().c_str());
+      m_networkInterfaceId = networkInterfaceIdNode.GetTextView().Trim().ToString();
       m_networkInterfaceIdHasBeenSet = true;
     }
     XmlNode deviceIndexNode = resultNode.FirstChild("DeviceIndex");
     if(!deviceIndexNode.IsNull())
     {
-      m_deviceIndex = StringUtils::ConvertToInt32(StringUtils::Trim(deviceIndexNode.GetText().c_str()).c_str());
+      m_deviceIndex = StringUtils::ConvertToInt32(deviceIndexNode.GetTextView().Trim().ToString().c_str());
       m_deviceIndexHasBeenSet = true;
     }
     XmlNode subnetIdNode = resultNode.FirstChild("SubnetId");
     if(!subnetIdNode.IsNull())
     {
-      m_subnetId = StringUtils::Trim(subnetIdNode.GetText().c_str());
+      m_subnetId = subnetIdNode.GetTextView().Trim().ToString();
       m_subnetIdHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode privateIpAddressNode = resultNode.FirstChild("PrivateIpAddress");
     if(!privateIpAddressNode.IsNull())
     {
-      m_privateIpAddress = StringUtils::Trim(privateIpAddressNode.GetText().c_str());
+      m_privateIpAddress = privateIpAddressNode.GetTextView().Trim().ToString();
       m_privateIpAddressHasBeenSet = true;
     }
     XmlNode privateIpAddressConfigsNode = resultNode.FirstChild("PrivateIpAddressConfig");
@@ -117,13 +118,13 @@ ScheduledInstancesNetworkInterface& ScheduledInstancesNetworkInterface::operator
     XmlNode secondaryPrivateIpAddressCountNode = resultNode.FirstChild("SecondaryPrivateIpAddressCount");
     if(!secondaryPrivateIpAddressCountNode.IsNull())
     {
-      m_secondaryPrivateIpAddressCount = StringUtils::ConvertToInt32(StringUtils::Trim(secondaryPrivateIpAddressCountNode.GetText().c_str()).c_str());
+      m_secondaryPrivateIpAddressCount = StringUtils::ConvertToInt32(secondaryPrivateIpAddressCountNode.GetTextView().Trim().ToString().c_str());
       m_secondaryPrivateIpAddressCountHasBeenSet = true;
     }
     XmlNode associatePublicIpAddressNode = resultNode.FirstChild("AssociatePublicIpAddress");
     if(!associatePublicIpAddressNode.IsNull())
     {
-      m_associatePublicIpAddress = StringUtils::ConvertToBool(StringUtils::Trim(associatePublicIpAddressNode.GetText().c_str()).c_str());
+      m_associatePublicIpAddress = StringUtils::ConvertToBool(associatePublicIpAddressNode.GetTextView().Trim().ToString().c_str());
       m_associatePublicIpAddressHasBeenSet = true;
     }
     XmlNode groupsNode = resultNode.FirstChild("Group");
@@ -132,7 +133,7 @@ ScheduledInstancesNetworkInterface& ScheduledInstancesNetworkInterface::operator
       XmlNode groupsMember = groupsNode.FirstChild("SecurityGroupId");
       while(!groupsMember.IsNull())
       {
-        m_groups.push_back(StringUtils::Trim(groupsMember.GetText().c_str()));
+        m_groups.push_back(groupsMember.GetTextView().Trim().ToString());
         groupsMember = groupsMember.NextNode("SecurityGroupId");
       }
 
@@ -141,7 +142,7 @@ ScheduledInstancesNetworkInterface& ScheduledInstancesNetworkInterface::operator
     XmlNode deleteOnTerminationNode = resultNode.FirstChild("DeleteOnTermination");
     if(!deleteOnTerminationNode.IsNull())
     {
-      m_deleteOnTermination = StringUtils::ConvertToBool(StringUtils::Trim(deleteOnTerminationNode.GetText().c_str()).c_str());
+      m_deleteOnTermination = StringUtils::ConvertToBool(deleteOnTerminationNode.GetTextView().Trim().ToString().c_str());
       m_deleteOnTerminationHasBeenSet = true;
     }
   }
@@ -153,7 +154,7 @@ void ScheduledInstancesNetworkInterface::OutputToStream(Aws::OStream& oStream, c
 {
   if(m_networkInterfaceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
 
   if(m_deviceIndexHasBeenSet)
@@ -163,17 +164,17 @@ void ScheduledInstancesNetworkInterface::OutputToStream(Aws::OStream& oStream, c
 
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
 
   if(m_privateIpAddressConfigsHasBeenSet)
@@ -181,9 +182,9 @@ void ScheduledInstancesNetworkInterface::OutputToStream(Aws::OStream& oStream, c
       unsigned privateIpAddressConfigsIdx = 1;
       for(auto& item : m_privateIpAddressConfigs)
       {
-        Aws::StringStream privateIpAddressConfigsSs;
+        Aws::Utils::Stream::StringOutputStream privateIpAddressConfigsSs;
         privateIpAddressConfigsSs << location << index << locationValue << ".PrivateIpAddressConfig." << privateIpAddressConfigsIdx++;
-        item.OutputToStream(oStream, privateIpAddressConfigsSs.str().c_str());
+        item.OutputToStream(oStream, privateIpAddressConfigsSs.GetString().c_str());
       }
   }
 
@@ -202,7 +203,7 @@ void ScheduledInstancesNetworkInterface::OutputToStream(Aws::OStream& oStream, c
       unsigned groupsIdx = 1;
       for(auto& item : m_groups)
       {
-        oStream << location << index << locationValue << ".Group." << groupsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".Group." << groupsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -217,7 +218,7 @@ void ScheduledInstancesNetworkInterface::OutputToStream(Aws::OStream& oStream, c
 {
   if(m_networkInterfaceIdHasBeenSet)
   {
-      oStream << location << ".NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+      oStream << location << ".NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
   if(m_deviceIndexHasBeenSet)
   {
@@ -225,24 +226,24 @@ void ScheduledInstancesNetworkInterface::OutputToStream(Aws::OStream& oStream, c
   }
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_privateIpAddressHasBeenSet)
   {
-      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncode(m_privateIpAddress.c_str()) << "&";
+      oStream << location << ".PrivateIpAddress=" << StringUtils::URLEncoded(m_privateIpAddress) << "&";
   }
   if(m_privateIpAddressConfigsHasBeenSet)
   {
       unsigned privateIpAddressConfigsIdx = 1;
       for(auto& item : m_privateIpAddressConfigs)
       {
-        Aws::StringStream privateIpAddressConfigsSs;
+        Aws::Utils::Stream::StringOutputStream privateIpAddressConfigsSs;
         privateIpAddressConfigsSs << location <<  ".PrivateIpAddressConfigSet." << privateIpAddressConfigsIdx++;
-        item.OutputToStream(oStream, privateIpAddressConfigsSs.str().c_str());
+        item.OutputToStream(oStream, privateIpAddressConfigsSs.GetString().c_str());
       }
   }
   if(m_secondaryPrivateIpAddressCountHasBeenSet)
@@ -258,7 +259,7 @@ void ScheduledInstancesNetworkInterface::OutputToStream(Aws::OStream& oStream, c
       unsigned groupsIdx = 1;
       for(auto& item : m_groups)
       {
-        oStream << location << ".SecurityGroupId." << groupsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".SecurityGroupId." << groupsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_deleteOnTerminationHasBeenSet)
@@ -51,13 +51,13 @@ ScheduledInstancesPlacement& ScheduledInstancesPlacement::operator =(const XmlNo
     XmlNode availabilityZoneNode = resultNode.FirstChild("AvailabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode groupNameNode = resultNode.FirstChild("GroupName");
     if(!groupNameNode.IsNull())
     {
-      m_groupName = StringUtils::Trim(groupNameNode.GetText().c_str());
+      m_groupName = groupNameNode.GetTextView().Trim().ToString();
       m_groupNameHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void ScheduledInstancesPlacement::OutputToStream(Aws::OStream& oStream, const ch
 {
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void ScheduledInstancesPlacement::OutputToStream(Aws::OStream& oStream, const ch
 {
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -63,25 +64,25 @@ SecurityGroup& SecurityGroup::operator =(const XmlNode& xmlNode)
     XmlNode ownerIdNode = resultNode.FirstChild("ownerId");
     if(!ownerIdNode.IsNull())
     {
-      m_ownerId = StringUtils::Trim(ownerIdNode.GetText().c_str());
+      m_ownerId = ownerIdNode.GetTextView().Trim().ToString();
       m_ownerIdHasBeenSet = true;
     }
     XmlNode groupNameNode = resultNode.FirstChild("groupName");
     if(!groupNameNode.IsNull())
     {
-      m_groupName = StringUtils::Trim(groupNameNode.GetText().c_str());
+      m_groupName = groupNameNode.GetTextView().Trim().ToString();
       m_groupNameHasBeenSet = true;
     }
     XmlNode groupIdNode = resultNode.FirstChild("groupId");
     if(!groupIdNode.IsNull())
     {
-      m_groupId = StringUtils::Trim(groupIdNode.GetText().c_str());
+      m_groupId = groupIdNode.GetTextView().Trim().ToString();
       m_groupIdHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("groupDescription");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode ipPermissionsNode = resultNode.FirstChild("ipPermissions");
@@ -111,7 +112,7 @@ SecurityGroup& SecurityGroup::operator =(const XmlNode& xmlNode)
     XmlNode vpcIdNode = resultNode.FirstChild("vpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("tagSet");
@@ -135,22 +136,22 @@ void SecurityGroup::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_ownerIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OwnerId=" << StringUtils::URLEncode(m_ownerId.c_str()) << "&";
+      oStream << location << index << locationValue << ".OwnerId=" << StringUtils::URLEncoded(m_ownerId) << "&";
   }
 
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   if(m_groupIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".GroupId=" << StringUtils::URLEncode(m_groupId.c_str()) << "&";
+      oStream << location << index << locationValue << ".GroupId=" << StringUtils::URLEncoded(m_groupId) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_ipPermissionsHasBeenSet)
@@ -158,9 +159,9 @@ void SecurityGroup::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned ipPermissionsIdx = 1;
       for(auto& item : m_ipPermissions)
       {
-        Aws::StringStream ipPermissionsSs;
+        Aws::Utils::Stream::StringOutputStream ipPermissionsSs;
         ipPermissionsSs << location << index << locationValue << ".IpPermissions." << ipPermissionsIdx++;
-        item.OutputToStream(oStream, ipPermissionsSs.str().c_str());
+        item.OutputToStream(oStream, ipPermissionsSs.GetString().c_str());
       }
   }
 
@@ -169,15 +170,15 @@ void SecurityGroup::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned ipPermissionsEgressIdx = 1;
       for(auto& item : m_ipPermissionsEgress)
       {
-        Aws::StringStream ipPermissionsEgressSs;
+        Aws::Utils::Stream::StringOutputStream ipPermissionsEgressSs;
         ipPermissionsEgressSs << location << index << locationValue << ".IpPermissionsEgress." << ipPermissionsEgressIdx++;
-        item.OutputToStream(oStream, ipPermissionsEgressSs.str().c_str());
+        item.OutputToStream(oStream, ipPermissionsEgressSs.GetString().c_str());
       }
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -185,9 +186,9 @@ void SecurityGroup::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -197,28 +198,28 @@ void SecurityGroup::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_ownerIdHasBeenSet)
   {
-      oStream << location << ".OwnerId=" << StringUtils::URLEncode(m_ownerId.c_str()) << "&";
+      oStream << location << ".OwnerId=" << StringUtils::URLEncoded(m_ownerId) << "&";
   }
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
   if(m_groupIdHasBeenSet)
   {
-      oStream << location << ".GroupId=" << StringUtils::URLEncode(m_groupId.c_str()) << "&";
+      oStream << location << ".GroupId=" << StringUtils::URLEncoded(m_groupId) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_ipPermissionsHasBeenSet)
   {
       unsigned ipPermissionsIdx = 1;
       for(auto& item : m_ipPermissions)
       {
-        Aws::StringStream ipPermissionsSs;
+        Aws::Utils::Stream::StringOutputStream ipPermissionsSs;
         ipPermissionsSs << location <<  ".item." << ipPermissionsIdx++;
-        item.OutputToStream(oStream, ipPermissionsSs.str().c_str());
+        item.OutputToStream(oStream, ipPermissionsSs.GetString().c_str());
       }
   }
   if(m_ipPermissionsEgressHasBeenSet)
@@ -226,23 +227,23 @@ void SecurityGroup::OutputToStream(Aws::OStream& oStream, const char* location)
       unsigned ipPermissionsEgressIdx = 1;
       for(auto& item : m_ipPermissionsEgress)
       {
-        Aws::StringStream ipPermissionsEgressSs;
+        Aws::Utils::Stream::StringOutputStream ipPermissionsEgressSs;
         ipPermissionsEgressSs << location <<  ".item." << ipPermissionsEgressIdx++;
-        item.OutputToStream(oStream, ipPermissionsEgressSs.str().c_str());
+        item.OutputToStream(oStream, ipPermissionsEgressSs.GetString().c_str());
       }
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_tagsHasBeenSet)
   {
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
@@ -53,19 +53,19 @@ SecurityGroupReference& SecurityGroupReference::operator =(const XmlNode& xmlNod
     XmlNode groupIdNode = resultNode.FirstChild("groupId");
     if(!groupIdNode.IsNull())
     {
-      m_groupId = StringUtils::Trim(groupIdNode.GetText().c_str());
+      m_groupId = groupIdNode.GetTextView().Trim().ToString();
       m_groupIdHasBeenSet = true;
     }
     XmlNode referencingVpcIdNode = resultNode.FirstChild("referencingVpcId");
     if(!referencingVpcIdNode.IsNull())
     {
-      m_referencingVpcId = StringUtils::Trim(referencingVpcIdNode.GetText().c_str());
+      m_referencingVpcId = referencingVpcIdNode.GetTextView().Trim().ToString();
       m_referencingVpcIdHasBeenSet = true;
     }
     XmlNode vpcPeeringConnectionIdNode = resultNode.FirstChild("vpcPeeringConnectionId");
     if(!vpcPeeringConnectionIdNode.IsNull())
     {
-      m_vpcPeeringConnectionId = StringUtils::Trim(vpcPeeringConnectionIdNode.GetText().c_str());
+      m_vpcPeeringConnectionId = vpcPeeringConnectionIdNode.GetTextView().Trim().ToString();
       m_vpcPeeringConnectionIdHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void SecurityGroupReference::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_groupIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".GroupId=" << StringUtils::URLEncode(m_groupId.c_str()) << "&";
+      oStream << location << index << locationValue << ".GroupId=" << StringUtils::URLEncoded(m_groupId) << "&";
   }
 
   if(m_referencingVpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReferencingVpcId=" << StringUtils::URLEncode(m_referencingVpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReferencingVpcId=" << StringUtils::URLEncoded(m_referencingVpcId) << "&";
   }
 
   if(m_vpcPeeringConnectionIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcPeeringConnectionId=" << StringUtils::URLEncode(m_vpcPeeringConnectionId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcPeeringConnectionId=" << StringUtils::URLEncoded(m_vpcPeeringConnectionId) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void SecurityGroupReference::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_groupIdHasBeenSet)
   {
-      oStream << location << ".GroupId=" << StringUtils::URLEncode(m_groupId.c_str()) << "&";
+      oStream << location << ".GroupId=" << StringUtils::URLEncoded(m_groupId) << "&";
   }
   if(m_referencingVpcIdHasBeenSet)
   {
-      oStream << location << ".ReferencingVpcId=" << StringUtils::URLEncode(m_referencingVpcId.c_str()) << "&";
+      oStream << location << ".ReferencingVpcId=" << StringUtils::URLEncoded(m_referencingVpcId) << "&";
   }
   if(m_vpcPeeringConnectionIdHasBeenSet)
   {
-      oStream << location << ".VpcPeeringConnectionId=" << StringUtils::URLEncode(m_vpcPeeringConnectionId.c_str()) << "&";
+      oStream << location << ".VpcPeeringConnectionId=" << StringUtils::URLEncoded(m_vpcPeeringConnectionId) << "&";
   }
 }
 
@@ -29,21 +29,29 @@ namespace Aws
       namespace ShutdownBehaviorMapper
       {
 
-        static const int stop_HASH = HashingUtils::HashString("stop");
-        static const int terminate_HASH = HashingUtils::HashString("terminate");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int stop_HASH = 3540994;
+        static const int terminate_HASH = 2035990113;
 
 
         ShutdownBehavior GetShutdownBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == stop_HASH)
+          switch (hashCode)
           {
+          case stop_HASH:
             return ShutdownBehavior::stop;
-          }
-          else if (hashCode == terminate_HASH)
-          {
+          case terminate_HASH:
             return ShutdownBehavior::terminate;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace SnapshotAttributeNameMapper
       {
 
-        static const int productCodes_HASH = HashingUtils::HashString("productCodes");
-        static const int createVolumePermission_HASH = HashingUtils::HashString("createVolumePermission");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int productCodes_HASH = 988549239;
+        static const int createVolumePermission_HASH = 1019764133;
 
 
         SnapshotAttributeName GetSnapshotAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == productCodes_HASH)
+          switch (hashCode)
           {
+          case productCodes_HASH:
             return SnapshotAttributeName::productCodes;
-          }
-          else if (hashCode == createVolumePermission_HASH)
-          {
+          case createVolumePermission_HASH:
             return SnapshotAttributeName::createVolumePermission;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -55,19 +56,19 @@ SnapshotDiskContainer& SnapshotDiskContainer::operator =(const XmlNode& xmlNode)
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode formatNode = resultNode.FirstChild("Format");
     if(!formatNode.IsNull())
     {
-      m_format = StringUtils::Trim(formatNode.GetText().c_str());
+      m_format = formatNode.GetTextView().Trim().ToString();
       m_formatHasBeenSet = true;
     }
     XmlNode urlNode = resultNode.FirstChild("Url");
     if(!urlNode.IsNull())
     {
-      m_url = StringUtils::Trim(urlNode.GetText().c_str());
+      m_url = urlNode.GetTextView().Trim().ToString();
       m_urlHasBeenSet = true;
     }
     XmlNode userBucketNode = resultNode.FirstChild("UserBucket");
@@ -85,24 +86,24 @@ void SnapshotDiskContainer::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_formatHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Format=" << StringUtils::URLEncode(m_format.c_str()) << "&";
+      oStream << location << index << locationValue << ".Format=" << StringUtils::URLEncoded(m_format) << "&";
   }
 
   if(m_urlHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Url=" << StringUtils::URLEncode(m_url.c_str()) << "&";
+      oStream << location << index << locationValue << ".Url=" << StringUtils::URLEncoded(m_url) << "&";
   }
 
   if(m_userBucketHasBeenSet)
   {
-      Aws::StringStream userBucketLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream userBucketLocationAndMemberSs;
       userBucketLocationAndMemberSs << location << index << locationValue << ".UserBucket";
-      m_userBucket.OutputToStream(oStream, userBucketLocationAndMemberSs.str().c_str());
+      m_userBucket.OutputToStream(oStream, userBucketLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -111,15 +112,15 @@ void SnapshotDiskContainer::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_formatHasBeenSet)
   {
-      oStream << location << ".Format=" << StringUtils::URLEncode(m_format.c_str()) << "&";
+      oStream << location << ".Format=" << StringUtils::URLEncoded(m_format) << "&";
   }
   if(m_urlHasBeenSet)
   {
-      oStream << location << ".Url=" << StringUtils::URLEncode(m_url.c_str()) << "&";
+      oStream << location << ".Url=" << StringUtils::URLEncoded(m_url) << "&";
   }
   if(m_userBucketHasBeenSet)
   {
@@ -29,26 +29,32 @@ namespace Aws
       namespace SnapshotStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int completed_HASH = HashingUtils::HashString("completed");
-        static const int error_HASH = HashingUtils::HashString("error");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int pending_HASH = -682587753;
+        static const int completed_HASH = -1402931637;
+        static const int error_HASH = 96784904;
 
 
         SnapshotState GetSnapshotStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          switch (hashCode)
           {
+          case pending_HASH:
             return SnapshotState::pending;
-          }
-          else if (hashCode == completed_HASH)
-          {
+          case completed_HASH:
             return SnapshotState::completed;
-          }
-          else if (hashCode == error_HASH)
-          {
+          case error_HASH:
             return SnapshotState::error;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -57,25 +58,25 @@ SpotDatafeedSubscription& SpotDatafeedSubscription::operator =(const XmlNode& xm
     XmlNode ownerIdNode = resultNode.FirstChild("ownerId");
     if(!ownerIdNode.IsNull())
     {
-      m_ownerId = StringUtils::Trim(ownerIdNode.GetText().c_str());
+      m_ownerId = ownerIdNode.GetTextView().Trim().ToString();
       m_ownerIdHasBeenSet = true;
     }
     XmlNode bucketNode = resultNode.FirstChild("bucket");
     if(!bucketNode.IsNull())
     {
-      m_bucket = StringUtils::Trim(bucketNode.GetText().c_str());
+      m_bucket = bucketNode.GetTextView().Trim().ToString();
       m_bucketHasBeenSet = true;
     }
     XmlNode prefixNode = resultNode.FirstChild("prefix");
     if(!prefixNode.IsNull())
     {
-      m_prefix = StringUtils::Trim(prefixNode.GetText().c_str());
+      m_prefix = prefixNode.GetTextView().Trim().ToString();
       m_prefixHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = DatafeedSubscriptionStateMapper::GetDatafeedSubscriptionStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = DatafeedSubscriptionStateMapper::GetDatafeedSubscriptionStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode faultNode = resultNode.FirstChild("fault");
@@ -93,17 +94,17 @@ void SpotDatafeedSubscription::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_ownerIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OwnerId=" << StringUtils::URLEncode(m_ownerId.c_str()) << "&";
+      oStream << location << index << locationValue << ".OwnerId=" << StringUtils::URLEncoded(m_ownerId) << "&";
   }
 
   if(m_bucketHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Bucket=" << StringUtils::URLEncode(m_bucket.c_str()) << "&";
+      oStream << location << index << locationValue << ".Bucket=" << StringUtils::URLEncoded(m_bucket) << "&";
   }
 
   if(m_prefixHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Prefix=" << StringUtils::URLEncode(m_prefix.c_str()) << "&";
+      oStream << location << index << locationValue << ".Prefix=" << StringUtils::URLEncoded(m_prefix) << "&";
   }
 
   if(m_stateHasBeenSet)
@@ -113,9 +114,9 @@ void SpotDatafeedSubscription::OutputToStream(Aws::OStream& oStream, const char*
 
   if(m_faultHasBeenSet)
   {
-      Aws::StringStream faultLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream faultLocationAndMemberSs;
       faultLocationAndMemberSs << location << index << locationValue << ".Fault";
-      m_fault.OutputToStream(oStream, faultLocationAndMemberSs.str().c_str());
+      m_fault.OutputToStream(oStream, faultLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -124,15 +125,15 @@ void SpotDatafeedSubscription::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_ownerIdHasBeenSet)
   {
-      oStream << location << ".OwnerId=" << StringUtils::URLEncode(m_ownerId.c_str()) << "&";
+      oStream << location << ".OwnerId=" << StringUtils::URLEncoded(m_ownerId) << "&";
   }
   if(m_bucketHasBeenSet)
   {
-      oStream << location << ".Bucket=" << StringUtils::URLEncode(m_bucket.c_str()) << "&";
+      oStream << location << ".Bucket=" << StringUtils::URLEncoded(m_bucket) << "&";
   }
   if(m_prefixHasBeenSet)
   {
-      oStream << location << ".Prefix=" << StringUtils::URLEncode(m_prefix.c_str()) << "&";
+      oStream << location << ".Prefix=" << StringUtils::URLEncoded(m_prefix) << "&";
   }
   if(m_stateHasBeenSet)
   {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -55,13 +56,13 @@ SpotFleetRequestConfig& SpotFleetRequestConfig::operator =(const XmlNode& xmlNod
     XmlNode spotFleetRequestIdNode = resultNode.FirstChild("spotFleetRequestId");
     if(!spotFleetRequestIdNode.IsNull())
     {
-      m_spotFleetRequestId = StringUtils::Trim(spotFleetRequestIdNode.GetText().c_str());
+      m_spotFleetRequestId = spotFleetRequestIdNode.GetTextView().Trim().ToString();
       m_spotFleetRequestIdHasBeenSet = true;
     }
     XmlNode spotFleetRequestStateNode = resultNode.FirstChild("spotFleetRequestState");
     if(!spotFleetRequestStateNode.IsNull())
     {
-      m_spotFleetRequestState = BatchStateMapper::GetBatchStateForName(StringUtils::Trim(spotFleetRequestStateNode.GetText().c_str()).c_str());
+      m_spotFleetRequestState = BatchStateMapper::GetBatchStateForName(spotFleetRequestStateNode.GetTextView().Trim().ToString().c_str());
       m_spotFleetRequestStateHasBeenSet = true;
     }
     XmlNode spotFleetRequestConfigNode = resultNode.FirstChild("spotFleetRequestConfig");
@@ -73,7 +74,7 @@ SpotFleetRequestConfig& SpotFleetRequestConfig::operator =(const XmlNode& xmlNod
     XmlNode createTimeNode = resultNode.FirstChild("createTime");
     if(!createTimeNode.IsNull())
     {
-      m_createTime = DateTime(StringUtils::Trim(createTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createTime = DateTime(createTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createTimeHasBeenSet = true;
     }
   }
@@ -85,7 +86,7 @@ void SpotFleetRequestConfig::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_spotFleetRequestIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SpotFleetRequestId=" << StringUtils::URLEncode(m_spotFleetRequestId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SpotFleetRequestId=" << StringUtils::URLEncoded(m_spotFleetRequestId) << "&";
   }
 
   if(m_spotFleetRequestStateHasBeenSet)
@@ -95,14 +96,14 @@ void SpotFleetRequestConfig::OutputToStream(Aws::OStream& oStream, const char* l
 
   if(m_spotFleetRequestConfigHasBeenSet)
   {
-      Aws::StringStream spotFleetRequestConfigLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream spotFleetRequestConfigLocationAndMemberSs;
       spotFleetRequestConfigLocationAndMemberSs << location << index << locationValue << ".SpotFleetRequestConfig";
-      m_spotFleetRequestConfig.OutputToStream(oStream, spotFleetRequestConfigLocationAndMemberSs.str().c_str());
+      m_spotFleetRequestConfig.OutputToStream(oStream, spotFleetRequestConfigLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_createTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreateTime=" << StringUtils::URLEncode(m_createTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreateTime=" << StringUtils::URLEncoded(m_createTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -111,7 +112,7 @@ void SpotFleetRequestConfig::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_spotFleetRequestIdHasBeenSet)
   {
-      oStream << location << ".SpotFleetRequestId=" << StringUtils::URLEncode(m_spotFleetRequestId.c_str()) << "&";
+      oStream << location << ".SpotFleetRequestId=" << StringUtils::URLEncoded(m_spotFleetRequestId) << "&";
   }
   if(m_spotFleetRequestStateHasBeenSet)
   {
@@ -125,7 +126,7 @@ void SpotFleetRequestConfig::OutputToStream(Aws::OStream& oStream, const char* l
   }
   if(m_createTimeHasBeenSet)
   {
-      oStream << location << ".CreateTime=" << StringUtils::URLEncode(m_createTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreateTime=" << StringUtils::URLEncoded(m_createTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -77,43 +78,43 @@ SpotFleetRequestConfigData& SpotFleetRequestConfigData::operator =(const XmlNode
     XmlNode clientTokenNode = resultNode.FirstChild("clientToken");
     if(!clientTokenNode.IsNull())
     {
-      m_clientToken = StringUtils::Trim(clientTokenNode.GetText().c_str());
+      m_clientToken = clientTokenNode.GetTextView().Trim().ToString();
       m_clientTokenHasBeenSet = true;
     }
     XmlNode spotPriceNode = resultNode.FirstChild("spotPrice");
     if(!spotPriceNode.IsNull())
     {
-      m_spotPrice = StringUtils::Trim(spotPriceNode.GetText().c_str());
+      m_spotPrice = spotPriceNode.GetTextView().Trim().ToString();
       m_spotPriceHasBeenSet = true;
     }
     XmlNode targetCapacityNode = resultNode.FirstChild("targetCapacity");
     if(!targetCapacityNode.IsNull())
     {
-      m_targetCapacity = StringUtils::ConvertToInt32(StringUtils::Trim(targetCapacityNode.GetText().c_str()).c_str());
+      m_targetCapacity = StringUtils::ConvertToInt32(targetCapacityNode.GetTextView().Trim().ToString().c_str());
       m_targetCapacityHasBeenSet = true;
     }
     XmlNode validFromNode = resultNode.FirstChild("validFrom");
     if(!validFromNode.IsNull())
     {
-      m_validFrom = DateTime(StringUtils::Trim(validFromNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_validFrom = DateTime(validFromNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_validFromHasBeenSet = true;
     }
     XmlNode validUntilNode = resultNode.FirstChild("validUntil");
     if(!validUntilNode.IsNull())
     {
-      m_validUntil = DateTime(StringUtils::Trim(validUntilNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_validUntil = DateTime(validUntilNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_validUntilHasBeenSet = true;
     }
     XmlNode terminateInstancesWithExpirationNode = resultNode.FirstChild("terminateInstancesWithExpiration");
     if(!terminateInstancesWithExpirationNode.IsNull())
     {
-      m_terminateInstancesWithExpiration = StringUtils::ConvertToBool(StringUtils::Trim(terminateInstancesWithExpirationNode.GetText().c_str()).c_str());
+      m_terminateInstancesWithExpiration = StringUtils::ConvertToBool(terminateInstancesWithExpirationNode.GetTextView().Trim().ToString().c_str());
       m_terminateInstancesWithExpirationHasBeenSet = true;
     }
     XmlNode iamFleetRoleNode = resultNode.FirstChild("iamFleetRole");
     if(!iamFleetRoleNode.IsNull())
     {
-      m_iamFleetRole = StringUtils::Trim(iamFleetRoleNode.GetText().c_str());
+      m_iamFleetRole = iamFleetRoleNode.GetTextView().Trim().ToString();
       m_iamFleetRoleHasBeenSet = true;
     }
     XmlNode launchSpecificationsNode = resultNode.FirstChild("launchSpecifications");
@@ -131,25 +132,25 @@ SpotFleetRequestConfigData& SpotFleetRequestConfigData::operator =(const XmlNode
     XmlNode excessCapacityTerminationPolicyNode = resultNode.FirstChild("excessCapacityTerminationPolicy");
     if(!excessCapacityTerminationPolicyNode.IsNull())
     {
-      m_excessCapacityTerminationPolicy = ExcessCapacityTerminationPolicyMapper::GetExcessCapacityTerminationPolicyForName(StringUtils::Trim(excessCapacityTerminationPolicyNode.GetText().c_str()).c_str());
+      m_excessCapacityTerminationPolicy = ExcessCapacityTerminationPolicyMapper::GetExcessCapacityTerminationPolicyForName(excessCapacityTerminationPolicyNode.GetTextView().Trim().ToString().c_str());
       m_excessCapacityTerminationPolicyHasBeenSet = true;
     }
     XmlNode allocationStrategyNode = resultNode.FirstChild("allocationStrategy");
     if(!allocationStrategyNode.IsNull())
     {
-      m_allocationStrategy = AllocationStrategyMapper::GetAllocationStrategyForName(StringUtils::Trim(allocationStrategyNode.GetText().c_str()).c_str());
+      m_allocationStrategy = AllocationStrategyMapper::GetAllocationStrategyForName(allocationStrategyNode.GetTextView().Trim().ToString().c_str());
       m_allocationStrategyHasBeenSet = true;
     }
     XmlNode fulfilledCapacityNode = resultNode.FirstChild("fulfilledCapacity");
     if(!fulfilledCapacityNode.IsNull())
     {
-      m_fulfilledCapacity = StringUtils::ConvertToDouble(StringUtils::Trim(fulfilledCapacityNode.GetText().c_str()).c_str());
+      m_fulfilledCapacity = StringUtils::ConvertToDouble(fulfilledCapacityNode.GetTextView().Trim().ToString().c_str());
       m_fulfilledCapacityHasBeenSet = true;
     }
     XmlNode typeNode = resultNode.FirstChild("type");
     if(!typeNode.IsNull())
     {
-      m_type = FleetTypeMapper::GetFleetTypeForName(StringUtils::Trim(typeNode.GetText().c_str()).c_str());
+      m_type = FleetTypeMapper::GetFleetTypeForName(typeNode.GetTextView().Trim().ToString().c_str());
       m_typeHasBeenSet = true;
     }
   }
@@ -161,12 +162,12 @@ void SpotFleetRequestConfigData::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_clientTokenHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
 
   if(m_spotPriceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SpotPrice=" << StringUtils::URLEncode(m_spotPrice.c_str()) << "&";
+      oStream << location << index << locationValue << ".SpotPrice=" << StringUtils::URLEncoded(m_spotPrice) << "&";
   }
 
   if(m_targetCapacityHasBeenSet)
@@ -176,12 +177,12 @@ void SpotFleetRequestConfigData::OutputToStream(Aws::OStream& oStream, const cha
 
   if(m_validFromHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ValidFrom=" << StringUtils::URLEncode(m_validFrom.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".ValidFrom=" << StringUtils::URLEncoded(m_validFrom.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_validUntilHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ValidUntil=" << StringUtils::URLEncode(m_validUntil.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".ValidUntil=" << StringUtils::URLEncoded(m_validUntil.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_terminateInstancesWithExpirationHasBeenSet)
@@ -191,7 +192,7 @@ void SpotFleetRequestConfigData::OutputToStream(Aws::OStream& oStream, const cha
 
   if(m_iamFleetRoleHasBeenSet)
   {
-      oStream << location << index << locationValue << ".IamFleetRole=" << StringUtils::URLEncode(m_iamFleetRole.c_str()) << "&";
+      oStream << location << index << locationValue << ".IamFleetRole=" << StringUtils::URLEncoded(m_iamFleetRole) << "&";
   }
 
   if(m_launchSpecificationsHasBeenSet)
@@ -199,9 +200,9 @@ void SpotFleetRequestConfigData::OutputToStream(Aws::OStream& oStream, const cha
       unsigned launchSpecificationsIdx = 1;
       for(auto& item : m_launchSpecifications)
       {
-        Aws::StringStream launchSpecificationsSs;
+        Aws::Utils::Stream::StringOutputStream launchSpecificationsSs;
         launchSpecificationsSs << location << index << locationValue << ".LaunchSpecifications." << launchSpecificationsIdx++;
-        item.OutputToStream(oStream, launchSpecificationsSs.str().c_str());
+        item.OutputToStream(oStream, launchSpecificationsSs.GetString().c_str());
       }
   }
 
@@ -231,11 +232,11 @@ void SpotFleetRequestConfigData::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_clientTokenHasBeenSet)
   {
-      oStream << location << ".ClientToken=" << StringUtils::URLEncode(m_clientToken.c_str()) << "&";
+      oStream << location << ".ClientToken=" << StringUtils::URLEncoded(m_clientToken) << "&";
   }
   if(m_spotPriceHasBeenSet)
   {
-      oStream << location << ".SpotPrice=" << StringUtils::URLEncode(m_spotPrice.c_str()) << "&";
+      oStream << location << ".SpotPrice=" << StringUtils::URLEncoded(m_spotPrice) << "&";
   }
   if(m_targetCapacityHasBeenSet)
   {
@@ -243,11 +244,11 @@ void SpotFleetRequestConfigData::OutputToStream(Aws::OStream& oStream, const cha
   }
   if(m_validFromHasBeenSet)
   {
-      oStream << location << ".ValidFrom=" << StringUtils::URLEncode(m_validFrom.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".ValidFrom=" << StringUtils::URLEncoded(m_validFrom.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_validUntilHasBeenSet)
   {
-      oStream << location << ".ValidUntil=" << StringUtils::URLEncode(m_validUntil.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".ValidUntil=" << StringUtils::URLEncoded(m_validUntil.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_terminateInstancesWithExpirationHasBeenSet)
   {
@@ -255,16 +256,16 @@ void SpotFleetRequestConfigData::OutputToStream(Aws::OStream& oStream, const cha
   }
   if(m_iamFleetRoleHasBeenSet)
   {
-      oStream << location << ".IamFleetRole=" << StringUtils::URLEncode(m_iamFleetRole.c_str()) << "&";
+      oStream << location << ".IamFleetRole=" << StringUtils::URLEncoded(m_iamFleetRole) << "&";
   }
   if(m_launchSpecificationsHasBeenSet)
   {
       unsigned launchSpecificationsIdx = 1;
       for(auto& item : m_launchSpecifications)
       {
-        Aws::StringStream launchSpecificationsSs;
+        Aws::Utils::Stream::StringOutputStream launchSpecificationsSs;
         launchSpecificationsSs << location <<  ".item." << launchSpecificationsIdx++;
-        item.OutputToStream(oStream, launchSpecificationsSs.str().c_str());
+        item.OutputToStream(oStream, launchSpecificationsSs.GetString().c_str());
       }
   }
   if(m_excessCapacityTerminationPolicyHasBeenSet)
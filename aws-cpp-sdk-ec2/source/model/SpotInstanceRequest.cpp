@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -85,25 +86,25 @@ SpotInstanceRequest& SpotInstanceRequest::operator =(const XmlNode& xmlNode)
     XmlNode spotInstanceRequestIdNode = resultNode.FirstChild("spotInstanceRequestId");
     if(!spotInstanceRequestIdNode.IsNull())
     {
-      m_spotInstanceRequestId = StringUtils::Trim(spotInstanceRequestIdNode.GetText().c_str());
+      m_spotInstanceRequestId = spotInstanceRequestIdNode.GetTextView().Trim().ToString();
       m_spotInstanceRequestIdHasBeenSet = true;
     }
     XmlNode spotPriceNode = resultNode.FirstChild("spotPrice");
     if(!spotPriceNode.IsNull())
     {
-      m_spotPrice = StringUtils::Trim(spotPriceNode.GetText().c_str());
+      m_spotPrice = spotPriceNode.GetTextView().Trim().ToString();
       m_spotPriceHasBeenSet = true;
     }
     XmlNode typeNode = resultNode.FirstChild("type");
     if(!typeNode.IsNull())
     {
-      m_type = SpotInstanceTypeMapper::GetSpotInstanceTypeForName(StringUtils::Trim(typeNode.GetText().c_str()).c_str());
+      m_type = SpotInstanceTypeMapper::GetSpotInstanceTypeForName(typeNode.GetTextView().Trim().ToString().c_str());
       m_typeHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = SpotInstanceStateMapper::GetSpotInstanceStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = SpotInstanceStateMapper::GetSpotInstanceStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode faultNode = resultNode.FirstChild("fault");
@@ -121,25 +122,25 @@ SpotInstanceRequest& SpotInstanceRequest::operator =(const XmlNode& xmlNode)
     XmlNode validFromNode = resultNode.FirstChild("validFrom");
     if(!validFromNode.IsNull())
     {
-      m_validFrom = DateTime(StringUtils::Trim(validFromNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_validFrom = DateTime(validFromNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_validFromHasBeenSet = true;
     }
     XmlNode validUntilNode = resultNode.FirstChild("validUntil");
     if(!validUntilNode.IsNull())
     {
-      m_validUntil = DateTime(StringUtils::Trim(validUntilNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_validUntil = DateTime(validUntilNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_validUntilHasBeenSet = true;
     }
     XmlNode launchGroupNode = resultNode.FirstChild("launchGroup");
     if(!launchGroupNode.IsNull())
     {
-      m_launchGroup = StringUtils::Trim(launchGroupNode.GetText().c_str());
+      m_launchGroup = launchGroupNode.GetTextView().Trim().ToString();
       m_launchGroupHasBeenSet = true;
     }
     XmlNode availabilityZoneGroupNode = resultNode.FirstChild("availabilityZoneGroup");
     if(!availabilityZoneGroupNode.IsNull())
     {
-      m_availabilityZoneGroup = StringUtils::Trim(availabilityZoneGroupNode.GetText().c_str());
+      m_availabilityZoneGroup = availabilityZoneGroupNode.GetTextView().Trim().ToString();
       m_availabilityZoneGroupHasBeenSet = true;
     }
     XmlNode launchSpecificationNode = resultNode.FirstChild("launchSpecification");
@@ -151,31 +152,31 @@ SpotInstanceRequest& SpotInstanceRequest::operator =(const XmlNode& xmlNode)
     XmlNode instanceIdNode = resultNode.FirstChild("instanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode createTimeNode = resultNode.FirstChild("createTime");
     if(!createTimeNode.IsNull())
     {
-      m_createTime = DateTime(StringUtils::Trim(createTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createTime = DateTime(createTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createTimeHasBeenSet = true;
     }
     XmlNode productDescriptionNode = resultNode.FirstChild("productDescription");
     if(!productDescriptionNode.IsNull())
     {
-      m_productDescription = RIProductDescriptionMapper::GetRIProductDescriptionForName(StringUtils::Trim(productDescriptionNode.GetText().c_str()).c_str());
+      m_productDescription = RIProductDescriptionMapper::GetRIProductDescriptionForName(productDescriptionNode.GetTextView().Trim().ToString().c_str());
       m_productDescriptionHasBeenSet = true;
     }
     XmlNode blockDurationMinutesNode = resultNode.FirstChild("blockDurationMinutes");
     if(!blockDurationMinutesNode.IsNull())
     {
-      m_blockDurationMinutes = StringUtils::ConvertToInt32(StringUtils::Trim(blockDurationMinutesNode.GetText().c_str()).c_str());
+      m_blockDurationMinutes = StringUtils::ConvertToInt32(blockDurationMinutesNode.GetTextView().Trim().ToString().c_str());
       m_blockDurationMinutesHasBeenSet = true;
     }
     XmlNode actualBlockHourlyPriceNode = resultNode.FirstChild("actualBlockHourlyPrice");
     if(!actualBlockHourlyPriceNode.IsNull())
     {
-      m_actualBlockHourlyPrice = StringUtils::Trim(actualBlockHourlyPriceNode.GetText().c_str());
+      m_actualBlockHourlyPrice = actualBlockHourlyPriceNode.GetTextView().Trim().ToString();
       m_actualBlockHourlyPriceHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("tagSet");
@@ -193,7 +194,7 @@ SpotInstanceRequest& SpotInstanceRequest::operator =(const XmlNode& xmlNode)
     XmlNode launchedAvailabilityZoneNode = resultNode.FirstChild("launchedAvailabilityZone");
     if(!launchedAvailabilityZoneNode.IsNull())
     {
-      m_launchedAvailabilityZone = StringUtils::Trim(launchedAvailabilityZoneNode.GetText().c_str());
+      m_launchedAvailabilityZone = launchedAvailabilityZoneNode.GetTextView().Trim().ToString();
       m_launchedAvailabilityZoneHasBeenSet = true;
     }
   }
@@ -205,12 +206,12 @@ void SpotInstanceRequest::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_spotInstanceRequestIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SpotInstanceRequestId=" << StringUtils::URLEncode(m_spotInstanceRequestId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SpotInstanceRequestId=" << StringUtils::URLEncoded(m_spotInstanceRequestId) << "&";
   }
 
   if(m_spotPriceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SpotPrice=" << StringUtils::URLEncode(m_spotPrice.c_str()) << "&";
+      oStream << location << index << locationValue << ".SpotPrice=" << StringUtils::URLEncoded(m_spotPrice) << "&";
   }
 
   if(m_typeHasBeenSet)
@@ -225,53 +226,53 @@ void SpotInstanceRequest::OutputToStream(Aws::OStream& oStream, const char* loca
 
   if(m_faultHasBeenSet)
   {
-      Aws::StringStream faultLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream faultLocationAndMemberSs;
       faultLocationAndMemberSs << location << index << locationValue << ".Fault";
-      m_fault.OutputToStream(oStream, faultLocationAndMemberSs.str().c_str());
+      m_fault.OutputToStream(oStream, faultLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_statusHasBeenSet)
   {
-      Aws::StringStream statusLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream statusLocationAndMemberSs;
       statusLocationAndMemberSs << location << index << locationValue << ".Status";
-      m_status.OutputToStream(oStream, statusLocationAndMemberSs.str().c_str());
+      m_status.OutputToStream(oStream, statusLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_validFromHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ValidFrom=" << StringUtils::URLEncode(m_validFrom.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".ValidFrom=" << StringUtils::URLEncoded(m_validFrom.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_validUntilHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ValidUntil=" << StringUtils::URLEncode(m_validUntil.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".ValidUntil=" << StringUtils::URLEncoded(m_validUntil.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_launchGroupHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LaunchGroup=" << StringUtils::URLEncode(m_launchGroup.c_str()) << "&";
+      oStream << location << index << locationValue << ".LaunchGroup=" << StringUtils::URLEncoded(m_launchGroup) << "&";
   }
 
   if(m_availabilityZoneGroupHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZoneGroup=" << StringUtils::URLEncode(m_availabilityZoneGroup.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZoneGroup=" << StringUtils::URLEncoded(m_availabilityZoneGroup) << "&";
   }
 
   if(m_launchSpecificationHasBeenSet)
   {
-      Aws::StringStream launchSpecificationLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream launchSpecificationLocationAndMemberSs;
       launchSpecificationLocationAndMemberSs << location << index << locationValue << ".LaunchSpecification";
-      m_launchSpecification.OutputToStream(oStream, launchSpecificationLocationAndMemberSs.str().c_str());
+      m_launchSpecification.OutputToStream(oStream, launchSpecificationLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_createTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreateTime=" << StringUtils::URLEncode(m_createTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreateTime=" << StringUtils::URLEncoded(m_createTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_productDescriptionHasBeenSet)
@@ -286,7 +287,7 @@ void SpotInstanceRequest::OutputToStream(Aws::OStream& oStream, const char* loca
 
   if(m_actualBlockHourlyPriceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ActualBlockHourlyPrice=" << StringUtils::URLEncode(m_actualBlockHourlyPrice.c_str()) << "&";
+      oStream << location << index << locationValue << ".ActualBlockHourlyPrice=" << StringUtils::URLEncoded(m_actualBlockHourlyPrice) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -294,15 +295,15 @@ void SpotInstanceRequest::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
   if(m_launchedAvailabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LaunchedAvailabilityZone=" << StringUtils::URLEncode(m_launchedAvailabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".LaunchedAvailabilityZone=" << StringUtils::URLEncoded(m_launchedAvailabilityZone) << "&";
   }
 
 }
@@ -311,11 +312,11 @@ void SpotInstanceRequest::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_spotInstanceRequestIdHasBeenSet)
   {
-      oStream << location << ".SpotInstanceRequestId=" << StringUtils::URLEncode(m_spotInstanceRequestId.c_str()) << "&";
+      oStream << location << ".SpotInstanceRequestId=" << StringUtils::URLEncoded(m_spotInstanceRequestId) << "&";
   }
   if(m_spotPriceHasBeenSet)
   {
-      oStream << location << ".SpotPrice=" << StringUtils::URLEncode(m_spotPrice.c_str()) << "&";
+      oStream << location << ".SpotPrice=" << StringUtils::URLEncoded(m_spotPrice) << "&";
   }
   if(m_typeHasBeenSet)
   {
@@ -339,19 +340,19 @@ void SpotInstanceRequest::OutputToStream(Aws::OStream& oStream, const char* loca
   }
   if(m_validFromHasBeenSet)
   {
-      oStream << location << ".ValidFrom=" << StringUtils::URLEncode(m_validFrom.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".ValidFrom=" << StringUtils::URLEncoded(m_validFrom.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_validUntilHasBeenSet)
   {
-      oStream << location << ".ValidUntil=" << StringUtils::URLEncode(m_validUntil.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".ValidUntil=" << StringUtils::URLEncoded(m_validUntil.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_launchGroupHasBeenSet)
   {
-      oStream << location << ".LaunchGroup=" << StringUtils::URLEncode(m_launchGroup.c_str()) << "&";
+      oStream << location << ".LaunchGroup=" << StringUtils::URLEncoded(m_launchGroup) << "&";
   }
   if(m_availabilityZoneGroupHasBeenSet)
   {
-      oStream << location << ".AvailabilityZoneGroup=" << StringUtils::URLEncode(m_availabilityZoneGroup.c_str()) << "&";
+      oStream << location << ".AvailabilityZoneGroup=" << StringUtils::URLEncoded(m_availabilityZoneGroup) << "&";
   }
   if(m_launchSpecificationHasBeenSet)
   {
@@ -361,11 +362,11 @@ void SpotInstanceRequest::OutputToStream(Aws::OStream& oStream, const char* loca
   }
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_createTimeHasBeenSet)
   {
-      oStream << location << ".CreateTime=" << StringUtils::URLEncode(m_createTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreateTime=" << StringUtils::URLEncoded(m_createTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_productDescriptionHasBeenSet)
   {
@@ -377,21 +378,21 @@ void SpotInstanceRequest::OutputToStream(Aws::OStream& oStream, const char* loca
   }
   if(m_actualBlockHourlyPriceHasBeenSet)
   {
-      oStream << location << ".ActualBlockHourlyPrice=" << StringUtils::URLEncode(m_actualBlockHourlyPrice.c_str()) << "&";
+      oStream << location << ".ActualBlockHourlyPrice=" << StringUtils::URLEncoded(m_actualBlockHourlyPrice) << "&";
   }
   if(m_tagsHasBeenSet)
   {
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
   if(m_launchedAvailabilityZoneHasBeenSet)
   {
-      oStream << location << ".LaunchedAvailabilityZone=" << StringUtils::URLEncode(m_launchedAvailabilityZone.c_str()) << "&";
+      oStream << location << ".LaunchedAvailabilityZone=" << StringUtils::URLEncoded(m_launchedAvailabilityZone) << "&";
   }
 }
 
@@ -29,36 +29,38 @@ namespace Aws
       namespace SpotInstanceStateMapper
       {
 
-        static const int open_HASH = HashingUtils::HashString("open");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int closed_HASH = HashingUtils::HashString("closed");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int failed_HASH = HashingUtils::HashString("failed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int open_HASH = 3417674;
+        static const int active_HASH = -1422950650;
+        static const int closed_HASH = -1357520532;
+        static const int cancelled_HASH = 476588369;
+        static const int failed_HASH = -1281977283;
 
 
         SpotInstanceState GetSpotInstanceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == open_HASH)
+          switch (hashCode)
           {
+          case open_HASH:
             return SpotInstanceState::open;
-          }
-          else if (hashCode == active_HASH)
-          {
+          case active_HASH:
             return SpotInstanceState::active;
-          }
-          else if (hashCode == closed_HASH)
-          {
+          case closed_HASH:
             return SpotInstanceState::closed;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
+          case cancelled_HASH:
             return SpotInstanceState::cancelled;
-          }
-          else if (hashCode == failed_HASH)
-          {
+          case failed_HASH:
             return SpotInstanceState::failed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
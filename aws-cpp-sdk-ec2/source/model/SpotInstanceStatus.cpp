@@ -53,19 +53,19 @@ SpotInstanceStatus& SpotInstanceStatus::operator =(const XmlNode& xmlNode)
     XmlNode codeNode = resultNode.FirstChild("code");
     if(!codeNode.IsNull())
     {
-      m_code = StringUtils::Trim(codeNode.GetText().c_str());
+      m_code = codeNode.GetTextView().Trim().ToString();
       m_codeHasBeenSet = true;
     }
     XmlNode updateTimeNode = resultNode.FirstChild("updateTime");
     if(!updateTimeNode.IsNull())
     {
-      m_updateTime = DateTime(StringUtils::Trim(updateTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_updateTime = DateTime(updateTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_updateTimeHasBeenSet = true;
     }
     XmlNode messageNode = resultNode.FirstChild("message");
     if(!messageNode.IsNull())
     {
-      m_message = StringUtils::Trim(messageNode.GetText().c_str());
+      m_message = messageNode.GetTextView().Trim().ToString();
       m_messageHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void SpotInstanceStatus::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_codeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Code=" << StringUtils::URLEncode(m_code.c_str()) << "&";
+      oStream << location << index << locationValue << ".Code=" << StringUtils::URLEncoded(m_code) << "&";
   }
 
   if(m_updateTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UpdateTime=" << StringUtils::URLEncode(m_updateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".UpdateTime=" << StringUtils::URLEncoded(m_updateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_messageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void SpotInstanceStatus::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_codeHasBeenSet)
   {
-      oStream << location << ".Code=" << StringUtils::URLEncode(m_code.c_str()) << "&";
+      oStream << location << ".Code=" << StringUtils::URLEncoded(m_code) << "&";
   }
   if(m_updateTimeHasBeenSet)
   {
-      oStream << location << ".UpdateTime=" << StringUtils::URLEncode(m_updateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".UpdateTime=" << StringUtils::URLEncoded(m_updateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_messageHasBeenSet)
   {
-      oStream << location << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 }
 
@@ -29,21 +29,29 @@ namespace Aws
       namespace SpotInstanceTypeMapper
       {
 
-        static const int one_time_HASH = HashingUtils::HashString("one-time");
-        static const int persistent_HASH = HashingUtils::HashString("persistent");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int one_time_HASH = 1956238804;
+        static const int persistent_HASH = 512462487;
 
 
         SpotInstanceType GetSpotInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == one_time_HASH)
+          switch (hashCode)
           {
+          case one_time_HASH:
             return SpotInstanceType::one_time;
-          }
-          else if (hashCode == persistent_HASH)
-          {
+          case persistent_HASH:
             return SpotInstanceType::persistent;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -63,13 +64,13 @@ StaleIpPermission& StaleIpPermission::operator =(const XmlNode& xmlNode)
     XmlNode fromPortNode = resultNode.FirstChild("fromPort");
     if(!fromPortNode.IsNull())
     {
-      m_fromPort = StringUtils::ConvertToInt32(StringUtils::Trim(fromPortNode.GetText().c_str()).c_str());
+      m_fromPort = StringUtils::ConvertToInt32(fromPortNode.GetTextView().Trim().ToString().c_str());
       m_fromPortHasBeenSet = true;
     }
     XmlNode ipProtocolNode = resultNode.FirstChild("ipProtocol");
     if(!ipProtocolNode.IsNull())
     {
-      m_ipProtocol = StringUtils::Trim(ipProtocolNode.GetText().c_str());
+      m_ipProtocol = ipProtocolNode.GetTextView().Trim().ToString();
       m_ipProtocolHasBeenSet = true;
     }
     XmlNode ipRangesNode = resultNode.FirstChild("ipRanges");
@@ -78,7 +79,7 @@ StaleIpPermission& StaleIpPermission::operator =(const XmlNode& xmlNode)
       XmlNode ipRangesMember = ipRangesNode.FirstChild("item");
       while(!ipRangesMember.IsNull())
       {
-        m_ipRanges.push_back(StringUtils::Trim(ipRangesMember.GetText().c_str()));
+        m_ipRanges.push_back(ipRangesMember.GetTextView().Trim().ToString());
         ipRangesMember = ipRangesMember.NextNode("item");
       }
 
@@ -90,7 +91,7 @@ StaleIpPermission& StaleIpPermission::operator =(const XmlNode& xmlNode)
       XmlNode prefixListIdsMember = prefixListIdsNode.FirstChild("item");
       while(!prefixListIdsMember.IsNull())
       {
-        m_prefixListIds.push_back(StringUtils::Trim(prefixListIdsMember.GetText().c_str()));
+        m_prefixListIds.push_back(prefixListIdsMember.GetTextView().Trim().ToString());
         prefixListIdsMember = prefixListIdsMember.NextNode("item");
       }
 
@@ -99,7 +100,7 @@ StaleIpPermission& StaleIpPermission::operator =(const XmlNode& xmlNode)
     XmlNode toPortNode = resultNode.FirstChild("toPort");
     if(!toPortNode.IsNull())
     {
-      m_toPort = StringUtils::ConvertToInt32(StringUtils::Trim(toPortNode.GetText().c_str()).c_str());
+      m_toPort = StringUtils::ConvertToInt32(toPortNode.GetTextView().Trim().ToString().c_str());
       m_toPortHasBeenSet = true;
     }
     XmlNode userIdGroupPairsNode = resultNode.FirstChild("groups");
@@ -128,7 +129,7 @@ void StaleIpPermission::OutputToStream(Aws::OStream& oStream, const char* locati
 
   if(m_ipProtocolHasBeenSet)
   {
-      oStream << location << index << locationValue << ".IpProtocol=" << StringUtils::URLEncode(m_ipProtocol.c_str()) << "&";
+      oStream << location << index << locationValue << ".IpProtocol=" << StringUtils::URLEncoded(m_ipProtocol) << "&";
   }
 
   if(m_ipRangesHasBeenSet)
@@ -136,7 +137,7 @@ void StaleIpPermission::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned ipRangesIdx = 1;
       for(auto& item : m_ipRanges)
       {
-        oStream << location << index << locationValue << ".IpRanges." << ipRangesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".IpRanges." << ipRangesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -145,7 +146,7 @@ void StaleIpPermission::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned prefixListIdsIdx = 1;
       for(auto& item : m_prefixListIds)
       {
-        oStream << location << index << locationValue << ".PrefixListIds." << prefixListIdsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".PrefixListIds." << prefixListIdsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -159,9 +160,9 @@ void StaleIpPermission::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned userIdGroupPairsIdx = 1;
       for(auto& item : m_userIdGroupPairs)
       {
-        Aws::StringStream userIdGroupPairsSs;
+        Aws::Utils::Stream::StringOutputStream userIdGroupPairsSs;
         userIdGroupPairsSs << location << index << locationValue << ".Groups." << userIdGroupPairsIdx++;
-        item.OutputToStream(oStream, userIdGroupPairsSs.str().c_str());
+        item.OutputToStream(oStream, userIdGroupPairsSs.GetString().c_str());
       }
   }
 
@@ -175,14 +176,14 @@ void StaleIpPermission::OutputToStream(Aws::OStream& oStream, const char* locati
   }
   if(m_ipProtocolHasBeenSet)
   {
-      oStream << location << ".IpProtocol=" << StringUtils::URLEncode(m_ipProtocol.c_str()) << "&";
+      oStream << location << ".IpProtocol=" << StringUtils::URLEncoded(m_ipProtocol) << "&";
   }
   if(m_ipRangesHasBeenSet)
   {
       unsigned ipRangesIdx = 1;
       for(auto& item : m_ipRanges)
       {
-        oStream << location << ".item." << ipRangesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".item." << ipRangesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_prefixListIdsHasBeenSet)
@@ -190,7 +191,7 @@ void StaleIpPermission::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned prefixListIdsIdx = 1;
       for(auto& item : m_prefixListIds)
       {
-        oStream << location << ".item." << prefixListIdsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".item." << prefixListIdsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_toPortHasBeenSet)
@@ -202,9 +203,9 @@ void StaleIpPermission::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned userIdGroupPairsIdx = 1;
       for(auto& item : m_userIdGroupPairs)
       {
-        Aws::StringStream userIdGroupPairsSs;
+        Aws::Utils::Stream::StringOutputStream userIdGroupPairsSs;
         userIdGroupPairsSs << location <<  ".item." << userIdGroupPairsIdx++;
-        item.OutputToStream(oStream, userIdGroupPairsSs.str().c_str());
+        item.OutputToStream(oStream, userIdGroupPairsSs.GetString().c_str());
       }
   }
 }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,25 +60,25 @@ StaleSecurityGroup& StaleSecurityGroup::operator =(const XmlNode& xmlNode)
     XmlNode groupIdNode = resultNode.FirstChild("groupId");
     if(!groupIdNode.IsNull())
     {
-      m_groupId = StringUtils::Trim(groupIdNode.GetText().c_str());
+      m_groupId = groupIdNode.GetTextView().Trim().ToString();
       m_groupIdHasBeenSet = true;
     }
     XmlNode groupNameNode = resultNode.FirstChild("groupName");
     if(!groupNameNode.IsNull())
     {
-      m_groupName = StringUtils::Trim(groupNameNode.GetText().c_str());
+      m_groupName = groupNameNode.GetTextView().Trim().ToString();
       m_groupNameHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("vpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode staleIpPermissionsNode = resultNode.FirstChild("staleIpPermissions");
@@ -113,22 +114,22 @@ void StaleSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_groupIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".GroupId=" << StringUtils::URLEncode(m_groupId.c_str()) << "&";
+      oStream << location << index << locationValue << ".GroupId=" << StringUtils::URLEncoded(m_groupId) << "&";
   }
 
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_staleIpPermissionsHasBeenSet)
@@ -136,9 +137,9 @@ void StaleSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* locat
       unsigned staleIpPermissionsIdx = 1;
       for(auto& item : m_staleIpPermissions)
       {
-        Aws::StringStream staleIpPermissionsSs;
+        Aws::Utils::Stream::StringOutputStream staleIpPermissionsSs;
         staleIpPermissionsSs << location << index << locationValue << ".StaleIpPermissions." << staleIpPermissionsIdx++;
-        item.OutputToStream(oStream, staleIpPermissionsSs.str().c_str());
+        item.OutputToStream(oStream, staleIpPermissionsSs.GetString().c_str());
       }
   }
 
@@ -147,9 +148,9 @@ void StaleSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* locat
       unsigned staleIpPermissionsEgressIdx = 1;
       for(auto& item : m_staleIpPermissionsEgress)
       {
-        Aws::StringStream staleIpPermissionsEgressSs;
+        Aws::Utils::Stream::StringOutputStream staleIpPermissionsEgressSs;
         staleIpPermissionsEgressSs << location << index << locationValue << ".StaleIpPermissionsEgress." << staleIpPermissionsEgressIdx++;
-        item.OutputToStream(oStream, staleIpPermissionsEgressSs.str().c_str());
+        item.OutputToStream(oStream, staleIpPermissionsEgressSs.GetString().c_str());
       }
   }
 
@@ -159,28 +160,28 @@ void StaleSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_groupIdHasBeenSet)
   {
-      oStream << location << ".GroupId=" << StringUtils::URLEncode(m_groupId.c_str()) << "&";
+      oStream << location << ".GroupId=" << StringUtils::URLEncoded(m_groupId) << "&";
   }
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_staleIpPermissionsHasBeenSet)
   {
       unsigned staleIpPermissionsIdx = 1;
       for(auto& item : m_staleIpPermissions)
       {
-        Aws::StringStream staleIpPermissionsSs;
+        Aws::Utils::Stream::StringOutputStream staleIpPermissionsSs;
         staleIpPermissionsSs << location <<  ".item." << staleIpPermissionsIdx++;
-        item.OutputToStream(oStream, staleIpPermissionsSs.str().c_str());
+        item.OutputToStream(oStream, staleIpPermissionsSs.GetString().c_str());
       }
   }
   if(m_staleIpPermissionsEgressHasBeenSet)
@@ -188,9 +189,9 @@ void StaleSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* locat
       unsigned staleIpPermissionsEgressIdx = 1;
       for(auto& item : m_staleIpPermissionsEgress)
       {
-        Aws::StringStream staleIpPermissionsEgressSs;
+        Aws::Utils::Stream::StringOutputStream staleIpPermissionsEgressSs;
         staleIpPermissionsEgressSs << location <<  ".item." << staleIpPermissionsEgressIdx++;
-        item.OutputToStream(oStream, staleIpPermissionsEgressSs.str().c_str());
+        item.OutputToStream(oStream, staleIpPermissionsEgressSs.GetString().c_str());
       }
   }
 }
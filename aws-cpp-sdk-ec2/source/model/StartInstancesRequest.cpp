@@ -15,6 +15,7 @@
 #include <aws/ec2/model/StartInstancesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ StartInstancesRequest::StartInstancesRequest() :
 
 Aws::String StartInstancesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=StartInstances&";
   if(m_instanceIdsHasBeenSet)
   {
@@ -37,14 +38,14 @@ Aws::String StartInstancesRequest::SerializePayload() const
     for(auto& item : m_instanceIds)
     {
       ss << "InstanceId." << instanceIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       instanceIdsCount++;
     }
   }
 
   if(m_additionalInfoHasBeenSet)
   {
-    ss << "AdditionalInfo=" << StringUtils::URLEncode(m_additionalInfo.c_str()) << "&";
+    ss << "AdditionalInfo=" << StringUtils::URLEncoded(m_additionalInfo) << "&";
   }
 
   if(m_dryRunHasBeenSet)
@@ -53,6 +54,6 @@ Aws::String StartInstancesRequest::SerializePayload() const
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
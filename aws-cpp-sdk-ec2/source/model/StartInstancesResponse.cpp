@@ -40,7 +40,7 @@ StartInstancesResponse& StartInstancesResponse::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "StartInstancesResponse")
+  if (rootNode.GetNameView() != "StartInstancesResponse")
   {
     resultNode = rootNode.FirstChild("StartInstancesResponse");
   }
@@ -29,31 +29,35 @@ namespace Aws
       namespace StateMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Available_HASH = HashingUtils::HashString("Available");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Pending_HASH = 982065527;
+        static const int Available_HASH = 1270065833;
+        static const int Deleting_HASH = 884361160;
+        static const int Deleted_HASH = -1079851015;
 
 
         State GetStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          switch (hashCode)
           {
+          case Pending_HASH:
             return State::Pending;
-          }
-          else if (hashCode == Available_HASH)
-          {
+          case Available_HASH:
             return State::Available;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
+          case Deleting_HASH:
             return State::Deleting;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
+          case Deleted_HASH:
             return State::Deleted;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
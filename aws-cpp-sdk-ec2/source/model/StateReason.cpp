@@ -51,13 +51,13 @@ StateReason& StateReason::operator =(const XmlNode& xmlNode)
     XmlNode codeNode = resultNode.FirstChild("code");
     if(!codeNode.IsNull())
     {
-      m_code = StringUtils::Trim(codeNode.GetText().c_str());
+      m_code = codeNode.GetTextView().Trim().ToString();
       m_codeHasBeenSet = true;
     }
     XmlNode messageNode = resultNode.FirstChild("message");
     if(!messageNode.IsNull())
     {
-      m_message = StringUtils::Trim(messageNode.GetText().c_str());
+      m_message = messageNode.GetTextView().Trim().ToString();
       m_messageHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void StateReason::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_codeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Code=" << StringUtils::URLEncode(m_code.c_str()) << "&";
+      oStream << location << index << locationValue << ".Code=" << StringUtils::URLEncoded(m_code) << "&";
   }
 
   if(m_messageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void StateReason::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_codeHasBeenSet)
   {
-      oStream << location << ".Code=" << StringUtils::URLEncode(m_code.c_str()) << "&";
+      oStream << location << ".Code=" << StringUtils::URLEncoded(m_code) << "&";
   }
   if(m_messageHasBeenSet)
   {
-      oStream << location << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 }
 
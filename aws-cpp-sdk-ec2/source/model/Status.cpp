@@ -29,26 +29,32 @@ namespace Aws
       namespace StatusMapper
       {
 
-        static const int MoveInProgress_HASH = HashingUtils::HashString("MoveInProgress");
-        static const int InVpc_HASH = HashingUtils::HashString("InVpc");
-        static const int InClassic_HASH = HashingUtils::HashString("InClassic");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int MoveInProgress_HASH = -886419133;
+        static const int InVpc_HASH = 70780260;
+        static const int InClassic_HASH = -2141274227;
 
 
         Status GetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MoveInProgress_HASH)
+          switch (hashCode)
           {
+          case MoveInProgress_HASH:
             return Status::MoveInProgress;
-          }
-          else if (hashCode == InVpc_HASH)
-          {
+          case InVpc_HASH:
             return Status::InVpc;
-          }
-          else if (hashCode == InClassic_HASH)
-          {
+          case InClassic_HASH:
             return Status::InClassic;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
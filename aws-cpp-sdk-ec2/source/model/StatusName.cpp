@@ -29,16 +29,26 @@ namespace Aws
       namespace StatusNameMapper
       {
 
-        static const int reachability_HASH = HashingUtils::HashString("reachability");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int reachability_HASH = -41098153;
 
 
         StatusName GetStatusNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == reachability_HASH)
+          switch (hashCode)
           {
+          case reachability_HASH:
             return StatusName::reachability;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,31 +29,35 @@ namespace Aws
       namespace StatusTypeMapper
       {
 
-        static const int passed_HASH = HashingUtils::HashString("passed");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int insufficient_data_HASH = HashingUtils::HashString("insufficient-data");
-        static const int initializing_HASH = HashingUtils::HashString("initializing");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int passed_HASH = -995381136;
+        static const int failed_HASH = -1281977283;
+        static const int insufficient_data_HASH = -1930904780;
+        static const int initializing_HASH = -400079795;
 
 
         StatusType GetStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == passed_HASH)
+          switch (hashCode)
           {
+          case passed_HASH:
             return StatusType::passed;
-          }
-          else if (hashCode == failed_HASH)
-          {
+          case failed_HASH:
             return StatusType::failed;
-          }
-          else if (hashCode == insufficient_data_HASH)
-          {
+          case insufficient_data_HASH:
             return StatusType::insufficient_data;
-          }
-          else if (hashCode == initializing_HASH)
-          {
+          case initializing_HASH:
             return StatusType::initializing;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -40,7 +40,7 @@ StopInstancesResponse& StopInstancesResponse::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "StopInstancesResponse")
+  if (rootNode.GetNameView() != "StopInstancesResponse")
   {
     resultNode = rootNode.FirstChild("StopInstancesResponse");
   }
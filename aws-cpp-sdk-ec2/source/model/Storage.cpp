@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,9 +62,9 @@ void Storage::OutputToStream(Aws::OStream& oStream, const char* location, unsign
 {
   if(m_s3HasBeenSet)
   {
-      Aws::StringStream s3LocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream s3LocationAndMemberSs;
       s3LocationAndMemberSs << location << index << locationValue << ".S3";
-      m_s3.OutputToStream(oStream, s3LocationAndMemberSs.str().c_str());
+      m_s3.OutputToStream(oStream, s3LocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -29,36 +29,38 @@ namespace Aws
       namespace SummaryStatusMapper
       {
 
-        static const int ok_HASH = HashingUtils::HashString("ok");
-        static const int impaired_HASH = HashingUtils::HashString("impaired");
-        static const int insufficient_data_HASH = HashingUtils::HashString("insufficient-data");
-        static const int not_applicable_HASH = HashingUtils::HashString("not-applicable");
-        static const int initializing_HASH = HashingUtils::HashString("initializing");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ok_HASH = 3548;
+        static const int impaired_HASH = -435567843;
+        static const int insufficient_data_HASH = -1930904780;
+        static const int not_applicable_HASH = 184902361;
+        static const int initializing_HASH = -400079795;
 
 
         SummaryStatus GetSummaryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ok_HASH)
+          switch (hashCode)
           {
+          case ok_HASH:
             return SummaryStatus::ok;
-          }
-          else if (hashCode == impaired_HASH)
-          {
+          case impaired_HASH:
             return SummaryStatus::impaired;
-          }
-          else if (hashCode == insufficient_data_HASH)
-          {
+          case insufficient_data_HASH:
             return SummaryStatus::insufficient_data;
-          }
-          else if (hashCode == not_applicable_HASH)
-          {
+          case not_applicable_HASH:
             return SummaryStatus::not_applicable;
-          }
-          else if (hashCode == initializing_HASH)
-          {
+          case initializing_HASH:
             return SummaryStatus::initializing;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
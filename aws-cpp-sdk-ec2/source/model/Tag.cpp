@@ -51,13 +51,13 @@ Tag& Tag::operator =(const XmlNode& xmlNode)
     XmlNode keyNode = resultNode.FirstChild("key");
     if(!keyNode.IsNull())
     {
-      m_key = StringUtils::Trim(keyNode.GetText().c_str());
+      m_key = keyNode.GetTextView().Trim().ToString();
       m_keyHasBeenSet = true;
     }
     XmlNode valueNode = resultNode.FirstChild("value");
     if(!valueNode.IsNull())
     {
-      m_value = StringUtils::Trim(valueNode.GetText().c_str());
+      m_value = valueNode.GetTextView().Trim().ToString();
       m_valueHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void Tag::OutputToStream(Aws::OStream& oStream, const char* location, unsigned i
 {
   if(m_keyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Key=" << StringUtils::URLEncode(m_key.c_str()) << "&";
+      oStream << location << index << locationValue << ".Key=" << StringUtils::URLEncoded(m_key) << "&";
   }
 
   if(m_valueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void Tag::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_keyHasBeenSet)
   {
-      oStream << location << ".Key=" << StringUtils::URLEncode(m_key.c_str()) << "&";
+      oStream << location << ".Key=" << StringUtils::URLEncoded(m_key) << "&";
   }
   if(m_valueHasBeenSet)
   {
-      oStream << location << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 }
 
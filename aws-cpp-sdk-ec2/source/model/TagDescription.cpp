@@ -55,25 +55,25 @@ TagDescription& TagDescription::operator =(const XmlNode& xmlNode)
     XmlNode resourceIdNode = resultNode.FirstChild("resourceId");
     if(!resourceIdNode.IsNull())
     {
-      m_resourceId = StringUtils::Trim(resourceIdNode.GetText().c_str());
+      m_resourceId = resourceIdNode.GetTextView().Trim().ToString();
       m_resourceIdHasBeenSet = true;
     }
     XmlNode resourceTypeNode = resultNode.FirstChild("resourceType");
     if(!resourceTypeNode.IsNull())
     {
-      m_resourceType = ResourceTypeMapper::GetResourceTypeForName(StringUtils::Trim(resourceTypeNode.GetText().c_str()).c_str());
+      m_resourceType = ResourceTypeMapper::GetResourceTypeForName(resourceTypeNode.GetTextView().Trim().ToString().c_str());
       m_resourceTypeHasBeenSet = true;
     }
     XmlNode keyNode = resultNode.FirstChild("key");
     if(!keyNode.IsNull())
     {
-      m_key = StringUtils::Trim(keyNode.GetText().c_str());
+      m_key = keyNode.GetTextView().Trim().ToString();
       m_keyHasBeenSet = true;
     }
     XmlNode valueNode = resultNode.FirstChild("value");
     if(!valueNode.IsNull())
     {
-      m_value = StringUtils::Trim(valueNode.GetText().c_str());
+      m_value = valueNode.GetTextView().Trim().ToString();
       m_valueHasBeenSet = true;
     }
   }
@@ -85,7 +85,7 @@ void TagDescription::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_resourceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceId=" << StringUtils::URLEncode(m_resourceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceId=" << StringUtils::URLEncoded(m_resourceId) << "&";
   }
 
   if(m_resourceTypeHasBeenSet)
@@ -95,12 +95,12 @@ void TagDescription::OutputToStream(Aws::OStream& oStream, const char* location,
 
   if(m_keyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Key=" << StringUtils::URLEncode(m_key.c_str()) << "&";
+      oStream << location << index << locationValue << ".Key=" << StringUtils::URLEncoded(m_key) << "&";
   }
 
   if(m_valueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 
 }
@@ -109,7 +109,7 @@ void TagDescription::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_resourceIdHasBeenSet)
   {
-      oStream << location << ".ResourceId=" << StringUtils::URLEncode(m_resourceId.c_str()) << "&";
+      oStream << location << ".ResourceId=" << StringUtils::URLEncoded(m_resourceId) << "&";
   }
   if(m_resourceTypeHasBeenSet)
   {
@@ -117,11 +117,11 @@ void TagDescription::OutputToStream(Aws::OStream& oStream, const char* location)
   }
   if(m_keyHasBeenSet)
   {
-      oStream << location << ".Key=" << StringUtils::URLEncode(m_key.c_str()) << "&";
+      oStream << location << ".Key=" << StringUtils::URLEncoded(m_key) << "&";
   }
   if(m_valueHasBeenSet)
   {
-      oStream << location << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 }
 
@@ -29,21 +29,29 @@ namespace Aws
       namespace TelemetryStatusMapper
       {
 
-        static const int UP_HASH = HashingUtils::HashString("UP");
-        static const int DOWN_HASH = HashingUtils::HashString("DOWN");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int UP_HASH = 2715;
+        static const int DOWN_HASH = 2104482;
 
 
         TelemetryStatus GetTelemetryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UP_HASH)
+          switch (hashCode)
           {
+          case UP_HASH:
             return TelemetryStatus::UP;
-          }
-          else if (hashCode == DOWN_HASH)
-          {
+          case DOWN_HASH:
             return TelemetryStatus::DOWN;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
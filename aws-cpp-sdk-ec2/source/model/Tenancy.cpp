@@ -29,26 +29,32 @@ namespace Aws
       namespace TenancyMapper
       {
 
-        static const int default__HASH = HashingUtils::HashString("default");
-        static const int dedicated_HASH = HashingUtils::HashString("dedicated");
-        static const int host_HASH = HashingUtils::HashString("host");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int default__HASH = 1544803905;
+        static const int dedicated_HASH = 1229913583;
+        static const int host_HASH = 3208616;
 
 
         Tenancy GetTenancyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == default__HASH)
+          switch (hashCode)
           {
+          case default__HASH:
             return Tenancy::default_;
-          }
-          else if (hashCode == dedicated_HASH)
-          {
+          case dedicated_HASH:
             return Tenancy::dedicated;
-          }
-          else if (hashCode == host_HASH)
-          {
+          case host_HASH:
             return Tenancy::host;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
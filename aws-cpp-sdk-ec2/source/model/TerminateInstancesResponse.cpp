@@ -40,7 +40,7 @@ TerminateInstancesResponse& TerminateInstancesResponse::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "TerminateInstancesResponse")
+  if (rootNode.GetNameView() != "TerminateInstancesResponse")
   {
     resultNode = rootNode.FirstChild("TerminateInstancesResponse");
   }
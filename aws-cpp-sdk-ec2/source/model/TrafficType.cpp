@@ -29,26 +29,32 @@ namespace Aws
       namespace TrafficTypeMapper
       {
 
-        static const int ACCEPT_HASH = HashingUtils::HashString("ACCEPT");
-        static const int REJECT_HASH = HashingUtils::HashString("REJECT");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ACCEPT_HASH = 1924835592;
+        static const int REJECT_HASH = -1881380961;
+        static const int ALL_HASH = 64897;
 
 
         TrafficType GetTrafficTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCEPT_HASH)
+          switch (hashCode)
           {
+          case ACCEPT_HASH:
             return TrafficType::ACCEPT;
-          }
-          else if (hashCode == REJECT_HASH)
-          {
+          case REJECT_HASH:
             return TrafficType::REJECT;
-          }
-          else if (hashCode == ALL_HASH)
-          {
+          case ALL_HASH:
             return TrafficType::ALL;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -15,6 +15,7 @@
 #include <aws/ec2/model/UnassignPrivateIpAddressesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::EC2::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ UnassignPrivateIpAddressesRequest::UnassignPrivateIpAddressesRequest() :
 
 Aws::String UnassignPrivateIpAddressesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UnassignPrivateIpAddresses&";
   if(m_networkInterfaceIdHasBeenSet)
   {
-    ss << "NetworkInterfaceId=" << StringUtils::URLEncode(m_networkInterfaceId.c_str()) << "&";
+    ss << "NetworkInterfaceId=" << StringUtils::URLEncoded(m_networkInterfaceId) << "&";
   }
 
   if(m_privateIpAddressesHasBeenSet)
@@ -40,12 +41,12 @@ Aws::String UnassignPrivateIpAddressesRequest::SerializePayload() const
     for(auto& item : m_privateIpAddresses)
     {
       ss << "PrivateIpAddress." << privateIpAddressesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       privateIpAddressesCount++;
     }
   }
 
   ss << "Version=2015-10-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ UnmonitorInstancesResponse& UnmonitorInstancesResponse::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "UnmonitorInstancesResponse")
+  if (rootNode.GetNameView() != "UnmonitorInstancesResponse")
   {
     resultNode = rootNode.FirstChild("UnmonitorInstancesResponse");
   }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -57,7 +58,7 @@ UnsuccessfulItem& UnsuccessfulItem::operator =(const XmlNode& xmlNode)
     XmlNode resourceIdNode = resultNode.FirstChild("resourceId");
     if(!resourceIdNode.IsNull())
     {
-      m_resourceId = StringUtils::Trim(resourceIdNode.GetText().c_str());
+      m_resourceId = resourceIdNode.GetTextView().Trim().ToString();
       m_resourceIdHasBeenSet = true;
     }
   }
@@ -69,14 +70,14 @@ void UnsuccessfulItem::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_errorHasBeenSet)
   {
-      Aws::StringStream errorLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream errorLocationAndMemberSs;
       errorLocationAndMemberSs << location << index << locationValue << ".Error";
-      m_error.OutputToStream(oStream, errorLocationAndMemberSs.str().c_str());
+      m_error.OutputToStream(oStream, errorLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_resourceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceId=" << StringUtils::URLEncode(m_resourceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceId=" << StringUtils::URLEncoded(m_resourceId) << "&";
   }
 
 }
@@ -91,7 +92,7 @@ void UnsuccessfulItem::OutputToStream(Aws::OStream& oStream, const char* locatio
   }
   if(m_resourceIdHasBeenSet)
   {
-      oStream << location << ".ResourceId=" << StringUtils::URLEncode(m_resourceId.c_str()) << "&";
+      oStream << location << ".ResourceId=" << StringUtils::URLEncoded(m_resourceId) << "&";
   }
 }
 
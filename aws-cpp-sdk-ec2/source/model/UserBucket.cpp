@@ -51,13 +51,13 @@ UserBucket& UserBucket::operator =(const XmlNode& xmlNode)
     XmlNode s3BucketNode = resultNode.FirstChild("S3Bucket");
     if(!s3BucketNode.IsNull())
     {
-      m_s3Bucket = StringUtils::Trim(s3BucketNode.GetText().c_str());
+      m_s3Bucket = s3BucketNode.GetTextView().Trim().ToString();
       m_s3BucketHasBeenSet = true;
     }
     XmlNode s3KeyNode = resultNode.FirstChild("S3Key");
     if(!s3KeyNode.IsNull())
     {
-      m_s3Key = StringUtils::Trim(s3KeyNode.GetText().c_str());
+      m_s3Key = s3KeyNode.GetTextView().Trim().ToString();
       m_s3KeyHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void UserBucket::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_s3BucketHasBeenSet)
   {
-      oStream << location << index << locationValue << ".S3Bucket=" << StringUtils::URLEncode(m_s3Bucket.c_str()) << "&";
+      oStream << location << index << locationValue << ".S3Bucket=" << StringUtils::URLEncoded(m_s3Bucket) << "&";
   }
 
   if(m_s3KeyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".S3Key=" << StringUtils::URLEncode(m_s3Key.c_str()) << "&";
+      oStream << location << index << locationValue << ".S3Key=" << StringUtils::URLEncoded(m_s3Key) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void UserBucket::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_s3BucketHasBeenSet)
   {
-      oStream << location << ".S3Bucket=" << StringUtils::URLEncode(m_s3Bucket.c_str()) << "&";
+      oStream << location << ".S3Bucket=" << StringUtils::URLEncoded(m_s3Bucket) << "&";
   }
   if(m_s3KeyHasBeenSet)
   {
-      oStream << location << ".S3Key=" << StringUtils::URLEncode(m_s3Key.c_str()) << "&";
+      oStream << location << ".S3Key=" << StringUtils::URLEncoded(m_s3Key) << "&";
   }
 }
 
@@ -49,7 +49,7 @@ UserData& UserData::operator =(const XmlNode& xmlNode)
     XmlNode dataNode = resultNode.FirstChild("data");
     if(!dataNode.IsNull())
     {
-      m_data = StringUtils::Trim(dataNode.GetText().c_str());
+      m_data = dataNode.GetTextView().Trim().ToString();
       m_dataHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void UserData::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 {
   if(m_dataHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Data=" << StringUtils::URLEncode(m_data.c_str()) << "&";
+      oStream << location << index << locationValue << ".Data=" << StringUtils::URLEncoded(m_data) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void UserData::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_dataHasBeenSet)
   {
-      oStream << location << ".Data=" << StringUtils::URLEncode(m_data.c_str()) << "&";
+      oStream << location << ".Data=" << StringUtils::URLEncoded(m_data) << "&";
   }
 }
 
@@ -59,31 +59,31 @@ VgwTelemetry& VgwTelemetry::operator =(const XmlNode& xmlNode)
     XmlNode outsideIpAddressNode = resultNode.FirstChild("outsideIpAddress");
     if(!outsideIpAddressNode.IsNull())
     {
-      m_outsideIpAddress = StringUtils::Trim(outsideIpAddressNode.GetText().c_str());
+      m_outsideIpAddress = outsideIpAddressNode.GetTextView().Trim().ToString();
       m_outsideIpAddressHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = TelemetryStatusMapper::GetTelemetryStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = TelemetryStatusMapper::GetTelemetryStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode lastStatusChangeNode = resultNode.FirstChild("lastStatusChange");
     if(!lastStatusChangeNode.IsNull())
     {
-      m_lastStatusChange = DateTime(StringUtils::Trim(lastStatusChangeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_lastStatusChange = DateTime(lastStatusChangeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_lastStatusChangeHasBeenSet = true;
     }
     XmlNode statusMessageNode = resultNode.FirstChild("statusMessage");
     if(!statusMessageNode.IsNull())
     {
-      m_statusMessage = StringUtils::Trim(statusMessageNode.GetText().c_str());
+      m_statusMessage = statusMessageNode.GetTextView().Trim().ToString();
       m_statusMessageHasBeenSet = true;
     }
     XmlNode acceptedRouteCountNode = resultNode.FirstChild("acceptedRouteCount");
     if(!acceptedRouteCountNode.IsNull())
     {
-      m_acceptedRouteCount = StringUtils::ConvertToInt32(StringUtils::Trim(acceptedRouteCountNode.GetText().c_str()).c_str());
+      m_acceptedRouteCount = StringUtils::ConvertToInt32(acceptedRouteCountNode.GetTextView().Trim().ToString().c_str());
       m_acceptedRouteCountHasBeenSet = true;
     }
   }
@@ -95,7 +95,7 @@ void VgwTelemetry::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_outsideIpAddressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OutsideIpAddress=" << StringUtils::URLEncode(m_outsideIpAddress.c_str()) << "&";
+      oStream << location << index << locationValue << ".OutsideIpAddress=" << StringUtils::URLEncoded(m_outsideIpAddress) << "&";
   }
 
   if(m_statusHasBeenSet)
@@ -105,12 +105,12 @@ void VgwTelemetry::OutputToStream(Aws::OStream& oStream, const char* location, u
 
   if(m_lastStatusChangeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LastStatusChange=" << StringUtils::URLEncode(m_lastStatusChange.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".LastStatusChange=" << StringUtils::URLEncoded(m_lastStatusChange.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << index << locationValue << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
 
   if(m_acceptedRouteCountHasBeenSet)
@@ -124,7 +124,7 @@ void VgwTelemetry::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_outsideIpAddressHasBeenSet)
   {
-      oStream << location << ".OutsideIpAddress=" << StringUtils::URLEncode(m_outsideIpAddress.c_str()) << "&";
+      oStream << location << ".OutsideIpAddress=" << StringUtils::URLEncoded(m_outsideIpAddress) << "&";
   }
   if(m_statusHasBeenSet)
   {
@@ -132,11 +132,11 @@ void VgwTelemetry::OutputToStream(Aws::OStream& oStream, const char* location) c
   }
   if(m_lastStatusChangeHasBeenSet)
   {
-      oStream << location << ".LastStatusChange=" << StringUtils::URLEncode(m_lastStatusChange.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".LastStatusChange=" << StringUtils::URLEncoded(m_lastStatusChange.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_statusMessageHasBeenSet)
   {
-      oStream << location << ".StatusMessage=" << StringUtils::URLEncode(m_statusMessage.c_str()) << "&";
+      oStream << location << ".StatusMessage=" << StringUtils::URLEncoded(m_statusMessage) << "&";
   }
   if(m_acceptedRouteCountHasBeenSet)
   {
@@ -29,21 +29,29 @@ namespace Aws
       namespace VirtualizationTypeMapper
       {
 
-        static const int hvm_HASH = HashingUtils::HashString("hvm");
-        static const int paravirtual_HASH = HashingUtils::HashString("paravirtual");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int hvm_HASH = 103711;
+        static const int paravirtual_HASH = 846634795;
 
 
         VirtualizationType GetVirtualizationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == hvm_HASH)
+          switch (hashCode)
           {
+          case hvm_HASH:
             return VirtualizationType::hvm;
-          }
-          else if (hashCode == paravirtual_HASH)
-          {
+          case paravirtual_HASH:
             return VirtualizationType::paravirtual;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -79,37 +80,37 @@ Volume& Volume::operator =(const XmlNode& xmlNode)
     XmlNode volumeIdNode = resultNode.FirstChild("volumeId");
     if(!volumeIdNode.IsNull())
     {
-      m_volumeId = StringUtils::Trim(volumeIdNode.GetText().c_str());
+      m_volumeId = volumeIdNode.GetTextView().Trim().ToString();
       m_volumeIdHasBeenSet = true;
     }
     XmlNode sizeNode = resultNode.FirstChild("size");
     if(!sizeNode.IsNull())
     {
-      m_size = StringUtils::ConvertToInt32(StringUtils::Trim(sizeNode.GetText().c_str()).c_str());
+      m_size = StringUtils::ConvertToInt32(sizeNode.GetTextView().Trim().ToString().c_str());
       m_sizeHasBeenSet = true;
     }
     XmlNode snapshotIdNode = resultNode.FirstChild("snapshotId");
     if(!snapshotIdNode.IsNull())
     {
-      m_snapshotId = StringUtils::Trim(snapshotIdNode.GetText().c_str());
+      m_snapshotId = snapshotIdNode.GetTextView().Trim().ToString();
       m_snapshotIdHasBeenSet = true;
     }
     XmlNode availabilityZoneNode = resultNode.FirstChild("availabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("status");
     if(!stateNode.IsNull())
     {
-      m_state = VolumeStateMapper::GetVolumeStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = VolumeStateMapper::GetVolumeStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode createTimeNode = resultNode.FirstChild("createTime");
     if(!createTimeNode.IsNull())
     {
-      m_createTime = DateTime(StringUtils::Trim(createTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createTime = DateTime(createTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createTimeHasBeenSet = true;
     }
     XmlNode attachmentsNode = resultNode.FirstChild("attachmentSet");
@@ -139,25 +140,25 @@ Volume& Volume::operator =(const XmlNode& xmlNode)
     XmlNode volumeTypeNode = resultNode.FirstChild("volumeType");
     if(!volumeTypeNode.IsNull())
     {
-      m_volumeType = VolumeTypeMapper::GetVolumeTypeForName(StringUtils::Trim(volumeTypeNode.GetText().c_str()).c_str());
+      m_volumeType = VolumeTypeMapper::GetVolumeTypeForName(volumeTypeNode.GetTextView().Trim().ToString().c_str());
       m_volumeTypeHasBeenSet = true;
     }
     XmlNode iopsNode = resultNode.FirstChild("iops");
     if(!iopsNode.IsNull())
     {
-      m_iops = StringUtils::ConvertToInt32(StringUtils::Trim(iopsNode.GetText().c_str()).c_str());
+      m_iops = StringUtils::ConvertToInt32(iopsNode.GetTextView().Trim().ToString().c_str());
       m_iopsHasBeenSet = true;
     }
     XmlNode encryptedNode = resultNode.FirstChild("encrypted");
     if(!encryptedNode.IsNull())
     {
-      m_encrypted = StringUtils::ConvertToBool(StringUtils::Trim(encryptedNode.GetText().c_str()).c_str());
+      m_encrypted = StringUtils::ConvertToBool(encryptedNode.GetTextView().Trim().ToString().c_str());
       m_encryptedHasBeenSet = true;
     }
     XmlNode kmsKeyIdNode = resultNode.FirstChild("kmsKeyId");
     if(!kmsKeyIdNode.IsNull())
     {
-      m_kmsKeyId = StringUtils::Trim(kmsKeyIdNode.GetText().c_str());
+      m_kmsKeyId = kmsKeyIdNode.GetTextView().Trim().ToString();
       m_kmsKeyIdHasBeenSet = true;
     }
   }
@@ -169,7 +170,7 @@ void Volume::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
 {
   if(m_volumeIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VolumeId=" << StringUtils::URLEncode(m_volumeId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VolumeId=" << StringUtils::URLEncoded(m_volumeId) << "&";
   }
 
   if(m_sizeHasBeenSet)
@@ -179,12 +180,12 @@ void Volume::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
 
   if(m_snapshotIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotId=" << StringUtils::URLEncode(m_snapshotId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotId=" << StringUtils::URLEncoded(m_snapshotId) << "&";
   }
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_stateHasBeenSet)
@@ -194,7 +195,7 @@ void Volume::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
 
   if(m_createTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreateTime=" << StringUtils::URLEncode(m_createTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreateTime=" << StringUtils::URLEncoded(m_createTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_attachmentsHasBeenSet)
@@ -202,9 +203,9 @@ void Volume::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
       unsigned attachmentsIdx = 1;
       for(auto& item : m_attachments)
       {
-        Aws::StringStream attachmentsSs;
+        Aws::Utils::Stream::StringOutputStream attachmentsSs;
         attachmentsSs << location << index << locationValue << ".AttachmentSet." << attachmentsIdx++;
-        item.OutputToStream(oStream, attachmentsSs.str().c_str());
+        item.OutputToStream(oStream, attachmentsSs.GetString().c_str());
       }
   }
 
@@ -213,9 +214,9 @@ void Volume::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -236,14 +237,14 @@ void Volume::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
 
   if(m_kmsKeyIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+      oStream << location << index << locationValue << ".KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
 
   if(m_responseMetadataHasBeenSet)
   {
-      Aws::StringStream responseMetadataLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream responseMetadataLocationAndMemberSs;
       responseMetadataLocationAndMemberSs << location << index << locationValue << ".ResponseMetadata";
-      m_responseMetadata.OutputToStream(oStream, responseMetadataLocationAndMemberSs.str().c_str());
+      m_responseMetadata.OutputToStream(oStream, responseMetadataLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -252,7 +253,7 @@ void Volume::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_volumeIdHasBeenSet)
   {
-      oStream << location << ".VolumeId=" << StringUtils::URLEncode(m_volumeId.c_str()) << "&";
+      oStream << location << ".VolumeId=" << StringUtils::URLEncoded(m_volumeId) << "&";
   }
   if(m_sizeHasBeenSet)
   {
@@ -260,11 +261,11 @@ void Volume::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_snapshotIdHasBeenSet)
   {
-      oStream << location << ".SnapshotId=" << StringUtils::URLEncode(m_snapshotId.c_str()) << "&";
+      oStream << location << ".SnapshotId=" << StringUtils::URLEncoded(m_snapshotId) << "&";
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_stateHasBeenSet)
   {
@@ -272,16 +273,16 @@ void Volume::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_createTimeHasBeenSet)
   {
-      oStream << location << ".CreateTime=" << StringUtils::URLEncode(m_createTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreateTime=" << StringUtils::URLEncoded(m_createTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_attachmentsHasBeenSet)
   {
       unsigned attachmentsIdx = 1;
       for(auto& item : m_attachments)
       {
-        Aws::StringStream attachmentsSs;
+        Aws::Utils::Stream::StringOutputStream attachmentsSs;
         attachmentsSs << location <<  ".item." << attachmentsIdx++;
-        item.OutputToStream(oStream, attachmentsSs.str().c_str());
+        item.OutputToStream(oStream, attachmentsSs.GetString().c_str());
       }
   }
   if(m_tagsHasBeenSet)
@@ -289,9 +290,9 @@ void Volume::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
   if(m_volumeTypeHasBeenSet)
@@ -308,7 +309,7 @@ void Volume::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_kmsKeyIdHasBeenSet)
   {
-      oStream << location << ".KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+      oStream << location << ".KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
   if(m_responseMetadataHasBeenSet)
   {
@@ -29,31 +29,35 @@ namespace Aws
       namespace VolumeAttachmentStateMapper
       {
 
-        static const int attaching_HASH = HashingUtils::HashString("attaching");
-        static const int attached_HASH = HashingUtils::HashString("attached");
-        static const int detaching_HASH = HashingUtils::HashString("detaching");
-        static const int detached_HASH = HashingUtils::HashString("detached");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int attaching_HASH = -478984323;
+        static const int attached_HASH = 538738084;
+        static const int detaching_HASH = -1978731665;
+        static const int detached_HASH = 1044548466;
 
 
         VolumeAttachmentState GetVolumeAttachmentStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == attaching_HASH)
+          switch (hashCode)
           {
+          case attaching_HASH:
             return VolumeAttachmentState::attaching;
-          }
-          else if (hashCode == attached_HASH)
-          {
+          case attached_HASH:
             return VolumeAttachmentState::attached;
-          }
-          else if (hashCode == detaching_HASH)
-          {
+          case detaching_HASH:
             return VolumeAttachmentState::detaching;
-          }
-          else if (hashCode == detached_HASH)
-          {
+          case detached_HASH:
             return VolumeAttachmentState::detached;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace VolumeAttributeNameMapper
       {
 
-        static const int autoEnableIO_HASH = HashingUtils::HashString("autoEnableIO");
-        static const int productCodes_HASH = HashingUtils::HashString("productCodes");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int autoEnableIO_HASH = 1468333240;
+        static const int productCodes_HASH = 988549239;
 
 
         VolumeAttributeName GetVolumeAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == autoEnableIO_HASH)
+          switch (hashCode)
           {
+          case autoEnableIO_HASH:
             return VolumeAttributeName::autoEnableIO;
-          }
-          else if (hashCode == productCodes_HASH)
-          {
+          case productCodes_HASH:
             return VolumeAttributeName::productCodes;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
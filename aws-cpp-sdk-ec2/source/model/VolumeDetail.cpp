@@ -51,7 +51,7 @@ VolumeDetail& VolumeDetail::operator =(const XmlNode& xmlNode)
     XmlNode sizeNode = resultNode.FirstChild("size");
     if(!sizeNode.IsNull())
     {
-      m_size = StringUtils::ConvertToInt64(StringUtils::Trim(sizeNode.GetText().c_str()).c_str());
+      m_size = StringUtils::ConvertToInt64(sizeNode.GetTextView().Trim().ToString().c_str());
       m_sizeHasBeenSet = true;
     }
   }
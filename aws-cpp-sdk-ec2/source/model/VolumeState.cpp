@@ -29,41 +29,41 @@ namespace Aws
       namespace VolumeStateMapper
       {
 
-        static const int creating_HASH = HashingUtils::HashString("creating");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int in_use_HASH = HashingUtils::HashString("in-use");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-        static const int error_HASH = HashingUtils::HashString("error");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int creating_HASH = 1820421817;
+        static const int available_HASH = -733902135;
+        static const int in_use_HASH = -1185862433;
+        static const int deleting_HASH = 819717032;
+        static const int deleted_HASH = 1550463001;
+        static const int error_HASH = 96784904;
 
 
         VolumeState GetVolumeStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == creating_HASH)
+          switch (hashCode)
           {
+          case creating_HASH:
             return VolumeState::creating;
-          }
-          else if (hashCode == available_HASH)
-          {
+          case available_HASH:
             return VolumeState::available;
-          }
-          else if (hashCode == in_use_HASH)
-          {
+          case in_use_HASH:
             return VolumeState::in_use;
-          }
-          else if (hashCode == deleting_HASH)
-          {
+          case deleting_HASH:
             return VolumeState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
+          case deleted_HASH:
             return VolumeState::deleted;
-          }
-          else if (hashCode == error_HASH)
-          {
+          case error_HASH:
             return VolumeState::error;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -55,25 +55,25 @@ VolumeStatusAction& VolumeStatusAction::operator =(const XmlNode& xmlNode)
     XmlNode codeNode = resultNode.FirstChild("code");
     if(!codeNode.IsNull())
     {
-      m_code = StringUtils::Trim(codeNode.GetText().c_str());
+      m_code = codeNode.GetTextView().Trim().ToString();
       m_codeHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode eventTypeNode = resultNode.FirstChild("eventType");
     if(!eventTypeNode.IsNull())
     {
-      m_eventType = StringUtils::Trim(eventTypeNode.GetText().c_str());
+      m_eventType = eventTypeNode.GetTextView().Trim().ToString();
       m_eventTypeHasBeenSet = true;
     }
     XmlNode eventIdNode = resultNode.FirstChild("eventId");
     if(!eventIdNode.IsNull())
     {
-      m_eventId = StringUtils::Trim(eventIdNode.GetText().c_str());
+      m_eventId = eventIdNode.GetTextView().Trim().ToString();
       m_eventIdHasBeenSet = true;
     }
   }
@@ -85,22 +85,22 @@ void VolumeStatusAction::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_codeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Code=" << StringUtils::URLEncode(m_code.c_str()) << "&";
+      oStream << location << index << locationValue << ".Code=" << StringUtils::URLEncoded(m_code) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_eventTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EventType=" << StringUtils::URLEncode(m_eventType.c_str()) << "&";
+      oStream << location << index << locationValue << ".EventType=" << StringUtils::URLEncoded(m_eventType) << "&";
   }
 
   if(m_eventIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EventId=" << StringUtils::URLEncode(m_eventId.c_str()) << "&";
+      oStream << location << index << locationValue << ".EventId=" << StringUtils::URLEncoded(m_eventId) << "&";
   }
 
 }
@@ -109,19 +109,19 @@ void VolumeStatusAction::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_codeHasBeenSet)
   {
-      oStream << location << ".Code=" << StringUtils::URLEncode(m_code.c_str()) << "&";
+      oStream << location << ".Code=" << StringUtils::URLEncoded(m_code) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_eventTypeHasBeenSet)
   {
-      oStream << location << ".EventType=" << StringUtils::URLEncode(m_eventType.c_str()) << "&";
+      oStream << location << ".EventType=" << StringUtils::URLEncoded(m_eventType) << "&";
   }
   if(m_eventIdHasBeenSet)
   {
-      oStream << location << ".EventId=" << StringUtils::URLEncode(m_eventId.c_str()) << "&";
+      oStream << location << ".EventId=" << StringUtils::URLEncoded(m_eventId) << "&";
   }
 }
 
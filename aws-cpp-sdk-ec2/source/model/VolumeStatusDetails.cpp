@@ -51,13 +51,13 @@ VolumeStatusDetails& VolumeStatusDetails::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("name");
     if(!nameNode.IsNull())
     {
-      m_name = VolumeStatusNameMapper::GetVolumeStatusNameForName(StringUtils::Trim(nameNode.GetText().c_str()).c_str());
+      m_name = VolumeStatusNameMapper::GetVolumeStatusNameForName(nameNode.GetTextView().Trim().ToString().c_str());
       m_nameHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
   }
@@ -74,7 +74,7 @@ void VolumeStatusDetails::OutputToStream(Aws::OStream& oStream, const char* loca
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
 }
@@ -87,7 +87,7 @@ void VolumeStatusDetails::OutputToStream(Aws::OStream& oStream, const char* loca
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 }
 
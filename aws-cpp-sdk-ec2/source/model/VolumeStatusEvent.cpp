@@ -57,31 +57,31 @@ VolumeStatusEvent& VolumeStatusEvent::operator =(const XmlNode& xmlNode)
     XmlNode eventTypeNode = resultNode.FirstChild("eventType");
     if(!eventTypeNode.IsNull())
     {
-      m_eventType = StringUtils::Trim(eventTypeNode.GetText().c_str());
+      m_eventType = eventTypeNode.GetTextView().Trim().ToString();
       m_eventTypeHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode notBeforeNode = resultNode.FirstChild("notBefore");
     if(!notBeforeNode.IsNull())
     {
-      m_notBefore = DateTime(StringUtils::Trim(notBeforeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_notBefore = DateTime(notBeforeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_notBeforeHasBeenSet = true;
     }
     XmlNode notAfterNode = resultNode.FirstChild("notAfter");
     if(!notAfterNode.IsNull())
     {
-      m_notAfter = DateTime(StringUtils::Trim(notAfterNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_notAfter = DateTime(notAfterNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_notAfterHasBeenSet = true;
     }
     XmlNode eventIdNode = resultNode.FirstChild("eventId");
     if(!eventIdNode.IsNull())
     {
-      m_eventId = StringUtils::Trim(eventIdNode.GetText().c_str());
+      m_eventId = eventIdNode.GetTextView().Trim().ToString();
       m_eventIdHasBeenSet = true;
     }
   }
@@ -93,27 +93,27 @@ void VolumeStatusEvent::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_eventTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EventType=" << StringUtils::URLEncode(m_eventType.c_str()) << "&";
+      oStream << location << index << locationValue << ".EventType=" << StringUtils::URLEncoded(m_eventType) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_notBeforeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NotBefore=" << StringUtils::URLEncode(m_notBefore.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".NotBefore=" << StringUtils::URLEncoded(m_notBefore.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_notAfterHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NotAfter=" << StringUtils::URLEncode(m_notAfter.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".NotAfter=" << StringUtils::URLEncoded(m_notAfter.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_eventIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EventId=" << StringUtils::URLEncode(m_eventId.c_str()) << "&";
+      oStream << location << index << locationValue << ".EventId=" << StringUtils::URLEncoded(m_eventId) << "&";
   }
 
 }
@@ -122,23 +122,23 @@ void VolumeStatusEvent::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_eventTypeHasBeenSet)
   {
-      oStream << location << ".EventType=" << StringUtils::URLEncode(m_eventType.c_str()) << "&";
+      oStream << location << ".EventType=" << StringUtils::URLEncoded(m_eventType) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_notBeforeHasBeenSet)
   {
-      oStream << location << ".NotBefore=" << StringUtils::URLEncode(m_notBefore.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".NotBefore=" << StringUtils::URLEncoded(m_notBefore.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_notAfterHasBeenSet)
   {
-      oStream << location << ".NotAfter=" << StringUtils::URLEncode(m_notAfter.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".NotAfter=" << StringUtils::URLEncoded(m_notAfter.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_eventIdHasBeenSet)
   {
-      oStream << location << ".EventId=" << StringUtils::URLEncode(m_eventId.c_str()) << "&";
+      oStream << location << ".EventId=" << StringUtils::URLEncoded(m_eventId) << "&";
   }
 }
 
@@ -29,26 +29,32 @@ namespace Aws
       namespace VolumeStatusInfoStatusMapper
       {
 
-        static const int ok_HASH = HashingUtils::HashString("ok");
-        static const int impaired_HASH = HashingUtils::HashString("impaired");
-        static const int insufficient_data_HASH = HashingUtils::HashString("insufficient-data");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ok_HASH = 3548;
+        static const int impaired_HASH = -435567843;
+        static const int insufficient_data_HASH = -1930904780;
 
 
         VolumeStatusInfoStatus GetVolumeStatusInfoStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ok_HASH)
+          switch (hashCode)
           {
+          case ok_HASH:
             return VolumeStatusInfoStatus::ok;
-          }
-          else if (hashCode == impaired_HASH)
-          {
+          case impaired_HASH:
             return VolumeStatusInfoStatus::impaired;
-          }
-          else if (hashCode == insufficient_data_HASH)
-          {
+          case insufficient_data_HASH:
             return VolumeStatusInfoStatus::insufficient_data;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
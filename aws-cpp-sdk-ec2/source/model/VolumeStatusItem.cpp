@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -57,13 +58,13 @@ VolumeStatusItem& VolumeStatusItem::operator =(const XmlNode& xmlNode)
     XmlNode volumeIdNode = resultNode.FirstChild("volumeId");
     if(!volumeIdNode.IsNull())
     {
-      m_volumeId = StringUtils::Trim(volumeIdNode.GetText().c_str());
+      m_volumeId = volumeIdNode.GetTextView().Trim().ToString();
       m_volumeIdHasBeenSet = true;
     }
     XmlNode availabilityZoneNode = resultNode.FirstChild("availabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode volumeStatusNode = resultNode.FirstChild("volumeStatus");
@@ -105,19 +106,19 @@ void VolumeStatusItem::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_volumeIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VolumeId=" << StringUtils::URLEncode(m_volumeId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VolumeId=" << StringUtils::URLEncoded(m_volumeId) << "&";
   }
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_volumeStatusHasBeenSet)
   {
-      Aws::StringStream volumeStatusLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream volumeStatusLocationAndMemberSs;
       volumeStatusLocationAndMemberSs << location << index << locationValue << ".VolumeStatus";
-      m_volumeStatus.OutputToStream(oStream, volumeStatusLocationAndMemberSs.str().c_str());
+      m_volumeStatus.OutputToStream(oStream, volumeStatusLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_eventsHasBeenSet)
@@ -125,9 +126,9 @@ void VolumeStatusItem::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned eventsIdx = 1;
       for(auto& item : m_events)
       {
-        Aws::StringStream eventsSs;
+        Aws::Utils::Stream::StringOutputStream eventsSs;
         eventsSs << location << index << locationValue << ".EventsSet." << eventsIdx++;
-        item.OutputToStream(oStream, eventsSs.str().c_str());
+        item.OutputToStream(oStream, eventsSs.GetString().c_str());
       }
   }
 
@@ -136,9 +137,9 @@ void VolumeStatusItem::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned actionsIdx = 1;
       for(auto& item : m_actions)
       {
-        Aws::StringStream actionsSs;
+        Aws::Utils::Stream::StringOutputStream actionsSs;
         actionsSs << location << index << locationValue << ".ActionsSet." << actionsIdx++;
-        item.OutputToStream(oStream, actionsSs.str().c_str());
+        item.OutputToStream(oStream, actionsSs.GetString().c_str());
       }
   }
 
@@ -148,11 +149,11 @@ void VolumeStatusItem::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_volumeIdHasBeenSet)
   {
-      oStream << location << ".VolumeId=" << StringUtils::URLEncode(m_volumeId.c_str()) << "&";
+      oStream << location << ".VolumeId=" << StringUtils::URLEncoded(m_volumeId) << "&";
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_volumeStatusHasBeenSet)
   {
@@ -165,9 +166,9 @@ void VolumeStatusItem::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned eventsIdx = 1;
       for(auto& item : m_events)
       {
-        Aws::StringStream eventsSs;
+        Aws::Utils::Stream::StringOutputStream eventsSs;
         eventsSs << location <<  ".item." << eventsIdx++;
-        item.OutputToStream(oStream, eventsSs.str().c_str());
+        item.OutputToStream(oStream, eventsSs.GetString().c_str());
       }
   }
   if(m_actionsHasBeenSet)
@@ -175,9 +176,9 @@ void VolumeStatusItem::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned actionsIdx = 1;
       for(auto& item : m_actions)
       {
-        Aws::StringStream actionsSs;
+        Aws::Utils::Stream::StringOutputStream actionsSs;
         actionsSs << location <<  ".item." << actionsIdx++;
-        item.OutputToStream(oStream, actionsSs.str().c_str());
+        item.OutputToStream(oStream, actionsSs.GetString().c_str());
       }
   }
 }
@@ -29,21 +29,29 @@ namespace Aws
       namespace VolumeStatusNameMapper
       {
 
-        static const int io_enabled_HASH = HashingUtils::HashString("io-enabled");
-        static const int io_performance_HASH = HashingUtils::HashString("io-performance");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int io_enabled_HASH = 1584395674;
+        static const int io_performance_HASH = 281323017;
 
 
         VolumeStatusName GetVolumeStatusNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == io_enabled_HASH)
+          switch (hashCode)
           {
+          case io_enabled_HASH:
             return VolumeStatusName::io_enabled;
-          }
-          else if (hashCode == io_performance_HASH)
-          {
+          case io_performance_HASH:
             return VolumeStatusName::io_performance;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -63,25 +64,25 @@ Vpc& Vpc::operator =(const XmlNode& xmlNode)
     XmlNode vpcIdNode = resultNode.FirstChild("vpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = VpcStateMapper::GetVpcStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = VpcStateMapper::GetVpcStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode cidrBlockNode = resultNode.FirstChild("cidrBlock");
     if(!cidrBlockNode.IsNull())
     {
-      m_cidrBlock = StringUtils::Trim(cidrBlockNode.GetText().c_str());
+      m_cidrBlock = cidrBlockNode.GetTextView().Trim().ToString();
       m_cidrBlockHasBeenSet = true;
     }
     XmlNode dhcpOptionsIdNode = resultNode.FirstChild("dhcpOptionsId");
     if(!dhcpOptionsIdNode.IsNull())
     {
-      m_dhcpOptionsId = StringUtils::Trim(dhcpOptionsIdNode.GetText().c_str());
+      m_dhcpOptionsId = dhcpOptionsIdNode.GetTextView().Trim().ToString();
       m_dhcpOptionsIdHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("tagSet");
@@ -99,13 +100,13 @@ Vpc& Vpc::operator =(const XmlNode& xmlNode)
     XmlNode instanceTenancyNode = resultNode.FirstChild("instanceTenancy");
     if(!instanceTenancyNode.IsNull())
     {
-      m_instanceTenancy = TenancyMapper::GetTenancyForName(StringUtils::Trim(instanceTenancyNode.GetText().c_str()).c_str());
+      m_instanceTenancy = TenancyMapper::GetTenancyForName(instanceTenancyNode.GetTextView().Trim().ToString().c_str());
       m_instanceTenancyHasBeenSet = true;
     }
     XmlNode isDefaultNode = resultNode.FirstChild("isDefault");
     if(!isDefaultNode.IsNull())
     {
-      m_isDefault = StringUtils::ConvertToBool(StringUtils::Trim(isDefaultNode.GetText().c_str()).c_str());
+      m_isDefault = StringUtils::ConvertToBool(isDefaultNode.GetTextView().Trim().ToString().c_str());
       m_isDefaultHasBeenSet = true;
     }
   }
@@ -117,7 +118,7 @@ void Vpc::OutputToStream(Aws::OStream& oStream, const char* location, unsigned i
 {
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_stateHasBeenSet)
@@ -127,12 +128,12 @@ void Vpc::OutputToStream(Aws::OStream& oStream, const char* location, unsigned i
 
   if(m_cidrBlockHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CidrBlock=" << StringUtils::URLEncode(m_cidrBlock.c_str()) << "&";
+      oStream << location << index << locationValue << ".CidrBlock=" << StringUtils::URLEncoded(m_cidrBlock) << "&";
   }
 
   if(m_dhcpOptionsIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DhcpOptionsId=" << StringUtils::URLEncode(m_dhcpOptionsId.c_str()) << "&";
+      oStream << location << index << locationValue << ".DhcpOptionsId=" << StringUtils::URLEncoded(m_dhcpOptionsId) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -140,9 +141,9 @@ void Vpc::OutputToStream(Aws::OStream& oStream, const char* location, unsigned i
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -162,7 +163,7 @@ void Vpc::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_stateHasBeenSet)
   {
@@ -170,20 +171,20 @@ void Vpc::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_cidrBlockHasBeenSet)
   {
-      oStream << location << ".CidrBlock=" << StringUtils::URLEncode(m_cidrBlock.c_str()) << "&";
+      oStream << location << ".CidrBlock=" << StringUtils::URLEncoded(m_cidrBlock) << "&";
   }
   if(m_dhcpOptionsIdHasBeenSet)
   {
-      oStream << location << ".DhcpOptionsId=" << StringUtils::URLEncode(m_dhcpOptionsId.c_str()) << "&";
+      oStream << location << ".DhcpOptionsId=" << StringUtils::URLEncoded(m_dhcpOptionsId) << "&";
   }
   if(m_tagsHasBeenSet)
   {
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
   if(m_instanceTenancyHasBeenSet)
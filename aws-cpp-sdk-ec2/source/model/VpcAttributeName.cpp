@@ -29,21 +29,29 @@ namespace Aws
       namespace VpcAttributeNameMapper
       {
 
-        static const int enableDnsSupport_HASH = HashingUtils::HashString("enableDnsSupport");
-        static const int enableDnsHostnames_HASH = HashingUtils::HashString("enableDnsHostnames");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int enableDnsSupport_HASH = -1293001655;
+        static const int enableDnsHostnames_HASH = -2013212518;
 
 
         VpcAttributeName GetVpcAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == enableDnsSupport_HASH)
+          switch (hashCode)
           {
+          case enableDnsSupport_HASH:
             return VpcAttributeName::enableDnsSupport;
-          }
-          else if (hashCode == enableDnsHostnames_HASH)
-          {
+          case enableDnsHostnames_HASH:
             return VpcAttributeName::enableDnsHostnames;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
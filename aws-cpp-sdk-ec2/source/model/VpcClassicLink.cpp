@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -55,13 +56,13 @@ VpcClassicLink& VpcClassicLink::operator =(const XmlNode& xmlNode)
     XmlNode vpcIdNode = resultNode.FirstChild("vpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode classicLinkEnabledNode = resultNode.FirstChild("classicLinkEnabled");
     if(!classicLinkEnabledNode.IsNull())
     {
-      m_classicLinkEnabled = StringUtils::ConvertToBool(StringUtils::Trim(classicLinkEnabledNode.GetText().c_str()).c_str());
+      m_classicLinkEnabled = StringUtils::ConvertToBool(classicLinkEnabledNode.GetTextView().Trim().ToString().c_str());
       m_classicLinkEnabledHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("tagSet");
@@ -85,7 +86,7 @@ void VpcClassicLink::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_classicLinkEnabledHasBeenSet)
@@ -98,9 +99,9 @@ void VpcClassicLink::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -110,7 +111,7 @@ void VpcClassicLink::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_classicLinkEnabledHasBeenSet)
   {
@@ -121,9 +122,9 @@ void VpcClassicLink::OutputToStream(Aws::OStream& oStream, const char* location)
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
@@ -61,31 +61,31 @@ VpcEndpoint& VpcEndpoint::operator =(const XmlNode& xmlNode)
     XmlNode vpcEndpointIdNode = resultNode.FirstChild("vpcEndpointId");
     if(!vpcEndpointIdNode.IsNull())
     {
-      m_vpcEndpointId = StringUtils::Trim(vpcEndpointIdNode.GetText().c_str());
+      m_vpcEndpointId = vpcEndpointIdNode.GetTextView().Trim().ToString();
       m_vpcEndpointIdHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("vpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode serviceNameNode = resultNode.FirstChild("serviceName");
     if(!serviceNameNode.IsNull())
     {
-      m_serviceName = StringUtils::Trim(serviceNameNode.GetText().c_str());
+      m_serviceName = serviceNameNode.GetTextView().Trim().ToString();
       m_serviceNameHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = StateMapper::GetStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = StateMapper::GetStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode policyDocumentNode = resultNode.FirstChild("policyDocument");
     if(!policyDocumentNode.IsNull())
     {
-      m_policyDocument = StringUtils::Trim(policyDocumentNode.GetText().c_str());
+      m_policyDocument = policyDocumentNode.GetTextView().Trim().ToString();
       m_policyDocumentHasBeenSet = true;
     }
     XmlNode routeTableIdsNode = resultNode.FirstChild("routeTableIdSet");
@@ -94,7 +94,7 @@ VpcEndpoint& VpcEndpoint::operator =(const XmlNode& xmlNode)
       XmlNode routeTableIdsMember = routeTableIdsNode.FirstChild("item");
       while(!routeTableIdsMember.IsNull())
       {
-        m_routeTableIds.push_back(StringUtils::Trim(routeTableIdsMember.GetText().c_str()));
+        m_routeTableIds.push_back(routeTableIdsMember.GetTextView().Trim().ToString());
         routeTableIdsMember = routeTableIdsMember.NextNode("item");
       }
 
@@ -103,7 +103,7 @@ VpcEndpoint& VpcEndpoint::operator =(const XmlNode& xmlNode)
     XmlNode creationTimestampNode = resultNode.FirstChild("creationTimestamp");
     if(!creationTimestampNode.IsNull())
     {
-      m_creationTimestamp = DateTime(StringUtils::Trim(creationTimestampNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_creationTimestamp = DateTime(creationTimestampNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_creationTimestampHasBeenSet = true;
     }
   }
@@ -115,17 +115,17 @@ void VpcEndpoint::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_vpcEndpointIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcEndpointId=" << StringUtils::URLEncode(m_vpcEndpointId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcEndpointId=" << StringUtils::URLEncoded(m_vpcEndpointId) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_serviceNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ServiceName=" << StringUtils::URLEncode(m_serviceName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ServiceName=" << StringUtils::URLEncoded(m_serviceName) << "&";
   }
 
   if(m_stateHasBeenSet)
@@ -135,7 +135,7 @@ void VpcEndpoint::OutputToStream(Aws::OStream& oStream, const char* location, un
 
   if(m_policyDocumentHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PolicyDocument=" << StringUtils::URLEncode(m_policyDocument.c_str()) << "&";
+      oStream << location << index << locationValue << ".PolicyDocument=" << StringUtils::URLEncoded(m_policyDocument) << "&";
   }
 
   if(m_routeTableIdsHasBeenSet)
@@ -143,13 +143,13 @@ void VpcEndpoint::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned routeTableIdsIdx = 1;
       for(auto& item : m_routeTableIds)
       {
-        oStream << location << index << locationValue << ".RouteTableIdSet." << routeTableIdsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".RouteTableIdSet." << routeTableIdsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
   if(m_creationTimestampHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreationTimestamp=" << StringUtils::URLEncode(m_creationTimestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreationTimestamp=" << StringUtils::URLEncoded(m_creationTimestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -158,15 +158,15 @@ void VpcEndpoint::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_vpcEndpointIdHasBeenSet)
   {
-      oStream << location << ".VpcEndpointId=" << StringUtils::URLEncode(m_vpcEndpointId.c_str()) << "&";
+      oStream << location << ".VpcEndpointId=" << StringUtils::URLEncoded(m_vpcEndpointId) << "&";
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_serviceNameHasBeenSet)
   {
-      oStream << location << ".ServiceName=" << StringUtils::URLEncode(m_serviceName.c_str()) << "&";
+      oStream << location << ".ServiceName=" << StringUtils::URLEncoded(m_serviceName) << "&";
   }
   if(m_stateHasBeenSet)
   {
@@ -174,19 +174,19 @@ void VpcEndpoint::OutputToStream(Aws::OStream& oStream, const char* location) co
   }
   if(m_policyDocumentHasBeenSet)
   {
-      oStream << location << ".PolicyDocument=" << StringUtils::URLEncode(m_policyDocument.c_str()) << "&";
+      oStream << location << ".PolicyDocument=" << StringUtils::URLEncoded(m_policyDocument) << "&";
   }
   if(m_routeTableIdsHasBeenSet)
   {
       unsigned routeTableIdsIdx = 1;
       for(auto& item : m_routeTableIds)
       {
-        oStream << location << ".item." << routeTableIdsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".item." << routeTableIdsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_creationTimestampHasBeenSet)
   {
-      oStream << location << ".CreationTimestamp=" << StringUtils::URLEncode(m_creationTimestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreationTimestamp=" << StringUtils::URLEncoded(m_creationTimestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -65,7 +66,7 @@ VpcPeeringConnection& VpcPeeringConnection::operator =(const XmlNode& xmlNode)
     XmlNode expirationTimeNode = resultNode.FirstChild("expirationTime");
     if(!expirationTimeNode.IsNull())
     {
-      m_expirationTime = DateTime(StringUtils::Trim(expirationTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_expirationTime = DateTime(expirationTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_expirationTimeHasBeenSet = true;
     }
     XmlNode requesterVpcInfoNode = resultNode.FirstChild("requesterVpcInfo");
@@ -95,7 +96,7 @@ VpcPeeringConnection& VpcPeeringConnection::operator =(const XmlNode& xmlNode)
     XmlNode vpcPeeringConnectionIdNode = resultNode.FirstChild("vpcPeeringConnectionId");
     if(!vpcPeeringConnectionIdNode.IsNull())
     {
-      m_vpcPeeringConnectionId = StringUtils::Trim(vpcPeeringConnectionIdNode.GetText().c_str());
+      m_vpcPeeringConnectionId = vpcPeeringConnectionIdNode.GetTextView().Trim().ToString();
       m_vpcPeeringConnectionIdHasBeenSet = true;
     }
   }
@@ -107,28 +108,28 @@ void VpcPeeringConnection::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_accepterVpcInfoHasBeenSet)
   {
-      Aws::StringStream accepterVpcInfoLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream accepterVpcInfoLocationAndMemberSs;
       accepterVpcInfoLocationAndMemberSs << location << index << locationValue << ".AccepterVpcInfo";
-      m_accepterVpcInfo.OutputToStream(oStream, accepterVpcInfoLocationAndMemberSs.str().c_str());
+      m_accepterVpcInfo.OutputToStream(oStream, accepterVpcInfoLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_expirationTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ExpirationTime=" << StringUtils::URLEncode(m_expirationTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".ExpirationTime=" << StringUtils::URLEncoded(m_expirationTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_requesterVpcInfoHasBeenSet)
   {
-      Aws::StringStream requesterVpcInfoLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream requesterVpcInfoLocationAndMemberSs;
       requesterVpcInfoLocationAndMemberSs << location << index << locationValue << ".RequesterVpcInfo";
-      m_requesterVpcInfo.OutputToStream(oStream, requesterVpcInfoLocationAndMemberSs.str().c_str());
+      m_requesterVpcInfo.OutputToStream(oStream, requesterVpcInfoLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_statusHasBeenSet)
   {
-      Aws::StringStream statusLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream statusLocationAndMemberSs;
       statusLocationAndMemberSs << location << index << locationValue << ".Status";
-      m_status.OutputToStream(oStream, statusLocationAndMemberSs.str().c_str());
+      m_status.OutputToStream(oStream, statusLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_tagsHasBeenSet)
@@ -136,15 +137,15 @@ void VpcPeeringConnection::OutputToStream(Aws::OStream& oStream, const char* loc
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
   if(m_vpcPeeringConnectionIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcPeeringConnectionId=" << StringUtils::URLEncode(m_vpcPeeringConnectionId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcPeeringConnectionId=" << StringUtils::URLEncoded(m_vpcPeeringConnectionId) << "&";
   }
 
 }
@@ -159,7 +160,7 @@ void VpcPeeringConnection::OutputToStream(Aws::OStream& oStream, const char* loc
   }
   if(m_expirationTimeHasBeenSet)
   {
-      oStream << location << ".ExpirationTime=" << StringUtils::URLEncode(m_expirationTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".ExpirationTime=" << StringUtils::URLEncoded(m_expirationTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_requesterVpcInfoHasBeenSet)
   {
@@ -178,14 +179,14 @@ void VpcPeeringConnection::OutputToStream(Aws::OStream& oStream, const char* loc
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
   if(m_vpcPeeringConnectionIdHasBeenSet)
   {
-      oStream << location << ".VpcPeeringConnectionId=" << StringUtils::URLEncode(m_vpcPeeringConnectionId.c_str()) << "&";
+      oStream << location << ".VpcPeeringConnectionId=" << StringUtils::URLEncoded(m_vpcPeeringConnectionId) << "&";
   }
 }
 
@@ -55,13 +55,13 @@ VpcPeeringConnectionOptionsDescription& VpcPeeringConnectionOptionsDescription::
     XmlNode allowEgressFromLocalClassicLinkToRemoteVpcNode = resultNode.FirstChild("allowEgressFromLocalClassicLinkToRemoteVpc");
     if(!allowEgressFromLocalClassicLinkToRemoteVpcNode.IsNull())
     {
-      m_allowEgressFromLocalClassicLinkToRemoteVpc = StringUtils::ConvertToBool(StringUtils::Trim(allowEgressFromLocalClassicLinkToRemoteVpcNode.GetText().c_str()).c_str());
+      m_allowEgressFromLocalClassicLinkToRemoteVpc = StringUtils::ConvertToBool(allowEgressFromLocalClassicLinkToRemoteVpcNode.GetTextView().Trim().ToString().c_str());
       m_allowEgressFromLocalClassicLinkToRemoteVpcHasBeenSet = true;
     }
     XmlNode allowEgressFromLocalVpcToRemoteClassicLinkNode = resultNode.FirstChild("allowEgressFromLocalVpcToRemoteClassicLink");
     if(!allowEgressFromLocalVpcToRemoteClassicLinkNode.IsNull())
     {
-      m_allowEgressFromLocalVpcToRemoteClassicLink = StringUtils::ConvertToBool(StringUtils::Trim(allowEgressFromLocalVpcToRemoteClassicLinkNode.GetText().c_str()).c_str());
+      m_allowEgressFromLocalVpcToRemoteClassicLink = StringUtils::ConvertToBool(allowEgressFromLocalVpcToRemoteClassicLinkNode.GetTextView().Trim().ToString().c_str());
       m_allowEgressFromLocalVpcToRemoteClassicLinkHasBeenSet = true;
     }
   }
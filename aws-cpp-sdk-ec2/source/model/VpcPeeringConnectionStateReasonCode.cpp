@@ -29,56 +29,50 @@ namespace Aws
       namespace VpcPeeringConnectionStateReasonCodeMapper
       {
 
-        static const int initiating_request_HASH = HashingUtils::HashString("initiating-request");
-        static const int pending_acceptance_HASH = HashingUtils::HashString("pending-acceptance");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-        static const int rejected_HASH = HashingUtils::HashString("rejected");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int expired_HASH = HashingUtils::HashString("expired");
-        static const int provisioning_HASH = HashingUtils::HashString("provisioning");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int initiating_request_HASH = 972541144;
+        static const int pending_acceptance_HASH = -183533491;
+        static const int active_HASH = -1422950650;
+        static const int deleted_HASH = 1550463001;
+        static const int rejected_HASH = -608496514;
+        static const int failed_HASH = -1281977283;
+        static const int expired_HASH = -1309235419;
+        static const int provisioning_HASH = 121098989;
+        static const int deleting_HASH = 819717032;
 
 
         VpcPeeringConnectionStateReasonCode GetVpcPeeringConnectionStateReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == initiating_request_HASH)
+          switch (hashCode)
           {
+          case initiating_request_HASH:
             return VpcPeeringConnectionStateReasonCode::initiating_request;
-          }
-          else if (hashCode == pending_acceptance_HASH)
-          {
+          case pending_acceptance_HASH:
             return VpcPeeringConnectionStateReasonCode::pending_acceptance;
-          }
-          else if (hashCode == active_HASH)
-          {
+          case active_HASH:
             return VpcPeeringConnectionStateReasonCode::active;
-          }
-          else if (hashCode == deleted_HASH)
-          {
+          case deleted_HASH:
             return VpcPeeringConnectionStateReasonCode::deleted;
-          }
-          else if (hashCode == rejected_HASH)
-          {
+          case rejected_HASH:
             return VpcPeeringConnectionStateReasonCode::rejected;
-          }
-          else if (hashCode == failed_HASH)
-          {
+          case failed_HASH:
             return VpcPeeringConnectionStateReasonCode::failed;
-          }
-          else if (hashCode == expired_HASH)
-          {
+          case expired_HASH:
             return VpcPeeringConnectionStateReasonCode::expired;
-          }
-          else if (hashCode == provisioning_HASH)
-          {
+          case provisioning_HASH:
             return VpcPeeringConnectionStateReasonCode::provisioning;
-          }
-          else if (hashCode == deleting_HASH)
-          {
+          case deleting_HASH:
             return VpcPeeringConnectionStateReasonCode::deleting;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -67,37 +68,37 @@ VpnConnection& VpnConnection::operator =(const XmlNode& xmlNode)
     XmlNode vpnConnectionIdNode = resultNode.FirstChild("vpnConnectionId");
     if(!vpnConnectionIdNode.IsNull())
     {
-      m_vpnConnectionId = StringUtils::Trim(vpnConnectionIdNode.GetText().c_str());
+      m_vpnConnectionId = vpnConnectionIdNode.GetTextView().Trim().ToString();
       m_vpnConnectionIdHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = VpnStateMapper::GetVpnStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = VpnStateMapper::GetVpnStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode customerGatewayConfigurationNode = resultNode.FirstChild("customerGatewayConfiguration");
     if(!customerGatewayConfigurationNode.IsNull())
     {
-      m_customerGatewayConfiguration = StringUtils::Trim(customerGatewayConfigurationNode.GetText().c_str());
+      m_customerGatewayConfiguration = customerGatewayConfigurationNode.GetTextView().Trim().ToString();
       m_customerGatewayConfigurationHasBeenSet = true;
     }
     XmlNode typeNode = resultNode.FirstChild("type");
     if(!typeNode.IsNull())
     {
-      m_type = GatewayTypeMapper::GetGatewayTypeForName(StringUtils::Trim(typeNode.GetText().c_str()).c_str());
+      m_type = GatewayTypeMapper::GetGatewayTypeForName(typeNode.GetTextView().Trim().ToString().c_str());
       m_typeHasBeenSet = true;
     }
     XmlNode customerGatewayIdNode = resultNode.FirstChild("customerGatewayId");
     if(!customerGatewayIdNode.IsNull())
     {
-      m_customerGatewayId = StringUtils::Trim(customerGatewayIdNode.GetText().c_str());
+      m_customerGatewayId = customerGatewayIdNode.GetTextView().Trim().ToString();
       m_customerGatewayIdHasBeenSet = true;
     }
     XmlNode vpnGatewayIdNode = resultNode.FirstChild("vpnGatewayId");
     if(!vpnGatewayIdNode.IsNull())
     {
-      m_vpnGatewayId = StringUtils::Trim(vpnGatewayIdNode.GetText().c_str());
+      m_vpnGatewayId = vpnGatewayIdNode.GetTextView().Trim().ToString();
       m_vpnGatewayIdHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("tagSet");
@@ -151,7 +152,7 @@ void VpnConnection::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_vpnConnectionIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpnConnectionId=" << StringUtils::URLEncode(m_vpnConnectionId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpnConnectionId=" << StringUtils::URLEncoded(m_vpnConnectionId) << "&";
   }
 
   if(m_stateHasBeenSet)
@@ -161,7 +162,7 @@ void VpnConnection::OutputToStream(Aws::OStream& oStream, const char* location,
 
   if(m_customerGatewayConfigurationHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CustomerGatewayConfiguration=" << StringUtils::URLEncode(m_customerGatewayConfiguration.c_str()) << "&";
+      oStream << location << index << locationValue << ".CustomerGatewayConfiguration=" << StringUtils::URLEncoded(m_customerGatewayConfiguration) << "&";
   }
 
   if(m_typeHasBeenSet)
@@ -171,12 +172,12 @@ void VpnConnection::OutputToStream(Aws::OStream& oStream, const char* location,
 
   if(m_customerGatewayIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CustomerGatewayId=" << StringUtils::URLEncode(m_customerGatewayId.c_str()) << "&";
+      oStream << location << index << locationValue << ".CustomerGatewayId=" << StringUtils::URLEncoded(m_customerGatewayId) << "&";
   }
 
   if(m_vpnGatewayIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpnGatewayId=" << StringUtils::URLEncode(m_vpnGatewayId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpnGatewayId=" << StringUtils::URLEncoded(m_vpnGatewayId) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -184,9 +185,9 @@ void VpnConnection::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -195,17 +196,17 @@ void VpnConnection::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned vgwTelemetryIdx = 1;
       for(auto& item : m_vgwTelemetry)
       {
-        Aws::StringStream vgwTelemetrySs;
+        Aws::Utils::Stream::StringOutputStream vgwTelemetrySs;
         vgwTelemetrySs << location << index << locationValue << ".VgwTelemetry." << vgwTelemetryIdx++;
-        item.OutputToStream(oStream, vgwTelemetrySs.str().c_str());
+        item.OutputToStream(oStream, vgwTelemetrySs.GetString().c_str());
       }
   }
 
   if(m_optionsHasBeenSet)
   {
-      Aws::StringStream optionsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream optionsLocationAndMemberSs;
       optionsLocationAndMemberSs << location << index << locationValue << ".Options";
-      m_options.OutputToStream(oStream, optionsLocationAndMemberSs.str().c_str());
+      m_options.OutputToStream(oStream, optionsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_routesHasBeenSet)
@@ -213,9 +214,9 @@ void VpnConnection::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned routesIdx = 1;
       for(auto& item : m_routes)
       {
-        Aws::StringStream routesSs;
+        Aws::Utils::Stream::StringOutputStream routesSs;
         routesSs << location << index << locationValue << ".Routes." << routesIdx++;
-        item.OutputToStream(oStream, routesSs.str().c_str());
+        item.OutputToStream(oStream, routesSs.GetString().c_str());
       }
   }
 
@@ -225,7 +226,7 @@ void VpnConnection::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_vpnConnectionIdHasBeenSet)
   {
-      oStream << location << ".VpnConnectionId=" << StringUtils::URLEncode(m_vpnConnectionId.c_str()) << "&";
+      oStream << location << ".VpnConnectionId=" << StringUtils::URLEncoded(m_vpnConnectionId) << "&";
   }
   if(m_stateHasBeenSet)
   {
@@ -233,7 +234,7 @@ void VpnConnection::OutputToStream(Aws::OStream& oStream, const char* location)
   }
   if(m_customerGatewayConfigurationHasBeenSet)
   {
-      oStream << location << ".CustomerGatewayConfiguration=" << StringUtils::URLEncode(m_customerGatewayConfiguration.c_str()) << "&";
+      oStream << location << ".CustomerGatewayConfiguration=" << StringUtils::URLEncoded(m_customerGatewayConfiguration) << "&";
   }
   if(m_typeHasBeenSet)
   {
@@ -241,20 +242,20 @@ void VpnConnection::OutputToStream(Aws::OStream& oStream, const char* location)
   }
   if(m_customerGatewayIdHasBeenSet)
   {
-      oStream << location << ".CustomerGatewayId=" << StringUtils::URLEncode(m_customerGatewayId.c_str()) << "&";
+      oStream << location << ".CustomerGatewayId=" << StringUtils::URLEncoded(m_customerGatewayId) << "&";
   }
   if(m_vpnGatewayIdHasBeenSet)
   {
-      oStream << location << ".VpnGatewayId=" << StringUtils::URLEncode(m_vpnGatewayId.c_str()) << "&";
+      oStream << location << ".VpnGatewayId=" << StringUtils::URLEncoded(m_vpnGatewayId) << "&";
   }
   if(m_tagsHasBeenSet)
   {
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
   if(m_vgwTelemetryHasBeenSet)
@@ -262,9 +263,9 @@ void VpnConnection::OutputToStream(Aws::OStream& oStream, const char* location)
       unsigned vgwTelemetryIdx = 1;
       for(auto& item : m_vgwTelemetry)
       {
-        Aws::StringStream vgwTelemetrySs;
+        Aws::Utils::Stream::StringOutputStream vgwTelemetrySs;
         vgwTelemetrySs << location <<  ".item." << vgwTelemetryIdx++;
-        item.OutputToStream(oStream, vgwTelemetrySs.str().c_str());
+        item.OutputToStream(oStream, vgwTelemetrySs.GetString().c_str());
       }
   }
   if(m_optionsHasBeenSet)
@@ -278,9 +279,9 @@ void VpnConnection::OutputToStream(Aws::OStream& oStream, const char* location)
       unsigned routesIdx = 1;
       for(auto& item : m_routes)
       {
-        Aws::StringStream routesSs;
+        Aws::Utils::Stream::StringOutputStream routesSs;
         routesSs << location <<  ".item." << routesIdx++;
-        item.OutputToStream(oStream, routesSs.str().c_str());
+        item.OutputToStream(oStream, routesSs.GetString().c_str());
       }
   }
 }
@@ -51,7 +51,7 @@ VpnConnectionOptions& VpnConnectionOptions::operator =(const XmlNode& xmlNode)
     XmlNode staticRoutesOnlyNode = resultNode.FirstChild("staticRoutesOnly");
     if(!staticRoutesOnlyNode.IsNull())
     {
-      m_staticRoutesOnly = StringUtils::ConvertToBool(StringUtils::Trim(staticRoutesOnlyNode.GetText().c_str()).c_str());
+      m_staticRoutesOnly = StringUtils::ConvertToBool(staticRoutesOnlyNode.GetTextView().Trim().ToString().c_str());
       m_staticRoutesOnlyHasBeenSet = true;
     }
   }
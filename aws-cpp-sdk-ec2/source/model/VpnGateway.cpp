@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,25 +60,25 @@ VpnGateway& VpnGateway::operator =(const XmlNode& xmlNode)
     XmlNode vpnGatewayIdNode = resultNode.FirstChild("vpnGatewayId");
     if(!vpnGatewayIdNode.IsNull())
     {
-      m_vpnGatewayId = StringUtils::Trim(vpnGatewayIdNode.GetText().c_str());
+      m_vpnGatewayId = vpnGatewayIdNode.GetTextView().Trim().ToString();
       m_vpnGatewayIdHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = VpnStateMapper::GetVpnStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = VpnStateMapper::GetVpnStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
     XmlNode typeNode = resultNode.FirstChild("type");
     if(!typeNode.IsNull())
     {
-      m_type = GatewayTypeMapper::GetGatewayTypeForName(StringUtils::Trim(typeNode.GetText().c_str()).c_str());
+      m_type = GatewayTypeMapper::GetGatewayTypeForName(typeNode.GetTextView().Trim().ToString().c_str());
       m_typeHasBeenSet = true;
     }
     XmlNode availabilityZoneNode = resultNode.FirstChild("availabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode vpcAttachmentsNode = resultNode.FirstChild("attachments");
@@ -113,7 +114,7 @@ void VpnGateway::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_vpnGatewayIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpnGatewayId=" << StringUtils::URLEncode(m_vpnGatewayId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpnGatewayId=" << StringUtils::URLEncoded(m_vpnGatewayId) << "&";
   }
 
   if(m_stateHasBeenSet)
@@ -128,7 +129,7 @@ void VpnGateway::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_vpcAttachmentsHasBeenSet)
@@ -136,9 +137,9 @@ void VpnGateway::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned vpcAttachmentsIdx = 1;
       for(auto& item : m_vpcAttachments)
       {
-        Aws::StringStream vpcAttachmentsSs;
+        Aws::Utils::Stream::StringOutputStream vpcAttachmentsSs;
         vpcAttachmentsSs << location << index << locationValue << ".Attachments." << vpcAttachmentsIdx++;
-        item.OutputToStream(oStream, vpcAttachmentsSs.str().c_str());
+        item.OutputToStream(oStream, vpcAttachmentsSs.GetString().c_str());
       }
   }
 
@@ -147,9 +148,9 @@ void VpnGateway::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".TagSet." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -159,7 +160,7 @@ void VpnGateway::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_vpnGatewayIdHasBeenSet)
   {
-      oStream << location << ".VpnGatewayId=" << StringUtils::URLEncode(m_vpnGatewayId.c_str()) << "&";
+      oStream << location << ".VpnGatewayId=" << StringUtils::URLEncoded(m_vpnGatewayId) << "&";
   }
   if(m_stateHasBeenSet)
   {
@@ -171,16 +172,16 @@ void VpnGateway::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_vpcAttachmentsHasBeenSet)
   {
       unsigned vpcAttachmentsIdx = 1;
       for(auto& item : m_vpcAttachments)
       {
-        Aws::StringStream vpcAttachmentsSs;
+        Aws::Utils::Stream::StringOutputStream vpcAttachmentsSs;
         vpcAttachmentsSs << location <<  ".item." << vpcAttachmentsIdx++;
-        item.OutputToStream(oStream, vpcAttachmentsSs.str().c_str());
+        item.OutputToStream(oStream, vpcAttachmentsSs.GetString().c_str());
       }
   }
   if(m_tagsHasBeenSet)
@@ -188,9 +189,9 @@ void VpnGateway::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".item." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
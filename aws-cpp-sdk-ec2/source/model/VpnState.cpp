@@ -29,31 +29,35 @@ namespace Aws
       namespace VpnStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int pending_HASH = -682587753;
+        static const int available_HASH = -733902135;
+        static const int deleting_HASH = 819717032;
+        static const int deleted_HASH = 1550463001;
 
 
         VpnState GetVpnStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          switch (hashCode)
           {
+          case pending_HASH:
             return VpnState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
+          case available_HASH:
             return VpnState::available;
-          }
-          else if (hashCode == deleting_HASH)
-          {
+          case deleting_HASH:
             return VpnState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
+          case deleted_HASH:
             return VpnState::deleted;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -53,19 +53,19 @@ VpnStaticRoute& VpnStaticRoute::operator =(const XmlNode& xmlNode)
     XmlNode destinationCidrBlockNode = resultNode.FirstChild("destinationCidrBlock");
     if(!destinationCidrBlockNode.IsNull())
     {
-      m_destinationCidrBlock = StringUtils::Trim(destinationCidrBlockNode.GetText().c_str());
+      m_destinationCidrBlock = destinationCidrBlockNode.GetTextView().Trim().ToString();
       m_destinationCidrBlockHasBeenSet = true;
     }
     XmlNode sourceNode = resultNode.FirstChild("source");
     if(!sourceNode.IsNull())
     {
-      m_source = VpnStaticRouteSourceMapper::GetVpnStaticRouteSourceForName(StringUtils::Trim(sourceNode.GetText().c_str()).c_str());
+      m_source = VpnStaticRouteSourceMapper::GetVpnStaticRouteSourceForName(sourceNode.GetTextView().Trim().ToString().c_str());
       m_sourceHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("state");
     if(!stateNode.IsNull())
     {
-      m_state = VpnStateMapper::GetVpnStateForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = VpnStateMapper::GetVpnStateForName(stateNode.GetTextView().Trim().ToString().c_str());
       m_stateHasBeenSet = true;
     }
   }
@@ -77,7 +77,7 @@ void VpnStaticRoute::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_destinationCidrBlockHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DestinationCidrBlock=" << StringUtils::URLEncode(m_destinationCidrBlock.c_str()) << "&";
+      oStream << location << index << locationValue << ".DestinationCidrBlock=" << StringUtils::URLEncoded(m_destinationCidrBlock) << "&";
   }
 
   if(m_sourceHasBeenSet)
@@ -96,7 +96,7 @@ void VpnStaticRoute::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_destinationCidrBlockHasBeenSet)
   {
-      oStream << location << ".DestinationCidrBlock=" << StringUtils::URLEncode(m_destinationCidrBlock.c_str()) << "&";
+      oStream << location << ".DestinationCidrBlock=" << StringUtils::URLEncoded(m_destinationCidrBlock) << "&";
   }
   if(m_sourceHasBeenSet)
   {
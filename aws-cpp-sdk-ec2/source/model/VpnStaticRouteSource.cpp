@@ -29,16 +29,26 @@ namespace Aws
       namespace VpnStaticRouteSourceMapper
       {
 
-        static const int Static_HASH = HashingUtils::HashString("Static");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Static_HASH = -1808614770;
 
 
         VpnStaticRouteSource GetVpnStaticRouteSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Static_HASH)
+          switch (hashCode)
           {
+          case Static_HASH:
             return VpnStaticRouteSource::Static;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
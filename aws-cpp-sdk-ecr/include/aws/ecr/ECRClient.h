@@ -37,6 +37,9 @@
 #include <aws/ecr/model/SetRepositoryPolicyResult.h>
 #include <aws/ecr/model/UploadLayerPartResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -214,6 +217,18 @@ namespace Model
          */
         virtual void BatchCheckLayerAvailabilityAsync(const Model::BatchCheckLayerAvailabilityRequest& request, const BatchCheckLayerAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchCheckLayerAvailabilityCallable(const Model::BatchCheckLayerAvailabilityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BatchCheckLayerAvailabilityOutcomeCallable BatchCheckLayerAvailabilityCallable(Model::BatchCheckLayerAvailabilityRequest&& request) const;
+
+        /**
+         * Same as BatchCheckLayerAvailabilityAsync(const Model::BatchCheckLayerAvailabilityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BatchCheckLayerAvailabilityAsync(Model::BatchCheckLayerAvailabilityRequest&& request, const BatchCheckLayerAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a list of specified images within a specified repository. Images are
          * specified with either <code>imageTag</code> or <code>imageDigest</code>.</p>
@@ -236,6 +251,18 @@ namespace Model
          */
         virtual void BatchDeleteImageAsync(const Model::BatchDeleteImageRequest& request, const BatchDeleteImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchDeleteImageCallable(const Model::BatchDeleteImageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BatchDeleteImageOutcomeCallable BatchDeleteImageCallable(Model::BatchDeleteImageRequest&& request) const;
+
+        /**
+         * Same as BatchDeleteImageAsync(const Model::BatchDeleteImageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BatchDeleteImageAsync(Model::BatchDeleteImageRequest&& request, const BatchDeleteImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets detailed information for specified images within a specified repository.
          * Images are specified with either <code>imageTag</code> or
@@ -261,6 +288,18 @@ namespace Model
          */
         virtual void BatchGetImageAsync(const Model::BatchGetImageRequest& request, const BatchGetImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetImageCallable(const Model::BatchGetImageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BatchGetImageOutcomeCallable BatchGetImageCallable(Model::BatchGetImageRequest&& request) const;
+
+        /**
+         * Same as BatchGetImageAsync(const Model::BatchGetImageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BatchGetImageAsync(Model::BatchGetImageRequest&& request, const BatchGetImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Inform Amazon ECR that the image layer upload for a specified registry,
          * repository name, and upload ID, has completed. You can optionally provide a
@@ -295,6 +334,18 @@ namespace Model
          */
         virtual void CompleteLayerUploadAsync(const Model::CompleteLayerUploadRequest& request, const CompleteLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CompleteLayerUploadCallable(const Model::CompleteLayerUploadRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CompleteLayerUploadOutcomeCallable CompleteLayerUploadCallable(Model::CompleteLayerUploadRequest&& request) const;
+
+        /**
+         * Same as CompleteLayerUploadAsync(const Model::CompleteLayerUploadRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CompleteLayerUploadAsync(Model::CompleteLayerUploadRequest&& request, const CompleteLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an image repository.</p>
          */
@@ -314,6 +365,18 @@ namespace Model
          */
         virtual void CreateRepositoryAsync(const Model::CreateRepositoryRequest& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRepositoryCallable(const Model::CreateRepositoryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateRepositoryOutcomeCallable CreateRepositoryCallable(Model::CreateRepositoryRequest&& request) const;
+
+        /**
+         * Same as CreateRepositoryAsync(const Model::CreateRepositoryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateRepositoryAsync(Model::CreateRepositoryRequest&& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an existing image repository. If a repository contains images, you
          * must use the <code>force</code> option to delete it.</p>
@@ -336,6 +399,18 @@ namespace Model
          */
         virtual void DeleteRepositoryAsync(const Model::DeleteRepositoryRequest& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRepositoryCallable(const Model::DeleteRepositoryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRepositoryOutcomeCallable DeleteRepositoryCallable(Model::DeleteRepositoryRequest&& request) const;
+
+        /**
+         * Same as DeleteRepositoryAsync(const Model::DeleteRepositoryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRepositoryAsync(Model::DeleteRepositoryRequest&& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the repository policy from a specified repository.</p>
          */
@@ -355,6 +430,18 @@ namespace Model
          */
         virtual void DeleteRepositoryPolicyAsync(const Model::DeleteRepositoryPolicyRequest& request, const DeleteRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRepositoryPolicyCallable(const Model::DeleteRepositoryPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRepositoryPolicyOutcomeCallable DeleteRepositoryPolicyCallable(Model::DeleteRepositoryPolicyRequest&& request) const;
+
+        /**
+         * Same as DeleteRepositoryPolicyAsync(const Model::DeleteRepositoryPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRepositoryPolicyAsync(Model::DeleteRepositoryPolicyRequest&& request, const DeleteRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes image repositories in a registry.</p>
          */
@@ -374,6 +461,18 @@ namespace Model
          */
         virtual void DescribeRepositoriesAsync(const Model::DescribeRepositoriesRequest& request, const DescribeRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRepositoriesCallable(const Model::DescribeRepositoriesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeRepositoriesOutcomeCallable DescribeRepositoriesCallable(Model::DescribeRepositoriesRequest&& request) const;
+
+        /**
+         * Same as DescribeRepositoriesAsync(const Model::DescribeRepositoriesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeRepositoriesAsync(Model::DescribeRepositoriesRequest&& request, const DescribeRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a token that is valid for a specified registry for 12 hours. This
          * command allows you to use the <code>docker</code> CLI to push and pull images
@@ -414,6 +513,18 @@ namespace Model
          */
         virtual void GetAuthorizationTokenAsync(const Model::GetAuthorizationTokenRequest& request, const GetAuthorizationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAuthorizationTokenCallable(const Model::GetAuthorizationTokenRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetAuthorizationTokenOutcomeCallable GetAuthorizationTokenCallable(Model::GetAuthorizationTokenRequest&& request) const;
+
+        /**
+         * Same as GetAuthorizationTokenAsync(const Model::GetAuthorizationTokenRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetAuthorizationTokenAsync(Model::GetAuthorizationTokenRequest&& request, const GetAuthorizationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the pre-signed Amazon S3 download URL corresponding to an image
          * layer. You can only get URLs for image layers that are referenced in an
@@ -445,6 +556,18 @@ namespace Model
          */
         virtual void GetDownloadUrlForLayerAsync(const Model::GetDownloadUrlForLayerRequest& request, const GetDownloadUrlForLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDownloadUrlForLayerCallable(const Model::GetDownloadUrlForLayerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDownloadUrlForLayerOutcomeCallable GetDownloadUrlForLayerCallable(Model::GetDownloadUrlForLayerRequest&& request) const;
+
+        /**
+         * Same as GetDownloadUrlForLayerAsync(const Model::GetDownloadUrlForLayerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDownloadUrlForLayerAsync(Model::GetDownloadUrlForLayerRequest&& request, const GetDownloadUrlForLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the repository policy for a specified repository.</p>
          */
@@ -464,6 +587,18 @@ namespace Model
          */
         virtual void GetRepositoryPolicyAsync(const Model::GetRepositoryPolicyRequest& request, const GetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRepositoryPolicyCallable(const Model::GetRepositoryPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetRepositoryPolicyOutcomeCallable GetRepositoryPolicyCallable(Model::GetRepositoryPolicyRequest&& request) const;
+
+        /**
+         * Same as GetRepositoryPolicyAsync(const Model::GetRepositoryPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetRepositoryPolicyAsync(Model::GetRepositoryPolicyRequest&& request, const GetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Notify Amazon ECR that you intend to upload an image layer.</p> <note>
          * <p>This operation is used by the Amazon ECR proxy, and it is not intended for
@@ -492,6 +627,18 @@ namespace Model
          */
         virtual void InitiateLayerUploadAsync(const Model::InitiateLayerUploadRequest& request, const InitiateLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as InitiateLayerUploadCallable(const Model::InitiateLayerUploadRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::InitiateLayerUploadOutcomeCallable InitiateLayerUploadCallable(Model::InitiateLayerUploadRequest&& request) const;
+
+        /**
+         * Same as InitiateLayerUploadAsync(const Model::InitiateLayerUploadRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void InitiateLayerUploadAsync(Model::InitiateLayerUploadRequest&& request, const InitiateLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all the image IDs for a given repository.</p>
          */
@@ -511,6 +658,18 @@ namespace Model
          */
         virtual void ListImagesAsync(const Model::ListImagesRequest& request, const ListImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListImagesCallable(const Model::ListImagesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListImagesOutcomeCallable ListImagesCallable(Model::ListImagesRequest&& request) const;
+
+        /**
+         * Same as ListImagesAsync(const Model::ListImagesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListImagesAsync(Model::ListImagesRequest&& request, const ListImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates the image manifest associated with an image.</p> <note>
          * <p>This operation is used by the Amazon ECR proxy, and it is not intended for
@@ -539,6 +698,18 @@ namespace Model
          */
         virtual void PutImageAsync(const Model::PutImageRequest& request, const PutImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutImageCallable(const Model::PutImageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutImageOutcomeCallable PutImageCallable(Model::PutImageRequest&& request) const;
+
+        /**
+         * Same as PutImageAsync(const Model::PutImageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutImageAsync(Model::PutImageRequest&& request, const PutImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Applies a repository policy on a specified repository to control access
          * permissions.</p>
@@ -561,6 +732,18 @@ namespace Model
          */
         virtual void SetRepositoryPolicyAsync(const Model::SetRepositoryPolicyRequest& request, const SetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetRepositoryPolicyCallable(const Model::SetRepositoryPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetRepositoryPolicyOutcomeCallable SetRepositoryPolicyCallable(Model::SetRepositoryPolicyRequest&& request) const;
+
+        /**
+         * Same as SetRepositoryPolicyAsync(const Model::SetRepositoryPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetRepositoryPolicyAsync(Model::SetRepositoryPolicyRequest&& request, const SetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Uploads an image layer part to Amazon ECR.</p> <note> <p>This operation is
          * used by the Amazon ECR proxy, and it is not intended for general use by
@@ -589,6 +772,110 @@ namespace Model
          */
         virtual void UploadLayerPartAsync(const Model::UploadLayerPartRequest& request, const UploadLayerPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadLayerPartCallable(const Model::UploadLayerPartRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UploadLayerPartOutcomeCallable UploadLayerPartCallable(Model::UploadLayerPartRequest&& request) const;
+
+        /**
+         * Same as UploadLayerPartAsync(const Model::UploadLayerPartRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UploadLayerPartAsync(Model::UploadLayerPartRequest&& request, const UploadLayerPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeRepositories(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ECRClient, Model::DescribeRepositoriesRequest, Model::DescribeRepositoriesOutcome> DescribeRepositoriesPaginator(const Model::DescribeRepositoriesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListImages(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ECRClient, Model::ListImagesRequest, Model::ListImagesOutcome> ListImagesPaginator(const Model::ListImagesRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of BatchCheckLayerAvailability(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::BatchCheckLayerAvailabilityRequest, Model::BatchCheckLayerAvailabilityOutcome> BatchCheckLayerAvailabilityAwaitable(Model::BatchCheckLayerAvailabilityRequest request) const;
+
+        /**
+         * co_await-able form of BatchDeleteImage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::BatchDeleteImageRequest, Model::BatchDeleteImageOutcome> BatchDeleteImageAwaitable(Model::BatchDeleteImageRequest request) const;
+
+        /**
+         * co_await-able form of BatchGetImage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::BatchGetImageRequest, Model::BatchGetImageOutcome> BatchGetImageAwaitable(Model::BatchGetImageRequest request) const;
+
+        /**
+         * co_await-able form of CompleteLayerUpload(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::CompleteLayerUploadRequest, Model::CompleteLayerUploadOutcome> CompleteLayerUploadAwaitable(Model::CompleteLayerUploadRequest request) const;
+
+        /**
+         * co_await-able form of CreateRepository(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::CreateRepositoryRequest, Model::CreateRepositoryOutcome> CreateRepositoryAwaitable(Model::CreateRepositoryRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRepository(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::DeleteRepositoryRequest, Model::DeleteRepositoryOutcome> DeleteRepositoryAwaitable(Model::DeleteRepositoryRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRepositoryPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::DeleteRepositoryPolicyRequest, Model::DeleteRepositoryPolicyOutcome> DeleteRepositoryPolicyAwaitable(Model::DeleteRepositoryPolicyRequest request) const;
+
+        /**
+         * co_await-able form of DescribeRepositories(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::DescribeRepositoriesRequest, Model::DescribeRepositoriesOutcome> DescribeRepositoriesAwaitable(Model::DescribeRepositoriesRequest request) const;
+
+        /**
+         * co_await-able form of GetAuthorizationToken(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::GetAuthorizationTokenRequest, Model::GetAuthorizationTokenOutcome> GetAuthorizationTokenAwaitable(Model::GetAuthorizationTokenRequest request) const;
+
+        /**
+         * co_await-able form of GetDownloadUrlForLayer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::GetDownloadUrlForLayerRequest, Model::GetDownloadUrlForLayerOutcome> GetDownloadUrlForLayerAwaitable(Model::GetDownloadUrlForLayerRequest request) const;
+
+        /**
+         * co_await-able form of GetRepositoryPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::GetRepositoryPolicyRequest, Model::GetRepositoryPolicyOutcome> GetRepositoryPolicyAwaitable(Model::GetRepositoryPolicyRequest request) const;
+
+        /**
+         * co_await-able form of InitiateLayerUpload(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::InitiateLayerUploadRequest, Model::InitiateLayerUploadOutcome> InitiateLayerUploadAwaitable(Model::InitiateLayerUploadRequest request) const;
+
+        /**
+         * co_await-able form of ListImages(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::ListImagesRequest, Model::ListImagesOutcome> ListImagesAwaitable(Model::ListImagesRequest request) const;
+
+        /**
+         * co_await-able form of PutImage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::PutImageRequest, Model::PutImageOutcome> PutImageAwaitable(Model::PutImageRequest request) const;
+
+        /**
+         * co_await-able form of SetRepositoryPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::SetRepositoryPolicyRequest, Model::SetRepositoryPolicyOutcome> SetRepositoryPolicyAwaitable(Model::SetRepositoryPolicyRequest request) const;
+
+        /**
+         * co_await-able form of UploadLayerPart(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECRClient, Model::UploadLayerPartRequest, Model::UploadLayerPartOutcome> UploadLayerPartAwaitable(Model::UploadLayerPartRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
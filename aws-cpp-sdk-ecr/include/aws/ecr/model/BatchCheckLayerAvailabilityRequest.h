@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     BatchCheckLayerAvailabilityRequest();
+    inline const char* GetServiceRequestName() const override { return "BatchCheckLayerAvailability"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
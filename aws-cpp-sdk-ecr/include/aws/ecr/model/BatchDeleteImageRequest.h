@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     BatchDeleteImageRequest();
+    inline const char* GetServiceRequestName() const override { return "BatchDeleteImage"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
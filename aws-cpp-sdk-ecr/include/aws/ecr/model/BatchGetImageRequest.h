@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     BatchGetImageRequest();
+    inline const char* GetServiceRequestName() const override { return "BatchGetImage"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CompleteLayerUploadRequest();
+    inline const char* GetServiceRequestName() const override { return "CompleteLayerUpload"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
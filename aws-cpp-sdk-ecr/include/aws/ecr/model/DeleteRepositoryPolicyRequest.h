@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteRepositoryPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteRepositoryPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
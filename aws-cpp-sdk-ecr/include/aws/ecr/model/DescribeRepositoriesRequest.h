@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeRepositoriesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeRepositories"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetAuthorizationTokenRequest();
+    inline const char* GetServiceRequestName() const override { return "GetAuthorizationToken"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetDownloadUrlForLayerRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDownloadUrlForLayer"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetRepositoryPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetRepositoryPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     InitiateLayerUploadRequest();
+    inline const char* GetServiceRequestName() const override { return "InitiateLayerUpload"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListImagesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListImages"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     PutImageRequest();
+    inline const char* GetServiceRequestName() const override { return "PutImage"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
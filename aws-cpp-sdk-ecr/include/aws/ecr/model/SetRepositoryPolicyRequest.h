@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     SetRepositoryPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "SetRepositoryPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
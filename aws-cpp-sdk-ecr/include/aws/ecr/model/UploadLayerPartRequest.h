@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UploadLayerPartRequest();
+    inline const char* GetServiceRequestName() const override { return "UploadLayerPart"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
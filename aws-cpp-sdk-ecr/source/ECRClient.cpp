@@ -125,7 +125,7 @@ BatchCheckLayerAvailabilityOutcome ECRClient::BatchCheckLayerAvailability(const
 
 BatchCheckLayerAvailabilityOutcomeCallable ECRClient::BatchCheckLayerAvailabilityCallable(const BatchCheckLayerAvailabilityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BatchCheckLayerAvailability(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BatchCheckLayerAvailability(request); } );
 }
 
 void ECRClient::BatchCheckLayerAvailabilityAsync(const BatchCheckLayerAvailabilityRequest& request, const BatchCheckLayerAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -133,6 +133,16 @@ void ECRClient::BatchCheckLayerAvailabilityAsync(const BatchCheckLayerAvailabili
   m_executor->Submit( [this, request, handler, context](){ this->BatchCheckLayerAvailabilityAsyncHelper( request, handler, context ); } );
 }
 
+BatchCheckLayerAvailabilityOutcomeCallable ECRClient::BatchCheckLayerAvailabilityCallable(BatchCheckLayerAvailabilityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::BatchCheckLayerAvailability, this, std::move(request)));
+}
+
+void ECRClient::BatchCheckLayerAvailabilityAsync(BatchCheckLayerAvailabilityRequest&& request, const BatchCheckLayerAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::BatchCheckLayerAvailabilityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::BatchCheckLayerAvailabilityAsyncHelper(const BatchCheckLayerAvailabilityRequest& request, const BatchCheckLayerAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BatchCheckLayerAvailability(request), context);
@@ -156,7 +166,7 @@ BatchDeleteImageOutcome ECRClient::BatchDeleteImage(const BatchDeleteImageReques
 
 BatchDeleteImageOutcomeCallable ECRClient::BatchDeleteImageCallable(const BatchDeleteImageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BatchDeleteImage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BatchDeleteImage(request); } );
 }
 
 void ECRClient::BatchDeleteImageAsync(const BatchDeleteImageRequest& request, const BatchDeleteImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -164,6 +174,16 @@ void ECRClient::BatchDeleteImageAsync(const BatchDeleteImageRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->BatchDeleteImageAsyncHelper( request, handler, context ); } );
 }
 
+BatchDeleteImageOutcomeCallable ECRClient::BatchDeleteImageCallable(BatchDeleteImageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::BatchDeleteImage, this, std::move(request)));
+}
+
+void ECRClient::BatchDeleteImageAsync(BatchDeleteImageRequest&& request, const BatchDeleteImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::BatchDeleteImageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::BatchDeleteImageAsyncHelper(const BatchDeleteImageRequest& request, const BatchDeleteImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BatchDeleteImage(request), context);
@@ -187,7 +207,7 @@ BatchGetImageOutcome ECRClient::BatchGetImage(const BatchGetImageRequest& reques
 
 BatchGetImageOutcomeCallable ECRClient::BatchGetImageCallable(const BatchGetImageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BatchGetImage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BatchGetImage(request); } );
 }
 
 void ECRClient::BatchGetImageAsync(const BatchGetImageRequest& request, const BatchGetImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -195,6 +215,16 @@ void ECRClient::BatchGetImageAsync(const BatchGetImageRequest& request, const Ba
   m_executor->Submit( [this, request, handler, context](){ this->BatchGetImageAsyncHelper( request, handler, context ); } );
 }
 
+BatchGetImageOutcomeCallable ECRClient::BatchGetImageCallable(BatchGetImageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::BatchGetImage, this, std::move(request)));
+}
+
+void ECRClient::BatchGetImageAsync(BatchGetImageRequest&& request, const BatchGetImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::BatchGetImageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::BatchGetImageAsyncHelper(const BatchGetImageRequest& request, const BatchGetImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BatchGetImage(request), context);
@@ -218,7 +248,7 @@ CompleteLayerUploadOutcome ECRClient::CompleteLayerUpload(const CompleteLayerUpl
 
 CompleteLayerUploadOutcomeCallable ECRClient::CompleteLayerUploadCallable(const CompleteLayerUploadRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CompleteLayerUpload(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CompleteLayerUpload(request); } );
 }
 
 void ECRClient::CompleteLayerUploadAsync(const CompleteLayerUploadRequest& request, const CompleteLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -226,6 +256,16 @@ void ECRClient::CompleteLayerUploadAsync(const CompleteLayerUploadRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->CompleteLayerUploadAsyncHelper( request, handler, context ); } );
 }
 
+CompleteLayerUploadOutcomeCallable ECRClient::CompleteLayerUploadCallable(CompleteLayerUploadRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::CompleteLayerUpload, this, std::move(request)));
+}
+
+void ECRClient::CompleteLayerUploadAsync(CompleteLayerUploadRequest&& request, const CompleteLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::CompleteLayerUploadAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::CompleteLayerUploadAsyncHelper(const CompleteLayerUploadRequest& request, const CompleteLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CompleteLayerUpload(request), context);
@@ -249,7 +289,7 @@ CreateRepositoryOutcome ECRClient::CreateRepository(const CreateRepositoryReques
 
 CreateRepositoryOutcomeCallable ECRClient::CreateRepositoryCallable(const CreateRepositoryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateRepository(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateRepository(request); } );
 }
 
 void ECRClient::CreateRepositoryAsync(const CreateRepositoryRequest& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -257,6 +297,16 @@ void ECRClient::CreateRepositoryAsync(const CreateRepositoryRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CreateRepositoryAsyncHelper( request, handler, context ); } );
 }
 
+CreateRepositoryOutcomeCallable ECRClient::CreateRepositoryCallable(CreateRepositoryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::CreateRepository, this, std::move(request)));
+}
+
+void ECRClient::CreateRepositoryAsync(CreateRepositoryRequest&& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::CreateRepositoryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::CreateRepositoryAsyncHelper(const CreateRepositoryRequest& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateRepository(request), context);
@@ -280,7 +330,7 @@ DeleteRepositoryOutcome ECRClient::DeleteRepository(const DeleteRepositoryReques
 
 DeleteRepositoryOutcomeCallable ECRClient::DeleteRepositoryCallable(const DeleteRepositoryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRepository(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRepository(request); } );
 }
 
 void ECRClient::DeleteRepositoryAsync(const DeleteRepositoryRequest& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -288,6 +338,16 @@ void ECRClient::DeleteRepositoryAsync(const DeleteRepositoryRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRepositoryAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRepositoryOutcomeCallable ECRClient::DeleteRepositoryCallable(DeleteRepositoryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::DeleteRepository, this, std::move(request)));
+}
+
+void ECRClient::DeleteRepositoryAsync(DeleteRepositoryRequest&& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::DeleteRepositoryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::DeleteRepositoryAsyncHelper(const DeleteRepositoryRequest& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRepository(request), context);
@@ -311,7 +371,7 @@ DeleteRepositoryPolicyOutcome ECRClient::DeleteRepositoryPolicy(const DeleteRepo
 
 DeleteRepositoryPolicyOutcomeCallable ECRClient::DeleteRepositoryPolicyCallable(const DeleteRepositoryPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRepositoryPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRepositoryPolicy(request); } );
 }
 
 void ECRClient::DeleteRepositoryPolicyAsync(const DeleteRepositoryPolicyRequest& request, const DeleteRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -319,6 +379,16 @@ void ECRClient::DeleteRepositoryPolicyAsync(const DeleteRepositoryPolicyRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRepositoryPolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRepositoryPolicyOutcomeCallable ECRClient::DeleteRepositoryPolicyCallable(DeleteRepositoryPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::DeleteRepositoryPolicy, this, std::move(request)));
+}
+
+void ECRClient::DeleteRepositoryPolicyAsync(DeleteRepositoryPolicyRequest&& request, const DeleteRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::DeleteRepositoryPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::DeleteRepositoryPolicyAsyncHelper(const DeleteRepositoryPolicyRequest& request, const DeleteRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRepositoryPolicy(request), context);
@@ -342,7 +412,7 @@ DescribeRepositoriesOutcome ECRClient::DescribeRepositories(const DescribeReposi
 
 DescribeRepositoriesOutcomeCallable ECRClient::DescribeRepositoriesCallable(const DescribeRepositoriesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeRepositories(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeRepositories(request); } );
 }
 
 void ECRClient::DescribeRepositoriesAsync(const DescribeRepositoriesRequest& request, const DescribeRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -350,6 +420,16 @@ void ECRClient::DescribeRepositoriesAsync(const DescribeRepositoriesRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DescribeRepositoriesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeRepositoriesOutcomeCallable ECRClient::DescribeRepositoriesCallable(DescribeRepositoriesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::DescribeRepositories, this, std::move(request)));
+}
+
+void ECRClient::DescribeRepositoriesAsync(DescribeRepositoriesRequest&& request, const DescribeRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::DescribeRepositoriesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::DescribeRepositoriesAsyncHelper(const DescribeRepositoriesRequest& request, const DescribeRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeRepositories(request), context);
@@ -373,7 +453,7 @@ GetAuthorizationTokenOutcome ECRClient::GetAuthorizationToken(const GetAuthoriza
 
 GetAuthorizationTokenOutcomeCallable ECRClient::GetAuthorizationTokenCallable(const GetAuthorizationTokenRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetAuthorizationToken(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetAuthorizationToken(request); } );
 }
 
 void ECRClient::GetAuthorizationTokenAsync(const GetAuthorizationTokenRequest& request, const GetAuthorizationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -381,6 +461,16 @@ void ECRClient::GetAuthorizationTokenAsync(const GetAuthorizationTokenRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->GetAuthorizationTokenAsyncHelper( request, handler, context ); } );
 }
 
+GetAuthorizationTokenOutcomeCallable ECRClient::GetAuthorizationTokenCallable(GetAuthorizationTokenRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::GetAuthorizationToken, this, std::move(request)));
+}
+
+void ECRClient::GetAuthorizationTokenAsync(GetAuthorizationTokenRequest&& request, const GetAuthorizationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::GetAuthorizationTokenAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::GetAuthorizationTokenAsyncHelper(const GetAuthorizationTokenRequest& request, const GetAuthorizationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetAuthorizationToken(request), context);
@@ -404,7 +494,7 @@ GetDownloadUrlForLayerOutcome ECRClient::GetDownloadUrlForLayer(const GetDownloa
 
 GetDownloadUrlForLayerOutcomeCallable ECRClient::GetDownloadUrlForLayerCallable(const GetDownloadUrlForLayerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDownloadUrlForLayer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDownloadUrlForLayer(request); } );
 }
 
 void ECRClient::GetDownloadUrlForLayerAsync(const GetDownloadUrlForLayerRequest& request, const GetDownloadUrlForLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -412,6 +502,16 @@ void ECRClient::GetDownloadUrlForLayerAsync(const GetDownloadUrlForLayerRequest&
   m_executor->Submit( [this, request, handler, context](){ this->GetDownloadUrlForLayerAsyncHelper( request, handler, context ); } );
 }
 
+GetDownloadUrlForLayerOutcomeCallable ECRClient::GetDownloadUrlForLayerCallable(GetDownloadUrlForLayerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::GetDownloadUrlForLayer, this, std::move(request)));
+}
+
+void ECRClient::GetDownloadUrlForLayerAsync(GetDownloadUrlForLayerRequest&& request, const GetDownloadUrlForLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::GetDownloadUrlForLayerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::GetDownloadUrlForLayerAsyncHelper(const GetDownloadUrlForLayerRequest& request, const GetDownloadUrlForLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDownloadUrlForLayer(request), context);
@@ -435,7 +535,7 @@ GetRepositoryPolicyOutcome ECRClient::GetRepositoryPolicy(const GetRepositoryPol
 
 GetRepositoryPolicyOutcomeCallable ECRClient::GetRepositoryPolicyCallable(const GetRepositoryPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetRepositoryPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetRepositoryPolicy(request); } );
 }
 
 void ECRClient::GetRepositoryPolicyAsync(const GetRepositoryPolicyRequest& request, const GetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -443,6 +543,16 @@ void ECRClient::GetRepositoryPolicyAsync(const GetRepositoryPolicyRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->GetRepositoryPolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetRepositoryPolicyOutcomeCallable ECRClient::GetRepositoryPolicyCallable(GetRepositoryPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::GetRepositoryPolicy, this, std::move(request)));
+}
+
+void ECRClient::GetRepositoryPolicyAsync(GetRepositoryPolicyRequest&& request, const GetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::GetRepositoryPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::GetRepositoryPolicyAsyncHelper(const GetRepositoryPolicyRequest& request, const GetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetRepositoryPolicy(request), context);
@@ -466,7 +576,7 @@ InitiateLayerUploadOutcome ECRClient::InitiateLayerUpload(const InitiateLayerUpl
 
 InitiateLayerUploadOutcomeCallable ECRClient::InitiateLayerUploadCallable(const InitiateLayerUploadRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->InitiateLayerUpload(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->InitiateLayerUpload(request); } );
 }
 
 void ECRClient::InitiateLayerUploadAsync(const InitiateLayerUploadRequest& request, const InitiateLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -474,6 +584,16 @@ void ECRClient::InitiateLayerUploadAsync(const InitiateLayerUploadRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->InitiateLayerUploadAsyncHelper( request, handler, context ); } );
 }
 
+InitiateLayerUploadOutcomeCallable ECRClient::InitiateLayerUploadCallable(InitiateLayerUploadRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::InitiateLayerUpload, this, std::move(request)));
+}
+
+void ECRClient::InitiateLayerUploadAsync(InitiateLayerUploadRequest&& request, const InitiateLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::InitiateLayerUploadAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::InitiateLayerUploadAsyncHelper(const InitiateLayerUploadRequest& request, const InitiateLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, InitiateLayerUpload(request), context);
@@ -497,7 +617,7 @@ ListImagesOutcome ECRClient::ListImages(const ListImagesRequest& request) const
 
 ListImagesOutcomeCallable ECRClient::ListImagesCallable(const ListImagesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListImages(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListImages(request); } );
 }
 
 void ECRClient::ListImagesAsync(const ListImagesRequest& request, const ListImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -505,6 +625,16 @@ void ECRClient::ListImagesAsync(const ListImagesRequest& request, const ListImag
   m_executor->Submit( [this, request, handler, context](){ this->ListImagesAsyncHelper( request, handler, context ); } );
 }
 
+ListImagesOutcomeCallable ECRClient::ListImagesCallable(ListImagesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::ListImages, this, std::move(request)));
+}
+
+void ECRClient::ListImagesAsync(ListImagesRequest&& request, const ListImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::ListImagesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::ListImagesAsyncHelper(const ListImagesRequest& request, const ListImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListImages(request), context);
@@ -528,7 +658,7 @@ PutImageOutcome ECRClient::PutImage(const PutImageRequest& request) const
 
 PutImageOutcomeCallable ECRClient::PutImageCallable(const PutImageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutImage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutImage(request); } );
 }
 
 void ECRClient::PutImageAsync(const PutImageRequest& request, const PutImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -536,6 +666,16 @@ void ECRClient::PutImageAsync(const PutImageRequest& request, const PutImageResp
   m_executor->Submit( [this, request, handler, context](){ this->PutImageAsyncHelper( request, handler, context ); } );
 }
 
+PutImageOutcomeCallable ECRClient::PutImageCallable(PutImageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::PutImage, this, std::move(request)));
+}
+
+void ECRClient::PutImageAsync(PutImageRequest&& request, const PutImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::PutImageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::PutImageAsyncHelper(const PutImageRequest& request, const PutImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutImage(request), context);
@@ -559,7 +699,7 @@ SetRepositoryPolicyOutcome ECRClient::SetRepositoryPolicy(const SetRepositoryPol
 
 SetRepositoryPolicyOutcomeCallable ECRClient::SetRepositoryPolicyCallable(const SetRepositoryPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetRepositoryPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetRepositoryPolicy(request); } );
 }
 
 void ECRClient::SetRepositoryPolicyAsync(const SetRepositoryPolicyRequest& request, const SetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -567,6 +707,16 @@ void ECRClient::SetRepositoryPolicyAsync(const SetRepositoryPolicyRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->SetRepositoryPolicyAsyncHelper( request, handler, context ); } );
 }
 
+SetRepositoryPolicyOutcomeCallable ECRClient::SetRepositoryPolicyCallable(SetRepositoryPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::SetRepositoryPolicy, this, std::move(request)));
+}
+
+void ECRClient::SetRepositoryPolicyAsync(SetRepositoryPolicyRequest&& request, const SetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::SetRepositoryPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::SetRepositoryPolicyAsyncHelper(const SetRepositoryPolicyRequest& request, const SetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetRepositoryPolicy(request), context);
@@ -590,7 +740,7 @@ UploadLayerPartOutcome ECRClient::UploadLayerPart(const UploadLayerPartRequest&
 
 UploadLayerPartOutcomeCallable ECRClient::UploadLayerPartCallable(const UploadLayerPartRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UploadLayerPart(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UploadLayerPart(request); } );
 }
 
 void ECRClient::UploadLayerPartAsync(const UploadLayerPartRequest& request, const UploadLayerPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -598,8 +748,134 @@ void ECRClient::UploadLayerPartAsync(const UploadLayerPartRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->UploadLayerPartAsyncHelper( request, handler, context ); } );
 }
 
+UploadLayerPartOutcomeCallable ECRClient::UploadLayerPartCallable(UploadLayerPartRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECRClient::UploadLayerPart, this, std::move(request)));
+}
+
+void ECRClient::UploadLayerPartAsync(UploadLayerPartRequest&& request, const UploadLayerPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECRClient::UploadLayerPartAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECRClient::UploadLayerPartAsyncHelper(const UploadLayerPartRequest& request, const UploadLayerPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UploadLayerPart(request), context);
 }
 
+Paginator<ECRClient, DescribeRepositoriesRequest, DescribeRepositoriesOutcome> ECRClient::DescribeRepositoriesPaginator(const DescribeRepositoriesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ECRClient, DescribeRepositoriesRequest, DescribeRepositoriesOutcome>(this, &ECRClient::DescribeRepositories, request,
+    [](const DescribeRepositoriesRequest& current, const DescribeRepositoriesOutcome& outcome, DescribeRepositoriesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ECRClient, ListImagesRequest, ListImagesOutcome> ECRClient::ListImagesPaginator(const ListImagesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ECRClient, ListImagesRequest, ListImagesOutcome>(this, &ECRClient::ListImages, request,
+    [](const ListImagesRequest& current, const ListImagesOutcome& outcome, ListImagesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<ECRClient, BatchCheckLayerAvailabilityRequest, BatchCheckLayerAvailabilityOutcome> ECRClient::BatchCheckLayerAvailabilityAwaitable(BatchCheckLayerAvailabilityRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::BatchCheckLayerAvailability, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECRClient, BatchDeleteImageRequest, BatchDeleteImageOutcome> ECRClient::BatchDeleteImageAwaitable(BatchDeleteImageRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::BatchDeleteImage, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECRClient, BatchGetImageRequest, BatchGetImageOutcome> ECRClient::BatchGetImageAwaitable(BatchGetImageRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::BatchGetImage, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECRClient, CompleteLayerUploadRequest, CompleteLayerUploadOutcome> ECRClient::CompleteLayerUploadAwaitable(CompleteLayerUploadRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::CompleteLayerUpload, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECRClient, CreateRepositoryRequest, CreateRepositoryOutcome> ECRClient::CreateRepositoryAwaitable(CreateRepositoryRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::CreateRepository, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECRClient, DeleteRepositoryRequest, DeleteRepositoryOutcome> ECRClient::DeleteRepositoryAwaitable(DeleteRepositoryRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::DeleteRepository, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECRClient, DeleteRepositoryPolicyRequest, DeleteRepositoryPolicyOutcome> ECRClient::DeleteRepositoryPolicyAwaitable(DeleteRepositoryPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::DeleteRepositoryPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECRClient, DescribeRepositoriesRequest, DescribeRepositoriesOutcome> ECRClient::DescribeRepositoriesAwaitable(DescribeRepositoriesRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::DescribeRepositories, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECRClient, GetAuthorizationTokenRequest, GetAuthorizationTokenOutcome> ECRClient::GetAuthorizationTokenAwaitable(GetAuthorizationTokenRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::GetAuthorizationToken, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECRClient, GetDownloadUrlForLayerRequest, GetDownloadUrlForLayerOutcome> ECRClient::GetDownloadUrlForLayerAwaitable(GetDownloadUrlForLayerRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::GetDownloadUrlForLayer, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECRClient, GetRepositoryPolicyRequest, GetRepositoryPolicyOutcome> ECRClient::GetRepositoryPolicyAwaitable(GetRepositoryPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::GetRepositoryPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECRClient, InitiateLayerUploadRequest, InitiateLayerUploadOutcome> ECRClient::InitiateLayerUploadAwaitable(InitiateLayerUploadRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::InitiateLayerUpload, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECRClient, ListImagesRequest, ListImagesOutcome> ECRClient::ListImagesAwaitable(ListImagesRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::ListImages, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECRClient, PutImageRequest, PutImageOutcome> ECRClient::PutImageAwaitable(PutImageRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::PutImage, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECRClient, SetRepositoryPolicyRequest, SetRepositoryPolicyOutcome> ECRClient::SetRepositoryPolicyAwaitable(SetRepositoryPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::SetRepositoryPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECRClient, UploadLayerPartRequest, UploadLayerPartOutcome> ECRClient::UploadLayerPartAwaitable(UploadLayerPartRequest request) const
+{
+  return { m_executor.get(), { this, &ECRClient::UploadLayerPart, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,36 +29,38 @@ namespace Aws
       namespace ImageFailureCodeMapper
       {
 
-        static const int InvalidImageDigest_HASH = HashingUtils::HashString("InvalidImageDigest");
-        static const int InvalidImageTag_HASH = HashingUtils::HashString("InvalidImageTag");
-        static const int ImageTagDoesNotMatchDigest_HASH = HashingUtils::HashString("ImageTagDoesNotMatchDigest");
-        static const int ImageNotFound_HASH = HashingUtils::HashString("ImageNotFound");
-        static const int MissingDigestAndTag_HASH = HashingUtils::HashString("MissingDigestAndTag");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int InvalidImageDigest_HASH = -1518082904;
+        static const int InvalidImageTag_HASH = 1166443318;
+        static const int ImageTagDoesNotMatchDigest_HASH = -812863314;
+        static const int ImageNotFound_HASH = -576423222;
+        static const int MissingDigestAndTag_HASH = -384252531;
 
 
         ImageFailureCode GetImageFailureCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InvalidImageDigest_HASH)
+          switch (hashCode)
           {
+          case InvalidImageDigest_HASH:
             return ImageFailureCode::InvalidImageDigest;
-          }
-          else if (hashCode == InvalidImageTag_HASH)
-          {
+          case InvalidImageTag_HASH:
             return ImageFailureCode::InvalidImageTag;
-          }
-          else if (hashCode == ImageTagDoesNotMatchDigest_HASH)
-          {
+          case ImageTagDoesNotMatchDigest_HASH:
             return ImageFailureCode::ImageTagDoesNotMatchDigest;
-          }
-          else if (hashCode == ImageNotFound_HASH)
-          {
+          case ImageNotFound_HASH:
             return ImageFailureCode::ImageNotFound;
-          }
-          else if (hashCode == MissingDigestAndTag_HASH)
-          {
+          case MissingDigestAndTag_HASH:
             return ImageFailureCode::MissingDigestAndTag;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace LayerAvailabilityMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int UNAVAILABLE_HASH = HashingUtils::HashString("UNAVAILABLE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int AVAILABLE_HASH = 2052692649;
+        static const int UNAVAILABLE_HASH = 1487498288;
 
 
         LayerAvailability GetLayerAvailabilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
+          switch (hashCode)
           {
+          case AVAILABLE_HASH:
             return LayerAvailability::AVAILABLE;
-          }
-          else if (hashCode == UNAVAILABLE_HASH)
-          {
+          case UNAVAILABLE_HASH:
             return LayerAvailability::UNAVAILABLE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
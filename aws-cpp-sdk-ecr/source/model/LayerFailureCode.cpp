@@ -29,21 +29,29 @@ namespace Aws
       namespace LayerFailureCodeMapper
       {
 
-        static const int InvalidLayerDigest_HASH = HashingUtils::HashString("InvalidLayerDigest");
-        static const int MissingLayerDigest_HASH = HashingUtils::HashString("MissingLayerDigest");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int InvalidLayerDigest_HASH = -1223049186;
+        static const int MissingLayerDigest_HASH = -53312177;
 
 
         LayerFailureCode GetLayerFailureCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InvalidLayerDigest_HASH)
+          switch (hashCode)
           {
+          case InvalidLayerDigest_HASH:
             return LayerFailureCode::InvalidLayerDigest;
-          }
-          else if (hashCode == MissingLayerDigest_HASH)
-          {
+          case MissingLayerDigest_HASH:
             return LayerFailureCode::MissingLayerDigest;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
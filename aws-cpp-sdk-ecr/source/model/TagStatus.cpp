@@ -29,21 +29,29 @@ namespace Aws
       namespace TagStatusMapper
       {
 
-        static const int TAGGED_HASH = HashingUtils::HashString("TAGGED");
-        static const int UNTAGGED_HASH = HashingUtils::HashString("UNTAGGED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int TAGGED_HASH = -1827904148;
+        static const int UNTAGGED_HASH = 787896645;
 
 
         TagStatus GetTagStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TAGGED_HASH)
+          switch (hashCode)
           {
+          case TAGGED_HASH:
             return TagStatus::TAGGED;
-          }
-          else if (hashCode == UNTAGGED_HASH)
-          {
+          case UNTAGGED_HASH:
             return TagStatus::UNTAGGED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
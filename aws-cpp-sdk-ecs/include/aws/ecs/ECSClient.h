@@ -48,6 +48,9 @@
 #include <aws/ecs/model/UpdateContainerAgentResult.h>
 #include <aws/ecs/model/UpdateServiceResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -274,6 +277,18 @@ namespace Model
          */
         virtual void CreateClusterAsync(const Model::CreateClusterRequest& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateClusterCallable(const Model::CreateClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateClusterOutcomeCallable CreateClusterCallable(Model::CreateClusterRequest&& request) const;
+
+        /**
+         * Same as CreateClusterAsync(const Model::CreateClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateClusterAsync(Model::CreateClusterRequest&& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Runs and maintains a desired number of tasks from a specified task
          * definition. If the number of tasks running in a service drops below
@@ -422,6 +437,18 @@ namespace Model
          */
         virtual void CreateServiceAsync(const Model::CreateServiceRequest& request, const CreateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateServiceCallable(const Model::CreateServiceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateServiceOutcomeCallable CreateServiceCallable(Model::CreateServiceRequest&& request) const;
+
+        /**
+         * Same as CreateServiceAsync(const Model::CreateServiceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateServiceAsync(Model::CreateServiceRequest&& request, const CreateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified cluster. You must deregister all container instances
          * from this cluster before you may delete it. You can list the container instances
@@ -450,6 +477,18 @@ namespace Model
          */
         virtual void DeleteClusterAsync(const Model::DeleteClusterRequest& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteClusterCallable(const Model::DeleteClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteClusterOutcomeCallable DeleteClusterCallable(Model::DeleteClusterRequest&& request) const;
+
+        /**
+         * Same as DeleteClusterAsync(const Model::DeleteClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteClusterAsync(Model::DeleteClusterRequest&& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a specified service within a cluster. You can delete a service if you
          * have no running tasks in it and the desired task count is zero. If the service
@@ -511,6 +550,18 @@ namespace Model
          */
         virtual void DeleteServiceAsync(const Model::DeleteServiceRequest& request, const DeleteServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteServiceCallable(const Model::DeleteServiceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteServiceOutcomeCallable DeleteServiceCallable(Model::DeleteServiceRequest&& request) const;
+
+        /**
+         * Same as DeleteServiceAsync(const Model::DeleteServiceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteServiceAsync(Model::DeleteServiceRequest&& request, const DeleteServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters an Amazon ECS container instance from the specified cluster. This
          * instance is no longer available to run tasks.</p> <p>If you intend to use the
@@ -563,6 +614,18 @@ namespace Model
          */
         virtual void DeregisterContainerInstanceAsync(const Model::DeregisterContainerInstanceRequest& request, const DeregisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterContainerInstanceCallable(const Model::DeregisterContainerInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeregisterContainerInstanceOutcomeCallable DeregisterContainerInstanceCallable(Model::DeregisterContainerInstanceRequest&& request) const;
+
+        /**
+         * Same as DeregisterContainerInstanceAsync(const Model::DeregisterContainerInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeregisterContainerInstanceAsync(Model::DeregisterContainerInstanceRequest&& request, const DeregisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters the specified task definition by family and revision. Upon
          * deregistration, the task definition is marked as <code>INACTIVE</code>. Existing
@@ -609,6 +672,18 @@ namespace Model
          */
         virtual void DeregisterTaskDefinitionAsync(const Model::DeregisterTaskDefinitionRequest& request, const DeregisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterTaskDefinitionCallable(const Model::DeregisterTaskDefinitionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeregisterTaskDefinitionOutcomeCallable DeregisterTaskDefinitionCallable(Model::DeregisterTaskDefinitionRequest&& request) const;
+
+        /**
+         * Same as DeregisterTaskDefinitionAsync(const Model::DeregisterTaskDefinitionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeregisterTaskDefinitionAsync(Model::DeregisterTaskDefinitionRequest&& request, const DeregisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your clusters.</p>
          */
@@ -628,6 +703,18 @@ namespace Model
          */
         virtual void DescribeClustersAsync(const Model::DescribeClustersRequest& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClustersCallable(const Model::DescribeClustersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeClustersOutcomeCallable DescribeClustersCallable(Model::DescribeClustersRequest&& request) const;
+
+        /**
+         * Same as DescribeClustersAsync(const Model::DescribeClustersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeClustersAsync(Model::DescribeClustersRequest&& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes Amazon EC2 Container Service container instances. Returns metadata
          * about registered and remaining resources on each container instance
@@ -653,6 +740,18 @@ namespace Model
          */
         virtual void DescribeContainerInstancesAsync(const Model::DescribeContainerInstancesRequest& request, const DescribeContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeContainerInstancesCallable(const Model::DescribeContainerInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeContainerInstancesOutcomeCallable DescribeContainerInstancesCallable(Model::DescribeContainerInstancesRequest&& request) const;
+
+        /**
+         * Same as DescribeContainerInstancesAsync(const Model::DescribeContainerInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeContainerInstancesAsync(Model::DescribeContainerInstancesRequest&& request, const DescribeContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified services running in your cluster.</p>
          */
@@ -672,6 +771,18 @@ namespace Model
          */
         virtual void DescribeServicesAsync(const Model::DescribeServicesRequest& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeServicesCallable(const Model::DescribeServicesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeServicesOutcomeCallable DescribeServicesCallable(Model::DescribeServicesRequest&& request) const;
+
+        /**
+         * Same as DescribeServicesAsync(const Model::DescribeServicesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeServicesAsync(Model::DescribeServicesRequest&& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes a task definition. You can specify a <code>family</code> and
          * <code>revision</code> to find information about a specific task definition, or
@@ -706,6 +817,18 @@ namespace Model
          */
         virtual void DescribeTaskDefinitionAsync(const Model::DescribeTaskDefinitionRequest& request, const DescribeTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTaskDefinitionCallable(const Model::DescribeTaskDefinitionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTaskDefinitionOutcomeCallable DescribeTaskDefinitionCallable(Model::DescribeTaskDefinitionRequest&& request) const;
+
+        /**
+         * Same as DescribeTaskDefinitionAsync(const Model::DescribeTaskDefinitionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTaskDefinitionAsync(Model::DescribeTaskDefinitionRequest&& request, const DescribeTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes a specified task or tasks.</p>
          */
@@ -725,6 +848,18 @@ namespace Model
          */
         virtual void DescribeTasksAsync(const Model::DescribeTasksRequest& request, const DescribeTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTasksCallable(const Model::DescribeTasksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTasksOutcomeCallable DescribeTasksCallable(Model::DescribeTasksRequest&& request) const;
+
+        /**
+         * Same as DescribeTasksAsync(const Model::DescribeTasksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTasksAsync(Model::DescribeTasksRequest&& request, const DescribeTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <note> <p>This action is only used by the Amazon EC2 Container Service agent,
          * and it is not intended for use outside of the agent.</p> </note> <p>Returns an
@@ -750,6 +885,18 @@ namespace Model
          */
         virtual void DiscoverPollEndpointAsync(const Model::DiscoverPollEndpointRequest& request, const DiscoverPollEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DiscoverPollEndpointCallable(const Model::DiscoverPollEndpointRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DiscoverPollEndpointOutcomeCallable DiscoverPollEndpointCallable(Model::DiscoverPollEndpointRequest&& request) const;
+
+        /**
+         * Same as DiscoverPollEndpointAsync(const Model::DiscoverPollEndpointRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DiscoverPollEndpointAsync(Model::DiscoverPollEndpointRequest&& request, const DiscoverPollEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of existing clusters.</p>
          */
@@ -769,6 +916,18 @@ namespace Model
          */
         virtual void ListClustersAsync(const Model::ListClustersRequest& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListClustersCallable(const Model::ListClustersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListClustersOutcomeCallable ListClustersCallable(Model::ListClustersRequest&& request) const;
+
+        /**
+         * Same as ListClustersAsync(const Model::ListClustersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListClustersAsync(Model::ListClustersRequest&& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of container instances in a specified cluster.</p>
          */
@@ -788,6 +947,18 @@ namespace Model
          */
         virtual void ListContainerInstancesAsync(const Model::ListContainerInstancesRequest& request, const ListContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListContainerInstancesCallable(const Model::ListContainerInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListContainerInstancesOutcomeCallable ListContainerInstancesCallable(Model::ListContainerInstancesRequest&& request) const;
+
+        /**
+         * Same as ListContainerInstancesAsync(const Model::ListContainerInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListContainerInstancesAsync(Model::ListContainerInstancesRequest&& request, const ListContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the services that are running in a specified cluster.</p>
          */
@@ -807,6 +978,18 @@ namespace Model
          */
         virtual void ListServicesAsync(const Model::ListServicesRequest& request, const ListServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListServicesCallable(const Model::ListServicesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListServicesOutcomeCallable ListServicesCallable(Model::ListServicesRequest&& request) const;
+
+        /**
+         * Same as ListServicesAsync(const Model::ListServicesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListServicesAsync(Model::ListServicesRequest&& request, const ListServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of task definition families that are registered to your
          * account (which may include task definition families that no longer have any
@@ -844,6 +1027,18 @@ namespace Model
          */
         virtual void ListTaskDefinitionFamiliesAsync(const Model::ListTaskDefinitionFamiliesRequest& request, const ListTaskDefinitionFamiliesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTaskDefinitionFamiliesCallable(const Model::ListTaskDefinitionFamiliesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTaskDefinitionFamiliesOutcomeCallable ListTaskDefinitionFamiliesCallable(Model::ListTaskDefinitionFamiliesRequest&& request) const;
+
+        /**
+         * Same as ListTaskDefinitionFamiliesAsync(const Model::ListTaskDefinitionFamiliesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTaskDefinitionFamiliesAsync(Model::ListTaskDefinitionFamiliesRequest&& request, const ListTaskDefinitionFamiliesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of task definitions that are registered to your account. You
          * can filter the results by family name with the <code>familyPrefix</code>
@@ -869,6 +1064,18 @@ namespace Model
          */
         virtual void ListTaskDefinitionsAsync(const Model::ListTaskDefinitionsRequest& request, const ListTaskDefinitionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTaskDefinitionsCallable(const Model::ListTaskDefinitionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTaskDefinitionsOutcomeCallable ListTaskDefinitionsCallable(Model::ListTaskDefinitionsRequest&& request) const;
+
+        /**
+         * Same as ListTaskDefinitionsAsync(const Model::ListTaskDefinitionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTaskDefinitionsAsync(Model::ListTaskDefinitionsRequest&& request, const ListTaskDefinitionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of tasks for a specified cluster. You can filter the results
          * by family name, by a particular container instance, or by the desired status of
@@ -903,6 +1110,18 @@ namespace Model
          */
         virtual void ListTasksAsync(const Model::ListTasksRequest& request, const ListTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTasksCallable(const Model::ListTasksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTasksOutcomeCallable ListTasksCallable(Model::ListTasksRequest&& request) const;
+
+        /**
+         * Same as ListTasksAsync(const Model::ListTasksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTasksAsync(Model::ListTasksRequest&& request, const ListTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <note> <p>This action is only used by the Amazon EC2 Container Service agent,
          * and it is not intended for use outside of the agent.</p> </note> <p>Registers an
@@ -931,6 +1150,18 @@ namespace Model
          */
         virtual void RegisterContainerInstanceAsync(const Model::RegisterContainerInstanceRequest& request, const RegisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterContainerInstanceCallable(const Model::RegisterContainerInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterContainerInstanceOutcomeCallable RegisterContainerInstanceCallable(Model::RegisterContainerInstanceRequest&& request) const;
+
+        /**
+         * Same as RegisterContainerInstanceAsync(const Model::RegisterContainerInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterContainerInstanceAsync(Model::RegisterContainerInstanceRequest&& request, const RegisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers a new task definition from the supplied <code>family</code> and
          * <code>containerDefinitions</code>. Optionally, you can add data volumes to your
@@ -1001,6 +1232,18 @@ namespace Model
          */
         virtual void RegisterTaskDefinitionAsync(const Model::RegisterTaskDefinitionRequest& request, const RegisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterTaskDefinitionCallable(const Model::RegisterTaskDefinitionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterTaskDefinitionOutcomeCallable RegisterTaskDefinitionCallable(Model::RegisterTaskDefinitionRequest&& request) const;
+
+        /**
+         * Same as RegisterTaskDefinitionAsync(const Model::RegisterTaskDefinitionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterTaskDefinitionAsync(Model::RegisterTaskDefinitionRequest&& request, const RegisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Start a task using random placement and the default Amazon ECS scheduler. To
          * use your own scheduler or place a task on a specific container instance, use
@@ -1029,6 +1272,18 @@ namespace Model
          */
         virtual void RunTaskAsync(const Model::RunTaskRequest& request, const RunTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RunTaskCallable(const Model::RunTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RunTaskOutcomeCallable RunTaskCallable(Model::RunTaskRequest&& request) const;
+
+        /**
+         * Same as RunTaskAsync(const Model::RunTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RunTaskAsync(Model::RunTaskRequest&& request, const RunTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts a new task from the specified task definition on the specified
          * container instance or instances. To use the default Amazon ECS scheduler to
@@ -1057,6 +1312,18 @@ namespace Model
          */
         virtual void StartTaskAsync(const Model::StartTaskRequest& request, const StartTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartTaskCallable(const Model::StartTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StartTaskOutcomeCallable StartTaskCallable(Model::StartTaskRequest&& request) const;
+
+        /**
+         * Same as StartTaskAsync(const Model::StartTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StartTaskAsync(Model::StartTaskRequest&& request, const StartTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stops a running task.</p> <p>When <a>StopTask</a> is called on a task, the
          * equivalent of <code>docker stop</code> is issued to the containers running in
@@ -1091,6 +1358,18 @@ namespace Model
          */
         virtual void StopTaskAsync(const Model::StopTaskRequest& request, const StopTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopTaskCallable(const Model::StopTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StopTaskOutcomeCallable StopTaskCallable(Model::StopTaskRequest&& request) const;
+
+        /**
+         * Same as StopTaskAsync(const Model::StopTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StopTaskAsync(Model::StopTaskRequest&& request, const StopTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <note> <p>This action is only used by the Amazon EC2 Container Service agent,
          * and it is not intended for use outside of the agent.</p> </note> <p>Sent to
@@ -1116,6 +1395,18 @@ namespace Model
          */
         virtual void SubmitContainerStateChangeAsync(const Model::SubmitContainerStateChangeRequest& request, const SubmitContainerStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SubmitContainerStateChangeCallable(const Model::SubmitContainerStateChangeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SubmitContainerStateChangeOutcomeCallable SubmitContainerStateChangeCallable(Model::SubmitContainerStateChangeRequest&& request) const;
+
+        /**
+         * Same as SubmitContainerStateChangeAsync(const Model::SubmitContainerStateChangeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SubmitContainerStateChangeAsync(Model::SubmitContainerStateChangeRequest&& request, const SubmitContainerStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <note> <p>This action is only used by the Amazon EC2 Container Service agent,
          * and it is not intended for use outside of the agent.</p> </note> <p>Sent to
@@ -1141,6 +1432,18 @@ namespace Model
          */
         virtual void SubmitTaskStateChangeAsync(const Model::SubmitTaskStateChangeRequest& request, const SubmitTaskStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SubmitTaskStateChangeCallable(const Model::SubmitTaskStateChangeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SubmitTaskStateChangeOutcomeCallable SubmitTaskStateChangeCallable(Model::SubmitTaskStateChangeRequest&& request) const;
+
+        /**
+         * Same as SubmitTaskStateChangeAsync(const Model::SubmitTaskStateChangeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SubmitTaskStateChangeAsync(Model::SubmitTaskStateChangeRequest&& request, const SubmitTaskStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the Amazon ECS container agent on a specified container instance.
          * Updating the Amazon ECS container agent does not interrupt running tasks or
@@ -1190,6 +1493,18 @@ namespace Model
          */
         virtual void UpdateContainerAgentAsync(const Model::UpdateContainerAgentRequest& request, const UpdateContainerAgentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateContainerAgentCallable(const Model::UpdateContainerAgentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateContainerAgentOutcomeCallable UpdateContainerAgentCallable(Model::UpdateContainerAgentRequest&& request) const;
+
+        /**
+         * Same as UpdateContainerAgentAsync(const Model::UpdateContainerAgentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateContainerAgentAsync(Model::UpdateContainerAgentRequest&& request, const UpdateContainerAgentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the desired count, deployment configuration, or task definition used
          * in a service.</p> <p>You can add to or subtract from the number of
@@ -1335,6 +1650,185 @@ namespace Model
          */
         virtual void UpdateServiceAsync(const Model::UpdateServiceRequest& request, const UpdateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateServiceCallable(const Model::UpdateServiceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateServiceOutcomeCallable UpdateServiceCallable(Model::UpdateServiceRequest&& request) const;
+
+        /**
+         * Same as UpdateServiceAsync(const Model::UpdateServiceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateServiceAsync(Model::UpdateServiceRequest&& request, const UpdateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListClusters(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ECSClient, Model::ListClustersRequest, Model::ListClustersOutcome> ListClustersPaginator(const Model::ListClustersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListContainerInstances(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ECSClient, Model::ListContainerInstancesRequest, Model::ListContainerInstancesOutcome> ListContainerInstancesPaginator(const Model::ListContainerInstancesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListServices(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ECSClient, Model::ListServicesRequest, Model::ListServicesOutcome> ListServicesPaginator(const Model::ListServicesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListTaskDefinitionFamilies(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ECSClient, Model::ListTaskDefinitionFamiliesRequest, Model::ListTaskDefinitionFamiliesOutcome> ListTaskDefinitionFamiliesPaginator(const Model::ListTaskDefinitionFamiliesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListTaskDefinitions(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ECSClient, Model::ListTaskDefinitionsRequest, Model::ListTaskDefinitionsOutcome> ListTaskDefinitionsPaginator(const Model::ListTaskDefinitionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListTasks(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ECSClient, Model::ListTasksRequest, Model::ListTasksOutcome> ListTasksPaginator(const Model::ListTasksRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CreateCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::CreateClusterRequest, Model::CreateClusterOutcome> CreateClusterAwaitable(Model::CreateClusterRequest request) const;
+
+        /**
+         * co_await-able form of CreateService(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::CreateServiceRequest, Model::CreateServiceOutcome> CreateServiceAwaitable(Model::CreateServiceRequest request) const;
+
+        /**
+         * co_await-able form of DeleteCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::DeleteClusterRequest, Model::DeleteClusterOutcome> DeleteClusterAwaitable(Model::DeleteClusterRequest request) const;
+
+        /**
+         * co_await-able form of DeleteService(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::DeleteServiceRequest, Model::DeleteServiceOutcome> DeleteServiceAwaitable(Model::DeleteServiceRequest request) const;
+
+        /**
+         * co_await-able form of DeregisterContainerInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::DeregisterContainerInstanceRequest, Model::DeregisterContainerInstanceOutcome> DeregisterContainerInstanceAwaitable(Model::DeregisterContainerInstanceRequest request) const;
+
+        /**
+         * co_await-able form of DeregisterTaskDefinition(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::DeregisterTaskDefinitionRequest, Model::DeregisterTaskDefinitionOutcome> DeregisterTaskDefinitionAwaitable(Model::DeregisterTaskDefinitionRequest request) const;
+
+        /**
+         * co_await-able form of DescribeClusters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::DescribeClustersRequest, Model::DescribeClustersOutcome> DescribeClustersAwaitable(Model::DescribeClustersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeContainerInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::DescribeContainerInstancesRequest, Model::DescribeContainerInstancesOutcome> DescribeContainerInstancesAwaitable(Model::DescribeContainerInstancesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeServices(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::DescribeServicesRequest, Model::DescribeServicesOutcome> DescribeServicesAwaitable(Model::DescribeServicesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTaskDefinition(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::DescribeTaskDefinitionRequest, Model::DescribeTaskDefinitionOutcome> DescribeTaskDefinitionAwaitable(Model::DescribeTaskDefinitionRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTasks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::DescribeTasksRequest, Model::DescribeTasksOutcome> DescribeTasksAwaitable(Model::DescribeTasksRequest request) const;
+
+        /**
+         * co_await-able form of DiscoverPollEndpoint(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::DiscoverPollEndpointRequest, Model::DiscoverPollEndpointOutcome> DiscoverPollEndpointAwaitable(Model::DiscoverPollEndpointRequest request) const;
+
+        /**
+         * co_await-able form of ListClusters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::ListClustersRequest, Model::ListClustersOutcome> ListClustersAwaitable(Model::ListClustersRequest request) const;
+
+        /**
+         * co_await-able form of ListContainerInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::ListContainerInstancesRequest, Model::ListContainerInstancesOutcome> ListContainerInstancesAwaitable(Model::ListContainerInstancesRequest request) const;
+
+        /**
+         * co_await-able form of ListServices(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::ListServicesRequest, Model::ListServicesOutcome> ListServicesAwaitable(Model::ListServicesRequest request) const;
+
+        /**
+         * co_await-able form of ListTaskDefinitionFamilies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::ListTaskDefinitionFamiliesRequest, Model::ListTaskDefinitionFamiliesOutcome> ListTaskDefinitionFamiliesAwaitable(Model::ListTaskDefinitionFamiliesRequest request) const;
+
+        /**
+         * co_await-able form of ListTaskDefinitions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::ListTaskDefinitionsRequest, Model::ListTaskDefinitionsOutcome> ListTaskDefinitionsAwaitable(Model::ListTaskDefinitionsRequest request) const;
+
+        /**
+         * co_await-able form of ListTasks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::ListTasksRequest, Model::ListTasksOutcome> ListTasksAwaitable(Model::ListTasksRequest request) const;
+
+        /**
+         * co_await-able form of RegisterContainerInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::RegisterContainerInstanceRequest, Model::RegisterContainerInstanceOutcome> RegisterContainerInstanceAwaitable(Model::RegisterContainerInstanceRequest request) const;
+
+        /**
+         * co_await-able form of RegisterTaskDefinition(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::RegisterTaskDefinitionRequest, Model::RegisterTaskDefinitionOutcome> RegisterTaskDefinitionAwaitable(Model::RegisterTaskDefinitionRequest request) const;
+
+        /**
+         * co_await-able form of RunTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::RunTaskRequest, Model::RunTaskOutcome> RunTaskAwaitable(Model::RunTaskRequest request) const;
+
+        /**
+         * co_await-able form of StartTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::StartTaskRequest, Model::StartTaskOutcome> StartTaskAwaitable(Model::StartTaskRequest request) const;
+
+        /**
+         * co_await-able form of StopTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::StopTaskRequest, Model::StopTaskOutcome> StopTaskAwaitable(Model::StopTaskRequest request) const;
+
+        /**
+         * co_await-able form of SubmitContainerStateChange(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::SubmitContainerStateChangeRequest, Model::SubmitContainerStateChangeOutcome> SubmitContainerStateChangeAwaitable(Model::SubmitContainerStateChangeRequest request) const;
+
+        /**
+         * co_await-able form of SubmitTaskStateChange(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::SubmitTaskStateChangeRequest, Model::SubmitTaskStateChangeOutcome> SubmitTaskStateChangeAwaitable(Model::SubmitTaskStateChangeRequest request) const;
+
+        /**
+         * co_await-able form of UpdateContainerAgent(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::UpdateContainerAgentRequest, Model::UpdateContainerAgentOutcome> UpdateContainerAgentAwaitable(Model::UpdateContainerAgentRequest request) const;
+
+        /**
+         * co_await-able form of UpdateService(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ECSClient, Model::UpdateServiceRequest, Model::UpdateServiceOutcome> UpdateServiceAwaitable(Model::UpdateServiceRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateCluster"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
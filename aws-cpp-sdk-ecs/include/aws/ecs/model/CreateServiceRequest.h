@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateServiceRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateService"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteCluster"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
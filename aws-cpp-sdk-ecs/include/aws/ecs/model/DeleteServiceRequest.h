@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteServiceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteService"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeregisterContainerInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeregisterContainerInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
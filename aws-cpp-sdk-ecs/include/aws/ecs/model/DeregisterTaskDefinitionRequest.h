@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeregisterTaskDefinitionRequest();
+    inline const char* GetServiceRequestName() const override { return "DeregisterTaskDefinition"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
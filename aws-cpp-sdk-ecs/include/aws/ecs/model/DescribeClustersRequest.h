@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeClustersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeClusters"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
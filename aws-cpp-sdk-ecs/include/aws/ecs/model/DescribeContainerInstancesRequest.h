@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeContainerInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeContainerInstances"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeTaskDefinitionRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTaskDefinition"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeTasksRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTasks"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
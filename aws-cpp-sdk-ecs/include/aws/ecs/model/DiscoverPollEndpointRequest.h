@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DiscoverPollEndpointRequest();
+    inline const char* GetServiceRequestName() const override { return "DiscoverPollEndpoint"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
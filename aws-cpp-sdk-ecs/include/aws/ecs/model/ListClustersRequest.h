@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListClustersRequest();
+    inline const char* GetServiceRequestName() const override { return "ListClusters"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListContainerInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListContainerInstances"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
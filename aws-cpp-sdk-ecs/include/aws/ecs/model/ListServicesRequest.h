@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListServicesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListServices"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListTaskDefinitionFamiliesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTaskDefinitionFamilies"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
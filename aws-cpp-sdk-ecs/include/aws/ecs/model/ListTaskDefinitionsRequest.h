@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListTaskDefinitionsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTaskDefinitions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
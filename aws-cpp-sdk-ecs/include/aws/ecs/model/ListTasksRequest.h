@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListTasksRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTasks"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
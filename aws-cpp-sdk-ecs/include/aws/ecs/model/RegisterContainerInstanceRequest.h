@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     RegisterContainerInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterContainerInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
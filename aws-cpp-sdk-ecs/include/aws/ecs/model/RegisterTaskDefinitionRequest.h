@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     RegisterTaskDefinitionRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterTaskDefinition"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
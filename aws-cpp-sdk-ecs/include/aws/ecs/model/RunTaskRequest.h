@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RunTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "RunTask"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     StartTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "StartTask"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     StopTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "StopTask"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SubmitContainerStateChangeRequest();
+    inline const char* GetServiceRequestName() const override { return "SubmitContainerStateChange"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
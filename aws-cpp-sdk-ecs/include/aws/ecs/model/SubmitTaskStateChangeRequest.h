@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     SubmitTaskStateChangeRequest();
+    inline const char* GetServiceRequestName() const override { return "SubmitTaskStateChange"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateContainerAgentRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateContainerAgent"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
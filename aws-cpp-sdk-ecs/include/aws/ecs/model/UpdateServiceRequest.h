@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateServiceRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateService"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -136,7 +136,7 @@ CreateClusterOutcome ECSClient::CreateCluster(const CreateClusterRequest& reques
 
 CreateClusterOutcomeCallable ECSClient::CreateClusterCallable(const CreateClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateCluster(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateCluster(request); } );
 }
 
 void ECSClient::CreateClusterAsync(const CreateClusterRequest& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -144,6 +144,16 @@ void ECSClient::CreateClusterAsync(const CreateClusterRequest& request, const Cr
   m_executor->Submit( [this, request, handler, context](){ this->CreateClusterAsyncHelper( request, handler, context ); } );
 }
 
+CreateClusterOutcomeCallable ECSClient::CreateClusterCallable(CreateClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::CreateCluster, this, std::move(request)));
+}
+
+void ECSClient::CreateClusterAsync(CreateClusterRequest&& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::CreateClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::CreateClusterAsyncHelper(const CreateClusterRequest& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateCluster(request), context);
@@ -167,7 +177,7 @@ CreateServiceOutcome ECSClient::CreateService(const CreateServiceRequest& reques
 
 CreateServiceOutcomeCallable ECSClient::CreateServiceCallable(const CreateServiceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateService(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateService(request); } );
 }
 
 void ECSClient::CreateServiceAsync(const CreateServiceRequest& request, const CreateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -175,6 +185,16 @@ void ECSClient::CreateServiceAsync(const CreateServiceRequest& request, const Cr
   m_executor->Submit( [this, request, handler, context](){ this->CreateServiceAsyncHelper( request, handler, context ); } );
 }
 
+CreateServiceOutcomeCallable ECSClient::CreateServiceCallable(CreateServiceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::CreateService, this, std::move(request)));
+}
+
+void ECSClient::CreateServiceAsync(CreateServiceRequest&& request, const CreateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::CreateServiceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::CreateServiceAsyncHelper(const CreateServiceRequest& request, const CreateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateService(request), context);
@@ -198,7 +218,7 @@ DeleteClusterOutcome ECSClient::DeleteCluster(const DeleteClusterRequest& reques
 
 DeleteClusterOutcomeCallable ECSClient::DeleteClusterCallable(const DeleteClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteCluster(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteCluster(request); } );
 }
 
 void ECSClient::DeleteClusterAsync(const DeleteClusterRequest& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -206,6 +226,16 @@ void ECSClient::DeleteClusterAsync(const DeleteClusterRequest& request, const De
   m_executor->Submit( [this, request, handler, context](){ this->DeleteClusterAsyncHelper( request, handler, context ); } );
 }
 
+DeleteClusterOutcomeCallable ECSClient::DeleteClusterCallable(DeleteClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::DeleteCluster, this, std::move(request)));
+}
+
+void ECSClient::DeleteClusterAsync(DeleteClusterRequest&& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::DeleteClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::DeleteClusterAsyncHelper(const DeleteClusterRequest& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteCluster(request), context);
@@ -229,7 +259,7 @@ DeleteServiceOutcome ECSClient::DeleteService(const DeleteServiceRequest& reques
 
 DeleteServiceOutcomeCallable ECSClient::DeleteServiceCallable(const DeleteServiceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteService(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteService(request); } );
 }
 
 void ECSClient::DeleteServiceAsync(const DeleteServiceRequest& request, const DeleteServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -237,6 +267,16 @@ void ECSClient::DeleteServiceAsync(const DeleteServiceRequest& request, const De
   m_executor->Submit( [this, request, handler, context](){ this->DeleteServiceAsyncHelper( request, handler, context ); } );
 }
 
+DeleteServiceOutcomeCallable ECSClient::DeleteServiceCallable(DeleteServiceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::DeleteService, this, std::move(request)));
+}
+
+void ECSClient::DeleteServiceAsync(DeleteServiceRequest&& request, const DeleteServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::DeleteServiceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::DeleteServiceAsyncHelper(const DeleteServiceRequest& request, const DeleteServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteService(request), context);
@@ -260,7 +300,7 @@ DeregisterContainerInstanceOutcome ECSClient::DeregisterContainerInstance(const
 
 DeregisterContainerInstanceOutcomeCallable ECSClient::DeregisterContainerInstanceCallable(const DeregisterContainerInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeregisterContainerInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeregisterContainerInstance(request); } );
 }
 
 void ECSClient::DeregisterContainerInstanceAsync(const DeregisterContainerInstanceRequest& request, const DeregisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -268,6 +308,16 @@ void ECSClient::DeregisterContainerInstanceAsync(const DeregisterContainerInstan
   m_executor->Submit( [this, request, handler, context](){ this->DeregisterContainerInstanceAsyncHelper( request, handler, context ); } );
 }
 
+DeregisterContainerInstanceOutcomeCallable ECSClient::DeregisterContainerInstanceCallable(DeregisterContainerInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::DeregisterContainerInstance, this, std::move(request)));
+}
+
+void ECSClient::DeregisterContainerInstanceAsync(DeregisterContainerInstanceRequest&& request, const DeregisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::DeregisterContainerInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::DeregisterContainerInstanceAsyncHelper(const DeregisterContainerInstanceRequest& request, const DeregisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeregisterContainerInstance(request), context);
@@ -291,7 +341,7 @@ DeregisterTaskDefinitionOutcome ECSClient::DeregisterTaskDefinition(const Deregi
 
 DeregisterTaskDefinitionOutcomeCallable ECSClient::DeregisterTaskDefinitionCallable(const DeregisterTaskDefinitionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeregisterTaskDefinition(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeregisterTaskDefinition(request); } );
 }
 
 void ECSClient::DeregisterTaskDefinitionAsync(const DeregisterTaskDefinitionRequest& request, const DeregisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -299,6 +349,16 @@ void ECSClient::DeregisterTaskDefinitionAsync(const DeregisterTaskDefinitionRequ
   m_executor->Submit( [this, request, handler, context](){ this->DeregisterTaskDefinitionAsyncHelper( request, handler, context ); } );
 }
 
+DeregisterTaskDefinitionOutcomeCallable ECSClient::DeregisterTaskDefinitionCallable(DeregisterTaskDefinitionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::DeregisterTaskDefinition, this, std::move(request)));
+}
+
+void ECSClient::DeregisterTaskDefinitionAsync(DeregisterTaskDefinitionRequest&& request, const DeregisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::DeregisterTaskDefinitionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::DeregisterTaskDefinitionAsyncHelper(const DeregisterTaskDefinitionRequest& request, const DeregisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeregisterTaskDefinition(request), context);
@@ -322,7 +382,7 @@ DescribeClustersOutcome ECSClient::DescribeClusters(const DescribeClustersReques
 
 DescribeClustersOutcomeCallable ECSClient::DescribeClustersCallable(const DescribeClustersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeClusters(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeClusters(request); } );
 }
 
 void ECSClient::DescribeClustersAsync(const DescribeClustersRequest& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -330,6 +390,16 @@ void ECSClient::DescribeClustersAsync(const DescribeClustersRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DescribeClustersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeClustersOutcomeCallable ECSClient::DescribeClustersCallable(DescribeClustersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::DescribeClusters, this, std::move(request)));
+}
+
+void ECSClient::DescribeClustersAsync(DescribeClustersRequest&& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::DescribeClustersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::DescribeClustersAsyncHelper(const DescribeClustersRequest& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeClusters(request), context);
@@ -353,7 +423,7 @@ DescribeContainerInstancesOutcome ECSClient::DescribeContainerInstances(const De
 
 DescribeContainerInstancesOutcomeCallable ECSClient::DescribeContainerInstancesCallable(const DescribeContainerInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeContainerInstances(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeContainerInstances(request); } );
 }
 
 void ECSClient::DescribeContainerInstancesAsync(const DescribeContainerInstancesRequest& request, const DescribeContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -361,6 +431,16 @@ void ECSClient::DescribeContainerInstancesAsync(const DescribeContainerInstances
   m_executor->Submit( [this, request, handler, context](){ this->DescribeContainerInstancesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeContainerInstancesOutcomeCallable ECSClient::DescribeContainerInstancesCallable(DescribeContainerInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::DescribeContainerInstances, this, std::move(request)));
+}
+
+void ECSClient::DescribeContainerInstancesAsync(DescribeContainerInstancesRequest&& request, const DescribeContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::DescribeContainerInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::DescribeContainerInstancesAsyncHelper(const DescribeContainerInstancesRequest& request, const DescribeContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeContainerInstances(request), context);
@@ -384,7 +464,7 @@ DescribeServicesOutcome ECSClient::DescribeServices(const DescribeServicesReques
 
 DescribeServicesOutcomeCallable ECSClient::DescribeServicesCallable(const DescribeServicesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeServices(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeServices(request); } );
 }
 
 void ECSClient::DescribeServicesAsync(const DescribeServicesRequest& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -392,6 +472,16 @@ void ECSClient::DescribeServicesAsync(const DescribeServicesRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DescribeServicesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeServicesOutcomeCallable ECSClient::DescribeServicesCallable(DescribeServicesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::DescribeServices, this, std::move(request)));
+}
+
+void ECSClient::DescribeServicesAsync(DescribeServicesRequest&& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::DescribeServicesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::DescribeServicesAsyncHelper(const DescribeServicesRequest& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeServices(request), context);
@@ -415,7 +505,7 @@ DescribeTaskDefinitionOutcome ECSClient::DescribeTaskDefinition(const DescribeTa
 
 DescribeTaskDefinitionOutcomeCallable ECSClient::DescribeTaskDefinitionCallable(const DescribeTaskDefinitionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTaskDefinition(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTaskDefinition(request); } );
 }
 
 void ECSClient::DescribeTaskDefinitionAsync(const DescribeTaskDefinitionRequest& request, const DescribeTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -423,6 +513,16 @@ void ECSClient::DescribeTaskDefinitionAsync(const DescribeTaskDefinitionRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTaskDefinitionAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTaskDefinitionOutcomeCallable ECSClient::DescribeTaskDefinitionCallable(DescribeTaskDefinitionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::DescribeTaskDefinition, this, std::move(request)));
+}
+
+void ECSClient::DescribeTaskDefinitionAsync(DescribeTaskDefinitionRequest&& request, const DescribeTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::DescribeTaskDefinitionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::DescribeTaskDefinitionAsyncHelper(const DescribeTaskDefinitionRequest& request, const DescribeTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTaskDefinition(request), context);
@@ -446,7 +546,7 @@ DescribeTasksOutcome ECSClient::DescribeTasks(const DescribeTasksRequest& reques
 
 DescribeTasksOutcomeCallable ECSClient::DescribeTasksCallable(const DescribeTasksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTasks(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTasks(request); } );
 }
 
 void ECSClient::DescribeTasksAsync(const DescribeTasksRequest& request, const DescribeTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -454,6 +554,16 @@ void ECSClient::DescribeTasksAsync(const DescribeTasksRequest& request, const De
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTasksAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTasksOutcomeCallable ECSClient::DescribeTasksCallable(DescribeTasksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::DescribeTasks, this, std::move(request)));
+}
+
+void ECSClient::DescribeTasksAsync(DescribeTasksRequest&& request, const DescribeTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::DescribeTasksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::DescribeTasksAsyncHelper(const DescribeTasksRequest& request, const DescribeTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTasks(request), context);
@@ -477,7 +587,7 @@ DiscoverPollEndpointOutcome ECSClient::DiscoverPollEndpoint(const DiscoverPollEn
 
 DiscoverPollEndpointOutcomeCallable ECSClient::DiscoverPollEndpointCallable(const DiscoverPollEndpointRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DiscoverPollEndpoint(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DiscoverPollEndpoint(request); } );
 }
 
 void ECSClient::DiscoverPollEndpointAsync(const DiscoverPollEndpointRequest& request, const DiscoverPollEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -485,6 +595,16 @@ void ECSClient::DiscoverPollEndpointAsync(const DiscoverPollEndpointRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DiscoverPollEndpointAsyncHelper( request, handler, context ); } );
 }
 
+DiscoverPollEndpointOutcomeCallable ECSClient::DiscoverPollEndpointCallable(DiscoverPollEndpointRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::DiscoverPollEndpoint, this, std::move(request)));
+}
+
+void ECSClient::DiscoverPollEndpointAsync(DiscoverPollEndpointRequest&& request, const DiscoverPollEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::DiscoverPollEndpointAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::DiscoverPollEndpointAsyncHelper(const DiscoverPollEndpointRequest& request, const DiscoverPollEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DiscoverPollEndpoint(request), context);
@@ -508,7 +628,7 @@ ListClustersOutcome ECSClient::ListClusters(const ListClustersRequest& request)
 
 ListClustersOutcomeCallable ECSClient::ListClustersCallable(const ListClustersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListClusters(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListClusters(request); } );
 }
 
 void ECSClient::ListClustersAsync(const ListClustersRequest& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -516,6 +636,16 @@ void ECSClient::ListClustersAsync(const ListClustersRequest& request, const List
   m_executor->Submit( [this, request, handler, context](){ this->ListClustersAsyncHelper( request, handler, context ); } );
 }
 
+ListClustersOutcomeCallable ECSClient::ListClustersCallable(ListClustersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::ListClusters, this, std::move(request)));
+}
+
+void ECSClient::ListClustersAsync(ListClustersRequest&& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::ListClustersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::ListClustersAsyncHelper(const ListClustersRequest& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListClusters(request), context);
@@ -539,7 +669,7 @@ ListContainerInstancesOutcome ECSClient::ListContainerInstances(const ListContai
 
 ListContainerInstancesOutcomeCallable ECSClient::ListContainerInstancesCallable(const ListContainerInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListContainerInstances(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListContainerInstances(request); } );
 }
 
 void ECSClient::ListContainerInstancesAsync(const ListContainerInstancesRequest& request, const ListContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -547,6 +677,16 @@ void ECSClient::ListContainerInstancesAsync(const ListContainerInstancesRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ListContainerInstancesAsyncHelper( request, handler, context ); } );
 }
 
+ListContainerInstancesOutcomeCallable ECSClient::ListContainerInstancesCallable(ListContainerInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::ListContainerInstances, this, std::move(request)));
+}
+
+void ECSClient::ListContainerInstancesAsync(ListContainerInstancesRequest&& request, const ListContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::ListContainerInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::ListContainerInstancesAsyncHelper(const ListContainerInstancesRequest& request, const ListContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListContainerInstances(request), context);
@@ -570,7 +710,7 @@ ListServicesOutcome ECSClient::ListServices(const ListServicesRequest& request)
 
 ListServicesOutcomeCallable ECSClient::ListServicesCallable(const ListServicesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListServices(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListServices(request); } );
 }
 
 void ECSClient::ListServicesAsync(const ListServicesRequest& request, const ListServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -578,6 +718,16 @@ void ECSClient::ListServicesAsync(const ListServicesRequest& request, const List
   m_executor->Submit( [this, request, handler, context](){ this->ListServicesAsyncHelper( request, handler, context ); } );
 }
 
+ListServicesOutcomeCallable ECSClient::ListServicesCallable(ListServicesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::ListServices, this, std::move(request)));
+}
+
+void ECSClient::ListServicesAsync(ListServicesRequest&& request, const ListServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::ListServicesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::ListServicesAsyncHelper(const ListServicesRequest& request, const ListServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListServices(request), context);
@@ -601,7 +751,7 @@ ListTaskDefinitionFamiliesOutcome ECSClient::ListTaskDefinitionFamilies(const Li
 
 ListTaskDefinitionFamiliesOutcomeCallable ECSClient::ListTaskDefinitionFamiliesCallable(const ListTaskDefinitionFamiliesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTaskDefinitionFamilies(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTaskDefinitionFamilies(request); } );
 }
 
 void ECSClient::ListTaskDefinitionFamiliesAsync(const ListTaskDefinitionFamiliesRequest& request, const ListTaskDefinitionFamiliesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -609,6 +759,16 @@ void ECSClient::ListTaskDefinitionFamiliesAsync(const ListTaskDefinitionFamilies
   m_executor->Submit( [this, request, handler, context](){ this->ListTaskDefinitionFamiliesAsyncHelper( request, handler, context ); } );
 }
 
+ListTaskDefinitionFamiliesOutcomeCallable ECSClient::ListTaskDefinitionFamiliesCallable(ListTaskDefinitionFamiliesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::ListTaskDefinitionFamilies, this, std::move(request)));
+}
+
+void ECSClient::ListTaskDefinitionFamiliesAsync(ListTaskDefinitionFamiliesRequest&& request, const ListTaskDefinitionFamiliesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::ListTaskDefinitionFamiliesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::ListTaskDefinitionFamiliesAsyncHelper(const ListTaskDefinitionFamiliesRequest& request, const ListTaskDefinitionFamiliesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTaskDefinitionFamilies(request), context);
@@ -632,7 +792,7 @@ ListTaskDefinitionsOutcome ECSClient::ListTaskDefinitions(const ListTaskDefiniti
 
 ListTaskDefinitionsOutcomeCallable ECSClient::ListTaskDefinitionsCallable(const ListTaskDefinitionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTaskDefinitions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTaskDefinitions(request); } );
 }
 
 void ECSClient::ListTaskDefinitionsAsync(const ListTaskDefinitionsRequest& request, const ListTaskDefinitionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -640,6 +800,16 @@ void ECSClient::ListTaskDefinitionsAsync(const ListTaskDefinitionsRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ListTaskDefinitionsAsyncHelper( request, handler, context ); } );
 }
 
+ListTaskDefinitionsOutcomeCallable ECSClient::ListTaskDefinitionsCallable(ListTaskDefinitionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::ListTaskDefinitions, this, std::move(request)));
+}
+
+void ECSClient::ListTaskDefinitionsAsync(ListTaskDefinitionsRequest&& request, const ListTaskDefinitionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::ListTaskDefinitionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::ListTaskDefinitionsAsyncHelper(const ListTaskDefinitionsRequest& request, const ListTaskDefinitionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTaskDefinitions(request), context);
@@ -663,7 +833,7 @@ ListTasksOutcome ECSClient::ListTasks(const ListTasksRequest& request) const
 
 ListTasksOutcomeCallable ECSClient::ListTasksCallable(const ListTasksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTasks(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTasks(request); } );
 }
 
 void ECSClient::ListTasksAsync(const ListTasksRequest& request, const ListTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -671,6 +841,16 @@ void ECSClient::ListTasksAsync(const ListTasksRequest& request, const ListTasksR
   m_executor->Submit( [this, request, handler, context](){ this->ListTasksAsyncHelper( request, handler, context ); } );
 }
 
+ListTasksOutcomeCallable ECSClient::ListTasksCallable(ListTasksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::ListTasks, this, std::move(request)));
+}
+
+void ECSClient::ListTasksAsync(ListTasksRequest&& request, const ListTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::ListTasksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::ListTasksAsyncHelper(const ListTasksRequest& request, const ListTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTasks(request), context);
@@ -694,7 +874,7 @@ RegisterContainerInstanceOutcome ECSClient::RegisterContainerInstance(const Regi
 
 RegisterContainerInstanceOutcomeCallable ECSClient::RegisterContainerInstanceCallable(const RegisterContainerInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterContainerInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterContainerInstance(request); } );
 }
 
 void ECSClient::RegisterContainerInstanceAsync(const RegisterContainerInstanceRequest& request, const RegisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -702,6 +882,16 @@ void ECSClient::RegisterContainerInstanceAsync(const RegisterContainerInstanceRe
   m_executor->Submit( [this, request, handler, context](){ this->RegisterContainerInstanceAsyncHelper( request, handler, context ); } );
 }
 
+RegisterContainerInstanceOutcomeCallable ECSClient::RegisterContainerInstanceCallable(RegisterContainerInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::RegisterContainerInstance, this, std::move(request)));
+}
+
+void ECSClient::RegisterContainerInstanceAsync(RegisterContainerInstanceRequest&& request, const RegisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::RegisterContainerInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::RegisterContainerInstanceAsyncHelper(const RegisterContainerInstanceRequest& request, const RegisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterContainerInstance(request), context);
@@ -725,7 +915,7 @@ RegisterTaskDefinitionOutcome ECSClient::RegisterTaskDefinition(const RegisterTa
 
 RegisterTaskDefinitionOutcomeCallable ECSClient::RegisterTaskDefinitionCallable(const RegisterTaskDefinitionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterTaskDefinition(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterTaskDefinition(request); } );
 }
 
 void ECSClient::RegisterTaskDefinitionAsync(const RegisterTaskDefinitionRequest& request, const RegisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -733,6 +923,16 @@ void ECSClient::RegisterTaskDefinitionAsync(const RegisterTaskDefinitionRequest&
   m_executor->Submit( [this, request, handler, context](){ this->RegisterTaskDefinitionAsyncHelper( request, handler, context ); } );
 }
 
+RegisterTaskDefinitionOutcomeCallable ECSClient::RegisterTaskDefinitionCallable(RegisterTaskDefinitionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::RegisterTaskDefinition, this, std::move(request)));
+}
+
+void ECSClient::RegisterTaskDefinitionAsync(RegisterTaskDefinitionRequest&& request, const RegisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::RegisterTaskDefinitionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::RegisterTaskDefinitionAsyncHelper(const RegisterTaskDefinitionRequest& request, const RegisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterTaskDefinition(request), context);
@@ -756,7 +956,7 @@ RunTaskOutcome ECSClient::RunTask(const RunTaskRequest& request) const
 
 RunTaskOutcomeCallable ECSClient::RunTaskCallable(const RunTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RunTask(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RunTask(request); } );
 }
 
 void ECSClient::RunTaskAsync(const RunTaskRequest& request, const RunTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -764,6 +964,16 @@ void ECSClient::RunTaskAsync(const RunTaskRequest& request, const RunTaskRespons
   m_executor->Submit( [this, request, handler, context](){ this->RunTaskAsyncHelper( request, handler, context ); } );
 }
 
+RunTaskOutcomeCallable ECSClient::RunTaskCallable(RunTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::RunTask, this, std::move(request)));
+}
+
+void ECSClient::RunTaskAsync(RunTaskRequest&& request, const RunTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::RunTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::RunTaskAsyncHelper(const RunTaskRequest& request, const RunTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RunTask(request), context);
@@ -787,7 +997,7 @@ StartTaskOutcome ECSClient::StartTask(const StartTaskRequest& request) const
 
 StartTaskOutcomeCallable ECSClient::StartTaskCallable(const StartTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StartTask(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StartTask(request); } );
 }
 
 void ECSClient::StartTaskAsync(const StartTaskRequest& request, const StartTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -795,6 +1005,16 @@ void ECSClient::StartTaskAsync(const StartTaskRequest& request, const StartTaskR
   m_executor->Submit( [this, request, handler, context](){ this->StartTaskAsyncHelper( request, handler, context ); } );
 }
 
+StartTaskOutcomeCallable ECSClient::StartTaskCallable(StartTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::StartTask, this, std::move(request)));
+}
+
+void ECSClient::StartTaskAsync(StartTaskRequest&& request, const StartTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::StartTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::StartTaskAsyncHelper(const StartTaskRequest& request, const StartTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StartTask(request), context);
@@ -818,7 +1038,7 @@ StopTaskOutcome ECSClient::StopTask(const StopTaskRequest& request) const
 
 StopTaskOutcomeCallable ECSClient::StopTaskCallable(const StopTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StopTask(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StopTask(request); } );
 }
 
 void ECSClient::StopTaskAsync(const StopTaskRequest& request, const StopTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -826,6 +1046,16 @@ void ECSClient::StopTaskAsync(const StopTaskRequest& request, const StopTaskResp
   m_executor->Submit( [this, request, handler, context](){ this->StopTaskAsyncHelper( request, handler, context ); } );
 }
 
+StopTaskOutcomeCallable ECSClient::StopTaskCallable(StopTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::StopTask, this, std::move(request)));
+}
+
+void ECSClient::StopTaskAsync(StopTaskRequest&& request, const StopTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::StopTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::StopTaskAsyncHelper(const StopTaskRequest& request, const StopTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StopTask(request), context);
@@ -849,7 +1079,7 @@ SubmitContainerStateChangeOutcome ECSClient::SubmitContainerStateChange(const Su
 
 SubmitContainerStateChangeOutcomeCallable ECSClient::SubmitContainerStateChangeCallable(const SubmitContainerStateChangeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SubmitContainerStateChange(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SubmitContainerStateChange(request); } );
 }
 
 void ECSClient::SubmitContainerStateChangeAsync(const SubmitContainerStateChangeRequest& request, const SubmitContainerStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -857,6 +1087,16 @@ void ECSClient::SubmitContainerStateChangeAsync(const SubmitContainerStateChange
   m_executor->Submit( [this, request, handler, context](){ this->SubmitContainerStateChangeAsyncHelper( request, handler, context ); } );
 }
 
+SubmitContainerStateChangeOutcomeCallable ECSClient::SubmitContainerStateChangeCallable(SubmitContainerStateChangeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::SubmitContainerStateChange, this, std::move(request)));
+}
+
+void ECSClient::SubmitContainerStateChangeAsync(SubmitContainerStateChangeRequest&& request, const SubmitContainerStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::SubmitContainerStateChangeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::SubmitContainerStateChangeAsyncHelper(const SubmitContainerStateChangeRequest& request, const SubmitContainerStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SubmitContainerStateChange(request), context);
@@ -880,7 +1120,7 @@ SubmitTaskStateChangeOutcome ECSClient::SubmitTaskStateChange(const SubmitTaskSt
 
 SubmitTaskStateChangeOutcomeCallable ECSClient::SubmitTaskStateChangeCallable(const SubmitTaskStateChangeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SubmitTaskStateChange(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SubmitTaskStateChange(request); } );
 }
 
 void ECSClient::SubmitTaskStateChangeAsync(const SubmitTaskStateChangeRequest& request, const SubmitTaskStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -888,6 +1128,16 @@ void ECSClient::SubmitTaskStateChangeAsync(const SubmitTaskStateChangeRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->SubmitTaskStateChangeAsyncHelper( request, handler, context ); } );
 }
 
+SubmitTaskStateChangeOutcomeCallable ECSClient::SubmitTaskStateChangeCallable(SubmitTaskStateChangeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::SubmitTaskStateChange, this, std::move(request)));
+}
+
+void ECSClient::SubmitTaskStateChangeAsync(SubmitTaskStateChangeRequest&& request, const SubmitTaskStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::SubmitTaskStateChangeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::SubmitTaskStateChangeAsyncHelper(const SubmitTaskStateChangeRequest& request, const SubmitTaskStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SubmitTaskStateChange(request), context);
@@ -911,7 +1161,7 @@ UpdateContainerAgentOutcome ECSClient::UpdateContainerAgent(const UpdateContaine
 
 UpdateContainerAgentOutcomeCallable ECSClient::UpdateContainerAgentCallable(const UpdateContainerAgentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateContainerAgent(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateContainerAgent(request); } );
 }
 
 void ECSClient::UpdateContainerAgentAsync(const UpdateContainerAgentRequest& request, const UpdateContainerAgentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -919,6 +1169,16 @@ void ECSClient::UpdateContainerAgentAsync(const UpdateContainerAgentRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->UpdateContainerAgentAsyncHelper( request, handler, context ); } );
 }
 
+UpdateContainerAgentOutcomeCallable ECSClient::UpdateContainerAgentCallable(UpdateContainerAgentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::UpdateContainerAgent, this, std::move(request)));
+}
+
+void ECSClient::UpdateContainerAgentAsync(UpdateContainerAgentRequest&& request, const UpdateContainerAgentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::UpdateContainerAgentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::UpdateContainerAgentAsyncHelper(const UpdateContainerAgentRequest& request, const UpdateContainerAgentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateContainerAgent(request), context);
@@ -942,7 +1202,7 @@ UpdateServiceOutcome ECSClient::UpdateService(const UpdateServiceRequest& reques
 
 UpdateServiceOutcomeCallable ECSClient::UpdateServiceCallable(const UpdateServiceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateService(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateService(request); } );
 }
 
 void ECSClient::UpdateServiceAsync(const UpdateServiceRequest& request, const UpdateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -950,8 +1210,257 @@ void ECSClient::UpdateServiceAsync(const UpdateServiceRequest& request, const Up
   m_executor->Submit( [this, request, handler, context](){ this->UpdateServiceAsyncHelper( request, handler, context ); } );
 }
 
+UpdateServiceOutcomeCallable ECSClient::UpdateServiceCallable(UpdateServiceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ECSClient::UpdateService, this, std::move(request)));
+}
+
+void ECSClient::UpdateServiceAsync(UpdateServiceRequest&& request, const UpdateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ECSClient::UpdateServiceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ECSClient::UpdateServiceAsyncHelper(const UpdateServiceRequest& request, const UpdateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateService(request), context);
 }
 
+Paginator<ECSClient, ListClustersRequest, ListClustersOutcome> ECSClient::ListClustersPaginator(const ListClustersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ECSClient, ListClustersRequest, ListClustersOutcome>(this, &ECSClient::ListClusters, request,
+    [](const ListClustersRequest& current, const ListClustersOutcome& outcome, ListClustersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ECSClient, ListContainerInstancesRequest, ListContainerInstancesOutcome> ECSClient::ListContainerInstancesPaginator(const ListContainerInstancesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ECSClient, ListContainerInstancesRequest, ListContainerInstancesOutcome>(this, &ECSClient::ListContainerInstances, request,
+    [](const ListContainerInstancesRequest& current, const ListContainerInstancesOutcome& outcome, ListContainerInstancesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ECSClient, ListServicesRequest, ListServicesOutcome> ECSClient::ListServicesPaginator(const ListServicesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ECSClient, ListServicesRequest, ListServicesOutcome>(this, &ECSClient::ListServices, request,
+    [](const ListServicesRequest& current, const ListServicesOutcome& outcome, ListServicesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ECSClient, ListTaskDefinitionFamiliesRequest, ListTaskDefinitionFamiliesOutcome> ECSClient::ListTaskDefinitionFamiliesPaginator(const ListTaskDefinitionFamiliesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ECSClient, ListTaskDefinitionFamiliesRequest, ListTaskDefinitionFamiliesOutcome>(this, &ECSClient::ListTaskDefinitionFamilies, request,
+    [](const ListTaskDefinitionFamiliesRequest& current, const ListTaskDefinitionFamiliesOutcome& outcome, ListTaskDefinitionFamiliesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ECSClient, ListTaskDefinitionsRequest, ListTaskDefinitionsOutcome> ECSClient::ListTaskDefinitionsPaginator(const ListTaskDefinitionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ECSClient, ListTaskDefinitionsRequest, ListTaskDefinitionsOutcome>(this, &ECSClient::ListTaskDefinitions, request,
+    [](const ListTaskDefinitionsRequest& current, const ListTaskDefinitionsOutcome& outcome, ListTaskDefinitionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ECSClient, ListTasksRequest, ListTasksOutcome> ECSClient::ListTasksPaginator(const ListTasksRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ECSClient, ListTasksRequest, ListTasksOutcome>(this, &ECSClient::ListTasks, request,
+    [](const ListTasksRequest& current, const ListTasksOutcome& outcome, ListTasksRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<ECSClient, CreateClusterRequest, CreateClusterOutcome> ECSClient::CreateClusterAwaitable(CreateClusterRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::CreateCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, CreateServiceRequest, CreateServiceOutcome> ECSClient::CreateServiceAwaitable(CreateServiceRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::CreateService, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, DeleteClusterRequest, DeleteClusterOutcome> ECSClient::DeleteClusterAwaitable(DeleteClusterRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::DeleteCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, DeleteServiceRequest, DeleteServiceOutcome> ECSClient::DeleteServiceAwaitable(DeleteServiceRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::DeleteService, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, DeregisterContainerInstanceRequest, DeregisterContainerInstanceOutcome> ECSClient::DeregisterContainerInstanceAwaitable(DeregisterContainerInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::DeregisterContainerInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, DeregisterTaskDefinitionRequest, DeregisterTaskDefinitionOutcome> ECSClient::DeregisterTaskDefinitionAwaitable(DeregisterTaskDefinitionRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::DeregisterTaskDefinition, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, DescribeClustersRequest, DescribeClustersOutcome> ECSClient::DescribeClustersAwaitable(DescribeClustersRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::DescribeClusters, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, DescribeContainerInstancesRequest, DescribeContainerInstancesOutcome> ECSClient::DescribeContainerInstancesAwaitable(DescribeContainerInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::DescribeContainerInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, DescribeServicesRequest, DescribeServicesOutcome> ECSClient::DescribeServicesAwaitable(DescribeServicesRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::DescribeServices, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, DescribeTaskDefinitionRequest, DescribeTaskDefinitionOutcome> ECSClient::DescribeTaskDefinitionAwaitable(DescribeTaskDefinitionRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::DescribeTaskDefinition, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, DescribeTasksRequest, DescribeTasksOutcome> ECSClient::DescribeTasksAwaitable(DescribeTasksRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::DescribeTasks, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, DiscoverPollEndpointRequest, DiscoverPollEndpointOutcome> ECSClient::DiscoverPollEndpointAwaitable(DiscoverPollEndpointRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::DiscoverPollEndpoint, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, ListClustersRequest, ListClustersOutcome> ECSClient::ListClustersAwaitable(ListClustersRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::ListClusters, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, ListContainerInstancesRequest, ListContainerInstancesOutcome> ECSClient::ListContainerInstancesAwaitable(ListContainerInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::ListContainerInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, ListServicesRequest, ListServicesOutcome> ECSClient::ListServicesAwaitable(ListServicesRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::ListServices, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, ListTaskDefinitionFamiliesRequest, ListTaskDefinitionFamiliesOutcome> ECSClient::ListTaskDefinitionFamiliesAwaitable(ListTaskDefinitionFamiliesRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::ListTaskDefinitionFamilies, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, ListTaskDefinitionsRequest, ListTaskDefinitionsOutcome> ECSClient::ListTaskDefinitionsAwaitable(ListTaskDefinitionsRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::ListTaskDefinitions, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, ListTasksRequest, ListTasksOutcome> ECSClient::ListTasksAwaitable(ListTasksRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::ListTasks, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, RegisterContainerInstanceRequest, RegisterContainerInstanceOutcome> ECSClient::RegisterContainerInstanceAwaitable(RegisterContainerInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::RegisterContainerInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, RegisterTaskDefinitionRequest, RegisterTaskDefinitionOutcome> ECSClient::RegisterTaskDefinitionAwaitable(RegisterTaskDefinitionRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::RegisterTaskDefinition, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, RunTaskRequest, RunTaskOutcome> ECSClient::RunTaskAwaitable(RunTaskRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::RunTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, StartTaskRequest, StartTaskOutcome> ECSClient::StartTaskAwaitable(StartTaskRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::StartTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, StopTaskRequest, StopTaskOutcome> ECSClient::StopTaskAwaitable(StopTaskRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::StopTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, SubmitContainerStateChangeRequest, SubmitContainerStateChangeOutcome> ECSClient::SubmitContainerStateChangeAwaitable(SubmitContainerStateChangeRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::SubmitContainerStateChange, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, SubmitTaskStateChangeRequest, SubmitTaskStateChangeOutcome> ECSClient::SubmitTaskStateChangeAwaitable(SubmitTaskStateChangeRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::SubmitTaskStateChange, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, UpdateContainerAgentRequest, UpdateContainerAgentOutcome> ECSClient::UpdateContainerAgentAwaitable(UpdateContainerAgentRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::UpdateContainerAgent, std::move(request) } };
+}
+
+ClientOperationAwaitable<ECSClient, UpdateServiceRequest, UpdateServiceOutcome> ECSClient::UpdateServiceAwaitable(UpdateServiceRequest request) const
+{
+  return { m_executor.get(), { this, &ECSClient::UpdateService, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
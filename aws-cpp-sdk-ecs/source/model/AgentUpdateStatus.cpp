@@ -29,41 +29,41 @@ namespace Aws
       namespace AgentUpdateStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int STAGING_HASH = HashingUtils::HashString("STAGING");
-        static const int STAGED_HASH = HashingUtils::HashString("STAGED");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int UPDATED_HASH = HashingUtils::HashString("UPDATED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PENDING_HASH = 35394935;
+        static const int STAGING_HASH = -1179540453;
+        static const int STAGED_HASH = -1839165146;
+        static const int UPDATING_HASH = 2105227078;
+        static const int UPDATED_HASH = 483552411;
+        static const int FAILED_HASH = 2066319421;
 
 
         AgentUpdateStatus GetAgentUpdateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          switch (hashCode)
           {
+          case PENDING_HASH:
             return AgentUpdateStatus::PENDING;
-          }
-          else if (hashCode == STAGING_HASH)
-          {
+          case STAGING_HASH:
             return AgentUpdateStatus::STAGING;
-          }
-          else if (hashCode == STAGED_HASH)
-          {
+          case STAGED_HASH:
             return AgentUpdateStatus::STAGED;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
+          case UPDATING_HASH:
             return AgentUpdateStatus::UPDATING;
-          }
-          else if (hashCode == UPDATED_HASH)
-          {
+          case UPDATED_HASH:
             return AgentUpdateStatus::UPDATED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return AgentUpdateStatus::FAILED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace DesiredStatusMapper
       {
 
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int RUNNING_HASH = -2026200673;
+        static const int PENDING_HASH = 35394935;
+        static const int STOPPED_HASH = -1166336595;
 
 
         DesiredStatus GetDesiredStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RUNNING_HASH)
+          switch (hashCode)
           {
+          case RUNNING_HASH:
             return DesiredStatus::RUNNING;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
+          case PENDING_HASH:
             return DesiredStatus::PENDING;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
+          case STOPPED_HASH:
             return DesiredStatus::STOPPED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,46 +29,44 @@ namespace Aws
       namespace LogDriverMapper
       {
 
-        static const int json_file_HASH = HashingUtils::HashString("json-file");
-        static const int syslog_HASH = HashingUtils::HashString("syslog");
-        static const int journald_HASH = HashingUtils::HashString("journald");
-        static const int gelf_HASH = HashingUtils::HashString("gelf");
-        static const int fluentd_HASH = HashingUtils::HashString("fluentd");
-        static const int awslogs_HASH = HashingUtils::HashString("awslogs");
-        static const int splunk_HASH = HashingUtils::HashString("splunk");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int json_file_HASH = -1129317567;
+        static const int syslog_HASH = -887335593;
+        static const int journald_HASH = -1053738995;
+        static const int gelf_HASH = 3168984;
+        static const int fluentd_HASH = -760786488;
+        static const int awslogs_HASH = -590054868;
+        static const int splunk_HASH = -895847197;
 
 
         LogDriver GetLogDriverForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == json_file_HASH)
+          switch (hashCode)
           {
+          case json_file_HASH:
             return LogDriver::json_file;
-          }
-          else if (hashCode == syslog_HASH)
-          {
+          case syslog_HASH:
             return LogDriver::syslog;
-          }
-          else if (hashCode == journald_HASH)
-          {
+          case journald_HASH:
             return LogDriver::journald;
-          }
-          else if (hashCode == gelf_HASH)
-          {
+          case gelf_HASH:
             return LogDriver::gelf;
-          }
-          else if (hashCode == fluentd_HASH)
-          {
+          case fluentd_HASH:
             return LogDriver::fluentd;
-          }
-          else if (hashCode == awslogs_HASH)
-          {
+          case awslogs_HASH:
             return LogDriver::awslogs;
-          }
-          else if (hashCode == splunk_HASH)
-          {
+          case splunk_HASH:
             return LogDriver::splunk;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
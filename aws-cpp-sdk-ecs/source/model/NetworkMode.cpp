@@ -29,26 +29,32 @@ namespace Aws
       namespace NetworkModeMapper
       {
 
-        static const int bridge_HASH = HashingUtils::HashString("bridge");
-        static const int host_HASH = HashingUtils::HashString("host");
-        static const int none_HASH = HashingUtils::HashString("none");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int bridge_HASH = -1380801655;
+        static const int host_HASH = 3208616;
+        static const int none_HASH = 3387192;
 
 
         NetworkMode GetNetworkModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == bridge_HASH)
+          switch (hashCode)
           {
+          case bridge_HASH:
             return NetworkMode::bridge;
-          }
-          else if (hashCode == host_HASH)
-          {
+          case host_HASH:
             return NetworkMode::host;
-          }
-          else if (hashCode == none_HASH)
-          {
+          case none_HASH:
             return NetworkMode::none;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
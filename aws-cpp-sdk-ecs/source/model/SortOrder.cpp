@@ -29,21 +29,29 @@ namespace Aws
       namespace SortOrderMapper
       {
 
-        static const int ASC_HASH = HashingUtils::HashString("ASC");
-        static const int DESC_HASH = HashingUtils::HashString("DESC");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ASC_HASH = 65105;
+        static const int DESC_HASH = 2094737;
 
 
         SortOrder GetSortOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASC_HASH)
+          switch (hashCode)
           {
+          case ASC_HASH:
             return SortOrder::ASC;
-          }
-          else if (hashCode == DESC_HASH)
-          {
+          case DESC_HASH:
             return SortOrder::DESC;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace TaskDefinitionFamilyStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ACTIVE_HASH = 1925346054;
+        static const int INACTIVE_HASH = 807292011;
+        static const int ALL_HASH = 64897;
 
 
         TaskDefinitionFamilyStatus GetTaskDefinitionFamilyStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          switch (hashCode)
           {
+          case ACTIVE_HASH:
             return TaskDefinitionFamilyStatus::ACTIVE;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
+          case INACTIVE_HASH:
             return TaskDefinitionFamilyStatus::INACTIVE;
-          }
-          else if (hashCode == ALL_HASH)
-          {
+          case ALL_HASH:
             return TaskDefinitionFamilyStatus::ALL;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace TaskDefinitionStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ACTIVE_HASH = 1925346054;
+        static const int INACTIVE_HASH = 807292011;
 
 
         TaskDefinitionStatus GetTaskDefinitionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          switch (hashCode)
           {
+          case ACTIVE_HASH:
             return TaskDefinitionStatus::ACTIVE;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
+          case INACTIVE_HASH:
             return TaskDefinitionStatus::INACTIVE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
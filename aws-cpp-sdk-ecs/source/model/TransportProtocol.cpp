@@ -29,21 +29,29 @@ namespace Aws
       namespace TransportProtocolMapper
       {
 
-        static const int tcp_HASH = HashingUtils::HashString("tcp");
-        static const int udp_HASH = HashingUtils::HashString("udp");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int tcp_HASH = 114657;
+        static const int udp_HASH = 115649;
 
 
         TransportProtocol GetTransportProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == tcp_HASH)
+          switch (hashCode)
           {
+          case tcp_HASH:
             return TransportProtocol::tcp;
-          }
-          else if (hashCode == udp_HASH)
-          {
+          case udp_HASH:
             return TransportProtocol::udp;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
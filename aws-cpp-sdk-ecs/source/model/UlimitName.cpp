@@ -29,86 +29,68 @@ namespace Aws
       namespace UlimitNameMapper
       {
 
-        static const int core_HASH = HashingUtils::HashString("core");
-        static const int cpu_HASH = HashingUtils::HashString("cpu");
-        static const int data_HASH = HashingUtils::HashString("data");
-        static const int fsize_HASH = HashingUtils::HashString("fsize");
-        static const int locks_HASH = HashingUtils::HashString("locks");
-        static const int memlock_HASH = HashingUtils::HashString("memlock");
-        static const int msgqueue_HASH = HashingUtils::HashString("msgqueue");
-        static const int nice_HASH = HashingUtils::HashString("nice");
-        static const int nofile_HASH = HashingUtils::HashString("nofile");
-        static const int nproc_HASH = HashingUtils::HashString("nproc");
-        static const int rss_HASH = HashingUtils::HashString("rss");
-        static const int rtprio_HASH = HashingUtils::HashString("rtprio");
-        static const int rttime_HASH = HashingUtils::HashString("rttime");
-        static const int sigpending_HASH = HashingUtils::HashString("sigpending");
-        static const int stack_HASH = HashingUtils::HashString("stack");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int core_HASH = 3059615;
+        static const int cpu_HASH = 98728;
+        static const int data_HASH = 3076010;
+        static const int fsize_HASH = 97729895;
+        static const int locks_HASH = 103145640;
+        static const int memlock_HASH = 949188736;
+        static const int msgqueue_HASH = -1266746832;
+        static const int nice_HASH = 3381085;
+        static const int nofile_HASH = -1040106819;
+        static const int nproc_HASH = 105036996;
+        static const int rss_HASH = 113234;
+        static const int rtprio_HASH = -920666134;
+        static const int rttime_HASH = -920555505;
+        static const int sigpending_HASH = 804843430;
+        static const int stack_HASH = 109757064;
 
 
         UlimitName GetUlimitNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == core_HASH)
+          switch (hashCode)
           {
+          case core_HASH:
             return UlimitName::core;
-          }
-          else if (hashCode == cpu_HASH)
-          {
+          case cpu_HASH:
             return UlimitName::cpu;
-          }
-          else if (hashCode == data_HASH)
-          {
+          case data_HASH:
             return UlimitName::data;
-          }
-          else if (hashCode == fsize_HASH)
-          {
+          case fsize_HASH:
             return UlimitName::fsize;
-          }
-          else if (hashCode == locks_HASH)
-          {
+          case locks_HASH:
             return UlimitName::locks;
-          }
-          else if (hashCode == memlock_HASH)
-          {
+          case memlock_HASH:
             return UlimitName::memlock;
-          }
-          else if (hashCode == msgqueue_HASH)
-          {
+          case msgqueue_HASH:
             return UlimitName::msgqueue;
-          }
-          else if (hashCode == nice_HASH)
-          {
+          case nice_HASH:
             return UlimitName::nice;
-          }
-          else if (hashCode == nofile_HASH)
-          {
+          case nofile_HASH:
             return UlimitName::nofile;
-          }
-          else if (hashCode == nproc_HASH)
-          {
+          case nproc_HASH:
             return UlimitName::nproc;
-          }
-          else if (hashCode == rss_HASH)
-          {
+          case rss_HASH:
             return UlimitName::rss;
-          }
-          else if (hashCode == rtprio_HASH)
-          {
+          case rtprio_HASH:
             return UlimitName::rtprio;
-          }
-          else if (hashCode == rttime_HASH)
-          {
+          case rttime_HASH:
             return UlimitName::rttime;
-          }
-          else if (hashCode == sigpending_HASH)
-          {
+          case sigpending_HASH:
             return UlimitName::sigpending;
-          }
-          else if (hashCode == stack_HASH)
-          {
+          case stack_HASH:
             return UlimitName::stack;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
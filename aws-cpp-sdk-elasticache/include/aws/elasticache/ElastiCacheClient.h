@@ -57,6 +57,9 @@
 #include <aws/elasticache/model/RevokeCacheSecurityGroupIngressResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -349,6 +352,18 @@ namespace Model
          */
         virtual void AddTagsToResourceAsync(const Model::AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToResourceCallable(const Model::AddTagsToResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsToResourceOutcomeCallable AddTagsToResourceCallable(Model::AddTagsToResourceRequest&& request) const;
+
+        /**
+         * Same as AddTagsToResourceAsync(const Model::AddTagsToResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsToResourceAsync(Model::AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>AuthorizeCacheSecurityGroupIngress</i> action allows network ingress
          * to a cache security group. Applications using ElastiCache must be running on
@@ -383,6 +398,18 @@ namespace Model
          */
         virtual void AuthorizeCacheSecurityGroupIngressAsync(const Model::AuthorizeCacheSecurityGroupIngressRequest& request, const AuthorizeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AuthorizeCacheSecurityGroupIngressCallable(const Model::AuthorizeCacheSecurityGroupIngressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AuthorizeCacheSecurityGroupIngressOutcomeCallable AuthorizeCacheSecurityGroupIngressCallable(Model::AuthorizeCacheSecurityGroupIngressRequest&& request) const;
+
+        /**
+         * Same as AuthorizeCacheSecurityGroupIngressAsync(const Model::AuthorizeCacheSecurityGroupIngressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AuthorizeCacheSecurityGroupIngressAsync(Model::AuthorizeCacheSecurityGroupIngressRequest&& request, const AuthorizeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CopySnapshot</i> action makes a copy of an existing snapshot.</p>
          * <important> <p>Users or groups that have permissions to use the
@@ -441,6 +468,18 @@ namespace Model
          */
         virtual void CopySnapshotAsync(const Model::CopySnapshotRequest& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopySnapshotCallable(const Model::CopySnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CopySnapshotOutcomeCallable CopySnapshotCallable(Model::CopySnapshotRequest&& request) const;
+
+        /**
+         * Same as CopySnapshotAsync(const Model::CopySnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CopySnapshotAsync(Model::CopySnapshotRequest&& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CreateCacheCluster</i> action creates a cache cluster. All nodes in
          * the cache cluster run the same protocol-compliant cache engine software, either
@@ -466,6 +505,18 @@ namespace Model
          */
         virtual void CreateCacheClusterAsync(const Model::CreateCacheClusterRequest& request, const CreateCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCacheClusterCallable(const Model::CreateCacheClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateCacheClusterOutcomeCallable CreateCacheClusterCallable(Model::CreateCacheClusterRequest&& request) const;
+
+        /**
+         * Same as CreateCacheClusterAsync(const Model::CreateCacheClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateCacheClusterAsync(Model::CreateCacheClusterRequest&& request, const CreateCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CreateCacheParameterGroup</i> action creates a new cache parameter
          * group. A cache parameter group is a collection of parameters that you apply to
@@ -491,6 +542,18 @@ namespace Model
          */
         virtual void CreateCacheParameterGroupAsync(const Model::CreateCacheParameterGroupRequest& request, const CreateCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCacheParameterGroupCallable(const Model::CreateCacheParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateCacheParameterGroupOutcomeCallable CreateCacheParameterGroupCallable(Model::CreateCacheParameterGroupRequest&& request) const;
+
+        /**
+         * Same as CreateCacheParameterGroupAsync(const Model::CreateCacheParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateCacheParameterGroupAsync(Model::CreateCacheParameterGroupRequest&& request, const CreateCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CreateCacheSecurityGroup</i> action creates a new cache security
          * group. Use a cache security group to control access to one or more cache
@@ -528,6 +591,18 @@ namespace Model
          */
         virtual void CreateCacheSecurityGroupAsync(const Model::CreateCacheSecurityGroupRequest& request, const CreateCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCacheSecurityGroupCallable(const Model::CreateCacheSecurityGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateCacheSecurityGroupOutcomeCallable CreateCacheSecurityGroupCallable(Model::CreateCacheSecurityGroupRequest&& request) const;
+
+        /**
+         * Same as CreateCacheSecurityGroupAsync(const Model::CreateCacheSecurityGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateCacheSecurityGroupAsync(Model::CreateCacheSecurityGroupRequest&& request, const CreateCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CreateCacheSubnetGroup</i> action creates a new cache subnet
          * group.</p> <p>Use this parameter only when you are creating a cluster in an
@@ -553,6 +628,18 @@ namespace Model
          */
         virtual void CreateCacheSubnetGroupAsync(const Model::CreateCacheSubnetGroupRequest& request, const CreateCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCacheSubnetGroupCallable(const Model::CreateCacheSubnetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateCacheSubnetGroupOutcomeCallable CreateCacheSubnetGroupCallable(Model::CreateCacheSubnetGroupRequest&& request) const;
+
+        /**
+         * Same as CreateCacheSubnetGroupAsync(const Model::CreateCacheSubnetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateCacheSubnetGroupAsync(Model::CreateCacheSubnetGroupRequest&& request, const CreateCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CreateReplicationGroup</i> action creates a replication group. A
          * replication group is a collection of cache clusters, where one of the cache
@@ -593,6 +680,18 @@ namespace Model
          */
         virtual void CreateReplicationGroupAsync(const Model::CreateReplicationGroupRequest& request, const CreateReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateReplicationGroupCallable(const Model::CreateReplicationGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateReplicationGroupOutcomeCallable CreateReplicationGroupCallable(Model::CreateReplicationGroupRequest&& request) const;
+
+        /**
+         * Same as CreateReplicationGroupAsync(const Model::CreateReplicationGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateReplicationGroupAsync(Model::CreateReplicationGroupRequest&& request, const CreateReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CreateSnapshot</i> action creates a copy of an entire cache cluster at
          * a specific moment in time.</p>
@@ -615,6 +714,18 @@ namespace Model
          */
         virtual void CreateSnapshotAsync(const Model::CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSnapshotCallable(const Model::CreateSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateSnapshotOutcomeCallable CreateSnapshotCallable(Model::CreateSnapshotRequest&& request) const;
+
+        /**
+         * Same as CreateSnapshotAsync(const Model::CreateSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateSnapshotAsync(Model::CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DeleteCacheCluster</i> action deletes a previously provisioned cache
          * cluster. <i>DeleteCacheCluster</i> deletes all associated cache nodes, node
@@ -652,6 +763,18 @@ namespace Model
          */
         virtual void DeleteCacheClusterAsync(const Model::DeleteCacheClusterRequest& request, const DeleteCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCacheClusterCallable(const Model::DeleteCacheClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteCacheClusterOutcomeCallable DeleteCacheClusterCallable(Model::DeleteCacheClusterRequest&& request) const;
+
+        /**
+         * Same as DeleteCacheClusterAsync(const Model::DeleteCacheClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteCacheClusterAsync(Model::DeleteCacheClusterRequest&& request, const DeleteCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DeleteCacheParameterGroup</i> action deletes the specified cache
          * parameter group. You cannot delete a cache parameter group if it is associated
@@ -677,6 +800,18 @@ namespace Model
          */
         virtual void DeleteCacheParameterGroupAsync(const Model::DeleteCacheParameterGroupRequest& request, const DeleteCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCacheParameterGroupCallable(const Model::DeleteCacheParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteCacheParameterGroupOutcomeCallable DeleteCacheParameterGroupCallable(Model::DeleteCacheParameterGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteCacheParameterGroupAsync(const Model::DeleteCacheParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteCacheParameterGroupAsync(Model::DeleteCacheParameterGroupRequest&& request, const DeleteCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DeleteCacheSecurityGroup</i> action deletes a cache security
          * group.</p> <note> <p>You cannot delete a cache security group if it is
@@ -702,6 +837,18 @@ namespace Model
          */
         virtual void DeleteCacheSecurityGroupAsync(const Model::DeleteCacheSecurityGroupRequest& request, const DeleteCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCacheSecurityGroupCallable(const Model::DeleteCacheSecurityGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteCacheSecurityGroupOutcomeCallable DeleteCacheSecurityGroupCallable(Model::DeleteCacheSecurityGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteCacheSecurityGroupAsync(const Model::DeleteCacheSecurityGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteCacheSecurityGroupAsync(Model::DeleteCacheSecurityGroupRequest&& request, const DeleteCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DeleteCacheSubnetGroup</i> action deletes a cache subnet group.</p>
          * <note> <p>You cannot delete a cache subnet group if it is associated with any
@@ -727,6 +874,18 @@ namespace Model
          */
         virtual void DeleteCacheSubnetGroupAsync(const Model::DeleteCacheSubnetGroupRequest& request, const DeleteCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCacheSubnetGroupCallable(const Model::DeleteCacheSubnetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteCacheSubnetGroupOutcomeCallable DeleteCacheSubnetGroupCallable(Model::DeleteCacheSubnetGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteCacheSubnetGroupAsync(const Model::DeleteCacheSubnetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteCacheSubnetGroupAsync(Model::DeleteCacheSubnetGroupRequest&& request, const DeleteCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DeleteReplicationGroup</i> action deletes an existing replication
          * group. By default, this action deletes the entire replication group, including
@@ -761,6 +920,18 @@ namespace Model
          */
         virtual void DeleteReplicationGroupAsync(const Model::DeleteReplicationGroupRequest& request, const DeleteReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteReplicationGroupCallable(const Model::DeleteReplicationGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteReplicationGroupOutcomeCallable DeleteReplicationGroupCallable(Model::DeleteReplicationGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteReplicationGroupAsync(const Model::DeleteReplicationGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteReplicationGroupAsync(Model::DeleteReplicationGroupRequest&& request, const DeleteReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DeleteSnapshot</i> action deletes an existing snapshot. When you
          * receive a successful response from this action, ElastiCache immediately begins
@@ -786,6 +957,18 @@ namespace Model
          */
         virtual void DeleteSnapshotAsync(const Model::DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSnapshotCallable(const Model::DeleteSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteSnapshotOutcomeCallable DeleteSnapshotCallable(Model::DeleteSnapshotRequest&& request) const;
+
+        /**
+         * Same as DeleteSnapshotAsync(const Model::DeleteSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteSnapshotAsync(Model::DeleteSnapshotRequest&& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeCacheClusters</i> action returns information about all
          * provisioned cache clusters if no cache cluster identifier is specified, or about
@@ -850,6 +1033,18 @@ namespace Model
          */
         virtual void DescribeCacheClustersAsync(const Model::DescribeCacheClustersRequest& request, const DescribeCacheClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCacheClustersCallable(const Model::DescribeCacheClustersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCacheClustersOutcomeCallable DescribeCacheClustersCallable(Model::DescribeCacheClustersRequest&& request) const;
+
+        /**
+         * Same as DescribeCacheClustersAsync(const Model::DescribeCacheClustersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCacheClustersAsync(Model::DescribeCacheClustersRequest&& request, const DescribeCacheClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeCacheEngineVersions</i> action returns a list of the available
          * cache engines and their versions.</p>
@@ -872,6 +1067,18 @@ namespace Model
          */
         virtual void DescribeCacheEngineVersionsAsync(const Model::DescribeCacheEngineVersionsRequest& request, const DescribeCacheEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCacheEngineVersionsCallable(const Model::DescribeCacheEngineVersionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCacheEngineVersionsOutcomeCallable DescribeCacheEngineVersionsCallable(Model::DescribeCacheEngineVersionsRequest&& request) const;
+
+        /**
+         * Same as DescribeCacheEngineVersionsAsync(const Model::DescribeCacheEngineVersionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCacheEngineVersionsAsync(Model::DescribeCacheEngineVersionsRequest&& request, const DescribeCacheEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeCacheParameterGroups</i> action returns a list of cache
          * parameter group descriptions. If a cache parameter group name is specified, the
@@ -897,6 +1104,18 @@ namespace Model
          */
         virtual void DescribeCacheParameterGroupsAsync(const Model::DescribeCacheParameterGroupsRequest& request, const DescribeCacheParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCacheParameterGroupsCallable(const Model::DescribeCacheParameterGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCacheParameterGroupsOutcomeCallable DescribeCacheParameterGroupsCallable(Model::DescribeCacheParameterGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeCacheParameterGroupsAsync(const Model::DescribeCacheParameterGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCacheParameterGroupsAsync(Model::DescribeCacheParameterGroupsRequest&& request, const DescribeCacheParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeCacheParameters</i> action returns the detailed parameter list
          * for a particular cache parameter group.</p>
@@ -919,6 +1138,18 @@ namespace Model
          */
         virtual void DescribeCacheParametersAsync(const Model::DescribeCacheParametersRequest& request, const DescribeCacheParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCacheParametersCallable(const Model::DescribeCacheParametersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCacheParametersOutcomeCallable DescribeCacheParametersCallable(Model::DescribeCacheParametersRequest&& request) const;
+
+        /**
+         * Same as DescribeCacheParametersAsync(const Model::DescribeCacheParametersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCacheParametersAsync(Model::DescribeCacheParametersRequest&& request, const DescribeCacheParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeCacheSecurityGroups</i> action returns a list of cache
          * security group descriptions. If a cache security group name is specified, the
@@ -944,6 +1175,18 @@ namespace Model
          */
         virtual void DescribeCacheSecurityGroupsAsync(const Model::DescribeCacheSecurityGroupsRequest& request, const DescribeCacheSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCacheSecurityGroupsCallable(const Model::DescribeCacheSecurityGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCacheSecurityGroupsOutcomeCallable DescribeCacheSecurityGroupsCallable(Model::DescribeCacheSecurityGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeCacheSecurityGroupsAsync(const Model::DescribeCacheSecurityGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCacheSecurityGroupsAsync(Model::DescribeCacheSecurityGroupsRequest&& request, const DescribeCacheSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeCacheSubnetGroups</i> action returns a list of cache subnet
          * group descriptions. If a subnet group name is specified, the list will contain
@@ -969,6 +1212,18 @@ namespace Model
          */
         virtual void DescribeCacheSubnetGroupsAsync(const Model::DescribeCacheSubnetGroupsRequest& request, const DescribeCacheSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCacheSubnetGroupsCallable(const Model::DescribeCacheSubnetGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCacheSubnetGroupsOutcomeCallable DescribeCacheSubnetGroupsCallable(Model::DescribeCacheSubnetGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeCacheSubnetGroupsAsync(const Model::DescribeCacheSubnetGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCacheSubnetGroupsAsync(Model::DescribeCacheSubnetGroupsRequest&& request, const DescribeCacheSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeEngineDefaultParameters</i> action returns the default engine
          * and system parameter information for the specified cache engine.</p>
@@ -991,6 +1246,18 @@ namespace Model
          */
         virtual void DescribeEngineDefaultParametersAsync(const Model::DescribeEngineDefaultParametersRequest& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEngineDefaultParametersCallable(const Model::DescribeEngineDefaultParametersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEngineDefaultParametersOutcomeCallable DescribeEngineDefaultParametersCallable(Model::DescribeEngineDefaultParametersRequest&& request) const;
+
+        /**
+         * Same as DescribeEngineDefaultParametersAsync(const Model::DescribeEngineDefaultParametersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEngineDefaultParametersAsync(Model::DescribeEngineDefaultParametersRequest&& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeEvents</i> action returns events related to cache clusters,
          * cache security groups, and cache parameter groups. You can obtain events
@@ -1025,6 +1292,18 @@ namespace Model
          */
         virtual void DescribeEventsAsync(const Model::DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventsCallable(const Model::DescribeEventsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEventsOutcomeCallable DescribeEventsCallable(Model::DescribeEventsRequest&& request) const;
+
+        /**
+         * Same as DescribeEventsAsync(const Model::DescribeEventsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEventsAsync(Model::DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeReplicationGroups</i> action returns information about a
          * particular replication group. If no identifier is specified,
@@ -1053,6 +1332,18 @@ namespace Model
          */
         virtual void DescribeReplicationGroupsAsync(const Model::DescribeReplicationGroupsRequest& request, const DescribeReplicationGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReplicationGroupsCallable(const Model::DescribeReplicationGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReplicationGroupsOutcomeCallable DescribeReplicationGroupsCallable(Model::DescribeReplicationGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeReplicationGroupsAsync(const Model::DescribeReplicationGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReplicationGroupsAsync(Model::DescribeReplicationGroupsRequest&& request, const DescribeReplicationGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeReservedCacheNodes</i> action returns information about
          * reserved cache nodes for this account, or about a specified reserved cache
@@ -1078,6 +1369,18 @@ namespace Model
          */
         virtual void DescribeReservedCacheNodesAsync(const Model::DescribeReservedCacheNodesRequest& request, const DescribeReservedCacheNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedCacheNodesCallable(const Model::DescribeReservedCacheNodesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReservedCacheNodesOutcomeCallable DescribeReservedCacheNodesCallable(Model::DescribeReservedCacheNodesRequest&& request) const;
+
+        /**
+         * Same as DescribeReservedCacheNodesAsync(const Model::DescribeReservedCacheNodesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReservedCacheNodesAsync(Model::DescribeReservedCacheNodesRequest&& request, const DescribeReservedCacheNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeReservedCacheNodesOfferings</i> action lists available
          * reserved cache node offerings.</p>
@@ -1100,6 +1403,18 @@ namespace Model
          */
         virtual void DescribeReservedCacheNodesOfferingsAsync(const Model::DescribeReservedCacheNodesOfferingsRequest& request, const DescribeReservedCacheNodesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedCacheNodesOfferingsCallable(const Model::DescribeReservedCacheNodesOfferingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReservedCacheNodesOfferingsOutcomeCallable DescribeReservedCacheNodesOfferingsCallable(Model::DescribeReservedCacheNodesOfferingsRequest&& request) const;
+
+        /**
+         * Same as DescribeReservedCacheNodesOfferingsAsync(const Model::DescribeReservedCacheNodesOfferingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReservedCacheNodesOfferingsAsync(Model::DescribeReservedCacheNodesOfferingsRequest&& request, const DescribeReservedCacheNodesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeSnapshots</i> action returns information about cache cluster
          * snapshots. By default, <i>DescribeSnapshots</i> lists all of your snapshots; it
@@ -1128,6 +1443,18 @@ namespace Model
          */
         virtual void DescribeSnapshotsAsync(const Model::DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSnapshotsCallable(const Model::DescribeSnapshotsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSnapshotsOutcomeCallable DescribeSnapshotsCallable(Model::DescribeSnapshotsRequest&& request) const;
+
+        /**
+         * Same as DescribeSnapshotsAsync(const Model::DescribeSnapshotsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSnapshotsAsync(Model::DescribeSnapshotsRequest&& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <code>ListAllowedNodeTypeModifications</code> action lists all available
          * node types that you can scale your Redis cluster's or replication group's
@@ -1162,6 +1489,18 @@ namespace Model
          */
         virtual void ListAllowedNodeTypeModificationsAsync(const Model::ListAllowedNodeTypeModificationsRequest& request, const ListAllowedNodeTypeModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAllowedNodeTypeModificationsCallable(const Model::ListAllowedNodeTypeModificationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAllowedNodeTypeModificationsOutcomeCallable ListAllowedNodeTypeModificationsCallable(Model::ListAllowedNodeTypeModificationsRequest&& request) const;
+
+        /**
+         * Same as ListAllowedNodeTypeModificationsAsync(const Model::ListAllowedNodeTypeModificationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAllowedNodeTypeModificationsAsync(Model::ListAllowedNodeTypeModificationsRequest&& request, const ListAllowedNodeTypeModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>ListTagsForResource</i> action lists all cost allocation tags
          * currently on the named resource. A <i>cost allocation tag</i> is a key-value
@@ -1202,6 +1541,18 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourceCallable(const Model::ListTagsForResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(Model::ListTagsForResourceRequest&& request) const;
+
+        /**
+         * Same as ListTagsForResourceAsync(const Model::ListTagsForResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsForResourceAsync(Model::ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>ModifyCacheCluster</i> action modifies the settings for a cache
          * cluster. You can use this action to change one or more cluster configuration
@@ -1227,6 +1578,18 @@ namespace Model
          */
         virtual void ModifyCacheClusterAsync(const Model::ModifyCacheClusterRequest& request, const ModifyCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyCacheClusterCallable(const Model::ModifyCacheClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyCacheClusterOutcomeCallable ModifyCacheClusterCallable(Model::ModifyCacheClusterRequest&& request) const;
+
+        /**
+         * Same as ModifyCacheClusterAsync(const Model::ModifyCacheClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyCacheClusterAsync(Model::ModifyCacheClusterRequest&& request, const ModifyCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>ModifyCacheParameterGroup</i> action modifies the parameters of a
          * cache parameter group. You can modify up to 20 parameters in a single request by
@@ -1252,6 +1615,18 @@ namespace Model
          */
         virtual void ModifyCacheParameterGroupAsync(const Model::ModifyCacheParameterGroupRequest& request, const ModifyCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyCacheParameterGroupCallable(const Model::ModifyCacheParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyCacheParameterGroupOutcomeCallable ModifyCacheParameterGroupCallable(Model::ModifyCacheParameterGroupRequest&& request) const;
+
+        /**
+         * Same as ModifyCacheParameterGroupAsync(const Model::ModifyCacheParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyCacheParameterGroupAsync(Model::ModifyCacheParameterGroupRequest&& request, const ModifyCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>ModifyCacheSubnetGroup</i> action modifies an existing cache subnet
          * group.</p>
@@ -1274,6 +1649,18 @@ namespace Model
          */
         virtual void ModifyCacheSubnetGroupAsync(const Model::ModifyCacheSubnetGroupRequest& request, const ModifyCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyCacheSubnetGroupCallable(const Model::ModifyCacheSubnetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyCacheSubnetGroupOutcomeCallable ModifyCacheSubnetGroupCallable(Model::ModifyCacheSubnetGroupRequest&& request) const;
+
+        /**
+         * Same as ModifyCacheSubnetGroupAsync(const Model::ModifyCacheSubnetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyCacheSubnetGroupAsync(Model::ModifyCacheSubnetGroupRequest&& request, const ModifyCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>ModifyReplicationGroup</i> action modifies the settings for a
          * replication group.</p>
@@ -1296,6 +1683,18 @@ namespace Model
          */
         virtual void ModifyReplicationGroupAsync(const Model::ModifyReplicationGroupRequest& request, const ModifyReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyReplicationGroupCallable(const Model::ModifyReplicationGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyReplicationGroupOutcomeCallable ModifyReplicationGroupCallable(Model::ModifyReplicationGroupRequest&& request) const;
+
+        /**
+         * Same as ModifyReplicationGroupAsync(const Model::ModifyReplicationGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyReplicationGroupAsync(Model::ModifyReplicationGroupRequest&& request, const ModifyReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>PurchaseReservedCacheNodesOffering</i> action allows you to purchase a
          * reserved cache node offering.</p>
@@ -1318,6 +1717,18 @@ namespace Model
          */
         virtual void PurchaseReservedCacheNodesOfferingAsync(const Model::PurchaseReservedCacheNodesOfferingRequest& request, const PurchaseReservedCacheNodesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PurchaseReservedCacheNodesOfferingCallable(const Model::PurchaseReservedCacheNodesOfferingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PurchaseReservedCacheNodesOfferingOutcomeCallable PurchaseReservedCacheNodesOfferingCallable(Model::PurchaseReservedCacheNodesOfferingRequest&& request) const;
+
+        /**
+         * Same as PurchaseReservedCacheNodesOfferingAsync(const Model::PurchaseReservedCacheNodesOfferingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PurchaseReservedCacheNodesOfferingAsync(Model::PurchaseReservedCacheNodesOfferingRequest&& request, const PurchaseReservedCacheNodesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>RebootCacheCluster</i> action reboots some, or all, of the cache nodes
          * within a provisioned cache cluster. This API will apply any modified cache
@@ -1355,6 +1766,18 @@ namespace Model
          */
         virtual void RebootCacheClusterAsync(const Model::RebootCacheClusterRequest& request, const RebootCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebootCacheClusterCallable(const Model::RebootCacheClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RebootCacheClusterOutcomeCallable RebootCacheClusterCallable(Model::RebootCacheClusterRequest&& request) const;
+
+        /**
+         * Same as RebootCacheClusterAsync(const Model::RebootCacheClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RebootCacheClusterAsync(Model::RebootCacheClusterRequest&& request, const RebootCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>RemoveTagsFromResource</i> action removes the tags identified by the
          * <code>TagKeys</code> list from the named resource.</p>
@@ -1377,6 +1800,18 @@ namespace Model
          */
         virtual void RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromResourceCallable(const Model::RemoveTagsFromResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsFromResourceOutcomeCallable RemoveTagsFromResourceCallable(Model::RemoveTagsFromResourceRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsFromResourceAsync(Model::RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>ResetCacheParameterGroup</i> action modifies the parameters of a cache
          * parameter group to the engine or system default value. You can reset specific
@@ -1408,6 +1843,18 @@ namespace Model
          */
         virtual void ResetCacheParameterGroupAsync(const Model::ResetCacheParameterGroupRequest& request, const ResetCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetCacheParameterGroupCallable(const Model::ResetCacheParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResetCacheParameterGroupOutcomeCallable ResetCacheParameterGroupCallable(Model::ResetCacheParameterGroupRequest&& request) const;
+
+        /**
+         * Same as ResetCacheParameterGroupAsync(const Model::ResetCacheParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResetCacheParameterGroupAsync(Model::ResetCacheParameterGroupRequest&& request, const ResetCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>RevokeCacheSecurityGroupIngress</i> action revokes ingress from a
          * cache security group. Use this action to disallow access from an Amazon EC2
@@ -1433,6 +1880,265 @@ namespace Model
          */
         virtual void RevokeCacheSecurityGroupIngressAsync(const Model::RevokeCacheSecurityGroupIngressRequest& request, const RevokeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RevokeCacheSecurityGroupIngressCallable(const Model::RevokeCacheSecurityGroupIngressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RevokeCacheSecurityGroupIngressOutcomeCallable RevokeCacheSecurityGroupIngressCallable(Model::RevokeCacheSecurityGroupIngressRequest&& request) const;
+
+        /**
+         * Same as RevokeCacheSecurityGroupIngressAsync(const Model::RevokeCacheSecurityGroupIngressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RevokeCacheSecurityGroupIngressAsync(Model::RevokeCacheSecurityGroupIngressRequest&& request, const RevokeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeCacheClusters(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElastiCacheClient, Model::DescribeCacheClustersRequest, Model::DescribeCacheClustersOutcome> DescribeCacheClustersPaginator(const Model::DescribeCacheClustersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeCacheEngineVersions(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElastiCacheClient, Model::DescribeCacheEngineVersionsRequest, Model::DescribeCacheEngineVersionsOutcome> DescribeCacheEngineVersionsPaginator(const Model::DescribeCacheEngineVersionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeCacheParameterGroups(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElastiCacheClient, Model::DescribeCacheParameterGroupsRequest, Model::DescribeCacheParameterGroupsOutcome> DescribeCacheParameterGroupsPaginator(const Model::DescribeCacheParameterGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeCacheParameters(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElastiCacheClient, Model::DescribeCacheParametersRequest, Model::DescribeCacheParametersOutcome> DescribeCacheParametersPaginator(const Model::DescribeCacheParametersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeCacheSecurityGroups(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElastiCacheClient, Model::DescribeCacheSecurityGroupsRequest, Model::DescribeCacheSecurityGroupsOutcome> DescribeCacheSecurityGroupsPaginator(const Model::DescribeCacheSecurityGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeCacheSubnetGroups(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElastiCacheClient, Model::DescribeCacheSubnetGroupsRequest, Model::DescribeCacheSubnetGroupsOutcome> DescribeCacheSubnetGroupsPaginator(const Model::DescribeCacheSubnetGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeEvents(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElastiCacheClient, Model::DescribeEventsRequest, Model::DescribeEventsOutcome> DescribeEventsPaginator(const Model::DescribeEventsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeReplicationGroups(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElastiCacheClient, Model::DescribeReplicationGroupsRequest, Model::DescribeReplicationGroupsOutcome> DescribeReplicationGroupsPaginator(const Model::DescribeReplicationGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeReservedCacheNodes(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElastiCacheClient, Model::DescribeReservedCacheNodesRequest, Model::DescribeReservedCacheNodesOutcome> DescribeReservedCacheNodesPaginator(const Model::DescribeReservedCacheNodesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeReservedCacheNodesOfferings(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElastiCacheClient, Model::DescribeReservedCacheNodesOfferingsRequest, Model::DescribeReservedCacheNodesOfferingsOutcome> DescribeReservedCacheNodesOfferingsPaginator(const Model::DescribeReservedCacheNodesOfferingsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeSnapshots(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElastiCacheClient, Model::DescribeSnapshotsRequest, Model::DescribeSnapshotsOutcome> DescribeSnapshotsPaginator(const Model::DescribeSnapshotsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddTagsToResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::AddTagsToResourceRequest, Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(Model::AddTagsToResourceRequest request) const;
+
+        /**
+         * co_await-able form of AuthorizeCacheSecurityGroupIngress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::AuthorizeCacheSecurityGroupIngressRequest, Model::AuthorizeCacheSecurityGroupIngressOutcome> AuthorizeCacheSecurityGroupIngressAwaitable(Model::AuthorizeCacheSecurityGroupIngressRequest request) const;
+
+        /**
+         * co_await-able form of CopySnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::CopySnapshotRequest, Model::CopySnapshotOutcome> CopySnapshotAwaitable(Model::CopySnapshotRequest request) const;
+
+        /**
+         * co_await-able form of CreateCacheCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::CreateCacheClusterRequest, Model::CreateCacheClusterOutcome> CreateCacheClusterAwaitable(Model::CreateCacheClusterRequest request) const;
+
+        /**
+         * co_await-able form of CreateCacheParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::CreateCacheParameterGroupRequest, Model::CreateCacheParameterGroupOutcome> CreateCacheParameterGroupAwaitable(Model::CreateCacheParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateCacheSecurityGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::CreateCacheSecurityGroupRequest, Model::CreateCacheSecurityGroupOutcome> CreateCacheSecurityGroupAwaitable(Model::CreateCacheSecurityGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateCacheSubnetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::CreateCacheSubnetGroupRequest, Model::CreateCacheSubnetGroupOutcome> CreateCacheSubnetGroupAwaitable(Model::CreateCacheSubnetGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateReplicationGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::CreateReplicationGroupRequest, Model::CreateReplicationGroupOutcome> CreateReplicationGroupAwaitable(Model::CreateReplicationGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::CreateSnapshotRequest, Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(Model::CreateSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of DeleteCacheCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DeleteCacheClusterRequest, Model::DeleteCacheClusterOutcome> DeleteCacheClusterAwaitable(Model::DeleteCacheClusterRequest request) const;
+
+        /**
+         * co_await-able form of DeleteCacheParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DeleteCacheParameterGroupRequest, Model::DeleteCacheParameterGroupOutcome> DeleteCacheParameterGroupAwaitable(Model::DeleteCacheParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteCacheSecurityGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DeleteCacheSecurityGroupRequest, Model::DeleteCacheSecurityGroupOutcome> DeleteCacheSecurityGroupAwaitable(Model::DeleteCacheSecurityGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteCacheSubnetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DeleteCacheSubnetGroupRequest, Model::DeleteCacheSubnetGroupOutcome> DeleteCacheSubnetGroupAwaitable(Model::DeleteCacheSubnetGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteReplicationGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DeleteReplicationGroupRequest, Model::DeleteReplicationGroupOutcome> DeleteReplicationGroupAwaitable(Model::DeleteReplicationGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DeleteSnapshotRequest, Model::DeleteSnapshotOutcome> DeleteSnapshotAwaitable(Model::DeleteSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCacheClusters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DescribeCacheClustersRequest, Model::DescribeCacheClustersOutcome> DescribeCacheClustersAwaitable(Model::DescribeCacheClustersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCacheEngineVersions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DescribeCacheEngineVersionsRequest, Model::DescribeCacheEngineVersionsOutcome> DescribeCacheEngineVersionsAwaitable(Model::DescribeCacheEngineVersionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCacheParameterGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DescribeCacheParameterGroupsRequest, Model::DescribeCacheParameterGroupsOutcome> DescribeCacheParameterGroupsAwaitable(Model::DescribeCacheParameterGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCacheParameters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DescribeCacheParametersRequest, Model::DescribeCacheParametersOutcome> DescribeCacheParametersAwaitable(Model::DescribeCacheParametersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCacheSecurityGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DescribeCacheSecurityGroupsRequest, Model::DescribeCacheSecurityGroupsOutcome> DescribeCacheSecurityGroupsAwaitable(Model::DescribeCacheSecurityGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCacheSubnetGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DescribeCacheSubnetGroupsRequest, Model::DescribeCacheSubnetGroupsOutcome> DescribeCacheSubnetGroupsAwaitable(Model::DescribeCacheSubnetGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEngineDefaultParameters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DescribeEngineDefaultParametersRequest, Model::DescribeEngineDefaultParametersOutcome> DescribeEngineDefaultParametersAwaitable(Model::DescribeEngineDefaultParametersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEvents(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DescribeEventsRequest, Model::DescribeEventsOutcome> DescribeEventsAwaitable(Model::DescribeEventsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReplicationGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DescribeReplicationGroupsRequest, Model::DescribeReplicationGroupsOutcome> DescribeReplicationGroupsAwaitable(Model::DescribeReplicationGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReservedCacheNodes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DescribeReservedCacheNodesRequest, Model::DescribeReservedCacheNodesOutcome> DescribeReservedCacheNodesAwaitable(Model::DescribeReservedCacheNodesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReservedCacheNodesOfferings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DescribeReservedCacheNodesOfferingsRequest, Model::DescribeReservedCacheNodesOfferingsOutcome> DescribeReservedCacheNodesOfferingsAwaitable(Model::DescribeReservedCacheNodesOfferingsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSnapshots(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::DescribeSnapshotsRequest, Model::DescribeSnapshotsOutcome> DescribeSnapshotsAwaitable(Model::DescribeSnapshotsRequest request) const;
+
+        /**
+         * co_await-able form of ListAllowedNodeTypeModifications(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::ListAllowedNodeTypeModificationsRequest, Model::ListAllowedNodeTypeModificationsOutcome> ListAllowedNodeTypeModificationsAwaitable(Model::ListAllowedNodeTypeModificationsRequest request) const;
+
+        /**
+         * co_await-able form of ListTagsForResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::ListTagsForResourceRequest, Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(Model::ListTagsForResourceRequest request) const;
+
+        /**
+         * co_await-able form of ModifyCacheCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::ModifyCacheClusterRequest, Model::ModifyCacheClusterOutcome> ModifyCacheClusterAwaitable(Model::ModifyCacheClusterRequest request) const;
+
+        /**
+         * co_await-able form of ModifyCacheParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::ModifyCacheParameterGroupRequest, Model::ModifyCacheParameterGroupOutcome> ModifyCacheParameterGroupAwaitable(Model::ModifyCacheParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of ModifyCacheSubnetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::ModifyCacheSubnetGroupRequest, Model::ModifyCacheSubnetGroupOutcome> ModifyCacheSubnetGroupAwaitable(Model::ModifyCacheSubnetGroupRequest request) const;
+
+        /**
+         * co_await-able form of ModifyReplicationGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::ModifyReplicationGroupRequest, Model::ModifyReplicationGroupOutcome> ModifyReplicationGroupAwaitable(Model::ModifyReplicationGroupRequest request) const;
+
+        /**
+         * co_await-able form of PurchaseReservedCacheNodesOffering(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::PurchaseReservedCacheNodesOfferingRequest, Model::PurchaseReservedCacheNodesOfferingOutcome> PurchaseReservedCacheNodesOfferingAwaitable(Model::PurchaseReservedCacheNodesOfferingRequest request) const;
+
+        /**
+         * co_await-able form of RebootCacheCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::RebootCacheClusterRequest, Model::RebootCacheClusterOutcome> RebootCacheClusterAwaitable(Model::RebootCacheClusterRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTagsFromResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::RemoveTagsFromResourceRequest, Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(Model::RemoveTagsFromResourceRequest request) const;
+
+        /**
+         * co_await-able form of ResetCacheParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::ResetCacheParameterGroupRequest, Model::ResetCacheParameterGroupOutcome> ResetCacheParameterGroupAwaitable(Model::ResetCacheParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of RevokeCacheSecurityGroupIngress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElastiCacheClient, Model::RevokeCacheSecurityGroupIngressRequest, Model::RevokeCacheSecurityGroupIngressOutcome> RevokeCacheSecurityGroupIngressAwaitable(Model::RevokeCacheSecurityGroupIngressRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
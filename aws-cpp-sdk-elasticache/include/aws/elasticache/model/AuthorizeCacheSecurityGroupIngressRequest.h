@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AuthorizeCacheSecurityGroupIngressRequest();
+    inline const char* GetServiceRequestName() const override { return "AuthorizeCacheSecurityGroupIngress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateCacheClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateCacheCluster"; }
+
     Aws::String SerializePayload() const override;
 
     /**
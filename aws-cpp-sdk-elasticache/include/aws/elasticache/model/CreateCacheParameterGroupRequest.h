@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateCacheParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateCacheParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
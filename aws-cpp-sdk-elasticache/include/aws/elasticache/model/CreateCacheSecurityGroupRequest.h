@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateCacheSecurityGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateCacheSecurityGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateCacheSubnetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateCacheSubnetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateReplicationGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateReplicationGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteCacheClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteCacheCluster"; }
+
     Aws::String SerializePayload() const override;
 
     /**
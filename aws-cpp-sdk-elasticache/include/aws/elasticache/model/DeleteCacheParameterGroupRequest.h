@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteCacheParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteCacheParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
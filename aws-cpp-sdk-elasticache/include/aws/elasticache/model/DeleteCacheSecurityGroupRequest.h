@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteCacheSecurityGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteCacheSecurityGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
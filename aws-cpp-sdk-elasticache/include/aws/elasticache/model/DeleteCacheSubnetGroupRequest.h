@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteCacheSubnetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteCacheSubnetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteReplicationGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteReplicationGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
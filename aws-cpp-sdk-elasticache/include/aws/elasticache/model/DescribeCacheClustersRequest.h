@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeCacheClustersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCacheClusters"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeCacheEngineVersionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCacheEngineVersions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
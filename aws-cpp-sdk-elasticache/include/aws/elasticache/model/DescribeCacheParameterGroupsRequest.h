@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeCacheParameterGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCacheParameterGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeCacheParametersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCacheParameters"; }
+
     Aws::String SerializePayload() const override;
 
     /**
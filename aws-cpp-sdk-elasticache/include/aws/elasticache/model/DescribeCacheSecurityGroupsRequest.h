@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeCacheSecurityGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCacheSecurityGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
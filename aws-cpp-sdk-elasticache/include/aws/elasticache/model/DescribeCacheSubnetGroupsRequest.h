@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeCacheSubnetGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCacheSubnetGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
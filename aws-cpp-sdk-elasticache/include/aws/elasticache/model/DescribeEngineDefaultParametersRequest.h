@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeEngineDefaultParametersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEngineDefaultParameters"; }
+
     Aws::String SerializePayload() const override;
 
     /**
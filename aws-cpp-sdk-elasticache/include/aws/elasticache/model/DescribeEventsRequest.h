@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeEventsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEvents"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeReplicationGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReplicationGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeReservedCacheNodesOfferingsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReservedCacheNodesOfferings"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeReservedCacheNodesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReservedCacheNodes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
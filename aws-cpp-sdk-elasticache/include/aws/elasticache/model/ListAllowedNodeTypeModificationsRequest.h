@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListAllowedNodeTypeModificationsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListAllowedNodeTypeModifications"; }
+
     Aws::String SerializePayload() const override;
 
     /**
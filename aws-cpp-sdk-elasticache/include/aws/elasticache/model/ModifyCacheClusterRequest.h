@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ModifyCacheClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyCacheCluster"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ModifyCacheParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyCacheParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyCacheSubnetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyCacheSubnetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyReplicationGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyReplicationGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
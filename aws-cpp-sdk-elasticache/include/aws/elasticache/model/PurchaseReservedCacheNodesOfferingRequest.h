@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PurchaseReservedCacheNodesOfferingRequest();
+    inline const char* GetServiceRequestName() const override { return "PurchaseReservedCacheNodesOffering"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RebootCacheClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "RebootCacheCluster"; }
+
     Aws::String SerializePayload() const override;
 
     /**
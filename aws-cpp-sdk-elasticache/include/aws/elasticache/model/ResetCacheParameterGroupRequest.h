@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ResetCacheParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "ResetCacheParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RevokeCacheSecurityGroupIngressRequest();
+    inline const char* GetServiceRequestName() const override { return "RevokeCacheSecurityGroupIngress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
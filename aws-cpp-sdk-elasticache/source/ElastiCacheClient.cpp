@@ -147,7 +147,7 @@ AddTagsToResourceOutcome ElastiCacheClient::AddTagsToResource(const AddTagsToRes
 
 AddTagsToResourceOutcomeCallable ElastiCacheClient::AddTagsToResourceCallable(const AddTagsToResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTagsToResource( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTagsToResource( request ); } );
 }
 
 void ElastiCacheClient::AddTagsToResourceAsync(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -155,6 +155,16 @@ void ElastiCacheClient::AddTagsToResourceAsync(const AddTagsToResourceRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsToResourceAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsToResourceOutcomeCallable ElastiCacheClient::AddTagsToResourceCallable(AddTagsToResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::AddTagsToResource, this, std::move(request)));
+}
+
+void ElastiCacheClient::AddTagsToResourceAsync(AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::AddTagsToResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::AddTagsToResourceAsyncHelper(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTagsToResource(request), context);
@@ -177,7 +187,7 @@ AuthorizeCacheSecurityGroupIngressOutcome ElastiCacheClient::AuthorizeCacheSecur
 
 AuthorizeCacheSecurityGroupIngressOutcomeCallable ElastiCacheClient::AuthorizeCacheSecurityGroupIngressCallable(const AuthorizeCacheSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AuthorizeCacheSecurityGroupIngress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AuthorizeCacheSecurityGroupIngress( request ); } );
 }
 
 void ElastiCacheClient::AuthorizeCacheSecurityGroupIngressAsync(const AuthorizeCacheSecurityGroupIngressRequest& request, const AuthorizeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -185,6 +195,16 @@ void ElastiCacheClient::AuthorizeCacheSecurityGroupIngressAsync(const AuthorizeC
   m_executor->Submit( [this, request, handler, context](){ this->AuthorizeCacheSecurityGroupIngressAsyncHelper( request, handler, context ); } );
 }
 
+AuthorizeCacheSecurityGroupIngressOutcomeCallable ElastiCacheClient::AuthorizeCacheSecurityGroupIngressCallable(AuthorizeCacheSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::AuthorizeCacheSecurityGroupIngress, this, std::move(request)));
+}
+
+void ElastiCacheClient::AuthorizeCacheSecurityGroupIngressAsync(AuthorizeCacheSecurityGroupIngressRequest&& request, const AuthorizeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::AuthorizeCacheSecurityGroupIngressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::AuthorizeCacheSecurityGroupIngressAsyncHelper(const AuthorizeCacheSecurityGroupIngressRequest& request, const AuthorizeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AuthorizeCacheSecurityGroupIngress(request), context);
@@ -207,7 +227,7 @@ CopySnapshotOutcome ElastiCacheClient::CopySnapshot(const CopySnapshotRequest& r
 
 CopySnapshotOutcomeCallable ElastiCacheClient::CopySnapshotCallable(const CopySnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CopySnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CopySnapshot( request ); } );
 }
 
 void ElastiCacheClient::CopySnapshotAsync(const CopySnapshotRequest& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -215,6 +235,16 @@ void ElastiCacheClient::CopySnapshotAsync(const CopySnapshotRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CopySnapshotAsyncHelper( request, handler, context ); } );
 }
 
+CopySnapshotOutcomeCallable ElastiCacheClient::CopySnapshotCallable(CopySnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::CopySnapshot, this, std::move(request)));
+}
+
+void ElastiCacheClient::CopySnapshotAsync(CopySnapshotRequest&& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::CopySnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::CopySnapshotAsyncHelper(const CopySnapshotRequest& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CopySnapshot(request), context);
@@ -237,7 +267,7 @@ CreateCacheClusterOutcome ElastiCacheClient::CreateCacheCluster(const CreateCach
 
 CreateCacheClusterOutcomeCallable ElastiCacheClient::CreateCacheClusterCallable(const CreateCacheClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateCacheCluster( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateCacheCluster( request ); } );
 }
 
 void ElastiCacheClient::CreateCacheClusterAsync(const CreateCacheClusterRequest& request, const CreateCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -245,6 +275,16 @@ void ElastiCacheClient::CreateCacheClusterAsync(const CreateCacheClusterRequest&
   m_executor->Submit( [this, request, handler, context](){ this->CreateCacheClusterAsyncHelper( request, handler, context ); } );
 }
 
+CreateCacheClusterOutcomeCallable ElastiCacheClient::CreateCacheClusterCallable(CreateCacheClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::CreateCacheCluster, this, std::move(request)));
+}
+
+void ElastiCacheClient::CreateCacheClusterAsync(CreateCacheClusterRequest&& request, const CreateCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::CreateCacheClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::CreateCacheClusterAsyncHelper(const CreateCacheClusterRequest& request, const CreateCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateCacheCluster(request), context);
@@ -267,7 +307,7 @@ CreateCacheParameterGroupOutcome ElastiCacheClient::CreateCacheParameterGroup(co
 
 CreateCacheParameterGroupOutcomeCallable ElastiCacheClient::CreateCacheParameterGroupCallable(const CreateCacheParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateCacheParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateCacheParameterGroup( request ); } );
 }
 
 void ElastiCacheClient::CreateCacheParameterGroupAsync(const CreateCacheParameterGroupRequest& request, const CreateCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -275,6 +315,16 @@ void ElastiCacheClient::CreateCacheParameterGroupAsync(const CreateCacheParamete
   m_executor->Submit( [this, request, handler, context](){ this->CreateCacheParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateCacheParameterGroupOutcomeCallable ElastiCacheClient::CreateCacheParameterGroupCallable(CreateCacheParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::CreateCacheParameterGroup, this, std::move(request)));
+}
+
+void ElastiCacheClient::CreateCacheParameterGroupAsync(CreateCacheParameterGroupRequest&& request, const CreateCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::CreateCacheParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::CreateCacheParameterGroupAsyncHelper(const CreateCacheParameterGroupRequest& request, const CreateCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateCacheParameterGroup(request), context);
@@ -297,7 +347,7 @@ CreateCacheSecurityGroupOutcome ElastiCacheClient::CreateCacheSecurityGroup(cons
 
 CreateCacheSecurityGroupOutcomeCallable ElastiCacheClient::CreateCacheSecurityGroupCallable(const CreateCacheSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateCacheSecurityGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateCacheSecurityGroup( request ); } );
 }
 
 void ElastiCacheClient::CreateCacheSecurityGroupAsync(const CreateCacheSecurityGroupRequest& request, const CreateCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -305,6 +355,16 @@ void ElastiCacheClient::CreateCacheSecurityGroupAsync(const CreateCacheSecurityG
   m_executor->Submit( [this, request, handler, context](){ this->CreateCacheSecurityGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateCacheSecurityGroupOutcomeCallable ElastiCacheClient::CreateCacheSecurityGroupCallable(CreateCacheSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::CreateCacheSecurityGroup, this, std::move(request)));
+}
+
+void ElastiCacheClient::CreateCacheSecurityGroupAsync(CreateCacheSecurityGroupRequest&& request, const CreateCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::CreateCacheSecurityGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::CreateCacheSecurityGroupAsyncHelper(const CreateCacheSecurityGroupRequest& request, const CreateCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateCacheSecurityGroup(request), context);
@@ -327,7 +387,7 @@ CreateCacheSubnetGroupOutcome ElastiCacheClient::CreateCacheSubnetGroup(const Cr
 
 CreateCacheSubnetGroupOutcomeCallable ElastiCacheClient::CreateCacheSubnetGroupCallable(const CreateCacheSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateCacheSubnetGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateCacheSubnetGroup( request ); } );
 }
 
 void ElastiCacheClient::CreateCacheSubnetGroupAsync(const CreateCacheSubnetGroupRequest& request, const CreateCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -335,6 +395,16 @@ void ElastiCacheClient::CreateCacheSubnetGroupAsync(const CreateCacheSubnetGroup
   m_executor->Submit( [this, request, handler, context](){ this->CreateCacheSubnetGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateCacheSubnetGroupOutcomeCallable ElastiCacheClient::CreateCacheSubnetGroupCallable(CreateCacheSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::CreateCacheSubnetGroup, this, std::move(request)));
+}
+
+void ElastiCacheClient::CreateCacheSubnetGroupAsync(CreateCacheSubnetGroupRequest&& request, const CreateCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::CreateCacheSubnetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::CreateCacheSubnetGroupAsyncHelper(const CreateCacheSubnetGroupRequest& request, const CreateCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateCacheSubnetGroup(request), context);
@@ -357,7 +427,7 @@ CreateReplicationGroupOutcome ElastiCacheClient::CreateReplicationGroup(const Cr
 
 CreateReplicationGroupOutcomeCallable ElastiCacheClient::CreateReplicationGroupCallable(const CreateReplicationGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateReplicationGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateReplicationGroup( request ); } );
 }
 
 void ElastiCacheClient::CreateReplicationGroupAsync(const CreateReplicationGroupRequest& request, const CreateReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -365,6 +435,16 @@ void ElastiCacheClient::CreateReplicationGroupAsync(const CreateReplicationGroup
   m_executor->Submit( [this, request, handler, context](){ this->CreateReplicationGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateReplicationGroupOutcomeCallable ElastiCacheClient::CreateReplicationGroupCallable(CreateReplicationGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::CreateReplicationGroup, this, std::move(request)));
+}
+
+void ElastiCacheClient::CreateReplicationGroupAsync(CreateReplicationGroupRequest&& request, const CreateReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::CreateReplicationGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::CreateReplicationGroupAsyncHelper(const CreateReplicationGroupRequest& request, const CreateReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateReplicationGroup(request), context);
@@ -387,7 +467,7 @@ CreateSnapshotOutcome ElastiCacheClient::CreateSnapshot(const CreateSnapshotRequ
 
 CreateSnapshotOutcomeCallable ElastiCacheClient::CreateSnapshotCallable(const CreateSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateSnapshot( request ); } );
 }
 
 void ElastiCacheClient::CreateSnapshotAsync(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -395,6 +475,16 @@ void ElastiCacheClient::CreateSnapshotAsync(const CreateSnapshotRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->CreateSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+CreateSnapshotOutcomeCallable ElastiCacheClient::CreateSnapshotCallable(CreateSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::CreateSnapshot, this, std::move(request)));
+}
+
+void ElastiCacheClient::CreateSnapshotAsync(CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::CreateSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::CreateSnapshotAsyncHelper(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateSnapshot(request), context);
@@ -417,7 +507,7 @@ DeleteCacheClusterOutcome ElastiCacheClient::DeleteCacheCluster(const DeleteCach
 
 DeleteCacheClusterOutcomeCallable ElastiCacheClient::DeleteCacheClusterCallable(const DeleteCacheClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteCacheCluster( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteCacheCluster( request ); } );
 }
 
 void ElastiCacheClient::DeleteCacheClusterAsync(const DeleteCacheClusterRequest& request, const DeleteCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -425,6 +515,16 @@ void ElastiCacheClient::DeleteCacheClusterAsync(const DeleteCacheClusterRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DeleteCacheClusterAsyncHelper( request, handler, context ); } );
 }
 
+DeleteCacheClusterOutcomeCallable ElastiCacheClient::DeleteCacheClusterCallable(DeleteCacheClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DeleteCacheCluster, this, std::move(request)));
+}
+
+void ElastiCacheClient::DeleteCacheClusterAsync(DeleteCacheClusterRequest&& request, const DeleteCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DeleteCacheClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DeleteCacheClusterAsyncHelper(const DeleteCacheClusterRequest& request, const DeleteCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteCacheCluster(request), context);
@@ -447,7 +547,7 @@ DeleteCacheParameterGroupOutcome ElastiCacheClient::DeleteCacheParameterGroup(co
 
 DeleteCacheParameterGroupOutcomeCallable ElastiCacheClient::DeleteCacheParameterGroupCallable(const DeleteCacheParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteCacheParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteCacheParameterGroup( request ); } );
 }
 
 void ElastiCacheClient::DeleteCacheParameterGroupAsync(const DeleteCacheParameterGroupRequest& request, const DeleteCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -455,6 +555,16 @@ void ElastiCacheClient::DeleteCacheParameterGroupAsync(const DeleteCacheParamete
   m_executor->Submit( [this, request, handler, context](){ this->DeleteCacheParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteCacheParameterGroupOutcomeCallable ElastiCacheClient::DeleteCacheParameterGroupCallable(DeleteCacheParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DeleteCacheParameterGroup, this, std::move(request)));
+}
+
+void ElastiCacheClient::DeleteCacheParameterGroupAsync(DeleteCacheParameterGroupRequest&& request, const DeleteCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DeleteCacheParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DeleteCacheParameterGroupAsyncHelper(const DeleteCacheParameterGroupRequest& request, const DeleteCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteCacheParameterGroup(request), context);
@@ -477,7 +587,7 @@ DeleteCacheSecurityGroupOutcome ElastiCacheClient::DeleteCacheSecurityGroup(cons
 
 DeleteCacheSecurityGroupOutcomeCallable ElastiCacheClient::DeleteCacheSecurityGroupCallable(const DeleteCacheSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteCacheSecurityGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteCacheSecurityGroup( request ); } );
 }
 
 void ElastiCacheClient::DeleteCacheSecurityGroupAsync(const DeleteCacheSecurityGroupRequest& request, const DeleteCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -485,6 +595,16 @@ void ElastiCacheClient::DeleteCacheSecurityGroupAsync(const DeleteCacheSecurityG
   m_executor->Submit( [this, request, handler, context](){ this->DeleteCacheSecurityGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteCacheSecurityGroupOutcomeCallable ElastiCacheClient::DeleteCacheSecurityGroupCallable(DeleteCacheSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DeleteCacheSecurityGroup, this, std::move(request)));
+}
+
+void ElastiCacheClient::DeleteCacheSecurityGroupAsync(DeleteCacheSecurityGroupRequest&& request, const DeleteCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DeleteCacheSecurityGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DeleteCacheSecurityGroupAsyncHelper(const DeleteCacheSecurityGroupRequest& request, const DeleteCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteCacheSecurityGroup(request), context);
@@ -507,7 +627,7 @@ DeleteCacheSubnetGroupOutcome ElastiCacheClient::DeleteCacheSubnetGroup(const De
 
 DeleteCacheSubnetGroupOutcomeCallable ElastiCacheClient::DeleteCacheSubnetGroupCallable(const DeleteCacheSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteCacheSubnetGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteCacheSubnetGroup( request ); } );
 }
 
 void ElastiCacheClient::DeleteCacheSubnetGroupAsync(const DeleteCacheSubnetGroupRequest& request, const DeleteCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -515,6 +635,16 @@ void ElastiCacheClient::DeleteCacheSubnetGroupAsync(const DeleteCacheSubnetGroup
   m_executor->Submit( [this, request, handler, context](){ this->DeleteCacheSubnetGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteCacheSubnetGroupOutcomeCallable ElastiCacheClient::DeleteCacheSubnetGroupCallable(DeleteCacheSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DeleteCacheSubnetGroup, this, std::move(request)));
+}
+
+void ElastiCacheClient::DeleteCacheSubnetGroupAsync(DeleteCacheSubnetGroupRequest&& request, const DeleteCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DeleteCacheSubnetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DeleteCacheSubnetGroupAsyncHelper(const DeleteCacheSubnetGroupRequest& request, const DeleteCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteCacheSubnetGroup(request), context);
@@ -537,7 +667,7 @@ DeleteReplicationGroupOutcome ElastiCacheClient::DeleteReplicationGroup(const De
 
 DeleteReplicationGroupOutcomeCallable ElastiCacheClient::DeleteReplicationGroupCallable(const DeleteReplicationGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteReplicationGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteReplicationGroup( request ); } );
 }
 
 void ElastiCacheClient::DeleteReplicationGroupAsync(const DeleteReplicationGroupRequest& request, const DeleteReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -545,6 +675,16 @@ void ElastiCacheClient::DeleteReplicationGroupAsync(const DeleteReplicationGroup
   m_executor->Submit( [this, request, handler, context](){ this->DeleteReplicationGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteReplicationGroupOutcomeCallable ElastiCacheClient::DeleteReplicationGroupCallable(DeleteReplicationGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DeleteReplicationGroup, this, std::move(request)));
+}
+
+void ElastiCacheClient::DeleteReplicationGroupAsync(DeleteReplicationGroupRequest&& request, const DeleteReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DeleteReplicationGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DeleteReplicationGroupAsyncHelper(const DeleteReplicationGroupRequest& request, const DeleteReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteReplicationGroup(request), context);
@@ -567,7 +707,7 @@ DeleteSnapshotOutcome ElastiCacheClient::DeleteSnapshot(const DeleteSnapshotRequ
 
 DeleteSnapshotOutcomeCallable ElastiCacheClient::DeleteSnapshotCallable(const DeleteSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteSnapshot( request ); } );
 }
 
 void ElastiCacheClient::DeleteSnapshotAsync(const DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -575,6 +715,16 @@ void ElastiCacheClient::DeleteSnapshotAsync(const DeleteSnapshotRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DeleteSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+DeleteSnapshotOutcomeCallable ElastiCacheClient::DeleteSnapshotCallable(DeleteSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DeleteSnapshot, this, std::move(request)));
+}
+
+void ElastiCacheClient::DeleteSnapshotAsync(DeleteSnapshotRequest&& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DeleteSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DeleteSnapshotAsyncHelper(const DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteSnapshot(request), context);
@@ -597,7 +747,7 @@ DescribeCacheClustersOutcome ElastiCacheClient::DescribeCacheClusters(const Desc
 
 DescribeCacheClustersOutcomeCallable ElastiCacheClient::DescribeCacheClustersCallable(const DescribeCacheClustersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCacheClusters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCacheClusters( request ); } );
 }
 
 void ElastiCacheClient::DescribeCacheClustersAsync(const DescribeCacheClustersRequest& request, const DescribeCacheClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -605,6 +755,16 @@ void ElastiCacheClient::DescribeCacheClustersAsync(const DescribeCacheClustersRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCacheClustersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCacheClustersOutcomeCallable ElastiCacheClient::DescribeCacheClustersCallable(DescribeCacheClustersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DescribeCacheClusters, this, std::move(request)));
+}
+
+void ElastiCacheClient::DescribeCacheClustersAsync(DescribeCacheClustersRequest&& request, const DescribeCacheClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DescribeCacheClustersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DescribeCacheClustersAsyncHelper(const DescribeCacheClustersRequest& request, const DescribeCacheClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCacheClusters(request), context);
@@ -627,7 +787,7 @@ DescribeCacheEngineVersionsOutcome ElastiCacheClient::DescribeCacheEngineVersion
 
 DescribeCacheEngineVersionsOutcomeCallable ElastiCacheClient::DescribeCacheEngineVersionsCallable(const DescribeCacheEngineVersionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCacheEngineVersions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCacheEngineVersions( request ); } );
 }
 
 void ElastiCacheClient::DescribeCacheEngineVersionsAsync(const DescribeCacheEngineVersionsRequest& request, const DescribeCacheEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -635,6 +795,16 @@ void ElastiCacheClient::DescribeCacheEngineVersionsAsync(const DescribeCacheEngi
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCacheEngineVersionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCacheEngineVersionsOutcomeCallable ElastiCacheClient::DescribeCacheEngineVersionsCallable(DescribeCacheEngineVersionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DescribeCacheEngineVersions, this, std::move(request)));
+}
+
+void ElastiCacheClient::DescribeCacheEngineVersionsAsync(DescribeCacheEngineVersionsRequest&& request, const DescribeCacheEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DescribeCacheEngineVersionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DescribeCacheEngineVersionsAsyncHelper(const DescribeCacheEngineVersionsRequest& request, const DescribeCacheEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCacheEngineVersions(request), context);
@@ -657,7 +827,7 @@ DescribeCacheParameterGroupsOutcome ElastiCacheClient::DescribeCacheParameterGro
 
 DescribeCacheParameterGroupsOutcomeCallable ElastiCacheClient::DescribeCacheParameterGroupsCallable(const DescribeCacheParameterGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCacheParameterGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCacheParameterGroups( request ); } );
 }
 
 void ElastiCacheClient::DescribeCacheParameterGroupsAsync(const DescribeCacheParameterGroupsRequest& request, const DescribeCacheParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -665,6 +835,16 @@ void ElastiCacheClient::DescribeCacheParameterGroupsAsync(const DescribeCachePar
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCacheParameterGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCacheParameterGroupsOutcomeCallable ElastiCacheClient::DescribeCacheParameterGroupsCallable(DescribeCacheParameterGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DescribeCacheParameterGroups, this, std::move(request)));
+}
+
+void ElastiCacheClient::DescribeCacheParameterGroupsAsync(DescribeCacheParameterGroupsRequest&& request, const DescribeCacheParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DescribeCacheParameterGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DescribeCacheParameterGroupsAsyncHelper(const DescribeCacheParameterGroupsRequest& request, const DescribeCacheParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCacheParameterGroups(request), context);
@@ -687,7 +867,7 @@ DescribeCacheParametersOutcome ElastiCacheClient::DescribeCacheParameters(const
 
 DescribeCacheParametersOutcomeCallable ElastiCacheClient::DescribeCacheParametersCallable(const DescribeCacheParametersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCacheParameters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCacheParameters( request ); } );
 }
 
 void ElastiCacheClient::DescribeCacheParametersAsync(const DescribeCacheParametersRequest& request, const DescribeCacheParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -695,6 +875,16 @@ void ElastiCacheClient::DescribeCacheParametersAsync(const DescribeCacheParamete
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCacheParametersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCacheParametersOutcomeCallable ElastiCacheClient::DescribeCacheParametersCallable(DescribeCacheParametersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DescribeCacheParameters, this, std::move(request)));
+}
+
+void ElastiCacheClient::DescribeCacheParametersAsync(DescribeCacheParametersRequest&& request, const DescribeCacheParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DescribeCacheParametersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DescribeCacheParametersAsyncHelper(const DescribeCacheParametersRequest& request, const DescribeCacheParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCacheParameters(request), context);
@@ -717,7 +907,7 @@ DescribeCacheSecurityGroupsOutcome ElastiCacheClient::DescribeCacheSecurityGroup
 
 DescribeCacheSecurityGroupsOutcomeCallable ElastiCacheClient::DescribeCacheSecurityGroupsCallable(const DescribeCacheSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCacheSecurityGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCacheSecurityGroups( request ); } );
 }
 
 void ElastiCacheClient::DescribeCacheSecurityGroupsAsync(const DescribeCacheSecurityGroupsRequest& request, const DescribeCacheSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -725,6 +915,16 @@ void ElastiCacheClient::DescribeCacheSecurityGroupsAsync(const DescribeCacheSecu
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCacheSecurityGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCacheSecurityGroupsOutcomeCallable ElastiCacheClient::DescribeCacheSecurityGroupsCallable(DescribeCacheSecurityGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DescribeCacheSecurityGroups, this, std::move(request)));
+}
+
+void ElastiCacheClient::DescribeCacheSecurityGroupsAsync(DescribeCacheSecurityGroupsRequest&& request, const DescribeCacheSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DescribeCacheSecurityGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DescribeCacheSecurityGroupsAsyncHelper(const DescribeCacheSecurityGroupsRequest& request, const DescribeCacheSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCacheSecurityGroups(request), context);
@@ -747,7 +947,7 @@ DescribeCacheSubnetGroupsOutcome ElastiCacheClient::DescribeCacheSubnetGroups(co
 
 DescribeCacheSubnetGroupsOutcomeCallable ElastiCacheClient::DescribeCacheSubnetGroupsCallable(const DescribeCacheSubnetGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCacheSubnetGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCacheSubnetGroups( request ); } );
 }
 
 void ElastiCacheClient::DescribeCacheSubnetGroupsAsync(const DescribeCacheSubnetGroupsRequest& request, const DescribeCacheSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -755,6 +955,16 @@ void ElastiCacheClient::DescribeCacheSubnetGroupsAsync(const DescribeCacheSubnet
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCacheSubnetGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCacheSubnetGroupsOutcomeCallable ElastiCacheClient::DescribeCacheSubnetGroupsCallable(DescribeCacheSubnetGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DescribeCacheSubnetGroups, this, std::move(request)));
+}
+
+void ElastiCacheClient::DescribeCacheSubnetGroupsAsync(DescribeCacheSubnetGroupsRequest&& request, const DescribeCacheSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DescribeCacheSubnetGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DescribeCacheSubnetGroupsAsyncHelper(const DescribeCacheSubnetGroupsRequest& request, const DescribeCacheSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCacheSubnetGroups(request), context);
@@ -777,7 +987,7 @@ DescribeEngineDefaultParametersOutcome ElastiCacheClient::DescribeEngineDefaultP
 
 DescribeEngineDefaultParametersOutcomeCallable ElastiCacheClient::DescribeEngineDefaultParametersCallable(const DescribeEngineDefaultParametersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEngineDefaultParameters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEngineDefaultParameters( request ); } );
 }
 
 void ElastiCacheClient::DescribeEngineDefaultParametersAsync(const DescribeEngineDefaultParametersRequest& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -785,6 +995,16 @@ void ElastiCacheClient::DescribeEngineDefaultParametersAsync(const DescribeEngin
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEngineDefaultParametersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEngineDefaultParametersOutcomeCallable ElastiCacheClient::DescribeEngineDefaultParametersCallable(DescribeEngineDefaultParametersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DescribeEngineDefaultParameters, this, std::move(request)));
+}
+
+void ElastiCacheClient::DescribeEngineDefaultParametersAsync(DescribeEngineDefaultParametersRequest&& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DescribeEngineDefaultParametersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DescribeEngineDefaultParametersAsyncHelper(const DescribeEngineDefaultParametersRequest& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEngineDefaultParameters(request), context);
@@ -807,7 +1027,7 @@ DescribeEventsOutcome ElastiCacheClient::DescribeEvents(const DescribeEventsRequ
 
 DescribeEventsOutcomeCallable ElastiCacheClient::DescribeEventsCallable(const DescribeEventsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEvents( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEvents( request ); } );
 }
 
 void ElastiCacheClient::DescribeEventsAsync(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -815,6 +1035,16 @@ void ElastiCacheClient::DescribeEventsAsync(const DescribeEventsRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEventsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEventsOutcomeCallable ElastiCacheClient::DescribeEventsCallable(DescribeEventsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DescribeEvents, this, std::move(request)));
+}
+
+void ElastiCacheClient::DescribeEventsAsync(DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DescribeEventsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DescribeEventsAsyncHelper(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEvents(request), context);
@@ -837,7 +1067,7 @@ DescribeReplicationGroupsOutcome ElastiCacheClient::DescribeReplicationGroups(co
 
 DescribeReplicationGroupsOutcomeCallable ElastiCacheClient::DescribeReplicationGroupsCallable(const DescribeReplicationGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReplicationGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReplicationGroups( request ); } );
 }
 
 void ElastiCacheClient::DescribeReplicationGroupsAsync(const DescribeReplicationGroupsRequest& request, const DescribeReplicationGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -845,6 +1075,16 @@ void ElastiCacheClient::DescribeReplicationGroupsAsync(const DescribeReplication
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReplicationGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReplicationGroupsOutcomeCallable ElastiCacheClient::DescribeReplicationGroupsCallable(DescribeReplicationGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DescribeReplicationGroups, this, std::move(request)));
+}
+
+void ElastiCacheClient::DescribeReplicationGroupsAsync(DescribeReplicationGroupsRequest&& request, const DescribeReplicationGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DescribeReplicationGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DescribeReplicationGroupsAsyncHelper(const DescribeReplicationGroupsRequest& request, const DescribeReplicationGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReplicationGroups(request), context);
@@ -867,7 +1107,7 @@ DescribeReservedCacheNodesOutcome ElastiCacheClient::DescribeReservedCacheNodes(
 
 DescribeReservedCacheNodesOutcomeCallable ElastiCacheClient::DescribeReservedCacheNodesCallable(const DescribeReservedCacheNodesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReservedCacheNodes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReservedCacheNodes( request ); } );
 }
 
 void ElastiCacheClient::DescribeReservedCacheNodesAsync(const DescribeReservedCacheNodesRequest& request, const DescribeReservedCacheNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -875,6 +1115,16 @@ void ElastiCacheClient::DescribeReservedCacheNodesAsync(const DescribeReservedCa
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReservedCacheNodesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReservedCacheNodesOutcomeCallable ElastiCacheClient::DescribeReservedCacheNodesCallable(DescribeReservedCacheNodesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DescribeReservedCacheNodes, this, std::move(request)));
+}
+
+void ElastiCacheClient::DescribeReservedCacheNodesAsync(DescribeReservedCacheNodesRequest&& request, const DescribeReservedCacheNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DescribeReservedCacheNodesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DescribeReservedCacheNodesAsyncHelper(const DescribeReservedCacheNodesRequest& request, const DescribeReservedCacheNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReservedCacheNodes(request), context);
@@ -897,7 +1147,7 @@ DescribeReservedCacheNodesOfferingsOutcome ElastiCacheClient::DescribeReservedCa
 
 DescribeReservedCacheNodesOfferingsOutcomeCallable ElastiCacheClient::DescribeReservedCacheNodesOfferingsCallable(const DescribeReservedCacheNodesOfferingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReservedCacheNodesOfferings( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReservedCacheNodesOfferings( request ); } );
 }
 
 void ElastiCacheClient::DescribeReservedCacheNodesOfferingsAsync(const DescribeReservedCacheNodesOfferingsRequest& request, const DescribeReservedCacheNodesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -905,6 +1155,16 @@ void ElastiCacheClient::DescribeReservedCacheNodesOfferingsAsync(const DescribeR
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReservedCacheNodesOfferingsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReservedCacheNodesOfferingsOutcomeCallable ElastiCacheClient::DescribeReservedCacheNodesOfferingsCallable(DescribeReservedCacheNodesOfferingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DescribeReservedCacheNodesOfferings, this, std::move(request)));
+}
+
+void ElastiCacheClient::DescribeReservedCacheNodesOfferingsAsync(DescribeReservedCacheNodesOfferingsRequest&& request, const DescribeReservedCacheNodesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DescribeReservedCacheNodesOfferingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DescribeReservedCacheNodesOfferingsAsyncHelper(const DescribeReservedCacheNodesOfferingsRequest& request, const DescribeReservedCacheNodesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReservedCacheNodesOfferings(request), context);
@@ -927,7 +1187,7 @@ DescribeSnapshotsOutcome ElastiCacheClient::DescribeSnapshots(const DescribeSnap
 
 DescribeSnapshotsOutcomeCallable ElastiCacheClient::DescribeSnapshotsCallable(const DescribeSnapshotsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSnapshots( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSnapshots( request ); } );
 }
 
 void ElastiCacheClient::DescribeSnapshotsAsync(const DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -935,6 +1195,16 @@ void ElastiCacheClient::DescribeSnapshotsAsync(const DescribeSnapshotsRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSnapshotsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSnapshotsOutcomeCallable ElastiCacheClient::DescribeSnapshotsCallable(DescribeSnapshotsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::DescribeSnapshots, this, std::move(request)));
+}
+
+void ElastiCacheClient::DescribeSnapshotsAsync(DescribeSnapshotsRequest&& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::DescribeSnapshotsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::DescribeSnapshotsAsyncHelper(const DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSnapshots(request), context);
@@ -957,7 +1227,7 @@ ListAllowedNodeTypeModificationsOutcome ElastiCacheClient::ListAllowedNodeTypeMo
 
 ListAllowedNodeTypeModificationsOutcomeCallable ElastiCacheClient::ListAllowedNodeTypeModificationsCallable(const ListAllowedNodeTypeModificationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAllowedNodeTypeModifications( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAllowedNodeTypeModifications( request ); } );
 }
 
 void ElastiCacheClient::ListAllowedNodeTypeModificationsAsync(const ListAllowedNodeTypeModificationsRequest& request, const ListAllowedNodeTypeModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -965,6 +1235,16 @@ void ElastiCacheClient::ListAllowedNodeTypeModificationsAsync(const ListAllowedN
   m_executor->Submit( [this, request, handler, context](){ this->ListAllowedNodeTypeModificationsAsyncHelper( request, handler, context ); } );
 }
 
+ListAllowedNodeTypeModificationsOutcomeCallable ElastiCacheClient::ListAllowedNodeTypeModificationsCallable(ListAllowedNodeTypeModificationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::ListAllowedNodeTypeModifications, this, std::move(request)));
+}
+
+void ElastiCacheClient::ListAllowedNodeTypeModificationsAsync(ListAllowedNodeTypeModificationsRequest&& request, const ListAllowedNodeTypeModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::ListAllowedNodeTypeModificationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::ListAllowedNodeTypeModificationsAsyncHelper(const ListAllowedNodeTypeModificationsRequest& request, const ListAllowedNodeTypeModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAllowedNodeTypeModifications(request), context);
@@ -987,7 +1267,7 @@ ListTagsForResourceOutcome ElastiCacheClient::ListTagsForResource(const ListTags
 
 ListTagsForResourceOutcomeCallable ElastiCacheClient::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTagsForResource( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTagsForResource( request ); } );
 }
 
 void ElastiCacheClient::ListTagsForResourceAsync(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -995,6 +1275,16 @@ void ElastiCacheClient::ListTagsForResourceAsync(const ListTagsForResourceReques
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsForResourceAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsForResourceOutcomeCallable ElastiCacheClient::ListTagsForResourceCallable(ListTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::ListTagsForResource, this, std::move(request)));
+}
+
+void ElastiCacheClient::ListTagsForResourceAsync(ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::ListTagsForResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTagsForResource(request), context);
@@ -1017,7 +1307,7 @@ ModifyCacheClusterOutcome ElastiCacheClient::ModifyCacheCluster(const ModifyCach
 
 ModifyCacheClusterOutcomeCallable ElastiCacheClient::ModifyCacheClusterCallable(const ModifyCacheClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyCacheCluster( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyCacheCluster( request ); } );
 }
 
 void ElastiCacheClient::ModifyCacheClusterAsync(const ModifyCacheClusterRequest& request, const ModifyCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1025,6 +1315,16 @@ void ElastiCacheClient::ModifyCacheClusterAsync(const ModifyCacheClusterRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ModifyCacheClusterAsyncHelper( request, handler, context ); } );
 }
 
+ModifyCacheClusterOutcomeCallable ElastiCacheClient::ModifyCacheClusterCallable(ModifyCacheClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::ModifyCacheCluster, this, std::move(request)));
+}
+
+void ElastiCacheClient::ModifyCacheClusterAsync(ModifyCacheClusterRequest&& request, const ModifyCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::ModifyCacheClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::ModifyCacheClusterAsyncHelper(const ModifyCacheClusterRequest& request, const ModifyCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyCacheCluster(request), context);
@@ -1047,7 +1347,7 @@ ModifyCacheParameterGroupOutcome ElastiCacheClient::ModifyCacheParameterGroup(co
 
 ModifyCacheParameterGroupOutcomeCallable ElastiCacheClient::ModifyCacheParameterGroupCallable(const ModifyCacheParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyCacheParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyCacheParameterGroup( request ); } );
 }
 
 void ElastiCacheClient::ModifyCacheParameterGroupAsync(const ModifyCacheParameterGroupRequest& request, const ModifyCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1055,6 +1355,16 @@ void ElastiCacheClient::ModifyCacheParameterGroupAsync(const ModifyCacheParamete
   m_executor->Submit( [this, request, handler, context](){ this->ModifyCacheParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+ModifyCacheParameterGroupOutcomeCallable ElastiCacheClient::ModifyCacheParameterGroupCallable(ModifyCacheParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::ModifyCacheParameterGroup, this, std::move(request)));
+}
+
+void ElastiCacheClient::ModifyCacheParameterGroupAsync(ModifyCacheParameterGroupRequest&& request, const ModifyCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::ModifyCacheParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::ModifyCacheParameterGroupAsyncHelper(const ModifyCacheParameterGroupRequest& request, const ModifyCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyCacheParameterGroup(request), context);
@@ -1077,7 +1387,7 @@ ModifyCacheSubnetGroupOutcome ElastiCacheClient::ModifyCacheSubnetGroup(const Mo
 
 ModifyCacheSubnetGroupOutcomeCallable ElastiCacheClient::ModifyCacheSubnetGroupCallable(const ModifyCacheSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyCacheSubnetGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyCacheSubnetGroup( request ); } );
 }
 
 void ElastiCacheClient::ModifyCacheSubnetGroupAsync(const ModifyCacheSubnetGroupRequest& request, const ModifyCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1085,6 +1395,16 @@ void ElastiCacheClient::ModifyCacheSubnetGroupAsync(const ModifyCacheSubnetGroup
   m_executor->Submit( [this, request, handler, context](){ this->ModifyCacheSubnetGroupAsyncHelper( request, handler, context ); } );
 }
 
+ModifyCacheSubnetGroupOutcomeCallable ElastiCacheClient::ModifyCacheSubnetGroupCallable(ModifyCacheSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::ModifyCacheSubnetGroup, this, std::move(request)));
+}
+
+void ElastiCacheClient::ModifyCacheSubnetGroupAsync(ModifyCacheSubnetGroupRequest&& request, const ModifyCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::ModifyCacheSubnetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::ModifyCacheSubnetGroupAsyncHelper(const ModifyCacheSubnetGroupRequest& request, const ModifyCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyCacheSubnetGroup(request), context);
@@ -1107,7 +1427,7 @@ ModifyReplicationGroupOutcome ElastiCacheClient::ModifyReplicationGroup(const Mo
 
 ModifyReplicationGroupOutcomeCallable ElastiCacheClient::ModifyReplicationGroupCallable(const ModifyReplicationGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyReplicationGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyReplicationGroup( request ); } );
 }
 
 void ElastiCacheClient::ModifyReplicationGroupAsync(const ModifyReplicationGroupRequest& request, const ModifyReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1115,6 +1435,16 @@ void ElastiCacheClient::ModifyReplicationGroupAsync(const ModifyReplicationGroup
   m_executor->Submit( [this, request, handler, context](){ this->ModifyReplicationGroupAsyncHelper( request, handler, context ); } );
 }
 
+ModifyReplicationGroupOutcomeCallable ElastiCacheClient::ModifyReplicationGroupCallable(ModifyReplicationGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::ModifyReplicationGroup, this, std::move(request)));
+}
+
+void ElastiCacheClient::ModifyReplicationGroupAsync(ModifyReplicationGroupRequest&& request, const ModifyReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::ModifyReplicationGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::ModifyReplicationGroupAsyncHelper(const ModifyReplicationGroupRequest& request, const ModifyReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyReplicationGroup(request), context);
@@ -1137,7 +1467,7 @@ PurchaseReservedCacheNodesOfferingOutcome ElastiCacheClient::PurchaseReservedCac
 
 PurchaseReservedCacheNodesOfferingOutcomeCallable ElastiCacheClient::PurchaseReservedCacheNodesOfferingCallable(const PurchaseReservedCacheNodesOfferingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PurchaseReservedCacheNodesOffering( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PurchaseReservedCacheNodesOffering( request ); } );
 }
 
 void ElastiCacheClient::PurchaseReservedCacheNodesOfferingAsync(const PurchaseReservedCacheNodesOfferingRequest& request, const PurchaseReservedCacheNodesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1145,6 +1475,16 @@ void ElastiCacheClient::PurchaseReservedCacheNodesOfferingAsync(const PurchaseRe
   m_executor->Submit( [this, request, handler, context](){ this->PurchaseReservedCacheNodesOfferingAsyncHelper( request, handler, context ); } );
 }
 
+PurchaseReservedCacheNodesOfferingOutcomeCallable ElastiCacheClient::PurchaseReservedCacheNodesOfferingCallable(PurchaseReservedCacheNodesOfferingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::PurchaseReservedCacheNodesOffering, this, std::move(request)));
+}
+
+void ElastiCacheClient::PurchaseReservedCacheNodesOfferingAsync(PurchaseReservedCacheNodesOfferingRequest&& request, const PurchaseReservedCacheNodesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::PurchaseReservedCacheNodesOfferingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::PurchaseReservedCacheNodesOfferingAsyncHelper(const PurchaseReservedCacheNodesOfferingRequest& request, const PurchaseReservedCacheNodesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PurchaseReservedCacheNodesOffering(request), context);
@@ -1167,7 +1507,7 @@ RebootCacheClusterOutcome ElastiCacheClient::RebootCacheCluster(const RebootCach
 
 RebootCacheClusterOutcomeCallable ElastiCacheClient::RebootCacheClusterCallable(const RebootCacheClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RebootCacheCluster( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RebootCacheCluster( request ); } );
 }
 
 void ElastiCacheClient::RebootCacheClusterAsync(const RebootCacheClusterRequest& request, const RebootCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1175,6 +1515,16 @@ void ElastiCacheClient::RebootCacheClusterAsync(const RebootCacheClusterRequest&
   m_executor->Submit( [this, request, handler, context](){ this->RebootCacheClusterAsyncHelper( request, handler, context ); } );
 }
 
+RebootCacheClusterOutcomeCallable ElastiCacheClient::RebootCacheClusterCallable(RebootCacheClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::RebootCacheCluster, this, std::move(request)));
+}
+
+void ElastiCacheClient::RebootCacheClusterAsync(RebootCacheClusterRequest&& request, const RebootCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::RebootCacheClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::RebootCacheClusterAsyncHelper(const RebootCacheClusterRequest& request, const RebootCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RebootCacheCluster(request), context);
@@ -1197,7 +1547,7 @@ RemoveTagsFromResourceOutcome ElastiCacheClient::RemoveTagsFromResource(const Re
 
 RemoveTagsFromResourceOutcomeCallable ElastiCacheClient::RemoveTagsFromResourceCallable(const RemoveTagsFromResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTagsFromResource( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTagsFromResource( request ); } );
 }
 
 void ElastiCacheClient::RemoveTagsFromResourceAsync(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1205,6 +1555,16 @@ void ElastiCacheClient::RemoveTagsFromResourceAsync(const RemoveTagsFromResource
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsFromResourceAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsFromResourceOutcomeCallable ElastiCacheClient::RemoveTagsFromResourceCallable(RemoveTagsFromResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::RemoveTagsFromResource, this, std::move(request)));
+}
+
+void ElastiCacheClient::RemoveTagsFromResourceAsync(RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::RemoveTagsFromResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::RemoveTagsFromResourceAsyncHelper(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTagsFromResource(request), context);
@@ -1227,7 +1587,7 @@ ResetCacheParameterGroupOutcome ElastiCacheClient::ResetCacheParameterGroup(cons
 
 ResetCacheParameterGroupOutcomeCallable ElastiCacheClient::ResetCacheParameterGroupCallable(const ResetCacheParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResetCacheParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResetCacheParameterGroup( request ); } );
 }
 
 void ElastiCacheClient::ResetCacheParameterGroupAsync(const ResetCacheParameterGroupRequest& request, const ResetCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1235,6 +1595,16 @@ void ElastiCacheClient::ResetCacheParameterGroupAsync(const ResetCacheParameterG
   m_executor->Submit( [this, request, handler, context](){ this->ResetCacheParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+ResetCacheParameterGroupOutcomeCallable ElastiCacheClient::ResetCacheParameterGroupCallable(ResetCacheParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::ResetCacheParameterGroup, this, std::move(request)));
+}
+
+void ElastiCacheClient::ResetCacheParameterGroupAsync(ResetCacheParameterGroupRequest&& request, const ResetCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::ResetCacheParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::ResetCacheParameterGroupAsyncHelper(const ResetCacheParameterGroupRequest& request, const ResetCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResetCacheParameterGroup(request), context);
@@ -1257,7 +1627,7 @@ RevokeCacheSecurityGroupIngressOutcome ElastiCacheClient::RevokeCacheSecurityGro
 
 RevokeCacheSecurityGroupIngressOutcomeCallable ElastiCacheClient::RevokeCacheSecurityGroupIngressCallable(const RevokeCacheSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RevokeCacheSecurityGroupIngress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RevokeCacheSecurityGroupIngress( request ); } );
 }
 
 void ElastiCacheClient::RevokeCacheSecurityGroupIngressAsync(const RevokeCacheSecurityGroupIngressRequest& request, const RevokeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1265,8 +1635,397 @@ void ElastiCacheClient::RevokeCacheSecurityGroupIngressAsync(const RevokeCacheSe
   m_executor->Submit( [this, request, handler, context](){ this->RevokeCacheSecurityGroupIngressAsyncHelper( request, handler, context ); } );
 }
 
+RevokeCacheSecurityGroupIngressOutcomeCallable ElastiCacheClient::RevokeCacheSecurityGroupIngressCallable(RevokeCacheSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElastiCacheClient::RevokeCacheSecurityGroupIngress, this, std::move(request)));
+}
+
+void ElastiCacheClient::RevokeCacheSecurityGroupIngressAsync(RevokeCacheSecurityGroupIngressRequest&& request, const RevokeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElastiCacheClient::RevokeCacheSecurityGroupIngressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElastiCacheClient::RevokeCacheSecurityGroupIngressAsyncHelper(const RevokeCacheSecurityGroupIngressRequest& request, const RevokeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RevokeCacheSecurityGroupIngress(request), context);
 }
 
+Paginator<ElastiCacheClient, DescribeCacheClustersRequest, DescribeCacheClustersOutcome> ElastiCacheClient::DescribeCacheClustersPaginator(const DescribeCacheClustersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElastiCacheClient, DescribeCacheClustersRequest, DescribeCacheClustersOutcome>(this, &ElastiCacheClient::DescribeCacheClusters, request,
+    [](const DescribeCacheClustersRequest& current, const DescribeCacheClustersOutcome& outcome, DescribeCacheClustersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElastiCacheClient, DescribeCacheEngineVersionsRequest, DescribeCacheEngineVersionsOutcome> ElastiCacheClient::DescribeCacheEngineVersionsPaginator(const DescribeCacheEngineVersionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElastiCacheClient, DescribeCacheEngineVersionsRequest, DescribeCacheEngineVersionsOutcome>(this, &ElastiCacheClient::DescribeCacheEngineVersions, request,
+    [](const DescribeCacheEngineVersionsRequest& current, const DescribeCacheEngineVersionsOutcome& outcome, DescribeCacheEngineVersionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElastiCacheClient, DescribeCacheParameterGroupsRequest, DescribeCacheParameterGroupsOutcome> ElastiCacheClient::DescribeCacheParameterGroupsPaginator(const DescribeCacheParameterGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElastiCacheClient, DescribeCacheParameterGroupsRequest, DescribeCacheParameterGroupsOutcome>(this, &ElastiCacheClient::DescribeCacheParameterGroups, request,
+    [](const DescribeCacheParameterGroupsRequest& current, const DescribeCacheParameterGroupsOutcome& outcome, DescribeCacheParameterGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElastiCacheClient, DescribeCacheParametersRequest, DescribeCacheParametersOutcome> ElastiCacheClient::DescribeCacheParametersPaginator(const DescribeCacheParametersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElastiCacheClient, DescribeCacheParametersRequest, DescribeCacheParametersOutcome>(this, &ElastiCacheClient::DescribeCacheParameters, request,
+    [](const DescribeCacheParametersRequest& current, const DescribeCacheParametersOutcome& outcome, DescribeCacheParametersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElastiCacheClient, DescribeCacheSecurityGroupsRequest, DescribeCacheSecurityGroupsOutcome> ElastiCacheClient::DescribeCacheSecurityGroupsPaginator(const DescribeCacheSecurityGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElastiCacheClient, DescribeCacheSecurityGroupsRequest, DescribeCacheSecurityGroupsOutcome>(this, &ElastiCacheClient::DescribeCacheSecurityGroups, request,
+    [](const DescribeCacheSecurityGroupsRequest& current, const DescribeCacheSecurityGroupsOutcome& outcome, DescribeCacheSecurityGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElastiCacheClient, DescribeCacheSubnetGroupsRequest, DescribeCacheSubnetGroupsOutcome> ElastiCacheClient::DescribeCacheSubnetGroupsPaginator(const DescribeCacheSubnetGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElastiCacheClient, DescribeCacheSubnetGroupsRequest, DescribeCacheSubnetGroupsOutcome>(this, &ElastiCacheClient::DescribeCacheSubnetGroups, request,
+    [](const DescribeCacheSubnetGroupsRequest& current, const DescribeCacheSubnetGroupsOutcome& outcome, DescribeCacheSubnetGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElastiCacheClient, DescribeEventsRequest, DescribeEventsOutcome> ElastiCacheClient::DescribeEventsPaginator(const DescribeEventsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElastiCacheClient, DescribeEventsRequest, DescribeEventsOutcome>(this, &ElastiCacheClient::DescribeEvents, request,
+    [](const DescribeEventsRequest& current, const DescribeEventsOutcome& outcome, DescribeEventsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElastiCacheClient, DescribeReplicationGroupsRequest, DescribeReplicationGroupsOutcome> ElastiCacheClient::DescribeReplicationGroupsPaginator(const DescribeReplicationGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElastiCacheClient, DescribeReplicationGroupsRequest, DescribeReplicationGroupsOutcome>(this, &ElastiCacheClient::DescribeReplicationGroups, request,
+    [](const DescribeReplicationGroupsRequest& current, const DescribeReplicationGroupsOutcome& outcome, DescribeReplicationGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElastiCacheClient, DescribeReservedCacheNodesRequest, DescribeReservedCacheNodesOutcome> ElastiCacheClient::DescribeReservedCacheNodesPaginator(const DescribeReservedCacheNodesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElastiCacheClient, DescribeReservedCacheNodesRequest, DescribeReservedCacheNodesOutcome>(this, &ElastiCacheClient::DescribeReservedCacheNodes, request,
+    [](const DescribeReservedCacheNodesRequest& current, const DescribeReservedCacheNodesOutcome& outcome, DescribeReservedCacheNodesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElastiCacheClient, DescribeReservedCacheNodesOfferingsRequest, DescribeReservedCacheNodesOfferingsOutcome> ElastiCacheClient::DescribeReservedCacheNodesOfferingsPaginator(const DescribeReservedCacheNodesOfferingsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElastiCacheClient, DescribeReservedCacheNodesOfferingsRequest, DescribeReservedCacheNodesOfferingsOutcome>(this, &ElastiCacheClient::DescribeReservedCacheNodesOfferings, request,
+    [](const DescribeReservedCacheNodesOfferingsRequest& current, const DescribeReservedCacheNodesOfferingsOutcome& outcome, DescribeReservedCacheNodesOfferingsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElastiCacheClient, DescribeSnapshotsRequest, DescribeSnapshotsOutcome> ElastiCacheClient::DescribeSnapshotsPaginator(const DescribeSnapshotsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElastiCacheClient, DescribeSnapshotsRequest, DescribeSnapshotsOutcome>(this, &ElastiCacheClient::DescribeSnapshots, request,
+    [](const DescribeSnapshotsRequest& current, const DescribeSnapshotsOutcome& outcome, DescribeSnapshotsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<ElastiCacheClient, AddTagsToResourceRequest, AddTagsToResourceOutcome> ElastiCacheClient::AddTagsToResourceAwaitable(AddTagsToResourceRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::AddTagsToResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, AuthorizeCacheSecurityGroupIngressRequest, AuthorizeCacheSecurityGroupIngressOutcome> ElastiCacheClient::AuthorizeCacheSecurityGroupIngressAwaitable(AuthorizeCacheSecurityGroupIngressRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::AuthorizeCacheSecurityGroupIngress, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, CopySnapshotRequest, CopySnapshotOutcome> ElastiCacheClient::CopySnapshotAwaitable(CopySnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::CopySnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, CreateCacheClusterRequest, CreateCacheClusterOutcome> ElastiCacheClient::CreateCacheClusterAwaitable(CreateCacheClusterRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::CreateCacheCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, CreateCacheParameterGroupRequest, CreateCacheParameterGroupOutcome> ElastiCacheClient::CreateCacheParameterGroupAwaitable(CreateCacheParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::CreateCacheParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, CreateCacheSecurityGroupRequest, CreateCacheSecurityGroupOutcome> ElastiCacheClient::CreateCacheSecurityGroupAwaitable(CreateCacheSecurityGroupRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::CreateCacheSecurityGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, CreateCacheSubnetGroupRequest, CreateCacheSubnetGroupOutcome> ElastiCacheClient::CreateCacheSubnetGroupAwaitable(CreateCacheSubnetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::CreateCacheSubnetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, CreateReplicationGroupRequest, CreateReplicationGroupOutcome> ElastiCacheClient::CreateReplicationGroupAwaitable(CreateReplicationGroupRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::CreateReplicationGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, CreateSnapshotRequest, CreateSnapshotOutcome> ElastiCacheClient::CreateSnapshotAwaitable(CreateSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::CreateSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DeleteCacheClusterRequest, DeleteCacheClusterOutcome> ElastiCacheClient::DeleteCacheClusterAwaitable(DeleteCacheClusterRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DeleteCacheCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DeleteCacheParameterGroupRequest, DeleteCacheParameterGroupOutcome> ElastiCacheClient::DeleteCacheParameterGroupAwaitable(DeleteCacheParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DeleteCacheParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DeleteCacheSecurityGroupRequest, DeleteCacheSecurityGroupOutcome> ElastiCacheClient::DeleteCacheSecurityGroupAwaitable(DeleteCacheSecurityGroupRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DeleteCacheSecurityGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DeleteCacheSubnetGroupRequest, DeleteCacheSubnetGroupOutcome> ElastiCacheClient::DeleteCacheSubnetGroupAwaitable(DeleteCacheSubnetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DeleteCacheSubnetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DeleteReplicationGroupRequest, DeleteReplicationGroupOutcome> ElastiCacheClient::DeleteReplicationGroupAwaitable(DeleteReplicationGroupRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DeleteReplicationGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DeleteSnapshotRequest, DeleteSnapshotOutcome> ElastiCacheClient::DeleteSnapshotAwaitable(DeleteSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DeleteSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DescribeCacheClustersRequest, DescribeCacheClustersOutcome> ElastiCacheClient::DescribeCacheClustersAwaitable(DescribeCacheClustersRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DescribeCacheClusters, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DescribeCacheEngineVersionsRequest, DescribeCacheEngineVersionsOutcome> ElastiCacheClient::DescribeCacheEngineVersionsAwaitable(DescribeCacheEngineVersionsRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DescribeCacheEngineVersions, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DescribeCacheParameterGroupsRequest, DescribeCacheParameterGroupsOutcome> ElastiCacheClient::DescribeCacheParameterGroupsAwaitable(DescribeCacheParameterGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DescribeCacheParameterGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DescribeCacheParametersRequest, DescribeCacheParametersOutcome> ElastiCacheClient::DescribeCacheParametersAwaitable(DescribeCacheParametersRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DescribeCacheParameters, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DescribeCacheSecurityGroupsRequest, DescribeCacheSecurityGroupsOutcome> ElastiCacheClient::DescribeCacheSecurityGroupsAwaitable(DescribeCacheSecurityGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DescribeCacheSecurityGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DescribeCacheSubnetGroupsRequest, DescribeCacheSubnetGroupsOutcome> ElastiCacheClient::DescribeCacheSubnetGroupsAwaitable(DescribeCacheSubnetGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DescribeCacheSubnetGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DescribeEngineDefaultParametersRequest, DescribeEngineDefaultParametersOutcome> ElastiCacheClient::DescribeEngineDefaultParametersAwaitable(DescribeEngineDefaultParametersRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DescribeEngineDefaultParameters, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DescribeEventsRequest, DescribeEventsOutcome> ElastiCacheClient::DescribeEventsAwaitable(DescribeEventsRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DescribeEvents, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DescribeReplicationGroupsRequest, DescribeReplicationGroupsOutcome> ElastiCacheClient::DescribeReplicationGroupsAwaitable(DescribeReplicationGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DescribeReplicationGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DescribeReservedCacheNodesRequest, DescribeReservedCacheNodesOutcome> ElastiCacheClient::DescribeReservedCacheNodesAwaitable(DescribeReservedCacheNodesRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DescribeReservedCacheNodes, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DescribeReservedCacheNodesOfferingsRequest, DescribeReservedCacheNodesOfferingsOutcome> ElastiCacheClient::DescribeReservedCacheNodesOfferingsAwaitable(DescribeReservedCacheNodesOfferingsRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DescribeReservedCacheNodesOfferings, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, DescribeSnapshotsRequest, DescribeSnapshotsOutcome> ElastiCacheClient::DescribeSnapshotsAwaitable(DescribeSnapshotsRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::DescribeSnapshots, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, ListAllowedNodeTypeModificationsRequest, ListAllowedNodeTypeModificationsOutcome> ElastiCacheClient::ListAllowedNodeTypeModificationsAwaitable(ListAllowedNodeTypeModificationsRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::ListAllowedNodeTypeModifications, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, ListTagsForResourceRequest, ListTagsForResourceOutcome> ElastiCacheClient::ListTagsForResourceAwaitable(ListTagsForResourceRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::ListTagsForResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, ModifyCacheClusterRequest, ModifyCacheClusterOutcome> ElastiCacheClient::ModifyCacheClusterAwaitable(ModifyCacheClusterRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::ModifyCacheCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, ModifyCacheParameterGroupRequest, ModifyCacheParameterGroupOutcome> ElastiCacheClient::ModifyCacheParameterGroupAwaitable(ModifyCacheParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::ModifyCacheParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, ModifyCacheSubnetGroupRequest, ModifyCacheSubnetGroupOutcome> ElastiCacheClient::ModifyCacheSubnetGroupAwaitable(ModifyCacheSubnetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::ModifyCacheSubnetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, ModifyReplicationGroupRequest, ModifyReplicationGroupOutcome> ElastiCacheClient::ModifyReplicationGroupAwaitable(ModifyReplicationGroupRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::ModifyReplicationGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, PurchaseReservedCacheNodesOfferingRequest, PurchaseReservedCacheNodesOfferingOutcome> ElastiCacheClient::PurchaseReservedCacheNodesOfferingAwaitable(PurchaseReservedCacheNodesOfferingRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::PurchaseReservedCacheNodesOffering, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, RebootCacheClusterRequest, RebootCacheClusterOutcome> ElastiCacheClient::RebootCacheClusterAwaitable(RebootCacheClusterRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::RebootCacheCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, RemoveTagsFromResourceRequest, RemoveTagsFromResourceOutcome> ElastiCacheClient::RemoveTagsFromResourceAwaitable(RemoveTagsFromResourceRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::RemoveTagsFromResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, ResetCacheParameterGroupRequest, ResetCacheParameterGroupOutcome> ElastiCacheClient::ResetCacheParameterGroupAwaitable(ResetCacheParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::ResetCacheParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElastiCacheClient, RevokeCacheSecurityGroupIngressRequest, RevokeCacheSecurityGroupIngressOutcome> ElastiCacheClient::RevokeCacheSecurityGroupIngressAwaitable(RevokeCacheSecurityGroupIngressRequest request) const
+{
+  return { m_executor.get(), { this, &ElastiCacheClient::RevokeCacheSecurityGroupIngress, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,21 +29,29 @@ namespace Aws
       namespace AZModeMapper
       {
 
-        static const int single_az_HASH = HashingUtils::HashString("single-az");
-        static const int cross_az_HASH = HashingUtils::HashString("cross-az");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int single_az_HASH = -1494586402;
+        static const int cross_az_HASH = 2123248870;
 
 
         AZMode GetAZModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == single_az_HASH)
+          switch (hashCode)
           {
+          case single_az_HASH:
             return AZMode::single_az;
-          }
-          else if (hashCode == cross_az_HASH)
-          {
+          case cross_az_HASH:
             return AZMode::cross_az;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/AddTagsToResourceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ AddTagsToResourceRequest::AddTagsToResourceRequest() :
 
 Aws::String AddTagsToResourceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AddTagsToResource&";
   if(m_resourceNameHasBeenSet)
   {
-    ss << "ResourceName=" << StringUtils::URLEncode(m_resourceName.c_str()) << "&";
+    ss << "ResourceName=" << StringUtils::URLEncoded(m_resourceName) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -45,6 +46,6 @@ Aws::String AddTagsToResourceRequest::SerializePayload() const
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
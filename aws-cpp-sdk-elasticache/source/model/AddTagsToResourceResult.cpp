@@ -40,7 +40,7 @@ AddTagsToResourceResult& AddTagsToResourceResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AddTagsToResourceResult")
+  if (rootNode.GetNameView() != "AddTagsToResourceResult")
   {
     resultNode = rootNode.FirstChild("AddTagsToResourceResult");
   }
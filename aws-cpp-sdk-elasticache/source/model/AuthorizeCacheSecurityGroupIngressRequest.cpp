@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/AuthorizeCacheSecurityGroupIngressRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ AuthorizeCacheSecurityGroupIngressRequest::AuthorizeCacheSecurityGroupIngressReq
 
 Aws::String AuthorizeCacheSecurityGroupIngressRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AuthorizeCacheSecurityGroupIngress&";
   if(m_cacheSecurityGroupNameHasBeenSet)
   {
-    ss << "CacheSecurityGroupName=" << StringUtils::URLEncode(m_cacheSecurityGroupName.c_str()) << "&";
+    ss << "CacheSecurityGroupName=" << StringUtils::URLEncoded(m_cacheSecurityGroupName) << "&";
   }
 
   if(m_eC2SecurityGroupNameHasBeenSet)
   {
-    ss << "EC2SecurityGroupName=" << StringUtils::URLEncode(m_eC2SecurityGroupName.c_str()) << "&";
+    ss << "EC2SecurityGroupName=" << StringUtils::URLEncoded(m_eC2SecurityGroupName) << "&";
   }
 
   if(m_eC2SecurityGroupOwnerIdHasBeenSet)
   {
-    ss << "EC2SecurityGroupOwnerId=" << StringUtils::URLEncode(m_eC2SecurityGroupOwnerId.c_str()) << "&";
+    ss << "EC2SecurityGroupOwnerId=" << StringUtils::URLEncoded(m_eC2SecurityGroupOwnerId) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ AuthorizeCacheSecurityGroupIngressResult& AuthorizeCacheSecurityGroupIngressResu
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AuthorizeCacheSecurityGroupIngressResult")
+  if (rootNode.GetNameView() != "AuthorizeCacheSecurityGroupIngressResult")
   {
     resultNode = rootNode.FirstChild("AuthorizeCacheSecurityGroupIngressResult");
   }
@@ -29,31 +29,35 @@ namespace Aws
       namespace AutomaticFailoverStatusMapper
       {
 
-        static const int enabled_HASH = HashingUtils::HashString("enabled");
-        static const int disabled_HASH = HashingUtils::HashString("disabled");
-        static const int enabling_HASH = HashingUtils::HashString("enabling");
-        static const int disabling_HASH = HashingUtils::HashString("disabling");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int enabled_HASH = -1609594047;
+        static const int disabled_HASH = 270940796;
+        static const int enabling_HASH = 1642196352;
+        static const int disabling_HASH = -190765659;
 
 
         AutomaticFailoverStatus GetAutomaticFailoverStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == enabled_HASH)
+          switch (hashCode)
           {
+          case enabled_HASH:
             return AutomaticFailoverStatus::enabled;
-          }
-          else if (hashCode == disabled_HASH)
-          {
+          case disabled_HASH:
             return AutomaticFailoverStatus::disabled;
-          }
-          else if (hashCode == enabling_HASH)
-          {
+          case enabling_HASH:
             return AutomaticFailoverStatus::enabling;
-          }
-          else if (hashCode == disabling_HASH)
-          {
+          case disabling_HASH:
             return AutomaticFailoverStatus::disabling;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -97,7 +98,7 @@ CacheCluster& CacheCluster::operator =(const XmlNode& xmlNode)
     XmlNode cacheClusterIdNode = resultNode.FirstChild("CacheClusterId");
     if(!cacheClusterIdNode.IsNull())
     {
-      m_cacheClusterId = StringUtils::Trim(cacheClusterIdNode.GetText().c_str());
+      m_cacheClusterId = cacheClusterIdNode.GetTextView().Trim().ToString();
       m_cacheClusterIdHasBeenSet = true;
     }
     XmlNode configurationEndpointNode = resultNode.FirstChild("ConfigurationEndpoint");
@@ -109,55 +110,55 @@ CacheCluster& CacheCluster::operator =(const XmlNode& xmlNode)
     XmlNode clientDownloadLandingPageNode = resultNode.FirstChild("ClientDownloadLandingPage");
     if(!clientDownloadLandingPageNode.IsNull())
     {
-      m_clientDownloadLandingPage = StringUtils::Trim(clientDownloadLandingPageNode.GetText().c_str());
+      m_clientDownloadLandingPage = clientDownloadLandingPageNode.GetTextView().Trim().ToString();
       m_clientDownloadLandingPageHasBeenSet = true;
     }
     XmlNode cacheNodeTypeNode = resultNode.FirstChild("CacheNodeType");
     if(!cacheNodeTypeNode.IsNull())
     {
-      m_cacheNodeType = StringUtils::Trim(cacheNodeTypeNode.GetText().c_str());
+      m_cacheNodeType = cacheNodeTypeNode.GetTextView().Trim().ToString();
       m_cacheNodeTypeHasBeenSet = true;
     }
     XmlNode engineNode = resultNode.FirstChild("Engine");
     if(!engineNode.IsNull())
     {
-      m_engine = StringUtils::Trim(engineNode.GetText().c_str());
+      m_engine = engineNode.GetTextView().Trim().ToString();
       m_engineHasBeenSet = true;
     }
     XmlNode engineVersionNode = resultNode.FirstChild("EngineVersion");
     if(!engineVersionNode.IsNull())
     {
-      m_engineVersion = StringUtils::Trim(engineVersionNode.GetText().c_str());
+      m_engineVersion = engineVersionNode.GetTextView().Trim().ToString();
       m_engineVersionHasBeenSet = true;
     }
     XmlNode cacheClusterStatusNode = resultNode.FirstChild("CacheClusterStatus");
     if(!cacheClusterStatusNode.IsNull())
     {
-      m_cacheClusterStatus = StringUtils::Trim(cacheClusterStatusNode.GetText().c_str());
+      m_cacheClusterStatus = cacheClusterStatusNode.GetTextView().Trim().ToString();
       m_cacheClusterStatusHasBeenSet = true;
     }
     XmlNode numCacheNodesNode = resultNode.FirstChild("NumCacheNodes");
     if(!numCacheNodesNode.IsNull())
     {
-      m_numCacheNodes = StringUtils::ConvertToInt32(StringUtils::Trim(numCacheNodesNode.GetText().c_str()).c_str());
+      m_numCacheNodes = StringUtils::ConvertToInt32(numCacheNodesNode.GetTextView().Trim().ToString().c_str());
       m_numCacheNodesHasBeenSet = true;
     }
     XmlNode preferredAvailabilityZoneNode = resultNode.FirstChild("PreferredAvailabilityZone");
     if(!preferredAvailabilityZoneNode.IsNull())
     {
-      m_preferredAvailabilityZone = StringUtils::Trim(preferredAvailabilityZoneNode.GetText().c_str());
+      m_preferredAvailabilityZone = preferredAvailabilityZoneNode.GetTextView().Trim().ToString();
       m_preferredAvailabilityZoneHasBeenSet = true;
     }
     XmlNode cacheClusterCreateTimeNode = resultNode.FirstChild("CacheClusterCreateTime");
     if(!cacheClusterCreateTimeNode.IsNull())
     {
-      m_cacheClusterCreateTime = DateTime(StringUtils::Trim(cacheClusterCreateTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_cacheClusterCreateTime = DateTime(cacheClusterCreateTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_cacheClusterCreateTimeHasBeenSet = true;
     }
     XmlNode preferredMaintenanceWindowNode = resultNode.FirstChild("PreferredMaintenanceWindow");
     if(!preferredMaintenanceWindowNode.IsNull())
     {
-      m_preferredMaintenanceWindow = StringUtils::Trim(preferredMaintenanceWindowNode.GetText().c_str());
+      m_preferredMaintenanceWindow = preferredMaintenanceWindowNode.GetTextView().Trim().ToString();
       m_preferredMaintenanceWindowHasBeenSet = true;
     }
     XmlNode pendingModifiedValuesNode = resultNode.FirstChild("PendingModifiedValues");
@@ -193,7 +194,7 @@ CacheCluster& CacheCluster::operator =(const XmlNode& xmlNode)
     XmlNode cacheSubnetGroupNameNode = resultNode.FirstChild("CacheSubnetGroupName");
     if(!cacheSubnetGroupNameNode.IsNull())
     {
-      m_cacheSubnetGroupName = StringUtils::Trim(cacheSubnetGroupNameNode.GetText().c_str());
+      m_cacheSubnetGroupName = cacheSubnetGroupNameNode.GetTextView().Trim().ToString();
       m_cacheSubnetGroupNameHasBeenSet = true;
     }
     XmlNode cacheNodesNode = resultNode.FirstChild("CacheNodes");
@@ -211,7 +212,7 @@ CacheCluster& CacheCluster::operator =(const XmlNode& xmlNode)
     XmlNode autoMinorVersionUpgradeNode = resultNode.FirstChild("AutoMinorVersionUpgrade");
     if(!autoMinorVersionUpgradeNode.IsNull())
     {
-      m_autoMinorVersionUpgrade = StringUtils::ConvertToBool(StringUtils::Trim(autoMinorVersionUpgradeNode.GetText().c_str()).c_str());
+      m_autoMinorVersionUpgrade = StringUtils::ConvertToBool(autoMinorVersionUpgradeNode.GetTextView().Trim().ToString().c_str());
       m_autoMinorVersionUpgradeHasBeenSet = true;
     }
     XmlNode securityGroupsNode = resultNode.FirstChild("SecurityGroups");
@@ -229,19 +230,19 @@ CacheCluster& CacheCluster::operator =(const XmlNode& xmlNode)
     XmlNode replicationGroupIdNode = resultNode.FirstChild("ReplicationGroupId");
     if(!replicationGroupIdNode.IsNull())
     {
-      m_replicationGroupId = StringUtils::Trim(replicationGroupIdNode.GetText().c_str());
+      m_replicationGroupId = replicationGroupIdNode.GetTextView().Trim().ToString();
       m_replicationGroupIdHasBeenSet = true;
     }
     XmlNode snapshotRetentionLimitNode = resultNode.FirstChild("SnapshotRetentionLimit");
     if(!snapshotRetentionLimitNode.IsNull())
     {
-      m_snapshotRetentionLimit = StringUtils::ConvertToInt32(StringUtils::Trim(snapshotRetentionLimitNode.GetText().c_str()).c_str());
+      m_snapshotRetentionLimit = StringUtils::ConvertToInt32(snapshotRetentionLimitNode.GetTextView().Trim().ToString().c_str());
       m_snapshotRetentionLimitHasBeenSet = true;
     }
     XmlNode snapshotWindowNode = resultNode.FirstChild("SnapshotWindow");
     if(!snapshotWindowNode.IsNull())
     {
-      m_snapshotWindow = StringUtils::Trim(snapshotWindowNode.GetText().c_str());
+      m_snapshotWindow = snapshotWindowNode.GetTextView().Trim().ToString();
       m_snapshotWindowHasBeenSet = true;
     }
   }
@@ -253,39 +254,39 @@ void CacheCluster::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_cacheClusterIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheClusterId=" << StringUtils::URLEncode(m_cacheClusterId.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheClusterId=" << StringUtils::URLEncoded(m_cacheClusterId) << "&";
   }
 
   if(m_configurationEndpointHasBeenSet)
   {
-      Aws::StringStream configurationEndpointLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream configurationEndpointLocationAndMemberSs;
       configurationEndpointLocationAndMemberSs << location << index << locationValue << ".ConfigurationEndpoint";
-      m_configurationEndpoint.OutputToStream(oStream, configurationEndpointLocationAndMemberSs.str().c_str());
+      m_configurationEndpoint.OutputToStream(oStream, configurationEndpointLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_clientDownloadLandingPageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClientDownloadLandingPage=" << StringUtils::URLEncode(m_clientDownloadLandingPage.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClientDownloadLandingPage=" << StringUtils::URLEncoded(m_clientDownloadLandingPage) << "&";
   }
 
   if(m_cacheNodeTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
 
   if(m_engineHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
 
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_cacheClusterStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheClusterStatus=" << StringUtils::URLEncode(m_cacheClusterStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheClusterStatus=" << StringUtils::URLEncoded(m_cacheClusterStatus) << "&";
   }
 
   if(m_numCacheNodesHasBeenSet)
@@ -295,31 +296,31 @@ void CacheCluster::OutputToStream(Aws::OStream& oStream, const char* location, u
 
   if(m_preferredAvailabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PreferredAvailabilityZone=" << StringUtils::URLEncode(m_preferredAvailabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".PreferredAvailabilityZone=" << StringUtils::URLEncoded(m_preferredAvailabilityZone) << "&";
   }
 
   if(m_cacheClusterCreateTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheClusterCreateTime=" << StringUtils::URLEncode(m_cacheClusterCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheClusterCreateTime=" << StringUtils::URLEncoded(m_cacheClusterCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+      oStream << location << index << locationValue << ".PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
 
   if(m_pendingModifiedValuesHasBeenSet)
   {
-      Aws::StringStream pendingModifiedValuesLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream pendingModifiedValuesLocationAndMemberSs;
       pendingModifiedValuesLocationAndMemberSs << location << index << locationValue << ".PendingModifiedValues";
-      m_pendingModifiedValues.OutputToStream(oStream, pendingModifiedValuesLocationAndMemberSs.str().c_str());
+      m_pendingModifiedValues.OutputToStream(oStream, pendingModifiedValuesLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_notificationConfigurationHasBeenSet)
   {
-      Aws::StringStream notificationConfigurationLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream notificationConfigurationLocationAndMemberSs;
       notificationConfigurationLocationAndMemberSs << location << index << locationValue << ".NotificationConfiguration";
-      m_notificationConfiguration.OutputToStream(oStream, notificationConfigurationLocationAndMemberSs.str().c_str());
+      m_notificationConfiguration.OutputToStream(oStream, notificationConfigurationLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_cacheSecurityGroupsHasBeenSet)
@@ -327,22 +328,22 @@ void CacheCluster::OutputToStream(Aws::OStream& oStream, const char* location, u
       unsigned cacheSecurityGroupsIdx = 1;
       for(auto& item : m_cacheSecurityGroups)
       {
-        Aws::StringStream cacheSecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream cacheSecurityGroupsSs;
         cacheSecurityGroupsSs << location << index << locationValue << ".CacheSecurityGroup." << cacheSecurityGroupsIdx++;
-        item.OutputToStream(oStream, cacheSecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, cacheSecurityGroupsSs.GetString().c_str());
       }
   }
 
   if(m_cacheParameterGroupHasBeenSet)
   {
-      Aws::StringStream cacheParameterGroupLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream cacheParameterGroupLocationAndMemberSs;
       cacheParameterGroupLocationAndMemberSs << location << index << locationValue << ".CacheParameterGroup";
-      m_cacheParameterGroup.OutputToStream(oStream, cacheParameterGroupLocationAndMemberSs.str().c_str());
+      m_cacheParameterGroup.OutputToStream(oStream, cacheParameterGroupLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_cacheSubnetGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheSubnetGroupName=" << StringUtils::URLEncode(m_cacheSubnetGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheSubnetGroupName=" << StringUtils::URLEncoded(m_cacheSubnetGroupName) << "&";
   }
 
   if(m_cacheNodesHasBeenSet)
@@ -350,9 +351,9 @@ void CacheCluster::OutputToStream(Aws::OStream& oStream, const char* location, u
       unsigned cacheNodesIdx = 1;
       for(auto& item : m_cacheNodes)
       {
-        Aws::StringStream cacheNodesSs;
+        Aws::Utils::Stream::StringOutputStream cacheNodesSs;
         cacheNodesSs << location << index << locationValue << ".CacheNode." << cacheNodesIdx++;
-        item.OutputToStream(oStream, cacheNodesSs.str().c_str());
+        item.OutputToStream(oStream, cacheNodesSs.GetString().c_str());
       }
   }
 
@@ -366,15 +367,15 @@ void CacheCluster::OutputToStream(Aws::OStream& oStream, const char* location, u
       unsigned securityGroupsIdx = 1;
       for(auto& item : m_securityGroups)
       {
-        Aws::StringStream securityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream securityGroupsSs;
         securityGroupsSs << location << index << locationValue << ".SecurityGroups.member." << securityGroupsIdx++;
-        item.OutputToStream(oStream, securityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, securityGroupsSs.GetString().c_str());
       }
   }
 
   if(m_replicationGroupIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReplicationGroupId=" << StringUtils::URLEncode(m_replicationGroupId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReplicationGroupId=" << StringUtils::URLEncoded(m_replicationGroupId) << "&";
   }
 
   if(m_snapshotRetentionLimitHasBeenSet)
@@ -384,7 +385,7 @@ void CacheCluster::OutputToStream(Aws::OStream& oStream, const char* location, u
 
   if(m_snapshotWindowHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotWindow=" << StringUtils::URLEncode(m_snapshotWindow.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotWindow=" << StringUtils::URLEncoded(m_snapshotWindow) << "&";
   }
 
 }
@@ -393,7 +394,7 @@ void CacheCluster::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_cacheClusterIdHasBeenSet)
   {
-      oStream << location << ".CacheClusterId=" << StringUtils::URLEncode(m_cacheClusterId.c_str()) << "&";
+      oStream << location << ".CacheClusterId=" << StringUtils::URLEncoded(m_cacheClusterId) << "&";
   }
   if(m_configurationEndpointHasBeenSet)
   {
@@ -403,23 +404,23 @@ void CacheCluster::OutputToStream(Aws::OStream& oStream, const char* location) c
   }
   if(m_clientDownloadLandingPageHasBeenSet)
   {
-      oStream << location << ".ClientDownloadLandingPage=" << StringUtils::URLEncode(m_clientDownloadLandingPage.c_str()) << "&";
+      oStream << location << ".ClientDownloadLandingPage=" << StringUtils::URLEncoded(m_clientDownloadLandingPage) << "&";
   }
   if(m_cacheNodeTypeHasBeenSet)
   {
-      oStream << location << ".CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+      oStream << location << ".CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
   if(m_engineHasBeenSet)
   {
-      oStream << location << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
   if(m_cacheClusterStatusHasBeenSet)
   {
-      oStream << location << ".CacheClusterStatus=" << StringUtils::URLEncode(m_cacheClusterStatus.c_str()) << "&";
+      oStream << location << ".CacheClusterStatus=" << StringUtils::URLEncoded(m_cacheClusterStatus) << "&";
   }
   if(m_numCacheNodesHasBeenSet)
   {
@@ -427,15 +428,15 @@ void CacheCluster::OutputToStream(Aws::OStream& oStream, const char* location) c
   }
   if(m_preferredAvailabilityZoneHasBeenSet)
   {
-      oStream << location << ".PreferredAvailabilityZone=" << StringUtils::URLEncode(m_preferredAvailabilityZone.c_str()) << "&";
+      oStream << location << ".PreferredAvailabilityZone=" << StringUtils::URLEncoded(m_preferredAvailabilityZone) << "&";
   }
   if(m_cacheClusterCreateTimeHasBeenSet)
   {
-      oStream << location << ".CacheClusterCreateTime=" << StringUtils::URLEncode(m_cacheClusterCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CacheClusterCreateTime=" << StringUtils::URLEncoded(m_cacheClusterCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-      oStream << location << ".PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+      oStream << location << ".PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
   if(m_pendingModifiedValuesHasBeenSet)
   {
@@ -454,9 +455,9 @@ void CacheCluster::OutputToStream(Aws::OStream& oStream, const char* location) c
       unsigned cacheSecurityGroupsIdx = 1;
       for(auto& item : m_cacheSecurityGroups)
       {
-        Aws::StringStream cacheSecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream cacheSecurityGroupsSs;
         cacheSecurityGroupsSs << location <<  ".CacheSecurityGroup." << cacheSecurityGroupsIdx++;
-        item.OutputToStream(oStream, cacheSecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, cacheSecurityGroupsSs.GetString().c_str());
       }
   }
   if(m_cacheParameterGroupHasBeenSet)
@@ -467,16 +468,16 @@ void CacheCluster::OutputToStream(Aws::OStream& oStream, const char* location) c
   }
   if(m_cacheSubnetGroupNameHasBeenSet)
   {
-      oStream << location << ".CacheSubnetGroupName=" << StringUtils::URLEncode(m_cacheSubnetGroupName.c_str()) << "&";
+      oStream << location << ".CacheSubnetGroupName=" << StringUtils::URLEncoded(m_cacheSubnetGroupName) << "&";
   }
   if(m_cacheNodesHasBeenSet)
   {
       unsigned cacheNodesIdx = 1;
       for(auto& item : m_cacheNodes)
       {
-        Aws::StringStream cacheNodesSs;
+        Aws::Utils::Stream::StringOutputStream cacheNodesSs;
         cacheNodesSs << location <<  ".CacheNode." << cacheNodesIdx++;
-        item.OutputToStream(oStream, cacheNodesSs.str().c_str());
+        item.OutputToStream(oStream, cacheNodesSs.GetString().c_str());
       }
   }
   if(m_autoMinorVersionUpgradeHasBeenSet)
@@ -488,14 +489,14 @@ void CacheCluster::OutputToStream(Aws::OStream& oStream, const char* location) c
       unsigned securityGroupsIdx = 1;
       for(auto& item : m_securityGroups)
       {
-        Aws::StringStream securityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream securityGroupsSs;
         securityGroupsSs << location <<  ".SecurityGroups.member." << securityGroupsIdx++;
-        item.OutputToStream(oStream, securityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, securityGroupsSs.GetString().c_str());
       }
   }
   if(m_replicationGroupIdHasBeenSet)
   {
-      oStream << location << ".ReplicationGroupId=" << StringUtils::URLEncode(m_replicationGroupId.c_str()) << "&";
+      oStream << location << ".ReplicationGroupId=" << StringUtils::URLEncoded(m_replicationGroupId) << "&";
   }
   if(m_snapshotRetentionLimitHasBeenSet)
   {
@@ -503,7 +504,7 @@ void CacheCluster::OutputToStream(Aws::OStream& oStream, const char* location) c
   }
   if(m_snapshotWindowHasBeenSet)
   {
-      oStream << location << ".SnapshotWindow=" << StringUtils::URLEncode(m_snapshotWindow.c_str()) << "&";
+      oStream << location << ".SnapshotWindow=" << StringUtils::URLEncoded(m_snapshotWindow) << "&";
   }
 }
 
@@ -57,31 +57,31 @@ CacheEngineVersion& CacheEngineVersion::operator =(const XmlNode& xmlNode)
     XmlNode engineNode = resultNode.FirstChild("Engine");
     if(!engineNode.IsNull())
     {
-      m_engine = StringUtils::Trim(engineNode.GetText().c_str());
+      m_engine = engineNode.GetTextView().Trim().ToString();
       m_engineHasBeenSet = true;
     }
     XmlNode engineVersionNode = resultNode.FirstChild("EngineVersion");
     if(!engineVersionNode.IsNull())
     {
-      m_engineVersion = StringUtils::Trim(engineVersionNode.GetText().c_str());
+      m_engineVersion = engineVersionNode.GetTextView().Trim().ToString();
       m_engineVersionHasBeenSet = true;
     }
     XmlNode cacheParameterGroupFamilyNode = resultNode.FirstChild("CacheParameterGroupFamily");
     if(!cacheParameterGroupFamilyNode.IsNull())
     {
-      m_cacheParameterGroupFamily = StringUtils::Trim(cacheParameterGroupFamilyNode.GetText().c_str());
+      m_cacheParameterGroupFamily = cacheParameterGroupFamilyNode.GetTextView().Trim().ToString();
       m_cacheParameterGroupFamilyHasBeenSet = true;
     }
     XmlNode cacheEngineDescriptionNode = resultNode.FirstChild("CacheEngineDescription");
     if(!cacheEngineDescriptionNode.IsNull())
     {
-      m_cacheEngineDescription = StringUtils::Trim(cacheEngineDescriptionNode.GetText().c_str());
+      m_cacheEngineDescription = cacheEngineDescriptionNode.GetTextView().Trim().ToString();
       m_cacheEngineDescriptionHasBeenSet = true;
     }
     XmlNode cacheEngineVersionDescriptionNode = resultNode.FirstChild("CacheEngineVersionDescription");
     if(!cacheEngineVersionDescriptionNode.IsNull())
     {
-      m_cacheEngineVersionDescription = StringUtils::Trim(cacheEngineVersionDescriptionNode.GetText().c_str());
+      m_cacheEngineVersionDescription = cacheEngineVersionDescriptionNode.GetTextView().Trim().ToString();
       m_cacheEngineVersionDescriptionHasBeenSet = true;
     }
   }
@@ -93,27 +93,27 @@ void CacheEngineVersion::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_engineHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
 
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_cacheParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheParameterGroupFamily=" << StringUtils::URLEncode(m_cacheParameterGroupFamily.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheParameterGroupFamily=" << StringUtils::URLEncoded(m_cacheParameterGroupFamily) << "&";
   }
 
   if(m_cacheEngineDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheEngineDescription=" << StringUtils::URLEncode(m_cacheEngineDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheEngineDescription=" << StringUtils::URLEncoded(m_cacheEngineDescription) << "&";
   }
 
   if(m_cacheEngineVersionDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheEngineVersionDescription=" << StringUtils::URLEncode(m_cacheEngineVersionDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheEngineVersionDescription=" << StringUtils::URLEncoded(m_cacheEngineVersionDescription) << "&";
   }
 
 }
@@ -122,23 +122,23 @@ void CacheEngineVersion::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_engineHasBeenSet)
   {
-      oStream << location << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
   if(m_cacheParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << ".CacheParameterGroupFamily=" << StringUtils::URLEncode(m_cacheParameterGroupFamily.c_str()) << "&";
+      oStream << location << ".CacheParameterGroupFamily=" << StringUtils::URLEncoded(m_cacheParameterGroupFamily) << "&";
   }
   if(m_cacheEngineDescriptionHasBeenSet)
   {
-      oStream << location << ".CacheEngineDescription=" << StringUtils::URLEncode(m_cacheEngineDescription.c_str()) << "&";
+      oStream << location << ".CacheEngineDescription=" << StringUtils::URLEncoded(m_cacheEngineDescription) << "&";
   }
   if(m_cacheEngineVersionDescriptionHasBeenSet)
   {
-      oStream << location << ".CacheEngineVersionDescription=" << StringUtils::URLEncode(m_cacheEngineVersionDescription.c_str()) << "&";
+      oStream << location << ".CacheEngineVersionDescription=" << StringUtils::URLEncoded(m_cacheEngineVersionDescription) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,19 +62,19 @@ CacheNode& CacheNode::operator =(const XmlNode& xmlNode)
     XmlNode cacheNodeIdNode = resultNode.FirstChild("CacheNodeId");
     if(!cacheNodeIdNode.IsNull())
     {
-      m_cacheNodeId = StringUtils::Trim(cacheNodeIdNode.GetText().c_str());
+      m_cacheNodeId = cacheNodeIdNode.GetTextView().Trim().ToString();
       m_cacheNodeIdHasBeenSet = true;
     }
     XmlNode cacheNodeStatusNode = resultNode.FirstChild("CacheNodeStatus");
     if(!cacheNodeStatusNode.IsNull())
     {
-      m_cacheNodeStatus = StringUtils::Trim(cacheNodeStatusNode.GetText().c_str());
+      m_cacheNodeStatus = cacheNodeStatusNode.GetTextView().Trim().ToString();
       m_cacheNodeStatusHasBeenSet = true;
     }
     XmlNode cacheNodeCreateTimeNode = resultNode.FirstChild("CacheNodeCreateTime");
     if(!cacheNodeCreateTimeNode.IsNull())
     {
-      m_cacheNodeCreateTime = DateTime(StringUtils::Trim(cacheNodeCreateTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_cacheNodeCreateTime = DateTime(cacheNodeCreateTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_cacheNodeCreateTimeHasBeenSet = true;
     }
     XmlNode endpointNode = resultNode.FirstChild("Endpoint");
@@ -85,19 +86,19 @@ CacheNode& CacheNode::operator =(const XmlNode& xmlNode)
     XmlNode parameterGroupStatusNode = resultNode.FirstChild("ParameterGroupStatus");
     if(!parameterGroupStatusNode.IsNull())
     {
-      m_parameterGroupStatus = StringUtils::Trim(parameterGroupStatusNode.GetText().c_str());
+      m_parameterGroupStatus = parameterGroupStatusNode.GetTextView().Trim().ToString();
       m_parameterGroupStatusHasBeenSet = true;
     }
     XmlNode sourceCacheNodeIdNode = resultNode.FirstChild("SourceCacheNodeId");
     if(!sourceCacheNodeIdNode.IsNull())
     {
-      m_sourceCacheNodeId = StringUtils::Trim(sourceCacheNodeIdNode.GetText().c_str());
+      m_sourceCacheNodeId = sourceCacheNodeIdNode.GetTextView().Trim().ToString();
       m_sourceCacheNodeIdHasBeenSet = true;
     }
     XmlNode customerAvailabilityZoneNode = resultNode.FirstChild("CustomerAvailabilityZone");
     if(!customerAvailabilityZoneNode.IsNull())
     {
-      m_customerAvailabilityZone = StringUtils::Trim(customerAvailabilityZoneNode.GetText().c_str());
+      m_customerAvailabilityZone = customerAvailabilityZoneNode.GetTextView().Trim().ToString();
       m_customerAvailabilityZoneHasBeenSet = true;
     }
   }
@@ -109,39 +110,39 @@ void CacheNode::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 {
   if(m_cacheNodeIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheNodeId=" << StringUtils::URLEncode(m_cacheNodeId.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheNodeId=" << StringUtils::URLEncoded(m_cacheNodeId) << "&";
   }
 
   if(m_cacheNodeStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheNodeStatus=" << StringUtils::URLEncode(m_cacheNodeStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheNodeStatus=" << StringUtils::URLEncoded(m_cacheNodeStatus) << "&";
   }
 
   if(m_cacheNodeCreateTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheNodeCreateTime=" << StringUtils::URLEncode(m_cacheNodeCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheNodeCreateTime=" << StringUtils::URLEncoded(m_cacheNodeCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_endpointHasBeenSet)
   {
-      Aws::StringStream endpointLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream endpointLocationAndMemberSs;
       endpointLocationAndMemberSs << location << index << locationValue << ".Endpoint";
-      m_endpoint.OutputToStream(oStream, endpointLocationAndMemberSs.str().c_str());
+      m_endpoint.OutputToStream(oStream, endpointLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_parameterGroupStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterGroupStatus=" << StringUtils::URLEncode(m_parameterGroupStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterGroupStatus=" << StringUtils::URLEncoded(m_parameterGroupStatus) << "&";
   }
 
   if(m_sourceCacheNodeIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceCacheNodeId=" << StringUtils::URLEncode(m_sourceCacheNodeId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceCacheNodeId=" << StringUtils::URLEncoded(m_sourceCacheNodeId) << "&";
   }
 
   if(m_customerAvailabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CustomerAvailabilityZone=" << StringUtils::URLEncode(m_customerAvailabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".CustomerAvailabilityZone=" << StringUtils::URLEncoded(m_customerAvailabilityZone) << "&";
   }
 
 }
@@ -150,15 +151,15 @@ void CacheNode::OutputToStream(Aws::OStream& oStream, const char* location) cons
 {
   if(m_cacheNodeIdHasBeenSet)
   {
-      oStream << location << ".CacheNodeId=" << StringUtils::URLEncode(m_cacheNodeId.c_str()) << "&";
+      oStream << location << ".CacheNodeId=" << StringUtils::URLEncoded(m_cacheNodeId) << "&";
   }
   if(m_cacheNodeStatusHasBeenSet)
   {
-      oStream << location << ".CacheNodeStatus=" << StringUtils::URLEncode(m_cacheNodeStatus.c_str()) << "&";
+      oStream << location << ".CacheNodeStatus=" << StringUtils::URLEncoded(m_cacheNodeStatus) << "&";
   }
   if(m_cacheNodeCreateTimeHasBeenSet)
   {
-      oStream << location << ".CacheNodeCreateTime=" << StringUtils::URLEncode(m_cacheNodeCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CacheNodeCreateTime=" << StringUtils::URLEncoded(m_cacheNodeCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_endpointHasBeenSet)
   {
@@ -168,15 +169,15 @@ void CacheNode::OutputToStream(Aws::OStream& oStream, const char* location) cons
   }
   if(m_parameterGroupStatusHasBeenSet)
   {
-      oStream << location << ".ParameterGroupStatus=" << StringUtils::URLEncode(m_parameterGroupStatus.c_str()) << "&";
+      oStream << location << ".ParameterGroupStatus=" << StringUtils::URLEncoded(m_parameterGroupStatus) << "&";
   }
   if(m_sourceCacheNodeIdHasBeenSet)
   {
-      oStream << location << ".SourceCacheNodeId=" << StringUtils::URLEncode(m_sourceCacheNodeId.c_str()) << "&";
+      oStream << location << ".SourceCacheNodeId=" << StringUtils::URLEncoded(m_sourceCacheNodeId) << "&";
   }
   if(m_customerAvailabilityZoneHasBeenSet)
   {
-      oStream << location << ".CustomerAvailabilityZone=" << StringUtils::URLEncode(m_customerAvailabilityZone.c_str()) << "&";
+      oStream << location << ".CustomerAvailabilityZone=" << StringUtils::URLEncoded(m_customerAvailabilityZone) << "&";
   }
 }
 
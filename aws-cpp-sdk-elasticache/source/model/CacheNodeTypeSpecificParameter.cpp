@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -67,43 +68,43 @@ CacheNodeTypeSpecificParameter& CacheNodeTypeSpecificParameter::operator =(const
     XmlNode parameterNameNode = resultNode.FirstChild("ParameterName");
     if(!parameterNameNode.IsNull())
     {
-      m_parameterName = StringUtils::Trim(parameterNameNode.GetText().c_str());
+      m_parameterName = parameterNameNode.GetTextView().Trim().ToString();
       m_parameterNameHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode sourceNode = resultNode.FirstChild("Source");
     if(!sourceNode.IsNull())
     {
-      m_source = StringUtils::Trim(sourceNode.GetText().c_str());
+      m_source = sourceNode.GetTextView().Trim().ToString();
       m_sourceHasBeenSet = true;
     }
     XmlNode dataTypeNode = resultNode.FirstChild("DataType");
     if(!dataTypeNode.IsNull())
     {
-      m_dataType = StringUtils::Trim(dataTypeNode.GetText().c_str());
+      m_dataType = dataTypeNode.GetTextView().Trim().ToString();
       m_dataTypeHasBeenSet = true;
     }
     XmlNode allowedValuesNode = resultNode.FirstChild("AllowedValues");
     if(!allowedValuesNode.IsNull())
     {
-      m_allowedValues = StringUtils::Trim(allowedValuesNode.GetText().c_str());
+      m_allowedValues = allowedValuesNode.GetTextView().Trim().ToString();
       m_allowedValuesHasBeenSet = true;
     }
     XmlNode isModifiableNode = resultNode.FirstChild("IsModifiable");
     if(!isModifiableNode.IsNull())
     {
-      m_isModifiable = StringUtils::ConvertToBool(StringUtils::Trim(isModifiableNode.GetText().c_str()).c_str());
+      m_isModifiable = StringUtils::ConvertToBool(isModifiableNode.GetTextView().Trim().ToString().c_str());
       m_isModifiableHasBeenSet = true;
     }
     XmlNode minimumEngineVersionNode = resultNode.FirstChild("MinimumEngineVersion");
     if(!minimumEngineVersionNode.IsNull())
     {
-      m_minimumEngineVersion = StringUtils::Trim(minimumEngineVersionNode.GetText().c_str());
+      m_minimumEngineVersion = minimumEngineVersionNode.GetTextView().Trim().ToString();
       m_minimumEngineVersionHasBeenSet = true;
     }
     XmlNode cacheNodeTypeSpecificValuesNode = resultNode.FirstChild("CacheNodeTypeSpecificValues");
@@ -121,7 +122,7 @@ CacheNodeTypeSpecificParameter& CacheNodeTypeSpecificParameter::operator =(const
     XmlNode changeTypeNode = resultNode.FirstChild("ChangeType");
     if(!changeTypeNode.IsNull())
     {
-      m_changeType = ChangeTypeMapper::GetChangeTypeForName(StringUtils::Trim(changeTypeNode.GetText().c_str()).c_str());
+      m_changeType = ChangeTypeMapper::GetChangeTypeForName(changeTypeNode.GetTextView().Trim().ToString().c_str());
       m_changeTypeHasBeenSet = true;
     }
   }
@@ -133,27 +134,27 @@ void CacheNodeTypeSpecificParameter::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_parameterNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterName=" << StringUtils::URLEncode(m_parameterName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterName=" << StringUtils::URLEncoded(m_parameterName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_sourceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Source=" << StringUtils::URLEncode(m_source.c_str()) << "&";
+      oStream << location << index << locationValue << ".Source=" << StringUtils::URLEncoded(m_source) << "&";
   }
 
   if(m_dataTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DataType=" << StringUtils::URLEncode(m_dataType.c_str()) << "&";
+      oStream << location << index << locationValue << ".DataType=" << StringUtils::URLEncoded(m_dataType) << "&";
   }
 
   if(m_allowedValuesHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AllowedValues=" << StringUtils::URLEncode(m_allowedValues.c_str()) << "&";
+      oStream << location << index << locationValue << ".AllowedValues=" << StringUtils::URLEncoded(m_allowedValues) << "&";
   }
 
   if(m_isModifiableHasBeenSet)
@@ -163,7 +164,7 @@ void CacheNodeTypeSpecificParameter::OutputToStream(Aws::OStream& oStream, const
 
   if(m_minimumEngineVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MinimumEngineVersion=" << StringUtils::URLEncode(m_minimumEngineVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".MinimumEngineVersion=" << StringUtils::URLEncoded(m_minimumEngineVersion) << "&";
   }
 
   if(m_cacheNodeTypeSpecificValuesHasBeenSet)
@@ -171,9 +172,9 @@ void CacheNodeTypeSpecificParameter::OutputToStream(Aws::OStream& oStream, const
       unsigned cacheNodeTypeSpecificValuesIdx = 1;
       for(auto& item : m_cacheNodeTypeSpecificValues)
       {
-        Aws::StringStream cacheNodeTypeSpecificValuesSs;
+        Aws::Utils::Stream::StringOutputStream cacheNodeTypeSpecificValuesSs;
         cacheNodeTypeSpecificValuesSs << location << index << locationValue << ".CacheNodeTypeSpecificValue." << cacheNodeTypeSpecificValuesIdx++;
-        item.OutputToStream(oStream, cacheNodeTypeSpecificValuesSs.str().c_str());
+        item.OutputToStream(oStream, cacheNodeTypeSpecificValuesSs.GetString().c_str());
       }
   }
 
@@ -188,23 +189,23 @@ void CacheNodeTypeSpecificParameter::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_parameterNameHasBeenSet)
   {
-      oStream << location << ".ParameterName=" << StringUtils::URLEncode(m_parameterName.c_str()) << "&";
+      oStream << location << ".ParameterName=" << StringUtils::URLEncoded(m_parameterName) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_sourceHasBeenSet)
   {
-      oStream << location << ".Source=" << StringUtils::URLEncode(m_source.c_str()) << "&";
+      oStream << location << ".Source=" << StringUtils::URLEncoded(m_source) << "&";
   }
   if(m_dataTypeHasBeenSet)
   {
-      oStream << location << ".DataType=" << StringUtils::URLEncode(m_dataType.c_str()) << "&";
+      oStream << location << ".DataType=" << StringUtils::URLEncoded(m_dataType) << "&";
   }
   if(m_allowedValuesHasBeenSet)
   {
-      oStream << location << ".AllowedValues=" << StringUtils::URLEncode(m_allowedValues.c_str()) << "&";
+      oStream << location << ".AllowedValues=" << StringUtils::URLEncoded(m_allowedValues) << "&";
   }
   if(m_isModifiableHasBeenSet)
   {
@@ -212,16 +213,16 @@ void CacheNodeTypeSpecificParameter::OutputToStream(Aws::OStream& oStream, const
   }
   if(m_minimumEngineVersionHasBeenSet)
   {
-      oStream << location << ".MinimumEngineVersion=" << StringUtils::URLEncode(m_minimumEngineVersion.c_str()) << "&";
+      oStream << location << ".MinimumEngineVersion=" << StringUtils::URLEncoded(m_minimumEngineVersion) << "&";
   }
   if(m_cacheNodeTypeSpecificValuesHasBeenSet)
   {
       unsigned cacheNodeTypeSpecificValuesIdx = 1;
       for(auto& item : m_cacheNodeTypeSpecificValues)
       {
-        Aws::StringStream cacheNodeTypeSpecificValuesSs;
+        Aws::Utils::Stream::StringOutputStream cacheNodeTypeSpecificValuesSs;
         cacheNodeTypeSpecificValuesSs << location <<  ".CacheNodeTypeSpecificValue." << cacheNodeTypeSpecificValuesIdx++;
-        item.OutputToStream(oStream, cacheNodeTypeSpecificValuesSs.str().c_str());
+        item.OutputToStream(oStream, cacheNodeTypeSpecificValuesSs.GetString().c_str());
       }
   }
   if(m_changeTypeHasBeenSet)
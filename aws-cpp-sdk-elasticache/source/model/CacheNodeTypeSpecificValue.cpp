@@ -51,13 +51,13 @@ CacheNodeTypeSpecificValue& CacheNodeTypeSpecificValue::operator =(const XmlNode
     XmlNode cacheNodeTypeNode = resultNode.FirstChild("CacheNodeType");
     if(!cacheNodeTypeNode.IsNull())
     {
-      m_cacheNodeType = StringUtils::Trim(cacheNodeTypeNode.GetText().c_str());
+      m_cacheNodeType = cacheNodeTypeNode.GetTextView().Trim().ToString();
       m_cacheNodeTypeHasBeenSet = true;
     }
     XmlNode valueNode = resultNode.FirstChild("Value");
     if(!valueNode.IsNull())
     {
-      m_value = StringUtils::Trim(valueNode.GetText().c_str());
+      m_value = valueNode.GetTextView().Trim().ToString();
       m_valueHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void CacheNodeTypeSpecificValue::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_cacheNodeTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
 
   if(m_valueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void CacheNodeTypeSpecificValue::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_cacheNodeTypeHasBeenSet)
   {
-      oStream << location << ".CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+      oStream << location << ".CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
   if(m_valueHasBeenSet)
   {
-      oStream << location << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 }
 
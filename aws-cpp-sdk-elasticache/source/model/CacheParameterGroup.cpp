@@ -53,19 +53,19 @@ CacheParameterGroup& CacheParameterGroup::operator =(const XmlNode& xmlNode)
     XmlNode cacheParameterGroupNameNode = resultNode.FirstChild("CacheParameterGroupName");
     if(!cacheParameterGroupNameNode.IsNull())
     {
-      m_cacheParameterGroupName = StringUtils::Trim(cacheParameterGroupNameNode.GetText().c_str());
+      m_cacheParameterGroupName = cacheParameterGroupNameNode.GetTextView().Trim().ToString();
       m_cacheParameterGroupNameHasBeenSet = true;
     }
     XmlNode cacheParameterGroupFamilyNode = resultNode.FirstChild("CacheParameterGroupFamily");
     if(!cacheParameterGroupFamilyNode.IsNull())
     {
-      m_cacheParameterGroupFamily = StringUtils::Trim(cacheParameterGroupFamilyNode.GetText().c_str());
+      m_cacheParameterGroupFamily = cacheParameterGroupFamilyNode.GetTextView().Trim().ToString();
       m_cacheParameterGroupFamilyHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void CacheParameterGroup::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_cacheParameterGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheParameterGroupName=" << StringUtils::URLEncode(m_cacheParameterGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheParameterGroupName=" << StringUtils::URLEncoded(m_cacheParameterGroupName) << "&";
   }
 
   if(m_cacheParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheParameterGroupFamily=" << StringUtils::URLEncode(m_cacheParameterGroupFamily.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheParameterGroupFamily=" << StringUtils::URLEncoded(m_cacheParameterGroupFamily) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void CacheParameterGroup::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_cacheParameterGroupNameHasBeenSet)
   {
-      oStream << location << ".CacheParameterGroupName=" << StringUtils::URLEncode(m_cacheParameterGroupName.c_str()) << "&";
+      oStream << location << ".CacheParameterGroupName=" << StringUtils::URLEncoded(m_cacheParameterGroupName) << "&";
   }
   if(m_cacheParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << ".CacheParameterGroupFamily=" << StringUtils::URLEncode(m_cacheParameterGroupFamily.c_str()) << "&";
+      oStream << location << ".CacheParameterGroupFamily=" << StringUtils::URLEncoded(m_cacheParameterGroupFamily) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 }
 
@@ -53,13 +53,13 @@ CacheParameterGroupStatus& CacheParameterGroupStatus::operator =(const XmlNode&
     XmlNode cacheParameterGroupNameNode = resultNode.FirstChild("CacheParameterGroupName");
     if(!cacheParameterGroupNameNode.IsNull())
     {
-      m_cacheParameterGroupName = StringUtils::Trim(cacheParameterGroupNameNode.GetText().c_str());
+      m_cacheParameterGroupName = cacheParameterGroupNameNode.GetTextView().Trim().ToString();
       m_cacheParameterGroupNameHasBeenSet = true;
     }
     XmlNode parameterApplyStatusNode = resultNode.FirstChild("ParameterApplyStatus");
     if(!parameterApplyStatusNode.IsNull())
     {
-      m_parameterApplyStatus = StringUtils::Trim(parameterApplyStatusNode.GetText().c_str());
+      m_parameterApplyStatus = parameterApplyStatusNode.GetTextView().Trim().ToString();
       m_parameterApplyStatusHasBeenSet = true;
     }
     XmlNode cacheNodeIdsToRebootNode = resultNode.FirstChild("CacheNodeIdsToReboot");
@@ -68,7 +68,7 @@ CacheParameterGroupStatus& CacheParameterGroupStatus::operator =(const XmlNode&
       XmlNode cacheNodeIdsToRebootMember = cacheNodeIdsToRebootNode.FirstChild("CacheNodeId");
       while(!cacheNodeIdsToRebootMember.IsNull())
       {
-        m_cacheNodeIdsToReboot.push_back(StringUtils::Trim(cacheNodeIdsToRebootMember.GetText().c_str()));
+        m_cacheNodeIdsToReboot.push_back(cacheNodeIdsToRebootMember.GetTextView().Trim().ToString());
         cacheNodeIdsToRebootMember = cacheNodeIdsToRebootMember.NextNode("CacheNodeId");
       }
 
@@ -83,12 +83,12 @@ void CacheParameterGroupStatus::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_cacheParameterGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheParameterGroupName=" << StringUtils::URLEncode(m_cacheParameterGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheParameterGroupName=" << StringUtils::URLEncoded(m_cacheParameterGroupName) << "&";
   }
 
   if(m_parameterApplyStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterApplyStatus=" << StringUtils::URLEncode(m_parameterApplyStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterApplyStatus=" << StringUtils::URLEncoded(m_parameterApplyStatus) << "&";
   }
 
   if(m_cacheNodeIdsToRebootHasBeenSet)
@@ -96,7 +96,7 @@ void CacheParameterGroupStatus::OutputToStream(Aws::OStream& oStream, const char
       unsigned cacheNodeIdsToRebootIdx = 1;
       for(auto& item : m_cacheNodeIdsToReboot)
       {
-        oStream << location << index << locationValue << ".CacheNodeId." << cacheNodeIdsToRebootIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".CacheNodeId." << cacheNodeIdsToRebootIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -106,18 +106,18 @@ void CacheParameterGroupStatus::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_cacheParameterGroupNameHasBeenSet)
   {
-      oStream << location << ".CacheParameterGroupName=" << StringUtils::URLEncode(m_cacheParameterGroupName.c_str()) << "&";
+      oStream << location << ".CacheParameterGroupName=" << StringUtils::URLEncoded(m_cacheParameterGroupName) << "&";
   }
   if(m_parameterApplyStatusHasBeenSet)
   {
-      oStream << location << ".ParameterApplyStatus=" << StringUtils::URLEncode(m_parameterApplyStatus.c_str()) << "&";
+      oStream << location << ".ParameterApplyStatus=" << StringUtils::URLEncoded(m_parameterApplyStatus) << "&";
   }
   if(m_cacheNodeIdsToRebootHasBeenSet)
   {
       unsigned cacheNodeIdsToRebootIdx = 1;
       for(auto& item : m_cacheNodeIdsToReboot)
       {
-        oStream << location << ".CacheNodeId." << cacheNodeIdsToRebootIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".CacheNodeId." << cacheNodeIdsToRebootIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -55,19 +56,19 @@ CacheSecurityGroup& CacheSecurityGroup::operator =(const XmlNode& xmlNode)
     XmlNode ownerIdNode = resultNode.FirstChild("OwnerId");
     if(!ownerIdNode.IsNull())
     {
-      m_ownerId = StringUtils::Trim(ownerIdNode.GetText().c_str());
+      m_ownerId = ownerIdNode.GetTextView().Trim().ToString();
       m_ownerIdHasBeenSet = true;
     }
     XmlNode cacheSecurityGroupNameNode = resultNode.FirstChild("CacheSecurityGroupName");
     if(!cacheSecurityGroupNameNode.IsNull())
     {
-      m_cacheSecurityGroupName = StringUtils::Trim(cacheSecurityGroupNameNode.GetText().c_str());
+      m_cacheSecurityGroupName = cacheSecurityGroupNameNode.GetTextView().Trim().ToString();
       m_cacheSecurityGroupNameHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode eC2SecurityGroupsNode = resultNode.FirstChild("EC2SecurityGroups");
@@ -91,17 +92,17 @@ void CacheSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_ownerIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OwnerId=" << StringUtils::URLEncode(m_ownerId.c_str()) << "&";
+      oStream << location << index << locationValue << ".OwnerId=" << StringUtils::URLEncoded(m_ownerId) << "&";
   }
 
   if(m_cacheSecurityGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheSecurityGroupName=" << StringUtils::URLEncode(m_cacheSecurityGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheSecurityGroupName=" << StringUtils::URLEncoded(m_cacheSecurityGroupName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_eC2SecurityGroupsHasBeenSet)
@@ -109,9 +110,9 @@ void CacheSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* locat
       unsigned eC2SecurityGroupsIdx = 1;
       for(auto& item : m_eC2SecurityGroups)
       {
-        Aws::StringStream eC2SecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream eC2SecurityGroupsSs;
         eC2SecurityGroupsSs << location << index << locationValue << ".EC2SecurityGroup." << eC2SecurityGroupsIdx++;
-        item.OutputToStream(oStream, eC2SecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, eC2SecurityGroupsSs.GetString().c_str());
       }
   }
 
@@ -121,24 +122,24 @@ void CacheSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_ownerIdHasBeenSet)
   {
-      oStream << location << ".OwnerId=" << StringUtils::URLEncode(m_ownerId.c_str()) << "&";
+      oStream << location << ".OwnerId=" << StringUtils::URLEncoded(m_ownerId) << "&";
   }
   if(m_cacheSecurityGroupNameHasBeenSet)
   {
-      oStream << location << ".CacheSecurityGroupName=" << StringUtils::URLEncode(m_cacheSecurityGroupName.c_str()) << "&";
+      oStream << location << ".CacheSecurityGroupName=" << StringUtils::URLEncoded(m_cacheSecurityGroupName) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_eC2SecurityGroupsHasBeenSet)
   {
       unsigned eC2SecurityGroupsIdx = 1;
       for(auto& item : m_eC2SecurityGroups)
       {
-        Aws::StringStream eC2SecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream eC2SecurityGroupsSs;
         eC2SecurityGroupsSs << location <<  ".EC2SecurityGroup." << eC2SecurityGroupsIdx++;
-        item.OutputToStream(oStream, eC2SecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, eC2SecurityGroupsSs.GetString().c_str());
       }
   }
 }
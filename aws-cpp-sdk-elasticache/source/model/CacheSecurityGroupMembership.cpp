@@ -51,13 +51,13 @@ CacheSecurityGroupMembership& CacheSecurityGroupMembership::operator =(const Xml
     XmlNode cacheSecurityGroupNameNode = resultNode.FirstChild("CacheSecurityGroupName");
     if(!cacheSecurityGroupNameNode.IsNull())
     {
-      m_cacheSecurityGroupName = StringUtils::Trim(cacheSecurityGroupNameNode.GetText().c_str());
+      m_cacheSecurityGroupName = cacheSecurityGroupNameNode.GetTextView().Trim().ToString();
       m_cacheSecurityGroupNameHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void CacheSecurityGroupMembership::OutputToStream(Aws::OStream& oStream, const c
 {
   if(m_cacheSecurityGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheSecurityGroupName=" << StringUtils::URLEncode(m_cacheSecurityGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheSecurityGroupName=" << StringUtils::URLEncoded(m_cacheSecurityGroupName) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void CacheSecurityGroupMembership::OutputToStream(Aws::OStream& oStream, const c
 {
   if(m_cacheSecurityGroupNameHasBeenSet)
   {
-      oStream << location << ".CacheSecurityGroupName=" << StringUtils::URLEncode(m_cacheSecurityGroupName.c_str()) << "&";
+      oStream << location << ".CacheSecurityGroupName=" << StringUtils::URLEncoded(m_cacheSecurityGroupName) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 }
 
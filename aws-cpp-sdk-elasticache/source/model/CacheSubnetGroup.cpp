@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -55,19 +56,19 @@ CacheSubnetGroup& CacheSubnetGroup::operator =(const XmlNode& xmlNode)
     XmlNode cacheSubnetGroupNameNode = resultNode.FirstChild("CacheSubnetGroupName");
     if(!cacheSubnetGroupNameNode.IsNull())
     {
-      m_cacheSubnetGroupName = StringUtils::Trim(cacheSubnetGroupNameNode.GetText().c_str());
+      m_cacheSubnetGroupName = cacheSubnetGroupNameNode.GetTextView().Trim().ToString();
       m_cacheSubnetGroupNameHasBeenSet = true;
     }
     XmlNode cacheSubnetGroupDescriptionNode = resultNode.FirstChild("CacheSubnetGroupDescription");
     if(!cacheSubnetGroupDescriptionNode.IsNull())
     {
-      m_cacheSubnetGroupDescription = StringUtils::Trim(cacheSubnetGroupDescriptionNode.GetText().c_str());
+      m_cacheSubnetGroupDescription = cacheSubnetGroupDescriptionNode.GetTextView().Trim().ToString();
       m_cacheSubnetGroupDescriptionHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("VpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode subnetsNode = resultNode.FirstChild("Subnets");
@@ -91,17 +92,17 @@ void CacheSubnetGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_cacheSubnetGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheSubnetGroupName=" << StringUtils::URLEncode(m_cacheSubnetGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheSubnetGroupName=" << StringUtils::URLEncoded(m_cacheSubnetGroupName) << "&";
   }
 
   if(m_cacheSubnetGroupDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheSubnetGroupDescription=" << StringUtils::URLEncode(m_cacheSubnetGroupDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheSubnetGroupDescription=" << StringUtils::URLEncoded(m_cacheSubnetGroupDescription) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_subnetsHasBeenSet)
@@ -109,9 +110,9 @@ void CacheSubnetGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned subnetsIdx = 1;
       for(auto& item : m_subnets)
       {
-        Aws::StringStream subnetsSs;
+        Aws::Utils::Stream::StringOutputStream subnetsSs;
         subnetsSs << location << index << locationValue << ".Subnet." << subnetsIdx++;
-        item.OutputToStream(oStream, subnetsSs.str().c_str());
+        item.OutputToStream(oStream, subnetsSs.GetString().c_str());
       }
   }
 
@@ -121,24 +122,24 @@ void CacheSubnetGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_cacheSubnetGroupNameHasBeenSet)
   {
-      oStream << location << ".CacheSubnetGroupName=" << StringUtils::URLEncode(m_cacheSubnetGroupName.c_str()) << "&";
+      oStream << location << ".CacheSubnetGroupName=" << StringUtils::URLEncoded(m_cacheSubnetGroupName) << "&";
   }
   if(m_cacheSubnetGroupDescriptionHasBeenSet)
   {
-      oStream << location << ".CacheSubnetGroupDescription=" << StringUtils::URLEncode(m_cacheSubnetGroupDescription.c_str()) << "&";
+      oStream << location << ".CacheSubnetGroupDescription=" << StringUtils::URLEncoded(m_cacheSubnetGroupDescription) << "&";
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_subnetsHasBeenSet)
   {
       unsigned subnetsIdx = 1;
       for(auto& item : m_subnets)
       {
-        Aws::StringStream subnetsSs;
+        Aws::Utils::Stream::StringOutputStream subnetsSs;
         subnetsSs << location <<  ".Subnet." << subnetsIdx++;
-        item.OutputToStream(oStream, subnetsSs.str().c_str());
+        item.OutputToStream(oStream, subnetsSs.GetString().c_str());
       }
   }
 }
@@ -29,21 +29,29 @@ namespace Aws
       namespace ChangeTypeMapper
       {
 
-        static const int immediate_HASH = HashingUtils::HashString("immediate");
-        static const int requires_reboot_HASH = HashingUtils::HashString("requires-reboot");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int immediate_HASH = 1124382641;
+        static const int requires_reboot_HASH = 77813412;
 
 
         ChangeType GetChangeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == immediate_HASH)
+          switch (hashCode)
           {
+          case immediate_HASH:
             return ChangeType::immediate;
-          }
-          else if (hashCode == requires_reboot_HASH)
-          {
+          case requires_reboot_HASH:
             return ChangeType::requires_reboot;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
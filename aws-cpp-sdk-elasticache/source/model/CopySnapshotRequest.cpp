@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/CopySnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ CopySnapshotRequest::CopySnapshotRequest() :
 
 Aws::String CopySnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CopySnapshot&";
   if(m_sourceSnapshotNameHasBeenSet)
   {
-    ss << "SourceSnapshotName=" << StringUtils::URLEncode(m_sourceSnapshotName.c_str()) << "&";
+    ss << "SourceSnapshotName=" << StringUtils::URLEncoded(m_sourceSnapshotName) << "&";
   }
 
   if(m_targetSnapshotNameHasBeenSet)
   {
-    ss << "TargetSnapshotName=" << StringUtils::URLEncode(m_targetSnapshotName.c_str()) << "&";
+    ss << "TargetSnapshotName=" << StringUtils::URLEncoded(m_targetSnapshotName) << "&";
   }
 
   if(m_targetBucketHasBeenSet)
   {
-    ss << "TargetBucket=" << StringUtils::URLEncode(m_targetBucket.c_str()) << "&";
+    ss << "TargetBucket=" << StringUtils::URLEncoded(m_targetBucket) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CopySnapshotResult& CopySnapshotResult::operator =(const AmazonWebServiceResult<
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CopySnapshotResult")
+  if (rootNode.GetNameView() != "CopySnapshotResult")
   {
     resultNode = rootNode.FirstChild("CopySnapshotResult");
   }
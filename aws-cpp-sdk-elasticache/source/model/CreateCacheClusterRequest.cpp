@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/CreateCacheClusterRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -51,16 +52,16 @@ CreateCacheClusterRequest::CreateCacheClusterRequest() :
 
 Aws::String CreateCacheClusterRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateCacheCluster&";
   if(m_cacheClusterIdHasBeenSet)
   {
-    ss << "CacheClusterId=" << StringUtils::URLEncode(m_cacheClusterId.c_str()) << "&";
+    ss << "CacheClusterId=" << StringUtils::URLEncoded(m_cacheClusterId) << "&";
   }
 
   if(m_replicationGroupIdHasBeenSet)
   {
-    ss << "ReplicationGroupId=" << StringUtils::URLEncode(m_replicationGroupId.c_str()) << "&";
+    ss << "ReplicationGroupId=" << StringUtils::URLEncoded(m_replicationGroupId) << "&";
   }
 
   if(m_aZModeHasBeenSet)
@@ -70,7 +71,7 @@ Aws::String CreateCacheClusterRequest::SerializePayload() const
 
   if(m_preferredAvailabilityZoneHasBeenSet)
   {
-    ss << "PreferredAvailabilityZone=" << StringUtils::URLEncode(m_preferredAvailabilityZone.c_str()) << "&";
+    ss << "PreferredAvailabilityZone=" << StringUtils::URLEncoded(m_preferredAvailabilityZone) << "&";
   }
 
   if(m_preferredAvailabilityZonesHasBeenSet)
@@ -79,7 +80,7 @@ Aws::String CreateCacheClusterRequest::SerializePayload() const
     for(auto& item : m_preferredAvailabilityZones)
     {
       ss << "PreferredAvailabilityZones.member." << preferredAvailabilityZonesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       preferredAvailabilityZonesCount++;
     }
   }
@@ -91,27 +92,27 @@ Aws::String CreateCacheClusterRequest::SerializePayload() const
 
   if(m_cacheNodeTypeHasBeenSet)
   {
-    ss << "CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+    ss << "CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
 
   if(m_engineHasBeenSet)
   {
-    ss << "Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+    ss << "Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
 
   if(m_engineVersionHasBeenSet)
   {
-    ss << "EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+    ss << "EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_cacheParameterGroupNameHasBeenSet)
   {
-    ss << "CacheParameterGroupName=" << StringUtils::URLEncode(m_cacheParameterGroupName.c_str()) << "&";
+    ss << "CacheParameterGroupName=" << StringUtils::URLEncoded(m_cacheParameterGroupName) << "&";
   }
 
   if(m_cacheSubnetGroupNameHasBeenSet)
   {
-    ss << "CacheSubnetGroupName=" << StringUtils::URLEncode(m_cacheSubnetGroupName.c_str()) << "&";
+    ss << "CacheSubnetGroupName=" << StringUtils::URLEncoded(m_cacheSubnetGroupName) << "&";
   }
 
   if(m_cacheSecurityGroupNamesHasBeenSet)
@@ -120,7 +121,7 @@ Aws::String CreateCacheClusterRequest::SerializePayload() const
     for(auto& item : m_cacheSecurityGroupNames)
     {
       ss << "CacheSecurityGroupNames.member." << cacheSecurityGroupNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       cacheSecurityGroupNamesCount++;
     }
   }
@@ -131,7 +132,7 @@ Aws::String CreateCacheClusterRequest::SerializePayload() const
     for(auto& item : m_securityGroupIds)
     {
       ss << "SecurityGroupIds.member." << securityGroupIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       securityGroupIdsCount++;
     }
   }
@@ -152,19 +153,19 @@ Aws::String CreateCacheClusterRequest::SerializePayload() const
     for(auto& item : m_snapshotArns)
     {
       ss << "SnapshotArns.member." << snapshotArnsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       snapshotArnsCount++;
     }
   }
 
   if(m_snapshotNameHasBeenSet)
   {
-    ss << "SnapshotName=" << StringUtils::URLEncode(m_snapshotName.c_str()) << "&";
+    ss << "SnapshotName=" << StringUtils::URLEncoded(m_snapshotName) << "&";
   }
 
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -174,7 +175,7 @@ Aws::String CreateCacheClusterRequest::SerializePayload() const
 
   if(m_notificationTopicArnHasBeenSet)
   {
-    ss << "NotificationTopicArn=" << StringUtils::URLEncode(m_notificationTopicArn.c_str()) << "&";
+    ss << "NotificationTopicArn=" << StringUtils::URLEncoded(m_notificationTopicArn) << "&";
   }
 
   if(m_autoMinorVersionUpgradeHasBeenSet)
@@ -189,10 +190,10 @@ Aws::String CreateCacheClusterRequest::SerializePayload() const
 
   if(m_snapshotWindowHasBeenSet)
   {
-    ss << "SnapshotWindow=" << StringUtils::URLEncode(m_snapshotWindow.c_str()) << "&";
+    ss << "SnapshotWindow=" << StringUtils::URLEncoded(m_snapshotWindow) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
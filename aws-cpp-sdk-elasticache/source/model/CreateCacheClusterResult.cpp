@@ -40,7 +40,7 @@ CreateCacheClusterResult& CreateCacheClusterResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateCacheClusterResult")
+  if (rootNode.GetNameView() != "CreateCacheClusterResult")
   {
     resultNode = rootNode.FirstChild("CreateCacheClusterResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/CreateCacheParameterGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ CreateCacheParameterGroupRequest::CreateCacheParameterGroupRequest() :
 
 Aws::String CreateCacheParameterGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateCacheParameterGroup&";
   if(m_cacheParameterGroupNameHasBeenSet)
   {
-    ss << "CacheParameterGroupName=" << StringUtils::URLEncode(m_cacheParameterGroupName.c_str()) << "&";
+    ss << "CacheParameterGroupName=" << StringUtils::URLEncoded(m_cacheParameterGroupName) << "&";
   }
 
   if(m_cacheParameterGroupFamilyHasBeenSet)
   {
-    ss << "CacheParameterGroupFamily=" << StringUtils::URLEncode(m_cacheParameterGroupFamily.c_str()) << "&";
+    ss << "CacheParameterGroupFamily=" << StringUtils::URLEncoded(m_cacheParameterGroupFamily) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
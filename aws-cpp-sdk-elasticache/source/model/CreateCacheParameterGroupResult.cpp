@@ -40,7 +40,7 @@ CreateCacheParameterGroupResult& CreateCacheParameterGroupResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateCacheParameterGroupResult")
+  if (rootNode.GetNameView() != "CreateCacheParameterGroupResult")
   {
     resultNode = rootNode.FirstChild("CreateCacheParameterGroupResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/CreateCacheSecurityGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ CreateCacheSecurityGroupRequest::CreateCacheSecurityGroupRequest() :
 
 Aws::String CreateCacheSecurityGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateCacheSecurityGroup&";
   if(m_cacheSecurityGroupNameHasBeenSet)
   {
-    ss << "CacheSecurityGroupName=" << StringUtils::URLEncode(m_cacheSecurityGroupName.c_str()) << "&";
+    ss << "CacheSecurityGroupName=" << StringUtils::URLEncoded(m_cacheSecurityGroupName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateCacheSecurityGroupResult& CreateCacheSecurityGroupResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateCacheSecurityGroupResult")
+  if (rootNode.GetNameView() != "CreateCacheSecurityGroupResult")
   {
     resultNode = rootNode.FirstChild("CreateCacheSecurityGroupResult");
   }
@@ -40,7 +40,7 @@ CreateCacheSubnetGroupResult& CreateCacheSubnetGroupResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateCacheSubnetGroupResult")
+  if (rootNode.GetNameView() != "CreateCacheSubnetGroupResult")
   {
     resultNode = rootNode.FirstChild("CreateCacheSubnetGroupResult");
   }
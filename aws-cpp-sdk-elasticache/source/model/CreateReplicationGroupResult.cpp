@@ -40,7 +40,7 @@ CreateReplicationGroupResult& CreateReplicationGroupResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateReplicationGroupResult")
+  if (rootNode.GetNameView() != "CreateReplicationGroupResult")
   {
     resultNode = rootNode.FirstChild("CreateReplicationGroupResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/CreateSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ CreateSnapshotRequest::CreateSnapshotRequest() :
 
 Aws::String CreateSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateSnapshot&";
   if(m_cacheClusterIdHasBeenSet)
   {
-    ss << "CacheClusterId=" << StringUtils::URLEncode(m_cacheClusterId.c_str()) << "&";
+    ss << "CacheClusterId=" << StringUtils::URLEncoded(m_cacheClusterId) << "&";
   }
 
   if(m_snapshotNameHasBeenSet)
   {
-    ss << "SnapshotName=" << StringUtils::URLEncode(m_snapshotName.c_str()) << "&";
+    ss << "SnapshotName=" << StringUtils::URLEncoded(m_snapshotName) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateSnapshotResult& CreateSnapshotResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateSnapshotResult")
+  if (rootNode.GetNameView() != "CreateSnapshotResult")
   {
     resultNode = rootNode.FirstChild("CreateSnapshotResult");
   }
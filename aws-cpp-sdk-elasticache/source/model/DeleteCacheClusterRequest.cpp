@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/DeleteCacheClusterRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ DeleteCacheClusterRequest::DeleteCacheClusterRequest() :
 
 Aws::String DeleteCacheClusterRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteCacheCluster&";
   if(m_cacheClusterIdHasBeenSet)
   {
-    ss << "CacheClusterId=" << StringUtils::URLEncode(m_cacheClusterId.c_str()) << "&";
+    ss << "CacheClusterId=" << StringUtils::URLEncoded(m_cacheClusterId) << "&";
   }
 
   if(m_finalSnapshotIdentifierHasBeenSet)
   {
-    ss << "FinalSnapshotIdentifier=" << StringUtils::URLEncode(m_finalSnapshotIdentifier.c_str()) << "&";
+    ss << "FinalSnapshotIdentifier=" << StringUtils::URLEncoded(m_finalSnapshotIdentifier) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DeleteCacheClusterResult& DeleteCacheClusterResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteCacheClusterResult")
+  if (rootNode.GetNameView() != "DeleteCacheClusterResult")
   {
     resultNode = rootNode.FirstChild("DeleteCacheClusterResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/DeleteCacheParameterGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteCacheParameterGroupRequest::DeleteCacheParameterGroupRequest() :
 
 Aws::String DeleteCacheParameterGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteCacheParameterGroup&";
   if(m_cacheParameterGroupNameHasBeenSet)
   {
-    ss << "CacheParameterGroupName=" << StringUtils::URLEncode(m_cacheParameterGroupName.c_str()) << "&";
+    ss << "CacheParameterGroupName=" << StringUtils::URLEncoded(m_cacheParameterGroupName) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
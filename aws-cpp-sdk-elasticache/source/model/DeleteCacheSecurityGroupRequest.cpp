@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/DeleteCacheSecurityGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteCacheSecurityGroupRequest::DeleteCacheSecurityGroupRequest() :
 
 Aws::String DeleteCacheSecurityGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteCacheSecurityGroup&";
   if(m_cacheSecurityGroupNameHasBeenSet)
   {
-    ss << "CacheSecurityGroupName=" << StringUtils::URLEncode(m_cacheSecurityGroupName.c_str()) << "&";
+    ss << "CacheSecurityGroupName=" << StringUtils::URLEncoded(m_cacheSecurityGroupName) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/DeleteCacheSubnetGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteCacheSubnetGroupRequest::DeleteCacheSubnetGroupRequest() :
 
 Aws::String DeleteCacheSubnetGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteCacheSubnetGroup&";
   if(m_cacheSubnetGroupNameHasBeenSet)
   {
-    ss << "CacheSubnetGroupName=" << StringUtils::URLEncode(m_cacheSubnetGroupName.c_str()) << "&";
+    ss << "CacheSubnetGroupName=" << StringUtils::URLEncoded(m_cacheSubnetGroupName) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
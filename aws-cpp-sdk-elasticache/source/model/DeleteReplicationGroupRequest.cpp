@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/DeleteReplicationGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -29,11 +30,11 @@ DeleteReplicationGroupRequest::DeleteReplicationGroupRequest() :
 
 Aws::String DeleteReplicationGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteReplicationGroup&";
   if(m_replicationGroupIdHasBeenSet)
   {
-    ss << "ReplicationGroupId=" << StringUtils::URLEncode(m_replicationGroupId.c_str()) << "&";
+    ss << "ReplicationGroupId=" << StringUtils::URLEncoded(m_replicationGroupId) << "&";
   }
 
   if(m_retainPrimaryClusterHasBeenSet)
@@ -43,10 +44,10 @@ Aws::String DeleteReplicationGroupRequest::SerializePayload() const
 
   if(m_finalSnapshotIdentifierHasBeenSet)
   {
-    ss << "FinalSnapshotIdentifier=" << StringUtils::URLEncode(m_finalSnapshotIdentifier.c_str()) << "&";
+    ss << "FinalSnapshotIdentifier=" << StringUtils::URLEncoded(m_finalSnapshotIdentifier) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DeleteReplicationGroupResult& DeleteReplicationGroupResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteReplicationGroupResult")
+  if (rootNode.GetNameView() != "DeleteReplicationGroupResult")
   {
     resultNode = rootNode.FirstChild("DeleteReplicationGroupResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/DeleteSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteSnapshotRequest::DeleteSnapshotRequest() :
 
 Aws::String DeleteSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteSnapshot&";
   if(m_snapshotNameHasBeenSet)
   {
-    ss << "SnapshotName=" << StringUtils::URLEncode(m_snapshotName.c_str()) << "&";
+    ss << "SnapshotName=" << StringUtils::URLEncoded(m_snapshotName) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
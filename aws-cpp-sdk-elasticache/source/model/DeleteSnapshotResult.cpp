@@ -40,7 +40,7 @@ DeleteSnapshotResult& DeleteSnapshotResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteSnapshotResult")
+  if (rootNode.GetNameView() != "DeleteSnapshotResult")
   {
     resultNode = rootNode.FirstChild("DeleteSnapshotResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/DescribeCacheClustersRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -31,11 +32,11 @@ DescribeCacheClustersRequest::DescribeCacheClustersRequest() :
 
 Aws::String DescribeCacheClustersRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeCacheClusters&";
   if(m_cacheClusterIdHasBeenSet)
   {
-    ss << "CacheClusterId=" << StringUtils::URLEncode(m_cacheClusterId.c_str()) << "&";
+    ss << "CacheClusterId=" << StringUtils::URLEncoded(m_cacheClusterId) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -45,7 +46,7 @@ Aws::String DescribeCacheClustersRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_showCacheNodeInfoHasBeenSet)
@@ -54,6 +55,6 @@ Aws::String DescribeCacheClustersRequest::SerializePayload() const
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
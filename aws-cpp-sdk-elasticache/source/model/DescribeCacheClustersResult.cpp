@@ -40,7 +40,7 @@ DescribeCacheClustersResult& DescribeCacheClustersResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeCacheClustersResult")
+  if (rootNode.GetNameView() != "DescribeCacheClustersResult")
   {
     resultNode = rootNode.FirstChild("DescribeCacheClustersResult");
   }
@@ -50,7 +50,7 @@ DescribeCacheClustersResult& DescribeCacheClustersResult::operator =(const Amazo
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode cacheClustersNode = resultNode.FirstChild("CacheClusters");
     if(!cacheClustersNode.IsNull())
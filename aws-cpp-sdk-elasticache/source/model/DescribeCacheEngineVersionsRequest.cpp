@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/DescribeCacheEngineVersionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -33,21 +34,21 @@ DescribeCacheEngineVersionsRequest::DescribeCacheEngineVersionsRequest() :
 
 Aws::String DescribeCacheEngineVersionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeCacheEngineVersions&";
   if(m_engineHasBeenSet)
   {
-    ss << "Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+    ss << "Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
 
   if(m_engineVersionHasBeenSet)
   {
-    ss << "EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+    ss << "EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_cacheParameterGroupFamilyHasBeenSet)
   {
-    ss << "CacheParameterGroupFamily=" << StringUtils::URLEncode(m_cacheParameterGroupFamily.c_str()) << "&";
+    ss << "CacheParameterGroupFamily=" << StringUtils::URLEncoded(m_cacheParameterGroupFamily) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -57,7 +58,7 @@ Aws::String DescribeCacheEngineVersionsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_defaultOnlyHasBeenSet)
@@ -66,6 +67,6 @@ Aws::String DescribeCacheEngineVersionsRequest::SerializePayload() const
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
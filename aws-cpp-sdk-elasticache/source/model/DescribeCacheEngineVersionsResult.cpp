@@ -40,7 +40,7 @@ DescribeCacheEngineVersionsResult& DescribeCacheEngineVersionsResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeCacheEngineVersionsResult")
+  if (rootNode.GetNameView() != "DescribeCacheEngineVersionsResult")
   {
     resultNode = rootNode.FirstChild("DescribeCacheEngineVersionsResult");
   }
@@ -50,7 +50,7 @@ DescribeCacheEngineVersionsResult& DescribeCacheEngineVersionsResult::operator =
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode cacheEngineVersionsNode = resultNode.FirstChild("CacheEngineVersions");
     if(!cacheEngineVersionsNode.IsNull())
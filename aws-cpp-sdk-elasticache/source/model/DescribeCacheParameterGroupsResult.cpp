@@ -40,7 +40,7 @@ DescribeCacheParameterGroupsResult& DescribeCacheParameterGroupsResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeCacheParameterGroupsResult")
+  if (rootNode.GetNameView() != "DescribeCacheParameterGroupsResult")
   {
     resultNode = rootNode.FirstChild("DescribeCacheParameterGroupsResult");
   }
@@ -50,7 +50,7 @@ DescribeCacheParameterGroupsResult& DescribeCacheParameterGroupsResult::operator
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode cacheParameterGroupsNode = resultNode.FirstChild("CacheParameterGroups");
     if(!cacheParameterGroupsNode.IsNull())
@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/DescribeCacheParametersRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -30,16 +31,16 @@ DescribeCacheParametersRequest::DescribeCacheParametersRequest() :
 
 Aws::String DescribeCacheParametersRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeCacheParameters&";
   if(m_cacheParameterGroupNameHasBeenSet)
   {
-    ss << "CacheParameterGroupName=" << StringUtils::URLEncode(m_cacheParameterGroupName.c_str()) << "&";
+    ss << "CacheParameterGroupName=" << StringUtils::URLEncoded(m_cacheParameterGroupName) << "&";
   }
 
   if(m_sourceHasBeenSet)
   {
-    ss << "Source=" << StringUtils::URLEncode(m_source.c_str()) << "&";
+    ss << "Source=" << StringUtils::URLEncoded(m_source) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -49,10 +50,10 @@ Aws::String DescribeCacheParametersRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeCacheParametersResult& DescribeCacheParametersResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeCacheParametersResult")
+  if (rootNode.GetNameView() != "DescribeCacheParametersResult")
   {
     resultNode = rootNode.FirstChild("DescribeCacheParametersResult");
   }
@@ -50,7 +50,7 @@ DescribeCacheParametersResult& DescribeCacheParametersResult::operator =(const A
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode parametersNode = resultNode.FirstChild("Parameters");
     if(!parametersNode.IsNull())
@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/DescribeCacheSecurityGroupsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -29,11 +30,11 @@ DescribeCacheSecurityGroupsRequest::DescribeCacheSecurityGroupsRequest() :
 
 Aws::String DescribeCacheSecurityGroupsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeCacheSecurityGroups&";
   if(m_cacheSecurityGroupNameHasBeenSet)
   {
-    ss << "CacheSecurityGroupName=" << StringUtils::URLEncode(m_cacheSecurityGroupName.c_str()) << "&";
+    ss << "CacheSecurityGroupName=" << StringUtils::URLEncoded(m_cacheSecurityGroupName) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -43,10 +44,10 @@ Aws::String DescribeCacheSecurityGroupsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeCacheSecurityGroupsResult& DescribeCacheSecurityGroupsResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeCacheSecurityGroupsResult")
+  if (rootNode.GetNameView() != "DescribeCacheSecurityGroupsResult")
   {
     resultNode = rootNode.FirstChild("DescribeCacheSecurityGroupsResult");
   }
@@ -50,7 +50,7 @@ DescribeCacheSecurityGroupsResult& DescribeCacheSecurityGroupsResult::operator =
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode cacheSecurityGroupsNode = resultNode.FirstChild("CacheSecurityGroups");
     if(!cacheSecurityGroupsNode.IsNull())
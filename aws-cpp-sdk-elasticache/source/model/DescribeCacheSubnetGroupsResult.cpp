@@ -40,7 +40,7 @@ DescribeCacheSubnetGroupsResult& DescribeCacheSubnetGroupsResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeCacheSubnetGroupsResult")
+  if (rootNode.GetNameView() != "DescribeCacheSubnetGroupsResult")
   {
     resultNode = rootNode.FirstChild("DescribeCacheSubnetGroupsResult");
   }
@@ -50,7 +50,7 @@ DescribeCacheSubnetGroupsResult& DescribeCacheSubnetGroupsResult::operator =(con
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode cacheSubnetGroupsNode = resultNode.FirstChild("CacheSubnetGroups");
     if(!cacheSubnetGroupsNode.IsNull())
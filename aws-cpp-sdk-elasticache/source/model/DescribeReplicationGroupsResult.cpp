@@ -40,7 +40,7 @@ DescribeReplicationGroupsResult& DescribeReplicationGroupsResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeReplicationGroupsResult")
+  if (rootNode.GetNameView() != "DescribeReplicationGroupsResult")
   {
     resultNode = rootNode.FirstChild("DescribeReplicationGroupsResult");
   }
@@ -50,7 +50,7 @@ DescribeReplicationGroupsResult& DescribeReplicationGroupsResult::operator =(con
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode replicationGroupsNode = resultNode.FirstChild("ReplicationGroups");
     if(!replicationGroupsNode.IsNull())
@@ -40,7 +40,7 @@ DescribeReservedCacheNodesOfferingsResult& DescribeReservedCacheNodesOfferingsRe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeReservedCacheNodesOfferingsResult")
+  if (rootNode.GetNameView() != "DescribeReservedCacheNodesOfferingsResult")
   {
     resultNode = rootNode.FirstChild("DescribeReservedCacheNodesOfferingsResult");
   }
@@ -50,7 +50,7 @@ DescribeReservedCacheNodesOfferingsResult& DescribeReservedCacheNodesOfferingsRe
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode reservedCacheNodesOfferingsNode = resultNode.FirstChild("ReservedCacheNodesOfferings");
     if(!reservedCacheNodesOfferingsNode.IsNull())
@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/DescribeReservedCacheNodesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -34,36 +35,36 @@ DescribeReservedCacheNodesRequest::DescribeReservedCacheNodesRequest() :
 
 Aws::String DescribeReservedCacheNodesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeReservedCacheNodes&";
   if(m_reservedCacheNodeIdHasBeenSet)
   {
-    ss << "ReservedCacheNodeId=" << StringUtils::URLEncode(m_reservedCacheNodeId.c_str()) << "&";
+    ss << "ReservedCacheNodeId=" << StringUtils::URLEncoded(m_reservedCacheNodeId) << "&";
   }
 
   if(m_reservedCacheNodesOfferingIdHasBeenSet)
   {
-    ss << "ReservedCacheNodesOfferingId=" << StringUtils::URLEncode(m_reservedCacheNodesOfferingId.c_str()) << "&";
+    ss << "ReservedCacheNodesOfferingId=" << StringUtils::URLEncoded(m_reservedCacheNodesOfferingId) << "&";
   }
 
   if(m_cacheNodeTypeHasBeenSet)
   {
-    ss << "CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+    ss << "CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
 
   if(m_durationHasBeenSet)
   {
-    ss << "Duration=" << StringUtils::URLEncode(m_duration.c_str()) << "&";
+    ss << "Duration=" << StringUtils::URLEncoded(m_duration) << "&";
   }
 
   if(m_productDescriptionHasBeenSet)
   {
-    ss << "ProductDescription=" << StringUtils::URLEncode(m_productDescription.c_str()) << "&";
+    ss << "ProductDescription=" << StringUtils::URLEncoded(m_productDescription) << "&";
   }
 
   if(m_offeringTypeHasBeenSet)
   {
-    ss << "OfferingType=" << StringUtils::URLEncode(m_offeringType.c_str()) << "&";
+    ss << "OfferingType=" << StringUtils::URLEncoded(m_offeringType) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -73,10 +74,10 @@ Aws::String DescribeReservedCacheNodesRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeReservedCacheNodesResult& DescribeReservedCacheNodesResult::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeReservedCacheNodesResult")
+  if (rootNode.GetNameView() != "DescribeReservedCacheNodesResult")
   {
     resultNode = rootNode.FirstChild("DescribeReservedCacheNodesResult");
   }
@@ -50,7 +50,7 @@ DescribeReservedCacheNodesResult& DescribeReservedCacheNodesResult::operator =(c
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode reservedCacheNodesNode = resultNode.FirstChild("ReservedCacheNodes");
     if(!reservedCacheNodesNode.IsNull())
@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/DescribeSnapshotsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -31,26 +32,26 @@ DescribeSnapshotsRequest::DescribeSnapshotsRequest() :
 
 Aws::String DescribeSnapshotsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeSnapshots&";
   if(m_cacheClusterIdHasBeenSet)
   {
-    ss << "CacheClusterId=" << StringUtils::URLEncode(m_cacheClusterId.c_str()) << "&";
+    ss << "CacheClusterId=" << StringUtils::URLEncoded(m_cacheClusterId) << "&";
   }
 
   if(m_snapshotNameHasBeenSet)
   {
-    ss << "SnapshotName=" << StringUtils::URLEncode(m_snapshotName.c_str()) << "&";
+    ss << "SnapshotName=" << StringUtils::URLEncoded(m_snapshotName) << "&";
   }
 
   if(m_snapshotSourceHasBeenSet)
   {
-    ss << "SnapshotSource=" << StringUtils::URLEncode(m_snapshotSource.c_str()) << "&";
+    ss << "SnapshotSource=" << StringUtils::URLEncoded(m_snapshotSource) << "&";
   }
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -59,6 +60,6 @@ Aws::String DescribeSnapshotsRequest::SerializePayload() const
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeSnapshotsResult& DescribeSnapshotsResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeSnapshotsResult")
+  if (rootNode.GetNameView() != "DescribeSnapshotsResult")
   {
     resultNode = rootNode.FirstChild("DescribeSnapshotsResult");
   }
@@ -50,7 +50,7 @@ DescribeSnapshotsResult& DescribeSnapshotsResult::operator =(const AmazonWebServ
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode snapshotsNode = resultNode.FirstChild("Snapshots");
     if(!snapshotsNode.IsNull())
@@ -53,13 +53,13 @@ Endpoint& Endpoint::operator =(const XmlNode& xmlNode)
     XmlNode addressNode = resultNode.FirstChild("Address");
     if(!addressNode.IsNull())
     {
-      m_address = StringUtils::Trim(addressNode.GetText().c_str());
+      m_address = addressNode.GetTextView().Trim().ToString();
       m_addressHasBeenSet = true;
     }
     XmlNode portNode = resultNode.FirstChild("Port");
     if(!portNode.IsNull())
     {
-      m_port = StringUtils::ConvertToInt32(StringUtils::Trim(portNode.GetText().c_str()).c_str());
+      m_port = StringUtils::ConvertToInt32(portNode.GetTextView().Trim().ToString().c_str());
       m_portHasBeenSet = true;
     }
   }
@@ -71,7 +71,7 @@ void Endpoint::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 {
   if(m_addressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Address=" << StringUtils::URLEncode(m_address.c_str()) << "&";
+      oStream << location << index << locationValue << ".Address=" << StringUtils::URLEncoded(m_address) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -85,7 +85,7 @@ void Endpoint::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_addressHasBeenSet)
   {
-      oStream << location << ".Address=" << StringUtils::URLEncode(m_address.c_str()) << "&";
+      oStream << location << ".Address=" << StringUtils::URLEncoded(m_address) << "&";
   }
   if(m_portHasBeenSet)
   {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -55,13 +56,13 @@ EngineDefaults& EngineDefaults::operator =(const XmlNode& xmlNode)
     XmlNode cacheParameterGroupFamilyNode = resultNode.FirstChild("CacheParameterGroupFamily");
     if(!cacheParameterGroupFamilyNode.IsNull())
     {
-      m_cacheParameterGroupFamily = StringUtils::Trim(cacheParameterGroupFamilyNode.GetText().c_str());
+      m_cacheParameterGroupFamily = cacheParameterGroupFamilyNode.GetTextView().Trim().ToString();
       m_cacheParameterGroupFamilyHasBeenSet = true;
     }
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
       m_markerHasBeenSet = true;
     }
     XmlNode parametersNode = resultNode.FirstChild("Parameters");
@@ -97,12 +98,12 @@ void EngineDefaults::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_cacheParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheParameterGroupFamily=" << StringUtils::URLEncode(m_cacheParameterGroupFamily.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheParameterGroupFamily=" << StringUtils::URLEncoded(m_cacheParameterGroupFamily) << "&";
   }
 
   if(m_markerHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+      oStream << location << index << locationValue << ".Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_parametersHasBeenSet)
@@ -110,9 +111,9 @@ void EngineDefaults::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned parametersIdx = 1;
       for(auto& item : m_parameters)
       {
-        Aws::StringStream parametersSs;
+        Aws::Utils::Stream::StringOutputStream parametersSs;
         parametersSs << location << index << locationValue << ".Parameter." << parametersIdx++;
-        item.OutputToStream(oStream, parametersSs.str().c_str());
+        item.OutputToStream(oStream, parametersSs.GetString().c_str());
       }
   }
 
@@ -121,9 +122,9 @@ void EngineDefaults::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned cacheNodeTypeSpecificParametersIdx = 1;
       for(auto& item : m_cacheNodeTypeSpecificParameters)
       {
-        Aws::StringStream cacheNodeTypeSpecificParametersSs;
+        Aws::Utils::Stream::StringOutputStream cacheNodeTypeSpecificParametersSs;
         cacheNodeTypeSpecificParametersSs << location << index << locationValue << ".CacheNodeTypeSpecificParameter." << cacheNodeTypeSpecificParametersIdx++;
-        item.OutputToStream(oStream, cacheNodeTypeSpecificParametersSs.str().c_str());
+        item.OutputToStream(oStream, cacheNodeTypeSpecificParametersSs.GetString().c_str());
       }
   }
 
@@ -133,20 +134,20 @@ void EngineDefaults::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_cacheParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << ".CacheParameterGroupFamily=" << StringUtils::URLEncode(m_cacheParameterGroupFamily.c_str()) << "&";
+      oStream << location << ".CacheParameterGroupFamily=" << StringUtils::URLEncoded(m_cacheParameterGroupFamily) << "&";
   }
   if(m_markerHasBeenSet)
   {
-      oStream << location << ".Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+      oStream << location << ".Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
   if(m_parametersHasBeenSet)
   {
       unsigned parametersIdx = 1;
       for(auto& item : m_parameters)
       {
-        Aws::StringStream parametersSs;
+        Aws::Utils::Stream::StringOutputStream parametersSs;
         parametersSs << location <<  ".Parameter." << parametersIdx++;
-        item.OutputToStream(oStream, parametersSs.str().c_str());
+        item.OutputToStream(oStream, parametersSs.GetString().c_str());
       }
   }
   if(m_cacheNodeTypeSpecificParametersHasBeenSet)
@@ -154,9 +155,9 @@ void EngineDefaults::OutputToStream(Aws::OStream& oStream, const char* location)
       unsigned cacheNodeTypeSpecificParametersIdx = 1;
       for(auto& item : m_cacheNodeTypeSpecificParameters)
       {
-        Aws::StringStream cacheNodeTypeSpecificParametersSs;
+        Aws::Utils::Stream::StringOutputStream cacheNodeTypeSpecificParametersSs;
         cacheNodeTypeSpecificParametersSs << location <<  ".CacheNodeTypeSpecificParameter." << cacheNodeTypeSpecificParametersIdx++;
-        item.OutputToStream(oStream, cacheNodeTypeSpecificParametersSs.str().c_str());
+        item.OutputToStream(oStream, cacheNodeTypeSpecificParametersSs.GetString().c_str());
       }
   }
 }
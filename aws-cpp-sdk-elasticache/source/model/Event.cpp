@@ -55,25 +55,25 @@ Event& Event::operator =(const XmlNode& xmlNode)
     XmlNode sourceIdentifierNode = resultNode.FirstChild("SourceIdentifier");
     if(!sourceIdentifierNode.IsNull())
     {
-      m_sourceIdentifier = StringUtils::Trim(sourceIdentifierNode.GetText().c_str());
+      m_sourceIdentifier = sourceIdentifierNode.GetTextView().Trim().ToString();
       m_sourceIdentifierHasBeenSet = true;
     }
     XmlNode sourceTypeNode = resultNode.FirstChild("SourceType");
     if(!sourceTypeNode.IsNull())
     {
-      m_sourceType = SourceTypeMapper::GetSourceTypeForName(StringUtils::Trim(sourceTypeNode.GetText().c_str()).c_str());
+      m_sourceType = SourceTypeMapper::GetSourceTypeForName(sourceTypeNode.GetTextView().Trim().ToString().c_str());
       m_sourceTypeHasBeenSet = true;
     }
     XmlNode messageNode = resultNode.FirstChild("Message");
     if(!messageNode.IsNull())
     {
-      m_message = StringUtils::Trim(messageNode.GetText().c_str());
+      m_message = messageNode.GetTextView().Trim().ToString();
       m_messageHasBeenSet = true;
     }
     XmlNode dateNode = resultNode.FirstChild("Date");
     if(!dateNode.IsNull())
     {
-      m_date = DateTime(StringUtils::Trim(dateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_date = DateTime(dateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_dateHasBeenSet = true;
     }
   }
@@ -85,7 +85,7 @@ void Event::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 {
   if(m_sourceIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceIdentifier=" << StringUtils::URLEncode(m_sourceIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceIdentifier=" << StringUtils::URLEncoded(m_sourceIdentifier) << "&";
   }
 
   if(m_sourceTypeHasBeenSet)
@@ -95,12 +95,12 @@ void Event::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 
   if(m_messageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 
   if(m_dateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Date=" << StringUtils::URLEncode(m_date.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".Date=" << StringUtils::URLEncoded(m_date.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -109,7 +109,7 @@ void Event::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_sourceIdentifierHasBeenSet)
   {
-      oStream << location << ".SourceIdentifier=" << StringUtils::URLEncode(m_sourceIdentifier.c_str()) << "&";
+      oStream << location << ".SourceIdentifier=" << StringUtils::URLEncoded(m_sourceIdentifier) << "&";
   }
   if(m_sourceTypeHasBeenSet)
   {
@@ -117,11 +117,11 @@ void Event::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_messageHasBeenSet)
   {
-      oStream << location << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
   if(m_dateHasBeenSet)
   {
-      oStream << location << ".Date=" << StringUtils::URLEncode(m_date.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".Date=" << StringUtils::URLEncoded(m_date.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
@@ -40,7 +40,7 @@ ListAllowedNodeTypeModificationsResult& ListAllowedNodeTypeModificationsResult::
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListAllowedNodeTypeModificationsResult")
+  if (rootNode.GetNameView() != "ListAllowedNodeTypeModificationsResult")
   {
     resultNode = rootNode.FirstChild("ListAllowedNodeTypeModificationsResult");
   }
@@ -53,7 +53,7 @@ ListAllowedNodeTypeModificationsResult& ListAllowedNodeTypeModificationsResult::
       XmlNode scaleUpModificationsMember = scaleUpModificationsNode.FirstChild("member");
       while(!scaleUpModificationsMember.IsNull())
       {
-        m_scaleUpModifications.push_back(StringUtils::Trim(scaleUpModificationsMember.GetText().c_str()));
+        m_scaleUpModifications.push_back(scaleUpModificationsMember.GetTextView().Trim().ToString());
         scaleUpModificationsMember = scaleUpModificationsMember.NextNode("member");
       }
 
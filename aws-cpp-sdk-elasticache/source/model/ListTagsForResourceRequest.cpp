@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/ListTagsForResourceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ ListTagsForResourceRequest::ListTagsForResourceRequest() :
 
 Aws::String ListTagsForResourceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListTagsForResource&";
   if(m_resourceNameHasBeenSet)
   {
-    ss << "ResourceName=" << StringUtils::URLEncode(m_resourceName.c_str()) << "&";
+    ss << "ResourceName=" << StringUtils::URLEncoded(m_resourceName) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
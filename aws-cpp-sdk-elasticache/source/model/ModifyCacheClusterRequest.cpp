@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/ModifyCacheClusterRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -46,11 +47,11 @@ ModifyCacheClusterRequest::ModifyCacheClusterRequest() :
 
 Aws::String ModifyCacheClusterRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyCacheCluster&";
   if(m_cacheClusterIdHasBeenSet)
   {
-    ss << "CacheClusterId=" << StringUtils::URLEncode(m_cacheClusterId.c_str()) << "&";
+    ss << "CacheClusterId=" << StringUtils::URLEncoded(m_cacheClusterId) << "&";
   }
 
   if(m_numCacheNodesHasBeenSet)
@@ -64,7 +65,7 @@ Aws::String ModifyCacheClusterRequest::SerializePayload() const
     for(auto& item : m_cacheNodeIdsToRemove)
     {
       ss << "CacheNodeIdsToRemove.member." << cacheNodeIdsToRemoveCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       cacheNodeIdsToRemoveCount++;
     }
   }
@@ -80,7 +81,7 @@ Aws::String ModifyCacheClusterRequest::SerializePayload() const
     for(auto& item : m_newAvailabilityZones)
     {
       ss << "NewAvailabilityZones.member." << newAvailabilityZonesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       newAvailabilityZonesCount++;
     }
   }
@@ -91,7 +92,7 @@ Aws::String ModifyCacheClusterRequest::SerializePayload() const
     for(auto& item : m_cacheSecurityGroupNames)
     {
       ss << "CacheSecurityGroupNames.member." << cacheSecurityGroupNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       cacheSecurityGroupNamesCount++;
     }
   }
@@ -102,29 +103,29 @@ Aws::String ModifyCacheClusterRequest::SerializePayload() const
     for(auto& item : m_securityGroupIds)
     {
       ss << "SecurityGroupIds.member." << securityGroupIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       securityGroupIdsCount++;
     }
   }
 
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
 
   if(m_notificationTopicArnHasBeenSet)
   {
-    ss << "NotificationTopicArn=" << StringUtils::URLEncode(m_notificationTopicArn.c_str()) << "&";
+    ss << "NotificationTopicArn=" << StringUtils::URLEncoded(m_notificationTopicArn) << "&";
   }
 
   if(m_cacheParameterGroupNameHasBeenSet)
   {
-    ss << "CacheParameterGroupName=" << StringUtils::URLEncode(m_cacheParameterGroupName.c_str()) << "&";
+    ss << "CacheParameterGroupName=" << StringUtils::URLEncoded(m_cacheParameterGroupName) << "&";
   }
 
   if(m_notificationTopicStatusHasBeenSet)
   {
-    ss << "NotificationTopicStatus=" << StringUtils::URLEncode(m_notificationTopicStatus.c_str()) << "&";
+    ss << "NotificationTopicStatus=" << StringUtils::URLEncoded(m_notificationTopicStatus) << "&";
   }
 
   if(m_applyImmediatelyHasBeenSet)
@@ -134,7 +135,7 @@ Aws::String ModifyCacheClusterRequest::SerializePayload() const
 
   if(m_engineVersionHasBeenSet)
   {
-    ss << "EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+    ss << "EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_autoMinorVersionUpgradeHasBeenSet)
@@ -149,15 +150,15 @@ Aws::String ModifyCacheClusterRequest::SerializePayload() const
 
   if(m_snapshotWindowHasBeenSet)
   {
-    ss << "SnapshotWindow=" << StringUtils::URLEncode(m_snapshotWindow.c_str()) << "&";
+    ss << "SnapshotWindow=" << StringUtils::URLEncoded(m_snapshotWindow) << "&";
   }
 
   if(m_cacheNodeTypeHasBeenSet)
   {
-    ss << "CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+    ss << "CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ModifyCacheClusterResult& ModifyCacheClusterResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyCacheClusterResult")
+  if (rootNode.GetNameView() != "ModifyCacheClusterResult")
   {
     resultNode = rootNode.FirstChild("ModifyCacheClusterResult");
   }
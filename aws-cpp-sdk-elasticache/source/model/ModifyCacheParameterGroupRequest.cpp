@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/ModifyCacheParameterGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ ModifyCacheParameterGroupRequest::ModifyCacheParameterGroupRequest() :
 
 Aws::String ModifyCacheParameterGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyCacheParameterGroup&";
   if(m_cacheParameterGroupNameHasBeenSet)
   {
-    ss << "CacheParameterGroupName=" << StringUtils::URLEncode(m_cacheParameterGroupName.c_str()) << "&";
+    ss << "CacheParameterGroupName=" << StringUtils::URLEncoded(m_cacheParameterGroupName) << "&";
   }
 
   if(m_parameterNameValuesHasBeenSet)
@@ -45,6 +46,6 @@ Aws::String ModifyCacheParameterGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
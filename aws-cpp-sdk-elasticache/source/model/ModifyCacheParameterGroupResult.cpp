@@ -40,7 +40,7 @@ ModifyCacheParameterGroupResult& ModifyCacheParameterGroupResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyCacheParameterGroupResult")
+  if (rootNode.GetNameView() != "ModifyCacheParameterGroupResult")
   {
     resultNode = rootNode.FirstChild("ModifyCacheParameterGroupResult");
   }
@@ -50,7 +50,7 @@ ModifyCacheParameterGroupResult& ModifyCacheParameterGroupResult::operator =(con
     XmlNode cacheParameterGroupNameNode = resultNode.FirstChild("CacheParameterGroupName");
     if(!cacheParameterGroupNameNode.IsNull())
     {
-      m_cacheParameterGroupName = StringUtils::Trim(cacheParameterGroupNameNode.GetText().c_str());
+      m_cacheParameterGroupName = cacheParameterGroupNameNode.GetTextView().Trim().ToString();
     }
   }
 
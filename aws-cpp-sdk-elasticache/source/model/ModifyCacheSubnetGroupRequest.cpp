@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/ModifyCacheSubnetGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ ModifyCacheSubnetGroupRequest::ModifyCacheSubnetGroupRequest() :
 
 Aws::String ModifyCacheSubnetGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyCacheSubnetGroup&";
   if(m_cacheSubnetGroupNameHasBeenSet)
   {
-    ss << "CacheSubnetGroupName=" << StringUtils::URLEncode(m_cacheSubnetGroupName.c_str()) << "&";
+    ss << "CacheSubnetGroupName=" << StringUtils::URLEncoded(m_cacheSubnetGroupName) << "&";
   }
 
   if(m_cacheSubnetGroupDescriptionHasBeenSet)
   {
-    ss << "CacheSubnetGroupDescription=" << StringUtils::URLEncode(m_cacheSubnetGroupDescription.c_str()) << "&";
+    ss << "CacheSubnetGroupDescription=" << StringUtils::URLEncoded(m_cacheSubnetGroupDescription) << "&";
   }
 
   if(m_subnetIdsHasBeenSet)
@@ -46,12 +47,12 @@ Aws::String ModifyCacheSubnetGroupRequest::SerializePayload() const
     for(auto& item : m_subnetIds)
     {
       ss << "SubnetIds.member." << subnetIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       subnetIdsCount++;
     }
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
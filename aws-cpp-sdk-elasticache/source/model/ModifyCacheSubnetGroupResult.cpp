@@ -40,7 +40,7 @@ ModifyCacheSubnetGroupResult& ModifyCacheSubnetGroupResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyCacheSubnetGroupResult")
+  if (rootNode.GetNameView() != "ModifyCacheSubnetGroupResult")
   {
     resultNode = rootNode.FirstChild("ModifyCacheSubnetGroupResult");
   }
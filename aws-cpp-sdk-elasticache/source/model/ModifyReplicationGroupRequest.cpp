@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/ModifyReplicationGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -46,26 +47,26 @@ ModifyReplicationGroupRequest::ModifyReplicationGroupRequest() :
 
 Aws::String ModifyReplicationGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyReplicationGroup&";
   if(m_replicationGroupIdHasBeenSet)
   {
-    ss << "ReplicationGroupId=" << StringUtils::URLEncode(m_replicationGroupId.c_str()) << "&";
+    ss << "ReplicationGroupId=" << StringUtils::URLEncoded(m_replicationGroupId) << "&";
   }
 
   if(m_replicationGroupDescriptionHasBeenSet)
   {
-    ss << "ReplicationGroupDescription=" << StringUtils::URLEncode(m_replicationGroupDescription.c_str()) << "&";
+    ss << "ReplicationGroupDescription=" << StringUtils::URLEncoded(m_replicationGroupDescription) << "&";
   }
 
   if(m_primaryClusterIdHasBeenSet)
   {
-    ss << "PrimaryClusterId=" << StringUtils::URLEncode(m_primaryClusterId.c_str()) << "&";
+    ss << "PrimaryClusterId=" << StringUtils::URLEncoded(m_primaryClusterId) << "&";
   }
 
   if(m_snapshottingClusterIdHasBeenSet)
   {
-    ss << "SnapshottingClusterId=" << StringUtils::URLEncode(m_snapshottingClusterId.c_str()) << "&";
+    ss << "SnapshottingClusterId=" << StringUtils::URLEncoded(m_snapshottingClusterId) << "&";
   }
 
   if(m_automaticFailoverEnabledHasBeenSet)
@@ -79,7 +80,7 @@ Aws::String ModifyReplicationGroupRequest::SerializePayload() const
     for(auto& item : m_cacheSecurityGroupNames)
     {
       ss << "CacheSecurityGroupNames.member." << cacheSecurityGroupNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       cacheSecurityGroupNamesCount++;
     }
   }
@@ -90,29 +91,29 @@ Aws::String ModifyReplicationGroupRequest::SerializePayload() const
     for(auto& item : m_securityGroupIds)
     {
       ss << "SecurityGroupIds.member." << securityGroupIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       securityGroupIdsCount++;
     }
   }
 
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
 
   if(m_notificationTopicArnHasBeenSet)
   {
-    ss << "NotificationTopicArn=" << StringUtils::URLEncode(m_notificationTopicArn.c_str()) << "&";
+    ss << "NotificationTopicArn=" << StringUtils::URLEncoded(m_notificationTopicArn) << "&";
   }
 
   if(m_cacheParameterGroupNameHasBeenSet)
   {
-    ss << "CacheParameterGroupName=" << StringUtils::URLEncode(m_cacheParameterGroupName.c_str()) << "&";
+    ss << "CacheParameterGroupName=" << StringUtils::URLEncoded(m_cacheParameterGroupName) << "&";
   }
 
   if(m_notificationTopicStatusHasBeenSet)
   {
-    ss << "NotificationTopicStatus=" << StringUtils::URLEncode(m_notificationTopicStatus.c_str()) << "&";
+    ss << "NotificationTopicStatus=" << StringUtils::URLEncoded(m_notificationTopicStatus) << "&";
   }
 
   if(m_applyImmediatelyHasBeenSet)
@@ -122,7 +123,7 @@ Aws::String ModifyReplicationGroupRequest::SerializePayload() const
 
   if(m_engineVersionHasBeenSet)
   {
-    ss << "EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+    ss << "EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_autoMinorVersionUpgradeHasBeenSet)
@@ -137,15 +138,15 @@ Aws::String ModifyReplicationGroupRequest::SerializePayload() const
 
   if(m_snapshotWindowHasBeenSet)
   {
-    ss << "SnapshotWindow=" << StringUtils::URLEncode(m_snapshotWindow.c_str()) << "&";
+    ss << "SnapshotWindow=" << StringUtils::URLEncoded(m_snapshotWindow) << "&";
   }
 
   if(m_cacheNodeTypeHasBeenSet)
   {
-    ss << "CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+    ss << "CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
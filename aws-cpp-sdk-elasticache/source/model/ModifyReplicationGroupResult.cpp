@@ -40,7 +40,7 @@ ModifyReplicationGroupResult& ModifyReplicationGroupResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyReplicationGroupResult")
+  if (rootNode.GetNameView() != "ModifyReplicationGroupResult")
   {
     resultNode = rootNode.FirstChild("ModifyReplicationGroupResult");
   }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -55,13 +56,13 @@ NodeGroup& NodeGroup::operator =(const XmlNode& xmlNode)
     XmlNode nodeGroupIdNode = resultNode.FirstChild("NodeGroupId");
     if(!nodeGroupIdNode.IsNull())
     {
-      m_nodeGroupId = StringUtils::Trim(nodeGroupIdNode.GetText().c_str());
+      m_nodeGroupId = nodeGroupIdNode.GetTextView().Trim().ToString();
       m_nodeGroupIdHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode primaryEndpointNode = resultNode.FirstChild("PrimaryEndpoint");
@@ -91,19 +92,19 @@ void NodeGroup::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 {
   if(m_nodeGroupIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NodeGroupId=" << StringUtils::URLEncode(m_nodeGroupId.c_str()) << "&";
+      oStream << location << index << locationValue << ".NodeGroupId=" << StringUtils::URLEncoded(m_nodeGroupId) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_primaryEndpointHasBeenSet)
   {
-      Aws::StringStream primaryEndpointLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream primaryEndpointLocationAndMemberSs;
       primaryEndpointLocationAndMemberSs << location << index << locationValue << ".PrimaryEndpoint";
-      m_primaryEndpoint.OutputToStream(oStream, primaryEndpointLocationAndMemberSs.str().c_str());
+      m_primaryEndpoint.OutputToStream(oStream, primaryEndpointLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_nodeGroupMembersHasBeenSet)
@@ -111,9 +112,9 @@ void NodeGroup::OutputToStream(Aws::OStream& oStream, const char* location, unsi
       unsigned nodeGroupMembersIdx = 1;
       for(auto& item : m_nodeGroupMembers)
       {
-        Aws::StringStream nodeGroupMembersSs;
+        Aws::Utils::Stream::StringOutputStream nodeGroupMembersSs;
         nodeGroupMembersSs << location << index << locationValue << ".NodeGroupMember." << nodeGroupMembersIdx++;
-        item.OutputToStream(oStream, nodeGroupMembersSs.str().c_str());
+        item.OutputToStream(oStream, nodeGroupMembersSs.GetString().c_str());
       }
   }
 
@@ -123,11 +124,11 @@ void NodeGroup::OutputToStream(Aws::OStream& oStream, const char* location) cons
 {
   if(m_nodeGroupIdHasBeenSet)
   {
-      oStream << location << ".NodeGroupId=" << StringUtils::URLEncode(m_nodeGroupId.c_str()) << "&";
+      oStream << location << ".NodeGroupId=" << StringUtils::URLEncoded(m_nodeGroupId) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_primaryEndpointHasBeenSet)
   {
@@ -140,9 +141,9 @@ void NodeGroup::OutputToStream(Aws::OStream& oStream, const char* location) cons
       unsigned nodeGroupMembersIdx = 1;
       for(auto& item : m_nodeGroupMembers)
       {
-        Aws::StringStream nodeGroupMembersSs;
+        Aws::Utils::Stream::StringOutputStream nodeGroupMembersSs;
         nodeGroupMembersSs << location <<  ".NodeGroupMember." << nodeGroupMembersIdx++;
-        item.OutputToStream(oStream, nodeGroupMembersSs.str().c_str());
+        item.OutputToStream(oStream, nodeGroupMembersSs.GetString().c_str());
       }
   }
 }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -57,13 +58,13 @@ NodeGroupMember& NodeGroupMember::operator =(const XmlNode& xmlNode)
     XmlNode cacheClusterIdNode = resultNode.FirstChild("CacheClusterId");
     if(!cacheClusterIdNode.IsNull())
     {
-      m_cacheClusterId = StringUtils::Trim(cacheClusterIdNode.GetText().c_str());
+      m_cacheClusterId = cacheClusterIdNode.GetTextView().Trim().ToString();
       m_cacheClusterIdHasBeenSet = true;
     }
     XmlNode cacheNodeIdNode = resultNode.FirstChild("CacheNodeId");
     if(!cacheNodeIdNode.IsNull())
     {
-      m_cacheNodeId = StringUtils::Trim(cacheNodeIdNode.GetText().c_str());
+      m_cacheNodeId = cacheNodeIdNode.GetTextView().Trim().ToString();
       m_cacheNodeIdHasBeenSet = true;
     }
     XmlNode readEndpointNode = resultNode.FirstChild("ReadEndpoint");
@@ -75,13 +76,13 @@ NodeGroupMember& NodeGroupMember::operator =(const XmlNode& xmlNode)
     XmlNode preferredAvailabilityZoneNode = resultNode.FirstChild("PreferredAvailabilityZone");
     if(!preferredAvailabilityZoneNode.IsNull())
     {
-      m_preferredAvailabilityZone = StringUtils::Trim(preferredAvailabilityZoneNode.GetText().c_str());
+      m_preferredAvailabilityZone = preferredAvailabilityZoneNode.GetTextView().Trim().ToString();
       m_preferredAvailabilityZoneHasBeenSet = true;
     }
     XmlNode currentRoleNode = resultNode.FirstChild("CurrentRole");
     if(!currentRoleNode.IsNull())
     {
-      m_currentRole = StringUtils::Trim(currentRoleNode.GetText().c_str());
+      m_currentRole = currentRoleNode.GetTextView().Trim().ToString();
       m_currentRoleHasBeenSet = true;
     }
   }
@@ -93,29 +94,29 @@ void NodeGroupMember::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_cacheClusterIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheClusterId=" << StringUtils::URLEncode(m_cacheClusterId.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheClusterId=" << StringUtils::URLEncoded(m_cacheClusterId) << "&";
   }
 
   if(m_cacheNodeIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheNodeId=" << StringUtils::URLEncode(m_cacheNodeId.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheNodeId=" << StringUtils::URLEncoded(m_cacheNodeId) << "&";
   }
 
   if(m_readEndpointHasBeenSet)
   {
-      Aws::StringStream readEndpointLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream readEndpointLocationAndMemberSs;
       readEndpointLocationAndMemberSs << location << index << locationValue << ".ReadEndpoint";
-      m_readEndpoint.OutputToStream(oStream, readEndpointLocationAndMemberSs.str().c_str());
+      m_readEndpoint.OutputToStream(oStream, readEndpointLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_preferredAvailabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PreferredAvailabilityZone=" << StringUtils::URLEncode(m_preferredAvailabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".PreferredAvailabilityZone=" << StringUtils::URLEncoded(m_preferredAvailabilityZone) << "&";
   }
 
   if(m_currentRoleHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CurrentRole=" << StringUtils::URLEncode(m_currentRole.c_str()) << "&";
+      oStream << location << index << locationValue << ".CurrentRole=" << StringUtils::URLEncoded(m_currentRole) << "&";
   }
 
 }
@@ -124,11 +125,11 @@ void NodeGroupMember::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_cacheClusterIdHasBeenSet)
   {
-      oStream << location << ".CacheClusterId=" << StringUtils::URLEncode(m_cacheClusterId.c_str()) << "&";
+      oStream << location << ".CacheClusterId=" << StringUtils::URLEncoded(m_cacheClusterId) << "&";
   }
   if(m_cacheNodeIdHasBeenSet)
   {
-      oStream << location << ".CacheNodeId=" << StringUtils::URLEncode(m_cacheNodeId.c_str()) << "&";
+      oStream << location << ".CacheNodeId=" << StringUtils::URLEncoded(m_cacheNodeId) << "&";
   }
   if(m_readEndpointHasBeenSet)
   {
@@ -138,11 +139,11 @@ void NodeGroupMember::OutputToStream(Aws::OStream& oStream, const char* location
   }
   if(m_preferredAvailabilityZoneHasBeenSet)
   {
-      oStream << location << ".PreferredAvailabilityZone=" << StringUtils::URLEncode(m_preferredAvailabilityZone.c_str()) << "&";
+      oStream << location << ".PreferredAvailabilityZone=" << StringUtils::URLEncoded(m_preferredAvailabilityZone) << "&";
   }
   if(m_currentRoleHasBeenSet)
   {
-      oStream << location << ".CurrentRole=" << StringUtils::URLEncode(m_currentRole.c_str()) << "&";
+      oStream << location << ".CurrentRole=" << StringUtils::URLEncoded(m_currentRole) << "&";
   }
 }
 
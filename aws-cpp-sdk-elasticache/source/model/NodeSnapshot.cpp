@@ -55,25 +55,25 @@ NodeSnapshot& NodeSnapshot::operator =(const XmlNode& xmlNode)
     XmlNode cacheNodeIdNode = resultNode.FirstChild("CacheNodeId");
     if(!cacheNodeIdNode.IsNull())
     {
-      m_cacheNodeId = StringUtils::Trim(cacheNodeIdNode.GetText().c_str());
+      m_cacheNodeId = cacheNodeIdNode.GetTextView().Trim().ToString();
       m_cacheNodeIdHasBeenSet = true;
     }
     XmlNode cacheSizeNode = resultNode.FirstChild("CacheSize");
     if(!cacheSizeNode.IsNull())
     {
-      m_cacheSize = StringUtils::Trim(cacheSizeNode.GetText().c_str());
+      m_cacheSize = cacheSizeNode.GetTextView().Trim().ToString();
       m_cacheSizeHasBeenSet = true;
     }
     XmlNode cacheNodeCreateTimeNode = resultNode.FirstChild("CacheNodeCreateTime");
     if(!cacheNodeCreateTimeNode.IsNull())
     {
-      m_cacheNodeCreateTime = DateTime(StringUtils::Trim(cacheNodeCreateTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_cacheNodeCreateTime = DateTime(cacheNodeCreateTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_cacheNodeCreateTimeHasBeenSet = true;
     }
     XmlNode snapshotCreateTimeNode = resultNode.FirstChild("SnapshotCreateTime");
     if(!snapshotCreateTimeNode.IsNull())
     {
-      m_snapshotCreateTime = DateTime(StringUtils::Trim(snapshotCreateTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_snapshotCreateTime = DateTime(snapshotCreateTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_snapshotCreateTimeHasBeenSet = true;
     }
   }
@@ -85,22 +85,22 @@ void NodeSnapshot::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_cacheNodeIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheNodeId=" << StringUtils::URLEncode(m_cacheNodeId.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheNodeId=" << StringUtils::URLEncoded(m_cacheNodeId) << "&";
   }
 
   if(m_cacheSizeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheSize=" << StringUtils::URLEncode(m_cacheSize.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheSize=" << StringUtils::URLEncoded(m_cacheSize) << "&";
   }
 
   if(m_cacheNodeCreateTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheNodeCreateTime=" << StringUtils::URLEncode(m_cacheNodeCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheNodeCreateTime=" << StringUtils::URLEncoded(m_cacheNodeCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_snapshotCreateTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotCreateTime=" << StringUtils::URLEncode(m_snapshotCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotCreateTime=" << StringUtils::URLEncoded(m_snapshotCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -109,19 +109,19 @@ void NodeSnapshot::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_cacheNodeIdHasBeenSet)
   {
-      oStream << location << ".CacheNodeId=" << StringUtils::URLEncode(m_cacheNodeId.c_str()) << "&";
+      oStream << location << ".CacheNodeId=" << StringUtils::URLEncoded(m_cacheNodeId) << "&";
   }
   if(m_cacheSizeHasBeenSet)
   {
-      oStream << location << ".CacheSize=" << StringUtils::URLEncode(m_cacheSize.c_str()) << "&";
+      oStream << location << ".CacheSize=" << StringUtils::URLEncoded(m_cacheSize) << "&";
   }
   if(m_cacheNodeCreateTimeHasBeenSet)
   {
-      oStream << location << ".CacheNodeCreateTime=" << StringUtils::URLEncode(m_cacheNodeCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CacheNodeCreateTime=" << StringUtils::URLEncoded(m_cacheNodeCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_snapshotCreateTimeHasBeenSet)
   {
-      oStream << location << ".SnapshotCreateTime=" << StringUtils::URLEncode(m_snapshotCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".SnapshotCreateTime=" << StringUtils::URLEncoded(m_snapshotCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
@@ -51,13 +51,13 @@ NotificationConfiguration& NotificationConfiguration::operator =(const XmlNode&
     XmlNode topicArnNode = resultNode.FirstChild("TopicArn");
     if(!topicArnNode.IsNull())
     {
-      m_topicArn = StringUtils::Trim(topicArnNode.GetText().c_str());
+      m_topicArn = topicArnNode.GetTextView().Trim().ToString();
       m_topicArnHasBeenSet = true;
     }
     XmlNode topicStatusNode = resultNode.FirstChild("TopicStatus");
     if(!topicStatusNode.IsNull())
     {
-      m_topicStatus = StringUtils::Trim(topicStatusNode.GetText().c_str());
+      m_topicStatus = topicStatusNode.GetTextView().Trim().ToString();
       m_topicStatusHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void NotificationConfiguration::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
   if(m_topicStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TopicStatus=" << StringUtils::URLEncode(m_topicStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".TopicStatus=" << StringUtils::URLEncoded(m_topicStatus) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void NotificationConfiguration::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
   if(m_topicStatusHasBeenSet)
   {
-      oStream << location << ".TopicStatus=" << StringUtils::URLEncode(m_topicStatus.c_str()) << "&";
+      oStream << location << ".TopicStatus=" << StringUtils::URLEncoded(m_topicStatus) << "&";
   }
 }
 
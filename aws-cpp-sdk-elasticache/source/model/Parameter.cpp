@@ -67,55 +67,55 @@ Parameter& Parameter::operator =(const XmlNode& xmlNode)
     XmlNode parameterNameNode = resultNode.FirstChild("ParameterName");
     if(!parameterNameNode.IsNull())
     {
-      m_parameterName = StringUtils::Trim(parameterNameNode.GetText().c_str());
+      m_parameterName = parameterNameNode.GetTextView().Trim().ToString();
       m_parameterNameHasBeenSet = true;
     }
     XmlNode parameterValueNode = resultNode.FirstChild("ParameterValue");
     if(!parameterValueNode.IsNull())
     {
-      m_parameterValue = StringUtils::Trim(parameterValueNode.GetText().c_str());
+      m_parameterValue = parameterValueNode.GetTextView().Trim().ToString();
       m_parameterValueHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode sourceNode = resultNode.FirstChild("Source");
     if(!sourceNode.IsNull())
     {
-      m_source = StringUtils::Trim(sourceNode.GetText().c_str());
+      m_source = sourceNode.GetTextView().Trim().ToString();
       m_sourceHasBeenSet = true;
     }
     XmlNode dataTypeNode = resultNode.FirstChild("DataType");
     if(!dataTypeNode.IsNull())
     {
-      m_dataType = StringUtils::Trim(dataTypeNode.GetText().c_str());
+      m_dataType = dataTypeNode.GetTextView().Trim().ToString();
       m_dataTypeHasBeenSet = true;
     }
     XmlNode allowedValuesNode = resultNode.FirstChild("AllowedValues");
     if(!allowedValuesNode.IsNull())
     {
-      m_allowedValues = StringUtils::Trim(allowedValuesNode.GetText().c_str());
+      m_allowedValues = allowedValuesNode.GetTextView().Trim().ToString();
       m_allowedValuesHasBeenSet = true;
     }
     XmlNode isModifiableNode = resultNode.FirstChild("IsModifiable");
     if(!isModifiableNode.IsNull())
     {
-      m_isModifiable = StringUtils::ConvertToBool(StringUtils::Trim(isModifiableNode.GetText().c_str()).c_str());
+      m_isModifiable = StringUtils::ConvertToBool(isModifiableNode.GetTextView().Trim().ToString().c_str());
       m_isModifiableHasBeenSet = true;
     }
     XmlNode minimumEngineVersionNode = resultNode.FirstChild("MinimumEngineVersion");
     if(!minimumEngineVersionNode.IsNull())
     {
-      m_minimumEngineVersion = StringUtils::Trim(minimumEngineVersionNode.GetText().c_str());
+      m_minimumEngineVersion = minimumEngineVersionNode.GetTextView().Trim().ToString();
       m_minimumEngineVersionHasBeenSet = true;
     }
     XmlNode changeTypeNode = resultNode.FirstChild("ChangeType");
     if(!changeTypeNode.IsNull())
     {
-      m_changeType = ChangeTypeMapper::GetChangeTypeForName(StringUtils::Trim(changeTypeNode.GetText().c_str()).c_str());
+      m_changeType = ChangeTypeMapper::GetChangeTypeForName(changeTypeNode.GetTextView().Trim().ToString().c_str());
       m_changeTypeHasBeenSet = true;
     }
   }
@@ -127,32 +127,32 @@ void Parameter::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 {
   if(m_parameterNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterName=" << StringUtils::URLEncode(m_parameterName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterName=" << StringUtils::URLEncoded(m_parameterName) << "&";
   }
 
   if(m_parameterValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterValue=" << StringUtils::URLEncode(m_parameterValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterValue=" << StringUtils::URLEncoded(m_parameterValue) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_sourceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Source=" << StringUtils::URLEncode(m_source.c_str()) << "&";
+      oStream << location << index << locationValue << ".Source=" << StringUtils::URLEncoded(m_source) << "&";
   }
 
   if(m_dataTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DataType=" << StringUtils::URLEncode(m_dataType.c_str()) << "&";
+      oStream << location << index << locationValue << ".DataType=" << StringUtils::URLEncoded(m_dataType) << "&";
   }
 
   if(m_allowedValuesHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AllowedValues=" << StringUtils::URLEncode(m_allowedValues.c_str()) << "&";
+      oStream << location << index << locationValue << ".AllowedValues=" << StringUtils::URLEncoded(m_allowedValues) << "&";
   }
 
   if(m_isModifiableHasBeenSet)
@@ -162,7 +162,7 @@ void Parameter::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 
   if(m_minimumEngineVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MinimumEngineVersion=" << StringUtils::URLEncode(m_minimumEngineVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".MinimumEngineVersion=" << StringUtils::URLEncoded(m_minimumEngineVersion) << "&";
   }
 
   if(m_changeTypeHasBeenSet)
@@ -176,27 +176,27 @@ void Parameter::OutputToStream(Aws::OStream& oStream, const char* location) cons
 {
   if(m_parameterNameHasBeenSet)
   {
-      oStream << location << ".ParameterName=" << StringUtils::URLEncode(m_parameterName.c_str()) << "&";
+      oStream << location << ".ParameterName=" << StringUtils::URLEncoded(m_parameterName) << "&";
   }
   if(m_parameterValueHasBeenSet)
   {
-      oStream << location << ".ParameterValue=" << StringUtils::URLEncode(m_parameterValue.c_str()) << "&";
+      oStream << location << ".ParameterValue=" << StringUtils::URLEncoded(m_parameterValue) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_sourceHasBeenSet)
   {
-      oStream << location << ".Source=" << StringUtils::URLEncode(m_source.c_str()) << "&";
+      oStream << location << ".Source=" << StringUtils::URLEncoded(m_source) << "&";
   }
   if(m_dataTypeHasBeenSet)
   {
-      oStream << location << ".DataType=" << StringUtils::URLEncode(m_dataType.c_str()) << "&";
+      oStream << location << ".DataType=" << StringUtils::URLEncoded(m_dataType) << "&";
   }
   if(m_allowedValuesHasBeenSet)
   {
-      oStream << location << ".AllowedValues=" << StringUtils::URLEncode(m_allowedValues.c_str()) << "&";
+      oStream << location << ".AllowedValues=" << StringUtils::URLEncoded(m_allowedValues) << "&";
   }
   if(m_isModifiableHasBeenSet)
   {
@@ -204,7 +204,7 @@ void Parameter::OutputToStream(Aws::OStream& oStream, const char* location) cons
   }
   if(m_minimumEngineVersionHasBeenSet)
   {
-      oStream << location << ".MinimumEngineVersion=" << StringUtils::URLEncode(m_minimumEngineVersion.c_str()) << "&";
+      oStream << location << ".MinimumEngineVersion=" << StringUtils::URLEncoded(m_minimumEngineVersion) << "&";
   }
   if(m_changeTypeHasBeenSet)
   {
@@ -51,13 +51,13 @@ ParameterNameValue& ParameterNameValue::operator =(const XmlNode& xmlNode)
     XmlNode parameterNameNode = resultNode.FirstChild("ParameterName");
     if(!parameterNameNode.IsNull())
     {
-      m_parameterName = StringUtils::Trim(parameterNameNode.GetText().c_str());
+      m_parameterName = parameterNameNode.GetTextView().Trim().ToString();
       m_parameterNameHasBeenSet = true;
     }
     XmlNode parameterValueNode = resultNode.FirstChild("ParameterValue");
     if(!parameterValueNode.IsNull())
     {
-      m_parameterValue = StringUtils::Trim(parameterValueNode.GetText().c_str());
+      m_parameterValue = parameterValueNode.GetTextView().Trim().ToString();
       m_parameterValueHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void ParameterNameValue::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_parameterNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterName=" << StringUtils::URLEncode(m_parameterName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterName=" << StringUtils::URLEncoded(m_parameterName) << "&";
   }
 
   if(m_parameterValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterValue=" << StringUtils::URLEncode(m_parameterValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterValue=" << StringUtils::URLEncoded(m_parameterValue) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void ParameterNameValue::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_parameterNameHasBeenSet)
   {
-      oStream << location << ".ParameterName=" << StringUtils::URLEncode(m_parameterName.c_str()) << "&";
+      oStream << location << ".ParameterName=" << StringUtils::URLEncoded(m_parameterName) << "&";
   }
   if(m_parameterValueHasBeenSet)
   {
-      oStream << location << ".ParameterValue=" << StringUtils::URLEncode(m_parameterValue.c_str()) << "&";
+      oStream << location << ".ParameterValue=" << StringUtils::URLEncoded(m_parameterValue) << "&";
   }
 }
 
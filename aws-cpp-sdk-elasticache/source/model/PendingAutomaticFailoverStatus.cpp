@@ -29,21 +29,29 @@ namespace Aws
       namespace PendingAutomaticFailoverStatusMapper
       {
 
-        static const int enabled_HASH = HashingUtils::HashString("enabled");
-        static const int disabled_HASH = HashingUtils::HashString("disabled");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int enabled_HASH = -1609594047;
+        static const int disabled_HASH = 270940796;
 
 
         PendingAutomaticFailoverStatus GetPendingAutomaticFailoverStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == enabled_HASH)
+          switch (hashCode)
           {
+          case enabled_HASH:
             return PendingAutomaticFailoverStatus::enabled;
-          }
-          else if (hashCode == disabled_HASH)
-          {
+          case disabled_HASH:
             return PendingAutomaticFailoverStatus::disabled;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -57,7 +57,7 @@ PendingModifiedValues& PendingModifiedValues::operator =(const XmlNode& xmlNode)
     XmlNode numCacheNodesNode = resultNode.FirstChild("NumCacheNodes");
     if(!numCacheNodesNode.IsNull())
     {
-      m_numCacheNodes = StringUtils::ConvertToInt32(StringUtils::Trim(numCacheNodesNode.GetText().c_str()).c_str());
+      m_numCacheNodes = StringUtils::ConvertToInt32(numCacheNodesNode.GetTextView().Trim().ToString().c_str());
       m_numCacheNodesHasBeenSet = true;
     }
     XmlNode cacheNodeIdsToRemoveNode = resultNode.FirstChild("CacheNodeIdsToRemove");
@@ -66,7 +66,7 @@ PendingModifiedValues& PendingModifiedValues::operator =(const XmlNode& xmlNode)
       XmlNode cacheNodeIdsToRemoveMember = cacheNodeIdsToRemoveNode.FirstChild("CacheNodeId");
       while(!cacheNodeIdsToRemoveMember.IsNull())
       {
-        m_cacheNodeIdsToRemove.push_back(StringUtils::Trim(cacheNodeIdsToRemoveMember.GetText().c_str()));
+        m_cacheNodeIdsToRemove.push_back(cacheNodeIdsToRemoveMember.GetTextView().Trim().ToString());
         cacheNodeIdsToRemoveMember = cacheNodeIdsToRemoveMember.NextNode("CacheNodeId");
       }
 
@@ -75,13 +75,13 @@ PendingModifiedValues& PendingModifiedValues::operator =(const XmlNode& xmlNode)
     XmlNode engineVersionNode = resultNode.FirstChild("EngineVersion");
     if(!engineVersionNode.IsNull())
     {
-      m_engineVersion = StringUtils::Trim(engineVersionNode.GetText().c_str());
+      m_engineVersion = engineVersionNode.GetTextView().Trim().ToString();
       m_engineVersionHasBeenSet = true;
     }
     XmlNode cacheNodeTypeNode = resultNode.FirstChild("CacheNodeType");
     if(!cacheNodeTypeNode.IsNull())
     {
-      m_cacheNodeType = StringUtils::Trim(cacheNodeTypeNode.GetText().c_str());
+      m_cacheNodeType = cacheNodeTypeNode.GetTextView().Trim().ToString();
       m_cacheNodeTypeHasBeenSet = true;
     }
   }
@@ -101,18 +101,18 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
       unsigned cacheNodeIdsToRemoveIdx = 1;
       for(auto& item : m_cacheNodeIdsToRemove)
       {
-        oStream << location << index << locationValue << ".CacheNodeId." << cacheNodeIdsToRemoveIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".CacheNodeId." << cacheNodeIdsToRemoveIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_cacheNodeTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
 
 }
@@ -128,16 +128,16 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
       unsigned cacheNodeIdsToRemoveIdx = 1;
       for(auto& item : m_cacheNodeIdsToRemove)
       {
-        oStream << location << ".CacheNodeId." << cacheNodeIdsToRemoveIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".CacheNodeId." << cacheNodeIdsToRemoveIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
   if(m_cacheNodeTypeHasBeenSet)
   {
-      oStream << location << ".CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+      oStream << location << ".CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
 }
 
@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/PurchaseReservedCacheNodesOfferingRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ PurchaseReservedCacheNodesOfferingRequest::PurchaseReservedCacheNodesOfferingReq
 
 Aws::String PurchaseReservedCacheNodesOfferingRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=PurchaseReservedCacheNodesOffering&";
   if(m_reservedCacheNodesOfferingIdHasBeenSet)
   {
-    ss << "ReservedCacheNodesOfferingId=" << StringUtils::URLEncode(m_reservedCacheNodesOfferingId.c_str()) << "&";
+    ss << "ReservedCacheNodesOfferingId=" << StringUtils::URLEncoded(m_reservedCacheNodesOfferingId) << "&";
   }
 
   if(m_reservedCacheNodeIdHasBeenSet)
   {
-    ss << "ReservedCacheNodeId=" << StringUtils::URLEncode(m_reservedCacheNodeId.c_str()) << "&";
+    ss << "ReservedCacheNodeId=" << StringUtils::URLEncoded(m_reservedCacheNodeId) << "&";
   }
 
   if(m_cacheNodeCountHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String PurchaseReservedCacheNodesOfferingRequest::SerializePayload() const
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
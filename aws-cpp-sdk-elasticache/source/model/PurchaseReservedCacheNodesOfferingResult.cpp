@@ -40,7 +40,7 @@ PurchaseReservedCacheNodesOfferingResult& PurchaseReservedCacheNodesOfferingResu
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "PurchaseReservedCacheNodesOfferingResult")
+  if (rootNode.GetNameView() != "PurchaseReservedCacheNodesOfferingResult")
   {
     resultNode = rootNode.FirstChild("PurchaseReservedCacheNodesOfferingResult");
   }
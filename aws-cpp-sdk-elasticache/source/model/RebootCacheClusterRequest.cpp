@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/RebootCacheClusterRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ RebootCacheClusterRequest::RebootCacheClusterRequest() :
 
 Aws::String RebootCacheClusterRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=RebootCacheCluster&";
   if(m_cacheClusterIdHasBeenSet)
   {
-    ss << "CacheClusterId=" << StringUtils::URLEncode(m_cacheClusterId.c_str()) << "&";
+    ss << "CacheClusterId=" << StringUtils::URLEncoded(m_cacheClusterId) << "&";
   }
 
   if(m_cacheNodeIdsToRebootHasBeenSet)
@@ -40,12 +41,12 @@ Aws::String RebootCacheClusterRequest::SerializePayload() const
     for(auto& item : m_cacheNodeIdsToReboot)
     {
       ss << "CacheNodeIdsToReboot.member." << cacheNodeIdsToRebootCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       cacheNodeIdsToRebootCount++;
     }
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
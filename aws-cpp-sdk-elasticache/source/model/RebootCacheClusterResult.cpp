@@ -40,7 +40,7 @@ RebootCacheClusterResult& RebootCacheClusterResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RebootCacheClusterResult")
+  if (rootNode.GetNameView() != "RebootCacheClusterResult")
   {
     resultNode = rootNode.FirstChild("RebootCacheClusterResult");
   }
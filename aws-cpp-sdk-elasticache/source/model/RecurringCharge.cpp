@@ -53,13 +53,13 @@ RecurringCharge& RecurringCharge::operator =(const XmlNode& xmlNode)
     XmlNode recurringChargeAmountNode = resultNode.FirstChild("RecurringChargeAmount");
     if(!recurringChargeAmountNode.IsNull())
     {
-      m_recurringChargeAmount = StringUtils::ConvertToDouble(StringUtils::Trim(recurringChargeAmountNode.GetText().c_str()).c_str());
+      m_recurringChargeAmount = StringUtils::ConvertToDouble(recurringChargeAmountNode.GetTextView().Trim().ToString().c_str());
       m_recurringChargeAmountHasBeenSet = true;
     }
     XmlNode recurringChargeFrequencyNode = resultNode.FirstChild("RecurringChargeFrequency");
     if(!recurringChargeFrequencyNode.IsNull())
     {
-      m_recurringChargeFrequency = StringUtils::Trim(recurringChargeFrequencyNode.GetText().c_str());
+      m_recurringChargeFrequency = recurringChargeFrequencyNode.GetTextView().Trim().ToString();
       m_recurringChargeFrequencyHasBeenSet = true;
     }
   }
@@ -76,7 +76,7 @@ void RecurringCharge::OutputToStream(Aws::OStream& oStream, const char* location
 
   if(m_recurringChargeFrequencyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RecurringChargeFrequency=" << StringUtils::URLEncode(m_recurringChargeFrequency.c_str()) << "&";
+      oStream << location << index << locationValue << ".RecurringChargeFrequency=" << StringUtils::URLEncoded(m_recurringChargeFrequency) << "&";
   }
 
 }
@@ -89,7 +89,7 @@ void RecurringCharge::OutputToStream(Aws::OStream& oStream, const char* location
   }
   if(m_recurringChargeFrequencyHasBeenSet)
   {
-      oStream << location << ".RecurringChargeFrequency=" << StringUtils::URLEncode(m_recurringChargeFrequency.c_str()) << "&";
+      oStream << location << ".RecurringChargeFrequency=" << StringUtils::URLEncoded(m_recurringChargeFrequency) << "&";
   }
 }
 
@@ -15,6 +15,7 @@
 #include <aws/elasticache/model/RemoveTagsFromResourceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElastiCache::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ RemoveTagsFromResourceRequest::RemoveTagsFromResourceRequest() :
 
 Aws::String RemoveTagsFromResourceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=RemoveTagsFromResource&";
   if(m_resourceNameHasBeenSet)
   {
-    ss << "ResourceName=" << StringUtils::URLEncode(m_resourceName.c_str()) << "&";
+    ss << "ResourceName=" << StringUtils::URLEncoded(m_resourceName) << "&";
   }
 
   if(m_tagKeysHasBeenSet)
@@ -40,12 +41,12 @@ Aws::String RemoveTagsFromResourceRequest::SerializePayload() const
     for(auto& item : m_tagKeys)
     {
       ss << "TagKeys.member." << tagKeysCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       tagKeysCount++;
     }
   }
 
   ss << "Version=2015-02-02";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ RemoveTagsFromResourceResult& RemoveTagsFromResourceResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RemoveTagsFromResourceResult")
+  if (rootNode.GetNameView() != "RemoveTagsFromResourceResult")
   {
     resultNode = rootNode.FirstChild("RemoveTagsFromResourceResult");
   }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -63,19 +64,19 @@ ReplicationGroup& ReplicationGroup::operator =(const XmlNode& xmlNode)
     XmlNode replicationGroupIdNode = resultNode.FirstChild("ReplicationGroupId");
     if(!replicationGroupIdNode.IsNull())
     {
-      m_replicationGroupId = StringUtils::Trim(replicationGroupIdNode.GetText().c_str());
+      m_replicationGroupId = replicationGroupIdNode.GetTextView().Trim().ToString();
       m_replicationGroupIdHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode pendingModifiedValuesNode = resultNode.FirstChild("PendingModifiedValues");
@@ -90,7 +91,7 @@ ReplicationGroup& ReplicationGroup::operator =(const XmlNode& xmlNode)
       XmlNode memberClustersMember = memberClustersNode.FirstChild("ClusterId");
       while(!memberClustersMember.IsNull())
       {
-        m_memberClusters.push_back(StringUtils::Trim(memberClustersMember.GetText().c_str()));
+        m_memberClusters.push_back(memberClustersMember.GetTextView().Trim().ToString());
         memberClustersMember = memberClustersMember.NextNode("ClusterId");
       }
 
@@ -111,13 +112,13 @@ ReplicationGroup& ReplicationGroup::operator =(const XmlNode& xmlNode)
     XmlNode snapshottingClusterIdNode = resultNode.FirstChild("SnapshottingClusterId");
     if(!snapshottingClusterIdNode.IsNull())
     {
-      m_snapshottingClusterId = StringUtils::Trim(snapshottingClusterIdNode.GetText().c_str());
+      m_snapshottingClusterId = snapshottingClusterIdNode.GetTextView().Trim().ToString();
       m_snapshottingClusterIdHasBeenSet = true;
     }
     XmlNode automaticFailoverNode = resultNode.FirstChild("AutomaticFailover");
     if(!automaticFailoverNode.IsNull())
     {
-      m_automaticFailover = AutomaticFailoverStatusMapper::GetAutomaticFailoverStatusForName(StringUtils::Trim(automaticFailoverNode.GetText().c_str()).c_str());
+      m_automaticFailover = AutomaticFailoverStatusMapper::GetAutomaticFailoverStatusForName(automaticFailoverNode.GetTextView().Trim().ToString().c_str());
       m_automaticFailoverHasBeenSet = true;
     }
   }
@@ -129,24 +130,24 @@ void ReplicationGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_replicationGroupIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReplicationGroupId=" << StringUtils::URLEncode(m_replicationGroupId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReplicationGroupId=" << StringUtils::URLEncoded(m_replicationGroupId) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_pendingModifiedValuesHasBeenSet)
   {
-      Aws::StringStream pendingModifiedValuesLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream pendingModifiedValuesLocationAndMemberSs;
       pendingModifiedValuesLocationAndMemberSs << location << index << locationValue << ".PendingModifiedValues";
-      m_pendingModifiedValues.OutputToStream(oStream, pendingModifiedValuesLocationAndMemberSs.str().c_str());
+      m_pendingModifiedValues.OutputToStream(oStream, pendingModifiedValuesLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_memberClustersHasBeenSet)
@@ -154,7 +155,7 @@ void ReplicationGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned memberClustersIdx = 1;
       for(auto& item : m_memberClusters)
       {
-        oStream << location << index << locationValue << ".ClusterId." << memberClustersIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".ClusterId." << memberClustersIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -163,15 +164,15 @@ void ReplicationGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned nodeGroupsIdx = 1;
       for(auto& item : m_nodeGroups)
       {
-        Aws::StringStream nodeGroupsSs;
+        Aws::Utils::Stream::StringOutputStream nodeGroupsSs;
         nodeGroupsSs << location << index << locationValue << ".NodeGroup." << nodeGroupsIdx++;
-        item.OutputToStream(oStream, nodeGroupsSs.str().c_str());
+        item.OutputToStream(oStream, nodeGroupsSs.GetString().c_str());
       }
   }
 
   if(m_snapshottingClusterIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshottingClusterId=" << StringUtils::URLEncode(m_snapshottingClusterId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshottingClusterId=" << StringUtils::URLEncoded(m_snapshottingClusterId) << "&";
   }
 
   if(m_automaticFailoverHasBeenSet)
@@ -185,15 +186,15 @@ void ReplicationGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_replicationGroupIdHasBeenSet)
   {
-      oStream << location << ".ReplicationGroupId=" << StringUtils::URLEncode(m_replicationGroupId.c_str()) << "&";
+      oStream << location << ".ReplicationGroupId=" << StringUtils::URLEncoded(m_replicationGroupId) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_pendingModifiedValuesHasBeenSet)
   {
@@ -206,7 +207,7 @@ void ReplicationGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned memberClustersIdx = 1;
       for(auto& item : m_memberClusters)
       {
-        oStream << location << ".ClusterId." << memberClustersIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".ClusterId." << memberClustersIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_nodeGroupsHasBeenSet)
@@ -214,14 +215,14 @@ void ReplicationGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned nodeGroupsIdx = 1;
       for(auto& item : m_nodeGroups)
       {
-        Aws::StringStream nodeGroupsSs;
+        Aws::Utils::Stream::StringOutputStream nodeGroupsSs;
         nodeGroupsSs << location <<  ".NodeGroup." << nodeGroupsIdx++;
-        item.OutputToStream(oStream, nodeGroupsSs.str().c_str());
+        item.OutputToStream(oStream, nodeGroupsSs.GetString().c_str());
       }
   }
   if(m_snapshottingClusterIdHasBeenSet)
   {
-      oStream << location << ".SnapshottingClusterId=" << StringUtils::URLEncode(m_snapshottingClusterId.c_str()) << "&";
+      oStream << location << ".SnapshottingClusterId=" << StringUtils::URLEncoded(m_snapshottingClusterId) << "&";
   }
   if(m_automaticFailoverHasBeenSet)
   {
@@ -51,13 +51,13 @@ ReplicationGroupPendingModifiedValues& ReplicationGroupPendingModifiedValues::op
     XmlNode primaryClusterIdNode = resultNode.FirstChild("PrimaryClusterId");
     if(!primaryClusterIdNode.IsNull())
     {
-      m_primaryClusterId = StringUtils::Trim(primaryClusterIdNode.GetText().c_str());
+      m_primaryClusterId = primaryClusterIdNode.GetTextView().Trim().ToString();
       m_primaryClusterIdHasBeenSet = true;
     }
     XmlNode automaticFailoverStatusNode = resultNode.FirstChild("AutomaticFailoverStatus");
     if(!automaticFailoverStatusNode.IsNull())
     {
-      m_automaticFailoverStatus = PendingAutomaticFailoverStatusMapper::GetPendingAutomaticFailoverStatusForName(StringUtils::Trim(automaticFailoverStatusNode.GetText().c_str()).c_str());
+      m_automaticFailoverStatus = PendingAutomaticFailoverStatusMapper::GetPendingAutomaticFailoverStatusForName(automaticFailoverStatusNode.GetTextView().Trim().ToString().c_str());
       m_automaticFailoverStatusHasBeenSet = true;
     }
   }
@@ -69,7 +69,7 @@ void ReplicationGroupPendingModifiedValues::OutputToStream(Aws::OStream& oStream
 {
   if(m_primaryClusterIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrimaryClusterId=" << StringUtils::URLEncode(m_primaryClusterId.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrimaryClusterId=" << StringUtils::URLEncoded(m_primaryClusterId) << "&";
   }
 
   if(m_automaticFailoverStatusHasBeenSet)
@@ -83,7 +83,7 @@ void ReplicationGroupPendingModifiedValues::OutputToStream(Aws::OStream& oStream
 {
   if(m_primaryClusterIdHasBeenSet)
   {
-      oStream << location << ".PrimaryClusterId=" << StringUtils::URLEncode(m_primaryClusterId.c_str()) << "&";
+      oStream << location << ".PrimaryClusterId=" << StringUtils::URLEncoded(m_primaryClusterId) << "&";
   }
   if(m_automaticFailoverStatusHasBeenSet)
   {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -79,67 +80,67 @@ ReservedCacheNode& ReservedCacheNode::operator =(const XmlNode& xmlNode)
     XmlNode reservedCacheNodeIdNode = resultNode.FirstChild("ReservedCacheNodeId");
     if(!reservedCacheNodeIdNode.IsNull())
     {
-      m_reservedCacheNodeId = StringUtils::Trim(reservedCacheNodeIdNode.GetText().c_str());
+      m_reservedCacheNodeId = reservedCacheNodeIdNode.GetTextView().Trim().ToString();
       m_reservedCacheNodeIdHasBeenSet = true;
     }
     XmlNode reservedCacheNodesOfferingIdNode = resultNode.FirstChild("ReservedCacheNodesOfferingId");
     if(!reservedCacheNodesOfferingIdNode.IsNull())
     {
-      m_reservedCacheNodesOfferingId = StringUtils::Trim(reservedCacheNodesOfferingIdNode.GetText().c_str());
+      m_reservedCacheNodesOfferingId = reservedCacheNodesOfferingIdNode.GetTextView().Trim().ToString();
       m_reservedCacheNodesOfferingIdHasBeenSet = true;
     }
     XmlNode cacheNodeTypeNode = resultNode.FirstChild("CacheNodeType");
     if(!cacheNodeTypeNode.IsNull())
     {
-      m_cacheNodeType = StringUtils::Trim(cacheNodeTypeNode.GetText().c_str());
+      m_cacheNodeType = cacheNodeTypeNode.GetTextView().Trim().ToString();
       m_cacheNodeTypeHasBeenSet = true;
     }
     XmlNode startTimeNode = resultNode.FirstChild("StartTime");
     if(!startTimeNode.IsNull())
     {
-      m_startTime = DateTime(StringUtils::Trim(startTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_startTime = DateTime(startTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_startTimeHasBeenSet = true;
     }
     XmlNode durationNode = resultNode.FirstChild("Duration");
     if(!durationNode.IsNull())
     {
-      m_duration = StringUtils::ConvertToInt32(StringUtils::Trim(durationNode.GetText().c_str()).c_str());
+      m_duration = StringUtils::ConvertToInt32(durationNode.GetTextView().Trim().ToString().c_str());
       m_durationHasBeenSet = true;
     }
     XmlNode fixedPriceNode = resultNode.FirstChild("FixedPrice");
     if(!fixedPriceNode.IsNull())
     {
-      m_fixedPrice = StringUtils::ConvertToDouble(StringUtils::Trim(fixedPriceNode.GetText().c_str()).c_str());
+      m_fixedPrice = StringUtils::ConvertToDouble(fixedPriceNode.GetTextView().Trim().ToString().c_str());
       m_fixedPriceHasBeenSet = true;
     }
     XmlNode usagePriceNode = resultNode.FirstChild("UsagePrice");
     if(!usagePriceNode.IsNull())
     {
-      m_usagePrice = StringUtils::ConvertToDouble(StringUtils::Trim(usagePriceNode.GetText().c_str()).c_str());
+      m_usagePrice = StringUtils::ConvertToDouble(usagePriceNode.GetTextView().Trim().ToString().c_str());
       m_usagePriceHasBeenSet = true;
     }
     XmlNode cacheNodeCountNode = resultNode.FirstChild("CacheNodeCount");
     if(!cacheNodeCountNode.IsNull())
     {
-      m_cacheNodeCount = StringUtils::ConvertToInt32(StringUtils::Trim(cacheNodeCountNode.GetText().c_str()).c_str());
+      m_cacheNodeCount = StringUtils::ConvertToInt32(cacheNodeCountNode.GetTextView().Trim().ToString().c_str());
       m_cacheNodeCountHasBeenSet = true;
     }
     XmlNode productDescriptionNode = resultNode.FirstChild("ProductDescription");
     if(!productDescriptionNode.IsNull())
     {
-      m_productDescription = StringUtils::Trim(productDescriptionNode.GetText().c_str());
+      m_productDescription = productDescriptionNode.GetTextView().Trim().ToString();
       m_productDescriptionHasBeenSet = true;
     }
     XmlNode offeringTypeNode = resultNode.FirstChild("OfferingType");
     if(!offeringTypeNode.IsNull())
     {
-      m_offeringType = StringUtils::Trim(offeringTypeNode.GetText().c_str());
+      m_offeringType = offeringTypeNode.GetTextView().Trim().ToString();
       m_offeringTypeHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("State");
     if(!stateNode.IsNull())
     {
-      m_state = StringUtils::Trim(stateNode.GetText().c_str());
+      m_state = stateNode.GetTextView().Trim().ToString();
       m_stateHasBeenSet = true;
     }
     XmlNode recurringChargesNode = resultNode.FirstChild("RecurringCharges");
@@ -163,22 +164,22 @@ void ReservedCacheNode::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_reservedCacheNodeIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReservedCacheNodeId=" << StringUtils::URLEncode(m_reservedCacheNodeId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReservedCacheNodeId=" << StringUtils::URLEncoded(m_reservedCacheNodeId) << "&";
   }
 
   if(m_reservedCacheNodesOfferingIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReservedCacheNodesOfferingId=" << StringUtils::URLEncode(m_reservedCacheNodesOfferingId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReservedCacheNodesOfferingId=" << StringUtils::URLEncoded(m_reservedCacheNodesOfferingId) << "&";
   }
 
   if(m_cacheNodeTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
 
   if(m_startTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_durationHasBeenSet)
@@ -203,17 +204,17 @@ void ReservedCacheNode::OutputToStream(Aws::OStream& oStream, const char* locati
 
   if(m_productDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ProductDescription=" << StringUtils::URLEncode(m_productDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".ProductDescription=" << StringUtils::URLEncoded(m_productDescription) << "&";
   }
 
   if(m_offeringTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OfferingType=" << StringUtils::URLEncode(m_offeringType.c_str()) << "&";
+      oStream << location << index << locationValue << ".OfferingType=" << StringUtils::URLEncoded(m_offeringType) << "&";
   }
 
   if(m_stateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".State=" << StringUtils::URLEncode(m_state.c_str()) << "&";
+      oStream << location << index << locationValue << ".State=" << StringUtils::URLEncoded(m_state) << "&";
   }
 
   if(m_recurringChargesHasBeenSet)
@@ -221,9 +222,9 @@ void ReservedCacheNode::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned recurringChargesIdx = 1;
       for(auto& item : m_recurringCharges)
       {
-        Aws::StringStream recurringChargesSs;
+        Aws::Utils::Stream::StringOutputStream recurringChargesSs;
         recurringChargesSs << location << index << locationValue << ".RecurringCharge." << recurringChargesIdx++;
-        item.OutputToStream(oStream, recurringChargesSs.str().c_str());
+        item.OutputToStream(oStream, recurringChargesSs.GetString().c_str());
       }
   }
 
@@ -233,19 +234,19 @@ void ReservedCacheNode::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_reservedCacheNodeIdHasBeenSet)
   {
-      oStream << location << ".ReservedCacheNodeId=" << StringUtils::URLEncode(m_reservedCacheNodeId.c_str()) << "&";
+      oStream << location << ".ReservedCacheNodeId=" << StringUtils::URLEncoded(m_reservedCacheNodeId) << "&";
   }
   if(m_reservedCacheNodesOfferingIdHasBeenSet)
   {
-      oStream << location << ".ReservedCacheNodesOfferingId=" << StringUtils::URLEncode(m_reservedCacheNodesOfferingId.c_str()) << "&";
+      oStream << location << ".ReservedCacheNodesOfferingId=" << StringUtils::URLEncoded(m_reservedCacheNodesOfferingId) << "&";
   }
   if(m_cacheNodeTypeHasBeenSet)
   {
-      oStream << location << ".CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+      oStream << location << ".CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
   if(m_startTimeHasBeenSet)
   {
-      oStream << location << ".StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_durationHasBeenSet)
   {
@@ -265,24 +266,24 @@ void ReservedCacheNode::OutputToStream(Aws::OStream& oStream, const char* locati
   }
   if(m_productDescriptionHasBeenSet)
   {
-      oStream << location << ".ProductDescription=" << StringUtils::URLEncode(m_productDescription.c_str()) << "&";
+      oStream << location << ".ProductDescription=" << StringUtils::URLEncoded(m_productDescription) << "&";
   }
   if(m_offeringTypeHasBeenSet)
   {
-      oStream << location << ".OfferingType=" << StringUtils::URLEncode(m_offeringType.c_str()) << "&";
+      oStream << location << ".OfferingType=" << StringUtils::URLEncoded(m_offeringType) << "&";
   }
   if(m_stateHasBeenSet)
   {
-      oStream << location << ".State=" << StringUtils::URLEncode(m_state.c_str()) << "&";
+      oStream << location << ".State=" << StringUtils::URLEncoded(m_state) << "&";
   }
   if(m_recurringChargesHasBeenSet)
   {
       unsigned recurringChargesIdx = 1;
       for(auto& item : m_recurringCharges)
       {
-        Aws::StringStream recurringChargesSs;
+        Aws::Utils::Stream::StringOutputStream recurringChargesSs;
         recurringChargesSs << location <<  ".RecurringCharge." << recurringChargesIdx++;
-        item.OutputToStream(oStream, recurringChargesSs.str().c_str());
+        item.OutputToStream(oStream, recurringChargesSs.GetString().c_str());
       }
   }
 }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -69,43 +70,43 @@ ReservedCacheNodesOffering& ReservedCacheNodesOffering::operator =(const XmlNode
     XmlNode reservedCacheNodesOfferingIdNode = resultNode.FirstChild("ReservedCacheNodesOfferingId");
     if(!reservedCacheNodesOfferingIdNode.IsNull())
     {
-      m_reservedCacheNodesOfferingId = StringUtils::Trim(reservedCacheNodesOfferingIdNode.GetText().c_str());
+      m_reservedCacheNodesOfferingId = reservedCacheNodesOfferingIdNode.GetTextView().Trim().ToString();
       m_reservedCacheNodesOfferingIdHasBeenSet = true;
     }
     XmlNode cacheNodeTypeNode = resultNode.FirstChild("CacheNodeType");
     if(!cacheNodeTypeNode.IsNull())
     {
-      m_cacheNodeType = StringUtils::Trim(cacheNodeTypeNode.GetText().c_str());
+      m_cacheNodeType = cacheNodeTypeNode.GetTextView().Trim().ToString();
       m_cacheNodeTypeHasBeenSet = true;
     }
     XmlNode durationNode = resultNode.FirstChild("Duration");
     if(!durationNode.IsNull())
     {
-      m_duration = StringUtils::ConvertToInt32(StringUtils::Trim(durationNode.GetText().c_str()).c_str());
+      m_duration = StringUtils::ConvertToInt32(durationNode.GetTextView().Trim().ToString().c_str());
       m_durationHasBeenSet = true;
     }
     XmlNode fixedPriceNode = resultNode.FirstChild("FixedPrice");
     if(!fixedPriceNode.IsNull())
     {
-      m_fixedPrice = StringUtils::ConvertToDouble(StringUtils::Trim(fixedPriceNode.GetText().c_str()).c_str());
+      m_fixedPrice = StringUtils::ConvertToDouble(fixedPriceNode.GetTextView().Trim().ToString().c_str());
       m_fixedPriceHasBeenSet = true;
     }
     XmlNode usagePriceNode = resultNode.FirstChild("UsagePrice");
     if(!usagePriceNode.IsNull())
     {
-      m_usagePrice = StringUtils::ConvertToDouble(StringUtils::Trim(usagePriceNode.GetText().c_str()).c_str());
+      m_usagePrice = StringUtils::ConvertToDouble(usagePriceNode.GetTextView().Trim().ToString().c_str());
       m_usagePriceHasBeenSet = true;
     }
     XmlNode productDescriptionNode = resultNode.FirstChild("ProductDescription");
     if(!productDescriptionNode.IsNull())
     {
-      m_productDescription = StringUtils::Trim(productDescriptionNode.GetText().c_str());
+      m_productDescription = productDescriptionNode.GetTextView().Trim().ToString();
       m_productDescriptionHasBeenSet = true;
     }
     XmlNode offeringTypeNode = resultNode.FirstChild("OfferingType");
     if(!offeringTypeNode.IsNull())
     {
-      m_offeringType = StringUtils::Trim(offeringTypeNode.GetText().c_str());
+      m_offeringType = offeringTypeNode.GetTextView().Trim().ToString();
       m_offeringTypeHasBeenSet = true;
     }
     XmlNode recurringChargesNode = resultNode.FirstChild("RecurringCharges");
@@ -129,12 +130,12 @@ void ReservedCacheNodesOffering::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_reservedCacheNodesOfferingIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReservedCacheNodesOfferingId=" << StringUtils::URLEncode(m_reservedCacheNodesOfferingId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReservedCacheNodesOfferingId=" << StringUtils::URLEncoded(m_reservedCacheNodesOfferingId) << "&";
   }
 
   if(m_cacheNodeTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
 
   if(m_durationHasBeenSet)
@@ -154,12 +155,12 @@ void ReservedCacheNodesOffering::OutputToStream(Aws::OStream& oStream, const cha
 
   if(m_productDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ProductDescription=" << StringUtils::URLEncode(m_productDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".ProductDescription=" << StringUtils::URLEncoded(m_productDescription) << "&";
   }
 
   if(m_offeringTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OfferingType=" << StringUtils::URLEncode(m_offeringType.c_str()) << "&";
+      oStream << location << index << locationValue << ".OfferingType=" << StringUtils::URLEncoded(m_offeringType) << "&";
   }
 
   if(m_recurringChargesHasBeenSet)
@@ -167,9 +168,9 @@ void ReservedCacheNodesOffering::OutputToStream(Aws::OStream& oStream, const cha
       unsigned recurringChargesIdx = 1;
       for(auto& item : m_recurringCharges)
       {
-        Aws::StringStream recurringChargesSs;
+        Aws::Utils::Stream::StringOutputStream recurringChargesSs;
         recurringChargesSs << location << index << locationValue << ".RecurringCharge." << recurringChargesIdx++;
-        item.OutputToStream(oStream, recurringChargesSs.str().c_str());
+        item.OutputToStream(oStream, recurringChargesSs.GetString().c_str());
       }
   }
 
@@ -179,11 +180,11 @@ void ReservedCacheNodesOffering::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_reservedCacheNodesOfferingIdHasBeenSet)
   {
-      oStream << location << ".ReservedCacheNodesOfferingId=" << StringUtils::URLEncode(m_reservedCacheNodesOfferingId.c_str()) << "&";
+      oStream << location << ".ReservedCacheNodesOfferingId=" << StringUtils::URLEncoded(m_reservedCacheNodesOfferingId) << "&";
   }
   if(m_cacheNodeTypeHasBeenSet)
   {
-      oStream << location << ".CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+      oStream << location << ".CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
   if(m_durationHasBeenSet)
   {
@@ -199,20 +200,20 @@ void ReservedCacheNodesOffering::OutputToStream(Aws::OStream& oStream, const cha
   }
   if(m_productDescriptionHasBeenSet)
   {
-      oStream << location << ".ProductDescription=" << StringUtils::URLEncode(m_productDescription.c_str()) << "&";
+      oStream << location << ".ProductDescription=" << StringUtils::URLEncoded(m_productDescription) << "&";
   }
   if(m_offeringTypeHasBeenSet)
   {
-      oStream << location << ".OfferingType=" << StringUtils::URLEncode(m_offeringType.c_str()) << "&";
+      oStream << location << ".OfferingType=" << StringUtils::URLEncoded(m_offeringType) << "&";
   }
   if(m_recurringChargesHasBeenSet)
   {
       unsigned recurringChargesIdx = 1;
       for(auto& item : m_recurringCharges)
       {
-        Aws::StringStream recurringChargesSs;
+        Aws::Utils::Stream::StringOutputStream recurringChargesSs;
         recurringChargesSs << location <<  ".RecurringCharge." << recurringChargesIdx++;
-        item.OutputToStream(oStream, recurringChargesSs.str().c_str());
+        item.OutputToStream(oStream, recurringChargesSs.GetString().c_str());
       }
   }
 }
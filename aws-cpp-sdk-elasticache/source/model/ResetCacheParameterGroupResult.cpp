@@ -40,7 +40,7 @@ ResetCacheParameterGroupResult& ResetCacheParameterGroupResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ResetCacheParameterGroupResult")
+  if (rootNode.GetNameView() != "ResetCacheParameterGroupResult")
   {
     resultNode = rootNode.FirstChild("ResetCacheParameterGroupResult");
   }
@@ -50,7 +50,7 @@ ResetCacheParameterGroupResult& ResetCacheParameterGroupResult::operator =(const
     XmlNode cacheParameterGroupNameNode = resultNode.FirstChild("CacheParameterGroupName");
     if(!cacheParameterGroupNameNode.IsNull())
     {
-      m_cacheParameterGroupName = StringUtils::Trim(cacheParameterGroupNameNode.GetText().c_str());
+      m_cacheParameterGroupName = cacheParameterGroupNameNode.GetTextView().Trim().ToString();
     }
   }
 
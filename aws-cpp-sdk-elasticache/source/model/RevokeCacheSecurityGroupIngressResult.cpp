@@ -40,7 +40,7 @@ RevokeCacheSecurityGroupIngressResult& RevokeCacheSecurityGroupIngressResult::op
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RevokeCacheSecurityGroupIngressResult")
+  if (rootNode.GetNameView() != "RevokeCacheSecurityGroupIngressResult")
   {
     resultNode = rootNode.FirstChild("RevokeCacheSecurityGroupIngressResult");
   }
@@ -51,13 +51,13 @@ SecurityGroupMembership& SecurityGroupMembership::operator =(const XmlNode& xmlN
     XmlNode securityGroupIdNode = resultNode.FirstChild("SecurityGroupId");
     if(!securityGroupIdNode.IsNull())
     {
-      m_securityGroupId = StringUtils::Trim(securityGroupIdNode.GetText().c_str());
+      m_securityGroupId = securityGroupIdNode.GetTextView().Trim().ToString();
       m_securityGroupIdHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void SecurityGroupMembership::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_securityGroupIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SecurityGroupId=" << StringUtils::URLEncode(m_securityGroupId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SecurityGroupId=" << StringUtils::URLEncoded(m_securityGroupId) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void SecurityGroupMembership::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_securityGroupIdHasBeenSet)
   {
-      oStream << location << ".SecurityGroupId=" << StringUtils::URLEncode(m_securityGroupId.c_str()) << "&";
+      oStream << location << ".SecurityGroupId=" << StringUtils::URLEncoded(m_securityGroupId) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 }
 
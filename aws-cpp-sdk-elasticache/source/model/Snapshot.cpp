@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -95,115 +96,115 @@ Snapshot& Snapshot::operator =(const XmlNode& xmlNode)
     XmlNode snapshotNameNode = resultNode.FirstChild("SnapshotName");
     if(!snapshotNameNode.IsNull())
     {
-      m_snapshotName = StringUtils::Trim(snapshotNameNode.GetText().c_str());
+      m_snapshotName = snapshotNameNode.GetTextView().Trim().ToString();
       m_snapshotNameHasBeenSet = true;
     }
     XmlNode cacheClusterIdNode = resultNode.FirstChild("CacheClusterId");
     if(!cacheClusterIdNode.IsNull())
     {
-      m_cacheClusterId = StringUtils::Trim(cacheClusterIdNode.GetText().c_str());
+      m_cacheClusterId = cacheClusterIdNode.GetTextView().Trim().ToString();
       m_cacheClusterIdHasBeenSet = true;
     }
     XmlNode snapshotStatusNode = resultNode.FirstChild("SnapshotStatus");
     if(!snapshotStatusNode.IsNull())
     {
-      m_snapshotStatus = StringUtils::Trim(snapshotStatusNode.GetText().c_str());
+      m_snapshotStatus = snapshotStatusNode.GetTextView().Trim().ToString();
       m_snapshotStatusHasBeenSet = true;
     }
     XmlNode snapshotSourceNode = resultNode.FirstChild("SnapshotSource");
     if(!snapshotSourceNode.IsNull())
     {
-      m_snapshotSource = StringUtils::Trim(snapshotSourceNode.GetText().c_str());
+      m_snapshotSource = snapshotSourceNode.GetTextView().Trim().ToString();
       m_snapshotSourceHasBeenSet = true;
     }
     XmlNode cacheNodeTypeNode = resultNode.FirstChild("CacheNodeType");
     if(!cacheNodeTypeNode.IsNull())
     {
-      m_cacheNodeType = StringUtils::Trim(cacheNodeTypeNode.GetText().c_str());
+      m_cacheNodeType = cacheNodeTypeNode.GetTextView().Trim().ToString();
       m_cacheNodeTypeHasBeenSet = true;
     }
     XmlNode engineNode = resultNode.FirstChild("Engine");
     if(!engineNode.IsNull())
     {
-      m_engine = StringUtils::Trim(engineNode.GetText().c_str());
+      m_engine = engineNode.GetTextView().Trim().ToString();
       m_engineHasBeenSet = true;
     }
     XmlNode engineVersionNode = resultNode.FirstChild("EngineVersion");
     if(!engineVersionNode.IsNull())
     {
-      m_engineVersion = StringUtils::Trim(engineVersionNode.GetText().c_str());
+      m_engineVersion = engineVersionNode.GetTextView().Trim().ToString();
       m_engineVersionHasBeenSet = true;
     }
     XmlNode numCacheNodesNode = resultNode.FirstChild("NumCacheNodes");
     if(!numCacheNodesNode.IsNull())
     {
-      m_numCacheNodes = StringUtils::ConvertToInt32(StringUtils::Trim(numCacheNodesNode.GetText().c_str()).c_str());
+      m_numCacheNodes = StringUtils::ConvertToInt32(numCacheNodesNode.GetTextView().Trim().ToString().c_str());
       m_numCacheNodesHasBeenSet = true;
     }
     XmlNode preferredAvailabilityZoneNode = resultNode.FirstChild("PreferredAvailabilityZone");
     if(!preferredAvailabilityZoneNode.IsNull())
     {
-      m_preferredAvailabilityZone = StringUtils::Trim(preferredAvailabilityZoneNode.GetText().c_str());
+      m_preferredAvailabilityZone = preferredAvailabilityZoneNode.GetTextView().Trim().ToString();
       m_preferredAvailabilityZoneHasBeenSet = true;
     }
     XmlNode cacheClusterCreateTimeNode = resultNode.FirstChild("CacheClusterCreateTime");
     if(!cacheClusterCreateTimeNode.IsNull())
     {
-      m_cacheClusterCreateTime = DateTime(StringUtils::Trim(cacheClusterCreateTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_cacheClusterCreateTime = DateTime(cacheClusterCreateTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_cacheClusterCreateTimeHasBeenSet = true;
     }
     XmlNode preferredMaintenanceWindowNode = resultNode.FirstChild("PreferredMaintenanceWindow");
     if(!preferredMaintenanceWindowNode.IsNull())
     {
-      m_preferredMaintenanceWindow = StringUtils::Trim(preferredMaintenanceWindowNode.GetText().c_str());
+      m_preferredMaintenanceWindow = preferredMaintenanceWindowNode.GetTextView().Trim().ToString();
       m_preferredMaintenanceWindowHasBeenSet = true;
     }
     XmlNode topicArnNode = resultNode.FirstChild("TopicArn");
     if(!topicArnNode.IsNull())
     {
-      m_topicArn = StringUtils::Trim(topicArnNode.GetText().c_str());
+      m_topicArn = topicArnNode.GetTextView().Trim().ToString();
       m_topicArnHasBeenSet = true;
     }
     XmlNode portNode = resultNode.FirstChild("Port");
     if(!portNode.IsNull())
     {
-      m_port = StringUtils::ConvertToInt32(StringUtils::Trim(portNode.GetText().c_str()).c_str());
+      m_port = StringUtils::ConvertToInt32(portNode.GetTextView().Trim().ToString().c_str());
       m_portHasBeenSet = true;
     }
     XmlNode cacheParameterGroupNameNode = resultNode.FirstChild("CacheParameterGroupName");
     if(!cacheParameterGroupNameNode.IsNull())
     {
-      m_cacheParameterGroupName = StringUtils::Trim(cacheParameterGroupNameNode.GetText().c_str());
+      m_cacheParameterGroupName = cacheParameterGroupNameNode.GetTextView().Trim().ToString();
       m_cacheParameterGroupNameHasBeenSet = true;
     }
     XmlNode cacheSubnetGroupNameNode = resultNode.FirstChild("CacheSubnetGroupName");
     if(!cacheSubnetGroupNameNode.IsNull())
     {
-      m_cacheSubnetGroupName = StringUtils::Trim(cacheSubnetGroupNameNode.GetText().c_str());
+      m_cacheSubnetGroupName = cacheSubnetGroupNameNode.GetTextView().Trim().ToString();
       m_cacheSubnetGroupNameHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("VpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode autoMinorVersionUpgradeNode = resultNode.FirstChild("AutoMinorVersionUpgrade");
     if(!autoMinorVersionUpgradeNode.IsNull())
     {
-      m_autoMinorVersionUpgrade = StringUtils::ConvertToBool(StringUtils::Trim(autoMinorVersionUpgradeNode.GetText().c_str()).c_str());
+      m_autoMinorVersionUpgrade = StringUtils::ConvertToBool(autoMinorVersionUpgradeNode.GetTextView().Trim().ToString().c_str());
       m_autoMinorVersionUpgradeHasBeenSet = true;
     }
     XmlNode snapshotRetentionLimitNode = resultNode.FirstChild("SnapshotRetentionLimit");
     if(!snapshotRetentionLimitNode.IsNull())
     {
-      m_snapshotRetentionLimit = StringUtils::ConvertToInt32(StringUtils::Trim(snapshotRetentionLimitNode.GetText().c_str()).c_str());
+      m_snapshotRetentionLimit = StringUtils::ConvertToInt32(snapshotRetentionLimitNode.GetTextView().Trim().ToString().c_str());
       m_snapshotRetentionLimitHasBeenSet = true;
     }
     XmlNode snapshotWindowNode = resultNode.FirstChild("SnapshotWindow");
     if(!snapshotWindowNode.IsNull())
     {
-      m_snapshotWindow = StringUtils::Trim(snapshotWindowNode.GetText().c_str());
+      m_snapshotWindow = snapshotWindowNode.GetTextView().Trim().ToString();
       m_snapshotWindowHasBeenSet = true;
     }
     XmlNode nodeSnapshotsNode = resultNode.FirstChild("NodeSnapshots");
@@ -227,37 +228,37 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 {
   if(m_snapshotNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotName=" << StringUtils::URLEncode(m_snapshotName.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotName=" << StringUtils::URLEncoded(m_snapshotName) << "&";
   }
 
   if(m_cacheClusterIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheClusterId=" << StringUtils::URLEncode(m_cacheClusterId.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheClusterId=" << StringUtils::URLEncoded(m_cacheClusterId) << "&";
   }
 
   if(m_snapshotStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotStatus=" << StringUtils::URLEncode(m_snapshotStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotStatus=" << StringUtils::URLEncoded(m_snapshotStatus) << "&";
   }
 
   if(m_snapshotSourceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotSource=" << StringUtils::URLEncode(m_snapshotSource.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotSource=" << StringUtils::URLEncoded(m_snapshotSource) << "&";
   }
 
   if(m_cacheNodeTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
 
   if(m_engineHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
 
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_numCacheNodesHasBeenSet)
@@ -267,22 +268,22 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_preferredAvailabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PreferredAvailabilityZone=" << StringUtils::URLEncode(m_preferredAvailabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".PreferredAvailabilityZone=" << StringUtils::URLEncoded(m_preferredAvailabilityZone) << "&";
   }
 
   if(m_cacheClusterCreateTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheClusterCreateTime=" << StringUtils::URLEncode(m_cacheClusterCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheClusterCreateTime=" << StringUtils::URLEncoded(m_cacheClusterCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+      oStream << location << index << locationValue << ".PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
 
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -292,17 +293,17 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_cacheParameterGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheParameterGroupName=" << StringUtils::URLEncode(m_cacheParameterGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheParameterGroupName=" << StringUtils::URLEncoded(m_cacheParameterGroupName) << "&";
   }
 
   if(m_cacheSubnetGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CacheSubnetGroupName=" << StringUtils::URLEncode(m_cacheSubnetGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".CacheSubnetGroupName=" << StringUtils::URLEncoded(m_cacheSubnetGroupName) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_autoMinorVersionUpgradeHasBeenSet)
@@ -317,7 +318,7 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_snapshotWindowHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotWindow=" << StringUtils::URLEncode(m_snapshotWindow.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotWindow=" << StringUtils::URLEncoded(m_snapshotWindow) << "&";
   }
 
   if(m_nodeSnapshotsHasBeenSet)
@@ -325,9 +326,9 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location, unsig
       unsigned nodeSnapshotsIdx = 1;
       for(auto& item : m_nodeSnapshots)
       {
-        Aws::StringStream nodeSnapshotsSs;
+        Aws::Utils::Stream::StringOutputStream nodeSnapshotsSs;
         nodeSnapshotsSs << location << index << locationValue << ".NodeSnapshot." << nodeSnapshotsIdx++;
-        item.OutputToStream(oStream, nodeSnapshotsSs.str().c_str());
+        item.OutputToStream(oStream, nodeSnapshotsSs.GetString().c_str());
       }
   }
 
@@ -337,31 +338,31 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_snapshotNameHasBeenSet)
   {
-      oStream << location << ".SnapshotName=" << StringUtils::URLEncode(m_snapshotName.c_str()) << "&";
+      oStream << location << ".SnapshotName=" << StringUtils::URLEncoded(m_snapshotName) << "&";
   }
   if(m_cacheClusterIdHasBeenSet)
   {
-      oStream << location << ".CacheClusterId=" << StringUtils::URLEncode(m_cacheClusterId.c_str()) << "&";
+      oStream << location << ".CacheClusterId=" << StringUtils::URLEncoded(m_cacheClusterId) << "&";
   }
   if(m_snapshotStatusHasBeenSet)
   {
-      oStream << location << ".SnapshotStatus=" << StringUtils::URLEncode(m_snapshotStatus.c_str()) << "&";
+      oStream << location << ".SnapshotStatus=" << StringUtils::URLEncoded(m_snapshotStatus) << "&";
   }
   if(m_snapshotSourceHasBeenSet)
   {
-      oStream << location << ".SnapshotSource=" << StringUtils::URLEncode(m_snapshotSource.c_str()) << "&";
+      oStream << location << ".SnapshotSource=" << StringUtils::URLEncoded(m_snapshotSource) << "&";
   }
   if(m_cacheNodeTypeHasBeenSet)
   {
-      oStream << location << ".CacheNodeType=" << StringUtils::URLEncode(m_cacheNodeType.c_str()) << "&";
+      oStream << location << ".CacheNodeType=" << StringUtils::URLEncoded(m_cacheNodeType) << "&";
   }
   if(m_engineHasBeenSet)
   {
-      oStream << location << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
   if(m_numCacheNodesHasBeenSet)
   {
@@ -369,19 +370,19 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_preferredAvailabilityZoneHasBeenSet)
   {
-      oStream << location << ".PreferredAvailabilityZone=" << StringUtils::URLEncode(m_preferredAvailabilityZone.c_str()) << "&";
+      oStream << location << ".PreferredAvailabilityZone=" << StringUtils::URLEncoded(m_preferredAvailabilityZone) << "&";
   }
   if(m_cacheClusterCreateTimeHasBeenSet)
   {
-      oStream << location << ".CacheClusterCreateTime=" << StringUtils::URLEncode(m_cacheClusterCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CacheClusterCreateTime=" << StringUtils::URLEncoded(m_cacheClusterCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-      oStream << location << ".PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+      oStream << location << ".PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
   if(m_portHasBeenSet)
   {
@@ -389,15 +390,15 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_cacheParameterGroupNameHasBeenSet)
   {
-      oStream << location << ".CacheParameterGroupName=" << StringUtils::URLEncode(m_cacheParameterGroupName.c_str()) << "&";
+      oStream << location << ".CacheParameterGroupName=" << StringUtils::URLEncoded(m_cacheParameterGroupName) << "&";
   }
   if(m_cacheSubnetGroupNameHasBeenSet)
   {
-      oStream << location << ".CacheSubnetGroupName=" << StringUtils::URLEncode(m_cacheSubnetGroupName.c_str()) << "&";
+      oStream << location << ".CacheSubnetGroupName=" << StringUtils::URLEncoded(m_cacheSubnetGroupName) << "&";
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_autoMinorVersionUpgradeHasBeenSet)
   {
@@ -409,16 +410,16 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_snapshotWindowHasBeenSet)
   {
-      oStream << location << ".SnapshotWindow=" << StringUtils::URLEncode(m_snapshotWindow.c_str()) << "&";
+      oStream << location << ".SnapshotWindow=" << StringUtils::URLEncoded(m_snapshotWindow) << "&";
   }
   if(m_nodeSnapshotsHasBeenSet)
   {
       unsigned nodeSnapshotsIdx = 1;
       for(auto& item : m_nodeSnapshots)
       {
-        Aws::StringStream nodeSnapshotsSs;
+        Aws::Utils::Stream::StringOutputStream nodeSnapshotsSs;
         nodeSnapshotsSs << location <<  ".NodeSnapshot." << nodeSnapshotsIdx++;
-        item.OutputToStream(oStream, nodeSnapshotsSs.str().c_str());
+        item.OutputToStream(oStream, nodeSnapshotsSs.GetString().c_str());
       }
   }
 }
@@ -29,31 +29,35 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int cache_cluster_HASH = HashingUtils::HashString("cache-cluster");
-        static const int cache_parameter_group_HASH = HashingUtils::HashString("cache-parameter-group");
-        static const int cache_security_group_HASH = HashingUtils::HashString("cache-security-group");
-        static const int cache_subnet_group_HASH = HashingUtils::HashString("cache-subnet-group");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int cache_cluster_HASH = -288226641;
+        static const int cache_parameter_group_HASH = 1499334416;
+        static const int cache_security_group_HASH = -1450779811;
+        static const int cache_subnet_group_HASH = 1552469114;
 
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == cache_cluster_HASH)
+          switch (hashCode)
           {
+          case cache_cluster_HASH:
             return SourceType::cache_cluster;
-          }
-          else if (hashCode == cache_parameter_group_HASH)
-          {
+          case cache_parameter_group_HASH:
             return SourceType::cache_parameter_group;
-          }
-          else if (hashCode == cache_security_group_HASH)
-          {
+          case cache_security_group_HASH:
             return SourceType::cache_security_group;
-          }
-          else if (hashCode == cache_subnet_group_HASH)
-          {
+          case cache_subnet_group_HASH:
             return SourceType::cache_subnet_group;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ Subnet& Subnet::operator =(const XmlNode& xmlNode)
     XmlNode subnetIdentifierNode = resultNode.FirstChild("SubnetIdentifier");
     if(!subnetIdentifierNode.IsNull())
     {
-      m_subnetIdentifier = StringUtils::Trim(subnetIdentifierNode.GetText().c_str());
+      m_subnetIdentifier = subnetIdentifierNode.GetTextView().Trim().ToString();
       m_subnetIdentifierHasBeenSet = true;
     }
     XmlNode subnetAvailabilityZoneNode = resultNode.FirstChild("SubnetAvailabilityZone");
@@ -69,14 +70,14 @@ void Subnet::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
 {
   if(m_subnetIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubnetIdentifier=" << StringUtils::URLEncode(m_subnetIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubnetIdentifier=" << StringUtils::URLEncoded(m_subnetIdentifier) << "&";
   }
 
   if(m_subnetAvailabilityZoneHasBeenSet)
   {
-      Aws::StringStream subnetAvailabilityZoneLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream subnetAvailabilityZoneLocationAndMemberSs;
       subnetAvailabilityZoneLocationAndMemberSs << location << index << locationValue << ".SubnetAvailabilityZone";
-      m_subnetAvailabilityZone.OutputToStream(oStream, subnetAvailabilityZoneLocationAndMemberSs.str().c_str());
+      m_subnetAvailabilityZone.OutputToStream(oStream, subnetAvailabilityZoneLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -85,7 +86,7 @@ void Subnet::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_subnetIdentifierHasBeenSet)
   {
-      oStream << location << ".SubnetIdentifier=" << StringUtils::URLEncode(m_subnetIdentifier.c_str()) << "&";
+      oStream << location << ".SubnetIdentifier=" << StringUtils::URLEncoded(m_subnetIdentifier) << "&";
   }
   if(m_subnetAvailabilityZoneHasBeenSet)
   {
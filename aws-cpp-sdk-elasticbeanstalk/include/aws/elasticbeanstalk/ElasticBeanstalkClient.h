@@ -49,6 +49,9 @@
 #include <aws/elasticbeanstalk/model/ValidateConfigurationSettingsResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -308,6 +311,18 @@ namespace Model
          */
         virtual void AbortEnvironmentUpdateAsync(const Model::AbortEnvironmentUpdateRequest& request, const AbortEnvironmentUpdateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AbortEnvironmentUpdateCallable(const Model::AbortEnvironmentUpdateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AbortEnvironmentUpdateOutcomeCallable AbortEnvironmentUpdateCallable(Model::AbortEnvironmentUpdateRequest&& request) const;
+
+        /**
+         * Same as AbortEnvironmentUpdateAsync(const Model::AbortEnvironmentUpdateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AbortEnvironmentUpdateAsync(Model::AbortEnvironmentUpdateRequest&& request, const AbortEnvironmentUpdateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Applies a scheduled managed action immediately. A managed action can be
          * applied only if its status is <code>Scheduled</code>. Get the status and action
@@ -333,6 +348,18 @@ namespace Model
          */
         virtual void ApplyEnvironmentManagedActionAsync(const Model::ApplyEnvironmentManagedActionRequest& request, const ApplyEnvironmentManagedActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ApplyEnvironmentManagedActionCallable(const Model::ApplyEnvironmentManagedActionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ApplyEnvironmentManagedActionOutcomeCallable ApplyEnvironmentManagedActionCallable(Model::ApplyEnvironmentManagedActionRequest&& request) const;
+
+        /**
+         * Same as ApplyEnvironmentManagedActionAsync(const Model::ApplyEnvironmentManagedActionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ApplyEnvironmentManagedActionAsync(Model::ApplyEnvironmentManagedActionRequest&& request, const ApplyEnvironmentManagedActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Checks if the specified CNAME is available. </p>
          */
@@ -352,6 +379,18 @@ namespace Model
          */
         virtual void CheckDNSAvailabilityAsync(const Model::CheckDNSAvailabilityRequest& request, const CheckDNSAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CheckDNSAvailabilityCallable(const Model::CheckDNSAvailabilityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CheckDNSAvailabilityOutcomeCallable CheckDNSAvailabilityCallable(Model::CheckDNSAvailabilityRequest&& request) const;
+
+        /**
+         * Same as CheckDNSAvailabilityAsync(const Model::CheckDNSAvailabilityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CheckDNSAvailabilityAsync(Model::CheckDNSAvailabilityRequest&& request, const CheckDNSAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Create or update a group of environments that each run a separate component
          * of a single application. Takes a list of version labels that specify application
@@ -389,6 +428,18 @@ namespace Model
          */
         virtual void ComposeEnvironmentsAsync(const Model::ComposeEnvironmentsRequest& request, const ComposeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ComposeEnvironmentsCallable(const Model::ComposeEnvironmentsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ComposeEnvironmentsOutcomeCallable ComposeEnvironmentsCallable(Model::ComposeEnvironmentsRequest&& request) const;
+
+        /**
+         * Same as ComposeEnvironmentsAsync(const Model::ComposeEnvironmentsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ComposeEnvironmentsAsync(Model::ComposeEnvironmentsRequest&& request, const ComposeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates an application that has one configuration template named
          * <code>default</code> and no application versions. </p>
@@ -411,6 +462,18 @@ namespace Model
          */
         virtual void CreateApplicationAsync(const Model::CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateApplicationCallable(const Model::CreateApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateApplicationOutcomeCallable CreateApplicationCallable(Model::CreateApplicationRequest&& request) const;
+
+        /**
+         * Same as CreateApplicationAsync(const Model::CreateApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateApplicationAsync(Model::CreateApplicationRequest&& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an application version for the specified application.</p> <note>Once
          * you create an application version with a specified Amazon S3 bucket and key
@@ -442,6 +505,18 @@ namespace Model
          */
         virtual void CreateApplicationVersionAsync(const Model::CreateApplicationVersionRequest& request, const CreateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateApplicationVersionCallable(const Model::CreateApplicationVersionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateApplicationVersionOutcomeCallable CreateApplicationVersionCallable(Model::CreateApplicationVersionRequest&& request) const;
+
+        /**
+         * Same as CreateApplicationVersionAsync(const Model::CreateApplicationVersionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateApplicationVersionAsync(Model::CreateApplicationVersionRequest&& request, const CreateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a configuration template. Templates are associated with a specific
          * application and are used to deploy different versions of the application with
@@ -476,6 +551,18 @@ namespace Model
          */
         virtual void CreateConfigurationTemplateAsync(const Model::CreateConfigurationTemplateRequest& request, const CreateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateConfigurationTemplateCallable(const Model::CreateConfigurationTemplateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateConfigurationTemplateOutcomeCallable CreateConfigurationTemplateCallable(Model::CreateConfigurationTemplateRequest&& request) const;
+
+        /**
+         * Same as CreateConfigurationTemplateAsync(const Model::CreateConfigurationTemplateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateConfigurationTemplateAsync(Model::CreateConfigurationTemplateRequest&& request, const CreateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Launches an environment for the specified application using the specified
          * configuration.</p>
@@ -498,6 +585,18 @@ namespace Model
          */
         virtual void CreateEnvironmentAsync(const Model::CreateEnvironmentRequest& request, const CreateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateEnvironmentCallable(const Model::CreateEnvironmentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateEnvironmentOutcomeCallable CreateEnvironmentCallable(Model::CreateEnvironmentRequest&& request) const;
+
+        /**
+         * Same as CreateEnvironmentAsync(const Model::CreateEnvironmentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateEnvironmentAsync(Model::CreateEnvironmentRequest&& request, const CreateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates the Amazon S3 storage location for the account. </p> <p> This
          * location is used to store user log files. </p>
@@ -520,6 +619,18 @@ namespace Model
          */
         virtual void CreateStorageLocationAsync(const Model::CreateStorageLocationRequest& request, const CreateStorageLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateStorageLocationCallable(const Model::CreateStorageLocationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateStorageLocationOutcomeCallable CreateStorageLocationCallable(Model::CreateStorageLocationRequest&& request) const;
+
+        /**
+         * Same as CreateStorageLocationAsync(const Model::CreateStorageLocationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateStorageLocationAsync(Model::CreateStorageLocationRequest&& request, const CreateStorageLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the specified application along with all associated versions and
          * configurations. The application versions will not be deleted from your Amazon S3
@@ -548,6 +659,18 @@ namespace Model
          */
         virtual void DeleteApplicationAsync(const Model::DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteApplicationCallable(const Model::DeleteApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteApplicationOutcomeCallable DeleteApplicationCallable(Model::DeleteApplicationRequest&& request) const;
+
+        /**
+         * Same as DeleteApplicationAsync(const Model::DeleteApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteApplicationAsync(Model::DeleteApplicationRequest&& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the specified version from the specified application. </p> <note>You
          * cannot delete an application version that is associated with a running
@@ -573,6 +696,18 @@ namespace Model
          */
         virtual void DeleteApplicationVersionAsync(const Model::DeleteApplicationVersionRequest& request, const DeleteApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteApplicationVersionCallable(const Model::DeleteApplicationVersionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteApplicationVersionOutcomeCallable DeleteApplicationVersionCallable(Model::DeleteApplicationVersionRequest&& request) const;
+
+        /**
+         * Same as DeleteApplicationVersionAsync(const Model::DeleteApplicationVersionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteApplicationVersionAsync(Model::DeleteApplicationVersionRequest&& request, const DeleteApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified configuration template.</p> <note>When you launch an
          * environment using a configuration template, the environment gets a copy of the
@@ -601,6 +736,18 @@ namespace Model
          */
         virtual void DeleteConfigurationTemplateAsync(const Model::DeleteConfigurationTemplateRequest& request, const DeleteConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteConfigurationTemplateCallable(const Model::DeleteConfigurationTemplateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteConfigurationTemplateOutcomeCallable DeleteConfigurationTemplateCallable(Model::DeleteConfigurationTemplateRequest&& request) const;
+
+        /**
+         * Same as DeleteConfigurationTemplateAsync(const Model::DeleteConfigurationTemplateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteConfigurationTemplateAsync(Model::DeleteConfigurationTemplateRequest&& request, const DeleteConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the draft configuration associated with the running environment.</p>
          * <p>Updating a running environment with any configuration changes creates a draft
@@ -638,6 +785,18 @@ namespace Model
          */
         virtual void DeleteEnvironmentConfigurationAsync(const Model::DeleteEnvironmentConfigurationRequest& request, const DeleteEnvironmentConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteEnvironmentConfigurationCallable(const Model::DeleteEnvironmentConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteEnvironmentConfigurationOutcomeCallable DeleteEnvironmentConfigurationCallable(Model::DeleteEnvironmentConfigurationRequest&& request) const;
+
+        /**
+         * Same as DeleteEnvironmentConfigurationAsync(const Model::DeleteEnvironmentConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteEnvironmentConfigurationAsync(Model::DeleteEnvironmentConfigurationRequest&& request, const DeleteEnvironmentConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieve a list of application versions stored in your AWS Elastic Beanstalk
          * storage bucket.</p>
@@ -660,6 +819,18 @@ namespace Model
          */
         virtual void DescribeApplicationVersionsAsync(const Model::DescribeApplicationVersionsRequest& request, const DescribeApplicationVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeApplicationVersionsCallable(const Model::DescribeApplicationVersionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeApplicationVersionsOutcomeCallable DescribeApplicationVersionsCallable(Model::DescribeApplicationVersionsRequest&& request) const;
+
+        /**
+         * Same as DescribeApplicationVersionsAsync(const Model::DescribeApplicationVersionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeApplicationVersionsAsync(Model::DescribeApplicationVersionsRequest&& request, const DescribeApplicationVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the descriptions of existing applications.</p>
          */
@@ -679,6 +850,18 @@ namespace Model
          */
         virtual void DescribeApplicationsAsync(const Model::DescribeApplicationsRequest& request, const DescribeApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeApplicationsCallable(const Model::DescribeApplicationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeApplicationsOutcomeCallable DescribeApplicationsCallable(Model::DescribeApplicationsRequest&& request) const;
+
+        /**
+         * Same as DescribeApplicationsAsync(const Model::DescribeApplicationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeApplicationsAsync(Model::DescribeApplicationsRequest&& request, const DescribeApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Describes the configuration options that are used in a particular
          * configuration template or environment, or that a specified solution stack
@@ -710,6 +893,18 @@ namespace Model
          */
         virtual void DescribeConfigurationOptionsAsync(const Model::DescribeConfigurationOptionsRequest& request, const DescribeConfigurationOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConfigurationOptionsCallable(const Model::DescribeConfigurationOptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeConfigurationOptionsOutcomeCallable DescribeConfigurationOptionsCallable(Model::DescribeConfigurationOptionsRequest&& request) const;
+
+        /**
+         * Same as DescribeConfigurationOptionsAsync(const Model::DescribeConfigurationOptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeConfigurationOptionsAsync(Model::DescribeConfigurationOptionsRequest&& request, const DescribeConfigurationOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a description of the settings for the specified configuration set,
          * that is, either a configuration template or the configuration set associated
@@ -750,6 +945,18 @@ namespace Model
          */
         virtual void DescribeConfigurationSettingsAsync(const Model::DescribeConfigurationSettingsRequest& request, const DescribeConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConfigurationSettingsCallable(const Model::DescribeConfigurationSettingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeConfigurationSettingsOutcomeCallable DescribeConfigurationSettingsCallable(Model::DescribeConfigurationSettingsRequest&& request) const;
+
+        /**
+         * Same as DescribeConfigurationSettingsAsync(const Model::DescribeConfigurationSettingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeConfigurationSettingsAsync(Model::DescribeConfigurationSettingsRequest&& request, const DescribeConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the overall health of the specified environment.
          * The <b>DescribeEnvironmentHealth</b> operation is only available with AWS
@@ -775,6 +982,18 @@ namespace Model
          */
         virtual void DescribeEnvironmentHealthAsync(const Model::DescribeEnvironmentHealthRequest& request, const DescribeEnvironmentHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEnvironmentHealthCallable(const Model::DescribeEnvironmentHealthRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEnvironmentHealthOutcomeCallable DescribeEnvironmentHealthCallable(Model::DescribeEnvironmentHealthRequest&& request) const;
+
+        /**
+         * Same as DescribeEnvironmentHealthAsync(const Model::DescribeEnvironmentHealthRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEnvironmentHealthAsync(Model::DescribeEnvironmentHealthRequest&& request, const DescribeEnvironmentHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists an environment's completed and failed managed actions.</p>
          */
@@ -794,6 +1013,18 @@ namespace Model
          */
         virtual void DescribeEnvironmentManagedActionHistoryAsync(const Model::DescribeEnvironmentManagedActionHistoryRequest& request, const DescribeEnvironmentManagedActionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEnvironmentManagedActionHistoryCallable(const Model::DescribeEnvironmentManagedActionHistoryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEnvironmentManagedActionHistoryOutcomeCallable DescribeEnvironmentManagedActionHistoryCallable(Model::DescribeEnvironmentManagedActionHistoryRequest&& request) const;
+
+        /**
+         * Same as DescribeEnvironmentManagedActionHistoryAsync(const Model::DescribeEnvironmentManagedActionHistoryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEnvironmentManagedActionHistoryAsync(Model::DescribeEnvironmentManagedActionHistoryRequest&& request, const DescribeEnvironmentManagedActionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists an environment's upcoming and in-progress managed actions.</p>
          */
@@ -813,6 +1044,18 @@ namespace Model
          */
         virtual void DescribeEnvironmentManagedActionsAsync(const Model::DescribeEnvironmentManagedActionsRequest& request, const DescribeEnvironmentManagedActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEnvironmentManagedActionsCallable(const Model::DescribeEnvironmentManagedActionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEnvironmentManagedActionsOutcomeCallable DescribeEnvironmentManagedActionsCallable(Model::DescribeEnvironmentManagedActionsRequest&& request) const;
+
+        /**
+         * Same as DescribeEnvironmentManagedActionsAsync(const Model::DescribeEnvironmentManagedActionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEnvironmentManagedActionsAsync(Model::DescribeEnvironmentManagedActionsRequest&& request, const DescribeEnvironmentManagedActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns AWS resources for this environment.</p>
          */
@@ -832,6 +1075,18 @@ namespace Model
          */
         virtual void DescribeEnvironmentResourcesAsync(const Model::DescribeEnvironmentResourcesRequest& request, const DescribeEnvironmentResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEnvironmentResourcesCallable(const Model::DescribeEnvironmentResourcesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEnvironmentResourcesOutcomeCallable DescribeEnvironmentResourcesCallable(Model::DescribeEnvironmentResourcesRequest&& request) const;
+
+        /**
+         * Same as DescribeEnvironmentResourcesAsync(const Model::DescribeEnvironmentResourcesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEnvironmentResourcesAsync(Model::DescribeEnvironmentResourcesRequest&& request, const DescribeEnvironmentResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns descriptions for existing environments.</p>
          */
@@ -851,6 +1106,18 @@ namespace Model
          */
         virtual void DescribeEnvironmentsAsync(const Model::DescribeEnvironmentsRequest& request, const DescribeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEnvironmentsCallable(const Model::DescribeEnvironmentsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEnvironmentsOutcomeCallable DescribeEnvironmentsCallable(Model::DescribeEnvironmentsRequest&& request) const;
+
+        /**
+         * Same as DescribeEnvironmentsAsync(const Model::DescribeEnvironmentsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEnvironmentsAsync(Model::DescribeEnvironmentsRequest&& request, const DescribeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns list of event descriptions matching criteria up to the last 6
          * weeks.</p> <note>This action returns the most recent 1,000 events from the
@@ -876,6 +1143,18 @@ namespace Model
          */
         virtual void DescribeEventsAsync(const Model::DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventsCallable(const Model::DescribeEventsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEventsOutcomeCallable DescribeEventsCallable(Model::DescribeEventsRequest&& request) const;
+
+        /**
+         * Same as DescribeEventsAsync(const Model::DescribeEventsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEventsAsync(Model::DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns more detailed information about the health of the specified instances
          * (for example, CPU utilization, load average, and causes). The
@@ -904,6 +1183,18 @@ namespace Model
          */
         virtual void DescribeInstancesHealthAsync(const Model::DescribeInstancesHealthRequest& request, const DescribeInstancesHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInstancesHealthCallable(const Model::DescribeInstancesHealthRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeInstancesHealthOutcomeCallable DescribeInstancesHealthCallable(Model::DescribeInstancesHealthRequest&& request) const;
+
+        /**
+         * Same as DescribeInstancesHealthAsync(const Model::DescribeInstancesHealthRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeInstancesHealthAsync(Model::DescribeInstancesHealthRequest&& request, const DescribeInstancesHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of the available solution stack names. </p>
          */
@@ -923,6 +1214,18 @@ namespace Model
          */
         virtual void ListAvailableSolutionStacksAsync(const Model::ListAvailableSolutionStacksRequest& request, const ListAvailableSolutionStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAvailableSolutionStacksCallable(const Model::ListAvailableSolutionStacksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAvailableSolutionStacksOutcomeCallable ListAvailableSolutionStacksCallable(Model::ListAvailableSolutionStacksRequest&& request) const;
+
+        /**
+         * Same as ListAvailableSolutionStacksAsync(const Model::ListAvailableSolutionStacksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAvailableSolutionStacksAsync(Model::ListAvailableSolutionStacksRequest&& request, const ListAvailableSolutionStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes and recreates all of the AWS resources (for example: the Auto
          * Scaling group, load balancer, etc.) for a specified environment and forces a
@@ -948,6 +1251,18 @@ namespace Model
          */
         virtual void RebuildEnvironmentAsync(const Model::RebuildEnvironmentRequest& request, const RebuildEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebuildEnvironmentCallable(const Model::RebuildEnvironmentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RebuildEnvironmentOutcomeCallable RebuildEnvironmentCallable(Model::RebuildEnvironmentRequest&& request) const;
+
+        /**
+         * Same as RebuildEnvironmentAsync(const Model::RebuildEnvironmentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RebuildEnvironmentAsync(Model::RebuildEnvironmentRequest&& request, const RebuildEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Initiates a request to compile the specified type of information of the
          * deployed environment. </p> <p> Setting the <code>InfoType</code> to
@@ -991,6 +1306,18 @@ namespace Model
          */
         virtual void RequestEnvironmentInfoAsync(const Model::RequestEnvironmentInfoRequest& request, const RequestEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RequestEnvironmentInfoCallable(const Model::RequestEnvironmentInfoRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RequestEnvironmentInfoOutcomeCallable RequestEnvironmentInfoCallable(Model::RequestEnvironmentInfoRequest&& request) const;
+
+        /**
+         * Same as RequestEnvironmentInfoAsync(const Model::RequestEnvironmentInfoRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RequestEnvironmentInfoAsync(Model::RequestEnvironmentInfoRequest&& request, const RequestEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Causes the environment to restart the application container server running on
          * each Amazon EC2 instance.</p>
@@ -1013,6 +1340,18 @@ namespace Model
          */
         virtual void RestartAppServerAsync(const Model::RestartAppServerRequest& request, const RestartAppServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestartAppServerCallable(const Model::RestartAppServerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RestartAppServerOutcomeCallable RestartAppServerCallable(Model::RestartAppServerRequest&& request) const;
+
+        /**
+         * Same as RestartAppServerAsync(const Model::RestartAppServerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RestartAppServerAsync(Model::RestartAppServerRequest&& request, const RestartAppServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the compiled information from a <a>RequestEnvironmentInfo</a>
          * request.</p> <p>Related Topics</p> <ul> <li> <a>RequestEnvironmentInfo</a> </li>
@@ -1038,6 +1377,18 @@ namespace Model
          */
         virtual void RetrieveEnvironmentInfoAsync(const Model::RetrieveEnvironmentInfoRequest& request, const RetrieveEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RetrieveEnvironmentInfoCallable(const Model::RetrieveEnvironmentInfoRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RetrieveEnvironmentInfoOutcomeCallable RetrieveEnvironmentInfoCallable(Model::RetrieveEnvironmentInfoRequest&& request) const;
+
+        /**
+         * Same as RetrieveEnvironmentInfoAsync(const Model::RetrieveEnvironmentInfoRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RetrieveEnvironmentInfoAsync(Model::RetrieveEnvironmentInfoRequest&& request, const RetrieveEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Swaps the CNAMEs of two environments. </p>
          */
@@ -1057,6 +1408,18 @@ namespace Model
          */
         virtual void SwapEnvironmentCNAMEsAsync(const Model::SwapEnvironmentCNAMEsRequest& request, const SwapEnvironmentCNAMEsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SwapEnvironmentCNAMEsCallable(const Model::SwapEnvironmentCNAMEsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SwapEnvironmentCNAMEsOutcomeCallable SwapEnvironmentCNAMEsCallable(Model::SwapEnvironmentCNAMEsRequest&& request) const;
+
+        /**
+         * Same as SwapEnvironmentCNAMEsAsync(const Model::SwapEnvironmentCNAMEsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SwapEnvironmentCNAMEsAsync(Model::SwapEnvironmentCNAMEsRequest&& request, const SwapEnvironmentCNAMEsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Terminates the specified environment. </p>
          */
@@ -1076,6 +1439,18 @@ namespace Model
          */
         virtual void TerminateEnvironmentAsync(const Model::TerminateEnvironmentRequest& request, const TerminateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TerminateEnvironmentCallable(const Model::TerminateEnvironmentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TerminateEnvironmentOutcomeCallable TerminateEnvironmentCallable(Model::TerminateEnvironmentRequest&& request) const;
+
+        /**
+         * Same as TerminateEnvironmentAsync(const Model::TerminateEnvironmentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TerminateEnvironmentAsync(Model::TerminateEnvironmentRequest&& request, const TerminateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the specified application to have the specified properties. </p>
          * <note> If a property (for example, <code>description</code>) is not provided,
@@ -1104,6 +1479,18 @@ namespace Model
          */
         virtual void UpdateApplicationAsync(const Model::UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateApplicationCallable(const Model::UpdateApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateApplicationOutcomeCallable UpdateApplicationCallable(Model::UpdateApplicationRequest&& request) const;
+
+        /**
+         * Same as UpdateApplicationAsync(const Model::UpdateApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateApplicationAsync(Model::UpdateApplicationRequest&& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Updates the specified application version to have the specified properties.
          * </p> <note> If a property (for example, <code>description</code>) is not
@@ -1132,6 +1519,18 @@ namespace Model
          */
         virtual void UpdateApplicationVersionAsync(const Model::UpdateApplicationVersionRequest& request, const UpdateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateApplicationVersionCallable(const Model::UpdateApplicationVersionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateApplicationVersionOutcomeCallable UpdateApplicationVersionCallable(Model::UpdateApplicationVersionRequest&& request) const;
+
+        /**
+         * Same as UpdateApplicationVersionAsync(const Model::UpdateApplicationVersionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateApplicationVersionAsync(Model::UpdateApplicationVersionRequest&& request, const UpdateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Updates the specified configuration template to have the specified
          * properties or configuration option values. </p> <note> If a property (for
@@ -1163,6 +1562,18 @@ namespace Model
          */
         virtual void UpdateConfigurationTemplateAsync(const Model::UpdateConfigurationTemplateRequest& request, const UpdateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateConfigurationTemplateCallable(const Model::UpdateConfigurationTemplateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateConfigurationTemplateOutcomeCallable UpdateConfigurationTemplateCallable(Model::UpdateConfigurationTemplateRequest&& request) const;
+
+        /**
+         * Same as UpdateConfigurationTemplateAsync(const Model::UpdateConfigurationTemplateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateConfigurationTemplateAsync(Model::UpdateConfigurationTemplateRequest&& request, const UpdateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Updates the environment description, deploys a new application version,
          * updates the configuration settings to an entirely new configuration template, or
@@ -1206,6 +1617,18 @@ namespace Model
          */
         virtual void UpdateEnvironmentAsync(const Model::UpdateEnvironmentRequest& request, const UpdateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateEnvironmentCallable(const Model::UpdateEnvironmentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateEnvironmentOutcomeCallable UpdateEnvironmentCallable(Model::UpdateEnvironmentRequest&& request) const;
+
+        /**
+         * Same as UpdateEnvironmentAsync(const Model::UpdateEnvironmentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateEnvironmentAsync(Model::UpdateEnvironmentRequest&& request, const UpdateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Takes a set of configuration settings and either a configuration template or
          * environment, and determines whether those values are valid. </p> <p> This action
@@ -1234,6 +1657,215 @@ namespace Model
          */
         virtual void ValidateConfigurationSettingsAsync(const Model::ValidateConfigurationSettingsRequest& request, const ValidateConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ValidateConfigurationSettingsCallable(const Model::ValidateConfigurationSettingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ValidateConfigurationSettingsOutcomeCallable ValidateConfigurationSettingsCallable(Model::ValidateConfigurationSettingsRequest&& request) const;
+
+        /**
+         * Same as ValidateConfigurationSettingsAsync(const Model::ValidateConfigurationSettingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ValidateConfigurationSettingsAsync(Model::ValidateConfigurationSettingsRequest&& request, const ValidateConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeEnvironmentManagedActionHistory(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElasticBeanstalkClient, Model::DescribeEnvironmentManagedActionHistoryRequest, Model::DescribeEnvironmentManagedActionHistoryOutcome> DescribeEnvironmentManagedActionHistoryPaginator(const Model::DescribeEnvironmentManagedActionHistoryRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeEvents(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElasticBeanstalkClient, Model::DescribeEventsRequest, Model::DescribeEventsOutcome> DescribeEventsPaginator(const Model::DescribeEventsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeInstancesHealth(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElasticBeanstalkClient, Model::DescribeInstancesHealthRequest, Model::DescribeInstancesHealthOutcome> DescribeInstancesHealthPaginator(const Model::DescribeInstancesHealthRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AbortEnvironmentUpdate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::AbortEnvironmentUpdateRequest, Model::AbortEnvironmentUpdateOutcome> AbortEnvironmentUpdateAwaitable(Model::AbortEnvironmentUpdateRequest request) const;
+
+        /**
+         * co_await-able form of ApplyEnvironmentManagedAction(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::ApplyEnvironmentManagedActionRequest, Model::ApplyEnvironmentManagedActionOutcome> ApplyEnvironmentManagedActionAwaitable(Model::ApplyEnvironmentManagedActionRequest request) const;
+
+        /**
+         * co_await-able form of CheckDNSAvailability(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::CheckDNSAvailabilityRequest, Model::CheckDNSAvailabilityOutcome> CheckDNSAvailabilityAwaitable(Model::CheckDNSAvailabilityRequest request) const;
+
+        /**
+         * co_await-able form of ComposeEnvironments(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::ComposeEnvironmentsRequest, Model::ComposeEnvironmentsOutcome> ComposeEnvironmentsAwaitable(Model::ComposeEnvironmentsRequest request) const;
+
+        /**
+         * co_await-able form of CreateApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::CreateApplicationRequest, Model::CreateApplicationOutcome> CreateApplicationAwaitable(Model::CreateApplicationRequest request) const;
+
+        /**
+         * co_await-able form of CreateApplicationVersion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::CreateApplicationVersionRequest, Model::CreateApplicationVersionOutcome> CreateApplicationVersionAwaitable(Model::CreateApplicationVersionRequest request) const;
+
+        /**
+         * co_await-able form of CreateConfigurationTemplate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::CreateConfigurationTemplateRequest, Model::CreateConfigurationTemplateOutcome> CreateConfigurationTemplateAwaitable(Model::CreateConfigurationTemplateRequest request) const;
+
+        /**
+         * co_await-able form of CreateEnvironment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::CreateEnvironmentRequest, Model::CreateEnvironmentOutcome> CreateEnvironmentAwaitable(Model::CreateEnvironmentRequest request) const;
+
+        /**
+         * co_await-able form of CreateStorageLocation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::CreateStorageLocationRequest, Model::CreateStorageLocationOutcome> CreateStorageLocationAwaitable(Model::CreateStorageLocationRequest request) const;
+
+        /**
+         * co_await-able form of DeleteApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::DeleteApplicationRequest, Model::DeleteApplicationOutcome> DeleteApplicationAwaitable(Model::DeleteApplicationRequest request) const;
+
+        /**
+         * co_await-able form of DeleteApplicationVersion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::DeleteApplicationVersionRequest, Model::DeleteApplicationVersionOutcome> DeleteApplicationVersionAwaitable(Model::DeleteApplicationVersionRequest request) const;
+
+        /**
+         * co_await-able form of DeleteConfigurationTemplate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::DeleteConfigurationTemplateRequest, Model::DeleteConfigurationTemplateOutcome> DeleteConfigurationTemplateAwaitable(Model::DeleteConfigurationTemplateRequest request) const;
+
+        /**
+         * co_await-able form of DeleteEnvironmentConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::DeleteEnvironmentConfigurationRequest, Model::DeleteEnvironmentConfigurationOutcome> DeleteEnvironmentConfigurationAwaitable(Model::DeleteEnvironmentConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of DescribeApplicationVersions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::DescribeApplicationVersionsRequest, Model::DescribeApplicationVersionsOutcome> DescribeApplicationVersionsAwaitable(Model::DescribeApplicationVersionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeApplications(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::DescribeApplicationsRequest, Model::DescribeApplicationsOutcome> DescribeApplicationsAwaitable(Model::DescribeApplicationsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeConfigurationOptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::DescribeConfigurationOptionsRequest, Model::DescribeConfigurationOptionsOutcome> DescribeConfigurationOptionsAwaitable(Model::DescribeConfigurationOptionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeConfigurationSettings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::DescribeConfigurationSettingsRequest, Model::DescribeConfigurationSettingsOutcome> DescribeConfigurationSettingsAwaitable(Model::DescribeConfigurationSettingsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEnvironmentHealth(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::DescribeEnvironmentHealthRequest, Model::DescribeEnvironmentHealthOutcome> DescribeEnvironmentHealthAwaitable(Model::DescribeEnvironmentHealthRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEnvironmentManagedActionHistory(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::DescribeEnvironmentManagedActionHistoryRequest, Model::DescribeEnvironmentManagedActionHistoryOutcome> DescribeEnvironmentManagedActionHistoryAwaitable(Model::DescribeEnvironmentManagedActionHistoryRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEnvironmentManagedActions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::DescribeEnvironmentManagedActionsRequest, Model::DescribeEnvironmentManagedActionsOutcome> DescribeEnvironmentManagedActionsAwaitable(Model::DescribeEnvironmentManagedActionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEnvironmentResources(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::DescribeEnvironmentResourcesRequest, Model::DescribeEnvironmentResourcesOutcome> DescribeEnvironmentResourcesAwaitable(Model::DescribeEnvironmentResourcesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEnvironments(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::DescribeEnvironmentsRequest, Model::DescribeEnvironmentsOutcome> DescribeEnvironmentsAwaitable(Model::DescribeEnvironmentsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEvents(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::DescribeEventsRequest, Model::DescribeEventsOutcome> DescribeEventsAwaitable(Model::DescribeEventsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeInstancesHealth(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::DescribeInstancesHealthRequest, Model::DescribeInstancesHealthOutcome> DescribeInstancesHealthAwaitable(Model::DescribeInstancesHealthRequest request) const;
+
+        /**
+         * co_await-able form of ListAvailableSolutionStacks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::ListAvailableSolutionStacksRequest, Model::ListAvailableSolutionStacksOutcome> ListAvailableSolutionStacksAwaitable(Model::ListAvailableSolutionStacksRequest request) const;
+
+        /**
+         * co_await-able form of RebuildEnvironment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::RebuildEnvironmentRequest, Model::RebuildEnvironmentOutcome> RebuildEnvironmentAwaitable(Model::RebuildEnvironmentRequest request) const;
+
+        /**
+         * co_await-able form of RequestEnvironmentInfo(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::RequestEnvironmentInfoRequest, Model::RequestEnvironmentInfoOutcome> RequestEnvironmentInfoAwaitable(Model::RequestEnvironmentInfoRequest request) const;
+
+        /**
+         * co_await-able form of RestartAppServer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::RestartAppServerRequest, Model::RestartAppServerOutcome> RestartAppServerAwaitable(Model::RestartAppServerRequest request) const;
+
+        /**
+         * co_await-able form of RetrieveEnvironmentInfo(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::RetrieveEnvironmentInfoRequest, Model::RetrieveEnvironmentInfoOutcome> RetrieveEnvironmentInfoAwaitable(Model::RetrieveEnvironmentInfoRequest request) const;
+
+        /**
+         * co_await-able form of SwapEnvironmentCNAMEs(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::SwapEnvironmentCNAMEsRequest, Model::SwapEnvironmentCNAMEsOutcome> SwapEnvironmentCNAMEsAwaitable(Model::SwapEnvironmentCNAMEsRequest request) const;
+
+        /**
+         * co_await-able form of TerminateEnvironment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::TerminateEnvironmentRequest, Model::TerminateEnvironmentOutcome> TerminateEnvironmentAwaitable(Model::TerminateEnvironmentRequest request) const;
+
+        /**
+         * co_await-able form of UpdateApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::UpdateApplicationRequest, Model::UpdateApplicationOutcome> UpdateApplicationAwaitable(Model::UpdateApplicationRequest request) const;
+
+        /**
+         * co_await-able form of UpdateApplicationVersion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::UpdateApplicationVersionRequest, Model::UpdateApplicationVersionOutcome> UpdateApplicationVersionAwaitable(Model::UpdateApplicationVersionRequest request) const;
+
+        /**
+         * co_await-able form of UpdateConfigurationTemplate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::UpdateConfigurationTemplateRequest, Model::UpdateConfigurationTemplateOutcome> UpdateConfigurationTemplateAwaitable(Model::UpdateConfigurationTemplateRequest request) const;
+
+        /**
+         * co_await-able form of UpdateEnvironment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::UpdateEnvironmentRequest, Model::UpdateEnvironmentOutcome> UpdateEnvironmentAwaitable(Model::UpdateEnvironmentRequest request) const;
+
+        /**
+         * co_await-able form of ValidateConfigurationSettings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticBeanstalkClient, Model::ValidateConfigurationSettingsRequest, Model::ValidateConfigurationSettingsOutcome> ValidateConfigurationSettingsAwaitable(Model::ValidateConfigurationSettingsRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
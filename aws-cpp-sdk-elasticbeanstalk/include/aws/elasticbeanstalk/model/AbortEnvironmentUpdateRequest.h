@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AbortEnvironmentUpdateRequest();
+    inline const char* GetServiceRequestName() const override { return "AbortEnvironmentUpdate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ApplyEnvironmentManagedActionRequest();
+    inline const char* GetServiceRequestName() const override { return "ApplyEnvironmentManagedAction"; }
+
     Aws::String SerializePayload() const override;
 
     /**
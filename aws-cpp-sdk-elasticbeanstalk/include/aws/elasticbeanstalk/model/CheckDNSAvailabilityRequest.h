@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CheckDNSAvailabilityRequest();
+    inline const char* GetServiceRequestName() const override { return "CheckDNSAvailability"; }
+
     Aws::String SerializePayload() const override;
 
     /**
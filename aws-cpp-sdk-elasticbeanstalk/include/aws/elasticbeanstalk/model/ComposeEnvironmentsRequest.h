@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ComposeEnvironmentsRequest();
+    inline const char* GetServiceRequestName() const override { return "ComposeEnvironments"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateApplicationVersionRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateApplicationVersion"; }
+
     Aws::String SerializePayload() const override;
 
     /**
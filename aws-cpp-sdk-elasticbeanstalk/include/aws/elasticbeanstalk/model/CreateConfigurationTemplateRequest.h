@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateConfigurationTemplateRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateConfigurationTemplate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     CreateEnvironmentRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateEnvironment"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     CreateStorageLocationRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateStorageLocation"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteApplicationRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteApplication"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteApplicationVersionRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteApplicationVersion"; }
+
     Aws::String SerializePayload() const override;
 
     /**
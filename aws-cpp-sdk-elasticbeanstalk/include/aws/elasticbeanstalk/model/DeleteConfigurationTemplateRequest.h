@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteConfigurationTemplateRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteConfigurationTemplate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteEnvironmentConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteEnvironmentConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
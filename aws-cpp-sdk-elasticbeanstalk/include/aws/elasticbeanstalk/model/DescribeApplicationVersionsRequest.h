@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeApplicationVersionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeApplicationVersions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
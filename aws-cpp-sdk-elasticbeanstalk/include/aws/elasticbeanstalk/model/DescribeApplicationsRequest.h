@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeApplicationsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeApplications"; }
+
     Aws::String SerializePayload() const override;
 
     /**
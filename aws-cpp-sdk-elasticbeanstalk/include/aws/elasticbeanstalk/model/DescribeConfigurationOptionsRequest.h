@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeConfigurationOptionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeConfigurationOptions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeConfigurationSettingsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeConfigurationSettings"; }
+
     Aws::String SerializePayload() const override;
 
     /**
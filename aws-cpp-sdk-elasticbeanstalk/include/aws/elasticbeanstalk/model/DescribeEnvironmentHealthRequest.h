@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeEnvironmentHealthRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEnvironmentHealth"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeEnvironmentManagedActionHistoryRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEnvironmentManagedActionHistory"; }
+
     Aws::String SerializePayload() const override;
 
     /**
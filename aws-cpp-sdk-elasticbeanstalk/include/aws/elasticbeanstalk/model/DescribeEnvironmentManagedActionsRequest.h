@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeEnvironmentManagedActionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEnvironmentManagedActions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
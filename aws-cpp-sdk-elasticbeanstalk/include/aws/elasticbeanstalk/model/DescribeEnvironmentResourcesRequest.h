@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeEnvironmentResourcesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEnvironmentResources"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeEnvironmentsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEnvironments"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeInstancesHealthRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeInstancesHealth"; }
+
     Aws::String SerializePayload() const override;
 
     /**
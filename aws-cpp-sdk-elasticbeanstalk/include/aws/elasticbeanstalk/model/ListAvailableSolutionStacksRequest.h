@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     ListAvailableSolutionStacksRequest();
+    inline const char* GetServiceRequestName() const override { return "ListAvailableSolutionStacks"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RebuildEnvironmentRequest();
+    inline const char* GetServiceRequestName() const override { return "RebuildEnvironment"; }
+
     Aws::String SerializePayload() const override;
 
     /**
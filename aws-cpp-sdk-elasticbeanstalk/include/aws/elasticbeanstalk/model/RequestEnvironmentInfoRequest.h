@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     RequestEnvironmentInfoRequest();
+    inline const char* GetServiceRequestName() const override { return "RequestEnvironmentInfo"; }
+
     Aws::String SerializePayload() const override;
 
     /**
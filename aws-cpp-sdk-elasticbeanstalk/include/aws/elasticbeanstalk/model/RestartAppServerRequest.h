@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RestartAppServerRequest();
+    inline const char* GetServiceRequestName() const override { return "RestartAppServer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RetrieveEnvironmentInfoRequest();
+    inline const char* GetServiceRequestName() const override { return "RetrieveEnvironmentInfo"; }
+
     Aws::String SerializePayload() const override;
 
     /**
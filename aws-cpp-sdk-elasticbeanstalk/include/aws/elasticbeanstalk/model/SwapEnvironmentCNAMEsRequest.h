@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     SwapEnvironmentCNAMEsRequest();
+    inline const char* GetServiceRequestName() const override { return "SwapEnvironmentCNAMEs"; }
+
     Aws::String SerializePayload() const override;
 
     /**
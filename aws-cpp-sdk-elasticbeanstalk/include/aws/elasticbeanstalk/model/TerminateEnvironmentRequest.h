@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     TerminateEnvironmentRequest();
+    inline const char* GetServiceRequestName() const override { return "TerminateEnvironment"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateApplicationRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateApplication"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateApplicationVersionRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateApplicationVersion"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     UpdateConfigurationTemplateRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateConfigurationTemplate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
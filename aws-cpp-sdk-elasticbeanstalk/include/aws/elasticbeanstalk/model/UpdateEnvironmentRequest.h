@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     UpdateEnvironmentRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateEnvironment"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ValidateConfigurationSettingsRequest();
+    inline const char* GetServiceRequestName() const override { return "ValidateConfigurationSettings"; }
+
     Aws::String SerializePayload() const override;
 
     /**
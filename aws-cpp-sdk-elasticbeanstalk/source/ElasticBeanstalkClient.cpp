@@ -145,7 +145,7 @@ AbortEnvironmentUpdateOutcome ElasticBeanstalkClient::AbortEnvironmentUpdate(con
 
 AbortEnvironmentUpdateOutcomeCallable ElasticBeanstalkClient::AbortEnvironmentUpdateCallable(const AbortEnvironmentUpdateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AbortEnvironmentUpdate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AbortEnvironmentUpdate( request ); } );
 }
 
 void ElasticBeanstalkClient::AbortEnvironmentUpdateAsync(const AbortEnvironmentUpdateRequest& request, const AbortEnvironmentUpdateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -153,6 +153,16 @@ void ElasticBeanstalkClient::AbortEnvironmentUpdateAsync(const AbortEnvironmentU
   m_executor->Submit( [this, request, handler, context](){ this->AbortEnvironmentUpdateAsyncHelper( request, handler, context ); } );
 }
 
+AbortEnvironmentUpdateOutcomeCallable ElasticBeanstalkClient::AbortEnvironmentUpdateCallable(AbortEnvironmentUpdateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::AbortEnvironmentUpdate, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::AbortEnvironmentUpdateAsync(AbortEnvironmentUpdateRequest&& request, const AbortEnvironmentUpdateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::AbortEnvironmentUpdateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::AbortEnvironmentUpdateAsyncHelper(const AbortEnvironmentUpdateRequest& request, const AbortEnvironmentUpdateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AbortEnvironmentUpdate(request), context);
@@ -175,7 +185,7 @@ ApplyEnvironmentManagedActionOutcome ElasticBeanstalkClient::ApplyEnvironmentMan
 
 ApplyEnvironmentManagedActionOutcomeCallable ElasticBeanstalkClient::ApplyEnvironmentManagedActionCallable(const ApplyEnvironmentManagedActionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ApplyEnvironmentManagedAction( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ApplyEnvironmentManagedAction( request ); } );
 }
 
 void ElasticBeanstalkClient::ApplyEnvironmentManagedActionAsync(const ApplyEnvironmentManagedActionRequest& request, const ApplyEnvironmentManagedActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -183,6 +193,16 @@ void ElasticBeanstalkClient::ApplyEnvironmentManagedActionAsync(const ApplyEnvir
   m_executor->Submit( [this, request, handler, context](){ this->ApplyEnvironmentManagedActionAsyncHelper( request, handler, context ); } );
 }
 
+ApplyEnvironmentManagedActionOutcomeCallable ElasticBeanstalkClient::ApplyEnvironmentManagedActionCallable(ApplyEnvironmentManagedActionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::ApplyEnvironmentManagedAction, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::ApplyEnvironmentManagedActionAsync(ApplyEnvironmentManagedActionRequest&& request, const ApplyEnvironmentManagedActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::ApplyEnvironmentManagedActionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::ApplyEnvironmentManagedActionAsyncHelper(const ApplyEnvironmentManagedActionRequest& request, const ApplyEnvironmentManagedActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ApplyEnvironmentManagedAction(request), context);
@@ -205,7 +225,7 @@ CheckDNSAvailabilityOutcome ElasticBeanstalkClient::CheckDNSAvailability(const C
 
 CheckDNSAvailabilityOutcomeCallable ElasticBeanstalkClient::CheckDNSAvailabilityCallable(const CheckDNSAvailabilityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CheckDNSAvailability( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CheckDNSAvailability( request ); } );
 }
 
 void ElasticBeanstalkClient::CheckDNSAvailabilityAsync(const CheckDNSAvailabilityRequest& request, const CheckDNSAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -213,6 +233,16 @@ void ElasticBeanstalkClient::CheckDNSAvailabilityAsync(const CheckDNSAvailabilit
   m_executor->Submit( [this, request, handler, context](){ this->CheckDNSAvailabilityAsyncHelper( request, handler, context ); } );
 }
 
+CheckDNSAvailabilityOutcomeCallable ElasticBeanstalkClient::CheckDNSAvailabilityCallable(CheckDNSAvailabilityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::CheckDNSAvailability, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::CheckDNSAvailabilityAsync(CheckDNSAvailabilityRequest&& request, const CheckDNSAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::CheckDNSAvailabilityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::CheckDNSAvailabilityAsyncHelper(const CheckDNSAvailabilityRequest& request, const CheckDNSAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CheckDNSAvailability(request), context);
@@ -235,7 +265,7 @@ ComposeEnvironmentsOutcome ElasticBeanstalkClient::ComposeEnvironments(const Com
 
 ComposeEnvironmentsOutcomeCallable ElasticBeanstalkClient::ComposeEnvironmentsCallable(const ComposeEnvironmentsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ComposeEnvironments( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ComposeEnvironments( request ); } );
 }
 
 void ElasticBeanstalkClient::ComposeEnvironmentsAsync(const ComposeEnvironmentsRequest& request, const ComposeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -243,6 +273,16 @@ void ElasticBeanstalkClient::ComposeEnvironmentsAsync(const ComposeEnvironmentsR
   m_executor->Submit( [this, request, handler, context](){ this->ComposeEnvironmentsAsyncHelper( request, handler, context ); } );
 }
 
+ComposeEnvironmentsOutcomeCallable ElasticBeanstalkClient::ComposeEnvironmentsCallable(ComposeEnvironmentsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::ComposeEnvironments, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::ComposeEnvironmentsAsync(ComposeEnvironmentsRequest&& request, const ComposeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::ComposeEnvironmentsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::ComposeEnvironmentsAsyncHelper(const ComposeEnvironmentsRequest& request, const ComposeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ComposeEnvironments(request), context);
@@ -265,7 +305,7 @@ CreateApplicationOutcome ElasticBeanstalkClient::CreateApplication(const CreateA
 
 CreateApplicationOutcomeCallable ElasticBeanstalkClient::CreateApplicationCallable(const CreateApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateApplication( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateApplication( request ); } );
 }
 
 void ElasticBeanstalkClient::CreateApplicationAsync(const CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -273,6 +313,16 @@ void ElasticBeanstalkClient::CreateApplicationAsync(const CreateApplicationReque
   m_executor->Submit( [this, request, handler, context](){ this->CreateApplicationAsyncHelper( request, handler, context ); } );
 }
 
+CreateApplicationOutcomeCallable ElasticBeanstalkClient::CreateApplicationCallable(CreateApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::CreateApplication, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::CreateApplicationAsync(CreateApplicationRequest&& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::CreateApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::CreateApplicationAsyncHelper(const CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateApplication(request), context);
@@ -295,7 +345,7 @@ CreateApplicationVersionOutcome ElasticBeanstalkClient::CreateApplicationVersion
 
 CreateApplicationVersionOutcomeCallable ElasticBeanstalkClient::CreateApplicationVersionCallable(const CreateApplicationVersionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateApplicationVersion( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateApplicationVersion( request ); } );
 }
 
 void ElasticBeanstalkClient::CreateApplicationVersionAsync(const CreateApplicationVersionRequest& request, const CreateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -303,6 +353,16 @@ void ElasticBeanstalkClient::CreateApplicationVersionAsync(const CreateApplicati
   m_executor->Submit( [this, request, handler, context](){ this->CreateApplicationVersionAsyncHelper( request, handler, context ); } );
 }
 
+CreateApplicationVersionOutcomeCallable ElasticBeanstalkClient::CreateApplicationVersionCallable(CreateApplicationVersionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::CreateApplicationVersion, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::CreateApplicationVersionAsync(CreateApplicationVersionRequest&& request, const CreateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::CreateApplicationVersionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::CreateApplicationVersionAsyncHelper(const CreateApplicationVersionRequest& request, const CreateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateApplicationVersion(request), context);
@@ -325,7 +385,7 @@ CreateConfigurationTemplateOutcome ElasticBeanstalkClient::CreateConfigurationTe
 
 CreateConfigurationTemplateOutcomeCallable ElasticBeanstalkClient::CreateConfigurationTemplateCallable(const CreateConfigurationTemplateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateConfigurationTemplate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateConfigurationTemplate( request ); } );
 }
 
 void ElasticBeanstalkClient::CreateConfigurationTemplateAsync(const CreateConfigurationTemplateRequest& request, const CreateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -333,6 +393,16 @@ void ElasticBeanstalkClient::CreateConfigurationTemplateAsync(const CreateConfig
   m_executor->Submit( [this, request, handler, context](){ this->CreateConfigurationTemplateAsyncHelper( request, handler, context ); } );
 }
 
+CreateConfigurationTemplateOutcomeCallable ElasticBeanstalkClient::CreateConfigurationTemplateCallable(CreateConfigurationTemplateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::CreateConfigurationTemplate, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::CreateConfigurationTemplateAsync(CreateConfigurationTemplateRequest&& request, const CreateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::CreateConfigurationTemplateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::CreateConfigurationTemplateAsyncHelper(const CreateConfigurationTemplateRequest& request, const CreateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateConfigurationTemplate(request), context);
@@ -355,7 +425,7 @@ CreateEnvironmentOutcome ElasticBeanstalkClient::CreateEnvironment(const CreateE
 
 CreateEnvironmentOutcomeCallable ElasticBeanstalkClient::CreateEnvironmentCallable(const CreateEnvironmentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateEnvironment( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateEnvironment( request ); } );
 }
 
 void ElasticBeanstalkClient::CreateEnvironmentAsync(const CreateEnvironmentRequest& request, const CreateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -363,6 +433,16 @@ void ElasticBeanstalkClient::CreateEnvironmentAsync(const CreateEnvironmentReque
   m_executor->Submit( [this, request, handler, context](){ this->CreateEnvironmentAsyncHelper( request, handler, context ); } );
 }
 
+CreateEnvironmentOutcomeCallable ElasticBeanstalkClient::CreateEnvironmentCallable(CreateEnvironmentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::CreateEnvironment, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::CreateEnvironmentAsync(CreateEnvironmentRequest&& request, const CreateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::CreateEnvironmentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::CreateEnvironmentAsyncHelper(const CreateEnvironmentRequest& request, const CreateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateEnvironment(request), context);
@@ -385,7 +465,7 @@ CreateStorageLocationOutcome ElasticBeanstalkClient::CreateStorageLocation(const
 
 CreateStorageLocationOutcomeCallable ElasticBeanstalkClient::CreateStorageLocationCallable(const CreateStorageLocationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateStorageLocation( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateStorageLocation( request ); } );
 }
 
 void ElasticBeanstalkClient::CreateStorageLocationAsync(const CreateStorageLocationRequest& request, const CreateStorageLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -393,6 +473,16 @@ void ElasticBeanstalkClient::CreateStorageLocationAsync(const CreateStorageLocat
   m_executor->Submit( [this, request, handler, context](){ this->CreateStorageLocationAsyncHelper( request, handler, context ); } );
 }
 
+CreateStorageLocationOutcomeCallable ElasticBeanstalkClient::CreateStorageLocationCallable(CreateStorageLocationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::CreateStorageLocation, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::CreateStorageLocationAsync(CreateStorageLocationRequest&& request, const CreateStorageLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::CreateStorageLocationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::CreateStorageLocationAsyncHelper(const CreateStorageLocationRequest& request, const CreateStorageLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateStorageLocation(request), context);
@@ -415,7 +505,7 @@ DeleteApplicationOutcome ElasticBeanstalkClient::DeleteApplication(const DeleteA
 
 DeleteApplicationOutcomeCallable ElasticBeanstalkClient::DeleteApplicationCallable(const DeleteApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteApplication( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteApplication( request ); } );
 }
 
 void ElasticBeanstalkClient::DeleteApplicationAsync(const DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -423,6 +513,16 @@ void ElasticBeanstalkClient::DeleteApplicationAsync(const DeleteApplicationReque
   m_executor->Submit( [this, request, handler, context](){ this->DeleteApplicationAsyncHelper( request, handler, context ); } );
 }
 
+DeleteApplicationOutcomeCallable ElasticBeanstalkClient::DeleteApplicationCallable(DeleteApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::DeleteApplication, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::DeleteApplicationAsync(DeleteApplicationRequest&& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::DeleteApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::DeleteApplicationAsyncHelper(const DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteApplication(request), context);
@@ -445,7 +545,7 @@ DeleteApplicationVersionOutcome ElasticBeanstalkClient::DeleteApplicationVersion
 
 DeleteApplicationVersionOutcomeCallable ElasticBeanstalkClient::DeleteApplicationVersionCallable(const DeleteApplicationVersionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteApplicationVersion( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteApplicationVersion( request ); } );
 }
 
 void ElasticBeanstalkClient::DeleteApplicationVersionAsync(const DeleteApplicationVersionRequest& request, const DeleteApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -453,6 +553,16 @@ void ElasticBeanstalkClient::DeleteApplicationVersionAsync(const DeleteApplicati
   m_executor->Submit( [this, request, handler, context](){ this->DeleteApplicationVersionAsyncHelper( request, handler, context ); } );
 }
 
+DeleteApplicationVersionOutcomeCallable ElasticBeanstalkClient::DeleteApplicationVersionCallable(DeleteApplicationVersionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::DeleteApplicationVersion, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::DeleteApplicationVersionAsync(DeleteApplicationVersionRequest&& request, const DeleteApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::DeleteApplicationVersionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::DeleteApplicationVersionAsyncHelper(const DeleteApplicationVersionRequest& request, const DeleteApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteApplicationVersion(request), context);
@@ -475,7 +585,7 @@ DeleteConfigurationTemplateOutcome ElasticBeanstalkClient::DeleteConfigurationTe
 
 DeleteConfigurationTemplateOutcomeCallable ElasticBeanstalkClient::DeleteConfigurationTemplateCallable(const DeleteConfigurationTemplateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteConfigurationTemplate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteConfigurationTemplate( request ); } );
 }
 
 void ElasticBeanstalkClient::DeleteConfigurationTemplateAsync(const DeleteConfigurationTemplateRequest& request, const DeleteConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -483,6 +593,16 @@ void ElasticBeanstalkClient::DeleteConfigurationTemplateAsync(const DeleteConfig
   m_executor->Submit( [this, request, handler, context](){ this->DeleteConfigurationTemplateAsyncHelper( request, handler, context ); } );
 }
 
+DeleteConfigurationTemplateOutcomeCallable ElasticBeanstalkClient::DeleteConfigurationTemplateCallable(DeleteConfigurationTemplateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::DeleteConfigurationTemplate, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::DeleteConfigurationTemplateAsync(DeleteConfigurationTemplateRequest&& request, const DeleteConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::DeleteConfigurationTemplateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::DeleteConfigurationTemplateAsyncHelper(const DeleteConfigurationTemplateRequest& request, const DeleteConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteConfigurationTemplate(request), context);
@@ -505,7 +625,7 @@ DeleteEnvironmentConfigurationOutcome ElasticBeanstalkClient::DeleteEnvironmentC
 
 DeleteEnvironmentConfigurationOutcomeCallable ElasticBeanstalkClient::DeleteEnvironmentConfigurationCallable(const DeleteEnvironmentConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteEnvironmentConfiguration( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteEnvironmentConfiguration( request ); } );
 }
 
 void ElasticBeanstalkClient::DeleteEnvironmentConfigurationAsync(const DeleteEnvironmentConfigurationRequest& request, const DeleteEnvironmentConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -513,6 +633,16 @@ void ElasticBeanstalkClient::DeleteEnvironmentConfigurationAsync(const DeleteEnv
   m_executor->Submit( [this, request, handler, context](){ this->DeleteEnvironmentConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+DeleteEnvironmentConfigurationOutcomeCallable ElasticBeanstalkClient::DeleteEnvironmentConfigurationCallable(DeleteEnvironmentConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::DeleteEnvironmentConfiguration, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::DeleteEnvironmentConfigurationAsync(DeleteEnvironmentConfigurationRequest&& request, const DeleteEnvironmentConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::DeleteEnvironmentConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::DeleteEnvironmentConfigurationAsyncHelper(const DeleteEnvironmentConfigurationRequest& request, const DeleteEnvironmentConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteEnvironmentConfiguration(request), context);
@@ -535,7 +665,7 @@ DescribeApplicationVersionsOutcome ElasticBeanstalkClient::DescribeApplicationVe
 
 DescribeApplicationVersionsOutcomeCallable ElasticBeanstalkClient::DescribeApplicationVersionsCallable(const DescribeApplicationVersionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeApplicationVersions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeApplicationVersions( request ); } );
 }
 
 void ElasticBeanstalkClient::DescribeApplicationVersionsAsync(const DescribeApplicationVersionsRequest& request, const DescribeApplicationVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -543,6 +673,16 @@ void ElasticBeanstalkClient::DescribeApplicationVersionsAsync(const DescribeAppl
   m_executor->Submit( [this, request, handler, context](){ this->DescribeApplicationVersionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeApplicationVersionsOutcomeCallable ElasticBeanstalkClient::DescribeApplicationVersionsCallable(DescribeApplicationVersionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::DescribeApplicationVersions, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::DescribeApplicationVersionsAsync(DescribeApplicationVersionsRequest&& request, const DescribeApplicationVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::DescribeApplicationVersionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::DescribeApplicationVersionsAsyncHelper(const DescribeApplicationVersionsRequest& request, const DescribeApplicationVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeApplicationVersions(request), context);
@@ -565,7 +705,7 @@ DescribeApplicationsOutcome ElasticBeanstalkClient::DescribeApplications(const D
 
 DescribeApplicationsOutcomeCallable ElasticBeanstalkClient::DescribeApplicationsCallable(const DescribeApplicationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeApplications( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeApplications( request ); } );
 }
 
 void ElasticBeanstalkClient::DescribeApplicationsAsync(const DescribeApplicationsRequest& request, const DescribeApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -573,6 +713,16 @@ void ElasticBeanstalkClient::DescribeApplicationsAsync(const DescribeApplication
   m_executor->Submit( [this, request, handler, context](){ this->DescribeApplicationsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeApplicationsOutcomeCallable ElasticBeanstalkClient::DescribeApplicationsCallable(DescribeApplicationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::DescribeApplications, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::DescribeApplicationsAsync(DescribeApplicationsRequest&& request, const DescribeApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::DescribeApplicationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::DescribeApplicationsAsyncHelper(const DescribeApplicationsRequest& request, const DescribeApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeApplications(request), context);
@@ -595,7 +745,7 @@ DescribeConfigurationOptionsOutcome ElasticBeanstalkClient::DescribeConfiguratio
 
 DescribeConfigurationOptionsOutcomeCallable ElasticBeanstalkClient::DescribeConfigurationOptionsCallable(const DescribeConfigurationOptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeConfigurationOptions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeConfigurationOptions( request ); } );
 }
 
 void ElasticBeanstalkClient::DescribeConfigurationOptionsAsync(const DescribeConfigurationOptionsRequest& request, const DescribeConfigurationOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -603,6 +753,16 @@ void ElasticBeanstalkClient::DescribeConfigurationOptionsAsync(const DescribeCon
   m_executor->Submit( [this, request, handler, context](){ this->DescribeConfigurationOptionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeConfigurationOptionsOutcomeCallable ElasticBeanstalkClient::DescribeConfigurationOptionsCallable(DescribeConfigurationOptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::DescribeConfigurationOptions, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::DescribeConfigurationOptionsAsync(DescribeConfigurationOptionsRequest&& request, const DescribeConfigurationOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::DescribeConfigurationOptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::DescribeConfigurationOptionsAsyncHelper(const DescribeConfigurationOptionsRequest& request, const DescribeConfigurationOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeConfigurationOptions(request), context);
@@ -625,7 +785,7 @@ DescribeConfigurationSettingsOutcome ElasticBeanstalkClient::DescribeConfigurati
 
 DescribeConfigurationSettingsOutcomeCallable ElasticBeanstalkClient::DescribeConfigurationSettingsCallable(const DescribeConfigurationSettingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeConfigurationSettings( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeConfigurationSettings( request ); } );
 }
 
 void ElasticBeanstalkClient::DescribeConfigurationSettingsAsync(const DescribeConfigurationSettingsRequest& request, const DescribeConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -633,6 +793,16 @@ void ElasticBeanstalkClient::DescribeConfigurationSettingsAsync(const DescribeCo
   m_executor->Submit( [this, request, handler, context](){ this->DescribeConfigurationSettingsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeConfigurationSettingsOutcomeCallable ElasticBeanstalkClient::DescribeConfigurationSettingsCallable(DescribeConfigurationSettingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::DescribeConfigurationSettings, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::DescribeConfigurationSettingsAsync(DescribeConfigurationSettingsRequest&& request, const DescribeConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::DescribeConfigurationSettingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::DescribeConfigurationSettingsAsyncHelper(const DescribeConfigurationSettingsRequest& request, const DescribeConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeConfigurationSettings(request), context);
@@ -655,7 +825,7 @@ DescribeEnvironmentHealthOutcome ElasticBeanstalkClient::DescribeEnvironmentHeal
 
 DescribeEnvironmentHealthOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentHealthCallable(const DescribeEnvironmentHealthRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEnvironmentHealth( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEnvironmentHealth( request ); } );
 }
 
 void ElasticBeanstalkClient::DescribeEnvironmentHealthAsync(const DescribeEnvironmentHealthRequest& request, const DescribeEnvironmentHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -663,6 +833,16 @@ void ElasticBeanstalkClient::DescribeEnvironmentHealthAsync(const DescribeEnviro
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEnvironmentHealthAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEnvironmentHealthOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentHealthCallable(DescribeEnvironmentHealthRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::DescribeEnvironmentHealth, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::DescribeEnvironmentHealthAsync(DescribeEnvironmentHealthRequest&& request, const DescribeEnvironmentHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::DescribeEnvironmentHealthAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::DescribeEnvironmentHealthAsyncHelper(const DescribeEnvironmentHealthRequest& request, const DescribeEnvironmentHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEnvironmentHealth(request), context);
@@ -685,7 +865,7 @@ DescribeEnvironmentManagedActionHistoryOutcome ElasticBeanstalkClient::DescribeE
 
 DescribeEnvironmentManagedActionHistoryOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentManagedActionHistoryCallable(const DescribeEnvironmentManagedActionHistoryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEnvironmentManagedActionHistory( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEnvironmentManagedActionHistory( request ); } );
 }
 
 void ElasticBeanstalkClient::DescribeEnvironmentManagedActionHistoryAsync(const DescribeEnvironmentManagedActionHistoryRequest& request, const DescribeEnvironmentManagedActionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -693,6 +873,16 @@ void ElasticBeanstalkClient::DescribeEnvironmentManagedActionHistoryAsync(const
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEnvironmentManagedActionHistoryAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEnvironmentManagedActionHistoryOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentManagedActionHistoryCallable(DescribeEnvironmentManagedActionHistoryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::DescribeEnvironmentManagedActionHistory, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::DescribeEnvironmentManagedActionHistoryAsync(DescribeEnvironmentManagedActionHistoryRequest&& request, const DescribeEnvironmentManagedActionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::DescribeEnvironmentManagedActionHistoryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::DescribeEnvironmentManagedActionHistoryAsyncHelper(const DescribeEnvironmentManagedActionHistoryRequest& request, const DescribeEnvironmentManagedActionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEnvironmentManagedActionHistory(request), context);
@@ -715,7 +905,7 @@ DescribeEnvironmentManagedActionsOutcome ElasticBeanstalkClient::DescribeEnviron
 
 DescribeEnvironmentManagedActionsOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentManagedActionsCallable(const DescribeEnvironmentManagedActionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEnvironmentManagedActions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEnvironmentManagedActions( request ); } );
 }
 
 void ElasticBeanstalkClient::DescribeEnvironmentManagedActionsAsync(const DescribeEnvironmentManagedActionsRequest& request, const DescribeEnvironmentManagedActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -723,6 +913,16 @@ void ElasticBeanstalkClient::DescribeEnvironmentManagedActionsAsync(const Descri
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEnvironmentManagedActionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEnvironmentManagedActionsOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentManagedActionsCallable(DescribeEnvironmentManagedActionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::DescribeEnvironmentManagedActions, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::DescribeEnvironmentManagedActionsAsync(DescribeEnvironmentManagedActionsRequest&& request, const DescribeEnvironmentManagedActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::DescribeEnvironmentManagedActionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::DescribeEnvironmentManagedActionsAsyncHelper(const DescribeEnvironmentManagedActionsRequest& request, const DescribeEnvironmentManagedActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEnvironmentManagedActions(request), context);
@@ -745,7 +945,7 @@ DescribeEnvironmentResourcesOutcome ElasticBeanstalkClient::DescribeEnvironmentR
 
 DescribeEnvironmentResourcesOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentResourcesCallable(const DescribeEnvironmentResourcesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEnvironmentResources( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEnvironmentResources( request ); } );
 }
 
 void ElasticBeanstalkClient::DescribeEnvironmentResourcesAsync(const DescribeEnvironmentResourcesRequest& request, const DescribeEnvironmentResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -753,6 +953,16 @@ void ElasticBeanstalkClient::DescribeEnvironmentResourcesAsync(const DescribeEnv
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEnvironmentResourcesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEnvironmentResourcesOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentResourcesCallable(DescribeEnvironmentResourcesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::DescribeEnvironmentResources, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::DescribeEnvironmentResourcesAsync(DescribeEnvironmentResourcesRequest&& request, const DescribeEnvironmentResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::DescribeEnvironmentResourcesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::DescribeEnvironmentResourcesAsyncHelper(const DescribeEnvironmentResourcesRequest& request, const DescribeEnvironmentResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEnvironmentResources(request), context);
@@ -775,7 +985,7 @@ DescribeEnvironmentsOutcome ElasticBeanstalkClient::DescribeEnvironments(const D
 
 DescribeEnvironmentsOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentsCallable(const DescribeEnvironmentsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEnvironments( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEnvironments( request ); } );
 }
 
 void ElasticBeanstalkClient::DescribeEnvironmentsAsync(const DescribeEnvironmentsRequest& request, const DescribeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -783,6 +993,16 @@ void ElasticBeanstalkClient::DescribeEnvironmentsAsync(const DescribeEnvironment
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEnvironmentsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEnvironmentsOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentsCallable(DescribeEnvironmentsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::DescribeEnvironments, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::DescribeEnvironmentsAsync(DescribeEnvironmentsRequest&& request, const DescribeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::DescribeEnvironmentsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::DescribeEnvironmentsAsyncHelper(const DescribeEnvironmentsRequest& request, const DescribeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEnvironments(request), context);
@@ -805,7 +1025,7 @@ DescribeEventsOutcome ElasticBeanstalkClient::DescribeEvents(const DescribeEvent
 
 DescribeEventsOutcomeCallable ElasticBeanstalkClient::DescribeEventsCallable(const DescribeEventsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEvents( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEvents( request ); } );
 }
 
 void ElasticBeanstalkClient::DescribeEventsAsync(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -813,6 +1033,16 @@ void ElasticBeanstalkClient::DescribeEventsAsync(const DescribeEventsRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEventsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEventsOutcomeCallable ElasticBeanstalkClient::DescribeEventsCallable(DescribeEventsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::DescribeEvents, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::DescribeEventsAsync(DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::DescribeEventsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::DescribeEventsAsyncHelper(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEvents(request), context);
@@ -835,7 +1065,7 @@ DescribeInstancesHealthOutcome ElasticBeanstalkClient::DescribeInstancesHealth(c
 
 DescribeInstancesHealthOutcomeCallable ElasticBeanstalkClient::DescribeInstancesHealthCallable(const DescribeInstancesHealthRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeInstancesHealth( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeInstancesHealth( request ); } );
 }
 
 void ElasticBeanstalkClient::DescribeInstancesHealthAsync(const DescribeInstancesHealthRequest& request, const DescribeInstancesHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -843,6 +1073,16 @@ void ElasticBeanstalkClient::DescribeInstancesHealthAsync(const DescribeInstance
   m_executor->Submit( [this, request, handler, context](){ this->DescribeInstancesHealthAsyncHelper( request, handler, context ); } );
 }
 
+DescribeInstancesHealthOutcomeCallable ElasticBeanstalkClient::DescribeInstancesHealthCallable(DescribeInstancesHealthRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::DescribeInstancesHealth, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::DescribeInstancesHealthAsync(DescribeInstancesHealthRequest&& request, const DescribeInstancesHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::DescribeInstancesHealthAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::DescribeInstancesHealthAsyncHelper(const DescribeInstancesHealthRequest& request, const DescribeInstancesHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeInstancesHealth(request), context);
@@ -865,7 +1105,7 @@ ListAvailableSolutionStacksOutcome ElasticBeanstalkClient::ListAvailableSolution
 
 ListAvailableSolutionStacksOutcomeCallable ElasticBeanstalkClient::ListAvailableSolutionStacksCallable(const ListAvailableSolutionStacksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAvailableSolutionStacks( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAvailableSolutionStacks( request ); } );
 }
 
 void ElasticBeanstalkClient::ListAvailableSolutionStacksAsync(const ListAvailableSolutionStacksRequest& request, const ListAvailableSolutionStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -873,6 +1113,16 @@ void ElasticBeanstalkClient::ListAvailableSolutionStacksAsync(const ListAvailabl
   m_executor->Submit( [this, request, handler, context](){ this->ListAvailableSolutionStacksAsyncHelper( request, handler, context ); } );
 }
 
+ListAvailableSolutionStacksOutcomeCallable ElasticBeanstalkClient::ListAvailableSolutionStacksCallable(ListAvailableSolutionStacksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::ListAvailableSolutionStacks, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::ListAvailableSolutionStacksAsync(ListAvailableSolutionStacksRequest&& request, const ListAvailableSolutionStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::ListAvailableSolutionStacksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::ListAvailableSolutionStacksAsyncHelper(const ListAvailableSolutionStacksRequest& request, const ListAvailableSolutionStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAvailableSolutionStacks(request), context);
@@ -895,7 +1145,7 @@ RebuildEnvironmentOutcome ElasticBeanstalkClient::RebuildEnvironment(const Rebui
 
 RebuildEnvironmentOutcomeCallable ElasticBeanstalkClient::RebuildEnvironmentCallable(const RebuildEnvironmentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RebuildEnvironment( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RebuildEnvironment( request ); } );
 }
 
 void ElasticBeanstalkClient::RebuildEnvironmentAsync(const RebuildEnvironmentRequest& request, const RebuildEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -903,6 +1153,16 @@ void ElasticBeanstalkClient::RebuildEnvironmentAsync(const RebuildEnvironmentReq
   m_executor->Submit( [this, request, handler, context](){ this->RebuildEnvironmentAsyncHelper( request, handler, context ); } );
 }
 
+RebuildEnvironmentOutcomeCallable ElasticBeanstalkClient::RebuildEnvironmentCallable(RebuildEnvironmentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::RebuildEnvironment, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::RebuildEnvironmentAsync(RebuildEnvironmentRequest&& request, const RebuildEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::RebuildEnvironmentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::RebuildEnvironmentAsyncHelper(const RebuildEnvironmentRequest& request, const RebuildEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RebuildEnvironment(request), context);
@@ -925,7 +1185,7 @@ RequestEnvironmentInfoOutcome ElasticBeanstalkClient::RequestEnvironmentInfo(con
 
 RequestEnvironmentInfoOutcomeCallable ElasticBeanstalkClient::RequestEnvironmentInfoCallable(const RequestEnvironmentInfoRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RequestEnvironmentInfo( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RequestEnvironmentInfo( request ); } );
 }
 
 void ElasticBeanstalkClient::RequestEnvironmentInfoAsync(const RequestEnvironmentInfoRequest& request, const RequestEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -933,6 +1193,16 @@ void ElasticBeanstalkClient::RequestEnvironmentInfoAsync(const RequestEnvironmen
   m_executor->Submit( [this, request, handler, context](){ this->RequestEnvironmentInfoAsyncHelper( request, handler, context ); } );
 }
 
+RequestEnvironmentInfoOutcomeCallable ElasticBeanstalkClient::RequestEnvironmentInfoCallable(RequestEnvironmentInfoRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::RequestEnvironmentInfo, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::RequestEnvironmentInfoAsync(RequestEnvironmentInfoRequest&& request, const RequestEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::RequestEnvironmentInfoAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::RequestEnvironmentInfoAsyncHelper(const RequestEnvironmentInfoRequest& request, const RequestEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RequestEnvironmentInfo(request), context);
@@ -955,7 +1225,7 @@ RestartAppServerOutcome ElasticBeanstalkClient::RestartAppServer(const RestartAp
 
 RestartAppServerOutcomeCallable ElasticBeanstalkClient::RestartAppServerCallable(const RestartAppServerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RestartAppServer( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RestartAppServer( request ); } );
 }
 
 void ElasticBeanstalkClient::RestartAppServerAsync(const RestartAppServerRequest& request, const RestartAppServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -963,6 +1233,16 @@ void ElasticBeanstalkClient::RestartAppServerAsync(const RestartAppServerRequest
   m_executor->Submit( [this, request, handler, context](){ this->RestartAppServerAsyncHelper( request, handler, context ); } );
 }
 
+RestartAppServerOutcomeCallable ElasticBeanstalkClient::RestartAppServerCallable(RestartAppServerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::RestartAppServer, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::RestartAppServerAsync(RestartAppServerRequest&& request, const RestartAppServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::RestartAppServerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::RestartAppServerAsyncHelper(const RestartAppServerRequest& request, const RestartAppServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RestartAppServer(request), context);
@@ -985,7 +1265,7 @@ RetrieveEnvironmentInfoOutcome ElasticBeanstalkClient::RetrieveEnvironmentInfo(c
 
 RetrieveEnvironmentInfoOutcomeCallable ElasticBeanstalkClient::RetrieveEnvironmentInfoCallable(const RetrieveEnvironmentInfoRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RetrieveEnvironmentInfo( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RetrieveEnvironmentInfo( request ); } );
 }
 
 void ElasticBeanstalkClient::RetrieveEnvironmentInfoAsync(const RetrieveEnvironmentInfoRequest& request, const RetrieveEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -993,6 +1273,16 @@ void ElasticBeanstalkClient::RetrieveEnvironmentInfoAsync(const RetrieveEnvironm
   m_executor->Submit( [this, request, handler, context](){ this->RetrieveEnvironmentInfoAsyncHelper( request, handler, context ); } );
 }
 
+RetrieveEnvironmentInfoOutcomeCallable ElasticBeanstalkClient::RetrieveEnvironmentInfoCallable(RetrieveEnvironmentInfoRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::RetrieveEnvironmentInfo, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::RetrieveEnvironmentInfoAsync(RetrieveEnvironmentInfoRequest&& request, const RetrieveEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::RetrieveEnvironmentInfoAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::RetrieveEnvironmentInfoAsyncHelper(const RetrieveEnvironmentInfoRequest& request, const RetrieveEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RetrieveEnvironmentInfo(request), context);
@@ -1015,7 +1305,7 @@ SwapEnvironmentCNAMEsOutcome ElasticBeanstalkClient::SwapEnvironmentCNAMEs(const
 
 SwapEnvironmentCNAMEsOutcomeCallable ElasticBeanstalkClient::SwapEnvironmentCNAMEsCallable(const SwapEnvironmentCNAMEsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SwapEnvironmentCNAMEs( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SwapEnvironmentCNAMEs( request ); } );
 }
 
 void ElasticBeanstalkClient::SwapEnvironmentCNAMEsAsync(const SwapEnvironmentCNAMEsRequest& request, const SwapEnvironmentCNAMEsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1023,6 +1313,16 @@ void ElasticBeanstalkClient::SwapEnvironmentCNAMEsAsync(const SwapEnvironmentCNA
   m_executor->Submit( [this, request, handler, context](){ this->SwapEnvironmentCNAMEsAsyncHelper( request, handler, context ); } );
 }
 
+SwapEnvironmentCNAMEsOutcomeCallable ElasticBeanstalkClient::SwapEnvironmentCNAMEsCallable(SwapEnvironmentCNAMEsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::SwapEnvironmentCNAMEs, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::SwapEnvironmentCNAMEsAsync(SwapEnvironmentCNAMEsRequest&& request, const SwapEnvironmentCNAMEsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::SwapEnvironmentCNAMEsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::SwapEnvironmentCNAMEsAsyncHelper(const SwapEnvironmentCNAMEsRequest& request, const SwapEnvironmentCNAMEsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SwapEnvironmentCNAMEs(request), context);
@@ -1045,7 +1345,7 @@ TerminateEnvironmentOutcome ElasticBeanstalkClient::TerminateEnvironment(const T
 
 TerminateEnvironmentOutcomeCallable ElasticBeanstalkClient::TerminateEnvironmentCallable(const TerminateEnvironmentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TerminateEnvironment( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TerminateEnvironment( request ); } );
 }
 
 void ElasticBeanstalkClient::TerminateEnvironmentAsync(const TerminateEnvironmentRequest& request, const TerminateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1053,6 +1353,16 @@ void ElasticBeanstalkClient::TerminateEnvironmentAsync(const TerminateEnvironmen
   m_executor->Submit( [this, request, handler, context](){ this->TerminateEnvironmentAsyncHelper( request, handler, context ); } );
 }
 
+TerminateEnvironmentOutcomeCallable ElasticBeanstalkClient::TerminateEnvironmentCallable(TerminateEnvironmentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::TerminateEnvironment, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::TerminateEnvironmentAsync(TerminateEnvironmentRequest&& request, const TerminateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::TerminateEnvironmentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::TerminateEnvironmentAsyncHelper(const TerminateEnvironmentRequest& request, const TerminateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TerminateEnvironment(request), context);
@@ -1075,7 +1385,7 @@ UpdateApplicationOutcome ElasticBeanstalkClient::UpdateApplication(const UpdateA
 
 UpdateApplicationOutcomeCallable ElasticBeanstalkClient::UpdateApplicationCallable(const UpdateApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateApplication( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateApplication( request ); } );
 }
 
 void ElasticBeanstalkClient::UpdateApplicationAsync(const UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1083,6 +1393,16 @@ void ElasticBeanstalkClient::UpdateApplicationAsync(const UpdateApplicationReque
   m_executor->Submit( [this, request, handler, context](){ this->UpdateApplicationAsyncHelper( request, handler, context ); } );
 }
 
+UpdateApplicationOutcomeCallable ElasticBeanstalkClient::UpdateApplicationCallable(UpdateApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::UpdateApplication, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::UpdateApplicationAsync(UpdateApplicationRequest&& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::UpdateApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::UpdateApplicationAsyncHelper(const UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateApplication(request), context);
@@ -1105,7 +1425,7 @@ UpdateApplicationVersionOutcome ElasticBeanstalkClient::UpdateApplicationVersion
 
 UpdateApplicationVersionOutcomeCallable ElasticBeanstalkClient::UpdateApplicationVersionCallable(const UpdateApplicationVersionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateApplicationVersion( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateApplicationVersion( request ); } );
 }
 
 void ElasticBeanstalkClient::UpdateApplicationVersionAsync(const UpdateApplicationVersionRequest& request, const UpdateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1113,6 +1433,16 @@ void ElasticBeanstalkClient::UpdateApplicationVersionAsync(const UpdateApplicati
   m_executor->Submit( [this, request, handler, context](){ this->UpdateApplicationVersionAsyncHelper( request, handler, context ); } );
 }
 
+UpdateApplicationVersionOutcomeCallable ElasticBeanstalkClient::UpdateApplicationVersionCallable(UpdateApplicationVersionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::UpdateApplicationVersion, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::UpdateApplicationVersionAsync(UpdateApplicationVersionRequest&& request, const UpdateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::UpdateApplicationVersionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::UpdateApplicationVersionAsyncHelper(const UpdateApplicationVersionRequest& request, const UpdateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateApplicationVersion(request), context);
@@ -1135,7 +1465,7 @@ UpdateConfigurationTemplateOutcome ElasticBeanstalkClient::UpdateConfigurationTe
 
 UpdateConfigurationTemplateOutcomeCallable ElasticBeanstalkClient::UpdateConfigurationTemplateCallable(const UpdateConfigurationTemplateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateConfigurationTemplate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateConfigurationTemplate( request ); } );
 }
 
 void ElasticBeanstalkClient::UpdateConfigurationTemplateAsync(const UpdateConfigurationTemplateRequest& request, const UpdateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1143,6 +1473,16 @@ void ElasticBeanstalkClient::UpdateConfigurationTemplateAsync(const UpdateConfig
   m_executor->Submit( [this, request, handler, context](){ this->UpdateConfigurationTemplateAsyncHelper( request, handler, context ); } );
 }
 
+UpdateConfigurationTemplateOutcomeCallable ElasticBeanstalkClient::UpdateConfigurationTemplateCallable(UpdateConfigurationTemplateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::UpdateConfigurationTemplate, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::UpdateConfigurationTemplateAsync(UpdateConfigurationTemplateRequest&& request, const UpdateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::UpdateConfigurationTemplateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::UpdateConfigurationTemplateAsyncHelper(const UpdateConfigurationTemplateRequest& request, const UpdateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateConfigurationTemplate(request), context);
@@ -1165,7 +1505,7 @@ UpdateEnvironmentOutcome ElasticBeanstalkClient::UpdateEnvironment(const UpdateE
 
 UpdateEnvironmentOutcomeCallable ElasticBeanstalkClient::UpdateEnvironmentCallable(const UpdateEnvironmentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateEnvironment( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateEnvironment( request ); } );
 }
 
 void ElasticBeanstalkClient::UpdateEnvironmentAsync(const UpdateEnvironmentRequest& request, const UpdateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1173,6 +1513,16 @@ void ElasticBeanstalkClient::UpdateEnvironmentAsync(const UpdateEnvironmentReque
   m_executor->Submit( [this, request, handler, context](){ this->UpdateEnvironmentAsyncHelper( request, handler, context ); } );
 }
 
+UpdateEnvironmentOutcomeCallable ElasticBeanstalkClient::UpdateEnvironmentCallable(UpdateEnvironmentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::UpdateEnvironment, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::UpdateEnvironmentAsync(UpdateEnvironmentRequest&& request, const UpdateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::UpdateEnvironmentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::UpdateEnvironmentAsyncHelper(const UpdateEnvironmentRequest& request, const UpdateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateEnvironment(request), context);
@@ -1195,7 +1545,7 @@ ValidateConfigurationSettingsOutcome ElasticBeanstalkClient::ValidateConfigurati
 
 ValidateConfigurationSettingsOutcomeCallable ElasticBeanstalkClient::ValidateConfigurationSettingsCallable(const ValidateConfigurationSettingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ValidateConfigurationSettings( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ValidateConfigurationSettings( request ); } );
 }
 
 void ElasticBeanstalkClient::ValidateConfigurationSettingsAsync(const ValidateConfigurationSettingsRequest& request, const ValidateConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1203,8 +1553,251 @@ void ElasticBeanstalkClient::ValidateConfigurationSettingsAsync(const ValidateCo
   m_executor->Submit( [this, request, handler, context](){ this->ValidateConfigurationSettingsAsyncHelper( request, handler, context ); } );
 }
 
+ValidateConfigurationSettingsOutcomeCallable ElasticBeanstalkClient::ValidateConfigurationSettingsCallable(ValidateConfigurationSettingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticBeanstalkClient::ValidateConfigurationSettings, this, std::move(request)));
+}
+
+void ElasticBeanstalkClient::ValidateConfigurationSettingsAsync(ValidateConfigurationSettingsRequest&& request, const ValidateConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticBeanstalkClient::ValidateConfigurationSettingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticBeanstalkClient::ValidateConfigurationSettingsAsyncHelper(const ValidateConfigurationSettingsRequest& request, const ValidateConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ValidateConfigurationSettings(request), context);
 }
 
+Paginator<ElasticBeanstalkClient, DescribeEnvironmentManagedActionHistoryRequest, DescribeEnvironmentManagedActionHistoryOutcome> ElasticBeanstalkClient::DescribeEnvironmentManagedActionHistoryPaginator(const DescribeEnvironmentManagedActionHistoryRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElasticBeanstalkClient, DescribeEnvironmentManagedActionHistoryRequest, DescribeEnvironmentManagedActionHistoryOutcome>(this, &ElasticBeanstalkClient::DescribeEnvironmentManagedActionHistory, request,
+    [](const DescribeEnvironmentManagedActionHistoryRequest& current, const DescribeEnvironmentManagedActionHistoryOutcome& outcome, DescribeEnvironmentManagedActionHistoryRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElasticBeanstalkClient, DescribeEventsRequest, DescribeEventsOutcome> ElasticBeanstalkClient::DescribeEventsPaginator(const DescribeEventsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElasticBeanstalkClient, DescribeEventsRequest, DescribeEventsOutcome>(this, &ElasticBeanstalkClient::DescribeEvents, request,
+    [](const DescribeEventsRequest& current, const DescribeEventsOutcome& outcome, DescribeEventsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElasticBeanstalkClient, DescribeInstancesHealthRequest, DescribeInstancesHealthOutcome> ElasticBeanstalkClient::DescribeInstancesHealthPaginator(const DescribeInstancesHealthRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElasticBeanstalkClient, DescribeInstancesHealthRequest, DescribeInstancesHealthOutcome>(this, &ElasticBeanstalkClient::DescribeInstancesHealth, request,
+    [](const DescribeInstancesHealthRequest& current, const DescribeInstancesHealthOutcome& outcome, DescribeInstancesHealthRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<ElasticBeanstalkClient, AbortEnvironmentUpdateRequest, AbortEnvironmentUpdateOutcome> ElasticBeanstalkClient::AbortEnvironmentUpdateAwaitable(AbortEnvironmentUpdateRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::AbortEnvironmentUpdate, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, ApplyEnvironmentManagedActionRequest, ApplyEnvironmentManagedActionOutcome> ElasticBeanstalkClient::ApplyEnvironmentManagedActionAwaitable(ApplyEnvironmentManagedActionRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::ApplyEnvironmentManagedAction, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, CheckDNSAvailabilityRequest, CheckDNSAvailabilityOutcome> ElasticBeanstalkClient::CheckDNSAvailabilityAwaitable(CheckDNSAvailabilityRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::CheckDNSAvailability, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, ComposeEnvironmentsRequest, ComposeEnvironmentsOutcome> ElasticBeanstalkClient::ComposeEnvironmentsAwaitable(ComposeEnvironmentsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::ComposeEnvironments, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, CreateApplicationRequest, CreateApplicationOutcome> ElasticBeanstalkClient::CreateApplicationAwaitable(CreateApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::CreateApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, CreateApplicationVersionRequest, CreateApplicationVersionOutcome> ElasticBeanstalkClient::CreateApplicationVersionAwaitable(CreateApplicationVersionRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::CreateApplicationVersion, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, CreateConfigurationTemplateRequest, CreateConfigurationTemplateOutcome> ElasticBeanstalkClient::CreateConfigurationTemplateAwaitable(CreateConfigurationTemplateRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::CreateConfigurationTemplate, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, CreateEnvironmentRequest, CreateEnvironmentOutcome> ElasticBeanstalkClient::CreateEnvironmentAwaitable(CreateEnvironmentRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::CreateEnvironment, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, CreateStorageLocationRequest, CreateStorageLocationOutcome> ElasticBeanstalkClient::CreateStorageLocationAwaitable(CreateStorageLocationRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::CreateStorageLocation, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, DeleteApplicationRequest, DeleteApplicationOutcome> ElasticBeanstalkClient::DeleteApplicationAwaitable(DeleteApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::DeleteApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, DeleteApplicationVersionRequest, DeleteApplicationVersionOutcome> ElasticBeanstalkClient::DeleteApplicationVersionAwaitable(DeleteApplicationVersionRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::DeleteApplicationVersion, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, DeleteConfigurationTemplateRequest, DeleteConfigurationTemplateOutcome> ElasticBeanstalkClient::DeleteConfigurationTemplateAwaitable(DeleteConfigurationTemplateRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::DeleteConfigurationTemplate, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, DeleteEnvironmentConfigurationRequest, DeleteEnvironmentConfigurationOutcome> ElasticBeanstalkClient::DeleteEnvironmentConfigurationAwaitable(DeleteEnvironmentConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::DeleteEnvironmentConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, DescribeApplicationVersionsRequest, DescribeApplicationVersionsOutcome> ElasticBeanstalkClient::DescribeApplicationVersionsAwaitable(DescribeApplicationVersionsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::DescribeApplicationVersions, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, DescribeApplicationsRequest, DescribeApplicationsOutcome> ElasticBeanstalkClient::DescribeApplicationsAwaitable(DescribeApplicationsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::DescribeApplications, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, DescribeConfigurationOptionsRequest, DescribeConfigurationOptionsOutcome> ElasticBeanstalkClient::DescribeConfigurationOptionsAwaitable(DescribeConfigurationOptionsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::DescribeConfigurationOptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, DescribeConfigurationSettingsRequest, DescribeConfigurationSettingsOutcome> ElasticBeanstalkClient::DescribeConfigurationSettingsAwaitable(DescribeConfigurationSettingsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::DescribeConfigurationSettings, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, DescribeEnvironmentHealthRequest, DescribeEnvironmentHealthOutcome> ElasticBeanstalkClient::DescribeEnvironmentHealthAwaitable(DescribeEnvironmentHealthRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::DescribeEnvironmentHealth, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, DescribeEnvironmentManagedActionHistoryRequest, DescribeEnvironmentManagedActionHistoryOutcome> ElasticBeanstalkClient::DescribeEnvironmentManagedActionHistoryAwaitable(DescribeEnvironmentManagedActionHistoryRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::DescribeEnvironmentManagedActionHistory, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, DescribeEnvironmentManagedActionsRequest, DescribeEnvironmentManagedActionsOutcome> ElasticBeanstalkClient::DescribeEnvironmentManagedActionsAwaitable(DescribeEnvironmentManagedActionsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::DescribeEnvironmentManagedActions, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, DescribeEnvironmentResourcesRequest, DescribeEnvironmentResourcesOutcome> ElasticBeanstalkClient::DescribeEnvironmentResourcesAwaitable(DescribeEnvironmentResourcesRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::DescribeEnvironmentResources, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, DescribeEnvironmentsRequest, DescribeEnvironmentsOutcome> ElasticBeanstalkClient::DescribeEnvironmentsAwaitable(DescribeEnvironmentsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::DescribeEnvironments, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, DescribeEventsRequest, DescribeEventsOutcome> ElasticBeanstalkClient::DescribeEventsAwaitable(DescribeEventsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::DescribeEvents, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, DescribeInstancesHealthRequest, DescribeInstancesHealthOutcome> ElasticBeanstalkClient::DescribeInstancesHealthAwaitable(DescribeInstancesHealthRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::DescribeInstancesHealth, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, ListAvailableSolutionStacksRequest, ListAvailableSolutionStacksOutcome> ElasticBeanstalkClient::ListAvailableSolutionStacksAwaitable(ListAvailableSolutionStacksRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::ListAvailableSolutionStacks, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, RebuildEnvironmentRequest, RebuildEnvironmentOutcome> ElasticBeanstalkClient::RebuildEnvironmentAwaitable(RebuildEnvironmentRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::RebuildEnvironment, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, RequestEnvironmentInfoRequest, RequestEnvironmentInfoOutcome> ElasticBeanstalkClient::RequestEnvironmentInfoAwaitable(RequestEnvironmentInfoRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::RequestEnvironmentInfo, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, RestartAppServerRequest, RestartAppServerOutcome> ElasticBeanstalkClient::RestartAppServerAwaitable(RestartAppServerRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::RestartAppServer, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, RetrieveEnvironmentInfoRequest, RetrieveEnvironmentInfoOutcome> ElasticBeanstalkClient::RetrieveEnvironmentInfoAwaitable(RetrieveEnvironmentInfoRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::RetrieveEnvironmentInfo, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, SwapEnvironmentCNAMEsRequest, SwapEnvironmentCNAMEsOutcome> ElasticBeanstalkClient::SwapEnvironmentCNAMEsAwaitable(SwapEnvironmentCNAMEsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::SwapEnvironmentCNAMEs, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, TerminateEnvironmentRequest, TerminateEnvironmentOutcome> ElasticBeanstalkClient::TerminateEnvironmentAwaitable(TerminateEnvironmentRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::TerminateEnvironment, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, UpdateApplicationRequest, UpdateApplicationOutcome> ElasticBeanstalkClient::UpdateApplicationAwaitable(UpdateApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::UpdateApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, UpdateApplicationVersionRequest, UpdateApplicationVersionOutcome> ElasticBeanstalkClient::UpdateApplicationVersionAwaitable(UpdateApplicationVersionRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::UpdateApplicationVersion, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, UpdateConfigurationTemplateRequest, UpdateConfigurationTemplateOutcome> ElasticBeanstalkClient::UpdateConfigurationTemplateAwaitable(UpdateConfigurationTemplateRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::UpdateConfigurationTemplate, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, UpdateEnvironmentRequest, UpdateEnvironmentOutcome> ElasticBeanstalkClient::UpdateEnvironmentAwaitable(UpdateEnvironmentRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::UpdateEnvironment, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticBeanstalkClient, ValidateConfigurationSettingsRequest, ValidateConfigurationSettingsOutcome> ElasticBeanstalkClient::ValidateConfigurationSettingsAwaitable(ValidateConfigurationSettingsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticBeanstalkClient::ValidateConfigurationSettings, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
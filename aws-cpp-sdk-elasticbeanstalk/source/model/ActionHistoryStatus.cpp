@@ -29,26 +29,32 @@ namespace Aws
       namespace ActionHistoryStatusMapper
       {
 
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Completed_HASH = 601036331;
+        static const int Failed_HASH = 2096857181;
+        static const int Unknown_HASH = 1379812394;
 
 
         ActionHistoryStatus GetActionHistoryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Completed_HASH)
+          switch (hashCode)
           {
+          case Completed_HASH:
             return ActionHistoryStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return ActionHistoryStatus::Failed;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
+          case Unknown_HASH:
             return ActionHistoryStatus::Unknown;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,31 +29,35 @@ namespace Aws
       namespace ActionStatusMapper
       {
 
-        static const int Scheduled_HASH = HashingUtils::HashString("Scheduled");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Running_HASH = HashingUtils::HashString("Running");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Scheduled_HASH = 1843257485;
+        static const int Pending_HASH = 982065527;
+        static const int Running_HASH = -1079530081;
+        static const int Unknown_HASH = 1379812394;
 
 
         ActionStatus GetActionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Scheduled_HASH)
+          switch (hashCode)
           {
+          case Scheduled_HASH:
             return ActionStatus::Scheduled;
-          }
-          else if (hashCode == Pending_HASH)
-          {
+          case Pending_HASH:
             return ActionStatus::Pending;
-          }
-          else if (hashCode == Running_HASH)
-          {
+          case Running_HASH:
             return ActionStatus::Running;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
+          case Unknown_HASH:
             return ActionStatus::Unknown;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace ActionTypeMapper
       {
 
-        static const int InstanceRefresh_HASH = HashingUtils::HashString("InstanceRefresh");
-        static const int PlatformUpdate_HASH = HashingUtils::HashString("PlatformUpdate");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int InstanceRefresh_HASH = -1498944410;
+        static const int PlatformUpdate_HASH = -1792542916;
+        static const int Unknown_HASH = 1379812394;
 
 
         ActionType GetActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InstanceRefresh_HASH)
+          switch (hashCode)
           {
+          case InstanceRefresh_HASH:
             return ActionType::InstanceRefresh;
-          }
-          else if (hashCode == PlatformUpdate_HASH)
-          {
+          case PlatformUpdate_HASH:
             return ActionType::PlatformUpdate;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
+          case Unknown_HASH:
             return ActionType::Unknown;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -59,25 +59,25 @@ ApplicationDescription& ApplicationDescription::operator =(const XmlNode& xmlNod
     XmlNode applicationNameNode = resultNode.FirstChild("ApplicationName");
     if(!applicationNameNode.IsNull())
     {
-      m_applicationName = StringUtils::Trim(applicationNameNode.GetText().c_str());
+      m_applicationName = applicationNameNode.GetTextView().Trim().ToString();
       m_applicationNameHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode dateCreatedNode = resultNode.FirstChild("DateCreated");
     if(!dateCreatedNode.IsNull())
     {
-      m_dateCreated = DateTime(StringUtils::Trim(dateCreatedNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_dateCreated = DateTime(dateCreatedNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_dateCreatedHasBeenSet = true;
     }
     XmlNode dateUpdatedNode = resultNode.FirstChild("DateUpdated");
     if(!dateUpdatedNode.IsNull())
     {
-      m_dateUpdated = DateTime(StringUtils::Trim(dateUpdatedNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_dateUpdated = DateTime(dateUpdatedNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_dateUpdatedHasBeenSet = true;
     }
     XmlNode versionsNode = resultNode.FirstChild("Versions");
@@ -86,7 +86,7 @@ ApplicationDescription& ApplicationDescription::operator =(const XmlNode& xmlNod
       XmlNode versionsMember = versionsNode.FirstChild("member");
       while(!versionsMember.IsNull())
       {
-        m_versions.push_back(StringUtils::Trim(versionsMember.GetText().c_str()));
+        m_versions.push_back(versionsMember.GetTextView().Trim().ToString());
         versionsMember = versionsMember.NextNode("member");
       }
 
@@ -98,7 +98,7 @@ ApplicationDescription& ApplicationDescription::operator =(const XmlNode& xmlNod
       XmlNode configurationTemplatesMember = configurationTemplatesNode.FirstChild("member");
       while(!configurationTemplatesMember.IsNull())
       {
-        m_configurationTemplates.push_back(StringUtils::Trim(configurationTemplatesMember.GetText().c_str()));
+        m_configurationTemplates.push_back(configurationTemplatesMember.GetTextView().Trim().ToString());
         configurationTemplatesMember = configurationTemplatesMember.NextNode("member");
       }
 
@@ -113,22 +113,22 @@ void ApplicationDescription::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_applicationNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_dateCreatedHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DateCreated=" << StringUtils::URLEncode(m_dateCreated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".DateCreated=" << StringUtils::URLEncoded(m_dateCreated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_dateUpdatedHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DateUpdated=" << StringUtils::URLEncode(m_dateUpdated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".DateUpdated=" << StringUtils::URLEncoded(m_dateUpdated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_versionsHasBeenSet)
@@ -136,7 +136,7 @@ void ApplicationDescription::OutputToStream(Aws::OStream& oStream, const char* l
       unsigned versionsIdx = 1;
       for(auto& item : m_versions)
       {
-        oStream << location << index << locationValue << ".Versions.member." << versionsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".Versions.member." << versionsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -145,7 +145,7 @@ void ApplicationDescription::OutputToStream(Aws::OStream& oStream, const char* l
       unsigned configurationTemplatesIdx = 1;
       for(auto& item : m_configurationTemplates)
       {
-        oStream << location << index << locationValue << ".ConfigurationTemplates.member." << configurationTemplatesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".ConfigurationTemplates.member." << configurationTemplatesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -155,26 +155,26 @@ void ApplicationDescription::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_applicationNameHasBeenSet)
   {
-      oStream << location << ".ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+      oStream << location << ".ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_dateCreatedHasBeenSet)
   {
-      oStream << location << ".DateCreated=" << StringUtils::URLEncode(m_dateCreated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".DateCreated=" << StringUtils::URLEncoded(m_dateCreated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_dateUpdatedHasBeenSet)
   {
-      oStream << location << ".DateUpdated=" << StringUtils::URLEncode(m_dateUpdated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".DateUpdated=" << StringUtils::URLEncoded(m_dateUpdated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_versionsHasBeenSet)
   {
       unsigned versionsIdx = 1;
       for(auto& item : m_versions)
       {
-        oStream << location << ".Versions.member." << versionsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".Versions.member." << versionsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_configurationTemplatesHasBeenSet)
@@ -182,7 +182,7 @@ void ApplicationDescription::OutputToStream(Aws::OStream& oStream, const char* l
       unsigned configurationTemplatesIdx = 1;
       for(auto& item : m_configurationTemplates)
       {
-        oStream << location << ".ConfigurationTemplates.member." << configurationTemplatesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".ConfigurationTemplates.member." << configurationTemplatesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,13 +60,13 @@ ApplicationMetrics& ApplicationMetrics::operator =(const XmlNode& xmlNode)
     XmlNode durationNode = resultNode.FirstChild("Duration");
     if(!durationNode.IsNull())
     {
-      m_duration = StringUtils::ConvertToInt32(StringUtils::Trim(durationNode.GetText().c_str()).c_str());
+      m_duration = StringUtils::ConvertToInt32(durationNode.GetTextView().Trim().ToString().c_str());
       m_durationHasBeenSet = true;
     }
     XmlNode requestCountNode = resultNode.FirstChild("RequestCount");
     if(!requestCountNode.IsNull())
     {
-      m_requestCount = StringUtils::ConvertToInt32(StringUtils::Trim(requestCountNode.GetText().c_str()).c_str());
+      m_requestCount = StringUtils::ConvertToInt32(requestCountNode.GetTextView().Trim().ToString().c_str());
       m_requestCountHasBeenSet = true;
     }
     XmlNode statusCodesNode = resultNode.FirstChild("StatusCodes");
@@ -99,16 +100,16 @@ void ApplicationMetrics::OutputToStream(Aws::OStream& oStream, const char* locat
 
   if(m_statusCodesHasBeenSet)
   {
-      Aws::StringStream statusCodesLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream statusCodesLocationAndMemberSs;
       statusCodesLocationAndMemberSs << location << index << locationValue << ".StatusCodes";
-      m_statusCodes.OutputToStream(oStream, statusCodesLocationAndMemberSs.str().c_str());
+      m_statusCodes.OutputToStream(oStream, statusCodesLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_latencyHasBeenSet)
   {
-      Aws::StringStream latencyLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream latencyLocationAndMemberSs;
       latencyLocationAndMemberSs << location << index << locationValue << ".Latency";
-      m_latency.OutputToStream(oStream, latencyLocationAndMemberSs.str().c_str());
+      m_latency.OutputToStream(oStream, latencyLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,19 +62,19 @@ ApplicationVersionDescription& ApplicationVersionDescription::operator =(const X
     XmlNode applicationNameNode = resultNode.FirstChild("ApplicationName");
     if(!applicationNameNode.IsNull())
     {
-      m_applicationName = StringUtils::Trim(applicationNameNode.GetText().c_str());
+      m_applicationName = applicationNameNode.GetTextView().Trim().ToString();
       m_applicationNameHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode versionLabelNode = resultNode.FirstChild("VersionLabel");
     if(!versionLabelNode.IsNull())
     {
-      m_versionLabel = StringUtils::Trim(versionLabelNode.GetText().c_str());
+      m_versionLabel = versionLabelNode.GetTextView().Trim().ToString();
       m_versionLabelHasBeenSet = true;
     }
     XmlNode sourceBundleNode = resultNode.FirstChild("SourceBundle");
@@ -85,19 +86,19 @@ ApplicationVersionDescription& ApplicationVersionDescription::operator =(const X
     XmlNode dateCreatedNode = resultNode.FirstChild("DateCreated");
     if(!dateCreatedNode.IsNull())
     {
-      m_dateCreated = DateTime(StringUtils::Trim(dateCreatedNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_dateCreated = DateTime(dateCreatedNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_dateCreatedHasBeenSet = true;
     }
     XmlNode dateUpdatedNode = resultNode.FirstChild("DateUpdated");
     if(!dateUpdatedNode.IsNull())
     {
-      m_dateUpdated = DateTime(StringUtils::Trim(dateUpdatedNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_dateUpdated = DateTime(dateUpdatedNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_dateUpdatedHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = ApplicationVersionStatusMapper::GetApplicationVersionStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = ApplicationVersionStatusMapper::GetApplicationVersionStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
   }
@@ -109,34 +110,34 @@ void ApplicationVersionDescription::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_applicationNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_versionLabelHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VersionLabel=" << StringUtils::URLEncode(m_versionLabel.c_str()) << "&";
+      oStream << location << index << locationValue << ".VersionLabel=" << StringUtils::URLEncoded(m_versionLabel) << "&";
   }
 
   if(m_sourceBundleHasBeenSet)
   {
-      Aws::StringStream sourceBundleLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream sourceBundleLocationAndMemberSs;
       sourceBundleLocationAndMemberSs << location << index << locationValue << ".SourceBundle";
-      m_sourceBundle.OutputToStream(oStream, sourceBundleLocationAndMemberSs.str().c_str());
+      m_sourceBundle.OutputToStream(oStream, sourceBundleLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_dateCreatedHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DateCreated=" << StringUtils::URLEncode(m_dateCreated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".DateCreated=" << StringUtils::URLEncoded(m_dateCreated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_dateUpdatedHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DateUpdated=" << StringUtils::URLEncode(m_dateUpdated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".DateUpdated=" << StringUtils::URLEncoded(m_dateUpdated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_statusHasBeenSet)
@@ -150,15 +151,15 @@ void ApplicationVersionDescription::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_applicationNameHasBeenSet)
   {
-      oStream << location << ".ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+      oStream << location << ".ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_versionLabelHasBeenSet)
   {
-      oStream << location << ".VersionLabel=" << StringUtils::URLEncode(m_versionLabel.c_str()) << "&";
+      oStream << location << ".VersionLabel=" << StringUtils::URLEncoded(m_versionLabel) << "&";
   }
   if(m_sourceBundleHasBeenSet)
   {
@@ -168,11 +169,11 @@ void ApplicationVersionDescription::OutputToStream(Aws::OStream& oStream, const
   }
   if(m_dateCreatedHasBeenSet)
   {
-      oStream << location << ".DateCreated=" << StringUtils::URLEncode(m_dateCreated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".DateCreated=" << StringUtils::URLEncoded(m_dateCreated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_dateUpdatedHasBeenSet)
   {
-      oStream << location << ".DateUpdated=" << StringUtils::URLEncode(m_dateUpdated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".DateUpdated=" << StringUtils::URLEncoded(m_dateUpdated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_statusHasBeenSet)
   {
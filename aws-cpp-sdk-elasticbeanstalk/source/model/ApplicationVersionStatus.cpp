@@ -29,31 +29,35 @@ namespace Aws
       namespace ApplicationVersionStatusMapper
       {
 
-        static const int Processed_HASH = HashingUtils::HashString("Processed");
-        static const int Unprocessed_HASH = HashingUtils::HashString("Unprocessed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Processing_HASH = HashingUtils::HashString("Processing");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Processed_HASH = 909208366;
+        static const int Unprocessed_HASH = 641548469;
+        static const int Failed_HASH = 2096857181;
+        static const int Processing_HASH = -1879307469;
 
 
         ApplicationVersionStatus GetApplicationVersionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Processed_HASH)
+          switch (hashCode)
           {
+          case Processed_HASH:
             return ApplicationVersionStatus::Processed;
-          }
-          else if (hashCode == Unprocessed_HASH)
-          {
+          case Unprocessed_HASH:
             return ApplicationVersionStatus::Unprocessed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return ApplicationVersionStatus::Failed;
-          }
-          else if (hashCode == Processing_HASH)
-          {
+          case Processing_HASH:
             return ApplicationVersionStatus::Processing;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/ApplyEnvironmentManagedActionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ ApplyEnvironmentManagedActionRequest::ApplyEnvironmentManagedActionRequest() :
 
 Aws::String ApplyEnvironmentManagedActionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ApplyEnvironmentManagedAction&";
   if(m_environmentNameHasBeenSet)
   {
-    ss << "EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+    ss << "EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
 
   if(m_environmentIdHasBeenSet)
   {
-    ss << "EnvironmentId=" << StringUtils::URLEncode(m_environmentId.c_str()) << "&";
+    ss << "EnvironmentId=" << StringUtils::URLEncoded(m_environmentId) << "&";
   }
 
   if(m_actionIdHasBeenSet)
   {
-    ss << "ActionId=" << StringUtils::URLEncode(m_actionId.c_str()) << "&";
+    ss << "ActionId=" << StringUtils::URLEncoded(m_actionId) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
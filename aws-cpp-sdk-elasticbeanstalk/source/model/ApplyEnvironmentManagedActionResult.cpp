@@ -40,7 +40,7 @@ ApplyEnvironmentManagedActionResult& ApplyEnvironmentManagedActionResult::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ApplyEnvironmentManagedActionResult")
+  if (rootNode.GetNameView() != "ApplyEnvironmentManagedActionResult")
   {
     resultNode = rootNode.FirstChild("ApplyEnvironmentManagedActionResult");
   }
@@ -50,22 +50,22 @@ ApplyEnvironmentManagedActionResult& ApplyEnvironmentManagedActionResult::operat
     XmlNode actionIdNode = resultNode.FirstChild("ActionId");
     if(!actionIdNode.IsNull())
     {
-      m_actionId = StringUtils::Trim(actionIdNode.GetText().c_str());
+      m_actionId = actionIdNode.GetTextView().Trim().ToString();
     }
     XmlNode actionDescriptionNode = resultNode.FirstChild("ActionDescription");
     if(!actionDescriptionNode.IsNull())
     {
-      m_actionDescription = StringUtils::Trim(actionDescriptionNode.GetText().c_str());
+      m_actionDescription = actionDescriptionNode.GetTextView().Trim().ToString();
     }
     XmlNode actionTypeNode = resultNode.FirstChild("ActionType");
     if(!actionTypeNode.IsNull())
     {
-      m_actionType = ActionTypeMapper::GetActionTypeForName(StringUtils::Trim(actionTypeNode.GetText().c_str()).c_str());
+      m_actionType = ActionTypeMapper::GetActionTypeForName(actionTypeNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
     }
   }
 
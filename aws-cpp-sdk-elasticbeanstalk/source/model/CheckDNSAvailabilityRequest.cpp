@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/CheckDNSAvailabilityRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ CheckDNSAvailabilityRequest::CheckDNSAvailabilityRequest() :
 
 Aws::String CheckDNSAvailabilityRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CheckDNSAvailability&";
   if(m_cNAMEPrefixHasBeenSet)
   {
-    ss << "CNAMEPrefix=" << StringUtils::URLEncode(m_cNAMEPrefix.c_str()) << "&";
+    ss << "CNAMEPrefix=" << StringUtils::URLEncoded(m_cNAMEPrefix) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -42,7 +42,7 @@ CheckDNSAvailabilityResult& CheckDNSAvailabilityResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CheckDNSAvailabilityResult")
+  if (rootNode.GetNameView() != "CheckDNSAvailabilityResult")
   {
     resultNode = rootNode.FirstChild("CheckDNSAvailabilityResult");
   }
@@ -52,12 +52,12 @@ CheckDNSAvailabilityResult& CheckDNSAvailabilityResult::operator =(const AmazonW
     XmlNode availableNode = resultNode.FirstChild("Available");
     if(!availableNode.IsNull())
     {
-      m_available = StringUtils::ConvertToBool(StringUtils::Trim(availableNode.GetText().c_str()).c_str());
+      m_available = StringUtils::ConvertToBool(availableNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode fullyQualifiedCNAMENode = resultNode.FirstChild("FullyQualifiedCNAME");
     if(!fullyQualifiedCNAMENode.IsNull())
     {
-      m_fullyQualifiedCNAME = StringUtils::Trim(fullyQualifiedCNAMENode.GetText().c_str());
+      m_fullyQualifiedCNAME = fullyQualifiedCNAMENode.GetTextView().Trim().ToString();
     }
   }
 
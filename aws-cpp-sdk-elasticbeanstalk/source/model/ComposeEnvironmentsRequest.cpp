@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/ComposeEnvironmentsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ ComposeEnvironmentsRequest::ComposeEnvironmentsRequest() :
 
 Aws::String ComposeEnvironmentsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ComposeEnvironments&";
   if(m_applicationNameHasBeenSet)
   {
-    ss << "ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+    ss << "ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_groupNameHasBeenSet)
   {
-    ss << "GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+    ss << "GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   if(m_versionLabelsHasBeenSet)
@@ -46,12 +47,12 @@ Aws::String ComposeEnvironmentsRequest::SerializePayload() const
     for(auto& item : m_versionLabels)
     {
       ss << "VersionLabels.member." << versionLabelsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       versionLabelsCount++;
     }
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ComposeEnvironmentsResult& ComposeEnvironmentsResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ComposeEnvironmentsResult")
+  if (rootNode.GetNameView() != "ComposeEnvironmentsResult")
   {
     resultNode = rootNode.FirstChild("ComposeEnvironmentsResult");
   }
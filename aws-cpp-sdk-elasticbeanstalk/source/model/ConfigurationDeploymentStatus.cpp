@@ -29,26 +29,32 @@ namespace Aws
       namespace ConfigurationDeploymentStatusMapper
       {
 
-        static const int deployed_HASH = HashingUtils::HashString("deployed");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int failed_HASH = HashingUtils::HashString("failed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int deployed_HASH = 940564422;
+        static const int pending_HASH = -682587753;
+        static const int failed_HASH = -1281977283;
 
 
         ConfigurationDeploymentStatus GetConfigurationDeploymentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == deployed_HASH)
+          switch (hashCode)
           {
+          case deployed_HASH:
             return ConfigurationDeploymentStatus::deployed;
-          }
-          else if (hashCode == pending_HASH)
-          {
+          case pending_HASH:
             return ConfigurationDeploymentStatus::pending;
-          }
-          else if (hashCode == failed_HASH)
-          {
+          case failed_HASH:
             return ConfigurationDeploymentStatus::failed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -77,37 +78,37 @@ ConfigurationOptionDescription& ConfigurationOptionDescription::operator =(const
     XmlNode namespaceNode = resultNode.FirstChild("Namespace");
     if(!namespaceNode.IsNull())
     {
-      m_namespace = StringUtils::Trim(namespaceNode.GetText().c_str());
+      m_namespace = namespaceNode.GetTextView().Trim().ToString();
       m_namespaceHasBeenSet = true;
     }
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode defaultValueNode = resultNode.FirstChild("DefaultValue");
     if(!defaultValueNode.IsNull())
     {
-      m_defaultValue = StringUtils::Trim(defaultValueNode.GetText().c_str());
+      m_defaultValue = defaultValueNode.GetTextView().Trim().ToString();
       m_defaultValueHasBeenSet = true;
     }
     XmlNode changeSeverityNode = resultNode.FirstChild("ChangeSeverity");
     if(!changeSeverityNode.IsNull())
     {
-      m_changeSeverity = StringUtils::Trim(changeSeverityNode.GetText().c_str());
+      m_changeSeverity = changeSeverityNode.GetTextView().Trim().ToString();
       m_changeSeverityHasBeenSet = true;
     }
     XmlNode userDefinedNode = resultNode.FirstChild("UserDefined");
     if(!userDefinedNode.IsNull())
     {
-      m_userDefined = StringUtils::ConvertToBool(StringUtils::Trim(userDefinedNode.GetText().c_str()).c_str());
+      m_userDefined = StringUtils::ConvertToBool(userDefinedNode.GetTextView().Trim().ToString().c_str());
       m_userDefinedHasBeenSet = true;
     }
     XmlNode valueTypeNode = resultNode.FirstChild("ValueType");
     if(!valueTypeNode.IsNull())
     {
-      m_valueType = ConfigurationOptionValueTypeMapper::GetConfigurationOptionValueTypeForName(StringUtils::Trim(valueTypeNode.GetText().c_str()).c_str());
+      m_valueType = ConfigurationOptionValueTypeMapper::GetConfigurationOptionValueTypeForName(valueTypeNode.GetTextView().Trim().ToString().c_str());
       m_valueTypeHasBeenSet = true;
     }
     XmlNode valueOptionsNode = resultNode.FirstChild("ValueOptions");
@@ -116,7 +117,7 @@ ConfigurationOptionDescription& ConfigurationOptionDescription::operator =(const
       XmlNode valueOptionsMember = valueOptionsNode.FirstChild("member");
       while(!valueOptionsMember.IsNull())
       {
-        m_valueOptions.push_back(StringUtils::Trim(valueOptionsMember.GetText().c_str()));
+        m_valueOptions.push_back(valueOptionsMember.GetTextView().Trim().ToString());
         valueOptionsMember = valueOptionsMember.NextNode("member");
       }
 
@@ -125,19 +126,19 @@ ConfigurationOptionDescription& ConfigurationOptionDescription::operator =(const
     XmlNode minValueNode = resultNode.FirstChild("MinValue");
     if(!minValueNode.IsNull())
     {
-      m_minValue = StringUtils::ConvertToInt32(StringUtils::Trim(minValueNode.GetText().c_str()).c_str());
+      m_minValue = StringUtils::ConvertToInt32(minValueNode.GetTextView().Trim().ToString().c_str());
       m_minValueHasBeenSet = true;
     }
     XmlNode maxValueNode = resultNode.FirstChild("MaxValue");
     if(!maxValueNode.IsNull())
     {
-      m_maxValue = StringUtils::ConvertToInt32(StringUtils::Trim(maxValueNode.GetText().c_str()).c_str());
+      m_maxValue = StringUtils::ConvertToInt32(maxValueNode.GetTextView().Trim().ToString().c_str());
       m_maxValueHasBeenSet = true;
     }
     XmlNode maxLengthNode = resultNode.FirstChild("MaxLength");
     if(!maxLengthNode.IsNull())
     {
-      m_maxLength = StringUtils::ConvertToInt32(StringUtils::Trim(maxLengthNode.GetText().c_str()).c_str());
+      m_maxLength = StringUtils::ConvertToInt32(maxLengthNode.GetTextView().Trim().ToString().c_str());
       m_maxLengthHasBeenSet = true;
     }
     XmlNode regexNode = resultNode.FirstChild("Regex");
@@ -155,22 +156,22 @@ void ConfigurationOptionDescription::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_namespaceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+      oStream << location << index << locationValue << ".Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
 
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
 
   if(m_changeSeverityHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ChangeSeverity=" << StringUtils::URLEncode(m_changeSeverity.c_str()) << "&";
+      oStream << location << index << locationValue << ".ChangeSeverity=" << StringUtils::URLEncoded(m_changeSeverity) << "&";
   }
 
   if(m_userDefinedHasBeenSet)
@@ -188,7 +189,7 @@ void ConfigurationOptionDescription::OutputToStream(Aws::OStream& oStream, const
       unsigned valueOptionsIdx = 1;
       for(auto& item : m_valueOptions)
       {
-        oStream << location << index << locationValue << ".ValueOptions.member." << valueOptionsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".ValueOptions.member." << valueOptionsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -209,9 +210,9 @@ void ConfigurationOptionDescription::OutputToStream(Aws::OStream& oStream, const
 
   if(m_regexHasBeenSet)
   {
-      Aws::StringStream regexLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream regexLocationAndMemberSs;
       regexLocationAndMemberSs << location << index << locationValue << ".Regex";
-      m_regex.OutputToStream(oStream, regexLocationAndMemberSs.str().c_str());
+      m_regex.OutputToStream(oStream, regexLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -220,19 +221,19 @@ void ConfigurationOptionDescription::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_namespaceHasBeenSet)
   {
-      oStream << location << ".Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+      oStream << location << ".Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
   if(m_changeSeverityHasBeenSet)
   {
-      oStream << location << ".ChangeSeverity=" << StringUtils::URLEncode(m_changeSeverity.c_str()) << "&";
+      oStream << location << ".ChangeSeverity=" << StringUtils::URLEncoded(m_changeSeverity) << "&";
   }
   if(m_userDefinedHasBeenSet)
   {
@@ -247,7 +248,7 @@ void ConfigurationOptionDescription::OutputToStream(Aws::OStream& oStream, const
       unsigned valueOptionsIdx = 1;
       for(auto& item : m_valueOptions)
       {
-        oStream << location << ".ValueOptions.member." << valueOptionsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".ValueOptions.member." << valueOptionsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_minValueHasBeenSet)
@@ -55,25 +55,25 @@ ConfigurationOptionSetting& ConfigurationOptionSetting::operator =(const XmlNode
     XmlNode resourceNameNode = resultNode.FirstChild("ResourceName");
     if(!resourceNameNode.IsNull())
     {
-      m_resourceName = StringUtils::Trim(resourceNameNode.GetText().c_str());
+      m_resourceName = resourceNameNode.GetTextView().Trim().ToString();
       m_resourceNameHasBeenSet = true;
     }
     XmlNode namespaceNode = resultNode.FirstChild("Namespace");
     if(!namespaceNode.IsNull())
     {
-      m_namespace = StringUtils::Trim(namespaceNode.GetText().c_str());
+      m_namespace = namespaceNode.GetTextView().Trim().ToString();
       m_namespaceHasBeenSet = true;
     }
     XmlNode optionNameNode = resultNode.FirstChild("OptionName");
     if(!optionNameNode.IsNull())
     {
-      m_optionName = StringUtils::Trim(optionNameNode.GetText().c_str());
+      m_optionName = optionNameNode.GetTextView().Trim().ToString();
       m_optionNameHasBeenSet = true;
     }
     XmlNode valueNode = resultNode.FirstChild("Value");
     if(!valueNode.IsNull())
     {
-      m_value = StringUtils::Trim(valueNode.GetText().c_str());
+      m_value = valueNode.GetTextView().Trim().ToString();
       m_valueHasBeenSet = true;
     }
   }
@@ -85,22 +85,22 @@ void ConfigurationOptionSetting::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_resourceNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceName=" << StringUtils::URLEncode(m_resourceName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceName=" << StringUtils::URLEncoded(m_resourceName) << "&";
   }
 
   if(m_namespaceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+      oStream << location << index << locationValue << ".Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
 
   if(m_optionNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OptionName=" << StringUtils::URLEncode(m_optionName.c_str()) << "&";
+      oStream << location << index << locationValue << ".OptionName=" << StringUtils::URLEncoded(m_optionName) << "&";
   }
 
   if(m_valueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 
 }
@@ -109,19 +109,19 @@ void ConfigurationOptionSetting::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_resourceNameHasBeenSet)
   {
-      oStream << location << ".ResourceName=" << StringUtils::URLEncode(m_resourceName.c_str()) << "&";
+      oStream << location << ".ResourceName=" << StringUtils::URLEncoded(m_resourceName) << "&";
   }
   if(m_namespaceHasBeenSet)
   {
-      oStream << location << ".Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+      oStream << location << ".Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
   if(m_optionNameHasBeenSet)
   {
-      oStream << location << ".OptionName=" << StringUtils::URLEncode(m_optionName.c_str()) << "&";
+      oStream << location << ".OptionName=" << StringUtils::URLEncoded(m_optionName) << "&";
   }
   if(m_valueHasBeenSet)
   {
-      oStream << location << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 }
 
@@ -29,21 +29,29 @@ namespace Aws
       namespace ConfigurationOptionValueTypeMapper
       {
 
-        static const int Scalar_HASH = HashingUtils::HashString("Scalar");
-        static const int List_HASH = HashingUtils::HashString("List");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Scalar_HASH = -1824322548;
+        static const int List_HASH = 2368702;
 
 
         ConfigurationOptionValueType GetConfigurationOptionValueTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Scalar_HASH)
+          switch (hashCode)
           {
+          case Scalar_HASH:
             return ConfigurationOptionValueType::Scalar;
-          }
-          else if (hashCode == List_HASH)
-          {
+          case List_HASH:
             return ConfigurationOptionValueType::List;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
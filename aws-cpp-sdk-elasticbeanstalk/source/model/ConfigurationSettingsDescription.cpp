@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -67,49 +68,49 @@ ConfigurationSettingsDescription& ConfigurationSettingsDescription::operator =(c
     XmlNode solutionStackNameNode = resultNode.FirstChild("SolutionStackName");
     if(!solutionStackNameNode.IsNull())
     {
-      m_solutionStackName = StringUtils::Trim(solutionStackNameNode.GetText().c_str());
+      m_solutionStackName = solutionStackNameNode.GetTextView().Trim().ToString();
       m_solutionStackNameHasBeenSet = true;
     }
     XmlNode applicationNameNode = resultNode.FirstChild("ApplicationName");
     if(!applicationNameNode.IsNull())
     {
-      m_applicationName = StringUtils::Trim(applicationNameNode.GetText().c_str());
+      m_applicationName = applicationNameNode.GetTextView().Trim().ToString();
       m_applicationNameHasBeenSet = true;
     }
     XmlNode templateNameNode = resultNode.FirstChild("TemplateName");
     if(!templateNameNode.IsNull())
     {
-      m_templateName = StringUtils::Trim(templateNameNode.GetText().c_str());
+      m_templateName = templateNameNode.GetTextView().Trim().ToString();
       m_templateNameHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode environmentNameNode = resultNode.FirstChild("EnvironmentName");
     if(!environmentNameNode.IsNull())
     {
-      m_environmentName = StringUtils::Trim(environmentNameNode.GetText().c_str());
+      m_environmentName = environmentNameNode.GetTextView().Trim().ToString();
       m_environmentNameHasBeenSet = true;
     }
     XmlNode deploymentStatusNode = resultNode.FirstChild("DeploymentStatus");
     if(!deploymentStatusNode.IsNull())
     {
-      m_deploymentStatus = ConfigurationDeploymentStatusMapper::GetConfigurationDeploymentStatusForName(StringUtils::Trim(deploymentStatusNode.GetText().c_str()).c_str());
+      m_deploymentStatus = ConfigurationDeploymentStatusMapper::GetConfigurationDeploymentStatusForName(deploymentStatusNode.GetTextView().Trim().ToString().c_str());
       m_deploymentStatusHasBeenSet = true;
     }
     XmlNode dateCreatedNode = resultNode.FirstChild("DateCreated");
     if(!dateCreatedNode.IsNull())
     {
-      m_dateCreated = DateTime(StringUtils::Trim(dateCreatedNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_dateCreated = DateTime(dateCreatedNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_dateCreatedHasBeenSet = true;
     }
     XmlNode dateUpdatedNode = resultNode.FirstChild("DateUpdated");
     if(!dateUpdatedNode.IsNull())
     {
-      m_dateUpdated = DateTime(StringUtils::Trim(dateUpdatedNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_dateUpdated = DateTime(dateUpdatedNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_dateUpdatedHasBeenSet = true;
     }
     XmlNode optionSettingsNode = resultNode.FirstChild("OptionSettings");
@@ -133,27 +134,27 @@ void ConfigurationSettingsDescription::OutputToStream(Aws::OStream& oStream, con
 {
   if(m_solutionStackNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SolutionStackName=" << StringUtils::URLEncode(m_solutionStackName.c_str()) << "&";
+      oStream << location << index << locationValue << ".SolutionStackName=" << StringUtils::URLEncoded(m_solutionStackName) << "&";
   }
 
   if(m_applicationNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_templateNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TemplateName=" << StringUtils::URLEncode(m_templateName.c_str()) << "&";
+      oStream << location << index << locationValue << ".TemplateName=" << StringUtils::URLEncoded(m_templateName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_environmentNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+      oStream << location << index << locationValue << ".EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
 
   if(m_deploymentStatusHasBeenSet)
@@ -163,12 +164,12 @@ void ConfigurationSettingsDescription::OutputToStream(Aws::OStream& oStream, con
 
   if(m_dateCreatedHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DateCreated=" << StringUtils::URLEncode(m_dateCreated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".DateCreated=" << StringUtils::URLEncoded(m_dateCreated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_dateUpdatedHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DateUpdated=" << StringUtils::URLEncode(m_dateUpdated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".DateUpdated=" << StringUtils::URLEncoded(m_dateUpdated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_optionSettingsHasBeenSet)
@@ -176,17 +177,17 @@ void ConfigurationSettingsDescription::OutputToStream(Aws::OStream& oStream, con
       unsigned optionSettingsIdx = 1;
       for(auto& item : m_optionSettings)
       {
-        Aws::StringStream optionSettingsSs;
+        Aws::Utils::Stream::StringOutputStream optionSettingsSs;
         optionSettingsSs << location << index << locationValue << ".OptionSettings.member." << optionSettingsIdx++;
-        item.OutputToStream(oStream, optionSettingsSs.str().c_str());
+        item.OutputToStream(oStream, optionSettingsSs.GetString().c_str());
       }
   }
 
   if(m_responseMetadataHasBeenSet)
   {
-      Aws::StringStream responseMetadataLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream responseMetadataLocationAndMemberSs;
       responseMetadataLocationAndMemberSs << location << index << locationValue << ".ResponseMetadata";
-      m_responseMetadata.OutputToStream(oStream, responseMetadataLocationAndMemberSs.str().c_str());
+      m_responseMetadata.OutputToStream(oStream, responseMetadataLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -195,23 +196,23 @@ void ConfigurationSettingsDescription::OutputToStream(Aws::OStream& oStream, con
 {
   if(m_solutionStackNameHasBeenSet)
   {
-      oStream << location << ".SolutionStackName=" << StringUtils::URLEncode(m_solutionStackName.c_str()) << "&";
+      oStream << location << ".SolutionStackName=" << StringUtils::URLEncoded(m_solutionStackName) << "&";
   }
   if(m_applicationNameHasBeenSet)
   {
-      oStream << location << ".ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+      oStream << location << ".ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
   if(m_templateNameHasBeenSet)
   {
-      oStream << location << ".TemplateName=" << StringUtils::URLEncode(m_templateName.c_str()) << "&";
+      oStream << location << ".TemplateName=" << StringUtils::URLEncoded(m_templateName) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_environmentNameHasBeenSet)
   {
-      oStream << location << ".EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+      oStream << location << ".EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
   if(m_deploymentStatusHasBeenSet)
   {
@@ -219,20 +220,20 @@ void ConfigurationSettingsDescription::OutputToStream(Aws::OStream& oStream, con
   }
   if(m_dateCreatedHasBeenSet)
   {
-      oStream << location << ".DateCreated=" << StringUtils::URLEncode(m_dateCreated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".DateCreated=" << StringUtils::URLEncoded(m_dateCreated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_dateUpdatedHasBeenSet)
   {
-      oStream << location << ".DateUpdated=" << StringUtils::URLEncode(m_dateUpdated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".DateUpdated=" << StringUtils::URLEncoded(m_dateUpdated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_optionSettingsHasBeenSet)
   {
       unsigned optionSettingsIdx = 1;
       for(auto& item : m_optionSettings)
       {
-        Aws::StringStream optionSettingsSs;
+        Aws::Utils::Stream::StringOutputStream optionSettingsSs;
         optionSettingsSs << location <<  ".OptionSettings.member." << optionSettingsIdx++;
-        item.OutputToStream(oStream, optionSettingsSs.str().c_str());
+        item.OutputToStream(oStream, optionSettingsSs.GetString().c_str());
       }
   }
   if(m_responseMetadataHasBeenSet)
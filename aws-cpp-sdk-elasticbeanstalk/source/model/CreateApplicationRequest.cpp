@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/CreateApplicationRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ CreateApplicationRequest::CreateApplicationRequest() :
 
 Aws::String CreateApplicationRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateApplication&";
   if(m_applicationNameHasBeenSet)
   {
-    ss << "ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+    ss << "ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
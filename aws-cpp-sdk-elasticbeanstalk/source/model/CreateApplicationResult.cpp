@@ -40,7 +40,7 @@ CreateApplicationResult& CreateApplicationResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateApplicationResult")
+  if (rootNode.GetNameView() != "CreateApplicationResult")
   {
     resultNode = rootNode.FirstChild("CreateApplicationResult");
   }
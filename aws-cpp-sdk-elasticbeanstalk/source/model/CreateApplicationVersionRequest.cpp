@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/CreateApplicationVersionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -33,21 +34,21 @@ CreateApplicationVersionRequest::CreateApplicationVersionRequest() :
 
 Aws::String CreateApplicationVersionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateApplicationVersion&";
   if(m_applicationNameHasBeenSet)
   {
-    ss << "ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+    ss << "ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_versionLabelHasBeenSet)
   {
-    ss << "VersionLabel=" << StringUtils::URLEncode(m_versionLabel.c_str()) << "&";
+    ss << "VersionLabel=" << StringUtils::URLEncoded(m_versionLabel) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_sourceBundleHasBeenSet)
@@ -66,6 +67,6 @@ Aws::String CreateApplicationVersionRequest::SerializePayload() const
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
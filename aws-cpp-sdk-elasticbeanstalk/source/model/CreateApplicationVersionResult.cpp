@@ -40,7 +40,7 @@ CreateApplicationVersionResult& CreateApplicationVersionResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateApplicationVersionResult")
+  if (rootNode.GetNameView() != "CreateApplicationVersionResult")
   {
     resultNode = rootNode.FirstChild("CreateApplicationVersionResult");
   }
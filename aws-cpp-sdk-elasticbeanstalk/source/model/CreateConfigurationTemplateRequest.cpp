@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/CreateConfigurationTemplateRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -32,21 +33,21 @@ CreateConfigurationTemplateRequest::CreateConfigurationTemplateRequest() :
 
 Aws::String CreateConfigurationTemplateRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateConfigurationTemplate&";
   if(m_applicationNameHasBeenSet)
   {
-    ss << "ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+    ss << "ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_templateNameHasBeenSet)
   {
-    ss << "TemplateName=" << StringUtils::URLEncode(m_templateName.c_str()) << "&";
+    ss << "TemplateName=" << StringUtils::URLEncoded(m_templateName) << "&";
   }
 
   if(m_solutionStackNameHasBeenSet)
   {
-    ss << "SolutionStackName=" << StringUtils::URLEncode(m_solutionStackName.c_str()) << "&";
+    ss << "SolutionStackName=" << StringUtils::URLEncoded(m_solutionStackName) << "&";
   }
 
   if(m_sourceConfigurationHasBeenSet)
@@ -56,12 +57,12 @@ Aws::String CreateConfigurationTemplateRequest::SerializePayload() const
 
   if(m_environmentIdHasBeenSet)
   {
-    ss << "EnvironmentId=" << StringUtils::URLEncode(m_environmentId.c_str()) << "&";
+    ss << "EnvironmentId=" << StringUtils::URLEncoded(m_environmentId) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_optionSettingsHasBeenSet)
@@ -75,6 +76,6 @@ Aws::String CreateConfigurationTemplateRequest::SerializePayload() const
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
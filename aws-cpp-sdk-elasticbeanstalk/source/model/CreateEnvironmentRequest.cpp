@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/CreateEnvironmentRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -37,31 +38,31 @@ CreateEnvironmentRequest::CreateEnvironmentRequest() :
 
 Aws::String CreateEnvironmentRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateEnvironment&";
   if(m_applicationNameHasBeenSet)
   {
-    ss << "ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+    ss << "ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_environmentNameHasBeenSet)
   {
-    ss << "EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+    ss << "EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
 
   if(m_groupNameHasBeenSet)
   {
-    ss << "GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+    ss << "GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_cNAMEPrefixHasBeenSet)
   {
-    ss << "CNAMEPrefix=" << StringUtils::URLEncode(m_cNAMEPrefix.c_str()) << "&";
+    ss << "CNAMEPrefix=" << StringUtils::URLEncoded(m_cNAMEPrefix) << "&";
   }
 
   if(m_tierHasBeenSet)
@@ -81,17 +82,17 @@ Aws::String CreateEnvironmentRequest::SerializePayload() const
 
   if(m_versionLabelHasBeenSet)
   {
-    ss << "VersionLabel=" << StringUtils::URLEncode(m_versionLabel.c_str()) << "&";
+    ss << "VersionLabel=" << StringUtils::URLEncoded(m_versionLabel) << "&";
   }
 
   if(m_templateNameHasBeenSet)
   {
-    ss << "TemplateName=" << StringUtils::URLEncode(m_templateName.c_str()) << "&";
+    ss << "TemplateName=" << StringUtils::URLEncoded(m_templateName) << "&";
   }
 
   if(m_solutionStackNameHasBeenSet)
   {
-    ss << "SolutionStackName=" << StringUtils::URLEncode(m_solutionStackName.c_str()) << "&";
+    ss << "SolutionStackName=" << StringUtils::URLEncoded(m_solutionStackName) << "&";
   }
 
   if(m_optionSettingsHasBeenSet)
@@ -115,6 +116,6 @@ Aws::String CreateEnvironmentRequest::SerializePayload() const
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -42,7 +42,7 @@ CreateEnvironmentResult& CreateEnvironmentResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateEnvironmentResult")
+  if (rootNode.GetNameView() != "CreateEnvironmentResult")
   {
     resultNode = rootNode.FirstChild("CreateEnvironmentResult");
   }
@@ -52,77 +52,77 @@ CreateEnvironmentResult& CreateEnvironmentResult::operator =(const AmazonWebServ
     XmlNode environmentNameNode = resultNode.FirstChild("EnvironmentName");
     if(!environmentNameNode.IsNull())
     {
-      m_environmentName = StringUtils::Trim(environmentNameNode.GetText().c_str());
+      m_environmentName = environmentNameNode.GetTextView().Trim().ToString();
     }
     XmlNode environmentIdNode = resultNode.FirstChild("EnvironmentId");
     if(!environmentIdNode.IsNull())
     {
-      m_environmentId = StringUtils::Trim(environmentIdNode.GetText().c_str());
+      m_environmentId = environmentIdNode.GetTextView().Trim().ToString();
     }
     XmlNode applicationNameNode = resultNode.FirstChild("ApplicationName");
     if(!applicationNameNode.IsNull())
     {
-      m_applicationName = StringUtils::Trim(applicationNameNode.GetText().c_str());
+      m_applicationName = applicationNameNode.GetTextView().Trim().ToString();
     }
     XmlNode versionLabelNode = resultNode.FirstChild("VersionLabel");
     if(!versionLabelNode.IsNull())
     {
-      m_versionLabel = StringUtils::Trim(versionLabelNode.GetText().c_str());
+      m_versionLabel = versionLabelNode.GetTextView().Trim().ToString();
     }
     XmlNode solutionStackNameNode = resultNode.FirstChild("SolutionStackName");
     if(!solutionStackNameNode.IsNull())
     {
-      m_solutionStackName = StringUtils::Trim(solutionStackNameNode.GetText().c_str());
+      m_solutionStackName = solutionStackNameNode.GetTextView().Trim().ToString();
     }
     XmlNode templateNameNode = resultNode.FirstChild("TemplateName");
     if(!templateNameNode.IsNull())
     {
-      m_templateName = StringUtils::Trim(templateNameNode.GetText().c_str());
+      m_templateName = templateNameNode.GetTextView().Trim().ToString();
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
     }
     XmlNode endpointURLNode = resultNode.FirstChild("EndpointURL");
     if(!endpointURLNode.IsNull())
     {
-      m_endpointURL = StringUtils::Trim(endpointURLNode.GetText().c_str());
+      m_endpointURL = endpointURLNode.GetTextView().Trim().ToString();
     }
     XmlNode cNAMENode = resultNode.FirstChild("CNAME");
     if(!cNAMENode.IsNull())
     {
-      m_cNAME = StringUtils::Trim(cNAMENode.GetText().c_str());
+      m_cNAME = cNAMENode.GetTextView().Trim().ToString();
     }
     XmlNode dateCreatedNode = resultNode.FirstChild("DateCreated");
     if(!dateCreatedNode.IsNull())
     {
-      m_dateCreated = DateTime(StringUtils::Trim(dateCreatedNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_dateCreated = DateTime(dateCreatedNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
     XmlNode dateUpdatedNode = resultNode.FirstChild("DateUpdated");
     if(!dateUpdatedNode.IsNull())
     {
-      m_dateUpdated = DateTime(StringUtils::Trim(dateUpdatedNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_dateUpdated = DateTime(dateUpdatedNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = EnvironmentStatusMapper::GetEnvironmentStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = EnvironmentStatusMapper::GetEnvironmentStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode abortableOperationInProgressNode = resultNode.FirstChild("AbortableOperationInProgress");
     if(!abortableOperationInProgressNode.IsNull())
     {
-      m_abortableOperationInProgress = StringUtils::ConvertToBool(StringUtils::Trim(abortableOperationInProgressNode.GetText().c_str()).c_str());
+      m_abortableOperationInProgress = StringUtils::ConvertToBool(abortableOperationInProgressNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode healthNode = resultNode.FirstChild("Health");
     if(!healthNode.IsNull())
     {
-      m_health = EnvironmentHealthMapper::GetEnvironmentHealthForName(StringUtils::Trim(healthNode.GetText().c_str()).c_str());
+      m_health = EnvironmentHealthMapper::GetEnvironmentHealthForName(healthNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode healthStatusNode = resultNode.FirstChild("HealthStatus");
     if(!healthStatusNode.IsNull())
     {
-      m_healthStatus = EnvironmentHealthStatusMapper::GetEnvironmentHealthStatusForName(StringUtils::Trim(healthStatusNode.GetText().c_str()).c_str());
+      m_healthStatus = EnvironmentHealthStatusMapper::GetEnvironmentHealthStatusForName(healthStatusNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode resourcesNode = resultNode.FirstChild("Resources");
     if(!resourcesNode.IsNull())
@@ -40,7 +40,7 @@ CreateStorageLocationResult& CreateStorageLocationResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateStorageLocationResult")
+  if (rootNode.GetNameView() != "CreateStorageLocationResult")
   {
     resultNode = rootNode.FirstChild("CreateStorageLocationResult");
   }
@@ -50,7 +50,7 @@ CreateStorageLocationResult& CreateStorageLocationResult::operator =(const Amazo
     XmlNode s3BucketNode = resultNode.FirstChild("S3Bucket");
     if(!s3BucketNode.IsNull())
     {
-      m_s3Bucket = StringUtils::Trim(s3BucketNode.GetText().c_str());
+      m_s3Bucket = s3BucketNode.GetTextView().Trim().ToString();
     }
   }
 
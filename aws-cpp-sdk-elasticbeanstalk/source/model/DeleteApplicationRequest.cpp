@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/DeleteApplicationRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -28,11 +29,11 @@ DeleteApplicationRequest::DeleteApplicationRequest() :
 
 Aws::String DeleteApplicationRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteApplication&";
   if(m_applicationNameHasBeenSet)
   {
-    ss << "ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+    ss << "ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_terminateEnvByForceHasBeenSet)
@@ -41,6 +42,6 @@ Aws::String DeleteApplicationRequest::SerializePayload() const
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/DeleteApplicationVersionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ DeleteApplicationVersionRequest::DeleteApplicationVersionRequest() :
 
 Aws::String DeleteApplicationVersionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteApplicationVersion&";
   if(m_applicationNameHasBeenSet)
   {
-    ss << "ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+    ss << "ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_versionLabelHasBeenSet)
   {
-    ss << "VersionLabel=" << StringUtils::URLEncode(m_versionLabel.c_str()) << "&";
+    ss << "VersionLabel=" << StringUtils::URLEncoded(m_versionLabel) << "&";
   }
 
   if(m_deleteSourceBundleHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String DeleteApplicationVersionRequest::SerializePayload() const
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
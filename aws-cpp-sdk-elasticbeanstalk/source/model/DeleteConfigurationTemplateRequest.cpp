@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/DeleteConfigurationTemplateRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ DeleteConfigurationTemplateRequest::DeleteConfigurationTemplateRequest() :
 
 Aws::String DeleteConfigurationTemplateRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteConfigurationTemplate&";
   if(m_applicationNameHasBeenSet)
   {
-    ss << "ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+    ss << "ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_templateNameHasBeenSet)
   {
-    ss << "TemplateName=" << StringUtils::URLEncode(m_templateName.c_str()) << "&";
+    ss << "TemplateName=" << StringUtils::URLEncoded(m_templateName) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
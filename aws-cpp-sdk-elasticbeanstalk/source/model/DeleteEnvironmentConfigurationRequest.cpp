@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/DeleteEnvironmentConfigurationRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ DeleteEnvironmentConfigurationRequest::DeleteEnvironmentConfigurationRequest() :
 
 Aws::String DeleteEnvironmentConfigurationRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteEnvironmentConfiguration&";
   if(m_applicationNameHasBeenSet)
   {
-    ss << "ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+    ss << "ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_environmentNameHasBeenSet)
   {
-    ss << "EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+    ss << "EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -57,25 +57,25 @@ Deployment& Deployment::operator =(const XmlNode& xmlNode)
     XmlNode versionLabelNode = resultNode.FirstChild("VersionLabel");
     if(!versionLabelNode.IsNull())
     {
-      m_versionLabel = StringUtils::Trim(versionLabelNode.GetText().c_str());
+      m_versionLabel = versionLabelNode.GetTextView().Trim().ToString();
       m_versionLabelHasBeenSet = true;
     }
     XmlNode deploymentIdNode = resultNode.FirstChild("DeploymentId");
     if(!deploymentIdNode.IsNull())
     {
-      m_deploymentId = StringUtils::ConvertToInt64(StringUtils::Trim(deploymentIdNode.GetText().c_str()).c_str());
+      m_deploymentId = StringUtils::ConvertToInt64(deploymentIdNode.GetTextView().Trim().ToString().c_str());
       m_deploymentIdHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode deploymentTimeNode = resultNode.FirstChild("DeploymentTime");
     if(!deploymentTimeNode.IsNull())
     {
-      m_deploymentTime = DateTime(StringUtils::Trim(deploymentTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_deploymentTime = DateTime(deploymentTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_deploymentTimeHasBeenSet = true;
     }
   }
@@ -87,7 +87,7 @@ void Deployment::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_versionLabelHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VersionLabel=" << StringUtils::URLEncode(m_versionLabel.c_str()) << "&";
+      oStream << location << index << locationValue << ".VersionLabel=" << StringUtils::URLEncoded(m_versionLabel) << "&";
   }
 
   if(m_deploymentIdHasBeenSet)
@@ -97,12 +97,12 @@ void Deployment::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_deploymentTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DeploymentTime=" << StringUtils::URLEncode(m_deploymentTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".DeploymentTime=" << StringUtils::URLEncoded(m_deploymentTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -111,7 +111,7 @@ void Deployment::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_versionLabelHasBeenSet)
   {
-      oStream << location << ".VersionLabel=" << StringUtils::URLEncode(m_versionLabel.c_str()) << "&";
+      oStream << location << ".VersionLabel=" << StringUtils::URLEncoded(m_versionLabel) << "&";
   }
   if(m_deploymentIdHasBeenSet)
   {
@@ -119,11 +119,11 @@ void Deployment::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_deploymentTimeHasBeenSet)
   {
-      oStream << location << ".DeploymentTime=" << StringUtils::URLEncode(m_deploymentTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".DeploymentTime=" << StringUtils::URLEncoded(m_deploymentTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/DescribeApplicationVersionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ DescribeApplicationVersionsRequest::DescribeApplicationVersionsRequest() :
 
 Aws::String DescribeApplicationVersionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeApplicationVersions&";
   if(m_applicationNameHasBeenSet)
   {
-    ss << "ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+    ss << "ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_versionLabelsHasBeenSet)
@@ -40,12 +41,12 @@ Aws::String DescribeApplicationVersionsRequest::SerializePayload() const
     for(auto& item : m_versionLabels)
     {
       ss << "VersionLabels.member." << versionLabelsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       versionLabelsCount++;
     }
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeApplicationVersionsResult& DescribeApplicationVersionsResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeApplicationVersionsResult")
+  if (rootNode.GetNameView() != "DescribeApplicationVersionsResult")
   {
     resultNode = rootNode.FirstChild("DescribeApplicationVersionsResult");
   }
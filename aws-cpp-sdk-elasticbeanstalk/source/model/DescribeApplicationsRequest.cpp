@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/DescribeApplicationsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -26,7 +27,7 @@ DescribeApplicationsRequest::DescribeApplicationsRequest() :
 
 Aws::String DescribeApplicationsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeApplications&";
   if(m_applicationNamesHasBeenSet)
   {
@@ -34,12 +35,12 @@ Aws::String DescribeApplicationsRequest::SerializePayload() const
     for(auto& item : m_applicationNames)
     {
       ss << "ApplicationNames.member." << applicationNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       applicationNamesCount++;
     }
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
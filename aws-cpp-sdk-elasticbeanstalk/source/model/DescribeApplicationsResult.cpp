@@ -40,7 +40,7 @@ DescribeApplicationsResult& DescribeApplicationsResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeApplicationsResult")
+  if (rootNode.GetNameView() != "DescribeApplicationsResult")
   {
     resultNode = rootNode.FirstChild("DescribeApplicationsResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/DescribeConfigurationOptionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -30,26 +31,26 @@ DescribeConfigurationOptionsRequest::DescribeConfigurationOptionsRequest() :
 
 Aws::String DescribeConfigurationOptionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeConfigurationOptions&";
   if(m_applicationNameHasBeenSet)
   {
-    ss << "ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+    ss << "ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_templateNameHasBeenSet)
   {
-    ss << "TemplateName=" << StringUtils::URLEncode(m_templateName.c_str()) << "&";
+    ss << "TemplateName=" << StringUtils::URLEncoded(m_templateName) << "&";
   }
 
   if(m_environmentNameHasBeenSet)
   {
-    ss << "EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+    ss << "EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
 
   if(m_solutionStackNameHasBeenSet)
   {
-    ss << "SolutionStackName=" << StringUtils::URLEncode(m_solutionStackName.c_str()) << "&";
+    ss << "SolutionStackName=" << StringUtils::URLEncoded(m_solutionStackName) << "&";
   }
 
   if(m_optionsHasBeenSet)
@@ -63,6 +64,6 @@ Aws::String DescribeConfigurationOptionsRequest::SerializePayload() const
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeConfigurationOptionsResult& DescribeConfigurationOptionsResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeConfigurationOptionsResult")
+  if (rootNode.GetNameView() != "DescribeConfigurationOptionsResult")
   {
     resultNode = rootNode.FirstChild("DescribeConfigurationOptionsResult");
   }
@@ -50,7 +50,7 @@ DescribeConfigurationOptionsResult& DescribeConfigurationOptionsResult::operator
     XmlNode solutionStackNameNode = resultNode.FirstChild("SolutionStackName");
     if(!solutionStackNameNode.IsNull())
     {
-      m_solutionStackName = StringUtils::Trim(solutionStackNameNode.GetText().c_str());
+      m_solutionStackName = solutionStackNameNode.GetTextView().Trim().ToString();
     }
     XmlNode optionsNode = resultNode.FirstChild("Options");
     if(!optionsNode.IsNull())
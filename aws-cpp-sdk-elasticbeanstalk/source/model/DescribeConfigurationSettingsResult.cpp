@@ -40,7 +40,7 @@ DescribeConfigurationSettingsResult& DescribeConfigurationSettingsResult::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeConfigurationSettingsResult")
+  if (rootNode.GetNameView() != "DescribeConfigurationSettingsResult")
   {
     resultNode = rootNode.FirstChild("DescribeConfigurationSettingsResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/DescribeEnvironmentHealthRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ DescribeEnvironmentHealthRequest::DescribeEnvironmentHealthRequest() :
 
 Aws::String DescribeEnvironmentHealthRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeEnvironmentHealth&";
   if(m_environmentNameHasBeenSet)
   {
-    ss << "EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+    ss << "EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
 
   if(m_environmentIdHasBeenSet)
   {
-    ss << "EnvironmentId=" << StringUtils::URLEncode(m_environmentId.c_str()) << "&";
+    ss << "EnvironmentId=" << StringUtils::URLEncoded(m_environmentId) << "&";
   }
 
   if(m_attributeNamesHasBeenSet)
@@ -46,12 +47,12 @@ Aws::String DescribeEnvironmentHealthRequest::SerializePayload() const
     for(auto& item : m_attributeNames)
     {
       ss << "AttributeNames.member." << attributeNamesCount << "="
-          << StringUtils::URLEncode(EnvironmentHealthAttributeMapper::GetNameForEnvironmentHealthAttribute(item).c_str()) << "&";
+          << StringUtils::URLEncoded(EnvironmentHealthAttributeMapper::GetNameForEnvironmentHealthAttribute(item)) << "&";
       attributeNamesCount++;
     }
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
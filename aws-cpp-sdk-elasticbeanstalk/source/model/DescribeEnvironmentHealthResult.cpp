@@ -40,7 +40,7 @@ DescribeEnvironmentHealthResult& DescribeEnvironmentHealthResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeEnvironmentHealthResult")
+  if (rootNode.GetNameView() != "DescribeEnvironmentHealthResult")
   {
     resultNode = rootNode.FirstChild("DescribeEnvironmentHealthResult");
   }
@@ -50,22 +50,22 @@ DescribeEnvironmentHealthResult& DescribeEnvironmentHealthResult::operator =(con
     XmlNode environmentNameNode = resultNode.FirstChild("EnvironmentName");
     if(!environmentNameNode.IsNull())
     {
-      m_environmentName = StringUtils::Trim(environmentNameNode.GetText().c_str());
+      m_environmentName = environmentNameNode.GetTextView().Trim().ToString();
     }
     XmlNode healthStatusNode = resultNode.FirstChild("HealthStatus");
     if(!healthStatusNode.IsNull())
     {
-      m_healthStatus = StringUtils::Trim(healthStatusNode.GetText().c_str());
+      m_healthStatus = healthStatusNode.GetTextView().Trim().ToString();
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = EnvironmentHealthMapper::GetEnvironmentHealthForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = EnvironmentHealthMapper::GetEnvironmentHealthForName(statusNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode colorNode = resultNode.FirstChild("Color");
     if(!colorNode.IsNull())
     {
-      m_color = StringUtils::Trim(colorNode.GetText().c_str());
+      m_color = colorNode.GetTextView().Trim().ToString();
     }
     XmlNode causesNode = resultNode.FirstChild("Causes");
     if(!causesNode.IsNull())
@@ -73,7 +73,7 @@ DescribeEnvironmentHealthResult& DescribeEnvironmentHealthResult::operator =(con
       XmlNode causesMember = causesNode.FirstChild("member");
       while(!causesMember.IsNull())
       {
-        m_causes.push_back(StringUtils::Trim(causesMember.GetText().c_str()));
+        m_causes.push_back(causesMember.GetTextView().Trim().ToString());
         causesMember = causesMember.NextNode("member");
       }
 
@@ -91,7 +91,7 @@ DescribeEnvironmentHealthResult& DescribeEnvironmentHealthResult::operator =(con
     XmlNode refreshedAtNode = resultNode.FirstChild("RefreshedAt");
     if(!refreshedAtNode.IsNull())
     {
-      m_refreshedAt = DateTime(StringUtils::Trim(refreshedAtNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_refreshedAt = DateTime(refreshedAtNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
   }
 
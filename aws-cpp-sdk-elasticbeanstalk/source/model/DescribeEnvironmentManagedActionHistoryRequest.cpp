@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/DescribeEnvironmentManagedActionHistoryRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -30,21 +31,21 @@ DescribeEnvironmentManagedActionHistoryRequest::DescribeEnvironmentManagedAction
 
 Aws::String DescribeEnvironmentManagedActionHistoryRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeEnvironmentManagedActionHistory&";
   if(m_environmentIdHasBeenSet)
   {
-    ss << "EnvironmentId=" << StringUtils::URLEncode(m_environmentId.c_str()) << "&";
+    ss << "EnvironmentId=" << StringUtils::URLEncoded(m_environmentId) << "&";
   }
 
   if(m_environmentNameHasBeenSet)
   {
-    ss << "EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+    ss << "EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxItemsHasBeenSet)
@@ -53,6 +54,6 @@ Aws::String DescribeEnvironmentManagedActionHistoryRequest::SerializePayload() c
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeEnvironmentManagedActionHistoryResult& DescribeEnvironmentManagedActionH
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeEnvironmentManagedActionHistoryResult")
+  if (rootNode.GetNameView() != "DescribeEnvironmentManagedActionHistoryResult")
   {
     resultNode = rootNode.FirstChild("DescribeEnvironmentManagedActionHistoryResult");
   }
@@ -61,7 +61,7 @@ DescribeEnvironmentManagedActionHistoryResult& DescribeEnvironmentManagedActionH
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
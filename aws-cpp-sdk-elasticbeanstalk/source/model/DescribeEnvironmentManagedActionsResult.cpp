@@ -40,7 +40,7 @@ DescribeEnvironmentManagedActionsResult& DescribeEnvironmentManagedActionsResult
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeEnvironmentManagedActionsResult")
+  if (rootNode.GetNameView() != "DescribeEnvironmentManagedActionsResult")
   {
     resultNode = rootNode.FirstChild("DescribeEnvironmentManagedActionsResult");
   }
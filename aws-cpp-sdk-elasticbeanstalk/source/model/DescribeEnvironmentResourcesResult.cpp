@@ -40,7 +40,7 @@ DescribeEnvironmentResourcesResult& DescribeEnvironmentResourcesResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeEnvironmentResourcesResult")
+  if (rootNode.GetNameView() != "DescribeEnvironmentResourcesResult")
   {
     resultNode = rootNode.FirstChild("DescribeEnvironmentResourcesResult");
   }
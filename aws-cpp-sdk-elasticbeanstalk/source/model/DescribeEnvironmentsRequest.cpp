@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/DescribeEnvironmentsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -32,16 +33,16 @@ DescribeEnvironmentsRequest::DescribeEnvironmentsRequest() :
 
 Aws::String DescribeEnvironmentsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeEnvironments&";
   if(m_applicationNameHasBeenSet)
   {
-    ss << "ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+    ss << "ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_versionLabelHasBeenSet)
   {
-    ss << "VersionLabel=" << StringUtils::URLEncode(m_versionLabel.c_str()) << "&";
+    ss << "VersionLabel=" << StringUtils::URLEncoded(m_versionLabel) << "&";
   }
 
   if(m_environmentIdsHasBeenSet)
@@ -50,7 +51,7 @@ Aws::String DescribeEnvironmentsRequest::SerializePayload() const
     for(auto& item : m_environmentIds)
     {
       ss << "EnvironmentIds.member." << environmentIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       environmentIdsCount++;
     }
   }
@@ -61,7 +62,7 @@ Aws::String DescribeEnvironmentsRequest::SerializePayload() const
     for(auto& item : m_environmentNames)
     {
       ss << "EnvironmentNames.member." << environmentNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       environmentNamesCount++;
     }
   }
@@ -73,10 +74,10 @@ Aws::String DescribeEnvironmentsRequest::SerializePayload() const
 
   if(m_includedDeletedBackToHasBeenSet)
   {
-    ss << "IncludedDeletedBackTo=" << StringUtils::URLEncode(m_includedDeletedBackTo.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "IncludedDeletedBackTo=" << StringUtils::URLEncoded(m_includedDeletedBackTo.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
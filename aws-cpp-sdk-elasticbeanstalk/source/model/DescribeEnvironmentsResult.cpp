@@ -40,7 +40,7 @@ DescribeEnvironmentsResult& DescribeEnvironmentsResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeEnvironmentsResult")
+  if (rootNode.GetNameView() != "DescribeEnvironmentsResult")
   {
     resultNode = rootNode.FirstChild("DescribeEnvironmentsResult");
   }
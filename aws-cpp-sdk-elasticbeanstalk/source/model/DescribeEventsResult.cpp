@@ -40,7 +40,7 @@ DescribeEventsResult& DescribeEventsResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeEventsResult")
+  if (rootNode.GetNameView() != "DescribeEventsResult")
   {
     resultNode = rootNode.FirstChild("DescribeEventsResult");
   }
@@ -61,7 +61,7 @@ DescribeEventsResult& DescribeEventsResult::operator =(const AmazonWebServiceRes
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/DescribeInstancesHealthRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ DescribeInstancesHealthRequest::DescribeInstancesHealthRequest() :
 
 Aws::String DescribeInstancesHealthRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeInstancesHealth&";
   if(m_environmentNameHasBeenSet)
   {
-    ss << "EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+    ss << "EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
 
   if(m_environmentIdHasBeenSet)
   {
-    ss << "EnvironmentId=" << StringUtils::URLEncode(m_environmentId.c_str()) << "&";
+    ss << "EnvironmentId=" << StringUtils::URLEncoded(m_environmentId) << "&";
   }
 
   if(m_attributeNamesHasBeenSet)
@@ -47,17 +48,17 @@ Aws::String DescribeInstancesHealthRequest::SerializePayload() const
     for(auto& item : m_attributeNames)
     {
       ss << "AttributeNames.member." << attributeNamesCount << "="
-          << StringUtils::URLEncode(InstancesHealthAttributeMapper::GetNameForInstancesHealthAttribute(item).c_str()) << "&";
+          << StringUtils::URLEncoded(InstancesHealthAttributeMapper::GetNameForInstancesHealthAttribute(item)) << "&";
       attributeNamesCount++;
     }
   }
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeInstancesHealthResult& DescribeInstancesHealthResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeInstancesHealthResult")
+  if (rootNode.GetNameView() != "DescribeInstancesHealthResult")
   {
     resultNode = rootNode.FirstChild("DescribeInstancesHealthResult");
   }
@@ -61,12 +61,12 @@ DescribeInstancesHealthResult& DescribeInstancesHealthResult::operator =(const A
     XmlNode refreshedAtNode = resultNode.FirstChild("RefreshedAt");
     if(!refreshedAtNode.IsNull())
     {
-      m_refreshedAt = DateTime(StringUtils::Trim(refreshedAtNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_refreshedAt = DateTime(refreshedAtNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
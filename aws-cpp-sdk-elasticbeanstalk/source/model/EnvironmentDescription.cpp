@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -87,91 +88,91 @@ EnvironmentDescription& EnvironmentDescription::operator =(const XmlNode& xmlNod
     XmlNode environmentNameNode = resultNode.FirstChild("EnvironmentName");
     if(!environmentNameNode.IsNull())
     {
-      m_environmentName = StringUtils::Trim(environmentNameNode.GetText().c_str());
+      m_environmentName = environmentNameNode.GetTextView().Trim().ToString();
       m_environmentNameHasBeenSet = true;
     }
     XmlNode environmentIdNode = resultNode.FirstChild("EnvironmentId");
     if(!environmentIdNode.IsNull())
     {
-      m_environmentId = StringUtils::Trim(environmentIdNode.GetText().c_str());
+      m_environmentId = environmentIdNode.GetTextView().Trim().ToString();
       m_environmentIdHasBeenSet = true;
     }
     XmlNode applicationNameNode = resultNode.FirstChild("ApplicationName");
     if(!applicationNameNode.IsNull())
     {
-      m_applicationName = StringUtils::Trim(applicationNameNode.GetText().c_str());
+      m_applicationName = applicationNameNode.GetTextView().Trim().ToString();
       m_applicationNameHasBeenSet = true;
     }
     XmlNode versionLabelNode = resultNode.FirstChild("VersionLabel");
     if(!versionLabelNode.IsNull())
     {
-      m_versionLabel = StringUtils::Trim(versionLabelNode.GetText().c_str());
+      m_versionLabel = versionLabelNode.GetTextView().Trim().ToString();
       m_versionLabelHasBeenSet = true;
     }
     XmlNode solutionStackNameNode = resultNode.FirstChild("SolutionStackName");
     if(!solutionStackNameNode.IsNull())
     {
-      m_solutionStackName = StringUtils::Trim(solutionStackNameNode.GetText().c_str());
+      m_solutionStackName = solutionStackNameNode.GetTextView().Trim().ToString();
       m_solutionStackNameHasBeenSet = true;
     }
     XmlNode templateNameNode = resultNode.FirstChild("TemplateName");
     if(!templateNameNode.IsNull())
     {
-      m_templateName = StringUtils::Trim(templateNameNode.GetText().c_str());
+      m_templateName = templateNameNode.GetTextView().Trim().ToString();
       m_templateNameHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode endpointURLNode = resultNode.FirstChild("EndpointURL");
     if(!endpointURLNode.IsNull())
     {
-      m_endpointURL = StringUtils::Trim(endpointURLNode.GetText().c_str());
+      m_endpointURL = endpointURLNode.GetTextView().Trim().ToString();
       m_endpointURLHasBeenSet = true;
     }
     XmlNode cNAMENode = resultNode.FirstChild("CNAME");
     if(!cNAMENode.IsNull())
     {
-      m_cNAME = StringUtils::Trim(cNAMENode.GetText().c_str());
+      m_cNAME = cNAMENode.GetTextView().Trim().ToString();
       m_cNAMEHasBeenSet = true;
     }
     XmlNode dateCreatedNode = resultNode.FirstChild("DateCreated");
     if(!dateCreatedNode.IsNull())
     {
-      m_dateCreated = DateTime(StringUtils::Trim(dateCreatedNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_dateCreated = DateTime(dateCreatedNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_dateCreatedHasBeenSet = true;
     }
     XmlNode dateUpdatedNode = resultNode.FirstChild("DateUpdated");
     if(!dateUpdatedNode.IsNull())
     {
-      m_dateUpdated = DateTime(StringUtils::Trim(dateUpdatedNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_dateUpdated = DateTime(dateUpdatedNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_dateUpdatedHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = EnvironmentStatusMapper::GetEnvironmentStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = EnvironmentStatusMapper::GetEnvironmentStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode abortableOperationInProgressNode = resultNode.FirstChild("AbortableOperationInProgress");
     if(!abortableOperationInProgressNode.IsNull())
     {
-      m_abortableOperationInProgress = StringUtils::ConvertToBool(StringUtils::Trim(abortableOperationInProgressNode.GetText().c_str()).c_str());
+      m_abortableOperationInProgress = StringUtils::ConvertToBool(abortableOperationInProgressNode.GetTextView().Trim().ToString().c_str());
       m_abortableOperationInProgressHasBeenSet = true;
     }
     XmlNode healthNode = resultNode.FirstChild("Health");
     if(!healthNode.IsNull())
     {
-      m_health = EnvironmentHealthMapper::GetEnvironmentHealthForName(StringUtils::Trim(healthNode.GetText().c_str()).c_str());
+      m_health = EnvironmentHealthMapper::GetEnvironmentHealthForName(healthNode.GetTextView().Trim().ToString().c_str());
       m_healthHasBeenSet = true;
     }
     XmlNode healthStatusNode = resultNode.FirstChild("HealthStatus");
     if(!healthStatusNode.IsNull())
     {
-      m_healthStatus = EnvironmentHealthStatusMapper::GetEnvironmentHealthStatusForName(StringUtils::Trim(healthStatusNode.GetText().c_str()).c_str());
+      m_healthStatus = EnvironmentHealthStatusMapper::GetEnvironmentHealthStatusForName(healthStatusNode.GetTextView().Trim().ToString().c_str());
       m_healthStatusHasBeenSet = true;
     }
     XmlNode resourcesNode = resultNode.FirstChild("Resources");
@@ -207,57 +208,57 @@ void EnvironmentDescription::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_environmentNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+      oStream << location << index << locationValue << ".EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
 
   if(m_environmentIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EnvironmentId=" << StringUtils::URLEncode(m_environmentId.c_str()) << "&";
+      oStream << location << index << locationValue << ".EnvironmentId=" << StringUtils::URLEncoded(m_environmentId) << "&";
   }
 
   if(m_applicationNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_versionLabelHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VersionLabel=" << StringUtils::URLEncode(m_versionLabel.c_str()) << "&";
+      oStream << location << index << locationValue << ".VersionLabel=" << StringUtils::URLEncoded(m_versionLabel) << "&";
   }
 
   if(m_solutionStackNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SolutionStackName=" << StringUtils::URLEncode(m_solutionStackName.c_str()) << "&";
+      oStream << location << index << locationValue << ".SolutionStackName=" << StringUtils::URLEncoded(m_solutionStackName) << "&";
   }
 
   if(m_templateNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TemplateName=" << StringUtils::URLEncode(m_templateName.c_str()) << "&";
+      oStream << location << index << locationValue << ".TemplateName=" << StringUtils::URLEncoded(m_templateName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_endpointURLHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EndpointURL=" << StringUtils::URLEncode(m_endpointURL.c_str()) << "&";
+      oStream << location << index << locationValue << ".EndpointURL=" << StringUtils::URLEncoded(m_endpointURL) << "&";
   }
 
   if(m_cNAMEHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CNAME=" << StringUtils::URLEncode(m_cNAME.c_str()) << "&";
+      oStream << location << index << locationValue << ".CNAME=" << StringUtils::URLEncoded(m_cNAME) << "&";
   }
 
   if(m_dateCreatedHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DateCreated=" << StringUtils::URLEncode(m_dateCreated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".DateCreated=" << StringUtils::URLEncoded(m_dateCreated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_dateUpdatedHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DateUpdated=" << StringUtils::URLEncode(m_dateUpdated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".DateUpdated=" << StringUtils::URLEncoded(m_dateUpdated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_statusHasBeenSet)
@@ -282,16 +283,16 @@ void EnvironmentDescription::OutputToStream(Aws::OStream& oStream, const char* l
 
   if(m_resourcesHasBeenSet)
   {
-      Aws::StringStream resourcesLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream resourcesLocationAndMemberSs;
       resourcesLocationAndMemberSs << location << index << locationValue << ".Resources";
-      m_resources.OutputToStream(oStream, resourcesLocationAndMemberSs.str().c_str());
+      m_resources.OutputToStream(oStream, resourcesLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_tierHasBeenSet)
   {
-      Aws::StringStream tierLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream tierLocationAndMemberSs;
       tierLocationAndMemberSs << location << index << locationValue << ".Tier";
-      m_tier.OutputToStream(oStream, tierLocationAndMemberSs.str().c_str());
+      m_tier.OutputToStream(oStream, tierLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_environmentLinksHasBeenSet)
@@ -299,17 +300,17 @@ void EnvironmentDescription::OutputToStream(Aws::OStream& oStream, const char* l
       unsigned environmentLinksIdx = 1;
       for(auto& item : m_environmentLinks)
       {
-        Aws::StringStream environmentLinksSs;
+        Aws::Utils::Stream::StringOutputStream environmentLinksSs;
         environmentLinksSs << location << index << locationValue << ".EnvironmentLinks.member." << environmentLinksIdx++;
-        item.OutputToStream(oStream, environmentLinksSs.str().c_str());
+        item.OutputToStream(oStream, environmentLinksSs.GetString().c_str());
       }
   }
 
   if(m_responseMetadataHasBeenSet)
   {
-      Aws::StringStream responseMetadataLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream responseMetadataLocationAndMemberSs;
       responseMetadataLocationAndMemberSs << location << index << locationValue << ".ResponseMetadata";
-      m_responseMetadata.OutputToStream(oStream, responseMetadataLocationAndMemberSs.str().c_str());
+      m_responseMetadata.OutputToStream(oStream, responseMetadataLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -318,47 +319,47 @@ void EnvironmentDescription::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_environmentNameHasBeenSet)
   {
-      oStream << location << ".EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+      oStream << location << ".EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
   if(m_environmentIdHasBeenSet)
   {
-      oStream << location << ".EnvironmentId=" << StringUtils::URLEncode(m_environmentId.c_str()) << "&";
+      oStream << location << ".EnvironmentId=" << StringUtils::URLEncoded(m_environmentId) << "&";
   }
   if(m_applicationNameHasBeenSet)
   {
-      oStream << location << ".ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+      oStream << location << ".ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
   if(m_versionLabelHasBeenSet)
   {
-      oStream << location << ".VersionLabel=" << StringUtils::URLEncode(m_versionLabel.c_str()) << "&";
+      oStream << location << ".VersionLabel=" << StringUtils::URLEncoded(m_versionLabel) << "&";
   }
   if(m_solutionStackNameHasBeenSet)
   {
-      oStream << location << ".SolutionStackName=" << StringUtils::URLEncode(m_solutionStackName.c_str()) << "&";
+      oStream << location << ".SolutionStackName=" << StringUtils::URLEncoded(m_solutionStackName) << "&";
   }
   if(m_templateNameHasBeenSet)
   {
-      oStream << location << ".TemplateName=" << StringUtils::URLEncode(m_templateName.c_str()) << "&";
+      oStream << location << ".TemplateName=" << StringUtils::URLEncoded(m_templateName) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_endpointURLHasBeenSet)
   {
-      oStream << location << ".EndpointURL=" << StringUtils::URLEncode(m_endpointURL.c_str()) << "&";
+      oStream << location << ".EndpointURL=" << StringUtils::URLEncoded(m_endpointURL) << "&";
   }
   if(m_cNAMEHasBeenSet)
   {
-      oStream << location << ".CNAME=" << StringUtils::URLEncode(m_cNAME.c_str()) << "&";
+      oStream << location << ".CNAME=" << StringUtils::URLEncoded(m_cNAME) << "&";
   }
   if(m_dateCreatedHasBeenSet)
   {
-      oStream << location << ".DateCreated=" << StringUtils::URLEncode(m_dateCreated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".DateCreated=" << StringUtils::URLEncoded(m_dateCreated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_dateUpdatedHasBeenSet)
   {
-      oStream << location << ".DateUpdated=" << StringUtils::URLEncode(m_dateUpdated.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".DateUpdated=" << StringUtils::URLEncoded(m_dateUpdated.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_statusHasBeenSet)
   {
@@ -393,9 +394,9 @@ void EnvironmentDescription::OutputToStream(Aws::OStream& oStream, const char* l
       unsigned environmentLinksIdx = 1;
       for(auto& item : m_environmentLinks)
       {
-        Aws::StringStream environmentLinksSs;
+        Aws::Utils::Stream::StringOutputStream environmentLinksSs;
         environmentLinksSs << location <<  ".EnvironmentLinks.member." << environmentLinksIdx++;
-        item.OutputToStream(oStream, environmentLinksSs.str().c_str());
+        item.OutputToStream(oStream, environmentLinksSs.GetString().c_str());
       }
   }
   if(m_responseMetadataHasBeenSet)
@@ -29,31 +29,35 @@ namespace Aws
       namespace EnvironmentHealthMapper
       {
 
-        static const int Green_HASH = HashingUtils::HashString("Green");
-        static const int Yellow_HASH = HashingUtils::HashString("Yellow");
-        static const int Red_HASH = HashingUtils::HashString("Red");
-        static const int Grey_HASH = HashingUtils::HashString("Grey");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Green_HASH = 69066467;
+        static const int Yellow_HASH = -1650372460;
+        static const int Red_HASH = 82033;
+        static const int Grey_HASH = 2227967;
 
 
         EnvironmentHealth GetEnvironmentHealthForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Green_HASH)
+          switch (hashCode)
           {
+          case Green_HASH:
             return EnvironmentHealth::Green;
-          }
-          else if (hashCode == Yellow_HASH)
-          {
+          case Yellow_HASH:
             return EnvironmentHealth::Yellow;
-          }
-          else if (hashCode == Red_HASH)
-          {
+          case Red_HASH:
             return EnvironmentHealth::Red;
-          }
-          else if (hashCode == Grey_HASH)
-          {
+          case Grey_HASH:
             return EnvironmentHealth::Grey;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,51 +29,47 @@ namespace Aws
       namespace EnvironmentHealthAttributeMapper
       {
 
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int Color_HASH = HashingUtils::HashString("Color");
-        static const int Causes_HASH = HashingUtils::HashString("Causes");
-        static const int ApplicationMetrics_HASH = HashingUtils::HashString("ApplicationMetrics");
-        static const int InstancesHealth_HASH = HashingUtils::HashString("InstancesHealth");
-        static const int All_HASH = HashingUtils::HashString("All");
-        static const int HealthStatus_HASH = HashingUtils::HashString("HealthStatus");
-        static const int RefreshedAt_HASH = HashingUtils::HashString("RefreshedAt");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Status_HASH = -1808614382;
+        static const int Color_HASH = 65290051;
+        static const int Causes_HASH = 2011333962;
+        static const int ApplicationMetrics_HASH = -921733773;
+        static const int InstancesHealth_HASH = 1187204698;
+        static const int All_HASH = 65921;
+        static const int HealthStatus_HASH = 682024334;
+        static const int RefreshedAt_HASH = 281067117;
 
 
         EnvironmentHealthAttribute GetEnvironmentHealthAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Status_HASH)
+          switch (hashCode)
           {
+          case Status_HASH:
             return EnvironmentHealthAttribute::Status;
-          }
-          else if (hashCode == Color_HASH)
-          {
+          case Color_HASH:
             return EnvironmentHealthAttribute::Color;
-          }
-          else if (hashCode == Causes_HASH)
-          {
+          case Causes_HASH:
             return EnvironmentHealthAttribute::Causes;
-          }
-          else if (hashCode == ApplicationMetrics_HASH)
-          {
+          case ApplicationMetrics_HASH:
             return EnvironmentHealthAttribute::ApplicationMetrics;
-          }
-          else if (hashCode == InstancesHealth_HASH)
-          {
+          case InstancesHealth_HASH:
             return EnvironmentHealthAttribute::InstancesHealth;
-          }
-          else if (hashCode == All_HASH)
-          {
+          case All_HASH:
             return EnvironmentHealthAttribute::All;
-          }
-          else if (hashCode == HealthStatus_HASH)
-          {
+          case HealthStatus_HASH:
             return EnvironmentHealthAttribute::HealthStatus;
-          }
-          else if (hashCode == RefreshedAt_HASH)
-          {
+          case RefreshedAt_HASH:
             return EnvironmentHealthAttribute::RefreshedAt;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,51 +29,47 @@ namespace Aws
       namespace EnvironmentHealthStatusMapper
       {
 
-        static const int NoData_HASH = HashingUtils::HashString("NoData");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Ok_HASH = HashingUtils::HashString("Ok");
-        static const int Info_HASH = HashingUtils::HashString("Info");
-        static const int Warning_HASH = HashingUtils::HashString("Warning");
-        static const int Degraded_HASH = HashingUtils::HashString("Degraded");
-        static const int Severe_HASH = HashingUtils::HashString("Severe");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int NoData_HASH = -1957259989;
+        static const int Unknown_HASH = 1379812394;
+        static const int Pending_HASH = 982065527;
+        static const int Ok_HASH = 2556;
+        static const int Info_HASH = 2283726;
+        static const int Warning_HASH = -1505867908;
+        static const int Degraded_HASH = 752650062;
+        static const int Severe_HASH = -1821856108;
 
 
         EnvironmentHealthStatus GetEnvironmentHealthStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NoData_HASH)
+          switch (hashCode)
           {
+          case NoData_HASH:
             return EnvironmentHealthStatus::NoData;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
+          case Unknown_HASH:
             return EnvironmentHealthStatus::Unknown;
-          }
-          else if (hashCode == Pending_HASH)
-          {
+          case Pending_HASH:
             return EnvironmentHealthStatus::Pending;
-          }
-          else if (hashCode == Ok_HASH)
-          {
+          case Ok_HASH:
             return EnvironmentHealthStatus::Ok;
-          }
-          else if (hashCode == Info_HASH)
-          {
+          case Info_HASH:
             return EnvironmentHealthStatus::Info;
-          }
-          else if (hashCode == Warning_HASH)
-          {
+          case Warning_HASH:
             return EnvironmentHealthStatus::Warning;
-          }
-          else if (hashCode == Degraded_HASH)
-          {
+          case Degraded_HASH:
             return EnvironmentHealthStatus::Degraded;
-          }
-          else if (hashCode == Severe_HASH)
-          {
+          case Severe_HASH:
             return EnvironmentHealthStatus::Severe;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -55,25 +55,25 @@ EnvironmentInfoDescription& EnvironmentInfoDescription::operator =(const XmlNode
     XmlNode infoTypeNode = resultNode.FirstChild("InfoType");
     if(!infoTypeNode.IsNull())
     {
-      m_infoType = EnvironmentInfoTypeMapper::GetEnvironmentInfoTypeForName(StringUtils::Trim(infoTypeNode.GetText().c_str()).c_str());
+      m_infoType = EnvironmentInfoTypeMapper::GetEnvironmentInfoTypeForName(infoTypeNode.GetTextView().Trim().ToString().c_str());
       m_infoTypeHasBeenSet = true;
     }
     XmlNode ec2InstanceIdNode = resultNode.FirstChild("Ec2InstanceId");
     if(!ec2InstanceIdNode.IsNull())
     {
-      m_ec2InstanceId = StringUtils::Trim(ec2InstanceIdNode.GetText().c_str());
+      m_ec2InstanceId = ec2InstanceIdNode.GetTextView().Trim().ToString();
       m_ec2InstanceIdHasBeenSet = true;
     }
     XmlNode sampleTimestampNode = resultNode.FirstChild("SampleTimestamp");
     if(!sampleTimestampNode.IsNull())
     {
-      m_sampleTimestamp = DateTime(StringUtils::Trim(sampleTimestampNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_sampleTimestamp = DateTime(sampleTimestampNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_sampleTimestampHasBeenSet = true;
     }
     XmlNode messageNode = resultNode.FirstChild("Message");
     if(!messageNode.IsNull())
     {
-      m_message = StringUtils::Trim(messageNode.GetText().c_str());
+      m_message = messageNode.GetTextView().Trim().ToString();
       m_messageHasBeenSet = true;
     }
   }
@@ -90,17 +90,17 @@ void EnvironmentInfoDescription::OutputToStream(Aws::OStream& oStream, const cha
 
   if(m_ec2InstanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Ec2InstanceId=" << StringUtils::URLEncode(m_ec2InstanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".Ec2InstanceId=" << StringUtils::URLEncoded(m_ec2InstanceId) << "&";
   }
 
   if(m_sampleTimestampHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SampleTimestamp=" << StringUtils::URLEncode(m_sampleTimestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".SampleTimestamp=" << StringUtils::URLEncoded(m_sampleTimestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_messageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 
 }
@@ -113,15 +113,15 @@ void EnvironmentInfoDescription::OutputToStream(Aws::OStream& oStream, const cha
   }
   if(m_ec2InstanceIdHasBeenSet)
   {
-      oStream << location << ".Ec2InstanceId=" << StringUtils::URLEncode(m_ec2InstanceId.c_str()) << "&";
+      oStream << location << ".Ec2InstanceId=" << StringUtils::URLEncoded(m_ec2InstanceId) << "&";
   }
   if(m_sampleTimestampHasBeenSet)
   {
-      oStream << location << ".SampleTimestamp=" << StringUtils::URLEncode(m_sampleTimestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".SampleTimestamp=" << StringUtils::URLEncoded(m_sampleTimestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_messageHasBeenSet)
   {
-      oStream << location << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 }
 
@@ -29,21 +29,29 @@ namespace Aws
       namespace EnvironmentInfoTypeMapper
       {
 
-        static const int tail_HASH = HashingUtils::HashString("tail");
-        static const int bundle_HASH = HashingUtils::HashString("bundle");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int tail_HASH = 3552336;
+        static const int bundle_HASH = -1377881982;
 
 
         EnvironmentInfoType GetEnvironmentInfoTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == tail_HASH)
+          switch (hashCode)
           {
+          case tail_HASH:
             return EnvironmentInfoType::tail;
-          }
-          else if (hashCode == bundle_HASH)
-          {
+          case bundle_HASH:
             return EnvironmentInfoType::bundle;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
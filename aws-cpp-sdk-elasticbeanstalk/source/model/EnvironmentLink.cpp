@@ -51,13 +51,13 @@ EnvironmentLink& EnvironmentLink::operator =(const XmlNode& xmlNode)
     XmlNode linkNameNode = resultNode.FirstChild("LinkName");
     if(!linkNameNode.IsNull())
     {
-      m_linkName = StringUtils::Trim(linkNameNode.GetText().c_str());
+      m_linkName = linkNameNode.GetTextView().Trim().ToString();
       m_linkNameHasBeenSet = true;
     }
     XmlNode environmentNameNode = resultNode.FirstChild("EnvironmentName");
     if(!environmentNameNode.IsNull())
     {
-      m_environmentName = StringUtils::Trim(environmentNameNode.GetText().c_str());
+      m_environmentName = environmentNameNode.GetTextView().Trim().ToString();
       m_environmentNameHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void EnvironmentLink::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_linkNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LinkName=" << StringUtils::URLEncode(m_linkName.c_str()) << "&";
+      oStream << location << index << locationValue << ".LinkName=" << StringUtils::URLEncoded(m_linkName) << "&";
   }
 
   if(m_environmentNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+      oStream << location << index << locationValue << ".EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void EnvironmentLink::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_linkNameHasBeenSet)
   {
-      oStream << location << ".LinkName=" << StringUtils::URLEncode(m_linkName.c_str()) << "&";
+      oStream << location << ".LinkName=" << StringUtils::URLEncoded(m_linkName) << "&";
   }
   if(m_environmentNameHasBeenSet)
   {
-      oStream << location << ".EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+      oStream << location << ".EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
 }
 
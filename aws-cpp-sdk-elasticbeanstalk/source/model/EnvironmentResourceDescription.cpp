@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,7 +62,7 @@ EnvironmentResourceDescription& EnvironmentResourceDescription::operator =(const
     XmlNode environmentNameNode = resultNode.FirstChild("EnvironmentName");
     if(!environmentNameNode.IsNull())
     {
-      m_environmentName = StringUtils::Trim(environmentNameNode.GetText().c_str());
+      m_environmentName = environmentNameNode.GetTextView().Trim().ToString();
       m_environmentNameHasBeenSet = true;
     }
     XmlNode autoScalingGroupsNode = resultNode.FirstChild("AutoScalingGroups");
@@ -145,7 +146,7 @@ void EnvironmentResourceDescription::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_environmentNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+      oStream << location << index << locationValue << ".EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
 
   if(m_autoScalingGroupsHasBeenSet)
@@ -153,9 +154,9 @@ void EnvironmentResourceDescription::OutputToStream(Aws::OStream& oStream, const
       unsigned autoScalingGroupsIdx = 1;
       for(auto& item : m_autoScalingGroups)
       {
-        Aws::StringStream autoScalingGroupsSs;
+        Aws::Utils::Stream::StringOutputStream autoScalingGroupsSs;
         autoScalingGroupsSs << location << index << locationValue << ".AutoScalingGroups.member." << autoScalingGroupsIdx++;
-        item.OutputToStream(oStream, autoScalingGroupsSs.str().c_str());
+        item.OutputToStream(oStream, autoScalingGroupsSs.GetString().c_str());
       }
   }
 
@@ -164,9 +165,9 @@ void EnvironmentResourceDescription::OutputToStream(Aws::OStream& oStream, const
       unsigned instancesIdx = 1;
       for(auto& item : m_instances)
       {
-        Aws::StringStream instancesSs;
+        Aws::Utils::Stream::StringOutputStream instancesSs;
         instancesSs << location << index << locationValue << ".Instances.member." << instancesIdx++;
-        item.OutputToStream(oStream, instancesSs.str().c_str());
+        item.OutputToStream(oStream, instancesSs.GetString().c_str());
       }
   }
 
@@ -175,9 +176,9 @@ void EnvironmentResourceDescription::OutputToStream(Aws::OStream& oStream, const
       unsigned launchConfigurationsIdx = 1;
       for(auto& item : m_launchConfigurations)
       {
-        Aws::StringStream launchConfigurationsSs;
+        Aws::Utils::Stream::StringOutputStream launchConfigurationsSs;
         launchConfigurationsSs << location << index << locationValue << ".LaunchConfigurations.member." << launchConfigurationsIdx++;
-        item.OutputToStream(oStream, launchConfigurationsSs.str().c_str());
+        item.OutputToStream(oStream, launchConfigurationsSs.GetString().c_str());
       }
   }
 
@@ -186,9 +187,9 @@ void EnvironmentResourceDescription::OutputToStream(Aws::OStream& oStream, const
       unsigned loadBalancersIdx = 1;
       for(auto& item : m_loadBalancers)
       {
-        Aws::StringStream loadBalancersSs;
+        Aws::Utils::Stream::StringOutputStream loadBalancersSs;
         loadBalancersSs << location << index << locationValue << ".LoadBalancers.member." << loadBalancersIdx++;
-        item.OutputToStream(oStream, loadBalancersSs.str().c_str());
+        item.OutputToStream(oStream, loadBalancersSs.GetString().c_str());
       }
   }
 
@@ -197,9 +198,9 @@ void EnvironmentResourceDescription::OutputToStream(Aws::OStream& oStream, const
       unsigned triggersIdx = 1;
       for(auto& item : m_triggers)
       {
-        Aws::StringStream triggersSs;
+        Aws::Utils::Stream::StringOutputStream triggersSs;
         triggersSs << location << index << locationValue << ".Triggers.member." << triggersIdx++;
-        item.OutputToStream(oStream, triggersSs.str().c_str());
+        item.OutputToStream(oStream, triggersSs.GetString().c_str());
       }
   }
 
@@ -208,9 +209,9 @@ void EnvironmentResourceDescription::OutputToStream(Aws::OStream& oStream, const
       unsigned queuesIdx = 1;
       for(auto& item : m_queues)
       {
-        Aws::StringStream queuesSs;
+        Aws::Utils::Stream::StringOutputStream queuesSs;
         queuesSs << location << index << locationValue << ".Queues.member." << queuesIdx++;
-        item.OutputToStream(oStream, queuesSs.str().c_str());
+        item.OutputToStream(oStream, queuesSs.GetString().c_str());
       }
   }
 
@@ -220,16 +221,16 @@ void EnvironmentResourceDescription::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_environmentNameHasBeenSet)
   {
-      oStream << location << ".EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+      oStream << location << ".EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
   if(m_autoScalingGroupsHasBeenSet)
   {
       unsigned autoScalingGroupsIdx = 1;
       for(auto& item : m_autoScalingGroups)
       {
-        Aws::StringStream autoScalingGroupsSs;
+        Aws::Utils::Stream::StringOutputStream autoScalingGroupsSs;
         autoScalingGroupsSs << location <<  ".AutoScalingGroups.member." << autoScalingGroupsIdx++;
-        item.OutputToStream(oStream, autoScalingGroupsSs.str().c_str());
+        item.OutputToStream(oStream, autoScalingGroupsSs.GetString().c_str());
       }
   }
   if(m_instancesHasBeenSet)
@@ -237,9 +238,9 @@ void EnvironmentResourceDescription::OutputToStream(Aws::OStream& oStream, const
       unsigned instancesIdx = 1;
       for(auto& item : m_instances)
       {
-        Aws::StringStream instancesSs;
+        Aws::Utils::Stream::StringOutputStream instancesSs;
         instancesSs << location <<  ".Instances.member." << instancesIdx++;
-        item.OutputToStream(oStream, instancesSs.str().c_str());
+        item.OutputToStream(oStream, instancesSs.GetString().c_str());
       }
   }
   if(m_launchConfigurationsHasBeenSet)
@@ -247,9 +248,9 @@ void EnvironmentResourceDescription::OutputToStream(Aws::OStream& oStream, const
       unsigned launchConfigurationsIdx = 1;
       for(auto& item : m_launchConfigurations)
       {
-        Aws::StringStream launchConfigurationsSs;
+        Aws::Utils::Stream::StringOutputStream launchConfigurationsSs;
         launchConfigurationsSs << location <<  ".LaunchConfigurations.member." << launchConfigurationsIdx++;
-        item.OutputToStream(oStream, launchConfigurationsSs.str().c_str());
+        item.OutputToStream(oStream, launchConfigurationsSs.GetString().c_str());
       }
   }
   if(m_loadBalancersHasBeenSet)
@@ -257,9 +258,9 @@ void EnvironmentResourceDescription::OutputToStream(Aws::OStream& oStream, const
       unsigned loadBalancersIdx = 1;
       for(auto& item : m_loadBalancers)
       {
-        Aws::StringStream loadBalancersSs;
+        Aws::Utils::Stream::StringOutputStream loadBalancersSs;
         loadBalancersSs << location <<  ".LoadBalancers.member." << loadBalancersIdx++;
-        item.OutputToStream(oStream, loadBalancersSs.str().c_str());
+        item.OutputToStream(oStream, loadBalancersSs.GetString().c_str());
       }
   }
   if(m_triggersHasBeenSet)
@@ -267,9 +268,9 @@ void EnvironmentResourceDescription::OutputToStream(Aws::OStream& oStream, const
       unsigned triggersIdx = 1;
       for(auto& item : m_triggers)
       {
-        Aws::StringStream triggersSs;
+        Aws::Utils::Stream::StringOutputStream triggersSs;
         triggersSs << location <<  ".Triggers.member." << triggersIdx++;
-        item.OutputToStream(oStream, triggersSs.str().c_str());
+        item.OutputToStream(oStream, triggersSs.GetString().c_str());
       }
   }
   if(m_queuesHasBeenSet)
@@ -277,9 +278,9 @@ void EnvironmentResourceDescription::OutputToStream(Aws::OStream& oStream, const
       unsigned queuesIdx = 1;
       for(auto& item : m_queues)
       {
-        Aws::StringStream queuesSs;
+        Aws::Utils::Stream::StringOutputStream queuesSs;
         queuesSs << location <<  ".Queues.member." << queuesIdx++;
-        item.OutputToStream(oStream, queuesSs.str().c_str());
+        item.OutputToStream(oStream, queuesSs.GetString().c_str());
       }
   }
 }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,9 +62,9 @@ void EnvironmentResourcesDescription::OutputToStream(Aws::OStream& oStream, cons
 {
   if(m_loadBalancerHasBeenSet)
   {
-      Aws::StringStream loadBalancerLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream loadBalancerLocationAndMemberSs;
       loadBalancerLocationAndMemberSs << location << index << locationValue << ".LoadBalancer";
-      m_loadBalancer.OutputToStream(oStream, loadBalancerLocationAndMemberSs.str().c_str());
+      m_loadBalancer.OutputToStream(oStream, loadBalancerLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -29,36 +29,38 @@ namespace Aws
       namespace EnvironmentStatusMapper
       {
 
-        static const int Launching_HASH = HashingUtils::HashString("Launching");
-        static const int Updating_HASH = HashingUtils::HashString("Updating");
-        static const int Ready_HASH = HashingUtils::HashString("Ready");
-        static const int Terminating_HASH = HashingUtils::HashString("Terminating");
-        static const int Terminated_HASH = HashingUtils::HashString("Terminated");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Launching_HASH = 1328878383;
+        static const int Updating_HASH = 1387244390;
+        static const int Ready_HASH = 78834051;
+        static const int Terminating_HASH = -250712386;
+        static const int Terminated_HASH = 684649027;
 
 
         EnvironmentStatus GetEnvironmentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Launching_HASH)
+          switch (hashCode)
           {
+          case Launching_HASH:
             return EnvironmentStatus::Launching;
-          }
-          else if (hashCode == Updating_HASH)
-          {
+          case Updating_HASH:
             return EnvironmentStatus::Updating;
-          }
-          else if (hashCode == Ready_HASH)
-          {
+          case Ready_HASH:
             return EnvironmentStatus::Ready;
-          }
-          else if (hashCode == Terminating_HASH)
-          {
+          case Terminating_HASH:
             return EnvironmentStatus::Terminating;
-          }
-          else if (hashCode == Terminated_HASH)
-          {
+          case Terminated_HASH:
             return EnvironmentStatus::Terminated;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
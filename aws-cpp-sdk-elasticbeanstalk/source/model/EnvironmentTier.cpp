@@ -53,19 +53,19 @@ EnvironmentTier& EnvironmentTier::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode typeNode = resultNode.FirstChild("Type");
     if(!typeNode.IsNull())
     {
-      m_type = StringUtils::Trim(typeNode.GetText().c_str());
+      m_type = typeNode.GetTextView().Trim().ToString();
       m_typeHasBeenSet = true;
     }
     XmlNode versionNode = resultNode.FirstChild("Version");
     if(!versionNode.IsNull())
     {
-      m_version = StringUtils::Trim(versionNode.GetText().c_str());
+      m_version = versionNode.GetTextView().Trim().ToString();
       m_versionHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void EnvironmentTier::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_typeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Type=" << StringUtils::URLEncode(m_type.c_str()) << "&";
+      oStream << location << index << locationValue << ".Type=" << StringUtils::URLEncoded(m_type) << "&";
   }
 
   if(m_versionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Version=" << StringUtils::URLEncode(m_version.c_str()) << "&";
+      oStream << location << index << locationValue << ".Version=" << StringUtils::URLEncoded(m_version) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void EnvironmentTier::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_typeHasBeenSet)
   {
-      oStream << location << ".Type=" << StringUtils::URLEncode(m_type.c_str()) << "&";
+      oStream << location << ".Type=" << StringUtils::URLEncoded(m_type) << "&";
   }
   if(m_versionHasBeenSet)
   {
-      oStream << location << ".Version=" << StringUtils::URLEncode(m_version.c_str()) << "&";
+      oStream << location << ".Version=" << StringUtils::URLEncoded(m_version) << "&";
   }
 }
 
@@ -63,49 +63,49 @@ EventDescription& EventDescription::operator =(const XmlNode& xmlNode)
     XmlNode eventDateNode = resultNode.FirstChild("EventDate");
     if(!eventDateNode.IsNull())
     {
-      m_eventDate = DateTime(StringUtils::Trim(eventDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_eventDate = DateTime(eventDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_eventDateHasBeenSet = true;
     }
     XmlNode messageNode = resultNode.FirstChild("Message");
     if(!messageNode.IsNull())
     {
-      m_message = StringUtils::Trim(messageNode.GetText().c_str());
+      m_message = messageNode.GetTextView().Trim().ToString();
       m_messageHasBeenSet = true;
     }
     XmlNode applicationNameNode = resultNode.FirstChild("ApplicationName");
     if(!applicationNameNode.IsNull())
     {
-      m_applicationName = StringUtils::Trim(applicationNameNode.GetText().c_str());
+      m_applicationName = applicationNameNode.GetTextView().Trim().ToString();
       m_applicationNameHasBeenSet = true;
     }
     XmlNode versionLabelNode = resultNode.FirstChild("VersionLabel");
     if(!versionLabelNode.IsNull())
     {
-      m_versionLabel = StringUtils::Trim(versionLabelNode.GetText().c_str());
+      m_versionLabel = versionLabelNode.GetTextView().Trim().ToString();
       m_versionLabelHasBeenSet = true;
     }
     XmlNode templateNameNode = resultNode.FirstChild("TemplateName");
     if(!templateNameNode.IsNull())
     {
-      m_templateName = StringUtils::Trim(templateNameNode.GetText().c_str());
+      m_templateName = templateNameNode.GetTextView().Trim().ToString();
       m_templateNameHasBeenSet = true;
     }
     XmlNode environmentNameNode = resultNode.FirstChild("EnvironmentName");
     if(!environmentNameNode.IsNull())
     {
-      m_environmentName = StringUtils::Trim(environmentNameNode.GetText().c_str());
+      m_environmentName = environmentNameNode.GetTextView().Trim().ToString();
       m_environmentNameHasBeenSet = true;
     }
     XmlNode requestIdNode = resultNode.FirstChild("RequestId");
     if(!requestIdNode.IsNull())
     {
-      m_requestId = StringUtils::Trim(requestIdNode.GetText().c_str());
+      m_requestId = requestIdNode.GetTextView().Trim().ToString();
       m_requestIdHasBeenSet = true;
     }
     XmlNode severityNode = resultNode.FirstChild("Severity");
     if(!severityNode.IsNull())
     {
-      m_severity = EventSeverityMapper::GetEventSeverityForName(StringUtils::Trim(severityNode.GetText().c_str()).c_str());
+      m_severity = EventSeverityMapper::GetEventSeverityForName(severityNode.GetTextView().Trim().ToString().c_str());
       m_severityHasBeenSet = true;
     }
   }
@@ -117,37 +117,37 @@ void EventDescription::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_eventDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EventDate=" << StringUtils::URLEncode(m_eventDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".EventDate=" << StringUtils::URLEncoded(m_eventDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_messageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 
   if(m_applicationNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_versionLabelHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VersionLabel=" << StringUtils::URLEncode(m_versionLabel.c_str()) << "&";
+      oStream << location << index << locationValue << ".VersionLabel=" << StringUtils::URLEncoded(m_versionLabel) << "&";
   }
 
   if(m_templateNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TemplateName=" << StringUtils::URLEncode(m_templateName.c_str()) << "&";
+      oStream << location << index << locationValue << ".TemplateName=" << StringUtils::URLEncoded(m_templateName) << "&";
   }
 
   if(m_environmentNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+      oStream << location << index << locationValue << ".EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
 
   if(m_requestIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RequestId=" << StringUtils::URLEncode(m_requestId.c_str()) << "&";
+      oStream << location << index << locationValue << ".RequestId=" << StringUtils::URLEncoded(m_requestId) << "&";
   }
 
   if(m_severityHasBeenSet)
@@ -161,31 +161,31 @@ void EventDescription::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_eventDateHasBeenSet)
   {
-      oStream << location << ".EventDate=" << StringUtils::URLEncode(m_eventDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".EventDate=" << StringUtils::URLEncoded(m_eventDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_messageHasBeenSet)
   {
-      oStream << location << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
   if(m_applicationNameHasBeenSet)
   {
-      oStream << location << ".ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+      oStream << location << ".ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
   if(m_versionLabelHasBeenSet)
   {
-      oStream << location << ".VersionLabel=" << StringUtils::URLEncode(m_versionLabel.c_str()) << "&";
+      oStream << location << ".VersionLabel=" << StringUtils::URLEncoded(m_versionLabel) << "&";
   }
   if(m_templateNameHasBeenSet)
   {
-      oStream << location << ".TemplateName=" << StringUtils::URLEncode(m_templateName.c_str()) << "&";
+      oStream << location << ".TemplateName=" << StringUtils::URLEncoded(m_templateName) << "&";
   }
   if(m_environmentNameHasBeenSet)
   {
-      oStream << location << ".EnvironmentName=" << StringUtils::URLEncode(m_environmentName.c_str()) << "&";
+      oStream << location << ".EnvironmentName=" << StringUtils::URLEncoded(m_environmentName) << "&";
   }
   if(m_requestIdHasBeenSet)
   {
-      oStream << location << ".RequestId=" << StringUtils::URLEncode(m_requestId.c_str()) << "&";
+      oStream << location << ".RequestId=" << StringUtils::URLEncoded(m_requestId) << "&";
   }
   if(m_severityHasBeenSet)
   {
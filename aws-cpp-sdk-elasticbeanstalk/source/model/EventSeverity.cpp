@@ -29,41 +29,41 @@ namespace Aws
       namespace EventSeverityMapper
       {
 
-        static const int TRACE_HASH = HashingUtils::HashString("TRACE");
-        static const int DEBUG__HASH = HashingUtils::HashString("DEBUG");
-        static const int INFO_HASH = HashingUtils::HashString("INFO");
-        static const int WARN_HASH = HashingUtils::HashString("WARN");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int FATAL_HASH = HashingUtils::HashString("FATAL");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int TRACE_HASH = 80083237;
+        static const int DEBUG__HASH = 64921139;
+        static const int INFO_HASH = 2251950;
+        static const int WARN_HASH = 2656902;
+        static const int ERROR__HASH = 66247144;
+        static const int FATAL_HASH = 66665700;
 
 
         EventSeverity GetEventSeverityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRACE_HASH)
+          switch (hashCode)
           {
+          case TRACE_HASH:
             return EventSeverity::TRACE;
-          }
-          else if (hashCode == DEBUG__HASH)
-          {
+          case DEBUG__HASH:
             return EventSeverity::DEBUG_;
-          }
-          else if (hashCode == INFO_HASH)
-          {
+          case INFO_HASH:
             return EventSeverity::INFO;
-          }
-          else if (hashCode == WARN_HASH)
-          {
+          case WARN_HASH:
             return EventSeverity::WARN;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
+          case ERROR__HASH:
             return EventSeverity::ERROR_;
-          }
-          else if (hashCode == FATAL_HASH)
-          {
+          case FATAL_HASH:
             return EventSeverity::FATAL;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
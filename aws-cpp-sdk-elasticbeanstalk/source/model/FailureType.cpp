@@ -29,46 +29,44 @@ namespace Aws
       namespace FailureTypeMapper
       {
 
-        static const int UpdateCancelled_HASH = HashingUtils::HashString("UpdateCancelled");
-        static const int CancellationFailed_HASH = HashingUtils::HashString("CancellationFailed");
-        static const int RollbackFailed_HASH = HashingUtils::HashString("RollbackFailed");
-        static const int RollbackSuccessful_HASH = HashingUtils::HashString("RollbackSuccessful");
-        static const int InternalFailure_HASH = HashingUtils::HashString("InternalFailure");
-        static const int InvalidEnvironmentState_HASH = HashingUtils::HashString("InvalidEnvironmentState");
-        static const int PermissionsError_HASH = HashingUtils::HashString("PermissionsError");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int UpdateCancelled_HASH = 685087336;
+        static const int CancellationFailed_HASH = -665340096;
+        static const int RollbackFailed_HASH = 1251840097;
+        static const int RollbackSuccessful_HASH = 1500116158;
+        static const int InternalFailure_HASH = 840637421;
+        static const int InvalidEnvironmentState_HASH = 1569076789;
+        static const int PermissionsError_HASH = 959144964;
 
 
         FailureType GetFailureTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UpdateCancelled_HASH)
+          switch (hashCode)
           {
+          case UpdateCancelled_HASH:
             return FailureType::UpdateCancelled;
-          }
-          else if (hashCode == CancellationFailed_HASH)
-          {
+          case CancellationFailed_HASH:
             return FailureType::CancellationFailed;
-          }
-          else if (hashCode == RollbackFailed_HASH)
-          {
+          case RollbackFailed_HASH:
             return FailureType::RollbackFailed;
-          }
-          else if (hashCode == RollbackSuccessful_HASH)
-          {
+          case RollbackSuccessful_HASH:
             return FailureType::RollbackSuccessful;
-          }
-          else if (hashCode == InternalFailure_HASH)
-          {
+          case InternalFailure_HASH:
             return FailureType::InternalFailure;
-          }
-          else if (hashCode == InvalidEnvironmentState_HASH)
-          {
+          case InvalidEnvironmentState_HASH:
             return FailureType::InvalidEnvironmentState;
-          }
-          else if (hashCode == PermissionsError_HASH)
-          {
+          case PermissionsError_HASH:
             return FailureType::PermissionsError;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,66 +29,56 @@ namespace Aws
       namespace InstancesHealthAttributeMapper
       {
 
-        static const int HealthStatus_HASH = HashingUtils::HashString("HealthStatus");
-        static const int Color_HASH = HashingUtils::HashString("Color");
-        static const int Causes_HASH = HashingUtils::HashString("Causes");
-        static const int ApplicationMetrics_HASH = HashingUtils::HashString("ApplicationMetrics");
-        static const int RefreshedAt_HASH = HashingUtils::HashString("RefreshedAt");
-        static const int LaunchedAt_HASH = HashingUtils::HashString("LaunchedAt");
-        static const int System_HASH = HashingUtils::HashString("System");
-        static const int Deployment_HASH = HashingUtils::HashString("Deployment");
-        static const int AvailabilityZone_HASH = HashingUtils::HashString("AvailabilityZone");
-        static const int InstanceType_HASH = HashingUtils::HashString("InstanceType");
-        static const int All_HASH = HashingUtils::HashString("All");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int HealthStatus_HASH = 682024334;
+        static const int Color_HASH = 65290051;
+        static const int Causes_HASH = 2011333962;
+        static const int ApplicationMetrics_HASH = -921733773;
+        static const int RefreshedAt_HASH = 281067117;
+        static const int LaunchedAt_HASH = -1754572923;
+        static const int System_HASH = -1803461041;
+        static const int Deployment_HASH = -361982235;
+        static const int AvailabilityZone_HASH = 1777257415;
+        static const int InstanceType_HASH = -573335153;
+        static const int All_HASH = 65921;
 
 
         InstancesHealthAttribute GetInstancesHealthAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HealthStatus_HASH)
+          switch (hashCode)
           {
+          case HealthStatus_HASH:
             return InstancesHealthAttribute::HealthStatus;
-          }
-          else if (hashCode == Color_HASH)
-          {
+          case Color_HASH:
             return InstancesHealthAttribute::Color;
-          }
-          else if (hashCode == Causes_HASH)
-          {
+          case Causes_HASH:
             return InstancesHealthAttribute::Causes;
-          }
-          else if (hashCode == ApplicationMetrics_HASH)
-          {
+          case ApplicationMetrics_HASH:
             return InstancesHealthAttribute::ApplicationMetrics;
-          }
-          else if (hashCode == RefreshedAt_HASH)
-          {
+          case RefreshedAt_HASH:
             return InstancesHealthAttribute::RefreshedAt;
-          }
-          else if (hashCode == LaunchedAt_HASH)
-          {
+          case LaunchedAt_HASH:
             return InstancesHealthAttribute::LaunchedAt;
-          }
-          else if (hashCode == System_HASH)
-          {
+          case System_HASH:
             return InstancesHealthAttribute::System;
-          }
-          else if (hashCode == Deployment_HASH)
-          {
+          case Deployment_HASH:
             return InstancesHealthAttribute::Deployment;
-          }
-          else if (hashCode == AvailabilityZone_HASH)
-          {
+          case AvailabilityZone_HASH:
             return InstancesHealthAttribute::AvailabilityZone;
-          }
-          else if (hashCode == InstanceType_HASH)
-          {
+          case InstanceType_HASH:
             return InstancesHealthAttribute::InstanceType;
-          }
-          else if (hashCode == All_HASH)
-          {
+          case All_HASH:
             return InstancesHealthAttribute::All;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
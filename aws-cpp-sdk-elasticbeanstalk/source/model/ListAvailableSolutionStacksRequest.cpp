@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/ListAvailableSolutionStacksRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -25,9 +26,9 @@ ListAvailableSolutionStacksRequest::ListAvailableSolutionStacksRequest()
 
 Aws::String ListAvailableSolutionStacksRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListAvailableSolutionStacks&";
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ListAvailableSolutionStacksResult& ListAvailableSolutionStacksResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListAvailableSolutionStacksResult")
+  if (rootNode.GetNameView() != "ListAvailableSolutionStacksResult")
   {
     resultNode = rootNode.FirstChild("ListAvailableSolutionStacksResult");
   }
@@ -53,7 +53,7 @@ ListAvailableSolutionStacksResult& ListAvailableSolutionStacksResult::operator =
       XmlNode solutionStacksMember = solutionStacksNode.FirstChild("member");
       while(!solutionStacksMember.IsNull())
       {
-        m_solutionStacks.push_back(StringUtils::Trim(solutionStacksMember.GetText().c_str()));
+        m_solutionStacks.push_back(solutionStacksMember.GetTextView().Trim().ToString());
         solutionStacksMember = solutionStacksMember.NextNode("member");
       }
 
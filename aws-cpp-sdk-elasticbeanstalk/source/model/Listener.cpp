@@ -53,13 +53,13 @@ Listener& Listener::operator =(const XmlNode& xmlNode)
     XmlNode protocolNode = resultNode.FirstChild("Protocol");
     if(!protocolNode.IsNull())
     {
-      m_protocol = StringUtils::Trim(protocolNode.GetText().c_str());
+      m_protocol = protocolNode.GetTextView().Trim().ToString();
       m_protocolHasBeenSet = true;
     }
     XmlNode portNode = resultNode.FirstChild("Port");
     if(!portNode.IsNull())
     {
-      m_port = StringUtils::ConvertToInt32(StringUtils::Trim(portNode.GetText().c_str()).c_str());
+      m_port = StringUtils::ConvertToInt32(portNode.GetTextView().Trim().ToString().c_str());
       m_portHasBeenSet = true;
     }
   }
@@ -71,7 +71,7 @@ void Listener::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 {
   if(m_protocolHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Protocol=" << StringUtils::URLEncode(m_protocol.c_str()) << "&";
+      oStream << location << index << locationValue << ".Protocol=" << StringUtils::URLEncoded(m_protocol) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -85,7 +85,7 @@ void Listener::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_protocolHasBeenSet)
   {
-      oStream << location << ".Protocol=" << StringUtils::URLEncode(m_protocol.c_str()) << "&";
+      oStream << location << ".Protocol=" << StringUtils::URLEncoded(m_protocol) << "&";
   }
   if(m_portHasBeenSet)
   {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,13 +54,13 @@ LoadBalancerDescription& LoadBalancerDescription::operator =(const XmlNode& xmlN
     XmlNode loadBalancerNameNode = resultNode.FirstChild("LoadBalancerName");
     if(!loadBalancerNameNode.IsNull())
     {
-      m_loadBalancerName = StringUtils::Trim(loadBalancerNameNode.GetText().c_str());
+      m_loadBalancerName = loadBalancerNameNode.GetTextView().Trim().ToString();
       m_loadBalancerNameHasBeenSet = true;
     }
     XmlNode domainNode = resultNode.FirstChild("Domain");
     if(!domainNode.IsNull())
     {
-      m_domain = StringUtils::Trim(domainNode.GetText().c_str());
+      m_domain = domainNode.GetTextView().Trim().ToString();
       m_domainHasBeenSet = true;
     }
     XmlNode listenersNode = resultNode.FirstChild("Listeners");
@@ -83,12 +84,12 @@ void LoadBalancerDescription::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_loadBalancerNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+      oStream << location << index << locationValue << ".LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
 
   if(m_domainHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Domain=" << StringUtils::URLEncode(m_domain.c_str()) << "&";
+      oStream << location << index << locationValue << ".Domain=" << StringUtils::URLEncoded(m_domain) << "&";
   }
 
   if(m_listenersHasBeenSet)
@@ -96,9 +97,9 @@ void LoadBalancerDescription::OutputToStream(Aws::OStream& oStream, const char*
       unsigned listenersIdx = 1;
       for(auto& item : m_listeners)
       {
-        Aws::StringStream listenersSs;
+        Aws::Utils::Stream::StringOutputStream listenersSs;
         listenersSs << location << index << locationValue << ".Listeners.member." << listenersIdx++;
-        item.OutputToStream(oStream, listenersSs.str().c_str());
+        item.OutputToStream(oStream, listenersSs.GetString().c_str());
       }
   }
 
@@ -108,20 +109,20 @@ void LoadBalancerDescription::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_loadBalancerNameHasBeenSet)
   {
-      oStream << location << ".LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+      oStream << location << ".LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
   if(m_domainHasBeenSet)
   {
-      oStream << location << ".Domain=" << StringUtils::URLEncode(m_domain.c_str()) << "&";
+      oStream << location << ".Domain=" << StringUtils::URLEncoded(m_domain) << "&";
   }
   if(m_listenersHasBeenSet)
   {
       unsigned listenersIdx = 1;
       for(auto& item : m_listeners)
       {
-        Aws::StringStream listenersSs;
+        Aws::Utils::Stream::StringOutputStream listenersSs;
         listenersSs << location <<  ".Listeners.member." << listenersIdx++;
-        item.OutputToStream(oStream, listenersSs.str().c_str());
+        item.OutputToStream(oStream, listenersSs.GetString().c_str());
       }
   }
 }
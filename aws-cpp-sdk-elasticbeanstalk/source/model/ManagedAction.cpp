@@ -57,31 +57,31 @@ ManagedAction& ManagedAction::operator =(const XmlNode& xmlNode)
     XmlNode actionIdNode = resultNode.FirstChild("ActionId");
     if(!actionIdNode.IsNull())
     {
-      m_actionId = StringUtils::Trim(actionIdNode.GetText().c_str());
+      m_actionId = actionIdNode.GetTextView().Trim().ToString();
       m_actionIdHasBeenSet = true;
     }
     XmlNode actionDescriptionNode = resultNode.FirstChild("ActionDescription");
     if(!actionDescriptionNode.IsNull())
     {
-      m_actionDescription = StringUtils::Trim(actionDescriptionNode.GetText().c_str());
+      m_actionDescription = actionDescriptionNode.GetTextView().Trim().ToString();
       m_actionDescriptionHasBeenSet = true;
     }
     XmlNode actionTypeNode = resultNode.FirstChild("ActionType");
     if(!actionTypeNode.IsNull())
     {
-      m_actionType = ActionTypeMapper::GetActionTypeForName(StringUtils::Trim(actionTypeNode.GetText().c_str()).c_str());
+      m_actionType = ActionTypeMapper::GetActionTypeForName(actionTypeNode.GetTextView().Trim().ToString().c_str());
       m_actionTypeHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = ActionStatusMapper::GetActionStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = ActionStatusMapper::GetActionStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode windowStartTimeNode = resultNode.FirstChild("WindowStartTime");
     if(!windowStartTimeNode.IsNull())
     {
-      m_windowStartTime = DateTime(StringUtils::Trim(windowStartTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_windowStartTime = DateTime(windowStartTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_windowStartTimeHasBeenSet = true;
     }
   }
@@ -93,12 +93,12 @@ void ManagedAction::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_actionIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ActionId=" << StringUtils::URLEncode(m_actionId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ActionId=" << StringUtils::URLEncoded(m_actionId) << "&";
   }
 
   if(m_actionDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ActionDescription=" << StringUtils::URLEncode(m_actionDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".ActionDescription=" << StringUtils::URLEncoded(m_actionDescription) << "&";
   }
 
   if(m_actionTypeHasBeenSet)
@@ -113,7 +113,7 @@ void ManagedAction::OutputToStream(Aws::OStream& oStream, const char* location,
 
   if(m_windowStartTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".WindowStartTime=" << StringUtils::URLEncode(m_windowStartTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".WindowStartTime=" << StringUtils::URLEncoded(m_windowStartTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -122,11 +122,11 @@ void ManagedAction::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_actionIdHasBeenSet)
   {
-      oStream << location << ".ActionId=" << StringUtils::URLEncode(m_actionId.c_str()) << "&";
+      oStream << location << ".ActionId=" << StringUtils::URLEncoded(m_actionId) << "&";
   }
   if(m_actionDescriptionHasBeenSet)
   {
-      oStream << location << ".ActionDescription=" << StringUtils::URLEncode(m_actionDescription.c_str()) << "&";
+      oStream << location << ".ActionDescription=" << StringUtils::URLEncoded(m_actionDescription) << "&";
   }
   if(m_actionTypeHasBeenSet)
   {
@@ -138,7 +138,7 @@ void ManagedAction::OutputToStream(Aws::OStream& oStream, const char* location)
   }
   if(m_windowStartTimeHasBeenSet)
   {
-      oStream << location << ".WindowStartTime=" << StringUtils::URLEncode(m_windowStartTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".WindowStartTime=" << StringUtils::URLEncoded(m_windowStartTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
@@ -63,49 +63,49 @@ ManagedActionHistoryItem& ManagedActionHistoryItem::operator =(const XmlNode& xm
     XmlNode actionIdNode = resultNode.FirstChild("ActionId");
     if(!actionIdNode.IsNull())
     {
-      m_actionId = StringUtils::Trim(actionIdNode.GetText().c_str());
+      m_actionId = actionIdNode.GetTextView().Trim().ToString();
       m_actionIdHasBeenSet = true;
     }
     XmlNode actionTypeNode = resultNode.FirstChild("ActionType");
     if(!actionTypeNode.IsNull())
     {
-      m_actionType = ActionTypeMapper::GetActionTypeForName(StringUtils::Trim(actionTypeNode.GetText().c_str()).c_str());
+      m_actionType = ActionTypeMapper::GetActionTypeForName(actionTypeNode.GetTextView().Trim().ToString().c_str());
       m_actionTypeHasBeenSet = true;
     }
     XmlNode actionDescriptionNode = resultNode.FirstChild("ActionDescription");
     if(!actionDescriptionNode.IsNull())
     {
-      m_actionDescription = StringUtils::Trim(actionDescriptionNode.GetText().c_str());
+      m_actionDescription = actionDescriptionNode.GetTextView().Trim().ToString();
       m_actionDescriptionHasBeenSet = true;
     }
     XmlNode failureTypeNode = resultNode.FirstChild("FailureType");
     if(!failureTypeNode.IsNull())
     {
-      m_failureType = FailureTypeMapper::GetFailureTypeForName(StringUtils::Trim(failureTypeNode.GetText().c_str()).c_str());
+      m_failureType = FailureTypeMapper::GetFailureTypeForName(failureTypeNode.GetTextView().Trim().ToString().c_str());
       m_failureTypeHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = ActionHistoryStatusMapper::GetActionHistoryStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = ActionHistoryStatusMapper::GetActionHistoryStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode failureDescriptionNode = resultNode.FirstChild("FailureDescription");
     if(!failureDescriptionNode.IsNull())
     {
-      m_failureDescription = StringUtils::Trim(failureDescriptionNode.GetText().c_str());
+      m_failureDescription = failureDescriptionNode.GetTextView().Trim().ToString();
       m_failureDescriptionHasBeenSet = true;
     }
     XmlNode executedTimeNode = resultNode.FirstChild("ExecutedTime");
     if(!executedTimeNode.IsNull())
     {
-      m_executedTime = DateTime(StringUtils::Trim(executedTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_executedTime = DateTime(executedTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_executedTimeHasBeenSet = true;
     }
     XmlNode finishedTimeNode = resultNode.FirstChild("FinishedTime");
     if(!finishedTimeNode.IsNull())
     {
-      m_finishedTime = DateTime(StringUtils::Trim(finishedTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_finishedTime = DateTime(finishedTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_finishedTimeHasBeenSet = true;
     }
   }
@@ -117,7 +117,7 @@ void ManagedActionHistoryItem::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_actionIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ActionId=" << StringUtils::URLEncode(m_actionId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ActionId=" << StringUtils::URLEncoded(m_actionId) << "&";
   }
 
   if(m_actionTypeHasBeenSet)
@@ -127,7 +127,7 @@ void ManagedActionHistoryItem::OutputToStream(Aws::OStream& oStream, const char*
 
   if(m_actionDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ActionDescription=" << StringUtils::URLEncode(m_actionDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".ActionDescription=" << StringUtils::URLEncoded(m_actionDescription) << "&";
   }
 
   if(m_failureTypeHasBeenSet)
@@ -142,17 +142,17 @@ void ManagedActionHistoryItem::OutputToStream(Aws::OStream& oStream, const char*
 
   if(m_failureDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".FailureDescription=" << StringUtils::URLEncode(m_failureDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".FailureDescription=" << StringUtils::URLEncoded(m_failureDescription) << "&";
   }
 
   if(m_executedTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ExecutedTime=" << StringUtils::URLEncode(m_executedTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".ExecutedTime=" << StringUtils::URLEncoded(m_executedTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_finishedTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".FinishedTime=" << StringUtils::URLEncode(m_finishedTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".FinishedTime=" << StringUtils::URLEncoded(m_finishedTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -161,7 +161,7 @@ void ManagedActionHistoryItem::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_actionIdHasBeenSet)
   {
-      oStream << location << ".ActionId=" << StringUtils::URLEncode(m_actionId.c_str()) << "&";
+      oStream << location << ".ActionId=" << StringUtils::URLEncoded(m_actionId) << "&";
   }
   if(m_actionTypeHasBeenSet)
   {
@@ -169,7 +169,7 @@ void ManagedActionHistoryItem::OutputToStream(Aws::OStream& oStream, const char*
   }
   if(m_actionDescriptionHasBeenSet)
   {
-      oStream << location << ".ActionDescription=" << StringUtils::URLEncode(m_actionDescription.c_str()) << "&";
+      oStream << location << ".ActionDescription=" << StringUtils::URLEncoded(m_actionDescription) << "&";
   }
   if(m_failureTypeHasBeenSet)
   {
@@ -181,15 +181,15 @@ void ManagedActionHistoryItem::OutputToStream(Aws::OStream& oStream, const char*
   }
   if(m_failureDescriptionHasBeenSet)
   {
-      oStream << location << ".FailureDescription=" << StringUtils::URLEncode(m_failureDescription.c_str()) << "&";
+      oStream << location << ".FailureDescription=" << StringUtils::URLEncoded(m_failureDescription) << "&";
   }
   if(m_executedTimeHasBeenSet)
   {
-      oStream << location << ".ExecutedTime=" << StringUtils::URLEncode(m_executedTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".ExecutedTime=" << StringUtils::URLEncoded(m_executedTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_finishedTimeHasBeenSet)
   {
-      oStream << location << ".FinishedTime=" << StringUtils::URLEncode(m_finishedTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".FinishedTime=" << StringUtils::URLEncoded(m_finishedTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
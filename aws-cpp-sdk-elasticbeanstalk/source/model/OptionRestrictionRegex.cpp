@@ -51,13 +51,13 @@ OptionRestrictionRegex& OptionRestrictionRegex::operator =(const XmlNode& xmlNod
     XmlNode patternNode = resultNode.FirstChild("Pattern");
     if(!patternNode.IsNull())
     {
-      m_pattern = StringUtils::Trim(patternNode.GetText().c_str());
+      m_pattern = patternNode.GetTextView().Trim().ToString();
       m_patternHasBeenSet = true;
     }
     XmlNode labelNode = resultNode.FirstChild("Label");
     if(!labelNode.IsNull())
     {
-      m_label = StringUtils::Trim(labelNode.GetText().c_str());
+      m_label = labelNode.GetTextView().Trim().ToString();
       m_labelHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void OptionRestrictionRegex::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_patternHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Pattern=" << StringUtils::URLEncode(m_pattern.c_str()) << "&";
+      oStream << location << index << locationValue << ".Pattern=" << StringUtils::URLEncoded(m_pattern) << "&";
   }
 
   if(m_labelHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Label=" << StringUtils::URLEncode(m_label.c_str()) << "&";
+      oStream << location << index << locationValue << ".Label=" << StringUtils::URLEncoded(m_label) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void OptionRestrictionRegex::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_patternHasBeenSet)
   {
-      oStream << location << ".Pattern=" << StringUtils::URLEncode(m_pattern.c_str()) << "&";
+      oStream << location << ".Pattern=" << StringUtils::URLEncoded(m_pattern) << "&";
   }
   if(m_labelHasBeenSet)
   {
-      oStream << location << ".Label=" << StringUtils::URLEncode(m_label.c_str()) << "&";
+      oStream << location << ".Label=" << StringUtils::URLEncoded(m_label) << "&";
   }
 }
 
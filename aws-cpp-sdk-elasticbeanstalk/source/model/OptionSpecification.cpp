@@ -53,19 +53,19 @@ OptionSpecification& OptionSpecification::operator =(const XmlNode& xmlNode)
     XmlNode resourceNameNode = resultNode.FirstChild("ResourceName");
     if(!resourceNameNode.IsNull())
     {
-      m_resourceName = StringUtils::Trim(resourceNameNode.GetText().c_str());
+      m_resourceName = resourceNameNode.GetTextView().Trim().ToString();
       m_resourceNameHasBeenSet = true;
     }
     XmlNode namespaceNode = resultNode.FirstChild("Namespace");
     if(!namespaceNode.IsNull())
     {
-      m_namespace = StringUtils::Trim(namespaceNode.GetText().c_str());
+      m_namespace = namespaceNode.GetTextView().Trim().ToString();
       m_namespaceHasBeenSet = true;
     }
     XmlNode optionNameNode = resultNode.FirstChild("OptionName");
     if(!optionNameNode.IsNull())
     {
-      m_optionName = StringUtils::Trim(optionNameNode.GetText().c_str());
+      m_optionName = optionNameNode.GetTextView().Trim().ToString();
       m_optionNameHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void OptionSpecification::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_resourceNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceName=" << StringUtils::URLEncode(m_resourceName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceName=" << StringUtils::URLEncoded(m_resourceName) << "&";
   }
 
   if(m_namespaceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+      oStream << location << index << locationValue << ".Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
 
   if(m_optionNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OptionName=" << StringUtils::URLEncode(m_optionName.c_str()) << "&";
+      oStream << location << index << locationValue << ".OptionName=" << StringUtils::URLEncoded(m_optionName) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void OptionSpecification::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_resourceNameHasBeenSet)
   {
-      oStream << location << ".ResourceName=" << StringUtils::URLEncode(m_resourceName.c_str()) << "&";
+      oStream << location << ".ResourceName=" << StringUtils::URLEncoded(m_resourceName) << "&";
   }
   if(m_namespaceHasBeenSet)
   {
-      oStream << location << ".Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+      oStream << location << ".Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
   if(m_optionNameHasBeenSet)
   {
-      oStream << location << ".OptionName=" << StringUtils::URLEncode(m_optionName.c_str()) << "&";
+      oStream << location << ".OptionName=" << StringUtils::URLEncoded(m_optionName) << "&";
   }
 }
 
@@ -51,13 +51,13 @@ Queue& Queue::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode uRLNode = resultNode.FirstChild("URL");
     if(!uRLNode.IsNull())
     {
-      m_uRL = StringUtils::Trim(uRLNode.GetText().c_str());
+      m_uRL = uRLNode.GetTextView().Trim().ToString();
       m_uRLHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void Queue::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_uRLHasBeenSet)
   {
-      oStream << location << index << locationValue << ".URL=" << StringUtils::URLEncode(m_uRL.c_str()) << "&";
+      oStream << location << index << locationValue << ".URL=" << StringUtils::URLEncoded(m_uRL) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void Queue::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_uRLHasBeenSet)
   {
-      oStream << location << ".URL=" << StringUtils::URLEncode(m_uRL.c_str()) << "&";
+      oStream << location << ".URL=" << StringUtils::URLEncoded(m_uRL) << "&";
   }
 }
 
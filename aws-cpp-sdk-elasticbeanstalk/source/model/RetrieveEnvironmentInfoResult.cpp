@@ -40,7 +40,7 @@ RetrieveEnvironmentInfoResult& RetrieveEnvironmentInfoResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RetrieveEnvironmentInfoResult")
+  if (rootNode.GetNameView() != "RetrieveEnvironmentInfoResult")
   {
     resultNode = rootNode.FirstChild("RetrieveEnvironmentInfoResult");
   }
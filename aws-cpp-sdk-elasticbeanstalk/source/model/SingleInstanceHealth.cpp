@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -67,19 +68,19 @@ SingleInstanceHealth& SingleInstanceHealth::operator =(const XmlNode& xmlNode)
     XmlNode instanceIdNode = resultNode.FirstChild("InstanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode healthStatusNode = resultNode.FirstChild("HealthStatus");
     if(!healthStatusNode.IsNull())
     {
-      m_healthStatus = StringUtils::Trim(healthStatusNode.GetText().c_str());
+      m_healthStatus = healthStatusNode.GetTextView().Trim().ToString();
       m_healthStatusHasBeenSet = true;
     }
     XmlNode colorNode = resultNode.FirstChild("Color");
     if(!colorNode.IsNull())
     {
-      m_color = StringUtils::Trim(colorNode.GetText().c_str());
+      m_color = colorNode.GetTextView().Trim().ToString();
       m_colorHasBeenSet = true;
     }
     XmlNode causesNode = resultNode.FirstChild("Causes");
@@ -88,7 +89,7 @@ SingleInstanceHealth& SingleInstanceHealth::operator =(const XmlNode& xmlNode)
       XmlNode causesMember = causesNode.FirstChild("member");
       while(!causesMember.IsNull())
       {
-        m_causes.push_back(StringUtils::Trim(causesMember.GetText().c_str()));
+        m_causes.push_back(causesMember.GetTextView().Trim().ToString());
         causesMember = causesMember.NextNode("member");
       }
 
@@ -97,7 +98,7 @@ SingleInstanceHealth& SingleInstanceHealth::operator =(const XmlNode& xmlNode)
     XmlNode launchedAtNode = resultNode.FirstChild("LaunchedAt");
     if(!launchedAtNode.IsNull())
     {
-      m_launchedAt = DateTime(StringUtils::Trim(launchedAtNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_launchedAt = DateTime(launchedAtNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_launchedAtHasBeenSet = true;
     }
     XmlNode applicationMetricsNode = resultNode.FirstChild("ApplicationMetrics");
@@ -121,13 +122,13 @@ SingleInstanceHealth& SingleInstanceHealth::operator =(const XmlNode& xmlNode)
     XmlNode availabilityZoneNode = resultNode.FirstChild("AvailabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode instanceTypeNode = resultNode.FirstChild("InstanceType");
     if(!instanceTypeNode.IsNull())
     {
-      m_instanceType = StringUtils::Trim(instanceTypeNode.GetText().c_str());
+      m_instanceType = instanceTypeNode.GetTextView().Trim().ToString();
       m_instanceTypeHasBeenSet = true;
     }
   }
@@ -139,17 +140,17 @@ void SingleInstanceHealth::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_healthStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HealthStatus=" << StringUtils::URLEncode(m_healthStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".HealthStatus=" << StringUtils::URLEncoded(m_healthStatus) << "&";
   }
 
   if(m_colorHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Color=" << StringUtils::URLEncode(m_color.c_str()) << "&";
+      oStream << location << index << locationValue << ".Color=" << StringUtils::URLEncoded(m_color) << "&";
   }
 
   if(m_causesHasBeenSet)
@@ -157,44 +158,44 @@ void SingleInstanceHealth::OutputToStream(Aws::OStream& oStream, const char* loc
       unsigned causesIdx = 1;
       for(auto& item : m_causes)
       {
-        oStream << location << index << locationValue << ".Causes.member." << causesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".Causes.member." << causesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
   if(m_launchedAtHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LaunchedAt=" << StringUtils::URLEncode(m_launchedAt.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".LaunchedAt=" << StringUtils::URLEncoded(m_launchedAt.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_applicationMetricsHasBeenSet)
   {
-      Aws::StringStream applicationMetricsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream applicationMetricsLocationAndMemberSs;
       applicationMetricsLocationAndMemberSs << location << index << locationValue << ".ApplicationMetrics";
-      m_applicationMetrics.OutputToStream(oStream, applicationMetricsLocationAndMemberSs.str().c_str());
+      m_applicationMetrics.OutputToStream(oStream, applicationMetricsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_systemHasBeenSet)
   {
-      Aws::StringStream systemLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream systemLocationAndMemberSs;
       systemLocationAndMemberSs << location << index << locationValue << ".System";
-      m_system.OutputToStream(oStream, systemLocationAndMemberSs.str().c_str());
+      m_system.OutputToStream(oStream, systemLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_deploymentHasBeenSet)
   {
-      Aws::StringStream deploymentLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream deploymentLocationAndMemberSs;
       deploymentLocationAndMemberSs << location << index << locationValue << ".Deployment";
-      m_deployment.OutputToStream(oStream, deploymentLocationAndMemberSs.str().c_str());
+      m_deployment.OutputToStream(oStream, deploymentLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
 
 }
@@ -203,27 +204,27 @@ void SingleInstanceHealth::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_healthStatusHasBeenSet)
   {
-      oStream << location << ".HealthStatus=" << StringUtils::URLEncode(m_healthStatus.c_str()) << "&";
+      oStream << location << ".HealthStatus=" << StringUtils::URLEncoded(m_healthStatus) << "&";
   }
   if(m_colorHasBeenSet)
   {
-      oStream << location << ".Color=" << StringUtils::URLEncode(m_color.c_str()) << "&";
+      oStream << location << ".Color=" << StringUtils::URLEncoded(m_color) << "&";
   }
   if(m_causesHasBeenSet)
   {
       unsigned causesIdx = 1;
       for(auto& item : m_causes)
       {
-        oStream << location << ".Causes.member." << causesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".Causes.member." << causesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_launchedAtHasBeenSet)
   {
-      oStream << location << ".LaunchedAt=" << StringUtils::URLEncode(m_launchedAt.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".LaunchedAt=" << StringUtils::URLEncoded(m_launchedAt.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_applicationMetricsHasBeenSet)
   {
@@ -245,11 +246,11 @@ void SingleInstanceHealth::OutputToStream(Aws::OStream& oStream, const char* loc
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_instanceTypeHasBeenSet)
   {
-      oStream << location << ".InstanceType=" << StringUtils::URLEncode(m_instanceType.c_str()) << "&";
+      oStream << location << ".InstanceType=" << StringUtils::URLEncoded(m_instanceType) << "&";
   }
 }
 
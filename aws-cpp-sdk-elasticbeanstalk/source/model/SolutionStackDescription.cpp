@@ -51,7 +51,7 @@ SolutionStackDescription& SolutionStackDescription::operator =(const XmlNode& xm
     XmlNode solutionStackNameNode = resultNode.FirstChild("SolutionStackName");
     if(!solutionStackNameNode.IsNull())
     {
-      m_solutionStackName = StringUtils::Trim(solutionStackNameNode.GetText().c_str());
+      m_solutionStackName = solutionStackNameNode.GetTextView().Trim().ToString();
       m_solutionStackNameHasBeenSet = true;
     }
     XmlNode permittedFileTypesNode = resultNode.FirstChild("PermittedFileTypes");
@@ -60,7 +60,7 @@ SolutionStackDescription& SolutionStackDescription::operator =(const XmlNode& xm
       XmlNode permittedFileTypesMember = permittedFileTypesNode.FirstChild("member");
       while(!permittedFileTypesMember.IsNull())
       {
-        m_permittedFileTypes.push_back(StringUtils::Trim(permittedFileTypesMember.GetText().c_str()));
+        m_permittedFileTypes.push_back(permittedFileTypesMember.GetTextView().Trim().ToString());
         permittedFileTypesMember = permittedFileTypesMember.NextNode("member");
       }
 
@@ -75,7 +75,7 @@ void SolutionStackDescription::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_solutionStackNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SolutionStackName=" << StringUtils::URLEncode(m_solutionStackName.c_str()) << "&";
+      oStream << location << index << locationValue << ".SolutionStackName=" << StringUtils::URLEncoded(m_solutionStackName) << "&";
   }
 
   if(m_permittedFileTypesHasBeenSet)
@@ -83,7 +83,7 @@ void SolutionStackDescription::OutputToStream(Aws::OStream& oStream, const char*
       unsigned permittedFileTypesIdx = 1;
       for(auto& item : m_permittedFileTypes)
       {
-        oStream << location << index << locationValue << ".PermittedFileTypes.member." << permittedFileTypesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".PermittedFileTypes.member." << permittedFileTypesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -93,14 +93,14 @@ void SolutionStackDescription::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_solutionStackNameHasBeenSet)
   {
-      oStream << location << ".SolutionStackName=" << StringUtils::URLEncode(m_solutionStackName.c_str()) << "&";
+      oStream << location << ".SolutionStackName=" << StringUtils::URLEncoded(m_solutionStackName) << "&";
   }
   if(m_permittedFileTypesHasBeenSet)
   {
       unsigned permittedFileTypesIdx = 1;
       for(auto& item : m_permittedFileTypes)
       {
-        oStream << location << ".PermittedFileTypes.member." << permittedFileTypesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".PermittedFileTypes.member." << permittedFileTypesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
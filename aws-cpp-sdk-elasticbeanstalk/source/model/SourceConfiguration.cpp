@@ -51,13 +51,13 @@ SourceConfiguration& SourceConfiguration::operator =(const XmlNode& xmlNode)
     XmlNode applicationNameNode = resultNode.FirstChild("ApplicationName");
     if(!applicationNameNode.IsNull())
     {
-      m_applicationName = StringUtils::Trim(applicationNameNode.GetText().c_str());
+      m_applicationName = applicationNameNode.GetTextView().Trim().ToString();
       m_applicationNameHasBeenSet = true;
     }
     XmlNode templateNameNode = resultNode.FirstChild("TemplateName");
     if(!templateNameNode.IsNull())
     {
-      m_templateName = StringUtils::Trim(templateNameNode.GetText().c_str());
+      m_templateName = templateNameNode.GetTextView().Trim().ToString();
       m_templateNameHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void SourceConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_applicationNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
 
   if(m_templateNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TemplateName=" << StringUtils::URLEncode(m_templateName.c_str()) << "&";
+      oStream << location << index << locationValue << ".TemplateName=" << StringUtils::URLEncoded(m_templateName) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void SourceConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_applicationNameHasBeenSet)
   {
-      oStream << location << ".ApplicationName=" << StringUtils::URLEncode(m_applicationName.c_str()) << "&";
+      oStream << location << ".ApplicationName=" << StringUtils::URLEncoded(m_applicationName) << "&";
   }
   if(m_templateNameHasBeenSet)
   {
-      oStream << location << ".TemplateName=" << StringUtils::URLEncode(m_templateName.c_str()) << "&";
+      oStream << location << ".TemplateName=" << StringUtils::URLEncoded(m_templateName) << "&";
   }
 }
 
@@ -15,6 +15,7 @@
 #include <aws/elasticbeanstalk/model/SwapEnvironmentCNAMEsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticBeanstalk::Model;
 using namespace Aws::Utils;
@@ -29,29 +30,29 @@ SwapEnvironmentCNAMEsRequest::SwapEnvironmentCNAMEsRequest() :
 
 Aws::String SwapEnvironmentCNAMEsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SwapEnvironmentCNAMEs&";
   if(m_sourceEnvironmentIdHasBeenSet)
   {
-    ss << "SourceEnvironmentId=" << StringUtils::URLEncode(m_sourceEnvironmentId.c_str()) << "&";
+    ss << "SourceEnvironmentId=" << StringUtils::URLEncoded(m_sourceEnvironmentId) << "&";
   }
 
   if(m_sourceEnvironmentNameHasBeenSet)
   {
-    ss << "SourceEnvironmentName=" << StringUtils::URLEncode(m_sourceEnvironmentName.c_str()) << "&";
+    ss << "SourceEnvironmentName=" << StringUtils::URLEncoded(m_sourceEnvironmentName) << "&";
   }
 
   if(m_destinationEnvironmentIdHasBeenSet)
   {
-    ss << "DestinationEnvironmentId=" << StringUtils::URLEncode(m_destinationEnvironmentId.c_str()) << "&";
+    ss << "DestinationEnvironmentId=" << StringUtils::URLEncoded(m_destinationEnvironmentId) << "&";
   }
 
   if(m_destinationEnvironmentNameHasBeenSet)
   {
-    ss << "DestinationEnvironmentName=" << StringUtils::URLEncode(m_destinationEnvironmentName.c_str()) << "&";
+    ss << "DestinationEnvironmentName=" << StringUtils::URLEncoded(m_destinationEnvironmentName) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
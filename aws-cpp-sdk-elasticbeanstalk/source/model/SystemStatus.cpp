@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -60,7 +61,7 @@ SystemStatus& SystemStatus::operator =(const XmlNode& xmlNode)
       XmlNode loadAverageMember = loadAverageNode.FirstChild("member");
       while(!loadAverageMember.IsNull())
       {
-         m_loadAverage.push_back(StringUtils::ConvertToDouble(StringUtils::Trim(loadAverageMember.GetText().c_str()).c_str()));
+         m_loadAverage.push_back(StringUtils::ConvertToDouble(loadAverageMember.GetTextView().Trim().ToString().c_str()));
         loadAverageMember = loadAverageMember.NextNode("member");
       }
 
@@ -75,9 +76,9 @@ void SystemStatus::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_cPUUtilizationHasBeenSet)
   {
-      Aws::StringStream cPUUtilizationLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream cPUUtilizationLocationAndMemberSs;
       cPUUtilizationLocationAndMemberSs << location << index << locationValue << ".CPUUtilization";
-      m_cPUUtilization.OutputToStream(oStream, cPUUtilizationLocationAndMemberSs.str().c_str());
+      m_cPUUtilization.OutputToStream(oStream, cPUUtilizationLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_loadAverageHasBeenSet)
@@ -40,7 +40,7 @@ UpdateApplicationResult& UpdateApplicationResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "UpdateApplicationResult")
+  if (rootNode.GetNameView() != "UpdateApplicationResult")
   {
     resultNode = rootNode.FirstChild("UpdateApplicationResult");
   }
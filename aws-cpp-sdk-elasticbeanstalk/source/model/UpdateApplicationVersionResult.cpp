@@ -40,7 +40,7 @@ UpdateApplicationVersionResult& UpdateApplicationVersionResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "UpdateApplicationVersionResult")
+  if (rootNode.GetNameView() != "UpdateApplicationVersionResult")
   {
     resultNode = rootNode.FirstChild("UpdateApplicationVersionResult");
   }
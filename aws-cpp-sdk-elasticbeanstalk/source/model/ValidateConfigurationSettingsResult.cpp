@@ -40,7 +40,7 @@ ValidateConfigurationSettingsResult& ValidateConfigurationSettingsResult::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ValidateConfigurationSettingsResult")
+  if (rootNode.GetNameView() != "ValidateConfigurationSettingsResult")
   {
     resultNode = rootNode.FirstChild("ValidateConfigurationSettingsResult");
   }
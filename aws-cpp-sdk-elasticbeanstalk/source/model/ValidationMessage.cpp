@@ -55,25 +55,25 @@ ValidationMessage& ValidationMessage::operator =(const XmlNode& xmlNode)
     XmlNode messageNode = resultNode.FirstChild("Message");
     if(!messageNode.IsNull())
     {
-      m_message = StringUtils::Trim(messageNode.GetText().c_str());
+      m_message = messageNode.GetTextView().Trim().ToString();
       m_messageHasBeenSet = true;
     }
     XmlNode severityNode = resultNode.FirstChild("Severity");
     if(!severityNode.IsNull())
     {
-      m_severity = ValidationSeverityMapper::GetValidationSeverityForName(StringUtils::Trim(severityNode.GetText().c_str()).c_str());
+      m_severity = ValidationSeverityMapper::GetValidationSeverityForName(severityNode.GetTextView().Trim().ToString().c_str());
       m_severityHasBeenSet = true;
     }
     XmlNode namespaceNode = resultNode.FirstChild("Namespace");
     if(!namespaceNode.IsNull())
     {
-      m_namespace = StringUtils::Trim(namespaceNode.GetText().c_str());
+      m_namespace = namespaceNode.GetTextView().Trim().ToString();
       m_namespaceHasBeenSet = true;
     }
     XmlNode optionNameNode = resultNode.FirstChild("OptionName");
     if(!optionNameNode.IsNull())
     {
-      m_optionName = StringUtils::Trim(optionNameNode.GetText().c_str());
+      m_optionName = optionNameNode.GetTextView().Trim().ToString();
       m_optionNameHasBeenSet = true;
     }
   }
@@ -85,7 +85,7 @@ void ValidationMessage::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_messageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 
   if(m_severityHasBeenSet)
@@ -95,12 +95,12 @@ void ValidationMessage::OutputToStream(Aws::OStream& oStream, const char* locati
 
   if(m_namespaceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+      oStream << location << index << locationValue << ".Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
 
   if(m_optionNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OptionName=" << StringUtils::URLEncode(m_optionName.c_str()) << "&";
+      oStream << location << index << locationValue << ".OptionName=" << StringUtils::URLEncoded(m_optionName) << "&";
   }
 
 }
@@ -109,7 +109,7 @@ void ValidationMessage::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_messageHasBeenSet)
   {
-      oStream << location << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
   if(m_severityHasBeenSet)
   {
@@ -117,11 +117,11 @@ void ValidationMessage::OutputToStream(Aws::OStream& oStream, const char* locati
   }
   if(m_namespaceHasBeenSet)
   {
-      oStream << location << ".Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+      oStream << location << ".Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
   if(m_optionNameHasBeenSet)
   {
-      oStream << location << ".OptionName=" << StringUtils::URLEncode(m_optionName.c_str()) << "&";
+      oStream << location << ".OptionName=" << StringUtils::URLEncoded(m_optionName) << "&";
   }
 }
 
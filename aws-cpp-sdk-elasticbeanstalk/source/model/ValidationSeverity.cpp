@@ -29,21 +29,29 @@ namespace Aws
       namespace ValidationSeverityMapper
       {
 
-        static const int error_HASH = HashingUtils::HashString("error");
-        static const int warning_HASH = HashingUtils::HashString("warning");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int error_HASH = 96784904;
+        static const int warning_HASH = 1124446108;
 
 
         ValidationSeverity GetValidationSeverityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == error_HASH)
+          switch (hashCode)
           {
+          case error_HASH:
             return ValidationSeverity::error;
-          }
-          else if (hashCode == warning_HASH)
-          {
+          case warning_HASH:
             return ValidationSeverity::warning;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -28,6 +28,9 @@
 #include <aws/elasticfilesystem/model/DescribeTagsResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -285,6 +288,18 @@ namespace Model
          */
         virtual void CreateFileSystemAsync(const Model::CreateFileSystemRequest& request, const CreateFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateFileSystemCallable(const Model::CreateFileSystemRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateFileSystemOutcomeCallable CreateFileSystemCallable(Model::CreateFileSystemRequest&& request) const;
+
+        /**
+         * Same as CreateFileSystemAsync(const Model::CreateFileSystemRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateFileSystemAsync(Model::CreateFileSystemRequest&& request, const CreateFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a mount target for a file system. You can then mount the file system
          * on EC2 instances via the mount target.</p> <p>You can create one mount target in
@@ -517,6 +532,18 @@ namespace Model
          */
         virtual void CreateMountTargetAsync(const Model::CreateMountTargetRequest& request, const CreateMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateMountTargetCallable(const Model::CreateMountTargetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateMountTargetOutcomeCallable CreateMountTargetCallable(Model::CreateMountTargetRequest&& request) const;
+
+        /**
+         * Same as CreateMountTargetAsync(const Model::CreateMountTargetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateMountTargetAsync(Model::CreateMountTargetRequest&& request, const CreateMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or overwrites tags associated with a file system. Each tag is a
          * key-value pair. If a tag key specified in the request already exists on the file
@@ -554,6 +581,18 @@ namespace Model
          */
         virtual void CreateTagsAsync(const Model::CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTagsCallable(const Model::CreateTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateTagsOutcomeCallable CreateTagsCallable(Model::CreateTagsRequest&& request) const;
+
+        /**
+         * Same as CreateTagsAsync(const Model::CreateTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateTagsAsync(Model::CreateTagsRequest&& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a file system, permanently severing access to its contents. Upon
          * return, the file system no longer exists and you can't access any contents of
@@ -609,6 +648,18 @@ namespace Model
          */
         virtual void DeleteFileSystemAsync(const Model::DeleteFileSystemRequest& request, const DeleteFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteFileSystemCallable(const Model::DeleteFileSystemRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteFileSystemOutcomeCallable DeleteFileSystemCallable(Model::DeleteFileSystemRequest&& request) const;
+
+        /**
+         * Same as DeleteFileSystemAsync(const Model::DeleteFileSystemRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteFileSystemAsync(Model::DeleteFileSystemRequest&& request, const DeleteFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified mount target.</p> <p>This operation forcibly breaks any
          * mounts of the file system via the mount target that is being deleted, which
@@ -679,6 +730,18 @@ namespace Model
          */
         virtual void DeleteMountTargetAsync(const Model::DeleteMountTargetRequest& request, const DeleteMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteMountTargetCallable(const Model::DeleteMountTargetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteMountTargetOutcomeCallable DeleteMountTargetCallable(Model::DeleteMountTargetRequest&& request) const;
+
+        /**
+         * Same as DeleteMountTargetAsync(const Model::DeleteMountTargetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteMountTargetAsync(Model::DeleteMountTargetRequest&& request, const DeleteMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified tags from a file system. If the <code>DeleteTags</code>
          * request includes a tag key that does not exist, Amazon EFS ignores it and
@@ -719,6 +782,18 @@ namespace Model
          */
         virtual void DeleteTagsAsync(const Model::DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTagsCallable(const Model::DeleteTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTagsOutcomeCallable DeleteTagsCallable(Model::DeleteTagsRequest&& request) const;
+
+        /**
+         * Same as DeleteTagsAsync(const Model::DeleteTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTagsAsync(Model::DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the description of a specific Amazon EFS file system if either the
          * file system <code>CreationToken</code> or the <code>FileSystemId</code> is
@@ -801,6 +876,18 @@ namespace Model
          */
         virtual void DescribeFileSystemsAsync(const Model::DescribeFileSystemsRequest& request, const DescribeFileSystemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFileSystemsCallable(const Model::DescribeFileSystemsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeFileSystemsOutcomeCallable DescribeFileSystemsCallable(Model::DescribeFileSystemsRequest&& request) const;
+
+        /**
+         * Same as DescribeFileSystemsAsync(const Model::DescribeFileSystemsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeFileSystemsAsync(Model::DescribeFileSystemsRequest&& request, const DescribeFileSystemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the security groups currently in effect for a mount target. This
          * operation requires that the network interface of the mount target has been
@@ -844,6 +931,18 @@ namespace Model
          */
         virtual void DescribeMountTargetSecurityGroupsAsync(const Model::DescribeMountTargetSecurityGroupsRequest& request, const DescribeMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeMountTargetSecurityGroupsCallable(const Model::DescribeMountTargetSecurityGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeMountTargetSecurityGroupsOutcomeCallable DescribeMountTargetSecurityGroupsCallable(Model::DescribeMountTargetSecurityGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeMountTargetSecurityGroupsAsync(const Model::DescribeMountTargetSecurityGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeMountTargetSecurityGroupsAsync(Model::DescribeMountTargetSecurityGroupsRequest&& request, const DescribeMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the descriptions of all the current mount targets, or a specific
          * mount target, for a file system. When requesting all of the current mount
@@ -881,6 +980,18 @@ namespace Model
          */
         virtual void DescribeMountTargetsAsync(const Model::DescribeMountTargetsRequest& request, const DescribeMountTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeMountTargetsCallable(const Model::DescribeMountTargetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeMountTargetsOutcomeCallable DescribeMountTargetsCallable(Model::DescribeMountTargetsRequest&& request) const;
+
+        /**
+         * Same as DescribeMountTargetsAsync(const Model::DescribeMountTargetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeMountTargetsAsync(Model::DescribeMountTargetsRequest&& request, const DescribeMountTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the tags associated with a file system. The order of tags returned in
          * the response of one <code>DescribeTags</code> call and the order of tags
@@ -912,6 +1023,18 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTagsCallable(const Model::DescribeTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(Model::DescribeTagsRequest&& request) const;
+
+        /**
+         * Same as DescribeTagsAsync(const Model::DescribeTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTagsAsync(Model::DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the set of security groups in effect for a mount target.</p> <p>When
          * you create a mount target, Amazon EFS also creates a new network interface. For
@@ -964,6 +1087,90 @@ namespace Model
          */
         virtual void ModifyMountTargetSecurityGroupsAsync(const Model::ModifyMountTargetSecurityGroupsRequest& request, const ModifyMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyMountTargetSecurityGroupsCallable(const Model::ModifyMountTargetSecurityGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyMountTargetSecurityGroupsOutcomeCallable ModifyMountTargetSecurityGroupsCallable(Model::ModifyMountTargetSecurityGroupsRequest&& request) const;
+
+        /**
+         * Same as ModifyMountTargetSecurityGroupsAsync(const Model::ModifyMountTargetSecurityGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyMountTargetSecurityGroupsAsync(Model::ModifyMountTargetSecurityGroupsRequest&& request, const ModifyMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeFileSystems(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EFSClient, Model::DescribeFileSystemsRequest, Model::DescribeFileSystemsOutcome> DescribeFileSystemsPaginator(const Model::DescribeFileSystemsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeMountTargets(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EFSClient, Model::DescribeMountTargetsRequest, Model::DescribeMountTargetsOutcome> DescribeMountTargetsPaginator(const Model::DescribeMountTargetsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeTags(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EFSClient, Model::DescribeTagsRequest, Model::DescribeTagsOutcome> DescribeTagsPaginator(const Model::DescribeTagsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CreateFileSystem(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EFSClient, Model::CreateFileSystemRequest, Model::CreateFileSystemOutcome> CreateFileSystemAwaitable(Model::CreateFileSystemRequest request) const;
+
+        /**
+         * co_await-able form of CreateMountTarget(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EFSClient, Model::CreateMountTargetRequest, Model::CreateMountTargetOutcome> CreateMountTargetAwaitable(Model::CreateMountTargetRequest request) const;
+
+        /**
+         * co_await-able form of CreateTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EFSClient, Model::CreateTagsRequest, Model::CreateTagsOutcome> CreateTagsAwaitable(Model::CreateTagsRequest request) const;
+
+        /**
+         * co_await-able form of DeleteFileSystem(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EFSClient, Model::DeleteFileSystemRequest, Model::DeleteFileSystemOutcome> DeleteFileSystemAwaitable(Model::DeleteFileSystemRequest request) const;
+
+        /**
+         * co_await-able form of DeleteMountTarget(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EFSClient, Model::DeleteMountTargetRequest, Model::DeleteMountTargetOutcome> DeleteMountTargetAwaitable(Model::DeleteMountTargetRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EFSClient, Model::DeleteTagsRequest, Model::DeleteTagsOutcome> DeleteTagsAwaitable(Model::DeleteTagsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeFileSystems(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EFSClient, Model::DescribeFileSystemsRequest, Model::DescribeFileSystemsOutcome> DescribeFileSystemsAwaitable(Model::DescribeFileSystemsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeMountTargetSecurityGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EFSClient, Model::DescribeMountTargetSecurityGroupsRequest, Model::DescribeMountTargetSecurityGroupsOutcome> DescribeMountTargetSecurityGroupsAwaitable(Model::DescribeMountTargetSecurityGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeMountTargets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EFSClient, Model::DescribeMountTargetsRequest, Model::DescribeMountTargetsOutcome> DescribeMountTargetsAwaitable(Model::DescribeMountTargetsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EFSClient, Model::DescribeTagsRequest, Model::DescribeTagsOutcome> DescribeTagsAwaitable(Model::DescribeTagsRequest request) const;
+
+        /**
+         * co_await-able form of ModifyMountTargetSecurityGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EFSClient, Model::ModifyMountTargetSecurityGroupsRequest, Model::ModifyMountTargetSecurityGroupsOutcome> ModifyMountTargetSecurityGroupsAwaitable(Model::ModifyMountTargetSecurityGroupsRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
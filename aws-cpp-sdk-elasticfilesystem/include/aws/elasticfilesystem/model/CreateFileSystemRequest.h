@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateFileSystemRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateFileSystem"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateMountTargetRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateMountTarget"; }
+
     Aws::String SerializePayload() const override;
 
     /**
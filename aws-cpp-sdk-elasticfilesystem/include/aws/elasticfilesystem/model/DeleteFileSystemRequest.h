@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteFileSystemRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteFileSystem"; }
+
     Aws::String SerializePayload() const override;
 
     /**
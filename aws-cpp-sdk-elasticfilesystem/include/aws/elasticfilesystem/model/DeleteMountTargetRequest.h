@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteMountTargetRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteMountTarget"; }
+
     Aws::String SerializePayload() const override;
 
     /**
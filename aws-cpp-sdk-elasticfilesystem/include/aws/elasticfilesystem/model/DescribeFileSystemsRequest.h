@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     DescribeFileSystemsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeFileSystems"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeMountTargetSecurityGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeMountTargetSecurityGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
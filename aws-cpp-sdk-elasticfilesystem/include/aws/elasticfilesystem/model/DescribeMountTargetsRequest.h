@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     DescribeMountTargetsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeMountTargets"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
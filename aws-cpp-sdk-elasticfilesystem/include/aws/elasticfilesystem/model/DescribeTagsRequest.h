@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     DescribeTagsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTags"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
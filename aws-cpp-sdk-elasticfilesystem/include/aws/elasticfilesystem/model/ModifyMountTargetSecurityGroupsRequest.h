@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyMountTargetSecurityGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyMountTargetSecurityGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -120,7 +120,7 @@ CreateFileSystemOutcome EFSClient::CreateFileSystem(const CreateFileSystemReques
 
 CreateFileSystemOutcomeCallable EFSClient::CreateFileSystemCallable(const CreateFileSystemRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateFileSystem(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateFileSystem(request); } );
 }
 
 void EFSClient::CreateFileSystemAsync(const CreateFileSystemRequest& request, const CreateFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -128,6 +128,16 @@ void EFSClient::CreateFileSystemAsync(const CreateFileSystemRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CreateFileSystemAsyncHelper( request, handler, context ); } );
 }
 
+CreateFileSystemOutcomeCallable EFSClient::CreateFileSystemCallable(CreateFileSystemRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EFSClient::CreateFileSystem, this, std::move(request)));
+}
+
+void EFSClient::CreateFileSystemAsync(CreateFileSystemRequest&& request, const CreateFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EFSClient::CreateFileSystemAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EFSClient::CreateFileSystemAsyncHelper(const CreateFileSystemRequest& request, const CreateFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateFileSystem(request), context);
@@ -151,7 +161,7 @@ CreateMountTargetOutcome EFSClient::CreateMountTarget(const CreateMountTargetReq
 
 CreateMountTargetOutcomeCallable EFSClient::CreateMountTargetCallable(const CreateMountTargetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateMountTarget(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateMountTarget(request); } );
 }
 
 void EFSClient::CreateMountTargetAsync(const CreateMountTargetRequest& request, const CreateMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -159,6 +169,16 @@ void EFSClient::CreateMountTargetAsync(const CreateMountTargetRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->CreateMountTargetAsyncHelper( request, handler, context ); } );
 }
 
+CreateMountTargetOutcomeCallable EFSClient::CreateMountTargetCallable(CreateMountTargetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EFSClient::CreateMountTarget, this, std::move(request)));
+}
+
+void EFSClient::CreateMountTargetAsync(CreateMountTargetRequest&& request, const CreateMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EFSClient::CreateMountTargetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EFSClient::CreateMountTargetAsyncHelper(const CreateMountTargetRequest& request, const CreateMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateMountTarget(request), context);
@@ -183,7 +203,7 @@ CreateTagsOutcome EFSClient::CreateTags(const CreateTagsRequest& request) const
 
 CreateTagsOutcomeCallable EFSClient::CreateTagsCallable(const CreateTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateTags(request); } );
 }
 
 void EFSClient::CreateTagsAsync(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -191,6 +211,16 @@ void EFSClient::CreateTagsAsync(const CreateTagsRequest& request, const CreateTa
   m_executor->Submit( [this, request, handler, context](){ this->CreateTagsAsyncHelper( request, handler, context ); } );
 }
 
+CreateTagsOutcomeCallable EFSClient::CreateTagsCallable(CreateTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EFSClient::CreateTags, this, std::move(request)));
+}
+
+void EFSClient::CreateTagsAsync(CreateTagsRequest&& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EFSClient::CreateTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EFSClient::CreateTagsAsyncHelper(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateTags(request), context);
@@ -215,7 +245,7 @@ DeleteFileSystemOutcome EFSClient::DeleteFileSystem(const DeleteFileSystemReques
 
 DeleteFileSystemOutcomeCallable EFSClient::DeleteFileSystemCallable(const DeleteFileSystemRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteFileSystem(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteFileSystem(request); } );
 }
 
 void EFSClient::DeleteFileSystemAsync(const DeleteFileSystemRequest& request, const DeleteFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -223,6 +253,16 @@ void EFSClient::DeleteFileSystemAsync(const DeleteFileSystemRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DeleteFileSystemAsyncHelper( request, handler, context ); } );
 }
 
+DeleteFileSystemOutcomeCallable EFSClient::DeleteFileSystemCallable(DeleteFileSystemRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EFSClient::DeleteFileSystem, this, std::move(request)));
+}
+
+void EFSClient::DeleteFileSystemAsync(DeleteFileSystemRequest&& request, const DeleteFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EFSClient::DeleteFileSystemAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EFSClient::DeleteFileSystemAsyncHelper(const DeleteFileSystemRequest& request, const DeleteFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteFileSystem(request), context);
@@ -247,7 +287,7 @@ DeleteMountTargetOutcome EFSClient::DeleteMountTarget(const DeleteMountTargetReq
 
 DeleteMountTargetOutcomeCallable EFSClient::DeleteMountTargetCallable(const DeleteMountTargetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteMountTarget(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteMountTarget(request); } );
 }
 
 void EFSClient::DeleteMountTargetAsync(const DeleteMountTargetRequest& request, const DeleteMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -255,6 +295,16 @@ void EFSClient::DeleteMountTargetAsync(const DeleteMountTargetRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DeleteMountTargetAsyncHelper( request, handler, context ); } );
 }
 
+DeleteMountTargetOutcomeCallable EFSClient::DeleteMountTargetCallable(DeleteMountTargetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EFSClient::DeleteMountTarget, this, std::move(request)));
+}
+
+void EFSClient::DeleteMountTargetAsync(DeleteMountTargetRequest&& request, const DeleteMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EFSClient::DeleteMountTargetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EFSClient::DeleteMountTargetAsyncHelper(const DeleteMountTargetRequest& request, const DeleteMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteMountTarget(request), context);
@@ -279,7 +329,7 @@ DeleteTagsOutcome EFSClient::DeleteTags(const DeleteTagsRequest& request) const
 
 DeleteTagsOutcomeCallable EFSClient::DeleteTagsCallable(const DeleteTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTags(request); } );
 }
 
 void EFSClient::DeleteTagsAsync(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -287,6 +337,16 @@ void EFSClient::DeleteTagsAsync(const DeleteTagsRequest& request, const DeleteTa
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTagsAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTagsOutcomeCallable EFSClient::DeleteTagsCallable(DeleteTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EFSClient::DeleteTags, this, std::move(request)));
+}
+
+void EFSClient::DeleteTagsAsync(DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EFSClient::DeleteTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EFSClient::DeleteTagsAsyncHelper(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTags(request), context);
@@ -310,7 +370,7 @@ DescribeFileSystemsOutcome EFSClient::DescribeFileSystems(const DescribeFileSyst
 
 DescribeFileSystemsOutcomeCallable EFSClient::DescribeFileSystemsCallable(const DescribeFileSystemsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeFileSystems(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeFileSystems(request); } );
 }
 
 void EFSClient::DescribeFileSystemsAsync(const DescribeFileSystemsRequest& request, const DescribeFileSystemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -318,6 +378,16 @@ void EFSClient::DescribeFileSystemsAsync(const DescribeFileSystemsRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeFileSystemsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeFileSystemsOutcomeCallable EFSClient::DescribeFileSystemsCallable(DescribeFileSystemsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EFSClient::DescribeFileSystems, this, std::move(request)));
+}
+
+void EFSClient::DescribeFileSystemsAsync(DescribeFileSystemsRequest&& request, const DescribeFileSystemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EFSClient::DescribeFileSystemsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EFSClient::DescribeFileSystemsAsyncHelper(const DescribeFileSystemsRequest& request, const DescribeFileSystemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeFileSystems(request), context);
@@ -343,7 +413,7 @@ DescribeMountTargetSecurityGroupsOutcome EFSClient::DescribeMountTargetSecurityG
 
 DescribeMountTargetSecurityGroupsOutcomeCallable EFSClient::DescribeMountTargetSecurityGroupsCallable(const DescribeMountTargetSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeMountTargetSecurityGroups(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeMountTargetSecurityGroups(request); } );
 }
 
 void EFSClient::DescribeMountTargetSecurityGroupsAsync(const DescribeMountTargetSecurityGroupsRequest& request, const DescribeMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -351,6 +421,16 @@ void EFSClient::DescribeMountTargetSecurityGroupsAsync(const DescribeMountTarget
   m_executor->Submit( [this, request, handler, context](){ this->DescribeMountTargetSecurityGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeMountTargetSecurityGroupsOutcomeCallable EFSClient::DescribeMountTargetSecurityGroupsCallable(DescribeMountTargetSecurityGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EFSClient::DescribeMountTargetSecurityGroups, this, std::move(request)));
+}
+
+void EFSClient::DescribeMountTargetSecurityGroupsAsync(DescribeMountTargetSecurityGroupsRequest&& request, const DescribeMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EFSClient::DescribeMountTargetSecurityGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EFSClient::DescribeMountTargetSecurityGroupsAsyncHelper(const DescribeMountTargetSecurityGroupsRequest& request, const DescribeMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeMountTargetSecurityGroups(request), context);
@@ -374,7 +454,7 @@ DescribeMountTargetsOutcome EFSClient::DescribeMountTargets(const DescribeMountT
 
 DescribeMountTargetsOutcomeCallable EFSClient::DescribeMountTargetsCallable(const DescribeMountTargetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeMountTargets(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeMountTargets(request); } );
 }
 
 void EFSClient::DescribeMountTargetsAsync(const DescribeMountTargetsRequest& request, const DescribeMountTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -382,6 +462,16 @@ void EFSClient::DescribeMountTargetsAsync(const DescribeMountTargetsRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DescribeMountTargetsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeMountTargetsOutcomeCallable EFSClient::DescribeMountTargetsCallable(DescribeMountTargetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EFSClient::DescribeMountTargets, this, std::move(request)));
+}
+
+void EFSClient::DescribeMountTargetsAsync(DescribeMountTargetsRequest&& request, const DescribeMountTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EFSClient::DescribeMountTargetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EFSClient::DescribeMountTargetsAsyncHelper(const DescribeMountTargetsRequest& request, const DescribeMountTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeMountTargets(request), context);
@@ -407,7 +497,7 @@ DescribeTagsOutcome EFSClient::DescribeTags(const DescribeTagsRequest& request)
 
 DescribeTagsOutcomeCallable EFSClient::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTags(request); } );
 }
 
 void EFSClient::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -415,6 +505,16 @@ void EFSClient::DescribeTagsAsync(const DescribeTagsRequest& request, const Desc
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTagsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTagsOutcomeCallable EFSClient::DescribeTagsCallable(DescribeTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EFSClient::DescribeTags, this, std::move(request)));
+}
+
+void EFSClient::DescribeTagsAsync(DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EFSClient::DescribeTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EFSClient::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTags(request), context);
@@ -440,7 +540,7 @@ ModifyMountTargetSecurityGroupsOutcome EFSClient::ModifyMountTargetSecurityGroup
 
 ModifyMountTargetSecurityGroupsOutcomeCallable EFSClient::ModifyMountTargetSecurityGroupsCallable(const ModifyMountTargetSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyMountTargetSecurityGroups(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyMountTargetSecurityGroups(request); } );
 }
 
 void EFSClient::ModifyMountTargetSecurityGroupsAsync(const ModifyMountTargetSecurityGroupsRequest& request, const ModifyMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -448,8 +548,126 @@ void EFSClient::ModifyMountTargetSecurityGroupsAsync(const ModifyMountTargetSecu
   m_executor->Submit( [this, request, handler, context](){ this->ModifyMountTargetSecurityGroupsAsyncHelper( request, handler, context ); } );
 }
 
+ModifyMountTargetSecurityGroupsOutcomeCallable EFSClient::ModifyMountTargetSecurityGroupsCallable(ModifyMountTargetSecurityGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EFSClient::ModifyMountTargetSecurityGroups, this, std::move(request)));
+}
+
+void EFSClient::ModifyMountTargetSecurityGroupsAsync(ModifyMountTargetSecurityGroupsRequest&& request, const ModifyMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EFSClient::ModifyMountTargetSecurityGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EFSClient::ModifyMountTargetSecurityGroupsAsyncHelper(const ModifyMountTargetSecurityGroupsRequest& request, const ModifyMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyMountTargetSecurityGroups(request), context);
 }
 
+Paginator<EFSClient, DescribeFileSystemsRequest, DescribeFileSystemsOutcome> EFSClient::DescribeFileSystemsPaginator(const DescribeFileSystemsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EFSClient, DescribeFileSystemsRequest, DescribeFileSystemsOutcome>(this, &EFSClient::DescribeFileSystems, request,
+    [](const DescribeFileSystemsRequest& current, const DescribeFileSystemsOutcome& outcome, DescribeFileSystemsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EFSClient, DescribeMountTargetsRequest, DescribeMountTargetsOutcome> EFSClient::DescribeMountTargetsPaginator(const DescribeMountTargetsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EFSClient, DescribeMountTargetsRequest, DescribeMountTargetsOutcome>(this, &EFSClient::DescribeMountTargets, request,
+    [](const DescribeMountTargetsRequest& current, const DescribeMountTargetsOutcome& outcome, DescribeMountTargetsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EFSClient, DescribeTagsRequest, DescribeTagsOutcome> EFSClient::DescribeTagsPaginator(const DescribeTagsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EFSClient, DescribeTagsRequest, DescribeTagsOutcome>(this, &EFSClient::DescribeTags, request,
+    [](const DescribeTagsRequest& current, const DescribeTagsOutcome& outcome, DescribeTagsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<EFSClient, CreateFileSystemRequest, CreateFileSystemOutcome> EFSClient::CreateFileSystemAwaitable(CreateFileSystemRequest request) const
+{
+  return { m_executor.get(), { this, &EFSClient::CreateFileSystem, std::move(request) } };
+}
+
+ClientOperationAwaitable<EFSClient, CreateMountTargetRequest, CreateMountTargetOutcome> EFSClient::CreateMountTargetAwaitable(CreateMountTargetRequest request) const
+{
+  return { m_executor.get(), { this, &EFSClient::CreateMountTarget, std::move(request) } };
+}
+
+ClientOperationAwaitable<EFSClient, CreateTagsRequest, CreateTagsOutcome> EFSClient::CreateTagsAwaitable(CreateTagsRequest request) const
+{
+  return { m_executor.get(), { this, &EFSClient::CreateTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<EFSClient, DeleteFileSystemRequest, DeleteFileSystemOutcome> EFSClient::DeleteFileSystemAwaitable(DeleteFileSystemRequest request) const
+{
+  return { m_executor.get(), { this, &EFSClient::DeleteFileSystem, std::move(request) } };
+}
+
+ClientOperationAwaitable<EFSClient, DeleteMountTargetRequest, DeleteMountTargetOutcome> EFSClient::DeleteMountTargetAwaitable(DeleteMountTargetRequest request) const
+{
+  return { m_executor.get(), { this, &EFSClient::DeleteMountTarget, std::move(request) } };
+}
+
+ClientOperationAwaitable<EFSClient, DeleteTagsRequest, DeleteTagsOutcome> EFSClient::DeleteTagsAwaitable(DeleteTagsRequest request) const
+{
+  return { m_executor.get(), { this, &EFSClient::DeleteTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<EFSClient, DescribeFileSystemsRequest, DescribeFileSystemsOutcome> EFSClient::DescribeFileSystemsAwaitable(DescribeFileSystemsRequest request) const
+{
+  return { m_executor.get(), { this, &EFSClient::DescribeFileSystems, std::move(request) } };
+}
+
+ClientOperationAwaitable<EFSClient, DescribeMountTargetSecurityGroupsRequest, DescribeMountTargetSecurityGroupsOutcome> EFSClient::DescribeMountTargetSecurityGroupsAwaitable(DescribeMountTargetSecurityGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &EFSClient::DescribeMountTargetSecurityGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<EFSClient, DescribeMountTargetsRequest, DescribeMountTargetsOutcome> EFSClient::DescribeMountTargetsAwaitable(DescribeMountTargetsRequest request) const
+{
+  return { m_executor.get(), { this, &EFSClient::DescribeMountTargets, std::move(request) } };
+}
+
+ClientOperationAwaitable<EFSClient, DescribeTagsRequest, DescribeTagsOutcome> EFSClient::DescribeTagsAwaitable(DescribeTagsRequest request) const
+{
+  return { m_executor.get(), { this, &EFSClient::DescribeTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<EFSClient, ModifyMountTargetSecurityGroupsRequest, ModifyMountTargetSecurityGroupsOutcome> EFSClient::ModifyMountTargetSecurityGroupsAwaitable(ModifyMountTargetSecurityGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &EFSClient::ModifyMountTargetSecurityGroups, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
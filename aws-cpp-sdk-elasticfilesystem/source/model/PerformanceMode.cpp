@@ -29,21 +29,29 @@ namespace Aws
       namespace PerformanceModeMapper
       {
 
-        static const int generalPurpose_HASH = HashingUtils::HashString("generalPurpose");
-        static const int maxIO_HASH = HashingUtils::HashString("maxIO");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int generalPurpose_HASH = 640890646;
+        static const int maxIO_HASH = 103671178;
 
 
         PerformanceMode GetPerformanceModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == generalPurpose_HASH)
+          switch (hashCode)
           {
+          case generalPurpose_HASH:
             return PerformanceMode::generalPurpose;
-          }
-          else if (hashCode == maxIO_HASH)
-          {
+          case maxIO_HASH:
             return PerformanceMode::maxIO;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -49,6 +49,9 @@
 #include <aws/elasticloadbalancing/model/SetLoadBalancerPoliciesForBackendServerResult.h>
 #include <aws/elasticloadbalancing/model/SetLoadBalancerPoliciesOfListenerResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -297,6 +300,18 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsCallable(const Model::AddTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsOutcomeCallable AddTagsCallable(Model::AddTagsRequest&& request) const;
+
+        /**
+         * Same as AddTagsAsync(const Model::AddTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsAsync(Model::AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates one or more security groups with your load balancer in a virtual
          * private cloud (VPC). The specified security groups override the previously
@@ -331,6 +346,18 @@ namespace Model
          */
         virtual void ApplySecurityGroupsToLoadBalancerAsync(const Model::ApplySecurityGroupsToLoadBalancerRequest& request, const ApplySecurityGroupsToLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ApplySecurityGroupsToLoadBalancerCallable(const Model::ApplySecurityGroupsToLoadBalancerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ApplySecurityGroupsToLoadBalancerOutcomeCallable ApplySecurityGroupsToLoadBalancerCallable(Model::ApplySecurityGroupsToLoadBalancerRequest&& request) const;
+
+        /**
+         * Same as ApplySecurityGroupsToLoadBalancerAsync(const Model::ApplySecurityGroupsToLoadBalancerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ApplySecurityGroupsToLoadBalancerAsync(Model::ApplySecurityGroupsToLoadBalancerRequest&& request, const ApplySecurityGroupsToLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds one or more subnets to the set of configured subnets for the specified
          * load balancer.</p> <p>The load balancer evenly distributes requests across all
@@ -365,6 +392,18 @@ namespace Model
          */
         virtual void AttachLoadBalancerToSubnetsAsync(const Model::AttachLoadBalancerToSubnetsRequest& request, const AttachLoadBalancerToSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachLoadBalancerToSubnetsCallable(const Model::AttachLoadBalancerToSubnetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachLoadBalancerToSubnetsOutcomeCallable AttachLoadBalancerToSubnetsCallable(Model::AttachLoadBalancerToSubnetsRequest&& request) const;
+
+        /**
+         * Same as AttachLoadBalancerToSubnetsAsync(const Model::AttachLoadBalancerToSubnetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachLoadBalancerToSubnetsAsync(Model::AttachLoadBalancerToSubnetsRequest&& request, const AttachLoadBalancerToSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Specifies the health check settings to use when evaluating the health state
          * of your EC2 instances.</p> <p>For more information, see <a
@@ -396,6 +435,18 @@ namespace Model
          */
         virtual void ConfigureHealthCheckAsync(const Model::ConfigureHealthCheckRequest& request, const ConfigureHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConfigureHealthCheckCallable(const Model::ConfigureHealthCheckRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ConfigureHealthCheckOutcomeCallable ConfigureHealthCheckCallable(Model::ConfigureHealthCheckRequest&& request) const;
+
+        /**
+         * Same as ConfigureHealthCheckAsync(const Model::ConfigureHealthCheckRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ConfigureHealthCheckAsync(Model::ConfigureHealthCheckRequest&& request, const ConfigureHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates a stickiness policy with sticky session lifetimes that follow that
          * of an application-generated cookie. This policy can be associated only with
@@ -448,6 +499,18 @@ namespace Model
          */
         virtual void CreateAppCookieStickinessPolicyAsync(const Model::CreateAppCookieStickinessPolicyRequest& request, const CreateAppCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAppCookieStickinessPolicyCallable(const Model::CreateAppCookieStickinessPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateAppCookieStickinessPolicyOutcomeCallable CreateAppCookieStickinessPolicyCallable(Model::CreateAppCookieStickinessPolicyRequest&& request) const;
+
+        /**
+         * Same as CreateAppCookieStickinessPolicyAsync(const Model::CreateAppCookieStickinessPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateAppCookieStickinessPolicyAsync(Model::CreateAppCookieStickinessPolicyRequest&& request, const CreateAppCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates a stickiness policy with sticky session lifetimes controlled by the
          * lifetime of the browser (user-agent) or a specified expiration period. This
@@ -506,6 +569,18 @@ namespace Model
          */
         virtual void CreateLBCookieStickinessPolicyAsync(const Model::CreateLBCookieStickinessPolicyRequest& request, const CreateLBCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLBCookieStickinessPolicyCallable(const Model::CreateLBCookieStickinessPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateLBCookieStickinessPolicyOutcomeCallable CreateLBCookieStickinessPolicyCallable(Model::CreateLBCookieStickinessPolicyRequest&& request) const;
+
+        /**
+         * Same as CreateLBCookieStickinessPolicyAsync(const Model::CreateLBCookieStickinessPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateLBCookieStickinessPolicyAsync(Model::CreateLBCookieStickinessPolicyRequest&& request, const CreateLBCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a Classic load balancer.</p> <p>You can add listeners, security
          * groups, subnets, and tags when you create your load balancer, or you can add
@@ -558,6 +633,18 @@ namespace Model
          */
         virtual void CreateLoadBalancerAsync(const Model::CreateLoadBalancerRequest& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLoadBalancerCallable(const Model::CreateLoadBalancerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateLoadBalancerOutcomeCallable CreateLoadBalancerCallable(Model::CreateLoadBalancerRequest&& request) const;
+
+        /**
+         * Same as CreateLoadBalancerAsync(const Model::CreateLoadBalancerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateLoadBalancerAsync(Model::CreateLoadBalancerRequest&& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates one or more listeners for the specified load balancer. If a listener
          * with the specified port does not already exist, it is created; otherwise, the
@@ -595,6 +682,18 @@ namespace Model
          */
         virtual void CreateLoadBalancerListenersAsync(const Model::CreateLoadBalancerListenersRequest& request, const CreateLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLoadBalancerListenersCallable(const Model::CreateLoadBalancerListenersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateLoadBalancerListenersOutcomeCallable CreateLoadBalancerListenersCallable(Model::CreateLoadBalancerListenersRequest&& request) const;
+
+        /**
+         * Same as CreateLoadBalancerListenersAsync(const Model::CreateLoadBalancerListenersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateLoadBalancerListenersAsync(Model::CreateLoadBalancerListenersRequest&& request, const CreateLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a policy with the specified attributes for the specified load
          * balancer.</p> <p>Policies are settings that are saved for your load balancer and
@@ -623,6 +722,18 @@ namespace Model
          */
         virtual void CreateLoadBalancerPolicyAsync(const Model::CreateLoadBalancerPolicyRequest& request, const CreateLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLoadBalancerPolicyCallable(const Model::CreateLoadBalancerPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateLoadBalancerPolicyOutcomeCallable CreateLoadBalancerPolicyCallable(Model::CreateLoadBalancerPolicyRequest&& request) const;
+
+        /**
+         * Same as CreateLoadBalancerPolicyAsync(const Model::CreateLoadBalancerPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateLoadBalancerPolicyAsync(Model::CreateLoadBalancerPolicyRequest&& request, const CreateLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified load balancer.</p> <p>If you are attempting to recreate
          * a load balancer, you must reconfigure all settings. The DNS name associated with
@@ -660,6 +771,18 @@ namespace Model
          */
         virtual void DeleteLoadBalancerAsync(const Model::DeleteLoadBalancerRequest& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLoadBalancerCallable(const Model::DeleteLoadBalancerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteLoadBalancerOutcomeCallable DeleteLoadBalancerCallable(Model::DeleteLoadBalancerRequest&& request) const;
+
+        /**
+         * Same as DeleteLoadBalancerAsync(const Model::DeleteLoadBalancerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteLoadBalancerAsync(Model::DeleteLoadBalancerRequest&& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified listeners from the specified load balancer.</p>
          */
@@ -679,6 +802,18 @@ namespace Model
          */
         virtual void DeleteLoadBalancerListenersAsync(const Model::DeleteLoadBalancerListenersRequest& request, const DeleteLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLoadBalancerListenersCallable(const Model::DeleteLoadBalancerListenersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteLoadBalancerListenersOutcomeCallable DeleteLoadBalancerListenersCallable(Model::DeleteLoadBalancerListenersRequest&& request) const;
+
+        /**
+         * Same as DeleteLoadBalancerListenersAsync(const Model::DeleteLoadBalancerListenersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteLoadBalancerListenersAsync(Model::DeleteLoadBalancerListenersRequest&& request, const DeleteLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified policy from the specified load balancer. This policy
          * must not be enabled for any listeners.</p>
@@ -701,6 +836,18 @@ namespace Model
          */
         virtual void DeleteLoadBalancerPolicyAsync(const Model::DeleteLoadBalancerPolicyRequest& request, const DeleteLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLoadBalancerPolicyCallable(const Model::DeleteLoadBalancerPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteLoadBalancerPolicyOutcomeCallable DeleteLoadBalancerPolicyCallable(Model::DeleteLoadBalancerPolicyRequest&& request) const;
+
+        /**
+         * Same as DeleteLoadBalancerPolicyAsync(const Model::DeleteLoadBalancerPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteLoadBalancerPolicyAsync(Model::DeleteLoadBalancerPolicyRequest&& request, const DeleteLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters the specified instances from the specified load balancer. After
          * the instance is deregistered, it no longer receives traffic from the load
@@ -738,6 +885,18 @@ namespace Model
          */
         virtual void DeregisterInstancesFromLoadBalancerAsync(const Model::DeregisterInstancesFromLoadBalancerRequest& request, const DeregisterInstancesFromLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterInstancesFromLoadBalancerCallable(const Model::DeregisterInstancesFromLoadBalancerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeregisterInstancesFromLoadBalancerOutcomeCallable DeregisterInstancesFromLoadBalancerCallable(Model::DeregisterInstancesFromLoadBalancerRequest&& request) const;
+
+        /**
+         * Same as DeregisterInstancesFromLoadBalancerAsync(const Model::DeregisterInstancesFromLoadBalancerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeregisterInstancesFromLoadBalancerAsync(Model::DeregisterInstancesFromLoadBalancerRequest&& request, const DeregisterInstancesFromLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the state of the specified instances with respect to the specified
          * load balancer. If no instances are specified, the call describes the state of
@@ -769,6 +928,18 @@ namespace Model
          */
         virtual void DescribeInstanceHealthAsync(const Model::DescribeInstanceHealthRequest& request, const DescribeInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInstanceHealthCallable(const Model::DescribeInstanceHealthRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeInstanceHealthOutcomeCallable DescribeInstanceHealthCallable(Model::DescribeInstanceHealthRequest&& request) const;
+
+        /**
+         * Same as DescribeInstanceHealthAsync(const Model::DescribeInstanceHealthRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeInstanceHealthAsync(Model::DescribeInstanceHealthRequest&& request, const DescribeInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the attributes for the specified load balancer.</p>
          */
@@ -788,6 +959,18 @@ namespace Model
          */
         virtual void DescribeLoadBalancerAttributesAsync(const Model::DescribeLoadBalancerAttributesRequest& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoadBalancerAttributesCallable(const Model::DescribeLoadBalancerAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLoadBalancerAttributesOutcomeCallable DescribeLoadBalancerAttributesCallable(Model::DescribeLoadBalancerAttributesRequest&& request) const;
+
+        /**
+         * Same as DescribeLoadBalancerAttributesAsync(const Model::DescribeLoadBalancerAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLoadBalancerAttributesAsync(Model::DescribeLoadBalancerAttributesRequest&& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified policies.</p> <p>If you specify a load balancer name,
          * the action returns the descriptions of all policies created for the load
@@ -825,6 +1008,18 @@ namespace Model
          */
         virtual void DescribeLoadBalancerPoliciesAsync(const Model::DescribeLoadBalancerPoliciesRequest& request, const DescribeLoadBalancerPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoadBalancerPoliciesCallable(const Model::DescribeLoadBalancerPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLoadBalancerPoliciesOutcomeCallable DescribeLoadBalancerPoliciesCallable(Model::DescribeLoadBalancerPoliciesRequest&& request) const;
+
+        /**
+         * Same as DescribeLoadBalancerPoliciesAsync(const Model::DescribeLoadBalancerPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLoadBalancerPoliciesAsync(Model::DescribeLoadBalancerPoliciesRequest&& request, const DescribeLoadBalancerPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified load balancer policy types or all load balancer
          * policy types.</p> <p>The description of each type indicates how it can be used.
@@ -865,6 +1060,18 @@ namespace Model
          */
         virtual void DescribeLoadBalancerPolicyTypesAsync(const Model::DescribeLoadBalancerPolicyTypesRequest& request, const DescribeLoadBalancerPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoadBalancerPolicyTypesCallable(const Model::DescribeLoadBalancerPolicyTypesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLoadBalancerPolicyTypesOutcomeCallable DescribeLoadBalancerPolicyTypesCallable(Model::DescribeLoadBalancerPolicyTypesRequest&& request) const;
+
+        /**
+         * Same as DescribeLoadBalancerPolicyTypesAsync(const Model::DescribeLoadBalancerPolicyTypesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLoadBalancerPolicyTypesAsync(Model::DescribeLoadBalancerPolicyTypesRequest&& request, const DescribeLoadBalancerPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified the load balancers. If no load balancers are
          * specified, the call describes all of your load balancers.</p>
@@ -887,6 +1094,18 @@ namespace Model
          */
         virtual void DescribeLoadBalancersAsync(const Model::DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoadBalancersCallable(const Model::DescribeLoadBalancersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLoadBalancersOutcomeCallable DescribeLoadBalancersCallable(Model::DescribeLoadBalancersRequest&& request) const;
+
+        /**
+         * Same as DescribeLoadBalancersAsync(const Model::DescribeLoadBalancersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLoadBalancersAsync(Model::DescribeLoadBalancersRequest&& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the tags associated with the specified load balancers.</p>
          */
@@ -906,6 +1125,18 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTagsCallable(const Model::DescribeTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(Model::DescribeTagsRequest&& request) const;
+
+        /**
+         * Same as DescribeTagsAsync(const Model::DescribeTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTagsAsync(Model::DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified subnets from the set of configured subnets for the load
          * balancer.</p> <p>After a subnet is removed, all EC2 instances registered with
@@ -937,6 +1168,18 @@ namespace Model
          */
         virtual void DetachLoadBalancerFromSubnetsAsync(const Model::DetachLoadBalancerFromSubnetsRequest& request, const DetachLoadBalancerFromSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachLoadBalancerFromSubnetsCallable(const Model::DetachLoadBalancerFromSubnetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachLoadBalancerFromSubnetsOutcomeCallable DetachLoadBalancerFromSubnetsCallable(Model::DetachLoadBalancerFromSubnetsRequest&& request) const;
+
+        /**
+         * Same as DetachLoadBalancerFromSubnetsAsync(const Model::DetachLoadBalancerFromSubnetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachLoadBalancerFromSubnetsAsync(Model::DetachLoadBalancerFromSubnetsRequest&& request, const DetachLoadBalancerFromSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified Availability Zones from the set of Availability Zones
          * for the specified load balancer.</p> <p>There must be at least one Availability
@@ -980,6 +1223,18 @@ namespace Model
          */
         virtual void DisableAvailabilityZonesForLoadBalancerAsync(const Model::DisableAvailabilityZonesForLoadBalancerRequest& request, const DisableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableAvailabilityZonesForLoadBalancerCallable(const Model::DisableAvailabilityZonesForLoadBalancerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableAvailabilityZonesForLoadBalancerOutcomeCallable DisableAvailabilityZonesForLoadBalancerCallable(Model::DisableAvailabilityZonesForLoadBalancerRequest&& request) const;
+
+        /**
+         * Same as DisableAvailabilityZonesForLoadBalancerAsync(const Model::DisableAvailabilityZonesForLoadBalancerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableAvailabilityZonesForLoadBalancerAsync(Model::DisableAvailabilityZonesForLoadBalancerRequest&& request, const DisableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds the specified Availability Zones to the set of Availability Zones for
          * the specified load balancer.</p> <p>The load balancer evenly distributes
@@ -1014,6 +1269,18 @@ namespace Model
          */
         virtual void EnableAvailabilityZonesForLoadBalancerAsync(const Model::EnableAvailabilityZonesForLoadBalancerRequest& request, const EnableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableAvailabilityZonesForLoadBalancerCallable(const Model::EnableAvailabilityZonesForLoadBalancerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableAvailabilityZonesForLoadBalancerOutcomeCallable EnableAvailabilityZonesForLoadBalancerCallable(Model::EnableAvailabilityZonesForLoadBalancerRequest&& request) const;
+
+        /**
+         * Same as EnableAvailabilityZonesForLoadBalancerAsync(const Model::EnableAvailabilityZonesForLoadBalancerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableAvailabilityZonesForLoadBalancerAsync(Model::EnableAvailabilityZonesForLoadBalancerRequest&& request, const EnableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the attributes of the specified load balancer.</p> <p>You can modify
          * the load balancer attributes, such as <code>AccessLogs</code>,
@@ -1075,6 +1342,18 @@ namespace Model
          */
         virtual void ModifyLoadBalancerAttributesAsync(const Model::ModifyLoadBalancerAttributesRequest& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyLoadBalancerAttributesCallable(const Model::ModifyLoadBalancerAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyLoadBalancerAttributesOutcomeCallable ModifyLoadBalancerAttributesCallable(Model::ModifyLoadBalancerAttributesRequest&& request) const;
+
+        /**
+         * Same as ModifyLoadBalancerAttributesAsync(const Model::ModifyLoadBalancerAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyLoadBalancerAttributesAsync(Model::ModifyLoadBalancerAttributesRequest&& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds the specified instances to the specified load balancer.</p> <p>The
          * instance must be a running instance in the same network as the load balancer
@@ -1148,6 +1427,18 @@ namespace Model
          */
         virtual void RegisterInstancesWithLoadBalancerAsync(const Model::RegisterInstancesWithLoadBalancerRequest& request, const RegisterInstancesWithLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterInstancesWithLoadBalancerCallable(const Model::RegisterInstancesWithLoadBalancerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterInstancesWithLoadBalancerOutcomeCallable RegisterInstancesWithLoadBalancerCallable(Model::RegisterInstancesWithLoadBalancerRequest&& request) const;
+
+        /**
+         * Same as RegisterInstancesWithLoadBalancerAsync(const Model::RegisterInstancesWithLoadBalancerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterInstancesWithLoadBalancerAsync(Model::RegisterInstancesWithLoadBalancerRequest&& request, const RegisterInstancesWithLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes one or more tags from the specified load balancer.</p>
          */
@@ -1167,6 +1458,18 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsCallable(const Model::RemoveTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(Model::RemoveTagsRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsAsync(const Model::RemoveTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsAsync(Model::RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the certificate that terminates the specified listener's SSL
          * connections. The specified certificate replaces any prior certificate that was
@@ -1204,6 +1507,18 @@ namespace Model
          */
         virtual void SetLoadBalancerListenerSSLCertificateAsync(const Model::SetLoadBalancerListenerSSLCertificateRequest& request, const SetLoadBalancerListenerSSLCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetLoadBalancerListenerSSLCertificateCallable(const Model::SetLoadBalancerListenerSSLCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetLoadBalancerListenerSSLCertificateOutcomeCallable SetLoadBalancerListenerSSLCertificateCallable(Model::SetLoadBalancerListenerSSLCertificateRequest&& request) const;
+
+        /**
+         * Same as SetLoadBalancerListenerSSLCertificateAsync(const Model::SetLoadBalancerListenerSSLCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetLoadBalancerListenerSSLCertificateAsync(Model::SetLoadBalancerListenerSSLCertificateRequest&& request, const SetLoadBalancerListenerSSLCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Replaces the set of policies associated with the specified port on which the
          * EC2 instance is listening with a new set of policies. At this time, only the
@@ -1265,6 +1580,18 @@ namespace Model
          */
         virtual void SetLoadBalancerPoliciesForBackendServerAsync(const Model::SetLoadBalancerPoliciesForBackendServerRequest& request, const SetLoadBalancerPoliciesForBackendServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetLoadBalancerPoliciesForBackendServerCallable(const Model::SetLoadBalancerPoliciesForBackendServerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetLoadBalancerPoliciesForBackendServerOutcomeCallable SetLoadBalancerPoliciesForBackendServerCallable(Model::SetLoadBalancerPoliciesForBackendServerRequest&& request) const;
+
+        /**
+         * Same as SetLoadBalancerPoliciesForBackendServerAsync(const Model::SetLoadBalancerPoliciesForBackendServerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetLoadBalancerPoliciesForBackendServerAsync(Model::SetLoadBalancerPoliciesForBackendServerRequest&& request, const SetLoadBalancerPoliciesForBackendServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Replaces the current set of policies for the specified load balancer port
          * with the specified set of policies.</p> <p>To enable back-end server
@@ -1311,6 +1638,165 @@ namespace Model
          */
         virtual void SetLoadBalancerPoliciesOfListenerAsync(const Model::SetLoadBalancerPoliciesOfListenerRequest& request, const SetLoadBalancerPoliciesOfListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetLoadBalancerPoliciesOfListenerCallable(const Model::SetLoadBalancerPoliciesOfListenerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetLoadBalancerPoliciesOfListenerOutcomeCallable SetLoadBalancerPoliciesOfListenerCallable(Model::SetLoadBalancerPoliciesOfListenerRequest&& request) const;
+
+        /**
+         * Same as SetLoadBalancerPoliciesOfListenerAsync(const Model::SetLoadBalancerPoliciesOfListenerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetLoadBalancerPoliciesOfListenerAsync(Model::SetLoadBalancerPoliciesOfListenerRequest&& request, const SetLoadBalancerPoliciesOfListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeLoadBalancers(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElasticLoadBalancingClient, Model::DescribeLoadBalancersRequest, Model::DescribeLoadBalancersOutcome> DescribeLoadBalancersPaginator(const Model::DescribeLoadBalancersRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::AddTagsRequest, Model::AddTagsOutcome> AddTagsAwaitable(Model::AddTagsRequest request) const;
+
+        /**
+         * co_await-able form of ApplySecurityGroupsToLoadBalancer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::ApplySecurityGroupsToLoadBalancerRequest, Model::ApplySecurityGroupsToLoadBalancerOutcome> ApplySecurityGroupsToLoadBalancerAwaitable(Model::ApplySecurityGroupsToLoadBalancerRequest request) const;
+
+        /**
+         * co_await-able form of AttachLoadBalancerToSubnets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::AttachLoadBalancerToSubnetsRequest, Model::AttachLoadBalancerToSubnetsOutcome> AttachLoadBalancerToSubnetsAwaitable(Model::AttachLoadBalancerToSubnetsRequest request) const;
+
+        /**
+         * co_await-able form of ConfigureHealthCheck(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::ConfigureHealthCheckRequest, Model::ConfigureHealthCheckOutcome> ConfigureHealthCheckAwaitable(Model::ConfigureHealthCheckRequest request) const;
+
+        /**
+         * co_await-able form of CreateAppCookieStickinessPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::CreateAppCookieStickinessPolicyRequest, Model::CreateAppCookieStickinessPolicyOutcome> CreateAppCookieStickinessPolicyAwaitable(Model::CreateAppCookieStickinessPolicyRequest request) const;
+
+        /**
+         * co_await-able form of CreateLBCookieStickinessPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::CreateLBCookieStickinessPolicyRequest, Model::CreateLBCookieStickinessPolicyOutcome> CreateLBCookieStickinessPolicyAwaitable(Model::CreateLBCookieStickinessPolicyRequest request) const;
+
+        /**
+         * co_await-able form of CreateLoadBalancer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::CreateLoadBalancerRequest, Model::CreateLoadBalancerOutcome> CreateLoadBalancerAwaitable(Model::CreateLoadBalancerRequest request) const;
+
+        /**
+         * co_await-able form of CreateLoadBalancerListeners(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::CreateLoadBalancerListenersRequest, Model::CreateLoadBalancerListenersOutcome> CreateLoadBalancerListenersAwaitable(Model::CreateLoadBalancerListenersRequest request) const;
+
+        /**
+         * co_await-able form of CreateLoadBalancerPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::CreateLoadBalancerPolicyRequest, Model::CreateLoadBalancerPolicyOutcome> CreateLoadBalancerPolicyAwaitable(Model::CreateLoadBalancerPolicyRequest request) const;
+
+        /**
+         * co_await-able form of DeleteLoadBalancer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::DeleteLoadBalancerRequest, Model::DeleteLoadBalancerOutcome> DeleteLoadBalancerAwaitable(Model::DeleteLoadBalancerRequest request) const;
+
+        /**
+         * co_await-able form of DeleteLoadBalancerListeners(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::DeleteLoadBalancerListenersRequest, Model::DeleteLoadBalancerListenersOutcome> DeleteLoadBalancerListenersAwaitable(Model::DeleteLoadBalancerListenersRequest request) const;
+
+        /**
+         * co_await-able form of DeleteLoadBalancerPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::DeleteLoadBalancerPolicyRequest, Model::DeleteLoadBalancerPolicyOutcome> DeleteLoadBalancerPolicyAwaitable(Model::DeleteLoadBalancerPolicyRequest request) const;
+
+        /**
+         * co_await-able form of DeregisterInstancesFromLoadBalancer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::DeregisterInstancesFromLoadBalancerRequest, Model::DeregisterInstancesFromLoadBalancerOutcome> DeregisterInstancesFromLoadBalancerAwaitable(Model::DeregisterInstancesFromLoadBalancerRequest request) const;
+
+        /**
+         * co_await-able form of DescribeInstanceHealth(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::DescribeInstanceHealthRequest, Model::DescribeInstanceHealthOutcome> DescribeInstanceHealthAwaitable(Model::DescribeInstanceHealthRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLoadBalancerAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::DescribeLoadBalancerAttributesRequest, Model::DescribeLoadBalancerAttributesOutcome> DescribeLoadBalancerAttributesAwaitable(Model::DescribeLoadBalancerAttributesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLoadBalancerPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::DescribeLoadBalancerPoliciesRequest, Model::DescribeLoadBalancerPoliciesOutcome> DescribeLoadBalancerPoliciesAwaitable(Model::DescribeLoadBalancerPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLoadBalancerPolicyTypes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::DescribeLoadBalancerPolicyTypesRequest, Model::DescribeLoadBalancerPolicyTypesOutcome> DescribeLoadBalancerPolicyTypesAwaitable(Model::DescribeLoadBalancerPolicyTypesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLoadBalancers(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::DescribeLoadBalancersRequest, Model::DescribeLoadBalancersOutcome> DescribeLoadBalancersAwaitable(Model::DescribeLoadBalancersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::DescribeTagsRequest, Model::DescribeTagsOutcome> DescribeTagsAwaitable(Model::DescribeTagsRequest request) const;
+
+        /**
+         * co_await-able form of DetachLoadBalancerFromSubnets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::DetachLoadBalancerFromSubnetsRequest, Model::DetachLoadBalancerFromSubnetsOutcome> DetachLoadBalancerFromSubnetsAwaitable(Model::DetachLoadBalancerFromSubnetsRequest request) const;
+
+        /**
+         * co_await-able form of DisableAvailabilityZonesForLoadBalancer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::DisableAvailabilityZonesForLoadBalancerRequest, Model::DisableAvailabilityZonesForLoadBalancerOutcome> DisableAvailabilityZonesForLoadBalancerAwaitable(Model::DisableAvailabilityZonesForLoadBalancerRequest request) const;
+
+        /**
+         * co_await-able form of EnableAvailabilityZonesForLoadBalancer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::EnableAvailabilityZonesForLoadBalancerRequest, Model::EnableAvailabilityZonesForLoadBalancerOutcome> EnableAvailabilityZonesForLoadBalancerAwaitable(Model::EnableAvailabilityZonesForLoadBalancerRequest request) const;
+
+        /**
+         * co_await-able form of ModifyLoadBalancerAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::ModifyLoadBalancerAttributesRequest, Model::ModifyLoadBalancerAttributesOutcome> ModifyLoadBalancerAttributesAwaitable(Model::ModifyLoadBalancerAttributesRequest request) const;
+
+        /**
+         * co_await-able form of RegisterInstancesWithLoadBalancer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::RegisterInstancesWithLoadBalancerRequest, Model::RegisterInstancesWithLoadBalancerOutcome> RegisterInstancesWithLoadBalancerAwaitable(Model::RegisterInstancesWithLoadBalancerRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::RemoveTagsRequest, Model::RemoveTagsOutcome> RemoveTagsAwaitable(Model::RemoveTagsRequest request) const;
+
+        /**
+         * co_await-able form of SetLoadBalancerListenerSSLCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::SetLoadBalancerListenerSSLCertificateRequest, Model::SetLoadBalancerListenerSSLCertificateOutcome> SetLoadBalancerListenerSSLCertificateAwaitable(Model::SetLoadBalancerListenerSSLCertificateRequest request) const;
+
+        /**
+         * co_await-able form of SetLoadBalancerPoliciesForBackendServer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::SetLoadBalancerPoliciesForBackendServerRequest, Model::SetLoadBalancerPoliciesForBackendServerOutcome> SetLoadBalancerPoliciesForBackendServerAwaitable(Model::SetLoadBalancerPoliciesForBackendServerRequest request) const;
+
+        /**
+         * co_await-able form of SetLoadBalancerPoliciesOfListener(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingClient, Model::SetLoadBalancerPoliciesOfListenerRequest, Model::SetLoadBalancerPoliciesOfListenerOutcome> SetLoadBalancerPoliciesOfListenerAwaitable(Model::SetLoadBalancerPoliciesOfListenerRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ApplySecurityGroupsToLoadBalancerRequest();
+    inline const char* GetServiceRequestName() const override { return "ApplySecurityGroupsToLoadBalancer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AttachLoadBalancerToSubnetsRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachLoadBalancerToSubnets"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ConfigureHealthCheckRequest();
+    inline const char* GetServiceRequestName() const override { return "ConfigureHealthCheck"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateAppCookieStickinessPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateAppCookieStickinessPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
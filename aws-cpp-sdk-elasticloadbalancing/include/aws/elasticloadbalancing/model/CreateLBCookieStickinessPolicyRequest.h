@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateLBCookieStickinessPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateLBCookieStickinessPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
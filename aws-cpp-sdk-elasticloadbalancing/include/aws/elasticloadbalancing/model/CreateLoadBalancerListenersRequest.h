@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateLoadBalancerListenersRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateLoadBalancerListeners"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateLoadBalancerPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateLoadBalancerPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
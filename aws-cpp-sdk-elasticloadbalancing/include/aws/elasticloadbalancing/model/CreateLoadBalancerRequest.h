@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateLoadBalancerRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateLoadBalancer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
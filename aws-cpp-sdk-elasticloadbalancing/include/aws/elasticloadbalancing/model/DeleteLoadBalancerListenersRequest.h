@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteLoadBalancerListenersRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteLoadBalancerListeners"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteLoadBalancerPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteLoadBalancerPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteLoadBalancerRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteLoadBalancer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DeregisterInstancesFromLoadBalancerRequest();
+    inline const char* GetServiceRequestName() const override { return "DeregisterInstancesFromLoadBalancer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeInstanceHealthRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeInstanceHealth"; }
+
     Aws::String SerializePayload() const override;
 
     /**
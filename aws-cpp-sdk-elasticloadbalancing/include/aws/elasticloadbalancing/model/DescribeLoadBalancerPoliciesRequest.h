@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeLoadBalancerPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLoadBalancerPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeLoadBalancerPolicyTypesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLoadBalancerPolicyTypes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeTagsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTags"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DetachLoadBalancerFromSubnetsRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachLoadBalancerFromSubnets"; }
+
     Aws::String SerializePayload() const override;
 
     /**
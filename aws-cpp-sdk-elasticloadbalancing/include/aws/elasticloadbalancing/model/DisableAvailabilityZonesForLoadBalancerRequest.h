@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DisableAvailabilityZonesForLoadBalancerRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableAvailabilityZonesForLoadBalancer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     EnableAvailabilityZonesForLoadBalancerRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableAvailabilityZonesForLoadBalancer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
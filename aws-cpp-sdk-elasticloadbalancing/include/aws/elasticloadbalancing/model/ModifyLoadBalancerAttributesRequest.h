@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyLoadBalancerAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyLoadBalancerAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     RegisterInstancesWithLoadBalancerRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterInstancesWithLoadBalancer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     SetLoadBalancerListenerSSLCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "SetLoadBalancerListenerSSLCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetLoadBalancerPoliciesForBackendServerRequest();
+    inline const char* GetServiceRequestName() const override { return "SetLoadBalancerPoliciesForBackendServer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetLoadBalancerPoliciesOfListenerRequest();
+    inline const char* GetServiceRequestName() const override { return "SetLoadBalancerPoliciesOfListener"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -137,7 +137,7 @@ AddTagsOutcome ElasticLoadBalancingClient::AddTags(const AddTagsRequest& request
 
 AddTagsOutcomeCallable ElasticLoadBalancingClient::AddTagsCallable(const AddTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTags( request ); } );
 }
 
 void ElasticLoadBalancingClient::AddTagsAsync(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -145,6 +145,16 @@ void ElasticLoadBalancingClient::AddTagsAsync(const AddTagsRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsOutcomeCallable ElasticLoadBalancingClient::AddTagsCallable(AddTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::AddTags, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::AddTagsAsync(AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::AddTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::AddTagsAsyncHelper(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTags(request), context);
@@ -167,7 +177,7 @@ ApplySecurityGroupsToLoadBalancerOutcome ElasticLoadBalancingClient::ApplySecuri
 
 ApplySecurityGroupsToLoadBalancerOutcomeCallable ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerCallable(const ApplySecurityGroupsToLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ApplySecurityGroupsToLoadBalancer( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ApplySecurityGroupsToLoadBalancer( request ); } );
 }
 
 void ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerAsync(const ApplySecurityGroupsToLoadBalancerRequest& request, const ApplySecurityGroupsToLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -175,6 +185,16 @@ void ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerAsync(const Ap
   m_executor->Submit( [this, request, handler, context](){ this->ApplySecurityGroupsToLoadBalancerAsyncHelper( request, handler, context ); } );
 }
 
+ApplySecurityGroupsToLoadBalancerOutcomeCallable ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerCallable(ApplySecurityGroupsToLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancer, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerAsync(ApplySecurityGroupsToLoadBalancerRequest&& request, const ApplySecurityGroupsToLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerAsyncHelper(const ApplySecurityGroupsToLoadBalancerRequest& request, const ApplySecurityGroupsToLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ApplySecurityGroupsToLoadBalancer(request), context);
@@ -197,7 +217,7 @@ AttachLoadBalancerToSubnetsOutcome ElasticLoadBalancingClient::AttachLoadBalance
 
 AttachLoadBalancerToSubnetsOutcomeCallable ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsCallable(const AttachLoadBalancerToSubnetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachLoadBalancerToSubnets( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachLoadBalancerToSubnets( request ); } );
 }
 
 void ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsAsync(const AttachLoadBalancerToSubnetsRequest& request, const AttachLoadBalancerToSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -205,6 +225,16 @@ void ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsAsync(const AttachLo
   m_executor->Submit( [this, request, handler, context](){ this->AttachLoadBalancerToSubnetsAsyncHelper( request, handler, context ); } );
 }
 
+AttachLoadBalancerToSubnetsOutcomeCallable ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsCallable(AttachLoadBalancerToSubnetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::AttachLoadBalancerToSubnets, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsAsync(AttachLoadBalancerToSubnetsRequest&& request, const AttachLoadBalancerToSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsAsyncHelper(const AttachLoadBalancerToSubnetsRequest& request, const AttachLoadBalancerToSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachLoadBalancerToSubnets(request), context);
@@ -227,7 +257,7 @@ ConfigureHealthCheckOutcome ElasticLoadBalancingClient::ConfigureHealthCheck(con
 
 ConfigureHealthCheckOutcomeCallable ElasticLoadBalancingClient::ConfigureHealthCheckCallable(const ConfigureHealthCheckRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ConfigureHealthCheck( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ConfigureHealthCheck( request ); } );
 }
 
 void ElasticLoadBalancingClient::ConfigureHealthCheckAsync(const ConfigureHealthCheckRequest& request, const ConfigureHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -235,6 +265,16 @@ void ElasticLoadBalancingClient::ConfigureHealthCheckAsync(const ConfigureHealth
   m_executor->Submit( [this, request, handler, context](){ this->ConfigureHealthCheckAsyncHelper( request, handler, context ); } );
 }
 
+ConfigureHealthCheckOutcomeCallable ElasticLoadBalancingClient::ConfigureHealthCheckCallable(ConfigureHealthCheckRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::ConfigureHealthCheck, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::ConfigureHealthCheckAsync(ConfigureHealthCheckRequest&& request, const ConfigureHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::ConfigureHealthCheckAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::ConfigureHealthCheckAsyncHelper(const ConfigureHealthCheckRequest& request, const ConfigureHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ConfigureHealthCheck(request), context);
@@ -257,7 +297,7 @@ CreateAppCookieStickinessPolicyOutcome ElasticLoadBalancingClient::CreateAppCook
 
 CreateAppCookieStickinessPolicyOutcomeCallable ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyCallable(const CreateAppCookieStickinessPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateAppCookieStickinessPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateAppCookieStickinessPolicy( request ); } );
 }
 
 void ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyAsync(const CreateAppCookieStickinessPolicyRequest& request, const CreateAppCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -265,6 +305,16 @@ void ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyAsync(const Crea
   m_executor->Submit( [this, request, handler, context](){ this->CreateAppCookieStickinessPolicyAsyncHelper( request, handler, context ); } );
 }
 
+CreateAppCookieStickinessPolicyOutcomeCallable ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyCallable(CreateAppCookieStickinessPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::CreateAppCookieStickinessPolicy, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyAsync(CreateAppCookieStickinessPolicyRequest&& request, const CreateAppCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyAsyncHelper(const CreateAppCookieStickinessPolicyRequest& request, const CreateAppCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateAppCookieStickinessPolicy(request), context);
@@ -287,7 +337,7 @@ CreateLBCookieStickinessPolicyOutcome ElasticLoadBalancingClient::CreateLBCookie
 
 CreateLBCookieStickinessPolicyOutcomeCallable ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyCallable(const CreateLBCookieStickinessPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateLBCookieStickinessPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateLBCookieStickinessPolicy( request ); } );
 }
 
 void ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyAsync(const CreateLBCookieStickinessPolicyRequest& request, const CreateLBCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -295,6 +345,16 @@ void ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyAsync(const Creat
   m_executor->Submit( [this, request, handler, context](){ this->CreateLBCookieStickinessPolicyAsyncHelper( request, handler, context ); } );
 }
 
+CreateLBCookieStickinessPolicyOutcomeCallable ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyCallable(CreateLBCookieStickinessPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::CreateLBCookieStickinessPolicy, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyAsync(CreateLBCookieStickinessPolicyRequest&& request, const CreateLBCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyAsyncHelper(const CreateLBCookieStickinessPolicyRequest& request, const CreateLBCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateLBCookieStickinessPolicy(request), context);
@@ -317,7 +377,7 @@ CreateLoadBalancerOutcome ElasticLoadBalancingClient::CreateLoadBalancer(const C
 
 CreateLoadBalancerOutcomeCallable ElasticLoadBalancingClient::CreateLoadBalancerCallable(const CreateLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateLoadBalancer( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateLoadBalancer( request ); } );
 }
 
 void ElasticLoadBalancingClient::CreateLoadBalancerAsync(const CreateLoadBalancerRequest& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -325,6 +385,16 @@ void ElasticLoadBalancingClient::CreateLoadBalancerAsync(const CreateLoadBalance
   m_executor->Submit( [this, request, handler, context](){ this->CreateLoadBalancerAsyncHelper( request, handler, context ); } );
 }
 
+CreateLoadBalancerOutcomeCallable ElasticLoadBalancingClient::CreateLoadBalancerCallable(CreateLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::CreateLoadBalancer, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::CreateLoadBalancerAsync(CreateLoadBalancerRequest&& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::CreateLoadBalancerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::CreateLoadBalancerAsyncHelper(const CreateLoadBalancerRequest& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateLoadBalancer(request), context);
@@ -347,7 +417,7 @@ CreateLoadBalancerListenersOutcome ElasticLoadBalancingClient::CreateLoadBalance
 
 CreateLoadBalancerListenersOutcomeCallable ElasticLoadBalancingClient::CreateLoadBalancerListenersCallable(const CreateLoadBalancerListenersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateLoadBalancerListeners( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateLoadBalancerListeners( request ); } );
 }
 
 void ElasticLoadBalancingClient::CreateLoadBalancerListenersAsync(const CreateLoadBalancerListenersRequest& request, const CreateLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -355,6 +425,16 @@ void ElasticLoadBalancingClient::CreateLoadBalancerListenersAsync(const CreateLo
   m_executor->Submit( [this, request, handler, context](){ this->CreateLoadBalancerListenersAsyncHelper( request, handler, context ); } );
 }
 
+CreateLoadBalancerListenersOutcomeCallable ElasticLoadBalancingClient::CreateLoadBalancerListenersCallable(CreateLoadBalancerListenersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::CreateLoadBalancerListeners, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::CreateLoadBalancerListenersAsync(CreateLoadBalancerListenersRequest&& request, const CreateLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::CreateLoadBalancerListenersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::CreateLoadBalancerListenersAsyncHelper(const CreateLoadBalancerListenersRequest& request, const CreateLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateLoadBalancerListeners(request), context);
@@ -377,7 +457,7 @@ CreateLoadBalancerPolicyOutcome ElasticLoadBalancingClient::CreateLoadBalancerPo
 
 CreateLoadBalancerPolicyOutcomeCallable ElasticLoadBalancingClient::CreateLoadBalancerPolicyCallable(const CreateLoadBalancerPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateLoadBalancerPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateLoadBalancerPolicy( request ); } );
 }
 
 void ElasticLoadBalancingClient::CreateLoadBalancerPolicyAsync(const CreateLoadBalancerPolicyRequest& request, const CreateLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -385,6 +465,16 @@ void ElasticLoadBalancingClient::CreateLoadBalancerPolicyAsync(const CreateLoadB
   m_executor->Submit( [this, request, handler, context](){ this->CreateLoadBalancerPolicyAsyncHelper( request, handler, context ); } );
 }
 
+CreateLoadBalancerPolicyOutcomeCallable ElasticLoadBalancingClient::CreateLoadBalancerPolicyCallable(CreateLoadBalancerPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::CreateLoadBalancerPolicy, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::CreateLoadBalancerPolicyAsync(CreateLoadBalancerPolicyRequest&& request, const CreateLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::CreateLoadBalancerPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::CreateLoadBalancerPolicyAsyncHelper(const CreateLoadBalancerPolicyRequest& request, const CreateLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateLoadBalancerPolicy(request), context);
@@ -407,7 +497,7 @@ DeleteLoadBalancerOutcome ElasticLoadBalancingClient::DeleteLoadBalancer(const D
 
 DeleteLoadBalancerOutcomeCallable ElasticLoadBalancingClient::DeleteLoadBalancerCallable(const DeleteLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteLoadBalancer( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteLoadBalancer( request ); } );
 }
 
 void ElasticLoadBalancingClient::DeleteLoadBalancerAsync(const DeleteLoadBalancerRequest& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -415,6 +505,16 @@ void ElasticLoadBalancingClient::DeleteLoadBalancerAsync(const DeleteLoadBalance
   m_executor->Submit( [this, request, handler, context](){ this->DeleteLoadBalancerAsyncHelper( request, handler, context ); } );
 }
 
+DeleteLoadBalancerOutcomeCallable ElasticLoadBalancingClient::DeleteLoadBalancerCallable(DeleteLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::DeleteLoadBalancer, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::DeleteLoadBalancerAsync(DeleteLoadBalancerRequest&& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::DeleteLoadBalancerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::DeleteLoadBalancerAsyncHelper(const DeleteLoadBalancerRequest& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteLoadBalancer(request), context);
@@ -437,7 +537,7 @@ DeleteLoadBalancerListenersOutcome ElasticLoadBalancingClient::DeleteLoadBalance
 
 DeleteLoadBalancerListenersOutcomeCallable ElasticLoadBalancingClient::DeleteLoadBalancerListenersCallable(const DeleteLoadBalancerListenersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteLoadBalancerListeners( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteLoadBalancerListeners( request ); } );
 }
 
 void ElasticLoadBalancingClient::DeleteLoadBalancerListenersAsync(const DeleteLoadBalancerListenersRequest& request, const DeleteLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -445,6 +545,16 @@ void ElasticLoadBalancingClient::DeleteLoadBalancerListenersAsync(const DeleteLo
   m_executor->Submit( [this, request, handler, context](){ this->DeleteLoadBalancerListenersAsyncHelper( request, handler, context ); } );
 }
 
+DeleteLoadBalancerListenersOutcomeCallable ElasticLoadBalancingClient::DeleteLoadBalancerListenersCallable(DeleteLoadBalancerListenersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::DeleteLoadBalancerListeners, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::DeleteLoadBalancerListenersAsync(DeleteLoadBalancerListenersRequest&& request, const DeleteLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::DeleteLoadBalancerListenersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::DeleteLoadBalancerListenersAsyncHelper(const DeleteLoadBalancerListenersRequest& request, const DeleteLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteLoadBalancerListeners(request), context);
@@ -467,7 +577,7 @@ DeleteLoadBalancerPolicyOutcome ElasticLoadBalancingClient::DeleteLoadBalancerPo
 
 DeleteLoadBalancerPolicyOutcomeCallable ElasticLoadBalancingClient::DeleteLoadBalancerPolicyCallable(const DeleteLoadBalancerPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteLoadBalancerPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteLoadBalancerPolicy( request ); } );
 }
 
 void ElasticLoadBalancingClient::DeleteLoadBalancerPolicyAsync(const DeleteLoadBalancerPolicyRequest& request, const DeleteLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -475,6 +585,16 @@ void ElasticLoadBalancingClient::DeleteLoadBalancerPolicyAsync(const DeleteLoadB
   m_executor->Submit( [this, request, handler, context](){ this->DeleteLoadBalancerPolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteLoadBalancerPolicyOutcomeCallable ElasticLoadBalancingClient::DeleteLoadBalancerPolicyCallable(DeleteLoadBalancerPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::DeleteLoadBalancerPolicy, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::DeleteLoadBalancerPolicyAsync(DeleteLoadBalancerPolicyRequest&& request, const DeleteLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::DeleteLoadBalancerPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::DeleteLoadBalancerPolicyAsyncHelper(const DeleteLoadBalancerPolicyRequest& request, const DeleteLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteLoadBalancerPolicy(request), context);
@@ -497,7 +617,7 @@ DeregisterInstancesFromLoadBalancerOutcome ElasticLoadBalancingClient::Deregiste
 
 DeregisterInstancesFromLoadBalancerOutcomeCallable ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerCallable(const DeregisterInstancesFromLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeregisterInstancesFromLoadBalancer( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeregisterInstancesFromLoadBalancer( request ); } );
 }
 
 void ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerAsync(const DeregisterInstancesFromLoadBalancerRequest& request, const DeregisterInstancesFromLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -505,6 +625,16 @@ void ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerAsync(const
   m_executor->Submit( [this, request, handler, context](){ this->DeregisterInstancesFromLoadBalancerAsyncHelper( request, handler, context ); } );
 }
 
+DeregisterInstancesFromLoadBalancerOutcomeCallable ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerCallable(DeregisterInstancesFromLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancer, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerAsync(DeregisterInstancesFromLoadBalancerRequest&& request, const DeregisterInstancesFromLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerAsyncHelper(const DeregisterInstancesFromLoadBalancerRequest& request, const DeregisterInstancesFromLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeregisterInstancesFromLoadBalancer(request), context);
@@ -527,7 +657,7 @@ DescribeInstanceHealthOutcome ElasticLoadBalancingClient::DescribeInstanceHealth
 
 DescribeInstanceHealthOutcomeCallable ElasticLoadBalancingClient::DescribeInstanceHealthCallable(const DescribeInstanceHealthRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeInstanceHealth( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeInstanceHealth( request ); } );
 }
 
 void ElasticLoadBalancingClient::DescribeInstanceHealthAsync(const DescribeInstanceHealthRequest& request, const DescribeInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -535,6 +665,16 @@ void ElasticLoadBalancingClient::DescribeInstanceHealthAsync(const DescribeInsta
   m_executor->Submit( [this, request, handler, context](){ this->DescribeInstanceHealthAsyncHelper( request, handler, context ); } );
 }
 
+DescribeInstanceHealthOutcomeCallable ElasticLoadBalancingClient::DescribeInstanceHealthCallable(DescribeInstanceHealthRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::DescribeInstanceHealth, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::DescribeInstanceHealthAsync(DescribeInstanceHealthRequest&& request, const DescribeInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::DescribeInstanceHealthAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::DescribeInstanceHealthAsyncHelper(const DescribeInstanceHealthRequest& request, const DescribeInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeInstanceHealth(request), context);
@@ -557,7 +697,7 @@ DescribeLoadBalancerAttributesOutcome ElasticLoadBalancingClient::DescribeLoadBa
 
 DescribeLoadBalancerAttributesOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancerAttributesCallable(const DescribeLoadBalancerAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLoadBalancerAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLoadBalancerAttributes( request ); } );
 }
 
 void ElasticLoadBalancingClient::DescribeLoadBalancerAttributesAsync(const DescribeLoadBalancerAttributesRequest& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -565,6 +705,16 @@ void ElasticLoadBalancingClient::DescribeLoadBalancerAttributesAsync(const Descr
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLoadBalancerAttributesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLoadBalancerAttributesOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancerAttributesCallable(DescribeLoadBalancerAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::DescribeLoadBalancerAttributes, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::DescribeLoadBalancerAttributesAsync(DescribeLoadBalancerAttributesRequest&& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::DescribeLoadBalancerAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::DescribeLoadBalancerAttributesAsyncHelper(const DescribeLoadBalancerAttributesRequest& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLoadBalancerAttributes(request), context);
@@ -587,7 +737,7 @@ DescribeLoadBalancerPoliciesOutcome ElasticLoadBalancingClient::DescribeLoadBala
 
 DescribeLoadBalancerPoliciesOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesCallable(const DescribeLoadBalancerPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLoadBalancerPolicies( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLoadBalancerPolicies( request ); } );
 }
 
 void ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesAsync(const DescribeLoadBalancerPoliciesRequest& request, const DescribeLoadBalancerPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -595,6 +745,16 @@ void ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesAsync(const Describ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLoadBalancerPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLoadBalancerPoliciesOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesCallable(DescribeLoadBalancerPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::DescribeLoadBalancerPolicies, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesAsync(DescribeLoadBalancerPoliciesRequest&& request, const DescribeLoadBalancerPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesAsyncHelper(const DescribeLoadBalancerPoliciesRequest& request, const DescribeLoadBalancerPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLoadBalancerPolicies(request), context);
@@ -617,7 +777,7 @@ DescribeLoadBalancerPolicyTypesOutcome ElasticLoadBalancingClient::DescribeLoadB
 
 DescribeLoadBalancerPolicyTypesOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesCallable(const DescribeLoadBalancerPolicyTypesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLoadBalancerPolicyTypes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLoadBalancerPolicyTypes( request ); } );
 }
 
 void ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesAsync(const DescribeLoadBalancerPolicyTypesRequest& request, const DescribeLoadBalancerPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -625,6 +785,16 @@ void ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesAsync(const Desc
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLoadBalancerPolicyTypesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLoadBalancerPolicyTypesOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesCallable(DescribeLoadBalancerPolicyTypesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypes, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesAsync(DescribeLoadBalancerPolicyTypesRequest&& request, const DescribeLoadBalancerPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesAsyncHelper(const DescribeLoadBalancerPolicyTypesRequest& request, const DescribeLoadBalancerPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLoadBalancerPolicyTypes(request), context);
@@ -647,7 +817,7 @@ DescribeLoadBalancersOutcome ElasticLoadBalancingClient::DescribeLoadBalancers(c
 
 DescribeLoadBalancersOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancersCallable(const DescribeLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLoadBalancers( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLoadBalancers( request ); } );
 }
 
 void ElasticLoadBalancingClient::DescribeLoadBalancersAsync(const DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -655,6 +825,16 @@ void ElasticLoadBalancingClient::DescribeLoadBalancersAsync(const DescribeLoadBa
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLoadBalancersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLoadBalancersOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancersCallable(DescribeLoadBalancersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::DescribeLoadBalancers, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::DescribeLoadBalancersAsync(DescribeLoadBalancersRequest&& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::DescribeLoadBalancersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::DescribeLoadBalancersAsyncHelper(const DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLoadBalancers(request), context);
@@ -677,7 +857,7 @@ DescribeTagsOutcome ElasticLoadBalancingClient::DescribeTags(const DescribeTagsR
 
 DescribeTagsOutcomeCallable ElasticLoadBalancingClient::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTags( request ); } );
 }
 
 void ElasticLoadBalancingClient::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -685,6 +865,16 @@ void ElasticLoadBalancingClient::DescribeTagsAsync(const DescribeTagsRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTagsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTagsOutcomeCallable ElasticLoadBalancingClient::DescribeTagsCallable(DescribeTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::DescribeTags, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::DescribeTagsAsync(DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::DescribeTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTags(request), context);
@@ -707,7 +897,7 @@ DetachLoadBalancerFromSubnetsOutcome ElasticLoadBalancingClient::DetachLoadBalan
 
 DetachLoadBalancerFromSubnetsOutcomeCallable ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsCallable(const DetachLoadBalancerFromSubnetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachLoadBalancerFromSubnets( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachLoadBalancerFromSubnets( request ); } );
 }
 
 void ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsAsync(const DetachLoadBalancerFromSubnetsRequest& request, const DetachLoadBalancerFromSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -715,6 +905,16 @@ void ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsAsync(const Detach
   m_executor->Submit( [this, request, handler, context](){ this->DetachLoadBalancerFromSubnetsAsyncHelper( request, handler, context ); } );
 }
 
+DetachLoadBalancerFromSubnetsOutcomeCallable ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsCallable(DetachLoadBalancerFromSubnetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::DetachLoadBalancerFromSubnets, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsAsync(DetachLoadBalancerFromSubnetsRequest&& request, const DetachLoadBalancerFromSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsAsyncHelper(const DetachLoadBalancerFromSubnetsRequest& request, const DetachLoadBalancerFromSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachLoadBalancerFromSubnets(request), context);
@@ -737,7 +937,7 @@ DisableAvailabilityZonesForLoadBalancerOutcome ElasticLoadBalancingClient::Disab
 
 DisableAvailabilityZonesForLoadBalancerOutcomeCallable ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerCallable(const DisableAvailabilityZonesForLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableAvailabilityZonesForLoadBalancer( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableAvailabilityZonesForLoadBalancer( request ); } );
 }
 
 void ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerAsync(const DisableAvailabilityZonesForLoadBalancerRequest& request, const DisableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -745,6 +945,16 @@ void ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerAsync(co
   m_executor->Submit( [this, request, handler, context](){ this->DisableAvailabilityZonesForLoadBalancerAsyncHelper( request, handler, context ); } );
 }
 
+DisableAvailabilityZonesForLoadBalancerOutcomeCallable ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerCallable(DisableAvailabilityZonesForLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancer, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerAsync(DisableAvailabilityZonesForLoadBalancerRequest&& request, const DisableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerAsyncHelper(const DisableAvailabilityZonesForLoadBalancerRequest& request, const DisableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableAvailabilityZonesForLoadBalancer(request), context);
@@ -767,7 +977,7 @@ EnableAvailabilityZonesForLoadBalancerOutcome ElasticLoadBalancingClient::Enable
 
 EnableAvailabilityZonesForLoadBalancerOutcomeCallable ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerCallable(const EnableAvailabilityZonesForLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableAvailabilityZonesForLoadBalancer( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableAvailabilityZonesForLoadBalancer( request ); } );
 }
 
 void ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerAsync(const EnableAvailabilityZonesForLoadBalancerRequest& request, const EnableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -775,6 +985,16 @@ void ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerAsync(con
   m_executor->Submit( [this, request, handler, context](){ this->EnableAvailabilityZonesForLoadBalancerAsyncHelper( request, handler, context ); } );
 }
 
+EnableAvailabilityZonesForLoadBalancerOutcomeCallable ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerCallable(EnableAvailabilityZonesForLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancer, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerAsync(EnableAvailabilityZonesForLoadBalancerRequest&& request, const EnableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerAsyncHelper(const EnableAvailabilityZonesForLoadBalancerRequest& request, const EnableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableAvailabilityZonesForLoadBalancer(request), context);
@@ -797,7 +1017,7 @@ ModifyLoadBalancerAttributesOutcome ElasticLoadBalancingClient::ModifyLoadBalanc
 
 ModifyLoadBalancerAttributesOutcomeCallable ElasticLoadBalancingClient::ModifyLoadBalancerAttributesCallable(const ModifyLoadBalancerAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyLoadBalancerAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyLoadBalancerAttributes( request ); } );
 }
 
 void ElasticLoadBalancingClient::ModifyLoadBalancerAttributesAsync(const ModifyLoadBalancerAttributesRequest& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -805,6 +1025,16 @@ void ElasticLoadBalancingClient::ModifyLoadBalancerAttributesAsync(const ModifyL
   m_executor->Submit( [this, request, handler, context](){ this->ModifyLoadBalancerAttributesAsyncHelper( request, handler, context ); } );
 }
 
+ModifyLoadBalancerAttributesOutcomeCallable ElasticLoadBalancingClient::ModifyLoadBalancerAttributesCallable(ModifyLoadBalancerAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::ModifyLoadBalancerAttributes, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::ModifyLoadBalancerAttributesAsync(ModifyLoadBalancerAttributesRequest&& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::ModifyLoadBalancerAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::ModifyLoadBalancerAttributesAsyncHelper(const ModifyLoadBalancerAttributesRequest& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyLoadBalancerAttributes(request), context);
@@ -827,7 +1057,7 @@ RegisterInstancesWithLoadBalancerOutcome ElasticLoadBalancingClient::RegisterIns
 
 RegisterInstancesWithLoadBalancerOutcomeCallable ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerCallable(const RegisterInstancesWithLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterInstancesWithLoadBalancer( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterInstancesWithLoadBalancer( request ); } );
 }
 
 void ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerAsync(const RegisterInstancesWithLoadBalancerRequest& request, const RegisterInstancesWithLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -835,6 +1065,16 @@ void ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerAsync(const Re
   m_executor->Submit( [this, request, handler, context](){ this->RegisterInstancesWithLoadBalancerAsyncHelper( request, handler, context ); } );
 }
 
+RegisterInstancesWithLoadBalancerOutcomeCallable ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerCallable(RegisterInstancesWithLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancer, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerAsync(RegisterInstancesWithLoadBalancerRequest&& request, const RegisterInstancesWithLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerAsyncHelper(const RegisterInstancesWithLoadBalancerRequest& request, const RegisterInstancesWithLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterInstancesWithLoadBalancer(request), context);
@@ -857,7 +1097,7 @@ RemoveTagsOutcome ElasticLoadBalancingClient::RemoveTags(const RemoveTagsRequest
 
 RemoveTagsOutcomeCallable ElasticLoadBalancingClient::RemoveTagsCallable(const RemoveTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTags( request ); } );
 }
 
 void ElasticLoadBalancingClient::RemoveTagsAsync(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -865,6 +1105,16 @@ void ElasticLoadBalancingClient::RemoveTagsAsync(const RemoveTagsRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsOutcomeCallable ElasticLoadBalancingClient::RemoveTagsCallable(RemoveTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::RemoveTags, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::RemoveTagsAsync(RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::RemoveTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::RemoveTagsAsyncHelper(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTags(request), context);
@@ -887,7 +1137,7 @@ SetLoadBalancerListenerSSLCertificateOutcome ElasticLoadBalancingClient::SetLoad
 
 SetLoadBalancerListenerSSLCertificateOutcomeCallable ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateCallable(const SetLoadBalancerListenerSSLCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetLoadBalancerListenerSSLCertificate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetLoadBalancerListenerSSLCertificate( request ); } );
 }
 
 void ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateAsync(const SetLoadBalancerListenerSSLCertificateRequest& request, const SetLoadBalancerListenerSSLCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -895,6 +1145,16 @@ void ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateAsync(cons
   m_executor->Submit( [this, request, handler, context](){ this->SetLoadBalancerListenerSSLCertificateAsyncHelper( request, handler, context ); } );
 }
 
+SetLoadBalancerListenerSSLCertificateOutcomeCallable ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateCallable(SetLoadBalancerListenerSSLCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificate, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateAsync(SetLoadBalancerListenerSSLCertificateRequest&& request, const SetLoadBalancerListenerSSLCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateAsyncHelper(const SetLoadBalancerListenerSSLCertificateRequest& request, const SetLoadBalancerListenerSSLCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetLoadBalancerListenerSSLCertificate(request), context);
@@ -917,7 +1177,7 @@ SetLoadBalancerPoliciesForBackendServerOutcome ElasticLoadBalancingClient::SetLo
 
 SetLoadBalancerPoliciesForBackendServerOutcomeCallable ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerCallable(const SetLoadBalancerPoliciesForBackendServerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetLoadBalancerPoliciesForBackendServer( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetLoadBalancerPoliciesForBackendServer( request ); } );
 }
 
 void ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerAsync(const SetLoadBalancerPoliciesForBackendServerRequest& request, const SetLoadBalancerPoliciesForBackendServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -925,6 +1185,16 @@ void ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerAsync(co
   m_executor->Submit( [this, request, handler, context](){ this->SetLoadBalancerPoliciesForBackendServerAsyncHelper( request, handler, context ); } );
 }
 
+SetLoadBalancerPoliciesForBackendServerOutcomeCallable ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerCallable(SetLoadBalancerPoliciesForBackendServerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServer, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerAsync(SetLoadBalancerPoliciesForBackendServerRequest&& request, const SetLoadBalancerPoliciesForBackendServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerAsyncHelper(const SetLoadBalancerPoliciesForBackendServerRequest& request, const SetLoadBalancerPoliciesForBackendServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetLoadBalancerPoliciesForBackendServer(request), context);
@@ -947,7 +1217,7 @@ SetLoadBalancerPoliciesOfListenerOutcome ElasticLoadBalancingClient::SetLoadBala
 
 SetLoadBalancerPoliciesOfListenerOutcomeCallable ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerCallable(const SetLoadBalancerPoliciesOfListenerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetLoadBalancerPoliciesOfListener( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetLoadBalancerPoliciesOfListener( request ); } );
 }
 
 void ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerAsync(const SetLoadBalancerPoliciesOfListenerRequest& request, const SetLoadBalancerPoliciesOfListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -955,8 +1225,177 @@ void ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerAsync(const Se
   m_executor->Submit( [this, request, handler, context](){ this->SetLoadBalancerPoliciesOfListenerAsyncHelper( request, handler, context ); } );
 }
 
+SetLoadBalancerPoliciesOfListenerOutcomeCallable ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerCallable(SetLoadBalancerPoliciesOfListenerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListener, this, std::move(request)));
+}
+
+void ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerAsync(SetLoadBalancerPoliciesOfListenerRequest&& request, const SetLoadBalancerPoliciesOfListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerAsyncHelper(const SetLoadBalancerPoliciesOfListenerRequest& request, const SetLoadBalancerPoliciesOfListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetLoadBalancerPoliciesOfListener(request), context);
 }
 
+Paginator<ElasticLoadBalancingClient, DescribeLoadBalancersRequest, DescribeLoadBalancersOutcome> ElasticLoadBalancingClient::DescribeLoadBalancersPaginator(const DescribeLoadBalancersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElasticLoadBalancingClient, DescribeLoadBalancersRequest, DescribeLoadBalancersOutcome>(this, &ElasticLoadBalancingClient::DescribeLoadBalancers, request,
+    [](const DescribeLoadBalancersRequest& current, const DescribeLoadBalancersOutcome& outcome, DescribeLoadBalancersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<ElasticLoadBalancingClient, AddTagsRequest, AddTagsOutcome> ElasticLoadBalancingClient::AddTagsAwaitable(AddTagsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::AddTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, ApplySecurityGroupsToLoadBalancerRequest, ApplySecurityGroupsToLoadBalancerOutcome> ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerAwaitable(ApplySecurityGroupsToLoadBalancerRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancer, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, AttachLoadBalancerToSubnetsRequest, AttachLoadBalancerToSubnetsOutcome> ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsAwaitable(AttachLoadBalancerToSubnetsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::AttachLoadBalancerToSubnets, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, ConfigureHealthCheckRequest, ConfigureHealthCheckOutcome> ElasticLoadBalancingClient::ConfigureHealthCheckAwaitable(ConfigureHealthCheckRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::ConfigureHealthCheck, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, CreateAppCookieStickinessPolicyRequest, CreateAppCookieStickinessPolicyOutcome> ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyAwaitable(CreateAppCookieStickinessPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::CreateAppCookieStickinessPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, CreateLBCookieStickinessPolicyRequest, CreateLBCookieStickinessPolicyOutcome> ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyAwaitable(CreateLBCookieStickinessPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::CreateLBCookieStickinessPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, CreateLoadBalancerRequest, CreateLoadBalancerOutcome> ElasticLoadBalancingClient::CreateLoadBalancerAwaitable(CreateLoadBalancerRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::CreateLoadBalancer, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, CreateLoadBalancerListenersRequest, CreateLoadBalancerListenersOutcome> ElasticLoadBalancingClient::CreateLoadBalancerListenersAwaitable(CreateLoadBalancerListenersRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::CreateLoadBalancerListeners, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, CreateLoadBalancerPolicyRequest, CreateLoadBalancerPolicyOutcome> ElasticLoadBalancingClient::CreateLoadBalancerPolicyAwaitable(CreateLoadBalancerPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::CreateLoadBalancerPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, DeleteLoadBalancerRequest, DeleteLoadBalancerOutcome> ElasticLoadBalancingClient::DeleteLoadBalancerAwaitable(DeleteLoadBalancerRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::DeleteLoadBalancer, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, DeleteLoadBalancerListenersRequest, DeleteLoadBalancerListenersOutcome> ElasticLoadBalancingClient::DeleteLoadBalancerListenersAwaitable(DeleteLoadBalancerListenersRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::DeleteLoadBalancerListeners, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, DeleteLoadBalancerPolicyRequest, DeleteLoadBalancerPolicyOutcome> ElasticLoadBalancingClient::DeleteLoadBalancerPolicyAwaitable(DeleteLoadBalancerPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::DeleteLoadBalancerPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, DeregisterInstancesFromLoadBalancerRequest, DeregisterInstancesFromLoadBalancerOutcome> ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerAwaitable(DeregisterInstancesFromLoadBalancerRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancer, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, DescribeInstanceHealthRequest, DescribeInstanceHealthOutcome> ElasticLoadBalancingClient::DescribeInstanceHealthAwaitable(DescribeInstanceHealthRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::DescribeInstanceHealth, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, DescribeLoadBalancerAttributesRequest, DescribeLoadBalancerAttributesOutcome> ElasticLoadBalancingClient::DescribeLoadBalancerAttributesAwaitable(DescribeLoadBalancerAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::DescribeLoadBalancerAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, DescribeLoadBalancerPoliciesRequest, DescribeLoadBalancerPoliciesOutcome> ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesAwaitable(DescribeLoadBalancerPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::DescribeLoadBalancerPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, DescribeLoadBalancerPolicyTypesRequest, DescribeLoadBalancerPolicyTypesOutcome> ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesAwaitable(DescribeLoadBalancerPolicyTypesRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypes, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, DescribeLoadBalancersRequest, DescribeLoadBalancersOutcome> ElasticLoadBalancingClient::DescribeLoadBalancersAwaitable(DescribeLoadBalancersRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::DescribeLoadBalancers, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, DescribeTagsRequest, DescribeTagsOutcome> ElasticLoadBalancingClient::DescribeTagsAwaitable(DescribeTagsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::DescribeTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, DetachLoadBalancerFromSubnetsRequest, DetachLoadBalancerFromSubnetsOutcome> ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsAwaitable(DetachLoadBalancerFromSubnetsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::DetachLoadBalancerFromSubnets, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, DisableAvailabilityZonesForLoadBalancerRequest, DisableAvailabilityZonesForLoadBalancerOutcome> ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerAwaitable(DisableAvailabilityZonesForLoadBalancerRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancer, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, EnableAvailabilityZonesForLoadBalancerRequest, EnableAvailabilityZonesForLoadBalancerOutcome> ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerAwaitable(EnableAvailabilityZonesForLoadBalancerRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancer, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, ModifyLoadBalancerAttributesRequest, ModifyLoadBalancerAttributesOutcome> ElasticLoadBalancingClient::ModifyLoadBalancerAttributesAwaitable(ModifyLoadBalancerAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::ModifyLoadBalancerAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, RegisterInstancesWithLoadBalancerRequest, RegisterInstancesWithLoadBalancerOutcome> ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerAwaitable(RegisterInstancesWithLoadBalancerRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancer, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, RemoveTagsRequest, RemoveTagsOutcome> ElasticLoadBalancingClient::RemoveTagsAwaitable(RemoveTagsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::RemoveTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, SetLoadBalancerListenerSSLCertificateRequest, SetLoadBalancerListenerSSLCertificateOutcome> ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateAwaitable(SetLoadBalancerListenerSSLCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, SetLoadBalancerPoliciesForBackendServerRequest, SetLoadBalancerPoliciesForBackendServerOutcome> ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerAwaitable(SetLoadBalancerPoliciesForBackendServerRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServer, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingClient, SetLoadBalancerPoliciesOfListenerRequest, SetLoadBalancerPoliciesOfListenerOutcome> ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerAwaitable(SetLoadBalancerPoliciesOfListenerRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListener, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
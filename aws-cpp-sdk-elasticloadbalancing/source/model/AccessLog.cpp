@@ -59,25 +59,25 @@ AccessLog& AccessLog::operator =(const XmlNode& xmlNode)
     XmlNode enabledNode = resultNode.FirstChild("Enabled");
     if(!enabledNode.IsNull())
     {
-      m_enabled = StringUtils::ConvertToBool(StringUtils::Trim(enabledNode.GetText().c_str()).c_str());
+      m_enabled = StringUtils::ConvertToBool(enabledNode.GetTextView().Trim().ToString().c_str());
       m_enabledHasBeenSet = true;
     }
     XmlNode s3BucketNameNode = resultNode.FirstChild("S3BucketName");
     if(!s3BucketNameNode.IsNull())
     {
-      m_s3BucketName = StringUtils::Trim(s3BucketNameNode.GetText().c_str());
+      m_s3BucketName = s3BucketNameNode.GetTextView().Trim().ToString();
       m_s3BucketNameHasBeenSet = true;
     }
     XmlNode emitIntervalNode = resultNode.FirstChild("EmitInterval");
     if(!emitIntervalNode.IsNull())
     {
-      m_emitInterval = StringUtils::ConvertToInt32(StringUtils::Trim(emitIntervalNode.GetText().c_str()).c_str());
+      m_emitInterval = StringUtils::ConvertToInt32(emitIntervalNode.GetTextView().Trim().ToString().c_str());
       m_emitIntervalHasBeenSet = true;
     }
     XmlNode s3BucketPrefixNode = resultNode.FirstChild("S3BucketPrefix");
     if(!s3BucketPrefixNode.IsNull())
     {
-      m_s3BucketPrefix = StringUtils::Trim(s3BucketPrefixNode.GetText().c_str());
+      m_s3BucketPrefix = s3BucketPrefixNode.GetTextView().Trim().ToString();
       m_s3BucketPrefixHasBeenSet = true;
     }
   }
@@ -94,7 +94,7 @@ void AccessLog::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 
   if(m_s3BucketNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".S3BucketName=" << StringUtils::URLEncode(m_s3BucketName.c_str()) << "&";
+      oStream << location << index << locationValue << ".S3BucketName=" << StringUtils::URLEncoded(m_s3BucketName) << "&";
   }
 
   if(m_emitIntervalHasBeenSet)
@@ -104,7 +104,7 @@ void AccessLog::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 
   if(m_s3BucketPrefixHasBeenSet)
   {
-      oStream << location << index << locationValue << ".S3BucketPrefix=" << StringUtils::URLEncode(m_s3BucketPrefix.c_str()) << "&";
+      oStream << location << index << locationValue << ".S3BucketPrefix=" << StringUtils::URLEncoded(m_s3BucketPrefix) << "&";
   }
 
 }
@@ -117,7 +117,7 @@ void AccessLog::OutputToStream(Aws::OStream& oStream, const char* location) cons
   }
   if(m_s3BucketNameHasBeenSet)
   {
-      oStream << location << ".S3BucketName=" << StringUtils::URLEncode(m_s3BucketName.c_str()) << "&";
+      oStream << location << ".S3BucketName=" << StringUtils::URLEncoded(m_s3BucketName) << "&";
   }
   if(m_emitIntervalHasBeenSet)
   {
@@ -125,7 +125,7 @@ void AccessLog::OutputToStream(Aws::OStream& oStream, const char* location) cons
   }
   if(m_s3BucketPrefixHasBeenSet)
   {
-      oStream << location << ".S3BucketPrefix=" << StringUtils::URLEncode(m_s3BucketPrefix.c_str()) << "&";
+      oStream << location << ".S3BucketPrefix=" << StringUtils::URLEncoded(m_s3BucketPrefix) << "&";
   }
 }
 
@@ -51,13 +51,13 @@ AppCookieStickinessPolicy& AppCookieStickinessPolicy::operator =(const XmlNode&
     XmlNode policyNameNode = resultNode.FirstChild("PolicyName");
     if(!policyNameNode.IsNull())
     {
-      m_policyName = StringUtils::Trim(policyNameNode.GetText().c_str());
+      m_policyName = policyNameNode.GetTextView().Trim().ToString();
       m_policyNameHasBeenSet = true;
     }
     XmlNode cookieNameNode = resultNode.FirstChild("CookieName");
     if(!cookieNameNode.IsNull())
     {
-      m_cookieName = StringUtils::Trim(cookieNameNode.GetText().c_str());
+      m_cookieName = cookieNameNode.GetTextView().Trim().ToString();
       m_cookieNameHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void AppCookieStickinessPolicy::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_policyNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
 
   if(m_cookieNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CookieName=" << StringUtils::URLEncode(m_cookieName.c_str()) << "&";
+      oStream << location << index << locationValue << ".CookieName=" << StringUtils::URLEncoded(m_cookieName) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void AppCookieStickinessPolicy::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_policyNameHasBeenSet)
   {
-      oStream << location << ".PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+      oStream << location << ".PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
   if(m_cookieNameHasBeenSet)
   {
-      oStream << location << ".CookieName=" << StringUtils::URLEncode(m_cookieName.c_str()) << "&";
+      oStream << location << ".CookieName=" << StringUtils::URLEncoded(m_cookieName) << "&";
   }
 }
 
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancing/model/ApplySecurityGroupsToLoadBalancerRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancing::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ ApplySecurityGroupsToLoadBalancerRequest::ApplySecurityGroupsToLoadBalancerReque
 
 Aws::String ApplySecurityGroupsToLoadBalancerRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ApplySecurityGroupsToLoadBalancer&";
   if(m_loadBalancerNameHasBeenSet)
   {
-    ss << "LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+    ss << "LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
 
   if(m_securityGroupsHasBeenSet)
@@ -40,12 +41,12 @@ Aws::String ApplySecurityGroupsToLoadBalancerRequest::SerializePayload() const
     for(auto& item : m_securityGroups)
     {
       ss << "SecurityGroups.member." << securityGroupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       securityGroupsCount++;
     }
   }
 
   ss << "Version=2012-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ApplySecurityGroupsToLoadBalancerResult& ApplySecurityGroupsToLoadBalancerResult
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ApplySecurityGroupsToLoadBalancerResult")
+  if (rootNode.GetNameView() != "ApplySecurityGroupsToLoadBalancerResult")
   {
     resultNode = rootNode.FirstChild("ApplySecurityGroupsToLoadBalancerResult");
   }
@@ -53,7 +53,7 @@ ApplySecurityGroupsToLoadBalancerResult& ApplySecurityGroupsToLoadBalancerResult
       XmlNode securityGroupsMember = securityGroupsNode.FirstChild("member");
       while(!securityGroupsMember.IsNull())
       {
-        m_securityGroups.push_back(StringUtils::Trim(securityGroupsMember.GetText().c_str()));
+        m_securityGroups.push_back(securityGroupsMember.GetTextView().Trim().ToString());
         securityGroupsMember = securityGroupsMember.NextNode("member");
       }
 
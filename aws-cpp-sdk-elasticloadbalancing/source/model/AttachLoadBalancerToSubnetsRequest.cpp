@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancing/model/AttachLoadBalancerToSubnetsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancing::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ AttachLoadBalancerToSubnetsRequest::AttachLoadBalancerToSubnetsRequest() :
 
 Aws::String AttachLoadBalancerToSubnetsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AttachLoadBalancerToSubnets&";
   if(m_loadBalancerNameHasBeenSet)
   {
-    ss << "LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+    ss << "LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
 
   if(m_subnetsHasBeenSet)
@@ -40,12 +41,12 @@ Aws::String AttachLoadBalancerToSubnetsRequest::SerializePayload() const
     for(auto& item : m_subnets)
     {
       ss << "Subnets.member." << subnetsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       subnetsCount++;
     }
   }
 
   ss << "Version=2012-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
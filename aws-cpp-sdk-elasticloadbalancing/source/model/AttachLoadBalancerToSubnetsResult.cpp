@@ -40,7 +40,7 @@ AttachLoadBalancerToSubnetsResult& AttachLoadBalancerToSubnetsResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AttachLoadBalancerToSubnetsResult")
+  if (rootNode.GetNameView() != "AttachLoadBalancerToSubnetsResult")
   {
     resultNode = rootNode.FirstChild("AttachLoadBalancerToSubnetsResult");
   }
@@ -53,7 +53,7 @@ AttachLoadBalancerToSubnetsResult& AttachLoadBalancerToSubnetsResult::operator =
       XmlNode subnetsMember = subnetsNode.FirstChild("member");
       while(!subnetsMember.IsNull())
       {
-        m_subnets.push_back(StringUtils::Trim(subnetsMember.GetText().c_str()));
+        m_subnets.push_back(subnetsMember.GetTextView().Trim().ToString());
         subnetsMember = subnetsMember.NextNode("member");
       }
 
@@ -53,7 +53,7 @@ BackendServerDescription& BackendServerDescription::operator =(const XmlNode& xm
     XmlNode instancePortNode = resultNode.FirstChild("InstancePort");
     if(!instancePortNode.IsNull())
     {
-      m_instancePort = StringUtils::ConvertToInt32(StringUtils::Trim(instancePortNode.GetText().c_str()).c_str());
+      m_instancePort = StringUtils::ConvertToInt32(instancePortNode.GetTextView().Trim().ToString().c_str());
       m_instancePortHasBeenSet = true;
     }
     XmlNode policyNamesNode = resultNode.FirstChild("PolicyNames");
@@ -62,7 +62,7 @@ BackendServerDescription& BackendServerDescription::operator =(const XmlNode& xm
       XmlNode policyNamesMember = policyNamesNode.FirstChild("member");
       while(!policyNamesMember.IsNull())
       {
-        m_policyNames.push_back(StringUtils::Trim(policyNamesMember.GetText().c_str()));
+        m_policyNames.push_back(policyNamesMember.GetTextView().Trim().ToString());
         policyNamesMember = policyNamesMember.NextNode("member");
       }
 
@@ -85,7 +85,7 @@ void BackendServerDescription::OutputToStream(Aws::OStream& oStream, const char*
       unsigned policyNamesIdx = 1;
       for(auto& item : m_policyNames)
       {
-        oStream << location << index << locationValue << ".PolicyNames.member." << policyNamesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".PolicyNames.member." << policyNamesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -102,7 +102,7 @@ void BackendServerDescription::OutputToStream(Aws::OStream& oStream, const char*
       unsigned policyNamesIdx = 1;
       for(auto& item : m_policyNames)
       {
-        oStream << location << ".PolicyNames.member." << policyNamesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".PolicyNames.member." << policyNamesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancing/model/ConfigureHealthCheckRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancing::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ ConfigureHealthCheckRequest::ConfigureHealthCheckRequest() :
 
 Aws::String ConfigureHealthCheckRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ConfigureHealthCheck&";
   if(m_loadBalancerNameHasBeenSet)
   {
-    ss << "LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+    ss << "LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
 
   if(m_healthCheckHasBeenSet)
@@ -40,6 +41,6 @@ Aws::String ConfigureHealthCheckRequest::SerializePayload() const
   }
 
   ss << "Version=2012-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
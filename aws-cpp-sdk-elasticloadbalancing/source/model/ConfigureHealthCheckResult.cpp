@@ -40,7 +40,7 @@ ConfigureHealthCheckResult& ConfigureHealthCheckResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ConfigureHealthCheckResult")
+  if (rootNode.GetNameView() != "ConfigureHealthCheckResult")
   {
     resultNode = rootNode.FirstChild("ConfigureHealthCheckResult");
   }
@@ -55,13 +55,13 @@ ConnectionDraining& ConnectionDraining::operator =(const XmlNode& xmlNode)
     XmlNode enabledNode = resultNode.FirstChild("Enabled");
     if(!enabledNode.IsNull())
     {
-      m_enabled = StringUtils::ConvertToBool(StringUtils::Trim(enabledNode.GetText().c_str()).c_str());
+      m_enabled = StringUtils::ConvertToBool(enabledNode.GetTextView().Trim().ToString().c_str());
       m_enabledHasBeenSet = true;
     }
     XmlNode timeoutNode = resultNode.FirstChild("Timeout");
     if(!timeoutNode.IsNull())
     {
-      m_timeout = StringUtils::ConvertToInt32(StringUtils::Trim(timeoutNode.GetText().c_str()).c_str());
+      m_timeout = StringUtils::ConvertToInt32(timeoutNode.GetTextView().Trim().ToString().c_str());
       m_timeoutHasBeenSet = true;
     }
   }
@@ -51,7 +51,7 @@ ConnectionSettings& ConnectionSettings::operator =(const XmlNode& xmlNode)
     XmlNode idleTimeoutNode = resultNode.FirstChild("IdleTimeout");
     if(!idleTimeoutNode.IsNull())
     {
-      m_idleTimeout = StringUtils::ConvertToInt32(StringUtils::Trim(idleTimeoutNode.GetText().c_str()).c_str());
+      m_idleTimeout = StringUtils::ConvertToInt32(idleTimeoutNode.GetTextView().Trim().ToString().c_str());
       m_idleTimeoutHasBeenSet = true;
     }
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancing/model/CreateAppCookieStickinessPolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancing::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ CreateAppCookieStickinessPolicyRequest::CreateAppCookieStickinessPolicyRequest()
 
 Aws::String CreateAppCookieStickinessPolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateAppCookieStickinessPolicy&";
   if(m_loadBalancerNameHasBeenSet)
   {
-    ss << "LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+    ss << "LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
 
   if(m_policyNameHasBeenSet)
   {
-    ss << "PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+    ss << "PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
 
   if(m_cookieNameHasBeenSet)
   {
-    ss << "CookieName=" << StringUtils::URLEncode(m_cookieName.c_str()) << "&";
+    ss << "CookieName=" << StringUtils::URLEncoded(m_cookieName) << "&";
   }
 
   ss << "Version=2012-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateAppCookieStickinessPolicyResult& CreateAppCookieStickinessPolicyResult::op
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateAppCookieStickinessPolicyResult")
+  if (rootNode.GetNameView() != "CreateAppCookieStickinessPolicyResult")
   {
     resultNode = rootNode.FirstChild("CreateAppCookieStickinessPolicyResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancing/model/CreateLBCookieStickinessPolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancing::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ CreateLBCookieStickinessPolicyRequest::CreateLBCookieStickinessPolicyRequest() :
 
 Aws::String CreateLBCookieStickinessPolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateLBCookieStickinessPolicy&";
   if(m_loadBalancerNameHasBeenSet)
   {
-    ss << "LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+    ss << "LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
 
   if(m_policyNameHasBeenSet)
   {
-    ss << "PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+    ss << "PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
 
   if(m_cookieExpirationPeriodHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String CreateLBCookieStickinessPolicyRequest::SerializePayload() const
   }
 
   ss << "Version=2012-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
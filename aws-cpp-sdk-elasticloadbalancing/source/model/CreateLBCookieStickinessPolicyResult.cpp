@@ -40,7 +40,7 @@ CreateLBCookieStickinessPolicyResult& CreateLBCookieStickinessPolicyResult::oper
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateLBCookieStickinessPolicyResult")
+  if (rootNode.GetNameView() != "CreateLBCookieStickinessPolicyResult")
   {
     resultNode = rootNode.FirstChild("CreateLBCookieStickinessPolicyResult");
   }
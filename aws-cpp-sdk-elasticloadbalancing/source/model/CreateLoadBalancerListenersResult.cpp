@@ -40,7 +40,7 @@ CreateLoadBalancerListenersResult& CreateLoadBalancerListenersResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateLoadBalancerListenersResult")
+  if (rootNode.GetNameView() != "CreateLoadBalancerListenersResult")
   {
     resultNode = rootNode.FirstChild("CreateLoadBalancerListenersResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancing/model/CreateLoadBalancerPolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancing::Model;
 using namespace Aws::Utils;
@@ -29,21 +30,21 @@ CreateLoadBalancerPolicyRequest::CreateLoadBalancerPolicyRequest() :
 
 Aws::String CreateLoadBalancerPolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateLoadBalancerPolicy&";
   if(m_loadBalancerNameHasBeenSet)
   {
-    ss << "LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+    ss << "LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
 
   if(m_policyNameHasBeenSet)
   {
-    ss << "PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+    ss << "PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
 
   if(m_policyTypeNameHasBeenSet)
   {
-    ss << "PolicyTypeName=" << StringUtils::URLEncode(m_policyTypeName.c_str()) << "&";
+    ss << "PolicyTypeName=" << StringUtils::URLEncoded(m_policyTypeName) << "&";
   }
 
   if(m_policyAttributesHasBeenSet)
@@ -57,6 +58,6 @@ Aws::String CreateLoadBalancerPolicyRequest::SerializePayload() const
   }
 
   ss << "Version=2012-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
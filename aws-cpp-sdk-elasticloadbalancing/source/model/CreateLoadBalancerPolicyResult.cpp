@@ -40,7 +40,7 @@ CreateLoadBalancerPolicyResult& CreateLoadBalancerPolicyResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateLoadBalancerPolicyResult")
+  if (rootNode.GetNameView() != "CreateLoadBalancerPolicyResult")
   {
     resultNode = rootNode.FirstChild("CreateLoadBalancerPolicyResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancing/model/CreateLoadBalancerRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancing::Model;
 using namespace Aws::Utils;
@@ -32,11 +33,11 @@ CreateLoadBalancerRequest::CreateLoadBalancerRequest() :
 
 Aws::String CreateLoadBalancerRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateLoadBalancer&";
   if(m_loadBalancerNameHasBeenSet)
   {
-    ss << "LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+    ss << "LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
 
   if(m_listenersHasBeenSet)
@@ -55,7 +56,7 @@ Aws::String CreateLoadBalancerRequest::SerializePayload() const
     for(auto& item : m_availabilityZones)
     {
       ss << "AvailabilityZones.member." << availabilityZonesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       availabilityZonesCount++;
     }
   }
@@ -66,7 +67,7 @@ Aws::String CreateLoadBalancerRequest::SerializePayload() const
     for(auto& item : m_subnets)
     {
       ss << "Subnets.member." << subnetsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       subnetsCount++;
     }
   }
@@ -77,14 +78,14 @@ Aws::String CreateLoadBalancerRequest::SerializePayload() const
     for(auto& item : m_securityGroups)
     {
       ss << "SecurityGroups.member." << securityGroupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       securityGroupsCount++;
     }
   }
 
   if(m_schemeHasBeenSet)
   {
-    ss << "Scheme=" << StringUtils::URLEncode(m_scheme.c_str()) << "&";
+    ss << "Scheme=" << StringUtils::URLEncoded(m_scheme) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -98,6 +99,6 @@ Aws::String CreateLoadBalancerRequest::SerializePayload() const
   }
 
   ss << "Version=2012-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateLoadBalancerResult& CreateLoadBalancerResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateLoadBalancerResult")
+  if (rootNode.GetNameView() != "CreateLoadBalancerResult")
   {
     resultNode = rootNode.FirstChild("CreateLoadBalancerResult");
   }
@@ -50,7 +50,7 @@ CreateLoadBalancerResult& CreateLoadBalancerResult::operator =(const AmazonWebSe
     XmlNode dNSNameNode = resultNode.FirstChild("DNSName");
     if(!dNSNameNode.IsNull())
     {
-      m_dNSName = StringUtils::Trim(dNSNameNode.GetText().c_str());
+      m_dNSName = dNSNameNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ DeleteLoadBalancerListenersResult& DeleteLoadBalancerListenersResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteLoadBalancerListenersResult")
+  if (rootNode.GetNameView() != "DeleteLoadBalancerListenersResult")
   {
     resultNode = rootNode.FirstChild("DeleteLoadBalancerListenersResult");
   }
@@ -40,7 +40,7 @@ DeleteLoadBalancerPolicyResult& DeleteLoadBalancerPolicyResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteLoadBalancerPolicyResult")
+  if (rootNode.GetNameView() != "DeleteLoadBalancerPolicyResult")
   {
     resultNode = rootNode.FirstChild("DeleteLoadBalancerPolicyResult");
   }
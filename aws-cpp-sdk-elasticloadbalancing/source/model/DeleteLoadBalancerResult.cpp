@@ -40,7 +40,7 @@ DeleteLoadBalancerResult& DeleteLoadBalancerResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteLoadBalancerResult")
+  if (rootNode.GetNameView() != "DeleteLoadBalancerResult")
   {
     resultNode = rootNode.FirstChild("DeleteLoadBalancerResult");
   }
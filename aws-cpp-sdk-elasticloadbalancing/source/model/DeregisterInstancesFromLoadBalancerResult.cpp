@@ -40,7 +40,7 @@ DeregisterInstancesFromLoadBalancerResult& DeregisterInstancesFromLoadBalancerRe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeregisterInstancesFromLoadBalancerResult")
+  if (rootNode.GetNameView() != "DeregisterInstancesFromLoadBalancerResult")
   {
     resultNode = rootNode.FirstChild("DeregisterInstancesFromLoadBalancerResult");
   }
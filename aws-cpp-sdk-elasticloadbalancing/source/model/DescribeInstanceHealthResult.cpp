@@ -40,7 +40,7 @@ DescribeInstanceHealthResult& DescribeInstanceHealthResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeInstanceHealthResult")
+  if (rootNode.GetNameView() != "DescribeInstanceHealthResult")
   {
     resultNode = rootNode.FirstChild("DescribeInstanceHealthResult");
   }
@@ -40,7 +40,7 @@ DescribeLoadBalancerPoliciesResult& DescribeLoadBalancerPoliciesResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeLoadBalancerPoliciesResult")
+  if (rootNode.GetNameView() != "DescribeLoadBalancerPoliciesResult")
   {
     resultNode = rootNode.FirstChild("DescribeLoadBalancerPoliciesResult");
   }
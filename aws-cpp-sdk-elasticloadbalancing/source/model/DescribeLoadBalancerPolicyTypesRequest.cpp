@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancing/model/DescribeLoadBalancerPolicyTypesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancing::Model;
 using namespace Aws::Utils;
@@ -26,7 +27,7 @@ DescribeLoadBalancerPolicyTypesRequest::DescribeLoadBalancerPolicyTypesRequest()
 
 Aws::String DescribeLoadBalancerPolicyTypesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeLoadBalancerPolicyTypes&";
   if(m_policyTypeNamesHasBeenSet)
   {
@@ -34,12 +35,12 @@ Aws::String DescribeLoadBalancerPolicyTypesRequest::SerializePayload() const
     for(auto& item : m_policyTypeNames)
     {
       ss << "PolicyTypeNames.member." << policyTypeNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       policyTypeNamesCount++;
     }
   }
 
   ss << "Version=2012-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeLoadBalancerPolicyTypesResult& DescribeLoadBalancerPolicyTypesResult::op
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeLoadBalancerPolicyTypesResult")
+  if (rootNode.GetNameView() != "DescribeLoadBalancerPolicyTypesResult")
   {
     resultNode = rootNode.FirstChild("DescribeLoadBalancerPolicyTypesResult");
   }
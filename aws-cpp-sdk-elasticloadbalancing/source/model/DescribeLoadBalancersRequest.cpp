@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancing/model/DescribeLoadBalancersRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancing::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ DescribeLoadBalancersRequest::DescribeLoadBalancersRequest() :
 
 Aws::String DescribeLoadBalancersRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeLoadBalancers&";
   if(m_loadBalancerNamesHasBeenSet)
   {
@@ -37,14 +38,14 @@ Aws::String DescribeLoadBalancersRequest::SerializePayload() const
     for(auto& item : m_loadBalancerNames)
     {
       ss << "LoadBalancerNames.member." << loadBalancerNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       loadBalancerNamesCount++;
     }
   }
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_pageSizeHasBeenSet)
@@ -53,6 +54,6 @@ Aws::String DescribeLoadBalancersRequest::SerializePayload() const
   }
 
   ss << "Version=2012-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
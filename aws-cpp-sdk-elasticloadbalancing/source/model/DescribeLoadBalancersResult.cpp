@@ -40,7 +40,7 @@ DescribeLoadBalancersResult& DescribeLoadBalancersResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeLoadBalancersResult")
+  if (rootNode.GetNameView() != "DescribeLoadBalancersResult")
   {
     resultNode = rootNode.FirstChild("DescribeLoadBalancersResult");
   }
@@ -61,7 +61,7 @@ DescribeLoadBalancersResult& DescribeLoadBalancersResult::operator =(const Amazo
     XmlNode nextMarkerNode = resultNode.FirstChild("NextMarker");
     if(!nextMarkerNode.IsNull())
     {
-      m_nextMarker = StringUtils::Trim(nextMarkerNode.GetText().c_str());
+      m_nextMarker = nextMarkerNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ DetachLoadBalancerFromSubnetsResult& DetachLoadBalancerFromSubnetsResult::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DetachLoadBalancerFromSubnetsResult")
+  if (rootNode.GetNameView() != "DetachLoadBalancerFromSubnetsResult")
   {
     resultNode = rootNode.FirstChild("DetachLoadBalancerFromSubnetsResult");
   }
@@ -53,7 +53,7 @@ DetachLoadBalancerFromSubnetsResult& DetachLoadBalancerFromSubnetsResult::operat
       XmlNode subnetsMember = subnetsNode.FirstChild("member");
       while(!subnetsMember.IsNull())
       {
-        m_subnets.push_back(StringUtils::Trim(subnetsMember.GetText().c_str()));
+        m_subnets.push_back(subnetsMember.GetTextView().Trim().ToString());
         subnetsMember = subnetsMember.NextNode("member");
       }
 
@@ -40,7 +40,7 @@ DisableAvailabilityZonesForLoadBalancerResult& DisableAvailabilityZonesForLoadBa
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DisableAvailabilityZonesForLoadBalancerResult")
+  if (rootNode.GetNameView() != "DisableAvailabilityZonesForLoadBalancerResult")
   {
     resultNode = rootNode.FirstChild("DisableAvailabilityZonesForLoadBalancerResult");
   }
@@ -53,7 +53,7 @@ DisableAvailabilityZonesForLoadBalancerResult& DisableAvailabilityZonesForLoadBa
       XmlNode availabilityZonesMember = availabilityZonesNode.FirstChild("member");
       while(!availabilityZonesMember.IsNull())
       {
-        m_availabilityZones.push_back(StringUtils::Trim(availabilityZonesMember.GetText().c_str()));
+        m_availabilityZones.push_back(availabilityZonesMember.GetTextView().Trim().ToString());
         availabilityZonesMember = availabilityZonesMember.NextNode("member");
       }
 
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancing/model/EnableAvailabilityZonesForLoadBalancerRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancing::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ EnableAvailabilityZonesForLoadBalancerRequest::EnableAvailabilityZonesForLoadBal
 
 Aws::String EnableAvailabilityZonesForLoadBalancerRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=EnableAvailabilityZonesForLoadBalancer&";
   if(m_loadBalancerNameHasBeenSet)
   {
-    ss << "LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+    ss << "LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
 
   if(m_availabilityZonesHasBeenSet)
@@ -40,12 +41,12 @@ Aws::String EnableAvailabilityZonesForLoadBalancerRequest::SerializePayload() co
     for(auto& item : m_availabilityZones)
     {
       ss << "AvailabilityZones.member." << availabilityZonesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       availabilityZonesCount++;
     }
   }
 
   ss << "Version=2012-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ EnableAvailabilityZonesForLoadBalancerResult& EnableAvailabilityZonesForLoadBala
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "EnableAvailabilityZonesForLoadBalancerResult")
+  if (rootNode.GetNameView() != "EnableAvailabilityZonesForLoadBalancerResult")
   {
     resultNode = rootNode.FirstChild("EnableAvailabilityZonesForLoadBalancerResult");
   }
@@ -53,7 +53,7 @@ EnableAvailabilityZonesForLoadBalancerResult& EnableAvailabilityZonesForLoadBala
       XmlNode availabilityZonesMember = availabilityZonesNode.FirstChild("member");
       while(!availabilityZonesMember.IsNull())
       {
-        m_availabilityZones.push_back(StringUtils::Trim(availabilityZonesMember.GetText().c_str()));
+        m_availabilityZones.push_back(availabilityZonesMember.GetTextView().Trim().ToString());
         availabilityZonesMember = availabilityZonesMember.NextNode("member");
       }
 
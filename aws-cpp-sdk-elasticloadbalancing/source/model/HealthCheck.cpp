@@ -65,31 +65,31 @@ HealthCheck& HealthCheck::operator =(const XmlNode& xmlNode)
     XmlNode targetNode = resultNode.FirstChild("Target");
     if(!targetNode.IsNull())
     {
-      m_target = StringUtils::Trim(targetNode.GetText().c_str());
+      m_target = targetNode.GetTextView().Trim().ToString();
       m_targetHasBeenSet = true;
     }
     XmlNode intervalNode = resultNode.FirstChild("Interval");
     if(!intervalNode.IsNull())
     {
-      m_interval = StringUtils::ConvertToInt32(StringUtils::Trim(intervalNode.GetText().c_str()).c_str());
+      m_interval = StringUtils::ConvertToInt32(intervalNode.GetTextView().Trim().ToString().c_str());
       m_intervalHasBeenSet = true;
     }
     XmlNode timeoutNode = resultNode.FirstChild("Timeout");
     if(!timeoutNode.IsNull())
     {
-      m_timeout = StringUtils::ConvertToInt32(StringUtils::Trim(timeoutNode.GetText().c_str()).c_str());
+      m_timeout = StringUtils::ConvertToInt32(timeoutNode.GetTextView().Trim().ToString().c_str());
       m_timeoutHasBeenSet = true;
     }
     XmlNode unhealthyThresholdNode = resultNode.FirstChild("UnhealthyThreshold");
     if(!unhealthyThresholdNode.IsNull())
     {
-      m_unhealthyThreshold = StringUtils::ConvertToInt32(StringUtils::Trim(unhealthyThresholdNode.GetText().c_str()).c_str());
+      m_unhealthyThreshold = StringUtils::ConvertToInt32(unhealthyThresholdNode.GetTextView().Trim().ToString().c_str());
       m_unhealthyThresholdHasBeenSet = true;
     }
     XmlNode healthyThresholdNode = resultNode.FirstChild("HealthyThreshold");
     if(!healthyThresholdNode.IsNull())
     {
-      m_healthyThreshold = StringUtils::ConvertToInt32(StringUtils::Trim(healthyThresholdNode.GetText().c_str()).c_str());
+      m_healthyThreshold = StringUtils::ConvertToInt32(healthyThresholdNode.GetTextView().Trim().ToString().c_str());
       m_healthyThresholdHasBeenSet = true;
     }
   }
@@ -101,7 +101,7 @@ void HealthCheck::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_targetHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Target=" << StringUtils::URLEncode(m_target.c_str()) << "&";
+      oStream << location << index << locationValue << ".Target=" << StringUtils::URLEncoded(m_target) << "&";
   }
 
   if(m_intervalHasBeenSet)
@@ -130,7 +130,7 @@ void HealthCheck::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_targetHasBeenSet)
   {
-      oStream << location << ".Target=" << StringUtils::URLEncode(m_target.c_str()) << "&";
+      oStream << location << ".Target=" << StringUtils::URLEncoded(m_target) << "&";
   }
   if(m_intervalHasBeenSet)
   {
@@ -55,25 +55,25 @@ InstanceState& InstanceState::operator =(const XmlNode& xmlNode)
     XmlNode instanceIdNode = resultNode.FirstChild("InstanceId");
     if(!instanceIdNode.IsNull())
     {
-      m_instanceId = StringUtils::Trim(instanceIdNode.GetText().c_str());
+      m_instanceId = instanceIdNode.GetTextView().Trim().ToString();
       m_instanceIdHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("State");
     if(!stateNode.IsNull())
     {
-      m_state = StringUtils::Trim(stateNode.GetText().c_str());
+      m_state = stateNode.GetTextView().Trim().ToString();
       m_stateHasBeenSet = true;
     }
     XmlNode reasonCodeNode = resultNode.FirstChild("ReasonCode");
     if(!reasonCodeNode.IsNull())
     {
-      m_reasonCode = StringUtils::Trim(reasonCodeNode.GetText().c_str());
+      m_reasonCode = reasonCodeNode.GetTextView().Trim().ToString();
       m_reasonCodeHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
   }
@@ -85,22 +85,22 @@ void InstanceState::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
 
   if(m_stateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".State=" << StringUtils::URLEncode(m_state.c_str()) << "&";
+      oStream << location << index << locationValue << ".State=" << StringUtils::URLEncoded(m_state) << "&";
   }
 
   if(m_reasonCodeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReasonCode=" << StringUtils::URLEncode(m_reasonCode.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReasonCode=" << StringUtils::URLEncoded(m_reasonCode) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
 }
@@ -109,19 +109,19 @@ void InstanceState::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_instanceIdHasBeenSet)
   {
-      oStream << location << ".InstanceId=" << StringUtils::URLEncode(m_instanceId.c_str()) << "&";
+      oStream << location << ".InstanceId=" << StringUtils::URLEncoded(m_instanceId) << "&";
   }
   if(m_stateHasBeenSet)
   {
-      oStream << location << ".State=" << StringUtils::URLEncode(m_state.c_str()) << "&";
+      oStream << location << ".State=" << StringUtils::URLEncoded(m_state) << "&";
   }
   if(m_reasonCodeHasBeenSet)
   {
-      oStream << location << ".ReasonCode=" << StringUtils::URLEncode(m_reasonCode.c_str()) << "&";
+      oStream << location << ".ReasonCode=" << StringUtils::URLEncoded(m_reasonCode) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 }
 
@@ -53,13 +53,13 @@ LBCookieStickinessPolicy& LBCookieStickinessPolicy::operator =(const XmlNode& xm
     XmlNode policyNameNode = resultNode.FirstChild("PolicyName");
     if(!policyNameNode.IsNull())
     {
-      m_policyName = StringUtils::Trim(policyNameNode.GetText().c_str());
+      m_policyName = policyNameNode.GetTextView().Trim().ToString();
       m_policyNameHasBeenSet = true;
     }
     XmlNode cookieExpirationPeriodNode = resultNode.FirstChild("CookieExpirationPeriod");
     if(!cookieExpirationPeriodNode.IsNull())
     {
-      m_cookieExpirationPeriod = StringUtils::ConvertToInt64(StringUtils::Trim(cookieExpirationPeriodNode.GetText().c_str()).c_str());
+      m_cookieExpirationPeriod = StringUtils::ConvertToInt64(cookieExpirationPeriodNode.GetTextView().Trim().ToString().c_str());
       m_cookieExpirationPeriodHasBeenSet = true;
     }
   }
@@ -71,7 +71,7 @@ void LBCookieStickinessPolicy::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_policyNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
 
   if(m_cookieExpirationPeriodHasBeenSet)
@@ -85,7 +85,7 @@ void LBCookieStickinessPolicy::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_policyNameHasBeenSet)
   {
-      oStream << location << ".PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+      oStream << location << ".PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
   if(m_cookieExpirationPeriodHasBeenSet)
   {
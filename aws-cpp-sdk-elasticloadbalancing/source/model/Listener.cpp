@@ -61,31 +61,31 @@ Listener& Listener::operator =(const XmlNode& xmlNode)
     XmlNode protocolNode = resultNode.FirstChild("Protocol");
     if(!protocolNode.IsNull())
     {
-      m_protocol = StringUtils::Trim(protocolNode.GetText().c_str());
+      m_protocol = protocolNode.GetTextView().Trim().ToString();
       m_protocolHasBeenSet = true;
     }
     XmlNode loadBalancerPortNode = resultNode.FirstChild("LoadBalancerPort");
     if(!loadBalancerPortNode.IsNull())
     {
-      m_loadBalancerPort = StringUtils::ConvertToInt32(StringUtils::Trim(loadBalancerPortNode.GetText().c_str()).c_str());
+      m_loadBalancerPort = StringUtils::ConvertToInt32(loadBalancerPortNode.GetTextView().Trim().ToString().c_str());
       m_loadBalancerPortHasBeenSet = true;
     }
     XmlNode instanceProtocolNode = resultNode.FirstChild("InstanceProtocol");
     if(!instanceProtocolNode.IsNull())
     {
-      m_instanceProtocol = StringUtils::Trim(instanceProtocolNode.GetText().c_str());
+      m_instanceProtocol = instanceProtocolNode.GetTextView().Trim().ToString();
       m_instanceProtocolHasBeenSet = true;
     }
     XmlNode instancePortNode = resultNode.FirstChild("InstancePort");
     if(!instancePortNode.IsNull())
     {
-      m_instancePort = StringUtils::ConvertToInt32(StringUtils::Trim(instancePortNode.GetText().c_str()).c_str());
+      m_instancePort = StringUtils::ConvertToInt32(instancePortNode.GetTextView().Trim().ToString().c_str());
       m_instancePortHasBeenSet = true;
     }
     XmlNode sSLCertificateIdNode = resultNode.FirstChild("SSLCertificateId");
     if(!sSLCertificateIdNode.IsNull())
     {
-      m_sSLCertificateId = StringUtils::Trim(sSLCertificateIdNode.GetText().c_str());
+      m_sSLCertificateId = sSLCertificateIdNode.GetTextView().Trim().ToString();
       m_sSLCertificateIdHasBeenSet = true;
     }
   }
@@ -97,7 +97,7 @@ void Listener::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 {
   if(m_protocolHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Protocol=" << StringUtils::URLEncode(m_protocol.c_str()) << "&";
+      oStream << location << index << locationValue << ".Protocol=" << StringUtils::URLEncoded(m_protocol) << "&";
   }
 
   if(m_loadBalancerPortHasBeenSet)
@@ -107,7 +107,7 @@ void Listener::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_instanceProtocolHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceProtocol=" << StringUtils::URLEncode(m_instanceProtocol.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceProtocol=" << StringUtils::URLEncoded(m_instanceProtocol) << "&";
   }
 
   if(m_instancePortHasBeenSet)
@@ -117,7 +117,7 @@ void Listener::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_sSLCertificateIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SSLCertificateId=" << StringUtils::URLEncode(m_sSLCertificateId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SSLCertificateId=" << StringUtils::URLEncoded(m_sSLCertificateId) << "&";
   }
 
 }
@@ -126,7 +126,7 @@ void Listener::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_protocolHasBeenSet)
   {
-      oStream << location << ".Protocol=" << StringUtils::URLEncode(m_protocol.c_str()) << "&";
+      oStream << location << ".Protocol=" << StringUtils::URLEncoded(m_protocol) << "&";
   }
   if(m_loadBalancerPortHasBeenSet)
   {
@@ -134,7 +134,7 @@ void Listener::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_instanceProtocolHasBeenSet)
   {
-      oStream << location << ".InstanceProtocol=" << StringUtils::URLEncode(m_instanceProtocol.c_str()) << "&";
+      oStream << location << ".InstanceProtocol=" << StringUtils::URLEncoded(m_instanceProtocol) << "&";
   }
   if(m_instancePortHasBeenSet)
   {
@@ -142,7 +142,7 @@ void Listener::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_sSLCertificateIdHasBeenSet)
   {
-      oStream << location << ".SSLCertificateId=" << StringUtils::URLEncode(m_sSLCertificateId.c_str()) << "&";
+      oStream << location << ".SSLCertificateId=" << StringUtils::URLEncoded(m_sSLCertificateId) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -60,7 +61,7 @@ ListenerDescription& ListenerDescription::operator =(const XmlNode& xmlNode)
       XmlNode policyNamesMember = policyNamesNode.FirstChild("member");
       while(!policyNamesMember.IsNull())
       {
-        m_policyNames.push_back(StringUtils::Trim(policyNamesMember.GetText().c_str()));
+        m_policyNames.push_back(policyNamesMember.GetTextView().Trim().ToString());
         policyNamesMember = policyNamesMember.NextNode("member");
       }
 
@@ -75,9 +76,9 @@ void ListenerDescription::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_listenerHasBeenSet)
   {
-      Aws::StringStream listenerLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream listenerLocationAndMemberSs;
       listenerLocationAndMemberSs << location << index << locationValue << ".Listener";
-      m_listener.OutputToStream(oStream, listenerLocationAndMemberSs.str().c_str());
+      m_listener.OutputToStream(oStream, listenerLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_policyNamesHasBeenSet)
@@ -85,7 +86,7 @@ void ListenerDescription::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned policyNamesIdx = 1;
       for(auto& item : m_policyNames)
       {
-        oStream << location << index << locationValue << ".PolicyNames.member." << policyNamesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".PolicyNames.member." << policyNamesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -104,7 +105,7 @@ void ListenerDescription::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned policyNamesIdx = 1;
       for(auto& item : m_policyNames)
       {
-        oStream << location << ".PolicyNames.member." << policyNamesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".PolicyNames.member." << policyNamesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
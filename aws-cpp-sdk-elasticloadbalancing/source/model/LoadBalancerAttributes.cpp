@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -99,30 +100,30 @@ void LoadBalancerAttributes::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_crossZoneLoadBalancingHasBeenSet)
   {
-      Aws::StringStream crossZoneLoadBalancingLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream crossZoneLoadBalancingLocationAndMemberSs;
       crossZoneLoadBalancingLocationAndMemberSs << location << index << locationValue << ".CrossZoneLoadBalancing";
-      m_crossZoneLoadBalancing.OutputToStream(oStream, crossZoneLoadBalancingLocationAndMemberSs.str().c_str());
+      m_crossZoneLoadBalancing.OutputToStream(oStream, crossZoneLoadBalancingLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_accessLogHasBeenSet)
   {
-      Aws::StringStream accessLogLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream accessLogLocationAndMemberSs;
       accessLogLocationAndMemberSs << location << index << locationValue << ".AccessLog";
-      m_accessLog.OutputToStream(oStream, accessLogLocationAndMemberSs.str().c_str());
+      m_accessLog.OutputToStream(oStream, accessLogLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_connectionDrainingHasBeenSet)
   {
-      Aws::StringStream connectionDrainingLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream connectionDrainingLocationAndMemberSs;
       connectionDrainingLocationAndMemberSs << location << index << locationValue << ".ConnectionDraining";
-      m_connectionDraining.OutputToStream(oStream, connectionDrainingLocationAndMemberSs.str().c_str());
+      m_connectionDraining.OutputToStream(oStream, connectionDrainingLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_connectionSettingsHasBeenSet)
   {
-      Aws::StringStream connectionSettingsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream connectionSettingsLocationAndMemberSs;
       connectionSettingsLocationAndMemberSs << location << index << locationValue << ".ConnectionSettings";
-      m_connectionSettings.OutputToStream(oStream, connectionSettingsLocationAndMemberSs.str().c_str());
+      m_connectionSettings.OutputToStream(oStream, connectionSettingsLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_additionalAttributesHasBeenSet)
@@ -130,9 +131,9 @@ void LoadBalancerAttributes::OutputToStream(Aws::OStream& oStream, const char* l
       unsigned additionalAttributesIdx = 1;
       for(auto& item : m_additionalAttributes)
       {
-        Aws::StringStream additionalAttributesSs;
+        Aws::Utils::Stream::StringOutputStream additionalAttributesSs;
         additionalAttributesSs << location << index << locationValue << ".AdditionalAttributes.member." << additionalAttributesIdx++;
-        item.OutputToStream(oStream, additionalAttributesSs.str().c_str());
+        item.OutputToStream(oStream, additionalAttributesSs.GetString().c_str());
       }
   }
 
@@ -169,9 +170,9 @@ void LoadBalancerAttributes::OutputToStream(Aws::OStream& oStream, const char* l
       unsigned additionalAttributesIdx = 1;
       for(auto& item : m_additionalAttributes)
       {
-        Aws::StringStream additionalAttributesSs;
+        Aws::Utils::Stream::StringOutputStream additionalAttributesSs;
         additionalAttributesSs << location <<  ".AdditionalAttributes.member." << additionalAttributesIdx++;
-        item.OutputToStream(oStream, additionalAttributesSs.str().c_str());
+        item.OutputToStream(oStream, additionalAttributesSs.GetString().c_str());
       }
   }
 }
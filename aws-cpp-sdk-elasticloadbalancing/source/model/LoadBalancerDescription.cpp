@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -79,25 +80,25 @@ LoadBalancerDescription& LoadBalancerDescription::operator =(const XmlNode& xmlN
     XmlNode loadBalancerNameNode = resultNode.FirstChild("LoadBalancerName");
     if(!loadBalancerNameNode.IsNull())
     {
-      m_loadBalancerName = StringUtils::Trim(loadBalancerNameNode.GetText().c_str());
+      m_loadBalancerName = loadBalancerNameNode.GetTextView().Trim().ToString();
       m_loadBalancerNameHasBeenSet = true;
     }
     XmlNode dNSNameNode = resultNode.FirstChild("DNSName");
     if(!dNSNameNode.IsNull())
     {
-      m_dNSName = StringUtils::Trim(dNSNameNode.GetText().c_str());
+      m_dNSName = dNSNameNode.GetTextView().Trim().ToString();
       m_dNSNameHasBeenSet = true;
     }
     XmlNode canonicalHostedZoneNameNode = resultNode.FirstChild("CanonicalHostedZoneName");
     if(!canonicalHostedZoneNameNode.IsNull())
     {
-      m_canonicalHostedZoneName = StringUtils::Trim(canonicalHostedZoneNameNode.GetText().c_str());
+      m_canonicalHostedZoneName = canonicalHostedZoneNameNode.GetTextView().Trim().ToString();
       m_canonicalHostedZoneNameHasBeenSet = true;
     }
     XmlNode canonicalHostedZoneNameIDNode = resultNode.FirstChild("CanonicalHostedZoneNameID");
     if(!canonicalHostedZoneNameIDNode.IsNull())
     {
-      m_canonicalHostedZoneNameID = StringUtils::Trim(canonicalHostedZoneNameIDNode.GetText().c_str());
+      m_canonicalHostedZoneNameID = canonicalHostedZoneNameIDNode.GetTextView().Trim().ToString();
       m_canonicalHostedZoneNameIDHasBeenSet = true;
     }
     XmlNode listenerDescriptionsNode = resultNode.FirstChild("ListenerDescriptions");
@@ -136,7 +137,7 @@ LoadBalancerDescription& LoadBalancerDescription::operator =(const XmlNode& xmlN
       XmlNode availabilityZonesMember = availabilityZonesNode.FirstChild("member");
       while(!availabilityZonesMember.IsNull())
       {
-        m_availabilityZones.push_back(StringUtils::Trim(availabilityZonesMember.GetText().c_str()));
+        m_availabilityZones.push_back(availabilityZonesMember.GetTextView().Trim().ToString());
         availabilityZonesMember = availabilityZonesMember.NextNode("member");
       }
 
@@ -148,7 +149,7 @@ LoadBalancerDescription& LoadBalancerDescription::operator =(const XmlNode& xmlN
       XmlNode subnetsMember = subnetsNode.FirstChild("member");
       while(!subnetsMember.IsNull())
       {
-        m_subnets.push_back(StringUtils::Trim(subnetsMember.GetText().c_str()));
+        m_subnets.push_back(subnetsMember.GetTextView().Trim().ToString());
         subnetsMember = subnetsMember.NextNode("member");
       }
 
@@ -157,7 +158,7 @@ LoadBalancerDescription& LoadBalancerDescription::operator =(const XmlNode& xmlN
     XmlNode vPCIdNode = resultNode.FirstChild("VPCId");
     if(!vPCIdNode.IsNull())
     {
-      m_vPCId = StringUtils::Trim(vPCIdNode.GetText().c_str());
+      m_vPCId = vPCIdNode.GetTextView().Trim().ToString();
       m_vPCIdHasBeenSet = true;
     }
     XmlNode instancesNode = resultNode.FirstChild("Instances");
@@ -190,7 +191,7 @@ LoadBalancerDescription& LoadBalancerDescription::operator =(const XmlNode& xmlN
       XmlNode securityGroupsMember = securityGroupsNode.FirstChild("member");
       while(!securityGroupsMember.IsNull())
       {
-        m_securityGroups.push_back(StringUtils::Trim(securityGroupsMember.GetText().c_str()));
+        m_securityGroups.push_back(securityGroupsMember.GetTextView().Trim().ToString());
         securityGroupsMember = securityGroupsMember.NextNode("member");
       }
 
@@ -199,13 +200,13 @@ LoadBalancerDescription& LoadBalancerDescription::operator =(const XmlNode& xmlN
     XmlNode createdTimeNode = resultNode.FirstChild("CreatedTime");
     if(!createdTimeNode.IsNull())
     {
-      m_createdTime = DateTime(StringUtils::Trim(createdTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createdTime = DateTime(createdTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createdTimeHasBeenSet = true;
     }
     XmlNode schemeNode = resultNode.FirstChild("Scheme");
     if(!schemeNode.IsNull())
     {
-      m_scheme = StringUtils::Trim(schemeNode.GetText().c_str());
+      m_scheme = schemeNode.GetTextView().Trim().ToString();
       m_schemeHasBeenSet = true;
     }
   }
@@ -217,22 +218,22 @@ void LoadBalancerDescription::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_loadBalancerNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+      oStream << location << index << locationValue << ".LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
 
   if(m_dNSNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DNSName=" << StringUtils::URLEncode(m_dNSName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DNSName=" << StringUtils::URLEncoded(m_dNSName) << "&";
   }
 
   if(m_canonicalHostedZoneNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CanonicalHostedZoneName=" << StringUtils::URLEncode(m_canonicalHostedZoneName.c_str()) << "&";
+      oStream << location << index << locationValue << ".CanonicalHostedZoneName=" << StringUtils::URLEncoded(m_canonicalHostedZoneName) << "&";
   }
 
   if(m_canonicalHostedZoneNameIDHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CanonicalHostedZoneNameID=" << StringUtils::URLEncode(m_canonicalHostedZoneNameID.c_str()) << "&";
+      oStream << location << index << locationValue << ".CanonicalHostedZoneNameID=" << StringUtils::URLEncoded(m_canonicalHostedZoneNameID) << "&";
   }
 
   if(m_listenerDescriptionsHasBeenSet)
@@ -240,17 +241,17 @@ void LoadBalancerDescription::OutputToStream(Aws::OStream& oStream, const char*
       unsigned listenerDescriptionsIdx = 1;
       for(auto& item : m_listenerDescriptions)
       {
-        Aws::StringStream listenerDescriptionsSs;
+        Aws::Utils::Stream::StringOutputStream listenerDescriptionsSs;
         listenerDescriptionsSs << location << index << locationValue << ".ListenerDescriptions.member." << listenerDescriptionsIdx++;
-        item.OutputToStream(oStream, listenerDescriptionsSs.str().c_str());
+        item.OutputToStream(oStream, listenerDescriptionsSs.GetString().c_str());
       }
   }
 
   if(m_policiesHasBeenSet)
   {
-      Aws::StringStream policiesLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream policiesLocationAndMemberSs;
       policiesLocationAndMemberSs << location << index << locationValue << ".Policies";
-      m_policies.OutputToStream(oStream, policiesLocationAndMemberSs.str().c_str());
+      m_policies.OutputToStream(oStream, policiesLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_backendServerDescriptionsHasBeenSet)
@@ -258,9 +259,9 @@ void LoadBalancerDescription::OutputToStream(Aws::OStream& oStream, const char*
       unsigned backendServerDescriptionsIdx = 1;
       for(auto& item : m_backendServerDescriptions)
       {
-        Aws::StringStream backendServerDescriptionsSs;
+        Aws::Utils::Stream::StringOutputStream backendServerDescriptionsSs;
         backendServerDescriptionsSs << location << index << locationValue << ".BackendServerDescriptions.member." << backendServerDescriptionsIdx++;
-        item.OutputToStream(oStream, backendServerDescriptionsSs.str().c_str());
+        item.OutputToStream(oStream, backendServerDescriptionsSs.GetString().c_str());
       }
   }
 
@@ -269,7 +270,7 @@ void LoadBalancerDescription::OutputToStream(Aws::OStream& oStream, const char*
       unsigned availabilityZonesIdx = 1;
       for(auto& item : m_availabilityZones)
       {
-        oStream << location << index << locationValue << ".AvailabilityZones.member." << availabilityZonesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".AvailabilityZones.member." << availabilityZonesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -278,13 +279,13 @@ void LoadBalancerDescription::OutputToStream(Aws::OStream& oStream, const char*
       unsigned subnetsIdx = 1;
       for(auto& item : m_subnets)
       {
-        oStream << location << index << locationValue << ".Subnets.member." << subnetsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".Subnets.member." << subnetsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
   if(m_vPCIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VPCId=" << StringUtils::URLEncode(m_vPCId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VPCId=" << StringUtils::URLEncoded(m_vPCId) << "&";
   }
 
   if(m_instancesHasBeenSet)
@@ -292,24 +293,24 @@ void LoadBalancerDescription::OutputToStream(Aws::OStream& oStream, const char*
       unsigned instancesIdx = 1;
       for(auto& item : m_instances)
       {
-        Aws::StringStream instancesSs;
+        Aws::Utils::Stream::StringOutputStream instancesSs;
         instancesSs << location << index << locationValue << ".Instances.member." << instancesIdx++;
-        item.OutputToStream(oStream, instancesSs.str().c_str());
+        item.OutputToStream(oStream, instancesSs.GetString().c_str());
       }
   }
 
   if(m_healthCheckHasBeenSet)
   {
-      Aws::StringStream healthCheckLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream healthCheckLocationAndMemberSs;
       healthCheckLocationAndMemberSs << location << index << locationValue << ".HealthCheck";
-      m_healthCheck.OutputToStream(oStream, healthCheckLocationAndMemberSs.str().c_str());
+      m_healthCheck.OutputToStream(oStream, healthCheckLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_sourceSecurityGroupHasBeenSet)
   {
-      Aws::StringStream sourceSecurityGroupLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream sourceSecurityGroupLocationAndMemberSs;
       sourceSecurityGroupLocationAndMemberSs << location << index << locationValue << ".SourceSecurityGroup";
-      m_sourceSecurityGroup.OutputToStream(oStream, sourceSecurityGroupLocationAndMemberSs.str().c_str());
+      m_sourceSecurityGroup.OutputToStream(oStream, sourceSecurityGroupLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_securityGroupsHasBeenSet)
@@ -317,18 +318,18 @@ void LoadBalancerDescription::OutputToStream(Aws::OStream& oStream, const char*
       unsigned securityGroupsIdx = 1;
       for(auto& item : m_securityGroups)
       {
-        oStream << location << index << locationValue << ".SecurityGroups.member." << securityGroupsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".SecurityGroups.member." << securityGroupsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
   if(m_createdTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreatedTime=" << StringUtils::URLEncode(m_createdTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreatedTime=" << StringUtils::URLEncoded(m_createdTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_schemeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Scheme=" << StringUtils::URLEncode(m_scheme.c_str()) << "&";
+      oStream << location << index << locationValue << ".Scheme=" << StringUtils::URLEncoded(m_scheme) << "&";
   }
 
 }
@@ -337,28 +338,28 @@ void LoadBalancerDescription::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_loadBalancerNameHasBeenSet)
   {
-      oStream << location << ".LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+      oStream << location << ".LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
   if(m_dNSNameHasBeenSet)
   {
-      oStream << location << ".DNSName=" << StringUtils::URLEncode(m_dNSName.c_str()) << "&";
+      oStream << location << ".DNSName=" << StringUtils::URLEncoded(m_dNSName) << "&";
   }
   if(m_canonicalHostedZoneNameHasBeenSet)
   {
-      oStream << location << ".CanonicalHostedZoneName=" << StringUtils::URLEncode(m_canonicalHostedZoneName.c_str()) << "&";
+      oStream << location << ".CanonicalHostedZoneName=" << StringUtils::URLEncoded(m_canonicalHostedZoneName) << "&";
   }
   if(m_canonicalHostedZoneNameIDHasBeenSet)
   {
-      oStream << location << ".CanonicalHostedZoneNameID=" << StringUtils::URLEncode(m_canonicalHostedZoneNameID.c_str()) << "&";
+      oStream << location << ".CanonicalHostedZoneNameID=" << StringUtils::URLEncoded(m_canonicalHostedZoneNameID) << "&";
   }
   if(m_listenerDescriptionsHasBeenSet)
   {
       unsigned listenerDescriptionsIdx = 1;
       for(auto& item : m_listenerDescriptions)
       {
-        Aws::StringStream listenerDescriptionsSs;
+        Aws::Utils::Stream::StringOutputStream listenerDescriptionsSs;
         listenerDescriptionsSs << location <<  ".ListenerDescriptions.member." << listenerDescriptionsIdx++;
-        item.OutputToStream(oStream, listenerDescriptionsSs.str().c_str());
+        item.OutputToStream(oStream, listenerDescriptionsSs.GetString().c_str());
       }
   }
   if(m_policiesHasBeenSet)
@@ -372,9 +373,9 @@ void LoadBalancerDescription::OutputToStream(Aws::OStream& oStream, const char*
       unsigned backendServerDescriptionsIdx = 1;
       for(auto& item : m_backendServerDescriptions)
       {
-        Aws::StringStream backendServerDescriptionsSs;
+        Aws::Utils::Stream::StringOutputStream backendServerDescriptionsSs;
         backendServerDescriptionsSs << location <<  ".BackendServerDescriptions.member." << backendServerDescriptionsIdx++;
-        item.OutputToStream(oStream, backendServerDescriptionsSs.str().c_str());
+        item.OutputToStream(oStream, backendServerDescriptionsSs.GetString().c_str());
       }
   }
   if(m_availabilityZonesHasBeenSet)
@@ -382,7 +383,7 @@ void LoadBalancerDescription::OutputToStream(Aws::OStream& oStream, const char*
       unsigned availabilityZonesIdx = 1;
       for(auto& item : m_availabilityZones)
       {
-        oStream << location << ".AvailabilityZones.member." << availabilityZonesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".AvailabilityZones.member." << availabilityZonesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_subnetsHasBeenSet)
@@ -390,21 +391,21 @@ void LoadBalancerDescription::OutputToStream(Aws::OStream& oStream, const char*
       unsigned subnetsIdx = 1;
       for(auto& item : m_subnets)
       {
-        oStream << location << ".Subnets.member." << subnetsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".Subnets.member." << subnetsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_vPCIdHasBeenSet)
   {
-      oStream << location << ".VPCId=" << StringUtils::URLEncode(m_vPCId.c_str()) << "&";
+      oStream << location << ".VPCId=" << StringUtils::URLEncoded(m_vPCId) << "&";
   }
   if(m_instancesHasBeenSet)
   {
       unsigned instancesIdx = 1;
       for(auto& item : m_instances)
       {
-        Aws::StringStream instancesSs;
+        Aws::Utils::Stream::StringOutputStream instancesSs;
         instancesSs << location <<  ".Instances.member." << instancesIdx++;
-        item.OutputToStream(oStream, instancesSs.str().c_str());
+        item.OutputToStream(oStream, instancesSs.GetString().c_str());
       }
   }
   if(m_healthCheckHasBeenSet)
@@ -424,16 +425,16 @@ void LoadBalancerDescription::OutputToStream(Aws::OStream& oStream, const char*
       unsigned securityGroupsIdx = 1;
       for(auto& item : m_securityGroups)
       {
-        oStream << location << ".SecurityGroups.member." << securityGroupsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".SecurityGroups.member." << securityGroupsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_createdTimeHasBeenSet)
   {
-      oStream << location << ".CreatedTime=" << StringUtils::URLEncode(m_createdTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreatedTime=" << StringUtils::URLEncoded(m_createdTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_schemeHasBeenSet)
   {
-      oStream << location << ".Scheme=" << StringUtils::URLEncode(m_scheme.c_str()) << "&";
+      oStream << location << ".Scheme=" << StringUtils::URLEncoded(m_scheme) << "&";
   }
 }
 
@@ -40,7 +40,7 @@ ModifyLoadBalancerAttributesResult& ModifyLoadBalancerAttributesResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyLoadBalancerAttributesResult")
+  if (rootNode.GetNameView() != "ModifyLoadBalancerAttributesResult")
   {
     resultNode = rootNode.FirstChild("ModifyLoadBalancerAttributesResult");
   }
@@ -50,7 +50,7 @@ ModifyLoadBalancerAttributesResult& ModifyLoadBalancerAttributesResult::operator
     XmlNode loadBalancerNameNode = resultNode.FirstChild("LoadBalancerName");
     if(!loadBalancerNameNode.IsNull())
     {
-      m_loadBalancerName = StringUtils::Trim(loadBalancerNameNode.GetText().c_str());
+      m_loadBalancerName = loadBalancerNameNode.GetTextView().Trim().ToString();
     }
     XmlNode loadBalancerAttributesNode = resultNode.FirstChild("LoadBalancerAttributes");
     if(!loadBalancerAttributesNode.IsNull())
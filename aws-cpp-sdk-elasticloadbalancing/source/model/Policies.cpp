@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -80,7 +81,7 @@ Policies& Policies::operator =(const XmlNode& xmlNode)
       XmlNode otherPoliciesMember = otherPoliciesNode.FirstChild("member");
       while(!otherPoliciesMember.IsNull())
       {
-        m_otherPolicies.push_back(StringUtils::Trim(otherPoliciesMember.GetText().c_str()));
+        m_otherPolicies.push_back(otherPoliciesMember.GetTextView().Trim().ToString());
         otherPoliciesMember = otherPoliciesMember.NextNode("member");
       }
 
@@ -98,9 +99,9 @@ void Policies::OutputToStream(Aws::OStream& oStream, const char* location, unsig
       unsigned appCookieStickinessPoliciesIdx = 1;
       for(auto& item : m_appCookieStickinessPolicies)
       {
-        Aws::StringStream appCookieStickinessPoliciesSs;
+        Aws::Utils::Stream::StringOutputStream appCookieStickinessPoliciesSs;
         appCookieStickinessPoliciesSs << location << index << locationValue << ".AppCookieStickinessPolicies.member." << appCookieStickinessPoliciesIdx++;
-        item.OutputToStream(oStream, appCookieStickinessPoliciesSs.str().c_str());
+        item.OutputToStream(oStream, appCookieStickinessPoliciesSs.GetString().c_str());
       }
   }
 
@@ -109,9 +110,9 @@ void Policies::OutputToStream(Aws::OStream& oStream, const char* location, unsig
       unsigned lBCookieStickinessPoliciesIdx = 1;
       for(auto& item : m_lBCookieStickinessPolicies)
       {
-        Aws::StringStream lBCookieStickinessPoliciesSs;
+        Aws::Utils::Stream::StringOutputStream lBCookieStickinessPoliciesSs;
         lBCookieStickinessPoliciesSs << location << index << locationValue << ".LBCookieStickinessPolicies.member." << lBCookieStickinessPoliciesIdx++;
-        item.OutputToStream(oStream, lBCookieStickinessPoliciesSs.str().c_str());
+        item.OutputToStream(oStream, lBCookieStickinessPoliciesSs.GetString().c_str());
       }
   }
 
@@ -120,7 +121,7 @@ void Policies::OutputToStream(Aws::OStream& oStream, const char* location, unsig
       unsigned otherPoliciesIdx = 1;
       for(auto& item : m_otherPolicies)
       {
-        oStream << location << index << locationValue << ".OtherPolicies.member." << otherPoliciesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".OtherPolicies.member." << otherPoliciesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -133,9 +134,9 @@ void Policies::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned appCookieStickinessPoliciesIdx = 1;
       for(auto& item : m_appCookieStickinessPolicies)
       {
-        Aws::StringStream appCookieStickinessPoliciesSs;
+        Aws::Utils::Stream::StringOutputStream appCookieStickinessPoliciesSs;
         appCookieStickinessPoliciesSs << location <<  ".AppCookieStickinessPolicies.member." << appCookieStickinessPoliciesIdx++;
-        item.OutputToStream(oStream, appCookieStickinessPoliciesSs.str().c_str());
+        item.OutputToStream(oStream, appCookieStickinessPoliciesSs.GetString().c_str());
       }
   }
   if(m_lBCookieStickinessPoliciesHasBeenSet)
@@ -143,9 +144,9 @@ void Policies::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned lBCookieStickinessPoliciesIdx = 1;
       for(auto& item : m_lBCookieStickinessPolicies)
       {
-        Aws::StringStream lBCookieStickinessPoliciesSs;
+        Aws::Utils::Stream::StringOutputStream lBCookieStickinessPoliciesSs;
         lBCookieStickinessPoliciesSs << location <<  ".LBCookieStickinessPolicies.member." << lBCookieStickinessPoliciesIdx++;
-        item.OutputToStream(oStream, lBCookieStickinessPoliciesSs.str().c_str());
+        item.OutputToStream(oStream, lBCookieStickinessPoliciesSs.GetString().c_str());
       }
   }
   if(m_otherPoliciesHasBeenSet)
@@ -153,7 +154,7 @@ void Policies::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned otherPoliciesIdx = 1;
       for(auto& item : m_otherPolicies)
       {
-        oStream << location << ".OtherPolicies.member." << otherPoliciesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".OtherPolicies.member." << otherPoliciesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
@@ -51,13 +51,13 @@ PolicyAttribute& PolicyAttribute::operator =(const XmlNode& xmlNode)
     XmlNode attributeNameNode = resultNode.FirstChild("AttributeName");
     if(!attributeNameNode.IsNull())
     {
-      m_attributeName = StringUtils::Trim(attributeNameNode.GetText().c_str());
+      m_attributeName = attributeNameNode.GetTextView().Trim().ToString();
       m_attributeNameHasBeenSet = true;
     }
     XmlNode attributeValueNode = resultNode.FirstChild("AttributeValue");
     if(!attributeValueNode.IsNull())
     {
-      m_attributeValue = StringUtils::Trim(attributeValueNode.GetText().c_str());
+      m_attributeValue = attributeValueNode.GetTextView().Trim().ToString();
       m_attributeValueHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void PolicyAttribute::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_attributeNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AttributeName=" << StringUtils::URLEncode(m_attributeName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AttributeName=" << StringUtils::URLEncoded(m_attributeName) << "&";
   }
 
   if(m_attributeValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AttributeValue=" << StringUtils::URLEncode(m_attributeValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".AttributeValue=" << StringUtils::URLEncoded(m_attributeValue) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void PolicyAttribute::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_attributeNameHasBeenSet)
   {
-      oStream << location << ".AttributeName=" << StringUtils::URLEncode(m_attributeName.c_str()) << "&";
+      oStream << location << ".AttributeName=" << StringUtils::URLEncoded(m_attributeName) << "&";
   }
   if(m_attributeValueHasBeenSet)
   {
-      oStream << location << ".AttributeValue=" << StringUtils::URLEncode(m_attributeValue.c_str()) << "&";
+      oStream << location << ".AttributeValue=" << StringUtils::URLEncoded(m_attributeValue) << "&";
   }
 }
 
@@ -57,31 +57,31 @@ PolicyAttributeTypeDescription& PolicyAttributeTypeDescription::operator =(const
     XmlNode attributeNameNode = resultNode.FirstChild("AttributeName");
     if(!attributeNameNode.IsNull())
     {
-      m_attributeName = StringUtils::Trim(attributeNameNode.GetText().c_str());
+      m_attributeName = attributeNameNode.GetTextView().Trim().ToString();
       m_attributeNameHasBeenSet = true;
     }
     XmlNode attributeTypeNode = resultNode.FirstChild("AttributeType");
     if(!attributeTypeNode.IsNull())
     {
-      m_attributeType = StringUtils::Trim(attributeTypeNode.GetText().c_str());
+      m_attributeType = attributeTypeNode.GetTextView().Trim().ToString();
       m_attributeTypeHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode defaultValueNode = resultNode.FirstChild("DefaultValue");
     if(!defaultValueNode.IsNull())
     {
-      m_defaultValue = StringUtils::Trim(defaultValueNode.GetText().c_str());
+      m_defaultValue = defaultValueNode.GetTextView().Trim().ToString();
       m_defaultValueHasBeenSet = true;
     }
     XmlNode cardinalityNode = resultNode.FirstChild("Cardinality");
     if(!cardinalityNode.IsNull())
     {
-      m_cardinality = StringUtils::Trim(cardinalityNode.GetText().c_str());
+      m_cardinality = cardinalityNode.GetTextView().Trim().ToString();
       m_cardinalityHasBeenSet = true;
     }
   }
@@ -93,27 +93,27 @@ void PolicyAttributeTypeDescription::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_attributeNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AttributeName=" << StringUtils::URLEncode(m_attributeName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AttributeName=" << StringUtils::URLEncoded(m_attributeName) << "&";
   }
 
   if(m_attributeTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AttributeType=" << StringUtils::URLEncode(m_attributeType.c_str()) << "&";
+      oStream << location << index << locationValue << ".AttributeType=" << StringUtils::URLEncoded(m_attributeType) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
 
   if(m_cardinalityHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Cardinality=" << StringUtils::URLEncode(m_cardinality.c_str()) << "&";
+      oStream << location << index << locationValue << ".Cardinality=" << StringUtils::URLEncoded(m_cardinality) << "&";
   }
 
 }
@@ -122,23 +122,23 @@ void PolicyAttributeTypeDescription::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_attributeNameHasBeenSet)
   {
-      oStream << location << ".AttributeName=" << StringUtils::URLEncode(m_attributeName.c_str()) << "&";
+      oStream << location << ".AttributeName=" << StringUtils::URLEncoded(m_attributeName) << "&";
   }
   if(m_attributeTypeHasBeenSet)
   {
-      oStream << location << ".AttributeType=" << StringUtils::URLEncode(m_attributeType.c_str()) << "&";
+      oStream << location << ".AttributeType=" << StringUtils::URLEncoded(m_attributeType) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
   if(m_cardinalityHasBeenSet)
   {
-      oStream << location << ".Cardinality=" << StringUtils::URLEncode(m_cardinality.c_str()) << "&";
+      oStream << location << ".Cardinality=" << StringUtils::URLEncoded(m_cardinality) << "&";
   }
 }
 
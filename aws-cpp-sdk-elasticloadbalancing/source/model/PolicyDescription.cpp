@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,13 +54,13 @@ PolicyDescription& PolicyDescription::operator =(const XmlNode& xmlNode)
     XmlNode policyNameNode = resultNode.FirstChild("PolicyName");
     if(!policyNameNode.IsNull())
     {
-      m_policyName = StringUtils::Trim(policyNameNode.GetText().c_str());
+      m_policyName = policyNameNode.GetTextView().Trim().ToString();
       m_policyNameHasBeenSet = true;
     }
     XmlNode policyTypeNameNode = resultNode.FirstChild("PolicyTypeName");
     if(!policyTypeNameNode.IsNull())
     {
-      m_policyTypeName = StringUtils::Trim(policyTypeNameNode.GetText().c_str());
+      m_policyTypeName = policyTypeNameNode.GetTextView().Trim().ToString();
       m_policyTypeNameHasBeenSet = true;
     }
     XmlNode policyAttributeDescriptionsNode = resultNode.FirstChild("PolicyAttributeDescriptions");
@@ -83,12 +84,12 @@ void PolicyDescription::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_policyNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
 
   if(m_policyTypeNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PolicyTypeName=" << StringUtils::URLEncode(m_policyTypeName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PolicyTypeName=" << StringUtils::URLEncoded(m_policyTypeName) << "&";
   }
 
   if(m_policyAttributeDescriptionsHasBeenSet)
@@ -96,9 +97,9 @@ void PolicyDescription::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned policyAttributeDescriptionsIdx = 1;
       for(auto& item : m_policyAttributeDescriptions)
       {
-        Aws::StringStream policyAttributeDescriptionsSs;
+        Aws::Utils::Stream::StringOutputStream policyAttributeDescriptionsSs;
         policyAttributeDescriptionsSs << location << index << locationValue << ".PolicyAttributeDescriptions.member." << policyAttributeDescriptionsIdx++;
-        item.OutputToStream(oStream, policyAttributeDescriptionsSs.str().c_str());
+        item.OutputToStream(oStream, policyAttributeDescriptionsSs.GetString().c_str());
       }
   }
 
@@ -108,20 +109,20 @@ void PolicyDescription::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_policyNameHasBeenSet)
   {
-      oStream << location << ".PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+      oStream << location << ".PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
   if(m_policyTypeNameHasBeenSet)
   {
-      oStream << location << ".PolicyTypeName=" << StringUtils::URLEncode(m_policyTypeName.c_str()) << "&";
+      oStream << location << ".PolicyTypeName=" << StringUtils::URLEncoded(m_policyTypeName) << "&";
   }
   if(m_policyAttributeDescriptionsHasBeenSet)
   {
       unsigned policyAttributeDescriptionsIdx = 1;
       for(auto& item : m_policyAttributeDescriptions)
       {
-        Aws::StringStream policyAttributeDescriptionsSs;
+        Aws::Utils::Stream::StringOutputStream policyAttributeDescriptionsSs;
         policyAttributeDescriptionsSs << location <<  ".PolicyAttributeDescriptions.member." << policyAttributeDescriptionsIdx++;
-        item.OutputToStream(oStream, policyAttributeDescriptionsSs.str().c_str());
+        item.OutputToStream(oStream, policyAttributeDescriptionsSs.GetString().c_str());
       }
   }
 }
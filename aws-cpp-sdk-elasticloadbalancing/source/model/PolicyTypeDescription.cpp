@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,13 +54,13 @@ PolicyTypeDescription& PolicyTypeDescription::operator =(const XmlNode& xmlNode)
     XmlNode policyTypeNameNode = resultNode.FirstChild("PolicyTypeName");
     if(!policyTypeNameNode.IsNull())
     {
-      m_policyTypeName = StringUtils::Trim(policyTypeNameNode.GetText().c_str());
+      m_policyTypeName = policyTypeNameNode.GetTextView().Trim().ToString();
       m_policyTypeNameHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode policyAttributeTypeDescriptionsNode = resultNode.FirstChild("PolicyAttributeTypeDescriptions");
@@ -83,12 +84,12 @@ void PolicyTypeDescription::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_policyTypeNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PolicyTypeName=" << StringUtils::URLEncode(m_policyTypeName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PolicyTypeName=" << StringUtils::URLEncoded(m_policyTypeName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_policyAttributeTypeDescriptionsHasBeenSet)
@@ -96,9 +97,9 @@ void PolicyTypeDescription::OutputToStream(Aws::OStream& oStream, const char* lo
       unsigned policyAttributeTypeDescriptionsIdx = 1;
       for(auto& item : m_policyAttributeTypeDescriptions)
       {
-        Aws::StringStream policyAttributeTypeDescriptionsSs;
+        Aws::Utils::Stream::StringOutputStream policyAttributeTypeDescriptionsSs;
         policyAttributeTypeDescriptionsSs << location << index << locationValue << ".PolicyAttributeTypeDescriptions.member." << policyAttributeTypeDescriptionsIdx++;
-        item.OutputToStream(oStream, policyAttributeTypeDescriptionsSs.str().c_str());
+        item.OutputToStream(oStream, policyAttributeTypeDescriptionsSs.GetString().c_str());
       }
   }
 
@@ -108,20 +109,20 @@ void PolicyTypeDescription::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_policyTypeNameHasBeenSet)
   {
-      oStream << location << ".PolicyTypeName=" << StringUtils::URLEncode(m_policyTypeName.c_str()) << "&";
+      oStream << location << ".PolicyTypeName=" << StringUtils::URLEncoded(m_policyTypeName) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_policyAttributeTypeDescriptionsHasBeenSet)
   {
       unsigned policyAttributeTypeDescriptionsIdx = 1;
       for(auto& item : m_policyAttributeTypeDescriptions)
       {
-        Aws::StringStream policyAttributeTypeDescriptionsSs;
+        Aws::Utils::Stream::StringOutputStream policyAttributeTypeDescriptionsSs;
         policyAttributeTypeDescriptionsSs << location <<  ".PolicyAttributeTypeDescriptions.member." << policyAttributeTypeDescriptionsIdx++;
-        item.OutputToStream(oStream, policyAttributeTypeDescriptionsSs.str().c_str());
+        item.OutputToStream(oStream, policyAttributeTypeDescriptionsSs.GetString().c_str());
       }
   }
 }
@@ -40,7 +40,7 @@ RegisterInstancesWithLoadBalancerResult& RegisterInstancesWithLoadBalancerResult
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RegisterInstancesWithLoadBalancerResult")
+  if (rootNode.GetNameView() != "RegisterInstancesWithLoadBalancerResult")
   {
     resultNode = rootNode.FirstChild("RegisterInstancesWithLoadBalancerResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancing/model/RemoveTagsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancing::Model;
 using namespace Aws::Utils;
@@ -27,7 +28,7 @@ RemoveTagsRequest::RemoveTagsRequest() :
 
 Aws::String RemoveTagsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=RemoveTags&";
   if(m_loadBalancerNamesHasBeenSet)
   {
@@ -35,7 +36,7 @@ Aws::String RemoveTagsRequest::SerializePayload() const
     for(auto& item : m_loadBalancerNames)
     {
       ss << "LoadBalancerNames.member." << loadBalancerNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       loadBalancerNamesCount++;
     }
   }
@@ -51,6 +52,6 @@ Aws::String RemoveTagsRequest::SerializePayload() const
   }
 
   ss << "Version=2012-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
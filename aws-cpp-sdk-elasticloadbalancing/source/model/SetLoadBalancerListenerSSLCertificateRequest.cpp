@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancing/model/SetLoadBalancerListenerSSLCertificateRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancing::Model;
 using namespace Aws::Utils;
@@ -29,11 +30,11 @@ SetLoadBalancerListenerSSLCertificateRequest::SetLoadBalancerListenerSSLCertific
 
 Aws::String SetLoadBalancerListenerSSLCertificateRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SetLoadBalancerListenerSSLCertificate&";
   if(m_loadBalancerNameHasBeenSet)
   {
-    ss << "LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+    ss << "LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
 
   if(m_loadBalancerPortHasBeenSet)
@@ -43,10 +44,10 @@ Aws::String SetLoadBalancerListenerSSLCertificateRequest::SerializePayload() con
 
   if(m_sSLCertificateIdHasBeenSet)
   {
-    ss << "SSLCertificateId=" << StringUtils::URLEncode(m_sSLCertificateId.c_str()) << "&";
+    ss << "SSLCertificateId=" << StringUtils::URLEncoded(m_sSLCertificateId) << "&";
   }
 
   ss << "Version=2012-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
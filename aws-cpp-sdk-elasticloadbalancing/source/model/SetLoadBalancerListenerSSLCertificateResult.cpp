@@ -40,7 +40,7 @@ SetLoadBalancerListenerSSLCertificateResult& SetLoadBalancerListenerSSLCertifica
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SetLoadBalancerListenerSSLCertificateResult")
+  if (rootNode.GetNameView() != "SetLoadBalancerListenerSSLCertificateResult")
   {
     resultNode = rootNode.FirstChild("SetLoadBalancerListenerSSLCertificateResult");
   }
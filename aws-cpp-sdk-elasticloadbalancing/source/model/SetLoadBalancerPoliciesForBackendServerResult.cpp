@@ -40,7 +40,7 @@ SetLoadBalancerPoliciesForBackendServerResult& SetLoadBalancerPoliciesForBackend
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SetLoadBalancerPoliciesForBackendServerResult")
+  if (rootNode.GetNameView() != "SetLoadBalancerPoliciesForBackendServerResult")
   {
     resultNode = rootNode.FirstChild("SetLoadBalancerPoliciesForBackendServerResult");
   }
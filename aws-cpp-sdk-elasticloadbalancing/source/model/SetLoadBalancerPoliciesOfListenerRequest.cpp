@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancing/model/SetLoadBalancerPoliciesOfListenerRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancing::Model;
 using namespace Aws::Utils;
@@ -29,11 +30,11 @@ SetLoadBalancerPoliciesOfListenerRequest::SetLoadBalancerPoliciesOfListenerReque
 
 Aws::String SetLoadBalancerPoliciesOfListenerRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SetLoadBalancerPoliciesOfListener&";
   if(m_loadBalancerNameHasBeenSet)
   {
-    ss << "LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+    ss << "LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
 
   if(m_loadBalancerPortHasBeenSet)
@@ -47,12 +48,12 @@ Aws::String SetLoadBalancerPoliciesOfListenerRequest::SerializePayload() const
     for(auto& item : m_policyNames)
     {
       ss << "PolicyNames.member." << policyNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       policyNamesCount++;
     }
   }
 
   ss << "Version=2012-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ SetLoadBalancerPoliciesOfListenerResult& SetLoadBalancerPoliciesOfListenerResult
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SetLoadBalancerPoliciesOfListenerResult")
+  if (rootNode.GetNameView() != "SetLoadBalancerPoliciesOfListenerResult")
   {
     resultNode = rootNode.FirstChild("SetLoadBalancerPoliciesOfListenerResult");
   }
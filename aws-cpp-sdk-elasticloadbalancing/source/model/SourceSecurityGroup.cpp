@@ -51,13 +51,13 @@ SourceSecurityGroup& SourceSecurityGroup::operator =(const XmlNode& xmlNode)
     XmlNode ownerAliasNode = resultNode.FirstChild("OwnerAlias");
     if(!ownerAliasNode.IsNull())
     {
-      m_ownerAlias = StringUtils::Trim(ownerAliasNode.GetText().c_str());
+      m_ownerAlias = ownerAliasNode.GetTextView().Trim().ToString();
       m_ownerAliasHasBeenSet = true;
     }
     XmlNode groupNameNode = resultNode.FirstChild("GroupName");
     if(!groupNameNode.IsNull())
     {
-      m_groupName = StringUtils::Trim(groupNameNode.GetText().c_str());
+      m_groupName = groupNameNode.GetTextView().Trim().ToString();
       m_groupNameHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void SourceSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_ownerAliasHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OwnerAlias=" << StringUtils::URLEncode(m_ownerAlias.c_str()) << "&";
+      oStream << location << index << locationValue << ".OwnerAlias=" << StringUtils::URLEncoded(m_ownerAlias) << "&";
   }
 
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void SourceSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_ownerAliasHasBeenSet)
   {
-      oStream << location << ".OwnerAlias=" << StringUtils::URLEncode(m_ownerAlias.c_str()) << "&";
+      oStream << location << ".OwnerAlias=" << StringUtils::URLEncoded(m_ownerAlias) << "&";
   }
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 }
 
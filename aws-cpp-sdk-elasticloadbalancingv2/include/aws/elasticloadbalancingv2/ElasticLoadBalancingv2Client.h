@@ -50,6 +50,9 @@
 #include <aws/elasticloadbalancingv2/model/SetSecurityGroupsResult.h>
 #include <aws/elasticloadbalancingv2/model/SetSubnetsResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -313,6 +316,18 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsCallable(const Model::AddTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsOutcomeCallable AddTagsCallable(Model::AddTagsRequest&& request) const;
+
+        /**
+         * Same as AddTagsAsync(const Model::AddTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsAsync(Model::AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a listener for the specified Application load balancer.</p> <p>To
          * update a listener, use <a>ModifyListener</a>. When you are finished with a
@@ -353,6 +368,18 @@ namespace Model
          */
         virtual void CreateListenerAsync(const Model::CreateListenerRequest& request, const CreateListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateListenerCallable(const Model::CreateListenerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateListenerOutcomeCallable CreateListenerCallable(Model::CreateListenerRequest&& request) const;
+
+        /**
+         * Same as CreateListenerAsync(const Model::CreateListenerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateListenerAsync(Model::CreateListenerRequest&& request, const CreateListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an Application load balancer.</p> <p>To create listeners for your
          * load balancer, use <a>CreateListener</a>. You can add security groups, subnets,
@@ -405,6 +432,18 @@ namespace Model
          */
         virtual void CreateLoadBalancerAsync(const Model::CreateLoadBalancerRequest& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLoadBalancerCallable(const Model::CreateLoadBalancerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateLoadBalancerOutcomeCallable CreateLoadBalancerCallable(Model::CreateLoadBalancerRequest&& request) const;
+
+        /**
+         * Same as CreateLoadBalancerAsync(const Model::CreateLoadBalancerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateLoadBalancerAsync(Model::CreateLoadBalancerRequest&& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a rule for the specified listener.</p> <p>A rule consists conditions
          * and actions. Rules are evaluated in priority order, from the lowest value to the
@@ -442,6 +481,18 @@ namespace Model
          */
         virtual void CreateRuleAsync(const Model::CreateRuleRequest& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRuleCallable(const Model::CreateRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateRuleOutcomeCallable CreateRuleCallable(Model::CreateRuleRequest&& request) const;
+
+        /**
+         * Same as CreateRuleAsync(const Model::CreateRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateRuleAsync(Model::CreateRuleRequest&& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a target group.</p> <p>To register targets with the target group, use
          * <a>RegisterTargets</a>. To update the health check settings for the target
@@ -488,6 +539,18 @@ namespace Model
          */
         virtual void CreateTargetGroupAsync(const Model::CreateTargetGroupRequest& request, const CreateTargetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTargetGroupCallable(const Model::CreateTargetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateTargetGroupOutcomeCallable CreateTargetGroupCallable(Model::CreateTargetGroupRequest&& request) const;
+
+        /**
+         * Same as CreateTargetGroupAsync(const Model::CreateTargetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateTargetGroupAsync(Model::CreateTargetGroupRequest&& request, const CreateTargetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified listener.</p> <p>Alternatively, your listener is
          * deleted when you delete the load balancer it is attached to using
@@ -513,6 +576,18 @@ namespace Model
          */
         virtual void DeleteListenerAsync(const Model::DeleteListenerRequest& request, const DeleteListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteListenerCallable(const Model::DeleteListenerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteListenerOutcomeCallable DeleteListenerCallable(Model::DeleteListenerRequest&& request) const;
+
+        /**
+         * Same as DeleteListenerAsync(const Model::DeleteListenerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteListenerAsync(Model::DeleteListenerRequest&& request, const DeleteListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified load balancer and its attached listeners.</p> <p>You
          * can't delete a load balancer if deletion protection is enabled. If the load
@@ -550,6 +625,18 @@ namespace Model
          */
         virtual void DeleteLoadBalancerAsync(const Model::DeleteLoadBalancerRequest& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLoadBalancerCallable(const Model::DeleteLoadBalancerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteLoadBalancerOutcomeCallable DeleteLoadBalancerCallable(Model::DeleteLoadBalancerRequest&& request) const;
+
+        /**
+         * Same as DeleteLoadBalancerAsync(const Model::DeleteLoadBalancerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteLoadBalancerAsync(Model::DeleteLoadBalancerRequest&& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified rule.</p>
          */
@@ -569,6 +656,18 @@ namespace Model
          */
         virtual void DeleteRuleAsync(const Model::DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRuleCallable(const Model::DeleteRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRuleOutcomeCallable DeleteRuleCallable(Model::DeleteRuleRequest&& request) const;
+
+        /**
+         * Same as DeleteRuleAsync(const Model::DeleteRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRuleAsync(Model::DeleteRuleRequest&& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified target group.</p> <p>You can delete a target group if
          * it is not referenced by any actions. Deleting a target group also deletes any
@@ -594,6 +693,18 @@ namespace Model
          */
         virtual void DeleteTargetGroupAsync(const Model::DeleteTargetGroupRequest& request, const DeleteTargetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTargetGroupCallable(const Model::DeleteTargetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTargetGroupOutcomeCallable DeleteTargetGroupCallable(Model::DeleteTargetGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteTargetGroupAsync(const Model::DeleteTargetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTargetGroupAsync(Model::DeleteTargetGroupRequest&& request, const DeleteTargetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters the specified targets from the specified target group. After the
          * targets are deregistered, they no longer receive traffic from the load
@@ -619,6 +730,18 @@ namespace Model
          */
         virtual void DeregisterTargetsAsync(const Model::DeregisterTargetsRequest& request, const DeregisterTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterTargetsCallable(const Model::DeregisterTargetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeregisterTargetsOutcomeCallable DeregisterTargetsCallable(Model::DeregisterTargetsRequest&& request) const;
+
+        /**
+         * Same as DeregisterTargetsAsync(const Model::DeregisterTargetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeregisterTargetsAsync(Model::DeregisterTargetsRequest&& request, const DeregisterTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified listeners or the listeners for the specified load
          * balancer. You must specify either a load balancer or one or more listeners.</p>
@@ -641,6 +764,18 @@ namespace Model
          */
         virtual void DescribeListenersAsync(const Model::DescribeListenersRequest& request, const DescribeListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeListenersCallable(const Model::DescribeListenersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeListenersOutcomeCallable DescribeListenersCallable(Model::DescribeListenersRequest&& request) const;
+
+        /**
+         * Same as DescribeListenersAsync(const Model::DescribeListenersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeListenersAsync(Model::DescribeListenersRequest&& request, const DescribeListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the attributes for the specified load balancer.</p>
          */
@@ -660,6 +795,18 @@ namespace Model
          */
         virtual void DescribeLoadBalancerAttributesAsync(const Model::DescribeLoadBalancerAttributesRequest& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoadBalancerAttributesCallable(const Model::DescribeLoadBalancerAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLoadBalancerAttributesOutcomeCallable DescribeLoadBalancerAttributesCallable(Model::DescribeLoadBalancerAttributesRequest&& request) const;
+
+        /**
+         * Same as DescribeLoadBalancerAttributesAsync(const Model::DescribeLoadBalancerAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLoadBalancerAttributesAsync(Model::DescribeLoadBalancerAttributesRequest&& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified Application load balancers or all of your Application
          * load balancers.</p> <p>To describe the listeners for a load balancer, use
@@ -688,6 +835,18 @@ namespace Model
          */
         virtual void DescribeLoadBalancersAsync(const Model::DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoadBalancersCallable(const Model::DescribeLoadBalancersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLoadBalancersOutcomeCallable DescribeLoadBalancersCallable(Model::DescribeLoadBalancersRequest&& request) const;
+
+        /**
+         * Same as DescribeLoadBalancersAsync(const Model::DescribeLoadBalancersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLoadBalancersAsync(Model::DescribeLoadBalancersRequest&& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified rules or the rules for the specified listener. You
          * must specify either a listener or one or more rules.</p>
@@ -710,6 +869,18 @@ namespace Model
          */
         virtual void DescribeRulesAsync(const Model::DescribeRulesRequest& request, const DescribeRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRulesCallable(const Model::DescribeRulesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeRulesOutcomeCallable DescribeRulesCallable(Model::DescribeRulesRequest&& request) const;
+
+        /**
+         * Same as DescribeRulesAsync(const Model::DescribeRulesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeRulesAsync(Model::DescribeRulesRequest&& request, const DescribeRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified policies or all policies used for SSL
          * negotiation.</p> <p>Note that the only supported policy at this time is
@@ -735,6 +906,18 @@ namespace Model
          */
         virtual void DescribeSSLPoliciesAsync(const Model::DescribeSSLPoliciesRequest& request, const DescribeSSLPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSSLPoliciesCallable(const Model::DescribeSSLPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSSLPoliciesOutcomeCallable DescribeSSLPoliciesCallable(Model::DescribeSSLPoliciesRequest&& request) const;
+
+        /**
+         * Same as DescribeSSLPoliciesAsync(const Model::DescribeSSLPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSSLPoliciesAsync(Model::DescribeSSLPoliciesRequest&& request, const DescribeSSLPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the tags for the specified resources.</p>
          */
@@ -754,6 +937,18 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTagsCallable(const Model::DescribeTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(Model::DescribeTagsRequest&& request) const;
+
+        /**
+         * Same as DescribeTagsAsync(const Model::DescribeTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTagsAsync(Model::DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the attributes for the specified target group.</p>
          */
@@ -773,6 +968,18 @@ namespace Model
          */
         virtual void DescribeTargetGroupAttributesAsync(const Model::DescribeTargetGroupAttributesRequest& request, const DescribeTargetGroupAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTargetGroupAttributesCallable(const Model::DescribeTargetGroupAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTargetGroupAttributesOutcomeCallable DescribeTargetGroupAttributesCallable(Model::DescribeTargetGroupAttributesRequest&& request) const;
+
+        /**
+         * Same as DescribeTargetGroupAttributesAsync(const Model::DescribeTargetGroupAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTargetGroupAttributesAsync(Model::DescribeTargetGroupAttributesRequest&& request, const DescribeTargetGroupAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified target groups or all of your target groups. By
          * default, all target groups are described. Alternatively, you can specify one of
@@ -810,6 +1017,18 @@ namespace Model
          */
         virtual void DescribeTargetGroupsAsync(const Model::DescribeTargetGroupsRequest& request, const DescribeTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTargetGroupsCallable(const Model::DescribeTargetGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTargetGroupsOutcomeCallable DescribeTargetGroupsCallable(Model::DescribeTargetGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeTargetGroupsAsync(const Model::DescribeTargetGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTargetGroupsAsync(Model::DescribeTargetGroupsRequest&& request, const DescribeTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the health of the specified targets or all of your targets.</p>
          */
@@ -829,6 +1048,18 @@ namespace Model
          */
         virtual void DescribeTargetHealthAsync(const Model::DescribeTargetHealthRequest& request, const DescribeTargetHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTargetHealthCallable(const Model::DescribeTargetHealthRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTargetHealthOutcomeCallable DescribeTargetHealthCallable(Model::DescribeTargetHealthRequest&& request) const;
+
+        /**
+         * Same as DescribeTargetHealthAsync(const Model::DescribeTargetHealthRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTargetHealthAsync(Model::DescribeTargetHealthRequest&& request, const DescribeTargetHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified properties of the specified listener.</p> <p>Any
          * properties that you do not specify retain their current values. However,
@@ -860,6 +1091,18 @@ namespace Model
          */
         virtual void ModifyListenerAsync(const Model::ModifyListenerRequest& request, const ModifyListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyListenerCallable(const Model::ModifyListenerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyListenerOutcomeCallable ModifyListenerCallable(Model::ModifyListenerRequest&& request) const;
+
+        /**
+         * Same as ModifyListenerAsync(const Model::ModifyListenerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyListenerAsync(Model::ModifyListenerRequest&& request, const ModifyListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified attributes of the specified load balancer.</p> <p>If
          * any of the specified attributes can't be modified as requested, the call fails.
@@ -885,6 +1128,18 @@ namespace Model
          */
         virtual void ModifyLoadBalancerAttributesAsync(const Model::ModifyLoadBalancerAttributesRequest& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyLoadBalancerAttributesCallable(const Model::ModifyLoadBalancerAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyLoadBalancerAttributesOutcomeCallable ModifyLoadBalancerAttributesCallable(Model::ModifyLoadBalancerAttributesRequest&& request) const;
+
+        /**
+         * Same as ModifyLoadBalancerAttributesAsync(const Model::ModifyLoadBalancerAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyLoadBalancerAttributesAsync(Model::ModifyLoadBalancerAttributesRequest&& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified rule.</p> <p>Any existing properties that you do not
          * modify retain their current values.</p> <p>To modify the default action, use
@@ -910,6 +1165,18 @@ namespace Model
          */
         virtual void ModifyRuleAsync(const Model::ModifyRuleRequest& request, const ModifyRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyRuleCallable(const Model::ModifyRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyRuleOutcomeCallable ModifyRuleCallable(Model::ModifyRuleRequest&& request) const;
+
+        /**
+         * Same as ModifyRuleAsync(const Model::ModifyRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyRuleAsync(Model::ModifyRuleRequest&& request, const ModifyRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the health checks used when evaluating the health state of the
          * targets in the specified target group.</p> <p>To monitor the health of the
@@ -935,6 +1202,18 @@ namespace Model
          */
         virtual void ModifyTargetGroupAsync(const Model::ModifyTargetGroupRequest& request, const ModifyTargetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyTargetGroupCallable(const Model::ModifyTargetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyTargetGroupOutcomeCallable ModifyTargetGroupCallable(Model::ModifyTargetGroupRequest&& request) const;
+
+        /**
+         * Same as ModifyTargetGroupAsync(const Model::ModifyTargetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyTargetGroupAsync(Model::ModifyTargetGroupRequest&& request, const ModifyTargetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified attributes of the specified target group.</p>
          */
@@ -954,6 +1233,18 @@ namespace Model
          */
         virtual void ModifyTargetGroupAttributesAsync(const Model::ModifyTargetGroupAttributesRequest& request, const ModifyTargetGroupAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyTargetGroupAttributesCallable(const Model::ModifyTargetGroupAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyTargetGroupAttributesOutcomeCallable ModifyTargetGroupAttributesCallable(Model::ModifyTargetGroupAttributesRequest&& request) const;
+
+        /**
+         * Same as ModifyTargetGroupAttributesAsync(const Model::ModifyTargetGroupAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyTargetGroupAttributesAsync(Model::ModifyTargetGroupAttributesRequest&& request, const ModifyTargetGroupAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers the specified targets with the specified target group.</p> <p>The
          * target must be in the virtual private cloud (VPC) that you specified for the
@@ -982,6 +1273,18 @@ namespace Model
          */
         virtual void RegisterTargetsAsync(const Model::RegisterTargetsRequest& request, const RegisterTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterTargetsCallable(const Model::RegisterTargetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterTargetsOutcomeCallable RegisterTargetsCallable(Model::RegisterTargetsRequest&& request) const;
+
+        /**
+         * Same as RegisterTargetsAsync(const Model::RegisterTargetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterTargetsAsync(Model::RegisterTargetsRequest&& request, const RegisterTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified tags from the specified resource.</p> <p>To list the
          * current tags for your resources, use <a>DescribeTags</a>.</p>
@@ -1004,6 +1307,18 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsCallable(const Model::RemoveTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(Model::RemoveTagsRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsAsync(const Model::RemoveTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsAsync(Model::RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the priorities of the specified rules.</p> <p>You can reorder the rules
          * as long as there are no priority conflicts in the new order. Any existing rules
@@ -1029,6 +1344,18 @@ namespace Model
          */
         virtual void SetRulePrioritiesAsync(const Model::SetRulePrioritiesRequest& request, const SetRulePrioritiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetRulePrioritiesCallable(const Model::SetRulePrioritiesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetRulePrioritiesOutcomeCallable SetRulePrioritiesCallable(Model::SetRulePrioritiesRequest&& request) const;
+
+        /**
+         * Same as SetRulePrioritiesAsync(const Model::SetRulePrioritiesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetRulePrioritiesAsync(Model::SetRulePrioritiesRequest&& request, const SetRulePrioritiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates the specified security groups with the specified load balancer.
          * The specified security groups override the previously associated security
@@ -1054,6 +1381,18 @@ namespace Model
          */
         virtual void SetSecurityGroupsAsync(const Model::SetSecurityGroupsRequest& request, const SetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetSecurityGroupsCallable(const Model::SetSecurityGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetSecurityGroupsOutcomeCallable SetSecurityGroupsCallable(Model::SetSecurityGroupsRequest&& request) const;
+
+        /**
+         * Same as SetSecurityGroupsAsync(const Model::SetSecurityGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetSecurityGroupsAsync(Model::SetSecurityGroupsRequest&& request, const SetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables the Availability Zone for the specified subnets for the specified
          * load balancer. The specified subnets replace the previously enabled subnets.</p>
@@ -1076,6 +1415,185 @@ namespace Model
          */
         virtual void SetSubnetsAsync(const Model::SetSubnetsRequest& request, const SetSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetSubnetsCallable(const Model::SetSubnetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetSubnetsOutcomeCallable SetSubnetsCallable(Model::SetSubnetsRequest&& request) const;
+
+        /**
+         * Same as SetSubnetsAsync(const Model::SetSubnetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetSubnetsAsync(Model::SetSubnetsRequest&& request, const SetSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeListeners(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElasticLoadBalancingv2Client, Model::DescribeListenersRequest, Model::DescribeListenersOutcome> DescribeListenersPaginator(const Model::DescribeListenersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeLoadBalancers(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElasticLoadBalancingv2Client, Model::DescribeLoadBalancersRequest, Model::DescribeLoadBalancersOutcome> DescribeLoadBalancersPaginator(const Model::DescribeLoadBalancersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeSSLPolicies(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElasticLoadBalancingv2Client, Model::DescribeSSLPoliciesRequest, Model::DescribeSSLPoliciesOutcome> DescribeSSLPoliciesPaginator(const Model::DescribeSSLPoliciesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeTargetGroups(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElasticLoadBalancingv2Client, Model::DescribeTargetGroupsRequest, Model::DescribeTargetGroupsOutcome> DescribeTargetGroupsPaginator(const Model::DescribeTargetGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::AddTagsRequest, Model::AddTagsOutcome> AddTagsAwaitable(Model::AddTagsRequest request) const;
+
+        /**
+         * co_await-able form of CreateListener(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::CreateListenerRequest, Model::CreateListenerOutcome> CreateListenerAwaitable(Model::CreateListenerRequest request) const;
+
+        /**
+         * co_await-able form of CreateLoadBalancer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::CreateLoadBalancerRequest, Model::CreateLoadBalancerOutcome> CreateLoadBalancerAwaitable(Model::CreateLoadBalancerRequest request) const;
+
+        /**
+         * co_await-able form of CreateRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::CreateRuleRequest, Model::CreateRuleOutcome> CreateRuleAwaitable(Model::CreateRuleRequest request) const;
+
+        /**
+         * co_await-able form of CreateTargetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::CreateTargetGroupRequest, Model::CreateTargetGroupOutcome> CreateTargetGroupAwaitable(Model::CreateTargetGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteListener(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::DeleteListenerRequest, Model::DeleteListenerOutcome> DeleteListenerAwaitable(Model::DeleteListenerRequest request) const;
+
+        /**
+         * co_await-able form of DeleteLoadBalancer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::DeleteLoadBalancerRequest, Model::DeleteLoadBalancerOutcome> DeleteLoadBalancerAwaitable(Model::DeleteLoadBalancerRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::DeleteRuleRequest, Model::DeleteRuleOutcome> DeleteRuleAwaitable(Model::DeleteRuleRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTargetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::DeleteTargetGroupRequest, Model::DeleteTargetGroupOutcome> DeleteTargetGroupAwaitable(Model::DeleteTargetGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeregisterTargets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::DeregisterTargetsRequest, Model::DeregisterTargetsOutcome> DeregisterTargetsAwaitable(Model::DeregisterTargetsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeListeners(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::DescribeListenersRequest, Model::DescribeListenersOutcome> DescribeListenersAwaitable(Model::DescribeListenersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLoadBalancerAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::DescribeLoadBalancerAttributesRequest, Model::DescribeLoadBalancerAttributesOutcome> DescribeLoadBalancerAttributesAwaitable(Model::DescribeLoadBalancerAttributesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLoadBalancers(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::DescribeLoadBalancersRequest, Model::DescribeLoadBalancersOutcome> DescribeLoadBalancersAwaitable(Model::DescribeLoadBalancersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeRules(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::DescribeRulesRequest, Model::DescribeRulesOutcome> DescribeRulesAwaitable(Model::DescribeRulesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSSLPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::DescribeSSLPoliciesRequest, Model::DescribeSSLPoliciesOutcome> DescribeSSLPoliciesAwaitable(Model::DescribeSSLPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::DescribeTagsRequest, Model::DescribeTagsOutcome> DescribeTagsAwaitable(Model::DescribeTagsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTargetGroupAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::DescribeTargetGroupAttributesRequest, Model::DescribeTargetGroupAttributesOutcome> DescribeTargetGroupAttributesAwaitable(Model::DescribeTargetGroupAttributesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTargetGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::DescribeTargetGroupsRequest, Model::DescribeTargetGroupsOutcome> DescribeTargetGroupsAwaitable(Model::DescribeTargetGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTargetHealth(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::DescribeTargetHealthRequest, Model::DescribeTargetHealthOutcome> DescribeTargetHealthAwaitable(Model::DescribeTargetHealthRequest request) const;
+
+        /**
+         * co_await-able form of ModifyListener(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::ModifyListenerRequest, Model::ModifyListenerOutcome> ModifyListenerAwaitable(Model::ModifyListenerRequest request) const;
+
+        /**
+         * co_await-able form of ModifyLoadBalancerAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::ModifyLoadBalancerAttributesRequest, Model::ModifyLoadBalancerAttributesOutcome> ModifyLoadBalancerAttributesAwaitable(Model::ModifyLoadBalancerAttributesRequest request) const;
+
+        /**
+         * co_await-able form of ModifyRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::ModifyRuleRequest, Model::ModifyRuleOutcome> ModifyRuleAwaitable(Model::ModifyRuleRequest request) const;
+
+        /**
+         * co_await-able form of ModifyTargetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::ModifyTargetGroupRequest, Model::ModifyTargetGroupOutcome> ModifyTargetGroupAwaitable(Model::ModifyTargetGroupRequest request) const;
+
+        /**
+         * co_await-able form of ModifyTargetGroupAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::ModifyTargetGroupAttributesRequest, Model::ModifyTargetGroupAttributesOutcome> ModifyTargetGroupAttributesAwaitable(Model::ModifyTargetGroupAttributesRequest request) const;
+
+        /**
+         * co_await-able form of RegisterTargets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::RegisterTargetsRequest, Model::RegisterTargetsOutcome> RegisterTargetsAwaitable(Model::RegisterTargetsRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::RemoveTagsRequest, Model::RemoveTagsOutcome> RemoveTagsAwaitable(Model::RemoveTagsRequest request) const;
+
+        /**
+         * co_await-able form of SetRulePriorities(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::SetRulePrioritiesRequest, Model::SetRulePrioritiesOutcome> SetRulePrioritiesAwaitable(Model::SetRulePrioritiesRequest request) const;
+
+        /**
+         * co_await-able form of SetSecurityGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::SetSecurityGroupsRequest, Model::SetSecurityGroupsOutcome> SetSecurityGroupsAwaitable(Model::SetSecurityGroupsRequest request) const;
+
+        /**
+         * co_await-able form of SetSubnets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticLoadBalancingv2Client, Model::SetSubnetsRequest, Model::SetSubnetsOutcome> SetSubnetsAwaitable(Model::SetSubnetsRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
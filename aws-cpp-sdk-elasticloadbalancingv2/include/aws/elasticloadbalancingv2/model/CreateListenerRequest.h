@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     CreateListenerRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateListener"; }
+
     Aws::String SerializePayload() const override;
 
     /**
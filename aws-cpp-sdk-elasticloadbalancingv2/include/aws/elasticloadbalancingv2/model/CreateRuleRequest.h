@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateRule"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateTargetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateTargetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
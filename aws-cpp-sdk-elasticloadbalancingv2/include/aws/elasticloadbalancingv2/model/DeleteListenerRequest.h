@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteListenerRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteListener"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteTargetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteTargetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DeregisterTargetsRequest();
+    inline const char* GetServiceRequestName() const override { return "DeregisterTargets"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeListenersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeListeners"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeLoadBalancerAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLoadBalancerAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
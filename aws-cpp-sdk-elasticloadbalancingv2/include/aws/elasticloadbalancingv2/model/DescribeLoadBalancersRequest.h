@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeLoadBalancersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLoadBalancers"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeRulesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeRules"; }
+
     Aws::String SerializePayload() const override;
 
     /**
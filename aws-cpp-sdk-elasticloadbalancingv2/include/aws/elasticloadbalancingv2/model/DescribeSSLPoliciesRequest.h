@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeSSLPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSSLPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     /**
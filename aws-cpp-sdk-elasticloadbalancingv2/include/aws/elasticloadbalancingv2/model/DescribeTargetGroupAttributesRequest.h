@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeTargetGroupAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTargetGroupAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeTargetGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTargetGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeTargetHealthRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTargetHealth"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ModifyListenerRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyListener"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     ModifyRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyRule"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ModifyTargetGroupAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyTargetGroupAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ModifyTargetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyTargetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
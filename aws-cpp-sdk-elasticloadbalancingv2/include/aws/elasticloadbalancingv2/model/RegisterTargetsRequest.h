@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     RegisterTargetsRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterTargets"; }
+
     Aws::String SerializePayload() const override;
 
     /**
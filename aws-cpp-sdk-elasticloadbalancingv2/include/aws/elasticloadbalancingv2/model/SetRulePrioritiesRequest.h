@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetRulePrioritiesRequest();
+    inline const char* GetServiceRequestName() const override { return "SetRulePriorities"; }
+
     Aws::String SerializePayload() const override;
 
     /**
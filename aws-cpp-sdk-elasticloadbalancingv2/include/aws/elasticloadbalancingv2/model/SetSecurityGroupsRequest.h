@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetSecurityGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "SetSecurityGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
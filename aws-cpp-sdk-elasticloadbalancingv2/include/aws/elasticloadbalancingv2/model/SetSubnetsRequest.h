@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetSubnetsRequest();
+    inline const char* GetServiceRequestName() const override { return "SetSubnets"; }
+
     Aws::String SerializePayload() const override;
 
     /**
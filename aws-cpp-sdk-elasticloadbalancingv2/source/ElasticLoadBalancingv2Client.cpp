@@ -138,7 +138,7 @@ AddTagsOutcome ElasticLoadBalancingv2Client::AddTags(const AddTagsRequest& reque
 
 AddTagsOutcomeCallable ElasticLoadBalancingv2Client::AddTagsCallable(const AddTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTags( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::AddTagsAsync(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -146,6 +146,16 @@ void ElasticLoadBalancingv2Client::AddTagsAsync(const AddTagsRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsOutcomeCallable ElasticLoadBalancingv2Client::AddTagsCallable(AddTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::AddTags, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::AddTagsAsync(AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::AddTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::AddTagsAsyncHelper(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTags(request), context);
@@ -168,7 +178,7 @@ CreateListenerOutcome ElasticLoadBalancingv2Client::CreateListener(const CreateL
 
 CreateListenerOutcomeCallable ElasticLoadBalancingv2Client::CreateListenerCallable(const CreateListenerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateListener( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateListener( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::CreateListenerAsync(const CreateListenerRequest& request, const CreateListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -176,6 +186,16 @@ void ElasticLoadBalancingv2Client::CreateListenerAsync(const CreateListenerReque
   m_executor->Submit( [this, request, handler, context](){ this->CreateListenerAsyncHelper( request, handler, context ); } );
 }
 
+CreateListenerOutcomeCallable ElasticLoadBalancingv2Client::CreateListenerCallable(CreateListenerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::CreateListener, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::CreateListenerAsync(CreateListenerRequest&& request, const CreateListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::CreateListenerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::CreateListenerAsyncHelper(const CreateListenerRequest& request, const CreateListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateListener(request), context);
@@ -198,7 +218,7 @@ CreateLoadBalancerOutcome ElasticLoadBalancingv2Client::CreateLoadBalancer(const
 
 CreateLoadBalancerOutcomeCallable ElasticLoadBalancingv2Client::CreateLoadBalancerCallable(const CreateLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateLoadBalancer( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateLoadBalancer( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::CreateLoadBalancerAsync(const CreateLoadBalancerRequest& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -206,6 +226,16 @@ void ElasticLoadBalancingv2Client::CreateLoadBalancerAsync(const CreateLoadBalan
   m_executor->Submit( [this, request, handler, context](){ this->CreateLoadBalancerAsyncHelper( request, handler, context ); } );
 }
 
+CreateLoadBalancerOutcomeCallable ElasticLoadBalancingv2Client::CreateLoadBalancerCallable(CreateLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::CreateLoadBalancer, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::CreateLoadBalancerAsync(CreateLoadBalancerRequest&& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::CreateLoadBalancerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::CreateLoadBalancerAsyncHelper(const CreateLoadBalancerRequest& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateLoadBalancer(request), context);
@@ -228,7 +258,7 @@ CreateRuleOutcome ElasticLoadBalancingv2Client::CreateRule(const CreateRuleReque
 
 CreateRuleOutcomeCallable ElasticLoadBalancingv2Client::CreateRuleCallable(const CreateRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateRule( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateRule( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::CreateRuleAsync(const CreateRuleRequest& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -236,6 +266,16 @@ void ElasticLoadBalancingv2Client::CreateRuleAsync(const CreateRuleRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->CreateRuleAsyncHelper( request, handler, context ); } );
 }
 
+CreateRuleOutcomeCallable ElasticLoadBalancingv2Client::CreateRuleCallable(CreateRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::CreateRule, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::CreateRuleAsync(CreateRuleRequest&& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::CreateRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::CreateRuleAsyncHelper(const CreateRuleRequest& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateRule(request), context);
@@ -258,7 +298,7 @@ CreateTargetGroupOutcome ElasticLoadBalancingv2Client::CreateTargetGroup(const C
 
 CreateTargetGroupOutcomeCallable ElasticLoadBalancingv2Client::CreateTargetGroupCallable(const CreateTargetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateTargetGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateTargetGroup( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::CreateTargetGroupAsync(const CreateTargetGroupRequest& request, const CreateTargetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -266,6 +306,16 @@ void ElasticLoadBalancingv2Client::CreateTargetGroupAsync(const CreateTargetGrou
   m_executor->Submit( [this, request, handler, context](){ this->CreateTargetGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateTargetGroupOutcomeCallable ElasticLoadBalancingv2Client::CreateTargetGroupCallable(CreateTargetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::CreateTargetGroup, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::CreateTargetGroupAsync(CreateTargetGroupRequest&& request, const CreateTargetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::CreateTargetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::CreateTargetGroupAsyncHelper(const CreateTargetGroupRequest& request, const CreateTargetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateTargetGroup(request), context);
@@ -288,7 +338,7 @@ DeleteListenerOutcome ElasticLoadBalancingv2Client::DeleteListener(const DeleteL
 
 DeleteListenerOutcomeCallable ElasticLoadBalancingv2Client::DeleteListenerCallable(const DeleteListenerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteListener( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteListener( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::DeleteListenerAsync(const DeleteListenerRequest& request, const DeleteListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -296,6 +346,16 @@ void ElasticLoadBalancingv2Client::DeleteListenerAsync(const DeleteListenerReque
   m_executor->Submit( [this, request, handler, context](){ this->DeleteListenerAsyncHelper( request, handler, context ); } );
 }
 
+DeleteListenerOutcomeCallable ElasticLoadBalancingv2Client::DeleteListenerCallable(DeleteListenerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::DeleteListener, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::DeleteListenerAsync(DeleteListenerRequest&& request, const DeleteListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::DeleteListenerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::DeleteListenerAsyncHelper(const DeleteListenerRequest& request, const DeleteListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteListener(request), context);
@@ -318,7 +378,7 @@ DeleteLoadBalancerOutcome ElasticLoadBalancingv2Client::DeleteLoadBalancer(const
 
 DeleteLoadBalancerOutcomeCallable ElasticLoadBalancingv2Client::DeleteLoadBalancerCallable(const DeleteLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteLoadBalancer( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteLoadBalancer( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::DeleteLoadBalancerAsync(const DeleteLoadBalancerRequest& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -326,6 +386,16 @@ void ElasticLoadBalancingv2Client::DeleteLoadBalancerAsync(const DeleteLoadBalan
   m_executor->Submit( [this, request, handler, context](){ this->DeleteLoadBalancerAsyncHelper( request, handler, context ); } );
 }
 
+DeleteLoadBalancerOutcomeCallable ElasticLoadBalancingv2Client::DeleteLoadBalancerCallable(DeleteLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::DeleteLoadBalancer, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::DeleteLoadBalancerAsync(DeleteLoadBalancerRequest&& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::DeleteLoadBalancerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::DeleteLoadBalancerAsyncHelper(const DeleteLoadBalancerRequest& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteLoadBalancer(request), context);
@@ -348,7 +418,7 @@ DeleteRuleOutcome ElasticLoadBalancingv2Client::DeleteRule(const DeleteRuleReque
 
 DeleteRuleOutcomeCallable ElasticLoadBalancingv2Client::DeleteRuleCallable(const DeleteRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRule( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRule( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::DeleteRuleAsync(const DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -356,6 +426,16 @@ void ElasticLoadBalancingv2Client::DeleteRuleAsync(const DeleteRuleRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRuleAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRuleOutcomeCallable ElasticLoadBalancingv2Client::DeleteRuleCallable(DeleteRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::DeleteRule, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::DeleteRuleAsync(DeleteRuleRequest&& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::DeleteRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::DeleteRuleAsyncHelper(const DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRule(request), context);
@@ -378,7 +458,7 @@ DeleteTargetGroupOutcome ElasticLoadBalancingv2Client::DeleteTargetGroup(const D
 
 DeleteTargetGroupOutcomeCallable ElasticLoadBalancingv2Client::DeleteTargetGroupCallable(const DeleteTargetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTargetGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTargetGroup( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::DeleteTargetGroupAsync(const DeleteTargetGroupRequest& request, const DeleteTargetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -386,6 +466,16 @@ void ElasticLoadBalancingv2Client::DeleteTargetGroupAsync(const DeleteTargetGrou
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTargetGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTargetGroupOutcomeCallable ElasticLoadBalancingv2Client::DeleteTargetGroupCallable(DeleteTargetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::DeleteTargetGroup, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::DeleteTargetGroupAsync(DeleteTargetGroupRequest&& request, const DeleteTargetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::DeleteTargetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::DeleteTargetGroupAsyncHelper(const DeleteTargetGroupRequest& request, const DeleteTargetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTargetGroup(request), context);
@@ -408,7 +498,7 @@ DeregisterTargetsOutcome ElasticLoadBalancingv2Client::DeregisterTargets(const D
 
 DeregisterTargetsOutcomeCallable ElasticLoadBalancingv2Client::DeregisterTargetsCallable(const DeregisterTargetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeregisterTargets( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeregisterTargets( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::DeregisterTargetsAsync(const DeregisterTargetsRequest& request, const DeregisterTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -416,6 +506,16 @@ void ElasticLoadBalancingv2Client::DeregisterTargetsAsync(const DeregisterTarget
   m_executor->Submit( [this, request, handler, context](){ this->DeregisterTargetsAsyncHelper( request, handler, context ); } );
 }
 
+DeregisterTargetsOutcomeCallable ElasticLoadBalancingv2Client::DeregisterTargetsCallable(DeregisterTargetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::DeregisterTargets, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::DeregisterTargetsAsync(DeregisterTargetsRequest&& request, const DeregisterTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::DeregisterTargetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::DeregisterTargetsAsyncHelper(const DeregisterTargetsRequest& request, const DeregisterTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeregisterTargets(request), context);
@@ -438,7 +538,7 @@ DescribeListenersOutcome ElasticLoadBalancingv2Client::DescribeListeners(const D
 
 DescribeListenersOutcomeCallable ElasticLoadBalancingv2Client::DescribeListenersCallable(const DescribeListenersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeListeners( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeListeners( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::DescribeListenersAsync(const DescribeListenersRequest& request, const DescribeListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -446,6 +546,16 @@ void ElasticLoadBalancingv2Client::DescribeListenersAsync(const DescribeListener
   m_executor->Submit( [this, request, handler, context](){ this->DescribeListenersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeListenersOutcomeCallable ElasticLoadBalancingv2Client::DescribeListenersCallable(DescribeListenersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::DescribeListeners, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::DescribeListenersAsync(DescribeListenersRequest&& request, const DescribeListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::DescribeListenersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::DescribeListenersAsyncHelper(const DescribeListenersRequest& request, const DescribeListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeListeners(request), context);
@@ -468,7 +578,7 @@ DescribeLoadBalancerAttributesOutcome ElasticLoadBalancingv2Client::DescribeLoad
 
 DescribeLoadBalancerAttributesOutcomeCallable ElasticLoadBalancingv2Client::DescribeLoadBalancerAttributesCallable(const DescribeLoadBalancerAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLoadBalancerAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLoadBalancerAttributes( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::DescribeLoadBalancerAttributesAsync(const DescribeLoadBalancerAttributesRequest& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -476,6 +586,16 @@ void ElasticLoadBalancingv2Client::DescribeLoadBalancerAttributesAsync(const Des
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLoadBalancerAttributesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLoadBalancerAttributesOutcomeCallable ElasticLoadBalancingv2Client::DescribeLoadBalancerAttributesCallable(DescribeLoadBalancerAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::DescribeLoadBalancerAttributes, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::DescribeLoadBalancerAttributesAsync(DescribeLoadBalancerAttributesRequest&& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::DescribeLoadBalancerAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::DescribeLoadBalancerAttributesAsyncHelper(const DescribeLoadBalancerAttributesRequest& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLoadBalancerAttributes(request), context);
@@ -498,7 +618,7 @@ DescribeLoadBalancersOutcome ElasticLoadBalancingv2Client::DescribeLoadBalancers
 
 DescribeLoadBalancersOutcomeCallable ElasticLoadBalancingv2Client::DescribeLoadBalancersCallable(const DescribeLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLoadBalancers( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLoadBalancers( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::DescribeLoadBalancersAsync(const DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -506,6 +626,16 @@ void ElasticLoadBalancingv2Client::DescribeLoadBalancersAsync(const DescribeLoad
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLoadBalancersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLoadBalancersOutcomeCallable ElasticLoadBalancingv2Client::DescribeLoadBalancersCallable(DescribeLoadBalancersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::DescribeLoadBalancers, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::DescribeLoadBalancersAsync(DescribeLoadBalancersRequest&& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::DescribeLoadBalancersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::DescribeLoadBalancersAsyncHelper(const DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLoadBalancers(request), context);
@@ -528,7 +658,7 @@ DescribeRulesOutcome ElasticLoadBalancingv2Client::DescribeRules(const DescribeR
 
 DescribeRulesOutcomeCallable ElasticLoadBalancingv2Client::DescribeRulesCallable(const DescribeRulesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeRules( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeRules( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::DescribeRulesAsync(const DescribeRulesRequest& request, const DescribeRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -536,6 +666,16 @@ void ElasticLoadBalancingv2Client::DescribeRulesAsync(const DescribeRulesRequest
   m_executor->Submit( [this, request, handler, context](){ this->DescribeRulesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeRulesOutcomeCallable ElasticLoadBalancingv2Client::DescribeRulesCallable(DescribeRulesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::DescribeRules, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::DescribeRulesAsync(DescribeRulesRequest&& request, const DescribeRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::DescribeRulesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::DescribeRulesAsyncHelper(const DescribeRulesRequest& request, const DescribeRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeRules(request), context);
@@ -558,7 +698,7 @@ DescribeSSLPoliciesOutcome ElasticLoadBalancingv2Client::DescribeSSLPolicies(con
 
 DescribeSSLPoliciesOutcomeCallable ElasticLoadBalancingv2Client::DescribeSSLPoliciesCallable(const DescribeSSLPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSSLPolicies( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSSLPolicies( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::DescribeSSLPoliciesAsync(const DescribeSSLPoliciesRequest& request, const DescribeSSLPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -566,6 +706,16 @@ void ElasticLoadBalancingv2Client::DescribeSSLPoliciesAsync(const DescribeSSLPol
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSSLPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSSLPoliciesOutcomeCallable ElasticLoadBalancingv2Client::DescribeSSLPoliciesCallable(DescribeSSLPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::DescribeSSLPolicies, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::DescribeSSLPoliciesAsync(DescribeSSLPoliciesRequest&& request, const DescribeSSLPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::DescribeSSLPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::DescribeSSLPoliciesAsyncHelper(const DescribeSSLPoliciesRequest& request, const DescribeSSLPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSSLPolicies(request), context);
@@ -588,7 +738,7 @@ DescribeTagsOutcome ElasticLoadBalancingv2Client::DescribeTags(const DescribeTag
 
 DescribeTagsOutcomeCallable ElasticLoadBalancingv2Client::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTags( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -596,6 +746,16 @@ void ElasticLoadBalancingv2Client::DescribeTagsAsync(const DescribeTagsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTagsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTagsOutcomeCallable ElasticLoadBalancingv2Client::DescribeTagsCallable(DescribeTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::DescribeTags, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::DescribeTagsAsync(DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::DescribeTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTags(request), context);
@@ -618,7 +778,7 @@ DescribeTargetGroupAttributesOutcome ElasticLoadBalancingv2Client::DescribeTarge
 
 DescribeTargetGroupAttributesOutcomeCallable ElasticLoadBalancingv2Client::DescribeTargetGroupAttributesCallable(const DescribeTargetGroupAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTargetGroupAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTargetGroupAttributes( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::DescribeTargetGroupAttributesAsync(const DescribeTargetGroupAttributesRequest& request, const DescribeTargetGroupAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -626,6 +786,16 @@ void ElasticLoadBalancingv2Client::DescribeTargetGroupAttributesAsync(const Desc
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTargetGroupAttributesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTargetGroupAttributesOutcomeCallable ElasticLoadBalancingv2Client::DescribeTargetGroupAttributesCallable(DescribeTargetGroupAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::DescribeTargetGroupAttributes, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::DescribeTargetGroupAttributesAsync(DescribeTargetGroupAttributesRequest&& request, const DescribeTargetGroupAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::DescribeTargetGroupAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::DescribeTargetGroupAttributesAsyncHelper(const DescribeTargetGroupAttributesRequest& request, const DescribeTargetGroupAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTargetGroupAttributes(request), context);
@@ -648,7 +818,7 @@ DescribeTargetGroupsOutcome ElasticLoadBalancingv2Client::DescribeTargetGroups(c
 
 DescribeTargetGroupsOutcomeCallable ElasticLoadBalancingv2Client::DescribeTargetGroupsCallable(const DescribeTargetGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTargetGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTargetGroups( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::DescribeTargetGroupsAsync(const DescribeTargetGroupsRequest& request, const DescribeTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -656,6 +826,16 @@ void ElasticLoadBalancingv2Client::DescribeTargetGroupsAsync(const DescribeTarge
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTargetGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTargetGroupsOutcomeCallable ElasticLoadBalancingv2Client::DescribeTargetGroupsCallable(DescribeTargetGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::DescribeTargetGroups, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::DescribeTargetGroupsAsync(DescribeTargetGroupsRequest&& request, const DescribeTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::DescribeTargetGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::DescribeTargetGroupsAsyncHelper(const DescribeTargetGroupsRequest& request, const DescribeTargetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTargetGroups(request), context);
@@ -678,7 +858,7 @@ DescribeTargetHealthOutcome ElasticLoadBalancingv2Client::DescribeTargetHealth(c
 
 DescribeTargetHealthOutcomeCallable ElasticLoadBalancingv2Client::DescribeTargetHealthCallable(const DescribeTargetHealthRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTargetHealth( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTargetHealth( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::DescribeTargetHealthAsync(const DescribeTargetHealthRequest& request, const DescribeTargetHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -686,6 +866,16 @@ void ElasticLoadBalancingv2Client::DescribeTargetHealthAsync(const DescribeTarge
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTargetHealthAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTargetHealthOutcomeCallable ElasticLoadBalancingv2Client::DescribeTargetHealthCallable(DescribeTargetHealthRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::DescribeTargetHealth, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::DescribeTargetHealthAsync(DescribeTargetHealthRequest&& request, const DescribeTargetHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::DescribeTargetHealthAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::DescribeTargetHealthAsyncHelper(const DescribeTargetHealthRequest& request, const DescribeTargetHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTargetHealth(request), context);
@@ -708,7 +898,7 @@ ModifyListenerOutcome ElasticLoadBalancingv2Client::ModifyListener(const ModifyL
 
 ModifyListenerOutcomeCallable ElasticLoadBalancingv2Client::ModifyListenerCallable(const ModifyListenerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyListener( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyListener( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::ModifyListenerAsync(const ModifyListenerRequest& request, const ModifyListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -716,6 +906,16 @@ void ElasticLoadBalancingv2Client::ModifyListenerAsync(const ModifyListenerReque
   m_executor->Submit( [this, request, handler, context](){ this->ModifyListenerAsyncHelper( request, handler, context ); } );
 }
 
+ModifyListenerOutcomeCallable ElasticLoadBalancingv2Client::ModifyListenerCallable(ModifyListenerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::ModifyListener, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::ModifyListenerAsync(ModifyListenerRequest&& request, const ModifyListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::ModifyListenerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::ModifyListenerAsyncHelper(const ModifyListenerRequest& request, const ModifyListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyListener(request), context);
@@ -738,7 +938,7 @@ ModifyLoadBalancerAttributesOutcome ElasticLoadBalancingv2Client::ModifyLoadBala
 
 ModifyLoadBalancerAttributesOutcomeCallable ElasticLoadBalancingv2Client::ModifyLoadBalancerAttributesCallable(const ModifyLoadBalancerAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyLoadBalancerAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyLoadBalancerAttributes( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::ModifyLoadBalancerAttributesAsync(const ModifyLoadBalancerAttributesRequest& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -746,6 +946,16 @@ void ElasticLoadBalancingv2Client::ModifyLoadBalancerAttributesAsync(const Modif
   m_executor->Submit( [this, request, handler, context](){ this->ModifyLoadBalancerAttributesAsyncHelper( request, handler, context ); } );
 }
 
+ModifyLoadBalancerAttributesOutcomeCallable ElasticLoadBalancingv2Client::ModifyLoadBalancerAttributesCallable(ModifyLoadBalancerAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::ModifyLoadBalancerAttributes, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::ModifyLoadBalancerAttributesAsync(ModifyLoadBalancerAttributesRequest&& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::ModifyLoadBalancerAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::ModifyLoadBalancerAttributesAsyncHelper(const ModifyLoadBalancerAttributesRequest& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyLoadBalancerAttributes(request), context);
@@ -768,7 +978,7 @@ ModifyRuleOutcome ElasticLoadBalancingv2Client::ModifyRule(const ModifyRuleReque
 
 ModifyRuleOutcomeCallable ElasticLoadBalancingv2Client::ModifyRuleCallable(const ModifyRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyRule( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyRule( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::ModifyRuleAsync(const ModifyRuleRequest& request, const ModifyRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -776,6 +986,16 @@ void ElasticLoadBalancingv2Client::ModifyRuleAsync(const ModifyRuleRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->ModifyRuleAsyncHelper( request, handler, context ); } );
 }
 
+ModifyRuleOutcomeCallable ElasticLoadBalancingv2Client::ModifyRuleCallable(ModifyRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::ModifyRule, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::ModifyRuleAsync(ModifyRuleRequest&& request, const ModifyRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::ModifyRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::ModifyRuleAsyncHelper(const ModifyRuleRequest& request, const ModifyRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyRule(request), context);
@@ -798,7 +1018,7 @@ ModifyTargetGroupOutcome ElasticLoadBalancingv2Client::ModifyTargetGroup(const M
 
 ModifyTargetGroupOutcomeCallable ElasticLoadBalancingv2Client::ModifyTargetGroupCallable(const ModifyTargetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyTargetGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyTargetGroup( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::ModifyTargetGroupAsync(const ModifyTargetGroupRequest& request, const ModifyTargetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -806,6 +1026,16 @@ void ElasticLoadBalancingv2Client::ModifyTargetGroupAsync(const ModifyTargetGrou
   m_executor->Submit( [this, request, handler, context](){ this->ModifyTargetGroupAsyncHelper( request, handler, context ); } );
 }
 
+ModifyTargetGroupOutcomeCallable ElasticLoadBalancingv2Client::ModifyTargetGroupCallable(ModifyTargetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::ModifyTargetGroup, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::ModifyTargetGroupAsync(ModifyTargetGroupRequest&& request, const ModifyTargetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::ModifyTargetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::ModifyTargetGroupAsyncHelper(const ModifyTargetGroupRequest& request, const ModifyTargetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyTargetGroup(request), context);
@@ -828,7 +1058,7 @@ ModifyTargetGroupAttributesOutcome ElasticLoadBalancingv2Client::ModifyTargetGro
 
 ModifyTargetGroupAttributesOutcomeCallable ElasticLoadBalancingv2Client::ModifyTargetGroupAttributesCallable(const ModifyTargetGroupAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyTargetGroupAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyTargetGroupAttributes( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::ModifyTargetGroupAttributesAsync(const ModifyTargetGroupAttributesRequest& request, const ModifyTargetGroupAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -836,6 +1066,16 @@ void ElasticLoadBalancingv2Client::ModifyTargetGroupAttributesAsync(const Modify
   m_executor->Submit( [this, request, handler, context](){ this->ModifyTargetGroupAttributesAsyncHelper( request, handler, context ); } );
 }
 
+ModifyTargetGroupAttributesOutcomeCallable ElasticLoadBalancingv2Client::ModifyTargetGroupAttributesCallable(ModifyTargetGroupAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::ModifyTargetGroupAttributes, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::ModifyTargetGroupAttributesAsync(ModifyTargetGroupAttributesRequest&& request, const ModifyTargetGroupAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::ModifyTargetGroupAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::ModifyTargetGroupAttributesAsyncHelper(const ModifyTargetGroupAttributesRequest& request, const ModifyTargetGroupAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyTargetGroupAttributes(request), context);
@@ -858,7 +1098,7 @@ RegisterTargetsOutcome ElasticLoadBalancingv2Client::RegisterTargets(const Regis
 
 RegisterTargetsOutcomeCallable ElasticLoadBalancingv2Client::RegisterTargetsCallable(const RegisterTargetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterTargets( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterTargets( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::RegisterTargetsAsync(const RegisterTargetsRequest& request, const RegisterTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -866,6 +1106,16 @@ void ElasticLoadBalancingv2Client::RegisterTargetsAsync(const RegisterTargetsReq
   m_executor->Submit( [this, request, handler, context](){ this->RegisterTargetsAsyncHelper( request, handler, context ); } );
 }
 
+RegisterTargetsOutcomeCallable ElasticLoadBalancingv2Client::RegisterTargetsCallable(RegisterTargetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::RegisterTargets, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::RegisterTargetsAsync(RegisterTargetsRequest&& request, const RegisterTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::RegisterTargetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::RegisterTargetsAsyncHelper(const RegisterTargetsRequest& request, const RegisterTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterTargets(request), context);
@@ -888,7 +1138,7 @@ RemoveTagsOutcome ElasticLoadBalancingv2Client::RemoveTags(const RemoveTagsReque
 
 RemoveTagsOutcomeCallable ElasticLoadBalancingv2Client::RemoveTagsCallable(const RemoveTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTags( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::RemoveTagsAsync(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -896,6 +1146,16 @@ void ElasticLoadBalancingv2Client::RemoveTagsAsync(const RemoveTagsRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsOutcomeCallable ElasticLoadBalancingv2Client::RemoveTagsCallable(RemoveTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::RemoveTags, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::RemoveTagsAsync(RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::RemoveTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::RemoveTagsAsyncHelper(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTags(request), context);
@@ -918,7 +1178,7 @@ SetRulePrioritiesOutcome ElasticLoadBalancingv2Client::SetRulePriorities(const S
 
 SetRulePrioritiesOutcomeCallable ElasticLoadBalancingv2Client::SetRulePrioritiesCallable(const SetRulePrioritiesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetRulePriorities( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetRulePriorities( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::SetRulePrioritiesAsync(const SetRulePrioritiesRequest& request, const SetRulePrioritiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -926,6 +1186,16 @@ void ElasticLoadBalancingv2Client::SetRulePrioritiesAsync(const SetRulePrioritie
   m_executor->Submit( [this, request, handler, context](){ this->SetRulePrioritiesAsyncHelper( request, handler, context ); } );
 }
 
+SetRulePrioritiesOutcomeCallable ElasticLoadBalancingv2Client::SetRulePrioritiesCallable(SetRulePrioritiesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::SetRulePriorities, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::SetRulePrioritiesAsync(SetRulePrioritiesRequest&& request, const SetRulePrioritiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::SetRulePrioritiesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::SetRulePrioritiesAsyncHelper(const SetRulePrioritiesRequest& request, const SetRulePrioritiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetRulePriorities(request), context);
@@ -948,7 +1218,7 @@ SetSecurityGroupsOutcome ElasticLoadBalancingv2Client::SetSecurityGroups(const S
 
 SetSecurityGroupsOutcomeCallable ElasticLoadBalancingv2Client::SetSecurityGroupsCallable(const SetSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetSecurityGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetSecurityGroups( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::SetSecurityGroupsAsync(const SetSecurityGroupsRequest& request, const SetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -956,6 +1226,16 @@ void ElasticLoadBalancingv2Client::SetSecurityGroupsAsync(const SetSecurityGroup
   m_executor->Submit( [this, request, handler, context](){ this->SetSecurityGroupsAsyncHelper( request, handler, context ); } );
 }
 
+SetSecurityGroupsOutcomeCallable ElasticLoadBalancingv2Client::SetSecurityGroupsCallable(SetSecurityGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::SetSecurityGroups, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::SetSecurityGroupsAsync(SetSecurityGroupsRequest&& request, const SetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::SetSecurityGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::SetSecurityGroupsAsyncHelper(const SetSecurityGroupsRequest& request, const SetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetSecurityGroups(request), context);
@@ -978,7 +1258,7 @@ SetSubnetsOutcome ElasticLoadBalancingv2Client::SetSubnets(const SetSubnetsReque
 
 SetSubnetsOutcomeCallable ElasticLoadBalancingv2Client::SetSubnetsCallable(const SetSubnetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetSubnets( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetSubnets( request ); } );
 }
 
 void ElasticLoadBalancingv2Client::SetSubnetsAsync(const SetSubnetsRequest& request, const SetSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -986,8 +1266,233 @@ void ElasticLoadBalancingv2Client::SetSubnetsAsync(const SetSubnetsRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->SetSubnetsAsyncHelper( request, handler, context ); } );
 }
 
+SetSubnetsOutcomeCallable ElasticLoadBalancingv2Client::SetSubnetsCallable(SetSubnetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticLoadBalancingv2Client::SetSubnets, this, std::move(request)));
+}
+
+void ElasticLoadBalancingv2Client::SetSubnetsAsync(SetSubnetsRequest&& request, const SetSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticLoadBalancingv2Client::SetSubnetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticLoadBalancingv2Client::SetSubnetsAsyncHelper(const SetSubnetsRequest& request, const SetSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetSubnets(request), context);
 }
 
+Paginator<ElasticLoadBalancingv2Client, DescribeListenersRequest, DescribeListenersOutcome> ElasticLoadBalancingv2Client::DescribeListenersPaginator(const DescribeListenersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElasticLoadBalancingv2Client, DescribeListenersRequest, DescribeListenersOutcome>(this, &ElasticLoadBalancingv2Client::DescribeListeners, request,
+    [](const DescribeListenersRequest& current, const DescribeListenersOutcome& outcome, DescribeListenersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElasticLoadBalancingv2Client, DescribeLoadBalancersRequest, DescribeLoadBalancersOutcome> ElasticLoadBalancingv2Client::DescribeLoadBalancersPaginator(const DescribeLoadBalancersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElasticLoadBalancingv2Client, DescribeLoadBalancersRequest, DescribeLoadBalancersOutcome>(this, &ElasticLoadBalancingv2Client::DescribeLoadBalancers, request,
+    [](const DescribeLoadBalancersRequest& current, const DescribeLoadBalancersOutcome& outcome, DescribeLoadBalancersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElasticLoadBalancingv2Client, DescribeSSLPoliciesRequest, DescribeSSLPoliciesOutcome> ElasticLoadBalancingv2Client::DescribeSSLPoliciesPaginator(const DescribeSSLPoliciesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElasticLoadBalancingv2Client, DescribeSSLPoliciesRequest, DescribeSSLPoliciesOutcome>(this, &ElasticLoadBalancingv2Client::DescribeSSLPolicies, request,
+    [](const DescribeSSLPoliciesRequest& current, const DescribeSSLPoliciesOutcome& outcome, DescribeSSLPoliciesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElasticLoadBalancingv2Client, DescribeTargetGroupsRequest, DescribeTargetGroupsOutcome> ElasticLoadBalancingv2Client::DescribeTargetGroupsPaginator(const DescribeTargetGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElasticLoadBalancingv2Client, DescribeTargetGroupsRequest, DescribeTargetGroupsOutcome>(this, &ElasticLoadBalancingv2Client::DescribeTargetGroups, request,
+    [](const DescribeTargetGroupsRequest& current, const DescribeTargetGroupsOutcome& outcome, DescribeTargetGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, AddTagsRequest, AddTagsOutcome> ElasticLoadBalancingv2Client::AddTagsAwaitable(AddTagsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::AddTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, CreateListenerRequest, CreateListenerOutcome> ElasticLoadBalancingv2Client::CreateListenerAwaitable(CreateListenerRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::CreateListener, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, CreateLoadBalancerRequest, CreateLoadBalancerOutcome> ElasticLoadBalancingv2Client::CreateLoadBalancerAwaitable(CreateLoadBalancerRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::CreateLoadBalancer, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, CreateRuleRequest, CreateRuleOutcome> ElasticLoadBalancingv2Client::CreateRuleAwaitable(CreateRuleRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::CreateRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, CreateTargetGroupRequest, CreateTargetGroupOutcome> ElasticLoadBalancingv2Client::CreateTargetGroupAwaitable(CreateTargetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::CreateTargetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, DeleteListenerRequest, DeleteListenerOutcome> ElasticLoadBalancingv2Client::DeleteListenerAwaitable(DeleteListenerRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::DeleteListener, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, DeleteLoadBalancerRequest, DeleteLoadBalancerOutcome> ElasticLoadBalancingv2Client::DeleteLoadBalancerAwaitable(DeleteLoadBalancerRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::DeleteLoadBalancer, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, DeleteRuleRequest, DeleteRuleOutcome> ElasticLoadBalancingv2Client::DeleteRuleAwaitable(DeleteRuleRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::DeleteRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, DeleteTargetGroupRequest, DeleteTargetGroupOutcome> ElasticLoadBalancingv2Client::DeleteTargetGroupAwaitable(DeleteTargetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::DeleteTargetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, DeregisterTargetsRequest, DeregisterTargetsOutcome> ElasticLoadBalancingv2Client::DeregisterTargetsAwaitable(DeregisterTargetsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::DeregisterTargets, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, DescribeListenersRequest, DescribeListenersOutcome> ElasticLoadBalancingv2Client::DescribeListenersAwaitable(DescribeListenersRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::DescribeListeners, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, DescribeLoadBalancerAttributesRequest, DescribeLoadBalancerAttributesOutcome> ElasticLoadBalancingv2Client::DescribeLoadBalancerAttributesAwaitable(DescribeLoadBalancerAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::DescribeLoadBalancerAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, DescribeLoadBalancersRequest, DescribeLoadBalancersOutcome> ElasticLoadBalancingv2Client::DescribeLoadBalancersAwaitable(DescribeLoadBalancersRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::DescribeLoadBalancers, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, DescribeRulesRequest, DescribeRulesOutcome> ElasticLoadBalancingv2Client::DescribeRulesAwaitable(DescribeRulesRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::DescribeRules, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, DescribeSSLPoliciesRequest, DescribeSSLPoliciesOutcome> ElasticLoadBalancingv2Client::DescribeSSLPoliciesAwaitable(DescribeSSLPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::DescribeSSLPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, DescribeTagsRequest, DescribeTagsOutcome> ElasticLoadBalancingv2Client::DescribeTagsAwaitable(DescribeTagsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::DescribeTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, DescribeTargetGroupAttributesRequest, DescribeTargetGroupAttributesOutcome> ElasticLoadBalancingv2Client::DescribeTargetGroupAttributesAwaitable(DescribeTargetGroupAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::DescribeTargetGroupAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, DescribeTargetGroupsRequest, DescribeTargetGroupsOutcome> ElasticLoadBalancingv2Client::DescribeTargetGroupsAwaitable(DescribeTargetGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::DescribeTargetGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, DescribeTargetHealthRequest, DescribeTargetHealthOutcome> ElasticLoadBalancingv2Client::DescribeTargetHealthAwaitable(DescribeTargetHealthRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::DescribeTargetHealth, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, ModifyListenerRequest, ModifyListenerOutcome> ElasticLoadBalancingv2Client::ModifyListenerAwaitable(ModifyListenerRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::ModifyListener, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, ModifyLoadBalancerAttributesRequest, ModifyLoadBalancerAttributesOutcome> ElasticLoadBalancingv2Client::ModifyLoadBalancerAttributesAwaitable(ModifyLoadBalancerAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::ModifyLoadBalancerAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, ModifyRuleRequest, ModifyRuleOutcome> ElasticLoadBalancingv2Client::ModifyRuleAwaitable(ModifyRuleRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::ModifyRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, ModifyTargetGroupRequest, ModifyTargetGroupOutcome> ElasticLoadBalancingv2Client::ModifyTargetGroupAwaitable(ModifyTargetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::ModifyTargetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, ModifyTargetGroupAttributesRequest, ModifyTargetGroupAttributesOutcome> ElasticLoadBalancingv2Client::ModifyTargetGroupAttributesAwaitable(ModifyTargetGroupAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::ModifyTargetGroupAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, RegisterTargetsRequest, RegisterTargetsOutcome> ElasticLoadBalancingv2Client::RegisterTargetsAwaitable(RegisterTargetsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::RegisterTargets, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, RemoveTagsRequest, RemoveTagsOutcome> ElasticLoadBalancingv2Client::RemoveTagsAwaitable(RemoveTagsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::RemoveTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, SetRulePrioritiesRequest, SetRulePrioritiesOutcome> ElasticLoadBalancingv2Client::SetRulePrioritiesAwaitable(SetRulePrioritiesRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::SetRulePriorities, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, SetSecurityGroupsRequest, SetSecurityGroupsOutcome> ElasticLoadBalancingv2Client::SetSecurityGroupsAwaitable(SetSecurityGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::SetSecurityGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticLoadBalancingv2Client, SetSubnetsRequest, SetSubnetsOutcome> ElasticLoadBalancingv2Client::SetSubnetsAwaitable(SetSubnetsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticLoadBalancingv2Client::SetSubnets, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -51,13 +51,13 @@ Action& Action::operator =(const XmlNode& xmlNode)
     XmlNode typeNode = resultNode.FirstChild("Type");
     if(!typeNode.IsNull())
     {
-      m_type = ActionTypeEnumMapper::GetActionTypeEnumForName(StringUtils::Trim(typeNode.GetText().c_str()).c_str());
+      m_type = ActionTypeEnumMapper::GetActionTypeEnumForName(typeNode.GetTextView().Trim().ToString().c_str());
       m_typeHasBeenSet = true;
     }
     XmlNode targetGroupArnNode = resultNode.FirstChild("TargetGroupArn");
     if(!targetGroupArnNode.IsNull())
     {
-      m_targetGroupArn = StringUtils::Trim(targetGroupArnNode.GetText().c_str());
+      m_targetGroupArn = targetGroupArnNode.GetTextView().Trim().ToString();
       m_targetGroupArnHasBeenSet = true;
     }
   }
@@ -74,7 +74,7 @@ void Action::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
 
   if(m_targetGroupArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TargetGroupArn=" << StringUtils::URLEncode(m_targetGroupArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".TargetGroupArn=" << StringUtils::URLEncoded(m_targetGroupArn) << "&";
   }
 
 }
@@ -87,7 +87,7 @@ void Action::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_targetGroupArnHasBeenSet)
   {
-      oStream << location << ".TargetGroupArn=" << StringUtils::URLEncode(m_targetGroupArn.c_str()) << "&";
+      oStream << location << ".TargetGroupArn=" << StringUtils::URLEncoded(m_targetGroupArn) << "&";
   }
 }
 
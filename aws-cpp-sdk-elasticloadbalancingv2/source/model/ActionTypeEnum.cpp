@@ -29,16 +29,26 @@ namespace Aws
       namespace ActionTypeEnumMapper
       {
 
-        static const int forward_HASH = HashingUtils::HashString("forward");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int forward_HASH = -677145915;
 
 
         ActionTypeEnum GetActionTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == forward_HASH)
+          switch (hashCode)
           {
+          case forward_HASH:
             return ActionTypeEnum::forward;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -40,7 +40,7 @@ AddTagsResult& AddTagsResult::operator =(const AmazonWebServiceResult<XmlDocumen
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AddTagsResult")
+  if (rootNode.GetNameView() != "AddTagsResult")
   {
     resultNode = rootNode.FirstChild("AddTagsResult");
   }
@@ -51,13 +51,13 @@ AvailabilityZone& AvailabilityZone::operator =(const XmlNode& xmlNode)
     XmlNode zoneNameNode = resultNode.FirstChild("ZoneName");
     if(!zoneNameNode.IsNull())
     {
-      m_zoneName = StringUtils::Trim(zoneNameNode.GetText().c_str());
+      m_zoneName = zoneNameNode.GetTextView().Trim().ToString();
       m_zoneNameHasBeenSet = true;
     }
     XmlNode subnetIdNode = resultNode.FirstChild("SubnetId");
     if(!subnetIdNode.IsNull())
     {
-      m_subnetId = StringUtils::Trim(subnetIdNode.GetText().c_str());
+      m_subnetId = subnetIdNode.GetTextView().Trim().ToString();
       m_subnetIdHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void AvailabilityZone::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_zoneNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ZoneName=" << StringUtils::URLEncode(m_zoneName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ZoneName=" << StringUtils::URLEncoded(m_zoneName) << "&";
   }
 
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void AvailabilityZone::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_zoneNameHasBeenSet)
   {
-      oStream << location << ".ZoneName=" << StringUtils::URLEncode(m_zoneName.c_str()) << "&";
+      oStream << location << ".ZoneName=" << StringUtils::URLEncoded(m_zoneName) << "&";
   }
   if(m_subnetIdHasBeenSet)
   {
-      oStream << location << ".SubnetId=" << StringUtils::URLEncode(m_subnetId.c_str()) << "&";
+      oStream << location << ".SubnetId=" << StringUtils::URLEncoded(m_subnetId) << "&";
   }
 }
 
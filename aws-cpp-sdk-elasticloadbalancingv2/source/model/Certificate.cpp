@@ -49,7 +49,7 @@ Certificate& Certificate::operator =(const XmlNode& xmlNode)
     XmlNode certificateArnNode = resultNode.FirstChild("CertificateArn");
     if(!certificateArnNode.IsNull())
     {
-      m_certificateArn = StringUtils::Trim(certificateArnNode.GetText().c_str());
+      m_certificateArn = certificateArnNode.GetTextView().Trim().ToString();
       m_certificateArnHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void Certificate::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_certificateArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CertificateArn=" << StringUtils::URLEncode(m_certificateArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".CertificateArn=" << StringUtils::URLEncoded(m_certificateArn) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void Certificate::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_certificateArnHasBeenSet)
   {
-      oStream << location << ".CertificateArn=" << StringUtils::URLEncode(m_certificateArn.c_str()) << "&";
+      oStream << location << ".CertificateArn=" << StringUtils::URLEncoded(m_certificateArn) << "&";
   }
 }
 
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/CreateListenerRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -32,11 +33,11 @@ CreateListenerRequest::CreateListenerRequest() :
 
 Aws::String CreateListenerRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateListener&";
   if(m_loadBalancerArnHasBeenSet)
   {
-    ss << "LoadBalancerArn=" << StringUtils::URLEncode(m_loadBalancerArn.c_str()) << "&";
+    ss << "LoadBalancerArn=" << StringUtils::URLEncoded(m_loadBalancerArn) << "&";
   }
 
   if(m_protocolHasBeenSet)
@@ -51,7 +52,7 @@ Aws::String CreateListenerRequest::SerializePayload() const
 
   if(m_sslPolicyHasBeenSet)
   {
-    ss << "SslPolicy=" << StringUtils::URLEncode(m_sslPolicy.c_str()) << "&";
+    ss << "SslPolicy=" << StringUtils::URLEncoded(m_sslPolicy) << "&";
   }
 
   if(m_certificatesHasBeenSet)
@@ -75,6 +76,6 @@ Aws::String CreateListenerRequest::SerializePayload() const
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateListenerResult& CreateListenerResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateListenerResult")
+  if (rootNode.GetNameView() != "CreateListenerResult")
   {
     resultNode = rootNode.FirstChild("CreateListenerResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/CreateLoadBalancerRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -30,11 +31,11 @@ CreateLoadBalancerRequest::CreateLoadBalancerRequest() :
 
 Aws::String CreateLoadBalancerRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateLoadBalancer&";
   if(m_nameHasBeenSet)
   {
-    ss << "Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+    ss << "Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_subnetsHasBeenSet)
@@ -43,7 +44,7 @@ Aws::String CreateLoadBalancerRequest::SerializePayload() const
     for(auto& item : m_subnets)
     {
       ss << "Subnets.member." << subnetsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       subnetsCount++;
     }
   }
@@ -54,7 +55,7 @@ Aws::String CreateLoadBalancerRequest::SerializePayload() const
     for(auto& item : m_securityGroups)
     {
       ss << "SecurityGroups.member." << securityGroupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       securityGroupsCount++;
     }
   }
@@ -75,6 +76,6 @@ Aws::String CreateLoadBalancerRequest::SerializePayload() const
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
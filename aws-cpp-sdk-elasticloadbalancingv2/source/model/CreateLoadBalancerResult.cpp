@@ -40,7 +40,7 @@ CreateLoadBalancerResult& CreateLoadBalancerResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateLoadBalancerResult")
+  if (rootNode.GetNameView() != "CreateLoadBalancerResult")
   {
     resultNode = rootNode.FirstChild("CreateLoadBalancerResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/CreateRuleRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -30,11 +31,11 @@ CreateRuleRequest::CreateRuleRequest() :
 
 Aws::String CreateRuleRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateRule&";
   if(m_listenerArnHasBeenSet)
   {
-    ss << "ListenerArn=" << StringUtils::URLEncode(m_listenerArn.c_str()) << "&";
+    ss << "ListenerArn=" << StringUtils::URLEncoded(m_listenerArn) << "&";
   }
 
   if(m_conditionsHasBeenSet)
@@ -63,6 +64,6 @@ Aws::String CreateRuleRequest::SerializePayload() const
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
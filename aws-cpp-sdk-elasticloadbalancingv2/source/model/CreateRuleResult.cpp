@@ -40,7 +40,7 @@ CreateRuleResult& CreateRuleResult::operator =(const AmazonWebServiceResult<XmlD
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateRuleResult")
+  if (rootNode.GetNameView() != "CreateRuleResult")
   {
     resultNode = rootNode.FirstChild("CreateRuleResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/CreateTargetGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -42,11 +43,11 @@ CreateTargetGroupRequest::CreateTargetGroupRequest() :
 
 Aws::String CreateTargetGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateTargetGroup&";
   if(m_nameHasBeenSet)
   {
-    ss << "Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+    ss << "Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_protocolHasBeenSet)
@@ -61,7 +62,7 @@ Aws::String CreateTargetGroupRequest::SerializePayload() const
 
   if(m_vpcIdHasBeenSet)
   {
-    ss << "VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+    ss << "VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_healthCheckProtocolHasBeenSet)
@@ -71,12 +72,12 @@ Aws::String CreateTargetGroupRequest::SerializePayload() const
 
   if(m_healthCheckPortHasBeenSet)
   {
-    ss << "HealthCheckPort=" << StringUtils::URLEncode(m_healthCheckPort.c_str()) << "&";
+    ss << "HealthCheckPort=" << StringUtils::URLEncoded(m_healthCheckPort) << "&";
   }
 
   if(m_healthCheckPathHasBeenSet)
   {
-    ss << "HealthCheckPath=" << StringUtils::URLEncode(m_healthCheckPath.c_str()) << "&";
+    ss << "HealthCheckPath=" << StringUtils::URLEncoded(m_healthCheckPath) << "&";
   }
 
   if(m_healthCheckIntervalSecondsHasBeenSet)
@@ -105,6 +106,6 @@ Aws::String CreateTargetGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
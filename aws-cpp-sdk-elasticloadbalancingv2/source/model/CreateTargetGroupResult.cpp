@@ -40,7 +40,7 @@ CreateTargetGroupResult& CreateTargetGroupResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateTargetGroupResult")
+  if (rootNode.GetNameView() != "CreateTargetGroupResult")
   {
     resultNode = rootNode.FirstChild("CreateTargetGroupResult");
   }
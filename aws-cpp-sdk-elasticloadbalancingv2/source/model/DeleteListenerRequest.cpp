@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/DeleteListenerRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteListenerRequest::DeleteListenerRequest() :
 
 Aws::String DeleteListenerRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteListener&";
   if(m_listenerArnHasBeenSet)
   {
-    ss << "ListenerArn=" << StringUtils::URLEncode(m_listenerArn.c_str()) << "&";
+    ss << "ListenerArn=" << StringUtils::URLEncoded(m_listenerArn) << "&";
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DeleteListenerResult& DeleteListenerResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteListenerResult")
+  if (rootNode.GetNameView() != "DeleteListenerResult")
   {
     resultNode = rootNode.FirstChild("DeleteListenerResult");
   }
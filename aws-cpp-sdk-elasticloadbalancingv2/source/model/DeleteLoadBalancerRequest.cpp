@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/DeleteLoadBalancerRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteLoadBalancerRequest::DeleteLoadBalancerRequest() :
 
 Aws::String DeleteLoadBalancerRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteLoadBalancer&";
   if(m_loadBalancerArnHasBeenSet)
   {
-    ss << "LoadBalancerArn=" << StringUtils::URLEncode(m_loadBalancerArn.c_str()) << "&";
+    ss << "LoadBalancerArn=" << StringUtils::URLEncoded(m_loadBalancerArn) << "&";
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/DeleteRuleRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteRuleRequest::DeleteRuleRequest() :
 
 Aws::String DeleteRuleRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteRule&";
   if(m_ruleArnHasBeenSet)
   {
-    ss << "RuleArn=" << StringUtils::URLEncode(m_ruleArn.c_str()) << "&";
+    ss << "RuleArn=" << StringUtils::URLEncoded(m_ruleArn) << "&";
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DeleteRuleResult& DeleteRuleResult::operator =(const AmazonWebServiceResult<XmlD
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteRuleResult")
+  if (rootNode.GetNameView() != "DeleteRuleResult")
   {
     resultNode = rootNode.FirstChild("DeleteRuleResult");
   }
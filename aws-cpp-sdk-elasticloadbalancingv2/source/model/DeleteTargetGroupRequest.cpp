@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/DeleteTargetGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteTargetGroupRequest::DeleteTargetGroupRequest() :
 
 Aws::String DeleteTargetGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteTargetGroup&";
   if(m_targetGroupArnHasBeenSet)
   {
-    ss << "TargetGroupArn=" << StringUtils::URLEncode(m_targetGroupArn.c_str()) << "&";
+    ss << "TargetGroupArn=" << StringUtils::URLEncoded(m_targetGroupArn) << "&";
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
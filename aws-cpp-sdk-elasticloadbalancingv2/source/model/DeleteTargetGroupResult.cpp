@@ -40,7 +40,7 @@ DeleteTargetGroupResult& DeleteTargetGroupResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteTargetGroupResult")
+  if (rootNode.GetNameView() != "DeleteTargetGroupResult")
   {
     resultNode = rootNode.FirstChild("DeleteTargetGroupResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/DeregisterTargetsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ DeregisterTargetsRequest::DeregisterTargetsRequest() :
 
 Aws::String DeregisterTargetsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeregisterTargets&";
   if(m_targetGroupArnHasBeenSet)
   {
-    ss << "TargetGroupArn=" << StringUtils::URLEncode(m_targetGroupArn.c_str()) << "&";
+    ss << "TargetGroupArn=" << StringUtils::URLEncoded(m_targetGroupArn) << "&";
   }
 
   if(m_targetsHasBeenSet)
@@ -45,6 +46,6 @@ Aws::String DeregisterTargetsRequest::SerializePayload() const
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DeregisterTargetsResult& DeregisterTargetsResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeregisterTargetsResult")
+  if (rootNode.GetNameView() != "DeregisterTargetsResult")
   {
     resultNode = rootNode.FirstChild("DeregisterTargetsResult");
   }
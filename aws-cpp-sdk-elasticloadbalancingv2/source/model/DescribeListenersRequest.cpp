@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/DescribeListenersRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -30,11 +31,11 @@ DescribeListenersRequest::DescribeListenersRequest() :
 
 Aws::String DescribeListenersRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeListeners&";
   if(m_loadBalancerArnHasBeenSet)
   {
-    ss << "LoadBalancerArn=" << StringUtils::URLEncode(m_loadBalancerArn.c_str()) << "&";
+    ss << "LoadBalancerArn=" << StringUtils::URLEncoded(m_loadBalancerArn) << "&";
   }
 
   if(m_listenerArnsHasBeenSet)
@@ -43,14 +44,14 @@ Aws::String DescribeListenersRequest::SerializePayload() const
     for(auto& item : m_listenerArns)
     {
       ss << "ListenerArns.member." << listenerArnsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       listenerArnsCount++;
     }
   }
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_pageSizeHasBeenSet)
@@ -59,6 +60,6 @@ Aws::String DescribeListenersRequest::SerializePayload() const
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeListenersResult& DescribeListenersResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeListenersResult")
+  if (rootNode.GetNameView() != "DescribeListenersResult")
   {
     resultNode = rootNode.FirstChild("DescribeListenersResult");
   }
@@ -61,7 +61,7 @@ DescribeListenersResult& DescribeListenersResult::operator =(const AmazonWebServ
     XmlNode nextMarkerNode = resultNode.FirstChild("NextMarker");
     if(!nextMarkerNode.IsNull())
     {
-      m_nextMarker = StringUtils::Trim(nextMarkerNode.GetText().c_str());
+      m_nextMarker = nextMarkerNode.GetTextView().Trim().ToString();
     }
   }
 
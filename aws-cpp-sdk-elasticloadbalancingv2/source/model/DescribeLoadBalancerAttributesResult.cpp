@@ -40,7 +40,7 @@ DescribeLoadBalancerAttributesResult& DescribeLoadBalancerAttributesResult::oper
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeLoadBalancerAttributesResult")
+  if (rootNode.GetNameView() != "DescribeLoadBalancerAttributesResult")
   {
     resultNode = rootNode.FirstChild("DescribeLoadBalancerAttributesResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/DescribeLoadBalancersRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -30,7 +31,7 @@ DescribeLoadBalancersRequest::DescribeLoadBalancersRequest() :
 
 Aws::String DescribeLoadBalancersRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeLoadBalancers&";
   if(m_loadBalancerArnsHasBeenSet)
   {
@@ -38,7 +39,7 @@ Aws::String DescribeLoadBalancersRequest::SerializePayload() const
     for(auto& item : m_loadBalancerArns)
     {
       ss << "LoadBalancerArns.member." << loadBalancerArnsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       loadBalancerArnsCount++;
     }
   }
@@ -49,14 +50,14 @@ Aws::String DescribeLoadBalancersRequest::SerializePayload() const
     for(auto& item : m_names)
     {
       ss << "Names.member." << namesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       namesCount++;
     }
   }
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_pageSizeHasBeenSet)
@@ -65,6 +66,6 @@ Aws::String DescribeLoadBalancersRequest::SerializePayload() const
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
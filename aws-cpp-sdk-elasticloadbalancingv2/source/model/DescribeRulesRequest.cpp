@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/DescribeRulesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ DescribeRulesRequest::DescribeRulesRequest() :
 
 Aws::String DescribeRulesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeRules&";
   if(m_listenerArnHasBeenSet)
   {
-    ss << "ListenerArn=" << StringUtils::URLEncode(m_listenerArn.c_str()) << "&";
+    ss << "ListenerArn=" << StringUtils::URLEncoded(m_listenerArn) << "&";
   }
 
   if(m_ruleArnsHasBeenSet)
@@ -40,12 +41,12 @@ Aws::String DescribeRulesRequest::SerializePayload() const
     for(auto& item : m_ruleArns)
     {
       ss << "RuleArns.member." << ruleArnsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       ruleArnsCount++;
     }
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeRulesResult& DescribeRulesResult::operator =(const AmazonWebServiceResul
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeRulesResult")
+  if (rootNode.GetNameView() != "DescribeRulesResult")
   {
     resultNode = rootNode.FirstChild("DescribeRulesResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/DescribeSSLPoliciesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ DescribeSSLPoliciesRequest::DescribeSSLPoliciesRequest() :
 
 Aws::String DescribeSSLPoliciesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeSSLPolicies&";
   if(m_namesHasBeenSet)
   {
@@ -37,14 +38,14 @@ Aws::String DescribeSSLPoliciesRequest::SerializePayload() const
     for(auto& item : m_names)
     {
       ss << "Names.member." << namesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       namesCount++;
     }
   }
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_pageSizeHasBeenSet)
@@ -53,6 +54,6 @@ Aws::String DescribeSSLPoliciesRequest::SerializePayload() const
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeSSLPoliciesResult& DescribeSSLPoliciesResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeSSLPoliciesResult")
+  if (rootNode.GetNameView() != "DescribeSSLPoliciesResult")
   {
     resultNode = rootNode.FirstChild("DescribeSSLPoliciesResult");
   }
@@ -61,7 +61,7 @@ DescribeSSLPoliciesResult& DescribeSSLPoliciesResult::operator =(const AmazonWeb
     XmlNode nextMarkerNode = resultNode.FirstChild("NextMarker");
     if(!nextMarkerNode.IsNull())
     {
-      m_nextMarker = StringUtils::Trim(nextMarkerNode.GetText().c_str());
+      m_nextMarker = nextMarkerNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/DescribeTagsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -26,7 +27,7 @@ DescribeTagsRequest::DescribeTagsRequest() :
 
 Aws::String DescribeTagsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeTags&";
   if(m_resourceArnsHasBeenSet)
   {
@@ -34,12 +35,12 @@ Aws::String DescribeTagsRequest::SerializePayload() const
     for(auto& item : m_resourceArns)
     {
       ss << "ResourceArns.member." << resourceArnsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       resourceArnsCount++;
     }
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeTagsResult& DescribeTagsResult::operator =(const AmazonWebServiceResult<
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeTagsResult")
+  if (rootNode.GetNameView() != "DescribeTagsResult")
   {
     resultNode = rootNode.FirstChild("DescribeTagsResult");
   }
@@ -40,7 +40,7 @@ DescribeTargetGroupAttributesResult& DescribeTargetGroupAttributesResult::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeTargetGroupAttributesResult")
+  if (rootNode.GetNameView() != "DescribeTargetGroupAttributesResult")
   {
     resultNode = rootNode.FirstChild("DescribeTargetGroupAttributesResult");
   }
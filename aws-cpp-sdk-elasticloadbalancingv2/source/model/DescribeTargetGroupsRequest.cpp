@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/DescribeTargetGroupsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -31,11 +32,11 @@ DescribeTargetGroupsRequest::DescribeTargetGroupsRequest() :
 
 Aws::String DescribeTargetGroupsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeTargetGroups&";
   if(m_loadBalancerArnHasBeenSet)
   {
-    ss << "LoadBalancerArn=" << StringUtils::URLEncode(m_loadBalancerArn.c_str()) << "&";
+    ss << "LoadBalancerArn=" << StringUtils::URLEncoded(m_loadBalancerArn) << "&";
   }
 
   if(m_targetGroupArnsHasBeenSet)
@@ -44,7 +45,7 @@ Aws::String DescribeTargetGroupsRequest::SerializePayload() const
     for(auto& item : m_targetGroupArns)
     {
       ss << "TargetGroupArns.member." << targetGroupArnsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       targetGroupArnsCount++;
     }
   }
@@ -55,14 +56,14 @@ Aws::String DescribeTargetGroupsRequest::SerializePayload() const
     for(auto& item : m_names)
     {
       ss << "Names.member." << namesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       namesCount++;
     }
   }
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_pageSizeHasBeenSet)
@@ -71,6 +72,6 @@ Aws::String DescribeTargetGroupsRequest::SerializePayload() const
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeTargetGroupsResult& DescribeTargetGroupsResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeTargetGroupsResult")
+  if (rootNode.GetNameView() != "DescribeTargetGroupsResult")
   {
     resultNode = rootNode.FirstChild("DescribeTargetGroupsResult");
   }
@@ -61,7 +61,7 @@ DescribeTargetGroupsResult& DescribeTargetGroupsResult::operator =(const AmazonW
     XmlNode nextMarkerNode = resultNode.FirstChild("NextMarker");
     if(!nextMarkerNode.IsNull())
     {
-      m_nextMarker = StringUtils::Trim(nextMarkerNode.GetText().c_str());
+      m_nextMarker = nextMarkerNode.GetTextView().Trim().ToString();
     }
   }
 
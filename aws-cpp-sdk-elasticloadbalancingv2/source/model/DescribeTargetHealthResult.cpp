@@ -40,7 +40,7 @@ DescribeTargetHealthResult& DescribeTargetHealthResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeTargetHealthResult")
+  if (rootNode.GetNameView() != "DescribeTargetHealthResult")
   {
     resultNode = rootNode.FirstChild("DescribeTargetHealthResult");
   }
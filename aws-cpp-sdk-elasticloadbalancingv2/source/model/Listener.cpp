@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -63,25 +64,25 @@ Listener& Listener::operator =(const XmlNode& xmlNode)
     XmlNode listenerArnNode = resultNode.FirstChild("ListenerArn");
     if(!listenerArnNode.IsNull())
     {
-      m_listenerArn = StringUtils::Trim(listenerArnNode.GetText().c_str());
+      m_listenerArn = listenerArnNode.GetTextView().Trim().ToString();
       m_listenerArnHasBeenSet = true;
     }
     XmlNode loadBalancerArnNode = resultNode.FirstChild("LoadBalancerArn");
     if(!loadBalancerArnNode.IsNull())
     {
-      m_loadBalancerArn = StringUtils::Trim(loadBalancerArnNode.GetText().c_str());
+      m_loadBalancerArn = loadBalancerArnNode.GetTextView().Trim().ToString();
       m_loadBalancerArnHasBeenSet = true;
     }
     XmlNode portNode = resultNode.FirstChild("Port");
     if(!portNode.IsNull())
     {
-      m_port = StringUtils::ConvertToInt32(StringUtils::Trim(portNode.GetText().c_str()).c_str());
+      m_port = StringUtils::ConvertToInt32(portNode.GetTextView().Trim().ToString().c_str());
       m_portHasBeenSet = true;
     }
     XmlNode protocolNode = resultNode.FirstChild("Protocol");
     if(!protocolNode.IsNull())
     {
-      m_protocol = ProtocolEnumMapper::GetProtocolEnumForName(StringUtils::Trim(protocolNode.GetText().c_str()).c_str());
+      m_protocol = ProtocolEnumMapper::GetProtocolEnumForName(protocolNode.GetTextView().Trim().ToString().c_str());
       m_protocolHasBeenSet = true;
     }
     XmlNode certificatesNode = resultNode.FirstChild("Certificates");
@@ -99,7 +100,7 @@ Listener& Listener::operator =(const XmlNode& xmlNode)
     XmlNode sslPolicyNode = resultNode.FirstChild("SslPolicy");
     if(!sslPolicyNode.IsNull())
     {
-      m_sslPolicy = StringUtils::Trim(sslPolicyNode.GetText().c_str());
+      m_sslPolicy = sslPolicyNode.GetTextView().Trim().ToString();
       m_sslPolicyHasBeenSet = true;
     }
     XmlNode defaultActionsNode = resultNode.FirstChild("DefaultActions");
@@ -123,12 +124,12 @@ void Listener::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 {
   if(m_listenerArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ListenerArn=" << StringUtils::URLEncode(m_listenerArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".ListenerArn=" << StringUtils::URLEncoded(m_listenerArn) << "&";
   }
 
   if(m_loadBalancerArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LoadBalancerArn=" << StringUtils::URLEncode(m_loadBalancerArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".LoadBalancerArn=" << StringUtils::URLEncoded(m_loadBalancerArn) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -146,15 +147,15 @@ void Listener::OutputToStream(Aws::OStream& oStream, const char* location, unsig
       unsigned certificatesIdx = 1;
       for(auto& item : m_certificates)
       {
-        Aws::StringStream certificatesSs;
+        Aws::Utils::Stream::StringOutputStream certificatesSs;
         certificatesSs << location << index << locationValue << ".Certificates.member." << certificatesIdx++;
-        item.OutputToStream(oStream, certificatesSs.str().c_str());
+        item.OutputToStream(oStream, certificatesSs.GetString().c_str());
       }
   }
 
   if(m_sslPolicyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SslPolicy=" << StringUtils::URLEncode(m_sslPolicy.c_str()) << "&";
+      oStream << location << index << locationValue << ".SslPolicy=" << StringUtils::URLEncoded(m_sslPolicy) << "&";
   }
 
   if(m_defaultActionsHasBeenSet)
@@ -162,9 +163,9 @@ void Listener::OutputToStream(Aws::OStream& oStream, const char* location, unsig
       unsigned defaultActionsIdx = 1;
       for(auto& item : m_defaultActions)
       {
-        Aws::StringStream defaultActionsSs;
+        Aws::Utils::Stream::StringOutputStream defaultActionsSs;
         defaultActionsSs << location << index << locationValue << ".DefaultActions.member." << defaultActionsIdx++;
-        item.OutputToStream(oStream, defaultActionsSs.str().c_str());
+        item.OutputToStream(oStream, defaultActionsSs.GetString().c_str());
       }
   }
 
@@ -174,11 +175,11 @@ void Listener::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_listenerArnHasBeenSet)
   {
-      oStream << location << ".ListenerArn=" << StringUtils::URLEncode(m_listenerArn.c_str()) << "&";
+      oStream << location << ".ListenerArn=" << StringUtils::URLEncoded(m_listenerArn) << "&";
   }
   if(m_loadBalancerArnHasBeenSet)
   {
-      oStream << location << ".LoadBalancerArn=" << StringUtils::URLEncode(m_loadBalancerArn.c_str()) << "&";
+      oStream << location << ".LoadBalancerArn=" << StringUtils::URLEncoded(m_loadBalancerArn) << "&";
   }
   if(m_portHasBeenSet)
   {
@@ -193,23 +194,23 @@ void Listener::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned certificatesIdx = 1;
       for(auto& item : m_certificates)
       {
-        Aws::StringStream certificatesSs;
+        Aws::Utils::Stream::StringOutputStream certificatesSs;
         certificatesSs << location <<  ".Certificates.member." << certificatesIdx++;
-        item.OutputToStream(oStream, certificatesSs.str().c_str());
+        item.OutputToStream(oStream, certificatesSs.GetString().c_str());
       }
   }
   if(m_sslPolicyHasBeenSet)
   {
-      oStream << location << ".SslPolicy=" << StringUtils::URLEncode(m_sslPolicy.c_str()) << "&";
+      oStream << location << ".SslPolicy=" << StringUtils::URLEncoded(m_sslPolicy) << "&";
   }
   if(m_defaultActionsHasBeenSet)
   {
       unsigned defaultActionsIdx = 1;
       for(auto& item : m_defaultActions)
       {
-        Aws::StringStream defaultActionsSs;
+        Aws::Utils::Stream::StringOutputStream defaultActionsSs;
         defaultActionsSs << location <<  ".DefaultActions.member." << defaultActionsIdx++;
-        item.OutputToStream(oStream, defaultActionsSs.str().c_str());
+        item.OutputToStream(oStream, defaultActionsSs.GetString().c_str());
       }
   }
 }
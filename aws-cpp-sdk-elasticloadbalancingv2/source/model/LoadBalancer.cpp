@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -69,43 +70,43 @@ LoadBalancer& LoadBalancer::operator =(const XmlNode& xmlNode)
     XmlNode loadBalancerArnNode = resultNode.FirstChild("LoadBalancerArn");
     if(!loadBalancerArnNode.IsNull())
     {
-      m_loadBalancerArn = StringUtils::Trim(loadBalancerArnNode.GetText().c_str());
+      m_loadBalancerArn = loadBalancerArnNode.GetTextView().Trim().ToString();
       m_loadBalancerArnHasBeenSet = true;
     }
     XmlNode dNSNameNode = resultNode.FirstChild("DNSName");
     if(!dNSNameNode.IsNull())
     {
-      m_dNSName = StringUtils::Trim(dNSNameNode.GetText().c_str());
+      m_dNSName = dNSNameNode.GetTextView().Trim().ToString();
       m_dNSNameHasBeenSet = true;
     }
     XmlNode canonicalHostedZoneIdNode = resultNode.FirstChild("CanonicalHostedZoneId");
     if(!canonicalHostedZoneIdNode.IsNull())
     {
-      m_canonicalHostedZoneId = StringUtils::Trim(canonicalHostedZoneIdNode.GetText().c_str());
+      m_canonicalHostedZoneId = canonicalHostedZoneIdNode.GetTextView().Trim().ToString();
       m_canonicalHostedZoneIdHasBeenSet = true;
     }
     XmlNode createdTimeNode = resultNode.FirstChild("CreatedTime");
     if(!createdTimeNode.IsNull())
     {
-      m_createdTime = DateTime(StringUtils::Trim(createdTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createdTime = DateTime(createdTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createdTimeHasBeenSet = true;
     }
     XmlNode loadBalancerNameNode = resultNode.FirstChild("LoadBalancerName");
     if(!loadBalancerNameNode.IsNull())
     {
-      m_loadBalancerName = StringUtils::Trim(loadBalancerNameNode.GetText().c_str());
+      m_loadBalancerName = loadBalancerNameNode.GetTextView().Trim().ToString();
       m_loadBalancerNameHasBeenSet = true;
     }
     XmlNode schemeNode = resultNode.FirstChild("Scheme");
     if(!schemeNode.IsNull())
     {
-      m_scheme = LoadBalancerSchemeEnumMapper::GetLoadBalancerSchemeEnumForName(StringUtils::Trim(schemeNode.GetText().c_str()).c_str());
+      m_scheme = LoadBalancerSchemeEnumMapper::GetLoadBalancerSchemeEnumForName(schemeNode.GetTextView().Trim().ToString().c_str());
       m_schemeHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("VpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("State");
@@ -117,7 +118,7 @@ LoadBalancer& LoadBalancer::operator =(const XmlNode& xmlNode)
     XmlNode typeNode = resultNode.FirstChild("Type");
     if(!typeNode.IsNull())
     {
-      m_type = LoadBalancerTypeEnumMapper::GetLoadBalancerTypeEnumForName(StringUtils::Trim(typeNode.GetText().c_str()).c_str());
+      m_type = LoadBalancerTypeEnumMapper::GetLoadBalancerTypeEnumForName(typeNode.GetTextView().Trim().ToString().c_str());
       m_typeHasBeenSet = true;
     }
     XmlNode availabilityZonesNode = resultNode.FirstChild("AvailabilityZones");
@@ -138,7 +139,7 @@ LoadBalancer& LoadBalancer::operator =(const XmlNode& xmlNode)
       XmlNode securityGroupsMember = securityGroupsNode.FirstChild("member");
       while(!securityGroupsMember.IsNull())
       {
-        m_securityGroups.push_back(StringUtils::Trim(securityGroupsMember.GetText().c_str()));
+        m_securityGroups.push_back(securityGroupsMember.GetTextView().Trim().ToString());
         securityGroupsMember = securityGroupsMember.NextNode("member");
       }
 
@@ -153,27 +154,27 @@ void LoadBalancer::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_loadBalancerArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LoadBalancerArn=" << StringUtils::URLEncode(m_loadBalancerArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".LoadBalancerArn=" << StringUtils::URLEncoded(m_loadBalancerArn) << "&";
   }
 
   if(m_dNSNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DNSName=" << StringUtils::URLEncode(m_dNSName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DNSName=" << StringUtils::URLEncoded(m_dNSName) << "&";
   }
 
   if(m_canonicalHostedZoneIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CanonicalHostedZoneId=" << StringUtils::URLEncode(m_canonicalHostedZoneId.c_str()) << "&";
+      oStream << location << index << locationValue << ".CanonicalHostedZoneId=" << StringUtils::URLEncoded(m_canonicalHostedZoneId) << "&";
   }
 
   if(m_createdTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreatedTime=" << StringUtils::URLEncode(m_createdTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreatedTime=" << StringUtils::URLEncoded(m_createdTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_loadBalancerNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+      oStream << location << index << locationValue << ".LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
 
   if(m_schemeHasBeenSet)
@@ -183,14 +184,14 @@ void LoadBalancer::OutputToStream(Aws::OStream& oStream, const char* location, u
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_stateHasBeenSet)
   {
-      Aws::StringStream stateLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream stateLocationAndMemberSs;
       stateLocationAndMemberSs << location << index << locationValue << ".State";
-      m_state.OutputToStream(oStream, stateLocationAndMemberSs.str().c_str());
+      m_state.OutputToStream(oStream, stateLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_typeHasBeenSet)
@@ -203,9 +204,9 @@ void LoadBalancer::OutputToStream(Aws::OStream& oStream, const char* location, u
       unsigned availabilityZonesIdx = 1;
       for(auto& item : m_availabilityZones)
       {
-        Aws::StringStream availabilityZonesSs;
+        Aws::Utils::Stream::StringOutputStream availabilityZonesSs;
         availabilityZonesSs << location << index << locationValue << ".AvailabilityZones.member." << availabilityZonesIdx++;
-        item.OutputToStream(oStream, availabilityZonesSs.str().c_str());
+        item.OutputToStream(oStream, availabilityZonesSs.GetString().c_str());
       }
   }
 
@@ -214,7 +215,7 @@ void LoadBalancer::OutputToStream(Aws::OStream& oStream, const char* location, u
       unsigned securityGroupsIdx = 1;
       for(auto& item : m_securityGroups)
       {
-        oStream << location << index << locationValue << ".SecurityGroups.member." << securityGroupsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".SecurityGroups.member." << securityGroupsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -224,23 +225,23 @@ void LoadBalancer::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_loadBalancerArnHasBeenSet)
   {
-      oStream << location << ".LoadBalancerArn=" << StringUtils::URLEncode(m_loadBalancerArn.c_str()) << "&";
+      oStream << location << ".LoadBalancerArn=" << StringUtils::URLEncoded(m_loadBalancerArn) << "&";
   }
   if(m_dNSNameHasBeenSet)
   {
-      oStream << location << ".DNSName=" << StringUtils::URLEncode(m_dNSName.c_str()) << "&";
+      oStream << location << ".DNSName=" << StringUtils::URLEncoded(m_dNSName) << "&";
   }
   if(m_canonicalHostedZoneIdHasBeenSet)
   {
-      oStream << location << ".CanonicalHostedZoneId=" << StringUtils::URLEncode(m_canonicalHostedZoneId.c_str()) << "&";
+      oStream << location << ".CanonicalHostedZoneId=" << StringUtils::URLEncoded(m_canonicalHostedZoneId) << "&";
   }
   if(m_createdTimeHasBeenSet)
   {
-      oStream << location << ".CreatedTime=" << StringUtils::URLEncode(m_createdTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreatedTime=" << StringUtils::URLEncoded(m_createdTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_loadBalancerNameHasBeenSet)
   {
-      oStream << location << ".LoadBalancerName=" << StringUtils::URLEncode(m_loadBalancerName.c_str()) << "&";
+      oStream << location << ".LoadBalancerName=" << StringUtils::URLEncoded(m_loadBalancerName) << "&";
   }
   if(m_schemeHasBeenSet)
   {
@@ -248,7 +249,7 @@ void LoadBalancer::OutputToStream(Aws::OStream& oStream, const char* location) c
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_stateHasBeenSet)
   {
@@ -265,9 +266,9 @@ void LoadBalancer::OutputToStream(Aws::OStream& oStream, const char* location) c
       unsigned availabilityZonesIdx = 1;
       for(auto& item : m_availabilityZones)
       {
-        Aws::StringStream availabilityZonesSs;
+        Aws::Utils::Stream::StringOutputStream availabilityZonesSs;
         availabilityZonesSs << location <<  ".AvailabilityZones.member." << availabilityZonesIdx++;
-        item.OutputToStream(oStream, availabilityZonesSs.str().c_str());
+        item.OutputToStream(oStream, availabilityZonesSs.GetString().c_str());
       }
   }
   if(m_securityGroupsHasBeenSet)
@@ -275,7 +276,7 @@ void LoadBalancer::OutputToStream(Aws::OStream& oStream, const char* location) c
       unsigned securityGroupsIdx = 1;
       for(auto& item : m_securityGroups)
       {
-        oStream << location << ".SecurityGroups.member." << securityGroupsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".SecurityGroups.member." << securityGroupsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
@@ -29,21 +29,29 @@ namespace Aws
       namespace LoadBalancerSchemeEnumMapper
       {
 
-        static const int internet_facing_HASH = HashingUtils::HashString("internet-facing");
-        static const int internal_HASH = HashingUtils::HashString("internal");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int internet_facing_HASH = -616892442;
+        static const int internal_HASH = 570410685;
 
 
         LoadBalancerSchemeEnum GetLoadBalancerSchemeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == internet_facing_HASH)
+          switch (hashCode)
           {
+          case internet_facing_HASH:
             return LoadBalancerSchemeEnum::internet_facing;
-          }
-          else if (hashCode == internal_HASH)
-          {
+          case internal_HASH:
             return LoadBalancerSchemeEnum::internal;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -51,13 +51,13 @@ LoadBalancerState& LoadBalancerState::operator =(const XmlNode& xmlNode)
     XmlNode codeNode = resultNode.FirstChild("Code");
     if(!codeNode.IsNull())
     {
-      m_code = LoadBalancerStateEnumMapper::GetLoadBalancerStateEnumForName(StringUtils::Trim(codeNode.GetText().c_str()).c_str());
+      m_code = LoadBalancerStateEnumMapper::GetLoadBalancerStateEnumForName(codeNode.GetTextView().Trim().ToString().c_str());
       m_codeHasBeenSet = true;
     }
     XmlNode reasonNode = resultNode.FirstChild("Reason");
     if(!reasonNode.IsNull())
     {
-      m_reason = StringUtils::Trim(reasonNode.GetText().c_str());
+      m_reason = reasonNode.GetTextView().Trim().ToString();
       m_reasonHasBeenSet = true;
     }
   }
@@ -74,7 +74,7 @@ void LoadBalancerState::OutputToStream(Aws::OStream& oStream, const char* locati
 
   if(m_reasonHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Reason=" << StringUtils::URLEncode(m_reason.c_str()) << "&";
+      oStream << location << index << locationValue << ".Reason=" << StringUtils::URLEncoded(m_reason) << "&";
   }
 
 }
@@ -87,7 +87,7 @@ void LoadBalancerState::OutputToStream(Aws::OStream& oStream, const char* locati
   }
   if(m_reasonHasBeenSet)
   {
-      oStream << location << ".Reason=" << StringUtils::URLEncode(m_reason.c_str()) << "&";
+      oStream << location << ".Reason=" << StringUtils::URLEncoded(m_reason) << "&";
   }
 }
 
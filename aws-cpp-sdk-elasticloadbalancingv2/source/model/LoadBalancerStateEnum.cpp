@@ -29,26 +29,32 @@ namespace Aws
       namespace LoadBalancerStateEnumMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int provisioning_HASH = HashingUtils::HashString("provisioning");
-        static const int failed_HASH = HashingUtils::HashString("failed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int active_HASH = -1422950650;
+        static const int provisioning_HASH = 121098989;
+        static const int failed_HASH = -1281977283;
 
 
         LoadBalancerStateEnum GetLoadBalancerStateEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
+          switch (hashCode)
           {
+          case active_HASH:
             return LoadBalancerStateEnum::active;
-          }
-          else if (hashCode == provisioning_HASH)
-          {
+          case provisioning_HASH:
             return LoadBalancerStateEnum::provisioning;
-          }
-          else if (hashCode == failed_HASH)
-          {
+          case failed_HASH:
             return LoadBalancerStateEnum::failed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
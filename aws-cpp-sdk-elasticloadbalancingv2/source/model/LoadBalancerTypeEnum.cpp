@@ -29,16 +29,26 @@ namespace Aws
       namespace LoadBalancerTypeEnumMapper
       {
 
-        static const int application_HASH = HashingUtils::HashString("application");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int application_HASH = 1554253136;
 
 
         LoadBalancerTypeEnum GetLoadBalancerTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == application_HASH)
+          switch (hashCode)
           {
+          case application_HASH:
             return LoadBalancerTypeEnum::application;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -49,7 +49,7 @@ Matcher& Matcher::operator =(const XmlNode& xmlNode)
     XmlNode httpCodeNode = resultNode.FirstChild("HttpCode");
     if(!httpCodeNode.IsNull())
     {
-      m_httpCode = StringUtils::Trim(httpCodeNode.GetText().c_str());
+      m_httpCode = httpCodeNode.GetTextView().Trim().ToString();
       m_httpCodeHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void Matcher::OutputToStream(Aws::OStream& oStream, const char* location, unsign
 {
   if(m_httpCodeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HttpCode=" << StringUtils::URLEncode(m_httpCode.c_str()) << "&";
+      oStream << location << index << locationValue << ".HttpCode=" << StringUtils::URLEncoded(m_httpCode) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void Matcher::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_httpCodeHasBeenSet)
   {
-      oStream << location << ".HttpCode=" << StringUtils::URLEncode(m_httpCode.c_str()) << "&";
+      oStream << location << ".HttpCode=" << StringUtils::URLEncoded(m_httpCode) << "&";
   }
 }
 
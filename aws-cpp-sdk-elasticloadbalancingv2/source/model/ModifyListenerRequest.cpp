@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/ModifyListenerRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -32,11 +33,11 @@ ModifyListenerRequest::ModifyListenerRequest() :
 
 Aws::String ModifyListenerRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyListener&";
   if(m_listenerArnHasBeenSet)
   {
-    ss << "ListenerArn=" << StringUtils::URLEncode(m_listenerArn.c_str()) << "&";
+    ss << "ListenerArn=" << StringUtils::URLEncoded(m_listenerArn) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -51,7 +52,7 @@ Aws::String ModifyListenerRequest::SerializePayload() const
 
   if(m_sslPolicyHasBeenSet)
   {
-    ss << "SslPolicy=" << StringUtils::URLEncode(m_sslPolicy.c_str()) << "&";
+    ss << "SslPolicy=" << StringUtils::URLEncoded(m_sslPolicy) << "&";
   }
 
   if(m_certificatesHasBeenSet)
@@ -75,6 +76,6 @@ Aws::String ModifyListenerRequest::SerializePayload() const
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
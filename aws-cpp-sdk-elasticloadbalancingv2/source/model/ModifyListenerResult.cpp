@@ -40,7 +40,7 @@ ModifyListenerResult& ModifyListenerResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyListenerResult")
+  if (rootNode.GetNameView() != "ModifyListenerResult")
   {
     resultNode = rootNode.FirstChild("ModifyListenerResult");
   }
@@ -40,7 +40,7 @@ ModifyLoadBalancerAttributesResult& ModifyLoadBalancerAttributesResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyLoadBalancerAttributesResult")
+  if (rootNode.GetNameView() != "ModifyLoadBalancerAttributesResult")
   {
     resultNode = rootNode.FirstChild("ModifyLoadBalancerAttributesResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/ModifyRuleRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -28,11 +29,11 @@ ModifyRuleRequest::ModifyRuleRequest() :
 
 Aws::String ModifyRuleRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyRule&";
   if(m_ruleArnHasBeenSet)
   {
-    ss << "RuleArn=" << StringUtils::URLEncode(m_ruleArn.c_str()) << "&";
+    ss << "RuleArn=" << StringUtils::URLEncoded(m_ruleArn) << "&";
   }
 
   if(m_conditionsHasBeenSet)
@@ -56,6 +57,6 @@ Aws::String ModifyRuleRequest::SerializePayload() const
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
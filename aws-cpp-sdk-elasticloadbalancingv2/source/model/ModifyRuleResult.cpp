@@ -40,7 +40,7 @@ ModifyRuleResult& ModifyRuleResult::operator =(const AmazonWebServiceResult<XmlD
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyRuleResult")
+  if (rootNode.GetNameView() != "ModifyRuleResult")
   {
     resultNode = rootNode.FirstChild("ModifyRuleResult");
   }
@@ -40,7 +40,7 @@ ModifyTargetGroupAttributesResult& ModifyTargetGroupAttributesResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyTargetGroupAttributesResult")
+  if (rootNode.GetNameView() != "ModifyTargetGroupAttributesResult")
   {
     resultNode = rootNode.FirstChild("ModifyTargetGroupAttributesResult");
   }
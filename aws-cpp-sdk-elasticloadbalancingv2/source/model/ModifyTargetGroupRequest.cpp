@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/ModifyTargetGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -38,11 +39,11 @@ ModifyTargetGroupRequest::ModifyTargetGroupRequest() :
 
 Aws::String ModifyTargetGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyTargetGroup&";
   if(m_targetGroupArnHasBeenSet)
   {
-    ss << "TargetGroupArn=" << StringUtils::URLEncode(m_targetGroupArn.c_str()) << "&";
+    ss << "TargetGroupArn=" << StringUtils::URLEncoded(m_targetGroupArn) << "&";
   }
 
   if(m_healthCheckProtocolHasBeenSet)
@@ -52,12 +53,12 @@ Aws::String ModifyTargetGroupRequest::SerializePayload() const
 
   if(m_healthCheckPortHasBeenSet)
   {
-    ss << "HealthCheckPort=" << StringUtils::URLEncode(m_healthCheckPort.c_str()) << "&";
+    ss << "HealthCheckPort=" << StringUtils::URLEncoded(m_healthCheckPort) << "&";
   }
 
   if(m_healthCheckPathHasBeenSet)
   {
-    ss << "HealthCheckPath=" << StringUtils::URLEncode(m_healthCheckPath.c_str()) << "&";
+    ss << "HealthCheckPath=" << StringUtils::URLEncoded(m_healthCheckPath) << "&";
   }
 
   if(m_healthCheckIntervalSecondsHasBeenSet)
@@ -86,6 +87,6 @@ Aws::String ModifyTargetGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
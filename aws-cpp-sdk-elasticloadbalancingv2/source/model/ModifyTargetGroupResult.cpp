@@ -40,7 +40,7 @@ ModifyTargetGroupResult& ModifyTargetGroupResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyTargetGroupResult")
+  if (rootNode.GetNameView() != "ModifyTargetGroupResult")
   {
     resultNode = rootNode.FirstChild("ModifyTargetGroupResult");
   }
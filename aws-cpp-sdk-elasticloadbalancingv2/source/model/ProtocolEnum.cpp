@@ -29,21 +29,29 @@ namespace Aws
       namespace ProtocolEnumMapper
       {
 
-        static const int HTTP_HASH = HashingUtils::HashString("HTTP");
-        static const int HTTPS_HASH = HashingUtils::HashString("HTTPS");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int HTTP_HASH = 2228360;
+        static const int HTTPS_HASH = 69079243;
 
 
         ProtocolEnum GetProtocolEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTTP_HASH)
+          switch (hashCode)
           {
+          case HTTP_HASH:
             return ProtocolEnum::HTTP;
-          }
-          else if (hashCode == HTTPS_HASH)
-          {
+          case HTTPS_HASH:
             return ProtocolEnum::HTTPS;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
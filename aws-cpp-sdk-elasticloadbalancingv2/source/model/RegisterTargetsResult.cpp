@@ -40,7 +40,7 @@ RegisterTargetsResult& RegisterTargetsResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RegisterTargetsResult")
+  if (rootNode.GetNameView() != "RegisterTargetsResult")
   {
     resultNode = rootNode.FirstChild("RegisterTargetsResult");
   }
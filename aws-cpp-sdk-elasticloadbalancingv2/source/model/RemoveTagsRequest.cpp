@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/RemoveTagsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -27,7 +28,7 @@ RemoveTagsRequest::RemoveTagsRequest() :
 
 Aws::String RemoveTagsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=RemoveTags&";
   if(m_resourceArnsHasBeenSet)
   {
@@ -35,7 +36,7 @@ Aws::String RemoveTagsRequest::SerializePayload() const
     for(auto& item : m_resourceArns)
     {
       ss << "ResourceArns.member." << resourceArnsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       resourceArnsCount++;
     }
   }
@@ -46,12 +47,12 @@ Aws::String RemoveTagsRequest::SerializePayload() const
     for(auto& item : m_tagKeys)
     {
       ss << "TagKeys.member." << tagKeysCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       tagKeysCount++;
     }
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ RemoveTagsResult& RemoveTagsResult::operator =(const AmazonWebServiceResult<XmlD
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RemoveTagsResult")
+  if (rootNode.GetNameView() != "RemoveTagsResult")
   {
     resultNode = rootNode.FirstChild("RemoveTagsResult");
   }
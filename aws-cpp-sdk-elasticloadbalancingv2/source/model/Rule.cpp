@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,13 +60,13 @@ Rule& Rule::operator =(const XmlNode& xmlNode)
     XmlNode ruleArnNode = resultNode.FirstChild("RuleArn");
     if(!ruleArnNode.IsNull())
     {
-      m_ruleArn = StringUtils::Trim(ruleArnNode.GetText().c_str());
+      m_ruleArn = ruleArnNode.GetTextView().Trim().ToString();
       m_ruleArnHasBeenSet = true;
     }
     XmlNode priorityNode = resultNode.FirstChild("Priority");
     if(!priorityNode.IsNull())
     {
-      m_priority = StringUtils::Trim(priorityNode.GetText().c_str());
+      m_priority = priorityNode.GetTextView().Trim().ToString();
       m_priorityHasBeenSet = true;
     }
     XmlNode conditionsNode = resultNode.FirstChild("Conditions");
@@ -95,7 +96,7 @@ Rule& Rule::operator =(const XmlNode& xmlNode)
     XmlNode isDefaultNode = resultNode.FirstChild("IsDefault");
     if(!isDefaultNode.IsNull())
     {
-      m_isDefault = StringUtils::ConvertToBool(StringUtils::Trim(isDefaultNode.GetText().c_str()).c_str());
+      m_isDefault = StringUtils::ConvertToBool(isDefaultNode.GetTextView().Trim().ToString().c_str());
       m_isDefaultHasBeenSet = true;
     }
   }
@@ -107,12 +108,12 @@ void Rule::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 {
   if(m_ruleArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RuleArn=" << StringUtils::URLEncode(m_ruleArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".RuleArn=" << StringUtils::URLEncoded(m_ruleArn) << "&";
   }
 
   if(m_priorityHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Priority=" << StringUtils::URLEncode(m_priority.c_str()) << "&";
+      oStream << location << index << locationValue << ".Priority=" << StringUtils::URLEncoded(m_priority) << "&";
   }
 
   if(m_conditionsHasBeenSet)
@@ -120,9 +121,9 @@ void Rule::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
       unsigned conditionsIdx = 1;
       for(auto& item : m_conditions)
       {
-        Aws::StringStream conditionsSs;
+        Aws::Utils::Stream::StringOutputStream conditionsSs;
         conditionsSs << location << index << locationValue << ".Conditions.member." << conditionsIdx++;
-        item.OutputToStream(oStream, conditionsSs.str().c_str());
+        item.OutputToStream(oStream, conditionsSs.GetString().c_str());
       }
   }
 
@@ -131,9 +132,9 @@ void Rule::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
       unsigned actionsIdx = 1;
       for(auto& item : m_actions)
       {
-        Aws::StringStream actionsSs;
+        Aws::Utils::Stream::StringOutputStream actionsSs;
         actionsSs << location << index << locationValue << ".Actions.member." << actionsIdx++;
-        item.OutputToStream(oStream, actionsSs.str().c_str());
+        item.OutputToStream(oStream, actionsSs.GetString().c_str());
       }
   }
 
@@ -148,20 +149,20 @@ void Rule::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_ruleArnHasBeenSet)
   {
-      oStream << location << ".RuleArn=" << StringUtils::URLEncode(m_ruleArn.c_str()) << "&";
+      oStream << location << ".RuleArn=" << StringUtils::URLEncoded(m_ruleArn) << "&";
   }
   if(m_priorityHasBeenSet)
   {
-      oStream << location << ".Priority=" << StringUtils::URLEncode(m_priority.c_str()) << "&";
+      oStream << location << ".Priority=" << StringUtils::URLEncoded(m_priority) << "&";
   }
   if(m_conditionsHasBeenSet)
   {
       unsigned conditionsIdx = 1;
       for(auto& item : m_conditions)
       {
-        Aws::StringStream conditionsSs;
+        Aws::Utils::Stream::StringOutputStream conditionsSs;
         conditionsSs << location <<  ".Conditions.member." << conditionsIdx++;
-        item.OutputToStream(oStream, conditionsSs.str().c_str());
+        item.OutputToStream(oStream, conditionsSs.GetString().c_str());
       }
   }
   if(m_actionsHasBeenSet)
@@ -169,9 +170,9 @@ void Rule::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned actionsIdx = 1;
       for(auto& item : m_actions)
       {
-        Aws::StringStream actionsSs;
+        Aws::Utils::Stream::StringOutputStream actionsSs;
         actionsSs << location <<  ".Actions.member." << actionsIdx++;
-        item.OutputToStream(oStream, actionsSs.str().c_str());
+        item.OutputToStream(oStream, actionsSs.GetString().c_str());
       }
   }
   if(m_isDefaultHasBeenSet)
@@ -51,7 +51,7 @@ RuleCondition& RuleCondition::operator =(const XmlNode& xmlNode)
     XmlNode fieldNode = resultNode.FirstChild("Field");
     if(!fieldNode.IsNull())
     {
-      m_field = StringUtils::Trim(fieldNode.GetText().c_str());
+      m_field = fieldNode.GetTextView().Trim().ToString();
       m_fieldHasBeenSet = true;
     }
     XmlNode valuesNode = resultNode.FirstChild("Values");
@@ -60,7 +60,7 @@ RuleCondition& RuleCondition::operator =(const XmlNode& xmlNode)
       XmlNode valuesMember = valuesNode.FirstChild("member");
       while(!valuesMember.IsNull())
       {
-        m_values.push_back(StringUtils::Trim(valuesMember.GetText().c_str()));
+        m_values.push_back(valuesMember.GetTextView().Trim().ToString());
         valuesMember = valuesMember.NextNode("member");
       }
 
@@ -75,7 +75,7 @@ void RuleCondition::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_fieldHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Field=" << StringUtils::URLEncode(m_field.c_str()) << "&";
+      oStream << location << index << locationValue << ".Field=" << StringUtils::URLEncoded(m_field) << "&";
   }
 
   if(m_valuesHasBeenSet)
@@ -83,7 +83,7 @@ void RuleCondition::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned valuesIdx = 1;
       for(auto& item : m_values)
       {
-        oStream << location << index << locationValue << ".Values.member." << valuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".Values.member." << valuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -93,14 +93,14 @@ void RuleCondition::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_fieldHasBeenSet)
   {
-      oStream << location << ".Field=" << StringUtils::URLEncode(m_field.c_str()) << "&";
+      oStream << location << ".Field=" << StringUtils::URLEncoded(m_field) << "&";
   }
   if(m_valuesHasBeenSet)
   {
       unsigned valuesIdx = 1;
       for(auto& item : m_values)
       {
-        oStream << location << ".Values.member." << valuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".Values.member." << valuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
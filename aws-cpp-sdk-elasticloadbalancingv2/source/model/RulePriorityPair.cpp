@@ -53,13 +53,13 @@ RulePriorityPair& RulePriorityPair::operator =(const XmlNode& xmlNode)
     XmlNode ruleArnNode = resultNode.FirstChild("RuleArn");
     if(!ruleArnNode.IsNull())
     {
-      m_ruleArn = StringUtils::Trim(ruleArnNode.GetText().c_str());
+      m_ruleArn = ruleArnNode.GetTextView().Trim().ToString();
       m_ruleArnHasBeenSet = true;
     }
     XmlNode priorityNode = resultNode.FirstChild("Priority");
     if(!priorityNode.IsNull())
     {
-      m_priority = StringUtils::ConvertToInt32(StringUtils::Trim(priorityNode.GetText().c_str()).c_str());
+      m_priority = StringUtils::ConvertToInt32(priorityNode.GetTextView().Trim().ToString().c_str());
       m_priorityHasBeenSet = true;
     }
   }
@@ -71,7 +71,7 @@ void RulePriorityPair::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_ruleArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RuleArn=" << StringUtils::URLEncode(m_ruleArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".RuleArn=" << StringUtils::URLEncoded(m_ruleArn) << "&";
   }
 
   if(m_priorityHasBeenSet)
@@ -85,7 +85,7 @@ void RulePriorityPair::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_ruleArnHasBeenSet)
   {
-      oStream << location << ".RuleArn=" << StringUtils::URLEncode(m_ruleArn.c_str()) << "&";
+      oStream << location << ".RuleArn=" << StringUtils::URLEncoded(m_ruleArn) << "&";
   }
   if(m_priorityHasBeenSet)
   {
@@ -15,6 +15,7 @@
 #include <aws/elasticloadbalancingv2/model/SetRulePrioritiesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ElasticLoadBalancingv2::Model;
 using namespace Aws::Utils;
@@ -26,7 +27,7 @@ SetRulePrioritiesRequest::SetRulePrioritiesRequest() :
 
 Aws::String SetRulePrioritiesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SetRulePriorities&";
   if(m_rulePrioritiesHasBeenSet)
   {
@@ -39,6 +40,6 @@ Aws::String SetRulePrioritiesRequest::SerializePayload() const
   }
 
   ss << "Version=2015-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
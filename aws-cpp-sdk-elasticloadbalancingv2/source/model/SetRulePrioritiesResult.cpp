@@ -40,7 +40,7 @@ SetRulePrioritiesResult& SetRulePrioritiesResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SetRulePrioritiesResult")
+  if (rootNode.GetNameView() != "SetRulePrioritiesResult")
   {
     resultNode = rootNode.FirstChild("SetRulePrioritiesResult");
   }
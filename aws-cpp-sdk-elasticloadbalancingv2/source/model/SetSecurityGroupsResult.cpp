@@ -40,7 +40,7 @@ SetSecurityGroupsResult& SetSecurityGroupsResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SetSecurityGroupsResult")
+  if (rootNode.GetNameView() != "SetSecurityGroupsResult")
   {
     resultNode = rootNode.FirstChild("SetSecurityGroupsResult");
   }
@@ -53,7 +53,7 @@ SetSecurityGroupsResult& SetSecurityGroupsResult::operator =(const AmazonWebServ
       XmlNode securityGroupIdsMember = securityGroupIdsNode.FirstChild("member");
       while(!securityGroupIdsMember.IsNull())
       {
-        m_securityGroupIds.push_back(StringUtils::Trim(securityGroupIdsMember.GetText().c_str()));
+        m_securityGroupIds.push_back(securityGroupIdsMember.GetTextView().Trim().ToString());
         securityGroupIdsMember = securityGroupIdsMember.NextNode("member");
       }
 
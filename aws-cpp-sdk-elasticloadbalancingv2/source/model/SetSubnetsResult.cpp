@@ -40,7 +40,7 @@ SetSubnetsResult& SetSubnetsResult::operator =(const AmazonWebServiceResult<XmlD
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SetSubnetsResult")
+  if (rootNode.GetNameView() != "SetSubnetsResult")
   {
     resultNode = rootNode.FirstChild("SetSubnetsResult");
   }
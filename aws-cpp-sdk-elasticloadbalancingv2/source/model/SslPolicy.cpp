@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -56,7 +57,7 @@ SslPolicy& SslPolicy::operator =(const XmlNode& xmlNode)
       XmlNode sslProtocolsMember = sslProtocolsNode.FirstChild("member");
       while(!sslProtocolsMember.IsNull())
       {
-        m_sslProtocols.push_back(StringUtils::Trim(sslProtocolsMember.GetText().c_str()));
+        m_sslProtocols.push_back(sslProtocolsMember.GetTextView().Trim().ToString());
         sslProtocolsMember = sslProtocolsMember.NextNode("member");
       }
 
@@ -77,7 +78,7 @@ SslPolicy& SslPolicy::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
   }
@@ -92,7 +93,7 @@ void SslPolicy::OutputToStream(Aws::OStream& oStream, const char* location, unsi
       unsigned sslProtocolsIdx = 1;
       for(auto& item : m_sslProtocols)
       {
-        oStream << location << index << locationValue << ".SslProtocols.member." << sslProtocolsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".SslProtocols.member." << sslProtocolsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -101,15 +102,15 @@ void SslPolicy::OutputToStream(Aws::OStream& oStream, const char* location, unsi
       unsigned ciphersIdx = 1;
       for(auto& item : m_ciphers)
       {
-        Aws::StringStream ciphersSs;
+        Aws::Utils::Stream::StringOutputStream ciphersSs;
         ciphersSs << location << index << locationValue << ".Ciphers.member." << ciphersIdx++;
-        item.OutputToStream(oStream, ciphersSs.str().c_str());
+        item.OutputToStream(oStream, ciphersSs.GetString().c_str());
       }
   }
 
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
 }
@@ -121,7 +122,7 @@ void SslPolicy::OutputToStream(Aws::OStream& oStream, const char* location) cons
       unsigned sslProtocolsIdx = 1;
       for(auto& item : m_sslProtocols)
       {
-        oStream << location << ".SslProtocols.member." << sslProtocolsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".SslProtocols.member." << sslProtocolsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_ciphersHasBeenSet)
@@ -129,14 +130,14 @@ void SslPolicy::OutputToStream(Aws::OStream& oStream, const char* location) cons
       unsigned ciphersIdx = 1;
       for(auto& item : m_ciphers)
       {
-        Aws::StringStream ciphersSs;
+        Aws::Utils::Stream::StringOutputStream ciphersSs;
         ciphersSs << location <<  ".Ciphers.member." << ciphersIdx++;
-        item.OutputToStream(oStream, ciphersSs.str().c_str());
+        item.OutputToStream(oStream, ciphersSs.GetString().c_str());
       }
   }
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ TagDescription& TagDescription::operator =(const XmlNode& xmlNode)
     XmlNode resourceArnNode = resultNode.FirstChild("ResourceArn");
     if(!resourceArnNode.IsNull())
     {
-      m_resourceArn = StringUtils::Trim(resourceArnNode.GetText().c_str());
+      m_resourceArn = resourceArnNode.GetTextView().Trim().ToString();
       m_resourceArnHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("Tags");
@@ -75,7 +76,7 @@ void TagDescription::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_resourceArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceArn=" << StringUtils::URLEncode(m_resourceArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceArn=" << StringUtils::URLEncoded(m_resourceArn) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -83,9 +84,9 @@ void TagDescription::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".Tags.member." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -95,16 +96,16 @@ void TagDescription::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_resourceArnHasBeenSet)
   {
-      oStream << location << ".ResourceArn=" << StringUtils::URLEncode(m_resourceArn.c_str()) << "&";
+      oStream << location << ".ResourceArn=" << StringUtils::URLEncoded(m_resourceArn) << "&";
   }
   if(m_tagsHasBeenSet)
   {
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".Tags.member." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
@@ -53,13 +53,13 @@ TargetDescription& TargetDescription::operator =(const XmlNode& xmlNode)
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode portNode = resultNode.FirstChild("Port");
     if(!portNode.IsNull())
     {
-      m_port = StringUtils::ConvertToInt32(StringUtils::Trim(portNode.GetText().c_str()).c_str());
+      m_port = StringUtils::ConvertToInt32(portNode.GetTextView().Trim().ToString().c_str());
       m_portHasBeenSet = true;
     }
   }
@@ -71,7 +71,7 @@ void TargetDescription::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_idHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -85,7 +85,7 @@ void TargetDescription::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_idHasBeenSet)
   {
-      oStream << location << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
   if(m_portHasBeenSet)
   {
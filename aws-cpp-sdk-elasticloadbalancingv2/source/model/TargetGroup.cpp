@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -85,73 +86,73 @@ TargetGroup& TargetGroup::operator =(const XmlNode& xmlNode)
     XmlNode targetGroupArnNode = resultNode.FirstChild("TargetGroupArn");
     if(!targetGroupArnNode.IsNull())
     {
-      m_targetGroupArn = StringUtils::Trim(targetGroupArnNode.GetText().c_str());
+      m_targetGroupArn = targetGroupArnNode.GetTextView().Trim().ToString();
       m_targetGroupArnHasBeenSet = true;
     }
     XmlNode targetGroupNameNode = resultNode.FirstChild("TargetGroupName");
     if(!targetGroupNameNode.IsNull())
     {
-      m_targetGroupName = StringUtils::Trim(targetGroupNameNode.GetText().c_str());
+      m_targetGroupName = targetGroupNameNode.GetTextView().Trim().ToString();
       m_targetGroupNameHasBeenSet = true;
     }
     XmlNode protocolNode = resultNode.FirstChild("Protocol");
     if(!protocolNode.IsNull())
     {
-      m_protocol = ProtocolEnumMapper::GetProtocolEnumForName(StringUtils::Trim(protocolNode.GetText().c_str()).c_str());
+      m_protocol = ProtocolEnumMapper::GetProtocolEnumForName(protocolNode.GetTextView().Trim().ToString().c_str());
       m_protocolHasBeenSet = true;
     }
     XmlNode portNode = resultNode.FirstChild("Port");
     if(!portNode.IsNull())
     {
-      m_port = StringUtils::ConvertToInt32(StringUtils::Trim(portNode.GetText().c_str()).c_str());
+      m_port = StringUtils::ConvertToInt32(portNode.GetTextView().Trim().ToString().c_str());
       m_portHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("VpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode healthCheckProtocolNode = resultNode.FirstChild("HealthCheckProtocol");
     if(!healthCheckProtocolNode.IsNull())
     {
-      m_healthCheckProtocol = ProtocolEnumMapper::GetProtocolEnumForName(StringUtils::Trim(healthCheckProtocolNode.GetText().c_str()).c_str());
+      m_healthCheckProtocol = ProtocolEnumMapper::GetProtocolEnumForName(healthCheckProtocolNode.GetTextView().Trim().ToString().c_str());
       m_healthCheckProtocolHasBeenSet = true;
     }
     XmlNode healthCheckPortNode = resultNode.FirstChild("HealthCheckPort");
     if(!healthCheckPortNode.IsNull())
     {
-      m_healthCheckPort = StringUtils::Trim(healthCheckPortNode.GetText().c_str());
+      m_healthCheckPort = healthCheckPortNode.GetTextView().Trim().ToString();
       m_healthCheckPortHasBeenSet = true;
     }
     XmlNode healthCheckIntervalSecondsNode = resultNode.FirstChild("HealthCheckIntervalSeconds");
     if(!healthCheckIntervalSecondsNode.IsNull())
     {
-      m_healthCheckIntervalSeconds = StringUtils::ConvertToInt32(StringUtils::Trim(healthCheckIntervalSecondsNode.GetText().c_str()).c_str());
+      m_healthCheckIntervalSeconds = StringUtils::ConvertToInt32(healthCheckIntervalSecondsNode.GetTextView().Trim().ToString().c_str());
       m_healthCheckIntervalSecondsHasBeenSet = true;
     }
     XmlNode healthCheckTimeoutSecondsNode = resultNode.FirstChild("HealthCheckTimeoutSeconds");
     if(!healthCheckTimeoutSecondsNode.IsNull())
     {
-      m_healthCheckTimeoutSeconds = StringUtils::ConvertToInt32(StringUtils::Trim(healthCheckTimeoutSecondsNode.GetText().c_str()).c_str());
+      m_healthCheckTimeoutSeconds = StringUtils::ConvertToInt32(healthCheckTimeoutSecondsNode.GetTextView().Trim().ToString().c_str());
       m_healthCheckTimeoutSecondsHasBeenSet = true;
     }
     XmlNode healthyThresholdCountNode = resultNode.FirstChild("HealthyThresholdCount");
     if(!healthyThresholdCountNode.IsNull())
     {
-      m_healthyThresholdCount = StringUtils::ConvertToInt32(StringUtils::Trim(healthyThresholdCountNode.GetText().c_str()).c_str());
+      m_healthyThresholdCount = StringUtils::ConvertToInt32(healthyThresholdCountNode.GetTextView().Trim().ToString().c_str());
       m_healthyThresholdCountHasBeenSet = true;
     }
     XmlNode unhealthyThresholdCountNode = resultNode.FirstChild("UnhealthyThresholdCount");
     if(!unhealthyThresholdCountNode.IsNull())
     {
-      m_unhealthyThresholdCount = StringUtils::ConvertToInt32(StringUtils::Trim(unhealthyThresholdCountNode.GetText().c_str()).c_str());
+      m_unhealthyThresholdCount = StringUtils::ConvertToInt32(unhealthyThresholdCountNode.GetTextView().Trim().ToString().c_str());
       m_unhealthyThresholdCountHasBeenSet = true;
     }
     XmlNode healthCheckPathNode = resultNode.FirstChild("HealthCheckPath");
     if(!healthCheckPathNode.IsNull())
     {
-      m_healthCheckPath = StringUtils::Trim(healthCheckPathNode.GetText().c_str());
+      m_healthCheckPath = healthCheckPathNode.GetTextView().Trim().ToString();
       m_healthCheckPathHasBeenSet = true;
     }
     XmlNode matcherNode = resultNode.FirstChild("Matcher");
@@ -166,7 +167,7 @@ TargetGroup& TargetGroup::operator =(const XmlNode& xmlNode)
       XmlNode loadBalancerArnsMember = loadBalancerArnsNode.FirstChild("member");
       while(!loadBalancerArnsMember.IsNull())
       {
-        m_loadBalancerArns.push_back(StringUtils::Trim(loadBalancerArnsMember.GetText().c_str()));
+        m_loadBalancerArns.push_back(loadBalancerArnsMember.GetTextView().Trim().ToString());
         loadBalancerArnsMember = loadBalancerArnsMember.NextNode("member");
       }
 
@@ -181,12 +182,12 @@ void TargetGroup::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_targetGroupArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TargetGroupArn=" << StringUtils::URLEncode(m_targetGroupArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".TargetGroupArn=" << StringUtils::URLEncoded(m_targetGroupArn) << "&";
   }
 
   if(m_targetGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TargetGroupName=" << StringUtils::URLEncode(m_targetGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".TargetGroupName=" << StringUtils::URLEncoded(m_targetGroupName) << "&";
   }
 
   if(m_protocolHasBeenSet)
@@ -201,7 +202,7 @@ void TargetGroup::OutputToStream(Aws::OStream& oStream, const char* location, un
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_healthCheckProtocolHasBeenSet)
@@ -211,7 +212,7 @@ void TargetGroup::OutputToStream(Aws::OStream& oStream, const char* location, un
 
   if(m_healthCheckPortHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HealthCheckPort=" << StringUtils::URLEncode(m_healthCheckPort.c_str()) << "&";
+      oStream << location << index << locationValue << ".HealthCheckPort=" << StringUtils::URLEncoded(m_healthCheckPort) << "&";
   }
 
   if(m_healthCheckIntervalSecondsHasBeenSet)
@@ -236,14 +237,14 @@ void TargetGroup::OutputToStream(Aws::OStream& oStream, const char* location, un
 
   if(m_healthCheckPathHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HealthCheckPath=" << StringUtils::URLEncode(m_healthCheckPath.c_str()) << "&";
+      oStream << location << index << locationValue << ".HealthCheckPath=" << StringUtils::URLEncoded(m_healthCheckPath) << "&";
   }
 
   if(m_matcherHasBeenSet)
   {
-      Aws::StringStream matcherLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream matcherLocationAndMemberSs;
       matcherLocationAndMemberSs << location << index << locationValue << ".Matcher";
-      m_matcher.OutputToStream(oStream, matcherLocationAndMemberSs.str().c_str());
+      m_matcher.OutputToStream(oStream, matcherLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_loadBalancerArnsHasBeenSet)
@@ -251,7 +252,7 @@ void TargetGroup::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned loadBalancerArnsIdx = 1;
       for(auto& item : m_loadBalancerArns)
       {
-        oStream << location << index << locationValue << ".LoadBalancerArns.member." << loadBalancerArnsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".LoadBalancerArns.member." << loadBalancerArnsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -261,11 +262,11 @@ void TargetGroup::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_targetGroupArnHasBeenSet)
   {
-      oStream << location << ".TargetGroupArn=" << StringUtils::URLEncode(m_targetGroupArn.c_str()) << "&";
+      oStream << location << ".TargetGroupArn=" << StringUtils::URLEncoded(m_targetGroupArn) << "&";
   }
   if(m_targetGroupNameHasBeenSet)
   {
-      oStream << location << ".TargetGroupName=" << StringUtils::URLEncode(m_targetGroupName.c_str()) << "&";
+      oStream << location << ".TargetGroupName=" << StringUtils::URLEncoded(m_targetGroupName) << "&";
   }
   if(m_protocolHasBeenSet)
   {
@@ -277,7 +278,7 @@ void TargetGroup::OutputToStream(Aws::OStream& oStream, const char* location) co
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_healthCheckProtocolHasBeenSet)
   {
@@ -285,7 +286,7 @@ void TargetGroup::OutputToStream(Aws::OStream& oStream, const char* location) co
   }
   if(m_healthCheckPortHasBeenSet)
   {
-      oStream << location << ".HealthCheckPort=" << StringUtils::URLEncode(m_healthCheckPort.c_str()) << "&";
+      oStream << location << ".HealthCheckPort=" << StringUtils::URLEncoded(m_healthCheckPort) << "&";
   }
   if(m_healthCheckIntervalSecondsHasBeenSet)
   {
@@ -305,7 +306,7 @@ void TargetGroup::OutputToStream(Aws::OStream& oStream, const char* location) co
   }
   if(m_healthCheckPathHasBeenSet)
   {
-      oStream << location << ".HealthCheckPath=" << StringUtils::URLEncode(m_healthCheckPath.c_str()) << "&";
+      oStream << location << ".HealthCheckPath=" << StringUtils::URLEncoded(m_healthCheckPath) << "&";
   }
   if(m_matcherHasBeenSet)
   {
@@ -318,7 +319,7 @@ void TargetGroup::OutputToStream(Aws::OStream& oStream, const char* location) co
       unsigned loadBalancerArnsIdx = 1;
       for(auto& item : m_loadBalancerArns)
       {
-        oStream << location << ".LoadBalancerArns.member." << loadBalancerArnsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".LoadBalancerArns.member." << loadBalancerArnsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
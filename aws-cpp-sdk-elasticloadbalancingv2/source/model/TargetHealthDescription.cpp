@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,7 +60,7 @@ TargetHealthDescription& TargetHealthDescription::operator =(const XmlNode& xmlN
     XmlNode healthCheckPortNode = resultNode.FirstChild("HealthCheckPort");
     if(!healthCheckPortNode.IsNull())
     {
-      m_healthCheckPort = StringUtils::Trim(healthCheckPortNode.GetText().c_str());
+      m_healthCheckPort = healthCheckPortNode.GetTextView().Trim().ToString();
       m_healthCheckPortHasBeenSet = true;
     }
     XmlNode targetHealthNode = resultNode.FirstChild("TargetHealth");
@@ -77,21 +78,21 @@ void TargetHealthDescription::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_targetHasBeenSet)
   {
-      Aws::StringStream targetLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream targetLocationAndMemberSs;
       targetLocationAndMemberSs << location << index << locationValue << ".Target";
-      m_target.OutputToStream(oStream, targetLocationAndMemberSs.str().c_str());
+      m_target.OutputToStream(oStream, targetLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_healthCheckPortHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HealthCheckPort=" << StringUtils::URLEncode(m_healthCheckPort.c_str()) << "&";
+      oStream << location << index << locationValue << ".HealthCheckPort=" << StringUtils::URLEncoded(m_healthCheckPort) << "&";
   }
 
   if(m_targetHealthHasBeenSet)
   {
-      Aws::StringStream targetHealthLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream targetHealthLocationAndMemberSs;
       targetHealthLocationAndMemberSs << location << index << locationValue << ".TargetHealth";
-      m_targetHealth.OutputToStream(oStream, targetHealthLocationAndMemberSs.str().c_str());
+      m_targetHealth.OutputToStream(oStream, targetHealthLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -106,7 +107,7 @@ void TargetHealthDescription::OutputToStream(Aws::OStream& oStream, const char*
   }
   if(m_healthCheckPortHasBeenSet)
   {
-      oStream << location << ".HealthCheckPort=" << StringUtils::URLEncode(m_healthCheckPort.c_str()) << "&";
+      oStream << location << ".HealthCheckPort=" << StringUtils::URLEncoded(m_healthCheckPort) << "&";
   }
   if(m_targetHealthHasBeenSet)
   {
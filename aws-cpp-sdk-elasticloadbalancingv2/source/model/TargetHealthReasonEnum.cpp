@@ -29,61 +29,53 @@ namespace Aws
       namespace TargetHealthReasonEnumMapper
       {
 
-        static const int Elb_RegistrationInProgress_HASH = HashingUtils::HashString("Elb.RegistrationInProgress");
-        static const int Elb_InitialHealthChecking_HASH = HashingUtils::HashString("Elb.InitialHealthChecking");
-        static const int Target_ResponseCodeMismatch_HASH = HashingUtils::HashString("Target.ResponseCodeMismatch");
-        static const int Target_Timeout_HASH = HashingUtils::HashString("Target.Timeout");
-        static const int Target_FailedHealthChecks_HASH = HashingUtils::HashString("Target.FailedHealthChecks");
-        static const int Target_NotRegistered_HASH = HashingUtils::HashString("Target.NotRegistered");
-        static const int Target_NotInUse_HASH = HashingUtils::HashString("Target.NotInUse");
-        static const int Target_DeregistrationInProgress_HASH = HashingUtils::HashString("Target.DeregistrationInProgress");
-        static const int Target_InvalidState_HASH = HashingUtils::HashString("Target.InvalidState");
-        static const int Elb_InternalError_HASH = HashingUtils::HashString("Elb.InternalError");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Elb_RegistrationInProgress_HASH = -1437730050;
+        static const int Elb_InitialHealthChecking_HASH = 784279399;
+        static const int Target_ResponseCodeMismatch_HASH = 1684640249;
+        static const int Target_Timeout_HASH = 551883268;
+        static const int Target_FailedHealthChecks_HASH = -89722303;
+        static const int Target_NotRegistered_HASH = -1195640808;
+        static const int Target_NotInUse_HASH = -733875508;
+        static const int Target_DeregistrationInProgress_HASH = 992619401;
+        static const int Target_InvalidState_HASH = 1957572119;
+        static const int Elb_InternalError_HASH = 2117882104;
 
 
         TargetHealthReasonEnum GetTargetHealthReasonEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Elb_RegistrationInProgress_HASH)
+          switch (hashCode)
           {
+          case Elb_RegistrationInProgress_HASH:
             return TargetHealthReasonEnum::Elb_RegistrationInProgress;
-          }
-          else if (hashCode == Elb_InitialHealthChecking_HASH)
-          {
+          case Elb_InitialHealthChecking_HASH:
             return TargetHealthReasonEnum::Elb_InitialHealthChecking;
-          }
-          else if (hashCode == Target_ResponseCodeMismatch_HASH)
-          {
+          case Target_ResponseCodeMismatch_HASH:
             return TargetHealthReasonEnum::Target_ResponseCodeMismatch;
-          }
-          else if (hashCode == Target_Timeout_HASH)
-          {
+          case Target_Timeout_HASH:
             return TargetHealthReasonEnum::Target_Timeout;
-          }
-          else if (hashCode == Target_FailedHealthChecks_HASH)
-          {
+          case Target_FailedHealthChecks_HASH:
             return TargetHealthReasonEnum::Target_FailedHealthChecks;
-          }
-          else if (hashCode == Target_NotRegistered_HASH)
-          {
+          case Target_NotRegistered_HASH:
             return TargetHealthReasonEnum::Target_NotRegistered;
-          }
-          else if (hashCode == Target_NotInUse_HASH)
-          {
+          case Target_NotInUse_HASH:
             return TargetHealthReasonEnum::Target_NotInUse;
-          }
-          else if (hashCode == Target_DeregistrationInProgress_HASH)
-          {
+          case Target_DeregistrationInProgress_HASH:
             return TargetHealthReasonEnum::Target_DeregistrationInProgress;
-          }
-          else if (hashCode == Target_InvalidState_HASH)
-          {
+          case Target_InvalidState_HASH:
             return TargetHealthReasonEnum::Target_InvalidState;
-          }
-          else if (hashCode == Elb_InternalError_HASH)
-          {
+          case Elb_InternalError_HASH:
             return TargetHealthReasonEnum::Elb_InternalError;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,36 +29,38 @@ namespace Aws
       namespace TargetHealthStateEnumMapper
       {
 
-        static const int initial_HASH = HashingUtils::HashString("initial");
-        static const int healthy_HASH = HashingUtils::HashString("healthy");
-        static const int unhealthy_HASH = HashingUtils::HashString("unhealthy");
-        static const int unused_HASH = HashingUtils::HashString("unused");
-        static const int draining_HASH = HashingUtils::HashString("draining");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int initial_HASH = 1948342084;
+        static const int healthy_HASH = 795560349;
+        static const int unhealthy_HASH = -1787605788;
+        static const int unused_HASH = -840170026;
+        static const int draining_HASH = -839042326;
 
 
         TargetHealthStateEnum GetTargetHealthStateEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == initial_HASH)
+          switch (hashCode)
           {
+          case initial_HASH:
             return TargetHealthStateEnum::initial;
-          }
-          else if (hashCode == healthy_HASH)
-          {
+          case healthy_HASH:
             return TargetHealthStateEnum::healthy;
-          }
-          else if (hashCode == unhealthy_HASH)
-          {
+          case unhealthy_HASH:
             return TargetHealthStateEnum::unhealthy;
-          }
-          else if (hashCode == unused_HASH)
-          {
+          case unused_HASH:
             return TargetHealthStateEnum::unused;
-          }
-          else if (hashCode == draining_HASH)
-          {
+          case draining_HASH:
             return TargetHealthStateEnum::draining;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -34,6 +34,9 @@
 #include <aws/elasticmapreduce/model/RunJobFlowResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -201,6 +204,18 @@ namespace Model
          */
         virtual void AddInstanceGroupsAsync(const Model::AddInstanceGroupsRequest& request, const AddInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddInstanceGroupsCallable(const Model::AddInstanceGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddInstanceGroupsOutcomeCallable AddInstanceGroupsCallable(Model::AddInstanceGroupsRequest&& request) const;
+
+        /**
+         * Same as AddInstanceGroupsAsync(const Model::AddInstanceGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddInstanceGroupsAsync(Model::AddInstanceGroupsRequest&& request, const AddInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>AddJobFlowSteps adds new steps to a running job flow. A maximum of 256 steps
          * are allowed in each job flow.</p> <p>If your job flow is long-running (such as a
@@ -274,6 +289,18 @@ namespace Model
          */
         virtual void AddJobFlowStepsAsync(const Model::AddJobFlowStepsRequest& request, const AddJobFlowStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddJobFlowStepsCallable(const Model::AddJobFlowStepsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddJobFlowStepsOutcomeCallable AddJobFlowStepsCallable(Model::AddJobFlowStepsRequest&& request) const;
+
+        /**
+         * Same as AddJobFlowStepsAsync(const Model::AddJobFlowStepsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddJobFlowStepsAsync(Model::AddJobFlowStepsRequest&& request, const AddJobFlowStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds tags to an Amazon EMR resource. Tags make it easier to associate
          * clusters in various ways, such as grouping clusters to track your Amazon EMR
@@ -305,6 +332,18 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsCallable(const Model::AddTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsOutcomeCallable AddTagsCallable(Model::AddTagsRequest&& request) const;
+
+        /**
+         * Same as AddTagsAsync(const Model::AddTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsAsync(Model::AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides cluster-level details including status, hardware and software
          * configuration, VPC settings, and so on. For information about the cluster steps,
@@ -330,6 +369,18 @@ namespace Model
          */
         virtual void DescribeClusterAsync(const Model::DescribeClusterRequest& request, const DescribeClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClusterCallable(const Model::DescribeClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeClusterOutcomeCallable DescribeClusterCallable(Model::DescribeClusterRequest&& request) const;
+
+        /**
+         * Same as DescribeClusterAsync(const Model::DescribeClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeClusterAsync(Model::DescribeClusterRequest&& request, const DescribeClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides more detail about the cluster step.</p>
          */
@@ -349,6 +400,18 @@ namespace Model
          */
         virtual void DescribeStepAsync(const Model::DescribeStepRequest& request, const DescribeStepResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStepCallable(const Model::DescribeStepRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeStepOutcomeCallable DescribeStepCallable(Model::DescribeStepRequest&& request) const;
+
+        /**
+         * Same as DescribeStepAsync(const Model::DescribeStepRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeStepAsync(Model::DescribeStepRequest&& request, const DescribeStepResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides information about the bootstrap actions associated with a
          * cluster.</p>
@@ -371,6 +434,18 @@ namespace Model
          */
         virtual void ListBootstrapActionsAsync(const Model::ListBootstrapActionsRequest& request, const ListBootstrapActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListBootstrapActionsCallable(const Model::ListBootstrapActionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListBootstrapActionsOutcomeCallable ListBootstrapActionsCallable(Model::ListBootstrapActionsRequest&& request) const;
+
+        /**
+         * Same as ListBootstrapActionsAsync(const Model::ListBootstrapActionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListBootstrapActionsAsync(Model::ListBootstrapActionsRequest&& request, const ListBootstrapActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides the status of all clusters visible to this AWS account. Allows you
          * to filter the list of clusters based on certain criteria; for example, filtering
@@ -402,6 +477,18 @@ namespace Model
          */
         virtual void ListClustersAsync(const Model::ListClustersRequest& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListClustersCallable(const Model::ListClustersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListClustersOutcomeCallable ListClustersCallable(Model::ListClustersRequest&& request) const;
+
+        /**
+         * Same as ListClustersAsync(const Model::ListClustersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListClustersAsync(Model::ListClustersRequest&& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides all available details about the instance groups in a cluster.</p>
          */
@@ -421,6 +508,18 @@ namespace Model
          */
         virtual void ListInstanceGroupsAsync(const Model::ListInstanceGroupsRequest& request, const ListInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListInstanceGroupsCallable(const Model::ListInstanceGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListInstanceGroupsOutcomeCallable ListInstanceGroupsCallable(Model::ListInstanceGroupsRequest&& request) const;
+
+        /**
+         * Same as ListInstanceGroupsAsync(const Model::ListInstanceGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListInstanceGroupsAsync(Model::ListInstanceGroupsRequest&& request, const ListInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides information about the cluster instances that Amazon EMR provisions
          * on behalf of a user when it creates the cluster. For example, this operation
@@ -452,6 +551,18 @@ namespace Model
          */
         virtual void ListInstancesAsync(const Model::ListInstancesRequest& request, const ListInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListInstancesCallable(const Model::ListInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListInstancesOutcomeCallable ListInstancesCallable(Model::ListInstancesRequest&& request) const;
+
+        /**
+         * Same as ListInstancesAsync(const Model::ListInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListInstancesAsync(Model::ListInstancesRequest&& request, const ListInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides a list of steps for the cluster.</p>
          */
@@ -471,6 +582,18 @@ namespace Model
          */
         virtual void ListStepsAsync(const Model::ListStepsRequest& request, const ListStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListStepsCallable(const Model::ListStepsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListStepsOutcomeCallable ListStepsCallable(Model::ListStepsRequest&& request) const;
+
+        /**
+         * Same as ListStepsAsync(const Model::ListStepsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListStepsAsync(Model::ListStepsRequest&& request, const ListStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>ModifyInstanceGroups modifies the number of nodes and configuration settings
          * of an instance group. The input parameters include the new target instance count
@@ -499,6 +622,18 @@ namespace Model
          */
         virtual void ModifyInstanceGroupsAsync(const Model::ModifyInstanceGroupsRequest& request, const ModifyInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyInstanceGroupsCallable(const Model::ModifyInstanceGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyInstanceGroupsOutcomeCallable ModifyInstanceGroupsCallable(Model::ModifyInstanceGroupsRequest&& request) const;
+
+        /**
+         * Same as ModifyInstanceGroupsAsync(const Model::ModifyInstanceGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyInstanceGroupsAsync(Model::ModifyInstanceGroupsRequest&& request, const ModifyInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes tags from an Amazon EMR resource. Tags make it easier to associate
          * clusters in various ways, such as grouping clusters to track your Amazon EMR
@@ -533,6 +668,18 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsCallable(const Model::RemoveTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(Model::RemoveTagsRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsAsync(const Model::RemoveTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsAsync(Model::RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> RunJobFlow creates and starts running a new job flow. The job flow will run
          * the steps specified. Once the job flow completes, the cluster is stopped and the
@@ -609,6 +756,18 @@ namespace Model
          */
         virtual void RunJobFlowAsync(const Model::RunJobFlowRequest& request, const RunJobFlowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RunJobFlowCallable(const Model::RunJobFlowRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RunJobFlowOutcomeCallable RunJobFlowCallable(Model::RunJobFlowRequest&& request) const;
+
+        /**
+         * Same as RunJobFlowAsync(const Model::RunJobFlowRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RunJobFlowAsync(Model::RunJobFlowRequest&& request, const RunJobFlowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>SetTerminationProtection locks a job flow so the Amazon EC2 instances in the
          * cluster cannot be terminated by user intervention, an API call, or in the event
@@ -670,6 +829,18 @@ namespace Model
          */
         virtual void SetTerminationProtectionAsync(const Model::SetTerminationProtectionRequest& request, const SetTerminationProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetTerminationProtectionCallable(const Model::SetTerminationProtectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetTerminationProtectionOutcomeCallable SetTerminationProtectionCallable(Model::SetTerminationProtectionRequest&& request) const;
+
+        /**
+         * Same as SetTerminationProtectionAsync(const Model::SetTerminationProtectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetTerminationProtectionAsync(Model::SetTerminationProtectionRequest&& request, const SetTerminationProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets whether all AWS Identity and Access Management (IAM) users under your
          * account can access the specified job flows. This action works on running job
@@ -704,6 +875,18 @@ namespace Model
          */
         virtual void SetVisibleToAllUsersAsync(const Model::SetVisibleToAllUsersRequest& request, const SetVisibleToAllUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetVisibleToAllUsersCallable(const Model::SetVisibleToAllUsersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetVisibleToAllUsersOutcomeCallable SetVisibleToAllUsersCallable(Model::SetVisibleToAllUsersRequest&& request) const;
+
+        /**
+         * Same as SetVisibleToAllUsersAsync(const Model::SetVisibleToAllUsersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetVisibleToAllUsersAsync(Model::SetVisibleToAllUsersRequest&& request, const SetVisibleToAllUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>TerminateJobFlows shuts a list of job flows down. When a job flow is shut
          * down, any step not yet completed is canceled and the EC2 instances on which the
@@ -744,6 +927,125 @@ namespace Model
          */
         virtual void TerminateJobFlowsAsync(const Model::TerminateJobFlowsRequest& request, const TerminateJobFlowsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TerminateJobFlowsCallable(const Model::TerminateJobFlowsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TerminateJobFlowsOutcomeCallable TerminateJobFlowsCallable(Model::TerminateJobFlowsRequest&& request) const;
+
+        /**
+         * Same as TerminateJobFlowsAsync(const Model::TerminateJobFlowsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TerminateJobFlowsAsync(Model::TerminateJobFlowsRequest&& request, const TerminateJobFlowsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListBootstrapActions(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EMRClient, Model::ListBootstrapActionsRequest, Model::ListBootstrapActionsOutcome> ListBootstrapActionsPaginator(const Model::ListBootstrapActionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListClusters(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EMRClient, Model::ListClustersRequest, Model::ListClustersOutcome> ListClustersPaginator(const Model::ListClustersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListInstanceGroups(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EMRClient, Model::ListInstanceGroupsRequest, Model::ListInstanceGroupsOutcome> ListInstanceGroupsPaginator(const Model::ListInstanceGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListInstances(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EMRClient, Model::ListInstancesRequest, Model::ListInstancesOutcome> ListInstancesPaginator(const Model::ListInstancesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListSteps(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<EMRClient, Model::ListStepsRequest, Model::ListStepsOutcome> ListStepsPaginator(const Model::ListStepsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddInstanceGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::AddInstanceGroupsRequest, Model::AddInstanceGroupsOutcome> AddInstanceGroupsAwaitable(Model::AddInstanceGroupsRequest request) const;
+
+        /**
+         * co_await-able form of AddJobFlowSteps(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::AddJobFlowStepsRequest, Model::AddJobFlowStepsOutcome> AddJobFlowStepsAwaitable(Model::AddJobFlowStepsRequest request) const;
+
+        /**
+         * co_await-able form of AddTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::AddTagsRequest, Model::AddTagsOutcome> AddTagsAwaitable(Model::AddTagsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::DescribeClusterRequest, Model::DescribeClusterOutcome> DescribeClusterAwaitable(Model::DescribeClusterRequest request) const;
+
+        /**
+         * co_await-able form of DescribeStep(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::DescribeStepRequest, Model::DescribeStepOutcome> DescribeStepAwaitable(Model::DescribeStepRequest request) const;
+
+        /**
+         * co_await-able form of ListBootstrapActions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::ListBootstrapActionsRequest, Model::ListBootstrapActionsOutcome> ListBootstrapActionsAwaitable(Model::ListBootstrapActionsRequest request) const;
+
+        /**
+         * co_await-able form of ListClusters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::ListClustersRequest, Model::ListClustersOutcome> ListClustersAwaitable(Model::ListClustersRequest request) const;
+
+        /**
+         * co_await-able form of ListInstanceGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::ListInstanceGroupsRequest, Model::ListInstanceGroupsOutcome> ListInstanceGroupsAwaitable(Model::ListInstanceGroupsRequest request) const;
+
+        /**
+         * co_await-able form of ListInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::ListInstancesRequest, Model::ListInstancesOutcome> ListInstancesAwaitable(Model::ListInstancesRequest request) const;
+
+        /**
+         * co_await-able form of ListSteps(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::ListStepsRequest, Model::ListStepsOutcome> ListStepsAwaitable(Model::ListStepsRequest request) const;
+
+        /**
+         * co_await-able form of ModifyInstanceGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::ModifyInstanceGroupsRequest, Model::ModifyInstanceGroupsOutcome> ModifyInstanceGroupsAwaitable(Model::ModifyInstanceGroupsRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::RemoveTagsRequest, Model::RemoveTagsOutcome> RemoveTagsAwaitable(Model::RemoveTagsRequest request) const;
+
+        /**
+         * co_await-able form of RunJobFlow(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::RunJobFlowRequest, Model::RunJobFlowOutcome> RunJobFlowAwaitable(Model::RunJobFlowRequest request) const;
+
+        /**
+         * co_await-able form of SetTerminationProtection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::SetTerminationProtectionRequest, Model::SetTerminationProtectionOutcome> SetTerminationProtectionAwaitable(Model::SetTerminationProtectionRequest request) const;
+
+        /**
+         * co_await-able form of SetVisibleToAllUsers(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::SetVisibleToAllUsersRequest, Model::SetVisibleToAllUsersOutcome> SetVisibleToAllUsersAwaitable(Model::SetVisibleToAllUsersRequest request) const;
+
+        /**
+         * co_await-able form of TerminateJobFlows(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<EMRClient, Model::TerminateJobFlowsRequest, Model::TerminateJobFlowsOutcome> TerminateJobFlowsAwaitable(Model::TerminateJobFlowsRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
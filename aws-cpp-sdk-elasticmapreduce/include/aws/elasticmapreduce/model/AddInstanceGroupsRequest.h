@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     AddInstanceGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "AddInstanceGroups"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
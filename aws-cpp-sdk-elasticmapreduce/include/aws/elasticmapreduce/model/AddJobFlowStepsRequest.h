@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     AddJobFlowStepsRequest();
+    inline const char* GetServiceRequestName() const override { return "AddJobFlowSteps"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
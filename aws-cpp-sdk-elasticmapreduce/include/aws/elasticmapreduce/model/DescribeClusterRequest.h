@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCluster"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
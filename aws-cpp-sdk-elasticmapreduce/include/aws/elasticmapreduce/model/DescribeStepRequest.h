@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeStepRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeStep"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
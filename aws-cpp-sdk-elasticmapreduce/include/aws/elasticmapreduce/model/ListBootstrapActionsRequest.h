@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListBootstrapActionsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListBootstrapActions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
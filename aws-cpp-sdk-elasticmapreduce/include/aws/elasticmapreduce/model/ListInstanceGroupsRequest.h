@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListInstanceGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListInstanceGroups"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     ListInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListInstances"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
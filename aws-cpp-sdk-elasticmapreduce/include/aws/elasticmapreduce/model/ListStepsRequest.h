@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ListStepsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListSteps"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyInstanceGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyInstanceGroups"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -39,6 +39,8 @@ namespace Model
   {
   public:
     RunJobFlowRequest();
+    inline const char* GetServiceRequestName() const override { return "RunJobFlow"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
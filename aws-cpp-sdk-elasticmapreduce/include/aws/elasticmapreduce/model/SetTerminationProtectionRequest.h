@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetTerminationProtectionRequest();
+    inline const char* GetServiceRequestName() const override { return "SetTerminationProtection"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetVisibleToAllUsersRequest();
+    inline const char* GetServiceRequestName() const override { return "SetVisibleToAllUsers"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
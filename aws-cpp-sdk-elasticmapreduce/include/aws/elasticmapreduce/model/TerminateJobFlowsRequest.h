@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     TerminateJobFlowsRequest();
+    inline const char* GetServiceRequestName() const override { return "TerminateJobFlows"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
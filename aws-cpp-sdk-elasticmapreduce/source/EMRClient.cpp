@@ -125,7 +125,7 @@ AddInstanceGroupsOutcome EMRClient::AddInstanceGroups(const AddInstanceGroupsReq
 
 AddInstanceGroupsOutcomeCallable EMRClient::AddInstanceGroupsCallable(const AddInstanceGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddInstanceGroups(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddInstanceGroups(request); } );
 }
 
 void EMRClient::AddInstanceGroupsAsync(const AddInstanceGroupsRequest& request, const AddInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -133,6 +133,16 @@ void EMRClient::AddInstanceGroupsAsync(const AddInstanceGroupsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->AddInstanceGroupsAsyncHelper( request, handler, context ); } );
 }
 
+AddInstanceGroupsOutcomeCallable EMRClient::AddInstanceGroupsCallable(AddInstanceGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::AddInstanceGroups, this, std::move(request)));
+}
+
+void EMRClient::AddInstanceGroupsAsync(AddInstanceGroupsRequest&& request, const AddInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::AddInstanceGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::AddInstanceGroupsAsyncHelper(const AddInstanceGroupsRequest& request, const AddInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddInstanceGroups(request), context);
@@ -156,7 +166,7 @@ AddJobFlowStepsOutcome EMRClient::AddJobFlowSteps(const AddJobFlowStepsRequest&
 
 AddJobFlowStepsOutcomeCallable EMRClient::AddJobFlowStepsCallable(const AddJobFlowStepsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddJobFlowSteps(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddJobFlowSteps(request); } );
 }
 
 void EMRClient::AddJobFlowStepsAsync(const AddJobFlowStepsRequest& request, const AddJobFlowStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -164,6 +174,16 @@ void EMRClient::AddJobFlowStepsAsync(const AddJobFlowStepsRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->AddJobFlowStepsAsyncHelper( request, handler, context ); } );
 }
 
+AddJobFlowStepsOutcomeCallable EMRClient::AddJobFlowStepsCallable(AddJobFlowStepsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::AddJobFlowSteps, this, std::move(request)));
+}
+
+void EMRClient::AddJobFlowStepsAsync(AddJobFlowStepsRequest&& request, const AddJobFlowStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::AddJobFlowStepsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::AddJobFlowStepsAsyncHelper(const AddJobFlowStepsRequest& request, const AddJobFlowStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddJobFlowSteps(request), context);
@@ -187,7 +207,7 @@ AddTagsOutcome EMRClient::AddTags(const AddTagsRequest& request) const
 
 AddTagsOutcomeCallable EMRClient::AddTagsCallable(const AddTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTags(request); } );
 }
 
 void EMRClient::AddTagsAsync(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -195,6 +215,16 @@ void EMRClient::AddTagsAsync(const AddTagsRequest& request, const AddTagsRespons
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsOutcomeCallable EMRClient::AddTagsCallable(AddTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::AddTags, this, std::move(request)));
+}
+
+void EMRClient::AddTagsAsync(AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::AddTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::AddTagsAsyncHelper(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTags(request), context);
@@ -218,7 +248,7 @@ DescribeClusterOutcome EMRClient::DescribeCluster(const DescribeClusterRequest&
 
 DescribeClusterOutcomeCallable EMRClient::DescribeClusterCallable(const DescribeClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCluster(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCluster(request); } );
 }
 
 void EMRClient::DescribeClusterAsync(const DescribeClusterRequest& request, const DescribeClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -226,6 +256,16 @@ void EMRClient::DescribeClusterAsync(const DescribeClusterRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->DescribeClusterAsyncHelper( request, handler, context ); } );
 }
 
+DescribeClusterOutcomeCallable EMRClient::DescribeClusterCallable(DescribeClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::DescribeCluster, this, std::move(request)));
+}
+
+void EMRClient::DescribeClusterAsync(DescribeClusterRequest&& request, const DescribeClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::DescribeClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::DescribeClusterAsyncHelper(const DescribeClusterRequest& request, const DescribeClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCluster(request), context);
@@ -249,7 +289,7 @@ DescribeStepOutcome EMRClient::DescribeStep(const DescribeStepRequest& request)
 
 DescribeStepOutcomeCallable EMRClient::DescribeStepCallable(const DescribeStepRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeStep(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeStep(request); } );
 }
 
 void EMRClient::DescribeStepAsync(const DescribeStepRequest& request, const DescribeStepResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -257,6 +297,16 @@ void EMRClient::DescribeStepAsync(const DescribeStepRequest& request, const Desc
   m_executor->Submit( [this, request, handler, context](){ this->DescribeStepAsyncHelper( request, handler, context ); } );
 }
 
+DescribeStepOutcomeCallable EMRClient::DescribeStepCallable(DescribeStepRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::DescribeStep, this, std::move(request)));
+}
+
+void EMRClient::DescribeStepAsync(DescribeStepRequest&& request, const DescribeStepResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::DescribeStepAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::DescribeStepAsyncHelper(const DescribeStepRequest& request, const DescribeStepResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeStep(request), context);
@@ -280,7 +330,7 @@ ListBootstrapActionsOutcome EMRClient::ListBootstrapActions(const ListBootstrapA
 
 ListBootstrapActionsOutcomeCallable EMRClient::ListBootstrapActionsCallable(const ListBootstrapActionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListBootstrapActions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListBootstrapActions(request); } );
 }
 
 void EMRClient::ListBootstrapActionsAsync(const ListBootstrapActionsRequest& request, const ListBootstrapActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -288,6 +338,16 @@ void EMRClient::ListBootstrapActionsAsync(const ListBootstrapActionsRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->ListBootstrapActionsAsyncHelper( request, handler, context ); } );
 }
 
+ListBootstrapActionsOutcomeCallable EMRClient::ListBootstrapActionsCallable(ListBootstrapActionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::ListBootstrapActions, this, std::move(request)));
+}
+
+void EMRClient::ListBootstrapActionsAsync(ListBootstrapActionsRequest&& request, const ListBootstrapActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::ListBootstrapActionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::ListBootstrapActionsAsyncHelper(const ListBootstrapActionsRequest& request, const ListBootstrapActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListBootstrapActions(request), context);
@@ -311,7 +371,7 @@ ListClustersOutcome EMRClient::ListClusters(const ListClustersRequest& request)
 
 ListClustersOutcomeCallable EMRClient::ListClustersCallable(const ListClustersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListClusters(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListClusters(request); } );
 }
 
 void EMRClient::ListClustersAsync(const ListClustersRequest& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -319,6 +379,16 @@ void EMRClient::ListClustersAsync(const ListClustersRequest& request, const List
   m_executor->Submit( [this, request, handler, context](){ this->ListClustersAsyncHelper( request, handler, context ); } );
 }
 
+ListClustersOutcomeCallable EMRClient::ListClustersCallable(ListClustersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::ListClusters, this, std::move(request)));
+}
+
+void EMRClient::ListClustersAsync(ListClustersRequest&& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::ListClustersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::ListClustersAsyncHelper(const ListClustersRequest& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListClusters(request), context);
@@ -342,7 +412,7 @@ ListInstanceGroupsOutcome EMRClient::ListInstanceGroups(const ListInstanceGroups
 
 ListInstanceGroupsOutcomeCallable EMRClient::ListInstanceGroupsCallable(const ListInstanceGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListInstanceGroups(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListInstanceGroups(request); } );
 }
 
 void EMRClient::ListInstanceGroupsAsync(const ListInstanceGroupsRequest& request, const ListInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -350,6 +420,16 @@ void EMRClient::ListInstanceGroupsAsync(const ListInstanceGroupsRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->ListInstanceGroupsAsyncHelper( request, handler, context ); } );
 }
 
+ListInstanceGroupsOutcomeCallable EMRClient::ListInstanceGroupsCallable(ListInstanceGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::ListInstanceGroups, this, std::move(request)));
+}
+
+void EMRClient::ListInstanceGroupsAsync(ListInstanceGroupsRequest&& request, const ListInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::ListInstanceGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::ListInstanceGroupsAsyncHelper(const ListInstanceGroupsRequest& request, const ListInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListInstanceGroups(request), context);
@@ -373,7 +453,7 @@ ListInstancesOutcome EMRClient::ListInstances(const ListInstancesRequest& reques
 
 ListInstancesOutcomeCallable EMRClient::ListInstancesCallable(const ListInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListInstances(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListInstances(request); } );
 }
 
 void EMRClient::ListInstancesAsync(const ListInstancesRequest& request, const ListInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -381,6 +461,16 @@ void EMRClient::ListInstancesAsync(const ListInstancesRequest& request, const Li
   m_executor->Submit( [this, request, handler, context](){ this->ListInstancesAsyncHelper( request, handler, context ); } );
 }
 
+ListInstancesOutcomeCallable EMRClient::ListInstancesCallable(ListInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::ListInstances, this, std::move(request)));
+}
+
+void EMRClient::ListInstancesAsync(ListInstancesRequest&& request, const ListInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::ListInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::ListInstancesAsyncHelper(const ListInstancesRequest& request, const ListInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListInstances(request), context);
@@ -404,7 +494,7 @@ ListStepsOutcome EMRClient::ListSteps(const ListStepsRequest& request) const
 
 ListStepsOutcomeCallable EMRClient::ListStepsCallable(const ListStepsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListSteps(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListSteps(request); } );
 }
 
 void EMRClient::ListStepsAsync(const ListStepsRequest& request, const ListStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -412,6 +502,16 @@ void EMRClient::ListStepsAsync(const ListStepsRequest& request, const ListStepsR
   m_executor->Submit( [this, request, handler, context](){ this->ListStepsAsyncHelper( request, handler, context ); } );
 }
 
+ListStepsOutcomeCallable EMRClient::ListStepsCallable(ListStepsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::ListSteps, this, std::move(request)));
+}
+
+void EMRClient::ListStepsAsync(ListStepsRequest&& request, const ListStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::ListStepsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::ListStepsAsyncHelper(const ListStepsRequest& request, const ListStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListSteps(request), context);
@@ -435,7 +535,7 @@ ModifyInstanceGroupsOutcome EMRClient::ModifyInstanceGroups(const ModifyInstance
 
 ModifyInstanceGroupsOutcomeCallable EMRClient::ModifyInstanceGroupsCallable(const ModifyInstanceGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyInstanceGroups(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyInstanceGroups(request); } );
 }
 
 void EMRClient::ModifyInstanceGroupsAsync(const ModifyInstanceGroupsRequest& request, const ModifyInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -443,6 +543,16 @@ void EMRClient::ModifyInstanceGroupsAsync(const ModifyInstanceGroupsRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->ModifyInstanceGroupsAsyncHelper( request, handler, context ); } );
 }
 
+ModifyInstanceGroupsOutcomeCallable EMRClient::ModifyInstanceGroupsCallable(ModifyInstanceGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::ModifyInstanceGroups, this, std::move(request)));
+}
+
+void EMRClient::ModifyInstanceGroupsAsync(ModifyInstanceGroupsRequest&& request, const ModifyInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::ModifyInstanceGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::ModifyInstanceGroupsAsyncHelper(const ModifyInstanceGroupsRequest& request, const ModifyInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyInstanceGroups(request), context);
@@ -466,7 +576,7 @@ RemoveTagsOutcome EMRClient::RemoveTags(const RemoveTagsRequest& request) const
 
 RemoveTagsOutcomeCallable EMRClient::RemoveTagsCallable(const RemoveTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTags(request); } );
 }
 
 void EMRClient::RemoveTagsAsync(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -474,6 +584,16 @@ void EMRClient::RemoveTagsAsync(const RemoveTagsRequest& request, const RemoveTa
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsOutcomeCallable EMRClient::RemoveTagsCallable(RemoveTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::RemoveTags, this, std::move(request)));
+}
+
+void EMRClient::RemoveTagsAsync(RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::RemoveTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::RemoveTagsAsyncHelper(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTags(request), context);
@@ -497,7 +617,7 @@ RunJobFlowOutcome EMRClient::RunJobFlow(const RunJobFlowRequest& request) const
 
 RunJobFlowOutcomeCallable EMRClient::RunJobFlowCallable(const RunJobFlowRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RunJobFlow(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RunJobFlow(request); } );
 }
 
 void EMRClient::RunJobFlowAsync(const RunJobFlowRequest& request, const RunJobFlowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -505,6 +625,16 @@ void EMRClient::RunJobFlowAsync(const RunJobFlowRequest& request, const RunJobFl
   m_executor->Submit( [this, request, handler, context](){ this->RunJobFlowAsyncHelper( request, handler, context ); } );
 }
 
+RunJobFlowOutcomeCallable EMRClient::RunJobFlowCallable(RunJobFlowRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::RunJobFlow, this, std::move(request)));
+}
+
+void EMRClient::RunJobFlowAsync(RunJobFlowRequest&& request, const RunJobFlowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::RunJobFlowAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::RunJobFlowAsyncHelper(const RunJobFlowRequest& request, const RunJobFlowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RunJobFlow(request), context);
@@ -528,7 +658,7 @@ SetTerminationProtectionOutcome EMRClient::SetTerminationProtection(const SetTer
 
 SetTerminationProtectionOutcomeCallable EMRClient::SetTerminationProtectionCallable(const SetTerminationProtectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetTerminationProtection(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetTerminationProtection(request); } );
 }
 
 void EMRClient::SetTerminationProtectionAsync(const SetTerminationProtectionRequest& request, const SetTerminationProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -536,6 +666,16 @@ void EMRClient::SetTerminationProtectionAsync(const SetTerminationProtectionRequ
   m_executor->Submit( [this, request, handler, context](){ this->SetTerminationProtectionAsyncHelper( request, handler, context ); } );
 }
 
+SetTerminationProtectionOutcomeCallable EMRClient::SetTerminationProtectionCallable(SetTerminationProtectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::SetTerminationProtection, this, std::move(request)));
+}
+
+void EMRClient::SetTerminationProtectionAsync(SetTerminationProtectionRequest&& request, const SetTerminationProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::SetTerminationProtectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::SetTerminationProtectionAsyncHelper(const SetTerminationProtectionRequest& request, const SetTerminationProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetTerminationProtection(request), context);
@@ -559,7 +699,7 @@ SetVisibleToAllUsersOutcome EMRClient::SetVisibleToAllUsers(const SetVisibleToAl
 
 SetVisibleToAllUsersOutcomeCallable EMRClient::SetVisibleToAllUsersCallable(const SetVisibleToAllUsersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetVisibleToAllUsers(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetVisibleToAllUsers(request); } );
 }
 
 void EMRClient::SetVisibleToAllUsersAsync(const SetVisibleToAllUsersRequest& request, const SetVisibleToAllUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -567,6 +707,16 @@ void EMRClient::SetVisibleToAllUsersAsync(const SetVisibleToAllUsersRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->SetVisibleToAllUsersAsyncHelper( request, handler, context ); } );
 }
 
+SetVisibleToAllUsersOutcomeCallable EMRClient::SetVisibleToAllUsersCallable(SetVisibleToAllUsersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::SetVisibleToAllUsers, this, std::move(request)));
+}
+
+void EMRClient::SetVisibleToAllUsersAsync(SetVisibleToAllUsersRequest&& request, const SetVisibleToAllUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::SetVisibleToAllUsersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::SetVisibleToAllUsersAsyncHelper(const SetVisibleToAllUsersRequest& request, const SetVisibleToAllUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetVisibleToAllUsers(request), context);
@@ -590,7 +740,7 @@ TerminateJobFlowsOutcome EMRClient::TerminateJobFlows(const TerminateJobFlowsReq
 
 TerminateJobFlowsOutcomeCallable EMRClient::TerminateJobFlowsCallable(const TerminateJobFlowsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TerminateJobFlows(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TerminateJobFlows(request); } );
 }
 
 void EMRClient::TerminateJobFlowsAsync(const TerminateJobFlowsRequest& request, const TerminateJobFlowsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -598,8 +748,185 @@ void EMRClient::TerminateJobFlowsAsync(const TerminateJobFlowsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->TerminateJobFlowsAsyncHelper( request, handler, context ); } );
 }
 
+TerminateJobFlowsOutcomeCallable EMRClient::TerminateJobFlowsCallable(TerminateJobFlowsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&EMRClient::TerminateJobFlows, this, std::move(request)));
+}
+
+void EMRClient::TerminateJobFlowsAsync(TerminateJobFlowsRequest&& request, const TerminateJobFlowsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&EMRClient::TerminateJobFlowsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void EMRClient::TerminateJobFlowsAsyncHelper(const TerminateJobFlowsRequest& request, const TerminateJobFlowsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TerminateJobFlows(request), context);
 }
 
+Paginator<EMRClient, ListBootstrapActionsRequest, ListBootstrapActionsOutcome> EMRClient::ListBootstrapActionsPaginator(const ListBootstrapActionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EMRClient, ListBootstrapActionsRequest, ListBootstrapActionsOutcome>(this, &EMRClient::ListBootstrapActions, request,
+    [](const ListBootstrapActionsRequest& current, const ListBootstrapActionsOutcome& outcome, ListBootstrapActionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EMRClient, ListClustersRequest, ListClustersOutcome> EMRClient::ListClustersPaginator(const ListClustersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EMRClient, ListClustersRequest, ListClustersOutcome>(this, &EMRClient::ListClusters, request,
+    [](const ListClustersRequest& current, const ListClustersOutcome& outcome, ListClustersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EMRClient, ListInstanceGroupsRequest, ListInstanceGroupsOutcome> EMRClient::ListInstanceGroupsPaginator(const ListInstanceGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EMRClient, ListInstanceGroupsRequest, ListInstanceGroupsOutcome>(this, &EMRClient::ListInstanceGroups, request,
+    [](const ListInstanceGroupsRequest& current, const ListInstanceGroupsOutcome& outcome, ListInstanceGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EMRClient, ListInstancesRequest, ListInstancesOutcome> EMRClient::ListInstancesPaginator(const ListInstancesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EMRClient, ListInstancesRequest, ListInstancesOutcome>(this, &EMRClient::ListInstances, request,
+    [](const ListInstancesRequest& current, const ListInstancesOutcome& outcome, ListInstancesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<EMRClient, ListStepsRequest, ListStepsOutcome> EMRClient::ListStepsPaginator(const ListStepsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<EMRClient, ListStepsRequest, ListStepsOutcome>(this, &EMRClient::ListSteps, request,
+    [](const ListStepsRequest& current, const ListStepsOutcome& outcome, ListStepsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<EMRClient, AddInstanceGroupsRequest, AddInstanceGroupsOutcome> EMRClient::AddInstanceGroupsAwaitable(AddInstanceGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::AddInstanceGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<EMRClient, AddJobFlowStepsRequest, AddJobFlowStepsOutcome> EMRClient::AddJobFlowStepsAwaitable(AddJobFlowStepsRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::AddJobFlowSteps, std::move(request) } };
+}
+
+ClientOperationAwaitable<EMRClient, AddTagsRequest, AddTagsOutcome> EMRClient::AddTagsAwaitable(AddTagsRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::AddTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<EMRClient, DescribeClusterRequest, DescribeClusterOutcome> EMRClient::DescribeClusterAwaitable(DescribeClusterRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::DescribeCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<EMRClient, DescribeStepRequest, DescribeStepOutcome> EMRClient::DescribeStepAwaitable(DescribeStepRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::DescribeStep, std::move(request) } };
+}
+
+ClientOperationAwaitable<EMRClient, ListBootstrapActionsRequest, ListBootstrapActionsOutcome> EMRClient::ListBootstrapActionsAwaitable(ListBootstrapActionsRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::ListBootstrapActions, std::move(request) } };
+}
+
+ClientOperationAwaitable<EMRClient, ListClustersRequest, ListClustersOutcome> EMRClient::ListClustersAwaitable(ListClustersRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::ListClusters, std::move(request) } };
+}
+
+ClientOperationAwaitable<EMRClient, ListInstanceGroupsRequest, ListInstanceGroupsOutcome> EMRClient::ListInstanceGroupsAwaitable(ListInstanceGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::ListInstanceGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<EMRClient, ListInstancesRequest, ListInstancesOutcome> EMRClient::ListInstancesAwaitable(ListInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::ListInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<EMRClient, ListStepsRequest, ListStepsOutcome> EMRClient::ListStepsAwaitable(ListStepsRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::ListSteps, std::move(request) } };
+}
+
+ClientOperationAwaitable<EMRClient, ModifyInstanceGroupsRequest, ModifyInstanceGroupsOutcome> EMRClient::ModifyInstanceGroupsAwaitable(ModifyInstanceGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::ModifyInstanceGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<EMRClient, RemoveTagsRequest, RemoveTagsOutcome> EMRClient::RemoveTagsAwaitable(RemoveTagsRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::RemoveTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<EMRClient, RunJobFlowRequest, RunJobFlowOutcome> EMRClient::RunJobFlowAwaitable(RunJobFlowRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::RunJobFlow, std::move(request) } };
+}
+
+ClientOperationAwaitable<EMRClient, SetTerminationProtectionRequest, SetTerminationProtectionOutcome> EMRClient::SetTerminationProtectionAwaitable(SetTerminationProtectionRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::SetTerminationProtection, std::move(request) } };
+}
+
+ClientOperationAwaitable<EMRClient, SetVisibleToAllUsersRequest, SetVisibleToAllUsersOutcome> EMRClient::SetVisibleToAllUsersAwaitable(SetVisibleToAllUsersRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::SetVisibleToAllUsers, std::move(request) } };
+}
+
+ClientOperationAwaitable<EMRClient, TerminateJobFlowsRequest, TerminateJobFlowsOutcome> EMRClient::TerminateJobFlowsAwaitable(TerminateJobFlowsRequest request) const
+{
+  return { m_executor.get(), { this, &EMRClient::TerminateJobFlows, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
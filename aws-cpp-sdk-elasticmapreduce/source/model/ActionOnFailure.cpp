@@ -29,31 +29,35 @@ namespace Aws
       namespace ActionOnFailureMapper
       {
 
-        static const int TERMINATE_JOB_FLOW_HASH = HashingUtils::HashString("TERMINATE_JOB_FLOW");
-        static const int TERMINATE_CLUSTER_HASH = HashingUtils::HashString("TERMINATE_CLUSTER");
-        static const int CANCEL_AND_WAIT_HASH = HashingUtils::HashString("CANCEL_AND_WAIT");
-        static const int CONTINUE_HASH = HashingUtils::HashString("CONTINUE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int TERMINATE_JOB_FLOW_HASH = 369010894;
+        static const int TERMINATE_CLUSTER_HASH = 796606940;
+        static const int CANCEL_AND_WAIT_HASH = 834500386;
+        static const int CONTINUE_HASH = 215424167;
 
 
         ActionOnFailure GetActionOnFailureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TERMINATE_JOB_FLOW_HASH)
+          switch (hashCode)
           {
+          case TERMINATE_JOB_FLOW_HASH:
             return ActionOnFailure::TERMINATE_JOB_FLOW;
-          }
-          else if (hashCode == TERMINATE_CLUSTER_HASH)
-          {
+          case TERMINATE_CLUSTER_HASH:
             return ActionOnFailure::TERMINATE_CLUSTER;
-          }
-          else if (hashCode == CANCEL_AND_WAIT_HASH)
-          {
+          case CANCEL_AND_WAIT_HASH:
             return ActionOnFailure::CANCEL_AND_WAIT;
-          }
-          else if (hashCode == CONTINUE_HASH)
-          {
+          case CONTINUE_HASH:
             return ActionOnFailure::CONTINUE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,46 +29,44 @@ namespace Aws
       namespace ClusterStateMapper
       {
 
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int BOOTSTRAPPING_HASH = HashingUtils::HashString("BOOTSTRAPPING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int WAITING_HASH = HashingUtils::HashString("WAITING");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int TERMINATED_WITH_ERRORS_HASH = HashingUtils::HashString("TERMINATED_WITH_ERRORS");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int STARTING_HASH = 2099433536;
+        static const int BOOTSTRAPPING_HASH = -2054192960;
+        static const int RUNNING_HASH = -2026200673;
+        static const int WAITING_HASH = 1834295853;
+        static const int TERMINATING_HASH = 234379966;
+        static const int TERMINATED_HASH = -823723485;
+        static const int TERMINATED_WITH_ERRORS_HASH = 1298245864;
 
 
         ClusterState GetClusterStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STARTING_HASH)
+          switch (hashCode)
           {
+          case STARTING_HASH:
             return ClusterState::STARTING;
-          }
-          else if (hashCode == BOOTSTRAPPING_HASH)
-          {
+          case BOOTSTRAPPING_HASH:
             return ClusterState::BOOTSTRAPPING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
+          case RUNNING_HASH:
             return ClusterState::RUNNING;
-          }
-          else if (hashCode == WAITING_HASH)
-          {
+          case WAITING_HASH:
             return ClusterState::WAITING;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
+          case TERMINATING_HASH:
             return ClusterState::TERMINATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
+          case TERMINATED_HASH:
             return ClusterState::TERMINATED;
-          }
-          else if (hashCode == TERMINATED_WITH_ERRORS_HASH)
-          {
+          case TERMINATED_WITH_ERRORS_HASH:
             return ClusterState::TERMINATED_WITH_ERRORS;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,46 +29,44 @@ namespace Aws
       namespace ClusterStateChangeReasonCodeMapper
       {
 
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-        static const int VALIDATION_ERROR_HASH = HashingUtils::HashString("VALIDATION_ERROR");
-        static const int INSTANCE_FAILURE_HASH = HashingUtils::HashString("INSTANCE_FAILURE");
-        static const int BOOTSTRAP_FAILURE_HASH = HashingUtils::HashString("BOOTSTRAP_FAILURE");
-        static const int USER_REQUEST_HASH = HashingUtils::HashString("USER_REQUEST");
-        static const int STEP_FAILURE_HASH = HashingUtils::HashString("STEP_FAILURE");
-        static const int ALL_STEPS_COMPLETED_HASH = HashingUtils::HashString("ALL_STEPS_COMPLETED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int INTERNAL_ERROR_HASH = -485608986;
+        static const int VALIDATION_ERROR_HASH = -998542686;
+        static const int INSTANCE_FAILURE_HASH = -547060800;
+        static const int BOOTSTRAP_FAILURE_HASH = -1645144967;
+        static const int USER_REQUEST_HASH = 579014139;
+        static const int STEP_FAILURE_HASH = -43460873;
+        static const int ALL_STEPS_COMPLETED_HASH = 1790914613;
 
 
         ClusterStateChangeReasonCode GetClusterStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERNAL_ERROR_HASH)
+          switch (hashCode)
           {
+          case INTERNAL_ERROR_HASH:
             return ClusterStateChangeReasonCode::INTERNAL_ERROR;
-          }
-          else if (hashCode == VALIDATION_ERROR_HASH)
-          {
+          case VALIDATION_ERROR_HASH:
             return ClusterStateChangeReasonCode::VALIDATION_ERROR;
-          }
-          else if (hashCode == INSTANCE_FAILURE_HASH)
-          {
+          case INSTANCE_FAILURE_HASH:
             return ClusterStateChangeReasonCode::INSTANCE_FAILURE;
-          }
-          else if (hashCode == BOOTSTRAP_FAILURE_HASH)
-          {
+          case BOOTSTRAP_FAILURE_HASH:
             return ClusterStateChangeReasonCode::BOOTSTRAP_FAILURE;
-          }
-          else if (hashCode == USER_REQUEST_HASH)
-          {
+          case USER_REQUEST_HASH:
             return ClusterStateChangeReasonCode::USER_REQUEST;
-          }
-          else if (hashCode == STEP_FAILURE_HASH)
-          {
+          case STEP_FAILURE_HASH:
             return ClusterStateChangeReasonCode::STEP_FAILURE;
-          }
-          else if (hashCode == ALL_STEPS_COMPLETED_HASH)
-          {
+          case ALL_STEPS_COMPLETED_HASH:
             return ClusterStateChangeReasonCode::ALL_STEPS_COMPLETED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,61 +29,53 @@ namespace Aws
       namespace InstanceGroupStateMapper
       {
 
-        static const int PROVISIONING_HASH = HashingUtils::HashString("PROVISIONING");
-        static const int BOOTSTRAPPING_HASH = HashingUtils::HashString("BOOTSTRAPPING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int RESIZING_HASH = HashingUtils::HashString("RESIZING");
-        static const int SUSPENDED_HASH = HashingUtils::HashString("SUSPENDED");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int ARRESTED_HASH = HashingUtils::HashString("ARRESTED");
-        static const int SHUTTING_DOWN_HASH = HashingUtils::HashString("SHUTTING_DOWN");
-        static const int ENDED_HASH = HashingUtils::HashString("ENDED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PROVISIONING_HASH = -1856587027;
+        static const int BOOTSTRAPPING_HASH = -2054192960;
+        static const int RUNNING_HASH = -2026200673;
+        static const int RESIZING_HASH = 436161649;
+        static const int SUSPENDED_HASH = 1124965819;
+        static const int TERMINATING_HASH = 234379966;
+        static const int TERMINATED_HASH = -823723485;
+        static const int ARRESTED_HASH = -506718492;
+        static const int SHUTTING_DOWN_HASH = -120764897;
+        static const int ENDED_HASH = 66114202;
 
 
         InstanceGroupState GetInstanceGroupStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROVISIONING_HASH)
+          switch (hashCode)
           {
+          case PROVISIONING_HASH:
             return InstanceGroupState::PROVISIONING;
-          }
-          else if (hashCode == BOOTSTRAPPING_HASH)
-          {
+          case BOOTSTRAPPING_HASH:
             return InstanceGroupState::BOOTSTRAPPING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
+          case RUNNING_HASH:
             return InstanceGroupState::RUNNING;
-          }
-          else if (hashCode == RESIZING_HASH)
-          {
+          case RESIZING_HASH:
             return InstanceGroupState::RESIZING;
-          }
-          else if (hashCode == SUSPENDED_HASH)
-          {
+          case SUSPENDED_HASH:
             return InstanceGroupState::SUSPENDED;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
+          case TERMINATING_HASH:
             return InstanceGroupState::TERMINATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
+          case TERMINATED_HASH:
             return InstanceGroupState::TERMINATED;
-          }
-          else if (hashCode == ARRESTED_HASH)
-          {
+          case ARRESTED_HASH:
             return InstanceGroupState::ARRESTED;
-          }
-          else if (hashCode == SHUTTING_DOWN_HASH)
-          {
+          case SHUTTING_DOWN_HASH:
             return InstanceGroupState::SHUTTING_DOWN;
-          }
-          else if (hashCode == ENDED_HASH)
-          {
+          case ENDED_HASH:
             return InstanceGroupState::ENDED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace InstanceGroupTypeMapper
       {
 
-        static const int MASTER_HASH = HashingUtils::HashString("MASTER");
-        static const int CORE_HASH = HashingUtils::HashString("CORE");
-        static const int TASK_HASH = HashingUtils::HashString("TASK");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int MASTER_HASH = -2027938206;
+        static const int CORE_HASH = 2074527;
+        static const int TASK_HASH = 2567557;
 
 
         InstanceGroupType GetInstanceGroupTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MASTER_HASH)
+          switch (hashCode)
           {
+          case MASTER_HASH:
             return InstanceGroupType::MASTER;
-          }
-          else if (hashCode == CORE_HASH)
-          {
+          case CORE_HASH:
             return InstanceGroupType::CORE;
-          }
-          else if (hashCode == TASK_HASH)
-          {
+          case TASK_HASH:
             return InstanceGroupType::TASK;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
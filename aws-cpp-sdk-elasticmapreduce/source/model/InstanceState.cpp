@@ -29,36 +29,38 @@ namespace Aws
       namespace InstanceStateMapper
       {
 
-        static const int AWAITING_FULFILLMENT_HASH = HashingUtils::HashString("AWAITING_FULFILLMENT");
-        static const int PROVISIONING_HASH = HashingUtils::HashString("PROVISIONING");
-        static const int BOOTSTRAPPING_HASH = HashingUtils::HashString("BOOTSTRAPPING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int AWAITING_FULFILLMENT_HASH = -281610037;
+        static const int PROVISIONING_HASH = -1856587027;
+        static const int BOOTSTRAPPING_HASH = -2054192960;
+        static const int RUNNING_HASH = -2026200673;
+        static const int TERMINATED_HASH = -823723485;
 
 
         InstanceState GetInstanceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWAITING_FULFILLMENT_HASH)
+          switch (hashCode)
           {
+          case AWAITING_FULFILLMENT_HASH:
             return InstanceState::AWAITING_FULFILLMENT;
-          }
-          else if (hashCode == PROVISIONING_HASH)
-          {
+          case PROVISIONING_HASH:
             return InstanceState::PROVISIONING;
-          }
-          else if (hashCode == BOOTSTRAPPING_HASH)
-          {
+          case BOOTSTRAPPING_HASH:
             return InstanceState::BOOTSTRAPPING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
+          case RUNNING_HASH:
             return InstanceState::RUNNING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
+          case TERMINATED_HASH:
             return InstanceState::TERMINATED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
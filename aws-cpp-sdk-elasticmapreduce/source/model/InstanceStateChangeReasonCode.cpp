@@ -29,36 +29,38 @@ namespace Aws
       namespace InstanceStateChangeReasonCodeMapper
       {
 
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-        static const int VALIDATION_ERROR_HASH = HashingUtils::HashString("VALIDATION_ERROR");
-        static const int INSTANCE_FAILURE_HASH = HashingUtils::HashString("INSTANCE_FAILURE");
-        static const int BOOTSTRAP_FAILURE_HASH = HashingUtils::HashString("BOOTSTRAP_FAILURE");
-        static const int CLUSTER_TERMINATED_HASH = HashingUtils::HashString("CLUSTER_TERMINATED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int INTERNAL_ERROR_HASH = -485608986;
+        static const int VALIDATION_ERROR_HASH = -998542686;
+        static const int INSTANCE_FAILURE_HASH = -547060800;
+        static const int BOOTSTRAP_FAILURE_HASH = -1645144967;
+        static const int CLUSTER_TERMINATED_HASH = 1492215208;
 
 
         InstanceStateChangeReasonCode GetInstanceStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERNAL_ERROR_HASH)
+          switch (hashCode)
           {
+          case INTERNAL_ERROR_HASH:
             return InstanceStateChangeReasonCode::INTERNAL_ERROR;
-          }
-          else if (hashCode == VALIDATION_ERROR_HASH)
-          {
+          case VALIDATION_ERROR_HASH:
             return InstanceStateChangeReasonCode::VALIDATION_ERROR;
-          }
-          else if (hashCode == INSTANCE_FAILURE_HASH)
-          {
+          case INSTANCE_FAILURE_HASH:
             return InstanceStateChangeReasonCode::INSTANCE_FAILURE;
-          }
-          else if (hashCode == BOOTSTRAP_FAILURE_HASH)
-          {
+          case BOOTSTRAP_FAILURE_HASH:
             return InstanceStateChangeReasonCode::BOOTSTRAP_FAILURE;
-          }
-          else if (hashCode == CLUSTER_TERMINATED_HASH)
-          {
+          case CLUSTER_TERMINATED_HASH:
             return InstanceStateChangeReasonCode::CLUSTER_TERMINATED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
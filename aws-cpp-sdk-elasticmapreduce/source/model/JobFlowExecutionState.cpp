@@ -29,51 +29,47 @@ namespace Aws
       namespace JobFlowExecutionStateMapper
       {
 
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int BOOTSTRAPPING_HASH = HashingUtils::HashString("BOOTSTRAPPING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int WAITING_HASH = HashingUtils::HashString("WAITING");
-        static const int SHUTTING_DOWN_HASH = HashingUtils::HashString("SHUTTING_DOWN");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int STARTING_HASH = 2099433536;
+        static const int BOOTSTRAPPING_HASH = -2054192960;
+        static const int RUNNING_HASH = -2026200673;
+        static const int WAITING_HASH = 1834295853;
+        static const int SHUTTING_DOWN_HASH = -120764897;
+        static const int TERMINATED_HASH = -823723485;
+        static const int COMPLETED_HASH = 1383663147;
+        static const int FAILED_HASH = 2066319421;
 
 
         JobFlowExecutionState GetJobFlowExecutionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STARTING_HASH)
+          switch (hashCode)
           {
+          case STARTING_HASH:
             return JobFlowExecutionState::STARTING;
-          }
-          else if (hashCode == BOOTSTRAPPING_HASH)
-          {
+          case BOOTSTRAPPING_HASH:
             return JobFlowExecutionState::BOOTSTRAPPING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
+          case RUNNING_HASH:
             return JobFlowExecutionState::RUNNING;
-          }
-          else if (hashCode == WAITING_HASH)
-          {
+          case WAITING_HASH:
             return JobFlowExecutionState::WAITING;
-          }
-          else if (hashCode == SHUTTING_DOWN_HASH)
-          {
+          case SHUTTING_DOWN_HASH:
             return JobFlowExecutionState::SHUTTING_DOWN;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
+          case TERMINATED_HASH:
             return JobFlowExecutionState::TERMINATED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
+          case COMPLETED_HASH:
             return JobFlowExecutionState::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return JobFlowExecutionState::FAILED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace MarketTypeMapper
       {
 
-        static const int ON_DEMAND_HASH = HashingUtils::HashString("ON_DEMAND");
-        static const int SPOT_HASH = HashingUtils::HashString("SPOT");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ON_DEMAND_HASH = -2128361301;
+        static const int SPOT_HASH = 2552066;
 
 
         MarketType GetMarketTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ON_DEMAND_HASH)
+          switch (hashCode)
           {
+          case ON_DEMAND_HASH:
             return MarketType::ON_DEMAND;
-          }
-          else if (hashCode == SPOT_HASH)
-          {
+          case SPOT_HASH:
             return MarketType::SPOT;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,46 +29,44 @@ namespace Aws
       namespace StepExecutionStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int CONTINUE_HASH = HashingUtils::HashString("CONTINUE");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int INTERRUPTED_HASH = HashingUtils::HashString("INTERRUPTED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PENDING_HASH = 35394935;
+        static const int RUNNING_HASH = -2026200673;
+        static const int CONTINUE_HASH = 215424167;
+        static const int COMPLETED_HASH = 1383663147;
+        static const int CANCELLED_HASH = -1031784143;
+        static const int FAILED_HASH = 2066319421;
+        static const int INTERRUPTED_HASH = 205308450;
 
 
         StepExecutionState GetStepExecutionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          switch (hashCode)
           {
+          case PENDING_HASH:
             return StepExecutionState::PENDING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
+          case RUNNING_HASH:
             return StepExecutionState::RUNNING;
-          }
-          else if (hashCode == CONTINUE_HASH)
-          {
+          case CONTINUE_HASH:
             return StepExecutionState::CONTINUE;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
+          case COMPLETED_HASH:
             return StepExecutionState::COMPLETED;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
+          case CANCELLED_HASH:
             return StepExecutionState::CANCELLED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return StepExecutionState::FAILED;
-          }
-          else if (hashCode == INTERRUPTED_HASH)
-          {
+          case INTERRUPTED_HASH:
             return StepExecutionState::INTERRUPTED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace StepStateChangeReasonCodeMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int NONE_HASH = 2402104;
 
 
         StepStateChangeReasonCode GetStepStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          switch (hashCode)
           {
+          case NONE_HASH:
             return StepStateChangeReasonCode::NONE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
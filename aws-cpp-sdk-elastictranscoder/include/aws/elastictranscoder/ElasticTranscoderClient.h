@@ -38,6 +38,9 @@
 #include <aws/elastictranscoder/model/UpdatePipelineNotificationsResult.h>
 #include <aws/elastictranscoder/model/UpdatePipelineStatusResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -215,6 +218,18 @@ namespace Model
          */
         virtual void CancelJobAsync(const Model::CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelJobCallable(const Model::CancelJobRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelJobOutcomeCallable CancelJobCallable(Model::CancelJobRequest&& request) const;
+
+        /**
+         * Same as CancelJobAsync(const Model::CancelJobRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelJobAsync(Model::CancelJobRequest&& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> When you create a job, Elastic Transcoder returns JSON data that includes
          * the values that you specified plus information about the job that is created.
@@ -249,6 +264,18 @@ namespace Model
          */
         virtual void CreateJobAsync(const Model::CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateJobCallable(const Model::CreateJobRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateJobOutcomeCallable CreateJobCallable(Model::CreateJobRequest&& request) const;
+
+        /**
+         * Same as CreateJobAsync(const Model::CreateJobRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateJobAsync(Model::CreateJobRequest&& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The CreatePipeline operation creates a pipeline with settings that you
          * specify.</p>
@@ -271,6 +298,18 @@ namespace Model
          */
         virtual void CreatePipelineAsync(const Model::CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePipelineCallable(const Model::CreatePipelineRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreatePipelineOutcomeCallable CreatePipelineCallable(Model::CreatePipelineRequest&& request) const;
+
+        /**
+         * Same as CreatePipelineAsync(const Model::CreatePipelineRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreatePipelineAsync(Model::CreatePipelineRequest&& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The CreatePreset operation creates a preset with settings that you
          * specify.</p> <important>Elastic Transcoder checks the CreatePreset settings to
@@ -329,6 +368,18 @@ namespace Model
          */
         virtual void CreatePresetAsync(const Model::CreatePresetRequest& request, const CreatePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePresetCallable(const Model::CreatePresetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreatePresetOutcomeCallable CreatePresetCallable(Model::CreatePresetRequest&& request) const;
+
+        /**
+         * Same as CreatePresetAsync(const Model::CreatePresetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreatePresetAsync(Model::CreatePresetRequest&& request, const CreatePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The DeletePipeline operation removes a pipeline.</p> <p> You can only delete
          * a pipeline that has never been used or that is not currently in use (doesn't
@@ -357,6 +408,18 @@ namespace Model
          */
         virtual void DeletePipelineAsync(const Model::DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePipelineCallable(const Model::DeletePipelineRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeletePipelineOutcomeCallable DeletePipelineCallable(Model::DeletePipelineRequest&& request) const;
+
+        /**
+         * Same as DeletePipelineAsync(const Model::DeletePipelineRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeletePipelineAsync(Model::DeletePipelineRequest&& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The DeletePreset operation removes a preset that you've added in an AWS
          * region.</p> <note> <p>You can't delete the default presets that are included
@@ -382,6 +445,18 @@ namespace Model
          */
         virtual void DeletePresetAsync(const Model::DeletePresetRequest& request, const DeletePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePresetCallable(const Model::DeletePresetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeletePresetOutcomeCallable DeletePresetCallable(Model::DeletePresetRequest&& request) const;
+
+        /**
+         * Same as DeletePresetAsync(const Model::DeletePresetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeletePresetAsync(Model::DeletePresetRequest&& request, const DeletePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The ListJobsByPipeline operation gets a list of the jobs currently in a
          * pipeline.</p> <p>Elastic Transcoder returns all of the jobs currently in the
@@ -410,6 +485,18 @@ namespace Model
          */
         virtual void ListJobsByPipelineAsync(const Model::ListJobsByPipelineRequest& request, const ListJobsByPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListJobsByPipelineCallable(const Model::ListJobsByPipelineRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListJobsByPipelineOutcomeCallable ListJobsByPipelineCallable(Model::ListJobsByPipelineRequest&& request) const;
+
+        /**
+         * Same as ListJobsByPipelineAsync(const Model::ListJobsByPipelineRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListJobsByPipelineAsync(Model::ListJobsByPipelineRequest&& request, const ListJobsByPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The ListJobsByStatus operation gets a list of jobs that have a specified
          * status. The response body contains one element for each job that satisfies the
@@ -435,6 +522,18 @@ namespace Model
          */
         virtual void ListJobsByStatusAsync(const Model::ListJobsByStatusRequest& request, const ListJobsByStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListJobsByStatusCallable(const Model::ListJobsByStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListJobsByStatusOutcomeCallable ListJobsByStatusCallable(Model::ListJobsByStatusRequest&& request) const;
+
+        /**
+         * Same as ListJobsByStatusAsync(const Model::ListJobsByStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListJobsByStatusAsync(Model::ListJobsByStatusRequest&& request, const ListJobsByStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The ListPipelines operation gets a list of the pipelines associated with the
          * current AWS account.</p>
@@ -457,6 +556,18 @@ namespace Model
          */
         virtual void ListPipelinesAsync(const Model::ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPipelinesCallable(const Model::ListPipelinesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListPipelinesOutcomeCallable ListPipelinesCallable(Model::ListPipelinesRequest&& request) const;
+
+        /**
+         * Same as ListPipelinesAsync(const Model::ListPipelinesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPipelinesAsync(Model::ListPipelinesRequest&& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The ListPresets operation gets a list of the default presets included with
          * Elastic Transcoder and the presets that you've added in an AWS region.</p>
@@ -479,6 +590,18 @@ namespace Model
          */
         virtual void ListPresetsAsync(const Model::ListPresetsRequest& request, const ListPresetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPresetsCallable(const Model::ListPresetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListPresetsOutcomeCallable ListPresetsCallable(Model::ListPresetsRequest&& request) const;
+
+        /**
+         * Same as ListPresetsAsync(const Model::ListPresetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPresetsAsync(Model::ListPresetsRequest&& request, const ListPresetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The ReadJob operation returns detailed information about a job.</p>
          */
@@ -498,6 +621,18 @@ namespace Model
          */
         virtual void ReadJobAsync(const Model::ReadJobRequest& request, const ReadJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReadJobCallable(const Model::ReadJobRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReadJobOutcomeCallable ReadJobCallable(Model::ReadJobRequest&& request) const;
+
+        /**
+         * Same as ReadJobAsync(const Model::ReadJobRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReadJobAsync(Model::ReadJobRequest&& request, const ReadJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The ReadPipeline operation gets detailed information about a pipeline.</p>
          */
@@ -517,6 +652,18 @@ namespace Model
          */
         virtual void ReadPipelineAsync(const Model::ReadPipelineRequest& request, const ReadPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReadPipelineCallable(const Model::ReadPipelineRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReadPipelineOutcomeCallable ReadPipelineCallable(Model::ReadPipelineRequest&& request) const;
+
+        /**
+         * Same as ReadPipelineAsync(const Model::ReadPipelineRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReadPipelineAsync(Model::ReadPipelineRequest&& request, const ReadPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The ReadPreset operation gets detailed information about a preset.</p>
          */
@@ -536,6 +683,18 @@ namespace Model
          */
         virtual void ReadPresetAsync(const Model::ReadPresetRequest& request, const ReadPresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReadPresetCallable(const Model::ReadPresetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReadPresetOutcomeCallable ReadPresetCallable(Model::ReadPresetRequest&& request) const;
+
+        /**
+         * Same as ReadPresetAsync(const Model::ReadPresetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReadPresetAsync(Model::ReadPresetRequest&& request, const ReadPresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The TestRole operation tests the IAM role used to create the pipeline.</p>
          * <p>The <code>TestRole</code> action lets you determine whether the IAM role you
@@ -570,6 +729,18 @@ namespace Model
          */
         virtual void TestRoleAsync(const Model::TestRoleRequest& request, const TestRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TestRoleCallable(const Model::TestRoleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TestRoleOutcomeCallable TestRoleCallable(Model::TestRoleRequest&& request) const;
+
+        /**
+         * Same as TestRoleAsync(const Model::TestRoleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TestRoleAsync(Model::TestRoleRequest&& request, const TestRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Use the <code>UpdatePipeline</code> operation to update settings for a
          * pipeline. <important>When you change pipeline settings, your changes take effect
@@ -601,6 +772,18 @@ namespace Model
          */
         virtual void UpdatePipelineAsync(const Model::UpdatePipelineRequest& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdatePipelineCallable(const Model::UpdatePipelineRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdatePipelineOutcomeCallable UpdatePipelineCallable(Model::UpdatePipelineRequest&& request) const;
+
+        /**
+         * Same as UpdatePipelineAsync(const Model::UpdatePipelineRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdatePipelineAsync(Model::UpdatePipelineRequest&& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>With the UpdatePipelineNotifications operation, you can update Amazon Simple
          * Notification Service (Amazon SNS) notifications for a pipeline.</p> <p>When you
@@ -629,6 +812,18 @@ namespace Model
          */
         virtual void UpdatePipelineNotificationsAsync(const Model::UpdatePipelineNotificationsRequest& request, const UpdatePipelineNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdatePipelineNotificationsCallable(const Model::UpdatePipelineNotificationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdatePipelineNotificationsOutcomeCallable UpdatePipelineNotificationsCallable(Model::UpdatePipelineNotificationsRequest&& request) const;
+
+        /**
+         * Same as UpdatePipelineNotificationsAsync(const Model::UpdatePipelineNotificationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdatePipelineNotificationsAsync(Model::UpdatePipelineNotificationsRequest&& request, const UpdatePipelineNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The UpdatePipelineStatus operation pauses or reactivates a pipeline, so that
          * the pipeline stops or restarts the processing of jobs.</p> <p>Changing the
@@ -666,6 +861,125 @@ namespace Model
          */
         virtual void UpdatePipelineStatusAsync(const Model::UpdatePipelineStatusRequest& request, const UpdatePipelineStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdatePipelineStatusCallable(const Model::UpdatePipelineStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdatePipelineStatusOutcomeCallable UpdatePipelineStatusCallable(Model::UpdatePipelineStatusRequest&& request) const;
+
+        /**
+         * Same as UpdatePipelineStatusAsync(const Model::UpdatePipelineStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdatePipelineStatusAsync(Model::UpdatePipelineStatusRequest&& request, const UpdatePipelineStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListJobsByPipeline(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElasticTranscoderClient, Model::ListJobsByPipelineRequest, Model::ListJobsByPipelineOutcome> ListJobsByPipelinePaginator(const Model::ListJobsByPipelineRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListJobsByStatus(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElasticTranscoderClient, Model::ListJobsByStatusRequest, Model::ListJobsByStatusOutcome> ListJobsByStatusPaginator(const Model::ListJobsByStatusRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListPipelines(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElasticTranscoderClient, Model::ListPipelinesRequest, Model::ListPipelinesOutcome> ListPipelinesPaginator(const Model::ListPipelinesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListPresets(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ElasticTranscoderClient, Model::ListPresetsRequest, Model::ListPresetsOutcome> ListPresetsPaginator(const Model::ListPresetsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CancelJob(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::CancelJobRequest, Model::CancelJobOutcome> CancelJobAwaitable(Model::CancelJobRequest request) const;
+
+        /**
+         * co_await-able form of CreateJob(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::CreateJobRequest, Model::CreateJobOutcome> CreateJobAwaitable(Model::CreateJobRequest request) const;
+
+        /**
+         * co_await-able form of CreatePipeline(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::CreatePipelineRequest, Model::CreatePipelineOutcome> CreatePipelineAwaitable(Model::CreatePipelineRequest request) const;
+
+        /**
+         * co_await-able form of CreatePreset(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::CreatePresetRequest, Model::CreatePresetOutcome> CreatePresetAwaitable(Model::CreatePresetRequest request) const;
+
+        /**
+         * co_await-able form of DeletePipeline(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::DeletePipelineRequest, Model::DeletePipelineOutcome> DeletePipelineAwaitable(Model::DeletePipelineRequest request) const;
+
+        /**
+         * co_await-able form of DeletePreset(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::DeletePresetRequest, Model::DeletePresetOutcome> DeletePresetAwaitable(Model::DeletePresetRequest request) const;
+
+        /**
+         * co_await-able form of ListJobsByPipeline(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::ListJobsByPipelineRequest, Model::ListJobsByPipelineOutcome> ListJobsByPipelineAwaitable(Model::ListJobsByPipelineRequest request) const;
+
+        /**
+         * co_await-able form of ListJobsByStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::ListJobsByStatusRequest, Model::ListJobsByStatusOutcome> ListJobsByStatusAwaitable(Model::ListJobsByStatusRequest request) const;
+
+        /**
+         * co_await-able form of ListPipelines(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::ListPipelinesRequest, Model::ListPipelinesOutcome> ListPipelinesAwaitable(Model::ListPipelinesRequest request) const;
+
+        /**
+         * co_await-able form of ListPresets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::ListPresetsRequest, Model::ListPresetsOutcome> ListPresetsAwaitable(Model::ListPresetsRequest request) const;
+
+        /**
+         * co_await-able form of ReadJob(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::ReadJobRequest, Model::ReadJobOutcome> ReadJobAwaitable(Model::ReadJobRequest request) const;
+
+        /**
+         * co_await-able form of ReadPipeline(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::ReadPipelineRequest, Model::ReadPipelineOutcome> ReadPipelineAwaitable(Model::ReadPipelineRequest request) const;
+
+        /**
+         * co_await-able form of ReadPreset(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::ReadPresetRequest, Model::ReadPresetOutcome> ReadPresetAwaitable(Model::ReadPresetRequest request) const;
+
+        /**
+         * co_await-able form of TestRole(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::TestRoleRequest, Model::TestRoleOutcome> TestRoleAwaitable(Model::TestRoleRequest request) const;
+
+        /**
+         * co_await-able form of UpdatePipeline(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::UpdatePipelineRequest, Model::UpdatePipelineOutcome> UpdatePipelineAwaitable(Model::UpdatePipelineRequest request) const;
+
+        /**
+         * co_await-able form of UpdatePipelineNotifications(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::UpdatePipelineNotificationsRequest, Model::UpdatePipelineNotificationsOutcome> UpdatePipelineNotificationsAwaitable(Model::UpdatePipelineNotificationsRequest request) const;
+
+        /**
+         * co_await-able form of UpdatePipelineStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticTranscoderClient, Model::UpdatePipelineStatusRequest, Model::UpdatePipelineStatusOutcome> UpdatePipelineStatusAwaitable(Model::UpdatePipelineStatusRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
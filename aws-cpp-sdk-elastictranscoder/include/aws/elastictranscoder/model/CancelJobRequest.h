@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CancelJobRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelJob"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreatePipelineRequest();
+    inline const char* GetServiceRequestName() const override { return "CreatePipeline"; }
+
     Aws::String SerializePayload() const override;
 
     /**
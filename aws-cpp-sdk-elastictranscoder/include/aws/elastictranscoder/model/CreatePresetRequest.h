@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreatePresetRequest();
+    inline const char* GetServiceRequestName() const override { return "CreatePreset"; }
+
     Aws::String SerializePayload() const override;
 
     /**
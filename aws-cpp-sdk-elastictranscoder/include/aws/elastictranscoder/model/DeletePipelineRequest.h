@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeletePipelineRequest();
+    inline const char* GetServiceRequestName() const override { return "DeletePipeline"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeletePresetRequest();
+    inline const char* GetServiceRequestName() const override { return "DeletePreset"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListJobsByPipelineRequest();
+    inline const char* GetServiceRequestName() const override { return "ListJobsByPipeline"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
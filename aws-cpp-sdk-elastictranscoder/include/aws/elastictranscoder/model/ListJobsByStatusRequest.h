@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListJobsByStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "ListJobsByStatus"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
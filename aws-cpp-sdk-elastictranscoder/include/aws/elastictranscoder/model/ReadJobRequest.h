@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ReadJobRequest();
+    inline const char* GetServiceRequestName() const override { return "ReadJob"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ReadPipelineRequest();
+    inline const char* GetServiceRequestName() const override { return "ReadPipeline"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ReadPresetRequest();
+    inline const char* GetServiceRequestName() const override { return "ReadPreset"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     TestRoleRequest();
+    inline const char* GetServiceRequestName() const override { return "TestRole"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdatePipelineNotificationsRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdatePipelineNotifications"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdatePipelineRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdatePipeline"; }
+
     Aws::String SerializePayload() const override;
 
     /**
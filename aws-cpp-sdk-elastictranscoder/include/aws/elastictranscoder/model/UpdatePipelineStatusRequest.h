@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdatePipelineStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdatePipelineStatus"; }
+
     Aws::String SerializePayload() const override;
 
     /**
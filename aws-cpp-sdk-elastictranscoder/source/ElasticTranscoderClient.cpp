@@ -127,7 +127,7 @@ CancelJobOutcome ElasticTranscoderClient::CancelJob(const CancelJobRequest& requ
 
 CancelJobOutcomeCallable ElasticTranscoderClient::CancelJobCallable(const CancelJobRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelJob(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelJob(request); } );
 }
 
 void ElasticTranscoderClient::CancelJobAsync(const CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -135,6 +135,16 @@ void ElasticTranscoderClient::CancelJobAsync(const CancelJobRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CancelJobAsyncHelper( request, handler, context ); } );
 }
 
+CancelJobOutcomeCallable ElasticTranscoderClient::CancelJobCallable(CancelJobRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::CancelJob, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::CancelJobAsync(CancelJobRequest&& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::CancelJobAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::CancelJobAsyncHelper(const CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelJob(request), context);
@@ -158,7 +168,7 @@ CreateJobOutcome ElasticTranscoderClient::CreateJob(const CreateJobRequest& requ
 
 CreateJobOutcomeCallable ElasticTranscoderClient::CreateJobCallable(const CreateJobRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateJob(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateJob(request); } );
 }
 
 void ElasticTranscoderClient::CreateJobAsync(const CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -166,6 +176,16 @@ void ElasticTranscoderClient::CreateJobAsync(const CreateJobRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CreateJobAsyncHelper( request, handler, context ); } );
 }
 
+CreateJobOutcomeCallable ElasticTranscoderClient::CreateJobCallable(CreateJobRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::CreateJob, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::CreateJobAsync(CreateJobRequest&& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::CreateJobAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::CreateJobAsyncHelper(const CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateJob(request), context);
@@ -189,7 +209,7 @@ CreatePipelineOutcome ElasticTranscoderClient::CreatePipeline(const CreatePipeli
 
 CreatePipelineOutcomeCallable ElasticTranscoderClient::CreatePipelineCallable(const CreatePipelineRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreatePipeline(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreatePipeline(request); } );
 }
 
 void ElasticTranscoderClient::CreatePipelineAsync(const CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -197,6 +217,16 @@ void ElasticTranscoderClient::CreatePipelineAsync(const CreatePipelineRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->CreatePipelineAsyncHelper( request, handler, context ); } );
 }
 
+CreatePipelineOutcomeCallable ElasticTranscoderClient::CreatePipelineCallable(CreatePipelineRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::CreatePipeline, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::CreatePipelineAsync(CreatePipelineRequest&& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::CreatePipelineAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::CreatePipelineAsyncHelper(const CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreatePipeline(request), context);
@@ -220,7 +250,7 @@ CreatePresetOutcome ElasticTranscoderClient::CreatePreset(const CreatePresetRequ
 
 CreatePresetOutcomeCallable ElasticTranscoderClient::CreatePresetCallable(const CreatePresetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreatePreset(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreatePreset(request); } );
 }
 
 void ElasticTranscoderClient::CreatePresetAsync(const CreatePresetRequest& request, const CreatePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -228,6 +258,16 @@ void ElasticTranscoderClient::CreatePresetAsync(const CreatePresetRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->CreatePresetAsyncHelper( request, handler, context ); } );
 }
 
+CreatePresetOutcomeCallable ElasticTranscoderClient::CreatePresetCallable(CreatePresetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::CreatePreset, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::CreatePresetAsync(CreatePresetRequest&& request, const CreatePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::CreatePresetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::CreatePresetAsyncHelper(const CreatePresetRequest& request, const CreatePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreatePreset(request), context);
@@ -252,7 +292,7 @@ DeletePipelineOutcome ElasticTranscoderClient::DeletePipeline(const DeletePipeli
 
 DeletePipelineOutcomeCallable ElasticTranscoderClient::DeletePipelineCallable(const DeletePipelineRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeletePipeline(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeletePipeline(request); } );
 }
 
 void ElasticTranscoderClient::DeletePipelineAsync(const DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -260,6 +300,16 @@ void ElasticTranscoderClient::DeletePipelineAsync(const DeletePipelineRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DeletePipelineAsyncHelper( request, handler, context ); } );
 }
 
+DeletePipelineOutcomeCallable ElasticTranscoderClient::DeletePipelineCallable(DeletePipelineRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::DeletePipeline, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::DeletePipelineAsync(DeletePipelineRequest&& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::DeletePipelineAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::DeletePipelineAsyncHelper(const DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeletePipeline(request), context);
@@ -284,7 +334,7 @@ DeletePresetOutcome ElasticTranscoderClient::DeletePreset(const DeletePresetRequ
 
 DeletePresetOutcomeCallable ElasticTranscoderClient::DeletePresetCallable(const DeletePresetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeletePreset(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeletePreset(request); } );
 }
 
 void ElasticTranscoderClient::DeletePresetAsync(const DeletePresetRequest& request, const DeletePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -292,6 +342,16 @@ void ElasticTranscoderClient::DeletePresetAsync(const DeletePresetRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DeletePresetAsyncHelper( request, handler, context ); } );
 }
 
+DeletePresetOutcomeCallable ElasticTranscoderClient::DeletePresetCallable(DeletePresetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::DeletePreset, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::DeletePresetAsync(DeletePresetRequest&& request, const DeletePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::DeletePresetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::DeletePresetAsyncHelper(const DeletePresetRequest& request, const DeletePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeletePreset(request), context);
@@ -316,7 +376,7 @@ ListJobsByPipelineOutcome ElasticTranscoderClient::ListJobsByPipeline(const List
 
 ListJobsByPipelineOutcomeCallable ElasticTranscoderClient::ListJobsByPipelineCallable(const ListJobsByPipelineRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListJobsByPipeline(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListJobsByPipeline(request); } );
 }
 
 void ElasticTranscoderClient::ListJobsByPipelineAsync(const ListJobsByPipelineRequest& request, const ListJobsByPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -324,6 +384,16 @@ void ElasticTranscoderClient::ListJobsByPipelineAsync(const ListJobsByPipelineRe
   m_executor->Submit( [this, request, handler, context](){ this->ListJobsByPipelineAsyncHelper( request, handler, context ); } );
 }
 
+ListJobsByPipelineOutcomeCallable ElasticTranscoderClient::ListJobsByPipelineCallable(ListJobsByPipelineRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::ListJobsByPipeline, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::ListJobsByPipelineAsync(ListJobsByPipelineRequest&& request, const ListJobsByPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::ListJobsByPipelineAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::ListJobsByPipelineAsyncHelper(const ListJobsByPipelineRequest& request, const ListJobsByPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListJobsByPipeline(request), context);
@@ -348,7 +418,7 @@ ListJobsByStatusOutcome ElasticTranscoderClient::ListJobsByStatus(const ListJobs
 
 ListJobsByStatusOutcomeCallable ElasticTranscoderClient::ListJobsByStatusCallable(const ListJobsByStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListJobsByStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListJobsByStatus(request); } );
 }
 
 void ElasticTranscoderClient::ListJobsByStatusAsync(const ListJobsByStatusRequest& request, const ListJobsByStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -356,6 +426,16 @@ void ElasticTranscoderClient::ListJobsByStatusAsync(const ListJobsByStatusReques
   m_executor->Submit( [this, request, handler, context](){ this->ListJobsByStatusAsyncHelper( request, handler, context ); } );
 }
 
+ListJobsByStatusOutcomeCallable ElasticTranscoderClient::ListJobsByStatusCallable(ListJobsByStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::ListJobsByStatus, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::ListJobsByStatusAsync(ListJobsByStatusRequest&& request, const ListJobsByStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::ListJobsByStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::ListJobsByStatusAsyncHelper(const ListJobsByStatusRequest& request, const ListJobsByStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListJobsByStatus(request), context);
@@ -379,7 +459,7 @@ ListPipelinesOutcome ElasticTranscoderClient::ListPipelines(const ListPipelinesR
 
 ListPipelinesOutcomeCallable ElasticTranscoderClient::ListPipelinesCallable(const ListPipelinesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListPipelines(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListPipelines(request); } );
 }
 
 void ElasticTranscoderClient::ListPipelinesAsync(const ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -387,6 +467,16 @@ void ElasticTranscoderClient::ListPipelinesAsync(const ListPipelinesRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->ListPipelinesAsyncHelper( request, handler, context ); } );
 }
 
+ListPipelinesOutcomeCallable ElasticTranscoderClient::ListPipelinesCallable(ListPipelinesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::ListPipelines, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::ListPipelinesAsync(ListPipelinesRequest&& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::ListPipelinesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::ListPipelinesAsyncHelper(const ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListPipelines(request), context);
@@ -410,7 +500,7 @@ ListPresetsOutcome ElasticTranscoderClient::ListPresets(const ListPresetsRequest
 
 ListPresetsOutcomeCallable ElasticTranscoderClient::ListPresetsCallable(const ListPresetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListPresets(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListPresets(request); } );
 }
 
 void ElasticTranscoderClient::ListPresetsAsync(const ListPresetsRequest& request, const ListPresetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -418,6 +508,16 @@ void ElasticTranscoderClient::ListPresetsAsync(const ListPresetsRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->ListPresetsAsyncHelper( request, handler, context ); } );
 }
 
+ListPresetsOutcomeCallable ElasticTranscoderClient::ListPresetsCallable(ListPresetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::ListPresets, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::ListPresetsAsync(ListPresetsRequest&& request, const ListPresetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::ListPresetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::ListPresetsAsyncHelper(const ListPresetsRequest& request, const ListPresetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListPresets(request), context);
@@ -442,7 +542,7 @@ ReadJobOutcome ElasticTranscoderClient::ReadJob(const ReadJobRequest& request) c
 
 ReadJobOutcomeCallable ElasticTranscoderClient::ReadJobCallable(const ReadJobRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReadJob(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ReadJob(request); } );
 }
 
 void ElasticTranscoderClient::ReadJobAsync(const ReadJobRequest& request, const ReadJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -450,6 +550,16 @@ void ElasticTranscoderClient::ReadJobAsync(const ReadJobRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ReadJobAsyncHelper( request, handler, context ); } );
 }
 
+ReadJobOutcomeCallable ElasticTranscoderClient::ReadJobCallable(ReadJobRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::ReadJob, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::ReadJobAsync(ReadJobRequest&& request, const ReadJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::ReadJobAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::ReadJobAsyncHelper(const ReadJobRequest& request, const ReadJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReadJob(request), context);
@@ -474,7 +584,7 @@ ReadPipelineOutcome ElasticTranscoderClient::ReadPipeline(const ReadPipelineRequ
 
 ReadPipelineOutcomeCallable ElasticTranscoderClient::ReadPipelineCallable(const ReadPipelineRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReadPipeline(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ReadPipeline(request); } );
 }
 
 void ElasticTranscoderClient::ReadPipelineAsync(const ReadPipelineRequest& request, const ReadPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -482,6 +592,16 @@ void ElasticTranscoderClient::ReadPipelineAsync(const ReadPipelineRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ReadPipelineAsyncHelper( request, handler, context ); } );
 }
 
+ReadPipelineOutcomeCallable ElasticTranscoderClient::ReadPipelineCallable(ReadPipelineRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::ReadPipeline, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::ReadPipelineAsync(ReadPipelineRequest&& request, const ReadPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::ReadPipelineAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::ReadPipelineAsyncHelper(const ReadPipelineRequest& request, const ReadPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReadPipeline(request), context);
@@ -506,7 +626,7 @@ ReadPresetOutcome ElasticTranscoderClient::ReadPreset(const ReadPresetRequest& r
 
 ReadPresetOutcomeCallable ElasticTranscoderClient::ReadPresetCallable(const ReadPresetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReadPreset(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ReadPreset(request); } );
 }
 
 void ElasticTranscoderClient::ReadPresetAsync(const ReadPresetRequest& request, const ReadPresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -514,6 +634,16 @@ void ElasticTranscoderClient::ReadPresetAsync(const ReadPresetRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ReadPresetAsyncHelper( request, handler, context ); } );
 }
 
+ReadPresetOutcomeCallable ElasticTranscoderClient::ReadPresetCallable(ReadPresetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::ReadPreset, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::ReadPresetAsync(ReadPresetRequest&& request, const ReadPresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::ReadPresetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::ReadPresetAsyncHelper(const ReadPresetRequest& request, const ReadPresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReadPreset(request), context);
@@ -537,7 +667,7 @@ TestRoleOutcome ElasticTranscoderClient::TestRole(const TestRoleRequest& request
 
 TestRoleOutcomeCallable ElasticTranscoderClient::TestRoleCallable(const TestRoleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TestRole(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TestRole(request); } );
 }
 
 void ElasticTranscoderClient::TestRoleAsync(const TestRoleRequest& request, const TestRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -545,6 +675,16 @@ void ElasticTranscoderClient::TestRoleAsync(const TestRoleRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->TestRoleAsyncHelper( request, handler, context ); } );
 }
 
+TestRoleOutcomeCallable ElasticTranscoderClient::TestRoleCallable(TestRoleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::TestRole, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::TestRoleAsync(TestRoleRequest&& request, const TestRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::TestRoleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::TestRoleAsyncHelper(const TestRoleRequest& request, const TestRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TestRole(request), context);
@@ -569,7 +709,7 @@ UpdatePipelineOutcome ElasticTranscoderClient::UpdatePipeline(const UpdatePipeli
 
 UpdatePipelineOutcomeCallable ElasticTranscoderClient::UpdatePipelineCallable(const UpdatePipelineRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdatePipeline(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdatePipeline(request); } );
 }
 
 void ElasticTranscoderClient::UpdatePipelineAsync(const UpdatePipelineRequest& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -577,6 +717,16 @@ void ElasticTranscoderClient::UpdatePipelineAsync(const UpdatePipelineRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->UpdatePipelineAsyncHelper( request, handler, context ); } );
 }
 
+UpdatePipelineOutcomeCallable ElasticTranscoderClient::UpdatePipelineCallable(UpdatePipelineRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::UpdatePipeline, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::UpdatePipelineAsync(UpdatePipelineRequest&& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::UpdatePipelineAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::UpdatePipelineAsyncHelper(const UpdatePipelineRequest& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdatePipeline(request), context);
@@ -602,7 +752,7 @@ UpdatePipelineNotificationsOutcome ElasticTranscoderClient::UpdatePipelineNotifi
 
 UpdatePipelineNotificationsOutcomeCallable ElasticTranscoderClient::UpdatePipelineNotificationsCallable(const UpdatePipelineNotificationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdatePipelineNotifications(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdatePipelineNotifications(request); } );
 }
 
 void ElasticTranscoderClient::UpdatePipelineNotificationsAsync(const UpdatePipelineNotificationsRequest& request, const UpdatePipelineNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -610,6 +760,16 @@ void ElasticTranscoderClient::UpdatePipelineNotificationsAsync(const UpdatePipel
   m_executor->Submit( [this, request, handler, context](){ this->UpdatePipelineNotificationsAsyncHelper( request, handler, context ); } );
 }
 
+UpdatePipelineNotificationsOutcomeCallable ElasticTranscoderClient::UpdatePipelineNotificationsCallable(UpdatePipelineNotificationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::UpdatePipelineNotifications, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::UpdatePipelineNotificationsAsync(UpdatePipelineNotificationsRequest&& request, const UpdatePipelineNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::UpdatePipelineNotificationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::UpdatePipelineNotificationsAsyncHelper(const UpdatePipelineNotificationsRequest& request, const UpdatePipelineNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdatePipelineNotifications(request), context);
@@ -635,7 +795,7 @@ UpdatePipelineStatusOutcome ElasticTranscoderClient::UpdatePipelineStatus(const
 
 UpdatePipelineStatusOutcomeCallable ElasticTranscoderClient::UpdatePipelineStatusCallable(const UpdatePipelineStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdatePipelineStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdatePipelineStatus(request); } );
 }
 
 void ElasticTranscoderClient::UpdatePipelineStatusAsync(const UpdatePipelineStatusRequest& request, const UpdatePipelineStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -643,8 +803,173 @@ void ElasticTranscoderClient::UpdatePipelineStatusAsync(const UpdatePipelineStat
   m_executor->Submit( [this, request, handler, context](){ this->UpdatePipelineStatusAsyncHelper( request, handler, context ); } );
 }
 
+UpdatePipelineStatusOutcomeCallable ElasticTranscoderClient::UpdatePipelineStatusCallable(UpdatePipelineStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticTranscoderClient::UpdatePipelineStatus, this, std::move(request)));
+}
+
+void ElasticTranscoderClient::UpdatePipelineStatusAsync(UpdatePipelineStatusRequest&& request, const UpdatePipelineStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticTranscoderClient::UpdatePipelineStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticTranscoderClient::UpdatePipelineStatusAsyncHelper(const UpdatePipelineStatusRequest& request, const UpdatePipelineStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdatePipelineStatus(request), context);
 }
 
+Paginator<ElasticTranscoderClient, ListJobsByPipelineRequest, ListJobsByPipelineOutcome> ElasticTranscoderClient::ListJobsByPipelinePaginator(const ListJobsByPipelineRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElasticTranscoderClient, ListJobsByPipelineRequest, ListJobsByPipelineOutcome>(this, &ElasticTranscoderClient::ListJobsByPipeline, request,
+    [](const ListJobsByPipelineRequest& current, const ListJobsByPipelineOutcome& outcome, ListJobsByPipelineRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElasticTranscoderClient, ListJobsByStatusRequest, ListJobsByStatusOutcome> ElasticTranscoderClient::ListJobsByStatusPaginator(const ListJobsByStatusRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElasticTranscoderClient, ListJobsByStatusRequest, ListJobsByStatusOutcome>(this, &ElasticTranscoderClient::ListJobsByStatus, request,
+    [](const ListJobsByStatusRequest& current, const ListJobsByStatusOutcome& outcome, ListJobsByStatusRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElasticTranscoderClient, ListPipelinesRequest, ListPipelinesOutcome> ElasticTranscoderClient::ListPipelinesPaginator(const ListPipelinesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElasticTranscoderClient, ListPipelinesRequest, ListPipelinesOutcome>(this, &ElasticTranscoderClient::ListPipelines, request,
+    [](const ListPipelinesRequest& current, const ListPipelinesOutcome& outcome, ListPipelinesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ElasticTranscoderClient, ListPresetsRequest, ListPresetsOutcome> ElasticTranscoderClient::ListPresetsPaginator(const ListPresetsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ElasticTranscoderClient, ListPresetsRequest, ListPresetsOutcome>(this, &ElasticTranscoderClient::ListPresets, request,
+    [](const ListPresetsRequest& current, const ListPresetsOutcome& outcome, ListPresetsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<ElasticTranscoderClient, CancelJobRequest, CancelJobOutcome> ElasticTranscoderClient::CancelJobAwaitable(CancelJobRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::CancelJob, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, CreateJobRequest, CreateJobOutcome> ElasticTranscoderClient::CreateJobAwaitable(CreateJobRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::CreateJob, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, CreatePipelineRequest, CreatePipelineOutcome> ElasticTranscoderClient::CreatePipelineAwaitable(CreatePipelineRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::CreatePipeline, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, CreatePresetRequest, CreatePresetOutcome> ElasticTranscoderClient::CreatePresetAwaitable(CreatePresetRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::CreatePreset, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, DeletePipelineRequest, DeletePipelineOutcome> ElasticTranscoderClient::DeletePipelineAwaitable(DeletePipelineRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::DeletePipeline, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, DeletePresetRequest, DeletePresetOutcome> ElasticTranscoderClient::DeletePresetAwaitable(DeletePresetRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::DeletePreset, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, ListJobsByPipelineRequest, ListJobsByPipelineOutcome> ElasticTranscoderClient::ListJobsByPipelineAwaitable(ListJobsByPipelineRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::ListJobsByPipeline, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, ListJobsByStatusRequest, ListJobsByStatusOutcome> ElasticTranscoderClient::ListJobsByStatusAwaitable(ListJobsByStatusRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::ListJobsByStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, ListPipelinesRequest, ListPipelinesOutcome> ElasticTranscoderClient::ListPipelinesAwaitable(ListPipelinesRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::ListPipelines, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, ListPresetsRequest, ListPresetsOutcome> ElasticTranscoderClient::ListPresetsAwaitable(ListPresetsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::ListPresets, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, ReadJobRequest, ReadJobOutcome> ElasticTranscoderClient::ReadJobAwaitable(ReadJobRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::ReadJob, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, ReadPipelineRequest, ReadPipelineOutcome> ElasticTranscoderClient::ReadPipelineAwaitable(ReadPipelineRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::ReadPipeline, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, ReadPresetRequest, ReadPresetOutcome> ElasticTranscoderClient::ReadPresetAwaitable(ReadPresetRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::ReadPreset, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, TestRoleRequest, TestRoleOutcome> ElasticTranscoderClient::TestRoleAwaitable(TestRoleRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::TestRole, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, UpdatePipelineRequest, UpdatePipelineOutcome> ElasticTranscoderClient::UpdatePipelineAwaitable(UpdatePipelineRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::UpdatePipeline, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, UpdatePipelineNotificationsRequest, UpdatePipelineNotificationsOutcome> ElasticTranscoderClient::UpdatePipelineNotificationsAwaitable(UpdatePipelineNotificationsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::UpdatePipelineNotifications, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticTranscoderClient, UpdatePipelineStatusRequest, UpdatePipelineStatusOutcome> ElasticTranscoderClient::UpdatePipelineStatusAwaitable(UpdatePipelineStatusRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticTranscoderClient::UpdatePipelineStatus, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -62,6 +62,9 @@
 #include <aws/email/model/VerifyEmailIdentityResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -354,6 +357,18 @@ namespace Model
          */
         virtual void CloneReceiptRuleSetAsync(const Model::CloneReceiptRuleSetRequest& request, const CloneReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CloneReceiptRuleSetCallable(const Model::CloneReceiptRuleSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CloneReceiptRuleSetOutcomeCallable CloneReceiptRuleSetCallable(Model::CloneReceiptRuleSetRequest&& request) const;
+
+        /**
+         * Same as CloneReceiptRuleSetAsync(const Model::CloneReceiptRuleSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CloneReceiptRuleSetAsync(Model::CloneReceiptRuleSetRequest&& request, const CloneReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new IP address filter.</p> <p>For information about setting up IP
          * address filters, see the <a
@@ -385,6 +400,18 @@ namespace Model
          */
         virtual void CreateReceiptFilterAsync(const Model::CreateReceiptFilterRequest& request, const CreateReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateReceiptFilterCallable(const Model::CreateReceiptFilterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateReceiptFilterOutcomeCallable CreateReceiptFilterCallable(Model::CreateReceiptFilterRequest&& request) const;
+
+        /**
+         * Same as CreateReceiptFilterAsync(const Model::CreateReceiptFilterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateReceiptFilterAsync(Model::CreateReceiptFilterRequest&& request, const CreateReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a receipt rule.</p> <p>For information about setting up receipt
          * rules, see the <a
@@ -416,6 +443,18 @@ namespace Model
          */
         virtual void CreateReceiptRuleAsync(const Model::CreateReceiptRuleRequest& request, const CreateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateReceiptRuleCallable(const Model::CreateReceiptRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateReceiptRuleOutcomeCallable CreateReceiptRuleCallable(Model::CreateReceiptRuleRequest&& request) const;
+
+        /**
+         * Same as CreateReceiptRuleAsync(const Model::CreateReceiptRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateReceiptRuleAsync(Model::CreateReceiptRuleRequest&& request, const CreateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an empty receipt rule set.</p> <p>For information about setting up
          * receipt rule sets, see the <a
@@ -447,6 +486,18 @@ namespace Model
          */
         virtual void CreateReceiptRuleSetAsync(const Model::CreateReceiptRuleSetRequest& request, const CreateReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateReceiptRuleSetCallable(const Model::CreateReceiptRuleSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateReceiptRuleSetOutcomeCallable CreateReceiptRuleSetCallable(Model::CreateReceiptRuleSetRequest&& request) const;
+
+        /**
+         * Same as CreateReceiptRuleSetAsync(const Model::CreateReceiptRuleSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateReceiptRuleSetAsync(Model::CreateReceiptRuleSetRequest&& request, const CreateReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified identity (an email address or a domain) from the list
          * of verified identities.</p> <p>This action is throttled at one request per
@@ -472,6 +523,18 @@ namespace Model
          */
         virtual void DeleteIdentityAsync(const Model::DeleteIdentityRequest& request, const DeleteIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIdentityCallable(const Model::DeleteIdentityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteIdentityOutcomeCallable DeleteIdentityCallable(Model::DeleteIdentityRequest&& request) const;
+
+        /**
+         * Same as DeleteIdentityAsync(const Model::DeleteIdentityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteIdentityAsync(Model::DeleteIdentityRequest&& request, const DeleteIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified sending authorization policy for the given identity (an
          * email address or a domain). This API returns successfully even if a policy with
@@ -518,6 +581,18 @@ namespace Model
          */
         virtual void DeleteIdentityPolicyAsync(const Model::DeleteIdentityPolicyRequest& request, const DeleteIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIdentityPolicyCallable(const Model::DeleteIdentityPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteIdentityPolicyOutcomeCallable DeleteIdentityPolicyCallable(Model::DeleteIdentityPolicyRequest&& request) const;
+
+        /**
+         * Same as DeleteIdentityPolicyAsync(const Model::DeleteIdentityPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteIdentityPolicyAsync(Model::DeleteIdentityPolicyRequest&& request, const DeleteIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified IP address filter.</p> <p>For information about
          * managing IP address filters, see the <a
@@ -549,6 +624,18 @@ namespace Model
          */
         virtual void DeleteReceiptFilterAsync(const Model::DeleteReceiptFilterRequest& request, const DeleteReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteReceiptFilterCallable(const Model::DeleteReceiptFilterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteReceiptFilterOutcomeCallable DeleteReceiptFilterCallable(Model::DeleteReceiptFilterRequest&& request) const;
+
+        /**
+         * Same as DeleteReceiptFilterAsync(const Model::DeleteReceiptFilterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteReceiptFilterAsync(Model::DeleteReceiptFilterRequest&& request, const DeleteReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified receipt rule.</p> <p>For information about managing
          * receipt rules, see the <a
@@ -580,6 +667,18 @@ namespace Model
          */
         virtual void DeleteReceiptRuleAsync(const Model::DeleteReceiptRuleRequest& request, const DeleteReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteReceiptRuleCallable(const Model::DeleteReceiptRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteReceiptRuleOutcomeCallable DeleteReceiptRuleCallable(Model::DeleteReceiptRuleRequest&& request) const;
+
+        /**
+         * Same as DeleteReceiptRuleAsync(const Model::DeleteReceiptRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteReceiptRuleAsync(Model::DeleteReceiptRuleRequest&& request, const DeleteReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified receipt rule set and all of the receipt rules it
          * contains.</p> <note> <p>The currently active rule set cannot be deleted.</p>
@@ -614,6 +713,18 @@ namespace Model
          */
         virtual void DeleteReceiptRuleSetAsync(const Model::DeleteReceiptRuleSetRequest& request, const DeleteReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteReceiptRuleSetCallable(const Model::DeleteReceiptRuleSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteReceiptRuleSetOutcomeCallable DeleteReceiptRuleSetCallable(Model::DeleteReceiptRuleSetRequest&& request) const;
+
+        /**
+         * Same as DeleteReceiptRuleSetAsync(const Model::DeleteReceiptRuleSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteReceiptRuleSetAsync(Model::DeleteReceiptRuleSetRequest&& request, const DeleteReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified email address from the list of verified addresses.</p>
          * <important> <p>The DeleteVerifiedEmailAddress action is deprecated as of the May
@@ -645,6 +756,18 @@ namespace Model
          */
         virtual void DeleteVerifiedEmailAddressAsync(const Model::DeleteVerifiedEmailAddressRequest& request, const DeleteVerifiedEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVerifiedEmailAddressCallable(const Model::DeleteVerifiedEmailAddressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteVerifiedEmailAddressOutcomeCallable DeleteVerifiedEmailAddressCallable(Model::DeleteVerifiedEmailAddressRequest&& request) const;
+
+        /**
+         * Same as DeleteVerifiedEmailAddressAsync(const Model::DeleteVerifiedEmailAddressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteVerifiedEmailAddressAsync(Model::DeleteVerifiedEmailAddressRequest&& request, const DeleteVerifiedEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the metadata and receipt rules for the receipt rule set that is
          * currently active.</p> <p>For information about setting up receipt rule sets, see
@@ -679,6 +802,18 @@ namespace Model
          */
         virtual void DescribeActiveReceiptRuleSetAsync(const Model::DescribeActiveReceiptRuleSetRequest& request, const DescribeActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeActiveReceiptRuleSetCallable(const Model::DescribeActiveReceiptRuleSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeActiveReceiptRuleSetOutcomeCallable DescribeActiveReceiptRuleSetCallable(Model::DescribeActiveReceiptRuleSetRequest&& request) const;
+
+        /**
+         * Same as DescribeActiveReceiptRuleSetAsync(const Model::DescribeActiveReceiptRuleSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeActiveReceiptRuleSetAsync(Model::DescribeActiveReceiptRuleSetRequest&& request, const DescribeActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the details of the specified receipt rule.</p> <p>For information
          * about setting up receipt rules, see the <a
@@ -710,6 +845,18 @@ namespace Model
          */
         virtual void DescribeReceiptRuleAsync(const Model::DescribeReceiptRuleRequest& request, const DescribeReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReceiptRuleCallable(const Model::DescribeReceiptRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReceiptRuleOutcomeCallable DescribeReceiptRuleCallable(Model::DescribeReceiptRuleRequest&& request) const;
+
+        /**
+         * Same as DescribeReceiptRuleAsync(const Model::DescribeReceiptRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReceiptRuleAsync(Model::DescribeReceiptRuleRequest&& request, const DescribeReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the details of the specified receipt rule set.</p> <p>For information
          * about managing receipt rule sets, see the <a
@@ -741,6 +888,18 @@ namespace Model
          */
         virtual void DescribeReceiptRuleSetAsync(const Model::DescribeReceiptRuleSetRequest& request, const DescribeReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReceiptRuleSetCallable(const Model::DescribeReceiptRuleSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReceiptRuleSetOutcomeCallable DescribeReceiptRuleSetCallable(Model::DescribeReceiptRuleSetRequest&& request) const;
+
+        /**
+         * Same as DescribeReceiptRuleSetAsync(const Model::DescribeReceiptRuleSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReceiptRuleSetAsync(Model::DescribeReceiptRuleSetRequest&& request, const DescribeReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the current status of Easy DKIM signing for an entity. For domain
          * name identities, this action also returns the DKIM tokens that are required for
@@ -802,6 +961,18 @@ namespace Model
          */
         virtual void GetIdentityDkimAttributesAsync(const Model::GetIdentityDkimAttributesRequest& request, const GetIdentityDkimAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIdentityDkimAttributesCallable(const Model::GetIdentityDkimAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetIdentityDkimAttributesOutcomeCallable GetIdentityDkimAttributesCallable(Model::GetIdentityDkimAttributesRequest&& request) const;
+
+        /**
+         * Same as GetIdentityDkimAttributesAsync(const Model::GetIdentityDkimAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetIdentityDkimAttributesAsync(Model::GetIdentityDkimAttributesRequest&& request, const GetIdentityDkimAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the custom MAIL FROM attributes for a list of identities (email
          * addresses and/or domains).</p> <p>This action is throttled at one request per
@@ -830,6 +1001,18 @@ namespace Model
          */
         virtual void GetIdentityMailFromDomainAttributesAsync(const Model::GetIdentityMailFromDomainAttributesRequest& request, const GetIdentityMailFromDomainAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIdentityMailFromDomainAttributesCallable(const Model::GetIdentityMailFromDomainAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetIdentityMailFromDomainAttributesOutcomeCallable GetIdentityMailFromDomainAttributesCallable(Model::GetIdentityMailFromDomainAttributesRequest&& request) const;
+
+        /**
+         * Same as GetIdentityMailFromDomainAttributesAsync(const Model::GetIdentityMailFromDomainAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetIdentityMailFromDomainAttributesAsync(Model::GetIdentityMailFromDomainAttributesRequest&& request, const GetIdentityMailFromDomainAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Given a list of verified identities (email addresses and/or domains), returns
          * a structure describing identity notification attributes.</p> <p>This action is
@@ -867,6 +1050,18 @@ namespace Model
          */
         virtual void GetIdentityNotificationAttributesAsync(const Model::GetIdentityNotificationAttributesRequest& request, const GetIdentityNotificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIdentityNotificationAttributesCallable(const Model::GetIdentityNotificationAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetIdentityNotificationAttributesOutcomeCallable GetIdentityNotificationAttributesCallable(Model::GetIdentityNotificationAttributesRequest&& request) const;
+
+        /**
+         * Same as GetIdentityNotificationAttributesAsync(const Model::GetIdentityNotificationAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetIdentityNotificationAttributesAsync(Model::GetIdentityNotificationAttributesRequest&& request, const GetIdentityNotificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the requested sending authorization policies for the given identity
          * (an email address or a domain). The policies are returned as a map of policy
@@ -916,6 +1111,18 @@ namespace Model
          */
         virtual void GetIdentityPoliciesAsync(const Model::GetIdentityPoliciesRequest& request, const GetIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIdentityPoliciesCallable(const Model::GetIdentityPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetIdentityPoliciesOutcomeCallable GetIdentityPoliciesCallable(Model::GetIdentityPoliciesRequest&& request) const;
+
+        /**
+         * Same as GetIdentityPoliciesAsync(const Model::GetIdentityPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetIdentityPoliciesAsync(Model::GetIdentityPoliciesRequest&& request, const GetIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Given a list of identities (email addresses and/or domains), returns the
          * verification status and (for domain identities) the verification token for each
@@ -944,6 +1151,18 @@ namespace Model
          */
         virtual void GetIdentityVerificationAttributesAsync(const Model::GetIdentityVerificationAttributesRequest& request, const GetIdentityVerificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIdentityVerificationAttributesCallable(const Model::GetIdentityVerificationAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetIdentityVerificationAttributesOutcomeCallable GetIdentityVerificationAttributesCallable(Model::GetIdentityVerificationAttributesRequest&& request) const;
+
+        /**
+         * Same as GetIdentityVerificationAttributesAsync(const Model::GetIdentityVerificationAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetIdentityVerificationAttributesAsync(Model::GetIdentityVerificationAttributesRequest&& request, const GetIdentityVerificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the user's current sending limits.</p> <p>This action is throttled at
          * one request per second.</p>
@@ -966,6 +1185,18 @@ namespace Model
          */
         virtual void GetSendQuotaAsync(const Model::GetSendQuotaRequest& request, const GetSendQuotaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSendQuotaCallable(const Model::GetSendQuotaRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetSendQuotaOutcomeCallable GetSendQuotaCallable(Model::GetSendQuotaRequest&& request) const;
+
+        /**
+         * Same as GetSendQuotaAsync(const Model::GetSendQuotaRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetSendQuotaAsync(Model::GetSendQuotaRequest&& request, const GetSendQuotaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the user's sending statistics. The result is a list of data points,
          * representing the last two weeks of sending activity.</p> <p>Each data point in
@@ -994,6 +1225,18 @@ namespace Model
          */
         virtual void GetSendStatisticsAsync(const Model::GetSendStatisticsRequest& request, const GetSendStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSendStatisticsCallable(const Model::GetSendStatisticsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetSendStatisticsOutcomeCallable GetSendStatisticsCallable(Model::GetSendStatisticsRequest&& request) const;
+
+        /**
+         * Same as GetSendStatisticsAsync(const Model::GetSendStatisticsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetSendStatisticsAsync(Model::GetSendStatisticsRequest&& request, const GetSendStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list containing all of the identities (email addresses and domains)
          * for your AWS account, regardless of verification status.</p> <p>This action is
@@ -1019,6 +1262,18 @@ namespace Model
          */
         virtual void ListIdentitiesAsync(const Model::ListIdentitiesRequest& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListIdentitiesCallable(const Model::ListIdentitiesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListIdentitiesOutcomeCallable ListIdentitiesCallable(Model::ListIdentitiesRequest&& request) const;
+
+        /**
+         * Same as ListIdentitiesAsync(const Model::ListIdentitiesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListIdentitiesAsync(Model::ListIdentitiesRequest&& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of sending authorization policies that are attached to the
          * given identity (an email address or a domain). This API returns only a list. If
@@ -1068,6 +1323,18 @@ namespace Model
          */
         virtual void ListIdentityPoliciesAsync(const Model::ListIdentityPoliciesRequest& request, const ListIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListIdentityPoliciesCallable(const Model::ListIdentityPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListIdentityPoliciesOutcomeCallable ListIdentityPoliciesCallable(Model::ListIdentityPoliciesRequest&& request) const;
+
+        /**
+         * Same as ListIdentityPoliciesAsync(const Model::ListIdentityPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListIdentityPoliciesAsync(Model::ListIdentityPoliciesRequest&& request, const ListIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the IP address filters associated with your AWS account.</p> <p>For
          * information about managing IP address filters, see the <a
@@ -1099,6 +1366,18 @@ namespace Model
          */
         virtual void ListReceiptFiltersAsync(const Model::ListReceiptFiltersRequest& request, const ListReceiptFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListReceiptFiltersCallable(const Model::ListReceiptFiltersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListReceiptFiltersOutcomeCallable ListReceiptFiltersCallable(Model::ListReceiptFiltersRequest&& request) const;
+
+        /**
+         * Same as ListReceiptFiltersAsync(const Model::ListReceiptFiltersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListReceiptFiltersAsync(Model::ListReceiptFiltersRequest&& request, const ListReceiptFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the receipt rule sets that exist under your AWS account. If there are
          * additional receipt rule sets to be retrieved, you will receive a
@@ -1139,6 +1418,18 @@ namespace Model
          */
         virtual void ListReceiptRuleSetsAsync(const Model::ListReceiptRuleSetsRequest& request, const ListReceiptRuleSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListReceiptRuleSetsCallable(const Model::ListReceiptRuleSetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListReceiptRuleSetsOutcomeCallable ListReceiptRuleSetsCallable(Model::ListReceiptRuleSetsRequest&& request) const;
+
+        /**
+         * Same as ListReceiptRuleSetsAsync(const Model::ListReceiptRuleSetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListReceiptRuleSetsAsync(Model::ListReceiptRuleSetsRequest&& request, const ListReceiptRuleSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list containing all of the email addresses that have been
          * verified.</p> <important> <p>The ListVerifiedEmailAddresses action is deprecated
@@ -1170,6 +1461,18 @@ namespace Model
          */
         virtual void ListVerifiedEmailAddressesAsync(const Model::ListVerifiedEmailAddressesRequest& request, const ListVerifiedEmailAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListVerifiedEmailAddressesCallable(const Model::ListVerifiedEmailAddressesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListVerifiedEmailAddressesOutcomeCallable ListVerifiedEmailAddressesCallable(Model::ListVerifiedEmailAddressesRequest&& request) const;
+
+        /**
+         * Same as ListVerifiedEmailAddressesAsync(const Model::ListVerifiedEmailAddressesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListVerifiedEmailAddressesAsync(Model::ListVerifiedEmailAddressesRequest&& request, const ListVerifiedEmailAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds or updates a sending authorization policy for the specified identity (an
          * email address or a domain).</p> <note> <p>This API is for the identity owner
@@ -1213,6 +1516,18 @@ namespace Model
          */
         virtual void PutIdentityPolicyAsync(const Model::PutIdentityPolicyRequest& request, const PutIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutIdentityPolicyCallable(const Model::PutIdentityPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutIdentityPolicyOutcomeCallable PutIdentityPolicyCallable(Model::PutIdentityPolicyRequest&& request) const;
+
+        /**
+         * Same as PutIdentityPolicyAsync(const Model::PutIdentityPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutIdentityPolicyAsync(Model::PutIdentityPolicyRequest&& request, const PutIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Reorders the receipt rules within a receipt rule set.</p> <note> <p>All of
          * the rules in the rule set must be represented in this request. That is, this API
@@ -1253,6 +1568,18 @@ namespace Model
          */
         virtual void ReorderReceiptRuleSetAsync(const Model::ReorderReceiptRuleSetRequest& request, const ReorderReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReorderReceiptRuleSetCallable(const Model::ReorderReceiptRuleSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReorderReceiptRuleSetOutcomeCallable ReorderReceiptRuleSetCallable(Model::ReorderReceiptRuleSetRequest&& request) const;
+
+        /**
+         * Same as ReorderReceiptRuleSetAsync(const Model::ReorderReceiptRuleSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReorderReceiptRuleSetAsync(Model::ReorderReceiptRuleSetRequest&& request, const ReorderReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates and sends a bounce message to the sender of an email you received
          * through Amazon SES. You can only use this API on an email up to 24 hours after
@@ -1293,6 +1620,18 @@ namespace Model
          */
         virtual void SendBounceAsync(const Model::SendBounceRequest& request, const SendBounceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SendBounceCallable(const Model::SendBounceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SendBounceOutcomeCallable SendBounceCallable(Model::SendBounceRequest&& request) const;
+
+        /**
+         * Same as SendBounceAsync(const Model::SendBounceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SendBounceAsync(Model::SendBounceRequest&& request, const SendBounceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Composes an email message based on input data, and then immediately queues
          * the message for sending.</p> <p>There are several important points to know about
@@ -1369,6 +1708,18 @@ namespace Model
          */
         virtual void SendEmailAsync(const Model::SendEmailRequest& request, const SendEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SendEmailCallable(const Model::SendEmailRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SendEmailOutcomeCallable SendEmailCallable(Model::SendEmailRequest&& request) const;
+
+        /**
+         * Same as SendEmailAsync(const Model::SendEmailRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SendEmailAsync(Model::SendEmailRequest&& request, const SendEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sends an email message, with header and content specified by the client. The
          * <code>SendRawEmail</code> action is useful for sending multipart MIME emails.
@@ -1526,6 +1877,18 @@ namespace Model
          */
         virtual void SendRawEmailAsync(const Model::SendRawEmailRequest& request, const SendRawEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SendRawEmailCallable(const Model::SendRawEmailRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SendRawEmailOutcomeCallable SendRawEmailCallable(Model::SendRawEmailRequest&& request) const;
+
+        /**
+         * Same as SendRawEmailAsync(const Model::SendRawEmailRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SendRawEmailAsync(Model::SendRawEmailRequest&& request, const SendRawEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the specified receipt rule set as the active receipt rule set.</p>
          * <note> <p>To disable your email-receiving through Amazon SES completely, you can
@@ -1563,6 +1926,18 @@ namespace Model
          */
         virtual void SetActiveReceiptRuleSetAsync(const Model::SetActiveReceiptRuleSetRequest& request, const SetActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetActiveReceiptRuleSetCallable(const Model::SetActiveReceiptRuleSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetActiveReceiptRuleSetOutcomeCallable SetActiveReceiptRuleSetCallable(Model::SetActiveReceiptRuleSetRequest&& request) const;
+
+        /**
+         * Same as SetActiveReceiptRuleSetAsync(const Model::SetActiveReceiptRuleSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetActiveReceiptRuleSetAsync(Model::SetActiveReceiptRuleSetRequest&& request, const SetActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables or disables Easy DKIM signing of email sent from an identity:</p>
          * <ul> <li> <p>If Easy DKIM signing is enabled for a domain name identity (e.g.,
@@ -1621,6 +1996,18 @@ namespace Model
          */
         virtual void SetIdentityDkimEnabledAsync(const Model::SetIdentityDkimEnabledRequest& request, const SetIdentityDkimEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetIdentityDkimEnabledCallable(const Model::SetIdentityDkimEnabledRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetIdentityDkimEnabledOutcomeCallable SetIdentityDkimEnabledCallable(Model::SetIdentityDkimEnabledRequest&& request) const;
+
+        /**
+         * Same as SetIdentityDkimEnabledAsync(const Model::SetIdentityDkimEnabledRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetIdentityDkimEnabledAsync(Model::SetIdentityDkimEnabledRequest&& request, const SetIdentityDkimEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Given an identity (an email address or a domain), enables or disables whether
          * Amazon SES forwards bounce and complaint notifications as email. Feedback
@@ -1667,6 +2054,18 @@ namespace Model
          */
         virtual void SetIdentityFeedbackForwardingEnabledAsync(const Model::SetIdentityFeedbackForwardingEnabledRequest& request, const SetIdentityFeedbackForwardingEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetIdentityFeedbackForwardingEnabledCallable(const Model::SetIdentityFeedbackForwardingEnabledRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetIdentityFeedbackForwardingEnabledOutcomeCallable SetIdentityFeedbackForwardingEnabledCallable(Model::SetIdentityFeedbackForwardingEnabledRequest&& request) const;
+
+        /**
+         * Same as SetIdentityFeedbackForwardingEnabledAsync(const Model::SetIdentityFeedbackForwardingEnabledRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetIdentityFeedbackForwardingEnabledAsync(Model::SetIdentityFeedbackForwardingEnabledRequest&& request, const SetIdentityFeedbackForwardingEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Given an identity (an email address or a domain), sets whether Amazon SES
          * includes the original email headers in the Amazon Simple Notification Service
@@ -1704,6 +2103,18 @@ namespace Model
          */
         virtual void SetIdentityHeadersInNotificationsEnabledAsync(const Model::SetIdentityHeadersInNotificationsEnabledRequest& request, const SetIdentityHeadersInNotificationsEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetIdentityHeadersInNotificationsEnabledCallable(const Model::SetIdentityHeadersInNotificationsEnabledRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetIdentityHeadersInNotificationsEnabledOutcomeCallable SetIdentityHeadersInNotificationsEnabledCallable(Model::SetIdentityHeadersInNotificationsEnabledRequest&& request) const;
+
+        /**
+         * Same as SetIdentityHeadersInNotificationsEnabledAsync(const Model::SetIdentityHeadersInNotificationsEnabledRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetIdentityHeadersInNotificationsEnabledAsync(Model::SetIdentityHeadersInNotificationsEnabledRequest&& request, const SetIdentityHeadersInNotificationsEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables or disables the custom MAIL FROM domain setup for a verified identity
          * (an email address or a domain).</p> <important> <p>To send emails using the
@@ -1747,6 +2158,18 @@ namespace Model
          */
         virtual void SetIdentityMailFromDomainAsync(const Model::SetIdentityMailFromDomainRequest& request, const SetIdentityMailFromDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetIdentityMailFromDomainCallable(const Model::SetIdentityMailFromDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetIdentityMailFromDomainOutcomeCallable SetIdentityMailFromDomainCallable(Model::SetIdentityMailFromDomainRequest&& request) const;
+
+        /**
+         * Same as SetIdentityMailFromDomainAsync(const Model::SetIdentityMailFromDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetIdentityMailFromDomainAsync(Model::SetIdentityMailFromDomainRequest&& request, const SetIdentityMailFromDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Given an identity (an email address or a domain), sets the Amazon Simple
          * Notification Service (Amazon SNS) topic to which Amazon SES will publish bounce,
@@ -1793,6 +2216,18 @@ namespace Model
          */
         virtual void SetIdentityNotificationTopicAsync(const Model::SetIdentityNotificationTopicRequest& request, const SetIdentityNotificationTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetIdentityNotificationTopicCallable(const Model::SetIdentityNotificationTopicRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetIdentityNotificationTopicOutcomeCallable SetIdentityNotificationTopicCallable(Model::SetIdentityNotificationTopicRequest&& request) const;
+
+        /**
+         * Same as SetIdentityNotificationTopicAsync(const Model::SetIdentityNotificationTopicRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetIdentityNotificationTopicAsync(Model::SetIdentityNotificationTopicRequest&& request, const SetIdentityNotificationTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the position of the specified receipt rule in the receipt rule set.</p>
          * <p>For information about managing receipt rules, see the <a
@@ -1824,6 +2259,18 @@ namespace Model
          */
         virtual void SetReceiptRulePositionAsync(const Model::SetReceiptRulePositionRequest& request, const SetReceiptRulePositionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetReceiptRulePositionCallable(const Model::SetReceiptRulePositionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetReceiptRulePositionOutcomeCallable SetReceiptRulePositionCallable(Model::SetReceiptRulePositionRequest&& request) const;
+
+        /**
+         * Same as SetReceiptRulePositionAsync(const Model::SetReceiptRulePositionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetReceiptRulePositionAsync(Model::SetReceiptRulePositionRequest&& request, const SetReceiptRulePositionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a receipt rule.</p> <p>For information about managing receipt rules,
          * see the <a
@@ -1855,6 +2302,18 @@ namespace Model
          */
         virtual void UpdateReceiptRuleAsync(const Model::UpdateReceiptRuleRequest& request, const UpdateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateReceiptRuleCallable(const Model::UpdateReceiptRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateReceiptRuleOutcomeCallable UpdateReceiptRuleCallable(Model::UpdateReceiptRuleRequest&& request) const;
+
+        /**
+         * Same as UpdateReceiptRuleAsync(const Model::UpdateReceiptRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateReceiptRuleAsync(Model::UpdateReceiptRuleRequest&& request, const UpdateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a set of DKIM tokens for a domain. DKIM <i>tokens</i> are character
          * strings that represent your domain's identity. Using these tokens, you will need
@@ -1907,6 +2366,18 @@ namespace Model
          */
         virtual void VerifyDomainDkimAsync(const Model::VerifyDomainDkimRequest& request, const VerifyDomainDkimResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as VerifyDomainDkimCallable(const Model::VerifyDomainDkimRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::VerifyDomainDkimOutcomeCallable VerifyDomainDkimCallable(Model::VerifyDomainDkimRequest&& request) const;
+
+        /**
+         * Same as VerifyDomainDkimAsync(const Model::VerifyDomainDkimRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void VerifyDomainDkimAsync(Model::VerifyDomainDkimRequest&& request, const VerifyDomainDkimResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Verifies a domain.</p> <p>This action is throttled at one request per
          * second.</p>
@@ -1929,6 +2400,18 @@ namespace Model
          */
         virtual void VerifyDomainIdentityAsync(const Model::VerifyDomainIdentityRequest& request, const VerifyDomainIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as VerifyDomainIdentityCallable(const Model::VerifyDomainIdentityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::VerifyDomainIdentityOutcomeCallable VerifyDomainIdentityCallable(Model::VerifyDomainIdentityRequest&& request) const;
+
+        /**
+         * Same as VerifyDomainIdentityAsync(const Model::VerifyDomainIdentityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void VerifyDomainIdentityAsync(Model::VerifyDomainIdentityRequest&& request, const VerifyDomainIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Verifies an email address. This action causes a confirmation email message to
          * be sent to the specified address.</p> <important> <p>The VerifyEmailAddress
@@ -1960,6 +2443,18 @@ namespace Model
          */
         virtual void VerifyEmailAddressAsync(const Model::VerifyEmailAddressRequest& request, const VerifyEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as VerifyEmailAddressCallable(const Model::VerifyEmailAddressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::VerifyEmailAddressOutcomeCallable VerifyEmailAddressCallable(Model::VerifyEmailAddressRequest&& request) const;
+
+        /**
+         * Same as VerifyEmailAddressAsync(const Model::VerifyEmailAddressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void VerifyEmailAddressAsync(Model::VerifyEmailAddressRequest&& request, const VerifyEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Verifies an email address. This action causes a confirmation email message to
          * be sent to the specified address.</p> <p>This action is throttled at one request
@@ -1985,6 +2480,240 @@ namespace Model
          */
         virtual void VerifyEmailIdentityAsync(const Model::VerifyEmailIdentityRequest& request, const VerifyEmailIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as VerifyEmailIdentityCallable(const Model::VerifyEmailIdentityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::VerifyEmailIdentityOutcomeCallable VerifyEmailIdentityCallable(Model::VerifyEmailIdentityRequest&& request) const;
+
+        /**
+         * Same as VerifyEmailIdentityAsync(const Model::VerifyEmailIdentityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void VerifyEmailIdentityAsync(Model::VerifyEmailIdentityRequest&& request, const VerifyEmailIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListIdentities(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SESClient, Model::ListIdentitiesRequest, Model::ListIdentitiesOutcome> ListIdentitiesPaginator(const Model::ListIdentitiesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListReceiptRuleSets(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SESClient, Model::ListReceiptRuleSetsRequest, Model::ListReceiptRuleSetsOutcome> ListReceiptRuleSetsPaginator(const Model::ListReceiptRuleSetsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CloneReceiptRuleSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::CloneReceiptRuleSetRequest, Model::CloneReceiptRuleSetOutcome> CloneReceiptRuleSetAwaitable(Model::CloneReceiptRuleSetRequest request) const;
+
+        /**
+         * co_await-able form of CreateReceiptFilter(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::CreateReceiptFilterRequest, Model::CreateReceiptFilterOutcome> CreateReceiptFilterAwaitable(Model::CreateReceiptFilterRequest request) const;
+
+        /**
+         * co_await-able form of CreateReceiptRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::CreateReceiptRuleRequest, Model::CreateReceiptRuleOutcome> CreateReceiptRuleAwaitable(Model::CreateReceiptRuleRequest request) const;
+
+        /**
+         * co_await-able form of CreateReceiptRuleSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::CreateReceiptRuleSetRequest, Model::CreateReceiptRuleSetOutcome> CreateReceiptRuleSetAwaitable(Model::CreateReceiptRuleSetRequest request) const;
+
+        /**
+         * co_await-able form of DeleteIdentity(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::DeleteIdentityRequest, Model::DeleteIdentityOutcome> DeleteIdentityAwaitable(Model::DeleteIdentityRequest request) const;
+
+        /**
+         * co_await-able form of DeleteIdentityPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::DeleteIdentityPolicyRequest, Model::DeleteIdentityPolicyOutcome> DeleteIdentityPolicyAwaitable(Model::DeleteIdentityPolicyRequest request) const;
+
+        /**
+         * co_await-able form of DeleteReceiptFilter(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::DeleteReceiptFilterRequest, Model::DeleteReceiptFilterOutcome> DeleteReceiptFilterAwaitable(Model::DeleteReceiptFilterRequest request) const;
+
+        /**
+         * co_await-able form of DeleteReceiptRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::DeleteReceiptRuleRequest, Model::DeleteReceiptRuleOutcome> DeleteReceiptRuleAwaitable(Model::DeleteReceiptRuleRequest request) const;
+
+        /**
+         * co_await-able form of DeleteReceiptRuleSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::DeleteReceiptRuleSetRequest, Model::DeleteReceiptRuleSetOutcome> DeleteReceiptRuleSetAwaitable(Model::DeleteReceiptRuleSetRequest request) const;
+
+        /**
+         * co_await-able form of DeleteVerifiedEmailAddress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::DeleteVerifiedEmailAddressRequest, Model::DeleteVerifiedEmailAddressOutcome> DeleteVerifiedEmailAddressAwaitable(Model::DeleteVerifiedEmailAddressRequest request) const;
+
+        /**
+         * co_await-able form of DescribeActiveReceiptRuleSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::DescribeActiveReceiptRuleSetRequest, Model::DescribeActiveReceiptRuleSetOutcome> DescribeActiveReceiptRuleSetAwaitable(Model::DescribeActiveReceiptRuleSetRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReceiptRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::DescribeReceiptRuleRequest, Model::DescribeReceiptRuleOutcome> DescribeReceiptRuleAwaitable(Model::DescribeReceiptRuleRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReceiptRuleSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::DescribeReceiptRuleSetRequest, Model::DescribeReceiptRuleSetOutcome> DescribeReceiptRuleSetAwaitable(Model::DescribeReceiptRuleSetRequest request) const;
+
+        /**
+         * co_await-able form of GetIdentityDkimAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::GetIdentityDkimAttributesRequest, Model::GetIdentityDkimAttributesOutcome> GetIdentityDkimAttributesAwaitable(Model::GetIdentityDkimAttributesRequest request) const;
+
+        /**
+         * co_await-able form of GetIdentityMailFromDomainAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::GetIdentityMailFromDomainAttributesRequest, Model::GetIdentityMailFromDomainAttributesOutcome> GetIdentityMailFromDomainAttributesAwaitable(Model::GetIdentityMailFromDomainAttributesRequest request) const;
+
+        /**
+         * co_await-able form of GetIdentityNotificationAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::GetIdentityNotificationAttributesRequest, Model::GetIdentityNotificationAttributesOutcome> GetIdentityNotificationAttributesAwaitable(Model::GetIdentityNotificationAttributesRequest request) const;
+
+        /**
+         * co_await-able form of GetIdentityPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::GetIdentityPoliciesRequest, Model::GetIdentityPoliciesOutcome> GetIdentityPoliciesAwaitable(Model::GetIdentityPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of GetIdentityVerificationAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::GetIdentityVerificationAttributesRequest, Model::GetIdentityVerificationAttributesOutcome> GetIdentityVerificationAttributesAwaitable(Model::GetIdentityVerificationAttributesRequest request) const;
+
+        /**
+         * co_await-able form of GetSendQuota(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::GetSendQuotaRequest, Model::GetSendQuotaOutcome> GetSendQuotaAwaitable(Model::GetSendQuotaRequest request) const;
+
+        /**
+         * co_await-able form of GetSendStatistics(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::GetSendStatisticsRequest, Model::GetSendStatisticsOutcome> GetSendStatisticsAwaitable(Model::GetSendStatisticsRequest request) const;
+
+        /**
+         * co_await-able form of ListIdentities(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::ListIdentitiesRequest, Model::ListIdentitiesOutcome> ListIdentitiesAwaitable(Model::ListIdentitiesRequest request) const;
+
+        /**
+         * co_await-able form of ListIdentityPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::ListIdentityPoliciesRequest, Model::ListIdentityPoliciesOutcome> ListIdentityPoliciesAwaitable(Model::ListIdentityPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of ListReceiptFilters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::ListReceiptFiltersRequest, Model::ListReceiptFiltersOutcome> ListReceiptFiltersAwaitable(Model::ListReceiptFiltersRequest request) const;
+
+        /**
+         * co_await-able form of ListReceiptRuleSets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::ListReceiptRuleSetsRequest, Model::ListReceiptRuleSetsOutcome> ListReceiptRuleSetsAwaitable(Model::ListReceiptRuleSetsRequest request) const;
+
+        /**
+         * co_await-able form of ListVerifiedEmailAddresses(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::ListVerifiedEmailAddressesRequest, Model::ListVerifiedEmailAddressesOutcome> ListVerifiedEmailAddressesAwaitable(Model::ListVerifiedEmailAddressesRequest request) const;
+
+        /**
+         * co_await-able form of PutIdentityPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::PutIdentityPolicyRequest, Model::PutIdentityPolicyOutcome> PutIdentityPolicyAwaitable(Model::PutIdentityPolicyRequest request) const;
+
+        /**
+         * co_await-able form of ReorderReceiptRuleSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::ReorderReceiptRuleSetRequest, Model::ReorderReceiptRuleSetOutcome> ReorderReceiptRuleSetAwaitable(Model::ReorderReceiptRuleSetRequest request) const;
+
+        /**
+         * co_await-able form of SendBounce(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::SendBounceRequest, Model::SendBounceOutcome> SendBounceAwaitable(Model::SendBounceRequest request) const;
+
+        /**
+         * co_await-able form of SendEmail(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::SendEmailRequest, Model::SendEmailOutcome> SendEmailAwaitable(Model::SendEmailRequest request) const;
+
+        /**
+         * co_await-able form of SendRawEmail(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::SendRawEmailRequest, Model::SendRawEmailOutcome> SendRawEmailAwaitable(Model::SendRawEmailRequest request) const;
+
+        /**
+         * co_await-able form of SetActiveReceiptRuleSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::SetActiveReceiptRuleSetRequest, Model::SetActiveReceiptRuleSetOutcome> SetActiveReceiptRuleSetAwaitable(Model::SetActiveReceiptRuleSetRequest request) const;
+
+        /**
+         * co_await-able form of SetIdentityDkimEnabled(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::SetIdentityDkimEnabledRequest, Model::SetIdentityDkimEnabledOutcome> SetIdentityDkimEnabledAwaitable(Model::SetIdentityDkimEnabledRequest request) const;
+
+        /**
+         * co_await-able form of SetIdentityFeedbackForwardingEnabled(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::SetIdentityFeedbackForwardingEnabledRequest, Model::SetIdentityFeedbackForwardingEnabledOutcome> SetIdentityFeedbackForwardingEnabledAwaitable(Model::SetIdentityFeedbackForwardingEnabledRequest request) const;
+
+        /**
+         * co_await-able form of SetIdentityHeadersInNotificationsEnabled(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::SetIdentityHeadersInNotificationsEnabledRequest, Model::SetIdentityHeadersInNotificationsEnabledOutcome> SetIdentityHeadersInNotificationsEnabledAwaitable(Model::SetIdentityHeadersInNotificationsEnabledRequest request) const;
+
+        /**
+         * co_await-able form of SetIdentityMailFromDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::SetIdentityMailFromDomainRequest, Model::SetIdentityMailFromDomainOutcome> SetIdentityMailFromDomainAwaitable(Model::SetIdentityMailFromDomainRequest request) const;
+
+        /**
+         * co_await-able form of SetIdentityNotificationTopic(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::SetIdentityNotificationTopicRequest, Model::SetIdentityNotificationTopicOutcome> SetIdentityNotificationTopicAwaitable(Model::SetIdentityNotificationTopicRequest request) const;
+
+        /**
+         * co_await-able form of SetReceiptRulePosition(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::SetReceiptRulePositionRequest, Model::SetReceiptRulePositionOutcome> SetReceiptRulePositionAwaitable(Model::SetReceiptRulePositionRequest request) const;
+
+        /**
+         * co_await-able form of UpdateReceiptRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::UpdateReceiptRuleRequest, Model::UpdateReceiptRuleOutcome> UpdateReceiptRuleAwaitable(Model::UpdateReceiptRuleRequest request) const;
+
+        /**
+         * co_await-able form of VerifyDomainDkim(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::VerifyDomainDkimRequest, Model::VerifyDomainDkimOutcome> VerifyDomainDkimAwaitable(Model::VerifyDomainDkimRequest request) const;
+
+        /**
+         * co_await-able form of VerifyDomainIdentity(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::VerifyDomainIdentityRequest, Model::VerifyDomainIdentityOutcome> VerifyDomainIdentityAwaitable(Model::VerifyDomainIdentityRequest request) const;
+
+        /**
+         * co_await-able form of VerifyEmailAddress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::VerifyEmailAddressRequest, Model::VerifyEmailAddressOutcome> VerifyEmailAddressAwaitable(Model::VerifyEmailAddressRequest request) const;
+
+        /**
+         * co_await-able form of VerifyEmailIdentity(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SESClient, Model::VerifyEmailIdentityRequest, Model::VerifyEmailIdentityOutcome> VerifyEmailIdentityAwaitable(Model::VerifyEmailIdentityRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     CloneReceiptRuleSetRequest();
+    inline const char* GetServiceRequestName() const override { return "CloneReceiptRuleSet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
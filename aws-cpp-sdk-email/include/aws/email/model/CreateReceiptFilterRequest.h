@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateReceiptFilterRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateReceiptFilter"; }
+
     Aws::String SerializePayload() const override;
 
     /**
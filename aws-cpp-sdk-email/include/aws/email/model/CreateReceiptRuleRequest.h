@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     CreateReceiptRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateReceiptRule"; }
+
     Aws::String SerializePayload() const override;
 
     /**
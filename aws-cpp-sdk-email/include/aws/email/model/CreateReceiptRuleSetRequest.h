@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateReceiptRuleSetRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateReceiptRuleSet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
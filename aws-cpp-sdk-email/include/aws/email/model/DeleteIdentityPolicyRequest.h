@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     DeleteIdentityPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteIdentityPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteIdentityRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteIdentity"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     DeleteReceiptFilterRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteReceiptFilter"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     DeleteReceiptRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteReceiptRule"; }
+
     Aws::String SerializePayload() const override;
 
     /**
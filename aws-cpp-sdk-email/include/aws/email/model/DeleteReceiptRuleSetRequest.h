@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     DeleteReceiptRuleSetRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteReceiptRuleSet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
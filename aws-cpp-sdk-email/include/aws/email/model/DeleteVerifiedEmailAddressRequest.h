@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteVerifiedEmailAddressRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteVerifiedEmailAddress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     DescribeActiveReceiptRuleSetRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeActiveReceiptRuleSet"; }
+
     Aws::String SerializePayload() const override;
 
   };
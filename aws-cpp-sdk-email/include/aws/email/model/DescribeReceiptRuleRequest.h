@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     DescribeReceiptRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReceiptRule"; }
+
     Aws::String SerializePayload() const override;
 
     /**
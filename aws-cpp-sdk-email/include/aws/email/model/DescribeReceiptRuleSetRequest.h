@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     DescribeReceiptRuleSetRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReceiptRuleSet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
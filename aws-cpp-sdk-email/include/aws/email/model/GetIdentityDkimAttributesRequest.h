@@ -38,6 +38,8 @@ namespace Model
   {
   public:
     GetIdentityDkimAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetIdentityDkimAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetIdentityMailFromDomainAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetIdentityMailFromDomainAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
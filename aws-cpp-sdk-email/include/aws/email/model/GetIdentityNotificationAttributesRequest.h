@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetIdentityNotificationAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetIdentityNotificationAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetIdentityPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetIdentityPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     /**
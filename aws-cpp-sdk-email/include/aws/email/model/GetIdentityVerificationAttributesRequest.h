@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetIdentityVerificationAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetIdentityVerificationAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
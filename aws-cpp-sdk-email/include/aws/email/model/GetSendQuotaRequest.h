@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     GetSendQuotaRequest();
+    inline const char* GetServiceRequestName() const override { return "GetSendQuota"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     GetSendStatisticsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetSendStatistics"; }
+
     Aws::String SerializePayload() const override;
 
   };
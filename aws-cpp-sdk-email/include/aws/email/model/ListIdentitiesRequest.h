@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     ListIdentitiesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListIdentities"; }
+
     Aws::String SerializePayload() const override;
 
     /**
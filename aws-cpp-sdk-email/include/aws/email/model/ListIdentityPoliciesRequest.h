@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     ListIdentityPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListIdentityPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     /**
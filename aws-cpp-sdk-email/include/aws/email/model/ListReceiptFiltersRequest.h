@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     ListReceiptFiltersRequest();
+    inline const char* GetServiceRequestName() const override { return "ListReceiptFilters"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListReceiptRuleSetsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListReceiptRuleSets"; }
+
     Aws::String SerializePayload() const override;
 
     /**
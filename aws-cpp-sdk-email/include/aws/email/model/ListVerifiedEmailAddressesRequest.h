@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     ListVerifiedEmailAddressesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListVerifiedEmailAddresses"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     PutIdentityPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "PutIdentityPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
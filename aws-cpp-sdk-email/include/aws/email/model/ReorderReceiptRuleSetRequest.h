@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     ReorderReceiptRuleSetRequest();
+    inline const char* GetServiceRequestName() const override { return "ReorderReceiptRuleSet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
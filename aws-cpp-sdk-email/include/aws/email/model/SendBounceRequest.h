@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     SendBounceRequest();
+    inline const char* GetServiceRequestName() const override { return "SendBounce"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     SendEmailRequest();
+    inline const char* GetServiceRequestName() const override { return "SendEmail"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     SendRawEmailRequest();
+    inline const char* GetServiceRequestName() const override { return "SendRawEmail"; }
+
     Aws::String SerializePayload() const override;
 
     /**
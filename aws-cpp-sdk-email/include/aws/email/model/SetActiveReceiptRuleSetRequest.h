@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     SetActiveReceiptRuleSetRequest();
+    inline const char* GetServiceRequestName() const override { return "SetActiveReceiptRuleSet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
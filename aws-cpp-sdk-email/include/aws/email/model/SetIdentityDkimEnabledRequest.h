@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     SetIdentityDkimEnabledRequest();
+    inline const char* GetServiceRequestName() const override { return "SetIdentityDkimEnabled"; }
+
     Aws::String SerializePayload() const override;
 
     /**
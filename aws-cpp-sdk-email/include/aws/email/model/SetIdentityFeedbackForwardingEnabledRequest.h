@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     SetIdentityFeedbackForwardingEnabledRequest();
+    inline const char* GetServiceRequestName() const override { return "SetIdentityFeedbackForwardingEnabled"; }
+
     Aws::String SerializePayload() const override;
 
     /**
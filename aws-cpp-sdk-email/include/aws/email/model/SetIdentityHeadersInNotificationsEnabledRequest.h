@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     SetIdentityHeadersInNotificationsEnabledRequest();
+    inline const char* GetServiceRequestName() const override { return "SetIdentityHeadersInNotificationsEnabled"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     SetIdentityMailFromDomainRequest();
+    inline const char* GetServiceRequestName() const override { return "SetIdentityMailFromDomain"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     SetIdentityNotificationTopicRequest();
+    inline const char* GetServiceRequestName() const override { return "SetIdentityNotificationTopic"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     SetReceiptRulePositionRequest();
+    inline const char* GetServiceRequestName() const override { return "SetReceiptRulePosition"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     UpdateReceiptRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateReceiptRule"; }
+
     Aws::String SerializePayload() const override;
 
     /**
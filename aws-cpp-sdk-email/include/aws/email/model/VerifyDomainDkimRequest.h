@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     VerifyDomainDkimRequest();
+    inline const char* GetServiceRequestName() const override { return "VerifyDomainDkim"; }
+
     Aws::String SerializePayload() const override;
 
     /**
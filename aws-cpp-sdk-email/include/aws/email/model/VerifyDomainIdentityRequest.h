@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     VerifyDomainIdentityRequest();
+    inline const char* GetServiceRequestName() const override { return "VerifyDomainIdentity"; }
+
     Aws::String SerializePayload() const override;
 
     /**
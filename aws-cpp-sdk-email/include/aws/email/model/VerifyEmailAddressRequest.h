@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     VerifyEmailAddressRequest();
+    inline const char* GetServiceRequestName() const override { return "VerifyEmailAddress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
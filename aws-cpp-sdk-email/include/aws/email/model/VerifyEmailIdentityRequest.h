@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     VerifyEmailIdentityRequest();
+    inline const char* GetServiceRequestName() const override { return "VerifyEmailIdentity"; }
+
     Aws::String SerializePayload() const override;
 
     /**
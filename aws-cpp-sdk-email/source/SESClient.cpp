@@ -151,7 +151,7 @@ CloneReceiptRuleSetOutcome SESClient::CloneReceiptRuleSet(const CloneReceiptRule
 
 CloneReceiptRuleSetOutcomeCallable SESClient::CloneReceiptRuleSetCallable(const CloneReceiptRuleSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CloneReceiptRuleSet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CloneReceiptRuleSet( request ); } );
 }
 
 void SESClient::CloneReceiptRuleSetAsync(const CloneReceiptRuleSetRequest& request, const CloneReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -159,6 +159,16 @@ void SESClient::CloneReceiptRuleSetAsync(const CloneReceiptRuleSetRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->CloneReceiptRuleSetAsyncHelper( request, handler, context ); } );
 }
 
+CloneReceiptRuleSetOutcomeCallable SESClient::CloneReceiptRuleSetCallable(CloneReceiptRuleSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::CloneReceiptRuleSet, this, std::move(request)));
+}
+
+void SESClient::CloneReceiptRuleSetAsync(CloneReceiptRuleSetRequest&& request, const CloneReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::CloneReceiptRuleSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::CloneReceiptRuleSetAsyncHelper(const CloneReceiptRuleSetRequest& request, const CloneReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CloneReceiptRuleSet(request), context);
@@ -181,7 +191,7 @@ CreateReceiptFilterOutcome SESClient::CreateReceiptFilter(const CreateReceiptFil
 
 CreateReceiptFilterOutcomeCallable SESClient::CreateReceiptFilterCallable(const CreateReceiptFilterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateReceiptFilter( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateReceiptFilter( request ); } );
 }
 
 void SESClient::CreateReceiptFilterAsync(const CreateReceiptFilterRequest& request, const CreateReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -189,6 +199,16 @@ void SESClient::CreateReceiptFilterAsync(const CreateReceiptFilterRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->CreateReceiptFilterAsyncHelper( request, handler, context ); } );
 }
 
+CreateReceiptFilterOutcomeCallable SESClient::CreateReceiptFilterCallable(CreateReceiptFilterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::CreateReceiptFilter, this, std::move(request)));
+}
+
+void SESClient::CreateReceiptFilterAsync(CreateReceiptFilterRequest&& request, const CreateReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::CreateReceiptFilterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::CreateReceiptFilterAsyncHelper(const CreateReceiptFilterRequest& request, const CreateReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateReceiptFilter(request), context);
@@ -211,7 +231,7 @@ CreateReceiptRuleOutcome SESClient::CreateReceiptRule(const CreateReceiptRuleReq
 
 CreateReceiptRuleOutcomeCallable SESClient::CreateReceiptRuleCallable(const CreateReceiptRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateReceiptRule( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateReceiptRule( request ); } );
 }
 
 void SESClient::CreateReceiptRuleAsync(const CreateReceiptRuleRequest& request, const CreateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -219,6 +239,16 @@ void SESClient::CreateReceiptRuleAsync(const CreateReceiptRuleRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->CreateReceiptRuleAsyncHelper( request, handler, context ); } );
 }
 
+CreateReceiptRuleOutcomeCallable SESClient::CreateReceiptRuleCallable(CreateReceiptRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::CreateReceiptRule, this, std::move(request)));
+}
+
+void SESClient::CreateReceiptRuleAsync(CreateReceiptRuleRequest&& request, const CreateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::CreateReceiptRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::CreateReceiptRuleAsyncHelper(const CreateReceiptRuleRequest& request, const CreateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateReceiptRule(request), context);
@@ -241,7 +271,7 @@ CreateReceiptRuleSetOutcome SESClient::CreateReceiptRuleSet(const CreateReceiptR
 
 CreateReceiptRuleSetOutcomeCallable SESClient::CreateReceiptRuleSetCallable(const CreateReceiptRuleSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateReceiptRuleSet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateReceiptRuleSet( request ); } );
 }
 
 void SESClient::CreateReceiptRuleSetAsync(const CreateReceiptRuleSetRequest& request, const CreateReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -249,6 +279,16 @@ void SESClient::CreateReceiptRuleSetAsync(const CreateReceiptRuleSetRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->CreateReceiptRuleSetAsyncHelper( request, handler, context ); } );
 }
 
+CreateReceiptRuleSetOutcomeCallable SESClient::CreateReceiptRuleSetCallable(CreateReceiptRuleSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::CreateReceiptRuleSet, this, std::move(request)));
+}
+
+void SESClient::CreateReceiptRuleSetAsync(CreateReceiptRuleSetRequest&& request, const CreateReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::CreateReceiptRuleSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::CreateReceiptRuleSetAsyncHelper(const CreateReceiptRuleSetRequest& request, const CreateReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateReceiptRuleSet(request), context);
@@ -271,7 +311,7 @@ DeleteIdentityOutcome SESClient::DeleteIdentity(const DeleteIdentityRequest& req
 
 DeleteIdentityOutcomeCallable SESClient::DeleteIdentityCallable(const DeleteIdentityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteIdentity( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteIdentity( request ); } );
 }
 
 void SESClient::DeleteIdentityAsync(const DeleteIdentityRequest& request, const DeleteIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -279,6 +319,16 @@ void SESClient::DeleteIdentityAsync(const DeleteIdentityRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DeleteIdentityAsyncHelper( request, handler, context ); } );
 }
 
+DeleteIdentityOutcomeCallable SESClient::DeleteIdentityCallable(DeleteIdentityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::DeleteIdentity, this, std::move(request)));
+}
+
+void SESClient::DeleteIdentityAsync(DeleteIdentityRequest&& request, const DeleteIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::DeleteIdentityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::DeleteIdentityAsyncHelper(const DeleteIdentityRequest& request, const DeleteIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteIdentity(request), context);
@@ -301,7 +351,7 @@ DeleteIdentityPolicyOutcome SESClient::DeleteIdentityPolicy(const DeleteIdentity
 
 DeleteIdentityPolicyOutcomeCallable SESClient::DeleteIdentityPolicyCallable(const DeleteIdentityPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteIdentityPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteIdentityPolicy( request ); } );
 }
 
 void SESClient::DeleteIdentityPolicyAsync(const DeleteIdentityPolicyRequest& request, const DeleteIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -309,6 +359,16 @@ void SESClient::DeleteIdentityPolicyAsync(const DeleteIdentityPolicyRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DeleteIdentityPolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteIdentityPolicyOutcomeCallable SESClient::DeleteIdentityPolicyCallable(DeleteIdentityPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::DeleteIdentityPolicy, this, std::move(request)));
+}
+
+void SESClient::DeleteIdentityPolicyAsync(DeleteIdentityPolicyRequest&& request, const DeleteIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::DeleteIdentityPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::DeleteIdentityPolicyAsyncHelper(const DeleteIdentityPolicyRequest& request, const DeleteIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteIdentityPolicy(request), context);
@@ -331,7 +391,7 @@ DeleteReceiptFilterOutcome SESClient::DeleteReceiptFilter(const DeleteReceiptFil
 
 DeleteReceiptFilterOutcomeCallable SESClient::DeleteReceiptFilterCallable(const DeleteReceiptFilterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteReceiptFilter( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteReceiptFilter( request ); } );
 }
 
 void SESClient::DeleteReceiptFilterAsync(const DeleteReceiptFilterRequest& request, const DeleteReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -339,6 +399,16 @@ void SESClient::DeleteReceiptFilterAsync(const DeleteReceiptFilterRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DeleteReceiptFilterAsyncHelper( request, handler, context ); } );
 }
 
+DeleteReceiptFilterOutcomeCallable SESClient::DeleteReceiptFilterCallable(DeleteReceiptFilterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::DeleteReceiptFilter, this, std::move(request)));
+}
+
+void SESClient::DeleteReceiptFilterAsync(DeleteReceiptFilterRequest&& request, const DeleteReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::DeleteReceiptFilterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::DeleteReceiptFilterAsyncHelper(const DeleteReceiptFilterRequest& request, const DeleteReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteReceiptFilter(request), context);
@@ -361,7 +431,7 @@ DeleteReceiptRuleOutcome SESClient::DeleteReceiptRule(const DeleteReceiptRuleReq
 
 DeleteReceiptRuleOutcomeCallable SESClient::DeleteReceiptRuleCallable(const DeleteReceiptRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteReceiptRule( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteReceiptRule( request ); } );
 }
 
 void SESClient::DeleteReceiptRuleAsync(const DeleteReceiptRuleRequest& request, const DeleteReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -369,6 +439,16 @@ void SESClient::DeleteReceiptRuleAsync(const DeleteReceiptRuleRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DeleteReceiptRuleAsyncHelper( request, handler, context ); } );
 }
 
+DeleteReceiptRuleOutcomeCallable SESClient::DeleteReceiptRuleCallable(DeleteReceiptRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::DeleteReceiptRule, this, std::move(request)));
+}
+
+void SESClient::DeleteReceiptRuleAsync(DeleteReceiptRuleRequest&& request, const DeleteReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::DeleteReceiptRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::DeleteReceiptRuleAsyncHelper(const DeleteReceiptRuleRequest& request, const DeleteReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteReceiptRule(request), context);
@@ -391,7 +471,7 @@ DeleteReceiptRuleSetOutcome SESClient::DeleteReceiptRuleSet(const DeleteReceiptR
 
 DeleteReceiptRuleSetOutcomeCallable SESClient::DeleteReceiptRuleSetCallable(const DeleteReceiptRuleSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteReceiptRuleSet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteReceiptRuleSet( request ); } );
 }
 
 void SESClient::DeleteReceiptRuleSetAsync(const DeleteReceiptRuleSetRequest& request, const DeleteReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -399,6 +479,16 @@ void SESClient::DeleteReceiptRuleSetAsync(const DeleteReceiptRuleSetRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DeleteReceiptRuleSetAsyncHelper( request, handler, context ); } );
 }
 
+DeleteReceiptRuleSetOutcomeCallable SESClient::DeleteReceiptRuleSetCallable(DeleteReceiptRuleSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::DeleteReceiptRuleSet, this, std::move(request)));
+}
+
+void SESClient::DeleteReceiptRuleSetAsync(DeleteReceiptRuleSetRequest&& request, const DeleteReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::DeleteReceiptRuleSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::DeleteReceiptRuleSetAsyncHelper(const DeleteReceiptRuleSetRequest& request, const DeleteReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteReceiptRuleSet(request), context);
@@ -421,7 +511,7 @@ DeleteVerifiedEmailAddressOutcome SESClient::DeleteVerifiedEmailAddress(const De
 
 DeleteVerifiedEmailAddressOutcomeCallable SESClient::DeleteVerifiedEmailAddressCallable(const DeleteVerifiedEmailAddressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteVerifiedEmailAddress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteVerifiedEmailAddress( request ); } );
 }
 
 void SESClient::DeleteVerifiedEmailAddressAsync(const DeleteVerifiedEmailAddressRequest& request, const DeleteVerifiedEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -429,6 +519,16 @@ void SESClient::DeleteVerifiedEmailAddressAsync(const DeleteVerifiedEmailAddress
   m_executor->Submit( [this, request, handler, context](){ this->DeleteVerifiedEmailAddressAsyncHelper( request, handler, context ); } );
 }
 
+DeleteVerifiedEmailAddressOutcomeCallable SESClient::DeleteVerifiedEmailAddressCallable(DeleteVerifiedEmailAddressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::DeleteVerifiedEmailAddress, this, std::move(request)));
+}
+
+void SESClient::DeleteVerifiedEmailAddressAsync(DeleteVerifiedEmailAddressRequest&& request, const DeleteVerifiedEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::DeleteVerifiedEmailAddressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::DeleteVerifiedEmailAddressAsyncHelper(const DeleteVerifiedEmailAddressRequest& request, const DeleteVerifiedEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteVerifiedEmailAddress(request), context);
@@ -451,7 +551,7 @@ DescribeActiveReceiptRuleSetOutcome SESClient::DescribeActiveReceiptRuleSet(cons
 
 DescribeActiveReceiptRuleSetOutcomeCallable SESClient::DescribeActiveReceiptRuleSetCallable(const DescribeActiveReceiptRuleSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeActiveReceiptRuleSet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeActiveReceiptRuleSet( request ); } );
 }
 
 void SESClient::DescribeActiveReceiptRuleSetAsync(const DescribeActiveReceiptRuleSetRequest& request, const DescribeActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -459,6 +559,16 @@ void SESClient::DescribeActiveReceiptRuleSetAsync(const DescribeActiveReceiptRul
   m_executor->Submit( [this, request, handler, context](){ this->DescribeActiveReceiptRuleSetAsyncHelper( request, handler, context ); } );
 }
 
+DescribeActiveReceiptRuleSetOutcomeCallable SESClient::DescribeActiveReceiptRuleSetCallable(DescribeActiveReceiptRuleSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::DescribeActiveReceiptRuleSet, this, std::move(request)));
+}
+
+void SESClient::DescribeActiveReceiptRuleSetAsync(DescribeActiveReceiptRuleSetRequest&& request, const DescribeActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::DescribeActiveReceiptRuleSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::DescribeActiveReceiptRuleSetAsyncHelper(const DescribeActiveReceiptRuleSetRequest& request, const DescribeActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeActiveReceiptRuleSet(request), context);
@@ -481,7 +591,7 @@ DescribeReceiptRuleOutcome SESClient::DescribeReceiptRule(const DescribeReceiptR
 
 DescribeReceiptRuleOutcomeCallable SESClient::DescribeReceiptRuleCallable(const DescribeReceiptRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReceiptRule( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReceiptRule( request ); } );
 }
 
 void SESClient::DescribeReceiptRuleAsync(const DescribeReceiptRuleRequest& request, const DescribeReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -489,6 +599,16 @@ void SESClient::DescribeReceiptRuleAsync(const DescribeReceiptRuleRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReceiptRuleAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReceiptRuleOutcomeCallable SESClient::DescribeReceiptRuleCallable(DescribeReceiptRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::DescribeReceiptRule, this, std::move(request)));
+}
+
+void SESClient::DescribeReceiptRuleAsync(DescribeReceiptRuleRequest&& request, const DescribeReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::DescribeReceiptRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::DescribeReceiptRuleAsyncHelper(const DescribeReceiptRuleRequest& request, const DescribeReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReceiptRule(request), context);
@@ -511,7 +631,7 @@ DescribeReceiptRuleSetOutcome SESClient::DescribeReceiptRuleSet(const DescribeRe
 
 DescribeReceiptRuleSetOutcomeCallable SESClient::DescribeReceiptRuleSetCallable(const DescribeReceiptRuleSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReceiptRuleSet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReceiptRuleSet( request ); } );
 }
 
 void SESClient::DescribeReceiptRuleSetAsync(const DescribeReceiptRuleSetRequest& request, const DescribeReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -519,6 +639,16 @@ void SESClient::DescribeReceiptRuleSetAsync(const DescribeReceiptRuleSetRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReceiptRuleSetAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReceiptRuleSetOutcomeCallable SESClient::DescribeReceiptRuleSetCallable(DescribeReceiptRuleSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::DescribeReceiptRuleSet, this, std::move(request)));
+}
+
+void SESClient::DescribeReceiptRuleSetAsync(DescribeReceiptRuleSetRequest&& request, const DescribeReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::DescribeReceiptRuleSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::DescribeReceiptRuleSetAsyncHelper(const DescribeReceiptRuleSetRequest& request, const DescribeReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReceiptRuleSet(request), context);
@@ -541,7 +671,7 @@ GetIdentityDkimAttributesOutcome SESClient::GetIdentityDkimAttributes(const GetI
 
 GetIdentityDkimAttributesOutcomeCallable SESClient::GetIdentityDkimAttributesCallable(const GetIdentityDkimAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetIdentityDkimAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetIdentityDkimAttributes( request ); } );
 }
 
 void SESClient::GetIdentityDkimAttributesAsync(const GetIdentityDkimAttributesRequest& request, const GetIdentityDkimAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -549,6 +679,16 @@ void SESClient::GetIdentityDkimAttributesAsync(const GetIdentityDkimAttributesRe
   m_executor->Submit( [this, request, handler, context](){ this->GetIdentityDkimAttributesAsyncHelper( request, handler, context ); } );
 }
 
+GetIdentityDkimAttributesOutcomeCallable SESClient::GetIdentityDkimAttributesCallable(GetIdentityDkimAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::GetIdentityDkimAttributes, this, std::move(request)));
+}
+
+void SESClient::GetIdentityDkimAttributesAsync(GetIdentityDkimAttributesRequest&& request, const GetIdentityDkimAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::GetIdentityDkimAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::GetIdentityDkimAttributesAsyncHelper(const GetIdentityDkimAttributesRequest& request, const GetIdentityDkimAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetIdentityDkimAttributes(request), context);
@@ -571,7 +711,7 @@ GetIdentityMailFromDomainAttributesOutcome SESClient::GetIdentityMailFromDomainA
 
 GetIdentityMailFromDomainAttributesOutcomeCallable SESClient::GetIdentityMailFromDomainAttributesCallable(const GetIdentityMailFromDomainAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetIdentityMailFromDomainAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetIdentityMailFromDomainAttributes( request ); } );
 }
 
 void SESClient::GetIdentityMailFromDomainAttributesAsync(const GetIdentityMailFromDomainAttributesRequest& request, const GetIdentityMailFromDomainAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -579,6 +719,16 @@ void SESClient::GetIdentityMailFromDomainAttributesAsync(const GetIdentityMailFr
   m_executor->Submit( [this, request, handler, context](){ this->GetIdentityMailFromDomainAttributesAsyncHelper( request, handler, context ); } );
 }
 
+GetIdentityMailFromDomainAttributesOutcomeCallable SESClient::GetIdentityMailFromDomainAttributesCallable(GetIdentityMailFromDomainAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::GetIdentityMailFromDomainAttributes, this, std::move(request)));
+}
+
+void SESClient::GetIdentityMailFromDomainAttributesAsync(GetIdentityMailFromDomainAttributesRequest&& request, const GetIdentityMailFromDomainAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::GetIdentityMailFromDomainAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::GetIdentityMailFromDomainAttributesAsyncHelper(const GetIdentityMailFromDomainAttributesRequest& request, const GetIdentityMailFromDomainAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetIdentityMailFromDomainAttributes(request), context);
@@ -601,7 +751,7 @@ GetIdentityNotificationAttributesOutcome SESClient::GetIdentityNotificationAttri
 
 GetIdentityNotificationAttributesOutcomeCallable SESClient::GetIdentityNotificationAttributesCallable(const GetIdentityNotificationAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetIdentityNotificationAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetIdentityNotificationAttributes( request ); } );
 }
 
 void SESClient::GetIdentityNotificationAttributesAsync(const GetIdentityNotificationAttributesRequest& request, const GetIdentityNotificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -609,6 +759,16 @@ void SESClient::GetIdentityNotificationAttributesAsync(const GetIdentityNotifica
   m_executor->Submit( [this, request, handler, context](){ this->GetIdentityNotificationAttributesAsyncHelper( request, handler, context ); } );
 }
 
+GetIdentityNotificationAttributesOutcomeCallable SESClient::GetIdentityNotificationAttributesCallable(GetIdentityNotificationAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::GetIdentityNotificationAttributes, this, std::move(request)));
+}
+
+void SESClient::GetIdentityNotificationAttributesAsync(GetIdentityNotificationAttributesRequest&& request, const GetIdentityNotificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::GetIdentityNotificationAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::GetIdentityNotificationAttributesAsyncHelper(const GetIdentityNotificationAttributesRequest& request, const GetIdentityNotificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetIdentityNotificationAttributes(request), context);
@@ -631,7 +791,7 @@ GetIdentityPoliciesOutcome SESClient::GetIdentityPolicies(const GetIdentityPolic
 
 GetIdentityPoliciesOutcomeCallable SESClient::GetIdentityPoliciesCallable(const GetIdentityPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetIdentityPolicies( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetIdentityPolicies( request ); } );
 }
 
 void SESClient::GetIdentityPoliciesAsync(const GetIdentityPoliciesRequest& request, const GetIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -639,6 +799,16 @@ void SESClient::GetIdentityPoliciesAsync(const GetIdentityPoliciesRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->GetIdentityPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+GetIdentityPoliciesOutcomeCallable SESClient::GetIdentityPoliciesCallable(GetIdentityPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::GetIdentityPolicies, this, std::move(request)));
+}
+
+void SESClient::GetIdentityPoliciesAsync(GetIdentityPoliciesRequest&& request, const GetIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::GetIdentityPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::GetIdentityPoliciesAsyncHelper(const GetIdentityPoliciesRequest& request, const GetIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetIdentityPolicies(request), context);
@@ -661,7 +831,7 @@ GetIdentityVerificationAttributesOutcome SESClient::GetIdentityVerificationAttri
 
 GetIdentityVerificationAttributesOutcomeCallable SESClient::GetIdentityVerificationAttributesCallable(const GetIdentityVerificationAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetIdentityVerificationAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetIdentityVerificationAttributes( request ); } );
 }
 
 void SESClient::GetIdentityVerificationAttributesAsync(const GetIdentityVerificationAttributesRequest& request, const GetIdentityVerificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -669,6 +839,16 @@ void SESClient::GetIdentityVerificationAttributesAsync(const GetIdentityVerifica
   m_executor->Submit( [this, request, handler, context](){ this->GetIdentityVerificationAttributesAsyncHelper( request, handler, context ); } );
 }
 
+GetIdentityVerificationAttributesOutcomeCallable SESClient::GetIdentityVerificationAttributesCallable(GetIdentityVerificationAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::GetIdentityVerificationAttributes, this, std::move(request)));
+}
+
+void SESClient::GetIdentityVerificationAttributesAsync(GetIdentityVerificationAttributesRequest&& request, const GetIdentityVerificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::GetIdentityVerificationAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::GetIdentityVerificationAttributesAsyncHelper(const GetIdentityVerificationAttributesRequest& request, const GetIdentityVerificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetIdentityVerificationAttributes(request), context);
@@ -691,7 +871,7 @@ GetSendQuotaOutcome SESClient::GetSendQuota(const GetSendQuotaRequest& request)
 
 GetSendQuotaOutcomeCallable SESClient::GetSendQuotaCallable(const GetSendQuotaRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetSendQuota( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetSendQuota( request ); } );
 }
 
 void SESClient::GetSendQuotaAsync(const GetSendQuotaRequest& request, const GetSendQuotaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -699,6 +879,16 @@ void SESClient::GetSendQuotaAsync(const GetSendQuotaRequest& request, const GetS
   m_executor->Submit( [this, request, handler, context](){ this->GetSendQuotaAsyncHelper( request, handler, context ); } );
 }
 
+GetSendQuotaOutcomeCallable SESClient::GetSendQuotaCallable(GetSendQuotaRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::GetSendQuota, this, std::move(request)));
+}
+
+void SESClient::GetSendQuotaAsync(GetSendQuotaRequest&& request, const GetSendQuotaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::GetSendQuotaAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::GetSendQuotaAsyncHelper(const GetSendQuotaRequest& request, const GetSendQuotaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetSendQuota(request), context);
@@ -721,7 +911,7 @@ GetSendStatisticsOutcome SESClient::GetSendStatistics(const GetSendStatisticsReq
 
 GetSendStatisticsOutcomeCallable SESClient::GetSendStatisticsCallable(const GetSendStatisticsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetSendStatistics( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetSendStatistics( request ); } );
 }
 
 void SESClient::GetSendStatisticsAsync(const GetSendStatisticsRequest& request, const GetSendStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -729,6 +919,16 @@ void SESClient::GetSendStatisticsAsync(const GetSendStatisticsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->GetSendStatisticsAsyncHelper( request, handler, context ); } );
 }
 
+GetSendStatisticsOutcomeCallable SESClient::GetSendStatisticsCallable(GetSendStatisticsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::GetSendStatistics, this, std::move(request)));
+}
+
+void SESClient::GetSendStatisticsAsync(GetSendStatisticsRequest&& request, const GetSendStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::GetSendStatisticsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::GetSendStatisticsAsyncHelper(const GetSendStatisticsRequest& request, const GetSendStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetSendStatistics(request), context);
@@ -751,7 +951,7 @@ ListIdentitiesOutcome SESClient::ListIdentities(const ListIdentitiesRequest& req
 
 ListIdentitiesOutcomeCallable SESClient::ListIdentitiesCallable(const ListIdentitiesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListIdentities( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListIdentities( request ); } );
 }
 
 void SESClient::ListIdentitiesAsync(const ListIdentitiesRequest& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -759,6 +959,16 @@ void SESClient::ListIdentitiesAsync(const ListIdentitiesRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ListIdentitiesAsyncHelper( request, handler, context ); } );
 }
 
+ListIdentitiesOutcomeCallable SESClient::ListIdentitiesCallable(ListIdentitiesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::ListIdentities, this, std::move(request)));
+}
+
+void SESClient::ListIdentitiesAsync(ListIdentitiesRequest&& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::ListIdentitiesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::ListIdentitiesAsyncHelper(const ListIdentitiesRequest& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListIdentities(request), context);
@@ -781,7 +991,7 @@ ListIdentityPoliciesOutcome SESClient::ListIdentityPolicies(const ListIdentityPo
 
 ListIdentityPoliciesOutcomeCallable SESClient::ListIdentityPoliciesCallable(const ListIdentityPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListIdentityPolicies( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListIdentityPolicies( request ); } );
 }
 
 void SESClient::ListIdentityPoliciesAsync(const ListIdentityPoliciesRequest& request, const ListIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -789,6 +999,16 @@ void SESClient::ListIdentityPoliciesAsync(const ListIdentityPoliciesRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->ListIdentityPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+ListIdentityPoliciesOutcomeCallable SESClient::ListIdentityPoliciesCallable(ListIdentityPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::ListIdentityPolicies, this, std::move(request)));
+}
+
+void SESClient::ListIdentityPoliciesAsync(ListIdentityPoliciesRequest&& request, const ListIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::ListIdentityPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::ListIdentityPoliciesAsyncHelper(const ListIdentityPoliciesRequest& request, const ListIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListIdentityPolicies(request), context);
@@ -811,7 +1031,7 @@ ListReceiptFiltersOutcome SESClient::ListReceiptFilters(const ListReceiptFilters
 
 ListReceiptFiltersOutcomeCallable SESClient::ListReceiptFiltersCallable(const ListReceiptFiltersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListReceiptFilters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListReceiptFilters( request ); } );
 }
 
 void SESClient::ListReceiptFiltersAsync(const ListReceiptFiltersRequest& request, const ListReceiptFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -819,6 +1039,16 @@ void SESClient::ListReceiptFiltersAsync(const ListReceiptFiltersRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->ListReceiptFiltersAsyncHelper( request, handler, context ); } );
 }
 
+ListReceiptFiltersOutcomeCallable SESClient::ListReceiptFiltersCallable(ListReceiptFiltersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::ListReceiptFilters, this, std::move(request)));
+}
+
+void SESClient::ListReceiptFiltersAsync(ListReceiptFiltersRequest&& request, const ListReceiptFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::ListReceiptFiltersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::ListReceiptFiltersAsyncHelper(const ListReceiptFiltersRequest& request, const ListReceiptFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListReceiptFilters(request), context);
@@ -841,7 +1071,7 @@ ListReceiptRuleSetsOutcome SESClient::ListReceiptRuleSets(const ListReceiptRuleS
 
 ListReceiptRuleSetsOutcomeCallable SESClient::ListReceiptRuleSetsCallable(const ListReceiptRuleSetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListReceiptRuleSets( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListReceiptRuleSets( request ); } );
 }
 
 void SESClient::ListReceiptRuleSetsAsync(const ListReceiptRuleSetsRequest& request, const ListReceiptRuleSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -849,6 +1079,16 @@ void SESClient::ListReceiptRuleSetsAsync(const ListReceiptRuleSetsRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ListReceiptRuleSetsAsyncHelper( request, handler, context ); } );
 }
 
+ListReceiptRuleSetsOutcomeCallable SESClient::ListReceiptRuleSetsCallable(ListReceiptRuleSetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::ListReceiptRuleSets, this, std::move(request)));
+}
+
+void SESClient::ListReceiptRuleSetsAsync(ListReceiptRuleSetsRequest&& request, const ListReceiptRuleSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::ListReceiptRuleSetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::ListReceiptRuleSetsAsyncHelper(const ListReceiptRuleSetsRequest& request, const ListReceiptRuleSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListReceiptRuleSets(request), context);
@@ -871,7 +1111,7 @@ ListVerifiedEmailAddressesOutcome SESClient::ListVerifiedEmailAddresses(const Li
 
 ListVerifiedEmailAddressesOutcomeCallable SESClient::ListVerifiedEmailAddressesCallable(const ListVerifiedEmailAddressesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListVerifiedEmailAddresses( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListVerifiedEmailAddresses( request ); } );
 }
 
 void SESClient::ListVerifiedEmailAddressesAsync(const ListVerifiedEmailAddressesRequest& request, const ListVerifiedEmailAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -879,6 +1119,16 @@ void SESClient::ListVerifiedEmailAddressesAsync(const ListVerifiedEmailAddresses
   m_executor->Submit( [this, request, handler, context](){ this->ListVerifiedEmailAddressesAsyncHelper( request, handler, context ); } );
 }
 
+ListVerifiedEmailAddressesOutcomeCallable SESClient::ListVerifiedEmailAddressesCallable(ListVerifiedEmailAddressesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::ListVerifiedEmailAddresses, this, std::move(request)));
+}
+
+void SESClient::ListVerifiedEmailAddressesAsync(ListVerifiedEmailAddressesRequest&& request, const ListVerifiedEmailAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::ListVerifiedEmailAddressesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::ListVerifiedEmailAddressesAsyncHelper(const ListVerifiedEmailAddressesRequest& request, const ListVerifiedEmailAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListVerifiedEmailAddresses(request), context);
@@ -901,7 +1151,7 @@ PutIdentityPolicyOutcome SESClient::PutIdentityPolicy(const PutIdentityPolicyReq
 
 PutIdentityPolicyOutcomeCallable SESClient::PutIdentityPolicyCallable(const PutIdentityPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutIdentityPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutIdentityPolicy( request ); } );
 }
 
 void SESClient::PutIdentityPolicyAsync(const PutIdentityPolicyRequest& request, const PutIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -909,6 +1159,16 @@ void SESClient::PutIdentityPolicyAsync(const PutIdentityPolicyRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->PutIdentityPolicyAsyncHelper( request, handler, context ); } );
 }
 
+PutIdentityPolicyOutcomeCallable SESClient::PutIdentityPolicyCallable(PutIdentityPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::PutIdentityPolicy, this, std::move(request)));
+}
+
+void SESClient::PutIdentityPolicyAsync(PutIdentityPolicyRequest&& request, const PutIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::PutIdentityPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::PutIdentityPolicyAsyncHelper(const PutIdentityPolicyRequest& request, const PutIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutIdentityPolicy(request), context);
@@ -931,7 +1191,7 @@ ReorderReceiptRuleSetOutcome SESClient::ReorderReceiptRuleSet(const ReorderRecei
 
 ReorderReceiptRuleSetOutcomeCallable SESClient::ReorderReceiptRuleSetCallable(const ReorderReceiptRuleSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReorderReceiptRuleSet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ReorderReceiptRuleSet( request ); } );
 }
 
 void SESClient::ReorderReceiptRuleSetAsync(const ReorderReceiptRuleSetRequest& request, const ReorderReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -939,6 +1199,16 @@ void SESClient::ReorderReceiptRuleSetAsync(const ReorderReceiptRuleSetRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->ReorderReceiptRuleSetAsyncHelper( request, handler, context ); } );
 }
 
+ReorderReceiptRuleSetOutcomeCallable SESClient::ReorderReceiptRuleSetCallable(ReorderReceiptRuleSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::ReorderReceiptRuleSet, this, std::move(request)));
+}
+
+void SESClient::ReorderReceiptRuleSetAsync(ReorderReceiptRuleSetRequest&& request, const ReorderReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::ReorderReceiptRuleSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::ReorderReceiptRuleSetAsyncHelper(const ReorderReceiptRuleSetRequest& request, const ReorderReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReorderReceiptRuleSet(request), context);
@@ -961,7 +1231,7 @@ SendBounceOutcome SESClient::SendBounce(const SendBounceRequest& request) const
 
 SendBounceOutcomeCallable SESClient::SendBounceCallable(const SendBounceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SendBounce( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SendBounce( request ); } );
 }
 
 void SESClient::SendBounceAsync(const SendBounceRequest& request, const SendBounceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -969,6 +1239,16 @@ void SESClient::SendBounceAsync(const SendBounceRequest& request, const SendBoun
   m_executor->Submit( [this, request, handler, context](){ this->SendBounceAsyncHelper( request, handler, context ); } );
 }
 
+SendBounceOutcomeCallable SESClient::SendBounceCallable(SendBounceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::SendBounce, this, std::move(request)));
+}
+
+void SESClient::SendBounceAsync(SendBounceRequest&& request, const SendBounceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::SendBounceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::SendBounceAsyncHelper(const SendBounceRequest& request, const SendBounceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SendBounce(request), context);
@@ -991,7 +1271,7 @@ SendEmailOutcome SESClient::SendEmail(const SendEmailRequest& request) const
 
 SendEmailOutcomeCallable SESClient::SendEmailCallable(const SendEmailRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SendEmail( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SendEmail( request ); } );
 }
 
 void SESClient::SendEmailAsync(const SendEmailRequest& request, const SendEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -999,6 +1279,16 @@ void SESClient::SendEmailAsync(const SendEmailRequest& request, const SendEmailR
   m_executor->Submit( [this, request, handler, context](){ this->SendEmailAsyncHelper( request, handler, context ); } );
 }
 
+SendEmailOutcomeCallable SESClient::SendEmailCallable(SendEmailRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::SendEmail, this, std::move(request)));
+}
+
+void SESClient::SendEmailAsync(SendEmailRequest&& request, const SendEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::SendEmailAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::SendEmailAsyncHelper(const SendEmailRequest& request, const SendEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SendEmail(request), context);
@@ -1021,7 +1311,7 @@ SendRawEmailOutcome SESClient::SendRawEmail(const SendRawEmailRequest& request)
 
 SendRawEmailOutcomeCallable SESClient::SendRawEmailCallable(const SendRawEmailRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SendRawEmail( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SendRawEmail( request ); } );
 }
 
 void SESClient::SendRawEmailAsync(const SendRawEmailRequest& request, const SendRawEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1029,6 +1319,16 @@ void SESClient::SendRawEmailAsync(const SendRawEmailRequest& request, const Send
   m_executor->Submit( [this, request, handler, context](){ this->SendRawEmailAsyncHelper( request, handler, context ); } );
 }
 
+SendRawEmailOutcomeCallable SESClient::SendRawEmailCallable(SendRawEmailRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::SendRawEmail, this, std::move(request)));
+}
+
+void SESClient::SendRawEmailAsync(SendRawEmailRequest&& request, const SendRawEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::SendRawEmailAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::SendRawEmailAsyncHelper(const SendRawEmailRequest& request, const SendRawEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SendRawEmail(request), context);
@@ -1051,7 +1351,7 @@ SetActiveReceiptRuleSetOutcome SESClient::SetActiveReceiptRuleSet(const SetActiv
 
 SetActiveReceiptRuleSetOutcomeCallable SESClient::SetActiveReceiptRuleSetCallable(const SetActiveReceiptRuleSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetActiveReceiptRuleSet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetActiveReceiptRuleSet( request ); } );
 }
 
 void SESClient::SetActiveReceiptRuleSetAsync(const SetActiveReceiptRuleSetRequest& request, const SetActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1059,6 +1359,16 @@ void SESClient::SetActiveReceiptRuleSetAsync(const SetActiveReceiptRuleSetReques
   m_executor->Submit( [this, request, handler, context](){ this->SetActiveReceiptRuleSetAsyncHelper( request, handler, context ); } );
 }
 
+SetActiveReceiptRuleSetOutcomeCallable SESClient::SetActiveReceiptRuleSetCallable(SetActiveReceiptRuleSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::SetActiveReceiptRuleSet, this, std::move(request)));
+}
+
+void SESClient::SetActiveReceiptRuleSetAsync(SetActiveReceiptRuleSetRequest&& request, const SetActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::SetActiveReceiptRuleSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::SetActiveReceiptRuleSetAsyncHelper(const SetActiveReceiptRuleSetRequest& request, const SetActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetActiveReceiptRuleSet(request), context);
@@ -1081,7 +1391,7 @@ SetIdentityDkimEnabledOutcome SESClient::SetIdentityDkimEnabled(const SetIdentit
 
 SetIdentityDkimEnabledOutcomeCallable SESClient::SetIdentityDkimEnabledCallable(const SetIdentityDkimEnabledRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetIdentityDkimEnabled( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetIdentityDkimEnabled( request ); } );
 }
 
 void SESClient::SetIdentityDkimEnabledAsync(const SetIdentityDkimEnabledRequest& request, const SetIdentityDkimEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1089,6 +1399,16 @@ void SESClient::SetIdentityDkimEnabledAsync(const SetIdentityDkimEnabledRequest&
   m_executor->Submit( [this, request, handler, context](){ this->SetIdentityDkimEnabledAsyncHelper( request, handler, context ); } );
 }
 
+SetIdentityDkimEnabledOutcomeCallable SESClient::SetIdentityDkimEnabledCallable(SetIdentityDkimEnabledRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::SetIdentityDkimEnabled, this, std::move(request)));
+}
+
+void SESClient::SetIdentityDkimEnabledAsync(SetIdentityDkimEnabledRequest&& request, const SetIdentityDkimEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::SetIdentityDkimEnabledAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::SetIdentityDkimEnabledAsyncHelper(const SetIdentityDkimEnabledRequest& request, const SetIdentityDkimEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetIdentityDkimEnabled(request), context);
@@ -1111,7 +1431,7 @@ SetIdentityFeedbackForwardingEnabledOutcome SESClient::SetIdentityFeedbackForwar
 
 SetIdentityFeedbackForwardingEnabledOutcomeCallable SESClient::SetIdentityFeedbackForwardingEnabledCallable(const SetIdentityFeedbackForwardingEnabledRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetIdentityFeedbackForwardingEnabled( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetIdentityFeedbackForwardingEnabled( request ); } );
 }
 
 void SESClient::SetIdentityFeedbackForwardingEnabledAsync(const SetIdentityFeedbackForwardingEnabledRequest& request, const SetIdentityFeedbackForwardingEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1119,6 +1439,16 @@ void SESClient::SetIdentityFeedbackForwardingEnabledAsync(const SetIdentityFeedb
   m_executor->Submit( [this, request, handler, context](){ this->SetIdentityFeedbackForwardingEnabledAsyncHelper( request, handler, context ); } );
 }
 
+SetIdentityFeedbackForwardingEnabledOutcomeCallable SESClient::SetIdentityFeedbackForwardingEnabledCallable(SetIdentityFeedbackForwardingEnabledRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::SetIdentityFeedbackForwardingEnabled, this, std::move(request)));
+}
+
+void SESClient::SetIdentityFeedbackForwardingEnabledAsync(SetIdentityFeedbackForwardingEnabledRequest&& request, const SetIdentityFeedbackForwardingEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::SetIdentityFeedbackForwardingEnabledAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::SetIdentityFeedbackForwardingEnabledAsyncHelper(const SetIdentityFeedbackForwardingEnabledRequest& request, const SetIdentityFeedbackForwardingEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetIdentityFeedbackForwardingEnabled(request), context);
@@ -1141,7 +1471,7 @@ SetIdentityHeadersInNotificationsEnabledOutcome SESClient::SetIdentityHeadersInN
 
 SetIdentityHeadersInNotificationsEnabledOutcomeCallable SESClient::SetIdentityHeadersInNotificationsEnabledCallable(const SetIdentityHeadersInNotificationsEnabledRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetIdentityHeadersInNotificationsEnabled( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetIdentityHeadersInNotificationsEnabled( request ); } );
 }
 
 void SESClient::SetIdentityHeadersInNotificationsEnabledAsync(const SetIdentityHeadersInNotificationsEnabledRequest& request, const SetIdentityHeadersInNotificationsEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1149,6 +1479,16 @@ void SESClient::SetIdentityHeadersInNotificationsEnabledAsync(const SetIdentityH
   m_executor->Submit( [this, request, handler, context](){ this->SetIdentityHeadersInNotificationsEnabledAsyncHelper( request, handler, context ); } );
 }
 
+SetIdentityHeadersInNotificationsEnabledOutcomeCallable SESClient::SetIdentityHeadersInNotificationsEnabledCallable(SetIdentityHeadersInNotificationsEnabledRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::SetIdentityHeadersInNotificationsEnabled, this, std::move(request)));
+}
+
+void SESClient::SetIdentityHeadersInNotificationsEnabledAsync(SetIdentityHeadersInNotificationsEnabledRequest&& request, const SetIdentityHeadersInNotificationsEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::SetIdentityHeadersInNotificationsEnabledAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::SetIdentityHeadersInNotificationsEnabledAsyncHelper(const SetIdentityHeadersInNotificationsEnabledRequest& request, const SetIdentityHeadersInNotificationsEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetIdentityHeadersInNotificationsEnabled(request), context);
@@ -1171,7 +1511,7 @@ SetIdentityMailFromDomainOutcome SESClient::SetIdentityMailFromDomain(const SetI
 
 SetIdentityMailFromDomainOutcomeCallable SESClient::SetIdentityMailFromDomainCallable(const SetIdentityMailFromDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetIdentityMailFromDomain( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetIdentityMailFromDomain( request ); } );
 }
 
 void SESClient::SetIdentityMailFromDomainAsync(const SetIdentityMailFromDomainRequest& request, const SetIdentityMailFromDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1179,6 +1519,16 @@ void SESClient::SetIdentityMailFromDomainAsync(const SetIdentityMailFromDomainRe
   m_executor->Submit( [this, request, handler, context](){ this->SetIdentityMailFromDomainAsyncHelper( request, handler, context ); } );
 }
 
+SetIdentityMailFromDomainOutcomeCallable SESClient::SetIdentityMailFromDomainCallable(SetIdentityMailFromDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::SetIdentityMailFromDomain, this, std::move(request)));
+}
+
+void SESClient::SetIdentityMailFromDomainAsync(SetIdentityMailFromDomainRequest&& request, const SetIdentityMailFromDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::SetIdentityMailFromDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::SetIdentityMailFromDomainAsyncHelper(const SetIdentityMailFromDomainRequest& request, const SetIdentityMailFromDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetIdentityMailFromDomain(request), context);
@@ -1201,7 +1551,7 @@ SetIdentityNotificationTopicOutcome SESClient::SetIdentityNotificationTopic(cons
 
 SetIdentityNotificationTopicOutcomeCallable SESClient::SetIdentityNotificationTopicCallable(const SetIdentityNotificationTopicRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetIdentityNotificationTopic( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetIdentityNotificationTopic( request ); } );
 }
 
 void SESClient::SetIdentityNotificationTopicAsync(const SetIdentityNotificationTopicRequest& request, const SetIdentityNotificationTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1209,6 +1559,16 @@ void SESClient::SetIdentityNotificationTopicAsync(const SetIdentityNotificationT
   m_executor->Submit( [this, request, handler, context](){ this->SetIdentityNotificationTopicAsyncHelper( request, handler, context ); } );
 }
 
+SetIdentityNotificationTopicOutcomeCallable SESClient::SetIdentityNotificationTopicCallable(SetIdentityNotificationTopicRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::SetIdentityNotificationTopic, this, std::move(request)));
+}
+
+void SESClient::SetIdentityNotificationTopicAsync(SetIdentityNotificationTopicRequest&& request, const SetIdentityNotificationTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::SetIdentityNotificationTopicAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::SetIdentityNotificationTopicAsyncHelper(const SetIdentityNotificationTopicRequest& request, const SetIdentityNotificationTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetIdentityNotificationTopic(request), context);
@@ -1231,7 +1591,7 @@ SetReceiptRulePositionOutcome SESClient::SetReceiptRulePosition(const SetReceipt
 
 SetReceiptRulePositionOutcomeCallable SESClient::SetReceiptRulePositionCallable(const SetReceiptRulePositionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetReceiptRulePosition( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetReceiptRulePosition( request ); } );
 }
 
 void SESClient::SetReceiptRulePositionAsync(const SetReceiptRulePositionRequest& request, const SetReceiptRulePositionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1239,6 +1599,16 @@ void SESClient::SetReceiptRulePositionAsync(const SetReceiptRulePositionRequest&
   m_executor->Submit( [this, request, handler, context](){ this->SetReceiptRulePositionAsyncHelper( request, handler, context ); } );
 }
 
+SetReceiptRulePositionOutcomeCallable SESClient::SetReceiptRulePositionCallable(SetReceiptRulePositionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::SetReceiptRulePosition, this, std::move(request)));
+}
+
+void SESClient::SetReceiptRulePositionAsync(SetReceiptRulePositionRequest&& request, const SetReceiptRulePositionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::SetReceiptRulePositionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::SetReceiptRulePositionAsyncHelper(const SetReceiptRulePositionRequest& request, const SetReceiptRulePositionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetReceiptRulePosition(request), context);
@@ -1261,7 +1631,7 @@ UpdateReceiptRuleOutcome SESClient::UpdateReceiptRule(const UpdateReceiptRuleReq
 
 UpdateReceiptRuleOutcomeCallable SESClient::UpdateReceiptRuleCallable(const UpdateReceiptRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateReceiptRule( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateReceiptRule( request ); } );
 }
 
 void SESClient::UpdateReceiptRuleAsync(const UpdateReceiptRuleRequest& request, const UpdateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1269,6 +1639,16 @@ void SESClient::UpdateReceiptRuleAsync(const UpdateReceiptRuleRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->UpdateReceiptRuleAsyncHelper( request, handler, context ); } );
 }
 
+UpdateReceiptRuleOutcomeCallable SESClient::UpdateReceiptRuleCallable(UpdateReceiptRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::UpdateReceiptRule, this, std::move(request)));
+}
+
+void SESClient::UpdateReceiptRuleAsync(UpdateReceiptRuleRequest&& request, const UpdateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::UpdateReceiptRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::UpdateReceiptRuleAsyncHelper(const UpdateReceiptRuleRequest& request, const UpdateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateReceiptRule(request), context);
@@ -1291,7 +1671,7 @@ VerifyDomainDkimOutcome SESClient::VerifyDomainDkim(const VerifyDomainDkimReques
 
 VerifyDomainDkimOutcomeCallable SESClient::VerifyDomainDkimCallable(const VerifyDomainDkimRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->VerifyDomainDkim( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->VerifyDomainDkim( request ); } );
 }
 
 void SESClient::VerifyDomainDkimAsync(const VerifyDomainDkimRequest& request, const VerifyDomainDkimResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1299,6 +1679,16 @@ void SESClient::VerifyDomainDkimAsync(const VerifyDomainDkimRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->VerifyDomainDkimAsyncHelper( request, handler, context ); } );
 }
 
+VerifyDomainDkimOutcomeCallable SESClient::VerifyDomainDkimCallable(VerifyDomainDkimRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::VerifyDomainDkim, this, std::move(request)));
+}
+
+void SESClient::VerifyDomainDkimAsync(VerifyDomainDkimRequest&& request, const VerifyDomainDkimResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::VerifyDomainDkimAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::VerifyDomainDkimAsyncHelper(const VerifyDomainDkimRequest& request, const VerifyDomainDkimResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, VerifyDomainDkim(request), context);
@@ -1321,7 +1711,7 @@ VerifyDomainIdentityOutcome SESClient::VerifyDomainIdentity(const VerifyDomainId
 
 VerifyDomainIdentityOutcomeCallable SESClient::VerifyDomainIdentityCallable(const VerifyDomainIdentityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->VerifyDomainIdentity( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->VerifyDomainIdentity( request ); } );
 }
 
 void SESClient::VerifyDomainIdentityAsync(const VerifyDomainIdentityRequest& request, const VerifyDomainIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1329,6 +1719,16 @@ void SESClient::VerifyDomainIdentityAsync(const VerifyDomainIdentityRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->VerifyDomainIdentityAsyncHelper( request, handler, context ); } );
 }
 
+VerifyDomainIdentityOutcomeCallable SESClient::VerifyDomainIdentityCallable(VerifyDomainIdentityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::VerifyDomainIdentity, this, std::move(request)));
+}
+
+void SESClient::VerifyDomainIdentityAsync(VerifyDomainIdentityRequest&& request, const VerifyDomainIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::VerifyDomainIdentityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::VerifyDomainIdentityAsyncHelper(const VerifyDomainIdentityRequest& request, const VerifyDomainIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, VerifyDomainIdentity(request), context);
@@ -1351,7 +1751,7 @@ VerifyEmailAddressOutcome SESClient::VerifyEmailAddress(const VerifyEmailAddress
 
 VerifyEmailAddressOutcomeCallable SESClient::VerifyEmailAddressCallable(const VerifyEmailAddressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->VerifyEmailAddress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->VerifyEmailAddress( request ); } );
 }
 
 void SESClient::VerifyEmailAddressAsync(const VerifyEmailAddressRequest& request, const VerifyEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1359,6 +1759,16 @@ void SESClient::VerifyEmailAddressAsync(const VerifyEmailAddressRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->VerifyEmailAddressAsyncHelper( request, handler, context ); } );
 }
 
+VerifyEmailAddressOutcomeCallable SESClient::VerifyEmailAddressCallable(VerifyEmailAddressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::VerifyEmailAddress, this, std::move(request)));
+}
+
+void SESClient::VerifyEmailAddressAsync(VerifyEmailAddressRequest&& request, const VerifyEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::VerifyEmailAddressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::VerifyEmailAddressAsyncHelper(const VerifyEmailAddressRequest& request, const VerifyEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, VerifyEmailAddress(request), context);
@@ -1381,7 +1791,7 @@ VerifyEmailIdentityOutcome SESClient::VerifyEmailIdentity(const VerifyEmailIdent
 
 VerifyEmailIdentityOutcomeCallable SESClient::VerifyEmailIdentityCallable(const VerifyEmailIdentityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->VerifyEmailIdentity( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->VerifyEmailIdentity( request ); } );
 }
 
 void SESClient::VerifyEmailIdentityAsync(const VerifyEmailIdentityRequest& request, const VerifyEmailIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1389,8 +1799,264 @@ void SESClient::VerifyEmailIdentityAsync(const VerifyEmailIdentityRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->VerifyEmailIdentityAsyncHelper( request, handler, context ); } );
 }
 
+VerifyEmailIdentityOutcomeCallable SESClient::VerifyEmailIdentityCallable(VerifyEmailIdentityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SESClient::VerifyEmailIdentity, this, std::move(request)));
+}
+
+void SESClient::VerifyEmailIdentityAsync(VerifyEmailIdentityRequest&& request, const VerifyEmailIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SESClient::VerifyEmailIdentityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SESClient::VerifyEmailIdentityAsyncHelper(const VerifyEmailIdentityRequest& request, const VerifyEmailIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, VerifyEmailIdentity(request), context);
 }
 
+Paginator<SESClient, ListIdentitiesRequest, ListIdentitiesOutcome> SESClient::ListIdentitiesPaginator(const ListIdentitiesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SESClient, ListIdentitiesRequest, ListIdentitiesOutcome>(this, &SESClient::ListIdentities, request,
+    [](const ListIdentitiesRequest& current, const ListIdentitiesOutcome& outcome, ListIdentitiesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SESClient, ListReceiptRuleSetsRequest, ListReceiptRuleSetsOutcome> SESClient::ListReceiptRuleSetsPaginator(const ListReceiptRuleSetsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SESClient, ListReceiptRuleSetsRequest, ListReceiptRuleSetsOutcome>(this, &SESClient::ListReceiptRuleSets, request,
+    [](const ListReceiptRuleSetsRequest& current, const ListReceiptRuleSetsOutcome& outcome, ListReceiptRuleSetsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<SESClient, CloneReceiptRuleSetRequest, CloneReceiptRuleSetOutcome> SESClient::CloneReceiptRuleSetAwaitable(CloneReceiptRuleSetRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::CloneReceiptRuleSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, CreateReceiptFilterRequest, CreateReceiptFilterOutcome> SESClient::CreateReceiptFilterAwaitable(CreateReceiptFilterRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::CreateReceiptFilter, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, CreateReceiptRuleRequest, CreateReceiptRuleOutcome> SESClient::CreateReceiptRuleAwaitable(CreateReceiptRuleRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::CreateReceiptRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, CreateReceiptRuleSetRequest, CreateReceiptRuleSetOutcome> SESClient::CreateReceiptRuleSetAwaitable(CreateReceiptRuleSetRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::CreateReceiptRuleSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, DeleteIdentityRequest, DeleteIdentityOutcome> SESClient::DeleteIdentityAwaitable(DeleteIdentityRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::DeleteIdentity, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, DeleteIdentityPolicyRequest, DeleteIdentityPolicyOutcome> SESClient::DeleteIdentityPolicyAwaitable(DeleteIdentityPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::DeleteIdentityPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, DeleteReceiptFilterRequest, DeleteReceiptFilterOutcome> SESClient::DeleteReceiptFilterAwaitable(DeleteReceiptFilterRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::DeleteReceiptFilter, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, DeleteReceiptRuleRequest, DeleteReceiptRuleOutcome> SESClient::DeleteReceiptRuleAwaitable(DeleteReceiptRuleRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::DeleteReceiptRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, DeleteReceiptRuleSetRequest, DeleteReceiptRuleSetOutcome> SESClient::DeleteReceiptRuleSetAwaitable(DeleteReceiptRuleSetRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::DeleteReceiptRuleSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, DeleteVerifiedEmailAddressRequest, DeleteVerifiedEmailAddressOutcome> SESClient::DeleteVerifiedEmailAddressAwaitable(DeleteVerifiedEmailAddressRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::DeleteVerifiedEmailAddress, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, DescribeActiveReceiptRuleSetRequest, DescribeActiveReceiptRuleSetOutcome> SESClient::DescribeActiveReceiptRuleSetAwaitable(DescribeActiveReceiptRuleSetRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::DescribeActiveReceiptRuleSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, DescribeReceiptRuleRequest, DescribeReceiptRuleOutcome> SESClient::DescribeReceiptRuleAwaitable(DescribeReceiptRuleRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::DescribeReceiptRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, DescribeReceiptRuleSetRequest, DescribeReceiptRuleSetOutcome> SESClient::DescribeReceiptRuleSetAwaitable(DescribeReceiptRuleSetRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::DescribeReceiptRuleSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, GetIdentityDkimAttributesRequest, GetIdentityDkimAttributesOutcome> SESClient::GetIdentityDkimAttributesAwaitable(GetIdentityDkimAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::GetIdentityDkimAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, GetIdentityMailFromDomainAttributesRequest, GetIdentityMailFromDomainAttributesOutcome> SESClient::GetIdentityMailFromDomainAttributesAwaitable(GetIdentityMailFromDomainAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::GetIdentityMailFromDomainAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, GetIdentityNotificationAttributesRequest, GetIdentityNotificationAttributesOutcome> SESClient::GetIdentityNotificationAttributesAwaitable(GetIdentityNotificationAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::GetIdentityNotificationAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, GetIdentityPoliciesRequest, GetIdentityPoliciesOutcome> SESClient::GetIdentityPoliciesAwaitable(GetIdentityPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::GetIdentityPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, GetIdentityVerificationAttributesRequest, GetIdentityVerificationAttributesOutcome> SESClient::GetIdentityVerificationAttributesAwaitable(GetIdentityVerificationAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::GetIdentityVerificationAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, GetSendQuotaRequest, GetSendQuotaOutcome> SESClient::GetSendQuotaAwaitable(GetSendQuotaRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::GetSendQuota, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, GetSendStatisticsRequest, GetSendStatisticsOutcome> SESClient::GetSendStatisticsAwaitable(GetSendStatisticsRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::GetSendStatistics, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, ListIdentitiesRequest, ListIdentitiesOutcome> SESClient::ListIdentitiesAwaitable(ListIdentitiesRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::ListIdentities, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, ListIdentityPoliciesRequest, ListIdentityPoliciesOutcome> SESClient::ListIdentityPoliciesAwaitable(ListIdentityPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::ListIdentityPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, ListReceiptFiltersRequest, ListReceiptFiltersOutcome> SESClient::ListReceiptFiltersAwaitable(ListReceiptFiltersRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::ListReceiptFilters, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, ListReceiptRuleSetsRequest, ListReceiptRuleSetsOutcome> SESClient::ListReceiptRuleSetsAwaitable(ListReceiptRuleSetsRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::ListReceiptRuleSets, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, ListVerifiedEmailAddressesRequest, ListVerifiedEmailAddressesOutcome> SESClient::ListVerifiedEmailAddressesAwaitable(ListVerifiedEmailAddressesRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::ListVerifiedEmailAddresses, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, PutIdentityPolicyRequest, PutIdentityPolicyOutcome> SESClient::PutIdentityPolicyAwaitable(PutIdentityPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::PutIdentityPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, ReorderReceiptRuleSetRequest, ReorderReceiptRuleSetOutcome> SESClient::ReorderReceiptRuleSetAwaitable(ReorderReceiptRuleSetRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::ReorderReceiptRuleSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, SendBounceRequest, SendBounceOutcome> SESClient::SendBounceAwaitable(SendBounceRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::SendBounce, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, SendEmailRequest, SendEmailOutcome> SESClient::SendEmailAwaitable(SendEmailRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::SendEmail, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, SendRawEmailRequest, SendRawEmailOutcome> SESClient::SendRawEmailAwaitable(SendRawEmailRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::SendRawEmail, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, SetActiveReceiptRuleSetRequest, SetActiveReceiptRuleSetOutcome> SESClient::SetActiveReceiptRuleSetAwaitable(SetActiveReceiptRuleSetRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::SetActiveReceiptRuleSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, SetIdentityDkimEnabledRequest, SetIdentityDkimEnabledOutcome> SESClient::SetIdentityDkimEnabledAwaitable(SetIdentityDkimEnabledRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::SetIdentityDkimEnabled, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, SetIdentityFeedbackForwardingEnabledRequest, SetIdentityFeedbackForwardingEnabledOutcome> SESClient::SetIdentityFeedbackForwardingEnabledAwaitable(SetIdentityFeedbackForwardingEnabledRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::SetIdentityFeedbackForwardingEnabled, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, SetIdentityHeadersInNotificationsEnabledRequest, SetIdentityHeadersInNotificationsEnabledOutcome> SESClient::SetIdentityHeadersInNotificationsEnabledAwaitable(SetIdentityHeadersInNotificationsEnabledRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::SetIdentityHeadersInNotificationsEnabled, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, SetIdentityMailFromDomainRequest, SetIdentityMailFromDomainOutcome> SESClient::SetIdentityMailFromDomainAwaitable(SetIdentityMailFromDomainRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::SetIdentityMailFromDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, SetIdentityNotificationTopicRequest, SetIdentityNotificationTopicOutcome> SESClient::SetIdentityNotificationTopicAwaitable(SetIdentityNotificationTopicRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::SetIdentityNotificationTopic, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, SetReceiptRulePositionRequest, SetReceiptRulePositionOutcome> SESClient::SetReceiptRulePositionAwaitable(SetReceiptRulePositionRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::SetReceiptRulePosition, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, UpdateReceiptRuleRequest, UpdateReceiptRuleOutcome> SESClient::UpdateReceiptRuleAwaitable(UpdateReceiptRuleRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::UpdateReceiptRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, VerifyDomainDkimRequest, VerifyDomainDkimOutcome> SESClient::VerifyDomainDkimAwaitable(VerifyDomainDkimRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::VerifyDomainDkim, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, VerifyDomainIdentityRequest, VerifyDomainIdentityOutcome> SESClient::VerifyDomainIdentityAwaitable(VerifyDomainIdentityRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::VerifyDomainIdentity, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, VerifyEmailAddressRequest, VerifyEmailAddressOutcome> SESClient::VerifyEmailAddressAwaitable(VerifyEmailAddressRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::VerifyEmailAddress, std::move(request) } };
+}
+
+ClientOperationAwaitable<SESClient, VerifyEmailIdentityRequest, VerifyEmailIdentityOutcome> SESClient::VerifyEmailIdentityAwaitable(VerifyEmailIdentityRequest request) const
+{
+  return { m_executor.get(), { this, &SESClient::VerifyEmailIdentity, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
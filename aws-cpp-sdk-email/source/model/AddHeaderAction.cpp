@@ -51,13 +51,13 @@ AddHeaderAction& AddHeaderAction::operator =(const XmlNode& xmlNode)
     XmlNode headerNameNode = resultNode.FirstChild("HeaderName");
     if(!headerNameNode.IsNull())
     {
-      m_headerName = StringUtils::Trim(headerNameNode.GetText().c_str());
+      m_headerName = headerNameNode.GetTextView().Trim().ToString();
       m_headerNameHasBeenSet = true;
     }
     XmlNode headerValueNode = resultNode.FirstChild("HeaderValue");
     if(!headerValueNode.IsNull())
     {
-      m_headerValue = StringUtils::Trim(headerValueNode.GetText().c_str());
+      m_headerValue = headerValueNode.GetTextView().Trim().ToString();
       m_headerValueHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void AddHeaderAction::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_headerNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HeaderName=" << StringUtils::URLEncode(m_headerName.c_str()) << "&";
+      oStream << location << index << locationValue << ".HeaderName=" << StringUtils::URLEncoded(m_headerName) << "&";
   }
 
   if(m_headerValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HeaderValue=" << StringUtils::URLEncode(m_headerValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".HeaderValue=" << StringUtils::URLEncoded(m_headerValue) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void AddHeaderAction::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_headerNameHasBeenSet)
   {
-      oStream << location << ".HeaderName=" << StringUtils::URLEncode(m_headerName.c_str()) << "&";
+      oStream << location << ".HeaderName=" << StringUtils::URLEncoded(m_headerName) << "&";
   }
   if(m_headerValueHasBeenSet)
   {
-      oStream << location << ".HeaderValue=" << StringUtils::URLEncode(m_headerValue.c_str()) << "&";
+      oStream << location << ".HeaderValue=" << StringUtils::URLEncoded(m_headerValue) << "&";
   }
 }
 
@@ -29,21 +29,29 @@ namespace Aws
       namespace BehaviorOnMXFailureMapper
       {
 
-        static const int UseDefaultValue_HASH = HashingUtils::HashString("UseDefaultValue");
-        static const int RejectMessage_HASH = HashingUtils::HashString("RejectMessage");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int UseDefaultValue_HASH = 1219447479;
+        static const int RejectMessage_HASH = 2069680968;
 
 
         BehaviorOnMXFailure GetBehaviorOnMXFailureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UseDefaultValue_HASH)
+          switch (hashCode)
           {
+          case UseDefaultValue_HASH:
             return BehaviorOnMXFailure::UseDefaultValue;
-          }
-          else if (hashCode == RejectMessage_HASH)
-          {
+          case RejectMessage_HASH:
             return BehaviorOnMXFailure::RejectMessage;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -69,16 +70,16 @@ void Body::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 {
   if(m_textHasBeenSet)
   {
-      Aws::StringStream textLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream textLocationAndMemberSs;
       textLocationAndMemberSs << location << index << locationValue << ".Text";
-      m_text.OutputToStream(oStream, textLocationAndMemberSs.str().c_str());
+      m_text.OutputToStream(oStream, textLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_htmlHasBeenSet)
   {
-      Aws::StringStream htmlLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream htmlLocationAndMemberSs;
       htmlLocationAndMemberSs << location << index << locationValue << ".Html";
-      m_html.OutputToStream(oStream, htmlLocationAndMemberSs.str().c_str());
+      m_html.OutputToStream(oStream, htmlLocationAndMemberSs.GetString().c_str());
   }
 
 }
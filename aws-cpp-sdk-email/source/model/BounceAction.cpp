@@ -57,31 +57,31 @@ BounceAction& BounceAction::operator =(const XmlNode& xmlNode)
     XmlNode topicArnNode = resultNode.FirstChild("TopicArn");
     if(!topicArnNode.IsNull())
     {
-      m_topicArn = StringUtils::Trim(topicArnNode.GetText().c_str());
+      m_topicArn = topicArnNode.GetTextView().Trim().ToString();
       m_topicArnHasBeenSet = true;
     }
     XmlNode smtpReplyCodeNode = resultNode.FirstChild("SmtpReplyCode");
     if(!smtpReplyCodeNode.IsNull())
     {
-      m_smtpReplyCode = StringUtils::Trim(smtpReplyCodeNode.GetText().c_str());
+      m_smtpReplyCode = smtpReplyCodeNode.GetTextView().Trim().ToString();
       m_smtpReplyCodeHasBeenSet = true;
     }
     XmlNode statusCodeNode = resultNode.FirstChild("StatusCode");
     if(!statusCodeNode.IsNull())
     {
-      m_statusCode = StringUtils::Trim(statusCodeNode.GetText().c_str());
+      m_statusCode = statusCodeNode.GetTextView().Trim().ToString();
       m_statusCodeHasBeenSet = true;
     }
     XmlNode messageNode = resultNode.FirstChild("Message");
     if(!messageNode.IsNull())
     {
-      m_message = StringUtils::Trim(messageNode.GetText().c_str());
+      m_message = messageNode.GetTextView().Trim().ToString();
       m_messageHasBeenSet = true;
     }
     XmlNode senderNode = resultNode.FirstChild("Sender");
     if(!senderNode.IsNull())
     {
-      m_sender = StringUtils::Trim(senderNode.GetText().c_str());
+      m_sender = senderNode.GetTextView().Trim().ToString();
       m_senderHasBeenSet = true;
     }
   }
@@ -93,27 +93,27 @@ void BounceAction::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
   if(m_smtpReplyCodeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SmtpReplyCode=" << StringUtils::URLEncode(m_smtpReplyCode.c_str()) << "&";
+      oStream << location << index << locationValue << ".SmtpReplyCode=" << StringUtils::URLEncoded(m_smtpReplyCode) << "&";
   }
 
   if(m_statusCodeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StatusCode=" << StringUtils::URLEncode(m_statusCode.c_str()) << "&";
+      oStream << location << index << locationValue << ".StatusCode=" << StringUtils::URLEncoded(m_statusCode) << "&";
   }
 
   if(m_messageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 
   if(m_senderHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Sender=" << StringUtils::URLEncode(m_sender.c_str()) << "&";
+      oStream << location << index << locationValue << ".Sender=" << StringUtils::URLEncoded(m_sender) << "&";
   }
 
 }
@@ -122,23 +122,23 @@ void BounceAction::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
   if(m_smtpReplyCodeHasBeenSet)
   {
-      oStream << location << ".SmtpReplyCode=" << StringUtils::URLEncode(m_smtpReplyCode.c_str()) << "&";
+      oStream << location << ".SmtpReplyCode=" << StringUtils::URLEncoded(m_smtpReplyCode) << "&";
   }
   if(m_statusCodeHasBeenSet)
   {
-      oStream << location << ".StatusCode=" << StringUtils::URLEncode(m_statusCode.c_str()) << "&";
+      oStream << location << ".StatusCode=" << StringUtils::URLEncoded(m_statusCode) << "&";
   }
   if(m_messageHasBeenSet)
   {
-      oStream << location << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
   if(m_senderHasBeenSet)
   {
-      oStream << location << ".Sender=" << StringUtils::URLEncode(m_sender.c_str()) << "&";
+      oStream << location << ".Sender=" << StringUtils::URLEncoded(m_sender) << "&";
   }
 }
 
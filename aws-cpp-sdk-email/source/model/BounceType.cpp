@@ -29,41 +29,41 @@ namespace Aws
       namespace BounceTypeMapper
       {
 
-        static const int DoesNotExist_HASH = HashingUtils::HashString("DoesNotExist");
-        static const int MessageTooLarge_HASH = HashingUtils::HashString("MessageTooLarge");
-        static const int ExceededQuota_HASH = HashingUtils::HashString("ExceededQuota");
-        static const int ContentRejected_HASH = HashingUtils::HashString("ContentRejected");
-        static const int Undefined_HASH = HashingUtils::HashString("Undefined");
-        static const int TemporaryFailure_HASH = HashingUtils::HashString("TemporaryFailure");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int DoesNotExist_HASH = -159978083;
+        static const int MessageTooLarge_HASH = -1210457266;
+        static const int ExceededQuota_HASH = 2065475269;
+        static const int ContentRejected_HASH = 818142199;
+        static const int Undefined_HASH = 965837104;
+        static const int TemporaryFailure_HASH = 1916666393;
 
 
         BounceType GetBounceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DoesNotExist_HASH)
+          switch (hashCode)
           {
+          case DoesNotExist_HASH:
             return BounceType::DoesNotExist;
-          }
-          else if (hashCode == MessageTooLarge_HASH)
-          {
+          case MessageTooLarge_HASH:
             return BounceType::MessageTooLarge;
-          }
-          else if (hashCode == ExceededQuota_HASH)
-          {
+          case ExceededQuota_HASH:
             return BounceType::ExceededQuota;
-          }
-          else if (hashCode == ContentRejected_HASH)
-          {
+          case ContentRejected_HASH:
             return BounceType::ContentRejected;
-          }
-          else if (hashCode == Undefined_HASH)
-          {
+          case Undefined_HASH:
             return BounceType::Undefined;
-          }
-          else if (hashCode == TemporaryFailure_HASH)
-          {
+          case TemporaryFailure_HASH:
             return BounceType::TemporaryFailure;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -55,19 +56,19 @@ BouncedRecipientInfo& BouncedRecipientInfo::operator =(const XmlNode& xmlNode)
     XmlNode recipientNode = resultNode.FirstChild("Recipient");
     if(!recipientNode.IsNull())
     {
-      m_recipient = StringUtils::Trim(recipientNode.GetText().c_str());
+      m_recipient = recipientNode.GetTextView().Trim().ToString();
       m_recipientHasBeenSet = true;
     }
     XmlNode recipientArnNode = resultNode.FirstChild("RecipientArn");
     if(!recipientArnNode.IsNull())
     {
-      m_recipientArn = StringUtils::Trim(recipientArnNode.GetText().c_str());
+      m_recipientArn = recipientArnNode.GetTextView().Trim().ToString();
       m_recipientArnHasBeenSet = true;
     }
     XmlNode bounceTypeNode = resultNode.FirstChild("BounceType");
     if(!bounceTypeNode.IsNull())
     {
-      m_bounceType = BounceTypeMapper::GetBounceTypeForName(StringUtils::Trim(bounceTypeNode.GetText().c_str()).c_str());
+      m_bounceType = BounceTypeMapper::GetBounceTypeForName(bounceTypeNode.GetTextView().Trim().ToString().c_str());
       m_bounceTypeHasBeenSet = true;
     }
     XmlNode recipientDsnFieldsNode = resultNode.FirstChild("RecipientDsnFields");
@@ -85,12 +86,12 @@ void BouncedRecipientInfo::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_recipientHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Recipient=" << StringUtils::URLEncode(m_recipient.c_str()) << "&";
+      oStream << location << index << locationValue << ".Recipient=" << StringUtils::URLEncoded(m_recipient) << "&";
   }
 
   if(m_recipientArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RecipientArn=" << StringUtils::URLEncode(m_recipientArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".RecipientArn=" << StringUtils::URLEncoded(m_recipientArn) << "&";
   }
 
   if(m_bounceTypeHasBeenSet)
@@ -100,9 +101,9 @@ void BouncedRecipientInfo::OutputToStream(Aws::OStream& oStream, const char* loc
 
   if(m_recipientDsnFieldsHasBeenSet)
   {
-      Aws::StringStream recipientDsnFieldsLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream recipientDsnFieldsLocationAndMemberSs;
       recipientDsnFieldsLocationAndMemberSs << location << index << locationValue << ".RecipientDsnFields";
-      m_recipientDsnFields.OutputToStream(oStream, recipientDsnFieldsLocationAndMemberSs.str().c_str());
+      m_recipientDsnFields.OutputToStream(oStream, recipientDsnFieldsLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -111,11 +112,11 @@ void BouncedRecipientInfo::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_recipientHasBeenSet)
   {
-      oStream << location << ".Recipient=" << StringUtils::URLEncode(m_recipient.c_str()) << "&";
+      oStream << location << ".Recipient=" << StringUtils::URLEncoded(m_recipient) << "&";
   }
   if(m_recipientArnHasBeenSet)
   {
-      oStream << location << ".RecipientArn=" << StringUtils::URLEncode(m_recipientArn.c_str()) << "&";
+      oStream << location << ".RecipientArn=" << StringUtils::URLEncoded(m_recipientArn) << "&";
   }
   if(m_bounceTypeHasBeenSet)
   {
@@ -15,6 +15,7 @@
 #include <aws/email/model/CloneReceiptRuleSetRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ CloneReceiptRuleSetRequest::CloneReceiptRuleSetRequest() :
 
 Aws::String CloneReceiptRuleSetRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CloneReceiptRuleSet&";
   if(m_ruleSetNameHasBeenSet)
   {
-    ss << "RuleSetName=" << StringUtils::URLEncode(m_ruleSetName.c_str()) << "&";
+    ss << "RuleSetName=" << StringUtils::URLEncoded(m_ruleSetName) << "&";
   }
 
   if(m_originalRuleSetNameHasBeenSet)
   {
-    ss << "OriginalRuleSetName=" << StringUtils::URLEncode(m_originalRuleSetName.c_str()) << "&";
+    ss << "OriginalRuleSetName=" << StringUtils::URLEncoded(m_originalRuleSetName) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CloneReceiptRuleSetResult& CloneReceiptRuleSetResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CloneReceiptRuleSetResult")
+  if (rootNode.GetNameView() != "CloneReceiptRuleSetResult")
   {
     resultNode = rootNode.FirstChild("CloneReceiptRuleSetResult");
   }
@@ -51,13 +51,13 @@ Content& Content::operator =(const XmlNode& xmlNode)
     XmlNode dataNode = resultNode.FirstChild("Data");
     if(!dataNode.IsNull())
     {
-      m_data = StringUtils::Trim(dataNode.GetText().c_str());
+      m_data = dataNode.GetTextView().Trim().ToString();
       m_dataHasBeenSet = true;
     }
     XmlNode charsetNode = resultNode.FirstChild("Charset");
     if(!charsetNode.IsNull())
     {
-      m_charset = StringUtils::Trim(charsetNode.GetText().c_str());
+      m_charset = charsetNode.GetTextView().Trim().ToString();
       m_charsetHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void Content::OutputToStream(Aws::OStream& oStream, const char* location, unsign
 {
   if(m_dataHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Data=" << StringUtils::URLEncode(m_data.c_str()) << "&";
+      oStream << location << index << locationValue << ".Data=" << StringUtils::URLEncoded(m_data) << "&";
   }
 
   if(m_charsetHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Charset=" << StringUtils::URLEncode(m_charset.c_str()) << "&";
+      oStream << location << index << locationValue << ".Charset=" << StringUtils::URLEncoded(m_charset) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void Content::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_dataHasBeenSet)
   {
-      oStream << location << ".Data=" << StringUtils::URLEncode(m_data.c_str()) << "&";
+      oStream << location << ".Data=" << StringUtils::URLEncoded(m_data) << "&";
   }
   if(m_charsetHasBeenSet)
   {
-      oStream << location << ".Charset=" << StringUtils::URLEncode(m_charset.c_str()) << "&";
+      oStream << location << ".Charset=" << StringUtils::URLEncoded(m_charset) << "&";
   }
 }
 
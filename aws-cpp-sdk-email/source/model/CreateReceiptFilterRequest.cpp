@@ -15,6 +15,7 @@
 #include <aws/email/model/CreateReceiptFilterRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -26,7 +27,7 @@ CreateReceiptFilterRequest::CreateReceiptFilterRequest() :
 
 Aws::String CreateReceiptFilterRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateReceiptFilter&";
   if(m_filterHasBeenSet)
   {
@@ -34,6 +35,6 @@ Aws::String CreateReceiptFilterRequest::SerializePayload() const
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
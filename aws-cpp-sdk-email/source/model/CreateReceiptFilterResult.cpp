@@ -40,7 +40,7 @@ CreateReceiptFilterResult& CreateReceiptFilterResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateReceiptFilterResult")
+  if (rootNode.GetNameView() != "CreateReceiptFilterResult")
   {
     resultNode = rootNode.FirstChild("CreateReceiptFilterResult");
   }
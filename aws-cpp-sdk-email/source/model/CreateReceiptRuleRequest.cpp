@@ -15,6 +15,7 @@
 #include <aws/email/model/CreateReceiptRuleRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ CreateReceiptRuleRequest::CreateReceiptRuleRequest() :
 
 Aws::String CreateReceiptRuleRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateReceiptRule&";
   if(m_ruleSetNameHasBeenSet)
   {
-    ss << "RuleSetName=" << StringUtils::URLEncode(m_ruleSetName.c_str()) << "&";
+    ss << "RuleSetName=" << StringUtils::URLEncoded(m_ruleSetName) << "&";
   }
 
   if(m_afterHasBeenSet)
   {
-    ss << "After=" << StringUtils::URLEncode(m_after.c_str()) << "&";
+    ss << "After=" << StringUtils::URLEncoded(m_after) << "&";
   }
 
   if(m_ruleHasBeenSet)
@@ -46,6 +47,6 @@ Aws::String CreateReceiptRuleRequest::SerializePayload() const
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
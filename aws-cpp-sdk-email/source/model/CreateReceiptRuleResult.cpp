@@ -40,7 +40,7 @@ CreateReceiptRuleResult& CreateReceiptRuleResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateReceiptRuleResult")
+  if (rootNode.GetNameView() != "CreateReceiptRuleResult")
   {
     resultNode = rootNode.FirstChild("CreateReceiptRuleResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/email/model/CreateReceiptRuleSetRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ CreateReceiptRuleSetRequest::CreateReceiptRuleSetRequest() :
 
 Aws::String CreateReceiptRuleSetRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateReceiptRuleSet&";
   if(m_ruleSetNameHasBeenSet)
   {
-    ss << "RuleSetName=" << StringUtils::URLEncode(m_ruleSetName.c_str()) << "&";
+    ss << "RuleSetName=" << StringUtils::URLEncoded(m_ruleSetName) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateReceiptRuleSetResult& CreateReceiptRuleSetResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateReceiptRuleSetResult")
+  if (rootNode.GetNameView() != "CreateReceiptRuleSetResult")
   {
     resultNode = rootNode.FirstChild("CreateReceiptRuleSetResult");
   }
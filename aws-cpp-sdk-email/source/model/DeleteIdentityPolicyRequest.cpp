@@ -15,6 +15,7 @@
 #include <aws/email/model/DeleteIdentityPolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ DeleteIdentityPolicyRequest::DeleteIdentityPolicyRequest() :
 
 Aws::String DeleteIdentityPolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteIdentityPolicy&";
   if(m_identityHasBeenSet)
   {
-    ss << "Identity=" << StringUtils::URLEncode(m_identity.c_str()) << "&";
+    ss << "Identity=" << StringUtils::URLEncoded(m_identity) << "&";
   }
 
   if(m_policyNameHasBeenSet)
   {
-    ss << "PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+    ss << "PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DeleteIdentityPolicyResult& DeleteIdentityPolicyResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteIdentityPolicyResult")
+  if (rootNode.GetNameView() != "DeleteIdentityPolicyResult")
   {
     resultNode = rootNode.FirstChild("DeleteIdentityPolicyResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/email/model/DeleteIdentityRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteIdentityRequest::DeleteIdentityRequest() :
 
 Aws::String DeleteIdentityRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteIdentity&";
   if(m_identityHasBeenSet)
   {
-    ss << "Identity=" << StringUtils::URLEncode(m_identity.c_str()) << "&";
+    ss << "Identity=" << StringUtils::URLEncoded(m_identity) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DeleteIdentityResult& DeleteIdentityResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteIdentityResult")
+  if (rootNode.GetNameView() != "DeleteIdentityResult")
   {
     resultNode = rootNode.FirstChild("DeleteIdentityResult");
   }
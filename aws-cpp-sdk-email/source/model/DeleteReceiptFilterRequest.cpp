@@ -15,6 +15,7 @@
 #include <aws/email/model/DeleteReceiptFilterRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteReceiptFilterRequest::DeleteReceiptFilterRequest() :
 
 Aws::String DeleteReceiptFilterRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteReceiptFilter&";
   if(m_filterNameHasBeenSet)
   {
-    ss << "FilterName=" << StringUtils::URLEncode(m_filterName.c_str()) << "&";
+    ss << "FilterName=" << StringUtils::URLEncoded(m_filterName) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
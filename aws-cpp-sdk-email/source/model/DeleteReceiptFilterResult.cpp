@@ -40,7 +40,7 @@ DeleteReceiptFilterResult& DeleteReceiptFilterResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteReceiptFilterResult")
+  if (rootNode.GetNameView() != "DeleteReceiptFilterResult")
   {
     resultNode = rootNode.FirstChild("DeleteReceiptFilterResult");
   }
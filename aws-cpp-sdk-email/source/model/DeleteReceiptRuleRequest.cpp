@@ -15,6 +15,7 @@
 #include <aws/email/model/DeleteReceiptRuleRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ DeleteReceiptRuleRequest::DeleteReceiptRuleRequest() :
 
 Aws::String DeleteReceiptRuleRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteReceiptRule&";
   if(m_ruleSetNameHasBeenSet)
   {
-    ss << "RuleSetName=" << StringUtils::URLEncode(m_ruleSetName.c_str()) << "&";
+    ss << "RuleSetName=" << StringUtils::URLEncoded(m_ruleSetName) << "&";
   }
 
   if(m_ruleNameHasBeenSet)
   {
-    ss << "RuleName=" << StringUtils::URLEncode(m_ruleName.c_str()) << "&";
+    ss << "RuleName=" << StringUtils::URLEncoded(m_ruleName) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
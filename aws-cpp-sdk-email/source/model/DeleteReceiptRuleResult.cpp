@@ -40,7 +40,7 @@ DeleteReceiptRuleResult& DeleteReceiptRuleResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteReceiptRuleResult")
+  if (rootNode.GetNameView() != "DeleteReceiptRuleResult")
   {
     resultNode = rootNode.FirstChild("DeleteReceiptRuleResult");
   }
@@ -40,7 +40,7 @@ DeleteReceiptRuleSetResult& DeleteReceiptRuleSetResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteReceiptRuleSetResult")
+  if (rootNode.GetNameView() != "DeleteReceiptRuleSetResult")
   {
     resultNode = rootNode.FirstChild("DeleteReceiptRuleSetResult");
   }
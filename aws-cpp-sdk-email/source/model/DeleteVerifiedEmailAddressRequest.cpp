@@ -15,6 +15,7 @@
 #include <aws/email/model/DeleteVerifiedEmailAddressRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteVerifiedEmailAddressRequest::DeleteVerifiedEmailAddressRequest() :
 
 Aws::String DeleteVerifiedEmailAddressRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteVerifiedEmailAddress&";
   if(m_emailAddressHasBeenSet)
   {
-    ss << "EmailAddress=" << StringUtils::URLEncode(m_emailAddress.c_str()) << "&";
+    ss << "EmailAddress=" << StringUtils::URLEncoded(m_emailAddress) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeActiveReceiptRuleSetResult& DescribeActiveReceiptRuleSetResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeActiveReceiptRuleSetResult")
+  if (rootNode.GetNameView() != "DescribeActiveReceiptRuleSetResult")
   {
     resultNode = rootNode.FirstChild("DescribeActiveReceiptRuleSetResult");
   }
@@ -40,7 +40,7 @@ DescribeReceiptRuleResult& DescribeReceiptRuleResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeReceiptRuleResult")
+  if (rootNode.GetNameView() != "DescribeReceiptRuleResult")
   {
     resultNode = rootNode.FirstChild("DescribeReceiptRuleResult");
   }
@@ -40,7 +40,7 @@ DescribeReceiptRuleSetResult& DescribeReceiptRuleSetResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeReceiptRuleSetResult")
+  if (rootNode.GetNameView() != "DescribeReceiptRuleSetResult")
   {
     resultNode = rootNode.FirstChild("DescribeReceiptRuleSetResult");
   }
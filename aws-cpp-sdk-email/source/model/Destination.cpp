@@ -56,7 +56,7 @@ Destination& Destination::operator =(const XmlNode& xmlNode)
       XmlNode toAddressesMember = toAddressesNode.FirstChild("member");
       while(!toAddressesMember.IsNull())
       {
-        m_toAddresses.push_back(StringUtils::Trim(toAddressesMember.GetText().c_str()));
+        m_toAddresses.push_back(toAddressesMember.GetTextView().Trim().ToString());
         toAddressesMember = toAddressesMember.NextNode("member");
       }
 
@@ -68,7 +68,7 @@ Destination& Destination::operator =(const XmlNode& xmlNode)
       XmlNode ccAddressesMember = ccAddressesNode.FirstChild("member");
       while(!ccAddressesMember.IsNull())
       {
-        m_ccAddresses.push_back(StringUtils::Trim(ccAddressesMember.GetText().c_str()));
+        m_ccAddresses.push_back(ccAddressesMember.GetTextView().Trim().ToString());
         ccAddressesMember = ccAddressesMember.NextNode("member");
       }
 
@@ -80,7 +80,7 @@ Destination& Destination::operator =(const XmlNode& xmlNode)
       XmlNode bccAddressesMember = bccAddressesNode.FirstChild("member");
       while(!bccAddressesMember.IsNull())
       {
-        m_bccAddresses.push_back(StringUtils::Trim(bccAddressesMember.GetText().c_str()));
+        m_bccAddresses.push_back(bccAddressesMember.GetTextView().Trim().ToString());
         bccAddressesMember = bccAddressesMember.NextNode("member");
       }
 
@@ -98,7 +98,7 @@ void Destination::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned toAddressesIdx = 1;
       for(auto& item : m_toAddresses)
       {
-        oStream << location << index << locationValue << ".ToAddresses.member." << toAddressesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".ToAddresses.member." << toAddressesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -107,7 +107,7 @@ void Destination::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned ccAddressesIdx = 1;
       for(auto& item : m_ccAddresses)
       {
-        oStream << location << index << locationValue << ".CcAddresses.member." << ccAddressesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".CcAddresses.member." << ccAddressesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -116,7 +116,7 @@ void Destination::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned bccAddressesIdx = 1;
       for(auto& item : m_bccAddresses)
       {
-        oStream << location << index << locationValue << ".BccAddresses.member." << bccAddressesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".BccAddresses.member." << bccAddressesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -129,7 +129,7 @@ void Destination::OutputToStream(Aws::OStream& oStream, const char* location) co
       unsigned toAddressesIdx = 1;
       for(auto& item : m_toAddresses)
       {
-        oStream << location << ".ToAddresses.member." << toAddressesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".ToAddresses.member." << toAddressesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_ccAddressesHasBeenSet)
@@ -137,7 +137,7 @@ void Destination::OutputToStream(Aws::OStream& oStream, const char* location) co
       unsigned ccAddressesIdx = 1;
       for(auto& item : m_ccAddresses)
       {
-        oStream << location << ".CcAddresses.member." << ccAddressesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".CcAddresses.member." << ccAddressesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_bccAddressesHasBeenSet)
@@ -145,7 +145,7 @@ void Destination::OutputToStream(Aws::OStream& oStream, const char* location) co
       unsigned bccAddressesIdx = 1;
       for(auto& item : m_bccAddresses)
       {
-        oStream << location << ".BccAddresses.member." << bccAddressesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".BccAddresses.member." << bccAddressesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
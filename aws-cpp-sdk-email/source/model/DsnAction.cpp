@@ -29,36 +29,38 @@ namespace Aws
       namespace DsnActionMapper
       {
 
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int delayed_HASH = HashingUtils::HashString("delayed");
-        static const int delivered_HASH = HashingUtils::HashString("delivered");
-        static const int relayed_HASH = HashingUtils::HashString("relayed");
-        static const int expanded_HASH = HashingUtils::HashString("expanded");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int failed_HASH = -1281977283;
+        static const int delayed_HASH = 1550348642;
+        static const int delivered_HASH = -242327420;
+        static const int relayed_HASH = 1090498288;
+        static const int expanded_HASH = -1939100487;
 
 
         DsnAction GetDsnActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == failed_HASH)
+          switch (hashCode)
           {
+          case failed_HASH:
             return DsnAction::failed;
-          }
-          else if (hashCode == delayed_HASH)
-          {
+          case delayed_HASH:
             return DsnAction::delayed;
-          }
-          else if (hashCode == delivered_HASH)
-          {
+          case delivered_HASH:
             return DsnAction::delivered;
-          }
-          else if (hashCode == relayed_HASH)
-          {
+          case relayed_HASH:
             return DsnAction::relayed;
-          }
-          else if (hashCode == expanded_HASH)
-          {
+          case expanded_HASH:
             return DsnAction::expanded;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -40,7 +40,7 @@ GetIdentityDkimAttributesResult& GetIdentityDkimAttributesResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetIdentityDkimAttributesResult")
+  if (rootNode.GetNameView() != "GetIdentityDkimAttributesResult")
   {
     resultNode = rootNode.FirstChild("GetIdentityDkimAttributesResult");
   }
@@ -56,7 +56,7 @@ GetIdentityDkimAttributesResult& GetIdentityDkimAttributesResult::operator =(con
       {
         XmlNode keyNode = dkimAttributesEntry.FirstChild("key");
         XmlNode valueNode = dkimAttributesEntry.FirstChild("value");
-        m_dkimAttributes[StringUtils::Trim(keyNode.GetText().c_str())] =
+        m_dkimAttributes[keyNode.GetTextView().Trim().ToString()] =
             valueNode;
         dkimAttributesEntry = dkimAttributesEntry.NextNode("entry");
       }
@@ -40,7 +40,7 @@ GetIdentityMailFromDomainAttributesResult& GetIdentityMailFromDomainAttributesRe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetIdentityMailFromDomainAttributesResult")
+  if (rootNode.GetNameView() != "GetIdentityMailFromDomainAttributesResult")
   {
     resultNode = rootNode.FirstChild("GetIdentityMailFromDomainAttributesResult");
   }
@@ -56,7 +56,7 @@ GetIdentityMailFromDomainAttributesResult& GetIdentityMailFromDomainAttributesRe
       {
         XmlNode keyNode = mailFromDomainAttributesEntry.FirstChild("key");
         XmlNode valueNode = mailFromDomainAttributesEntry.FirstChild("value");
-        m_mailFromDomainAttributes[StringUtils::Trim(keyNode.GetText().c_str())] =
+        m_mailFromDomainAttributes[keyNode.GetTextView().Trim().ToString()] =
             valueNode;
         mailFromDomainAttributesEntry = mailFromDomainAttributesEntry.NextNode("entry");
       }
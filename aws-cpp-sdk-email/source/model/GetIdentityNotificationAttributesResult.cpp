@@ -40,7 +40,7 @@ GetIdentityNotificationAttributesResult& GetIdentityNotificationAttributesResult
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetIdentityNotificationAttributesResult")
+  if (rootNode.GetNameView() != "GetIdentityNotificationAttributesResult")
   {
     resultNode = rootNode.FirstChild("GetIdentityNotificationAttributesResult");
   }
@@ -56,7 +56,7 @@ GetIdentityNotificationAttributesResult& GetIdentityNotificationAttributesResult
       {
         XmlNode keyNode = notificationAttributesEntry.FirstChild("key");
         XmlNode valueNode = notificationAttributesEntry.FirstChild("value");
-        m_notificationAttributes[StringUtils::Trim(keyNode.GetText().c_str())] =
+        m_notificationAttributes[keyNode.GetTextView().Trim().ToString()] =
             valueNode;
         notificationAttributesEntry = notificationAttributesEntry.NextNode("entry");
       }
@@ -15,6 +15,7 @@
 #include <aws/email/model/GetIdentityPoliciesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ GetIdentityPoliciesRequest::GetIdentityPoliciesRequest() :
 
 Aws::String GetIdentityPoliciesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetIdentityPolicies&";
   if(m_identityHasBeenSet)
   {
-    ss << "Identity=" << StringUtils::URLEncode(m_identity.c_str()) << "&";
+    ss << "Identity=" << StringUtils::URLEncoded(m_identity) << "&";
   }
 
   if(m_policyNamesHasBeenSet)
@@ -40,12 +41,12 @@ Aws::String GetIdentityPoliciesRequest::SerializePayload() const
     for(auto& item : m_policyNames)
     {
       ss << "PolicyNames.member." << policyNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       policyNamesCount++;
     }
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ GetIdentityPoliciesResult& GetIdentityPoliciesResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetIdentityPoliciesResult")
+  if (rootNode.GetNameView() != "GetIdentityPoliciesResult")
   {
     resultNode = rootNode.FirstChild("GetIdentityPoliciesResult");
   }
@@ -56,8 +56,8 @@ GetIdentityPoliciesResult& GetIdentityPoliciesResult::operator =(const AmazonWeb
       {
         XmlNode keyNode = policiesEntry.FirstChild("key");
         XmlNode valueNode = policiesEntry.FirstChild("value");
-        m_policies[StringUtils::Trim(keyNode.GetText().c_str())] =
-            StringUtils::Trim(valueNode.GetText().c_str());
+        m_policies[keyNode.GetTextView().Trim().ToString()] =
+            valueNode.GetTextView().Trim().ToString();
         policiesEntry = policiesEntry.NextNode("entry");
       }
 
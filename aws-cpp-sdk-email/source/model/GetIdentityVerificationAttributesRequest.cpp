@@ -15,6 +15,7 @@
 #include <aws/email/model/GetIdentityVerificationAttributesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -26,7 +27,7 @@ GetIdentityVerificationAttributesRequest::GetIdentityVerificationAttributesReque
 
 Aws::String GetIdentityVerificationAttributesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetIdentityVerificationAttributes&";
   if(m_identitiesHasBeenSet)
   {
@@ -34,12 +35,12 @@ Aws::String GetIdentityVerificationAttributesRequest::SerializePayload() const
     for(auto& item : m_identities)
     {
       ss << "Identities.member." << identitiesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       identitiesCount++;
     }
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ GetIdentityVerificationAttributesResult& GetIdentityVerificationAttributesResult
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetIdentityVerificationAttributesResult")
+  if (rootNode.GetNameView() != "GetIdentityVerificationAttributesResult")
   {
     resultNode = rootNode.FirstChild("GetIdentityVerificationAttributesResult");
   }
@@ -56,7 +56,7 @@ GetIdentityVerificationAttributesResult& GetIdentityVerificationAttributesResult
       {
         XmlNode keyNode = verificationAttributesEntry.FirstChild("key");
         XmlNode valueNode = verificationAttributesEntry.FirstChild("value");
-        m_verificationAttributes[StringUtils::Trim(keyNode.GetText().c_str())] =
+        m_verificationAttributes[keyNode.GetTextView().Trim().ToString()] =
             valueNode;
         verificationAttributesEntry = verificationAttributesEntry.NextNode("entry");
       }
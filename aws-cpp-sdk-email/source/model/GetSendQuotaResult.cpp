@@ -46,7 +46,7 @@ GetSendQuotaResult& GetSendQuotaResult::operator =(const AmazonWebServiceResult<
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetSendQuotaResult")
+  if (rootNode.GetNameView() != "GetSendQuotaResult")
   {
     resultNode = rootNode.FirstChild("GetSendQuotaResult");
   }
@@ -56,17 +56,17 @@ GetSendQuotaResult& GetSendQuotaResult::operator =(const AmazonWebServiceResult<
     XmlNode max24HourSendNode = resultNode.FirstChild("Max24HourSend");
     if(!max24HourSendNode.IsNull())
     {
-      m_max24HourSend = StringUtils::ConvertToDouble(StringUtils::Trim(max24HourSendNode.GetText().c_str()).c_str());
+      m_max24HourSend = StringUtils::ConvertToDouble(max24HourSendNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode maxSendRateNode = resultNode.FirstChild("MaxSendRate");
     if(!maxSendRateNode.IsNull())
     {
-      m_maxSendRate = StringUtils::ConvertToDouble(StringUtils::Trim(maxSendRateNode.GetText().c_str()).c_str());
+      m_maxSendRate = StringUtils::ConvertToDouble(maxSendRateNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode sentLast24HoursNode = resultNode.FirstChild("SentLast24Hours");
     if(!sentLast24HoursNode.IsNull())
     {
-      m_sentLast24Hours = StringUtils::ConvertToDouble(StringUtils::Trim(sentLast24HoursNode.GetText().c_str()).c_str());
+      m_sentLast24Hours = StringUtils::ConvertToDouble(sentLast24HoursNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -40,7 +40,7 @@ GetSendStatisticsResult& GetSendStatisticsResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetSendStatisticsResult")
+  if (rootNode.GetNameView() != "GetSendStatisticsResult")
   {
     resultNode = rootNode.FirstChild("GetSendStatisticsResult");
   }
@@ -55,13 +55,13 @@ IdentityDkimAttributes& IdentityDkimAttributes::operator =(const XmlNode& xmlNod
     XmlNode dkimEnabledNode = resultNode.FirstChild("DkimEnabled");
     if(!dkimEnabledNode.IsNull())
     {
-      m_dkimEnabled = StringUtils::ConvertToBool(StringUtils::Trim(dkimEnabledNode.GetText().c_str()).c_str());
+      m_dkimEnabled = StringUtils::ConvertToBool(dkimEnabledNode.GetTextView().Trim().ToString().c_str());
       m_dkimEnabledHasBeenSet = true;
     }
     XmlNode dkimVerificationStatusNode = resultNode.FirstChild("DkimVerificationStatus");
     if(!dkimVerificationStatusNode.IsNull())
     {
-      m_dkimVerificationStatus = VerificationStatusMapper::GetVerificationStatusForName(StringUtils::Trim(dkimVerificationStatusNode.GetText().c_str()).c_str());
+      m_dkimVerificationStatus = VerificationStatusMapper::GetVerificationStatusForName(dkimVerificationStatusNode.GetTextView().Trim().ToString().c_str());
       m_dkimVerificationStatusHasBeenSet = true;
     }
     XmlNode dkimTokensNode = resultNode.FirstChild("DkimTokens");
@@ -70,7 +70,7 @@ IdentityDkimAttributes& IdentityDkimAttributes::operator =(const XmlNode& xmlNod
       XmlNode dkimTokensMember = dkimTokensNode.FirstChild("member");
       while(!dkimTokensMember.IsNull())
       {
-        m_dkimTokens.push_back(StringUtils::Trim(dkimTokensMember.GetText().c_str()));
+        m_dkimTokens.push_back(dkimTokensMember.GetTextView().Trim().ToString());
         dkimTokensMember = dkimTokensMember.NextNode("member");
       }
 
@@ -98,7 +98,7 @@ void IdentityDkimAttributes::OutputToStream(Aws::OStream& oStream, const char* l
       unsigned dkimTokensIdx = 1;
       for(auto& item : m_dkimTokens)
       {
-        oStream << location << index << locationValue << ".DkimTokens.member." << dkimTokensIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".DkimTokens.member." << dkimTokensIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -119,7 +119,7 @@ void IdentityDkimAttributes::OutputToStream(Aws::OStream& oStream, const char* l
       unsigned dkimTokensIdx = 1;
       for(auto& item : m_dkimTokens)
       {
-        oStream << location << ".DkimTokens.member." << dkimTokensIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".DkimTokens.member." << dkimTokensIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
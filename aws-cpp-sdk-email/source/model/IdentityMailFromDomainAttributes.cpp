@@ -53,19 +53,19 @@ IdentityMailFromDomainAttributes& IdentityMailFromDomainAttributes::operator =(c
     XmlNode mailFromDomainNode = resultNode.FirstChild("MailFromDomain");
     if(!mailFromDomainNode.IsNull())
     {
-      m_mailFromDomain = StringUtils::Trim(mailFromDomainNode.GetText().c_str());
+      m_mailFromDomain = mailFromDomainNode.GetTextView().Trim().ToString();
       m_mailFromDomainHasBeenSet = true;
     }
     XmlNode mailFromDomainStatusNode = resultNode.FirstChild("MailFromDomainStatus");
     if(!mailFromDomainStatusNode.IsNull())
     {
-      m_mailFromDomainStatus = CustomMailFromStatusMapper::GetCustomMailFromStatusForName(StringUtils::Trim(mailFromDomainStatusNode.GetText().c_str()).c_str());
+      m_mailFromDomainStatus = CustomMailFromStatusMapper::GetCustomMailFromStatusForName(mailFromDomainStatusNode.GetTextView().Trim().ToString().c_str());
       m_mailFromDomainStatusHasBeenSet = true;
     }
     XmlNode behaviorOnMXFailureNode = resultNode.FirstChild("BehaviorOnMXFailure");
     if(!behaviorOnMXFailureNode.IsNull())
     {
-      m_behaviorOnMXFailure = BehaviorOnMXFailureMapper::GetBehaviorOnMXFailureForName(StringUtils::Trim(behaviorOnMXFailureNode.GetText().c_str()).c_str());
+      m_behaviorOnMXFailure = BehaviorOnMXFailureMapper::GetBehaviorOnMXFailureForName(behaviorOnMXFailureNode.GetTextView().Trim().ToString().c_str());
       m_behaviorOnMXFailureHasBeenSet = true;
     }
   }
@@ -77,7 +77,7 @@ void IdentityMailFromDomainAttributes::OutputToStream(Aws::OStream& oStream, con
 {
   if(m_mailFromDomainHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MailFromDomain=" << StringUtils::URLEncode(m_mailFromDomain.c_str()) << "&";
+      oStream << location << index << locationValue << ".MailFromDomain=" << StringUtils::URLEncoded(m_mailFromDomain) << "&";
   }
 
   if(m_mailFromDomainStatusHasBeenSet)
@@ -96,7 +96,7 @@ void IdentityMailFromDomainAttributes::OutputToStream(Aws::OStream& oStream, con
 {
   if(m_mailFromDomainHasBeenSet)
   {
-      oStream << location << ".MailFromDomain=" << StringUtils::URLEncode(m_mailFromDomain.c_str()) << "&";
+      oStream << location << ".MailFromDomain=" << StringUtils::URLEncoded(m_mailFromDomain) << "&";
   }
   if(m_mailFromDomainStatusHasBeenSet)
   {
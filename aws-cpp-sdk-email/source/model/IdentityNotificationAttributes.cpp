@@ -69,43 +69,43 @@ IdentityNotificationAttributes& IdentityNotificationAttributes::operator =(const
     XmlNode bounceTopicNode = resultNode.FirstChild("BounceTopic");
     if(!bounceTopicNode.IsNull())
     {
-      m_bounceTopic = StringUtils::Trim(bounceTopicNode.GetText().c_str());
+      m_bounceTopic = bounceTopicNode.GetTextView().Trim().ToString();
       m_bounceTopicHasBeenSet = true;
     }
     XmlNode complaintTopicNode = resultNode.FirstChild("ComplaintTopic");
     if(!complaintTopicNode.IsNull())
     {
-      m_complaintTopic = StringUtils::Trim(complaintTopicNode.GetText().c_str());
+      m_complaintTopic = complaintTopicNode.GetTextView().Trim().ToString();
       m_complaintTopicHasBeenSet = true;
     }
     XmlNode deliveryTopicNode = resultNode.FirstChild("DeliveryTopic");
     if(!deliveryTopicNode.IsNull())
     {
-      m_deliveryTopic = StringUtils::Trim(deliveryTopicNode.GetText().c_str());
+      m_deliveryTopic = deliveryTopicNode.GetTextView().Trim().ToString();
       m_deliveryTopicHasBeenSet = true;
     }
     XmlNode forwardingEnabledNode = resultNode.FirstChild("ForwardingEnabled");
     if(!forwardingEnabledNode.IsNull())
     {
-      m_forwardingEnabled = StringUtils::ConvertToBool(StringUtils::Trim(forwardingEnabledNode.GetText().c_str()).c_str());
+      m_forwardingEnabled = StringUtils::ConvertToBool(forwardingEnabledNode.GetTextView().Trim().ToString().c_str());
       m_forwardingEnabledHasBeenSet = true;
     }
     XmlNode headersInBounceNotificationsEnabledNode = resultNode.FirstChild("HeadersInBounceNotificationsEnabled");
     if(!headersInBounceNotificationsEnabledNode.IsNull())
     {
-      m_headersInBounceNotificationsEnabled = StringUtils::ConvertToBool(StringUtils::Trim(headersInBounceNotificationsEnabledNode.GetText().c_str()).c_str());
+      m_headersInBounceNotificationsEnabled = StringUtils::ConvertToBool(headersInBounceNotificationsEnabledNode.GetTextView().Trim().ToString().c_str());
       m_headersInBounceNotificationsEnabledHasBeenSet = true;
     }
     XmlNode headersInComplaintNotificationsEnabledNode = resultNode.FirstChild("HeadersInComplaintNotificationsEnabled");
     if(!headersInComplaintNotificationsEnabledNode.IsNull())
     {
-      m_headersInComplaintNotificationsEnabled = StringUtils::ConvertToBool(StringUtils::Trim(headersInComplaintNotificationsEnabledNode.GetText().c_str()).c_str());
+      m_headersInComplaintNotificationsEnabled = StringUtils::ConvertToBool(headersInComplaintNotificationsEnabledNode.GetTextView().Trim().ToString().c_str());
       m_headersInComplaintNotificationsEnabledHasBeenSet = true;
     }
     XmlNode headersInDeliveryNotificationsEnabledNode = resultNode.FirstChild("HeadersInDeliveryNotificationsEnabled");
     if(!headersInDeliveryNotificationsEnabledNode.IsNull())
     {
-      m_headersInDeliveryNotificationsEnabled = StringUtils::ConvertToBool(StringUtils::Trim(headersInDeliveryNotificationsEnabledNode.GetText().c_str()).c_str());
+      m_headersInDeliveryNotificationsEnabled = StringUtils::ConvertToBool(headersInDeliveryNotificationsEnabledNode.GetTextView().Trim().ToString().c_str());
       m_headersInDeliveryNotificationsEnabledHasBeenSet = true;
     }
   }
@@ -117,17 +117,17 @@ void IdentityNotificationAttributes::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_bounceTopicHasBeenSet)
   {
-      oStream << location << index << locationValue << ".BounceTopic=" << StringUtils::URLEncode(m_bounceTopic.c_str()) << "&";
+      oStream << location << index << locationValue << ".BounceTopic=" << StringUtils::URLEncoded(m_bounceTopic) << "&";
   }
 
   if(m_complaintTopicHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ComplaintTopic=" << StringUtils::URLEncode(m_complaintTopic.c_str()) << "&";
+      oStream << location << index << locationValue << ".ComplaintTopic=" << StringUtils::URLEncoded(m_complaintTopic) << "&";
   }
 
   if(m_deliveryTopicHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DeliveryTopic=" << StringUtils::URLEncode(m_deliveryTopic.c_str()) << "&";
+      oStream << location << index << locationValue << ".DeliveryTopic=" << StringUtils::URLEncoded(m_deliveryTopic) << "&";
   }
 
   if(m_forwardingEnabledHasBeenSet)
@@ -156,15 +156,15 @@ void IdentityNotificationAttributes::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_bounceTopicHasBeenSet)
   {
-      oStream << location << ".BounceTopic=" << StringUtils::URLEncode(m_bounceTopic.c_str()) << "&";
+      oStream << location << ".BounceTopic=" << StringUtils::URLEncoded(m_bounceTopic) << "&";
   }
   if(m_complaintTopicHasBeenSet)
   {
-      oStream << location << ".ComplaintTopic=" << StringUtils::URLEncode(m_complaintTopic.c_str()) << "&";
+      oStream << location << ".ComplaintTopic=" << StringUtils::URLEncoded(m_complaintTopic) << "&";
   }
   if(m_deliveryTopicHasBeenSet)
   {
-      oStream << location << ".DeliveryTopic=" << StringUtils::URLEncode(m_deliveryTopic.c_str()) << "&";
+      oStream << location << ".DeliveryTopic=" << StringUtils::URLEncoded(m_deliveryTopic) << "&";
   }
   if(m_forwardingEnabledHasBeenSet)
   {
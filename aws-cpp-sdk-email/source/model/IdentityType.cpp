@@ -29,21 +29,29 @@ namespace Aws
       namespace IdentityTypeMapper
       {
 
-        static const int EmailAddress_HASH = HashingUtils::HashString("EmailAddress");
-        static const int Domain_HASH = HashingUtils::HashString("Domain");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int EmailAddress_HASH = -906611496;
+        static const int Domain_HASH = 2052636900;
 
 
         IdentityType GetIdentityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EmailAddress_HASH)
+          switch (hashCode)
           {
+          case EmailAddress_HASH:
             return IdentityType::EmailAddress;
-          }
-          else if (hashCode == Domain_HASH)
-          {
+          case Domain_HASH:
             return IdentityType::Domain;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
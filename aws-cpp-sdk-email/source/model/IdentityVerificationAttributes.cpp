@@ -51,13 +51,13 @@ IdentityVerificationAttributes& IdentityVerificationAttributes::operator =(const
     XmlNode verificationStatusNode = resultNode.FirstChild("VerificationStatus");
     if(!verificationStatusNode.IsNull())
     {
-      m_verificationStatus = VerificationStatusMapper::GetVerificationStatusForName(StringUtils::Trim(verificationStatusNode.GetText().c_str()).c_str());
+      m_verificationStatus = VerificationStatusMapper::GetVerificationStatusForName(verificationStatusNode.GetTextView().Trim().ToString().c_str());
       m_verificationStatusHasBeenSet = true;
     }
     XmlNode verificationTokenNode = resultNode.FirstChild("VerificationToken");
     if(!verificationTokenNode.IsNull())
     {
-      m_verificationToken = StringUtils::Trim(verificationTokenNode.GetText().c_str());
+      m_verificationToken = verificationTokenNode.GetTextView().Trim().ToString();
       m_verificationTokenHasBeenSet = true;
     }
   }
@@ -74,7 +74,7 @@ void IdentityVerificationAttributes::OutputToStream(Aws::OStream& oStream, const
 
   if(m_verificationTokenHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VerificationToken=" << StringUtils::URLEncode(m_verificationToken.c_str()) << "&";
+      oStream << location << index << locationValue << ".VerificationToken=" << StringUtils::URLEncoded(m_verificationToken) << "&";
   }
 
 }
@@ -87,7 +87,7 @@ void IdentityVerificationAttributes::OutputToStream(Aws::OStream& oStream, const
   }
   if(m_verificationTokenHasBeenSet)
   {
-      oStream << location << ".VerificationToken=" << StringUtils::URLEncode(m_verificationToken.c_str()) << "&";
+      oStream << location << ".VerificationToken=" << StringUtils::URLEncoded(m_verificationToken) << "&";
   }
 }
 
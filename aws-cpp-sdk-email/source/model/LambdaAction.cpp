@@ -53,19 +53,19 @@ LambdaAction& LambdaAction::operator =(const XmlNode& xmlNode)
     XmlNode topicArnNode = resultNode.FirstChild("TopicArn");
     if(!topicArnNode.IsNull())
     {
-      m_topicArn = StringUtils::Trim(topicArnNode.GetText().c_str());
+      m_topicArn = topicArnNode.GetTextView().Trim().ToString();
       m_topicArnHasBeenSet = true;
     }
     XmlNode functionArnNode = resultNode.FirstChild("FunctionArn");
     if(!functionArnNode.IsNull())
     {
-      m_functionArn = StringUtils::Trim(functionArnNode.GetText().c_str());
+      m_functionArn = functionArnNode.GetTextView().Trim().ToString();
       m_functionArnHasBeenSet = true;
     }
     XmlNode invocationTypeNode = resultNode.FirstChild("InvocationType");
     if(!invocationTypeNode.IsNull())
     {
-      m_invocationType = InvocationTypeMapper::GetInvocationTypeForName(StringUtils::Trim(invocationTypeNode.GetText().c_str()).c_str());
+      m_invocationType = InvocationTypeMapper::GetInvocationTypeForName(invocationTypeNode.GetTextView().Trim().ToString().c_str());
       m_invocationTypeHasBeenSet = true;
     }
   }
@@ -77,12 +77,12 @@ void LambdaAction::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
   if(m_functionArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".FunctionArn=" << StringUtils::URLEncode(m_functionArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".FunctionArn=" << StringUtils::URLEncoded(m_functionArn) << "&";
   }
 
   if(m_invocationTypeHasBeenSet)
@@ -96,11 +96,11 @@ void LambdaAction::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
   if(m_functionArnHasBeenSet)
   {
-      oStream << location << ".FunctionArn=" << StringUtils::URLEncode(m_functionArn.c_str()) << "&";
+      oStream << location << ".FunctionArn=" << StringUtils::URLEncoded(m_functionArn) << "&";
   }
   if(m_invocationTypeHasBeenSet)
   {
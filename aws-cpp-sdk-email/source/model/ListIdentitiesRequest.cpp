@@ -15,6 +15,7 @@
 #include <aws/email/model/ListIdentitiesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ ListIdentitiesRequest::ListIdentitiesRequest() :
 
 Aws::String ListIdentitiesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListIdentities&";
   if(m_identityTypeHasBeenSet)
   {
@@ -38,7 +39,7 @@ Aws::String ListIdentitiesRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_maxItemsHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String ListIdentitiesRequest::SerializePayload() const
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ListIdentitiesResult& ListIdentitiesResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListIdentitiesResult")
+  if (rootNode.GetNameView() != "ListIdentitiesResult")
   {
     resultNode = rootNode.FirstChild("ListIdentitiesResult");
   }
@@ -53,7 +53,7 @@ ListIdentitiesResult& ListIdentitiesResult::operator =(const AmazonWebServiceRes
       XmlNode identitiesMember = identitiesNode.FirstChild("member");
       while(!identitiesMember.IsNull())
       {
-        m_identities.push_back(StringUtils::Trim(identitiesMember.GetText().c_str()));
+        m_identities.push_back(identitiesMember.GetTextView().Trim().ToString());
         identitiesMember = identitiesMember.NextNode("member");
       }
 
@@ -61,7 +61,7 @@ ListIdentitiesResult& ListIdentitiesResult::operator =(const AmazonWebServiceRes
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
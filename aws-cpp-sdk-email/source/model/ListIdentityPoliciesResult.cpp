@@ -40,7 +40,7 @@ ListIdentityPoliciesResult& ListIdentityPoliciesResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListIdentityPoliciesResult")
+  if (rootNode.GetNameView() != "ListIdentityPoliciesResult")
   {
     resultNode = rootNode.FirstChild("ListIdentityPoliciesResult");
   }
@@ -53,7 +53,7 @@ ListIdentityPoliciesResult& ListIdentityPoliciesResult::operator =(const AmazonW
       XmlNode policyNamesMember = policyNamesNode.FirstChild("member");
       while(!policyNamesMember.IsNull())
       {
-        m_policyNames.push_back(StringUtils::Trim(policyNamesMember.GetText().c_str()));
+        m_policyNames.push_back(policyNamesMember.GetTextView().Trim().ToString());
         policyNamesMember = policyNamesMember.NextNode("member");
       }
 
@@ -40,7 +40,7 @@ ListReceiptFiltersResult& ListReceiptFiltersResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListReceiptFiltersResult")
+  if (rootNode.GetNameView() != "ListReceiptFiltersResult")
   {
     resultNode = rootNode.FirstChild("ListReceiptFiltersResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/email/model/ListVerifiedEmailAddressesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -25,9 +26,9 @@ ListVerifiedEmailAddressesRequest::ListVerifiedEmailAddressesRequest()
 
 Aws::String ListVerifiedEmailAddressesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListVerifiedEmailAddresses&";
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
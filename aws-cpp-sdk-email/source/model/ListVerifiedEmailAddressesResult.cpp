@@ -40,7 +40,7 @@ ListVerifiedEmailAddressesResult& ListVerifiedEmailAddressesResult::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListVerifiedEmailAddressesResult")
+  if (rootNode.GetNameView() != "ListVerifiedEmailAddressesResult")
   {
     resultNode = rootNode.FirstChild("ListVerifiedEmailAddressesResult");
   }
@@ -53,7 +53,7 @@ ListVerifiedEmailAddressesResult& ListVerifiedEmailAddressesResult::operator =(c
       XmlNode verifiedEmailAddressesMember = verifiedEmailAddressesNode.FirstChild("member");
       while(!verifiedEmailAddressesMember.IsNull())
       {
-        m_verifiedEmailAddresses.push_back(StringUtils::Trim(verifiedEmailAddressesMember.GetText().c_str()));
+        m_verifiedEmailAddresses.push_back(verifiedEmailAddressesMember.GetTextView().Trim().ToString());
         verifiedEmailAddressesMember = verifiedEmailAddressesMember.NextNode("member");
       }
 
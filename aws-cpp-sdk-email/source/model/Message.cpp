@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -69,16 +70,16 @@ void Message::OutputToStream(Aws::OStream& oStream, const char* location, unsign
 {
   if(m_subjectHasBeenSet)
   {
-      Aws::StringStream subjectLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream subjectLocationAndMemberSs;
       subjectLocationAndMemberSs << location << index << locationValue << ".Subject";
-      m_subject.OutputToStream(oStream, subjectLocationAndMemberSs.str().c_str());
+      m_subject.OutputToStream(oStream, subjectLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_bodyHasBeenSet)
   {
-      Aws::StringStream bodyLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream bodyLocationAndMemberSs;
       bodyLocationAndMemberSs << location << index << locationValue << ".Body";
-      m_body.OutputToStream(oStream, bodyLocationAndMemberSs.str().c_str());
+      m_body.OutputToStream(oStream, bodyLocationAndMemberSs.GetString().c_str());
   }
 
 }
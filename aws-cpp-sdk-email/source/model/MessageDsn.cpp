@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,13 +54,13 @@ MessageDsn& MessageDsn::operator =(const XmlNode& xmlNode)
     XmlNode reportingMtaNode = resultNode.FirstChild("ReportingMta");
     if(!reportingMtaNode.IsNull())
     {
-      m_reportingMta = StringUtils::Trim(reportingMtaNode.GetText().c_str());
+      m_reportingMta = reportingMtaNode.GetTextView().Trim().ToString();
       m_reportingMtaHasBeenSet = true;
     }
     XmlNode arrivalDateNode = resultNode.FirstChild("ArrivalDate");
     if(!arrivalDateNode.IsNull())
     {
-      m_arrivalDate = DateTime(StringUtils::Trim(arrivalDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_arrivalDate = DateTime(arrivalDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_arrivalDateHasBeenSet = true;
     }
     XmlNode extensionFieldsNode = resultNode.FirstChild("ExtensionFields");
@@ -83,12 +84,12 @@ void MessageDsn::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_reportingMtaHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReportingMta=" << StringUtils::URLEncode(m_reportingMta.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReportingMta=" << StringUtils::URLEncoded(m_reportingMta) << "&";
   }
 
   if(m_arrivalDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ArrivalDate=" << StringUtils::URLEncode(m_arrivalDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".ArrivalDate=" << StringUtils::URLEncoded(m_arrivalDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_extensionFieldsHasBeenSet)
@@ -96,9 +97,9 @@ void MessageDsn::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned extensionFieldsIdx = 1;
       for(auto& item : m_extensionFields)
       {
-        Aws::StringStream extensionFieldsSs;
+        Aws::Utils::Stream::StringOutputStream extensionFieldsSs;
         extensionFieldsSs << location << index << locationValue << ".ExtensionFields.member." << extensionFieldsIdx++;
-        item.OutputToStream(oStream, extensionFieldsSs.str().c_str());
+        item.OutputToStream(oStream, extensionFieldsSs.GetString().c_str());
       }
   }
 
@@ -108,20 +109,20 @@ void MessageDsn::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_reportingMtaHasBeenSet)
   {
-      oStream << location << ".ReportingMta=" << StringUtils::URLEncode(m_reportingMta.c_str()) << "&";
+      oStream << location << ".ReportingMta=" << StringUtils::URLEncoded(m_reportingMta) << "&";
   }
   if(m_arrivalDateHasBeenSet)
   {
-      oStream << location << ".ArrivalDate=" << StringUtils::URLEncode(m_arrivalDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".ArrivalDate=" << StringUtils::URLEncoded(m_arrivalDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_extensionFieldsHasBeenSet)
   {
       unsigned extensionFieldsIdx = 1;
       for(auto& item : m_extensionFields)
       {
-        Aws::StringStream extensionFieldsSs;
+        Aws::Utils::Stream::StringOutputStream extensionFieldsSs;
         extensionFieldsSs << location <<  ".ExtensionFields.member." << extensionFieldsIdx++;
-        item.OutputToStream(oStream, extensionFieldsSs.str().c_str());
+        item.OutputToStream(oStream, extensionFieldsSs.GetString().c_str());
       }
   }
 }
@@ -29,26 +29,32 @@ namespace Aws
       namespace NotificationTypeMapper
       {
 
-        static const int Bounce_HASH = HashingUtils::HashString("Bounce");
-        static const int Complaint_HASH = HashingUtils::HashString("Complaint");
-        static const int Delivery_HASH = HashingUtils::HashString("Delivery");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Bounce_HASH = 1995629224;
+        static const int Complaint_HASH = 600906891;
+        static const int Delivery_HASH = 888111124;
 
 
         NotificationType GetNotificationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Bounce_HASH)
+          switch (hashCode)
           {
+          case Bounce_HASH:
             return NotificationType::Bounce;
-          }
-          else if (hashCode == Complaint_HASH)
-          {
+          case Complaint_HASH:
             return NotificationType::Complaint;
-          }
-          else if (hashCode == Delivery_HASH)
-          {
+          case Delivery_HASH:
             return NotificationType::Delivery;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
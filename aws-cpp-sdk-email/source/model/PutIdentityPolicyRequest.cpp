@@ -15,6 +15,7 @@
 #include <aws/email/model/PutIdentityPolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ PutIdentityPolicyRequest::PutIdentityPolicyRequest() :
 
 Aws::String PutIdentityPolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=PutIdentityPolicy&";
   if(m_identityHasBeenSet)
   {
-    ss << "Identity=" << StringUtils::URLEncode(m_identity.c_str()) << "&";
+    ss << "Identity=" << StringUtils::URLEncoded(m_identity) << "&";
   }
 
   if(m_policyNameHasBeenSet)
   {
-    ss << "PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+    ss << "PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
 
   if(m_policyHasBeenSet)
   {
-    ss << "Policy=" << StringUtils::URLEncode(m_policy.c_str()) << "&";
+    ss << "Policy=" << StringUtils::URLEncoded(m_policy) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
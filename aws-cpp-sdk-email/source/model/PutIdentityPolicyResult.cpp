@@ -40,7 +40,7 @@ PutIdentityPolicyResult& PutIdentityPolicyResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "PutIdentityPolicyResult")
+  if (rootNode.GetNameView() != "PutIdentityPolicyResult")
   {
     resultNode = rootNode.FirstChild("PutIdentityPolicyResult");
   }
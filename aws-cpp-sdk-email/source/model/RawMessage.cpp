@@ -50,7 +50,7 @@ RawMessage& RawMessage::operator =(const XmlNode& xmlNode)
     XmlNode dataNode = resultNode.FirstChild("Data");
     if(!dataNode.IsNull())
     {
-      m_data = HashingUtils::Base64Decode(StringUtils::Trim(dataNode.GetText().c_str()));
+      m_data = HashingUtils::Base64Decode(dataNode.GetTextView().Trim().ToString());
       m_dataHasBeenSet = true;
     }
   }
@@ -62,7 +62,7 @@ void RawMessage::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_dataHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Data=" << StringUtils::URLEncode(HashingUtils::Base64Encode(m_data).c_str()) << "&";
+      oStream << location << index << locationValue << ".Data=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(m_data)) << "&";
   }
 
 }
@@ -71,7 +71,7 @@ void RawMessage::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_dataHasBeenSet)
   {
-      oStream << location << ".Data=" << StringUtils::URLEncode(HashingUtils::Base64Encode(m_data).c_str()) << "&";
+      oStream << location << ".Data=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(m_data)) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -109,51 +110,51 @@ void ReceiptAction::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_s3ActionHasBeenSet)
   {
-      Aws::StringStream s3ActionLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream s3ActionLocationAndMemberSs;
       s3ActionLocationAndMemberSs << location << index << locationValue << ".S3Action";
-      m_s3Action.OutputToStream(oStream, s3ActionLocationAndMemberSs.str().c_str());
+      m_s3Action.OutputToStream(oStream, s3ActionLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_bounceActionHasBeenSet)
   {
-      Aws::StringStream bounceActionLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream bounceActionLocationAndMemberSs;
       bounceActionLocationAndMemberSs << location << index << locationValue << ".BounceAction";
-      m_bounceAction.OutputToStream(oStream, bounceActionLocationAndMemberSs.str().c_str());
+      m_bounceAction.OutputToStream(oStream, bounceActionLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_workmailActionHasBeenSet)
   {
-      Aws::StringStream workmailActionLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream workmailActionLocationAndMemberSs;
       workmailActionLocationAndMemberSs << location << index << locationValue << ".WorkmailAction";
-      m_workmailAction.OutputToStream(oStream, workmailActionLocationAndMemberSs.str().c_str());
+      m_workmailAction.OutputToStream(oStream, workmailActionLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_lambdaActionHasBeenSet)
   {
-      Aws::StringStream lambdaActionLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream lambdaActionLocationAndMemberSs;
       lambdaActionLocationAndMemberSs << location << index << locationValue << ".LambdaAction";
-      m_lambdaAction.OutputToStream(oStream, lambdaActionLocationAndMemberSs.str().c_str());
+      m_lambdaAction.OutputToStream(oStream, lambdaActionLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_stopActionHasBeenSet)
   {
-      Aws::StringStream stopActionLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream stopActionLocationAndMemberSs;
       stopActionLocationAndMemberSs << location << index << locationValue << ".StopAction";
-      m_stopAction.OutputToStream(oStream, stopActionLocationAndMemberSs.str().c_str());
+      m_stopAction.OutputToStream(oStream, stopActionLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_addHeaderActionHasBeenSet)
   {
-      Aws::StringStream addHeaderActionLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream addHeaderActionLocationAndMemberSs;
       addHeaderActionLocationAndMemberSs << location << index << locationValue << ".AddHeaderAction";
-      m_addHeaderAction.OutputToStream(oStream, addHeaderActionLocationAndMemberSs.str().c_str());
+      m_addHeaderAction.OutputToStream(oStream, addHeaderActionLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_sNSActionHasBeenSet)
   {
-      Aws::StringStream sNSActionLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream sNSActionLocationAndMemberSs;
       sNSActionLocationAndMemberSs << location << index << locationValue << ".SNSAction";
-      m_sNSAction.OutputToStream(oStream, sNSActionLocationAndMemberSs.str().c_str());
+      m_sNSAction.OutputToStream(oStream, sNSActionLocationAndMemberSs.GetString().c_str());
   }
 
 }
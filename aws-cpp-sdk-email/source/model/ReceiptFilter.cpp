@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ ReceiptFilter& ReceiptFilter::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode ipFilterNode = resultNode.FirstChild("IpFilter");
@@ -69,14 +70,14 @@ void ReceiptFilter::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_ipFilterHasBeenSet)
   {
-      Aws::StringStream ipFilterLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream ipFilterLocationAndMemberSs;
       ipFilterLocationAndMemberSs << location << index << locationValue << ".IpFilter";
-      m_ipFilter.OutputToStream(oStream, ipFilterLocationAndMemberSs.str().c_str());
+      m_ipFilter.OutputToStream(oStream, ipFilterLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -85,7 +86,7 @@ void ReceiptFilter::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_ipFilterHasBeenSet)
   {
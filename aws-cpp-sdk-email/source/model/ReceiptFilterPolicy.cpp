@@ -29,21 +29,29 @@ namespace Aws
       namespace ReceiptFilterPolicyMapper
       {
 
-        static const int Block_HASH = HashingUtils::HashString("Block");
-        static const int Allow_HASH = HashingUtils::HashString("Allow");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Block_HASH = 64279661;
+        static const int Allow_HASH = 63353641;
 
 
         ReceiptFilterPolicy GetReceiptFilterPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Block_HASH)
+          switch (hashCode)
           {
+          case Block_HASH:
             return ReceiptFilterPolicy::Block;
-          }
-          else if (hashCode == Allow_HASH)
-          {
+          case Allow_HASH:
             return ReceiptFilterPolicy::Allow;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
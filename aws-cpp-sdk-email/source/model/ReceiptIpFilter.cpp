@@ -51,13 +51,13 @@ ReceiptIpFilter& ReceiptIpFilter::operator =(const XmlNode& xmlNode)
     XmlNode policyNode = resultNode.FirstChild("Policy");
     if(!policyNode.IsNull())
     {
-      m_policy = ReceiptFilterPolicyMapper::GetReceiptFilterPolicyForName(StringUtils::Trim(policyNode.GetText().c_str()).c_str());
+      m_policy = ReceiptFilterPolicyMapper::GetReceiptFilterPolicyForName(policyNode.GetTextView().Trim().ToString().c_str());
       m_policyHasBeenSet = true;
     }
     XmlNode cidrNode = resultNode.FirstChild("Cidr");
     if(!cidrNode.IsNull())
     {
-      m_cidr = StringUtils::Trim(cidrNode.GetText().c_str());
+      m_cidr = cidrNode.GetTextView().Trim().ToString();
       m_cidrHasBeenSet = true;
     }
   }
@@ -74,7 +74,7 @@ void ReceiptIpFilter::OutputToStream(Aws::OStream& oStream, const char* location
 
   if(m_cidrHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Cidr=" << StringUtils::URLEncode(m_cidr.c_str()) << "&";
+      oStream << location << index << locationValue << ".Cidr=" << StringUtils::URLEncoded(m_cidr) << "&";
   }
 
 }
@@ -87,7 +87,7 @@ void ReceiptIpFilter::OutputToStream(Aws::OStream& oStream, const char* location
   }
   if(m_cidrHasBeenSet)
   {
-      oStream << location << ".Cidr=" << StringUtils::URLEncode(m_cidr.c_str()) << "&";
+      oStream << location << ".Cidr=" << StringUtils::URLEncoded(m_cidr) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -63,19 +64,19 @@ ReceiptRule& ReceiptRule::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode enabledNode = resultNode.FirstChild("Enabled");
     if(!enabledNode.IsNull())
     {
-      m_enabled = StringUtils::ConvertToBool(StringUtils::Trim(enabledNode.GetText().c_str()).c_str());
+      m_enabled = StringUtils::ConvertToBool(enabledNode.GetTextView().Trim().ToString().c_str());
       m_enabledHasBeenSet = true;
     }
     XmlNode tlsPolicyNode = resultNode.FirstChild("TlsPolicy");
     if(!tlsPolicyNode.IsNull())
     {
-      m_tlsPolicy = TlsPolicyMapper::GetTlsPolicyForName(StringUtils::Trim(tlsPolicyNode.GetText().c_str()).c_str());
+      m_tlsPolicy = TlsPolicyMapper::GetTlsPolicyForName(tlsPolicyNode.GetTextView().Trim().ToString().c_str());
       m_tlsPolicyHasBeenSet = true;
     }
     XmlNode recipientsNode = resultNode.FirstChild("Recipients");
@@ -84,7 +85,7 @@ ReceiptRule& ReceiptRule::operator =(const XmlNode& xmlNode)
       XmlNode recipientsMember = recipientsNode.FirstChild("member");
       while(!recipientsMember.IsNull())
       {
-        m_recipients.push_back(StringUtils::Trim(recipientsMember.GetText().c_str()));
+        m_recipients.push_back(recipientsMember.GetTextView().Trim().ToString());
         recipientsMember = recipientsMember.NextNode("member");
       }
 
@@ -105,7 +106,7 @@ ReceiptRule& ReceiptRule::operator =(const XmlNode& xmlNode)
     XmlNode scanEnabledNode = resultNode.FirstChild("ScanEnabled");
     if(!scanEnabledNode.IsNull())
     {
-      m_scanEnabled = StringUtils::ConvertToBool(StringUtils::Trim(scanEnabledNode.GetText().c_str()).c_str());
+      m_scanEnabled = StringUtils::ConvertToBool(scanEnabledNode.GetTextView().Trim().ToString().c_str());
       m_scanEnabledHasBeenSet = true;
     }
   }
@@ -117,7 +118,7 @@ void ReceiptRule::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_enabledHasBeenSet)
@@ -135,7 +136,7 @@ void ReceiptRule::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned recipientsIdx = 1;
       for(auto& item : m_recipients)
       {
-        oStream << location << index << locationValue << ".Recipients.member." << recipientsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".Recipients.member." << recipientsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -144,9 +145,9 @@ void ReceiptRule::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned actionsIdx = 1;
       for(auto& item : m_actions)
       {
-        Aws::StringStream actionsSs;
+        Aws::Utils::Stream::StringOutputStream actionsSs;
         actionsSs << location << index << locationValue << ".Actions.member." << actionsIdx++;
-        item.OutputToStream(oStream, actionsSs.str().c_str());
+        item.OutputToStream(oStream, actionsSs.GetString().c_str());
       }
   }
 
@@ -161,7 +162,7 @@ void ReceiptRule::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_enabledHasBeenSet)
   {
@@ -176,7 +177,7 @@ void ReceiptRule::OutputToStream(Aws::OStream& oStream, const char* location) co
       unsigned recipientsIdx = 1;
       for(auto& item : m_recipients)
       {
-        oStream << location << ".Recipients.member." << recipientsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".Recipients.member." << recipientsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_actionsHasBeenSet)
@@ -184,9 +185,9 @@ void ReceiptRule::OutputToStream(Aws::OStream& oStream, const char* location) co
       unsigned actionsIdx = 1;
       for(auto& item : m_actions)
       {
-        Aws::StringStream actionsSs;
+        Aws::Utils::Stream::StringOutputStream actionsSs;
         actionsSs << location <<  ".Actions.member." << actionsIdx++;
-        item.OutputToStream(oStream, actionsSs.str().c_str());
+        item.OutputToStream(oStream, actionsSs.GetString().c_str());
       }
   }
   if(m_scanEnabledHasBeenSet)
@@ -51,13 +51,13 @@ ReceiptRuleSetMetadata& ReceiptRuleSetMetadata::operator =(const XmlNode& xmlNod
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode createdTimestampNode = resultNode.FirstChild("CreatedTimestamp");
     if(!createdTimestampNode.IsNull())
     {
-      m_createdTimestamp = DateTime(StringUtils::Trim(createdTimestampNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createdTimestamp = DateTime(createdTimestampNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createdTimestampHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void ReceiptRuleSetMetadata::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_createdTimestampHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreatedTimestamp=" << StringUtils::URLEncode(m_createdTimestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreatedTimestamp=" << StringUtils::URLEncoded(m_createdTimestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void ReceiptRuleSetMetadata::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_createdTimestampHasBeenSet)
   {
-      oStream << location << ".CreatedTimestamp=" << StringUtils::URLEncode(m_createdTimestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreatedTimestamp=" << StringUtils::URLEncoded(m_createdTimestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
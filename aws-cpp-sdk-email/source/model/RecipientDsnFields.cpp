@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,37 +62,37 @@ RecipientDsnFields& RecipientDsnFields::operator =(const XmlNode& xmlNode)
     XmlNode finalRecipientNode = resultNode.FirstChild("FinalRecipient");
     if(!finalRecipientNode.IsNull())
     {
-      m_finalRecipient = StringUtils::Trim(finalRecipientNode.GetText().c_str());
+      m_finalRecipient = finalRecipientNode.GetTextView().Trim().ToString();
       m_finalRecipientHasBeenSet = true;
     }
     XmlNode actionNode = resultNode.FirstChild("Action");
     if(!actionNode.IsNull())
     {
-      m_action = DsnActionMapper::GetDsnActionForName(StringUtils::Trim(actionNode.GetText().c_str()).c_str());
+      m_action = DsnActionMapper::GetDsnActionForName(actionNode.GetTextView().Trim().ToString().c_str());
       m_actionHasBeenSet = true;
     }
     XmlNode remoteMtaNode = resultNode.FirstChild("RemoteMta");
     if(!remoteMtaNode.IsNull())
     {
-      m_remoteMta = StringUtils::Trim(remoteMtaNode.GetText().c_str());
+      m_remoteMta = remoteMtaNode.GetTextView().Trim().ToString();
       m_remoteMtaHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode diagnosticCodeNode = resultNode.FirstChild("DiagnosticCode");
     if(!diagnosticCodeNode.IsNull())
     {
-      m_diagnosticCode = StringUtils::Trim(diagnosticCodeNode.GetText().c_str());
+      m_diagnosticCode = diagnosticCodeNode.GetTextView().Trim().ToString();
       m_diagnosticCodeHasBeenSet = true;
     }
     XmlNode lastAttemptDateNode = resultNode.FirstChild("LastAttemptDate");
     if(!lastAttemptDateNode.IsNull())
     {
-      m_lastAttemptDate = DateTime(StringUtils::Trim(lastAttemptDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_lastAttemptDate = DateTime(lastAttemptDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_lastAttemptDateHasBeenSet = true;
     }
     XmlNode extensionFieldsNode = resultNode.FirstChild("ExtensionFields");
@@ -115,7 +116,7 @@ void RecipientDsnFields::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_finalRecipientHasBeenSet)
   {
-      oStream << location << index << locationValue << ".FinalRecipient=" << StringUtils::URLEncode(m_finalRecipient.c_str()) << "&";
+      oStream << location << index << locationValue << ".FinalRecipient=" << StringUtils::URLEncoded(m_finalRecipient) << "&";
   }
 
   if(m_actionHasBeenSet)
@@ -125,22 +126,22 @@ void RecipientDsnFields::OutputToStream(Aws::OStream& oStream, const char* locat
 
   if(m_remoteMtaHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RemoteMta=" << StringUtils::URLEncode(m_remoteMta.c_str()) << "&";
+      oStream << location << index << locationValue << ".RemoteMta=" << StringUtils::URLEncoded(m_remoteMta) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_diagnosticCodeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DiagnosticCode=" << StringUtils::URLEncode(m_diagnosticCode.c_str()) << "&";
+      oStream << location << index << locationValue << ".DiagnosticCode=" << StringUtils::URLEncoded(m_diagnosticCode) << "&";
   }
 
   if(m_lastAttemptDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LastAttemptDate=" << StringUtils::URLEncode(m_lastAttemptDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".LastAttemptDate=" << StringUtils::URLEncoded(m_lastAttemptDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_extensionFieldsHasBeenSet)
@@ -148,9 +149,9 @@ void RecipientDsnFields::OutputToStream(Aws::OStream& oStream, const char* locat
       unsigned extensionFieldsIdx = 1;
       for(auto& item : m_extensionFields)
       {
-        Aws::StringStream extensionFieldsSs;
+        Aws::Utils::Stream::StringOutputStream extensionFieldsSs;
         extensionFieldsSs << location << index << locationValue << ".ExtensionFields.member." << extensionFieldsIdx++;
-        item.OutputToStream(oStream, extensionFieldsSs.str().c_str());
+        item.OutputToStream(oStream, extensionFieldsSs.GetString().c_str());
       }
   }
 
@@ -160,7 +161,7 @@ void RecipientDsnFields::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_finalRecipientHasBeenSet)
   {
-      oStream << location << ".FinalRecipient=" << StringUtils::URLEncode(m_finalRecipient.c_str()) << "&";
+      oStream << location << ".FinalRecipient=" << StringUtils::URLEncoded(m_finalRecipient) << "&";
   }
   if(m_actionHasBeenSet)
   {
@@ -168,28 +169,28 @@ void RecipientDsnFields::OutputToStream(Aws::OStream& oStream, const char* locat
   }
   if(m_remoteMtaHasBeenSet)
   {
-      oStream << location << ".RemoteMta=" << StringUtils::URLEncode(m_remoteMta.c_str()) << "&";
+      oStream << location << ".RemoteMta=" << StringUtils::URLEncoded(m_remoteMta) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_diagnosticCodeHasBeenSet)
   {
-      oStream << location << ".DiagnosticCode=" << StringUtils::URLEncode(m_diagnosticCode.c_str()) << "&";
+      oStream << location << ".DiagnosticCode=" << StringUtils::URLEncoded(m_diagnosticCode) << "&";
   }
   if(m_lastAttemptDateHasBeenSet)
   {
-      oStream << location << ".LastAttemptDate=" << StringUtils::URLEncode(m_lastAttemptDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".LastAttemptDate=" << StringUtils::URLEncoded(m_lastAttemptDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_extensionFieldsHasBeenSet)
   {
       unsigned extensionFieldsIdx = 1;
       for(auto& item : m_extensionFields)
       {
-        Aws::StringStream extensionFieldsSs;
+        Aws::Utils::Stream::StringOutputStream extensionFieldsSs;
         extensionFieldsSs << location <<  ".ExtensionFields.member." << extensionFieldsIdx++;
-        item.OutputToStream(oStream, extensionFieldsSs.str().c_str());
+        item.OutputToStream(oStream, extensionFieldsSs.GetString().c_str());
       }
   }
 }
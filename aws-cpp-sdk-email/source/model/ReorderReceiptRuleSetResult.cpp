@@ -40,7 +40,7 @@ ReorderReceiptRuleSetResult& ReorderReceiptRuleSetResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ReorderReceiptRuleSetResult")
+  if (rootNode.GetNameView() != "ReorderReceiptRuleSetResult")
   {
     resultNode = rootNode.FirstChild("ReorderReceiptRuleSetResult");
   }
@@ -55,25 +55,25 @@ S3Action& S3Action::operator =(const XmlNode& xmlNode)
     XmlNode topicArnNode = resultNode.FirstChild("TopicArn");
     if(!topicArnNode.IsNull())
     {
-      m_topicArn = StringUtils::Trim(topicArnNode.GetText().c_str());
+      m_topicArn = topicArnNode.GetTextView().Trim().ToString();
       m_topicArnHasBeenSet = true;
     }
     XmlNode bucketNameNode = resultNode.FirstChild("BucketName");
     if(!bucketNameNode.IsNull())
     {
-      m_bucketName = StringUtils::Trim(bucketNameNode.GetText().c_str());
+      m_bucketName = bucketNameNode.GetTextView().Trim().ToString();
       m_bucketNameHasBeenSet = true;
     }
     XmlNode objectKeyPrefixNode = resultNode.FirstChild("ObjectKeyPrefix");
     if(!objectKeyPrefixNode.IsNull())
     {
-      m_objectKeyPrefix = StringUtils::Trim(objectKeyPrefixNode.GetText().c_str());
+      m_objectKeyPrefix = objectKeyPrefixNode.GetTextView().Trim().ToString();
       m_objectKeyPrefixHasBeenSet = true;
     }
     XmlNode kmsKeyArnNode = resultNode.FirstChild("KmsKeyArn");
     if(!kmsKeyArnNode.IsNull())
     {
-      m_kmsKeyArn = StringUtils::Trim(kmsKeyArnNode.GetText().c_str());
+      m_kmsKeyArn = kmsKeyArnNode.GetTextView().Trim().ToString();
       m_kmsKeyArnHasBeenSet = true;
     }
   }
@@ -85,22 +85,22 @@ void S3Action::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 {
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
   if(m_bucketNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".BucketName=" << StringUtils::URLEncode(m_bucketName.c_str()) << "&";
+      oStream << location << index << locationValue << ".BucketName=" << StringUtils::URLEncoded(m_bucketName) << "&";
   }
 
   if(m_objectKeyPrefixHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ObjectKeyPrefix=" << StringUtils::URLEncode(m_objectKeyPrefix.c_str()) << "&";
+      oStream << location << index << locationValue << ".ObjectKeyPrefix=" << StringUtils::URLEncoded(m_objectKeyPrefix) << "&";
   }
 
   if(m_kmsKeyArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KmsKeyArn=" << StringUtils::URLEncode(m_kmsKeyArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".KmsKeyArn=" << StringUtils::URLEncoded(m_kmsKeyArn) << "&";
   }
 
 }
@@ -109,19 +109,19 @@ void S3Action::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
   if(m_bucketNameHasBeenSet)
   {
-      oStream << location << ".BucketName=" << StringUtils::URLEncode(m_bucketName.c_str()) << "&";
+      oStream << location << ".BucketName=" << StringUtils::URLEncoded(m_bucketName) << "&";
   }
   if(m_objectKeyPrefixHasBeenSet)
   {
-      oStream << location << ".ObjectKeyPrefix=" << StringUtils::URLEncode(m_objectKeyPrefix.c_str()) << "&";
+      oStream << location << ".ObjectKeyPrefix=" << StringUtils::URLEncoded(m_objectKeyPrefix) << "&";
   }
   if(m_kmsKeyArnHasBeenSet)
   {
-      oStream << location << ".KmsKeyArn=" << StringUtils::URLEncode(m_kmsKeyArn.c_str()) << "&";
+      oStream << location << ".KmsKeyArn=" << StringUtils::URLEncoded(m_kmsKeyArn) << "&";
   }
 }
 
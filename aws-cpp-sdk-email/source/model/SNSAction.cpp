@@ -51,13 +51,13 @@ SNSAction& SNSAction::operator =(const XmlNode& xmlNode)
     XmlNode topicArnNode = resultNode.FirstChild("TopicArn");
     if(!topicArnNode.IsNull())
     {
-      m_topicArn = StringUtils::Trim(topicArnNode.GetText().c_str());
+      m_topicArn = topicArnNode.GetTextView().Trim().ToString();
       m_topicArnHasBeenSet = true;
     }
     XmlNode encodingNode = resultNode.FirstChild("Encoding");
     if(!encodingNode.IsNull())
     {
-      m_encoding = SNSActionEncodingMapper::GetSNSActionEncodingForName(StringUtils::Trim(encodingNode.GetText().c_str()).c_str());
+      m_encoding = SNSActionEncodingMapper::GetSNSActionEncodingForName(encodingNode.GetTextView().Trim().ToString().c_str());
       m_encodingHasBeenSet = true;
     }
   }
@@ -69,7 +69,7 @@ void SNSAction::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 {
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
   if(m_encodingHasBeenSet)
@@ -83,7 +83,7 @@ void SNSAction::OutputToStream(Aws::OStream& oStream, const char* location) cons
 {
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
   if(m_encodingHasBeenSet)
   {
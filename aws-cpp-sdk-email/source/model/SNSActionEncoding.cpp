@@ -29,21 +29,29 @@ namespace Aws
       namespace SNSActionEncodingMapper
       {
 
-        static const int UTF_8_HASH = HashingUtils::HashString("UTF-8");
-        static const int Base64_HASH = HashingUtils::HashString("Base64");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int UTF_8_HASH = 81070450;
+        static const int Base64_HASH = 1982630255;
 
 
         SNSActionEncoding GetSNSActionEncodingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UTF_8_HASH)
+          switch (hashCode)
           {
+          case UTF_8_HASH:
             return SNSActionEncoding::UTF_8;
-          }
-          else if (hashCode == Base64_HASH)
-          {
+          case Base64_HASH:
             return SNSActionEncoding::Base64;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -15,6 +15,7 @@
 #include <aws/email/model/SendBounceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -31,21 +32,21 @@ SendBounceRequest::SendBounceRequest() :
 
 Aws::String SendBounceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SendBounce&";
   if(m_originalMessageIdHasBeenSet)
   {
-    ss << "OriginalMessageId=" << StringUtils::URLEncode(m_originalMessageId.c_str()) << "&";
+    ss << "OriginalMessageId=" << StringUtils::URLEncoded(m_originalMessageId) << "&";
   }
 
   if(m_bounceSenderHasBeenSet)
   {
-    ss << "BounceSender=" << StringUtils::URLEncode(m_bounceSender.c_str()) << "&";
+    ss << "BounceSender=" << StringUtils::URLEncoded(m_bounceSender) << "&";
   }
 
   if(m_explanationHasBeenSet)
   {
-    ss << "Explanation=" << StringUtils::URLEncode(m_explanation.c_str()) << "&";
+    ss << "Explanation=" << StringUtils::URLEncoded(m_explanation) << "&";
   }
 
   if(m_messageDsnHasBeenSet)
@@ -65,10 +66,10 @@ Aws::String SendBounceRequest::SerializePayload() const
 
   if(m_bounceSenderArnHasBeenSet)
   {
-    ss << "BounceSenderArn=" << StringUtils::URLEncode(m_bounceSenderArn.c_str()) << "&";
+    ss << "BounceSenderArn=" << StringUtils::URLEncoded(m_bounceSenderArn) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
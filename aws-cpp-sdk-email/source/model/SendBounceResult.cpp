@@ -40,7 +40,7 @@ SendBounceResult& SendBounceResult::operator =(const AmazonWebServiceResult<XmlD
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SendBounceResult")
+  if (rootNode.GetNameView() != "SendBounceResult")
   {
     resultNode = rootNode.FirstChild("SendBounceResult");
   }
@@ -50,7 +50,7 @@ SendBounceResult& SendBounceResult::operator =(const AmazonWebServiceResult<XmlD
     XmlNode messageIdNode = resultNode.FirstChild("MessageId");
     if(!messageIdNode.IsNull())
     {
-      m_messageId = StringUtils::Trim(messageIdNode.GetText().c_str());
+      m_messageId = messageIdNode.GetTextView().Trim().ToString();
     }
   }
 
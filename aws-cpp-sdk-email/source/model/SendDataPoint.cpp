@@ -65,31 +65,31 @@ SendDataPoint& SendDataPoint::operator =(const XmlNode& xmlNode)
     XmlNode timestampNode = resultNode.FirstChild("Timestamp");
     if(!timestampNode.IsNull())
     {
-      m_timestamp = DateTime(StringUtils::Trim(timestampNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_timestamp = DateTime(timestampNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_timestampHasBeenSet = true;
     }
     XmlNode deliveryAttemptsNode = resultNode.FirstChild("DeliveryAttempts");
     if(!deliveryAttemptsNode.IsNull())
     {
-      m_deliveryAttempts = StringUtils::ConvertToInt64(StringUtils::Trim(deliveryAttemptsNode.GetText().c_str()).c_str());
+      m_deliveryAttempts = StringUtils::ConvertToInt64(deliveryAttemptsNode.GetTextView().Trim().ToString().c_str());
       m_deliveryAttemptsHasBeenSet = true;
     }
     XmlNode bouncesNode = resultNode.FirstChild("Bounces");
     if(!bouncesNode.IsNull())
     {
-      m_bounces = StringUtils::ConvertToInt64(StringUtils::Trim(bouncesNode.GetText().c_str()).c_str());
+      m_bounces = StringUtils::ConvertToInt64(bouncesNode.GetTextView().Trim().ToString().c_str());
       m_bouncesHasBeenSet = true;
     }
     XmlNode complaintsNode = resultNode.FirstChild("Complaints");
     if(!complaintsNode.IsNull())
     {
-      m_complaints = StringUtils::ConvertToInt64(StringUtils::Trim(complaintsNode.GetText().c_str()).c_str());
+      m_complaints = StringUtils::ConvertToInt64(complaintsNode.GetTextView().Trim().ToString().c_str());
       m_complaintsHasBeenSet = true;
     }
     XmlNode rejectsNode = resultNode.FirstChild("Rejects");
     if(!rejectsNode.IsNull())
     {
-      m_rejects = StringUtils::ConvertToInt64(StringUtils::Trim(rejectsNode.GetText().c_str()).c_str());
+      m_rejects = StringUtils::ConvertToInt64(rejectsNode.GetTextView().Trim().ToString().c_str());
       m_rejectsHasBeenSet = true;
     }
   }
@@ -101,7 +101,7 @@ void SendDataPoint::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_timestampHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Timestamp=" << StringUtils::URLEncode(m_timestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".Timestamp=" << StringUtils::URLEncoded(m_timestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_deliveryAttemptsHasBeenSet)
@@ -130,7 +130,7 @@ void SendDataPoint::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_timestampHasBeenSet)
   {
-      oStream << location << ".Timestamp=" << StringUtils::URLEncode(m_timestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".Timestamp=" << StringUtils::URLEncoded(m_timestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_deliveryAttemptsHasBeenSet)
   {
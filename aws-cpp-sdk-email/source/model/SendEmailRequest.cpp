@@ -15,6 +15,7 @@
 #include <aws/email/model/SendEmailRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -32,11 +33,11 @@ SendEmailRequest::SendEmailRequest() :
 
 Aws::String SendEmailRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SendEmail&";
   if(m_sourceHasBeenSet)
   {
-    ss << "Source=" << StringUtils::URLEncode(m_source.c_str()) << "&";
+    ss << "Source=" << StringUtils::URLEncoded(m_source) << "&";
   }
 
   if(m_destinationHasBeenSet)
@@ -55,27 +56,27 @@ Aws::String SendEmailRequest::SerializePayload() const
     for(auto& item : m_replyToAddresses)
     {
       ss << "ReplyToAddresses.member." << replyToAddressesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       replyToAddressesCount++;
     }
   }
 
   if(m_returnPathHasBeenSet)
   {
-    ss << "ReturnPath=" << StringUtils::URLEncode(m_returnPath.c_str()) << "&";
+    ss << "ReturnPath=" << StringUtils::URLEncoded(m_returnPath) << "&";
   }
 
   if(m_sourceArnHasBeenSet)
   {
-    ss << "SourceArn=" << StringUtils::URLEncode(m_sourceArn.c_str()) << "&";
+    ss << "SourceArn=" << StringUtils::URLEncoded(m_sourceArn) << "&";
   }
 
   if(m_returnPathArnHasBeenSet)
   {
-    ss << "ReturnPathArn=" << StringUtils::URLEncode(m_returnPathArn.c_str()) << "&";
+    ss << "ReturnPathArn=" << StringUtils::URLEncoded(m_returnPathArn) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
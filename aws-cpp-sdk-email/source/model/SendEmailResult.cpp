@@ -40,7 +40,7 @@ SendEmailResult& SendEmailResult::operator =(const AmazonWebServiceResult<XmlDoc
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SendEmailResult")
+  if (rootNode.GetNameView() != "SendEmailResult")
   {
     resultNode = rootNode.FirstChild("SendEmailResult");
   }
@@ -50,7 +50,7 @@ SendEmailResult& SendEmailResult::operator =(const AmazonWebServiceResult<XmlDoc
     XmlNode messageIdNode = resultNode.FirstChild("MessageId");
     if(!messageIdNode.IsNull())
     {
-      m_messageId = StringUtils::Trim(messageIdNode.GetText().c_str());
+      m_messageId = messageIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/email/model/SendRawEmailRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -31,11 +32,11 @@ SendRawEmailRequest::SendRawEmailRequest() :
 
 Aws::String SendRawEmailRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SendRawEmail&";
   if(m_sourceHasBeenSet)
   {
-    ss << "Source=" << StringUtils::URLEncode(m_source.c_str()) << "&";
+    ss << "Source=" << StringUtils::URLEncoded(m_source) << "&";
   }
 
   if(m_destinationsHasBeenSet)
@@ -44,7 +45,7 @@ Aws::String SendRawEmailRequest::SerializePayload() const
     for(auto& item : m_destinations)
     {
       ss << "Destinations.member." << destinationsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       destinationsCount++;
     }
   }
@@ -56,20 +57,20 @@ Aws::String SendRawEmailRequest::SerializePayload() const
 
   if(m_fromArnHasBeenSet)
   {
-    ss << "FromArn=" << StringUtils::URLEncode(m_fromArn.c_str()) << "&";
+    ss << "FromArn=" << StringUtils::URLEncoded(m_fromArn) << "&";
   }
 
   if(m_sourceArnHasBeenSet)
   {
-    ss << "SourceArn=" << StringUtils::URLEncode(m_sourceArn.c_str()) << "&";
+    ss << "SourceArn=" << StringUtils::URLEncoded(m_sourceArn) << "&";
   }
 
   if(m_returnPathArnHasBeenSet)
   {
-    ss << "ReturnPathArn=" << StringUtils::URLEncode(m_returnPathArn.c_str()) << "&";
+    ss << "ReturnPathArn=" << StringUtils::URLEncoded(m_returnPathArn) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
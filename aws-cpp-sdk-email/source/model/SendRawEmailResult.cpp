@@ -40,7 +40,7 @@ SendRawEmailResult& SendRawEmailResult::operator =(const AmazonWebServiceResult<
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SendRawEmailResult")
+  if (rootNode.GetNameView() != "SendRawEmailResult")
   {
     resultNode = rootNode.FirstChild("SendRawEmailResult");
   }
@@ -50,7 +50,7 @@ SendRawEmailResult& SendRawEmailResult::operator =(const AmazonWebServiceResult<
     XmlNode messageIdNode = resultNode.FirstChild("MessageId");
     if(!messageIdNode.IsNull())
     {
-      m_messageId = StringUtils::Trim(messageIdNode.GetText().c_str());
+      m_messageId = messageIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ SetActiveReceiptRuleSetResult& SetActiveReceiptRuleSetResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SetActiveReceiptRuleSetResult")
+  if (rootNode.GetNameView() != "SetActiveReceiptRuleSetResult")
   {
     resultNode = rootNode.FirstChild("SetActiveReceiptRuleSetResult");
   }
@@ -40,7 +40,7 @@ SetIdentityDkimEnabledResult& SetIdentityDkimEnabledResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SetIdentityDkimEnabledResult")
+  if (rootNode.GetNameView() != "SetIdentityDkimEnabledResult")
   {
     resultNode = rootNode.FirstChild("SetIdentityDkimEnabledResult");
   }
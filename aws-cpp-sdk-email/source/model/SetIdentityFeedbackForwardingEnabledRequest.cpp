@@ -15,6 +15,7 @@
 #include <aws/email/model/SetIdentityFeedbackForwardingEnabledRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -28,11 +29,11 @@ SetIdentityFeedbackForwardingEnabledRequest::SetIdentityFeedbackForwardingEnable
 
 Aws::String SetIdentityFeedbackForwardingEnabledRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SetIdentityFeedbackForwardingEnabled&";
   if(m_identityHasBeenSet)
   {
-    ss << "Identity=" << StringUtils::URLEncode(m_identity.c_str()) << "&";
+    ss << "Identity=" << StringUtils::URLEncoded(m_identity) << "&";
   }
 
   if(m_forwardingEnabledHasBeenSet)
@@ -41,6 +42,6 @@ Aws::String SetIdentityFeedbackForwardingEnabledRequest::SerializePayload() cons
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ SetIdentityFeedbackForwardingEnabledResult& SetIdentityFeedbackForwardingEnabled
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SetIdentityFeedbackForwardingEnabledResult")
+  if (rootNode.GetNameView() != "SetIdentityFeedbackForwardingEnabledResult")
   {
     resultNode = rootNode.FirstChild("SetIdentityFeedbackForwardingEnabledResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/email/model/SetIdentityHeadersInNotificationsEnabledRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -29,11 +30,11 @@ SetIdentityHeadersInNotificationsEnabledRequest::SetIdentityHeadersInNotificatio
 
 Aws::String SetIdentityHeadersInNotificationsEnabledRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SetIdentityHeadersInNotificationsEnabled&";
   if(m_identityHasBeenSet)
   {
-    ss << "Identity=" << StringUtils::URLEncode(m_identity.c_str()) << "&";
+    ss << "Identity=" << StringUtils::URLEncoded(m_identity) << "&";
   }
 
   if(m_notificationTypeHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String SetIdentityHeadersInNotificationsEnabledRequest::SerializePayload()
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
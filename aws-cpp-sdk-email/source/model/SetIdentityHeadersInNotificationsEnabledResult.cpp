@@ -40,7 +40,7 @@ SetIdentityHeadersInNotificationsEnabledResult& SetIdentityHeadersInNotification
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SetIdentityHeadersInNotificationsEnabledResult")
+  if (rootNode.GetNameView() != "SetIdentityHeadersInNotificationsEnabledResult")
   {
     resultNode = rootNode.FirstChild("SetIdentityHeadersInNotificationsEnabledResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/email/model/SetIdentityMailFromDomainRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ SetIdentityMailFromDomainRequest::SetIdentityMailFromDomainRequest() :
 
 Aws::String SetIdentityMailFromDomainRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SetIdentityMailFromDomain&";
   if(m_identityHasBeenSet)
   {
-    ss << "Identity=" << StringUtils::URLEncode(m_identity.c_str()) << "&";
+    ss << "Identity=" << StringUtils::URLEncoded(m_identity) << "&";
   }
 
   if(m_mailFromDomainHasBeenSet)
   {
-    ss << "MailFromDomain=" << StringUtils::URLEncode(m_mailFromDomain.c_str()) << "&";
+    ss << "MailFromDomain=" << StringUtils::URLEncoded(m_mailFromDomain) << "&";
   }
 
   if(m_behaviorOnMXFailureHasBeenSet)
@@ -46,6 +47,6 @@ Aws::String SetIdentityMailFromDomainRequest::SerializePayload() const
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
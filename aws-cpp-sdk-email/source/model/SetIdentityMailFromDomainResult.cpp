@@ -40,7 +40,7 @@ SetIdentityMailFromDomainResult& SetIdentityMailFromDomainResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SetIdentityMailFromDomainResult")
+  if (rootNode.GetNameView() != "SetIdentityMailFromDomainResult")
   {
     resultNode = rootNode.FirstChild("SetIdentityMailFromDomainResult");
   }
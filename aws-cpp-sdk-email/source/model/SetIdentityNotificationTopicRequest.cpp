@@ -15,6 +15,7 @@
 #include <aws/email/model/SetIdentityNotificationTopicRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -28,11 +29,11 @@ SetIdentityNotificationTopicRequest::SetIdentityNotificationTopicRequest() :
 
 Aws::String SetIdentityNotificationTopicRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SetIdentityNotificationTopic&";
   if(m_identityHasBeenSet)
   {
-    ss << "Identity=" << StringUtils::URLEncode(m_identity.c_str()) << "&";
+    ss << "Identity=" << StringUtils::URLEncoded(m_identity) << "&";
   }
 
   if(m_notificationTypeHasBeenSet)
@@ -42,10 +43,10 @@ Aws::String SetIdentityNotificationTopicRequest::SerializePayload() const
 
   if(m_snsTopicHasBeenSet)
   {
-    ss << "SnsTopic=" << StringUtils::URLEncode(m_snsTopic.c_str()) << "&";
+    ss << "SnsTopic=" << StringUtils::URLEncoded(m_snsTopic) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
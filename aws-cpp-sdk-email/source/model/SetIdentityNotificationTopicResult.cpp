@@ -40,7 +40,7 @@ SetIdentityNotificationTopicResult& SetIdentityNotificationTopicResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SetIdentityNotificationTopicResult")
+  if (rootNode.GetNameView() != "SetIdentityNotificationTopicResult")
   {
     resultNode = rootNode.FirstChild("SetIdentityNotificationTopicResult");
   }
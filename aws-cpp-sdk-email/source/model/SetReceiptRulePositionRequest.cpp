@@ -15,6 +15,7 @@
 #include <aws/email/model/SetReceiptRulePositionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ SetReceiptRulePositionRequest::SetReceiptRulePositionRequest() :
 
 Aws::String SetReceiptRulePositionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SetReceiptRulePosition&";
   if(m_ruleSetNameHasBeenSet)
   {
-    ss << "RuleSetName=" << StringUtils::URLEncode(m_ruleSetName.c_str()) << "&";
+    ss << "RuleSetName=" << StringUtils::URLEncoded(m_ruleSetName) << "&";
   }
 
   if(m_ruleNameHasBeenSet)
   {
-    ss << "RuleName=" << StringUtils::URLEncode(m_ruleName.c_str()) << "&";
+    ss << "RuleName=" << StringUtils::URLEncoded(m_ruleName) << "&";
   }
 
   if(m_afterHasBeenSet)
   {
-    ss << "After=" << StringUtils::URLEncode(m_after.c_str()) << "&";
+    ss << "After=" << StringUtils::URLEncoded(m_after) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
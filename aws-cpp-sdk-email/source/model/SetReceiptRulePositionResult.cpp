@@ -40,7 +40,7 @@ SetReceiptRulePositionResult& SetReceiptRulePositionResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SetReceiptRulePositionResult")
+  if (rootNode.GetNameView() != "SetReceiptRulePositionResult")
   {
     resultNode = rootNode.FirstChild("SetReceiptRulePositionResult");
   }
@@ -29,16 +29,26 @@ namespace Aws
       namespace StopScopeMapper
       {
 
-        static const int RuleSet_HASH = HashingUtils::HashString("RuleSet");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int RuleSet_HASH = -1081666650;
 
 
         StopScope GetStopScopeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RuleSet_HASH)
+          switch (hashCode)
           {
+          case RuleSet_HASH:
             return StopScope::RuleSet;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
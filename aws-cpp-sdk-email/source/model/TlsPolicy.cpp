@@ -29,21 +29,29 @@ namespace Aws
       namespace TlsPolicyMapper
       {
 
-        static const int Require_HASH = HashingUtils::HashString("Require");
-        static const int Optional_HASH = HashingUtils::HashString("Optional");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Require_HASH = -1534617275;
+        static const int Optional_HASH = -14372992;
 
 
         TlsPolicy GetTlsPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Require_HASH)
+          switch (hashCode)
           {
+          case Require_HASH:
             return TlsPolicy::Require;
-          }
-          else if (hashCode == Optional_HASH)
-          {
+          case Optional_HASH:
             return TlsPolicy::Optional;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -40,7 +40,7 @@ UpdateReceiptRuleResult& UpdateReceiptRuleResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "UpdateReceiptRuleResult")
+  if (rootNode.GetNameView() != "UpdateReceiptRuleResult")
   {
     resultNode = rootNode.FirstChild("UpdateReceiptRuleResult");
   }
@@ -40,7 +40,7 @@ VerifyDomainDkimResult& VerifyDomainDkimResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "VerifyDomainDkimResult")
+  if (rootNode.GetNameView() != "VerifyDomainDkimResult")
   {
     resultNode = rootNode.FirstChild("VerifyDomainDkimResult");
   }
@@ -53,7 +53,7 @@ VerifyDomainDkimResult& VerifyDomainDkimResult::operator =(const AmazonWebServic
       XmlNode dkimTokensMember = dkimTokensNode.FirstChild("member");
       while(!dkimTokensMember.IsNull())
       {
-        m_dkimTokens.push_back(StringUtils::Trim(dkimTokensMember.GetText().c_str()));
+        m_dkimTokens.push_back(dkimTokensMember.GetTextView().Trim().ToString());
         dkimTokensMember = dkimTokensMember.NextNode("member");
       }
 
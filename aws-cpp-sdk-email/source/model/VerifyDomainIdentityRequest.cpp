@@ -15,6 +15,7 @@
 #include <aws/email/model/VerifyDomainIdentityRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SES::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ VerifyDomainIdentityRequest::VerifyDomainIdentityRequest() :
 
 Aws::String VerifyDomainIdentityRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=VerifyDomainIdentity&";
   if(m_domainHasBeenSet)
   {
-    ss << "Domain=" << StringUtils::URLEncode(m_domain.c_str()) << "&";
+    ss << "Domain=" << StringUtils::URLEncoded(m_domain) << "&";
   }
 
   ss << "Version=2010-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
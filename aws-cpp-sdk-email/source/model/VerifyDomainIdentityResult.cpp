@@ -40,7 +40,7 @@ VerifyDomainIdentityResult& VerifyDomainIdentityResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "VerifyDomainIdentityResult")
+  if (rootNode.GetNameView() != "VerifyDomainIdentityResult")
   {
     resultNode = rootNode.FirstChild("VerifyDomainIdentityResult");
   }
@@ -50,7 +50,7 @@ VerifyDomainIdentityResult& VerifyDomainIdentityResult::operator =(const AmazonW
     XmlNode verificationTokenNode = resultNode.FirstChild("VerificationToken");
     if(!verificationTokenNode.IsNull())
     {
-      m_verificationToken = StringUtils::Trim(verificationTokenNode.GetText().c_str());
+      m_verificationToken = verificationTokenNode.GetTextView().Trim().ToString();
     }
   }
 
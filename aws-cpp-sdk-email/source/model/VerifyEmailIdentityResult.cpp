@@ -40,7 +40,7 @@ VerifyEmailIdentityResult& VerifyEmailIdentityResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "VerifyEmailIdentityResult")
+  if (rootNode.GetNameView() != "VerifyEmailIdentityResult")
   {
     resultNode = rootNode.FirstChild("VerifyEmailIdentityResult");
   }
@@ -51,13 +51,13 @@ WorkmailAction& WorkmailAction::operator =(const XmlNode& xmlNode)
     XmlNode topicArnNode = resultNode.FirstChild("TopicArn");
     if(!topicArnNode.IsNull())
     {
-      m_topicArn = StringUtils::Trim(topicArnNode.GetText().c_str());
+      m_topicArn = topicArnNode.GetTextView().Trim().ToString();
       m_topicArnHasBeenSet = true;
     }
     XmlNode organizationArnNode = resultNode.FirstChild("OrganizationArn");
     if(!organizationArnNode.IsNull())
     {
-      m_organizationArn = StringUtils::Trim(organizationArnNode.GetText().c_str());
+      m_organizationArn = organizationArnNode.GetTextView().Trim().ToString();
       m_organizationArnHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void WorkmailAction::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
   if(m_organizationArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OrganizationArn=" << StringUtils::URLEncode(m_organizationArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".OrganizationArn=" << StringUtils::URLEncoded(m_organizationArn) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void WorkmailAction::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
   if(m_organizationArnHasBeenSet)
   {
-      oStream << location << ".OrganizationArn=" << StringUtils::URLEncode(m_organizationArn.c_str()) << "&";
+      oStream << location << ".OrganizationArn=" << StringUtils::URLEncoded(m_organizationArn) << "&";
   }
 }
 
@@ -30,6 +30,9 @@
 #include <aws/es/model/UpdateElasticsearchDomainConfigResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -190,6 +193,18 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsCallable(const Model::AddTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsOutcomeCallable AddTagsCallable(Model::AddTagsRequest&& request) const;
+
+        /**
+         * Same as AddTagsAsync(const Model::AddTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsAsync(Model::AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new Elasticsearch domain. For more information, see <a
          * href="http://docs.aws.amazon.com/elasticsearch-service/latest/developerguide/es-createupdatedomains.html#es-createdomains"
@@ -218,6 +233,18 @@ namespace Model
          */
         virtual void CreateElasticsearchDomainAsync(const Model::CreateElasticsearchDomainRequest& request, const CreateElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateElasticsearchDomainCallable(const Model::CreateElasticsearchDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateElasticsearchDomainOutcomeCallable CreateElasticsearchDomainCallable(Model::CreateElasticsearchDomainRequest&& request) const;
+
+        /**
+         * Same as CreateElasticsearchDomainAsync(const Model::CreateElasticsearchDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateElasticsearchDomainAsync(Model::CreateElasticsearchDomainRequest&& request, const CreateElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes the specified Elasticsearch domain and all of its data.
          * Once a domain is deleted, it cannot be recovered.</p>
@@ -240,6 +267,18 @@ namespace Model
          */
         virtual void DeleteElasticsearchDomainAsync(const Model::DeleteElasticsearchDomainRequest& request, const DeleteElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteElasticsearchDomainCallable(const Model::DeleteElasticsearchDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteElasticsearchDomainOutcomeCallable DeleteElasticsearchDomainCallable(Model::DeleteElasticsearchDomainRequest&& request) const;
+
+        /**
+         * Same as DeleteElasticsearchDomainAsync(const Model::DeleteElasticsearchDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteElasticsearchDomainAsync(Model::DeleteElasticsearchDomainRequest&& request, const DeleteElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns domain configuration information about the specified Elasticsearch
          * domain, including the domain ID, domain endpoint, and domain ARN.</p>
@@ -262,6 +301,18 @@ namespace Model
          */
         virtual void DescribeElasticsearchDomainAsync(const Model::DescribeElasticsearchDomainRequest& request, const DescribeElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeElasticsearchDomainCallable(const Model::DescribeElasticsearchDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeElasticsearchDomainOutcomeCallable DescribeElasticsearchDomainCallable(Model::DescribeElasticsearchDomainRequest&& request) const;
+
+        /**
+         * Same as DescribeElasticsearchDomainAsync(const Model::DescribeElasticsearchDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeElasticsearchDomainAsync(Model::DescribeElasticsearchDomainRequest&& request, const DescribeElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides cluster configuration information about the specified Elasticsearch
          * domain, such as the state, creation date, update version, and update date for
@@ -287,6 +338,18 @@ namespace Model
          */
         virtual void DescribeElasticsearchDomainConfigAsync(const Model::DescribeElasticsearchDomainConfigRequest& request, const DescribeElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeElasticsearchDomainConfigCallable(const Model::DescribeElasticsearchDomainConfigRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeElasticsearchDomainConfigOutcomeCallable DescribeElasticsearchDomainConfigCallable(Model::DescribeElasticsearchDomainConfigRequest&& request) const;
+
+        /**
+         * Same as DescribeElasticsearchDomainConfigAsync(const Model::DescribeElasticsearchDomainConfigRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeElasticsearchDomainConfigAsync(Model::DescribeElasticsearchDomainConfigRequest&& request, const DescribeElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns domain configuration information about the specified Elasticsearch
          * domains, including the domain ID, domain endpoint, and domain ARN.</p>
@@ -309,6 +372,18 @@ namespace Model
          */
         virtual void DescribeElasticsearchDomainsAsync(const Model::DescribeElasticsearchDomainsRequest& request, const DescribeElasticsearchDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeElasticsearchDomainsCallable(const Model::DescribeElasticsearchDomainsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeElasticsearchDomainsOutcomeCallable DescribeElasticsearchDomainsCallable(Model::DescribeElasticsearchDomainsRequest&& request) const;
+
+        /**
+         * Same as DescribeElasticsearchDomainsAsync(const Model::DescribeElasticsearchDomainsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeElasticsearchDomainsAsync(Model::DescribeElasticsearchDomainsRequest&& request, const DescribeElasticsearchDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the name of all Elasticsearch domains owned by the current user's
          * account. </p>
@@ -349,6 +424,18 @@ namespace Model
          */
         virtual void ListTagsAsync(const Model::ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsCallable(const Model::ListTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsOutcomeCallable ListTagsCallable(Model::ListTagsRequest&& request) const;
+
+        /**
+         * Same as ListTagsAsync(const Model::ListTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsAsync(Model::ListTagsRequest&& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified set of tags from the specified Elasticsearch
          * domain.</p>
@@ -371,6 +458,18 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsCallable(const Model::RemoveTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(Model::RemoveTagsRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsAsync(const Model::RemoveTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsAsync(Model::RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the cluster configuration of the specified Elasticsearch domain,
          * setting as setting the instance type and the number of instances. </p>
@@ -393,6 +492,70 @@ namespace Model
          */
         virtual void UpdateElasticsearchDomainConfigAsync(const Model::UpdateElasticsearchDomainConfigRequest& request, const UpdateElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateElasticsearchDomainConfigCallable(const Model::UpdateElasticsearchDomainConfigRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateElasticsearchDomainConfigOutcomeCallable UpdateElasticsearchDomainConfigCallable(Model::UpdateElasticsearchDomainConfigRequest&& request) const;
+
+        /**
+         * Same as UpdateElasticsearchDomainConfigAsync(const Model::UpdateElasticsearchDomainConfigRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateElasticsearchDomainConfigAsync(Model::UpdateElasticsearchDomainConfigRequest&& request, const UpdateElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticsearchServiceClient, Model::AddTagsRequest, Model::AddTagsOutcome> AddTagsAwaitable(Model::AddTagsRequest request) const;
+
+        /**
+         * co_await-able form of CreateElasticsearchDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticsearchServiceClient, Model::CreateElasticsearchDomainRequest, Model::CreateElasticsearchDomainOutcome> CreateElasticsearchDomainAwaitable(Model::CreateElasticsearchDomainRequest request) const;
+
+        /**
+         * co_await-able form of DeleteElasticsearchDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticsearchServiceClient, Model::DeleteElasticsearchDomainRequest, Model::DeleteElasticsearchDomainOutcome> DeleteElasticsearchDomainAwaitable(Model::DeleteElasticsearchDomainRequest request) const;
+
+        /**
+         * co_await-able form of DescribeElasticsearchDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticsearchServiceClient, Model::DescribeElasticsearchDomainRequest, Model::DescribeElasticsearchDomainOutcome> DescribeElasticsearchDomainAwaitable(Model::DescribeElasticsearchDomainRequest request) const;
+
+        /**
+         * co_await-able form of DescribeElasticsearchDomainConfig(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticsearchServiceClient, Model::DescribeElasticsearchDomainConfigRequest, Model::DescribeElasticsearchDomainConfigOutcome> DescribeElasticsearchDomainConfigAwaitable(Model::DescribeElasticsearchDomainConfigRequest request) const;
+
+        /**
+         * co_await-able form of DescribeElasticsearchDomains(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticsearchServiceClient, Model::DescribeElasticsearchDomainsRequest, Model::DescribeElasticsearchDomainsOutcome> DescribeElasticsearchDomainsAwaitable(Model::DescribeElasticsearchDomainsRequest request) const;
+
+        /**
+         * co_await-able form of ListDomainNames(): the operation runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticsearchServiceClient, void, Model::ListDomainNamesOutcome> ListDomainNamesAwaitable() const;
+
+        /**
+         * co_await-able form of ListTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticsearchServiceClient, Model::ListTagsRequest, Model::ListTagsOutcome> ListTagsAwaitable(Model::ListTagsRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticsearchServiceClient, Model::RemoveTagsRequest, Model::RemoveTagsOutcome> RemoveTagsAwaitable(Model::RemoveTagsRequest request) const;
+
+        /**
+         * co_await-able form of UpdateElasticsearchDomainConfig(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ElasticsearchServiceClient, Model::UpdateElasticsearchDomainConfigRequest, Model::UpdateElasticsearchDomainConfigOutcome> UpdateElasticsearchDomainConfigAwaitable(Model::UpdateElasticsearchDomainConfigRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
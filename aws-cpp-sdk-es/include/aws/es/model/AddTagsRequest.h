@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     AddTagsRequest();
+    inline const char* GetServiceRequestName() const override { return "AddTags"; }
+
     Aws::String SerializePayload() const override;
 
     /**
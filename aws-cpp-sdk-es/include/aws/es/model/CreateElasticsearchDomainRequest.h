@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateElasticsearchDomainRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateElasticsearchDomain"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DeleteElasticsearchDomainRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteElasticsearchDomain"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeElasticsearchDomainConfigRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeElasticsearchDomainConfig"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeElasticsearchDomainRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeElasticsearchDomain"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     DescribeElasticsearchDomainsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeElasticsearchDomains"; }
+
     Aws::String SerializePayload() const override;
 
     /**
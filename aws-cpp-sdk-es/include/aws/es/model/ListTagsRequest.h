@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     ListTagsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTags"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
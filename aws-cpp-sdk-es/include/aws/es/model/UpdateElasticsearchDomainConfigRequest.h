@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     UpdateElasticsearchDomainConfigRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateElasticsearchDomainConfig"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -118,7 +118,7 @@ AddTagsOutcome ElasticsearchServiceClient::AddTags(const AddTagsRequest& request
 
 AddTagsOutcomeCallable ElasticsearchServiceClient::AddTagsCallable(const AddTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTags(request); } );
 }
 
 void ElasticsearchServiceClient::AddTagsAsync(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -126,6 +126,16 @@ void ElasticsearchServiceClient::AddTagsAsync(const AddTagsRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsOutcomeCallable ElasticsearchServiceClient::AddTagsCallable(AddTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticsearchServiceClient::AddTags, this, std::move(request)));
+}
+
+void ElasticsearchServiceClient::AddTagsAsync(AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticsearchServiceClient::AddTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticsearchServiceClient::AddTagsAsyncHelper(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTags(request), context);
@@ -149,7 +159,7 @@ CreateElasticsearchDomainOutcome ElasticsearchServiceClient::CreateElasticsearch
 
 CreateElasticsearchDomainOutcomeCallable ElasticsearchServiceClient::CreateElasticsearchDomainCallable(const CreateElasticsearchDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateElasticsearchDomain(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateElasticsearchDomain(request); } );
 }
 
 void ElasticsearchServiceClient::CreateElasticsearchDomainAsync(const CreateElasticsearchDomainRequest& request, const CreateElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -157,6 +167,16 @@ void ElasticsearchServiceClient::CreateElasticsearchDomainAsync(const CreateElas
   m_executor->Submit( [this, request, handler, context](){ this->CreateElasticsearchDomainAsyncHelper( request, handler, context ); } );
 }
 
+CreateElasticsearchDomainOutcomeCallable ElasticsearchServiceClient::CreateElasticsearchDomainCallable(CreateElasticsearchDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticsearchServiceClient::CreateElasticsearchDomain, this, std::move(request)));
+}
+
+void ElasticsearchServiceClient::CreateElasticsearchDomainAsync(CreateElasticsearchDomainRequest&& request, const CreateElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticsearchServiceClient::CreateElasticsearchDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticsearchServiceClient::CreateElasticsearchDomainAsyncHelper(const CreateElasticsearchDomainRequest& request, const CreateElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateElasticsearchDomain(request), context);
@@ -181,7 +201,7 @@ DeleteElasticsearchDomainOutcome ElasticsearchServiceClient::DeleteElasticsearch
 
 DeleteElasticsearchDomainOutcomeCallable ElasticsearchServiceClient::DeleteElasticsearchDomainCallable(const DeleteElasticsearchDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteElasticsearchDomain(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteElasticsearchDomain(request); } );
 }
 
 void ElasticsearchServiceClient::DeleteElasticsearchDomainAsync(const DeleteElasticsearchDomainRequest& request, const DeleteElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -189,6 +209,16 @@ void ElasticsearchServiceClient::DeleteElasticsearchDomainAsync(const DeleteElas
   m_executor->Submit( [this, request, handler, context](){ this->DeleteElasticsearchDomainAsyncHelper( request, handler, context ); } );
 }
 
+DeleteElasticsearchDomainOutcomeCallable ElasticsearchServiceClient::DeleteElasticsearchDomainCallable(DeleteElasticsearchDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticsearchServiceClient::DeleteElasticsearchDomain, this, std::move(request)));
+}
+
+void ElasticsearchServiceClient::DeleteElasticsearchDomainAsync(DeleteElasticsearchDomainRequest&& request, const DeleteElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticsearchServiceClient::DeleteElasticsearchDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticsearchServiceClient::DeleteElasticsearchDomainAsyncHelper(const DeleteElasticsearchDomainRequest& request, const DeleteElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteElasticsearchDomain(request), context);
@@ -213,7 +243,7 @@ DescribeElasticsearchDomainOutcome ElasticsearchServiceClient::DescribeElasticse
 
 DescribeElasticsearchDomainOutcomeCallable ElasticsearchServiceClient::DescribeElasticsearchDomainCallable(const DescribeElasticsearchDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeElasticsearchDomain(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeElasticsearchDomain(request); } );
 }
 
 void ElasticsearchServiceClient::DescribeElasticsearchDomainAsync(const DescribeElasticsearchDomainRequest& request, const DescribeElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -221,6 +251,16 @@ void ElasticsearchServiceClient::DescribeElasticsearchDomainAsync(const Describe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeElasticsearchDomainAsyncHelper( request, handler, context ); } );
 }
 
+DescribeElasticsearchDomainOutcomeCallable ElasticsearchServiceClient::DescribeElasticsearchDomainCallable(DescribeElasticsearchDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticsearchServiceClient::DescribeElasticsearchDomain, this, std::move(request)));
+}
+
+void ElasticsearchServiceClient::DescribeElasticsearchDomainAsync(DescribeElasticsearchDomainRequest&& request, const DescribeElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticsearchServiceClient::DescribeElasticsearchDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticsearchServiceClient::DescribeElasticsearchDomainAsyncHelper(const DescribeElasticsearchDomainRequest& request, const DescribeElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeElasticsearchDomain(request), context);
@@ -246,7 +286,7 @@ DescribeElasticsearchDomainConfigOutcome ElasticsearchServiceClient::DescribeEla
 
 DescribeElasticsearchDomainConfigOutcomeCallable ElasticsearchServiceClient::DescribeElasticsearchDomainConfigCallable(const DescribeElasticsearchDomainConfigRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeElasticsearchDomainConfig(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeElasticsearchDomainConfig(request); } );
 }
 
 void ElasticsearchServiceClient::DescribeElasticsearchDomainConfigAsync(const DescribeElasticsearchDomainConfigRequest& request, const DescribeElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -254,6 +294,16 @@ void ElasticsearchServiceClient::DescribeElasticsearchDomainConfigAsync(const De
   m_executor->Submit( [this, request, handler, context](){ this->DescribeElasticsearchDomainConfigAsyncHelper( request, handler, context ); } );
 }
 
+DescribeElasticsearchDomainConfigOutcomeCallable ElasticsearchServiceClient::DescribeElasticsearchDomainConfigCallable(DescribeElasticsearchDomainConfigRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticsearchServiceClient::DescribeElasticsearchDomainConfig, this, std::move(request)));
+}
+
+void ElasticsearchServiceClient::DescribeElasticsearchDomainConfigAsync(DescribeElasticsearchDomainConfigRequest&& request, const DescribeElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticsearchServiceClient::DescribeElasticsearchDomainConfigAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticsearchServiceClient::DescribeElasticsearchDomainConfigAsyncHelper(const DescribeElasticsearchDomainConfigRequest& request, const DescribeElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeElasticsearchDomainConfig(request), context);
@@ -277,7 +327,7 @@ DescribeElasticsearchDomainsOutcome ElasticsearchServiceClient::DescribeElastics
 
 DescribeElasticsearchDomainsOutcomeCallable ElasticsearchServiceClient::DescribeElasticsearchDomainsCallable(const DescribeElasticsearchDomainsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeElasticsearchDomains(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeElasticsearchDomains(request); } );
 }
 
 void ElasticsearchServiceClient::DescribeElasticsearchDomainsAsync(const DescribeElasticsearchDomainsRequest& request, const DescribeElasticsearchDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -285,6 +335,16 @@ void ElasticsearchServiceClient::DescribeElasticsearchDomainsAsync(const Describ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeElasticsearchDomainsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeElasticsearchDomainsOutcomeCallable ElasticsearchServiceClient::DescribeElasticsearchDomainsCallable(DescribeElasticsearchDomainsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticsearchServiceClient::DescribeElasticsearchDomains, this, std::move(request)));
+}
+
+void ElasticsearchServiceClient::DescribeElasticsearchDomainsAsync(DescribeElasticsearchDomainsRequest&& request, const DescribeElasticsearchDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticsearchServiceClient::DescribeElasticsearchDomainsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticsearchServiceClient::DescribeElasticsearchDomainsAsyncHelper(const DescribeElasticsearchDomainsRequest& request, const DescribeElasticsearchDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeElasticsearchDomains(request), context);
@@ -308,7 +368,7 @@ ListDomainNamesOutcome ElasticsearchServiceClient::ListDomainNames() const
 
 ListDomainNamesOutcomeCallable ElasticsearchServiceClient::ListDomainNamesCallable() const
 {
-  return std::async(std::launch::async, [this](){ return this->ListDomainNames(); } );
+  return m_executor->SubmitCallable([this](){ return this->ListDomainNames(); } );
 }
 
 void ElasticsearchServiceClient::ListDomainNamesAsync(const ListDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -339,7 +399,7 @@ ListTagsOutcome ElasticsearchServiceClient::ListTags(const ListTagsRequest& requ
 
 ListTagsOutcomeCallable ElasticsearchServiceClient::ListTagsCallable(const ListTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTags(request); } );
 }
 
 void ElasticsearchServiceClient::ListTagsAsync(const ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -347,6 +407,16 @@ void ElasticsearchServiceClient::ListTagsAsync(const ListTagsRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsOutcomeCallable ElasticsearchServiceClient::ListTagsCallable(ListTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticsearchServiceClient::ListTags, this, std::move(request)));
+}
+
+void ElasticsearchServiceClient::ListTagsAsync(ListTagsRequest&& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticsearchServiceClient::ListTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticsearchServiceClient::ListTagsAsyncHelper(const ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTags(request), context);
@@ -370,7 +440,7 @@ RemoveTagsOutcome ElasticsearchServiceClient::RemoveTags(const RemoveTagsRequest
 
 RemoveTagsOutcomeCallable ElasticsearchServiceClient::RemoveTagsCallable(const RemoveTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTags(request); } );
 }
 
 void ElasticsearchServiceClient::RemoveTagsAsync(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -378,6 +448,16 @@ void ElasticsearchServiceClient::RemoveTagsAsync(const RemoveTagsRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsOutcomeCallable ElasticsearchServiceClient::RemoveTagsCallable(RemoveTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticsearchServiceClient::RemoveTags, this, std::move(request)));
+}
+
+void ElasticsearchServiceClient::RemoveTagsAsync(RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticsearchServiceClient::RemoveTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticsearchServiceClient::RemoveTagsAsyncHelper(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTags(request), context);
@@ -403,7 +483,7 @@ UpdateElasticsearchDomainConfigOutcome ElasticsearchServiceClient::UpdateElastic
 
 UpdateElasticsearchDomainConfigOutcomeCallable ElasticsearchServiceClient::UpdateElasticsearchDomainConfigCallable(const UpdateElasticsearchDomainConfigRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateElasticsearchDomainConfig(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateElasticsearchDomainConfig(request); } );
 }
 
 void ElasticsearchServiceClient::UpdateElasticsearchDomainConfigAsync(const UpdateElasticsearchDomainConfigRequest& request, const UpdateElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -411,8 +491,70 @@ void ElasticsearchServiceClient::UpdateElasticsearchDomainConfigAsync(const Upda
   m_executor->Submit( [this, request, handler, context](){ this->UpdateElasticsearchDomainConfigAsyncHelper( request, handler, context ); } );
 }
 
+UpdateElasticsearchDomainConfigOutcomeCallable ElasticsearchServiceClient::UpdateElasticsearchDomainConfigCallable(UpdateElasticsearchDomainConfigRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ElasticsearchServiceClient::UpdateElasticsearchDomainConfig, this, std::move(request)));
+}
+
+void ElasticsearchServiceClient::UpdateElasticsearchDomainConfigAsync(UpdateElasticsearchDomainConfigRequest&& request, const UpdateElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ElasticsearchServiceClient::UpdateElasticsearchDomainConfigAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ElasticsearchServiceClient::UpdateElasticsearchDomainConfigAsyncHelper(const UpdateElasticsearchDomainConfigRequest& request, const UpdateElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateElasticsearchDomainConfig(request), context);
 }
 
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<ElasticsearchServiceClient, AddTagsRequest, AddTagsOutcome> ElasticsearchServiceClient::AddTagsAwaitable(AddTagsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticsearchServiceClient::AddTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticsearchServiceClient, CreateElasticsearchDomainRequest, CreateElasticsearchDomainOutcome> ElasticsearchServiceClient::CreateElasticsearchDomainAwaitable(CreateElasticsearchDomainRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticsearchServiceClient::CreateElasticsearchDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticsearchServiceClient, DeleteElasticsearchDomainRequest, DeleteElasticsearchDomainOutcome> ElasticsearchServiceClient::DeleteElasticsearchDomainAwaitable(DeleteElasticsearchDomainRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticsearchServiceClient::DeleteElasticsearchDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticsearchServiceClient, DescribeElasticsearchDomainRequest, DescribeElasticsearchDomainOutcome> ElasticsearchServiceClient::DescribeElasticsearchDomainAwaitable(DescribeElasticsearchDomainRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticsearchServiceClient::DescribeElasticsearchDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticsearchServiceClient, DescribeElasticsearchDomainConfigRequest, DescribeElasticsearchDomainConfigOutcome> ElasticsearchServiceClient::DescribeElasticsearchDomainConfigAwaitable(DescribeElasticsearchDomainConfigRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticsearchServiceClient::DescribeElasticsearchDomainConfig, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticsearchServiceClient, DescribeElasticsearchDomainsRequest, DescribeElasticsearchDomainsOutcome> ElasticsearchServiceClient::DescribeElasticsearchDomainsAwaitable(DescribeElasticsearchDomainsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticsearchServiceClient::DescribeElasticsearchDomains, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticsearchServiceClient, void, ListDomainNamesOutcome> ElasticsearchServiceClient::ListDomainNamesAwaitable() const
+{
+  return { m_executor.get(), { this, &ElasticsearchServiceClient::ListDomainNames } };
+}
+
+ClientOperationAwaitable<ElasticsearchServiceClient, ListTagsRequest, ListTagsOutcome> ElasticsearchServiceClient::ListTagsAwaitable(ListTagsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticsearchServiceClient::ListTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticsearchServiceClient, RemoveTagsRequest, RemoveTagsOutcome> ElasticsearchServiceClient::RemoveTagsAwaitable(RemoveTagsRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticsearchServiceClient::RemoveTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<ElasticsearchServiceClient, UpdateElasticsearchDomainConfigRequest, UpdateElasticsearchDomainConfigOutcome> ElasticsearchServiceClient::UpdateElasticsearchDomainConfigAwaitable(UpdateElasticsearchDomainConfigRequest request) const
+{
+  return { m_executor.get(), { this, &ElasticsearchServiceClient::UpdateElasticsearchDomainConfig, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,106 +29,80 @@ namespace Aws
       namespace ESPartitionInstanceTypeMapper
       {
 
-        static const int m3_medium_elasticsearch_HASH = HashingUtils::HashString("m3.medium.elasticsearch");
-        static const int m3_large_elasticsearch_HASH = HashingUtils::HashString("m3.large.elasticsearch");
-        static const int m3_xlarge_elasticsearch_HASH = HashingUtils::HashString("m3.xlarge.elasticsearch");
-        static const int m3_2xlarge_elasticsearch_HASH = HashingUtils::HashString("m3.2xlarge.elasticsearch");
-        static const int m4_large_elasticsearch_HASH = HashingUtils::HashString("m4.large.elasticsearch");
-        static const int m4_xlarge_elasticsearch_HASH = HashingUtils::HashString("m4.xlarge.elasticsearch");
-        static const int m4_2xlarge_elasticsearch_HASH = HashingUtils::HashString("m4.2xlarge.elasticsearch");
-        static const int m4_4xlarge_elasticsearch_HASH = HashingUtils::HashString("m4.4xlarge.elasticsearch");
-        static const int m4_10xlarge_elasticsearch_HASH = HashingUtils::HashString("m4.10xlarge.elasticsearch");
-        static const int t2_micro_elasticsearch_HASH = HashingUtils::HashString("t2.micro.elasticsearch");
-        static const int t2_small_elasticsearch_HASH = HashingUtils::HashString("t2.small.elasticsearch");
-        static const int t2_medium_elasticsearch_HASH = HashingUtils::HashString("t2.medium.elasticsearch");
-        static const int r3_large_elasticsearch_HASH = HashingUtils::HashString("r3.large.elasticsearch");
-        static const int r3_xlarge_elasticsearch_HASH = HashingUtils::HashString("r3.xlarge.elasticsearch");
-        static const int r3_2xlarge_elasticsearch_HASH = HashingUtils::HashString("r3.2xlarge.elasticsearch");
-        static const int r3_4xlarge_elasticsearch_HASH = HashingUtils::HashString("r3.4xlarge.elasticsearch");
-        static const int r3_8xlarge_elasticsearch_HASH = HashingUtils::HashString("r3.8xlarge.elasticsearch");
-        static const int i2_xlarge_elasticsearch_HASH = HashingUtils::HashString("i2.xlarge.elasticsearch");
-        static const int i2_2xlarge_elasticsearch_HASH = HashingUtils::HashString("i2.2xlarge.elasticsearch");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int m3_medium_elasticsearch_HASH = -1012758132;
+        static const int m3_large_elasticsearch_HASH = -401605950;
+        static const int m3_xlarge_elasticsearch_HASH = -1163059366;
+        static const int m3_2xlarge_elasticsearch_HASH = -907973508;
+        static const int m4_large_elasticsearch_HASH = -190255037;
+        static const int m4_xlarge_elasticsearch_HASH = 1093851641;
+        static const int m4_2xlarge_elasticsearch_HASH = 336790973;
+        static const int m4_4xlarge_elasticsearch_HASH = 759492799;
+        static const int m4_10xlarge_elasticsearch_HASH = -41898792;
+        static const int t2_micro_elasticsearch_HASH = -180666525;
+        static const int t2_small_elasticsearch_HASH = -516955034;
+        static const int t2_medium_elasticsearch_HASH = 1148714932;
+        static const int r3_large_elasticsearch_HASH = -2001952803;
+        static const int r3_xlarge_elasticsearch_HASH = 765795743;
+        static const int r3_2xlarge_elasticsearch_HASH = -1243007273;
+        static const int r3_4xlarge_elasticsearch_HASH = -820305447;
+        static const int r3_8xlarge_elasticsearch_HASH = 25098205;
+        static const int i2_xlarge_elasticsearch_HASH = 190906295;
+        static const int i2_2xlarge_elasticsearch_HASH = -1884710977;
 
 
         ESPartitionInstanceType GetESPartitionInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == m3_medium_elasticsearch_HASH)
+          switch (hashCode)
           {
+          case m3_medium_elasticsearch_HASH:
             return ESPartitionInstanceType::m3_medium_elasticsearch;
-          }
-          else if (hashCode == m3_large_elasticsearch_HASH)
-          {
+          case m3_large_elasticsearch_HASH:
             return ESPartitionInstanceType::m3_large_elasticsearch;
-          }
-          else if (hashCode == m3_xlarge_elasticsearch_HASH)
-          {
+          case m3_xlarge_elasticsearch_HASH:
             return ESPartitionInstanceType::m3_xlarge_elasticsearch;
-          }
-          else if (hashCode == m3_2xlarge_elasticsearch_HASH)
-          {
+          case m3_2xlarge_elasticsearch_HASH:
             return ESPartitionInstanceType::m3_2xlarge_elasticsearch;
-          }
-          else if (hashCode == m4_large_elasticsearch_HASH)
-          {
+          case m4_large_elasticsearch_HASH:
             return ESPartitionInstanceType::m4_large_elasticsearch;
-          }
-          else if (hashCode == m4_xlarge_elasticsearch_HASH)
-          {
+          case m4_xlarge_elasticsearch_HASH:
             return ESPartitionInstanceType::m4_xlarge_elasticsearch;
-          }
-          else if (hashCode == m4_2xlarge_elasticsearch_HASH)
-          {
+          case m4_2xlarge_elasticsearch_HASH:
             return ESPartitionInstanceType::m4_2xlarge_elasticsearch;
-          }
-          else if (hashCode == m4_4xlarge_elasticsearch_HASH)
-          {
+          case m4_4xlarge_elasticsearch_HASH:
             return ESPartitionInstanceType::m4_4xlarge_elasticsearch;
-          }
-          else if (hashCode == m4_10xlarge_elasticsearch_HASH)
-          {
+          case m4_10xlarge_elasticsearch_HASH:
             return ESPartitionInstanceType::m4_10xlarge_elasticsearch;
-          }
-          else if (hashCode == t2_micro_elasticsearch_HASH)
-          {
+          case t2_micro_elasticsearch_HASH:
             return ESPartitionInstanceType::t2_micro_elasticsearch;
-          }
-          else if (hashCode == t2_small_elasticsearch_HASH)
-          {
+          case t2_small_elasticsearch_HASH:
             return ESPartitionInstanceType::t2_small_elasticsearch;
-          }
-          else if (hashCode == t2_medium_elasticsearch_HASH)
-          {
+          case t2_medium_elasticsearch_HASH:
             return ESPartitionInstanceType::t2_medium_elasticsearch;
-          }
-          else if (hashCode == r3_large_elasticsearch_HASH)
-          {
+          case r3_large_elasticsearch_HASH:
             return ESPartitionInstanceType::r3_large_elasticsearch;
-          }
-          else if (hashCode == r3_xlarge_elasticsearch_HASH)
-          {
+          case r3_xlarge_elasticsearch_HASH:
             return ESPartitionInstanceType::r3_xlarge_elasticsearch;
-          }
-          else if (hashCode == r3_2xlarge_elasticsearch_HASH)
-          {
+          case r3_2xlarge_elasticsearch_HASH:
             return ESPartitionInstanceType::r3_2xlarge_elasticsearch;
-          }
-          else if (hashCode == r3_4xlarge_elasticsearch_HASH)
-          {
+          case r3_4xlarge_elasticsearch_HASH:
             return ESPartitionInstanceType::r3_4xlarge_elasticsearch;
-          }
-          else if (hashCode == r3_8xlarge_elasticsearch_HASH)
-          {
+          case r3_8xlarge_elasticsearch_HASH:
             return ESPartitionInstanceType::r3_8xlarge_elasticsearch;
-          }
-          else if (hashCode == i2_xlarge_elasticsearch_HASH)
-          {
+          case i2_xlarge_elasticsearch_HASH:
             return ESPartitionInstanceType::i2_xlarge_elasticsearch;
-          }
-          else if (hashCode == i2_2xlarge_elasticsearch_HASH)
-          {
+          case i2_2xlarge_elasticsearch_HASH:
             return ESPartitionInstanceType::i2_2xlarge_elasticsearch;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
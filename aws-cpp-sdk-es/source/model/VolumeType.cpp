@@ -29,26 +29,32 @@ namespace Aws
       namespace VolumeTypeMapper
       {
 
-        static const int standard_HASH = HashingUtils::HashString("standard");
-        static const int gp2_HASH = HashingUtils::HashString("gp2");
-        static const int io1_HASH = HashingUtils::HashString("io1");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int standard_HASH = 1312628413;
+        static const int gp2_HASH = 102505;
+        static const int io1_HASH = 104395;
 
 
         VolumeType GetVolumeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == standard_HASH)
+          switch (hashCode)
           {
+          case standard_HASH:
             return VolumeType::standard;
-          }
-          else if (hashCode == gp2_HASH)
-          {
+          case gp2_HASH:
             return VolumeType::gp2;
-          }
-          else if (hashCode == io1_HASH)
-          {
+          case io1_HASH:
             return VolumeType::io1;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -31,6 +31,9 @@
 #include <aws/events/model/TestEventPatternResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -200,6 +203,18 @@ namespace Model
          */
         virtual void DeleteRuleAsync(const Model::DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRuleCallable(const Model::DeleteRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRuleOutcomeCallable DeleteRuleCallable(Model::DeleteRuleRequest&& request) const;
+
+        /**
+         * Same as DeleteRuleAsync(const Model::DeleteRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRuleAsync(Model::DeleteRuleRequest&& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the details of the specified rule.</p>
          */
@@ -219,6 +234,18 @@ namespace Model
          */
         virtual void DescribeRuleAsync(const Model::DescribeRuleRequest& request, const DescribeRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRuleCallable(const Model::DescribeRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeRuleOutcomeCallable DescribeRuleCallable(Model::DescribeRuleRequest&& request) const;
+
+        /**
+         * Same as DescribeRuleAsync(const Model::DescribeRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeRuleAsync(Model::DescribeRuleRequest&& request, const DescribeRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables a rule. A disabled rule won't match any events, and won't
          * self-trigger if it has a schedule expression.</p> <p> <b>Note:</b> When you
@@ -247,6 +274,18 @@ namespace Model
          */
         virtual void DisableRuleAsync(const Model::DisableRuleRequest& request, const DisableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableRuleCallable(const Model::DisableRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableRuleOutcomeCallable DisableRuleCallable(Model::DisableRuleRequest&& request) const;
+
+        /**
+         * Same as DisableRuleAsync(const Model::DisableRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableRuleAsync(Model::DisableRuleRequest&& request, const DisableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables a rule. If the rule does not exist, the operation fails.</p> <p>
          * <b>Note:</b> When you enable a rule, incoming events might not immediately start
@@ -275,6 +314,18 @@ namespace Model
          */
         virtual void EnableRuleAsync(const Model::EnableRuleRequest& request, const EnableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableRuleCallable(const Model::EnableRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableRuleOutcomeCallable EnableRuleCallable(Model::EnableRuleRequest&& request) const;
+
+        /**
+         * Same as EnableRuleAsync(const Model::EnableRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableRuleAsync(Model::EnableRuleRequest&& request, const EnableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the names of the rules that the given target is put to. You can see
          * which of the rules in Amazon CloudWatch Events can invoke a specific target in
@@ -309,6 +360,18 @@ namespace Model
          */
         virtual void ListRuleNamesByTargetAsync(const Model::ListRuleNamesByTargetRequest& request, const ListRuleNamesByTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRuleNamesByTargetCallable(const Model::ListRuleNamesByTargetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListRuleNamesByTargetOutcomeCallable ListRuleNamesByTargetCallable(Model::ListRuleNamesByTargetRequest&& request) const;
+
+        /**
+         * Same as ListRuleNamesByTargetAsync(const Model::ListRuleNamesByTargetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListRuleNamesByTargetAsync(Model::ListRuleNamesByTargetRequest&& request, const ListRuleNamesByTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the Amazon CloudWatch Events rules in your account. You can either list
          * all the rules or you can provide a prefix to match to the rule names. If you
@@ -340,6 +403,18 @@ namespace Model
          */
         virtual void ListRulesAsync(const Model::ListRulesRequest& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRulesCallable(const Model::ListRulesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListRulesOutcomeCallable ListRulesCallable(Model::ListRulesRequest&& request) const;
+
+        /**
+         * Same as ListRulesAsync(const Model::ListRulesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListRulesAsync(Model::ListRulesRequest&& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists of targets assigned to the rule.</p>
          */
@@ -359,6 +434,18 @@ namespace Model
          */
         virtual void ListTargetsByRuleAsync(const Model::ListTargetsByRuleRequest& request, const ListTargetsByRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTargetsByRuleCallable(const Model::ListTargetsByRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTargetsByRuleOutcomeCallable ListTargetsByRuleCallable(Model::ListTargetsByRuleRequest&& request) const;
+
+        /**
+         * Same as ListTargetsByRuleAsync(const Model::ListTargetsByRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTargetsByRuleAsync(Model::ListTargetsByRuleRequest&& request, const ListTargetsByRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sends custom events to Amazon CloudWatch Events so that they can be matched
          * to rules.</p>
@@ -381,6 +468,18 @@ namespace Model
          */
         virtual void PutEventsAsync(const Model::PutEventsRequest& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutEventsCallable(const Model::PutEventsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutEventsOutcomeCallable PutEventsCallable(Model::PutEventsRequest&& request) const;
+
+        /**
+         * Same as PutEventsAsync(const Model::PutEventsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutEventsAsync(Model::PutEventsRequest&& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates a rule. Rules are enabled by default, or based on value of
          * the State parameter. You can disable a rule using <a>DisableRule</a>.</p> <p>
@@ -439,6 +538,18 @@ namespace Model
          */
         virtual void PutRuleAsync(const Model::PutRuleRequest& request, const PutRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRuleCallable(const Model::PutRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutRuleOutcomeCallable PutRuleCallable(Model::PutRuleRequest&& request) const;
+
+        /**
+         * Same as PutRuleAsync(const Model::PutRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutRuleAsync(Model::PutRuleRequest&& request, const PutRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds target(s) to a rule. Targets are the resources that can be invoked when
          * a rule is triggered. For example, AWS Lambda functions, Amazon Kinesis streams,
@@ -524,6 +635,18 @@ namespace Model
          */
         virtual void PutTargetsAsync(const Model::PutTargetsRequest& request, const PutTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutTargetsCallable(const Model::PutTargetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutTargetsOutcomeCallable PutTargetsCallable(Model::PutTargetsRequest&& request) const;
+
+        /**
+         * Same as PutTargetsAsync(const Model::PutTargetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutTargetsAsync(Model::PutTargetsRequest&& request, const PutTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes target(s) from a rule so that when the rule is triggered, those
          * targets will no longer be invoked.</p> <p> <b>Note:</b> When you remove a
@@ -555,6 +678,18 @@ namespace Model
          */
         virtual void RemoveTargetsAsync(const Model::RemoveTargetsRequest& request, const RemoveTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTargetsCallable(const Model::RemoveTargetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTargetsOutcomeCallable RemoveTargetsCallable(Model::RemoveTargetsRequest&& request) const;
+
+        /**
+         * Same as RemoveTargetsAsync(const Model::RemoveTargetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTargetsAsync(Model::RemoveTargetsRequest&& request, const RemoveTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Tests whether an event pattern matches the provided event.</p> <p>
          * <b>Note:</b> Most services in AWS treat : or / as the same character in Amazon
@@ -589,6 +724,95 @@ namespace Model
          */
         virtual void TestEventPatternAsync(const Model::TestEventPatternRequest& request, const TestEventPatternResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TestEventPatternCallable(const Model::TestEventPatternRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TestEventPatternOutcomeCallable TestEventPatternCallable(Model::TestEventPatternRequest&& request) const;
+
+        /**
+         * Same as TestEventPatternAsync(const Model::TestEventPatternRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TestEventPatternAsync(Model::TestEventPatternRequest&& request, const TestEventPatternResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListRuleNamesByTarget(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudWatchEventsClient, Model::ListRuleNamesByTargetRequest, Model::ListRuleNamesByTargetOutcome> ListRuleNamesByTargetPaginator(const Model::ListRuleNamesByTargetRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListRules(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudWatchEventsClient, Model::ListRulesRequest, Model::ListRulesOutcome> ListRulesPaginator(const Model::ListRulesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListTargetsByRule(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudWatchEventsClient, Model::ListTargetsByRuleRequest, Model::ListTargetsByRuleOutcome> ListTargetsByRulePaginator(const Model::ListTargetsByRuleRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of DeleteRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchEventsClient, Model::DeleteRuleRequest, Model::DeleteRuleOutcome> DeleteRuleAwaitable(Model::DeleteRuleRequest request) const;
+
+        /**
+         * co_await-able form of DescribeRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchEventsClient, Model::DescribeRuleRequest, Model::DescribeRuleOutcome> DescribeRuleAwaitable(Model::DescribeRuleRequest request) const;
+
+        /**
+         * co_await-able form of DisableRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchEventsClient, Model::DisableRuleRequest, Model::DisableRuleOutcome> DisableRuleAwaitable(Model::DisableRuleRequest request) const;
+
+        /**
+         * co_await-able form of EnableRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchEventsClient, Model::EnableRuleRequest, Model::EnableRuleOutcome> EnableRuleAwaitable(Model::EnableRuleRequest request) const;
+
+        /**
+         * co_await-able form of ListRuleNamesByTarget(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchEventsClient, Model::ListRuleNamesByTargetRequest, Model::ListRuleNamesByTargetOutcome> ListRuleNamesByTargetAwaitable(Model::ListRuleNamesByTargetRequest request) const;
+
+        /**
+         * co_await-able form of ListRules(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchEventsClient, Model::ListRulesRequest, Model::ListRulesOutcome> ListRulesAwaitable(Model::ListRulesRequest request) const;
+
+        /**
+         * co_await-able form of ListTargetsByRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchEventsClient, Model::ListTargetsByRuleRequest, Model::ListTargetsByRuleOutcome> ListTargetsByRuleAwaitable(Model::ListTargetsByRuleRequest request) const;
+
+        /**
+         * co_await-able form of PutEvents(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchEventsClient, Model::PutEventsRequest, Model::PutEventsOutcome> PutEventsAwaitable(Model::PutEventsRequest request) const;
+
+        /**
+         * co_await-able form of PutRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchEventsClient, Model::PutRuleRequest, Model::PutRuleOutcome> PutRuleAwaitable(Model::PutRuleRequest request) const;
+
+        /**
+         * co_await-able form of PutTargets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchEventsClient, Model::PutTargetsRequest, Model::PutTargetsOutcome> PutTargetsAwaitable(Model::PutTargetsRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTargets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchEventsClient, Model::RemoveTargetsRequest, Model::RemoveTargetsOutcome> RemoveTargetsAwaitable(Model::RemoveTargetsRequest request) const;
+
+        /**
+         * co_await-able form of TestEventPattern(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchEventsClient, Model::TestEventPatternRequest, Model::TestEventPatternOutcome> TestEventPatternAwaitable(Model::TestEventPatternRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
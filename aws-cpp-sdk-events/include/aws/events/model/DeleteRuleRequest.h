@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteRule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeRule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DisableRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableRule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     EnableRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableRule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
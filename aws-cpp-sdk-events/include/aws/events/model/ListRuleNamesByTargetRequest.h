@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListRuleNamesByTargetRequest();
+    inline const char* GetServiceRequestName() const override { return "ListRuleNamesByTarget"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListRulesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListRules"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListTargetsByRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTargetsByRule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PutRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "PutRule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     PutTargetsRequest();
+    inline const char* GetServiceRequestName() const override { return "PutTargets"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RemoveTargetsRequest();
+    inline const char* GetServiceRequestName() const override { return "RemoveTargets"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     TestEventPatternRequest();
+    inline const char* GetServiceRequestName() const override { return "TestEventPattern"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
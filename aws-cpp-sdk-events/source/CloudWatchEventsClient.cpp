@@ -121,7 +121,7 @@ DeleteRuleOutcome CloudWatchEventsClient::DeleteRule(const DeleteRuleRequest& re
 
 DeleteRuleOutcomeCallable CloudWatchEventsClient::DeleteRuleCallable(const DeleteRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRule(request); } );
 }
 
 void CloudWatchEventsClient::DeleteRuleAsync(const DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -129,6 +129,16 @@ void CloudWatchEventsClient::DeleteRuleAsync(const DeleteRuleRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRuleAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRuleOutcomeCallable CloudWatchEventsClient::DeleteRuleCallable(DeleteRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchEventsClient::DeleteRule, this, std::move(request)));
+}
+
+void CloudWatchEventsClient::DeleteRuleAsync(DeleteRuleRequest&& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchEventsClient::DeleteRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchEventsClient::DeleteRuleAsyncHelper(const DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRule(request), context);
@@ -152,7 +162,7 @@ DescribeRuleOutcome CloudWatchEventsClient::DescribeRule(const DescribeRuleReque
 
 DescribeRuleOutcomeCallable CloudWatchEventsClient::DescribeRuleCallable(const DescribeRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeRule(request); } );
 }
 
 void CloudWatchEventsClient::DescribeRuleAsync(const DescribeRuleRequest& request, const DescribeRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -160,6 +170,16 @@ void CloudWatchEventsClient::DescribeRuleAsync(const DescribeRuleRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->DescribeRuleAsyncHelper( request, handler, context ); } );
 }
 
+DescribeRuleOutcomeCallable CloudWatchEventsClient::DescribeRuleCallable(DescribeRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchEventsClient::DescribeRule, this, std::move(request)));
+}
+
+void CloudWatchEventsClient::DescribeRuleAsync(DescribeRuleRequest&& request, const DescribeRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchEventsClient::DescribeRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchEventsClient::DescribeRuleAsyncHelper(const DescribeRuleRequest& request, const DescribeRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeRule(request), context);
@@ -183,7 +203,7 @@ DisableRuleOutcome CloudWatchEventsClient::DisableRule(const DisableRuleRequest&
 
 DisableRuleOutcomeCallable CloudWatchEventsClient::DisableRuleCallable(const DisableRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableRule(request); } );
 }
 
 void CloudWatchEventsClient::DisableRuleAsync(const DisableRuleRequest& request, const DisableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -191,6 +211,16 @@ void CloudWatchEventsClient::DisableRuleAsync(const DisableRuleRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DisableRuleAsyncHelper( request, handler, context ); } );
 }
 
+DisableRuleOutcomeCallable CloudWatchEventsClient::DisableRuleCallable(DisableRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchEventsClient::DisableRule, this, std::move(request)));
+}
+
+void CloudWatchEventsClient::DisableRuleAsync(DisableRuleRequest&& request, const DisableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchEventsClient::DisableRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchEventsClient::DisableRuleAsyncHelper(const DisableRuleRequest& request, const DisableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableRule(request), context);
@@ -214,7 +244,7 @@ EnableRuleOutcome CloudWatchEventsClient::EnableRule(const EnableRuleRequest& re
 
 EnableRuleOutcomeCallable CloudWatchEventsClient::EnableRuleCallable(const EnableRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableRule(request); } );
 }
 
 void CloudWatchEventsClient::EnableRuleAsync(const EnableRuleRequest& request, const EnableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -222,6 +252,16 @@ void CloudWatchEventsClient::EnableRuleAsync(const EnableRuleRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->EnableRuleAsyncHelper( request, handler, context ); } );
 }
 
+EnableRuleOutcomeCallable CloudWatchEventsClient::EnableRuleCallable(EnableRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchEventsClient::EnableRule, this, std::move(request)));
+}
+
+void CloudWatchEventsClient::EnableRuleAsync(EnableRuleRequest&& request, const EnableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchEventsClient::EnableRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchEventsClient::EnableRuleAsyncHelper(const EnableRuleRequest& request, const EnableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableRule(request), context);
@@ -245,7 +285,7 @@ ListRuleNamesByTargetOutcome CloudWatchEventsClient::ListRuleNamesByTarget(const
 
 ListRuleNamesByTargetOutcomeCallable CloudWatchEventsClient::ListRuleNamesByTargetCallable(const ListRuleNamesByTargetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListRuleNamesByTarget(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListRuleNamesByTarget(request); } );
 }
 
 void CloudWatchEventsClient::ListRuleNamesByTargetAsync(const ListRuleNamesByTargetRequest& request, const ListRuleNamesByTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -253,6 +293,16 @@ void CloudWatchEventsClient::ListRuleNamesByTargetAsync(const ListRuleNamesByTar
   m_executor->Submit( [this, request, handler, context](){ this->ListRuleNamesByTargetAsyncHelper( request, handler, context ); } );
 }
 
+ListRuleNamesByTargetOutcomeCallable CloudWatchEventsClient::ListRuleNamesByTargetCallable(ListRuleNamesByTargetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchEventsClient::ListRuleNamesByTarget, this, std::move(request)));
+}
+
+void CloudWatchEventsClient::ListRuleNamesByTargetAsync(ListRuleNamesByTargetRequest&& request, const ListRuleNamesByTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchEventsClient::ListRuleNamesByTargetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchEventsClient::ListRuleNamesByTargetAsyncHelper(const ListRuleNamesByTargetRequest& request, const ListRuleNamesByTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListRuleNamesByTarget(request), context);
@@ -276,7 +326,7 @@ ListRulesOutcome CloudWatchEventsClient::ListRules(const ListRulesRequest& reque
 
 ListRulesOutcomeCallable CloudWatchEventsClient::ListRulesCallable(const ListRulesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListRules(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListRules(request); } );
 }
 
 void CloudWatchEventsClient::ListRulesAsync(const ListRulesRequest& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -284,6 +334,16 @@ void CloudWatchEventsClient::ListRulesAsync(const ListRulesRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->ListRulesAsyncHelper( request, handler, context ); } );
 }
 
+ListRulesOutcomeCallable CloudWatchEventsClient::ListRulesCallable(ListRulesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchEventsClient::ListRules, this, std::move(request)));
+}
+
+void CloudWatchEventsClient::ListRulesAsync(ListRulesRequest&& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchEventsClient::ListRulesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchEventsClient::ListRulesAsyncHelper(const ListRulesRequest& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListRules(request), context);
@@ -307,7 +367,7 @@ ListTargetsByRuleOutcome CloudWatchEventsClient::ListTargetsByRule(const ListTar
 
 ListTargetsByRuleOutcomeCallable CloudWatchEventsClient::ListTargetsByRuleCallable(const ListTargetsByRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTargetsByRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTargetsByRule(request); } );
 }
 
 void CloudWatchEventsClient::ListTargetsByRuleAsync(const ListTargetsByRuleRequest& request, const ListTargetsByRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -315,6 +375,16 @@ void CloudWatchEventsClient::ListTargetsByRuleAsync(const ListTargetsByRuleReque
   m_executor->Submit( [this, request, handler, context](){ this->ListTargetsByRuleAsyncHelper( request, handler, context ); } );
 }
 
+ListTargetsByRuleOutcomeCallable CloudWatchEventsClient::ListTargetsByRuleCallable(ListTargetsByRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchEventsClient::ListTargetsByRule, this, std::move(request)));
+}
+
+void CloudWatchEventsClient::ListTargetsByRuleAsync(ListTargetsByRuleRequest&& request, const ListTargetsByRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchEventsClient::ListTargetsByRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchEventsClient::ListTargetsByRuleAsyncHelper(const ListTargetsByRuleRequest& request, const ListTargetsByRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTargetsByRule(request), context);
@@ -338,7 +408,7 @@ PutEventsOutcome CloudWatchEventsClient::PutEvents(const PutEventsRequest& reque
 
 PutEventsOutcomeCallable CloudWatchEventsClient::PutEventsCallable(const PutEventsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutEvents(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutEvents(request); } );
 }
 
 void CloudWatchEventsClient::PutEventsAsync(const PutEventsRequest& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -346,6 +416,16 @@ void CloudWatchEventsClient::PutEventsAsync(const PutEventsRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->PutEventsAsyncHelper( request, handler, context ); } );
 }
 
+PutEventsOutcomeCallable CloudWatchEventsClient::PutEventsCallable(PutEventsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchEventsClient::PutEvents, this, std::move(request)));
+}
+
+void CloudWatchEventsClient::PutEventsAsync(PutEventsRequest&& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchEventsClient::PutEventsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchEventsClient::PutEventsAsyncHelper(const PutEventsRequest& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutEvents(request), context);
@@ -369,7 +449,7 @@ PutRuleOutcome CloudWatchEventsClient::PutRule(const PutRuleRequest& request) co
 
 PutRuleOutcomeCallable CloudWatchEventsClient::PutRuleCallable(const PutRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutRule(request); } );
 }
 
 void CloudWatchEventsClient::PutRuleAsync(const PutRuleRequest& request, const PutRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -377,6 +457,16 @@ void CloudWatchEventsClient::PutRuleAsync(const PutRuleRequest& request, const P
   m_executor->Submit( [this, request, handler, context](){ this->PutRuleAsyncHelper( request, handler, context ); } );
 }
 
+PutRuleOutcomeCallable CloudWatchEventsClient::PutRuleCallable(PutRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchEventsClient::PutRule, this, std::move(request)));
+}
+
+void CloudWatchEventsClient::PutRuleAsync(PutRuleRequest&& request, const PutRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchEventsClient::PutRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchEventsClient::PutRuleAsyncHelper(const PutRuleRequest& request, const PutRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutRule(request), context);
@@ -400,7 +490,7 @@ PutTargetsOutcome CloudWatchEventsClient::PutTargets(const PutTargetsRequest& re
 
 PutTargetsOutcomeCallable CloudWatchEventsClient::PutTargetsCallable(const PutTargetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutTargets(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutTargets(request); } );
 }
 
 void CloudWatchEventsClient::PutTargetsAsync(const PutTargetsRequest& request, const PutTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -408,6 +498,16 @@ void CloudWatchEventsClient::PutTargetsAsync(const PutTargetsRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->PutTargetsAsyncHelper( request, handler, context ); } );
 }
 
+PutTargetsOutcomeCallable CloudWatchEventsClient::PutTargetsCallable(PutTargetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchEventsClient::PutTargets, this, std::move(request)));
+}
+
+void CloudWatchEventsClient::PutTargetsAsync(PutTargetsRequest&& request, const PutTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchEventsClient::PutTargetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchEventsClient::PutTargetsAsyncHelper(const PutTargetsRequest& request, const PutTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutTargets(request), context);
@@ -431,7 +531,7 @@ RemoveTargetsOutcome CloudWatchEventsClient::RemoveTargets(const RemoveTargetsRe
 
 RemoveTargetsOutcomeCallable CloudWatchEventsClient::RemoveTargetsCallable(const RemoveTargetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTargets(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTargets(request); } );
 }
 
 void CloudWatchEventsClient::RemoveTargetsAsync(const RemoveTargetsRequest& request, const RemoveTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -439,6 +539,16 @@ void CloudWatchEventsClient::RemoveTargetsAsync(const RemoveTargetsRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTargetsAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTargetsOutcomeCallable CloudWatchEventsClient::RemoveTargetsCallable(RemoveTargetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchEventsClient::RemoveTargets, this, std::move(request)));
+}
+
+void CloudWatchEventsClient::RemoveTargetsAsync(RemoveTargetsRequest&& request, const RemoveTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchEventsClient::RemoveTargetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchEventsClient::RemoveTargetsAsyncHelper(const RemoveTargetsRequest& request, const RemoveTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTargets(request), context);
@@ -462,7 +572,7 @@ TestEventPatternOutcome CloudWatchEventsClient::TestEventPattern(const TestEvent
 
 TestEventPatternOutcomeCallable CloudWatchEventsClient::TestEventPatternCallable(const TestEventPatternRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TestEventPattern(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TestEventPattern(request); } );
 }
 
 void CloudWatchEventsClient::TestEventPatternAsync(const TestEventPatternRequest& request, const TestEventPatternResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -470,8 +580,131 @@ void CloudWatchEventsClient::TestEventPatternAsync(const TestEventPatternRequest
   m_executor->Submit( [this, request, handler, context](){ this->TestEventPatternAsyncHelper( request, handler, context ); } );
 }
 
+TestEventPatternOutcomeCallable CloudWatchEventsClient::TestEventPatternCallable(TestEventPatternRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchEventsClient::TestEventPattern, this, std::move(request)));
+}
+
+void CloudWatchEventsClient::TestEventPatternAsync(TestEventPatternRequest&& request, const TestEventPatternResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchEventsClient::TestEventPatternAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchEventsClient::TestEventPatternAsyncHelper(const TestEventPatternRequest& request, const TestEventPatternResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TestEventPattern(request), context);
 }
 
+Paginator<CloudWatchEventsClient, ListRuleNamesByTargetRequest, ListRuleNamesByTargetOutcome> CloudWatchEventsClient::ListRuleNamesByTargetPaginator(const ListRuleNamesByTargetRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudWatchEventsClient, ListRuleNamesByTargetRequest, ListRuleNamesByTargetOutcome>(this, &CloudWatchEventsClient::ListRuleNamesByTarget, request,
+    [](const ListRuleNamesByTargetRequest& current, const ListRuleNamesByTargetOutcome& outcome, ListRuleNamesByTargetRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudWatchEventsClient, ListRulesRequest, ListRulesOutcome> CloudWatchEventsClient::ListRulesPaginator(const ListRulesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudWatchEventsClient, ListRulesRequest, ListRulesOutcome>(this, &CloudWatchEventsClient::ListRules, request,
+    [](const ListRulesRequest& current, const ListRulesOutcome& outcome, ListRulesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudWatchEventsClient, ListTargetsByRuleRequest, ListTargetsByRuleOutcome> CloudWatchEventsClient::ListTargetsByRulePaginator(const ListTargetsByRuleRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudWatchEventsClient, ListTargetsByRuleRequest, ListTargetsByRuleOutcome>(this, &CloudWatchEventsClient::ListTargetsByRule, request,
+    [](const ListTargetsByRuleRequest& current, const ListTargetsByRuleOutcome& outcome, ListTargetsByRuleRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<CloudWatchEventsClient, DeleteRuleRequest, DeleteRuleOutcome> CloudWatchEventsClient::DeleteRuleAwaitable(DeleteRuleRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchEventsClient::DeleteRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchEventsClient, DescribeRuleRequest, DescribeRuleOutcome> CloudWatchEventsClient::DescribeRuleAwaitable(DescribeRuleRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchEventsClient::DescribeRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchEventsClient, DisableRuleRequest, DisableRuleOutcome> CloudWatchEventsClient::DisableRuleAwaitable(DisableRuleRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchEventsClient::DisableRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchEventsClient, EnableRuleRequest, EnableRuleOutcome> CloudWatchEventsClient::EnableRuleAwaitable(EnableRuleRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchEventsClient::EnableRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchEventsClient, ListRuleNamesByTargetRequest, ListRuleNamesByTargetOutcome> CloudWatchEventsClient::ListRuleNamesByTargetAwaitable(ListRuleNamesByTargetRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchEventsClient::ListRuleNamesByTarget, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchEventsClient, ListRulesRequest, ListRulesOutcome> CloudWatchEventsClient::ListRulesAwaitable(ListRulesRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchEventsClient::ListRules, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchEventsClient, ListTargetsByRuleRequest, ListTargetsByRuleOutcome> CloudWatchEventsClient::ListTargetsByRuleAwaitable(ListTargetsByRuleRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchEventsClient::ListTargetsByRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchEventsClient, PutEventsRequest, PutEventsOutcome> CloudWatchEventsClient::PutEventsAwaitable(PutEventsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchEventsClient::PutEvents, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchEventsClient, PutRuleRequest, PutRuleOutcome> CloudWatchEventsClient::PutRuleAwaitable(PutRuleRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchEventsClient::PutRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchEventsClient, PutTargetsRequest, PutTargetsOutcome> CloudWatchEventsClient::PutTargetsAwaitable(PutTargetsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchEventsClient::PutTargets, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchEventsClient, RemoveTargetsRequest, RemoveTargetsOutcome> CloudWatchEventsClient::RemoveTargetsAwaitable(RemoveTargetsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchEventsClient::RemoveTargets, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchEventsClient, TestEventPatternRequest, TestEventPatternOutcome> CloudWatchEventsClient::TestEventPatternAwaitable(TestEventPatternRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchEventsClient::TestEventPattern, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
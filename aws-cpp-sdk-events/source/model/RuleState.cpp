@@ -29,21 +29,29 @@ namespace Aws
       namespace RuleStateMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ENABLED_HASH = -891611359;
+        static const int DISABLED_HASH = 1053567612;
 
 
         RuleState GetRuleStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
+          switch (hashCode)
           {
+          case ENABLED_HASH:
             return RuleState::ENABLED;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
+          case DISABLED_HASH:
             return RuleState::DISABLED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -28,6 +28,9 @@
 #include <aws/firehose/model/PutRecordBatchResult.h>
 #include <aws/firehose/model/UpdateDestinationResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -79,6 +82,7 @@ namespace Model
         class PutRecordRequest;
         class PutRecordBatchRequest;
         class UpdateDestinationRequest;
+        class Record;
 
         typedef Aws::Utils::Outcome<CreateDeliveryStreamResult, Aws::Client::AWSError<FirehoseErrors>> CreateDeliveryStreamOutcome;
         typedef Aws::Utils::Outcome<DeleteDeliveryStreamResult, Aws::Client::AWSError<FirehoseErrors>> DeleteDeliveryStreamOutcome;
@@ -284,6 +288,18 @@ namespace Model
          */
         virtual void CreateDeliveryStreamAsync(const Model::CreateDeliveryStreamRequest& request, const CreateDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDeliveryStreamCallable(const Model::CreateDeliveryStreamRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDeliveryStreamOutcomeCallable CreateDeliveryStreamCallable(Model::CreateDeliveryStreamRequest&& request) const;
+
+        /**
+         * Same as CreateDeliveryStreamAsync(const Model::CreateDeliveryStreamRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDeliveryStreamAsync(Model::CreateDeliveryStreamRequest&& request, const CreateDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a delivery stream and its data.</p> <p>You can delete a delivery
          * stream only if it is in <code>ACTIVE</code> or <code>DELETING</code> state, and
@@ -330,6 +346,18 @@ namespace Model
          */
         virtual void DeleteDeliveryStreamAsync(const Model::DeleteDeliveryStreamRequest& request, const DeleteDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDeliveryStreamCallable(const Model::DeleteDeliveryStreamRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDeliveryStreamOutcomeCallable DeleteDeliveryStreamCallable(Model::DeleteDeliveryStreamRequest&& request) const;
+
+        /**
+         * Same as DeleteDeliveryStreamAsync(const Model::DeleteDeliveryStreamRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDeliveryStreamAsync(Model::DeleteDeliveryStreamRequest&& request, const DeleteDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified delivery stream and gets the status. For example,
          * after your delivery stream is created, call <a>DescribeDeliveryStream</a> to see
@@ -358,6 +386,18 @@ namespace Model
          */
         virtual void DescribeDeliveryStreamAsync(const Model::DescribeDeliveryStreamRequest& request, const DescribeDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDeliveryStreamCallable(const Model::DescribeDeliveryStreamRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDeliveryStreamOutcomeCallable DescribeDeliveryStreamCallable(Model::DescribeDeliveryStreamRequest&& request) const;
+
+        /**
+         * Same as DescribeDeliveryStreamAsync(const Model::DescribeDeliveryStreamRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDeliveryStreamAsync(Model::DescribeDeliveryStreamRequest&& request, const DescribeDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists your delivery streams.</p> <p>The number of delivery streams might be
          * too large to return using a single call to <a>ListDeliveryStreams</a>. You can
@@ -398,6 +438,18 @@ namespace Model
          */
         virtual void ListDeliveryStreamsAsync(const Model::ListDeliveryStreamsRequest& request, const ListDeliveryStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDeliveryStreamsCallable(const Model::ListDeliveryStreamsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDeliveryStreamsOutcomeCallable ListDeliveryStreamsCallable(Model::ListDeliveryStreamsRequest&& request) const;
+
+        /**
+         * Same as ListDeliveryStreamsAsync(const Model::ListDeliveryStreamsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDeliveryStreamsAsync(Model::ListDeliveryStreamsRequest&& request, const ListDeliveryStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Writes a single data record into an Amazon Kinesis Firehose delivery stream.
          * To write multiple data records into a delivery stream, use
@@ -495,6 +547,18 @@ namespace Model
          */
         virtual void PutRecordAsync(const Model::PutRecordRequest& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRecordCallable(const Model::PutRecordRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutRecordOutcomeCallable PutRecordCallable(Model::PutRecordRequest&& request) const;
+
+        /**
+         * Same as PutRecordAsync(const Model::PutRecordRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutRecordAsync(Model::PutRecordRequest&& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Writes multiple data records into a delivery stream in a single call, which
          * can achieve higher throughput per producer than when writing single records. To
@@ -661,6 +725,18 @@ namespace Model
          */
         virtual void PutRecordBatchAsync(const Model::PutRecordBatchRequest& request, const PutRecordBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRecordBatchCallable(const Model::PutRecordBatchRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutRecordBatchOutcomeCallable PutRecordBatchCallable(Model::PutRecordBatchRequest&& request) const;
+
+        /**
+         * Same as PutRecordBatchAsync(const Model::PutRecordBatchRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutRecordBatchAsync(Model::PutRecordBatchRequest&& request, const PutRecordBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the specified destination of the specified delivery stream. Note:
          * Switching between Elasticsearch and other services is not supported. For
@@ -761,6 +837,60 @@ namespace Model
          */
         virtual void UpdateDestinationAsync(const Model::UpdateDestinationRequest& request, const UpdateDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDestinationCallable(const Model::UpdateDestinationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateDestinationOutcomeCallable UpdateDestinationCallable(Model::UpdateDestinationRequest&& request) const;
+
+        /**
+         * Same as UpdateDestinationAsync(const Model::UpdateDestinationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateDestinationAsync(Model::UpdateDestinationRequest&& request, const UpdateDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Collects Record entries and sends them with PutRecordBatch() in calls of at most 500 entries and 4194304 bytes, re-queueing the entries the service could not process. The client must outlive the accumulator.
+         */
+        std::shared_ptr<Aws::Client::BatchAccumulator<Model::PutRecordBatchRequest, Model::Record>> PutRecordBatchAccumulator(const Model::PutRecordBatchRequest& requestTemplate, const Aws::Client::BatchAccumulatorConfiguration& config = Aws::Client::BatchAccumulatorConfiguration()) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CreateDeliveryStream(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<FirehoseClient, Model::CreateDeliveryStreamRequest, Model::CreateDeliveryStreamOutcome> CreateDeliveryStreamAwaitable(Model::CreateDeliveryStreamRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDeliveryStream(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<FirehoseClient, Model::DeleteDeliveryStreamRequest, Model::DeleteDeliveryStreamOutcome> DeleteDeliveryStreamAwaitable(Model::DeleteDeliveryStreamRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDeliveryStream(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<FirehoseClient, Model::DescribeDeliveryStreamRequest, Model::DescribeDeliveryStreamOutcome> DescribeDeliveryStreamAwaitable(Model::DescribeDeliveryStreamRequest request) const;
+
+        /**
+         * co_await-able form of ListDeliveryStreams(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<FirehoseClient, Model::ListDeliveryStreamsRequest, Model::ListDeliveryStreamsOutcome> ListDeliveryStreamsAwaitable(Model::ListDeliveryStreamsRequest request) const;
+
+        /**
+         * co_await-able form of PutRecord(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<FirehoseClient, Model::PutRecordRequest, Model::PutRecordOutcome> PutRecordAwaitable(Model::PutRecordRequest request) const;
+
+        /**
+         * co_await-able form of PutRecordBatch(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<FirehoseClient, Model::PutRecordBatchRequest, Model::PutRecordBatchOutcome> PutRecordBatchAwaitable(Model::PutRecordBatchRequest request) const;
+
+        /**
+         * co_await-able form of UpdateDestination(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<FirehoseClient, Model::UpdateDestinationRequest, Model::UpdateDestinationOutcome> UpdateDestinationAwaitable(Model::UpdateDestinationRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
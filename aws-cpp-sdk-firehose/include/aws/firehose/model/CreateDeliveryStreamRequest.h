@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateDeliveryStreamRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDeliveryStream"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDeliveryStreamRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDeliveryStream"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
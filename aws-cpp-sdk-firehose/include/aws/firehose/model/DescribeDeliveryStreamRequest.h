@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeDeliveryStreamRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDeliveryStream"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
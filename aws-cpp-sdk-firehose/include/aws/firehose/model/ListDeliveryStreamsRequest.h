@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListDeliveryStreamsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListDeliveryStreams"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     PutRecordBatchRequest();
+    inline const char* GetServiceRequestName() const override { return "PutRecordBatch"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
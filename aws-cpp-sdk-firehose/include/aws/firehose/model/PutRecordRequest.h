@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PutRecordRequest();
+    inline const char* GetServiceRequestName() const override { return "PutRecord"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
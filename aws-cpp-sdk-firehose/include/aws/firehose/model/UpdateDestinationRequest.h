@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     UpdateDestinationRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateDestination"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -116,7 +116,7 @@ CreateDeliveryStreamOutcome FirehoseClient::CreateDeliveryStream(const CreateDel
 
 CreateDeliveryStreamOutcomeCallable FirehoseClient::CreateDeliveryStreamCallable(const CreateDeliveryStreamRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDeliveryStream(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDeliveryStream(request); } );
 }
 
 void FirehoseClient::CreateDeliveryStreamAsync(const CreateDeliveryStreamRequest& request, const CreateDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -124,6 +124,16 @@ void FirehoseClient::CreateDeliveryStreamAsync(const CreateDeliveryStreamRequest
   m_executor->Submit( [this, request, handler, context](){ this->CreateDeliveryStreamAsyncHelper( request, handler, context ); } );
 }
 
+CreateDeliveryStreamOutcomeCallable FirehoseClient::CreateDeliveryStreamCallable(CreateDeliveryStreamRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&FirehoseClient::CreateDeliveryStream, this, std::move(request)));
+}
+
+void FirehoseClient::CreateDeliveryStreamAsync(CreateDeliveryStreamRequest&& request, const CreateDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&FirehoseClient::CreateDeliveryStreamAsyncHelper, this, std::move(request), handler, context);
+}
+
 void FirehoseClient::CreateDeliveryStreamAsyncHelper(const CreateDeliveryStreamRequest& request, const CreateDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDeliveryStream(request), context);
@@ -147,7 +157,7 @@ DeleteDeliveryStreamOutcome FirehoseClient::DeleteDeliveryStream(const DeleteDel
 
 DeleteDeliveryStreamOutcomeCallable FirehoseClient::DeleteDeliveryStreamCallable(const DeleteDeliveryStreamRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDeliveryStream(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDeliveryStream(request); } );
 }
 
 void FirehoseClient::DeleteDeliveryStreamAsync(const DeleteDeliveryStreamRequest& request, const DeleteDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -155,6 +165,16 @@ void FirehoseClient::DeleteDeliveryStreamAsync(const DeleteDeliveryStreamRequest
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDeliveryStreamAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDeliveryStreamOutcomeCallable FirehoseClient::DeleteDeliveryStreamCallable(DeleteDeliveryStreamRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&FirehoseClient::DeleteDeliveryStream, this, std::move(request)));
+}
+
+void FirehoseClient::DeleteDeliveryStreamAsync(DeleteDeliveryStreamRequest&& request, const DeleteDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&FirehoseClient::DeleteDeliveryStreamAsyncHelper, this, std::move(request), handler, context);
+}
+
 void FirehoseClient::DeleteDeliveryStreamAsyncHelper(const DeleteDeliveryStreamRequest& request, const DeleteDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDeliveryStream(request), context);
@@ -178,7 +198,7 @@ DescribeDeliveryStreamOutcome FirehoseClient::DescribeDeliveryStream(const Descr
 
 DescribeDeliveryStreamOutcomeCallable FirehoseClient::DescribeDeliveryStreamCallable(const DescribeDeliveryStreamRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDeliveryStream(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDeliveryStream(request); } );
 }
 
 void FirehoseClient::DescribeDeliveryStreamAsync(const DescribeDeliveryStreamRequest& request, const DescribeDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -186,6 +206,16 @@ void FirehoseClient::DescribeDeliveryStreamAsync(const DescribeDeliveryStreamReq
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDeliveryStreamAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDeliveryStreamOutcomeCallable FirehoseClient::DescribeDeliveryStreamCallable(DescribeDeliveryStreamRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&FirehoseClient::DescribeDeliveryStream, this, std::move(request)));
+}
+
+void FirehoseClient::DescribeDeliveryStreamAsync(DescribeDeliveryStreamRequest&& request, const DescribeDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&FirehoseClient::DescribeDeliveryStreamAsyncHelper, this, std::move(request), handler, context);
+}
+
 void FirehoseClient::DescribeDeliveryStreamAsyncHelper(const DescribeDeliveryStreamRequest& request, const DescribeDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDeliveryStream(request), context);
@@ -209,7 +239,7 @@ ListDeliveryStreamsOutcome FirehoseClient::ListDeliveryStreams(const ListDeliver
 
 ListDeliveryStreamsOutcomeCallable FirehoseClient::ListDeliveryStreamsCallable(const ListDeliveryStreamsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDeliveryStreams(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDeliveryStreams(request); } );
 }
 
 void FirehoseClient::ListDeliveryStreamsAsync(const ListDeliveryStreamsRequest& request, const ListDeliveryStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -217,6 +247,16 @@ void FirehoseClient::ListDeliveryStreamsAsync(const ListDeliveryStreamsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ListDeliveryStreamsAsyncHelper( request, handler, context ); } );
 }
 
+ListDeliveryStreamsOutcomeCallable FirehoseClient::ListDeliveryStreamsCallable(ListDeliveryStreamsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&FirehoseClient::ListDeliveryStreams, this, std::move(request)));
+}
+
+void FirehoseClient::ListDeliveryStreamsAsync(ListDeliveryStreamsRequest&& request, const ListDeliveryStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&FirehoseClient::ListDeliveryStreamsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void FirehoseClient::ListDeliveryStreamsAsyncHelper(const ListDeliveryStreamsRequest& request, const ListDeliveryStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDeliveryStreams(request), context);
@@ -240,7 +280,7 @@ PutRecordOutcome FirehoseClient::PutRecord(const PutRecordRequest& request) cons
 
 PutRecordOutcomeCallable FirehoseClient::PutRecordCallable(const PutRecordRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutRecord(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutRecord(request); } );
 }
 
 void FirehoseClient::PutRecordAsync(const PutRecordRequest& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -248,6 +288,16 @@ void FirehoseClient::PutRecordAsync(const PutRecordRequest& request, const PutRe
   m_executor->Submit( [this, request, handler, context](){ this->PutRecordAsyncHelper( request, handler, context ); } );
 }
 
+PutRecordOutcomeCallable FirehoseClient::PutRecordCallable(PutRecordRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&FirehoseClient::PutRecord, this, std::move(request)));
+}
+
+void FirehoseClient::PutRecordAsync(PutRecordRequest&& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&FirehoseClient::PutRecordAsyncHelper, this, std::move(request), handler, context);
+}
+
 void FirehoseClient::PutRecordAsyncHelper(const PutRecordRequest& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutRecord(request), context);
@@ -271,7 +321,7 @@ PutRecordBatchOutcome FirehoseClient::PutRecordBatch(const PutRecordBatchRequest
 
 PutRecordBatchOutcomeCallable FirehoseClient::PutRecordBatchCallable(const PutRecordBatchRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutRecordBatch(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutRecordBatch(request); } );
 }
 
 void FirehoseClient::PutRecordBatchAsync(const PutRecordBatchRequest& request, const PutRecordBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -279,6 +329,16 @@ void FirehoseClient::PutRecordBatchAsync(const PutRecordBatchRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->PutRecordBatchAsyncHelper( request, handler, context ); } );
 }
 
+PutRecordBatchOutcomeCallable FirehoseClient::PutRecordBatchCallable(PutRecordBatchRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&FirehoseClient::PutRecordBatch, this, std::move(request)));
+}
+
+void FirehoseClient::PutRecordBatchAsync(PutRecordBatchRequest&& request, const PutRecordBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&FirehoseClient::PutRecordBatchAsyncHelper, this, std::move(request), handler, context);
+}
+
 void FirehoseClient::PutRecordBatchAsyncHelper(const PutRecordBatchRequest& request, const PutRecordBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutRecordBatch(request), context);
@@ -302,7 +362,7 @@ UpdateDestinationOutcome FirehoseClient::UpdateDestination(const UpdateDestinati
 
 UpdateDestinationOutcomeCallable FirehoseClient::UpdateDestinationCallable(const UpdateDestinationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateDestination(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateDestination(request); } );
 }
 
 void FirehoseClient::UpdateDestinationAsync(const UpdateDestinationRequest& request, const UpdateDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -310,8 +370,83 @@ void FirehoseClient::UpdateDestinationAsync(const UpdateDestinationRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->UpdateDestinationAsyncHelper( request, handler, context ); } );
 }
 
+UpdateDestinationOutcomeCallable FirehoseClient::UpdateDestinationCallable(UpdateDestinationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&FirehoseClient::UpdateDestination, this, std::move(request)));
+}
+
+void FirehoseClient::UpdateDestinationAsync(UpdateDestinationRequest&& request, const UpdateDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&FirehoseClient::UpdateDestinationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void FirehoseClient::UpdateDestinationAsyncHelper(const UpdateDestinationRequest& request, const UpdateDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateDestination(request), context);
 }
 
+std::shared_ptr<BatchAccumulator<PutRecordBatchRequest, Record>> FirehoseClient::PutRecordBatchAccumulator(const PutRecordBatchRequest& requestTemplate, const BatchAccumulatorConfiguration& config) const
+{
+  return Aws::MakeShared<BatchAccumulator<PutRecordBatchRequest, Record>>(ALLOCATION_TAG, requestTemplate, 500, 4194304, config,
+    [](const Record& entry) { return entry.GetData().GetLength(); },
+    [this](const PutRecordBatchRequest& requestTemplate, Aws::Vector<Record>&& batch, Aws::Vector<BatchEntryFailure<Record>>& failures)
+    {
+      PutRecordBatchRequest request(requestTemplate);
+      request.SetRecords(batch);
+      auto outcome = PutRecordBatch(request);
+      if(!outcome.IsSuccess())
+      {
+        for(size_t i = 0; i < batch.size(); ++i)
+        {
+          failures.emplace_back(i, std::move(batch[i]), outcome.GetError().GetMessage(), outcome.GetError().ShouldRetry());
+        }
+        return;
+      }
+      const auto& results = outcome.GetResult().GetRequestResponses();
+      for(size_t i = 0; i < batch.size() && i < results.size(); ++i)
+      {
+        if(!results[i].GetErrorCode().empty())
+        {
+          failures.emplace_back(i, std::move(batch[i]), results[i].GetErrorMessage(), true);
+        }
+      }
+    }, GetRetryStrategy());
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<FirehoseClient, CreateDeliveryStreamRequest, CreateDeliveryStreamOutcome> FirehoseClient::CreateDeliveryStreamAwaitable(CreateDeliveryStreamRequest request) const
+{
+  return { m_executor.get(), { this, &FirehoseClient::CreateDeliveryStream, std::move(request) } };
+}
+
+ClientOperationAwaitable<FirehoseClient, DeleteDeliveryStreamRequest, DeleteDeliveryStreamOutcome> FirehoseClient::DeleteDeliveryStreamAwaitable(DeleteDeliveryStreamRequest request) const
+{
+  return { m_executor.get(), { this, &FirehoseClient::DeleteDeliveryStream, std::move(request) } };
+}
+
+ClientOperationAwaitable<FirehoseClient, DescribeDeliveryStreamRequest, DescribeDeliveryStreamOutcome> FirehoseClient::DescribeDeliveryStreamAwaitable(DescribeDeliveryStreamRequest request) const
+{
+  return { m_executor.get(), { this, &FirehoseClient::DescribeDeliveryStream, std::move(request) } };
+}
+
+ClientOperationAwaitable<FirehoseClient, ListDeliveryStreamsRequest, ListDeliveryStreamsOutcome> FirehoseClient::ListDeliveryStreamsAwaitable(ListDeliveryStreamsRequest request) const
+{
+  return { m_executor.get(), { this, &FirehoseClient::ListDeliveryStreams, std::move(request) } };
+}
+
+ClientOperationAwaitable<FirehoseClient, PutRecordRequest, PutRecordOutcome> FirehoseClient::PutRecordAwaitable(PutRecordRequest request) const
+{
+  return { m_executor.get(), { this, &FirehoseClient::PutRecord, std::move(request) } };
+}
+
+ClientOperationAwaitable<FirehoseClient, PutRecordBatchRequest, PutRecordBatchOutcome> FirehoseClient::PutRecordBatchAwaitable(PutRecordBatchRequest request) const
+{
+  return { m_executor.get(), { this, &FirehoseClient::PutRecordBatch, std::move(request) } };
+}
+
+ClientOperationAwaitable<FirehoseClient, UpdateDestinationRequest, UpdateDestinationOutcome> FirehoseClient::UpdateDestinationAwaitable(UpdateDestinationRequest request) const
+{
+  return { m_executor.get(), { this, &FirehoseClient::UpdateDestination, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
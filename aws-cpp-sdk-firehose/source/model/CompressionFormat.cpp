@@ -29,31 +29,35 @@ namespace Aws
       namespace CompressionFormatMapper
       {
 
-        static const int UNCOMPRESSED_HASH = HashingUtils::HashString("UNCOMPRESSED");
-        static const int GZIP_HASH = HashingUtils::HashString("GZIP");
-        static const int ZIP_HASH = HashingUtils::HashString("ZIP");
-        static const int Snappy_HASH = HashingUtils::HashString("Snappy");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int UNCOMPRESSED_HASH = -225512742;
+        static const int GZIP_HASH = 2203994;
+        static const int ZIP_HASH = 88833;
+        static const int Snappy_HASH = -1814159501;
 
 
         CompressionFormat GetCompressionFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNCOMPRESSED_HASH)
+          switch (hashCode)
           {
+          case UNCOMPRESSED_HASH:
             return CompressionFormat::UNCOMPRESSED;
-          }
-          else if (hashCode == GZIP_HASH)
-          {
+          case GZIP_HASH:
             return CompressionFormat::GZIP;
-          }
-          else if (hashCode == ZIP_HASH)
-          {
+          case ZIP_HASH:
             return CompressionFormat::ZIP;
-          }
-          else if (hashCode == Snappy_HASH)
-          {
+          case Snappy_HASH:
             return CompressionFormat::Snappy;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,36 +29,38 @@ namespace Aws
       namespace ElasticsearchIndexRotationPeriodMapper
       {
 
-        static const int NoRotation_HASH = HashingUtils::HashString("NoRotation");
-        static const int OneHour_HASH = HashingUtils::HashString("OneHour");
-        static const int OneDay_HASH = HashingUtils::HashString("OneDay");
-        static const int OneWeek_HASH = HashingUtils::HashString("OneWeek");
-        static const int OneMonth_HASH = HashingUtils::HashString("OneMonth");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int NoRotation_HASH = -1182790529;
+        static const int OneHour_HASH = 343084362;
+        static const int OneDay_HASH = -1928599690;
+        static const int OneWeek_HASH = 343521114;
+        static const int OneMonth_HASH = 2050291674;
 
 
         ElasticsearchIndexRotationPeriod GetElasticsearchIndexRotationPeriodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NoRotation_HASH)
+          switch (hashCode)
           {
+          case NoRotation_HASH:
             return ElasticsearchIndexRotationPeriod::NoRotation;
-          }
-          else if (hashCode == OneHour_HASH)
-          {
+          case OneHour_HASH:
             return ElasticsearchIndexRotationPeriod::OneHour;
-          }
-          else if (hashCode == OneDay_HASH)
-          {
+          case OneDay_HASH:
             return ElasticsearchIndexRotationPeriod::OneDay;
-          }
-          else if (hashCode == OneWeek_HASH)
-          {
+          case OneWeek_HASH:
             return ElasticsearchIndexRotationPeriod::OneWeek;
-          }
-          else if (hashCode == OneMonth_HASH)
-          {
+          case OneMonth_HASH:
             return ElasticsearchIndexRotationPeriod::OneMonth;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace ElasticsearchS3BackupModeMapper
       {
 
-        static const int FailedDocumentsOnly_HASH = HashingUtils::HashString("FailedDocumentsOnly");
-        static const int AllDocuments_HASH = HashingUtils::HashString("AllDocuments");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int FailedDocumentsOnly_HASH = 879802663;
+        static const int AllDocuments_HASH = -2092854729;
 
 
         ElasticsearchS3BackupMode GetElasticsearchS3BackupModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FailedDocumentsOnly_HASH)
+          switch (hashCode)
           {
+          case FailedDocumentsOnly_HASH:
             return ElasticsearchS3BackupMode::FailedDocumentsOnly;
-          }
-          else if (hashCode == AllDocuments_HASH)
-          {
+          case AllDocuments_HASH:
             return ElasticsearchS3BackupMode::AllDocuments;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
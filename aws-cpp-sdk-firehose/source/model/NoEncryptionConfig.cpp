@@ -29,16 +29,26 @@ namespace Aws
       namespace NoEncryptionConfigMapper
       {
 
-        static const int NoEncryption_HASH = HashingUtils::HashString("NoEncryption");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int NoEncryption_HASH = 66244676;
 
 
         NoEncryptionConfig GetNoEncryptionConfigForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NoEncryption_HASH)
+          switch (hashCode)
           {
+          case NoEncryption_HASH:
             return NoEncryptionConfig::NoEncryption;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
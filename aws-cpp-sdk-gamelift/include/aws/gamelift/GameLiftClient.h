@@ -56,6 +56,9 @@
 #include <aws/gamelift/model/UpdateRuntimeConfigurationResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -392,6 +395,18 @@ namespace Model
          */
         virtual void CreateAliasAsync(const Model::CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAliasCallable(const Model::CreateAliasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateAliasOutcomeCallable CreateAliasCallable(Model::CreateAliasRequest&& request) const;
+
+        /**
+         * Same as CreateAliasAsync(const Model::CreateAliasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateAliasAsync(Model::CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Initializes a new build record and generates information required to upload a
          * game build to Amazon GameLift. Once the build record has been created and its
@@ -456,6 +471,18 @@ namespace Model
          */
         virtual void CreateBuildAsync(const Model::CreateBuildRequest& request, const CreateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateBuildCallable(const Model::CreateBuildRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateBuildOutcomeCallable CreateBuildCallable(Model::CreateBuildRequest&& request) const;
+
+        /**
+         * Same as CreateBuildAsync(const Model::CreateBuildRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateBuildAsync(Model::CreateBuildRequest&& request, const CreateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new fleet to run your game servers. A fleet is a set of Amazon
          * Elastic Compute Cloud (Amazon EC2) instances, each of which can run multiple
@@ -568,6 +595,18 @@ namespace Model
          */
         virtual void CreateFleetAsync(const Model::CreateFleetRequest& request, const CreateFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateFleetCallable(const Model::CreateFleetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateFleetOutcomeCallable CreateFleetCallable(Model::CreateFleetRequest&& request) const;
+
+        /**
+         * Same as CreateFleetAsync(const Model::CreateFleetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateFleetAsync(Model::CreateFleetRequest&& request, const CreateFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a multiplayer game session for players. This action creates a game
          * session record and assigns the new session to an instance in the specified
@@ -617,6 +656,18 @@ namespace Model
          */
         virtual void CreateGameSessionAsync(const Model::CreateGameSessionRequest& request, const CreateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateGameSessionCallable(const Model::CreateGameSessionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateGameSessionOutcomeCallable CreateGameSessionCallable(Model::CreateGameSessionRequest&& request) const;
+
+        /**
+         * Same as CreateGameSessionAsync(const Model::CreateGameSessionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateGameSessionAsync(Model::CreateGameSessionRequest&& request, const CreateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds a player to a game session and creates a player session record. A game
          * session must be in an <code>ACTIVE</code> status, have a creation policy of
@@ -651,6 +702,18 @@ namespace Model
          */
         virtual void CreatePlayerSessionAsync(const Model::CreatePlayerSessionRequest& request, const CreatePlayerSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePlayerSessionCallable(const Model::CreatePlayerSessionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreatePlayerSessionOutcomeCallable CreatePlayerSessionCallable(Model::CreatePlayerSessionRequest&& request) const;
+
+        /**
+         * Same as CreatePlayerSessionAsync(const Model::CreatePlayerSessionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreatePlayerSessionAsync(Model::CreatePlayerSessionRequest&& request, const CreatePlayerSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds a group of players to a game session. Similar to
          * <a>CreatePlayerSession</a>, this action allows you to add multiple players in a
@@ -694,6 +757,18 @@ namespace Model
          */
         virtual void CreatePlayerSessionsAsync(const Model::CreatePlayerSessionsRequest& request, const CreatePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePlayerSessionsCallable(const Model::CreatePlayerSessionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreatePlayerSessionsOutcomeCallable CreatePlayerSessionsCallable(Model::CreatePlayerSessionsRequest&& request) const;
+
+        /**
+         * Same as CreatePlayerSessionsAsync(const Model::CreatePlayerSessionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreatePlayerSessionsAsync(Model::CreatePlayerSessionsRequest&& request, const CreatePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an alias. This action removes all record of the alias; game clients
          * attempting to access a server process using the deleted alias receive an error.
@@ -719,6 +794,18 @@ namespace Model
          */
         virtual void DeleteAliasAsync(const Model::DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAliasCallable(const Model::DeleteAliasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteAliasOutcomeCallable DeleteAliasCallable(Model::DeleteAliasRequest&& request) const;
+
+        /**
+         * Same as DeleteAliasAsync(const Model::DeleteAliasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteAliasAsync(Model::DeleteAliasRequest&& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a build. This action permanently deletes the build record and any
          * uploaded build files.</p> <p>To delete a build, specify its ID. Deleting a build
@@ -747,6 +834,18 @@ namespace Model
          */
         virtual void DeleteBuildAsync(const Model::DeleteBuildRequest& request, const DeleteBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBuildCallable(const Model::DeleteBuildRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteBuildOutcomeCallable DeleteBuildCallable(Model::DeleteBuildRequest&& request) const;
+
+        /**
+         * Same as DeleteBuildAsync(const Model::DeleteBuildRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteBuildAsync(Model::DeleteBuildRequest&& request, const DeleteBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes everything related to a fleet. Before deleting a fleet, you must set
          * the fleet's desired capacity to zero. See <a>UpdateFleetCapacity</a>.</p>
@@ -775,6 +874,18 @@ namespace Model
          */
         virtual void DeleteFleetAsync(const Model::DeleteFleetRequest& request, const DeleteFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteFleetCallable(const Model::DeleteFleetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteFleetOutcomeCallable DeleteFleetCallable(Model::DeleteFleetRequest&& request) const;
+
+        /**
+         * Same as DeleteFleetAsync(const Model::DeleteFleetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteFleetAsync(Model::DeleteFleetRequest&& request, const DeleteFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a fleet scaling policy. This action means that the policy is no
          * longer in force and removes all record of it. To delete a scaling policy,
@@ -803,6 +914,18 @@ namespace Model
          */
         virtual void DeleteScalingPolicyAsync(const Model::DeleteScalingPolicyRequest& request, const DeleteScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteScalingPolicyCallable(const Model::DeleteScalingPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteScalingPolicyOutcomeCallable DeleteScalingPolicyCallable(Model::DeleteScalingPolicyRequest&& request) const;
+
+        /**
+         * Same as DeleteScalingPolicyAsync(const Model::DeleteScalingPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteScalingPolicyAsync(Model::DeleteScalingPolicyRequest&& request, const DeleteScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves properties for a specified alias. To get the alias, specify an
          * alias ID. If successful, an <a>Alias</a> object is returned.</p>
@@ -825,6 +948,18 @@ namespace Model
          */
         virtual void DescribeAliasAsync(const Model::DescribeAliasRequest& request, const DescribeAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAliasCallable(const Model::DescribeAliasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAliasOutcomeCallable DescribeAliasCallable(Model::DescribeAliasRequest&& request) const;
+
+        /**
+         * Same as DescribeAliasAsync(const Model::DescribeAliasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAliasAsync(Model::DescribeAliasRequest&& request, const DescribeAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves properties for a build. To get a build record, specify a build ID.
          * If successful, an object containing the build properties is returned.</p>
@@ -847,6 +982,18 @@ namespace Model
          */
         virtual void DescribeBuildAsync(const Model::DescribeBuildRequest& request, const DescribeBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeBuildCallable(const Model::DescribeBuildRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeBuildOutcomeCallable DescribeBuildCallable(Model::DescribeBuildRequest&& request) const;
+
+        /**
+         * Same as DescribeBuildAsync(const Model::DescribeBuildRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeBuildAsync(Model::DescribeBuildRequest&& request, const DescribeBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the following information for the specified EC2 instance type:</p>
          * <ul> <li>maximum number of instances allowed per AWS account (service
@@ -881,6 +1028,18 @@ namespace Model
          */
         virtual void DescribeEC2InstanceLimitsAsync(const Model::DescribeEC2InstanceLimitsRequest& request, const DescribeEC2InstanceLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEC2InstanceLimitsCallable(const Model::DescribeEC2InstanceLimitsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEC2InstanceLimitsOutcomeCallable DescribeEC2InstanceLimitsCallable(Model::DescribeEC2InstanceLimitsRequest&& request) const;
+
+        /**
+         * Same as DescribeEC2InstanceLimitsAsync(const Model::DescribeEC2InstanceLimitsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEC2InstanceLimitsAsync(Model::DescribeEC2InstanceLimitsRequest&& request, const DescribeEC2InstanceLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves fleet properties, including metadata, status, and configuration,
          * for one or more fleets. You can request attributes for all fleets, or specify a
@@ -924,6 +1083,18 @@ namespace Model
          */
         virtual void DescribeFleetAttributesAsync(const Model::DescribeFleetAttributesRequest& request, const DescribeFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFleetAttributesCallable(const Model::DescribeFleetAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeFleetAttributesOutcomeCallable DescribeFleetAttributesCallable(Model::DescribeFleetAttributesRequest&& request) const;
+
+        /**
+         * Same as DescribeFleetAttributesAsync(const Model::DescribeFleetAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeFleetAttributesAsync(Model::DescribeFleetAttributesRequest&& request, const DescribeFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the current status of fleet capacity for one or more fleets. This
          * information includes the number of instances that have been requested for the
@@ -970,6 +1141,18 @@ namespace Model
          */
         virtual void DescribeFleetCapacityAsync(const Model::DescribeFleetCapacityRequest& request, const DescribeFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFleetCapacityCallable(const Model::DescribeFleetCapacityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeFleetCapacityOutcomeCallable DescribeFleetCapacityCallable(Model::DescribeFleetCapacityRequest&& request) const;
+
+        /**
+         * Same as DescribeFleetCapacityAsync(const Model::DescribeFleetCapacityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeFleetCapacityAsync(Model::DescribeFleetCapacityRequest&& request, const DescribeFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves entries from the specified fleet's event log. You can specify a
          * time range to limit the result set. Use the pagination parameters to retrieve
@@ -998,6 +1181,18 @@ namespace Model
          */
         virtual void DescribeFleetEventsAsync(const Model::DescribeFleetEventsRequest& request, const DescribeFleetEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFleetEventsCallable(const Model::DescribeFleetEventsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeFleetEventsOutcomeCallable DescribeFleetEventsCallable(Model::DescribeFleetEventsRequest&& request) const;
+
+        /**
+         * Same as DescribeFleetEventsAsync(const Model::DescribeFleetEventsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeFleetEventsAsync(Model::DescribeFleetEventsRequest&& request, const DescribeFleetEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the inbound connection permissions for a fleet. Connection
          * permissions include a range of IP addresses and port settings that incoming
@@ -1032,6 +1227,18 @@ namespace Model
          */
         virtual void DescribeFleetPortSettingsAsync(const Model::DescribeFleetPortSettingsRequest& request, const DescribeFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFleetPortSettingsCallable(const Model::DescribeFleetPortSettingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeFleetPortSettingsOutcomeCallable DescribeFleetPortSettingsCallable(Model::DescribeFleetPortSettingsRequest&& request) const;
+
+        /**
+         * Same as DescribeFleetPortSettingsAsync(const Model::DescribeFleetPortSettingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeFleetPortSettingsAsync(Model::DescribeFleetPortSettingsRequest&& request, const DescribeFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves utilization statistics for one or more fleets. You can request
          * utilization data for all fleets, or specify a list of one or more fleet IDs.
@@ -1075,6 +1282,18 @@ namespace Model
          */
         virtual void DescribeFleetUtilizationAsync(const Model::DescribeFleetUtilizationRequest& request, const DescribeFleetUtilizationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFleetUtilizationCallable(const Model::DescribeFleetUtilizationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeFleetUtilizationOutcomeCallable DescribeFleetUtilizationCallable(Model::DescribeFleetUtilizationRequest&& request) const;
+
+        /**
+         * Same as DescribeFleetUtilizationAsync(const Model::DescribeFleetUtilizationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeFleetUtilizationAsync(Model::DescribeFleetUtilizationRequest&& request, const DescribeFleetUtilizationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves properties, including the protection policy in force, for one or
          * more game sessions. This action can be used in several ways: (1) provide a
@@ -1121,6 +1340,18 @@ namespace Model
          */
         virtual void DescribeGameSessionDetailsAsync(const Model::DescribeGameSessionDetailsRequest& request, const DescribeGameSessionDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeGameSessionDetailsCallable(const Model::DescribeGameSessionDetailsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeGameSessionDetailsOutcomeCallable DescribeGameSessionDetailsCallable(Model::DescribeGameSessionDetailsRequest&& request) const;
+
+        /**
+         * Same as DescribeGameSessionDetailsAsync(const Model::DescribeGameSessionDetailsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeGameSessionDetailsAsync(Model::DescribeGameSessionDetailsRequest&& request, const DescribeGameSessionDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves properties for one or more game sessions. This action can be used
          * in several ways: (1) provide a <code>GameSessionId</code> to request properties
@@ -1164,6 +1395,18 @@ namespace Model
          */
         virtual void DescribeGameSessionsAsync(const Model::DescribeGameSessionsRequest& request, const DescribeGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeGameSessionsCallable(const Model::DescribeGameSessionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeGameSessionsOutcomeCallable DescribeGameSessionsCallable(Model::DescribeGameSessionsRequest&& request) const;
+
+        /**
+         * Same as DescribeGameSessionsAsync(const Model::DescribeGameSessionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeGameSessionsAsync(Model::DescribeGameSessionsRequest&& request, const DescribeGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves properties for one or more player sessions. This action can be used
          * in several ways: (1) provide a <code>PlayerSessionId</code> parameter to request
@@ -1213,6 +1456,18 @@ namespace Model
          */
         virtual void DescribePlayerSessionsAsync(const Model::DescribePlayerSessionsRequest& request, const DescribePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribePlayerSessionsCallable(const Model::DescribePlayerSessionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribePlayerSessionsOutcomeCallable DescribePlayerSessionsCallable(Model::DescribePlayerSessionsRequest&& request) const;
+
+        /**
+         * Same as DescribePlayerSessionsAsync(const Model::DescribePlayerSessionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribePlayerSessionsAsync(Model::DescribePlayerSessionsRequest&& request, const DescribePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the current runtime configuration for the specified fleet. The
          * runtime configuration tells GameLift how to launch server processes on instances
@@ -1238,6 +1493,18 @@ namespace Model
          */
         virtual void DescribeRuntimeConfigurationAsync(const Model::DescribeRuntimeConfigurationRequest& request, const DescribeRuntimeConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRuntimeConfigurationCallable(const Model::DescribeRuntimeConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeRuntimeConfigurationOutcomeCallable DescribeRuntimeConfigurationCallable(Model::DescribeRuntimeConfigurationRequest&& request) const;
+
+        /**
+         * Same as DescribeRuntimeConfigurationAsync(const Model::DescribeRuntimeConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeRuntimeConfigurationAsync(Model::DescribeRuntimeConfigurationRequest&& request, const DescribeRuntimeConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves all scaling policies applied to a fleet. </p> <p>To get a fleet's
          * scaling policies, specify the fleet ID. You can filter this request by policy
@@ -1269,6 +1536,18 @@ namespace Model
          */
         virtual void DescribeScalingPoliciesAsync(const Model::DescribeScalingPoliciesRequest& request, const DescribeScalingPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScalingPoliciesCallable(const Model::DescribeScalingPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeScalingPoliciesOutcomeCallable DescribeScalingPoliciesCallable(Model::DescribeScalingPoliciesRequest&& request) const;
+
+        /**
+         * Same as DescribeScalingPoliciesAsync(const Model::DescribeScalingPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeScalingPoliciesAsync(Model::DescribeScalingPoliciesRequest&& request, const DescribeScalingPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the location of stored game session logs for a specified game
          * session. When a game session is terminated, Amazon GameLift automatically stores
@@ -1306,6 +1585,18 @@ namespace Model
          */
         virtual void GetGameSessionLogUrlAsync(const Model::GetGameSessionLogUrlRequest& request, const GetGameSessionLogUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetGameSessionLogUrlCallable(const Model::GetGameSessionLogUrlRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetGameSessionLogUrlOutcomeCallable GetGameSessionLogUrlCallable(Model::GetGameSessionLogUrlRequest&& request) const;
+
+        /**
+         * Same as GetGameSessionLogUrlAsync(const Model::GetGameSessionLogUrlRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetGameSessionLogUrlAsync(Model::GetGameSessionLogUrlRequest&& request, const GetGameSessionLogUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a collection of alias records for this AWS account. You can filter
          * the result set by alias name and/or routing strategy type. Use the pagination
@@ -1334,6 +1625,18 @@ namespace Model
          */
         virtual void ListAliasesAsync(const Model::ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAliasesCallable(const Model::ListAliasesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAliasesOutcomeCallable ListAliasesCallable(Model::ListAliasesRequest&& request) const;
+
+        /**
+         * Same as ListAliasesAsync(const Model::ListAliasesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAliasesAsync(Model::ListAliasesRequest&& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves build records for all builds associated with the AWS account in
          * use. You can limit results to builds that are in a specific status by using the
@@ -1365,6 +1668,18 @@ namespace Model
          */
         virtual void ListBuildsAsync(const Model::ListBuildsRequest& request, const ListBuildsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListBuildsCallable(const Model::ListBuildsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListBuildsOutcomeCallable ListBuildsCallable(Model::ListBuildsRequest&& request) const;
+
+        /**
+         * Same as ListBuildsAsync(const Model::ListBuildsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListBuildsAsync(Model::ListBuildsRequest&& request, const ListBuildsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a collection of fleet records for this AWS account. You can filter
          * the result set by build ID. Use the pagination parameters to retrieve results in
@@ -1393,6 +1708,18 @@ namespace Model
          */
         virtual void ListFleetsAsync(const Model::ListFleetsRequest& request, const ListFleetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListFleetsCallable(const Model::ListFleetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListFleetsOutcomeCallable ListFleetsCallable(Model::ListFleetsRequest&& request) const;
+
+        /**
+         * Same as ListFleetsAsync(const Model::ListFleetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListFleetsAsync(Model::ListFleetsRequest&& request, const ListFleetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates a scaling policy for a fleet. An active scaling policy
          * prompts Amazon GameLift to track a certain metric for a fleet and automatically
@@ -1463,6 +1790,18 @@ namespace Model
          */
         virtual void PutScalingPolicyAsync(const Model::PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutScalingPolicyCallable(const Model::PutScalingPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutScalingPolicyOutcomeCallable PutScalingPolicyCallable(Model::PutScalingPolicyRequest&& request) const;
+
+        /**
+         * Same as PutScalingPolicyAsync(const Model::PutScalingPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutScalingPolicyAsync(Model::PutScalingPolicyRequest&& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a fresh set of upload credentials and the assigned Amazon S3
          * storage location for a specific build. Valid credentials are required to upload
@@ -1512,6 +1851,18 @@ namespace Model
          */
         virtual void RequestUploadCredentialsAsync(const Model::RequestUploadCredentialsRequest& request, const RequestUploadCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RequestUploadCredentialsCallable(const Model::RequestUploadCredentialsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RequestUploadCredentialsOutcomeCallable RequestUploadCredentialsCallable(Model::RequestUploadCredentialsRequest&& request) const;
+
+        /**
+         * Same as RequestUploadCredentialsAsync(const Model::RequestUploadCredentialsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RequestUploadCredentialsAsync(Model::RequestUploadCredentialsRequest&& request, const RequestUploadCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the fleet ID that a specified alias is currently pointing to. </p>
          */
@@ -1531,6 +1882,18 @@ namespace Model
          */
         virtual void ResolveAliasAsync(const Model::ResolveAliasRequest& request, const ResolveAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResolveAliasCallable(const Model::ResolveAliasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResolveAliasOutcomeCallable ResolveAliasCallable(Model::ResolveAliasRequest&& request) const;
+
+        /**
+         * Same as ResolveAliasAsync(const Model::ResolveAliasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResolveAliasAsync(Model::ResolveAliasRequest&& request, const ResolveAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a list of game sessions in a fleet that match a set of search
          * criteria and sorts them in a specified order. Currently game session searches
@@ -1640,6 +2003,18 @@ namespace Model
          */
         virtual void SearchGameSessionsAsync(const Model::SearchGameSessionsRequest& request, const SearchGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SearchGameSessionsCallable(const Model::SearchGameSessionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SearchGameSessionsOutcomeCallable SearchGameSessionsCallable(Model::SearchGameSessionsRequest&& request) const;
+
+        /**
+         * Same as SearchGameSessionsAsync(const Model::SearchGameSessionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SearchGameSessionsAsync(Model::SearchGameSessionsRequest&& request, const SearchGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates properties for an alias. To update properties, specify the alias ID
          * to be updated and provide the information to be changed. To reassign an alias to
@@ -1668,6 +2043,18 @@ namespace Model
          */
         virtual void UpdateAliasAsync(const Model::UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAliasCallable(const Model::UpdateAliasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateAliasOutcomeCallable UpdateAliasCallable(Model::UpdateAliasRequest&& request) const;
+
+        /**
+         * Same as UpdateAliasAsync(const Model::UpdateAliasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateAliasAsync(Model::UpdateAliasRequest&& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates metadata in a build record, including the build name and version. To
          * update the metadata, specify the build ID to update and provide the new values.
@@ -1693,6 +2080,18 @@ namespace Model
          */
         virtual void UpdateBuildAsync(const Model::UpdateBuildRequest& request, const UpdateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateBuildCallable(const Model::UpdateBuildRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateBuildOutcomeCallable UpdateBuildCallable(Model::UpdateBuildRequest&& request) const;
+
+        /**
+         * Same as UpdateBuildAsync(const Model::UpdateBuildRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateBuildAsync(Model::UpdateBuildRequest&& request, const UpdateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates fleet properties, including name and description, for a fleet. To
          * update metadata, specify the fleet ID and the property values you want to
@@ -1718,6 +2117,18 @@ namespace Model
          */
         virtual void UpdateFleetAttributesAsync(const Model::UpdateFleetAttributesRequest& request, const UpdateFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateFleetAttributesCallable(const Model::UpdateFleetAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateFleetAttributesOutcomeCallable UpdateFleetAttributesCallable(Model::UpdateFleetAttributesRequest&& request) const;
+
+        /**
+         * Same as UpdateFleetAttributesAsync(const Model::UpdateFleetAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateFleetAttributesAsync(Model::UpdateFleetAttributesRequest&& request, const UpdateFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates capacity settings for a fleet. Use this action to specify the number
          * of EC2 instances (hosts) that you want this fleet to contain. Before calling
@@ -1776,6 +2187,18 @@ namespace Model
          */
         virtual void UpdateFleetCapacityAsync(const Model::UpdateFleetCapacityRequest& request, const UpdateFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateFleetCapacityCallable(const Model::UpdateFleetCapacityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateFleetCapacityOutcomeCallable UpdateFleetCapacityCallable(Model::UpdateFleetCapacityRequest&& request) const;
+
+        /**
+         * Same as UpdateFleetCapacityAsync(const Model::UpdateFleetCapacityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateFleetCapacityAsync(Model::UpdateFleetCapacityRequest&& request, const UpdateFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates port settings for a fleet. To update settings, specify the fleet ID
          * to be updated and list the permissions you want to update. List the permissions
@@ -1810,6 +2233,18 @@ namespace Model
          */
         virtual void UpdateFleetPortSettingsAsync(const Model::UpdateFleetPortSettingsRequest& request, const UpdateFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateFleetPortSettingsCallable(const Model::UpdateFleetPortSettingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateFleetPortSettingsOutcomeCallable UpdateFleetPortSettingsCallable(Model::UpdateFleetPortSettingsRequest&& request) const;
+
+        /**
+         * Same as UpdateFleetPortSettingsAsync(const Model::UpdateFleetPortSettingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateFleetPortSettingsAsync(Model::UpdateFleetPortSettingsRequest&& request, const UpdateFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates game session properties. This includes the session name, maximum
          * player count, protection policy, which controls whether or not an active game
@@ -1844,6 +2279,18 @@ namespace Model
          */
         virtual void UpdateGameSessionAsync(const Model::UpdateGameSessionRequest& request, const UpdateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateGameSessionCallable(const Model::UpdateGameSessionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateGameSessionOutcomeCallable UpdateGameSessionCallable(Model::UpdateGameSessionRequest&& request) const;
+
+        /**
+         * Same as UpdateGameSessionAsync(const Model::UpdateGameSessionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateGameSessionAsync(Model::UpdateGameSessionRequest&& request, const UpdateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the current runtime configuration for the specified fleet, which
          * tells GameLift how to launch server processes on instances in the fleet. You can
@@ -1902,6 +2349,270 @@ namespace Model
          */
         virtual void UpdateRuntimeConfigurationAsync(const Model::UpdateRuntimeConfigurationRequest& request, const UpdateRuntimeConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateRuntimeConfigurationCallable(const Model::UpdateRuntimeConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateRuntimeConfigurationOutcomeCallable UpdateRuntimeConfigurationCallable(Model::UpdateRuntimeConfigurationRequest&& request) const;
+
+        /**
+         * Same as UpdateRuntimeConfigurationAsync(const Model::UpdateRuntimeConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateRuntimeConfigurationAsync(Model::UpdateRuntimeConfigurationRequest&& request, const UpdateRuntimeConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeFleetAttributes(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GameLiftClient, Model::DescribeFleetAttributesRequest, Model::DescribeFleetAttributesOutcome> DescribeFleetAttributesPaginator(const Model::DescribeFleetAttributesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeFleetCapacity(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GameLiftClient, Model::DescribeFleetCapacityRequest, Model::DescribeFleetCapacityOutcome> DescribeFleetCapacityPaginator(const Model::DescribeFleetCapacityRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeFleetEvents(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GameLiftClient, Model::DescribeFleetEventsRequest, Model::DescribeFleetEventsOutcome> DescribeFleetEventsPaginator(const Model::DescribeFleetEventsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeFleetUtilization(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GameLiftClient, Model::DescribeFleetUtilizationRequest, Model::DescribeFleetUtilizationOutcome> DescribeFleetUtilizationPaginator(const Model::DescribeFleetUtilizationRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeGameSessionDetails(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GameLiftClient, Model::DescribeGameSessionDetailsRequest, Model::DescribeGameSessionDetailsOutcome> DescribeGameSessionDetailsPaginator(const Model::DescribeGameSessionDetailsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeGameSessions(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GameLiftClient, Model::DescribeGameSessionsRequest, Model::DescribeGameSessionsOutcome> DescribeGameSessionsPaginator(const Model::DescribeGameSessionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribePlayerSessions(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GameLiftClient, Model::DescribePlayerSessionsRequest, Model::DescribePlayerSessionsOutcome> DescribePlayerSessionsPaginator(const Model::DescribePlayerSessionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeScalingPolicies(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GameLiftClient, Model::DescribeScalingPoliciesRequest, Model::DescribeScalingPoliciesOutcome> DescribeScalingPoliciesPaginator(const Model::DescribeScalingPoliciesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListAliases(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GameLiftClient, Model::ListAliasesRequest, Model::ListAliasesOutcome> ListAliasesPaginator(const Model::ListAliasesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListBuilds(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GameLiftClient, Model::ListBuildsRequest, Model::ListBuildsOutcome> ListBuildsPaginator(const Model::ListBuildsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListFleets(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GameLiftClient, Model::ListFleetsRequest, Model::ListFleetsOutcome> ListFleetsPaginator(const Model::ListFleetsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through SearchGameSessions(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GameLiftClient, Model::SearchGameSessionsRequest, Model::SearchGameSessionsOutcome> SearchGameSessionsPaginator(const Model::SearchGameSessionsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CreateAlias(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::CreateAliasRequest, Model::CreateAliasOutcome> CreateAliasAwaitable(Model::CreateAliasRequest request) const;
+
+        /**
+         * co_await-able form of CreateBuild(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::CreateBuildRequest, Model::CreateBuildOutcome> CreateBuildAwaitable(Model::CreateBuildRequest request) const;
+
+        /**
+         * co_await-able form of CreateFleet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::CreateFleetRequest, Model::CreateFleetOutcome> CreateFleetAwaitable(Model::CreateFleetRequest request) const;
+
+        /**
+         * co_await-able form of CreateGameSession(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::CreateGameSessionRequest, Model::CreateGameSessionOutcome> CreateGameSessionAwaitable(Model::CreateGameSessionRequest request) const;
+
+        /**
+         * co_await-able form of CreatePlayerSession(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::CreatePlayerSessionRequest, Model::CreatePlayerSessionOutcome> CreatePlayerSessionAwaitable(Model::CreatePlayerSessionRequest request) const;
+
+        /**
+         * co_await-able form of CreatePlayerSessions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::CreatePlayerSessionsRequest, Model::CreatePlayerSessionsOutcome> CreatePlayerSessionsAwaitable(Model::CreatePlayerSessionsRequest request) const;
+
+        /**
+         * co_await-able form of DeleteAlias(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DeleteAliasRequest, Model::DeleteAliasOutcome> DeleteAliasAwaitable(Model::DeleteAliasRequest request) const;
+
+        /**
+         * co_await-able form of DeleteBuild(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DeleteBuildRequest, Model::DeleteBuildOutcome> DeleteBuildAwaitable(Model::DeleteBuildRequest request) const;
+
+        /**
+         * co_await-able form of DeleteFleet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DeleteFleetRequest, Model::DeleteFleetOutcome> DeleteFleetAwaitable(Model::DeleteFleetRequest request) const;
+
+        /**
+         * co_await-able form of DeleteScalingPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DeleteScalingPolicyRequest, Model::DeleteScalingPolicyOutcome> DeleteScalingPolicyAwaitable(Model::DeleteScalingPolicyRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAlias(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DescribeAliasRequest, Model::DescribeAliasOutcome> DescribeAliasAwaitable(Model::DescribeAliasRequest request) const;
+
+        /**
+         * co_await-able form of DescribeBuild(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DescribeBuildRequest, Model::DescribeBuildOutcome> DescribeBuildAwaitable(Model::DescribeBuildRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEC2InstanceLimits(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DescribeEC2InstanceLimitsRequest, Model::DescribeEC2InstanceLimitsOutcome> DescribeEC2InstanceLimitsAwaitable(Model::DescribeEC2InstanceLimitsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeFleetAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DescribeFleetAttributesRequest, Model::DescribeFleetAttributesOutcome> DescribeFleetAttributesAwaitable(Model::DescribeFleetAttributesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeFleetCapacity(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DescribeFleetCapacityRequest, Model::DescribeFleetCapacityOutcome> DescribeFleetCapacityAwaitable(Model::DescribeFleetCapacityRequest request) const;
+
+        /**
+         * co_await-able form of DescribeFleetEvents(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DescribeFleetEventsRequest, Model::DescribeFleetEventsOutcome> DescribeFleetEventsAwaitable(Model::DescribeFleetEventsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeFleetPortSettings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DescribeFleetPortSettingsRequest, Model::DescribeFleetPortSettingsOutcome> DescribeFleetPortSettingsAwaitable(Model::DescribeFleetPortSettingsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeFleetUtilization(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DescribeFleetUtilizationRequest, Model::DescribeFleetUtilizationOutcome> DescribeFleetUtilizationAwaitable(Model::DescribeFleetUtilizationRequest request) const;
+
+        /**
+         * co_await-able form of DescribeGameSessionDetails(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DescribeGameSessionDetailsRequest, Model::DescribeGameSessionDetailsOutcome> DescribeGameSessionDetailsAwaitable(Model::DescribeGameSessionDetailsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeGameSessions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DescribeGameSessionsRequest, Model::DescribeGameSessionsOutcome> DescribeGameSessionsAwaitable(Model::DescribeGameSessionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribePlayerSessions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DescribePlayerSessionsRequest, Model::DescribePlayerSessionsOutcome> DescribePlayerSessionsAwaitable(Model::DescribePlayerSessionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeRuntimeConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DescribeRuntimeConfigurationRequest, Model::DescribeRuntimeConfigurationOutcome> DescribeRuntimeConfigurationAwaitable(Model::DescribeRuntimeConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of DescribeScalingPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::DescribeScalingPoliciesRequest, Model::DescribeScalingPoliciesOutcome> DescribeScalingPoliciesAwaitable(Model::DescribeScalingPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of GetGameSessionLogUrl(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::GetGameSessionLogUrlRequest, Model::GetGameSessionLogUrlOutcome> GetGameSessionLogUrlAwaitable(Model::GetGameSessionLogUrlRequest request) const;
+
+        /**
+         * co_await-able form of ListAliases(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::ListAliasesRequest, Model::ListAliasesOutcome> ListAliasesAwaitable(Model::ListAliasesRequest request) const;
+
+        /**
+         * co_await-able form of ListBuilds(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::ListBuildsRequest, Model::ListBuildsOutcome> ListBuildsAwaitable(Model::ListBuildsRequest request) const;
+
+        /**
+         * co_await-able form of ListFleets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::ListFleetsRequest, Model::ListFleetsOutcome> ListFleetsAwaitable(Model::ListFleetsRequest request) const;
+
+        /**
+         * co_await-able form of PutScalingPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::PutScalingPolicyRequest, Model::PutScalingPolicyOutcome> PutScalingPolicyAwaitable(Model::PutScalingPolicyRequest request) const;
+
+        /**
+         * co_await-able form of RequestUploadCredentials(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::RequestUploadCredentialsRequest, Model::RequestUploadCredentialsOutcome> RequestUploadCredentialsAwaitable(Model::RequestUploadCredentialsRequest request) const;
+
+        /**
+         * co_await-able form of ResolveAlias(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::ResolveAliasRequest, Model::ResolveAliasOutcome> ResolveAliasAwaitable(Model::ResolveAliasRequest request) const;
+
+        /**
+         * co_await-able form of SearchGameSessions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::SearchGameSessionsRequest, Model::SearchGameSessionsOutcome> SearchGameSessionsAwaitable(Model::SearchGameSessionsRequest request) const;
+
+        /**
+         * co_await-able form of UpdateAlias(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::UpdateAliasRequest, Model::UpdateAliasOutcome> UpdateAliasAwaitable(Model::UpdateAliasRequest request) const;
+
+        /**
+         * co_await-able form of UpdateBuild(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::UpdateBuildRequest, Model::UpdateBuildOutcome> UpdateBuildAwaitable(Model::UpdateBuildRequest request) const;
+
+        /**
+         * co_await-able form of UpdateFleetAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::UpdateFleetAttributesRequest, Model::UpdateFleetAttributesOutcome> UpdateFleetAttributesAwaitable(Model::UpdateFleetAttributesRequest request) const;
+
+        /**
+         * co_await-able form of UpdateFleetCapacity(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::UpdateFleetCapacityRequest, Model::UpdateFleetCapacityOutcome> UpdateFleetCapacityAwaitable(Model::UpdateFleetCapacityRequest request) const;
+
+        /**
+         * co_await-able form of UpdateFleetPortSettings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::UpdateFleetPortSettingsRequest, Model::UpdateFleetPortSettingsOutcome> UpdateFleetPortSettingsAwaitable(Model::UpdateFleetPortSettingsRequest request) const;
+
+        /**
+         * co_await-able form of UpdateGameSession(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::UpdateGameSessionRequest, Model::UpdateGameSessionOutcome> UpdateGameSessionAwaitable(Model::UpdateGameSessionRequest request) const;
+
+        /**
+         * co_await-able form of UpdateRuntimeConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GameLiftClient, Model::UpdateRuntimeConfigurationRequest, Model::UpdateRuntimeConfigurationOutcome> UpdateRuntimeConfigurationAwaitable(Model::UpdateRuntimeConfigurationRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateBuildRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateBuild"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     CreateFleetRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateFleet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
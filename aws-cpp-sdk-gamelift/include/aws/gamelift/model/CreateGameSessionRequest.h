@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateGameSessionRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateGameSession"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreatePlayerSessionRequest();
+    inline const char* GetServiceRequestName() const override { return "CreatePlayerSession"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
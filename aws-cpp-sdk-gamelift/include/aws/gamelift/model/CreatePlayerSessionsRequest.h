@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreatePlayerSessionsRequest();
+    inline const char* GetServiceRequestName() const override { return "CreatePlayerSessions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteAliasRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteAlias"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
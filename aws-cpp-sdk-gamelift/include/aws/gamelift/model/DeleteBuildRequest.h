@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteBuildRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteBuild"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
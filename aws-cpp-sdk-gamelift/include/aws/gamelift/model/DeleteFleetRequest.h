@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteFleetRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteFleet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeAliasRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAlias"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeBuildRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeBuild"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeEC2InstanceLimitsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEC2InstanceLimits"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeFleetAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeFleetAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
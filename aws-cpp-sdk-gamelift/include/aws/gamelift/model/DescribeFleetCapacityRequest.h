@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeFleetCapacityRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeFleetCapacity"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
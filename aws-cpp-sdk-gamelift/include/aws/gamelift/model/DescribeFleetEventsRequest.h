@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeFleetEventsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeFleetEvents"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
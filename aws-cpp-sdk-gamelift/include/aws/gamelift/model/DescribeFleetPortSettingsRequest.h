@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeFleetPortSettingsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeFleetPortSettings"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
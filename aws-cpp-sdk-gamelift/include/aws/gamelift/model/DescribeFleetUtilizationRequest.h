@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeFleetUtilizationRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeFleetUtilization"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
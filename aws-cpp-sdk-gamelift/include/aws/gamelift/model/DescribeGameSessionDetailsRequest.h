@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeGameSessionDetailsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeGameSessionDetails"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
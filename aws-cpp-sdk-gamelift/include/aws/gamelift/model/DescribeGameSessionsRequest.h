@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeGameSessionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeGameSessions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
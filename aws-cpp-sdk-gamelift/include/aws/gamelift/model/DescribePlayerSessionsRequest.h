@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribePlayerSessionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribePlayerSessions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
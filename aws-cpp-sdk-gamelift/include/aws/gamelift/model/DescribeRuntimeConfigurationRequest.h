@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeRuntimeConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeRuntimeConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetGameSessionLogUrlRequest();
+    inline const char* GetServiceRequestName() const override { return "GetGameSessionLogUrl"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
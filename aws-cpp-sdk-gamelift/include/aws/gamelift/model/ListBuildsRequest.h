@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListBuildsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListBuilds"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListFleetsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListFleets"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
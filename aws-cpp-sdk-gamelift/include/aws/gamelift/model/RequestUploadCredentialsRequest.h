@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RequestUploadCredentialsRequest();
+    inline const char* GetServiceRequestName() const override { return "RequestUploadCredentials"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ResolveAliasRequest();
+    inline const char* GetServiceRequestName() const override { return "ResolveAlias"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     SearchGameSessionsRequest();
+    inline const char* GetServiceRequestName() const override { return "SearchGameSessions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
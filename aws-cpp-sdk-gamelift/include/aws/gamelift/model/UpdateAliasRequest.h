@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateAliasRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateAlias"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
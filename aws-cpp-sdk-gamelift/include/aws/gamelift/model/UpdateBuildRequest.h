@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateBuildRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateBuild"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
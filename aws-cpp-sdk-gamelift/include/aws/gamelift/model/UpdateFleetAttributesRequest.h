@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateFleetAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateFleetAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateFleetCapacityRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateFleetCapacity"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateFleetPortSettingsRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateFleetPortSettings"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
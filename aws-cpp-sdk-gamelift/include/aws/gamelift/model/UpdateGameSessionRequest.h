@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateGameSessionRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateGameSession"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateRuntimeConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateRuntimeConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -147,7 +147,7 @@ CreateAliasOutcome GameLiftClient::CreateAlias(const CreateAliasRequest& request
 
 CreateAliasOutcomeCallable GameLiftClient::CreateAliasCallable(const CreateAliasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateAlias(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateAlias(request); } );
 }
 
 void GameLiftClient::CreateAliasAsync(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -155,6 +155,16 @@ void GameLiftClient::CreateAliasAsync(const CreateAliasRequest& request, const C
   m_executor->Submit( [this, request, handler, context](){ this->CreateAliasAsyncHelper( request, handler, context ); } );
 }
 
+CreateAliasOutcomeCallable GameLiftClient::CreateAliasCallable(CreateAliasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::CreateAlias, this, std::move(request)));
+}
+
+void GameLiftClient::CreateAliasAsync(CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::CreateAliasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::CreateAliasAsyncHelper(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateAlias(request), context);
@@ -178,7 +188,7 @@ CreateBuildOutcome GameLiftClient::CreateBuild(const CreateBuildRequest& request
 
 CreateBuildOutcomeCallable GameLiftClient::CreateBuildCallable(const CreateBuildRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateBuild(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateBuild(request); } );
 }
 
 void GameLiftClient::CreateBuildAsync(const CreateBuildRequest& request, const CreateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -186,6 +196,16 @@ void GameLiftClient::CreateBuildAsync(const CreateBuildRequest& request, const C
   m_executor->Submit( [this, request, handler, context](){ this->CreateBuildAsyncHelper( request, handler, context ); } );
 }
 
+CreateBuildOutcomeCallable GameLiftClient::CreateBuildCallable(CreateBuildRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::CreateBuild, this, std::move(request)));
+}
+
+void GameLiftClient::CreateBuildAsync(CreateBuildRequest&& request, const CreateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::CreateBuildAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::CreateBuildAsyncHelper(const CreateBuildRequest& request, const CreateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateBuild(request), context);
@@ -209,7 +229,7 @@ CreateFleetOutcome GameLiftClient::CreateFleet(const CreateFleetRequest& request
 
 CreateFleetOutcomeCallable GameLiftClient::CreateFleetCallable(const CreateFleetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateFleet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateFleet(request); } );
 }
 
 void GameLiftClient::CreateFleetAsync(const CreateFleetRequest& request, const CreateFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -217,6 +237,16 @@ void GameLiftClient::CreateFleetAsync(const CreateFleetRequest& request, const C
   m_executor->Submit( [this, request, handler, context](){ this->CreateFleetAsyncHelper( request, handler, context ); } );
 }
 
+CreateFleetOutcomeCallable GameLiftClient::CreateFleetCallable(CreateFleetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::CreateFleet, this, std::move(request)));
+}
+
+void GameLiftClient::CreateFleetAsync(CreateFleetRequest&& request, const CreateFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::CreateFleetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::CreateFleetAsyncHelper(const CreateFleetRequest& request, const CreateFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateFleet(request), context);
@@ -240,7 +270,7 @@ CreateGameSessionOutcome GameLiftClient::CreateGameSession(const CreateGameSessi
 
 CreateGameSessionOutcomeCallable GameLiftClient::CreateGameSessionCallable(const CreateGameSessionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateGameSession(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateGameSession(request); } );
 }
 
 void GameLiftClient::CreateGameSessionAsync(const CreateGameSessionRequest& request, const CreateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -248,6 +278,16 @@ void GameLiftClient::CreateGameSessionAsync(const CreateGameSessionRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->CreateGameSessionAsyncHelper( request, handler, context ); } );
 }
 
+CreateGameSessionOutcomeCallable GameLiftClient::CreateGameSessionCallable(CreateGameSessionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::CreateGameSession, this, std::move(request)));
+}
+
+void GameLiftClient::CreateGameSessionAsync(CreateGameSessionRequest&& request, const CreateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::CreateGameSessionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::CreateGameSessionAsyncHelper(const CreateGameSessionRequest& request, const CreateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateGameSession(request), context);
@@ -271,7 +311,7 @@ CreatePlayerSessionOutcome GameLiftClient::CreatePlayerSession(const CreatePlaye
 
 CreatePlayerSessionOutcomeCallable GameLiftClient::CreatePlayerSessionCallable(const CreatePlayerSessionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreatePlayerSession(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreatePlayerSession(request); } );
 }
 
 void GameLiftClient::CreatePlayerSessionAsync(const CreatePlayerSessionRequest& request, const CreatePlayerSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -279,6 +319,16 @@ void GameLiftClient::CreatePlayerSessionAsync(const CreatePlayerSessionRequest&
   m_executor->Submit( [this, request, handler, context](){ this->CreatePlayerSessionAsyncHelper( request, handler, context ); } );
 }
 
+CreatePlayerSessionOutcomeCallable GameLiftClient::CreatePlayerSessionCallable(CreatePlayerSessionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::CreatePlayerSession, this, std::move(request)));
+}
+
+void GameLiftClient::CreatePlayerSessionAsync(CreatePlayerSessionRequest&& request, const CreatePlayerSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::CreatePlayerSessionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::CreatePlayerSessionAsyncHelper(const CreatePlayerSessionRequest& request, const CreatePlayerSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreatePlayerSession(request), context);
@@ -302,7 +352,7 @@ CreatePlayerSessionsOutcome GameLiftClient::CreatePlayerSessions(const CreatePla
 
 CreatePlayerSessionsOutcomeCallable GameLiftClient::CreatePlayerSessionsCallable(const CreatePlayerSessionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreatePlayerSessions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreatePlayerSessions(request); } );
 }
 
 void GameLiftClient::CreatePlayerSessionsAsync(const CreatePlayerSessionsRequest& request, const CreatePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -310,6 +360,16 @@ void GameLiftClient::CreatePlayerSessionsAsync(const CreatePlayerSessionsRequest
   m_executor->Submit( [this, request, handler, context](){ this->CreatePlayerSessionsAsyncHelper( request, handler, context ); } );
 }
 
+CreatePlayerSessionsOutcomeCallable GameLiftClient::CreatePlayerSessionsCallable(CreatePlayerSessionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::CreatePlayerSessions, this, std::move(request)));
+}
+
+void GameLiftClient::CreatePlayerSessionsAsync(CreatePlayerSessionsRequest&& request, const CreatePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::CreatePlayerSessionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::CreatePlayerSessionsAsyncHelper(const CreatePlayerSessionsRequest& request, const CreatePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreatePlayerSessions(request), context);
@@ -333,7 +393,7 @@ DeleteAliasOutcome GameLiftClient::DeleteAlias(const DeleteAliasRequest& request
 
 DeleteAliasOutcomeCallable GameLiftClient::DeleteAliasCallable(const DeleteAliasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteAlias(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteAlias(request); } );
 }
 
 void GameLiftClient::DeleteAliasAsync(const DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -341,6 +401,16 @@ void GameLiftClient::DeleteAliasAsync(const DeleteAliasRequest& request, const D
   m_executor->Submit( [this, request, handler, context](){ this->DeleteAliasAsyncHelper( request, handler, context ); } );
 }
 
+DeleteAliasOutcomeCallable GameLiftClient::DeleteAliasCallable(DeleteAliasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DeleteAlias, this, std::move(request)));
+}
+
+void GameLiftClient::DeleteAliasAsync(DeleteAliasRequest&& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DeleteAliasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DeleteAliasAsyncHelper(const DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteAlias(request), context);
@@ -364,7 +434,7 @@ DeleteBuildOutcome GameLiftClient::DeleteBuild(const DeleteBuildRequest& request
 
 DeleteBuildOutcomeCallable GameLiftClient::DeleteBuildCallable(const DeleteBuildRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteBuild(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteBuild(request); } );
 }
 
 void GameLiftClient::DeleteBuildAsync(const DeleteBuildRequest& request, const DeleteBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -372,6 +442,16 @@ void GameLiftClient::DeleteBuildAsync(const DeleteBuildRequest& request, const D
   m_executor->Submit( [this, request, handler, context](){ this->DeleteBuildAsyncHelper( request, handler, context ); } );
 }
 
+DeleteBuildOutcomeCallable GameLiftClient::DeleteBuildCallable(DeleteBuildRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DeleteBuild, this, std::move(request)));
+}
+
+void GameLiftClient::DeleteBuildAsync(DeleteBuildRequest&& request, const DeleteBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DeleteBuildAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DeleteBuildAsyncHelper(const DeleteBuildRequest& request, const DeleteBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteBuild(request), context);
@@ -395,7 +475,7 @@ DeleteFleetOutcome GameLiftClient::DeleteFleet(const DeleteFleetRequest& request
 
 DeleteFleetOutcomeCallable GameLiftClient::DeleteFleetCallable(const DeleteFleetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteFleet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteFleet(request); } );
 }
 
 void GameLiftClient::DeleteFleetAsync(const DeleteFleetRequest& request, const DeleteFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -403,6 +483,16 @@ void GameLiftClient::DeleteFleetAsync(const DeleteFleetRequest& request, const D
   m_executor->Submit( [this, request, handler, context](){ this->DeleteFleetAsyncHelper( request, handler, context ); } );
 }
 
+DeleteFleetOutcomeCallable GameLiftClient::DeleteFleetCallable(DeleteFleetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DeleteFleet, this, std::move(request)));
+}
+
+void GameLiftClient::DeleteFleetAsync(DeleteFleetRequest&& request, const DeleteFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DeleteFleetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DeleteFleetAsyncHelper(const DeleteFleetRequest& request, const DeleteFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteFleet(request), context);
@@ -426,7 +516,7 @@ DeleteScalingPolicyOutcome GameLiftClient::DeleteScalingPolicy(const DeleteScali
 
 DeleteScalingPolicyOutcomeCallable GameLiftClient::DeleteScalingPolicyCallable(const DeleteScalingPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteScalingPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteScalingPolicy(request); } );
 }
 
 void GameLiftClient::DeleteScalingPolicyAsync(const DeleteScalingPolicyRequest& request, const DeleteScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -434,6 +524,16 @@ void GameLiftClient::DeleteScalingPolicyAsync(const DeleteScalingPolicyRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DeleteScalingPolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteScalingPolicyOutcomeCallable GameLiftClient::DeleteScalingPolicyCallable(DeleteScalingPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DeleteScalingPolicy, this, std::move(request)));
+}
+
+void GameLiftClient::DeleteScalingPolicyAsync(DeleteScalingPolicyRequest&& request, const DeleteScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DeleteScalingPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DeleteScalingPolicyAsyncHelper(const DeleteScalingPolicyRequest& request, const DeleteScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteScalingPolicy(request), context);
@@ -457,7 +557,7 @@ DescribeAliasOutcome GameLiftClient::DescribeAlias(const DescribeAliasRequest& r
 
 DescribeAliasOutcomeCallable GameLiftClient::DescribeAliasCallable(const DescribeAliasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAlias(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAlias(request); } );
 }
 
 void GameLiftClient::DescribeAliasAsync(const DescribeAliasRequest& request, const DescribeAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -465,6 +565,16 @@ void GameLiftClient::DescribeAliasAsync(const DescribeAliasRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAliasAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAliasOutcomeCallable GameLiftClient::DescribeAliasCallable(DescribeAliasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DescribeAlias, this, std::move(request)));
+}
+
+void GameLiftClient::DescribeAliasAsync(DescribeAliasRequest&& request, const DescribeAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DescribeAliasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DescribeAliasAsyncHelper(const DescribeAliasRequest& request, const DescribeAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAlias(request), context);
@@ -488,7 +598,7 @@ DescribeBuildOutcome GameLiftClient::DescribeBuild(const DescribeBuildRequest& r
 
 DescribeBuildOutcomeCallable GameLiftClient::DescribeBuildCallable(const DescribeBuildRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeBuild(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeBuild(request); } );
 }
 
 void GameLiftClient::DescribeBuildAsync(const DescribeBuildRequest& request, const DescribeBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -496,6 +606,16 @@ void GameLiftClient::DescribeBuildAsync(const DescribeBuildRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->DescribeBuildAsyncHelper( request, handler, context ); } );
 }
 
+DescribeBuildOutcomeCallable GameLiftClient::DescribeBuildCallable(DescribeBuildRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DescribeBuild, this, std::move(request)));
+}
+
+void GameLiftClient::DescribeBuildAsync(DescribeBuildRequest&& request, const DescribeBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DescribeBuildAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DescribeBuildAsyncHelper(const DescribeBuildRequest& request, const DescribeBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeBuild(request), context);
@@ -519,7 +639,7 @@ DescribeEC2InstanceLimitsOutcome GameLiftClient::DescribeEC2InstanceLimits(const
 
 DescribeEC2InstanceLimitsOutcomeCallable GameLiftClient::DescribeEC2InstanceLimitsCallable(const DescribeEC2InstanceLimitsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEC2InstanceLimits(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEC2InstanceLimits(request); } );
 }
 
 void GameLiftClient::DescribeEC2InstanceLimitsAsync(const DescribeEC2InstanceLimitsRequest& request, const DescribeEC2InstanceLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -527,6 +647,16 @@ void GameLiftClient::DescribeEC2InstanceLimitsAsync(const DescribeEC2InstanceLim
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEC2InstanceLimitsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEC2InstanceLimitsOutcomeCallable GameLiftClient::DescribeEC2InstanceLimitsCallable(DescribeEC2InstanceLimitsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DescribeEC2InstanceLimits, this, std::move(request)));
+}
+
+void GameLiftClient::DescribeEC2InstanceLimitsAsync(DescribeEC2InstanceLimitsRequest&& request, const DescribeEC2InstanceLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DescribeEC2InstanceLimitsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DescribeEC2InstanceLimitsAsyncHelper(const DescribeEC2InstanceLimitsRequest& request, const DescribeEC2InstanceLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEC2InstanceLimits(request), context);
@@ -550,7 +680,7 @@ DescribeFleetAttributesOutcome GameLiftClient::DescribeFleetAttributes(const Des
 
 DescribeFleetAttributesOutcomeCallable GameLiftClient::DescribeFleetAttributesCallable(const DescribeFleetAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeFleetAttributes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeFleetAttributes(request); } );
 }
 
 void GameLiftClient::DescribeFleetAttributesAsync(const DescribeFleetAttributesRequest& request, const DescribeFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -558,6 +688,16 @@ void GameLiftClient::DescribeFleetAttributesAsync(const DescribeFleetAttributesR
   m_executor->Submit( [this, request, handler, context](){ this->DescribeFleetAttributesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeFleetAttributesOutcomeCallable GameLiftClient::DescribeFleetAttributesCallable(DescribeFleetAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DescribeFleetAttributes, this, std::move(request)));
+}
+
+void GameLiftClient::DescribeFleetAttributesAsync(DescribeFleetAttributesRequest&& request, const DescribeFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DescribeFleetAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DescribeFleetAttributesAsyncHelper(const DescribeFleetAttributesRequest& request, const DescribeFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeFleetAttributes(request), context);
@@ -581,7 +721,7 @@ DescribeFleetCapacityOutcome GameLiftClient::DescribeFleetCapacity(const Describ
 
 DescribeFleetCapacityOutcomeCallable GameLiftClient::DescribeFleetCapacityCallable(const DescribeFleetCapacityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeFleetCapacity(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeFleetCapacity(request); } );
 }
 
 void GameLiftClient::DescribeFleetCapacityAsync(const DescribeFleetCapacityRequest& request, const DescribeFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -589,6 +729,16 @@ void GameLiftClient::DescribeFleetCapacityAsync(const DescribeFleetCapacityReque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeFleetCapacityAsyncHelper( request, handler, context ); } );
 }
 
+DescribeFleetCapacityOutcomeCallable GameLiftClient::DescribeFleetCapacityCallable(DescribeFleetCapacityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DescribeFleetCapacity, this, std::move(request)));
+}
+
+void GameLiftClient::DescribeFleetCapacityAsync(DescribeFleetCapacityRequest&& request, const DescribeFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DescribeFleetCapacityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DescribeFleetCapacityAsyncHelper(const DescribeFleetCapacityRequest& request, const DescribeFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeFleetCapacity(request), context);
@@ -612,7 +762,7 @@ DescribeFleetEventsOutcome GameLiftClient::DescribeFleetEvents(const DescribeFle
 
 DescribeFleetEventsOutcomeCallable GameLiftClient::DescribeFleetEventsCallable(const DescribeFleetEventsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeFleetEvents(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeFleetEvents(request); } );
 }
 
 void GameLiftClient::DescribeFleetEventsAsync(const DescribeFleetEventsRequest& request, const DescribeFleetEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -620,6 +770,16 @@ void GameLiftClient::DescribeFleetEventsAsync(const DescribeFleetEventsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeFleetEventsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeFleetEventsOutcomeCallable GameLiftClient::DescribeFleetEventsCallable(DescribeFleetEventsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DescribeFleetEvents, this, std::move(request)));
+}
+
+void GameLiftClient::DescribeFleetEventsAsync(DescribeFleetEventsRequest&& request, const DescribeFleetEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DescribeFleetEventsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DescribeFleetEventsAsyncHelper(const DescribeFleetEventsRequest& request, const DescribeFleetEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeFleetEvents(request), context);
@@ -643,7 +803,7 @@ DescribeFleetPortSettingsOutcome GameLiftClient::DescribeFleetPortSettings(const
 
 DescribeFleetPortSettingsOutcomeCallable GameLiftClient::DescribeFleetPortSettingsCallable(const DescribeFleetPortSettingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeFleetPortSettings(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeFleetPortSettings(request); } );
 }
 
 void GameLiftClient::DescribeFleetPortSettingsAsync(const DescribeFleetPortSettingsRequest& request, const DescribeFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -651,6 +811,16 @@ void GameLiftClient::DescribeFleetPortSettingsAsync(const DescribeFleetPortSetti
   m_executor->Submit( [this, request, handler, context](){ this->DescribeFleetPortSettingsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeFleetPortSettingsOutcomeCallable GameLiftClient::DescribeFleetPortSettingsCallable(DescribeFleetPortSettingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DescribeFleetPortSettings, this, std::move(request)));
+}
+
+void GameLiftClient::DescribeFleetPortSettingsAsync(DescribeFleetPortSettingsRequest&& request, const DescribeFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DescribeFleetPortSettingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DescribeFleetPortSettingsAsyncHelper(const DescribeFleetPortSettingsRequest& request, const DescribeFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeFleetPortSettings(request), context);
@@ -674,7 +844,7 @@ DescribeFleetUtilizationOutcome GameLiftClient::DescribeFleetUtilization(const D
 
 DescribeFleetUtilizationOutcomeCallable GameLiftClient::DescribeFleetUtilizationCallable(const DescribeFleetUtilizationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeFleetUtilization(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeFleetUtilization(request); } );
 }
 
 void GameLiftClient::DescribeFleetUtilizationAsync(const DescribeFleetUtilizationRequest& request, const DescribeFleetUtilizationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -682,6 +852,16 @@ void GameLiftClient::DescribeFleetUtilizationAsync(const DescribeFleetUtilizatio
   m_executor->Submit( [this, request, handler, context](){ this->DescribeFleetUtilizationAsyncHelper( request, handler, context ); } );
 }
 
+DescribeFleetUtilizationOutcomeCallable GameLiftClient::DescribeFleetUtilizationCallable(DescribeFleetUtilizationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DescribeFleetUtilization, this, std::move(request)));
+}
+
+void GameLiftClient::DescribeFleetUtilizationAsync(DescribeFleetUtilizationRequest&& request, const DescribeFleetUtilizationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DescribeFleetUtilizationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DescribeFleetUtilizationAsyncHelper(const DescribeFleetUtilizationRequest& request, const DescribeFleetUtilizationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeFleetUtilization(request), context);
@@ -705,7 +885,7 @@ DescribeGameSessionDetailsOutcome GameLiftClient::DescribeGameSessionDetails(con
 
 DescribeGameSessionDetailsOutcomeCallable GameLiftClient::DescribeGameSessionDetailsCallable(const DescribeGameSessionDetailsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeGameSessionDetails(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeGameSessionDetails(request); } );
 }
 
 void GameLiftClient::DescribeGameSessionDetailsAsync(const DescribeGameSessionDetailsRequest& request, const DescribeGameSessionDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -713,6 +893,16 @@ void GameLiftClient::DescribeGameSessionDetailsAsync(const DescribeGameSessionDe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeGameSessionDetailsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeGameSessionDetailsOutcomeCallable GameLiftClient::DescribeGameSessionDetailsCallable(DescribeGameSessionDetailsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DescribeGameSessionDetails, this, std::move(request)));
+}
+
+void GameLiftClient::DescribeGameSessionDetailsAsync(DescribeGameSessionDetailsRequest&& request, const DescribeGameSessionDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DescribeGameSessionDetailsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DescribeGameSessionDetailsAsyncHelper(const DescribeGameSessionDetailsRequest& request, const DescribeGameSessionDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeGameSessionDetails(request), context);
@@ -736,7 +926,7 @@ DescribeGameSessionsOutcome GameLiftClient::DescribeGameSessions(const DescribeG
 
 DescribeGameSessionsOutcomeCallable GameLiftClient::DescribeGameSessionsCallable(const DescribeGameSessionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeGameSessions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeGameSessions(request); } );
 }
 
 void GameLiftClient::DescribeGameSessionsAsync(const DescribeGameSessionsRequest& request, const DescribeGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -744,6 +934,16 @@ void GameLiftClient::DescribeGameSessionsAsync(const DescribeGameSessionsRequest
   m_executor->Submit( [this, request, handler, context](){ this->DescribeGameSessionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeGameSessionsOutcomeCallable GameLiftClient::DescribeGameSessionsCallable(DescribeGameSessionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DescribeGameSessions, this, std::move(request)));
+}
+
+void GameLiftClient::DescribeGameSessionsAsync(DescribeGameSessionsRequest&& request, const DescribeGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DescribeGameSessionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DescribeGameSessionsAsyncHelper(const DescribeGameSessionsRequest& request, const DescribeGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeGameSessions(request), context);
@@ -767,7 +967,7 @@ DescribePlayerSessionsOutcome GameLiftClient::DescribePlayerSessions(const Descr
 
 DescribePlayerSessionsOutcomeCallable GameLiftClient::DescribePlayerSessionsCallable(const DescribePlayerSessionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribePlayerSessions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribePlayerSessions(request); } );
 }
 
 void GameLiftClient::DescribePlayerSessionsAsync(const DescribePlayerSessionsRequest& request, const DescribePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -775,6 +975,16 @@ void GameLiftClient::DescribePlayerSessionsAsync(const DescribePlayerSessionsReq
   m_executor->Submit( [this, request, handler, context](){ this->DescribePlayerSessionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribePlayerSessionsOutcomeCallable GameLiftClient::DescribePlayerSessionsCallable(DescribePlayerSessionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DescribePlayerSessions, this, std::move(request)));
+}
+
+void GameLiftClient::DescribePlayerSessionsAsync(DescribePlayerSessionsRequest&& request, const DescribePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DescribePlayerSessionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DescribePlayerSessionsAsyncHelper(const DescribePlayerSessionsRequest& request, const DescribePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribePlayerSessions(request), context);
@@ -798,7 +1008,7 @@ DescribeRuntimeConfigurationOutcome GameLiftClient::DescribeRuntimeConfiguration
 
 DescribeRuntimeConfigurationOutcomeCallable GameLiftClient::DescribeRuntimeConfigurationCallable(const DescribeRuntimeConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeRuntimeConfiguration(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeRuntimeConfiguration(request); } );
 }
 
 void GameLiftClient::DescribeRuntimeConfigurationAsync(const DescribeRuntimeConfigurationRequest& request, const DescribeRuntimeConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -806,6 +1016,16 @@ void GameLiftClient::DescribeRuntimeConfigurationAsync(const DescribeRuntimeConf
   m_executor->Submit( [this, request, handler, context](){ this->DescribeRuntimeConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+DescribeRuntimeConfigurationOutcomeCallable GameLiftClient::DescribeRuntimeConfigurationCallable(DescribeRuntimeConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DescribeRuntimeConfiguration, this, std::move(request)));
+}
+
+void GameLiftClient::DescribeRuntimeConfigurationAsync(DescribeRuntimeConfigurationRequest&& request, const DescribeRuntimeConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DescribeRuntimeConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DescribeRuntimeConfigurationAsyncHelper(const DescribeRuntimeConfigurationRequest& request, const DescribeRuntimeConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeRuntimeConfiguration(request), context);
@@ -829,7 +1049,7 @@ DescribeScalingPoliciesOutcome GameLiftClient::DescribeScalingPolicies(const Des
 
 DescribeScalingPoliciesOutcomeCallable GameLiftClient::DescribeScalingPoliciesCallable(const DescribeScalingPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeScalingPolicies(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeScalingPolicies(request); } );
 }
 
 void GameLiftClient::DescribeScalingPoliciesAsync(const DescribeScalingPoliciesRequest& request, const DescribeScalingPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -837,6 +1057,16 @@ void GameLiftClient::DescribeScalingPoliciesAsync(const DescribeScalingPoliciesR
   m_executor->Submit( [this, request, handler, context](){ this->DescribeScalingPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeScalingPoliciesOutcomeCallable GameLiftClient::DescribeScalingPoliciesCallable(DescribeScalingPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::DescribeScalingPolicies, this, std::move(request)));
+}
+
+void GameLiftClient::DescribeScalingPoliciesAsync(DescribeScalingPoliciesRequest&& request, const DescribeScalingPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::DescribeScalingPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::DescribeScalingPoliciesAsyncHelper(const DescribeScalingPoliciesRequest& request, const DescribeScalingPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeScalingPolicies(request), context);
@@ -860,7 +1090,7 @@ GetGameSessionLogUrlOutcome GameLiftClient::GetGameSessionLogUrl(const GetGameSe
 
 GetGameSessionLogUrlOutcomeCallable GameLiftClient::GetGameSessionLogUrlCallable(const GetGameSessionLogUrlRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetGameSessionLogUrl(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetGameSessionLogUrl(request); } );
 }
 
 void GameLiftClient::GetGameSessionLogUrlAsync(const GetGameSessionLogUrlRequest& request, const GetGameSessionLogUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -868,6 +1098,16 @@ void GameLiftClient::GetGameSessionLogUrlAsync(const GetGameSessionLogUrlRequest
   m_executor->Submit( [this, request, handler, context](){ this->GetGameSessionLogUrlAsyncHelper( request, handler, context ); } );
 }
 
+GetGameSessionLogUrlOutcomeCallable GameLiftClient::GetGameSessionLogUrlCallable(GetGameSessionLogUrlRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::GetGameSessionLogUrl, this, std::move(request)));
+}
+
+void GameLiftClient::GetGameSessionLogUrlAsync(GetGameSessionLogUrlRequest&& request, const GetGameSessionLogUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::GetGameSessionLogUrlAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::GetGameSessionLogUrlAsyncHelper(const GetGameSessionLogUrlRequest& request, const GetGameSessionLogUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetGameSessionLogUrl(request), context);
@@ -891,7 +1131,7 @@ ListAliasesOutcome GameLiftClient::ListAliases(const ListAliasesRequest& request
 
 ListAliasesOutcomeCallable GameLiftClient::ListAliasesCallable(const ListAliasesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAliases(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAliases(request); } );
 }
 
 void GameLiftClient::ListAliasesAsync(const ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -899,6 +1139,16 @@ void GameLiftClient::ListAliasesAsync(const ListAliasesRequest& request, const L
   m_executor->Submit( [this, request, handler, context](){ this->ListAliasesAsyncHelper( request, handler, context ); } );
 }
 
+ListAliasesOutcomeCallable GameLiftClient::ListAliasesCallable(ListAliasesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::ListAliases, this, std::move(request)));
+}
+
+void GameLiftClient::ListAliasesAsync(ListAliasesRequest&& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::ListAliasesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::ListAliasesAsyncHelper(const ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAliases(request), context);
@@ -922,7 +1172,7 @@ ListBuildsOutcome GameLiftClient::ListBuilds(const ListBuildsRequest& request) c
 
 ListBuildsOutcomeCallable GameLiftClient::ListBuildsCallable(const ListBuildsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListBuilds(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListBuilds(request); } );
 }
 
 void GameLiftClient::ListBuildsAsync(const ListBuildsRequest& request, const ListBuildsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -930,6 +1180,16 @@ void GameLiftClient::ListBuildsAsync(const ListBuildsRequest& request, const Lis
   m_executor->Submit( [this, request, handler, context](){ this->ListBuildsAsyncHelper( request, handler, context ); } );
 }
 
+ListBuildsOutcomeCallable GameLiftClient::ListBuildsCallable(ListBuildsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::ListBuilds, this, std::move(request)));
+}
+
+void GameLiftClient::ListBuildsAsync(ListBuildsRequest&& request, const ListBuildsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::ListBuildsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::ListBuildsAsyncHelper(const ListBuildsRequest& request, const ListBuildsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListBuilds(request), context);
@@ -953,7 +1213,7 @@ ListFleetsOutcome GameLiftClient::ListFleets(const ListFleetsRequest& request) c
 
 ListFleetsOutcomeCallable GameLiftClient::ListFleetsCallable(const ListFleetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListFleets(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListFleets(request); } );
 }
 
 void GameLiftClient::ListFleetsAsync(const ListFleetsRequest& request, const ListFleetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -961,6 +1221,16 @@ void GameLiftClient::ListFleetsAsync(const ListFleetsRequest& request, const Lis
   m_executor->Submit( [this, request, handler, context](){ this->ListFleetsAsyncHelper( request, handler, context ); } );
 }
 
+ListFleetsOutcomeCallable GameLiftClient::ListFleetsCallable(ListFleetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::ListFleets, this, std::move(request)));
+}
+
+void GameLiftClient::ListFleetsAsync(ListFleetsRequest&& request, const ListFleetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::ListFleetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::ListFleetsAsyncHelper(const ListFleetsRequest& request, const ListFleetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListFleets(request), context);
@@ -984,7 +1254,7 @@ PutScalingPolicyOutcome GameLiftClient::PutScalingPolicy(const PutScalingPolicyR
 
 PutScalingPolicyOutcomeCallable GameLiftClient::PutScalingPolicyCallable(const PutScalingPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutScalingPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutScalingPolicy(request); } );
 }
 
 void GameLiftClient::PutScalingPolicyAsync(const PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -992,6 +1262,16 @@ void GameLiftClient::PutScalingPolicyAsync(const PutScalingPolicyRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->PutScalingPolicyAsyncHelper( request, handler, context ); } );
 }
 
+PutScalingPolicyOutcomeCallable GameLiftClient::PutScalingPolicyCallable(PutScalingPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::PutScalingPolicy, this, std::move(request)));
+}
+
+void GameLiftClient::PutScalingPolicyAsync(PutScalingPolicyRequest&& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::PutScalingPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::PutScalingPolicyAsyncHelper(const PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutScalingPolicy(request), context);
@@ -1015,7 +1295,7 @@ RequestUploadCredentialsOutcome GameLiftClient::RequestUploadCredentials(const R
 
 RequestUploadCredentialsOutcomeCallable GameLiftClient::RequestUploadCredentialsCallable(const RequestUploadCredentialsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RequestUploadCredentials(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RequestUploadCredentials(request); } );
 }
 
 void GameLiftClient::RequestUploadCredentialsAsync(const RequestUploadCredentialsRequest& request, const RequestUploadCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1023,6 +1303,16 @@ void GameLiftClient::RequestUploadCredentialsAsync(const RequestUploadCredential
   m_executor->Submit( [this, request, handler, context](){ this->RequestUploadCredentialsAsyncHelper( request, handler, context ); } );
 }
 
+RequestUploadCredentialsOutcomeCallable GameLiftClient::RequestUploadCredentialsCallable(RequestUploadCredentialsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::RequestUploadCredentials, this, std::move(request)));
+}
+
+void GameLiftClient::RequestUploadCredentialsAsync(RequestUploadCredentialsRequest&& request, const RequestUploadCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::RequestUploadCredentialsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::RequestUploadCredentialsAsyncHelper(const RequestUploadCredentialsRequest& request, const RequestUploadCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RequestUploadCredentials(request), context);
@@ -1046,7 +1336,7 @@ ResolveAliasOutcome GameLiftClient::ResolveAlias(const ResolveAliasRequest& requ
 
 ResolveAliasOutcomeCallable GameLiftClient::ResolveAliasCallable(const ResolveAliasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResolveAlias(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResolveAlias(request); } );
 }
 
 void GameLiftClient::ResolveAliasAsync(const ResolveAliasRequest& request, const ResolveAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1054,6 +1344,16 @@ void GameLiftClient::ResolveAliasAsync(const ResolveAliasRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ResolveAliasAsyncHelper( request, handler, context ); } );
 }
 
+ResolveAliasOutcomeCallable GameLiftClient::ResolveAliasCallable(ResolveAliasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::ResolveAlias, this, std::move(request)));
+}
+
+void GameLiftClient::ResolveAliasAsync(ResolveAliasRequest&& request, const ResolveAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::ResolveAliasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::ResolveAliasAsyncHelper(const ResolveAliasRequest& request, const ResolveAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResolveAlias(request), context);
@@ -1077,7 +1377,7 @@ SearchGameSessionsOutcome GameLiftClient::SearchGameSessions(const SearchGameSes
 
 SearchGameSessionsOutcomeCallable GameLiftClient::SearchGameSessionsCallable(const SearchGameSessionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SearchGameSessions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SearchGameSessions(request); } );
 }
 
 void GameLiftClient::SearchGameSessionsAsync(const SearchGameSessionsRequest& request, const SearchGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1085,6 +1385,16 @@ void GameLiftClient::SearchGameSessionsAsync(const SearchGameSessionsRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->SearchGameSessionsAsyncHelper( request, handler, context ); } );
 }
 
+SearchGameSessionsOutcomeCallable GameLiftClient::SearchGameSessionsCallable(SearchGameSessionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::SearchGameSessions, this, std::move(request)));
+}
+
+void GameLiftClient::SearchGameSessionsAsync(SearchGameSessionsRequest&& request, const SearchGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::SearchGameSessionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::SearchGameSessionsAsyncHelper(const SearchGameSessionsRequest& request, const SearchGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SearchGameSessions(request), context);
@@ -1108,7 +1418,7 @@ UpdateAliasOutcome GameLiftClient::UpdateAlias(const UpdateAliasRequest& request
 
 UpdateAliasOutcomeCallable GameLiftClient::UpdateAliasCallable(const UpdateAliasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateAlias(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateAlias(request); } );
 }
 
 void GameLiftClient::UpdateAliasAsync(const UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1116,6 +1426,16 @@ void GameLiftClient::UpdateAliasAsync(const UpdateAliasRequest& request, const U
   m_executor->Submit( [this, request, handler, context](){ this->UpdateAliasAsyncHelper( request, handler, context ); } );
 }
 
+UpdateAliasOutcomeCallable GameLiftClient::UpdateAliasCallable(UpdateAliasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::UpdateAlias, this, std::move(request)));
+}
+
+void GameLiftClient::UpdateAliasAsync(UpdateAliasRequest&& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::UpdateAliasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::UpdateAliasAsyncHelper(const UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateAlias(request), context);
@@ -1139,7 +1459,7 @@ UpdateBuildOutcome GameLiftClient::UpdateBuild(const UpdateBuildRequest& request
 
 UpdateBuildOutcomeCallable GameLiftClient::UpdateBuildCallable(const UpdateBuildRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateBuild(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateBuild(request); } );
 }
 
 void GameLiftClient::UpdateBuildAsync(const UpdateBuildRequest& request, const UpdateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1147,6 +1467,16 @@ void GameLiftClient::UpdateBuildAsync(const UpdateBuildRequest& request, const U
   m_executor->Submit( [this, request, handler, context](){ this->UpdateBuildAsyncHelper( request, handler, context ); } );
 }
 
+UpdateBuildOutcomeCallable GameLiftClient::UpdateBuildCallable(UpdateBuildRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::UpdateBuild, this, std::move(request)));
+}
+
+void GameLiftClient::UpdateBuildAsync(UpdateBuildRequest&& request, const UpdateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::UpdateBuildAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::UpdateBuildAsyncHelper(const UpdateBuildRequest& request, const UpdateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateBuild(request), context);
@@ -1170,7 +1500,7 @@ UpdateFleetAttributesOutcome GameLiftClient::UpdateFleetAttributes(const UpdateF
 
 UpdateFleetAttributesOutcomeCallable GameLiftClient::UpdateFleetAttributesCallable(const UpdateFleetAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateFleetAttributes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateFleetAttributes(request); } );
 }
 
 void GameLiftClient::UpdateFleetAttributesAsync(const UpdateFleetAttributesRequest& request, const UpdateFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1178,6 +1508,16 @@ void GameLiftClient::UpdateFleetAttributesAsync(const UpdateFleetAttributesReque
   m_executor->Submit( [this, request, handler, context](){ this->UpdateFleetAttributesAsyncHelper( request, handler, context ); } );
 }
 
+UpdateFleetAttributesOutcomeCallable GameLiftClient::UpdateFleetAttributesCallable(UpdateFleetAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::UpdateFleetAttributes, this, std::move(request)));
+}
+
+void GameLiftClient::UpdateFleetAttributesAsync(UpdateFleetAttributesRequest&& request, const UpdateFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::UpdateFleetAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::UpdateFleetAttributesAsyncHelper(const UpdateFleetAttributesRequest& request, const UpdateFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateFleetAttributes(request), context);
@@ -1201,7 +1541,7 @@ UpdateFleetCapacityOutcome GameLiftClient::UpdateFleetCapacity(const UpdateFleet
 
 UpdateFleetCapacityOutcomeCallable GameLiftClient::UpdateFleetCapacityCallable(const UpdateFleetCapacityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateFleetCapacity(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateFleetCapacity(request); } );
 }
 
 void GameLiftClient::UpdateFleetCapacityAsync(const UpdateFleetCapacityRequest& request, const UpdateFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1209,6 +1549,16 @@ void GameLiftClient::UpdateFleetCapacityAsync(const UpdateFleetCapacityRequest&
   m_executor->Submit( [this, request, handler, context](){ this->UpdateFleetCapacityAsyncHelper( request, handler, context ); } );
 }
 
+UpdateFleetCapacityOutcomeCallable GameLiftClient::UpdateFleetCapacityCallable(UpdateFleetCapacityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::UpdateFleetCapacity, this, std::move(request)));
+}
+
+void GameLiftClient::UpdateFleetCapacityAsync(UpdateFleetCapacityRequest&& request, const UpdateFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::UpdateFleetCapacityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::UpdateFleetCapacityAsyncHelper(const UpdateFleetCapacityRequest& request, const UpdateFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateFleetCapacity(request), context);
@@ -1232,7 +1582,7 @@ UpdateFleetPortSettingsOutcome GameLiftClient::UpdateFleetPortSettings(const Upd
 
 UpdateFleetPortSettingsOutcomeCallable GameLiftClient::UpdateFleetPortSettingsCallable(const UpdateFleetPortSettingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateFleetPortSettings(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateFleetPortSettings(request); } );
 }
 
 void GameLiftClient::UpdateFleetPortSettingsAsync(const UpdateFleetPortSettingsRequest& request, const UpdateFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1240,6 +1590,16 @@ void GameLiftClient::UpdateFleetPortSettingsAsync(const UpdateFleetPortSettingsR
   m_executor->Submit( [this, request, handler, context](){ this->UpdateFleetPortSettingsAsyncHelper( request, handler, context ); } );
 }
 
+UpdateFleetPortSettingsOutcomeCallable GameLiftClient::UpdateFleetPortSettingsCallable(UpdateFleetPortSettingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::UpdateFleetPortSettings, this, std::move(request)));
+}
+
+void GameLiftClient::UpdateFleetPortSettingsAsync(UpdateFleetPortSettingsRequest&& request, const UpdateFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::UpdateFleetPortSettingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::UpdateFleetPortSettingsAsyncHelper(const UpdateFleetPortSettingsRequest& request, const UpdateFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateFleetPortSettings(request), context);
@@ -1263,7 +1623,7 @@ UpdateGameSessionOutcome GameLiftClient::UpdateGameSession(const UpdateGameSessi
 
 UpdateGameSessionOutcomeCallable GameLiftClient::UpdateGameSessionCallable(const UpdateGameSessionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateGameSession(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateGameSession(request); } );
 }
 
 void GameLiftClient::UpdateGameSessionAsync(const UpdateGameSessionRequest& request, const UpdateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1271,6 +1631,16 @@ void GameLiftClient::UpdateGameSessionAsync(const UpdateGameSessionRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->UpdateGameSessionAsyncHelper( request, handler, context ); } );
 }
 
+UpdateGameSessionOutcomeCallable GameLiftClient::UpdateGameSessionCallable(UpdateGameSessionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::UpdateGameSession, this, std::move(request)));
+}
+
+void GameLiftClient::UpdateGameSessionAsync(UpdateGameSessionRequest&& request, const UpdateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::UpdateGameSessionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::UpdateGameSessionAsyncHelper(const UpdateGameSessionRequest& request, const UpdateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateGameSession(request), context);
@@ -1294,7 +1664,7 @@ UpdateRuntimeConfigurationOutcome GameLiftClient::UpdateRuntimeConfiguration(con
 
 UpdateRuntimeConfigurationOutcomeCallable GameLiftClient::UpdateRuntimeConfigurationCallable(const UpdateRuntimeConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateRuntimeConfiguration(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateRuntimeConfiguration(request); } );
 }
 
 void GameLiftClient::UpdateRuntimeConfigurationAsync(const UpdateRuntimeConfigurationRequest& request, const UpdateRuntimeConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1302,8 +1672,414 @@ void GameLiftClient::UpdateRuntimeConfigurationAsync(const UpdateRuntimeConfigur
   m_executor->Submit( [this, request, handler, context](){ this->UpdateRuntimeConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+UpdateRuntimeConfigurationOutcomeCallable GameLiftClient::UpdateRuntimeConfigurationCallable(UpdateRuntimeConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GameLiftClient::UpdateRuntimeConfiguration, this, std::move(request)));
+}
+
+void GameLiftClient::UpdateRuntimeConfigurationAsync(UpdateRuntimeConfigurationRequest&& request, const UpdateRuntimeConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GameLiftClient::UpdateRuntimeConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GameLiftClient::UpdateRuntimeConfigurationAsyncHelper(const UpdateRuntimeConfigurationRequest& request, const UpdateRuntimeConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateRuntimeConfiguration(request), context);
 }
 
+Paginator<GameLiftClient, DescribeFleetAttributesRequest, DescribeFleetAttributesOutcome> GameLiftClient::DescribeFleetAttributesPaginator(const DescribeFleetAttributesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GameLiftClient, DescribeFleetAttributesRequest, DescribeFleetAttributesOutcome>(this, &GameLiftClient::DescribeFleetAttributes, request,
+    [](const DescribeFleetAttributesRequest& current, const DescribeFleetAttributesOutcome& outcome, DescribeFleetAttributesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<GameLiftClient, DescribeFleetCapacityRequest, DescribeFleetCapacityOutcome> GameLiftClient::DescribeFleetCapacityPaginator(const DescribeFleetCapacityRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GameLiftClient, DescribeFleetCapacityRequest, DescribeFleetCapacityOutcome>(this, &GameLiftClient::DescribeFleetCapacity, request,
+    [](const DescribeFleetCapacityRequest& current, const DescribeFleetCapacityOutcome& outcome, DescribeFleetCapacityRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<GameLiftClient, DescribeFleetEventsRequest, DescribeFleetEventsOutcome> GameLiftClient::DescribeFleetEventsPaginator(const DescribeFleetEventsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GameLiftClient, DescribeFleetEventsRequest, DescribeFleetEventsOutcome>(this, &GameLiftClient::DescribeFleetEvents, request,
+    [](const DescribeFleetEventsRequest& current, const DescribeFleetEventsOutcome& outcome, DescribeFleetEventsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<GameLiftClient, DescribeFleetUtilizationRequest, DescribeFleetUtilizationOutcome> GameLiftClient::DescribeFleetUtilizationPaginator(const DescribeFleetUtilizationRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GameLiftClient, DescribeFleetUtilizationRequest, DescribeFleetUtilizationOutcome>(this, &GameLiftClient::DescribeFleetUtilization, request,
+    [](const DescribeFleetUtilizationRequest& current, const DescribeFleetUtilizationOutcome& outcome, DescribeFleetUtilizationRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<GameLiftClient, DescribeGameSessionDetailsRequest, DescribeGameSessionDetailsOutcome> GameLiftClient::DescribeGameSessionDetailsPaginator(const DescribeGameSessionDetailsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GameLiftClient, DescribeGameSessionDetailsRequest, DescribeGameSessionDetailsOutcome>(this, &GameLiftClient::DescribeGameSessionDetails, request,
+    [](const DescribeGameSessionDetailsRequest& current, const DescribeGameSessionDetailsOutcome& outcome, DescribeGameSessionDetailsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<GameLiftClient, DescribeGameSessionsRequest, DescribeGameSessionsOutcome> GameLiftClient::DescribeGameSessionsPaginator(const DescribeGameSessionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GameLiftClient, DescribeGameSessionsRequest, DescribeGameSessionsOutcome>(this, &GameLiftClient::DescribeGameSessions, request,
+    [](const DescribeGameSessionsRequest& current, const DescribeGameSessionsOutcome& outcome, DescribeGameSessionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<GameLiftClient, DescribePlayerSessionsRequest, DescribePlayerSessionsOutcome> GameLiftClient::DescribePlayerSessionsPaginator(const DescribePlayerSessionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GameLiftClient, DescribePlayerSessionsRequest, DescribePlayerSessionsOutcome>(this, &GameLiftClient::DescribePlayerSessions, request,
+    [](const DescribePlayerSessionsRequest& current, const DescribePlayerSessionsOutcome& outcome, DescribePlayerSessionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<GameLiftClient, DescribeScalingPoliciesRequest, DescribeScalingPoliciesOutcome> GameLiftClient::DescribeScalingPoliciesPaginator(const DescribeScalingPoliciesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GameLiftClient, DescribeScalingPoliciesRequest, DescribeScalingPoliciesOutcome>(this, &GameLiftClient::DescribeScalingPolicies, request,
+    [](const DescribeScalingPoliciesRequest& current, const DescribeScalingPoliciesOutcome& outcome, DescribeScalingPoliciesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<GameLiftClient, ListAliasesRequest, ListAliasesOutcome> GameLiftClient::ListAliasesPaginator(const ListAliasesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GameLiftClient, ListAliasesRequest, ListAliasesOutcome>(this, &GameLiftClient::ListAliases, request,
+    [](const ListAliasesRequest& current, const ListAliasesOutcome& outcome, ListAliasesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<GameLiftClient, ListBuildsRequest, ListBuildsOutcome> GameLiftClient::ListBuildsPaginator(const ListBuildsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GameLiftClient, ListBuildsRequest, ListBuildsOutcome>(this, &GameLiftClient::ListBuilds, request,
+    [](const ListBuildsRequest& current, const ListBuildsOutcome& outcome, ListBuildsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<GameLiftClient, ListFleetsRequest, ListFleetsOutcome> GameLiftClient::ListFleetsPaginator(const ListFleetsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GameLiftClient, ListFleetsRequest, ListFleetsOutcome>(this, &GameLiftClient::ListFleets, request,
+    [](const ListFleetsRequest& current, const ListFleetsOutcome& outcome, ListFleetsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<GameLiftClient, SearchGameSessionsRequest, SearchGameSessionsOutcome> GameLiftClient::SearchGameSessionsPaginator(const SearchGameSessionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GameLiftClient, SearchGameSessionsRequest, SearchGameSessionsOutcome>(this, &GameLiftClient::SearchGameSessions, request,
+    [](const SearchGameSessionsRequest& current, const SearchGameSessionsOutcome& outcome, SearchGameSessionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<GameLiftClient, CreateAliasRequest, CreateAliasOutcome> GameLiftClient::CreateAliasAwaitable(CreateAliasRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::CreateAlias, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, CreateBuildRequest, CreateBuildOutcome> GameLiftClient::CreateBuildAwaitable(CreateBuildRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::CreateBuild, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, CreateFleetRequest, CreateFleetOutcome> GameLiftClient::CreateFleetAwaitable(CreateFleetRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::CreateFleet, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, CreateGameSessionRequest, CreateGameSessionOutcome> GameLiftClient::CreateGameSessionAwaitable(CreateGameSessionRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::CreateGameSession, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, CreatePlayerSessionRequest, CreatePlayerSessionOutcome> GameLiftClient::CreatePlayerSessionAwaitable(CreatePlayerSessionRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::CreatePlayerSession, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, CreatePlayerSessionsRequest, CreatePlayerSessionsOutcome> GameLiftClient::CreatePlayerSessionsAwaitable(CreatePlayerSessionsRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::CreatePlayerSessions, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DeleteAliasRequest, DeleteAliasOutcome> GameLiftClient::DeleteAliasAwaitable(DeleteAliasRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DeleteAlias, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DeleteBuildRequest, DeleteBuildOutcome> GameLiftClient::DeleteBuildAwaitable(DeleteBuildRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DeleteBuild, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DeleteFleetRequest, DeleteFleetOutcome> GameLiftClient::DeleteFleetAwaitable(DeleteFleetRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DeleteFleet, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DeleteScalingPolicyRequest, DeleteScalingPolicyOutcome> GameLiftClient::DeleteScalingPolicyAwaitable(DeleteScalingPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DeleteScalingPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DescribeAliasRequest, DescribeAliasOutcome> GameLiftClient::DescribeAliasAwaitable(DescribeAliasRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DescribeAlias, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DescribeBuildRequest, DescribeBuildOutcome> GameLiftClient::DescribeBuildAwaitable(DescribeBuildRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DescribeBuild, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DescribeEC2InstanceLimitsRequest, DescribeEC2InstanceLimitsOutcome> GameLiftClient::DescribeEC2InstanceLimitsAwaitable(DescribeEC2InstanceLimitsRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DescribeEC2InstanceLimits, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DescribeFleetAttributesRequest, DescribeFleetAttributesOutcome> GameLiftClient::DescribeFleetAttributesAwaitable(DescribeFleetAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DescribeFleetAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DescribeFleetCapacityRequest, DescribeFleetCapacityOutcome> GameLiftClient::DescribeFleetCapacityAwaitable(DescribeFleetCapacityRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DescribeFleetCapacity, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DescribeFleetEventsRequest, DescribeFleetEventsOutcome> GameLiftClient::DescribeFleetEventsAwaitable(DescribeFleetEventsRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DescribeFleetEvents, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DescribeFleetPortSettingsRequest, DescribeFleetPortSettingsOutcome> GameLiftClient::DescribeFleetPortSettingsAwaitable(DescribeFleetPortSettingsRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DescribeFleetPortSettings, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DescribeFleetUtilizationRequest, DescribeFleetUtilizationOutcome> GameLiftClient::DescribeFleetUtilizationAwaitable(DescribeFleetUtilizationRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DescribeFleetUtilization, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DescribeGameSessionDetailsRequest, DescribeGameSessionDetailsOutcome> GameLiftClient::DescribeGameSessionDetailsAwaitable(DescribeGameSessionDetailsRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DescribeGameSessionDetails, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DescribeGameSessionsRequest, DescribeGameSessionsOutcome> GameLiftClient::DescribeGameSessionsAwaitable(DescribeGameSessionsRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DescribeGameSessions, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DescribePlayerSessionsRequest, DescribePlayerSessionsOutcome> GameLiftClient::DescribePlayerSessionsAwaitable(DescribePlayerSessionsRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DescribePlayerSessions, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DescribeRuntimeConfigurationRequest, DescribeRuntimeConfigurationOutcome> GameLiftClient::DescribeRuntimeConfigurationAwaitable(DescribeRuntimeConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DescribeRuntimeConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, DescribeScalingPoliciesRequest, DescribeScalingPoliciesOutcome> GameLiftClient::DescribeScalingPoliciesAwaitable(DescribeScalingPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::DescribeScalingPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, GetGameSessionLogUrlRequest, GetGameSessionLogUrlOutcome> GameLiftClient::GetGameSessionLogUrlAwaitable(GetGameSessionLogUrlRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::GetGameSessionLogUrl, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, ListAliasesRequest, ListAliasesOutcome> GameLiftClient::ListAliasesAwaitable(ListAliasesRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::ListAliases, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, ListBuildsRequest, ListBuildsOutcome> GameLiftClient::ListBuildsAwaitable(ListBuildsRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::ListBuilds, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, ListFleetsRequest, ListFleetsOutcome> GameLiftClient::ListFleetsAwaitable(ListFleetsRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::ListFleets, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, PutScalingPolicyRequest, PutScalingPolicyOutcome> GameLiftClient::PutScalingPolicyAwaitable(PutScalingPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::PutScalingPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, RequestUploadCredentialsRequest, RequestUploadCredentialsOutcome> GameLiftClient::RequestUploadCredentialsAwaitable(RequestUploadCredentialsRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::RequestUploadCredentials, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, ResolveAliasRequest, ResolveAliasOutcome> GameLiftClient::ResolveAliasAwaitable(ResolveAliasRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::ResolveAlias, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, SearchGameSessionsRequest, SearchGameSessionsOutcome> GameLiftClient::SearchGameSessionsAwaitable(SearchGameSessionsRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::SearchGameSessions, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, UpdateAliasRequest, UpdateAliasOutcome> GameLiftClient::UpdateAliasAwaitable(UpdateAliasRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::UpdateAlias, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, UpdateBuildRequest, UpdateBuildOutcome> GameLiftClient::UpdateBuildAwaitable(UpdateBuildRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::UpdateBuild, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, UpdateFleetAttributesRequest, UpdateFleetAttributesOutcome> GameLiftClient::UpdateFleetAttributesAwaitable(UpdateFleetAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::UpdateFleetAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, UpdateFleetCapacityRequest, UpdateFleetCapacityOutcome> GameLiftClient::UpdateFleetCapacityAwaitable(UpdateFleetCapacityRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::UpdateFleetCapacity, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, UpdateFleetPortSettingsRequest, UpdateFleetPortSettingsOutcome> GameLiftClient::UpdateFleetPortSettingsAwaitable(UpdateFleetPortSettingsRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::UpdateFleetPortSettings, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, UpdateGameSessionRequest, UpdateGameSessionOutcome> GameLiftClient::UpdateGameSessionAwaitable(UpdateGameSessionRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::UpdateGameSession, std::move(request) } };
+}
+
+ClientOperationAwaitable<GameLiftClient, UpdateRuntimeConfigurationRequest, UpdateRuntimeConfigurationOutcome> GameLiftClient::UpdateRuntimeConfigurationAwaitable(UpdateRuntimeConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &GameLiftClient::UpdateRuntimeConfiguration, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
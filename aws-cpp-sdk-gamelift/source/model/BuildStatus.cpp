@@ -29,26 +29,32 @@ namespace Aws
       namespace BuildStatusMapper
       {
 
-        static const int INITIALIZED_HASH = HashingUtils::HashString("INITIALIZED");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int INITIALIZED_HASH = -907986252;
+        static const int READY_HASH = 77848963;
+        static const int FAILED_HASH = 2066319421;
 
 
         BuildStatus GetBuildStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIALIZED_HASH)
+          switch (hashCode)
           {
+          case INITIALIZED_HASH:
             return BuildStatus::INITIALIZED;
-          }
-          else if (hashCode == READY_HASH)
-          {
+          case READY_HASH:
             return BuildStatus::READY;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return BuildStatus::FAILED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
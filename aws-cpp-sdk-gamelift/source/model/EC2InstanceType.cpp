@@ -29,151 +29,107 @@ namespace Aws
       namespace EC2InstanceTypeMapper
       {
 
-        static const int t2_micro_HASH = HashingUtils::HashString("t2.micro");
-        static const int t2_small_HASH = HashingUtils::HashString("t2.small");
-        static const int t2_medium_HASH = HashingUtils::HashString("t2.medium");
-        static const int t2_large_HASH = HashingUtils::HashString("t2.large");
-        static const int c3_large_HASH = HashingUtils::HashString("c3.large");
-        static const int c3_xlarge_HASH = HashingUtils::HashString("c3.xlarge");
-        static const int c3_2xlarge_HASH = HashingUtils::HashString("c3.2xlarge");
-        static const int c3_4xlarge_HASH = HashingUtils::HashString("c3.4xlarge");
-        static const int c3_8xlarge_HASH = HashingUtils::HashString("c3.8xlarge");
-        static const int c4_large_HASH = HashingUtils::HashString("c4.large");
-        static const int c4_xlarge_HASH = HashingUtils::HashString("c4.xlarge");
-        static const int c4_2xlarge_HASH = HashingUtils::HashString("c4.2xlarge");
-        static const int c4_4xlarge_HASH = HashingUtils::HashString("c4.4xlarge");
-        static const int c4_8xlarge_HASH = HashingUtils::HashString("c4.8xlarge");
-        static const int r3_large_HASH = HashingUtils::HashString("r3.large");
-        static const int r3_xlarge_HASH = HashingUtils::HashString("r3.xlarge");
-        static const int r3_2xlarge_HASH = HashingUtils::HashString("r3.2xlarge");
-        static const int r3_4xlarge_HASH = HashingUtils::HashString("r3.4xlarge");
-        static const int r3_8xlarge_HASH = HashingUtils::HashString("r3.8xlarge");
-        static const int m3_medium_HASH = HashingUtils::HashString("m3.medium");
-        static const int m3_large_HASH = HashingUtils::HashString("m3.large");
-        static const int m3_xlarge_HASH = HashingUtils::HashString("m3.xlarge");
-        static const int m3_2xlarge_HASH = HashingUtils::HashString("m3.2xlarge");
-        static const int m4_large_HASH = HashingUtils::HashString("m4.large");
-        static const int m4_xlarge_HASH = HashingUtils::HashString("m4.xlarge");
-        static const int m4_2xlarge_HASH = HashingUtils::HashString("m4.2xlarge");
-        static const int m4_4xlarge_HASH = HashingUtils::HashString("m4.4xlarge");
-        static const int m4_10xlarge_HASH = HashingUtils::HashString("m4.10xlarge");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int t2_micro_HASH = -1146088684;
+        static const int t2_small_HASH = -1140430505;
+        static const int t2_medium_HASH = -1172683483;
+        static const int t2_large_HASH = -1147236469;
+        static const int c3_large_HASH = 177262589;
+        static const int c3_xlarge_HASH = 1553385793;
+        static const int c3_2xlarge_HASH = -732183369;
+        static const int c3_4xlarge_HASH = 1042823993;
+        static const int c3_8xlarge_HASH = 297871421;
+        static const int c4_large_HASH = 1064766270;
+        static const int c4_xlarge_HASH = -998771168;
+        static const int c4_2xlarge_HASH = 1755329464;
+        static const int c4_4xlarge_HASH = -764630470;
+        static const int c4_8xlarge_HASH = -1509583042;
+        static const int r3_large_HASH = 549613838;
+        static const int r3_xlarge_HASH = 211372624;
+        static const int r3_2xlarge_HASH = 615081352;
+        static const int r3_4xlarge_HASH = -1904878582;
+        static const int r3_8xlarge_HASH = 1645136142;
+        static const int m3_medium_HASH = 337406205;
+        static const int m3_large_HASH = 425496755;
+        static const int m3_xlarge_HASH = 658710347;
+        static const int m3_2xlarge_HASH = 1597648877;
+        static const int m4_large_HASH = 1313000436;
+        static const int m4_xlarge_HASH = -1893446614;
+        static const int m4_2xlarge_HASH = -209805586;
+        static const int m4_4xlarge_HASH = 1565201776;
+        static const int m4_10xlarge_HASH = 1220608329;
 
 
         EC2InstanceType GetEC2InstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == t2_micro_HASH)
+          switch (hashCode)
           {
+          case t2_micro_HASH:
             return EC2InstanceType::t2_micro;
-          }
-          else if (hashCode == t2_small_HASH)
-          {
+          case t2_small_HASH:
             return EC2InstanceType::t2_small;
-          }
-          else if (hashCode == t2_medium_HASH)
-          {
+          case t2_medium_HASH:
             return EC2InstanceType::t2_medium;
-          }
-          else if (hashCode == t2_large_HASH)
-          {
+          case t2_large_HASH:
             return EC2InstanceType::t2_large;
-          }
-          else if (hashCode == c3_large_HASH)
-          {
+          case c3_large_HASH:
             return EC2InstanceType::c3_large;
-          }
-          else if (hashCode == c3_xlarge_HASH)
-          {
+          case c3_xlarge_HASH:
             return EC2InstanceType::c3_xlarge;
-          }
-          else if (hashCode == c3_2xlarge_HASH)
-          {
+          case c3_2xlarge_HASH:
             return EC2InstanceType::c3_2xlarge;
-          }
-          else if (hashCode == c3_4xlarge_HASH)
-          {
+          case c3_4xlarge_HASH:
             return EC2InstanceType::c3_4xlarge;
-          }
-          else if (hashCode == c3_8xlarge_HASH)
-          {
+          case c3_8xlarge_HASH:
             return EC2InstanceType::c3_8xlarge;
-          }
-          else if (hashCode == c4_large_HASH)
-          {
+          case c4_large_HASH:
             return EC2InstanceType::c4_large;
-          }
-          else if (hashCode == c4_xlarge_HASH)
-          {
+          case c4_xlarge_HASH:
             return EC2InstanceType::c4_xlarge;
-          }
-          else if (hashCode == c4_2xlarge_HASH)
-          {
+          case c4_2xlarge_HASH:
             return EC2InstanceType::c4_2xlarge;
-          }
-          else if (hashCode == c4_4xlarge_HASH)
-          {
+          case c4_4xlarge_HASH:
             return EC2InstanceType::c4_4xlarge;
-          }
-          else if (hashCode == c4_8xlarge_HASH)
-          {
+          case c4_8xlarge_HASH:
             return EC2InstanceType::c4_8xlarge;
-          }
-          else if (hashCode == r3_large_HASH)
-          {
+          case r3_large_HASH:
             return EC2InstanceType::r3_large;
-          }
-          else if (hashCode == r3_xlarge_HASH)
-          {
+          case r3_xlarge_HASH:
             return EC2InstanceType::r3_xlarge;
-          }
-          else if (hashCode == r3_2xlarge_HASH)
-          {
+          case r3_2xlarge_HASH:
             return EC2InstanceType::r3_2xlarge;
-          }
-          else if (hashCode == r3_4xlarge_HASH)
-          {
+          case r3_4xlarge_HASH:
             return EC2InstanceType::r3_4xlarge;
-          }
-          else if (hashCode == r3_8xlarge_HASH)
-          {
+          case r3_8xlarge_HASH:
             return EC2InstanceType::r3_8xlarge;
-          }
-          else if (hashCode == m3_medium_HASH)
-          {
+          case m3_medium_HASH:
             return EC2InstanceType::m3_medium;
-          }
-          else if (hashCode == m3_large_HASH)
-          {
+          case m3_large_HASH:
             return EC2InstanceType::m3_large;
-          }
-          else if (hashCode == m3_xlarge_HASH)
-          {
+          case m3_xlarge_HASH:
             return EC2InstanceType::m3_xlarge;
-          }
-          else if (hashCode == m3_2xlarge_HASH)
-          {
+          case m3_2xlarge_HASH:
             return EC2InstanceType::m3_2xlarge;
-          }
-          else if (hashCode == m4_large_HASH)
-          {
+          case m4_large_HASH:
             return EC2InstanceType::m4_large;
-          }
-          else if (hashCode == m4_xlarge_HASH)
-          {
+          case m4_xlarge_HASH:
             return EC2InstanceType::m4_xlarge;
-          }
-          else if (hashCode == m4_2xlarge_HASH)
-          {
+          case m4_2xlarge_HASH:
             return EC2InstanceType::m4_2xlarge;
-          }
-          else if (hashCode == m4_4xlarge_HASH)
-          {
+          case m4_4xlarge_HASH:
             return EC2InstanceType::m4_4xlarge;
-          }
-          else if (hashCode == m4_10xlarge_HASH)
-          {
+          case m4_10xlarge_HASH:
             return EC2InstanceType::m4_10xlarge;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,101 +29,77 @@ namespace Aws
       namespace EventCodeMapper
       {
 
-        static const int GENERIC_EVENT_HASH = HashingUtils::HashString("GENERIC_EVENT");
-        static const int FLEET_CREATED_HASH = HashingUtils::HashString("FLEET_CREATED");
-        static const int FLEET_DELETED_HASH = HashingUtils::HashString("FLEET_DELETED");
-        static const int FLEET_SCALING_EVENT_HASH = HashingUtils::HashString("FLEET_SCALING_EVENT");
-        static const int FLEET_STATE_DOWNLOADING_HASH = HashingUtils::HashString("FLEET_STATE_DOWNLOADING");
-        static const int FLEET_STATE_VALIDATING_HASH = HashingUtils::HashString("FLEET_STATE_VALIDATING");
-        static const int FLEET_STATE_BUILDING_HASH = HashingUtils::HashString("FLEET_STATE_BUILDING");
-        static const int FLEET_STATE_ACTIVATING_HASH = HashingUtils::HashString("FLEET_STATE_ACTIVATING");
-        static const int FLEET_STATE_ACTIVE_HASH = HashingUtils::HashString("FLEET_STATE_ACTIVE");
-        static const int FLEET_STATE_ERROR_HASH = HashingUtils::HashString("FLEET_STATE_ERROR");
-        static const int FLEET_INITIALIZATION_FAILED_HASH = HashingUtils::HashString("FLEET_INITIALIZATION_FAILED");
-        static const int FLEET_BINARY_DOWNLOAD_FAILED_HASH = HashingUtils::HashString("FLEET_BINARY_DOWNLOAD_FAILED");
-        static const int FLEET_VALIDATION_LAUNCH_PATH_NOT_FOUND_HASH = HashingUtils::HashString("FLEET_VALIDATION_LAUNCH_PATH_NOT_FOUND");
-        static const int FLEET_VALIDATION_EXECUTABLE_RUNTIME_FAILURE_HASH = HashingUtils::HashString("FLEET_VALIDATION_EXECUTABLE_RUNTIME_FAILURE");
-        static const int FLEET_VALIDATION_TIMED_OUT_HASH = HashingUtils::HashString("FLEET_VALIDATION_TIMED_OUT");
-        static const int FLEET_ACTIVATION_FAILED_HASH = HashingUtils::HashString("FLEET_ACTIVATION_FAILED");
-        static const int FLEET_ACTIVATION_FAILED_NO_INSTANCES_HASH = HashingUtils::HashString("FLEET_ACTIVATION_FAILED_NO_INSTANCES");
-        static const int FLEET_NEW_GAME_SESSION_PROTECTION_POLICY_UPDATED_HASH = HashingUtils::HashString("FLEET_NEW_GAME_SESSION_PROTECTION_POLICY_UPDATED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int GENERIC_EVENT_HASH = 170266098;
+        static const int FLEET_CREATED_HASH = 354330807;
+        static const int FLEET_DELETED_HASH = 876239336;
+        static const int FLEET_SCALING_EVENT_HASH = 1529817681;
+        static const int FLEET_STATE_DOWNLOADING_HASH = -269255013;
+        static const int FLEET_STATE_VALIDATING_HASH = 2065030098;
+        static const int FLEET_STATE_BUILDING_HASH = 2111208947;
+        static const int FLEET_STATE_ACTIVATING_HASH = -145157009;
+        static const int FLEET_STATE_ACTIVE_HASH = 1892463109;
+        static const int FLEET_STATE_ERROR_HASH = 1312112393;
+        static const int FLEET_INITIALIZATION_FAILED_HASH = -1933720469;
+        static const int FLEET_BINARY_DOWNLOAD_FAILED_HASH = -402014777;
+        static const int FLEET_VALIDATION_LAUNCH_PATH_NOT_FOUND_HASH = 2046519027;
+        static const int FLEET_VALIDATION_EXECUTABLE_RUNTIME_FAILURE_HASH = -327529693;
+        static const int FLEET_VALIDATION_TIMED_OUT_HASH = -914458575;
+        static const int FLEET_ACTIVATION_FAILED_HASH = 2200245;
+        static const int FLEET_ACTIVATION_FAILED_NO_INSTANCES_HASH = 1219705514;
+        static const int FLEET_NEW_GAME_SESSION_PROTECTION_POLICY_UPDATED_HASH = 2108099182;
 
 
         EventCode GetEventCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GENERIC_EVENT_HASH)
+          switch (hashCode)
           {
+          case GENERIC_EVENT_HASH:
             return EventCode::GENERIC_EVENT;
-          }
-          else if (hashCode == FLEET_CREATED_HASH)
-          {
+          case FLEET_CREATED_HASH:
             return EventCode::FLEET_CREATED;
-          }
-          else if (hashCode == FLEET_DELETED_HASH)
-          {
+          case FLEET_DELETED_HASH:
             return EventCode::FLEET_DELETED;
-          }
-          else if (hashCode == FLEET_SCALING_EVENT_HASH)
-          {
+          case FLEET_SCALING_EVENT_HASH:
             return EventCode::FLEET_SCALING_EVENT;
-          }
-          else if (hashCode == FLEET_STATE_DOWNLOADING_HASH)
-          {
+          case FLEET_STATE_DOWNLOADING_HASH:
             return EventCode::FLEET_STATE_DOWNLOADING;
-          }
-          else if (hashCode == FLEET_STATE_VALIDATING_HASH)
-          {
+          case FLEET_STATE_VALIDATING_HASH:
             return EventCode::FLEET_STATE_VALIDATING;
-          }
-          else if (hashCode == FLEET_STATE_BUILDING_HASH)
-          {
+          case FLEET_STATE_BUILDING_HASH:
             return EventCode::FLEET_STATE_BUILDING;
-          }
-          else if (hashCode == FLEET_STATE_ACTIVATING_HASH)
-          {
+          case FLEET_STATE_ACTIVATING_HASH:
             return EventCode::FLEET_STATE_ACTIVATING;
-          }
-          else if (hashCode == FLEET_STATE_ACTIVE_HASH)
-          {
+          case FLEET_STATE_ACTIVE_HASH:
             return EventCode::FLEET_STATE_ACTIVE;
-          }
-          else if (hashCode == FLEET_STATE_ERROR_HASH)
-          {
+          case FLEET_STATE_ERROR_HASH:
             return EventCode::FLEET_STATE_ERROR;
-          }
-          else if (hashCode == FLEET_INITIALIZATION_FAILED_HASH)
-          {
+          case FLEET_INITIALIZATION_FAILED_HASH:
             return EventCode::FLEET_INITIALIZATION_FAILED;
-          }
-          else if (hashCode == FLEET_BINARY_DOWNLOAD_FAILED_HASH)
-          {
+          case FLEET_BINARY_DOWNLOAD_FAILED_HASH:
             return EventCode::FLEET_BINARY_DOWNLOAD_FAILED;
-          }
-          else if (hashCode == FLEET_VALIDATION_LAUNCH_PATH_NOT_FOUND_HASH)
-          {
+          case FLEET_VALIDATION_LAUNCH_PATH_NOT_FOUND_HASH:
             return EventCode::FLEET_VALIDATION_LAUNCH_PATH_NOT_FOUND;
-          }
-          else if (hashCode == FLEET_VALIDATION_EXECUTABLE_RUNTIME_FAILURE_HASH)
-          {
+          case FLEET_VALIDATION_EXECUTABLE_RUNTIME_FAILURE_HASH:
             return EventCode::FLEET_VALIDATION_EXECUTABLE_RUNTIME_FAILURE;
-          }
-          else if (hashCode == FLEET_VALIDATION_TIMED_OUT_HASH)
-          {
+          case FLEET_VALIDATION_TIMED_OUT_HASH:
             return EventCode::FLEET_VALIDATION_TIMED_OUT;
-          }
-          else if (hashCode == FLEET_ACTIVATION_FAILED_HASH)
-          {
+          case FLEET_ACTIVATION_FAILED_HASH:
             return EventCode::FLEET_ACTIVATION_FAILED;
-          }
-          else if (hashCode == FLEET_ACTIVATION_FAILED_NO_INSTANCES_HASH)
-          {
+          case FLEET_ACTIVATION_FAILED_NO_INSTANCES_HASH:
             return EventCode::FLEET_ACTIVATION_FAILED_NO_INSTANCES;
-          }
-          else if (hashCode == FLEET_NEW_GAME_SESSION_PROTECTION_POLICY_UPDATED_HASH)
-          {
+          case FLEET_NEW_GAME_SESSION_PROTECTION_POLICY_UPDATED_HASH:
             return EventCode::FLEET_NEW_GAME_SESSION_PROTECTION_POLICY_UPDATED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
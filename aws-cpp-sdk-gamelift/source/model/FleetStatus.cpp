@@ -29,56 +29,50 @@ namespace Aws
       namespace FleetStatusMapper
       {
 
-        static const int NEW__HASH = HashingUtils::HashString("NEW");
-        static const int DOWNLOADING_HASH = HashingUtils::HashString("DOWNLOADING");
-        static const int VALIDATING_HASH = HashingUtils::HashString("VALIDATING");
-        static const int BUILDING_HASH = HashingUtils::HashString("BUILDING");
-        static const int ACTIVATING_HASH = HashingUtils::HashString("ACTIVATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int NEW__HASH = 77184;
+        static const int DOWNLOADING_HASH = 941831738;
+        static const int VALIDATING_HASH = 441529427;
+        static const int BUILDING_HASH = -648019276;
+        static const int ACTIVATING_HASH = -1768657680;
+        static const int ACTIVE_HASH = 1925346054;
+        static const int DELETING_HASH = 1602343848;
+        static const int ERROR__HASH = 66247144;
+        static const int TERMINATED_HASH = -823723485;
 
 
         FleetStatus GetFleetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NEW__HASH)
+          switch (hashCode)
           {
+          case NEW__HASH:
             return FleetStatus::NEW_;
-          }
-          else if (hashCode == DOWNLOADING_HASH)
-          {
+          case DOWNLOADING_HASH:
             return FleetStatus::DOWNLOADING;
-          }
-          else if (hashCode == VALIDATING_HASH)
-          {
+          case VALIDATING_HASH:
             return FleetStatus::VALIDATING;
-          }
-          else if (hashCode == BUILDING_HASH)
-          {
+          case BUILDING_HASH:
             return FleetStatus::BUILDING;
-          }
-          else if (hashCode == ACTIVATING_HASH)
-          {
+          case ACTIVATING_HASH:
             return FleetStatus::ACTIVATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
+          case ACTIVE_HASH:
             return FleetStatus::ACTIVE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
+          case DELETING_HASH:
             return FleetStatus::DELETING;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
+          case ERROR__HASH:
             return FleetStatus::ERROR_;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
+          case TERMINATED_HASH:
             return FleetStatus::TERMINATED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,31 +29,35 @@ namespace Aws
       namespace GameSessionStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int ACTIVATING_HASH = HashingUtils::HashString("ACTIVATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ACTIVE_HASH = 1925346054;
+        static const int ACTIVATING_HASH = -1768657680;
+        static const int TERMINATED_HASH = -823723485;
+        static const int TERMINATING_HASH = 234379966;
 
 
         GameSessionStatus GetGameSessionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          switch (hashCode)
           {
+          case ACTIVE_HASH:
             return GameSessionStatus::ACTIVE;
-          }
-          else if (hashCode == ACTIVATING_HASH)
-          {
+          case ACTIVATING_HASH:
             return GameSessionStatus::ACTIVATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
+          case TERMINATED_HASH:
             return GameSessionStatus::TERMINATED;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
+          case TERMINATING_HASH:
             return GameSessionStatus::TERMINATING;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace IpProtocolMapper
       {
 
-        static const int TCP_HASH = HashingUtils::HashString("TCP");
-        static const int UDP_HASH = HashingUtils::HashString("UDP");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int TCP_HASH = 82881;
+        static const int UDP_HASH = 83873;
 
 
         IpProtocol GetIpProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TCP_HASH)
+          switch (hashCode)
           {
+          case TCP_HASH:
             return IpProtocol::TCP;
-          }
-          else if (hashCode == UDP_HASH)
-          {
+          case UDP_HASH:
             return IpProtocol::UDP;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
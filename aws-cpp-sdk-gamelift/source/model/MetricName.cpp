@@ -29,41 +29,41 @@ namespace Aws
       namespace MetricNameMapper
       {
 
-        static const int ActivatingGameSessions_HASH = HashingUtils::HashString("ActivatingGameSessions");
-        static const int ActiveGameSessions_HASH = HashingUtils::HashString("ActiveGameSessions");
-        static const int ActiveInstances_HASH = HashingUtils::HashString("ActiveInstances");
-        static const int AvailablePlayerSessions_HASH = HashingUtils::HashString("AvailablePlayerSessions");
-        static const int CurrentPlayerSessions_HASH = HashingUtils::HashString("CurrentPlayerSessions");
-        static const int IdleInstances_HASH = HashingUtils::HashString("IdleInstances");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ActivatingGameSessions_HASH = -19593249;
+        static const int ActiveGameSessions_HASH = -930437899;
+        static const int ActiveInstances_HASH = -532095496;
+        static const int AvailablePlayerSessions_HASH = -1696171609;
+        static const int CurrentPlayerSessions_HASH = -50417577;
+        static const int IdleInstances_HASH = -1352360726;
 
 
         MetricName GetMetricNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ActivatingGameSessions_HASH)
+          switch (hashCode)
           {
+          case ActivatingGameSessions_HASH:
             return MetricName::ActivatingGameSessions;
-          }
-          else if (hashCode == ActiveGameSessions_HASH)
-          {
+          case ActiveGameSessions_HASH:
             return MetricName::ActiveGameSessions;
-          }
-          else if (hashCode == ActiveInstances_HASH)
-          {
+          case ActiveInstances_HASH:
             return MetricName::ActiveInstances;
-          }
-          else if (hashCode == AvailablePlayerSessions_HASH)
-          {
+          case AvailablePlayerSessions_HASH:
             return MetricName::AvailablePlayerSessions;
-          }
-          else if (hashCode == CurrentPlayerSessions_HASH)
-          {
+          case CurrentPlayerSessions_HASH:
             return MetricName::CurrentPlayerSessions;
-          }
-          else if (hashCode == IdleInstances_HASH)
-          {
+          case IdleInstances_HASH:
             return MetricName::IdleInstances;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
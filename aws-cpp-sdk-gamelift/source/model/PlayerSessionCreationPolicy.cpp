@@ -29,21 +29,29 @@ namespace Aws
       namespace PlayerSessionCreationPolicyMapper
       {
 
-        static const int ACCEPT_ALL_HASH = HashingUtils::HashString("ACCEPT_ALL");
-        static const int DENY_ALL_HASH = HashingUtils::HashString("DENY_ALL");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ACCEPT_ALL_HASH = -740617782;
+        static const int DENY_ALL_HASH = 1678392526;
 
 
         PlayerSessionCreationPolicy GetPlayerSessionCreationPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCEPT_ALL_HASH)
+          switch (hashCode)
           {
+          case ACCEPT_ALL_HASH:
             return PlayerSessionCreationPolicy::ACCEPT_ALL;
-          }
-          else if (hashCode == DENY_ALL_HASH)
-          {
+          case DENY_ALL_HASH:
             return PlayerSessionCreationPolicy::DENY_ALL;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
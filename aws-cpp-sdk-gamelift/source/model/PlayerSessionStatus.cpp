@@ -29,31 +29,35 @@ namespace Aws
       namespace PlayerSessionStatusMapper
       {
 
-        static const int RESERVED_HASH = HashingUtils::HashString("RESERVED");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int TIMEDOUT_HASH = HashingUtils::HashString("TIMEDOUT");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int RESERVED_HASH = 432241448;
+        static const int ACTIVE_HASH = 1925346054;
+        static const int COMPLETED_HASH = 1383663147;
+        static const int TIMEDOUT_HASH = -1294255945;
 
 
         PlayerSessionStatus GetPlayerSessionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RESERVED_HASH)
+          switch (hashCode)
           {
+          case RESERVED_HASH:
             return PlayerSessionStatus::RESERVED;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
+          case ACTIVE_HASH:
             return PlayerSessionStatus::ACTIVE;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
+          case COMPLETED_HASH:
             return PlayerSessionStatus::COMPLETED;
-          }
-          else if (hashCode == TIMEDOUT_HASH)
-          {
+          case TIMEDOUT_HASH:
             return PlayerSessionStatus::TIMEDOUT;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace ProtectionPolicyMapper
       {
 
-        static const int NoProtection_HASH = HashingUtils::HashString("NoProtection");
-        static const int FullProtection_HASH = HashingUtils::HashString("FullProtection");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int NoProtection_HASH = -105981030;
+        static const int FullProtection_HASH = -430358808;
 
 
         ProtectionPolicy GetProtectionPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NoProtection_HASH)
+          switch (hashCode)
           {
+          case NoProtection_HASH:
             return ProtectionPolicy::NoProtection;
-          }
-          else if (hashCode == FullProtection_HASH)
-          {
+          case FullProtection_HASH:
             return ProtectionPolicy::FullProtection;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
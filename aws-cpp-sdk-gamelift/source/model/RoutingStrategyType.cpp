@@ -29,21 +29,29 @@ namespace Aws
       namespace RoutingStrategyTypeMapper
       {
 
-        static const int SIMPLE_HASH = HashingUtils::HashString("SIMPLE");
-        static const int TERMINAL_HASH = HashingUtils::HashString("TERMINAL");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int SIMPLE_HASH = -1848957518;
+        static const int TERMINAL_HASH = -398622084;
 
 
         RoutingStrategyType GetRoutingStrategyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SIMPLE_HASH)
+          switch (hashCode)
           {
+          case SIMPLE_HASH:
             return RoutingStrategyType::SIMPLE;
-          }
-          else if (hashCode == TERMINAL_HASH)
-          {
+          case TERMINAL_HASH:
             return RoutingStrategyType::TERMINAL;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace ScalingAdjustmentTypeMapper
       {
 
-        static const int ChangeInCapacity_HASH = HashingUtils::HashString("ChangeInCapacity");
-        static const int ExactCapacity_HASH = HashingUtils::HashString("ExactCapacity");
-        static const int PercentChangeInCapacity_HASH = HashingUtils::HashString("PercentChangeInCapacity");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ChangeInCapacity_HASH = -796727057;
+        static const int ExactCapacity_HASH = -160004935;
+        static const int PercentChangeInCapacity_HASH = 1784216340;
 
 
         ScalingAdjustmentType GetScalingAdjustmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ChangeInCapacity_HASH)
+          switch (hashCode)
           {
+          case ChangeInCapacity_HASH:
             return ScalingAdjustmentType::ChangeInCapacity;
-          }
-          else if (hashCode == ExactCapacity_HASH)
-          {
+          case ExactCapacity_HASH:
             return ScalingAdjustmentType::ExactCapacity;
-          }
-          else if (hashCode == PercentChangeInCapacity_HASH)
-          {
+          case PercentChangeInCapacity_HASH:
             return ScalingAdjustmentType::PercentChangeInCapacity;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,46 +29,44 @@ namespace Aws
       namespace ScalingStatusTypeMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int UPDATE_REQUESTED_HASH = HashingUtils::HashString("UPDATE_REQUESTED");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DELETE_REQUESTED_HASH = HashingUtils::HashString("DELETE_REQUESTED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ACTIVE_HASH = 1925346054;
+        static const int UPDATE_REQUESTED_HASH = -1496176808;
+        static const int UPDATING_HASH = 2105227078;
+        static const int DELETE_REQUESTED_HASH = -1733344838;
+        static const int DELETING_HASH = 1602343848;
+        static const int DELETED_HASH = -2026521607;
+        static const int ERROR__HASH = 66247144;
 
 
         ScalingStatusType GetScalingStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          switch (hashCode)
           {
+          case ACTIVE_HASH:
             return ScalingStatusType::ACTIVE;
-          }
-          else if (hashCode == UPDATE_REQUESTED_HASH)
-          {
+          case UPDATE_REQUESTED_HASH:
             return ScalingStatusType::UPDATE_REQUESTED;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
+          case UPDATING_HASH:
             return ScalingStatusType::UPDATING;
-          }
-          else if (hashCode == DELETE_REQUESTED_HASH)
-          {
+          case DELETE_REQUESTED_HASH:
             return ScalingStatusType::DELETE_REQUESTED;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
+          case DELETING_HASH:
             return ScalingStatusType::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
+          case DELETED_HASH:
             return ScalingStatusType::DELETED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
+          case ERROR__HASH:
             return ScalingStatusType::ERROR_;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -41,6 +41,9 @@
 #include <aws/glacier/model/UploadMultipartPartResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -339,6 +342,18 @@ namespace Model
          */
         virtual void AbortMultipartUploadAsync(const Model::AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AbortMultipartUploadCallable(const Model::AbortMultipartUploadRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AbortMultipartUploadOutcomeCallable AbortMultipartUploadCallable(Model::AbortMultipartUploadRequest&& request) const;
+
+        /**
+         * Same as AbortMultipartUploadAsync(const Model::AbortMultipartUploadRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AbortMultipartUploadAsync(Model::AbortMultipartUploadRequest&& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation aborts the vault locking process if the vault lock is not in
          * the <code>Locked</code> state. If the vault lock is in the <code>Locked</code>
@@ -406,6 +421,18 @@ namespace Model
          */
         virtual void AbortVaultLockAsync(const Model::AbortVaultLockRequest& request, const AbortVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AbortVaultLockCallable(const Model::AbortVaultLockRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AbortVaultLockOutcomeCallable AbortVaultLockCallable(Model::AbortVaultLockRequest&& request) const;
+
+        /**
+         * Same as AbortVaultLockAsync(const Model::AbortVaultLockRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AbortVaultLockAsync(Model::AbortVaultLockRequest&& request, const AbortVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation adds the specified tags to a vault. Each tag is composed of a
          * key and a value. Each vault can have up to 10 tags. If your request would cause
@@ -446,6 +473,18 @@ namespace Model
          */
         virtual void AddTagsToVaultAsync(const Model::AddTagsToVaultRequest& request, const AddTagsToVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToVaultCallable(const Model::AddTagsToVaultRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsToVaultOutcomeCallable AddTagsToVaultCallable(Model::AddTagsToVaultRequest&& request) const;
+
+        /**
+         * Same as AddTagsToVaultAsync(const Model::AddTagsToVaultRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsToVaultAsync(Model::AddTagsToVaultRequest&& request, const AddTagsToVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>You call this operation to inform Amazon Glacier that all the archive parts
          * have been uploaded and that Amazon Glacier can now assemble the archive from the
@@ -579,6 +618,18 @@ namespace Model
          */
         virtual void CompleteMultipartUploadAsync(const Model::CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CompleteMultipartUploadCallable(const Model::CompleteMultipartUploadRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CompleteMultipartUploadOutcomeCallable CompleteMultipartUploadCallable(Model::CompleteMultipartUploadRequest&& request) const;
+
+        /**
+         * Same as CompleteMultipartUploadAsync(const Model::CompleteMultipartUploadRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CompleteMultipartUploadAsync(Model::CompleteMultipartUploadRequest&& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation completes the vault locking process by transitioning the vault
          * lock from the <code>InProgress</code> state to the <code>Locked</code> state,
@@ -640,6 +691,18 @@ namespace Model
          */
         virtual void CompleteVaultLockAsync(const Model::CompleteVaultLockRequest& request, const CompleteVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CompleteVaultLockCallable(const Model::CompleteVaultLockRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CompleteVaultLockOutcomeCallable CompleteVaultLockCallable(Model::CompleteVaultLockRequest&& request) const;
+
+        /**
+         * Same as CompleteVaultLockAsync(const Model::CompleteVaultLockRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CompleteVaultLockAsync(Model::CompleteVaultLockRequest&& request, const CompleteVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation creates a new vault with the specified name. The name of the
          * vault must be unique within a region for an AWS account. You can create up to
@@ -710,6 +773,18 @@ namespace Model
          */
         virtual void CreateVaultAsync(const Model::CreateVaultRequest& request, const CreateVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVaultCallable(const Model::CreateVaultRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateVaultOutcomeCallable CreateVaultCallable(Model::CreateVaultRequest&& request) const;
+
+        /**
+         * Same as CreateVaultAsync(const Model::CreateVaultRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateVaultAsync(Model::CreateVaultRequest&& request, const CreateVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation deletes an archive from a vault. Subsequent requests to
          * initiate a retrieval of this archive will fail. Archive retrievals that are in
@@ -786,6 +861,18 @@ namespace Model
          */
         virtual void DeleteArchiveAsync(const Model::DeleteArchiveRequest& request, const DeleteArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteArchiveCallable(const Model::DeleteArchiveRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteArchiveOutcomeCallable DeleteArchiveCallable(Model::DeleteArchiveRequest&& request) const;
+
+        /**
+         * Same as DeleteArchiveAsync(const Model::DeleteArchiveRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteArchiveAsync(Model::DeleteArchiveRequest&& request, const DeleteArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation deletes a vault. Amazon Glacier will delete a vault only if
          * there are no archives in the vault as of the last inventory and there have been
@@ -868,6 +955,18 @@ namespace Model
          */
         virtual void DeleteVaultAsync(const Model::DeleteVaultRequest& request, const DeleteVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVaultCallable(const Model::DeleteVaultRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteVaultOutcomeCallable DeleteVaultCallable(Model::DeleteVaultRequest&& request) const;
+
+        /**
+         * Same as DeleteVaultAsync(const Model::DeleteVaultRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteVaultAsync(Model::DeleteVaultRequest&& request, const DeleteVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation deletes the access policy associated with the specified vault.
          * The operation is eventually consistent; that is, it might take some time for
@@ -911,6 +1010,18 @@ namespace Model
          */
         virtual void DeleteVaultAccessPolicyAsync(const Model::DeleteVaultAccessPolicyRequest& request, const DeleteVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVaultAccessPolicyCallable(const Model::DeleteVaultAccessPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteVaultAccessPolicyOutcomeCallable DeleteVaultAccessPolicyCallable(Model::DeleteVaultAccessPolicyRequest&& request) const;
+
+        /**
+         * Same as DeleteVaultAccessPolicyAsync(const Model::DeleteVaultAccessPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteVaultAccessPolicyAsync(Model::DeleteVaultAccessPolicyRequest&& request, const DeleteVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation deletes the notification configuration set for a vault. The
          * operation is eventually consistent; that is, it might take some time for Amazon
@@ -975,6 +1086,18 @@ namespace Model
          */
         virtual void DeleteVaultNotificationsAsync(const Model::DeleteVaultNotificationsRequest& request, const DeleteVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVaultNotificationsCallable(const Model::DeleteVaultNotificationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteVaultNotificationsOutcomeCallable DeleteVaultNotificationsCallable(Model::DeleteVaultNotificationsRequest&& request) const;
+
+        /**
+         * Same as DeleteVaultNotificationsAsync(const Model::DeleteVaultNotificationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteVaultNotificationsAsync(Model::DeleteVaultNotificationsRequest&& request, const DeleteVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns information about a job you previously initiated,
          * including the job initiation date, the user who initiated the job, the job
@@ -1048,6 +1171,18 @@ namespace Model
          */
         virtual void DescribeJobAsync(const Model::DescribeJobRequest& request, const DescribeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeJobCallable(const Model::DescribeJobRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeJobOutcomeCallable DescribeJobCallable(Model::DescribeJobRequest&& request) const;
+
+        /**
+         * Same as DescribeJobAsync(const Model::DescribeJobRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeJobAsync(Model::DescribeJobRequest&& request, const DescribeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns information about a vault, including the vault's
          * Amazon Resource Name (ARN), the date the vault was created, the number of
@@ -1130,6 +1265,18 @@ namespace Model
          */
         virtual void DescribeVaultAsync(const Model::DescribeVaultRequest& request, const DescribeVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVaultCallable(const Model::DescribeVaultRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVaultOutcomeCallable DescribeVaultCallable(Model::DescribeVaultRequest&& request) const;
+
+        /**
+         * Same as DescribeVaultAsync(const Model::DescribeVaultRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVaultAsync(Model::DescribeVaultRequest&& request, const DescribeVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns the current data retrieval policy for the account and
          * region specified in the GET request. For more information about data retrieval
@@ -1161,6 +1308,18 @@ namespace Model
          */
         virtual void GetDataRetrievalPolicyAsync(const Model::GetDataRetrievalPolicyRequest& request, const GetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDataRetrievalPolicyCallable(const Model::GetDataRetrievalPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDataRetrievalPolicyOutcomeCallable GetDataRetrievalPolicyCallable(Model::GetDataRetrievalPolicyRequest&& request) const;
+
+        /**
+         * Same as GetDataRetrievalPolicyAsync(const Model::GetDataRetrievalPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDataRetrievalPolicyAsync(Model::GetDataRetrievalPolicyRequest&& request, const GetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation downloads the output of the job you initiated using
          * <a>InitiateJob</a>. Depending on the job type you specified when you initiated
@@ -1288,6 +1447,18 @@ namespace Model
          */
         virtual void GetJobOutputAsync(const Model::GetJobOutputRequest& request, const GetJobOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetJobOutputCallable(const Model::GetJobOutputRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetJobOutputOutcomeCallable GetJobOutputCallable(Model::GetJobOutputRequest&& request) const;
+
+        /**
+         * Same as GetJobOutputAsync(const Model::GetJobOutputRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetJobOutputAsync(Model::GetJobOutputRequest&& request, const GetJobOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation retrieves the <code>access-policy</code> subresource set on
          * the vault; for more information on setting this subresource, see <a
@@ -1328,6 +1499,18 @@ namespace Model
          */
         virtual void GetVaultAccessPolicyAsync(const Model::GetVaultAccessPolicyRequest& request, const GetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetVaultAccessPolicyCallable(const Model::GetVaultAccessPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetVaultAccessPolicyOutcomeCallable GetVaultAccessPolicyCallable(Model::GetVaultAccessPolicyRequest&& request) const;
+
+        /**
+         * Same as GetVaultAccessPolicyAsync(const Model::GetVaultAccessPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetVaultAccessPolicyAsync(Model::GetVaultAccessPolicyRequest&& request, const GetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation retrieves the following attributes from the
          * <code>lock-policy</code> subresource set on the specified vault: <ul> <li>
@@ -1398,6 +1581,18 @@ namespace Model
          */
         virtual void GetVaultLockAsync(const Model::GetVaultLockRequest& request, const GetVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetVaultLockCallable(const Model::GetVaultLockRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetVaultLockOutcomeCallable GetVaultLockCallable(Model::GetVaultLockRequest&& request) const;
+
+        /**
+         * Same as GetVaultLockAsync(const Model::GetVaultLockRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetVaultLockAsync(Model::GetVaultLockRequest&& request, const GetVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation retrieves the <code
          * class="code">notification-configuration</code> subresource of the specified
@@ -1474,6 +1669,18 @@ namespace Model
          */
         virtual void GetVaultNotificationsAsync(const Model::GetVaultNotificationsRequest& request, const GetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetVaultNotificationsCallable(const Model::GetVaultNotificationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetVaultNotificationsOutcomeCallable GetVaultNotificationsCallable(Model::GetVaultNotificationsRequest&& request) const;
+
+        /**
+         * Same as GetVaultNotificationsAsync(const Model::GetVaultNotificationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetVaultNotificationsAsync(Model::GetVaultNotificationsRequest&& request, const GetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation initiates a job of the specified type. In this release, you
          * can initiate a job to retrieve either an archive or a vault inventory (a list of
@@ -1775,6 +1982,18 @@ namespace Model
          */
         virtual void InitiateJobAsync(const Model::InitiateJobRequest& request, const InitiateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as InitiateJobCallable(const Model::InitiateJobRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::InitiateJobOutcomeCallable InitiateJobCallable(Model::InitiateJobRequest&& request) const;
+
+        /**
+         * Same as InitiateJobAsync(const Model::InitiateJobRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void InitiateJobAsync(Model::InitiateJobRequest&& request, const InitiateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation initiates a multipart upload. Amazon Glacier creates a
          * multipart upload resource and returns its ID in the response. The multipart
@@ -1878,6 +2097,18 @@ namespace Model
          */
         virtual void InitiateMultipartUploadAsync(const Model::InitiateMultipartUploadRequest& request, const InitiateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as InitiateMultipartUploadCallable(const Model::InitiateMultipartUploadRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::InitiateMultipartUploadOutcomeCallable InitiateMultipartUploadCallable(Model::InitiateMultipartUploadRequest&& request) const;
+
+        /**
+         * Same as InitiateMultipartUploadAsync(const Model::InitiateMultipartUploadRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void InitiateMultipartUploadAsync(Model::InitiateMultipartUploadRequest&& request, const InitiateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation initiates the vault locking process by doing the following:
          * <ul> <li> <p>Installing a vault lock policy on the specified vault.</p> </li>
@@ -1969,6 +2200,18 @@ namespace Model
          */
         virtual void InitiateVaultLockAsync(const Model::InitiateVaultLockRequest& request, const InitiateVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as InitiateVaultLockCallable(const Model::InitiateVaultLockRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::InitiateVaultLockOutcomeCallable InitiateVaultLockCallable(Model::InitiateVaultLockRequest&& request) const;
+
+        /**
+         * Same as InitiateVaultLockAsync(const Model::InitiateVaultLockRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void InitiateVaultLockAsync(Model::InitiateVaultLockRequest&& request, const InitiateVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation lists jobs for a vault, including jobs that are in-progress
          * and jobs that have recently finished. </p> <note><p>Amazon Glacier retains
@@ -2096,6 +2339,18 @@ namespace Model
          */
         virtual void ListJobsAsync(const Model::ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListJobsCallable(const Model::ListJobsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListJobsOutcomeCallable ListJobsCallable(Model::ListJobsRequest&& request) const;
+
+        /**
+         * Same as ListJobsAsync(const Model::ListJobsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListJobsAsync(Model::ListJobsRequest&& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation lists in-progress multipart uploads for the specified vault.
          * An in-progress multipart upload is a multipart upload that has been initiated by
@@ -2193,6 +2448,18 @@ namespace Model
          */
         virtual void ListMultipartUploadsAsync(const Model::ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListMultipartUploadsCallable(const Model::ListMultipartUploadsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListMultipartUploadsOutcomeCallable ListMultipartUploadsCallable(Model::ListMultipartUploadsRequest&& request) const;
+
+        /**
+         * Same as ListMultipartUploadsAsync(const Model::ListMultipartUploadsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListMultipartUploadsAsync(Model::ListMultipartUploadsRequest&& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation lists the parts of an archive that have been uploaded in a
          * specific multipart upload. You can make this request at any time during an
@@ -2281,6 +2548,18 @@ namespace Model
          */
         virtual void ListPartsAsync(const Model::ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPartsCallable(const Model::ListPartsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListPartsOutcomeCallable ListPartsCallable(Model::ListPartsRequest&& request) const;
+
+        /**
+         * Same as ListPartsAsync(const Model::ListPartsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPartsAsync(Model::ListPartsRequest&& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation lists all the tags attached to a vault. The operation returns
          * an empty map if there are no tags. For more information about tags, see <a
@@ -2309,6 +2588,18 @@ namespace Model
          */
         virtual void ListTagsForVaultAsync(const Model::ListTagsForVaultRequest& request, const ListTagsForVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForVaultCallable(const Model::ListTagsForVaultRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsForVaultOutcomeCallable ListTagsForVaultCallable(Model::ListTagsForVaultRequest&& request) const;
+
+        /**
+         * Same as ListTagsForVaultAsync(const Model::ListTagsForVaultRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsForVaultAsync(Model::ListTagsForVaultRequest&& request, const ListTagsForVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation lists all vaults owned by the calling user's account. The list
          * returned in the response is ASCII-sorted by vault name. </p> <p>By default, this
@@ -2391,6 +2682,18 @@ namespace Model
          */
         virtual void ListVaultsAsync(const Model::ListVaultsRequest& request, const ListVaultsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListVaultsCallable(const Model::ListVaultsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListVaultsOutcomeCallable ListVaultsCallable(Model::ListVaultsRequest&& request) const;
+
+        /**
+         * Same as ListVaultsAsync(const Model::ListVaultsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListVaultsAsync(Model::ListVaultsRequest&& request, const ListVaultsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation removes one or more tags from the set of tags attached to a
          * vault. For more information about tags, see <a
@@ -2422,6 +2725,18 @@ namespace Model
          */
         virtual void RemoveTagsFromVaultAsync(const Model::RemoveTagsFromVaultRequest& request, const RemoveTagsFromVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromVaultCallable(const Model::RemoveTagsFromVaultRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsFromVaultOutcomeCallable RemoveTagsFromVaultCallable(Model::RemoveTagsFromVaultRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsFromVaultAsync(const Model::RemoveTagsFromVaultRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsFromVaultAsync(Model::RemoveTagsFromVaultRequest&& request, const RemoveTagsFromVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation sets and then enacts a data retrieval policy in the region
          * specified in the PUT request. You can set one policy per region for an AWS
@@ -2462,6 +2777,18 @@ namespace Model
          */
         virtual void SetDataRetrievalPolicyAsync(const Model::SetDataRetrievalPolicyRequest& request, const SetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetDataRetrievalPolicyCallable(const Model::SetDataRetrievalPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetDataRetrievalPolicyOutcomeCallable SetDataRetrievalPolicyCallable(Model::SetDataRetrievalPolicyRequest&& request) const;
+
+        /**
+         * Same as SetDataRetrievalPolicyAsync(const Model::SetDataRetrievalPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetDataRetrievalPolicyAsync(Model::SetDataRetrievalPolicyRequest&& request, const SetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation configures an access policy for a vault and will overwrite an
          * existing policy. To configure a vault access policy, send a PUT request to the
@@ -2502,6 +2829,18 @@ namespace Model
          */
         virtual void SetVaultAccessPolicyAsync(const Model::SetVaultAccessPolicyRequest& request, const SetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetVaultAccessPolicyCallable(const Model::SetVaultAccessPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetVaultAccessPolicyOutcomeCallable SetVaultAccessPolicyCallable(Model::SetVaultAccessPolicyRequest&& request) const;
+
+        /**
+         * Same as SetVaultAccessPolicyAsync(const Model::SetVaultAccessPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetVaultAccessPolicyAsync(Model::SetVaultAccessPolicyRequest&& request, const SetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation configures notifications that will be sent when specific
          * events happen to a vault. By default, you don't get any notifications. </p>
@@ -2605,6 +2944,18 @@ namespace Model
          */
         virtual void SetVaultNotificationsAsync(const Model::SetVaultNotificationsRequest& request, const SetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetVaultNotificationsCallable(const Model::SetVaultNotificationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetVaultNotificationsOutcomeCallable SetVaultNotificationsCallable(Model::SetVaultNotificationsRequest&& request) const;
+
+        /**
+         * Same as SetVaultNotificationsAsync(const Model::SetVaultNotificationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetVaultNotificationsAsync(Model::SetVaultNotificationsRequest&& request, const SetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation adds an archive to a vault. This is a synchronous operation,
          * and for a successful upload, your data is durably persisted. Amazon Glacier
@@ -2717,6 +3068,18 @@ namespace Model
          */
         virtual void UploadArchiveAsync(const Model::UploadArchiveRequest& request, const UploadArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadArchiveCallable(const Model::UploadArchiveRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UploadArchiveOutcomeCallable UploadArchiveCallable(Model::UploadArchiveRequest&& request) const;
+
+        /**
+         * Same as UploadArchiveAsync(const Model::UploadArchiveRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UploadArchiveAsync(Model::UploadArchiveRequest&& request, const UploadArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation uploads a part of an archive. You can upload archive parts in
          * any order. You can also upload them in parallel. You can upload up to 10,000
@@ -2841,6 +3204,195 @@ namespace Model
          */
         virtual void UploadMultipartPartAsync(const Model::UploadMultipartPartRequest& request, const UploadMultipartPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadMultipartPartCallable(const Model::UploadMultipartPartRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UploadMultipartPartOutcomeCallable UploadMultipartPartCallable(Model::UploadMultipartPartRequest&& request) const;
+
+        /**
+         * Same as UploadMultipartPartAsync(const Model::UploadMultipartPartRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UploadMultipartPartAsync(Model::UploadMultipartPartRequest&& request, const UploadMultipartPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListJobs(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GlacierClient, Model::ListJobsRequest, Model::ListJobsOutcome> ListJobsPaginator(const Model::ListJobsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListMultipartUploads(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GlacierClient, Model::ListMultipartUploadsRequest, Model::ListMultipartUploadsOutcome> ListMultipartUploadsPaginator(const Model::ListMultipartUploadsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListParts(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GlacierClient, Model::ListPartsRequest, Model::ListPartsOutcome> ListPartsPaginator(const Model::ListPartsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListVaults(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<GlacierClient, Model::ListVaultsRequest, Model::ListVaultsOutcome> ListVaultsPaginator(const Model::ListVaultsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AbortMultipartUpload(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::AbortMultipartUploadRequest, Model::AbortMultipartUploadOutcome> AbortMultipartUploadAwaitable(Model::AbortMultipartUploadRequest request) const;
+
+        /**
+         * co_await-able form of AbortVaultLock(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::AbortVaultLockRequest, Model::AbortVaultLockOutcome> AbortVaultLockAwaitable(Model::AbortVaultLockRequest request) const;
+
+        /**
+         * co_await-able form of AddTagsToVault(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::AddTagsToVaultRequest, Model::AddTagsToVaultOutcome> AddTagsToVaultAwaitable(Model::AddTagsToVaultRequest request) const;
+
+        /**
+         * co_await-able form of CompleteMultipartUpload(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::CompleteMultipartUploadRequest, Model::CompleteMultipartUploadOutcome> CompleteMultipartUploadAwaitable(Model::CompleteMultipartUploadRequest request) const;
+
+        /**
+         * co_await-able form of CompleteVaultLock(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::CompleteVaultLockRequest, Model::CompleteVaultLockOutcome> CompleteVaultLockAwaitable(Model::CompleteVaultLockRequest request) const;
+
+        /**
+         * co_await-able form of CreateVault(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::CreateVaultRequest, Model::CreateVaultOutcome> CreateVaultAwaitable(Model::CreateVaultRequest request) const;
+
+        /**
+         * co_await-able form of DeleteArchive(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::DeleteArchiveRequest, Model::DeleteArchiveOutcome> DeleteArchiveAwaitable(Model::DeleteArchiveRequest request) const;
+
+        /**
+         * co_await-able form of DeleteVault(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::DeleteVaultRequest, Model::DeleteVaultOutcome> DeleteVaultAwaitable(Model::DeleteVaultRequest request) const;
+
+        /**
+         * co_await-able form of DeleteVaultAccessPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::DeleteVaultAccessPolicyRequest, Model::DeleteVaultAccessPolicyOutcome> DeleteVaultAccessPolicyAwaitable(Model::DeleteVaultAccessPolicyRequest request) const;
+
+        /**
+         * co_await-able form of DeleteVaultNotifications(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::DeleteVaultNotificationsRequest, Model::DeleteVaultNotificationsOutcome> DeleteVaultNotificationsAwaitable(Model::DeleteVaultNotificationsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeJob(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::DescribeJobRequest, Model::DescribeJobOutcome> DescribeJobAwaitable(Model::DescribeJobRequest request) const;
+
+        /**
+         * co_await-able form of DescribeVault(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::DescribeVaultRequest, Model::DescribeVaultOutcome> DescribeVaultAwaitable(Model::DescribeVaultRequest request) const;
+
+        /**
+         * co_await-able form of GetDataRetrievalPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::GetDataRetrievalPolicyRequest, Model::GetDataRetrievalPolicyOutcome> GetDataRetrievalPolicyAwaitable(Model::GetDataRetrievalPolicyRequest request) const;
+
+        /**
+         * co_await-able form of GetJobOutput(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::GetJobOutputRequest, Model::GetJobOutputOutcome> GetJobOutputAwaitable(Model::GetJobOutputRequest request) const;
+
+        /**
+         * co_await-able form of GetVaultAccessPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::GetVaultAccessPolicyRequest, Model::GetVaultAccessPolicyOutcome> GetVaultAccessPolicyAwaitable(Model::GetVaultAccessPolicyRequest request) const;
+
+        /**
+         * co_await-able form of GetVaultLock(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::GetVaultLockRequest, Model::GetVaultLockOutcome> GetVaultLockAwaitable(Model::GetVaultLockRequest request) const;
+
+        /**
+         * co_await-able form of GetVaultNotifications(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::GetVaultNotificationsRequest, Model::GetVaultNotificationsOutcome> GetVaultNotificationsAwaitable(Model::GetVaultNotificationsRequest request) const;
+
+        /**
+         * co_await-able form of InitiateJob(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::InitiateJobRequest, Model::InitiateJobOutcome> InitiateJobAwaitable(Model::InitiateJobRequest request) const;
+
+        /**
+         * co_await-able form of InitiateMultipartUpload(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::InitiateMultipartUploadRequest, Model::InitiateMultipartUploadOutcome> InitiateMultipartUploadAwaitable(Model::InitiateMultipartUploadRequest request) const;
+
+        /**
+         * co_await-able form of InitiateVaultLock(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::InitiateVaultLockRequest, Model::InitiateVaultLockOutcome> InitiateVaultLockAwaitable(Model::InitiateVaultLockRequest request) const;
+
+        /**
+         * co_await-able form of ListJobs(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::ListJobsRequest, Model::ListJobsOutcome> ListJobsAwaitable(Model::ListJobsRequest request) const;
+
+        /**
+         * co_await-able form of ListMultipartUploads(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::ListMultipartUploadsRequest, Model::ListMultipartUploadsOutcome> ListMultipartUploadsAwaitable(Model::ListMultipartUploadsRequest request) const;
+
+        /**
+         * co_await-able form of ListParts(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::ListPartsRequest, Model::ListPartsOutcome> ListPartsAwaitable(Model::ListPartsRequest request) const;
+
+        /**
+         * co_await-able form of ListTagsForVault(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::ListTagsForVaultRequest, Model::ListTagsForVaultOutcome> ListTagsForVaultAwaitable(Model::ListTagsForVaultRequest request) const;
+
+        /**
+         * co_await-able form of ListVaults(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::ListVaultsRequest, Model::ListVaultsOutcome> ListVaultsAwaitable(Model::ListVaultsRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTagsFromVault(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::RemoveTagsFromVaultRequest, Model::RemoveTagsFromVaultOutcome> RemoveTagsFromVaultAwaitable(Model::RemoveTagsFromVaultRequest request) const;
+
+        /**
+         * co_await-able form of SetDataRetrievalPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::SetDataRetrievalPolicyRequest, Model::SetDataRetrievalPolicyOutcome> SetDataRetrievalPolicyAwaitable(Model::SetDataRetrievalPolicyRequest request) const;
+
+        /**
+         * co_await-able form of SetVaultAccessPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::SetVaultAccessPolicyRequest, Model::SetVaultAccessPolicyOutcome> SetVaultAccessPolicyAwaitable(Model::SetVaultAccessPolicyRequest request) const;
+
+        /**
+         * co_await-able form of SetVaultNotifications(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::SetVaultNotificationsRequest, Model::SetVaultNotificationsOutcome> SetVaultNotificationsAwaitable(Model::SetVaultNotificationsRequest request) const;
+
+        /**
+         * co_await-able form of UploadArchive(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::UploadArchiveRequest, Model::UploadArchiveOutcome> UploadArchiveAwaitable(Model::UploadArchiveRequest request) const;
+
+        /**
+         * co_await-able form of UploadMultipartPart(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<GlacierClient, Model::UploadMultipartPartRequest, Model::UploadMultipartPartOutcome> UploadMultipartPartAwaitable(Model::UploadMultipartPartRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
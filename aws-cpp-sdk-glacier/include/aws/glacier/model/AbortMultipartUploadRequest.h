@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     AbortMultipartUploadRequest();
+    inline const char* GetServiceRequestName() const override { return "AbortMultipartUpload"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AbortVaultLockRequest();
+    inline const char* GetServiceRequestName() const override { return "AbortVaultLock"; }
+
     Aws::String SerializePayload() const override;
 
     /**
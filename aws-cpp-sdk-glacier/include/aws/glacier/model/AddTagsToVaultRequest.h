@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AddTagsToVaultRequest();
+    inline const char* GetServiceRequestName() const override { return "AddTagsToVault"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     CompleteMultipartUploadRequest();
+    inline const char* GetServiceRequestName() const override { return "CompleteMultipartUpload"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CompleteVaultLockRequest();
+    inline const char* GetServiceRequestName() const override { return "CompleteVaultLock"; }
+
     Aws::String SerializePayload() const override;
 
     /**
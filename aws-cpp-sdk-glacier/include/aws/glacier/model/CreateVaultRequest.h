@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateVaultRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateVault"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteArchiveRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteArchive"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteVaultAccessPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteVaultAccessPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
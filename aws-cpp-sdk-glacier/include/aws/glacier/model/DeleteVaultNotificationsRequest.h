@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteVaultNotificationsRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteVaultNotifications"; }
+
     Aws::String SerializePayload() const override;
 
     /**
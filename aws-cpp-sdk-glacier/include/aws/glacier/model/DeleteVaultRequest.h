@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteVaultRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteVault"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeJobRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeJob"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeVaultRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVault"; }
+
     Aws::String SerializePayload() const override;
 
     /**
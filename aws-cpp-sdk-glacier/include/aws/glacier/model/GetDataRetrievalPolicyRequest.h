@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetDataRetrievalPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDataRetrievalPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetJobOutputRequest();
+    inline const char* GetServiceRequestName() const override { return "GetJobOutput"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetVaultAccessPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetVaultAccessPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
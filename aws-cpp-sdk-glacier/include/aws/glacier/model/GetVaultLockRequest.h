@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetVaultLockRequest();
+    inline const char* GetServiceRequestName() const override { return "GetVaultLock"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetVaultNotificationsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetVaultNotifications"; }
+
     Aws::String SerializePayload() const override;
 
     /**
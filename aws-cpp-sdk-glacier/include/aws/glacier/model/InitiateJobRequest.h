@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     InitiateJobRequest();
+    inline const char* GetServiceRequestName() const override { return "InitiateJob"; }
+
     Aws::String SerializePayload() const override;
 
     /**
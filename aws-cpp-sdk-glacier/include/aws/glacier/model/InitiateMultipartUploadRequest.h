@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     InitiateMultipartUploadRequest();
+    inline const char* GetServiceRequestName() const override { return "InitiateMultipartUpload"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     InitiateVaultLockRequest();
+    inline const char* GetServiceRequestName() const override { return "InitiateVaultLock"; }
+
     Aws::String SerializePayload() const override;
 
     /**
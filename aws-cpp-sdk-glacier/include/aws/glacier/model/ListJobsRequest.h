@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListJobsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListJobs"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListTagsForVaultRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTagsForVault"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     ListVaultsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListVaults"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RemoveTagsFromVaultRequest();
+    inline const char* GetServiceRequestName() const override { return "RemoveTagsFromVault"; }
+
     Aws::String SerializePayload() const override;
 
     /**
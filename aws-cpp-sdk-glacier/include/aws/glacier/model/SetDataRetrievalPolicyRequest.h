@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetDataRetrievalPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "SetDataRetrievalPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetVaultAccessPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "SetVaultAccessPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
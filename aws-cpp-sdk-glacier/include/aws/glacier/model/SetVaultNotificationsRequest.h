@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     SetVaultNotificationsRequest();
+    inline const char* GetServiceRequestName() const override { return "SetVaultNotifications"; }
+
     Aws::String SerializePayload() const override;
 
     /**
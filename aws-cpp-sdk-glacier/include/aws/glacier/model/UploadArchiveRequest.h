@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UploadArchiveRequest();
+    inline const char* GetServiceRequestName() const override { return "UploadArchive"; }
+
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
 
     /**
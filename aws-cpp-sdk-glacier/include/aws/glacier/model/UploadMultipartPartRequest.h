@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UploadMultipartPartRequest();
+    inline const char* GetServiceRequestName() const override { return "UploadMultipartPart"; }
+
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
 
     /**
@@ -145,7 +145,7 @@ AbortMultipartUploadOutcome GlacierClient::AbortMultipartUpload(const AbortMulti
 
 AbortMultipartUploadOutcomeCallable GlacierClient::AbortMultipartUploadCallable(const AbortMultipartUploadRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AbortMultipartUpload(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AbortMultipartUpload(request); } );
 }
 
 void GlacierClient::AbortMultipartUploadAsync(const AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -153,6 +153,16 @@ void GlacierClient::AbortMultipartUploadAsync(const AbortMultipartUploadRequest&
   m_executor->Submit( [this, request, handler, context](){ this->AbortMultipartUploadAsyncHelper( request, handler, context ); } );
 }
 
+AbortMultipartUploadOutcomeCallable GlacierClient::AbortMultipartUploadCallable(AbortMultipartUploadRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::AbortMultipartUpload, this, std::move(request)));
+}
+
+void GlacierClient::AbortMultipartUploadAsync(AbortMultipartUploadRequest&& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::AbortMultipartUploadAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::AbortMultipartUploadAsyncHelper(const AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AbortMultipartUpload(request), context);
@@ -180,7 +190,7 @@ AbortVaultLockOutcome GlacierClient::AbortVaultLock(const AbortVaultLockRequest&
 
 AbortVaultLockOutcomeCallable GlacierClient::AbortVaultLockCallable(const AbortVaultLockRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AbortVaultLock(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AbortVaultLock(request); } );
 }
 
 void GlacierClient::AbortVaultLockAsync(const AbortVaultLockRequest& request, const AbortVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -188,6 +198,16 @@ void GlacierClient::AbortVaultLockAsync(const AbortVaultLockRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->AbortVaultLockAsyncHelper( request, handler, context ); } );
 }
 
+AbortVaultLockOutcomeCallable GlacierClient::AbortVaultLockCallable(AbortVaultLockRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::AbortVaultLock, this, std::move(request)));
+}
+
+void GlacierClient::AbortVaultLockAsync(AbortVaultLockRequest&& request, const AbortVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::AbortVaultLockAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::AbortVaultLockAsyncHelper(const AbortVaultLockRequest& request, const AbortVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AbortVaultLock(request), context);
@@ -215,7 +235,7 @@ AddTagsToVaultOutcome GlacierClient::AddTagsToVault(const AddTagsToVaultRequest&
 
 AddTagsToVaultOutcomeCallable GlacierClient::AddTagsToVaultCallable(const AddTagsToVaultRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTagsToVault(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTagsToVault(request); } );
 }
 
 void GlacierClient::AddTagsToVaultAsync(const AddTagsToVaultRequest& request, const AddTagsToVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -223,6 +243,16 @@ void GlacierClient::AddTagsToVaultAsync(const AddTagsToVaultRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsToVaultAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsToVaultOutcomeCallable GlacierClient::AddTagsToVaultCallable(AddTagsToVaultRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::AddTagsToVault, this, std::move(request)));
+}
+
+void GlacierClient::AddTagsToVaultAsync(AddTagsToVaultRequest&& request, const AddTagsToVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::AddTagsToVaultAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::AddTagsToVaultAsyncHelper(const AddTagsToVaultRequest& request, const AddTagsToVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTagsToVault(request), context);
@@ -251,7 +281,7 @@ CompleteMultipartUploadOutcome GlacierClient::CompleteMultipartUpload(const Comp
 
 CompleteMultipartUploadOutcomeCallable GlacierClient::CompleteMultipartUploadCallable(const CompleteMultipartUploadRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CompleteMultipartUpload(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CompleteMultipartUpload(request); } );
 }
 
 void GlacierClient::CompleteMultipartUploadAsync(const CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -259,6 +289,16 @@ void GlacierClient::CompleteMultipartUploadAsync(const CompleteMultipartUploadRe
   m_executor->Submit( [this, request, handler, context](){ this->CompleteMultipartUploadAsyncHelper( request, handler, context ); } );
 }
 
+CompleteMultipartUploadOutcomeCallable GlacierClient::CompleteMultipartUploadCallable(CompleteMultipartUploadRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::CompleteMultipartUpload, this, std::move(request)));
+}
+
+void GlacierClient::CompleteMultipartUploadAsync(CompleteMultipartUploadRequest&& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::CompleteMultipartUploadAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::CompleteMultipartUploadAsyncHelper(const CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CompleteMultipartUpload(request), context);
@@ -287,7 +327,7 @@ CompleteVaultLockOutcome GlacierClient::CompleteVaultLock(const CompleteVaultLoc
 
 CompleteVaultLockOutcomeCallable GlacierClient::CompleteVaultLockCallable(const CompleteVaultLockRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CompleteVaultLock(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CompleteVaultLock(request); } );
 }
 
 void GlacierClient::CompleteVaultLockAsync(const CompleteVaultLockRequest& request, const CompleteVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -295,6 +335,16 @@ void GlacierClient::CompleteVaultLockAsync(const CompleteVaultLockRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->CompleteVaultLockAsyncHelper( request, handler, context ); } );
 }
 
+CompleteVaultLockOutcomeCallable GlacierClient::CompleteVaultLockCallable(CompleteVaultLockRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::CompleteVaultLock, this, std::move(request)));
+}
+
+void GlacierClient::CompleteVaultLockAsync(CompleteVaultLockRequest&& request, const CompleteVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::CompleteVaultLockAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::CompleteVaultLockAsyncHelper(const CompleteVaultLockRequest& request, const CompleteVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CompleteVaultLock(request), context);
@@ -321,7 +371,7 @@ CreateVaultOutcome GlacierClient::CreateVault(const CreateVaultRequest& request)
 
 CreateVaultOutcomeCallable GlacierClient::CreateVaultCallable(const CreateVaultRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateVault(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateVault(request); } );
 }
 
 void GlacierClient::CreateVaultAsync(const CreateVaultRequest& request, const CreateVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -329,6 +379,16 @@ void GlacierClient::CreateVaultAsync(const CreateVaultRequest& request, const Cr
   m_executor->Submit( [this, request, handler, context](){ this->CreateVaultAsyncHelper( request, handler, context ); } );
 }
 
+CreateVaultOutcomeCallable GlacierClient::CreateVaultCallable(CreateVaultRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::CreateVault, this, std::move(request)));
+}
+
+void GlacierClient::CreateVaultAsync(CreateVaultRequest&& request, const CreateVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::CreateVaultAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::CreateVaultAsyncHelper(const CreateVaultRequest& request, const CreateVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateVault(request), context);
@@ -357,7 +417,7 @@ DeleteArchiveOutcome GlacierClient::DeleteArchive(const DeleteArchiveRequest& re
 
 DeleteArchiveOutcomeCallable GlacierClient::DeleteArchiveCallable(const DeleteArchiveRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteArchive(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteArchive(request); } );
 }
 
 void GlacierClient::DeleteArchiveAsync(const DeleteArchiveRequest& request, const DeleteArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -365,6 +425,16 @@ void GlacierClient::DeleteArchiveAsync(const DeleteArchiveRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->DeleteArchiveAsyncHelper( request, handler, context ); } );
 }
 
+DeleteArchiveOutcomeCallable GlacierClient::DeleteArchiveCallable(DeleteArchiveRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::DeleteArchive, this, std::move(request)));
+}
+
+void GlacierClient::DeleteArchiveAsync(DeleteArchiveRequest&& request, const DeleteArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::DeleteArchiveAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::DeleteArchiveAsyncHelper(const DeleteArchiveRequest& request, const DeleteArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteArchive(request), context);
@@ -391,7 +461,7 @@ DeleteVaultOutcome GlacierClient::DeleteVault(const DeleteVaultRequest& request)
 
 DeleteVaultOutcomeCallable GlacierClient::DeleteVaultCallable(const DeleteVaultRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteVault(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteVault(request); } );
 }
 
 void GlacierClient::DeleteVaultAsync(const DeleteVaultRequest& request, const DeleteVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -399,6 +469,16 @@ void GlacierClient::DeleteVaultAsync(const DeleteVaultRequest& request, const De
   m_executor->Submit( [this, request, handler, context](){ this->DeleteVaultAsyncHelper( request, handler, context ); } );
 }
 
+DeleteVaultOutcomeCallable GlacierClient::DeleteVaultCallable(DeleteVaultRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::DeleteVault, this, std::move(request)));
+}
+
+void GlacierClient::DeleteVaultAsync(DeleteVaultRequest&& request, const DeleteVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::DeleteVaultAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::DeleteVaultAsyncHelper(const DeleteVaultRequest& request, const DeleteVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteVault(request), context);
@@ -426,7 +506,7 @@ DeleteVaultAccessPolicyOutcome GlacierClient::DeleteVaultAccessPolicy(const Dele
 
 DeleteVaultAccessPolicyOutcomeCallable GlacierClient::DeleteVaultAccessPolicyCallable(const DeleteVaultAccessPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteVaultAccessPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteVaultAccessPolicy(request); } );
 }
 
 void GlacierClient::DeleteVaultAccessPolicyAsync(const DeleteVaultAccessPolicyRequest& request, const DeleteVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -434,6 +514,16 @@ void GlacierClient::DeleteVaultAccessPolicyAsync(const DeleteVaultAccessPolicyRe
   m_executor->Submit( [this, request, handler, context](){ this->DeleteVaultAccessPolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteVaultAccessPolicyOutcomeCallable GlacierClient::DeleteVaultAccessPolicyCallable(DeleteVaultAccessPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::DeleteVaultAccessPolicy, this, std::move(request)));
+}
+
+void GlacierClient::DeleteVaultAccessPolicyAsync(DeleteVaultAccessPolicyRequest&& request, const DeleteVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::DeleteVaultAccessPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::DeleteVaultAccessPolicyAsyncHelper(const DeleteVaultAccessPolicyRequest& request, const DeleteVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteVaultAccessPolicy(request), context);
@@ -461,7 +551,7 @@ DeleteVaultNotificationsOutcome GlacierClient::DeleteVaultNotifications(const De
 
 DeleteVaultNotificationsOutcomeCallable GlacierClient::DeleteVaultNotificationsCallable(const DeleteVaultNotificationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteVaultNotifications(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteVaultNotifications(request); } );
 }
 
 void GlacierClient::DeleteVaultNotificationsAsync(const DeleteVaultNotificationsRequest& request, const DeleteVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -469,6 +559,16 @@ void GlacierClient::DeleteVaultNotificationsAsync(const DeleteVaultNotifications
   m_executor->Submit( [this, request, handler, context](){ this->DeleteVaultNotificationsAsyncHelper( request, handler, context ); } );
 }
 
+DeleteVaultNotificationsOutcomeCallable GlacierClient::DeleteVaultNotificationsCallable(DeleteVaultNotificationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::DeleteVaultNotifications, this, std::move(request)));
+}
+
+void GlacierClient::DeleteVaultNotificationsAsync(DeleteVaultNotificationsRequest&& request, const DeleteVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::DeleteVaultNotificationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::DeleteVaultNotificationsAsyncHelper(const DeleteVaultNotificationsRequest& request, const DeleteVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteVaultNotifications(request), context);
@@ -497,7 +597,7 @@ DescribeJobOutcome GlacierClient::DescribeJob(const DescribeJobRequest& request)
 
 DescribeJobOutcomeCallable GlacierClient::DescribeJobCallable(const DescribeJobRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeJob(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeJob(request); } );
 }
 
 void GlacierClient::DescribeJobAsync(const DescribeJobRequest& request, const DescribeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -505,6 +605,16 @@ void GlacierClient::DescribeJobAsync(const DescribeJobRequest& request, const De
   m_executor->Submit( [this, request, handler, context](){ this->DescribeJobAsyncHelper( request, handler, context ); } );
 }
 
+DescribeJobOutcomeCallable GlacierClient::DescribeJobCallable(DescribeJobRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::DescribeJob, this, std::move(request)));
+}
+
+void GlacierClient::DescribeJobAsync(DescribeJobRequest&& request, const DescribeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::DescribeJobAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::DescribeJobAsyncHelper(const DescribeJobRequest& request, const DescribeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeJob(request), context);
@@ -531,7 +641,7 @@ DescribeVaultOutcome GlacierClient::DescribeVault(const DescribeVaultRequest& re
 
 DescribeVaultOutcomeCallable GlacierClient::DescribeVaultCallable(const DescribeVaultRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVault(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVault(request); } );
 }
 
 void GlacierClient::DescribeVaultAsync(const DescribeVaultRequest& request, const DescribeVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -539,6 +649,16 @@ void GlacierClient::DescribeVaultAsync(const DescribeVaultRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVaultAsyncHelper( request, handler, context ); } );
 }
 
+DescribeVaultOutcomeCallable GlacierClient::DescribeVaultCallable(DescribeVaultRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::DescribeVault, this, std::move(request)));
+}
+
+void GlacierClient::DescribeVaultAsync(DescribeVaultRequest&& request, const DescribeVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::DescribeVaultAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::DescribeVaultAsyncHelper(const DescribeVaultRequest& request, const DescribeVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeVault(request), context);
@@ -564,7 +684,7 @@ GetDataRetrievalPolicyOutcome GlacierClient::GetDataRetrievalPolicy(const GetDat
 
 GetDataRetrievalPolicyOutcomeCallable GlacierClient::GetDataRetrievalPolicyCallable(const GetDataRetrievalPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDataRetrievalPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDataRetrievalPolicy(request); } );
 }
 
 void GlacierClient::GetDataRetrievalPolicyAsync(const GetDataRetrievalPolicyRequest& request, const GetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -572,6 +692,16 @@ void GlacierClient::GetDataRetrievalPolicyAsync(const GetDataRetrievalPolicyRequ
   m_executor->Submit( [this, request, handler, context](){ this->GetDataRetrievalPolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetDataRetrievalPolicyOutcomeCallable GlacierClient::GetDataRetrievalPolicyCallable(GetDataRetrievalPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::GetDataRetrievalPolicy, this, std::move(request)));
+}
+
+void GlacierClient::GetDataRetrievalPolicyAsync(GetDataRetrievalPolicyRequest&& request, const GetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::GetDataRetrievalPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::GetDataRetrievalPolicyAsyncHelper(const GetDataRetrievalPolicyRequest& request, const GetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDataRetrievalPolicy(request), context);
@@ -601,7 +731,7 @@ GetJobOutputOutcome GlacierClient::GetJobOutput(const GetJobOutputRequest& reque
 
 GetJobOutputOutcomeCallable GlacierClient::GetJobOutputCallable(const GetJobOutputRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetJobOutput(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetJobOutput(request); } );
 }
 
 void GlacierClient::GetJobOutputAsync(const GetJobOutputRequest& request, const GetJobOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -609,6 +739,16 @@ void GlacierClient::GetJobOutputAsync(const GetJobOutputRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->GetJobOutputAsyncHelper( request, handler, context ); } );
 }
 
+GetJobOutputOutcomeCallable GlacierClient::GetJobOutputCallable(GetJobOutputRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::GetJobOutput, this, std::move(request)));
+}
+
+void GlacierClient::GetJobOutputAsync(GetJobOutputRequest&& request, const GetJobOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::GetJobOutputAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::GetJobOutputAsyncHelper(const GetJobOutputRequest& request, const GetJobOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetJobOutput(request), context);
@@ -636,7 +776,7 @@ GetVaultAccessPolicyOutcome GlacierClient::GetVaultAccessPolicy(const GetVaultAc
 
 GetVaultAccessPolicyOutcomeCallable GlacierClient::GetVaultAccessPolicyCallable(const GetVaultAccessPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetVaultAccessPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetVaultAccessPolicy(request); } );
 }
 
 void GlacierClient::GetVaultAccessPolicyAsync(const GetVaultAccessPolicyRequest& request, const GetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -644,6 +784,16 @@ void GlacierClient::GetVaultAccessPolicyAsync(const GetVaultAccessPolicyRequest&
   m_executor->Submit( [this, request, handler, context](){ this->GetVaultAccessPolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetVaultAccessPolicyOutcomeCallable GlacierClient::GetVaultAccessPolicyCallable(GetVaultAccessPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::GetVaultAccessPolicy, this, std::move(request)));
+}
+
+void GlacierClient::GetVaultAccessPolicyAsync(GetVaultAccessPolicyRequest&& request, const GetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::GetVaultAccessPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::GetVaultAccessPolicyAsyncHelper(const GetVaultAccessPolicyRequest& request, const GetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetVaultAccessPolicy(request), context);
@@ -671,7 +821,7 @@ GetVaultLockOutcome GlacierClient::GetVaultLock(const GetVaultLockRequest& reque
 
 GetVaultLockOutcomeCallable GlacierClient::GetVaultLockCallable(const GetVaultLockRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetVaultLock(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetVaultLock(request); } );
 }
 
 void GlacierClient::GetVaultLockAsync(const GetVaultLockRequest& request, const GetVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -679,6 +829,16 @@ void GlacierClient::GetVaultLockAsync(const GetVaultLockRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->GetVaultLockAsyncHelper( request, handler, context ); } );
 }
 
+GetVaultLockOutcomeCallable GlacierClient::GetVaultLockCallable(GetVaultLockRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::GetVaultLock, this, std::move(request)));
+}
+
+void GlacierClient::GetVaultLockAsync(GetVaultLockRequest&& request, const GetVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::GetVaultLockAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::GetVaultLockAsyncHelper(const GetVaultLockRequest& request, const GetVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetVaultLock(request), context);
@@ -706,7 +866,7 @@ GetVaultNotificationsOutcome GlacierClient::GetVaultNotifications(const GetVault
 
 GetVaultNotificationsOutcomeCallable GlacierClient::GetVaultNotificationsCallable(const GetVaultNotificationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetVaultNotifications(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetVaultNotifications(request); } );
 }
 
 void GlacierClient::GetVaultNotificationsAsync(const GetVaultNotificationsRequest& request, const GetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -714,6 +874,16 @@ void GlacierClient::GetVaultNotificationsAsync(const GetVaultNotificationsReques
   m_executor->Submit( [this, request, handler, context](){ this->GetVaultNotificationsAsyncHelper( request, handler, context ); } );
 }
 
+GetVaultNotificationsOutcomeCallable GlacierClient::GetVaultNotificationsCallable(GetVaultNotificationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::GetVaultNotifications, this, std::move(request)));
+}
+
+void GlacierClient::GetVaultNotificationsAsync(GetVaultNotificationsRequest&& request, const GetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::GetVaultNotificationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::GetVaultNotificationsAsyncHelper(const GetVaultNotificationsRequest& request, const GetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetVaultNotifications(request), context);
@@ -741,7 +911,7 @@ InitiateJobOutcome GlacierClient::InitiateJob(const InitiateJobRequest& request)
 
 InitiateJobOutcomeCallable GlacierClient::InitiateJobCallable(const InitiateJobRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->InitiateJob(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->InitiateJob(request); } );
 }
 
 void GlacierClient::InitiateJobAsync(const InitiateJobRequest& request, const InitiateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -749,6 +919,16 @@ void GlacierClient::InitiateJobAsync(const InitiateJobRequest& request, const In
   m_executor->Submit( [this, request, handler, context](){ this->InitiateJobAsyncHelper( request, handler, context ); } );
 }
 
+InitiateJobOutcomeCallable GlacierClient::InitiateJobCallable(InitiateJobRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::InitiateJob, this, std::move(request)));
+}
+
+void GlacierClient::InitiateJobAsync(InitiateJobRequest&& request, const InitiateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::InitiateJobAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::InitiateJobAsyncHelper(const InitiateJobRequest& request, const InitiateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, InitiateJob(request), context);
@@ -776,7 +956,7 @@ InitiateMultipartUploadOutcome GlacierClient::InitiateMultipartUpload(const Init
 
 InitiateMultipartUploadOutcomeCallable GlacierClient::InitiateMultipartUploadCallable(const InitiateMultipartUploadRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->InitiateMultipartUpload(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->InitiateMultipartUpload(request); } );
 }
 
 void GlacierClient::InitiateMultipartUploadAsync(const InitiateMultipartUploadRequest& request, const InitiateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -784,6 +964,16 @@ void GlacierClient::InitiateMultipartUploadAsync(const InitiateMultipartUploadRe
   m_executor->Submit( [this, request, handler, context](){ this->InitiateMultipartUploadAsyncHelper( request, handler, context ); } );
 }
 
+InitiateMultipartUploadOutcomeCallable GlacierClient::InitiateMultipartUploadCallable(InitiateMultipartUploadRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::InitiateMultipartUpload, this, std::move(request)));
+}
+
+void GlacierClient::InitiateMultipartUploadAsync(InitiateMultipartUploadRequest&& request, const InitiateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::InitiateMultipartUploadAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::InitiateMultipartUploadAsyncHelper(const InitiateMultipartUploadRequest& request, const InitiateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, InitiateMultipartUpload(request), context);
@@ -811,7 +1001,7 @@ InitiateVaultLockOutcome GlacierClient::InitiateVaultLock(const InitiateVaultLoc
 
 InitiateVaultLockOutcomeCallable GlacierClient::InitiateVaultLockCallable(const InitiateVaultLockRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->InitiateVaultLock(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->InitiateVaultLock(request); } );
 }
 
 void GlacierClient::InitiateVaultLockAsync(const InitiateVaultLockRequest& request, const InitiateVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -819,6 +1009,16 @@ void GlacierClient::InitiateVaultLockAsync(const InitiateVaultLockRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->InitiateVaultLockAsyncHelper( request, handler, context ); } );
 }
 
+InitiateVaultLockOutcomeCallable GlacierClient::InitiateVaultLockCallable(InitiateVaultLockRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::InitiateVaultLock, this, std::move(request)));
+}
+
+void GlacierClient::InitiateVaultLockAsync(InitiateVaultLockRequest&& request, const InitiateVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::InitiateVaultLockAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::InitiateVaultLockAsyncHelper(const InitiateVaultLockRequest& request, const InitiateVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, InitiateVaultLock(request), context);
@@ -846,7 +1046,7 @@ ListJobsOutcome GlacierClient::ListJobs(const ListJobsRequest& request) const
 
 ListJobsOutcomeCallable GlacierClient::ListJobsCallable(const ListJobsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListJobs(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListJobs(request); } );
 }
 
 void GlacierClient::ListJobsAsync(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -854,6 +1054,16 @@ void GlacierClient::ListJobsAsync(const ListJobsRequest& request, const ListJobs
   m_executor->Submit( [this, request, handler, context](){ this->ListJobsAsyncHelper( request, handler, context ); } );
 }
 
+ListJobsOutcomeCallable GlacierClient::ListJobsCallable(ListJobsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::ListJobs, this, std::move(request)));
+}
+
+void GlacierClient::ListJobsAsync(ListJobsRequest&& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::ListJobsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::ListJobsAsyncHelper(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListJobs(request), context);
@@ -881,7 +1091,7 @@ ListMultipartUploadsOutcome GlacierClient::ListMultipartUploads(const ListMultip
 
 ListMultipartUploadsOutcomeCallable GlacierClient::ListMultipartUploadsCallable(const ListMultipartUploadsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListMultipartUploads(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListMultipartUploads(request); } );
 }
 
 void GlacierClient::ListMultipartUploadsAsync(const ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -889,6 +1099,16 @@ void GlacierClient::ListMultipartUploadsAsync(const ListMultipartUploadsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ListMultipartUploadsAsyncHelper( request, handler, context ); } );
 }
 
+ListMultipartUploadsOutcomeCallable GlacierClient::ListMultipartUploadsCallable(ListMultipartUploadsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::ListMultipartUploads, this, std::move(request)));
+}
+
+void GlacierClient::ListMultipartUploadsAsync(ListMultipartUploadsRequest&& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::ListMultipartUploadsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::ListMultipartUploadsAsyncHelper(const ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListMultipartUploads(request), context);
@@ -917,7 +1137,7 @@ ListPartsOutcome GlacierClient::ListParts(const ListPartsRequest& request) const
 
 ListPartsOutcomeCallable GlacierClient::ListPartsCallable(const ListPartsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListParts(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListParts(request); } );
 }
 
 void GlacierClient::ListPartsAsync(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -925,6 +1145,16 @@ void GlacierClient::ListPartsAsync(const ListPartsRequest& request, const ListPa
   m_executor->Submit( [this, request, handler, context](){ this->ListPartsAsyncHelper( request, handler, context ); } );
 }
 
+ListPartsOutcomeCallable GlacierClient::ListPartsCallable(ListPartsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::ListParts, this, std::move(request)));
+}
+
+void GlacierClient::ListPartsAsync(ListPartsRequest&& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::ListPartsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::ListPartsAsyncHelper(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListParts(request), context);
@@ -952,7 +1182,7 @@ ListTagsForVaultOutcome GlacierClient::ListTagsForVault(const ListTagsForVaultRe
 
 ListTagsForVaultOutcomeCallable GlacierClient::ListTagsForVaultCallable(const ListTagsForVaultRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTagsForVault(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTagsForVault(request); } );
 }
 
 void GlacierClient::ListTagsForVaultAsync(const ListTagsForVaultRequest& request, const ListTagsForVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -960,6 +1190,16 @@ void GlacierClient::ListTagsForVaultAsync(const ListTagsForVaultRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsForVaultAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsForVaultOutcomeCallable GlacierClient::ListTagsForVaultCallable(ListTagsForVaultRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::ListTagsForVault, this, std::move(request)));
+}
+
+void GlacierClient::ListTagsForVaultAsync(ListTagsForVaultRequest&& request, const ListTagsForVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::ListTagsForVaultAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::ListTagsForVaultAsyncHelper(const ListTagsForVaultRequest& request, const ListTagsForVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTagsForVault(request), context);
@@ -985,7 +1225,7 @@ ListVaultsOutcome GlacierClient::ListVaults(const ListVaultsRequest& request) co
 
 ListVaultsOutcomeCallable GlacierClient::ListVaultsCallable(const ListVaultsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListVaults(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListVaults(request); } );
 }
 
 void GlacierClient::ListVaultsAsync(const ListVaultsRequest& request, const ListVaultsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -993,6 +1233,16 @@ void GlacierClient::ListVaultsAsync(const ListVaultsRequest& request, const List
   m_executor->Submit( [this, request, handler, context](){ this->ListVaultsAsyncHelper( request, handler, context ); } );
 }
 
+ListVaultsOutcomeCallable GlacierClient::ListVaultsCallable(ListVaultsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::ListVaults, this, std::move(request)));
+}
+
+void GlacierClient::ListVaultsAsync(ListVaultsRequest&& request, const ListVaultsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::ListVaultsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::ListVaultsAsyncHelper(const ListVaultsRequest& request, const ListVaultsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListVaults(request), context);
@@ -1020,7 +1270,7 @@ RemoveTagsFromVaultOutcome GlacierClient::RemoveTagsFromVault(const RemoveTagsFr
 
 RemoveTagsFromVaultOutcomeCallable GlacierClient::RemoveTagsFromVaultCallable(const RemoveTagsFromVaultRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTagsFromVault(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTagsFromVault(request); } );
 }
 
 void GlacierClient::RemoveTagsFromVaultAsync(const RemoveTagsFromVaultRequest& request, const RemoveTagsFromVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1028,6 +1278,16 @@ void GlacierClient::RemoveTagsFromVaultAsync(const RemoveTagsFromVaultRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsFromVaultAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsFromVaultOutcomeCallable GlacierClient::RemoveTagsFromVaultCallable(RemoveTagsFromVaultRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::RemoveTagsFromVault, this, std::move(request)));
+}
+
+void GlacierClient::RemoveTagsFromVaultAsync(RemoveTagsFromVaultRequest&& request, const RemoveTagsFromVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::RemoveTagsFromVaultAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::RemoveTagsFromVaultAsyncHelper(const RemoveTagsFromVaultRequest& request, const RemoveTagsFromVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTagsFromVault(request), context);
@@ -1053,7 +1313,7 @@ SetDataRetrievalPolicyOutcome GlacierClient::SetDataRetrievalPolicy(const SetDat
 
 SetDataRetrievalPolicyOutcomeCallable GlacierClient::SetDataRetrievalPolicyCallable(const SetDataRetrievalPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetDataRetrievalPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetDataRetrievalPolicy(request); } );
 }
 
 void GlacierClient::SetDataRetrievalPolicyAsync(const SetDataRetrievalPolicyRequest& request, const SetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1061,6 +1321,16 @@ void GlacierClient::SetDataRetrievalPolicyAsync(const SetDataRetrievalPolicyRequ
   m_executor->Submit( [this, request, handler, context](){ this->SetDataRetrievalPolicyAsyncHelper( request, handler, context ); } );
 }
 
+SetDataRetrievalPolicyOutcomeCallable GlacierClient::SetDataRetrievalPolicyCallable(SetDataRetrievalPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::SetDataRetrievalPolicy, this, std::move(request)));
+}
+
+void GlacierClient::SetDataRetrievalPolicyAsync(SetDataRetrievalPolicyRequest&& request, const SetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::SetDataRetrievalPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::SetDataRetrievalPolicyAsyncHelper(const SetDataRetrievalPolicyRequest& request, const SetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetDataRetrievalPolicy(request), context);
@@ -1088,7 +1358,7 @@ SetVaultAccessPolicyOutcome GlacierClient::SetVaultAccessPolicy(const SetVaultAc
 
 SetVaultAccessPolicyOutcomeCallable GlacierClient::SetVaultAccessPolicyCallable(const SetVaultAccessPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetVaultAccessPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetVaultAccessPolicy(request); } );
 }
 
 void GlacierClient::SetVaultAccessPolicyAsync(const SetVaultAccessPolicyRequest& request, const SetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1096,6 +1366,16 @@ void GlacierClient::SetVaultAccessPolicyAsync(const SetVaultAccessPolicyRequest&
   m_executor->Submit( [this, request, handler, context](){ this->SetVaultAccessPolicyAsyncHelper( request, handler, context ); } );
 }
 
+SetVaultAccessPolicyOutcomeCallable GlacierClient::SetVaultAccessPolicyCallable(SetVaultAccessPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::SetVaultAccessPolicy, this, std::move(request)));
+}
+
+void GlacierClient::SetVaultAccessPolicyAsync(SetVaultAccessPolicyRequest&& request, const SetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::SetVaultAccessPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::SetVaultAccessPolicyAsyncHelper(const SetVaultAccessPolicyRequest& request, const SetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetVaultAccessPolicy(request), context);
@@ -1123,7 +1403,7 @@ SetVaultNotificationsOutcome GlacierClient::SetVaultNotifications(const SetVault
 
 SetVaultNotificationsOutcomeCallable GlacierClient::SetVaultNotificationsCallable(const SetVaultNotificationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetVaultNotifications(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetVaultNotifications(request); } );
 }
 
 void GlacierClient::SetVaultNotificationsAsync(const SetVaultNotificationsRequest& request, const SetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1131,6 +1411,16 @@ void GlacierClient::SetVaultNotificationsAsync(const SetVaultNotificationsReques
   m_executor->Submit( [this, request, handler, context](){ this->SetVaultNotificationsAsyncHelper( request, handler, context ); } );
 }
 
+SetVaultNotificationsOutcomeCallable GlacierClient::SetVaultNotificationsCallable(SetVaultNotificationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::SetVaultNotifications, this, std::move(request)));
+}
+
+void GlacierClient::SetVaultNotificationsAsync(SetVaultNotificationsRequest&& request, const SetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::SetVaultNotificationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::SetVaultNotificationsAsyncHelper(const SetVaultNotificationsRequest& request, const SetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetVaultNotifications(request), context);
@@ -1158,7 +1448,7 @@ UploadArchiveOutcome GlacierClient::UploadArchive(const UploadArchiveRequest& re
 
 UploadArchiveOutcomeCallable GlacierClient::UploadArchiveCallable(const UploadArchiveRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UploadArchive(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UploadArchive(request); } );
 }
 
 void GlacierClient::UploadArchiveAsync(const UploadArchiveRequest& request, const UploadArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1166,6 +1456,16 @@ void GlacierClient::UploadArchiveAsync(const UploadArchiveRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->UploadArchiveAsyncHelper( request, handler, context ); } );
 }
 
+UploadArchiveOutcomeCallable GlacierClient::UploadArchiveCallable(UploadArchiveRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::UploadArchive, this, std::move(request)));
+}
+
+void GlacierClient::UploadArchiveAsync(UploadArchiveRequest&& request, const UploadArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::UploadArchiveAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::UploadArchiveAsyncHelper(const UploadArchiveRequest& request, const UploadArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UploadArchive(request), context);
@@ -1194,7 +1494,7 @@ UploadMultipartPartOutcome GlacierClient::UploadMultipartPart(const UploadMultip
 
 UploadMultipartPartOutcomeCallable GlacierClient::UploadMultipartPartCallable(const UploadMultipartPartRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UploadMultipartPart(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UploadMultipartPart(request); } );
 }
 
 void GlacierClient::UploadMultipartPartAsync(const UploadMultipartPartRequest& request, const UploadMultipartPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1202,8 +1502,243 @@ void GlacierClient::UploadMultipartPartAsync(const UploadMultipartPartRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->UploadMultipartPartAsyncHelper( request, handler, context ); } );
 }
 
+UploadMultipartPartOutcomeCallable GlacierClient::UploadMultipartPartCallable(UploadMultipartPartRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&GlacierClient::UploadMultipartPart, this, std::move(request)));
+}
+
+void GlacierClient::UploadMultipartPartAsync(UploadMultipartPartRequest&& request, const UploadMultipartPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&GlacierClient::UploadMultipartPartAsyncHelper, this, std::move(request), handler, context);
+}
+
 void GlacierClient::UploadMultipartPartAsyncHelper(const UploadMultipartPartRequest& request, const UploadMultipartPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UploadMultipartPart(request), context);
 }
 
+Paginator<GlacierClient, ListJobsRequest, ListJobsOutcome> GlacierClient::ListJobsPaginator(const ListJobsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GlacierClient, ListJobsRequest, ListJobsOutcome>(this, &GlacierClient::ListJobs, request,
+    [](const ListJobsRequest& current, const ListJobsOutcome& outcome, ListJobsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<GlacierClient, ListMultipartUploadsRequest, ListMultipartUploadsOutcome> GlacierClient::ListMultipartUploadsPaginator(const ListMultipartUploadsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GlacierClient, ListMultipartUploadsRequest, ListMultipartUploadsOutcome>(this, &GlacierClient::ListMultipartUploads, request,
+    [](const ListMultipartUploadsRequest& current, const ListMultipartUploadsOutcome& outcome, ListMultipartUploadsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<GlacierClient, ListPartsRequest, ListPartsOutcome> GlacierClient::ListPartsPaginator(const ListPartsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GlacierClient, ListPartsRequest, ListPartsOutcome>(this, &GlacierClient::ListParts, request,
+    [](const ListPartsRequest& current, const ListPartsOutcome& outcome, ListPartsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<GlacierClient, ListVaultsRequest, ListVaultsOutcome> GlacierClient::ListVaultsPaginator(const ListVaultsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<GlacierClient, ListVaultsRequest, ListVaultsOutcome>(this, &GlacierClient::ListVaults, request,
+    [](const ListVaultsRequest& current, const ListVaultsOutcome& outcome, ListVaultsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<GlacierClient, AbortMultipartUploadRequest, AbortMultipartUploadOutcome> GlacierClient::AbortMultipartUploadAwaitable(AbortMultipartUploadRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::AbortMultipartUpload, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, AbortVaultLockRequest, AbortVaultLockOutcome> GlacierClient::AbortVaultLockAwaitable(AbortVaultLockRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::AbortVaultLock, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, AddTagsToVaultRequest, AddTagsToVaultOutcome> GlacierClient::AddTagsToVaultAwaitable(AddTagsToVaultRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::AddTagsToVault, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, CompleteMultipartUploadRequest, CompleteMultipartUploadOutcome> GlacierClient::CompleteMultipartUploadAwaitable(CompleteMultipartUploadRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::CompleteMultipartUpload, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, CompleteVaultLockRequest, CompleteVaultLockOutcome> GlacierClient::CompleteVaultLockAwaitable(CompleteVaultLockRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::CompleteVaultLock, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, CreateVaultRequest, CreateVaultOutcome> GlacierClient::CreateVaultAwaitable(CreateVaultRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::CreateVault, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, DeleteArchiveRequest, DeleteArchiveOutcome> GlacierClient::DeleteArchiveAwaitable(DeleteArchiveRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::DeleteArchive, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, DeleteVaultRequest, DeleteVaultOutcome> GlacierClient::DeleteVaultAwaitable(DeleteVaultRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::DeleteVault, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, DeleteVaultAccessPolicyRequest, DeleteVaultAccessPolicyOutcome> GlacierClient::DeleteVaultAccessPolicyAwaitable(DeleteVaultAccessPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::DeleteVaultAccessPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, DeleteVaultNotificationsRequest, DeleteVaultNotificationsOutcome> GlacierClient::DeleteVaultNotificationsAwaitable(DeleteVaultNotificationsRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::DeleteVaultNotifications, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, DescribeJobRequest, DescribeJobOutcome> GlacierClient::DescribeJobAwaitable(DescribeJobRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::DescribeJob, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, DescribeVaultRequest, DescribeVaultOutcome> GlacierClient::DescribeVaultAwaitable(DescribeVaultRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::DescribeVault, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, GetDataRetrievalPolicyRequest, GetDataRetrievalPolicyOutcome> GlacierClient::GetDataRetrievalPolicyAwaitable(GetDataRetrievalPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::GetDataRetrievalPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, GetJobOutputRequest, GetJobOutputOutcome> GlacierClient::GetJobOutputAwaitable(GetJobOutputRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::GetJobOutput, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, GetVaultAccessPolicyRequest, GetVaultAccessPolicyOutcome> GlacierClient::GetVaultAccessPolicyAwaitable(GetVaultAccessPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::GetVaultAccessPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, GetVaultLockRequest, GetVaultLockOutcome> GlacierClient::GetVaultLockAwaitable(GetVaultLockRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::GetVaultLock, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, GetVaultNotificationsRequest, GetVaultNotificationsOutcome> GlacierClient::GetVaultNotificationsAwaitable(GetVaultNotificationsRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::GetVaultNotifications, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, InitiateJobRequest, InitiateJobOutcome> GlacierClient::InitiateJobAwaitable(InitiateJobRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::InitiateJob, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, InitiateMultipartUploadRequest, InitiateMultipartUploadOutcome> GlacierClient::InitiateMultipartUploadAwaitable(InitiateMultipartUploadRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::InitiateMultipartUpload, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, InitiateVaultLockRequest, InitiateVaultLockOutcome> GlacierClient::InitiateVaultLockAwaitable(InitiateVaultLockRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::InitiateVaultLock, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, ListJobsRequest, ListJobsOutcome> GlacierClient::ListJobsAwaitable(ListJobsRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::ListJobs, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, ListMultipartUploadsRequest, ListMultipartUploadsOutcome> GlacierClient::ListMultipartUploadsAwaitable(ListMultipartUploadsRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::ListMultipartUploads, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, ListPartsRequest, ListPartsOutcome> GlacierClient::ListPartsAwaitable(ListPartsRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::ListParts, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, ListTagsForVaultRequest, ListTagsForVaultOutcome> GlacierClient::ListTagsForVaultAwaitable(ListTagsForVaultRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::ListTagsForVault, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, ListVaultsRequest, ListVaultsOutcome> GlacierClient::ListVaultsAwaitable(ListVaultsRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::ListVaults, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, RemoveTagsFromVaultRequest, RemoveTagsFromVaultOutcome> GlacierClient::RemoveTagsFromVaultAwaitable(RemoveTagsFromVaultRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::RemoveTagsFromVault, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, SetDataRetrievalPolicyRequest, SetDataRetrievalPolicyOutcome> GlacierClient::SetDataRetrievalPolicyAwaitable(SetDataRetrievalPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::SetDataRetrievalPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, SetVaultAccessPolicyRequest, SetVaultAccessPolicyOutcome> GlacierClient::SetVaultAccessPolicyAwaitable(SetVaultAccessPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::SetVaultAccessPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, SetVaultNotificationsRequest, SetVaultNotificationsOutcome> GlacierClient::SetVaultNotificationsAwaitable(SetVaultNotificationsRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::SetVaultNotifications, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, UploadArchiveRequest, UploadArchiveOutcome> GlacierClient::UploadArchiveAwaitable(UploadArchiveRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::UploadArchive, std::move(request) } };
+}
+
+ClientOperationAwaitable<GlacierClient, UploadMultipartPartRequest, UploadMultipartPartOutcome> GlacierClient::UploadMultipartPartAwaitable(UploadMultipartPartRequest request) const
+{
+  return { m_executor.get(), { this, &GlacierClient::UploadMultipartPart, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
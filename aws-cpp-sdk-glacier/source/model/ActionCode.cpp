@@ -29,21 +29,29 @@ namespace Aws
       namespace ActionCodeMapper
       {
 
-        static const int ArchiveRetrieval_HASH = HashingUtils::HashString("ArchiveRetrieval");
-        static const int InventoryRetrieval_HASH = HashingUtils::HashString("InventoryRetrieval");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ArchiveRetrieval_HASH = -325843790;
+        static const int InventoryRetrieval_HASH = -1724296872;
 
 
         ActionCode GetActionCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ArchiveRetrieval_HASH)
+          switch (hashCode)
           {
+          case ArchiveRetrieval_HASH:
             return ActionCode::ArchiveRetrieval;
-          }
-          else if (hashCode == InventoryRetrieval_HASH)
-          {
+          case InventoryRetrieval_HASH:
             return ActionCode::InventoryRetrieval;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -85,6 +85,9 @@
 #include <aws/iam/model/UploadSigningCertificateResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -690,6 +693,18 @@ namespace Model
          */
         virtual void AddClientIDToOpenIDConnectProviderAsync(const Model::AddClientIDToOpenIDConnectProviderRequest& request, const AddClientIDToOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddClientIDToOpenIDConnectProviderCallable(const Model::AddClientIDToOpenIDConnectProviderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddClientIDToOpenIDConnectProviderOutcomeCallable AddClientIDToOpenIDConnectProviderCallable(Model::AddClientIDToOpenIDConnectProviderRequest&& request) const;
+
+        /**
+         * Same as AddClientIDToOpenIDConnectProviderAsync(const Model::AddClientIDToOpenIDConnectProviderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddClientIDToOpenIDConnectProviderAsync(Model::AddClientIDToOpenIDConnectProviderRequest&& request, const AddClientIDToOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds the specified IAM role to the specified instance profile.</p> <note>
          * <p>The caller of this API must be granted the <code>PassRole</code> permission
@@ -730,6 +745,18 @@ namespace Model
          */
         virtual void AddRoleToInstanceProfileAsync(const Model::AddRoleToInstanceProfileRequest& request, const AddRoleToInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddRoleToInstanceProfileCallable(const Model::AddRoleToInstanceProfileRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddRoleToInstanceProfileOutcomeCallable AddRoleToInstanceProfileCallable(Model::AddRoleToInstanceProfileRequest&& request) const;
+
+        /**
+         * Same as AddRoleToInstanceProfileAsync(const Model::AddRoleToInstanceProfileRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddRoleToInstanceProfileAsync(Model::AddRoleToInstanceProfileRequest&& request, const AddRoleToInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds the specified user to the specified group.</p>
          */
@@ -749,6 +776,18 @@ namespace Model
          */
         virtual void AddUserToGroupAsync(const Model::AddUserToGroupRequest& request, const AddUserToGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddUserToGroupCallable(const Model::AddUserToGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddUserToGroupOutcomeCallable AddUserToGroupCallable(Model::AddUserToGroupRequest&& request) const;
+
+        /**
+         * Same as AddUserToGroupAsync(const Model::AddUserToGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddUserToGroupAsync(Model::AddUserToGroupRequest&& request, const AddUserToGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches the specified managed policy to the specified IAM group.</p> <p>You
          * use this API to attach a managed policy to a group. To embed an inline policy in
@@ -783,6 +822,18 @@ namespace Model
          */
         virtual void AttachGroupPolicyAsync(const Model::AttachGroupPolicyRequest& request, const AttachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachGroupPolicyCallable(const Model::AttachGroupPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachGroupPolicyOutcomeCallable AttachGroupPolicyCallable(Model::AttachGroupPolicyRequest&& request) const;
+
+        /**
+         * Same as AttachGroupPolicyAsync(const Model::AttachGroupPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachGroupPolicyAsync(Model::AttachGroupPolicyRequest&& request, const AttachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches the specified managed policy to the specified IAM role.</p> <p>When
          * you attach a managed policy to a role, the managed policy becomes part of the
@@ -829,6 +880,18 @@ namespace Model
          */
         virtual void AttachRolePolicyAsync(const Model::AttachRolePolicyRequest& request, const AttachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachRolePolicyCallable(const Model::AttachRolePolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachRolePolicyOutcomeCallable AttachRolePolicyCallable(Model::AttachRolePolicyRequest&& request) const;
+
+        /**
+         * Same as AttachRolePolicyAsync(const Model::AttachRolePolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachRolePolicyAsync(Model::AttachRolePolicyRequest&& request, const AttachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches the specified managed policy to the specified user.</p> <p>You use
          * this API to attach a <i>managed</i> policy to a user. To embed an inline policy
@@ -863,6 +926,18 @@ namespace Model
          */
         virtual void AttachUserPolicyAsync(const Model::AttachUserPolicyRequest& request, const AttachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachUserPolicyCallable(const Model::AttachUserPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachUserPolicyOutcomeCallable AttachUserPolicyCallable(Model::AttachUserPolicyRequest&& request) const;
+
+        /**
+         * Same as AttachUserPolicyAsync(const Model::AttachUserPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachUserPolicyAsync(Model::AttachUserPolicyRequest&& request, const AttachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the password of the IAM user who is calling this action. The root
          * account password is not affected by this action.</p> <p>To change the password
@@ -897,6 +972,18 @@ namespace Model
          */
         virtual void ChangePasswordAsync(const Model::ChangePasswordRequest& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ChangePasswordCallable(const Model::ChangePasswordRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ChangePasswordOutcomeCallable ChangePasswordCallable(Model::ChangePasswordRequest&& request) const;
+
+        /**
+         * Same as ChangePasswordAsync(const Model::ChangePasswordRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ChangePasswordAsync(Model::ChangePasswordRequest&& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new AWS secret access key and corresponding AWS access key ID for
          * the specified user. The default status for new keys is <code>Active</code>.</p>
@@ -955,6 +1042,18 @@ namespace Model
          */
         virtual void CreateAccessKeyAsync(const Model::CreateAccessKeyRequest& request, const CreateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAccessKeyCallable(const Model::CreateAccessKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateAccessKeyOutcomeCallable CreateAccessKeyCallable(Model::CreateAccessKeyRequest&& request) const;
+
+        /**
+         * Same as CreateAccessKeyAsync(const Model::CreateAccessKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateAccessKeyAsync(Model::CreateAccessKeyRequest&& request, const CreateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an alias for your AWS account. For information about using an AWS
          * account alias, see <a
@@ -983,6 +1082,18 @@ namespace Model
          */
         virtual void CreateAccountAliasAsync(const Model::CreateAccountAliasRequest& request, const CreateAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAccountAliasCallable(const Model::CreateAccountAliasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateAccountAliasOutcomeCallable CreateAccountAliasCallable(Model::CreateAccountAliasRequest&& request) const;
+
+        /**
+         * Same as CreateAccountAliasAsync(const Model::CreateAccountAliasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateAccountAliasAsync(Model::CreateAccountAliasRequest&& request, const CreateAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new group.</p> <p> For information about the number of groups you
          * can create, see <a
@@ -1011,6 +1122,18 @@ namespace Model
          */
         virtual void CreateGroupAsync(const Model::CreateGroupRequest& request, const CreateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateGroupCallable(const Model::CreateGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateGroupOutcomeCallable CreateGroupCallable(Model::CreateGroupRequest&& request) const;
+
+        /**
+         * Same as CreateGroupAsync(const Model::CreateGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateGroupAsync(Model::CreateGroupRequest&& request, const CreateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new instance profile. For information about instance profiles, go
          * to <a
@@ -1048,6 +1171,18 @@ namespace Model
          */
         virtual void CreateInstanceProfileAsync(const Model::CreateInstanceProfileRequest& request, const CreateInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateInstanceProfileCallable(const Model::CreateInstanceProfileRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateInstanceProfileOutcomeCallable CreateInstanceProfileCallable(Model::CreateInstanceProfileRequest&& request) const;
+
+        /**
+         * Same as CreateInstanceProfileAsync(const Model::CreateInstanceProfileRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateInstanceProfileAsync(Model::CreateInstanceProfileRequest&& request, const CreateInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a password for the specified user, giving the user the ability to
          * access AWS services through the AWS Management Console. For more information
@@ -1079,6 +1214,18 @@ namespace Model
          */
         virtual void CreateLoginProfileAsync(const Model::CreateLoginProfileRequest& request, const CreateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLoginProfileCallable(const Model::CreateLoginProfileRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateLoginProfileOutcomeCallable CreateLoginProfileCallable(Model::CreateLoginProfileRequest&& request) const;
+
+        /**
+         * Same as CreateLoginProfileAsync(const Model::CreateLoginProfileRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateLoginProfileAsync(Model::CreateLoginProfileRequest&& request, const CreateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an IAM entity to describe an identity provider (IdP) that supports <a
          * href="http://openid.net/connect/">OpenID Connect (OIDC)</a>.</p> <p>The OIDC
@@ -1137,6 +1284,18 @@ namespace Model
          */
         virtual void CreateOpenIDConnectProviderAsync(const Model::CreateOpenIDConnectProviderRequest& request, const CreateOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateOpenIDConnectProviderCallable(const Model::CreateOpenIDConnectProviderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateOpenIDConnectProviderOutcomeCallable CreateOpenIDConnectProviderCallable(Model::CreateOpenIDConnectProviderRequest&& request) const;
+
+        /**
+         * Same as CreateOpenIDConnectProviderAsync(const Model::CreateOpenIDConnectProviderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateOpenIDConnectProviderAsync(Model::CreateOpenIDConnectProviderRequest&& request, const CreateOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new managed policy for your AWS account.</p> <p>This operation
          * creates a policy version with a version identifier of <code>v1</code> and sets
@@ -1180,6 +1339,18 @@ namespace Model
          */
         virtual void CreatePolicyAsync(const Model::CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePolicyCallable(const Model::CreatePolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreatePolicyOutcomeCallable CreatePolicyCallable(Model::CreatePolicyRequest&& request) const;
+
+        /**
+         * Same as CreatePolicyAsync(const Model::CreatePolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreatePolicyAsync(Model::CreatePolicyRequest&& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new version of the specified managed policy. To update a managed
          * policy, you create a new policy version. A managed policy can have up to five
@@ -1226,6 +1397,18 @@ namespace Model
          */
         virtual void CreatePolicyVersionAsync(const Model::CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePolicyVersionCallable(const Model::CreatePolicyVersionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreatePolicyVersionOutcomeCallable CreatePolicyVersionCallable(Model::CreatePolicyVersionRequest&& request) const;
+
+        /**
+         * Same as CreatePolicyVersionAsync(const Model::CreatePolicyVersionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreatePolicyVersionAsync(Model::CreatePolicyVersionRequest&& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new role for your AWS account. For more information about roles, go
          * to <a
@@ -1263,6 +1446,18 @@ namespace Model
          */
         virtual void CreateRoleAsync(const Model::CreateRoleRequest& request, const CreateRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRoleCallable(const Model::CreateRoleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateRoleOutcomeCallable CreateRoleCallable(Model::CreateRoleRequest&& request) const;
+
+        /**
+         * Same as CreateRoleAsync(const Model::CreateRoleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateRoleAsync(Model::CreateRoleRequest&& request, const CreateRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an IAM resource that describes an identity provider (IdP) that
          * supports SAML 2.0.</p> <p>The SAML provider resource that you create with this
@@ -1333,6 +1528,18 @@ namespace Model
          */
         virtual void CreateSAMLProviderAsync(const Model::CreateSAMLProviderRequest& request, const CreateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSAMLProviderCallable(const Model::CreateSAMLProviderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateSAMLProviderOutcomeCallable CreateSAMLProviderCallable(Model::CreateSAMLProviderRequest&& request) const;
+
+        /**
+         * Same as CreateSAMLProviderAsync(const Model::CreateSAMLProviderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateSAMLProviderAsync(Model::CreateSAMLProviderRequest&& request, const CreateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new IAM user for your AWS account.</p> <p> For information about
          * limitations on the number of IAM users you can create, see <a
@@ -1361,6 +1568,18 @@ namespace Model
          */
         virtual void CreateUserAsync(const Model::CreateUserRequest& request, const CreateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateUserCallable(const Model::CreateUserRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateUserOutcomeCallable CreateUserCallable(Model::CreateUserRequest&& request) const;
+
+        /**
+         * Same as CreateUserAsync(const Model::CreateUserRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateUserAsync(Model::CreateUserRequest&& request, const CreateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new virtual MFA device for the AWS account. After creating the
          * virtual MFA, use <a>EnableMFADevice</a> to attach the MFA device to an IAM user.
@@ -1416,6 +1635,18 @@ namespace Model
          */
         virtual void CreateVirtualMFADeviceAsync(const Model::CreateVirtualMFADeviceRequest& request, const CreateVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVirtualMFADeviceCallable(const Model::CreateVirtualMFADeviceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateVirtualMFADeviceOutcomeCallable CreateVirtualMFADeviceCallable(Model::CreateVirtualMFADeviceRequest&& request) const;
+
+        /**
+         * Same as CreateVirtualMFADeviceAsync(const Model::CreateVirtualMFADeviceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateVirtualMFADeviceAsync(Model::CreateVirtualMFADeviceRequest&& request, const CreateVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deactivates the specified MFA device and removes it from association with the
          * user name for which it was originally enabled.</p> <p>For more information about
@@ -1447,6 +1678,18 @@ namespace Model
          */
         virtual void DeactivateMFADeviceAsync(const Model::DeactivateMFADeviceRequest& request, const DeactivateMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeactivateMFADeviceCallable(const Model::DeactivateMFADeviceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeactivateMFADeviceOutcomeCallable DeactivateMFADeviceCallable(Model::DeactivateMFADeviceRequest&& request) const;
+
+        /**
+         * Same as DeactivateMFADeviceAsync(const Model::DeactivateMFADeviceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeactivateMFADeviceAsync(Model::DeactivateMFADeviceRequest&& request, const DeactivateMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the access key pair associated with the specified IAM user.</p> <p>If
          * you do not specify a user name, IAM determines the user name implicitly based on
@@ -1478,6 +1721,18 @@ namespace Model
          */
         virtual void DeleteAccessKeyAsync(const Model::DeleteAccessKeyRequest& request, const DeleteAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAccessKeyCallable(const Model::DeleteAccessKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteAccessKeyOutcomeCallable DeleteAccessKeyCallable(Model::DeleteAccessKeyRequest&& request) const;
+
+        /**
+         * Same as DeleteAccessKeyAsync(const Model::DeleteAccessKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteAccessKeyAsync(Model::DeleteAccessKeyRequest&& request, const DeleteAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the specified AWS account alias. For information about using an AWS
          * account alias, see <a
@@ -1506,6 +1761,18 @@ namespace Model
          */
         virtual void DeleteAccountAliasAsync(const Model::DeleteAccountAliasRequest& request, const DeleteAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAccountAliasCallable(const Model::DeleteAccountAliasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteAccountAliasOutcomeCallable DeleteAccountAliasCallable(Model::DeleteAccountAliasRequest&& request) const;
+
+        /**
+         * Same as DeleteAccountAliasAsync(const Model::DeleteAccountAliasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteAccountAliasAsync(Model::DeleteAccountAliasRequest&& request, const DeleteAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the password policy for the AWS account. There are no parameters.</p>
          */
@@ -1525,6 +1792,18 @@ namespace Model
          */
         virtual void DeleteAccountPasswordPolicyAsync(const Model::DeleteAccountPasswordPolicyRequest& request, const DeleteAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAccountPasswordPolicyCallable(const Model::DeleteAccountPasswordPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteAccountPasswordPolicyOutcomeCallable DeleteAccountPasswordPolicyCallable(Model::DeleteAccountPasswordPolicyRequest&& request) const;
+
+        /**
+         * Same as DeleteAccountPasswordPolicyAsync(const Model::DeleteAccountPasswordPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteAccountPasswordPolicyAsync(Model::DeleteAccountPasswordPolicyRequest&& request, const DeleteAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified IAM group. The group must not contain any users or have
          * any attached policies.</p>
@@ -1547,6 +1826,18 @@ namespace Model
          */
         virtual void DeleteGroupAsync(const Model::DeleteGroupRequest& request, const DeleteGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteGroupCallable(const Model::DeleteGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteGroupOutcomeCallable DeleteGroupCallable(Model::DeleteGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteGroupAsync(const Model::DeleteGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteGroupAsync(Model::DeleteGroupRequest&& request, const DeleteGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified inline policy that is embedded in the specified IAM
          * group.</p> <p>A group can also have managed policies attached to it. To detach a
@@ -1581,6 +1872,18 @@ namespace Model
          */
         virtual void DeleteGroupPolicyAsync(const Model::DeleteGroupPolicyRequest& request, const DeleteGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteGroupPolicyCallable(const Model::DeleteGroupPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteGroupPolicyOutcomeCallable DeleteGroupPolicyCallable(Model::DeleteGroupPolicyRequest&& request) const;
+
+        /**
+         * Same as DeleteGroupPolicyAsync(const Model::DeleteGroupPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteGroupPolicyAsync(Model::DeleteGroupPolicyRequest&& request, const DeleteGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified instance profile. The instance profile must not have an
          * associated role.</p> <important> <p>Make sure you do not have any Amazon EC2
@@ -1621,6 +1924,18 @@ namespace Model
          */
         virtual void DeleteInstanceProfileAsync(const Model::DeleteInstanceProfileRequest& request, const DeleteInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteInstanceProfileCallable(const Model::DeleteInstanceProfileRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteInstanceProfileOutcomeCallable DeleteInstanceProfileCallable(Model::DeleteInstanceProfileRequest&& request) const;
+
+        /**
+         * Same as DeleteInstanceProfileAsync(const Model::DeleteInstanceProfileRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteInstanceProfileAsync(Model::DeleteInstanceProfileRequest&& request, const DeleteInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the password for the specified IAM user, which terminates the user's
          * ability to access AWS services through the AWS Management Console.</p>
@@ -1658,6 +1973,18 @@ namespace Model
          */
         virtual void DeleteLoginProfileAsync(const Model::DeleteLoginProfileRequest& request, const DeleteLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLoginProfileCallable(const Model::DeleteLoginProfileRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteLoginProfileOutcomeCallable DeleteLoginProfileCallable(Model::DeleteLoginProfileRequest&& request) const;
+
+        /**
+         * Same as DeleteLoginProfileAsync(const Model::DeleteLoginProfileRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteLoginProfileAsync(Model::DeleteLoginProfileRequest&& request, const DeleteLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an OpenID Connect identity provider (IdP) resource object in IAM.</p>
          * <p>Deleting an IAM OIDC provider resource does not update any roles that
@@ -1692,6 +2019,18 @@ namespace Model
          */
         virtual void DeleteOpenIDConnectProviderAsync(const Model::DeleteOpenIDConnectProviderRequest& request, const DeleteOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteOpenIDConnectProviderCallable(const Model::DeleteOpenIDConnectProviderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteOpenIDConnectProviderOutcomeCallable DeleteOpenIDConnectProviderCallable(Model::DeleteOpenIDConnectProviderRequest&& request) const;
+
+        /**
+         * Same as DeleteOpenIDConnectProviderAsync(const Model::DeleteOpenIDConnectProviderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteOpenIDConnectProviderAsync(Model::DeleteOpenIDConnectProviderRequest&& request, const DeleteOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified managed policy.</p> <p>Before you can delete a managed
          * policy, you must first detach the policy from all users, groups, and roles that
@@ -1759,6 +2098,18 @@ namespace Model
          */
         virtual void DeletePolicyAsync(const Model::DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePolicyCallable(const Model::DeletePolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeletePolicyOutcomeCallable DeletePolicyCallable(Model::DeletePolicyRequest&& request) const;
+
+        /**
+         * Same as DeletePolicyAsync(const Model::DeletePolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeletePolicyAsync(Model::DeletePolicyRequest&& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified version from the specified managed policy.</p> <p>You
          * cannot delete the default version from a policy using this API. To delete the
@@ -1799,6 +2150,18 @@ namespace Model
          */
         virtual void DeletePolicyVersionAsync(const Model::DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePolicyVersionCallable(const Model::DeletePolicyVersionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeletePolicyVersionOutcomeCallable DeletePolicyVersionCallable(Model::DeletePolicyVersionRequest&& request) const;
+
+        /**
+         * Same as DeletePolicyVersionAsync(const Model::DeletePolicyVersionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeletePolicyVersionAsync(Model::DeletePolicyVersionRequest&& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified role. The role must not have any policies attached. For
          * more information about roles, go to <a
@@ -1836,6 +2199,18 @@ namespace Model
          */
         virtual void DeleteRoleAsync(const Model::DeleteRoleRequest& request, const DeleteRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRoleCallable(const Model::DeleteRoleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRoleOutcomeCallable DeleteRoleCallable(Model::DeleteRoleRequest&& request) const;
+
+        /**
+         * Same as DeleteRoleAsync(const Model::DeleteRoleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRoleAsync(Model::DeleteRoleRequest&& request, const DeleteRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified inline policy that is embedded in the specified IAM
          * role.</p> <p>A role can also have managed policies attached to it. To detach a
@@ -1870,6 +2245,18 @@ namespace Model
          */
         virtual void DeleteRolePolicyAsync(const Model::DeleteRolePolicyRequest& request, const DeleteRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRolePolicyCallable(const Model::DeleteRolePolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRolePolicyOutcomeCallable DeleteRolePolicyCallable(Model::DeleteRolePolicyRequest&& request) const;
+
+        /**
+         * Same as DeleteRolePolicyAsync(const Model::DeleteRolePolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRolePolicyAsync(Model::DeleteRolePolicyRequest&& request, const DeleteRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a SAML provider resource in IAM.</p> <p>Deleting the provider
          * resource from IAM does not update any roles that reference the SAML provider
@@ -1907,6 +2294,18 @@ namespace Model
          */
         virtual void DeleteSAMLProviderAsync(const Model::DeleteSAMLProviderRequest& request, const DeleteSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSAMLProviderCallable(const Model::DeleteSAMLProviderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteSAMLProviderOutcomeCallable DeleteSAMLProviderCallable(Model::DeleteSAMLProviderRequest&& request) const;
+
+        /**
+         * Same as DeleteSAMLProviderAsync(const Model::DeleteSAMLProviderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteSAMLProviderAsync(Model::DeleteSAMLProviderRequest&& request, const DeleteSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified SSH public key.</p> <p>The SSH public key deleted by
          * this action is used only for authenticating the associated IAM user to an AWS
@@ -1944,6 +2343,18 @@ namespace Model
          */
         virtual void DeleteSSHPublicKeyAsync(const Model::DeleteSSHPublicKeyRequest& request, const DeleteSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSSHPublicKeyCallable(const Model::DeleteSSHPublicKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteSSHPublicKeyOutcomeCallable DeleteSSHPublicKeyCallable(Model::DeleteSSHPublicKeyRequest&& request) const;
+
+        /**
+         * Same as DeleteSSHPublicKeyAsync(const Model::DeleteSSHPublicKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteSSHPublicKeyAsync(Model::DeleteSSHPublicKeyRequest&& request, const DeleteSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified server certificate.</p> <p>For more information about
          * working with server certificates, including a list of AWS services that can use
@@ -2002,6 +2413,18 @@ namespace Model
          */
         virtual void DeleteServerCertificateAsync(const Model::DeleteServerCertificateRequest& request, const DeleteServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteServerCertificateCallable(const Model::DeleteServerCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteServerCertificateOutcomeCallable DeleteServerCertificateCallable(Model::DeleteServerCertificateRequest&& request) const;
+
+        /**
+         * Same as DeleteServerCertificateAsync(const Model::DeleteServerCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteServerCertificateAsync(Model::DeleteServerCertificateRequest&& request, const DeleteServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a signing certificate associated with the specified IAM user.</p>
          * <p>If you do not specify a user name, IAM determines the user name implicitly
@@ -2033,6 +2456,18 @@ namespace Model
          */
         virtual void DeleteSigningCertificateAsync(const Model::DeleteSigningCertificateRequest& request, const DeleteSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSigningCertificateCallable(const Model::DeleteSigningCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteSigningCertificateOutcomeCallable DeleteSigningCertificateCallable(Model::DeleteSigningCertificateRequest&& request) const;
+
+        /**
+         * Same as DeleteSigningCertificateAsync(const Model::DeleteSigningCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteSigningCertificateAsync(Model::DeleteSigningCertificateRequest&& request, const DeleteSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified IAM user. The user must not belong to any groups or
          * have any access keys, signing certificates, or attached policies.</p>
@@ -2055,6 +2490,18 @@ namespace Model
          */
         virtual void DeleteUserAsync(const Model::DeleteUserRequest& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteUserCallable(const Model::DeleteUserRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteUserOutcomeCallable DeleteUserCallable(Model::DeleteUserRequest&& request) const;
+
+        /**
+         * Same as DeleteUserAsync(const Model::DeleteUserRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteUserAsync(Model::DeleteUserRequest&& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified inline policy that is embedded in the specified IAM
          * user.</p> <p>A user can also have managed policies attached to it. To detach a
@@ -2089,6 +2536,18 @@ namespace Model
          */
         virtual void DeleteUserPolicyAsync(const Model::DeleteUserPolicyRequest& request, const DeleteUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteUserPolicyCallable(const Model::DeleteUserPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteUserPolicyOutcomeCallable DeleteUserPolicyCallable(Model::DeleteUserPolicyRequest&& request) const;
+
+        /**
+         * Same as DeleteUserPolicyAsync(const Model::DeleteUserPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteUserPolicyAsync(Model::DeleteUserPolicyRequest&& request, const DeleteUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a virtual MFA device.</p> <note> <p> You must deactivate a user's
          * virtual MFA device before you can delete it. For information about deactivating
@@ -2114,6 +2573,18 @@ namespace Model
          */
         virtual void DeleteVirtualMFADeviceAsync(const Model::DeleteVirtualMFADeviceRequest& request, const DeleteVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVirtualMFADeviceCallable(const Model::DeleteVirtualMFADeviceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteVirtualMFADeviceOutcomeCallable DeleteVirtualMFADeviceCallable(Model::DeleteVirtualMFADeviceRequest&& request) const;
+
+        /**
+         * Same as DeleteVirtualMFADeviceAsync(const Model::DeleteVirtualMFADeviceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteVirtualMFADeviceAsync(Model::DeleteVirtualMFADeviceRequest&& request, const DeleteVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified managed policy from the specified IAM group.</p> <p>A
          * group can also have inline policies embedded with it. To delete an inline
@@ -2148,6 +2619,18 @@ namespace Model
          */
         virtual void DetachGroupPolicyAsync(const Model::DetachGroupPolicyRequest& request, const DetachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachGroupPolicyCallable(const Model::DetachGroupPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachGroupPolicyOutcomeCallable DetachGroupPolicyCallable(Model::DetachGroupPolicyRequest&& request) const;
+
+        /**
+         * Same as DetachGroupPolicyAsync(const Model::DetachGroupPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachGroupPolicyAsync(Model::DetachGroupPolicyRequest&& request, const DetachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified managed policy from the specified role.</p> <p>A role
          * can also have inline policies embedded with it. To delete an inline policy, use
@@ -2179,6 +2662,18 @@ namespace Model
          */
         virtual void DetachRolePolicyAsync(const Model::DetachRolePolicyRequest& request, const DetachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachRolePolicyCallable(const Model::DetachRolePolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachRolePolicyOutcomeCallable DetachRolePolicyCallable(Model::DetachRolePolicyRequest&& request) const;
+
+        /**
+         * Same as DetachRolePolicyAsync(const Model::DetachRolePolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachRolePolicyAsync(Model::DetachRolePolicyRequest&& request, const DetachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified managed policy from the specified user.</p> <p>A user
          * can also have inline policies embedded with it. To delete an inline policy, use
@@ -2210,6 +2705,18 @@ namespace Model
          */
         virtual void DetachUserPolicyAsync(const Model::DetachUserPolicyRequest& request, const DetachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachUserPolicyCallable(const Model::DetachUserPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachUserPolicyOutcomeCallable DetachUserPolicyCallable(Model::DetachUserPolicyRequest&& request) const;
+
+        /**
+         * Same as DetachUserPolicyAsync(const Model::DetachUserPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachUserPolicyAsync(Model::DetachUserPolicyRequest&& request, const DetachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables the specified MFA device and associates it with the specified IAM
          * user. When enabled, the MFA device is required for every subsequent login by the
@@ -2236,10 +2743,22 @@ namespace Model
         virtual void EnableMFADeviceAsync(const Model::EnableMFADeviceRequest& request, const EnableMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
         /**
-         * <p> Generates a credential report for the AWS account. For more information
-         * about the credential report, see <a
-         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/credential-reports.html">Getting
-         * Credential Reports</a> in the <i>IAM User Guide</i>.</p>
+         * Same as EnableMFADeviceCallable(const Model::EnableMFADeviceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableMFADeviceOutcomeCallable EnableMFADeviceCallable(Model::EnableMFADeviceRequest&& request) const;
+
+        /**
+         * Same as EnableMFADeviceAsync(const Model::EnableMFADeviceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableMFADeviceAsync(Model::EnableMFADeviceRequest&& request, const EnableMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+        /**
+         * <p> Generates a credential report for the AWS account. For more information
+         * about the credential report, see <a
+         * href="http://docs.aws.amazon.com/IAM/latest/UserGuide/credential-reports.html">Getting
+         * Credential Reports</a> in the <i>IAM User Guide</i>.</p>
          */
         virtual Model::GenerateCredentialReportOutcome GenerateCredentialReport(const Model::GenerateCredentialReportRequest& request) const;
 
@@ -2263,6 +2782,18 @@ namespace Model
          */
         virtual void GenerateCredentialReportAsync(const Model::GenerateCredentialReportRequest& request, const GenerateCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GenerateCredentialReportCallable(const Model::GenerateCredentialReportRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GenerateCredentialReportOutcomeCallable GenerateCredentialReportCallable(Model::GenerateCredentialReportRequest&& request) const;
+
+        /**
+         * Same as GenerateCredentialReportAsync(const Model::GenerateCredentialReportRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GenerateCredentialReportAsync(Model::GenerateCredentialReportRequest&& request, const GenerateCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about when the specified access key was last used. The
          * information includes the date and time of last use, along with the AWS service
@@ -2288,6 +2819,18 @@ namespace Model
          */
         virtual void GetAccessKeyLastUsedAsync(const Model::GetAccessKeyLastUsedRequest& request, const GetAccessKeyLastUsedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAccessKeyLastUsedCallable(const Model::GetAccessKeyLastUsedRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetAccessKeyLastUsedOutcomeCallable GetAccessKeyLastUsedCallable(Model::GetAccessKeyLastUsedRequest&& request) const;
+
+        /**
+         * Same as GetAccessKeyLastUsedAsync(const Model::GetAccessKeyLastUsedRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetAccessKeyLastUsedAsync(Model::GetAccessKeyLastUsedRequest&& request, const GetAccessKeyLastUsedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about all IAM users, groups, roles, and policies in
          * your AWS account, including their relationships to one another. Use this API to
@@ -2322,6 +2865,18 @@ namespace Model
          */
         virtual void GetAccountAuthorizationDetailsAsync(const Model::GetAccountAuthorizationDetailsRequest& request, const GetAccountAuthorizationDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAccountAuthorizationDetailsCallable(const Model::GetAccountAuthorizationDetailsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetAccountAuthorizationDetailsOutcomeCallable GetAccountAuthorizationDetailsCallable(Model::GetAccountAuthorizationDetailsRequest&& request) const;
+
+        /**
+         * Same as GetAccountAuthorizationDetailsAsync(const Model::GetAccountAuthorizationDetailsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetAccountAuthorizationDetailsAsync(Model::GetAccountAuthorizationDetailsRequest&& request, const GetAccountAuthorizationDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the password policy for the AWS account. For more information about
          * using a password policy, go to <a
@@ -2350,6 +2905,18 @@ namespace Model
          */
         virtual void GetAccountPasswordPolicyAsync(const Model::GetAccountPasswordPolicyRequest& request, const GetAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAccountPasswordPolicyCallable(const Model::GetAccountPasswordPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetAccountPasswordPolicyOutcomeCallable GetAccountPasswordPolicyCallable(Model::GetAccountPasswordPolicyRequest&& request) const;
+
+        /**
+         * Same as GetAccountPasswordPolicyAsync(const Model::GetAccountPasswordPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetAccountPasswordPolicyAsync(Model::GetAccountPasswordPolicyRequest&& request, const GetAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about IAM entity usage and IAM quotas in the AWS
          * account.</p> <p> For information about limitations on IAM entities, see <a
@@ -2378,6 +2945,18 @@ namespace Model
          */
         virtual void GetAccountSummaryAsync(const Model::GetAccountSummaryRequest& request, const GetAccountSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAccountSummaryCallable(const Model::GetAccountSummaryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetAccountSummaryOutcomeCallable GetAccountSummaryCallable(Model::GetAccountSummaryRequest&& request) const;
+
+        /**
+         * Same as GetAccountSummaryAsync(const Model::GetAccountSummaryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetAccountSummaryAsync(Model::GetAccountSummaryRequest&& request, const GetAccountSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a list of all of the context keys referenced in the input policies. The
          * policies are supplied as a list of one or more strings. To get the context keys
@@ -2424,6 +3003,18 @@ namespace Model
          */
         virtual void GetContextKeysForCustomPolicyAsync(const Model::GetContextKeysForCustomPolicyRequest& request, const GetContextKeysForCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetContextKeysForCustomPolicyCallable(const Model::GetContextKeysForCustomPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetContextKeysForCustomPolicyOutcomeCallable GetContextKeysForCustomPolicyCallable(Model::GetContextKeysForCustomPolicyRequest&& request) const;
+
+        /**
+         * Same as GetContextKeysForCustomPolicyAsync(const Model::GetContextKeysForCustomPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetContextKeysForCustomPolicyAsync(Model::GetContextKeysForCustomPolicyRequest&& request, const GetContextKeysForCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a list of all of the context keys referenced in all of the IAM policies
          * attached to the specified IAM entity. The entity can be an IAM user, group, or
@@ -2485,6 +3076,18 @@ namespace Model
          */
         virtual void GetContextKeysForPrincipalPolicyAsync(const Model::GetContextKeysForPrincipalPolicyRequest& request, const GetContextKeysForPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetContextKeysForPrincipalPolicyCallable(const Model::GetContextKeysForPrincipalPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetContextKeysForPrincipalPolicyOutcomeCallable GetContextKeysForPrincipalPolicyCallable(Model::GetContextKeysForPrincipalPolicyRequest&& request) const;
+
+        /**
+         * Same as GetContextKeysForPrincipalPolicyAsync(const Model::GetContextKeysForPrincipalPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetContextKeysForPrincipalPolicyAsync(Model::GetContextKeysForPrincipalPolicyRequest&& request, const GetContextKeysForPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Retrieves a credential report for the AWS account. For more information
          * about the credential report, see <a
@@ -2513,6 +3116,18 @@ namespace Model
          */
         virtual void GetCredentialReportAsync(const Model::GetCredentialReportRequest& request, const GetCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCredentialReportCallable(const Model::GetCredentialReportRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetCredentialReportOutcomeCallable GetCredentialReportCallable(Model::GetCredentialReportRequest&& request) const;
+
+        /**
+         * Same as GetCredentialReportAsync(const Model::GetCredentialReportRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetCredentialReportAsync(Model::GetCredentialReportRequest&& request, const GetCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of IAM users that are in the specified IAM group. You can
          * paginate the results using the <code>MaxItems</code> and <code>Marker</code>
@@ -2538,6 +3153,18 @@ namespace Model
          */
         virtual void GetGroupAsync(const Model::GetGroupRequest& request, const GetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetGroupCallable(const Model::GetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetGroupOutcomeCallable GetGroupCallable(Model::GetGroupRequest&& request) const;
+
+        /**
+         * Same as GetGroupAsync(const Model::GetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetGroupAsync(Model::GetGroupRequest&& request, const GetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the specified inline policy document that is embedded in the
          * specified IAM group.</p> <note> <p>Policies returned by this API are URL-encoded
@@ -2593,6 +3220,18 @@ namespace Model
          */
         virtual void GetGroupPolicyAsync(const Model::GetGroupPolicyRequest& request, const GetGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetGroupPolicyCallable(const Model::GetGroupPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetGroupPolicyOutcomeCallable GetGroupPolicyCallable(Model::GetGroupPolicyRequest&& request) const;
+
+        /**
+         * Same as GetGroupPolicyAsync(const Model::GetGroupPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetGroupPolicyAsync(Model::GetGroupPolicyRequest&& request, const GetGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Retrieves information about the specified instance profile, including the
          * instance profile's path, GUID, ARN, and role. For more information about
@@ -2624,6 +3263,18 @@ namespace Model
          */
         virtual void GetInstanceProfileAsync(const Model::GetInstanceProfileRequest& request, const GetInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetInstanceProfileCallable(const Model::GetInstanceProfileRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetInstanceProfileOutcomeCallable GetInstanceProfileCallable(Model::GetInstanceProfileRequest&& request) const;
+
+        /**
+         * Same as GetInstanceProfileAsync(const Model::GetInstanceProfileRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetInstanceProfileAsync(Model::GetInstanceProfileRequest&& request, const GetInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the user name and password-creation date for the specified IAM
          * user. If the user has not been assigned a password, the action returns a 404
@@ -2649,6 +3300,18 @@ namespace Model
          */
         virtual void GetLoginProfileAsync(const Model::GetLoginProfileRequest& request, const GetLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetLoginProfileCallable(const Model::GetLoginProfileRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetLoginProfileOutcomeCallable GetLoginProfileCallable(Model::GetLoginProfileRequest&& request) const;
+
+        /**
+         * Same as GetLoginProfileAsync(const Model::GetLoginProfileRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetLoginProfileAsync(Model::GetLoginProfileRequest&& request, const GetLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the specified OpenID Connect (OIDC) provider
          * resource object in IAM.</p>
@@ -2671,6 +3334,18 @@ namespace Model
          */
         virtual void GetOpenIDConnectProviderAsync(const Model::GetOpenIDConnectProviderRequest& request, const GetOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetOpenIDConnectProviderCallable(const Model::GetOpenIDConnectProviderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetOpenIDConnectProviderOutcomeCallable GetOpenIDConnectProviderCallable(Model::GetOpenIDConnectProviderRequest&& request) const;
+
+        /**
+         * Same as GetOpenIDConnectProviderAsync(const Model::GetOpenIDConnectProviderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetOpenIDConnectProviderAsync(Model::GetOpenIDConnectProviderRequest&& request, const GetOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about the specified managed policy, including the
          * policy's default version and the total number of IAM users, groups, and roles to
@@ -2726,6 +3401,18 @@ namespace Model
          */
         virtual void GetPolicyAsync(const Model::GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPolicyCallable(const Model::GetPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetPolicyOutcomeCallable GetPolicyCallable(Model::GetPolicyRequest&& request) const;
+
+        /**
+         * Same as GetPolicyAsync(const Model::GetPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetPolicyAsync(Model::GetPolicyRequest&& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about the specified version of the specified managed
          * policy, including the policy document.</p> <note> <p>Policies returned by this
@@ -2796,6 +3483,18 @@ namespace Model
          */
         virtual void GetPolicyVersionAsync(const Model::GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPolicyVersionCallable(const Model::GetPolicyVersionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetPolicyVersionOutcomeCallable GetPolicyVersionCallable(Model::GetPolicyVersionRequest&& request) const;
+
+        /**
+         * Same as GetPolicyVersionAsync(const Model::GetPolicyVersionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetPolicyVersionAsync(Model::GetPolicyVersionRequest&& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about the specified role, including the role's path,
          * GUID, ARN, and the role's trust policy that grants permission to assume the
@@ -2842,6 +3541,18 @@ namespace Model
          */
         virtual void GetRoleAsync(const Model::GetRoleRequest& request, const GetRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRoleCallable(const Model::GetRoleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetRoleOutcomeCallable GetRoleCallable(Model::GetRoleRequest&& request) const;
+
+        /**
+         * Same as GetRoleAsync(const Model::GetRoleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetRoleAsync(Model::GetRoleRequest&& request, const GetRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the specified inline policy document that is embedded with the
          * specified IAM role.</p> <note> <p>Policies returned by this API are URL-encoded
@@ -2906,6 +3617,18 @@ namespace Model
          */
         virtual void GetRolePolicyAsync(const Model::GetRolePolicyRequest& request, const GetRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRolePolicyCallable(const Model::GetRolePolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetRolePolicyOutcomeCallable GetRolePolicyCallable(Model::GetRolePolicyRequest&& request) const;
+
+        /**
+         * Same as GetRolePolicyAsync(const Model::GetRolePolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetRolePolicyAsync(Model::GetRolePolicyRequest&& request, const GetRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the SAML provider metadocument that was uploaded when the IAM SAML
          * provider resource object was created or updated.</p> <note> <p>This operation
@@ -2937,6 +3660,18 @@ namespace Model
          */
         virtual void GetSAMLProviderAsync(const Model::GetSAMLProviderRequest& request, const GetSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSAMLProviderCallable(const Model::GetSAMLProviderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetSAMLProviderOutcomeCallable GetSAMLProviderCallable(Model::GetSAMLProviderRequest&& request) const;
+
+        /**
+         * Same as GetSAMLProviderAsync(const Model::GetSAMLProviderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetSAMLProviderAsync(Model::GetSAMLProviderRequest&& request, const GetSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the specified SSH public key, including metadata about the key.</p>
          * <p>The SSH public key retrieved by this action is used only for authenticating
@@ -2974,6 +3709,18 @@ namespace Model
          */
         virtual void GetSSHPublicKeyAsync(const Model::GetSSHPublicKeyRequest& request, const GetSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSSHPublicKeyCallable(const Model::GetSSHPublicKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetSSHPublicKeyOutcomeCallable GetSSHPublicKeyCallable(Model::GetSSHPublicKeyRequest&& request) const;
+
+        /**
+         * Same as GetSSHPublicKeyAsync(const Model::GetSSHPublicKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetSSHPublicKeyAsync(Model::GetSSHPublicKeyRequest&& request, const GetSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about the specified server certificate stored in
          * IAM.</p> <p>For more information about working with server certificates,
@@ -3008,6 +3755,18 @@ namespace Model
          */
         virtual void GetServerCertificateAsync(const Model::GetServerCertificateRequest& request, const GetServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetServerCertificateCallable(const Model::GetServerCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetServerCertificateOutcomeCallable GetServerCertificateCallable(Model::GetServerCertificateRequest&& request) const;
+
+        /**
+         * Same as GetServerCertificateAsync(const Model::GetServerCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetServerCertificateAsync(Model::GetServerCertificateRequest&& request, const GetServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about the specified IAM user, including the user's
          * creation date, path, unique ID, and ARN.</p> <p>If you do not specify a user
@@ -3036,6 +3795,18 @@ namespace Model
          */
         virtual void GetUserAsync(const Model::GetUserRequest& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetUserCallable(const Model::GetUserRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetUserOutcomeCallable GetUserCallable(Model::GetUserRequest&& request) const;
+
+        /**
+         * Same as GetUserAsync(const Model::GetUserRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetUserAsync(Model::GetUserRequest&& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the specified inline policy document that is embedded in the
          * specified IAM user.</p> <note> <p>Policies returned by this API are URL-encoded
@@ -3091,6 +3862,18 @@ namespace Model
          */
         virtual void GetUserPolicyAsync(const Model::GetUserPolicyRequest& request, const GetUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetUserPolicyCallable(const Model::GetUserPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetUserPolicyOutcomeCallable GetUserPolicyCallable(Model::GetUserPolicyRequest&& request) const;
+
+        /**
+         * Same as GetUserPolicyAsync(const Model::GetUserPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetUserPolicyAsync(Model::GetUserPolicyRequest&& request, const GetUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the access key IDs associated with the specified
          * IAM user. If there are none, the action returns an empty list.</p> <p>Although
@@ -3137,6 +3920,18 @@ namespace Model
          */
         virtual void ListAccessKeysAsync(const Model::ListAccessKeysRequest& request, const ListAccessKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAccessKeysCallable(const Model::ListAccessKeysRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAccessKeysOutcomeCallable ListAccessKeysCallable(Model::ListAccessKeysRequest&& request) const;
+
+        /**
+         * Same as ListAccessKeysAsync(const Model::ListAccessKeysRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAccessKeysAsync(Model::ListAccessKeysRequest&& request, const ListAccessKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the account alias associated with the AWS account (Note: you can have
          * only one). For information about using an AWS account alias, see <a
@@ -3165,6 +3960,18 @@ namespace Model
          */
         virtual void ListAccountAliasesAsync(const Model::ListAccountAliasesRequest& request, const ListAccountAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAccountAliasesCallable(const Model::ListAccountAliasesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAccountAliasesOutcomeCallable ListAccountAliasesCallable(Model::ListAccountAliasesRequest&& request) const;
+
+        /**
+         * Same as ListAccountAliasesAsync(const Model::ListAccountAliasesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAccountAliasesAsync(Model::ListAccountAliasesRequest&& request, const ListAccountAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all managed policies that are attached to the specified IAM group.</p>
          * <p>An IAM group can also have inline policies embedded with it. To list the
@@ -3214,6 +4021,18 @@ namespace Model
          */
         virtual void ListAttachedGroupPoliciesAsync(const Model::ListAttachedGroupPoliciesRequest& request, const ListAttachedGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAttachedGroupPoliciesCallable(const Model::ListAttachedGroupPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAttachedGroupPoliciesOutcomeCallable ListAttachedGroupPoliciesCallable(Model::ListAttachedGroupPoliciesRequest&& request) const;
+
+        /**
+         * Same as ListAttachedGroupPoliciesAsync(const Model::ListAttachedGroupPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAttachedGroupPoliciesAsync(Model::ListAttachedGroupPoliciesRequest&& request, const ListAttachedGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all managed policies that are attached to the specified IAM role.</p>
          * <p>An IAM role can also have inline policies embedded with it. To list the
@@ -3263,6 +4082,18 @@ namespace Model
          */
         virtual void ListAttachedRolePoliciesAsync(const Model::ListAttachedRolePoliciesRequest& request, const ListAttachedRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAttachedRolePoliciesCallable(const Model::ListAttachedRolePoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAttachedRolePoliciesOutcomeCallable ListAttachedRolePoliciesCallable(Model::ListAttachedRolePoliciesRequest&& request) const;
+
+        /**
+         * Same as ListAttachedRolePoliciesAsync(const Model::ListAttachedRolePoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAttachedRolePoliciesAsync(Model::ListAttachedRolePoliciesRequest&& request, const ListAttachedRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all managed policies that are attached to the specified IAM user.</p>
          * <p>An IAM user can also have inline policies embedded with it. To list the
@@ -3312,6 +4143,18 @@ namespace Model
          */
         virtual void ListAttachedUserPoliciesAsync(const Model::ListAttachedUserPoliciesRequest& request, const ListAttachedUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAttachedUserPoliciesCallable(const Model::ListAttachedUserPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAttachedUserPoliciesOutcomeCallable ListAttachedUserPoliciesCallable(Model::ListAttachedUserPoliciesRequest&& request) const;
+
+        /**
+         * Same as ListAttachedUserPoliciesAsync(const Model::ListAttachedUserPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAttachedUserPoliciesAsync(Model::ListAttachedUserPoliciesRequest&& request, const ListAttachedUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all IAM users, groups, and roles that the specified managed policy is
          * attached to.</p> <p>You can use the optional <code>EntityFilter</code> parameter
@@ -3346,6 +4189,18 @@ namespace Model
          */
         virtual void ListEntitiesForPolicyAsync(const Model::ListEntitiesForPolicyRequest& request, const ListEntitiesForPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListEntitiesForPolicyCallable(const Model::ListEntitiesForPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListEntitiesForPolicyOutcomeCallable ListEntitiesForPolicyCallable(Model::ListEntitiesForPolicyRequest&& request) const;
+
+        /**
+         * Same as ListEntitiesForPolicyAsync(const Model::ListEntitiesForPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListEntitiesForPolicyAsync(Model::ListEntitiesForPolicyRequest&& request, const ListEntitiesForPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the names of the inline policies that are embedded in the specified IAM
          * group.</p> <p>An IAM group can also have managed policies attached to it. To
@@ -3389,6 +4244,18 @@ namespace Model
          */
         virtual void ListGroupPoliciesAsync(const Model::ListGroupPoliciesRequest& request, const ListGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListGroupPoliciesCallable(const Model::ListGroupPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListGroupPoliciesOutcomeCallable ListGroupPoliciesCallable(Model::ListGroupPoliciesRequest&& request) const;
+
+        /**
+         * Same as ListGroupPoliciesAsync(const Model::ListGroupPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListGroupPoliciesAsync(Model::ListGroupPoliciesRequest&& request, const ListGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the IAM groups that have the specified path prefix.</p> <p> You can
          * paginate the results using the <code>MaxItems</code> and <code>Marker</code>
@@ -3414,6 +4281,18 @@ namespace Model
          */
         virtual void ListGroupsAsync(const Model::ListGroupsRequest& request, const ListGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListGroupsCallable(const Model::ListGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListGroupsOutcomeCallable ListGroupsCallable(Model::ListGroupsRequest&& request) const;
+
+        /**
+         * Same as ListGroupsAsync(const Model::ListGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListGroupsAsync(Model::ListGroupsRequest&& request, const ListGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the IAM groups that the specified IAM user belongs to.</p> <p>You can
          * paginate the results using the <code>MaxItems</code> and <code>Marker</code>
@@ -3439,6 +4318,18 @@ namespace Model
          */
         virtual void ListGroupsForUserAsync(const Model::ListGroupsForUserRequest& request, const ListGroupsForUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListGroupsForUserCallable(const Model::ListGroupsForUserRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListGroupsForUserOutcomeCallable ListGroupsForUserCallable(Model::ListGroupsForUserRequest&& request) const;
+
+        /**
+         * Same as ListGroupsForUserAsync(const Model::ListGroupsForUserRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListGroupsForUserAsync(Model::ListGroupsForUserRequest&& request, const ListGroupsForUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the instance profiles that have the specified path prefix. If there are
          * none, the action returns an empty list. For more information about instance
@@ -3473,6 +4364,18 @@ namespace Model
          */
         virtual void ListInstanceProfilesAsync(const Model::ListInstanceProfilesRequest& request, const ListInstanceProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListInstanceProfilesCallable(const Model::ListInstanceProfilesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListInstanceProfilesOutcomeCallable ListInstanceProfilesCallable(Model::ListInstanceProfilesRequest&& request) const;
+
+        /**
+         * Same as ListInstanceProfilesAsync(const Model::ListInstanceProfilesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListInstanceProfilesAsync(Model::ListInstanceProfilesRequest&& request, const ListInstanceProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the instance profiles that have the specified associated IAM role. If
          * there are none, the action returns an empty list. For more information about
@@ -3507,6 +4410,18 @@ namespace Model
          */
         virtual void ListInstanceProfilesForRoleAsync(const Model::ListInstanceProfilesForRoleRequest& request, const ListInstanceProfilesForRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListInstanceProfilesForRoleCallable(const Model::ListInstanceProfilesForRoleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListInstanceProfilesForRoleOutcomeCallable ListInstanceProfilesForRoleCallable(Model::ListInstanceProfilesForRoleRequest&& request) const;
+
+        /**
+         * Same as ListInstanceProfilesForRoleAsync(const Model::ListInstanceProfilesForRoleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListInstanceProfilesForRoleAsync(Model::ListInstanceProfilesForRoleRequest&& request, const ListInstanceProfilesForRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the MFA devices for an IAM user. If the request includes a IAM user
          * name, then this action lists all the MFA devices associated with the specified
@@ -3541,6 +4456,18 @@ namespace Model
          */
         virtual void ListMFADevicesAsync(const Model::ListMFADevicesRequest& request, const ListMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListMFADevicesCallable(const Model::ListMFADevicesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListMFADevicesOutcomeCallable ListMFADevicesCallable(Model::ListMFADevicesRequest&& request) const;
+
+        /**
+         * Same as ListMFADevicesAsync(const Model::ListMFADevicesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListMFADevicesAsync(Model::ListMFADevicesRequest&& request, const ListMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists information about the IAM OpenID Connect (OIDC) provider resource
          * objects defined in the AWS account.</p>
@@ -3563,6 +4490,18 @@ namespace Model
          */
         virtual void ListOpenIDConnectProvidersAsync(const Model::ListOpenIDConnectProvidersRequest& request, const ListOpenIDConnectProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListOpenIDConnectProvidersCallable(const Model::ListOpenIDConnectProvidersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListOpenIDConnectProvidersOutcomeCallable ListOpenIDConnectProvidersCallable(Model::ListOpenIDConnectProvidersRequest&& request) const;
+
+        /**
+         * Same as ListOpenIDConnectProvidersAsync(const Model::ListOpenIDConnectProvidersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListOpenIDConnectProvidersAsync(Model::ListOpenIDConnectProvidersRequest&& request, const ListOpenIDConnectProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all the managed policies that are available in your AWS account,
          * including your own customer-defined managed policies and all AWS managed
@@ -3615,6 +4554,18 @@ namespace Model
          */
         virtual void ListPoliciesAsync(const Model::ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPoliciesCallable(const Model::ListPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListPoliciesOutcomeCallable ListPoliciesCallable(Model::ListPoliciesRequest&& request) const;
+
+        /**
+         * Same as ListPoliciesAsync(const Model::ListPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPoliciesAsync(Model::ListPoliciesRequest&& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists information about the versions of the specified managed policy,
          * including the version that is currently set as the policy's default version.</p>
@@ -3646,6 +4597,18 @@ namespace Model
          */
         virtual void ListPolicyVersionsAsync(const Model::ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPolicyVersionsCallable(const Model::ListPolicyVersionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListPolicyVersionsOutcomeCallable ListPolicyVersionsCallable(Model::ListPolicyVersionsRequest&& request) const;
+
+        /**
+         * Same as ListPolicyVersionsAsync(const Model::ListPolicyVersionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPolicyVersionsAsync(Model::ListPolicyVersionsRequest&& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the names of the inline policies that are embedded in the specified IAM
          * role.</p> <p>An IAM role can also have managed policies attached to it. To list
@@ -3689,6 +4652,18 @@ namespace Model
          */
         virtual void ListRolePoliciesAsync(const Model::ListRolePoliciesRequest& request, const ListRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRolePoliciesCallable(const Model::ListRolePoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListRolePoliciesOutcomeCallable ListRolePoliciesCallable(Model::ListRolePoliciesRequest&& request) const;
+
+        /**
+         * Same as ListRolePoliciesAsync(const Model::ListRolePoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListRolePoliciesAsync(Model::ListRolePoliciesRequest&& request, const ListRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the IAM roles that have the specified path prefix. If there are none,
          * the action returns an empty list. For more information about roles, go to <a
@@ -3720,6 +4695,18 @@ namespace Model
          */
         virtual void ListRolesAsync(const Model::ListRolesRequest& request, const ListRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRolesCallable(const Model::ListRolesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListRolesOutcomeCallable ListRolesCallable(Model::ListRolesRequest&& request) const;
+
+        /**
+         * Same as ListRolesAsync(const Model::ListRolesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListRolesAsync(Model::ListRolesRequest&& request, const ListRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the SAML provider resource objects defined in IAM in the account.</p>
          * <note> <p> This operation requires <a
@@ -3748,6 +4735,18 @@ namespace Model
          */
         virtual void ListSAMLProvidersAsync(const Model::ListSAMLProvidersRequest& request, const ListSAMLProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSAMLProvidersCallable(const Model::ListSAMLProvidersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListSAMLProvidersOutcomeCallable ListSAMLProvidersCallable(Model::ListSAMLProvidersRequest&& request) const;
+
+        /**
+         * Same as ListSAMLProvidersAsync(const Model::ListSAMLProvidersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListSAMLProvidersAsync(Model::ListSAMLProvidersRequest&& request, const ListSAMLProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the SSH public keys associated with the specified
          * IAM user. If there are none, the action returns an empty list.</p> <p>The SSH
@@ -3794,6 +4793,18 @@ namespace Model
          */
         virtual void ListSSHPublicKeysAsync(const Model::ListSSHPublicKeysRequest& request, const ListSSHPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSSHPublicKeysCallable(const Model::ListSSHPublicKeysRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListSSHPublicKeysOutcomeCallable ListSSHPublicKeysCallable(Model::ListSSHPublicKeysRequest&& request) const;
+
+        /**
+         * Same as ListSSHPublicKeysAsync(const Model::ListSSHPublicKeysRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListSSHPublicKeysAsync(Model::ListSSHPublicKeysRequest&& request, const ListSSHPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the server certificates stored in IAM that have the specified path
          * prefix. If none exist, the action returns an empty list.</p> <p> You can
@@ -3834,6 +4845,18 @@ namespace Model
          */
         virtual void ListServerCertificatesAsync(const Model::ListServerCertificatesRequest& request, const ListServerCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListServerCertificatesCallable(const Model::ListServerCertificatesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListServerCertificatesOutcomeCallable ListServerCertificatesCallable(Model::ListServerCertificatesRequest&& request) const;
+
+        /**
+         * Same as ListServerCertificatesAsync(const Model::ListServerCertificatesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListServerCertificatesAsync(Model::ListServerCertificatesRequest&& request, const ListServerCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the signing certificates associated with the
          * specified IAM user. If there are none, the action returns an empty list.</p>
@@ -3877,6 +4900,18 @@ namespace Model
          */
         virtual void ListSigningCertificatesAsync(const Model::ListSigningCertificatesRequest& request, const ListSigningCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSigningCertificatesCallable(const Model::ListSigningCertificatesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListSigningCertificatesOutcomeCallable ListSigningCertificatesCallable(Model::ListSigningCertificatesRequest&& request) const;
+
+        /**
+         * Same as ListSigningCertificatesAsync(const Model::ListSigningCertificatesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListSigningCertificatesAsync(Model::ListSigningCertificatesRequest&& request, const ListSigningCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the names of the inline policies embedded in the specified IAM
          * user.</p> <p>An IAM user can also have managed policies attached to it. To list
@@ -3920,6 +4955,18 @@ namespace Model
          */
         virtual void ListUserPoliciesAsync(const Model::ListUserPoliciesRequest& request, const ListUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListUserPoliciesCallable(const Model::ListUserPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListUserPoliciesOutcomeCallable ListUserPoliciesCallable(Model::ListUserPoliciesRequest&& request) const;
+
+        /**
+         * Same as ListUserPoliciesAsync(const Model::ListUserPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListUserPoliciesAsync(Model::ListUserPoliciesRequest&& request, const ListUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the IAM users that have the specified path prefix. If no path prefix is
          * specified, the action returns all users in the AWS account. If there are none,
@@ -3948,6 +4995,18 @@ namespace Model
          */
         virtual void ListUsersAsync(const Model::ListUsersRequest& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListUsersCallable(const Model::ListUsersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListUsersOutcomeCallable ListUsersCallable(Model::ListUsersRequest&& request) const;
+
+        /**
+         * Same as ListUsersAsync(const Model::ListUsersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListUsersAsync(Model::ListUsersRequest&& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the virtual MFA devices defined in the AWS account by assignment
          * status. If you do not specify an assignment status, the action returns a list of
@@ -3979,6 +5038,18 @@ namespace Model
          */
         virtual void ListVirtualMFADevicesAsync(const Model::ListVirtualMFADevicesRequest& request, const ListVirtualMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListVirtualMFADevicesCallable(const Model::ListVirtualMFADevicesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListVirtualMFADevicesOutcomeCallable ListVirtualMFADevicesCallable(Model::ListVirtualMFADevicesRequest&& request) const;
+
+        /**
+         * Same as ListVirtualMFADevicesAsync(const Model::ListVirtualMFADevicesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListVirtualMFADevicesAsync(Model::ListVirtualMFADevicesRequest&& request, const ListVirtualMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds or updates an inline policy document that is embedded in the specified
          * IAM group.</p> <p>A user can also have managed policies attached to it. To
@@ -4043,6 +5114,18 @@ namespace Model
          */
         virtual void PutGroupPolicyAsync(const Model::PutGroupPolicyRequest& request, const PutGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutGroupPolicyCallable(const Model::PutGroupPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutGroupPolicyOutcomeCallable PutGroupPolicyCallable(Model::PutGroupPolicyRequest&& request) const;
+
+        /**
+         * Same as PutGroupPolicyAsync(const Model::PutGroupPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutGroupPolicyAsync(Model::PutGroupPolicyRequest&& request, const PutGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds or updates an inline policy document that is embedded in the specified
          * IAM role.</p> <p>When you embed an inline policy in a role, the inline policy is
@@ -4125,6 +5208,18 @@ namespace Model
          */
         virtual void PutRolePolicyAsync(const Model::PutRolePolicyRequest& request, const PutRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRolePolicyCallable(const Model::PutRolePolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutRolePolicyOutcomeCallable PutRolePolicyCallable(Model::PutRolePolicyRequest&& request) const;
+
+        /**
+         * Same as PutRolePolicyAsync(const Model::PutRolePolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutRolePolicyAsync(Model::PutRolePolicyRequest&& request, const PutRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds or updates an inline policy document that is embedded in the specified
          * IAM user.</p> <p>An IAM user can also have a managed policy attached to it. To
@@ -4186,6 +5281,18 @@ namespace Model
          */
         virtual void PutUserPolicyAsync(const Model::PutUserPolicyRequest& request, const PutUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutUserPolicyCallable(const Model::PutUserPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutUserPolicyOutcomeCallable PutUserPolicyCallable(Model::PutUserPolicyRequest&& request) const;
+
+        /**
+         * Same as PutUserPolicyAsync(const Model::PutUserPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutUserPolicyAsync(Model::PutUserPolicyRequest&& request, const PutUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified client ID (also known as audience) from the list of
          * client IDs registered for the specified IAM OpenID Connect (OIDC) provider
@@ -4214,6 +5321,18 @@ namespace Model
          */
         virtual void RemoveClientIDFromOpenIDConnectProviderAsync(const Model::RemoveClientIDFromOpenIDConnectProviderRequest& request, const RemoveClientIDFromOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveClientIDFromOpenIDConnectProviderCallable(const Model::RemoveClientIDFromOpenIDConnectProviderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveClientIDFromOpenIDConnectProviderOutcomeCallable RemoveClientIDFromOpenIDConnectProviderCallable(Model::RemoveClientIDFromOpenIDConnectProviderRequest&& request) const;
+
+        /**
+         * Same as RemoveClientIDFromOpenIDConnectProviderAsync(const Model::RemoveClientIDFromOpenIDConnectProviderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveClientIDFromOpenIDConnectProviderAsync(Model::RemoveClientIDFromOpenIDConnectProviderRequest&& request, const RemoveClientIDFromOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified IAM role from the specified EC2 instance profile.</p>
          * <important> <p>Make sure you do not have any Amazon EC2 instances running with
@@ -4260,6 +5379,18 @@ namespace Model
          */
         virtual void RemoveRoleFromInstanceProfileAsync(const Model::RemoveRoleFromInstanceProfileRequest& request, const RemoveRoleFromInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveRoleFromInstanceProfileCallable(const Model::RemoveRoleFromInstanceProfileRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveRoleFromInstanceProfileOutcomeCallable RemoveRoleFromInstanceProfileCallable(Model::RemoveRoleFromInstanceProfileRequest&& request) const;
+
+        /**
+         * Same as RemoveRoleFromInstanceProfileAsync(const Model::RemoveRoleFromInstanceProfileRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveRoleFromInstanceProfileAsync(Model::RemoveRoleFromInstanceProfileRequest&& request, const RemoveRoleFromInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified user from the specified group.</p>
          */
@@ -4279,6 +5410,18 @@ namespace Model
          */
         virtual void RemoveUserFromGroupAsync(const Model::RemoveUserFromGroupRequest& request, const RemoveUserFromGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveUserFromGroupCallable(const Model::RemoveUserFromGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveUserFromGroupOutcomeCallable RemoveUserFromGroupCallable(Model::RemoveUserFromGroupRequest&& request) const;
+
+        /**
+         * Same as RemoveUserFromGroupAsync(const Model::RemoveUserFromGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveUserFromGroupAsync(Model::RemoveUserFromGroupRequest&& request, const RemoveUserFromGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Synchronizes the specified MFA device with its IAM resource object on the AWS
          * servers.</p> <p>For more information about creating and working with virtual MFA
@@ -4310,6 +5453,18 @@ namespace Model
          */
         virtual void ResyncMFADeviceAsync(const Model::ResyncMFADeviceRequest& request, const ResyncMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResyncMFADeviceCallable(const Model::ResyncMFADeviceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResyncMFADeviceOutcomeCallable ResyncMFADeviceCallable(Model::ResyncMFADeviceRequest&& request) const;
+
+        /**
+         * Same as ResyncMFADeviceAsync(const Model::ResyncMFADeviceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResyncMFADeviceAsync(Model::ResyncMFADeviceRequest&& request, const ResyncMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the specified version of the specified policy as the policy's default
          * (operative) version.</p> <p>This action affects all users, groups, and roles
@@ -4347,6 +5502,18 @@ namespace Model
          */
         virtual void SetDefaultPolicyVersionAsync(const Model::SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetDefaultPolicyVersionCallable(const Model::SetDefaultPolicyVersionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetDefaultPolicyVersionOutcomeCallable SetDefaultPolicyVersionCallable(Model::SetDefaultPolicyVersionRequest&& request) const;
+
+        /**
+         * Same as SetDefaultPolicyVersionAsync(const Model::SetDefaultPolicyVersionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetDefaultPolicyVersionAsync(Model::SetDefaultPolicyVersionRequest&& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Simulate how a set of IAM policies and optionally a resource-based policy
          * works with a list of API actions and AWS resources to determine the policies'
@@ -4405,6 +5572,18 @@ namespace Model
          */
         virtual void SimulateCustomPolicyAsync(const Model::SimulateCustomPolicyRequest& request, const SimulateCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SimulateCustomPolicyCallable(const Model::SimulateCustomPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SimulateCustomPolicyOutcomeCallable SimulateCustomPolicyCallable(Model::SimulateCustomPolicyRequest&& request) const;
+
+        /**
+         * Same as SimulateCustomPolicyAsync(const Model::SimulateCustomPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SimulateCustomPolicyAsync(Model::SimulateCustomPolicyRequest&& request, const SimulateCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Simulate how a set of IAM policies attached to an IAM entity works with a
          * list of API actions and AWS resources to determine the policies' effective
@@ -4484,6 +5663,18 @@ namespace Model
          */
         virtual void SimulatePrincipalPolicyAsync(const Model::SimulatePrincipalPolicyRequest& request, const SimulatePrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SimulatePrincipalPolicyCallable(const Model::SimulatePrincipalPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SimulatePrincipalPolicyOutcomeCallable SimulatePrincipalPolicyCallable(Model::SimulatePrincipalPolicyRequest&& request) const;
+
+        /**
+         * Same as SimulatePrincipalPolicyAsync(const Model::SimulatePrincipalPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SimulatePrincipalPolicyAsync(Model::SimulatePrincipalPolicyRequest&& request, const SimulatePrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the status of the specified access key from Active to Inactive, or
          * vice versa. This action can be used to disable a user's key as part of a key
@@ -4530,6 +5721,18 @@ namespace Model
          */
         virtual void UpdateAccessKeyAsync(const Model::UpdateAccessKeyRequest& request, const UpdateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAccessKeyCallable(const Model::UpdateAccessKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateAccessKeyOutcomeCallable UpdateAccessKeyCallable(Model::UpdateAccessKeyRequest&& request) const;
+
+        /**
+         * Same as UpdateAccessKeyAsync(const Model::UpdateAccessKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateAccessKeyAsync(Model::UpdateAccessKeyRequest&& request, const UpdateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the password policy settings for the AWS account.</p> <note> <p>This
          * action does not support partial updates. No parameters are required, but if you
@@ -4570,6 +5773,18 @@ namespace Model
          */
         virtual void UpdateAccountPasswordPolicyAsync(const Model::UpdateAccountPasswordPolicyRequest& request, const UpdateAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAccountPasswordPolicyCallable(const Model::UpdateAccountPasswordPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateAccountPasswordPolicyOutcomeCallable UpdateAccountPasswordPolicyCallable(Model::UpdateAccountPasswordPolicyRequest&& request) const;
+
+        /**
+         * Same as UpdateAccountPasswordPolicyAsync(const Model::UpdateAccountPasswordPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateAccountPasswordPolicyAsync(Model::UpdateAccountPasswordPolicyRequest&& request, const UpdateAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the policy that grants an IAM entity permission to assume a role.
          * This is typically referred to as the "role trust policy". For more information
@@ -4601,6 +5816,18 @@ namespace Model
          */
         virtual void UpdateAssumeRolePolicyAsync(const Model::UpdateAssumeRolePolicyRequest& request, const UpdateAssumeRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAssumeRolePolicyCallable(const Model::UpdateAssumeRolePolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateAssumeRolePolicyOutcomeCallable UpdateAssumeRolePolicyCallable(Model::UpdateAssumeRolePolicyRequest&& request) const;
+
+        /**
+         * Same as UpdateAssumeRolePolicyAsync(const Model::UpdateAssumeRolePolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateAssumeRolePolicyAsync(Model::UpdateAssumeRolePolicyRequest&& request, const UpdateAssumeRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the name and/or the path of the specified IAM group.</p> <important>
          * <p> You should understand the implications of changing a group's path or name.
@@ -4653,6 +5880,18 @@ namespace Model
          */
         virtual void UpdateGroupAsync(const Model::UpdateGroupRequest& request, const UpdateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateGroupCallable(const Model::UpdateGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateGroupOutcomeCallable UpdateGroupCallable(Model::UpdateGroupRequest&& request) const;
+
+        /**
+         * Same as UpdateGroupAsync(const Model::UpdateGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateGroupAsync(Model::UpdateGroupRequest&& request, const UpdateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the password for the specified IAM user.</p> <p>IAM users can change
          * their own passwords by calling <a>ChangePassword</a>. For more information about
@@ -4684,6 +5923,18 @@ namespace Model
          */
         virtual void UpdateLoginProfileAsync(const Model::UpdateLoginProfileRequest& request, const UpdateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateLoginProfileCallable(const Model::UpdateLoginProfileRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateLoginProfileOutcomeCallable UpdateLoginProfileCallable(Model::UpdateLoginProfileRequest&& request) const;
+
+        /**
+         * Same as UpdateLoginProfileAsync(const Model::UpdateLoginProfileRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateLoginProfileAsync(Model::UpdateLoginProfileRequest&& request, const UpdateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Replaces the existing list of server certificate thumbprints associated with
          * an OpenID Connect (OIDC) provider resource object with a new list of
@@ -4736,6 +5987,18 @@ namespace Model
          */
         virtual void UpdateOpenIDConnectProviderThumbprintAsync(const Model::UpdateOpenIDConnectProviderThumbprintRequest& request, const UpdateOpenIDConnectProviderThumbprintResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateOpenIDConnectProviderThumbprintCallable(const Model::UpdateOpenIDConnectProviderThumbprintRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateOpenIDConnectProviderThumbprintOutcomeCallable UpdateOpenIDConnectProviderThumbprintCallable(Model::UpdateOpenIDConnectProviderThumbprintRequest&& request) const;
+
+        /**
+         * Same as UpdateOpenIDConnectProviderThumbprintAsync(const Model::UpdateOpenIDConnectProviderThumbprintRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateOpenIDConnectProviderThumbprintAsync(Model::UpdateOpenIDConnectProviderThumbprintRequest&& request, const UpdateOpenIDConnectProviderThumbprintResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the metadata document for an existing SAML provider resource
          * object.</p> <note> <p>This operation requires <a
@@ -4764,6 +6027,18 @@ namespace Model
          */
         virtual void UpdateSAMLProviderAsync(const Model::UpdateSAMLProviderRequest& request, const UpdateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateSAMLProviderCallable(const Model::UpdateSAMLProviderRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateSAMLProviderOutcomeCallable UpdateSAMLProviderCallable(Model::UpdateSAMLProviderRequest&& request) const;
+
+        /**
+         * Same as UpdateSAMLProviderAsync(const Model::UpdateSAMLProviderRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateSAMLProviderAsync(Model::UpdateSAMLProviderRequest&& request, const UpdateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the status of an IAM user's SSH public key to active or inactive. SSH
          * public keys that are inactive cannot be used for authentication. This action can
@@ -4810,6 +6085,18 @@ namespace Model
          */
         virtual void UpdateSSHPublicKeyAsync(const Model::UpdateSSHPublicKeyRequest& request, const UpdateSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateSSHPublicKeyCallable(const Model::UpdateSSHPublicKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateSSHPublicKeyOutcomeCallable UpdateSSHPublicKeyCallable(Model::UpdateSSHPublicKeyRequest&& request) const;
+
+        /**
+         * Same as UpdateSSHPublicKeyAsync(const Model::UpdateSSHPublicKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateSSHPublicKeyAsync(Model::UpdateSSHPublicKeyRequest&& request, const UpdateSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the name and/or the path of the specified server certificate stored
          * in IAM.</p> <p>For more information about working with server certificates,
@@ -4877,6 +6164,18 @@ namespace Model
          */
         virtual void UpdateServerCertificateAsync(const Model::UpdateServerCertificateRequest& request, const UpdateServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateServerCertificateCallable(const Model::UpdateServerCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateServerCertificateOutcomeCallable UpdateServerCertificateCallable(Model::UpdateServerCertificateRequest&& request) const;
+
+        /**
+         * Same as UpdateServerCertificateAsync(const Model::UpdateServerCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateServerCertificateAsync(Model::UpdateServerCertificateRequest&& request, const UpdateServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the status of the specified user signing certificate from active to
          * disabled, or vice versa. This action can be used to disable an IAM user's
@@ -4914,6 +6213,18 @@ namespace Model
          */
         virtual void UpdateSigningCertificateAsync(const Model::UpdateSigningCertificateRequest& request, const UpdateSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateSigningCertificateCallable(const Model::UpdateSigningCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateSigningCertificateOutcomeCallable UpdateSigningCertificateCallable(Model::UpdateSigningCertificateRequest&& request) const;
+
+        /**
+         * Same as UpdateSigningCertificateAsync(const Model::UpdateSigningCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateSigningCertificateAsync(Model::UpdateSigningCertificateRequest&& request, const UpdateSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the name and/or the path of the specified IAM user.</p> <important>
          * <p> You should understand the implications of changing an IAM user's path or
@@ -4969,6 +6280,18 @@ namespace Model
          */
         virtual void UpdateUserAsync(const Model::UpdateUserRequest& request, const UpdateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateUserCallable(const Model::UpdateUserRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateUserOutcomeCallable UpdateUserCallable(Model::UpdateUserRequest&& request) const;
+
+        /**
+         * Same as UpdateUserAsync(const Model::UpdateUserRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateUserAsync(Model::UpdateUserRequest&& request, const UpdateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Uploads an SSH public key and associates it with the specified IAM user.</p>
          * <p>The SSH public key uploaded by this action can be used only for
@@ -5009,6 +6332,18 @@ namespace Model
          */
         virtual void UploadSSHPublicKeyAsync(const Model::UploadSSHPublicKeyRequest& request, const UploadSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadSSHPublicKeyCallable(const Model::UploadSSHPublicKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UploadSSHPublicKeyOutcomeCallable UploadSSHPublicKeyCallable(Model::UploadSSHPublicKeyRequest&& request) const;
+
+        /**
+         * Same as UploadSSHPublicKeyAsync(const Model::UploadSSHPublicKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UploadSSHPublicKeyAsync(Model::UploadSSHPublicKeyRequest&& request, const UploadSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Uploads a server certificate entity for the AWS account. The server
          * certificate entity includes a public key certificate, a private key, and an
@@ -5085,6 +6420,18 @@ namespace Model
          */
         virtual void UploadServerCertificateAsync(const Model::UploadServerCertificateRequest& request, const UploadServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadServerCertificateCallable(const Model::UploadServerCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UploadServerCertificateOutcomeCallable UploadServerCertificateCallable(Model::UploadServerCertificateRequest&& request) const;
+
+        /**
+         * Same as UploadServerCertificateAsync(const Model::UploadServerCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UploadServerCertificateAsync(Model::UploadServerCertificateRequest&& request, const UploadServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Uploads an X.509 signing certificate and associates it with the specified IAM
          * user. Some AWS services use X.509 signing certificates to validate requests that
@@ -5149,6 +6496,715 @@ namespace Model
          */
         virtual void UploadSigningCertificateAsync(const Model::UploadSigningCertificateRequest& request, const UploadSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadSigningCertificateCallable(const Model::UploadSigningCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UploadSigningCertificateOutcomeCallable UploadSigningCertificateCallable(Model::UploadSigningCertificateRequest&& request) const;
+
+        /**
+         * Same as UploadSigningCertificateAsync(const Model::UploadSigningCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UploadSigningCertificateAsync(Model::UploadSigningCertificateRequest&& request, const UploadSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through GetAccountAuthorizationDetails(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::GetAccountAuthorizationDetailsRequest, Model::GetAccountAuthorizationDetailsOutcome> GetAccountAuthorizationDetailsPaginator(const Model::GetAccountAuthorizationDetailsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through GetGroup(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::GetGroupRequest, Model::GetGroupOutcome> GetGroupPaginator(const Model::GetGroupRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListAccessKeys(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListAccessKeysRequest, Model::ListAccessKeysOutcome> ListAccessKeysPaginator(const Model::ListAccessKeysRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListAccountAliases(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListAccountAliasesRequest, Model::ListAccountAliasesOutcome> ListAccountAliasesPaginator(const Model::ListAccountAliasesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListAttachedGroupPolicies(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListAttachedGroupPoliciesRequest, Model::ListAttachedGroupPoliciesOutcome> ListAttachedGroupPoliciesPaginator(const Model::ListAttachedGroupPoliciesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListAttachedRolePolicies(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListAttachedRolePoliciesRequest, Model::ListAttachedRolePoliciesOutcome> ListAttachedRolePoliciesPaginator(const Model::ListAttachedRolePoliciesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListAttachedUserPolicies(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListAttachedUserPoliciesRequest, Model::ListAttachedUserPoliciesOutcome> ListAttachedUserPoliciesPaginator(const Model::ListAttachedUserPoliciesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListEntitiesForPolicy(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListEntitiesForPolicyRequest, Model::ListEntitiesForPolicyOutcome> ListEntitiesForPolicyPaginator(const Model::ListEntitiesForPolicyRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListGroupPolicies(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListGroupPoliciesRequest, Model::ListGroupPoliciesOutcome> ListGroupPoliciesPaginator(const Model::ListGroupPoliciesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListGroups(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListGroupsRequest, Model::ListGroupsOutcome> ListGroupsPaginator(const Model::ListGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListGroupsForUser(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListGroupsForUserRequest, Model::ListGroupsForUserOutcome> ListGroupsForUserPaginator(const Model::ListGroupsForUserRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListInstanceProfiles(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListInstanceProfilesRequest, Model::ListInstanceProfilesOutcome> ListInstanceProfilesPaginator(const Model::ListInstanceProfilesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListInstanceProfilesForRole(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListInstanceProfilesForRoleRequest, Model::ListInstanceProfilesForRoleOutcome> ListInstanceProfilesForRolePaginator(const Model::ListInstanceProfilesForRoleRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListMFADevices(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListMFADevicesRequest, Model::ListMFADevicesOutcome> ListMFADevicesPaginator(const Model::ListMFADevicesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListPolicies(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListPoliciesRequest, Model::ListPoliciesOutcome> ListPoliciesPaginator(const Model::ListPoliciesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListPolicyVersions(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListPolicyVersionsRequest, Model::ListPolicyVersionsOutcome> ListPolicyVersionsPaginator(const Model::ListPolicyVersionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListRolePolicies(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListRolePoliciesRequest, Model::ListRolePoliciesOutcome> ListRolePoliciesPaginator(const Model::ListRolePoliciesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListRoles(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListRolesRequest, Model::ListRolesOutcome> ListRolesPaginator(const Model::ListRolesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListSSHPublicKeys(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListSSHPublicKeysRequest, Model::ListSSHPublicKeysOutcome> ListSSHPublicKeysPaginator(const Model::ListSSHPublicKeysRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListServerCertificates(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListServerCertificatesRequest, Model::ListServerCertificatesOutcome> ListServerCertificatesPaginator(const Model::ListServerCertificatesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListSigningCertificates(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListSigningCertificatesRequest, Model::ListSigningCertificatesOutcome> ListSigningCertificatesPaginator(const Model::ListSigningCertificatesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListUserPolicies(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListUserPoliciesRequest, Model::ListUserPoliciesOutcome> ListUserPoliciesPaginator(const Model::ListUserPoliciesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListUsers(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListUsersRequest, Model::ListUsersOutcome> ListUsersPaginator(const Model::ListUsersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListVirtualMFADevices(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::ListVirtualMFADevicesRequest, Model::ListVirtualMFADevicesOutcome> ListVirtualMFADevicesPaginator(const Model::ListVirtualMFADevicesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through SimulateCustomPolicy(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::SimulateCustomPolicyRequest, Model::SimulateCustomPolicyOutcome> SimulateCustomPolicyPaginator(const Model::SimulateCustomPolicyRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through SimulatePrincipalPolicy(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IAMClient, Model::SimulatePrincipalPolicyRequest, Model::SimulatePrincipalPolicyOutcome> SimulatePrincipalPolicyPaginator(const Model::SimulatePrincipalPolicyRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddClientIDToOpenIDConnectProvider(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::AddClientIDToOpenIDConnectProviderRequest, Model::AddClientIDToOpenIDConnectProviderOutcome> AddClientIDToOpenIDConnectProviderAwaitable(Model::AddClientIDToOpenIDConnectProviderRequest request) const;
+
+        /**
+         * co_await-able form of AddRoleToInstanceProfile(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::AddRoleToInstanceProfileRequest, Model::AddRoleToInstanceProfileOutcome> AddRoleToInstanceProfileAwaitable(Model::AddRoleToInstanceProfileRequest request) const;
+
+        /**
+         * co_await-able form of AddUserToGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::AddUserToGroupRequest, Model::AddUserToGroupOutcome> AddUserToGroupAwaitable(Model::AddUserToGroupRequest request) const;
+
+        /**
+         * co_await-able form of AttachGroupPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::AttachGroupPolicyRequest, Model::AttachGroupPolicyOutcome> AttachGroupPolicyAwaitable(Model::AttachGroupPolicyRequest request) const;
+
+        /**
+         * co_await-able form of AttachRolePolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::AttachRolePolicyRequest, Model::AttachRolePolicyOutcome> AttachRolePolicyAwaitable(Model::AttachRolePolicyRequest request) const;
+
+        /**
+         * co_await-able form of AttachUserPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::AttachUserPolicyRequest, Model::AttachUserPolicyOutcome> AttachUserPolicyAwaitable(Model::AttachUserPolicyRequest request) const;
+
+        /**
+         * co_await-able form of ChangePassword(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ChangePasswordRequest, Model::ChangePasswordOutcome> ChangePasswordAwaitable(Model::ChangePasswordRequest request) const;
+
+        /**
+         * co_await-able form of CreateAccessKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::CreateAccessKeyRequest, Model::CreateAccessKeyOutcome> CreateAccessKeyAwaitable(Model::CreateAccessKeyRequest request) const;
+
+        /**
+         * co_await-able form of CreateAccountAlias(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::CreateAccountAliasRequest, Model::CreateAccountAliasOutcome> CreateAccountAliasAwaitable(Model::CreateAccountAliasRequest request) const;
+
+        /**
+         * co_await-able form of CreateGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::CreateGroupRequest, Model::CreateGroupOutcome> CreateGroupAwaitable(Model::CreateGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateInstanceProfile(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::CreateInstanceProfileRequest, Model::CreateInstanceProfileOutcome> CreateInstanceProfileAwaitable(Model::CreateInstanceProfileRequest request) const;
+
+        /**
+         * co_await-able form of CreateLoginProfile(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::CreateLoginProfileRequest, Model::CreateLoginProfileOutcome> CreateLoginProfileAwaitable(Model::CreateLoginProfileRequest request) const;
+
+        /**
+         * co_await-able form of CreateOpenIDConnectProvider(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::CreateOpenIDConnectProviderRequest, Model::CreateOpenIDConnectProviderOutcome> CreateOpenIDConnectProviderAwaitable(Model::CreateOpenIDConnectProviderRequest request) const;
+
+        /**
+         * co_await-able form of CreatePolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::CreatePolicyRequest, Model::CreatePolicyOutcome> CreatePolicyAwaitable(Model::CreatePolicyRequest request) const;
+
+        /**
+         * co_await-able form of CreatePolicyVersion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::CreatePolicyVersionRequest, Model::CreatePolicyVersionOutcome> CreatePolicyVersionAwaitable(Model::CreatePolicyVersionRequest request) const;
+
+        /**
+         * co_await-able form of CreateRole(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::CreateRoleRequest, Model::CreateRoleOutcome> CreateRoleAwaitable(Model::CreateRoleRequest request) const;
+
+        /**
+         * co_await-able form of CreateSAMLProvider(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::CreateSAMLProviderRequest, Model::CreateSAMLProviderOutcome> CreateSAMLProviderAwaitable(Model::CreateSAMLProviderRequest request) const;
+
+        /**
+         * co_await-able form of CreateUser(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::CreateUserRequest, Model::CreateUserOutcome> CreateUserAwaitable(Model::CreateUserRequest request) const;
+
+        /**
+         * co_await-able form of CreateVirtualMFADevice(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::CreateVirtualMFADeviceRequest, Model::CreateVirtualMFADeviceOutcome> CreateVirtualMFADeviceAwaitable(Model::CreateVirtualMFADeviceRequest request) const;
+
+        /**
+         * co_await-able form of DeactivateMFADevice(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeactivateMFADeviceRequest, Model::DeactivateMFADeviceOutcome> DeactivateMFADeviceAwaitable(Model::DeactivateMFADeviceRequest request) const;
+
+        /**
+         * co_await-able form of DeleteAccessKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteAccessKeyRequest, Model::DeleteAccessKeyOutcome> DeleteAccessKeyAwaitable(Model::DeleteAccessKeyRequest request) const;
+
+        /**
+         * co_await-able form of DeleteAccountAlias(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteAccountAliasRequest, Model::DeleteAccountAliasOutcome> DeleteAccountAliasAwaitable(Model::DeleteAccountAliasRequest request) const;
+
+        /**
+         * co_await-able form of DeleteAccountPasswordPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteAccountPasswordPolicyRequest, Model::DeleteAccountPasswordPolicyOutcome> DeleteAccountPasswordPolicyAwaitable(Model::DeleteAccountPasswordPolicyRequest request) const;
+
+        /**
+         * co_await-able form of DeleteGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteGroupRequest, Model::DeleteGroupOutcome> DeleteGroupAwaitable(Model::DeleteGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteGroupPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteGroupPolicyRequest, Model::DeleteGroupPolicyOutcome> DeleteGroupPolicyAwaitable(Model::DeleteGroupPolicyRequest request) const;
+
+        /**
+         * co_await-able form of DeleteInstanceProfile(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteInstanceProfileRequest, Model::DeleteInstanceProfileOutcome> DeleteInstanceProfileAwaitable(Model::DeleteInstanceProfileRequest request) const;
+
+        /**
+         * co_await-able form of DeleteLoginProfile(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteLoginProfileRequest, Model::DeleteLoginProfileOutcome> DeleteLoginProfileAwaitable(Model::DeleteLoginProfileRequest request) const;
+
+        /**
+         * co_await-able form of DeleteOpenIDConnectProvider(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteOpenIDConnectProviderRequest, Model::DeleteOpenIDConnectProviderOutcome> DeleteOpenIDConnectProviderAwaitable(Model::DeleteOpenIDConnectProviderRequest request) const;
+
+        /**
+         * co_await-able form of DeletePolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeletePolicyRequest, Model::DeletePolicyOutcome> DeletePolicyAwaitable(Model::DeletePolicyRequest request) const;
+
+        /**
+         * co_await-able form of DeletePolicyVersion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeletePolicyVersionRequest, Model::DeletePolicyVersionOutcome> DeletePolicyVersionAwaitable(Model::DeletePolicyVersionRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRole(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteRoleRequest, Model::DeleteRoleOutcome> DeleteRoleAwaitable(Model::DeleteRoleRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRolePolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteRolePolicyRequest, Model::DeleteRolePolicyOutcome> DeleteRolePolicyAwaitable(Model::DeleteRolePolicyRequest request) const;
+
+        /**
+         * co_await-able form of DeleteSAMLProvider(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteSAMLProviderRequest, Model::DeleteSAMLProviderOutcome> DeleteSAMLProviderAwaitable(Model::DeleteSAMLProviderRequest request) const;
+
+        /**
+         * co_await-able form of DeleteSSHPublicKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteSSHPublicKeyRequest, Model::DeleteSSHPublicKeyOutcome> DeleteSSHPublicKeyAwaitable(Model::DeleteSSHPublicKeyRequest request) const;
+
+        /**
+         * co_await-able form of DeleteServerCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteServerCertificateRequest, Model::DeleteServerCertificateOutcome> DeleteServerCertificateAwaitable(Model::DeleteServerCertificateRequest request) const;
+
+        /**
+         * co_await-able form of DeleteSigningCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteSigningCertificateRequest, Model::DeleteSigningCertificateOutcome> DeleteSigningCertificateAwaitable(Model::DeleteSigningCertificateRequest request) const;
+
+        /**
+         * co_await-able form of DeleteUser(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteUserRequest, Model::DeleteUserOutcome> DeleteUserAwaitable(Model::DeleteUserRequest request) const;
+
+        /**
+         * co_await-able form of DeleteUserPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteUserPolicyRequest, Model::DeleteUserPolicyOutcome> DeleteUserPolicyAwaitable(Model::DeleteUserPolicyRequest request) const;
+
+        /**
+         * co_await-able form of DeleteVirtualMFADevice(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DeleteVirtualMFADeviceRequest, Model::DeleteVirtualMFADeviceOutcome> DeleteVirtualMFADeviceAwaitable(Model::DeleteVirtualMFADeviceRequest request) const;
+
+        /**
+         * co_await-able form of DetachGroupPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DetachGroupPolicyRequest, Model::DetachGroupPolicyOutcome> DetachGroupPolicyAwaitable(Model::DetachGroupPolicyRequest request) const;
+
+        /**
+         * co_await-able form of DetachRolePolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DetachRolePolicyRequest, Model::DetachRolePolicyOutcome> DetachRolePolicyAwaitable(Model::DetachRolePolicyRequest request) const;
+
+        /**
+         * co_await-able form of DetachUserPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::DetachUserPolicyRequest, Model::DetachUserPolicyOutcome> DetachUserPolicyAwaitable(Model::DetachUserPolicyRequest request) const;
+
+        /**
+         * co_await-able form of EnableMFADevice(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::EnableMFADeviceRequest, Model::EnableMFADeviceOutcome> EnableMFADeviceAwaitable(Model::EnableMFADeviceRequest request) const;
+
+        /**
+         * co_await-able form of GenerateCredentialReport(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GenerateCredentialReportRequest, Model::GenerateCredentialReportOutcome> GenerateCredentialReportAwaitable(Model::GenerateCredentialReportRequest request) const;
+
+        /**
+         * co_await-able form of GetAccessKeyLastUsed(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetAccessKeyLastUsedRequest, Model::GetAccessKeyLastUsedOutcome> GetAccessKeyLastUsedAwaitable(Model::GetAccessKeyLastUsedRequest request) const;
+
+        /**
+         * co_await-able form of GetAccountAuthorizationDetails(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetAccountAuthorizationDetailsRequest, Model::GetAccountAuthorizationDetailsOutcome> GetAccountAuthorizationDetailsAwaitable(Model::GetAccountAuthorizationDetailsRequest request) const;
+
+        /**
+         * co_await-able form of GetAccountPasswordPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetAccountPasswordPolicyRequest, Model::GetAccountPasswordPolicyOutcome> GetAccountPasswordPolicyAwaitable(Model::GetAccountPasswordPolicyRequest request) const;
+
+        /**
+         * co_await-able form of GetAccountSummary(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetAccountSummaryRequest, Model::GetAccountSummaryOutcome> GetAccountSummaryAwaitable(Model::GetAccountSummaryRequest request) const;
+
+        /**
+         * co_await-able form of GetContextKeysForCustomPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetContextKeysForCustomPolicyRequest, Model::GetContextKeysForCustomPolicyOutcome> GetContextKeysForCustomPolicyAwaitable(Model::GetContextKeysForCustomPolicyRequest request) const;
+
+        /**
+         * co_await-able form of GetContextKeysForPrincipalPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetContextKeysForPrincipalPolicyRequest, Model::GetContextKeysForPrincipalPolicyOutcome> GetContextKeysForPrincipalPolicyAwaitable(Model::GetContextKeysForPrincipalPolicyRequest request) const;
+
+        /**
+         * co_await-able form of GetCredentialReport(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetCredentialReportRequest, Model::GetCredentialReportOutcome> GetCredentialReportAwaitable(Model::GetCredentialReportRequest request) const;
+
+        /**
+         * co_await-able form of GetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetGroupRequest, Model::GetGroupOutcome> GetGroupAwaitable(Model::GetGroupRequest request) const;
+
+        /**
+         * co_await-able form of GetGroupPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetGroupPolicyRequest, Model::GetGroupPolicyOutcome> GetGroupPolicyAwaitable(Model::GetGroupPolicyRequest request) const;
+
+        /**
+         * co_await-able form of GetInstanceProfile(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetInstanceProfileRequest, Model::GetInstanceProfileOutcome> GetInstanceProfileAwaitable(Model::GetInstanceProfileRequest request) const;
+
+        /**
+         * co_await-able form of GetLoginProfile(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetLoginProfileRequest, Model::GetLoginProfileOutcome> GetLoginProfileAwaitable(Model::GetLoginProfileRequest request) const;
+
+        /**
+         * co_await-able form of GetOpenIDConnectProvider(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetOpenIDConnectProviderRequest, Model::GetOpenIDConnectProviderOutcome> GetOpenIDConnectProviderAwaitable(Model::GetOpenIDConnectProviderRequest request) const;
+
+        /**
+         * co_await-able form of GetPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetPolicyRequest, Model::GetPolicyOutcome> GetPolicyAwaitable(Model::GetPolicyRequest request) const;
+
+        /**
+         * co_await-able form of GetPolicyVersion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetPolicyVersionRequest, Model::GetPolicyVersionOutcome> GetPolicyVersionAwaitable(Model::GetPolicyVersionRequest request) const;
+
+        /**
+         * co_await-able form of GetRole(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetRoleRequest, Model::GetRoleOutcome> GetRoleAwaitable(Model::GetRoleRequest request) const;
+
+        /**
+         * co_await-able form of GetRolePolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetRolePolicyRequest, Model::GetRolePolicyOutcome> GetRolePolicyAwaitable(Model::GetRolePolicyRequest request) const;
+
+        /**
+         * co_await-able form of GetSAMLProvider(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetSAMLProviderRequest, Model::GetSAMLProviderOutcome> GetSAMLProviderAwaitable(Model::GetSAMLProviderRequest request) const;
+
+        /**
+         * co_await-able form of GetSSHPublicKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetSSHPublicKeyRequest, Model::GetSSHPublicKeyOutcome> GetSSHPublicKeyAwaitable(Model::GetSSHPublicKeyRequest request) const;
+
+        /**
+         * co_await-able form of GetServerCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetServerCertificateRequest, Model::GetServerCertificateOutcome> GetServerCertificateAwaitable(Model::GetServerCertificateRequest request) const;
+
+        /**
+         * co_await-able form of GetUser(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetUserRequest, Model::GetUserOutcome> GetUserAwaitable(Model::GetUserRequest request) const;
+
+        /**
+         * co_await-able form of GetUserPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::GetUserPolicyRequest, Model::GetUserPolicyOutcome> GetUserPolicyAwaitable(Model::GetUserPolicyRequest request) const;
+
+        /**
+         * co_await-able form of ListAccessKeys(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListAccessKeysRequest, Model::ListAccessKeysOutcome> ListAccessKeysAwaitable(Model::ListAccessKeysRequest request) const;
+
+        /**
+         * co_await-able form of ListAccountAliases(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListAccountAliasesRequest, Model::ListAccountAliasesOutcome> ListAccountAliasesAwaitable(Model::ListAccountAliasesRequest request) const;
+
+        /**
+         * co_await-able form of ListAttachedGroupPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListAttachedGroupPoliciesRequest, Model::ListAttachedGroupPoliciesOutcome> ListAttachedGroupPoliciesAwaitable(Model::ListAttachedGroupPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of ListAttachedRolePolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListAttachedRolePoliciesRequest, Model::ListAttachedRolePoliciesOutcome> ListAttachedRolePoliciesAwaitable(Model::ListAttachedRolePoliciesRequest request) const;
+
+        /**
+         * co_await-able form of ListAttachedUserPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListAttachedUserPoliciesRequest, Model::ListAttachedUserPoliciesOutcome> ListAttachedUserPoliciesAwaitable(Model::ListAttachedUserPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of ListEntitiesForPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListEntitiesForPolicyRequest, Model::ListEntitiesForPolicyOutcome> ListEntitiesForPolicyAwaitable(Model::ListEntitiesForPolicyRequest request) const;
+
+        /**
+         * co_await-able form of ListGroupPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListGroupPoliciesRequest, Model::ListGroupPoliciesOutcome> ListGroupPoliciesAwaitable(Model::ListGroupPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of ListGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListGroupsRequest, Model::ListGroupsOutcome> ListGroupsAwaitable(Model::ListGroupsRequest request) const;
+
+        /**
+         * co_await-able form of ListGroupsForUser(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListGroupsForUserRequest, Model::ListGroupsForUserOutcome> ListGroupsForUserAwaitable(Model::ListGroupsForUserRequest request) const;
+
+        /**
+         * co_await-able form of ListInstanceProfiles(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListInstanceProfilesRequest, Model::ListInstanceProfilesOutcome> ListInstanceProfilesAwaitable(Model::ListInstanceProfilesRequest request) const;
+
+        /**
+         * co_await-able form of ListInstanceProfilesForRole(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListInstanceProfilesForRoleRequest, Model::ListInstanceProfilesForRoleOutcome> ListInstanceProfilesForRoleAwaitable(Model::ListInstanceProfilesForRoleRequest request) const;
+
+        /**
+         * co_await-able form of ListMFADevices(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListMFADevicesRequest, Model::ListMFADevicesOutcome> ListMFADevicesAwaitable(Model::ListMFADevicesRequest request) const;
+
+        /**
+         * co_await-able form of ListOpenIDConnectProviders(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListOpenIDConnectProvidersRequest, Model::ListOpenIDConnectProvidersOutcome> ListOpenIDConnectProvidersAwaitable(Model::ListOpenIDConnectProvidersRequest request) const;
+
+        /**
+         * co_await-able form of ListPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListPoliciesRequest, Model::ListPoliciesOutcome> ListPoliciesAwaitable(Model::ListPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of ListPolicyVersions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListPolicyVersionsRequest, Model::ListPolicyVersionsOutcome> ListPolicyVersionsAwaitable(Model::ListPolicyVersionsRequest request) const;
+
+        /**
+         * co_await-able form of ListRolePolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListRolePoliciesRequest, Model::ListRolePoliciesOutcome> ListRolePoliciesAwaitable(Model::ListRolePoliciesRequest request) const;
+
+        /**
+         * co_await-able form of ListRoles(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListRolesRequest, Model::ListRolesOutcome> ListRolesAwaitable(Model::ListRolesRequest request) const;
+
+        /**
+         * co_await-able form of ListSAMLProviders(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListSAMLProvidersRequest, Model::ListSAMLProvidersOutcome> ListSAMLProvidersAwaitable(Model::ListSAMLProvidersRequest request) const;
+
+        /**
+         * co_await-able form of ListSSHPublicKeys(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListSSHPublicKeysRequest, Model::ListSSHPublicKeysOutcome> ListSSHPublicKeysAwaitable(Model::ListSSHPublicKeysRequest request) const;
+
+        /**
+         * co_await-able form of ListServerCertificates(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListServerCertificatesRequest, Model::ListServerCertificatesOutcome> ListServerCertificatesAwaitable(Model::ListServerCertificatesRequest request) const;
+
+        /**
+         * co_await-able form of ListSigningCertificates(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListSigningCertificatesRequest, Model::ListSigningCertificatesOutcome> ListSigningCertificatesAwaitable(Model::ListSigningCertificatesRequest request) const;
+
+        /**
+         * co_await-able form of ListUserPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListUserPoliciesRequest, Model::ListUserPoliciesOutcome> ListUserPoliciesAwaitable(Model::ListUserPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of ListUsers(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListUsersRequest, Model::ListUsersOutcome> ListUsersAwaitable(Model::ListUsersRequest request) const;
+
+        /**
+         * co_await-able form of ListVirtualMFADevices(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ListVirtualMFADevicesRequest, Model::ListVirtualMFADevicesOutcome> ListVirtualMFADevicesAwaitable(Model::ListVirtualMFADevicesRequest request) const;
+
+        /**
+         * co_await-able form of PutGroupPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::PutGroupPolicyRequest, Model::PutGroupPolicyOutcome> PutGroupPolicyAwaitable(Model::PutGroupPolicyRequest request) const;
+
+        /**
+         * co_await-able form of PutRolePolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::PutRolePolicyRequest, Model::PutRolePolicyOutcome> PutRolePolicyAwaitable(Model::PutRolePolicyRequest request) const;
+
+        /**
+         * co_await-able form of PutUserPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::PutUserPolicyRequest, Model::PutUserPolicyOutcome> PutUserPolicyAwaitable(Model::PutUserPolicyRequest request) const;
+
+        /**
+         * co_await-able form of RemoveClientIDFromOpenIDConnectProvider(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::RemoveClientIDFromOpenIDConnectProviderRequest, Model::RemoveClientIDFromOpenIDConnectProviderOutcome> RemoveClientIDFromOpenIDConnectProviderAwaitable(Model::RemoveClientIDFromOpenIDConnectProviderRequest request) const;
+
+        /**
+         * co_await-able form of RemoveRoleFromInstanceProfile(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::RemoveRoleFromInstanceProfileRequest, Model::RemoveRoleFromInstanceProfileOutcome> RemoveRoleFromInstanceProfileAwaitable(Model::RemoveRoleFromInstanceProfileRequest request) const;
+
+        /**
+         * co_await-able form of RemoveUserFromGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::RemoveUserFromGroupRequest, Model::RemoveUserFromGroupOutcome> RemoveUserFromGroupAwaitable(Model::RemoveUserFromGroupRequest request) const;
+
+        /**
+         * co_await-able form of ResyncMFADevice(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::ResyncMFADeviceRequest, Model::ResyncMFADeviceOutcome> ResyncMFADeviceAwaitable(Model::ResyncMFADeviceRequest request) const;
+
+        /**
+         * co_await-able form of SetDefaultPolicyVersion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::SetDefaultPolicyVersionRequest, Model::SetDefaultPolicyVersionOutcome> SetDefaultPolicyVersionAwaitable(Model::SetDefaultPolicyVersionRequest request) const;
+
+        /**
+         * co_await-able form of SimulateCustomPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::SimulateCustomPolicyRequest, Model::SimulateCustomPolicyOutcome> SimulateCustomPolicyAwaitable(Model::SimulateCustomPolicyRequest request) const;
+
+        /**
+         * co_await-able form of SimulatePrincipalPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::SimulatePrincipalPolicyRequest, Model::SimulatePrincipalPolicyOutcome> SimulatePrincipalPolicyAwaitable(Model::SimulatePrincipalPolicyRequest request) const;
+
+        /**
+         * co_await-able form of UpdateAccessKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::UpdateAccessKeyRequest, Model::UpdateAccessKeyOutcome> UpdateAccessKeyAwaitable(Model::UpdateAccessKeyRequest request) const;
+
+        /**
+         * co_await-able form of UpdateAccountPasswordPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::UpdateAccountPasswordPolicyRequest, Model::UpdateAccountPasswordPolicyOutcome> UpdateAccountPasswordPolicyAwaitable(Model::UpdateAccountPasswordPolicyRequest request) const;
+
+        /**
+         * co_await-able form of UpdateAssumeRolePolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::UpdateAssumeRolePolicyRequest, Model::UpdateAssumeRolePolicyOutcome> UpdateAssumeRolePolicyAwaitable(Model::UpdateAssumeRolePolicyRequest request) const;
+
+        /**
+         * co_await-able form of UpdateGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::UpdateGroupRequest, Model::UpdateGroupOutcome> UpdateGroupAwaitable(Model::UpdateGroupRequest request) const;
+
+        /**
+         * co_await-able form of UpdateLoginProfile(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::UpdateLoginProfileRequest, Model::UpdateLoginProfileOutcome> UpdateLoginProfileAwaitable(Model::UpdateLoginProfileRequest request) const;
+
+        /**
+         * co_await-able form of UpdateOpenIDConnectProviderThumbprint(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::UpdateOpenIDConnectProviderThumbprintRequest, Model::UpdateOpenIDConnectProviderThumbprintOutcome> UpdateOpenIDConnectProviderThumbprintAwaitable(Model::UpdateOpenIDConnectProviderThumbprintRequest request) const;
+
+        /**
+         * co_await-able form of UpdateSAMLProvider(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::UpdateSAMLProviderRequest, Model::UpdateSAMLProviderOutcome> UpdateSAMLProviderAwaitable(Model::UpdateSAMLProviderRequest request) const;
+
+        /**
+         * co_await-able form of UpdateSSHPublicKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::UpdateSSHPublicKeyRequest, Model::UpdateSSHPublicKeyOutcome> UpdateSSHPublicKeyAwaitable(Model::UpdateSSHPublicKeyRequest request) const;
+
+        /**
+         * co_await-able form of UpdateServerCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::UpdateServerCertificateRequest, Model::UpdateServerCertificateOutcome> UpdateServerCertificateAwaitable(Model::UpdateServerCertificateRequest request) const;
+
+        /**
+         * co_await-able form of UpdateSigningCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::UpdateSigningCertificateRequest, Model::UpdateSigningCertificateOutcome> UpdateSigningCertificateAwaitable(Model::UpdateSigningCertificateRequest request) const;
+
+        /**
+         * co_await-able form of UpdateUser(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::UpdateUserRequest, Model::UpdateUserOutcome> UpdateUserAwaitable(Model::UpdateUserRequest request) const;
+
+        /**
+         * co_await-able form of UploadSSHPublicKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::UploadSSHPublicKeyRequest, Model::UploadSSHPublicKeyOutcome> UploadSSHPublicKeyAwaitable(Model::UploadSSHPublicKeyRequest request) const;
+
+        /**
+         * co_await-able form of UploadServerCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::UploadServerCertificateRequest, Model::UploadServerCertificateOutcome> UploadServerCertificateAwaitable(Model::UploadServerCertificateRequest request) const;
+
+        /**
+         * co_await-able form of UploadSigningCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IAMClient, Model::UploadSigningCertificateRequest, Model::UploadSigningCertificateOutcome> UploadSigningCertificateAwaitable(Model::UploadSigningCertificateRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     AddClientIDToOpenIDConnectProviderRequest();
+    inline const char* GetServiceRequestName() const override { return "AddClientIDToOpenIDConnectProvider"; }
+
     Aws::String SerializePayload() const override;
 
     /**
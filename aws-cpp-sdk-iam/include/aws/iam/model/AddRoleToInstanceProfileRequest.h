@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     AddRoleToInstanceProfileRequest();
+    inline const char* GetServiceRequestName() const override { return "AddRoleToInstanceProfile"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     AddUserToGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "AddUserToGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     AttachGroupPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachGroupPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
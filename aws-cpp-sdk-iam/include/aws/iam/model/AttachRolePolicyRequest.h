@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     AttachRolePolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachRolePolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
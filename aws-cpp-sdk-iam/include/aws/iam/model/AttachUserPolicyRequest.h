@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     AttachUserPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachUserPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ChangePasswordRequest();
+    inline const char* GetServiceRequestName() const override { return "ChangePassword"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateAccessKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateAccessKey"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateAccountAliasRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateAccountAlias"; }
+
     Aws::String SerializePayload() const override;
 
     /**
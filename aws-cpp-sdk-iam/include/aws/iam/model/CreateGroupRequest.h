@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
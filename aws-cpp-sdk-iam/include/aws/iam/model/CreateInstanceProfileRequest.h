@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateInstanceProfileRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateInstanceProfile"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateLoginProfileRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateLoginProfile"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateOpenIDConnectProviderRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateOpenIDConnectProvider"; }
+
     Aws::String SerializePayload() const override;
 
     /**
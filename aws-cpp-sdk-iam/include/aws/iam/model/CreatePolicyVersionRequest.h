@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreatePolicyVersionRequest();
+    inline const char* GetServiceRequestName() const override { return "CreatePolicyVersion"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateRoleRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateRole"; }
+
     Aws::String SerializePayload() const override;
 
     /**
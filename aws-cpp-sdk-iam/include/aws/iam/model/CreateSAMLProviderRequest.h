@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateSAMLProviderRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateSAMLProvider"; }
+
     Aws::String SerializePayload() const override;
 
     /**
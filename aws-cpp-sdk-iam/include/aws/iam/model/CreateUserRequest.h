@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateUserRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateUser"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateVirtualMFADeviceRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateVirtualMFADevice"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeactivateMFADeviceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeactivateMFADevice"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteAccessKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteAccessKey"; }
+
     Aws::String SerializePayload() const override;
 
     /**
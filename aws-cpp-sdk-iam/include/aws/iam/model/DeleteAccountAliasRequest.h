@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteAccountAliasRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteAccountAlias"; }
+
     Aws::String SerializePayload() const override;
 
     /**
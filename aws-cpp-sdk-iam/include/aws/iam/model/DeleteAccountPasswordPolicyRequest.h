@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     DeleteAccountPasswordPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteAccountPasswordPolicy"; }
+
     Aws::String SerializePayload() const override;
 
   };
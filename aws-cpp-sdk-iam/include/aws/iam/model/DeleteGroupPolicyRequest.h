@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteGroupPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteGroupPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
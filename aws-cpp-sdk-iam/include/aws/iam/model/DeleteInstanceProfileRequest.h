@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteInstanceProfileRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteInstanceProfile"; }
+
     Aws::String SerializePayload() const override;
 
     /**
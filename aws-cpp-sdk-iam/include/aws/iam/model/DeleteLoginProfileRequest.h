@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteLoginProfileRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteLoginProfile"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteOpenIDConnectProviderRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteOpenIDConnectProvider"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteRolePolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteRolePolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
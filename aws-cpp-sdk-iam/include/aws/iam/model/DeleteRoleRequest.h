@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteRoleRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteRole"; }
+
     Aws::String SerializePayload() const override;
 
     /**
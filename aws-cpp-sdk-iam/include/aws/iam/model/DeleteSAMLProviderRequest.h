@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteSAMLProviderRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteSAMLProvider"; }
+
     Aws::String SerializePayload() const override;
 
     /**
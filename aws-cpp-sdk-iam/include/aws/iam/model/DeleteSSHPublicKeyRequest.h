@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteSSHPublicKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteSSHPublicKey"; }
+
     Aws::String SerializePayload() const override;
 
     /**
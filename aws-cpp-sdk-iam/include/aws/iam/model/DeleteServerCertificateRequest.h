@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteServerCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteServerCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteSigningCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteSigningCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
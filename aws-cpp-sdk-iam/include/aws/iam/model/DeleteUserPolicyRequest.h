@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteUserPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteUserPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteUserRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteUser"; }
+
     Aws::String SerializePayload() const override;
 
     /**
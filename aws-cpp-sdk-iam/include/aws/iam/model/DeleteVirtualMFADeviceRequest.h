@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteVirtualMFADeviceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteVirtualMFADevice"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DetachGroupPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachGroupPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DetachRolePolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachRolePolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
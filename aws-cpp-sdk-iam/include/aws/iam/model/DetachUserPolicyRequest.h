@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DetachUserPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachUserPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
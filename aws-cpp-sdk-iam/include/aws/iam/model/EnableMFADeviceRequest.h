@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     EnableMFADeviceRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableMFADevice"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     GenerateCredentialReportRequest();
+    inline const char* GetServiceRequestName() const override { return "GenerateCredentialReport"; }
+
     Aws::String SerializePayload() const override;
 
   };
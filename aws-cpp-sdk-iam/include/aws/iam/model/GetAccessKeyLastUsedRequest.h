@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetAccessKeyLastUsedRequest();
+    inline const char* GetServiceRequestName() const override { return "GetAccessKeyLastUsed"; }
+
     Aws::String SerializePayload() const override;
 
     /**
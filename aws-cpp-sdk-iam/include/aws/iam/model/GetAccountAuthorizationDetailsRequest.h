@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetAccountAuthorizationDetailsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetAccountAuthorizationDetails"; }
+
     Aws::String SerializePayload() const override;
 
     /**
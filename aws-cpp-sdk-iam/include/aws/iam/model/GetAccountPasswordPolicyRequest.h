@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     GetAccountPasswordPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetAccountPasswordPolicy"; }
+
     Aws::String SerializePayload() const override;
 
   };
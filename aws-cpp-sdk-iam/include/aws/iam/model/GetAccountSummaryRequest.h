@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     GetAccountSummaryRequest();
+    inline const char* GetServiceRequestName() const override { return "GetAccountSummary"; }
+
     Aws::String SerializePayload() const override;
 
   };
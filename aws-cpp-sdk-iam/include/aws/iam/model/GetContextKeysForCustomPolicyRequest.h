@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetContextKeysForCustomPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetContextKeysForCustomPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetContextKeysForPrincipalPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetContextKeysForPrincipalPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
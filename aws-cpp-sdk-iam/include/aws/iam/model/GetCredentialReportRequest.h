@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     GetCredentialReportRequest();
+    inline const char* GetServiceRequestName() const override { return "GetCredentialReport"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetGroupPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetGroupPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "GetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetInstanceProfileRequest();
+    inline const char* GetServiceRequestName() const override { return "GetInstanceProfile"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetLoginProfileRequest();
+    inline const char* GetServiceRequestName() const override { return "GetLoginProfile"; }
+
     Aws::String SerializePayload() const override;
 
     /**
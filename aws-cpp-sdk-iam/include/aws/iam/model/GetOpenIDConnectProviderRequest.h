@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetOpenIDConnectProviderRequest();
+    inline const char* GetServiceRequestName() const override { return "GetOpenIDConnectProvider"; }
+
     Aws::String SerializePayload() const override;
 
     /**
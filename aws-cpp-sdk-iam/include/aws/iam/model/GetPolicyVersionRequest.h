@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetPolicyVersionRequest();
+    inline const char* GetServiceRequestName() const override { return "GetPolicyVersion"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetRolePolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetRolePolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
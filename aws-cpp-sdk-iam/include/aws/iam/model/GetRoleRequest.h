@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetRoleRequest();
+    inline const char* GetServiceRequestName() const override { return "GetRole"; }
+
     Aws::String SerializePayload() const override;
 
     /**
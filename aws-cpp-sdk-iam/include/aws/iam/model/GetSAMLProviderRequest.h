@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetSAMLProviderRequest();
+    inline const char* GetServiceRequestName() const override { return "GetSAMLProvider"; }
+
     Aws::String SerializePayload() const override;
 
     /**
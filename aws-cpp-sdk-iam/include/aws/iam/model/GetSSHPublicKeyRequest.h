@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetSSHPublicKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetSSHPublicKey"; }
+
     Aws::String SerializePayload() const override;
 
     /**
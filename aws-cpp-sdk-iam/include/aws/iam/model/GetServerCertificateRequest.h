@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetServerCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "GetServerCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
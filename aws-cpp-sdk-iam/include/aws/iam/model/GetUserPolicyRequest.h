@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetUserPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetUserPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetUserRequest();
+    inline const char* GetServiceRequestName() const override { return "GetUser"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListAccessKeysRequest();
+    inline const char* GetServiceRequestName() const override { return "ListAccessKeys"; }
+
     Aws::String SerializePayload() const override;
 
     /**
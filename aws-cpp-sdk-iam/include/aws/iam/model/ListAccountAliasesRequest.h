@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListAccountAliasesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListAccountAliases"; }
+
     Aws::String SerializePayload() const override;
 
     /**
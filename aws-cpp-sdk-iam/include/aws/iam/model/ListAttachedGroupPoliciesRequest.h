@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListAttachedGroupPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListAttachedGroupPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListAttachedRolePoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListAttachedRolePolicies"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListAttachedUserPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListAttachedUserPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListEntitiesForPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "ListEntitiesForPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListGroupPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListGroupPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     /**
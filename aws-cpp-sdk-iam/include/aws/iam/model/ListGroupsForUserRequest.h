@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListGroupsForUserRequest();
+    inline const char* GetServiceRequestName() const override { return "ListGroupsForUser"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListInstanceProfilesForRoleRequest();
+    inline const char* GetServiceRequestName() const override { return "ListInstanceProfilesForRole"; }
+
     Aws::String SerializePayload() const override;
 
     /**
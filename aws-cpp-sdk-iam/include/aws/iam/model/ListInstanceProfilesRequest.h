@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListInstanceProfilesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListInstanceProfiles"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListMFADevicesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListMFADevices"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     ListOpenIDConnectProvidersRequest();
+    inline const char* GetServiceRequestName() const override { return "ListOpenIDConnectProviders"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     /**
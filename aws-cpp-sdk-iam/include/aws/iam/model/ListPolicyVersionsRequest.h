@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListPolicyVersionsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListPolicyVersions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
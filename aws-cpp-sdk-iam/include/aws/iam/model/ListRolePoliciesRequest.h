@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListRolePoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListRolePolicies"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListRolesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListRoles"; }
+
     Aws::String SerializePayload() const override;
 
     /**
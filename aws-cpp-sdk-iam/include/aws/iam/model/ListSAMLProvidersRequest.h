@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     ListSAMLProvidersRequest();
+    inline const char* GetServiceRequestName() const override { return "ListSAMLProviders"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListSSHPublicKeysRequest();
+    inline const char* GetServiceRequestName() const override { return "ListSSHPublicKeys"; }
+
     Aws::String SerializePayload() const override;
 
     /**
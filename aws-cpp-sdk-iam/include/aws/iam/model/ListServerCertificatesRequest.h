@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListServerCertificatesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListServerCertificates"; }
+
     Aws::String SerializePayload() const override;
 
     /**
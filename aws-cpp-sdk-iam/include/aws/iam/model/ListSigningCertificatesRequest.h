@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListSigningCertificatesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListSigningCertificates"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListUserPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListUserPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     /**
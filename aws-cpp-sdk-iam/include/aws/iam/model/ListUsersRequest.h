@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListUsersRequest();
+    inline const char* GetServiceRequestName() const override { return "ListUsers"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListVirtualMFADevicesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListVirtualMFADevices"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     PutGroupPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "PutGroupPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
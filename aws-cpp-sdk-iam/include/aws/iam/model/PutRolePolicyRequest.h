@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     PutRolePolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "PutRolePolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
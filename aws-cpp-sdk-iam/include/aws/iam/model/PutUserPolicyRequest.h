@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     PutUserPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "PutUserPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RemoveClientIDFromOpenIDConnectProviderRequest();
+    inline const char* GetServiceRequestName() const override { return "RemoveClientIDFromOpenIDConnectProvider"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RemoveRoleFromInstanceProfileRequest();
+    inline const char* GetServiceRequestName() const override { return "RemoveRoleFromInstanceProfile"; }
+
     Aws::String SerializePayload() const override;
 
     /**
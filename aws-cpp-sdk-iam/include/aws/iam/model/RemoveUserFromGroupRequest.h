@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RemoveUserFromGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "RemoveUserFromGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
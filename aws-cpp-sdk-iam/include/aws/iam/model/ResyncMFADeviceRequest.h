@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ResyncMFADeviceRequest();
+    inline const char* GetServiceRequestName() const override { return "ResyncMFADevice"; }
+
     Aws::String SerializePayload() const override;
 
     /**
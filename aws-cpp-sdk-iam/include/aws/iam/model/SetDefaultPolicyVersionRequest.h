@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     SetDefaultPolicyVersionRequest();
+    inline const char* GetServiceRequestName() const override { return "SetDefaultPolicyVersion"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SimulateCustomPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "SimulateCustomPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SimulatePrincipalPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "SimulatePrincipalPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateAccessKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateAccessKey"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     UpdateAccountPasswordPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateAccountPasswordPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
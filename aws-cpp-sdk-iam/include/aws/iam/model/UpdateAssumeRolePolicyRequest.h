@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateAssumeRolePolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateAssumeRolePolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
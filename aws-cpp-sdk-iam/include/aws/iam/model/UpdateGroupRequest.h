@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateLoginProfileRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateLoginProfile"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateOpenIDConnectProviderThumbprintRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateOpenIDConnectProviderThumbprint"; }
+
     Aws::String SerializePayload() const override;
 
     /**
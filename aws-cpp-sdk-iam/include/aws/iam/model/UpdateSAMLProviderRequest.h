@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateSAMLProviderRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateSAMLProvider"; }
+
     Aws::String SerializePayload() const override;
 
     /**
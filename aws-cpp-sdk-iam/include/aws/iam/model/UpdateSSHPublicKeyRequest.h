@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateSSHPublicKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateSSHPublicKey"; }
+
     Aws::String SerializePayload() const override;
 
     /**
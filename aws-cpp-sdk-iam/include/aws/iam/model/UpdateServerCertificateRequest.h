@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateServerCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateServerCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
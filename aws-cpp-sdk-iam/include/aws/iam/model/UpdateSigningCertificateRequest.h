@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateSigningCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateSigningCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateUserRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateUser"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UploadSSHPublicKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "UploadSSHPublicKey"; }
+
     Aws::String SerializePayload() const override;
 
     /**
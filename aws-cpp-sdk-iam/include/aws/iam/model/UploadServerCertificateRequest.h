@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UploadServerCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "UploadServerCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UploadSigningCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "UploadSigningCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
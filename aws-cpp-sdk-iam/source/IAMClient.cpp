@@ -222,7 +222,7 @@ AddClientIDToOpenIDConnectProviderOutcome IAMClient::AddClientIDToOpenIDConnectP
 
 AddClientIDToOpenIDConnectProviderOutcomeCallable IAMClient::AddClientIDToOpenIDConnectProviderCallable(const AddClientIDToOpenIDConnectProviderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddClientIDToOpenIDConnectProvider( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddClientIDToOpenIDConnectProvider( request ); } );
 }
 
 void IAMClient::AddClientIDToOpenIDConnectProviderAsync(const AddClientIDToOpenIDConnectProviderRequest& request, const AddClientIDToOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -230,6 +230,16 @@ void IAMClient::AddClientIDToOpenIDConnectProviderAsync(const AddClientIDToOpenI
   m_executor->Submit( [this, request, handler, context](){ this->AddClientIDToOpenIDConnectProviderAsyncHelper( request, handler, context ); } );
 }
 
+AddClientIDToOpenIDConnectProviderOutcomeCallable IAMClient::AddClientIDToOpenIDConnectProviderCallable(AddClientIDToOpenIDConnectProviderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::AddClientIDToOpenIDConnectProvider, this, std::move(request)));
+}
+
+void IAMClient::AddClientIDToOpenIDConnectProviderAsync(AddClientIDToOpenIDConnectProviderRequest&& request, const AddClientIDToOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::AddClientIDToOpenIDConnectProviderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::AddClientIDToOpenIDConnectProviderAsyncHelper(const AddClientIDToOpenIDConnectProviderRequest& request, const AddClientIDToOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddClientIDToOpenIDConnectProvider(request), context);
@@ -252,7 +262,7 @@ AddRoleToInstanceProfileOutcome IAMClient::AddRoleToInstanceProfile(const AddRol
 
 AddRoleToInstanceProfileOutcomeCallable IAMClient::AddRoleToInstanceProfileCallable(const AddRoleToInstanceProfileRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddRoleToInstanceProfile( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddRoleToInstanceProfile( request ); } );
 }
 
 void IAMClient::AddRoleToInstanceProfileAsync(const AddRoleToInstanceProfileRequest& request, const AddRoleToInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -260,6 +270,16 @@ void IAMClient::AddRoleToInstanceProfileAsync(const AddRoleToInstanceProfileRequ
   m_executor->Submit( [this, request, handler, context](){ this->AddRoleToInstanceProfileAsyncHelper( request, handler, context ); } );
 }
 
+AddRoleToInstanceProfileOutcomeCallable IAMClient::AddRoleToInstanceProfileCallable(AddRoleToInstanceProfileRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::AddRoleToInstanceProfile, this, std::move(request)));
+}
+
+void IAMClient::AddRoleToInstanceProfileAsync(AddRoleToInstanceProfileRequest&& request, const AddRoleToInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::AddRoleToInstanceProfileAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::AddRoleToInstanceProfileAsyncHelper(const AddRoleToInstanceProfileRequest& request, const AddRoleToInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddRoleToInstanceProfile(request), context);
@@ -282,7 +302,7 @@ AddUserToGroupOutcome IAMClient::AddUserToGroup(const AddUserToGroupRequest& req
 
 AddUserToGroupOutcomeCallable IAMClient::AddUserToGroupCallable(const AddUserToGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddUserToGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddUserToGroup( request ); } );
 }
 
 void IAMClient::AddUserToGroupAsync(const AddUserToGroupRequest& request, const AddUserToGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -290,6 +310,16 @@ void IAMClient::AddUserToGroupAsync(const AddUserToGroupRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->AddUserToGroupAsyncHelper( request, handler, context ); } );
 }
 
+AddUserToGroupOutcomeCallable IAMClient::AddUserToGroupCallable(AddUserToGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::AddUserToGroup, this, std::move(request)));
+}
+
+void IAMClient::AddUserToGroupAsync(AddUserToGroupRequest&& request, const AddUserToGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::AddUserToGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::AddUserToGroupAsyncHelper(const AddUserToGroupRequest& request, const AddUserToGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddUserToGroup(request), context);
@@ -312,7 +342,7 @@ AttachGroupPolicyOutcome IAMClient::AttachGroupPolicy(const AttachGroupPolicyReq
 
 AttachGroupPolicyOutcomeCallable IAMClient::AttachGroupPolicyCallable(const AttachGroupPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachGroupPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachGroupPolicy( request ); } );
 }
 
 void IAMClient::AttachGroupPolicyAsync(const AttachGroupPolicyRequest& request, const AttachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -320,6 +350,16 @@ void IAMClient::AttachGroupPolicyAsync(const AttachGroupPolicyRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->AttachGroupPolicyAsyncHelper( request, handler, context ); } );
 }
 
+AttachGroupPolicyOutcomeCallable IAMClient::AttachGroupPolicyCallable(AttachGroupPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::AttachGroupPolicy, this, std::move(request)));
+}
+
+void IAMClient::AttachGroupPolicyAsync(AttachGroupPolicyRequest&& request, const AttachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::AttachGroupPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::AttachGroupPolicyAsyncHelper(const AttachGroupPolicyRequest& request, const AttachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachGroupPolicy(request), context);
@@ -342,7 +382,7 @@ AttachRolePolicyOutcome IAMClient::AttachRolePolicy(const AttachRolePolicyReques
 
 AttachRolePolicyOutcomeCallable IAMClient::AttachRolePolicyCallable(const AttachRolePolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachRolePolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachRolePolicy( request ); } );
 }
 
 void IAMClient::AttachRolePolicyAsync(const AttachRolePolicyRequest& request, const AttachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -350,6 +390,16 @@ void IAMClient::AttachRolePolicyAsync(const AttachRolePolicyRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->AttachRolePolicyAsyncHelper( request, handler, context ); } );
 }
 
+AttachRolePolicyOutcomeCallable IAMClient::AttachRolePolicyCallable(AttachRolePolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::AttachRolePolicy, this, std::move(request)));
+}
+
+void IAMClient::AttachRolePolicyAsync(AttachRolePolicyRequest&& request, const AttachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::AttachRolePolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::AttachRolePolicyAsyncHelper(const AttachRolePolicyRequest& request, const AttachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachRolePolicy(request), context);
@@ -372,7 +422,7 @@ AttachUserPolicyOutcome IAMClient::AttachUserPolicy(const AttachUserPolicyReques
 
 AttachUserPolicyOutcomeCallable IAMClient::AttachUserPolicyCallable(const AttachUserPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachUserPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachUserPolicy( request ); } );
 }
 
 void IAMClient::AttachUserPolicyAsync(const AttachUserPolicyRequest& request, const AttachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -380,6 +430,16 @@ void IAMClient::AttachUserPolicyAsync(const AttachUserPolicyRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->AttachUserPolicyAsyncHelper( request, handler, context ); } );
 }
 
+AttachUserPolicyOutcomeCallable IAMClient::AttachUserPolicyCallable(AttachUserPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::AttachUserPolicy, this, std::move(request)));
+}
+
+void IAMClient::AttachUserPolicyAsync(AttachUserPolicyRequest&& request, const AttachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::AttachUserPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::AttachUserPolicyAsyncHelper(const AttachUserPolicyRequest& request, const AttachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachUserPolicy(request), context);
@@ -402,7 +462,7 @@ ChangePasswordOutcome IAMClient::ChangePassword(const ChangePasswordRequest& req
 
 ChangePasswordOutcomeCallable IAMClient::ChangePasswordCallable(const ChangePasswordRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ChangePassword( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ChangePassword( request ); } );
 }
 
 void IAMClient::ChangePasswordAsync(const ChangePasswordRequest& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -410,6 +470,16 @@ void IAMClient::ChangePasswordAsync(const ChangePasswordRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ChangePasswordAsyncHelper( request, handler, context ); } );
 }
 
+ChangePasswordOutcomeCallable IAMClient::ChangePasswordCallable(ChangePasswordRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ChangePassword, this, std::move(request)));
+}
+
+void IAMClient::ChangePasswordAsync(ChangePasswordRequest&& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ChangePasswordAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ChangePasswordAsyncHelper(const ChangePasswordRequest& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ChangePassword(request), context);
@@ -432,7 +502,7 @@ CreateAccessKeyOutcome IAMClient::CreateAccessKey(const CreateAccessKeyRequest&
 
 CreateAccessKeyOutcomeCallable IAMClient::CreateAccessKeyCallable(const CreateAccessKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateAccessKey( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateAccessKey( request ); } );
 }
 
 void IAMClient::CreateAccessKeyAsync(const CreateAccessKeyRequest& request, const CreateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -440,6 +510,16 @@ void IAMClient::CreateAccessKeyAsync(const CreateAccessKeyRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->CreateAccessKeyAsyncHelper( request, handler, context ); } );
 }
 
+CreateAccessKeyOutcomeCallable IAMClient::CreateAccessKeyCallable(CreateAccessKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::CreateAccessKey, this, std::move(request)));
+}
+
+void IAMClient::CreateAccessKeyAsync(CreateAccessKeyRequest&& request, const CreateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::CreateAccessKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::CreateAccessKeyAsyncHelper(const CreateAccessKeyRequest& request, const CreateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateAccessKey(request), context);
@@ -462,7 +542,7 @@ CreateAccountAliasOutcome IAMClient::CreateAccountAlias(const CreateAccountAlias
 
 CreateAccountAliasOutcomeCallable IAMClient::CreateAccountAliasCallable(const CreateAccountAliasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateAccountAlias( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateAccountAlias( request ); } );
 }
 
 void IAMClient::CreateAccountAliasAsync(const CreateAccountAliasRequest& request, const CreateAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -470,6 +550,16 @@ void IAMClient::CreateAccountAliasAsync(const CreateAccountAliasRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->CreateAccountAliasAsyncHelper( request, handler, context ); } );
 }
 
+CreateAccountAliasOutcomeCallable IAMClient::CreateAccountAliasCallable(CreateAccountAliasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::CreateAccountAlias, this, std::move(request)));
+}
+
+void IAMClient::CreateAccountAliasAsync(CreateAccountAliasRequest&& request, const CreateAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::CreateAccountAliasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::CreateAccountAliasAsyncHelper(const CreateAccountAliasRequest& request, const CreateAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateAccountAlias(request), context);
@@ -492,7 +582,7 @@ CreateGroupOutcome IAMClient::CreateGroup(const CreateGroupRequest& request) con
 
 CreateGroupOutcomeCallable IAMClient::CreateGroupCallable(const CreateGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateGroup( request ); } );
 }
 
 void IAMClient::CreateGroupAsync(const CreateGroupRequest& request, const CreateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -500,6 +590,16 @@ void IAMClient::CreateGroupAsync(const CreateGroupRequest& request, const Create
   m_executor->Submit( [this, request, handler, context](){ this->CreateGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateGroupOutcomeCallable IAMClient::CreateGroupCallable(CreateGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::CreateGroup, this, std::move(request)));
+}
+
+void IAMClient::CreateGroupAsync(CreateGroupRequest&& request, const CreateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::CreateGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::CreateGroupAsyncHelper(const CreateGroupRequest& request, const CreateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateGroup(request), context);
@@ -522,7 +622,7 @@ CreateInstanceProfileOutcome IAMClient::CreateInstanceProfile(const CreateInstan
 
 CreateInstanceProfileOutcomeCallable IAMClient::CreateInstanceProfileCallable(const CreateInstanceProfileRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateInstanceProfile( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateInstanceProfile( request ); } );
 }
 
 void IAMClient::CreateInstanceProfileAsync(const CreateInstanceProfileRequest& request, const CreateInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -530,6 +630,16 @@ void IAMClient::CreateInstanceProfileAsync(const CreateInstanceProfileRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->CreateInstanceProfileAsyncHelper( request, handler, context ); } );
 }
 
+CreateInstanceProfileOutcomeCallable IAMClient::CreateInstanceProfileCallable(CreateInstanceProfileRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::CreateInstanceProfile, this, std::move(request)));
+}
+
+void IAMClient::CreateInstanceProfileAsync(CreateInstanceProfileRequest&& request, const CreateInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::CreateInstanceProfileAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::CreateInstanceProfileAsyncHelper(const CreateInstanceProfileRequest& request, const CreateInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateInstanceProfile(request), context);
@@ -552,7 +662,7 @@ CreateLoginProfileOutcome IAMClient::CreateLoginProfile(const CreateLoginProfile
 
 CreateLoginProfileOutcomeCallable IAMClient::CreateLoginProfileCallable(const CreateLoginProfileRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateLoginProfile( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateLoginProfile( request ); } );
 }
 
 void IAMClient::CreateLoginProfileAsync(const CreateLoginProfileRequest& request, const CreateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -560,6 +670,16 @@ void IAMClient::CreateLoginProfileAsync(const CreateLoginProfileRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->CreateLoginProfileAsyncHelper( request, handler, context ); } );
 }
 
+CreateLoginProfileOutcomeCallable IAMClient::CreateLoginProfileCallable(CreateLoginProfileRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::CreateLoginProfile, this, std::move(request)));
+}
+
+void IAMClient::CreateLoginProfileAsync(CreateLoginProfileRequest&& request, const CreateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::CreateLoginProfileAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::CreateLoginProfileAsyncHelper(const CreateLoginProfileRequest& request, const CreateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateLoginProfile(request), context);
@@ -582,7 +702,7 @@ CreateOpenIDConnectProviderOutcome IAMClient::CreateOpenIDConnectProvider(const
 
 CreateOpenIDConnectProviderOutcomeCallable IAMClient::CreateOpenIDConnectProviderCallable(const CreateOpenIDConnectProviderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateOpenIDConnectProvider( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateOpenIDConnectProvider( request ); } );
 }
 
 void IAMClient::CreateOpenIDConnectProviderAsync(const CreateOpenIDConnectProviderRequest& request, const CreateOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -590,6 +710,16 @@ void IAMClient::CreateOpenIDConnectProviderAsync(const CreateOpenIDConnectProvid
   m_executor->Submit( [this, request, handler, context](){ this->CreateOpenIDConnectProviderAsyncHelper( request, handler, context ); } );
 }
 
+CreateOpenIDConnectProviderOutcomeCallable IAMClient::CreateOpenIDConnectProviderCallable(CreateOpenIDConnectProviderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::CreateOpenIDConnectProvider, this, std::move(request)));
+}
+
+void IAMClient::CreateOpenIDConnectProviderAsync(CreateOpenIDConnectProviderRequest&& request, const CreateOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::CreateOpenIDConnectProviderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::CreateOpenIDConnectProviderAsyncHelper(const CreateOpenIDConnectProviderRequest& request, const CreateOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateOpenIDConnectProvider(request), context);
@@ -612,7 +742,7 @@ CreatePolicyOutcome IAMClient::CreatePolicy(const CreatePolicyRequest& request)
 
 CreatePolicyOutcomeCallable IAMClient::CreatePolicyCallable(const CreatePolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreatePolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreatePolicy( request ); } );
 }
 
 void IAMClient::CreatePolicyAsync(const CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -620,6 +750,16 @@ void IAMClient::CreatePolicyAsync(const CreatePolicyRequest& request, const Crea
   m_executor->Submit( [this, request, handler, context](){ this->CreatePolicyAsyncHelper( request, handler, context ); } );
 }
 
+CreatePolicyOutcomeCallable IAMClient::CreatePolicyCallable(CreatePolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::CreatePolicy, this, std::move(request)));
+}
+
+void IAMClient::CreatePolicyAsync(CreatePolicyRequest&& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::CreatePolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::CreatePolicyAsyncHelper(const CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreatePolicy(request), context);
@@ -642,7 +782,7 @@ CreatePolicyVersionOutcome IAMClient::CreatePolicyVersion(const CreatePolicyVers
 
 CreatePolicyVersionOutcomeCallable IAMClient::CreatePolicyVersionCallable(const CreatePolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreatePolicyVersion( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreatePolicyVersion( request ); } );
 }
 
 void IAMClient::CreatePolicyVersionAsync(const CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -650,6 +790,16 @@ void IAMClient::CreatePolicyVersionAsync(const CreatePolicyVersionRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->CreatePolicyVersionAsyncHelper( request, handler, context ); } );
 }
 
+CreatePolicyVersionOutcomeCallable IAMClient::CreatePolicyVersionCallable(CreatePolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::CreatePolicyVersion, this, std::move(request)));
+}
+
+void IAMClient::CreatePolicyVersionAsync(CreatePolicyVersionRequest&& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::CreatePolicyVersionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::CreatePolicyVersionAsyncHelper(const CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreatePolicyVersion(request), context);
@@ -672,7 +822,7 @@ CreateRoleOutcome IAMClient::CreateRole(const CreateRoleRequest& request) const
 
 CreateRoleOutcomeCallable IAMClient::CreateRoleCallable(const CreateRoleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateRole( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateRole( request ); } );
 }
 
 void IAMClient::CreateRoleAsync(const CreateRoleRequest& request, const CreateRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -680,6 +830,16 @@ void IAMClient::CreateRoleAsync(const CreateRoleRequest& request, const CreateRo
   m_executor->Submit( [this, request, handler, context](){ this->CreateRoleAsyncHelper( request, handler, context ); } );
 }
 
+CreateRoleOutcomeCallable IAMClient::CreateRoleCallable(CreateRoleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::CreateRole, this, std::move(request)));
+}
+
+void IAMClient::CreateRoleAsync(CreateRoleRequest&& request, const CreateRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::CreateRoleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::CreateRoleAsyncHelper(const CreateRoleRequest& request, const CreateRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateRole(request), context);
@@ -702,7 +862,7 @@ CreateSAMLProviderOutcome IAMClient::CreateSAMLProvider(const CreateSAMLProvider
 
 CreateSAMLProviderOutcomeCallable IAMClient::CreateSAMLProviderCallable(const CreateSAMLProviderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateSAMLProvider( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateSAMLProvider( request ); } );
 }
 
 void IAMClient::CreateSAMLProviderAsync(const CreateSAMLProviderRequest& request, const CreateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -710,6 +870,16 @@ void IAMClient::CreateSAMLProviderAsync(const CreateSAMLProviderRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->CreateSAMLProviderAsyncHelper( request, handler, context ); } );
 }
 
+CreateSAMLProviderOutcomeCallable IAMClient::CreateSAMLProviderCallable(CreateSAMLProviderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::CreateSAMLProvider, this, std::move(request)));
+}
+
+void IAMClient::CreateSAMLProviderAsync(CreateSAMLProviderRequest&& request, const CreateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::CreateSAMLProviderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::CreateSAMLProviderAsyncHelper(const CreateSAMLProviderRequest& request, const CreateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateSAMLProvider(request), context);
@@ -732,7 +902,7 @@ CreateUserOutcome IAMClient::CreateUser(const CreateUserRequest& request) const
 
 CreateUserOutcomeCallable IAMClient::CreateUserCallable(const CreateUserRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateUser( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateUser( request ); } );
 }
 
 void IAMClient::CreateUserAsync(const CreateUserRequest& request, const CreateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -740,6 +910,16 @@ void IAMClient::CreateUserAsync(const CreateUserRequest& request, const CreateUs
   m_executor->Submit( [this, request, handler, context](){ this->CreateUserAsyncHelper( request, handler, context ); } );
 }
 
+CreateUserOutcomeCallable IAMClient::CreateUserCallable(CreateUserRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::CreateUser, this, std::move(request)));
+}
+
+void IAMClient::CreateUserAsync(CreateUserRequest&& request, const CreateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::CreateUserAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::CreateUserAsyncHelper(const CreateUserRequest& request, const CreateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateUser(request), context);
@@ -762,7 +942,7 @@ CreateVirtualMFADeviceOutcome IAMClient::CreateVirtualMFADevice(const CreateVirt
 
 CreateVirtualMFADeviceOutcomeCallable IAMClient::CreateVirtualMFADeviceCallable(const CreateVirtualMFADeviceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateVirtualMFADevice( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateVirtualMFADevice( request ); } );
 }
 
 void IAMClient::CreateVirtualMFADeviceAsync(const CreateVirtualMFADeviceRequest& request, const CreateVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -770,6 +950,16 @@ void IAMClient::CreateVirtualMFADeviceAsync(const CreateVirtualMFADeviceRequest&
   m_executor->Submit( [this, request, handler, context](){ this->CreateVirtualMFADeviceAsyncHelper( request, handler, context ); } );
 }
 
+CreateVirtualMFADeviceOutcomeCallable IAMClient::CreateVirtualMFADeviceCallable(CreateVirtualMFADeviceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::CreateVirtualMFADevice, this, std::move(request)));
+}
+
+void IAMClient::CreateVirtualMFADeviceAsync(CreateVirtualMFADeviceRequest&& request, const CreateVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::CreateVirtualMFADeviceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::CreateVirtualMFADeviceAsyncHelper(const CreateVirtualMFADeviceRequest& request, const CreateVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateVirtualMFADevice(request), context);
@@ -792,7 +982,7 @@ DeactivateMFADeviceOutcome IAMClient::DeactivateMFADevice(const DeactivateMFADev
 
 DeactivateMFADeviceOutcomeCallable IAMClient::DeactivateMFADeviceCallable(const DeactivateMFADeviceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeactivateMFADevice( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeactivateMFADevice( request ); } );
 }
 
 void IAMClient::DeactivateMFADeviceAsync(const DeactivateMFADeviceRequest& request, const DeactivateMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -800,6 +990,16 @@ void IAMClient::DeactivateMFADeviceAsync(const DeactivateMFADeviceRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DeactivateMFADeviceAsyncHelper( request, handler, context ); } );
 }
 
+DeactivateMFADeviceOutcomeCallable IAMClient::DeactivateMFADeviceCallable(DeactivateMFADeviceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeactivateMFADevice, this, std::move(request)));
+}
+
+void IAMClient::DeactivateMFADeviceAsync(DeactivateMFADeviceRequest&& request, const DeactivateMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeactivateMFADeviceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeactivateMFADeviceAsyncHelper(const DeactivateMFADeviceRequest& request, const DeactivateMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeactivateMFADevice(request), context);
@@ -822,7 +1022,7 @@ DeleteAccessKeyOutcome IAMClient::DeleteAccessKey(const DeleteAccessKeyRequest&
 
 DeleteAccessKeyOutcomeCallable IAMClient::DeleteAccessKeyCallable(const DeleteAccessKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteAccessKey( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteAccessKey( request ); } );
 }
 
 void IAMClient::DeleteAccessKeyAsync(const DeleteAccessKeyRequest& request, const DeleteAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -830,6 +1030,16 @@ void IAMClient::DeleteAccessKeyAsync(const DeleteAccessKeyRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->DeleteAccessKeyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteAccessKeyOutcomeCallable IAMClient::DeleteAccessKeyCallable(DeleteAccessKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteAccessKey, this, std::move(request)));
+}
+
+void IAMClient::DeleteAccessKeyAsync(DeleteAccessKeyRequest&& request, const DeleteAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteAccessKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteAccessKeyAsyncHelper(const DeleteAccessKeyRequest& request, const DeleteAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteAccessKey(request), context);
@@ -852,7 +1062,7 @@ DeleteAccountAliasOutcome IAMClient::DeleteAccountAlias(const DeleteAccountAlias
 
 DeleteAccountAliasOutcomeCallable IAMClient::DeleteAccountAliasCallable(const DeleteAccountAliasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteAccountAlias( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteAccountAlias( request ); } );
 }
 
 void IAMClient::DeleteAccountAliasAsync(const DeleteAccountAliasRequest& request, const DeleteAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -860,6 +1070,16 @@ void IAMClient::DeleteAccountAliasAsync(const DeleteAccountAliasRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DeleteAccountAliasAsyncHelper( request, handler, context ); } );
 }
 
+DeleteAccountAliasOutcomeCallable IAMClient::DeleteAccountAliasCallable(DeleteAccountAliasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteAccountAlias, this, std::move(request)));
+}
+
+void IAMClient::DeleteAccountAliasAsync(DeleteAccountAliasRequest&& request, const DeleteAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteAccountAliasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteAccountAliasAsyncHelper(const DeleteAccountAliasRequest& request, const DeleteAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteAccountAlias(request), context);
@@ -882,7 +1102,7 @@ DeleteAccountPasswordPolicyOutcome IAMClient::DeleteAccountPasswordPolicy(const
 
 DeleteAccountPasswordPolicyOutcomeCallable IAMClient::DeleteAccountPasswordPolicyCallable(const DeleteAccountPasswordPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteAccountPasswordPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteAccountPasswordPolicy( request ); } );
 }
 
 void IAMClient::DeleteAccountPasswordPolicyAsync(const DeleteAccountPasswordPolicyRequest& request, const DeleteAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -890,6 +1110,16 @@ void IAMClient::DeleteAccountPasswordPolicyAsync(const DeleteAccountPasswordPoli
   m_executor->Submit( [this, request, handler, context](){ this->DeleteAccountPasswordPolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteAccountPasswordPolicyOutcomeCallable IAMClient::DeleteAccountPasswordPolicyCallable(DeleteAccountPasswordPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteAccountPasswordPolicy, this, std::move(request)));
+}
+
+void IAMClient::DeleteAccountPasswordPolicyAsync(DeleteAccountPasswordPolicyRequest&& request, const DeleteAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteAccountPasswordPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteAccountPasswordPolicyAsyncHelper(const DeleteAccountPasswordPolicyRequest& request, const DeleteAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteAccountPasswordPolicy(request), context);
@@ -912,7 +1142,7 @@ DeleteGroupOutcome IAMClient::DeleteGroup(const DeleteGroupRequest& request) con
 
 DeleteGroupOutcomeCallable IAMClient::DeleteGroupCallable(const DeleteGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteGroup( request ); } );
 }
 
 void IAMClient::DeleteGroupAsync(const DeleteGroupRequest& request, const DeleteGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -920,6 +1150,16 @@ void IAMClient::DeleteGroupAsync(const DeleteGroupRequest& request, const Delete
   m_executor->Submit( [this, request, handler, context](){ this->DeleteGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteGroupOutcomeCallable IAMClient::DeleteGroupCallable(DeleteGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteGroup, this, std::move(request)));
+}
+
+void IAMClient::DeleteGroupAsync(DeleteGroupRequest&& request, const DeleteGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteGroupAsyncHelper(const DeleteGroupRequest& request, const DeleteGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteGroup(request), context);
@@ -942,7 +1182,7 @@ DeleteGroupPolicyOutcome IAMClient::DeleteGroupPolicy(const DeleteGroupPolicyReq
 
 DeleteGroupPolicyOutcomeCallable IAMClient::DeleteGroupPolicyCallable(const DeleteGroupPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteGroupPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteGroupPolicy( request ); } );
 }
 
 void IAMClient::DeleteGroupPolicyAsync(const DeleteGroupPolicyRequest& request, const DeleteGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -950,6 +1190,16 @@ void IAMClient::DeleteGroupPolicyAsync(const DeleteGroupPolicyRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DeleteGroupPolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteGroupPolicyOutcomeCallable IAMClient::DeleteGroupPolicyCallable(DeleteGroupPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteGroupPolicy, this, std::move(request)));
+}
+
+void IAMClient::DeleteGroupPolicyAsync(DeleteGroupPolicyRequest&& request, const DeleteGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteGroupPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteGroupPolicyAsyncHelper(const DeleteGroupPolicyRequest& request, const DeleteGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteGroupPolicy(request), context);
@@ -972,7 +1222,7 @@ DeleteInstanceProfileOutcome IAMClient::DeleteInstanceProfile(const DeleteInstan
 
 DeleteInstanceProfileOutcomeCallable IAMClient::DeleteInstanceProfileCallable(const DeleteInstanceProfileRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteInstanceProfile( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteInstanceProfile( request ); } );
 }
 
 void IAMClient::DeleteInstanceProfileAsync(const DeleteInstanceProfileRequest& request, const DeleteInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -980,6 +1230,16 @@ void IAMClient::DeleteInstanceProfileAsync(const DeleteInstanceProfileRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DeleteInstanceProfileAsyncHelper( request, handler, context ); } );
 }
 
+DeleteInstanceProfileOutcomeCallable IAMClient::DeleteInstanceProfileCallable(DeleteInstanceProfileRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteInstanceProfile, this, std::move(request)));
+}
+
+void IAMClient::DeleteInstanceProfileAsync(DeleteInstanceProfileRequest&& request, const DeleteInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteInstanceProfileAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteInstanceProfileAsyncHelper(const DeleteInstanceProfileRequest& request, const DeleteInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteInstanceProfile(request), context);
@@ -1002,7 +1262,7 @@ DeleteLoginProfileOutcome IAMClient::DeleteLoginProfile(const DeleteLoginProfile
 
 DeleteLoginProfileOutcomeCallable IAMClient::DeleteLoginProfileCallable(const DeleteLoginProfileRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteLoginProfile( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteLoginProfile( request ); } );
 }
 
 void IAMClient::DeleteLoginProfileAsync(const DeleteLoginProfileRequest& request, const DeleteLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1010,6 +1270,16 @@ void IAMClient::DeleteLoginProfileAsync(const DeleteLoginProfileRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DeleteLoginProfileAsyncHelper( request, handler, context ); } );
 }
 
+DeleteLoginProfileOutcomeCallable IAMClient::DeleteLoginProfileCallable(DeleteLoginProfileRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteLoginProfile, this, std::move(request)));
+}
+
+void IAMClient::DeleteLoginProfileAsync(DeleteLoginProfileRequest&& request, const DeleteLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteLoginProfileAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteLoginProfileAsyncHelper(const DeleteLoginProfileRequest& request, const DeleteLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteLoginProfile(request), context);
@@ -1032,7 +1302,7 @@ DeleteOpenIDConnectProviderOutcome IAMClient::DeleteOpenIDConnectProvider(const
 
 DeleteOpenIDConnectProviderOutcomeCallable IAMClient::DeleteOpenIDConnectProviderCallable(const DeleteOpenIDConnectProviderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteOpenIDConnectProvider( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteOpenIDConnectProvider( request ); } );
 }
 
 void IAMClient::DeleteOpenIDConnectProviderAsync(const DeleteOpenIDConnectProviderRequest& request, const DeleteOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1040,6 +1310,16 @@ void IAMClient::DeleteOpenIDConnectProviderAsync(const DeleteOpenIDConnectProvid
   m_executor->Submit( [this, request, handler, context](){ this->DeleteOpenIDConnectProviderAsyncHelper( request, handler, context ); } );
 }
 
+DeleteOpenIDConnectProviderOutcomeCallable IAMClient::DeleteOpenIDConnectProviderCallable(DeleteOpenIDConnectProviderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteOpenIDConnectProvider, this, std::move(request)));
+}
+
+void IAMClient::DeleteOpenIDConnectProviderAsync(DeleteOpenIDConnectProviderRequest&& request, const DeleteOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteOpenIDConnectProviderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteOpenIDConnectProviderAsyncHelper(const DeleteOpenIDConnectProviderRequest& request, const DeleteOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteOpenIDConnectProvider(request), context);
@@ -1062,7 +1342,7 @@ DeletePolicyOutcome IAMClient::DeletePolicy(const DeletePolicyRequest& request)
 
 DeletePolicyOutcomeCallable IAMClient::DeletePolicyCallable(const DeletePolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeletePolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeletePolicy( request ); } );
 }
 
 void IAMClient::DeletePolicyAsync(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1070,6 +1350,16 @@ void IAMClient::DeletePolicyAsync(const DeletePolicyRequest& request, const Dele
   m_executor->Submit( [this, request, handler, context](){ this->DeletePolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeletePolicyOutcomeCallable IAMClient::DeletePolicyCallable(DeletePolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeletePolicy, this, std::move(request)));
+}
+
+void IAMClient::DeletePolicyAsync(DeletePolicyRequest&& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeletePolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeletePolicyAsyncHelper(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeletePolicy(request), context);
@@ -1092,7 +1382,7 @@ DeletePolicyVersionOutcome IAMClient::DeletePolicyVersion(const DeletePolicyVers
 
 DeletePolicyVersionOutcomeCallable IAMClient::DeletePolicyVersionCallable(const DeletePolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeletePolicyVersion( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeletePolicyVersion( request ); } );
 }
 
 void IAMClient::DeletePolicyVersionAsync(const DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1100,6 +1390,16 @@ void IAMClient::DeletePolicyVersionAsync(const DeletePolicyVersionRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DeletePolicyVersionAsyncHelper( request, handler, context ); } );
 }
 
+DeletePolicyVersionOutcomeCallable IAMClient::DeletePolicyVersionCallable(DeletePolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeletePolicyVersion, this, std::move(request)));
+}
+
+void IAMClient::DeletePolicyVersionAsync(DeletePolicyVersionRequest&& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeletePolicyVersionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeletePolicyVersionAsyncHelper(const DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeletePolicyVersion(request), context);
@@ -1122,7 +1422,7 @@ DeleteRoleOutcome IAMClient::DeleteRole(const DeleteRoleRequest& request) const
 
 DeleteRoleOutcomeCallable IAMClient::DeleteRoleCallable(const DeleteRoleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRole( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRole( request ); } );
 }
 
 void IAMClient::DeleteRoleAsync(const DeleteRoleRequest& request, const DeleteRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1130,6 +1430,16 @@ void IAMClient::DeleteRoleAsync(const DeleteRoleRequest& request, const DeleteRo
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRoleAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRoleOutcomeCallable IAMClient::DeleteRoleCallable(DeleteRoleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteRole, this, std::move(request)));
+}
+
+void IAMClient::DeleteRoleAsync(DeleteRoleRequest&& request, const DeleteRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteRoleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteRoleAsyncHelper(const DeleteRoleRequest& request, const DeleteRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRole(request), context);
@@ -1152,7 +1462,7 @@ DeleteRolePolicyOutcome IAMClient::DeleteRolePolicy(const DeleteRolePolicyReques
 
 DeleteRolePolicyOutcomeCallable IAMClient::DeleteRolePolicyCallable(const DeleteRolePolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRolePolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRolePolicy( request ); } );
 }
 
 void IAMClient::DeleteRolePolicyAsync(const DeleteRolePolicyRequest& request, const DeleteRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1160,6 +1470,16 @@ void IAMClient::DeleteRolePolicyAsync(const DeleteRolePolicyRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRolePolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRolePolicyOutcomeCallable IAMClient::DeleteRolePolicyCallable(DeleteRolePolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteRolePolicy, this, std::move(request)));
+}
+
+void IAMClient::DeleteRolePolicyAsync(DeleteRolePolicyRequest&& request, const DeleteRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteRolePolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteRolePolicyAsyncHelper(const DeleteRolePolicyRequest& request, const DeleteRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRolePolicy(request), context);
@@ -1182,7 +1502,7 @@ DeleteSAMLProviderOutcome IAMClient::DeleteSAMLProvider(const DeleteSAMLProvider
 
 DeleteSAMLProviderOutcomeCallable IAMClient::DeleteSAMLProviderCallable(const DeleteSAMLProviderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteSAMLProvider( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteSAMLProvider( request ); } );
 }
 
 void IAMClient::DeleteSAMLProviderAsync(const DeleteSAMLProviderRequest& request, const DeleteSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1190,6 +1510,16 @@ void IAMClient::DeleteSAMLProviderAsync(const DeleteSAMLProviderRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DeleteSAMLProviderAsyncHelper( request, handler, context ); } );
 }
 
+DeleteSAMLProviderOutcomeCallable IAMClient::DeleteSAMLProviderCallable(DeleteSAMLProviderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteSAMLProvider, this, std::move(request)));
+}
+
+void IAMClient::DeleteSAMLProviderAsync(DeleteSAMLProviderRequest&& request, const DeleteSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteSAMLProviderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteSAMLProviderAsyncHelper(const DeleteSAMLProviderRequest& request, const DeleteSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteSAMLProvider(request), context);
@@ -1212,7 +1542,7 @@ DeleteSSHPublicKeyOutcome IAMClient::DeleteSSHPublicKey(const DeleteSSHPublicKey
 
 DeleteSSHPublicKeyOutcomeCallable IAMClient::DeleteSSHPublicKeyCallable(const DeleteSSHPublicKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteSSHPublicKey( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteSSHPublicKey( request ); } );
 }
 
 void IAMClient::DeleteSSHPublicKeyAsync(const DeleteSSHPublicKeyRequest& request, const DeleteSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1220,6 +1550,16 @@ void IAMClient::DeleteSSHPublicKeyAsync(const DeleteSSHPublicKeyRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DeleteSSHPublicKeyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteSSHPublicKeyOutcomeCallable IAMClient::DeleteSSHPublicKeyCallable(DeleteSSHPublicKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteSSHPublicKey, this, std::move(request)));
+}
+
+void IAMClient::DeleteSSHPublicKeyAsync(DeleteSSHPublicKeyRequest&& request, const DeleteSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteSSHPublicKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteSSHPublicKeyAsyncHelper(const DeleteSSHPublicKeyRequest& request, const DeleteSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteSSHPublicKey(request), context);
@@ -1242,7 +1582,7 @@ DeleteServerCertificateOutcome IAMClient::DeleteServerCertificate(const DeleteSe
 
 DeleteServerCertificateOutcomeCallable IAMClient::DeleteServerCertificateCallable(const DeleteServerCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteServerCertificate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteServerCertificate( request ); } );
 }
 
 void IAMClient::DeleteServerCertificateAsync(const DeleteServerCertificateRequest& request, const DeleteServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1250,6 +1590,16 @@ void IAMClient::DeleteServerCertificateAsync(const DeleteServerCertificateReques
   m_executor->Submit( [this, request, handler, context](){ this->DeleteServerCertificateAsyncHelper( request, handler, context ); } );
 }
 
+DeleteServerCertificateOutcomeCallable IAMClient::DeleteServerCertificateCallable(DeleteServerCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteServerCertificate, this, std::move(request)));
+}
+
+void IAMClient::DeleteServerCertificateAsync(DeleteServerCertificateRequest&& request, const DeleteServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteServerCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteServerCertificateAsyncHelper(const DeleteServerCertificateRequest& request, const DeleteServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteServerCertificate(request), context);
@@ -1272,7 +1622,7 @@ DeleteSigningCertificateOutcome IAMClient::DeleteSigningCertificate(const Delete
 
 DeleteSigningCertificateOutcomeCallable IAMClient::DeleteSigningCertificateCallable(const DeleteSigningCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteSigningCertificate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteSigningCertificate( request ); } );
 }
 
 void IAMClient::DeleteSigningCertificateAsync(const DeleteSigningCertificateRequest& request, const DeleteSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1280,6 +1630,16 @@ void IAMClient::DeleteSigningCertificateAsync(const DeleteSigningCertificateRequ
   m_executor->Submit( [this, request, handler, context](){ this->DeleteSigningCertificateAsyncHelper( request, handler, context ); } );
 }
 
+DeleteSigningCertificateOutcomeCallable IAMClient::DeleteSigningCertificateCallable(DeleteSigningCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteSigningCertificate, this, std::move(request)));
+}
+
+void IAMClient::DeleteSigningCertificateAsync(DeleteSigningCertificateRequest&& request, const DeleteSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteSigningCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteSigningCertificateAsyncHelper(const DeleteSigningCertificateRequest& request, const DeleteSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteSigningCertificate(request), context);
@@ -1302,7 +1662,7 @@ DeleteUserOutcome IAMClient::DeleteUser(const DeleteUserRequest& request) const
 
 DeleteUserOutcomeCallable IAMClient::DeleteUserCallable(const DeleteUserRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteUser( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteUser( request ); } );
 }
 
 void IAMClient::DeleteUserAsync(const DeleteUserRequest& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1310,6 +1670,16 @@ void IAMClient::DeleteUserAsync(const DeleteUserRequest& request, const DeleteUs
   m_executor->Submit( [this, request, handler, context](){ this->DeleteUserAsyncHelper( request, handler, context ); } );
 }
 
+DeleteUserOutcomeCallable IAMClient::DeleteUserCallable(DeleteUserRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteUser, this, std::move(request)));
+}
+
+void IAMClient::DeleteUserAsync(DeleteUserRequest&& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteUserAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteUserAsyncHelper(const DeleteUserRequest& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteUser(request), context);
@@ -1332,7 +1702,7 @@ DeleteUserPolicyOutcome IAMClient::DeleteUserPolicy(const DeleteUserPolicyReques
 
 DeleteUserPolicyOutcomeCallable IAMClient::DeleteUserPolicyCallable(const DeleteUserPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteUserPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteUserPolicy( request ); } );
 }
 
 void IAMClient::DeleteUserPolicyAsync(const DeleteUserPolicyRequest& request, const DeleteUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1340,6 +1710,16 @@ void IAMClient::DeleteUserPolicyAsync(const DeleteUserPolicyRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DeleteUserPolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteUserPolicyOutcomeCallable IAMClient::DeleteUserPolicyCallable(DeleteUserPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteUserPolicy, this, std::move(request)));
+}
+
+void IAMClient::DeleteUserPolicyAsync(DeleteUserPolicyRequest&& request, const DeleteUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteUserPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteUserPolicyAsyncHelper(const DeleteUserPolicyRequest& request, const DeleteUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteUserPolicy(request), context);
@@ -1362,7 +1742,7 @@ DeleteVirtualMFADeviceOutcome IAMClient::DeleteVirtualMFADevice(const DeleteVirt
 
 DeleteVirtualMFADeviceOutcomeCallable IAMClient::DeleteVirtualMFADeviceCallable(const DeleteVirtualMFADeviceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteVirtualMFADevice( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteVirtualMFADevice( request ); } );
 }
 
 void IAMClient::DeleteVirtualMFADeviceAsync(const DeleteVirtualMFADeviceRequest& request, const DeleteVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1370,6 +1750,16 @@ void IAMClient::DeleteVirtualMFADeviceAsync(const DeleteVirtualMFADeviceRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DeleteVirtualMFADeviceAsyncHelper( request, handler, context ); } );
 }
 
+DeleteVirtualMFADeviceOutcomeCallable IAMClient::DeleteVirtualMFADeviceCallable(DeleteVirtualMFADeviceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DeleteVirtualMFADevice, this, std::move(request)));
+}
+
+void IAMClient::DeleteVirtualMFADeviceAsync(DeleteVirtualMFADeviceRequest&& request, const DeleteVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DeleteVirtualMFADeviceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DeleteVirtualMFADeviceAsyncHelper(const DeleteVirtualMFADeviceRequest& request, const DeleteVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteVirtualMFADevice(request), context);
@@ -1392,7 +1782,7 @@ DetachGroupPolicyOutcome IAMClient::DetachGroupPolicy(const DetachGroupPolicyReq
 
 DetachGroupPolicyOutcomeCallable IAMClient::DetachGroupPolicyCallable(const DetachGroupPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachGroupPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachGroupPolicy( request ); } );
 }
 
 void IAMClient::DetachGroupPolicyAsync(const DetachGroupPolicyRequest& request, const DetachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1400,6 +1790,16 @@ void IAMClient::DetachGroupPolicyAsync(const DetachGroupPolicyRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DetachGroupPolicyAsyncHelper( request, handler, context ); } );
 }
 
+DetachGroupPolicyOutcomeCallable IAMClient::DetachGroupPolicyCallable(DetachGroupPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DetachGroupPolicy, this, std::move(request)));
+}
+
+void IAMClient::DetachGroupPolicyAsync(DetachGroupPolicyRequest&& request, const DetachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DetachGroupPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DetachGroupPolicyAsyncHelper(const DetachGroupPolicyRequest& request, const DetachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachGroupPolicy(request), context);
@@ -1422,7 +1822,7 @@ DetachRolePolicyOutcome IAMClient::DetachRolePolicy(const DetachRolePolicyReques
 
 DetachRolePolicyOutcomeCallable IAMClient::DetachRolePolicyCallable(const DetachRolePolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachRolePolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachRolePolicy( request ); } );
 }
 
 void IAMClient::DetachRolePolicyAsync(const DetachRolePolicyRequest& request, const DetachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1430,6 +1830,16 @@ void IAMClient::DetachRolePolicyAsync(const DetachRolePolicyRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DetachRolePolicyAsyncHelper( request, handler, context ); } );
 }
 
+DetachRolePolicyOutcomeCallable IAMClient::DetachRolePolicyCallable(DetachRolePolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DetachRolePolicy, this, std::move(request)));
+}
+
+void IAMClient::DetachRolePolicyAsync(DetachRolePolicyRequest&& request, const DetachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DetachRolePolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DetachRolePolicyAsyncHelper(const DetachRolePolicyRequest& request, const DetachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachRolePolicy(request), context);
@@ -1452,7 +1862,7 @@ DetachUserPolicyOutcome IAMClient::DetachUserPolicy(const DetachUserPolicyReques
 
 DetachUserPolicyOutcomeCallable IAMClient::DetachUserPolicyCallable(const DetachUserPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachUserPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachUserPolicy( request ); } );
 }
 
 void IAMClient::DetachUserPolicyAsync(const DetachUserPolicyRequest& request, const DetachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1460,6 +1870,16 @@ void IAMClient::DetachUserPolicyAsync(const DetachUserPolicyRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DetachUserPolicyAsyncHelper( request, handler, context ); } );
 }
 
+DetachUserPolicyOutcomeCallable IAMClient::DetachUserPolicyCallable(DetachUserPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::DetachUserPolicy, this, std::move(request)));
+}
+
+void IAMClient::DetachUserPolicyAsync(DetachUserPolicyRequest&& request, const DetachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::DetachUserPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::DetachUserPolicyAsyncHelper(const DetachUserPolicyRequest& request, const DetachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachUserPolicy(request), context);
@@ -1482,7 +1902,7 @@ EnableMFADeviceOutcome IAMClient::EnableMFADevice(const EnableMFADeviceRequest&
 
 EnableMFADeviceOutcomeCallable IAMClient::EnableMFADeviceCallable(const EnableMFADeviceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableMFADevice( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableMFADevice( request ); } );
 }
 
 void IAMClient::EnableMFADeviceAsync(const EnableMFADeviceRequest& request, const EnableMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1490,14 +1910,24 @@ void IAMClient::EnableMFADeviceAsync(const EnableMFADeviceRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->EnableMFADeviceAsyncHelper( request, handler, context ); } );
 }
 
-void IAMClient::EnableMFADeviceAsyncHelper(const EnableMFADeviceRequest& request, const EnableMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+EnableMFADeviceOutcomeCallable IAMClient::EnableMFADeviceCallable(EnableMFADeviceRequest&& request) const
 {
-  handler(this, request, EnableMFADevice(request), context);
+  return m_executor->SubmitCallable(std::bind(&IAMClient::EnableMFADevice, this, std::move(request)));
 }
 
-GenerateCredentialReportOutcome IAMClient::GenerateCredentialReport(const GenerateCredentialReportRequest& request) const
+void IAMClient::EnableMFADeviceAsync(EnableMFADeviceRequest&& request, const EnableMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  Aws::StringStream ss;
+  m_executor->Submit(&IAMClient::EnableMFADeviceAsyncHelper, this, std::move(request), handler, context);
+}
+
+void IAMClient::EnableMFADeviceAsyncHelper(const EnableMFADeviceRequest& request, const EnableMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  handler(this, request, EnableMFADevice(request), context);
+}
+
+GenerateCredentialReportOutcome IAMClient::GenerateCredentialReport(const GenerateCredentialReportRequest& request) const
+{
+  Aws::StringStream ss;
   ss << m_uri << "/";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
@@ -1512,7 +1942,7 @@ GenerateCredentialReportOutcome IAMClient::GenerateCredentialReport(const Genera
 
 GenerateCredentialReportOutcomeCallable IAMClient::GenerateCredentialReportCallable(const GenerateCredentialReportRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GenerateCredentialReport( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GenerateCredentialReport( request ); } );
 }
 
 void IAMClient::GenerateCredentialReportAsync(const GenerateCredentialReportRequest& request, const GenerateCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1520,6 +1950,16 @@ void IAMClient::GenerateCredentialReportAsync(const GenerateCredentialReportRequ
   m_executor->Submit( [this, request, handler, context](){ this->GenerateCredentialReportAsyncHelper( request, handler, context ); } );
 }
 
+GenerateCredentialReportOutcomeCallable IAMClient::GenerateCredentialReportCallable(GenerateCredentialReportRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GenerateCredentialReport, this, std::move(request)));
+}
+
+void IAMClient::GenerateCredentialReportAsync(GenerateCredentialReportRequest&& request, const GenerateCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GenerateCredentialReportAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GenerateCredentialReportAsyncHelper(const GenerateCredentialReportRequest& request, const GenerateCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GenerateCredentialReport(request), context);
@@ -1542,7 +1982,7 @@ GetAccessKeyLastUsedOutcome IAMClient::GetAccessKeyLastUsed(const GetAccessKeyLa
 
 GetAccessKeyLastUsedOutcomeCallable IAMClient::GetAccessKeyLastUsedCallable(const GetAccessKeyLastUsedRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetAccessKeyLastUsed( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetAccessKeyLastUsed( request ); } );
 }
 
 void IAMClient::GetAccessKeyLastUsedAsync(const GetAccessKeyLastUsedRequest& request, const GetAccessKeyLastUsedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1550,6 +1990,16 @@ void IAMClient::GetAccessKeyLastUsedAsync(const GetAccessKeyLastUsedRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->GetAccessKeyLastUsedAsyncHelper( request, handler, context ); } );
 }
 
+GetAccessKeyLastUsedOutcomeCallable IAMClient::GetAccessKeyLastUsedCallable(GetAccessKeyLastUsedRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetAccessKeyLastUsed, this, std::move(request)));
+}
+
+void IAMClient::GetAccessKeyLastUsedAsync(GetAccessKeyLastUsedRequest&& request, const GetAccessKeyLastUsedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetAccessKeyLastUsedAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetAccessKeyLastUsedAsyncHelper(const GetAccessKeyLastUsedRequest& request, const GetAccessKeyLastUsedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetAccessKeyLastUsed(request), context);
@@ -1572,7 +2022,7 @@ GetAccountAuthorizationDetailsOutcome IAMClient::GetAccountAuthorizationDetails(
 
 GetAccountAuthorizationDetailsOutcomeCallable IAMClient::GetAccountAuthorizationDetailsCallable(const GetAccountAuthorizationDetailsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetAccountAuthorizationDetails( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetAccountAuthorizationDetails( request ); } );
 }
 
 void IAMClient::GetAccountAuthorizationDetailsAsync(const GetAccountAuthorizationDetailsRequest& request, const GetAccountAuthorizationDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1580,6 +2030,16 @@ void IAMClient::GetAccountAuthorizationDetailsAsync(const GetAccountAuthorizatio
   m_executor->Submit( [this, request, handler, context](){ this->GetAccountAuthorizationDetailsAsyncHelper( request, handler, context ); } );
 }
 
+GetAccountAuthorizationDetailsOutcomeCallable IAMClient::GetAccountAuthorizationDetailsCallable(GetAccountAuthorizationDetailsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetAccountAuthorizationDetails, this, std::move(request)));
+}
+
+void IAMClient::GetAccountAuthorizationDetailsAsync(GetAccountAuthorizationDetailsRequest&& request, const GetAccountAuthorizationDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetAccountAuthorizationDetailsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetAccountAuthorizationDetailsAsyncHelper(const GetAccountAuthorizationDetailsRequest& request, const GetAccountAuthorizationDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetAccountAuthorizationDetails(request), context);
@@ -1602,7 +2062,7 @@ GetAccountPasswordPolicyOutcome IAMClient::GetAccountPasswordPolicy(const GetAcc
 
 GetAccountPasswordPolicyOutcomeCallable IAMClient::GetAccountPasswordPolicyCallable(const GetAccountPasswordPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetAccountPasswordPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetAccountPasswordPolicy( request ); } );
 }
 
 void IAMClient::GetAccountPasswordPolicyAsync(const GetAccountPasswordPolicyRequest& request, const GetAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1610,6 +2070,16 @@ void IAMClient::GetAccountPasswordPolicyAsync(const GetAccountPasswordPolicyRequ
   m_executor->Submit( [this, request, handler, context](){ this->GetAccountPasswordPolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetAccountPasswordPolicyOutcomeCallable IAMClient::GetAccountPasswordPolicyCallable(GetAccountPasswordPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetAccountPasswordPolicy, this, std::move(request)));
+}
+
+void IAMClient::GetAccountPasswordPolicyAsync(GetAccountPasswordPolicyRequest&& request, const GetAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetAccountPasswordPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetAccountPasswordPolicyAsyncHelper(const GetAccountPasswordPolicyRequest& request, const GetAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetAccountPasswordPolicy(request), context);
@@ -1632,7 +2102,7 @@ GetAccountSummaryOutcome IAMClient::GetAccountSummary(const GetAccountSummaryReq
 
 GetAccountSummaryOutcomeCallable IAMClient::GetAccountSummaryCallable(const GetAccountSummaryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetAccountSummary( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetAccountSummary( request ); } );
 }
 
 void IAMClient::GetAccountSummaryAsync(const GetAccountSummaryRequest& request, const GetAccountSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1640,6 +2110,16 @@ void IAMClient::GetAccountSummaryAsync(const GetAccountSummaryRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->GetAccountSummaryAsyncHelper( request, handler, context ); } );
 }
 
+GetAccountSummaryOutcomeCallable IAMClient::GetAccountSummaryCallable(GetAccountSummaryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetAccountSummary, this, std::move(request)));
+}
+
+void IAMClient::GetAccountSummaryAsync(GetAccountSummaryRequest&& request, const GetAccountSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetAccountSummaryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetAccountSummaryAsyncHelper(const GetAccountSummaryRequest& request, const GetAccountSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetAccountSummary(request), context);
@@ -1662,7 +2142,7 @@ GetContextKeysForCustomPolicyOutcome IAMClient::GetContextKeysForCustomPolicy(co
 
 GetContextKeysForCustomPolicyOutcomeCallable IAMClient::GetContextKeysForCustomPolicyCallable(const GetContextKeysForCustomPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetContextKeysForCustomPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetContextKeysForCustomPolicy( request ); } );
 }
 
 void IAMClient::GetContextKeysForCustomPolicyAsync(const GetContextKeysForCustomPolicyRequest& request, const GetContextKeysForCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1670,6 +2150,16 @@ void IAMClient::GetContextKeysForCustomPolicyAsync(const GetContextKeysForCustom
   m_executor->Submit( [this, request, handler, context](){ this->GetContextKeysForCustomPolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetContextKeysForCustomPolicyOutcomeCallable IAMClient::GetContextKeysForCustomPolicyCallable(GetContextKeysForCustomPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetContextKeysForCustomPolicy, this, std::move(request)));
+}
+
+void IAMClient::GetContextKeysForCustomPolicyAsync(GetContextKeysForCustomPolicyRequest&& request, const GetContextKeysForCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetContextKeysForCustomPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetContextKeysForCustomPolicyAsyncHelper(const GetContextKeysForCustomPolicyRequest& request, const GetContextKeysForCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetContextKeysForCustomPolicy(request), context);
@@ -1692,7 +2182,7 @@ GetContextKeysForPrincipalPolicyOutcome IAMClient::GetContextKeysForPrincipalPol
 
 GetContextKeysForPrincipalPolicyOutcomeCallable IAMClient::GetContextKeysForPrincipalPolicyCallable(const GetContextKeysForPrincipalPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetContextKeysForPrincipalPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetContextKeysForPrincipalPolicy( request ); } );
 }
 
 void IAMClient::GetContextKeysForPrincipalPolicyAsync(const GetContextKeysForPrincipalPolicyRequest& request, const GetContextKeysForPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1700,6 +2190,16 @@ void IAMClient::GetContextKeysForPrincipalPolicyAsync(const GetContextKeysForPri
   m_executor->Submit( [this, request, handler, context](){ this->GetContextKeysForPrincipalPolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetContextKeysForPrincipalPolicyOutcomeCallable IAMClient::GetContextKeysForPrincipalPolicyCallable(GetContextKeysForPrincipalPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetContextKeysForPrincipalPolicy, this, std::move(request)));
+}
+
+void IAMClient::GetContextKeysForPrincipalPolicyAsync(GetContextKeysForPrincipalPolicyRequest&& request, const GetContextKeysForPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetContextKeysForPrincipalPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetContextKeysForPrincipalPolicyAsyncHelper(const GetContextKeysForPrincipalPolicyRequest& request, const GetContextKeysForPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetContextKeysForPrincipalPolicy(request), context);
@@ -1722,7 +2222,7 @@ GetCredentialReportOutcome IAMClient::GetCredentialReport(const GetCredentialRep
 
 GetCredentialReportOutcomeCallable IAMClient::GetCredentialReportCallable(const GetCredentialReportRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetCredentialReport( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetCredentialReport( request ); } );
 }
 
 void IAMClient::GetCredentialReportAsync(const GetCredentialReportRequest& request, const GetCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1730,6 +2230,16 @@ void IAMClient::GetCredentialReportAsync(const GetCredentialReportRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->GetCredentialReportAsyncHelper( request, handler, context ); } );
 }
 
+GetCredentialReportOutcomeCallable IAMClient::GetCredentialReportCallable(GetCredentialReportRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetCredentialReport, this, std::move(request)));
+}
+
+void IAMClient::GetCredentialReportAsync(GetCredentialReportRequest&& request, const GetCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetCredentialReportAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetCredentialReportAsyncHelper(const GetCredentialReportRequest& request, const GetCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetCredentialReport(request), context);
@@ -1752,7 +2262,7 @@ GetGroupOutcome IAMClient::GetGroup(const GetGroupRequest& request) const
 
 GetGroupOutcomeCallable IAMClient::GetGroupCallable(const GetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetGroup( request ); } );
 }
 
 void IAMClient::GetGroupAsync(const GetGroupRequest& request, const GetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1760,6 +2270,16 @@ void IAMClient::GetGroupAsync(const GetGroupRequest& request, const GetGroupResp
   m_executor->Submit( [this, request, handler, context](){ this->GetGroupAsyncHelper( request, handler, context ); } );
 }
 
+GetGroupOutcomeCallable IAMClient::GetGroupCallable(GetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetGroup, this, std::move(request)));
+}
+
+void IAMClient::GetGroupAsync(GetGroupRequest&& request, const GetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetGroupAsyncHelper(const GetGroupRequest& request, const GetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetGroup(request), context);
@@ -1782,7 +2302,7 @@ GetGroupPolicyOutcome IAMClient::GetGroupPolicy(const GetGroupPolicyRequest& req
 
 GetGroupPolicyOutcomeCallable IAMClient::GetGroupPolicyCallable(const GetGroupPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetGroupPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetGroupPolicy( request ); } );
 }
 
 void IAMClient::GetGroupPolicyAsync(const GetGroupPolicyRequest& request, const GetGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1790,6 +2310,16 @@ void IAMClient::GetGroupPolicyAsync(const GetGroupPolicyRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->GetGroupPolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetGroupPolicyOutcomeCallable IAMClient::GetGroupPolicyCallable(GetGroupPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetGroupPolicy, this, std::move(request)));
+}
+
+void IAMClient::GetGroupPolicyAsync(GetGroupPolicyRequest&& request, const GetGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetGroupPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetGroupPolicyAsyncHelper(const GetGroupPolicyRequest& request, const GetGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetGroupPolicy(request), context);
@@ -1812,7 +2342,7 @@ GetInstanceProfileOutcome IAMClient::GetInstanceProfile(const GetInstanceProfile
 
 GetInstanceProfileOutcomeCallable IAMClient::GetInstanceProfileCallable(const GetInstanceProfileRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetInstanceProfile( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetInstanceProfile( request ); } );
 }
 
 void IAMClient::GetInstanceProfileAsync(const GetInstanceProfileRequest& request, const GetInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1820,6 +2350,16 @@ void IAMClient::GetInstanceProfileAsync(const GetInstanceProfileRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->GetInstanceProfileAsyncHelper( request, handler, context ); } );
 }
 
+GetInstanceProfileOutcomeCallable IAMClient::GetInstanceProfileCallable(GetInstanceProfileRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetInstanceProfile, this, std::move(request)));
+}
+
+void IAMClient::GetInstanceProfileAsync(GetInstanceProfileRequest&& request, const GetInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetInstanceProfileAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetInstanceProfileAsyncHelper(const GetInstanceProfileRequest& request, const GetInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetInstanceProfile(request), context);
@@ -1842,7 +2382,7 @@ GetLoginProfileOutcome IAMClient::GetLoginProfile(const GetLoginProfileRequest&
 
 GetLoginProfileOutcomeCallable IAMClient::GetLoginProfileCallable(const GetLoginProfileRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetLoginProfile( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetLoginProfile( request ); } );
 }
 
 void IAMClient::GetLoginProfileAsync(const GetLoginProfileRequest& request, const GetLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1850,6 +2390,16 @@ void IAMClient::GetLoginProfileAsync(const GetLoginProfileRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->GetLoginProfileAsyncHelper( request, handler, context ); } );
 }
 
+GetLoginProfileOutcomeCallable IAMClient::GetLoginProfileCallable(GetLoginProfileRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetLoginProfile, this, std::move(request)));
+}
+
+void IAMClient::GetLoginProfileAsync(GetLoginProfileRequest&& request, const GetLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetLoginProfileAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetLoginProfileAsyncHelper(const GetLoginProfileRequest& request, const GetLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetLoginProfile(request), context);
@@ -1872,7 +2422,7 @@ GetOpenIDConnectProviderOutcome IAMClient::GetOpenIDConnectProvider(const GetOpe
 
 GetOpenIDConnectProviderOutcomeCallable IAMClient::GetOpenIDConnectProviderCallable(const GetOpenIDConnectProviderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetOpenIDConnectProvider( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetOpenIDConnectProvider( request ); } );
 }
 
 void IAMClient::GetOpenIDConnectProviderAsync(const GetOpenIDConnectProviderRequest& request, const GetOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1880,6 +2430,16 @@ void IAMClient::GetOpenIDConnectProviderAsync(const GetOpenIDConnectProviderRequ
   m_executor->Submit( [this, request, handler, context](){ this->GetOpenIDConnectProviderAsyncHelper( request, handler, context ); } );
 }
 
+GetOpenIDConnectProviderOutcomeCallable IAMClient::GetOpenIDConnectProviderCallable(GetOpenIDConnectProviderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetOpenIDConnectProvider, this, std::move(request)));
+}
+
+void IAMClient::GetOpenIDConnectProviderAsync(GetOpenIDConnectProviderRequest&& request, const GetOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetOpenIDConnectProviderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetOpenIDConnectProviderAsyncHelper(const GetOpenIDConnectProviderRequest& request, const GetOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetOpenIDConnectProvider(request), context);
@@ -1902,7 +2462,7 @@ GetPolicyOutcome IAMClient::GetPolicy(const GetPolicyRequest& request) const
 
 GetPolicyOutcomeCallable IAMClient::GetPolicyCallable(const GetPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetPolicy( request ); } );
 }
 
 void IAMClient::GetPolicyAsync(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1910,6 +2470,16 @@ void IAMClient::GetPolicyAsync(const GetPolicyRequest& request, const GetPolicyR
   m_executor->Submit( [this, request, handler, context](){ this->GetPolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetPolicyOutcomeCallable IAMClient::GetPolicyCallable(GetPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetPolicy, this, std::move(request)));
+}
+
+void IAMClient::GetPolicyAsync(GetPolicyRequest&& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetPolicyAsyncHelper(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetPolicy(request), context);
@@ -1932,7 +2502,7 @@ GetPolicyVersionOutcome IAMClient::GetPolicyVersion(const GetPolicyVersionReques
 
 GetPolicyVersionOutcomeCallable IAMClient::GetPolicyVersionCallable(const GetPolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetPolicyVersion( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetPolicyVersion( request ); } );
 }
 
 void IAMClient::GetPolicyVersionAsync(const GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1940,6 +2510,16 @@ void IAMClient::GetPolicyVersionAsync(const GetPolicyVersionRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->GetPolicyVersionAsyncHelper( request, handler, context ); } );
 }
 
+GetPolicyVersionOutcomeCallable IAMClient::GetPolicyVersionCallable(GetPolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetPolicyVersion, this, std::move(request)));
+}
+
+void IAMClient::GetPolicyVersionAsync(GetPolicyVersionRequest&& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetPolicyVersionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetPolicyVersionAsyncHelper(const GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetPolicyVersion(request), context);
@@ -1962,7 +2542,7 @@ GetRoleOutcome IAMClient::GetRole(const GetRoleRequest& request) const
 
 GetRoleOutcomeCallable IAMClient::GetRoleCallable(const GetRoleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetRole( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetRole( request ); } );
 }
 
 void IAMClient::GetRoleAsync(const GetRoleRequest& request, const GetRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1970,6 +2550,16 @@ void IAMClient::GetRoleAsync(const GetRoleRequest& request, const GetRoleRespons
   m_executor->Submit( [this, request, handler, context](){ this->GetRoleAsyncHelper( request, handler, context ); } );
 }
 
+GetRoleOutcomeCallable IAMClient::GetRoleCallable(GetRoleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetRole, this, std::move(request)));
+}
+
+void IAMClient::GetRoleAsync(GetRoleRequest&& request, const GetRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetRoleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetRoleAsyncHelper(const GetRoleRequest& request, const GetRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetRole(request), context);
@@ -1992,7 +2582,7 @@ GetRolePolicyOutcome IAMClient::GetRolePolicy(const GetRolePolicyRequest& reques
 
 GetRolePolicyOutcomeCallable IAMClient::GetRolePolicyCallable(const GetRolePolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetRolePolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetRolePolicy( request ); } );
 }
 
 void IAMClient::GetRolePolicyAsync(const GetRolePolicyRequest& request, const GetRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2000,6 +2590,16 @@ void IAMClient::GetRolePolicyAsync(const GetRolePolicyRequest& request, const Ge
   m_executor->Submit( [this, request, handler, context](){ this->GetRolePolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetRolePolicyOutcomeCallable IAMClient::GetRolePolicyCallable(GetRolePolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetRolePolicy, this, std::move(request)));
+}
+
+void IAMClient::GetRolePolicyAsync(GetRolePolicyRequest&& request, const GetRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetRolePolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetRolePolicyAsyncHelper(const GetRolePolicyRequest& request, const GetRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetRolePolicy(request), context);
@@ -2022,7 +2622,7 @@ GetSAMLProviderOutcome IAMClient::GetSAMLProvider(const GetSAMLProviderRequest&
 
 GetSAMLProviderOutcomeCallable IAMClient::GetSAMLProviderCallable(const GetSAMLProviderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetSAMLProvider( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetSAMLProvider( request ); } );
 }
 
 void IAMClient::GetSAMLProviderAsync(const GetSAMLProviderRequest& request, const GetSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2030,6 +2630,16 @@ void IAMClient::GetSAMLProviderAsync(const GetSAMLProviderRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->GetSAMLProviderAsyncHelper( request, handler, context ); } );
 }
 
+GetSAMLProviderOutcomeCallable IAMClient::GetSAMLProviderCallable(GetSAMLProviderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetSAMLProvider, this, std::move(request)));
+}
+
+void IAMClient::GetSAMLProviderAsync(GetSAMLProviderRequest&& request, const GetSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetSAMLProviderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetSAMLProviderAsyncHelper(const GetSAMLProviderRequest& request, const GetSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetSAMLProvider(request), context);
@@ -2052,7 +2662,7 @@ GetSSHPublicKeyOutcome IAMClient::GetSSHPublicKey(const GetSSHPublicKeyRequest&
 
 GetSSHPublicKeyOutcomeCallable IAMClient::GetSSHPublicKeyCallable(const GetSSHPublicKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetSSHPublicKey( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetSSHPublicKey( request ); } );
 }
 
 void IAMClient::GetSSHPublicKeyAsync(const GetSSHPublicKeyRequest& request, const GetSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2060,6 +2670,16 @@ void IAMClient::GetSSHPublicKeyAsync(const GetSSHPublicKeyRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->GetSSHPublicKeyAsyncHelper( request, handler, context ); } );
 }
 
+GetSSHPublicKeyOutcomeCallable IAMClient::GetSSHPublicKeyCallable(GetSSHPublicKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetSSHPublicKey, this, std::move(request)));
+}
+
+void IAMClient::GetSSHPublicKeyAsync(GetSSHPublicKeyRequest&& request, const GetSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetSSHPublicKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetSSHPublicKeyAsyncHelper(const GetSSHPublicKeyRequest& request, const GetSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetSSHPublicKey(request), context);
@@ -2082,7 +2702,7 @@ GetServerCertificateOutcome IAMClient::GetServerCertificate(const GetServerCerti
 
 GetServerCertificateOutcomeCallable IAMClient::GetServerCertificateCallable(const GetServerCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetServerCertificate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetServerCertificate( request ); } );
 }
 
 void IAMClient::GetServerCertificateAsync(const GetServerCertificateRequest& request, const GetServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2090,6 +2710,16 @@ void IAMClient::GetServerCertificateAsync(const GetServerCertificateRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->GetServerCertificateAsyncHelper( request, handler, context ); } );
 }
 
+GetServerCertificateOutcomeCallable IAMClient::GetServerCertificateCallable(GetServerCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetServerCertificate, this, std::move(request)));
+}
+
+void IAMClient::GetServerCertificateAsync(GetServerCertificateRequest&& request, const GetServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetServerCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetServerCertificateAsyncHelper(const GetServerCertificateRequest& request, const GetServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetServerCertificate(request), context);
@@ -2112,7 +2742,7 @@ GetUserOutcome IAMClient::GetUser(const GetUserRequest& request) const
 
 GetUserOutcomeCallable IAMClient::GetUserCallable(const GetUserRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetUser( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetUser( request ); } );
 }
 
 void IAMClient::GetUserAsync(const GetUserRequest& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2120,6 +2750,16 @@ void IAMClient::GetUserAsync(const GetUserRequest& request, const GetUserRespons
   m_executor->Submit( [this, request, handler, context](){ this->GetUserAsyncHelper( request, handler, context ); } );
 }
 
+GetUserOutcomeCallable IAMClient::GetUserCallable(GetUserRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetUser, this, std::move(request)));
+}
+
+void IAMClient::GetUserAsync(GetUserRequest&& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetUserAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetUserAsyncHelper(const GetUserRequest& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetUser(request), context);
@@ -2142,7 +2782,7 @@ GetUserPolicyOutcome IAMClient::GetUserPolicy(const GetUserPolicyRequest& reques
 
 GetUserPolicyOutcomeCallable IAMClient::GetUserPolicyCallable(const GetUserPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetUserPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetUserPolicy( request ); } );
 }
 
 void IAMClient::GetUserPolicyAsync(const GetUserPolicyRequest& request, const GetUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2150,6 +2790,16 @@ void IAMClient::GetUserPolicyAsync(const GetUserPolicyRequest& request, const Ge
   m_executor->Submit( [this, request, handler, context](){ this->GetUserPolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetUserPolicyOutcomeCallable IAMClient::GetUserPolicyCallable(GetUserPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::GetUserPolicy, this, std::move(request)));
+}
+
+void IAMClient::GetUserPolicyAsync(GetUserPolicyRequest&& request, const GetUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::GetUserPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::GetUserPolicyAsyncHelper(const GetUserPolicyRequest& request, const GetUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetUserPolicy(request), context);
@@ -2172,7 +2822,7 @@ ListAccessKeysOutcome IAMClient::ListAccessKeys(const ListAccessKeysRequest& req
 
 ListAccessKeysOutcomeCallable IAMClient::ListAccessKeysCallable(const ListAccessKeysRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAccessKeys( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAccessKeys( request ); } );
 }
 
 void IAMClient::ListAccessKeysAsync(const ListAccessKeysRequest& request, const ListAccessKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2180,6 +2830,16 @@ void IAMClient::ListAccessKeysAsync(const ListAccessKeysRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ListAccessKeysAsyncHelper( request, handler, context ); } );
 }
 
+ListAccessKeysOutcomeCallable IAMClient::ListAccessKeysCallable(ListAccessKeysRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListAccessKeys, this, std::move(request)));
+}
+
+void IAMClient::ListAccessKeysAsync(ListAccessKeysRequest&& request, const ListAccessKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListAccessKeysAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListAccessKeysAsyncHelper(const ListAccessKeysRequest& request, const ListAccessKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAccessKeys(request), context);
@@ -2202,7 +2862,7 @@ ListAccountAliasesOutcome IAMClient::ListAccountAliases(const ListAccountAliases
 
 ListAccountAliasesOutcomeCallable IAMClient::ListAccountAliasesCallable(const ListAccountAliasesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAccountAliases( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAccountAliases( request ); } );
 }
 
 void IAMClient::ListAccountAliasesAsync(const ListAccountAliasesRequest& request, const ListAccountAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2210,6 +2870,16 @@ void IAMClient::ListAccountAliasesAsync(const ListAccountAliasesRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->ListAccountAliasesAsyncHelper( request, handler, context ); } );
 }
 
+ListAccountAliasesOutcomeCallable IAMClient::ListAccountAliasesCallable(ListAccountAliasesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListAccountAliases, this, std::move(request)));
+}
+
+void IAMClient::ListAccountAliasesAsync(ListAccountAliasesRequest&& request, const ListAccountAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListAccountAliasesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListAccountAliasesAsyncHelper(const ListAccountAliasesRequest& request, const ListAccountAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAccountAliases(request), context);
@@ -2232,7 +2902,7 @@ ListAttachedGroupPoliciesOutcome IAMClient::ListAttachedGroupPolicies(const List
 
 ListAttachedGroupPoliciesOutcomeCallable IAMClient::ListAttachedGroupPoliciesCallable(const ListAttachedGroupPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAttachedGroupPolicies( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAttachedGroupPolicies( request ); } );
 }
 
 void IAMClient::ListAttachedGroupPoliciesAsync(const ListAttachedGroupPoliciesRequest& request, const ListAttachedGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2240,6 +2910,16 @@ void IAMClient::ListAttachedGroupPoliciesAsync(const ListAttachedGroupPoliciesRe
   m_executor->Submit( [this, request, handler, context](){ this->ListAttachedGroupPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+ListAttachedGroupPoliciesOutcomeCallable IAMClient::ListAttachedGroupPoliciesCallable(ListAttachedGroupPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListAttachedGroupPolicies, this, std::move(request)));
+}
+
+void IAMClient::ListAttachedGroupPoliciesAsync(ListAttachedGroupPoliciesRequest&& request, const ListAttachedGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListAttachedGroupPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListAttachedGroupPoliciesAsyncHelper(const ListAttachedGroupPoliciesRequest& request, const ListAttachedGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAttachedGroupPolicies(request), context);
@@ -2262,7 +2942,7 @@ ListAttachedRolePoliciesOutcome IAMClient::ListAttachedRolePolicies(const ListAt
 
 ListAttachedRolePoliciesOutcomeCallable IAMClient::ListAttachedRolePoliciesCallable(const ListAttachedRolePoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAttachedRolePolicies( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAttachedRolePolicies( request ); } );
 }
 
 void IAMClient::ListAttachedRolePoliciesAsync(const ListAttachedRolePoliciesRequest& request, const ListAttachedRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2270,6 +2950,16 @@ void IAMClient::ListAttachedRolePoliciesAsync(const ListAttachedRolePoliciesRequ
   m_executor->Submit( [this, request, handler, context](){ this->ListAttachedRolePoliciesAsyncHelper( request, handler, context ); } );
 }
 
+ListAttachedRolePoliciesOutcomeCallable IAMClient::ListAttachedRolePoliciesCallable(ListAttachedRolePoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListAttachedRolePolicies, this, std::move(request)));
+}
+
+void IAMClient::ListAttachedRolePoliciesAsync(ListAttachedRolePoliciesRequest&& request, const ListAttachedRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListAttachedRolePoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListAttachedRolePoliciesAsyncHelper(const ListAttachedRolePoliciesRequest& request, const ListAttachedRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAttachedRolePolicies(request), context);
@@ -2292,7 +2982,7 @@ ListAttachedUserPoliciesOutcome IAMClient::ListAttachedUserPolicies(const ListAt
 
 ListAttachedUserPoliciesOutcomeCallable IAMClient::ListAttachedUserPoliciesCallable(const ListAttachedUserPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAttachedUserPolicies( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAttachedUserPolicies( request ); } );
 }
 
 void IAMClient::ListAttachedUserPoliciesAsync(const ListAttachedUserPoliciesRequest& request, const ListAttachedUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2300,6 +2990,16 @@ void IAMClient::ListAttachedUserPoliciesAsync(const ListAttachedUserPoliciesRequ
   m_executor->Submit( [this, request, handler, context](){ this->ListAttachedUserPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+ListAttachedUserPoliciesOutcomeCallable IAMClient::ListAttachedUserPoliciesCallable(ListAttachedUserPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListAttachedUserPolicies, this, std::move(request)));
+}
+
+void IAMClient::ListAttachedUserPoliciesAsync(ListAttachedUserPoliciesRequest&& request, const ListAttachedUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListAttachedUserPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListAttachedUserPoliciesAsyncHelper(const ListAttachedUserPoliciesRequest& request, const ListAttachedUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAttachedUserPolicies(request), context);
@@ -2322,7 +3022,7 @@ ListEntitiesForPolicyOutcome IAMClient::ListEntitiesForPolicy(const ListEntities
 
 ListEntitiesForPolicyOutcomeCallable IAMClient::ListEntitiesForPolicyCallable(const ListEntitiesForPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListEntitiesForPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListEntitiesForPolicy( request ); } );
 }
 
 void IAMClient::ListEntitiesForPolicyAsync(const ListEntitiesForPolicyRequest& request, const ListEntitiesForPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2330,6 +3030,16 @@ void IAMClient::ListEntitiesForPolicyAsync(const ListEntitiesForPolicyRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->ListEntitiesForPolicyAsyncHelper( request, handler, context ); } );
 }
 
+ListEntitiesForPolicyOutcomeCallable IAMClient::ListEntitiesForPolicyCallable(ListEntitiesForPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListEntitiesForPolicy, this, std::move(request)));
+}
+
+void IAMClient::ListEntitiesForPolicyAsync(ListEntitiesForPolicyRequest&& request, const ListEntitiesForPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListEntitiesForPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListEntitiesForPolicyAsyncHelper(const ListEntitiesForPolicyRequest& request, const ListEntitiesForPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListEntitiesForPolicy(request), context);
@@ -2352,7 +3062,7 @@ ListGroupPoliciesOutcome IAMClient::ListGroupPolicies(const ListGroupPoliciesReq
 
 ListGroupPoliciesOutcomeCallable IAMClient::ListGroupPoliciesCallable(const ListGroupPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListGroupPolicies( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListGroupPolicies( request ); } );
 }
 
 void IAMClient::ListGroupPoliciesAsync(const ListGroupPoliciesRequest& request, const ListGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2360,6 +3070,16 @@ void IAMClient::ListGroupPoliciesAsync(const ListGroupPoliciesRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ListGroupPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+ListGroupPoliciesOutcomeCallable IAMClient::ListGroupPoliciesCallable(ListGroupPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListGroupPolicies, this, std::move(request)));
+}
+
+void IAMClient::ListGroupPoliciesAsync(ListGroupPoliciesRequest&& request, const ListGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListGroupPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListGroupPoliciesAsyncHelper(const ListGroupPoliciesRequest& request, const ListGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListGroupPolicies(request), context);
@@ -2382,7 +3102,7 @@ ListGroupsOutcome IAMClient::ListGroups(const ListGroupsRequest& request) const
 
 ListGroupsOutcomeCallable IAMClient::ListGroupsCallable(const ListGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListGroups( request ); } );
 }
 
 void IAMClient::ListGroupsAsync(const ListGroupsRequest& request, const ListGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2390,6 +3110,16 @@ void IAMClient::ListGroupsAsync(const ListGroupsRequest& request, const ListGrou
   m_executor->Submit( [this, request, handler, context](){ this->ListGroupsAsyncHelper( request, handler, context ); } );
 }
 
+ListGroupsOutcomeCallable IAMClient::ListGroupsCallable(ListGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListGroups, this, std::move(request)));
+}
+
+void IAMClient::ListGroupsAsync(ListGroupsRequest&& request, const ListGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListGroupsAsyncHelper(const ListGroupsRequest& request, const ListGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListGroups(request), context);
@@ -2412,7 +3142,7 @@ ListGroupsForUserOutcome IAMClient::ListGroupsForUser(const ListGroupsForUserReq
 
 ListGroupsForUserOutcomeCallable IAMClient::ListGroupsForUserCallable(const ListGroupsForUserRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListGroupsForUser( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListGroupsForUser( request ); } );
 }
 
 void IAMClient::ListGroupsForUserAsync(const ListGroupsForUserRequest& request, const ListGroupsForUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2420,6 +3150,16 @@ void IAMClient::ListGroupsForUserAsync(const ListGroupsForUserRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ListGroupsForUserAsyncHelper( request, handler, context ); } );
 }
 
+ListGroupsForUserOutcomeCallable IAMClient::ListGroupsForUserCallable(ListGroupsForUserRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListGroupsForUser, this, std::move(request)));
+}
+
+void IAMClient::ListGroupsForUserAsync(ListGroupsForUserRequest&& request, const ListGroupsForUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListGroupsForUserAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListGroupsForUserAsyncHelper(const ListGroupsForUserRequest& request, const ListGroupsForUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListGroupsForUser(request), context);
@@ -2442,7 +3182,7 @@ ListInstanceProfilesOutcome IAMClient::ListInstanceProfiles(const ListInstancePr
 
 ListInstanceProfilesOutcomeCallable IAMClient::ListInstanceProfilesCallable(const ListInstanceProfilesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListInstanceProfiles( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListInstanceProfiles( request ); } );
 }
 
 void IAMClient::ListInstanceProfilesAsync(const ListInstanceProfilesRequest& request, const ListInstanceProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2450,6 +3190,16 @@ void IAMClient::ListInstanceProfilesAsync(const ListInstanceProfilesRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->ListInstanceProfilesAsyncHelper( request, handler, context ); } );
 }
 
+ListInstanceProfilesOutcomeCallable IAMClient::ListInstanceProfilesCallable(ListInstanceProfilesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListInstanceProfiles, this, std::move(request)));
+}
+
+void IAMClient::ListInstanceProfilesAsync(ListInstanceProfilesRequest&& request, const ListInstanceProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListInstanceProfilesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListInstanceProfilesAsyncHelper(const ListInstanceProfilesRequest& request, const ListInstanceProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListInstanceProfiles(request), context);
@@ -2472,7 +3222,7 @@ ListInstanceProfilesForRoleOutcome IAMClient::ListInstanceProfilesForRole(const
 
 ListInstanceProfilesForRoleOutcomeCallable IAMClient::ListInstanceProfilesForRoleCallable(const ListInstanceProfilesForRoleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListInstanceProfilesForRole( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListInstanceProfilesForRole( request ); } );
 }
 
 void IAMClient::ListInstanceProfilesForRoleAsync(const ListInstanceProfilesForRoleRequest& request, const ListInstanceProfilesForRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2480,6 +3230,16 @@ void IAMClient::ListInstanceProfilesForRoleAsync(const ListInstanceProfilesForRo
   m_executor->Submit( [this, request, handler, context](){ this->ListInstanceProfilesForRoleAsyncHelper( request, handler, context ); } );
 }
 
+ListInstanceProfilesForRoleOutcomeCallable IAMClient::ListInstanceProfilesForRoleCallable(ListInstanceProfilesForRoleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListInstanceProfilesForRole, this, std::move(request)));
+}
+
+void IAMClient::ListInstanceProfilesForRoleAsync(ListInstanceProfilesForRoleRequest&& request, const ListInstanceProfilesForRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListInstanceProfilesForRoleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListInstanceProfilesForRoleAsyncHelper(const ListInstanceProfilesForRoleRequest& request, const ListInstanceProfilesForRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListInstanceProfilesForRole(request), context);
@@ -2502,7 +3262,7 @@ ListMFADevicesOutcome IAMClient::ListMFADevices(const ListMFADevicesRequest& req
 
 ListMFADevicesOutcomeCallable IAMClient::ListMFADevicesCallable(const ListMFADevicesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListMFADevices( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListMFADevices( request ); } );
 }
 
 void IAMClient::ListMFADevicesAsync(const ListMFADevicesRequest& request, const ListMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2510,6 +3270,16 @@ void IAMClient::ListMFADevicesAsync(const ListMFADevicesRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ListMFADevicesAsyncHelper( request, handler, context ); } );
 }
 
+ListMFADevicesOutcomeCallable IAMClient::ListMFADevicesCallable(ListMFADevicesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListMFADevices, this, std::move(request)));
+}
+
+void IAMClient::ListMFADevicesAsync(ListMFADevicesRequest&& request, const ListMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListMFADevicesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListMFADevicesAsyncHelper(const ListMFADevicesRequest& request, const ListMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListMFADevices(request), context);
@@ -2532,7 +3302,7 @@ ListOpenIDConnectProvidersOutcome IAMClient::ListOpenIDConnectProviders(const Li
 
 ListOpenIDConnectProvidersOutcomeCallable IAMClient::ListOpenIDConnectProvidersCallable(const ListOpenIDConnectProvidersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListOpenIDConnectProviders( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListOpenIDConnectProviders( request ); } );
 }
 
 void IAMClient::ListOpenIDConnectProvidersAsync(const ListOpenIDConnectProvidersRequest& request, const ListOpenIDConnectProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2540,6 +3310,16 @@ void IAMClient::ListOpenIDConnectProvidersAsync(const ListOpenIDConnectProviders
   m_executor->Submit( [this, request, handler, context](){ this->ListOpenIDConnectProvidersAsyncHelper( request, handler, context ); } );
 }
 
+ListOpenIDConnectProvidersOutcomeCallable IAMClient::ListOpenIDConnectProvidersCallable(ListOpenIDConnectProvidersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListOpenIDConnectProviders, this, std::move(request)));
+}
+
+void IAMClient::ListOpenIDConnectProvidersAsync(ListOpenIDConnectProvidersRequest&& request, const ListOpenIDConnectProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListOpenIDConnectProvidersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListOpenIDConnectProvidersAsyncHelper(const ListOpenIDConnectProvidersRequest& request, const ListOpenIDConnectProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListOpenIDConnectProviders(request), context);
@@ -2562,7 +3342,7 @@ ListPoliciesOutcome IAMClient::ListPolicies(const ListPoliciesRequest& request)
 
 ListPoliciesOutcomeCallable IAMClient::ListPoliciesCallable(const ListPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListPolicies( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListPolicies( request ); } );
 }
 
 void IAMClient::ListPoliciesAsync(const ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2570,6 +3350,16 @@ void IAMClient::ListPoliciesAsync(const ListPoliciesRequest& request, const List
   m_executor->Submit( [this, request, handler, context](){ this->ListPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+ListPoliciesOutcomeCallable IAMClient::ListPoliciesCallable(ListPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListPolicies, this, std::move(request)));
+}
+
+void IAMClient::ListPoliciesAsync(ListPoliciesRequest&& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListPoliciesAsyncHelper(const ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListPolicies(request), context);
@@ -2592,7 +3382,7 @@ ListPolicyVersionsOutcome IAMClient::ListPolicyVersions(const ListPolicyVersions
 
 ListPolicyVersionsOutcomeCallable IAMClient::ListPolicyVersionsCallable(const ListPolicyVersionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListPolicyVersions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListPolicyVersions( request ); } );
 }
 
 void IAMClient::ListPolicyVersionsAsync(const ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2600,6 +3390,16 @@ void IAMClient::ListPolicyVersionsAsync(const ListPolicyVersionsRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->ListPolicyVersionsAsyncHelper( request, handler, context ); } );
 }
 
+ListPolicyVersionsOutcomeCallable IAMClient::ListPolicyVersionsCallable(ListPolicyVersionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListPolicyVersions, this, std::move(request)));
+}
+
+void IAMClient::ListPolicyVersionsAsync(ListPolicyVersionsRequest&& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListPolicyVersionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListPolicyVersionsAsyncHelper(const ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListPolicyVersions(request), context);
@@ -2622,7 +3422,7 @@ ListRolePoliciesOutcome IAMClient::ListRolePolicies(const ListRolePoliciesReques
 
 ListRolePoliciesOutcomeCallable IAMClient::ListRolePoliciesCallable(const ListRolePoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListRolePolicies( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListRolePolicies( request ); } );
 }
 
 void IAMClient::ListRolePoliciesAsync(const ListRolePoliciesRequest& request, const ListRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2630,6 +3430,16 @@ void IAMClient::ListRolePoliciesAsync(const ListRolePoliciesRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->ListRolePoliciesAsyncHelper( request, handler, context ); } );
 }
 
+ListRolePoliciesOutcomeCallable IAMClient::ListRolePoliciesCallable(ListRolePoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListRolePolicies, this, std::move(request)));
+}
+
+void IAMClient::ListRolePoliciesAsync(ListRolePoliciesRequest&& request, const ListRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListRolePoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListRolePoliciesAsyncHelper(const ListRolePoliciesRequest& request, const ListRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListRolePolicies(request), context);
@@ -2652,7 +3462,7 @@ ListRolesOutcome IAMClient::ListRoles(const ListRolesRequest& request) const
 
 ListRolesOutcomeCallable IAMClient::ListRolesCallable(const ListRolesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListRoles( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListRoles( request ); } );
 }
 
 void IAMClient::ListRolesAsync(const ListRolesRequest& request, const ListRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2660,6 +3470,16 @@ void IAMClient::ListRolesAsync(const ListRolesRequest& request, const ListRolesR
   m_executor->Submit( [this, request, handler, context](){ this->ListRolesAsyncHelper( request, handler, context ); } );
 }
 
+ListRolesOutcomeCallable IAMClient::ListRolesCallable(ListRolesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListRoles, this, std::move(request)));
+}
+
+void IAMClient::ListRolesAsync(ListRolesRequest&& request, const ListRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListRolesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListRolesAsyncHelper(const ListRolesRequest& request, const ListRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListRoles(request), context);
@@ -2682,7 +3502,7 @@ ListSAMLProvidersOutcome IAMClient::ListSAMLProviders(const ListSAMLProvidersReq
 
 ListSAMLProvidersOutcomeCallable IAMClient::ListSAMLProvidersCallable(const ListSAMLProvidersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListSAMLProviders( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListSAMLProviders( request ); } );
 }
 
 void IAMClient::ListSAMLProvidersAsync(const ListSAMLProvidersRequest& request, const ListSAMLProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2690,6 +3510,16 @@ void IAMClient::ListSAMLProvidersAsync(const ListSAMLProvidersRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ListSAMLProvidersAsyncHelper( request, handler, context ); } );
 }
 
+ListSAMLProvidersOutcomeCallable IAMClient::ListSAMLProvidersCallable(ListSAMLProvidersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListSAMLProviders, this, std::move(request)));
+}
+
+void IAMClient::ListSAMLProvidersAsync(ListSAMLProvidersRequest&& request, const ListSAMLProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListSAMLProvidersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListSAMLProvidersAsyncHelper(const ListSAMLProvidersRequest& request, const ListSAMLProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListSAMLProviders(request), context);
@@ -2712,7 +3542,7 @@ ListSSHPublicKeysOutcome IAMClient::ListSSHPublicKeys(const ListSSHPublicKeysReq
 
 ListSSHPublicKeysOutcomeCallable IAMClient::ListSSHPublicKeysCallable(const ListSSHPublicKeysRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListSSHPublicKeys( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListSSHPublicKeys( request ); } );
 }
 
 void IAMClient::ListSSHPublicKeysAsync(const ListSSHPublicKeysRequest& request, const ListSSHPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2720,6 +3550,16 @@ void IAMClient::ListSSHPublicKeysAsync(const ListSSHPublicKeysRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ListSSHPublicKeysAsyncHelper( request, handler, context ); } );
 }
 
+ListSSHPublicKeysOutcomeCallable IAMClient::ListSSHPublicKeysCallable(ListSSHPublicKeysRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListSSHPublicKeys, this, std::move(request)));
+}
+
+void IAMClient::ListSSHPublicKeysAsync(ListSSHPublicKeysRequest&& request, const ListSSHPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListSSHPublicKeysAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListSSHPublicKeysAsyncHelper(const ListSSHPublicKeysRequest& request, const ListSSHPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListSSHPublicKeys(request), context);
@@ -2742,7 +3582,7 @@ ListServerCertificatesOutcome IAMClient::ListServerCertificates(const ListServer
 
 ListServerCertificatesOutcomeCallable IAMClient::ListServerCertificatesCallable(const ListServerCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListServerCertificates( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListServerCertificates( request ); } );
 }
 
 void IAMClient::ListServerCertificatesAsync(const ListServerCertificatesRequest& request, const ListServerCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2750,6 +3590,16 @@ void IAMClient::ListServerCertificatesAsync(const ListServerCertificatesRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ListServerCertificatesAsyncHelper( request, handler, context ); } );
 }
 
+ListServerCertificatesOutcomeCallable IAMClient::ListServerCertificatesCallable(ListServerCertificatesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListServerCertificates, this, std::move(request)));
+}
+
+void IAMClient::ListServerCertificatesAsync(ListServerCertificatesRequest&& request, const ListServerCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListServerCertificatesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListServerCertificatesAsyncHelper(const ListServerCertificatesRequest& request, const ListServerCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListServerCertificates(request), context);
@@ -2772,7 +3622,7 @@ ListSigningCertificatesOutcome IAMClient::ListSigningCertificates(const ListSign
 
 ListSigningCertificatesOutcomeCallable IAMClient::ListSigningCertificatesCallable(const ListSigningCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListSigningCertificates( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListSigningCertificates( request ); } );
 }
 
 void IAMClient::ListSigningCertificatesAsync(const ListSigningCertificatesRequest& request, const ListSigningCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2780,6 +3630,16 @@ void IAMClient::ListSigningCertificatesAsync(const ListSigningCertificatesReques
   m_executor->Submit( [this, request, handler, context](){ this->ListSigningCertificatesAsyncHelper( request, handler, context ); } );
 }
 
+ListSigningCertificatesOutcomeCallable IAMClient::ListSigningCertificatesCallable(ListSigningCertificatesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListSigningCertificates, this, std::move(request)));
+}
+
+void IAMClient::ListSigningCertificatesAsync(ListSigningCertificatesRequest&& request, const ListSigningCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListSigningCertificatesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListSigningCertificatesAsyncHelper(const ListSigningCertificatesRequest& request, const ListSigningCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListSigningCertificates(request), context);
@@ -2802,7 +3662,7 @@ ListUserPoliciesOutcome IAMClient::ListUserPolicies(const ListUserPoliciesReques
 
 ListUserPoliciesOutcomeCallable IAMClient::ListUserPoliciesCallable(const ListUserPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListUserPolicies( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListUserPolicies( request ); } );
 }
 
 void IAMClient::ListUserPoliciesAsync(const ListUserPoliciesRequest& request, const ListUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2810,6 +3670,16 @@ void IAMClient::ListUserPoliciesAsync(const ListUserPoliciesRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->ListUserPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+ListUserPoliciesOutcomeCallable IAMClient::ListUserPoliciesCallable(ListUserPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListUserPolicies, this, std::move(request)));
+}
+
+void IAMClient::ListUserPoliciesAsync(ListUserPoliciesRequest&& request, const ListUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListUserPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListUserPoliciesAsyncHelper(const ListUserPoliciesRequest& request, const ListUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListUserPolicies(request), context);
@@ -2832,7 +3702,7 @@ ListUsersOutcome IAMClient::ListUsers(const ListUsersRequest& request) const
 
 ListUsersOutcomeCallable IAMClient::ListUsersCallable(const ListUsersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListUsers( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListUsers( request ); } );
 }
 
 void IAMClient::ListUsersAsync(const ListUsersRequest& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2840,6 +3710,16 @@ void IAMClient::ListUsersAsync(const ListUsersRequest& request, const ListUsersR
   m_executor->Submit( [this, request, handler, context](){ this->ListUsersAsyncHelper( request, handler, context ); } );
 }
 
+ListUsersOutcomeCallable IAMClient::ListUsersCallable(ListUsersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListUsers, this, std::move(request)));
+}
+
+void IAMClient::ListUsersAsync(ListUsersRequest&& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListUsersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListUsersAsyncHelper(const ListUsersRequest& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListUsers(request), context);
@@ -2862,7 +3742,7 @@ ListVirtualMFADevicesOutcome IAMClient::ListVirtualMFADevices(const ListVirtualM
 
 ListVirtualMFADevicesOutcomeCallable IAMClient::ListVirtualMFADevicesCallable(const ListVirtualMFADevicesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListVirtualMFADevices( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListVirtualMFADevices( request ); } );
 }
 
 void IAMClient::ListVirtualMFADevicesAsync(const ListVirtualMFADevicesRequest& request, const ListVirtualMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2870,6 +3750,16 @@ void IAMClient::ListVirtualMFADevicesAsync(const ListVirtualMFADevicesRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->ListVirtualMFADevicesAsyncHelper( request, handler, context ); } );
 }
 
+ListVirtualMFADevicesOutcomeCallable IAMClient::ListVirtualMFADevicesCallable(ListVirtualMFADevicesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ListVirtualMFADevices, this, std::move(request)));
+}
+
+void IAMClient::ListVirtualMFADevicesAsync(ListVirtualMFADevicesRequest&& request, const ListVirtualMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ListVirtualMFADevicesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ListVirtualMFADevicesAsyncHelper(const ListVirtualMFADevicesRequest& request, const ListVirtualMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListVirtualMFADevices(request), context);
@@ -2892,7 +3782,7 @@ PutGroupPolicyOutcome IAMClient::PutGroupPolicy(const PutGroupPolicyRequest& req
 
 PutGroupPolicyOutcomeCallable IAMClient::PutGroupPolicyCallable(const PutGroupPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutGroupPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutGroupPolicy( request ); } );
 }
 
 void IAMClient::PutGroupPolicyAsync(const PutGroupPolicyRequest& request, const PutGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2900,6 +3790,16 @@ void IAMClient::PutGroupPolicyAsync(const PutGroupPolicyRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->PutGroupPolicyAsyncHelper( request, handler, context ); } );
 }
 
+PutGroupPolicyOutcomeCallable IAMClient::PutGroupPolicyCallable(PutGroupPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::PutGroupPolicy, this, std::move(request)));
+}
+
+void IAMClient::PutGroupPolicyAsync(PutGroupPolicyRequest&& request, const PutGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::PutGroupPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::PutGroupPolicyAsyncHelper(const PutGroupPolicyRequest& request, const PutGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutGroupPolicy(request), context);
@@ -2922,7 +3822,7 @@ PutRolePolicyOutcome IAMClient::PutRolePolicy(const PutRolePolicyRequest& reques
 
 PutRolePolicyOutcomeCallable IAMClient::PutRolePolicyCallable(const PutRolePolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutRolePolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutRolePolicy( request ); } );
 }
 
 void IAMClient::PutRolePolicyAsync(const PutRolePolicyRequest& request, const PutRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2930,6 +3830,16 @@ void IAMClient::PutRolePolicyAsync(const PutRolePolicyRequest& request, const Pu
   m_executor->Submit( [this, request, handler, context](){ this->PutRolePolicyAsyncHelper( request, handler, context ); } );
 }
 
+PutRolePolicyOutcomeCallable IAMClient::PutRolePolicyCallable(PutRolePolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::PutRolePolicy, this, std::move(request)));
+}
+
+void IAMClient::PutRolePolicyAsync(PutRolePolicyRequest&& request, const PutRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::PutRolePolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::PutRolePolicyAsyncHelper(const PutRolePolicyRequest& request, const PutRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutRolePolicy(request), context);
@@ -2952,7 +3862,7 @@ PutUserPolicyOutcome IAMClient::PutUserPolicy(const PutUserPolicyRequest& reques
 
 PutUserPolicyOutcomeCallable IAMClient::PutUserPolicyCallable(const PutUserPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutUserPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutUserPolicy( request ); } );
 }
 
 void IAMClient::PutUserPolicyAsync(const PutUserPolicyRequest& request, const PutUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2960,6 +3870,16 @@ void IAMClient::PutUserPolicyAsync(const PutUserPolicyRequest& request, const Pu
   m_executor->Submit( [this, request, handler, context](){ this->PutUserPolicyAsyncHelper( request, handler, context ); } );
 }
 
+PutUserPolicyOutcomeCallable IAMClient::PutUserPolicyCallable(PutUserPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::PutUserPolicy, this, std::move(request)));
+}
+
+void IAMClient::PutUserPolicyAsync(PutUserPolicyRequest&& request, const PutUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::PutUserPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::PutUserPolicyAsyncHelper(const PutUserPolicyRequest& request, const PutUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutUserPolicy(request), context);
@@ -2982,7 +3902,7 @@ RemoveClientIDFromOpenIDConnectProviderOutcome IAMClient::RemoveClientIDFromOpen
 
 RemoveClientIDFromOpenIDConnectProviderOutcomeCallable IAMClient::RemoveClientIDFromOpenIDConnectProviderCallable(const RemoveClientIDFromOpenIDConnectProviderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveClientIDFromOpenIDConnectProvider( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveClientIDFromOpenIDConnectProvider( request ); } );
 }
 
 void IAMClient::RemoveClientIDFromOpenIDConnectProviderAsync(const RemoveClientIDFromOpenIDConnectProviderRequest& request, const RemoveClientIDFromOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2990,6 +3910,16 @@ void IAMClient::RemoveClientIDFromOpenIDConnectProviderAsync(const RemoveClientI
   m_executor->Submit( [this, request, handler, context](){ this->RemoveClientIDFromOpenIDConnectProviderAsyncHelper( request, handler, context ); } );
 }
 
+RemoveClientIDFromOpenIDConnectProviderOutcomeCallable IAMClient::RemoveClientIDFromOpenIDConnectProviderCallable(RemoveClientIDFromOpenIDConnectProviderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::RemoveClientIDFromOpenIDConnectProvider, this, std::move(request)));
+}
+
+void IAMClient::RemoveClientIDFromOpenIDConnectProviderAsync(RemoveClientIDFromOpenIDConnectProviderRequest&& request, const RemoveClientIDFromOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::RemoveClientIDFromOpenIDConnectProviderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::RemoveClientIDFromOpenIDConnectProviderAsyncHelper(const RemoveClientIDFromOpenIDConnectProviderRequest& request, const RemoveClientIDFromOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveClientIDFromOpenIDConnectProvider(request), context);
@@ -3012,7 +3942,7 @@ RemoveRoleFromInstanceProfileOutcome IAMClient::RemoveRoleFromInstanceProfile(co
 
 RemoveRoleFromInstanceProfileOutcomeCallable IAMClient::RemoveRoleFromInstanceProfileCallable(const RemoveRoleFromInstanceProfileRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveRoleFromInstanceProfile( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveRoleFromInstanceProfile( request ); } );
 }
 
 void IAMClient::RemoveRoleFromInstanceProfileAsync(const RemoveRoleFromInstanceProfileRequest& request, const RemoveRoleFromInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3020,6 +3950,16 @@ void IAMClient::RemoveRoleFromInstanceProfileAsync(const RemoveRoleFromInstanceP
   m_executor->Submit( [this, request, handler, context](){ this->RemoveRoleFromInstanceProfileAsyncHelper( request, handler, context ); } );
 }
 
+RemoveRoleFromInstanceProfileOutcomeCallable IAMClient::RemoveRoleFromInstanceProfileCallable(RemoveRoleFromInstanceProfileRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::RemoveRoleFromInstanceProfile, this, std::move(request)));
+}
+
+void IAMClient::RemoveRoleFromInstanceProfileAsync(RemoveRoleFromInstanceProfileRequest&& request, const RemoveRoleFromInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::RemoveRoleFromInstanceProfileAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::RemoveRoleFromInstanceProfileAsyncHelper(const RemoveRoleFromInstanceProfileRequest& request, const RemoveRoleFromInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveRoleFromInstanceProfile(request), context);
@@ -3042,7 +3982,7 @@ RemoveUserFromGroupOutcome IAMClient::RemoveUserFromGroup(const RemoveUserFromGr
 
 RemoveUserFromGroupOutcomeCallable IAMClient::RemoveUserFromGroupCallable(const RemoveUserFromGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveUserFromGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveUserFromGroup( request ); } );
 }
 
 void IAMClient::RemoveUserFromGroupAsync(const RemoveUserFromGroupRequest& request, const RemoveUserFromGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3050,6 +3990,16 @@ void IAMClient::RemoveUserFromGroupAsync(const RemoveUserFromGroupRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->RemoveUserFromGroupAsyncHelper( request, handler, context ); } );
 }
 
+RemoveUserFromGroupOutcomeCallable IAMClient::RemoveUserFromGroupCallable(RemoveUserFromGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::RemoveUserFromGroup, this, std::move(request)));
+}
+
+void IAMClient::RemoveUserFromGroupAsync(RemoveUserFromGroupRequest&& request, const RemoveUserFromGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::RemoveUserFromGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::RemoveUserFromGroupAsyncHelper(const RemoveUserFromGroupRequest& request, const RemoveUserFromGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveUserFromGroup(request), context);
@@ -3072,7 +4022,7 @@ ResyncMFADeviceOutcome IAMClient::ResyncMFADevice(const ResyncMFADeviceRequest&
 
 ResyncMFADeviceOutcomeCallable IAMClient::ResyncMFADeviceCallable(const ResyncMFADeviceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResyncMFADevice( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResyncMFADevice( request ); } );
 }
 
 void IAMClient::ResyncMFADeviceAsync(const ResyncMFADeviceRequest& request, const ResyncMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3080,6 +4030,16 @@ void IAMClient::ResyncMFADeviceAsync(const ResyncMFADeviceRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->ResyncMFADeviceAsyncHelper( request, handler, context ); } );
 }
 
+ResyncMFADeviceOutcomeCallable IAMClient::ResyncMFADeviceCallable(ResyncMFADeviceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::ResyncMFADevice, this, std::move(request)));
+}
+
+void IAMClient::ResyncMFADeviceAsync(ResyncMFADeviceRequest&& request, const ResyncMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::ResyncMFADeviceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::ResyncMFADeviceAsyncHelper(const ResyncMFADeviceRequest& request, const ResyncMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResyncMFADevice(request), context);
@@ -3102,7 +4062,7 @@ SetDefaultPolicyVersionOutcome IAMClient::SetDefaultPolicyVersion(const SetDefau
 
 SetDefaultPolicyVersionOutcomeCallable IAMClient::SetDefaultPolicyVersionCallable(const SetDefaultPolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetDefaultPolicyVersion( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetDefaultPolicyVersion( request ); } );
 }
 
 void IAMClient::SetDefaultPolicyVersionAsync(const SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3110,6 +4070,16 @@ void IAMClient::SetDefaultPolicyVersionAsync(const SetDefaultPolicyVersionReques
   m_executor->Submit( [this, request, handler, context](){ this->SetDefaultPolicyVersionAsyncHelper( request, handler, context ); } );
 }
 
+SetDefaultPolicyVersionOutcomeCallable IAMClient::SetDefaultPolicyVersionCallable(SetDefaultPolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::SetDefaultPolicyVersion, this, std::move(request)));
+}
+
+void IAMClient::SetDefaultPolicyVersionAsync(SetDefaultPolicyVersionRequest&& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::SetDefaultPolicyVersionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::SetDefaultPolicyVersionAsyncHelper(const SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetDefaultPolicyVersion(request), context);
@@ -3132,7 +4102,7 @@ SimulateCustomPolicyOutcome IAMClient::SimulateCustomPolicy(const SimulateCustom
 
 SimulateCustomPolicyOutcomeCallable IAMClient::SimulateCustomPolicyCallable(const SimulateCustomPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SimulateCustomPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SimulateCustomPolicy( request ); } );
 }
 
 void IAMClient::SimulateCustomPolicyAsync(const SimulateCustomPolicyRequest& request, const SimulateCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3140,6 +4110,16 @@ void IAMClient::SimulateCustomPolicyAsync(const SimulateCustomPolicyRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->SimulateCustomPolicyAsyncHelper( request, handler, context ); } );
 }
 
+SimulateCustomPolicyOutcomeCallable IAMClient::SimulateCustomPolicyCallable(SimulateCustomPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::SimulateCustomPolicy, this, std::move(request)));
+}
+
+void IAMClient::SimulateCustomPolicyAsync(SimulateCustomPolicyRequest&& request, const SimulateCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::SimulateCustomPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::SimulateCustomPolicyAsyncHelper(const SimulateCustomPolicyRequest& request, const SimulateCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SimulateCustomPolicy(request), context);
@@ -3162,7 +4142,7 @@ SimulatePrincipalPolicyOutcome IAMClient::SimulatePrincipalPolicy(const Simulate
 
 SimulatePrincipalPolicyOutcomeCallable IAMClient::SimulatePrincipalPolicyCallable(const SimulatePrincipalPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SimulatePrincipalPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SimulatePrincipalPolicy( request ); } );
 }
 
 void IAMClient::SimulatePrincipalPolicyAsync(const SimulatePrincipalPolicyRequest& request, const SimulatePrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3170,6 +4150,16 @@ void IAMClient::SimulatePrincipalPolicyAsync(const SimulatePrincipalPolicyReques
   m_executor->Submit( [this, request, handler, context](){ this->SimulatePrincipalPolicyAsyncHelper( request, handler, context ); } );
 }
 
+SimulatePrincipalPolicyOutcomeCallable IAMClient::SimulatePrincipalPolicyCallable(SimulatePrincipalPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::SimulatePrincipalPolicy, this, std::move(request)));
+}
+
+void IAMClient::SimulatePrincipalPolicyAsync(SimulatePrincipalPolicyRequest&& request, const SimulatePrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::SimulatePrincipalPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::SimulatePrincipalPolicyAsyncHelper(const SimulatePrincipalPolicyRequest& request, const SimulatePrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SimulatePrincipalPolicy(request), context);
@@ -3192,7 +4182,7 @@ UpdateAccessKeyOutcome IAMClient::UpdateAccessKey(const UpdateAccessKeyRequest&
 
 UpdateAccessKeyOutcomeCallable IAMClient::UpdateAccessKeyCallable(const UpdateAccessKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateAccessKey( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateAccessKey( request ); } );
 }
 
 void IAMClient::UpdateAccessKeyAsync(const UpdateAccessKeyRequest& request, const UpdateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3200,6 +4190,16 @@ void IAMClient::UpdateAccessKeyAsync(const UpdateAccessKeyRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->UpdateAccessKeyAsyncHelper( request, handler, context ); } );
 }
 
+UpdateAccessKeyOutcomeCallable IAMClient::UpdateAccessKeyCallable(UpdateAccessKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::UpdateAccessKey, this, std::move(request)));
+}
+
+void IAMClient::UpdateAccessKeyAsync(UpdateAccessKeyRequest&& request, const UpdateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::UpdateAccessKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::UpdateAccessKeyAsyncHelper(const UpdateAccessKeyRequest& request, const UpdateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateAccessKey(request), context);
@@ -3222,7 +4222,7 @@ UpdateAccountPasswordPolicyOutcome IAMClient::UpdateAccountPasswordPolicy(const
 
 UpdateAccountPasswordPolicyOutcomeCallable IAMClient::UpdateAccountPasswordPolicyCallable(const UpdateAccountPasswordPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateAccountPasswordPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateAccountPasswordPolicy( request ); } );
 }
 
 void IAMClient::UpdateAccountPasswordPolicyAsync(const UpdateAccountPasswordPolicyRequest& request, const UpdateAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3230,6 +4230,16 @@ void IAMClient::UpdateAccountPasswordPolicyAsync(const UpdateAccountPasswordPoli
   m_executor->Submit( [this, request, handler, context](){ this->UpdateAccountPasswordPolicyAsyncHelper( request, handler, context ); } );
 }
 
+UpdateAccountPasswordPolicyOutcomeCallable IAMClient::UpdateAccountPasswordPolicyCallable(UpdateAccountPasswordPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::UpdateAccountPasswordPolicy, this, std::move(request)));
+}
+
+void IAMClient::UpdateAccountPasswordPolicyAsync(UpdateAccountPasswordPolicyRequest&& request, const UpdateAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::UpdateAccountPasswordPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::UpdateAccountPasswordPolicyAsyncHelper(const UpdateAccountPasswordPolicyRequest& request, const UpdateAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateAccountPasswordPolicy(request), context);
@@ -3252,7 +4262,7 @@ UpdateAssumeRolePolicyOutcome IAMClient::UpdateAssumeRolePolicy(const UpdateAssu
 
 UpdateAssumeRolePolicyOutcomeCallable IAMClient::UpdateAssumeRolePolicyCallable(const UpdateAssumeRolePolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateAssumeRolePolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateAssumeRolePolicy( request ); } );
 }
 
 void IAMClient::UpdateAssumeRolePolicyAsync(const UpdateAssumeRolePolicyRequest& request, const UpdateAssumeRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3260,6 +4270,16 @@ void IAMClient::UpdateAssumeRolePolicyAsync(const UpdateAssumeRolePolicyRequest&
   m_executor->Submit( [this, request, handler, context](){ this->UpdateAssumeRolePolicyAsyncHelper( request, handler, context ); } );
 }
 
+UpdateAssumeRolePolicyOutcomeCallable IAMClient::UpdateAssumeRolePolicyCallable(UpdateAssumeRolePolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::UpdateAssumeRolePolicy, this, std::move(request)));
+}
+
+void IAMClient::UpdateAssumeRolePolicyAsync(UpdateAssumeRolePolicyRequest&& request, const UpdateAssumeRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::UpdateAssumeRolePolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::UpdateAssumeRolePolicyAsyncHelper(const UpdateAssumeRolePolicyRequest& request, const UpdateAssumeRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateAssumeRolePolicy(request), context);
@@ -3282,7 +4302,7 @@ UpdateGroupOutcome IAMClient::UpdateGroup(const UpdateGroupRequest& request) con
 
 UpdateGroupOutcomeCallable IAMClient::UpdateGroupCallable(const UpdateGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateGroup( request ); } );
 }
 
 void IAMClient::UpdateGroupAsync(const UpdateGroupRequest& request, const UpdateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3290,6 +4310,16 @@ void IAMClient::UpdateGroupAsync(const UpdateGroupRequest& request, const Update
   m_executor->Submit( [this, request, handler, context](){ this->UpdateGroupAsyncHelper( request, handler, context ); } );
 }
 
+UpdateGroupOutcomeCallable IAMClient::UpdateGroupCallable(UpdateGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::UpdateGroup, this, std::move(request)));
+}
+
+void IAMClient::UpdateGroupAsync(UpdateGroupRequest&& request, const UpdateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::UpdateGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::UpdateGroupAsyncHelper(const UpdateGroupRequest& request, const UpdateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateGroup(request), context);
@@ -3312,7 +4342,7 @@ UpdateLoginProfileOutcome IAMClient::UpdateLoginProfile(const UpdateLoginProfile
 
 UpdateLoginProfileOutcomeCallable IAMClient::UpdateLoginProfileCallable(const UpdateLoginProfileRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateLoginProfile( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateLoginProfile( request ); } );
 }
 
 void IAMClient::UpdateLoginProfileAsync(const UpdateLoginProfileRequest& request, const UpdateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3320,6 +4350,16 @@ void IAMClient::UpdateLoginProfileAsync(const UpdateLoginProfileRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->UpdateLoginProfileAsyncHelper( request, handler, context ); } );
 }
 
+UpdateLoginProfileOutcomeCallable IAMClient::UpdateLoginProfileCallable(UpdateLoginProfileRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::UpdateLoginProfile, this, std::move(request)));
+}
+
+void IAMClient::UpdateLoginProfileAsync(UpdateLoginProfileRequest&& request, const UpdateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::UpdateLoginProfileAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::UpdateLoginProfileAsyncHelper(const UpdateLoginProfileRequest& request, const UpdateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateLoginProfile(request), context);
@@ -3342,7 +4382,7 @@ UpdateOpenIDConnectProviderThumbprintOutcome IAMClient::UpdateOpenIDConnectProvi
 
 UpdateOpenIDConnectProviderThumbprintOutcomeCallable IAMClient::UpdateOpenIDConnectProviderThumbprintCallable(const UpdateOpenIDConnectProviderThumbprintRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateOpenIDConnectProviderThumbprint( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateOpenIDConnectProviderThumbprint( request ); } );
 }
 
 void IAMClient::UpdateOpenIDConnectProviderThumbprintAsync(const UpdateOpenIDConnectProviderThumbprintRequest& request, const UpdateOpenIDConnectProviderThumbprintResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3350,6 +4390,16 @@ void IAMClient::UpdateOpenIDConnectProviderThumbprintAsync(const UpdateOpenIDCon
   m_executor->Submit( [this, request, handler, context](){ this->UpdateOpenIDConnectProviderThumbprintAsyncHelper( request, handler, context ); } );
 }
 
+UpdateOpenIDConnectProviderThumbprintOutcomeCallable IAMClient::UpdateOpenIDConnectProviderThumbprintCallable(UpdateOpenIDConnectProviderThumbprintRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::UpdateOpenIDConnectProviderThumbprint, this, std::move(request)));
+}
+
+void IAMClient::UpdateOpenIDConnectProviderThumbprintAsync(UpdateOpenIDConnectProviderThumbprintRequest&& request, const UpdateOpenIDConnectProviderThumbprintResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::UpdateOpenIDConnectProviderThumbprintAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::UpdateOpenIDConnectProviderThumbprintAsyncHelper(const UpdateOpenIDConnectProviderThumbprintRequest& request, const UpdateOpenIDConnectProviderThumbprintResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateOpenIDConnectProviderThumbprint(request), context);
@@ -3372,7 +4422,7 @@ UpdateSAMLProviderOutcome IAMClient::UpdateSAMLProvider(const UpdateSAMLProvider
 
 UpdateSAMLProviderOutcomeCallable IAMClient::UpdateSAMLProviderCallable(const UpdateSAMLProviderRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateSAMLProvider( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateSAMLProvider( request ); } );
 }
 
 void IAMClient::UpdateSAMLProviderAsync(const UpdateSAMLProviderRequest& request, const UpdateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3380,6 +4430,16 @@ void IAMClient::UpdateSAMLProviderAsync(const UpdateSAMLProviderRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->UpdateSAMLProviderAsyncHelper( request, handler, context ); } );
 }
 
+UpdateSAMLProviderOutcomeCallable IAMClient::UpdateSAMLProviderCallable(UpdateSAMLProviderRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::UpdateSAMLProvider, this, std::move(request)));
+}
+
+void IAMClient::UpdateSAMLProviderAsync(UpdateSAMLProviderRequest&& request, const UpdateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::UpdateSAMLProviderAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::UpdateSAMLProviderAsyncHelper(const UpdateSAMLProviderRequest& request, const UpdateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateSAMLProvider(request), context);
@@ -3402,7 +4462,7 @@ UpdateSSHPublicKeyOutcome IAMClient::UpdateSSHPublicKey(const UpdateSSHPublicKey
 
 UpdateSSHPublicKeyOutcomeCallable IAMClient::UpdateSSHPublicKeyCallable(const UpdateSSHPublicKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateSSHPublicKey( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateSSHPublicKey( request ); } );
 }
 
 void IAMClient::UpdateSSHPublicKeyAsync(const UpdateSSHPublicKeyRequest& request, const UpdateSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3410,6 +4470,16 @@ void IAMClient::UpdateSSHPublicKeyAsync(const UpdateSSHPublicKeyRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->UpdateSSHPublicKeyAsyncHelper( request, handler, context ); } );
 }
 
+UpdateSSHPublicKeyOutcomeCallable IAMClient::UpdateSSHPublicKeyCallable(UpdateSSHPublicKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::UpdateSSHPublicKey, this, std::move(request)));
+}
+
+void IAMClient::UpdateSSHPublicKeyAsync(UpdateSSHPublicKeyRequest&& request, const UpdateSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::UpdateSSHPublicKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::UpdateSSHPublicKeyAsyncHelper(const UpdateSSHPublicKeyRequest& request, const UpdateSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateSSHPublicKey(request), context);
@@ -3432,7 +4502,7 @@ UpdateServerCertificateOutcome IAMClient::UpdateServerCertificate(const UpdateSe
 
 UpdateServerCertificateOutcomeCallable IAMClient::UpdateServerCertificateCallable(const UpdateServerCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateServerCertificate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateServerCertificate( request ); } );
 }
 
 void IAMClient::UpdateServerCertificateAsync(const UpdateServerCertificateRequest& request, const UpdateServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3440,6 +4510,16 @@ void IAMClient::UpdateServerCertificateAsync(const UpdateServerCertificateReques
   m_executor->Submit( [this, request, handler, context](){ this->UpdateServerCertificateAsyncHelper( request, handler, context ); } );
 }
 
+UpdateServerCertificateOutcomeCallable IAMClient::UpdateServerCertificateCallable(UpdateServerCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::UpdateServerCertificate, this, std::move(request)));
+}
+
+void IAMClient::UpdateServerCertificateAsync(UpdateServerCertificateRequest&& request, const UpdateServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::UpdateServerCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::UpdateServerCertificateAsyncHelper(const UpdateServerCertificateRequest& request, const UpdateServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateServerCertificate(request), context);
@@ -3462,7 +4542,7 @@ UpdateSigningCertificateOutcome IAMClient::UpdateSigningCertificate(const Update
 
 UpdateSigningCertificateOutcomeCallable IAMClient::UpdateSigningCertificateCallable(const UpdateSigningCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateSigningCertificate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateSigningCertificate( request ); } );
 }
 
 void IAMClient::UpdateSigningCertificateAsync(const UpdateSigningCertificateRequest& request, const UpdateSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3470,6 +4550,16 @@ void IAMClient::UpdateSigningCertificateAsync(const UpdateSigningCertificateRequ
   m_executor->Submit( [this, request, handler, context](){ this->UpdateSigningCertificateAsyncHelper( request, handler, context ); } );
 }
 
+UpdateSigningCertificateOutcomeCallable IAMClient::UpdateSigningCertificateCallable(UpdateSigningCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::UpdateSigningCertificate, this, std::move(request)));
+}
+
+void IAMClient::UpdateSigningCertificateAsync(UpdateSigningCertificateRequest&& request, const UpdateSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::UpdateSigningCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::UpdateSigningCertificateAsyncHelper(const UpdateSigningCertificateRequest& request, const UpdateSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateSigningCertificate(request), context);
@@ -3492,7 +4582,7 @@ UpdateUserOutcome IAMClient::UpdateUser(const UpdateUserRequest& request) const
 
 UpdateUserOutcomeCallable IAMClient::UpdateUserCallable(const UpdateUserRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateUser( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateUser( request ); } );
 }
 
 void IAMClient::UpdateUserAsync(const UpdateUserRequest& request, const UpdateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3500,6 +4590,16 @@ void IAMClient::UpdateUserAsync(const UpdateUserRequest& request, const UpdateUs
   m_executor->Submit( [this, request, handler, context](){ this->UpdateUserAsyncHelper( request, handler, context ); } );
 }
 
+UpdateUserOutcomeCallable IAMClient::UpdateUserCallable(UpdateUserRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::UpdateUser, this, std::move(request)));
+}
+
+void IAMClient::UpdateUserAsync(UpdateUserRequest&& request, const UpdateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::UpdateUserAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::UpdateUserAsyncHelper(const UpdateUserRequest& request, const UpdateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateUser(request), context);
@@ -3522,7 +4622,7 @@ UploadSSHPublicKeyOutcome IAMClient::UploadSSHPublicKey(const UploadSSHPublicKey
 
 UploadSSHPublicKeyOutcomeCallable IAMClient::UploadSSHPublicKeyCallable(const UploadSSHPublicKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UploadSSHPublicKey( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UploadSSHPublicKey( request ); } );
 }
 
 void IAMClient::UploadSSHPublicKeyAsync(const UploadSSHPublicKeyRequest& request, const UploadSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3530,6 +4630,16 @@ void IAMClient::UploadSSHPublicKeyAsync(const UploadSSHPublicKeyRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->UploadSSHPublicKeyAsyncHelper( request, handler, context ); } );
 }
 
+UploadSSHPublicKeyOutcomeCallable IAMClient::UploadSSHPublicKeyCallable(UploadSSHPublicKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::UploadSSHPublicKey, this, std::move(request)));
+}
+
+void IAMClient::UploadSSHPublicKeyAsync(UploadSSHPublicKeyRequest&& request, const UploadSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::UploadSSHPublicKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::UploadSSHPublicKeyAsyncHelper(const UploadSSHPublicKeyRequest& request, const UploadSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UploadSSHPublicKey(request), context);
@@ -3552,7 +4662,7 @@ UploadServerCertificateOutcome IAMClient::UploadServerCertificate(const UploadSe
 
 UploadServerCertificateOutcomeCallable IAMClient::UploadServerCertificateCallable(const UploadServerCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UploadServerCertificate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UploadServerCertificate( request ); } );
 }
 
 void IAMClient::UploadServerCertificateAsync(const UploadServerCertificateRequest& request, const UploadServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3560,6 +4670,16 @@ void IAMClient::UploadServerCertificateAsync(const UploadServerCertificateReques
   m_executor->Submit( [this, request, handler, context](){ this->UploadServerCertificateAsyncHelper( request, handler, context ); } );
 }
 
+UploadServerCertificateOutcomeCallable IAMClient::UploadServerCertificateCallable(UploadServerCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::UploadServerCertificate, this, std::move(request)));
+}
+
+void IAMClient::UploadServerCertificateAsync(UploadServerCertificateRequest&& request, const UploadServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::UploadServerCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::UploadServerCertificateAsyncHelper(const UploadServerCertificateRequest& request, const UploadServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UploadServerCertificate(request), context);
@@ -3582,7 +4702,7 @@ UploadSigningCertificateOutcome IAMClient::UploadSigningCertificate(const Upload
 
 UploadSigningCertificateOutcomeCallable IAMClient::UploadSigningCertificateCallable(const UploadSigningCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UploadSigningCertificate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UploadSigningCertificate( request ); } );
 }
 
 void IAMClient::UploadSigningCertificateAsync(const UploadSigningCertificateRequest& request, const UploadSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3590,8 +4710,1131 @@ void IAMClient::UploadSigningCertificateAsync(const UploadSigningCertificateRequ
   m_executor->Submit( [this, request, handler, context](){ this->UploadSigningCertificateAsyncHelper( request, handler, context ); } );
 }
 
+UploadSigningCertificateOutcomeCallable IAMClient::UploadSigningCertificateCallable(UploadSigningCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IAMClient::UploadSigningCertificate, this, std::move(request)));
+}
+
+void IAMClient::UploadSigningCertificateAsync(UploadSigningCertificateRequest&& request, const UploadSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IAMClient::UploadSigningCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IAMClient::UploadSigningCertificateAsyncHelper(const UploadSigningCertificateRequest& request, const UploadSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UploadSigningCertificate(request), context);
 }
 
+Paginator<IAMClient, GetAccountAuthorizationDetailsRequest, GetAccountAuthorizationDetailsOutcome> IAMClient::GetAccountAuthorizationDetailsPaginator(const GetAccountAuthorizationDetailsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, GetAccountAuthorizationDetailsRequest, GetAccountAuthorizationDetailsOutcome>(this, &IAMClient::GetAccountAuthorizationDetails, request,
+    [](const GetAccountAuthorizationDetailsRequest& current, const GetAccountAuthorizationDetailsOutcome& outcome, GetAccountAuthorizationDetailsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, GetGroupRequest, GetGroupOutcome> IAMClient::GetGroupPaginator(const GetGroupRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, GetGroupRequest, GetGroupOutcome>(this, &IAMClient::GetGroup, request,
+    [](const GetGroupRequest& current, const GetGroupOutcome& outcome, GetGroupRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListAccessKeysRequest, ListAccessKeysOutcome> IAMClient::ListAccessKeysPaginator(const ListAccessKeysRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListAccessKeysRequest, ListAccessKeysOutcome>(this, &IAMClient::ListAccessKeys, request,
+    [](const ListAccessKeysRequest& current, const ListAccessKeysOutcome& outcome, ListAccessKeysRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListAccountAliasesRequest, ListAccountAliasesOutcome> IAMClient::ListAccountAliasesPaginator(const ListAccountAliasesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListAccountAliasesRequest, ListAccountAliasesOutcome>(this, &IAMClient::ListAccountAliases, request,
+    [](const ListAccountAliasesRequest& current, const ListAccountAliasesOutcome& outcome, ListAccountAliasesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListAttachedGroupPoliciesRequest, ListAttachedGroupPoliciesOutcome> IAMClient::ListAttachedGroupPoliciesPaginator(const ListAttachedGroupPoliciesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListAttachedGroupPoliciesRequest, ListAttachedGroupPoliciesOutcome>(this, &IAMClient::ListAttachedGroupPolicies, request,
+    [](const ListAttachedGroupPoliciesRequest& current, const ListAttachedGroupPoliciesOutcome& outcome, ListAttachedGroupPoliciesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListAttachedRolePoliciesRequest, ListAttachedRolePoliciesOutcome> IAMClient::ListAttachedRolePoliciesPaginator(const ListAttachedRolePoliciesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListAttachedRolePoliciesRequest, ListAttachedRolePoliciesOutcome>(this, &IAMClient::ListAttachedRolePolicies, request,
+    [](const ListAttachedRolePoliciesRequest& current, const ListAttachedRolePoliciesOutcome& outcome, ListAttachedRolePoliciesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListAttachedUserPoliciesRequest, ListAttachedUserPoliciesOutcome> IAMClient::ListAttachedUserPoliciesPaginator(const ListAttachedUserPoliciesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListAttachedUserPoliciesRequest, ListAttachedUserPoliciesOutcome>(this, &IAMClient::ListAttachedUserPolicies, request,
+    [](const ListAttachedUserPoliciesRequest& current, const ListAttachedUserPoliciesOutcome& outcome, ListAttachedUserPoliciesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListEntitiesForPolicyRequest, ListEntitiesForPolicyOutcome> IAMClient::ListEntitiesForPolicyPaginator(const ListEntitiesForPolicyRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListEntitiesForPolicyRequest, ListEntitiesForPolicyOutcome>(this, &IAMClient::ListEntitiesForPolicy, request,
+    [](const ListEntitiesForPolicyRequest& current, const ListEntitiesForPolicyOutcome& outcome, ListEntitiesForPolicyRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListGroupPoliciesRequest, ListGroupPoliciesOutcome> IAMClient::ListGroupPoliciesPaginator(const ListGroupPoliciesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListGroupPoliciesRequest, ListGroupPoliciesOutcome>(this, &IAMClient::ListGroupPolicies, request,
+    [](const ListGroupPoliciesRequest& current, const ListGroupPoliciesOutcome& outcome, ListGroupPoliciesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListGroupsRequest, ListGroupsOutcome> IAMClient::ListGroupsPaginator(const ListGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListGroupsRequest, ListGroupsOutcome>(this, &IAMClient::ListGroups, request,
+    [](const ListGroupsRequest& current, const ListGroupsOutcome& outcome, ListGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListGroupsForUserRequest, ListGroupsForUserOutcome> IAMClient::ListGroupsForUserPaginator(const ListGroupsForUserRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListGroupsForUserRequest, ListGroupsForUserOutcome>(this, &IAMClient::ListGroupsForUser, request,
+    [](const ListGroupsForUserRequest& current, const ListGroupsForUserOutcome& outcome, ListGroupsForUserRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListInstanceProfilesRequest, ListInstanceProfilesOutcome> IAMClient::ListInstanceProfilesPaginator(const ListInstanceProfilesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListInstanceProfilesRequest, ListInstanceProfilesOutcome>(this, &IAMClient::ListInstanceProfiles, request,
+    [](const ListInstanceProfilesRequest& current, const ListInstanceProfilesOutcome& outcome, ListInstanceProfilesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListInstanceProfilesForRoleRequest, ListInstanceProfilesForRoleOutcome> IAMClient::ListInstanceProfilesForRolePaginator(const ListInstanceProfilesForRoleRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListInstanceProfilesForRoleRequest, ListInstanceProfilesForRoleOutcome>(this, &IAMClient::ListInstanceProfilesForRole, request,
+    [](const ListInstanceProfilesForRoleRequest& current, const ListInstanceProfilesForRoleOutcome& outcome, ListInstanceProfilesForRoleRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListMFADevicesRequest, ListMFADevicesOutcome> IAMClient::ListMFADevicesPaginator(const ListMFADevicesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListMFADevicesRequest, ListMFADevicesOutcome>(this, &IAMClient::ListMFADevices, request,
+    [](const ListMFADevicesRequest& current, const ListMFADevicesOutcome& outcome, ListMFADevicesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListPoliciesRequest, ListPoliciesOutcome> IAMClient::ListPoliciesPaginator(const ListPoliciesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListPoliciesRequest, ListPoliciesOutcome>(this, &IAMClient::ListPolicies, request,
+    [](const ListPoliciesRequest& current, const ListPoliciesOutcome& outcome, ListPoliciesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListPolicyVersionsRequest, ListPolicyVersionsOutcome> IAMClient::ListPolicyVersionsPaginator(const ListPolicyVersionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListPolicyVersionsRequest, ListPolicyVersionsOutcome>(this, &IAMClient::ListPolicyVersions, request,
+    [](const ListPolicyVersionsRequest& current, const ListPolicyVersionsOutcome& outcome, ListPolicyVersionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListRolePoliciesRequest, ListRolePoliciesOutcome> IAMClient::ListRolePoliciesPaginator(const ListRolePoliciesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListRolePoliciesRequest, ListRolePoliciesOutcome>(this, &IAMClient::ListRolePolicies, request,
+    [](const ListRolePoliciesRequest& current, const ListRolePoliciesOutcome& outcome, ListRolePoliciesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListRolesRequest, ListRolesOutcome> IAMClient::ListRolesPaginator(const ListRolesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListRolesRequest, ListRolesOutcome>(this, &IAMClient::ListRoles, request,
+    [](const ListRolesRequest& current, const ListRolesOutcome& outcome, ListRolesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListSSHPublicKeysRequest, ListSSHPublicKeysOutcome> IAMClient::ListSSHPublicKeysPaginator(const ListSSHPublicKeysRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListSSHPublicKeysRequest, ListSSHPublicKeysOutcome>(this, &IAMClient::ListSSHPublicKeys, request,
+    [](const ListSSHPublicKeysRequest& current, const ListSSHPublicKeysOutcome& outcome, ListSSHPublicKeysRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListServerCertificatesRequest, ListServerCertificatesOutcome> IAMClient::ListServerCertificatesPaginator(const ListServerCertificatesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListServerCertificatesRequest, ListServerCertificatesOutcome>(this, &IAMClient::ListServerCertificates, request,
+    [](const ListServerCertificatesRequest& current, const ListServerCertificatesOutcome& outcome, ListServerCertificatesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListSigningCertificatesRequest, ListSigningCertificatesOutcome> IAMClient::ListSigningCertificatesPaginator(const ListSigningCertificatesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListSigningCertificatesRequest, ListSigningCertificatesOutcome>(this, &IAMClient::ListSigningCertificates, request,
+    [](const ListSigningCertificatesRequest& current, const ListSigningCertificatesOutcome& outcome, ListSigningCertificatesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListUserPoliciesRequest, ListUserPoliciesOutcome> IAMClient::ListUserPoliciesPaginator(const ListUserPoliciesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListUserPoliciesRequest, ListUserPoliciesOutcome>(this, &IAMClient::ListUserPolicies, request,
+    [](const ListUserPoliciesRequest& current, const ListUserPoliciesOutcome& outcome, ListUserPoliciesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListUsersRequest, ListUsersOutcome> IAMClient::ListUsersPaginator(const ListUsersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListUsersRequest, ListUsersOutcome>(this, &IAMClient::ListUsers, request,
+    [](const ListUsersRequest& current, const ListUsersOutcome& outcome, ListUsersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, ListVirtualMFADevicesRequest, ListVirtualMFADevicesOutcome> IAMClient::ListVirtualMFADevicesPaginator(const ListVirtualMFADevicesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, ListVirtualMFADevicesRequest, ListVirtualMFADevicesOutcome>(this, &IAMClient::ListVirtualMFADevices, request,
+    [](const ListVirtualMFADevicesRequest& current, const ListVirtualMFADevicesOutcome& outcome, ListVirtualMFADevicesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, SimulateCustomPolicyRequest, SimulateCustomPolicyOutcome> IAMClient::SimulateCustomPolicyPaginator(const SimulateCustomPolicyRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, SimulateCustomPolicyRequest, SimulateCustomPolicyOutcome>(this, &IAMClient::SimulateCustomPolicy, request,
+    [](const SimulateCustomPolicyRequest& current, const SimulateCustomPolicyOutcome& outcome, SimulateCustomPolicyRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IAMClient, SimulatePrincipalPolicyRequest, SimulatePrincipalPolicyOutcome> IAMClient::SimulatePrincipalPolicyPaginator(const SimulatePrincipalPolicyRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IAMClient, SimulatePrincipalPolicyRequest, SimulatePrincipalPolicyOutcome>(this, &IAMClient::SimulatePrincipalPolicy, request,
+    [](const SimulatePrincipalPolicyRequest& current, const SimulatePrincipalPolicyOutcome& outcome, SimulatePrincipalPolicyRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<IAMClient, AddClientIDToOpenIDConnectProviderRequest, AddClientIDToOpenIDConnectProviderOutcome> IAMClient::AddClientIDToOpenIDConnectProviderAwaitable(AddClientIDToOpenIDConnectProviderRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::AddClientIDToOpenIDConnectProvider, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, AddRoleToInstanceProfileRequest, AddRoleToInstanceProfileOutcome> IAMClient::AddRoleToInstanceProfileAwaitable(AddRoleToInstanceProfileRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::AddRoleToInstanceProfile, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, AddUserToGroupRequest, AddUserToGroupOutcome> IAMClient::AddUserToGroupAwaitable(AddUserToGroupRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::AddUserToGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, AttachGroupPolicyRequest, AttachGroupPolicyOutcome> IAMClient::AttachGroupPolicyAwaitable(AttachGroupPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::AttachGroupPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, AttachRolePolicyRequest, AttachRolePolicyOutcome> IAMClient::AttachRolePolicyAwaitable(AttachRolePolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::AttachRolePolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, AttachUserPolicyRequest, AttachUserPolicyOutcome> IAMClient::AttachUserPolicyAwaitable(AttachUserPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::AttachUserPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ChangePasswordRequest, ChangePasswordOutcome> IAMClient::ChangePasswordAwaitable(ChangePasswordRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ChangePassword, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, CreateAccessKeyRequest, CreateAccessKeyOutcome> IAMClient::CreateAccessKeyAwaitable(CreateAccessKeyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::CreateAccessKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, CreateAccountAliasRequest, CreateAccountAliasOutcome> IAMClient::CreateAccountAliasAwaitable(CreateAccountAliasRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::CreateAccountAlias, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, CreateGroupRequest, CreateGroupOutcome> IAMClient::CreateGroupAwaitable(CreateGroupRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::CreateGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, CreateInstanceProfileRequest, CreateInstanceProfileOutcome> IAMClient::CreateInstanceProfileAwaitable(CreateInstanceProfileRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::CreateInstanceProfile, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, CreateLoginProfileRequest, CreateLoginProfileOutcome> IAMClient::CreateLoginProfileAwaitable(CreateLoginProfileRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::CreateLoginProfile, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, CreateOpenIDConnectProviderRequest, CreateOpenIDConnectProviderOutcome> IAMClient::CreateOpenIDConnectProviderAwaitable(CreateOpenIDConnectProviderRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::CreateOpenIDConnectProvider, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, CreatePolicyRequest, CreatePolicyOutcome> IAMClient::CreatePolicyAwaitable(CreatePolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::CreatePolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, CreatePolicyVersionRequest, CreatePolicyVersionOutcome> IAMClient::CreatePolicyVersionAwaitable(CreatePolicyVersionRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::CreatePolicyVersion, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, CreateRoleRequest, CreateRoleOutcome> IAMClient::CreateRoleAwaitable(CreateRoleRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::CreateRole, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, CreateSAMLProviderRequest, CreateSAMLProviderOutcome> IAMClient::CreateSAMLProviderAwaitable(CreateSAMLProviderRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::CreateSAMLProvider, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, CreateUserRequest, CreateUserOutcome> IAMClient::CreateUserAwaitable(CreateUserRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::CreateUser, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, CreateVirtualMFADeviceRequest, CreateVirtualMFADeviceOutcome> IAMClient::CreateVirtualMFADeviceAwaitable(CreateVirtualMFADeviceRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::CreateVirtualMFADevice, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeactivateMFADeviceRequest, DeactivateMFADeviceOutcome> IAMClient::DeactivateMFADeviceAwaitable(DeactivateMFADeviceRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeactivateMFADevice, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteAccessKeyRequest, DeleteAccessKeyOutcome> IAMClient::DeleteAccessKeyAwaitable(DeleteAccessKeyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteAccessKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteAccountAliasRequest, DeleteAccountAliasOutcome> IAMClient::DeleteAccountAliasAwaitable(DeleteAccountAliasRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteAccountAlias, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteAccountPasswordPolicyRequest, DeleteAccountPasswordPolicyOutcome> IAMClient::DeleteAccountPasswordPolicyAwaitable(DeleteAccountPasswordPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteAccountPasswordPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteGroupRequest, DeleteGroupOutcome> IAMClient::DeleteGroupAwaitable(DeleteGroupRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteGroupPolicyRequest, DeleteGroupPolicyOutcome> IAMClient::DeleteGroupPolicyAwaitable(DeleteGroupPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteGroupPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteInstanceProfileRequest, DeleteInstanceProfileOutcome> IAMClient::DeleteInstanceProfileAwaitable(DeleteInstanceProfileRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteInstanceProfile, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteLoginProfileRequest, DeleteLoginProfileOutcome> IAMClient::DeleteLoginProfileAwaitable(DeleteLoginProfileRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteLoginProfile, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteOpenIDConnectProviderRequest, DeleteOpenIDConnectProviderOutcome> IAMClient::DeleteOpenIDConnectProviderAwaitable(DeleteOpenIDConnectProviderRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteOpenIDConnectProvider, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeletePolicyRequest, DeletePolicyOutcome> IAMClient::DeletePolicyAwaitable(DeletePolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeletePolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeletePolicyVersionRequest, DeletePolicyVersionOutcome> IAMClient::DeletePolicyVersionAwaitable(DeletePolicyVersionRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeletePolicyVersion, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteRoleRequest, DeleteRoleOutcome> IAMClient::DeleteRoleAwaitable(DeleteRoleRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteRole, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteRolePolicyRequest, DeleteRolePolicyOutcome> IAMClient::DeleteRolePolicyAwaitable(DeleteRolePolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteRolePolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteSAMLProviderRequest, DeleteSAMLProviderOutcome> IAMClient::DeleteSAMLProviderAwaitable(DeleteSAMLProviderRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteSAMLProvider, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteSSHPublicKeyRequest, DeleteSSHPublicKeyOutcome> IAMClient::DeleteSSHPublicKeyAwaitable(DeleteSSHPublicKeyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteSSHPublicKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteServerCertificateRequest, DeleteServerCertificateOutcome> IAMClient::DeleteServerCertificateAwaitable(DeleteServerCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteServerCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteSigningCertificateRequest, DeleteSigningCertificateOutcome> IAMClient::DeleteSigningCertificateAwaitable(DeleteSigningCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteSigningCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteUserRequest, DeleteUserOutcome> IAMClient::DeleteUserAwaitable(DeleteUserRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteUser, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteUserPolicyRequest, DeleteUserPolicyOutcome> IAMClient::DeleteUserPolicyAwaitable(DeleteUserPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteUserPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DeleteVirtualMFADeviceRequest, DeleteVirtualMFADeviceOutcome> IAMClient::DeleteVirtualMFADeviceAwaitable(DeleteVirtualMFADeviceRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DeleteVirtualMFADevice, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DetachGroupPolicyRequest, DetachGroupPolicyOutcome> IAMClient::DetachGroupPolicyAwaitable(DetachGroupPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DetachGroupPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DetachRolePolicyRequest, DetachRolePolicyOutcome> IAMClient::DetachRolePolicyAwaitable(DetachRolePolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DetachRolePolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, DetachUserPolicyRequest, DetachUserPolicyOutcome> IAMClient::DetachUserPolicyAwaitable(DetachUserPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::DetachUserPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, EnableMFADeviceRequest, EnableMFADeviceOutcome> IAMClient::EnableMFADeviceAwaitable(EnableMFADeviceRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::EnableMFADevice, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GenerateCredentialReportRequest, GenerateCredentialReportOutcome> IAMClient::GenerateCredentialReportAwaitable(GenerateCredentialReportRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GenerateCredentialReport, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetAccessKeyLastUsedRequest, GetAccessKeyLastUsedOutcome> IAMClient::GetAccessKeyLastUsedAwaitable(GetAccessKeyLastUsedRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetAccessKeyLastUsed, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetAccountAuthorizationDetailsRequest, GetAccountAuthorizationDetailsOutcome> IAMClient::GetAccountAuthorizationDetailsAwaitable(GetAccountAuthorizationDetailsRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetAccountAuthorizationDetails, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetAccountPasswordPolicyRequest, GetAccountPasswordPolicyOutcome> IAMClient::GetAccountPasswordPolicyAwaitable(GetAccountPasswordPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetAccountPasswordPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetAccountSummaryRequest, GetAccountSummaryOutcome> IAMClient::GetAccountSummaryAwaitable(GetAccountSummaryRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetAccountSummary, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetContextKeysForCustomPolicyRequest, GetContextKeysForCustomPolicyOutcome> IAMClient::GetContextKeysForCustomPolicyAwaitable(GetContextKeysForCustomPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetContextKeysForCustomPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetContextKeysForPrincipalPolicyRequest, GetContextKeysForPrincipalPolicyOutcome> IAMClient::GetContextKeysForPrincipalPolicyAwaitable(GetContextKeysForPrincipalPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetContextKeysForPrincipalPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetCredentialReportRequest, GetCredentialReportOutcome> IAMClient::GetCredentialReportAwaitable(GetCredentialReportRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetCredentialReport, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetGroupRequest, GetGroupOutcome> IAMClient::GetGroupAwaitable(GetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetGroupPolicyRequest, GetGroupPolicyOutcome> IAMClient::GetGroupPolicyAwaitable(GetGroupPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetGroupPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetInstanceProfileRequest, GetInstanceProfileOutcome> IAMClient::GetInstanceProfileAwaitable(GetInstanceProfileRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetInstanceProfile, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetLoginProfileRequest, GetLoginProfileOutcome> IAMClient::GetLoginProfileAwaitable(GetLoginProfileRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetLoginProfile, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetOpenIDConnectProviderRequest, GetOpenIDConnectProviderOutcome> IAMClient::GetOpenIDConnectProviderAwaitable(GetOpenIDConnectProviderRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetOpenIDConnectProvider, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetPolicyRequest, GetPolicyOutcome> IAMClient::GetPolicyAwaitable(GetPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetPolicyVersionRequest, GetPolicyVersionOutcome> IAMClient::GetPolicyVersionAwaitable(GetPolicyVersionRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetPolicyVersion, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetRoleRequest, GetRoleOutcome> IAMClient::GetRoleAwaitable(GetRoleRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetRole, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetRolePolicyRequest, GetRolePolicyOutcome> IAMClient::GetRolePolicyAwaitable(GetRolePolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetRolePolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetSAMLProviderRequest, GetSAMLProviderOutcome> IAMClient::GetSAMLProviderAwaitable(GetSAMLProviderRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetSAMLProvider, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetSSHPublicKeyRequest, GetSSHPublicKeyOutcome> IAMClient::GetSSHPublicKeyAwaitable(GetSSHPublicKeyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetSSHPublicKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetServerCertificateRequest, GetServerCertificateOutcome> IAMClient::GetServerCertificateAwaitable(GetServerCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetServerCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetUserRequest, GetUserOutcome> IAMClient::GetUserAwaitable(GetUserRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetUser, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, GetUserPolicyRequest, GetUserPolicyOutcome> IAMClient::GetUserPolicyAwaitable(GetUserPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::GetUserPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListAccessKeysRequest, ListAccessKeysOutcome> IAMClient::ListAccessKeysAwaitable(ListAccessKeysRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListAccessKeys, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListAccountAliasesRequest, ListAccountAliasesOutcome> IAMClient::ListAccountAliasesAwaitable(ListAccountAliasesRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListAccountAliases, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListAttachedGroupPoliciesRequest, ListAttachedGroupPoliciesOutcome> IAMClient::ListAttachedGroupPoliciesAwaitable(ListAttachedGroupPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListAttachedGroupPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListAttachedRolePoliciesRequest, ListAttachedRolePoliciesOutcome> IAMClient::ListAttachedRolePoliciesAwaitable(ListAttachedRolePoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListAttachedRolePolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListAttachedUserPoliciesRequest, ListAttachedUserPoliciesOutcome> IAMClient::ListAttachedUserPoliciesAwaitable(ListAttachedUserPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListAttachedUserPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListEntitiesForPolicyRequest, ListEntitiesForPolicyOutcome> IAMClient::ListEntitiesForPolicyAwaitable(ListEntitiesForPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListEntitiesForPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListGroupPoliciesRequest, ListGroupPoliciesOutcome> IAMClient::ListGroupPoliciesAwaitable(ListGroupPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListGroupPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListGroupsRequest, ListGroupsOutcome> IAMClient::ListGroupsAwaitable(ListGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListGroupsForUserRequest, ListGroupsForUserOutcome> IAMClient::ListGroupsForUserAwaitable(ListGroupsForUserRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListGroupsForUser, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListInstanceProfilesRequest, ListInstanceProfilesOutcome> IAMClient::ListInstanceProfilesAwaitable(ListInstanceProfilesRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListInstanceProfiles, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListInstanceProfilesForRoleRequest, ListInstanceProfilesForRoleOutcome> IAMClient::ListInstanceProfilesForRoleAwaitable(ListInstanceProfilesForRoleRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListInstanceProfilesForRole, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListMFADevicesRequest, ListMFADevicesOutcome> IAMClient::ListMFADevicesAwaitable(ListMFADevicesRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListMFADevices, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListOpenIDConnectProvidersRequest, ListOpenIDConnectProvidersOutcome> IAMClient::ListOpenIDConnectProvidersAwaitable(ListOpenIDConnectProvidersRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListOpenIDConnectProviders, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListPoliciesRequest, ListPoliciesOutcome> IAMClient::ListPoliciesAwaitable(ListPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListPolicyVersionsRequest, ListPolicyVersionsOutcome> IAMClient::ListPolicyVersionsAwaitable(ListPolicyVersionsRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListPolicyVersions, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListRolePoliciesRequest, ListRolePoliciesOutcome> IAMClient::ListRolePoliciesAwaitable(ListRolePoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListRolePolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListRolesRequest, ListRolesOutcome> IAMClient::ListRolesAwaitable(ListRolesRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListRoles, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListSAMLProvidersRequest, ListSAMLProvidersOutcome> IAMClient::ListSAMLProvidersAwaitable(ListSAMLProvidersRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListSAMLProviders, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListSSHPublicKeysRequest, ListSSHPublicKeysOutcome> IAMClient::ListSSHPublicKeysAwaitable(ListSSHPublicKeysRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListSSHPublicKeys, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListServerCertificatesRequest, ListServerCertificatesOutcome> IAMClient::ListServerCertificatesAwaitable(ListServerCertificatesRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListServerCertificates, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListSigningCertificatesRequest, ListSigningCertificatesOutcome> IAMClient::ListSigningCertificatesAwaitable(ListSigningCertificatesRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListSigningCertificates, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListUserPoliciesRequest, ListUserPoliciesOutcome> IAMClient::ListUserPoliciesAwaitable(ListUserPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListUserPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListUsersRequest, ListUsersOutcome> IAMClient::ListUsersAwaitable(ListUsersRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListUsers, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ListVirtualMFADevicesRequest, ListVirtualMFADevicesOutcome> IAMClient::ListVirtualMFADevicesAwaitable(ListVirtualMFADevicesRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ListVirtualMFADevices, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, PutGroupPolicyRequest, PutGroupPolicyOutcome> IAMClient::PutGroupPolicyAwaitable(PutGroupPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::PutGroupPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, PutRolePolicyRequest, PutRolePolicyOutcome> IAMClient::PutRolePolicyAwaitable(PutRolePolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::PutRolePolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, PutUserPolicyRequest, PutUserPolicyOutcome> IAMClient::PutUserPolicyAwaitable(PutUserPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::PutUserPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, RemoveClientIDFromOpenIDConnectProviderRequest, RemoveClientIDFromOpenIDConnectProviderOutcome> IAMClient::RemoveClientIDFromOpenIDConnectProviderAwaitable(RemoveClientIDFromOpenIDConnectProviderRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::RemoveClientIDFromOpenIDConnectProvider, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, RemoveRoleFromInstanceProfileRequest, RemoveRoleFromInstanceProfileOutcome> IAMClient::RemoveRoleFromInstanceProfileAwaitable(RemoveRoleFromInstanceProfileRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::RemoveRoleFromInstanceProfile, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, RemoveUserFromGroupRequest, RemoveUserFromGroupOutcome> IAMClient::RemoveUserFromGroupAwaitable(RemoveUserFromGroupRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::RemoveUserFromGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, ResyncMFADeviceRequest, ResyncMFADeviceOutcome> IAMClient::ResyncMFADeviceAwaitable(ResyncMFADeviceRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::ResyncMFADevice, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, SetDefaultPolicyVersionRequest, SetDefaultPolicyVersionOutcome> IAMClient::SetDefaultPolicyVersionAwaitable(SetDefaultPolicyVersionRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::SetDefaultPolicyVersion, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, SimulateCustomPolicyRequest, SimulateCustomPolicyOutcome> IAMClient::SimulateCustomPolicyAwaitable(SimulateCustomPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::SimulateCustomPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, SimulatePrincipalPolicyRequest, SimulatePrincipalPolicyOutcome> IAMClient::SimulatePrincipalPolicyAwaitable(SimulatePrincipalPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::SimulatePrincipalPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, UpdateAccessKeyRequest, UpdateAccessKeyOutcome> IAMClient::UpdateAccessKeyAwaitable(UpdateAccessKeyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::UpdateAccessKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, UpdateAccountPasswordPolicyRequest, UpdateAccountPasswordPolicyOutcome> IAMClient::UpdateAccountPasswordPolicyAwaitable(UpdateAccountPasswordPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::UpdateAccountPasswordPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, UpdateAssumeRolePolicyRequest, UpdateAssumeRolePolicyOutcome> IAMClient::UpdateAssumeRolePolicyAwaitable(UpdateAssumeRolePolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::UpdateAssumeRolePolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, UpdateGroupRequest, UpdateGroupOutcome> IAMClient::UpdateGroupAwaitable(UpdateGroupRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::UpdateGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, UpdateLoginProfileRequest, UpdateLoginProfileOutcome> IAMClient::UpdateLoginProfileAwaitable(UpdateLoginProfileRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::UpdateLoginProfile, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, UpdateOpenIDConnectProviderThumbprintRequest, UpdateOpenIDConnectProviderThumbprintOutcome> IAMClient::UpdateOpenIDConnectProviderThumbprintAwaitable(UpdateOpenIDConnectProviderThumbprintRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::UpdateOpenIDConnectProviderThumbprint, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, UpdateSAMLProviderRequest, UpdateSAMLProviderOutcome> IAMClient::UpdateSAMLProviderAwaitable(UpdateSAMLProviderRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::UpdateSAMLProvider, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, UpdateSSHPublicKeyRequest, UpdateSSHPublicKeyOutcome> IAMClient::UpdateSSHPublicKeyAwaitable(UpdateSSHPublicKeyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::UpdateSSHPublicKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, UpdateServerCertificateRequest, UpdateServerCertificateOutcome> IAMClient::UpdateServerCertificateAwaitable(UpdateServerCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::UpdateServerCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, UpdateSigningCertificateRequest, UpdateSigningCertificateOutcome> IAMClient::UpdateSigningCertificateAwaitable(UpdateSigningCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::UpdateSigningCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, UpdateUserRequest, UpdateUserOutcome> IAMClient::UpdateUserAwaitable(UpdateUserRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::UpdateUser, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, UploadSSHPublicKeyRequest, UploadSSHPublicKeyOutcome> IAMClient::UploadSSHPublicKeyAwaitable(UploadSSHPublicKeyRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::UploadSSHPublicKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, UploadServerCertificateRequest, UploadServerCertificateOutcome> IAMClient::UploadServerCertificateAwaitable(UploadServerCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::UploadServerCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IAMClient, UploadSigningCertificateRequest, UploadSigningCertificateOutcome> IAMClient::UploadSigningCertificateAwaitable(UploadSigningCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IAMClient::UploadSigningCertificate, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -53,19 +53,19 @@ AccessKeyLastUsed& AccessKeyLastUsed::operator =(const XmlNode& xmlNode)
     XmlNode lastUsedDateNode = resultNode.FirstChild("LastUsedDate");
     if(!lastUsedDateNode.IsNull())
     {
-      m_lastUsedDate = DateTime(StringUtils::Trim(lastUsedDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_lastUsedDate = DateTime(lastUsedDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_lastUsedDateHasBeenSet = true;
     }
     XmlNode serviceNameNode = resultNode.FirstChild("ServiceName");
     if(!serviceNameNode.IsNull())
     {
-      m_serviceName = StringUtils::Trim(serviceNameNode.GetText().c_str());
+      m_serviceName = serviceNameNode.GetTextView().Trim().ToString();
       m_serviceNameHasBeenSet = true;
     }
     XmlNode regionNode = resultNode.FirstChild("Region");
     if(!regionNode.IsNull())
     {
-      m_region = StringUtils::Trim(regionNode.GetText().c_str());
+      m_region = regionNode.GetTextView().Trim().ToString();
       m_regionHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void AccessKeyLastUsed::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_lastUsedDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LastUsedDate=" << StringUtils::URLEncode(m_lastUsedDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".LastUsedDate=" << StringUtils::URLEncoded(m_lastUsedDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_serviceNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ServiceName=" << StringUtils::URLEncode(m_serviceName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ServiceName=" << StringUtils::URLEncoded(m_serviceName) << "&";
   }
 
   if(m_regionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Region=" << StringUtils::URLEncode(m_region.c_str()) << "&";
+      oStream << location << index << locationValue << ".Region=" << StringUtils::URLEncoded(m_region) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void AccessKeyLastUsed::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_lastUsedDateHasBeenSet)
   {
-      oStream << location << ".LastUsedDate=" << StringUtils::URLEncode(m_lastUsedDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".LastUsedDate=" << StringUtils::URLEncoded(m_lastUsedDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_serviceNameHasBeenSet)
   {
-      oStream << location << ".ServiceName=" << StringUtils::URLEncode(m_serviceName.c_str()) << "&";
+      oStream << location << ".ServiceName=" << StringUtils::URLEncoded(m_serviceName) << "&";
   }
   if(m_regionHasBeenSet)
   {
-      oStream << location << ".Region=" << StringUtils::URLEncode(m_region.c_str()) << "&";
+      oStream << location << ".Region=" << StringUtils::URLEncoded(m_region) << "&";
   }
 }
 
@@ -55,25 +55,25 @@ AccessKeyMetadata& AccessKeyMetadata::operator =(const XmlNode& xmlNode)
     XmlNode userNameNode = resultNode.FirstChild("UserName");
     if(!userNameNode.IsNull())
     {
-      m_userName = StringUtils::Trim(userNameNode.GetText().c_str());
+      m_userName = userNameNode.GetTextView().Trim().ToString();
       m_userNameHasBeenSet = true;
     }
     XmlNode accessKeyIdNode = resultNode.FirstChild("AccessKeyId");
     if(!accessKeyIdNode.IsNull())
     {
-      m_accessKeyId = StringUtils::Trim(accessKeyIdNode.GetText().c_str());
+      m_accessKeyId = accessKeyIdNode.GetTextView().Trim().ToString();
       m_accessKeyIdHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StatusTypeMapper::GetStatusTypeForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = StatusTypeMapper::GetStatusTypeForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode createDateNode = resultNode.FirstChild("CreateDate");
     if(!createDateNode.IsNull())
     {
-      m_createDate = DateTime(StringUtils::Trim(createDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createDate = DateTime(createDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createDateHasBeenSet = true;
     }
   }
@@ -85,12 +85,12 @@ void AccessKeyMetadata::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_userNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_accessKeyIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AccessKeyId=" << StringUtils::URLEncode(m_accessKeyId.c_str()) << "&";
+      oStream << location << index << locationValue << ".AccessKeyId=" << StringUtils::URLEncoded(m_accessKeyId) << "&";
   }
 
   if(m_statusHasBeenSet)
@@ -100,7 +100,7 @@ void AccessKeyMetadata::OutputToStream(Aws::OStream& oStream, const char* locati
 
   if(m_createDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -109,11 +109,11 @@ void AccessKeyMetadata::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_userNameHasBeenSet)
   {
-      oStream << location << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
   if(m_accessKeyIdHasBeenSet)
   {
-      oStream << location << ".AccessKeyId=" << StringUtils::URLEncode(m_accessKeyId.c_str()) << "&";
+      oStream << location << ".AccessKeyId=" << StringUtils::URLEncoded(m_accessKeyId) << "&";
   }
   if(m_statusHasBeenSet)
   {
@@ -121,7 +121,7 @@ void AccessKeyMetadata::OutputToStream(Aws::OStream& oStream, const char* locati
   }
   if(m_createDateHasBeenSet)
   {
-      oStream << location << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/AddClientIDToOpenIDConnectProviderRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ AddClientIDToOpenIDConnectProviderRequest::AddClientIDToOpenIDConnectProviderReq
 
 Aws::String AddClientIDToOpenIDConnectProviderRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AddClientIDToOpenIDConnectProvider&";
   if(m_openIDConnectProviderArnHasBeenSet)
   {
-    ss << "OpenIDConnectProviderArn=" << StringUtils::URLEncode(m_openIDConnectProviderArn.c_str()) << "&";
+    ss << "OpenIDConnectProviderArn=" << StringUtils::URLEncoded(m_openIDConnectProviderArn) << "&";
   }
 
   if(m_clientIDHasBeenSet)
   {
-    ss << "ClientID=" << StringUtils::URLEncode(m_clientID.c_str()) << "&";
+    ss << "ClientID=" << StringUtils::URLEncoded(m_clientID) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/AddRoleToInstanceProfileRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ AddRoleToInstanceProfileRequest::AddRoleToInstanceProfileRequest() :
 
 Aws::String AddRoleToInstanceProfileRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AddRoleToInstanceProfile&";
   if(m_instanceProfileNameHasBeenSet)
   {
-    ss << "InstanceProfileName=" << StringUtils::URLEncode(m_instanceProfileName.c_str()) << "&";
+    ss << "InstanceProfileName=" << StringUtils::URLEncoded(m_instanceProfileName) << "&";
   }
 
   if(m_roleNameHasBeenSet)
   {
-    ss << "RoleName=" << StringUtils::URLEncode(m_roleName.c_str()) << "&";
+    ss << "RoleName=" << StringUtils::URLEncoded(m_roleName) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/AddUserToGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ AddUserToGroupRequest::AddUserToGroupRequest() :
 
 Aws::String AddUserToGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AddUserToGroup&";
   if(m_groupNameHasBeenSet)
   {
-    ss << "GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+    ss << "GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   if(m_userNameHasBeenSet)
   {
-    ss << "UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+    ss << "UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
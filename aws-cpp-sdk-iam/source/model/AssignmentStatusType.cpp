@@ -29,26 +29,32 @@ namespace Aws
       namespace AssignmentStatusTypeMapper
       {
 
-        static const int Assigned_HASH = HashingUtils::HashString("Assigned");
-        static const int Unassigned_HASH = HashingUtils::HashString("Unassigned");
-        static const int Any_HASH = HashingUtils::HashString("Any");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Assigned_HASH = -305237522;
+        static const int Unassigned_HASH = -1145155705;
+        static const int Any_HASH = 65996;
 
 
         AssignmentStatusType GetAssignmentStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Assigned_HASH)
+          switch (hashCode)
           {
+          case Assigned_HASH:
             return AssignmentStatusType::Assigned;
-          }
-          else if (hashCode == Unassigned_HASH)
-          {
+          case Unassigned_HASH:
             return AssignmentStatusType::Unassigned;
-          }
-          else if (hashCode == Any_HASH)
-          {
+          case Any_HASH:
             return AssignmentStatusType::Any;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
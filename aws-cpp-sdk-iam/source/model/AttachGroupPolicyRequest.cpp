@@ -15,6 +15,7 @@
 #include <aws/iam/model/AttachGroupPolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ AttachGroupPolicyRequest::AttachGroupPolicyRequest() :
 
 Aws::String AttachGroupPolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AttachGroupPolicy&";
   if(m_groupNameHasBeenSet)
   {
-    ss << "GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+    ss << "GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   if(m_policyArnHasBeenSet)
   {
-    ss << "PolicyArn=" << StringUtils::URLEncode(m_policyArn.c_str()) << "&";
+    ss << "PolicyArn=" << StringUtils::URLEncoded(m_policyArn) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/AttachRolePolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ AttachRolePolicyRequest::AttachRolePolicyRequest() :
 
 Aws::String AttachRolePolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AttachRolePolicy&";
   if(m_roleNameHasBeenSet)
   {
-    ss << "RoleName=" << StringUtils::URLEncode(m_roleName.c_str()) << "&";
+    ss << "RoleName=" << StringUtils::URLEncoded(m_roleName) << "&";
   }
 
   if(m_policyArnHasBeenSet)
   {
-    ss << "PolicyArn=" << StringUtils::URLEncode(m_policyArn.c_str()) << "&";
+    ss << "PolicyArn=" << StringUtils::URLEncoded(m_policyArn) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/AttachUserPolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ AttachUserPolicyRequest::AttachUserPolicyRequest() :
 
 Aws::String AttachUserPolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AttachUserPolicy&";
   if(m_userNameHasBeenSet)
   {
-    ss << "UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+    ss << "UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_policyArnHasBeenSet)
   {
-    ss << "PolicyArn=" << StringUtils::URLEncode(m_policyArn.c_str()) << "&";
+    ss << "PolicyArn=" << StringUtils::URLEncoded(m_policyArn) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
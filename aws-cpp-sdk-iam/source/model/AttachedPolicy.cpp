@@ -51,13 +51,13 @@ AttachedPolicy& AttachedPolicy::operator =(const XmlNode& xmlNode)
     XmlNode policyNameNode = resultNode.FirstChild("PolicyName");
     if(!policyNameNode.IsNull())
     {
-      m_policyName = StringUtils::Trim(policyNameNode.GetText().c_str());
+      m_policyName = policyNameNode.GetTextView().Trim().ToString();
       m_policyNameHasBeenSet = true;
     }
     XmlNode policyArnNode = resultNode.FirstChild("PolicyArn");
     if(!policyArnNode.IsNull())
     {
-      m_policyArn = StringUtils::Trim(policyArnNode.GetText().c_str());
+      m_policyArn = policyArnNode.GetTextView().Trim().ToString();
       m_policyArnHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void AttachedPolicy::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_policyNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
 
   if(m_policyArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PolicyArn=" << StringUtils::URLEncode(m_policyArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".PolicyArn=" << StringUtils::URLEncoded(m_policyArn) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void AttachedPolicy::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_policyNameHasBeenSet)
   {
-      oStream << location << ".PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+      oStream << location << ".PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
   if(m_policyArnHasBeenSet)
   {
-      oStream << location << ".PolicyArn=" << StringUtils::URLEncode(m_policyArn.c_str()) << "&";
+      oStream << location << ".PolicyArn=" << StringUtils::URLEncoded(m_policyArn) << "&";
   }
 }
 
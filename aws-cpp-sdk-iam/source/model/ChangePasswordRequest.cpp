@@ -15,6 +15,7 @@
 #include <aws/iam/model/ChangePasswordRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ ChangePasswordRequest::ChangePasswordRequest() :
 
 Aws::String ChangePasswordRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ChangePassword&";
   if(m_oldPasswordHasBeenSet)
   {
-    ss << "OldPassword=" << StringUtils::URLEncode(m_oldPassword.c_str()) << "&";
+    ss << "OldPassword=" << StringUtils::URLEncoded(m_oldPassword) << "&";
   }
 
   if(m_newPasswordHasBeenSet)
   {
-    ss << "NewPassword=" << StringUtils::URLEncode(m_newPassword.c_str()) << "&";
+    ss << "NewPassword=" << StringUtils::URLEncoded(m_newPassword) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
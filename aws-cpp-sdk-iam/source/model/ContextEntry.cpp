@@ -53,7 +53,7 @@ ContextEntry& ContextEntry::operator =(const XmlNode& xmlNode)
     XmlNode contextKeyNameNode = resultNode.FirstChild("ContextKeyName");
     if(!contextKeyNameNode.IsNull())
     {
-      m_contextKeyName = StringUtils::Trim(contextKeyNameNode.GetText().c_str());
+      m_contextKeyName = contextKeyNameNode.GetTextView().Trim().ToString();
       m_contextKeyNameHasBeenSet = true;
     }
     XmlNode contextKeyValuesNode = resultNode.FirstChild("ContextKeyValues");
@@ -62,7 +62,7 @@ ContextEntry& ContextEntry::operator =(const XmlNode& xmlNode)
       XmlNode contextKeyValuesMember = contextKeyValuesNode.FirstChild("member");
       while(!contextKeyValuesMember.IsNull())
       {
-        m_contextKeyValues.push_back(StringUtils::Trim(contextKeyValuesMember.GetText().c_str()));
+        m_contextKeyValues.push_back(contextKeyValuesMember.GetTextView().Trim().ToString());
         contextKeyValuesMember = contextKeyValuesMember.NextNode("member");
       }
 
@@ -71,7 +71,7 @@ ContextEntry& ContextEntry::operator =(const XmlNode& xmlNode)
     XmlNode contextKeyTypeNode = resultNode.FirstChild("ContextKeyType");
     if(!contextKeyTypeNode.IsNull())
     {
-      m_contextKeyType = ContextKeyTypeEnumMapper::GetContextKeyTypeEnumForName(StringUtils::Trim(contextKeyTypeNode.GetText().c_str()).c_str());
+      m_contextKeyType = ContextKeyTypeEnumMapper::GetContextKeyTypeEnumForName(contextKeyTypeNode.GetTextView().Trim().ToString().c_str());
       m_contextKeyTypeHasBeenSet = true;
     }
   }
@@ -83,7 +83,7 @@ void ContextEntry::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_contextKeyNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ContextKeyName=" << StringUtils::URLEncode(m_contextKeyName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ContextKeyName=" << StringUtils::URLEncoded(m_contextKeyName) << "&";
   }
 
   if(m_contextKeyValuesHasBeenSet)
@@ -91,7 +91,7 @@ void ContextEntry::OutputToStream(Aws::OStream& oStream, const char* location, u
       unsigned contextKeyValuesIdx = 1;
       for(auto& item : m_contextKeyValues)
       {
-        oStream << location << index << locationValue << ".ContextKeyValues.member." << contextKeyValuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".ContextKeyValues.member." << contextKeyValuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -106,14 +106,14 @@ void ContextEntry::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_contextKeyNameHasBeenSet)
   {
-      oStream << location << ".ContextKeyName=" << StringUtils::URLEncode(m_contextKeyName.c_str()) << "&";
+      oStream << location << ".ContextKeyName=" << StringUtils::URLEncoded(m_contextKeyName) << "&";
   }
   if(m_contextKeyValuesHasBeenSet)
   {
       unsigned contextKeyValuesIdx = 1;
       for(auto& item : m_contextKeyValues)
       {
-        oStream << location << ".ContextKeyValues.member." << contextKeyValuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".ContextKeyValues.member." << contextKeyValuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_contextKeyTypeHasBeenSet)
@@ -29,71 +29,59 @@ namespace Aws
       namespace ContextKeyTypeEnumMapper
       {
 
-        static const int string_HASH = HashingUtils::HashString("string");
-        static const int stringList_HASH = HashingUtils::HashString("stringList");
-        static const int numeric_HASH = HashingUtils::HashString("numeric");
-        static const int numericList_HASH = HashingUtils::HashString("numericList");
-        static const int boolean_HASH = HashingUtils::HashString("boolean");
-        static const int booleanList_HASH = HashingUtils::HashString("booleanList");
-        static const int ip_HASH = HashingUtils::HashString("ip");
-        static const int ipList_HASH = HashingUtils::HashString("ipList");
-        static const int binary_HASH = HashingUtils::HashString("binary");
-        static const int binaryList_HASH = HashingUtils::HashString("binaryList");
-        static const int date_HASH = HashingUtils::HashString("date");
-        static const int dateList_HASH = HashingUtils::HashString("dateList");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int string_HASH = -891985903;
+        static const int stringList_HASH = -1573317553;
+        static const int numeric_HASH = -2000413939;
+        static const int numericList_HASH = 68809035;
+        static const int boolean_HASH = 64711720;
+        static const int booleanList_HASH = -1835189018;
+        static const int ip_HASH = 3367;
+        static const int ipList_HASH = -1183103387;
+        static const int binary_HASH = -1388966911;
+        static const int binaryList_HASH = -880654273;
+        static const int date_HASH = 3076014;
+        static const int dateList_HASH = 1792511340;
 
 
         ContextKeyTypeEnum GetContextKeyTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == string_HASH)
+          switch (hashCode)
           {
+          case string_HASH:
             return ContextKeyTypeEnum::string;
-          }
-          else if (hashCode == stringList_HASH)
-          {
+          case stringList_HASH:
             return ContextKeyTypeEnum::stringList;
-          }
-          else if (hashCode == numeric_HASH)
-          {
+          case numeric_HASH:
             return ContextKeyTypeEnum::numeric;
-          }
-          else if (hashCode == numericList_HASH)
-          {
+          case numericList_HASH:
             return ContextKeyTypeEnum::numericList;
-          }
-          else if (hashCode == boolean_HASH)
-          {
+          case boolean_HASH:
             return ContextKeyTypeEnum::boolean;
-          }
-          else if (hashCode == booleanList_HASH)
-          {
+          case booleanList_HASH:
             return ContextKeyTypeEnum::booleanList;
-          }
-          else if (hashCode == ip_HASH)
-          {
+          case ip_HASH:
             return ContextKeyTypeEnum::ip;
-          }
-          else if (hashCode == ipList_HASH)
-          {
+          case ipList_HASH:
             return ContextKeyTypeEnum::ipList;
-          }
-          else if (hashCode == binary_HASH)
-          {
+          case binary_HASH:
             return ContextKeyTypeEnum::binary;
-          }
-          else if (hashCode == binaryList_HASH)
-          {
+          case binaryList_HASH:
             return ContextKeyTypeEnum::binaryList;
-          }
-          else if (hashCode == date_HASH)
-          {
+          case date_HASH:
             return ContextKeyTypeEnum::date;
-          }
-          else if (hashCode == dateList_HASH)
-          {
+          case dateList_HASH:
             return ContextKeyTypeEnum::dateList;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -15,6 +15,7 @@
 #include <aws/iam/model/CreateAccessKeyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ CreateAccessKeyRequest::CreateAccessKeyRequest() :
 
 Aws::String CreateAccessKeyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateAccessKey&";
   if(m_userNameHasBeenSet)
   {
-    ss << "UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+    ss << "UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateAccessKeyResult& CreateAccessKeyResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateAccessKeyResult")
+  if (rootNode.GetNameView() != "CreateAccessKeyResult")
   {
     resultNode = rootNode.FirstChild("CreateAccessKeyResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/iam/model/CreateAccountAliasRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ CreateAccountAliasRequest::CreateAccountAliasRequest() :
 
 Aws::String CreateAccountAliasRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateAccountAlias&";
   if(m_accountAliasHasBeenSet)
   {
-    ss << "AccountAlias=" << StringUtils::URLEncode(m_accountAlias.c_str()) << "&";
+    ss << "AccountAlias=" << StringUtils::URLEncoded(m_accountAlias) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
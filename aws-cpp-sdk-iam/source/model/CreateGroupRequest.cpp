@@ -15,6 +15,7 @@
 #include <aws/iam/model/CreateGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ CreateGroupRequest::CreateGroupRequest() :
 
 Aws::String CreateGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateGroup&";
   if(m_pathHasBeenSet)
   {
-    ss << "Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+    ss << "Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
 
   if(m_groupNameHasBeenSet)
   {
-    ss << "GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+    ss << "GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateGroupResult& CreateGroupResult::operator =(const AmazonWebServiceResult<Xm
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateGroupResult")
+  if (rootNode.GetNameView() != "CreateGroupResult")
   {
     resultNode = rootNode.FirstChild("CreateGroupResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/iam/model/CreateInstanceProfileRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ CreateInstanceProfileRequest::CreateInstanceProfileRequest() :
 
 Aws::String CreateInstanceProfileRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateInstanceProfile&";
   if(m_instanceProfileNameHasBeenSet)
   {
-    ss << "InstanceProfileName=" << StringUtils::URLEncode(m_instanceProfileName.c_str()) << "&";
+    ss << "InstanceProfileName=" << StringUtils::URLEncoded(m_instanceProfileName) << "&";
   }
 
   if(m_pathHasBeenSet)
   {
-    ss << "Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+    ss << "Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateInstanceProfileResult& CreateInstanceProfileResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateInstanceProfileResult")
+  if (rootNode.GetNameView() != "CreateInstanceProfileResult")
   {
     resultNode = rootNode.FirstChild("CreateInstanceProfileResult");
   }
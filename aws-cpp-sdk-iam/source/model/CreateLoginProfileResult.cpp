@@ -40,7 +40,7 @@ CreateLoginProfileResult& CreateLoginProfileResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateLoginProfileResult")
+  if (rootNode.GetNameView() != "CreateLoginProfileResult")
   {
     resultNode = rootNode.FirstChild("CreateLoginProfileResult");
   }
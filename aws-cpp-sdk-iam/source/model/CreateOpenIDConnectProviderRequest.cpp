@@ -15,6 +15,7 @@
 #include <aws/iam/model/CreateOpenIDConnectProviderRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -28,11 +29,11 @@ CreateOpenIDConnectProviderRequest::CreateOpenIDConnectProviderRequest() :
 
 Aws::String CreateOpenIDConnectProviderRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateOpenIDConnectProvider&";
   if(m_urlHasBeenSet)
   {
-    ss << "Url=" << StringUtils::URLEncode(m_url.c_str()) << "&";
+    ss << "Url=" << StringUtils::URLEncoded(m_url) << "&";
   }
 
   if(m_clientIDListHasBeenSet)
@@ -41,7 +42,7 @@ Aws::String CreateOpenIDConnectProviderRequest::SerializePayload() const
     for(auto& item : m_clientIDList)
     {
       ss << "ClientIDList.member." << clientIDListCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       clientIDListCount++;
     }
   }
@@ -52,12 +53,12 @@ Aws::String CreateOpenIDConnectProviderRequest::SerializePayload() const
     for(auto& item : m_thumbprintList)
     {
       ss << "ThumbprintList.member." << thumbprintListCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       thumbprintListCount++;
     }
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
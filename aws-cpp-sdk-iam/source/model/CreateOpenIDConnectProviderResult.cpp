@@ -40,7 +40,7 @@ CreateOpenIDConnectProviderResult& CreateOpenIDConnectProviderResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateOpenIDConnectProviderResult")
+  if (rootNode.GetNameView() != "CreateOpenIDConnectProviderResult")
   {
     resultNode = rootNode.FirstChild("CreateOpenIDConnectProviderResult");
   }
@@ -50,7 +50,7 @@ CreateOpenIDConnectProviderResult& CreateOpenIDConnectProviderResult::operator =
     XmlNode openIDConnectProviderArnNode = resultNode.FirstChild("OpenIDConnectProviderArn");
     if(!openIDConnectProviderArnNode.IsNull())
     {
-      m_openIDConnectProviderArn = StringUtils::Trim(openIDConnectProviderArnNode.GetText().c_str());
+      m_openIDConnectProviderArn = openIDConnectProviderArnNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/CreatePolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -29,29 +30,29 @@ CreatePolicyRequest::CreatePolicyRequest() :
 
 Aws::String CreatePolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreatePolicy&";
   if(m_policyNameHasBeenSet)
   {
-    ss << "PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+    ss << "PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
 
   if(m_pathHasBeenSet)
   {
-    ss << "Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+    ss << "Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
 
   if(m_policyDocumentHasBeenSet)
   {
-    ss << "PolicyDocument=" << StringUtils::URLEncode(m_policyDocument.c_str()) << "&";
+    ss << "PolicyDocument=" << StringUtils::URLEncoded(m_policyDocument) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
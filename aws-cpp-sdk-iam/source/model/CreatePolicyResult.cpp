@@ -40,7 +40,7 @@ CreatePolicyResult& CreatePolicyResult::operator =(const AmazonWebServiceResult<
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreatePolicyResult")
+  if (rootNode.GetNameView() != "CreatePolicyResult")
   {
     resultNode = rootNode.FirstChild("CreatePolicyResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/iam/model/CreatePolicyVersionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ CreatePolicyVersionRequest::CreatePolicyVersionRequest() :
 
 Aws::String CreatePolicyVersionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreatePolicyVersion&";
   if(m_policyArnHasBeenSet)
   {
-    ss << "PolicyArn=" << StringUtils::URLEncode(m_policyArn.c_str()) << "&";
+    ss << "PolicyArn=" << StringUtils::URLEncoded(m_policyArn) << "&";
   }
 
   if(m_policyDocumentHasBeenSet)
   {
-    ss << "PolicyDocument=" << StringUtils::URLEncode(m_policyDocument.c_str()) << "&";
+    ss << "PolicyDocument=" << StringUtils::URLEncoded(m_policyDocument) << "&";
   }
 
   if(m_setAsDefaultHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String CreatePolicyVersionRequest::SerializePayload() const
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreatePolicyVersionResult& CreatePolicyVersionResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreatePolicyVersionResult")
+  if (rootNode.GetNameView() != "CreatePolicyVersionResult")
   {
     resultNode = rootNode.FirstChild("CreatePolicyVersionResult");
   }
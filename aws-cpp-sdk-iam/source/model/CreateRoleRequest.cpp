@@ -15,6 +15,7 @@
 #include <aws/iam/model/CreateRoleRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ CreateRoleRequest::CreateRoleRequest() :
 
 Aws::String CreateRoleRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateRole&";
   if(m_pathHasBeenSet)
   {
-    ss << "Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+    ss << "Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
 
   if(m_roleNameHasBeenSet)
   {
-    ss << "RoleName=" << StringUtils::URLEncode(m_roleName.c_str()) << "&";
+    ss << "RoleName=" << StringUtils::URLEncoded(m_roleName) << "&";
   }
 
   if(m_assumeRolePolicyDocumentHasBeenSet)
   {
-    ss << "AssumeRolePolicyDocument=" << StringUtils::URLEncode(m_assumeRolePolicyDocument.c_str()) << "&";
+    ss << "AssumeRolePolicyDocument=" << StringUtils::URLEncoded(m_assumeRolePolicyDocument) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateRoleResult& CreateRoleResult::operator =(const AmazonWebServiceResult<XmlD
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateRoleResult")
+  if (rootNode.GetNameView() != "CreateRoleResult")
   {
     resultNode = rootNode.FirstChild("CreateRoleResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/iam/model/CreateSAMLProviderRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ CreateSAMLProviderRequest::CreateSAMLProviderRequest() :
 
 Aws::String CreateSAMLProviderRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateSAMLProvider&";
   if(m_sAMLMetadataDocumentHasBeenSet)
   {
-    ss << "SAMLMetadataDocument=" << StringUtils::URLEncode(m_sAMLMetadataDocument.c_str()) << "&";
+    ss << "SAMLMetadataDocument=" << StringUtils::URLEncoded(m_sAMLMetadataDocument) << "&";
   }
 
   if(m_nameHasBeenSet)
   {
-    ss << "Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+    ss << "Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateSAMLProviderResult& CreateSAMLProviderResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateSAMLProviderResult")
+  if (rootNode.GetNameView() != "CreateSAMLProviderResult")
   {
     resultNode = rootNode.FirstChild("CreateSAMLProviderResult");
   }
@@ -50,7 +50,7 @@ CreateSAMLProviderResult& CreateSAMLProviderResult::operator =(const AmazonWebSe
     XmlNode sAMLProviderArnNode = resultNode.FirstChild("SAMLProviderArn");
     if(!sAMLProviderArnNode.IsNull())
     {
-      m_sAMLProviderArn = StringUtils::Trim(sAMLProviderArnNode.GetText().c_str());
+      m_sAMLProviderArn = sAMLProviderArnNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/CreateUserRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ CreateUserRequest::CreateUserRequest() :
 
 Aws::String CreateUserRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateUser&";
   if(m_pathHasBeenSet)
   {
-    ss << "Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+    ss << "Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
 
   if(m_userNameHasBeenSet)
   {
-    ss << "UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+    ss << "UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateUserResult& CreateUserResult::operator =(const AmazonWebServiceResult<XmlD
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateUserResult")
+  if (rootNode.GetNameView() != "CreateUserResult")
   {
     resultNode = rootNode.FirstChild("CreateUserResult");
   }
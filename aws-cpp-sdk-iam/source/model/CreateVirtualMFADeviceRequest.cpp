@@ -15,6 +15,7 @@
 #include <aws/iam/model/CreateVirtualMFADeviceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ CreateVirtualMFADeviceRequest::CreateVirtualMFADeviceRequest() :
 
 Aws::String CreateVirtualMFADeviceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateVirtualMFADevice&";
   if(m_pathHasBeenSet)
   {
-    ss << "Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+    ss << "Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
 
   if(m_virtualMFADeviceNameHasBeenSet)
   {
-    ss << "VirtualMFADeviceName=" << StringUtils::URLEncode(m_virtualMFADeviceName.c_str()) << "&";
+    ss << "VirtualMFADeviceName=" << StringUtils::URLEncoded(m_virtualMFADeviceName) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
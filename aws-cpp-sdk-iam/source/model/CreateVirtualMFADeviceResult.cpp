@@ -40,7 +40,7 @@ CreateVirtualMFADeviceResult& CreateVirtualMFADeviceResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateVirtualMFADeviceResult")
+  if (rootNode.GetNameView() != "CreateVirtualMFADeviceResult")
   {
     resultNode = rootNode.FirstChild("CreateVirtualMFADeviceResult");
   }
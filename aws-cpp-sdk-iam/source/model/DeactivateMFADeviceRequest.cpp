@@ -15,6 +15,7 @@
 #include <aws/iam/model/DeactivateMFADeviceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ DeactivateMFADeviceRequest::DeactivateMFADeviceRequest() :
 
 Aws::String DeactivateMFADeviceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeactivateMFADevice&";
   if(m_userNameHasBeenSet)
   {
-    ss << "UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+    ss << "UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_serialNumberHasBeenSet)
   {
-    ss << "SerialNumber=" << StringUtils::URLEncode(m_serialNumber.c_str()) << "&";
+    ss << "SerialNumber=" << StringUtils::URLEncoded(m_serialNumber) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/DeleteInstanceProfileRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteInstanceProfileRequest::DeleteInstanceProfileRequest() :
 
 Aws::String DeleteInstanceProfileRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteInstanceProfile&";
   if(m_instanceProfileNameHasBeenSet)
   {
-    ss << "InstanceProfileName=" << StringUtils::URLEncode(m_instanceProfileName.c_str()) << "&";
+    ss << "InstanceProfileName=" << StringUtils::URLEncoded(m_instanceProfileName) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/DeleteOpenIDConnectProviderRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteOpenIDConnectProviderRequest::DeleteOpenIDConnectProviderRequest() :
 
 Aws::String DeleteOpenIDConnectProviderRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteOpenIDConnectProvider&";
   if(m_openIDConnectProviderArnHasBeenSet)
   {
-    ss << "OpenIDConnectProviderArn=" << StringUtils::URLEncode(m_openIDConnectProviderArn.c_str()) << "&";
+    ss << "OpenIDConnectProviderArn=" << StringUtils::URLEncoded(m_openIDConnectProviderArn) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
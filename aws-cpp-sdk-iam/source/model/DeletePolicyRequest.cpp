@@ -15,6 +15,7 @@
 #include <aws/iam/model/DeletePolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeletePolicyRequest::DeletePolicyRequest() :
 
 Aws::String DeletePolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeletePolicy&";
   if(m_policyArnHasBeenSet)
   {
-    ss << "PolicyArn=" << StringUtils::URLEncode(m_policyArn.c_str()) << "&";
+    ss << "PolicyArn=" << StringUtils::URLEncoded(m_policyArn) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/DeletePolicyVersionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ DeletePolicyVersionRequest::DeletePolicyVersionRequest() :
 
 Aws::String DeletePolicyVersionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeletePolicyVersion&";
   if(m_policyArnHasBeenSet)
   {
-    ss << "PolicyArn=" << StringUtils::URLEncode(m_policyArn.c_str()) << "&";
+    ss << "PolicyArn=" << StringUtils::URLEncoded(m_policyArn) << "&";
   }
 
   if(m_versionIdHasBeenSet)
   {
-    ss << "VersionId=" << StringUtils::URLEncode(m_versionId.c_str()) << "&";
+    ss << "VersionId=" << StringUtils::URLEncoded(m_versionId) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
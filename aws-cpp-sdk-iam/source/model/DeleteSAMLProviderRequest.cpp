@@ -15,6 +15,7 @@
 #include <aws/iam/model/DeleteSAMLProviderRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteSAMLProviderRequest::DeleteSAMLProviderRequest() :
 
 Aws::String DeleteSAMLProviderRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteSAMLProvider&";
   if(m_sAMLProviderArnHasBeenSet)
   {
-    ss << "SAMLProviderArn=" << StringUtils::URLEncode(m_sAMLProviderArn.c_str()) << "&";
+    ss << "SAMLProviderArn=" << StringUtils::URLEncoded(m_sAMLProviderArn) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
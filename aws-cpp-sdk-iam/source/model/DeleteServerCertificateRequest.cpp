@@ -15,6 +15,7 @@
 #include <aws/iam/model/DeleteServerCertificateRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteServerCertificateRequest::DeleteServerCertificateRequest() :
 
 Aws::String DeleteServerCertificateRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteServerCertificate&";
   if(m_serverCertificateNameHasBeenSet)
   {
-    ss << "ServerCertificateName=" << StringUtils::URLEncode(m_serverCertificateName.c_str()) << "&";
+    ss << "ServerCertificateName=" << StringUtils::URLEncoded(m_serverCertificateName) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
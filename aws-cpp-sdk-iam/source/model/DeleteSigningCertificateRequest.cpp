@@ -15,6 +15,7 @@
 #include <aws/iam/model/DeleteSigningCertificateRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ DeleteSigningCertificateRequest::DeleteSigningCertificateRequest() :
 
 Aws::String DeleteSigningCertificateRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteSigningCertificate&";
   if(m_userNameHasBeenSet)
   {
-    ss << "UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+    ss << "UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_certificateIdHasBeenSet)
   {
-    ss << "CertificateId=" << StringUtils::URLEncode(m_certificateId.c_str()) << "&";
+    ss << "CertificateId=" << StringUtils::URLEncoded(m_certificateId) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/DeleteVirtualMFADeviceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteVirtualMFADeviceRequest::DeleteVirtualMFADeviceRequest() :
 
 Aws::String DeleteVirtualMFADeviceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteVirtualMFADevice&";
   if(m_serialNumberHasBeenSet)
   {
-    ss << "SerialNumber=" << StringUtils::URLEncode(m_serialNumber.c_str()) << "&";
+    ss << "SerialNumber=" << StringUtils::URLEncoded(m_serialNumber) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
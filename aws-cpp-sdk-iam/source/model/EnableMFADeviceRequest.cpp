@@ -15,6 +15,7 @@
 #include <aws/iam/model/EnableMFADeviceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -29,29 +30,29 @@ EnableMFADeviceRequest::EnableMFADeviceRequest() :
 
 Aws::String EnableMFADeviceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=EnableMFADevice&";
   if(m_userNameHasBeenSet)
   {
-    ss << "UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+    ss << "UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_serialNumberHasBeenSet)
   {
-    ss << "SerialNumber=" << StringUtils::URLEncode(m_serialNumber.c_str()) << "&";
+    ss << "SerialNumber=" << StringUtils::URLEncoded(m_serialNumber) << "&";
   }
 
   if(m_authenticationCode1HasBeenSet)
   {
-    ss << "AuthenticationCode1=" << StringUtils::URLEncode(m_authenticationCode1.c_str()) << "&";
+    ss << "AuthenticationCode1=" << StringUtils::URLEncoded(m_authenticationCode1) << "&";
   }
 
   if(m_authenticationCode2HasBeenSet)
   {
-    ss << "AuthenticationCode2=" << StringUtils::URLEncode(m_authenticationCode2.c_str()) << "&";
+    ss << "AuthenticationCode2=" << StringUtils::URLEncoded(m_authenticationCode2) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
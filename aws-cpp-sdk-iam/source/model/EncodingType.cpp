@@ -29,21 +29,29 @@ namespace Aws
       namespace EncodingTypeMapper
       {
 
-        static const int SSH_HASH = HashingUtils::HashString("SSH");
-        static const int PEM_HASH = HashingUtils::HashString("PEM");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int SSH_HASH = 82408;
+        static const int PEM_HASH = 79096;
 
 
         EncodingType GetEncodingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SSH_HASH)
+          switch (hashCode)
           {
+          case SSH_HASH:
             return EncodingType::SSH;
-          }
-          else if (hashCode == PEM_HASH)
-          {
+          case PEM_HASH:
             return EncodingType::PEM;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,36 +29,38 @@ namespace Aws
       namespace EntityTypeMapper
       {
 
-        static const int User_HASH = HashingUtils::HashString("User");
-        static const int Role_HASH = HashingUtils::HashString("Role");
-        static const int Group_HASH = HashingUtils::HashString("Group");
-        static const int LocalManagedPolicy_HASH = HashingUtils::HashString("LocalManagedPolicy");
-        static const int AWSManagedPolicy_HASH = HashingUtils::HashString("AWSManagedPolicy");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int User_HASH = 2645995;
+        static const int Role_HASH = 2552982;
+        static const int Group_HASH = 69076575;
+        static const int LocalManagedPolicy_HASH = -200941530;
+        static const int AWSManagedPolicy_HASH = 410332628;
 
 
         EntityType GetEntityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == User_HASH)
+          switch (hashCode)
           {
+          case User_HASH:
             return EntityType::User;
-          }
-          else if (hashCode == Role_HASH)
-          {
+          case Role_HASH:
             return EntityType::Role;
-          }
-          else if (hashCode == Group_HASH)
-          {
+          case Group_HASH:
             return EntityType::Group;
-          }
-          else if (hashCode == LocalManagedPolicy_HASH)
-          {
+          case LocalManagedPolicy_HASH:
             return EntityType::LocalManagedPolicy;
-          }
-          else if (hashCode == AWSManagedPolicy_HASH)
-          {
+          case AWSManagedPolicy_HASH:
             return EntityType::AWSManagedPolicy;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,19 +62,19 @@ EvaluationResult& EvaluationResult::operator =(const XmlNode& xmlNode)
     XmlNode evalActionNameNode = resultNode.FirstChild("EvalActionName");
     if(!evalActionNameNode.IsNull())
     {
-      m_evalActionName = StringUtils::Trim(evalActionNameNode.GetText().c_str());
+      m_evalActionName = evalActionNameNode.GetTextView().Trim().ToString();
       m_evalActionNameHasBeenSet = true;
     }
     XmlNode evalResourceNameNode = resultNode.FirstChild("EvalResourceName");
     if(!evalResourceNameNode.IsNull())
     {
-      m_evalResourceName = StringUtils::Trim(evalResourceNameNode.GetText().c_str());
+      m_evalResourceName = evalResourceNameNode.GetTextView().Trim().ToString();
       m_evalResourceNameHasBeenSet = true;
     }
     XmlNode evalDecisionNode = resultNode.FirstChild("EvalDecision");
     if(!evalDecisionNode.IsNull())
     {
-      m_evalDecision = PolicyEvaluationDecisionTypeMapper::GetPolicyEvaluationDecisionTypeForName(StringUtils::Trim(evalDecisionNode.GetText().c_str()).c_str());
+      m_evalDecision = PolicyEvaluationDecisionTypeMapper::GetPolicyEvaluationDecisionTypeForName(evalDecisionNode.GetTextView().Trim().ToString().c_str());
       m_evalDecisionHasBeenSet = true;
     }
     XmlNode matchedStatementsNode = resultNode.FirstChild("MatchedStatements");
@@ -94,7 +95,7 @@ EvaluationResult& EvaluationResult::operator =(const XmlNode& xmlNode)
       XmlNode missingContextValuesMember = missingContextValuesNode.FirstChild("member");
       while(!missingContextValuesMember.IsNull())
       {
-        m_missingContextValues.push_back(StringUtils::Trim(missingContextValuesMember.GetText().c_str()));
+        m_missingContextValues.push_back(missingContextValuesMember.GetTextView().Trim().ToString());
         missingContextValuesMember = missingContextValuesMember.NextNode("member");
       }
 
@@ -109,8 +110,8 @@ EvaluationResult& EvaluationResult::operator =(const XmlNode& xmlNode)
       {
         XmlNode keyNode = evalDecisionDetailsEntry.FirstChild("key");
         XmlNode valueNode = evalDecisionDetailsEntry.FirstChild("value");
-        m_evalDecisionDetails[StringUtils::Trim(keyNode.GetText().c_str())] =
-            PolicyEvaluationDecisionTypeMapper::GetPolicyEvaluationDecisionTypeForName(StringUtils::Trim(valueNode.GetText().c_str()));
+        m_evalDecisionDetails[keyNode.GetTextView().Trim().ToString()] =
+            PolicyEvaluationDecisionTypeMapper::GetPolicyEvaluationDecisionTypeForName(valueNode.GetTextView().Trim().ToString());
         evalDecisionDetailsEntry = evalDecisionDetailsEntry.NextNode("entry");
       }
 
@@ -137,12 +138,12 @@ void EvaluationResult::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_evalActionNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EvalActionName=" << StringUtils::URLEncode(m_evalActionName.c_str()) << "&";
+      oStream << location << index << locationValue << ".EvalActionName=" << StringUtils::URLEncoded(m_evalActionName) << "&";
   }
 
   if(m_evalResourceNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EvalResourceName=" << StringUtils::URLEncode(m_evalResourceName.c_str()) << "&";
+      oStream << location << index << locationValue << ".EvalResourceName=" << StringUtils::URLEncoded(m_evalResourceName) << "&";
   }
 
   if(m_evalDecisionHasBeenSet)
@@ -155,9 +156,9 @@ void EvaluationResult::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned matchedStatementsIdx = 1;
       for(auto& item : m_matchedStatements)
       {
-        Aws::StringStream matchedStatementsSs;
+        Aws::Utils::Stream::StringOutputStream matchedStatementsSs;
         matchedStatementsSs << location << index << locationValue << ".MatchedStatements.member." << matchedStatementsIdx++;
-        item.OutputToStream(oStream, matchedStatementsSs.str().c_str());
+        item.OutputToStream(oStream, matchedStatementsSs.GetString().c_str());
       }
   }
 
@@ -166,7 +167,7 @@ void EvaluationResult::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned missingContextValuesIdx = 1;
       for(auto& item : m_missingContextValues)
       {
-        oStream << location << index << locationValue << ".MissingContextValues.member." << missingContextValuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".MissingContextValues.member." << missingContextValuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -176,9 +177,9 @@ void EvaluationResult::OutputToStream(Aws::OStream& oStream, const char* locatio
       for(auto& item : m_evalDecisionDetails)
       {
         oStream << location << index << locationValue << ".EvalDecisionDetails.entry." << evalDecisionDetailsIdx << ".key="
-            << StringUtils::URLEncode(item.first.c_str()) << "&";
+            << StringUtils::URLEncoded(item.first) << "&";
         oStream << location << index << locationValue << ".EvalDecisionDetails.entry." << evalDecisionDetailsIdx << ".value="
-            << StringUtils::URLEncode(PolicyEvaluationDecisionTypeMapper::GetNameForPolicyEvaluationDecisionType(item.second).c_str()) << "&";
+            << StringUtils::URLEncoded(PolicyEvaluationDecisionTypeMapper::GetNameForPolicyEvaluationDecisionType(item.second)) << "&";
         evalDecisionDetailsIdx++;
       }
   }
@@ -188,9 +189,9 @@ void EvaluationResult::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned resourceSpecificResultsIdx = 1;
       for(auto& item : m_resourceSpecificResults)
       {
-        Aws::StringStream resourceSpecificResultsSs;
+        Aws::Utils::Stream::StringOutputStream resourceSpecificResultsSs;
         resourceSpecificResultsSs << location << index << locationValue << ".ResourceSpecificResults.member." << resourceSpecificResultsIdx++;
-        item.OutputToStream(oStream, resourceSpecificResultsSs.str().c_str());
+        item.OutputToStream(oStream, resourceSpecificResultsSs.GetString().c_str());
       }
   }
 
@@ -200,11 +201,11 @@ void EvaluationResult::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_evalActionNameHasBeenSet)
   {
-      oStream << location << ".EvalActionName=" << StringUtils::URLEncode(m_evalActionName.c_str()) << "&";
+      oStream << location << ".EvalActionName=" << StringUtils::URLEncoded(m_evalActionName) << "&";
   }
   if(m_evalResourceNameHasBeenSet)
   {
-      oStream << location << ".EvalResourceName=" << StringUtils::URLEncode(m_evalResourceName.c_str()) << "&";
+      oStream << location << ".EvalResourceName=" << StringUtils::URLEncoded(m_evalResourceName) << "&";
   }
   if(m_evalDecisionHasBeenSet)
   {
@@ -215,9 +216,9 @@ void EvaluationResult::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned matchedStatementsIdx = 1;
       for(auto& item : m_matchedStatements)
       {
-        Aws::StringStream matchedStatementsSs;
+        Aws::Utils::Stream::StringOutputStream matchedStatementsSs;
         matchedStatementsSs << location <<  ".MatchedStatements.member." << matchedStatementsIdx++;
-        item.OutputToStream(oStream, matchedStatementsSs.str().c_str());
+        item.OutputToStream(oStream, matchedStatementsSs.GetString().c_str());
       }
   }
   if(m_missingContextValuesHasBeenSet)
@@ -225,7 +226,7 @@ void EvaluationResult::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned missingContextValuesIdx = 1;
       for(auto& item : m_missingContextValues)
       {
-        oStream << location << ".MissingContextValues.member." << missingContextValuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".MissingContextValues.member." << missingContextValuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_evalDecisionDetailsHasBeenSet)
@@ -234,9 +235,9 @@ void EvaluationResult::OutputToStream(Aws::OStream& oStream, const char* locatio
       for(auto& item : m_evalDecisionDetails)
       {
         oStream << location << ".EvalDecisionDetails.entry."  << evalDecisionDetailsIdx << ".key="
-            << StringUtils::URLEncode(item.first.c_str()) << "&";
+            << StringUtils::URLEncoded(item.first) << "&";
         oStream << location <<  ".EvalDecisionDetails.entry." << evalDecisionDetailsIdx << ".value="
-            << StringUtils::URLEncode(PolicyEvaluationDecisionTypeMapper::GetNameForPolicyEvaluationDecisionType(item.second).c_str()) << "&";
+            << StringUtils::URLEncoded(PolicyEvaluationDecisionTypeMapper::GetNameForPolicyEvaluationDecisionType(item.second)) << "&";
         evalDecisionDetailsIdx++;
       }
 
@@ -246,9 +247,9 @@ void EvaluationResult::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned resourceSpecificResultsIdx = 1;
       for(auto& item : m_resourceSpecificResults)
       {
-        Aws::StringStream resourceSpecificResultsSs;
+        Aws::Utils::Stream::StringOutputStream resourceSpecificResultsSs;
         resourceSpecificResultsSs << location <<  ".ResourceSpecificResults.member." << resourceSpecificResultsIdx++;
-        item.OutputToStream(oStream, resourceSpecificResultsSs.str().c_str());
+        item.OutputToStream(oStream, resourceSpecificResultsSs.GetString().c_str());
       }
   }
 }
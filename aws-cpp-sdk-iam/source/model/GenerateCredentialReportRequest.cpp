@@ -15,6 +15,7 @@
 #include <aws/iam/model/GenerateCredentialReportRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -25,9 +26,9 @@ GenerateCredentialReportRequest::GenerateCredentialReportRequest()
 
 Aws::String GenerateCredentialReportRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GenerateCredentialReport&";
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
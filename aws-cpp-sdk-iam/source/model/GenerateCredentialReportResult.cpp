@@ -40,7 +40,7 @@ GenerateCredentialReportResult& GenerateCredentialReportResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GenerateCredentialReportResult")
+  if (rootNode.GetNameView() != "GenerateCredentialReportResult")
   {
     resultNode = rootNode.FirstChild("GenerateCredentialReportResult");
   }
@@ -50,12 +50,12 @@ GenerateCredentialReportResult& GenerateCredentialReportResult::operator =(const
     XmlNode stateNode = resultNode.FirstChild("State");
     if(!stateNode.IsNull())
     {
-      m_state = ReportStateTypeMapper::GetReportStateTypeForName(StringUtils::Trim(stateNode.GetText().c_str()).c_str());
+      m_state = ReportStateTypeMapper::GetReportStateTypeForName(stateNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
     }
   }
 
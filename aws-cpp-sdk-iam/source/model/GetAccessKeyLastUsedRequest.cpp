@@ -15,6 +15,7 @@
 #include <aws/iam/model/GetAccessKeyLastUsedRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ GetAccessKeyLastUsedRequest::GetAccessKeyLastUsedRequest() :
 
 Aws::String GetAccessKeyLastUsedRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetAccessKeyLastUsed&";
   if(m_accessKeyIdHasBeenSet)
   {
-    ss << "AccessKeyId=" << StringUtils::URLEncode(m_accessKeyId.c_str()) << "&";
+    ss << "AccessKeyId=" << StringUtils::URLEncoded(m_accessKeyId) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ GetAccessKeyLastUsedResult& GetAccessKeyLastUsedResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetAccessKeyLastUsedResult")
+  if (rootNode.GetNameView() != "GetAccessKeyLastUsedResult")
   {
     resultNode = rootNode.FirstChild("GetAccessKeyLastUsedResult");
   }
@@ -50,7 +50,7 @@ GetAccessKeyLastUsedResult& GetAccessKeyLastUsedResult::operator =(const AmazonW
     XmlNode userNameNode = resultNode.FirstChild("UserName");
     if(!userNameNode.IsNull())
     {
-      m_userName = StringUtils::Trim(userNameNode.GetText().c_str());
+      m_userName = userNameNode.GetTextView().Trim().ToString();
     }
     XmlNode accessKeyLastUsedNode = resultNode.FirstChild("AccessKeyLastUsed");
     if(!accessKeyLastUsedNode.IsNull())
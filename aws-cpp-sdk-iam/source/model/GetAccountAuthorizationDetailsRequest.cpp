@@ -15,6 +15,7 @@
 #include <aws/iam/model/GetAccountAuthorizationDetailsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ GetAccountAuthorizationDetailsRequest::GetAccountAuthorizationDetailsRequest() :
 
 Aws::String GetAccountAuthorizationDetailsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetAccountAuthorizationDetails&";
   if(m_filterHasBeenSet)
   {
@@ -37,7 +38,7 @@ Aws::String GetAccountAuthorizationDetailsRequest::SerializePayload() const
     for(auto& item : m_filter)
     {
       ss << "Filter.member." << filterCount << "="
-          << StringUtils::URLEncode(EntityTypeMapper::GetNameForEntityType(item).c_str()) << "&";
+          << StringUtils::URLEncoded(EntityTypeMapper::GetNameForEntityType(item)) << "&";
       filterCount++;
     }
   }
@@ -49,10 +50,10 @@ Aws::String GetAccountAuthorizationDetailsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ GetAccountPasswordPolicyResult& GetAccountPasswordPolicyResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetAccountPasswordPolicyResult")
+  if (rootNode.GetNameView() != "GetAccountPasswordPolicyResult")
   {
     resultNode = rootNode.FirstChild("GetAccountPasswordPolicyResult");
   }
@@ -40,7 +40,7 @@ GetAccountSummaryResult& GetAccountSummaryResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetAccountSummaryResult")
+  if (rootNode.GetNameView() != "GetAccountSummaryResult")
   {
     resultNode = rootNode.FirstChild("GetAccountSummaryResult");
   }
@@ -56,8 +56,8 @@ GetAccountSummaryResult& GetAccountSummaryResult::operator =(const AmazonWebServ
       {
         XmlNode keyNode = summaryMapEntry.FirstChild("key");
         XmlNode valueNode = summaryMapEntry.FirstChild("value");
-        m_summaryMap[SummaryKeyTypeMapper::GetSummaryKeyTypeForName(StringUtils::Trim(keyNode.GetText().c_str()))] =
-           StringUtils::ConvertToInt32(StringUtils::Trim(valueNode.GetText().c_str()).c_str());
+        m_summaryMap[SummaryKeyTypeMapper::GetSummaryKeyTypeForName(keyNode.GetTextView().Trim().ToString())] =
+           StringUtils::ConvertToInt32(valueNode.GetTextView().Trim().ToString().c_str());
         summaryMapEntry = summaryMapEntry.NextNode("entry");
       }
 
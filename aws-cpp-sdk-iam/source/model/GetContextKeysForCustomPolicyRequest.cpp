@@ -15,6 +15,7 @@
 #include <aws/iam/model/GetContextKeysForCustomPolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -26,7 +27,7 @@ GetContextKeysForCustomPolicyRequest::GetContextKeysForCustomPolicyRequest() :
 
 Aws::String GetContextKeysForCustomPolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetContextKeysForCustomPolicy&";
   if(m_policyInputListHasBeenSet)
   {
@@ -34,12 +35,12 @@ Aws::String GetContextKeysForCustomPolicyRequest::SerializePayload() const
     for(auto& item : m_policyInputList)
     {
       ss << "PolicyInputList.member." << policyInputListCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       policyInputListCount++;
     }
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
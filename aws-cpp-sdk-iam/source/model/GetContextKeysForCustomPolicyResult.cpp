@@ -40,7 +40,7 @@ GetContextKeysForCustomPolicyResult& GetContextKeysForCustomPolicyResult::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetContextKeysForCustomPolicyResult")
+  if (rootNode.GetNameView() != "GetContextKeysForCustomPolicyResult")
   {
     resultNode = rootNode.FirstChild("GetContextKeysForCustomPolicyResult");
   }
@@ -53,7 +53,7 @@ GetContextKeysForCustomPolicyResult& GetContextKeysForCustomPolicyResult::operat
       XmlNode contextKeyNamesMember = contextKeyNamesNode.FirstChild("member");
       while(!contextKeyNamesMember.IsNull())
       {
-        m_contextKeyNames.push_back(StringUtils::Trim(contextKeyNamesMember.GetText().c_str()));
+        m_contextKeyNames.push_back(contextKeyNamesMember.GetTextView().Trim().ToString());
         contextKeyNamesMember = contextKeyNamesMember.NextNode("member");
       }
 
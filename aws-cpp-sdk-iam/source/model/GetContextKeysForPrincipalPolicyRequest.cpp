@@ -15,6 +15,7 @@
 #include <aws/iam/model/GetContextKeysForPrincipalPolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ GetContextKeysForPrincipalPolicyRequest::GetContextKeysForPrincipalPolicyRequest
 
 Aws::String GetContextKeysForPrincipalPolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetContextKeysForPrincipalPolicy&";
   if(m_policySourceArnHasBeenSet)
   {
-    ss << "PolicySourceArn=" << StringUtils::URLEncode(m_policySourceArn.c_str()) << "&";
+    ss << "PolicySourceArn=" << StringUtils::URLEncoded(m_policySourceArn) << "&";
   }
 
   if(m_policyInputListHasBeenSet)
@@ -40,12 +41,12 @@ Aws::String GetContextKeysForPrincipalPolicyRequest::SerializePayload() const
     for(auto& item : m_policyInputList)
     {
       ss << "PolicyInputList.member." << policyInputListCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       policyInputListCount++;
     }
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
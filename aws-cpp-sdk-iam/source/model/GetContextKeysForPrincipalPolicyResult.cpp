@@ -40,7 +40,7 @@ GetContextKeysForPrincipalPolicyResult& GetContextKeysForPrincipalPolicyResult::
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetContextKeysForPrincipalPolicyResult")
+  if (rootNode.GetNameView() != "GetContextKeysForPrincipalPolicyResult")
   {
     resultNode = rootNode.FirstChild("GetContextKeysForPrincipalPolicyResult");
   }
@@ -53,7 +53,7 @@ GetContextKeysForPrincipalPolicyResult& GetContextKeysForPrincipalPolicyResult::
       XmlNode contextKeyNamesMember = contextKeyNamesNode.FirstChild("member");
       while(!contextKeyNamesMember.IsNull())
       {
-        m_contextKeyNames.push_back(StringUtils::Trim(contextKeyNamesMember.GetText().c_str()));
+        m_contextKeyNames.push_back(contextKeyNamesMember.GetTextView().Trim().ToString());
         contextKeyNamesMember = contextKeyNamesMember.NextNode("member");
       }
 
@@ -41,7 +41,7 @@ GetCredentialReportResult& GetCredentialReportResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetCredentialReportResult")
+  if (rootNode.GetNameView() != "GetCredentialReportResult")
   {
     resultNode = rootNode.FirstChild("GetCredentialReportResult");
   }
@@ -51,17 +51,17 @@ GetCredentialReportResult& GetCredentialReportResult::operator =(const AmazonWeb
     XmlNode contentNode = resultNode.FirstChild("Content");
     if(!contentNode.IsNull())
     {
-      m_content = HashingUtils::Base64Decode(StringUtils::Trim(contentNode.GetText().c_str()));
+      m_content = HashingUtils::Base64Decode(contentNode.GetTextView().Trim().ToString());
     }
     XmlNode reportFormatNode = resultNode.FirstChild("ReportFormat");
     if(!reportFormatNode.IsNull())
     {
-      m_reportFormat = ReportFormatTypeMapper::GetReportFormatTypeForName(StringUtils::Trim(reportFormatNode.GetText().c_str()).c_str());
+      m_reportFormat = ReportFormatTypeMapper::GetReportFormatTypeForName(reportFormatNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode generatedTimeNode = resultNode.FirstChild("GeneratedTime");
     if(!generatedTimeNode.IsNull())
     {
-      m_generatedTime = DateTime(StringUtils::Trim(generatedTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_generatedTime = DateTime(generatedTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
   }
 
@@ -40,7 +40,7 @@ GetInstanceProfileResult& GetInstanceProfileResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetInstanceProfileResult")
+  if (rootNode.GetNameView() != "GetInstanceProfileResult")
   {
     resultNode = rootNode.FirstChild("GetInstanceProfileResult");
   }
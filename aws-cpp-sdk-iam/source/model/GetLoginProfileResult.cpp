@@ -40,7 +40,7 @@ GetLoginProfileResult& GetLoginProfileResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetLoginProfileResult")
+  if (rootNode.GetNameView() != "GetLoginProfileResult")
   {
     resultNode = rootNode.FirstChild("GetLoginProfileResult");
   }
@@ -40,7 +40,7 @@ GetOpenIDConnectProviderResult& GetOpenIDConnectProviderResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetOpenIDConnectProviderResult")
+  if (rootNode.GetNameView() != "GetOpenIDConnectProviderResult")
   {
     resultNode = rootNode.FirstChild("GetOpenIDConnectProviderResult");
   }
@@ -50,7 +50,7 @@ GetOpenIDConnectProviderResult& GetOpenIDConnectProviderResult::operator =(const
     XmlNode urlNode = resultNode.FirstChild("Url");
     if(!urlNode.IsNull())
     {
-      m_url = StringUtils::Trim(urlNode.GetText().c_str());
+      m_url = urlNode.GetTextView().Trim().ToString();
     }
     XmlNode clientIDListNode = resultNode.FirstChild("ClientIDList");
     if(!clientIDListNode.IsNull())
@@ -58,7 +58,7 @@ GetOpenIDConnectProviderResult& GetOpenIDConnectProviderResult::operator =(const
       XmlNode clientIDListMember = clientIDListNode.FirstChild("member");
       while(!clientIDListMember.IsNull())
       {
-        m_clientIDList.push_back(StringUtils::Trim(clientIDListMember.GetText().c_str()));
+        m_clientIDList.push_back(clientIDListMember.GetTextView().Trim().ToString());
         clientIDListMember = clientIDListMember.NextNode("member");
       }
 
@@ -69,7 +69,7 @@ GetOpenIDConnectProviderResult& GetOpenIDConnectProviderResult::operator =(const
       XmlNode thumbprintListMember = thumbprintListNode.FirstChild("member");
       while(!thumbprintListMember.IsNull())
       {
-        m_thumbprintList.push_back(StringUtils::Trim(thumbprintListMember.GetText().c_str()));
+        m_thumbprintList.push_back(thumbprintListMember.GetTextView().Trim().ToString());
         thumbprintListMember = thumbprintListMember.NextNode("member");
       }
 
@@ -77,7 +77,7 @@ GetOpenIDConnectProviderResult& GetOpenIDConnectProviderResult::operator =(const
     XmlNode createDateNode = resultNode.FirstChild("CreateDate");
     if(!createDateNode.IsNull())
     {
-      m_createDate = DateTime(StringUtils::Trim(createDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createDate = DateTime(createDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
   }
 
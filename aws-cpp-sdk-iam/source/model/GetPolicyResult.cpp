@@ -40,7 +40,7 @@ GetPolicyResult& GetPolicyResult::operator =(const AmazonWebServiceResult<XmlDoc
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetPolicyResult")
+  if (rootNode.GetNameView() != "GetPolicyResult")
   {
     resultNode = rootNode.FirstChild("GetPolicyResult");
   }
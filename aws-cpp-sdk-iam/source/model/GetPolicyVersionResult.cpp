@@ -40,7 +40,7 @@ GetPolicyVersionResult& GetPolicyVersionResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetPolicyVersionResult")
+  if (rootNode.GetNameView() != "GetPolicyVersionResult")
   {
     resultNode = rootNode.FirstChild("GetPolicyVersionResult");
   }
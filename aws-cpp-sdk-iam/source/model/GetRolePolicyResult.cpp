@@ -40,7 +40,7 @@ GetRolePolicyResult& GetRolePolicyResult::operator =(const AmazonWebServiceResul
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetRolePolicyResult")
+  if (rootNode.GetNameView() != "GetRolePolicyResult")
   {
     resultNode = rootNode.FirstChild("GetRolePolicyResult");
   }
@@ -50,17 +50,17 @@ GetRolePolicyResult& GetRolePolicyResult::operator =(const AmazonWebServiceResul
     XmlNode roleNameNode = resultNode.FirstChild("RoleName");
     if(!roleNameNode.IsNull())
     {
-      m_roleName = StringUtils::Trim(roleNameNode.GetText().c_str());
+      m_roleName = roleNameNode.GetTextView().Trim().ToString();
     }
     XmlNode policyNameNode = resultNode.FirstChild("PolicyName");
     if(!policyNameNode.IsNull())
     {
-      m_policyName = StringUtils::Trim(policyNameNode.GetText().c_str());
+      m_policyName = policyNameNode.GetTextView().Trim().ToString();
     }
     XmlNode policyDocumentNode = resultNode.FirstChild("PolicyDocument");
     if(!policyDocumentNode.IsNull())
     {
-      m_policyDocument = StringUtils::Trim(policyDocumentNode.GetText().c_str());
+      m_policyDocument = policyDocumentNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ GetRoleResult& GetRoleResult::operator =(const AmazonWebServiceResult<XmlDocumen
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetRoleResult")
+  if (rootNode.GetNameView() != "GetRoleResult")
   {
     resultNode = rootNode.FirstChild("GetRoleResult");
   }
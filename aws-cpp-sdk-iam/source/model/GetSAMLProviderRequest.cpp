@@ -15,6 +15,7 @@
 #include <aws/iam/model/GetSAMLProviderRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ GetSAMLProviderRequest::GetSAMLProviderRequest() :
 
 Aws::String GetSAMLProviderRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetSAMLProvider&";
   if(m_sAMLProviderArnHasBeenSet)
   {
-    ss << "SAMLProviderArn=" << StringUtils::URLEncode(m_sAMLProviderArn.c_str()) << "&";
+    ss << "SAMLProviderArn=" << StringUtils::URLEncoded(m_sAMLProviderArn) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
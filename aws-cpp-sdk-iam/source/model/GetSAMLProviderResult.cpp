@@ -40,7 +40,7 @@ GetSAMLProviderResult& GetSAMLProviderResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetSAMLProviderResult")
+  if (rootNode.GetNameView() != "GetSAMLProviderResult")
   {
     resultNode = rootNode.FirstChild("GetSAMLProviderResult");
   }
@@ -50,17 +50,17 @@ GetSAMLProviderResult& GetSAMLProviderResult::operator =(const AmazonWebServiceR
     XmlNode sAMLMetadataDocumentNode = resultNode.FirstChild("SAMLMetadataDocument");
     if(!sAMLMetadataDocumentNode.IsNull())
     {
-      m_sAMLMetadataDocument = StringUtils::Trim(sAMLMetadataDocumentNode.GetText().c_str());
+      m_sAMLMetadataDocument = sAMLMetadataDocumentNode.GetTextView().Trim().ToString();
     }
     XmlNode createDateNode = resultNode.FirstChild("CreateDate");
     if(!createDateNode.IsNull())
     {
-      m_createDate = DateTime(StringUtils::Trim(createDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createDate = DateTime(createDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
     XmlNode validUntilNode = resultNode.FirstChild("ValidUntil");
     if(!validUntilNode.IsNull())
     {
-      m_validUntil = DateTime(StringUtils::Trim(validUntilNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_validUntil = DateTime(validUntilNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
   }
 
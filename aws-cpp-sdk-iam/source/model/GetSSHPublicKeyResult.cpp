@@ -40,7 +40,7 @@ GetSSHPublicKeyResult& GetSSHPublicKeyResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetSSHPublicKeyResult")
+  if (rootNode.GetNameView() != "GetSSHPublicKeyResult")
   {
     resultNode = rootNode.FirstChild("GetSSHPublicKeyResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/iam/model/GetServerCertificateRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ GetServerCertificateRequest::GetServerCertificateRequest() :
 
 Aws::String GetServerCertificateRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetServerCertificate&";
   if(m_serverCertificateNameHasBeenSet)
   {
-    ss << "ServerCertificateName=" << StringUtils::URLEncode(m_serverCertificateName.c_str()) << "&";
+    ss << "ServerCertificateName=" << StringUtils::URLEncoded(m_serverCertificateName) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ GetServerCertificateResult& GetServerCertificateResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetServerCertificateResult")
+  if (rootNode.GetNameView() != "GetServerCertificateResult")
   {
     resultNode = rootNode.FirstChild("GetServerCertificateResult");
   }
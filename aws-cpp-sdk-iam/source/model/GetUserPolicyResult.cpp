@@ -40,7 +40,7 @@ GetUserPolicyResult& GetUserPolicyResult::operator =(const AmazonWebServiceResul
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetUserPolicyResult")
+  if (rootNode.GetNameView() != "GetUserPolicyResult")
   {
     resultNode = rootNode.FirstChild("GetUserPolicyResult");
   }
@@ -50,17 +50,17 @@ GetUserPolicyResult& GetUserPolicyResult::operator =(const AmazonWebServiceResul
     XmlNode userNameNode = resultNode.FirstChild("UserName");
     if(!userNameNode.IsNull())
     {
-      m_userName = StringUtils::Trim(userNameNode.GetText().c_str());
+      m_userName = userNameNode.GetTextView().Trim().ToString();
     }
     XmlNode policyNameNode = resultNode.FirstChild("PolicyName");
     if(!policyNameNode.IsNull())
     {
-      m_policyName = StringUtils::Trim(policyNameNode.GetText().c_str());
+      m_policyName = policyNameNode.GetTextView().Trim().ToString();
     }
     XmlNode policyDocumentNode = resultNode.FirstChild("PolicyDocument");
     if(!policyDocumentNode.IsNull())
     {
-      m_policyDocument = StringUtils::Trim(policyDocumentNode.GetText().c_str());
+      m_policyDocument = policyDocumentNode.GetTextView().Trim().ToString();
     }
   }
 
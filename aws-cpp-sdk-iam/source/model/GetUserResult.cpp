@@ -40,7 +40,7 @@ GetUserResult& GetUserResult::operator =(const AmazonWebServiceResult<XmlDocumen
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetUserResult")
+  if (rootNode.GetNameView() != "GetUserResult")
   {
     resultNode = rootNode.FirstChild("GetUserResult");
   }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,31 +62,31 @@ GroupDetail& GroupDetail::operator =(const XmlNode& xmlNode)
     XmlNode pathNode = resultNode.FirstChild("Path");
     if(!pathNode.IsNull())
     {
-      m_path = StringUtils::Trim(pathNode.GetText().c_str());
+      m_path = pathNode.GetTextView().Trim().ToString();
       m_pathHasBeenSet = true;
     }
     XmlNode groupNameNode = resultNode.FirstChild("GroupName");
     if(!groupNameNode.IsNull())
     {
-      m_groupName = StringUtils::Trim(groupNameNode.GetText().c_str());
+      m_groupName = groupNameNode.GetTextView().Trim().ToString();
       m_groupNameHasBeenSet = true;
     }
     XmlNode groupIdNode = resultNode.FirstChild("GroupId");
     if(!groupIdNode.IsNull())
     {
-      m_groupId = StringUtils::Trim(groupIdNode.GetText().c_str());
+      m_groupId = groupIdNode.GetTextView().Trim().ToString();
       m_groupIdHasBeenSet = true;
     }
     XmlNode arnNode = resultNode.FirstChild("Arn");
     if(!arnNode.IsNull())
     {
-      m_arn = StringUtils::Trim(arnNode.GetText().c_str());
+      m_arn = arnNode.GetTextView().Trim().ToString();
       m_arnHasBeenSet = true;
     }
     XmlNode createDateNode = resultNode.FirstChild("CreateDate");
     if(!createDateNode.IsNull())
     {
-      m_createDate = DateTime(StringUtils::Trim(createDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createDate = DateTime(createDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createDateHasBeenSet = true;
     }
     XmlNode groupPolicyListNode = resultNode.FirstChild("GroupPolicyList");
@@ -121,27 +122,27 @@ void GroupDetail::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_pathHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+      oStream << location << index << locationValue << ".Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
 
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   if(m_groupIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".GroupId=" << StringUtils::URLEncode(m_groupId.c_str()) << "&";
+      oStream << location << index << locationValue << ".GroupId=" << StringUtils::URLEncoded(m_groupId) << "&";
   }
 
   if(m_arnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
 
   if(m_createDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_groupPolicyListHasBeenSet)
@@ -149,9 +150,9 @@ void GroupDetail::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned groupPolicyListIdx = 1;
       for(auto& item : m_groupPolicyList)
       {
-        Aws::StringStream groupPolicyListSs;
+        Aws::Utils::Stream::StringOutputStream groupPolicyListSs;
         groupPolicyListSs << location << index << locationValue << ".GroupPolicyList.member." << groupPolicyListIdx++;
-        item.OutputToStream(oStream, groupPolicyListSs.str().c_str());
+        item.OutputToStream(oStream, groupPolicyListSs.GetString().c_str());
       }
   }
 
@@ -160,9 +161,9 @@ void GroupDetail::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned attachedManagedPoliciesIdx = 1;
       for(auto& item : m_attachedManagedPolicies)
       {
-        Aws::StringStream attachedManagedPoliciesSs;
+        Aws::Utils::Stream::StringOutputStream attachedManagedPoliciesSs;
         attachedManagedPoliciesSs << location << index << locationValue << ".AttachedManagedPolicies.member." << attachedManagedPoliciesIdx++;
-        item.OutputToStream(oStream, attachedManagedPoliciesSs.str().c_str());
+        item.OutputToStream(oStream, attachedManagedPoliciesSs.GetString().c_str());
       }
   }
 
@@ -172,32 +173,32 @@ void GroupDetail::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_pathHasBeenSet)
   {
-      oStream << location << ".Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+      oStream << location << ".Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
   if(m_groupNameHasBeenSet)
   {
-      oStream << location << ".GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+      oStream << location << ".GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
   if(m_groupIdHasBeenSet)
   {
-      oStream << location << ".GroupId=" << StringUtils::URLEncode(m_groupId.c_str()) << "&";
+      oStream << location << ".GroupId=" << StringUtils::URLEncoded(m_groupId) << "&";
   }
   if(m_arnHasBeenSet)
   {
-      oStream << location << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
   if(m_createDateHasBeenSet)
   {
-      oStream << location << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_groupPolicyListHasBeenSet)
   {
       unsigned groupPolicyListIdx = 1;
       for(auto& item : m_groupPolicyList)
       {
-        Aws::StringStream groupPolicyListSs;
+        Aws::Utils::Stream::StringOutputStream groupPolicyListSs;
         groupPolicyListSs << location <<  ".GroupPolicyList.member." << groupPolicyListIdx++;
-        item.OutputToStream(oStream, groupPolicyListSs.str().c_str());
+        item.OutputToStream(oStream, groupPolicyListSs.GetString().c_str());
       }
   }
   if(m_attachedManagedPoliciesHasBeenSet)
@@ -205,9 +206,9 @@ void GroupDetail::OutputToStream(Aws::OStream& oStream, const char* location) co
       unsigned attachedManagedPoliciesIdx = 1;
       for(auto& item : m_attachedManagedPolicies)
       {
-        Aws::StringStream attachedManagedPoliciesSs;
+        Aws::Utils::Stream::StringOutputStream attachedManagedPoliciesSs;
         attachedManagedPoliciesSs << location <<  ".AttachedManagedPolicies.member." << attachedManagedPoliciesIdx++;
-        item.OutputToStream(oStream, attachedManagedPoliciesSs.str().c_str());
+        item.OutputToStream(oStream, attachedManagedPoliciesSs.GetString().c_str());
       }
   }
 }
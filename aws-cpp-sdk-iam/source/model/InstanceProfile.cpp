@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,31 +60,31 @@ InstanceProfile& InstanceProfile::operator =(const XmlNode& xmlNode)
     XmlNode pathNode = resultNode.FirstChild("Path");
     if(!pathNode.IsNull())
     {
-      m_path = StringUtils::Trim(pathNode.GetText().c_str());
+      m_path = pathNode.GetTextView().Trim().ToString();
       m_pathHasBeenSet = true;
     }
     XmlNode instanceProfileNameNode = resultNode.FirstChild("InstanceProfileName");
     if(!instanceProfileNameNode.IsNull())
     {
-      m_instanceProfileName = StringUtils::Trim(instanceProfileNameNode.GetText().c_str());
+      m_instanceProfileName = instanceProfileNameNode.GetTextView().Trim().ToString();
       m_instanceProfileNameHasBeenSet = true;
     }
     XmlNode instanceProfileIdNode = resultNode.FirstChild("InstanceProfileId");
     if(!instanceProfileIdNode.IsNull())
     {
-      m_instanceProfileId = StringUtils::Trim(instanceProfileIdNode.GetText().c_str());
+      m_instanceProfileId = instanceProfileIdNode.GetTextView().Trim().ToString();
       m_instanceProfileIdHasBeenSet = true;
     }
     XmlNode arnNode = resultNode.FirstChild("Arn");
     if(!arnNode.IsNull())
     {
-      m_arn = StringUtils::Trim(arnNode.GetText().c_str());
+      m_arn = arnNode.GetTextView().Trim().ToString();
       m_arnHasBeenSet = true;
     }
     XmlNode createDateNode = resultNode.FirstChild("CreateDate");
     if(!createDateNode.IsNull())
     {
-      m_createDate = DateTime(StringUtils::Trim(createDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createDate = DateTime(createDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createDateHasBeenSet = true;
     }
     XmlNode rolesNode = resultNode.FirstChild("Roles");
@@ -107,27 +108,27 @@ void InstanceProfile::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_pathHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+      oStream << location << index << locationValue << ".Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
 
   if(m_instanceProfileNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceProfileName=" << StringUtils::URLEncode(m_instanceProfileName.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceProfileName=" << StringUtils::URLEncoded(m_instanceProfileName) << "&";
   }
 
   if(m_instanceProfileIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceProfileId=" << StringUtils::URLEncode(m_instanceProfileId.c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceProfileId=" << StringUtils::URLEncoded(m_instanceProfileId) << "&";
   }
 
   if(m_arnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
 
   if(m_createDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_rolesHasBeenSet)
@@ -135,9 +136,9 @@ void InstanceProfile::OutputToStream(Aws::OStream& oStream, const char* location
       unsigned rolesIdx = 1;
       for(auto& item : m_roles)
       {
-        Aws::StringStream rolesSs;
+        Aws::Utils::Stream::StringOutputStream rolesSs;
         rolesSs << location << index << locationValue << ".Roles.member." << rolesIdx++;
-        item.OutputToStream(oStream, rolesSs.str().c_str());
+        item.OutputToStream(oStream, rolesSs.GetString().c_str());
       }
   }
 
@@ -147,32 +148,32 @@ void InstanceProfile::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_pathHasBeenSet)
   {
-      oStream << location << ".Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+      oStream << location << ".Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
   if(m_instanceProfileNameHasBeenSet)
   {
-      oStream << location << ".InstanceProfileName=" << StringUtils::URLEncode(m_instanceProfileName.c_str()) << "&";
+      oStream << location << ".InstanceProfileName=" << StringUtils::URLEncoded(m_instanceProfileName) << "&";
   }
   if(m_instanceProfileIdHasBeenSet)
   {
-      oStream << location << ".InstanceProfileId=" << StringUtils::URLEncode(m_instanceProfileId.c_str()) << "&";
+      oStream << location << ".InstanceProfileId=" << StringUtils::URLEncoded(m_instanceProfileId) << "&";
   }
   if(m_arnHasBeenSet)
   {
-      oStream << location << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
   if(m_createDateHasBeenSet)
   {
-      oStream << location << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_rolesHasBeenSet)
   {
       unsigned rolesIdx = 1;
       for(auto& item : m_roles)
       {
-        Aws::StringStream rolesSs;
+        Aws::Utils::Stream::StringOutputStream rolesSs;
         rolesSs << location <<  ".Roles.member." << rolesIdx++;
-        item.OutputToStream(oStream, rolesSs.str().c_str());
+        item.OutputToStream(oStream, rolesSs.GetString().c_str());
       }
   }
 }
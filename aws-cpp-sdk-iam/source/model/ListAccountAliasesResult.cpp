@@ -42,7 +42,7 @@ ListAccountAliasesResult& ListAccountAliasesResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListAccountAliasesResult")
+  if (rootNode.GetNameView() != "ListAccountAliasesResult")
   {
     resultNode = rootNode.FirstChild("ListAccountAliasesResult");
   }
@@ -55,7 +55,7 @@ ListAccountAliasesResult& ListAccountAliasesResult::operator =(const AmazonWebSe
       XmlNode accountAliasesMember = accountAliasesNode.FirstChild("member");
       while(!accountAliasesMember.IsNull())
       {
-        m_accountAliases.push_back(StringUtils::Trim(accountAliasesMember.GetText().c_str()));
+        m_accountAliases.push_back(accountAliasesMember.GetTextView().Trim().ToString());
         accountAliasesMember = accountAliasesMember.NextNode("member");
       }
 
@@ -63,12 +63,12 @@ ListAccountAliasesResult& ListAccountAliasesResult::operator =(const AmazonWebSe
     XmlNode isTruncatedNode = resultNode.FirstChild("IsTruncated");
     if(!isTruncatedNode.IsNull())
     {
-      m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(isTruncatedNode.GetText().c_str()).c_str());
+      m_isTruncated = StringUtils::ConvertToBool(isTruncatedNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
   }
 
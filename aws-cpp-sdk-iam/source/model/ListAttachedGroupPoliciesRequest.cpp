@@ -15,6 +15,7 @@
 #include <aws/iam/model/ListAttachedGroupPoliciesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -30,21 +31,21 @@ ListAttachedGroupPoliciesRequest::ListAttachedGroupPoliciesRequest() :
 
 Aws::String ListAttachedGroupPoliciesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListAttachedGroupPolicies&";
   if(m_groupNameHasBeenSet)
   {
-    ss << "GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+    ss << "GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   if(m_pathPrefixHasBeenSet)
   {
-    ss << "PathPrefix=" << StringUtils::URLEncode(m_pathPrefix.c_str()) << "&";
+    ss << "PathPrefix=" << StringUtils::URLEncoded(m_pathPrefix) << "&";
   }
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_maxItemsHasBeenSet)
@@ -53,6 +54,6 @@ Aws::String ListAttachedGroupPoliciesRequest::SerializePayload() const
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/ListEntitiesForPolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -31,11 +32,11 @@ ListEntitiesForPolicyRequest::ListEntitiesForPolicyRequest() :
 
 Aws::String ListEntitiesForPolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListEntitiesForPolicy&";
   if(m_policyArnHasBeenSet)
   {
-    ss << "PolicyArn=" << StringUtils::URLEncode(m_policyArn.c_str()) << "&";
+    ss << "PolicyArn=" << StringUtils::URLEncoded(m_policyArn) << "&";
   }
 
   if(m_entityFilterHasBeenSet)
@@ -45,12 +46,12 @@ Aws::String ListEntitiesForPolicyRequest::SerializePayload() const
 
   if(m_pathPrefixHasBeenSet)
   {
-    ss << "PathPrefix=" << StringUtils::URLEncode(m_pathPrefix.c_str()) << "&";
+    ss << "PathPrefix=" << StringUtils::URLEncoded(m_pathPrefix) << "&";
   }
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_maxItemsHasBeenSet)
@@ -59,6 +60,6 @@ Aws::String ListEntitiesForPolicyRequest::SerializePayload() const
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ListOpenIDConnectProvidersResult& ListOpenIDConnectProvidersResult::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListOpenIDConnectProvidersResult")
+  if (rootNode.GetNameView() != "ListOpenIDConnectProvidersResult")
   {
     resultNode = rootNode.FirstChild("ListOpenIDConnectProvidersResult");
   }
@@ -42,7 +42,7 @@ ListRolePoliciesResult& ListRolePoliciesResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListRolePoliciesResult")
+  if (rootNode.GetNameView() != "ListRolePoliciesResult")
   {
     resultNode = rootNode.FirstChild("ListRolePoliciesResult");
   }
@@ -55,7 +55,7 @@ ListRolePoliciesResult& ListRolePoliciesResult::operator =(const AmazonWebServic
       XmlNode policyNamesMember = policyNamesNode.FirstChild("member");
       while(!policyNamesMember.IsNull())
       {
-        m_policyNames.push_back(StringUtils::Trim(policyNamesMember.GetText().c_str()));
+        m_policyNames.push_back(policyNamesMember.GetTextView().Trim().ToString());
         policyNamesMember = policyNamesMember.NextNode("member");
       }
 
@@ -63,12 +63,12 @@ ListRolePoliciesResult& ListRolePoliciesResult::operator =(const AmazonWebServic
     XmlNode isTruncatedNode = resultNode.FirstChild("IsTruncated");
     if(!isTruncatedNode.IsNull())
     {
-      m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(isTruncatedNode.GetText().c_str()).c_str());
+      m_isTruncated = StringUtils::ConvertToBool(isTruncatedNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ ListSAMLProvidersResult& ListSAMLProvidersResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListSAMLProvidersResult")
+  if (rootNode.GetNameView() != "ListSAMLProvidersResult")
   {
     resultNode = rootNode.FirstChild("ListSAMLProvidersResult");
   }
@@ -42,7 +42,7 @@ ListSigningCertificatesResult& ListSigningCertificatesResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListSigningCertificatesResult")
+  if (rootNode.GetNameView() != "ListSigningCertificatesResult")
   {
     resultNode = rootNode.FirstChild("ListSigningCertificatesResult");
   }
@@ -63,12 +63,12 @@ ListSigningCertificatesResult& ListSigningCertificatesResult::operator =(const A
     XmlNode isTruncatedNode = resultNode.FirstChild("IsTruncated");
     if(!isTruncatedNode.IsNull())
     {
-      m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(isTruncatedNode.GetText().c_str()).c_str());
+      m_isTruncated = StringUtils::ConvertToBool(isTruncatedNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/ListVirtualMFADevicesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ ListVirtualMFADevicesRequest::ListVirtualMFADevicesRequest() :
 
 Aws::String ListVirtualMFADevicesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListVirtualMFADevices&";
   if(m_assignmentStatusHasBeenSet)
   {
@@ -38,7 +39,7 @@ Aws::String ListVirtualMFADevicesRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_maxItemsHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String ListVirtualMFADevicesRequest::SerializePayload() const
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
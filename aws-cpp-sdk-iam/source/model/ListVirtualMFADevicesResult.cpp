@@ -42,7 +42,7 @@ ListVirtualMFADevicesResult& ListVirtualMFADevicesResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListVirtualMFADevicesResult")
+  if (rootNode.GetNameView() != "ListVirtualMFADevicesResult")
   {
     resultNode = rootNode.FirstChild("ListVirtualMFADevicesResult");
   }
@@ -63,12 +63,12 @@ ListVirtualMFADevicesResult& ListVirtualMFADevicesResult::operator =(const Amazo
     XmlNode isTruncatedNode = resultNode.FirstChild("IsTruncated");
     if(!isTruncatedNode.IsNull())
     {
-      m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(isTruncatedNode.GetText().c_str()).c_str());
+      m_isTruncated = StringUtils::ConvertToBool(isTruncatedNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -55,19 +55,19 @@ LoginProfile& LoginProfile::operator =(const XmlNode& xmlNode)
     XmlNode userNameNode = resultNode.FirstChild("UserName");
     if(!userNameNode.IsNull())
     {
-      m_userName = StringUtils::Trim(userNameNode.GetText().c_str());
+      m_userName = userNameNode.GetTextView().Trim().ToString();
       m_userNameHasBeenSet = true;
     }
     XmlNode createDateNode = resultNode.FirstChild("CreateDate");
     if(!createDateNode.IsNull())
     {
-      m_createDate = DateTime(StringUtils::Trim(createDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createDate = DateTime(createDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createDateHasBeenSet = true;
     }
     XmlNode passwordResetRequiredNode = resultNode.FirstChild("PasswordResetRequired");
     if(!passwordResetRequiredNode.IsNull())
     {
-      m_passwordResetRequired = StringUtils::ConvertToBool(StringUtils::Trim(passwordResetRequiredNode.GetText().c_str()).c_str());
+      m_passwordResetRequired = StringUtils::ConvertToBool(passwordResetRequiredNode.GetTextView().Trim().ToString().c_str());
       m_passwordResetRequiredHasBeenSet = true;
     }
   }
@@ -79,12 +79,12 @@ void LoginProfile::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_userNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_createDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_passwordResetRequiredHasBeenSet)
@@ -98,11 +98,11 @@ void LoginProfile::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_userNameHasBeenSet)
   {
-      oStream << location << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
   if(m_createDateHasBeenSet)
   {
-      oStream << location << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_passwordResetRequiredHasBeenSet)
   {
@@ -53,19 +53,19 @@ MFADevice& MFADevice::operator =(const XmlNode& xmlNode)
     XmlNode userNameNode = resultNode.FirstChild("UserName");
     if(!userNameNode.IsNull())
     {
-      m_userName = StringUtils::Trim(userNameNode.GetText().c_str());
+      m_userName = userNameNode.GetTextView().Trim().ToString();
       m_userNameHasBeenSet = true;
     }
     XmlNode serialNumberNode = resultNode.FirstChild("SerialNumber");
     if(!serialNumberNode.IsNull())
     {
-      m_serialNumber = StringUtils::Trim(serialNumberNode.GetText().c_str());
+      m_serialNumber = serialNumberNode.GetTextView().Trim().ToString();
       m_serialNumberHasBeenSet = true;
     }
     XmlNode enableDateNode = resultNode.FirstChild("EnableDate");
     if(!enableDateNode.IsNull())
     {
-      m_enableDate = DateTime(StringUtils::Trim(enableDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_enableDate = DateTime(enableDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_enableDateHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void MFADevice::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 {
   if(m_userNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_serialNumberHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SerialNumber=" << StringUtils::URLEncode(m_serialNumber.c_str()) << "&";
+      oStream << location << index << locationValue << ".SerialNumber=" << StringUtils::URLEncoded(m_serialNumber) << "&";
   }
 
   if(m_enableDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EnableDate=" << StringUtils::URLEncode(m_enableDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".EnableDate=" << StringUtils::URLEncoded(m_enableDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void MFADevice::OutputToStream(Aws::OStream& oStream, const char* location) cons
 {
   if(m_userNameHasBeenSet)
   {
-      oStream << location << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
   if(m_serialNumberHasBeenSet)
   {
-      oStream << location << ".SerialNumber=" << StringUtils::URLEncode(m_serialNumber.c_str()) << "&";
+      oStream << location << ".SerialNumber=" << StringUtils::URLEncoded(m_serialNumber) << "&";
   }
   if(m_enableDateHasBeenSet)
   {
-      oStream << location << ".EnableDate=" << StringUtils::URLEncode(m_enableDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".EnableDate=" << StringUtils::URLEncoded(m_enableDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -73,61 +74,61 @@ ManagedPolicyDetail& ManagedPolicyDetail::operator =(const XmlNode& xmlNode)
     XmlNode policyNameNode = resultNode.FirstChild("PolicyName");
     if(!policyNameNode.IsNull())
     {
-      m_policyName = StringUtils::Trim(policyNameNode.GetText().c_str());
+      m_policyName = policyNameNode.GetTextView().Trim().ToString();
       m_policyNameHasBeenSet = true;
     }
     XmlNode policyIdNode = resultNode.FirstChild("PolicyId");
     if(!policyIdNode.IsNull())
     {
-      m_policyId = StringUtils::Trim(policyIdNode.GetText().c_str());
+      m_policyId = policyIdNode.GetTextView().Trim().ToString();
       m_policyIdHasBeenSet = true;
     }
     XmlNode arnNode = resultNode.FirstChild("Arn");
     if(!arnNode.IsNull())
     {
-      m_arn = StringUtils::Trim(arnNode.GetText().c_str());
+      m_arn = arnNode.GetTextView().Trim().ToString();
       m_arnHasBeenSet = true;
     }
     XmlNode pathNode = resultNode.FirstChild("Path");
     if(!pathNode.IsNull())
     {
-      m_path = StringUtils::Trim(pathNode.GetText().c_str());
+      m_path = pathNode.GetTextView().Trim().ToString();
       m_pathHasBeenSet = true;
     }
     XmlNode defaultVersionIdNode = resultNode.FirstChild("DefaultVersionId");
     if(!defaultVersionIdNode.IsNull())
     {
-      m_defaultVersionId = StringUtils::Trim(defaultVersionIdNode.GetText().c_str());
+      m_defaultVersionId = defaultVersionIdNode.GetTextView().Trim().ToString();
       m_defaultVersionIdHasBeenSet = true;
     }
     XmlNode attachmentCountNode = resultNode.FirstChild("AttachmentCount");
     if(!attachmentCountNode.IsNull())
     {
-      m_attachmentCount = StringUtils::ConvertToInt32(StringUtils::Trim(attachmentCountNode.GetText().c_str()).c_str());
+      m_attachmentCount = StringUtils::ConvertToInt32(attachmentCountNode.GetTextView().Trim().ToString().c_str());
       m_attachmentCountHasBeenSet = true;
     }
     XmlNode isAttachableNode = resultNode.FirstChild("IsAttachable");
     if(!isAttachableNode.IsNull())
     {
-      m_isAttachable = StringUtils::ConvertToBool(StringUtils::Trim(isAttachableNode.GetText().c_str()).c_str());
+      m_isAttachable = StringUtils::ConvertToBool(isAttachableNode.GetTextView().Trim().ToString().c_str());
       m_isAttachableHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode createDateNode = resultNode.FirstChild("CreateDate");
     if(!createDateNode.IsNull())
     {
-      m_createDate = DateTime(StringUtils::Trim(createDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createDate = DateTime(createDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createDateHasBeenSet = true;
     }
     XmlNode updateDateNode = resultNode.FirstChild("UpdateDate");
     if(!updateDateNode.IsNull())
     {
-      m_updateDate = DateTime(StringUtils::Trim(updateDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_updateDate = DateTime(updateDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_updateDateHasBeenSet = true;
     }
     XmlNode policyVersionListNode = resultNode.FirstChild("PolicyVersionList");
@@ -151,27 +152,27 @@ void ManagedPolicyDetail::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_policyNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
 
   if(m_policyIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PolicyId=" << StringUtils::URLEncode(m_policyId.c_str()) << "&";
+      oStream << location << index << locationValue << ".PolicyId=" << StringUtils::URLEncoded(m_policyId) << "&";
   }
 
   if(m_arnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
 
   if(m_pathHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+      oStream << location << index << locationValue << ".Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
 
   if(m_defaultVersionIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DefaultVersionId=" << StringUtils::URLEncode(m_defaultVersionId.c_str()) << "&";
+      oStream << location << index << locationValue << ".DefaultVersionId=" << StringUtils::URLEncoded(m_defaultVersionId) << "&";
   }
 
   if(m_attachmentCountHasBeenSet)
@@ -186,17 +187,17 @@ void ManagedPolicyDetail::OutputToStream(Aws::OStream& oStream, const char* loca
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_createDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_updateDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UpdateDate=" << StringUtils::URLEncode(m_updateDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".UpdateDate=" << StringUtils::URLEncoded(m_updateDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_policyVersionListHasBeenSet)
@@ -204,9 +205,9 @@ void ManagedPolicyDetail::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned policyVersionListIdx = 1;
       for(auto& item : m_policyVersionList)
       {
-        Aws::StringStream policyVersionListSs;
+        Aws::Utils::Stream::StringOutputStream policyVersionListSs;
         policyVersionListSs << location << index << locationValue << ".PolicyVersionList.member." << policyVersionListIdx++;
-        item.OutputToStream(oStream, policyVersionListSs.str().c_str());
+        item.OutputToStream(oStream, policyVersionListSs.GetString().c_str());
       }
   }
 
@@ -216,23 +217,23 @@ void ManagedPolicyDetail::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_policyNameHasBeenSet)
   {
-      oStream << location << ".PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+      oStream << location << ".PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
   if(m_policyIdHasBeenSet)
   {
-      oStream << location << ".PolicyId=" << StringUtils::URLEncode(m_policyId.c_str()) << "&";
+      oStream << location << ".PolicyId=" << StringUtils::URLEncoded(m_policyId) << "&";
   }
   if(m_arnHasBeenSet)
   {
-      oStream << location << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
   if(m_pathHasBeenSet)
   {
-      oStream << location << ".Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+      oStream << location << ".Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
   if(m_defaultVersionIdHasBeenSet)
   {
-      oStream << location << ".DefaultVersionId=" << StringUtils::URLEncode(m_defaultVersionId.c_str()) << "&";
+      oStream << location << ".DefaultVersionId=" << StringUtils::URLEncoded(m_defaultVersionId) << "&";
   }
   if(m_attachmentCountHasBeenSet)
   {
@@ -244,24 +245,24 @@ void ManagedPolicyDetail::OutputToStream(Aws::OStream& oStream, const char* loca
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_createDateHasBeenSet)
   {
-      oStream << location << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_updateDateHasBeenSet)
   {
-      oStream << location << ".UpdateDate=" << StringUtils::URLEncode(m_updateDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".UpdateDate=" << StringUtils::URLEncoded(m_updateDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_policyVersionListHasBeenSet)
   {
       unsigned policyVersionListIdx = 1;
       for(auto& item : m_policyVersionList)
       {
-        Aws::StringStream policyVersionListSs;
+        Aws::Utils::Stream::StringOutputStream policyVersionListSs;
         policyVersionListSs << location <<  ".PolicyVersionList.member." << policyVersionListIdx++;
-        item.OutputToStream(oStream, policyVersionListSs.str().c_str());
+        item.OutputToStream(oStream, policyVersionListSs.GetString().c_str());
       }
   }
 }
@@ -49,7 +49,7 @@ OpenIDConnectProviderListEntry& OpenIDConnectProviderListEntry::operator =(const
     XmlNode arnNode = resultNode.FirstChild("Arn");
     if(!arnNode.IsNull())
     {
-      m_arn = StringUtils::Trim(arnNode.GetText().c_str());
+      m_arn = arnNode.GetTextView().Trim().ToString();
       m_arnHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void OpenIDConnectProviderListEntry::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_arnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void OpenIDConnectProviderListEntry::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_arnHasBeenSet)
   {
-      oStream << location << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
 }
 
@@ -51,13 +51,13 @@ PolicyDetail& PolicyDetail::operator =(const XmlNode& xmlNode)
     XmlNode policyNameNode = resultNode.FirstChild("PolicyName");
     if(!policyNameNode.IsNull())
     {
-      m_policyName = StringUtils::Trim(policyNameNode.GetText().c_str());
+      m_policyName = policyNameNode.GetTextView().Trim().ToString();
       m_policyNameHasBeenSet = true;
     }
     XmlNode policyDocumentNode = resultNode.FirstChild("PolicyDocument");
     if(!policyDocumentNode.IsNull())
     {
-      m_policyDocument = StringUtils::Trim(policyDocumentNode.GetText().c_str());
+      m_policyDocument = policyDocumentNode.GetTextView().Trim().ToString();
       m_policyDocumentHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void PolicyDetail::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_policyNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+      oStream << location << index << locationValue << ".PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
 
   if(m_policyDocumentHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PolicyDocument=" << StringUtils::URLEncode(m_policyDocument.c_str()) << "&";
+      oStream << location << index << locationValue << ".PolicyDocument=" << StringUtils::URLEncoded(m_policyDocument) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void PolicyDetail::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_policyNameHasBeenSet)
   {
-      oStream << location << ".PolicyName=" << StringUtils::URLEncode(m_policyName.c_str()) << "&";
+      oStream << location << ".PolicyName=" << StringUtils::URLEncoded(m_policyName) << "&";
   }
   if(m_policyDocumentHasBeenSet)
   {
-      oStream << location << ".PolicyDocument=" << StringUtils::URLEncode(m_policyDocument.c_str()) << "&";
+      oStream << location << ".PolicyDocument=" << StringUtils::URLEncoded(m_policyDocument) << "&";
   }
 }
 
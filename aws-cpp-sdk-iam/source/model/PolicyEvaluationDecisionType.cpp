@@ -29,26 +29,32 @@ namespace Aws
       namespace PolicyEvaluationDecisionTypeMapper
       {
 
-        static const int allowed_HASH = HashingUtils::HashString("allowed");
-        static const int explicitDeny_HASH = HashingUtils::HashString("explicitDeny");
-        static const int implicitDeny_HASH = HashingUtils::HashString("implicitDeny");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int allowed_HASH = -911343192;
+        static const int explicitDeny_HASH = 190750304;
+        static const int implicitDeny_HASH = -1001290351;
 
 
         PolicyEvaluationDecisionType GetPolicyEvaluationDecisionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == allowed_HASH)
+          switch (hashCode)
           {
+          case allowed_HASH:
             return PolicyEvaluationDecisionType::allowed;
-          }
-          else if (hashCode == explicitDeny_HASH)
-          {
+          case explicitDeny_HASH:
             return PolicyEvaluationDecisionType::explicitDeny;
-          }
-          else if (hashCode == implicitDeny_HASH)
-          {
+          case implicitDeny_HASH:
             return PolicyEvaluationDecisionType::implicitDeny;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
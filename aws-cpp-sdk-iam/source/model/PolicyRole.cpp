@@ -51,13 +51,13 @@ PolicyRole& PolicyRole::operator =(const XmlNode& xmlNode)
     XmlNode roleNameNode = resultNode.FirstChild("RoleName");
     if(!roleNameNode.IsNull())
     {
-      m_roleName = StringUtils::Trim(roleNameNode.GetText().c_str());
+      m_roleName = roleNameNode.GetTextView().Trim().ToString();
       m_roleNameHasBeenSet = true;
     }
     XmlNode roleIdNode = resultNode.FirstChild("RoleId");
     if(!roleIdNode.IsNull())
     {
-      m_roleId = StringUtils::Trim(roleIdNode.GetText().c_str());
+      m_roleId = roleIdNode.GetTextView().Trim().ToString();
       m_roleIdHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void PolicyRole::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_roleNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RoleName=" << StringUtils::URLEncode(m_roleName.c_str()) << "&";
+      oStream << location << index << locationValue << ".RoleName=" << StringUtils::URLEncoded(m_roleName) << "&";
   }
 
   if(m_roleIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RoleId=" << StringUtils::URLEncode(m_roleId.c_str()) << "&";
+      oStream << location << index << locationValue << ".RoleId=" << StringUtils::URLEncoded(m_roleId) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void PolicyRole::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_roleNameHasBeenSet)
   {
-      oStream << location << ".RoleName=" << StringUtils::URLEncode(m_roleName.c_str()) << "&";
+      oStream << location << ".RoleName=" << StringUtils::URLEncoded(m_roleName) << "&";
   }
   if(m_roleIdHasBeenSet)
   {
-      oStream << location << ".RoleId=" << StringUtils::URLEncode(m_roleId.c_str()) << "&";
+      oStream << location << ".RoleId=" << StringUtils::URLEncoded(m_roleId) << "&";
   }
 }
 
@@ -29,26 +29,32 @@ namespace Aws
       namespace PolicyScopeTypeMapper
       {
 
-        static const int All_HASH = HashingUtils::HashString("All");
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
-        static const int Local_HASH = HashingUtils::HashString("Local");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int All_HASH = 65921;
+        static const int AWS_HASH = 65245;
+        static const int Local_HASH = 73592651;
 
 
         PolicyScopeType GetPolicyScopeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == All_HASH)
+          switch (hashCode)
           {
+          case All_HASH:
             return PolicyScopeType::All;
-          }
-          else if (hashCode == AWS_HASH)
-          {
+          case AWS_HASH:
             return PolicyScopeType::AWS;
-          }
-          else if (hashCode == Local_HASH)
-          {
+          case Local_HASH:
             return PolicyScopeType::Local;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,46 +29,44 @@ namespace Aws
       namespace PolicySourceTypeMapper
       {
 
-        static const int user_HASH = HashingUtils::HashString("user");
-        static const int group_HASH = HashingUtils::HashString("group");
-        static const int role_HASH = HashingUtils::HashString("role");
-        static const int aws_managed_HASH = HashingUtils::HashString("aws-managed");
-        static const int user_managed_HASH = HashingUtils::HashString("user-managed");
-        static const int resource_HASH = HashingUtils::HashString("resource");
-        static const int none_HASH = HashingUtils::HashString("none");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int user_HASH = 3599307;
+        static const int group_HASH = 98629247;
+        static const int role_HASH = 3506294;
+        static const int aws_managed_HASH = 132587727;
+        static const int user_managed_HASH = 1119740829;
+        static const int resource_HASH = -341064690;
+        static const int none_HASH = 3387192;
 
 
         PolicySourceType GetPolicySourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == user_HASH)
+          switch (hashCode)
           {
+          case user_HASH:
             return PolicySourceType::user;
-          }
-          else if (hashCode == group_HASH)
-          {
+          case group_HASH:
             return PolicySourceType::group;
-          }
-          else if (hashCode == role_HASH)
-          {
+          case role_HASH:
             return PolicySourceType::role;
-          }
-          else if (hashCode == aws_managed_HASH)
-          {
+          case aws_managed_HASH:
             return PolicySourceType::aws_managed;
-          }
-          else if (hashCode == user_managed_HASH)
-          {
+          case user_managed_HASH:
             return PolicySourceType::user_managed;
-          }
-          else if (hashCode == resource_HASH)
-          {
+          case resource_HASH:
             return PolicySourceType::resource;
-          }
-          else if (hashCode == none_HASH)
-          {
+          case none_HASH:
             return PolicySourceType::none;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -51,13 +51,13 @@ PolicyUser& PolicyUser::operator =(const XmlNode& xmlNode)
     XmlNode userNameNode = resultNode.FirstChild("UserName");
     if(!userNameNode.IsNull())
     {
-      m_userName = StringUtils::Trim(userNameNode.GetText().c_str());
+      m_userName = userNameNode.GetTextView().Trim().ToString();
       m_userNameHasBeenSet = true;
     }
     XmlNode userIdNode = resultNode.FirstChild("UserId");
     if(!userIdNode.IsNull())
     {
-      m_userId = StringUtils::Trim(userIdNode.GetText().c_str());
+      m_userId = userIdNode.GetTextView().Trim().ToString();
       m_userIdHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void PolicyUser::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_userNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_userIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UserId=" << StringUtils::URLEncode(m_userId.c_str()) << "&";
+      oStream << location << index << locationValue << ".UserId=" << StringUtils::URLEncoded(m_userId) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void PolicyUser::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_userNameHasBeenSet)
   {
-      oStream << location << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
   if(m_userIdHasBeenSet)
   {
-      oStream << location << ".UserId=" << StringUtils::URLEncode(m_userId.c_str()) << "&";
+      oStream << location << ".UserId=" << StringUtils::URLEncoded(m_userId) << "&";
   }
 }
 
@@ -57,25 +57,25 @@ PolicyVersion& PolicyVersion::operator =(const XmlNode& xmlNode)
     XmlNode documentNode = resultNode.FirstChild("Document");
     if(!documentNode.IsNull())
     {
-      m_document = StringUtils::Trim(documentNode.GetText().c_str());
+      m_document = documentNode.GetTextView().Trim().ToString();
       m_documentHasBeenSet = true;
     }
     XmlNode versionIdNode = resultNode.FirstChild("VersionId");
     if(!versionIdNode.IsNull())
     {
-      m_versionId = StringUtils::Trim(versionIdNode.GetText().c_str());
+      m_versionId = versionIdNode.GetTextView().Trim().ToString();
       m_versionIdHasBeenSet = true;
     }
     XmlNode isDefaultVersionNode = resultNode.FirstChild("IsDefaultVersion");
     if(!isDefaultVersionNode.IsNull())
     {
-      m_isDefaultVersion = StringUtils::ConvertToBool(StringUtils::Trim(isDefaultVersionNode.GetText().c_str()).c_str());
+      m_isDefaultVersion = StringUtils::ConvertToBool(isDefaultVersionNode.GetTextView().Trim().ToString().c_str());
       m_isDefaultVersionHasBeenSet = true;
     }
     XmlNode createDateNode = resultNode.FirstChild("CreateDate");
     if(!createDateNode.IsNull())
     {
-      m_createDate = DateTime(StringUtils::Trim(createDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createDate = DateTime(createDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createDateHasBeenSet = true;
     }
   }
@@ -87,12 +87,12 @@ void PolicyVersion::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_documentHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Document=" << StringUtils::URLEncode(m_document.c_str()) << "&";
+      oStream << location << index << locationValue << ".Document=" << StringUtils::URLEncoded(m_document) << "&";
   }
 
   if(m_versionIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VersionId=" << StringUtils::URLEncode(m_versionId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VersionId=" << StringUtils::URLEncoded(m_versionId) << "&";
   }
 
   if(m_isDefaultVersionHasBeenSet)
@@ -102,7 +102,7 @@ void PolicyVersion::OutputToStream(Aws::OStream& oStream, const char* location,
 
   if(m_createDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -111,11 +111,11 @@ void PolicyVersion::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_documentHasBeenSet)
   {
-      oStream << location << ".Document=" << StringUtils::URLEncode(m_document.c_str()) << "&";
+      oStream << location << ".Document=" << StringUtils::URLEncoded(m_document) << "&";
   }
   if(m_versionIdHasBeenSet)
   {
-      oStream << location << ".VersionId=" << StringUtils::URLEncode(m_versionId.c_str()) << "&";
+      oStream << location << ".VersionId=" << StringUtils::URLEncoded(m_versionId) << "&";
   }
   if(m_isDefaultVersionHasBeenSet)
   {
@@ -123,7 +123,7 @@ void PolicyVersion::OutputToStream(Aws::OStream& oStream, const char* location)
   }
   if(m_createDateHasBeenSet)
   {
-      oStream << location << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
@@ -55,13 +55,13 @@ Position& Position::operator =(const XmlNode& xmlNode)
     XmlNode lineNode = resultNode.FirstChild("Line");
     if(!lineNode.IsNull())
     {
-      m_line = StringUtils::ConvertToInt32(StringUtils::Trim(lineNode.GetText().c_str()).c_str());
+      m_line = StringUtils::ConvertToInt32(lineNode.GetTextView().Trim().ToString().c_str());
       m_lineHasBeenSet = true;
     }
     XmlNode columnNode = resultNode.FirstChild("Column");
     if(!columnNode.IsNull())
     {
-      m_column = StringUtils::ConvertToInt32(StringUtils::Trim(columnNode.GetText().c_str()).c_str());
+      m_column = StringUtils::ConvertToInt32(columnNode.GetTextView().Trim().ToString().c_str());
       m_columnHasBeenSet = true;
     }
   }
@@ -29,16 +29,26 @@ namespace Aws
       namespace ReportFormatTypeMapper
       {
 
-        static const int text_csv_HASH = HashingUtils::HashString("text/csv");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int text_csv_HASH = -1004747228;
 
 
         ReportFormatType GetReportFormatTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == text_csv_HASH)
+          switch (hashCode)
           {
+          case text_csv_HASH:
             return ReportFormatType::text_csv;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
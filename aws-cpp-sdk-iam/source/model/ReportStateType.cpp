@@ -29,26 +29,32 @@ namespace Aws
       namespace ReportStateTypeMapper
       {
 
-        static const int STARTED_HASH = HashingUtils::HashString("STARTED");
-        static const int INPROGRESS_HASH = HashingUtils::HashString("INPROGRESS");
-        static const int COMPLETE_HASH = HashingUtils::HashString("COMPLETE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int STARTED_HASH = -1179202463;
+        static const int INPROGRESS_HASH = -926562734;
+        static const int COMPLETE_HASH = 183181625;
 
 
         ReportStateType GetReportStateTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STARTED_HASH)
+          switch (hashCode)
           {
+          case STARTED_HASH:
             return ReportStateType::STARTED;
-          }
-          else if (hashCode == INPROGRESS_HASH)
-          {
+          case INPROGRESS_HASH:
             return ReportStateType::INPROGRESS;
-          }
-          else if (hashCode == COMPLETE_HASH)
-          {
+          case COMPLETE_HASH:
             return ReportStateType::COMPLETE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
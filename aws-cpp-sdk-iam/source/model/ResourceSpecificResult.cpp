@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -57,13 +58,13 @@ ResourceSpecificResult& ResourceSpecificResult::operator =(const XmlNode& xmlNod
     XmlNode evalResourceNameNode = resultNode.FirstChild("EvalResourceName");
     if(!evalResourceNameNode.IsNull())
     {
-      m_evalResourceName = StringUtils::Trim(evalResourceNameNode.GetText().c_str());
+      m_evalResourceName = evalResourceNameNode.GetTextView().Trim().ToString();
       m_evalResourceNameHasBeenSet = true;
     }
     XmlNode evalResourceDecisionNode = resultNode.FirstChild("EvalResourceDecision");
     if(!evalResourceDecisionNode.IsNull())
     {
-      m_evalResourceDecision = PolicyEvaluationDecisionTypeMapper::GetPolicyEvaluationDecisionTypeForName(StringUtils::Trim(evalResourceDecisionNode.GetText().c_str()).c_str());
+      m_evalResourceDecision = PolicyEvaluationDecisionTypeMapper::GetPolicyEvaluationDecisionTypeForName(evalResourceDecisionNode.GetTextView().Trim().ToString().c_str());
       m_evalResourceDecisionHasBeenSet = true;
     }
     XmlNode matchedStatementsNode = resultNode.FirstChild("MatchedStatements");
@@ -84,7 +85,7 @@ ResourceSpecificResult& ResourceSpecificResult::operator =(const XmlNode& xmlNod
       XmlNode missingContextValuesMember = missingContextValuesNode.FirstChild("member");
       while(!missingContextValuesMember.IsNull())
       {
-        m_missingContextValues.push_back(StringUtils::Trim(missingContextValuesMember.GetText().c_str()));
+        m_missingContextValues.push_back(missingContextValuesMember.GetTextView().Trim().ToString());
         missingContextValuesMember = missingContextValuesMember.NextNode("member");
       }
 
@@ -99,8 +100,8 @@ ResourceSpecificResult& ResourceSpecificResult::operator =(const XmlNode& xmlNod
       {
         XmlNode keyNode = evalDecisionDetailsEntry.FirstChild("key");
         XmlNode valueNode = evalDecisionDetailsEntry.FirstChild("value");
-        m_evalDecisionDetails[StringUtils::Trim(keyNode.GetText().c_str())] =
-            PolicyEvaluationDecisionTypeMapper::GetPolicyEvaluationDecisionTypeForName(StringUtils::Trim(valueNode.GetText().c_str()));
+        m_evalDecisionDetails[keyNode.GetTextView().Trim().ToString()] =
+            PolicyEvaluationDecisionTypeMapper::GetPolicyEvaluationDecisionTypeForName(valueNode.GetTextView().Trim().ToString());
         evalDecisionDetailsEntry = evalDecisionDetailsEntry.NextNode("entry");
       }
 
@@ -115,7 +116,7 @@ void ResourceSpecificResult::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_evalResourceNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EvalResourceName=" << StringUtils::URLEncode(m_evalResourceName.c_str()) << "&";
+      oStream << location << index << locationValue << ".EvalResourceName=" << StringUtils::URLEncoded(m_evalResourceName) << "&";
   }
 
   if(m_evalResourceDecisionHasBeenSet)
@@ -128,9 +129,9 @@ void ResourceSpecificResult::OutputToStream(Aws::OStream& oStream, const char* l
       unsigned matchedStatementsIdx = 1;
       for(auto& item : m_matchedStatements)
       {
-        Aws::StringStream matchedStatementsSs;
+        Aws::Utils::Stream::StringOutputStream matchedStatementsSs;
         matchedStatementsSs << location << index << locationValue << ".MatchedStatements.member." << matchedStatementsIdx++;
-        item.OutputToStream(oStream, matchedStatementsSs.str().c_str());
+        item.OutputToStream(oStream, matchedStatementsSs.GetString().c_str());
       }
   }
 
@@ -139,7 +140,7 @@ void ResourceSpecificResult::OutputToStream(Aws::OStream& oStream, const char* l
       unsigned missingContextValuesIdx = 1;
       for(auto& item : m_missingContextValues)
       {
-        oStream << location << index << locationValue << ".MissingContextValues.member." << missingContextValuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".MissingContextValues.member." << missingContextValuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -149,9 +150,9 @@ void ResourceSpecificResult::OutputToStream(Aws::OStream& oStream, const char* l
       for(auto& item : m_evalDecisionDetails)
       {
         oStream << location << index << locationValue << ".EvalDecisionDetails.entry." << evalDecisionDetailsIdx << ".key="
-            << StringUtils::URLEncode(item.first.c_str()) << "&";
+            << StringUtils::URLEncoded(item.first) << "&";
         oStream << location << index << locationValue << ".EvalDecisionDetails.entry." << evalDecisionDetailsIdx << ".value="
-            << StringUtils::URLEncode(PolicyEvaluationDecisionTypeMapper::GetNameForPolicyEvaluationDecisionType(item.second).c_str()) << "&";
+            << StringUtils::URLEncoded(PolicyEvaluationDecisionTypeMapper::GetNameForPolicyEvaluationDecisionType(item.second)) << "&";
         evalDecisionDetailsIdx++;
       }
   }
@@ -162,7 +163,7 @@ void ResourceSpecificResult::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_evalResourceNameHasBeenSet)
   {
-      oStream << location << ".EvalResourceName=" << StringUtils::URLEncode(m_evalResourceName.c_str()) << "&";
+      oStream << location << ".EvalResourceName=" << StringUtils::URLEncoded(m_evalResourceName) << "&";
   }
   if(m_evalResourceDecisionHasBeenSet)
   {
@@ -173,9 +174,9 @@ void ResourceSpecificResult::OutputToStream(Aws::OStream& oStream, const char* l
       unsigned matchedStatementsIdx = 1;
       for(auto& item : m_matchedStatements)
       {
-        Aws::StringStream matchedStatementsSs;
+        Aws::Utils::Stream::StringOutputStream matchedStatementsSs;
         matchedStatementsSs << location <<  ".MatchedStatements.member." << matchedStatementsIdx++;
-        item.OutputToStream(oStream, matchedStatementsSs.str().c_str());
+        item.OutputToStream(oStream, matchedStatementsSs.GetString().c_str());
       }
   }
   if(m_missingContextValuesHasBeenSet)
@@ -183,7 +184,7 @@ void ResourceSpecificResult::OutputToStream(Aws::OStream& oStream, const char* l
       unsigned missingContextValuesIdx = 1;
       for(auto& item : m_missingContextValues)
       {
-        oStream << location << ".MissingContextValues.member." << missingContextValuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".MissingContextValues.member." << missingContextValuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_evalDecisionDetailsHasBeenSet)
@@ -192,9 +193,9 @@ void ResourceSpecificResult::OutputToStream(Aws::OStream& oStream, const char* l
       for(auto& item : m_evalDecisionDetails)
       {
         oStream << location << ".EvalDecisionDetails.entry."  << evalDecisionDetailsIdx << ".key="
-            << StringUtils::URLEncode(item.first.c_str()) << "&";
+            << StringUtils::URLEncoded(item.first) << "&";
         oStream << location <<  ".EvalDecisionDetails.entry." << evalDecisionDetailsIdx << ".value="
-            << StringUtils::URLEncode(PolicyEvaluationDecisionTypeMapper::GetNameForPolicyEvaluationDecisionType(item.second).c_str()) << "&";
+            << StringUtils::URLEncoded(PolicyEvaluationDecisionTypeMapper::GetNameForPolicyEvaluationDecisionType(item.second)) << "&";
         evalDecisionDetailsIdx++;
       }
 
@@ -49,7 +49,7 @@ ResponseMetadata& ResponseMetadata::operator =(const XmlNode& xmlNode)
     XmlNode requestIdNode = resultNode.FirstChild("RequestId");
     if(!requestIdNode.IsNull())
     {
-      m_requestId = StringUtils::Trim(requestIdNode.GetText().c_str());
+      m_requestId = requestIdNode.GetTextView().Trim().ToString();
       m_requestIdHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void ResponseMetadata::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_requestIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RequestId=" << StringUtils::URLEncode(m_requestId.c_str()) << "&";
+      oStream << location << index << locationValue << ".RequestId=" << StringUtils::URLEncoded(m_requestId) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void ResponseMetadata::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_requestIdHasBeenSet)
   {
-      oStream << location << ".RequestId=" << StringUtils::URLEncode(m_requestId.c_str()) << "&";
+      oStream << location << ".RequestId=" << StringUtils::URLEncoded(m_requestId) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -65,37 +66,37 @@ RoleDetail& RoleDetail::operator =(const XmlNode& xmlNode)
     XmlNode pathNode = resultNode.FirstChild("Path");
     if(!pathNode.IsNull())
     {
-      m_path = StringUtils::Trim(pathNode.GetText().c_str());
+      m_path = pathNode.GetTextView().Trim().ToString();
       m_pathHasBeenSet = true;
     }
     XmlNode roleNameNode = resultNode.FirstChild("RoleName");
     if(!roleNameNode.IsNull())
     {
-      m_roleName = StringUtils::Trim(roleNameNode.GetText().c_str());
+      m_roleName = roleNameNode.GetTextView().Trim().ToString();
       m_roleNameHasBeenSet = true;
     }
     XmlNode roleIdNode = resultNode.FirstChild("RoleId");
     if(!roleIdNode.IsNull())
     {
-      m_roleId = StringUtils::Trim(roleIdNode.GetText().c_str());
+      m_roleId = roleIdNode.GetTextView().Trim().ToString();
       m_roleIdHasBeenSet = true;
     }
     XmlNode arnNode = resultNode.FirstChild("Arn");
     if(!arnNode.IsNull())
     {
-      m_arn = StringUtils::Trim(arnNode.GetText().c_str());
+      m_arn = arnNode.GetTextView().Trim().ToString();
       m_arnHasBeenSet = true;
     }
     XmlNode createDateNode = resultNode.FirstChild("CreateDate");
     if(!createDateNode.IsNull())
     {
-      m_createDate = DateTime(StringUtils::Trim(createDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createDate = DateTime(createDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createDateHasBeenSet = true;
     }
     XmlNode assumeRolePolicyDocumentNode = resultNode.FirstChild("AssumeRolePolicyDocument");
     if(!assumeRolePolicyDocumentNode.IsNull())
     {
-      m_assumeRolePolicyDocument = StringUtils::Trim(assumeRolePolicyDocumentNode.GetText().c_str());
+      m_assumeRolePolicyDocument = assumeRolePolicyDocumentNode.GetTextView().Trim().ToString();
       m_assumeRolePolicyDocumentHasBeenSet = true;
     }
     XmlNode instanceProfileListNode = resultNode.FirstChild("InstanceProfileList");
@@ -143,32 +144,32 @@ void RoleDetail::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_pathHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+      oStream << location << index << locationValue << ".Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
 
   if(m_roleNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RoleName=" << StringUtils::URLEncode(m_roleName.c_str()) << "&";
+      oStream << location << index << locationValue << ".RoleName=" << StringUtils::URLEncoded(m_roleName) << "&";
   }
 
   if(m_roleIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RoleId=" << StringUtils::URLEncode(m_roleId.c_str()) << "&";
+      oStream << location << index << locationValue << ".RoleId=" << StringUtils::URLEncoded(m_roleId) << "&";
   }
 
   if(m_arnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
 
   if(m_createDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_assumeRolePolicyDocumentHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AssumeRolePolicyDocument=" << StringUtils::URLEncode(m_assumeRolePolicyDocument.c_str()) << "&";
+      oStream << location << index << locationValue << ".AssumeRolePolicyDocument=" << StringUtils::URLEncoded(m_assumeRolePolicyDocument) << "&";
   }
 
   if(m_instanceProfileListHasBeenSet)
@@ -176,9 +177,9 @@ void RoleDetail::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned instanceProfileListIdx = 1;
       for(auto& item : m_instanceProfileList)
       {
-        Aws::StringStream instanceProfileListSs;
+        Aws::Utils::Stream::StringOutputStream instanceProfileListSs;
         instanceProfileListSs << location << index << locationValue << ".InstanceProfileList.member." << instanceProfileListIdx++;
-        item.OutputToStream(oStream, instanceProfileListSs.str().c_str());
+        item.OutputToStream(oStream, instanceProfileListSs.GetString().c_str());
       }
   }
 
@@ -187,9 +188,9 @@ void RoleDetail::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned rolePolicyListIdx = 1;
       for(auto& item : m_rolePolicyList)
       {
-        Aws::StringStream rolePolicyListSs;
+        Aws::Utils::Stream::StringOutputStream rolePolicyListSs;
         rolePolicyListSs << location << index << locationValue << ".RolePolicyList.member." << rolePolicyListIdx++;
-        item.OutputToStream(oStream, rolePolicyListSs.str().c_str());
+        item.OutputToStream(oStream, rolePolicyListSs.GetString().c_str());
       }
   }
 
@@ -198,9 +199,9 @@ void RoleDetail::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned attachedManagedPoliciesIdx = 1;
       for(auto& item : m_attachedManagedPolicies)
       {
-        Aws::StringStream attachedManagedPoliciesSs;
+        Aws::Utils::Stream::StringOutputStream attachedManagedPoliciesSs;
         attachedManagedPoliciesSs << location << index << locationValue << ".AttachedManagedPolicies.member." << attachedManagedPoliciesIdx++;
-        item.OutputToStream(oStream, attachedManagedPoliciesSs.str().c_str());
+        item.OutputToStream(oStream, attachedManagedPoliciesSs.GetString().c_str());
       }
   }
 
@@ -210,36 +211,36 @@ void RoleDetail::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_pathHasBeenSet)
   {
-      oStream << location << ".Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+      oStream << location << ".Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
   if(m_roleNameHasBeenSet)
   {
-      oStream << location << ".RoleName=" << StringUtils::URLEncode(m_roleName.c_str()) << "&";
+      oStream << location << ".RoleName=" << StringUtils::URLEncoded(m_roleName) << "&";
   }
   if(m_roleIdHasBeenSet)
   {
-      oStream << location << ".RoleId=" << StringUtils::URLEncode(m_roleId.c_str()) << "&";
+      oStream << location << ".RoleId=" << StringUtils::URLEncoded(m_roleId) << "&";
   }
   if(m_arnHasBeenSet)
   {
-      oStream << location << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
   if(m_createDateHasBeenSet)
   {
-      oStream << location << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_assumeRolePolicyDocumentHasBeenSet)
   {
-      oStream << location << ".AssumeRolePolicyDocument=" << StringUtils::URLEncode(m_assumeRolePolicyDocument.c_str()) << "&";
+      oStream << location << ".AssumeRolePolicyDocument=" << StringUtils::URLEncoded(m_assumeRolePolicyDocument) << "&";
   }
   if(m_instanceProfileListHasBeenSet)
   {
       unsigned instanceProfileListIdx = 1;
       for(auto& item : m_instanceProfileList)
       {
-        Aws::StringStream instanceProfileListSs;
+        Aws::Utils::Stream::StringOutputStream instanceProfileListSs;
         instanceProfileListSs << location <<  ".InstanceProfileList.member." << instanceProfileListIdx++;
-        item.OutputToStream(oStream, instanceProfileListSs.str().c_str());
+        item.OutputToStream(oStream, instanceProfileListSs.GetString().c_str());
       }
   }
   if(m_rolePolicyListHasBeenSet)
@@ -247,9 +248,9 @@ void RoleDetail::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned rolePolicyListIdx = 1;
       for(auto& item : m_rolePolicyList)
       {
-        Aws::StringStream rolePolicyListSs;
+        Aws::Utils::Stream::StringOutputStream rolePolicyListSs;
         rolePolicyListSs << location <<  ".RolePolicyList.member." << rolePolicyListIdx++;
-        item.OutputToStream(oStream, rolePolicyListSs.str().c_str());
+        item.OutputToStream(oStream, rolePolicyListSs.GetString().c_str());
       }
   }
   if(m_attachedManagedPoliciesHasBeenSet)
@@ -257,9 +258,9 @@ void RoleDetail::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned attachedManagedPoliciesIdx = 1;
       for(auto& item : m_attachedManagedPolicies)
       {
-        Aws::StringStream attachedManagedPoliciesSs;
+        Aws::Utils::Stream::StringOutputStream attachedManagedPoliciesSs;
         attachedManagedPoliciesSs << location <<  ".AttachedManagedPolicies.member." << attachedManagedPoliciesIdx++;
-        item.OutputToStream(oStream, attachedManagedPoliciesSs.str().c_str());
+        item.OutputToStream(oStream, attachedManagedPoliciesSs.GetString().c_str());
       }
   }
 }
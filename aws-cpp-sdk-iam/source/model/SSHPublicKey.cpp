@@ -59,37 +59,37 @@ SSHPublicKey& SSHPublicKey::operator =(const XmlNode& xmlNode)
     XmlNode userNameNode = resultNode.FirstChild("UserName");
     if(!userNameNode.IsNull())
     {
-      m_userName = StringUtils::Trim(userNameNode.GetText().c_str());
+      m_userName = userNameNode.GetTextView().Trim().ToString();
       m_userNameHasBeenSet = true;
     }
     XmlNode sSHPublicKeyIdNode = resultNode.FirstChild("SSHPublicKeyId");
     if(!sSHPublicKeyIdNode.IsNull())
     {
-      m_sSHPublicKeyId = StringUtils::Trim(sSHPublicKeyIdNode.GetText().c_str());
+      m_sSHPublicKeyId = sSHPublicKeyIdNode.GetTextView().Trim().ToString();
       m_sSHPublicKeyIdHasBeenSet = true;
     }
     XmlNode fingerprintNode = resultNode.FirstChild("Fingerprint");
     if(!fingerprintNode.IsNull())
     {
-      m_fingerprint = StringUtils::Trim(fingerprintNode.GetText().c_str());
+      m_fingerprint = fingerprintNode.GetTextView().Trim().ToString();
       m_fingerprintHasBeenSet = true;
     }
     XmlNode sSHPublicKeyBodyNode = resultNode.FirstChild("SSHPublicKeyBody");
     if(!sSHPublicKeyBodyNode.IsNull())
     {
-      m_sSHPublicKeyBody = StringUtils::Trim(sSHPublicKeyBodyNode.GetText().c_str());
+      m_sSHPublicKeyBody = sSHPublicKeyBodyNode.GetTextView().Trim().ToString();
       m_sSHPublicKeyBodyHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StatusTypeMapper::GetStatusTypeForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = StatusTypeMapper::GetStatusTypeForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode uploadDateNode = resultNode.FirstChild("UploadDate");
     if(!uploadDateNode.IsNull())
     {
-      m_uploadDate = DateTime(StringUtils::Trim(uploadDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_uploadDate = DateTime(uploadDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_uploadDateHasBeenSet = true;
     }
   }
@@ -101,22 +101,22 @@ void SSHPublicKey::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_userNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_sSHPublicKeyIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SSHPublicKeyId=" << StringUtils::URLEncode(m_sSHPublicKeyId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SSHPublicKeyId=" << StringUtils::URLEncoded(m_sSHPublicKeyId) << "&";
   }
 
   if(m_fingerprintHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Fingerprint=" << StringUtils::URLEncode(m_fingerprint.c_str()) << "&";
+      oStream << location << index << locationValue << ".Fingerprint=" << StringUtils::URLEncoded(m_fingerprint) << "&";
   }
 
   if(m_sSHPublicKeyBodyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SSHPublicKeyBody=" << StringUtils::URLEncode(m_sSHPublicKeyBody.c_str()) << "&";
+      oStream << location << index << locationValue << ".SSHPublicKeyBody=" << StringUtils::URLEncoded(m_sSHPublicKeyBody) << "&";
   }
 
   if(m_statusHasBeenSet)
@@ -126,7 +126,7 @@ void SSHPublicKey::OutputToStream(Aws::OStream& oStream, const char* location, u
 
   if(m_uploadDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UploadDate=" << StringUtils::URLEncode(m_uploadDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".UploadDate=" << StringUtils::URLEncoded(m_uploadDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -135,19 +135,19 @@ void SSHPublicKey::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_userNameHasBeenSet)
   {
-      oStream << location << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
   if(m_sSHPublicKeyIdHasBeenSet)
   {
-      oStream << location << ".SSHPublicKeyId=" << StringUtils::URLEncode(m_sSHPublicKeyId.c_str()) << "&";
+      oStream << location << ".SSHPublicKeyId=" << StringUtils::URLEncoded(m_sSHPublicKeyId) << "&";
   }
   if(m_fingerprintHasBeenSet)
   {
-      oStream << location << ".Fingerprint=" << StringUtils::URLEncode(m_fingerprint.c_str()) << "&";
+      oStream << location << ".Fingerprint=" << StringUtils::URLEncoded(m_fingerprint) << "&";
   }
   if(m_sSHPublicKeyBodyHasBeenSet)
   {
-      oStream << location << ".SSHPublicKeyBody=" << StringUtils::URLEncode(m_sSHPublicKeyBody.c_str()) << "&";
+      oStream << location << ".SSHPublicKeyBody=" << StringUtils::URLEncoded(m_sSHPublicKeyBody) << "&";
   }
   if(m_statusHasBeenSet)
   {
@@ -155,7 +155,7 @@ void SSHPublicKey::OutputToStream(Aws::OStream& oStream, const char* location) c
   }
   if(m_uploadDateHasBeenSet)
   {
-      oStream << location << ".UploadDate=" << StringUtils::URLEncode(m_uploadDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".UploadDate=" << StringUtils::URLEncoded(m_uploadDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
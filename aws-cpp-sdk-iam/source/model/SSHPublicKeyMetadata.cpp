@@ -55,25 +55,25 @@ SSHPublicKeyMetadata& SSHPublicKeyMetadata::operator =(const XmlNode& xmlNode)
     XmlNode userNameNode = resultNode.FirstChild("UserName");
     if(!userNameNode.IsNull())
     {
-      m_userName = StringUtils::Trim(userNameNode.GetText().c_str());
+      m_userName = userNameNode.GetTextView().Trim().ToString();
       m_userNameHasBeenSet = true;
     }
     XmlNode sSHPublicKeyIdNode = resultNode.FirstChild("SSHPublicKeyId");
     if(!sSHPublicKeyIdNode.IsNull())
     {
-      m_sSHPublicKeyId = StringUtils::Trim(sSHPublicKeyIdNode.GetText().c_str());
+      m_sSHPublicKeyId = sSHPublicKeyIdNode.GetTextView().Trim().ToString();
       m_sSHPublicKeyIdHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StatusTypeMapper::GetStatusTypeForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = StatusTypeMapper::GetStatusTypeForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode uploadDateNode = resultNode.FirstChild("UploadDate");
     if(!uploadDateNode.IsNull())
     {
-      m_uploadDate = DateTime(StringUtils::Trim(uploadDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_uploadDate = DateTime(uploadDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_uploadDateHasBeenSet = true;
     }
   }
@@ -85,12 +85,12 @@ void SSHPublicKeyMetadata::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_userNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_sSHPublicKeyIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SSHPublicKeyId=" << StringUtils::URLEncode(m_sSHPublicKeyId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SSHPublicKeyId=" << StringUtils::URLEncoded(m_sSHPublicKeyId) << "&";
   }
 
   if(m_statusHasBeenSet)
@@ -100,7 +100,7 @@ void SSHPublicKeyMetadata::OutputToStream(Aws::OStream& oStream, const char* loc
 
   if(m_uploadDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UploadDate=" << StringUtils::URLEncode(m_uploadDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".UploadDate=" << StringUtils::URLEncoded(m_uploadDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -109,11 +109,11 @@ void SSHPublicKeyMetadata::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_userNameHasBeenSet)
   {
-      oStream << location << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
   if(m_sSHPublicKeyIdHasBeenSet)
   {
-      oStream << location << ".SSHPublicKeyId=" << StringUtils::URLEncode(m_sSHPublicKeyId.c_str()) << "&";
+      oStream << location << ".SSHPublicKeyId=" << StringUtils::URLEncoded(m_sSHPublicKeyId) << "&";
   }
   if(m_statusHasBeenSet)
   {
@@ -121,7 +121,7 @@ void SSHPublicKeyMetadata::OutputToStream(Aws::OStream& oStream, const char* loc
   }
   if(m_uploadDateHasBeenSet)
   {
-      oStream << location << ".UploadDate=" << StringUtils::URLEncode(m_uploadDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".UploadDate=" << StringUtils::URLEncoded(m_uploadDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
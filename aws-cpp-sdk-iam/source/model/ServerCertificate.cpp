@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,13 +60,13 @@ ServerCertificate& ServerCertificate::operator =(const XmlNode& xmlNode)
     XmlNode certificateBodyNode = resultNode.FirstChild("CertificateBody");
     if(!certificateBodyNode.IsNull())
     {
-      m_certificateBody = StringUtils::Trim(certificateBodyNode.GetText().c_str());
+      m_certificateBody = certificateBodyNode.GetTextView().Trim().ToString();
       m_certificateBodyHasBeenSet = true;
     }
     XmlNode certificateChainNode = resultNode.FirstChild("CertificateChain");
     if(!certificateChainNode.IsNull())
     {
-      m_certificateChain = StringUtils::Trim(certificateChainNode.GetText().c_str());
+      m_certificateChain = certificateChainNode.GetTextView().Trim().ToString();
       m_certificateChainHasBeenSet = true;
     }
   }
@@ -77,19 +78,19 @@ void ServerCertificate::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_serverCertificateMetadataHasBeenSet)
   {
-      Aws::StringStream serverCertificateMetadataLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream serverCertificateMetadataLocationAndMemberSs;
       serverCertificateMetadataLocationAndMemberSs << location << index << locationValue << ".ServerCertificateMetadata";
-      m_serverCertificateMetadata.OutputToStream(oStream, serverCertificateMetadataLocationAndMemberSs.str().c_str());
+      m_serverCertificateMetadata.OutputToStream(oStream, serverCertificateMetadataLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_certificateBodyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CertificateBody=" << StringUtils::URLEncode(m_certificateBody.c_str()) << "&";
+      oStream << location << index << locationValue << ".CertificateBody=" << StringUtils::URLEncoded(m_certificateBody) << "&";
   }
 
   if(m_certificateChainHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CertificateChain=" << StringUtils::URLEncode(m_certificateChain.c_str()) << "&";
+      oStream << location << index << locationValue << ".CertificateChain=" << StringUtils::URLEncoded(m_certificateChain) << "&";
   }
 
 }
@@ -104,11 +105,11 @@ void ServerCertificate::OutputToStream(Aws::OStream& oStream, const char* locati
   }
   if(m_certificateBodyHasBeenSet)
   {
-      oStream << location << ".CertificateBody=" << StringUtils::URLEncode(m_certificateBody.c_str()) << "&";
+      oStream << location << ".CertificateBody=" << StringUtils::URLEncoded(m_certificateBody) << "&";
   }
   if(m_certificateChainHasBeenSet)
   {
-      oStream << location << ".CertificateChain=" << StringUtils::URLEncode(m_certificateChain.c_str()) << "&";
+      oStream << location << ".CertificateChain=" << StringUtils::URLEncoded(m_certificateChain) << "&";
   }
 }
 
@@ -59,37 +59,37 @@ ServerCertificateMetadata& ServerCertificateMetadata::operator =(const XmlNode&
     XmlNode pathNode = resultNode.FirstChild("Path");
     if(!pathNode.IsNull())
     {
-      m_path = StringUtils::Trim(pathNode.GetText().c_str());
+      m_path = pathNode.GetTextView().Trim().ToString();
       m_pathHasBeenSet = true;
     }
     XmlNode serverCertificateNameNode = resultNode.FirstChild("ServerCertificateName");
     if(!serverCertificateNameNode.IsNull())
     {
-      m_serverCertificateName = StringUtils::Trim(serverCertificateNameNode.GetText().c_str());
+      m_serverCertificateName = serverCertificateNameNode.GetTextView().Trim().ToString();
       m_serverCertificateNameHasBeenSet = true;
     }
     XmlNode serverCertificateIdNode = resultNode.FirstChild("ServerCertificateId");
     if(!serverCertificateIdNode.IsNull())
     {
-      m_serverCertificateId = StringUtils::Trim(serverCertificateIdNode.GetText().c_str());
+      m_serverCertificateId = serverCertificateIdNode.GetTextView().Trim().ToString();
       m_serverCertificateIdHasBeenSet = true;
     }
     XmlNode arnNode = resultNode.FirstChild("Arn");
     if(!arnNode.IsNull())
     {
-      m_arn = StringUtils::Trim(arnNode.GetText().c_str());
+      m_arn = arnNode.GetTextView().Trim().ToString();
       m_arnHasBeenSet = true;
     }
     XmlNode uploadDateNode = resultNode.FirstChild("UploadDate");
     if(!uploadDateNode.IsNull())
     {
-      m_uploadDate = DateTime(StringUtils::Trim(uploadDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_uploadDate = DateTime(uploadDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_uploadDateHasBeenSet = true;
     }
     XmlNode expirationNode = resultNode.FirstChild("Expiration");
     if(!expirationNode.IsNull())
     {
-      m_expiration = DateTime(StringUtils::Trim(expirationNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_expiration = DateTime(expirationNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_expirationHasBeenSet = true;
     }
   }
@@ -101,32 +101,32 @@ void ServerCertificateMetadata::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_pathHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+      oStream << location << index << locationValue << ".Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
 
   if(m_serverCertificateNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ServerCertificateName=" << StringUtils::URLEncode(m_serverCertificateName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ServerCertificateName=" << StringUtils::URLEncoded(m_serverCertificateName) << "&";
   }
 
   if(m_serverCertificateIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ServerCertificateId=" << StringUtils::URLEncode(m_serverCertificateId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ServerCertificateId=" << StringUtils::URLEncoded(m_serverCertificateId) << "&";
   }
 
   if(m_arnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
 
   if(m_uploadDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UploadDate=" << StringUtils::URLEncode(m_uploadDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".UploadDate=" << StringUtils::URLEncoded(m_uploadDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_expirationHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Expiration=" << StringUtils::URLEncode(m_expiration.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".Expiration=" << StringUtils::URLEncoded(m_expiration.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -135,27 +135,27 @@ void ServerCertificateMetadata::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_pathHasBeenSet)
   {
-      oStream << location << ".Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+      oStream << location << ".Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
   if(m_serverCertificateNameHasBeenSet)
   {
-      oStream << location << ".ServerCertificateName=" << StringUtils::URLEncode(m_serverCertificateName.c_str()) << "&";
+      oStream << location << ".ServerCertificateName=" << StringUtils::URLEncoded(m_serverCertificateName) << "&";
   }
   if(m_serverCertificateIdHasBeenSet)
   {
-      oStream << location << ".ServerCertificateId=" << StringUtils::URLEncode(m_serverCertificateId.c_str()) << "&";
+      oStream << location << ".ServerCertificateId=" << StringUtils::URLEncoded(m_serverCertificateId) << "&";
   }
   if(m_arnHasBeenSet)
   {
-      oStream << location << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
   if(m_uploadDateHasBeenSet)
   {
-      oStream << location << ".UploadDate=" << StringUtils::URLEncode(m_uploadDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".UploadDate=" << StringUtils::URLEncoded(m_uploadDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_expirationHasBeenSet)
   {
-      oStream << location << ".Expiration=" << StringUtils::URLEncode(m_expiration.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".Expiration=" << StringUtils::URLEncoded(m_expiration.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
@@ -57,31 +57,31 @@ SigningCertificate& SigningCertificate::operator =(const XmlNode& xmlNode)
     XmlNode userNameNode = resultNode.FirstChild("UserName");
     if(!userNameNode.IsNull())
     {
-      m_userName = StringUtils::Trim(userNameNode.GetText().c_str());
+      m_userName = userNameNode.GetTextView().Trim().ToString();
       m_userNameHasBeenSet = true;
     }
     XmlNode certificateIdNode = resultNode.FirstChild("CertificateId");
     if(!certificateIdNode.IsNull())
     {
-      m_certificateId = StringUtils::Trim(certificateIdNode.GetText().c_str());
+      m_certificateId = certificateIdNode.GetTextView().Trim().ToString();
       m_certificateIdHasBeenSet = true;
     }
     XmlNode certificateBodyNode = resultNode.FirstChild("CertificateBody");
     if(!certificateBodyNode.IsNull())
     {
-      m_certificateBody = StringUtils::Trim(certificateBodyNode.GetText().c_str());
+      m_certificateBody = certificateBodyNode.GetTextView().Trim().ToString();
       m_certificateBodyHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StatusTypeMapper::GetStatusTypeForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = StatusTypeMapper::GetStatusTypeForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode uploadDateNode = resultNode.FirstChild("UploadDate");
     if(!uploadDateNode.IsNull())
     {
-      m_uploadDate = DateTime(StringUtils::Trim(uploadDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_uploadDate = DateTime(uploadDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_uploadDateHasBeenSet = true;
     }
   }
@@ -93,17 +93,17 @@ void SigningCertificate::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_userNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_certificateIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CertificateId=" << StringUtils::URLEncode(m_certificateId.c_str()) << "&";
+      oStream << location << index << locationValue << ".CertificateId=" << StringUtils::URLEncoded(m_certificateId) << "&";
   }
 
   if(m_certificateBodyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CertificateBody=" << StringUtils::URLEncode(m_certificateBody.c_str()) << "&";
+      oStream << location << index << locationValue << ".CertificateBody=" << StringUtils::URLEncoded(m_certificateBody) << "&";
   }
 
   if(m_statusHasBeenSet)
@@ -113,7 +113,7 @@ void SigningCertificate::OutputToStream(Aws::OStream& oStream, const char* locat
 
   if(m_uploadDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UploadDate=" << StringUtils::URLEncode(m_uploadDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".UploadDate=" << StringUtils::URLEncoded(m_uploadDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -122,15 +122,15 @@ void SigningCertificate::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_userNameHasBeenSet)
   {
-      oStream << location << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
   if(m_certificateIdHasBeenSet)
   {
-      oStream << location << ".CertificateId=" << StringUtils::URLEncode(m_certificateId.c_str()) << "&";
+      oStream << location << ".CertificateId=" << StringUtils::URLEncoded(m_certificateId) << "&";
   }
   if(m_certificateBodyHasBeenSet)
   {
-      oStream << location << ".CertificateBody=" << StringUtils::URLEncode(m_certificateBody.c_str()) << "&";
+      oStream << location << ".CertificateBody=" << StringUtils::URLEncoded(m_certificateBody) << "&";
   }
   if(m_statusHasBeenSet)
   {
@@ -138,7 +138,7 @@ void SigningCertificate::OutputToStream(Aws::OStream& oStream, const char* locat
   }
   if(m_uploadDateHasBeenSet)
   {
-      oStream << location << ".UploadDate=" << StringUtils::URLEncode(m_uploadDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".UploadDate=" << StringUtils::URLEncoded(m_uploadDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
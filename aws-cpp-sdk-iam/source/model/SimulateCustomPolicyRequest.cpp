@@ -15,6 +15,7 @@
 #include <aws/iam/model/SimulateCustomPolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -36,7 +37,7 @@ SimulateCustomPolicyRequest::SimulateCustomPolicyRequest() :
 
 Aws::String SimulateCustomPolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SimulateCustomPolicy&";
   if(m_policyInputListHasBeenSet)
   {
@@ -44,7 +45,7 @@ Aws::String SimulateCustomPolicyRequest::SerializePayload() const
     for(auto& item : m_policyInputList)
     {
       ss << "PolicyInputList.member." << policyInputListCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       policyInputListCount++;
     }
   }
@@ -55,7 +56,7 @@ Aws::String SimulateCustomPolicyRequest::SerializePayload() const
     for(auto& item : m_actionNames)
     {
       ss << "ActionNames.member." << actionNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       actionNamesCount++;
     }
   }
@@ -66,24 +67,24 @@ Aws::String SimulateCustomPolicyRequest::SerializePayload() const
     for(auto& item : m_resourceArns)
     {
       ss << "ResourceArns.member." << resourceArnsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       resourceArnsCount++;
     }
   }
 
   if(m_resourcePolicyHasBeenSet)
   {
-    ss << "ResourcePolicy=" << StringUtils::URLEncode(m_resourcePolicy.c_str()) << "&";
+    ss << "ResourcePolicy=" << StringUtils::URLEncoded(m_resourcePolicy) << "&";
   }
 
   if(m_resourceOwnerHasBeenSet)
   {
-    ss << "ResourceOwner=" << StringUtils::URLEncode(m_resourceOwner.c_str()) << "&";
+    ss << "ResourceOwner=" << StringUtils::URLEncoded(m_resourceOwner) << "&";
   }
 
   if(m_callerArnHasBeenSet)
   {
-    ss << "CallerArn=" << StringUtils::URLEncode(m_callerArn.c_str()) << "&";
+    ss << "CallerArn=" << StringUtils::URLEncoded(m_callerArn) << "&";
   }
 
   if(m_contextEntriesHasBeenSet)
@@ -98,7 +99,7 @@ Aws::String SimulateCustomPolicyRequest::SerializePayload() const
 
   if(m_resourceHandlingOptionHasBeenSet)
   {
-    ss << "ResourceHandlingOption=" << StringUtils::URLEncode(m_resourceHandlingOption.c_str()) << "&";
+    ss << "ResourceHandlingOption=" << StringUtils::URLEncoded(m_resourceHandlingOption) << "&";
   }
 
   if(m_maxItemsHasBeenSet)
@@ -108,10 +109,10 @@ Aws::String SimulateCustomPolicyRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/SimulatePrincipalPolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -37,11 +38,11 @@ SimulatePrincipalPolicyRequest::SimulatePrincipalPolicyRequest() :
 
 Aws::String SimulatePrincipalPolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SimulatePrincipalPolicy&";
   if(m_policySourceArnHasBeenSet)
   {
-    ss << "PolicySourceArn=" << StringUtils::URLEncode(m_policySourceArn.c_str()) << "&";
+    ss << "PolicySourceArn=" << StringUtils::URLEncoded(m_policySourceArn) << "&";
   }
 
   if(m_policyInputListHasBeenSet)
@@ -50,7 +51,7 @@ Aws::String SimulatePrincipalPolicyRequest::SerializePayload() const
     for(auto& item : m_policyInputList)
     {
       ss << "PolicyInputList.member." << policyInputListCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       policyInputListCount++;
     }
   }
@@ -61,7 +62,7 @@ Aws::String SimulatePrincipalPolicyRequest::SerializePayload() const
     for(auto& item : m_actionNames)
     {
       ss << "ActionNames.member." << actionNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       actionNamesCount++;
     }
   }
@@ -72,24 +73,24 @@ Aws::String SimulatePrincipalPolicyRequest::SerializePayload() const
     for(auto& item : m_resourceArns)
     {
       ss << "ResourceArns.member." << resourceArnsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       resourceArnsCount++;
     }
   }
 
   if(m_resourcePolicyHasBeenSet)
   {
-    ss << "ResourcePolicy=" << StringUtils::URLEncode(m_resourcePolicy.c_str()) << "&";
+    ss << "ResourcePolicy=" << StringUtils::URLEncoded(m_resourcePolicy) << "&";
   }
 
   if(m_resourceOwnerHasBeenSet)
   {
-    ss << "ResourceOwner=" << StringUtils::URLEncode(m_resourceOwner.c_str()) << "&";
+    ss << "ResourceOwner=" << StringUtils::URLEncoded(m_resourceOwner) << "&";
   }
 
   if(m_callerArnHasBeenSet)
   {
-    ss << "CallerArn=" << StringUtils::URLEncode(m_callerArn.c_str()) << "&";
+    ss << "CallerArn=" << StringUtils::URLEncoded(m_callerArn) << "&";
   }
 
   if(m_contextEntriesHasBeenSet)
@@ -104,7 +105,7 @@ Aws::String SimulatePrincipalPolicyRequest::SerializePayload() const
 
   if(m_resourceHandlingOptionHasBeenSet)
   {
-    ss << "ResourceHandlingOption=" << StringUtils::URLEncode(m_resourceHandlingOption.c_str()) << "&";
+    ss << "ResourceHandlingOption=" << StringUtils::URLEncoded(m_resourceHandlingOption) << "&";
   }
 
   if(m_maxItemsHasBeenSet)
@@ -114,10 +115,10 @@ Aws::String SimulatePrincipalPolicyRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
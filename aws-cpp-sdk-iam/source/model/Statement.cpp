@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -55,13 +56,13 @@ Statement& Statement::operator =(const XmlNode& xmlNode)
     XmlNode sourcePolicyIdNode = resultNode.FirstChild("SourcePolicyId");
     if(!sourcePolicyIdNode.IsNull())
     {
-      m_sourcePolicyId = StringUtils::Trim(sourcePolicyIdNode.GetText().c_str());
+      m_sourcePolicyId = sourcePolicyIdNode.GetTextView().Trim().ToString();
       m_sourcePolicyIdHasBeenSet = true;
     }
     XmlNode sourcePolicyTypeNode = resultNode.FirstChild("SourcePolicyType");
     if(!sourcePolicyTypeNode.IsNull())
     {
-      m_sourcePolicyType = PolicySourceTypeMapper::GetPolicySourceTypeForName(StringUtils::Trim(sourcePolicyTypeNode.GetText().c_str()).c_str());
+      m_sourcePolicyType = PolicySourceTypeMapper::GetPolicySourceTypeForName(sourcePolicyTypeNode.GetTextView().Trim().ToString().c_str());
       m_sourcePolicyTypeHasBeenSet = true;
     }
     XmlNode startPositionNode = resultNode.FirstChild("StartPosition");
@@ -85,7 +86,7 @@ void Statement::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 {
   if(m_sourcePolicyIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourcePolicyId=" << StringUtils::URLEncode(m_sourcePolicyId.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourcePolicyId=" << StringUtils::URLEncoded(m_sourcePolicyId) << "&";
   }
 
   if(m_sourcePolicyTypeHasBeenSet)
@@ -95,16 +96,16 @@ void Statement::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 
   if(m_startPositionHasBeenSet)
   {
-      Aws::StringStream startPositionLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream startPositionLocationAndMemberSs;
       startPositionLocationAndMemberSs << location << index << locationValue << ".StartPosition";
-      m_startPosition.OutputToStream(oStream, startPositionLocationAndMemberSs.str().c_str());
+      m_startPosition.OutputToStream(oStream, startPositionLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_endPositionHasBeenSet)
   {
-      Aws::StringStream endPositionLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream endPositionLocationAndMemberSs;
       endPositionLocationAndMemberSs << location << index << locationValue << ".EndPosition";
-      m_endPosition.OutputToStream(oStream, endPositionLocationAndMemberSs.str().c_str());
+      m_endPosition.OutputToStream(oStream, endPositionLocationAndMemberSs.GetString().c_str());
   }
 
 }
@@ -113,7 +114,7 @@ void Statement::OutputToStream(Aws::OStream& oStream, const char* location) cons
 {
   if(m_sourcePolicyIdHasBeenSet)
   {
-      oStream << location << ".SourcePolicyId=" << StringUtils::URLEncode(m_sourcePolicyId.c_str()) << "&";
+      oStream << location << ".SourcePolicyId=" << StringUtils::URLEncoded(m_sourcePolicyId) << "&";
   }
   if(m_sourcePolicyTypeHasBeenSet)
   {
@@ -29,136 +29,98 @@ namespace Aws
       namespace SummaryKeyTypeMapper
       {
 
-        static const int Users_HASH = HashingUtils::HashString("Users");
-        static const int UsersQuota_HASH = HashingUtils::HashString("UsersQuota");
-        static const int Groups_HASH = HashingUtils::HashString("Groups");
-        static const int GroupsQuota_HASH = HashingUtils::HashString("GroupsQuota");
-        static const int ServerCertificates_HASH = HashingUtils::HashString("ServerCertificates");
-        static const int ServerCertificatesQuota_HASH = HashingUtils::HashString("ServerCertificatesQuota");
-        static const int UserPolicySizeQuota_HASH = HashingUtils::HashString("UserPolicySizeQuota");
-        static const int GroupPolicySizeQuota_HASH = HashingUtils::HashString("GroupPolicySizeQuota");
-        static const int GroupsPerUserQuota_HASH = HashingUtils::HashString("GroupsPerUserQuota");
-        static const int SigningCertificatesPerUserQuota_HASH = HashingUtils::HashString("SigningCertificatesPerUserQuota");
-        static const int AccessKeysPerUserQuota_HASH = HashingUtils::HashString("AccessKeysPerUserQuota");
-        static const int MFADevices_HASH = HashingUtils::HashString("MFADevices");
-        static const int MFADevicesInUse_HASH = HashingUtils::HashString("MFADevicesInUse");
-        static const int AccountMFAEnabled_HASH = HashingUtils::HashString("AccountMFAEnabled");
-        static const int AccountAccessKeysPresent_HASH = HashingUtils::HashString("AccountAccessKeysPresent");
-        static const int AccountSigningCertificatesPresent_HASH = HashingUtils::HashString("AccountSigningCertificatesPresent");
-        static const int AttachedPoliciesPerGroupQuota_HASH = HashingUtils::HashString("AttachedPoliciesPerGroupQuota");
-        static const int AttachedPoliciesPerRoleQuota_HASH = HashingUtils::HashString("AttachedPoliciesPerRoleQuota");
-        static const int AttachedPoliciesPerUserQuota_HASH = HashingUtils::HashString("AttachedPoliciesPerUserQuota");
-        static const int Policies_HASH = HashingUtils::HashString("Policies");
-        static const int PoliciesQuota_HASH = HashingUtils::HashString("PoliciesQuota");
-        static const int PolicySizeQuota_HASH = HashingUtils::HashString("PolicySizeQuota");
-        static const int PolicyVersionsInUse_HASH = HashingUtils::HashString("PolicyVersionsInUse");
-        static const int PolicyVersionsInUseQuota_HASH = HashingUtils::HashString("PolicyVersionsInUseQuota");
-        static const int VersionsPerPolicyQuota_HASH = HashingUtils::HashString("VersionsPerPolicyQuota");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Users_HASH = 82025960;
+        static const int UsersQuota_HASH = 174530928;
+        static const int Groups_HASH = 2141373940;
+        static const int GroupsQuota_HASH = -983883548;
+        static const int ServerCertificates_HASH = -527014721;
+        static const int ServerCertificatesQuota_HASH = -60684039;
+        static const int UserPolicySizeQuota_HASH = 1197776506;
+        static const int GroupPolicySizeQuota_HASH = 113688966;
+        static const int GroupsPerUserQuota_HASH = -1092471580;
+        static const int SigningCertificatesPerUserQuota_HASH = 710743729;
+        static const int AccessKeysPerUserQuota_HASH = 840628872;
+        static const int MFADevices_HASH = 623577589;
+        static const int MFADevicesInUse_HASH = 1604184365;
+        static const int AccountMFAEnabled_HASH = -1784111578;
+        static const int AccountAccessKeysPresent_HASH = -1288942186;
+        static const int AccountSigningCertificatesPresent_HASH = -229614073;
+        static const int AttachedPoliciesPerGroupQuota_HASH = -1627919006;
+        static const int AttachedPoliciesPerRoleQuota_HASH = 91119705;
+        static const int AttachedPoliciesPerUserQuota_HASH = 94618148;
+        static const int Policies_HASH = 611538288;
+        static const int PoliciesQuota_HASH = 2066013928;
+        static const int PolicySizeQuota_HASH = 1783640517;
+        static const int PolicyVersionsInUse_HASH = 548552725;
+        static const int PolicyVersionsInUseQuota_HASH = -583543965;
+        static const int VersionsPerPolicyQuota_HASH = -1770916188;
 
 
         SummaryKeyType GetSummaryKeyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Users_HASH)
+          switch (hashCode)
           {
+          case Users_HASH:
             return SummaryKeyType::Users;
-          }
-          else if (hashCode == UsersQuota_HASH)
-          {
+          case UsersQuota_HASH:
             return SummaryKeyType::UsersQuota;
-          }
-          else if (hashCode == Groups_HASH)
-          {
+          case Groups_HASH:
             return SummaryKeyType::Groups;
-          }
-          else if (hashCode == GroupsQuota_HASH)
-          {
+          case GroupsQuota_HASH:
             return SummaryKeyType::GroupsQuota;
-          }
-          else if (hashCode == ServerCertificates_HASH)
-          {
+          case ServerCertificates_HASH:
             return SummaryKeyType::ServerCertificates;
-          }
-          else if (hashCode == ServerCertificatesQuota_HASH)
-          {
+          case ServerCertificatesQuota_HASH:
             return SummaryKeyType::ServerCertificatesQuota;
-          }
-          else if (hashCode == UserPolicySizeQuota_HASH)
-          {
+          case UserPolicySizeQuota_HASH:
             return SummaryKeyType::UserPolicySizeQuota;
-          }
-          else if (hashCode == GroupPolicySizeQuota_HASH)
-          {
+          case GroupPolicySizeQuota_HASH:
             return SummaryKeyType::GroupPolicySizeQuota;
-          }
-          else if (hashCode == GroupsPerUserQuota_HASH)
-          {
+          case GroupsPerUserQuota_HASH:
             return SummaryKeyType::GroupsPerUserQuota;
-          }
-          else if (hashCode == SigningCertificatesPerUserQuota_HASH)
-          {
+          case SigningCertificatesPerUserQuota_HASH:
             return SummaryKeyType::SigningCertificatesPerUserQuota;
-          }
-          else if (hashCode == AccessKeysPerUserQuota_HASH)
-          {
+          case AccessKeysPerUserQuota_HASH:
             return SummaryKeyType::AccessKeysPerUserQuota;
-          }
-          else if (hashCode == MFADevices_HASH)
-          {
+          case MFADevices_HASH:
             return SummaryKeyType::MFADevices;
-          }
-          else if (hashCode == MFADevicesInUse_HASH)
-          {
+          case MFADevicesInUse_HASH:
             return SummaryKeyType::MFADevicesInUse;
-          }
-          else if (hashCode == AccountMFAEnabled_HASH)
-          {
+          case AccountMFAEnabled_HASH:
             return SummaryKeyType::AccountMFAEnabled;
-          }
-          else if (hashCode == AccountAccessKeysPresent_HASH)
-          {
+          case AccountAccessKeysPresent_HASH:
             return SummaryKeyType::AccountAccessKeysPresent;
-          }
-          else if (hashCode == AccountSigningCertificatesPresent_HASH)
-          {
+          case AccountSigningCertificatesPresent_HASH:
             return SummaryKeyType::AccountSigningCertificatesPresent;
-          }
-          else if (hashCode == AttachedPoliciesPerGroupQuota_HASH)
-          {
+          case AttachedPoliciesPerGroupQuota_HASH:
             return SummaryKeyType::AttachedPoliciesPerGroupQuota;
-          }
-          else if (hashCode == AttachedPoliciesPerRoleQuota_HASH)
-          {
+          case AttachedPoliciesPerRoleQuota_HASH:
             return SummaryKeyType::AttachedPoliciesPerRoleQuota;
-          }
-          else if (hashCode == AttachedPoliciesPerUserQuota_HASH)
-          {
+          case AttachedPoliciesPerUserQuota_HASH:
             return SummaryKeyType::AttachedPoliciesPerUserQuota;
-          }
-          else if (hashCode == Policies_HASH)
-          {
+          case Policies_HASH:
             return SummaryKeyType::Policies;
-          }
-          else if (hashCode == PoliciesQuota_HASH)
-          {
+          case PoliciesQuota_HASH:
             return SummaryKeyType::PoliciesQuota;
-          }
-          else if (hashCode == PolicySizeQuota_HASH)
-          {
+          case PolicySizeQuota_HASH:
             return SummaryKeyType::PolicySizeQuota;
-          }
-          else if (hashCode == PolicyVersionsInUse_HASH)
-          {
+          case PolicyVersionsInUse_HASH:
             return SummaryKeyType::PolicyVersionsInUse;
-          }
-          else if (hashCode == PolicyVersionsInUseQuota_HASH)
-          {
+          case PolicyVersionsInUseQuota_HASH:
             return SummaryKeyType::PolicyVersionsInUseQuota;
-          }
-          else if (hashCode == VersionsPerPolicyQuota_HASH)
-          {
+          case VersionsPerPolicyQuota_HASH:
             return SummaryKeyType::VersionsPerPolicyQuota;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
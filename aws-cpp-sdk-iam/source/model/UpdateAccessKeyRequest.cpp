@@ -15,6 +15,7 @@
 #include <aws/iam/model/UpdateAccessKeyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ UpdateAccessKeyRequest::UpdateAccessKeyRequest() :
 
 Aws::String UpdateAccessKeyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UpdateAccessKey&";
   if(m_userNameHasBeenSet)
   {
-    ss << "UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+    ss << "UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_accessKeyIdHasBeenSet)
   {
-    ss << "AccessKeyId=" << StringUtils::URLEncode(m_accessKeyId.c_str()) << "&";
+    ss << "AccessKeyId=" << StringUtils::URLEncoded(m_accessKeyId) << "&";
   }
 
   if(m_statusHasBeenSet)
@@ -46,6 +47,6 @@ Aws::String UpdateAccessKeyRequest::SerializePayload() const
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/UpdateAccountPasswordPolicyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -43,7 +44,7 @@ UpdateAccountPasswordPolicyRequest::UpdateAccountPasswordPolicyRequest() :
 
 Aws::String UpdateAccountPasswordPolicyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UpdateAccountPasswordPolicy&";
   if(m_minimumPasswordLengthHasBeenSet)
   {
@@ -91,6 +92,6 @@ Aws::String UpdateAccountPasswordPolicyRequest::SerializePayload() const
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/UpdateGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ UpdateGroupRequest::UpdateGroupRequest() :
 
 Aws::String UpdateGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UpdateGroup&";
   if(m_groupNameHasBeenSet)
   {
-    ss << "GroupName=" << StringUtils::URLEncode(m_groupName.c_str()) << "&";
+    ss << "GroupName=" << StringUtils::URLEncoded(m_groupName) << "&";
   }
 
   if(m_newPathHasBeenSet)
   {
-    ss << "NewPath=" << StringUtils::URLEncode(m_newPath.c_str()) << "&";
+    ss << "NewPath=" << StringUtils::URLEncoded(m_newPath) << "&";
   }
 
   if(m_newGroupNameHasBeenSet)
   {
-    ss << "NewGroupName=" << StringUtils::URLEncode(m_newGroupName.c_str()) << "&";
+    ss << "NewGroupName=" << StringUtils::URLEncoded(m_newGroupName) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/UpdateLoginProfileRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ UpdateLoginProfileRequest::UpdateLoginProfileRequest() :
 
 Aws::String UpdateLoginProfileRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UpdateLoginProfile&";
   if(m_userNameHasBeenSet)
   {
-    ss << "UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+    ss << "UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_passwordHasBeenSet)
   {
-    ss << "Password=" << StringUtils::URLEncode(m_password.c_str()) << "&";
+    ss << "Password=" << StringUtils::URLEncoded(m_password) << "&";
   }
 
   if(m_passwordResetRequiredHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String UpdateLoginProfileRequest::SerializePayload() const
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
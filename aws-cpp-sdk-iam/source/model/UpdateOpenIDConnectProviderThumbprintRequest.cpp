@@ -15,6 +15,7 @@
 #include <aws/iam/model/UpdateOpenIDConnectProviderThumbprintRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ UpdateOpenIDConnectProviderThumbprintRequest::UpdateOpenIDConnectProviderThumbpr
 
 Aws::String UpdateOpenIDConnectProviderThumbprintRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UpdateOpenIDConnectProviderThumbprint&";
   if(m_openIDConnectProviderArnHasBeenSet)
   {
-    ss << "OpenIDConnectProviderArn=" << StringUtils::URLEncode(m_openIDConnectProviderArn.c_str()) << "&";
+    ss << "OpenIDConnectProviderArn=" << StringUtils::URLEncoded(m_openIDConnectProviderArn) << "&";
   }
 
   if(m_thumbprintListHasBeenSet)
@@ -40,12 +41,12 @@ Aws::String UpdateOpenIDConnectProviderThumbprintRequest::SerializePayload() con
     for(auto& item : m_thumbprintList)
     {
       ss << "ThumbprintList.member." << thumbprintListCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       thumbprintListCount++;
     }
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/UpdateSAMLProviderRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ UpdateSAMLProviderRequest::UpdateSAMLProviderRequest() :
 
 Aws::String UpdateSAMLProviderRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UpdateSAMLProvider&";
   if(m_sAMLMetadataDocumentHasBeenSet)
   {
-    ss << "SAMLMetadataDocument=" << StringUtils::URLEncode(m_sAMLMetadataDocument.c_str()) << "&";
+    ss << "SAMLMetadataDocument=" << StringUtils::URLEncoded(m_sAMLMetadataDocument) << "&";
   }
 
   if(m_sAMLProviderArnHasBeenSet)
   {
-    ss << "SAMLProviderArn=" << StringUtils::URLEncode(m_sAMLProviderArn.c_str()) << "&";
+    ss << "SAMLProviderArn=" << StringUtils::URLEncoded(m_sAMLProviderArn) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
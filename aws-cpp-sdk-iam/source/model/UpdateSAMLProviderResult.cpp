@@ -40,7 +40,7 @@ UpdateSAMLProviderResult& UpdateSAMLProviderResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "UpdateSAMLProviderResult")
+  if (rootNode.GetNameView() != "UpdateSAMLProviderResult")
   {
     resultNode = rootNode.FirstChild("UpdateSAMLProviderResult");
   }
@@ -50,7 +50,7 @@ UpdateSAMLProviderResult& UpdateSAMLProviderResult::operator =(const AmazonWebSe
     XmlNode sAMLProviderArnNode = resultNode.FirstChild("SAMLProviderArn");
     if(!sAMLProviderArnNode.IsNull())
     {
-      m_sAMLProviderArn = StringUtils::Trim(sAMLProviderArnNode.GetText().c_str());
+      m_sAMLProviderArn = sAMLProviderArnNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/UpdateSSHPublicKeyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ UpdateSSHPublicKeyRequest::UpdateSSHPublicKeyRequest() :
 
 Aws::String UpdateSSHPublicKeyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UpdateSSHPublicKey&";
   if(m_userNameHasBeenSet)
   {
-    ss << "UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+    ss << "UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_sSHPublicKeyIdHasBeenSet)
   {
-    ss << "SSHPublicKeyId=" << StringUtils::URLEncode(m_sSHPublicKeyId.c_str()) << "&";
+    ss << "SSHPublicKeyId=" << StringUtils::URLEncoded(m_sSHPublicKeyId) << "&";
   }
 
   if(m_statusHasBeenSet)
@@ -46,6 +47,6 @@ Aws::String UpdateSSHPublicKeyRequest::SerializePayload() const
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
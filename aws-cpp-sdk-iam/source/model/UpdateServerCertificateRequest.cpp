@@ -15,6 +15,7 @@
 #include <aws/iam/model/UpdateServerCertificateRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ UpdateServerCertificateRequest::UpdateServerCertificateRequest() :
 
 Aws::String UpdateServerCertificateRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UpdateServerCertificate&";
   if(m_serverCertificateNameHasBeenSet)
   {
-    ss << "ServerCertificateName=" << StringUtils::URLEncode(m_serverCertificateName.c_str()) << "&";
+    ss << "ServerCertificateName=" << StringUtils::URLEncoded(m_serverCertificateName) << "&";
   }
 
   if(m_newPathHasBeenSet)
   {
-    ss << "NewPath=" << StringUtils::URLEncode(m_newPath.c_str()) << "&";
+    ss << "NewPath=" << StringUtils::URLEncoded(m_newPath) << "&";
   }
 
   if(m_newServerCertificateNameHasBeenSet)
   {
-    ss << "NewServerCertificateName=" << StringUtils::URLEncode(m_newServerCertificateName.c_str()) << "&";
+    ss << "NewServerCertificateName=" << StringUtils::URLEncoded(m_newServerCertificateName) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/iam/model/UpdateUserRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ UpdateUserRequest::UpdateUserRequest() :
 
 Aws::String UpdateUserRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UpdateUser&";
   if(m_userNameHasBeenSet)
   {
-    ss << "UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+    ss << "UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_newPathHasBeenSet)
   {
-    ss << "NewPath=" << StringUtils::URLEncode(m_newPath.c_str()) << "&";
+    ss << "NewPath=" << StringUtils::URLEncoded(m_newPath) << "&";
   }
 
   if(m_newUserNameHasBeenSet)
   {
-    ss << "NewUserName=" << StringUtils::URLEncode(m_newUserName.c_str()) << "&";
+    ss << "NewUserName=" << StringUtils::URLEncoded(m_newUserName) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ UploadSSHPublicKeyResult& UploadSSHPublicKeyResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "UploadSSHPublicKeyResult")
+  if (rootNode.GetNameView() != "UploadSSHPublicKeyResult")
   {
     resultNode = rootNode.FirstChild("UploadSSHPublicKeyResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/iam/model/UploadServerCertificateRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -30,34 +31,34 @@ UploadServerCertificateRequest::UploadServerCertificateRequest() :
 
 Aws::String UploadServerCertificateRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UploadServerCertificate&";
   if(m_pathHasBeenSet)
   {
-    ss << "Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+    ss << "Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
 
   if(m_serverCertificateNameHasBeenSet)
   {
-    ss << "ServerCertificateName=" << StringUtils::URLEncode(m_serverCertificateName.c_str()) << "&";
+    ss << "ServerCertificateName=" << StringUtils::URLEncoded(m_serverCertificateName) << "&";
   }
 
   if(m_certificateBodyHasBeenSet)
   {
-    ss << "CertificateBody=" << StringUtils::URLEncode(m_certificateBody.c_str()) << "&";
+    ss << "CertificateBody=" << StringUtils::URLEncoded(m_certificateBody) << "&";
   }
 
   if(m_privateKeyHasBeenSet)
   {
-    ss << "PrivateKey=" << StringUtils::URLEncode(m_privateKey.c_str()) << "&";
+    ss << "PrivateKey=" << StringUtils::URLEncoded(m_privateKey) << "&";
   }
 
   if(m_certificateChainHasBeenSet)
   {
-    ss << "CertificateChain=" << StringUtils::URLEncode(m_certificateChain.c_str()) << "&";
+    ss << "CertificateChain=" << StringUtils::URLEncoded(m_certificateChain) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
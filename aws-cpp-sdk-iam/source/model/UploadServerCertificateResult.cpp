@@ -40,7 +40,7 @@ UploadServerCertificateResult& UploadServerCertificateResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "UploadServerCertificateResult")
+  if (rootNode.GetNameView() != "UploadServerCertificateResult")
   {
     resultNode = rootNode.FirstChild("UploadServerCertificateResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/iam/model/UploadSigningCertificateRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::IAM::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ UploadSigningCertificateRequest::UploadSigningCertificateRequest() :
 
 Aws::String UploadSigningCertificateRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UploadSigningCertificate&";
   if(m_userNameHasBeenSet)
   {
-    ss << "UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+    ss << "UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_certificateBodyHasBeenSet)
   {
-    ss << "CertificateBody=" << StringUtils::URLEncode(m_certificateBody.c_str()) << "&";
+    ss << "CertificateBody=" << StringUtils::URLEncoded(m_certificateBody) << "&";
   }
 
   ss << "Version=2010-05-08";
-  return ss.str();
+  return ss.TakeString();
 }
 
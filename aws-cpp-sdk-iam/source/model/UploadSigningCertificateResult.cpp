@@ -40,7 +40,7 @@ UploadSigningCertificateResult& UploadSigningCertificateResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "UploadSigningCertificateResult")
+  if (rootNode.GetNameView() != "UploadSigningCertificateResult")
   {
     resultNode = rootNode.FirstChild("UploadSigningCertificateResult");
   }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -63,31 +64,31 @@ UserDetail& UserDetail::operator =(const XmlNode& xmlNode)
     XmlNode pathNode = resultNode.FirstChild("Path");
     if(!pathNode.IsNull())
     {
-      m_path = StringUtils::Trim(pathNode.GetText().c_str());
+      m_path = pathNode.GetTextView().Trim().ToString();
       m_pathHasBeenSet = true;
     }
     XmlNode userNameNode = resultNode.FirstChild("UserName");
     if(!userNameNode.IsNull())
     {
-      m_userName = StringUtils::Trim(userNameNode.GetText().c_str());
+      m_userName = userNameNode.GetTextView().Trim().ToString();
       m_userNameHasBeenSet = true;
     }
     XmlNode userIdNode = resultNode.FirstChild("UserId");
     if(!userIdNode.IsNull())
     {
-      m_userId = StringUtils::Trim(userIdNode.GetText().c_str());
+      m_userId = userIdNode.GetTextView().Trim().ToString();
       m_userIdHasBeenSet = true;
     }
     XmlNode arnNode = resultNode.FirstChild("Arn");
     if(!arnNode.IsNull())
     {
-      m_arn = StringUtils::Trim(arnNode.GetText().c_str());
+      m_arn = arnNode.GetTextView().Trim().ToString();
       m_arnHasBeenSet = true;
     }
     XmlNode createDateNode = resultNode.FirstChild("CreateDate");
     if(!createDateNode.IsNull())
     {
-      m_createDate = DateTime(StringUtils::Trim(createDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_createDate = DateTime(createDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_createDateHasBeenSet = true;
     }
     XmlNode userPolicyListNode = resultNode.FirstChild("UserPolicyList");
@@ -108,7 +109,7 @@ UserDetail& UserDetail::operator =(const XmlNode& xmlNode)
       XmlNode groupListMember = groupListNode.FirstChild("member");
       while(!groupListMember.IsNull())
       {
-        m_groupList.push_back(StringUtils::Trim(groupListMember.GetText().c_str()));
+        m_groupList.push_back(groupListMember.GetTextView().Trim().ToString());
         groupListMember = groupListMember.NextNode("member");
       }
 
@@ -135,27 +136,27 @@ void UserDetail::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_pathHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+      oStream << location << index << locationValue << ".Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
 
   if(m_userNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << index << locationValue << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
 
   if(m_userIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".UserId=" << StringUtils::URLEncode(m_userId.c_str()) << "&";
+      oStream << location << index << locationValue << ".UserId=" << StringUtils::URLEncoded(m_userId) << "&";
   }
 
   if(m_arnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
 
   if(m_createDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_userPolicyListHasBeenSet)
@@ -163,9 +164,9 @@ void UserDetail::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned userPolicyListIdx = 1;
       for(auto& item : m_userPolicyList)
       {
-        Aws::StringStream userPolicyListSs;
+        Aws::Utils::Stream::StringOutputStream userPolicyListSs;
         userPolicyListSs << location << index << locationValue << ".UserPolicyList.member." << userPolicyListIdx++;
-        item.OutputToStream(oStream, userPolicyListSs.str().c_str());
+        item.OutputToStream(oStream, userPolicyListSs.GetString().c_str());
       }
   }
 
@@ -174,7 +175,7 @@ void UserDetail::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned groupListIdx = 1;
       for(auto& item : m_groupList)
       {
-        oStream << location << index << locationValue << ".GroupList.member." << groupListIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".GroupList.member." << groupListIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -183,9 +184,9 @@ void UserDetail::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned attachedManagedPoliciesIdx = 1;
       for(auto& item : m_attachedManagedPolicies)
       {
-        Aws::StringStream attachedManagedPoliciesSs;
+        Aws::Utils::Stream::StringOutputStream attachedManagedPoliciesSs;
         attachedManagedPoliciesSs << location << index << locationValue << ".AttachedManagedPolicies.member." << attachedManagedPoliciesIdx++;
-        item.OutputToStream(oStream, attachedManagedPoliciesSs.str().c_str());
+        item.OutputToStream(oStream, attachedManagedPoliciesSs.GetString().c_str());
       }
   }
 
@@ -195,32 +196,32 @@ void UserDetail::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_pathHasBeenSet)
   {
-      oStream << location << ".Path=" << StringUtils::URLEncode(m_path.c_str()) << "&";
+      oStream << location << ".Path=" << StringUtils::URLEncoded(m_path) << "&";
   }
   if(m_userNameHasBeenSet)
   {
-      oStream << location << ".UserName=" << StringUtils::URLEncode(m_userName.c_str()) << "&";
+      oStream << location << ".UserName=" << StringUtils::URLEncoded(m_userName) << "&";
   }
   if(m_userIdHasBeenSet)
   {
-      oStream << location << ".UserId=" << StringUtils::URLEncode(m_userId.c_str()) << "&";
+      oStream << location << ".UserId=" << StringUtils::URLEncoded(m_userId) << "&";
   }
   if(m_arnHasBeenSet)
   {
-      oStream << location << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
   if(m_createDateHasBeenSet)
   {
-      oStream << location << ".CreateDate=" << StringUtils::URLEncode(m_createDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreateDate=" << StringUtils::URLEncoded(m_createDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_userPolicyListHasBeenSet)
   {
       unsigned userPolicyListIdx = 1;
       for(auto& item : m_userPolicyList)
       {
-        Aws::StringStream userPolicyListSs;
+        Aws::Utils::Stream::StringOutputStream userPolicyListSs;
         userPolicyListSs << location <<  ".UserPolicyList.member." << userPolicyListIdx++;
-        item.OutputToStream(oStream, userPolicyListSs.str().c_str());
+        item.OutputToStream(oStream, userPolicyListSs.GetString().c_str());
       }
   }
   if(m_groupListHasBeenSet)
@@ -228,7 +229,7 @@ void UserDetail::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned groupListIdx = 1;
       for(auto& item : m_groupList)
       {
-        oStream << location << ".GroupList.member." << groupListIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".GroupList.member." << groupListIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_attachedManagedPoliciesHasBeenSet)
@@ -236,9 +237,9 @@ void UserDetail::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned attachedManagedPoliciesIdx = 1;
       for(auto& item : m_attachedManagedPolicies)
       {
-        Aws::StringStream attachedManagedPoliciesSs;
+        Aws::Utils::Stream::StringOutputStream attachedManagedPoliciesSs;
         attachedManagedPoliciesSs << location <<  ".AttachedManagedPolicies.member." << attachedManagedPoliciesIdx++;
-        item.OutputToStream(oStream, attachedManagedPoliciesSs.str().c_str());
+        item.OutputToStream(oStream, attachedManagedPoliciesSs.GetString().c_str());
       }
   }
 }
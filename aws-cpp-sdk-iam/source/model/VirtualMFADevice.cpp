@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 #include <aws/core/utils/HashingUtils.h>
 
 #include <utility>
@@ -58,19 +59,19 @@ VirtualMFADevice& VirtualMFADevice::operator =(const XmlNode& xmlNode)
     XmlNode serialNumberNode = resultNode.FirstChild("SerialNumber");
     if(!serialNumberNode.IsNull())
     {
-      m_serialNumber = StringUtils::Trim(serialNumberNode.GetText().c_str());
+      m_serialNumber = serialNumberNode.GetTextView().Trim().ToString();
       m_serialNumberHasBeenSet = true;
     }
     XmlNode base32StringSeedNode = resultNode.FirstChild("Base32StringSeed");
     if(!base32StringSeedNode.IsNull())
     {
-      m_base32StringSeed = HashingUtils::Base64Decode(StringUtils::Trim(base32StringSeedNode.GetText().c_str()));
+      m_base32StringSeed = HashingUtils::Base64Decode(base32StringSeedNode.GetTextView().Trim().ToString());
       m_base32StringSeedHasBeenSet = true;
     }
     XmlNode qRCodePNGNode = resultNode.FirstChild("QRCodePNG");
     if(!qRCodePNGNode.IsNull())
     {
-      m_qRCodePNG = HashingUtils::Base64Decode(StringUtils::Trim(qRCodePNGNode.GetText().c_str()));
+      m_qRCodePNG = HashingUtils::Base64Decode(qRCodePNGNode.GetTextView().Trim().ToString());
       m_qRCodePNGHasBeenSet = true;
     }
     XmlNode userNode = resultNode.FirstChild("User");
@@ -82,7 +83,7 @@ VirtualMFADevice& VirtualMFADevice::operator =(const XmlNode& xmlNode)
     XmlNode enableDateNode = resultNode.FirstChild("EnableDate");
     if(!enableDateNode.IsNull())
     {
-      m_enableDate = DateTime(StringUtils::Trim(enableDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_enableDate = DateTime(enableDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_enableDateHasBeenSet = true;
     }
   }
@@ -94,29 +95,29 @@ void VirtualMFADevice::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_serialNumberHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SerialNumber=" << StringUtils::URLEncode(m_serialNumber.c_str()) << "&";
+      oStream << location << index << locationValue << ".SerialNumber=" << StringUtils::URLEncoded(m_serialNumber) << "&";
   }
 
   if(m_base32StringSeedHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Base32StringSeed=" << StringUtils::URLEncode(HashingUtils::Base64Encode(m_base32StringSeed).c_str()) << "&";
+      oStream << location << index << locationValue << ".Base32StringSeed=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(m_base32StringSeed)) << "&";
   }
 
   if(m_qRCodePNGHasBeenSet)
   {
-      oStream << location << index << locationValue << ".QRCodePNG=" << StringUtils::URLEncode(HashingUtils::Base64Encode(m_qRCodePNG).c_str()) << "&";
+      oStream << location << index << locationValue << ".QRCodePNG=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(m_qRCodePNG)) << "&";
   }
 
   if(m_userHasBeenSet)
   {
-      Aws::StringStream userLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream userLocationAndMemberSs;
       userLocationAndMemberSs << location << index << locationValue << ".User";
-      m_user.OutputToStream(oStream, userLocationAndMemberSs.str().c_str());
+      m_user.OutputToStream(oStream, userLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_enableDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EnableDate=" << StringUtils::URLEncode(m_enableDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".EnableDate=" << StringUtils::URLEncoded(m_enableDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -125,15 +126,15 @@ void VirtualMFADevice::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_serialNumberHasBeenSet)
   {
-      oStream << location << ".SerialNumber=" << StringUtils::URLEncode(m_serialNumber.c_str()) << "&";
+      oStream << location << ".SerialNumber=" << StringUtils::URLEncoded(m_serialNumber) << "&";
   }
   if(m_base32StringSeedHasBeenSet)
   {
-      oStream << location << ".Base32StringSeed=" << StringUtils::URLEncode(HashingUtils::Base64Encode(m_base32StringSeed).c_str()) << "&";
+      oStream << location << ".Base32StringSeed=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(m_base32StringSeed)) << "&";
   }
   if(m_qRCodePNGHasBeenSet)
   {
-      oStream << location << ".QRCodePNG=" << StringUtils::URLEncode(HashingUtils::Base64Encode(m_qRCodePNG).c_str()) << "&";
+      oStream << location << ".QRCodePNG=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(m_qRCodePNG)) << "&";
   }
   if(m_userHasBeenSet)
   {
@@ -143,7 +144,7 @@ void VirtualMFADevice::OutputToStream(Aws::OStream& oStream, const char* locatio
   }
   if(m_enableDateHasBeenSet)
   {
-      oStream << location << ".EnableDate=" << StringUtils::URLEncode(m_enableDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".EnableDate=" << StringUtils::URLEncoded(m_enableDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
@@ -27,6 +27,9 @@
 #include <aws/importexport/model/ListJobsResult.h>
 #include <aws/importexport/model/UpdateJobResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -158,6 +161,18 @@ namespace Model
          */
         virtual void CancelJobAsync(const Model::CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelJobCallable(const Model::CancelJobRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelJobOutcomeCallable CancelJobCallable(Model::CancelJobRequest&& request) const;
+
+        /**
+         * Same as CancelJobAsync(const Model::CancelJobRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelJobAsync(Model::CancelJobRequest&& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * This operation initiates the process of scheduling an upload or download of your
          * data. You include in the request a manifest that describes the data transfer
@@ -189,6 +204,18 @@ namespace Model
          */
         virtual void CreateJobAsync(const Model::CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateJobCallable(const Model::CreateJobRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateJobOutcomeCallable CreateJobCallable(Model::CreateJobRequest&& request) const;
+
+        /**
+         * Same as CreateJobAsync(const Model::CreateJobRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateJobAsync(Model::CreateJobRequest&& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * This operation generates a pre-paid UPS shipping label that you will use to ship
          * your device to AWS for processing.
@@ -211,6 +238,18 @@ namespace Model
          */
         virtual void GetShippingLabelAsync(const Model::GetShippingLabelRequest& request, const GetShippingLabelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetShippingLabelCallable(const Model::GetShippingLabelRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetShippingLabelOutcomeCallable GetShippingLabelCallable(Model::GetShippingLabelRequest&& request) const;
+
+        /**
+         * Same as GetShippingLabelAsync(const Model::GetShippingLabelRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetShippingLabelAsync(Model::GetShippingLabelRequest&& request, const GetShippingLabelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * This operation returns information about a job, including where the job is in
          * the processing pipeline, the status of the results, and the signature value
@@ -236,6 +275,18 @@ namespace Model
          */
         virtual void GetStatusAsync(const Model::GetStatusRequest& request, const GetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetStatusCallable(const Model::GetStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetStatusOutcomeCallable GetStatusCallable(Model::GetStatusRequest&& request) const;
+
+        /**
+         * Same as GetStatusAsync(const Model::GetStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetStatusAsync(Model::GetStatusRequest&& request, const GetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * This operation returns the jobs associated with the requester. AWS Import/Export
          * lists the jobs in reverse chronological order based on the date of creation. For
@@ -264,6 +315,18 @@ namespace Model
          */
         virtual void ListJobsAsync(const Model::ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListJobsCallable(const Model::ListJobsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListJobsOutcomeCallable ListJobsCallable(Model::ListJobsRequest&& request) const;
+
+        /**
+         * Same as ListJobsAsync(const Model::ListJobsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListJobsAsync(Model::ListJobsRequest&& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * You use this operation to change the parameters specified in the original
          * manifest file by supplying a new manifest file. The manifest file attached to
@@ -295,6 +358,50 @@ namespace Model
          */
         virtual void UpdateJobAsync(const Model::UpdateJobRequest& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateJobCallable(const Model::UpdateJobRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateJobOutcomeCallable UpdateJobCallable(Model::UpdateJobRequest&& request) const;
+
+        /**
+         * Same as UpdateJobAsync(const Model::UpdateJobRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateJobAsync(Model::UpdateJobRequest&& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CancelJob(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ImportExportClient, Model::CancelJobRequest, Model::CancelJobOutcome> CancelJobAwaitable(Model::CancelJobRequest request) const;
+
+        /**
+         * co_await-able form of CreateJob(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ImportExportClient, Model::CreateJobRequest, Model::CreateJobOutcome> CreateJobAwaitable(Model::CreateJobRequest request) const;
+
+        /**
+         * co_await-able form of GetShippingLabel(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ImportExportClient, Model::GetShippingLabelRequest, Model::GetShippingLabelOutcome> GetShippingLabelAwaitable(Model::GetShippingLabelRequest request) const;
+
+        /**
+         * co_await-able form of GetStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ImportExportClient, Model::GetStatusRequest, Model::GetStatusOutcome> GetStatusAwaitable(Model::GetStatusRequest request) const;
+
+        /**
+         * co_await-able form of ListJobs(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ImportExportClient, Model::ListJobsRequest, Model::ListJobsOutcome> ListJobsAwaitable(Model::ListJobsRequest request) const;
+
+        /**
+         * co_await-able form of UpdateJob(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ImportExportClient, Model::UpdateJobRequest, Model::UpdateJobOutcome> UpdateJobAwaitable(Model::UpdateJobRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateJobRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateJob"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetShippingLabelRequest();
+    inline const char* GetServiceRequestName() const override { return "GetShippingLabel"; }
+
     Aws::String SerializePayload() const override;
 
     
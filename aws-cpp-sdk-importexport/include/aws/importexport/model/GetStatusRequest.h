@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "GetStatus"; }
+
     Aws::String SerializePayload() const override;
 
     
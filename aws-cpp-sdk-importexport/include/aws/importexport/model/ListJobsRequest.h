@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListJobsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListJobs"; }
+
     Aws::String SerializePayload() const override;
 
     
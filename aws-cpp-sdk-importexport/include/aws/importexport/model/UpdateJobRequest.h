@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateJobRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateJob"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -115,7 +115,7 @@ CancelJobOutcome ImportExportClient::CancelJob(const CancelJobRequest& request)
 
 CancelJobOutcomeCallable ImportExportClient::CancelJobCallable(const CancelJobRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelJob( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelJob( request ); } );
 }
 
 void ImportExportClient::CancelJobAsync(const CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -123,6 +123,16 @@ void ImportExportClient::CancelJobAsync(const CancelJobRequest& request, const C
   m_executor->Submit( [this, request, handler, context](){ this->CancelJobAsyncHelper( request, handler, context ); } );
 }
 
+CancelJobOutcomeCallable ImportExportClient::CancelJobCallable(CancelJobRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ImportExportClient::CancelJob, this, std::move(request)));
+}
+
+void ImportExportClient::CancelJobAsync(CancelJobRequest&& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ImportExportClient::CancelJobAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ImportExportClient::CancelJobAsyncHelper(const CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelJob(request), context);
@@ -145,7 +155,7 @@ CreateJobOutcome ImportExportClient::CreateJob(const CreateJobRequest& request)
 
 CreateJobOutcomeCallable ImportExportClient::CreateJobCallable(const CreateJobRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateJob( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateJob( request ); } );
 }
 
 void ImportExportClient::CreateJobAsync(const CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -153,6 +163,16 @@ void ImportExportClient::CreateJobAsync(const CreateJobRequest& request, const C
   m_executor->Submit( [this, request, handler, context](){ this->CreateJobAsyncHelper( request, handler, context ); } );
 }
 
+CreateJobOutcomeCallable ImportExportClient::CreateJobCallable(CreateJobRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ImportExportClient::CreateJob, this, std::move(request)));
+}
+
+void ImportExportClient::CreateJobAsync(CreateJobRequest&& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ImportExportClient::CreateJobAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ImportExportClient::CreateJobAsyncHelper(const CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateJob(request), context);
@@ -175,7 +195,7 @@ GetShippingLabelOutcome ImportExportClient::GetShippingLabel(const GetShippingLa
 
 GetShippingLabelOutcomeCallable ImportExportClient::GetShippingLabelCallable(const GetShippingLabelRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetShippingLabel( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetShippingLabel( request ); } );
 }
 
 void ImportExportClient::GetShippingLabelAsync(const GetShippingLabelRequest& request, const GetShippingLabelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -183,6 +203,16 @@ void ImportExportClient::GetShippingLabelAsync(const GetShippingLabelRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->GetShippingLabelAsyncHelper( request, handler, context ); } );
 }
 
+GetShippingLabelOutcomeCallable ImportExportClient::GetShippingLabelCallable(GetShippingLabelRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ImportExportClient::GetShippingLabel, this, std::move(request)));
+}
+
+void ImportExportClient::GetShippingLabelAsync(GetShippingLabelRequest&& request, const GetShippingLabelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ImportExportClient::GetShippingLabelAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ImportExportClient::GetShippingLabelAsyncHelper(const GetShippingLabelRequest& request, const GetShippingLabelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetShippingLabel(request), context);
@@ -205,7 +235,7 @@ GetStatusOutcome ImportExportClient::GetStatus(const GetStatusRequest& request)
 
 GetStatusOutcomeCallable ImportExportClient::GetStatusCallable(const GetStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetStatus( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetStatus( request ); } );
 }
 
 void ImportExportClient::GetStatusAsync(const GetStatusRequest& request, const GetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -213,6 +243,16 @@ void ImportExportClient::GetStatusAsync(const GetStatusRequest& request, const G
   m_executor->Submit( [this, request, handler, context](){ this->GetStatusAsyncHelper( request, handler, context ); } );
 }
 
+GetStatusOutcomeCallable ImportExportClient::GetStatusCallable(GetStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ImportExportClient::GetStatus, this, std::move(request)));
+}
+
+void ImportExportClient::GetStatusAsync(GetStatusRequest&& request, const GetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ImportExportClient::GetStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ImportExportClient::GetStatusAsyncHelper(const GetStatusRequest& request, const GetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetStatus(request), context);
@@ -235,7 +275,7 @@ ListJobsOutcome ImportExportClient::ListJobs(const ListJobsRequest& request) con
 
 ListJobsOutcomeCallable ImportExportClient::ListJobsCallable(const ListJobsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListJobs( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListJobs( request ); } );
 }
 
 void ImportExportClient::ListJobsAsync(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -243,6 +283,16 @@ void ImportExportClient::ListJobsAsync(const ListJobsRequest& request, const Lis
   m_executor->Submit( [this, request, handler, context](){ this->ListJobsAsyncHelper( request, handler, context ); } );
 }
 
+ListJobsOutcomeCallable ImportExportClient::ListJobsCallable(ListJobsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ImportExportClient::ListJobs, this, std::move(request)));
+}
+
+void ImportExportClient::ListJobsAsync(ListJobsRequest&& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ImportExportClient::ListJobsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ImportExportClient::ListJobsAsyncHelper(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListJobs(request), context);
@@ -265,7 +315,7 @@ UpdateJobOutcome ImportExportClient::UpdateJob(const UpdateJobRequest& request)
 
 UpdateJobOutcomeCallable ImportExportClient::UpdateJobCallable(const UpdateJobRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateJob( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateJob( request ); } );
 }
 
 void ImportExportClient::UpdateJobAsync(const UpdateJobRequest& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -273,8 +323,50 @@ void ImportExportClient::UpdateJobAsync(const UpdateJobRequest& request, const U
   m_executor->Submit( [this, request, handler, context](){ this->UpdateJobAsyncHelper( request, handler, context ); } );
 }
 
+UpdateJobOutcomeCallable ImportExportClient::UpdateJobCallable(UpdateJobRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ImportExportClient::UpdateJob, this, std::move(request)));
+}
+
+void ImportExportClient::UpdateJobAsync(UpdateJobRequest&& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ImportExportClient::UpdateJobAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ImportExportClient::UpdateJobAsyncHelper(const UpdateJobRequest& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateJob(request), context);
 }
 
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<ImportExportClient, CancelJobRequest, CancelJobOutcome> ImportExportClient::CancelJobAwaitable(CancelJobRequest request) const
+{
+  return { m_executor.get(), { this, &ImportExportClient::CancelJob, std::move(request) } };
+}
+
+ClientOperationAwaitable<ImportExportClient, CreateJobRequest, CreateJobOutcome> ImportExportClient::CreateJobAwaitable(CreateJobRequest request) const
+{
+  return { m_executor.get(), { this, &ImportExportClient::CreateJob, std::move(request) } };
+}
+
+ClientOperationAwaitable<ImportExportClient, GetShippingLabelRequest, GetShippingLabelOutcome> ImportExportClient::GetShippingLabelAwaitable(GetShippingLabelRequest request) const
+{
+  return { m_executor.get(), { this, &ImportExportClient::GetShippingLabel, std::move(request) } };
+}
+
+ClientOperationAwaitable<ImportExportClient, GetStatusRequest, GetStatusOutcome> ImportExportClient::GetStatusAwaitable(GetStatusRequest request) const
+{
+  return { m_executor.get(), { this, &ImportExportClient::GetStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<ImportExportClient, ListJobsRequest, ListJobsOutcome> ImportExportClient::ListJobsAwaitable(ListJobsRequest request) const
+{
+  return { m_executor.get(), { this, &ImportExportClient::ListJobs, std::move(request) } };
+}
+
+ClientOperationAwaitable<ImportExportClient, UpdateJobRequest, UpdateJobOutcome> ImportExportClient::UpdateJobAwaitable(UpdateJobRequest request) const
+{
+  return { m_executor.get(), { this, &ImportExportClient::UpdateJob, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -51,13 +51,13 @@ Artifact& Artifact::operator =(const XmlNode& xmlNode)
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode uRLNode = resultNode.FirstChild("URL");
     if(!uRLNode.IsNull())
     {
-      m_uRL = StringUtils::Trim(uRLNode.GetText().c_str());
+      m_uRL = uRLNode.GetTextView().Trim().ToString();
       m_uRLHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void Artifact::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 {
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_uRLHasBeenSet)
   {
-      oStream << location << index << locationValue << ".URL=" << StringUtils::URLEncode(m_uRL.c_str()) << "&";
+      oStream << location << index << locationValue << ".URL=" << StringUtils::URLEncoded(m_uRL) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void Artifact::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_uRLHasBeenSet)
   {
-      oStream << location << ".URL=" << StringUtils::URLEncode(m_uRL.c_str()) << "&";
+      oStream << location << ".URL=" << StringUtils::URLEncoded(m_uRL) << "&";
   }
 }
 
@@ -42,7 +42,7 @@ CancelJobResult& CancelJobResult::operator =(const AmazonWebServiceResult<XmlDoc
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CancelJobResult")
+  if (rootNode.GetNameView() != "CancelJobResult")
   {
     resultNode = rootNode.FirstChild("CancelJobResult");
   }
@@ -52,7 +52,7 @@ CancelJobResult& CancelJobResult::operator =(const AmazonWebServiceResult<XmlDoc
     XmlNode successNode = resultNode.FirstChild("Success");
     if(!successNode.IsNull())
     {
-      m_success = StringUtils::ConvertToBool(StringUtils::Trim(successNode.GetText().c_str()).c_str());
+      m_success = StringUtils::ConvertToBool(successNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/importexport/model/CreateJobRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ImportExport::Model;
 using namespace Aws::Utils;
@@ -31,7 +32,7 @@ CreateJobRequest::CreateJobRequest() :
 
 Aws::String CreateJobRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateJob&";
   if(m_jobTypeHasBeenSet)
   {
@@ -40,12 +41,12 @@ Aws::String CreateJobRequest::SerializePayload() const
 
   if(m_manifestHasBeenSet)
   {
-    ss << "Manifest=" << StringUtils::URLEncode(m_manifest.c_str()) << "&";
+    ss << "Manifest=" << StringUtils::URLEncoded(m_manifest) << "&";
   }
 
   if(m_manifestAddendumHasBeenSet)
   {
-    ss << "ManifestAddendum=" << StringUtils::URLEncode(m_manifestAddendum.c_str()) << "&";
+    ss << "ManifestAddendum=" << StringUtils::URLEncoded(m_manifestAddendum) << "&";
   }
 
   if(m_validateOnlyHasBeenSet)
@@ -55,10 +56,10 @@ Aws::String CreateJobRequest::SerializePayload() const
 
   if(m_aPIVersionHasBeenSet)
   {
-    ss << "APIVersion=" << StringUtils::URLEncode(m_aPIVersion.c_str()) << "&";
+    ss << "APIVersion=" << StringUtils::URLEncoded(m_aPIVersion) << "&";
   }
 
   ss << "Version=2010-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateJobResult& CreateJobResult::operator =(const AmazonWebServiceResult<XmlDoc
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateJobResult")
+  if (rootNode.GetNameView() != "CreateJobResult")
   {
     resultNode = rootNode.FirstChild("CreateJobResult");
   }
@@ -50,27 +50,27 @@ CreateJobResult& CreateJobResult::operator =(const AmazonWebServiceResult<XmlDoc
     XmlNode jobIdNode = resultNode.FirstChild("JobId");
     if(!jobIdNode.IsNull())
     {
-      m_jobId = StringUtils::Trim(jobIdNode.GetText().c_str());
+      m_jobId = jobIdNode.GetTextView().Trim().ToString();
     }
     XmlNode jobTypeNode = resultNode.FirstChild("JobType");
     if(!jobTypeNode.IsNull())
     {
-      m_jobType = JobTypeMapper::GetJobTypeForName(StringUtils::Trim(jobTypeNode.GetText().c_str()).c_str());
+      m_jobType = JobTypeMapper::GetJobTypeForName(jobTypeNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode signatureNode = resultNode.FirstChild("Signature");
     if(!signatureNode.IsNull())
     {
-      m_signature = StringUtils::Trim(signatureNode.GetText().c_str());
+      m_signature = signatureNode.GetTextView().Trim().ToString();
     }
     XmlNode signatureFileContentsNode = resultNode.FirstChild("SignatureFileContents");
     if(!signatureFileContentsNode.IsNull())
     {
-      m_signatureFileContents = StringUtils::Trim(signatureFileContentsNode.GetText().c_str());
+      m_signatureFileContents = signatureFileContentsNode.GetTextView().Trim().ToString();
     }
     XmlNode warningMessageNode = resultNode.FirstChild("WarningMessage");
     if(!warningMessageNode.IsNull())
     {
-      m_warningMessage = StringUtils::Trim(warningMessageNode.GetText().c_str());
+      m_warningMessage = warningMessageNode.GetTextView().Trim().ToString();
     }
     XmlNode artifactListNode = resultNode.FirstChild("ArtifactList");
     if(!artifactListNode.IsNull())
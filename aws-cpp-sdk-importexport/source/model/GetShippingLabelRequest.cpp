@@ -15,6 +15,7 @@
 #include <aws/importexport/model/GetShippingLabelRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ImportExport::Model;
 using namespace Aws::Utils;
@@ -37,7 +38,7 @@ GetShippingLabelRequest::GetShippingLabelRequest() :
 
 Aws::String GetShippingLabelRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetShippingLabel&";
   if(m_jobIdsHasBeenSet)
   {
@@ -45,67 +46,67 @@ Aws::String GetShippingLabelRequest::SerializePayload() const
     for(auto& item : m_jobIds)
     {
       ss << "jobIds.member." << jobIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       jobIdsCount++;
     }
   }
 
   if(m_nameHasBeenSet)
   {
-    ss << "name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+    ss << "name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_companyHasBeenSet)
   {
-    ss << "company=" << StringUtils::URLEncode(m_company.c_str()) << "&";
+    ss << "company=" << StringUtils::URLEncoded(m_company) << "&";
   }
 
   if(m_phoneNumberHasBeenSet)
   {
-    ss << "phoneNumber=" << StringUtils::URLEncode(m_phoneNumber.c_str()) << "&";
+    ss << "phoneNumber=" << StringUtils::URLEncoded(m_phoneNumber) << "&";
   }
 
   if(m_countryHasBeenSet)
   {
-    ss << "country=" << StringUtils::URLEncode(m_country.c_str()) << "&";
+    ss << "country=" << StringUtils::URLEncoded(m_country) << "&";
   }
 
   if(m_stateOrProvinceHasBeenSet)
   {
-    ss << "stateOrProvince=" << StringUtils::URLEncode(m_stateOrProvince.c_str()) << "&";
+    ss << "stateOrProvince=" << StringUtils::URLEncoded(m_stateOrProvince) << "&";
   }
 
   if(m_cityHasBeenSet)
   {
-    ss << "city=" << StringUtils::URLEncode(m_city.c_str()) << "&";
+    ss << "city=" << StringUtils::URLEncoded(m_city) << "&";
   }
 
   if(m_postalCodeHasBeenSet)
   {
-    ss << "postalCode=" << StringUtils::URLEncode(m_postalCode.c_str()) << "&";
+    ss << "postalCode=" << StringUtils::URLEncoded(m_postalCode) << "&";
   }
 
   if(m_street1HasBeenSet)
   {
-    ss << "street1=" << StringUtils::URLEncode(m_street1.c_str()) << "&";
+    ss << "street1=" << StringUtils::URLEncoded(m_street1) << "&";
   }
 
   if(m_street2HasBeenSet)
   {
-    ss << "street2=" << StringUtils::URLEncode(m_street2.c_str()) << "&";
+    ss << "street2=" << StringUtils::URLEncoded(m_street2) << "&";
   }
 
   if(m_street3HasBeenSet)
   {
-    ss << "street3=" << StringUtils::URLEncode(m_street3.c_str()) << "&";
+    ss << "street3=" << StringUtils::URLEncoded(m_street3) << "&";
   }
 
   if(m_aPIVersionHasBeenSet)
   {
-    ss << "APIVersion=" << StringUtils::URLEncode(m_aPIVersion.c_str()) << "&";
+    ss << "APIVersion=" << StringUtils::URLEncoded(m_aPIVersion) << "&";
   }
 
   ss << "Version=2010-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
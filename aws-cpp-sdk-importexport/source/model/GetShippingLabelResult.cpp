@@ -40,7 +40,7 @@ GetShippingLabelResult& GetShippingLabelResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetShippingLabelResult")
+  if (rootNode.GetNameView() != "GetShippingLabelResult")
   {
     resultNode = rootNode.FirstChild("GetShippingLabelResult");
   }
@@ -50,12 +50,12 @@ GetShippingLabelResult& GetShippingLabelResult::operator =(const AmazonWebServic
     XmlNode shippingLabelURLNode = resultNode.FirstChild("ShippingLabelURL");
     if(!shippingLabelURLNode.IsNull())
     {
-      m_shippingLabelURL = StringUtils::Trim(shippingLabelURLNode.GetText().c_str());
+      m_shippingLabelURL = shippingLabelURLNode.GetTextView().Trim().ToString();
     }
     XmlNode warningNode = resultNode.FirstChild("Warning");
     if(!warningNode.IsNull())
     {
-      m_warning = StringUtils::Trim(warningNode.GetText().c_str());
+      m_warning = warningNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/importexport/model/GetStatusRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ImportExport::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ GetStatusRequest::GetStatusRequest() :
 
 Aws::String GetStatusRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetStatus&";
   if(m_jobIdHasBeenSet)
   {
-    ss << "JobId=" << StringUtils::URLEncode(m_jobId.c_str()) << "&";
+    ss << "JobId=" << StringUtils::URLEncoded(m_jobId) << "&";
   }
 
   if(m_aPIVersionHasBeenSet)
   {
-    ss << "APIVersion=" << StringUtils::URLEncode(m_aPIVersion.c_str()) << "&";
+    ss << "APIVersion=" << StringUtils::URLEncoded(m_aPIVersion) << "&";
   }
 
   ss << "Version=2010-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -42,7 +42,7 @@ GetStatusResult& GetStatusResult::operator =(const AmazonWebServiceResult<XmlDoc
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetStatusResult")
+  if (rootNode.GetNameView() != "GetStatusResult")
   {
     resultNode = rootNode.FirstChild("GetStatusResult");
   }
@@ -52,77 +52,77 @@ GetStatusResult& GetStatusResult::operator =(const AmazonWebServiceResult<XmlDoc
     XmlNode jobIdNode = resultNode.FirstChild("JobId");
     if(!jobIdNode.IsNull())
     {
-      m_jobId = StringUtils::Trim(jobIdNode.GetText().c_str());
+      m_jobId = jobIdNode.GetTextView().Trim().ToString();
     }
     XmlNode jobTypeNode = resultNode.FirstChild("JobType");
     if(!jobTypeNode.IsNull())
     {
-      m_jobType = JobTypeMapper::GetJobTypeForName(StringUtils::Trim(jobTypeNode.GetText().c_str()).c_str());
+      m_jobType = JobTypeMapper::GetJobTypeForName(jobTypeNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode locationCodeNode = resultNode.FirstChild("LocationCode");
     if(!locationCodeNode.IsNull())
     {
-      m_locationCode = StringUtils::Trim(locationCodeNode.GetText().c_str());
+      m_locationCode = locationCodeNode.GetTextView().Trim().ToString();
     }
     XmlNode locationMessageNode = resultNode.FirstChild("LocationMessage");
     if(!locationMessageNode.IsNull())
     {
-      m_locationMessage = StringUtils::Trim(locationMessageNode.GetText().c_str());
+      m_locationMessage = locationMessageNode.GetTextView().Trim().ToString();
     }
     XmlNode progressCodeNode = resultNode.FirstChild("ProgressCode");
     if(!progressCodeNode.IsNull())
     {
-      m_progressCode = StringUtils::Trim(progressCodeNode.GetText().c_str());
+      m_progressCode = progressCodeNode.GetTextView().Trim().ToString();
     }
     XmlNode progressMessageNode = resultNode.FirstChild("ProgressMessage");
     if(!progressMessageNode.IsNull())
     {
-      m_progressMessage = StringUtils::Trim(progressMessageNode.GetText().c_str());
+      m_progressMessage = progressMessageNode.GetTextView().Trim().ToString();
     }
     XmlNode carrierNode = resultNode.FirstChild("Carrier");
     if(!carrierNode.IsNull())
     {
-      m_carrier = StringUtils::Trim(carrierNode.GetText().c_str());
+      m_carrier = carrierNode.GetTextView().Trim().ToString();
     }
     XmlNode trackingNumberNode = resultNode.FirstChild("TrackingNumber");
     if(!trackingNumberNode.IsNull())
     {
-      m_trackingNumber = StringUtils::Trim(trackingNumberNode.GetText().c_str());
+      m_trackingNumber = trackingNumberNode.GetTextView().Trim().ToString();
     }
     XmlNode logBucketNode = resultNode.FirstChild("LogBucket");
     if(!logBucketNode.IsNull())
     {
-      m_logBucket = StringUtils::Trim(logBucketNode.GetText().c_str());
+      m_logBucket = logBucketNode.GetTextView().Trim().ToString();
     }
     XmlNode logKeyNode = resultNode.FirstChild("LogKey");
     if(!logKeyNode.IsNull())
     {
-      m_logKey = StringUtils::Trim(logKeyNode.GetText().c_str());
+      m_logKey = logKeyNode.GetTextView().Trim().ToString();
     }
     XmlNode errorCountNode = resultNode.FirstChild("ErrorCount");
     if(!errorCountNode.IsNull())
     {
-      m_errorCount = StringUtils::ConvertToInt32(StringUtils::Trim(errorCountNode.GetText().c_str()).c_str());
+      m_errorCount = StringUtils::ConvertToInt32(errorCountNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode signatureNode = resultNode.FirstChild("Signature");
     if(!signatureNode.IsNull())
     {
-      m_signature = StringUtils::Trim(signatureNode.GetText().c_str());
+      m_signature = signatureNode.GetTextView().Trim().ToString();
     }
     XmlNode signatureFileContentsNode = resultNode.FirstChild("SignatureFileContents");
     if(!signatureFileContentsNode.IsNull())
     {
-      m_signatureFileContents = StringUtils::Trim(signatureFileContentsNode.GetText().c_str());
+      m_signatureFileContents = signatureFileContentsNode.GetTextView().Trim().ToString();
     }
     XmlNode currentManifestNode = resultNode.FirstChild("CurrentManifest");
     if(!currentManifestNode.IsNull())
     {
-      m_currentManifest = StringUtils::Trim(currentManifestNode.GetText().c_str());
+      m_currentManifest = currentManifestNode.GetTextView().Trim().ToString();
     }
     XmlNode creationDateNode = resultNode.FirstChild("CreationDate");
     if(!creationDateNode.IsNull())
     {
-      m_creationDate = DateTime(StringUtils::Trim(creationDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_creationDate = DateTime(creationDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
     XmlNode artifactListNode = resultNode.FirstChild("ArtifactList");
     if(!artifactListNode.IsNull())
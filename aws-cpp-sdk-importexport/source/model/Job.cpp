@@ -57,25 +57,25 @@ Job& Job::operator =(const XmlNode& xmlNode)
     XmlNode jobIdNode = resultNode.FirstChild("JobId");
     if(!jobIdNode.IsNull())
     {
-      m_jobId = StringUtils::Trim(jobIdNode.GetText().c_str());
+      m_jobId = jobIdNode.GetTextView().Trim().ToString();
       m_jobIdHasBeenSet = true;
     }
     XmlNode creationDateNode = resultNode.FirstChild("CreationDate");
     if(!creationDateNode.IsNull())
     {
-      m_creationDate = DateTime(StringUtils::Trim(creationDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_creationDate = DateTime(creationDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_creationDateHasBeenSet = true;
     }
     XmlNode isCanceledNode = resultNode.FirstChild("IsCanceled");
     if(!isCanceledNode.IsNull())
     {
-      m_isCanceled = StringUtils::ConvertToBool(StringUtils::Trim(isCanceledNode.GetText().c_str()).c_str());
+      m_isCanceled = StringUtils::ConvertToBool(isCanceledNode.GetTextView().Trim().ToString().c_str());
       m_isCanceledHasBeenSet = true;
     }
     XmlNode jobTypeNode = resultNode.FirstChild("JobType");
     if(!jobTypeNode.IsNull())
     {
-      m_jobType = JobTypeMapper::GetJobTypeForName(StringUtils::Trim(jobTypeNode.GetText().c_str()).c_str());
+      m_jobType = JobTypeMapper::GetJobTypeForName(jobTypeNode.GetTextView().Trim().ToString().c_str());
       m_jobTypeHasBeenSet = true;
     }
   }
@@ -87,12 +87,12 @@ void Job::OutputToStream(Aws::OStream& oStream, const char* location, unsigned i
 {
   if(m_jobIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".JobId=" << StringUtils::URLEncode(m_jobId.c_str()) << "&";
+      oStream << location << index << locationValue << ".JobId=" << StringUtils::URLEncoded(m_jobId) << "&";
   }
 
   if(m_creationDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CreationDate=" << StringUtils::URLEncode(m_creationDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CreationDate=" << StringUtils::URLEncoded(m_creationDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_isCanceledHasBeenSet)
@@ -111,11 +111,11 @@ void Job::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_jobIdHasBeenSet)
   {
-      oStream << location << ".JobId=" << StringUtils::URLEncode(m_jobId.c_str()) << "&";
+      oStream << location << ".JobId=" << StringUtils::URLEncoded(m_jobId) << "&";
   }
   if(m_creationDateHasBeenSet)
   {
-      oStream << location << ".CreationDate=" << StringUtils::URLEncode(m_creationDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CreationDate=" << StringUtils::URLEncoded(m_creationDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_isCanceledHasBeenSet)
   {
@@ -29,21 +29,29 @@ namespace Aws
       namespace JobTypeMapper
       {
 
-        static const int Import_HASH = HashingUtils::HashString("Import");
-        static const int Export_HASH = HashingUtils::HashString("Export");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Import_HASH = -2100928571;
+        static const int Export_HASH = 2089680852;
 
 
         JobType GetJobTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Import_HASH)
+          switch (hashCode)
           {
+          case Import_HASH:
             return JobType::Import;
-          }
-          else if (hashCode == Export_HASH)
-          {
+          case Export_HASH:
             return JobType::Export;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
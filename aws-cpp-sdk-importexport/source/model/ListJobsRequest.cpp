@@ -15,6 +15,7 @@
 #include <aws/importexport/model/ListJobsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ImportExport::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ ListJobsRequest::ListJobsRequest() :
 
 Aws::String ListJobsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListJobs&";
   if(m_maxJobsHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String ListJobsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_aPIVersionHasBeenSet)
   {
-    ss << "APIVersion=" << StringUtils::URLEncode(m_aPIVersion.c_str()) << "&";
+    ss << "APIVersion=" << StringUtils::URLEncoded(m_aPIVersion) << "&";
   }
 
   ss << "Version=2010-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
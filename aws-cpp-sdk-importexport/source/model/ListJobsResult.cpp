@@ -42,7 +42,7 @@ ListJobsResult& ListJobsResult::operator =(const AmazonWebServiceResult<XmlDocum
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListJobsResult")
+  if (rootNode.GetNameView() != "ListJobsResult")
   {
     resultNode = rootNode.FirstChild("ListJobsResult");
   }
@@ -63,7 +63,7 @@ ListJobsResult& ListJobsResult::operator =(const AmazonWebServiceResult<XmlDocum
     XmlNode isTruncatedNode = resultNode.FirstChild("IsTruncated");
     if(!isTruncatedNode.IsNull())
     {
-      m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(isTruncatedNode.GetText().c_str()).c_str());
+      m_isTruncated = StringUtils::ConvertToBool(isTruncatedNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/importexport/model/UpdateJobRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::ImportExport::Model;
 using namespace Aws::Utils;
@@ -31,16 +32,16 @@ UpdateJobRequest::UpdateJobRequest() :
 
 Aws::String UpdateJobRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=UpdateJob&";
   if(m_jobIdHasBeenSet)
   {
-    ss << "JobId=" << StringUtils::URLEncode(m_jobId.c_str()) << "&";
+    ss << "JobId=" << StringUtils::URLEncoded(m_jobId) << "&";
   }
 
   if(m_manifestHasBeenSet)
   {
-    ss << "Manifest=" << StringUtils::URLEncode(m_manifest.c_str()) << "&";
+    ss << "Manifest=" << StringUtils::URLEncoded(m_manifest) << "&";
   }
 
   if(m_jobTypeHasBeenSet)
@@ -55,10 +56,10 @@ Aws::String UpdateJobRequest::SerializePayload() const
 
   if(m_aPIVersionHasBeenSet)
   {
-    ss << "APIVersion=" << StringUtils::URLEncode(m_aPIVersion.c_str()) << "&";
+    ss << "APIVersion=" << StringUtils::URLEncoded(m_aPIVersion) << "&";
   }
 
   ss << "Version=2010-06-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
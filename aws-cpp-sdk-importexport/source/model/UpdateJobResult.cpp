@@ -42,7 +42,7 @@ UpdateJobResult& UpdateJobResult::operator =(const AmazonWebServiceResult<XmlDoc
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "UpdateJobResult")
+  if (rootNode.GetNameView() != "UpdateJobResult")
   {
     resultNode = rootNode.FirstChild("UpdateJobResult");
   }
@@ -52,12 +52,12 @@ UpdateJobResult& UpdateJobResult::operator =(const AmazonWebServiceResult<XmlDoc
     XmlNode successNode = resultNode.FirstChild("Success");
     if(!successNode.IsNull())
     {
-      m_success = StringUtils::ConvertToBool(StringUtils::Trim(successNode.GetText().c_str()).c_str());
+      m_success = StringUtils::ConvertToBool(successNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode warningMessageNode = resultNode.FirstChild("WarningMessage");
     if(!warningMessageNode.IsNull())
     {
-      m_warningMessage = StringUtils::Trim(warningMessageNode.GetText().c_str());
+      m_warningMessage = warningMessageNode.GetTextView().Trim().ToString();
     }
     XmlNode artifactListNode = resultNode.FirstChild("ArtifactList");
     if(!artifactListNode.IsNull())
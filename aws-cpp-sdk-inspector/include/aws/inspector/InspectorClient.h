@@ -57,6 +57,9 @@
 #include <aws/inspector/model/UpdateApplicationResult.h>
 #include <aws/inspector/model/UpdateAssessmentResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -306,6 +309,18 @@ namespace Model
          */
         virtual void AddAttributesToFindingsAsync(const Model::AddAttributesToFindingsRequest& request, const AddAttributesToFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddAttributesToFindingsCallable(const Model::AddAttributesToFindingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddAttributesToFindingsOutcomeCallable AddAttributesToFindingsCallable(Model::AddAttributesToFindingsRequest&& request) const;
+
+        /**
+         * Same as AddAttributesToFindingsAsync(const Model::AddAttributesToFindingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddAttributesToFindingsAsync(Model::AddAttributesToFindingsRequest&& request, const AddAttributesToFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches the rules package specified by the rules package ARN to the
          * assessment specified by the assessment ARN.</p>
@@ -328,6 +343,18 @@ namespace Model
          */
         virtual void AttachAssessmentAndRulesPackageAsync(const Model::AttachAssessmentAndRulesPackageRequest& request, const AttachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachAssessmentAndRulesPackageCallable(const Model::AttachAssessmentAndRulesPackageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachAssessmentAndRulesPackageOutcomeCallable AttachAssessmentAndRulesPackageCallable(Model::AttachAssessmentAndRulesPackageRequest&& request) const;
+
+        /**
+         * Same as AttachAssessmentAndRulesPackageAsync(const Model::AttachAssessmentAndRulesPackageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachAssessmentAndRulesPackageAsync(Model::AttachAssessmentAndRulesPackageRequest&& request, const AttachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new application using the resource group ARN generated by
          * <a>CreateResourceGroup</a>. You can create up to 50 applications per AWS
@@ -362,6 +389,18 @@ namespace Model
          */
         virtual void CreateApplicationAsync(const Model::CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateApplicationCallable(const Model::CreateApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateApplicationOutcomeCallable CreateApplicationCallable(Model::CreateApplicationRequest&& request) const;
+
+        /**
+         * Same as CreateApplicationAsync(const Model::CreateApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateApplicationAsync(Model::CreateApplicationRequest&& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an assessment for the application specified by the application ARN.
          * You can create up to 500 assessments per AWS account.</p>
@@ -384,6 +423,18 @@ namespace Model
          */
         virtual void CreateAssessmentAsync(const Model::CreateAssessmentRequest& request, const CreateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAssessmentCallable(const Model::CreateAssessmentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateAssessmentOutcomeCallable CreateAssessmentCallable(Model::CreateAssessmentRequest&& request) const;
+
+        /**
+         * Same as CreateAssessmentAsync(const Model::CreateAssessmentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateAssessmentAsync(Model::CreateAssessmentRequest&& request, const CreateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a resource group using the specified set of tags (key and value
          * pairs) that are used to select the EC2 instances to be included in an Inspector
@@ -412,6 +463,18 @@ namespace Model
          */
         virtual void CreateResourceGroupAsync(const Model::CreateResourceGroupRequest& request, const CreateResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateResourceGroupCallable(const Model::CreateResourceGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateResourceGroupOutcomeCallable CreateResourceGroupCallable(Model::CreateResourceGroupRequest&& request) const;
+
+        /**
+         * Same as CreateResourceGroupAsync(const Model::CreateResourceGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateResourceGroupAsync(Model::CreateResourceGroupRequest&& request, const CreateResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the application specified by the application ARN.</p>
          */
@@ -431,6 +494,18 @@ namespace Model
          */
         virtual void DeleteApplicationAsync(const Model::DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteApplicationCallable(const Model::DeleteApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteApplicationOutcomeCallable DeleteApplicationCallable(Model::DeleteApplicationRequest&& request) const;
+
+        /**
+         * Same as DeleteApplicationAsync(const Model::DeleteApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteApplicationAsync(Model::DeleteApplicationRequest&& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the assessment specified by the assessment ARN.</p>
          */
@@ -450,6 +525,18 @@ namespace Model
          */
         virtual void DeleteAssessmentAsync(const Model::DeleteAssessmentRequest& request, const DeleteAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAssessmentCallable(const Model::DeleteAssessmentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteAssessmentOutcomeCallable DeleteAssessmentCallable(Model::DeleteAssessmentRequest&& request) const;
+
+        /**
+         * Same as DeleteAssessmentAsync(const Model::DeleteAssessmentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteAssessmentAsync(Model::DeleteAssessmentRequest&& request, const DeleteAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the assessment run specified by the run ARN.</p>
          */
@@ -469,6 +556,18 @@ namespace Model
          */
         virtual void DeleteRunAsync(const Model::DeleteRunRequest& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRunCallable(const Model::DeleteRunRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRunOutcomeCallable DeleteRunCallable(Model::DeleteRunRequest&& request) const;
+
+        /**
+         * Same as DeleteRunAsync(const Model::DeleteRunRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRunAsync(Model::DeleteRunRequest&& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the application specified by the application ARN.</p>
          */
@@ -488,6 +587,18 @@ namespace Model
          */
         virtual void DescribeApplicationAsync(const Model::DescribeApplicationRequest& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeApplicationCallable(const Model::DescribeApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeApplicationOutcomeCallable DescribeApplicationCallable(Model::DescribeApplicationRequest&& request) const;
+
+        /**
+         * Same as DescribeApplicationAsync(const Model::DescribeApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeApplicationAsync(Model::DescribeApplicationRequest&& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the assessment specified by the assessment ARN.</p>
          */
@@ -507,6 +618,18 @@ namespace Model
          */
         virtual void DescribeAssessmentAsync(const Model::DescribeAssessmentRequest& request, const DescribeAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAssessmentCallable(const Model::DescribeAssessmentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAssessmentOutcomeCallable DescribeAssessmentCallable(Model::DescribeAssessmentRequest&& request) const;
+
+        /**
+         * Same as DescribeAssessmentAsync(const Model::DescribeAssessmentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAssessmentAsync(Model::DescribeAssessmentRequest&& request, const DescribeAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the IAM role that enables Inspector to access your AWS account.</p>
          */
@@ -544,6 +667,18 @@ namespace Model
          */
         virtual void DescribeFindingAsync(const Model::DescribeFindingRequest& request, const DescribeFindingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFindingCallable(const Model::DescribeFindingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeFindingOutcomeCallable DescribeFindingCallable(Model::DescribeFindingRequest&& request) const;
+
+        /**
+         * Same as DescribeFindingAsync(const Model::DescribeFindingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeFindingAsync(Model::DescribeFindingRequest&& request, const DescribeFindingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the resource group specified by the resource group ARN.</p>
          */
@@ -563,6 +698,18 @@ namespace Model
          */
         virtual void DescribeResourceGroupAsync(const Model::DescribeResourceGroupRequest& request, const DescribeResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeResourceGroupCallable(const Model::DescribeResourceGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeResourceGroupOutcomeCallable DescribeResourceGroupCallable(Model::DescribeResourceGroupRequest&& request) const;
+
+        /**
+         * Same as DescribeResourceGroupAsync(const Model::DescribeResourceGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeResourceGroupAsync(Model::DescribeResourceGroupRequest&& request, const DescribeResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the rules package specified by the rules package ARN.</p>
          */
@@ -582,6 +729,18 @@ namespace Model
          */
         virtual void DescribeRulesPackageAsync(const Model::DescribeRulesPackageRequest& request, const DescribeRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRulesPackageCallable(const Model::DescribeRulesPackageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeRulesPackageOutcomeCallable DescribeRulesPackageCallable(Model::DescribeRulesPackageRequest&& request) const;
+
+        /**
+         * Same as DescribeRulesPackageAsync(const Model::DescribeRulesPackageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeRulesPackageAsync(Model::DescribeRulesPackageRequest&& request, const DescribeRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the assessment run specified by the run ARN.</p>
          */
@@ -601,6 +760,18 @@ namespace Model
          */
         virtual void DescribeRunAsync(const Model::DescribeRunRequest& request, const DescribeRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRunCallable(const Model::DescribeRunRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeRunOutcomeCallable DescribeRunCallable(Model::DescribeRunRequest&& request) const;
+
+        /**
+         * Same as DescribeRunAsync(const Model::DescribeRunRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeRunAsync(Model::DescribeRunRequest&& request, const DescribeRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches the rules package specified by the rules package ARN from the
          * assessment specified by the assessment ARN.</p>
@@ -623,6 +794,18 @@ namespace Model
          */
         virtual void DetachAssessmentAndRulesPackageAsync(const Model::DetachAssessmentAndRulesPackageRequest& request, const DetachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachAssessmentAndRulesPackageCallable(const Model::DetachAssessmentAndRulesPackageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachAssessmentAndRulesPackageOutcomeCallable DetachAssessmentAndRulesPackageCallable(Model::DetachAssessmentAndRulesPackageRequest&& request) const;
+
+        /**
+         * Same as DetachAssessmentAndRulesPackageAsync(const Model::DetachAssessmentAndRulesPackageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachAssessmentAndRulesPackageAsync(Model::DetachAssessmentAndRulesPackageRequest&& request, const DetachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the metadata about the telemetry (application behavioral data) for
          * the assessment specified by the assessment ARN.</p>
@@ -645,6 +828,18 @@ namespace Model
          */
         virtual void GetAssessmentTelemetryAsync(const Model::GetAssessmentTelemetryRequest& request, const GetAssessmentTelemetryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAssessmentTelemetryCallable(const Model::GetAssessmentTelemetryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetAssessmentTelemetryOutcomeCallable GetAssessmentTelemetryCallable(Model::GetAssessmentTelemetryRequest&& request) const;
+
+        /**
+         * Same as GetAssessmentTelemetryAsync(const Model::GetAssessmentTelemetryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetAssessmentTelemetryAsync(Model::GetAssessmentTelemetryRequest&& request, const GetAssessmentTelemetryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the ARNs of the applications within this AWS account. For more
          * information about applications, see <a
@@ -673,6 +868,18 @@ namespace Model
          */
         virtual void ListApplicationsAsync(const Model::ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListApplicationsCallable(const Model::ListApplicationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListApplicationsOutcomeCallable ListApplicationsCallable(Model::ListApplicationsRequest&& request) const;
+
+        /**
+         * Same as ListApplicationsAsync(const Model::ListApplicationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListApplicationsAsync(Model::ListApplicationsRequest&& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the agents of the assessment specified by the assessment ARN.</p>
          */
@@ -692,6 +899,18 @@ namespace Model
          */
         virtual void ListAssessmentAgentsAsync(const Model::ListAssessmentAgentsRequest& request, const ListAssessmentAgentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAssessmentAgentsCallable(const Model::ListAssessmentAgentsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAssessmentAgentsOutcomeCallable ListAssessmentAgentsCallable(Model::ListAssessmentAgentsRequest&& request) const;
+
+        /**
+         * Same as ListAssessmentAgentsAsync(const Model::ListAssessmentAgentsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAssessmentAgentsAsync(Model::ListAssessmentAgentsRequest&& request, const ListAssessmentAgentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the assessments corresponding to applications specified by the
          * applications' ARNs.</p>
@@ -714,6 +933,18 @@ namespace Model
          */
         virtual void ListAssessmentsAsync(const Model::ListAssessmentsRequest& request, const ListAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAssessmentsCallable(const Model::ListAssessmentsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAssessmentsOutcomeCallable ListAssessmentsCallable(Model::ListAssessmentsRequest&& request) const;
+
+        /**
+         * Same as ListAssessmentsAsync(const Model::ListAssessmentsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAssessmentsAsync(Model::ListAssessmentsRequest&& request, const ListAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the assessments attached to the rules package specified by the rules
          * package ARN.</p>
@@ -736,6 +967,18 @@ namespace Model
          */
         virtual void ListAttachedAssessmentsAsync(const Model::ListAttachedAssessmentsRequest& request, const ListAttachedAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAttachedAssessmentsCallable(const Model::ListAttachedAssessmentsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAttachedAssessmentsOutcomeCallable ListAttachedAssessmentsCallable(Model::ListAttachedAssessmentsRequest&& request) const;
+
+        /**
+         * Same as ListAttachedAssessmentsAsync(const Model::ListAttachedAssessmentsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAttachedAssessmentsAsync(Model::ListAttachedAssessmentsRequest&& request, const ListAttachedAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the rules packages attached to the assessment specified by the
          * assessment ARN.</p>
@@ -758,6 +1001,18 @@ namespace Model
          */
         virtual void ListAttachedRulesPackagesAsync(const Model::ListAttachedRulesPackagesRequest& request, const ListAttachedRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAttachedRulesPackagesCallable(const Model::ListAttachedRulesPackagesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAttachedRulesPackagesOutcomeCallable ListAttachedRulesPackagesCallable(Model::ListAttachedRulesPackagesRequest&& request) const;
+
+        /**
+         * Same as ListAttachedRulesPackagesAsync(const Model::ListAttachedRulesPackagesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAttachedRulesPackagesAsync(Model::ListAttachedRulesPackagesRequest&& request, const ListAttachedRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists findings generated by the assessment run specified by the run ARNs.</p>
          */
@@ -777,6 +1032,18 @@ namespace Model
          */
         virtual void ListFindingsAsync(const Model::ListFindingsRequest& request, const ListFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListFindingsCallable(const Model::ListFindingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListFindingsOutcomeCallable ListFindingsCallable(Model::ListFindingsRequest&& request) const;
+
+        /**
+         * Same as ListFindingsAsync(const Model::ListFindingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListFindingsAsync(Model::ListFindingsRequest&& request, const ListFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all available Inspector rules packages.</p>
          */
@@ -796,6 +1063,18 @@ namespace Model
          */
         virtual void ListRulesPackagesAsync(const Model::ListRulesPackagesRequest& request, const ListRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRulesPackagesCallable(const Model::ListRulesPackagesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListRulesPackagesOutcomeCallable ListRulesPackagesCallable(Model::ListRulesPackagesRequest&& request) const;
+
+        /**
+         * Same as ListRulesPackagesAsync(const Model::ListRulesPackagesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListRulesPackagesAsync(Model::ListRulesPackagesRequest&& request, const ListRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the assessment runs associated with the assessments specified by the
          * assessment ARNs.</p>
@@ -818,6 +1097,18 @@ namespace Model
          */
         virtual void ListRunsAsync(const Model::ListRunsRequest& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRunsCallable(const Model::ListRunsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListRunsOutcomeCallable ListRunsCallable(Model::ListRunsRequest&& request) const;
+
+        /**
+         * Same as ListRunsAsync(const Model::ListRunsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListRunsAsync(Model::ListRunsRequest&& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all tags associated with a resource.</p>
          */
@@ -837,6 +1128,18 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourceCallable(const Model::ListTagsForResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(Model::ListTagsForResourceRequest&& request) const;
+
+        /**
+         * Same as ListTagsForResourceAsync(const Model::ListTagsForResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsForResourceAsync(Model::ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Translates a textual identifier into a user-readable text in a specified
          * locale.</p>
@@ -859,6 +1162,18 @@ namespace Model
          */
         virtual void LocalizeTextAsync(const Model::LocalizeTextRequest& request, const LocalizeTextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as LocalizeTextCallable(const Model::LocalizeTextRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::LocalizeTextOutcomeCallable LocalizeTextCallable(Model::LocalizeTextRequest&& request) const;
+
+        /**
+         * Same as LocalizeTextAsync(const Model::LocalizeTextRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void LocalizeTextAsync(Model::LocalizeTextRequest&& request, const LocalizeTextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Previews the agents installed on the EC2 instances that are included in the
          * application created with the specified resource group.</p>
@@ -881,6 +1196,18 @@ namespace Model
          */
         virtual void PreviewAgentsForResourceGroupAsync(const Model::PreviewAgentsForResourceGroupRequest& request, const PreviewAgentsForResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PreviewAgentsForResourceGroupCallable(const Model::PreviewAgentsForResourceGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PreviewAgentsForResourceGroupOutcomeCallable PreviewAgentsForResourceGroupCallable(Model::PreviewAgentsForResourceGroupRequest&& request) const;
+
+        /**
+         * Same as PreviewAgentsForResourceGroupAsync(const Model::PreviewAgentsForResourceGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PreviewAgentsForResourceGroupAsync(Model::PreviewAgentsForResourceGroupRequest&& request, const PreviewAgentsForResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Register the role that Inspector uses to list your EC2 instances during the
          * assessment.</p>
@@ -903,6 +1230,18 @@ namespace Model
          */
         virtual void RegisterCrossAccountAccessRoleAsync(const Model::RegisterCrossAccountAccessRoleRequest& request, const RegisterCrossAccountAccessRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterCrossAccountAccessRoleCallable(const Model::RegisterCrossAccountAccessRoleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterCrossAccountAccessRoleOutcomeCallable RegisterCrossAccountAccessRoleCallable(Model::RegisterCrossAccountAccessRoleRequest&& request) const;
+
+        /**
+         * Same as RegisterCrossAccountAccessRoleAsync(const Model::RegisterCrossAccountAccessRoleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterCrossAccountAccessRoleAsync(Model::RegisterCrossAccountAccessRoleRequest&& request, const RegisterCrossAccountAccessRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the entire attribute (key and value pair) from the findings specified
          * by the finding ARNs where an attribute with the specified key exists.</p>
@@ -925,6 +1264,18 @@ namespace Model
          */
         virtual void RemoveAttributesFromFindingsAsync(const Model::RemoveAttributesFromFindingsRequest& request, const RemoveAttributesFromFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveAttributesFromFindingsCallable(const Model::RemoveAttributesFromFindingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveAttributesFromFindingsOutcomeCallable RemoveAttributesFromFindingsCallable(Model::RemoveAttributesFromFindingsRequest&& request) const;
+
+        /**
+         * Same as RemoveAttributesFromFindingsAsync(const Model::RemoveAttributesFromFindingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveAttributesFromFindingsAsync(Model::RemoveAttributesFromFindingsRequest&& request, const RemoveAttributesFromFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts the analysis of the application’s behavior against selected rule
          * packages for the assessment specified by the assessment ARN.</p>
@@ -947,6 +1298,18 @@ namespace Model
          */
         virtual void RunAssessmentAsync(const Model::RunAssessmentRequest& request, const RunAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RunAssessmentCallable(const Model::RunAssessmentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RunAssessmentOutcomeCallable RunAssessmentCallable(Model::RunAssessmentRequest&& request) const;
+
+        /**
+         * Same as RunAssessmentAsync(const Model::RunAssessmentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RunAssessmentAsync(Model::RunAssessmentRequest&& request, const RunAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets tags (key and value pairs) to the assessment specified by the assessment
          * ARN.</p>
@@ -969,6 +1332,18 @@ namespace Model
          */
         virtual void SetTagsForResourceAsync(const Model::SetTagsForResourceRequest& request, const SetTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetTagsForResourceCallable(const Model::SetTagsForResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetTagsForResourceOutcomeCallable SetTagsForResourceCallable(Model::SetTagsForResourceRequest&& request) const;
+
+        /**
+         * Same as SetTagsForResourceAsync(const Model::SetTagsForResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetTagsForResourceAsync(Model::SetTagsForResourceRequest&& request, const SetTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts data collection for the assessment specified by the assessment ARN.
          * For this API to function properly, you must not exceed the limit of running up
@@ -994,6 +1369,18 @@ namespace Model
          */
         virtual void StartDataCollectionAsync(const Model::StartDataCollectionRequest& request, const StartDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartDataCollectionCallable(const Model::StartDataCollectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StartDataCollectionOutcomeCallable StartDataCollectionCallable(Model::StartDataCollectionRequest&& request) const;
+
+        /**
+         * Same as StartDataCollectionAsync(const Model::StartDataCollectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StartDataCollectionAsync(Model::StartDataCollectionRequest&& request, const StartDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stop data collection for the assessment specified by the assessment ARN.</p>
          */
@@ -1013,6 +1400,18 @@ namespace Model
          */
         virtual void StopDataCollectionAsync(const Model::StopDataCollectionRequest& request, const StopDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopDataCollectionCallable(const Model::StopDataCollectionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StopDataCollectionOutcomeCallable StopDataCollectionCallable(Model::StopDataCollectionRequest&& request) const;
+
+        /**
+         * Same as StopDataCollectionAsync(const Model::StopDataCollectionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StopDataCollectionAsync(Model::StopDataCollectionRequest&& request, const StopDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates application specified by the application ARN.</p>
          */
@@ -1032,6 +1431,18 @@ namespace Model
          */
         virtual void UpdateApplicationAsync(const Model::UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateApplicationCallable(const Model::UpdateApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateApplicationOutcomeCallable UpdateApplicationCallable(Model::UpdateApplicationRequest&& request) const;
+
+        /**
+         * Same as UpdateApplicationAsync(const Model::UpdateApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateApplicationAsync(Model::UpdateApplicationRequest&& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the assessment specified by the assessment ARN.</p>
          */
@@ -1051,6 +1462,245 @@ namespace Model
          */
         virtual void UpdateAssessmentAsync(const Model::UpdateAssessmentRequest& request, const UpdateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAssessmentCallable(const Model::UpdateAssessmentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateAssessmentOutcomeCallable UpdateAssessmentCallable(Model::UpdateAssessmentRequest&& request) const;
+
+        /**
+         * Same as UpdateAssessmentAsync(const Model::UpdateAssessmentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateAssessmentAsync(Model::UpdateAssessmentRequest&& request, const UpdateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListApplications(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<InspectorClient, Model::ListApplicationsRequest, Model::ListApplicationsOutcome> ListApplicationsPaginator(const Model::ListApplicationsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListAssessmentAgents(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<InspectorClient, Model::ListAssessmentAgentsRequest, Model::ListAssessmentAgentsOutcome> ListAssessmentAgentsPaginator(const Model::ListAssessmentAgentsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListAssessments(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<InspectorClient, Model::ListAssessmentsRequest, Model::ListAssessmentsOutcome> ListAssessmentsPaginator(const Model::ListAssessmentsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListAttachedAssessments(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<InspectorClient, Model::ListAttachedAssessmentsRequest, Model::ListAttachedAssessmentsOutcome> ListAttachedAssessmentsPaginator(const Model::ListAttachedAssessmentsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListAttachedRulesPackages(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<InspectorClient, Model::ListAttachedRulesPackagesRequest, Model::ListAttachedRulesPackagesOutcome> ListAttachedRulesPackagesPaginator(const Model::ListAttachedRulesPackagesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListFindings(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<InspectorClient, Model::ListFindingsRequest, Model::ListFindingsOutcome> ListFindingsPaginator(const Model::ListFindingsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListRulesPackages(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<InspectorClient, Model::ListRulesPackagesRequest, Model::ListRulesPackagesOutcome> ListRulesPackagesPaginator(const Model::ListRulesPackagesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListRuns(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<InspectorClient, Model::ListRunsRequest, Model::ListRunsOutcome> ListRunsPaginator(const Model::ListRunsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through PreviewAgentsForResourceGroup(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<InspectorClient, Model::PreviewAgentsForResourceGroupRequest, Model::PreviewAgentsForResourceGroupOutcome> PreviewAgentsForResourceGroupPaginator(const Model::PreviewAgentsForResourceGroupRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddAttributesToFindings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::AddAttributesToFindingsRequest, Model::AddAttributesToFindingsOutcome> AddAttributesToFindingsAwaitable(Model::AddAttributesToFindingsRequest request) const;
+
+        /**
+         * co_await-able form of AttachAssessmentAndRulesPackage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::AttachAssessmentAndRulesPackageRequest, Model::AttachAssessmentAndRulesPackageOutcome> AttachAssessmentAndRulesPackageAwaitable(Model::AttachAssessmentAndRulesPackageRequest request) const;
+
+        /**
+         * co_await-able form of CreateApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::CreateApplicationRequest, Model::CreateApplicationOutcome> CreateApplicationAwaitable(Model::CreateApplicationRequest request) const;
+
+        /**
+         * co_await-able form of CreateAssessment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::CreateAssessmentRequest, Model::CreateAssessmentOutcome> CreateAssessmentAwaitable(Model::CreateAssessmentRequest request) const;
+
+        /**
+         * co_await-able form of CreateResourceGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::CreateResourceGroupRequest, Model::CreateResourceGroupOutcome> CreateResourceGroupAwaitable(Model::CreateResourceGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::DeleteApplicationRequest, Model::DeleteApplicationOutcome> DeleteApplicationAwaitable(Model::DeleteApplicationRequest request) const;
+
+        /**
+         * co_await-able form of DeleteAssessment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::DeleteAssessmentRequest, Model::DeleteAssessmentOutcome> DeleteAssessmentAwaitable(Model::DeleteAssessmentRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRun(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::DeleteRunRequest, Model::DeleteRunOutcome> DeleteRunAwaitable(Model::DeleteRunRequest request) const;
+
+        /**
+         * co_await-able form of DescribeApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::DescribeApplicationRequest, Model::DescribeApplicationOutcome> DescribeApplicationAwaitable(Model::DescribeApplicationRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAssessment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::DescribeAssessmentRequest, Model::DescribeAssessmentOutcome> DescribeAssessmentAwaitable(Model::DescribeAssessmentRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCrossAccountAccessRole(): the operation runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, void, Model::DescribeCrossAccountAccessRoleOutcome> DescribeCrossAccountAccessRoleAwaitable() const;
+
+        /**
+         * co_await-able form of DescribeFinding(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::DescribeFindingRequest, Model::DescribeFindingOutcome> DescribeFindingAwaitable(Model::DescribeFindingRequest request) const;
+
+        /**
+         * co_await-able form of DescribeResourceGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::DescribeResourceGroupRequest, Model::DescribeResourceGroupOutcome> DescribeResourceGroupAwaitable(Model::DescribeResourceGroupRequest request) const;
+
+        /**
+         * co_await-able form of DescribeRulesPackage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::DescribeRulesPackageRequest, Model::DescribeRulesPackageOutcome> DescribeRulesPackageAwaitable(Model::DescribeRulesPackageRequest request) const;
+
+        /**
+         * co_await-able form of DescribeRun(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::DescribeRunRequest, Model::DescribeRunOutcome> DescribeRunAwaitable(Model::DescribeRunRequest request) const;
+
+        /**
+         * co_await-able form of DetachAssessmentAndRulesPackage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::DetachAssessmentAndRulesPackageRequest, Model::DetachAssessmentAndRulesPackageOutcome> DetachAssessmentAndRulesPackageAwaitable(Model::DetachAssessmentAndRulesPackageRequest request) const;
+
+        /**
+         * co_await-able form of GetAssessmentTelemetry(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::GetAssessmentTelemetryRequest, Model::GetAssessmentTelemetryOutcome> GetAssessmentTelemetryAwaitable(Model::GetAssessmentTelemetryRequest request) const;
+
+        /**
+         * co_await-able form of ListApplications(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::ListApplicationsRequest, Model::ListApplicationsOutcome> ListApplicationsAwaitable(Model::ListApplicationsRequest request) const;
+
+        /**
+         * co_await-able form of ListAssessmentAgents(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::ListAssessmentAgentsRequest, Model::ListAssessmentAgentsOutcome> ListAssessmentAgentsAwaitable(Model::ListAssessmentAgentsRequest request) const;
+
+        /**
+         * co_await-able form of ListAssessments(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::ListAssessmentsRequest, Model::ListAssessmentsOutcome> ListAssessmentsAwaitable(Model::ListAssessmentsRequest request) const;
+
+        /**
+         * co_await-able form of ListAttachedAssessments(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::ListAttachedAssessmentsRequest, Model::ListAttachedAssessmentsOutcome> ListAttachedAssessmentsAwaitable(Model::ListAttachedAssessmentsRequest request) const;
+
+        /**
+         * co_await-able form of ListAttachedRulesPackages(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::ListAttachedRulesPackagesRequest, Model::ListAttachedRulesPackagesOutcome> ListAttachedRulesPackagesAwaitable(Model::ListAttachedRulesPackagesRequest request) const;
+
+        /**
+         * co_await-able form of ListFindings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::ListFindingsRequest, Model::ListFindingsOutcome> ListFindingsAwaitable(Model::ListFindingsRequest request) const;
+
+        /**
+         * co_await-able form of ListRulesPackages(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::ListRulesPackagesRequest, Model::ListRulesPackagesOutcome> ListRulesPackagesAwaitable(Model::ListRulesPackagesRequest request) const;
+
+        /**
+         * co_await-able form of ListRuns(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::ListRunsRequest, Model::ListRunsOutcome> ListRunsAwaitable(Model::ListRunsRequest request) const;
+
+        /**
+         * co_await-able form of ListTagsForResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::ListTagsForResourceRequest, Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(Model::ListTagsForResourceRequest request) const;
+
+        /**
+         * co_await-able form of LocalizeText(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::LocalizeTextRequest, Model::LocalizeTextOutcome> LocalizeTextAwaitable(Model::LocalizeTextRequest request) const;
+
+        /**
+         * co_await-able form of PreviewAgentsForResourceGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::PreviewAgentsForResourceGroupRequest, Model::PreviewAgentsForResourceGroupOutcome> PreviewAgentsForResourceGroupAwaitable(Model::PreviewAgentsForResourceGroupRequest request) const;
+
+        /**
+         * co_await-able form of RegisterCrossAccountAccessRole(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::RegisterCrossAccountAccessRoleRequest, Model::RegisterCrossAccountAccessRoleOutcome> RegisterCrossAccountAccessRoleAwaitable(Model::RegisterCrossAccountAccessRoleRequest request) const;
+
+        /**
+         * co_await-able form of RemoveAttributesFromFindings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::RemoveAttributesFromFindingsRequest, Model::RemoveAttributesFromFindingsOutcome> RemoveAttributesFromFindingsAwaitable(Model::RemoveAttributesFromFindingsRequest request) const;
+
+        /**
+         * co_await-able form of RunAssessment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::RunAssessmentRequest, Model::RunAssessmentOutcome> RunAssessmentAwaitable(Model::RunAssessmentRequest request) const;
+
+        /**
+         * co_await-able form of SetTagsForResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::SetTagsForResourceRequest, Model::SetTagsForResourceOutcome> SetTagsForResourceAwaitable(Model::SetTagsForResourceRequest request) const;
+
+        /**
+         * co_await-able form of StartDataCollection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::StartDataCollectionRequest, Model::StartDataCollectionOutcome> StartDataCollectionAwaitable(Model::StartDataCollectionRequest request) const;
+
+        /**
+         * co_await-able form of StopDataCollection(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::StopDataCollectionRequest, Model::StopDataCollectionOutcome> StopDataCollectionAwaitable(Model::StopDataCollectionRequest request) const;
+
+        /**
+         * co_await-able form of UpdateApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::UpdateApplicationRequest, Model::UpdateApplicationOutcome> UpdateApplicationAwaitable(Model::UpdateApplicationRequest request) const;
+
+        /**
+         * co_await-able form of UpdateAssessment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<InspectorClient, Model::UpdateAssessmentRequest, Model::UpdateAssessmentOutcome> UpdateAssessmentAwaitable(Model::UpdateAssessmentRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
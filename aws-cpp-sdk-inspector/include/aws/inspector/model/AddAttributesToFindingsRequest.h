@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AddAttributesToFindingsRequest();
+    inline const char* GetServiceRequestName() const override { return "AddAttributesToFindings"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     AttachAssessmentAndRulesPackageRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachAssessmentAndRulesPackage"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
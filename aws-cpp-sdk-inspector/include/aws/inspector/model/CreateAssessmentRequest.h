@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateAssessmentRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateAssessment"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
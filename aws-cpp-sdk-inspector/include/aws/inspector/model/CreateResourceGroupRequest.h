@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateResourceGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateResourceGroup"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
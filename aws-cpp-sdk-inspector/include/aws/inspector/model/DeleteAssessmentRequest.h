@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteAssessmentRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteAssessment"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeApplicationRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeApplication"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
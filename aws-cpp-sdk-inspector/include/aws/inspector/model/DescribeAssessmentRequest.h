@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeAssessmentRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAssessment"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeFindingRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeFinding"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
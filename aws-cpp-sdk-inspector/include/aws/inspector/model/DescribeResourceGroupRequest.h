@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeResourceGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeResourceGroup"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeRulesPackageRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeRulesPackage"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
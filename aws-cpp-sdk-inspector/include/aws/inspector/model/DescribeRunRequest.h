@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeRunRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeRun"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
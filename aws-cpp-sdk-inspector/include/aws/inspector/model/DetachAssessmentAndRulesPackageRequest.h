@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DetachAssessmentAndRulesPackageRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachAssessmentAndRulesPackage"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetAssessmentTelemetryRequest();
+    inline const char* GetServiceRequestName() const override { return "GetAssessmentTelemetry"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListApplicationsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListApplications"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListAssessmentAgentsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListAssessmentAgents"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
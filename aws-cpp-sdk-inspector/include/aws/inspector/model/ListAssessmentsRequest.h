@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListAssessmentsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListAssessments"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListAttachedAssessmentsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListAttachedAssessments"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListAttachedRulesPackagesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListAttachedRulesPackages"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListFindingsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListFindings"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
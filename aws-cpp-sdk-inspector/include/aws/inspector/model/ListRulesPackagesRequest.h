@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListRulesPackagesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListRulesPackages"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
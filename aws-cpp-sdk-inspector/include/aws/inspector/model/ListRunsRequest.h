@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListRunsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListRuns"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     LocalizeTextRequest();
+    inline const char* GetServiceRequestName() const override { return "LocalizeText"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
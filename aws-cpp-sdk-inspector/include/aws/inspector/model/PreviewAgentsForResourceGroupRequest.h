@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     PreviewAgentsForResourceGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "PreviewAgentsForResourceGroup"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
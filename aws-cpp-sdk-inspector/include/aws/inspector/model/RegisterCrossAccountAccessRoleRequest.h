@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RegisterCrossAccountAccessRoleRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterCrossAccountAccessRole"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
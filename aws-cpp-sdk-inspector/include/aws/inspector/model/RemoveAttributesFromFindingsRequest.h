@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RemoveAttributesFromFindingsRequest();
+    inline const char* GetServiceRequestName() const override { return "RemoveAttributesFromFindings"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RunAssessmentRequest();
+    inline const char* GetServiceRequestName() const override { return "RunAssessment"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
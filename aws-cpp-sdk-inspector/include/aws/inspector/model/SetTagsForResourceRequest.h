@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetTagsForResourceRequest();
+    inline const char* GetServiceRequestName() const override { return "SetTagsForResource"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
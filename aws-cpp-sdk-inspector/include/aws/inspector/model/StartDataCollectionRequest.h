@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     StartDataCollectionRequest();
+    inline const char* GetServiceRequestName() const override { return "StartDataCollection"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     StopDataCollectionRequest();
+    inline const char* GetServiceRequestName() const override { return "StopDataCollection"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
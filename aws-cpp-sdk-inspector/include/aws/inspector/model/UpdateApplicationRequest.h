@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateApplicationRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateApplication"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateAssessmentRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateAssessment"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -144,7 +144,7 @@ AddAttributesToFindingsOutcome InspectorClient::AddAttributesToFindings(const Ad
 
 AddAttributesToFindingsOutcomeCallable InspectorClient::AddAttributesToFindingsCallable(const AddAttributesToFindingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddAttributesToFindings(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddAttributesToFindings(request); } );
 }
 
 void InspectorClient::AddAttributesToFindingsAsync(const AddAttributesToFindingsRequest& request, const AddAttributesToFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -152,6 +152,16 @@ void InspectorClient::AddAttributesToFindingsAsync(const AddAttributesToFindings
   m_executor->Submit( [this, request, handler, context](){ this->AddAttributesToFindingsAsyncHelper( request, handler, context ); } );
 }
 
+AddAttributesToFindingsOutcomeCallable InspectorClient::AddAttributesToFindingsCallable(AddAttributesToFindingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::AddAttributesToFindings, this, std::move(request)));
+}
+
+void InspectorClient::AddAttributesToFindingsAsync(AddAttributesToFindingsRequest&& request, const AddAttributesToFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::AddAttributesToFindingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::AddAttributesToFindingsAsyncHelper(const AddAttributesToFindingsRequest& request, const AddAttributesToFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddAttributesToFindings(request), context);
@@ -175,7 +185,7 @@ AttachAssessmentAndRulesPackageOutcome InspectorClient::AttachAssessmentAndRules
 
 AttachAssessmentAndRulesPackageOutcomeCallable InspectorClient::AttachAssessmentAndRulesPackageCallable(const AttachAssessmentAndRulesPackageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachAssessmentAndRulesPackage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachAssessmentAndRulesPackage(request); } );
 }
 
 void InspectorClient::AttachAssessmentAndRulesPackageAsync(const AttachAssessmentAndRulesPackageRequest& request, const AttachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -183,6 +193,16 @@ void InspectorClient::AttachAssessmentAndRulesPackageAsync(const AttachAssessmen
   m_executor->Submit( [this, request, handler, context](){ this->AttachAssessmentAndRulesPackageAsyncHelper( request, handler, context ); } );
 }
 
+AttachAssessmentAndRulesPackageOutcomeCallable InspectorClient::AttachAssessmentAndRulesPackageCallable(AttachAssessmentAndRulesPackageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::AttachAssessmentAndRulesPackage, this, std::move(request)));
+}
+
+void InspectorClient::AttachAssessmentAndRulesPackageAsync(AttachAssessmentAndRulesPackageRequest&& request, const AttachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::AttachAssessmentAndRulesPackageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::AttachAssessmentAndRulesPackageAsyncHelper(const AttachAssessmentAndRulesPackageRequest& request, const AttachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachAssessmentAndRulesPackage(request), context);
@@ -206,7 +226,7 @@ CreateApplicationOutcome InspectorClient::CreateApplication(const CreateApplicat
 
 CreateApplicationOutcomeCallable InspectorClient::CreateApplicationCallable(const CreateApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateApplication(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateApplication(request); } );
 }
 
 void InspectorClient::CreateApplicationAsync(const CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -214,6 +234,16 @@ void InspectorClient::CreateApplicationAsync(const CreateApplicationRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->CreateApplicationAsyncHelper( request, handler, context ); } );
 }
 
+CreateApplicationOutcomeCallable InspectorClient::CreateApplicationCallable(CreateApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::CreateApplication, this, std::move(request)));
+}
+
+void InspectorClient::CreateApplicationAsync(CreateApplicationRequest&& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::CreateApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::CreateApplicationAsyncHelper(const CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateApplication(request), context);
@@ -237,7 +267,7 @@ CreateAssessmentOutcome InspectorClient::CreateAssessment(const CreateAssessment
 
 CreateAssessmentOutcomeCallable InspectorClient::CreateAssessmentCallable(const CreateAssessmentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateAssessment(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateAssessment(request); } );
 }
 
 void InspectorClient::CreateAssessmentAsync(const CreateAssessmentRequest& request, const CreateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -245,6 +275,16 @@ void InspectorClient::CreateAssessmentAsync(const CreateAssessmentRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->CreateAssessmentAsyncHelper( request, handler, context ); } );
 }
 
+CreateAssessmentOutcomeCallable InspectorClient::CreateAssessmentCallable(CreateAssessmentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::CreateAssessment, this, std::move(request)));
+}
+
+void InspectorClient::CreateAssessmentAsync(CreateAssessmentRequest&& request, const CreateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::CreateAssessmentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::CreateAssessmentAsyncHelper(const CreateAssessmentRequest& request, const CreateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateAssessment(request), context);
@@ -268,7 +308,7 @@ CreateResourceGroupOutcome InspectorClient::CreateResourceGroup(const CreateReso
 
 CreateResourceGroupOutcomeCallable InspectorClient::CreateResourceGroupCallable(const CreateResourceGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateResourceGroup(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateResourceGroup(request); } );
 }
 
 void InspectorClient::CreateResourceGroupAsync(const CreateResourceGroupRequest& request, const CreateResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -276,6 +316,16 @@ void InspectorClient::CreateResourceGroupAsync(const CreateResourceGroupRequest&
   m_executor->Submit( [this, request, handler, context](){ this->CreateResourceGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateResourceGroupOutcomeCallable InspectorClient::CreateResourceGroupCallable(CreateResourceGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::CreateResourceGroup, this, std::move(request)));
+}
+
+void InspectorClient::CreateResourceGroupAsync(CreateResourceGroupRequest&& request, const CreateResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::CreateResourceGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::CreateResourceGroupAsyncHelper(const CreateResourceGroupRequest& request, const CreateResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateResourceGroup(request), context);
@@ -299,7 +349,7 @@ DeleteApplicationOutcome InspectorClient::DeleteApplication(const DeleteApplicat
 
 DeleteApplicationOutcomeCallable InspectorClient::DeleteApplicationCallable(const DeleteApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteApplication(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteApplication(request); } );
 }
 
 void InspectorClient::DeleteApplicationAsync(const DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -307,6 +357,16 @@ void InspectorClient::DeleteApplicationAsync(const DeleteApplicationRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DeleteApplicationAsyncHelper( request, handler, context ); } );
 }
 
+DeleteApplicationOutcomeCallable InspectorClient::DeleteApplicationCallable(DeleteApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::DeleteApplication, this, std::move(request)));
+}
+
+void InspectorClient::DeleteApplicationAsync(DeleteApplicationRequest&& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::DeleteApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::DeleteApplicationAsyncHelper(const DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteApplication(request), context);
@@ -330,7 +390,7 @@ DeleteAssessmentOutcome InspectorClient::DeleteAssessment(const DeleteAssessment
 
 DeleteAssessmentOutcomeCallable InspectorClient::DeleteAssessmentCallable(const DeleteAssessmentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteAssessment(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteAssessment(request); } );
 }
 
 void InspectorClient::DeleteAssessmentAsync(const DeleteAssessmentRequest& request, const DeleteAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -338,6 +398,16 @@ void InspectorClient::DeleteAssessmentAsync(const DeleteAssessmentRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DeleteAssessmentAsyncHelper( request, handler, context ); } );
 }
 
+DeleteAssessmentOutcomeCallable InspectorClient::DeleteAssessmentCallable(DeleteAssessmentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::DeleteAssessment, this, std::move(request)));
+}
+
+void InspectorClient::DeleteAssessmentAsync(DeleteAssessmentRequest&& request, const DeleteAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::DeleteAssessmentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::DeleteAssessmentAsyncHelper(const DeleteAssessmentRequest& request, const DeleteAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteAssessment(request), context);
@@ -361,7 +431,7 @@ DeleteRunOutcome InspectorClient::DeleteRun(const DeleteRunRequest& request) con
 
 DeleteRunOutcomeCallable InspectorClient::DeleteRunCallable(const DeleteRunRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRun(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRun(request); } );
 }
 
 void InspectorClient::DeleteRunAsync(const DeleteRunRequest& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -369,6 +439,16 @@ void InspectorClient::DeleteRunAsync(const DeleteRunRequest& request, const Dele
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRunAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRunOutcomeCallable InspectorClient::DeleteRunCallable(DeleteRunRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::DeleteRun, this, std::move(request)));
+}
+
+void InspectorClient::DeleteRunAsync(DeleteRunRequest&& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::DeleteRunAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::DeleteRunAsyncHelper(const DeleteRunRequest& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRun(request), context);
@@ -392,7 +472,7 @@ DescribeApplicationOutcome InspectorClient::DescribeApplication(const DescribeAp
 
 DescribeApplicationOutcomeCallable InspectorClient::DescribeApplicationCallable(const DescribeApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeApplication(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeApplication(request); } );
 }
 
 void InspectorClient::DescribeApplicationAsync(const DescribeApplicationRequest& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -400,6 +480,16 @@ void InspectorClient::DescribeApplicationAsync(const DescribeApplicationRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeApplicationAsyncHelper( request, handler, context ); } );
 }
 
+DescribeApplicationOutcomeCallable InspectorClient::DescribeApplicationCallable(DescribeApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::DescribeApplication, this, std::move(request)));
+}
+
+void InspectorClient::DescribeApplicationAsync(DescribeApplicationRequest&& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::DescribeApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::DescribeApplicationAsyncHelper(const DescribeApplicationRequest& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeApplication(request), context);
@@ -423,7 +513,7 @@ DescribeAssessmentOutcome InspectorClient::DescribeAssessment(const DescribeAsse
 
 DescribeAssessmentOutcomeCallable InspectorClient::DescribeAssessmentCallable(const DescribeAssessmentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAssessment(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAssessment(request); } );
 }
 
 void InspectorClient::DescribeAssessmentAsync(const DescribeAssessmentRequest& request, const DescribeAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -431,6 +521,16 @@ void InspectorClient::DescribeAssessmentAsync(const DescribeAssessmentRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAssessmentAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAssessmentOutcomeCallable InspectorClient::DescribeAssessmentCallable(DescribeAssessmentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::DescribeAssessment, this, std::move(request)));
+}
+
+void InspectorClient::DescribeAssessmentAsync(DescribeAssessmentRequest&& request, const DescribeAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::DescribeAssessmentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::DescribeAssessmentAsyncHelper(const DescribeAssessmentRequest& request, const DescribeAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAssessment(request), context);
@@ -454,7 +554,7 @@ DescribeCrossAccountAccessRoleOutcome InspectorClient::DescribeCrossAccountAcces
 
 DescribeCrossAccountAccessRoleOutcomeCallable InspectorClient::DescribeCrossAccountAccessRoleCallable() const
 {
-  return std::async(std::launch::async, [this](){ return this->DescribeCrossAccountAccessRole(); } );
+  return m_executor->SubmitCallable([this](){ return this->DescribeCrossAccountAccessRole(); } );
 }
 
 void InspectorClient::DescribeCrossAccountAccessRoleAsync(const DescribeCrossAccountAccessRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -485,7 +585,7 @@ DescribeFindingOutcome InspectorClient::DescribeFinding(const DescribeFindingReq
 
 DescribeFindingOutcomeCallable InspectorClient::DescribeFindingCallable(const DescribeFindingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeFinding(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeFinding(request); } );
 }
 
 void InspectorClient::DescribeFindingAsync(const DescribeFindingRequest& request, const DescribeFindingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -493,6 +593,16 @@ void InspectorClient::DescribeFindingAsync(const DescribeFindingRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DescribeFindingAsyncHelper( request, handler, context ); } );
 }
 
+DescribeFindingOutcomeCallable InspectorClient::DescribeFindingCallable(DescribeFindingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::DescribeFinding, this, std::move(request)));
+}
+
+void InspectorClient::DescribeFindingAsync(DescribeFindingRequest&& request, const DescribeFindingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::DescribeFindingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::DescribeFindingAsyncHelper(const DescribeFindingRequest& request, const DescribeFindingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeFinding(request), context);
@@ -516,7 +626,7 @@ DescribeResourceGroupOutcome InspectorClient::DescribeResourceGroup(const Descri
 
 DescribeResourceGroupOutcomeCallable InspectorClient::DescribeResourceGroupCallable(const DescribeResourceGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeResourceGroup(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeResourceGroup(request); } );
 }
 
 void InspectorClient::DescribeResourceGroupAsync(const DescribeResourceGroupRequest& request, const DescribeResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -524,6 +634,16 @@ void InspectorClient::DescribeResourceGroupAsync(const DescribeResourceGroupRequ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeResourceGroupAsyncHelper( request, handler, context ); } );
 }
 
+DescribeResourceGroupOutcomeCallable InspectorClient::DescribeResourceGroupCallable(DescribeResourceGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::DescribeResourceGroup, this, std::move(request)));
+}
+
+void InspectorClient::DescribeResourceGroupAsync(DescribeResourceGroupRequest&& request, const DescribeResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::DescribeResourceGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::DescribeResourceGroupAsyncHelper(const DescribeResourceGroupRequest& request, const DescribeResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeResourceGroup(request), context);
@@ -547,7 +667,7 @@ DescribeRulesPackageOutcome InspectorClient::DescribeRulesPackage(const Describe
 
 DescribeRulesPackageOutcomeCallable InspectorClient::DescribeRulesPackageCallable(const DescribeRulesPackageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeRulesPackage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeRulesPackage(request); } );
 }
 
 void InspectorClient::DescribeRulesPackageAsync(const DescribeRulesPackageRequest& request, const DescribeRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -555,6 +675,16 @@ void InspectorClient::DescribeRulesPackageAsync(const DescribeRulesPackageReques
   m_executor->Submit( [this, request, handler, context](){ this->DescribeRulesPackageAsyncHelper( request, handler, context ); } );
 }
 
+DescribeRulesPackageOutcomeCallable InspectorClient::DescribeRulesPackageCallable(DescribeRulesPackageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::DescribeRulesPackage, this, std::move(request)));
+}
+
+void InspectorClient::DescribeRulesPackageAsync(DescribeRulesPackageRequest&& request, const DescribeRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::DescribeRulesPackageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::DescribeRulesPackageAsyncHelper(const DescribeRulesPackageRequest& request, const DescribeRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeRulesPackage(request), context);
@@ -578,7 +708,7 @@ DescribeRunOutcome InspectorClient::DescribeRun(const DescribeRunRequest& reques
 
 DescribeRunOutcomeCallable InspectorClient::DescribeRunCallable(const DescribeRunRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeRun(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeRun(request); } );
 }
 
 void InspectorClient::DescribeRunAsync(const DescribeRunRequest& request, const DescribeRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -586,6 +716,16 @@ void InspectorClient::DescribeRunAsync(const DescribeRunRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DescribeRunAsyncHelper( request, handler, context ); } );
 }
 
+DescribeRunOutcomeCallable InspectorClient::DescribeRunCallable(DescribeRunRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::DescribeRun, this, std::move(request)));
+}
+
+void InspectorClient::DescribeRunAsync(DescribeRunRequest&& request, const DescribeRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::DescribeRunAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::DescribeRunAsyncHelper(const DescribeRunRequest& request, const DescribeRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeRun(request), context);
@@ -609,7 +749,7 @@ DetachAssessmentAndRulesPackageOutcome InspectorClient::DetachAssessmentAndRules
 
 DetachAssessmentAndRulesPackageOutcomeCallable InspectorClient::DetachAssessmentAndRulesPackageCallable(const DetachAssessmentAndRulesPackageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachAssessmentAndRulesPackage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachAssessmentAndRulesPackage(request); } );
 }
 
 void InspectorClient::DetachAssessmentAndRulesPackageAsync(const DetachAssessmentAndRulesPackageRequest& request, const DetachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -617,6 +757,16 @@ void InspectorClient::DetachAssessmentAndRulesPackageAsync(const DetachAssessmen
   m_executor->Submit( [this, request, handler, context](){ this->DetachAssessmentAndRulesPackageAsyncHelper( request, handler, context ); } );
 }
 
+DetachAssessmentAndRulesPackageOutcomeCallable InspectorClient::DetachAssessmentAndRulesPackageCallable(DetachAssessmentAndRulesPackageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::DetachAssessmentAndRulesPackage, this, std::move(request)));
+}
+
+void InspectorClient::DetachAssessmentAndRulesPackageAsync(DetachAssessmentAndRulesPackageRequest&& request, const DetachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::DetachAssessmentAndRulesPackageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::DetachAssessmentAndRulesPackageAsyncHelper(const DetachAssessmentAndRulesPackageRequest& request, const DetachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachAssessmentAndRulesPackage(request), context);
@@ -640,7 +790,7 @@ GetAssessmentTelemetryOutcome InspectorClient::GetAssessmentTelemetry(const GetA
 
 GetAssessmentTelemetryOutcomeCallable InspectorClient::GetAssessmentTelemetryCallable(const GetAssessmentTelemetryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetAssessmentTelemetry(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetAssessmentTelemetry(request); } );
 }
 
 void InspectorClient::GetAssessmentTelemetryAsync(const GetAssessmentTelemetryRequest& request, const GetAssessmentTelemetryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -648,6 +798,16 @@ void InspectorClient::GetAssessmentTelemetryAsync(const GetAssessmentTelemetryRe
   m_executor->Submit( [this, request, handler, context](){ this->GetAssessmentTelemetryAsyncHelper( request, handler, context ); } );
 }
 
+GetAssessmentTelemetryOutcomeCallable InspectorClient::GetAssessmentTelemetryCallable(GetAssessmentTelemetryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::GetAssessmentTelemetry, this, std::move(request)));
+}
+
+void InspectorClient::GetAssessmentTelemetryAsync(GetAssessmentTelemetryRequest&& request, const GetAssessmentTelemetryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::GetAssessmentTelemetryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::GetAssessmentTelemetryAsyncHelper(const GetAssessmentTelemetryRequest& request, const GetAssessmentTelemetryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetAssessmentTelemetry(request), context);
@@ -671,7 +831,7 @@ ListApplicationsOutcome InspectorClient::ListApplications(const ListApplications
 
 ListApplicationsOutcomeCallable InspectorClient::ListApplicationsCallable(const ListApplicationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListApplications(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListApplications(request); } );
 }
 
 void InspectorClient::ListApplicationsAsync(const ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -679,6 +839,16 @@ void InspectorClient::ListApplicationsAsync(const ListApplicationsRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ListApplicationsAsyncHelper( request, handler, context ); } );
 }
 
+ListApplicationsOutcomeCallable InspectorClient::ListApplicationsCallable(ListApplicationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::ListApplications, this, std::move(request)));
+}
+
+void InspectorClient::ListApplicationsAsync(ListApplicationsRequest&& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::ListApplicationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::ListApplicationsAsyncHelper(const ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListApplications(request), context);
@@ -702,7 +872,7 @@ ListAssessmentAgentsOutcome InspectorClient::ListAssessmentAgents(const ListAsse
 
 ListAssessmentAgentsOutcomeCallable InspectorClient::ListAssessmentAgentsCallable(const ListAssessmentAgentsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAssessmentAgents(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAssessmentAgents(request); } );
 }
 
 void InspectorClient::ListAssessmentAgentsAsync(const ListAssessmentAgentsRequest& request, const ListAssessmentAgentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -710,6 +880,16 @@ void InspectorClient::ListAssessmentAgentsAsync(const ListAssessmentAgentsReques
   m_executor->Submit( [this, request, handler, context](){ this->ListAssessmentAgentsAsyncHelper( request, handler, context ); } );
 }
 
+ListAssessmentAgentsOutcomeCallable InspectorClient::ListAssessmentAgentsCallable(ListAssessmentAgentsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::ListAssessmentAgents, this, std::move(request)));
+}
+
+void InspectorClient::ListAssessmentAgentsAsync(ListAssessmentAgentsRequest&& request, const ListAssessmentAgentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::ListAssessmentAgentsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::ListAssessmentAgentsAsyncHelper(const ListAssessmentAgentsRequest& request, const ListAssessmentAgentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAssessmentAgents(request), context);
@@ -733,7 +913,7 @@ ListAssessmentsOutcome InspectorClient::ListAssessments(const ListAssessmentsReq
 
 ListAssessmentsOutcomeCallable InspectorClient::ListAssessmentsCallable(const ListAssessmentsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAssessments(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAssessments(request); } );
 }
 
 void InspectorClient::ListAssessmentsAsync(const ListAssessmentsRequest& request, const ListAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -741,6 +921,16 @@ void InspectorClient::ListAssessmentsAsync(const ListAssessmentsRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->ListAssessmentsAsyncHelper( request, handler, context ); } );
 }
 
+ListAssessmentsOutcomeCallable InspectorClient::ListAssessmentsCallable(ListAssessmentsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::ListAssessments, this, std::move(request)));
+}
+
+void InspectorClient::ListAssessmentsAsync(ListAssessmentsRequest&& request, const ListAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::ListAssessmentsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::ListAssessmentsAsyncHelper(const ListAssessmentsRequest& request, const ListAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAssessments(request), context);
@@ -764,7 +954,7 @@ ListAttachedAssessmentsOutcome InspectorClient::ListAttachedAssessments(const Li
 
 ListAttachedAssessmentsOutcomeCallable InspectorClient::ListAttachedAssessmentsCallable(const ListAttachedAssessmentsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAttachedAssessments(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAttachedAssessments(request); } );
 }
 
 void InspectorClient::ListAttachedAssessmentsAsync(const ListAttachedAssessmentsRequest& request, const ListAttachedAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -772,6 +962,16 @@ void InspectorClient::ListAttachedAssessmentsAsync(const ListAttachedAssessments
   m_executor->Submit( [this, request, handler, context](){ this->ListAttachedAssessmentsAsyncHelper( request, handler, context ); } );
 }
 
+ListAttachedAssessmentsOutcomeCallable InspectorClient::ListAttachedAssessmentsCallable(ListAttachedAssessmentsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::ListAttachedAssessments, this, std::move(request)));
+}
+
+void InspectorClient::ListAttachedAssessmentsAsync(ListAttachedAssessmentsRequest&& request, const ListAttachedAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::ListAttachedAssessmentsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::ListAttachedAssessmentsAsyncHelper(const ListAttachedAssessmentsRequest& request, const ListAttachedAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAttachedAssessments(request), context);
@@ -795,7 +995,7 @@ ListAttachedRulesPackagesOutcome InspectorClient::ListAttachedRulesPackages(cons
 
 ListAttachedRulesPackagesOutcomeCallable InspectorClient::ListAttachedRulesPackagesCallable(const ListAttachedRulesPackagesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAttachedRulesPackages(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAttachedRulesPackages(request); } );
 }
 
 void InspectorClient::ListAttachedRulesPackagesAsync(const ListAttachedRulesPackagesRequest& request, const ListAttachedRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -803,6 +1003,16 @@ void InspectorClient::ListAttachedRulesPackagesAsync(const ListAttachedRulesPack
   m_executor->Submit( [this, request, handler, context](){ this->ListAttachedRulesPackagesAsyncHelper( request, handler, context ); } );
 }
 
+ListAttachedRulesPackagesOutcomeCallable InspectorClient::ListAttachedRulesPackagesCallable(ListAttachedRulesPackagesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::ListAttachedRulesPackages, this, std::move(request)));
+}
+
+void InspectorClient::ListAttachedRulesPackagesAsync(ListAttachedRulesPackagesRequest&& request, const ListAttachedRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::ListAttachedRulesPackagesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::ListAttachedRulesPackagesAsyncHelper(const ListAttachedRulesPackagesRequest& request, const ListAttachedRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAttachedRulesPackages(request), context);
@@ -826,7 +1036,7 @@ ListFindingsOutcome InspectorClient::ListFindings(const ListFindingsRequest& req
 
 ListFindingsOutcomeCallable InspectorClient::ListFindingsCallable(const ListFindingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListFindings(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListFindings(request); } );
 }
 
 void InspectorClient::ListFindingsAsync(const ListFindingsRequest& request, const ListFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -834,6 +1044,16 @@ void InspectorClient::ListFindingsAsync(const ListFindingsRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->ListFindingsAsyncHelper( request, handler, context ); } );
 }
 
+ListFindingsOutcomeCallable InspectorClient::ListFindingsCallable(ListFindingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::ListFindings, this, std::move(request)));
+}
+
+void InspectorClient::ListFindingsAsync(ListFindingsRequest&& request, const ListFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::ListFindingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::ListFindingsAsyncHelper(const ListFindingsRequest& request, const ListFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListFindings(request), context);
@@ -857,7 +1077,7 @@ ListRulesPackagesOutcome InspectorClient::ListRulesPackages(const ListRulesPacka
 
 ListRulesPackagesOutcomeCallable InspectorClient::ListRulesPackagesCallable(const ListRulesPackagesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListRulesPackages(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListRulesPackages(request); } );
 }
 
 void InspectorClient::ListRulesPackagesAsync(const ListRulesPackagesRequest& request, const ListRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -865,6 +1085,16 @@ void InspectorClient::ListRulesPackagesAsync(const ListRulesPackagesRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->ListRulesPackagesAsyncHelper( request, handler, context ); } );
 }
 
+ListRulesPackagesOutcomeCallable InspectorClient::ListRulesPackagesCallable(ListRulesPackagesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::ListRulesPackages, this, std::move(request)));
+}
+
+void InspectorClient::ListRulesPackagesAsync(ListRulesPackagesRequest&& request, const ListRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::ListRulesPackagesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::ListRulesPackagesAsyncHelper(const ListRulesPackagesRequest& request, const ListRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListRulesPackages(request), context);
@@ -888,7 +1118,7 @@ ListRunsOutcome InspectorClient::ListRuns(const ListRunsRequest& request) const
 
 ListRunsOutcomeCallable InspectorClient::ListRunsCallable(const ListRunsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListRuns(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListRuns(request); } );
 }
 
 void InspectorClient::ListRunsAsync(const ListRunsRequest& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -896,6 +1126,16 @@ void InspectorClient::ListRunsAsync(const ListRunsRequest& request, const ListRu
   m_executor->Submit( [this, request, handler, context](){ this->ListRunsAsyncHelper( request, handler, context ); } );
 }
 
+ListRunsOutcomeCallable InspectorClient::ListRunsCallable(ListRunsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::ListRuns, this, std::move(request)));
+}
+
+void InspectorClient::ListRunsAsync(ListRunsRequest&& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::ListRunsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::ListRunsAsyncHelper(const ListRunsRequest& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListRuns(request), context);
@@ -919,7 +1159,7 @@ ListTagsForResourceOutcome InspectorClient::ListTagsForResource(const ListTagsFo
 
 ListTagsForResourceOutcomeCallable InspectorClient::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTagsForResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTagsForResource(request); } );
 }
 
 void InspectorClient::ListTagsForResourceAsync(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -927,6 +1167,16 @@ void InspectorClient::ListTagsForResourceAsync(const ListTagsForResourceRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsForResourceAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsForResourceOutcomeCallable InspectorClient::ListTagsForResourceCallable(ListTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::ListTagsForResource, this, std::move(request)));
+}
+
+void InspectorClient::ListTagsForResourceAsync(ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::ListTagsForResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTagsForResource(request), context);
@@ -950,7 +1200,7 @@ LocalizeTextOutcome InspectorClient::LocalizeText(const LocalizeTextRequest& req
 
 LocalizeTextOutcomeCallable InspectorClient::LocalizeTextCallable(const LocalizeTextRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->LocalizeText(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->LocalizeText(request); } );
 }
 
 void InspectorClient::LocalizeTextAsync(const LocalizeTextRequest& request, const LocalizeTextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -958,6 +1208,16 @@ void InspectorClient::LocalizeTextAsync(const LocalizeTextRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->LocalizeTextAsyncHelper( request, handler, context ); } );
 }
 
+LocalizeTextOutcomeCallable InspectorClient::LocalizeTextCallable(LocalizeTextRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::LocalizeText, this, std::move(request)));
+}
+
+void InspectorClient::LocalizeTextAsync(LocalizeTextRequest&& request, const LocalizeTextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::LocalizeTextAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::LocalizeTextAsyncHelper(const LocalizeTextRequest& request, const LocalizeTextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, LocalizeText(request), context);
@@ -981,7 +1241,7 @@ PreviewAgentsForResourceGroupOutcome InspectorClient::PreviewAgentsForResourceGr
 
 PreviewAgentsForResourceGroupOutcomeCallable InspectorClient::PreviewAgentsForResourceGroupCallable(const PreviewAgentsForResourceGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PreviewAgentsForResourceGroup(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PreviewAgentsForResourceGroup(request); } );
 }
 
 void InspectorClient::PreviewAgentsForResourceGroupAsync(const PreviewAgentsForResourceGroupRequest& request, const PreviewAgentsForResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -989,6 +1249,16 @@ void InspectorClient::PreviewAgentsForResourceGroupAsync(const PreviewAgentsForR
   m_executor->Submit( [this, request, handler, context](){ this->PreviewAgentsForResourceGroupAsyncHelper( request, handler, context ); } );
 }
 
+PreviewAgentsForResourceGroupOutcomeCallable InspectorClient::PreviewAgentsForResourceGroupCallable(PreviewAgentsForResourceGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::PreviewAgentsForResourceGroup, this, std::move(request)));
+}
+
+void InspectorClient::PreviewAgentsForResourceGroupAsync(PreviewAgentsForResourceGroupRequest&& request, const PreviewAgentsForResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::PreviewAgentsForResourceGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::PreviewAgentsForResourceGroupAsyncHelper(const PreviewAgentsForResourceGroupRequest& request, const PreviewAgentsForResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PreviewAgentsForResourceGroup(request), context);
@@ -1012,7 +1282,7 @@ RegisterCrossAccountAccessRoleOutcome InspectorClient::RegisterCrossAccountAcces
 
 RegisterCrossAccountAccessRoleOutcomeCallable InspectorClient::RegisterCrossAccountAccessRoleCallable(const RegisterCrossAccountAccessRoleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterCrossAccountAccessRole(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterCrossAccountAccessRole(request); } );
 }
 
 void InspectorClient::RegisterCrossAccountAccessRoleAsync(const RegisterCrossAccountAccessRoleRequest& request, const RegisterCrossAccountAccessRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1020,6 +1290,16 @@ void InspectorClient::RegisterCrossAccountAccessRoleAsync(const RegisterCrossAcc
   m_executor->Submit( [this, request, handler, context](){ this->RegisterCrossAccountAccessRoleAsyncHelper( request, handler, context ); } );
 }
 
+RegisterCrossAccountAccessRoleOutcomeCallable InspectorClient::RegisterCrossAccountAccessRoleCallable(RegisterCrossAccountAccessRoleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::RegisterCrossAccountAccessRole, this, std::move(request)));
+}
+
+void InspectorClient::RegisterCrossAccountAccessRoleAsync(RegisterCrossAccountAccessRoleRequest&& request, const RegisterCrossAccountAccessRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::RegisterCrossAccountAccessRoleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::RegisterCrossAccountAccessRoleAsyncHelper(const RegisterCrossAccountAccessRoleRequest& request, const RegisterCrossAccountAccessRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterCrossAccountAccessRole(request), context);
@@ -1043,7 +1323,7 @@ RemoveAttributesFromFindingsOutcome InspectorClient::RemoveAttributesFromFinding
 
 RemoveAttributesFromFindingsOutcomeCallable InspectorClient::RemoveAttributesFromFindingsCallable(const RemoveAttributesFromFindingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveAttributesFromFindings(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveAttributesFromFindings(request); } );
 }
 
 void InspectorClient::RemoveAttributesFromFindingsAsync(const RemoveAttributesFromFindingsRequest& request, const RemoveAttributesFromFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1051,6 +1331,16 @@ void InspectorClient::RemoveAttributesFromFindingsAsync(const RemoveAttributesFr
   m_executor->Submit( [this, request, handler, context](){ this->RemoveAttributesFromFindingsAsyncHelper( request, handler, context ); } );
 }
 
+RemoveAttributesFromFindingsOutcomeCallable InspectorClient::RemoveAttributesFromFindingsCallable(RemoveAttributesFromFindingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::RemoveAttributesFromFindings, this, std::move(request)));
+}
+
+void InspectorClient::RemoveAttributesFromFindingsAsync(RemoveAttributesFromFindingsRequest&& request, const RemoveAttributesFromFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::RemoveAttributesFromFindingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::RemoveAttributesFromFindingsAsyncHelper(const RemoveAttributesFromFindingsRequest& request, const RemoveAttributesFromFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveAttributesFromFindings(request), context);
@@ -1074,7 +1364,7 @@ RunAssessmentOutcome InspectorClient::RunAssessment(const RunAssessmentRequest&
 
 RunAssessmentOutcomeCallable InspectorClient::RunAssessmentCallable(const RunAssessmentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RunAssessment(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RunAssessment(request); } );
 }
 
 void InspectorClient::RunAssessmentAsync(const RunAssessmentRequest& request, const RunAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1082,6 +1372,16 @@ void InspectorClient::RunAssessmentAsync(const RunAssessmentRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->RunAssessmentAsyncHelper( request, handler, context ); } );
 }
 
+RunAssessmentOutcomeCallable InspectorClient::RunAssessmentCallable(RunAssessmentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::RunAssessment, this, std::move(request)));
+}
+
+void InspectorClient::RunAssessmentAsync(RunAssessmentRequest&& request, const RunAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::RunAssessmentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::RunAssessmentAsyncHelper(const RunAssessmentRequest& request, const RunAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RunAssessment(request), context);
@@ -1105,7 +1405,7 @@ SetTagsForResourceOutcome InspectorClient::SetTagsForResource(const SetTagsForRe
 
 SetTagsForResourceOutcomeCallable InspectorClient::SetTagsForResourceCallable(const SetTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetTagsForResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetTagsForResource(request); } );
 }
 
 void InspectorClient::SetTagsForResourceAsync(const SetTagsForResourceRequest& request, const SetTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1113,6 +1413,16 @@ void InspectorClient::SetTagsForResourceAsync(const SetTagsForResourceRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->SetTagsForResourceAsyncHelper( request, handler, context ); } );
 }
 
+SetTagsForResourceOutcomeCallable InspectorClient::SetTagsForResourceCallable(SetTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::SetTagsForResource, this, std::move(request)));
+}
+
+void InspectorClient::SetTagsForResourceAsync(SetTagsForResourceRequest&& request, const SetTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::SetTagsForResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::SetTagsForResourceAsyncHelper(const SetTagsForResourceRequest& request, const SetTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetTagsForResource(request), context);
@@ -1136,7 +1446,7 @@ StartDataCollectionOutcome InspectorClient::StartDataCollection(const StartDataC
 
 StartDataCollectionOutcomeCallable InspectorClient::StartDataCollectionCallable(const StartDataCollectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StartDataCollection(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StartDataCollection(request); } );
 }
 
 void InspectorClient::StartDataCollectionAsync(const StartDataCollectionRequest& request, const StartDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1144,6 +1454,16 @@ void InspectorClient::StartDataCollectionAsync(const StartDataCollectionRequest&
   m_executor->Submit( [this, request, handler, context](){ this->StartDataCollectionAsyncHelper( request, handler, context ); } );
 }
 
+StartDataCollectionOutcomeCallable InspectorClient::StartDataCollectionCallable(StartDataCollectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::StartDataCollection, this, std::move(request)));
+}
+
+void InspectorClient::StartDataCollectionAsync(StartDataCollectionRequest&& request, const StartDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::StartDataCollectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::StartDataCollectionAsyncHelper(const StartDataCollectionRequest& request, const StartDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StartDataCollection(request), context);
@@ -1167,7 +1487,7 @@ StopDataCollectionOutcome InspectorClient::StopDataCollection(const StopDataColl
 
 StopDataCollectionOutcomeCallable InspectorClient::StopDataCollectionCallable(const StopDataCollectionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StopDataCollection(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StopDataCollection(request); } );
 }
 
 void InspectorClient::StopDataCollectionAsync(const StopDataCollectionRequest& request, const StopDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1175,6 +1495,16 @@ void InspectorClient::StopDataCollectionAsync(const StopDataCollectionRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->StopDataCollectionAsyncHelper( request, handler, context ); } );
 }
 
+StopDataCollectionOutcomeCallable InspectorClient::StopDataCollectionCallable(StopDataCollectionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::StopDataCollection, this, std::move(request)));
+}
+
+void InspectorClient::StopDataCollectionAsync(StopDataCollectionRequest&& request, const StopDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::StopDataCollectionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::StopDataCollectionAsyncHelper(const StopDataCollectionRequest& request, const StopDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StopDataCollection(request), context);
@@ -1198,7 +1528,7 @@ UpdateApplicationOutcome InspectorClient::UpdateApplication(const UpdateApplicat
 
 UpdateApplicationOutcomeCallable InspectorClient::UpdateApplicationCallable(const UpdateApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateApplication(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateApplication(request); } );
 }
 
 void InspectorClient::UpdateApplicationAsync(const UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1206,6 +1536,16 @@ void InspectorClient::UpdateApplicationAsync(const UpdateApplicationRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->UpdateApplicationAsyncHelper( request, handler, context ); } );
 }
 
+UpdateApplicationOutcomeCallable InspectorClient::UpdateApplicationCallable(UpdateApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::UpdateApplication, this, std::move(request)));
+}
+
+void InspectorClient::UpdateApplicationAsync(UpdateApplicationRequest&& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::UpdateApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::UpdateApplicationAsyncHelper(const UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateApplication(request), context);
@@ -1229,7 +1569,7 @@ UpdateAssessmentOutcome InspectorClient::UpdateAssessment(const UpdateAssessment
 
 UpdateAssessmentOutcomeCallable InspectorClient::UpdateAssessmentCallable(const UpdateAssessmentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateAssessment(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateAssessment(request); } );
 }
 
 void InspectorClient::UpdateAssessmentAsync(const UpdateAssessmentRequest& request, const UpdateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1237,8 +1577,353 @@ void InspectorClient::UpdateAssessmentAsync(const UpdateAssessmentRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->UpdateAssessmentAsyncHelper( request, handler, context ); } );
 }
 
+UpdateAssessmentOutcomeCallable InspectorClient::UpdateAssessmentCallable(UpdateAssessmentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&InspectorClient::UpdateAssessment, this, std::move(request)));
+}
+
+void InspectorClient::UpdateAssessmentAsync(UpdateAssessmentRequest&& request, const UpdateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&InspectorClient::UpdateAssessmentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void InspectorClient::UpdateAssessmentAsyncHelper(const UpdateAssessmentRequest& request, const UpdateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateAssessment(request), context);
 }
 
+Paginator<InspectorClient, ListApplicationsRequest, ListApplicationsOutcome> InspectorClient::ListApplicationsPaginator(const ListApplicationsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<InspectorClient, ListApplicationsRequest, ListApplicationsOutcome>(this, &InspectorClient::ListApplications, request,
+    [](const ListApplicationsRequest& current, const ListApplicationsOutcome& outcome, ListApplicationsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<InspectorClient, ListAssessmentAgentsRequest, ListAssessmentAgentsOutcome> InspectorClient::ListAssessmentAgentsPaginator(const ListAssessmentAgentsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<InspectorClient, ListAssessmentAgentsRequest, ListAssessmentAgentsOutcome>(this, &InspectorClient::ListAssessmentAgents, request,
+    [](const ListAssessmentAgentsRequest& current, const ListAssessmentAgentsOutcome& outcome, ListAssessmentAgentsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<InspectorClient, ListAssessmentsRequest, ListAssessmentsOutcome> InspectorClient::ListAssessmentsPaginator(const ListAssessmentsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<InspectorClient, ListAssessmentsRequest, ListAssessmentsOutcome>(this, &InspectorClient::ListAssessments, request,
+    [](const ListAssessmentsRequest& current, const ListAssessmentsOutcome& outcome, ListAssessmentsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<InspectorClient, ListAttachedAssessmentsRequest, ListAttachedAssessmentsOutcome> InspectorClient::ListAttachedAssessmentsPaginator(const ListAttachedAssessmentsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<InspectorClient, ListAttachedAssessmentsRequest, ListAttachedAssessmentsOutcome>(this, &InspectorClient::ListAttachedAssessments, request,
+    [](const ListAttachedAssessmentsRequest& current, const ListAttachedAssessmentsOutcome& outcome, ListAttachedAssessmentsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<InspectorClient, ListAttachedRulesPackagesRequest, ListAttachedRulesPackagesOutcome> InspectorClient::ListAttachedRulesPackagesPaginator(const ListAttachedRulesPackagesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<InspectorClient, ListAttachedRulesPackagesRequest, ListAttachedRulesPackagesOutcome>(this, &InspectorClient::ListAttachedRulesPackages, request,
+    [](const ListAttachedRulesPackagesRequest& current, const ListAttachedRulesPackagesOutcome& outcome, ListAttachedRulesPackagesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<InspectorClient, ListFindingsRequest, ListFindingsOutcome> InspectorClient::ListFindingsPaginator(const ListFindingsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<InspectorClient, ListFindingsRequest, ListFindingsOutcome>(this, &InspectorClient::ListFindings, request,
+    [](const ListFindingsRequest& current, const ListFindingsOutcome& outcome, ListFindingsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<InspectorClient, ListRulesPackagesRequest, ListRulesPackagesOutcome> InspectorClient::ListRulesPackagesPaginator(const ListRulesPackagesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<InspectorClient, ListRulesPackagesRequest, ListRulesPackagesOutcome>(this, &InspectorClient::ListRulesPackages, request,
+    [](const ListRulesPackagesRequest& current, const ListRulesPackagesOutcome& outcome, ListRulesPackagesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<InspectorClient, ListRunsRequest, ListRunsOutcome> InspectorClient::ListRunsPaginator(const ListRunsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<InspectorClient, ListRunsRequest, ListRunsOutcome>(this, &InspectorClient::ListRuns, request,
+    [](const ListRunsRequest& current, const ListRunsOutcome& outcome, ListRunsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<InspectorClient, PreviewAgentsForResourceGroupRequest, PreviewAgentsForResourceGroupOutcome> InspectorClient::PreviewAgentsForResourceGroupPaginator(const PreviewAgentsForResourceGroupRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<InspectorClient, PreviewAgentsForResourceGroupRequest, PreviewAgentsForResourceGroupOutcome>(this, &InspectorClient::PreviewAgentsForResourceGroup, request,
+    [](const PreviewAgentsForResourceGroupRequest& current, const PreviewAgentsForResourceGroupOutcome& outcome, PreviewAgentsForResourceGroupRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<InspectorClient, AddAttributesToFindingsRequest, AddAttributesToFindingsOutcome> InspectorClient::AddAttributesToFindingsAwaitable(AddAttributesToFindingsRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::AddAttributesToFindings, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, AttachAssessmentAndRulesPackageRequest, AttachAssessmentAndRulesPackageOutcome> InspectorClient::AttachAssessmentAndRulesPackageAwaitable(AttachAssessmentAndRulesPackageRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::AttachAssessmentAndRulesPackage, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, CreateApplicationRequest, CreateApplicationOutcome> InspectorClient::CreateApplicationAwaitable(CreateApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::CreateApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, CreateAssessmentRequest, CreateAssessmentOutcome> InspectorClient::CreateAssessmentAwaitable(CreateAssessmentRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::CreateAssessment, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, CreateResourceGroupRequest, CreateResourceGroupOutcome> InspectorClient::CreateResourceGroupAwaitable(CreateResourceGroupRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::CreateResourceGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, DeleteApplicationRequest, DeleteApplicationOutcome> InspectorClient::DeleteApplicationAwaitable(DeleteApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::DeleteApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, DeleteAssessmentRequest, DeleteAssessmentOutcome> InspectorClient::DeleteAssessmentAwaitable(DeleteAssessmentRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::DeleteAssessment, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, DeleteRunRequest, DeleteRunOutcome> InspectorClient::DeleteRunAwaitable(DeleteRunRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::DeleteRun, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, DescribeApplicationRequest, DescribeApplicationOutcome> InspectorClient::DescribeApplicationAwaitable(DescribeApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::DescribeApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, DescribeAssessmentRequest, DescribeAssessmentOutcome> InspectorClient::DescribeAssessmentAwaitable(DescribeAssessmentRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::DescribeAssessment, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, void, DescribeCrossAccountAccessRoleOutcome> InspectorClient::DescribeCrossAccountAccessRoleAwaitable() const
+{
+  return { m_executor.get(), { this, &InspectorClient::DescribeCrossAccountAccessRole } };
+}
+
+ClientOperationAwaitable<InspectorClient, DescribeFindingRequest, DescribeFindingOutcome> InspectorClient::DescribeFindingAwaitable(DescribeFindingRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::DescribeFinding, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, DescribeResourceGroupRequest, DescribeResourceGroupOutcome> InspectorClient::DescribeResourceGroupAwaitable(DescribeResourceGroupRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::DescribeResourceGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, DescribeRulesPackageRequest, DescribeRulesPackageOutcome> InspectorClient::DescribeRulesPackageAwaitable(DescribeRulesPackageRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::DescribeRulesPackage, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, DescribeRunRequest, DescribeRunOutcome> InspectorClient::DescribeRunAwaitable(DescribeRunRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::DescribeRun, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, DetachAssessmentAndRulesPackageRequest, DetachAssessmentAndRulesPackageOutcome> InspectorClient::DetachAssessmentAndRulesPackageAwaitable(DetachAssessmentAndRulesPackageRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::DetachAssessmentAndRulesPackage, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, GetAssessmentTelemetryRequest, GetAssessmentTelemetryOutcome> InspectorClient::GetAssessmentTelemetryAwaitable(GetAssessmentTelemetryRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::GetAssessmentTelemetry, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, ListApplicationsRequest, ListApplicationsOutcome> InspectorClient::ListApplicationsAwaitable(ListApplicationsRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::ListApplications, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, ListAssessmentAgentsRequest, ListAssessmentAgentsOutcome> InspectorClient::ListAssessmentAgentsAwaitable(ListAssessmentAgentsRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::ListAssessmentAgents, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, ListAssessmentsRequest, ListAssessmentsOutcome> InspectorClient::ListAssessmentsAwaitable(ListAssessmentsRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::ListAssessments, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, ListAttachedAssessmentsRequest, ListAttachedAssessmentsOutcome> InspectorClient::ListAttachedAssessmentsAwaitable(ListAttachedAssessmentsRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::ListAttachedAssessments, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, ListAttachedRulesPackagesRequest, ListAttachedRulesPackagesOutcome> InspectorClient::ListAttachedRulesPackagesAwaitable(ListAttachedRulesPackagesRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::ListAttachedRulesPackages, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, ListFindingsRequest, ListFindingsOutcome> InspectorClient::ListFindingsAwaitable(ListFindingsRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::ListFindings, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, ListRulesPackagesRequest, ListRulesPackagesOutcome> InspectorClient::ListRulesPackagesAwaitable(ListRulesPackagesRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::ListRulesPackages, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, ListRunsRequest, ListRunsOutcome> InspectorClient::ListRunsAwaitable(ListRunsRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::ListRuns, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, ListTagsForResourceRequest, ListTagsForResourceOutcome> InspectorClient::ListTagsForResourceAwaitable(ListTagsForResourceRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::ListTagsForResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, LocalizeTextRequest, LocalizeTextOutcome> InspectorClient::LocalizeTextAwaitable(LocalizeTextRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::LocalizeText, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, PreviewAgentsForResourceGroupRequest, PreviewAgentsForResourceGroupOutcome> InspectorClient::PreviewAgentsForResourceGroupAwaitable(PreviewAgentsForResourceGroupRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::PreviewAgentsForResourceGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, RegisterCrossAccountAccessRoleRequest, RegisterCrossAccountAccessRoleOutcome> InspectorClient::RegisterCrossAccountAccessRoleAwaitable(RegisterCrossAccountAccessRoleRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::RegisterCrossAccountAccessRole, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, RemoveAttributesFromFindingsRequest, RemoveAttributesFromFindingsOutcome> InspectorClient::RemoveAttributesFromFindingsAwaitable(RemoveAttributesFromFindingsRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::RemoveAttributesFromFindings, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, RunAssessmentRequest, RunAssessmentOutcome> InspectorClient::RunAssessmentAwaitable(RunAssessmentRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::RunAssessment, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, SetTagsForResourceRequest, SetTagsForResourceOutcome> InspectorClient::SetTagsForResourceAwaitable(SetTagsForResourceRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::SetTagsForResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, StartDataCollectionRequest, StartDataCollectionOutcome> InspectorClient::StartDataCollectionAwaitable(StartDataCollectionRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::StartDataCollection, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, StopDataCollectionRequest, StopDataCollectionOutcome> InspectorClient::StopDataCollectionAwaitable(StopDataCollectionRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::StopDataCollection, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, UpdateApplicationRequest, UpdateApplicationOutcome> InspectorClient::UpdateApplicationAwaitable(UpdateApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::UpdateApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<InspectorClient, UpdateAssessmentRequest, UpdateAssessmentOutcome> InspectorClient::UpdateAssessmentAwaitable(UpdateAssessmentRequest request) const
+{
+  return { m_executor.get(), { this, &InspectorClient::UpdateAssessment, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
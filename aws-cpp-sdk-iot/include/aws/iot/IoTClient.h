@@ -62,6 +62,9 @@
 #include <aws/iot/model/UpdateThingResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -404,6 +407,18 @@ namespace Model
          */
         virtual void AcceptCertificateTransferAsync(const Model::AcceptCertificateTransferRequest& request, const AcceptCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AcceptCertificateTransferCallable(const Model::AcceptCertificateTransferRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AcceptCertificateTransferOutcomeCallable AcceptCertificateTransferCallable(Model::AcceptCertificateTransferRequest&& request) const;
+
+        /**
+         * Same as AcceptCertificateTransferAsync(const Model::AcceptCertificateTransferRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AcceptCertificateTransferAsync(Model::AcceptCertificateTransferRequest&& request, const AcceptCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches the specified policy to the specified principal (certificate or
          * other credential).</p>
@@ -426,6 +441,18 @@ namespace Model
          */
         virtual void AttachPrincipalPolicyAsync(const Model::AttachPrincipalPolicyRequest& request, const AttachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachPrincipalPolicyCallable(const Model::AttachPrincipalPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachPrincipalPolicyOutcomeCallable AttachPrincipalPolicyCallable(Model::AttachPrincipalPolicyRequest&& request) const;
+
+        /**
+         * Same as AttachPrincipalPolicyAsync(const Model::AttachPrincipalPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachPrincipalPolicyAsync(Model::AttachPrincipalPolicyRequest&& request, const AttachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches the specified principal to the specified thing.</p>
          */
@@ -445,6 +472,18 @@ namespace Model
          */
         virtual void AttachThingPrincipalAsync(const Model::AttachThingPrincipalRequest& request, const AttachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachThingPrincipalCallable(const Model::AttachThingPrincipalRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachThingPrincipalOutcomeCallable AttachThingPrincipalCallable(Model::AttachThingPrincipalRequest&& request) const;
+
+        /**
+         * Same as AttachThingPrincipalAsync(const Model::AttachThingPrincipalRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachThingPrincipalAsync(Model::AttachThingPrincipalRequest&& request, const AttachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels a pending transfer for the specified certificate.</p> <p><b>Note</b>
          * Only the transfer source account can use this operation to cancel a transfer.
@@ -482,6 +521,18 @@ namespace Model
          */
         virtual void CancelCertificateTransferAsync(const Model::CancelCertificateTransferRequest& request, const CancelCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelCertificateTransferCallable(const Model::CancelCertificateTransferRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelCertificateTransferOutcomeCallable CancelCertificateTransferCallable(Model::CancelCertificateTransferRequest&& request) const;
+
+        /**
+         * Same as CancelCertificateTransferAsync(const Model::CancelCertificateTransferRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelCertificateTransferAsync(Model::CancelCertificateTransferRequest&& request, const CancelCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an X.509 certificate using the specified certificate signing
          * request.</p> <p><b>Note</b> Reusing the same certificate signing request (CSR)
@@ -567,6 +618,18 @@ namespace Model
          */
         virtual void CreateCertificateFromCsrAsync(const Model::CreateCertificateFromCsrRequest& request, const CreateCertificateFromCsrResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCertificateFromCsrCallable(const Model::CreateCertificateFromCsrRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateCertificateFromCsrOutcomeCallable CreateCertificateFromCsrCallable(Model::CreateCertificateFromCsrRequest&& request) const;
+
+        /**
+         * Same as CreateCertificateFromCsrAsync(const Model::CreateCertificateFromCsrRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateCertificateFromCsrAsync(Model::CreateCertificateFromCsrRequest&& request, const CreateCertificateFromCsrResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a 2048-bit RSA key pair and issues an X.509 certificate using the
          * issued public key.</p> <p><b>Note</b> This is the only time AWS IoT issues the
@@ -595,6 +658,18 @@ namespace Model
          */
         virtual void CreateKeysAndCertificateAsync(const Model::CreateKeysAndCertificateRequest& request, const CreateKeysAndCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateKeysAndCertificateCallable(const Model::CreateKeysAndCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateKeysAndCertificateOutcomeCallable CreateKeysAndCertificateCallable(Model::CreateKeysAndCertificateRequest&& request) const;
+
+        /**
+         * Same as CreateKeysAndCertificateAsync(const Model::CreateKeysAndCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateKeysAndCertificateAsync(Model::CreateKeysAndCertificateRequest&& request, const CreateKeysAndCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an AWS IoT policy.</p> <p>The created policy is the default version
          * for the policy. This operation creates a policy version with a version
@@ -620,6 +695,18 @@ namespace Model
          */
         virtual void CreatePolicyAsync(const Model::CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePolicyCallable(const Model::CreatePolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreatePolicyOutcomeCallable CreatePolicyCallable(Model::CreatePolicyRequest&& request) const;
+
+        /**
+         * Same as CreatePolicyAsync(const Model::CreatePolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreatePolicyAsync(Model::CreatePolicyRequest&& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new version of the specified AWS IoT policy. To update a policy,
          * create a new policy version. A managed policy can have up to five versions. If
@@ -657,6 +744,18 @@ namespace Model
          */
         virtual void CreatePolicyVersionAsync(const Model::CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePolicyVersionCallable(const Model::CreatePolicyVersionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreatePolicyVersionOutcomeCallable CreatePolicyVersionCallable(Model::CreatePolicyVersionRequest&& request) const;
+
+        /**
+         * Same as CreatePolicyVersionAsync(const Model::CreatePolicyVersionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreatePolicyVersionAsync(Model::CreatePolicyVersionRequest&& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a thing record in the thing registry.</p>
          */
@@ -676,6 +775,18 @@ namespace Model
          */
         virtual void CreateThingAsync(const Model::CreateThingRequest& request, const CreateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateThingCallable(const Model::CreateThingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateThingOutcomeCallable CreateThingCallable(Model::CreateThingRequest&& request) const;
+
+        /**
+         * Same as CreateThingAsync(const Model::CreateThingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateThingAsync(Model::CreateThingRequest&& request, const CreateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new thing type.</p>
          */
@@ -695,6 +806,18 @@ namespace Model
          */
         virtual void CreateThingTypeAsync(const Model::CreateThingTypeRequest& request, const CreateThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateThingTypeCallable(const Model::CreateThingTypeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateThingTypeOutcomeCallable CreateThingTypeCallable(Model::CreateThingTypeRequest&& request) const;
+
+        /**
+         * Same as CreateThingTypeAsync(const Model::CreateThingTypeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateThingTypeAsync(Model::CreateThingTypeRequest&& request, const CreateThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a rule. Creating rules is an administrator-level action. Any user who
          * has permission to create rules will be able to access data processed by the
@@ -720,6 +843,18 @@ namespace Model
          */
         virtual void CreateTopicRuleAsync(const Model::CreateTopicRuleRequest& request, const CreateTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTopicRuleCallable(const Model::CreateTopicRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateTopicRuleOutcomeCallable CreateTopicRuleCallable(Model::CreateTopicRuleRequest&& request) const;
+
+        /**
+         * Same as CreateTopicRuleAsync(const Model::CreateTopicRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateTopicRuleAsync(Model::CreateTopicRuleRequest&& request, const CreateTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a registered CA certificate.</p>
          */
@@ -739,6 +874,18 @@ namespace Model
          */
         virtual void DeleteCACertificateAsync(const Model::DeleteCACertificateRequest& request, const DeleteCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCACertificateCallable(const Model::DeleteCACertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteCACertificateOutcomeCallable DeleteCACertificateCallable(Model::DeleteCACertificateRequest&& request) const;
+
+        /**
+         * Same as DeleteCACertificateAsync(const Model::DeleteCACertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteCACertificateAsync(Model::DeleteCACertificateRequest&& request, const DeleteCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified certificate.</p> <p>A certificate cannot be deleted if
          * it has a policy attached to it or if its status is set to ACTIVE. To delete a
@@ -770,6 +917,18 @@ namespace Model
          */
         virtual void DeleteCertificateAsync(const Model::DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCertificateCallable(const Model::DeleteCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteCertificateOutcomeCallable DeleteCertificateCallable(Model::DeleteCertificateRequest&& request) const;
+
+        /**
+         * Same as DeleteCertificateAsync(const Model::DeleteCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteCertificateAsync(Model::DeleteCertificateRequest&& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified policy.</p> <p>A policy cannot be deleted if it has
          * non-default versions or it is attached to any certificate.</p> <p>To delete a
@@ -807,6 +966,18 @@ namespace Model
          */
         virtual void DeletePolicyAsync(const Model::DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePolicyCallable(const Model::DeletePolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeletePolicyOutcomeCallable DeletePolicyCallable(Model::DeletePolicyRequest&& request) const;
+
+        /**
+         * Same as DeletePolicyAsync(const Model::DeletePolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeletePolicyAsync(Model::DeletePolicyRequest&& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified version of the specified policy. You cannot delete the
          * default version of a policy using this API. To delete the default version of a
@@ -835,6 +1006,18 @@ namespace Model
          */
         virtual void DeletePolicyVersionAsync(const Model::DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePolicyVersionCallable(const Model::DeletePolicyVersionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeletePolicyVersionOutcomeCallable DeletePolicyVersionCallable(Model::DeletePolicyVersionRequest&& request) const;
+
+        /**
+         * Same as DeletePolicyVersionAsync(const Model::DeletePolicyVersionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeletePolicyVersionAsync(Model::DeletePolicyVersionRequest&& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a CA certificate registration code.</p>
          */
@@ -854,6 +1037,18 @@ namespace Model
          */
         virtual void DeleteRegistrationCodeAsync(const Model::DeleteRegistrationCodeRequest& request, const DeleteRegistrationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRegistrationCodeCallable(const Model::DeleteRegistrationCodeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRegistrationCodeOutcomeCallable DeleteRegistrationCodeCallable(Model::DeleteRegistrationCodeRequest&& request) const;
+
+        /**
+         * Same as DeleteRegistrationCodeAsync(const Model::DeleteRegistrationCodeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRegistrationCodeAsync(Model::DeleteRegistrationCodeRequest&& request, const DeleteRegistrationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified thing.</p>
          */
@@ -873,6 +1068,18 @@ namespace Model
          */
         virtual void DeleteThingAsync(const Model::DeleteThingRequest& request, const DeleteThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteThingCallable(const Model::DeleteThingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteThingOutcomeCallable DeleteThingCallable(Model::DeleteThingRequest&& request) const;
+
+        /**
+         * Same as DeleteThingAsync(const Model::DeleteThingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteThingAsync(Model::DeleteThingRequest&& request, const DeleteThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified thing type . You cannot delete a thing type if it has
          * things associated with it. To delete a thing type, first mark it as deprecated
@@ -904,6 +1111,18 @@ namespace Model
          */
         virtual void DeleteThingTypeAsync(const Model::DeleteThingTypeRequest& request, const DeleteThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteThingTypeCallable(const Model::DeleteThingTypeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteThingTypeOutcomeCallable DeleteThingTypeCallable(Model::DeleteThingTypeRequest&& request) const;
+
+        /**
+         * Same as DeleteThingTypeAsync(const Model::DeleteThingTypeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteThingTypeAsync(Model::DeleteThingTypeRequest&& request, const DeleteThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified rule.</p>
          */
@@ -923,6 +1142,18 @@ namespace Model
          */
         virtual void DeleteTopicRuleAsync(const Model::DeleteTopicRuleRequest& request, const DeleteTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTopicRuleCallable(const Model::DeleteTopicRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTopicRuleOutcomeCallable DeleteTopicRuleCallable(Model::DeleteTopicRuleRequest&& request) const;
+
+        /**
+         * Same as DeleteTopicRuleAsync(const Model::DeleteTopicRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTopicRuleAsync(Model::DeleteTopicRuleRequest&& request, const DeleteTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deprecates a thing type. You can not associate new things with deprecated
          * thing type.</p>
@@ -945,6 +1176,18 @@ namespace Model
          */
         virtual void DeprecateThingTypeAsync(const Model::DeprecateThingTypeRequest& request, const DeprecateThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeprecateThingTypeCallable(const Model::DeprecateThingTypeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeprecateThingTypeOutcomeCallable DeprecateThingTypeCallable(Model::DeprecateThingTypeRequest&& request) const;
+
+        /**
+         * Same as DeprecateThingTypeAsync(const Model::DeprecateThingTypeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeprecateThingTypeAsync(Model::DeprecateThingTypeRequest&& request, const DeprecateThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes a registered CA certificate.</p>
          */
@@ -964,6 +1207,18 @@ namespace Model
          */
         virtual void DescribeCACertificateAsync(const Model::DescribeCACertificateRequest& request, const DescribeCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCACertificateCallable(const Model::DescribeCACertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCACertificateOutcomeCallable DescribeCACertificateCallable(Model::DescribeCACertificateRequest&& request) const;
+
+        /**
+         * Same as DescribeCACertificateAsync(const Model::DescribeCACertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCACertificateAsync(Model::DescribeCACertificateRequest&& request, const DescribeCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the specified certificate.</p>
          */
@@ -983,6 +1238,18 @@ namespace Model
          */
         virtual void DescribeCertificateAsync(const Model::DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCertificateCallable(const Model::DescribeCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCertificateOutcomeCallable DescribeCertificateCallable(Model::DescribeCertificateRequest&& request) const;
+
+        /**
+         * Same as DescribeCertificateAsync(const Model::DescribeCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCertificateAsync(Model::DescribeCertificateRequest&& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a unique endpoint specific to the AWS account making the call.</p>
          */
@@ -1002,6 +1269,18 @@ namespace Model
          */
         virtual void DescribeEndpointAsync(const Model::DescribeEndpointRequest& request, const DescribeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEndpointCallable(const Model::DescribeEndpointRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEndpointOutcomeCallable DescribeEndpointCallable(Model::DescribeEndpointRequest&& request) const;
+
+        /**
+         * Same as DescribeEndpointAsync(const Model::DescribeEndpointRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEndpointAsync(Model::DescribeEndpointRequest&& request, const DescribeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the specified thing.</p>
          */
@@ -1021,6 +1300,18 @@ namespace Model
          */
         virtual void DescribeThingAsync(const Model::DescribeThingRequest& request, const DescribeThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeThingCallable(const Model::DescribeThingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeThingOutcomeCallable DescribeThingCallable(Model::DescribeThingRequest&& request) const;
+
+        /**
+         * Same as DescribeThingAsync(const Model::DescribeThingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeThingAsync(Model::DescribeThingRequest&& request, const DescribeThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the specified thing type.</p>
          */
@@ -1040,6 +1331,18 @@ namespace Model
          */
         virtual void DescribeThingTypeAsync(const Model::DescribeThingTypeRequest& request, const DescribeThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeThingTypeCallable(const Model::DescribeThingTypeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeThingTypeOutcomeCallable DescribeThingTypeCallable(Model::DescribeThingTypeRequest&& request) const;
+
+        /**
+         * Same as DescribeThingTypeAsync(const Model::DescribeThingTypeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeThingTypeAsync(Model::DescribeThingTypeRequest&& request, const DescribeThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified policy from the specified certificate.</p>
          */
@@ -1059,6 +1362,18 @@ namespace Model
          */
         virtual void DetachPrincipalPolicyAsync(const Model::DetachPrincipalPolicyRequest& request, const DetachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachPrincipalPolicyCallable(const Model::DetachPrincipalPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachPrincipalPolicyOutcomeCallable DetachPrincipalPolicyCallable(Model::DetachPrincipalPolicyRequest&& request) const;
+
+        /**
+         * Same as DetachPrincipalPolicyAsync(const Model::DetachPrincipalPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachPrincipalPolicyAsync(Model::DetachPrincipalPolicyRequest&& request, const DetachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches the specified principal from the specified thing.</p>
          */
@@ -1078,6 +1393,18 @@ namespace Model
          */
         virtual void DetachThingPrincipalAsync(const Model::DetachThingPrincipalRequest& request, const DetachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachThingPrincipalCallable(const Model::DetachThingPrincipalRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachThingPrincipalOutcomeCallable DetachThingPrincipalCallable(Model::DetachThingPrincipalRequest&& request) const;
+
+        /**
+         * Same as DetachThingPrincipalAsync(const Model::DetachThingPrincipalRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachThingPrincipalAsync(Model::DetachThingPrincipalRequest&& request, const DetachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables the specified rule.</p>
          */
@@ -1097,6 +1424,18 @@ namespace Model
          */
         virtual void DisableTopicRuleAsync(const Model::DisableTopicRuleRequest& request, const DisableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableTopicRuleCallable(const Model::DisableTopicRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableTopicRuleOutcomeCallable DisableTopicRuleCallable(Model::DisableTopicRuleRequest&& request) const;
+
+        /**
+         * Same as DisableTopicRuleAsync(const Model::DisableTopicRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableTopicRuleAsync(Model::DisableTopicRuleRequest&& request, const DisableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables the specified rule.</p>
          */
@@ -1116,6 +1455,18 @@ namespace Model
          */
         virtual void EnableTopicRuleAsync(const Model::EnableTopicRuleRequest& request, const EnableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableTopicRuleCallable(const Model::EnableTopicRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableTopicRuleOutcomeCallable EnableTopicRuleCallable(Model::EnableTopicRuleRequest&& request) const;
+
+        /**
+         * Same as EnableTopicRuleAsync(const Model::EnableTopicRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableTopicRuleAsync(Model::EnableTopicRuleRequest&& request, const EnableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the logging options.</p>
          */
@@ -1135,6 +1486,18 @@ namespace Model
          */
         virtual void GetLoggingOptionsAsync(const Model::GetLoggingOptionsRequest& request, const GetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetLoggingOptionsCallable(const Model::GetLoggingOptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetLoggingOptionsOutcomeCallable GetLoggingOptionsCallable(Model::GetLoggingOptionsRequest&& request) const;
+
+        /**
+         * Same as GetLoggingOptionsAsync(const Model::GetLoggingOptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetLoggingOptionsAsync(Model::GetLoggingOptionsRequest&& request, const GetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the specified policy with the policy document of the
          * default version.</p>
@@ -1157,6 +1520,18 @@ namespace Model
          */
         virtual void GetPolicyAsync(const Model::GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPolicyCallable(const Model::GetPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetPolicyOutcomeCallable GetPolicyCallable(Model::GetPolicyRequest&& request) const;
+
+        /**
+         * Same as GetPolicyAsync(const Model::GetPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetPolicyAsync(Model::GetPolicyRequest&& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the specified policy version.</p>
          */
@@ -1176,6 +1551,18 @@ namespace Model
          */
         virtual void GetPolicyVersionAsync(const Model::GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPolicyVersionCallable(const Model::GetPolicyVersionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetPolicyVersionOutcomeCallable GetPolicyVersionCallable(Model::GetPolicyVersionRequest&& request) const;
+
+        /**
+         * Same as GetPolicyVersionAsync(const Model::GetPolicyVersionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetPolicyVersionAsync(Model::GetPolicyVersionRequest&& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a registration code used to register a CA certificate with AWS IoT.</p>
          */
@@ -1195,6 +1582,18 @@ namespace Model
          */
         virtual void GetRegistrationCodeAsync(const Model::GetRegistrationCodeRequest& request, const GetRegistrationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRegistrationCodeCallable(const Model::GetRegistrationCodeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetRegistrationCodeOutcomeCallable GetRegistrationCodeCallable(Model::GetRegistrationCodeRequest&& request) const;
+
+        /**
+         * Same as GetRegistrationCodeAsync(const Model::GetRegistrationCodeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetRegistrationCodeAsync(Model::GetRegistrationCodeRequest&& request, const GetRegistrationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the specified rule.</p>
          */
@@ -1214,6 +1613,18 @@ namespace Model
          */
         virtual void GetTopicRuleAsync(const Model::GetTopicRuleRequest& request, const GetTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTopicRuleCallable(const Model::GetTopicRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetTopicRuleOutcomeCallable GetTopicRuleCallable(Model::GetTopicRuleRequest&& request) const;
+
+        /**
+         * Same as GetTopicRuleAsync(const Model::GetTopicRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetTopicRuleAsync(Model::GetTopicRuleRequest&& request, const GetTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the CA certificates registered for your AWS account.</p> <p>The results
          * are paginated with a default page size of 25. You can use the returned marker to
@@ -1239,6 +1650,18 @@ namespace Model
          */
         virtual void ListCACertificatesAsync(const Model::ListCACertificatesRequest& request, const ListCACertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListCACertificatesCallable(const Model::ListCACertificatesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListCACertificatesOutcomeCallable ListCACertificatesCallable(Model::ListCACertificatesRequest&& request) const;
+
+        /**
+         * Same as ListCACertificatesAsync(const Model::ListCACertificatesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListCACertificatesAsync(Model::ListCACertificatesRequest&& request, const ListCACertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the certificates registered in your AWS account.</p> <p>The results are
          * paginated with a default page size of 25. You can use the returned marker to
@@ -1264,6 +1687,18 @@ namespace Model
          */
         virtual void ListCertificatesAsync(const Model::ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListCertificatesCallable(const Model::ListCertificatesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListCertificatesOutcomeCallable ListCertificatesCallable(Model::ListCertificatesRequest&& request) const;
+
+        /**
+         * Same as ListCertificatesAsync(const Model::ListCertificatesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListCertificatesAsync(Model::ListCertificatesRequest&& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>List the device certificates signed by the specified CA certificate.</p>
          */
@@ -1283,6 +1718,18 @@ namespace Model
          */
         virtual void ListCertificatesByCAAsync(const Model::ListCertificatesByCARequest& request, const ListCertificatesByCAResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListCertificatesByCACallable(const Model::ListCertificatesByCARequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListCertificatesByCAOutcomeCallable ListCertificatesByCACallable(Model::ListCertificatesByCARequest&& request) const;
+
+        /**
+         * Same as ListCertificatesByCAAsync(const Model::ListCertificatesByCARequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListCertificatesByCAAsync(Model::ListCertificatesByCARequest&& request, const ListCertificatesByCAResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists certificates that are being transfered but not yet accepted.</p>
          */
@@ -1302,6 +1749,18 @@ namespace Model
          */
         virtual void ListOutgoingCertificatesAsync(const Model::ListOutgoingCertificatesRequest& request, const ListOutgoingCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListOutgoingCertificatesCallable(const Model::ListOutgoingCertificatesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListOutgoingCertificatesOutcomeCallable ListOutgoingCertificatesCallable(Model::ListOutgoingCertificatesRequest&& request) const;
+
+        /**
+         * Same as ListOutgoingCertificatesAsync(const Model::ListOutgoingCertificatesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListOutgoingCertificatesAsync(Model::ListOutgoingCertificatesRequest&& request, const ListOutgoingCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists your policies.</p>
          */
@@ -1321,6 +1780,18 @@ namespace Model
          */
         virtual void ListPoliciesAsync(const Model::ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPoliciesCallable(const Model::ListPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListPoliciesOutcomeCallable ListPoliciesCallable(Model::ListPoliciesRequest&& request) const;
+
+        /**
+         * Same as ListPoliciesAsync(const Model::ListPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPoliciesAsync(Model::ListPoliciesRequest&& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the principals associated with the specified policy.</p>
          */
@@ -1340,6 +1811,18 @@ namespace Model
          */
         virtual void ListPolicyPrincipalsAsync(const Model::ListPolicyPrincipalsRequest& request, const ListPolicyPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPolicyPrincipalsCallable(const Model::ListPolicyPrincipalsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListPolicyPrincipalsOutcomeCallable ListPolicyPrincipalsCallable(Model::ListPolicyPrincipalsRequest&& request) const;
+
+        /**
+         * Same as ListPolicyPrincipalsAsync(const Model::ListPolicyPrincipalsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPolicyPrincipalsAsync(Model::ListPolicyPrincipalsRequest&& request, const ListPolicyPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the versions of the specified policy and identifies the default
          * version.</p>
@@ -1362,6 +1845,18 @@ namespace Model
          */
         virtual void ListPolicyVersionsAsync(const Model::ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPolicyVersionsCallable(const Model::ListPolicyVersionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListPolicyVersionsOutcomeCallable ListPolicyVersionsCallable(Model::ListPolicyVersionsRequest&& request) const;
+
+        /**
+         * Same as ListPolicyVersionsAsync(const Model::ListPolicyVersionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPolicyVersionsAsync(Model::ListPolicyVersionsRequest&& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the policies attached to the specified principal. If you use an Cognito
          * identity, the ID must be in <a
@@ -1390,6 +1885,18 @@ namespace Model
          */
         virtual void ListPrincipalPoliciesAsync(const Model::ListPrincipalPoliciesRequest& request, const ListPrincipalPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPrincipalPoliciesCallable(const Model::ListPrincipalPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListPrincipalPoliciesOutcomeCallable ListPrincipalPoliciesCallable(Model::ListPrincipalPoliciesRequest&& request) const;
+
+        /**
+         * Same as ListPrincipalPoliciesAsync(const Model::ListPrincipalPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPrincipalPoliciesAsync(Model::ListPrincipalPoliciesRequest&& request, const ListPrincipalPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the things associated with the specified principal.</p>
          */
@@ -1410,13 +1917,25 @@ namespace Model
         virtual void ListPrincipalThingsAsync(const Model::ListPrincipalThingsRequest& request, const ListPrincipalThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
         /**
-         * <p>Lists the principals associated with the specified thing.</p>
+         * Same as ListPrincipalThingsCallable(const Model::ListPrincipalThingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
          */
-        virtual Model::ListThingPrincipalsOutcome ListThingPrincipals(const Model::ListThingPrincipalsRequest& request) const;
+        virtual Model::ListPrincipalThingsOutcomeCallable ListPrincipalThingsCallable(Model::ListPrincipalThingsRequest&& request) const;
 
         /**
-         * <p>Lists the principals associated with the specified thing.</p>
-         *
+         * Same as ListPrincipalThingsAsync(const Model::ListPrincipalThingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPrincipalThingsAsync(Model::ListPrincipalThingsRequest&& request, const ListPrincipalThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+        /**
+         * <p>Lists the principals associated with the specified thing.</p>
+         */
+        virtual Model::ListThingPrincipalsOutcome ListThingPrincipals(const Model::ListThingPrincipalsRequest& request) const;
+
+        /**
+         * <p>Lists the principals associated with the specified thing.</p>
+         *
          * returns a future to the operation so that it can be executed in parallel to other requests.
          */
         virtual Model::ListThingPrincipalsOutcomeCallable ListThingPrincipalsCallable(const Model::ListThingPrincipalsRequest& request) const;
@@ -1428,6 +1947,18 @@ namespace Model
          */
         virtual void ListThingPrincipalsAsync(const Model::ListThingPrincipalsRequest& request, const ListThingPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListThingPrincipalsCallable(const Model::ListThingPrincipalsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListThingPrincipalsOutcomeCallable ListThingPrincipalsCallable(Model::ListThingPrincipalsRequest&& request) const;
+
+        /**
+         * Same as ListThingPrincipalsAsync(const Model::ListThingPrincipalsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListThingPrincipalsAsync(Model::ListThingPrincipalsRequest&& request, const ListThingPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the existing thing types.</p>
          */
@@ -1447,6 +1978,18 @@ namespace Model
          */
         virtual void ListThingTypesAsync(const Model::ListThingTypesRequest& request, const ListThingTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListThingTypesCallable(const Model::ListThingTypesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListThingTypesOutcomeCallable ListThingTypesCallable(Model::ListThingTypesRequest&& request) const;
+
+        /**
+         * Same as ListThingTypesAsync(const Model::ListThingTypesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListThingTypesAsync(Model::ListThingTypesRequest&& request, const ListThingTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists your things. Use the <b>attributeName</b> and <b>attributeValue</b>
          * parameters to filter your things. For example, calling <code>ListThings</code>
@@ -1475,6 +2018,18 @@ namespace Model
          */
         virtual void ListThingsAsync(const Model::ListThingsRequest& request, const ListThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListThingsCallable(const Model::ListThingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListThingsOutcomeCallable ListThingsCallable(Model::ListThingsRequest&& request) const;
+
+        /**
+         * Same as ListThingsAsync(const Model::ListThingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListThingsAsync(Model::ListThingsRequest&& request, const ListThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the rules for the specific topic.</p>
          */
@@ -1494,6 +2049,18 @@ namespace Model
          */
         virtual void ListTopicRulesAsync(const Model::ListTopicRulesRequest& request, const ListTopicRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTopicRulesCallable(const Model::ListTopicRulesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTopicRulesOutcomeCallable ListTopicRulesCallable(Model::ListTopicRulesRequest&& request) const;
+
+        /**
+         * Same as ListTopicRulesAsync(const Model::ListTopicRulesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTopicRulesAsync(Model::ListTopicRulesRequest&& request, const ListTopicRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers a CA certificate with AWS IoT. This CA certificate can then be used
          * to sign device certificates, which can be then registered with AWS IoT. You can
@@ -1531,6 +2098,18 @@ namespace Model
          */
         virtual void RegisterCACertificateAsync(const Model::RegisterCACertificateRequest& request, const RegisterCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterCACertificateCallable(const Model::RegisterCACertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterCACertificateOutcomeCallable RegisterCACertificateCallable(Model::RegisterCACertificateRequest&& request) const;
+
+        /**
+         * Same as RegisterCACertificateAsync(const Model::RegisterCACertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterCACertificateAsync(Model::RegisterCACertificateRequest&& request, const RegisterCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers a device certificate with AWS IoT. If you have more than one CA
          * certificate that has the same subject field, you must specify the CA certificate
@@ -1556,6 +2135,18 @@ namespace Model
          */
         virtual void RegisterCertificateAsync(const Model::RegisterCertificateRequest& request, const RegisterCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterCertificateCallable(const Model::RegisterCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterCertificateOutcomeCallable RegisterCertificateCallable(Model::RegisterCertificateRequest&& request) const;
+
+        /**
+         * Same as RegisterCertificateAsync(const Model::RegisterCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterCertificateAsync(Model::RegisterCertificateRequest&& request, const RegisterCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Rejects a pending certificate transfer. After AWS IoT rejects a certificate
          * transfer, the certificate status changes from <b>PENDING_TRANSFER</b> to
@@ -1590,6 +2181,18 @@ namespace Model
          */
         virtual void RejectCertificateTransferAsync(const Model::RejectCertificateTransferRequest& request, const RejectCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RejectCertificateTransferCallable(const Model::RejectCertificateTransferRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RejectCertificateTransferOutcomeCallable RejectCertificateTransferCallable(Model::RejectCertificateTransferRequest&& request) const;
+
+        /**
+         * Same as RejectCertificateTransferAsync(const Model::RejectCertificateTransferRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RejectCertificateTransferAsync(Model::RejectCertificateTransferRequest&& request, const RejectCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Replaces the specified rule. You must specify all parameters for the new
          * rule. Creating rules is an administrator-level action. Any user who has
@@ -1618,6 +2221,18 @@ namespace Model
          */
         virtual void ReplaceTopicRuleAsync(const Model::ReplaceTopicRuleRequest& request, const ReplaceTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReplaceTopicRuleCallable(const Model::ReplaceTopicRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReplaceTopicRuleOutcomeCallable ReplaceTopicRuleCallable(Model::ReplaceTopicRuleRequest&& request) const;
+
+        /**
+         * Same as ReplaceTopicRuleAsync(const Model::ReplaceTopicRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReplaceTopicRuleAsync(Model::ReplaceTopicRuleRequest&& request, const ReplaceTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the specified version of the specified policy as the policy's default
          * (operative) version. This action affects all certificates to which the policy is
@@ -1646,6 +2261,18 @@ namespace Model
          */
         virtual void SetDefaultPolicyVersionAsync(const Model::SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetDefaultPolicyVersionCallable(const Model::SetDefaultPolicyVersionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetDefaultPolicyVersionOutcomeCallable SetDefaultPolicyVersionCallable(Model::SetDefaultPolicyVersionRequest&& request) const;
+
+        /**
+         * Same as SetDefaultPolicyVersionAsync(const Model::SetDefaultPolicyVersionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetDefaultPolicyVersionAsync(Model::SetDefaultPolicyVersionRequest&& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the logging options.</p>
          */
@@ -1665,6 +2292,18 @@ namespace Model
          */
         virtual void SetLoggingOptionsAsync(const Model::SetLoggingOptionsRequest& request, const SetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetLoggingOptionsCallable(const Model::SetLoggingOptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetLoggingOptionsOutcomeCallable SetLoggingOptionsCallable(Model::SetLoggingOptionsRequest&& request) const;
+
+        /**
+         * Same as SetLoggingOptionsAsync(const Model::SetLoggingOptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetLoggingOptionsAsync(Model::SetLoggingOptionsRequest&& request, const SetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Transfers the specified certificate to the specified AWS account.</p> <p>You
          * can cancel the transfer until it is acknowledged by the recipient.</p> <p>No
@@ -1702,6 +2341,18 @@ namespace Model
          */
         virtual void TransferCertificateAsync(const Model::TransferCertificateRequest& request, const TransferCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TransferCertificateCallable(const Model::TransferCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TransferCertificateOutcomeCallable TransferCertificateCallable(Model::TransferCertificateRequest&& request) const;
+
+        /**
+         * Same as TransferCertificateAsync(const Model::TransferCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TransferCertificateAsync(Model::TransferCertificateRequest&& request, const TransferCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a registered CA certificate.</p>
          */
@@ -1721,6 +2372,18 @@ namespace Model
          */
         virtual void UpdateCACertificateAsync(const Model::UpdateCACertificateRequest& request, const UpdateCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateCACertificateCallable(const Model::UpdateCACertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateCACertificateOutcomeCallable UpdateCACertificateCallable(Model::UpdateCACertificateRequest&& request) const;
+
+        /**
+         * Same as UpdateCACertificateAsync(const Model::UpdateCACertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateCACertificateAsync(Model::UpdateCACertificateRequest&& request, const UpdateCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the status of the specified certificate. This operation is
          * idempotent.</p> <p>Moving a certificate from the ACTIVE state (including
@@ -1752,6 +2415,18 @@ namespace Model
          */
         virtual void UpdateCertificateAsync(const Model::UpdateCertificateRequest& request, const UpdateCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateCertificateCallable(const Model::UpdateCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateCertificateOutcomeCallable UpdateCertificateCallable(Model::UpdateCertificateRequest&& request) const;
+
+        /**
+         * Same as UpdateCertificateAsync(const Model::UpdateCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateCertificateAsync(Model::UpdateCertificateRequest&& request, const UpdateCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the data for a thing.</p>
          */
@@ -1771,6 +2446,360 @@ namespace Model
          */
         virtual void UpdateThingAsync(const Model::UpdateThingRequest& request, const UpdateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateThingCallable(const Model::UpdateThingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateThingOutcomeCallable UpdateThingCallable(Model::UpdateThingRequest&& request) const;
+
+        /**
+         * Same as UpdateThingAsync(const Model::UpdateThingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateThingAsync(Model::UpdateThingRequest&& request, const UpdateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListCACertificates(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IoTClient, Model::ListCACertificatesRequest, Model::ListCACertificatesOutcome> ListCACertificatesPaginator(const Model::ListCACertificatesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListCertificates(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IoTClient, Model::ListCertificatesRequest, Model::ListCertificatesOutcome> ListCertificatesPaginator(const Model::ListCertificatesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListCertificatesByCA(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IoTClient, Model::ListCertificatesByCARequest, Model::ListCertificatesByCAOutcome> ListCertificatesByCAPaginator(const Model::ListCertificatesByCARequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListOutgoingCertificates(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IoTClient, Model::ListOutgoingCertificatesRequest, Model::ListOutgoingCertificatesOutcome> ListOutgoingCertificatesPaginator(const Model::ListOutgoingCertificatesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListPolicies(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IoTClient, Model::ListPoliciesRequest, Model::ListPoliciesOutcome> ListPoliciesPaginator(const Model::ListPoliciesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListPolicyPrincipals(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IoTClient, Model::ListPolicyPrincipalsRequest, Model::ListPolicyPrincipalsOutcome> ListPolicyPrincipalsPaginator(const Model::ListPolicyPrincipalsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListPrincipalPolicies(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IoTClient, Model::ListPrincipalPoliciesRequest, Model::ListPrincipalPoliciesOutcome> ListPrincipalPoliciesPaginator(const Model::ListPrincipalPoliciesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListPrincipalThings(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IoTClient, Model::ListPrincipalThingsRequest, Model::ListPrincipalThingsOutcome> ListPrincipalThingsPaginator(const Model::ListPrincipalThingsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListThingTypes(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IoTClient, Model::ListThingTypesRequest, Model::ListThingTypesOutcome> ListThingTypesPaginator(const Model::ListThingTypesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListThings(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IoTClient, Model::ListThingsRequest, Model::ListThingsOutcome> ListThingsPaginator(const Model::ListThingsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListTopicRules(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<IoTClient, Model::ListTopicRulesRequest, Model::ListTopicRulesOutcome> ListTopicRulesPaginator(const Model::ListTopicRulesRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AcceptCertificateTransfer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::AcceptCertificateTransferRequest, Model::AcceptCertificateTransferOutcome> AcceptCertificateTransferAwaitable(Model::AcceptCertificateTransferRequest request) const;
+
+        /**
+         * co_await-able form of AttachPrincipalPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::AttachPrincipalPolicyRequest, Model::AttachPrincipalPolicyOutcome> AttachPrincipalPolicyAwaitable(Model::AttachPrincipalPolicyRequest request) const;
+
+        /**
+         * co_await-able form of AttachThingPrincipal(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::AttachThingPrincipalRequest, Model::AttachThingPrincipalOutcome> AttachThingPrincipalAwaitable(Model::AttachThingPrincipalRequest request) const;
+
+        /**
+         * co_await-able form of CancelCertificateTransfer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::CancelCertificateTransferRequest, Model::CancelCertificateTransferOutcome> CancelCertificateTransferAwaitable(Model::CancelCertificateTransferRequest request) const;
+
+        /**
+         * co_await-able form of CreateCertificateFromCsr(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::CreateCertificateFromCsrRequest, Model::CreateCertificateFromCsrOutcome> CreateCertificateFromCsrAwaitable(Model::CreateCertificateFromCsrRequest request) const;
+
+        /**
+         * co_await-able form of CreateKeysAndCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::CreateKeysAndCertificateRequest, Model::CreateKeysAndCertificateOutcome> CreateKeysAndCertificateAwaitable(Model::CreateKeysAndCertificateRequest request) const;
+
+        /**
+         * co_await-able form of CreatePolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::CreatePolicyRequest, Model::CreatePolicyOutcome> CreatePolicyAwaitable(Model::CreatePolicyRequest request) const;
+
+        /**
+         * co_await-able form of CreatePolicyVersion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::CreatePolicyVersionRequest, Model::CreatePolicyVersionOutcome> CreatePolicyVersionAwaitable(Model::CreatePolicyVersionRequest request) const;
+
+        /**
+         * co_await-able form of CreateThing(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::CreateThingRequest, Model::CreateThingOutcome> CreateThingAwaitable(Model::CreateThingRequest request) const;
+
+        /**
+         * co_await-able form of CreateThingType(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::CreateThingTypeRequest, Model::CreateThingTypeOutcome> CreateThingTypeAwaitable(Model::CreateThingTypeRequest request) const;
+
+        /**
+         * co_await-able form of CreateTopicRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::CreateTopicRuleRequest, Model::CreateTopicRuleOutcome> CreateTopicRuleAwaitable(Model::CreateTopicRuleRequest request) const;
+
+        /**
+         * co_await-able form of DeleteCACertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DeleteCACertificateRequest, Model::DeleteCACertificateOutcome> DeleteCACertificateAwaitable(Model::DeleteCACertificateRequest request) const;
+
+        /**
+         * co_await-able form of DeleteCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DeleteCertificateRequest, Model::DeleteCertificateOutcome> DeleteCertificateAwaitable(Model::DeleteCertificateRequest request) const;
+
+        /**
+         * co_await-able form of DeletePolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DeletePolicyRequest, Model::DeletePolicyOutcome> DeletePolicyAwaitable(Model::DeletePolicyRequest request) const;
+
+        /**
+         * co_await-able form of DeletePolicyVersion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DeletePolicyVersionRequest, Model::DeletePolicyVersionOutcome> DeletePolicyVersionAwaitable(Model::DeletePolicyVersionRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRegistrationCode(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DeleteRegistrationCodeRequest, Model::DeleteRegistrationCodeOutcome> DeleteRegistrationCodeAwaitable(Model::DeleteRegistrationCodeRequest request) const;
+
+        /**
+         * co_await-able form of DeleteThing(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DeleteThingRequest, Model::DeleteThingOutcome> DeleteThingAwaitable(Model::DeleteThingRequest request) const;
+
+        /**
+         * co_await-able form of DeleteThingType(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DeleteThingTypeRequest, Model::DeleteThingTypeOutcome> DeleteThingTypeAwaitable(Model::DeleteThingTypeRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTopicRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DeleteTopicRuleRequest, Model::DeleteTopicRuleOutcome> DeleteTopicRuleAwaitable(Model::DeleteTopicRuleRequest request) const;
+
+        /**
+         * co_await-able form of DeprecateThingType(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DeprecateThingTypeRequest, Model::DeprecateThingTypeOutcome> DeprecateThingTypeAwaitable(Model::DeprecateThingTypeRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCACertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DescribeCACertificateRequest, Model::DescribeCACertificateOutcome> DescribeCACertificateAwaitable(Model::DescribeCACertificateRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DescribeCertificateRequest, Model::DescribeCertificateOutcome> DescribeCertificateAwaitable(Model::DescribeCertificateRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEndpoint(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DescribeEndpointRequest, Model::DescribeEndpointOutcome> DescribeEndpointAwaitable(Model::DescribeEndpointRequest request) const;
+
+        /**
+         * co_await-able form of DescribeThing(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DescribeThingRequest, Model::DescribeThingOutcome> DescribeThingAwaitable(Model::DescribeThingRequest request) const;
+
+        /**
+         * co_await-able form of DescribeThingType(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DescribeThingTypeRequest, Model::DescribeThingTypeOutcome> DescribeThingTypeAwaitable(Model::DescribeThingTypeRequest request) const;
+
+        /**
+         * co_await-able form of DetachPrincipalPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DetachPrincipalPolicyRequest, Model::DetachPrincipalPolicyOutcome> DetachPrincipalPolicyAwaitable(Model::DetachPrincipalPolicyRequest request) const;
+
+        /**
+         * co_await-able form of DetachThingPrincipal(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DetachThingPrincipalRequest, Model::DetachThingPrincipalOutcome> DetachThingPrincipalAwaitable(Model::DetachThingPrincipalRequest request) const;
+
+        /**
+         * co_await-able form of DisableTopicRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::DisableTopicRuleRequest, Model::DisableTopicRuleOutcome> DisableTopicRuleAwaitable(Model::DisableTopicRuleRequest request) const;
+
+        /**
+         * co_await-able form of EnableTopicRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::EnableTopicRuleRequest, Model::EnableTopicRuleOutcome> EnableTopicRuleAwaitable(Model::EnableTopicRuleRequest request) const;
+
+        /**
+         * co_await-able form of GetLoggingOptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::GetLoggingOptionsRequest, Model::GetLoggingOptionsOutcome> GetLoggingOptionsAwaitable(Model::GetLoggingOptionsRequest request) const;
+
+        /**
+         * co_await-able form of GetPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::GetPolicyRequest, Model::GetPolicyOutcome> GetPolicyAwaitable(Model::GetPolicyRequest request) const;
+
+        /**
+         * co_await-able form of GetPolicyVersion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::GetPolicyVersionRequest, Model::GetPolicyVersionOutcome> GetPolicyVersionAwaitable(Model::GetPolicyVersionRequest request) const;
+
+        /**
+         * co_await-able form of GetRegistrationCode(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::GetRegistrationCodeRequest, Model::GetRegistrationCodeOutcome> GetRegistrationCodeAwaitable(Model::GetRegistrationCodeRequest request) const;
+
+        /**
+         * co_await-able form of GetTopicRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::GetTopicRuleRequest, Model::GetTopicRuleOutcome> GetTopicRuleAwaitable(Model::GetTopicRuleRequest request) const;
+
+        /**
+         * co_await-able form of ListCACertificates(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::ListCACertificatesRequest, Model::ListCACertificatesOutcome> ListCACertificatesAwaitable(Model::ListCACertificatesRequest request) const;
+
+        /**
+         * co_await-able form of ListCertificates(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::ListCertificatesRequest, Model::ListCertificatesOutcome> ListCertificatesAwaitable(Model::ListCertificatesRequest request) const;
+
+        /**
+         * co_await-able form of ListCertificatesByCA(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::ListCertificatesByCARequest, Model::ListCertificatesByCAOutcome> ListCertificatesByCAAwaitable(Model::ListCertificatesByCARequest request) const;
+
+        /**
+         * co_await-able form of ListOutgoingCertificates(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::ListOutgoingCertificatesRequest, Model::ListOutgoingCertificatesOutcome> ListOutgoingCertificatesAwaitable(Model::ListOutgoingCertificatesRequest request) const;
+
+        /**
+         * co_await-able form of ListPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::ListPoliciesRequest, Model::ListPoliciesOutcome> ListPoliciesAwaitable(Model::ListPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of ListPolicyPrincipals(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::ListPolicyPrincipalsRequest, Model::ListPolicyPrincipalsOutcome> ListPolicyPrincipalsAwaitable(Model::ListPolicyPrincipalsRequest request) const;
+
+        /**
+         * co_await-able form of ListPolicyVersions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::ListPolicyVersionsRequest, Model::ListPolicyVersionsOutcome> ListPolicyVersionsAwaitable(Model::ListPolicyVersionsRequest request) const;
+
+        /**
+         * co_await-able form of ListPrincipalPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::ListPrincipalPoliciesRequest, Model::ListPrincipalPoliciesOutcome> ListPrincipalPoliciesAwaitable(Model::ListPrincipalPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of ListPrincipalThings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::ListPrincipalThingsRequest, Model::ListPrincipalThingsOutcome> ListPrincipalThingsAwaitable(Model::ListPrincipalThingsRequest request) const;
+
+        /**
+         * co_await-able form of ListThingPrincipals(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::ListThingPrincipalsRequest, Model::ListThingPrincipalsOutcome> ListThingPrincipalsAwaitable(Model::ListThingPrincipalsRequest request) const;
+
+        /**
+         * co_await-able form of ListThingTypes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::ListThingTypesRequest, Model::ListThingTypesOutcome> ListThingTypesAwaitable(Model::ListThingTypesRequest request) const;
+
+        /**
+         * co_await-able form of ListThings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::ListThingsRequest, Model::ListThingsOutcome> ListThingsAwaitable(Model::ListThingsRequest request) const;
+
+        /**
+         * co_await-able form of ListTopicRules(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::ListTopicRulesRequest, Model::ListTopicRulesOutcome> ListTopicRulesAwaitable(Model::ListTopicRulesRequest request) const;
+
+        /**
+         * co_await-able form of RegisterCACertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::RegisterCACertificateRequest, Model::RegisterCACertificateOutcome> RegisterCACertificateAwaitable(Model::RegisterCACertificateRequest request) const;
+
+        /**
+         * co_await-able form of RegisterCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::RegisterCertificateRequest, Model::RegisterCertificateOutcome> RegisterCertificateAwaitable(Model::RegisterCertificateRequest request) const;
+
+        /**
+         * co_await-able form of RejectCertificateTransfer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::RejectCertificateTransferRequest, Model::RejectCertificateTransferOutcome> RejectCertificateTransferAwaitable(Model::RejectCertificateTransferRequest request) const;
+
+        /**
+         * co_await-able form of ReplaceTopicRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::ReplaceTopicRuleRequest, Model::ReplaceTopicRuleOutcome> ReplaceTopicRuleAwaitable(Model::ReplaceTopicRuleRequest request) const;
+
+        /**
+         * co_await-able form of SetDefaultPolicyVersion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::SetDefaultPolicyVersionRequest, Model::SetDefaultPolicyVersionOutcome> SetDefaultPolicyVersionAwaitable(Model::SetDefaultPolicyVersionRequest request) const;
+
+        /**
+         * co_await-able form of SetLoggingOptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::SetLoggingOptionsRequest, Model::SetLoggingOptionsOutcome> SetLoggingOptionsAwaitable(Model::SetLoggingOptionsRequest request) const;
+
+        /**
+         * co_await-able form of TransferCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::TransferCertificateRequest, Model::TransferCertificateOutcome> TransferCertificateAwaitable(Model::TransferCertificateRequest request) const;
+
+        /**
+         * co_await-able form of UpdateCACertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::UpdateCACertificateRequest, Model::UpdateCACertificateOutcome> UpdateCACertificateAwaitable(Model::UpdateCACertificateRequest request) const;
+
+        /**
+         * co_await-able form of UpdateCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::UpdateCertificateRequest, Model::UpdateCertificateOutcome> UpdateCertificateAwaitable(Model::UpdateCertificateRequest request) const;
+
+        /**
+         * co_await-able form of UpdateThing(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<IoTClient, Model::UpdateThingRequest, Model::UpdateThingOutcome> UpdateThingAwaitable(Model::UpdateThingRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
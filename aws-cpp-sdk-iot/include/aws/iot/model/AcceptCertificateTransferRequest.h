@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     AcceptCertificateTransferRequest();
+    inline const char* GetServiceRequestName() const override { return "AcceptCertificateTransfer"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
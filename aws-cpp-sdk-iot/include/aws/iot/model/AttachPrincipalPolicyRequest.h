@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AttachPrincipalPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachPrincipalPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
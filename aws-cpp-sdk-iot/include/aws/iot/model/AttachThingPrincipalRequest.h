@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AttachThingPrincipalRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachThingPrincipal"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CancelCertificateTransferRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelCertificateTransfer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
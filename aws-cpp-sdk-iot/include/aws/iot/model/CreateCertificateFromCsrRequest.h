@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     CreateCertificateFromCsrRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateCertificateFromCsr"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateKeysAndCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateKeysAndCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
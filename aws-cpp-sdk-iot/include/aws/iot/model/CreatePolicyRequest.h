@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreatePolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "CreatePolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     CreatePolicyVersionRequest();
+    inline const char* GetServiceRequestName() const override { return "CreatePolicyVersion"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateThingRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateThing"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateThingTypeRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateThingType"; }
+
     Aws::String SerializePayload() const override;
 
     /**
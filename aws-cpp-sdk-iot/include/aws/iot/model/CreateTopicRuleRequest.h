@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateTopicRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateTopicRule"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteCACertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteCACertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
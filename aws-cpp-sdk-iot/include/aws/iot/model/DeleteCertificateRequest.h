@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeletePolicyVersionRequest();
+    inline const char* GetServiceRequestName() const override { return "DeletePolicyVersion"; }
+
     Aws::String SerializePayload() const override;
 
     /**
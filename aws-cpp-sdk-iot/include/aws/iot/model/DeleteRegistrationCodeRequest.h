@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteRegistrationCodeRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteRegistrationCode"; }
+
     Aws::String SerializePayload() const override;
 
   };
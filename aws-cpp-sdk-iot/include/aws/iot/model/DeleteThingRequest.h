@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     DeleteThingRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteThing"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteThingTypeRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteThingType"; }
+
     Aws::String SerializePayload() const override;
 
     /**
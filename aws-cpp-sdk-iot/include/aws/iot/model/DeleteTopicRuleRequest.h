@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteTopicRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteTopicRule"; }
+
     Aws::String SerializePayload() const override;
 
     /**
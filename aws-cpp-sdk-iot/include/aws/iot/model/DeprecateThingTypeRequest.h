@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeprecateThingTypeRequest();
+    inline const char* GetServiceRequestName() const override { return "DeprecateThingType"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeCACertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCACertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeEndpointRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEndpoint"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeThingRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeThing"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeThingTypeRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeThingType"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DetachPrincipalPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachPrincipalPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DetachThingPrincipalRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachThingPrincipal"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
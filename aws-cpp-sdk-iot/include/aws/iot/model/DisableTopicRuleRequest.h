@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DisableTopicRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableTopicRule"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     EnableTopicRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableTopicRule"; }
+
     Aws::String SerializePayload() const override;
 
     /**
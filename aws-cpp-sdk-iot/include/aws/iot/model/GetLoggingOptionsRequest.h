@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetLoggingOptionsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetLoggingOptions"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetRegistrationCodeRequest();
+    inline const char* GetServiceRequestName() const override { return "GetRegistrationCode"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetTopicRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "GetTopicRule"; }
+
     Aws::String SerializePayload() const override;
 
     /**
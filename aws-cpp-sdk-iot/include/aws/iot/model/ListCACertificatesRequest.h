@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListCACertificatesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListCACertificates"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
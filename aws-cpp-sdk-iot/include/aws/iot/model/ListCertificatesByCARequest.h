@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListCertificatesByCARequest();
+    inline const char* GetServiceRequestName() const override { return "ListCertificatesByCA"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
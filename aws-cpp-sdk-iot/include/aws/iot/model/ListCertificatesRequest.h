@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListCertificatesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListCertificates"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListOutgoingCertificatesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListOutgoingCertificates"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
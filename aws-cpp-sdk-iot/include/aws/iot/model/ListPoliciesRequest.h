@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListPolicyPrincipalsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListPolicyPrincipals"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListPrincipalPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListPrincipalPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListPrincipalThingsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListPrincipalThings"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
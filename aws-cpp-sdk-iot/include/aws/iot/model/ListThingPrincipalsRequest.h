@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListThingPrincipalsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListThingPrincipals"; }
+
     Aws::String SerializePayload() const override;
 
     /**
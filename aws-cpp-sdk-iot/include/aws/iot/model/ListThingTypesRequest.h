@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListThingTypesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListThingTypes"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
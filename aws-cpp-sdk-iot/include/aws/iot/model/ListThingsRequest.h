@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListThingsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListThings"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListTopicRulesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTopicRules"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
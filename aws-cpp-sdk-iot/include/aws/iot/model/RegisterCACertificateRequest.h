@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     RegisterCACertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterCACertificate"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
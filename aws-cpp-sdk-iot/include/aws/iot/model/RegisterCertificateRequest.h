@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     RegisterCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
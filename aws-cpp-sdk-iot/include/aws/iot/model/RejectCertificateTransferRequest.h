@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RejectCertificateTransferRequest();
+    inline const char* GetServiceRequestName() const override { return "RejectCertificateTransfer"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ReplaceTopicRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "ReplaceTopicRule"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     SetLoggingOptionsRequest();
+    inline const char* GetServiceRequestName() const override { return "SetLoggingOptions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     TransferCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "TransferCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     UpdateCACertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateCACertificate"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
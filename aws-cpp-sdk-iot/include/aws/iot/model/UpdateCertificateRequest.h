@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     UpdateCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateThingRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateThing"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -167,7 +167,7 @@ AcceptCertificateTransferOutcome IoTClient::AcceptCertificateTransfer(const Acce
 
 AcceptCertificateTransferOutcomeCallable IoTClient::AcceptCertificateTransferCallable(const AcceptCertificateTransferRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AcceptCertificateTransfer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AcceptCertificateTransfer(request); } );
 }
 
 void IoTClient::AcceptCertificateTransferAsync(const AcceptCertificateTransferRequest& request, const AcceptCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -175,6 +175,16 @@ void IoTClient::AcceptCertificateTransferAsync(const AcceptCertificateTransferRe
   m_executor->Submit( [this, request, handler, context](){ this->AcceptCertificateTransferAsyncHelper( request, handler, context ); } );
 }
 
+AcceptCertificateTransferOutcomeCallable IoTClient::AcceptCertificateTransferCallable(AcceptCertificateTransferRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::AcceptCertificateTransfer, this, std::move(request)));
+}
+
+void IoTClient::AcceptCertificateTransferAsync(AcceptCertificateTransferRequest&& request, const AcceptCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::AcceptCertificateTransferAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::AcceptCertificateTransferAsyncHelper(const AcceptCertificateTransferRequest& request, const AcceptCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AcceptCertificateTransfer(request), context);
@@ -199,7 +209,7 @@ AttachPrincipalPolicyOutcome IoTClient::AttachPrincipalPolicy(const AttachPrinci
 
 AttachPrincipalPolicyOutcomeCallable IoTClient::AttachPrincipalPolicyCallable(const AttachPrincipalPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachPrincipalPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachPrincipalPolicy(request); } );
 }
 
 void IoTClient::AttachPrincipalPolicyAsync(const AttachPrincipalPolicyRequest& request, const AttachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -207,6 +217,16 @@ void IoTClient::AttachPrincipalPolicyAsync(const AttachPrincipalPolicyRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->AttachPrincipalPolicyAsyncHelper( request, handler, context ); } );
 }
 
+AttachPrincipalPolicyOutcomeCallable IoTClient::AttachPrincipalPolicyCallable(AttachPrincipalPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::AttachPrincipalPolicy, this, std::move(request)));
+}
+
+void IoTClient::AttachPrincipalPolicyAsync(AttachPrincipalPolicyRequest&& request, const AttachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::AttachPrincipalPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::AttachPrincipalPolicyAsyncHelper(const AttachPrincipalPolicyRequest& request, const AttachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachPrincipalPolicy(request), context);
@@ -232,7 +252,7 @@ AttachThingPrincipalOutcome IoTClient::AttachThingPrincipal(const AttachThingPri
 
 AttachThingPrincipalOutcomeCallable IoTClient::AttachThingPrincipalCallable(const AttachThingPrincipalRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachThingPrincipal(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachThingPrincipal(request); } );
 }
 
 void IoTClient::AttachThingPrincipalAsync(const AttachThingPrincipalRequest& request, const AttachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -240,6 +260,16 @@ void IoTClient::AttachThingPrincipalAsync(const AttachThingPrincipalRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->AttachThingPrincipalAsyncHelper( request, handler, context ); } );
 }
 
+AttachThingPrincipalOutcomeCallable IoTClient::AttachThingPrincipalCallable(AttachThingPrincipalRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::AttachThingPrincipal, this, std::move(request)));
+}
+
+void IoTClient::AttachThingPrincipalAsync(AttachThingPrincipalRequest&& request, const AttachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::AttachThingPrincipalAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::AttachThingPrincipalAsyncHelper(const AttachThingPrincipalRequest& request, const AttachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachThingPrincipal(request), context);
@@ -264,7 +294,7 @@ CancelCertificateTransferOutcome IoTClient::CancelCertificateTransfer(const Canc
 
 CancelCertificateTransferOutcomeCallable IoTClient::CancelCertificateTransferCallable(const CancelCertificateTransferRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelCertificateTransfer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelCertificateTransfer(request); } );
 }
 
 void IoTClient::CancelCertificateTransferAsync(const CancelCertificateTransferRequest& request, const CancelCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -272,6 +302,16 @@ void IoTClient::CancelCertificateTransferAsync(const CancelCertificateTransferRe
   m_executor->Submit( [this, request, handler, context](){ this->CancelCertificateTransferAsyncHelper( request, handler, context ); } );
 }
 
+CancelCertificateTransferOutcomeCallable IoTClient::CancelCertificateTransferCallable(CancelCertificateTransferRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::CancelCertificateTransfer, this, std::move(request)));
+}
+
+void IoTClient::CancelCertificateTransferAsync(CancelCertificateTransferRequest&& request, const CancelCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::CancelCertificateTransferAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::CancelCertificateTransferAsyncHelper(const CancelCertificateTransferRequest& request, const CancelCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelCertificateTransfer(request), context);
@@ -295,7 +335,7 @@ CreateCertificateFromCsrOutcome IoTClient::CreateCertificateFromCsr(const Create
 
 CreateCertificateFromCsrOutcomeCallable IoTClient::CreateCertificateFromCsrCallable(const CreateCertificateFromCsrRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateCertificateFromCsr(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateCertificateFromCsr(request); } );
 }
 
 void IoTClient::CreateCertificateFromCsrAsync(const CreateCertificateFromCsrRequest& request, const CreateCertificateFromCsrResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -303,6 +343,16 @@ void IoTClient::CreateCertificateFromCsrAsync(const CreateCertificateFromCsrRequ
   m_executor->Submit( [this, request, handler, context](){ this->CreateCertificateFromCsrAsyncHelper( request, handler, context ); } );
 }
 
+CreateCertificateFromCsrOutcomeCallable IoTClient::CreateCertificateFromCsrCallable(CreateCertificateFromCsrRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::CreateCertificateFromCsr, this, std::move(request)));
+}
+
+void IoTClient::CreateCertificateFromCsrAsync(CreateCertificateFromCsrRequest&& request, const CreateCertificateFromCsrResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::CreateCertificateFromCsrAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::CreateCertificateFromCsrAsyncHelper(const CreateCertificateFromCsrRequest& request, const CreateCertificateFromCsrResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateCertificateFromCsr(request), context);
@@ -326,7 +376,7 @@ CreateKeysAndCertificateOutcome IoTClient::CreateKeysAndCertificate(const Create
 
 CreateKeysAndCertificateOutcomeCallable IoTClient::CreateKeysAndCertificateCallable(const CreateKeysAndCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateKeysAndCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateKeysAndCertificate(request); } );
 }
 
 void IoTClient::CreateKeysAndCertificateAsync(const CreateKeysAndCertificateRequest& request, const CreateKeysAndCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -334,6 +384,16 @@ void IoTClient::CreateKeysAndCertificateAsync(const CreateKeysAndCertificateRequ
   m_executor->Submit( [this, request, handler, context](){ this->CreateKeysAndCertificateAsyncHelper( request, handler, context ); } );
 }
 
+CreateKeysAndCertificateOutcomeCallable IoTClient::CreateKeysAndCertificateCallable(CreateKeysAndCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::CreateKeysAndCertificate, this, std::move(request)));
+}
+
+void IoTClient::CreateKeysAndCertificateAsync(CreateKeysAndCertificateRequest&& request, const CreateKeysAndCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::CreateKeysAndCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::CreateKeysAndCertificateAsyncHelper(const CreateKeysAndCertificateRequest& request, const CreateKeysAndCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateKeysAndCertificate(request), context);
@@ -358,7 +418,7 @@ CreatePolicyOutcome IoTClient::CreatePolicy(const CreatePolicyRequest& request)
 
 CreatePolicyOutcomeCallable IoTClient::CreatePolicyCallable(const CreatePolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreatePolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreatePolicy(request); } );
 }
 
 void IoTClient::CreatePolicyAsync(const CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -366,6 +426,16 @@ void IoTClient::CreatePolicyAsync(const CreatePolicyRequest& request, const Crea
   m_executor->Submit( [this, request, handler, context](){ this->CreatePolicyAsyncHelper( request, handler, context ); } );
 }
 
+CreatePolicyOutcomeCallable IoTClient::CreatePolicyCallable(CreatePolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::CreatePolicy, this, std::move(request)));
+}
+
+void IoTClient::CreatePolicyAsync(CreatePolicyRequest&& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::CreatePolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::CreatePolicyAsyncHelper(const CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreatePolicy(request), context);
@@ -391,7 +461,7 @@ CreatePolicyVersionOutcome IoTClient::CreatePolicyVersion(const CreatePolicyVers
 
 CreatePolicyVersionOutcomeCallable IoTClient::CreatePolicyVersionCallable(const CreatePolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreatePolicyVersion(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreatePolicyVersion(request); } );
 }
 
 void IoTClient::CreatePolicyVersionAsync(const CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -399,6 +469,16 @@ void IoTClient::CreatePolicyVersionAsync(const CreatePolicyVersionRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->CreatePolicyVersionAsyncHelper( request, handler, context ); } );
 }
 
+CreatePolicyVersionOutcomeCallable IoTClient::CreatePolicyVersionCallable(CreatePolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::CreatePolicyVersion, this, std::move(request)));
+}
+
+void IoTClient::CreatePolicyVersionAsync(CreatePolicyVersionRequest&& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::CreatePolicyVersionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::CreatePolicyVersionAsyncHelper(const CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreatePolicyVersion(request), context);
@@ -423,7 +503,7 @@ CreateThingOutcome IoTClient::CreateThing(const CreateThingRequest& request) con
 
 CreateThingOutcomeCallable IoTClient::CreateThingCallable(const CreateThingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateThing(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateThing(request); } );
 }
 
 void IoTClient::CreateThingAsync(const CreateThingRequest& request, const CreateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -431,6 +511,16 @@ void IoTClient::CreateThingAsync(const CreateThingRequest& request, const Create
   m_executor->Submit( [this, request, handler, context](){ this->CreateThingAsyncHelper( request, handler, context ); } );
 }
 
+CreateThingOutcomeCallable IoTClient::CreateThingCallable(CreateThingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::CreateThing, this, std::move(request)));
+}
+
+void IoTClient::CreateThingAsync(CreateThingRequest&& request, const CreateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::CreateThingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::CreateThingAsyncHelper(const CreateThingRequest& request, const CreateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateThing(request), context);
@@ -455,7 +545,7 @@ CreateThingTypeOutcome IoTClient::CreateThingType(const CreateThingTypeRequest&
 
 CreateThingTypeOutcomeCallable IoTClient::CreateThingTypeCallable(const CreateThingTypeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateThingType(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateThingType(request); } );
 }
 
 void IoTClient::CreateThingTypeAsync(const CreateThingTypeRequest& request, const CreateThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -463,6 +553,16 @@ void IoTClient::CreateThingTypeAsync(const CreateThingTypeRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->CreateThingTypeAsyncHelper( request, handler, context ); } );
 }
 
+CreateThingTypeOutcomeCallable IoTClient::CreateThingTypeCallable(CreateThingTypeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::CreateThingType, this, std::move(request)));
+}
+
+void IoTClient::CreateThingTypeAsync(CreateThingTypeRequest&& request, const CreateThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::CreateThingTypeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::CreateThingTypeAsyncHelper(const CreateThingTypeRequest& request, const CreateThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateThingType(request), context);
@@ -487,7 +587,7 @@ CreateTopicRuleOutcome IoTClient::CreateTopicRule(const CreateTopicRuleRequest&
 
 CreateTopicRuleOutcomeCallable IoTClient::CreateTopicRuleCallable(const CreateTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateTopicRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateTopicRule(request); } );
 }
 
 void IoTClient::CreateTopicRuleAsync(const CreateTopicRuleRequest& request, const CreateTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -495,6 +595,16 @@ void IoTClient::CreateTopicRuleAsync(const CreateTopicRuleRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->CreateTopicRuleAsyncHelper( request, handler, context ); } );
 }
 
+CreateTopicRuleOutcomeCallable IoTClient::CreateTopicRuleCallable(CreateTopicRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::CreateTopicRule, this, std::move(request)));
+}
+
+void IoTClient::CreateTopicRuleAsync(CreateTopicRuleRequest&& request, const CreateTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::CreateTopicRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::CreateTopicRuleAsyncHelper(const CreateTopicRuleRequest& request, const CreateTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateTopicRule(request), context);
@@ -519,7 +629,7 @@ DeleteCACertificateOutcome IoTClient::DeleteCACertificate(const DeleteCACertific
 
 DeleteCACertificateOutcomeCallable IoTClient::DeleteCACertificateCallable(const DeleteCACertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteCACertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteCACertificate(request); } );
 }
 
 void IoTClient::DeleteCACertificateAsync(const DeleteCACertificateRequest& request, const DeleteCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -527,6 +637,16 @@ void IoTClient::DeleteCACertificateAsync(const DeleteCACertificateRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DeleteCACertificateAsyncHelper( request, handler, context ); } );
 }
 
+DeleteCACertificateOutcomeCallable IoTClient::DeleteCACertificateCallable(DeleteCACertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DeleteCACertificate, this, std::move(request)));
+}
+
+void IoTClient::DeleteCACertificateAsync(DeleteCACertificateRequest&& request, const DeleteCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DeleteCACertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DeleteCACertificateAsyncHelper(const DeleteCACertificateRequest& request, const DeleteCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteCACertificate(request), context);
@@ -551,7 +671,7 @@ DeleteCertificateOutcome IoTClient::DeleteCertificate(const DeleteCertificateReq
 
 DeleteCertificateOutcomeCallable IoTClient::DeleteCertificateCallable(const DeleteCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteCertificate(request); } );
 }
 
 void IoTClient::DeleteCertificateAsync(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -559,6 +679,16 @@ void IoTClient::DeleteCertificateAsync(const DeleteCertificateRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DeleteCertificateAsyncHelper( request, handler, context ); } );
 }
 
+DeleteCertificateOutcomeCallable IoTClient::DeleteCertificateCallable(DeleteCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DeleteCertificate, this, std::move(request)));
+}
+
+void IoTClient::DeleteCertificateAsync(DeleteCertificateRequest&& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DeleteCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DeleteCertificateAsyncHelper(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteCertificate(request), context);
@@ -583,7 +713,7 @@ DeletePolicyOutcome IoTClient::DeletePolicy(const DeletePolicyRequest& request)
 
 DeletePolicyOutcomeCallable IoTClient::DeletePolicyCallable(const DeletePolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeletePolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeletePolicy(request); } );
 }
 
 void IoTClient::DeletePolicyAsync(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -591,6 +721,16 @@ void IoTClient::DeletePolicyAsync(const DeletePolicyRequest& request, const Dele
   m_executor->Submit( [this, request, handler, context](){ this->DeletePolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeletePolicyOutcomeCallable IoTClient::DeletePolicyCallable(DeletePolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DeletePolicy, this, std::move(request)));
+}
+
+void IoTClient::DeletePolicyAsync(DeletePolicyRequest&& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DeletePolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DeletePolicyAsyncHelper(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeletePolicy(request), context);
@@ -617,7 +757,7 @@ DeletePolicyVersionOutcome IoTClient::DeletePolicyVersion(const DeletePolicyVers
 
 DeletePolicyVersionOutcomeCallable IoTClient::DeletePolicyVersionCallable(const DeletePolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeletePolicyVersion(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeletePolicyVersion(request); } );
 }
 
 void IoTClient::DeletePolicyVersionAsync(const DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -625,6 +765,16 @@ void IoTClient::DeletePolicyVersionAsync(const DeletePolicyVersionRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DeletePolicyVersionAsyncHelper( request, handler, context ); } );
 }
 
+DeletePolicyVersionOutcomeCallable IoTClient::DeletePolicyVersionCallable(DeletePolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DeletePolicyVersion, this, std::move(request)));
+}
+
+void IoTClient::DeletePolicyVersionAsync(DeletePolicyVersionRequest&& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DeletePolicyVersionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DeletePolicyVersionAsyncHelper(const DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeletePolicyVersion(request), context);
@@ -648,7 +798,7 @@ DeleteRegistrationCodeOutcome IoTClient::DeleteRegistrationCode(const DeleteRegi
 
 DeleteRegistrationCodeOutcomeCallable IoTClient::DeleteRegistrationCodeCallable(const DeleteRegistrationCodeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRegistrationCode(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRegistrationCode(request); } );
 }
 
 void IoTClient::DeleteRegistrationCodeAsync(const DeleteRegistrationCodeRequest& request, const DeleteRegistrationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -656,6 +806,16 @@ void IoTClient::DeleteRegistrationCodeAsync(const DeleteRegistrationCodeRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRegistrationCodeAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRegistrationCodeOutcomeCallable IoTClient::DeleteRegistrationCodeCallable(DeleteRegistrationCodeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DeleteRegistrationCode, this, std::move(request)));
+}
+
+void IoTClient::DeleteRegistrationCodeAsync(DeleteRegistrationCodeRequest&& request, const DeleteRegistrationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DeleteRegistrationCodeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DeleteRegistrationCodeAsyncHelper(const DeleteRegistrationCodeRequest& request, const DeleteRegistrationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRegistrationCode(request), context);
@@ -680,7 +840,7 @@ DeleteThingOutcome IoTClient::DeleteThing(const DeleteThingRequest& request) con
 
 DeleteThingOutcomeCallable IoTClient::DeleteThingCallable(const DeleteThingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteThing(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteThing(request); } );
 }
 
 void IoTClient::DeleteThingAsync(const DeleteThingRequest& request, const DeleteThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -688,6 +848,16 @@ void IoTClient::DeleteThingAsync(const DeleteThingRequest& request, const Delete
   m_executor->Submit( [this, request, handler, context](){ this->DeleteThingAsyncHelper( request, handler, context ); } );
 }
 
+DeleteThingOutcomeCallable IoTClient::DeleteThingCallable(DeleteThingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DeleteThing, this, std::move(request)));
+}
+
+void IoTClient::DeleteThingAsync(DeleteThingRequest&& request, const DeleteThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DeleteThingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DeleteThingAsyncHelper(const DeleteThingRequest& request, const DeleteThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteThing(request), context);
@@ -712,7 +882,7 @@ DeleteThingTypeOutcome IoTClient::DeleteThingType(const DeleteThingTypeRequest&
 
 DeleteThingTypeOutcomeCallable IoTClient::DeleteThingTypeCallable(const DeleteThingTypeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteThingType(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteThingType(request); } );
 }
 
 void IoTClient::DeleteThingTypeAsync(const DeleteThingTypeRequest& request, const DeleteThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -720,6 +890,16 @@ void IoTClient::DeleteThingTypeAsync(const DeleteThingTypeRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->DeleteThingTypeAsyncHelper( request, handler, context ); } );
 }
 
+DeleteThingTypeOutcomeCallable IoTClient::DeleteThingTypeCallable(DeleteThingTypeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DeleteThingType, this, std::move(request)));
+}
+
+void IoTClient::DeleteThingTypeAsync(DeleteThingTypeRequest&& request, const DeleteThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DeleteThingTypeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DeleteThingTypeAsyncHelper(const DeleteThingTypeRequest& request, const DeleteThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteThingType(request), context);
@@ -744,7 +924,7 @@ DeleteTopicRuleOutcome IoTClient::DeleteTopicRule(const DeleteTopicRuleRequest&
 
 DeleteTopicRuleOutcomeCallable IoTClient::DeleteTopicRuleCallable(const DeleteTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTopicRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTopicRule(request); } );
 }
 
 void IoTClient::DeleteTopicRuleAsync(const DeleteTopicRuleRequest& request, const DeleteTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -752,6 +932,16 @@ void IoTClient::DeleteTopicRuleAsync(const DeleteTopicRuleRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTopicRuleAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTopicRuleOutcomeCallable IoTClient::DeleteTopicRuleCallable(DeleteTopicRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DeleteTopicRule, this, std::move(request)));
+}
+
+void IoTClient::DeleteTopicRuleAsync(DeleteTopicRuleRequest&& request, const DeleteTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DeleteTopicRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DeleteTopicRuleAsyncHelper(const DeleteTopicRuleRequest& request, const DeleteTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTopicRule(request), context);
@@ -777,7 +967,7 @@ DeprecateThingTypeOutcome IoTClient::DeprecateThingType(const DeprecateThingType
 
 DeprecateThingTypeOutcomeCallable IoTClient::DeprecateThingTypeCallable(const DeprecateThingTypeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeprecateThingType(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeprecateThingType(request); } );
 }
 
 void IoTClient::DeprecateThingTypeAsync(const DeprecateThingTypeRequest& request, const DeprecateThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -785,6 +975,16 @@ void IoTClient::DeprecateThingTypeAsync(const DeprecateThingTypeRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DeprecateThingTypeAsyncHelper( request, handler, context ); } );
 }
 
+DeprecateThingTypeOutcomeCallable IoTClient::DeprecateThingTypeCallable(DeprecateThingTypeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DeprecateThingType, this, std::move(request)));
+}
+
+void IoTClient::DeprecateThingTypeAsync(DeprecateThingTypeRequest&& request, const DeprecateThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DeprecateThingTypeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DeprecateThingTypeAsyncHelper(const DeprecateThingTypeRequest& request, const DeprecateThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeprecateThingType(request), context);
@@ -809,7 +1009,7 @@ DescribeCACertificateOutcome IoTClient::DescribeCACertificate(const DescribeCACe
 
 DescribeCACertificateOutcomeCallable IoTClient::DescribeCACertificateCallable(const DescribeCACertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCACertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCACertificate(request); } );
 }
 
 void IoTClient::DescribeCACertificateAsync(const DescribeCACertificateRequest& request, const DescribeCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -817,6 +1017,16 @@ void IoTClient::DescribeCACertificateAsync(const DescribeCACertificateRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCACertificateAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCACertificateOutcomeCallable IoTClient::DescribeCACertificateCallable(DescribeCACertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DescribeCACertificate, this, std::move(request)));
+}
+
+void IoTClient::DescribeCACertificateAsync(DescribeCACertificateRequest&& request, const DescribeCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DescribeCACertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DescribeCACertificateAsyncHelper(const DescribeCACertificateRequest& request, const DescribeCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCACertificate(request), context);
@@ -841,7 +1051,7 @@ DescribeCertificateOutcome IoTClient::DescribeCertificate(const DescribeCertific
 
 DescribeCertificateOutcomeCallable IoTClient::DescribeCertificateCallable(const DescribeCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCertificate(request); } );
 }
 
 void IoTClient::DescribeCertificateAsync(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -849,6 +1059,16 @@ void IoTClient::DescribeCertificateAsync(const DescribeCertificateRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCertificateAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCertificateOutcomeCallable IoTClient::DescribeCertificateCallable(DescribeCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DescribeCertificate, this, std::move(request)));
+}
+
+void IoTClient::DescribeCertificateAsync(DescribeCertificateRequest&& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DescribeCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DescribeCertificateAsyncHelper(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCertificate(request), context);
@@ -872,7 +1092,7 @@ DescribeEndpointOutcome IoTClient::DescribeEndpoint(const DescribeEndpointReques
 
 DescribeEndpointOutcomeCallable IoTClient::DescribeEndpointCallable(const DescribeEndpointRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEndpoint(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEndpoint(request); } );
 }
 
 void IoTClient::DescribeEndpointAsync(const DescribeEndpointRequest& request, const DescribeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -880,6 +1100,16 @@ void IoTClient::DescribeEndpointAsync(const DescribeEndpointRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEndpointAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEndpointOutcomeCallable IoTClient::DescribeEndpointCallable(DescribeEndpointRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DescribeEndpoint, this, std::move(request)));
+}
+
+void IoTClient::DescribeEndpointAsync(DescribeEndpointRequest&& request, const DescribeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DescribeEndpointAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DescribeEndpointAsyncHelper(const DescribeEndpointRequest& request, const DescribeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEndpoint(request), context);
@@ -904,7 +1134,7 @@ DescribeThingOutcome IoTClient::DescribeThing(const DescribeThingRequest& reques
 
 DescribeThingOutcomeCallable IoTClient::DescribeThingCallable(const DescribeThingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeThing(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeThing(request); } );
 }
 
 void IoTClient::DescribeThingAsync(const DescribeThingRequest& request, const DescribeThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -912,6 +1142,16 @@ void IoTClient::DescribeThingAsync(const DescribeThingRequest& request, const De
   m_executor->Submit( [this, request, handler, context](){ this->DescribeThingAsyncHelper( request, handler, context ); } );
 }
 
+DescribeThingOutcomeCallable IoTClient::DescribeThingCallable(DescribeThingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DescribeThing, this, std::move(request)));
+}
+
+void IoTClient::DescribeThingAsync(DescribeThingRequest&& request, const DescribeThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DescribeThingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DescribeThingAsyncHelper(const DescribeThingRequest& request, const DescribeThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeThing(request), context);
@@ -936,7 +1176,7 @@ DescribeThingTypeOutcome IoTClient::DescribeThingType(const DescribeThingTypeReq
 
 DescribeThingTypeOutcomeCallable IoTClient::DescribeThingTypeCallable(const DescribeThingTypeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeThingType(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeThingType(request); } );
 }
 
 void IoTClient::DescribeThingTypeAsync(const DescribeThingTypeRequest& request, const DescribeThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -944,6 +1184,16 @@ void IoTClient::DescribeThingTypeAsync(const DescribeThingTypeRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DescribeThingTypeAsyncHelper( request, handler, context ); } );
 }
 
+DescribeThingTypeOutcomeCallable IoTClient::DescribeThingTypeCallable(DescribeThingTypeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DescribeThingType, this, std::move(request)));
+}
+
+void IoTClient::DescribeThingTypeAsync(DescribeThingTypeRequest&& request, const DescribeThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DescribeThingTypeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DescribeThingTypeAsyncHelper(const DescribeThingTypeRequest& request, const DescribeThingTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeThingType(request), context);
@@ -968,7 +1218,7 @@ DetachPrincipalPolicyOutcome IoTClient::DetachPrincipalPolicy(const DetachPrinci
 
 DetachPrincipalPolicyOutcomeCallable IoTClient::DetachPrincipalPolicyCallable(const DetachPrincipalPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachPrincipalPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachPrincipalPolicy(request); } );
 }
 
 void IoTClient::DetachPrincipalPolicyAsync(const DetachPrincipalPolicyRequest& request, const DetachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -976,6 +1226,16 @@ void IoTClient::DetachPrincipalPolicyAsync(const DetachPrincipalPolicyRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DetachPrincipalPolicyAsyncHelper( request, handler, context ); } );
 }
 
+DetachPrincipalPolicyOutcomeCallable IoTClient::DetachPrincipalPolicyCallable(DetachPrincipalPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DetachPrincipalPolicy, this, std::move(request)));
+}
+
+void IoTClient::DetachPrincipalPolicyAsync(DetachPrincipalPolicyRequest&& request, const DetachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DetachPrincipalPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DetachPrincipalPolicyAsyncHelper(const DetachPrincipalPolicyRequest& request, const DetachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachPrincipalPolicy(request), context);
@@ -1001,7 +1261,7 @@ DetachThingPrincipalOutcome IoTClient::DetachThingPrincipal(const DetachThingPri
 
 DetachThingPrincipalOutcomeCallable IoTClient::DetachThingPrincipalCallable(const DetachThingPrincipalRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachThingPrincipal(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachThingPrincipal(request); } );
 }
 
 void IoTClient::DetachThingPrincipalAsync(const DetachThingPrincipalRequest& request, const DetachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1009,6 +1269,16 @@ void IoTClient::DetachThingPrincipalAsync(const DetachThingPrincipalRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DetachThingPrincipalAsyncHelper( request, handler, context ); } );
 }
 
+DetachThingPrincipalOutcomeCallable IoTClient::DetachThingPrincipalCallable(DetachThingPrincipalRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DetachThingPrincipal, this, std::move(request)));
+}
+
+void IoTClient::DetachThingPrincipalAsync(DetachThingPrincipalRequest&& request, const DetachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DetachThingPrincipalAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DetachThingPrincipalAsyncHelper(const DetachThingPrincipalRequest& request, const DetachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachThingPrincipal(request), context);
@@ -1034,7 +1304,7 @@ DisableTopicRuleOutcome IoTClient::DisableTopicRule(const DisableTopicRuleReques
 
 DisableTopicRuleOutcomeCallable IoTClient::DisableTopicRuleCallable(const DisableTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableTopicRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableTopicRule(request); } );
 }
 
 void IoTClient::DisableTopicRuleAsync(const DisableTopicRuleRequest& request, const DisableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1042,6 +1312,16 @@ void IoTClient::DisableTopicRuleAsync(const DisableTopicRuleRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DisableTopicRuleAsyncHelper( request, handler, context ); } );
 }
 
+DisableTopicRuleOutcomeCallable IoTClient::DisableTopicRuleCallable(DisableTopicRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::DisableTopicRule, this, std::move(request)));
+}
+
+void IoTClient::DisableTopicRuleAsync(DisableTopicRuleRequest&& request, const DisableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::DisableTopicRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::DisableTopicRuleAsyncHelper(const DisableTopicRuleRequest& request, const DisableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableTopicRule(request), context);
@@ -1067,7 +1347,7 @@ EnableTopicRuleOutcome IoTClient::EnableTopicRule(const EnableTopicRuleRequest&
 
 EnableTopicRuleOutcomeCallable IoTClient::EnableTopicRuleCallable(const EnableTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableTopicRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableTopicRule(request); } );
 }
 
 void IoTClient::EnableTopicRuleAsync(const EnableTopicRuleRequest& request, const EnableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1075,6 +1355,16 @@ void IoTClient::EnableTopicRuleAsync(const EnableTopicRuleRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->EnableTopicRuleAsyncHelper( request, handler, context ); } );
 }
 
+EnableTopicRuleOutcomeCallable IoTClient::EnableTopicRuleCallable(EnableTopicRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::EnableTopicRule, this, std::move(request)));
+}
+
+void IoTClient::EnableTopicRuleAsync(EnableTopicRuleRequest&& request, const EnableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::EnableTopicRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::EnableTopicRuleAsyncHelper(const EnableTopicRuleRequest& request, const EnableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableTopicRule(request), context);
@@ -1098,7 +1388,7 @@ GetLoggingOptionsOutcome IoTClient::GetLoggingOptions(const GetLoggingOptionsReq
 
 GetLoggingOptionsOutcomeCallable IoTClient::GetLoggingOptionsCallable(const GetLoggingOptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetLoggingOptions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetLoggingOptions(request); } );
 }
 
 void IoTClient::GetLoggingOptionsAsync(const GetLoggingOptionsRequest& request, const GetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1106,6 +1396,16 @@ void IoTClient::GetLoggingOptionsAsync(const GetLoggingOptionsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->GetLoggingOptionsAsyncHelper( request, handler, context ); } );
 }
 
+GetLoggingOptionsOutcomeCallable IoTClient::GetLoggingOptionsCallable(GetLoggingOptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::GetLoggingOptions, this, std::move(request)));
+}
+
+void IoTClient::GetLoggingOptionsAsync(GetLoggingOptionsRequest&& request, const GetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::GetLoggingOptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::GetLoggingOptionsAsyncHelper(const GetLoggingOptionsRequest& request, const GetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetLoggingOptions(request), context);
@@ -1130,7 +1430,7 @@ GetPolicyOutcome IoTClient::GetPolicy(const GetPolicyRequest& request) const
 
 GetPolicyOutcomeCallable IoTClient::GetPolicyCallable(const GetPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetPolicy(request); } );
 }
 
 void IoTClient::GetPolicyAsync(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1138,6 +1438,16 @@ void IoTClient::GetPolicyAsync(const GetPolicyRequest& request, const GetPolicyR
   m_executor->Submit( [this, request, handler, context](){ this->GetPolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetPolicyOutcomeCallable IoTClient::GetPolicyCallable(GetPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::GetPolicy, this, std::move(request)));
+}
+
+void IoTClient::GetPolicyAsync(GetPolicyRequest&& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::GetPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::GetPolicyAsyncHelper(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetPolicy(request), context);
@@ -1164,7 +1474,7 @@ GetPolicyVersionOutcome IoTClient::GetPolicyVersion(const GetPolicyVersionReques
 
 GetPolicyVersionOutcomeCallable IoTClient::GetPolicyVersionCallable(const GetPolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetPolicyVersion(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetPolicyVersion(request); } );
 }
 
 void IoTClient::GetPolicyVersionAsync(const GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1172,6 +1482,16 @@ void IoTClient::GetPolicyVersionAsync(const GetPolicyVersionRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->GetPolicyVersionAsyncHelper( request, handler, context ); } );
 }
 
+GetPolicyVersionOutcomeCallable IoTClient::GetPolicyVersionCallable(GetPolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::GetPolicyVersion, this, std::move(request)));
+}
+
+void IoTClient::GetPolicyVersionAsync(GetPolicyVersionRequest&& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::GetPolicyVersionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::GetPolicyVersionAsyncHelper(const GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetPolicyVersion(request), context);
@@ -1195,7 +1515,7 @@ GetRegistrationCodeOutcome IoTClient::GetRegistrationCode(const GetRegistrationC
 
 GetRegistrationCodeOutcomeCallable IoTClient::GetRegistrationCodeCallable(const GetRegistrationCodeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetRegistrationCode(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetRegistrationCode(request); } );
 }
 
 void IoTClient::GetRegistrationCodeAsync(const GetRegistrationCodeRequest& request, const GetRegistrationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1203,6 +1523,16 @@ void IoTClient::GetRegistrationCodeAsync(const GetRegistrationCodeRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->GetRegistrationCodeAsyncHelper( request, handler, context ); } );
 }
 
+GetRegistrationCodeOutcomeCallable IoTClient::GetRegistrationCodeCallable(GetRegistrationCodeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::GetRegistrationCode, this, std::move(request)));
+}
+
+void IoTClient::GetRegistrationCodeAsync(GetRegistrationCodeRequest&& request, const GetRegistrationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::GetRegistrationCodeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::GetRegistrationCodeAsyncHelper(const GetRegistrationCodeRequest& request, const GetRegistrationCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetRegistrationCode(request), context);
@@ -1227,7 +1557,7 @@ GetTopicRuleOutcome IoTClient::GetTopicRule(const GetTopicRuleRequest& request)
 
 GetTopicRuleOutcomeCallable IoTClient::GetTopicRuleCallable(const GetTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetTopicRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetTopicRule(request); } );
 }
 
 void IoTClient::GetTopicRuleAsync(const GetTopicRuleRequest& request, const GetTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1235,6 +1565,16 @@ void IoTClient::GetTopicRuleAsync(const GetTopicRuleRequest& request, const GetT
   m_executor->Submit( [this, request, handler, context](){ this->GetTopicRuleAsyncHelper( request, handler, context ); } );
 }
 
+GetTopicRuleOutcomeCallable IoTClient::GetTopicRuleCallable(GetTopicRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::GetTopicRule, this, std::move(request)));
+}
+
+void IoTClient::GetTopicRuleAsync(GetTopicRuleRequest&& request, const GetTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::GetTopicRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::GetTopicRuleAsyncHelper(const GetTopicRuleRequest& request, const GetTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetTopicRule(request), context);
@@ -1258,7 +1598,7 @@ ListCACertificatesOutcome IoTClient::ListCACertificates(const ListCACertificates
 
 ListCACertificatesOutcomeCallable IoTClient::ListCACertificatesCallable(const ListCACertificatesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListCACertificates(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListCACertificates(request); } );
 }
 
 void IoTClient::ListCACertificatesAsync(const ListCACertificatesRequest& request, const ListCACertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1266,6 +1606,16 @@ void IoTClient::ListCACertificatesAsync(const ListCACertificatesRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->ListCACertificatesAsyncHelper( request, handler, context ); } );
 }
 
+ListCACertificatesOutcomeCallable IoTClient::ListCACertificatesCallable(ListCACertificatesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::ListCACertificates, this, std::move(request)));
+}
+
+void IoTClient::ListCACertificatesAsync(ListCACertificatesRequest&& request, const ListCACertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::ListCACertificatesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::ListCACertificatesAsyncHelper(const ListCACertificatesRequest& request, const ListCACertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListCACertificates(request), context);
@@ -1289,7 +1639,7 @@ ListCertificatesOutcome IoTClient::ListCertificates(const ListCertificatesReques
 
 ListCertificatesOutcomeCallable IoTClient::ListCertificatesCallable(const ListCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListCertificates(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListCertificates(request); } );
 }
 
 void IoTClient::ListCertificatesAsync(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1297,6 +1647,16 @@ void IoTClient::ListCertificatesAsync(const ListCertificatesRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->ListCertificatesAsyncHelper( request, handler, context ); } );
 }
 
+ListCertificatesOutcomeCallable IoTClient::ListCertificatesCallable(ListCertificatesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::ListCertificates, this, std::move(request)));
+}
+
+void IoTClient::ListCertificatesAsync(ListCertificatesRequest&& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::ListCertificatesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::ListCertificatesAsyncHelper(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListCertificates(request), context);
@@ -1321,7 +1681,7 @@ ListCertificatesByCAOutcome IoTClient::ListCertificatesByCA(const ListCertificat
 
 ListCertificatesByCAOutcomeCallable IoTClient::ListCertificatesByCACallable(const ListCertificatesByCARequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListCertificatesByCA(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListCertificatesByCA(request); } );
 }
 
 void IoTClient::ListCertificatesByCAAsync(const ListCertificatesByCARequest& request, const ListCertificatesByCAResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1329,6 +1689,16 @@ void IoTClient::ListCertificatesByCAAsync(const ListCertificatesByCARequest& req
   m_executor->Submit( [this, request, handler, context](){ this->ListCertificatesByCAAsyncHelper( request, handler, context ); } );
 }
 
+ListCertificatesByCAOutcomeCallable IoTClient::ListCertificatesByCACallable(ListCertificatesByCARequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::ListCertificatesByCA, this, std::move(request)));
+}
+
+void IoTClient::ListCertificatesByCAAsync(ListCertificatesByCARequest&& request, const ListCertificatesByCAResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::ListCertificatesByCAAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::ListCertificatesByCAAsyncHelper(const ListCertificatesByCARequest& request, const ListCertificatesByCAResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListCertificatesByCA(request), context);
@@ -1352,7 +1722,7 @@ ListOutgoingCertificatesOutcome IoTClient::ListOutgoingCertificates(const ListOu
 
 ListOutgoingCertificatesOutcomeCallable IoTClient::ListOutgoingCertificatesCallable(const ListOutgoingCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListOutgoingCertificates(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListOutgoingCertificates(request); } );
 }
 
 void IoTClient::ListOutgoingCertificatesAsync(const ListOutgoingCertificatesRequest& request, const ListOutgoingCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1360,6 +1730,16 @@ void IoTClient::ListOutgoingCertificatesAsync(const ListOutgoingCertificatesRequ
   m_executor->Submit( [this, request, handler, context](){ this->ListOutgoingCertificatesAsyncHelper( request, handler, context ); } );
 }
 
+ListOutgoingCertificatesOutcomeCallable IoTClient::ListOutgoingCertificatesCallable(ListOutgoingCertificatesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::ListOutgoingCertificates, this, std::move(request)));
+}
+
+void IoTClient::ListOutgoingCertificatesAsync(ListOutgoingCertificatesRequest&& request, const ListOutgoingCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::ListOutgoingCertificatesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::ListOutgoingCertificatesAsyncHelper(const ListOutgoingCertificatesRequest& request, const ListOutgoingCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListOutgoingCertificates(request), context);
@@ -1383,7 +1763,7 @@ ListPoliciesOutcome IoTClient::ListPolicies(const ListPoliciesRequest& request)
 
 ListPoliciesOutcomeCallable IoTClient::ListPoliciesCallable(const ListPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListPolicies(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListPolicies(request); } );
 }
 
 void IoTClient::ListPoliciesAsync(const ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1391,6 +1771,16 @@ void IoTClient::ListPoliciesAsync(const ListPoliciesRequest& request, const List
   m_executor->Submit( [this, request, handler, context](){ this->ListPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+ListPoliciesOutcomeCallable IoTClient::ListPoliciesCallable(ListPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::ListPolicies, this, std::move(request)));
+}
+
+void IoTClient::ListPoliciesAsync(ListPoliciesRequest&& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::ListPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::ListPoliciesAsyncHelper(const ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListPolicies(request), context);
@@ -1414,7 +1804,7 @@ ListPolicyPrincipalsOutcome IoTClient::ListPolicyPrincipals(const ListPolicyPrin
 
 ListPolicyPrincipalsOutcomeCallable IoTClient::ListPolicyPrincipalsCallable(const ListPolicyPrincipalsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListPolicyPrincipals(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListPolicyPrincipals(request); } );
 }
 
 void IoTClient::ListPolicyPrincipalsAsync(const ListPolicyPrincipalsRequest& request, const ListPolicyPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1422,6 +1812,16 @@ void IoTClient::ListPolicyPrincipalsAsync(const ListPolicyPrincipalsRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->ListPolicyPrincipalsAsyncHelper( request, handler, context ); } );
 }
 
+ListPolicyPrincipalsOutcomeCallable IoTClient::ListPolicyPrincipalsCallable(ListPolicyPrincipalsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::ListPolicyPrincipals, this, std::move(request)));
+}
+
+void IoTClient::ListPolicyPrincipalsAsync(ListPolicyPrincipalsRequest&& request, const ListPolicyPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::ListPolicyPrincipalsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::ListPolicyPrincipalsAsyncHelper(const ListPolicyPrincipalsRequest& request, const ListPolicyPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListPolicyPrincipals(request), context);
@@ -1447,7 +1847,7 @@ ListPolicyVersionsOutcome IoTClient::ListPolicyVersions(const ListPolicyVersions
 
 ListPolicyVersionsOutcomeCallable IoTClient::ListPolicyVersionsCallable(const ListPolicyVersionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListPolicyVersions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListPolicyVersions(request); } );
 }
 
 void IoTClient::ListPolicyVersionsAsync(const ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1455,6 +1855,16 @@ void IoTClient::ListPolicyVersionsAsync(const ListPolicyVersionsRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->ListPolicyVersionsAsyncHelper( request, handler, context ); } );
 }
 
+ListPolicyVersionsOutcomeCallable IoTClient::ListPolicyVersionsCallable(ListPolicyVersionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::ListPolicyVersions, this, std::move(request)));
+}
+
+void IoTClient::ListPolicyVersionsAsync(ListPolicyVersionsRequest&& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::ListPolicyVersionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::ListPolicyVersionsAsyncHelper(const ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListPolicyVersions(request), context);
@@ -1478,7 +1888,7 @@ ListPrincipalPoliciesOutcome IoTClient::ListPrincipalPolicies(const ListPrincipa
 
 ListPrincipalPoliciesOutcomeCallable IoTClient::ListPrincipalPoliciesCallable(const ListPrincipalPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListPrincipalPolicies(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListPrincipalPolicies(request); } );
 }
 
 void IoTClient::ListPrincipalPoliciesAsync(const ListPrincipalPoliciesRequest& request, const ListPrincipalPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1486,6 +1896,16 @@ void IoTClient::ListPrincipalPoliciesAsync(const ListPrincipalPoliciesRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->ListPrincipalPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+ListPrincipalPoliciesOutcomeCallable IoTClient::ListPrincipalPoliciesCallable(ListPrincipalPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::ListPrincipalPolicies, this, std::move(request)));
+}
+
+void IoTClient::ListPrincipalPoliciesAsync(ListPrincipalPoliciesRequest&& request, const ListPrincipalPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::ListPrincipalPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::ListPrincipalPoliciesAsyncHelper(const ListPrincipalPoliciesRequest& request, const ListPrincipalPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListPrincipalPolicies(request), context);
@@ -1509,7 +1929,7 @@ ListPrincipalThingsOutcome IoTClient::ListPrincipalThings(const ListPrincipalThi
 
 ListPrincipalThingsOutcomeCallable IoTClient::ListPrincipalThingsCallable(const ListPrincipalThingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListPrincipalThings(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListPrincipalThings(request); } );
 }
 
 void IoTClient::ListPrincipalThingsAsync(const ListPrincipalThingsRequest& request, const ListPrincipalThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1517,14 +1937,24 @@ void IoTClient::ListPrincipalThingsAsync(const ListPrincipalThingsRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ListPrincipalThingsAsyncHelper( request, handler, context ); } );
 }
 
-void IoTClient::ListPrincipalThingsAsyncHelper(const ListPrincipalThingsRequest& request, const ListPrincipalThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+ListPrincipalThingsOutcomeCallable IoTClient::ListPrincipalThingsCallable(ListPrincipalThingsRequest&& request) const
 {
-  handler(this, request, ListPrincipalThings(request), context);
+  return m_executor->SubmitCallable(std::bind(&IoTClient::ListPrincipalThings, this, std::move(request)));
 }
 
-ListThingPrincipalsOutcome IoTClient::ListThingPrincipals(const ListThingPrincipalsRequest& request) const
+void IoTClient::ListPrincipalThingsAsync(ListPrincipalThingsRequest&& request, const ListPrincipalThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  Aws::StringStream ss;
+  m_executor->Submit(&IoTClient::ListPrincipalThingsAsyncHelper, this, std::move(request), handler, context);
+}
+
+void IoTClient::ListPrincipalThingsAsyncHelper(const ListPrincipalThingsRequest& request, const ListPrincipalThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  handler(this, request, ListPrincipalThings(request), context);
+}
+
+ListThingPrincipalsOutcome IoTClient::ListThingPrincipals(const ListThingPrincipalsRequest& request) const
+{
+  Aws::StringStream ss;
   ss << m_uri << "/things/";
   ss << request.GetThingName();
   ss << "/principals";
@@ -1542,7 +1972,7 @@ ListThingPrincipalsOutcome IoTClient::ListThingPrincipals(const ListThingPrincip
 
 ListThingPrincipalsOutcomeCallable IoTClient::ListThingPrincipalsCallable(const ListThingPrincipalsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListThingPrincipals(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListThingPrincipals(request); } );
 }
 
 void IoTClient::ListThingPrincipalsAsync(const ListThingPrincipalsRequest& request, const ListThingPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1550,6 +1980,16 @@ void IoTClient::ListThingPrincipalsAsync(const ListThingPrincipalsRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ListThingPrincipalsAsyncHelper( request, handler, context ); } );
 }
 
+ListThingPrincipalsOutcomeCallable IoTClient::ListThingPrincipalsCallable(ListThingPrincipalsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::ListThingPrincipals, this, std::move(request)));
+}
+
+void IoTClient::ListThingPrincipalsAsync(ListThingPrincipalsRequest&& request, const ListThingPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::ListThingPrincipalsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::ListThingPrincipalsAsyncHelper(const ListThingPrincipalsRequest& request, const ListThingPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListThingPrincipals(request), context);
@@ -1573,7 +2013,7 @@ ListThingTypesOutcome IoTClient::ListThingTypes(const ListThingTypesRequest& req
 
 ListThingTypesOutcomeCallable IoTClient::ListThingTypesCallable(const ListThingTypesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListThingTypes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListThingTypes(request); } );
 }
 
 void IoTClient::ListThingTypesAsync(const ListThingTypesRequest& request, const ListThingTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1581,6 +2021,16 @@ void IoTClient::ListThingTypesAsync(const ListThingTypesRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ListThingTypesAsyncHelper( request, handler, context ); } );
 }
 
+ListThingTypesOutcomeCallable IoTClient::ListThingTypesCallable(ListThingTypesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::ListThingTypes, this, std::move(request)));
+}
+
+void IoTClient::ListThingTypesAsync(ListThingTypesRequest&& request, const ListThingTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::ListThingTypesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::ListThingTypesAsyncHelper(const ListThingTypesRequest& request, const ListThingTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListThingTypes(request), context);
@@ -1604,7 +2054,7 @@ ListThingsOutcome IoTClient::ListThings(const ListThingsRequest& request) const
 
 ListThingsOutcomeCallable IoTClient::ListThingsCallable(const ListThingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListThings(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListThings(request); } );
 }
 
 void IoTClient::ListThingsAsync(const ListThingsRequest& request, const ListThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1612,6 +2062,16 @@ void IoTClient::ListThingsAsync(const ListThingsRequest& request, const ListThin
   m_executor->Submit( [this, request, handler, context](){ this->ListThingsAsyncHelper( request, handler, context ); } );
 }
 
+ListThingsOutcomeCallable IoTClient::ListThingsCallable(ListThingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::ListThings, this, std::move(request)));
+}
+
+void IoTClient::ListThingsAsync(ListThingsRequest&& request, const ListThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::ListThingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::ListThingsAsyncHelper(const ListThingsRequest& request, const ListThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListThings(request), context);
@@ -1635,7 +2095,7 @@ ListTopicRulesOutcome IoTClient::ListTopicRules(const ListTopicRulesRequest& req
 
 ListTopicRulesOutcomeCallable IoTClient::ListTopicRulesCallable(const ListTopicRulesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTopicRules(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTopicRules(request); } );
 }
 
 void IoTClient::ListTopicRulesAsync(const ListTopicRulesRequest& request, const ListTopicRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1643,6 +2103,16 @@ void IoTClient::ListTopicRulesAsync(const ListTopicRulesRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ListTopicRulesAsyncHelper( request, handler, context ); } );
 }
 
+ListTopicRulesOutcomeCallable IoTClient::ListTopicRulesCallable(ListTopicRulesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::ListTopicRules, this, std::move(request)));
+}
+
+void IoTClient::ListTopicRulesAsync(ListTopicRulesRequest&& request, const ListTopicRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::ListTopicRulesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::ListTopicRulesAsyncHelper(const ListTopicRulesRequest& request, const ListTopicRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTopicRules(request), context);
@@ -1666,7 +2136,7 @@ RegisterCACertificateOutcome IoTClient::RegisterCACertificate(const RegisterCACe
 
 RegisterCACertificateOutcomeCallable IoTClient::RegisterCACertificateCallable(const RegisterCACertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterCACertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterCACertificate(request); } );
 }
 
 void IoTClient::RegisterCACertificateAsync(const RegisterCACertificateRequest& request, const RegisterCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1674,6 +2144,16 @@ void IoTClient::RegisterCACertificateAsync(const RegisterCACertificateRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->RegisterCACertificateAsyncHelper( request, handler, context ); } );
 }
 
+RegisterCACertificateOutcomeCallable IoTClient::RegisterCACertificateCallable(RegisterCACertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::RegisterCACertificate, this, std::move(request)));
+}
+
+void IoTClient::RegisterCACertificateAsync(RegisterCACertificateRequest&& request, const RegisterCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::RegisterCACertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::RegisterCACertificateAsyncHelper(const RegisterCACertificateRequest& request, const RegisterCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterCACertificate(request), context);
@@ -1697,7 +2177,7 @@ RegisterCertificateOutcome IoTClient::RegisterCertificate(const RegisterCertific
 
 RegisterCertificateOutcomeCallable IoTClient::RegisterCertificateCallable(const RegisterCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterCertificate(request); } );
 }
 
 void IoTClient::RegisterCertificateAsync(const RegisterCertificateRequest& request, const RegisterCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1705,6 +2185,16 @@ void IoTClient::RegisterCertificateAsync(const RegisterCertificateRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->RegisterCertificateAsyncHelper( request, handler, context ); } );
 }
 
+RegisterCertificateOutcomeCallable IoTClient::RegisterCertificateCallable(RegisterCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::RegisterCertificate, this, std::move(request)));
+}
+
+void IoTClient::RegisterCertificateAsync(RegisterCertificateRequest&& request, const RegisterCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::RegisterCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::RegisterCertificateAsyncHelper(const RegisterCertificateRequest& request, const RegisterCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterCertificate(request), context);
@@ -1729,7 +2219,7 @@ RejectCertificateTransferOutcome IoTClient::RejectCertificateTransfer(const Reje
 
 RejectCertificateTransferOutcomeCallable IoTClient::RejectCertificateTransferCallable(const RejectCertificateTransferRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RejectCertificateTransfer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RejectCertificateTransfer(request); } );
 }
 
 void IoTClient::RejectCertificateTransferAsync(const RejectCertificateTransferRequest& request, const RejectCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1737,6 +2227,16 @@ void IoTClient::RejectCertificateTransferAsync(const RejectCertificateTransferRe
   m_executor->Submit( [this, request, handler, context](){ this->RejectCertificateTransferAsyncHelper( request, handler, context ); } );
 }
 
+RejectCertificateTransferOutcomeCallable IoTClient::RejectCertificateTransferCallable(RejectCertificateTransferRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::RejectCertificateTransfer, this, std::move(request)));
+}
+
+void IoTClient::RejectCertificateTransferAsync(RejectCertificateTransferRequest&& request, const RejectCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::RejectCertificateTransferAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::RejectCertificateTransferAsyncHelper(const RejectCertificateTransferRequest& request, const RejectCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RejectCertificateTransfer(request), context);
@@ -1761,7 +2261,7 @@ ReplaceTopicRuleOutcome IoTClient::ReplaceTopicRule(const ReplaceTopicRuleReques
 
 ReplaceTopicRuleOutcomeCallable IoTClient::ReplaceTopicRuleCallable(const ReplaceTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReplaceTopicRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ReplaceTopicRule(request); } );
 }
 
 void IoTClient::ReplaceTopicRuleAsync(const ReplaceTopicRuleRequest& request, const ReplaceTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1769,6 +2269,16 @@ void IoTClient::ReplaceTopicRuleAsync(const ReplaceTopicRuleRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->ReplaceTopicRuleAsyncHelper( request, handler, context ); } );
 }
 
+ReplaceTopicRuleOutcomeCallable IoTClient::ReplaceTopicRuleCallable(ReplaceTopicRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::ReplaceTopicRule, this, std::move(request)));
+}
+
+void IoTClient::ReplaceTopicRuleAsync(ReplaceTopicRuleRequest&& request, const ReplaceTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::ReplaceTopicRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::ReplaceTopicRuleAsyncHelper(const ReplaceTopicRuleRequest& request, const ReplaceTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReplaceTopicRule(request), context);
@@ -1795,7 +2305,7 @@ SetDefaultPolicyVersionOutcome IoTClient::SetDefaultPolicyVersion(const SetDefau
 
 SetDefaultPolicyVersionOutcomeCallable IoTClient::SetDefaultPolicyVersionCallable(const SetDefaultPolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetDefaultPolicyVersion(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetDefaultPolicyVersion(request); } );
 }
 
 void IoTClient::SetDefaultPolicyVersionAsync(const SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1803,6 +2313,16 @@ void IoTClient::SetDefaultPolicyVersionAsync(const SetDefaultPolicyVersionReques
   m_executor->Submit( [this, request, handler, context](){ this->SetDefaultPolicyVersionAsyncHelper( request, handler, context ); } );
 }
 
+SetDefaultPolicyVersionOutcomeCallable IoTClient::SetDefaultPolicyVersionCallable(SetDefaultPolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::SetDefaultPolicyVersion, this, std::move(request)));
+}
+
+void IoTClient::SetDefaultPolicyVersionAsync(SetDefaultPolicyVersionRequest&& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::SetDefaultPolicyVersionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::SetDefaultPolicyVersionAsyncHelper(const SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetDefaultPolicyVersion(request), context);
@@ -1826,7 +2346,7 @@ SetLoggingOptionsOutcome IoTClient::SetLoggingOptions(const SetLoggingOptionsReq
 
 SetLoggingOptionsOutcomeCallable IoTClient::SetLoggingOptionsCallable(const SetLoggingOptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetLoggingOptions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetLoggingOptions(request); } );
 }
 
 void IoTClient::SetLoggingOptionsAsync(const SetLoggingOptionsRequest& request, const SetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1834,6 +2354,16 @@ void IoTClient::SetLoggingOptionsAsync(const SetLoggingOptionsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->SetLoggingOptionsAsyncHelper( request, handler, context ); } );
 }
 
+SetLoggingOptionsOutcomeCallable IoTClient::SetLoggingOptionsCallable(SetLoggingOptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::SetLoggingOptions, this, std::move(request)));
+}
+
+void IoTClient::SetLoggingOptionsAsync(SetLoggingOptionsRequest&& request, const SetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::SetLoggingOptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::SetLoggingOptionsAsyncHelper(const SetLoggingOptionsRequest& request, const SetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetLoggingOptions(request), context);
@@ -1858,7 +2388,7 @@ TransferCertificateOutcome IoTClient::TransferCertificate(const TransferCertific
 
 TransferCertificateOutcomeCallable IoTClient::TransferCertificateCallable(const TransferCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TransferCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TransferCertificate(request); } );
 }
 
 void IoTClient::TransferCertificateAsync(const TransferCertificateRequest& request, const TransferCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1866,6 +2396,16 @@ void IoTClient::TransferCertificateAsync(const TransferCertificateRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->TransferCertificateAsyncHelper( request, handler, context ); } );
 }
 
+TransferCertificateOutcomeCallable IoTClient::TransferCertificateCallable(TransferCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::TransferCertificate, this, std::move(request)));
+}
+
+void IoTClient::TransferCertificateAsync(TransferCertificateRequest&& request, const TransferCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::TransferCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::TransferCertificateAsyncHelper(const TransferCertificateRequest& request, const TransferCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TransferCertificate(request), context);
@@ -1890,7 +2430,7 @@ UpdateCACertificateOutcome IoTClient::UpdateCACertificate(const UpdateCACertific
 
 UpdateCACertificateOutcomeCallable IoTClient::UpdateCACertificateCallable(const UpdateCACertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateCACertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateCACertificate(request); } );
 }
 
 void IoTClient::UpdateCACertificateAsync(const UpdateCACertificateRequest& request, const UpdateCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1898,6 +2438,16 @@ void IoTClient::UpdateCACertificateAsync(const UpdateCACertificateRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->UpdateCACertificateAsyncHelper( request, handler, context ); } );
 }
 
+UpdateCACertificateOutcomeCallable IoTClient::UpdateCACertificateCallable(UpdateCACertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::UpdateCACertificate, this, std::move(request)));
+}
+
+void IoTClient::UpdateCACertificateAsync(UpdateCACertificateRequest&& request, const UpdateCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::UpdateCACertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::UpdateCACertificateAsyncHelper(const UpdateCACertificateRequest& request, const UpdateCACertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateCACertificate(request), context);
@@ -1922,7 +2472,7 @@ UpdateCertificateOutcome IoTClient::UpdateCertificate(const UpdateCertificateReq
 
 UpdateCertificateOutcomeCallable IoTClient::UpdateCertificateCallable(const UpdateCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateCertificate(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateCertificate(request); } );
 }
 
 void IoTClient::UpdateCertificateAsync(const UpdateCertificateRequest& request, const UpdateCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1930,6 +2480,16 @@ void IoTClient::UpdateCertificateAsync(const UpdateCertificateRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->UpdateCertificateAsyncHelper( request, handler, context ); } );
 }
 
+UpdateCertificateOutcomeCallable IoTClient::UpdateCertificateCallable(UpdateCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::UpdateCertificate, this, std::move(request)));
+}
+
+void IoTClient::UpdateCertificateAsync(UpdateCertificateRequest&& request, const UpdateCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::UpdateCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::UpdateCertificateAsyncHelper(const UpdateCertificateRequest& request, const UpdateCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateCertificate(request), context);
@@ -1954,7 +2514,7 @@ UpdateThingOutcome IoTClient::UpdateThing(const UpdateThingRequest& request) con
 
 UpdateThingOutcomeCallable IoTClient::UpdateThingCallable(const UpdateThingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateThing(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateThing(request); } );
 }
 
 void IoTClient::UpdateThingAsync(const UpdateThingRequest& request, const UpdateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1962,8 +2522,492 @@ void IoTClient::UpdateThingAsync(const UpdateThingRequest& request, const Update
   m_executor->Submit( [this, request, handler, context](){ this->UpdateThingAsyncHelper( request, handler, context ); } );
 }
 
+UpdateThingOutcomeCallable IoTClient::UpdateThingCallable(UpdateThingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&IoTClient::UpdateThing, this, std::move(request)));
+}
+
+void IoTClient::UpdateThingAsync(UpdateThingRequest&& request, const UpdateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&IoTClient::UpdateThingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void IoTClient::UpdateThingAsyncHelper(const UpdateThingRequest& request, const UpdateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateThing(request), context);
 }
 
+Paginator<IoTClient, ListCACertificatesRequest, ListCACertificatesOutcome> IoTClient::ListCACertificatesPaginator(const ListCACertificatesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IoTClient, ListCACertificatesRequest, ListCACertificatesOutcome>(this, &IoTClient::ListCACertificates, request,
+    [](const ListCACertificatesRequest& current, const ListCACertificatesOutcome& outcome, ListCACertificatesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IoTClient, ListCertificatesRequest, ListCertificatesOutcome> IoTClient::ListCertificatesPaginator(const ListCertificatesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IoTClient, ListCertificatesRequest, ListCertificatesOutcome>(this, &IoTClient::ListCertificates, request,
+    [](const ListCertificatesRequest& current, const ListCertificatesOutcome& outcome, ListCertificatesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IoTClient, ListCertificatesByCARequest, ListCertificatesByCAOutcome> IoTClient::ListCertificatesByCAPaginator(const ListCertificatesByCARequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IoTClient, ListCertificatesByCARequest, ListCertificatesByCAOutcome>(this, &IoTClient::ListCertificatesByCA, request,
+    [](const ListCertificatesByCARequest& current, const ListCertificatesByCAOutcome& outcome, ListCertificatesByCARequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IoTClient, ListOutgoingCertificatesRequest, ListOutgoingCertificatesOutcome> IoTClient::ListOutgoingCertificatesPaginator(const ListOutgoingCertificatesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IoTClient, ListOutgoingCertificatesRequest, ListOutgoingCertificatesOutcome>(this, &IoTClient::ListOutgoingCertificates, request,
+    [](const ListOutgoingCertificatesRequest& current, const ListOutgoingCertificatesOutcome& outcome, ListOutgoingCertificatesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IoTClient, ListPoliciesRequest, ListPoliciesOutcome> IoTClient::ListPoliciesPaginator(const ListPoliciesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IoTClient, ListPoliciesRequest, ListPoliciesOutcome>(this, &IoTClient::ListPolicies, request,
+    [](const ListPoliciesRequest& current, const ListPoliciesOutcome& outcome, ListPoliciesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IoTClient, ListPolicyPrincipalsRequest, ListPolicyPrincipalsOutcome> IoTClient::ListPolicyPrincipalsPaginator(const ListPolicyPrincipalsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IoTClient, ListPolicyPrincipalsRequest, ListPolicyPrincipalsOutcome>(this, &IoTClient::ListPolicyPrincipals, request,
+    [](const ListPolicyPrincipalsRequest& current, const ListPolicyPrincipalsOutcome& outcome, ListPolicyPrincipalsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IoTClient, ListPrincipalPoliciesRequest, ListPrincipalPoliciesOutcome> IoTClient::ListPrincipalPoliciesPaginator(const ListPrincipalPoliciesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IoTClient, ListPrincipalPoliciesRequest, ListPrincipalPoliciesOutcome>(this, &IoTClient::ListPrincipalPolicies, request,
+    [](const ListPrincipalPoliciesRequest& current, const ListPrincipalPoliciesOutcome& outcome, ListPrincipalPoliciesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IoTClient, ListPrincipalThingsRequest, ListPrincipalThingsOutcome> IoTClient::ListPrincipalThingsPaginator(const ListPrincipalThingsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IoTClient, ListPrincipalThingsRequest, ListPrincipalThingsOutcome>(this, &IoTClient::ListPrincipalThings, request,
+    [](const ListPrincipalThingsRequest& current, const ListPrincipalThingsOutcome& outcome, ListPrincipalThingsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IoTClient, ListThingTypesRequest, ListThingTypesOutcome> IoTClient::ListThingTypesPaginator(const ListThingTypesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IoTClient, ListThingTypesRequest, ListThingTypesOutcome>(this, &IoTClient::ListThingTypes, request,
+    [](const ListThingTypesRequest& current, const ListThingTypesOutcome& outcome, ListThingTypesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IoTClient, ListThingsRequest, ListThingsOutcome> IoTClient::ListThingsPaginator(const ListThingsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IoTClient, ListThingsRequest, ListThingsOutcome>(this, &IoTClient::ListThings, request,
+    [](const ListThingsRequest& current, const ListThingsOutcome& outcome, ListThingsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<IoTClient, ListTopicRulesRequest, ListTopicRulesOutcome> IoTClient::ListTopicRulesPaginator(const ListTopicRulesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<IoTClient, ListTopicRulesRequest, ListTopicRulesOutcome>(this, &IoTClient::ListTopicRules, request,
+    [](const ListTopicRulesRequest& current, const ListTopicRulesOutcome& outcome, ListTopicRulesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<IoTClient, AcceptCertificateTransferRequest, AcceptCertificateTransferOutcome> IoTClient::AcceptCertificateTransferAwaitable(AcceptCertificateTransferRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::AcceptCertificateTransfer, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, AttachPrincipalPolicyRequest, AttachPrincipalPolicyOutcome> IoTClient::AttachPrincipalPolicyAwaitable(AttachPrincipalPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::AttachPrincipalPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, AttachThingPrincipalRequest, AttachThingPrincipalOutcome> IoTClient::AttachThingPrincipalAwaitable(AttachThingPrincipalRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::AttachThingPrincipal, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, CancelCertificateTransferRequest, CancelCertificateTransferOutcome> IoTClient::CancelCertificateTransferAwaitable(CancelCertificateTransferRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::CancelCertificateTransfer, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, CreateCertificateFromCsrRequest, CreateCertificateFromCsrOutcome> IoTClient::CreateCertificateFromCsrAwaitable(CreateCertificateFromCsrRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::CreateCertificateFromCsr, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, CreateKeysAndCertificateRequest, CreateKeysAndCertificateOutcome> IoTClient::CreateKeysAndCertificateAwaitable(CreateKeysAndCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::CreateKeysAndCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, CreatePolicyRequest, CreatePolicyOutcome> IoTClient::CreatePolicyAwaitable(CreatePolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::CreatePolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, CreatePolicyVersionRequest, CreatePolicyVersionOutcome> IoTClient::CreatePolicyVersionAwaitable(CreatePolicyVersionRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::CreatePolicyVersion, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, CreateThingRequest, CreateThingOutcome> IoTClient::CreateThingAwaitable(CreateThingRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::CreateThing, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, CreateThingTypeRequest, CreateThingTypeOutcome> IoTClient::CreateThingTypeAwaitable(CreateThingTypeRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::CreateThingType, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, CreateTopicRuleRequest, CreateTopicRuleOutcome> IoTClient::CreateTopicRuleAwaitable(CreateTopicRuleRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::CreateTopicRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DeleteCACertificateRequest, DeleteCACertificateOutcome> IoTClient::DeleteCACertificateAwaitable(DeleteCACertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DeleteCACertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DeleteCertificateRequest, DeleteCertificateOutcome> IoTClient::DeleteCertificateAwaitable(DeleteCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DeleteCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DeletePolicyRequest, DeletePolicyOutcome> IoTClient::DeletePolicyAwaitable(DeletePolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DeletePolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DeletePolicyVersionRequest, DeletePolicyVersionOutcome> IoTClient::DeletePolicyVersionAwaitable(DeletePolicyVersionRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DeletePolicyVersion, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DeleteRegistrationCodeRequest, DeleteRegistrationCodeOutcome> IoTClient::DeleteRegistrationCodeAwaitable(DeleteRegistrationCodeRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DeleteRegistrationCode, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DeleteThingRequest, DeleteThingOutcome> IoTClient::DeleteThingAwaitable(DeleteThingRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DeleteThing, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DeleteThingTypeRequest, DeleteThingTypeOutcome> IoTClient::DeleteThingTypeAwaitable(DeleteThingTypeRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DeleteThingType, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DeleteTopicRuleRequest, DeleteTopicRuleOutcome> IoTClient::DeleteTopicRuleAwaitable(DeleteTopicRuleRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DeleteTopicRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DeprecateThingTypeRequest, DeprecateThingTypeOutcome> IoTClient::DeprecateThingTypeAwaitable(DeprecateThingTypeRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DeprecateThingType, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DescribeCACertificateRequest, DescribeCACertificateOutcome> IoTClient::DescribeCACertificateAwaitable(DescribeCACertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DescribeCACertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DescribeCertificateRequest, DescribeCertificateOutcome> IoTClient::DescribeCertificateAwaitable(DescribeCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DescribeCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DescribeEndpointRequest, DescribeEndpointOutcome> IoTClient::DescribeEndpointAwaitable(DescribeEndpointRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DescribeEndpoint, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DescribeThingRequest, DescribeThingOutcome> IoTClient::DescribeThingAwaitable(DescribeThingRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DescribeThing, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DescribeThingTypeRequest, DescribeThingTypeOutcome> IoTClient::DescribeThingTypeAwaitable(DescribeThingTypeRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DescribeThingType, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DetachPrincipalPolicyRequest, DetachPrincipalPolicyOutcome> IoTClient::DetachPrincipalPolicyAwaitable(DetachPrincipalPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DetachPrincipalPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DetachThingPrincipalRequest, DetachThingPrincipalOutcome> IoTClient::DetachThingPrincipalAwaitable(DetachThingPrincipalRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DetachThingPrincipal, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, DisableTopicRuleRequest, DisableTopicRuleOutcome> IoTClient::DisableTopicRuleAwaitable(DisableTopicRuleRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::DisableTopicRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, EnableTopicRuleRequest, EnableTopicRuleOutcome> IoTClient::EnableTopicRuleAwaitable(EnableTopicRuleRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::EnableTopicRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, GetLoggingOptionsRequest, GetLoggingOptionsOutcome> IoTClient::GetLoggingOptionsAwaitable(GetLoggingOptionsRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::GetLoggingOptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, GetPolicyRequest, GetPolicyOutcome> IoTClient::GetPolicyAwaitable(GetPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::GetPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, GetPolicyVersionRequest, GetPolicyVersionOutcome> IoTClient::GetPolicyVersionAwaitable(GetPolicyVersionRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::GetPolicyVersion, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, GetRegistrationCodeRequest, GetRegistrationCodeOutcome> IoTClient::GetRegistrationCodeAwaitable(GetRegistrationCodeRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::GetRegistrationCode, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, GetTopicRuleRequest, GetTopicRuleOutcome> IoTClient::GetTopicRuleAwaitable(GetTopicRuleRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::GetTopicRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, ListCACertificatesRequest, ListCACertificatesOutcome> IoTClient::ListCACertificatesAwaitable(ListCACertificatesRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::ListCACertificates, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, ListCertificatesRequest, ListCertificatesOutcome> IoTClient::ListCertificatesAwaitable(ListCertificatesRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::ListCertificates, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, ListCertificatesByCARequest, ListCertificatesByCAOutcome> IoTClient::ListCertificatesByCAAwaitable(ListCertificatesByCARequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::ListCertificatesByCA, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, ListOutgoingCertificatesRequest, ListOutgoingCertificatesOutcome> IoTClient::ListOutgoingCertificatesAwaitable(ListOutgoingCertificatesRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::ListOutgoingCertificates, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, ListPoliciesRequest, ListPoliciesOutcome> IoTClient::ListPoliciesAwaitable(ListPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::ListPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, ListPolicyPrincipalsRequest, ListPolicyPrincipalsOutcome> IoTClient::ListPolicyPrincipalsAwaitable(ListPolicyPrincipalsRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::ListPolicyPrincipals, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, ListPolicyVersionsRequest, ListPolicyVersionsOutcome> IoTClient::ListPolicyVersionsAwaitable(ListPolicyVersionsRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::ListPolicyVersions, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, ListPrincipalPoliciesRequest, ListPrincipalPoliciesOutcome> IoTClient::ListPrincipalPoliciesAwaitable(ListPrincipalPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::ListPrincipalPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, ListPrincipalThingsRequest, ListPrincipalThingsOutcome> IoTClient::ListPrincipalThingsAwaitable(ListPrincipalThingsRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::ListPrincipalThings, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, ListThingPrincipalsRequest, ListThingPrincipalsOutcome> IoTClient::ListThingPrincipalsAwaitable(ListThingPrincipalsRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::ListThingPrincipals, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, ListThingTypesRequest, ListThingTypesOutcome> IoTClient::ListThingTypesAwaitable(ListThingTypesRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::ListThingTypes, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, ListThingsRequest, ListThingsOutcome> IoTClient::ListThingsAwaitable(ListThingsRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::ListThings, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, ListTopicRulesRequest, ListTopicRulesOutcome> IoTClient::ListTopicRulesAwaitable(ListTopicRulesRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::ListTopicRules, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, RegisterCACertificateRequest, RegisterCACertificateOutcome> IoTClient::RegisterCACertificateAwaitable(RegisterCACertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::RegisterCACertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, RegisterCertificateRequest, RegisterCertificateOutcome> IoTClient::RegisterCertificateAwaitable(RegisterCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::RegisterCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, RejectCertificateTransferRequest, RejectCertificateTransferOutcome> IoTClient::RejectCertificateTransferAwaitable(RejectCertificateTransferRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::RejectCertificateTransfer, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, ReplaceTopicRuleRequest, ReplaceTopicRuleOutcome> IoTClient::ReplaceTopicRuleAwaitable(ReplaceTopicRuleRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::ReplaceTopicRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, SetDefaultPolicyVersionRequest, SetDefaultPolicyVersionOutcome> IoTClient::SetDefaultPolicyVersionAwaitable(SetDefaultPolicyVersionRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::SetDefaultPolicyVersion, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, SetLoggingOptionsRequest, SetLoggingOptionsOutcome> IoTClient::SetLoggingOptionsAwaitable(SetLoggingOptionsRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::SetLoggingOptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, TransferCertificateRequest, TransferCertificateOutcome> IoTClient::TransferCertificateAwaitable(TransferCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::TransferCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, UpdateCACertificateRequest, UpdateCACertificateOutcome> IoTClient::UpdateCACertificateAwaitable(UpdateCACertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::UpdateCACertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, UpdateCertificateRequest, UpdateCertificateOutcome> IoTClient::UpdateCertificateAwaitable(UpdateCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::UpdateCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<IoTClient, UpdateThingRequest, UpdateThingOutcome> IoTClient::UpdateThingAwaitable(UpdateThingRequest request) const
+{
+  return { m_executor.get(), { this, &IoTClient::UpdateThing, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,21 +29,29 @@ namespace Aws
       namespace AutoRegistrationStatusMapper
       {
 
-        static const int ENABLE_HASH = HashingUtils::HashString("ENABLE");
-        static const int DISABLE_HASH = HashingUtils::HashString("DISABLE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ENABLE_HASH = 2049448323;
+        static const int DISABLE_HASH = -1905676600;
 
 
         AutoRegistrationStatus GetAutoRegistrationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLE_HASH)
+          switch (hashCode)
           {
+          case ENABLE_HASH:
             return AutoRegistrationStatus::ENABLE;
-          }
-          else if (hashCode == DISABLE_HASH)
-          {
+          case DISABLE_HASH:
             return AutoRegistrationStatus::DISABLE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,41 +29,41 @@ namespace Aws
       namespace CertificateStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int REVOKED_HASH = HashingUtils::HashString("REVOKED");
-        static const int PENDING_TRANSFER_HASH = HashingUtils::HashString("PENDING_TRANSFER");
-        static const int REGISTER_INACTIVE_HASH = HashingUtils::HashString("REGISTER_INACTIVE");
-        static const int PENDING_ACTIVATION_HASH = HashingUtils::HashString("PENDING_ACTIVATION");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ACTIVE_HASH = 1925346054;
+        static const int INACTIVE_HASH = 807292011;
+        static const int REVOKED_HASH = 1818119806;
+        static const int PENDING_TRANSFER_HASH = -1305282125;
+        static const int REGISTER_INACTIVE_HASH = 1749427847;
+        static const int PENDING_ACTIVATION_HASH = -772051746;
 
 
         CertificateStatus GetCertificateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          switch (hashCode)
           {
+          case ACTIVE_HASH:
             return CertificateStatus::ACTIVE;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
+          case INACTIVE_HASH:
             return CertificateStatus::INACTIVE;
-          }
-          else if (hashCode == REVOKED_HASH)
-          {
+          case REVOKED_HASH:
             return CertificateStatus::REVOKED;
-          }
-          else if (hashCode == PENDING_TRANSFER_HASH)
-          {
+          case PENDING_TRANSFER_HASH:
             return CertificateStatus::PENDING_TRANSFER;
-          }
-          else if (hashCode == REGISTER_INACTIVE_HASH)
-          {
+          case REGISTER_INACTIVE_HASH:
             return CertificateStatus::REGISTER_INACTIVE;
-          }
-          else if (hashCode == PENDING_ACTIVATION_HASH)
-          {
+          case PENDING_ACTIVATION_HASH:
             return CertificateStatus::PENDING_ACTIVATION;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace DynamoKeyTypeMapper
       {
 
-        static const int STRING_HASH = HashingUtils::HashString("STRING");
-        static const int NUMBER_HASH = HashingUtils::HashString("NUMBER");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int STRING_HASH = -1838656495;
+        static const int NUMBER_HASH = -1981034679;
 
 
         DynamoKeyType GetDynamoKeyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STRING_HASH)
+          switch (hashCode)
           {
+          case STRING_HASH:
             return DynamoKeyType::STRING;
-          }
-          else if (hashCode == NUMBER_HASH)
-          {
+          case NUMBER_HASH:
             return DynamoKeyType::NUMBER;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
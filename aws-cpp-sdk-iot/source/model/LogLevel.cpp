@@ -29,36 +29,38 @@ namespace Aws
       namespace LogLevelMapper
       {
 
-        static const int DEBUG__HASH = HashingUtils::HashString("DEBUG");
-        static const int INFO_HASH = HashingUtils::HashString("INFO");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int WARN_HASH = HashingUtils::HashString("WARN");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int DEBUG__HASH = 64921139;
+        static const int INFO_HASH = 2251950;
+        static const int ERROR__HASH = 66247144;
+        static const int WARN_HASH = 2656902;
+        static const int DISABLED_HASH = 1053567612;
 
 
         LogLevel GetLogLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEBUG__HASH)
+          switch (hashCode)
           {
+          case DEBUG__HASH:
             return LogLevel::DEBUG_;
-          }
-          else if (hashCode == INFO_HASH)
-          {
+          case INFO_HASH:
             return LogLevel::INFO;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
+          case ERROR__HASH:
             return LogLevel::ERROR_;
-          }
-          else if (hashCode == WARN_HASH)
-          {
+          case WARN_HASH:
             return LogLevel::WARN;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
+          case DISABLED_HASH:
             return LogLevel::DISABLED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
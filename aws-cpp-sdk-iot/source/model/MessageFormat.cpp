@@ -29,21 +29,29 @@ namespace Aws
       namespace MessageFormatMapper
       {
 
-        static const int RAW_HASH = HashingUtils::HashString("RAW");
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int RAW_HASH = 80904;
+        static const int JSON_HASH = 2286824;
 
 
         MessageFormat GetMessageFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RAW_HASH)
+          switch (hashCode)
           {
+          case RAW_HASH:
             return MessageFormat::RAW;
-          }
-          else if (hashCode == JSON_HASH)
-          {
+          case JSON_HASH:
             return MessageFormat::JSON;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -31,6 +31,9 @@
 #include <aws/kinesis/model/PutRecordsResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -92,6 +95,7 @@ namespace Model
         class PutRecordsRequest;
         class RemoveTagsFromStreamRequest;
         class SplitShardRequest;
+        class PutRecordsRequestEntry;
 
         typedef Aws::Utils::Outcome<NoResult, Aws::Client::AWSError<KinesisErrors>> AddTagsToStreamOutcome;
         typedef Aws::Utils::Outcome<NoResult, Aws::Client::AWSError<KinesisErrors>> CreateStreamOutcome;
@@ -209,6 +213,18 @@ namespace Model
          */
         virtual void AddTagsToStreamAsync(const Model::AddTagsToStreamRequest& request, const AddTagsToStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToStreamCallable(const Model::AddTagsToStreamRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsToStreamOutcomeCallable AddTagsToStreamCallable(Model::AddTagsToStreamRequest&& request) const;
+
+        /**
+         * Same as AddTagsToStreamAsync(const Model::AddTagsToStreamRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsToStreamAsync(Model::AddTagsToStreamRequest&& request, const AddTagsToStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an Amazon Kinesis stream. A stream captures and transports data
          * records that are continuously emitted from different data sources or
@@ -318,6 +334,18 @@ namespace Model
          */
         virtual void CreateStreamAsync(const Model::CreateStreamRequest& request, const CreateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateStreamCallable(const Model::CreateStreamRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateStreamOutcomeCallable CreateStreamCallable(Model::CreateStreamRequest&& request) const;
+
+        /**
+         * Same as CreateStreamAsync(const Model::CreateStreamRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateStreamAsync(Model::CreateStreamRequest&& request, const CreateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Decreases the Amazon Kinesis stream's retention period, which is the length
          * of time data records are accessible after they are added to the stream. The
@@ -352,6 +380,18 @@ namespace Model
          */
         virtual void DecreaseStreamRetentionPeriodAsync(const Model::DecreaseStreamRetentionPeriodRequest& request, const DecreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DecreaseStreamRetentionPeriodCallable(const Model::DecreaseStreamRetentionPeriodRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DecreaseStreamRetentionPeriodOutcomeCallable DecreaseStreamRetentionPeriodCallable(Model::DecreaseStreamRetentionPeriodRequest&& request) const;
+
+        /**
+         * Same as DecreaseStreamRetentionPeriodAsync(const Model::DecreaseStreamRetentionPeriodRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DecreaseStreamRetentionPeriodAsync(Model::DecreaseStreamRetentionPeriodRequest&& request, const DecreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an Amazon Kinesis stream and all its shards and data. You must shut
          * down any applications that are operating on the stream before you delete the
@@ -413,6 +453,18 @@ namespace Model
          */
         virtual void DeleteStreamAsync(const Model::DeleteStreamRequest& request, const DeleteStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteStreamCallable(const Model::DeleteStreamRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteStreamOutcomeCallable DeleteStreamCallable(Model::DeleteStreamRequest&& request) const;
+
+        /**
+         * Same as DeleteStreamAsync(const Model::DeleteStreamRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteStreamAsync(Model::DeleteStreamRequest&& request, const DeleteStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified Amazon Kinesis stream.</p> <p>The information about
          * the stream includes its current status, its Amazon Resource Name (ARN), and an
@@ -492,6 +544,18 @@ namespace Model
          */
         virtual void DescribeStreamAsync(const Model::DescribeStreamRequest& request, const DescribeStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStreamCallable(const Model::DescribeStreamRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeStreamOutcomeCallable DescribeStreamCallable(Model::DescribeStreamRequest&& request) const;
+
+        /**
+         * Same as DescribeStreamAsync(const Model::DescribeStreamRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeStreamAsync(Model::DescribeStreamRequest&& request, const DescribeStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables enhanced monitoring.</p>
          */
@@ -511,6 +575,18 @@ namespace Model
          */
         virtual void DisableEnhancedMonitoringAsync(const Model::DisableEnhancedMonitoringRequest& request, const DisableEnhancedMonitoringResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableEnhancedMonitoringCallable(const Model::DisableEnhancedMonitoringRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableEnhancedMonitoringOutcomeCallable DisableEnhancedMonitoringCallable(Model::DisableEnhancedMonitoringRequest&& request) const;
+
+        /**
+         * Same as DisableEnhancedMonitoringAsync(const Model::DisableEnhancedMonitoringRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableEnhancedMonitoringAsync(Model::DisableEnhancedMonitoringRequest&& request, const DisableEnhancedMonitoringResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables enhanced Amazon Kinesis stream monitoring for shard-level
          * metrics.</p>
@@ -533,6 +609,18 @@ namespace Model
          */
         virtual void EnableEnhancedMonitoringAsync(const Model::EnableEnhancedMonitoringRequest& request, const EnableEnhancedMonitoringResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableEnhancedMonitoringCallable(const Model::EnableEnhancedMonitoringRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableEnhancedMonitoringOutcomeCallable EnableEnhancedMonitoringCallable(Model::EnableEnhancedMonitoringRequest&& request) const;
+
+        /**
+         * Same as EnableEnhancedMonitoringAsync(const Model::EnableEnhancedMonitoringRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableEnhancedMonitoringAsync(Model::EnableEnhancedMonitoringRequest&& request, const EnableEnhancedMonitoringResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets data records from an Amazon Kinesis stream's shard.</p> <p>Specify a
          * shard iterator using the <code>ShardIterator</code> parameter. The shard
@@ -699,6 +787,18 @@ namespace Model
          */
         virtual void GetRecordsAsync(const Model::GetRecordsRequest& request, const GetRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRecordsCallable(const Model::GetRecordsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetRecordsOutcomeCallable GetRecordsCallable(Model::GetRecordsRequest&& request) const;
+
+        /**
+         * Same as GetRecordsAsync(const Model::GetRecordsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetRecordsAsync(Model::GetRecordsRequest&& request, const GetRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets an Amazon Kinesis shard iterator. A shard iterator expires five minutes
          * after it is returned to the requester.</p> <p>A shard iterator specifies the
@@ -814,6 +914,18 @@ namespace Model
          */
         virtual void GetShardIteratorAsync(const Model::GetShardIteratorRequest& request, const GetShardIteratorResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetShardIteratorCallable(const Model::GetShardIteratorRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetShardIteratorOutcomeCallable GetShardIteratorCallable(Model::GetShardIteratorRequest&& request) const;
+
+        /**
+         * Same as GetShardIteratorAsync(const Model::GetShardIteratorRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetShardIteratorAsync(Model::GetShardIteratorRequest&& request, const GetShardIteratorResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Increases the Amazon Kinesis stream's retention period, which is the length
          * of time data records are accessible after they are added to the stream. The
@@ -860,6 +972,18 @@ namespace Model
          */
         virtual void IncreaseStreamRetentionPeriodAsync(const Model::IncreaseStreamRetentionPeriodRequest& request, const IncreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as IncreaseStreamRetentionPeriodCallable(const Model::IncreaseStreamRetentionPeriodRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::IncreaseStreamRetentionPeriodOutcomeCallable IncreaseStreamRetentionPeriodCallable(Model::IncreaseStreamRetentionPeriodRequest&& request) const;
+
+        /**
+         * Same as IncreaseStreamRetentionPeriodAsync(const Model::IncreaseStreamRetentionPeriodRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void IncreaseStreamRetentionPeriodAsync(Model::IncreaseStreamRetentionPeriodRequest&& request, const IncreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists your Amazon Kinesis streams.</p> <p>The number of streams may be too
          * large to return from a single call to <code>ListStreams</code>. You can limit
@@ -918,6 +1042,18 @@ namespace Model
          */
         virtual void ListStreamsAsync(const Model::ListStreamsRequest& request, const ListStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListStreamsCallable(const Model::ListStreamsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListStreamsOutcomeCallable ListStreamsCallable(Model::ListStreamsRequest&& request) const;
+
+        /**
+         * Same as ListStreamsAsync(const Model::ListStreamsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListStreamsAsync(Model::ListStreamsRequest&& request, const ListStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the tags for the specified Amazon Kinesis stream.</p>
          */
@@ -937,6 +1073,18 @@ namespace Model
          */
         virtual void ListTagsForStreamAsync(const Model::ListTagsForStreamRequest& request, const ListTagsForStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForStreamCallable(const Model::ListTagsForStreamRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsForStreamOutcomeCallable ListTagsForStreamCallable(Model::ListTagsForStreamRequest&& request) const;
+
+        /**
+         * Same as ListTagsForStreamAsync(const Model::ListTagsForStreamRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsForStreamAsync(Model::ListTagsForStreamRequest&& request, const ListTagsForStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Merges two adjacent shards in an Amazon Kinesis stream and combines them into
          * a single shard to reduce the stream's capacity to ingest and transport data. Two
@@ -1052,6 +1200,18 @@ namespace Model
          */
         virtual void MergeShardsAsync(const Model::MergeShardsRequest& request, const MergeShardsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as MergeShardsCallable(const Model::MergeShardsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::MergeShardsOutcomeCallable MergeShardsCallable(Model::MergeShardsRequest&& request) const;
+
+        /**
+         * Same as MergeShardsAsync(const Model::MergeShardsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void MergeShardsAsync(Model::MergeShardsRequest&& request, const MergeShardsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Writes a single data record into an Amazon Kinesis stream. Call
          * <code>PutRecord</code> to send data into the stream for real-time ingestion and
@@ -1167,6 +1327,18 @@ namespace Model
          */
         virtual void PutRecordAsync(const Model::PutRecordRequest& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRecordCallable(const Model::PutRecordRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutRecordOutcomeCallable PutRecordCallable(Model::PutRecordRequest&& request) const;
+
+        /**
+         * Same as PutRecordAsync(const Model::PutRecordRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutRecordAsync(Model::PutRecordRequest&& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Writes multiple data records into an Amazon Kinesis stream in a single call
          * (also referred to as a <code>PutRecords</code> request). Use this operation to
@@ -1345,6 +1517,18 @@ namespace Model
          */
         virtual void PutRecordsAsync(const Model::PutRecordsRequest& request, const PutRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRecordsCallable(const Model::PutRecordsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutRecordsOutcomeCallable PutRecordsCallable(Model::PutRecordsRequest&& request) const;
+
+        /**
+         * Same as PutRecordsAsync(const Model::PutRecordsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutRecordsAsync(Model::PutRecordsRequest&& request, const PutRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes tags from the specified Amazon Kinesis stream. Removed tags are
          * deleted and cannot be recovered after this operation successfully completes.</p>
@@ -1370,6 +1554,18 @@ namespace Model
          */
         virtual void RemoveTagsFromStreamAsync(const Model::RemoveTagsFromStreamRequest& request, const RemoveTagsFromStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromStreamCallable(const Model::RemoveTagsFromStreamRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsFromStreamOutcomeCallable RemoveTagsFromStreamCallable(Model::RemoveTagsFromStreamRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsFromStreamAsync(const Model::RemoveTagsFromStreamRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsFromStreamAsync(Model::RemoveTagsFromStreamRequest&& request, const RemoveTagsFromStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Splits a shard into two new shards in the Amazon Kinesis stream to increase
          * the stream's capacity to ingest and transport data. <code>SplitShard</code> is
@@ -1518,6 +1714,110 @@ namespace Model
          */
         virtual void SplitShardAsync(const Model::SplitShardRequest& request, const SplitShardResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SplitShardCallable(const Model::SplitShardRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SplitShardOutcomeCallable SplitShardCallable(Model::SplitShardRequest&& request) const;
+
+        /**
+         * Same as SplitShardAsync(const Model::SplitShardRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SplitShardAsync(Model::SplitShardRequest&& request, const SplitShardResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Collects PutRecordsRequestEntry entries and sends them with PutRecords() in calls of at most 500 entries and 5242880 bytes, re-queueing the entries the service could not process. The client must outlive the accumulator.
+         */
+        std::shared_ptr<Aws::Client::BatchAccumulator<Model::PutRecordsRequest, Model::PutRecordsRequestEntry>> PutRecordsAccumulator(const Model::PutRecordsRequest& requestTemplate, const Aws::Client::BatchAccumulatorConfiguration& config = Aws::Client::BatchAccumulatorConfiguration()) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddTagsToStream(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::AddTagsToStreamRequest, Model::AddTagsToStreamOutcome> AddTagsToStreamAwaitable(Model::AddTagsToStreamRequest request) const;
+
+        /**
+         * co_await-able form of CreateStream(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::CreateStreamRequest, Model::CreateStreamOutcome> CreateStreamAwaitable(Model::CreateStreamRequest request) const;
+
+        /**
+         * co_await-able form of DecreaseStreamRetentionPeriod(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::DecreaseStreamRetentionPeriodRequest, Model::DecreaseStreamRetentionPeriodOutcome> DecreaseStreamRetentionPeriodAwaitable(Model::DecreaseStreamRetentionPeriodRequest request) const;
+
+        /**
+         * co_await-able form of DeleteStream(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::DeleteStreamRequest, Model::DeleteStreamOutcome> DeleteStreamAwaitable(Model::DeleteStreamRequest request) const;
+
+        /**
+         * co_await-able form of DescribeStream(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::DescribeStreamRequest, Model::DescribeStreamOutcome> DescribeStreamAwaitable(Model::DescribeStreamRequest request) const;
+
+        /**
+         * co_await-able form of DisableEnhancedMonitoring(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::DisableEnhancedMonitoringRequest, Model::DisableEnhancedMonitoringOutcome> DisableEnhancedMonitoringAwaitable(Model::DisableEnhancedMonitoringRequest request) const;
+
+        /**
+         * co_await-able form of EnableEnhancedMonitoring(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::EnableEnhancedMonitoringRequest, Model::EnableEnhancedMonitoringOutcome> EnableEnhancedMonitoringAwaitable(Model::EnableEnhancedMonitoringRequest request) const;
+
+        /**
+         * co_await-able form of GetRecords(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::GetRecordsRequest, Model::GetRecordsOutcome> GetRecordsAwaitable(Model::GetRecordsRequest request) const;
+
+        /**
+         * co_await-able form of GetShardIterator(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::GetShardIteratorRequest, Model::GetShardIteratorOutcome> GetShardIteratorAwaitable(Model::GetShardIteratorRequest request) const;
+
+        /**
+         * co_await-able form of IncreaseStreamRetentionPeriod(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::IncreaseStreamRetentionPeriodRequest, Model::IncreaseStreamRetentionPeriodOutcome> IncreaseStreamRetentionPeriodAwaitable(Model::IncreaseStreamRetentionPeriodRequest request) const;
+
+        /**
+         * co_await-able form of ListStreams(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::ListStreamsRequest, Model::ListStreamsOutcome> ListStreamsAwaitable(Model::ListStreamsRequest request) const;
+
+        /**
+         * co_await-able form of ListTagsForStream(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::ListTagsForStreamRequest, Model::ListTagsForStreamOutcome> ListTagsForStreamAwaitable(Model::ListTagsForStreamRequest request) const;
+
+        /**
+         * co_await-able form of MergeShards(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::MergeShardsRequest, Model::MergeShardsOutcome> MergeShardsAwaitable(Model::MergeShardsRequest request) const;
+
+        /**
+         * co_await-able form of PutRecord(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::PutRecordRequest, Model::PutRecordOutcome> PutRecordAwaitable(Model::PutRecordRequest request) const;
+
+        /**
+         * co_await-able form of PutRecords(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::PutRecordsRequest, Model::PutRecordsOutcome> PutRecordsAwaitable(Model::PutRecordsRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTagsFromStream(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::RemoveTagsFromStreamRequest, Model::RemoveTagsFromStreamOutcome> RemoveTagsFromStreamAwaitable(Model::RemoveTagsFromStreamRequest request) const;
+
+        /**
+         * co_await-able form of SplitShard(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisClient, Model::SplitShardRequest, Model::SplitShardOutcome> SplitShardAwaitable(Model::SplitShardRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
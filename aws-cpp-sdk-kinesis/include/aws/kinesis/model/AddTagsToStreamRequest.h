@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AddTagsToStreamRequest();
+    inline const char* GetServiceRequestName() const override { return "AddTagsToStream"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
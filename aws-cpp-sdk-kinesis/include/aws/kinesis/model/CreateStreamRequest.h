@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateStreamRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateStream"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DecreaseStreamRetentionPeriodRequest();
+    inline const char* GetServiceRequestName() const override { return "DecreaseStreamRetentionPeriod"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
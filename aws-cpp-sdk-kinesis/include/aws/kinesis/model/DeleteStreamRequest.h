@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteStreamRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteStream"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
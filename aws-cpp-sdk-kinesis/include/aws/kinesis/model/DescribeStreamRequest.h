@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeStreamRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeStream"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
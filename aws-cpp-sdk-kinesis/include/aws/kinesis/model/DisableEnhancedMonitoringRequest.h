@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DisableEnhancedMonitoringRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableEnhancedMonitoring"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     EnableEnhancedMonitoringRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableEnhancedMonitoring"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetRecordsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetRecords"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     GetShardIteratorRequest();
+    inline const char* GetServiceRequestName() const override { return "GetShardIterator"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
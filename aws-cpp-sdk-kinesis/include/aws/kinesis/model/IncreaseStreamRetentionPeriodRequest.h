@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     IncreaseStreamRetentionPeriodRequest();
+    inline const char* GetServiceRequestName() const override { return "IncreaseStreamRetentionPeriod"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
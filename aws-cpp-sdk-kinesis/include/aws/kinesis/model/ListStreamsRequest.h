@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListStreamsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListStreams"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListTagsForStreamRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTagsForStream"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     MergeShardsRequest();
+    inline const char* GetServiceRequestName() const override { return "MergeShards"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
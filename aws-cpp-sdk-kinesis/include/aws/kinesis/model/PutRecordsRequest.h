@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     PutRecordsRequest();
+    inline const char* GetServiceRequestName() const override { return "PutRecords"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
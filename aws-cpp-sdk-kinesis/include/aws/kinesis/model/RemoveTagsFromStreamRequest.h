@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RemoveTagsFromStreamRequest();
+    inline const char* GetServiceRequestName() const override { return "RemoveTagsFromStream"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
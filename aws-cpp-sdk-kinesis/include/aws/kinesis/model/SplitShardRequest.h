@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     SplitShardRequest();
+    inline const char* GetServiceRequestName() const override { return "SplitShard"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
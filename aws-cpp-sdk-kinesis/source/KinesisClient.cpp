@@ -126,7 +126,7 @@ AddTagsToStreamOutcome KinesisClient::AddTagsToStream(const AddTagsToStreamReque
 
 AddTagsToStreamOutcomeCallable KinesisClient::AddTagsToStreamCallable(const AddTagsToStreamRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTagsToStream(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTagsToStream(request); } );
 }
 
 void KinesisClient::AddTagsToStreamAsync(const AddTagsToStreamRequest& request, const AddTagsToStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -134,6 +134,16 @@ void KinesisClient::AddTagsToStreamAsync(const AddTagsToStreamRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsToStreamAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsToStreamOutcomeCallable KinesisClient::AddTagsToStreamCallable(AddTagsToStreamRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::AddTagsToStream, this, std::move(request)));
+}
+
+void KinesisClient::AddTagsToStreamAsync(AddTagsToStreamRequest&& request, const AddTagsToStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::AddTagsToStreamAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::AddTagsToStreamAsyncHelper(const AddTagsToStreamRequest& request, const AddTagsToStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTagsToStream(request), context);
@@ -157,7 +167,7 @@ CreateStreamOutcome KinesisClient::CreateStream(const CreateStreamRequest& reque
 
 CreateStreamOutcomeCallable KinesisClient::CreateStreamCallable(const CreateStreamRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateStream(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateStream(request); } );
 }
 
 void KinesisClient::CreateStreamAsync(const CreateStreamRequest& request, const CreateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -165,6 +175,16 @@ void KinesisClient::CreateStreamAsync(const CreateStreamRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->CreateStreamAsyncHelper( request, handler, context ); } );
 }
 
+CreateStreamOutcomeCallable KinesisClient::CreateStreamCallable(CreateStreamRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::CreateStream, this, std::move(request)));
+}
+
+void KinesisClient::CreateStreamAsync(CreateStreamRequest&& request, const CreateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::CreateStreamAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::CreateStreamAsyncHelper(const CreateStreamRequest& request, const CreateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateStream(request), context);
@@ -188,7 +208,7 @@ DecreaseStreamRetentionPeriodOutcome KinesisClient::DecreaseStreamRetentionPerio
 
 DecreaseStreamRetentionPeriodOutcomeCallable KinesisClient::DecreaseStreamRetentionPeriodCallable(const DecreaseStreamRetentionPeriodRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DecreaseStreamRetentionPeriod(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DecreaseStreamRetentionPeriod(request); } );
 }
 
 void KinesisClient::DecreaseStreamRetentionPeriodAsync(const DecreaseStreamRetentionPeriodRequest& request, const DecreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -196,6 +216,16 @@ void KinesisClient::DecreaseStreamRetentionPeriodAsync(const DecreaseStreamReten
   m_executor->Submit( [this, request, handler, context](){ this->DecreaseStreamRetentionPeriodAsyncHelper( request, handler, context ); } );
 }
 
+DecreaseStreamRetentionPeriodOutcomeCallable KinesisClient::DecreaseStreamRetentionPeriodCallable(DecreaseStreamRetentionPeriodRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::DecreaseStreamRetentionPeriod, this, std::move(request)));
+}
+
+void KinesisClient::DecreaseStreamRetentionPeriodAsync(DecreaseStreamRetentionPeriodRequest&& request, const DecreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::DecreaseStreamRetentionPeriodAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::DecreaseStreamRetentionPeriodAsyncHelper(const DecreaseStreamRetentionPeriodRequest& request, const DecreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DecreaseStreamRetentionPeriod(request), context);
@@ -219,7 +249,7 @@ DeleteStreamOutcome KinesisClient::DeleteStream(const DeleteStreamRequest& reque
 
 DeleteStreamOutcomeCallable KinesisClient::DeleteStreamCallable(const DeleteStreamRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteStream(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteStream(request); } );
 }
 
 void KinesisClient::DeleteStreamAsync(const DeleteStreamRequest& request, const DeleteStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -227,6 +257,16 @@ void KinesisClient::DeleteStreamAsync(const DeleteStreamRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DeleteStreamAsyncHelper( request, handler, context ); } );
 }
 
+DeleteStreamOutcomeCallable KinesisClient::DeleteStreamCallable(DeleteStreamRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::DeleteStream, this, std::move(request)));
+}
+
+void KinesisClient::DeleteStreamAsync(DeleteStreamRequest&& request, const DeleteStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::DeleteStreamAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::DeleteStreamAsyncHelper(const DeleteStreamRequest& request, const DeleteStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteStream(request), context);
@@ -250,7 +290,7 @@ DescribeStreamOutcome KinesisClient::DescribeStream(const DescribeStreamRequest&
 
 DescribeStreamOutcomeCallable KinesisClient::DescribeStreamCallable(const DescribeStreamRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeStream(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeStream(request); } );
 }
 
 void KinesisClient::DescribeStreamAsync(const DescribeStreamRequest& request, const DescribeStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -258,6 +298,16 @@ void KinesisClient::DescribeStreamAsync(const DescribeStreamRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DescribeStreamAsyncHelper( request, handler, context ); } );
 }
 
+DescribeStreamOutcomeCallable KinesisClient::DescribeStreamCallable(DescribeStreamRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::DescribeStream, this, std::move(request)));
+}
+
+void KinesisClient::DescribeStreamAsync(DescribeStreamRequest&& request, const DescribeStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::DescribeStreamAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::DescribeStreamAsyncHelper(const DescribeStreamRequest& request, const DescribeStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeStream(request), context);
@@ -281,7 +331,7 @@ DisableEnhancedMonitoringOutcome KinesisClient::DisableEnhancedMonitoring(const
 
 DisableEnhancedMonitoringOutcomeCallable KinesisClient::DisableEnhancedMonitoringCallable(const DisableEnhancedMonitoringRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableEnhancedMonitoring(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableEnhancedMonitoring(request); } );
 }
 
 void KinesisClient::DisableEnhancedMonitoringAsync(const DisableEnhancedMonitoringRequest& request, const DisableEnhancedMonitoringResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -289,6 +339,16 @@ void KinesisClient::DisableEnhancedMonitoringAsync(const DisableEnhancedMonitori
   m_executor->Submit( [this, request, handler, context](){ this->DisableEnhancedMonitoringAsyncHelper( request, handler, context ); } );
 }
 
+DisableEnhancedMonitoringOutcomeCallable KinesisClient::DisableEnhancedMonitoringCallable(DisableEnhancedMonitoringRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::DisableEnhancedMonitoring, this, std::move(request)));
+}
+
+void KinesisClient::DisableEnhancedMonitoringAsync(DisableEnhancedMonitoringRequest&& request, const DisableEnhancedMonitoringResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::DisableEnhancedMonitoringAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::DisableEnhancedMonitoringAsyncHelper(const DisableEnhancedMonitoringRequest& request, const DisableEnhancedMonitoringResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableEnhancedMonitoring(request), context);
@@ -312,7 +372,7 @@ EnableEnhancedMonitoringOutcome KinesisClient::EnableEnhancedMonitoring(const En
 
 EnableEnhancedMonitoringOutcomeCallable KinesisClient::EnableEnhancedMonitoringCallable(const EnableEnhancedMonitoringRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableEnhancedMonitoring(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableEnhancedMonitoring(request); } );
 }
 
 void KinesisClient::EnableEnhancedMonitoringAsync(const EnableEnhancedMonitoringRequest& request, const EnableEnhancedMonitoringResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -320,6 +380,16 @@ void KinesisClient::EnableEnhancedMonitoringAsync(const EnableEnhancedMonitoring
   m_executor->Submit( [this, request, handler, context](){ this->EnableEnhancedMonitoringAsyncHelper( request, handler, context ); } );
 }
 
+EnableEnhancedMonitoringOutcomeCallable KinesisClient::EnableEnhancedMonitoringCallable(EnableEnhancedMonitoringRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::EnableEnhancedMonitoring, this, std::move(request)));
+}
+
+void KinesisClient::EnableEnhancedMonitoringAsync(EnableEnhancedMonitoringRequest&& request, const EnableEnhancedMonitoringResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::EnableEnhancedMonitoringAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::EnableEnhancedMonitoringAsyncHelper(const EnableEnhancedMonitoringRequest& request, const EnableEnhancedMonitoringResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableEnhancedMonitoring(request), context);
@@ -343,7 +413,7 @@ GetRecordsOutcome KinesisClient::GetRecords(const GetRecordsRequest& request) co
 
 GetRecordsOutcomeCallable KinesisClient::GetRecordsCallable(const GetRecordsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetRecords(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetRecords(request); } );
 }
 
 void KinesisClient::GetRecordsAsync(const GetRecordsRequest& request, const GetRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -351,6 +421,16 @@ void KinesisClient::GetRecordsAsync(const GetRecordsRequest& request, const GetR
   m_executor->Submit( [this, request, handler, context](){ this->GetRecordsAsyncHelper( request, handler, context ); } );
 }
 
+GetRecordsOutcomeCallable KinesisClient::GetRecordsCallable(GetRecordsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::GetRecords, this, std::move(request)));
+}
+
+void KinesisClient::GetRecordsAsync(GetRecordsRequest&& request, const GetRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::GetRecordsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::GetRecordsAsyncHelper(const GetRecordsRequest& request, const GetRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetRecords(request), context);
@@ -374,7 +454,7 @@ GetShardIteratorOutcome KinesisClient::GetShardIterator(const GetShardIteratorRe
 
 GetShardIteratorOutcomeCallable KinesisClient::GetShardIteratorCallable(const GetShardIteratorRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetShardIterator(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetShardIterator(request); } );
 }
 
 void KinesisClient::GetShardIteratorAsync(const GetShardIteratorRequest& request, const GetShardIteratorResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -382,6 +462,16 @@ void KinesisClient::GetShardIteratorAsync(const GetShardIteratorRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->GetShardIteratorAsyncHelper( request, handler, context ); } );
 }
 
+GetShardIteratorOutcomeCallable KinesisClient::GetShardIteratorCallable(GetShardIteratorRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::GetShardIterator, this, std::move(request)));
+}
+
+void KinesisClient::GetShardIteratorAsync(GetShardIteratorRequest&& request, const GetShardIteratorResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::GetShardIteratorAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::GetShardIteratorAsyncHelper(const GetShardIteratorRequest& request, const GetShardIteratorResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetShardIterator(request), context);
@@ -405,7 +495,7 @@ IncreaseStreamRetentionPeriodOutcome KinesisClient::IncreaseStreamRetentionPerio
 
 IncreaseStreamRetentionPeriodOutcomeCallable KinesisClient::IncreaseStreamRetentionPeriodCallable(const IncreaseStreamRetentionPeriodRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->IncreaseStreamRetentionPeriod(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->IncreaseStreamRetentionPeriod(request); } );
 }
 
 void KinesisClient::IncreaseStreamRetentionPeriodAsync(const IncreaseStreamRetentionPeriodRequest& request, const IncreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -413,6 +503,16 @@ void KinesisClient::IncreaseStreamRetentionPeriodAsync(const IncreaseStreamReten
   m_executor->Submit( [this, request, handler, context](){ this->IncreaseStreamRetentionPeriodAsyncHelper( request, handler, context ); } );
 }
 
+IncreaseStreamRetentionPeriodOutcomeCallable KinesisClient::IncreaseStreamRetentionPeriodCallable(IncreaseStreamRetentionPeriodRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::IncreaseStreamRetentionPeriod, this, std::move(request)));
+}
+
+void KinesisClient::IncreaseStreamRetentionPeriodAsync(IncreaseStreamRetentionPeriodRequest&& request, const IncreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::IncreaseStreamRetentionPeriodAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::IncreaseStreamRetentionPeriodAsyncHelper(const IncreaseStreamRetentionPeriodRequest& request, const IncreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, IncreaseStreamRetentionPeriod(request), context);
@@ -436,7 +536,7 @@ ListStreamsOutcome KinesisClient::ListStreams(const ListStreamsRequest& request)
 
 ListStreamsOutcomeCallable KinesisClient::ListStreamsCallable(const ListStreamsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListStreams(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListStreams(request); } );
 }
 
 void KinesisClient::ListStreamsAsync(const ListStreamsRequest& request, const ListStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -444,6 +544,16 @@ void KinesisClient::ListStreamsAsync(const ListStreamsRequest& request, const Li
   m_executor->Submit( [this, request, handler, context](){ this->ListStreamsAsyncHelper( request, handler, context ); } );
 }
 
+ListStreamsOutcomeCallable KinesisClient::ListStreamsCallable(ListStreamsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::ListStreams, this, std::move(request)));
+}
+
+void KinesisClient::ListStreamsAsync(ListStreamsRequest&& request, const ListStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::ListStreamsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::ListStreamsAsyncHelper(const ListStreamsRequest& request, const ListStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListStreams(request), context);
@@ -467,7 +577,7 @@ ListTagsForStreamOutcome KinesisClient::ListTagsForStream(const ListTagsForStrea
 
 ListTagsForStreamOutcomeCallable KinesisClient::ListTagsForStreamCallable(const ListTagsForStreamRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTagsForStream(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTagsForStream(request); } );
 }
 
 void KinesisClient::ListTagsForStreamAsync(const ListTagsForStreamRequest& request, const ListTagsForStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -475,6 +585,16 @@ void KinesisClient::ListTagsForStreamAsync(const ListTagsForStreamRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsForStreamAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsForStreamOutcomeCallable KinesisClient::ListTagsForStreamCallable(ListTagsForStreamRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::ListTagsForStream, this, std::move(request)));
+}
+
+void KinesisClient::ListTagsForStreamAsync(ListTagsForStreamRequest&& request, const ListTagsForStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::ListTagsForStreamAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::ListTagsForStreamAsyncHelper(const ListTagsForStreamRequest& request, const ListTagsForStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTagsForStream(request), context);
@@ -498,7 +618,7 @@ MergeShardsOutcome KinesisClient::MergeShards(const MergeShardsRequest& request)
 
 MergeShardsOutcomeCallable KinesisClient::MergeShardsCallable(const MergeShardsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->MergeShards(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->MergeShards(request); } );
 }
 
 void KinesisClient::MergeShardsAsync(const MergeShardsRequest& request, const MergeShardsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -506,6 +626,16 @@ void KinesisClient::MergeShardsAsync(const MergeShardsRequest& request, const Me
   m_executor->Submit( [this, request, handler, context](){ this->MergeShardsAsyncHelper( request, handler, context ); } );
 }
 
+MergeShardsOutcomeCallable KinesisClient::MergeShardsCallable(MergeShardsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::MergeShards, this, std::move(request)));
+}
+
+void KinesisClient::MergeShardsAsync(MergeShardsRequest&& request, const MergeShardsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::MergeShardsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::MergeShardsAsyncHelper(const MergeShardsRequest& request, const MergeShardsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, MergeShards(request), context);
@@ -529,7 +659,7 @@ PutRecordOutcome KinesisClient::PutRecord(const PutRecordRequest& request) const
 
 PutRecordOutcomeCallable KinesisClient::PutRecordCallable(const PutRecordRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutRecord(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutRecord(request); } );
 }
 
 void KinesisClient::PutRecordAsync(const PutRecordRequest& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -537,6 +667,16 @@ void KinesisClient::PutRecordAsync(const PutRecordRequest& request, const PutRec
   m_executor->Submit( [this, request, handler, context](){ this->PutRecordAsyncHelper( request, handler, context ); } );
 }
 
+PutRecordOutcomeCallable KinesisClient::PutRecordCallable(PutRecordRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::PutRecord, this, std::move(request)));
+}
+
+void KinesisClient::PutRecordAsync(PutRecordRequest&& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::PutRecordAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::PutRecordAsyncHelper(const PutRecordRequest& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutRecord(request), context);
@@ -560,7 +700,7 @@ PutRecordsOutcome KinesisClient::PutRecords(const PutRecordsRequest& request) co
 
 PutRecordsOutcomeCallable KinesisClient::PutRecordsCallable(const PutRecordsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutRecords(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutRecords(request); } );
 }
 
 void KinesisClient::PutRecordsAsync(const PutRecordsRequest& request, const PutRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -568,6 +708,16 @@ void KinesisClient::PutRecordsAsync(const PutRecordsRequest& request, const PutR
   m_executor->Submit( [this, request, handler, context](){ this->PutRecordsAsyncHelper( request, handler, context ); } );
 }
 
+PutRecordsOutcomeCallable KinesisClient::PutRecordsCallable(PutRecordsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::PutRecords, this, std::move(request)));
+}
+
+void KinesisClient::PutRecordsAsync(PutRecordsRequest&& request, const PutRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::PutRecordsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::PutRecordsAsyncHelper(const PutRecordsRequest& request, const PutRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutRecords(request), context);
@@ -591,7 +741,7 @@ RemoveTagsFromStreamOutcome KinesisClient::RemoveTagsFromStream(const RemoveTags
 
 RemoveTagsFromStreamOutcomeCallable KinesisClient::RemoveTagsFromStreamCallable(const RemoveTagsFromStreamRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTagsFromStream(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTagsFromStream(request); } );
 }
 
 void KinesisClient::RemoveTagsFromStreamAsync(const RemoveTagsFromStreamRequest& request, const RemoveTagsFromStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -599,6 +749,16 @@ void KinesisClient::RemoveTagsFromStreamAsync(const RemoveTagsFromStreamRequest&
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsFromStreamAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsFromStreamOutcomeCallable KinesisClient::RemoveTagsFromStreamCallable(RemoveTagsFromStreamRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::RemoveTagsFromStream, this, std::move(request)));
+}
+
+void KinesisClient::RemoveTagsFromStreamAsync(RemoveTagsFromStreamRequest&& request, const RemoveTagsFromStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::RemoveTagsFromStreamAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::RemoveTagsFromStreamAsyncHelper(const RemoveTagsFromStreamRequest& request, const RemoveTagsFromStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTagsFromStream(request), context);
@@ -622,7 +782,7 @@ SplitShardOutcome KinesisClient::SplitShard(const SplitShardRequest& request) co
 
 SplitShardOutcomeCallable KinesisClient::SplitShardCallable(const SplitShardRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SplitShard(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SplitShard(request); } );
 }
 
 void KinesisClient::SplitShardAsync(const SplitShardRequest& request, const SplitShardResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -630,8 +790,133 @@ void KinesisClient::SplitShardAsync(const SplitShardRequest& request, const Spli
   m_executor->Submit( [this, request, handler, context](){ this->SplitShardAsyncHelper( request, handler, context ); } );
 }
 
+SplitShardOutcomeCallable KinesisClient::SplitShardCallable(SplitShardRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisClient::SplitShard, this, std::move(request)));
+}
+
+void KinesisClient::SplitShardAsync(SplitShardRequest&& request, const SplitShardResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisClient::SplitShardAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisClient::SplitShardAsyncHelper(const SplitShardRequest& request, const SplitShardResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SplitShard(request), context);
 }
 
+std::shared_ptr<BatchAccumulator<PutRecordsRequest, PutRecordsRequestEntry>> KinesisClient::PutRecordsAccumulator(const PutRecordsRequest& requestTemplate, const BatchAccumulatorConfiguration& config) const
+{
+  return Aws::MakeShared<BatchAccumulator<PutRecordsRequest, PutRecordsRequestEntry>>(ALLOCATION_TAG, requestTemplate, 500, 5242880, config,
+    [](const PutRecordsRequestEntry& entry) { return entry.GetData().GetLength() + entry.GetPartitionKey().size(); },
+    [this](const PutRecordsRequest& requestTemplate, Aws::Vector<PutRecordsRequestEntry>&& batch, Aws::Vector<BatchEntryFailure<PutRecordsRequestEntry>>& failures)
+    {
+      PutRecordsRequest request(requestTemplate);
+      request.SetRecords(batch);
+      auto outcome = PutRecords(request);
+      if(!outcome.IsSuccess())
+      {
+        for(size_t i = 0; i < batch.size(); ++i)
+        {
+          failures.emplace_back(i, std::move(batch[i]), outcome.GetError().GetMessage(), outcome.GetError().ShouldRetry());
+        }
+        return;
+      }
+      const auto& results = outcome.GetResult().GetRecords();
+      for(size_t i = 0; i < batch.size() && i < results.size(); ++i)
+      {
+        if(!results[i].GetErrorCode().empty())
+        {
+          failures.emplace_back(i, std::move(batch[i]), results[i].GetErrorMessage(), true);
+        }
+      }
+    }, GetRetryStrategy());
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<KinesisClient, AddTagsToStreamRequest, AddTagsToStreamOutcome> KinesisClient::AddTagsToStreamAwaitable(AddTagsToStreamRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::AddTagsToStream, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, CreateStreamRequest, CreateStreamOutcome> KinesisClient::CreateStreamAwaitable(CreateStreamRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::CreateStream, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, DecreaseStreamRetentionPeriodRequest, DecreaseStreamRetentionPeriodOutcome> KinesisClient::DecreaseStreamRetentionPeriodAwaitable(DecreaseStreamRetentionPeriodRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::DecreaseStreamRetentionPeriod, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, DeleteStreamRequest, DeleteStreamOutcome> KinesisClient::DeleteStreamAwaitable(DeleteStreamRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::DeleteStream, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, DescribeStreamRequest, DescribeStreamOutcome> KinesisClient::DescribeStreamAwaitable(DescribeStreamRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::DescribeStream, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, DisableEnhancedMonitoringRequest, DisableEnhancedMonitoringOutcome> KinesisClient::DisableEnhancedMonitoringAwaitable(DisableEnhancedMonitoringRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::DisableEnhancedMonitoring, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, EnableEnhancedMonitoringRequest, EnableEnhancedMonitoringOutcome> KinesisClient::EnableEnhancedMonitoringAwaitable(EnableEnhancedMonitoringRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::EnableEnhancedMonitoring, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, GetRecordsRequest, GetRecordsOutcome> KinesisClient::GetRecordsAwaitable(GetRecordsRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::GetRecords, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, GetShardIteratorRequest, GetShardIteratorOutcome> KinesisClient::GetShardIteratorAwaitable(GetShardIteratorRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::GetShardIterator, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, IncreaseStreamRetentionPeriodRequest, IncreaseStreamRetentionPeriodOutcome> KinesisClient::IncreaseStreamRetentionPeriodAwaitable(IncreaseStreamRetentionPeriodRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::IncreaseStreamRetentionPeriod, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, ListStreamsRequest, ListStreamsOutcome> KinesisClient::ListStreamsAwaitable(ListStreamsRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::ListStreams, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, ListTagsForStreamRequest, ListTagsForStreamOutcome> KinesisClient::ListTagsForStreamAwaitable(ListTagsForStreamRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::ListTagsForStream, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, MergeShardsRequest, MergeShardsOutcome> KinesisClient::MergeShardsAwaitable(MergeShardsRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::MergeShards, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, PutRecordRequest, PutRecordOutcome> KinesisClient::PutRecordAwaitable(PutRecordRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::PutRecord, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, PutRecordsRequest, PutRecordsOutcome> KinesisClient::PutRecordsAwaitable(PutRecordsRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::PutRecords, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, RemoveTagsFromStreamRequest, RemoveTagsFromStreamOutcome> KinesisClient::RemoveTagsFromStreamAwaitable(RemoveTagsFromStreamRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::RemoveTagsFromStream, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisClient, SplitShardRequest, SplitShardOutcome> KinesisClient::SplitShardAwaitable(SplitShardRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisClient::SplitShard, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,51 +29,47 @@ namespace Aws
       namespace MetricsNameMapper
       {
 
-        static const int IncomingBytes_HASH = HashingUtils::HashString("IncomingBytes");
-        static const int IncomingRecords_HASH = HashingUtils::HashString("IncomingRecords");
-        static const int OutgoingBytes_HASH = HashingUtils::HashString("OutgoingBytes");
-        static const int OutgoingRecords_HASH = HashingUtils::HashString("OutgoingRecords");
-        static const int WriteProvisionedThroughputExceeded_HASH = HashingUtils::HashString("WriteProvisionedThroughputExceeded");
-        static const int ReadProvisionedThroughputExceeded_HASH = HashingUtils::HashString("ReadProvisionedThroughputExceeded");
-        static const int IteratorAgeMilliseconds_HASH = HashingUtils::HashString("IteratorAgeMilliseconds");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int IncomingBytes_HASH = -49991739;
+        static const int IncomingRecords_HASH = -70246628;
+        static const int OutgoingBytes_HASH = 861933631;
+        static const int OutgoingRecords_HASH = 116705558;
+        static const int WriteProvisionedThroughputExceeded_HASH = 129880946;
+        static const int ReadProvisionedThroughputExceeded_HASH = -666491685;
+        static const int IteratorAgeMilliseconds_HASH = -2131747261;
+        static const int ALL_HASH = 64897;
 
 
         MetricsName GetMetricsNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IncomingBytes_HASH)
+          switch (hashCode)
           {
+          case IncomingBytes_HASH:
             return MetricsName::IncomingBytes;
-          }
-          else if (hashCode == IncomingRecords_HASH)
-          {
+          case IncomingRecords_HASH:
             return MetricsName::IncomingRecords;
-          }
-          else if (hashCode == OutgoingBytes_HASH)
-          {
+          case OutgoingBytes_HASH:
             return MetricsName::OutgoingBytes;
-          }
-          else if (hashCode == OutgoingRecords_HASH)
-          {
+          case OutgoingRecords_HASH:
             return MetricsName::OutgoingRecords;
-          }
-          else if (hashCode == WriteProvisionedThroughputExceeded_HASH)
-          {
+          case WriteProvisionedThroughputExceeded_HASH:
             return MetricsName::WriteProvisionedThroughputExceeded;
-          }
-          else if (hashCode == ReadProvisionedThroughputExceeded_HASH)
-          {
+          case ReadProvisionedThroughputExceeded_HASH:
             return MetricsName::ReadProvisionedThroughputExceeded;
-          }
-          else if (hashCode == IteratorAgeMilliseconds_HASH)
-          {
+          case IteratorAgeMilliseconds_HASH:
             return MetricsName::IteratorAgeMilliseconds;
-          }
-          else if (hashCode == ALL_HASH)
-          {
+          case ALL_HASH:
             return MetricsName::ALL;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
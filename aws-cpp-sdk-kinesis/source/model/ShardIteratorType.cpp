@@ -29,36 +29,38 @@ namespace Aws
       namespace ShardIteratorTypeMapper
       {
 
-        static const int AT_SEQUENCE_NUMBER_HASH = HashingUtils::HashString("AT_SEQUENCE_NUMBER");
-        static const int AFTER_SEQUENCE_NUMBER_HASH = HashingUtils::HashString("AFTER_SEQUENCE_NUMBER");
-        static const int TRIM_HORIZON_HASH = HashingUtils::HashString("TRIM_HORIZON");
-        static const int LATEST_HASH = HashingUtils::HashString("LATEST");
-        static const int AT_TIMESTAMP_HASH = HashingUtils::HashString("AT_TIMESTAMP");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int AT_SEQUENCE_NUMBER_HASH = -1489047173;
+        static const int AFTER_SEQUENCE_NUMBER_HASH = 489800964;
+        static const int TRIM_HORIZON_HASH = 1909941854;
+        static const int LATEST_HASH = -2056551545;
+        static const int AT_TIMESTAMP_HASH = 533190634;
 
 
         ShardIteratorType GetShardIteratorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AT_SEQUENCE_NUMBER_HASH)
+          switch (hashCode)
           {
+          case AT_SEQUENCE_NUMBER_HASH:
             return ShardIteratorType::AT_SEQUENCE_NUMBER;
-          }
-          else if (hashCode == AFTER_SEQUENCE_NUMBER_HASH)
-          {
+          case AFTER_SEQUENCE_NUMBER_HASH:
             return ShardIteratorType::AFTER_SEQUENCE_NUMBER;
-          }
-          else if (hashCode == TRIM_HORIZON_HASH)
-          {
+          case TRIM_HORIZON_HASH:
             return ShardIteratorType::TRIM_HORIZON;
-          }
-          else if (hashCode == LATEST_HASH)
-          {
+          case LATEST_HASH:
             return ShardIteratorType::LATEST;
-          }
-          else if (hashCode == AT_TIMESTAMP_HASH)
-          {
+          case AT_TIMESTAMP_HASH:
             return ShardIteratorType::AT_TIMESTAMP;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
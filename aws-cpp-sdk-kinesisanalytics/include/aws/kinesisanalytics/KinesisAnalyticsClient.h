@@ -34,6 +34,9 @@
 #include <aws/kinesisanalytics/model/StopApplicationResult.h>
 #include <aws/kinesisanalytics/model/UpdateApplicationResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -212,6 +215,18 @@ namespace Model
          */
         virtual void AddApplicationInputAsync(const Model::AddApplicationInputRequest& request, const AddApplicationInputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddApplicationInputCallable(const Model::AddApplicationInputRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddApplicationInputOutcomeCallable AddApplicationInputCallable(Model::AddApplicationInputRequest&& request) const;
+
+        /**
+         * Same as AddApplicationInputAsync(const Model::AddApplicationInputRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddApplicationInputAsync(Model::AddApplicationInputRequest&& request, const AddApplicationInputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds an external destination to your Amazon Kinesis Analytics
          * application.</p> <p>If you want Amazon Kinesis Analytics to deliver data from an
@@ -285,6 +300,18 @@ namespace Model
          */
         virtual void AddApplicationOutputAsync(const Model::AddApplicationOutputRequest& request, const AddApplicationOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddApplicationOutputCallable(const Model::AddApplicationOutputRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddApplicationOutputOutcomeCallable AddApplicationOutputCallable(Model::AddApplicationOutputRequest&& request) const;
+
+        /**
+         * Same as AddApplicationOutputAsync(const Model::AddApplicationOutputRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddApplicationOutputAsync(Model::AddApplicationOutputRequest&& request, const AddApplicationOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds a reference data source to an existing application.</p> <p>Amazon
          * Kinesis Analytics reads reference data (that is, an Amazon S3 object) and
@@ -340,6 +367,18 @@ namespace Model
          */
         virtual void AddApplicationReferenceDataSourceAsync(const Model::AddApplicationReferenceDataSourceRequest& request, const AddApplicationReferenceDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddApplicationReferenceDataSourceCallable(const Model::AddApplicationReferenceDataSourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddApplicationReferenceDataSourceOutcomeCallable AddApplicationReferenceDataSourceCallable(Model::AddApplicationReferenceDataSourceRequest&& request) const;
+
+        /**
+         * Same as AddApplicationReferenceDataSourceAsync(const Model::AddApplicationReferenceDataSourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddApplicationReferenceDataSourceAsync(Model::AddApplicationReferenceDataSourceRequest&& request, const AddApplicationReferenceDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates an Amazon Kinesis Analytics application. You can configure each
          * application with one streaming source as input, application code to process the
@@ -425,6 +464,18 @@ namespace Model
          */
         virtual void CreateApplicationAsync(const Model::CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateApplicationCallable(const Model::CreateApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateApplicationOutcomeCallable CreateApplicationCallable(Model::CreateApplicationRequest&& request) const;
+
+        /**
+         * Same as CreateApplicationAsync(const Model::CreateApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateApplicationAsync(Model::CreateApplicationRequest&& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified application. Amazon Kinesis Analytics halts application
          * execution and deletes the application, including any application artifacts (such
@@ -456,6 +507,18 @@ namespace Model
          */
         virtual void DeleteApplicationAsync(const Model::DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteApplicationCallable(const Model::DeleteApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteApplicationOutcomeCallable DeleteApplicationCallable(Model::DeleteApplicationRequest&& request) const;
+
+        /**
+         * Same as DeleteApplicationAsync(const Model::DeleteApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteApplicationAsync(Model::DeleteApplicationRequest&& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes output destination configuration from your application configuration.
          * Amazon Kinesis Analytics will no longer write data from the corresponding
@@ -487,6 +550,18 @@ namespace Model
          */
         virtual void DeleteApplicationOutputAsync(const Model::DeleteApplicationOutputRequest& request, const DeleteApplicationOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteApplicationOutputCallable(const Model::DeleteApplicationOutputRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteApplicationOutputOutcomeCallable DeleteApplicationOutputCallable(Model::DeleteApplicationOutputRequest&& request) const;
+
+        /**
+         * Same as DeleteApplicationOutputAsync(const Model::DeleteApplicationOutputRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteApplicationOutputAsync(Model::DeleteApplicationOutputRequest&& request, const DeleteApplicationOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a reference data source configuration from the specified application
          * configuration.</p> <p>If the application is running, Amazon Kinesis Analytics
@@ -521,6 +596,18 @@ namespace Model
          */
         virtual void DeleteApplicationReferenceDataSourceAsync(const Model::DeleteApplicationReferenceDataSourceRequest& request, const DeleteApplicationReferenceDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteApplicationReferenceDataSourceCallable(const Model::DeleteApplicationReferenceDataSourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteApplicationReferenceDataSourceOutcomeCallable DeleteApplicationReferenceDataSourceCallable(Model::DeleteApplicationReferenceDataSourceRequest&& request) const;
+
+        /**
+         * Same as DeleteApplicationReferenceDataSourceAsync(const Model::DeleteApplicationReferenceDataSourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteApplicationReferenceDataSourceAsync(Model::DeleteApplicationReferenceDataSourceRequest&& request, const DeleteApplicationReferenceDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about a specific Amazon Kinesis Analytics
          * application.</p> <p>If you want to retrieve a list of all applications in your
@@ -558,6 +645,18 @@ namespace Model
          */
         virtual void DescribeApplicationAsync(const Model::DescribeApplicationRequest& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeApplicationCallable(const Model::DescribeApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeApplicationOutcomeCallable DescribeApplicationCallable(Model::DescribeApplicationRequest&& request) const;
+
+        /**
+         * Same as DescribeApplicationAsync(const Model::DescribeApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeApplicationAsync(Model::DescribeApplicationRequest&& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Infers a schema by evaluating sample records on the specified streaming
          * source (Amazon Kinesis stream or Amazon Kinesis Firehose delivery stream). In
@@ -610,6 +709,18 @@ namespace Model
          */
         virtual void DiscoverInputSchemaAsync(const Model::DiscoverInputSchemaRequest& request, const DiscoverInputSchemaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DiscoverInputSchemaCallable(const Model::DiscoverInputSchemaRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DiscoverInputSchemaOutcomeCallable DiscoverInputSchemaCallable(Model::DiscoverInputSchemaRequest&& request) const;
+
+        /**
+         * Same as DiscoverInputSchemaAsync(const Model::DiscoverInputSchemaRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DiscoverInputSchemaAsync(Model::DiscoverInputSchemaRequest&& request, const DiscoverInputSchemaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of Amazon Kinesis Analytics applications in your account. For
          * each application, the response includes the application name, Amazon Resource
@@ -653,6 +764,18 @@ namespace Model
          */
         virtual void ListApplicationsAsync(const Model::ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListApplicationsCallable(const Model::ListApplicationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListApplicationsOutcomeCallable ListApplicationsCallable(Model::ListApplicationsRequest&& request) const;
+
+        /**
+         * Same as ListApplicationsAsync(const Model::ListApplicationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListApplicationsAsync(Model::ListApplicationsRequest&& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts the specified Amazon Kinesis Analytics application. After creating an
          * application, you must exclusively call this operation to start your
@@ -699,6 +822,18 @@ namespace Model
          */
         virtual void StartApplicationAsync(const Model::StartApplicationRequest& request, const StartApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartApplicationCallable(const Model::StartApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StartApplicationOutcomeCallable StartApplicationCallable(Model::StartApplicationRequest&& request) const;
+
+        /**
+         * Same as StartApplicationAsync(const Model::StartApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StartApplicationAsync(Model::StartApplicationRequest&& request, const StartApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stops the application from processing input data. You can stop an application
          * only if it is in the running state. You can use the <a>DescribeApplication</a>
@@ -736,6 +871,18 @@ namespace Model
          */
         virtual void StopApplicationAsync(const Model::StopApplicationRequest& request, const StopApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopApplicationCallable(const Model::StopApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StopApplicationOutcomeCallable StopApplicationCallable(Model::StopApplicationRequest&& request) const;
+
+        /**
+         * Same as StopApplicationAsync(const Model::StopApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StopApplicationAsync(Model::StopApplicationRequest&& request, const StopApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates an existing Kinesis Analytics application. Using this API, you can
          * update application code, input configuration, and output configuration. </p>
@@ -770,6 +917,85 @@ namespace Model
          */
         virtual void UpdateApplicationAsync(const Model::UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateApplicationCallable(const Model::UpdateApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateApplicationOutcomeCallable UpdateApplicationCallable(Model::UpdateApplicationRequest&& request) const;
+
+        /**
+         * Same as UpdateApplicationAsync(const Model::UpdateApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateApplicationAsync(Model::UpdateApplicationRequest&& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddApplicationInput(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisAnalyticsClient, Model::AddApplicationInputRequest, Model::AddApplicationInputOutcome> AddApplicationInputAwaitable(Model::AddApplicationInputRequest request) const;
+
+        /**
+         * co_await-able form of AddApplicationOutput(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisAnalyticsClient, Model::AddApplicationOutputRequest, Model::AddApplicationOutputOutcome> AddApplicationOutputAwaitable(Model::AddApplicationOutputRequest request) const;
+
+        /**
+         * co_await-able form of AddApplicationReferenceDataSource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisAnalyticsClient, Model::AddApplicationReferenceDataSourceRequest, Model::AddApplicationReferenceDataSourceOutcome> AddApplicationReferenceDataSourceAwaitable(Model::AddApplicationReferenceDataSourceRequest request) const;
+
+        /**
+         * co_await-able form of CreateApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisAnalyticsClient, Model::CreateApplicationRequest, Model::CreateApplicationOutcome> CreateApplicationAwaitable(Model::CreateApplicationRequest request) const;
+
+        /**
+         * co_await-able form of DeleteApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisAnalyticsClient, Model::DeleteApplicationRequest, Model::DeleteApplicationOutcome> DeleteApplicationAwaitable(Model::DeleteApplicationRequest request) const;
+
+        /**
+         * co_await-able form of DeleteApplicationOutput(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisAnalyticsClient, Model::DeleteApplicationOutputRequest, Model::DeleteApplicationOutputOutcome> DeleteApplicationOutputAwaitable(Model::DeleteApplicationOutputRequest request) const;
+
+        /**
+         * co_await-able form of DeleteApplicationReferenceDataSource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisAnalyticsClient, Model::DeleteApplicationReferenceDataSourceRequest, Model::DeleteApplicationReferenceDataSourceOutcome> DeleteApplicationReferenceDataSourceAwaitable(Model::DeleteApplicationReferenceDataSourceRequest request) const;
+
+        /**
+         * co_await-able form of DescribeApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisAnalyticsClient, Model::DescribeApplicationRequest, Model::DescribeApplicationOutcome> DescribeApplicationAwaitable(Model::DescribeApplicationRequest request) const;
+
+        /**
+         * co_await-able form of DiscoverInputSchema(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisAnalyticsClient, Model::DiscoverInputSchemaRequest, Model::DiscoverInputSchemaOutcome> DiscoverInputSchemaAwaitable(Model::DiscoverInputSchemaRequest request) const;
+
+        /**
+         * co_await-able form of ListApplications(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisAnalyticsClient, Model::ListApplicationsRequest, Model::ListApplicationsOutcome> ListApplicationsAwaitable(Model::ListApplicationsRequest request) const;
+
+        /**
+         * co_await-able form of StartApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisAnalyticsClient, Model::StartApplicationRequest, Model::StartApplicationOutcome> StartApplicationAwaitable(Model::StartApplicationRequest request) const;
+
+        /**
+         * co_await-able form of StopApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisAnalyticsClient, Model::StopApplicationRequest, Model::StopApplicationOutcome> StopApplicationAwaitable(Model::StopApplicationRequest request) const;
+
+        /**
+         * co_await-able form of UpdateApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KinesisAnalyticsClient, Model::UpdateApplicationRequest, Model::UpdateApplicationOutcome> UpdateApplicationAwaitable(Model::UpdateApplicationRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
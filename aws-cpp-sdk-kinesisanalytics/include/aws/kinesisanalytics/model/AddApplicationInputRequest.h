@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AddApplicationInputRequest();
+    inline const char* GetServiceRequestName() const override { return "AddApplicationInput"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
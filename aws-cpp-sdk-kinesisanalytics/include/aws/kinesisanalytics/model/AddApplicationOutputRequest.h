@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AddApplicationOutputRequest();
+    inline const char* GetServiceRequestName() const override { return "AddApplicationOutput"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AddApplicationReferenceDataSourceRequest();
+    inline const char* GetServiceRequestName() const override { return "AddApplicationReferenceDataSource"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
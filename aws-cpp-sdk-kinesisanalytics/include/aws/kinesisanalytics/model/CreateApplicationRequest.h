@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateApplicationRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateApplication"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteApplicationOutputRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteApplicationOutput"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
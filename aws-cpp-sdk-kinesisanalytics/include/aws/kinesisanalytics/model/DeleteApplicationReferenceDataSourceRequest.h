@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteApplicationReferenceDataSourceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteApplicationReferenceDataSource"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteApplicationRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteApplication"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
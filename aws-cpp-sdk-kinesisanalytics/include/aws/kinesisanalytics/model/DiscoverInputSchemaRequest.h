@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DiscoverInputSchemaRequest();
+    inline const char* GetServiceRequestName() const override { return "DiscoverInputSchema"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
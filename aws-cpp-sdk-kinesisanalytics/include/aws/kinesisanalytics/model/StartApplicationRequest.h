@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     StartApplicationRequest();
+    inline const char* GetServiceRequestName() const override { return "StartApplication"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
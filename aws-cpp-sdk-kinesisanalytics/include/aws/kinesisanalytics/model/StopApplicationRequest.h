@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     StopApplicationRequest();
+    inline const char* GetServiceRequestName() const override { return "StopApplication"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -122,7 +122,7 @@ AddApplicationInputOutcome KinesisAnalyticsClient::AddApplicationInput(const Add
 
 AddApplicationInputOutcomeCallable KinesisAnalyticsClient::AddApplicationInputCallable(const AddApplicationInputRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddApplicationInput(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddApplicationInput(request); } );
 }
 
 void KinesisAnalyticsClient::AddApplicationInputAsync(const AddApplicationInputRequest& request, const AddApplicationInputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -130,6 +130,16 @@ void KinesisAnalyticsClient::AddApplicationInputAsync(const AddApplicationInputR
   m_executor->Submit( [this, request, handler, context](){ this->AddApplicationInputAsyncHelper( request, handler, context ); } );
 }
 
+AddApplicationInputOutcomeCallable KinesisAnalyticsClient::AddApplicationInputCallable(AddApplicationInputRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisAnalyticsClient::AddApplicationInput, this, std::move(request)));
+}
+
+void KinesisAnalyticsClient::AddApplicationInputAsync(AddApplicationInputRequest&& request, const AddApplicationInputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisAnalyticsClient::AddApplicationInputAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisAnalyticsClient::AddApplicationInputAsyncHelper(const AddApplicationInputRequest& request, const AddApplicationInputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddApplicationInput(request), context);
@@ -153,7 +163,7 @@ AddApplicationOutputOutcome KinesisAnalyticsClient::AddApplicationOutput(const A
 
 AddApplicationOutputOutcomeCallable KinesisAnalyticsClient::AddApplicationOutputCallable(const AddApplicationOutputRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddApplicationOutput(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddApplicationOutput(request); } );
 }
 
 void KinesisAnalyticsClient::AddApplicationOutputAsync(const AddApplicationOutputRequest& request, const AddApplicationOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -161,6 +171,16 @@ void KinesisAnalyticsClient::AddApplicationOutputAsync(const AddApplicationOutpu
   m_executor->Submit( [this, request, handler, context](){ this->AddApplicationOutputAsyncHelper( request, handler, context ); } );
 }
 
+AddApplicationOutputOutcomeCallable KinesisAnalyticsClient::AddApplicationOutputCallable(AddApplicationOutputRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisAnalyticsClient::AddApplicationOutput, this, std::move(request)));
+}
+
+void KinesisAnalyticsClient::AddApplicationOutputAsync(AddApplicationOutputRequest&& request, const AddApplicationOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisAnalyticsClient::AddApplicationOutputAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisAnalyticsClient::AddApplicationOutputAsyncHelper(const AddApplicationOutputRequest& request, const AddApplicationOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddApplicationOutput(request), context);
@@ -184,7 +204,7 @@ AddApplicationReferenceDataSourceOutcome KinesisAnalyticsClient::AddApplicationR
 
 AddApplicationReferenceDataSourceOutcomeCallable KinesisAnalyticsClient::AddApplicationReferenceDataSourceCallable(const AddApplicationReferenceDataSourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddApplicationReferenceDataSource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddApplicationReferenceDataSource(request); } );
 }
 
 void KinesisAnalyticsClient::AddApplicationReferenceDataSourceAsync(const AddApplicationReferenceDataSourceRequest& request, const AddApplicationReferenceDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -192,6 +212,16 @@ void KinesisAnalyticsClient::AddApplicationReferenceDataSourceAsync(const AddApp
   m_executor->Submit( [this, request, handler, context](){ this->AddApplicationReferenceDataSourceAsyncHelper( request, handler, context ); } );
 }
 
+AddApplicationReferenceDataSourceOutcomeCallable KinesisAnalyticsClient::AddApplicationReferenceDataSourceCallable(AddApplicationReferenceDataSourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisAnalyticsClient::AddApplicationReferenceDataSource, this, std::move(request)));
+}
+
+void KinesisAnalyticsClient::AddApplicationReferenceDataSourceAsync(AddApplicationReferenceDataSourceRequest&& request, const AddApplicationReferenceDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisAnalyticsClient::AddApplicationReferenceDataSourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisAnalyticsClient::AddApplicationReferenceDataSourceAsyncHelper(const AddApplicationReferenceDataSourceRequest& request, const AddApplicationReferenceDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddApplicationReferenceDataSource(request), context);
@@ -215,7 +245,7 @@ CreateApplicationOutcome KinesisAnalyticsClient::CreateApplication(const CreateA
 
 CreateApplicationOutcomeCallable KinesisAnalyticsClient::CreateApplicationCallable(const CreateApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateApplication(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateApplication(request); } );
 }
 
 void KinesisAnalyticsClient::CreateApplicationAsync(const CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -223,6 +253,16 @@ void KinesisAnalyticsClient::CreateApplicationAsync(const CreateApplicationReque
   m_executor->Submit( [this, request, handler, context](){ this->CreateApplicationAsyncHelper( request, handler, context ); } );
 }
 
+CreateApplicationOutcomeCallable KinesisAnalyticsClient::CreateApplicationCallable(CreateApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisAnalyticsClient::CreateApplication, this, std::move(request)));
+}
+
+void KinesisAnalyticsClient::CreateApplicationAsync(CreateApplicationRequest&& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisAnalyticsClient::CreateApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisAnalyticsClient::CreateApplicationAsyncHelper(const CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateApplication(request), context);
@@ -246,7 +286,7 @@ DeleteApplicationOutcome KinesisAnalyticsClient::DeleteApplication(const DeleteA
 
 DeleteApplicationOutcomeCallable KinesisAnalyticsClient::DeleteApplicationCallable(const DeleteApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteApplication(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteApplication(request); } );
 }
 
 void KinesisAnalyticsClient::DeleteApplicationAsync(const DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -254,6 +294,16 @@ void KinesisAnalyticsClient::DeleteApplicationAsync(const DeleteApplicationReque
   m_executor->Submit( [this, request, handler, context](){ this->DeleteApplicationAsyncHelper( request, handler, context ); } );
 }
 
+DeleteApplicationOutcomeCallable KinesisAnalyticsClient::DeleteApplicationCallable(DeleteApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisAnalyticsClient::DeleteApplication, this, std::move(request)));
+}
+
+void KinesisAnalyticsClient::DeleteApplicationAsync(DeleteApplicationRequest&& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisAnalyticsClient::DeleteApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisAnalyticsClient::DeleteApplicationAsyncHelper(const DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteApplication(request), context);
@@ -277,7 +327,7 @@ DeleteApplicationOutputOutcome KinesisAnalyticsClient::DeleteApplicationOutput(c
 
 DeleteApplicationOutputOutcomeCallable KinesisAnalyticsClient::DeleteApplicationOutputCallable(const DeleteApplicationOutputRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteApplicationOutput(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteApplicationOutput(request); } );
 }
 
 void KinesisAnalyticsClient::DeleteApplicationOutputAsync(const DeleteApplicationOutputRequest& request, const DeleteApplicationOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -285,6 +335,16 @@ void KinesisAnalyticsClient::DeleteApplicationOutputAsync(const DeleteApplicatio
   m_executor->Submit( [this, request, handler, context](){ this->DeleteApplicationOutputAsyncHelper( request, handler, context ); } );
 }
 
+DeleteApplicationOutputOutcomeCallable KinesisAnalyticsClient::DeleteApplicationOutputCallable(DeleteApplicationOutputRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisAnalyticsClient::DeleteApplicationOutput, this, std::move(request)));
+}
+
+void KinesisAnalyticsClient::DeleteApplicationOutputAsync(DeleteApplicationOutputRequest&& request, const DeleteApplicationOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisAnalyticsClient::DeleteApplicationOutputAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisAnalyticsClient::DeleteApplicationOutputAsyncHelper(const DeleteApplicationOutputRequest& request, const DeleteApplicationOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteApplicationOutput(request), context);
@@ -308,7 +368,7 @@ DeleteApplicationReferenceDataSourceOutcome KinesisAnalyticsClient::DeleteApplic
 
 DeleteApplicationReferenceDataSourceOutcomeCallable KinesisAnalyticsClient::DeleteApplicationReferenceDataSourceCallable(const DeleteApplicationReferenceDataSourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteApplicationReferenceDataSource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteApplicationReferenceDataSource(request); } );
 }
 
 void KinesisAnalyticsClient::DeleteApplicationReferenceDataSourceAsync(const DeleteApplicationReferenceDataSourceRequest& request, const DeleteApplicationReferenceDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -316,6 +376,16 @@ void KinesisAnalyticsClient::DeleteApplicationReferenceDataSourceAsync(const Del
   m_executor->Submit( [this, request, handler, context](){ this->DeleteApplicationReferenceDataSourceAsyncHelper( request, handler, context ); } );
 }
 
+DeleteApplicationReferenceDataSourceOutcomeCallable KinesisAnalyticsClient::DeleteApplicationReferenceDataSourceCallable(DeleteApplicationReferenceDataSourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisAnalyticsClient::DeleteApplicationReferenceDataSource, this, std::move(request)));
+}
+
+void KinesisAnalyticsClient::DeleteApplicationReferenceDataSourceAsync(DeleteApplicationReferenceDataSourceRequest&& request, const DeleteApplicationReferenceDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisAnalyticsClient::DeleteApplicationReferenceDataSourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisAnalyticsClient::DeleteApplicationReferenceDataSourceAsyncHelper(const DeleteApplicationReferenceDataSourceRequest& request, const DeleteApplicationReferenceDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteApplicationReferenceDataSource(request), context);
@@ -339,7 +409,7 @@ DescribeApplicationOutcome KinesisAnalyticsClient::DescribeApplication(const Des
 
 DescribeApplicationOutcomeCallable KinesisAnalyticsClient::DescribeApplicationCallable(const DescribeApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeApplication(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeApplication(request); } );
 }
 
 void KinesisAnalyticsClient::DescribeApplicationAsync(const DescribeApplicationRequest& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -347,6 +417,16 @@ void KinesisAnalyticsClient::DescribeApplicationAsync(const DescribeApplicationR
   m_executor->Submit( [this, request, handler, context](){ this->DescribeApplicationAsyncHelper( request, handler, context ); } );
 }
 
+DescribeApplicationOutcomeCallable KinesisAnalyticsClient::DescribeApplicationCallable(DescribeApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisAnalyticsClient::DescribeApplication, this, std::move(request)));
+}
+
+void KinesisAnalyticsClient::DescribeApplicationAsync(DescribeApplicationRequest&& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisAnalyticsClient::DescribeApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisAnalyticsClient::DescribeApplicationAsyncHelper(const DescribeApplicationRequest& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeApplication(request), context);
@@ -370,7 +450,7 @@ DiscoverInputSchemaOutcome KinesisAnalyticsClient::DiscoverInputSchema(const Dis
 
 DiscoverInputSchemaOutcomeCallable KinesisAnalyticsClient::DiscoverInputSchemaCallable(const DiscoverInputSchemaRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DiscoverInputSchema(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DiscoverInputSchema(request); } );
 }
 
 void KinesisAnalyticsClient::DiscoverInputSchemaAsync(const DiscoverInputSchemaRequest& request, const DiscoverInputSchemaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -378,6 +458,16 @@ void KinesisAnalyticsClient::DiscoverInputSchemaAsync(const DiscoverInputSchemaR
   m_executor->Submit( [this, request, handler, context](){ this->DiscoverInputSchemaAsyncHelper( request, handler, context ); } );
 }
 
+DiscoverInputSchemaOutcomeCallable KinesisAnalyticsClient::DiscoverInputSchemaCallable(DiscoverInputSchemaRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisAnalyticsClient::DiscoverInputSchema, this, std::move(request)));
+}
+
+void KinesisAnalyticsClient::DiscoverInputSchemaAsync(DiscoverInputSchemaRequest&& request, const DiscoverInputSchemaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisAnalyticsClient::DiscoverInputSchemaAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisAnalyticsClient::DiscoverInputSchemaAsyncHelper(const DiscoverInputSchemaRequest& request, const DiscoverInputSchemaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DiscoverInputSchema(request), context);
@@ -401,7 +491,7 @@ ListApplicationsOutcome KinesisAnalyticsClient::ListApplications(const ListAppli
 
 ListApplicationsOutcomeCallable KinesisAnalyticsClient::ListApplicationsCallable(const ListApplicationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListApplications(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListApplications(request); } );
 }
 
 void KinesisAnalyticsClient::ListApplicationsAsync(const ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -409,6 +499,16 @@ void KinesisAnalyticsClient::ListApplicationsAsync(const ListApplicationsRequest
   m_executor->Submit( [this, request, handler, context](){ this->ListApplicationsAsyncHelper( request, handler, context ); } );
 }
 
+ListApplicationsOutcomeCallable KinesisAnalyticsClient::ListApplicationsCallable(ListApplicationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisAnalyticsClient::ListApplications, this, std::move(request)));
+}
+
+void KinesisAnalyticsClient::ListApplicationsAsync(ListApplicationsRequest&& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisAnalyticsClient::ListApplicationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisAnalyticsClient::ListApplicationsAsyncHelper(const ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListApplications(request), context);
@@ -432,7 +532,7 @@ StartApplicationOutcome KinesisAnalyticsClient::StartApplication(const StartAppl
 
 StartApplicationOutcomeCallable KinesisAnalyticsClient::StartApplicationCallable(const StartApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StartApplication(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StartApplication(request); } );
 }
 
 void KinesisAnalyticsClient::StartApplicationAsync(const StartApplicationRequest& request, const StartApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -440,6 +540,16 @@ void KinesisAnalyticsClient::StartApplicationAsync(const StartApplicationRequest
   m_executor->Submit( [this, request, handler, context](){ this->StartApplicationAsyncHelper( request, handler, context ); } );
 }
 
+StartApplicationOutcomeCallable KinesisAnalyticsClient::StartApplicationCallable(StartApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisAnalyticsClient::StartApplication, this, std::move(request)));
+}
+
+void KinesisAnalyticsClient::StartApplicationAsync(StartApplicationRequest&& request, const StartApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisAnalyticsClient::StartApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisAnalyticsClient::StartApplicationAsyncHelper(const StartApplicationRequest& request, const StartApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StartApplication(request), context);
@@ -463,7 +573,7 @@ StopApplicationOutcome KinesisAnalyticsClient::StopApplication(const StopApplica
 
 StopApplicationOutcomeCallable KinesisAnalyticsClient::StopApplicationCallable(const StopApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StopApplication(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StopApplication(request); } );
 }
 
 void KinesisAnalyticsClient::StopApplicationAsync(const StopApplicationRequest& request, const StopApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -471,6 +581,16 @@ void KinesisAnalyticsClient::StopApplicationAsync(const StopApplicationRequest&
   m_executor->Submit( [this, request, handler, context](){ this->StopApplicationAsyncHelper( request, handler, context ); } );
 }
 
+StopApplicationOutcomeCallable KinesisAnalyticsClient::StopApplicationCallable(StopApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisAnalyticsClient::StopApplication, this, std::move(request)));
+}
+
+void KinesisAnalyticsClient::StopApplicationAsync(StopApplicationRequest&& request, const StopApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisAnalyticsClient::StopApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisAnalyticsClient::StopApplicationAsyncHelper(const StopApplicationRequest& request, const StopApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StopApplication(request), context);
@@ -494,7 +614,7 @@ UpdateApplicationOutcome KinesisAnalyticsClient::UpdateApplication(const UpdateA
 
 UpdateApplicationOutcomeCallable KinesisAnalyticsClient::UpdateApplicationCallable(const UpdateApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateApplication(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateApplication(request); } );
 }
 
 void KinesisAnalyticsClient::UpdateApplicationAsync(const UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -502,8 +622,85 @@ void KinesisAnalyticsClient::UpdateApplicationAsync(const UpdateApplicationReque
   m_executor->Submit( [this, request, handler, context](){ this->UpdateApplicationAsyncHelper( request, handler, context ); } );
 }
 
+UpdateApplicationOutcomeCallable KinesisAnalyticsClient::UpdateApplicationCallable(UpdateApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KinesisAnalyticsClient::UpdateApplication, this, std::move(request)));
+}
+
+void KinesisAnalyticsClient::UpdateApplicationAsync(UpdateApplicationRequest&& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KinesisAnalyticsClient::UpdateApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KinesisAnalyticsClient::UpdateApplicationAsyncHelper(const UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateApplication(request), context);
 }
 
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<KinesisAnalyticsClient, AddApplicationInputRequest, AddApplicationInputOutcome> KinesisAnalyticsClient::AddApplicationInputAwaitable(AddApplicationInputRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisAnalyticsClient::AddApplicationInput, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisAnalyticsClient, AddApplicationOutputRequest, AddApplicationOutputOutcome> KinesisAnalyticsClient::AddApplicationOutputAwaitable(AddApplicationOutputRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisAnalyticsClient::AddApplicationOutput, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisAnalyticsClient, AddApplicationReferenceDataSourceRequest, AddApplicationReferenceDataSourceOutcome> KinesisAnalyticsClient::AddApplicationReferenceDataSourceAwaitable(AddApplicationReferenceDataSourceRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisAnalyticsClient::AddApplicationReferenceDataSource, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisAnalyticsClient, CreateApplicationRequest, CreateApplicationOutcome> KinesisAnalyticsClient::CreateApplicationAwaitable(CreateApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisAnalyticsClient::CreateApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisAnalyticsClient, DeleteApplicationRequest, DeleteApplicationOutcome> KinesisAnalyticsClient::DeleteApplicationAwaitable(DeleteApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisAnalyticsClient::DeleteApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisAnalyticsClient, DeleteApplicationOutputRequest, DeleteApplicationOutputOutcome> KinesisAnalyticsClient::DeleteApplicationOutputAwaitable(DeleteApplicationOutputRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisAnalyticsClient::DeleteApplicationOutput, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisAnalyticsClient, DeleteApplicationReferenceDataSourceRequest, DeleteApplicationReferenceDataSourceOutcome> KinesisAnalyticsClient::DeleteApplicationReferenceDataSourceAwaitable(DeleteApplicationReferenceDataSourceRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisAnalyticsClient::DeleteApplicationReferenceDataSource, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisAnalyticsClient, DescribeApplicationRequest, DescribeApplicationOutcome> KinesisAnalyticsClient::DescribeApplicationAwaitable(DescribeApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisAnalyticsClient::DescribeApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisAnalyticsClient, DiscoverInputSchemaRequest, DiscoverInputSchemaOutcome> KinesisAnalyticsClient::DiscoverInputSchemaAwaitable(DiscoverInputSchemaRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisAnalyticsClient::DiscoverInputSchema, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisAnalyticsClient, ListApplicationsRequest, ListApplicationsOutcome> KinesisAnalyticsClient::ListApplicationsAwaitable(ListApplicationsRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisAnalyticsClient::ListApplications, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisAnalyticsClient, StartApplicationRequest, StartApplicationOutcome> KinesisAnalyticsClient::StartApplicationAwaitable(StartApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisAnalyticsClient::StartApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisAnalyticsClient, StopApplicationRequest, StopApplicationOutcome> KinesisAnalyticsClient::StopApplicationAwaitable(StopApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisAnalyticsClient::StopApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<KinesisAnalyticsClient, UpdateApplicationRequest, UpdateApplicationOutcome> KinesisAnalyticsClient::UpdateApplicationAwaitable(UpdateApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &KinesisAnalyticsClient::UpdateApplication, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,41 +29,41 @@ namespace Aws
       namespace ApplicationStatusMapper
       {
 
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int DELETING_HASH = 1602343848;
+        static const int STARTING_HASH = 2099433536;
+        static const int STOPPING_HASH = -1796691852;
+        static const int READY_HASH = 77848963;
+        static const int RUNNING_HASH = -2026200673;
+        static const int UPDATING_HASH = 2105227078;
 
 
         ApplicationStatus GetApplicationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DELETING_HASH)
+          switch (hashCode)
           {
+          case DELETING_HASH:
             return ApplicationStatus::DELETING;
-          }
-          else if (hashCode == STARTING_HASH)
-          {
+          case STARTING_HASH:
             return ApplicationStatus::STARTING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
+          case STOPPING_HASH:
             return ApplicationStatus::STOPPING;
-          }
-          else if (hashCode == READY_HASH)
-          {
+          case READY_HASH:
             return ApplicationStatus::READY;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
+          case RUNNING_HASH:
             return ApplicationStatus::RUNNING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
+          case UPDATING_HASH:
             return ApplicationStatus::UPDATING;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace InputStartingPositionMapper
       {
 
-        static const int NOW_HASH = HashingUtils::HashString("NOW");
-        static const int TRIM_HORIZON_HASH = HashingUtils::HashString("TRIM_HORIZON");
-        static const int LAST_STOPPED_POINT_HASH = HashingUtils::HashString("LAST_STOPPED_POINT");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int NOW_HASH = 77494;
+        static const int TRIM_HORIZON_HASH = 1909941854;
+        static const int LAST_STOPPED_POINT_HASH = 1933067893;
 
 
         InputStartingPosition GetInputStartingPositionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOW_HASH)
+          switch (hashCode)
           {
+          case NOW_HASH:
             return InputStartingPosition::NOW;
-          }
-          else if (hashCode == TRIM_HORIZON_HASH)
-          {
+          case TRIM_HORIZON_HASH:
             return InputStartingPosition::TRIM_HORIZON;
-          }
-          else if (hashCode == LAST_STOPPED_POINT_HASH)
-          {
+          case LAST_STOPPED_POINT_HASH:
             return InputStartingPosition::LAST_STOPPED_POINT;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace RecordFormatTypeMapper
       {
 
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
-        static const int CSV_HASH = HashingUtils::HashString("CSV");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int JSON_HASH = 2286824;
+        static const int CSV_HASH = 67046;
 
 
         RecordFormatType GetRecordFormatTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JSON_HASH)
+          switch (hashCode)
           {
+          case JSON_HASH:
             return RecordFormatType::JSON;
-          }
-          else if (hashCode == CSV_HASH)
-          {
+          case CSV_HASH:
             return RecordFormatType::CSV;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
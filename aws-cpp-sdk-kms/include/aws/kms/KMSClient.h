@@ -42,6 +42,9 @@
 #include <aws/kms/model/ScheduleKeyDeletionResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -337,6 +340,18 @@ namespace Model
          */
         virtual void CancelKeyDeletionAsync(const Model::CancelKeyDeletionRequest& request, const CancelKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelKeyDeletionCallable(const Model::CancelKeyDeletionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelKeyDeletionOutcomeCallable CancelKeyDeletionCallable(Model::CancelKeyDeletionRequest&& request) const;
+
+        /**
+         * Same as CancelKeyDeletionAsync(const Model::CancelKeyDeletionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelKeyDeletionAsync(Model::CancelKeyDeletionRequest&& request, const CancelKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a display name for a customer master key. An alias can be used to
          * identify a key and should be unique. The console enforces a one-to-one mapping
@@ -380,6 +395,18 @@ namespace Model
          */
         virtual void CreateAliasAsync(const Model::CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAliasCallable(const Model::CreateAliasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateAliasOutcomeCallable CreateAliasCallable(Model::CreateAliasRequest&& request) const;
+
+        /**
+         * Same as CreateAliasAsync(const Model::CreateAliasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateAliasAsync(Model::CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds a grant to a key to specify who can use the key and under what
          * conditions. Grants are alternate permission mechanisms to key policies.</p>
@@ -411,6 +438,18 @@ namespace Model
          */
         virtual void CreateGrantAsync(const Model::CreateGrantRequest& request, const CreateGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateGrantCallable(const Model::CreateGrantRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateGrantOutcomeCallable CreateGrantCallable(Model::CreateGrantRequest&& request) const;
+
+        /**
+         * Same as CreateGrantAsync(const Model::CreateGrantRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateGrantAsync(Model::CreateGrantRequest&& request, const CreateGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a customer master key (CMK).</p> <p>You can use a CMK to encrypt
          * small amounts of data (4 KiB or less) directly, but CMKs are more commonly used
@@ -454,6 +493,18 @@ namespace Model
          */
         virtual void CreateKeyAsync(const Model::CreateKeyRequest& request, const CreateKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateKeyCallable(const Model::CreateKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateKeyOutcomeCallable CreateKeyCallable(Model::CreateKeyRequest&& request) const;
+
+        /**
+         * Same as CreateKeyAsync(const Model::CreateKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateKeyAsync(Model::CreateKeyRequest&& request, const CreateKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Decrypts ciphertext. Ciphertext is plaintext that has been previously
          * encrypted by using any of the following functions:</p> <ul> <li> <p>
@@ -506,6 +557,18 @@ namespace Model
          */
         virtual void DecryptAsync(const Model::DecryptRequest& request, const DecryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DecryptCallable(const Model::DecryptRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DecryptOutcomeCallable DecryptCallable(Model::DecryptRequest&& request) const;
+
+        /**
+         * Same as DecryptAsync(const Model::DecryptRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DecryptAsync(Model::DecryptRequest&& request, const DecryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified alias. To map an alias to a different key, call
          * <a>UpdateAlias</a>.</p>
@@ -528,6 +591,18 @@ namespace Model
          */
         virtual void DeleteAliasAsync(const Model::DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAliasCallable(const Model::DeleteAliasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteAliasOutcomeCallable DeleteAliasCallable(Model::DeleteAliasRequest&& request) const;
+
+        /**
+         * Same as DeleteAliasAsync(const Model::DeleteAliasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteAliasAsync(Model::DeleteAliasRequest&& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes key material that you previously imported and makes the specified
          * customer master key (CMK) unusable. For more information about importing key
@@ -571,6 +646,18 @@ namespace Model
          */
         virtual void DeleteImportedKeyMaterialAsync(const Model::DeleteImportedKeyMaterialRequest& request, const DeleteImportedKeyMaterialResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteImportedKeyMaterialCallable(const Model::DeleteImportedKeyMaterialRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteImportedKeyMaterialOutcomeCallable DeleteImportedKeyMaterialCallable(Model::DeleteImportedKeyMaterialRequest&& request) const;
+
+        /**
+         * Same as DeleteImportedKeyMaterialAsync(const Model::DeleteImportedKeyMaterialRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteImportedKeyMaterialAsync(Model::DeleteImportedKeyMaterialRequest&& request, const DeleteImportedKeyMaterialResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides detailed information about the specified customer master key.</p>
          */
@@ -590,6 +677,18 @@ namespace Model
          */
         virtual void DescribeKeyAsync(const Model::DescribeKeyRequest& request, const DescribeKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeKeyCallable(const Model::DescribeKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeKeyOutcomeCallable DescribeKeyCallable(Model::DescribeKeyRequest&& request) const;
+
+        /**
+         * Same as DescribeKeyAsync(const Model::DescribeKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeKeyAsync(Model::DescribeKeyRequest&& request, const DescribeKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the state of a customer master key (CMK) to disabled, thereby preventing
          * its use for cryptographic operations. For more information about how key state
@@ -624,6 +723,18 @@ namespace Model
          */
         virtual void DisableKeyAsync(const Model::DisableKeyRequest& request, const DisableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableKeyCallable(const Model::DisableKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableKeyOutcomeCallable DisableKeyCallable(Model::DisableKeyRequest&& request) const;
+
+        /**
+         * Same as DisableKeyAsync(const Model::DisableKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableKeyAsync(Model::DisableKeyRequest&& request, const DisableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables rotation of the specified key.</p>
          */
@@ -643,6 +754,18 @@ namespace Model
          */
         virtual void DisableKeyRotationAsync(const Model::DisableKeyRotationRequest& request, const DisableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableKeyRotationCallable(const Model::DisableKeyRotationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableKeyRotationOutcomeCallable DisableKeyRotationCallable(Model::DisableKeyRotationRequest&& request) const;
+
+        /**
+         * Same as DisableKeyRotationAsync(const Model::DisableKeyRotationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableKeyRotationAsync(Model::DisableKeyRotationRequest&& request, const DisableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Marks a key as enabled, thereby permitting its use.</p>
          */
@@ -662,6 +785,18 @@ namespace Model
          */
         virtual void EnableKeyAsync(const Model::EnableKeyRequest& request, const EnableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableKeyCallable(const Model::EnableKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableKeyOutcomeCallable EnableKeyCallable(Model::EnableKeyRequest&& request) const;
+
+        /**
+         * Same as EnableKeyAsync(const Model::EnableKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableKeyAsync(Model::EnableKeyRequest&& request, const EnableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables rotation of the specified customer master key.</p>
          */
@@ -681,6 +816,18 @@ namespace Model
          */
         virtual void EnableKeyRotationAsync(const Model::EnableKeyRotationRequest& request, const EnableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableKeyRotationCallable(const Model::EnableKeyRotationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableKeyRotationOutcomeCallable EnableKeyRotationCallable(Model::EnableKeyRotationRequest&& request) const;
+
+        /**
+         * Same as EnableKeyRotationAsync(const Model::EnableKeyRotationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableKeyRotationAsync(Model::EnableKeyRotationRequest&& request, const EnableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Encrypts plaintext into ciphertext by using a customer master key. The
          * <code>Encrypt</code> function has two primary use cases:</p> <ul> <li> <p>You
@@ -748,6 +895,18 @@ namespace Model
          */
         virtual void EncryptAsync(const Model::EncryptRequest& request, const EncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EncryptCallable(const Model::EncryptRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EncryptOutcomeCallable EncryptCallable(Model::EncryptRequest&& request) const;
+
+        /**
+         * Same as EncryptAsync(const Model::EncryptRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EncryptAsync(Model::EncryptRequest&& request, const EncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates a data key that you can use in your application to locally encrypt
          * data. This call returns a plaintext version of the key in the
@@ -851,6 +1010,18 @@ namespace Model
          */
         virtual void GenerateDataKeyAsync(const Model::GenerateDataKeyRequest& request, const GenerateDataKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GenerateDataKeyCallable(const Model::GenerateDataKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GenerateDataKeyOutcomeCallable GenerateDataKeyCallable(Model::GenerateDataKeyRequest&& request) const;
+
+        /**
+         * Same as GenerateDataKeyAsync(const Model::GenerateDataKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GenerateDataKeyAsync(Model::GenerateDataKeyRequest&& request, const GenerateDataKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a data key encrypted by a customer master key without the plaintext
          * copy of that key. Otherwise, this API functions exactly like
@@ -882,6 +1053,18 @@ namespace Model
          */
         virtual void GenerateDataKeyWithoutPlaintextAsync(const Model::GenerateDataKeyWithoutPlaintextRequest& request, const GenerateDataKeyWithoutPlaintextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GenerateDataKeyWithoutPlaintextCallable(const Model::GenerateDataKeyWithoutPlaintextRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GenerateDataKeyWithoutPlaintextOutcomeCallable GenerateDataKeyWithoutPlaintextCallable(Model::GenerateDataKeyWithoutPlaintextRequest&& request) const;
+
+        /**
+         * Same as GenerateDataKeyWithoutPlaintextAsync(const Model::GenerateDataKeyWithoutPlaintextRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GenerateDataKeyWithoutPlaintextAsync(Model::GenerateDataKeyWithoutPlaintextRequest&& request, const GenerateDataKeyWithoutPlaintextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates an unpredictable byte string.</p>
          */
@@ -901,6 +1084,18 @@ namespace Model
          */
         virtual void GenerateRandomAsync(const Model::GenerateRandomRequest& request, const GenerateRandomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GenerateRandomCallable(const Model::GenerateRandomRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GenerateRandomOutcomeCallable GenerateRandomCallable(Model::GenerateRandomRequest&& request) const;
+
+        /**
+         * Same as GenerateRandomAsync(const Model::GenerateRandomRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GenerateRandomAsync(Model::GenerateRandomRequest&& request, const GenerateRandomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a policy attached to the specified key.</p>
          */
@@ -920,6 +1115,18 @@ namespace Model
          */
         virtual void GetKeyPolicyAsync(const Model::GetKeyPolicyRequest& request, const GetKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetKeyPolicyCallable(const Model::GetKeyPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetKeyPolicyOutcomeCallable GetKeyPolicyCallable(Model::GetKeyPolicyRequest&& request) const;
+
+        /**
+         * Same as GetKeyPolicyAsync(const Model::GetKeyPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetKeyPolicyAsync(Model::GetKeyPolicyRequest&& request, const GetKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a Boolean value that indicates whether key rotation is enabled for
          * the specified key.</p>
@@ -942,6 +1149,18 @@ namespace Model
          */
         virtual void GetKeyRotationStatusAsync(const Model::GetKeyRotationStatusRequest& request, const GetKeyRotationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetKeyRotationStatusCallable(const Model::GetKeyRotationStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetKeyRotationStatusOutcomeCallable GetKeyRotationStatusCallable(Model::GetKeyRotationStatusRequest&& request) const;
+
+        /**
+         * Same as GetKeyRotationStatusAsync(const Model::GetKeyRotationStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetKeyRotationStatusAsync(Model::GetKeyRotationStatusRequest&& request, const GetKeyRotationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the items you need in order to import key material into AWS KMS from
          * your existing key management infrastructure. For more information about
@@ -1003,6 +1222,18 @@ namespace Model
          */
         virtual void GetParametersForImportAsync(const Model::GetParametersForImportRequest& request, const GetParametersForImportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetParametersForImportCallable(const Model::GetParametersForImportRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetParametersForImportOutcomeCallable GetParametersForImportCallable(Model::GetParametersForImportRequest&& request) const;
+
+        /**
+         * Same as GetParametersForImportAsync(const Model::GetParametersForImportRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetParametersForImportAsync(Model::GetParametersForImportRequest&& request, const GetParametersForImportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Imports key material into an AWS KMS customer master key (CMK) from your
          * existing key management infrastructure. For more information about importing key
@@ -1073,6 +1304,18 @@ namespace Model
          */
         virtual void ImportKeyMaterialAsync(const Model::ImportKeyMaterialRequest& request, const ImportKeyMaterialResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ImportKeyMaterialCallable(const Model::ImportKeyMaterialRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ImportKeyMaterialOutcomeCallable ImportKeyMaterialCallable(Model::ImportKeyMaterialRequest&& request) const;
+
+        /**
+         * Same as ImportKeyMaterialAsync(const Model::ImportKeyMaterialRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ImportKeyMaterialAsync(Model::ImportKeyMaterialRequest&& request, const ImportKeyMaterialResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all of the key aliases in the account.</p>
          */
@@ -1092,6 +1335,18 @@ namespace Model
          */
         virtual void ListAliasesAsync(const Model::ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAliasesCallable(const Model::ListAliasesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAliasesOutcomeCallable ListAliasesCallable(Model::ListAliasesRequest&& request) const;
+
+        /**
+         * Same as ListAliasesAsync(const Model::ListAliasesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAliasesAsync(Model::ListAliasesRequest&& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>List the grants for a specified key.</p>
          */
@@ -1111,6 +1366,18 @@ namespace Model
          */
         virtual void ListGrantsAsync(const Model::ListGrantsRequest& request, const ListGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListGrantsCallable(const Model::ListGrantsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListGrantsOutcomeCallable ListGrantsCallable(Model::ListGrantsRequest&& request) const;
+
+        /**
+         * Same as ListGrantsAsync(const Model::ListGrantsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListGrantsAsync(Model::ListGrantsRequest&& request, const ListGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a list of policies attached to a key.</p>
          */
@@ -1130,6 +1397,18 @@ namespace Model
          */
         virtual void ListKeyPoliciesAsync(const Model::ListKeyPoliciesRequest& request, const ListKeyPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListKeyPoliciesCallable(const Model::ListKeyPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListKeyPoliciesOutcomeCallable ListKeyPoliciesCallable(Model::ListKeyPoliciesRequest&& request) const;
+
+        /**
+         * Same as ListKeyPoliciesAsync(const Model::ListKeyPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListKeyPoliciesAsync(Model::ListKeyPoliciesRequest&& request, const ListKeyPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the customer master keys.</p>
          */
@@ -1149,6 +1428,18 @@ namespace Model
          */
         virtual void ListKeysAsync(const Model::ListKeysRequest& request, const ListKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListKeysCallable(const Model::ListKeysRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListKeysOutcomeCallable ListKeysCallable(Model::ListKeysRequest&& request) const;
+
+        /**
+         * Same as ListKeysAsync(const Model::ListKeysRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListKeysAsync(Model::ListKeysRequest&& request, const ListKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of all grants for which the grant's
          * <code>RetiringPrincipal</code> matches the one specified.</p> <p>A typical use
@@ -1177,6 +1468,18 @@ namespace Model
          */
         virtual void ListRetirableGrantsAsync(const Model::ListRetirableGrantsRequest& request, const ListRetirableGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRetirableGrantsCallable(const Model::ListRetirableGrantsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListRetirableGrantsOutcomeCallable ListRetirableGrantsCallable(Model::ListRetirableGrantsRequest&& request) const;
+
+        /**
+         * Same as ListRetirableGrantsAsync(const Model::ListRetirableGrantsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListRetirableGrantsAsync(Model::ListRetirableGrantsRequest&& request, const ListRetirableGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches a key policy to the specified customer master key (CMK).</p> <p>For
          * more information about key policies, see <a
@@ -1205,6 +1508,18 @@ namespace Model
          */
         virtual void PutKeyPolicyAsync(const Model::PutKeyPolicyRequest& request, const PutKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutKeyPolicyCallable(const Model::PutKeyPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutKeyPolicyOutcomeCallable PutKeyPolicyCallable(Model::PutKeyPolicyRequest&& request) const;
+
+        /**
+         * Same as PutKeyPolicyAsync(const Model::PutKeyPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutKeyPolicyAsync(Model::PutKeyPolicyRequest&& request, const PutKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Encrypts data on the server side with a new customer master key without
          * exposing the plaintext of the data on the client side. The data is first
@@ -1254,6 +1569,18 @@ namespace Model
          */
         virtual void ReEncryptAsync(const Model::ReEncryptRequest& request, const ReEncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReEncryptCallable(const Model::ReEncryptRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReEncryptOutcomeCallable ReEncryptCallable(Model::ReEncryptRequest&& request) const;
+
+        /**
+         * Same as ReEncryptAsync(const Model::ReEncryptRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReEncryptAsync(Model::ReEncryptRequest&& request, const ReEncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retires a grant. You can retire a grant when you're done using it to clean
          * up. You should revoke a grant when you intend to actively deny operations that
@@ -1303,6 +1630,18 @@ namespace Model
          */
         virtual void RetireGrantAsync(const Model::RetireGrantRequest& request, const RetireGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RetireGrantCallable(const Model::RetireGrantRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RetireGrantOutcomeCallable RetireGrantCallable(Model::RetireGrantRequest&& request) const;
+
+        /**
+         * Same as RetireGrantAsync(const Model::RetireGrantRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RetireGrantAsync(Model::RetireGrantRequest&& request, const RetireGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Revokes a grant. You can revoke a grant to actively deny operations that
          * depend on it.</p>
@@ -1325,6 +1664,18 @@ namespace Model
          */
         virtual void RevokeGrantAsync(const Model::RevokeGrantRequest& request, const RevokeGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RevokeGrantCallable(const Model::RevokeGrantRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RevokeGrantOutcomeCallable RevokeGrantCallable(Model::RevokeGrantRequest&& request) const;
+
+        /**
+         * Same as RevokeGrantAsync(const Model::RevokeGrantRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RevokeGrantAsync(Model::RevokeGrantRequest&& request, const RevokeGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Schedules the deletion of a customer master key (CMK). You may provide a
          * waiting period, specified in days, before deletion occurs. If you do not provide
@@ -1386,6 +1737,18 @@ namespace Model
          */
         virtual void ScheduleKeyDeletionAsync(const Model::ScheduleKeyDeletionRequest& request, const ScheduleKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ScheduleKeyDeletionCallable(const Model::ScheduleKeyDeletionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ScheduleKeyDeletionOutcomeCallable ScheduleKeyDeletionCallable(Model::ScheduleKeyDeletionRequest&& request) const;
+
+        /**
+         * Same as ScheduleKeyDeletionAsync(const Model::ScheduleKeyDeletionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ScheduleKeyDeletionAsync(Model::ScheduleKeyDeletionRequest&& request, const ScheduleKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates an alias to map it to a different key.</p> <p>An alias is not a
          * property of a key. Therefore, an alias can be mapped to and unmapped from an
@@ -1426,6 +1789,18 @@ namespace Model
          */
         virtual void UpdateAliasAsync(const Model::UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAliasCallable(const Model::UpdateAliasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateAliasOutcomeCallable UpdateAliasCallable(Model::UpdateAliasRequest&& request) const;
+
+        /**
+         * Same as UpdateAliasAsync(const Model::UpdateAliasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateAliasAsync(Model::UpdateAliasRequest&& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the description of a key.</p>
          */
@@ -1445,6 +1820,205 @@ namespace Model
          */
         virtual void UpdateKeyDescriptionAsync(const Model::UpdateKeyDescriptionRequest& request, const UpdateKeyDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateKeyDescriptionCallable(const Model::UpdateKeyDescriptionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateKeyDescriptionOutcomeCallable UpdateKeyDescriptionCallable(Model::UpdateKeyDescriptionRequest&& request) const;
+
+        /**
+         * Same as UpdateKeyDescriptionAsync(const Model::UpdateKeyDescriptionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateKeyDescriptionAsync(Model::UpdateKeyDescriptionRequest&& request, const UpdateKeyDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListAliases(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<KMSClient, Model::ListAliasesRequest, Model::ListAliasesOutcome> ListAliasesPaginator(const Model::ListAliasesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListGrants(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<KMSClient, Model::ListGrantsRequest, Model::ListGrantsOutcome> ListGrantsPaginator(const Model::ListGrantsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListKeyPolicies(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<KMSClient, Model::ListKeyPoliciesRequest, Model::ListKeyPoliciesOutcome> ListKeyPoliciesPaginator(const Model::ListKeyPoliciesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListKeys(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<KMSClient, Model::ListKeysRequest, Model::ListKeysOutcome> ListKeysPaginator(const Model::ListKeysRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListRetirableGrants(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<KMSClient, Model::ListRetirableGrantsRequest, Model::ListRetirableGrantsOutcome> ListRetirableGrantsPaginator(const Model::ListRetirableGrantsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CancelKeyDeletion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::CancelKeyDeletionRequest, Model::CancelKeyDeletionOutcome> CancelKeyDeletionAwaitable(Model::CancelKeyDeletionRequest request) const;
+
+        /**
+         * co_await-able form of CreateAlias(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::CreateAliasRequest, Model::CreateAliasOutcome> CreateAliasAwaitable(Model::CreateAliasRequest request) const;
+
+        /**
+         * co_await-able form of CreateGrant(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::CreateGrantRequest, Model::CreateGrantOutcome> CreateGrantAwaitable(Model::CreateGrantRequest request) const;
+
+        /**
+         * co_await-able form of CreateKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::CreateKeyRequest, Model::CreateKeyOutcome> CreateKeyAwaitable(Model::CreateKeyRequest request) const;
+
+        /**
+         * co_await-able form of Decrypt(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::DecryptRequest, Model::DecryptOutcome> DecryptAwaitable(Model::DecryptRequest request) const;
+
+        /**
+         * co_await-able form of DeleteAlias(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::DeleteAliasRequest, Model::DeleteAliasOutcome> DeleteAliasAwaitable(Model::DeleteAliasRequest request) const;
+
+        /**
+         * co_await-able form of DeleteImportedKeyMaterial(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::DeleteImportedKeyMaterialRequest, Model::DeleteImportedKeyMaterialOutcome> DeleteImportedKeyMaterialAwaitable(Model::DeleteImportedKeyMaterialRequest request) const;
+
+        /**
+         * co_await-able form of DescribeKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::DescribeKeyRequest, Model::DescribeKeyOutcome> DescribeKeyAwaitable(Model::DescribeKeyRequest request) const;
+
+        /**
+         * co_await-able form of DisableKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::DisableKeyRequest, Model::DisableKeyOutcome> DisableKeyAwaitable(Model::DisableKeyRequest request) const;
+
+        /**
+         * co_await-able form of DisableKeyRotation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::DisableKeyRotationRequest, Model::DisableKeyRotationOutcome> DisableKeyRotationAwaitable(Model::DisableKeyRotationRequest request) const;
+
+        /**
+         * co_await-able form of EnableKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::EnableKeyRequest, Model::EnableKeyOutcome> EnableKeyAwaitable(Model::EnableKeyRequest request) const;
+
+        /**
+         * co_await-able form of EnableKeyRotation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::EnableKeyRotationRequest, Model::EnableKeyRotationOutcome> EnableKeyRotationAwaitable(Model::EnableKeyRotationRequest request) const;
+
+        /**
+         * co_await-able form of Encrypt(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::EncryptRequest, Model::EncryptOutcome> EncryptAwaitable(Model::EncryptRequest request) const;
+
+        /**
+         * co_await-able form of GenerateDataKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::GenerateDataKeyRequest, Model::GenerateDataKeyOutcome> GenerateDataKeyAwaitable(Model::GenerateDataKeyRequest request) const;
+
+        /**
+         * co_await-able form of GenerateDataKeyWithoutPlaintext(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::GenerateDataKeyWithoutPlaintextRequest, Model::GenerateDataKeyWithoutPlaintextOutcome> GenerateDataKeyWithoutPlaintextAwaitable(Model::GenerateDataKeyWithoutPlaintextRequest request) const;
+
+        /**
+         * co_await-able form of GenerateRandom(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::GenerateRandomRequest, Model::GenerateRandomOutcome> GenerateRandomAwaitable(Model::GenerateRandomRequest request) const;
+
+        /**
+         * co_await-able form of GetKeyPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::GetKeyPolicyRequest, Model::GetKeyPolicyOutcome> GetKeyPolicyAwaitable(Model::GetKeyPolicyRequest request) const;
+
+        /**
+         * co_await-able form of GetKeyRotationStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::GetKeyRotationStatusRequest, Model::GetKeyRotationStatusOutcome> GetKeyRotationStatusAwaitable(Model::GetKeyRotationStatusRequest request) const;
+
+        /**
+         * co_await-able form of GetParametersForImport(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::GetParametersForImportRequest, Model::GetParametersForImportOutcome> GetParametersForImportAwaitable(Model::GetParametersForImportRequest request) const;
+
+        /**
+         * co_await-able form of ImportKeyMaterial(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::ImportKeyMaterialRequest, Model::ImportKeyMaterialOutcome> ImportKeyMaterialAwaitable(Model::ImportKeyMaterialRequest request) const;
+
+        /**
+         * co_await-able form of ListAliases(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::ListAliasesRequest, Model::ListAliasesOutcome> ListAliasesAwaitable(Model::ListAliasesRequest request) const;
+
+        /**
+         * co_await-able form of ListGrants(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::ListGrantsRequest, Model::ListGrantsOutcome> ListGrantsAwaitable(Model::ListGrantsRequest request) const;
+
+        /**
+         * co_await-able form of ListKeyPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::ListKeyPoliciesRequest, Model::ListKeyPoliciesOutcome> ListKeyPoliciesAwaitable(Model::ListKeyPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of ListKeys(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::ListKeysRequest, Model::ListKeysOutcome> ListKeysAwaitable(Model::ListKeysRequest request) const;
+
+        /**
+         * co_await-able form of ListRetirableGrants(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::ListRetirableGrantsRequest, Model::ListRetirableGrantsOutcome> ListRetirableGrantsAwaitable(Model::ListRetirableGrantsRequest request) const;
+
+        /**
+         * co_await-able form of PutKeyPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::PutKeyPolicyRequest, Model::PutKeyPolicyOutcome> PutKeyPolicyAwaitable(Model::PutKeyPolicyRequest request) const;
+
+        /**
+         * co_await-able form of ReEncrypt(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::ReEncryptRequest, Model::ReEncryptOutcome> ReEncryptAwaitable(Model::ReEncryptRequest request) const;
+
+        /**
+         * co_await-able form of RetireGrant(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::RetireGrantRequest, Model::RetireGrantOutcome> RetireGrantAwaitable(Model::RetireGrantRequest request) const;
+
+        /**
+         * co_await-able form of RevokeGrant(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::RevokeGrantRequest, Model::RevokeGrantOutcome> RevokeGrantAwaitable(Model::RevokeGrantRequest request) const;
+
+        /**
+         * co_await-able form of ScheduleKeyDeletion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::ScheduleKeyDeletionRequest, Model::ScheduleKeyDeletionOutcome> ScheduleKeyDeletionAwaitable(Model::ScheduleKeyDeletionRequest request) const;
+
+        /**
+         * co_await-able form of UpdateAlias(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::UpdateAliasRequest, Model::UpdateAliasOutcome> UpdateAliasAwaitable(Model::UpdateAliasRequest request) const;
+
+        /**
+         * co_await-able form of UpdateKeyDescription(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<KMSClient, Model::UpdateKeyDescriptionRequest, Model::UpdateKeyDescriptionOutcome> UpdateKeyDescriptionAwaitable(Model::UpdateKeyDescriptionRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CancelKeyDeletionRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelKeyDeletion"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateAliasRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateAlias"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
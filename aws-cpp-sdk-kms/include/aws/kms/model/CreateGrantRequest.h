@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateGrantRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateGrant"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
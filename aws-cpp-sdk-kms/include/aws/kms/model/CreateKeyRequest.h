@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateKey"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DecryptRequest();
+    inline const char* GetServiceRequestName() const override { return "Decrypt"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
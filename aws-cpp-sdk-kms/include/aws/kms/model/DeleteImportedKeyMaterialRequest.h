@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteImportedKeyMaterialRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteImportedKeyMaterial"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
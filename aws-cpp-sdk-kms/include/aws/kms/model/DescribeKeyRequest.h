@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeKey"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
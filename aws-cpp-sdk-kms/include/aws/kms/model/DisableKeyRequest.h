@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DisableKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableKey"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
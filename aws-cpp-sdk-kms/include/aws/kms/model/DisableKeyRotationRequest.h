@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DisableKeyRotationRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableKeyRotation"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     EnableKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableKey"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
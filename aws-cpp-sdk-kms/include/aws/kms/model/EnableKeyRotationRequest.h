@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     EnableKeyRotationRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableKeyRotation"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     EncryptRequest();
+    inline const char* GetServiceRequestName() const override { return "Encrypt"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     GenerateDataKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "GenerateDataKey"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
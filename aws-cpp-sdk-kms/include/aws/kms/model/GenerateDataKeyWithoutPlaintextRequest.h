@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     GenerateDataKeyWithoutPlaintextRequest();
+    inline const char* GetServiceRequestName() const override { return "GenerateDataKeyWithoutPlaintext"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
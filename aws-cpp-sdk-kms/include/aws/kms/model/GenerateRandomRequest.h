@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     GenerateRandomRequest();
+    inline const char* GetServiceRequestName() const override { return "GenerateRandom"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
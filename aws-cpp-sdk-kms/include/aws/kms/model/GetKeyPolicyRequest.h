@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetKeyPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetKeyPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
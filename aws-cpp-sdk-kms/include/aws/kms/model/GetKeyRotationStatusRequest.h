@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetKeyRotationStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "GetKeyRotationStatus"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
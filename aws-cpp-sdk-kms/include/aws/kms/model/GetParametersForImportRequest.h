@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetParametersForImportRequest();
+    inline const char* GetServiceRequestName() const override { return "GetParametersForImport"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ImportKeyMaterialRequest();
+    inline const char* GetServiceRequestName() const override { return "ImportKeyMaterial"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
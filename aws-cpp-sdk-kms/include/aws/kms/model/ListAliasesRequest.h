@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListAliasesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListAliases"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
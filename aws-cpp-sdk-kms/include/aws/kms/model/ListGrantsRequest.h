@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListGrantsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListGrants"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
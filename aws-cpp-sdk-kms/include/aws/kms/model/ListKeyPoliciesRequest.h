@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListKeyPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListKeyPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListKeysRequest();
+    inline const char* GetServiceRequestName() const override { return "ListKeys"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListRetirableGrantsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListRetirableGrants"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     PutKeyPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "PutKeyPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
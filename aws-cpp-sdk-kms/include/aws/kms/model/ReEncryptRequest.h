@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ReEncryptRequest();
+    inline const char* GetServiceRequestName() const override { return "ReEncrypt"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
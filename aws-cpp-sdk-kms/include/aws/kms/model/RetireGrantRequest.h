@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RetireGrantRequest();
+    inline const char* GetServiceRequestName() const override { return "RetireGrant"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
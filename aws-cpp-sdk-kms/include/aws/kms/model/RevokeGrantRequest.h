@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RevokeGrantRequest();
+    inline const char* GetServiceRequestName() const override { return "RevokeGrant"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ScheduleKeyDeletionRequest();
+    inline const char* GetServiceRequestName() const override { return "ScheduleKeyDeletion"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateKeyDescriptionRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateKeyDescription"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -141,7 +141,7 @@ CancelKeyDeletionOutcome KMSClient::CancelKeyDeletion(const CancelKeyDeletionReq
 
 CancelKeyDeletionOutcomeCallable KMSClient::CancelKeyDeletionCallable(const CancelKeyDeletionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelKeyDeletion(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelKeyDeletion(request); } );
 }
 
 void KMSClient::CancelKeyDeletionAsync(const CancelKeyDeletionRequest& request, const CancelKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -149,6 +149,16 @@ void KMSClient::CancelKeyDeletionAsync(const CancelKeyDeletionRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->CancelKeyDeletionAsyncHelper( request, handler, context ); } );
 }
 
+CancelKeyDeletionOutcomeCallable KMSClient::CancelKeyDeletionCallable(CancelKeyDeletionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::CancelKeyDeletion, this, std::move(request)));
+}
+
+void KMSClient::CancelKeyDeletionAsync(CancelKeyDeletionRequest&& request, const CancelKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::CancelKeyDeletionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::CancelKeyDeletionAsyncHelper(const CancelKeyDeletionRequest& request, const CancelKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelKeyDeletion(request), context);
@@ -172,7 +182,7 @@ CreateAliasOutcome KMSClient::CreateAlias(const CreateAliasRequest& request) con
 
 CreateAliasOutcomeCallable KMSClient::CreateAliasCallable(const CreateAliasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateAlias(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateAlias(request); } );
 }
 
 void KMSClient::CreateAliasAsync(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -180,6 +190,16 @@ void KMSClient::CreateAliasAsync(const CreateAliasRequest& request, const Create
   m_executor->Submit( [this, request, handler, context](){ this->CreateAliasAsyncHelper( request, handler, context ); } );
 }
 
+CreateAliasOutcomeCallable KMSClient::CreateAliasCallable(CreateAliasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::CreateAlias, this, std::move(request)));
+}
+
+void KMSClient::CreateAliasAsync(CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::CreateAliasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::CreateAliasAsyncHelper(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateAlias(request), context);
@@ -203,7 +223,7 @@ CreateGrantOutcome KMSClient::CreateGrant(const CreateGrantRequest& request) con
 
 CreateGrantOutcomeCallable KMSClient::CreateGrantCallable(const CreateGrantRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateGrant(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateGrant(request); } );
 }
 
 void KMSClient::CreateGrantAsync(const CreateGrantRequest& request, const CreateGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -211,6 +231,16 @@ void KMSClient::CreateGrantAsync(const CreateGrantRequest& request, const Create
   m_executor->Submit( [this, request, handler, context](){ this->CreateGrantAsyncHelper( request, handler, context ); } );
 }
 
+CreateGrantOutcomeCallable KMSClient::CreateGrantCallable(CreateGrantRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::CreateGrant, this, std::move(request)));
+}
+
+void KMSClient::CreateGrantAsync(CreateGrantRequest&& request, const CreateGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::CreateGrantAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::CreateGrantAsyncHelper(const CreateGrantRequest& request, const CreateGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateGrant(request), context);
@@ -234,7 +264,7 @@ CreateKeyOutcome KMSClient::CreateKey(const CreateKeyRequest& request) const
 
 CreateKeyOutcomeCallable KMSClient::CreateKeyCallable(const CreateKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateKey(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateKey(request); } );
 }
 
 void KMSClient::CreateKeyAsync(const CreateKeyRequest& request, const CreateKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -242,6 +272,16 @@ void KMSClient::CreateKeyAsync(const CreateKeyRequest& request, const CreateKeyR
   m_executor->Submit( [this, request, handler, context](){ this->CreateKeyAsyncHelper( request, handler, context ); } );
 }
 
+CreateKeyOutcomeCallable KMSClient::CreateKeyCallable(CreateKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::CreateKey, this, std::move(request)));
+}
+
+void KMSClient::CreateKeyAsync(CreateKeyRequest&& request, const CreateKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::CreateKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::CreateKeyAsyncHelper(const CreateKeyRequest& request, const CreateKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateKey(request), context);
@@ -265,7 +305,7 @@ DecryptOutcome KMSClient::Decrypt(const DecryptRequest& request) const
 
 DecryptOutcomeCallable KMSClient::DecryptCallable(const DecryptRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->Decrypt(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->Decrypt(request); } );
 }
 
 void KMSClient::DecryptAsync(const DecryptRequest& request, const DecryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -273,6 +313,16 @@ void KMSClient::DecryptAsync(const DecryptRequest& request, const DecryptRespons
   m_executor->Submit( [this, request, handler, context](){ this->DecryptAsyncHelper( request, handler, context ); } );
 }
 
+DecryptOutcomeCallable KMSClient::DecryptCallable(DecryptRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::Decrypt, this, std::move(request)));
+}
+
+void KMSClient::DecryptAsync(DecryptRequest&& request, const DecryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::DecryptAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::DecryptAsyncHelper(const DecryptRequest& request, const DecryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, Decrypt(request), context);
@@ -296,7 +346,7 @@ DeleteAliasOutcome KMSClient::DeleteAlias(const DeleteAliasRequest& request) con
 
 DeleteAliasOutcomeCallable KMSClient::DeleteAliasCallable(const DeleteAliasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteAlias(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteAlias(request); } );
 }
 
 void KMSClient::DeleteAliasAsync(const DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -304,6 +354,16 @@ void KMSClient::DeleteAliasAsync(const DeleteAliasRequest& request, const Delete
   m_executor->Submit( [this, request, handler, context](){ this->DeleteAliasAsyncHelper( request, handler, context ); } );
 }
 
+DeleteAliasOutcomeCallable KMSClient::DeleteAliasCallable(DeleteAliasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::DeleteAlias, this, std::move(request)));
+}
+
+void KMSClient::DeleteAliasAsync(DeleteAliasRequest&& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::DeleteAliasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::DeleteAliasAsyncHelper(const DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteAlias(request), context);
@@ -327,7 +387,7 @@ DeleteImportedKeyMaterialOutcome KMSClient::DeleteImportedKeyMaterial(const Dele
 
 DeleteImportedKeyMaterialOutcomeCallable KMSClient::DeleteImportedKeyMaterialCallable(const DeleteImportedKeyMaterialRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteImportedKeyMaterial(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteImportedKeyMaterial(request); } );
 }
 
 void KMSClient::DeleteImportedKeyMaterialAsync(const DeleteImportedKeyMaterialRequest& request, const DeleteImportedKeyMaterialResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -335,6 +395,16 @@ void KMSClient::DeleteImportedKeyMaterialAsync(const DeleteImportedKeyMaterialRe
   m_executor->Submit( [this, request, handler, context](){ this->DeleteImportedKeyMaterialAsyncHelper( request, handler, context ); } );
 }
 
+DeleteImportedKeyMaterialOutcomeCallable KMSClient::DeleteImportedKeyMaterialCallable(DeleteImportedKeyMaterialRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::DeleteImportedKeyMaterial, this, std::move(request)));
+}
+
+void KMSClient::DeleteImportedKeyMaterialAsync(DeleteImportedKeyMaterialRequest&& request, const DeleteImportedKeyMaterialResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::DeleteImportedKeyMaterialAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::DeleteImportedKeyMaterialAsyncHelper(const DeleteImportedKeyMaterialRequest& request, const DeleteImportedKeyMaterialResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteImportedKeyMaterial(request), context);
@@ -358,7 +428,7 @@ DescribeKeyOutcome KMSClient::DescribeKey(const DescribeKeyRequest& request) con
 
 DescribeKeyOutcomeCallable KMSClient::DescribeKeyCallable(const DescribeKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeKey(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeKey(request); } );
 }
 
 void KMSClient::DescribeKeyAsync(const DescribeKeyRequest& request, const DescribeKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -366,6 +436,16 @@ void KMSClient::DescribeKeyAsync(const DescribeKeyRequest& request, const Descri
   m_executor->Submit( [this, request, handler, context](){ this->DescribeKeyAsyncHelper( request, handler, context ); } );
 }
 
+DescribeKeyOutcomeCallable KMSClient::DescribeKeyCallable(DescribeKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::DescribeKey, this, std::move(request)));
+}
+
+void KMSClient::DescribeKeyAsync(DescribeKeyRequest&& request, const DescribeKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::DescribeKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::DescribeKeyAsyncHelper(const DescribeKeyRequest& request, const DescribeKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeKey(request), context);
@@ -389,7 +469,7 @@ DisableKeyOutcome KMSClient::DisableKey(const DisableKeyRequest& request) const
 
 DisableKeyOutcomeCallable KMSClient::DisableKeyCallable(const DisableKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableKey(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableKey(request); } );
 }
 
 void KMSClient::DisableKeyAsync(const DisableKeyRequest& request, const DisableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -397,6 +477,16 @@ void KMSClient::DisableKeyAsync(const DisableKeyRequest& request, const DisableK
   m_executor->Submit( [this, request, handler, context](){ this->DisableKeyAsyncHelper( request, handler, context ); } );
 }
 
+DisableKeyOutcomeCallable KMSClient::DisableKeyCallable(DisableKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::DisableKey, this, std::move(request)));
+}
+
+void KMSClient::DisableKeyAsync(DisableKeyRequest&& request, const DisableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::DisableKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::DisableKeyAsyncHelper(const DisableKeyRequest& request, const DisableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableKey(request), context);
@@ -420,7 +510,7 @@ DisableKeyRotationOutcome KMSClient::DisableKeyRotation(const DisableKeyRotation
 
 DisableKeyRotationOutcomeCallable KMSClient::DisableKeyRotationCallable(const DisableKeyRotationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableKeyRotation(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableKeyRotation(request); } );
 }
 
 void KMSClient::DisableKeyRotationAsync(const DisableKeyRotationRequest& request, const DisableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -428,6 +518,16 @@ void KMSClient::DisableKeyRotationAsync(const DisableKeyRotationRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DisableKeyRotationAsyncHelper( request, handler, context ); } );
 }
 
+DisableKeyRotationOutcomeCallable KMSClient::DisableKeyRotationCallable(DisableKeyRotationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::DisableKeyRotation, this, std::move(request)));
+}
+
+void KMSClient::DisableKeyRotationAsync(DisableKeyRotationRequest&& request, const DisableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::DisableKeyRotationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::DisableKeyRotationAsyncHelper(const DisableKeyRotationRequest& request, const DisableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableKeyRotation(request), context);
@@ -451,7 +551,7 @@ EnableKeyOutcome KMSClient::EnableKey(const EnableKeyRequest& request) const
 
 EnableKeyOutcomeCallable KMSClient::EnableKeyCallable(const EnableKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableKey(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableKey(request); } );
 }
 
 void KMSClient::EnableKeyAsync(const EnableKeyRequest& request, const EnableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -459,6 +559,16 @@ void KMSClient::EnableKeyAsync(const EnableKeyRequest& request, const EnableKeyR
   m_executor->Submit( [this, request, handler, context](){ this->EnableKeyAsyncHelper( request, handler, context ); } );
 }
 
+EnableKeyOutcomeCallable KMSClient::EnableKeyCallable(EnableKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::EnableKey, this, std::move(request)));
+}
+
+void KMSClient::EnableKeyAsync(EnableKeyRequest&& request, const EnableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::EnableKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::EnableKeyAsyncHelper(const EnableKeyRequest& request, const EnableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableKey(request), context);
@@ -482,7 +592,7 @@ EnableKeyRotationOutcome KMSClient::EnableKeyRotation(const EnableKeyRotationReq
 
 EnableKeyRotationOutcomeCallable KMSClient::EnableKeyRotationCallable(const EnableKeyRotationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableKeyRotation(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableKeyRotation(request); } );
 }
 
 void KMSClient::EnableKeyRotationAsync(const EnableKeyRotationRequest& request, const EnableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -490,6 +600,16 @@ void KMSClient::EnableKeyRotationAsync(const EnableKeyRotationRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->EnableKeyRotationAsyncHelper( request, handler, context ); } );
 }
 
+EnableKeyRotationOutcomeCallable KMSClient::EnableKeyRotationCallable(EnableKeyRotationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::EnableKeyRotation, this, std::move(request)));
+}
+
+void KMSClient::EnableKeyRotationAsync(EnableKeyRotationRequest&& request, const EnableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::EnableKeyRotationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::EnableKeyRotationAsyncHelper(const EnableKeyRotationRequest& request, const EnableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableKeyRotation(request), context);
@@ -513,7 +633,7 @@ EncryptOutcome KMSClient::Encrypt(const EncryptRequest& request) const
 
 EncryptOutcomeCallable KMSClient::EncryptCallable(const EncryptRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->Encrypt(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->Encrypt(request); } );
 }
 
 void KMSClient::EncryptAsync(const EncryptRequest& request, const EncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -521,6 +641,16 @@ void KMSClient::EncryptAsync(const EncryptRequest& request, const EncryptRespons
   m_executor->Submit( [this, request, handler, context](){ this->EncryptAsyncHelper( request, handler, context ); } );
 }
 
+EncryptOutcomeCallable KMSClient::EncryptCallable(EncryptRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::Encrypt, this, std::move(request)));
+}
+
+void KMSClient::EncryptAsync(EncryptRequest&& request, const EncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::EncryptAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::EncryptAsyncHelper(const EncryptRequest& request, const EncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, Encrypt(request), context);
@@ -544,7 +674,7 @@ GenerateDataKeyOutcome KMSClient::GenerateDataKey(const GenerateDataKeyRequest&
 
 GenerateDataKeyOutcomeCallable KMSClient::GenerateDataKeyCallable(const GenerateDataKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GenerateDataKey(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GenerateDataKey(request); } );
 }
 
 void KMSClient::GenerateDataKeyAsync(const GenerateDataKeyRequest& request, const GenerateDataKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -552,6 +682,16 @@ void KMSClient::GenerateDataKeyAsync(const GenerateDataKeyRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->GenerateDataKeyAsyncHelper( request, handler, context ); } );
 }
 
+GenerateDataKeyOutcomeCallable KMSClient::GenerateDataKeyCallable(GenerateDataKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::GenerateDataKey, this, std::move(request)));
+}
+
+void KMSClient::GenerateDataKeyAsync(GenerateDataKeyRequest&& request, const GenerateDataKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::GenerateDataKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::GenerateDataKeyAsyncHelper(const GenerateDataKeyRequest& request, const GenerateDataKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GenerateDataKey(request), context);
@@ -575,7 +715,7 @@ GenerateDataKeyWithoutPlaintextOutcome KMSClient::GenerateDataKeyWithoutPlaintex
 
 GenerateDataKeyWithoutPlaintextOutcomeCallable KMSClient::GenerateDataKeyWithoutPlaintextCallable(const GenerateDataKeyWithoutPlaintextRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GenerateDataKeyWithoutPlaintext(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GenerateDataKeyWithoutPlaintext(request); } );
 }
 
 void KMSClient::GenerateDataKeyWithoutPlaintextAsync(const GenerateDataKeyWithoutPlaintextRequest& request, const GenerateDataKeyWithoutPlaintextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -583,6 +723,16 @@ void KMSClient::GenerateDataKeyWithoutPlaintextAsync(const GenerateDataKeyWithou
   m_executor->Submit( [this, request, handler, context](){ this->GenerateDataKeyWithoutPlaintextAsyncHelper( request, handler, context ); } );
 }
 
+GenerateDataKeyWithoutPlaintextOutcomeCallable KMSClient::GenerateDataKeyWithoutPlaintextCallable(GenerateDataKeyWithoutPlaintextRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::GenerateDataKeyWithoutPlaintext, this, std::move(request)));
+}
+
+void KMSClient::GenerateDataKeyWithoutPlaintextAsync(GenerateDataKeyWithoutPlaintextRequest&& request, const GenerateDataKeyWithoutPlaintextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::GenerateDataKeyWithoutPlaintextAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::GenerateDataKeyWithoutPlaintextAsyncHelper(const GenerateDataKeyWithoutPlaintextRequest& request, const GenerateDataKeyWithoutPlaintextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GenerateDataKeyWithoutPlaintext(request), context);
@@ -606,7 +756,7 @@ GenerateRandomOutcome KMSClient::GenerateRandom(const GenerateRandomRequest& req
 
 GenerateRandomOutcomeCallable KMSClient::GenerateRandomCallable(const GenerateRandomRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GenerateRandom(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GenerateRandom(request); } );
 }
 
 void KMSClient::GenerateRandomAsync(const GenerateRandomRequest& request, const GenerateRandomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -614,6 +764,16 @@ void KMSClient::GenerateRandomAsync(const GenerateRandomRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->GenerateRandomAsyncHelper( request, handler, context ); } );
 }
 
+GenerateRandomOutcomeCallable KMSClient::GenerateRandomCallable(GenerateRandomRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::GenerateRandom, this, std::move(request)));
+}
+
+void KMSClient::GenerateRandomAsync(GenerateRandomRequest&& request, const GenerateRandomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::GenerateRandomAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::GenerateRandomAsyncHelper(const GenerateRandomRequest& request, const GenerateRandomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GenerateRandom(request), context);
@@ -637,7 +797,7 @@ GetKeyPolicyOutcome KMSClient::GetKeyPolicy(const GetKeyPolicyRequest& request)
 
 GetKeyPolicyOutcomeCallable KMSClient::GetKeyPolicyCallable(const GetKeyPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetKeyPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetKeyPolicy(request); } );
 }
 
 void KMSClient::GetKeyPolicyAsync(const GetKeyPolicyRequest& request, const GetKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -645,6 +805,16 @@ void KMSClient::GetKeyPolicyAsync(const GetKeyPolicyRequest& request, const GetK
   m_executor->Submit( [this, request, handler, context](){ this->GetKeyPolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetKeyPolicyOutcomeCallable KMSClient::GetKeyPolicyCallable(GetKeyPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::GetKeyPolicy, this, std::move(request)));
+}
+
+void KMSClient::GetKeyPolicyAsync(GetKeyPolicyRequest&& request, const GetKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::GetKeyPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::GetKeyPolicyAsyncHelper(const GetKeyPolicyRequest& request, const GetKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetKeyPolicy(request), context);
@@ -668,7 +838,7 @@ GetKeyRotationStatusOutcome KMSClient::GetKeyRotationStatus(const GetKeyRotation
 
 GetKeyRotationStatusOutcomeCallable KMSClient::GetKeyRotationStatusCallable(const GetKeyRotationStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetKeyRotationStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetKeyRotationStatus(request); } );
 }
 
 void KMSClient::GetKeyRotationStatusAsync(const GetKeyRotationStatusRequest& request, const GetKeyRotationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -676,6 +846,16 @@ void KMSClient::GetKeyRotationStatusAsync(const GetKeyRotationStatusRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->GetKeyRotationStatusAsyncHelper( request, handler, context ); } );
 }
 
+GetKeyRotationStatusOutcomeCallable KMSClient::GetKeyRotationStatusCallable(GetKeyRotationStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::GetKeyRotationStatus, this, std::move(request)));
+}
+
+void KMSClient::GetKeyRotationStatusAsync(GetKeyRotationStatusRequest&& request, const GetKeyRotationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::GetKeyRotationStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::GetKeyRotationStatusAsyncHelper(const GetKeyRotationStatusRequest& request, const GetKeyRotationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetKeyRotationStatus(request), context);
@@ -699,7 +879,7 @@ GetParametersForImportOutcome KMSClient::GetParametersForImport(const GetParamet
 
 GetParametersForImportOutcomeCallable KMSClient::GetParametersForImportCallable(const GetParametersForImportRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetParametersForImport(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetParametersForImport(request); } );
 }
 
 void KMSClient::GetParametersForImportAsync(const GetParametersForImportRequest& request, const GetParametersForImportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -707,6 +887,16 @@ void KMSClient::GetParametersForImportAsync(const GetParametersForImportRequest&
   m_executor->Submit( [this, request, handler, context](){ this->GetParametersForImportAsyncHelper( request, handler, context ); } );
 }
 
+GetParametersForImportOutcomeCallable KMSClient::GetParametersForImportCallable(GetParametersForImportRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::GetParametersForImport, this, std::move(request)));
+}
+
+void KMSClient::GetParametersForImportAsync(GetParametersForImportRequest&& request, const GetParametersForImportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::GetParametersForImportAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::GetParametersForImportAsyncHelper(const GetParametersForImportRequest& request, const GetParametersForImportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetParametersForImport(request), context);
@@ -730,7 +920,7 @@ ImportKeyMaterialOutcome KMSClient::ImportKeyMaterial(const ImportKeyMaterialReq
 
 ImportKeyMaterialOutcomeCallable KMSClient::ImportKeyMaterialCallable(const ImportKeyMaterialRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ImportKeyMaterial(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ImportKeyMaterial(request); } );
 }
 
 void KMSClient::ImportKeyMaterialAsync(const ImportKeyMaterialRequest& request, const ImportKeyMaterialResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -738,6 +928,16 @@ void KMSClient::ImportKeyMaterialAsync(const ImportKeyMaterialRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ImportKeyMaterialAsyncHelper( request, handler, context ); } );
 }
 
+ImportKeyMaterialOutcomeCallable KMSClient::ImportKeyMaterialCallable(ImportKeyMaterialRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::ImportKeyMaterial, this, std::move(request)));
+}
+
+void KMSClient::ImportKeyMaterialAsync(ImportKeyMaterialRequest&& request, const ImportKeyMaterialResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::ImportKeyMaterialAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::ImportKeyMaterialAsyncHelper(const ImportKeyMaterialRequest& request, const ImportKeyMaterialResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ImportKeyMaterial(request), context);
@@ -761,7 +961,7 @@ ListAliasesOutcome KMSClient::ListAliases(const ListAliasesRequest& request) con
 
 ListAliasesOutcomeCallable KMSClient::ListAliasesCallable(const ListAliasesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAliases(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAliases(request); } );
 }
 
 void KMSClient::ListAliasesAsync(const ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -769,6 +969,16 @@ void KMSClient::ListAliasesAsync(const ListAliasesRequest& request, const ListAl
   m_executor->Submit( [this, request, handler, context](){ this->ListAliasesAsyncHelper( request, handler, context ); } );
 }
 
+ListAliasesOutcomeCallable KMSClient::ListAliasesCallable(ListAliasesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::ListAliases, this, std::move(request)));
+}
+
+void KMSClient::ListAliasesAsync(ListAliasesRequest&& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::ListAliasesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::ListAliasesAsyncHelper(const ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAliases(request), context);
@@ -792,7 +1002,7 @@ ListGrantsOutcome KMSClient::ListGrants(const ListGrantsRequest& request) const
 
 ListGrantsOutcomeCallable KMSClient::ListGrantsCallable(const ListGrantsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListGrants(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListGrants(request); } );
 }
 
 void KMSClient::ListGrantsAsync(const ListGrantsRequest& request, const ListGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -800,6 +1010,16 @@ void KMSClient::ListGrantsAsync(const ListGrantsRequest& request, const ListGran
   m_executor->Submit( [this, request, handler, context](){ this->ListGrantsAsyncHelper( request, handler, context ); } );
 }
 
+ListGrantsOutcomeCallable KMSClient::ListGrantsCallable(ListGrantsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::ListGrants, this, std::move(request)));
+}
+
+void KMSClient::ListGrantsAsync(ListGrantsRequest&& request, const ListGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::ListGrantsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::ListGrantsAsyncHelper(const ListGrantsRequest& request, const ListGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListGrants(request), context);
@@ -823,7 +1043,7 @@ ListKeyPoliciesOutcome KMSClient::ListKeyPolicies(const ListKeyPoliciesRequest&
 
 ListKeyPoliciesOutcomeCallable KMSClient::ListKeyPoliciesCallable(const ListKeyPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListKeyPolicies(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListKeyPolicies(request); } );
 }
 
 void KMSClient::ListKeyPoliciesAsync(const ListKeyPoliciesRequest& request, const ListKeyPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -831,6 +1051,16 @@ void KMSClient::ListKeyPoliciesAsync(const ListKeyPoliciesRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->ListKeyPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+ListKeyPoliciesOutcomeCallable KMSClient::ListKeyPoliciesCallable(ListKeyPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::ListKeyPolicies, this, std::move(request)));
+}
+
+void KMSClient::ListKeyPoliciesAsync(ListKeyPoliciesRequest&& request, const ListKeyPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::ListKeyPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::ListKeyPoliciesAsyncHelper(const ListKeyPoliciesRequest& request, const ListKeyPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListKeyPolicies(request), context);
@@ -854,7 +1084,7 @@ ListKeysOutcome KMSClient::ListKeys(const ListKeysRequest& request) const
 
 ListKeysOutcomeCallable KMSClient::ListKeysCallable(const ListKeysRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListKeys(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListKeys(request); } );
 }
 
 void KMSClient::ListKeysAsync(const ListKeysRequest& request, const ListKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -862,6 +1092,16 @@ void KMSClient::ListKeysAsync(const ListKeysRequest& request, const ListKeysResp
   m_executor->Submit( [this, request, handler, context](){ this->ListKeysAsyncHelper( request, handler, context ); } );
 }
 
+ListKeysOutcomeCallable KMSClient::ListKeysCallable(ListKeysRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::ListKeys, this, std::move(request)));
+}
+
+void KMSClient::ListKeysAsync(ListKeysRequest&& request, const ListKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::ListKeysAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::ListKeysAsyncHelper(const ListKeysRequest& request, const ListKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListKeys(request), context);
@@ -885,7 +1125,7 @@ ListRetirableGrantsOutcome KMSClient::ListRetirableGrants(const ListRetirableGra
 
 ListRetirableGrantsOutcomeCallable KMSClient::ListRetirableGrantsCallable(const ListRetirableGrantsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListRetirableGrants(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListRetirableGrants(request); } );
 }
 
 void KMSClient::ListRetirableGrantsAsync(const ListRetirableGrantsRequest& request, const ListRetirableGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -893,6 +1133,16 @@ void KMSClient::ListRetirableGrantsAsync(const ListRetirableGrantsRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ListRetirableGrantsAsyncHelper( request, handler, context ); } );
 }
 
+ListRetirableGrantsOutcomeCallable KMSClient::ListRetirableGrantsCallable(ListRetirableGrantsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::ListRetirableGrants, this, std::move(request)));
+}
+
+void KMSClient::ListRetirableGrantsAsync(ListRetirableGrantsRequest&& request, const ListRetirableGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::ListRetirableGrantsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::ListRetirableGrantsAsyncHelper(const ListRetirableGrantsRequest& request, const ListRetirableGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListRetirableGrants(request), context);
@@ -916,7 +1166,7 @@ PutKeyPolicyOutcome KMSClient::PutKeyPolicy(const PutKeyPolicyRequest& request)
 
 PutKeyPolicyOutcomeCallable KMSClient::PutKeyPolicyCallable(const PutKeyPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutKeyPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutKeyPolicy(request); } );
 }
 
 void KMSClient::PutKeyPolicyAsync(const PutKeyPolicyRequest& request, const PutKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -924,6 +1174,16 @@ void KMSClient::PutKeyPolicyAsync(const PutKeyPolicyRequest& request, const PutK
   m_executor->Submit( [this, request, handler, context](){ this->PutKeyPolicyAsyncHelper( request, handler, context ); } );
 }
 
+PutKeyPolicyOutcomeCallable KMSClient::PutKeyPolicyCallable(PutKeyPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::PutKeyPolicy, this, std::move(request)));
+}
+
+void KMSClient::PutKeyPolicyAsync(PutKeyPolicyRequest&& request, const PutKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::PutKeyPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::PutKeyPolicyAsyncHelper(const PutKeyPolicyRequest& request, const PutKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutKeyPolicy(request), context);
@@ -947,7 +1207,7 @@ ReEncryptOutcome KMSClient::ReEncrypt(const ReEncryptRequest& request) const
 
 ReEncryptOutcomeCallable KMSClient::ReEncryptCallable(const ReEncryptRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReEncrypt(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ReEncrypt(request); } );
 }
 
 void KMSClient::ReEncryptAsync(const ReEncryptRequest& request, const ReEncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -955,6 +1215,16 @@ void KMSClient::ReEncryptAsync(const ReEncryptRequest& request, const ReEncryptR
   m_executor->Submit( [this, request, handler, context](){ this->ReEncryptAsyncHelper( request, handler, context ); } );
 }
 
+ReEncryptOutcomeCallable KMSClient::ReEncryptCallable(ReEncryptRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::ReEncrypt, this, std::move(request)));
+}
+
+void KMSClient::ReEncryptAsync(ReEncryptRequest&& request, const ReEncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::ReEncryptAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::ReEncryptAsyncHelper(const ReEncryptRequest& request, const ReEncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReEncrypt(request), context);
@@ -978,7 +1248,7 @@ RetireGrantOutcome KMSClient::RetireGrant(const RetireGrantRequest& request) con
 
 RetireGrantOutcomeCallable KMSClient::RetireGrantCallable(const RetireGrantRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RetireGrant(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RetireGrant(request); } );
 }
 
 void KMSClient::RetireGrantAsync(const RetireGrantRequest& request, const RetireGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -986,6 +1256,16 @@ void KMSClient::RetireGrantAsync(const RetireGrantRequest& request, const Retire
   m_executor->Submit( [this, request, handler, context](){ this->RetireGrantAsyncHelper( request, handler, context ); } );
 }
 
+RetireGrantOutcomeCallable KMSClient::RetireGrantCallable(RetireGrantRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::RetireGrant, this, std::move(request)));
+}
+
+void KMSClient::RetireGrantAsync(RetireGrantRequest&& request, const RetireGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::RetireGrantAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::RetireGrantAsyncHelper(const RetireGrantRequest& request, const RetireGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RetireGrant(request), context);
@@ -1009,7 +1289,7 @@ RevokeGrantOutcome KMSClient::RevokeGrant(const RevokeGrantRequest& request) con
 
 RevokeGrantOutcomeCallable KMSClient::RevokeGrantCallable(const RevokeGrantRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RevokeGrant(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RevokeGrant(request); } );
 }
 
 void KMSClient::RevokeGrantAsync(const RevokeGrantRequest& request, const RevokeGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1017,6 +1297,16 @@ void KMSClient::RevokeGrantAsync(const RevokeGrantRequest& request, const Revoke
   m_executor->Submit( [this, request, handler, context](){ this->RevokeGrantAsyncHelper( request, handler, context ); } );
 }
 
+RevokeGrantOutcomeCallable KMSClient::RevokeGrantCallable(RevokeGrantRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::RevokeGrant, this, std::move(request)));
+}
+
+void KMSClient::RevokeGrantAsync(RevokeGrantRequest&& request, const RevokeGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::RevokeGrantAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::RevokeGrantAsyncHelper(const RevokeGrantRequest& request, const RevokeGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RevokeGrant(request), context);
@@ -1040,7 +1330,7 @@ ScheduleKeyDeletionOutcome KMSClient::ScheduleKeyDeletion(const ScheduleKeyDelet
 
 ScheduleKeyDeletionOutcomeCallable KMSClient::ScheduleKeyDeletionCallable(const ScheduleKeyDeletionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ScheduleKeyDeletion(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ScheduleKeyDeletion(request); } );
 }
 
 void KMSClient::ScheduleKeyDeletionAsync(const ScheduleKeyDeletionRequest& request, const ScheduleKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1048,6 +1338,16 @@ void KMSClient::ScheduleKeyDeletionAsync(const ScheduleKeyDeletionRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ScheduleKeyDeletionAsyncHelper( request, handler, context ); } );
 }
 
+ScheduleKeyDeletionOutcomeCallable KMSClient::ScheduleKeyDeletionCallable(ScheduleKeyDeletionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::ScheduleKeyDeletion, this, std::move(request)));
+}
+
+void KMSClient::ScheduleKeyDeletionAsync(ScheduleKeyDeletionRequest&& request, const ScheduleKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::ScheduleKeyDeletionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::ScheduleKeyDeletionAsyncHelper(const ScheduleKeyDeletionRequest& request, const ScheduleKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ScheduleKeyDeletion(request), context);
@@ -1071,7 +1371,7 @@ UpdateAliasOutcome KMSClient::UpdateAlias(const UpdateAliasRequest& request) con
 
 UpdateAliasOutcomeCallable KMSClient::UpdateAliasCallable(const UpdateAliasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateAlias(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateAlias(request); } );
 }
 
 void KMSClient::UpdateAliasAsync(const UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1079,6 +1379,16 @@ void KMSClient::UpdateAliasAsync(const UpdateAliasRequest& request, const Update
   m_executor->Submit( [this, request, handler, context](){ this->UpdateAliasAsyncHelper( request, handler, context ); } );
 }
 
+UpdateAliasOutcomeCallable KMSClient::UpdateAliasCallable(UpdateAliasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::UpdateAlias, this, std::move(request)));
+}
+
+void KMSClient::UpdateAliasAsync(UpdateAliasRequest&& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::UpdateAliasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::UpdateAliasAsyncHelper(const UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateAlias(request), context);
@@ -1102,7 +1412,7 @@ UpdateKeyDescriptionOutcome KMSClient::UpdateKeyDescription(const UpdateKeyDescr
 
 UpdateKeyDescriptionOutcomeCallable KMSClient::UpdateKeyDescriptionCallable(const UpdateKeyDescriptionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateKeyDescription(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateKeyDescription(request); } );
 }
 
 void KMSClient::UpdateKeyDescriptionAsync(const UpdateKeyDescriptionRequest& request, const UpdateKeyDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1110,8 +1420,285 @@ void KMSClient::UpdateKeyDescriptionAsync(const UpdateKeyDescriptionRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->UpdateKeyDescriptionAsyncHelper( request, handler, context ); } );
 }
 
+UpdateKeyDescriptionOutcomeCallable KMSClient::UpdateKeyDescriptionCallable(UpdateKeyDescriptionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&KMSClient::UpdateKeyDescription, this, std::move(request)));
+}
+
+void KMSClient::UpdateKeyDescriptionAsync(UpdateKeyDescriptionRequest&& request, const UpdateKeyDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&KMSClient::UpdateKeyDescriptionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void KMSClient::UpdateKeyDescriptionAsyncHelper(const UpdateKeyDescriptionRequest& request, const UpdateKeyDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateKeyDescription(request), context);
 }
 
+Paginator<KMSClient, ListAliasesRequest, ListAliasesOutcome> KMSClient::ListAliasesPaginator(const ListAliasesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<KMSClient, ListAliasesRequest, ListAliasesOutcome>(this, &KMSClient::ListAliases, request,
+    [](const ListAliasesRequest& current, const ListAliasesOutcome& outcome, ListAliasesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<KMSClient, ListGrantsRequest, ListGrantsOutcome> KMSClient::ListGrantsPaginator(const ListGrantsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<KMSClient, ListGrantsRequest, ListGrantsOutcome>(this, &KMSClient::ListGrants, request,
+    [](const ListGrantsRequest& current, const ListGrantsOutcome& outcome, ListGrantsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<KMSClient, ListKeyPoliciesRequest, ListKeyPoliciesOutcome> KMSClient::ListKeyPoliciesPaginator(const ListKeyPoliciesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<KMSClient, ListKeyPoliciesRequest, ListKeyPoliciesOutcome>(this, &KMSClient::ListKeyPolicies, request,
+    [](const ListKeyPoliciesRequest& current, const ListKeyPoliciesOutcome& outcome, ListKeyPoliciesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<KMSClient, ListKeysRequest, ListKeysOutcome> KMSClient::ListKeysPaginator(const ListKeysRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<KMSClient, ListKeysRequest, ListKeysOutcome>(this, &KMSClient::ListKeys, request,
+    [](const ListKeysRequest& current, const ListKeysOutcome& outcome, ListKeysRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<KMSClient, ListRetirableGrantsRequest, ListRetirableGrantsOutcome> KMSClient::ListRetirableGrantsPaginator(const ListRetirableGrantsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<KMSClient, ListRetirableGrantsRequest, ListRetirableGrantsOutcome>(this, &KMSClient::ListRetirableGrants, request,
+    [](const ListRetirableGrantsRequest& current, const ListRetirableGrantsOutcome& outcome, ListRetirableGrantsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<KMSClient, CancelKeyDeletionRequest, CancelKeyDeletionOutcome> KMSClient::CancelKeyDeletionAwaitable(CancelKeyDeletionRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::CancelKeyDeletion, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, CreateAliasRequest, CreateAliasOutcome> KMSClient::CreateAliasAwaitable(CreateAliasRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::CreateAlias, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, CreateGrantRequest, CreateGrantOutcome> KMSClient::CreateGrantAwaitable(CreateGrantRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::CreateGrant, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, CreateKeyRequest, CreateKeyOutcome> KMSClient::CreateKeyAwaitable(CreateKeyRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::CreateKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, DecryptRequest, DecryptOutcome> KMSClient::DecryptAwaitable(DecryptRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::Decrypt, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, DeleteAliasRequest, DeleteAliasOutcome> KMSClient::DeleteAliasAwaitable(DeleteAliasRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::DeleteAlias, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, DeleteImportedKeyMaterialRequest, DeleteImportedKeyMaterialOutcome> KMSClient::DeleteImportedKeyMaterialAwaitable(DeleteImportedKeyMaterialRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::DeleteImportedKeyMaterial, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, DescribeKeyRequest, DescribeKeyOutcome> KMSClient::DescribeKeyAwaitable(DescribeKeyRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::DescribeKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, DisableKeyRequest, DisableKeyOutcome> KMSClient::DisableKeyAwaitable(DisableKeyRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::DisableKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, DisableKeyRotationRequest, DisableKeyRotationOutcome> KMSClient::DisableKeyRotationAwaitable(DisableKeyRotationRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::DisableKeyRotation, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, EnableKeyRequest, EnableKeyOutcome> KMSClient::EnableKeyAwaitable(EnableKeyRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::EnableKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, EnableKeyRotationRequest, EnableKeyRotationOutcome> KMSClient::EnableKeyRotationAwaitable(EnableKeyRotationRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::EnableKeyRotation, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, EncryptRequest, EncryptOutcome> KMSClient::EncryptAwaitable(EncryptRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::Encrypt, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, GenerateDataKeyRequest, GenerateDataKeyOutcome> KMSClient::GenerateDataKeyAwaitable(GenerateDataKeyRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::GenerateDataKey, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, GenerateDataKeyWithoutPlaintextRequest, GenerateDataKeyWithoutPlaintextOutcome> KMSClient::GenerateDataKeyWithoutPlaintextAwaitable(GenerateDataKeyWithoutPlaintextRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::GenerateDataKeyWithoutPlaintext, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, GenerateRandomRequest, GenerateRandomOutcome> KMSClient::GenerateRandomAwaitable(GenerateRandomRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::GenerateRandom, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, GetKeyPolicyRequest, GetKeyPolicyOutcome> KMSClient::GetKeyPolicyAwaitable(GetKeyPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::GetKeyPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, GetKeyRotationStatusRequest, GetKeyRotationStatusOutcome> KMSClient::GetKeyRotationStatusAwaitable(GetKeyRotationStatusRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::GetKeyRotationStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, GetParametersForImportRequest, GetParametersForImportOutcome> KMSClient::GetParametersForImportAwaitable(GetParametersForImportRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::GetParametersForImport, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, ImportKeyMaterialRequest, ImportKeyMaterialOutcome> KMSClient::ImportKeyMaterialAwaitable(ImportKeyMaterialRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::ImportKeyMaterial, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, ListAliasesRequest, ListAliasesOutcome> KMSClient::ListAliasesAwaitable(ListAliasesRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::ListAliases, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, ListGrantsRequest, ListGrantsOutcome> KMSClient::ListGrantsAwaitable(ListGrantsRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::ListGrants, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, ListKeyPoliciesRequest, ListKeyPoliciesOutcome> KMSClient::ListKeyPoliciesAwaitable(ListKeyPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::ListKeyPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, ListKeysRequest, ListKeysOutcome> KMSClient::ListKeysAwaitable(ListKeysRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::ListKeys, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, ListRetirableGrantsRequest, ListRetirableGrantsOutcome> KMSClient::ListRetirableGrantsAwaitable(ListRetirableGrantsRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::ListRetirableGrants, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, PutKeyPolicyRequest, PutKeyPolicyOutcome> KMSClient::PutKeyPolicyAwaitable(PutKeyPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::PutKeyPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, ReEncryptRequest, ReEncryptOutcome> KMSClient::ReEncryptAwaitable(ReEncryptRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::ReEncrypt, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, RetireGrantRequest, RetireGrantOutcome> KMSClient::RetireGrantAwaitable(RetireGrantRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::RetireGrant, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, RevokeGrantRequest, RevokeGrantOutcome> KMSClient::RevokeGrantAwaitable(RevokeGrantRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::RevokeGrant, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, ScheduleKeyDeletionRequest, ScheduleKeyDeletionOutcome> KMSClient::ScheduleKeyDeletionAwaitable(ScheduleKeyDeletionRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::ScheduleKeyDeletion, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, UpdateAliasRequest, UpdateAliasOutcome> KMSClient::UpdateAliasAwaitable(UpdateAliasRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::UpdateAlias, std::move(request) } };
+}
+
+ClientOperationAwaitable<KMSClient, UpdateKeyDescriptionRequest, UpdateKeyDescriptionOutcome> KMSClient::UpdateKeyDescriptionAwaitable(UpdateKeyDescriptionRequest request) const
+{
+  return { m_executor.get(), { this, &KMSClient::UpdateKeyDescription, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,26 +29,32 @@ namespace Aws
       namespace AlgorithmSpecMapper
       {
 
-        static const int RSAES_PKCS1_V1_5_HASH = HashingUtils::HashString("RSAES_PKCS1_V1_5");
-        static const int RSAES_OAEP_SHA_1_HASH = HashingUtils::HashString("RSAES_OAEP_SHA_1");
-        static const int RSAES_OAEP_SHA_256_HASH = HashingUtils::HashString("RSAES_OAEP_SHA_256");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int RSAES_PKCS1_V1_5_HASH = 998787163;
+        static const int RSAES_OAEP_SHA_1_HASH = -76424563;
+        static const int RSAES_OAEP_SHA_256_HASH = -429558353;
 
 
         AlgorithmSpec GetAlgorithmSpecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RSAES_PKCS1_V1_5_HASH)
+          switch (hashCode)
           {
+          case RSAES_PKCS1_V1_5_HASH:
             return AlgorithmSpec::RSAES_PKCS1_V1_5;
-          }
-          else if (hashCode == RSAES_OAEP_SHA_1_HASH)
-          {
+          case RSAES_OAEP_SHA_1_HASH:
             return AlgorithmSpec::RSAES_OAEP_SHA_1;
-          }
-          else if (hashCode == RSAES_OAEP_SHA_256_HASH)
-          {
+          case RSAES_OAEP_SHA_256_HASH:
             return AlgorithmSpec::RSAES_OAEP_SHA_256;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
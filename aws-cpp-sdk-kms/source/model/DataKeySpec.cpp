@@ -29,21 +29,29 @@ namespace Aws
       namespace DataKeySpecMapper
       {
 
-        static const int AES_256_HASH = HashingUtils::HashString("AES_256");
-        static const int AES_128_HASH = HashingUtils::HashString("AES_128");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int AES_256_HASH = -386859325;
+        static const int AES_128_HASH = -386860377;
 
 
         DataKeySpec GetDataKeySpecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AES_256_HASH)
+          switch (hashCode)
           {
+          case AES_256_HASH:
             return DataKeySpec::AES_256;
-          }
-          else if (hashCode == AES_128_HASH)
-          {
+          case AES_128_HASH:
             return DataKeySpec::AES_128;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace ExpirationModelTypeMapper
       {
 
-        static const int KEY_MATERIAL_EXPIRES_HASH = HashingUtils::HashString("KEY_MATERIAL_EXPIRES");
-        static const int KEY_MATERIAL_DOES_NOT_EXPIRE_HASH = HashingUtils::HashString("KEY_MATERIAL_DOES_NOT_EXPIRE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int KEY_MATERIAL_EXPIRES_HASH = 19545596;
+        static const int KEY_MATERIAL_DOES_NOT_EXPIRE_HASH = 1121003673;
 
 
         ExpirationModelType GetExpirationModelTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == KEY_MATERIAL_EXPIRES_HASH)
+          switch (hashCode)
           {
+          case KEY_MATERIAL_EXPIRES_HASH:
             return ExpirationModelType::KEY_MATERIAL_EXPIRES;
-          }
-          else if (hashCode == KEY_MATERIAL_DOES_NOT_EXPIRE_HASH)
-          {
+          case KEY_MATERIAL_DOES_NOT_EXPIRE_HASH:
             return ExpirationModelType::KEY_MATERIAL_DOES_NOT_EXPIRE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,56 +29,50 @@ namespace Aws
       namespace GrantOperationMapper
       {
 
-        static const int Decrypt_HASH = HashingUtils::HashString("Decrypt");
-        static const int Encrypt_HASH = HashingUtils::HashString("Encrypt");
-        static const int GenerateDataKey_HASH = HashingUtils::HashString("GenerateDataKey");
-        static const int GenerateDataKeyWithoutPlaintext_HASH = HashingUtils::HashString("GenerateDataKeyWithoutPlaintext");
-        static const int ReEncryptFrom_HASH = HashingUtils::HashString("ReEncryptFrom");
-        static const int ReEncryptTo_HASH = HashingUtils::HashString("ReEncryptTo");
-        static const int CreateGrant_HASH = HashingUtils::HashString("CreateGrant");
-        static const int RetireGrant_HASH = HashingUtils::HashString("RetireGrant");
-        static const int DescribeKey_HASH = HashingUtils::HashString("DescribeKey");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Decrypt_HASH = -1087770259;
+        static const int Encrypt_HASH = 57395781;
+        static const int GenerateDataKey_HASH = 1333803776;
+        static const int GenerateDataKeyWithoutPlaintext_HASH = 936913199;
+        static const int ReEncryptFrom_HASH = -411893924;
+        static const int ReEncryptTo_HASH = -371377491;
+        static const int CreateGrant_HASH = 1152062816;
+        static const int RetireGrant_HASH = 462832033;
+        static const int DescribeKey_HASH = -70082700;
 
 
         GrantOperation GetGrantOperationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Decrypt_HASH)
+          switch (hashCode)
           {
+          case Decrypt_HASH:
             return GrantOperation::Decrypt;
-          }
-          else if (hashCode == Encrypt_HASH)
-          {
+          case Encrypt_HASH:
             return GrantOperation::Encrypt;
-          }
-          else if (hashCode == GenerateDataKey_HASH)
-          {
+          case GenerateDataKey_HASH:
             return GrantOperation::GenerateDataKey;
-          }
-          else if (hashCode == GenerateDataKeyWithoutPlaintext_HASH)
-          {
+          case GenerateDataKeyWithoutPlaintext_HASH:
             return GrantOperation::GenerateDataKeyWithoutPlaintext;
-          }
-          else if (hashCode == ReEncryptFrom_HASH)
-          {
+          case ReEncryptFrom_HASH:
             return GrantOperation::ReEncryptFrom;
-          }
-          else if (hashCode == ReEncryptTo_HASH)
-          {
+          case ReEncryptTo_HASH:
             return GrantOperation::ReEncryptTo;
-          }
-          else if (hashCode == CreateGrant_HASH)
-          {
+          case CreateGrant_HASH:
             return GrantOperation::CreateGrant;
-          }
-          else if (hashCode == RetireGrant_HASH)
-          {
+          case RetireGrant_HASH:
             return GrantOperation::RetireGrant;
-          }
-          else if (hashCode == DescribeKey_HASH)
-          {
+          case DescribeKey_HASH:
             return GrantOperation::DescribeKey;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,31 +29,35 @@ namespace Aws
       namespace KeyStateMapper
       {
 
-        static const int Enabled_HASH = HashingUtils::HashString("Enabled");
-        static const int Disabled_HASH = HashingUtils::HashString("Disabled");
-        static const int PendingDeletion_HASH = HashingUtils::HashString("PendingDeletion");
-        static const int PendingImport_HASH = HashingUtils::HashString("PendingImport");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Enabled_HASH = 55059233;
+        static const int Disabled_HASH = 335584924;
+        static const int PendingDeletion_HASH = -1805778331;
+        static const int PendingImport_HASH = 926436348;
 
 
         KeyState GetKeyStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Enabled_HASH)
+          switch (hashCode)
           {
+          case Enabled_HASH:
             return KeyState::Enabled;
-          }
-          else if (hashCode == Disabled_HASH)
-          {
+          case Disabled_HASH:
             return KeyState::Disabled;
-          }
-          else if (hashCode == PendingDeletion_HASH)
-          {
+          case PendingDeletion_HASH:
             return KeyState::PendingDeletion;
-          }
-          else if (hashCode == PendingImport_HASH)
-          {
+          case PendingImport_HASH:
             return KeyState::PendingImport;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace KeyUsageTypeMapper
       {
 
-        static const int ENCRYPT_DECRYPT_HASH = HashingUtils::HashString("ENCRYPT_DECRYPT");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ENCRYPT_DECRYPT_HASH = -1054919309;
 
 
         KeyUsageType GetKeyUsageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENCRYPT_DECRYPT_HASH)
+          switch (hashCode)
           {
+          case ENCRYPT_DECRYPT_HASH:
             return KeyUsageType::ENCRYPT_DECRYPT;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace OriginTypeMapper
       {
 
-        static const int AWS_KMS_HASH = HashingUtils::HashString("AWS_KMS");
-        static const int EXTERNAL_HASH = HashingUtils::HashString("EXTERNAL");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int AWS_KMS_HASH = 128490191;
+        static const int EXTERNAL_HASH = -1038134325;
 
 
         OriginType GetOriginTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_KMS_HASH)
+          switch (hashCode)
           {
+          case AWS_KMS_HASH:
             return OriginType::AWS_KMS;
-          }
-          else if (hashCode == EXTERNAL_HASH)
-          {
+          case EXTERNAL_HASH:
             return OriginType::EXTERNAL;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace WrappingKeySpecMapper
       {
 
-        static const int RSA_2048_HASH = HashingUtils::HashString("RSA_2048");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int RSA_2048_HASH = -519912447;
 
 
         WrappingKeySpec GetWrappingKeySpecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RSA_2048_HASH)
+          switch (hashCode)
           {
+          case RSA_2048_HASH:
             return WrappingKeySpec::RSA_2048;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
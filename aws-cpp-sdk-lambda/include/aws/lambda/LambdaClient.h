@@ -42,6 +42,9 @@
 #include <aws/lambda/model/UpdateFunctionConfigurationResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -278,6 +281,18 @@ namespace Model
          */
         virtual void AddPermissionAsync(const Model::AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddPermissionCallable(const Model::AddPermissionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddPermissionOutcomeCallable AddPermissionCallable(Model::AddPermissionRequest&& request) const;
+
+        /**
+         * Same as AddPermissionAsync(const Model::AddPermissionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddPermissionAsync(Model::AddPermissionRequest&& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an alias that points to the specified Lambda function version. For
          * more information, see <a
@@ -309,6 +324,18 @@ namespace Model
          */
         virtual void CreateAliasAsync(const Model::CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAliasCallable(const Model::CreateAliasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateAliasOutcomeCallable CreateAliasCallable(Model::CreateAliasRequest&& request) const;
+
+        /**
+         * Same as CreateAliasAsync(const Model::CreateAliasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateAliasAsync(Model::CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Identifies a stream as an event source for a Lambda function. It can be
          * either an Amazon Kinesis stream or an Amazon DynamoDB stream. AWS Lambda invokes
@@ -382,6 +409,18 @@ namespace Model
          */
         virtual void CreateEventSourceMappingAsync(const Model::CreateEventSourceMappingRequest& request, const CreateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateEventSourceMappingCallable(const Model::CreateEventSourceMappingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateEventSourceMappingOutcomeCallable CreateEventSourceMappingCallable(Model::CreateEventSourceMappingRequest&& request) const;
+
+        /**
+         * Same as CreateEventSourceMappingAsync(const Model::CreateEventSourceMappingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateEventSourceMappingAsync(Model::CreateEventSourceMappingRequest&& request, const CreateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new Lambda function. The function metadata is created from the
          * request parameters, and the code for the function is provided by a .zip file in
@@ -428,6 +467,18 @@ namespace Model
          */
         virtual void CreateFunctionAsync(const Model::CreateFunctionRequest& request, const CreateFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateFunctionCallable(const Model::CreateFunctionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateFunctionOutcomeCallable CreateFunctionCallable(Model::CreateFunctionRequest&& request) const;
+
+        /**
+         * Same as CreateFunctionAsync(const Model::CreateFunctionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateFunctionAsync(Model::CreateFunctionRequest&& request, const CreateFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified Lambda function alias. For more information, see <a
          * href="http://docs.aws.amazon.com/lambda/latest/dg/aliases-intro.html">Introduction
@@ -456,6 +507,18 @@ namespace Model
          */
         virtual void DeleteAliasAsync(const Model::DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAliasCallable(const Model::DeleteAliasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteAliasOutcomeCallable DeleteAliasCallable(Model::DeleteAliasRequest&& request) const;
+
+        /**
+         * Same as DeleteAliasAsync(const Model::DeleteAliasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteAliasAsync(Model::DeleteAliasRequest&& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes an event source mapping. This means AWS Lambda will no longer invoke
          * the function for events in the associated source.</p> <p>This operation requires
@@ -481,6 +544,18 @@ namespace Model
          */
         virtual void DeleteEventSourceMappingAsync(const Model::DeleteEventSourceMappingRequest& request, const DeleteEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteEventSourceMappingCallable(const Model::DeleteEventSourceMappingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteEventSourceMappingOutcomeCallable DeleteEventSourceMappingCallable(Model::DeleteEventSourceMappingRequest&& request) const;
+
+        /**
+         * Same as DeleteEventSourceMappingAsync(const Model::DeleteEventSourceMappingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteEventSourceMappingAsync(Model::DeleteEventSourceMappingRequest&& request, const DeleteEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified Lambda function code and configuration.</p> <p>If you
          * are using the versioning feature and you don't specify a function version in
@@ -533,6 +608,18 @@ namespace Model
          */
         virtual void DeleteFunctionAsync(const Model::DeleteFunctionRequest& request, const DeleteFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteFunctionCallable(const Model::DeleteFunctionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteFunctionOutcomeCallable DeleteFunctionCallable(Model::DeleteFunctionRequest&& request) const;
+
+        /**
+         * Same as DeleteFunctionAsync(const Model::DeleteFunctionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteFunctionAsync(Model::DeleteFunctionRequest&& request, const DeleteFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the specified alias information such as the alias ARN, description,
          * and function version it is pointing to. For more information, see <a
@@ -564,6 +651,18 @@ namespace Model
          */
         virtual void GetAliasAsync(const Model::GetAliasRequest& request, const GetAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAliasCallable(const Model::GetAliasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetAliasOutcomeCallable GetAliasCallable(Model::GetAliasRequest&& request) const;
+
+        /**
+         * Same as GetAliasAsync(const Model::GetAliasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetAliasAsync(Model::GetAliasRequest&& request, const GetAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns configuration information for the specified event source mapping (see
          * <a>CreateEventSourceMapping</a>).</p> <p>This operation requires permission for
@@ -589,6 +688,18 @@ namespace Model
          */
         virtual void GetEventSourceMappingAsync(const Model::GetEventSourceMappingRequest& request, const GetEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetEventSourceMappingCallable(const Model::GetEventSourceMappingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetEventSourceMappingOutcomeCallable GetEventSourceMappingCallable(Model::GetEventSourceMappingRequest&& request) const;
+
+        /**
+         * Same as GetEventSourceMappingAsync(const Model::GetEventSourceMappingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetEventSourceMappingAsync(Model::GetEventSourceMappingRequest&& request, const GetEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the configuration information of the Lambda function and a presigned
          * URL link to the .zip file you uploaded with <a>CreateFunction</a> so you can
@@ -641,6 +752,18 @@ namespace Model
          */
         virtual void GetFunctionAsync(const Model::GetFunctionRequest& request, const GetFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetFunctionCallable(const Model::GetFunctionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetFunctionOutcomeCallable GetFunctionCallable(Model::GetFunctionRequest&& request) const;
+
+        /**
+         * Same as GetFunctionAsync(const Model::GetFunctionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetFunctionAsync(Model::GetFunctionRequest&& request, const GetFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the configuration information of the Lambda function. This the same
          * information you provided as parameters when uploading the function by using
@@ -690,6 +813,18 @@ namespace Model
          */
         virtual void GetFunctionConfigurationAsync(const Model::GetFunctionConfigurationRequest& request, const GetFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetFunctionConfigurationCallable(const Model::GetFunctionConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetFunctionConfigurationOutcomeCallable GetFunctionConfigurationCallable(Model::GetFunctionConfigurationRequest&& request) const;
+
+        /**
+         * Same as GetFunctionConfigurationAsync(const Model::GetFunctionConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetFunctionConfigurationAsync(Model::GetFunctionConfigurationRequest&& request, const GetFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the resource policy associated with the specified Lambda
          * function.</p> <p> If you are using the versioning feature, you can get the
@@ -733,6 +868,18 @@ namespace Model
          */
         virtual void GetPolicyAsync(const Model::GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPolicyCallable(const Model::GetPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetPolicyOutcomeCallable GetPolicyCallable(Model::GetPolicyRequest&& request) const;
+
+        /**
+         * Same as GetPolicyAsync(const Model::GetPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetPolicyAsync(Model::GetPolicyRequest&& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Invokes a specific Lambda function.</p> <p>If you are using the versioning
          * feature, you can invoke the specific function version by providing function
@@ -782,6 +929,18 @@ namespace Model
          */
         virtual void InvokeAsync(const Model::InvokeRequest& request, const InvokeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as InvokeCallable(const Model::InvokeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::InvokeOutcomeCallable InvokeCallable(Model::InvokeRequest&& request) const;
+
+        /**
+         * Same as InvokeAsync(const Model::InvokeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void InvokeAsync(Model::InvokeRequest&& request, const InvokeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns list of aliases created for a Lambda function. For each alias, the
          * response includes information such as the alias ARN, description, alias name,
@@ -816,6 +975,18 @@ namespace Model
          */
         virtual void ListAliasesAsync(const Model::ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAliasesCallable(const Model::ListAliasesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAliasesOutcomeCallable ListAliasesCallable(Model::ListAliasesRequest&& request) const;
+
+        /**
+         * Same as ListAliasesAsync(const Model::ListAliasesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAliasesAsync(Model::ListAliasesRequest&& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of event source mappings you created using the
          * <code>CreateEventSourceMapping</code> (see <a>CreateEventSourceMapping</a>).
@@ -865,6 +1036,18 @@ namespace Model
          */
         virtual void ListEventSourceMappingsAsync(const Model::ListEventSourceMappingsRequest& request, const ListEventSourceMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListEventSourceMappingsCallable(const Model::ListEventSourceMappingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListEventSourceMappingsOutcomeCallable ListEventSourceMappingsCallable(Model::ListEventSourceMappingsRequest&& request) const;
+
+        /**
+         * Same as ListEventSourceMappingsAsync(const Model::ListEventSourceMappingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListEventSourceMappingsAsync(Model::ListEventSourceMappingsRequest&& request, const ListEventSourceMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of your Lambda functions. For each function, the response
          * includes the function configuration information. You must use <a>GetFunction</a>
@@ -905,6 +1088,18 @@ namespace Model
          */
         virtual void ListFunctionsAsync(const Model::ListFunctionsRequest& request, const ListFunctionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListFunctionsCallable(const Model::ListFunctionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListFunctionsOutcomeCallable ListFunctionsCallable(Model::ListFunctionsRequest&& request) const;
+
+        /**
+         * Same as ListFunctionsAsync(const Model::ListFunctionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListFunctionsAsync(Model::ListFunctionsRequest&& request, const ListFunctionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>List all versions of a function. For information about the versioning
          * feature, see <a
@@ -933,6 +1128,18 @@ namespace Model
          */
         virtual void ListVersionsByFunctionAsync(const Model::ListVersionsByFunctionRequest& request, const ListVersionsByFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListVersionsByFunctionCallable(const Model::ListVersionsByFunctionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListVersionsByFunctionOutcomeCallable ListVersionsByFunctionCallable(Model::ListVersionsByFunctionRequest&& request) const;
+
+        /**
+         * Same as ListVersionsByFunctionAsync(const Model::ListVersionsByFunctionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListVersionsByFunctionAsync(Model::ListVersionsByFunctionRequest&& request, const ListVersionsByFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Publishes a version of your function from the current snapshot of $LATEST.
          * That is, AWS Lambda takes a snapshot of the function code and configuration
@@ -970,6 +1177,18 @@ namespace Model
          */
         virtual void PublishVersionAsync(const Model::PublishVersionRequest& request, const PublishVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PublishVersionCallable(const Model::PublishVersionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PublishVersionOutcomeCallable PublishVersionCallable(Model::PublishVersionRequest&& request) const;
+
+        /**
+         * Same as PublishVersionAsync(const Model::PublishVersionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PublishVersionAsync(Model::PublishVersionRequest&& request, const PublishVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>You can remove individual permissions from an resource policy associated with
          * a Lambda function by providing a statement ID that you provided when you added
@@ -1019,6 +1238,18 @@ namespace Model
          */
         virtual void RemovePermissionAsync(const Model::RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemovePermissionCallable(const Model::RemovePermissionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemovePermissionOutcomeCallable RemovePermissionCallable(Model::RemovePermissionRequest&& request) const;
+
+        /**
+         * Same as RemovePermissionAsync(const Model::RemovePermissionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemovePermissionAsync(Model::RemovePermissionRequest&& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Using this API you can update the function version to which the alias points
          * and the alias description. For more information, see <a
@@ -1050,6 +1281,18 @@ namespace Model
          */
         virtual void UpdateAliasAsync(const Model::UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAliasCallable(const Model::UpdateAliasRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateAliasOutcomeCallable UpdateAliasCallable(Model::UpdateAliasRequest&& request) const;
+
+        /**
+         * Same as UpdateAliasAsync(const Model::UpdateAliasRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateAliasAsync(Model::UpdateAliasRequest&& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>You can update an event source mapping. This is useful if you want to change
          * the parameters of the existing mapping without losing your position in the
@@ -1111,6 +1354,18 @@ namespace Model
          */
         virtual void UpdateEventSourceMappingAsync(const Model::UpdateEventSourceMappingRequest& request, const UpdateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateEventSourceMappingCallable(const Model::UpdateEventSourceMappingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateEventSourceMappingOutcomeCallable UpdateEventSourceMappingCallable(Model::UpdateEventSourceMappingRequest&& request) const;
+
+        /**
+         * Same as UpdateEventSourceMappingAsync(const Model::UpdateEventSourceMappingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateEventSourceMappingAsync(Model::UpdateEventSourceMappingRequest&& request, const UpdateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the code for the specified Lambda function. This operation must only
          * be used on an existing Lambda function and cannot be used to update the function
@@ -1151,6 +1406,18 @@ namespace Model
          */
         virtual void UpdateFunctionCodeAsync(const Model::UpdateFunctionCodeRequest& request, const UpdateFunctionCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateFunctionCodeCallable(const Model::UpdateFunctionCodeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateFunctionCodeOutcomeCallable UpdateFunctionCodeCallable(Model::UpdateFunctionCodeRequest&& request) const;
+
+        /**
+         * Same as UpdateFunctionCodeAsync(const Model::UpdateFunctionCodeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateFunctionCodeAsync(Model::UpdateFunctionCodeRequest&& request, const UpdateFunctionCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the configuration parameters for the specified Lambda function by
          * using the values provided in the request. You provide only the parameters you
@@ -1194,6 +1461,155 @@ namespace Model
          */
         virtual void UpdateFunctionConfigurationAsync(const Model::UpdateFunctionConfigurationRequest& request, const UpdateFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateFunctionConfigurationCallable(const Model::UpdateFunctionConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateFunctionConfigurationOutcomeCallable UpdateFunctionConfigurationCallable(Model::UpdateFunctionConfigurationRequest&& request) const;
+
+        /**
+         * Same as UpdateFunctionConfigurationAsync(const Model::UpdateFunctionConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateFunctionConfigurationAsync(Model::UpdateFunctionConfigurationRequest&& request, const UpdateFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListAliases(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<LambdaClient, Model::ListAliasesRequest, Model::ListAliasesOutcome> ListAliasesPaginator(const Model::ListAliasesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListEventSourceMappings(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<LambdaClient, Model::ListEventSourceMappingsRequest, Model::ListEventSourceMappingsOutcome> ListEventSourceMappingsPaginator(const Model::ListEventSourceMappingsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListFunctions(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<LambdaClient, Model::ListFunctionsRequest, Model::ListFunctionsOutcome> ListFunctionsPaginator(const Model::ListFunctionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListVersionsByFunction(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<LambdaClient, Model::ListVersionsByFunctionRequest, Model::ListVersionsByFunctionOutcome> ListVersionsByFunctionPaginator(const Model::ListVersionsByFunctionRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddPermission(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::AddPermissionRequest, Model::AddPermissionOutcome> AddPermissionAwaitable(Model::AddPermissionRequest request) const;
+
+        /**
+         * co_await-able form of CreateAlias(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::CreateAliasRequest, Model::CreateAliasOutcome> CreateAliasAwaitable(Model::CreateAliasRequest request) const;
+
+        /**
+         * co_await-able form of CreateEventSourceMapping(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::CreateEventSourceMappingRequest, Model::CreateEventSourceMappingOutcome> CreateEventSourceMappingAwaitable(Model::CreateEventSourceMappingRequest request) const;
+
+        /**
+         * co_await-able form of CreateFunction(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::CreateFunctionRequest, Model::CreateFunctionOutcome> CreateFunctionAwaitable(Model::CreateFunctionRequest request) const;
+
+        /**
+         * co_await-able form of DeleteAlias(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::DeleteAliasRequest, Model::DeleteAliasOutcome> DeleteAliasAwaitable(Model::DeleteAliasRequest request) const;
+
+        /**
+         * co_await-able form of DeleteEventSourceMapping(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::DeleteEventSourceMappingRequest, Model::DeleteEventSourceMappingOutcome> DeleteEventSourceMappingAwaitable(Model::DeleteEventSourceMappingRequest request) const;
+
+        /**
+         * co_await-able form of DeleteFunction(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::DeleteFunctionRequest, Model::DeleteFunctionOutcome> DeleteFunctionAwaitable(Model::DeleteFunctionRequest request) const;
+
+        /**
+         * co_await-able form of GetAlias(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::GetAliasRequest, Model::GetAliasOutcome> GetAliasAwaitable(Model::GetAliasRequest request) const;
+
+        /**
+         * co_await-able form of GetEventSourceMapping(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::GetEventSourceMappingRequest, Model::GetEventSourceMappingOutcome> GetEventSourceMappingAwaitable(Model::GetEventSourceMappingRequest request) const;
+
+        /**
+         * co_await-able form of GetFunction(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::GetFunctionRequest, Model::GetFunctionOutcome> GetFunctionAwaitable(Model::GetFunctionRequest request) const;
+
+        /**
+         * co_await-able form of GetFunctionConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::GetFunctionConfigurationRequest, Model::GetFunctionConfigurationOutcome> GetFunctionConfigurationAwaitable(Model::GetFunctionConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of GetPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::GetPolicyRequest, Model::GetPolicyOutcome> GetPolicyAwaitable(Model::GetPolicyRequest request) const;
+
+        /**
+         * co_await-able form of Invoke(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::InvokeRequest, Model::InvokeOutcome> InvokeAwaitable(Model::InvokeRequest request) const;
+
+        /**
+         * co_await-able form of ListAliases(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::ListAliasesRequest, Model::ListAliasesOutcome> ListAliasesAwaitable(Model::ListAliasesRequest request) const;
+
+        /**
+         * co_await-able form of ListEventSourceMappings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::ListEventSourceMappingsRequest, Model::ListEventSourceMappingsOutcome> ListEventSourceMappingsAwaitable(Model::ListEventSourceMappingsRequest request) const;
+
+        /**
+         * co_await-able form of ListFunctions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::ListFunctionsRequest, Model::ListFunctionsOutcome> ListFunctionsAwaitable(Model::ListFunctionsRequest request) const;
+
+        /**
+         * co_await-able form of ListVersionsByFunction(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::ListVersionsByFunctionRequest, Model::ListVersionsByFunctionOutcome> ListVersionsByFunctionAwaitable(Model::ListVersionsByFunctionRequest request) const;
+
+        /**
+         * co_await-able form of PublishVersion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::PublishVersionRequest, Model::PublishVersionOutcome> PublishVersionAwaitable(Model::PublishVersionRequest request) const;
+
+        /**
+         * co_await-able form of RemovePermission(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::RemovePermissionRequest, Model::RemovePermissionOutcome> RemovePermissionAwaitable(Model::RemovePermissionRequest request) const;
+
+        /**
+         * co_await-able form of UpdateAlias(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::UpdateAliasRequest, Model::UpdateAliasOutcome> UpdateAliasAwaitable(Model::UpdateAliasRequest request) const;
+
+        /**
+         * co_await-able form of UpdateEventSourceMapping(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::UpdateEventSourceMappingRequest, Model::UpdateEventSourceMappingOutcome> UpdateEventSourceMappingAwaitable(Model::UpdateEventSourceMappingRequest request) const;
+
+        /**
+         * co_await-able form of UpdateFunctionCode(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::UpdateFunctionCodeRequest, Model::UpdateFunctionCodeOutcome> UpdateFunctionCodeAwaitable(Model::UpdateFunctionCodeRequest request) const;
+
+        /**
+         * co_await-able form of UpdateFunctionConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<LambdaClient, Model::UpdateFunctionConfigurationRequest, Model::UpdateFunctionConfigurationOutcome> UpdateFunctionConfigurationAwaitable(Model::UpdateFunctionConfigurationRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     AddPermissionRequest();
+    inline const char* GetServiceRequestName() const override { return "AddPermission"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
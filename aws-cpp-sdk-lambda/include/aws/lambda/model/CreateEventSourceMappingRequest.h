@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateEventSourceMappingRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateEventSourceMapping"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateFunctionRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateFunction"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteEventSourceMappingRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteEventSourceMapping"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     DeleteFunctionRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteFunction"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetAliasRequest();
+    inline const char* GetServiceRequestName() const override { return "GetAlias"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetEventSourceMappingRequest();
+    inline const char* GetServiceRequestName() const override { return "GetEventSourceMapping"; }
+
     Aws::String SerializePayload() const override;
 
     /**
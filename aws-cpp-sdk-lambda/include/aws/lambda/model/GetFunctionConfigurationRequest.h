@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     GetFunctionConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "GetFunctionConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
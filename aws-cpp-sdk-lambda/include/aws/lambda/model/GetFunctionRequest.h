@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     GetFunctionRequest();
+    inline const char* GetServiceRequestName() const override { return "GetFunction"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
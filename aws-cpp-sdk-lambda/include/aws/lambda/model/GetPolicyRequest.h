@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     GetPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
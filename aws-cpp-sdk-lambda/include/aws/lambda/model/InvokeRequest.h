@@ -38,6 +38,8 @@ namespace Model
   {
   public:
     InvokeRequest();
+    inline const char* GetServiceRequestName() const override { return "Invoke"; }
+
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
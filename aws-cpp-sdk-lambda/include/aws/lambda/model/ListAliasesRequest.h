@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     ListAliasesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListAliases"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListEventSourceMappingsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListEventSourceMappings"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
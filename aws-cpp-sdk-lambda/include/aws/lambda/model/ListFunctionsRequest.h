@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListFunctionsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListFunctions"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListVersionsByFunctionRequest();
+    inline const char* GetServiceRequestName() const override { return "ListVersionsByFunction"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
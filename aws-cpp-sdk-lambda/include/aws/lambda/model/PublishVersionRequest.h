@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PublishVersionRequest();
+    inline const char* GetServiceRequestName() const override { return "PublishVersion"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     RemovePermissionRequest();
+    inline const char* GetServiceRequestName() const override { return "RemovePermission"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
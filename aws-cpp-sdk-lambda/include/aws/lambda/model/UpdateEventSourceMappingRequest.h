@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateEventSourceMappingRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateEventSourceMapping"; }
+
     Aws::String SerializePayload() const override;
 
     /**
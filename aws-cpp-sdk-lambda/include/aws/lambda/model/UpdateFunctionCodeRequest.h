@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateFunctionCodeRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateFunctionCode"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateFunctionConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateFunctionConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -134,7 +134,7 @@ AddPermissionOutcome LambdaClient::AddPermission(const AddPermissionRequest& req
 
 AddPermissionOutcomeCallable LambdaClient::AddPermissionCallable(const AddPermissionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddPermission(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddPermission(request); } );
 }
 
 void LambdaClient::AddPermissionAsync(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -142,6 +142,16 @@ void LambdaClient::AddPermissionAsync(const AddPermissionRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->AddPermissionAsyncHelper( request, handler, context ); } );
 }
 
+AddPermissionOutcomeCallable LambdaClient::AddPermissionCallable(AddPermissionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::AddPermission, this, std::move(request)));
+}
+
+void LambdaClient::AddPermissionAsync(AddPermissionRequest&& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::AddPermissionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::AddPermissionAsyncHelper(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddPermission(request), context);
@@ -167,7 +177,7 @@ CreateAliasOutcome LambdaClient::CreateAlias(const CreateAliasRequest& request)
 
 CreateAliasOutcomeCallable LambdaClient::CreateAliasCallable(const CreateAliasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateAlias(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateAlias(request); } );
 }
 
 void LambdaClient::CreateAliasAsync(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -175,6 +185,16 @@ void LambdaClient::CreateAliasAsync(const CreateAliasRequest& request, const Cre
   m_executor->Submit( [this, request, handler, context](){ this->CreateAliasAsyncHelper( request, handler, context ); } );
 }
 
+CreateAliasOutcomeCallable LambdaClient::CreateAliasCallable(CreateAliasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::CreateAlias, this, std::move(request)));
+}
+
+void LambdaClient::CreateAliasAsync(CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::CreateAliasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::CreateAliasAsyncHelper(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateAlias(request), context);
@@ -198,7 +218,7 @@ CreateEventSourceMappingOutcome LambdaClient::CreateEventSourceMapping(const Cre
 
 CreateEventSourceMappingOutcomeCallable LambdaClient::CreateEventSourceMappingCallable(const CreateEventSourceMappingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateEventSourceMapping(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateEventSourceMapping(request); } );
 }
 
 void LambdaClient::CreateEventSourceMappingAsync(const CreateEventSourceMappingRequest& request, const CreateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -206,6 +226,16 @@ void LambdaClient::CreateEventSourceMappingAsync(const CreateEventSourceMappingR
   m_executor->Submit( [this, request, handler, context](){ this->CreateEventSourceMappingAsyncHelper( request, handler, context ); } );
 }
 
+CreateEventSourceMappingOutcomeCallable LambdaClient::CreateEventSourceMappingCallable(CreateEventSourceMappingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::CreateEventSourceMapping, this, std::move(request)));
+}
+
+void LambdaClient::CreateEventSourceMappingAsync(CreateEventSourceMappingRequest&& request, const CreateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::CreateEventSourceMappingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::CreateEventSourceMappingAsyncHelper(const CreateEventSourceMappingRequest& request, const CreateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateEventSourceMapping(request), context);
@@ -229,7 +259,7 @@ CreateFunctionOutcome LambdaClient::CreateFunction(const CreateFunctionRequest&
 
 CreateFunctionOutcomeCallable LambdaClient::CreateFunctionCallable(const CreateFunctionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateFunction(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateFunction(request); } );
 }
 
 void LambdaClient::CreateFunctionAsync(const CreateFunctionRequest& request, const CreateFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -237,6 +267,16 @@ void LambdaClient::CreateFunctionAsync(const CreateFunctionRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->CreateFunctionAsyncHelper( request, handler, context ); } );
 }
 
+CreateFunctionOutcomeCallable LambdaClient::CreateFunctionCallable(CreateFunctionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::CreateFunction, this, std::move(request)));
+}
+
+void LambdaClient::CreateFunctionAsync(CreateFunctionRequest&& request, const CreateFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::CreateFunctionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::CreateFunctionAsyncHelper(const CreateFunctionRequest& request, const CreateFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateFunction(request), context);
@@ -263,7 +303,7 @@ DeleteAliasOutcome LambdaClient::DeleteAlias(const DeleteAliasRequest& request)
 
 DeleteAliasOutcomeCallable LambdaClient::DeleteAliasCallable(const DeleteAliasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteAlias(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteAlias(request); } );
 }
 
 void LambdaClient::DeleteAliasAsync(const DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -271,6 +311,16 @@ void LambdaClient::DeleteAliasAsync(const DeleteAliasRequest& request, const Del
   m_executor->Submit( [this, request, handler, context](){ this->DeleteAliasAsyncHelper( request, handler, context ); } );
 }
 
+DeleteAliasOutcomeCallable LambdaClient::DeleteAliasCallable(DeleteAliasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::DeleteAlias, this, std::move(request)));
+}
+
+void LambdaClient::DeleteAliasAsync(DeleteAliasRequest&& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::DeleteAliasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::DeleteAliasAsyncHelper(const DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteAlias(request), context);
@@ -295,7 +345,7 @@ DeleteEventSourceMappingOutcome LambdaClient::DeleteEventSourceMapping(const Del
 
 DeleteEventSourceMappingOutcomeCallable LambdaClient::DeleteEventSourceMappingCallable(const DeleteEventSourceMappingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteEventSourceMapping(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteEventSourceMapping(request); } );
 }
 
 void LambdaClient::DeleteEventSourceMappingAsync(const DeleteEventSourceMappingRequest& request, const DeleteEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -303,6 +353,16 @@ void LambdaClient::DeleteEventSourceMappingAsync(const DeleteEventSourceMappingR
   m_executor->Submit( [this, request, handler, context](){ this->DeleteEventSourceMappingAsyncHelper( request, handler, context ); } );
 }
 
+DeleteEventSourceMappingOutcomeCallable LambdaClient::DeleteEventSourceMappingCallable(DeleteEventSourceMappingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::DeleteEventSourceMapping, this, std::move(request)));
+}
+
+void LambdaClient::DeleteEventSourceMappingAsync(DeleteEventSourceMappingRequest&& request, const DeleteEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::DeleteEventSourceMappingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::DeleteEventSourceMappingAsyncHelper(const DeleteEventSourceMappingRequest& request, const DeleteEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteEventSourceMapping(request), context);
@@ -327,7 +387,7 @@ DeleteFunctionOutcome LambdaClient::DeleteFunction(const DeleteFunctionRequest&
 
 DeleteFunctionOutcomeCallable LambdaClient::DeleteFunctionCallable(const DeleteFunctionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteFunction(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteFunction(request); } );
 }
 
 void LambdaClient::DeleteFunctionAsync(const DeleteFunctionRequest& request, const DeleteFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -335,6 +395,16 @@ void LambdaClient::DeleteFunctionAsync(const DeleteFunctionRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->DeleteFunctionAsyncHelper( request, handler, context ); } );
 }
 
+DeleteFunctionOutcomeCallable LambdaClient::DeleteFunctionCallable(DeleteFunctionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::DeleteFunction, this, std::move(request)));
+}
+
+void LambdaClient::DeleteFunctionAsync(DeleteFunctionRequest&& request, const DeleteFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::DeleteFunctionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::DeleteFunctionAsyncHelper(const DeleteFunctionRequest& request, const DeleteFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteFunction(request), context);
@@ -361,7 +431,7 @@ GetAliasOutcome LambdaClient::GetAlias(const GetAliasRequest& request) const
 
 GetAliasOutcomeCallable LambdaClient::GetAliasCallable(const GetAliasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetAlias(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetAlias(request); } );
 }
 
 void LambdaClient::GetAliasAsync(const GetAliasRequest& request, const GetAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -369,6 +439,16 @@ void LambdaClient::GetAliasAsync(const GetAliasRequest& request, const GetAliasR
   m_executor->Submit( [this, request, handler, context](){ this->GetAliasAsyncHelper( request, handler, context ); } );
 }
 
+GetAliasOutcomeCallable LambdaClient::GetAliasCallable(GetAliasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::GetAlias, this, std::move(request)));
+}
+
+void LambdaClient::GetAliasAsync(GetAliasRequest&& request, const GetAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::GetAliasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::GetAliasAsyncHelper(const GetAliasRequest& request, const GetAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetAlias(request), context);
@@ -393,7 +473,7 @@ GetEventSourceMappingOutcome LambdaClient::GetEventSourceMapping(const GetEventS
 
 GetEventSourceMappingOutcomeCallable LambdaClient::GetEventSourceMappingCallable(const GetEventSourceMappingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetEventSourceMapping(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetEventSourceMapping(request); } );
 }
 
 void LambdaClient::GetEventSourceMappingAsync(const GetEventSourceMappingRequest& request, const GetEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -401,6 +481,16 @@ void LambdaClient::GetEventSourceMappingAsync(const GetEventSourceMappingRequest
   m_executor->Submit( [this, request, handler, context](){ this->GetEventSourceMappingAsyncHelper( request, handler, context ); } );
 }
 
+GetEventSourceMappingOutcomeCallable LambdaClient::GetEventSourceMappingCallable(GetEventSourceMappingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::GetEventSourceMapping, this, std::move(request)));
+}
+
+void LambdaClient::GetEventSourceMappingAsync(GetEventSourceMappingRequest&& request, const GetEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::GetEventSourceMappingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::GetEventSourceMappingAsyncHelper(const GetEventSourceMappingRequest& request, const GetEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetEventSourceMapping(request), context);
@@ -425,7 +515,7 @@ GetFunctionOutcome LambdaClient::GetFunction(const GetFunctionRequest& request)
 
 GetFunctionOutcomeCallable LambdaClient::GetFunctionCallable(const GetFunctionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetFunction(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetFunction(request); } );
 }
 
 void LambdaClient::GetFunctionAsync(const GetFunctionRequest& request, const GetFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -433,6 +523,16 @@ void LambdaClient::GetFunctionAsync(const GetFunctionRequest& request, const Get
   m_executor->Submit( [this, request, handler, context](){ this->GetFunctionAsyncHelper( request, handler, context ); } );
 }
 
+GetFunctionOutcomeCallable LambdaClient::GetFunctionCallable(GetFunctionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::GetFunction, this, std::move(request)));
+}
+
+void LambdaClient::GetFunctionAsync(GetFunctionRequest&& request, const GetFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::GetFunctionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::GetFunctionAsyncHelper(const GetFunctionRequest& request, const GetFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetFunction(request), context);
@@ -458,7 +558,7 @@ GetFunctionConfigurationOutcome LambdaClient::GetFunctionConfiguration(const Get
 
 GetFunctionConfigurationOutcomeCallable LambdaClient::GetFunctionConfigurationCallable(const GetFunctionConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetFunctionConfiguration(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetFunctionConfiguration(request); } );
 }
 
 void LambdaClient::GetFunctionConfigurationAsync(const GetFunctionConfigurationRequest& request, const GetFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -466,6 +566,16 @@ void LambdaClient::GetFunctionConfigurationAsync(const GetFunctionConfigurationR
   m_executor->Submit( [this, request, handler, context](){ this->GetFunctionConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+GetFunctionConfigurationOutcomeCallable LambdaClient::GetFunctionConfigurationCallable(GetFunctionConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::GetFunctionConfiguration, this, std::move(request)));
+}
+
+void LambdaClient::GetFunctionConfigurationAsync(GetFunctionConfigurationRequest&& request, const GetFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::GetFunctionConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::GetFunctionConfigurationAsyncHelper(const GetFunctionConfigurationRequest& request, const GetFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetFunctionConfiguration(request), context);
@@ -491,7 +601,7 @@ GetPolicyOutcome LambdaClient::GetPolicy(const GetPolicyRequest& request) const
 
 GetPolicyOutcomeCallable LambdaClient::GetPolicyCallable(const GetPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetPolicy(request); } );
 }
 
 void LambdaClient::GetPolicyAsync(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -499,6 +609,16 @@ void LambdaClient::GetPolicyAsync(const GetPolicyRequest& request, const GetPoli
   m_executor->Submit( [this, request, handler, context](){ this->GetPolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetPolicyOutcomeCallable LambdaClient::GetPolicyCallable(GetPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::GetPolicy, this, std::move(request)));
+}
+
+void LambdaClient::GetPolicyAsync(GetPolicyRequest&& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::GetPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::GetPolicyAsyncHelper(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetPolicy(request), context);
@@ -524,7 +644,7 @@ InvokeOutcome LambdaClient::Invoke(const InvokeRequest& request) const
 
 InvokeOutcomeCallable LambdaClient::InvokeCallable(const InvokeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->Invoke(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->Invoke(request); } );
 }
 
 void LambdaClient::InvokeAsync(const InvokeRequest& request, const InvokeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -532,6 +652,16 @@ void LambdaClient::InvokeAsync(const InvokeRequest& request, const InvokeRespons
   m_executor->Submit( [this, request, handler, context](){ this->InvokeAsyncHelper( request, handler, context ); } );
 }
 
+InvokeOutcomeCallable LambdaClient::InvokeCallable(InvokeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::Invoke, this, std::move(request)));
+}
+
+void LambdaClient::InvokeAsync(InvokeRequest&& request, const InvokeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::InvokeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::InvokeAsyncHelper(const InvokeRequest& request, const InvokeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, Invoke(request), context);
@@ -557,7 +687,7 @@ ListAliasesOutcome LambdaClient::ListAliases(const ListAliasesRequest& request)
 
 ListAliasesOutcomeCallable LambdaClient::ListAliasesCallable(const ListAliasesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAliases(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAliases(request); } );
 }
 
 void LambdaClient::ListAliasesAsync(const ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -565,6 +695,16 @@ void LambdaClient::ListAliasesAsync(const ListAliasesRequest& request, const Lis
   m_executor->Submit( [this, request, handler, context](){ this->ListAliasesAsyncHelper( request, handler, context ); } );
 }
 
+ListAliasesOutcomeCallable LambdaClient::ListAliasesCallable(ListAliasesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::ListAliases, this, std::move(request)));
+}
+
+void LambdaClient::ListAliasesAsync(ListAliasesRequest&& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::ListAliasesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::ListAliasesAsyncHelper(const ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAliases(request), context);
@@ -588,7 +728,7 @@ ListEventSourceMappingsOutcome LambdaClient::ListEventSourceMappings(const ListE
 
 ListEventSourceMappingsOutcomeCallable LambdaClient::ListEventSourceMappingsCallable(const ListEventSourceMappingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListEventSourceMappings(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListEventSourceMappings(request); } );
 }
 
 void LambdaClient::ListEventSourceMappingsAsync(const ListEventSourceMappingsRequest& request, const ListEventSourceMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -596,6 +736,16 @@ void LambdaClient::ListEventSourceMappingsAsync(const ListEventSourceMappingsReq
   m_executor->Submit( [this, request, handler, context](){ this->ListEventSourceMappingsAsyncHelper( request, handler, context ); } );
 }
 
+ListEventSourceMappingsOutcomeCallable LambdaClient::ListEventSourceMappingsCallable(ListEventSourceMappingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::ListEventSourceMappings, this, std::move(request)));
+}
+
+void LambdaClient::ListEventSourceMappingsAsync(ListEventSourceMappingsRequest&& request, const ListEventSourceMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::ListEventSourceMappingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::ListEventSourceMappingsAsyncHelper(const ListEventSourceMappingsRequest& request, const ListEventSourceMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListEventSourceMappings(request), context);
@@ -619,7 +769,7 @@ ListFunctionsOutcome LambdaClient::ListFunctions(const ListFunctionsRequest& req
 
 ListFunctionsOutcomeCallable LambdaClient::ListFunctionsCallable(const ListFunctionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListFunctions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListFunctions(request); } );
 }
 
 void LambdaClient::ListFunctionsAsync(const ListFunctionsRequest& request, const ListFunctionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -627,6 +777,16 @@ void LambdaClient::ListFunctionsAsync(const ListFunctionsRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ListFunctionsAsyncHelper( request, handler, context ); } );
 }
 
+ListFunctionsOutcomeCallable LambdaClient::ListFunctionsCallable(ListFunctionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::ListFunctions, this, std::move(request)));
+}
+
+void LambdaClient::ListFunctionsAsync(ListFunctionsRequest&& request, const ListFunctionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::ListFunctionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::ListFunctionsAsyncHelper(const ListFunctionsRequest& request, const ListFunctionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListFunctions(request), context);
@@ -652,7 +812,7 @@ ListVersionsByFunctionOutcome LambdaClient::ListVersionsByFunction(const ListVer
 
 ListVersionsByFunctionOutcomeCallable LambdaClient::ListVersionsByFunctionCallable(const ListVersionsByFunctionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListVersionsByFunction(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListVersionsByFunction(request); } );
 }
 
 void LambdaClient::ListVersionsByFunctionAsync(const ListVersionsByFunctionRequest& request, const ListVersionsByFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -660,6 +820,16 @@ void LambdaClient::ListVersionsByFunctionAsync(const ListVersionsByFunctionReque
   m_executor->Submit( [this, request, handler, context](){ this->ListVersionsByFunctionAsyncHelper( request, handler, context ); } );
 }
 
+ListVersionsByFunctionOutcomeCallable LambdaClient::ListVersionsByFunctionCallable(ListVersionsByFunctionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::ListVersionsByFunction, this, std::move(request)));
+}
+
+void LambdaClient::ListVersionsByFunctionAsync(ListVersionsByFunctionRequest&& request, const ListVersionsByFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::ListVersionsByFunctionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::ListVersionsByFunctionAsyncHelper(const ListVersionsByFunctionRequest& request, const ListVersionsByFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListVersionsByFunction(request), context);
@@ -685,7 +855,7 @@ PublishVersionOutcome LambdaClient::PublishVersion(const PublishVersionRequest&
 
 PublishVersionOutcomeCallable LambdaClient::PublishVersionCallable(const PublishVersionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PublishVersion(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PublishVersion(request); } );
 }
 
 void LambdaClient::PublishVersionAsync(const PublishVersionRequest& request, const PublishVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -693,6 +863,16 @@ void LambdaClient::PublishVersionAsync(const PublishVersionRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->PublishVersionAsyncHelper( request, handler, context ); } );
 }
 
+PublishVersionOutcomeCallable LambdaClient::PublishVersionCallable(PublishVersionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::PublishVersion, this, std::move(request)));
+}
+
+void LambdaClient::PublishVersionAsync(PublishVersionRequest&& request, const PublishVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::PublishVersionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::PublishVersionAsyncHelper(const PublishVersionRequest& request, const PublishVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PublishVersion(request), context);
@@ -719,7 +899,7 @@ RemovePermissionOutcome LambdaClient::RemovePermission(const RemovePermissionReq
 
 RemovePermissionOutcomeCallable LambdaClient::RemovePermissionCallable(const RemovePermissionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemovePermission(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemovePermission(request); } );
 }
 
 void LambdaClient::RemovePermissionAsync(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -727,6 +907,16 @@ void LambdaClient::RemovePermissionAsync(const RemovePermissionRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->RemovePermissionAsyncHelper( request, handler, context ); } );
 }
 
+RemovePermissionOutcomeCallable LambdaClient::RemovePermissionCallable(RemovePermissionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::RemovePermission, this, std::move(request)));
+}
+
+void LambdaClient::RemovePermissionAsync(RemovePermissionRequest&& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::RemovePermissionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::RemovePermissionAsyncHelper(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemovePermission(request), context);
@@ -753,7 +943,7 @@ UpdateAliasOutcome LambdaClient::UpdateAlias(const UpdateAliasRequest& request)
 
 UpdateAliasOutcomeCallable LambdaClient::UpdateAliasCallable(const UpdateAliasRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateAlias(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateAlias(request); } );
 }
 
 void LambdaClient::UpdateAliasAsync(const UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -761,6 +951,16 @@ void LambdaClient::UpdateAliasAsync(const UpdateAliasRequest& request, const Upd
   m_executor->Submit( [this, request, handler, context](){ this->UpdateAliasAsyncHelper( request, handler, context ); } );
 }
 
+UpdateAliasOutcomeCallable LambdaClient::UpdateAliasCallable(UpdateAliasRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::UpdateAlias, this, std::move(request)));
+}
+
+void LambdaClient::UpdateAliasAsync(UpdateAliasRequest&& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::UpdateAliasAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::UpdateAliasAsyncHelper(const UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateAlias(request), context);
@@ -785,7 +985,7 @@ UpdateEventSourceMappingOutcome LambdaClient::UpdateEventSourceMapping(const Upd
 
 UpdateEventSourceMappingOutcomeCallable LambdaClient::UpdateEventSourceMappingCallable(const UpdateEventSourceMappingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateEventSourceMapping(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateEventSourceMapping(request); } );
 }
 
 void LambdaClient::UpdateEventSourceMappingAsync(const UpdateEventSourceMappingRequest& request, const UpdateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -793,6 +993,16 @@ void LambdaClient::UpdateEventSourceMappingAsync(const UpdateEventSourceMappingR
   m_executor->Submit( [this, request, handler, context](){ this->UpdateEventSourceMappingAsyncHelper( request, handler, context ); } );
 }
 
+UpdateEventSourceMappingOutcomeCallable LambdaClient::UpdateEventSourceMappingCallable(UpdateEventSourceMappingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::UpdateEventSourceMapping, this, std::move(request)));
+}
+
+void LambdaClient::UpdateEventSourceMappingAsync(UpdateEventSourceMappingRequest&& request, const UpdateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::UpdateEventSourceMappingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::UpdateEventSourceMappingAsyncHelper(const UpdateEventSourceMappingRequest& request, const UpdateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateEventSourceMapping(request), context);
@@ -818,7 +1028,7 @@ UpdateFunctionCodeOutcome LambdaClient::UpdateFunctionCode(const UpdateFunctionC
 
 UpdateFunctionCodeOutcomeCallable LambdaClient::UpdateFunctionCodeCallable(const UpdateFunctionCodeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateFunctionCode(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateFunctionCode(request); } );
 }
 
 void LambdaClient::UpdateFunctionCodeAsync(const UpdateFunctionCodeRequest& request, const UpdateFunctionCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -826,6 +1036,16 @@ void LambdaClient::UpdateFunctionCodeAsync(const UpdateFunctionCodeRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->UpdateFunctionCodeAsyncHelper( request, handler, context ); } );
 }
 
+UpdateFunctionCodeOutcomeCallable LambdaClient::UpdateFunctionCodeCallable(UpdateFunctionCodeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::UpdateFunctionCode, this, std::move(request)));
+}
+
+void LambdaClient::UpdateFunctionCodeAsync(UpdateFunctionCodeRequest&& request, const UpdateFunctionCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::UpdateFunctionCodeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::UpdateFunctionCodeAsyncHelper(const UpdateFunctionCodeRequest& request, const UpdateFunctionCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateFunctionCode(request), context);
@@ -851,7 +1071,7 @@ UpdateFunctionConfigurationOutcome LambdaClient::UpdateFunctionConfiguration(con
 
 UpdateFunctionConfigurationOutcomeCallable LambdaClient::UpdateFunctionConfigurationCallable(const UpdateFunctionConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateFunctionConfiguration(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateFunctionConfiguration(request); } );
 }
 
 void LambdaClient::UpdateFunctionConfigurationAsync(const UpdateFunctionConfigurationRequest& request, const UpdateFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -859,8 +1079,203 @@ void LambdaClient::UpdateFunctionConfigurationAsync(const UpdateFunctionConfigur
   m_executor->Submit( [this, request, handler, context](){ this->UpdateFunctionConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+UpdateFunctionConfigurationOutcomeCallable LambdaClient::UpdateFunctionConfigurationCallable(UpdateFunctionConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&LambdaClient::UpdateFunctionConfiguration, this, std::move(request)));
+}
+
+void LambdaClient::UpdateFunctionConfigurationAsync(UpdateFunctionConfigurationRequest&& request, const UpdateFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&LambdaClient::UpdateFunctionConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void LambdaClient::UpdateFunctionConfigurationAsyncHelper(const UpdateFunctionConfigurationRequest& request, const UpdateFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateFunctionConfiguration(request), context);
 }
 
+Paginator<LambdaClient, ListAliasesRequest, ListAliasesOutcome> LambdaClient::ListAliasesPaginator(const ListAliasesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<LambdaClient, ListAliasesRequest, ListAliasesOutcome>(this, &LambdaClient::ListAliases, request,
+    [](const ListAliasesRequest& current, const ListAliasesOutcome& outcome, ListAliasesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<LambdaClient, ListEventSourceMappingsRequest, ListEventSourceMappingsOutcome> LambdaClient::ListEventSourceMappingsPaginator(const ListEventSourceMappingsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<LambdaClient, ListEventSourceMappingsRequest, ListEventSourceMappingsOutcome>(this, &LambdaClient::ListEventSourceMappings, request,
+    [](const ListEventSourceMappingsRequest& current, const ListEventSourceMappingsOutcome& outcome, ListEventSourceMappingsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<LambdaClient, ListFunctionsRequest, ListFunctionsOutcome> LambdaClient::ListFunctionsPaginator(const ListFunctionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<LambdaClient, ListFunctionsRequest, ListFunctionsOutcome>(this, &LambdaClient::ListFunctions, request,
+    [](const ListFunctionsRequest& current, const ListFunctionsOutcome& outcome, ListFunctionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<LambdaClient, ListVersionsByFunctionRequest, ListVersionsByFunctionOutcome> LambdaClient::ListVersionsByFunctionPaginator(const ListVersionsByFunctionRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<LambdaClient, ListVersionsByFunctionRequest, ListVersionsByFunctionOutcome>(this, &LambdaClient::ListVersionsByFunction, request,
+    [](const ListVersionsByFunctionRequest& current, const ListVersionsByFunctionOutcome& outcome, ListVersionsByFunctionRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<LambdaClient, AddPermissionRequest, AddPermissionOutcome> LambdaClient::AddPermissionAwaitable(AddPermissionRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::AddPermission, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, CreateAliasRequest, CreateAliasOutcome> LambdaClient::CreateAliasAwaitable(CreateAliasRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::CreateAlias, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, CreateEventSourceMappingRequest, CreateEventSourceMappingOutcome> LambdaClient::CreateEventSourceMappingAwaitable(CreateEventSourceMappingRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::CreateEventSourceMapping, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, CreateFunctionRequest, CreateFunctionOutcome> LambdaClient::CreateFunctionAwaitable(CreateFunctionRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::CreateFunction, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, DeleteAliasRequest, DeleteAliasOutcome> LambdaClient::DeleteAliasAwaitable(DeleteAliasRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::DeleteAlias, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, DeleteEventSourceMappingRequest, DeleteEventSourceMappingOutcome> LambdaClient::DeleteEventSourceMappingAwaitable(DeleteEventSourceMappingRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::DeleteEventSourceMapping, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, DeleteFunctionRequest, DeleteFunctionOutcome> LambdaClient::DeleteFunctionAwaitable(DeleteFunctionRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::DeleteFunction, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, GetAliasRequest, GetAliasOutcome> LambdaClient::GetAliasAwaitable(GetAliasRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::GetAlias, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, GetEventSourceMappingRequest, GetEventSourceMappingOutcome> LambdaClient::GetEventSourceMappingAwaitable(GetEventSourceMappingRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::GetEventSourceMapping, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, GetFunctionRequest, GetFunctionOutcome> LambdaClient::GetFunctionAwaitable(GetFunctionRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::GetFunction, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, GetFunctionConfigurationRequest, GetFunctionConfigurationOutcome> LambdaClient::GetFunctionConfigurationAwaitable(GetFunctionConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::GetFunctionConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, GetPolicyRequest, GetPolicyOutcome> LambdaClient::GetPolicyAwaitable(GetPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::GetPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, InvokeRequest, InvokeOutcome> LambdaClient::InvokeAwaitable(InvokeRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::Invoke, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, ListAliasesRequest, ListAliasesOutcome> LambdaClient::ListAliasesAwaitable(ListAliasesRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::ListAliases, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, ListEventSourceMappingsRequest, ListEventSourceMappingsOutcome> LambdaClient::ListEventSourceMappingsAwaitable(ListEventSourceMappingsRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::ListEventSourceMappings, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, ListFunctionsRequest, ListFunctionsOutcome> LambdaClient::ListFunctionsAwaitable(ListFunctionsRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::ListFunctions, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, ListVersionsByFunctionRequest, ListVersionsByFunctionOutcome> LambdaClient::ListVersionsByFunctionAwaitable(ListVersionsByFunctionRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::ListVersionsByFunction, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, PublishVersionRequest, PublishVersionOutcome> LambdaClient::PublishVersionAwaitable(PublishVersionRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::PublishVersion, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, RemovePermissionRequest, RemovePermissionOutcome> LambdaClient::RemovePermissionAwaitable(RemovePermissionRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::RemovePermission, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, UpdateAliasRequest, UpdateAliasOutcome> LambdaClient::UpdateAliasAwaitable(UpdateAliasRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::UpdateAlias, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, UpdateEventSourceMappingRequest, UpdateEventSourceMappingOutcome> LambdaClient::UpdateEventSourceMappingAwaitable(UpdateEventSourceMappingRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::UpdateEventSourceMapping, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, UpdateFunctionCodeRequest, UpdateFunctionCodeOutcome> LambdaClient::UpdateFunctionCodeAwaitable(UpdateFunctionCodeRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::UpdateFunctionCode, std::move(request) } };
+}
+
+ClientOperationAwaitable<LambdaClient, UpdateFunctionConfigurationRequest, UpdateFunctionConfigurationOutcome> LambdaClient::UpdateFunctionConfigurationAwaitable(UpdateFunctionConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &LambdaClient::UpdateFunctionConfiguration, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,21 +29,29 @@ namespace Aws
       namespace EventSourcePositionMapper
       {
 
-        static const int TRIM_HORIZON_HASH = HashingUtils::HashString("TRIM_HORIZON");
-        static const int LATEST_HASH = HashingUtils::HashString("LATEST");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int TRIM_HORIZON_HASH = 1909941854;
+        static const int LATEST_HASH = -2056551545;
 
 
         EventSourcePosition GetEventSourcePositionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRIM_HORIZON_HASH)
+          switch (hashCode)
           {
+          case TRIM_HORIZON_HASH:
             return EventSourcePosition::TRIM_HORIZON;
-          }
-          else if (hashCode == LATEST_HASH)
-          {
+          case LATEST_HASH:
             return EventSourcePosition::LATEST;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
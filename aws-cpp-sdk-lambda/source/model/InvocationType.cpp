@@ -29,26 +29,32 @@ namespace Aws
       namespace InvocationTypeMapper
       {
 
-        static const int Event_HASH = HashingUtils::HashString("Event");
-        static const int RequestResponse_HASH = HashingUtils::HashString("RequestResponse");
-        static const int DryRun_HASH = HashingUtils::HashString("DryRun");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Event_HASH = 67338874;
+        static const int RequestResponse_HASH = 1251681232;
+        static const int DryRun_HASH = 2055750912;
 
 
         InvocationType GetInvocationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Event_HASH)
+          switch (hashCode)
           {
+          case Event_HASH:
             return InvocationType::Event;
-          }
-          else if (hashCode == RequestResponse_HASH)
-          {
+          case RequestResponse_HASH:
             return InvocationType::RequestResponse;
-          }
-          else if (hashCode == DryRun_HASH)
-          {
+          case DryRun_HASH:
             return InvocationType::DryRun;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
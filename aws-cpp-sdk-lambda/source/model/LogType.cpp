@@ -29,21 +29,29 @@ namespace Aws
       namespace LogTypeMapper
       {
 
-        static const int None_HASH = HashingUtils::HashString("None");
-        static const int Tail_HASH = HashingUtils::HashString("Tail");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int None_HASH = 2433880;
+        static const int Tail_HASH = 2599024;
 
 
         LogType GetLogTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == None_HASH)
+          switch (hashCode)
           {
+          case None_HASH:
             return LogType::None;
-          }
-          else if (hashCode == Tail_HASH)
-          {
+          case Tail_HASH:
             return LogType::Tail;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,31 +29,35 @@ namespace Aws
       namespace RuntimeMapper
       {
 
-        static const int nodejs_HASH = HashingUtils::HashString("nodejs");
-        static const int nodejs4_3_HASH = HashingUtils::HashString("nodejs4.3");
-        static const int java8_HASH = HashingUtils::HashString("java8");
-        static const int python2_7_HASH = HashingUtils::HashString("python2.7");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int nodejs_HASH = -1040170293;
+        static const int nodejs4_3_HASH = 475893326;
+        static const int java8_HASH = 100899414;
+        static const int python2_7_HASH = -1485270241;
 
 
         Runtime GetRuntimeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == nodejs_HASH)
+          switch (hashCode)
           {
+          case nodejs_HASH:
             return Runtime::nodejs;
-          }
-          else if (hashCode == nodejs4_3_HASH)
-          {
+          case nodejs4_3_HASH:
             return Runtime::nodejs4_3;
-          }
-          else if (hashCode == java8_HASH)
-          {
+          case java8_HASH:
             return Runtime::java8;
-          }
-          else if (hashCode == python2_7_HASH)
-          {
+          case python2_7_HASH:
             return Runtime::python2_7;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace ThrottleReasonMapper
       {
 
-        static const int ConcurrentInvocationLimitExceeded_HASH = HashingUtils::HashString("ConcurrentInvocationLimitExceeded");
-        static const int FunctionInvocationRateLimitExceeded_HASH = HashingUtils::HashString("FunctionInvocationRateLimitExceeded");
-        static const int CallerRateLimitExceeded_HASH = HashingUtils::HashString("CallerRateLimitExceeded");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ConcurrentInvocationLimitExceeded_HASH = 475188647;
+        static const int FunctionInvocationRateLimitExceeded_HASH = -1533323930;
+        static const int CallerRateLimitExceeded_HASH = 1942937283;
 
 
         ThrottleReason GetThrottleReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ConcurrentInvocationLimitExceeded_HASH)
+          switch (hashCode)
           {
+          case ConcurrentInvocationLimitExceeded_HASH:
             return ThrottleReason::ConcurrentInvocationLimitExceeded;
-          }
-          else if (hashCode == FunctionInvocationRateLimitExceeded_HASH)
-          {
+          case FunctionInvocationRateLimitExceeded_HASH:
             return ThrottleReason::FunctionInvocationRateLimitExceeded;
-          }
-          else if (hashCode == CallerRateLimitExceeded_HASH)
-          {
+          case CallerRateLimitExceeded_HASH:
             return ThrottleReason::CallerRateLimitExceeded;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -34,6 +34,9 @@
 #include <aws/logs/model/TestMetricFilterResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -260,6 +263,18 @@ namespace Model
          */
         virtual void CancelExportTaskAsync(const Model::CancelExportTaskRequest& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelExportTaskCallable(const Model::CancelExportTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelExportTaskOutcomeCallable CancelExportTaskCallable(Model::CancelExportTaskRequest&& request) const;
+
+        /**
+         * Same as CancelExportTaskAsync(const Model::CancelExportTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelExportTaskAsync(Model::CancelExportTaskRequest&& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an <code>ExportTask</code> which allows you to efficiently export
          * data from a Log Group to your Amazon S3 bucket.</p> <p>This is an asynchronous
@@ -306,6 +321,18 @@ namespace Model
          */
         virtual void CreateExportTaskAsync(const Model::CreateExportTaskRequest& request, const CreateExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateExportTaskCallable(const Model::CreateExportTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateExportTaskOutcomeCallable CreateExportTaskCallable(Model::CreateExportTaskRequest&& request) const;
+
+        /**
+         * Same as CreateExportTaskAsync(const Model::CreateExportTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateExportTaskAsync(Model::CreateExportTaskRequest&& request, const CreateExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new log group with the specified name. The name of the log group
          * must be unique within a region for an AWS account. You can create up to 500 log
@@ -340,6 +367,18 @@ namespace Model
          */
         virtual void CreateLogGroupAsync(const Model::CreateLogGroupRequest& request, const CreateLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLogGroupCallable(const Model::CreateLogGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateLogGroupOutcomeCallable CreateLogGroupCallable(Model::CreateLogGroupRequest&& request) const;
+
+        /**
+         * Same as CreateLogGroupAsync(const Model::CreateLogGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateLogGroupAsync(Model::CreateLogGroupRequest&& request, const CreateLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new log stream in the specified log group. The name of the log
          * stream must be unique within the log group. There is no limit on the number of
@@ -374,6 +413,18 @@ namespace Model
          */
         virtual void CreateLogStreamAsync(const Model::CreateLogStreamRequest& request, const CreateLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLogStreamCallable(const Model::CreateLogStreamRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateLogStreamOutcomeCallable CreateLogStreamCallable(Model::CreateLogStreamRequest&& request) const;
+
+        /**
+         * Same as CreateLogStreamAsync(const Model::CreateLogStreamRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateLogStreamAsync(Model::CreateLogStreamRequest&& request, const CreateLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the destination with the specified name and eventually disables all
          * the subscription filters that publish to it. This will not delete the physical
@@ -399,6 +450,18 @@ namespace Model
          */
         virtual void DeleteDestinationAsync(const Model::DeleteDestinationRequest& request, const DeleteDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDestinationCallable(const Model::DeleteDestinationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDestinationOutcomeCallable DeleteDestinationCallable(Model::DeleteDestinationRequest&& request) const;
+
+        /**
+         * Same as DeleteDestinationAsync(const Model::DeleteDestinationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDestinationAsync(Model::DeleteDestinationRequest&& request, const DeleteDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the log group with the specified name and permanently deletes all the
          * archived log events associated with it.</p>
@@ -421,6 +484,18 @@ namespace Model
          */
         virtual void DeleteLogGroupAsync(const Model::DeleteLogGroupRequest& request, const DeleteLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLogGroupCallable(const Model::DeleteLogGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteLogGroupOutcomeCallable DeleteLogGroupCallable(Model::DeleteLogGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteLogGroupAsync(const Model::DeleteLogGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteLogGroupAsync(Model::DeleteLogGroupRequest&& request, const DeleteLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a log stream and permanently deletes all the archived log events
          * associated with it.</p>
@@ -443,6 +518,18 @@ namespace Model
          */
         virtual void DeleteLogStreamAsync(const Model::DeleteLogStreamRequest& request, const DeleteLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLogStreamCallable(const Model::DeleteLogStreamRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteLogStreamOutcomeCallable DeleteLogStreamCallable(Model::DeleteLogStreamRequest&& request) const;
+
+        /**
+         * Same as DeleteLogStreamAsync(const Model::DeleteLogStreamRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteLogStreamAsync(Model::DeleteLogStreamRequest&& request, const DeleteLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a metric filter associated with the specified log group.</p>
          */
@@ -462,6 +549,18 @@ namespace Model
          */
         virtual void DeleteMetricFilterAsync(const Model::DeleteMetricFilterRequest& request, const DeleteMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteMetricFilterCallable(const Model::DeleteMetricFilterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteMetricFilterOutcomeCallable DeleteMetricFilterCallable(Model::DeleteMetricFilterRequest&& request) const;
+
+        /**
+         * Same as DeleteMetricFilterAsync(const Model::DeleteMetricFilterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteMetricFilterAsync(Model::DeleteMetricFilterRequest&& request, const DeleteMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the retention policy of the specified log group. Log events would not
          * expire if they belong to log groups without a retention policy.</p>
@@ -484,6 +583,18 @@ namespace Model
          */
         virtual void DeleteRetentionPolicyAsync(const Model::DeleteRetentionPolicyRequest& request, const DeleteRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRetentionPolicyCallable(const Model::DeleteRetentionPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRetentionPolicyOutcomeCallable DeleteRetentionPolicyCallable(Model::DeleteRetentionPolicyRequest&& request) const;
+
+        /**
+         * Same as DeleteRetentionPolicyAsync(const Model::DeleteRetentionPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRetentionPolicyAsync(Model::DeleteRetentionPolicyRequest&& request, const DeleteRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a subscription filter associated with the specified log group.</p>
          */
@@ -503,6 +614,18 @@ namespace Model
          */
         virtual void DeleteSubscriptionFilterAsync(const Model::DeleteSubscriptionFilterRequest& request, const DeleteSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSubscriptionFilterCallable(const Model::DeleteSubscriptionFilterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteSubscriptionFilterOutcomeCallable DeleteSubscriptionFilterCallable(Model::DeleteSubscriptionFilterRequest&& request) const;
+
+        /**
+         * Same as DeleteSubscriptionFilterAsync(const Model::DeleteSubscriptionFilterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteSubscriptionFilterAsync(Model::DeleteSubscriptionFilterRequest&& request, const DeleteSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns all the destinations that are associated with the AWS account making
          * the request. The list returned in the response is ASCII-sorted by destination
@@ -540,6 +663,18 @@ namespace Model
          */
         virtual void DescribeDestinationsAsync(const Model::DescribeDestinationsRequest& request, const DescribeDestinationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDestinationsCallable(const Model::DescribeDestinationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDestinationsOutcomeCallable DescribeDestinationsCallable(Model::DescribeDestinationsRequest&& request) const;
+
+        /**
+         * Same as DescribeDestinationsAsync(const Model::DescribeDestinationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDestinationsAsync(Model::DescribeDestinationsRequest&& request, const DescribeDestinationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns all the export tasks that are associated with the AWS account making
          * the request. The export tasks can be filtered based on <code>TaskId</code> or
@@ -577,6 +712,18 @@ namespace Model
          */
         virtual void DescribeExportTasksAsync(const Model::DescribeExportTasksRequest& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeExportTasksCallable(const Model::DescribeExportTasksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeExportTasksOutcomeCallable DescribeExportTasksCallable(Model::DescribeExportTasksRequest&& request) const;
+
+        /**
+         * Same as DescribeExportTasksAsync(const Model::DescribeExportTasksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeExportTasksAsync(Model::DescribeExportTasksRequest&& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns all the log groups that are associated with the AWS account making
          * the request. The list returned in the response is ASCII-sorted by log group
@@ -614,6 +761,18 @@ namespace Model
          */
         virtual void DescribeLogGroupsAsync(const Model::DescribeLogGroupsRequest& request, const DescribeLogGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLogGroupsCallable(const Model::DescribeLogGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLogGroupsOutcomeCallable DescribeLogGroupsCallable(Model::DescribeLogGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeLogGroupsAsync(const Model::DescribeLogGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLogGroupsAsync(Model::DescribeLogGroupsRequest&& request, const DescribeLogGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns all the log streams that are associated with the specified log group.
          * The list returned in the response is ASCII-sorted by log stream name.</p> <p>By
@@ -654,6 +813,18 @@ namespace Model
          */
         virtual void DescribeLogStreamsAsync(const Model::DescribeLogStreamsRequest& request, const DescribeLogStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLogStreamsCallable(const Model::DescribeLogStreamsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLogStreamsOutcomeCallable DescribeLogStreamsCallable(Model::DescribeLogStreamsRequest&& request) const;
+
+        /**
+         * Same as DescribeLogStreamsAsync(const Model::DescribeLogStreamsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLogStreamsAsync(Model::DescribeLogStreamsRequest&& request, const DescribeLogStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns all the metrics filters associated with the specified log group. The
          * list returned in the response is ASCII-sorted by filter name.</p> <p>By default,
@@ -688,6 +859,18 @@ namespace Model
          */
         virtual void DescribeMetricFiltersAsync(const Model::DescribeMetricFiltersRequest& request, const DescribeMetricFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeMetricFiltersCallable(const Model::DescribeMetricFiltersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeMetricFiltersOutcomeCallable DescribeMetricFiltersCallable(Model::DescribeMetricFiltersRequest&& request) const;
+
+        /**
+         * Same as DescribeMetricFiltersAsync(const Model::DescribeMetricFiltersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeMetricFiltersAsync(Model::DescribeMetricFiltersRequest&& request, const DescribeMetricFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns all the subscription filters associated with the specified log group.
          * The list returned in the response is ASCII-sorted by filter name.</p> <p>By
@@ -725,6 +908,18 @@ namespace Model
          */
         virtual void DescribeSubscriptionFiltersAsync(const Model::DescribeSubscriptionFiltersRequest& request, const DescribeSubscriptionFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSubscriptionFiltersCallable(const Model::DescribeSubscriptionFiltersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSubscriptionFiltersOutcomeCallable DescribeSubscriptionFiltersCallable(Model::DescribeSubscriptionFiltersRequest&& request) const;
+
+        /**
+         * Same as DescribeSubscriptionFiltersAsync(const Model::DescribeSubscriptionFiltersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSubscriptionFiltersAsync(Model::DescribeSubscriptionFiltersRequest&& request, const DescribeSubscriptionFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves log events, optionally filtered by a filter pattern from the
          * specified log group. You can provide an optional time range to filter the
@@ -780,6 +975,18 @@ namespace Model
          */
         virtual void FilterLogEventsAsync(const Model::FilterLogEventsRequest& request, const FilterLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as FilterLogEventsCallable(const Model::FilterLogEventsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::FilterLogEventsOutcomeCallable FilterLogEventsCallable(Model::FilterLogEventsRequest&& request) const;
+
+        /**
+         * Same as FilterLogEventsAsync(const Model::FilterLogEventsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void FilterLogEventsAsync(Model::FilterLogEventsRequest&& request, const FilterLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves log events from the specified log stream. You can provide an
          * optional time range to filter the results on the event
@@ -826,6 +1033,18 @@ namespace Model
          */
         virtual void GetLogEventsAsync(const Model::GetLogEventsRequest& request, const GetLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetLogEventsCallable(const Model::GetLogEventsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetLogEventsOutcomeCallable GetLogEventsCallable(Model::GetLogEventsRequest&& request) const;
+
+        /**
+         * Same as GetLogEventsAsync(const Model::GetLogEventsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetLogEventsAsync(Model::GetLogEventsRequest&& request, const GetLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates a <code>Destination</code>. A destination encapsulates a
          * physical resource (such as a Kinesis stream) and allows you to subscribe to a
@@ -875,6 +1094,18 @@ namespace Model
          */
         virtual void PutDestinationAsync(const Model::PutDestinationRequest& request, const PutDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutDestinationCallable(const Model::PutDestinationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutDestinationOutcomeCallable PutDestinationCallable(Model::PutDestinationRequest&& request) const;
+
+        /**
+         * Same as PutDestinationAsync(const Model::PutDestinationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutDestinationAsync(Model::PutDestinationRequest&& request, const PutDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates an access policy associated with an existing
          * <code>Destination</code>. An access policy is an <a
@@ -906,6 +1137,18 @@ namespace Model
          */
         virtual void PutDestinationPolicyAsync(const Model::PutDestinationPolicyRequest& request, const PutDestinationPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutDestinationPolicyCallable(const Model::PutDestinationPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutDestinationPolicyOutcomeCallable PutDestinationPolicyCallable(Model::PutDestinationPolicyRequest&& request) const;
+
+        /**
+         * Same as PutDestinationPolicyAsync(const Model::PutDestinationPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutDestinationPolicyAsync(Model::PutDestinationPolicyRequest&& request, const PutDestinationPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Uploads a batch of log events to the specified log stream.</p> <p>Every
          * PutLogEvents request must include the <code>sequenceToken</code> obtained from
@@ -970,6 +1213,18 @@ namespace Model
          */
         virtual void PutLogEventsAsync(const Model::PutLogEventsRequest& request, const PutLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutLogEventsCallable(const Model::PutLogEventsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutLogEventsOutcomeCallable PutLogEventsCallable(Model::PutLogEventsRequest&& request) const;
+
+        /**
+         * Same as PutLogEventsAsync(const Model::PutLogEventsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutLogEventsAsync(Model::PutLogEventsRequest&& request, const PutLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates a metric filter and associates it with the specified log
          * group. Metric filters allow you to configure rules to extract metric data from
@@ -1001,6 +1256,18 @@ namespace Model
          */
         virtual void PutMetricFilterAsync(const Model::PutMetricFilterRequest& request, const PutMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutMetricFilterCallable(const Model::PutMetricFilterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutMetricFilterOutcomeCallable PutMetricFilterCallable(Model::PutMetricFilterRequest&& request) const;
+
+        /**
+         * Same as PutMetricFilterAsync(const Model::PutMetricFilterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutMetricFilterAsync(Model::PutMetricFilterRequest&& request, const PutMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the retention of the specified log group. A retention policy allows you
          * to configure the number of days you want to retain log events in the specified
@@ -1026,6 +1293,18 @@ namespace Model
          */
         virtual void PutRetentionPolicyAsync(const Model::PutRetentionPolicyRequest& request, const PutRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRetentionPolicyCallable(const Model::PutRetentionPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutRetentionPolicyOutcomeCallable PutRetentionPolicyCallable(Model::PutRetentionPolicyRequest&& request) const;
+
+        /**
+         * Same as PutRetentionPolicyAsync(const Model::PutRetentionPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutRetentionPolicyAsync(Model::PutRetentionPolicyRequest&& request, const PutRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates a subscription filter and associates it with the specified
          * log group. Subscription filters allow you to subscribe to a real-time stream of
@@ -1081,6 +1360,18 @@ namespace Model
          */
         virtual void PutSubscriptionFilterAsync(const Model::PutSubscriptionFilterRequest& request, const PutSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutSubscriptionFilterCallable(const Model::PutSubscriptionFilterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutSubscriptionFilterOutcomeCallable PutSubscriptionFilterCallable(Model::PutSubscriptionFilterRequest&& request) const;
+
+        /**
+         * Same as PutSubscriptionFilterAsync(const Model::PutSubscriptionFilterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutSubscriptionFilterAsync(Model::PutSubscriptionFilterRequest&& request, const PutSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Tests the filter pattern of a metric filter against a sample of log event
          * messages. You can use this operation to validate the correctness of a metric
@@ -1106,6 +1397,180 @@ namespace Model
          */
         virtual void TestMetricFilterAsync(const Model::TestMetricFilterRequest& request, const TestMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TestMetricFilterCallable(const Model::TestMetricFilterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TestMetricFilterOutcomeCallable TestMetricFilterCallable(Model::TestMetricFilterRequest&& request) const;
+
+        /**
+         * Same as TestMetricFilterAsync(const Model::TestMetricFilterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TestMetricFilterAsync(Model::TestMetricFilterRequest&& request, const TestMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeDestinations(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudWatchLogsClient, Model::DescribeDestinationsRequest, Model::DescribeDestinationsOutcome> DescribeDestinationsPaginator(const Model::DescribeDestinationsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeExportTasks(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudWatchLogsClient, Model::DescribeExportTasksRequest, Model::DescribeExportTasksOutcome> DescribeExportTasksPaginator(const Model::DescribeExportTasksRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeLogGroups(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudWatchLogsClient, Model::DescribeLogGroupsRequest, Model::DescribeLogGroupsOutcome> DescribeLogGroupsPaginator(const Model::DescribeLogGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeLogStreams(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudWatchLogsClient, Model::DescribeLogStreamsRequest, Model::DescribeLogStreamsOutcome> DescribeLogStreamsPaginator(const Model::DescribeLogStreamsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeMetricFilters(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudWatchLogsClient, Model::DescribeMetricFiltersRequest, Model::DescribeMetricFiltersOutcome> DescribeMetricFiltersPaginator(const Model::DescribeMetricFiltersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeSubscriptionFilters(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudWatchLogsClient, Model::DescribeSubscriptionFiltersRequest, Model::DescribeSubscriptionFiltersOutcome> DescribeSubscriptionFiltersPaginator(const Model::DescribeSubscriptionFiltersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through FilterLogEvents(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudWatchLogsClient, Model::FilterLogEventsRequest, Model::FilterLogEventsOutcome> FilterLogEventsPaginator(const Model::FilterLogEventsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CancelExportTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::CancelExportTaskRequest, Model::CancelExportTaskOutcome> CancelExportTaskAwaitable(Model::CancelExportTaskRequest request) const;
+
+        /**
+         * co_await-able form of CreateExportTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::CreateExportTaskRequest, Model::CreateExportTaskOutcome> CreateExportTaskAwaitable(Model::CreateExportTaskRequest request) const;
+
+        /**
+         * co_await-able form of CreateLogGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::CreateLogGroupRequest, Model::CreateLogGroupOutcome> CreateLogGroupAwaitable(Model::CreateLogGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateLogStream(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::CreateLogStreamRequest, Model::CreateLogStreamOutcome> CreateLogStreamAwaitable(Model::CreateLogStreamRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDestination(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::DeleteDestinationRequest, Model::DeleteDestinationOutcome> DeleteDestinationAwaitable(Model::DeleteDestinationRequest request) const;
+
+        /**
+         * co_await-able form of DeleteLogGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::DeleteLogGroupRequest, Model::DeleteLogGroupOutcome> DeleteLogGroupAwaitable(Model::DeleteLogGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteLogStream(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::DeleteLogStreamRequest, Model::DeleteLogStreamOutcome> DeleteLogStreamAwaitable(Model::DeleteLogStreamRequest request) const;
+
+        /**
+         * co_await-able form of DeleteMetricFilter(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::DeleteMetricFilterRequest, Model::DeleteMetricFilterOutcome> DeleteMetricFilterAwaitable(Model::DeleteMetricFilterRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRetentionPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::DeleteRetentionPolicyRequest, Model::DeleteRetentionPolicyOutcome> DeleteRetentionPolicyAwaitable(Model::DeleteRetentionPolicyRequest request) const;
+
+        /**
+         * co_await-able form of DeleteSubscriptionFilter(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::DeleteSubscriptionFilterRequest, Model::DeleteSubscriptionFilterOutcome> DeleteSubscriptionFilterAwaitable(Model::DeleteSubscriptionFilterRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDestinations(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::DescribeDestinationsRequest, Model::DescribeDestinationsOutcome> DescribeDestinationsAwaitable(Model::DescribeDestinationsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeExportTasks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::DescribeExportTasksRequest, Model::DescribeExportTasksOutcome> DescribeExportTasksAwaitable(Model::DescribeExportTasksRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLogGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::DescribeLogGroupsRequest, Model::DescribeLogGroupsOutcome> DescribeLogGroupsAwaitable(Model::DescribeLogGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLogStreams(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::DescribeLogStreamsRequest, Model::DescribeLogStreamsOutcome> DescribeLogStreamsAwaitable(Model::DescribeLogStreamsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeMetricFilters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::DescribeMetricFiltersRequest, Model::DescribeMetricFiltersOutcome> DescribeMetricFiltersAwaitable(Model::DescribeMetricFiltersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSubscriptionFilters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::DescribeSubscriptionFiltersRequest, Model::DescribeSubscriptionFiltersOutcome> DescribeSubscriptionFiltersAwaitable(Model::DescribeSubscriptionFiltersRequest request) const;
+
+        /**
+         * co_await-able form of FilterLogEvents(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::FilterLogEventsRequest, Model::FilterLogEventsOutcome> FilterLogEventsAwaitable(Model::FilterLogEventsRequest request) const;
+
+        /**
+         * co_await-able form of GetLogEvents(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::GetLogEventsRequest, Model::GetLogEventsOutcome> GetLogEventsAwaitable(Model::GetLogEventsRequest request) const;
+
+        /**
+         * co_await-able form of PutDestination(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::PutDestinationRequest, Model::PutDestinationOutcome> PutDestinationAwaitable(Model::PutDestinationRequest request) const;
+
+        /**
+         * co_await-able form of PutDestinationPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::PutDestinationPolicyRequest, Model::PutDestinationPolicyOutcome> PutDestinationPolicyAwaitable(Model::PutDestinationPolicyRequest request) const;
+
+        /**
+         * co_await-able form of PutLogEvents(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::PutLogEventsRequest, Model::PutLogEventsOutcome> PutLogEventsAwaitable(Model::PutLogEventsRequest request) const;
+
+        /**
+         * co_await-able form of PutMetricFilter(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::PutMetricFilterRequest, Model::PutMetricFilterOutcome> PutMetricFilterAwaitable(Model::PutMetricFilterRequest request) const;
+
+        /**
+         * co_await-able form of PutRetentionPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::PutRetentionPolicyRequest, Model::PutRetentionPolicyOutcome> PutRetentionPolicyAwaitable(Model::PutRetentionPolicyRequest request) const;
+
+        /**
+         * co_await-able form of PutSubscriptionFilter(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::PutSubscriptionFilterRequest, Model::PutSubscriptionFilterOutcome> PutSubscriptionFilterAwaitable(Model::PutSubscriptionFilterRequest request) const;
+
+        /**
+         * co_await-able form of TestMetricFilter(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchLogsClient, Model::TestMetricFilterRequest, Model::TestMetricFilterOutcome> TestMetricFilterAwaitable(Model::TestMetricFilterRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
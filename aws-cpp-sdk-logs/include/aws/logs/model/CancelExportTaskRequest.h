@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CancelExportTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelExportTask"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
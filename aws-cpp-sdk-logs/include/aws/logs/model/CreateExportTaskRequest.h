@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateExportTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateExportTask"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
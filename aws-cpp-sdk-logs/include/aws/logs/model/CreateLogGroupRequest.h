@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateLogGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateLogGroup"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateLogStreamRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateLogStream"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteDestinationRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDestination"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteLogGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteLogGroup"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
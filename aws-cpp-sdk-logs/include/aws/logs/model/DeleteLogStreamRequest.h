@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteLogStreamRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteLogStream"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
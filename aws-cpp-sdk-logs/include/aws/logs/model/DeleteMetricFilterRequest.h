@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteMetricFilterRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteMetricFilter"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteRetentionPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteRetentionPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
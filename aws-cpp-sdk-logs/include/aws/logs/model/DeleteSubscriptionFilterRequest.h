@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteSubscriptionFilterRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteSubscriptionFilter"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
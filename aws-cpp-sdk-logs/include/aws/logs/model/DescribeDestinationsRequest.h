@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeDestinationsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDestinations"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeExportTasksRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeExportTasks"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
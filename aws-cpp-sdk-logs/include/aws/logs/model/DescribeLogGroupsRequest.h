@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeLogGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLogGroups"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
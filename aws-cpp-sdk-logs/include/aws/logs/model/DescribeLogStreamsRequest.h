@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeLogStreamsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLogStreams"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeMetricFiltersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeMetricFilters"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeSubscriptionFiltersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSubscriptionFilters"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     FilterLogEventsRequest();
+    inline const char* GetServiceRequestName() const override { return "FilterLogEvents"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
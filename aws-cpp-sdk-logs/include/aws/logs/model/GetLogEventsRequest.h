@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetLogEventsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetLogEvents"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     PutDestinationPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "PutDestinationPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
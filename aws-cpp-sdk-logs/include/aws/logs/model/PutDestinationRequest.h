@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     PutDestinationRequest();
+    inline const char* GetServiceRequestName() const override { return "PutDestination"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
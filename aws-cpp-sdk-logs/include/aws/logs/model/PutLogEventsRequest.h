@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PutLogEventsRequest();
+    inline const char* GetServiceRequestName() const override { return "PutLogEvents"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PutMetricFilterRequest();
+    inline const char* GetServiceRequestName() const override { return "PutMetricFilter"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     PutRetentionPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "PutRetentionPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     PutSubscriptionFilterRequest();
+    inline const char* GetServiceRequestName() const override { return "PutSubscriptionFilter"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
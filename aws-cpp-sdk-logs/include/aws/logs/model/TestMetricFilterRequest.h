@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     TestMetricFilterRequest();
+    inline const char* GetServiceRequestName() const override { return "TestMetricFilter"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
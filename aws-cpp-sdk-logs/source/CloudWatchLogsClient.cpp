@@ -134,7 +134,7 @@ CancelExportTaskOutcome CloudWatchLogsClient::CancelExportTask(const CancelExpor
 
 CancelExportTaskOutcomeCallable CloudWatchLogsClient::CancelExportTaskCallable(const CancelExportTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelExportTask(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelExportTask(request); } );
 }
 
 void CloudWatchLogsClient::CancelExportTaskAsync(const CancelExportTaskRequest& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -142,6 +142,16 @@ void CloudWatchLogsClient::CancelExportTaskAsync(const CancelExportTaskRequest&
   m_executor->Submit( [this, request, handler, context](){ this->CancelExportTaskAsyncHelper( request, handler, context ); } );
 }
 
+CancelExportTaskOutcomeCallable CloudWatchLogsClient::CancelExportTaskCallable(CancelExportTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::CancelExportTask, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::CancelExportTaskAsync(CancelExportTaskRequest&& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::CancelExportTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::CancelExportTaskAsyncHelper(const CancelExportTaskRequest& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelExportTask(request), context);
@@ -165,7 +175,7 @@ CreateExportTaskOutcome CloudWatchLogsClient::CreateExportTask(const CreateExpor
 
 CreateExportTaskOutcomeCallable CloudWatchLogsClient::CreateExportTaskCallable(const CreateExportTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateExportTask(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateExportTask(request); } );
 }
 
 void CloudWatchLogsClient::CreateExportTaskAsync(const CreateExportTaskRequest& request, const CreateExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -173,6 +183,16 @@ void CloudWatchLogsClient::CreateExportTaskAsync(const CreateExportTaskRequest&
   m_executor->Submit( [this, request, handler, context](){ this->CreateExportTaskAsyncHelper( request, handler, context ); } );
 }
 
+CreateExportTaskOutcomeCallable CloudWatchLogsClient::CreateExportTaskCallable(CreateExportTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::CreateExportTask, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::CreateExportTaskAsync(CreateExportTaskRequest&& request, const CreateExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::CreateExportTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::CreateExportTaskAsyncHelper(const CreateExportTaskRequest& request, const CreateExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateExportTask(request), context);
@@ -196,7 +216,7 @@ CreateLogGroupOutcome CloudWatchLogsClient::CreateLogGroup(const CreateLogGroupR
 
 CreateLogGroupOutcomeCallable CloudWatchLogsClient::CreateLogGroupCallable(const CreateLogGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateLogGroup(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateLogGroup(request); } );
 }
 
 void CloudWatchLogsClient::CreateLogGroupAsync(const CreateLogGroupRequest& request, const CreateLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -204,6 +224,16 @@ void CloudWatchLogsClient::CreateLogGroupAsync(const CreateLogGroupRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->CreateLogGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateLogGroupOutcomeCallable CloudWatchLogsClient::CreateLogGroupCallable(CreateLogGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::CreateLogGroup, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::CreateLogGroupAsync(CreateLogGroupRequest&& request, const CreateLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::CreateLogGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::CreateLogGroupAsyncHelper(const CreateLogGroupRequest& request, const CreateLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateLogGroup(request), context);
@@ -227,7 +257,7 @@ CreateLogStreamOutcome CloudWatchLogsClient::CreateLogStream(const CreateLogStre
 
 CreateLogStreamOutcomeCallable CloudWatchLogsClient::CreateLogStreamCallable(const CreateLogStreamRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateLogStream(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateLogStream(request); } );
 }
 
 void CloudWatchLogsClient::CreateLogStreamAsync(const CreateLogStreamRequest& request, const CreateLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -235,6 +265,16 @@ void CloudWatchLogsClient::CreateLogStreamAsync(const CreateLogStreamRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->CreateLogStreamAsyncHelper( request, handler, context ); } );
 }
 
+CreateLogStreamOutcomeCallable CloudWatchLogsClient::CreateLogStreamCallable(CreateLogStreamRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::CreateLogStream, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::CreateLogStreamAsync(CreateLogStreamRequest&& request, const CreateLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::CreateLogStreamAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::CreateLogStreamAsyncHelper(const CreateLogStreamRequest& request, const CreateLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateLogStream(request), context);
@@ -258,7 +298,7 @@ DeleteDestinationOutcome CloudWatchLogsClient::DeleteDestination(const DeleteDes
 
 DeleteDestinationOutcomeCallable CloudWatchLogsClient::DeleteDestinationCallable(const DeleteDestinationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDestination(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDestination(request); } );
 }
 
 void CloudWatchLogsClient::DeleteDestinationAsync(const DeleteDestinationRequest& request, const DeleteDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -266,6 +306,16 @@ void CloudWatchLogsClient::DeleteDestinationAsync(const DeleteDestinationRequest
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDestinationAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDestinationOutcomeCallable CloudWatchLogsClient::DeleteDestinationCallable(DeleteDestinationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::DeleteDestination, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::DeleteDestinationAsync(DeleteDestinationRequest&& request, const DeleteDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::DeleteDestinationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::DeleteDestinationAsyncHelper(const DeleteDestinationRequest& request, const DeleteDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDestination(request), context);
@@ -289,7 +339,7 @@ DeleteLogGroupOutcome CloudWatchLogsClient::DeleteLogGroup(const DeleteLogGroupR
 
 DeleteLogGroupOutcomeCallable CloudWatchLogsClient::DeleteLogGroupCallable(const DeleteLogGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteLogGroup(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteLogGroup(request); } );
 }
 
 void CloudWatchLogsClient::DeleteLogGroupAsync(const DeleteLogGroupRequest& request, const DeleteLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -297,6 +347,16 @@ void CloudWatchLogsClient::DeleteLogGroupAsync(const DeleteLogGroupRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->DeleteLogGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteLogGroupOutcomeCallable CloudWatchLogsClient::DeleteLogGroupCallable(DeleteLogGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::DeleteLogGroup, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::DeleteLogGroupAsync(DeleteLogGroupRequest&& request, const DeleteLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::DeleteLogGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::DeleteLogGroupAsyncHelper(const DeleteLogGroupRequest& request, const DeleteLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteLogGroup(request), context);
@@ -320,7 +380,7 @@ DeleteLogStreamOutcome CloudWatchLogsClient::DeleteLogStream(const DeleteLogStre
 
 DeleteLogStreamOutcomeCallable CloudWatchLogsClient::DeleteLogStreamCallable(const DeleteLogStreamRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteLogStream(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteLogStream(request); } );
 }
 
 void CloudWatchLogsClient::DeleteLogStreamAsync(const DeleteLogStreamRequest& request, const DeleteLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -328,6 +388,16 @@ void CloudWatchLogsClient::DeleteLogStreamAsync(const DeleteLogStreamRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->DeleteLogStreamAsyncHelper( request, handler, context ); } );
 }
 
+DeleteLogStreamOutcomeCallable CloudWatchLogsClient::DeleteLogStreamCallable(DeleteLogStreamRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::DeleteLogStream, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::DeleteLogStreamAsync(DeleteLogStreamRequest&& request, const DeleteLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::DeleteLogStreamAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::DeleteLogStreamAsyncHelper(const DeleteLogStreamRequest& request, const DeleteLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteLogStream(request), context);
@@ -351,7 +421,7 @@ DeleteMetricFilterOutcome CloudWatchLogsClient::DeleteMetricFilter(const DeleteM
 
 DeleteMetricFilterOutcomeCallable CloudWatchLogsClient::DeleteMetricFilterCallable(const DeleteMetricFilterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteMetricFilter(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteMetricFilter(request); } );
 }
 
 void CloudWatchLogsClient::DeleteMetricFilterAsync(const DeleteMetricFilterRequest& request, const DeleteMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -359,6 +429,16 @@ void CloudWatchLogsClient::DeleteMetricFilterAsync(const DeleteMetricFilterReque
   m_executor->Submit( [this, request, handler, context](){ this->DeleteMetricFilterAsyncHelper( request, handler, context ); } );
 }
 
+DeleteMetricFilterOutcomeCallable CloudWatchLogsClient::DeleteMetricFilterCallable(DeleteMetricFilterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::DeleteMetricFilter, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::DeleteMetricFilterAsync(DeleteMetricFilterRequest&& request, const DeleteMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::DeleteMetricFilterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::DeleteMetricFilterAsyncHelper(const DeleteMetricFilterRequest& request, const DeleteMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteMetricFilter(request), context);
@@ -382,7 +462,7 @@ DeleteRetentionPolicyOutcome CloudWatchLogsClient::DeleteRetentionPolicy(const D
 
 DeleteRetentionPolicyOutcomeCallable CloudWatchLogsClient::DeleteRetentionPolicyCallable(const DeleteRetentionPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRetentionPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRetentionPolicy(request); } );
 }
 
 void CloudWatchLogsClient::DeleteRetentionPolicyAsync(const DeleteRetentionPolicyRequest& request, const DeleteRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -390,6 +470,16 @@ void CloudWatchLogsClient::DeleteRetentionPolicyAsync(const DeleteRetentionPolic
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRetentionPolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRetentionPolicyOutcomeCallable CloudWatchLogsClient::DeleteRetentionPolicyCallable(DeleteRetentionPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::DeleteRetentionPolicy, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::DeleteRetentionPolicyAsync(DeleteRetentionPolicyRequest&& request, const DeleteRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::DeleteRetentionPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::DeleteRetentionPolicyAsyncHelper(const DeleteRetentionPolicyRequest& request, const DeleteRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRetentionPolicy(request), context);
@@ -413,7 +503,7 @@ DeleteSubscriptionFilterOutcome CloudWatchLogsClient::DeleteSubscriptionFilter(c
 
 DeleteSubscriptionFilterOutcomeCallable CloudWatchLogsClient::DeleteSubscriptionFilterCallable(const DeleteSubscriptionFilterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteSubscriptionFilter(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteSubscriptionFilter(request); } );
 }
 
 void CloudWatchLogsClient::DeleteSubscriptionFilterAsync(const DeleteSubscriptionFilterRequest& request, const DeleteSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -421,6 +511,16 @@ void CloudWatchLogsClient::DeleteSubscriptionFilterAsync(const DeleteSubscriptio
   m_executor->Submit( [this, request, handler, context](){ this->DeleteSubscriptionFilterAsyncHelper( request, handler, context ); } );
 }
 
+DeleteSubscriptionFilterOutcomeCallable CloudWatchLogsClient::DeleteSubscriptionFilterCallable(DeleteSubscriptionFilterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::DeleteSubscriptionFilter, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::DeleteSubscriptionFilterAsync(DeleteSubscriptionFilterRequest&& request, const DeleteSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::DeleteSubscriptionFilterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::DeleteSubscriptionFilterAsyncHelper(const DeleteSubscriptionFilterRequest& request, const DeleteSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteSubscriptionFilter(request), context);
@@ -444,7 +544,7 @@ DescribeDestinationsOutcome CloudWatchLogsClient::DescribeDestinations(const Des
 
 DescribeDestinationsOutcomeCallable CloudWatchLogsClient::DescribeDestinationsCallable(const DescribeDestinationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDestinations(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDestinations(request); } );
 }
 
 void CloudWatchLogsClient::DescribeDestinationsAsync(const DescribeDestinationsRequest& request, const DescribeDestinationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -452,6 +552,16 @@ void CloudWatchLogsClient::DescribeDestinationsAsync(const DescribeDestinationsR
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDestinationsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDestinationsOutcomeCallable CloudWatchLogsClient::DescribeDestinationsCallable(DescribeDestinationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::DescribeDestinations, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::DescribeDestinationsAsync(DescribeDestinationsRequest&& request, const DescribeDestinationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::DescribeDestinationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::DescribeDestinationsAsyncHelper(const DescribeDestinationsRequest& request, const DescribeDestinationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDestinations(request), context);
@@ -475,7 +585,7 @@ DescribeExportTasksOutcome CloudWatchLogsClient::DescribeExportTasks(const Descr
 
 DescribeExportTasksOutcomeCallable CloudWatchLogsClient::DescribeExportTasksCallable(const DescribeExportTasksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeExportTasks(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeExportTasks(request); } );
 }
 
 void CloudWatchLogsClient::DescribeExportTasksAsync(const DescribeExportTasksRequest& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -483,6 +593,16 @@ void CloudWatchLogsClient::DescribeExportTasksAsync(const DescribeExportTasksReq
   m_executor->Submit( [this, request, handler, context](){ this->DescribeExportTasksAsyncHelper( request, handler, context ); } );
 }
 
+DescribeExportTasksOutcomeCallable CloudWatchLogsClient::DescribeExportTasksCallable(DescribeExportTasksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::DescribeExportTasks, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::DescribeExportTasksAsync(DescribeExportTasksRequest&& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::DescribeExportTasksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::DescribeExportTasksAsyncHelper(const DescribeExportTasksRequest& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeExportTasks(request), context);
@@ -506,7 +626,7 @@ DescribeLogGroupsOutcome CloudWatchLogsClient::DescribeLogGroups(const DescribeL
 
 DescribeLogGroupsOutcomeCallable CloudWatchLogsClient::DescribeLogGroupsCallable(const DescribeLogGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLogGroups(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLogGroups(request); } );
 }
 
 void CloudWatchLogsClient::DescribeLogGroupsAsync(const DescribeLogGroupsRequest& request, const DescribeLogGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -514,6 +634,16 @@ void CloudWatchLogsClient::DescribeLogGroupsAsync(const DescribeLogGroupsRequest
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLogGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLogGroupsOutcomeCallable CloudWatchLogsClient::DescribeLogGroupsCallable(DescribeLogGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::DescribeLogGroups, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::DescribeLogGroupsAsync(DescribeLogGroupsRequest&& request, const DescribeLogGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::DescribeLogGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::DescribeLogGroupsAsyncHelper(const DescribeLogGroupsRequest& request, const DescribeLogGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLogGroups(request), context);
@@ -537,7 +667,7 @@ DescribeLogStreamsOutcome CloudWatchLogsClient::DescribeLogStreams(const Describ
 
 DescribeLogStreamsOutcomeCallable CloudWatchLogsClient::DescribeLogStreamsCallable(const DescribeLogStreamsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLogStreams(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLogStreams(request); } );
 }
 
 void CloudWatchLogsClient::DescribeLogStreamsAsync(const DescribeLogStreamsRequest& request, const DescribeLogStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -545,6 +675,16 @@ void CloudWatchLogsClient::DescribeLogStreamsAsync(const DescribeLogStreamsReque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLogStreamsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLogStreamsOutcomeCallable CloudWatchLogsClient::DescribeLogStreamsCallable(DescribeLogStreamsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::DescribeLogStreams, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::DescribeLogStreamsAsync(DescribeLogStreamsRequest&& request, const DescribeLogStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::DescribeLogStreamsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::DescribeLogStreamsAsyncHelper(const DescribeLogStreamsRequest& request, const DescribeLogStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLogStreams(request), context);
@@ -568,7 +708,7 @@ DescribeMetricFiltersOutcome CloudWatchLogsClient::DescribeMetricFilters(const D
 
 DescribeMetricFiltersOutcomeCallable CloudWatchLogsClient::DescribeMetricFiltersCallable(const DescribeMetricFiltersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeMetricFilters(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeMetricFilters(request); } );
 }
 
 void CloudWatchLogsClient::DescribeMetricFiltersAsync(const DescribeMetricFiltersRequest& request, const DescribeMetricFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -576,6 +716,16 @@ void CloudWatchLogsClient::DescribeMetricFiltersAsync(const DescribeMetricFilter
   m_executor->Submit( [this, request, handler, context](){ this->DescribeMetricFiltersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeMetricFiltersOutcomeCallable CloudWatchLogsClient::DescribeMetricFiltersCallable(DescribeMetricFiltersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::DescribeMetricFilters, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::DescribeMetricFiltersAsync(DescribeMetricFiltersRequest&& request, const DescribeMetricFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::DescribeMetricFiltersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::DescribeMetricFiltersAsyncHelper(const DescribeMetricFiltersRequest& request, const DescribeMetricFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeMetricFilters(request), context);
@@ -599,7 +749,7 @@ DescribeSubscriptionFiltersOutcome CloudWatchLogsClient::DescribeSubscriptionFil
 
 DescribeSubscriptionFiltersOutcomeCallable CloudWatchLogsClient::DescribeSubscriptionFiltersCallable(const DescribeSubscriptionFiltersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSubscriptionFilters(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSubscriptionFilters(request); } );
 }
 
 void CloudWatchLogsClient::DescribeSubscriptionFiltersAsync(const DescribeSubscriptionFiltersRequest& request, const DescribeSubscriptionFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -607,6 +757,16 @@ void CloudWatchLogsClient::DescribeSubscriptionFiltersAsync(const DescribeSubscr
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSubscriptionFiltersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSubscriptionFiltersOutcomeCallable CloudWatchLogsClient::DescribeSubscriptionFiltersCallable(DescribeSubscriptionFiltersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::DescribeSubscriptionFilters, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::DescribeSubscriptionFiltersAsync(DescribeSubscriptionFiltersRequest&& request, const DescribeSubscriptionFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::DescribeSubscriptionFiltersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::DescribeSubscriptionFiltersAsyncHelper(const DescribeSubscriptionFiltersRequest& request, const DescribeSubscriptionFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSubscriptionFilters(request), context);
@@ -630,7 +790,7 @@ FilterLogEventsOutcome CloudWatchLogsClient::FilterLogEvents(const FilterLogEven
 
 FilterLogEventsOutcomeCallable CloudWatchLogsClient::FilterLogEventsCallable(const FilterLogEventsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->FilterLogEvents(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->FilterLogEvents(request); } );
 }
 
 void CloudWatchLogsClient::FilterLogEventsAsync(const FilterLogEventsRequest& request, const FilterLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -638,6 +798,16 @@ void CloudWatchLogsClient::FilterLogEventsAsync(const FilterLogEventsRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->FilterLogEventsAsyncHelper( request, handler, context ); } );
 }
 
+FilterLogEventsOutcomeCallable CloudWatchLogsClient::FilterLogEventsCallable(FilterLogEventsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::FilterLogEvents, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::FilterLogEventsAsync(FilterLogEventsRequest&& request, const FilterLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::FilterLogEventsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::FilterLogEventsAsyncHelper(const FilterLogEventsRequest& request, const FilterLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, FilterLogEvents(request), context);
@@ -661,7 +831,7 @@ GetLogEventsOutcome CloudWatchLogsClient::GetLogEvents(const GetLogEventsRequest
 
 GetLogEventsOutcomeCallable CloudWatchLogsClient::GetLogEventsCallable(const GetLogEventsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetLogEvents(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetLogEvents(request); } );
 }
 
 void CloudWatchLogsClient::GetLogEventsAsync(const GetLogEventsRequest& request, const GetLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -669,6 +839,16 @@ void CloudWatchLogsClient::GetLogEventsAsync(const GetLogEventsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->GetLogEventsAsyncHelper( request, handler, context ); } );
 }
 
+GetLogEventsOutcomeCallable CloudWatchLogsClient::GetLogEventsCallable(GetLogEventsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::GetLogEvents, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::GetLogEventsAsync(GetLogEventsRequest&& request, const GetLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::GetLogEventsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::GetLogEventsAsyncHelper(const GetLogEventsRequest& request, const GetLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetLogEvents(request), context);
@@ -692,7 +872,7 @@ PutDestinationOutcome CloudWatchLogsClient::PutDestination(const PutDestinationR
 
 PutDestinationOutcomeCallable CloudWatchLogsClient::PutDestinationCallable(const PutDestinationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutDestination(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutDestination(request); } );
 }
 
 void CloudWatchLogsClient::PutDestinationAsync(const PutDestinationRequest& request, const PutDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -700,6 +880,16 @@ void CloudWatchLogsClient::PutDestinationAsync(const PutDestinationRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->PutDestinationAsyncHelper( request, handler, context ); } );
 }
 
+PutDestinationOutcomeCallable CloudWatchLogsClient::PutDestinationCallable(PutDestinationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::PutDestination, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::PutDestinationAsync(PutDestinationRequest&& request, const PutDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::PutDestinationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::PutDestinationAsyncHelper(const PutDestinationRequest& request, const PutDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutDestination(request), context);
@@ -723,7 +913,7 @@ PutDestinationPolicyOutcome CloudWatchLogsClient::PutDestinationPolicy(const Put
 
 PutDestinationPolicyOutcomeCallable CloudWatchLogsClient::PutDestinationPolicyCallable(const PutDestinationPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutDestinationPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutDestinationPolicy(request); } );
 }
 
 void CloudWatchLogsClient::PutDestinationPolicyAsync(const PutDestinationPolicyRequest& request, const PutDestinationPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -731,6 +921,16 @@ void CloudWatchLogsClient::PutDestinationPolicyAsync(const PutDestinationPolicyR
   m_executor->Submit( [this, request, handler, context](){ this->PutDestinationPolicyAsyncHelper( request, handler, context ); } );
 }
 
+PutDestinationPolicyOutcomeCallable CloudWatchLogsClient::PutDestinationPolicyCallable(PutDestinationPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::PutDestinationPolicy, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::PutDestinationPolicyAsync(PutDestinationPolicyRequest&& request, const PutDestinationPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::PutDestinationPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::PutDestinationPolicyAsyncHelper(const PutDestinationPolicyRequest& request, const PutDestinationPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutDestinationPolicy(request), context);
@@ -754,7 +954,7 @@ PutLogEventsOutcome CloudWatchLogsClient::PutLogEvents(const PutLogEventsRequest
 
 PutLogEventsOutcomeCallable CloudWatchLogsClient::PutLogEventsCallable(const PutLogEventsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutLogEvents(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutLogEvents(request); } );
 }
 
 void CloudWatchLogsClient::PutLogEventsAsync(const PutLogEventsRequest& request, const PutLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -762,6 +962,16 @@ void CloudWatchLogsClient::PutLogEventsAsync(const PutLogEventsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->PutLogEventsAsyncHelper( request, handler, context ); } );
 }
 
+PutLogEventsOutcomeCallable CloudWatchLogsClient::PutLogEventsCallable(PutLogEventsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::PutLogEvents, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::PutLogEventsAsync(PutLogEventsRequest&& request, const PutLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::PutLogEventsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::PutLogEventsAsyncHelper(const PutLogEventsRequest& request, const PutLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutLogEvents(request), context);
@@ -785,7 +995,7 @@ PutMetricFilterOutcome CloudWatchLogsClient::PutMetricFilter(const PutMetricFilt
 
 PutMetricFilterOutcomeCallable CloudWatchLogsClient::PutMetricFilterCallable(const PutMetricFilterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutMetricFilter(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutMetricFilter(request); } );
 }
 
 void CloudWatchLogsClient::PutMetricFilterAsync(const PutMetricFilterRequest& request, const PutMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -793,6 +1003,16 @@ void CloudWatchLogsClient::PutMetricFilterAsync(const PutMetricFilterRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->PutMetricFilterAsyncHelper( request, handler, context ); } );
 }
 
+PutMetricFilterOutcomeCallable CloudWatchLogsClient::PutMetricFilterCallable(PutMetricFilterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::PutMetricFilter, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::PutMetricFilterAsync(PutMetricFilterRequest&& request, const PutMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::PutMetricFilterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::PutMetricFilterAsyncHelper(const PutMetricFilterRequest& request, const PutMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutMetricFilter(request), context);
@@ -816,7 +1036,7 @@ PutRetentionPolicyOutcome CloudWatchLogsClient::PutRetentionPolicy(const PutRete
 
 PutRetentionPolicyOutcomeCallable CloudWatchLogsClient::PutRetentionPolicyCallable(const PutRetentionPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutRetentionPolicy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutRetentionPolicy(request); } );
 }
 
 void CloudWatchLogsClient::PutRetentionPolicyAsync(const PutRetentionPolicyRequest& request, const PutRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -824,6 +1044,16 @@ void CloudWatchLogsClient::PutRetentionPolicyAsync(const PutRetentionPolicyReque
   m_executor->Submit( [this, request, handler, context](){ this->PutRetentionPolicyAsyncHelper( request, handler, context ); } );
 }
 
+PutRetentionPolicyOutcomeCallable CloudWatchLogsClient::PutRetentionPolicyCallable(PutRetentionPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::PutRetentionPolicy, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::PutRetentionPolicyAsync(PutRetentionPolicyRequest&& request, const PutRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::PutRetentionPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::PutRetentionPolicyAsyncHelper(const PutRetentionPolicyRequest& request, const PutRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutRetentionPolicy(request), context);
@@ -847,7 +1077,7 @@ PutSubscriptionFilterOutcome CloudWatchLogsClient::PutSubscriptionFilter(const P
 
 PutSubscriptionFilterOutcomeCallable CloudWatchLogsClient::PutSubscriptionFilterCallable(const PutSubscriptionFilterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutSubscriptionFilter(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutSubscriptionFilter(request); } );
 }
 
 void CloudWatchLogsClient::PutSubscriptionFilterAsync(const PutSubscriptionFilterRequest& request, const PutSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -855,6 +1085,16 @@ void CloudWatchLogsClient::PutSubscriptionFilterAsync(const PutSubscriptionFilte
   m_executor->Submit( [this, request, handler, context](){ this->PutSubscriptionFilterAsyncHelper( request, handler, context ); } );
 }
 
+PutSubscriptionFilterOutcomeCallable CloudWatchLogsClient::PutSubscriptionFilterCallable(PutSubscriptionFilterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::PutSubscriptionFilter, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::PutSubscriptionFilterAsync(PutSubscriptionFilterRequest&& request, const PutSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::PutSubscriptionFilterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::PutSubscriptionFilterAsyncHelper(const PutSubscriptionFilterRequest& request, const PutSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutSubscriptionFilter(request), context);
@@ -878,7 +1118,7 @@ TestMetricFilterOutcome CloudWatchLogsClient::TestMetricFilter(const TestMetricF
 
 TestMetricFilterOutcomeCallable CloudWatchLogsClient::TestMetricFilterCallable(const TestMetricFilterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TestMetricFilter(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TestMetricFilter(request); } );
 }
 
 void CloudWatchLogsClient::TestMetricFilterAsync(const TestMetricFilterRequest& request, const TestMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -886,8 +1126,264 @@ void CloudWatchLogsClient::TestMetricFilterAsync(const TestMetricFilterRequest&
   m_executor->Submit( [this, request, handler, context](){ this->TestMetricFilterAsyncHelper( request, handler, context ); } );
 }
 
+TestMetricFilterOutcomeCallable CloudWatchLogsClient::TestMetricFilterCallable(TestMetricFilterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchLogsClient::TestMetricFilter, this, std::move(request)));
+}
+
+void CloudWatchLogsClient::TestMetricFilterAsync(TestMetricFilterRequest&& request, const TestMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchLogsClient::TestMetricFilterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchLogsClient::TestMetricFilterAsyncHelper(const TestMetricFilterRequest& request, const TestMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TestMetricFilter(request), context);
 }
 
+Paginator<CloudWatchLogsClient, DescribeDestinationsRequest, DescribeDestinationsOutcome> CloudWatchLogsClient::DescribeDestinationsPaginator(const DescribeDestinationsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudWatchLogsClient, DescribeDestinationsRequest, DescribeDestinationsOutcome>(this, &CloudWatchLogsClient::DescribeDestinations, request,
+    [](const DescribeDestinationsRequest& current, const DescribeDestinationsOutcome& outcome, DescribeDestinationsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudWatchLogsClient, DescribeExportTasksRequest, DescribeExportTasksOutcome> CloudWatchLogsClient::DescribeExportTasksPaginator(const DescribeExportTasksRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudWatchLogsClient, DescribeExportTasksRequest, DescribeExportTasksOutcome>(this, &CloudWatchLogsClient::DescribeExportTasks, request,
+    [](const DescribeExportTasksRequest& current, const DescribeExportTasksOutcome& outcome, DescribeExportTasksRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudWatchLogsClient, DescribeLogGroupsRequest, DescribeLogGroupsOutcome> CloudWatchLogsClient::DescribeLogGroupsPaginator(const DescribeLogGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudWatchLogsClient, DescribeLogGroupsRequest, DescribeLogGroupsOutcome>(this, &CloudWatchLogsClient::DescribeLogGroups, request,
+    [](const DescribeLogGroupsRequest& current, const DescribeLogGroupsOutcome& outcome, DescribeLogGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudWatchLogsClient, DescribeLogStreamsRequest, DescribeLogStreamsOutcome> CloudWatchLogsClient::DescribeLogStreamsPaginator(const DescribeLogStreamsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudWatchLogsClient, DescribeLogStreamsRequest, DescribeLogStreamsOutcome>(this, &CloudWatchLogsClient::DescribeLogStreams, request,
+    [](const DescribeLogStreamsRequest& current, const DescribeLogStreamsOutcome& outcome, DescribeLogStreamsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudWatchLogsClient, DescribeMetricFiltersRequest, DescribeMetricFiltersOutcome> CloudWatchLogsClient::DescribeMetricFiltersPaginator(const DescribeMetricFiltersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudWatchLogsClient, DescribeMetricFiltersRequest, DescribeMetricFiltersOutcome>(this, &CloudWatchLogsClient::DescribeMetricFilters, request,
+    [](const DescribeMetricFiltersRequest& current, const DescribeMetricFiltersOutcome& outcome, DescribeMetricFiltersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudWatchLogsClient, DescribeSubscriptionFiltersRequest, DescribeSubscriptionFiltersOutcome> CloudWatchLogsClient::DescribeSubscriptionFiltersPaginator(const DescribeSubscriptionFiltersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudWatchLogsClient, DescribeSubscriptionFiltersRequest, DescribeSubscriptionFiltersOutcome>(this, &CloudWatchLogsClient::DescribeSubscriptionFilters, request,
+    [](const DescribeSubscriptionFiltersRequest& current, const DescribeSubscriptionFiltersOutcome& outcome, DescribeSubscriptionFiltersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudWatchLogsClient, FilterLogEventsRequest, FilterLogEventsOutcome> CloudWatchLogsClient::FilterLogEventsPaginator(const FilterLogEventsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudWatchLogsClient, FilterLogEventsRequest, FilterLogEventsOutcome>(this, &CloudWatchLogsClient::FilterLogEvents, request,
+    [](const FilterLogEventsRequest& current, const FilterLogEventsOutcome& outcome, FilterLogEventsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<CloudWatchLogsClient, CancelExportTaskRequest, CancelExportTaskOutcome> CloudWatchLogsClient::CancelExportTaskAwaitable(CancelExportTaskRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::CancelExportTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, CreateExportTaskRequest, CreateExportTaskOutcome> CloudWatchLogsClient::CreateExportTaskAwaitable(CreateExportTaskRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::CreateExportTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, CreateLogGroupRequest, CreateLogGroupOutcome> CloudWatchLogsClient::CreateLogGroupAwaitable(CreateLogGroupRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::CreateLogGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, CreateLogStreamRequest, CreateLogStreamOutcome> CloudWatchLogsClient::CreateLogStreamAwaitable(CreateLogStreamRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::CreateLogStream, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, DeleteDestinationRequest, DeleteDestinationOutcome> CloudWatchLogsClient::DeleteDestinationAwaitable(DeleteDestinationRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::DeleteDestination, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, DeleteLogGroupRequest, DeleteLogGroupOutcome> CloudWatchLogsClient::DeleteLogGroupAwaitable(DeleteLogGroupRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::DeleteLogGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, DeleteLogStreamRequest, DeleteLogStreamOutcome> CloudWatchLogsClient::DeleteLogStreamAwaitable(DeleteLogStreamRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::DeleteLogStream, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, DeleteMetricFilterRequest, DeleteMetricFilterOutcome> CloudWatchLogsClient::DeleteMetricFilterAwaitable(DeleteMetricFilterRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::DeleteMetricFilter, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, DeleteRetentionPolicyRequest, DeleteRetentionPolicyOutcome> CloudWatchLogsClient::DeleteRetentionPolicyAwaitable(DeleteRetentionPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::DeleteRetentionPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, DeleteSubscriptionFilterRequest, DeleteSubscriptionFilterOutcome> CloudWatchLogsClient::DeleteSubscriptionFilterAwaitable(DeleteSubscriptionFilterRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::DeleteSubscriptionFilter, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, DescribeDestinationsRequest, DescribeDestinationsOutcome> CloudWatchLogsClient::DescribeDestinationsAwaitable(DescribeDestinationsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::DescribeDestinations, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, DescribeExportTasksRequest, DescribeExportTasksOutcome> CloudWatchLogsClient::DescribeExportTasksAwaitable(DescribeExportTasksRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::DescribeExportTasks, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, DescribeLogGroupsRequest, DescribeLogGroupsOutcome> CloudWatchLogsClient::DescribeLogGroupsAwaitable(DescribeLogGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::DescribeLogGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, DescribeLogStreamsRequest, DescribeLogStreamsOutcome> CloudWatchLogsClient::DescribeLogStreamsAwaitable(DescribeLogStreamsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::DescribeLogStreams, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, DescribeMetricFiltersRequest, DescribeMetricFiltersOutcome> CloudWatchLogsClient::DescribeMetricFiltersAwaitable(DescribeMetricFiltersRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::DescribeMetricFilters, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, DescribeSubscriptionFiltersRequest, DescribeSubscriptionFiltersOutcome> CloudWatchLogsClient::DescribeSubscriptionFiltersAwaitable(DescribeSubscriptionFiltersRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::DescribeSubscriptionFilters, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, FilterLogEventsRequest, FilterLogEventsOutcome> CloudWatchLogsClient::FilterLogEventsAwaitable(FilterLogEventsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::FilterLogEvents, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, GetLogEventsRequest, GetLogEventsOutcome> CloudWatchLogsClient::GetLogEventsAwaitable(GetLogEventsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::GetLogEvents, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, PutDestinationRequest, PutDestinationOutcome> CloudWatchLogsClient::PutDestinationAwaitable(PutDestinationRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::PutDestination, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, PutDestinationPolicyRequest, PutDestinationPolicyOutcome> CloudWatchLogsClient::PutDestinationPolicyAwaitable(PutDestinationPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::PutDestinationPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, PutLogEventsRequest, PutLogEventsOutcome> CloudWatchLogsClient::PutLogEventsAwaitable(PutLogEventsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::PutLogEvents, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, PutMetricFilterRequest, PutMetricFilterOutcome> CloudWatchLogsClient::PutMetricFilterAwaitable(PutMetricFilterRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::PutMetricFilter, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, PutRetentionPolicyRequest, PutRetentionPolicyOutcome> CloudWatchLogsClient::PutRetentionPolicyAwaitable(PutRetentionPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::PutRetentionPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, PutSubscriptionFilterRequest, PutSubscriptionFilterOutcome> CloudWatchLogsClient::PutSubscriptionFilterAwaitable(PutSubscriptionFilterRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::PutSubscriptionFilter, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchLogsClient, TestMetricFilterRequest, TestMetricFilterOutcome> CloudWatchLogsClient::TestMetricFilterAwaitable(TestMetricFilterRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchLogsClient::TestMetricFilter, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
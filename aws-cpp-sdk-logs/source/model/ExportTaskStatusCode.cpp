@@ -29,41 +29,41 @@ namespace Aws
       namespace ExportTaskStatusCodeMapper
       {
 
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int PENDING_CANCEL_HASH = HashingUtils::HashString("PENDING_CANCEL");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CANCELLED_HASH = -1031784143;
+        static const int COMPLETED_HASH = 1383663147;
+        static const int FAILED_HASH = 2066319421;
+        static const int PENDING_HASH = 35394935;
+        static const int PENDING_CANCEL_HASH = -2143599038;
+        static const int RUNNING_HASH = -2026200673;
 
 
         ExportTaskStatusCode GetExportTaskStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CANCELLED_HASH)
+          switch (hashCode)
           {
+          case CANCELLED_HASH:
             return ExportTaskStatusCode::CANCELLED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
+          case COMPLETED_HASH:
             return ExportTaskStatusCode::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return ExportTaskStatusCode::FAILED;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
+          case PENDING_HASH:
             return ExportTaskStatusCode::PENDING;
-          }
-          else if (hashCode == PENDING_CANCEL_HASH)
-          {
+          case PENDING_CANCEL_HASH:
             return ExportTaskStatusCode::PENDING_CANCEL;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
+          case RUNNING_HASH:
             return ExportTaskStatusCode::RUNNING;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace OrderByMapper
       {
 
-        static const int LogStreamName_HASH = HashingUtils::HashString("LogStreamName");
-        static const int LastEventTime_HASH = HashingUtils::HashString("LastEventTime");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int LogStreamName_HASH = 1015605359;
+        static const int LastEventTime_HASH = -963992975;
 
 
         OrderBy GetOrderByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LogStreamName_HASH)
+          switch (hashCode)
           {
+          case LogStreamName_HASH:
             return OrderBy::LogStreamName;
-          }
-          else if (hashCode == LastEventTime_HASH)
-          {
+          case LastEventTime_HASH:
             return OrderBy::LastEventTime;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
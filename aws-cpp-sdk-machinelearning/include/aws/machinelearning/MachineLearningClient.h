@@ -49,6 +49,9 @@
 #include <aws/machinelearning/model/UpdateEvaluationResult.h>
 #include <aws/machinelearning/model/UpdateMLModelResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -266,6 +269,18 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsCallable(const Model::AddTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsOutcomeCallable AddTagsCallable(Model::AddTagsRequest&& request) const;
+
+        /**
+         * Same as AddTagsAsync(const Model::AddTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsAsync(Model::AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates predictions for a group of observations. The observations to
          * process exist in one or more data files referenced by a <code>DataSource</code>.
@@ -324,6 +339,18 @@ namespace Model
          */
         virtual void CreateBatchPredictionAsync(const Model::CreateBatchPredictionRequest& request, const CreateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateBatchPredictionCallable(const Model::CreateBatchPredictionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateBatchPredictionOutcomeCallable CreateBatchPredictionCallable(Model::CreateBatchPredictionRequest&& request) const;
+
+        /**
+         * Same as CreateBatchPredictionAsync(const Model::CreateBatchPredictionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateBatchPredictionAsync(Model::CreateBatchPredictionRequest&& request, const CreateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <code>DataSource</code> object from an <a
          * href="http://aws.amazon.com/rds/"> Amazon Relational Database Service</a>
@@ -391,6 +418,18 @@ namespace Model
          */
         virtual void CreateDataSourceFromRDSAsync(const Model::CreateDataSourceFromRDSRequest& request, const CreateDataSourceFromRDSResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDataSourceFromRDSCallable(const Model::CreateDataSourceFromRDSRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDataSourceFromRDSOutcomeCallable CreateDataSourceFromRDSCallable(Model::CreateDataSourceFromRDSRequest&& request) const;
+
+        /**
+         * Same as CreateDataSourceFromRDSAsync(const Model::CreateDataSourceFromRDSRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDataSourceFromRDSAsync(Model::CreateDataSourceFromRDSRequest&& request, const CreateDataSourceFromRDSResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <code>DataSource</code> from a database hosted on an Amazon
          * Redshift cluster. A <code>DataSource</code> references data that can be used to
@@ -512,6 +551,18 @@ namespace Model
          */
         virtual void CreateDataSourceFromRedshiftAsync(const Model::CreateDataSourceFromRedshiftRequest& request, const CreateDataSourceFromRedshiftResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDataSourceFromRedshiftCallable(const Model::CreateDataSourceFromRedshiftRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDataSourceFromRedshiftOutcomeCallable CreateDataSourceFromRedshiftCallable(Model::CreateDataSourceFromRedshiftRequest&& request) const;
+
+        /**
+         * Same as CreateDataSourceFromRedshiftAsync(const Model::CreateDataSourceFromRedshiftRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDataSourceFromRedshiftAsync(Model::CreateDataSourceFromRedshiftRequest&& request, const CreateDataSourceFromRedshiftResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <code>DataSource</code> object. A <code>DataSource</code>
          * references data that can be used to perform <code>CreateMLModel</code>,
@@ -615,6 +666,18 @@ namespace Model
          */
         virtual void CreateDataSourceFromS3Async(const Model::CreateDataSourceFromS3Request& request, const CreateDataSourceFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDataSourceFromS3Callable(const Model::CreateDataSourceFromS3Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDataSourceFromS3OutcomeCallable CreateDataSourceFromS3Callable(Model::CreateDataSourceFromS3Request&& request) const;
+
+        /**
+         * Same as CreateDataSourceFromS3Async(const Model::CreateDataSourceFromS3Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDataSourceFromS3Async(Model::CreateDataSourceFromS3Request&& request, const CreateDataSourceFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new <code>Evaluation</code> of an <code>MLModel</code>. An
          * <code>MLModel</code> is evaluated on a set of observations associated to a
@@ -682,6 +745,18 @@ namespace Model
          */
         virtual void CreateEvaluationAsync(const Model::CreateEvaluationRequest& request, const CreateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateEvaluationCallable(const Model::CreateEvaluationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateEvaluationOutcomeCallable CreateEvaluationCallable(Model::CreateEvaluationRequest&& request) const;
+
+        /**
+         * Same as CreateEvaluationAsync(const Model::CreateEvaluationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateEvaluationAsync(Model::CreateEvaluationRequest&& request, const CreateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new <code>MLModel</code> using the <code>DataSource</code> and the
          * recipe as information sources. </p> <p>An <code>MLModel</code> is nearly
@@ -746,6 +821,18 @@ namespace Model
          */
         virtual void CreateMLModelAsync(const Model::CreateMLModelRequest& request, const CreateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateMLModelCallable(const Model::CreateMLModelRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateMLModelOutcomeCallable CreateMLModelCallable(Model::CreateMLModelRequest&& request) const;
+
+        /**
+         * Same as CreateMLModelAsync(const Model::CreateMLModelRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateMLModelAsync(Model::CreateMLModelRequest&& request, const CreateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a real-time endpoint for the <code>MLModel</code>. The endpoint
          * contains the URI of the <code>MLModel</code>; that is, the location to send
@@ -771,6 +858,18 @@ namespace Model
          */
         virtual void CreateRealtimeEndpointAsync(const Model::CreateRealtimeEndpointRequest& request, const CreateRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRealtimeEndpointCallable(const Model::CreateRealtimeEndpointRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateRealtimeEndpointOutcomeCallable CreateRealtimeEndpointCallable(Model::CreateRealtimeEndpointRequest&& request) const;
+
+        /**
+         * Same as CreateRealtimeEndpointAsync(const Model::CreateRealtimeEndpointRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateRealtimeEndpointAsync(Model::CreateRealtimeEndpointRequest&& request, const CreateRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Assigns the DELETED status to a <code>BatchPrediction</code>, rendering it
          * unusable.</p> <p>After using the <code>DeleteBatchPrediction</code> operation,
@@ -802,6 +901,18 @@ namespace Model
          */
         virtual void DeleteBatchPredictionAsync(const Model::DeleteBatchPredictionRequest& request, const DeleteBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBatchPredictionCallable(const Model::DeleteBatchPredictionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteBatchPredictionOutcomeCallable DeleteBatchPredictionCallable(Model::DeleteBatchPredictionRequest&& request) const;
+
+        /**
+         * Same as DeleteBatchPredictionAsync(const Model::DeleteBatchPredictionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteBatchPredictionAsync(Model::DeleteBatchPredictionRequest&& request, const DeleteBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Assigns the DELETED status to a <code>DataSource</code>, rendering it
          * unusable.</p> <p>After using the <code>DeleteDataSource</code> operation, you
@@ -833,6 +944,18 @@ namespace Model
          */
         virtual void DeleteDataSourceAsync(const Model::DeleteDataSourceRequest& request, const DeleteDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDataSourceCallable(const Model::DeleteDataSourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDataSourceOutcomeCallable DeleteDataSourceCallable(Model::DeleteDataSourceRequest&& request) const;
+
+        /**
+         * Same as DeleteDataSourceAsync(const Model::DeleteDataSourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDataSourceAsync(Model::DeleteDataSourceRequest&& request, const DeleteDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Assigns the <code>DELETED</code> status to an <code>Evaluation</code>,
          * rendering it unusable.</p> <p>After invoking the <code>DeleteEvaluation</code>
@@ -867,6 +990,18 @@ namespace Model
          */
         virtual void DeleteEvaluationAsync(const Model::DeleteEvaluationRequest& request, const DeleteEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteEvaluationCallable(const Model::DeleteEvaluationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteEvaluationOutcomeCallable DeleteEvaluationCallable(Model::DeleteEvaluationRequest&& request) const;
+
+        /**
+         * Same as DeleteEvaluationAsync(const Model::DeleteEvaluationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteEvaluationAsync(Model::DeleteEvaluationRequest&& request, const DeleteEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Assigns the <code>DELETED</code> status to an <code>MLModel</code>, rendering
          * it unusable.</p> <p>After using the <code>DeleteMLModel</code> operation, you
@@ -898,6 +1033,18 @@ namespace Model
          */
         virtual void DeleteMLModelAsync(const Model::DeleteMLModelRequest& request, const DeleteMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteMLModelCallable(const Model::DeleteMLModelRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteMLModelOutcomeCallable DeleteMLModelCallable(Model::DeleteMLModelRequest&& request) const;
+
+        /**
+         * Same as DeleteMLModelAsync(const Model::DeleteMLModelRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteMLModelAsync(Model::DeleteMLModelRequest&& request, const DeleteMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a real time endpoint of an <code>MLModel</code>.</p>
          */
@@ -917,6 +1064,18 @@ namespace Model
          */
         virtual void DeleteRealtimeEndpointAsync(const Model::DeleteRealtimeEndpointRequest& request, const DeleteRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRealtimeEndpointCallable(const Model::DeleteRealtimeEndpointRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRealtimeEndpointOutcomeCallable DeleteRealtimeEndpointCallable(Model::DeleteRealtimeEndpointRequest&& request) const;
+
+        /**
+         * Same as DeleteRealtimeEndpointAsync(const Model::DeleteRealtimeEndpointRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRealtimeEndpointAsync(Model::DeleteRealtimeEndpointRequest&& request, const DeleteRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified tags associated with an ML object. After this operation
          * is complete, you can't recover deleted tags.</p> <p>If you specify a tag that
@@ -942,6 +1101,18 @@ namespace Model
          */
         virtual void DeleteTagsAsync(const Model::DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTagsCallable(const Model::DeleteTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTagsOutcomeCallable DeleteTagsCallable(Model::DeleteTagsRequest&& request) const;
+
+        /**
+         * Same as DeleteTagsAsync(const Model::DeleteTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTagsAsync(Model::DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of <code>BatchPrediction</code> operations that match the
          * search criteria in the request.</p>
@@ -964,6 +1135,18 @@ namespace Model
          */
         virtual void DescribeBatchPredictionsAsync(const Model::DescribeBatchPredictionsRequest& request, const DescribeBatchPredictionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeBatchPredictionsCallable(const Model::DescribeBatchPredictionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeBatchPredictionsOutcomeCallable DescribeBatchPredictionsCallable(Model::DescribeBatchPredictionsRequest&& request) const;
+
+        /**
+         * Same as DescribeBatchPredictionsAsync(const Model::DescribeBatchPredictionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeBatchPredictionsAsync(Model::DescribeBatchPredictionsRequest&& request, const DescribeBatchPredictionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of <code>DataSource</code> that match the search criteria in
          * the request.</p>
@@ -986,6 +1169,18 @@ namespace Model
          */
         virtual void DescribeDataSourcesAsync(const Model::DescribeDataSourcesRequest& request, const DescribeDataSourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDataSourcesCallable(const Model::DescribeDataSourcesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDataSourcesOutcomeCallable DescribeDataSourcesCallable(Model::DescribeDataSourcesRequest&& request) const;
+
+        /**
+         * Same as DescribeDataSourcesAsync(const Model::DescribeDataSourcesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDataSourcesAsync(Model::DescribeDataSourcesRequest&& request, const DescribeDataSourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of <code>DescribeEvaluations</code> that match the search
          * criteria in the request.</p>
@@ -1008,6 +1203,18 @@ namespace Model
          */
         virtual void DescribeEvaluationsAsync(const Model::DescribeEvaluationsRequest& request, const DescribeEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEvaluationsCallable(const Model::DescribeEvaluationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEvaluationsOutcomeCallable DescribeEvaluationsCallable(Model::DescribeEvaluationsRequest&& request) const;
+
+        /**
+         * Same as DescribeEvaluationsAsync(const Model::DescribeEvaluationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEvaluationsAsync(Model::DescribeEvaluationsRequest&& request, const DescribeEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of <code>MLModel</code> that match the search criteria in the
          * request.</p>
@@ -1030,6 +1237,18 @@ namespace Model
          */
         virtual void DescribeMLModelsAsync(const Model::DescribeMLModelsRequest& request, const DescribeMLModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeMLModelsCallable(const Model::DescribeMLModelsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeMLModelsOutcomeCallable DescribeMLModelsCallable(Model::DescribeMLModelsRequest&& request) const;
+
+        /**
+         * Same as DescribeMLModelsAsync(const Model::DescribeMLModelsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeMLModelsAsync(Model::DescribeMLModelsRequest&& request, const DescribeMLModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of the tags for your Amazon ML object.</p>
          */
@@ -1049,6 +1268,18 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTagsCallable(const Model::DescribeTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(Model::DescribeTagsRequest&& request) const;
+
+        /**
+         * Same as DescribeTagsAsync(const Model::DescribeTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTagsAsync(Model::DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a <code>BatchPrediction</code> that includes detailed metadata,
          * status, and data file information for a <code>Batch Prediction</code>
@@ -1074,6 +1305,18 @@ namespace Model
          */
         virtual void GetBatchPredictionAsync(const Model::GetBatchPredictionRequest& request, const GetBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBatchPredictionCallable(const Model::GetBatchPredictionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBatchPredictionOutcomeCallable GetBatchPredictionCallable(Model::GetBatchPredictionRequest&& request) const;
+
+        /**
+         * Same as GetBatchPredictionAsync(const Model::GetBatchPredictionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBatchPredictionAsync(Model::GetBatchPredictionRequest&& request, const GetBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a <code>DataSource</code> that includes metadata and data file
          * information, as well as the current status of the <code>DataSource</code>.</p>
@@ -1105,6 +1348,18 @@ namespace Model
          */
         virtual void GetDataSourceAsync(const Model::GetDataSourceRequest& request, const GetDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDataSourceCallable(const Model::GetDataSourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDataSourceOutcomeCallable GetDataSourceCallable(Model::GetDataSourceRequest&& request) const;
+
+        /**
+         * Same as GetDataSourceAsync(const Model::GetDataSourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDataSourceAsync(Model::GetDataSourceRequest&& request, const GetDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an <code>Evaluation</code> that includes metadata as well as the
          * current status of the <code>Evaluation</code>.</p>
@@ -1127,6 +1382,18 @@ namespace Model
          */
         virtual void GetEvaluationAsync(const Model::GetEvaluationRequest& request, const GetEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetEvaluationCallable(const Model::GetEvaluationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetEvaluationOutcomeCallable GetEvaluationCallable(Model::GetEvaluationRequest&& request) const;
+
+        /**
+         * Same as GetEvaluationAsync(const Model::GetEvaluationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetEvaluationAsync(Model::GetEvaluationRequest&& request, const GetEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an <code>MLModel</code> that includes detailed metadata, data source
          * information, and the current status of the <code>MLModel</code>.</p>
@@ -1152,6 +1419,18 @@ namespace Model
          */
         virtual void GetMLModelAsync(const Model::GetMLModelRequest& request, const GetMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetMLModelCallable(const Model::GetMLModelRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetMLModelOutcomeCallable GetMLModelCallable(Model::GetMLModelRequest&& request) const;
+
+        /**
+         * Same as GetMLModelAsync(const Model::GetMLModelRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetMLModelAsync(Model::GetMLModelRequest&& request, const GetMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates a prediction for the observation using the specified <code>ML
          * Model</code>.</p> <note><title>Note</title> <p>Not all response parameters will
@@ -1180,6 +1459,18 @@ namespace Model
          */
         virtual void PredictAsync(const Model::PredictRequest& request, const PredictResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PredictCallable(const Model::PredictRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PredictOutcomeCallable PredictCallable(Model::PredictRequest&& request) const;
+
+        /**
+         * Same as PredictAsync(const Model::PredictRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PredictAsync(Model::PredictRequest&& request, const PredictResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the <code>BatchPredictionName</code> of a
          * <code>BatchPrediction</code>.</p> <p>You can use the
@@ -1208,6 +1499,18 @@ namespace Model
          */
         virtual void UpdateBatchPredictionAsync(const Model::UpdateBatchPredictionRequest& request, const UpdateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateBatchPredictionCallable(const Model::UpdateBatchPredictionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateBatchPredictionOutcomeCallable UpdateBatchPredictionCallable(Model::UpdateBatchPredictionRequest&& request) const;
+
+        /**
+         * Same as UpdateBatchPredictionAsync(const Model::UpdateBatchPredictionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateBatchPredictionAsync(Model::UpdateBatchPredictionRequest&& request, const UpdateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the <code>DataSourceName</code> of a <code>DataSource</code>.</p>
          * <p>You can use the <code>GetDataSource</code> operation to view the contents of
@@ -1233,6 +1536,18 @@ namespace Model
          */
         virtual void UpdateDataSourceAsync(const Model::UpdateDataSourceRequest& request, const UpdateDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDataSourceCallable(const Model::UpdateDataSourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateDataSourceOutcomeCallable UpdateDataSourceCallable(Model::UpdateDataSourceRequest&& request) const;
+
+        /**
+         * Same as UpdateDataSourceAsync(const Model::UpdateDataSourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateDataSourceAsync(Model::UpdateDataSourceRequest&& request, const UpdateDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the <code>EvaluationName</code> of an <code>Evaluation</code>.</p>
          * <p>You can use the <code>GetEvaluation</code> operation to view the contents of
@@ -1258,6 +1573,18 @@ namespace Model
          */
         virtual void UpdateEvaluationAsync(const Model::UpdateEvaluationRequest& request, const UpdateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateEvaluationCallable(const Model::UpdateEvaluationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateEvaluationOutcomeCallable UpdateEvaluationCallable(Model::UpdateEvaluationRequest&& request) const;
+
+        /**
+         * Same as UpdateEvaluationAsync(const Model::UpdateEvaluationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateEvaluationAsync(Model::UpdateEvaluationRequest&& request, const UpdateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the <code>MLModelName</code> and the <code>ScoreThreshold</code> of
          * an <code>MLModel</code>.</p> <p>You can use the <code>GetMLModel</code>
@@ -1283,6 +1610,180 @@ namespace Model
          */
         virtual void UpdateMLModelAsync(const Model::UpdateMLModelRequest& request, const UpdateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateMLModelCallable(const Model::UpdateMLModelRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateMLModelOutcomeCallable UpdateMLModelCallable(Model::UpdateMLModelRequest&& request) const;
+
+        /**
+         * Same as UpdateMLModelAsync(const Model::UpdateMLModelRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateMLModelAsync(Model::UpdateMLModelRequest&& request, const UpdateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeBatchPredictions(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<MachineLearningClient, Model::DescribeBatchPredictionsRequest, Model::DescribeBatchPredictionsOutcome> DescribeBatchPredictionsPaginator(const Model::DescribeBatchPredictionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeDataSources(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<MachineLearningClient, Model::DescribeDataSourcesRequest, Model::DescribeDataSourcesOutcome> DescribeDataSourcesPaginator(const Model::DescribeDataSourcesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeEvaluations(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<MachineLearningClient, Model::DescribeEvaluationsRequest, Model::DescribeEvaluationsOutcome> DescribeEvaluationsPaginator(const Model::DescribeEvaluationsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeMLModels(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<MachineLearningClient, Model::DescribeMLModelsRequest, Model::DescribeMLModelsOutcome> DescribeMLModelsPaginator(const Model::DescribeMLModelsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::AddTagsRequest, Model::AddTagsOutcome> AddTagsAwaitable(Model::AddTagsRequest request) const;
+
+        /**
+         * co_await-able form of CreateBatchPrediction(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::CreateBatchPredictionRequest, Model::CreateBatchPredictionOutcome> CreateBatchPredictionAwaitable(Model::CreateBatchPredictionRequest request) const;
+
+        /**
+         * co_await-able form of CreateDataSourceFromRDS(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::CreateDataSourceFromRDSRequest, Model::CreateDataSourceFromRDSOutcome> CreateDataSourceFromRDSAwaitable(Model::CreateDataSourceFromRDSRequest request) const;
+
+        /**
+         * co_await-able form of CreateDataSourceFromRedshift(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::CreateDataSourceFromRedshiftRequest, Model::CreateDataSourceFromRedshiftOutcome> CreateDataSourceFromRedshiftAwaitable(Model::CreateDataSourceFromRedshiftRequest request) const;
+
+        /**
+         * co_await-able form of CreateDataSourceFromS3(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::CreateDataSourceFromS3Request, Model::CreateDataSourceFromS3Outcome> CreateDataSourceFromS3Awaitable(Model::CreateDataSourceFromS3Request request) const;
+
+        /**
+         * co_await-able form of CreateEvaluation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::CreateEvaluationRequest, Model::CreateEvaluationOutcome> CreateEvaluationAwaitable(Model::CreateEvaluationRequest request) const;
+
+        /**
+         * co_await-able form of CreateMLModel(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::CreateMLModelRequest, Model::CreateMLModelOutcome> CreateMLModelAwaitable(Model::CreateMLModelRequest request) const;
+
+        /**
+         * co_await-able form of CreateRealtimeEndpoint(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::CreateRealtimeEndpointRequest, Model::CreateRealtimeEndpointOutcome> CreateRealtimeEndpointAwaitable(Model::CreateRealtimeEndpointRequest request) const;
+
+        /**
+         * co_await-able form of DeleteBatchPrediction(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::DeleteBatchPredictionRequest, Model::DeleteBatchPredictionOutcome> DeleteBatchPredictionAwaitable(Model::DeleteBatchPredictionRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDataSource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::DeleteDataSourceRequest, Model::DeleteDataSourceOutcome> DeleteDataSourceAwaitable(Model::DeleteDataSourceRequest request) const;
+
+        /**
+         * co_await-able form of DeleteEvaluation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::DeleteEvaluationRequest, Model::DeleteEvaluationOutcome> DeleteEvaluationAwaitable(Model::DeleteEvaluationRequest request) const;
+
+        /**
+         * co_await-able form of DeleteMLModel(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::DeleteMLModelRequest, Model::DeleteMLModelOutcome> DeleteMLModelAwaitable(Model::DeleteMLModelRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRealtimeEndpoint(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::DeleteRealtimeEndpointRequest, Model::DeleteRealtimeEndpointOutcome> DeleteRealtimeEndpointAwaitable(Model::DeleteRealtimeEndpointRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::DeleteTagsRequest, Model::DeleteTagsOutcome> DeleteTagsAwaitable(Model::DeleteTagsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeBatchPredictions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::DescribeBatchPredictionsRequest, Model::DescribeBatchPredictionsOutcome> DescribeBatchPredictionsAwaitable(Model::DescribeBatchPredictionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDataSources(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::DescribeDataSourcesRequest, Model::DescribeDataSourcesOutcome> DescribeDataSourcesAwaitable(Model::DescribeDataSourcesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEvaluations(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::DescribeEvaluationsRequest, Model::DescribeEvaluationsOutcome> DescribeEvaluationsAwaitable(Model::DescribeEvaluationsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeMLModels(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::DescribeMLModelsRequest, Model::DescribeMLModelsOutcome> DescribeMLModelsAwaitable(Model::DescribeMLModelsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::DescribeTagsRequest, Model::DescribeTagsOutcome> DescribeTagsAwaitable(Model::DescribeTagsRequest request) const;
+
+        /**
+         * co_await-able form of GetBatchPrediction(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::GetBatchPredictionRequest, Model::GetBatchPredictionOutcome> GetBatchPredictionAwaitable(Model::GetBatchPredictionRequest request) const;
+
+        /**
+         * co_await-able form of GetDataSource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::GetDataSourceRequest, Model::GetDataSourceOutcome> GetDataSourceAwaitable(Model::GetDataSourceRequest request) const;
+
+        /**
+         * co_await-able form of GetEvaluation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::GetEvaluationRequest, Model::GetEvaluationOutcome> GetEvaluationAwaitable(Model::GetEvaluationRequest request) const;
+
+        /**
+         * co_await-able form of GetMLModel(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::GetMLModelRequest, Model::GetMLModelOutcome> GetMLModelAwaitable(Model::GetMLModelRequest request) const;
+
+        /**
+         * co_await-able form of Predict(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::PredictRequest, Model::PredictOutcome> PredictAwaitable(Model::PredictRequest request) const;
+
+        /**
+         * co_await-able form of UpdateBatchPrediction(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::UpdateBatchPredictionRequest, Model::UpdateBatchPredictionOutcome> UpdateBatchPredictionAwaitable(Model::UpdateBatchPredictionRequest request) const;
+
+        /**
+         * co_await-able form of UpdateDataSource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::UpdateDataSourceRequest, Model::UpdateDataSourceOutcome> UpdateDataSourceAwaitable(Model::UpdateDataSourceRequest request) const;
+
+        /**
+         * co_await-able form of UpdateEvaluation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::UpdateEvaluationRequest, Model::UpdateEvaluationOutcome> UpdateEvaluationAwaitable(Model::UpdateEvaluationRequest request) const;
+
+        /**
+         * co_await-able form of UpdateMLModel(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MachineLearningClient, Model::UpdateMLModelRequest, Model::UpdateMLModelOutcome> UpdateMLModelAwaitable(Model::UpdateMLModelRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateBatchPredictionRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateBatchPrediction"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateDataSourceFromRDSRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDataSourceFromRDS"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
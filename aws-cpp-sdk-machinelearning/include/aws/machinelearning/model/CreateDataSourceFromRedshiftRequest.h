@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateDataSourceFromRedshiftRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDataSourceFromRedshift"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateDataSourceFromS3Request();
+    inline const char* GetServiceRequestName() const override { return "CreateDataSourceFromS3"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
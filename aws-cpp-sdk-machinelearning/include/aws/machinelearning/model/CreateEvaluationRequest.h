@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateEvaluationRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateEvaluation"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
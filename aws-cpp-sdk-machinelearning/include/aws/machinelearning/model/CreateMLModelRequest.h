@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateMLModelRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateMLModel"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateRealtimeEndpointRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateRealtimeEndpoint"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
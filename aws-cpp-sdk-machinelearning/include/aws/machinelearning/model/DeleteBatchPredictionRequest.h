@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteBatchPredictionRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteBatchPrediction"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
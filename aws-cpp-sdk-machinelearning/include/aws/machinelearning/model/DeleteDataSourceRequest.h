@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteDataSourceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDataSource"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteEvaluationRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteEvaluation"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
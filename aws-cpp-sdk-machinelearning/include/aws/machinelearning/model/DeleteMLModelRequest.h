@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteMLModelRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteMLModel"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
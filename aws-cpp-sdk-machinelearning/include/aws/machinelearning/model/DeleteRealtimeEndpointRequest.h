@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteRealtimeEndpointRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteRealtimeEndpoint"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
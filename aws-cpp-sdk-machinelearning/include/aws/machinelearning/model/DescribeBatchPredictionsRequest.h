@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeBatchPredictionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeBatchPredictions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeDataSourcesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDataSources"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
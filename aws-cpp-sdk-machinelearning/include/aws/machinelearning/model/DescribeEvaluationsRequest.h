@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeEvaluationsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEvaluations"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeMLModelsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeMLModels"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
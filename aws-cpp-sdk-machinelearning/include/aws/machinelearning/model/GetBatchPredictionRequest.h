@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetBatchPredictionRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBatchPrediction"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetDataSourceRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDataSource"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
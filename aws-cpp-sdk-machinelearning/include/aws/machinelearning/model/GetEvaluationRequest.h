@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetEvaluationRequest();
+    inline const char* GetServiceRequestName() const override { return "GetEvaluation"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetMLModelRequest();
+    inline const char* GetServiceRequestName() const override { return "GetMLModel"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
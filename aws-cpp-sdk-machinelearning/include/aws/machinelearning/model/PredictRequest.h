@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PredictRequest();
+    inline const char* GetServiceRequestName() const override { return "Predict"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateBatchPredictionRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateBatchPrediction"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
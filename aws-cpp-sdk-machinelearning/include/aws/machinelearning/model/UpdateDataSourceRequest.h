@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateDataSourceRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateDataSource"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
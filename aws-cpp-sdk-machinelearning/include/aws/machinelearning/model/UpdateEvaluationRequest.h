@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateEvaluationRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateEvaluation"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
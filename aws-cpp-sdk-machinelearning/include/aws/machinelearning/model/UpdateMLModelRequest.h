@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateMLModelRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateMLModel"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -138,7 +138,7 @@ AddTagsOutcome MachineLearningClient::AddTags(const AddTagsRequest& request) con
 
 AddTagsOutcomeCallable MachineLearningClient::AddTagsCallable(const AddTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTags( request ); } );
 }
 
 void MachineLearningClient::AddTagsAsync(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -146,6 +146,16 @@ void MachineLearningClient::AddTagsAsync(const AddTagsRequest& request, const Ad
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsAsyncHelper(request, handler, context); } );
 }
 
+AddTagsOutcomeCallable MachineLearningClient::AddTagsCallable(AddTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::AddTags, this, std::move(request)));
+}
+
+void MachineLearningClient::AddTagsAsync(AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::AddTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::AddTagsAsyncHelper(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTags(request), context);
@@ -169,7 +179,7 @@ CreateBatchPredictionOutcome MachineLearningClient::CreateBatchPrediction(const
 
 CreateBatchPredictionOutcomeCallable MachineLearningClient::CreateBatchPredictionCallable(const CreateBatchPredictionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateBatchPrediction( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateBatchPrediction( request ); } );
 }
 
 void MachineLearningClient::CreateBatchPredictionAsync(const CreateBatchPredictionRequest& request, const CreateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -177,6 +187,16 @@ void MachineLearningClient::CreateBatchPredictionAsync(const CreateBatchPredicti
   m_executor->Submit( [this, request, handler, context](){ this->CreateBatchPredictionAsyncHelper(request, handler, context); } );
 }
 
+CreateBatchPredictionOutcomeCallable MachineLearningClient::CreateBatchPredictionCallable(CreateBatchPredictionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::CreateBatchPrediction, this, std::move(request)));
+}
+
+void MachineLearningClient::CreateBatchPredictionAsync(CreateBatchPredictionRequest&& request, const CreateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::CreateBatchPredictionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::CreateBatchPredictionAsyncHelper(const CreateBatchPredictionRequest& request, const CreateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateBatchPrediction(request), context);
@@ -200,7 +220,7 @@ CreateDataSourceFromRDSOutcome MachineLearningClient::CreateDataSourceFromRDS(co
 
 CreateDataSourceFromRDSOutcomeCallable MachineLearningClient::CreateDataSourceFromRDSCallable(const CreateDataSourceFromRDSRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDataSourceFromRDS( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDataSourceFromRDS( request ); } );
 }
 
 void MachineLearningClient::CreateDataSourceFromRDSAsync(const CreateDataSourceFromRDSRequest& request, const CreateDataSourceFromRDSResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -208,6 +228,16 @@ void MachineLearningClient::CreateDataSourceFromRDSAsync(const CreateDataSourceF
   m_executor->Submit( [this, request, handler, context](){ this->CreateDataSourceFromRDSAsyncHelper(request, handler, context); } );
 }
 
+CreateDataSourceFromRDSOutcomeCallable MachineLearningClient::CreateDataSourceFromRDSCallable(CreateDataSourceFromRDSRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::CreateDataSourceFromRDS, this, std::move(request)));
+}
+
+void MachineLearningClient::CreateDataSourceFromRDSAsync(CreateDataSourceFromRDSRequest&& request, const CreateDataSourceFromRDSResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::CreateDataSourceFromRDSAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::CreateDataSourceFromRDSAsyncHelper(const CreateDataSourceFromRDSRequest& request, const CreateDataSourceFromRDSResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDataSourceFromRDS(request), context);
@@ -231,7 +261,7 @@ CreateDataSourceFromRedshiftOutcome MachineLearningClient::CreateDataSourceFromR
 
 CreateDataSourceFromRedshiftOutcomeCallable MachineLearningClient::CreateDataSourceFromRedshiftCallable(const CreateDataSourceFromRedshiftRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDataSourceFromRedshift( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDataSourceFromRedshift( request ); } );
 }
 
 void MachineLearningClient::CreateDataSourceFromRedshiftAsync(const CreateDataSourceFromRedshiftRequest& request, const CreateDataSourceFromRedshiftResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -239,6 +269,16 @@ void MachineLearningClient::CreateDataSourceFromRedshiftAsync(const CreateDataSo
   m_executor->Submit( [this, request, handler, context](){ this->CreateDataSourceFromRedshiftAsyncHelper(request, handler, context); } );
 }
 
+CreateDataSourceFromRedshiftOutcomeCallable MachineLearningClient::CreateDataSourceFromRedshiftCallable(CreateDataSourceFromRedshiftRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::CreateDataSourceFromRedshift, this, std::move(request)));
+}
+
+void MachineLearningClient::CreateDataSourceFromRedshiftAsync(CreateDataSourceFromRedshiftRequest&& request, const CreateDataSourceFromRedshiftResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::CreateDataSourceFromRedshiftAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::CreateDataSourceFromRedshiftAsyncHelper(const CreateDataSourceFromRedshiftRequest& request, const CreateDataSourceFromRedshiftResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDataSourceFromRedshift(request), context);
@@ -262,7 +302,7 @@ CreateDataSourceFromS3Outcome MachineLearningClient::CreateDataSourceFromS3(cons
 
 CreateDataSourceFromS3OutcomeCallable MachineLearningClient::CreateDataSourceFromS3Callable(const CreateDataSourceFromS3Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDataSourceFromS3( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDataSourceFromS3( request ); } );
 }
 
 void MachineLearningClient::CreateDataSourceFromS3Async(const CreateDataSourceFromS3Request& request, const CreateDataSourceFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -270,6 +310,16 @@ void MachineLearningClient::CreateDataSourceFromS3Async(const CreateDataSourceFr
   m_executor->Submit( [this, request, handler, context](){ this->CreateDataSourceFromS3AsyncHelper(request, handler, context); } );
 }
 
+CreateDataSourceFromS3OutcomeCallable MachineLearningClient::CreateDataSourceFromS3Callable(CreateDataSourceFromS3Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::CreateDataSourceFromS3, this, std::move(request)));
+}
+
+void MachineLearningClient::CreateDataSourceFromS3Async(CreateDataSourceFromS3Request&& request, const CreateDataSourceFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::CreateDataSourceFromS3AsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::CreateDataSourceFromS3AsyncHelper(const CreateDataSourceFromS3Request& request, const CreateDataSourceFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDataSourceFromS3(request), context);
@@ -293,7 +343,7 @@ CreateEvaluationOutcome MachineLearningClient::CreateEvaluation(const CreateEval
 
 CreateEvaluationOutcomeCallable MachineLearningClient::CreateEvaluationCallable(const CreateEvaluationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateEvaluation( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateEvaluation( request ); } );
 }
 
 void MachineLearningClient::CreateEvaluationAsync(const CreateEvaluationRequest& request, const CreateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -301,6 +351,16 @@ void MachineLearningClient::CreateEvaluationAsync(const CreateEvaluationRequest&
   m_executor->Submit( [this, request, handler, context](){ this->CreateEvaluationAsyncHelper(request, handler, context); } );
 }
 
+CreateEvaluationOutcomeCallable MachineLearningClient::CreateEvaluationCallable(CreateEvaluationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::CreateEvaluation, this, std::move(request)));
+}
+
+void MachineLearningClient::CreateEvaluationAsync(CreateEvaluationRequest&& request, const CreateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::CreateEvaluationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::CreateEvaluationAsyncHelper(const CreateEvaluationRequest& request, const CreateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateEvaluation(request), context);
@@ -324,7 +384,7 @@ CreateMLModelOutcome MachineLearningClient::CreateMLModel(const CreateMLModelReq
 
 CreateMLModelOutcomeCallable MachineLearningClient::CreateMLModelCallable(const CreateMLModelRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateMLModel( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateMLModel( request ); } );
 }
 
 void MachineLearningClient::CreateMLModelAsync(const CreateMLModelRequest& request, const CreateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -332,6 +392,16 @@ void MachineLearningClient::CreateMLModelAsync(const CreateMLModelRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->CreateMLModelAsyncHelper(request, handler, context); } );
 }
 
+CreateMLModelOutcomeCallable MachineLearningClient::CreateMLModelCallable(CreateMLModelRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::CreateMLModel, this, std::move(request)));
+}
+
+void MachineLearningClient::CreateMLModelAsync(CreateMLModelRequest&& request, const CreateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::CreateMLModelAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::CreateMLModelAsyncHelper(const CreateMLModelRequest& request, const CreateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateMLModel(request), context);
@@ -355,7 +425,7 @@ CreateRealtimeEndpointOutcome MachineLearningClient::CreateRealtimeEndpoint(cons
 
 CreateRealtimeEndpointOutcomeCallable MachineLearningClient::CreateRealtimeEndpointCallable(const CreateRealtimeEndpointRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateRealtimeEndpoint( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateRealtimeEndpoint( request ); } );
 }
 
 void MachineLearningClient::CreateRealtimeEndpointAsync(const CreateRealtimeEndpointRequest& request, const CreateRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -363,6 +433,16 @@ void MachineLearningClient::CreateRealtimeEndpointAsync(const CreateRealtimeEndp
   m_executor->Submit( [this, request, handler, context](){ this->CreateRealtimeEndpointAsyncHelper(request, handler, context); } );
 }
 
+CreateRealtimeEndpointOutcomeCallable MachineLearningClient::CreateRealtimeEndpointCallable(CreateRealtimeEndpointRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::CreateRealtimeEndpoint, this, std::move(request)));
+}
+
+void MachineLearningClient::CreateRealtimeEndpointAsync(CreateRealtimeEndpointRequest&& request, const CreateRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::CreateRealtimeEndpointAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::CreateRealtimeEndpointAsyncHelper(const CreateRealtimeEndpointRequest& request, const CreateRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateRealtimeEndpoint(request), context);
@@ -386,7 +466,7 @@ DeleteBatchPredictionOutcome MachineLearningClient::DeleteBatchPrediction(const
 
 DeleteBatchPredictionOutcomeCallable MachineLearningClient::DeleteBatchPredictionCallable(const DeleteBatchPredictionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteBatchPrediction( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteBatchPrediction( request ); } );
 }
 
 void MachineLearningClient::DeleteBatchPredictionAsync(const DeleteBatchPredictionRequest& request, const DeleteBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -394,6 +474,16 @@ void MachineLearningClient::DeleteBatchPredictionAsync(const DeleteBatchPredicti
   m_executor->Submit( [this, request, handler, context](){ this->DeleteBatchPredictionAsyncHelper(request, handler, context); } );
 }
 
+DeleteBatchPredictionOutcomeCallable MachineLearningClient::DeleteBatchPredictionCallable(DeleteBatchPredictionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::DeleteBatchPrediction, this, std::move(request)));
+}
+
+void MachineLearningClient::DeleteBatchPredictionAsync(DeleteBatchPredictionRequest&& request, const DeleteBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::DeleteBatchPredictionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::DeleteBatchPredictionAsyncHelper(const DeleteBatchPredictionRequest& request, const DeleteBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteBatchPrediction(request), context);
@@ -417,7 +507,7 @@ DeleteDataSourceOutcome MachineLearningClient::DeleteDataSource(const DeleteData
 
 DeleteDataSourceOutcomeCallable MachineLearningClient::DeleteDataSourceCallable(const DeleteDataSourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDataSource( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDataSource( request ); } );
 }
 
 void MachineLearningClient::DeleteDataSourceAsync(const DeleteDataSourceRequest& request, const DeleteDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -425,6 +515,16 @@ void MachineLearningClient::DeleteDataSourceAsync(const DeleteDataSourceRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDataSourceAsyncHelper(request, handler, context); } );
 }
 
+DeleteDataSourceOutcomeCallable MachineLearningClient::DeleteDataSourceCallable(DeleteDataSourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::DeleteDataSource, this, std::move(request)));
+}
+
+void MachineLearningClient::DeleteDataSourceAsync(DeleteDataSourceRequest&& request, const DeleteDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::DeleteDataSourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::DeleteDataSourceAsyncHelper(const DeleteDataSourceRequest& request, const DeleteDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDataSource(request), context);
@@ -448,7 +548,7 @@ DeleteEvaluationOutcome MachineLearningClient::DeleteEvaluation(const DeleteEval
 
 DeleteEvaluationOutcomeCallable MachineLearningClient::DeleteEvaluationCallable(const DeleteEvaluationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteEvaluation( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteEvaluation( request ); } );
 }
 
 void MachineLearningClient::DeleteEvaluationAsync(const DeleteEvaluationRequest& request, const DeleteEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -456,6 +556,16 @@ void MachineLearningClient::DeleteEvaluationAsync(const DeleteEvaluationRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DeleteEvaluationAsyncHelper(request, handler, context); } );
 }
 
+DeleteEvaluationOutcomeCallable MachineLearningClient::DeleteEvaluationCallable(DeleteEvaluationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::DeleteEvaluation, this, std::move(request)));
+}
+
+void MachineLearningClient::DeleteEvaluationAsync(DeleteEvaluationRequest&& request, const DeleteEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::DeleteEvaluationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::DeleteEvaluationAsyncHelper(const DeleteEvaluationRequest& request, const DeleteEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteEvaluation(request), context);
@@ -479,7 +589,7 @@ DeleteMLModelOutcome MachineLearningClient::DeleteMLModel(const DeleteMLModelReq
 
 DeleteMLModelOutcomeCallable MachineLearningClient::DeleteMLModelCallable(const DeleteMLModelRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteMLModel( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteMLModel( request ); } );
 }
 
 void MachineLearningClient::DeleteMLModelAsync(const DeleteMLModelRequest& request, const DeleteMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -487,6 +597,16 @@ void MachineLearningClient::DeleteMLModelAsync(const DeleteMLModelRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DeleteMLModelAsyncHelper(request, handler, context); } );
 }
 
+DeleteMLModelOutcomeCallable MachineLearningClient::DeleteMLModelCallable(DeleteMLModelRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::DeleteMLModel, this, std::move(request)));
+}
+
+void MachineLearningClient::DeleteMLModelAsync(DeleteMLModelRequest&& request, const DeleteMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::DeleteMLModelAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::DeleteMLModelAsyncHelper(const DeleteMLModelRequest& request, const DeleteMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteMLModel(request), context);
@@ -510,7 +630,7 @@ DeleteRealtimeEndpointOutcome MachineLearningClient::DeleteRealtimeEndpoint(cons
 
 DeleteRealtimeEndpointOutcomeCallable MachineLearningClient::DeleteRealtimeEndpointCallable(const DeleteRealtimeEndpointRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRealtimeEndpoint( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRealtimeEndpoint( request ); } );
 }
 
 void MachineLearningClient::DeleteRealtimeEndpointAsync(const DeleteRealtimeEndpointRequest& request, const DeleteRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -518,6 +638,16 @@ void MachineLearningClient::DeleteRealtimeEndpointAsync(const DeleteRealtimeEndp
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRealtimeEndpointAsyncHelper(request, handler, context); } );
 }
 
+DeleteRealtimeEndpointOutcomeCallable MachineLearningClient::DeleteRealtimeEndpointCallable(DeleteRealtimeEndpointRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::DeleteRealtimeEndpoint, this, std::move(request)));
+}
+
+void MachineLearningClient::DeleteRealtimeEndpointAsync(DeleteRealtimeEndpointRequest&& request, const DeleteRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::DeleteRealtimeEndpointAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::DeleteRealtimeEndpointAsyncHelper(const DeleteRealtimeEndpointRequest& request, const DeleteRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRealtimeEndpoint(request), context);
@@ -541,7 +671,7 @@ DeleteTagsOutcome MachineLearningClient::DeleteTags(const DeleteTagsRequest& req
 
 DeleteTagsOutcomeCallable MachineLearningClient::DeleteTagsCallable(const DeleteTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTags( request ); } );
 }
 
 void MachineLearningClient::DeleteTagsAsync(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -549,6 +679,16 @@ void MachineLearningClient::DeleteTagsAsync(const DeleteTagsRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTagsAsyncHelper(request, handler, context); } );
 }
 
+DeleteTagsOutcomeCallable MachineLearningClient::DeleteTagsCallable(DeleteTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::DeleteTags, this, std::move(request)));
+}
+
+void MachineLearningClient::DeleteTagsAsync(DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::DeleteTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::DeleteTagsAsyncHelper(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTags(request), context);
@@ -572,7 +712,7 @@ DescribeBatchPredictionsOutcome MachineLearningClient::DescribeBatchPredictions(
 
 DescribeBatchPredictionsOutcomeCallable MachineLearningClient::DescribeBatchPredictionsCallable(const DescribeBatchPredictionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeBatchPredictions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeBatchPredictions( request ); } );
 }
 
 void MachineLearningClient::DescribeBatchPredictionsAsync(const DescribeBatchPredictionsRequest& request, const DescribeBatchPredictionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -580,6 +720,16 @@ void MachineLearningClient::DescribeBatchPredictionsAsync(const DescribeBatchPre
   m_executor->Submit( [this, request, handler, context](){ this->DescribeBatchPredictionsAsyncHelper(request, handler, context); } );
 }
 
+DescribeBatchPredictionsOutcomeCallable MachineLearningClient::DescribeBatchPredictionsCallable(DescribeBatchPredictionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::DescribeBatchPredictions, this, std::move(request)));
+}
+
+void MachineLearningClient::DescribeBatchPredictionsAsync(DescribeBatchPredictionsRequest&& request, const DescribeBatchPredictionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::DescribeBatchPredictionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::DescribeBatchPredictionsAsyncHelper(const DescribeBatchPredictionsRequest& request, const DescribeBatchPredictionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeBatchPredictions(request), context);
@@ -603,7 +753,7 @@ DescribeDataSourcesOutcome MachineLearningClient::DescribeDataSources(const Desc
 
 DescribeDataSourcesOutcomeCallable MachineLearningClient::DescribeDataSourcesCallable(const DescribeDataSourcesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDataSources( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDataSources( request ); } );
 }
 
 void MachineLearningClient::DescribeDataSourcesAsync(const DescribeDataSourcesRequest& request, const DescribeDataSourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -611,6 +761,16 @@ void MachineLearningClient::DescribeDataSourcesAsync(const DescribeDataSourcesRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDataSourcesAsyncHelper(request, handler, context); } );
 }
 
+DescribeDataSourcesOutcomeCallable MachineLearningClient::DescribeDataSourcesCallable(DescribeDataSourcesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::DescribeDataSources, this, std::move(request)));
+}
+
+void MachineLearningClient::DescribeDataSourcesAsync(DescribeDataSourcesRequest&& request, const DescribeDataSourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::DescribeDataSourcesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::DescribeDataSourcesAsyncHelper(const DescribeDataSourcesRequest& request, const DescribeDataSourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDataSources(request), context);
@@ -634,7 +794,7 @@ DescribeEvaluationsOutcome MachineLearningClient::DescribeEvaluations(const Desc
 
 DescribeEvaluationsOutcomeCallable MachineLearningClient::DescribeEvaluationsCallable(const DescribeEvaluationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEvaluations( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEvaluations( request ); } );
 }
 
 void MachineLearningClient::DescribeEvaluationsAsync(const DescribeEvaluationsRequest& request, const DescribeEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -642,6 +802,16 @@ void MachineLearningClient::DescribeEvaluationsAsync(const DescribeEvaluationsRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEvaluationsAsyncHelper(request, handler, context); } );
 }
 
+DescribeEvaluationsOutcomeCallable MachineLearningClient::DescribeEvaluationsCallable(DescribeEvaluationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::DescribeEvaluations, this, std::move(request)));
+}
+
+void MachineLearningClient::DescribeEvaluationsAsync(DescribeEvaluationsRequest&& request, const DescribeEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::DescribeEvaluationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::DescribeEvaluationsAsyncHelper(const DescribeEvaluationsRequest& request, const DescribeEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEvaluations(request), context);
@@ -665,7 +835,7 @@ DescribeMLModelsOutcome MachineLearningClient::DescribeMLModels(const DescribeML
 
 DescribeMLModelsOutcomeCallable MachineLearningClient::DescribeMLModelsCallable(const DescribeMLModelsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeMLModels( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeMLModels( request ); } );
 }
 
 void MachineLearningClient::DescribeMLModelsAsync(const DescribeMLModelsRequest& request, const DescribeMLModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -673,6 +843,16 @@ void MachineLearningClient::DescribeMLModelsAsync(const DescribeMLModelsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeMLModelsAsyncHelper(request, handler, context); } );
 }
 
+DescribeMLModelsOutcomeCallable MachineLearningClient::DescribeMLModelsCallable(DescribeMLModelsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::DescribeMLModels, this, std::move(request)));
+}
+
+void MachineLearningClient::DescribeMLModelsAsync(DescribeMLModelsRequest&& request, const DescribeMLModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::DescribeMLModelsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::DescribeMLModelsAsyncHelper(const DescribeMLModelsRequest& request, const DescribeMLModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeMLModels(request), context);
@@ -696,7 +876,7 @@ DescribeTagsOutcome MachineLearningClient::DescribeTags(const DescribeTagsReques
 
 DescribeTagsOutcomeCallable MachineLearningClient::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTags( request ); } );
 }
 
 void MachineLearningClient::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -704,6 +884,16 @@ void MachineLearningClient::DescribeTagsAsync(const DescribeTagsRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTagsAsyncHelper(request, handler, context); } );
 }
 
+DescribeTagsOutcomeCallable MachineLearningClient::DescribeTagsCallable(DescribeTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::DescribeTags, this, std::move(request)));
+}
+
+void MachineLearningClient::DescribeTagsAsync(DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::DescribeTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTags(request), context);
@@ -727,7 +917,7 @@ GetBatchPredictionOutcome MachineLearningClient::GetBatchPrediction(const GetBat
 
 GetBatchPredictionOutcomeCallable MachineLearningClient::GetBatchPredictionCallable(const GetBatchPredictionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBatchPrediction( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBatchPrediction( request ); } );
 }
 
 void MachineLearningClient::GetBatchPredictionAsync(const GetBatchPredictionRequest& request, const GetBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -735,6 +925,16 @@ void MachineLearningClient::GetBatchPredictionAsync(const GetBatchPredictionRequ
   m_executor->Submit( [this, request, handler, context](){ this->GetBatchPredictionAsyncHelper(request, handler, context); } );
 }
 
+GetBatchPredictionOutcomeCallable MachineLearningClient::GetBatchPredictionCallable(GetBatchPredictionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::GetBatchPrediction, this, std::move(request)));
+}
+
+void MachineLearningClient::GetBatchPredictionAsync(GetBatchPredictionRequest&& request, const GetBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::GetBatchPredictionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::GetBatchPredictionAsyncHelper(const GetBatchPredictionRequest& request, const GetBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBatchPrediction(request), context);
@@ -758,7 +958,7 @@ GetDataSourceOutcome MachineLearningClient::GetDataSource(const GetDataSourceReq
 
 GetDataSourceOutcomeCallable MachineLearningClient::GetDataSourceCallable(const GetDataSourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDataSource( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDataSource( request ); } );
 }
 
 void MachineLearningClient::GetDataSourceAsync(const GetDataSourceRequest& request, const GetDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -766,6 +966,16 @@ void MachineLearningClient::GetDataSourceAsync(const GetDataSourceRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->GetDataSourceAsyncHelper(request, handler, context); } );
 }
 
+GetDataSourceOutcomeCallable MachineLearningClient::GetDataSourceCallable(GetDataSourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::GetDataSource, this, std::move(request)));
+}
+
+void MachineLearningClient::GetDataSourceAsync(GetDataSourceRequest&& request, const GetDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::GetDataSourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::GetDataSourceAsyncHelper(const GetDataSourceRequest& request, const GetDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDataSource(request), context);
@@ -789,7 +999,7 @@ GetEvaluationOutcome MachineLearningClient::GetEvaluation(const GetEvaluationReq
 
 GetEvaluationOutcomeCallable MachineLearningClient::GetEvaluationCallable(const GetEvaluationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetEvaluation( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetEvaluation( request ); } );
 }
 
 void MachineLearningClient::GetEvaluationAsync(const GetEvaluationRequest& request, const GetEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -797,6 +1007,16 @@ void MachineLearningClient::GetEvaluationAsync(const GetEvaluationRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->GetEvaluationAsyncHelper(request, handler, context); } );
 }
 
+GetEvaluationOutcomeCallable MachineLearningClient::GetEvaluationCallable(GetEvaluationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::GetEvaluation, this, std::move(request)));
+}
+
+void MachineLearningClient::GetEvaluationAsync(GetEvaluationRequest&& request, const GetEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::GetEvaluationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::GetEvaluationAsyncHelper(const GetEvaluationRequest& request, const GetEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetEvaluation(request), context);
@@ -820,7 +1040,7 @@ GetMLModelOutcome MachineLearningClient::GetMLModel(const GetMLModelRequest& req
 
 GetMLModelOutcomeCallable MachineLearningClient::GetMLModelCallable(const GetMLModelRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetMLModel( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetMLModel( request ); } );
 }
 
 void MachineLearningClient::GetMLModelAsync(const GetMLModelRequest& request, const GetMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -828,6 +1048,16 @@ void MachineLearningClient::GetMLModelAsync(const GetMLModelRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->GetMLModelAsyncHelper(request, handler, context); } );
 }
 
+GetMLModelOutcomeCallable MachineLearningClient::GetMLModelCallable(GetMLModelRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::GetMLModel, this, std::move(request)));
+}
+
+void MachineLearningClient::GetMLModelAsync(GetMLModelRequest&& request, const GetMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::GetMLModelAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::GetMLModelAsyncHelper(const GetMLModelRequest& request, const GetMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetMLModel(request), context);
@@ -848,7 +1078,7 @@ PredictOutcome MachineLearningClient::Predict(const PredictRequest& request) con
 
 PredictOutcomeCallable MachineLearningClient::PredictCallable(const PredictRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->Predict( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->Predict( request ); } );
 }
 
 void MachineLearningClient::PredictAsync(const PredictRequest& request, const PredictResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -856,6 +1086,16 @@ void MachineLearningClient::PredictAsync(const PredictRequest& request, const Pr
   m_executor->Submit( [this, request, handler, context](){ this->PredictAsyncHelper(request, handler, context); } );
 }
 
+PredictOutcomeCallable MachineLearningClient::PredictCallable(PredictRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::Predict, this, std::move(request)));
+}
+
+void MachineLearningClient::PredictAsync(PredictRequest&& request, const PredictResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::PredictAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::PredictAsyncHelper(const PredictRequest& request, const PredictResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, Predict(request), context);
@@ -879,7 +1119,7 @@ UpdateBatchPredictionOutcome MachineLearningClient::UpdateBatchPrediction(const
 
 UpdateBatchPredictionOutcomeCallable MachineLearningClient::UpdateBatchPredictionCallable(const UpdateBatchPredictionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateBatchPrediction( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateBatchPrediction( request ); } );
 }
 
 void MachineLearningClient::UpdateBatchPredictionAsync(const UpdateBatchPredictionRequest& request, const UpdateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -887,6 +1127,16 @@ void MachineLearningClient::UpdateBatchPredictionAsync(const UpdateBatchPredicti
   m_executor->Submit( [this, request, handler, context](){ this->UpdateBatchPredictionAsyncHelper(request, handler, context); } );
 }
 
+UpdateBatchPredictionOutcomeCallable MachineLearningClient::UpdateBatchPredictionCallable(UpdateBatchPredictionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::UpdateBatchPrediction, this, std::move(request)));
+}
+
+void MachineLearningClient::UpdateBatchPredictionAsync(UpdateBatchPredictionRequest&& request, const UpdateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::UpdateBatchPredictionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::UpdateBatchPredictionAsyncHelper(const UpdateBatchPredictionRequest& request, const UpdateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateBatchPrediction(request), context);
@@ -910,7 +1160,7 @@ UpdateDataSourceOutcome MachineLearningClient::UpdateDataSource(const UpdateData
 
 UpdateDataSourceOutcomeCallable MachineLearningClient::UpdateDataSourceCallable(const UpdateDataSourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateDataSource( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateDataSource( request ); } );
 }
 
 void MachineLearningClient::UpdateDataSourceAsync(const UpdateDataSourceRequest& request, const UpdateDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -918,6 +1168,16 @@ void MachineLearningClient::UpdateDataSourceAsync(const UpdateDataSourceRequest&
   m_executor->Submit( [this, request, handler, context](){ this->UpdateDataSourceAsyncHelper(request, handler, context); } );
 }
 
+UpdateDataSourceOutcomeCallable MachineLearningClient::UpdateDataSourceCallable(UpdateDataSourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::UpdateDataSource, this, std::move(request)));
+}
+
+void MachineLearningClient::UpdateDataSourceAsync(UpdateDataSourceRequest&& request, const UpdateDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::UpdateDataSourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::UpdateDataSourceAsyncHelper(const UpdateDataSourceRequest& request, const UpdateDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateDataSource(request), context);
@@ -941,7 +1201,7 @@ UpdateEvaluationOutcome MachineLearningClient::UpdateEvaluation(const UpdateEval
 
 UpdateEvaluationOutcomeCallable MachineLearningClient::UpdateEvaluationCallable(const UpdateEvaluationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateEvaluation( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateEvaluation( request ); } );
 }
 
 void MachineLearningClient::UpdateEvaluationAsync(const UpdateEvaluationRequest& request, const UpdateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -949,6 +1209,16 @@ void MachineLearningClient::UpdateEvaluationAsync(const UpdateEvaluationRequest&
   m_executor->Submit( [this, request, handler, context](){ this->UpdateEvaluationAsyncHelper(request, handler, context); } );
 }
 
+UpdateEvaluationOutcomeCallable MachineLearningClient::UpdateEvaluationCallable(UpdateEvaluationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::UpdateEvaluation, this, std::move(request)));
+}
+
+void MachineLearningClient::UpdateEvaluationAsync(UpdateEvaluationRequest&& request, const UpdateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::UpdateEvaluationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::UpdateEvaluationAsyncHelper(const UpdateEvaluationRequest& request, const UpdateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateEvaluation(request), context);
@@ -972,7 +1242,7 @@ UpdateMLModelOutcome MachineLearningClient::UpdateMLModel(const UpdateMLModelReq
 
 UpdateMLModelOutcomeCallable MachineLearningClient::UpdateMLModelCallable(const UpdateMLModelRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateMLModel( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateMLModel( request ); } );
 }
 
 void MachineLearningClient::UpdateMLModelAsync(const UpdateMLModelRequest& request, const UpdateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -980,8 +1250,228 @@ void MachineLearningClient::UpdateMLModelAsync(const UpdateMLModelRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->UpdateMLModelAsyncHelper(request, handler, context); } );
 }
 
+UpdateMLModelOutcomeCallable MachineLearningClient::UpdateMLModelCallable(UpdateMLModelRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MachineLearningClient::UpdateMLModel, this, std::move(request)));
+}
+
+void MachineLearningClient::UpdateMLModelAsync(UpdateMLModelRequest&& request, const UpdateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MachineLearningClient::UpdateMLModelAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MachineLearningClient::UpdateMLModelAsyncHelper(const UpdateMLModelRequest& request, const UpdateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateMLModel(request), context);
 }
 
+Paginator<MachineLearningClient, DescribeBatchPredictionsRequest, DescribeBatchPredictionsOutcome> MachineLearningClient::DescribeBatchPredictionsPaginator(const DescribeBatchPredictionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<MachineLearningClient, DescribeBatchPredictionsRequest, DescribeBatchPredictionsOutcome>(this, &MachineLearningClient::DescribeBatchPredictions, request,
+    [](const DescribeBatchPredictionsRequest& current, const DescribeBatchPredictionsOutcome& outcome, DescribeBatchPredictionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<MachineLearningClient, DescribeDataSourcesRequest, DescribeDataSourcesOutcome> MachineLearningClient::DescribeDataSourcesPaginator(const DescribeDataSourcesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<MachineLearningClient, DescribeDataSourcesRequest, DescribeDataSourcesOutcome>(this, &MachineLearningClient::DescribeDataSources, request,
+    [](const DescribeDataSourcesRequest& current, const DescribeDataSourcesOutcome& outcome, DescribeDataSourcesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<MachineLearningClient, DescribeEvaluationsRequest, DescribeEvaluationsOutcome> MachineLearningClient::DescribeEvaluationsPaginator(const DescribeEvaluationsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<MachineLearningClient, DescribeEvaluationsRequest, DescribeEvaluationsOutcome>(this, &MachineLearningClient::DescribeEvaluations, request,
+    [](const DescribeEvaluationsRequest& current, const DescribeEvaluationsOutcome& outcome, DescribeEvaluationsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<MachineLearningClient, DescribeMLModelsRequest, DescribeMLModelsOutcome> MachineLearningClient::DescribeMLModelsPaginator(const DescribeMLModelsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<MachineLearningClient, DescribeMLModelsRequest, DescribeMLModelsOutcome>(this, &MachineLearningClient::DescribeMLModels, request,
+    [](const DescribeMLModelsRequest& current, const DescribeMLModelsOutcome& outcome, DescribeMLModelsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<MachineLearningClient, AddTagsRequest, AddTagsOutcome> MachineLearningClient::AddTagsAwaitable(AddTagsRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::AddTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, CreateBatchPredictionRequest, CreateBatchPredictionOutcome> MachineLearningClient::CreateBatchPredictionAwaitable(CreateBatchPredictionRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::CreateBatchPrediction, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, CreateDataSourceFromRDSRequest, CreateDataSourceFromRDSOutcome> MachineLearningClient::CreateDataSourceFromRDSAwaitable(CreateDataSourceFromRDSRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::CreateDataSourceFromRDS, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, CreateDataSourceFromRedshiftRequest, CreateDataSourceFromRedshiftOutcome> MachineLearningClient::CreateDataSourceFromRedshiftAwaitable(CreateDataSourceFromRedshiftRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::CreateDataSourceFromRedshift, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, CreateDataSourceFromS3Request, CreateDataSourceFromS3Outcome> MachineLearningClient::CreateDataSourceFromS3Awaitable(CreateDataSourceFromS3Request request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::CreateDataSourceFromS3, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, CreateEvaluationRequest, CreateEvaluationOutcome> MachineLearningClient::CreateEvaluationAwaitable(CreateEvaluationRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::CreateEvaluation, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, CreateMLModelRequest, CreateMLModelOutcome> MachineLearningClient::CreateMLModelAwaitable(CreateMLModelRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::CreateMLModel, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, CreateRealtimeEndpointRequest, CreateRealtimeEndpointOutcome> MachineLearningClient::CreateRealtimeEndpointAwaitable(CreateRealtimeEndpointRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::CreateRealtimeEndpoint, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, DeleteBatchPredictionRequest, DeleteBatchPredictionOutcome> MachineLearningClient::DeleteBatchPredictionAwaitable(DeleteBatchPredictionRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::DeleteBatchPrediction, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, DeleteDataSourceRequest, DeleteDataSourceOutcome> MachineLearningClient::DeleteDataSourceAwaitable(DeleteDataSourceRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::DeleteDataSource, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, DeleteEvaluationRequest, DeleteEvaluationOutcome> MachineLearningClient::DeleteEvaluationAwaitable(DeleteEvaluationRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::DeleteEvaluation, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, DeleteMLModelRequest, DeleteMLModelOutcome> MachineLearningClient::DeleteMLModelAwaitable(DeleteMLModelRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::DeleteMLModel, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, DeleteRealtimeEndpointRequest, DeleteRealtimeEndpointOutcome> MachineLearningClient::DeleteRealtimeEndpointAwaitable(DeleteRealtimeEndpointRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::DeleteRealtimeEndpoint, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, DeleteTagsRequest, DeleteTagsOutcome> MachineLearningClient::DeleteTagsAwaitable(DeleteTagsRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::DeleteTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, DescribeBatchPredictionsRequest, DescribeBatchPredictionsOutcome> MachineLearningClient::DescribeBatchPredictionsAwaitable(DescribeBatchPredictionsRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::DescribeBatchPredictions, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, DescribeDataSourcesRequest, DescribeDataSourcesOutcome> MachineLearningClient::DescribeDataSourcesAwaitable(DescribeDataSourcesRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::DescribeDataSources, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, DescribeEvaluationsRequest, DescribeEvaluationsOutcome> MachineLearningClient::DescribeEvaluationsAwaitable(DescribeEvaluationsRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::DescribeEvaluations, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, DescribeMLModelsRequest, DescribeMLModelsOutcome> MachineLearningClient::DescribeMLModelsAwaitable(DescribeMLModelsRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::DescribeMLModels, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, DescribeTagsRequest, DescribeTagsOutcome> MachineLearningClient::DescribeTagsAwaitable(DescribeTagsRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::DescribeTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, GetBatchPredictionRequest, GetBatchPredictionOutcome> MachineLearningClient::GetBatchPredictionAwaitable(GetBatchPredictionRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::GetBatchPrediction, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, GetDataSourceRequest, GetDataSourceOutcome> MachineLearningClient::GetDataSourceAwaitable(GetDataSourceRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::GetDataSource, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, GetEvaluationRequest, GetEvaluationOutcome> MachineLearningClient::GetEvaluationAwaitable(GetEvaluationRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::GetEvaluation, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, GetMLModelRequest, GetMLModelOutcome> MachineLearningClient::GetMLModelAwaitable(GetMLModelRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::GetMLModel, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, PredictRequest, PredictOutcome> MachineLearningClient::PredictAwaitable(PredictRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::Predict, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, UpdateBatchPredictionRequest, UpdateBatchPredictionOutcome> MachineLearningClient::UpdateBatchPredictionAwaitable(UpdateBatchPredictionRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::UpdateBatchPrediction, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, UpdateDataSourceRequest, UpdateDataSourceOutcome> MachineLearningClient::UpdateDataSourceAwaitable(UpdateDataSourceRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::UpdateDataSource, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, UpdateEvaluationRequest, UpdateEvaluationOutcome> MachineLearningClient::UpdateEvaluationAwaitable(UpdateEvaluationRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::UpdateEvaluation, std::move(request) } };
+}
+
+ClientOperationAwaitable<MachineLearningClient, UpdateMLModelRequest, UpdateMLModelOutcome> MachineLearningClient::UpdateMLModelAwaitable(UpdateMLModelRequest request) const
+{
+  return { m_executor.get(), { this, &MachineLearningClient::UpdateMLModel, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
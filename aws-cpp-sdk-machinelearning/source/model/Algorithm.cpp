@@ -29,16 +29,26 @@ namespace Aws
       namespace AlgorithmMapper
       {
 
-        static const int sgd_HASH = HashingUtils::HashString("sgd");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int sgd_HASH = 113808;
 
 
         Algorithm GetAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == sgd_HASH)
+          switch (hashCode)
           {
+          case sgd_HASH:
             return Algorithm::sgd;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
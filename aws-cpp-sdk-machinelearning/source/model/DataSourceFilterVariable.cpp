@@ -29,41 +29,41 @@ namespace Aws
       namespace DataSourceFilterVariableMapper
       {
 
-        static const int CreatedAt_HASH = HashingUtils::HashString("CreatedAt");
-        static const int LastUpdatedAt_HASH = HashingUtils::HashString("LastUpdatedAt");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int DataLocationS3_HASH = HashingUtils::HashString("DataLocationS3");
-        static const int IAMUser_HASH = HashingUtils::HashString("IAMUser");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CreatedAt_HASH = -1692627685;
+        static const int LastUpdatedAt_HASH = 1350364216;
+        static const int Status_HASH = -1808614382;
+        static const int Name_HASH = 2420395;
+        static const int DataLocationS3_HASH = 409869343;
+        static const int IAMUser_HASH = -1997056096;
 
 
         DataSourceFilterVariable GetDataSourceFilterVariableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CreatedAt_HASH)
+          switch (hashCode)
           {
+          case CreatedAt_HASH:
             return DataSourceFilterVariable::CreatedAt;
-          }
-          else if (hashCode == LastUpdatedAt_HASH)
-          {
+          case LastUpdatedAt_HASH:
             return DataSourceFilterVariable::LastUpdatedAt;
-          }
-          else if (hashCode == Status_HASH)
-          {
+          case Status_HASH:
             return DataSourceFilterVariable::Status;
-          }
-          else if (hashCode == Name_HASH)
-          {
+          case Name_HASH:
             return DataSourceFilterVariable::Name;
-          }
-          else if (hashCode == DataLocationS3_HASH)
-          {
+          case DataLocationS3_HASH:
             return DataSourceFilterVariable::DataLocationS3;
-          }
-          else if (hashCode == IAMUser_HASH)
-          {
+          case IAMUser_HASH:
             return DataSourceFilterVariable::IAMUser;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace DetailsAttributesMapper
       {
 
-        static const int PredictiveModelType_HASH = HashingUtils::HashString("PredictiveModelType");
-        static const int Algorithm_HASH = HashingUtils::HashString("Algorithm");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PredictiveModelType_HASH = 791821124;
+        static const int Algorithm_HASH = -2065509297;
 
 
         DetailsAttributes GetDetailsAttributesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PredictiveModelType_HASH)
+          switch (hashCode)
           {
+          case PredictiveModelType_HASH:
             return DetailsAttributes::PredictiveModelType;
-          }
-          else if (hashCode == Algorithm_HASH)
-          {
+          case Algorithm_HASH:
             return DetailsAttributes::Algorithm;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
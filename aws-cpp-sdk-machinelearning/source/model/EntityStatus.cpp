@@ -29,36 +29,38 @@ namespace Aws
       namespace EntityStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int INPROGRESS_HASH = HashingUtils::HashString("INPROGRESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PENDING_HASH = 35394935;
+        static const int INPROGRESS_HASH = -926562734;
+        static const int FAILED_HASH = 2066319421;
+        static const int COMPLETED_HASH = 1383663147;
+        static const int DELETED_HASH = -2026521607;
 
 
         EntityStatus GetEntityStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          switch (hashCode)
           {
+          case PENDING_HASH:
             return EntityStatus::PENDING;
-          }
-          else if (hashCode == INPROGRESS_HASH)
-          {
+          case INPROGRESS_HASH:
             return EntityStatus::INPROGRESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return EntityStatus::FAILED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
+          case COMPLETED_HASH:
             return EntityStatus::COMPLETED;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
+          case DELETED_HASH:
             return EntityStatus::DELETED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
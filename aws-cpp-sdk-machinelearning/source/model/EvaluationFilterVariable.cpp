@@ -29,51 +29,47 @@ namespace Aws
       namespace EvaluationFilterVariableMapper
       {
 
-        static const int CreatedAt_HASH = HashingUtils::HashString("CreatedAt");
-        static const int LastUpdatedAt_HASH = HashingUtils::HashString("LastUpdatedAt");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int IAMUser_HASH = HashingUtils::HashString("IAMUser");
-        static const int MLModelId_HASH = HashingUtils::HashString("MLModelId");
-        static const int DataSourceId_HASH = HashingUtils::HashString("DataSourceId");
-        static const int DataURI_HASH = HashingUtils::HashString("DataURI");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CreatedAt_HASH = -1692627685;
+        static const int LastUpdatedAt_HASH = 1350364216;
+        static const int Status_HASH = -1808614382;
+        static const int Name_HASH = 2420395;
+        static const int IAMUser_HASH = -1997056096;
+        static const int MLModelId_HASH = 466168709;
+        static const int DataSourceId_HASH = -1057082240;
+        static const int DataURI_HASH = -1187129022;
 
 
         EvaluationFilterVariable GetEvaluationFilterVariableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CreatedAt_HASH)
+          switch (hashCode)
           {
+          case CreatedAt_HASH:
             return EvaluationFilterVariable::CreatedAt;
-          }
-          else if (hashCode == LastUpdatedAt_HASH)
-          {
+          case LastUpdatedAt_HASH:
             return EvaluationFilterVariable::LastUpdatedAt;
-          }
-          else if (hashCode == Status_HASH)
-          {
+          case Status_HASH:
             return EvaluationFilterVariable::Status;
-          }
-          else if (hashCode == Name_HASH)
-          {
+          case Name_HASH:
             return EvaluationFilterVariable::Name;
-          }
-          else if (hashCode == IAMUser_HASH)
-          {
+          case IAMUser_HASH:
             return EvaluationFilterVariable::IAMUser;
-          }
-          else if (hashCode == MLModelId_HASH)
-          {
+          case MLModelId_HASH:
             return EvaluationFilterVariable::MLModelId;
-          }
-          else if (hashCode == DataSourceId_HASH)
-          {
+          case DataSourceId_HASH:
             return EvaluationFilterVariable::DataSourceId;
-          }
-          else if (hashCode == DataURI_HASH)
-          {
+          case DataURI_HASH:
             return EvaluationFilterVariable::DataURI;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
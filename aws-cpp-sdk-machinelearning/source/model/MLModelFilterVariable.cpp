@@ -29,61 +29,53 @@ namespace Aws
       namespace MLModelFilterVariableMapper
       {
 
-        static const int CreatedAt_HASH = HashingUtils::HashString("CreatedAt");
-        static const int LastUpdatedAt_HASH = HashingUtils::HashString("LastUpdatedAt");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int IAMUser_HASH = HashingUtils::HashString("IAMUser");
-        static const int TrainingDataSourceId_HASH = HashingUtils::HashString("TrainingDataSourceId");
-        static const int RealtimeEndpointStatus_HASH = HashingUtils::HashString("RealtimeEndpointStatus");
-        static const int MLModelType_HASH = HashingUtils::HashString("MLModelType");
-        static const int Algorithm_HASH = HashingUtils::HashString("Algorithm");
-        static const int TrainingDataURI_HASH = HashingUtils::HashString("TrainingDataURI");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CreatedAt_HASH = -1692627685;
+        static const int LastUpdatedAt_HASH = 1350364216;
+        static const int Status_HASH = -1808614382;
+        static const int Name_HASH = 2420395;
+        static const int IAMUser_HASH = -1997056096;
+        static const int TrainingDataSourceId_HASH = -1264911750;
+        static const int RealtimeEndpointStatus_HASH = -1416862638;
+        static const int MLModelType_HASH = 1311882020;
+        static const int Algorithm_HASH = -2065509297;
+        static const int TrainingDataURI_HASH = -18366712;
 
 
         MLModelFilterVariable GetMLModelFilterVariableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CreatedAt_HASH)
+          switch (hashCode)
           {
+          case CreatedAt_HASH:
             return MLModelFilterVariable::CreatedAt;
-          }
-          else if (hashCode == LastUpdatedAt_HASH)
-          {
+          case LastUpdatedAt_HASH:
             return MLModelFilterVariable::LastUpdatedAt;
-          }
-          else if (hashCode == Status_HASH)
-          {
+          case Status_HASH:
             return MLModelFilterVariable::Status;
-          }
-          else if (hashCode == Name_HASH)
-          {
+          case Name_HASH:
             return MLModelFilterVariable::Name;
-          }
-          else if (hashCode == IAMUser_HASH)
-          {
+          case IAMUser_HASH:
             return MLModelFilterVariable::IAMUser;
-          }
-          else if (hashCode == TrainingDataSourceId_HASH)
-          {
+          case TrainingDataSourceId_HASH:
             return MLModelFilterVariable::TrainingDataSourceId;
-          }
-          else if (hashCode == RealtimeEndpointStatus_HASH)
-          {
+          case RealtimeEndpointStatus_HASH:
             return MLModelFilterVariable::RealtimeEndpointStatus;
-          }
-          else if (hashCode == MLModelType_HASH)
-          {
+          case MLModelType_HASH:
             return MLModelFilterVariable::MLModelType;
-          }
-          else if (hashCode == Algorithm_HASH)
-          {
+          case Algorithm_HASH:
             return MLModelFilterVariable::Algorithm;
-          }
-          else if (hashCode == TrainingDataURI_HASH)
-          {
+          case TrainingDataURI_HASH:
             return MLModelFilterVariable::TrainingDataURI;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace MLModelTypeMapper
       {
 
-        static const int REGRESSION_HASH = HashingUtils::HashString("REGRESSION");
-        static const int BINARY_HASH = HashingUtils::HashString("BINARY");
-        static const int MULTICLASS_HASH = HashingUtils::HashString("MULTICLASS");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int REGRESSION_HASH = 1906404417;
+        static const int BINARY_HASH = 1959329793;
+        static const int MULTICLASS_HASH = 1738152927;
 
 
         MLModelType GetMLModelTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGRESSION_HASH)
+          switch (hashCode)
           {
+          case REGRESSION_HASH:
             return MLModelType::REGRESSION;
-          }
-          else if (hashCode == BINARY_HASH)
-          {
+          case BINARY_HASH:
             return MLModelType::BINARY;
-          }
-          else if (hashCode == MULTICLASS_HASH)
-          {
+          case MULTICLASS_HASH:
             return MLModelType::MULTICLASS;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
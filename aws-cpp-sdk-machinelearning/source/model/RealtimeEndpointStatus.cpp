@@ -29,31 +29,35 @@ namespace Aws
       namespace RealtimeEndpointStatusMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int NONE_HASH = 2402104;
+        static const int READY_HASH = 77848963;
+        static const int UPDATING_HASH = 2105227078;
+        static const int FAILED_HASH = 2066319421;
 
 
         RealtimeEndpointStatus GetRealtimeEndpointStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          switch (hashCode)
           {
+          case NONE_HASH:
             return RealtimeEndpointStatus::NONE;
-          }
-          else if (hashCode == READY_HASH)
-          {
+          case READY_HASH:
             return RealtimeEndpointStatus::READY;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
+          case UPDATING_HASH:
             return RealtimeEndpointStatus::UPDATING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return RealtimeEndpointStatus::FAILED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace SortOrderMapper
       {
 
-        static const int asc_HASH = HashingUtils::HashString("asc");
-        static const int dsc_HASH = HashingUtils::HashString("dsc");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int asc_HASH = 96881;
+        static const int dsc_HASH = 99764;
 
 
         SortOrder GetSortOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == asc_HASH)
+          switch (hashCode)
           {
+          case asc_HASH:
             return SortOrder::asc;
-          }
-          else if (hashCode == dsc_HASH)
-          {
+          case dsc_HASH:
             return SortOrder::dsc;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
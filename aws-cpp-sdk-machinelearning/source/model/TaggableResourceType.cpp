@@ -29,31 +29,35 @@ namespace Aws
       namespace TaggableResourceTypeMapper
       {
 
-        static const int BatchPrediction_HASH = HashingUtils::HashString("BatchPrediction");
-        static const int DataSource_HASH = HashingUtils::HashString("DataSource");
-        static const int Evaluation_HASH = HashingUtils::HashString("Evaluation");
-        static const int MLModel_HASH = HashingUtils::HashString("MLModel");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int BatchPrediction_HASH = 94253897;
+        static const int DataSource_HASH = -1029031803;
+        static const int Evaluation_HASH = -1442978980;
+        static const int MLModel_HASH = 1868639434;
 
 
         TaggableResourceType GetTaggableResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BatchPrediction_HASH)
+          switch (hashCode)
           {
+          case BatchPrediction_HASH:
             return TaggableResourceType::BatchPrediction;
-          }
-          else if (hashCode == DataSource_HASH)
-          {
+          case DataSource_HASH:
             return TaggableResourceType::DataSource;
-          }
-          else if (hashCode == Evaluation_HASH)
-          {
+          case Evaluation_HASH:
             return TaggableResourceType::Evaluation;
-          }
-          else if (hashCode == MLModel_HASH)
-          {
+          case MLModel_HASH:
             return TaggableResourceType::MLModel;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -23,6 +23,9 @@
 #include <aws/marketplacecommerceanalytics/model/GenerateDataSetResult.h>
 #include <aws/marketplacecommerceanalytics/model/StartSupportDataExportResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -157,6 +160,18 @@ namespace Model
          */
         virtual void GenerateDataSetAsync(const Model::GenerateDataSetRequest& request, const GenerateDataSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GenerateDataSetCallable(const Model::GenerateDataSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GenerateDataSetOutcomeCallable GenerateDataSetCallable(Model::GenerateDataSetRequest&& request) const;
+
+        /**
+         * Same as GenerateDataSetAsync(const Model::GenerateDataSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GenerateDataSetAsync(Model::GenerateDataSetRequest&& request, const GenerateDataSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Given a data set type and a from date, asynchronously publishes the requested
          * customer support data to the specified S3 bucket and notifies the specified SNS
@@ -206,6 +221,30 @@ namespace Model
          */
         virtual void StartSupportDataExportAsync(const Model::StartSupportDataExportRequest& request, const StartSupportDataExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartSupportDataExportCallable(const Model::StartSupportDataExportRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StartSupportDataExportOutcomeCallable StartSupportDataExportCallable(Model::StartSupportDataExportRequest&& request) const;
+
+        /**
+         * Same as StartSupportDataExportAsync(const Model::StartSupportDataExportRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StartSupportDataExportAsync(Model::StartSupportDataExportRequest&& request, const StartSupportDataExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of GenerateDataSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MarketplaceCommerceAnalyticsClient, Model::GenerateDataSetRequest, Model::GenerateDataSetOutcome> GenerateDataSetAwaitable(Model::GenerateDataSetRequest request) const;
+
+        /**
+         * co_await-able form of StartSupportDataExport(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MarketplaceCommerceAnalyticsClient, Model::StartSupportDataExportRequest, Model::StartSupportDataExportOutcome> StartSupportDataExportAwaitable(Model::StartSupportDataExportRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     GenerateDataSetRequest();
+    inline const char* GetServiceRequestName() const override { return "GenerateDataSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     StartSupportDataExportRequest();
+    inline const char* GetServiceRequestName() const override { return "StartSupportDataExport"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -111,7 +111,7 @@ GenerateDataSetOutcome MarketplaceCommerceAnalyticsClient::GenerateDataSet(const
 
 GenerateDataSetOutcomeCallable MarketplaceCommerceAnalyticsClient::GenerateDataSetCallable(const GenerateDataSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GenerateDataSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GenerateDataSet(request); } );
 }
 
 void MarketplaceCommerceAnalyticsClient::GenerateDataSetAsync(const GenerateDataSetRequest& request, const GenerateDataSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -119,6 +119,16 @@ void MarketplaceCommerceAnalyticsClient::GenerateDataSetAsync(const GenerateData
   m_executor->Submit( [this, request, handler, context](){ this->GenerateDataSetAsyncHelper( request, handler, context ); } );
 }
 
+GenerateDataSetOutcomeCallable MarketplaceCommerceAnalyticsClient::GenerateDataSetCallable(GenerateDataSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MarketplaceCommerceAnalyticsClient::GenerateDataSet, this, std::move(request)));
+}
+
+void MarketplaceCommerceAnalyticsClient::GenerateDataSetAsync(GenerateDataSetRequest&& request, const GenerateDataSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MarketplaceCommerceAnalyticsClient::GenerateDataSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MarketplaceCommerceAnalyticsClient::GenerateDataSetAsyncHelper(const GenerateDataSetRequest& request, const GenerateDataSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GenerateDataSet(request), context);
@@ -142,7 +152,7 @@ StartSupportDataExportOutcome MarketplaceCommerceAnalyticsClient::StartSupportDa
 
 StartSupportDataExportOutcomeCallable MarketplaceCommerceAnalyticsClient::StartSupportDataExportCallable(const StartSupportDataExportRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StartSupportDataExport(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StartSupportDataExport(request); } );
 }
 
 void MarketplaceCommerceAnalyticsClient::StartSupportDataExportAsync(const StartSupportDataExportRequest& request, const StartSupportDataExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -150,8 +160,30 @@ void MarketplaceCommerceAnalyticsClient::StartSupportDataExportAsync(const Start
   m_executor->Submit( [this, request, handler, context](){ this->StartSupportDataExportAsyncHelper( request, handler, context ); } );
 }
 
+StartSupportDataExportOutcomeCallable MarketplaceCommerceAnalyticsClient::StartSupportDataExportCallable(StartSupportDataExportRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MarketplaceCommerceAnalyticsClient::StartSupportDataExport, this, std::move(request)));
+}
+
+void MarketplaceCommerceAnalyticsClient::StartSupportDataExportAsync(StartSupportDataExportRequest&& request, const StartSupportDataExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MarketplaceCommerceAnalyticsClient::StartSupportDataExportAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MarketplaceCommerceAnalyticsClient::StartSupportDataExportAsyncHelper(const StartSupportDataExportRequest& request, const StartSupportDataExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StartSupportDataExport(request), context);
 }
 
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<MarketplaceCommerceAnalyticsClient, GenerateDataSetRequest, GenerateDataSetOutcome> MarketplaceCommerceAnalyticsClient::GenerateDataSetAwaitable(GenerateDataSetRequest request) const
+{
+  return { m_executor.get(), { this, &MarketplaceCommerceAnalyticsClient::GenerateDataSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<MarketplaceCommerceAnalyticsClient, StartSupportDataExportRequest, StartSupportDataExportOutcome> MarketplaceCommerceAnalyticsClient::StartSupportDataExportAwaitable(StartSupportDataExportRequest request) const
+{
+  return { m_executor.get(), { this, &MarketplaceCommerceAnalyticsClient::StartSupportDataExport, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,101 +29,77 @@ namespace Aws
       namespace DataSetTypeMapper
       {
 
-        static const int customer_subscriber_hourly_monthly_subscriptions_HASH = HashingUtils::HashString("customer_subscriber_hourly_monthly_subscriptions");
-        static const int customer_subscriber_annual_subscriptions_HASH = HashingUtils::HashString("customer_subscriber_annual_subscriptions");
-        static const int daily_business_usage_by_instance_type_HASH = HashingUtils::HashString("daily_business_usage_by_instance_type");
-        static const int daily_business_fees_HASH = HashingUtils::HashString("daily_business_fees");
-        static const int daily_business_free_trial_conversions_HASH = HashingUtils::HashString("daily_business_free_trial_conversions");
-        static const int daily_business_new_instances_HASH = HashingUtils::HashString("daily_business_new_instances");
-        static const int daily_business_new_product_subscribers_HASH = HashingUtils::HashString("daily_business_new_product_subscribers");
-        static const int daily_business_canceled_product_subscribers_HASH = HashingUtils::HashString("daily_business_canceled_product_subscribers");
-        static const int monthly_revenue_billing_and_revenue_data_HASH = HashingUtils::HashString("monthly_revenue_billing_and_revenue_data");
-        static const int monthly_revenue_annual_subscriptions_HASH = HashingUtils::HashString("monthly_revenue_annual_subscriptions");
-        static const int disbursed_amount_by_product_HASH = HashingUtils::HashString("disbursed_amount_by_product");
-        static const int disbursed_amount_by_product_with_uncollected_funds_HASH = HashingUtils::HashString("disbursed_amount_by_product_with_uncollected_funds");
-        static const int disbursed_amount_by_customer_geo_HASH = HashingUtils::HashString("disbursed_amount_by_customer_geo");
-        static const int disbursed_amount_by_age_of_uncollected_funds_HASH = HashingUtils::HashString("disbursed_amount_by_age_of_uncollected_funds");
-        static const int disbursed_amount_by_age_of_disbursed_funds_HASH = HashingUtils::HashString("disbursed_amount_by_age_of_disbursed_funds");
-        static const int customer_profile_by_industry_HASH = HashingUtils::HashString("customer_profile_by_industry");
-        static const int customer_profile_by_revenue_HASH = HashingUtils::HashString("customer_profile_by_revenue");
-        static const int customer_profile_by_geography_HASH = HashingUtils::HashString("customer_profile_by_geography");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int customer_subscriber_hourly_monthly_subscriptions_HASH = 786200588;
+        static const int customer_subscriber_annual_subscriptions_HASH = 1798780844;
+        static const int daily_business_usage_by_instance_type_HASH = 1266045651;
+        static const int daily_business_fees_HASH = -2137700570;
+        static const int daily_business_free_trial_conversions_HASH = 769256602;
+        static const int daily_business_new_instances_HASH = -797093562;
+        static const int daily_business_new_product_subscribers_HASH = -904431997;
+        static const int daily_business_canceled_product_subscribers_HASH = 1036488590;
+        static const int monthly_revenue_billing_and_revenue_data_HASH = 416395598;
+        static const int monthly_revenue_annual_subscriptions_HASH = 418975691;
+        static const int disbursed_amount_by_product_HASH = 1019747856;
+        static const int disbursed_amount_by_product_with_uncollected_funds_HASH = -1946945035;
+        static const int disbursed_amount_by_customer_geo_HASH = -879797521;
+        static const int disbursed_amount_by_age_of_uncollected_funds_HASH = -1081466378;
+        static const int disbursed_amount_by_age_of_disbursed_funds_HASH = -1239734873;
+        static const int customer_profile_by_industry_HASH = -2033156785;
+        static const int customer_profile_by_revenue_HASH = -216770933;
+        static const int customer_profile_by_geography_HASH = -1313494485;
 
 
         DataSetType GetDataSetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == customer_subscriber_hourly_monthly_subscriptions_HASH)
+          switch (hashCode)
           {
+          case customer_subscriber_hourly_monthly_subscriptions_HASH:
             return DataSetType::customer_subscriber_hourly_monthly_subscriptions;
-          }
-          else if (hashCode == customer_subscriber_annual_subscriptions_HASH)
-          {
+          case customer_subscriber_annual_subscriptions_HASH:
             return DataSetType::customer_subscriber_annual_subscriptions;
-          }
-          else if (hashCode == daily_business_usage_by_instance_type_HASH)
-          {
+          case daily_business_usage_by_instance_type_HASH:
             return DataSetType::daily_business_usage_by_instance_type;
-          }
-          else if (hashCode == daily_business_fees_HASH)
-          {
+          case daily_business_fees_HASH:
             return DataSetType::daily_business_fees;
-          }
-          else if (hashCode == daily_business_free_trial_conversions_HASH)
-          {
+          case daily_business_free_trial_conversions_HASH:
             return DataSetType::daily_business_free_trial_conversions;
-          }
-          else if (hashCode == daily_business_new_instances_HASH)
-          {
+          case daily_business_new_instances_HASH:
             return DataSetType::daily_business_new_instances;
-          }
-          else if (hashCode == daily_business_new_product_subscribers_HASH)
-          {
+          case daily_business_new_product_subscribers_HASH:
             return DataSetType::daily_business_new_product_subscribers;
-          }
-          else if (hashCode == daily_business_canceled_product_subscribers_HASH)
-          {
+          case daily_business_canceled_product_subscribers_HASH:
             return DataSetType::daily_business_canceled_product_subscribers;
-          }
-          else if (hashCode == monthly_revenue_billing_and_revenue_data_HASH)
-          {
+          case monthly_revenue_billing_and_revenue_data_HASH:
             return DataSetType::monthly_revenue_billing_and_revenue_data;
-          }
-          else if (hashCode == monthly_revenue_annual_subscriptions_HASH)
-          {
+          case monthly_revenue_annual_subscriptions_HASH:
             return DataSetType::monthly_revenue_annual_subscriptions;
-          }
-          else if (hashCode == disbursed_amount_by_product_HASH)
-          {
+          case disbursed_amount_by_product_HASH:
             return DataSetType::disbursed_amount_by_product;
-          }
-          else if (hashCode == disbursed_amount_by_product_with_uncollected_funds_HASH)
-          {
+          case disbursed_amount_by_product_with_uncollected_funds_HASH:
             return DataSetType::disbursed_amount_by_product_with_uncollected_funds;
-          }
-          else if (hashCode == disbursed_amount_by_customer_geo_HASH)
-          {
+          case disbursed_amount_by_customer_geo_HASH:
             return DataSetType::disbursed_amount_by_customer_geo;
-          }
-          else if (hashCode == disbursed_amount_by_age_of_uncollected_funds_HASH)
-          {
+          case disbursed_amount_by_age_of_uncollected_funds_HASH:
             return DataSetType::disbursed_amount_by_age_of_uncollected_funds;
-          }
-          else if (hashCode == disbursed_amount_by_age_of_disbursed_funds_HASH)
-          {
+          case disbursed_amount_by_age_of_disbursed_funds_HASH:
             return DataSetType::disbursed_amount_by_age_of_disbursed_funds;
-          }
-          else if (hashCode == customer_profile_by_industry_HASH)
-          {
+          case customer_profile_by_industry_HASH:
             return DataSetType::customer_profile_by_industry;
-          }
-          else if (hashCode == customer_profile_by_revenue_HASH)
-          {
+          case customer_profile_by_revenue_HASH:
             return DataSetType::customer_profile_by_revenue;
-          }
-          else if (hashCode == customer_profile_by_geography_HASH)
-          {
+          case customer_profile_by_geography_HASH:
             return DataSetType::customer_profile_by_geography;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace SupportDataSetTypeMapper
       {
 
-        static const int customer_support_contacts_data_HASH = HashingUtils::HashString("customer_support_contacts_data");
-        static const int test_customer_support_contacts_data_HASH = HashingUtils::HashString("test_customer_support_contacts_data");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int customer_support_contacts_data_HASH = -1834555899;
+        static const int test_customer_support_contacts_data_HASH = 1250877266;
 
 
         SupportDataSetType GetSupportDataSetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == customer_support_contacts_data_HASH)
+          switch (hashCode)
           {
+          case customer_support_contacts_data_HASH:
             return SupportDataSetType::customer_support_contacts_data;
-          }
-          else if (hashCode == test_customer_support_contacts_data_HASH)
-          {
+          case test_customer_support_contacts_data_HASH:
             return SupportDataSetType::test_customer_support_contacts_data;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -22,6 +22,9 @@
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/meteringmarketplace/model/MeterUsageResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -133,6 +136,25 @@ namespace Model
          */
         virtual void MeterUsageAsync(const Model::MeterUsageRequest& request, const MeterUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as MeterUsageCallable(const Model::MeterUsageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::MeterUsageOutcomeCallable MeterUsageCallable(Model::MeterUsageRequest&& request) const;
+
+        /**
+         * Same as MeterUsageAsync(const Model::MeterUsageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void MeterUsageAsync(Model::MeterUsageRequest&& request, const MeterUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of MeterUsage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<MarketplaceMeteringClient, Model::MeterUsageRequest, Model::MeterUsageOutcome> MeterUsageAwaitable(Model::MeterUsageRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
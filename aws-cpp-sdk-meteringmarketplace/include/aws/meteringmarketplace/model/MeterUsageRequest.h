@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     MeterUsageRequest();
+    inline const char* GetServiceRequestName() const override { return "MeterUsage"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
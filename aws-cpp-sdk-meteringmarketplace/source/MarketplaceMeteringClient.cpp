@@ -110,7 +110,7 @@ MeterUsageOutcome MarketplaceMeteringClient::MeterUsage(const MeterUsageRequest&
 
 MeterUsageOutcomeCallable MarketplaceMeteringClient::MeterUsageCallable(const MeterUsageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->MeterUsage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->MeterUsage(request); } );
 }
 
 void MarketplaceMeteringClient::MeterUsageAsync(const MeterUsageRequest& request, const MeterUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -118,8 +118,25 @@ void MarketplaceMeteringClient::MeterUsageAsync(const MeterUsageRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->MeterUsageAsyncHelper( request, handler, context ); } );
 }
 
+MeterUsageOutcomeCallable MarketplaceMeteringClient::MeterUsageCallable(MeterUsageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MarketplaceMeteringClient::MeterUsage, this, std::move(request)));
+}
+
+void MarketplaceMeteringClient::MeterUsageAsync(MeterUsageRequest&& request, const MeterUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MarketplaceMeteringClient::MeterUsageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MarketplaceMeteringClient::MeterUsageAsyncHelper(const MeterUsageRequest& request, const MeterUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, MeterUsage(request), context);
 }
 
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<MarketplaceMeteringClient, MeterUsageRequest, MeterUsageOutcome> MarketplaceMeteringClient::MeterUsageAwaitable(MeterUsageRequest request) const
+{
+  return { m_executor.get(), { this, &MarketplaceMeteringClient::MeterUsage, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
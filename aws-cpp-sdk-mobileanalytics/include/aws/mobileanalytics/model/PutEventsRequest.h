@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     PutEventsRequest();
+    inline const char* GetServiceRequestName() const override { return "PutEvents"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -110,7 +110,7 @@ PutEventsOutcome MobileAnalyticsClient::PutEvents(const PutEventsRequest& reques
 
 PutEventsOutcomeCallable MobileAnalyticsClient::PutEventsCallable(const PutEventsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutEvents(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutEvents(request); } );
 }
 
 void MobileAnalyticsClient::PutEventsAsync(const PutEventsRequest& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -118,8 +118,25 @@ void MobileAnalyticsClient::PutEventsAsync(const PutEventsRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->PutEventsAsyncHelper( request, handler, context ); } );
 }
 
+PutEventsOutcomeCallable MobileAnalyticsClient::PutEventsCallable(PutEventsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&MobileAnalyticsClient::PutEvents, this, std::move(request)));
+}
+
+void MobileAnalyticsClient::PutEventsAsync(PutEventsRequest&& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&MobileAnalyticsClient::PutEventsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void MobileAnalyticsClient::PutEventsAsyncHelper(const PutEventsRequest& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutEvents(request), context);
 }
 
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<MobileAnalyticsClient, PutEventsRequest, PutEventsOutcome> MobileAnalyticsClient::PutEventsAwaitable(PutEventsRequest request) const
+{
+  return { m_executor.get(), { this, &MobileAnalyticsClient::PutEvents, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
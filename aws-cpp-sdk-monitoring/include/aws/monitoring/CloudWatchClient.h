@@ -27,6 +27,9 @@
 #include <aws/monitoring/model/ListMetricsResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -185,6 +188,18 @@ namespace Model
          */
         virtual void DeleteAlarmsAsync(const Model::DeleteAlarmsRequest& request, const DeleteAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAlarmsCallable(const Model::DeleteAlarmsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteAlarmsOutcomeCallable DeleteAlarmsCallable(Model::DeleteAlarmsRequest&& request) const;
+
+        /**
+         * Same as DeleteAlarmsAsync(const Model::DeleteAlarmsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteAlarmsAsync(Model::DeleteAlarmsRequest&& request, const DeleteAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves history for the specified alarm. Filter alarms by date range or
          * item type. If an alarm name is not specified, Amazon CloudWatch returns
@@ -216,6 +231,18 @@ namespace Model
          */
         virtual void DescribeAlarmHistoryAsync(const Model::DescribeAlarmHistoryRequest& request, const DescribeAlarmHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAlarmHistoryCallable(const Model::DescribeAlarmHistoryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAlarmHistoryOutcomeCallable DescribeAlarmHistoryCallable(Model::DescribeAlarmHistoryRequest&& request) const;
+
+        /**
+         * Same as DescribeAlarmHistoryAsync(const Model::DescribeAlarmHistoryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAlarmHistoryAsync(Model::DescribeAlarmHistoryRequest&& request, const DescribeAlarmHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves alarms with the specified names. If no name is specified, all
          * alarms for the user are returned. Alarms can be retrieved by using only a prefix
@@ -241,6 +268,18 @@ namespace Model
          */
         virtual void DescribeAlarmsAsync(const Model::DescribeAlarmsRequest& request, const DescribeAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAlarmsCallable(const Model::DescribeAlarmsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAlarmsOutcomeCallable DescribeAlarmsCallable(Model::DescribeAlarmsRequest&& request) const;
+
+        /**
+         * Same as DescribeAlarmsAsync(const Model::DescribeAlarmsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAlarmsAsync(Model::DescribeAlarmsRequest&& request, const DescribeAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves all alarms for a single metric. Specify a statistic, period, or
          * unit to filter the set of alarms further.</p>
@@ -263,6 +302,18 @@ namespace Model
          */
         virtual void DescribeAlarmsForMetricAsync(const Model::DescribeAlarmsForMetricRequest& request, const DescribeAlarmsForMetricResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAlarmsForMetricCallable(const Model::DescribeAlarmsForMetricRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAlarmsForMetricOutcomeCallable DescribeAlarmsForMetricCallable(Model::DescribeAlarmsForMetricRequest&& request) const;
+
+        /**
+         * Same as DescribeAlarmsForMetricAsync(const Model::DescribeAlarmsForMetricRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAlarmsForMetricAsync(Model::DescribeAlarmsForMetricRequest&& request, const DescribeAlarmsForMetricResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables actions for the specified alarms. When an alarm's actions are
          * disabled the alarm's state may change, but none of the alarm's actions will
@@ -288,6 +339,18 @@ namespace Model
          */
         virtual void DisableAlarmActionsAsync(const Model::DisableAlarmActionsRequest& request, const DisableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableAlarmActionsCallable(const Model::DisableAlarmActionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableAlarmActionsOutcomeCallable DisableAlarmActionsCallable(Model::DisableAlarmActionsRequest&& request) const;
+
+        /**
+         * Same as DisableAlarmActionsAsync(const Model::DisableAlarmActionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableAlarmActionsAsync(Model::DisableAlarmActionsRequest&& request, const DisableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables actions for the specified alarms.</p>
          */
@@ -307,6 +370,18 @@ namespace Model
          */
         virtual void EnableAlarmActionsAsync(const Model::EnableAlarmActionsRequest& request, const EnableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableAlarmActionsCallable(const Model::EnableAlarmActionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableAlarmActionsOutcomeCallable EnableAlarmActionsCallable(Model::EnableAlarmActionsRequest&& request) const;
+
+        /**
+         * Same as EnableAlarmActionsAsync(const Model::EnableAlarmActionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableAlarmActionsAsync(Model::EnableAlarmActionsRequest&& request, const EnableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets statistics for the specified metric.</p> <p> The maximum number of data
          * points that can be queried is 50,850, whereas the maximum number of data points
@@ -398,6 +473,18 @@ namespace Model
          */
         virtual void GetMetricStatisticsAsync(const Model::GetMetricStatisticsRequest& request, const GetMetricStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetMetricStatisticsCallable(const Model::GetMetricStatisticsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetMetricStatisticsOutcomeCallable GetMetricStatisticsCallable(Model::GetMetricStatisticsRequest&& request) const;
+
+        /**
+         * Same as GetMetricStatisticsAsync(const Model::GetMetricStatisticsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetMetricStatisticsAsync(Model::GetMetricStatisticsRequest&& request, const GetMetricStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of valid metrics stored for the AWS account owner. Returned
          * metrics can be used with <a>GetMetricStatistics</a> to obtain statistical data
@@ -441,6 +528,18 @@ namespace Model
          */
         virtual void ListMetricsAsync(const Model::ListMetricsRequest& request, const ListMetricsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListMetricsCallable(const Model::ListMetricsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListMetricsOutcomeCallable ListMetricsCallable(Model::ListMetricsRequest&& request) const;
+
+        /**
+         * Same as ListMetricsAsync(const Model::ListMetricsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListMetricsAsync(Model::ListMetricsRequest&& request, const ListMetricsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates an alarm and associates it with the specified Amazon
          * CloudWatch metric. Optionally, this operation can associate one or more Amazon
@@ -547,6 +646,18 @@ namespace Model
          */
         virtual void PutMetricAlarmAsync(const Model::PutMetricAlarmRequest& request, const PutMetricAlarmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutMetricAlarmCallable(const Model::PutMetricAlarmRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutMetricAlarmOutcomeCallable PutMetricAlarmCallable(Model::PutMetricAlarmRequest&& request) const;
+
+        /**
+         * Same as PutMetricAlarmAsync(const Model::PutMetricAlarmRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutMetricAlarmAsync(Model::PutMetricAlarmRequest&& request, const PutMetricAlarmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Publishes metric data points to Amazon CloudWatch. Amazon CloudWatch
          * associates the data points with the specified metric. If the specified metric
@@ -605,6 +716,18 @@ namespace Model
          */
         virtual void PutMetricDataAsync(const Model::PutMetricDataRequest& request, const PutMetricDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutMetricDataCallable(const Model::PutMetricDataRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutMetricDataOutcomeCallable PutMetricDataCallable(Model::PutMetricDataRequest&& request) const;
+
+        /**
+         * Same as PutMetricDataAsync(const Model::PutMetricDataRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutMetricDataAsync(Model::PutMetricDataRequest&& request, const PutMetricDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Temporarily sets the state of an alarm for testing purposes. When the
          * updated <code>StateValue</code> differs from the previous value, the action
@@ -648,6 +771,90 @@ namespace Model
          */
         virtual void SetAlarmStateAsync(const Model::SetAlarmStateRequest& request, const SetAlarmStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetAlarmStateCallable(const Model::SetAlarmStateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetAlarmStateOutcomeCallable SetAlarmStateCallable(Model::SetAlarmStateRequest&& request) const;
+
+        /**
+         * Same as SetAlarmStateAsync(const Model::SetAlarmStateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetAlarmStateAsync(Model::SetAlarmStateRequest&& request, const SetAlarmStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeAlarmHistory(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudWatchClient, Model::DescribeAlarmHistoryRequest, Model::DescribeAlarmHistoryOutcome> DescribeAlarmHistoryPaginator(const Model::DescribeAlarmHistoryRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeAlarms(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudWatchClient, Model::DescribeAlarmsRequest, Model::DescribeAlarmsOutcome> DescribeAlarmsPaginator(const Model::DescribeAlarmsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListMetrics(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<CloudWatchClient, Model::ListMetricsRequest, Model::ListMetricsOutcome> ListMetricsPaginator(const Model::ListMetricsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of DeleteAlarms(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchClient, Model::DeleteAlarmsRequest, Model::DeleteAlarmsOutcome> DeleteAlarmsAwaitable(Model::DeleteAlarmsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAlarmHistory(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchClient, Model::DescribeAlarmHistoryRequest, Model::DescribeAlarmHistoryOutcome> DescribeAlarmHistoryAwaitable(Model::DescribeAlarmHistoryRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAlarms(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchClient, Model::DescribeAlarmsRequest, Model::DescribeAlarmsOutcome> DescribeAlarmsAwaitable(Model::DescribeAlarmsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAlarmsForMetric(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchClient, Model::DescribeAlarmsForMetricRequest, Model::DescribeAlarmsForMetricOutcome> DescribeAlarmsForMetricAwaitable(Model::DescribeAlarmsForMetricRequest request) const;
+
+        /**
+         * co_await-able form of DisableAlarmActions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchClient, Model::DisableAlarmActionsRequest, Model::DisableAlarmActionsOutcome> DisableAlarmActionsAwaitable(Model::DisableAlarmActionsRequest request) const;
+
+        /**
+         * co_await-able form of EnableAlarmActions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchClient, Model::EnableAlarmActionsRequest, Model::EnableAlarmActionsOutcome> EnableAlarmActionsAwaitable(Model::EnableAlarmActionsRequest request) const;
+
+        /**
+         * co_await-able form of GetMetricStatistics(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchClient, Model::GetMetricStatisticsRequest, Model::GetMetricStatisticsOutcome> GetMetricStatisticsAwaitable(Model::GetMetricStatisticsRequest request) const;
+
+        /**
+         * co_await-able form of ListMetrics(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchClient, Model::ListMetricsRequest, Model::ListMetricsOutcome> ListMetricsAwaitable(Model::ListMetricsRequest request) const;
+
+        /**
+         * co_await-able form of PutMetricAlarm(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchClient, Model::PutMetricAlarmRequest, Model::PutMetricAlarmOutcome> PutMetricAlarmAwaitable(Model::PutMetricAlarmRequest request) const;
+
+        /**
+         * co_await-able form of PutMetricData(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchClient, Model::PutMetricDataRequest, Model::PutMetricDataOutcome> PutMetricDataAwaitable(Model::PutMetricDataRequest request) const;
+
+        /**
+         * co_await-able form of SetAlarmState(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<CloudWatchClient, Model::SetAlarmStateRequest, Model::SetAlarmStateOutcome> SetAlarmStateAwaitable(Model::SetAlarmStateRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
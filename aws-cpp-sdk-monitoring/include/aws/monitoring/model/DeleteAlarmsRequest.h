@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteAlarmsRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteAlarms"; }
+
     Aws::String SerializePayload() const override;
 
     /**
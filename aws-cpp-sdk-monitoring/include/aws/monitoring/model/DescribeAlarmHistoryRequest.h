@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeAlarmHistoryRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAlarmHistory"; }
+
     Aws::String SerializePayload() const override;
 
     /**
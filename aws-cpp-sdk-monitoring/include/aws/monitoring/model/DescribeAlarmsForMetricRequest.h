@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     DescribeAlarmsForMetricRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAlarmsForMetric"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeAlarmsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAlarms"; }
+
     Aws::String SerializePayload() const override;
 
     /**
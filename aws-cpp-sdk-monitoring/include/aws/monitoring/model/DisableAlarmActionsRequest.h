@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DisableAlarmActionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableAlarmActions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     EnableAlarmActionsRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableAlarmActions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetMetricStatisticsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetMetricStatistics"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ListMetricsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListMetrics"; }
+
     Aws::String SerializePayload() const override;
 
     /**
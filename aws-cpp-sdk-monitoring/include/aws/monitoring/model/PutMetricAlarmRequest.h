@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     PutMetricAlarmRequest();
+    inline const char* GetServiceRequestName() const override { return "PutMetricAlarm"; }
+
     Aws::String SerializePayload() const override;
 
     /**
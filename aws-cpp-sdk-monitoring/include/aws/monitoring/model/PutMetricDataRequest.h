@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     PutMetricDataRequest();
+    inline const char* GetServiceRequestName() const override { return "PutMetricData"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetAlarmStateRequest();
+    inline const char* GetServiceRequestName() const override { return "SetAlarmState"; }
+
     Aws::String SerializePayload() const override;
 
     /**
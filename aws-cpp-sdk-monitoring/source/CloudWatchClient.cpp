@@ -120,7 +120,7 @@ DeleteAlarmsOutcome CloudWatchClient::DeleteAlarms(const DeleteAlarmsRequest& re
 
 DeleteAlarmsOutcomeCallable CloudWatchClient::DeleteAlarmsCallable(const DeleteAlarmsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteAlarms( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteAlarms( request ); } );
 }
 
 void CloudWatchClient::DeleteAlarmsAsync(const DeleteAlarmsRequest& request, const DeleteAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -128,6 +128,16 @@ void CloudWatchClient::DeleteAlarmsAsync(const DeleteAlarmsRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->DeleteAlarmsAsyncHelper( request, handler, context ); } );
 }
 
+DeleteAlarmsOutcomeCallable CloudWatchClient::DeleteAlarmsCallable(DeleteAlarmsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchClient::DeleteAlarms, this, std::move(request)));
+}
+
+void CloudWatchClient::DeleteAlarmsAsync(DeleteAlarmsRequest&& request, const DeleteAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchClient::DeleteAlarmsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchClient::DeleteAlarmsAsyncHelper(const DeleteAlarmsRequest& request, const DeleteAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteAlarms(request), context);
@@ -150,7 +160,7 @@ DescribeAlarmHistoryOutcome CloudWatchClient::DescribeAlarmHistory(const Describ
 
 DescribeAlarmHistoryOutcomeCallable CloudWatchClient::DescribeAlarmHistoryCallable(const DescribeAlarmHistoryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAlarmHistory( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAlarmHistory( request ); } );
 }
 
 void CloudWatchClient::DescribeAlarmHistoryAsync(const DescribeAlarmHistoryRequest& request, const DescribeAlarmHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -158,6 +168,16 @@ void CloudWatchClient::DescribeAlarmHistoryAsync(const DescribeAlarmHistoryReque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAlarmHistoryAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAlarmHistoryOutcomeCallable CloudWatchClient::DescribeAlarmHistoryCallable(DescribeAlarmHistoryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchClient::DescribeAlarmHistory, this, std::move(request)));
+}
+
+void CloudWatchClient::DescribeAlarmHistoryAsync(DescribeAlarmHistoryRequest&& request, const DescribeAlarmHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchClient::DescribeAlarmHistoryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchClient::DescribeAlarmHistoryAsyncHelper(const DescribeAlarmHistoryRequest& request, const DescribeAlarmHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAlarmHistory(request), context);
@@ -180,7 +200,7 @@ DescribeAlarmsOutcome CloudWatchClient::DescribeAlarms(const DescribeAlarmsReque
 
 DescribeAlarmsOutcomeCallable CloudWatchClient::DescribeAlarmsCallable(const DescribeAlarmsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAlarms( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAlarms( request ); } );
 }
 
 void CloudWatchClient::DescribeAlarmsAsync(const DescribeAlarmsRequest& request, const DescribeAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -188,6 +208,16 @@ void CloudWatchClient::DescribeAlarmsAsync(const DescribeAlarmsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAlarmsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAlarmsOutcomeCallable CloudWatchClient::DescribeAlarmsCallable(DescribeAlarmsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchClient::DescribeAlarms, this, std::move(request)));
+}
+
+void CloudWatchClient::DescribeAlarmsAsync(DescribeAlarmsRequest&& request, const DescribeAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchClient::DescribeAlarmsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchClient::DescribeAlarmsAsyncHelper(const DescribeAlarmsRequest& request, const DescribeAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAlarms(request), context);
@@ -210,7 +240,7 @@ DescribeAlarmsForMetricOutcome CloudWatchClient::DescribeAlarmsForMetric(const D
 
 DescribeAlarmsForMetricOutcomeCallable CloudWatchClient::DescribeAlarmsForMetricCallable(const DescribeAlarmsForMetricRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAlarmsForMetric( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAlarmsForMetric( request ); } );
 }
 
 void CloudWatchClient::DescribeAlarmsForMetricAsync(const DescribeAlarmsForMetricRequest& request, const DescribeAlarmsForMetricResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -218,6 +248,16 @@ void CloudWatchClient::DescribeAlarmsForMetricAsync(const DescribeAlarmsForMetri
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAlarmsForMetricAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAlarmsForMetricOutcomeCallable CloudWatchClient::DescribeAlarmsForMetricCallable(DescribeAlarmsForMetricRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchClient::DescribeAlarmsForMetric, this, std::move(request)));
+}
+
+void CloudWatchClient::DescribeAlarmsForMetricAsync(DescribeAlarmsForMetricRequest&& request, const DescribeAlarmsForMetricResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchClient::DescribeAlarmsForMetricAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchClient::DescribeAlarmsForMetricAsyncHelper(const DescribeAlarmsForMetricRequest& request, const DescribeAlarmsForMetricResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAlarmsForMetric(request), context);
@@ -240,7 +280,7 @@ DisableAlarmActionsOutcome CloudWatchClient::DisableAlarmActions(const DisableAl
 
 DisableAlarmActionsOutcomeCallable CloudWatchClient::DisableAlarmActionsCallable(const DisableAlarmActionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableAlarmActions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableAlarmActions( request ); } );
 }
 
 void CloudWatchClient::DisableAlarmActionsAsync(const DisableAlarmActionsRequest& request, const DisableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -248,6 +288,16 @@ void CloudWatchClient::DisableAlarmActionsAsync(const DisableAlarmActionsRequest
   m_executor->Submit( [this, request, handler, context](){ this->DisableAlarmActionsAsyncHelper( request, handler, context ); } );
 }
 
+DisableAlarmActionsOutcomeCallable CloudWatchClient::DisableAlarmActionsCallable(DisableAlarmActionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchClient::DisableAlarmActions, this, std::move(request)));
+}
+
+void CloudWatchClient::DisableAlarmActionsAsync(DisableAlarmActionsRequest&& request, const DisableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchClient::DisableAlarmActionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchClient::DisableAlarmActionsAsyncHelper(const DisableAlarmActionsRequest& request, const DisableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableAlarmActions(request), context);
@@ -270,7 +320,7 @@ EnableAlarmActionsOutcome CloudWatchClient::EnableAlarmActions(const EnableAlarm
 
 EnableAlarmActionsOutcomeCallable CloudWatchClient::EnableAlarmActionsCallable(const EnableAlarmActionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableAlarmActions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableAlarmActions( request ); } );
 }
 
 void CloudWatchClient::EnableAlarmActionsAsync(const EnableAlarmActionsRequest& request, const EnableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -278,6 +328,16 @@ void CloudWatchClient::EnableAlarmActionsAsync(const EnableAlarmActionsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->EnableAlarmActionsAsyncHelper( request, handler, context ); } );
 }
 
+EnableAlarmActionsOutcomeCallable CloudWatchClient::EnableAlarmActionsCallable(EnableAlarmActionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchClient::EnableAlarmActions, this, std::move(request)));
+}
+
+void CloudWatchClient::EnableAlarmActionsAsync(EnableAlarmActionsRequest&& request, const EnableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchClient::EnableAlarmActionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchClient::EnableAlarmActionsAsyncHelper(const EnableAlarmActionsRequest& request, const EnableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableAlarmActions(request), context);
@@ -300,7 +360,7 @@ GetMetricStatisticsOutcome CloudWatchClient::GetMetricStatistics(const GetMetric
 
 GetMetricStatisticsOutcomeCallable CloudWatchClient::GetMetricStatisticsCallable(const GetMetricStatisticsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetMetricStatistics( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetMetricStatistics( request ); } );
 }
 
 void CloudWatchClient::GetMetricStatisticsAsync(const GetMetricStatisticsRequest& request, const GetMetricStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -308,6 +368,16 @@ void CloudWatchClient::GetMetricStatisticsAsync(const GetMetricStatisticsRequest
   m_executor->Submit( [this, request, handler, context](){ this->GetMetricStatisticsAsyncHelper( request, handler, context ); } );
 }
 
+GetMetricStatisticsOutcomeCallable CloudWatchClient::GetMetricStatisticsCallable(GetMetricStatisticsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchClient::GetMetricStatistics, this, std::move(request)));
+}
+
+void CloudWatchClient::GetMetricStatisticsAsync(GetMetricStatisticsRequest&& request, const GetMetricStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchClient::GetMetricStatisticsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchClient::GetMetricStatisticsAsyncHelper(const GetMetricStatisticsRequest& request, const GetMetricStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetMetricStatistics(request), context);
@@ -330,7 +400,7 @@ ListMetricsOutcome CloudWatchClient::ListMetrics(const ListMetricsRequest& reque
 
 ListMetricsOutcomeCallable CloudWatchClient::ListMetricsCallable(const ListMetricsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListMetrics( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListMetrics( request ); } );
 }
 
 void CloudWatchClient::ListMetricsAsync(const ListMetricsRequest& request, const ListMetricsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -338,6 +408,16 @@ void CloudWatchClient::ListMetricsAsync(const ListMetricsRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ListMetricsAsyncHelper( request, handler, context ); } );
 }
 
+ListMetricsOutcomeCallable CloudWatchClient::ListMetricsCallable(ListMetricsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchClient::ListMetrics, this, std::move(request)));
+}
+
+void CloudWatchClient::ListMetricsAsync(ListMetricsRequest&& request, const ListMetricsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchClient::ListMetricsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchClient::ListMetricsAsyncHelper(const ListMetricsRequest& request, const ListMetricsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListMetrics(request), context);
@@ -360,7 +440,7 @@ PutMetricAlarmOutcome CloudWatchClient::PutMetricAlarm(const PutMetricAlarmReque
 
 PutMetricAlarmOutcomeCallable CloudWatchClient::PutMetricAlarmCallable(const PutMetricAlarmRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutMetricAlarm( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutMetricAlarm( request ); } );
 }
 
 void CloudWatchClient::PutMetricAlarmAsync(const PutMetricAlarmRequest& request, const PutMetricAlarmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -368,6 +448,16 @@ void CloudWatchClient::PutMetricAlarmAsync(const PutMetricAlarmRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->PutMetricAlarmAsyncHelper( request, handler, context ); } );
 }
 
+PutMetricAlarmOutcomeCallable CloudWatchClient::PutMetricAlarmCallable(PutMetricAlarmRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchClient::PutMetricAlarm, this, std::move(request)));
+}
+
+void CloudWatchClient::PutMetricAlarmAsync(PutMetricAlarmRequest&& request, const PutMetricAlarmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchClient::PutMetricAlarmAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchClient::PutMetricAlarmAsyncHelper(const PutMetricAlarmRequest& request, const PutMetricAlarmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutMetricAlarm(request), context);
@@ -390,7 +480,7 @@ PutMetricDataOutcome CloudWatchClient::PutMetricData(const PutMetricDataRequest&
 
 PutMetricDataOutcomeCallable CloudWatchClient::PutMetricDataCallable(const PutMetricDataRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutMetricData( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutMetricData( request ); } );
 }
 
 void CloudWatchClient::PutMetricDataAsync(const PutMetricDataRequest& request, const PutMetricDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -398,6 +488,16 @@ void CloudWatchClient::PutMetricDataAsync(const PutMetricDataRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->PutMetricDataAsyncHelper( request, handler, context ); } );
 }
 
+PutMetricDataOutcomeCallable CloudWatchClient::PutMetricDataCallable(PutMetricDataRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchClient::PutMetricData, this, std::move(request)));
+}
+
+void CloudWatchClient::PutMetricDataAsync(PutMetricDataRequest&& request, const PutMetricDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchClient::PutMetricDataAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchClient::PutMetricDataAsyncHelper(const PutMetricDataRequest& request, const PutMetricDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutMetricData(request), context);
@@ -420,7 +520,7 @@ SetAlarmStateOutcome CloudWatchClient::SetAlarmState(const SetAlarmStateRequest&
 
 SetAlarmStateOutcomeCallable CloudWatchClient::SetAlarmStateCallable(const SetAlarmStateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetAlarmState( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetAlarmState( request ); } );
 }
 
 void CloudWatchClient::SetAlarmStateAsync(const SetAlarmStateRequest& request, const SetAlarmStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -428,8 +528,126 @@ void CloudWatchClient::SetAlarmStateAsync(const SetAlarmStateRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->SetAlarmStateAsyncHelper( request, handler, context ); } );
 }
 
+SetAlarmStateOutcomeCallable CloudWatchClient::SetAlarmStateCallable(SetAlarmStateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&CloudWatchClient::SetAlarmState, this, std::move(request)));
+}
+
+void CloudWatchClient::SetAlarmStateAsync(SetAlarmStateRequest&& request, const SetAlarmStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&CloudWatchClient::SetAlarmStateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void CloudWatchClient::SetAlarmStateAsyncHelper(const SetAlarmStateRequest& request, const SetAlarmStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetAlarmState(request), context);
 }
 
+Paginator<CloudWatchClient, DescribeAlarmHistoryRequest, DescribeAlarmHistoryOutcome> CloudWatchClient::DescribeAlarmHistoryPaginator(const DescribeAlarmHistoryRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudWatchClient, DescribeAlarmHistoryRequest, DescribeAlarmHistoryOutcome>(this, &CloudWatchClient::DescribeAlarmHistory, request,
+    [](const DescribeAlarmHistoryRequest& current, const DescribeAlarmHistoryOutcome& outcome, DescribeAlarmHistoryRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudWatchClient, DescribeAlarmsRequest, DescribeAlarmsOutcome> CloudWatchClient::DescribeAlarmsPaginator(const DescribeAlarmsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudWatchClient, DescribeAlarmsRequest, DescribeAlarmsOutcome>(this, &CloudWatchClient::DescribeAlarms, request,
+    [](const DescribeAlarmsRequest& current, const DescribeAlarmsOutcome& outcome, DescribeAlarmsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<CloudWatchClient, ListMetricsRequest, ListMetricsOutcome> CloudWatchClient::ListMetricsPaginator(const ListMetricsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<CloudWatchClient, ListMetricsRequest, ListMetricsOutcome>(this, &CloudWatchClient::ListMetrics, request,
+    [](const ListMetricsRequest& current, const ListMetricsOutcome& outcome, ListMetricsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<CloudWatchClient, DeleteAlarmsRequest, DeleteAlarmsOutcome> CloudWatchClient::DeleteAlarmsAwaitable(DeleteAlarmsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchClient::DeleteAlarms, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchClient, DescribeAlarmHistoryRequest, DescribeAlarmHistoryOutcome> CloudWatchClient::DescribeAlarmHistoryAwaitable(DescribeAlarmHistoryRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchClient::DescribeAlarmHistory, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchClient, DescribeAlarmsRequest, DescribeAlarmsOutcome> CloudWatchClient::DescribeAlarmsAwaitable(DescribeAlarmsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchClient::DescribeAlarms, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchClient, DescribeAlarmsForMetricRequest, DescribeAlarmsForMetricOutcome> CloudWatchClient::DescribeAlarmsForMetricAwaitable(DescribeAlarmsForMetricRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchClient::DescribeAlarmsForMetric, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchClient, DisableAlarmActionsRequest, DisableAlarmActionsOutcome> CloudWatchClient::DisableAlarmActionsAwaitable(DisableAlarmActionsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchClient::DisableAlarmActions, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchClient, EnableAlarmActionsRequest, EnableAlarmActionsOutcome> CloudWatchClient::EnableAlarmActionsAwaitable(EnableAlarmActionsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchClient::EnableAlarmActions, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchClient, GetMetricStatisticsRequest, GetMetricStatisticsOutcome> CloudWatchClient::GetMetricStatisticsAwaitable(GetMetricStatisticsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchClient::GetMetricStatistics, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchClient, ListMetricsRequest, ListMetricsOutcome> CloudWatchClient::ListMetricsAwaitable(ListMetricsRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchClient::ListMetrics, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchClient, PutMetricAlarmRequest, PutMetricAlarmOutcome> CloudWatchClient::PutMetricAlarmAwaitable(PutMetricAlarmRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchClient::PutMetricAlarm, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchClient, PutMetricDataRequest, PutMetricDataOutcome> CloudWatchClient::PutMetricDataAwaitable(PutMetricDataRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchClient::PutMetricData, std::move(request) } };
+}
+
+ClientOperationAwaitable<CloudWatchClient, SetAlarmStateRequest, SetAlarmStateOutcome> CloudWatchClient::SetAlarmStateAwaitable(SetAlarmStateRequest request) const
+{
+  return { m_executor.get(), { this, &CloudWatchClient::SetAlarmState, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -57,31 +57,31 @@ AlarmHistoryItem& AlarmHistoryItem::operator =(const XmlNode& xmlNode)
     XmlNode alarmNameNode = resultNode.FirstChild("AlarmName");
     if(!alarmNameNode.IsNull())
     {
-      m_alarmName = StringUtils::Trim(alarmNameNode.GetText().c_str());
+      m_alarmName = alarmNameNode.GetTextView().Trim().ToString();
       m_alarmNameHasBeenSet = true;
     }
     XmlNode timestampNode = resultNode.FirstChild("Timestamp");
     if(!timestampNode.IsNull())
     {
-      m_timestamp = DateTime(StringUtils::Trim(timestampNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_timestamp = DateTime(timestampNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_timestampHasBeenSet = true;
     }
     XmlNode historyItemTypeNode = resultNode.FirstChild("HistoryItemType");
     if(!historyItemTypeNode.IsNull())
     {
-      m_historyItemType = HistoryItemTypeMapper::GetHistoryItemTypeForName(StringUtils::Trim(historyItemTypeNode.GetText().c_str()).c_str());
+      m_historyItemType = HistoryItemTypeMapper::GetHistoryItemTypeForName(historyItemTypeNode.GetTextView().Trim().ToString().c_str());
       m_historyItemTypeHasBeenSet = true;
     }
     XmlNode historySummaryNode = resultNode.FirstChild("HistorySummary");
     if(!historySummaryNode.IsNull())
     {
-      m_historySummary = StringUtils::Trim(historySummaryNode.GetText().c_str());
+      m_historySummary = historySummaryNode.GetTextView().Trim().ToString();
       m_historySummaryHasBeenSet = true;
     }
     XmlNode historyDataNode = resultNode.FirstChild("HistoryData");
     if(!historyDataNode.IsNull())
     {
-      m_historyData = StringUtils::Trim(historyDataNode.GetText().c_str());
+      m_historyData = historyDataNode.GetTextView().Trim().ToString();
       m_historyDataHasBeenSet = true;
     }
   }
@@ -93,12 +93,12 @@ void AlarmHistoryItem::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_alarmNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AlarmName=" << StringUtils::URLEncode(m_alarmName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AlarmName=" << StringUtils::URLEncoded(m_alarmName) << "&";
   }
 
   if(m_timestampHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Timestamp=" << StringUtils::URLEncode(m_timestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".Timestamp=" << StringUtils::URLEncoded(m_timestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_historyItemTypeHasBeenSet)
@@ -108,12 +108,12 @@ void AlarmHistoryItem::OutputToStream(Aws::OStream& oStream, const char* locatio
 
   if(m_historySummaryHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HistorySummary=" << StringUtils::URLEncode(m_historySummary.c_str()) << "&";
+      oStream << location << index << locationValue << ".HistorySummary=" << StringUtils::URLEncoded(m_historySummary) << "&";
   }
 
   if(m_historyDataHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HistoryData=" << StringUtils::URLEncode(m_historyData.c_str()) << "&";
+      oStream << location << index << locationValue << ".HistoryData=" << StringUtils::URLEncoded(m_historyData) << "&";
   }
 
 }
@@ -122,11 +122,11 @@ void AlarmHistoryItem::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_alarmNameHasBeenSet)
   {
-      oStream << location << ".AlarmName=" << StringUtils::URLEncode(m_alarmName.c_str()) << "&";
+      oStream << location << ".AlarmName=" << StringUtils::URLEncoded(m_alarmName) << "&";
   }
   if(m_timestampHasBeenSet)
   {
-      oStream << location << ".Timestamp=" << StringUtils::URLEncode(m_timestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".Timestamp=" << StringUtils::URLEncoded(m_timestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_historyItemTypeHasBeenSet)
   {
@@ -134,11 +134,11 @@ void AlarmHistoryItem::OutputToStream(Aws::OStream& oStream, const char* locatio
   }
   if(m_historySummaryHasBeenSet)
   {
-      oStream << location << ".HistorySummary=" << StringUtils::URLEncode(m_historySummary.c_str()) << "&";
+      oStream << location << ".HistorySummary=" << StringUtils::URLEncoded(m_historySummary) << "&";
   }
   if(m_historyDataHasBeenSet)
   {
-      oStream << location << ".HistoryData=" << StringUtils::URLEncode(m_historyData.c_str()) << "&";
+      oStream << location << ".HistoryData=" << StringUtils::URLEncoded(m_historyData) << "&";
   }
 }
 
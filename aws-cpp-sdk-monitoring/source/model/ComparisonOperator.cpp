@@ -29,31 +29,35 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int GreaterThanOrEqualToThreshold_HASH = HashingUtils::HashString("GreaterThanOrEqualToThreshold");
-        static const int GreaterThanThreshold_HASH = HashingUtils::HashString("GreaterThanThreshold");
-        static const int LessThanThreshold_HASH = HashingUtils::HashString("LessThanThreshold");
-        static const int LessThanOrEqualToThreshold_HASH = HashingUtils::HashString("LessThanOrEqualToThreshold");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int GreaterThanOrEqualToThreshold_HASH = -1967855526;
+        static const int GreaterThanThreshold_HASH = 281950736;
+        static const int LessThanThreshold_HASH = -1512019311;
+        static const int LessThanOrEqualToThreshold_HASH = 1746581753;
 
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GreaterThanOrEqualToThreshold_HASH)
+          switch (hashCode)
           {
+          case GreaterThanOrEqualToThreshold_HASH:
             return ComparisonOperator::GreaterThanOrEqualToThreshold;
-          }
-          else if (hashCode == GreaterThanThreshold_HASH)
-          {
+          case GreaterThanThreshold_HASH:
             return ComparisonOperator::GreaterThanThreshold;
-          }
-          else if (hashCode == LessThanThreshold_HASH)
-          {
+          case LessThanThreshold_HASH:
             return ComparisonOperator::LessThanThreshold;
-          }
-          else if (hashCode == LessThanOrEqualToThreshold_HASH)
-          {
+          case LessThanOrEqualToThreshold_HASH:
             return ComparisonOperator::LessThanOrEqualToThreshold;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
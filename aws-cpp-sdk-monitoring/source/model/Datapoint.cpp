@@ -71,43 +71,43 @@ Datapoint& Datapoint::operator =(const XmlNode& xmlNode)
     XmlNode timestampNode = resultNode.FirstChild("Timestamp");
     if(!timestampNode.IsNull())
     {
-      m_timestamp = DateTime(StringUtils::Trim(timestampNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_timestamp = DateTime(timestampNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_timestampHasBeenSet = true;
     }
     XmlNode sampleCountNode = resultNode.FirstChild("SampleCount");
     if(!sampleCountNode.IsNull())
     {
-      m_sampleCount = StringUtils::ConvertToDouble(StringUtils::Trim(sampleCountNode.GetText().c_str()).c_str());
+      m_sampleCount = StringUtils::ConvertToDouble(sampleCountNode.GetTextView().Trim().ToString().c_str());
       m_sampleCountHasBeenSet = true;
     }
     XmlNode averageNode = resultNode.FirstChild("Average");
     if(!averageNode.IsNull())
     {
-      m_average = StringUtils::ConvertToDouble(StringUtils::Trim(averageNode.GetText().c_str()).c_str());
+      m_average = StringUtils::ConvertToDouble(averageNode.GetTextView().Trim().ToString().c_str());
       m_averageHasBeenSet = true;
     }
     XmlNode sumNode = resultNode.FirstChild("Sum");
     if(!sumNode.IsNull())
     {
-      m_sum = StringUtils::ConvertToDouble(StringUtils::Trim(sumNode.GetText().c_str()).c_str());
+      m_sum = StringUtils::ConvertToDouble(sumNode.GetTextView().Trim().ToString().c_str());
       m_sumHasBeenSet = true;
     }
     XmlNode minimumNode = resultNode.FirstChild("Minimum");
     if(!minimumNode.IsNull())
     {
-      m_minimum = StringUtils::ConvertToDouble(StringUtils::Trim(minimumNode.GetText().c_str()).c_str());
+      m_minimum = StringUtils::ConvertToDouble(minimumNode.GetTextView().Trim().ToString().c_str());
       m_minimumHasBeenSet = true;
     }
     XmlNode maximumNode = resultNode.FirstChild("Maximum");
     if(!maximumNode.IsNull())
     {
-      m_maximum = StringUtils::ConvertToDouble(StringUtils::Trim(maximumNode.GetText().c_str()).c_str());
+      m_maximum = StringUtils::ConvertToDouble(maximumNode.GetTextView().Trim().ToString().c_str());
       m_maximumHasBeenSet = true;
     }
     XmlNode unitNode = resultNode.FirstChild("Unit");
     if(!unitNode.IsNull())
     {
-      m_unit = StandardUnitMapper::GetStandardUnitForName(StringUtils::Trim(unitNode.GetText().c_str()).c_str());
+      m_unit = StandardUnitMapper::GetStandardUnitForName(unitNode.GetTextView().Trim().ToString().c_str());
       m_unitHasBeenSet = true;
     }
   }
@@ -119,7 +119,7 @@ void Datapoint::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 {
   if(m_timestampHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Timestamp=" << StringUtils::URLEncode(m_timestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".Timestamp=" << StringUtils::URLEncoded(m_timestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_sampleCountHasBeenSet)
@@ -158,7 +158,7 @@ void Datapoint::OutputToStream(Aws::OStream& oStream, const char* location) cons
 {
   if(m_timestampHasBeenSet)
   {
-      oStream << location << ".Timestamp=" << StringUtils::URLEncode(m_timestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".Timestamp=" << StringUtils::URLEncoded(m_timestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_sampleCountHasBeenSet)
   {
@@ -15,6 +15,7 @@
 #include <aws/monitoring/model/DescribeAlarmHistoryRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudWatch::Model;
 using namespace Aws::Utils;
@@ -32,11 +33,11 @@ DescribeAlarmHistoryRequest::DescribeAlarmHistoryRequest() :
 
 Aws::String DescribeAlarmHistoryRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeAlarmHistory&";
   if(m_alarmNameHasBeenSet)
   {
-    ss << "AlarmName=" << StringUtils::URLEncode(m_alarmName.c_str()) << "&";
+    ss << "AlarmName=" << StringUtils::URLEncoded(m_alarmName) << "&";
   }
 
   if(m_historyItemTypeHasBeenSet)
@@ -46,12 +47,12 @@ Aws::String DescribeAlarmHistoryRequest::SerializePayload() const
 
   if(m_startDateHasBeenSet)
   {
-    ss << "StartDate=" << StringUtils::URLEncode(m_startDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "StartDate=" << StringUtils::URLEncoded(m_startDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_endDateHasBeenSet)
   {
-    ss << "EndDate=" << StringUtils::URLEncode(m_endDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "EndDate=" << StringUtils::URLEncoded(m_endDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -61,10 +62,10 @@ Aws::String DescribeAlarmHistoryRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   ss << "Version=2010-08-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeAlarmHistoryResult& DescribeAlarmHistoryResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeAlarmHistoryResult")
+  if (rootNode.GetNameView() != "DescribeAlarmHistoryResult")
   {
     resultNode = rootNode.FirstChild("DescribeAlarmHistoryResult");
   }
@@ -61,7 +61,7 @@ DescribeAlarmHistoryResult& DescribeAlarmHistoryResult::operator =(const AmazonW
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
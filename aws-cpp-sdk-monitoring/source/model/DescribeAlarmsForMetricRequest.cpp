@@ -15,6 +15,7 @@
 #include <aws/monitoring/model/DescribeAlarmsForMetricRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudWatch::Model;
 using namespace Aws::Utils;
@@ -32,16 +33,16 @@ DescribeAlarmsForMetricRequest::DescribeAlarmsForMetricRequest() :
 
 Aws::String DescribeAlarmsForMetricRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeAlarmsForMetric&";
   if(m_metricNameHasBeenSet)
   {
-    ss << "MetricName=" << StringUtils::URLEncode(m_metricName.c_str()) << "&";
+    ss << "MetricName=" << StringUtils::URLEncoded(m_metricName) << "&";
   }
 
   if(m_namespaceHasBeenSet)
   {
-    ss << "Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+    ss << "Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
 
   if(m_statisticHasBeenSet)
@@ -70,6 +71,6 @@ Aws::String DescribeAlarmsForMetricRequest::SerializePayload() const
   }
 
   ss << "Version=2010-08-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
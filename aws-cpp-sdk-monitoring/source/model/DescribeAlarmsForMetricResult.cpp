@@ -40,7 +40,7 @@ DescribeAlarmsForMetricResult& DescribeAlarmsForMetricResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeAlarmsForMetricResult")
+  if (rootNode.GetNameView() != "DescribeAlarmsForMetricResult")
   {
     resultNode = rootNode.FirstChild("DescribeAlarmsForMetricResult");
   }
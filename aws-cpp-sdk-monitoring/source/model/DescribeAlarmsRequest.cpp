@@ -15,6 +15,7 @@
 #include <aws/monitoring/model/DescribeAlarmsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudWatch::Model;
 using namespace Aws::Utils;
@@ -32,7 +33,7 @@ DescribeAlarmsRequest::DescribeAlarmsRequest() :
 
 Aws::String DescribeAlarmsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeAlarms&";
   if(m_alarmNamesHasBeenSet)
   {
@@ -40,14 +41,14 @@ Aws::String DescribeAlarmsRequest::SerializePayload() const
     for(auto& item : m_alarmNames)
     {
       ss << "AlarmNames.member." << alarmNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       alarmNamesCount++;
     }
   }
 
   if(m_alarmNamePrefixHasBeenSet)
   {
-    ss << "AlarmNamePrefix=" << StringUtils::URLEncode(m_alarmNamePrefix.c_str()) << "&";
+    ss << "AlarmNamePrefix=" << StringUtils::URLEncoded(m_alarmNamePrefix) << "&";
   }
 
   if(m_stateValueHasBeenSet)
@@ -57,7 +58,7 @@ Aws::String DescribeAlarmsRequest::SerializePayload() const
 
   if(m_actionPrefixHasBeenSet)
   {
-    ss << "ActionPrefix=" << StringUtils::URLEncode(m_actionPrefix.c_str()) << "&";
+    ss << "ActionPrefix=" << StringUtils::URLEncoded(m_actionPrefix) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -67,10 +68,10 @@ Aws::String DescribeAlarmsRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   ss << "Version=2010-08-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
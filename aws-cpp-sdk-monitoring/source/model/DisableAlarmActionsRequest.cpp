@@ -15,6 +15,7 @@
 #include <aws/monitoring/model/DisableAlarmActionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudWatch::Model;
 using namespace Aws::Utils;
@@ -26,7 +27,7 @@ DisableAlarmActionsRequest::DisableAlarmActionsRequest() :
 
 Aws::String DisableAlarmActionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DisableAlarmActions&";
   if(m_alarmNamesHasBeenSet)
   {
@@ -34,12 +35,12 @@ Aws::String DisableAlarmActionsRequest::SerializePayload() const
     for(auto& item : m_alarmNames)
     {
       ss << "AlarmNames.member." << alarmNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       alarmNamesCount++;
     }
   }
 
   ss << "Version=2010-08-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
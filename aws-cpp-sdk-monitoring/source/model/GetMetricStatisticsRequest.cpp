@@ -15,6 +15,7 @@
 #include <aws/monitoring/model/GetMetricStatisticsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudWatch::Model;
 using namespace Aws::Utils;
@@ -34,16 +35,16 @@ GetMetricStatisticsRequest::GetMetricStatisticsRequest() :
 
 Aws::String GetMetricStatisticsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetMetricStatistics&";
   if(m_namespaceHasBeenSet)
   {
-    ss << "Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+    ss << "Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
 
   if(m_metricNameHasBeenSet)
   {
-    ss << "MetricName=" << StringUtils::URLEncode(m_metricName.c_str()) << "&";
+    ss << "MetricName=" << StringUtils::URLEncoded(m_metricName) << "&";
   }
 
   if(m_dimensionsHasBeenSet)
@@ -58,12 +59,12 @@ Aws::String GetMetricStatisticsRequest::SerializePayload() const
 
   if(m_startTimeHasBeenSet)
   {
-    ss << "StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_endTimeHasBeenSet)
   {
-    ss << "EndTime=" << StringUtils::URLEncode(m_endTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "EndTime=" << StringUtils::URLEncoded(m_endTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_periodHasBeenSet)
@@ -77,7 +78,7 @@ Aws::String GetMetricStatisticsRequest::SerializePayload() const
     for(auto& item : m_statistics)
     {
       ss << "Statistics.member." << statisticsCount << "="
-          << StringUtils::URLEncode(StatisticMapper::GetNameForStatistic(item).c_str()) << "&";
+          << StringUtils::URLEncoded(StatisticMapper::GetNameForStatistic(item)) << "&";
       statisticsCount++;
     }
   }
@@ -88,6 +89,6 @@ Aws::String GetMetricStatisticsRequest::SerializePayload() const
   }
 
   ss << "Version=2010-08-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ GetMetricStatisticsResult& GetMetricStatisticsResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetMetricStatisticsResult")
+  if (rootNode.GetNameView() != "GetMetricStatisticsResult")
   {
     resultNode = rootNode.FirstChild("GetMetricStatisticsResult");
   }
@@ -50,7 +50,7 @@ GetMetricStatisticsResult& GetMetricStatisticsResult::operator =(const AmazonWeb
     XmlNode labelNode = resultNode.FirstChild("Label");
     if(!labelNode.IsNull())
     {
-      m_label = StringUtils::Trim(labelNode.GetText().c_str());
+      m_label = labelNode.GetTextView().Trim().ToString();
     }
     XmlNode datapointsNode = resultNode.FirstChild("Datapoints");
     if(!datapointsNode.IsNull())
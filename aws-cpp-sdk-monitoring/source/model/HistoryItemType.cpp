@@ -29,26 +29,32 @@ namespace Aws
       namespace HistoryItemTypeMapper
       {
 
-        static const int ConfigurationUpdate_HASH = HashingUtils::HashString("ConfigurationUpdate");
-        static const int StateUpdate_HASH = HashingUtils::HashString("StateUpdate");
-        static const int Action_HASH = HashingUtils::HashString("Action");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ConfigurationUpdate_HASH = 186798399;
+        static const int StateUpdate_HASH = -1382145894;
+        static const int Action_HASH = 1955883606;
 
 
         HistoryItemType GetHistoryItemTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ConfigurationUpdate_HASH)
+          switch (hashCode)
           {
+          case ConfigurationUpdate_HASH:
             return HistoryItemType::ConfigurationUpdate;
-          }
-          else if (hashCode == StateUpdate_HASH)
-          {
+          case StateUpdate_HASH:
             return HistoryItemType::StateUpdate;
-          }
-          else if (hashCode == Action_HASH)
-          {
+          case Action_HASH:
             return HistoryItemType::Action;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
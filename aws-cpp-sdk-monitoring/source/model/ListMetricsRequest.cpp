@@ -15,6 +15,7 @@
 #include <aws/monitoring/model/ListMetricsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudWatch::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ ListMetricsRequest::ListMetricsRequest() :
 
 Aws::String ListMetricsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListMetrics&";
   if(m_namespaceHasBeenSet)
   {
-    ss << "Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+    ss << "Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
 
   if(m_metricNameHasBeenSet)
   {
-    ss << "MetricName=" << StringUtils::URLEncode(m_metricName.c_str()) << "&";
+    ss << "MetricName=" << StringUtils::URLEncoded(m_metricName) << "&";
   }
 
   if(m_dimensionsHasBeenSet)
@@ -53,10 +54,10 @@ Aws::String ListMetricsRequest::SerializePayload() const
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   ss << "Version=2010-08-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ListMetricsResult& ListMetricsResult::operator =(const AmazonWebServiceResult<Xm
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListMetricsResult")
+  if (rootNode.GetNameView() != "ListMetricsResult")
   {
     resultNode = rootNode.FirstChild("ListMetricsResult");
   }
@@ -61,7 +61,7 @@ ListMetricsResult& ListMetricsResult::operator =(const AmazonWebServiceResult<Xm
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
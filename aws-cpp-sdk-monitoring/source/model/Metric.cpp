@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,13 +54,13 @@ Metric& Metric::operator =(const XmlNode& xmlNode)
     XmlNode namespaceNode = resultNode.FirstChild("Namespace");
     if(!namespaceNode.IsNull())
     {
-      m_namespace = StringUtils::Trim(namespaceNode.GetText().c_str());
+      m_namespace = namespaceNode.GetTextView().Trim().ToString();
       m_namespaceHasBeenSet = true;
     }
     XmlNode metricNameNode = resultNode.FirstChild("MetricName");
     if(!metricNameNode.IsNull())
     {
-      m_metricName = StringUtils::Trim(metricNameNode.GetText().c_str());
+      m_metricName = metricNameNode.GetTextView().Trim().ToString();
       m_metricNameHasBeenSet = true;
     }
     XmlNode dimensionsNode = resultNode.FirstChild("Dimensions");
@@ -83,12 +84,12 @@ void Metric::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
 {
   if(m_namespaceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+      oStream << location << index << locationValue << ".Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
 
   if(m_metricNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MetricName=" << StringUtils::URLEncode(m_metricName.c_str()) << "&";
+      oStream << location << index << locationValue << ".MetricName=" << StringUtils::URLEncoded(m_metricName) << "&";
   }
 
   if(m_dimensionsHasBeenSet)
@@ -96,9 +97,9 @@ void Metric::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
       unsigned dimensionsIdx = 1;
       for(auto& item : m_dimensions)
       {
-        Aws::StringStream dimensionsSs;
+        Aws::Utils::Stream::StringOutputStream dimensionsSs;
         dimensionsSs << location << index << locationValue << ".Dimensions.member." << dimensionsIdx++;
-        item.OutputToStream(oStream, dimensionsSs.str().c_str());
+        item.OutputToStream(oStream, dimensionsSs.GetString().c_str());
       }
   }
 
@@ -108,20 +109,20 @@ void Metric::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_namespaceHasBeenSet)
   {
-      oStream << location << ".Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+      oStream << location << ".Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
   if(m_metricNameHasBeenSet)
   {
-      oStream << location << ".MetricName=" << StringUtils::URLEncode(m_metricName.c_str()) << "&";
+      oStream << location << ".MetricName=" << StringUtils::URLEncoded(m_metricName) << "&";
   }
   if(m_dimensionsHasBeenSet)
   {
       unsigned dimensionsIdx = 1;
       for(auto& item : m_dimensions)
       {
-        Aws::StringStream dimensionsSs;
+        Aws::Utils::Stream::StringOutputStream dimensionsSs;
         dimensionsSs << location <<  ".Dimensions.member." << dimensionsIdx++;
-        item.OutputToStream(oStream, dimensionsSs.str().c_str());
+        item.OutputToStream(oStream, dimensionsSs.GetString().c_str());
       }
   }
 }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -97,31 +98,31 @@ MetricAlarm& MetricAlarm::operator =(const XmlNode& xmlNode)
     XmlNode alarmNameNode = resultNode.FirstChild("AlarmName");
     if(!alarmNameNode.IsNull())
     {
-      m_alarmName = StringUtils::Trim(alarmNameNode.GetText().c_str());
+      m_alarmName = alarmNameNode.GetTextView().Trim().ToString();
       m_alarmNameHasBeenSet = true;
     }
     XmlNode alarmArnNode = resultNode.FirstChild("AlarmArn");
     if(!alarmArnNode.IsNull())
     {
-      m_alarmArn = StringUtils::Trim(alarmArnNode.GetText().c_str());
+      m_alarmArn = alarmArnNode.GetTextView().Trim().ToString();
       m_alarmArnHasBeenSet = true;
     }
     XmlNode alarmDescriptionNode = resultNode.FirstChild("AlarmDescription");
     if(!alarmDescriptionNode.IsNull())
     {
-      m_alarmDescription = StringUtils::Trim(alarmDescriptionNode.GetText().c_str());
+      m_alarmDescription = alarmDescriptionNode.GetTextView().Trim().ToString();
       m_alarmDescriptionHasBeenSet = true;
     }
     XmlNode alarmConfigurationUpdatedTimestampNode = resultNode.FirstChild("AlarmConfigurationUpdatedTimestamp");
     if(!alarmConfigurationUpdatedTimestampNode.IsNull())
     {
-      m_alarmConfigurationUpdatedTimestamp = DateTime(StringUtils::Trim(alarmConfigurationUpdatedTimestampNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_alarmConfigurationUpdatedTimestamp = DateTime(alarmConfigurationUpdatedTimestampNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_alarmConfigurationUpdatedTimestampHasBeenSet = true;
     }
     XmlNode actionsEnabledNode = resultNode.FirstChild("ActionsEnabled");
     if(!actionsEnabledNode.IsNull())
     {
-      m_actionsEnabled = StringUtils::ConvertToBool(StringUtils::Trim(actionsEnabledNode.GetText().c_str()).c_str());
+      m_actionsEnabled = StringUtils::ConvertToBool(actionsEnabledNode.GetTextView().Trim().ToString().c_str());
       m_actionsEnabledHasBeenSet = true;
     }
     XmlNode oKActionsNode = resultNode.FirstChild("OKActions");
@@ -130,7 +131,7 @@ MetricAlarm& MetricAlarm::operator =(const XmlNode& xmlNode)
       XmlNode oKActionsMember = oKActionsNode.FirstChild("member");
       while(!oKActionsMember.IsNull())
       {
-        m_oKActions.push_back(StringUtils::Trim(oKActionsMember.GetText().c_str()));
+        m_oKActions.push_back(oKActionsMember.GetTextView().Trim().ToString());
         oKActionsMember = oKActionsMember.NextNode("member");
       }
 
@@ -142,7 +143,7 @@ MetricAlarm& MetricAlarm::operator =(const XmlNode& xmlNode)
       XmlNode alarmActionsMember = alarmActionsNode.FirstChild("member");
       while(!alarmActionsMember.IsNull())
       {
-        m_alarmActions.push_back(StringUtils::Trim(alarmActionsMember.GetText().c_str()));
+        m_alarmActions.push_back(alarmActionsMember.GetTextView().Trim().ToString());
         alarmActionsMember = alarmActionsMember.NextNode("member");
       }
 
@@ -154,7 +155,7 @@ MetricAlarm& MetricAlarm::operator =(const XmlNode& xmlNode)
       XmlNode insufficientDataActionsMember = insufficientDataActionsNode.FirstChild("member");
       while(!insufficientDataActionsMember.IsNull())
       {
-        m_insufficientDataActions.push_back(StringUtils::Trim(insufficientDataActionsMember.GetText().c_str()));
+        m_insufficientDataActions.push_back(insufficientDataActionsMember.GetTextView().Trim().ToString());
         insufficientDataActionsMember = insufficientDataActionsMember.NextNode("member");
       }
 
@@ -163,43 +164,43 @@ MetricAlarm& MetricAlarm::operator =(const XmlNode& xmlNode)
     XmlNode stateValueNode = resultNode.FirstChild("StateValue");
     if(!stateValueNode.IsNull())
     {
-      m_stateValue = StateValueMapper::GetStateValueForName(StringUtils::Trim(stateValueNode.GetText().c_str()).c_str());
+      m_stateValue = StateValueMapper::GetStateValueForName(stateValueNode.GetTextView().Trim().ToString().c_str());
       m_stateValueHasBeenSet = true;
     }
     XmlNode stateReasonNode = resultNode.FirstChild("StateReason");
     if(!stateReasonNode.IsNull())
     {
-      m_stateReason = StringUtils::Trim(stateReasonNode.GetText().c_str());
+      m_stateReason = stateReasonNode.GetTextView().Trim().ToString();
       m_stateReasonHasBeenSet = true;
     }
     XmlNode stateReasonDataNode = resultNode.FirstChild("StateReasonData");
     if(!stateReasonDataNode.IsNull())
     {
-      m_stateReasonData = StringUtils::Trim(stateReasonDataNode.GetText().c_str());
+      m_stateReasonData = stateReasonDataNode.GetTextView().Trim().ToString();
       m_stateReasonDataHasBeenSet = true;
     }
     XmlNode stateUpdatedTimestampNode = resultNode.FirstChild("StateUpdatedTimestamp");
     if(!stateUpdatedTimestampNode.IsNull())
     {
-      m_stateUpdatedTimestamp = DateTime(StringUtils::Trim(stateUpdatedTimestampNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_stateUpdatedTimestamp = DateTime(stateUpdatedTimestampNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_stateUpdatedTimestampHasBeenSet = true;
     }
     XmlNode metricNameNode = resultNode.FirstChild("MetricName");
     if(!metricNameNode.IsNull())
     {
-      m_metricName = StringUtils::Trim(metricNameNode.GetText().c_str());
+      m_metricName = metricNameNode.GetTextView().Trim().ToString();
       m_metricNameHasBeenSet = true;
     }
     XmlNode namespaceNode = resultNode.FirstChild("Namespace");
     if(!namespaceNode.IsNull())
     {
-      m_namespace = StringUtils::Trim(namespaceNode.GetText().c_str());
+      m_namespace = namespaceNode.GetTextView().Trim().ToString();
       m_namespaceHasBeenSet = true;
     }
     XmlNode statisticNode = resultNode.FirstChild("Statistic");
     if(!statisticNode.IsNull())
     {
-      m_statistic = StatisticMapper::GetStatisticForName(StringUtils::Trim(statisticNode.GetText().c_str()).c_str());
+      m_statistic = StatisticMapper::GetStatisticForName(statisticNode.GetTextView().Trim().ToString().c_str());
       m_statisticHasBeenSet = true;
     }
     XmlNode dimensionsNode = resultNode.FirstChild("Dimensions");
@@ -217,31 +218,31 @@ MetricAlarm& MetricAlarm::operator =(const XmlNode& xmlNode)
     XmlNode periodNode = resultNode.FirstChild("Period");
     if(!periodNode.IsNull())
     {
-      m_period = StringUtils::ConvertToInt32(StringUtils::Trim(periodNode.GetText().c_str()).c_str());
+      m_period = StringUtils::ConvertToInt32(periodNode.GetTextView().Trim().ToString().c_str());
       m_periodHasBeenSet = true;
     }
     XmlNode unitNode = resultNode.FirstChild("Unit");
     if(!unitNode.IsNull())
     {
-      m_unit = StandardUnitMapper::GetStandardUnitForName(StringUtils::Trim(unitNode.GetText().c_str()).c_str());
+      m_unit = StandardUnitMapper::GetStandardUnitForName(unitNode.GetTextView().Trim().ToString().c_str());
       m_unitHasBeenSet = true;
     }
     XmlNode evaluationPeriodsNode = resultNode.FirstChild("EvaluationPeriods");
     if(!evaluationPeriodsNode.IsNull())
     {
-      m_evaluationPeriods = StringUtils::ConvertToInt32(StringUtils::Trim(evaluationPeriodsNode.GetText().c_str()).c_str());
+      m_evaluationPeriods = StringUtils::ConvertToInt32(evaluationPeriodsNode.GetTextView().Trim().ToString().c_str());
       m_evaluationPeriodsHasBeenSet = true;
     }
     XmlNode thresholdNode = resultNode.FirstChild("Threshold");
     if(!thresholdNode.IsNull())
     {
-      m_threshold = StringUtils::ConvertToDouble(StringUtils::Trim(thresholdNode.GetText().c_str()).c_str());
+      m_threshold = StringUtils::ConvertToDouble(thresholdNode.GetTextView().Trim().ToString().c_str());
       m_thresholdHasBeenSet = true;
     }
     XmlNode comparisonOperatorNode = resultNode.FirstChild("ComparisonOperator");
     if(!comparisonOperatorNode.IsNull())
     {
-      m_comparisonOperator = ComparisonOperatorMapper::GetComparisonOperatorForName(StringUtils::Trim(comparisonOperatorNode.GetText().c_str()).c_str());
+      m_comparisonOperator = ComparisonOperatorMapper::GetComparisonOperatorForName(comparisonOperatorNode.GetTextView().Trim().ToString().c_str());
       m_comparisonOperatorHasBeenSet = true;
     }
   }
@@ -253,22 +254,22 @@ void MetricAlarm::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_alarmNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AlarmName=" << StringUtils::URLEncode(m_alarmName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AlarmName=" << StringUtils::URLEncoded(m_alarmName) << "&";
   }
 
   if(m_alarmArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AlarmArn=" << StringUtils::URLEncode(m_alarmArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".AlarmArn=" << StringUtils::URLEncoded(m_alarmArn) << "&";
   }
 
   if(m_alarmDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AlarmDescription=" << StringUtils::URLEncode(m_alarmDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".AlarmDescription=" << StringUtils::URLEncoded(m_alarmDescription) << "&";
   }
 
   if(m_alarmConfigurationUpdatedTimestampHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AlarmConfigurationUpdatedTimestamp=" << StringUtils::URLEncode(m_alarmConfigurationUpdatedTimestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".AlarmConfigurationUpdatedTimestamp=" << StringUtils::URLEncoded(m_alarmConfigurationUpdatedTimestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_actionsEnabledHasBeenSet)
@@ -281,7 +282,7 @@ void MetricAlarm::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned oKActionsIdx = 1;
       for(auto& item : m_oKActions)
       {
-        oStream << location << index << locationValue << ".OKActions.member." << oKActionsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".OKActions.member." << oKActionsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -290,7 +291,7 @@ void MetricAlarm::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned alarmActionsIdx = 1;
       for(auto& item : m_alarmActions)
       {
-        oStream << location << index << locationValue << ".AlarmActions.member." << alarmActionsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".AlarmActions.member." << alarmActionsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -299,7 +300,7 @@ void MetricAlarm::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned insufficientDataActionsIdx = 1;
       for(auto& item : m_insufficientDataActions)
       {
-        oStream << location << index << locationValue << ".InsufficientDataActions.member." << insufficientDataActionsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".InsufficientDataActions.member." << insufficientDataActionsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -310,27 +311,27 @@ void MetricAlarm::OutputToStream(Aws::OStream& oStream, const char* location, un
 
   if(m_stateReasonHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StateReason=" << StringUtils::URLEncode(m_stateReason.c_str()) << "&";
+      oStream << location << index << locationValue << ".StateReason=" << StringUtils::URLEncoded(m_stateReason) << "&";
   }
 
   if(m_stateReasonDataHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StateReasonData=" << StringUtils::URLEncode(m_stateReasonData.c_str()) << "&";
+      oStream << location << index << locationValue << ".StateReasonData=" << StringUtils::URLEncoded(m_stateReasonData) << "&";
   }
 
   if(m_stateUpdatedTimestampHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StateUpdatedTimestamp=" << StringUtils::URLEncode(m_stateUpdatedTimestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".StateUpdatedTimestamp=" << StringUtils::URLEncoded(m_stateUpdatedTimestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_metricNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MetricName=" << StringUtils::URLEncode(m_metricName.c_str()) << "&";
+      oStream << location << index << locationValue << ".MetricName=" << StringUtils::URLEncoded(m_metricName) << "&";
   }
 
   if(m_namespaceHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+      oStream << location << index << locationValue << ".Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
 
   if(m_statisticHasBeenSet)
@@ -343,9 +344,9 @@ void MetricAlarm::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned dimensionsIdx = 1;
       for(auto& item : m_dimensions)
       {
-        Aws::StringStream dimensionsSs;
+        Aws::Utils::Stream::StringOutputStream dimensionsSs;
         dimensionsSs << location << index << locationValue << ".Dimensions.member." << dimensionsIdx++;
-        item.OutputToStream(oStream, dimensionsSs.str().c_str());
+        item.OutputToStream(oStream, dimensionsSs.GetString().c_str());
       }
   }
 
@@ -380,19 +381,19 @@ void MetricAlarm::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_alarmNameHasBeenSet)
   {
-      oStream << location << ".AlarmName=" << StringUtils::URLEncode(m_alarmName.c_str()) << "&";
+      oStream << location << ".AlarmName=" << StringUtils::URLEncoded(m_alarmName) << "&";
   }
   if(m_alarmArnHasBeenSet)
   {
-      oStream << location << ".AlarmArn=" << StringUtils::URLEncode(m_alarmArn.c_str()) << "&";
+      oStream << location << ".AlarmArn=" << StringUtils::URLEncoded(m_alarmArn) << "&";
   }
   if(m_alarmDescriptionHasBeenSet)
   {
-      oStream << location << ".AlarmDescription=" << StringUtils::URLEncode(m_alarmDescription.c_str()) << "&";
+      oStream << location << ".AlarmDescription=" << StringUtils::URLEncoded(m_alarmDescription) << "&";
   }
   if(m_alarmConfigurationUpdatedTimestampHasBeenSet)
   {
-      oStream << location << ".AlarmConfigurationUpdatedTimestamp=" << StringUtils::URLEncode(m_alarmConfigurationUpdatedTimestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".AlarmConfigurationUpdatedTimestamp=" << StringUtils::URLEncoded(m_alarmConfigurationUpdatedTimestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_actionsEnabledHasBeenSet)
   {
@@ -403,7 +404,7 @@ void MetricAlarm::OutputToStream(Aws::OStream& oStream, const char* location) co
       unsigned oKActionsIdx = 1;
       for(auto& item : m_oKActions)
       {
-        oStream << location << ".OKActions.member." << oKActionsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".OKActions.member." << oKActionsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_alarmActionsHasBeenSet)
@@ -411,7 +412,7 @@ void MetricAlarm::OutputToStream(Aws::OStream& oStream, const char* location) co
       unsigned alarmActionsIdx = 1;
       for(auto& item : m_alarmActions)
       {
-        oStream << location << ".AlarmActions.member." << alarmActionsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".AlarmActions.member." << alarmActionsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_insufficientDataActionsHasBeenSet)
@@ -419,7 +420,7 @@ void MetricAlarm::OutputToStream(Aws::OStream& oStream, const char* location) co
       unsigned insufficientDataActionsIdx = 1;
       for(auto& item : m_insufficientDataActions)
       {
-        oStream << location << ".InsufficientDataActions.member." << insufficientDataActionsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".InsufficientDataActions.member." << insufficientDataActionsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_stateValueHasBeenSet)
@@ -428,23 +429,23 @@ void MetricAlarm::OutputToStream(Aws::OStream& oStream, const char* location) co
   }
   if(m_stateReasonHasBeenSet)
   {
-      oStream << location << ".StateReason=" << StringUtils::URLEncode(m_stateReason.c_str()) << "&";
+      oStream << location << ".StateReason=" << StringUtils::URLEncoded(m_stateReason) << "&";
   }
   if(m_stateReasonDataHasBeenSet)
   {
-      oStream << location << ".StateReasonData=" << StringUtils::URLEncode(m_stateReasonData.c_str()) << "&";
+      oStream << location << ".StateReasonData=" << StringUtils::URLEncoded(m_stateReasonData) << "&";
   }
   if(m_stateUpdatedTimestampHasBeenSet)
   {
-      oStream << location << ".StateUpdatedTimestamp=" << StringUtils::URLEncode(m_stateUpdatedTimestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".StateUpdatedTimestamp=" << StringUtils::URLEncoded(m_stateUpdatedTimestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_metricNameHasBeenSet)
   {
-      oStream << location << ".MetricName=" << StringUtils::URLEncode(m_metricName.c_str()) << "&";
+      oStream << location << ".MetricName=" << StringUtils::URLEncoded(m_metricName) << "&";
   }
   if(m_namespaceHasBeenSet)
   {
-      oStream << location << ".Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+      oStream << location << ".Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
   if(m_statisticHasBeenSet)
   {
@@ -455,9 +456,9 @@ void MetricAlarm::OutputToStream(Aws::OStream& oStream, const char* location) co
       unsigned dimensionsIdx = 1;
       for(auto& item : m_dimensions)
       {
-        Aws::StringStream dimensionsSs;
+        Aws::Utils::Stream::StringOutputStream dimensionsSs;
         dimensionsSs << location <<  ".Dimensions.member." << dimensionsIdx++;
-        item.OutputToStream(oStream, dimensionsSs.str().c_str());
+        item.OutputToStream(oStream, dimensionsSs.GetString().c_str());
       }
   }
   if(m_periodHasBeenSet)
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,7 +62,7 @@ MetricDatum& MetricDatum::operator =(const XmlNode& xmlNode)
     XmlNode metricNameNode = resultNode.FirstChild("MetricName");
     if(!metricNameNode.IsNull())
     {
-      m_metricName = StringUtils::Trim(metricNameNode.GetText().c_str());
+      m_metricName = metricNameNode.GetTextView().Trim().ToString();
       m_metricNameHasBeenSet = true;
     }
     XmlNode dimensionsNode = resultNode.FirstChild("Dimensions");
@@ -79,13 +80,13 @@ MetricDatum& MetricDatum::operator =(const XmlNode& xmlNode)
     XmlNode timestampNode = resultNode.FirstChild("Timestamp");
     if(!timestampNode.IsNull())
     {
-      m_timestamp = DateTime(StringUtils::Trim(timestampNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_timestamp = DateTime(timestampNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_timestampHasBeenSet = true;
     }
     XmlNode valueNode = resultNode.FirstChild("Value");
     if(!valueNode.IsNull())
     {
-      m_value = StringUtils::ConvertToDouble(StringUtils::Trim(valueNode.GetText().c_str()).c_str());
+      m_value = StringUtils::ConvertToDouble(valueNode.GetTextView().Trim().ToString().c_str());
       m_valueHasBeenSet = true;
     }
     XmlNode statisticValuesNode = resultNode.FirstChild("StatisticValues");
@@ -97,7 +98,7 @@ MetricDatum& MetricDatum::operator =(const XmlNode& xmlNode)
     XmlNode unitNode = resultNode.FirstChild("Unit");
     if(!unitNode.IsNull())
     {
-      m_unit = StandardUnitMapper::GetStandardUnitForName(StringUtils::Trim(unitNode.GetText().c_str()).c_str());
+      m_unit = StandardUnitMapper::GetStandardUnitForName(unitNode.GetTextView().Trim().ToString().c_str());
       m_unitHasBeenSet = true;
     }
   }
@@ -109,7 +110,7 @@ void MetricDatum::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_metricNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MetricName=" << StringUtils::URLEncode(m_metricName.c_str()) << "&";
+      oStream << location << index << locationValue << ".MetricName=" << StringUtils::URLEncoded(m_metricName) << "&";
   }
 
   if(m_dimensionsHasBeenSet)
@@ -117,15 +118,15 @@ void MetricDatum::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned dimensionsIdx = 1;
       for(auto& item : m_dimensions)
       {
-        Aws::StringStream dimensionsSs;
+        Aws::Utils::Stream::StringOutputStream dimensionsSs;
         dimensionsSs << location << index << locationValue << ".Dimensions.member." << dimensionsIdx++;
-        item.OutputToStream(oStream, dimensionsSs.str().c_str());
+        item.OutputToStream(oStream, dimensionsSs.GetString().c_str());
       }
   }
 
   if(m_timestampHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Timestamp=" << StringUtils::URLEncode(m_timestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".Timestamp=" << StringUtils::URLEncoded(m_timestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_valueHasBeenSet)
@@ -135,9 +136,9 @@ void MetricDatum::OutputToStream(Aws::OStream& oStream, const char* location, un
 
   if(m_statisticValuesHasBeenSet)
   {
-      Aws::StringStream statisticValuesLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream statisticValuesLocationAndMemberSs;
       statisticValuesLocationAndMemberSs << location << index << locationValue << ".StatisticValues";
-      m_statisticValues.OutputToStream(oStream, statisticValuesLocationAndMemberSs.str().c_str());
+      m_statisticValues.OutputToStream(oStream, statisticValuesLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_unitHasBeenSet)
@@ -151,21 +152,21 @@ void MetricDatum::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_metricNameHasBeenSet)
   {
-      oStream << location << ".MetricName=" << StringUtils::URLEncode(m_metricName.c_str()) << "&";
+      oStream << location << ".MetricName=" << StringUtils::URLEncoded(m_metricName) << "&";
   }
   if(m_dimensionsHasBeenSet)
   {
       unsigned dimensionsIdx = 1;
       for(auto& item : m_dimensions)
       {
-        Aws::StringStream dimensionsSs;
+        Aws::Utils::Stream::StringOutputStream dimensionsSs;
         dimensionsSs << location <<  ".Dimensions.member." << dimensionsIdx++;
-        item.OutputToStream(oStream, dimensionsSs.str().c_str());
+        item.OutputToStream(oStream, dimensionsSs.GetString().c_str());
       }
   }
   if(m_timestampHasBeenSet)
   {
-      oStream << location << ".Timestamp=" << StringUtils::URLEncode(m_timestamp.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".Timestamp=" << StringUtils::URLEncoded(m_timestamp.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_valueHasBeenSet)
   {
@@ -15,6 +15,7 @@
 #include <aws/monitoring/model/PutMetricAlarmRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudWatch::Model;
 using namespace Aws::Utils;
@@ -44,16 +45,16 @@ PutMetricAlarmRequest::PutMetricAlarmRequest() :
 
 Aws::String PutMetricAlarmRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=PutMetricAlarm&";
   if(m_alarmNameHasBeenSet)
   {
-    ss << "AlarmName=" << StringUtils::URLEncode(m_alarmName.c_str()) << "&";
+    ss << "AlarmName=" << StringUtils::URLEncoded(m_alarmName) << "&";
   }
 
   if(m_alarmDescriptionHasBeenSet)
   {
-    ss << "AlarmDescription=" << StringUtils::URLEncode(m_alarmDescription.c_str()) << "&";
+    ss << "AlarmDescription=" << StringUtils::URLEncoded(m_alarmDescription) << "&";
   }
 
   if(m_actionsEnabledHasBeenSet)
@@ -67,7 +68,7 @@ Aws::String PutMetricAlarmRequest::SerializePayload() const
     for(auto& item : m_oKActions)
     {
       ss << "OKActions.member." << oKActionsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       oKActionsCount++;
     }
   }
@@ -78,7 +79,7 @@ Aws::String PutMetricAlarmRequest::SerializePayload() const
     for(auto& item : m_alarmActions)
     {
       ss << "AlarmActions.member." << alarmActionsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       alarmActionsCount++;
     }
   }
@@ -89,19 +90,19 @@ Aws::String PutMetricAlarmRequest::SerializePayload() const
     for(auto& item : m_insufficientDataActions)
     {
       ss << "InsufficientDataActions.member." << insufficientDataActionsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       insufficientDataActionsCount++;
     }
   }
 
   if(m_metricNameHasBeenSet)
   {
-    ss << "MetricName=" << StringUtils::URLEncode(m_metricName.c_str()) << "&";
+    ss << "MetricName=" << StringUtils::URLEncoded(m_metricName) << "&";
   }
 
   if(m_namespaceHasBeenSet)
   {
-    ss << "Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+    ss << "Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
 
   if(m_statisticHasBeenSet)
@@ -145,6 +146,6 @@ Aws::String PutMetricAlarmRequest::SerializePayload() const
   }
 
   ss << "Version=2010-08-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/monitoring/model/PutMetricDataRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudWatch::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ PutMetricDataRequest::PutMetricDataRequest() :
 
 Aws::String PutMetricDataRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=PutMetricData&";
   if(m_namespaceHasBeenSet)
   {
-    ss << "Namespace=" << StringUtils::URLEncode(m_namespace.c_str()) << "&";
+    ss << "Namespace=" << StringUtils::URLEncoded(m_namespace) << "&";
   }
 
   if(m_metricDataHasBeenSet)
@@ -45,6 +46,6 @@ Aws::String PutMetricDataRequest::SerializePayload() const
   }
 
   ss << "Version=2010-08-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/monitoring/model/SetAlarmStateRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::CloudWatch::Model;
 using namespace Aws::Utils;
@@ -29,11 +30,11 @@ SetAlarmStateRequest::SetAlarmStateRequest() :
 
 Aws::String SetAlarmStateRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SetAlarmState&";
   if(m_alarmNameHasBeenSet)
   {
-    ss << "AlarmName=" << StringUtils::URLEncode(m_alarmName.c_str()) << "&";
+    ss << "AlarmName=" << StringUtils::URLEncoded(m_alarmName) << "&";
   }
 
   if(m_stateValueHasBeenSet)
@@ -43,15 +44,15 @@ Aws::String SetAlarmStateRequest::SerializePayload() const
 
   if(m_stateReasonHasBeenSet)
   {
-    ss << "StateReason=" << StringUtils::URLEncode(m_stateReason.c_str()) << "&";
+    ss << "StateReason=" << StringUtils::URLEncoded(m_stateReason) << "&";
   }
 
   if(m_stateReasonDataHasBeenSet)
   {
-    ss << "StateReasonData=" << StringUtils::URLEncode(m_stateReasonData.c_str()) << "&";
+    ss << "StateReasonData=" << StringUtils::URLEncoded(m_stateReasonData) << "&";
   }
 
   ss << "Version=2010-08-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -29,146 +29,104 @@ namespace Aws
       namespace StandardUnitMapper
       {
 
-        static const int Seconds_HASH = HashingUtils::HashString("Seconds");
-        static const int Microseconds_HASH = HashingUtils::HashString("Microseconds");
-        static const int Milliseconds_HASH = HashingUtils::HashString("Milliseconds");
-        static const int Bytes_HASH = HashingUtils::HashString("Bytes");
-        static const int Kilobytes_HASH = HashingUtils::HashString("Kilobytes");
-        static const int Megabytes_HASH = HashingUtils::HashString("Megabytes");
-        static const int Gigabytes_HASH = HashingUtils::HashString("Gigabytes");
-        static const int Terabytes_HASH = HashingUtils::HashString("Terabytes");
-        static const int Bits_HASH = HashingUtils::HashString("Bits");
-        static const int Kilobits_HASH = HashingUtils::HashString("Kilobits");
-        static const int Megabits_HASH = HashingUtils::HashString("Megabits");
-        static const int Gigabits_HASH = HashingUtils::HashString("Gigabits");
-        static const int Terabits_HASH = HashingUtils::HashString("Terabits");
-        static const int Percent_HASH = HashingUtils::HashString("Percent");
-        static const int Count_HASH = HashingUtils::HashString("Count");
-        static const int Bytes_Second_HASH = HashingUtils::HashString("Bytes/Second");
-        static const int Kilobytes_Second_HASH = HashingUtils::HashString("Kilobytes/Second");
-        static const int Megabytes_Second_HASH = HashingUtils::HashString("Megabytes/Second");
-        static const int Gigabytes_Second_HASH = HashingUtils::HashString("Gigabytes/Second");
-        static const int Terabytes_Second_HASH = HashingUtils::HashString("Terabytes/Second");
-        static const int Bits_Second_HASH = HashingUtils::HashString("Bits/Second");
-        static const int Kilobits_Second_HASH = HashingUtils::HashString("Kilobits/Second");
-        static const int Megabits_Second_HASH = HashingUtils::HashString("Megabits/Second");
-        static const int Gigabits_Second_HASH = HashingUtils::HashString("Gigabits/Second");
-        static const int Terabits_Second_HASH = HashingUtils::HashString("Terabits/Second");
-        static const int Count_Second_HASH = HashingUtils::HashString("Count/Second");
-        static const int None_HASH = HashingUtils::HashString("None");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Seconds_HASH = -660217249;
+        static const int Microseconds_HASH = 1630272347;
+        static const int Milliseconds_HASH = 249515570;
+        static const int Bytes_HASH = 64671819;
+        static const int Kilobytes_HASH = 529570186;
+        static const int Megabytes_HASH = -2010004711;
+        static const int Gigabytes_HASH = -1373905777;
+        static const int Terabytes_HASH = -604678165;
+        static const int Bits_HASH = 2070822;
+        static const int Kilobits_HASH = -537121785;
+        static const int Megabits_HASH = -757590888;
+        static const int Gigabits_HASH = 925496418;
+        static const int Terabits_HASH = -1127899770;
+        static const int Percent_HASH = 985725989;
+        static const int Count_HASH = 65298671;
+        static const int Bytes_Second_HASH = 2146985688;
+        static const int Kilobytes_Second_HASH = 457738425;
+        static const int Megabytes_Second_HASH = 41898058;
+        static const int Gigabytes_Second_HASH = 545375764;
+        static const int Terabytes_Second_HASH = -503051464;
+        static const int Bits_Second_HASH = -1209794147;
+        static const int Kilobits_Second_HASH = 1091018652;
+        static const int Megabits_Second_HASH = 1493246443;
+        static const int Gigabits_Second_HASH = -984364319;
+        static const int Terabits_Second_HASH = 228741437;
+        static const int Count_Second_HASH = 1229821364;
+        static const int None_HASH = 2433880;
 
 
         StandardUnit GetStandardUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Seconds_HASH)
+          switch (hashCode)
           {
+          case Seconds_HASH:
             return StandardUnit::Seconds;
-          }
-          else if (hashCode == Microseconds_HASH)
-          {
+          case Microseconds_HASH:
             return StandardUnit::Microseconds;
-          }
-          else if (hashCode == Milliseconds_HASH)
-          {
+          case Milliseconds_HASH:
             return StandardUnit::Milliseconds;
-          }
-          else if (hashCode == Bytes_HASH)
-          {
+          case Bytes_HASH:
             return StandardUnit::Bytes;
-          }
-          else if (hashCode == Kilobytes_HASH)
-          {
+          case Kilobytes_HASH:
             return StandardUnit::Kilobytes;
-          }
-          else if (hashCode == Megabytes_HASH)
-          {
+          case Megabytes_HASH:
             return StandardUnit::Megabytes;
-          }
-          else if (hashCode == Gigabytes_HASH)
-          {
+          case Gigabytes_HASH:
             return StandardUnit::Gigabytes;
-          }
-          else if (hashCode == Terabytes_HASH)
-          {
+          case Terabytes_HASH:
             return StandardUnit::Terabytes;
-          }
-          else if (hashCode == Bits_HASH)
-          {
+          case Bits_HASH:
             return StandardUnit::Bits;
-          }
-          else if (hashCode == Kilobits_HASH)
-          {
+          case Kilobits_HASH:
             return StandardUnit::Kilobits;
-          }
-          else if (hashCode == Megabits_HASH)
-          {
+          case Megabits_HASH:
             return StandardUnit::Megabits;
-          }
-          else if (hashCode == Gigabits_HASH)
-          {
+          case Gigabits_HASH:
             return StandardUnit::Gigabits;
-          }
-          else if (hashCode == Terabits_HASH)
-          {
+          case Terabits_HASH:
             return StandardUnit::Terabits;
-          }
-          else if (hashCode == Percent_HASH)
-          {
+          case Percent_HASH:
             return StandardUnit::Percent;
-          }
-          else if (hashCode == Count_HASH)
-          {
+          case Count_HASH:
             return StandardUnit::Count;
-          }
-          else if (hashCode == Bytes_Second_HASH)
-          {
+          case Bytes_Second_HASH:
             return StandardUnit::Bytes_Second;
-          }
-          else if (hashCode == Kilobytes_Second_HASH)
-          {
+          case Kilobytes_Second_HASH:
             return StandardUnit::Kilobytes_Second;
-          }
-          else if (hashCode == Megabytes_Second_HASH)
-          {
+          case Megabytes_Second_HASH:
             return StandardUnit::Megabytes_Second;
-          }
-          else if (hashCode == Gigabytes_Second_HASH)
-          {
+          case Gigabytes_Second_HASH:
             return StandardUnit::Gigabytes_Second;
-          }
-          else if (hashCode == Terabytes_Second_HASH)
-          {
+          case Terabytes_Second_HASH:
             return StandardUnit::Terabytes_Second;
-          }
-          else if (hashCode == Bits_Second_HASH)
-          {
+          case Bits_Second_HASH:
             return StandardUnit::Bits_Second;
-          }
-          else if (hashCode == Kilobits_Second_HASH)
-          {
+          case Kilobits_Second_HASH:
             return StandardUnit::Kilobits_Second;
-          }
-          else if (hashCode == Megabits_Second_HASH)
-          {
+          case Megabits_Second_HASH:
             return StandardUnit::Megabits_Second;
-          }
-          else if (hashCode == Gigabits_Second_HASH)
-          {
+          case Gigabits_Second_HASH:
             return StandardUnit::Gigabits_Second;
-          }
-          else if (hashCode == Terabits_Second_HASH)
-          {
+          case Terabits_Second_HASH:
             return StandardUnit::Terabits_Second;
-          }
-          else if (hashCode == Count_Second_HASH)
-          {
+          case Count_Second_HASH:
             return StandardUnit::Count_Second;
-          }
-          else if (hashCode == None_HASH)
-          {
+          case None_HASH:
             return StandardUnit::None;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace StateValueMapper
       {
 
-        static const int OK_HASH = HashingUtils::HashString("OK");
-        static const int ALARM_HASH = HashingUtils::HashString("ALARM");
-        static const int INSUFFICIENT_DATA_HASH = HashingUtils::HashString("INSUFFICIENT_DATA");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int OK_HASH = 2524;
+        static const int ALARM_HASH = 62358065;
+        static const int INSUFFICIENT_DATA_HASH = -1936956826;
 
 
         StateValue GetStateValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OK_HASH)
+          switch (hashCode)
           {
+          case OK_HASH:
             return StateValue::OK;
-          }
-          else if (hashCode == ALARM_HASH)
-          {
+          case ALARM_HASH:
             return StateValue::ALARM;
-          }
-          else if (hashCode == INSUFFICIENT_DATA_HASH)
-          {
+          case INSUFFICIENT_DATA_HASH:
             return StateValue::INSUFFICIENT_DATA;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,36 +29,38 @@ namespace Aws
       namespace StatisticMapper
       {
 
-        static const int SampleCount_HASH = HashingUtils::HashString("SampleCount");
-        static const int Average_HASH = HashingUtils::HashString("Average");
-        static const int Sum_HASH = HashingUtils::HashString("Sum");
-        static const int Minimum_HASH = HashingUtils::HashString("Minimum");
-        static const int Maximum_HASH = HashingUtils::HashString("Maximum");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int SampleCount_HASH = 1795132773;
+        static const int Average_HASH = 1033205245;
+        static const int Sum_HASH = 83499;
+        static const int Minimum_HASH = -1565775890;
+        static const int Maximum_HASH = -1785573888;
 
 
         Statistic GetStatisticForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SampleCount_HASH)
+          switch (hashCode)
           {
+          case SampleCount_HASH:
             return Statistic::SampleCount;
-          }
-          else if (hashCode == Average_HASH)
-          {
+          case Average_HASH:
             return Statistic::Average;
-          }
-          else if (hashCode == Sum_HASH)
-          {
+          case Sum_HASH:
             return Statistic::Sum;
-          }
-          else if (hashCode == Minimum_HASH)
-          {
+          case Minimum_HASH:
             return Statistic::Minimum;
-          }
-          else if (hashCode == Maximum_HASH)
-          {
+          case Maximum_HASH:
             return Statistic::Maximum;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
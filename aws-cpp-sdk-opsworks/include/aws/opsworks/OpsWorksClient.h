@@ -56,6 +56,9 @@
 #include <aws/opsworks/model/RegisterVolumeResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -507,6 +510,18 @@ namespace Model
          */
         virtual void AssignInstanceAsync(const Model::AssignInstanceRequest& request, const AssignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssignInstanceCallable(const Model::AssignInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AssignInstanceOutcomeCallable AssignInstanceCallable(Model::AssignInstanceRequest&& request) const;
+
+        /**
+         * Same as AssignInstanceAsync(const Model::AssignInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AssignInstanceAsync(Model::AssignInstanceRequest&& request, const AssignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Assigns one of the stack's registered Amazon EBS volumes to a specified
          * instance. The volume must first be registered with the stack by calling
@@ -559,6 +574,18 @@ namespace Model
          */
         virtual void AssignVolumeAsync(const Model::AssignVolumeRequest& request, const AssignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssignVolumeCallable(const Model::AssignVolumeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AssignVolumeOutcomeCallable AssignVolumeCallable(Model::AssignVolumeRequest&& request) const;
+
+        /**
+         * Same as AssignVolumeAsync(const Model::AssignVolumeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AssignVolumeAsync(Model::AssignVolumeRequest&& request, const AssignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates one of the stack's registered Elastic IP addresses with a
          * specified instance. The address must first be registered with the stack by
@@ -605,6 +632,18 @@ namespace Model
          */
         virtual void AssociateElasticIpAsync(const Model::AssociateElasticIpRequest& request, const AssociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssociateElasticIpCallable(const Model::AssociateElasticIpRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AssociateElasticIpOutcomeCallable AssociateElasticIpCallable(Model::AssociateElasticIpRequest&& request) const;
+
+        /**
+         * Same as AssociateElasticIpAsync(const Model::AssociateElasticIpRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AssociateElasticIpAsync(Model::AssociateElasticIpRequest&& request, const AssociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches an Elastic Load Balancing load balancer to a specified layer. For
          * more information, see <a
@@ -660,6 +699,18 @@ namespace Model
          */
         virtual void AttachElasticLoadBalancerAsync(const Model::AttachElasticLoadBalancerRequest& request, const AttachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachElasticLoadBalancerCallable(const Model::AttachElasticLoadBalancerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AttachElasticLoadBalancerOutcomeCallable AttachElasticLoadBalancerCallable(Model::AttachElasticLoadBalancerRequest&& request) const;
+
+        /**
+         * Same as AttachElasticLoadBalancerAsync(const Model::AttachElasticLoadBalancerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AttachElasticLoadBalancerAsync(Model::AttachElasticLoadBalancerRequest&& request, const AttachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a clone of a specified stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingstacks-cloning.html">Clone
@@ -700,6 +751,18 @@ namespace Model
          */
         virtual void CloneStackAsync(const Model::CloneStackRequest& request, const CloneStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CloneStackCallable(const Model::CloneStackRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CloneStackOutcomeCallable CloneStackCallable(Model::CloneStackRequest&& request) const;
+
+        /**
+         * Same as CloneStackAsync(const Model::CloneStackRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CloneStackAsync(Model::CloneStackRequest&& request, const CloneStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an app for a specified stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingapps-creating.html">Creating
@@ -737,6 +800,18 @@ namespace Model
          */
         virtual void CreateAppAsync(const Model::CreateAppRequest& request, const CreateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAppCallable(const Model::CreateAppRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateAppOutcomeCallable CreateAppCallable(Model::CreateAppRequest&& request) const;
+
+        /**
+         * Same as CreateAppAsync(const Model::CreateAppRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateAppAsync(Model::CreateAppRequest&& request, const CreateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Runs deployment or stack commands. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingapps-deploying.html">Deploying
@@ -783,6 +858,18 @@ namespace Model
          */
         virtual void CreateDeploymentAsync(const Model::CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDeploymentCallable(const Model::CreateDeploymentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDeploymentOutcomeCallable CreateDeploymentCallable(Model::CreateDeploymentRequest&& request) const;
+
+        /**
+         * Same as CreateDeploymentAsync(const Model::CreateDeploymentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDeploymentAsync(Model::CreateDeploymentRequest&& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an instance in a specified stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-add.html">Adding
@@ -823,6 +910,18 @@ namespace Model
          */
         virtual void CreateInstanceAsync(const Model::CreateInstanceRequest& request, const CreateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateInstanceCallable(const Model::CreateInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateInstanceOutcomeCallable CreateInstanceCallable(Model::CreateInstanceRequest&& request) const;
+
+        /**
+         * Same as CreateInstanceAsync(const Model::CreateInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateInstanceAsync(Model::CreateInstanceRequest&& request, const CreateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a layer. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinglayers-basics-create.html">How
@@ -878,6 +977,18 @@ namespace Model
          */
         virtual void CreateLayerAsync(const Model::CreateLayerRequest& request, const CreateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLayerCallable(const Model::CreateLayerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateLayerOutcomeCallable CreateLayerCallable(Model::CreateLayerRequest&& request) const;
+
+        /**
+         * Same as CreateLayerAsync(const Model::CreateLayerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateLayerAsync(Model::CreateLayerRequest&& request, const CreateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingstacks-edit.html">Create
@@ -915,6 +1026,18 @@ namespace Model
          */
         virtual void CreateStackAsync(const Model::CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateStackCallable(const Model::CreateStackRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateStackOutcomeCallable CreateStackCallable(Model::CreateStackRequest&& request) const;
+
+        /**
+         * Same as CreateStackAsync(const Model::CreateStackRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateStackAsync(Model::CreateStackRequest&& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new user profile.</p> <p> <b>Required Permissions</b>: To use this
          * action, an IAM user must have an attached policy that explicitly grants
@@ -946,6 +1069,18 @@ namespace Model
          */
         virtual void CreateUserProfileAsync(const Model::CreateUserProfileRequest& request, const CreateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateUserProfileCallable(const Model::CreateUserProfileRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateUserProfileOutcomeCallable CreateUserProfileCallable(Model::CreateUserProfileRequest&& request) const;
+
+        /**
+         * Same as CreateUserProfileAsync(const Model::CreateUserProfileRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateUserProfileAsync(Model::CreateUserProfileRequest&& request, const CreateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a specified app.</p> <p> <b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -980,6 +1115,18 @@ namespace Model
          */
         virtual void DeleteAppAsync(const Model::DeleteAppRequest& request, const DeleteAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAppCallable(const Model::DeleteAppRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteAppOutcomeCallable DeleteAppCallable(Model::DeleteAppRequest&& request) const;
+
+        /**
+         * Same as DeleteAppAsync(const Model::DeleteAppRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteAppAsync(Model::DeleteAppRequest&& request, const DeleteAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a specified instance, which terminates the associated Amazon EC2
          * instance. You must stop an instance before you can delete it.</p> <p>For more
@@ -1026,6 +1173,18 @@ namespace Model
          */
         virtual void DeleteInstanceAsync(const Model::DeleteInstanceRequest& request, const DeleteInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteInstanceCallable(const Model::DeleteInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteInstanceOutcomeCallable DeleteInstanceCallable(Model::DeleteInstanceRequest&& request) const;
+
+        /**
+         * Same as DeleteInstanceAsync(const Model::DeleteInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteInstanceAsync(Model::DeleteInstanceRequest&& request, const DeleteInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a specified layer. You must first stop and then delete all associated
          * instances or unassign registered instances. For more information, see <a
@@ -1069,6 +1228,18 @@ namespace Model
          */
         virtual void DeleteLayerAsync(const Model::DeleteLayerRequest& request, const DeleteLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLayerCallable(const Model::DeleteLayerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteLayerOutcomeCallable DeleteLayerCallable(Model::DeleteLayerRequest&& request) const;
+
+        /**
+         * Same as DeleteLayerAsync(const Model::DeleteLayerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteLayerAsync(Model::DeleteLayerRequest&& request, const DeleteLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a specified stack. You must first delete all instances, layers, and
          * apps or deregister registered instances. For more information, see <a
@@ -1112,6 +1283,18 @@ namespace Model
          */
         virtual void DeleteStackAsync(const Model::DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteStackCallable(const Model::DeleteStackRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteStackOutcomeCallable DeleteStackCallable(Model::DeleteStackRequest&& request) const;
+
+        /**
+         * Same as DeleteStackAsync(const Model::DeleteStackRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteStackAsync(Model::DeleteStackRequest&& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a user profile.</p> <p> <b>Required Permissions</b>: To use this
          * action, an IAM user must have an attached policy that explicitly grants
@@ -1143,6 +1326,18 @@ namespace Model
          */
         virtual void DeleteUserProfileAsync(const Model::DeleteUserProfileRequest& request, const DeleteUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteUserProfileCallable(const Model::DeleteUserProfileRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteUserProfileOutcomeCallable DeleteUserProfileCallable(Model::DeleteUserProfileRequest&& request) const;
+
+        /**
+         * Same as DeleteUserProfileAsync(const Model::DeleteUserProfileRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteUserProfileAsync(Model::DeleteUserProfileRequest&& request, const DeleteUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters a specified Amazon ECS cluster from a stack. For more
          * information, see <a
@@ -1183,6 +1378,18 @@ namespace Model
          */
         virtual void DeregisterEcsClusterAsync(const Model::DeregisterEcsClusterRequest& request, const DeregisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterEcsClusterCallable(const Model::DeregisterEcsClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeregisterEcsClusterOutcomeCallable DeregisterEcsClusterCallable(Model::DeregisterEcsClusterRequest&& request) const;
+
+        /**
+         * Same as DeregisterEcsClusterAsync(const Model::DeregisterEcsClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeregisterEcsClusterAsync(Model::DeregisterEcsClusterRequest&& request, const DeregisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters a specified Elastic IP address. The address can then be
          * registered by another stack. For more information, see <a
@@ -1226,6 +1433,18 @@ namespace Model
          */
         virtual void DeregisterElasticIpAsync(const Model::DeregisterElasticIpRequest& request, const DeregisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterElasticIpCallable(const Model::DeregisterElasticIpRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeregisterElasticIpOutcomeCallable DeregisterElasticIpCallable(Model::DeregisterElasticIpRequest&& request) const;
+
+        /**
+         * Same as DeregisterElasticIpAsync(const Model::DeregisterElasticIpRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeregisterElasticIpAsync(Model::DeregisterElasticIpRequest&& request, const DeregisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregister a registered Amazon EC2 or on-premises instance. This action
          * removes the instance from the stack and returns it to your control. This action
@@ -1266,6 +1485,18 @@ namespace Model
          */
         virtual void DeregisterInstanceAsync(const Model::DeregisterInstanceRequest& request, const DeregisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterInstanceCallable(const Model::DeregisterInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeregisterInstanceOutcomeCallable DeregisterInstanceCallable(Model::DeregisterInstanceRequest&& request) const;
+
+        /**
+         * Same as DeregisterInstanceAsync(const Model::DeregisterInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeregisterInstanceAsync(Model::DeregisterInstanceRequest&& request, const DeregisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters an Amazon RDS instance.</p> <p> <b>Required Permissions</b>: To
          * use this action, an IAM user must have a Manage permissions level for the stack,
@@ -1300,6 +1531,18 @@ namespace Model
          */
         virtual void DeregisterRdsDbInstanceAsync(const Model::DeregisterRdsDbInstanceRequest& request, const DeregisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterRdsDbInstanceCallable(const Model::DeregisterRdsDbInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeregisterRdsDbInstanceOutcomeCallable DeregisterRdsDbInstanceCallable(Model::DeregisterRdsDbInstanceRequest&& request) const;
+
+        /**
+         * Same as DeregisterRdsDbInstanceAsync(const Model::DeregisterRdsDbInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeregisterRdsDbInstanceAsync(Model::DeregisterRdsDbInstanceRequest&& request, const DeregisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters an Amazon EBS volume. The volume can then be registered by
          * another stack. For more information, see <a
@@ -1343,6 +1586,18 @@ namespace Model
          */
         virtual void DeregisterVolumeAsync(const Model::DeregisterVolumeRequest& request, const DeregisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterVolumeCallable(const Model::DeregisterVolumeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeregisterVolumeOutcomeCallable DeregisterVolumeCallable(Model::DeregisterVolumeRequest&& request) const;
+
+        /**
+         * Same as DeregisterVolumeAsync(const Model::DeregisterVolumeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeregisterVolumeAsync(Model::DeregisterVolumeRequest&& request, const DeregisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the available AWS OpsWorks agent versions. You must specify a stack
          * ID or a configuration manager. <code>DescribeAgentVersions</code> returns a list
@@ -1371,6 +1626,18 @@ namespace Model
          */
         virtual void DescribeAgentVersionsAsync(const Model::DescribeAgentVersionsRequest& request, const DescribeAgentVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAgentVersionsCallable(const Model::DescribeAgentVersionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAgentVersionsOutcomeCallable DescribeAgentVersionsCallable(Model::DescribeAgentVersionsRequest&& request) const;
+
+        /**
+         * Same as DescribeAgentVersionsAsync(const Model::DescribeAgentVersionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAgentVersionsAsync(Model::DescribeAgentVersionsRequest&& request, const DescribeAgentVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a description of a specified set of apps.</p> <note> <p>You must
          * specify at least one of the parameters.</p> </note> <p> <b>Required
@@ -1408,6 +1675,18 @@ namespace Model
          */
         virtual void DescribeAppsAsync(const Model::DescribeAppsRequest& request, const DescribeAppsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAppsCallable(const Model::DescribeAppsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAppsOutcomeCallable DescribeAppsCallable(Model::DescribeAppsRequest&& request) const;
+
+        /**
+         * Same as DescribeAppsAsync(const Model::DescribeAppsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAppsAsync(Model::DescribeAppsRequest&& request, const DescribeAppsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the results of specified commands.</p> <note> <p>You must specify
          * at least one of the parameters.</p> </note> <p> <b>Required Permissions</b>: To
@@ -1445,6 +1724,18 @@ namespace Model
          */
         virtual void DescribeCommandsAsync(const Model::DescribeCommandsRequest& request, const DescribeCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCommandsCallable(const Model::DescribeCommandsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCommandsOutcomeCallable DescribeCommandsCallable(Model::DescribeCommandsRequest&& request) const;
+
+        /**
+         * Same as DescribeCommandsAsync(const Model::DescribeCommandsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCommandsAsync(Model::DescribeCommandsRequest&& request, const DescribeCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a description of a specified set of deployments.</p> <note> <p>You
          * must specify at least one of the parameters.</p> </note> <p> <b>Required
@@ -1482,6 +1773,18 @@ namespace Model
          */
         virtual void DescribeDeploymentsAsync(const Model::DescribeDeploymentsRequest& request, const DescribeDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDeploymentsCallable(const Model::DescribeDeploymentsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDeploymentsOutcomeCallable DescribeDeploymentsCallable(Model::DescribeDeploymentsRequest&& request) const;
+
+        /**
+         * Same as DescribeDeploymentsAsync(const Model::DescribeDeploymentsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDeploymentsAsync(Model::DescribeDeploymentsRequest&& request, const DescribeDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes Amazon ECS clusters that are registered with a stack. If you
          * specify only a stack ID, you can use the <code>MaxResults</code> and
@@ -1528,6 +1831,18 @@ namespace Model
          */
         virtual void DescribeEcsClustersAsync(const Model::DescribeEcsClustersRequest& request, const DescribeEcsClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEcsClustersCallable(const Model::DescribeEcsClustersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEcsClustersOutcomeCallable DescribeEcsClustersCallable(Model::DescribeEcsClustersRequest&& request) const;
+
+        /**
+         * Same as DescribeEcsClustersAsync(const Model::DescribeEcsClustersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEcsClustersAsync(Model::DescribeEcsClustersRequest&& request, const DescribeEcsClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes <a
          * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/elastic-ip-addresses-eip.html">Elastic
@@ -1571,6 +1886,18 @@ namespace Model
          */
         virtual void DescribeElasticIpsAsync(const Model::DescribeElasticIpsRequest& request, const DescribeElasticIpsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeElasticIpsCallable(const Model::DescribeElasticIpsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeElasticIpsOutcomeCallable DescribeElasticIpsCallable(Model::DescribeElasticIpsRequest&& request) const;
+
+        /**
+         * Same as DescribeElasticIpsAsync(const Model::DescribeElasticIpsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeElasticIpsAsync(Model::DescribeElasticIpsRequest&& request, const DescribeElasticIpsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes a stack's Elastic Load Balancing instances.</p> <note> <p>You must
          * specify at least one of the parameters.</p> </note> <p> <b>Required
@@ -1608,6 +1935,18 @@ namespace Model
          */
         virtual void DescribeElasticLoadBalancersAsync(const Model::DescribeElasticLoadBalancersRequest& request, const DescribeElasticLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeElasticLoadBalancersCallable(const Model::DescribeElasticLoadBalancersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeElasticLoadBalancersOutcomeCallable DescribeElasticLoadBalancersCallable(Model::DescribeElasticLoadBalancersRequest&& request) const;
+
+        /**
+         * Same as DescribeElasticLoadBalancersAsync(const Model::DescribeElasticLoadBalancersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeElasticLoadBalancersAsync(Model::DescribeElasticLoadBalancersRequest&& request, const DescribeElasticLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a description of a set of instances.</p> <note> <p>You must specify
          * at least one of the parameters.</p> </note> <p> <b>Required Permissions</b>: To
@@ -1645,6 +1984,18 @@ namespace Model
          */
         virtual void DescribeInstancesAsync(const Model::DescribeInstancesRequest& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInstancesCallable(const Model::DescribeInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeInstancesOutcomeCallable DescribeInstancesCallable(Model::DescribeInstancesRequest&& request) const;
+
+        /**
+         * Same as DescribeInstancesAsync(const Model::DescribeInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeInstancesAsync(Model::DescribeInstancesRequest&& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a description of one or more layers in a specified stack.</p> <note>
          * <p>You must specify at least one of the parameters.</p> </note> <p> <b>Required
@@ -1682,6 +2033,18 @@ namespace Model
          */
         virtual void DescribeLayersAsync(const Model::DescribeLayersRequest& request, const DescribeLayersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLayersCallable(const Model::DescribeLayersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLayersOutcomeCallable DescribeLayersCallable(Model::DescribeLayersRequest&& request) const;
+
+        /**
+         * Same as DescribeLayersAsync(const Model::DescribeLayersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLayersAsync(Model::DescribeLayersRequest&& request, const DescribeLayersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes load-based auto scaling configurations for specified layers.</p>
          * <note> <p>You must specify at least one of the parameters.</p> </note> <p>
@@ -1719,6 +2082,18 @@ namespace Model
          */
         virtual void DescribeLoadBasedAutoScalingAsync(const Model::DescribeLoadBasedAutoScalingRequest& request, const DescribeLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoadBasedAutoScalingCallable(const Model::DescribeLoadBasedAutoScalingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLoadBasedAutoScalingOutcomeCallable DescribeLoadBasedAutoScalingCallable(Model::DescribeLoadBasedAutoScalingRequest&& request) const;
+
+        /**
+         * Same as DescribeLoadBasedAutoScalingAsync(const Model::DescribeLoadBasedAutoScalingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLoadBasedAutoScalingAsync(Model::DescribeLoadBasedAutoScalingRequest&& request, const DescribeLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes a user's SSH information.</p> <p> <b>Required Permissions</b>: To
          * use this action, an IAM user must have self-management enabled or an attached
@@ -1786,6 +2161,18 @@ namespace Model
          */
         virtual void DescribePermissionsAsync(const Model::DescribePermissionsRequest& request, const DescribePermissionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribePermissionsCallable(const Model::DescribePermissionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribePermissionsOutcomeCallable DescribePermissionsCallable(Model::DescribePermissionsRequest&& request) const;
+
+        /**
+         * Same as DescribePermissionsAsync(const Model::DescribePermissionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribePermissionsAsync(Model::DescribePermissionsRequest&& request, const DescribePermissionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describe an instance's RAID arrays.</p> <note> <p>You must specify at least
          * one of the parameters.</p> </note> <p> <b>Required Permissions</b>: To use this
@@ -1823,6 +2210,18 @@ namespace Model
          */
         virtual void DescribeRaidArraysAsync(const Model::DescribeRaidArraysRequest& request, const DescribeRaidArraysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRaidArraysCallable(const Model::DescribeRaidArraysRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeRaidArraysOutcomeCallable DescribeRaidArraysCallable(Model::DescribeRaidArraysRequest&& request) const;
+
+        /**
+         * Same as DescribeRaidArraysAsync(const Model::DescribeRaidArraysRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeRaidArraysAsync(Model::DescribeRaidArraysRequest&& request, const DescribeRaidArraysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes Amazon RDS instances.</p> <p> <b>Required Permissions</b>: To use
          * this action, an IAM user must have a Show, Deploy, or Manage permissions level
@@ -1857,6 +2256,18 @@ namespace Model
          */
         virtual void DescribeRdsDbInstancesAsync(const Model::DescribeRdsDbInstancesRequest& request, const DescribeRdsDbInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRdsDbInstancesCallable(const Model::DescribeRdsDbInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeRdsDbInstancesOutcomeCallable DescribeRdsDbInstancesCallable(Model::DescribeRdsDbInstancesRequest&& request) const;
+
+        /**
+         * Same as DescribeRdsDbInstancesAsync(const Model::DescribeRdsDbInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeRdsDbInstancesAsync(Model::DescribeRdsDbInstancesRequest&& request, const DescribeRdsDbInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes AWS OpsWorks service errors.</p> <p> <b>Required Permissions</b>:
          * To use this action, an IAM user must have a Show, Deploy, or Manage permissions
@@ -1891,6 +2302,18 @@ namespace Model
          */
         virtual void DescribeServiceErrorsAsync(const Model::DescribeServiceErrorsRequest& request, const DescribeServiceErrorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeServiceErrorsCallable(const Model::DescribeServiceErrorsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeServiceErrorsOutcomeCallable DescribeServiceErrorsCallable(Model::DescribeServiceErrorsRequest&& request) const;
+
+        /**
+         * Same as DescribeServiceErrorsAsync(const Model::DescribeServiceErrorsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeServiceErrorsAsync(Model::DescribeServiceErrorsRequest&& request, const DescribeServiceErrorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a description of a stack's provisioning parameters.</p> <p>
          * <b>Required Permissions</b>: To use this action, an IAM user must have a Show,
@@ -1925,6 +2348,18 @@ namespace Model
          */
         virtual void DescribeStackProvisioningParametersAsync(const Model::DescribeStackProvisioningParametersRequest& request, const DescribeStackProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStackProvisioningParametersCallable(const Model::DescribeStackProvisioningParametersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeStackProvisioningParametersOutcomeCallable DescribeStackProvisioningParametersCallable(Model::DescribeStackProvisioningParametersRequest&& request) const;
+
+        /**
+         * Same as DescribeStackProvisioningParametersAsync(const Model::DescribeStackProvisioningParametersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeStackProvisioningParametersAsync(Model::DescribeStackProvisioningParametersRequest&& request, const DescribeStackProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the number of layers and apps in a specified stack, and the number
          * of instances in each state, such as <code>running_setup</code> or
@@ -1965,6 +2400,18 @@ namespace Model
          */
         virtual void DescribeStackSummaryAsync(const Model::DescribeStackSummaryRequest& request, const DescribeStackSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStackSummaryCallable(const Model::DescribeStackSummaryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeStackSummaryOutcomeCallable DescribeStackSummaryCallable(Model::DescribeStackSummaryRequest&& request) const;
+
+        /**
+         * Same as DescribeStackSummaryAsync(const Model::DescribeStackSummaryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeStackSummaryAsync(Model::DescribeStackSummaryRequest&& request, const DescribeStackSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a description of one or more stacks.</p> <p> <b>Required
          * Permissions</b>: To use this action, an IAM user must have a Show, Deploy, or
@@ -1999,6 +2446,18 @@ namespace Model
          */
         virtual void DescribeStacksAsync(const Model::DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStacksCallable(const Model::DescribeStacksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeStacksOutcomeCallable DescribeStacksCallable(Model::DescribeStacksRequest&& request) const;
+
+        /**
+         * Same as DescribeStacksAsync(const Model::DescribeStacksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeStacksAsync(Model::DescribeStacksRequest&& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes time-based auto scaling configurations for specified instances.</p>
          * <note> <p>You must specify at least one of the parameters.</p> </note> <p>
@@ -2036,6 +2495,18 @@ namespace Model
          */
         virtual void DescribeTimeBasedAutoScalingAsync(const Model::DescribeTimeBasedAutoScalingRequest& request, const DescribeTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTimeBasedAutoScalingCallable(const Model::DescribeTimeBasedAutoScalingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTimeBasedAutoScalingOutcomeCallable DescribeTimeBasedAutoScalingCallable(Model::DescribeTimeBasedAutoScalingRequest&& request) const;
+
+        /**
+         * Same as DescribeTimeBasedAutoScalingAsync(const Model::DescribeTimeBasedAutoScalingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTimeBasedAutoScalingAsync(Model::DescribeTimeBasedAutoScalingRequest&& request, const DescribeTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describe specified users.</p> <p> <b>Required Permissions</b>: To use this
          * action, an IAM user must have an attached policy that explicitly grants
@@ -2067,6 +2538,18 @@ namespace Model
          */
         virtual void DescribeUserProfilesAsync(const Model::DescribeUserProfilesRequest& request, const DescribeUserProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeUserProfilesCallable(const Model::DescribeUserProfilesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeUserProfilesOutcomeCallable DescribeUserProfilesCallable(Model::DescribeUserProfilesRequest&& request) const;
+
+        /**
+         * Same as DescribeUserProfilesAsync(const Model::DescribeUserProfilesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeUserProfilesAsync(Model::DescribeUserProfilesRequest&& request, const DescribeUserProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes an instance's Amazon EBS volumes.</p> <note> <p>You must specify at
          * least one of the parameters.</p> </note> <p> <b>Required Permissions</b>: To use
@@ -2104,6 +2587,18 @@ namespace Model
          */
         virtual void DescribeVolumesAsync(const Model::DescribeVolumesRequest& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVolumesCallable(const Model::DescribeVolumesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVolumesOutcomeCallable DescribeVolumesCallable(Model::DescribeVolumesRequest&& request) const;
+
+        /**
+         * Same as DescribeVolumesAsync(const Model::DescribeVolumesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVolumesAsync(Model::DescribeVolumesRequest&& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches a specified Elastic Load Balancing instance from its layer.</p> <p>
          * <b>Required Permissions</b>: To use this action, an IAM user must have a Manage
@@ -2138,6 +2633,18 @@ namespace Model
          */
         virtual void DetachElasticLoadBalancerAsync(const Model::DetachElasticLoadBalancerRequest& request, const DetachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachElasticLoadBalancerCallable(const Model::DetachElasticLoadBalancerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DetachElasticLoadBalancerOutcomeCallable DetachElasticLoadBalancerCallable(Model::DetachElasticLoadBalancerRequest&& request) const;
+
+        /**
+         * Same as DetachElasticLoadBalancerAsync(const Model::DetachElasticLoadBalancerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DetachElasticLoadBalancerAsync(Model::DetachElasticLoadBalancerRequest&& request, const DetachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disassociates an Elastic IP address from its instance. The address remains
          * registered with the stack. For more information, see <a
@@ -2182,10 +2689,22 @@ namespace Model
         virtual void DisassociateElasticIpAsync(const Model::DisassociateElasticIpRequest& request, const DisassociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
         /**
-         * <p>Gets a generated host name for the specified layer, based on the current host
-         * name theme.</p> <p> <b>Required Permissions</b>: To use this action, an IAM user
-         * must have a Manage permissions level for the stack, or an attached policy that
-         * explicitly grants permissions. For more information on user permissions, see <a
+         * Same as DisassociateElasticIpCallable(const Model::DisassociateElasticIpRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisassociateElasticIpOutcomeCallable DisassociateElasticIpCallable(Model::DisassociateElasticIpRequest&& request) const;
+
+        /**
+         * Same as DisassociateElasticIpAsync(const Model::DisassociateElasticIpRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisassociateElasticIpAsync(Model::DisassociateElasticIpRequest&& request, const DisassociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+        /**
+         * <p>Gets a generated host name for the specified layer, based on the current host
+         * name theme.</p> <p> <b>Required Permissions</b>: To use this action, an IAM user
+         * must have a Manage permissions level for the stack, or an attached policy that
+         * explicitly grants permissions. For more information on user permissions, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/opsworks-security-users.html">Managing
          * User Permissions</a>.</p>
          */
@@ -2215,6 +2734,18 @@ namespace Model
          */
         virtual void GetHostnameSuggestionAsync(const Model::GetHostnameSuggestionRequest& request, const GetHostnameSuggestionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetHostnameSuggestionCallable(const Model::GetHostnameSuggestionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetHostnameSuggestionOutcomeCallable GetHostnameSuggestionCallable(Model::GetHostnameSuggestionRequest&& request) const;
+
+        /**
+         * Same as GetHostnameSuggestionAsync(const Model::GetHostnameSuggestionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetHostnameSuggestionAsync(Model::GetHostnameSuggestionRequest&& request, const GetHostnameSuggestionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <note> <p>This action can be used only with Windows stacks.</p> </note>
          * <p>Grants RDP access to a Windows instance for a specified time period.</p>
@@ -2237,6 +2768,18 @@ namespace Model
          */
         virtual void GrantAccessAsync(const Model::GrantAccessRequest& request, const GrantAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GrantAccessCallable(const Model::GrantAccessRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GrantAccessOutcomeCallable GrantAccessCallable(Model::GrantAccessRequest&& request) const;
+
+        /**
+         * Same as GrantAccessAsync(const Model::GrantAccessRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GrantAccessAsync(Model::GrantAccessRequest&& request, const GrantAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Reboots a specified instance. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-starting.html">Starting,
@@ -2277,6 +2820,18 @@ namespace Model
          */
         virtual void RebootInstanceAsync(const Model::RebootInstanceRequest& request, const RebootInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebootInstanceCallable(const Model::RebootInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RebootInstanceOutcomeCallable RebootInstanceCallable(Model::RebootInstanceRequest&& request) const;
+
+        /**
+         * Same as RebootInstanceAsync(const Model::RebootInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RebootInstanceAsync(Model::RebootInstanceRequest&& request, const RebootInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers a specified Amazon ECS cluster with a stack. You can register only
          * one cluster with a stack. A cluster can be registered with only one stack. For
@@ -2323,6 +2878,18 @@ namespace Model
          */
         virtual void RegisterEcsClusterAsync(const Model::RegisterEcsClusterRequest& request, const RegisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterEcsClusterCallable(const Model::RegisterEcsClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterEcsClusterOutcomeCallable RegisterEcsClusterCallable(Model::RegisterEcsClusterRequest&& request) const;
+
+        /**
+         * Same as RegisterEcsClusterAsync(const Model::RegisterEcsClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterEcsClusterAsync(Model::RegisterEcsClusterRequest&& request, const RegisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers an Elastic IP address with a specified stack. An address can be
          * registered with only one stack at a time. If the address is already registered,
@@ -2372,6 +2939,18 @@ namespace Model
          */
         virtual void RegisterElasticIpAsync(const Model::RegisterElasticIpRequest& request, const RegisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterElasticIpCallable(const Model::RegisterElasticIpRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterElasticIpOutcomeCallable RegisterElasticIpCallable(Model::RegisterElasticIpRequest&& request) const;
+
+        /**
+         * Same as RegisterElasticIpAsync(const Model::RegisterElasticIpRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterElasticIpAsync(Model::RegisterElasticIpRequest&& request, const RegisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers instances with a specified stack that were created outside of AWS
          * OpsWorks.</p> <note> <p>We do not recommend using this action to register
@@ -2430,6 +3009,18 @@ namespace Model
          */
         virtual void RegisterInstanceAsync(const Model::RegisterInstanceRequest& request, const RegisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterInstanceCallable(const Model::RegisterInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterInstanceOutcomeCallable RegisterInstanceCallable(Model::RegisterInstanceRequest&& request) const;
+
+        /**
+         * Same as RegisterInstanceAsync(const Model::RegisterInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterInstanceAsync(Model::RegisterInstanceRequest&& request, const RegisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers an Amazon RDS instance with a stack.</p> <p> <b>Required
          * Permissions</b>: To use this action, an IAM user must have a Manage permissions
@@ -2464,6 +3055,18 @@ namespace Model
          */
         virtual void RegisterRdsDbInstanceAsync(const Model::RegisterRdsDbInstanceRequest& request, const RegisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterRdsDbInstanceCallable(const Model::RegisterRdsDbInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterRdsDbInstanceOutcomeCallable RegisterRdsDbInstanceCallable(Model::RegisterRdsDbInstanceRequest&& request) const;
+
+        /**
+         * Same as RegisterRdsDbInstanceAsync(const Model::RegisterRdsDbInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterRdsDbInstanceAsync(Model::RegisterRdsDbInstanceRequest&& request, const RegisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers an Amazon EBS volume with a specified stack. A volume can be
          * registered with only one stack at a time. If the volume is already registered,
@@ -2513,6 +3116,18 @@ namespace Model
          */
         virtual void RegisterVolumeAsync(const Model::RegisterVolumeRequest& request, const RegisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterVolumeCallable(const Model::RegisterVolumeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterVolumeOutcomeCallable RegisterVolumeCallable(Model::RegisterVolumeRequest&& request) const;
+
+        /**
+         * Same as RegisterVolumeAsync(const Model::RegisterVolumeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterVolumeAsync(Model::RegisterVolumeRequest&& request, const RegisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Specify the load-based auto scaling configuration for a specified layer. For
          * more information, see <a
@@ -2568,6 +3183,18 @@ namespace Model
          */
         virtual void SetLoadBasedAutoScalingAsync(const Model::SetLoadBasedAutoScalingRequest& request, const SetLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetLoadBasedAutoScalingCallable(const Model::SetLoadBasedAutoScalingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetLoadBasedAutoScalingOutcomeCallable SetLoadBasedAutoScalingCallable(Model::SetLoadBasedAutoScalingRequest&& request) const;
+
+        /**
+         * Same as SetLoadBasedAutoScalingAsync(const Model::SetLoadBasedAutoScalingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetLoadBasedAutoScalingAsync(Model::SetLoadBasedAutoScalingRequest&& request, const SetLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Specifies a user's permissions. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingsecurity.html">Security
@@ -2608,6 +3235,18 @@ namespace Model
          */
         virtual void SetPermissionAsync(const Model::SetPermissionRequest& request, const SetPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetPermissionCallable(const Model::SetPermissionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetPermissionOutcomeCallable SetPermissionCallable(Model::SetPermissionRequest&& request) const;
+
+        /**
+         * Same as SetPermissionAsync(const Model::SetPermissionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetPermissionAsync(Model::SetPermissionRequest&& request, const SetPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Specify the time-based auto scaling configuration for a specified instance.
          * For more information, see <a
@@ -2651,6 +3290,18 @@ namespace Model
          */
         virtual void SetTimeBasedAutoScalingAsync(const Model::SetTimeBasedAutoScalingRequest& request, const SetTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetTimeBasedAutoScalingCallable(const Model::SetTimeBasedAutoScalingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetTimeBasedAutoScalingOutcomeCallable SetTimeBasedAutoScalingCallable(Model::SetTimeBasedAutoScalingRequest&& request) const;
+
+        /**
+         * Same as SetTimeBasedAutoScalingAsync(const Model::SetTimeBasedAutoScalingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetTimeBasedAutoScalingAsync(Model::SetTimeBasedAutoScalingRequest&& request, const SetTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts a specified instance. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-starting.html">Starting,
@@ -2691,6 +3342,18 @@ namespace Model
          */
         virtual void StartInstanceAsync(const Model::StartInstanceRequest& request, const StartInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartInstanceCallable(const Model::StartInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StartInstanceOutcomeCallable StartInstanceCallable(Model::StartInstanceRequest&& request) const;
+
+        /**
+         * Same as StartInstanceAsync(const Model::StartInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StartInstanceAsync(Model::StartInstanceRequest&& request, const StartInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts a stack's instances.</p> <p> <b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -2725,6 +3388,18 @@ namespace Model
          */
         virtual void StartStackAsync(const Model::StartStackRequest& request, const StartStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartStackCallable(const Model::StartStackRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StartStackOutcomeCallable StartStackCallable(Model::StartStackRequest&& request) const;
+
+        /**
+         * Same as StartStackAsync(const Model::StartStackRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StartStackAsync(Model::StartStackRequest&& request, const StartStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stops a specified instance. When you stop a standard instance, the data
          * disappears and must be reinstalled when you restart the instance. You can stop
@@ -2771,6 +3446,18 @@ namespace Model
          */
         virtual void StopInstanceAsync(const Model::StopInstanceRequest& request, const StopInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopInstanceCallable(const Model::StopInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StopInstanceOutcomeCallable StopInstanceCallable(Model::StopInstanceRequest&& request) const;
+
+        /**
+         * Same as StopInstanceAsync(const Model::StopInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StopInstanceAsync(Model::StopInstanceRequest&& request, const StopInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stops a specified stack.</p> <p> <b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -2805,6 +3492,18 @@ namespace Model
          */
         virtual void StopStackAsync(const Model::StopStackRequest& request, const StopStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopStackCallable(const Model::StopStackRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StopStackOutcomeCallable StopStackCallable(Model::StopStackRequest&& request) const;
+
+        /**
+         * Same as StopStackAsync(const Model::StopStackRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StopStackAsync(Model::StopStackRequest&& request, const StopStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Unassigns a registered instance from all of it's layers. The instance remains
          * in the stack as an unassigned instance and can be assigned to another layer, as
@@ -2845,6 +3544,18 @@ namespace Model
          */
         virtual void UnassignInstanceAsync(const Model::UnassignInstanceRequest& request, const UnassignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnassignInstanceCallable(const Model::UnassignInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UnassignInstanceOutcomeCallable UnassignInstanceCallable(Model::UnassignInstanceRequest&& request) const;
+
+        /**
+         * Same as UnassignInstanceAsync(const Model::UnassignInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UnassignInstanceAsync(Model::UnassignInstanceRequest&& request, const UnassignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Unassigns an assigned Amazon EBS volume. The volume remains registered with
          * the stack. For more information, see <a
@@ -2888,6 +3599,18 @@ namespace Model
          */
         virtual void UnassignVolumeAsync(const Model::UnassignVolumeRequest& request, const UnassignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnassignVolumeCallable(const Model::UnassignVolumeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UnassignVolumeOutcomeCallable UnassignVolumeCallable(Model::UnassignVolumeRequest&& request) const;
+
+        /**
+         * Same as UnassignVolumeAsync(const Model::UnassignVolumeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UnassignVolumeAsync(Model::UnassignVolumeRequest&& request, const UnassignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a specified app.</p> <p> <b>Required Permissions</b>: To use this
          * action, an IAM user must have a Deploy or Manage permissions level for the
@@ -2922,6 +3645,18 @@ namespace Model
          */
         virtual void UpdateAppAsync(const Model::UpdateAppRequest& request, const UpdateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAppCallable(const Model::UpdateAppRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateAppOutcomeCallable UpdateAppCallable(Model::UpdateAppRequest&& request) const;
+
+        /**
+         * Same as UpdateAppAsync(const Model::UpdateAppRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateAppAsync(Model::UpdateAppRequest&& request, const UpdateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a registered Elastic IP address's name. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/resources.html">Resource
@@ -2962,6 +3697,18 @@ namespace Model
          */
         virtual void UpdateElasticIpAsync(const Model::UpdateElasticIpRequest& request, const UpdateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateElasticIpCallable(const Model::UpdateElasticIpRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateElasticIpOutcomeCallable UpdateElasticIpCallable(Model::UpdateElasticIpRequest&& request) const;
+
+        /**
+         * Same as UpdateElasticIpAsync(const Model::UpdateElasticIpRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateElasticIpAsync(Model::UpdateElasticIpRequest&& request, const UpdateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a specified instance.</p> <p> <b>Required Permissions</b>: To use
          * this action, an IAM user must have a Manage permissions level for the stack, or
@@ -2996,6 +3743,18 @@ namespace Model
          */
         virtual void UpdateInstanceAsync(const Model::UpdateInstanceRequest& request, const UpdateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateInstanceCallable(const Model::UpdateInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateInstanceOutcomeCallable UpdateInstanceCallable(Model::UpdateInstanceRequest&& request) const;
+
+        /**
+         * Same as UpdateInstanceAsync(const Model::UpdateInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateInstanceAsync(Model::UpdateInstanceRequest&& request, const UpdateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a specified layer.</p> <p> <b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -3030,6 +3789,18 @@ namespace Model
          */
         virtual void UpdateLayerAsync(const Model::UpdateLayerRequest& request, const UpdateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateLayerCallable(const Model::UpdateLayerRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateLayerOutcomeCallable UpdateLayerCallable(Model::UpdateLayerRequest&& request) const;
+
+        /**
+         * Same as UpdateLayerAsync(const Model::UpdateLayerRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateLayerAsync(Model::UpdateLayerRequest&& request, const UpdateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a user's SSH public key.</p> <p> <b>Required Permissions</b>: To use
          * this action, an IAM user must have self-management enabled or an attached policy
@@ -3064,6 +3835,18 @@ namespace Model
          */
         virtual void UpdateMyUserProfileAsync(const Model::UpdateMyUserProfileRequest& request, const UpdateMyUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateMyUserProfileCallable(const Model::UpdateMyUserProfileRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateMyUserProfileOutcomeCallable UpdateMyUserProfileCallable(Model::UpdateMyUserProfileRequest&& request) const;
+
+        /**
+         * Same as UpdateMyUserProfileAsync(const Model::UpdateMyUserProfileRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateMyUserProfileAsync(Model::UpdateMyUserProfileRequest&& request, const UpdateMyUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates an Amazon RDS instance.</p> <p> <b>Required Permissions</b>: To use
          * this action, an IAM user must have a Manage permissions level for the stack, or
@@ -3098,6 +3881,18 @@ namespace Model
          */
         virtual void UpdateRdsDbInstanceAsync(const Model::UpdateRdsDbInstanceRequest& request, const UpdateRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateRdsDbInstanceCallable(const Model::UpdateRdsDbInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateRdsDbInstanceOutcomeCallable UpdateRdsDbInstanceCallable(Model::UpdateRdsDbInstanceRequest&& request) const;
+
+        /**
+         * Same as UpdateRdsDbInstanceAsync(const Model::UpdateRdsDbInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateRdsDbInstanceAsync(Model::UpdateRdsDbInstanceRequest&& request, const UpdateRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a specified stack.</p> <p> <b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -3132,6 +3927,18 @@ namespace Model
          */
         virtual void UpdateStackAsync(const Model::UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateStackCallable(const Model::UpdateStackRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateStackOutcomeCallable UpdateStackCallable(Model::UpdateStackRequest&& request) const;
+
+        /**
+         * Same as UpdateStackAsync(const Model::UpdateStackRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateStackAsync(Model::UpdateStackRequest&& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a specified user profile.</p> <p> <b>Required Permissions</b>: To use
          * this action, an IAM user must have an attached policy that explicitly grants
@@ -3163,6 +3970,18 @@ namespace Model
          */
         virtual void UpdateUserProfileAsync(const Model::UpdateUserProfileRequest& request, const UpdateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateUserProfileCallable(const Model::UpdateUserProfileRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateUserProfileOutcomeCallable UpdateUserProfileCallable(Model::UpdateUserProfileRequest&& request) const;
+
+        /**
+         * Same as UpdateUserProfileAsync(const Model::UpdateUserProfileRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateUserProfileAsync(Model::UpdateUserProfileRequest&& request, const UpdateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates an Amazon EBS volume's name or mount point. For more information, see
          * <a
@@ -3206,6 +4025,375 @@ namespace Model
          */
         virtual void UpdateVolumeAsync(const Model::UpdateVolumeRequest& request, const UpdateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateVolumeCallable(const Model::UpdateVolumeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateVolumeOutcomeCallable UpdateVolumeCallable(Model::UpdateVolumeRequest&& request) const;
+
+        /**
+         * Same as UpdateVolumeAsync(const Model::UpdateVolumeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateVolumeAsync(Model::UpdateVolumeRequest&& request, const UpdateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeEcsClusters(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<OpsWorksClient, Model::DescribeEcsClustersRequest, Model::DescribeEcsClustersOutcome> DescribeEcsClustersPaginator(const Model::DescribeEcsClustersRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AssignInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::AssignInstanceRequest, Model::AssignInstanceOutcome> AssignInstanceAwaitable(Model::AssignInstanceRequest request) const;
+
+        /**
+         * co_await-able form of AssignVolume(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::AssignVolumeRequest, Model::AssignVolumeOutcome> AssignVolumeAwaitable(Model::AssignVolumeRequest request) const;
+
+        /**
+         * co_await-able form of AssociateElasticIp(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::AssociateElasticIpRequest, Model::AssociateElasticIpOutcome> AssociateElasticIpAwaitable(Model::AssociateElasticIpRequest request) const;
+
+        /**
+         * co_await-able form of AttachElasticLoadBalancer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::AttachElasticLoadBalancerRequest, Model::AttachElasticLoadBalancerOutcome> AttachElasticLoadBalancerAwaitable(Model::AttachElasticLoadBalancerRequest request) const;
+
+        /**
+         * co_await-able form of CloneStack(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::CloneStackRequest, Model::CloneStackOutcome> CloneStackAwaitable(Model::CloneStackRequest request) const;
+
+        /**
+         * co_await-able form of CreateApp(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::CreateAppRequest, Model::CreateAppOutcome> CreateAppAwaitable(Model::CreateAppRequest request) const;
+
+        /**
+         * co_await-able form of CreateDeployment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::CreateDeploymentRequest, Model::CreateDeploymentOutcome> CreateDeploymentAwaitable(Model::CreateDeploymentRequest request) const;
+
+        /**
+         * co_await-able form of CreateInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::CreateInstanceRequest, Model::CreateInstanceOutcome> CreateInstanceAwaitable(Model::CreateInstanceRequest request) const;
+
+        /**
+         * co_await-able form of CreateLayer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::CreateLayerRequest, Model::CreateLayerOutcome> CreateLayerAwaitable(Model::CreateLayerRequest request) const;
+
+        /**
+         * co_await-able form of CreateStack(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::CreateStackRequest, Model::CreateStackOutcome> CreateStackAwaitable(Model::CreateStackRequest request) const;
+
+        /**
+         * co_await-able form of CreateUserProfile(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::CreateUserProfileRequest, Model::CreateUserProfileOutcome> CreateUserProfileAwaitable(Model::CreateUserProfileRequest request) const;
+
+        /**
+         * co_await-able form of DeleteApp(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DeleteAppRequest, Model::DeleteAppOutcome> DeleteAppAwaitable(Model::DeleteAppRequest request) const;
+
+        /**
+         * co_await-able form of DeleteInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DeleteInstanceRequest, Model::DeleteInstanceOutcome> DeleteInstanceAwaitable(Model::DeleteInstanceRequest request) const;
+
+        /**
+         * co_await-able form of DeleteLayer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DeleteLayerRequest, Model::DeleteLayerOutcome> DeleteLayerAwaitable(Model::DeleteLayerRequest request) const;
+
+        /**
+         * co_await-able form of DeleteStack(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DeleteStackRequest, Model::DeleteStackOutcome> DeleteStackAwaitable(Model::DeleteStackRequest request) const;
+
+        /**
+         * co_await-able form of DeleteUserProfile(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DeleteUserProfileRequest, Model::DeleteUserProfileOutcome> DeleteUserProfileAwaitable(Model::DeleteUserProfileRequest request) const;
+
+        /**
+         * co_await-able form of DeregisterEcsCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DeregisterEcsClusterRequest, Model::DeregisterEcsClusterOutcome> DeregisterEcsClusterAwaitable(Model::DeregisterEcsClusterRequest request) const;
+
+        /**
+         * co_await-able form of DeregisterElasticIp(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DeregisterElasticIpRequest, Model::DeregisterElasticIpOutcome> DeregisterElasticIpAwaitable(Model::DeregisterElasticIpRequest request) const;
+
+        /**
+         * co_await-able form of DeregisterInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DeregisterInstanceRequest, Model::DeregisterInstanceOutcome> DeregisterInstanceAwaitable(Model::DeregisterInstanceRequest request) const;
+
+        /**
+         * co_await-able form of DeregisterRdsDbInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DeregisterRdsDbInstanceRequest, Model::DeregisterRdsDbInstanceOutcome> DeregisterRdsDbInstanceAwaitable(Model::DeregisterRdsDbInstanceRequest request) const;
+
+        /**
+         * co_await-able form of DeregisterVolume(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DeregisterVolumeRequest, Model::DeregisterVolumeOutcome> DeregisterVolumeAwaitable(Model::DeregisterVolumeRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAgentVersions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeAgentVersionsRequest, Model::DescribeAgentVersionsOutcome> DescribeAgentVersionsAwaitable(Model::DescribeAgentVersionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeApps(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeAppsRequest, Model::DescribeAppsOutcome> DescribeAppsAwaitable(Model::DescribeAppsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCommands(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeCommandsRequest, Model::DescribeCommandsOutcome> DescribeCommandsAwaitable(Model::DescribeCommandsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDeployments(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeDeploymentsRequest, Model::DescribeDeploymentsOutcome> DescribeDeploymentsAwaitable(Model::DescribeDeploymentsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEcsClusters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeEcsClustersRequest, Model::DescribeEcsClustersOutcome> DescribeEcsClustersAwaitable(Model::DescribeEcsClustersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeElasticIps(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeElasticIpsRequest, Model::DescribeElasticIpsOutcome> DescribeElasticIpsAwaitable(Model::DescribeElasticIpsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeElasticLoadBalancers(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeElasticLoadBalancersRequest, Model::DescribeElasticLoadBalancersOutcome> DescribeElasticLoadBalancersAwaitable(Model::DescribeElasticLoadBalancersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeInstancesRequest, Model::DescribeInstancesOutcome> DescribeInstancesAwaitable(Model::DescribeInstancesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLayers(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeLayersRequest, Model::DescribeLayersOutcome> DescribeLayersAwaitable(Model::DescribeLayersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLoadBasedAutoScaling(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeLoadBasedAutoScalingRequest, Model::DescribeLoadBasedAutoScalingOutcome> DescribeLoadBasedAutoScalingAwaitable(Model::DescribeLoadBasedAutoScalingRequest request) const;
+
+        /**
+         * co_await-able form of DescribeMyUserProfile(): the operation runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, void, Model::DescribeMyUserProfileOutcome> DescribeMyUserProfileAwaitable() const;
+
+        /**
+         * co_await-able form of DescribePermissions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribePermissionsRequest, Model::DescribePermissionsOutcome> DescribePermissionsAwaitable(Model::DescribePermissionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeRaidArrays(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeRaidArraysRequest, Model::DescribeRaidArraysOutcome> DescribeRaidArraysAwaitable(Model::DescribeRaidArraysRequest request) const;
+
+        /**
+         * co_await-able form of DescribeRdsDbInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeRdsDbInstancesRequest, Model::DescribeRdsDbInstancesOutcome> DescribeRdsDbInstancesAwaitable(Model::DescribeRdsDbInstancesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeServiceErrors(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeServiceErrorsRequest, Model::DescribeServiceErrorsOutcome> DescribeServiceErrorsAwaitable(Model::DescribeServiceErrorsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeStackProvisioningParameters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeStackProvisioningParametersRequest, Model::DescribeStackProvisioningParametersOutcome> DescribeStackProvisioningParametersAwaitable(Model::DescribeStackProvisioningParametersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeStackSummary(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeStackSummaryRequest, Model::DescribeStackSummaryOutcome> DescribeStackSummaryAwaitable(Model::DescribeStackSummaryRequest request) const;
+
+        /**
+         * co_await-able form of DescribeStacks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeStacksRequest, Model::DescribeStacksOutcome> DescribeStacksAwaitable(Model::DescribeStacksRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTimeBasedAutoScaling(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeTimeBasedAutoScalingRequest, Model::DescribeTimeBasedAutoScalingOutcome> DescribeTimeBasedAutoScalingAwaitable(Model::DescribeTimeBasedAutoScalingRequest request) const;
+
+        /**
+         * co_await-able form of DescribeUserProfiles(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeUserProfilesRequest, Model::DescribeUserProfilesOutcome> DescribeUserProfilesAwaitable(Model::DescribeUserProfilesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeVolumes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DescribeVolumesRequest, Model::DescribeVolumesOutcome> DescribeVolumesAwaitable(Model::DescribeVolumesRequest request) const;
+
+        /**
+         * co_await-able form of DetachElasticLoadBalancer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DetachElasticLoadBalancerRequest, Model::DetachElasticLoadBalancerOutcome> DetachElasticLoadBalancerAwaitable(Model::DetachElasticLoadBalancerRequest request) const;
+
+        /**
+         * co_await-able form of DisassociateElasticIp(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::DisassociateElasticIpRequest, Model::DisassociateElasticIpOutcome> DisassociateElasticIpAwaitable(Model::DisassociateElasticIpRequest request) const;
+
+        /**
+         * co_await-able form of GetHostnameSuggestion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::GetHostnameSuggestionRequest, Model::GetHostnameSuggestionOutcome> GetHostnameSuggestionAwaitable(Model::GetHostnameSuggestionRequest request) const;
+
+        /**
+         * co_await-able form of GrantAccess(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::GrantAccessRequest, Model::GrantAccessOutcome> GrantAccessAwaitable(Model::GrantAccessRequest request) const;
+
+        /**
+         * co_await-able form of RebootInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::RebootInstanceRequest, Model::RebootInstanceOutcome> RebootInstanceAwaitable(Model::RebootInstanceRequest request) const;
+
+        /**
+         * co_await-able form of RegisterEcsCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::RegisterEcsClusterRequest, Model::RegisterEcsClusterOutcome> RegisterEcsClusterAwaitable(Model::RegisterEcsClusterRequest request) const;
+
+        /**
+         * co_await-able form of RegisterElasticIp(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::RegisterElasticIpRequest, Model::RegisterElasticIpOutcome> RegisterElasticIpAwaitable(Model::RegisterElasticIpRequest request) const;
+
+        /**
+         * co_await-able form of RegisterInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::RegisterInstanceRequest, Model::RegisterInstanceOutcome> RegisterInstanceAwaitable(Model::RegisterInstanceRequest request) const;
+
+        /**
+         * co_await-able form of RegisterRdsDbInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::RegisterRdsDbInstanceRequest, Model::RegisterRdsDbInstanceOutcome> RegisterRdsDbInstanceAwaitable(Model::RegisterRdsDbInstanceRequest request) const;
+
+        /**
+         * co_await-able form of RegisterVolume(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::RegisterVolumeRequest, Model::RegisterVolumeOutcome> RegisterVolumeAwaitable(Model::RegisterVolumeRequest request) const;
+
+        /**
+         * co_await-able form of SetLoadBasedAutoScaling(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::SetLoadBasedAutoScalingRequest, Model::SetLoadBasedAutoScalingOutcome> SetLoadBasedAutoScalingAwaitable(Model::SetLoadBasedAutoScalingRequest request) const;
+
+        /**
+         * co_await-able form of SetPermission(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::SetPermissionRequest, Model::SetPermissionOutcome> SetPermissionAwaitable(Model::SetPermissionRequest request) const;
+
+        /**
+         * co_await-able form of SetTimeBasedAutoScaling(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::SetTimeBasedAutoScalingRequest, Model::SetTimeBasedAutoScalingOutcome> SetTimeBasedAutoScalingAwaitable(Model::SetTimeBasedAutoScalingRequest request) const;
+
+        /**
+         * co_await-able form of StartInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::StartInstanceRequest, Model::StartInstanceOutcome> StartInstanceAwaitable(Model::StartInstanceRequest request) const;
+
+        /**
+         * co_await-able form of StartStack(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::StartStackRequest, Model::StartStackOutcome> StartStackAwaitable(Model::StartStackRequest request) const;
+
+        /**
+         * co_await-able form of StopInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::StopInstanceRequest, Model::StopInstanceOutcome> StopInstanceAwaitable(Model::StopInstanceRequest request) const;
+
+        /**
+         * co_await-able form of StopStack(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::StopStackRequest, Model::StopStackOutcome> StopStackAwaitable(Model::StopStackRequest request) const;
+
+        /**
+         * co_await-able form of UnassignInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::UnassignInstanceRequest, Model::UnassignInstanceOutcome> UnassignInstanceAwaitable(Model::UnassignInstanceRequest request) const;
+
+        /**
+         * co_await-able form of UnassignVolume(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::UnassignVolumeRequest, Model::UnassignVolumeOutcome> UnassignVolumeAwaitable(Model::UnassignVolumeRequest request) const;
+
+        /**
+         * co_await-able form of UpdateApp(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::UpdateAppRequest, Model::UpdateAppOutcome> UpdateAppAwaitable(Model::UpdateAppRequest request) const;
+
+        /**
+         * co_await-able form of UpdateElasticIp(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::UpdateElasticIpRequest, Model::UpdateElasticIpOutcome> UpdateElasticIpAwaitable(Model::UpdateElasticIpRequest request) const;
+
+        /**
+         * co_await-able form of UpdateInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::UpdateInstanceRequest, Model::UpdateInstanceOutcome> UpdateInstanceAwaitable(Model::UpdateInstanceRequest request) const;
+
+        /**
+         * co_await-able form of UpdateLayer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::UpdateLayerRequest, Model::UpdateLayerOutcome> UpdateLayerAwaitable(Model::UpdateLayerRequest request) const;
+
+        /**
+         * co_await-able form of UpdateMyUserProfile(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::UpdateMyUserProfileRequest, Model::UpdateMyUserProfileOutcome> UpdateMyUserProfileAwaitable(Model::UpdateMyUserProfileRequest request) const;
+
+        /**
+         * co_await-able form of UpdateRdsDbInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::UpdateRdsDbInstanceRequest, Model::UpdateRdsDbInstanceOutcome> UpdateRdsDbInstanceAwaitable(Model::UpdateRdsDbInstanceRequest request) const;
+
+        /**
+         * co_await-able form of UpdateStack(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::UpdateStackRequest, Model::UpdateStackOutcome> UpdateStackAwaitable(Model::UpdateStackRequest request) const;
+
+        /**
+         * co_await-able form of UpdateUserProfile(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::UpdateUserProfileRequest, Model::UpdateUserProfileOutcome> UpdateUserProfileAwaitable(Model::UpdateUserProfileRequest request) const;
+
+        /**
+         * co_await-able form of UpdateVolume(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<OpsWorksClient, Model::UpdateVolumeRequest, Model::UpdateVolumeOutcome> UpdateVolumeAwaitable(Model::UpdateVolumeRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AssignInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "AssignInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
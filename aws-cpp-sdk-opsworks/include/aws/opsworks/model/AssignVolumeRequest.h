@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     AssignVolumeRequest();
+    inline const char* GetServiceRequestName() const override { return "AssignVolume"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
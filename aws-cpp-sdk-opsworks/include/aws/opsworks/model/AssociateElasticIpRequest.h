@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     AssociateElasticIpRequest();
+    inline const char* GetServiceRequestName() const override { return "AssociateElasticIp"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     AttachElasticLoadBalancerRequest();
+    inline const char* GetServiceRequestName() const override { return "AttachElasticLoadBalancer"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
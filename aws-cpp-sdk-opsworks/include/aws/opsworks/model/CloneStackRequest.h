@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     CloneStackRequest();
+    inline const char* GetServiceRequestName() const override { return "CloneStack"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
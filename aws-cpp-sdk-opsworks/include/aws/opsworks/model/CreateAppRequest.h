@@ -38,6 +38,8 @@ namespace Model
   {
   public:
     CreateAppRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateApp"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateDeploymentRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDeployment"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
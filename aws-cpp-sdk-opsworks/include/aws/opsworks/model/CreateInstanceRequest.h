@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     CreateInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
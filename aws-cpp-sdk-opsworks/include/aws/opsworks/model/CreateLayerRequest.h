@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     CreateLayerRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateLayer"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     CreateStackRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateStack"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
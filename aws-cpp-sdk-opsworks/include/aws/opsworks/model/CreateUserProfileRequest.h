@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateUserProfileRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateUserProfile"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
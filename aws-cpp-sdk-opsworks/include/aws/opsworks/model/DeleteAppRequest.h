@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteAppRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteApp"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
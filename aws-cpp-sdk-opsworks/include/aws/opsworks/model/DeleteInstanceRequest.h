@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
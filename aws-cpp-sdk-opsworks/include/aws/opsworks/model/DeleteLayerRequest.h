@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteLayerRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteLayer"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteStackRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteStack"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteUserProfileRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteUserProfile"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeregisterEcsClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "DeregisterEcsCluster"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
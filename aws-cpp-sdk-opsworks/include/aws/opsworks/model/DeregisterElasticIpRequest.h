@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeregisterElasticIpRequest();
+    inline const char* GetServiceRequestName() const override { return "DeregisterElasticIp"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeregisterInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeregisterInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeregisterRdsDbInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeregisterRdsDbInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeregisterVolumeRequest();
+    inline const char* GetServiceRequestName() const override { return "DeregisterVolume"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
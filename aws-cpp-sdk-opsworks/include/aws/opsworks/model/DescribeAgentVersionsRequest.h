@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeAgentVersionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAgentVersions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
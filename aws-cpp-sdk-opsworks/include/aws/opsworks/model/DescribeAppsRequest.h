@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeAppsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeApps"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
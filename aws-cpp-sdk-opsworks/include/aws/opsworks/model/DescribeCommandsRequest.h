@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeCommandsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCommands"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeDeploymentsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDeployments"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeEcsClustersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEcsClusters"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
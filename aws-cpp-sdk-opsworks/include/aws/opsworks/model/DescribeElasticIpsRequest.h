@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeElasticIpsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeElasticIps"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeElasticLoadBalancersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeElasticLoadBalancers"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeInstances"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeLayersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLayers"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
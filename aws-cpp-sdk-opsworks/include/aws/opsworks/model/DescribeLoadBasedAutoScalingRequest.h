@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeLoadBasedAutoScalingRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLoadBasedAutoScaling"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
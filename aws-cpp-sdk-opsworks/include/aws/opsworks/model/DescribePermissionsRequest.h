@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribePermissionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribePermissions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeRaidArraysRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeRaidArrays"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeRdsDbInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeRdsDbInstances"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeServiceErrorsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeServiceErrors"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
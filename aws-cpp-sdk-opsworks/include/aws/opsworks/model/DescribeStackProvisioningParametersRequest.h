@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeStackProvisioningParametersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeStackProvisioningParameters"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
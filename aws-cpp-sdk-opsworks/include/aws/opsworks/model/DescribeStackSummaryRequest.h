@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeStackSummaryRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeStackSummary"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeTimeBasedAutoScalingRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTimeBasedAutoScaling"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
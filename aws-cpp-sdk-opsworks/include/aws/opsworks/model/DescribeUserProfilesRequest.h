@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeUserProfilesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeUserProfiles"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
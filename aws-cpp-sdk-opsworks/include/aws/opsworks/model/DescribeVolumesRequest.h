@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeVolumesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVolumes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
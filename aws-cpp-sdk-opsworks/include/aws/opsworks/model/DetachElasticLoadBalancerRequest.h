@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DetachElasticLoadBalancerRequest();
+    inline const char* GetServiceRequestName() const override { return "DetachElasticLoadBalancer"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DisassociateElasticIpRequest();
+    inline const char* GetServiceRequestName() const override { return "DisassociateElasticIp"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
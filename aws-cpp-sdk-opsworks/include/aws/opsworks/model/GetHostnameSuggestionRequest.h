@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetHostnameSuggestionRequest();
+    inline const char* GetServiceRequestName() const override { return "GetHostnameSuggestion"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GrantAccessRequest();
+    inline const char* GetServiceRequestName() const override { return "GrantAccess"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RebootInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "RebootInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
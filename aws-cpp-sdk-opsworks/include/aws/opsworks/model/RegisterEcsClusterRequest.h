@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RegisterEcsClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterEcsCluster"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
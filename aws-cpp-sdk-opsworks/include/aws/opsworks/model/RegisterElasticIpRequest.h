@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RegisterElasticIpRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterElasticIp"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
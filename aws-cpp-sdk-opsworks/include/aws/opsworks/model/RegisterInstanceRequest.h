@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RegisterInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
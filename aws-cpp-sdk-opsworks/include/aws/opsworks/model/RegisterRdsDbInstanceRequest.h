@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RegisterRdsDbInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterRdsDbInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
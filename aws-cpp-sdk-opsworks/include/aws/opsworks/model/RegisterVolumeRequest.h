@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RegisterVolumeRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterVolume"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     SetLoadBasedAutoScalingRequest();
+    inline const char* GetServiceRequestName() const override { return "SetLoadBasedAutoScaling"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     SetPermissionRequest();
+    inline const char* GetServiceRequestName() const override { return "SetPermission"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
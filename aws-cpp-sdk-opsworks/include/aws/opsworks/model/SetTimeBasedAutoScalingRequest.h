@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     SetTimeBasedAutoScalingRequest();
+    inline const char* GetServiceRequestName() const override { return "SetTimeBasedAutoScaling"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     StartInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "StartInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     StartStackRequest();
+    inline const char* GetServiceRequestName() const override { return "StartStack"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     StopInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "StopInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     StopStackRequest();
+    inline const char* GetServiceRequestName() const override { return "StopStack"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UnassignInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "UnassignInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
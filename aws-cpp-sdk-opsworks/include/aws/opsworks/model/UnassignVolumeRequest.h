@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UnassignVolumeRequest();
+    inline const char* GetServiceRequestName() const override { return "UnassignVolume"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -38,6 +38,8 @@ namespace Model
   {
   public:
     UpdateAppRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateApp"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
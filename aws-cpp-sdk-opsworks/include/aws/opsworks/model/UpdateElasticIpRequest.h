@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateElasticIpRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateElasticIp"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
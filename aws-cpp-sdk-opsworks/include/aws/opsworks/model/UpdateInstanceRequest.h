@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     UpdateLayerRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateLayer"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
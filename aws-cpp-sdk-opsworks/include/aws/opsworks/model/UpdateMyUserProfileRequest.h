@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateMyUserProfileRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateMyUserProfile"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateRdsDbInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateRdsDbInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     UpdateStackRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateStack"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateUserProfileRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateUserProfile"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateVolumeRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateVolume"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -178,7 +178,7 @@ AssignInstanceOutcome OpsWorksClient::AssignInstance(const AssignInstanceRequest
 
 AssignInstanceOutcomeCallable OpsWorksClient::AssignInstanceCallable(const AssignInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AssignInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AssignInstance(request); } );
 }
 
 void OpsWorksClient::AssignInstanceAsync(const AssignInstanceRequest& request, const AssignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -186,6 +186,16 @@ void OpsWorksClient::AssignInstanceAsync(const AssignInstanceRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->AssignInstanceAsyncHelper( request, handler, context ); } );
 }
 
+AssignInstanceOutcomeCallable OpsWorksClient::AssignInstanceCallable(AssignInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::AssignInstance, this, std::move(request)));
+}
+
+void OpsWorksClient::AssignInstanceAsync(AssignInstanceRequest&& request, const AssignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::AssignInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::AssignInstanceAsyncHelper(const AssignInstanceRequest& request, const AssignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AssignInstance(request), context);
@@ -209,7 +219,7 @@ AssignVolumeOutcome OpsWorksClient::AssignVolume(const AssignVolumeRequest& requ
 
 AssignVolumeOutcomeCallable OpsWorksClient::AssignVolumeCallable(const AssignVolumeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AssignVolume(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AssignVolume(request); } );
 }
 
 void OpsWorksClient::AssignVolumeAsync(const AssignVolumeRequest& request, const AssignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -217,6 +227,16 @@ void OpsWorksClient::AssignVolumeAsync(const AssignVolumeRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->AssignVolumeAsyncHelper( request, handler, context ); } );
 }
 
+AssignVolumeOutcomeCallable OpsWorksClient::AssignVolumeCallable(AssignVolumeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::AssignVolume, this, std::move(request)));
+}
+
+void OpsWorksClient::AssignVolumeAsync(AssignVolumeRequest&& request, const AssignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::AssignVolumeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::AssignVolumeAsyncHelper(const AssignVolumeRequest& request, const AssignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AssignVolume(request), context);
@@ -240,7 +260,7 @@ AssociateElasticIpOutcome OpsWorksClient::AssociateElasticIp(const AssociateElas
 
 AssociateElasticIpOutcomeCallable OpsWorksClient::AssociateElasticIpCallable(const AssociateElasticIpRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AssociateElasticIp(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AssociateElasticIp(request); } );
 }
 
 void OpsWorksClient::AssociateElasticIpAsync(const AssociateElasticIpRequest& request, const AssociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -248,6 +268,16 @@ void OpsWorksClient::AssociateElasticIpAsync(const AssociateElasticIpRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->AssociateElasticIpAsyncHelper( request, handler, context ); } );
 }
 
+AssociateElasticIpOutcomeCallable OpsWorksClient::AssociateElasticIpCallable(AssociateElasticIpRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::AssociateElasticIp, this, std::move(request)));
+}
+
+void OpsWorksClient::AssociateElasticIpAsync(AssociateElasticIpRequest&& request, const AssociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::AssociateElasticIpAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::AssociateElasticIpAsyncHelper(const AssociateElasticIpRequest& request, const AssociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AssociateElasticIp(request), context);
@@ -271,7 +301,7 @@ AttachElasticLoadBalancerOutcome OpsWorksClient::AttachElasticLoadBalancer(const
 
 AttachElasticLoadBalancerOutcomeCallable OpsWorksClient::AttachElasticLoadBalancerCallable(const AttachElasticLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AttachElasticLoadBalancer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AttachElasticLoadBalancer(request); } );
 }
 
 void OpsWorksClient::AttachElasticLoadBalancerAsync(const AttachElasticLoadBalancerRequest& request, const AttachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -279,6 +309,16 @@ void OpsWorksClient::AttachElasticLoadBalancerAsync(const AttachElasticLoadBalan
   m_executor->Submit( [this, request, handler, context](){ this->AttachElasticLoadBalancerAsyncHelper( request, handler, context ); } );
 }
 
+AttachElasticLoadBalancerOutcomeCallable OpsWorksClient::AttachElasticLoadBalancerCallable(AttachElasticLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::AttachElasticLoadBalancer, this, std::move(request)));
+}
+
+void OpsWorksClient::AttachElasticLoadBalancerAsync(AttachElasticLoadBalancerRequest&& request, const AttachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::AttachElasticLoadBalancerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::AttachElasticLoadBalancerAsyncHelper(const AttachElasticLoadBalancerRequest& request, const AttachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AttachElasticLoadBalancer(request), context);
@@ -302,7 +342,7 @@ CloneStackOutcome OpsWorksClient::CloneStack(const CloneStackRequest& request) c
 
 CloneStackOutcomeCallable OpsWorksClient::CloneStackCallable(const CloneStackRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CloneStack(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CloneStack(request); } );
 }
 
 void OpsWorksClient::CloneStackAsync(const CloneStackRequest& request, const CloneStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -310,6 +350,16 @@ void OpsWorksClient::CloneStackAsync(const CloneStackRequest& request, const Clo
   m_executor->Submit( [this, request, handler, context](){ this->CloneStackAsyncHelper( request, handler, context ); } );
 }
 
+CloneStackOutcomeCallable OpsWorksClient::CloneStackCallable(CloneStackRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::CloneStack, this, std::move(request)));
+}
+
+void OpsWorksClient::CloneStackAsync(CloneStackRequest&& request, const CloneStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::CloneStackAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::CloneStackAsyncHelper(const CloneStackRequest& request, const CloneStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CloneStack(request), context);
@@ -333,7 +383,7 @@ CreateAppOutcome OpsWorksClient::CreateApp(const CreateAppRequest& request) cons
 
 CreateAppOutcomeCallable OpsWorksClient::CreateAppCallable(const CreateAppRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateApp(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateApp(request); } );
 }
 
 void OpsWorksClient::CreateAppAsync(const CreateAppRequest& request, const CreateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -341,6 +391,16 @@ void OpsWorksClient::CreateAppAsync(const CreateAppRequest& request, const Creat
   m_executor->Submit( [this, request, handler, context](){ this->CreateAppAsyncHelper( request, handler, context ); } );
 }
 
+CreateAppOutcomeCallable OpsWorksClient::CreateAppCallable(CreateAppRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::CreateApp, this, std::move(request)));
+}
+
+void OpsWorksClient::CreateAppAsync(CreateAppRequest&& request, const CreateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::CreateAppAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::CreateAppAsyncHelper(const CreateAppRequest& request, const CreateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateApp(request), context);
@@ -364,7 +424,7 @@ CreateDeploymentOutcome OpsWorksClient::CreateDeployment(const CreateDeploymentR
 
 CreateDeploymentOutcomeCallable OpsWorksClient::CreateDeploymentCallable(const CreateDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDeployment(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDeployment(request); } );
 }
 
 void OpsWorksClient::CreateDeploymentAsync(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -372,6 +432,16 @@ void OpsWorksClient::CreateDeploymentAsync(const CreateDeploymentRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->CreateDeploymentAsyncHelper( request, handler, context ); } );
 }
 
+CreateDeploymentOutcomeCallable OpsWorksClient::CreateDeploymentCallable(CreateDeploymentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::CreateDeployment, this, std::move(request)));
+}
+
+void OpsWorksClient::CreateDeploymentAsync(CreateDeploymentRequest&& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::CreateDeploymentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::CreateDeploymentAsyncHelper(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDeployment(request), context);
@@ -395,7 +465,7 @@ CreateInstanceOutcome OpsWorksClient::CreateInstance(const CreateInstanceRequest
 
 CreateInstanceOutcomeCallable OpsWorksClient::CreateInstanceCallable(const CreateInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateInstance(request); } );
 }
 
 void OpsWorksClient::CreateInstanceAsync(const CreateInstanceRequest& request, const CreateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -403,6 +473,16 @@ void OpsWorksClient::CreateInstanceAsync(const CreateInstanceRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->CreateInstanceAsyncHelper( request, handler, context ); } );
 }
 
+CreateInstanceOutcomeCallable OpsWorksClient::CreateInstanceCallable(CreateInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::CreateInstance, this, std::move(request)));
+}
+
+void OpsWorksClient::CreateInstanceAsync(CreateInstanceRequest&& request, const CreateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::CreateInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::CreateInstanceAsyncHelper(const CreateInstanceRequest& request, const CreateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateInstance(request), context);
@@ -426,7 +506,7 @@ CreateLayerOutcome OpsWorksClient::CreateLayer(const CreateLayerRequest& request
 
 CreateLayerOutcomeCallable OpsWorksClient::CreateLayerCallable(const CreateLayerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateLayer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateLayer(request); } );
 }
 
 void OpsWorksClient::CreateLayerAsync(const CreateLayerRequest& request, const CreateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -434,6 +514,16 @@ void OpsWorksClient::CreateLayerAsync(const CreateLayerRequest& request, const C
   m_executor->Submit( [this, request, handler, context](){ this->CreateLayerAsyncHelper( request, handler, context ); } );
 }
 
+CreateLayerOutcomeCallable OpsWorksClient::CreateLayerCallable(CreateLayerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::CreateLayer, this, std::move(request)));
+}
+
+void OpsWorksClient::CreateLayerAsync(CreateLayerRequest&& request, const CreateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::CreateLayerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::CreateLayerAsyncHelper(const CreateLayerRequest& request, const CreateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateLayer(request), context);
@@ -457,7 +547,7 @@ CreateStackOutcome OpsWorksClient::CreateStack(const CreateStackRequest& request
 
 CreateStackOutcomeCallable OpsWorksClient::CreateStackCallable(const CreateStackRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateStack(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateStack(request); } );
 }
 
 void OpsWorksClient::CreateStackAsync(const CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -465,6 +555,16 @@ void OpsWorksClient::CreateStackAsync(const CreateStackRequest& request, const C
   m_executor->Submit( [this, request, handler, context](){ this->CreateStackAsyncHelper( request, handler, context ); } );
 }
 
+CreateStackOutcomeCallable OpsWorksClient::CreateStackCallable(CreateStackRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::CreateStack, this, std::move(request)));
+}
+
+void OpsWorksClient::CreateStackAsync(CreateStackRequest&& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::CreateStackAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::CreateStackAsyncHelper(const CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateStack(request), context);
@@ -488,7 +588,7 @@ CreateUserProfileOutcome OpsWorksClient::CreateUserProfile(const CreateUserProfi
 
 CreateUserProfileOutcomeCallable OpsWorksClient::CreateUserProfileCallable(const CreateUserProfileRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateUserProfile(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateUserProfile(request); } );
 }
 
 void OpsWorksClient::CreateUserProfileAsync(const CreateUserProfileRequest& request, const CreateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -496,6 +596,16 @@ void OpsWorksClient::CreateUserProfileAsync(const CreateUserProfileRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->CreateUserProfileAsyncHelper( request, handler, context ); } );
 }
 
+CreateUserProfileOutcomeCallable OpsWorksClient::CreateUserProfileCallable(CreateUserProfileRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::CreateUserProfile, this, std::move(request)));
+}
+
+void OpsWorksClient::CreateUserProfileAsync(CreateUserProfileRequest&& request, const CreateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::CreateUserProfileAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::CreateUserProfileAsyncHelper(const CreateUserProfileRequest& request, const CreateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateUserProfile(request), context);
@@ -519,7 +629,7 @@ DeleteAppOutcome OpsWorksClient::DeleteApp(const DeleteAppRequest& request) cons
 
 DeleteAppOutcomeCallable OpsWorksClient::DeleteAppCallable(const DeleteAppRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteApp(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteApp(request); } );
 }
 
 void OpsWorksClient::DeleteAppAsync(const DeleteAppRequest& request, const DeleteAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -527,6 +637,16 @@ void OpsWorksClient::DeleteAppAsync(const DeleteAppRequest& request, const Delet
   m_executor->Submit( [this, request, handler, context](){ this->DeleteAppAsyncHelper( request, handler, context ); } );
 }
 
+DeleteAppOutcomeCallable OpsWorksClient::DeleteAppCallable(DeleteAppRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DeleteApp, this, std::move(request)));
+}
+
+void OpsWorksClient::DeleteAppAsync(DeleteAppRequest&& request, const DeleteAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DeleteAppAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DeleteAppAsyncHelper(const DeleteAppRequest& request, const DeleteAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteApp(request), context);
@@ -550,7 +670,7 @@ DeleteInstanceOutcome OpsWorksClient::DeleteInstance(const DeleteInstanceRequest
 
 DeleteInstanceOutcomeCallable OpsWorksClient::DeleteInstanceCallable(const DeleteInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteInstance(request); } );
 }
 
 void OpsWorksClient::DeleteInstanceAsync(const DeleteInstanceRequest& request, const DeleteInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -558,6 +678,16 @@ void OpsWorksClient::DeleteInstanceAsync(const DeleteInstanceRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->DeleteInstanceAsyncHelper( request, handler, context ); } );
 }
 
+DeleteInstanceOutcomeCallable OpsWorksClient::DeleteInstanceCallable(DeleteInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DeleteInstance, this, std::move(request)));
+}
+
+void OpsWorksClient::DeleteInstanceAsync(DeleteInstanceRequest&& request, const DeleteInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DeleteInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DeleteInstanceAsyncHelper(const DeleteInstanceRequest& request, const DeleteInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteInstance(request), context);
@@ -581,7 +711,7 @@ DeleteLayerOutcome OpsWorksClient::DeleteLayer(const DeleteLayerRequest& request
 
 DeleteLayerOutcomeCallable OpsWorksClient::DeleteLayerCallable(const DeleteLayerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteLayer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteLayer(request); } );
 }
 
 void OpsWorksClient::DeleteLayerAsync(const DeleteLayerRequest& request, const DeleteLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -589,6 +719,16 @@ void OpsWorksClient::DeleteLayerAsync(const DeleteLayerRequest& request, const D
   m_executor->Submit( [this, request, handler, context](){ this->DeleteLayerAsyncHelper( request, handler, context ); } );
 }
 
+DeleteLayerOutcomeCallable OpsWorksClient::DeleteLayerCallable(DeleteLayerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DeleteLayer, this, std::move(request)));
+}
+
+void OpsWorksClient::DeleteLayerAsync(DeleteLayerRequest&& request, const DeleteLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DeleteLayerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DeleteLayerAsyncHelper(const DeleteLayerRequest& request, const DeleteLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteLayer(request), context);
@@ -612,7 +752,7 @@ DeleteStackOutcome OpsWorksClient::DeleteStack(const DeleteStackRequest& request
 
 DeleteStackOutcomeCallable OpsWorksClient::DeleteStackCallable(const DeleteStackRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteStack(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteStack(request); } );
 }
 
 void OpsWorksClient::DeleteStackAsync(const DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -620,6 +760,16 @@ void OpsWorksClient::DeleteStackAsync(const DeleteStackRequest& request, const D
   m_executor->Submit( [this, request, handler, context](){ this->DeleteStackAsyncHelper( request, handler, context ); } );
 }
 
+DeleteStackOutcomeCallable OpsWorksClient::DeleteStackCallable(DeleteStackRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DeleteStack, this, std::move(request)));
+}
+
+void OpsWorksClient::DeleteStackAsync(DeleteStackRequest&& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DeleteStackAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DeleteStackAsyncHelper(const DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteStack(request), context);
@@ -643,7 +793,7 @@ DeleteUserProfileOutcome OpsWorksClient::DeleteUserProfile(const DeleteUserProfi
 
 DeleteUserProfileOutcomeCallable OpsWorksClient::DeleteUserProfileCallable(const DeleteUserProfileRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteUserProfile(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteUserProfile(request); } );
 }
 
 void OpsWorksClient::DeleteUserProfileAsync(const DeleteUserProfileRequest& request, const DeleteUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -651,6 +801,16 @@ void OpsWorksClient::DeleteUserProfileAsync(const DeleteUserProfileRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->DeleteUserProfileAsyncHelper( request, handler, context ); } );
 }
 
+DeleteUserProfileOutcomeCallable OpsWorksClient::DeleteUserProfileCallable(DeleteUserProfileRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DeleteUserProfile, this, std::move(request)));
+}
+
+void OpsWorksClient::DeleteUserProfileAsync(DeleteUserProfileRequest&& request, const DeleteUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DeleteUserProfileAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DeleteUserProfileAsyncHelper(const DeleteUserProfileRequest& request, const DeleteUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteUserProfile(request), context);
@@ -674,7 +834,7 @@ DeregisterEcsClusterOutcome OpsWorksClient::DeregisterEcsCluster(const Deregiste
 
 DeregisterEcsClusterOutcomeCallable OpsWorksClient::DeregisterEcsClusterCallable(const DeregisterEcsClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeregisterEcsCluster(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeregisterEcsCluster(request); } );
 }
 
 void OpsWorksClient::DeregisterEcsClusterAsync(const DeregisterEcsClusterRequest& request, const DeregisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -682,6 +842,16 @@ void OpsWorksClient::DeregisterEcsClusterAsync(const DeregisterEcsClusterRequest
   m_executor->Submit( [this, request, handler, context](){ this->DeregisterEcsClusterAsyncHelper( request, handler, context ); } );
 }
 
+DeregisterEcsClusterOutcomeCallable OpsWorksClient::DeregisterEcsClusterCallable(DeregisterEcsClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DeregisterEcsCluster, this, std::move(request)));
+}
+
+void OpsWorksClient::DeregisterEcsClusterAsync(DeregisterEcsClusterRequest&& request, const DeregisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DeregisterEcsClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DeregisterEcsClusterAsyncHelper(const DeregisterEcsClusterRequest& request, const DeregisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeregisterEcsCluster(request), context);
@@ -705,7 +875,7 @@ DeregisterElasticIpOutcome OpsWorksClient::DeregisterElasticIp(const DeregisterE
 
 DeregisterElasticIpOutcomeCallable OpsWorksClient::DeregisterElasticIpCallable(const DeregisterElasticIpRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeregisterElasticIp(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeregisterElasticIp(request); } );
 }
 
 void OpsWorksClient::DeregisterElasticIpAsync(const DeregisterElasticIpRequest& request, const DeregisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -713,6 +883,16 @@ void OpsWorksClient::DeregisterElasticIpAsync(const DeregisterElasticIpRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DeregisterElasticIpAsyncHelper( request, handler, context ); } );
 }
 
+DeregisterElasticIpOutcomeCallable OpsWorksClient::DeregisterElasticIpCallable(DeregisterElasticIpRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DeregisterElasticIp, this, std::move(request)));
+}
+
+void OpsWorksClient::DeregisterElasticIpAsync(DeregisterElasticIpRequest&& request, const DeregisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DeregisterElasticIpAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DeregisterElasticIpAsyncHelper(const DeregisterElasticIpRequest& request, const DeregisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeregisterElasticIp(request), context);
@@ -736,7 +916,7 @@ DeregisterInstanceOutcome OpsWorksClient::DeregisterInstance(const DeregisterIns
 
 DeregisterInstanceOutcomeCallable OpsWorksClient::DeregisterInstanceCallable(const DeregisterInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeregisterInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeregisterInstance(request); } );
 }
 
 void OpsWorksClient::DeregisterInstanceAsync(const DeregisterInstanceRequest& request, const DeregisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -744,6 +924,16 @@ void OpsWorksClient::DeregisterInstanceAsync(const DeregisterInstanceRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->DeregisterInstanceAsyncHelper( request, handler, context ); } );
 }
 
+DeregisterInstanceOutcomeCallable OpsWorksClient::DeregisterInstanceCallable(DeregisterInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DeregisterInstance, this, std::move(request)));
+}
+
+void OpsWorksClient::DeregisterInstanceAsync(DeregisterInstanceRequest&& request, const DeregisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DeregisterInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DeregisterInstanceAsyncHelper(const DeregisterInstanceRequest& request, const DeregisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeregisterInstance(request), context);
@@ -767,7 +957,7 @@ DeregisterRdsDbInstanceOutcome OpsWorksClient::DeregisterRdsDbInstance(const Der
 
 DeregisterRdsDbInstanceOutcomeCallable OpsWorksClient::DeregisterRdsDbInstanceCallable(const DeregisterRdsDbInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeregisterRdsDbInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeregisterRdsDbInstance(request); } );
 }
 
 void OpsWorksClient::DeregisterRdsDbInstanceAsync(const DeregisterRdsDbInstanceRequest& request, const DeregisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -775,6 +965,16 @@ void OpsWorksClient::DeregisterRdsDbInstanceAsync(const DeregisterRdsDbInstanceR
   m_executor->Submit( [this, request, handler, context](){ this->DeregisterRdsDbInstanceAsyncHelper( request, handler, context ); } );
 }
 
+DeregisterRdsDbInstanceOutcomeCallable OpsWorksClient::DeregisterRdsDbInstanceCallable(DeregisterRdsDbInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DeregisterRdsDbInstance, this, std::move(request)));
+}
+
+void OpsWorksClient::DeregisterRdsDbInstanceAsync(DeregisterRdsDbInstanceRequest&& request, const DeregisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DeregisterRdsDbInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DeregisterRdsDbInstanceAsyncHelper(const DeregisterRdsDbInstanceRequest& request, const DeregisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeregisterRdsDbInstance(request), context);
@@ -798,7 +998,7 @@ DeregisterVolumeOutcome OpsWorksClient::DeregisterVolume(const DeregisterVolumeR
 
 DeregisterVolumeOutcomeCallable OpsWorksClient::DeregisterVolumeCallable(const DeregisterVolumeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeregisterVolume(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeregisterVolume(request); } );
 }
 
 void OpsWorksClient::DeregisterVolumeAsync(const DeregisterVolumeRequest& request, const DeregisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -806,6 +1006,16 @@ void OpsWorksClient::DeregisterVolumeAsync(const DeregisterVolumeRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->DeregisterVolumeAsyncHelper( request, handler, context ); } );
 }
 
+DeregisterVolumeOutcomeCallable OpsWorksClient::DeregisterVolumeCallable(DeregisterVolumeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DeregisterVolume, this, std::move(request)));
+}
+
+void OpsWorksClient::DeregisterVolumeAsync(DeregisterVolumeRequest&& request, const DeregisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DeregisterVolumeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DeregisterVolumeAsyncHelper(const DeregisterVolumeRequest& request, const DeregisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeregisterVolume(request), context);
@@ -829,7 +1039,7 @@ DescribeAgentVersionsOutcome OpsWorksClient::DescribeAgentVersions(const Describ
 
 DescribeAgentVersionsOutcomeCallable OpsWorksClient::DescribeAgentVersionsCallable(const DescribeAgentVersionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAgentVersions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAgentVersions(request); } );
 }
 
 void OpsWorksClient::DescribeAgentVersionsAsync(const DescribeAgentVersionsRequest& request, const DescribeAgentVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -837,6 +1047,16 @@ void OpsWorksClient::DescribeAgentVersionsAsync(const DescribeAgentVersionsReque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAgentVersionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAgentVersionsOutcomeCallable OpsWorksClient::DescribeAgentVersionsCallable(DescribeAgentVersionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeAgentVersions, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeAgentVersionsAsync(DescribeAgentVersionsRequest&& request, const DescribeAgentVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeAgentVersionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeAgentVersionsAsyncHelper(const DescribeAgentVersionsRequest& request, const DescribeAgentVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAgentVersions(request), context);
@@ -860,7 +1080,7 @@ DescribeAppsOutcome OpsWorksClient::DescribeApps(const DescribeAppsRequest& requ
 
 DescribeAppsOutcomeCallable OpsWorksClient::DescribeAppsCallable(const DescribeAppsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeApps(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeApps(request); } );
 }
 
 void OpsWorksClient::DescribeAppsAsync(const DescribeAppsRequest& request, const DescribeAppsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -868,6 +1088,16 @@ void OpsWorksClient::DescribeAppsAsync(const DescribeAppsRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAppsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAppsOutcomeCallable OpsWorksClient::DescribeAppsCallable(DescribeAppsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeApps, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeAppsAsync(DescribeAppsRequest&& request, const DescribeAppsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeAppsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeAppsAsyncHelper(const DescribeAppsRequest& request, const DescribeAppsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeApps(request), context);
@@ -891,7 +1121,7 @@ DescribeCommandsOutcome OpsWorksClient::DescribeCommands(const DescribeCommandsR
 
 DescribeCommandsOutcomeCallable OpsWorksClient::DescribeCommandsCallable(const DescribeCommandsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCommands(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCommands(request); } );
 }
 
 void OpsWorksClient::DescribeCommandsAsync(const DescribeCommandsRequest& request, const DescribeCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -899,6 +1129,16 @@ void OpsWorksClient::DescribeCommandsAsync(const DescribeCommandsRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCommandsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCommandsOutcomeCallable OpsWorksClient::DescribeCommandsCallable(DescribeCommandsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeCommands, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeCommandsAsync(DescribeCommandsRequest&& request, const DescribeCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeCommandsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeCommandsAsyncHelper(const DescribeCommandsRequest& request, const DescribeCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCommands(request), context);
@@ -922,7 +1162,7 @@ DescribeDeploymentsOutcome OpsWorksClient::DescribeDeployments(const DescribeDep
 
 DescribeDeploymentsOutcomeCallable OpsWorksClient::DescribeDeploymentsCallable(const DescribeDeploymentsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDeployments(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDeployments(request); } );
 }
 
 void OpsWorksClient::DescribeDeploymentsAsync(const DescribeDeploymentsRequest& request, const DescribeDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -930,6 +1170,16 @@ void OpsWorksClient::DescribeDeploymentsAsync(const DescribeDeploymentsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDeploymentsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDeploymentsOutcomeCallable OpsWorksClient::DescribeDeploymentsCallable(DescribeDeploymentsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeDeployments, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeDeploymentsAsync(DescribeDeploymentsRequest&& request, const DescribeDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeDeploymentsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeDeploymentsAsyncHelper(const DescribeDeploymentsRequest& request, const DescribeDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDeployments(request), context);
@@ -953,7 +1203,7 @@ DescribeEcsClustersOutcome OpsWorksClient::DescribeEcsClusters(const DescribeEcs
 
 DescribeEcsClustersOutcomeCallable OpsWorksClient::DescribeEcsClustersCallable(const DescribeEcsClustersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEcsClusters(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEcsClusters(request); } );
 }
 
 void OpsWorksClient::DescribeEcsClustersAsync(const DescribeEcsClustersRequest& request, const DescribeEcsClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -961,6 +1211,16 @@ void OpsWorksClient::DescribeEcsClustersAsync(const DescribeEcsClustersRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEcsClustersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEcsClustersOutcomeCallable OpsWorksClient::DescribeEcsClustersCallable(DescribeEcsClustersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeEcsClusters, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeEcsClustersAsync(DescribeEcsClustersRequest&& request, const DescribeEcsClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeEcsClustersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeEcsClustersAsyncHelper(const DescribeEcsClustersRequest& request, const DescribeEcsClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEcsClusters(request), context);
@@ -984,7 +1244,7 @@ DescribeElasticIpsOutcome OpsWorksClient::DescribeElasticIps(const DescribeElast
 
 DescribeElasticIpsOutcomeCallable OpsWorksClient::DescribeElasticIpsCallable(const DescribeElasticIpsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeElasticIps(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeElasticIps(request); } );
 }
 
 void OpsWorksClient::DescribeElasticIpsAsync(const DescribeElasticIpsRequest& request, const DescribeElasticIpsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -992,6 +1252,16 @@ void OpsWorksClient::DescribeElasticIpsAsync(const DescribeElasticIpsRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->DescribeElasticIpsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeElasticIpsOutcomeCallable OpsWorksClient::DescribeElasticIpsCallable(DescribeElasticIpsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeElasticIps, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeElasticIpsAsync(DescribeElasticIpsRequest&& request, const DescribeElasticIpsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeElasticIpsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeElasticIpsAsyncHelper(const DescribeElasticIpsRequest& request, const DescribeElasticIpsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeElasticIps(request), context);
@@ -1015,7 +1285,7 @@ DescribeElasticLoadBalancersOutcome OpsWorksClient::DescribeElasticLoadBalancers
 
 DescribeElasticLoadBalancersOutcomeCallable OpsWorksClient::DescribeElasticLoadBalancersCallable(const DescribeElasticLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeElasticLoadBalancers(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeElasticLoadBalancers(request); } );
 }
 
 void OpsWorksClient::DescribeElasticLoadBalancersAsync(const DescribeElasticLoadBalancersRequest& request, const DescribeElasticLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1023,6 +1293,16 @@ void OpsWorksClient::DescribeElasticLoadBalancersAsync(const DescribeElasticLoad
   m_executor->Submit( [this, request, handler, context](){ this->DescribeElasticLoadBalancersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeElasticLoadBalancersOutcomeCallable OpsWorksClient::DescribeElasticLoadBalancersCallable(DescribeElasticLoadBalancersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeElasticLoadBalancers, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeElasticLoadBalancersAsync(DescribeElasticLoadBalancersRequest&& request, const DescribeElasticLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeElasticLoadBalancersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeElasticLoadBalancersAsyncHelper(const DescribeElasticLoadBalancersRequest& request, const DescribeElasticLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeElasticLoadBalancers(request), context);
@@ -1046,7 +1326,7 @@ DescribeInstancesOutcome OpsWorksClient::DescribeInstances(const DescribeInstanc
 
 DescribeInstancesOutcomeCallable OpsWorksClient::DescribeInstancesCallable(const DescribeInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeInstances(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeInstances(request); } );
 }
 
 void OpsWorksClient::DescribeInstancesAsync(const DescribeInstancesRequest& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1054,6 +1334,16 @@ void OpsWorksClient::DescribeInstancesAsync(const DescribeInstancesRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeInstancesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeInstancesOutcomeCallable OpsWorksClient::DescribeInstancesCallable(DescribeInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeInstances, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeInstancesAsync(DescribeInstancesRequest&& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeInstancesAsyncHelper(const DescribeInstancesRequest& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeInstances(request), context);
@@ -1077,7 +1367,7 @@ DescribeLayersOutcome OpsWorksClient::DescribeLayers(const DescribeLayersRequest
 
 DescribeLayersOutcomeCallable OpsWorksClient::DescribeLayersCallable(const DescribeLayersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLayers(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLayers(request); } );
 }
 
 void OpsWorksClient::DescribeLayersAsync(const DescribeLayersRequest& request, const DescribeLayersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1085,6 +1375,16 @@ void OpsWorksClient::DescribeLayersAsync(const DescribeLayersRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLayersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLayersOutcomeCallable OpsWorksClient::DescribeLayersCallable(DescribeLayersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeLayers, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeLayersAsync(DescribeLayersRequest&& request, const DescribeLayersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeLayersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeLayersAsyncHelper(const DescribeLayersRequest& request, const DescribeLayersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLayers(request), context);
@@ -1108,7 +1408,7 @@ DescribeLoadBasedAutoScalingOutcome OpsWorksClient::DescribeLoadBasedAutoScaling
 
 DescribeLoadBasedAutoScalingOutcomeCallable OpsWorksClient::DescribeLoadBasedAutoScalingCallable(const DescribeLoadBasedAutoScalingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLoadBasedAutoScaling(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLoadBasedAutoScaling(request); } );
 }
 
 void OpsWorksClient::DescribeLoadBasedAutoScalingAsync(const DescribeLoadBasedAutoScalingRequest& request, const DescribeLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1116,6 +1416,16 @@ void OpsWorksClient::DescribeLoadBasedAutoScalingAsync(const DescribeLoadBasedAu
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLoadBasedAutoScalingAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLoadBasedAutoScalingOutcomeCallable OpsWorksClient::DescribeLoadBasedAutoScalingCallable(DescribeLoadBasedAutoScalingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeLoadBasedAutoScaling, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeLoadBasedAutoScalingAsync(DescribeLoadBasedAutoScalingRequest&& request, const DescribeLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeLoadBasedAutoScalingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeLoadBasedAutoScalingAsyncHelper(const DescribeLoadBasedAutoScalingRequest& request, const DescribeLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLoadBasedAutoScaling(request), context);
@@ -1139,7 +1449,7 @@ DescribeMyUserProfileOutcome OpsWorksClient::DescribeMyUserProfile() const
 
 DescribeMyUserProfileOutcomeCallable OpsWorksClient::DescribeMyUserProfileCallable() const
 {
-  return std::async(std::launch::async, [this](){ return this->DescribeMyUserProfile(); } );
+  return m_executor->SubmitCallable([this](){ return this->DescribeMyUserProfile(); } );
 }
 
 void OpsWorksClient::DescribeMyUserProfileAsync(const DescribeMyUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1170,7 +1480,7 @@ DescribePermissionsOutcome OpsWorksClient::DescribePermissions(const DescribePer
 
 DescribePermissionsOutcomeCallable OpsWorksClient::DescribePermissionsCallable(const DescribePermissionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribePermissions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribePermissions(request); } );
 }
 
 void OpsWorksClient::DescribePermissionsAsync(const DescribePermissionsRequest& request, const DescribePermissionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1178,6 +1488,16 @@ void OpsWorksClient::DescribePermissionsAsync(const DescribePermissionsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribePermissionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribePermissionsOutcomeCallable OpsWorksClient::DescribePermissionsCallable(DescribePermissionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribePermissions, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribePermissionsAsync(DescribePermissionsRequest&& request, const DescribePermissionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribePermissionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribePermissionsAsyncHelper(const DescribePermissionsRequest& request, const DescribePermissionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribePermissions(request), context);
@@ -1201,7 +1521,7 @@ DescribeRaidArraysOutcome OpsWorksClient::DescribeRaidArrays(const DescribeRaidA
 
 DescribeRaidArraysOutcomeCallable OpsWorksClient::DescribeRaidArraysCallable(const DescribeRaidArraysRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeRaidArrays(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeRaidArrays(request); } );
 }
 
 void OpsWorksClient::DescribeRaidArraysAsync(const DescribeRaidArraysRequest& request, const DescribeRaidArraysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1209,6 +1529,16 @@ void OpsWorksClient::DescribeRaidArraysAsync(const DescribeRaidArraysRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->DescribeRaidArraysAsyncHelper( request, handler, context ); } );
 }
 
+DescribeRaidArraysOutcomeCallable OpsWorksClient::DescribeRaidArraysCallable(DescribeRaidArraysRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeRaidArrays, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeRaidArraysAsync(DescribeRaidArraysRequest&& request, const DescribeRaidArraysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeRaidArraysAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeRaidArraysAsyncHelper(const DescribeRaidArraysRequest& request, const DescribeRaidArraysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeRaidArrays(request), context);
@@ -1232,7 +1562,7 @@ DescribeRdsDbInstancesOutcome OpsWorksClient::DescribeRdsDbInstances(const Descr
 
 DescribeRdsDbInstancesOutcomeCallable OpsWorksClient::DescribeRdsDbInstancesCallable(const DescribeRdsDbInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeRdsDbInstances(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeRdsDbInstances(request); } );
 }
 
 void OpsWorksClient::DescribeRdsDbInstancesAsync(const DescribeRdsDbInstancesRequest& request, const DescribeRdsDbInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1240,6 +1570,16 @@ void OpsWorksClient::DescribeRdsDbInstancesAsync(const DescribeRdsDbInstancesReq
   m_executor->Submit( [this, request, handler, context](){ this->DescribeRdsDbInstancesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeRdsDbInstancesOutcomeCallable OpsWorksClient::DescribeRdsDbInstancesCallable(DescribeRdsDbInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeRdsDbInstances, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeRdsDbInstancesAsync(DescribeRdsDbInstancesRequest&& request, const DescribeRdsDbInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeRdsDbInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeRdsDbInstancesAsyncHelper(const DescribeRdsDbInstancesRequest& request, const DescribeRdsDbInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeRdsDbInstances(request), context);
@@ -1263,7 +1603,7 @@ DescribeServiceErrorsOutcome OpsWorksClient::DescribeServiceErrors(const Describ
 
 DescribeServiceErrorsOutcomeCallable OpsWorksClient::DescribeServiceErrorsCallable(const DescribeServiceErrorsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeServiceErrors(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeServiceErrors(request); } );
 }
 
 void OpsWorksClient::DescribeServiceErrorsAsync(const DescribeServiceErrorsRequest& request, const DescribeServiceErrorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1271,6 +1611,16 @@ void OpsWorksClient::DescribeServiceErrorsAsync(const DescribeServiceErrorsReque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeServiceErrorsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeServiceErrorsOutcomeCallable OpsWorksClient::DescribeServiceErrorsCallable(DescribeServiceErrorsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeServiceErrors, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeServiceErrorsAsync(DescribeServiceErrorsRequest&& request, const DescribeServiceErrorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeServiceErrorsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeServiceErrorsAsyncHelper(const DescribeServiceErrorsRequest& request, const DescribeServiceErrorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeServiceErrors(request), context);
@@ -1294,7 +1644,7 @@ DescribeStackProvisioningParametersOutcome OpsWorksClient::DescribeStackProvisio
 
 DescribeStackProvisioningParametersOutcomeCallable OpsWorksClient::DescribeStackProvisioningParametersCallable(const DescribeStackProvisioningParametersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeStackProvisioningParameters(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeStackProvisioningParameters(request); } );
 }
 
 void OpsWorksClient::DescribeStackProvisioningParametersAsync(const DescribeStackProvisioningParametersRequest& request, const DescribeStackProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1302,6 +1652,16 @@ void OpsWorksClient::DescribeStackProvisioningParametersAsync(const DescribeStac
   m_executor->Submit( [this, request, handler, context](){ this->DescribeStackProvisioningParametersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeStackProvisioningParametersOutcomeCallable OpsWorksClient::DescribeStackProvisioningParametersCallable(DescribeStackProvisioningParametersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeStackProvisioningParameters, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeStackProvisioningParametersAsync(DescribeStackProvisioningParametersRequest&& request, const DescribeStackProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeStackProvisioningParametersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeStackProvisioningParametersAsyncHelper(const DescribeStackProvisioningParametersRequest& request, const DescribeStackProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeStackProvisioningParameters(request), context);
@@ -1325,7 +1685,7 @@ DescribeStackSummaryOutcome OpsWorksClient::DescribeStackSummary(const DescribeS
 
 DescribeStackSummaryOutcomeCallable OpsWorksClient::DescribeStackSummaryCallable(const DescribeStackSummaryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeStackSummary(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeStackSummary(request); } );
 }
 
 void OpsWorksClient::DescribeStackSummaryAsync(const DescribeStackSummaryRequest& request, const DescribeStackSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1333,6 +1693,16 @@ void OpsWorksClient::DescribeStackSummaryAsync(const DescribeStackSummaryRequest
   m_executor->Submit( [this, request, handler, context](){ this->DescribeStackSummaryAsyncHelper( request, handler, context ); } );
 }
 
+DescribeStackSummaryOutcomeCallable OpsWorksClient::DescribeStackSummaryCallable(DescribeStackSummaryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeStackSummary, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeStackSummaryAsync(DescribeStackSummaryRequest&& request, const DescribeStackSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeStackSummaryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeStackSummaryAsyncHelper(const DescribeStackSummaryRequest& request, const DescribeStackSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeStackSummary(request), context);
@@ -1356,7 +1726,7 @@ DescribeStacksOutcome OpsWorksClient::DescribeStacks(const DescribeStacksRequest
 
 DescribeStacksOutcomeCallable OpsWorksClient::DescribeStacksCallable(const DescribeStacksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeStacks(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeStacks(request); } );
 }
 
 void OpsWorksClient::DescribeStacksAsync(const DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1364,6 +1734,16 @@ void OpsWorksClient::DescribeStacksAsync(const DescribeStacksRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->DescribeStacksAsyncHelper( request, handler, context ); } );
 }
 
+DescribeStacksOutcomeCallable OpsWorksClient::DescribeStacksCallable(DescribeStacksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeStacks, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeStacksAsync(DescribeStacksRequest&& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeStacksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeStacksAsyncHelper(const DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeStacks(request), context);
@@ -1387,7 +1767,7 @@ DescribeTimeBasedAutoScalingOutcome OpsWorksClient::DescribeTimeBasedAutoScaling
 
 DescribeTimeBasedAutoScalingOutcomeCallable OpsWorksClient::DescribeTimeBasedAutoScalingCallable(const DescribeTimeBasedAutoScalingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTimeBasedAutoScaling(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTimeBasedAutoScaling(request); } );
 }
 
 void OpsWorksClient::DescribeTimeBasedAutoScalingAsync(const DescribeTimeBasedAutoScalingRequest& request, const DescribeTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1395,6 +1775,16 @@ void OpsWorksClient::DescribeTimeBasedAutoScalingAsync(const DescribeTimeBasedAu
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTimeBasedAutoScalingAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTimeBasedAutoScalingOutcomeCallable OpsWorksClient::DescribeTimeBasedAutoScalingCallable(DescribeTimeBasedAutoScalingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeTimeBasedAutoScaling, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeTimeBasedAutoScalingAsync(DescribeTimeBasedAutoScalingRequest&& request, const DescribeTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeTimeBasedAutoScalingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeTimeBasedAutoScalingAsyncHelper(const DescribeTimeBasedAutoScalingRequest& request, const DescribeTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTimeBasedAutoScaling(request), context);
@@ -1418,7 +1808,7 @@ DescribeUserProfilesOutcome OpsWorksClient::DescribeUserProfiles(const DescribeU
 
 DescribeUserProfilesOutcomeCallable OpsWorksClient::DescribeUserProfilesCallable(const DescribeUserProfilesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeUserProfiles(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeUserProfiles(request); } );
 }
 
 void OpsWorksClient::DescribeUserProfilesAsync(const DescribeUserProfilesRequest& request, const DescribeUserProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1426,6 +1816,16 @@ void OpsWorksClient::DescribeUserProfilesAsync(const DescribeUserProfilesRequest
   m_executor->Submit( [this, request, handler, context](){ this->DescribeUserProfilesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeUserProfilesOutcomeCallable OpsWorksClient::DescribeUserProfilesCallable(DescribeUserProfilesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeUserProfiles, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeUserProfilesAsync(DescribeUserProfilesRequest&& request, const DescribeUserProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeUserProfilesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeUserProfilesAsyncHelper(const DescribeUserProfilesRequest& request, const DescribeUserProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeUserProfiles(request), context);
@@ -1449,7 +1849,7 @@ DescribeVolumesOutcome OpsWorksClient::DescribeVolumes(const DescribeVolumesRequ
 
 DescribeVolumesOutcomeCallable OpsWorksClient::DescribeVolumesCallable(const DescribeVolumesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVolumes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVolumes(request); } );
 }
 
 void OpsWorksClient::DescribeVolumesAsync(const DescribeVolumesRequest& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1457,6 +1857,16 @@ void OpsWorksClient::DescribeVolumesAsync(const DescribeVolumesRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVolumesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeVolumesOutcomeCallable OpsWorksClient::DescribeVolumesCallable(DescribeVolumesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DescribeVolumes, this, std::move(request)));
+}
+
+void OpsWorksClient::DescribeVolumesAsync(DescribeVolumesRequest&& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DescribeVolumesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DescribeVolumesAsyncHelper(const DescribeVolumesRequest& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeVolumes(request), context);
@@ -1480,7 +1890,7 @@ DetachElasticLoadBalancerOutcome OpsWorksClient::DetachElasticLoadBalancer(const
 
 DetachElasticLoadBalancerOutcomeCallable OpsWorksClient::DetachElasticLoadBalancerCallable(const DetachElasticLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DetachElasticLoadBalancer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DetachElasticLoadBalancer(request); } );
 }
 
 void OpsWorksClient::DetachElasticLoadBalancerAsync(const DetachElasticLoadBalancerRequest& request, const DetachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1488,6 +1898,16 @@ void OpsWorksClient::DetachElasticLoadBalancerAsync(const DetachElasticLoadBalan
   m_executor->Submit( [this, request, handler, context](){ this->DetachElasticLoadBalancerAsyncHelper( request, handler, context ); } );
 }
 
+DetachElasticLoadBalancerOutcomeCallable OpsWorksClient::DetachElasticLoadBalancerCallable(DetachElasticLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DetachElasticLoadBalancer, this, std::move(request)));
+}
+
+void OpsWorksClient::DetachElasticLoadBalancerAsync(DetachElasticLoadBalancerRequest&& request, const DetachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::DetachElasticLoadBalancerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::DetachElasticLoadBalancerAsyncHelper(const DetachElasticLoadBalancerRequest& request, const DetachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DetachElasticLoadBalancer(request), context);
@@ -1511,7 +1931,7 @@ DisassociateElasticIpOutcome OpsWorksClient::DisassociateElasticIp(const Disasso
 
 DisassociateElasticIpOutcomeCallable OpsWorksClient::DisassociateElasticIpCallable(const DisassociateElasticIpRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisassociateElasticIp(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisassociateElasticIp(request); } );
 }
 
 void OpsWorksClient::DisassociateElasticIpAsync(const DisassociateElasticIpRequest& request, const DisassociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1519,14 +1939,24 @@ void OpsWorksClient::DisassociateElasticIpAsync(const DisassociateElasticIpReque
   m_executor->Submit( [this, request, handler, context](){ this->DisassociateElasticIpAsyncHelper( request, handler, context ); } );
 }
 
-void OpsWorksClient::DisassociateElasticIpAsyncHelper(const DisassociateElasticIpRequest& request, const DisassociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+DisassociateElasticIpOutcomeCallable OpsWorksClient::DisassociateElasticIpCallable(DisassociateElasticIpRequest&& request) const
 {
-  handler(this, request, DisassociateElasticIp(request), context);
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::DisassociateElasticIp, this, std::move(request)));
 }
 
-GetHostnameSuggestionOutcome OpsWorksClient::GetHostnameSuggestion(const GetHostnameSuggestionRequest& request) const
+void OpsWorksClient::DisassociateElasticIpAsync(DisassociateElasticIpRequest&& request, const DisassociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  Aws::StringStream ss;
+  m_executor->Submit(&OpsWorksClient::DisassociateElasticIpAsyncHelper, this, std::move(request), handler, context);
+}
+
+void OpsWorksClient::DisassociateElasticIpAsyncHelper(const DisassociateElasticIpRequest& request, const DisassociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  handler(this, request, DisassociateElasticIp(request), context);
+}
+
+GetHostnameSuggestionOutcome OpsWorksClient::GetHostnameSuggestion(const GetHostnameSuggestionRequest& request) const
+{
+  Aws::StringStream ss;
   ss << m_uri << "/";
 
   JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
@@ -1542,7 +1972,7 @@ GetHostnameSuggestionOutcome OpsWorksClient::GetHostnameSuggestion(const GetHost
 
 GetHostnameSuggestionOutcomeCallable OpsWorksClient::GetHostnameSuggestionCallable(const GetHostnameSuggestionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetHostnameSuggestion(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetHostnameSuggestion(request); } );
 }
 
 void OpsWorksClient::GetHostnameSuggestionAsync(const GetHostnameSuggestionRequest& request, const GetHostnameSuggestionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1550,6 +1980,16 @@ void OpsWorksClient::GetHostnameSuggestionAsync(const GetHostnameSuggestionReque
   m_executor->Submit( [this, request, handler, context](){ this->GetHostnameSuggestionAsyncHelper( request, handler, context ); } );
 }
 
+GetHostnameSuggestionOutcomeCallable OpsWorksClient::GetHostnameSuggestionCallable(GetHostnameSuggestionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::GetHostnameSuggestion, this, std::move(request)));
+}
+
+void OpsWorksClient::GetHostnameSuggestionAsync(GetHostnameSuggestionRequest&& request, const GetHostnameSuggestionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::GetHostnameSuggestionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::GetHostnameSuggestionAsyncHelper(const GetHostnameSuggestionRequest& request, const GetHostnameSuggestionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetHostnameSuggestion(request), context);
@@ -1573,7 +2013,7 @@ GrantAccessOutcome OpsWorksClient::GrantAccess(const GrantAccessRequest& request
 
 GrantAccessOutcomeCallable OpsWorksClient::GrantAccessCallable(const GrantAccessRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GrantAccess(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GrantAccess(request); } );
 }
 
 void OpsWorksClient::GrantAccessAsync(const GrantAccessRequest& request, const GrantAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1581,6 +2021,16 @@ void OpsWorksClient::GrantAccessAsync(const GrantAccessRequest& request, const G
   m_executor->Submit( [this, request, handler, context](){ this->GrantAccessAsyncHelper( request, handler, context ); } );
 }
 
+GrantAccessOutcomeCallable OpsWorksClient::GrantAccessCallable(GrantAccessRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::GrantAccess, this, std::move(request)));
+}
+
+void OpsWorksClient::GrantAccessAsync(GrantAccessRequest&& request, const GrantAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::GrantAccessAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::GrantAccessAsyncHelper(const GrantAccessRequest& request, const GrantAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GrantAccess(request), context);
@@ -1604,7 +2054,7 @@ RebootInstanceOutcome OpsWorksClient::RebootInstance(const RebootInstanceRequest
 
 RebootInstanceOutcomeCallable OpsWorksClient::RebootInstanceCallable(const RebootInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RebootInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RebootInstance(request); } );
 }
 
 void OpsWorksClient::RebootInstanceAsync(const RebootInstanceRequest& request, const RebootInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1612,6 +2062,16 @@ void OpsWorksClient::RebootInstanceAsync(const RebootInstanceRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->RebootInstanceAsyncHelper( request, handler, context ); } );
 }
 
+RebootInstanceOutcomeCallable OpsWorksClient::RebootInstanceCallable(RebootInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::RebootInstance, this, std::move(request)));
+}
+
+void OpsWorksClient::RebootInstanceAsync(RebootInstanceRequest&& request, const RebootInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::RebootInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::RebootInstanceAsyncHelper(const RebootInstanceRequest& request, const RebootInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RebootInstance(request), context);
@@ -1635,7 +2095,7 @@ RegisterEcsClusterOutcome OpsWorksClient::RegisterEcsCluster(const RegisterEcsCl
 
 RegisterEcsClusterOutcomeCallable OpsWorksClient::RegisterEcsClusterCallable(const RegisterEcsClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterEcsCluster(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterEcsCluster(request); } );
 }
 
 void OpsWorksClient::RegisterEcsClusterAsync(const RegisterEcsClusterRequest& request, const RegisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1643,6 +2103,16 @@ void OpsWorksClient::RegisterEcsClusterAsync(const RegisterEcsClusterRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->RegisterEcsClusterAsyncHelper( request, handler, context ); } );
 }
 
+RegisterEcsClusterOutcomeCallable OpsWorksClient::RegisterEcsClusterCallable(RegisterEcsClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::RegisterEcsCluster, this, std::move(request)));
+}
+
+void OpsWorksClient::RegisterEcsClusterAsync(RegisterEcsClusterRequest&& request, const RegisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::RegisterEcsClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::RegisterEcsClusterAsyncHelper(const RegisterEcsClusterRequest& request, const RegisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterEcsCluster(request), context);
@@ -1666,7 +2136,7 @@ RegisterElasticIpOutcome OpsWorksClient::RegisterElasticIp(const RegisterElastic
 
 RegisterElasticIpOutcomeCallable OpsWorksClient::RegisterElasticIpCallable(const RegisterElasticIpRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterElasticIp(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterElasticIp(request); } );
 }
 
 void OpsWorksClient::RegisterElasticIpAsync(const RegisterElasticIpRequest& request, const RegisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1674,6 +2144,16 @@ void OpsWorksClient::RegisterElasticIpAsync(const RegisterElasticIpRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->RegisterElasticIpAsyncHelper( request, handler, context ); } );
 }
 
+RegisterElasticIpOutcomeCallable OpsWorksClient::RegisterElasticIpCallable(RegisterElasticIpRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::RegisterElasticIp, this, std::move(request)));
+}
+
+void OpsWorksClient::RegisterElasticIpAsync(RegisterElasticIpRequest&& request, const RegisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::RegisterElasticIpAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::RegisterElasticIpAsyncHelper(const RegisterElasticIpRequest& request, const RegisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterElasticIp(request), context);
@@ -1697,7 +2177,7 @@ RegisterInstanceOutcome OpsWorksClient::RegisterInstance(const RegisterInstanceR
 
 RegisterInstanceOutcomeCallable OpsWorksClient::RegisterInstanceCallable(const RegisterInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterInstance(request); } );
 }
 
 void OpsWorksClient::RegisterInstanceAsync(const RegisterInstanceRequest& request, const RegisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1705,6 +2185,16 @@ void OpsWorksClient::RegisterInstanceAsync(const RegisterInstanceRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->RegisterInstanceAsyncHelper( request, handler, context ); } );
 }
 
+RegisterInstanceOutcomeCallable OpsWorksClient::RegisterInstanceCallable(RegisterInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::RegisterInstance, this, std::move(request)));
+}
+
+void OpsWorksClient::RegisterInstanceAsync(RegisterInstanceRequest&& request, const RegisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::RegisterInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::RegisterInstanceAsyncHelper(const RegisterInstanceRequest& request, const RegisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterInstance(request), context);
@@ -1728,7 +2218,7 @@ RegisterRdsDbInstanceOutcome OpsWorksClient::RegisterRdsDbInstance(const Registe
 
 RegisterRdsDbInstanceOutcomeCallable OpsWorksClient::RegisterRdsDbInstanceCallable(const RegisterRdsDbInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterRdsDbInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterRdsDbInstance(request); } );
 }
 
 void OpsWorksClient::RegisterRdsDbInstanceAsync(const RegisterRdsDbInstanceRequest& request, const RegisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1736,6 +2226,16 @@ void OpsWorksClient::RegisterRdsDbInstanceAsync(const RegisterRdsDbInstanceReque
   m_executor->Submit( [this, request, handler, context](){ this->RegisterRdsDbInstanceAsyncHelper( request, handler, context ); } );
 }
 
+RegisterRdsDbInstanceOutcomeCallable OpsWorksClient::RegisterRdsDbInstanceCallable(RegisterRdsDbInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::RegisterRdsDbInstance, this, std::move(request)));
+}
+
+void OpsWorksClient::RegisterRdsDbInstanceAsync(RegisterRdsDbInstanceRequest&& request, const RegisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::RegisterRdsDbInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::RegisterRdsDbInstanceAsyncHelper(const RegisterRdsDbInstanceRequest& request, const RegisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterRdsDbInstance(request), context);
@@ -1759,7 +2259,7 @@ RegisterVolumeOutcome OpsWorksClient::RegisterVolume(const RegisterVolumeRequest
 
 RegisterVolumeOutcomeCallable OpsWorksClient::RegisterVolumeCallable(const RegisterVolumeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterVolume(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterVolume(request); } );
 }
 
 void OpsWorksClient::RegisterVolumeAsync(const RegisterVolumeRequest& request, const RegisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1767,6 +2267,16 @@ void OpsWorksClient::RegisterVolumeAsync(const RegisterVolumeRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->RegisterVolumeAsyncHelper( request, handler, context ); } );
 }
 
+RegisterVolumeOutcomeCallable OpsWorksClient::RegisterVolumeCallable(RegisterVolumeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::RegisterVolume, this, std::move(request)));
+}
+
+void OpsWorksClient::RegisterVolumeAsync(RegisterVolumeRequest&& request, const RegisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::RegisterVolumeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::RegisterVolumeAsyncHelper(const RegisterVolumeRequest& request, const RegisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterVolume(request), context);
@@ -1790,7 +2300,7 @@ SetLoadBasedAutoScalingOutcome OpsWorksClient::SetLoadBasedAutoScaling(const Set
 
 SetLoadBasedAutoScalingOutcomeCallable OpsWorksClient::SetLoadBasedAutoScalingCallable(const SetLoadBasedAutoScalingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetLoadBasedAutoScaling(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetLoadBasedAutoScaling(request); } );
 }
 
 void OpsWorksClient::SetLoadBasedAutoScalingAsync(const SetLoadBasedAutoScalingRequest& request, const SetLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1798,6 +2308,16 @@ void OpsWorksClient::SetLoadBasedAutoScalingAsync(const SetLoadBasedAutoScalingR
   m_executor->Submit( [this, request, handler, context](){ this->SetLoadBasedAutoScalingAsyncHelper( request, handler, context ); } );
 }
 
+SetLoadBasedAutoScalingOutcomeCallable OpsWorksClient::SetLoadBasedAutoScalingCallable(SetLoadBasedAutoScalingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::SetLoadBasedAutoScaling, this, std::move(request)));
+}
+
+void OpsWorksClient::SetLoadBasedAutoScalingAsync(SetLoadBasedAutoScalingRequest&& request, const SetLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::SetLoadBasedAutoScalingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::SetLoadBasedAutoScalingAsyncHelper(const SetLoadBasedAutoScalingRequest& request, const SetLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetLoadBasedAutoScaling(request), context);
@@ -1821,7 +2341,7 @@ SetPermissionOutcome OpsWorksClient::SetPermission(const SetPermissionRequest& r
 
 SetPermissionOutcomeCallable OpsWorksClient::SetPermissionCallable(const SetPermissionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetPermission(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetPermission(request); } );
 }
 
 void OpsWorksClient::SetPermissionAsync(const SetPermissionRequest& request, const SetPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1829,6 +2349,16 @@ void OpsWorksClient::SetPermissionAsync(const SetPermissionRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->SetPermissionAsyncHelper( request, handler, context ); } );
 }
 
+SetPermissionOutcomeCallable OpsWorksClient::SetPermissionCallable(SetPermissionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::SetPermission, this, std::move(request)));
+}
+
+void OpsWorksClient::SetPermissionAsync(SetPermissionRequest&& request, const SetPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::SetPermissionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::SetPermissionAsyncHelper(const SetPermissionRequest& request, const SetPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetPermission(request), context);
@@ -1852,7 +2382,7 @@ SetTimeBasedAutoScalingOutcome OpsWorksClient::SetTimeBasedAutoScaling(const Set
 
 SetTimeBasedAutoScalingOutcomeCallable OpsWorksClient::SetTimeBasedAutoScalingCallable(const SetTimeBasedAutoScalingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetTimeBasedAutoScaling(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetTimeBasedAutoScaling(request); } );
 }
 
 void OpsWorksClient::SetTimeBasedAutoScalingAsync(const SetTimeBasedAutoScalingRequest& request, const SetTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1860,6 +2390,16 @@ void OpsWorksClient::SetTimeBasedAutoScalingAsync(const SetTimeBasedAutoScalingR
   m_executor->Submit( [this, request, handler, context](){ this->SetTimeBasedAutoScalingAsyncHelper( request, handler, context ); } );
 }
 
+SetTimeBasedAutoScalingOutcomeCallable OpsWorksClient::SetTimeBasedAutoScalingCallable(SetTimeBasedAutoScalingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::SetTimeBasedAutoScaling, this, std::move(request)));
+}
+
+void OpsWorksClient::SetTimeBasedAutoScalingAsync(SetTimeBasedAutoScalingRequest&& request, const SetTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::SetTimeBasedAutoScalingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::SetTimeBasedAutoScalingAsyncHelper(const SetTimeBasedAutoScalingRequest& request, const SetTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetTimeBasedAutoScaling(request), context);
@@ -1883,7 +2423,7 @@ StartInstanceOutcome OpsWorksClient::StartInstance(const StartInstanceRequest& r
 
 StartInstanceOutcomeCallable OpsWorksClient::StartInstanceCallable(const StartInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StartInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StartInstance(request); } );
 }
 
 void OpsWorksClient::StartInstanceAsync(const StartInstanceRequest& request, const StartInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1891,6 +2431,16 @@ void OpsWorksClient::StartInstanceAsync(const StartInstanceRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->StartInstanceAsyncHelper( request, handler, context ); } );
 }
 
+StartInstanceOutcomeCallable OpsWorksClient::StartInstanceCallable(StartInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::StartInstance, this, std::move(request)));
+}
+
+void OpsWorksClient::StartInstanceAsync(StartInstanceRequest&& request, const StartInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::StartInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::StartInstanceAsyncHelper(const StartInstanceRequest& request, const StartInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StartInstance(request), context);
@@ -1914,7 +2464,7 @@ StartStackOutcome OpsWorksClient::StartStack(const StartStackRequest& request) c
 
 StartStackOutcomeCallable OpsWorksClient::StartStackCallable(const StartStackRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StartStack(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StartStack(request); } );
 }
 
 void OpsWorksClient::StartStackAsync(const StartStackRequest& request, const StartStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1922,6 +2472,16 @@ void OpsWorksClient::StartStackAsync(const StartStackRequest& request, const Sta
   m_executor->Submit( [this, request, handler, context](){ this->StartStackAsyncHelper( request, handler, context ); } );
 }
 
+StartStackOutcomeCallable OpsWorksClient::StartStackCallable(StartStackRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::StartStack, this, std::move(request)));
+}
+
+void OpsWorksClient::StartStackAsync(StartStackRequest&& request, const StartStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::StartStackAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::StartStackAsyncHelper(const StartStackRequest& request, const StartStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StartStack(request), context);
@@ -1945,7 +2505,7 @@ StopInstanceOutcome OpsWorksClient::StopInstance(const StopInstanceRequest& requ
 
 StopInstanceOutcomeCallable OpsWorksClient::StopInstanceCallable(const StopInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StopInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StopInstance(request); } );
 }
 
 void OpsWorksClient::StopInstanceAsync(const StopInstanceRequest& request, const StopInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1953,6 +2513,16 @@ void OpsWorksClient::StopInstanceAsync(const StopInstanceRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->StopInstanceAsyncHelper( request, handler, context ); } );
 }
 
+StopInstanceOutcomeCallable OpsWorksClient::StopInstanceCallable(StopInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::StopInstance, this, std::move(request)));
+}
+
+void OpsWorksClient::StopInstanceAsync(StopInstanceRequest&& request, const StopInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::StopInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::StopInstanceAsyncHelper(const StopInstanceRequest& request, const StopInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StopInstance(request), context);
@@ -1976,7 +2546,7 @@ StopStackOutcome OpsWorksClient::StopStack(const StopStackRequest& request) cons
 
 StopStackOutcomeCallable OpsWorksClient::StopStackCallable(const StopStackRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StopStack(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StopStack(request); } );
 }
 
 void OpsWorksClient::StopStackAsync(const StopStackRequest& request, const StopStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1984,6 +2554,16 @@ void OpsWorksClient::StopStackAsync(const StopStackRequest& request, const StopS
   m_executor->Submit( [this, request, handler, context](){ this->StopStackAsyncHelper( request, handler, context ); } );
 }
 
+StopStackOutcomeCallable OpsWorksClient::StopStackCallable(StopStackRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::StopStack, this, std::move(request)));
+}
+
+void OpsWorksClient::StopStackAsync(StopStackRequest&& request, const StopStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::StopStackAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::StopStackAsyncHelper(const StopStackRequest& request, const StopStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StopStack(request), context);
@@ -2007,7 +2587,7 @@ UnassignInstanceOutcome OpsWorksClient::UnassignInstance(const UnassignInstanceR
 
 UnassignInstanceOutcomeCallable OpsWorksClient::UnassignInstanceCallable(const UnassignInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UnassignInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UnassignInstance(request); } );
 }
 
 void OpsWorksClient::UnassignInstanceAsync(const UnassignInstanceRequest& request, const UnassignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2015,6 +2595,16 @@ void OpsWorksClient::UnassignInstanceAsync(const UnassignInstanceRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->UnassignInstanceAsyncHelper( request, handler, context ); } );
 }
 
+UnassignInstanceOutcomeCallable OpsWorksClient::UnassignInstanceCallable(UnassignInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::UnassignInstance, this, std::move(request)));
+}
+
+void OpsWorksClient::UnassignInstanceAsync(UnassignInstanceRequest&& request, const UnassignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::UnassignInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::UnassignInstanceAsyncHelper(const UnassignInstanceRequest& request, const UnassignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UnassignInstance(request), context);
@@ -2038,7 +2628,7 @@ UnassignVolumeOutcome OpsWorksClient::UnassignVolume(const UnassignVolumeRequest
 
 UnassignVolumeOutcomeCallable OpsWorksClient::UnassignVolumeCallable(const UnassignVolumeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UnassignVolume(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UnassignVolume(request); } );
 }
 
 void OpsWorksClient::UnassignVolumeAsync(const UnassignVolumeRequest& request, const UnassignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2046,6 +2636,16 @@ void OpsWorksClient::UnassignVolumeAsync(const UnassignVolumeRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->UnassignVolumeAsyncHelper( request, handler, context ); } );
 }
 
+UnassignVolumeOutcomeCallable OpsWorksClient::UnassignVolumeCallable(UnassignVolumeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::UnassignVolume, this, std::move(request)));
+}
+
+void OpsWorksClient::UnassignVolumeAsync(UnassignVolumeRequest&& request, const UnassignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::UnassignVolumeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::UnassignVolumeAsyncHelper(const UnassignVolumeRequest& request, const UnassignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UnassignVolume(request), context);
@@ -2069,7 +2669,7 @@ UpdateAppOutcome OpsWorksClient::UpdateApp(const UpdateAppRequest& request) cons
 
 UpdateAppOutcomeCallable OpsWorksClient::UpdateAppCallable(const UpdateAppRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateApp(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateApp(request); } );
 }
 
 void OpsWorksClient::UpdateAppAsync(const UpdateAppRequest& request, const UpdateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2077,6 +2677,16 @@ void OpsWorksClient::UpdateAppAsync(const UpdateAppRequest& request, const Updat
   m_executor->Submit( [this, request, handler, context](){ this->UpdateAppAsyncHelper( request, handler, context ); } );
 }
 
+UpdateAppOutcomeCallable OpsWorksClient::UpdateAppCallable(UpdateAppRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::UpdateApp, this, std::move(request)));
+}
+
+void OpsWorksClient::UpdateAppAsync(UpdateAppRequest&& request, const UpdateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::UpdateAppAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::UpdateAppAsyncHelper(const UpdateAppRequest& request, const UpdateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateApp(request), context);
@@ -2100,7 +2710,7 @@ UpdateElasticIpOutcome OpsWorksClient::UpdateElasticIp(const UpdateElasticIpRequ
 
 UpdateElasticIpOutcomeCallable OpsWorksClient::UpdateElasticIpCallable(const UpdateElasticIpRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateElasticIp(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateElasticIp(request); } );
 }
 
 void OpsWorksClient::UpdateElasticIpAsync(const UpdateElasticIpRequest& request, const UpdateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2108,6 +2718,16 @@ void OpsWorksClient::UpdateElasticIpAsync(const UpdateElasticIpRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->UpdateElasticIpAsyncHelper( request, handler, context ); } );
 }
 
+UpdateElasticIpOutcomeCallable OpsWorksClient::UpdateElasticIpCallable(UpdateElasticIpRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::UpdateElasticIp, this, std::move(request)));
+}
+
+void OpsWorksClient::UpdateElasticIpAsync(UpdateElasticIpRequest&& request, const UpdateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::UpdateElasticIpAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::UpdateElasticIpAsyncHelper(const UpdateElasticIpRequest& request, const UpdateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateElasticIp(request), context);
@@ -2131,7 +2751,7 @@ UpdateInstanceOutcome OpsWorksClient::UpdateInstance(const UpdateInstanceRequest
 
 UpdateInstanceOutcomeCallable OpsWorksClient::UpdateInstanceCallable(const UpdateInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateInstance(request); } );
 }
 
 void OpsWorksClient::UpdateInstanceAsync(const UpdateInstanceRequest& request, const UpdateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2139,6 +2759,16 @@ void OpsWorksClient::UpdateInstanceAsync(const UpdateInstanceRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->UpdateInstanceAsyncHelper( request, handler, context ); } );
 }
 
+UpdateInstanceOutcomeCallable OpsWorksClient::UpdateInstanceCallable(UpdateInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::UpdateInstance, this, std::move(request)));
+}
+
+void OpsWorksClient::UpdateInstanceAsync(UpdateInstanceRequest&& request, const UpdateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::UpdateInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::UpdateInstanceAsyncHelper(const UpdateInstanceRequest& request, const UpdateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateInstance(request), context);
@@ -2162,7 +2792,7 @@ UpdateLayerOutcome OpsWorksClient::UpdateLayer(const UpdateLayerRequest& request
 
 UpdateLayerOutcomeCallable OpsWorksClient::UpdateLayerCallable(const UpdateLayerRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateLayer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateLayer(request); } );
 }
 
 void OpsWorksClient::UpdateLayerAsync(const UpdateLayerRequest& request, const UpdateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2170,6 +2800,16 @@ void OpsWorksClient::UpdateLayerAsync(const UpdateLayerRequest& request, const U
   m_executor->Submit( [this, request, handler, context](){ this->UpdateLayerAsyncHelper( request, handler, context ); } );
 }
 
+UpdateLayerOutcomeCallable OpsWorksClient::UpdateLayerCallable(UpdateLayerRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::UpdateLayer, this, std::move(request)));
+}
+
+void OpsWorksClient::UpdateLayerAsync(UpdateLayerRequest&& request, const UpdateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::UpdateLayerAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::UpdateLayerAsyncHelper(const UpdateLayerRequest& request, const UpdateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateLayer(request), context);
@@ -2193,7 +2833,7 @@ UpdateMyUserProfileOutcome OpsWorksClient::UpdateMyUserProfile(const UpdateMyUse
 
 UpdateMyUserProfileOutcomeCallable OpsWorksClient::UpdateMyUserProfileCallable(const UpdateMyUserProfileRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateMyUserProfile(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateMyUserProfile(request); } );
 }
 
 void OpsWorksClient::UpdateMyUserProfileAsync(const UpdateMyUserProfileRequest& request, const UpdateMyUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2201,6 +2841,16 @@ void OpsWorksClient::UpdateMyUserProfileAsync(const UpdateMyUserProfileRequest&
   m_executor->Submit( [this, request, handler, context](){ this->UpdateMyUserProfileAsyncHelper( request, handler, context ); } );
 }
 
+UpdateMyUserProfileOutcomeCallable OpsWorksClient::UpdateMyUserProfileCallable(UpdateMyUserProfileRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::UpdateMyUserProfile, this, std::move(request)));
+}
+
+void OpsWorksClient::UpdateMyUserProfileAsync(UpdateMyUserProfileRequest&& request, const UpdateMyUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::UpdateMyUserProfileAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::UpdateMyUserProfileAsyncHelper(const UpdateMyUserProfileRequest& request, const UpdateMyUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateMyUserProfile(request), context);
@@ -2224,7 +2874,7 @@ UpdateRdsDbInstanceOutcome OpsWorksClient::UpdateRdsDbInstance(const UpdateRdsDb
 
 UpdateRdsDbInstanceOutcomeCallable OpsWorksClient::UpdateRdsDbInstanceCallable(const UpdateRdsDbInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateRdsDbInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateRdsDbInstance(request); } );
 }
 
 void OpsWorksClient::UpdateRdsDbInstanceAsync(const UpdateRdsDbInstanceRequest& request, const UpdateRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2232,6 +2882,16 @@ void OpsWorksClient::UpdateRdsDbInstanceAsync(const UpdateRdsDbInstanceRequest&
   m_executor->Submit( [this, request, handler, context](){ this->UpdateRdsDbInstanceAsyncHelper( request, handler, context ); } );
 }
 
+UpdateRdsDbInstanceOutcomeCallable OpsWorksClient::UpdateRdsDbInstanceCallable(UpdateRdsDbInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::UpdateRdsDbInstance, this, std::move(request)));
+}
+
+void OpsWorksClient::UpdateRdsDbInstanceAsync(UpdateRdsDbInstanceRequest&& request, const UpdateRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::UpdateRdsDbInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::UpdateRdsDbInstanceAsyncHelper(const UpdateRdsDbInstanceRequest& request, const UpdateRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateRdsDbInstance(request), context);
@@ -2255,7 +2915,7 @@ UpdateStackOutcome OpsWorksClient::UpdateStack(const UpdateStackRequest& request
 
 UpdateStackOutcomeCallable OpsWorksClient::UpdateStackCallable(const UpdateStackRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateStack(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateStack(request); } );
 }
 
 void OpsWorksClient::UpdateStackAsync(const UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2263,6 +2923,16 @@ void OpsWorksClient::UpdateStackAsync(const UpdateStackRequest& request, const U
   m_executor->Submit( [this, request, handler, context](){ this->UpdateStackAsyncHelper( request, handler, context ); } );
 }
 
+UpdateStackOutcomeCallable OpsWorksClient::UpdateStackCallable(UpdateStackRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::UpdateStack, this, std::move(request)));
+}
+
+void OpsWorksClient::UpdateStackAsync(UpdateStackRequest&& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::UpdateStackAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::UpdateStackAsyncHelper(const UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateStack(request), context);
@@ -2286,7 +2956,7 @@ UpdateUserProfileOutcome OpsWorksClient::UpdateUserProfile(const UpdateUserProfi
 
 UpdateUserProfileOutcomeCallable OpsWorksClient::UpdateUserProfileCallable(const UpdateUserProfileRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateUserProfile(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateUserProfile(request); } );
 }
 
 void OpsWorksClient::UpdateUserProfileAsync(const UpdateUserProfileRequest& request, const UpdateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2294,6 +2964,16 @@ void OpsWorksClient::UpdateUserProfileAsync(const UpdateUserProfileRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->UpdateUserProfileAsyncHelper( request, handler, context ); } );
 }
 
+UpdateUserProfileOutcomeCallable OpsWorksClient::UpdateUserProfileCallable(UpdateUserProfileRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::UpdateUserProfile, this, std::move(request)));
+}
+
+void OpsWorksClient::UpdateUserProfileAsync(UpdateUserProfileRequest&& request, const UpdateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::UpdateUserProfileAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::UpdateUserProfileAsyncHelper(const UpdateUserProfileRequest& request, const UpdateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateUserProfile(request), context);
@@ -2317,7 +2997,7 @@ UpdateVolumeOutcome OpsWorksClient::UpdateVolume(const UpdateVolumeRequest& requ
 
 UpdateVolumeOutcomeCallable OpsWorksClient::UpdateVolumeCallable(const UpdateVolumeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateVolume(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateVolume(request); } );
 }
 
 void OpsWorksClient::UpdateVolumeAsync(const UpdateVolumeRequest& request, const UpdateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2325,8 +3005,387 @@ void OpsWorksClient::UpdateVolumeAsync(const UpdateVolumeRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->UpdateVolumeAsyncHelper( request, handler, context ); } );
 }
 
+UpdateVolumeOutcomeCallable OpsWorksClient::UpdateVolumeCallable(UpdateVolumeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&OpsWorksClient::UpdateVolume, this, std::move(request)));
+}
+
+void OpsWorksClient::UpdateVolumeAsync(UpdateVolumeRequest&& request, const UpdateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&OpsWorksClient::UpdateVolumeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void OpsWorksClient::UpdateVolumeAsyncHelper(const UpdateVolumeRequest& request, const UpdateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateVolume(request), context);
 }
 
+Paginator<OpsWorksClient, DescribeEcsClustersRequest, DescribeEcsClustersOutcome> OpsWorksClient::DescribeEcsClustersPaginator(const DescribeEcsClustersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<OpsWorksClient, DescribeEcsClustersRequest, DescribeEcsClustersOutcome>(this, &OpsWorksClient::DescribeEcsClusters, request,
+    [](const DescribeEcsClustersRequest& current, const DescribeEcsClustersOutcome& outcome, DescribeEcsClustersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<OpsWorksClient, AssignInstanceRequest, AssignInstanceOutcome> OpsWorksClient::AssignInstanceAwaitable(AssignInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::AssignInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, AssignVolumeRequest, AssignVolumeOutcome> OpsWorksClient::AssignVolumeAwaitable(AssignVolumeRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::AssignVolume, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, AssociateElasticIpRequest, AssociateElasticIpOutcome> OpsWorksClient::AssociateElasticIpAwaitable(AssociateElasticIpRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::AssociateElasticIp, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, AttachElasticLoadBalancerRequest, AttachElasticLoadBalancerOutcome> OpsWorksClient::AttachElasticLoadBalancerAwaitable(AttachElasticLoadBalancerRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::AttachElasticLoadBalancer, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, CloneStackRequest, CloneStackOutcome> OpsWorksClient::CloneStackAwaitable(CloneStackRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::CloneStack, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, CreateAppRequest, CreateAppOutcome> OpsWorksClient::CreateAppAwaitable(CreateAppRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::CreateApp, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, CreateDeploymentRequest, CreateDeploymentOutcome> OpsWorksClient::CreateDeploymentAwaitable(CreateDeploymentRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::CreateDeployment, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, CreateInstanceRequest, CreateInstanceOutcome> OpsWorksClient::CreateInstanceAwaitable(CreateInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::CreateInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, CreateLayerRequest, CreateLayerOutcome> OpsWorksClient::CreateLayerAwaitable(CreateLayerRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::CreateLayer, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, CreateStackRequest, CreateStackOutcome> OpsWorksClient::CreateStackAwaitable(CreateStackRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::CreateStack, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, CreateUserProfileRequest, CreateUserProfileOutcome> OpsWorksClient::CreateUserProfileAwaitable(CreateUserProfileRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::CreateUserProfile, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DeleteAppRequest, DeleteAppOutcome> OpsWorksClient::DeleteAppAwaitable(DeleteAppRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DeleteApp, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DeleteInstanceRequest, DeleteInstanceOutcome> OpsWorksClient::DeleteInstanceAwaitable(DeleteInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DeleteInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DeleteLayerRequest, DeleteLayerOutcome> OpsWorksClient::DeleteLayerAwaitable(DeleteLayerRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DeleteLayer, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DeleteStackRequest, DeleteStackOutcome> OpsWorksClient::DeleteStackAwaitable(DeleteStackRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DeleteStack, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DeleteUserProfileRequest, DeleteUserProfileOutcome> OpsWorksClient::DeleteUserProfileAwaitable(DeleteUserProfileRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DeleteUserProfile, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DeregisterEcsClusterRequest, DeregisterEcsClusterOutcome> OpsWorksClient::DeregisterEcsClusterAwaitable(DeregisterEcsClusterRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DeregisterEcsCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DeregisterElasticIpRequest, DeregisterElasticIpOutcome> OpsWorksClient::DeregisterElasticIpAwaitable(DeregisterElasticIpRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DeregisterElasticIp, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DeregisterInstanceRequest, DeregisterInstanceOutcome> OpsWorksClient::DeregisterInstanceAwaitable(DeregisterInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DeregisterInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DeregisterRdsDbInstanceRequest, DeregisterRdsDbInstanceOutcome> OpsWorksClient::DeregisterRdsDbInstanceAwaitable(DeregisterRdsDbInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DeregisterRdsDbInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DeregisterVolumeRequest, DeregisterVolumeOutcome> OpsWorksClient::DeregisterVolumeAwaitable(DeregisterVolumeRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DeregisterVolume, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeAgentVersionsRequest, DescribeAgentVersionsOutcome> OpsWorksClient::DescribeAgentVersionsAwaitable(DescribeAgentVersionsRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeAgentVersions, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeAppsRequest, DescribeAppsOutcome> OpsWorksClient::DescribeAppsAwaitable(DescribeAppsRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeApps, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeCommandsRequest, DescribeCommandsOutcome> OpsWorksClient::DescribeCommandsAwaitable(DescribeCommandsRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeCommands, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeDeploymentsRequest, DescribeDeploymentsOutcome> OpsWorksClient::DescribeDeploymentsAwaitable(DescribeDeploymentsRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeDeployments, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeEcsClustersRequest, DescribeEcsClustersOutcome> OpsWorksClient::DescribeEcsClustersAwaitable(DescribeEcsClustersRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeEcsClusters, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeElasticIpsRequest, DescribeElasticIpsOutcome> OpsWorksClient::DescribeElasticIpsAwaitable(DescribeElasticIpsRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeElasticIps, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeElasticLoadBalancersRequest, DescribeElasticLoadBalancersOutcome> OpsWorksClient::DescribeElasticLoadBalancersAwaitable(DescribeElasticLoadBalancersRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeElasticLoadBalancers, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeInstancesRequest, DescribeInstancesOutcome> OpsWorksClient::DescribeInstancesAwaitable(DescribeInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeLayersRequest, DescribeLayersOutcome> OpsWorksClient::DescribeLayersAwaitable(DescribeLayersRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeLayers, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeLoadBasedAutoScalingRequest, DescribeLoadBasedAutoScalingOutcome> OpsWorksClient::DescribeLoadBasedAutoScalingAwaitable(DescribeLoadBasedAutoScalingRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeLoadBasedAutoScaling, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, void, DescribeMyUserProfileOutcome> OpsWorksClient::DescribeMyUserProfileAwaitable() const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeMyUserProfile } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribePermissionsRequest, DescribePermissionsOutcome> OpsWorksClient::DescribePermissionsAwaitable(DescribePermissionsRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribePermissions, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeRaidArraysRequest, DescribeRaidArraysOutcome> OpsWorksClient::DescribeRaidArraysAwaitable(DescribeRaidArraysRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeRaidArrays, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeRdsDbInstancesRequest, DescribeRdsDbInstancesOutcome> OpsWorksClient::DescribeRdsDbInstancesAwaitable(DescribeRdsDbInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeRdsDbInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeServiceErrorsRequest, DescribeServiceErrorsOutcome> OpsWorksClient::DescribeServiceErrorsAwaitable(DescribeServiceErrorsRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeServiceErrors, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeStackProvisioningParametersRequest, DescribeStackProvisioningParametersOutcome> OpsWorksClient::DescribeStackProvisioningParametersAwaitable(DescribeStackProvisioningParametersRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeStackProvisioningParameters, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeStackSummaryRequest, DescribeStackSummaryOutcome> OpsWorksClient::DescribeStackSummaryAwaitable(DescribeStackSummaryRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeStackSummary, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeStacksRequest, DescribeStacksOutcome> OpsWorksClient::DescribeStacksAwaitable(DescribeStacksRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeStacks, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeTimeBasedAutoScalingRequest, DescribeTimeBasedAutoScalingOutcome> OpsWorksClient::DescribeTimeBasedAutoScalingAwaitable(DescribeTimeBasedAutoScalingRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeTimeBasedAutoScaling, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeUserProfilesRequest, DescribeUserProfilesOutcome> OpsWorksClient::DescribeUserProfilesAwaitable(DescribeUserProfilesRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeUserProfiles, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DescribeVolumesRequest, DescribeVolumesOutcome> OpsWorksClient::DescribeVolumesAwaitable(DescribeVolumesRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DescribeVolumes, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DetachElasticLoadBalancerRequest, DetachElasticLoadBalancerOutcome> OpsWorksClient::DetachElasticLoadBalancerAwaitable(DetachElasticLoadBalancerRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DetachElasticLoadBalancer, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, DisassociateElasticIpRequest, DisassociateElasticIpOutcome> OpsWorksClient::DisassociateElasticIpAwaitable(DisassociateElasticIpRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::DisassociateElasticIp, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, GetHostnameSuggestionRequest, GetHostnameSuggestionOutcome> OpsWorksClient::GetHostnameSuggestionAwaitable(GetHostnameSuggestionRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::GetHostnameSuggestion, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, GrantAccessRequest, GrantAccessOutcome> OpsWorksClient::GrantAccessAwaitable(GrantAccessRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::GrantAccess, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, RebootInstanceRequest, RebootInstanceOutcome> OpsWorksClient::RebootInstanceAwaitable(RebootInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::RebootInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, RegisterEcsClusterRequest, RegisterEcsClusterOutcome> OpsWorksClient::RegisterEcsClusterAwaitable(RegisterEcsClusterRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::RegisterEcsCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, RegisterElasticIpRequest, RegisterElasticIpOutcome> OpsWorksClient::RegisterElasticIpAwaitable(RegisterElasticIpRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::RegisterElasticIp, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, RegisterInstanceRequest, RegisterInstanceOutcome> OpsWorksClient::RegisterInstanceAwaitable(RegisterInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::RegisterInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, RegisterRdsDbInstanceRequest, RegisterRdsDbInstanceOutcome> OpsWorksClient::RegisterRdsDbInstanceAwaitable(RegisterRdsDbInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::RegisterRdsDbInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, RegisterVolumeRequest, RegisterVolumeOutcome> OpsWorksClient::RegisterVolumeAwaitable(RegisterVolumeRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::RegisterVolume, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, SetLoadBasedAutoScalingRequest, SetLoadBasedAutoScalingOutcome> OpsWorksClient::SetLoadBasedAutoScalingAwaitable(SetLoadBasedAutoScalingRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::SetLoadBasedAutoScaling, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, SetPermissionRequest, SetPermissionOutcome> OpsWorksClient::SetPermissionAwaitable(SetPermissionRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::SetPermission, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, SetTimeBasedAutoScalingRequest, SetTimeBasedAutoScalingOutcome> OpsWorksClient::SetTimeBasedAutoScalingAwaitable(SetTimeBasedAutoScalingRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::SetTimeBasedAutoScaling, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, StartInstanceRequest, StartInstanceOutcome> OpsWorksClient::StartInstanceAwaitable(StartInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::StartInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, StartStackRequest, StartStackOutcome> OpsWorksClient::StartStackAwaitable(StartStackRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::StartStack, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, StopInstanceRequest, StopInstanceOutcome> OpsWorksClient::StopInstanceAwaitable(StopInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::StopInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, StopStackRequest, StopStackOutcome> OpsWorksClient::StopStackAwaitable(StopStackRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::StopStack, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, UnassignInstanceRequest, UnassignInstanceOutcome> OpsWorksClient::UnassignInstanceAwaitable(UnassignInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::UnassignInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, UnassignVolumeRequest, UnassignVolumeOutcome> OpsWorksClient::UnassignVolumeAwaitable(UnassignVolumeRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::UnassignVolume, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, UpdateAppRequest, UpdateAppOutcome> OpsWorksClient::UpdateAppAwaitable(UpdateAppRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::UpdateApp, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, UpdateElasticIpRequest, UpdateElasticIpOutcome> OpsWorksClient::UpdateElasticIpAwaitable(UpdateElasticIpRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::UpdateElasticIp, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, UpdateInstanceRequest, UpdateInstanceOutcome> OpsWorksClient::UpdateInstanceAwaitable(UpdateInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::UpdateInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, UpdateLayerRequest, UpdateLayerOutcome> OpsWorksClient::UpdateLayerAwaitable(UpdateLayerRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::UpdateLayer, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, UpdateMyUserProfileRequest, UpdateMyUserProfileOutcome> OpsWorksClient::UpdateMyUserProfileAwaitable(UpdateMyUserProfileRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::UpdateMyUserProfile, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, UpdateRdsDbInstanceRequest, UpdateRdsDbInstanceOutcome> OpsWorksClient::UpdateRdsDbInstanceAwaitable(UpdateRdsDbInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::UpdateRdsDbInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, UpdateStackRequest, UpdateStackOutcome> OpsWorksClient::UpdateStackAwaitable(UpdateStackRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::UpdateStack, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, UpdateUserProfileRequest, UpdateUserProfileOutcome> OpsWorksClient::UpdateUserProfileAwaitable(UpdateUserProfileRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::UpdateUserProfile, std::move(request) } };
+}
+
+ClientOperationAwaitable<OpsWorksClient, UpdateVolumeRequest, UpdateVolumeOutcome> OpsWorksClient::UpdateVolumeAwaitable(UpdateVolumeRequest request) const
+{
+  return { m_executor.get(), { this, &OpsWorksClient::UpdateVolume, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,31 +29,35 @@ namespace Aws
       namespace AppAttributesKeysMapper
       {
 
-        static const int DocumentRoot_HASH = HashingUtils::HashString("DocumentRoot");
-        static const int RailsEnv_HASH = HashingUtils::HashString("RailsEnv");
-        static const int AutoBundleOnDeploy_HASH = HashingUtils::HashString("AutoBundleOnDeploy");
-        static const int AwsFlowRubySettings_HASH = HashingUtils::HashString("AwsFlowRubySettings");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int DocumentRoot_HASH = -1308945219;
+        static const int RailsEnv_HASH = 179367468;
+        static const int AutoBundleOnDeploy_HASH = 2027323895;
+        static const int AwsFlowRubySettings_HASH = -1373165208;
 
 
         AppAttributesKeys GetAppAttributesKeysForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DocumentRoot_HASH)
+          switch (hashCode)
           {
+          case DocumentRoot_HASH:
             return AppAttributesKeys::DocumentRoot;
-          }
-          else if (hashCode == RailsEnv_HASH)
-          {
+          case RailsEnv_HASH:
             return AppAttributesKeys::RailsEnv;
-          }
-          else if (hashCode == AutoBundleOnDeploy_HASH)
-          {
+          case AutoBundleOnDeploy_HASH:
             return AppAttributesKeys::AutoBundleOnDeploy;
-          }
-          else if (hashCode == AwsFlowRubySettings_HASH)
-          {
+          case AwsFlowRubySettings_HASH:
             return AppAttributesKeys::AwsFlowRubySettings;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
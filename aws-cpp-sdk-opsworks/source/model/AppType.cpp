@@ -29,46 +29,44 @@ namespace Aws
       namespace AppTypeMapper
       {
 
-        static const int aws_flow_ruby_HASH = HashingUtils::HashString("aws-flow-ruby");
-        static const int java_HASH = HashingUtils::HashString("java");
-        static const int rails_HASH = HashingUtils::HashString("rails");
-        static const int php_HASH = HashingUtils::HashString("php");
-        static const int nodejs_HASH = HashingUtils::HashString("nodejs");
-        static const int static__HASH = HashingUtils::HashString("static");
-        static const int other_HASH = HashingUtils::HashString("other");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int aws_flow_ruby_HASH = 1790298185;
+        static const int java_HASH = 3254818;
+        static const int rails_HASH = 108275489;
+        static const int php_HASH = 110968;
+        static const int nodejs_HASH = -1040170293;
+        static const int static__HASH = -892481938;
+        static const int other_HASH = 106069776;
 
 
         AppType GetAppTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == aws_flow_ruby_HASH)
+          switch (hashCode)
           {
+          case aws_flow_ruby_HASH:
             return AppType::aws_flow_ruby;
-          }
-          else if (hashCode == java_HASH)
-          {
+          case java_HASH:
             return AppType::java;
-          }
-          else if (hashCode == rails_HASH)
-          {
+          case rails_HASH:
             return AppType::rails;
-          }
-          else if (hashCode == php_HASH)
-          {
+          case php_HASH:
             return AppType::php;
-          }
-          else if (hashCode == nodejs_HASH)
-          {
+          case nodejs_HASH:
             return AppType::nodejs;
-          }
-          else if (hashCode == static__HASH)
-          {
+          case static__HASH:
             return AppType::static_;
-          }
-          else if (hashCode == other_HASH)
-          {
+          case other_HASH:
             return AppType::other;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace ArchitectureMapper
       {
 
-        static const int x86_64_HASH = HashingUtils::HashString("x86_64");
-        static const int i386_HASH = HashingUtils::HashString("i386");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int x86_64_HASH = -806050265;
+        static const int i386_HASH = 3178856;
 
 
         Architecture GetArchitectureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == x86_64_HASH)
+          switch (hashCode)
           {
+          case x86_64_HASH:
             return Architecture::x86_64;
-          }
-          else if (hashCode == i386_HASH)
-          {
+          case i386_HASH:
             return Architecture::i386;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
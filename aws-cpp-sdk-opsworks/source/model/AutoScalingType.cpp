@@ -29,21 +29,29 @@ namespace Aws
       namespace AutoScalingTypeMapper
       {
 
-        static const int load_HASH = HashingUtils::HashString("load");
-        static const int timer_HASH = HashingUtils::HashString("timer");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int load_HASH = 3327206;
+        static const int timer_HASH = 110364485;
 
 
         AutoScalingType GetAutoScalingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == load_HASH)
+          switch (hashCode)
           {
+          case load_HASH:
             return AutoScalingType::load;
-          }
-          else if (hashCode == timer_HASH)
-          {
+          case timer_HASH:
             return AutoScalingType::timer;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
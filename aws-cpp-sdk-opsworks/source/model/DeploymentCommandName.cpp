@@ -29,71 +29,59 @@ namespace Aws
       namespace DeploymentCommandNameMapper
       {
 
-        static const int install_dependencies_HASH = HashingUtils::HashString("install_dependencies");
-        static const int update_dependencies_HASH = HashingUtils::HashString("update_dependencies");
-        static const int update_custom_cookbooks_HASH = HashingUtils::HashString("update_custom_cookbooks");
-        static const int execute_recipes_HASH = HashingUtils::HashString("execute_recipes");
-        static const int configure_HASH = HashingUtils::HashString("configure");
-        static const int setup_HASH = HashingUtils::HashString("setup");
-        static const int deploy_HASH = HashingUtils::HashString("deploy");
-        static const int rollback_HASH = HashingUtils::HashString("rollback");
-        static const int start_HASH = HashingUtils::HashString("start");
-        static const int stop_HASH = HashingUtils::HashString("stop");
-        static const int restart_HASH = HashingUtils::HashString("restart");
-        static const int undeploy_HASH = HashingUtils::HashString("undeploy");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int install_dependencies_HASH = -2044365491;
+        static const int update_dependencies_HASH = 1843690719;
+        static const int update_custom_cookbooks_HASH = 1736450506;
+        static const int execute_recipes_HASH = 1892464091;
+        static const int configure_HASH = -804429082;
+        static const int setup_HASH = 109329021;
+        static const int deploy_HASH = -1335332633;
+        static const int rollback_HASH = -259719452;
+        static const int start_HASH = 109757538;
+        static const int stop_HASH = 3540994;
+        static const int restart_HASH = 1097506319;
+        static const int undeploy_HASH = -448829248;
 
 
         DeploymentCommandName GetDeploymentCommandNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == install_dependencies_HASH)
+          switch (hashCode)
           {
+          case install_dependencies_HASH:
             return DeploymentCommandName::install_dependencies;
-          }
-          else if (hashCode == update_dependencies_HASH)
-          {
+          case update_dependencies_HASH:
             return DeploymentCommandName::update_dependencies;
-          }
-          else if (hashCode == update_custom_cookbooks_HASH)
-          {
+          case update_custom_cookbooks_HASH:
             return DeploymentCommandName::update_custom_cookbooks;
-          }
-          else if (hashCode == execute_recipes_HASH)
-          {
+          case execute_recipes_HASH:
             return DeploymentCommandName::execute_recipes;
-          }
-          else if (hashCode == configure_HASH)
-          {
+          case configure_HASH:
             return DeploymentCommandName::configure;
-          }
-          else if (hashCode == setup_HASH)
-          {
+          case setup_HASH:
             return DeploymentCommandName::setup;
-          }
-          else if (hashCode == deploy_HASH)
-          {
+          case deploy_HASH:
             return DeploymentCommandName::deploy;
-          }
-          else if (hashCode == rollback_HASH)
-          {
+          case rollback_HASH:
             return DeploymentCommandName::rollback;
-          }
-          else if (hashCode == start_HASH)
-          {
+          case start_HASH:
             return DeploymentCommandName::start;
-          }
-          else if (hashCode == stop_HASH)
-          {
+          case stop_HASH:
             return DeploymentCommandName::stop;
-          }
-          else if (hashCode == restart_HASH)
-          {
+          case restart_HASH:
             return DeploymentCommandName::restart;
-          }
-          else if (hashCode == undeploy_HASH)
-          {
+          case undeploy_HASH:
             return DeploymentCommandName::undeploy;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,136 +29,98 @@ namespace Aws
       namespace LayerAttributesKeysMapper
       {
 
-        static const int EcsClusterArn_HASH = HashingUtils::HashString("EcsClusterArn");
-        static const int EnableHaproxyStats_HASH = HashingUtils::HashString("EnableHaproxyStats");
-        static const int HaproxyStatsUrl_HASH = HashingUtils::HashString("HaproxyStatsUrl");
-        static const int HaproxyStatsUser_HASH = HashingUtils::HashString("HaproxyStatsUser");
-        static const int HaproxyStatsPassword_HASH = HashingUtils::HashString("HaproxyStatsPassword");
-        static const int HaproxyHealthCheckUrl_HASH = HashingUtils::HashString("HaproxyHealthCheckUrl");
-        static const int HaproxyHealthCheckMethod_HASH = HashingUtils::HashString("HaproxyHealthCheckMethod");
-        static const int MysqlRootPassword_HASH = HashingUtils::HashString("MysqlRootPassword");
-        static const int MysqlRootPasswordUbiquitous_HASH = HashingUtils::HashString("MysqlRootPasswordUbiquitous");
-        static const int GangliaUrl_HASH = HashingUtils::HashString("GangliaUrl");
-        static const int GangliaUser_HASH = HashingUtils::HashString("GangliaUser");
-        static const int GangliaPassword_HASH = HashingUtils::HashString("GangliaPassword");
-        static const int MemcachedMemory_HASH = HashingUtils::HashString("MemcachedMemory");
-        static const int NodejsVersion_HASH = HashingUtils::HashString("NodejsVersion");
-        static const int RubyVersion_HASH = HashingUtils::HashString("RubyVersion");
-        static const int RubygemsVersion_HASH = HashingUtils::HashString("RubygemsVersion");
-        static const int ManageBundler_HASH = HashingUtils::HashString("ManageBundler");
-        static const int BundlerVersion_HASH = HashingUtils::HashString("BundlerVersion");
-        static const int RailsStack_HASH = HashingUtils::HashString("RailsStack");
-        static const int PassengerVersion_HASH = HashingUtils::HashString("PassengerVersion");
-        static const int Jvm_HASH = HashingUtils::HashString("Jvm");
-        static const int JvmVersion_HASH = HashingUtils::HashString("JvmVersion");
-        static const int JvmOptions_HASH = HashingUtils::HashString("JvmOptions");
-        static const int JavaAppServer_HASH = HashingUtils::HashString("JavaAppServer");
-        static const int JavaAppServerVersion_HASH = HashingUtils::HashString("JavaAppServerVersion");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int EcsClusterArn_HASH = -1427909800;
+        static const int EnableHaproxyStats_HASH = 182407629;
+        static const int HaproxyStatsUrl_HASH = 428832869;
+        static const int HaproxyStatsUser_HASH = 408917909;
+        static const int HaproxyStatsPassword_HASH = -2122092187;
+        static const int HaproxyHealthCheckUrl_HASH = -1459865064;
+        static const int HaproxyHealthCheckMethod_HASH = -241979496;
+        static const int MysqlRootPassword_HASH = -32108737;
+        static const int MysqlRootPasswordUbiquitous_HASH = -2037581759;
+        static const int GangliaUrl_HASH = -1745880514;
+        static const int GangliaUser_HASH = 1712279772;
+        static const int GangliaPassword_HASH = -1835585748;
+        static const int MemcachedMemory_HASH = -121286920;
+        static const int NodejsVersion_HASH = 317519725;
+        static const int RubyVersion_HASH = -1432330882;
+        static const int RubygemsVersion_HASH = -2143649030;
+        static const int ManageBundler_HASH = 1181753067;
+        static const int BundlerVersion_HASH = -47576408;
+        static const int RailsStack_HASH = 586535943;
+        static const int PassengerVersion_HASH = -1416551682;
+        static const int Jvm_HASH = 74881;
+        static const int JvmVersion_HASH = -1479299817;
+        static const int JvmOptions_HASH = 1214584541;
+        static const int JavaAppServer_HASH = -579689310;
+        static const int JavaAppServerVersion_HASH = -205982250;
 
 
         LayerAttributesKeys GetLayerAttributesKeysForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EcsClusterArn_HASH)
+          switch (hashCode)
           {
+          case EcsClusterArn_HASH:
             return LayerAttributesKeys::EcsClusterArn;
-          }
-          else if (hashCode == EnableHaproxyStats_HASH)
-          {
+          case EnableHaproxyStats_HASH:
             return LayerAttributesKeys::EnableHaproxyStats;
-          }
-          else if (hashCode == HaproxyStatsUrl_HASH)
-          {
+          case HaproxyStatsUrl_HASH:
             return LayerAttributesKeys::HaproxyStatsUrl;
-          }
-          else if (hashCode == HaproxyStatsUser_HASH)
-          {
+          case HaproxyStatsUser_HASH:
             return LayerAttributesKeys::HaproxyStatsUser;
-          }
-          else if (hashCode == HaproxyStatsPassword_HASH)
-          {
+          case HaproxyStatsPassword_HASH:
             return LayerAttributesKeys::HaproxyStatsPassword;
-          }
-          else if (hashCode == HaproxyHealthCheckUrl_HASH)
-          {
+          case HaproxyHealthCheckUrl_HASH:
             return LayerAttributesKeys::HaproxyHealthCheckUrl;
-          }
-          else if (hashCode == HaproxyHealthCheckMethod_HASH)
-          {
+          case HaproxyHealthCheckMethod_HASH:
             return LayerAttributesKeys::HaproxyHealthCheckMethod;
-          }
-          else if (hashCode == MysqlRootPassword_HASH)
-          {
+          case MysqlRootPassword_HASH:
             return LayerAttributesKeys::MysqlRootPassword;
-          }
-          else if (hashCode == MysqlRootPasswordUbiquitous_HASH)
-          {
+          case MysqlRootPasswordUbiquitous_HASH:
             return LayerAttributesKeys::MysqlRootPasswordUbiquitous;
-          }
-          else if (hashCode == GangliaUrl_HASH)
-          {
+          case GangliaUrl_HASH:
             return LayerAttributesKeys::GangliaUrl;
-          }
-          else if (hashCode == GangliaUser_HASH)
-          {
+          case GangliaUser_HASH:
             return LayerAttributesKeys::GangliaUser;
-          }
-          else if (hashCode == GangliaPassword_HASH)
-          {
+          case GangliaPassword_HASH:
             return LayerAttributesKeys::GangliaPassword;
-          }
-          else if (hashCode == MemcachedMemory_HASH)
-          {
+          case MemcachedMemory_HASH:
             return LayerAttributesKeys::MemcachedMemory;
-          }
-          else if (hashCode == NodejsVersion_HASH)
-          {
+          case NodejsVersion_HASH:
             return LayerAttributesKeys::NodejsVersion;
-          }
-          else if (hashCode == RubyVersion_HASH)
-          {
+          case RubyVersion_HASH:
             return LayerAttributesKeys::RubyVersion;
-          }
-          else if (hashCode == RubygemsVersion_HASH)
-          {
+          case RubygemsVersion_HASH:
             return LayerAttributesKeys::RubygemsVersion;
-          }
-          else if (hashCode == ManageBundler_HASH)
-          {
+          case ManageBundler_HASH:
             return LayerAttributesKeys::ManageBundler;
-          }
-          else if (hashCode == BundlerVersion_HASH)
-          {
+          case BundlerVersion_HASH:
             return LayerAttributesKeys::BundlerVersion;
-          }
-          else if (hashCode == RailsStack_HASH)
-          {
+          case RailsStack_HASH:
             return LayerAttributesKeys::RailsStack;
-          }
-          else if (hashCode == PassengerVersion_HASH)
-          {
+          case PassengerVersion_HASH:
             return LayerAttributesKeys::PassengerVersion;
-          }
-          else if (hashCode == Jvm_HASH)
-          {
+          case Jvm_HASH:
             return LayerAttributesKeys::Jvm;
-          }
-          else if (hashCode == JvmVersion_HASH)
-          {
+          case JvmVersion_HASH:
             return LayerAttributesKeys::JvmVersion;
-          }
-          else if (hashCode == JvmOptions_HASH)
-          {
+          case JvmOptions_HASH:
             return LayerAttributesKeys::JvmOptions;
-          }
-          else if (hashCode == JavaAppServer_HASH)
-          {
+          case JavaAppServer_HASH:
             return LayerAttributesKeys::JavaAppServer;
-          }
-          else if (hashCode == JavaAppServerVersion_HASH)
-          {
+          case JavaAppServerVersion_HASH:
             return LayerAttributesKeys::JavaAppServerVersion;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,71 +29,59 @@ namespace Aws
       namespace LayerTypeMapper
       {
 
-        static const int aws_flow_ruby_HASH = HashingUtils::HashString("aws-flow-ruby");
-        static const int ecs_cluster_HASH = HashingUtils::HashString("ecs-cluster");
-        static const int java_app_HASH = HashingUtils::HashString("java-app");
-        static const int lb_HASH = HashingUtils::HashString("lb");
-        static const int web_HASH = HashingUtils::HashString("web");
-        static const int php_app_HASH = HashingUtils::HashString("php-app");
-        static const int rails_app_HASH = HashingUtils::HashString("rails-app");
-        static const int nodejs_app_HASH = HashingUtils::HashString("nodejs-app");
-        static const int memcached_HASH = HashingUtils::HashString("memcached");
-        static const int db_master_HASH = HashingUtils::HashString("db-master");
-        static const int monitoring_master_HASH = HashingUtils::HashString("monitoring-master");
-        static const int custom_HASH = HashingUtils::HashString("custom");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int aws_flow_ruby_HASH = 1790298185;
+        static const int ecs_cluster_HASH = 1206851522;
+        static const int java_app_HASH = -582895626;
+        static const int lb_HASH = 3446;
+        static const int web_HASH = 117588;
+        static const int php_app_HASH = -596499380;
+        static const int rails_app_HASH = -739271307;
+        static const int nodejs_app_HASH = 1867633695;
+        static const int memcached_HASH = 1366717239;
+        static const int db_master_HASH = -1158406511;
+        static const int monitoring_master_HASH = -583725177;
+        static const int custom_HASH = -1349088399;
 
 
         LayerType GetLayerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == aws_flow_ruby_HASH)
+          switch (hashCode)
           {
+          case aws_flow_ruby_HASH:
             return LayerType::aws_flow_ruby;
-          }
-          else if (hashCode == ecs_cluster_HASH)
-          {
+          case ecs_cluster_HASH:
             return LayerType::ecs_cluster;
-          }
-          else if (hashCode == java_app_HASH)
-          {
+          case java_app_HASH:
             return LayerType::java_app;
-          }
-          else if (hashCode == lb_HASH)
-          {
+          case lb_HASH:
             return LayerType::lb;
-          }
-          else if (hashCode == web_HASH)
-          {
+          case web_HASH:
             return LayerType::web;
-          }
-          else if (hashCode == php_app_HASH)
-          {
+          case php_app_HASH:
             return LayerType::php_app;
-          }
-          else if (hashCode == rails_app_HASH)
-          {
+          case rails_app_HASH:
             return LayerType::rails_app;
-          }
-          else if (hashCode == nodejs_app_HASH)
-          {
+          case nodejs_app_HASH:
             return LayerType::nodejs_app;
-          }
-          else if (hashCode == memcached_HASH)
-          {
+          case memcached_HASH:
             return LayerType::memcached;
-          }
-          else if (hashCode == db_master_HASH)
-          {
+          case db_master_HASH:
             return LayerType::db_master;
-          }
-          else if (hashCode == monitoring_master_HASH)
-          {
+          case monitoring_master_HASH:
             return LayerType::monitoring_master;
-          }
-          else if (hashCode == custom_HASH)
-          {
+          case custom_HASH:
             return LayerType::custom;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace RootDeviceTypeMapper
       {
 
-        static const int ebs_HASH = HashingUtils::HashString("ebs");
-        static const int instance_store_HASH = HashingUtils::HashString("instance-store");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ebs_HASH = 100214;
+        static const int instance_store_HASH = -1339220567;
 
 
         RootDeviceType GetRootDeviceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ebs_HASH)
+          switch (hashCode)
           {
+          case ebs_HASH:
             return RootDeviceType::ebs;
-          }
-          else if (hashCode == instance_store_HASH)
-          {
+          case instance_store_HASH:
             return RootDeviceType::instance_store;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,31 +29,35 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int git_HASH = HashingUtils::HashString("git");
-        static const int svn_HASH = HashingUtils::HashString("svn");
-        static const int archive_HASH = HashingUtils::HashString("archive");
-        static const int s3_HASH = HashingUtils::HashString("s3");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int git_HASH = 102354;
+        static const int svn_HASH = 114283;
+        static const int archive_HASH = -748101438;
+        static const int s3_HASH = 3616;
 
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == git_HASH)
+          switch (hashCode)
           {
+          case git_HASH:
             return SourceType::git;
-          }
-          else if (hashCode == svn_HASH)
-          {
+          case svn_HASH:
             return SourceType::svn;
-          }
-          else if (hashCode == archive_HASH)
-          {
+          case archive_HASH:
             return SourceType::archive;
-          }
-          else if (hashCode == s3_HASH)
-          {
+          case s3_HASH:
             return SourceType::s3;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace StackAttributesKeysMapper
       {
 
-        static const int Color_HASH = HashingUtils::HashString("Color");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Color_HASH = 65290051;
 
 
         StackAttributesKeys GetStackAttributesKeysForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Color_HASH)
+          switch (hashCode)
           {
+          case Color_HASH:
             return StackAttributesKeys::Color;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
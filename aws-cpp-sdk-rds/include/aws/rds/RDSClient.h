@@ -98,6 +98,9 @@
 #include <aws/rds/model/RevokeDBSecurityGroupIngressResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -569,6 +572,18 @@ namespace Model
          */
         virtual void AddSourceIdentifierToSubscriptionAsync(const Model::AddSourceIdentifierToSubscriptionRequest& request, const AddSourceIdentifierToSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddSourceIdentifierToSubscriptionCallable(const Model::AddSourceIdentifierToSubscriptionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddSourceIdentifierToSubscriptionOutcomeCallable AddSourceIdentifierToSubscriptionCallable(Model::AddSourceIdentifierToSubscriptionRequest&& request) const;
+
+        /**
+         * Same as AddSourceIdentifierToSubscriptionAsync(const Model::AddSourceIdentifierToSubscriptionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddSourceIdentifierToSubscriptionAsync(Model::AddSourceIdentifierToSubscriptionRequest&& request, const AddSourceIdentifierToSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds metadata tags to an Amazon RDS resource. These tags can also be used
          * with cost allocation reporting to track cost associated with Amazon RDS
@@ -603,6 +618,18 @@ namespace Model
          */
         virtual void AddTagsToResourceAsync(const Model::AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToResourceCallable(const Model::AddTagsToResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsToResourceOutcomeCallable AddTagsToResourceCallable(Model::AddTagsToResourceRequest&& request) const;
+
+        /**
+         * Same as AddTagsToResourceAsync(const Model::AddTagsToResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsToResourceAsync(Model::AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Applies a pending maintenance action to a resource (for example, to a DB
          * instance).</p>
@@ -625,6 +652,18 @@ namespace Model
          */
         virtual void ApplyPendingMaintenanceActionAsync(const Model::ApplyPendingMaintenanceActionRequest& request, const ApplyPendingMaintenanceActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ApplyPendingMaintenanceActionCallable(const Model::ApplyPendingMaintenanceActionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ApplyPendingMaintenanceActionOutcomeCallable ApplyPendingMaintenanceActionCallable(Model::ApplyPendingMaintenanceActionRequest&& request) const;
+
+        /**
+         * Same as ApplyPendingMaintenanceActionAsync(const Model::ApplyPendingMaintenanceActionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ApplyPendingMaintenanceActionAsync(Model::ApplyPendingMaintenanceActionRequest&& request, const ApplyPendingMaintenanceActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables ingress to a DBSecurityGroup using one of two forms of authorization.
          * First, EC2 or VPC security groups can be added to the DBSecurityGroup if the
@@ -680,6 +719,18 @@ namespace Model
          */
         virtual void AuthorizeDBSecurityGroupIngressAsync(const Model::AuthorizeDBSecurityGroupIngressRequest& request, const AuthorizeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AuthorizeDBSecurityGroupIngressCallable(const Model::AuthorizeDBSecurityGroupIngressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AuthorizeDBSecurityGroupIngressOutcomeCallable AuthorizeDBSecurityGroupIngressCallable(Model::AuthorizeDBSecurityGroupIngressRequest&& request) const;
+
+        /**
+         * Same as AuthorizeDBSecurityGroupIngressAsync(const Model::AuthorizeDBSecurityGroupIngressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AuthorizeDBSecurityGroupIngressAsync(Model::AuthorizeDBSecurityGroupIngressRequest&& request, const AuthorizeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Copies the specified DB cluster parameter group.</p>
          */
@@ -699,6 +750,18 @@ namespace Model
          */
         virtual void CopyDBClusterParameterGroupAsync(const Model::CopyDBClusterParameterGroupRequest& request, const CopyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopyDBClusterParameterGroupCallable(const Model::CopyDBClusterParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CopyDBClusterParameterGroupOutcomeCallable CopyDBClusterParameterGroupCallable(Model::CopyDBClusterParameterGroupRequest&& request) const;
+
+        /**
+         * Same as CopyDBClusterParameterGroupAsync(const Model::CopyDBClusterParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CopyDBClusterParameterGroupAsync(Model::CopyDBClusterParameterGroupRequest&& request, const CopyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a snapshot of a DB cluster. For more information on Amazon Aurora,
          * see <a
@@ -727,6 +790,18 @@ namespace Model
          */
         virtual void CopyDBClusterSnapshotAsync(const Model::CopyDBClusterSnapshotRequest& request, const CopyDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopyDBClusterSnapshotCallable(const Model::CopyDBClusterSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CopyDBClusterSnapshotOutcomeCallable CopyDBClusterSnapshotCallable(Model::CopyDBClusterSnapshotRequest&& request) const;
+
+        /**
+         * Same as CopyDBClusterSnapshotAsync(const Model::CopyDBClusterSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CopyDBClusterSnapshotAsync(Model::CopyDBClusterSnapshotRequest&& request, const CopyDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Copies the specified DB parameter group.</p>
          */
@@ -746,6 +821,18 @@ namespace Model
          */
         virtual void CopyDBParameterGroupAsync(const Model::CopyDBParameterGroupRequest& request, const CopyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopyDBParameterGroupCallable(const Model::CopyDBParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CopyDBParameterGroupOutcomeCallable CopyDBParameterGroupCallable(Model::CopyDBParameterGroupRequest&& request) const;
+
+        /**
+         * Same as CopyDBParameterGroupAsync(const Model::CopyDBParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CopyDBParameterGroupAsync(Model::CopyDBParameterGroupRequest&& request, const CopyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Copies the specified DB snapshot. The source DB snapshot must be in the
          * "available" state.</p> <p>If you are copying from a shared manual DB snapshot,
@@ -774,6 +861,18 @@ namespace Model
          */
         virtual void CopyDBSnapshotAsync(const Model::CopyDBSnapshotRequest& request, const CopyDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopyDBSnapshotCallable(const Model::CopyDBSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CopyDBSnapshotOutcomeCallable CopyDBSnapshotCallable(Model::CopyDBSnapshotRequest&& request) const;
+
+        /**
+         * Same as CopyDBSnapshotAsync(const Model::CopyDBSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CopyDBSnapshotAsync(Model::CopyDBSnapshotRequest&& request, const CopyDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Copies the specified option group.</p>
          */
@@ -793,6 +892,18 @@ namespace Model
          */
         virtual void CopyOptionGroupAsync(const Model::CopyOptionGroupRequest& request, const CopyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopyOptionGroupCallable(const Model::CopyOptionGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CopyOptionGroupOutcomeCallable CopyOptionGroupCallable(Model::CopyOptionGroupRequest&& request) const;
+
+        /**
+         * Same as CopyOptionGroupAsync(const Model::CopyOptionGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CopyOptionGroupAsync(Model::CopyOptionGroupRequest&& request, const CopyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new Amazon Aurora DB cluster.</p> <p>You can use the
          * <code>ReplicationSourceIdentifier</code> parameter to create the DB cluster as a
@@ -827,6 +938,18 @@ namespace Model
          */
         virtual void CreateDBClusterAsync(const Model::CreateDBClusterRequest& request, const CreateDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBClusterCallable(const Model::CreateDBClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDBClusterOutcomeCallable CreateDBClusterCallable(Model::CreateDBClusterRequest&& request) const;
+
+        /**
+         * Same as CreateDBClusterAsync(const Model::CreateDBClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDBClusterAsync(Model::CreateDBClusterRequest&& request, const CreateDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new DB cluster parameter group.</p> <p>Parameters in a DB cluster
          * parameter group apply to all of the instances in a DB cluster.</p> <p> A DB
@@ -915,6 +1038,18 @@ namespace Model
          */
         virtual void CreateDBClusterParameterGroupAsync(const Model::CreateDBClusterParameterGroupRequest& request, const CreateDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBClusterParameterGroupCallable(const Model::CreateDBClusterParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDBClusterParameterGroupOutcomeCallable CreateDBClusterParameterGroupCallable(Model::CreateDBClusterParameterGroupRequest&& request) const;
+
+        /**
+         * Same as CreateDBClusterParameterGroupAsync(const Model::CreateDBClusterParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDBClusterParameterGroupAsync(Model::CreateDBClusterParameterGroupRequest&& request, const CreateDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a snapshot of a DB cluster. For more information on Amazon Aurora,
          * see <a
@@ -943,6 +1078,18 @@ namespace Model
          */
         virtual void CreateDBClusterSnapshotAsync(const Model::CreateDBClusterSnapshotRequest& request, const CreateDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBClusterSnapshotCallable(const Model::CreateDBClusterSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDBClusterSnapshotOutcomeCallable CreateDBClusterSnapshotCallable(Model::CreateDBClusterSnapshotRequest&& request) const;
+
+        /**
+         * Same as CreateDBClusterSnapshotAsync(const Model::CreateDBClusterSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDBClusterSnapshotAsync(Model::CreateDBClusterSnapshotRequest&& request, const CreateDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new DB instance.</p>
          */
@@ -962,6 +1109,18 @@ namespace Model
          */
         virtual void CreateDBInstanceAsync(const Model::CreateDBInstanceRequest& request, const CreateDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBInstanceCallable(const Model::CreateDBInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDBInstanceOutcomeCallable CreateDBInstanceCallable(Model::CreateDBInstanceRequest&& request) const;
+
+        /**
+         * Same as CreateDBInstanceAsync(const Model::CreateDBInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDBInstanceAsync(Model::CreateDBInstanceRequest&& request, const CreateDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a DB instance for a DB instance running MySQL, MariaDB, or PostgreSQL
          * that acts as a Read Replica of a source DB instance.</p> <p>All Read Replica DB
@@ -999,6 +1158,18 @@ namespace Model
          */
         virtual void CreateDBInstanceReadReplicaAsync(const Model::CreateDBInstanceReadReplicaRequest& request, const CreateDBInstanceReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBInstanceReadReplicaCallable(const Model::CreateDBInstanceReadReplicaRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDBInstanceReadReplicaOutcomeCallable CreateDBInstanceReadReplicaCallable(Model::CreateDBInstanceReadReplicaRequest&& request) const;
+
+        /**
+         * Same as CreateDBInstanceReadReplicaAsync(const Model::CreateDBInstanceReadReplicaRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDBInstanceReadReplicaAsync(Model::CreateDBInstanceReadReplicaRequest&& request, const CreateDBInstanceReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new DB parameter group.</p> <p> A DB parameter group is initially
          * created with the default parameters for the database engine used by the DB
@@ -1072,6 +1243,18 @@ namespace Model
          */
         virtual void CreateDBParameterGroupAsync(const Model::CreateDBParameterGroupRequest& request, const CreateDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBParameterGroupCallable(const Model::CreateDBParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDBParameterGroupOutcomeCallable CreateDBParameterGroupCallable(Model::CreateDBParameterGroupRequest&& request) const;
+
+        /**
+         * Same as CreateDBParameterGroupAsync(const Model::CreateDBParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDBParameterGroupAsync(Model::CreateDBParameterGroupRequest&& request, const CreateDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new DB security group. DB security groups control access to a DB
          * instance.</p>
@@ -1094,6 +1277,18 @@ namespace Model
          */
         virtual void CreateDBSecurityGroupAsync(const Model::CreateDBSecurityGroupRequest& request, const CreateDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBSecurityGroupCallable(const Model::CreateDBSecurityGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDBSecurityGroupOutcomeCallable CreateDBSecurityGroupCallable(Model::CreateDBSecurityGroupRequest&& request) const;
+
+        /**
+         * Same as CreateDBSecurityGroupAsync(const Model::CreateDBSecurityGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDBSecurityGroupAsync(Model::CreateDBSecurityGroupRequest&& request, const CreateDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a DBSnapshot. The source DBInstance must be in "available" state.</p>
          */
@@ -1113,6 +1308,18 @@ namespace Model
          */
         virtual void CreateDBSnapshotAsync(const Model::CreateDBSnapshotRequest& request, const CreateDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBSnapshotCallable(const Model::CreateDBSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDBSnapshotOutcomeCallable CreateDBSnapshotCallable(Model::CreateDBSnapshotRequest&& request) const;
+
+        /**
+         * Same as CreateDBSnapshotAsync(const Model::CreateDBSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDBSnapshotAsync(Model::CreateDBSnapshotRequest&& request, const CreateDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new DB subnet group. DB subnet groups must contain at least one
          * subnet in at least two AZs in the region.</p>
@@ -1135,6 +1342,18 @@ namespace Model
          */
         virtual void CreateDBSubnetGroupAsync(const Model::CreateDBSubnetGroupRequest& request, const CreateDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBSubnetGroupCallable(const Model::CreateDBSubnetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDBSubnetGroupOutcomeCallable CreateDBSubnetGroupCallable(Model::CreateDBSubnetGroupRequest&& request) const;
+
+        /**
+         * Same as CreateDBSubnetGroupAsync(const Model::CreateDBSubnetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDBSubnetGroupAsync(Model::CreateDBSubnetGroupRequest&& request, const CreateDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an RDS event notification subscription. This action requires a topic
          * ARN (Amazon Resource Name) created by either the RDS console, the SNS console,
@@ -1199,6 +1418,18 @@ namespace Model
          */
         virtual void CreateEventSubscriptionAsync(const Model::CreateEventSubscriptionRequest& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateEventSubscriptionCallable(const Model::CreateEventSubscriptionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateEventSubscriptionOutcomeCallable CreateEventSubscriptionCallable(Model::CreateEventSubscriptionRequest&& request) const;
+
+        /**
+         * Same as CreateEventSubscriptionAsync(const Model::CreateEventSubscriptionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateEventSubscriptionAsync(Model::CreateEventSubscriptionRequest&& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new option group. You can create up to 20 option groups.</p>
          */
@@ -1218,6 +1449,18 @@ namespace Model
          */
         virtual void CreateOptionGroupAsync(const Model::CreateOptionGroupRequest& request, const CreateOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateOptionGroupCallable(const Model::CreateOptionGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateOptionGroupOutcomeCallable CreateOptionGroupCallable(Model::CreateOptionGroupRequest&& request) const;
+
+        /**
+         * Same as CreateOptionGroupAsync(const Model::CreateOptionGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateOptionGroupAsync(Model::CreateOptionGroupRequest&& request, const CreateOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The DeleteDBCluster action deletes a previously provisioned DB cluster. When
          * you delete a DB cluster, all automated backups for that DB cluster are deleted
@@ -1252,6 +1495,18 @@ namespace Model
          */
         virtual void DeleteDBClusterAsync(const Model::DeleteDBClusterRequest& request, const DeleteDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBClusterCallable(const Model::DeleteDBClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDBClusterOutcomeCallable DeleteDBClusterCallable(Model::DeleteDBClusterRequest&& request) const;
+
+        /**
+         * Same as DeleteDBClusterAsync(const Model::DeleteDBClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDBClusterAsync(Model::DeleteDBClusterRequest&& request, const DeleteDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a specified DB cluster parameter group. The DB cluster parameter
          * group to be deleted cannot be associated with any DB clusters.</p> <p>For more
@@ -1283,6 +1538,18 @@ namespace Model
          */
         virtual void DeleteDBClusterParameterGroupAsync(const Model::DeleteDBClusterParameterGroupRequest& request, const DeleteDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBClusterParameterGroupCallable(const Model::DeleteDBClusterParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDBClusterParameterGroupOutcomeCallable DeleteDBClusterParameterGroupCallable(Model::DeleteDBClusterParameterGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteDBClusterParameterGroupAsync(const Model::DeleteDBClusterParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDBClusterParameterGroupAsync(Model::DeleteDBClusterParameterGroupRequest&& request, const DeleteDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a DB cluster snapshot. If the snapshot is being copied, the copy
          * operation is terminated.</p> <note> <p>The DB cluster snapshot must be in the
@@ -1317,6 +1584,18 @@ namespace Model
          */
         virtual void DeleteDBClusterSnapshotAsync(const Model::DeleteDBClusterSnapshotRequest& request, const DeleteDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBClusterSnapshotCallable(const Model::DeleteDBClusterSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDBClusterSnapshotOutcomeCallable DeleteDBClusterSnapshotCallable(Model::DeleteDBClusterSnapshotRequest&& request) const;
+
+        /**
+         * Same as DeleteDBClusterSnapshotAsync(const Model::DeleteDBClusterSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDBClusterSnapshotAsync(Model::DeleteDBClusterSnapshotRequest&& request, const DeleteDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The DeleteDBInstance action deletes a previously provisioned DB instance.
          * When you delete a DB instance, all automated backups for that instance are
@@ -1393,6 +1672,18 @@ namespace Model
          */
         virtual void DeleteDBInstanceAsync(const Model::DeleteDBInstanceRequest& request, const DeleteDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBInstanceCallable(const Model::DeleteDBInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDBInstanceOutcomeCallable DeleteDBInstanceCallable(Model::DeleteDBInstanceRequest&& request) const;
+
+        /**
+         * Same as DeleteDBInstanceAsync(const Model::DeleteDBInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDBInstanceAsync(Model::DeleteDBInstanceRequest&& request, const DeleteDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a specified DBParameterGroup. The DBParameterGroup to be deleted
          * cannot be associated with any DB instances.</p>
@@ -1415,6 +1706,18 @@ namespace Model
          */
         virtual void DeleteDBParameterGroupAsync(const Model::DeleteDBParameterGroupRequest& request, const DeleteDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBParameterGroupCallable(const Model::DeleteDBParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDBParameterGroupOutcomeCallable DeleteDBParameterGroupCallable(Model::DeleteDBParameterGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteDBParameterGroupAsync(const Model::DeleteDBParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDBParameterGroupAsync(Model::DeleteDBParameterGroupRequest&& request, const DeleteDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a DB security group.</p> <note> <p>The specified DB security group
          * must not be associated with any DB instances.</p> </note>
@@ -1437,6 +1740,18 @@ namespace Model
          */
         virtual void DeleteDBSecurityGroupAsync(const Model::DeleteDBSecurityGroupRequest& request, const DeleteDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBSecurityGroupCallable(const Model::DeleteDBSecurityGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDBSecurityGroupOutcomeCallable DeleteDBSecurityGroupCallable(Model::DeleteDBSecurityGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteDBSecurityGroupAsync(const Model::DeleteDBSecurityGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDBSecurityGroupAsync(Model::DeleteDBSecurityGroupRequest&& request, const DeleteDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a DBSnapshot. If the snapshot is being copied, the copy operation is
          * terminated.</p> <note> <p>The DBSnapshot must be in the <code>available</code>
@@ -1462,6 +1777,18 @@ namespace Model
          */
         virtual void DeleteDBSnapshotAsync(const Model::DeleteDBSnapshotRequest& request, const DeleteDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBSnapshotCallable(const Model::DeleteDBSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDBSnapshotOutcomeCallable DeleteDBSnapshotCallable(Model::DeleteDBSnapshotRequest&& request) const;
+
+        /**
+         * Same as DeleteDBSnapshotAsync(const Model::DeleteDBSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDBSnapshotAsync(Model::DeleteDBSnapshotRequest&& request, const DeleteDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a DB subnet group.</p> <note> <p>The specified database subnet group
          * must not be associated with any DB instances.</p> </note>
@@ -1484,6 +1811,18 @@ namespace Model
          */
         virtual void DeleteDBSubnetGroupAsync(const Model::DeleteDBSubnetGroupRequest& request, const DeleteDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBSubnetGroupCallable(const Model::DeleteDBSubnetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDBSubnetGroupOutcomeCallable DeleteDBSubnetGroupCallable(Model::DeleteDBSubnetGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteDBSubnetGroupAsync(const Model::DeleteDBSubnetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDBSubnetGroupAsync(Model::DeleteDBSubnetGroupRequest&& request, const DeleteDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an RDS event notification subscription.</p>
          */
@@ -1503,6 +1842,18 @@ namespace Model
          */
         virtual void DeleteEventSubscriptionAsync(const Model::DeleteEventSubscriptionRequest& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteEventSubscriptionCallable(const Model::DeleteEventSubscriptionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteEventSubscriptionOutcomeCallable DeleteEventSubscriptionCallable(Model::DeleteEventSubscriptionRequest&& request) const;
+
+        /**
+         * Same as DeleteEventSubscriptionAsync(const Model::DeleteEventSubscriptionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteEventSubscriptionAsync(Model::DeleteEventSubscriptionRequest&& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an existing option group.</p>
          */
@@ -1522,6 +1873,18 @@ namespace Model
          */
         virtual void DeleteOptionGroupAsync(const Model::DeleteOptionGroupRequest& request, const DeleteOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteOptionGroupCallable(const Model::DeleteOptionGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteOptionGroupOutcomeCallable DeleteOptionGroupCallable(Model::DeleteOptionGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteOptionGroupAsync(const Model::DeleteOptionGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteOptionGroupAsync(Model::DeleteOptionGroupRequest&& request, const DeleteOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all of the attributes for a customer account. The attributes include
          * Amazon RDS quotas for the account, such as the number of DB instances allowed.
@@ -1553,6 +1916,18 @@ namespace Model
          */
         virtual void DescribeAccountAttributesAsync(const Model::DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAccountAttributesCallable(const Model::DescribeAccountAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAccountAttributesOutcomeCallable DescribeAccountAttributesCallable(Model::DescribeAccountAttributesRequest&& request) const;
+
+        /**
+         * Same as DescribeAccountAttributesAsync(const Model::DescribeAccountAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAccountAttributesAsync(Model::DescribeAccountAttributesRequest&& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the set of CA certificates provided by Amazon RDS for this AWS
          * account.</p>
@@ -1575,6 +1950,18 @@ namespace Model
          */
         virtual void DescribeCertificatesAsync(const Model::DescribeCertificatesRequest& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCertificatesCallable(const Model::DescribeCertificatesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCertificatesOutcomeCallable DescribeCertificatesCallable(Model::DescribeCertificatesRequest&& request) const;
+
+        /**
+         * Same as DescribeCertificatesAsync(const Model::DescribeCertificatesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCertificatesAsync(Model::DescribeCertificatesRequest&& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of <code>DBClusterParameterGroup</code> descriptions. If a
          * <code>DBClusterParameterGroupName</code> parameter is specified, the list will
@@ -1609,6 +1996,18 @@ namespace Model
          */
         virtual void DescribeDBClusterParameterGroupsAsync(const Model::DescribeDBClusterParameterGroupsRequest& request, const DescribeDBClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBClusterParameterGroupsCallable(const Model::DescribeDBClusterParameterGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDBClusterParameterGroupsOutcomeCallable DescribeDBClusterParameterGroupsCallable(Model::DescribeDBClusterParameterGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeDBClusterParameterGroupsAsync(const Model::DescribeDBClusterParameterGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDBClusterParameterGroupsAsync(Model::DescribeDBClusterParameterGroupsRequest&& request, const DescribeDBClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the detailed parameter list for a particular DB cluster parameter
          * group.</p> <p>For more information on Amazon Aurora, see <a
@@ -1637,6 +2036,18 @@ namespace Model
          */
         virtual void DescribeDBClusterParametersAsync(const Model::DescribeDBClusterParametersRequest& request, const DescribeDBClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBClusterParametersCallable(const Model::DescribeDBClusterParametersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDBClusterParametersOutcomeCallable DescribeDBClusterParametersCallable(Model::DescribeDBClusterParametersRequest&& request) const;
+
+        /**
+         * Same as DescribeDBClusterParametersAsync(const Model::DescribeDBClusterParametersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDBClusterParametersAsync(Model::DescribeDBClusterParametersRequest&& request, const DescribeDBClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of DB cluster snapshot attribute names and values for a manual
          * DB cluster snapshot.</p> <p>When sharing snapshots with other AWS accounts,
@@ -1686,6 +2097,18 @@ namespace Model
          */
         virtual void DescribeDBClusterSnapshotAttributesAsync(const Model::DescribeDBClusterSnapshotAttributesRequest& request, const DescribeDBClusterSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBClusterSnapshotAttributesCallable(const Model::DescribeDBClusterSnapshotAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDBClusterSnapshotAttributesOutcomeCallable DescribeDBClusterSnapshotAttributesCallable(Model::DescribeDBClusterSnapshotAttributesRequest&& request) const;
+
+        /**
+         * Same as DescribeDBClusterSnapshotAttributesAsync(const Model::DescribeDBClusterSnapshotAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDBClusterSnapshotAttributesAsync(Model::DescribeDBClusterSnapshotAttributesRequest&& request, const DescribeDBClusterSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about DB cluster snapshots. This API action supports
          * pagination.</p> <p>For more information on Amazon Aurora, see <a
@@ -1714,6 +2137,18 @@ namespace Model
          */
         virtual void DescribeDBClusterSnapshotsAsync(const Model::DescribeDBClusterSnapshotsRequest& request, const DescribeDBClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBClusterSnapshotsCallable(const Model::DescribeDBClusterSnapshotsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDBClusterSnapshotsOutcomeCallable DescribeDBClusterSnapshotsCallable(Model::DescribeDBClusterSnapshotsRequest&& request) const;
+
+        /**
+         * Same as DescribeDBClusterSnapshotsAsync(const Model::DescribeDBClusterSnapshotsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDBClusterSnapshotsAsync(Model::DescribeDBClusterSnapshotsRequest&& request, const DescribeDBClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about provisioned Aurora DB clusters. This API supports
          * pagination.</p> <p>For more information on Amazon Aurora, see <a
@@ -1742,6 +2177,18 @@ namespace Model
          */
         virtual void DescribeDBClustersAsync(const Model::DescribeDBClustersRequest& request, const DescribeDBClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBClustersCallable(const Model::DescribeDBClustersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDBClustersOutcomeCallable DescribeDBClustersCallable(Model::DescribeDBClustersRequest&& request) const;
+
+        /**
+         * Same as DescribeDBClustersAsync(const Model::DescribeDBClustersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDBClustersAsync(Model::DescribeDBClustersRequest&& request, const DescribeDBClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of the available DB engines.</p>
          */
@@ -1761,6 +2208,18 @@ namespace Model
          */
         virtual void DescribeDBEngineVersionsAsync(const Model::DescribeDBEngineVersionsRequest& request, const DescribeDBEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBEngineVersionsCallable(const Model::DescribeDBEngineVersionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDBEngineVersionsOutcomeCallable DescribeDBEngineVersionsCallable(Model::DescribeDBEngineVersionsRequest&& request) const;
+
+        /**
+         * Same as DescribeDBEngineVersionsAsync(const Model::DescribeDBEngineVersionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDBEngineVersionsAsync(Model::DescribeDBEngineVersionsRequest&& request, const DescribeDBEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about provisioned RDS instances. This API supports
          * pagination.</p>
@@ -1783,6 +2242,18 @@ namespace Model
          */
         virtual void DescribeDBInstancesAsync(const Model::DescribeDBInstancesRequest& request, const DescribeDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBInstancesCallable(const Model::DescribeDBInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDBInstancesOutcomeCallable DescribeDBInstancesCallable(Model::DescribeDBInstancesRequest&& request) const;
+
+        /**
+         * Same as DescribeDBInstancesAsync(const Model::DescribeDBInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDBInstancesAsync(Model::DescribeDBInstancesRequest&& request, const DescribeDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of DB log files for the DB instance.</p>
          */
@@ -1802,6 +2273,18 @@ namespace Model
          */
         virtual void DescribeDBLogFilesAsync(const Model::DescribeDBLogFilesRequest& request, const DescribeDBLogFilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBLogFilesCallable(const Model::DescribeDBLogFilesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDBLogFilesOutcomeCallable DescribeDBLogFilesCallable(Model::DescribeDBLogFilesRequest&& request) const;
+
+        /**
+         * Same as DescribeDBLogFilesAsync(const Model::DescribeDBLogFilesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDBLogFilesAsync(Model::DescribeDBLogFilesRequest&& request, const DescribeDBLogFilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of <code>DBParameterGroup</code> descriptions. If a
          * <code>DBParameterGroupName</code> is specified, the list will contain only the
@@ -1827,6 +2310,18 @@ namespace Model
          */
         virtual void DescribeDBParameterGroupsAsync(const Model::DescribeDBParameterGroupsRequest& request, const DescribeDBParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBParameterGroupsCallable(const Model::DescribeDBParameterGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDBParameterGroupsOutcomeCallable DescribeDBParameterGroupsCallable(Model::DescribeDBParameterGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeDBParameterGroupsAsync(const Model::DescribeDBParameterGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDBParameterGroupsAsync(Model::DescribeDBParameterGroupsRequest&& request, const DescribeDBParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the detailed parameter list for a particular DB parameter group.</p>
          */
@@ -1846,6 +2341,18 @@ namespace Model
          */
         virtual void DescribeDBParametersAsync(const Model::DescribeDBParametersRequest& request, const DescribeDBParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBParametersCallable(const Model::DescribeDBParametersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDBParametersOutcomeCallable DescribeDBParametersCallable(Model::DescribeDBParametersRequest&& request) const;
+
+        /**
+         * Same as DescribeDBParametersAsync(const Model::DescribeDBParametersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDBParametersAsync(Model::DescribeDBParametersRequest&& request, const DescribeDBParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of <code>DBSecurityGroup</code> descriptions. If a
          * <code>DBSecurityGroupName</code> is specified, the list will contain only the
@@ -1872,10 +2379,22 @@ namespace Model
         virtual void DescribeDBSecurityGroupsAsync(const Model::DescribeDBSecurityGroupsRequest& request, const DescribeDBSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
         /**
-         * <p>Returns a list of DB snapshot attribute names and values for a manual DB
-         * snapshot.</p> <p>When sharing snapshots with other AWS accounts,
-         * <code>DescribeDBSnapshotAttributes</code> returns the <code>restore</code>
-         * attribute and a list of IDs for the AWS accounts that are authorized to copy or
+         * Same as DescribeDBSecurityGroupsCallable(const Model::DescribeDBSecurityGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDBSecurityGroupsOutcomeCallable DescribeDBSecurityGroupsCallable(Model::DescribeDBSecurityGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeDBSecurityGroupsAsync(const Model::DescribeDBSecurityGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDBSecurityGroupsAsync(Model::DescribeDBSecurityGroupsRequest&& request, const DescribeDBSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+        /**
+         * <p>Returns a list of DB snapshot attribute names and values for a manual DB
+         * snapshot.</p> <p>When sharing snapshots with other AWS accounts,
+         * <code>DescribeDBSnapshotAttributes</code> returns the <code>restore</code>
+         * attribute and a list of IDs for the AWS accounts that are authorized to copy or
          * restore the manual DB snapshot. If <code>all</code> is included in the list of
          * values for the <code>restore</code> attribute, then the manual DB snapshot is
          * public and can be copied or restored by all AWS accounts.</p> <p>To add or
@@ -1917,6 +2436,18 @@ namespace Model
          */
         virtual void DescribeDBSnapshotAttributesAsync(const Model::DescribeDBSnapshotAttributesRequest& request, const DescribeDBSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBSnapshotAttributesCallable(const Model::DescribeDBSnapshotAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDBSnapshotAttributesOutcomeCallable DescribeDBSnapshotAttributesCallable(Model::DescribeDBSnapshotAttributesRequest&& request) const;
+
+        /**
+         * Same as DescribeDBSnapshotAttributesAsync(const Model::DescribeDBSnapshotAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDBSnapshotAttributesAsync(Model::DescribeDBSnapshotAttributesRequest&& request, const DescribeDBSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about DB snapshots. This API action supports
          * pagination.</p>
@@ -1939,6 +2470,18 @@ namespace Model
          */
         virtual void DescribeDBSnapshotsAsync(const Model::DescribeDBSnapshotsRequest& request, const DescribeDBSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBSnapshotsCallable(const Model::DescribeDBSnapshotsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDBSnapshotsOutcomeCallable DescribeDBSnapshotsCallable(Model::DescribeDBSnapshotsRequest&& request) const;
+
+        /**
+         * Same as DescribeDBSnapshotsAsync(const Model::DescribeDBSnapshotsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDBSnapshotsAsync(Model::DescribeDBSnapshotsRequest&& request, const DescribeDBSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of DBSubnetGroup descriptions. If a DBSubnetGroupName is
          * specified, the list will contain only the descriptions of the specified
@@ -1970,6 +2513,18 @@ namespace Model
          */
         virtual void DescribeDBSubnetGroupsAsync(const Model::DescribeDBSubnetGroupsRequest& request, const DescribeDBSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBSubnetGroupsCallable(const Model::DescribeDBSubnetGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDBSubnetGroupsOutcomeCallable DescribeDBSubnetGroupsCallable(Model::DescribeDBSubnetGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeDBSubnetGroupsAsync(const Model::DescribeDBSubnetGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDBSubnetGroupsAsync(Model::DescribeDBSubnetGroupsRequest&& request, const DescribeDBSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the default engine and system parameter information for the cluster
          * database engine.</p> <p>For more information on Amazon Aurora, see <a
@@ -1998,6 +2553,18 @@ namespace Model
          */
         virtual void DescribeEngineDefaultClusterParametersAsync(const Model::DescribeEngineDefaultClusterParametersRequest& request, const DescribeEngineDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEngineDefaultClusterParametersCallable(const Model::DescribeEngineDefaultClusterParametersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEngineDefaultClusterParametersOutcomeCallable DescribeEngineDefaultClusterParametersCallable(Model::DescribeEngineDefaultClusterParametersRequest&& request) const;
+
+        /**
+         * Same as DescribeEngineDefaultClusterParametersAsync(const Model::DescribeEngineDefaultClusterParametersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEngineDefaultClusterParametersAsync(Model::DescribeEngineDefaultClusterParametersRequest&& request, const DescribeEngineDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the default engine and system parameter information for the specified
          * database engine.</p>
@@ -2020,6 +2587,18 @@ namespace Model
          */
         virtual void DescribeEngineDefaultParametersAsync(const Model::DescribeEngineDefaultParametersRequest& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEngineDefaultParametersCallable(const Model::DescribeEngineDefaultParametersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEngineDefaultParametersOutcomeCallable DescribeEngineDefaultParametersCallable(Model::DescribeEngineDefaultParametersRequest&& request) const;
+
+        /**
+         * Same as DescribeEngineDefaultParametersAsync(const Model::DescribeEngineDefaultParametersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEngineDefaultParametersAsync(Model::DescribeEngineDefaultParametersRequest&& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Displays a list of categories for all event source types, or, if specified,
          * for a specified source type. You can see a list of the event categories and
@@ -2051,6 +2630,18 @@ namespace Model
          */
         virtual void DescribeEventCategoriesAsync(const Model::DescribeEventCategoriesRequest& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventCategoriesCallable(const Model::DescribeEventCategoriesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEventCategoriesOutcomeCallable DescribeEventCategoriesCallable(Model::DescribeEventCategoriesRequest&& request) const;
+
+        /**
+         * Same as DescribeEventCategoriesAsync(const Model::DescribeEventCategoriesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEventCategoriesAsync(Model::DescribeEventCategoriesRequest&& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all the subscription descriptions for a customer account. The
          * description for a subscription includes SubscriptionName, SNSTopicARN,
@@ -2079,6 +2670,18 @@ namespace Model
          */
         virtual void DescribeEventSubscriptionsAsync(const Model::DescribeEventSubscriptionsRequest& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventSubscriptionsCallable(const Model::DescribeEventSubscriptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEventSubscriptionsOutcomeCallable DescribeEventSubscriptionsCallable(Model::DescribeEventSubscriptionsRequest&& request) const;
+
+        /**
+         * Same as DescribeEventSubscriptionsAsync(const Model::DescribeEventSubscriptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEventSubscriptionsAsync(Model::DescribeEventSubscriptionsRequest&& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns events related to DB instances, DB security groups, DB snapshots, and
          * DB parameter groups for the past 14 days. Events specific to a particular DB
@@ -2110,6 +2713,18 @@ namespace Model
          */
         virtual void DescribeEventsAsync(const Model::DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventsCallable(const Model::DescribeEventsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEventsOutcomeCallable DescribeEventsCallable(Model::DescribeEventsRequest&& request) const;
+
+        /**
+         * Same as DescribeEventsAsync(const Model::DescribeEventsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEventsAsync(Model::DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes all available options.</p>
          */
@@ -2129,6 +2744,18 @@ namespace Model
          */
         virtual void DescribeOptionGroupOptionsAsync(const Model::DescribeOptionGroupOptionsRequest& request, const DescribeOptionGroupOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeOptionGroupOptionsCallable(const Model::DescribeOptionGroupOptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeOptionGroupOptionsOutcomeCallable DescribeOptionGroupOptionsCallable(Model::DescribeOptionGroupOptionsRequest&& request) const;
+
+        /**
+         * Same as DescribeOptionGroupOptionsAsync(const Model::DescribeOptionGroupOptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeOptionGroupOptionsAsync(Model::DescribeOptionGroupOptionsRequest&& request, const DescribeOptionGroupOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the available option groups.</p>
          */
@@ -2148,6 +2775,18 @@ namespace Model
          */
         virtual void DescribeOptionGroupsAsync(const Model::DescribeOptionGroupsRequest& request, const DescribeOptionGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeOptionGroupsCallable(const Model::DescribeOptionGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeOptionGroupsOutcomeCallable DescribeOptionGroupsCallable(Model::DescribeOptionGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeOptionGroupsAsync(const Model::DescribeOptionGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeOptionGroupsAsync(Model::DescribeOptionGroupsRequest&& request, const DescribeOptionGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of orderable DB instance options for the specified engine.</p>
          */
@@ -2167,6 +2806,18 @@ namespace Model
          */
         virtual void DescribeOrderableDBInstanceOptionsAsync(const Model::DescribeOrderableDBInstanceOptionsRequest& request, const DescribeOrderableDBInstanceOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeOrderableDBInstanceOptionsCallable(const Model::DescribeOrderableDBInstanceOptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeOrderableDBInstanceOptionsOutcomeCallable DescribeOrderableDBInstanceOptionsCallable(Model::DescribeOrderableDBInstanceOptionsRequest&& request) const;
+
+        /**
+         * Same as DescribeOrderableDBInstanceOptionsAsync(const Model::DescribeOrderableDBInstanceOptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeOrderableDBInstanceOptionsAsync(Model::DescribeOrderableDBInstanceOptionsRequest&& request, const DescribeOrderableDBInstanceOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of resources (for example, DB instances) that have at least
          * one pending maintenance action.</p>
@@ -2189,6 +2840,18 @@ namespace Model
          */
         virtual void DescribePendingMaintenanceActionsAsync(const Model::DescribePendingMaintenanceActionsRequest& request, const DescribePendingMaintenanceActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribePendingMaintenanceActionsCallable(const Model::DescribePendingMaintenanceActionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribePendingMaintenanceActionsOutcomeCallable DescribePendingMaintenanceActionsCallable(Model::DescribePendingMaintenanceActionsRequest&& request) const;
+
+        /**
+         * Same as DescribePendingMaintenanceActionsAsync(const Model::DescribePendingMaintenanceActionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribePendingMaintenanceActionsAsync(Model::DescribePendingMaintenanceActionsRequest&& request, const DescribePendingMaintenanceActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about reserved DB instances for this account, or about a
          * specified reserved DB instance.</p>
@@ -2211,6 +2874,18 @@ namespace Model
          */
         virtual void DescribeReservedDBInstancesAsync(const Model::DescribeReservedDBInstancesRequest& request, const DescribeReservedDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedDBInstancesCallable(const Model::DescribeReservedDBInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReservedDBInstancesOutcomeCallable DescribeReservedDBInstancesCallable(Model::DescribeReservedDBInstancesRequest&& request) const;
+
+        /**
+         * Same as DescribeReservedDBInstancesAsync(const Model::DescribeReservedDBInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReservedDBInstancesAsync(Model::DescribeReservedDBInstancesRequest&& request, const DescribeReservedDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists available reserved DB instance offerings.</p>
          */
@@ -2230,6 +2905,18 @@ namespace Model
          */
         virtual void DescribeReservedDBInstancesOfferingsAsync(const Model::DescribeReservedDBInstancesOfferingsRequest& request, const DescribeReservedDBInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedDBInstancesOfferingsCallable(const Model::DescribeReservedDBInstancesOfferingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReservedDBInstancesOfferingsOutcomeCallable DescribeReservedDBInstancesOfferingsCallable(Model::DescribeReservedDBInstancesOfferingsRequest&& request) const;
+
+        /**
+         * Same as DescribeReservedDBInstancesOfferingsAsync(const Model::DescribeReservedDBInstancesOfferingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReservedDBInstancesOfferingsAsync(Model::DescribeReservedDBInstancesOfferingsRequest&& request, const DescribeReservedDBInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Downloads all or a portion of the specified log file, up to 1 MB in size.</p>
          */
@@ -2249,6 +2936,18 @@ namespace Model
          */
         virtual void DownloadDBLogFilePortionAsync(const Model::DownloadDBLogFilePortionRequest& request, const DownloadDBLogFilePortionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DownloadDBLogFilePortionCallable(const Model::DownloadDBLogFilePortionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DownloadDBLogFilePortionOutcomeCallable DownloadDBLogFilePortionCallable(Model::DownloadDBLogFilePortionRequest&& request) const;
+
+        /**
+         * Same as DownloadDBLogFilePortionAsync(const Model::DownloadDBLogFilePortionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DownloadDBLogFilePortionAsync(Model::DownloadDBLogFilePortionRequest&& request, const DownloadDBLogFilePortionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Forces a failover for a DB cluster.</p> <p>A failover for a DB cluster
          * promotes one of the read-only instances in the DB cluster to the master DB
@@ -2298,6 +2997,18 @@ namespace Model
          */
         virtual void FailoverDBClusterAsync(const Model::FailoverDBClusterRequest& request, const FailoverDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as FailoverDBClusterCallable(const Model::FailoverDBClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::FailoverDBClusterOutcomeCallable FailoverDBClusterCallable(Model::FailoverDBClusterRequest&& request) const;
+
+        /**
+         * Same as FailoverDBClusterAsync(const Model::FailoverDBClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void FailoverDBClusterAsync(Model::FailoverDBClusterRequest&& request, const FailoverDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all tags on an Amazon RDS resource.</p> <p>For an overview on tagging
          * an Amazon RDS resource, see <a
@@ -2326,6 +3037,18 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourceCallable(const Model::ListTagsForResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(Model::ListTagsForResourceRequest&& request) const;
+
+        /**
+         * Same as ListTagsForResourceAsync(const Model::ListTagsForResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsForResourceAsync(Model::ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modify a setting for an Amazon Aurora DB cluster. You can change one or more
          * database configuration parameters by specifying these parameters and the new
@@ -2357,6 +3080,18 @@ namespace Model
          */
         virtual void ModifyDBClusterAsync(const Model::ModifyDBClusterRequest& request, const ModifyDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyDBClusterCallable(const Model::ModifyDBClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyDBClusterOutcomeCallable ModifyDBClusterCallable(Model::ModifyDBClusterRequest&& request) const;
+
+        /**
+         * Same as ModifyDBClusterAsync(const Model::ModifyDBClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyDBClusterAsync(Model::ModifyDBClusterRequest&& request, const ModifyDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies the parameters of a DB cluster parameter group. To modify more than
          * one parameter, submit a list of the following: <code>ParameterName</code>,
@@ -2436,6 +3171,18 @@ namespace Model
          */
         virtual void ModifyDBClusterParameterGroupAsync(const Model::ModifyDBClusterParameterGroupRequest& request, const ModifyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyDBClusterParameterGroupCallable(const Model::ModifyDBClusterParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyDBClusterParameterGroupOutcomeCallable ModifyDBClusterParameterGroupCallable(Model::ModifyDBClusterParameterGroupRequest&& request) const;
+
+        /**
+         * Same as ModifyDBClusterParameterGroupAsync(const Model::ModifyDBClusterParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyDBClusterParameterGroupAsync(Model::ModifyDBClusterParameterGroupRequest&& request, const ModifyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds an attribute and values to, or removes an attribute and values from, a
          * manual DB cluster snapshot.</p> <p>To share a manual DB cluster snapshot with
@@ -2491,6 +3238,18 @@ namespace Model
          */
         virtual void ModifyDBClusterSnapshotAttributeAsync(const Model::ModifyDBClusterSnapshotAttributeRequest& request, const ModifyDBClusterSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyDBClusterSnapshotAttributeCallable(const Model::ModifyDBClusterSnapshotAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyDBClusterSnapshotAttributeOutcomeCallable ModifyDBClusterSnapshotAttributeCallable(Model::ModifyDBClusterSnapshotAttributeRequest&& request) const;
+
+        /**
+         * Same as ModifyDBClusterSnapshotAttributeAsync(const Model::ModifyDBClusterSnapshotAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyDBClusterSnapshotAttributeAsync(Model::ModifyDBClusterSnapshotAttributeRequest&& request, const ModifyDBClusterSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies settings for a DB instance. You can change one or more database
          * configuration parameters by specifying these parameters and the new values in
@@ -2516,6 +3275,18 @@ namespace Model
          */
         virtual void ModifyDBInstanceAsync(const Model::ModifyDBInstanceRequest& request, const ModifyDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyDBInstanceCallable(const Model::ModifyDBInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyDBInstanceOutcomeCallable ModifyDBInstanceCallable(Model::ModifyDBInstanceRequest&& request) const;
+
+        /**
+         * Same as ModifyDBInstanceAsync(const Model::ModifyDBInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyDBInstanceAsync(Model::ModifyDBInstanceRequest&& request, const ModifyDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies the parameters of a DB parameter group. To modify more than one
          * parameter, submit a list of the following: <code>ParameterName</code>,
@@ -2583,6 +3354,18 @@ namespace Model
          */
         virtual void ModifyDBParameterGroupAsync(const Model::ModifyDBParameterGroupRequest& request, const ModifyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyDBParameterGroupCallable(const Model::ModifyDBParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyDBParameterGroupOutcomeCallable ModifyDBParameterGroupCallable(Model::ModifyDBParameterGroupRequest&& request) const;
+
+        /**
+         * Same as ModifyDBParameterGroupAsync(const Model::ModifyDBParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyDBParameterGroupAsync(Model::ModifyDBParameterGroupRequest&& request, const ModifyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds an attribute and values to, or removes an attribute and values from, a
          * manual DB snapshot.</p> <p>To share a manual DB snapshot with other AWS
@@ -2635,6 +3418,18 @@ namespace Model
          */
         virtual void ModifyDBSnapshotAttributeAsync(const Model::ModifyDBSnapshotAttributeRequest& request, const ModifyDBSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyDBSnapshotAttributeCallable(const Model::ModifyDBSnapshotAttributeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyDBSnapshotAttributeOutcomeCallable ModifyDBSnapshotAttributeCallable(Model::ModifyDBSnapshotAttributeRequest&& request) const;
+
+        /**
+         * Same as ModifyDBSnapshotAttributeAsync(const Model::ModifyDBSnapshotAttributeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyDBSnapshotAttributeAsync(Model::ModifyDBSnapshotAttributeRequest&& request, const ModifyDBSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies an existing DB subnet group. DB subnet groups must contain at least
          * one subnet in at least two AZs in the region.</p>
@@ -2657,6 +3452,18 @@ namespace Model
          */
         virtual void ModifyDBSubnetGroupAsync(const Model::ModifyDBSubnetGroupRequest& request, const ModifyDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyDBSubnetGroupCallable(const Model::ModifyDBSubnetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyDBSubnetGroupOutcomeCallable ModifyDBSubnetGroupCallable(Model::ModifyDBSubnetGroupRequest&& request) const;
+
+        /**
+         * Same as ModifyDBSubnetGroupAsync(const Model::ModifyDBSubnetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyDBSubnetGroupAsync(Model::ModifyDBSubnetGroupRequest&& request, const ModifyDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies an existing RDS event notification subscription. Note that you
          * cannot modify the source identifiers using this call; to change source
@@ -2697,6 +3504,18 @@ namespace Model
          */
         virtual void ModifyEventSubscriptionAsync(const Model::ModifyEventSubscriptionRequest& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyEventSubscriptionCallable(const Model::ModifyEventSubscriptionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyEventSubscriptionOutcomeCallable ModifyEventSubscriptionCallable(Model::ModifyEventSubscriptionRequest&& request) const;
+
+        /**
+         * Same as ModifyEventSubscriptionAsync(const Model::ModifyEventSubscriptionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyEventSubscriptionAsync(Model::ModifyEventSubscriptionRequest&& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies an existing option group.</p>
          */
@@ -2716,6 +3535,18 @@ namespace Model
          */
         virtual void ModifyOptionGroupAsync(const Model::ModifyOptionGroupRequest& request, const ModifyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyOptionGroupCallable(const Model::ModifyOptionGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyOptionGroupOutcomeCallable ModifyOptionGroupCallable(Model::ModifyOptionGroupRequest&& request) const;
+
+        /**
+         * Same as ModifyOptionGroupAsync(const Model::ModifyOptionGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyOptionGroupAsync(Model::ModifyOptionGroupRequest&& request, const ModifyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Promotes a Read Replica DB instance to a standalone DB instance.</p> <note>
          * <p>We recommend that you enable automated backups on your Read Replica before
@@ -2747,6 +3578,18 @@ namespace Model
          */
         virtual void PromoteReadReplicaAsync(const Model::PromoteReadReplicaRequest& request, const PromoteReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PromoteReadReplicaCallable(const Model::PromoteReadReplicaRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PromoteReadReplicaOutcomeCallable PromoteReadReplicaCallable(Model::PromoteReadReplicaRequest&& request) const;
+
+        /**
+         * Same as PromoteReadReplicaAsync(const Model::PromoteReadReplicaRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PromoteReadReplicaAsync(Model::PromoteReadReplicaRequest&& request, const PromoteReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Promotes a Read Replica DB cluster to a standalone DB cluster.</p>
          */
@@ -2766,6 +3609,18 @@ namespace Model
          */
         virtual void PromoteReadReplicaDBClusterAsync(const Model::PromoteReadReplicaDBClusterRequest& request, const PromoteReadReplicaDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PromoteReadReplicaDBClusterCallable(const Model::PromoteReadReplicaDBClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PromoteReadReplicaDBClusterOutcomeCallable PromoteReadReplicaDBClusterCallable(Model::PromoteReadReplicaDBClusterRequest&& request) const;
+
+        /**
+         * Same as PromoteReadReplicaDBClusterAsync(const Model::PromoteReadReplicaDBClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PromoteReadReplicaDBClusterAsync(Model::PromoteReadReplicaDBClusterRequest&& request, const PromoteReadReplicaDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Purchases a reserved DB instance offering.</p>
          */
@@ -2785,6 +3640,18 @@ namespace Model
          */
         virtual void PurchaseReservedDBInstancesOfferingAsync(const Model::PurchaseReservedDBInstancesOfferingRequest& request, const PurchaseReservedDBInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PurchaseReservedDBInstancesOfferingCallable(const Model::PurchaseReservedDBInstancesOfferingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PurchaseReservedDBInstancesOfferingOutcomeCallable PurchaseReservedDBInstancesOfferingCallable(Model::PurchaseReservedDBInstancesOfferingRequest&& request) const;
+
+        /**
+         * Same as PurchaseReservedDBInstancesOfferingAsync(const Model::PurchaseReservedDBInstancesOfferingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PurchaseReservedDBInstancesOfferingAsync(Model::PurchaseReservedDBInstancesOfferingRequest&& request, const PurchaseReservedDBInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Rebooting a DB instance restarts the database engine service. A reboot also
          * applies to the DB instance any modifications to the associated DB parameter
@@ -2843,6 +3710,18 @@ namespace Model
          */
         virtual void RebootDBInstanceAsync(const Model::RebootDBInstanceRequest& request, const RebootDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebootDBInstanceCallable(const Model::RebootDBInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RebootDBInstanceOutcomeCallable RebootDBInstanceCallable(Model::RebootDBInstanceRequest&& request) const;
+
+        /**
+         * Same as RebootDBInstanceAsync(const Model::RebootDBInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RebootDBInstanceAsync(Model::RebootDBInstanceRequest&& request, const RebootDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes a source identifier from an existing RDS event notification
          * subscription.</p>
@@ -2865,6 +3744,18 @@ namespace Model
          */
         virtual void RemoveSourceIdentifierFromSubscriptionAsync(const Model::RemoveSourceIdentifierFromSubscriptionRequest& request, const RemoveSourceIdentifierFromSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveSourceIdentifierFromSubscriptionCallable(const Model::RemoveSourceIdentifierFromSubscriptionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveSourceIdentifierFromSubscriptionOutcomeCallable RemoveSourceIdentifierFromSubscriptionCallable(Model::RemoveSourceIdentifierFromSubscriptionRequest&& request) const;
+
+        /**
+         * Same as RemoveSourceIdentifierFromSubscriptionAsync(const Model::RemoveSourceIdentifierFromSubscriptionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveSourceIdentifierFromSubscriptionAsync(Model::RemoveSourceIdentifierFromSubscriptionRequest&& request, const RemoveSourceIdentifierFromSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes metadata tags from an Amazon RDS resource.</p> <p>For an overview on
          * tagging an Amazon RDS resource, see <a
@@ -2893,6 +3784,18 @@ namespace Model
          */
         virtual void RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromResourceCallable(const Model::RemoveTagsFromResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsFromResourceOutcomeCallable RemoveTagsFromResourceCallable(Model::RemoveTagsFromResourceRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsFromResourceAsync(Model::RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies the parameters of a DB cluster parameter group to the default
          * value. To reset specific parameters submit a list of the following:
@@ -2948,6 +3851,18 @@ namespace Model
          */
         virtual void ResetDBClusterParameterGroupAsync(const Model::ResetDBClusterParameterGroupRequest& request, const ResetDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetDBClusterParameterGroupCallable(const Model::ResetDBClusterParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResetDBClusterParameterGroupOutcomeCallable ResetDBClusterParameterGroupCallable(Model::ResetDBClusterParameterGroupRequest&& request) const;
+
+        /**
+         * Same as ResetDBClusterParameterGroupAsync(const Model::ResetDBClusterParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResetDBClusterParameterGroupAsync(Model::ResetDBClusterParameterGroupRequest&& request, const ResetDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies the parameters of a DB parameter group to the engine/system default
          * value. To reset specific parameters submit a list of the following:
@@ -2988,6 +3903,18 @@ namespace Model
          */
         virtual void ResetDBParameterGroupAsync(const Model::ResetDBParameterGroupRequest& request, const ResetDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetDBParameterGroupCallable(const Model::ResetDBParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResetDBParameterGroupOutcomeCallable ResetDBParameterGroupCallable(Model::ResetDBParameterGroupRequest&& request) const;
+
+        /**
+         * Same as ResetDBParameterGroupAsync(const Model::ResetDBParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResetDBParameterGroupAsync(Model::ResetDBParameterGroupRequest&& request, const ResetDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an Amazon Aurora DB cluster from data stored in an Amazon S3 bucket.
          * Amazon RDS must be authorized to access the Amazon S3 bucket and the data must
@@ -3019,6 +3946,18 @@ namespace Model
          */
         virtual void RestoreDBClusterFromS3Async(const Model::RestoreDBClusterFromS3Request& request, const RestoreDBClusterFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreDBClusterFromS3Callable(const Model::RestoreDBClusterFromS3Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RestoreDBClusterFromS3OutcomeCallable RestoreDBClusterFromS3Callable(Model::RestoreDBClusterFromS3Request&& request) const;
+
+        /**
+         * Same as RestoreDBClusterFromS3Async(const Model::RestoreDBClusterFromS3Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RestoreDBClusterFromS3Async(Model::RestoreDBClusterFromS3Request&& request, const RestoreDBClusterFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new DB cluster from a DB cluster snapshot. The target DB cluster is
          * created from the source DB cluster restore point with the same configuration as
@@ -3053,6 +3992,18 @@ namespace Model
          */
         virtual void RestoreDBClusterFromSnapshotAsync(const Model::RestoreDBClusterFromSnapshotRequest& request, const RestoreDBClusterFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreDBClusterFromSnapshotCallable(const Model::RestoreDBClusterFromSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RestoreDBClusterFromSnapshotOutcomeCallable RestoreDBClusterFromSnapshotCallable(Model::RestoreDBClusterFromSnapshotRequest&& request) const;
+
+        /**
+         * Same as RestoreDBClusterFromSnapshotAsync(const Model::RestoreDBClusterFromSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RestoreDBClusterFromSnapshotAsync(Model::RestoreDBClusterFromSnapshotRequest&& request, const RestoreDBClusterFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Restores a DB cluster to an arbitrary point in time. Users can restore to
          * any point in time before <code>LatestRestorableTime</code> for up to
@@ -3093,6 +4044,18 @@ namespace Model
          */
         virtual void RestoreDBClusterToPointInTimeAsync(const Model::RestoreDBClusterToPointInTimeRequest& request, const RestoreDBClusterToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreDBClusterToPointInTimeCallable(const Model::RestoreDBClusterToPointInTimeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RestoreDBClusterToPointInTimeOutcomeCallable RestoreDBClusterToPointInTimeCallable(Model::RestoreDBClusterToPointInTimeRequest&& request) const;
+
+        /**
+         * Same as RestoreDBClusterToPointInTimeAsync(const Model::RestoreDBClusterToPointInTimeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RestoreDBClusterToPointInTimeAsync(Model::RestoreDBClusterToPointInTimeRequest&& request, const RestoreDBClusterToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new DB instance from a DB snapshot. The target database is created
          * from the source database restore point with the most of original configuration
@@ -3157,6 +4120,18 @@ namespace Model
          */
         virtual void RestoreDBInstanceFromDBSnapshotAsync(const Model::RestoreDBInstanceFromDBSnapshotRequest& request, const RestoreDBInstanceFromDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreDBInstanceFromDBSnapshotCallable(const Model::RestoreDBInstanceFromDBSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RestoreDBInstanceFromDBSnapshotOutcomeCallable RestoreDBInstanceFromDBSnapshotCallable(Model::RestoreDBInstanceFromDBSnapshotRequest&& request) const;
+
+        /**
+         * Same as RestoreDBInstanceFromDBSnapshotAsync(const Model::RestoreDBInstanceFromDBSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RestoreDBInstanceFromDBSnapshotAsync(Model::RestoreDBInstanceFromDBSnapshotRequest&& request, const RestoreDBInstanceFromDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Restores a DB instance to an arbitrary point in time. You can restore to any
          * point in time before the time identified by the LatestRestorableTime property.
@@ -3203,6 +4178,18 @@ namespace Model
          */
         virtual void RestoreDBInstanceToPointInTimeAsync(const Model::RestoreDBInstanceToPointInTimeRequest& request, const RestoreDBInstanceToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreDBInstanceToPointInTimeCallable(const Model::RestoreDBInstanceToPointInTimeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RestoreDBInstanceToPointInTimeOutcomeCallable RestoreDBInstanceToPointInTimeCallable(Model::RestoreDBInstanceToPointInTimeRequest&& request) const;
+
+        /**
+         * Same as RestoreDBInstanceToPointInTimeAsync(const Model::RestoreDBInstanceToPointInTimeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RestoreDBInstanceToPointInTimeAsync(Model::RestoreDBInstanceToPointInTimeRequest&& request, const RestoreDBInstanceToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Revokes ingress from a DBSecurityGroup for previously authorized IP ranges or
          * EC2 or VPC Security Groups. Required parameters for this API are one of CIDRIP,
@@ -3231,6 +4218,545 @@ namespace Model
          */
         virtual void RevokeDBSecurityGroupIngressAsync(const Model::RevokeDBSecurityGroupIngressRequest& request, const RevokeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RevokeDBSecurityGroupIngressCallable(const Model::RevokeDBSecurityGroupIngressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RevokeDBSecurityGroupIngressOutcomeCallable RevokeDBSecurityGroupIngressCallable(Model::RevokeDBSecurityGroupIngressRequest&& request) const;
+
+        /**
+         * Same as RevokeDBSecurityGroupIngressAsync(const Model::RevokeDBSecurityGroupIngressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RevokeDBSecurityGroupIngressAsync(Model::RevokeDBSecurityGroupIngressRequest&& request, const RevokeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeCertificates(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeCertificatesRequest, Model::DescribeCertificatesOutcome> DescribeCertificatesPaginator(const Model::DescribeCertificatesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeDBClusterParameterGroups(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeDBClusterParameterGroupsRequest, Model::DescribeDBClusterParameterGroupsOutcome> DescribeDBClusterParameterGroupsPaginator(const Model::DescribeDBClusterParameterGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeDBClusterParameters(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeDBClusterParametersRequest, Model::DescribeDBClusterParametersOutcome> DescribeDBClusterParametersPaginator(const Model::DescribeDBClusterParametersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeDBClusterSnapshots(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeDBClusterSnapshotsRequest, Model::DescribeDBClusterSnapshotsOutcome> DescribeDBClusterSnapshotsPaginator(const Model::DescribeDBClusterSnapshotsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeDBClusters(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeDBClustersRequest, Model::DescribeDBClustersOutcome> DescribeDBClustersPaginator(const Model::DescribeDBClustersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeDBEngineVersions(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeDBEngineVersionsRequest, Model::DescribeDBEngineVersionsOutcome> DescribeDBEngineVersionsPaginator(const Model::DescribeDBEngineVersionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeDBInstances(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeDBInstancesRequest, Model::DescribeDBInstancesOutcome> DescribeDBInstancesPaginator(const Model::DescribeDBInstancesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeDBLogFiles(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeDBLogFilesRequest, Model::DescribeDBLogFilesOutcome> DescribeDBLogFilesPaginator(const Model::DescribeDBLogFilesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeDBParameterGroups(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeDBParameterGroupsRequest, Model::DescribeDBParameterGroupsOutcome> DescribeDBParameterGroupsPaginator(const Model::DescribeDBParameterGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeDBParameters(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeDBParametersRequest, Model::DescribeDBParametersOutcome> DescribeDBParametersPaginator(const Model::DescribeDBParametersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeDBSecurityGroups(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeDBSecurityGroupsRequest, Model::DescribeDBSecurityGroupsOutcome> DescribeDBSecurityGroupsPaginator(const Model::DescribeDBSecurityGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeDBSnapshots(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeDBSnapshotsRequest, Model::DescribeDBSnapshotsOutcome> DescribeDBSnapshotsPaginator(const Model::DescribeDBSnapshotsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeDBSubnetGroups(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeDBSubnetGroupsRequest, Model::DescribeDBSubnetGroupsOutcome> DescribeDBSubnetGroupsPaginator(const Model::DescribeDBSubnetGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeEventSubscriptions(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeEventSubscriptionsRequest, Model::DescribeEventSubscriptionsOutcome> DescribeEventSubscriptionsPaginator(const Model::DescribeEventSubscriptionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeEvents(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeEventsRequest, Model::DescribeEventsOutcome> DescribeEventsPaginator(const Model::DescribeEventsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeOptionGroupOptions(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeOptionGroupOptionsRequest, Model::DescribeOptionGroupOptionsOutcome> DescribeOptionGroupOptionsPaginator(const Model::DescribeOptionGroupOptionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeOptionGroups(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeOptionGroupsRequest, Model::DescribeOptionGroupsOutcome> DescribeOptionGroupsPaginator(const Model::DescribeOptionGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeOrderableDBInstanceOptions(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeOrderableDBInstanceOptionsRequest, Model::DescribeOrderableDBInstanceOptionsOutcome> DescribeOrderableDBInstanceOptionsPaginator(const Model::DescribeOrderableDBInstanceOptionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribePendingMaintenanceActions(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribePendingMaintenanceActionsRequest, Model::DescribePendingMaintenanceActionsOutcome> DescribePendingMaintenanceActionsPaginator(const Model::DescribePendingMaintenanceActionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeReservedDBInstances(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeReservedDBInstancesRequest, Model::DescribeReservedDBInstancesOutcome> DescribeReservedDBInstancesPaginator(const Model::DescribeReservedDBInstancesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeReservedDBInstancesOfferings(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DescribeReservedDBInstancesOfferingsRequest, Model::DescribeReservedDBInstancesOfferingsOutcome> DescribeReservedDBInstancesOfferingsPaginator(const Model::DescribeReservedDBInstancesOfferingsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DownloadDBLogFilePortion(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RDSClient, Model::DownloadDBLogFilePortionRequest, Model::DownloadDBLogFilePortionOutcome> DownloadDBLogFilePortionPaginator(const Model::DownloadDBLogFilePortionRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddSourceIdentifierToSubscription(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::AddSourceIdentifierToSubscriptionRequest, Model::AddSourceIdentifierToSubscriptionOutcome> AddSourceIdentifierToSubscriptionAwaitable(Model::AddSourceIdentifierToSubscriptionRequest request) const;
+
+        /**
+         * co_await-able form of AddTagsToResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::AddTagsToResourceRequest, Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(Model::AddTagsToResourceRequest request) const;
+
+        /**
+         * co_await-able form of ApplyPendingMaintenanceAction(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::ApplyPendingMaintenanceActionRequest, Model::ApplyPendingMaintenanceActionOutcome> ApplyPendingMaintenanceActionAwaitable(Model::ApplyPendingMaintenanceActionRequest request) const;
+
+        /**
+         * co_await-able form of AuthorizeDBSecurityGroupIngress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::AuthorizeDBSecurityGroupIngressRequest, Model::AuthorizeDBSecurityGroupIngressOutcome> AuthorizeDBSecurityGroupIngressAwaitable(Model::AuthorizeDBSecurityGroupIngressRequest request) const;
+
+        /**
+         * co_await-able form of CopyDBClusterParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CopyDBClusterParameterGroupRequest, Model::CopyDBClusterParameterGroupOutcome> CopyDBClusterParameterGroupAwaitable(Model::CopyDBClusterParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of CopyDBClusterSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CopyDBClusterSnapshotRequest, Model::CopyDBClusterSnapshotOutcome> CopyDBClusterSnapshotAwaitable(Model::CopyDBClusterSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of CopyDBParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CopyDBParameterGroupRequest, Model::CopyDBParameterGroupOutcome> CopyDBParameterGroupAwaitable(Model::CopyDBParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of CopyDBSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CopyDBSnapshotRequest, Model::CopyDBSnapshotOutcome> CopyDBSnapshotAwaitable(Model::CopyDBSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of CopyOptionGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CopyOptionGroupRequest, Model::CopyOptionGroupOutcome> CopyOptionGroupAwaitable(Model::CopyOptionGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateDBCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CreateDBClusterRequest, Model::CreateDBClusterOutcome> CreateDBClusterAwaitable(Model::CreateDBClusterRequest request) const;
+
+        /**
+         * co_await-able form of CreateDBClusterParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CreateDBClusterParameterGroupRequest, Model::CreateDBClusterParameterGroupOutcome> CreateDBClusterParameterGroupAwaitable(Model::CreateDBClusterParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateDBClusterSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CreateDBClusterSnapshotRequest, Model::CreateDBClusterSnapshotOutcome> CreateDBClusterSnapshotAwaitable(Model::CreateDBClusterSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of CreateDBInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CreateDBInstanceRequest, Model::CreateDBInstanceOutcome> CreateDBInstanceAwaitable(Model::CreateDBInstanceRequest request) const;
+
+        /**
+         * co_await-able form of CreateDBInstanceReadReplica(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CreateDBInstanceReadReplicaRequest, Model::CreateDBInstanceReadReplicaOutcome> CreateDBInstanceReadReplicaAwaitable(Model::CreateDBInstanceReadReplicaRequest request) const;
+
+        /**
+         * co_await-able form of CreateDBParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CreateDBParameterGroupRequest, Model::CreateDBParameterGroupOutcome> CreateDBParameterGroupAwaitable(Model::CreateDBParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateDBSecurityGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CreateDBSecurityGroupRequest, Model::CreateDBSecurityGroupOutcome> CreateDBSecurityGroupAwaitable(Model::CreateDBSecurityGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateDBSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CreateDBSnapshotRequest, Model::CreateDBSnapshotOutcome> CreateDBSnapshotAwaitable(Model::CreateDBSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of CreateDBSubnetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CreateDBSubnetGroupRequest, Model::CreateDBSubnetGroupOutcome> CreateDBSubnetGroupAwaitable(Model::CreateDBSubnetGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateEventSubscription(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CreateEventSubscriptionRequest, Model::CreateEventSubscriptionOutcome> CreateEventSubscriptionAwaitable(Model::CreateEventSubscriptionRequest request) const;
+
+        /**
+         * co_await-able form of CreateOptionGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::CreateOptionGroupRequest, Model::CreateOptionGroupOutcome> CreateOptionGroupAwaitable(Model::CreateOptionGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDBCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DeleteDBClusterRequest, Model::DeleteDBClusterOutcome> DeleteDBClusterAwaitable(Model::DeleteDBClusterRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDBClusterParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DeleteDBClusterParameterGroupRequest, Model::DeleteDBClusterParameterGroupOutcome> DeleteDBClusterParameterGroupAwaitable(Model::DeleteDBClusterParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDBClusterSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DeleteDBClusterSnapshotRequest, Model::DeleteDBClusterSnapshotOutcome> DeleteDBClusterSnapshotAwaitable(Model::DeleteDBClusterSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDBInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DeleteDBInstanceRequest, Model::DeleteDBInstanceOutcome> DeleteDBInstanceAwaitable(Model::DeleteDBInstanceRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDBParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DeleteDBParameterGroupRequest, Model::DeleteDBParameterGroupOutcome> DeleteDBParameterGroupAwaitable(Model::DeleteDBParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDBSecurityGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DeleteDBSecurityGroupRequest, Model::DeleteDBSecurityGroupOutcome> DeleteDBSecurityGroupAwaitable(Model::DeleteDBSecurityGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDBSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DeleteDBSnapshotRequest, Model::DeleteDBSnapshotOutcome> DeleteDBSnapshotAwaitable(Model::DeleteDBSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDBSubnetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DeleteDBSubnetGroupRequest, Model::DeleteDBSubnetGroupOutcome> DeleteDBSubnetGroupAwaitable(Model::DeleteDBSubnetGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteEventSubscription(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DeleteEventSubscriptionRequest, Model::DeleteEventSubscriptionOutcome> DeleteEventSubscriptionAwaitable(Model::DeleteEventSubscriptionRequest request) const;
+
+        /**
+         * co_await-able form of DeleteOptionGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DeleteOptionGroupRequest, Model::DeleteOptionGroupOutcome> DeleteOptionGroupAwaitable(Model::DeleteOptionGroupRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAccountAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeAccountAttributesRequest, Model::DescribeAccountAttributesOutcome> DescribeAccountAttributesAwaitable(Model::DescribeAccountAttributesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCertificates(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeCertificatesRequest, Model::DescribeCertificatesOutcome> DescribeCertificatesAwaitable(Model::DescribeCertificatesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDBClusterParameterGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeDBClusterParameterGroupsRequest, Model::DescribeDBClusterParameterGroupsOutcome> DescribeDBClusterParameterGroupsAwaitable(Model::DescribeDBClusterParameterGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDBClusterParameters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeDBClusterParametersRequest, Model::DescribeDBClusterParametersOutcome> DescribeDBClusterParametersAwaitable(Model::DescribeDBClusterParametersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDBClusterSnapshotAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeDBClusterSnapshotAttributesRequest, Model::DescribeDBClusterSnapshotAttributesOutcome> DescribeDBClusterSnapshotAttributesAwaitable(Model::DescribeDBClusterSnapshotAttributesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDBClusterSnapshots(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeDBClusterSnapshotsRequest, Model::DescribeDBClusterSnapshotsOutcome> DescribeDBClusterSnapshotsAwaitable(Model::DescribeDBClusterSnapshotsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDBClusters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeDBClustersRequest, Model::DescribeDBClustersOutcome> DescribeDBClustersAwaitable(Model::DescribeDBClustersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDBEngineVersions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeDBEngineVersionsRequest, Model::DescribeDBEngineVersionsOutcome> DescribeDBEngineVersionsAwaitable(Model::DescribeDBEngineVersionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDBInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeDBInstancesRequest, Model::DescribeDBInstancesOutcome> DescribeDBInstancesAwaitable(Model::DescribeDBInstancesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDBLogFiles(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeDBLogFilesRequest, Model::DescribeDBLogFilesOutcome> DescribeDBLogFilesAwaitable(Model::DescribeDBLogFilesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDBParameterGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeDBParameterGroupsRequest, Model::DescribeDBParameterGroupsOutcome> DescribeDBParameterGroupsAwaitable(Model::DescribeDBParameterGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDBParameters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeDBParametersRequest, Model::DescribeDBParametersOutcome> DescribeDBParametersAwaitable(Model::DescribeDBParametersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDBSecurityGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeDBSecurityGroupsRequest, Model::DescribeDBSecurityGroupsOutcome> DescribeDBSecurityGroupsAwaitable(Model::DescribeDBSecurityGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDBSnapshotAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeDBSnapshotAttributesRequest, Model::DescribeDBSnapshotAttributesOutcome> DescribeDBSnapshotAttributesAwaitable(Model::DescribeDBSnapshotAttributesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDBSnapshots(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeDBSnapshotsRequest, Model::DescribeDBSnapshotsOutcome> DescribeDBSnapshotsAwaitable(Model::DescribeDBSnapshotsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDBSubnetGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeDBSubnetGroupsRequest, Model::DescribeDBSubnetGroupsOutcome> DescribeDBSubnetGroupsAwaitable(Model::DescribeDBSubnetGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEngineDefaultClusterParameters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeEngineDefaultClusterParametersRequest, Model::DescribeEngineDefaultClusterParametersOutcome> DescribeEngineDefaultClusterParametersAwaitable(Model::DescribeEngineDefaultClusterParametersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEngineDefaultParameters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeEngineDefaultParametersRequest, Model::DescribeEngineDefaultParametersOutcome> DescribeEngineDefaultParametersAwaitable(Model::DescribeEngineDefaultParametersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEventCategories(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeEventCategoriesRequest, Model::DescribeEventCategoriesOutcome> DescribeEventCategoriesAwaitable(Model::DescribeEventCategoriesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEventSubscriptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeEventSubscriptionsRequest, Model::DescribeEventSubscriptionsOutcome> DescribeEventSubscriptionsAwaitable(Model::DescribeEventSubscriptionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEvents(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeEventsRequest, Model::DescribeEventsOutcome> DescribeEventsAwaitable(Model::DescribeEventsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeOptionGroupOptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeOptionGroupOptionsRequest, Model::DescribeOptionGroupOptionsOutcome> DescribeOptionGroupOptionsAwaitable(Model::DescribeOptionGroupOptionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeOptionGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeOptionGroupsRequest, Model::DescribeOptionGroupsOutcome> DescribeOptionGroupsAwaitable(Model::DescribeOptionGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeOrderableDBInstanceOptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeOrderableDBInstanceOptionsRequest, Model::DescribeOrderableDBInstanceOptionsOutcome> DescribeOrderableDBInstanceOptionsAwaitable(Model::DescribeOrderableDBInstanceOptionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribePendingMaintenanceActions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribePendingMaintenanceActionsRequest, Model::DescribePendingMaintenanceActionsOutcome> DescribePendingMaintenanceActionsAwaitable(Model::DescribePendingMaintenanceActionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReservedDBInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeReservedDBInstancesRequest, Model::DescribeReservedDBInstancesOutcome> DescribeReservedDBInstancesAwaitable(Model::DescribeReservedDBInstancesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReservedDBInstancesOfferings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DescribeReservedDBInstancesOfferingsRequest, Model::DescribeReservedDBInstancesOfferingsOutcome> DescribeReservedDBInstancesOfferingsAwaitable(Model::DescribeReservedDBInstancesOfferingsRequest request) const;
+
+        /**
+         * co_await-able form of DownloadDBLogFilePortion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::DownloadDBLogFilePortionRequest, Model::DownloadDBLogFilePortionOutcome> DownloadDBLogFilePortionAwaitable(Model::DownloadDBLogFilePortionRequest request) const;
+
+        /**
+         * co_await-able form of FailoverDBCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::FailoverDBClusterRequest, Model::FailoverDBClusterOutcome> FailoverDBClusterAwaitable(Model::FailoverDBClusterRequest request) const;
+
+        /**
+         * co_await-able form of ListTagsForResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::ListTagsForResourceRequest, Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(Model::ListTagsForResourceRequest request) const;
+
+        /**
+         * co_await-able form of ModifyDBCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::ModifyDBClusterRequest, Model::ModifyDBClusterOutcome> ModifyDBClusterAwaitable(Model::ModifyDBClusterRequest request) const;
+
+        /**
+         * co_await-able form of ModifyDBClusterParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::ModifyDBClusterParameterGroupRequest, Model::ModifyDBClusterParameterGroupOutcome> ModifyDBClusterParameterGroupAwaitable(Model::ModifyDBClusterParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of ModifyDBClusterSnapshotAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::ModifyDBClusterSnapshotAttributeRequest, Model::ModifyDBClusterSnapshotAttributeOutcome> ModifyDBClusterSnapshotAttributeAwaitable(Model::ModifyDBClusterSnapshotAttributeRequest request) const;
+
+        /**
+         * co_await-able form of ModifyDBInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::ModifyDBInstanceRequest, Model::ModifyDBInstanceOutcome> ModifyDBInstanceAwaitable(Model::ModifyDBInstanceRequest request) const;
+
+        /**
+         * co_await-able form of ModifyDBParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::ModifyDBParameterGroupRequest, Model::ModifyDBParameterGroupOutcome> ModifyDBParameterGroupAwaitable(Model::ModifyDBParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of ModifyDBSnapshotAttribute(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::ModifyDBSnapshotAttributeRequest, Model::ModifyDBSnapshotAttributeOutcome> ModifyDBSnapshotAttributeAwaitable(Model::ModifyDBSnapshotAttributeRequest request) const;
+
+        /**
+         * co_await-able form of ModifyDBSubnetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::ModifyDBSubnetGroupRequest, Model::ModifyDBSubnetGroupOutcome> ModifyDBSubnetGroupAwaitable(Model::ModifyDBSubnetGroupRequest request) const;
+
+        /**
+         * co_await-able form of ModifyEventSubscription(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::ModifyEventSubscriptionRequest, Model::ModifyEventSubscriptionOutcome> ModifyEventSubscriptionAwaitable(Model::ModifyEventSubscriptionRequest request) const;
+
+        /**
+         * co_await-able form of ModifyOptionGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::ModifyOptionGroupRequest, Model::ModifyOptionGroupOutcome> ModifyOptionGroupAwaitable(Model::ModifyOptionGroupRequest request) const;
+
+        /**
+         * co_await-able form of PromoteReadReplica(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::PromoteReadReplicaRequest, Model::PromoteReadReplicaOutcome> PromoteReadReplicaAwaitable(Model::PromoteReadReplicaRequest request) const;
+
+        /**
+         * co_await-able form of PromoteReadReplicaDBCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::PromoteReadReplicaDBClusterRequest, Model::PromoteReadReplicaDBClusterOutcome> PromoteReadReplicaDBClusterAwaitable(Model::PromoteReadReplicaDBClusterRequest request) const;
+
+        /**
+         * co_await-able form of PurchaseReservedDBInstancesOffering(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::PurchaseReservedDBInstancesOfferingRequest, Model::PurchaseReservedDBInstancesOfferingOutcome> PurchaseReservedDBInstancesOfferingAwaitable(Model::PurchaseReservedDBInstancesOfferingRequest request) const;
+
+        /**
+         * co_await-able form of RebootDBInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::RebootDBInstanceRequest, Model::RebootDBInstanceOutcome> RebootDBInstanceAwaitable(Model::RebootDBInstanceRequest request) const;
+
+        /**
+         * co_await-able form of RemoveSourceIdentifierFromSubscription(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::RemoveSourceIdentifierFromSubscriptionRequest, Model::RemoveSourceIdentifierFromSubscriptionOutcome> RemoveSourceIdentifierFromSubscriptionAwaitable(Model::RemoveSourceIdentifierFromSubscriptionRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTagsFromResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::RemoveTagsFromResourceRequest, Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(Model::RemoveTagsFromResourceRequest request) const;
+
+        /**
+         * co_await-able form of ResetDBClusterParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::ResetDBClusterParameterGroupRequest, Model::ResetDBClusterParameterGroupOutcome> ResetDBClusterParameterGroupAwaitable(Model::ResetDBClusterParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of ResetDBParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::ResetDBParameterGroupRequest, Model::ResetDBParameterGroupOutcome> ResetDBParameterGroupAwaitable(Model::ResetDBParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of RestoreDBClusterFromS3(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::RestoreDBClusterFromS3Request, Model::RestoreDBClusterFromS3Outcome> RestoreDBClusterFromS3Awaitable(Model::RestoreDBClusterFromS3Request request) const;
+
+        /**
+         * co_await-able form of RestoreDBClusterFromSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::RestoreDBClusterFromSnapshotRequest, Model::RestoreDBClusterFromSnapshotOutcome> RestoreDBClusterFromSnapshotAwaitable(Model::RestoreDBClusterFromSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of RestoreDBClusterToPointInTime(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::RestoreDBClusterToPointInTimeRequest, Model::RestoreDBClusterToPointInTimeOutcome> RestoreDBClusterToPointInTimeAwaitable(Model::RestoreDBClusterToPointInTimeRequest request) const;
+
+        /**
+         * co_await-able form of RestoreDBInstanceFromDBSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::RestoreDBInstanceFromDBSnapshotRequest, Model::RestoreDBInstanceFromDBSnapshotOutcome> RestoreDBInstanceFromDBSnapshotAwaitable(Model::RestoreDBInstanceFromDBSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of RestoreDBInstanceToPointInTime(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::RestoreDBInstanceToPointInTimeRequest, Model::RestoreDBInstanceToPointInTimeOutcome> RestoreDBInstanceToPointInTimeAwaitable(Model::RestoreDBInstanceToPointInTimeRequest request) const;
+
+        /**
+         * co_await-able form of RevokeDBSecurityGroupIngress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RDSClient, Model::RevokeDBSecurityGroupIngressRequest, Model::RevokeDBSecurityGroupIngressOutcome> RevokeDBSecurityGroupIngressAwaitable(Model::RevokeDBSecurityGroupIngressRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AddSourceIdentifierToSubscriptionRequest();
+    inline const char* GetServiceRequestName() const override { return "AddSourceIdentifierToSubscription"; }
+
     Aws::String SerializePayload() const override;
 
     /**
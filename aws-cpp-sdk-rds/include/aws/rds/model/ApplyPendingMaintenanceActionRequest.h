@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ApplyPendingMaintenanceActionRequest();
+    inline const char* GetServiceRequestName() const override { return "ApplyPendingMaintenanceAction"; }
+
     Aws::String SerializePayload() const override;
 
     /**
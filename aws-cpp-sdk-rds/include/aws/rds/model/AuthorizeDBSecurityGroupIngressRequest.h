@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AuthorizeDBSecurityGroupIngressRequest();
+    inline const char* GetServiceRequestName() const override { return "AuthorizeDBSecurityGroupIngress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CopyDBClusterParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CopyDBClusterParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
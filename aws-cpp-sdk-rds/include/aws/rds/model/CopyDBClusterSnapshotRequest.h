@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CopyDBClusterSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "CopyDBClusterSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CopyDBParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CopyDBParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
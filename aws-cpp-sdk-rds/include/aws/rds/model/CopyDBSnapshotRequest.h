@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CopyDBSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "CopyDBSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
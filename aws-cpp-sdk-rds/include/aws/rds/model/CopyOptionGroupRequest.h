@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CopyOptionGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CopyOptionGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
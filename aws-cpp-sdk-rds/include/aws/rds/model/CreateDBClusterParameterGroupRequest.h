@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateDBClusterParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDBClusterParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateDBClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDBCluster"; }
+
     Aws::String SerializePayload() const override;
 
     /**
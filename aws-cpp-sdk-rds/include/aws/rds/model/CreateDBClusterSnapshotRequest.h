@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateDBClusterSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDBClusterSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateDBInstanceReadReplicaRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDBInstanceReadReplica"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateDBInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDBInstance"; }
+
     Aws::String SerializePayload() const override;
 
     /**
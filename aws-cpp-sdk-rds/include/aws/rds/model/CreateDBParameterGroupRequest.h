@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateDBParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDBParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
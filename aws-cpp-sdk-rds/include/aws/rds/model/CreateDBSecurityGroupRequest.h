@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateDBSecurityGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDBSecurityGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateDBSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDBSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateDBSubnetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDBSubnetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateEventSubscriptionRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateEventSubscription"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateOptionGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateOptionGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
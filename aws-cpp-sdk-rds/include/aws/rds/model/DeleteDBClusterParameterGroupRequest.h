@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDBClusterParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDBClusterParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
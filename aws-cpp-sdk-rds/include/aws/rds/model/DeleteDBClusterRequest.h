@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDBClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDBCluster"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDBClusterSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDBClusterSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDBInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDBInstance"; }
+
     Aws::String SerializePayload() const override;
 
     /**
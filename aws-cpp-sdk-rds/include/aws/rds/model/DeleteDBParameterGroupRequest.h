@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDBParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDBParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
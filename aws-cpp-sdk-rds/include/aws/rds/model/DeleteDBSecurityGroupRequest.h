@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDBSecurityGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDBSecurityGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDBSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDBSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
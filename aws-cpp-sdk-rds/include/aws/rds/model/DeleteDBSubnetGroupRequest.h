@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteDBSubnetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDBSubnetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
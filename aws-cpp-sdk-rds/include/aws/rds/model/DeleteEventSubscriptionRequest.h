@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteEventSubscriptionRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteEventSubscription"; }
+
     Aws::String SerializePayload() const override;
 
     /**
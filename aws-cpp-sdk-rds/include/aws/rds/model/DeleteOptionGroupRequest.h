@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteOptionGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteOptionGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeCertificatesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCertificates"; }
+
     Aws::String SerializePayload() const override;
 
     /**
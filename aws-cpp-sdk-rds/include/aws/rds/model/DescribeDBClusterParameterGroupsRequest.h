@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeDBClusterParameterGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDBClusterParameterGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
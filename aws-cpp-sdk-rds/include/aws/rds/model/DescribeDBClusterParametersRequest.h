@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeDBClusterParametersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDBClusterParameters"; }
+
     Aws::String SerializePayload() const override;
 
     /**
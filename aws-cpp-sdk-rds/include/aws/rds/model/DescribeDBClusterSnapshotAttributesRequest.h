@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeDBClusterSnapshotAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDBClusterSnapshotAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
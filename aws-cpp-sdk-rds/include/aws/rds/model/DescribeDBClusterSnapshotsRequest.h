@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeDBClusterSnapshotsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDBClusterSnapshots"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeDBClustersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDBClusters"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeDBEngineVersionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDBEngineVersions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
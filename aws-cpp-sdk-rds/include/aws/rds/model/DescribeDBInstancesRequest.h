@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeDBInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDBInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeDBLogFilesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDBLogFiles"; }
+
     Aws::String SerializePayload() const override;
 
     /**
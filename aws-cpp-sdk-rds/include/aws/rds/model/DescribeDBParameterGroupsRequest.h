@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeDBParameterGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDBParameterGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
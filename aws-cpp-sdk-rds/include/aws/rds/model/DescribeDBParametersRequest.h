@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeDBParametersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDBParameters"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeDBSecurityGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDBSecurityGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeDBSnapshotAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDBSnapshotAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeDBSnapshotsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDBSnapshots"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeDBSubnetGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDBSubnetGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
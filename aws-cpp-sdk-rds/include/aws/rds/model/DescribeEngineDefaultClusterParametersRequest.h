@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeEngineDefaultClusterParametersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEngineDefaultClusterParameters"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeEngineDefaultParametersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEngineDefaultParameters"; }
+
     Aws::String SerializePayload() const override;
 
     /**
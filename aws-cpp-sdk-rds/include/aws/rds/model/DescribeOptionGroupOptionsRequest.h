@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeOptionGroupOptionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeOptionGroupOptions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
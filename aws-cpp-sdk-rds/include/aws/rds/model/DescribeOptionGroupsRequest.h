@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeOptionGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeOptionGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
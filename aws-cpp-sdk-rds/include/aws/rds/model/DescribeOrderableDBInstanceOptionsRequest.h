@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeOrderableDBInstanceOptionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeOrderableDBInstanceOptions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribePendingMaintenanceActionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribePendingMaintenanceActions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeReservedDBInstancesOfferingsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReservedDBInstancesOfferings"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeReservedDBInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReservedDBInstances"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DownloadDBLogFilePortionRequest();
+    inline const char* GetServiceRequestName() const override { return "DownloadDBLogFilePortion"; }
+
     Aws::String SerializePayload() const override;
 
     /**
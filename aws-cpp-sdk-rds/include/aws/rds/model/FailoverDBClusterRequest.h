@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     FailoverDBClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "FailoverDBCluster"; }
+
     Aws::String SerializePayload() const override;
 
     /**
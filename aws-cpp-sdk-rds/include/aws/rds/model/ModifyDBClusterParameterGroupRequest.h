@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ModifyDBClusterParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyDBClusterParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyDBClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyDBCluster"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyDBClusterSnapshotAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyDBClusterSnapshotAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyDBInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyDBInstance"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ModifyDBParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyDBParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
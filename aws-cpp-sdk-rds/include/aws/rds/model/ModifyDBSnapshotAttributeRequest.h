@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyDBSnapshotAttributeRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyDBSnapshotAttribute"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyDBSubnetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyDBSubnetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
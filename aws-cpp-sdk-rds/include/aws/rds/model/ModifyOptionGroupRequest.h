@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ModifyOptionGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyOptionGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PromoteReadReplicaDBClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "PromoteReadReplicaDBCluster"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PromoteReadReplicaRequest();
+    inline const char* GetServiceRequestName() const override { return "PromoteReadReplica"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     PurchaseReservedDBInstancesOfferingRequest();
+    inline const char* GetServiceRequestName() const override { return "PurchaseReservedDBInstancesOffering"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RebootDBInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "RebootDBInstance"; }
+
     Aws::String SerializePayload() const override;
 
     /**
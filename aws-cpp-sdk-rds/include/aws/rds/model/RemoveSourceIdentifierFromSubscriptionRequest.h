@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RemoveSourceIdentifierFromSubscriptionRequest();
+    inline const char* GetServiceRequestName() const override { return "RemoveSourceIdentifierFromSubscription"; }
+
     Aws::String SerializePayload() const override;
 
     /**
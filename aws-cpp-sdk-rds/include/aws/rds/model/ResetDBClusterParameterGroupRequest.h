@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ResetDBClusterParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "ResetDBClusterParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
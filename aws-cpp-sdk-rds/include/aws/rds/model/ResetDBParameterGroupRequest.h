@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ResetDBParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "ResetDBParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
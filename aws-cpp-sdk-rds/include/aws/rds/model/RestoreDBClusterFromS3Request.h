@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RestoreDBClusterFromS3Request();
+    inline const char* GetServiceRequestName() const override { return "RestoreDBClusterFromS3"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     RestoreDBClusterFromSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "RestoreDBClusterFromSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     RestoreDBClusterToPointInTimeRequest();
+    inline const char* GetServiceRequestName() const override { return "RestoreDBClusterToPointInTime"; }
+
     Aws::String SerializePayload() const override;
 
     /**
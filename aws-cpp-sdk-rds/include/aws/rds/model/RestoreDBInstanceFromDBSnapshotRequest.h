@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     RestoreDBInstanceFromDBSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "RestoreDBInstanceFromDBSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
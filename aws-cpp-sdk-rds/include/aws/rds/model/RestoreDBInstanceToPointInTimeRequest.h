@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     RestoreDBInstanceToPointInTimeRequest();
+    inline const char* GetServiceRequestName() const override { return "RestoreDBInstanceToPointInTime"; }
+
     Aws::String SerializePayload() const override;
 
     /**
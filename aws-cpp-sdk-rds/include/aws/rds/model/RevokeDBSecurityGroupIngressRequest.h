@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RevokeDBSecurityGroupIngressRequest();
+    inline const char* GetServiceRequestName() const override { return "RevokeDBSecurityGroupIngress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -192,7 +192,7 @@ AddSourceIdentifierToSubscriptionOutcome RDSClient::AddSourceIdentifierToSubscri
 
 AddSourceIdentifierToSubscriptionOutcomeCallable RDSClient::AddSourceIdentifierToSubscriptionCallable(const AddSourceIdentifierToSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddSourceIdentifierToSubscription( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddSourceIdentifierToSubscription( request ); } );
 }
 
 void RDSClient::AddSourceIdentifierToSubscriptionAsync(const AddSourceIdentifierToSubscriptionRequest& request, const AddSourceIdentifierToSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -200,6 +200,16 @@ void RDSClient::AddSourceIdentifierToSubscriptionAsync(const AddSourceIdentifier
   m_executor->Submit( [this, request, handler, context](){ this->AddSourceIdentifierToSubscriptionAsyncHelper( request, handler, context ); } );
 }
 
+AddSourceIdentifierToSubscriptionOutcomeCallable RDSClient::AddSourceIdentifierToSubscriptionCallable(AddSourceIdentifierToSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::AddSourceIdentifierToSubscription, this, std::move(request)));
+}
+
+void RDSClient::AddSourceIdentifierToSubscriptionAsync(AddSourceIdentifierToSubscriptionRequest&& request, const AddSourceIdentifierToSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::AddSourceIdentifierToSubscriptionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::AddSourceIdentifierToSubscriptionAsyncHelper(const AddSourceIdentifierToSubscriptionRequest& request, const AddSourceIdentifierToSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddSourceIdentifierToSubscription(request), context);
@@ -222,7 +232,7 @@ AddTagsToResourceOutcome RDSClient::AddTagsToResource(const AddTagsToResourceReq
 
 AddTagsToResourceOutcomeCallable RDSClient::AddTagsToResourceCallable(const AddTagsToResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTagsToResource( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTagsToResource( request ); } );
 }
 
 void RDSClient::AddTagsToResourceAsync(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -230,6 +240,16 @@ void RDSClient::AddTagsToResourceAsync(const AddTagsToResourceRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsToResourceAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsToResourceOutcomeCallable RDSClient::AddTagsToResourceCallable(AddTagsToResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::AddTagsToResource, this, std::move(request)));
+}
+
+void RDSClient::AddTagsToResourceAsync(AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::AddTagsToResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::AddTagsToResourceAsyncHelper(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTagsToResource(request), context);
@@ -252,7 +272,7 @@ ApplyPendingMaintenanceActionOutcome RDSClient::ApplyPendingMaintenanceAction(co
 
 ApplyPendingMaintenanceActionOutcomeCallable RDSClient::ApplyPendingMaintenanceActionCallable(const ApplyPendingMaintenanceActionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ApplyPendingMaintenanceAction( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ApplyPendingMaintenanceAction( request ); } );
 }
 
 void RDSClient::ApplyPendingMaintenanceActionAsync(const ApplyPendingMaintenanceActionRequest& request, const ApplyPendingMaintenanceActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -260,6 +280,16 @@ void RDSClient::ApplyPendingMaintenanceActionAsync(const ApplyPendingMaintenance
   m_executor->Submit( [this, request, handler, context](){ this->ApplyPendingMaintenanceActionAsyncHelper( request, handler, context ); } );
 }
 
+ApplyPendingMaintenanceActionOutcomeCallable RDSClient::ApplyPendingMaintenanceActionCallable(ApplyPendingMaintenanceActionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::ApplyPendingMaintenanceAction, this, std::move(request)));
+}
+
+void RDSClient::ApplyPendingMaintenanceActionAsync(ApplyPendingMaintenanceActionRequest&& request, const ApplyPendingMaintenanceActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::ApplyPendingMaintenanceActionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::ApplyPendingMaintenanceActionAsyncHelper(const ApplyPendingMaintenanceActionRequest& request, const ApplyPendingMaintenanceActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ApplyPendingMaintenanceAction(request), context);
@@ -282,7 +312,7 @@ AuthorizeDBSecurityGroupIngressOutcome RDSClient::AuthorizeDBSecurityGroupIngres
 
 AuthorizeDBSecurityGroupIngressOutcomeCallable RDSClient::AuthorizeDBSecurityGroupIngressCallable(const AuthorizeDBSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AuthorizeDBSecurityGroupIngress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AuthorizeDBSecurityGroupIngress( request ); } );
 }
 
 void RDSClient::AuthorizeDBSecurityGroupIngressAsync(const AuthorizeDBSecurityGroupIngressRequest& request, const AuthorizeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -290,6 +320,16 @@ void RDSClient::AuthorizeDBSecurityGroupIngressAsync(const AuthorizeDBSecurityGr
   m_executor->Submit( [this, request, handler, context](){ this->AuthorizeDBSecurityGroupIngressAsyncHelper( request, handler, context ); } );
 }
 
+AuthorizeDBSecurityGroupIngressOutcomeCallable RDSClient::AuthorizeDBSecurityGroupIngressCallable(AuthorizeDBSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::AuthorizeDBSecurityGroupIngress, this, std::move(request)));
+}
+
+void RDSClient::AuthorizeDBSecurityGroupIngressAsync(AuthorizeDBSecurityGroupIngressRequest&& request, const AuthorizeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::AuthorizeDBSecurityGroupIngressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::AuthorizeDBSecurityGroupIngressAsyncHelper(const AuthorizeDBSecurityGroupIngressRequest& request, const AuthorizeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AuthorizeDBSecurityGroupIngress(request), context);
@@ -312,7 +352,7 @@ CopyDBClusterParameterGroupOutcome RDSClient::CopyDBClusterParameterGroup(const
 
 CopyDBClusterParameterGroupOutcomeCallable RDSClient::CopyDBClusterParameterGroupCallable(const CopyDBClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CopyDBClusterParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CopyDBClusterParameterGroup( request ); } );
 }
 
 void RDSClient::CopyDBClusterParameterGroupAsync(const CopyDBClusterParameterGroupRequest& request, const CopyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -320,6 +360,16 @@ void RDSClient::CopyDBClusterParameterGroupAsync(const CopyDBClusterParameterGro
   m_executor->Submit( [this, request, handler, context](){ this->CopyDBClusterParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+CopyDBClusterParameterGroupOutcomeCallable RDSClient::CopyDBClusterParameterGroupCallable(CopyDBClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CopyDBClusterParameterGroup, this, std::move(request)));
+}
+
+void RDSClient::CopyDBClusterParameterGroupAsync(CopyDBClusterParameterGroupRequest&& request, const CopyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CopyDBClusterParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CopyDBClusterParameterGroupAsyncHelper(const CopyDBClusterParameterGroupRequest& request, const CopyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CopyDBClusterParameterGroup(request), context);
@@ -342,7 +392,7 @@ CopyDBClusterSnapshotOutcome RDSClient::CopyDBClusterSnapshot(const CopyDBCluste
 
 CopyDBClusterSnapshotOutcomeCallable RDSClient::CopyDBClusterSnapshotCallable(const CopyDBClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CopyDBClusterSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CopyDBClusterSnapshot( request ); } );
 }
 
 void RDSClient::CopyDBClusterSnapshotAsync(const CopyDBClusterSnapshotRequest& request, const CopyDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -350,6 +400,16 @@ void RDSClient::CopyDBClusterSnapshotAsync(const CopyDBClusterSnapshotRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->CopyDBClusterSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+CopyDBClusterSnapshotOutcomeCallable RDSClient::CopyDBClusterSnapshotCallable(CopyDBClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CopyDBClusterSnapshot, this, std::move(request)));
+}
+
+void RDSClient::CopyDBClusterSnapshotAsync(CopyDBClusterSnapshotRequest&& request, const CopyDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CopyDBClusterSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CopyDBClusterSnapshotAsyncHelper(const CopyDBClusterSnapshotRequest& request, const CopyDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CopyDBClusterSnapshot(request), context);
@@ -372,7 +432,7 @@ CopyDBParameterGroupOutcome RDSClient::CopyDBParameterGroup(const CopyDBParamete
 
 CopyDBParameterGroupOutcomeCallable RDSClient::CopyDBParameterGroupCallable(const CopyDBParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CopyDBParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CopyDBParameterGroup( request ); } );
 }
 
 void RDSClient::CopyDBParameterGroupAsync(const CopyDBParameterGroupRequest& request, const CopyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -380,6 +440,16 @@ void RDSClient::CopyDBParameterGroupAsync(const CopyDBParameterGroupRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->CopyDBParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+CopyDBParameterGroupOutcomeCallable RDSClient::CopyDBParameterGroupCallable(CopyDBParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CopyDBParameterGroup, this, std::move(request)));
+}
+
+void RDSClient::CopyDBParameterGroupAsync(CopyDBParameterGroupRequest&& request, const CopyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CopyDBParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CopyDBParameterGroupAsyncHelper(const CopyDBParameterGroupRequest& request, const CopyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CopyDBParameterGroup(request), context);
@@ -402,7 +472,7 @@ CopyDBSnapshotOutcome RDSClient::CopyDBSnapshot(const CopyDBSnapshotRequest& req
 
 CopyDBSnapshotOutcomeCallable RDSClient::CopyDBSnapshotCallable(const CopyDBSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CopyDBSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CopyDBSnapshot( request ); } );
 }
 
 void RDSClient::CopyDBSnapshotAsync(const CopyDBSnapshotRequest& request, const CopyDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -410,6 +480,16 @@ void RDSClient::CopyDBSnapshotAsync(const CopyDBSnapshotRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->CopyDBSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+CopyDBSnapshotOutcomeCallable RDSClient::CopyDBSnapshotCallable(CopyDBSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CopyDBSnapshot, this, std::move(request)));
+}
+
+void RDSClient::CopyDBSnapshotAsync(CopyDBSnapshotRequest&& request, const CopyDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CopyDBSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CopyDBSnapshotAsyncHelper(const CopyDBSnapshotRequest& request, const CopyDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CopyDBSnapshot(request), context);
@@ -432,7 +512,7 @@ CopyOptionGroupOutcome RDSClient::CopyOptionGroup(const CopyOptionGroupRequest&
 
 CopyOptionGroupOutcomeCallable RDSClient::CopyOptionGroupCallable(const CopyOptionGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CopyOptionGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CopyOptionGroup( request ); } );
 }
 
 void RDSClient::CopyOptionGroupAsync(const CopyOptionGroupRequest& request, const CopyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -440,6 +520,16 @@ void RDSClient::CopyOptionGroupAsync(const CopyOptionGroupRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->CopyOptionGroupAsyncHelper( request, handler, context ); } );
 }
 
+CopyOptionGroupOutcomeCallable RDSClient::CopyOptionGroupCallable(CopyOptionGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CopyOptionGroup, this, std::move(request)));
+}
+
+void RDSClient::CopyOptionGroupAsync(CopyOptionGroupRequest&& request, const CopyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CopyOptionGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CopyOptionGroupAsyncHelper(const CopyOptionGroupRequest& request, const CopyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CopyOptionGroup(request), context);
@@ -462,7 +552,7 @@ CreateDBClusterOutcome RDSClient::CreateDBCluster(const CreateDBClusterRequest&
 
 CreateDBClusterOutcomeCallable RDSClient::CreateDBClusterCallable(const CreateDBClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDBCluster( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDBCluster( request ); } );
 }
 
 void RDSClient::CreateDBClusterAsync(const CreateDBClusterRequest& request, const CreateDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -470,6 +560,16 @@ void RDSClient::CreateDBClusterAsync(const CreateDBClusterRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->CreateDBClusterAsyncHelper( request, handler, context ); } );
 }
 
+CreateDBClusterOutcomeCallable RDSClient::CreateDBClusterCallable(CreateDBClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CreateDBCluster, this, std::move(request)));
+}
+
+void RDSClient::CreateDBClusterAsync(CreateDBClusterRequest&& request, const CreateDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CreateDBClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CreateDBClusterAsyncHelper(const CreateDBClusterRequest& request, const CreateDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDBCluster(request), context);
@@ -492,7 +592,7 @@ CreateDBClusterParameterGroupOutcome RDSClient::CreateDBClusterParameterGroup(co
 
 CreateDBClusterParameterGroupOutcomeCallable RDSClient::CreateDBClusterParameterGroupCallable(const CreateDBClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDBClusterParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDBClusterParameterGroup( request ); } );
 }
 
 void RDSClient::CreateDBClusterParameterGroupAsync(const CreateDBClusterParameterGroupRequest& request, const CreateDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -500,6 +600,16 @@ void RDSClient::CreateDBClusterParameterGroupAsync(const CreateDBClusterParamete
   m_executor->Submit( [this, request, handler, context](){ this->CreateDBClusterParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateDBClusterParameterGroupOutcomeCallable RDSClient::CreateDBClusterParameterGroupCallable(CreateDBClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CreateDBClusterParameterGroup, this, std::move(request)));
+}
+
+void RDSClient::CreateDBClusterParameterGroupAsync(CreateDBClusterParameterGroupRequest&& request, const CreateDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CreateDBClusterParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CreateDBClusterParameterGroupAsyncHelper(const CreateDBClusterParameterGroupRequest& request, const CreateDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDBClusterParameterGroup(request), context);
@@ -522,7 +632,7 @@ CreateDBClusterSnapshotOutcome RDSClient::CreateDBClusterSnapshot(const CreateDB
 
 CreateDBClusterSnapshotOutcomeCallable RDSClient::CreateDBClusterSnapshotCallable(const CreateDBClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDBClusterSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDBClusterSnapshot( request ); } );
 }
 
 void RDSClient::CreateDBClusterSnapshotAsync(const CreateDBClusterSnapshotRequest& request, const CreateDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -530,6 +640,16 @@ void RDSClient::CreateDBClusterSnapshotAsync(const CreateDBClusterSnapshotReques
   m_executor->Submit( [this, request, handler, context](){ this->CreateDBClusterSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+CreateDBClusterSnapshotOutcomeCallable RDSClient::CreateDBClusterSnapshotCallable(CreateDBClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CreateDBClusterSnapshot, this, std::move(request)));
+}
+
+void RDSClient::CreateDBClusterSnapshotAsync(CreateDBClusterSnapshotRequest&& request, const CreateDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CreateDBClusterSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CreateDBClusterSnapshotAsyncHelper(const CreateDBClusterSnapshotRequest& request, const CreateDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDBClusterSnapshot(request), context);
@@ -552,7 +672,7 @@ CreateDBInstanceOutcome RDSClient::CreateDBInstance(const CreateDBInstanceReques
 
 CreateDBInstanceOutcomeCallable RDSClient::CreateDBInstanceCallable(const CreateDBInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDBInstance( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDBInstance( request ); } );
 }
 
 void RDSClient::CreateDBInstanceAsync(const CreateDBInstanceRequest& request, const CreateDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -560,6 +680,16 @@ void RDSClient::CreateDBInstanceAsync(const CreateDBInstanceRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CreateDBInstanceAsyncHelper( request, handler, context ); } );
 }
 
+CreateDBInstanceOutcomeCallable RDSClient::CreateDBInstanceCallable(CreateDBInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CreateDBInstance, this, std::move(request)));
+}
+
+void RDSClient::CreateDBInstanceAsync(CreateDBInstanceRequest&& request, const CreateDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CreateDBInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CreateDBInstanceAsyncHelper(const CreateDBInstanceRequest& request, const CreateDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDBInstance(request), context);
@@ -582,7 +712,7 @@ CreateDBInstanceReadReplicaOutcome RDSClient::CreateDBInstanceReadReplica(const
 
 CreateDBInstanceReadReplicaOutcomeCallable RDSClient::CreateDBInstanceReadReplicaCallable(const CreateDBInstanceReadReplicaRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDBInstanceReadReplica( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDBInstanceReadReplica( request ); } );
 }
 
 void RDSClient::CreateDBInstanceReadReplicaAsync(const CreateDBInstanceReadReplicaRequest& request, const CreateDBInstanceReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -590,6 +720,16 @@ void RDSClient::CreateDBInstanceReadReplicaAsync(const CreateDBInstanceReadRepli
   m_executor->Submit( [this, request, handler, context](){ this->CreateDBInstanceReadReplicaAsyncHelper( request, handler, context ); } );
 }
 
+CreateDBInstanceReadReplicaOutcomeCallable RDSClient::CreateDBInstanceReadReplicaCallable(CreateDBInstanceReadReplicaRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CreateDBInstanceReadReplica, this, std::move(request)));
+}
+
+void RDSClient::CreateDBInstanceReadReplicaAsync(CreateDBInstanceReadReplicaRequest&& request, const CreateDBInstanceReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CreateDBInstanceReadReplicaAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CreateDBInstanceReadReplicaAsyncHelper(const CreateDBInstanceReadReplicaRequest& request, const CreateDBInstanceReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDBInstanceReadReplica(request), context);
@@ -612,7 +752,7 @@ CreateDBParameterGroupOutcome RDSClient::CreateDBParameterGroup(const CreateDBPa
 
 CreateDBParameterGroupOutcomeCallable RDSClient::CreateDBParameterGroupCallable(const CreateDBParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDBParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDBParameterGroup( request ); } );
 }
 
 void RDSClient::CreateDBParameterGroupAsync(const CreateDBParameterGroupRequest& request, const CreateDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -620,6 +760,16 @@ void RDSClient::CreateDBParameterGroupAsync(const CreateDBParameterGroupRequest&
   m_executor->Submit( [this, request, handler, context](){ this->CreateDBParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateDBParameterGroupOutcomeCallable RDSClient::CreateDBParameterGroupCallable(CreateDBParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CreateDBParameterGroup, this, std::move(request)));
+}
+
+void RDSClient::CreateDBParameterGroupAsync(CreateDBParameterGroupRequest&& request, const CreateDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CreateDBParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CreateDBParameterGroupAsyncHelper(const CreateDBParameterGroupRequest& request, const CreateDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDBParameterGroup(request), context);
@@ -642,7 +792,7 @@ CreateDBSecurityGroupOutcome RDSClient::CreateDBSecurityGroup(const CreateDBSecu
 
 CreateDBSecurityGroupOutcomeCallable RDSClient::CreateDBSecurityGroupCallable(const CreateDBSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDBSecurityGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDBSecurityGroup( request ); } );
 }
 
 void RDSClient::CreateDBSecurityGroupAsync(const CreateDBSecurityGroupRequest& request, const CreateDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -650,6 +800,16 @@ void RDSClient::CreateDBSecurityGroupAsync(const CreateDBSecurityGroupRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->CreateDBSecurityGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateDBSecurityGroupOutcomeCallable RDSClient::CreateDBSecurityGroupCallable(CreateDBSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CreateDBSecurityGroup, this, std::move(request)));
+}
+
+void RDSClient::CreateDBSecurityGroupAsync(CreateDBSecurityGroupRequest&& request, const CreateDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CreateDBSecurityGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CreateDBSecurityGroupAsyncHelper(const CreateDBSecurityGroupRequest& request, const CreateDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDBSecurityGroup(request), context);
@@ -672,7 +832,7 @@ CreateDBSnapshotOutcome RDSClient::CreateDBSnapshot(const CreateDBSnapshotReques
 
 CreateDBSnapshotOutcomeCallable RDSClient::CreateDBSnapshotCallable(const CreateDBSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDBSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDBSnapshot( request ); } );
 }
 
 void RDSClient::CreateDBSnapshotAsync(const CreateDBSnapshotRequest& request, const CreateDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -680,6 +840,16 @@ void RDSClient::CreateDBSnapshotAsync(const CreateDBSnapshotRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CreateDBSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+CreateDBSnapshotOutcomeCallable RDSClient::CreateDBSnapshotCallable(CreateDBSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CreateDBSnapshot, this, std::move(request)));
+}
+
+void RDSClient::CreateDBSnapshotAsync(CreateDBSnapshotRequest&& request, const CreateDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CreateDBSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CreateDBSnapshotAsyncHelper(const CreateDBSnapshotRequest& request, const CreateDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDBSnapshot(request), context);
@@ -702,7 +872,7 @@ CreateDBSubnetGroupOutcome RDSClient::CreateDBSubnetGroup(const CreateDBSubnetGr
 
 CreateDBSubnetGroupOutcomeCallable RDSClient::CreateDBSubnetGroupCallable(const CreateDBSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDBSubnetGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDBSubnetGroup( request ); } );
 }
 
 void RDSClient::CreateDBSubnetGroupAsync(const CreateDBSubnetGroupRequest& request, const CreateDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -710,6 +880,16 @@ void RDSClient::CreateDBSubnetGroupAsync(const CreateDBSubnetGroupRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->CreateDBSubnetGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateDBSubnetGroupOutcomeCallable RDSClient::CreateDBSubnetGroupCallable(CreateDBSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CreateDBSubnetGroup, this, std::move(request)));
+}
+
+void RDSClient::CreateDBSubnetGroupAsync(CreateDBSubnetGroupRequest&& request, const CreateDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CreateDBSubnetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CreateDBSubnetGroupAsyncHelper(const CreateDBSubnetGroupRequest& request, const CreateDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDBSubnetGroup(request), context);
@@ -732,7 +912,7 @@ CreateEventSubscriptionOutcome RDSClient::CreateEventSubscription(const CreateEv
 
 CreateEventSubscriptionOutcomeCallable RDSClient::CreateEventSubscriptionCallable(const CreateEventSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateEventSubscription( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateEventSubscription( request ); } );
 }
 
 void RDSClient::CreateEventSubscriptionAsync(const CreateEventSubscriptionRequest& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -740,6 +920,16 @@ void RDSClient::CreateEventSubscriptionAsync(const CreateEventSubscriptionReques
   m_executor->Submit( [this, request, handler, context](){ this->CreateEventSubscriptionAsyncHelper( request, handler, context ); } );
 }
 
+CreateEventSubscriptionOutcomeCallable RDSClient::CreateEventSubscriptionCallable(CreateEventSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CreateEventSubscription, this, std::move(request)));
+}
+
+void RDSClient::CreateEventSubscriptionAsync(CreateEventSubscriptionRequest&& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CreateEventSubscriptionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CreateEventSubscriptionAsyncHelper(const CreateEventSubscriptionRequest& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateEventSubscription(request), context);
@@ -762,7 +952,7 @@ CreateOptionGroupOutcome RDSClient::CreateOptionGroup(const CreateOptionGroupReq
 
 CreateOptionGroupOutcomeCallable RDSClient::CreateOptionGroupCallable(const CreateOptionGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateOptionGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateOptionGroup( request ); } );
 }
 
 void RDSClient::CreateOptionGroupAsync(const CreateOptionGroupRequest& request, const CreateOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -770,6 +960,16 @@ void RDSClient::CreateOptionGroupAsync(const CreateOptionGroupRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->CreateOptionGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateOptionGroupOutcomeCallable RDSClient::CreateOptionGroupCallable(CreateOptionGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::CreateOptionGroup, this, std::move(request)));
+}
+
+void RDSClient::CreateOptionGroupAsync(CreateOptionGroupRequest&& request, const CreateOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::CreateOptionGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::CreateOptionGroupAsyncHelper(const CreateOptionGroupRequest& request, const CreateOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateOptionGroup(request), context);
@@ -792,7 +992,7 @@ DeleteDBClusterOutcome RDSClient::DeleteDBCluster(const DeleteDBClusterRequest&
 
 DeleteDBClusterOutcomeCallable RDSClient::DeleteDBClusterCallable(const DeleteDBClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDBCluster( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDBCluster( request ); } );
 }
 
 void RDSClient::DeleteDBClusterAsync(const DeleteDBClusterRequest& request, const DeleteDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -800,6 +1000,16 @@ void RDSClient::DeleteDBClusterAsync(const DeleteDBClusterRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDBClusterAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDBClusterOutcomeCallable RDSClient::DeleteDBClusterCallable(DeleteDBClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DeleteDBCluster, this, std::move(request)));
+}
+
+void RDSClient::DeleteDBClusterAsync(DeleteDBClusterRequest&& request, const DeleteDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DeleteDBClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DeleteDBClusterAsyncHelper(const DeleteDBClusterRequest& request, const DeleteDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDBCluster(request), context);
@@ -822,7 +1032,7 @@ DeleteDBClusterParameterGroupOutcome RDSClient::DeleteDBClusterParameterGroup(co
 
 DeleteDBClusterParameterGroupOutcomeCallable RDSClient::DeleteDBClusterParameterGroupCallable(const DeleteDBClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDBClusterParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDBClusterParameterGroup( request ); } );
 }
 
 void RDSClient::DeleteDBClusterParameterGroupAsync(const DeleteDBClusterParameterGroupRequest& request, const DeleteDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -830,6 +1040,16 @@ void RDSClient::DeleteDBClusterParameterGroupAsync(const DeleteDBClusterParamete
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDBClusterParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDBClusterParameterGroupOutcomeCallable RDSClient::DeleteDBClusterParameterGroupCallable(DeleteDBClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DeleteDBClusterParameterGroup, this, std::move(request)));
+}
+
+void RDSClient::DeleteDBClusterParameterGroupAsync(DeleteDBClusterParameterGroupRequest&& request, const DeleteDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DeleteDBClusterParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DeleteDBClusterParameterGroupAsyncHelper(const DeleteDBClusterParameterGroupRequest& request, const DeleteDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDBClusterParameterGroup(request), context);
@@ -852,7 +1072,7 @@ DeleteDBClusterSnapshotOutcome RDSClient::DeleteDBClusterSnapshot(const DeleteDB
 
 DeleteDBClusterSnapshotOutcomeCallable RDSClient::DeleteDBClusterSnapshotCallable(const DeleteDBClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDBClusterSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDBClusterSnapshot( request ); } );
 }
 
 void RDSClient::DeleteDBClusterSnapshotAsync(const DeleteDBClusterSnapshotRequest& request, const DeleteDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -860,6 +1080,16 @@ void RDSClient::DeleteDBClusterSnapshotAsync(const DeleteDBClusterSnapshotReques
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDBClusterSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDBClusterSnapshotOutcomeCallable RDSClient::DeleteDBClusterSnapshotCallable(DeleteDBClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DeleteDBClusterSnapshot, this, std::move(request)));
+}
+
+void RDSClient::DeleteDBClusterSnapshotAsync(DeleteDBClusterSnapshotRequest&& request, const DeleteDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DeleteDBClusterSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DeleteDBClusterSnapshotAsyncHelper(const DeleteDBClusterSnapshotRequest& request, const DeleteDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDBClusterSnapshot(request), context);
@@ -882,7 +1112,7 @@ DeleteDBInstanceOutcome RDSClient::DeleteDBInstance(const DeleteDBInstanceReques
 
 DeleteDBInstanceOutcomeCallable RDSClient::DeleteDBInstanceCallable(const DeleteDBInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDBInstance( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDBInstance( request ); } );
 }
 
 void RDSClient::DeleteDBInstanceAsync(const DeleteDBInstanceRequest& request, const DeleteDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -890,6 +1120,16 @@ void RDSClient::DeleteDBInstanceAsync(const DeleteDBInstanceRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDBInstanceAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDBInstanceOutcomeCallable RDSClient::DeleteDBInstanceCallable(DeleteDBInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DeleteDBInstance, this, std::move(request)));
+}
+
+void RDSClient::DeleteDBInstanceAsync(DeleteDBInstanceRequest&& request, const DeleteDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DeleteDBInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DeleteDBInstanceAsyncHelper(const DeleteDBInstanceRequest& request, const DeleteDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDBInstance(request), context);
@@ -912,7 +1152,7 @@ DeleteDBParameterGroupOutcome RDSClient::DeleteDBParameterGroup(const DeleteDBPa
 
 DeleteDBParameterGroupOutcomeCallable RDSClient::DeleteDBParameterGroupCallable(const DeleteDBParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDBParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDBParameterGroup( request ); } );
 }
 
 void RDSClient::DeleteDBParameterGroupAsync(const DeleteDBParameterGroupRequest& request, const DeleteDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -920,6 +1160,16 @@ void RDSClient::DeleteDBParameterGroupAsync(const DeleteDBParameterGroupRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDBParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDBParameterGroupOutcomeCallable RDSClient::DeleteDBParameterGroupCallable(DeleteDBParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DeleteDBParameterGroup, this, std::move(request)));
+}
+
+void RDSClient::DeleteDBParameterGroupAsync(DeleteDBParameterGroupRequest&& request, const DeleteDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DeleteDBParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DeleteDBParameterGroupAsyncHelper(const DeleteDBParameterGroupRequest& request, const DeleteDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDBParameterGroup(request), context);
@@ -942,7 +1192,7 @@ DeleteDBSecurityGroupOutcome RDSClient::DeleteDBSecurityGroup(const DeleteDBSecu
 
 DeleteDBSecurityGroupOutcomeCallable RDSClient::DeleteDBSecurityGroupCallable(const DeleteDBSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDBSecurityGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDBSecurityGroup( request ); } );
 }
 
 void RDSClient::DeleteDBSecurityGroupAsync(const DeleteDBSecurityGroupRequest& request, const DeleteDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -950,6 +1200,16 @@ void RDSClient::DeleteDBSecurityGroupAsync(const DeleteDBSecurityGroupRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDBSecurityGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDBSecurityGroupOutcomeCallable RDSClient::DeleteDBSecurityGroupCallable(DeleteDBSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DeleteDBSecurityGroup, this, std::move(request)));
+}
+
+void RDSClient::DeleteDBSecurityGroupAsync(DeleteDBSecurityGroupRequest&& request, const DeleteDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DeleteDBSecurityGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DeleteDBSecurityGroupAsyncHelper(const DeleteDBSecurityGroupRequest& request, const DeleteDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDBSecurityGroup(request), context);
@@ -972,7 +1232,7 @@ DeleteDBSnapshotOutcome RDSClient::DeleteDBSnapshot(const DeleteDBSnapshotReques
 
 DeleteDBSnapshotOutcomeCallable RDSClient::DeleteDBSnapshotCallable(const DeleteDBSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDBSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDBSnapshot( request ); } );
 }
 
 void RDSClient::DeleteDBSnapshotAsync(const DeleteDBSnapshotRequest& request, const DeleteDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -980,6 +1240,16 @@ void RDSClient::DeleteDBSnapshotAsync(const DeleteDBSnapshotRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDBSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDBSnapshotOutcomeCallable RDSClient::DeleteDBSnapshotCallable(DeleteDBSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DeleteDBSnapshot, this, std::move(request)));
+}
+
+void RDSClient::DeleteDBSnapshotAsync(DeleteDBSnapshotRequest&& request, const DeleteDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DeleteDBSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DeleteDBSnapshotAsyncHelper(const DeleteDBSnapshotRequest& request, const DeleteDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDBSnapshot(request), context);
@@ -1002,7 +1272,7 @@ DeleteDBSubnetGroupOutcome RDSClient::DeleteDBSubnetGroup(const DeleteDBSubnetGr
 
 DeleteDBSubnetGroupOutcomeCallable RDSClient::DeleteDBSubnetGroupCallable(const DeleteDBSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDBSubnetGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDBSubnetGroup( request ); } );
 }
 
 void RDSClient::DeleteDBSubnetGroupAsync(const DeleteDBSubnetGroupRequest& request, const DeleteDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1010,6 +1280,16 @@ void RDSClient::DeleteDBSubnetGroupAsync(const DeleteDBSubnetGroupRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDBSubnetGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDBSubnetGroupOutcomeCallable RDSClient::DeleteDBSubnetGroupCallable(DeleteDBSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DeleteDBSubnetGroup, this, std::move(request)));
+}
+
+void RDSClient::DeleteDBSubnetGroupAsync(DeleteDBSubnetGroupRequest&& request, const DeleteDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DeleteDBSubnetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DeleteDBSubnetGroupAsyncHelper(const DeleteDBSubnetGroupRequest& request, const DeleteDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDBSubnetGroup(request), context);
@@ -1032,7 +1312,7 @@ DeleteEventSubscriptionOutcome RDSClient::DeleteEventSubscription(const DeleteEv
 
 DeleteEventSubscriptionOutcomeCallable RDSClient::DeleteEventSubscriptionCallable(const DeleteEventSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteEventSubscription( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteEventSubscription( request ); } );
 }
 
 void RDSClient::DeleteEventSubscriptionAsync(const DeleteEventSubscriptionRequest& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1040,6 +1320,16 @@ void RDSClient::DeleteEventSubscriptionAsync(const DeleteEventSubscriptionReques
   m_executor->Submit( [this, request, handler, context](){ this->DeleteEventSubscriptionAsyncHelper( request, handler, context ); } );
 }
 
+DeleteEventSubscriptionOutcomeCallable RDSClient::DeleteEventSubscriptionCallable(DeleteEventSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DeleteEventSubscription, this, std::move(request)));
+}
+
+void RDSClient::DeleteEventSubscriptionAsync(DeleteEventSubscriptionRequest&& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DeleteEventSubscriptionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DeleteEventSubscriptionAsyncHelper(const DeleteEventSubscriptionRequest& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteEventSubscription(request), context);
@@ -1062,7 +1352,7 @@ DeleteOptionGroupOutcome RDSClient::DeleteOptionGroup(const DeleteOptionGroupReq
 
 DeleteOptionGroupOutcomeCallable RDSClient::DeleteOptionGroupCallable(const DeleteOptionGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteOptionGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteOptionGroup( request ); } );
 }
 
 void RDSClient::DeleteOptionGroupAsync(const DeleteOptionGroupRequest& request, const DeleteOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1070,6 +1360,16 @@ void RDSClient::DeleteOptionGroupAsync(const DeleteOptionGroupRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DeleteOptionGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteOptionGroupOutcomeCallable RDSClient::DeleteOptionGroupCallable(DeleteOptionGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DeleteOptionGroup, this, std::move(request)));
+}
+
+void RDSClient::DeleteOptionGroupAsync(DeleteOptionGroupRequest&& request, const DeleteOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DeleteOptionGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DeleteOptionGroupAsyncHelper(const DeleteOptionGroupRequest& request, const DeleteOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteOptionGroup(request), context);
@@ -1092,7 +1392,7 @@ DescribeAccountAttributesOutcome RDSClient::DescribeAccountAttributes(const Desc
 
 DescribeAccountAttributesOutcomeCallable RDSClient::DescribeAccountAttributesCallable(const DescribeAccountAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAccountAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAccountAttributes( request ); } );
 }
 
 void RDSClient::DescribeAccountAttributesAsync(const DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1100,6 +1400,16 @@ void RDSClient::DescribeAccountAttributesAsync(const DescribeAccountAttributesRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAccountAttributesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAccountAttributesOutcomeCallable RDSClient::DescribeAccountAttributesCallable(DescribeAccountAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeAccountAttributes, this, std::move(request)));
+}
+
+void RDSClient::DescribeAccountAttributesAsync(DescribeAccountAttributesRequest&& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeAccountAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeAccountAttributesAsyncHelper(const DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAccountAttributes(request), context);
@@ -1122,7 +1432,7 @@ DescribeCertificatesOutcome RDSClient::DescribeCertificates(const DescribeCertif
 
 DescribeCertificatesOutcomeCallable RDSClient::DescribeCertificatesCallable(const DescribeCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCertificates( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCertificates( request ); } );
 }
 
 void RDSClient::DescribeCertificatesAsync(const DescribeCertificatesRequest& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1130,6 +1440,16 @@ void RDSClient::DescribeCertificatesAsync(const DescribeCertificatesRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCertificatesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCertificatesOutcomeCallable RDSClient::DescribeCertificatesCallable(DescribeCertificatesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeCertificates, this, std::move(request)));
+}
+
+void RDSClient::DescribeCertificatesAsync(DescribeCertificatesRequest&& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeCertificatesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeCertificatesAsyncHelper(const DescribeCertificatesRequest& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCertificates(request), context);
@@ -1152,7 +1472,7 @@ DescribeDBClusterParameterGroupsOutcome RDSClient::DescribeDBClusterParameterGro
 
 DescribeDBClusterParameterGroupsOutcomeCallable RDSClient::DescribeDBClusterParameterGroupsCallable(const DescribeDBClusterParameterGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDBClusterParameterGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDBClusterParameterGroups( request ); } );
 }
 
 void RDSClient::DescribeDBClusterParameterGroupsAsync(const DescribeDBClusterParameterGroupsRequest& request, const DescribeDBClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1160,6 +1480,16 @@ void RDSClient::DescribeDBClusterParameterGroupsAsync(const DescribeDBClusterPar
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDBClusterParameterGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDBClusterParameterGroupsOutcomeCallable RDSClient::DescribeDBClusterParameterGroupsCallable(DescribeDBClusterParameterGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeDBClusterParameterGroups, this, std::move(request)));
+}
+
+void RDSClient::DescribeDBClusterParameterGroupsAsync(DescribeDBClusterParameterGroupsRequest&& request, const DescribeDBClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeDBClusterParameterGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeDBClusterParameterGroupsAsyncHelper(const DescribeDBClusterParameterGroupsRequest& request, const DescribeDBClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDBClusterParameterGroups(request), context);
@@ -1182,7 +1512,7 @@ DescribeDBClusterParametersOutcome RDSClient::DescribeDBClusterParameters(const
 
 DescribeDBClusterParametersOutcomeCallable RDSClient::DescribeDBClusterParametersCallable(const DescribeDBClusterParametersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDBClusterParameters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDBClusterParameters( request ); } );
 }
 
 void RDSClient::DescribeDBClusterParametersAsync(const DescribeDBClusterParametersRequest& request, const DescribeDBClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1190,6 +1520,16 @@ void RDSClient::DescribeDBClusterParametersAsync(const DescribeDBClusterParamete
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDBClusterParametersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDBClusterParametersOutcomeCallable RDSClient::DescribeDBClusterParametersCallable(DescribeDBClusterParametersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeDBClusterParameters, this, std::move(request)));
+}
+
+void RDSClient::DescribeDBClusterParametersAsync(DescribeDBClusterParametersRequest&& request, const DescribeDBClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeDBClusterParametersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeDBClusterParametersAsyncHelper(const DescribeDBClusterParametersRequest& request, const DescribeDBClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDBClusterParameters(request), context);
@@ -1212,7 +1552,7 @@ DescribeDBClusterSnapshotAttributesOutcome RDSClient::DescribeDBClusterSnapshotA
 
 DescribeDBClusterSnapshotAttributesOutcomeCallable RDSClient::DescribeDBClusterSnapshotAttributesCallable(const DescribeDBClusterSnapshotAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDBClusterSnapshotAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDBClusterSnapshotAttributes( request ); } );
 }
 
 void RDSClient::DescribeDBClusterSnapshotAttributesAsync(const DescribeDBClusterSnapshotAttributesRequest& request, const DescribeDBClusterSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1220,6 +1560,16 @@ void RDSClient::DescribeDBClusterSnapshotAttributesAsync(const DescribeDBCluster
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDBClusterSnapshotAttributesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDBClusterSnapshotAttributesOutcomeCallable RDSClient::DescribeDBClusterSnapshotAttributesCallable(DescribeDBClusterSnapshotAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeDBClusterSnapshotAttributes, this, std::move(request)));
+}
+
+void RDSClient::DescribeDBClusterSnapshotAttributesAsync(DescribeDBClusterSnapshotAttributesRequest&& request, const DescribeDBClusterSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeDBClusterSnapshotAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeDBClusterSnapshotAttributesAsyncHelper(const DescribeDBClusterSnapshotAttributesRequest& request, const DescribeDBClusterSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDBClusterSnapshotAttributes(request), context);
@@ -1242,7 +1592,7 @@ DescribeDBClusterSnapshotsOutcome RDSClient::DescribeDBClusterSnapshots(const De
 
 DescribeDBClusterSnapshotsOutcomeCallable RDSClient::DescribeDBClusterSnapshotsCallable(const DescribeDBClusterSnapshotsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDBClusterSnapshots( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDBClusterSnapshots( request ); } );
 }
 
 void RDSClient::DescribeDBClusterSnapshotsAsync(const DescribeDBClusterSnapshotsRequest& request, const DescribeDBClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1250,6 +1600,16 @@ void RDSClient::DescribeDBClusterSnapshotsAsync(const DescribeDBClusterSnapshots
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDBClusterSnapshotsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDBClusterSnapshotsOutcomeCallable RDSClient::DescribeDBClusterSnapshotsCallable(DescribeDBClusterSnapshotsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeDBClusterSnapshots, this, std::move(request)));
+}
+
+void RDSClient::DescribeDBClusterSnapshotsAsync(DescribeDBClusterSnapshotsRequest&& request, const DescribeDBClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeDBClusterSnapshotsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeDBClusterSnapshotsAsyncHelper(const DescribeDBClusterSnapshotsRequest& request, const DescribeDBClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDBClusterSnapshots(request), context);
@@ -1272,7 +1632,7 @@ DescribeDBClustersOutcome RDSClient::DescribeDBClusters(const DescribeDBClusters
 
 DescribeDBClustersOutcomeCallable RDSClient::DescribeDBClustersCallable(const DescribeDBClustersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDBClusters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDBClusters( request ); } );
 }
 
 void RDSClient::DescribeDBClustersAsync(const DescribeDBClustersRequest& request, const DescribeDBClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1280,6 +1640,16 @@ void RDSClient::DescribeDBClustersAsync(const DescribeDBClustersRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDBClustersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDBClustersOutcomeCallable RDSClient::DescribeDBClustersCallable(DescribeDBClustersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeDBClusters, this, std::move(request)));
+}
+
+void RDSClient::DescribeDBClustersAsync(DescribeDBClustersRequest&& request, const DescribeDBClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeDBClustersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeDBClustersAsyncHelper(const DescribeDBClustersRequest& request, const DescribeDBClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDBClusters(request), context);
@@ -1302,7 +1672,7 @@ DescribeDBEngineVersionsOutcome RDSClient::DescribeDBEngineVersions(const Descri
 
 DescribeDBEngineVersionsOutcomeCallable RDSClient::DescribeDBEngineVersionsCallable(const DescribeDBEngineVersionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDBEngineVersions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDBEngineVersions( request ); } );
 }
 
 void RDSClient::DescribeDBEngineVersionsAsync(const DescribeDBEngineVersionsRequest& request, const DescribeDBEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1310,6 +1680,16 @@ void RDSClient::DescribeDBEngineVersionsAsync(const DescribeDBEngineVersionsRequ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDBEngineVersionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDBEngineVersionsOutcomeCallable RDSClient::DescribeDBEngineVersionsCallable(DescribeDBEngineVersionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeDBEngineVersions, this, std::move(request)));
+}
+
+void RDSClient::DescribeDBEngineVersionsAsync(DescribeDBEngineVersionsRequest&& request, const DescribeDBEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeDBEngineVersionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeDBEngineVersionsAsyncHelper(const DescribeDBEngineVersionsRequest& request, const DescribeDBEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDBEngineVersions(request), context);
@@ -1332,7 +1712,7 @@ DescribeDBInstancesOutcome RDSClient::DescribeDBInstances(const DescribeDBInstan
 
 DescribeDBInstancesOutcomeCallable RDSClient::DescribeDBInstancesCallable(const DescribeDBInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDBInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDBInstances( request ); } );
 }
 
 void RDSClient::DescribeDBInstancesAsync(const DescribeDBInstancesRequest& request, const DescribeDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1340,6 +1720,16 @@ void RDSClient::DescribeDBInstancesAsync(const DescribeDBInstancesRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDBInstancesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDBInstancesOutcomeCallable RDSClient::DescribeDBInstancesCallable(DescribeDBInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeDBInstances, this, std::move(request)));
+}
+
+void RDSClient::DescribeDBInstancesAsync(DescribeDBInstancesRequest&& request, const DescribeDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeDBInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeDBInstancesAsyncHelper(const DescribeDBInstancesRequest& request, const DescribeDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDBInstances(request), context);
@@ -1362,7 +1752,7 @@ DescribeDBLogFilesOutcome RDSClient::DescribeDBLogFiles(const DescribeDBLogFiles
 
 DescribeDBLogFilesOutcomeCallable RDSClient::DescribeDBLogFilesCallable(const DescribeDBLogFilesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDBLogFiles( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDBLogFiles( request ); } );
 }
 
 void RDSClient::DescribeDBLogFilesAsync(const DescribeDBLogFilesRequest& request, const DescribeDBLogFilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1370,6 +1760,16 @@ void RDSClient::DescribeDBLogFilesAsync(const DescribeDBLogFilesRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDBLogFilesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDBLogFilesOutcomeCallable RDSClient::DescribeDBLogFilesCallable(DescribeDBLogFilesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeDBLogFiles, this, std::move(request)));
+}
+
+void RDSClient::DescribeDBLogFilesAsync(DescribeDBLogFilesRequest&& request, const DescribeDBLogFilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeDBLogFilesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeDBLogFilesAsyncHelper(const DescribeDBLogFilesRequest& request, const DescribeDBLogFilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDBLogFiles(request), context);
@@ -1392,7 +1792,7 @@ DescribeDBParameterGroupsOutcome RDSClient::DescribeDBParameterGroups(const Desc
 
 DescribeDBParameterGroupsOutcomeCallable RDSClient::DescribeDBParameterGroupsCallable(const DescribeDBParameterGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDBParameterGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDBParameterGroups( request ); } );
 }
 
 void RDSClient::DescribeDBParameterGroupsAsync(const DescribeDBParameterGroupsRequest& request, const DescribeDBParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1400,6 +1800,16 @@ void RDSClient::DescribeDBParameterGroupsAsync(const DescribeDBParameterGroupsRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDBParameterGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDBParameterGroupsOutcomeCallable RDSClient::DescribeDBParameterGroupsCallable(DescribeDBParameterGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeDBParameterGroups, this, std::move(request)));
+}
+
+void RDSClient::DescribeDBParameterGroupsAsync(DescribeDBParameterGroupsRequest&& request, const DescribeDBParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeDBParameterGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeDBParameterGroupsAsyncHelper(const DescribeDBParameterGroupsRequest& request, const DescribeDBParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDBParameterGroups(request), context);
@@ -1422,7 +1832,7 @@ DescribeDBParametersOutcome RDSClient::DescribeDBParameters(const DescribeDBPara
 
 DescribeDBParametersOutcomeCallable RDSClient::DescribeDBParametersCallable(const DescribeDBParametersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDBParameters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDBParameters( request ); } );
 }
 
 void RDSClient::DescribeDBParametersAsync(const DescribeDBParametersRequest& request, const DescribeDBParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1430,6 +1840,16 @@ void RDSClient::DescribeDBParametersAsync(const DescribeDBParametersRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDBParametersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDBParametersOutcomeCallable RDSClient::DescribeDBParametersCallable(DescribeDBParametersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeDBParameters, this, std::move(request)));
+}
+
+void RDSClient::DescribeDBParametersAsync(DescribeDBParametersRequest&& request, const DescribeDBParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeDBParametersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeDBParametersAsyncHelper(const DescribeDBParametersRequest& request, const DescribeDBParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDBParameters(request), context);
@@ -1452,7 +1872,7 @@ DescribeDBSecurityGroupsOutcome RDSClient::DescribeDBSecurityGroups(const Descri
 
 DescribeDBSecurityGroupsOutcomeCallable RDSClient::DescribeDBSecurityGroupsCallable(const DescribeDBSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDBSecurityGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDBSecurityGroups( request ); } );
 }
 
 void RDSClient::DescribeDBSecurityGroupsAsync(const DescribeDBSecurityGroupsRequest& request, const DescribeDBSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1460,14 +1880,24 @@ void RDSClient::DescribeDBSecurityGroupsAsync(const DescribeDBSecurityGroupsRequ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDBSecurityGroupsAsyncHelper( request, handler, context ); } );
 }
 
-void RDSClient::DescribeDBSecurityGroupsAsyncHelper(const DescribeDBSecurityGroupsRequest& request, const DescribeDBSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+DescribeDBSecurityGroupsOutcomeCallable RDSClient::DescribeDBSecurityGroupsCallable(DescribeDBSecurityGroupsRequest&& request) const
 {
-  handler(this, request, DescribeDBSecurityGroups(request), context);
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeDBSecurityGroups, this, std::move(request)));
 }
 
-DescribeDBSnapshotAttributesOutcome RDSClient::DescribeDBSnapshotAttributes(const DescribeDBSnapshotAttributesRequest& request) const
+void RDSClient::DescribeDBSecurityGroupsAsync(DescribeDBSecurityGroupsRequest&& request, const DescribeDBSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  Aws::StringStream ss;
+  m_executor->Submit(&RDSClient::DescribeDBSecurityGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
+void RDSClient::DescribeDBSecurityGroupsAsyncHelper(const DescribeDBSecurityGroupsRequest& request, const DescribeDBSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  handler(this, request, DescribeDBSecurityGroups(request), context);
+}
+
+DescribeDBSnapshotAttributesOutcome RDSClient::DescribeDBSnapshotAttributes(const DescribeDBSnapshotAttributesRequest& request) const
+{
+  Aws::StringStream ss;
   ss << m_uri << "/";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
@@ -1482,7 +1912,7 @@ DescribeDBSnapshotAttributesOutcome RDSClient::DescribeDBSnapshotAttributes(cons
 
 DescribeDBSnapshotAttributesOutcomeCallable RDSClient::DescribeDBSnapshotAttributesCallable(const DescribeDBSnapshotAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDBSnapshotAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDBSnapshotAttributes( request ); } );
 }
 
 void RDSClient::DescribeDBSnapshotAttributesAsync(const DescribeDBSnapshotAttributesRequest& request, const DescribeDBSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1490,6 +1920,16 @@ void RDSClient::DescribeDBSnapshotAttributesAsync(const DescribeDBSnapshotAttrib
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDBSnapshotAttributesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDBSnapshotAttributesOutcomeCallable RDSClient::DescribeDBSnapshotAttributesCallable(DescribeDBSnapshotAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeDBSnapshotAttributes, this, std::move(request)));
+}
+
+void RDSClient::DescribeDBSnapshotAttributesAsync(DescribeDBSnapshotAttributesRequest&& request, const DescribeDBSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeDBSnapshotAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeDBSnapshotAttributesAsyncHelper(const DescribeDBSnapshotAttributesRequest& request, const DescribeDBSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDBSnapshotAttributes(request), context);
@@ -1512,7 +1952,7 @@ DescribeDBSnapshotsOutcome RDSClient::DescribeDBSnapshots(const DescribeDBSnapsh
 
 DescribeDBSnapshotsOutcomeCallable RDSClient::DescribeDBSnapshotsCallable(const DescribeDBSnapshotsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDBSnapshots( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDBSnapshots( request ); } );
 }
 
 void RDSClient::DescribeDBSnapshotsAsync(const DescribeDBSnapshotsRequest& request, const DescribeDBSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1520,6 +1960,16 @@ void RDSClient::DescribeDBSnapshotsAsync(const DescribeDBSnapshotsRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDBSnapshotsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDBSnapshotsOutcomeCallable RDSClient::DescribeDBSnapshotsCallable(DescribeDBSnapshotsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeDBSnapshots, this, std::move(request)));
+}
+
+void RDSClient::DescribeDBSnapshotsAsync(DescribeDBSnapshotsRequest&& request, const DescribeDBSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeDBSnapshotsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeDBSnapshotsAsyncHelper(const DescribeDBSnapshotsRequest& request, const DescribeDBSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDBSnapshots(request), context);
@@ -1542,7 +1992,7 @@ DescribeDBSubnetGroupsOutcome RDSClient::DescribeDBSubnetGroups(const DescribeDB
 
 DescribeDBSubnetGroupsOutcomeCallable RDSClient::DescribeDBSubnetGroupsCallable(const DescribeDBSubnetGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDBSubnetGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDBSubnetGroups( request ); } );
 }
 
 void RDSClient::DescribeDBSubnetGroupsAsync(const DescribeDBSubnetGroupsRequest& request, const DescribeDBSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1550,6 +2000,16 @@ void RDSClient::DescribeDBSubnetGroupsAsync(const DescribeDBSubnetGroupsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDBSubnetGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDBSubnetGroupsOutcomeCallable RDSClient::DescribeDBSubnetGroupsCallable(DescribeDBSubnetGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeDBSubnetGroups, this, std::move(request)));
+}
+
+void RDSClient::DescribeDBSubnetGroupsAsync(DescribeDBSubnetGroupsRequest&& request, const DescribeDBSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeDBSubnetGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeDBSubnetGroupsAsyncHelper(const DescribeDBSubnetGroupsRequest& request, const DescribeDBSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDBSubnetGroups(request), context);
@@ -1572,7 +2032,7 @@ DescribeEngineDefaultClusterParametersOutcome RDSClient::DescribeEngineDefaultCl
 
 DescribeEngineDefaultClusterParametersOutcomeCallable RDSClient::DescribeEngineDefaultClusterParametersCallable(const DescribeEngineDefaultClusterParametersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEngineDefaultClusterParameters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEngineDefaultClusterParameters( request ); } );
 }
 
 void RDSClient::DescribeEngineDefaultClusterParametersAsync(const DescribeEngineDefaultClusterParametersRequest& request, const DescribeEngineDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1580,6 +2040,16 @@ void RDSClient::DescribeEngineDefaultClusterParametersAsync(const DescribeEngine
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEngineDefaultClusterParametersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEngineDefaultClusterParametersOutcomeCallable RDSClient::DescribeEngineDefaultClusterParametersCallable(DescribeEngineDefaultClusterParametersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeEngineDefaultClusterParameters, this, std::move(request)));
+}
+
+void RDSClient::DescribeEngineDefaultClusterParametersAsync(DescribeEngineDefaultClusterParametersRequest&& request, const DescribeEngineDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeEngineDefaultClusterParametersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeEngineDefaultClusterParametersAsyncHelper(const DescribeEngineDefaultClusterParametersRequest& request, const DescribeEngineDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEngineDefaultClusterParameters(request), context);
@@ -1602,7 +2072,7 @@ DescribeEngineDefaultParametersOutcome RDSClient::DescribeEngineDefaultParameter
 
 DescribeEngineDefaultParametersOutcomeCallable RDSClient::DescribeEngineDefaultParametersCallable(const DescribeEngineDefaultParametersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEngineDefaultParameters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEngineDefaultParameters( request ); } );
 }
 
 void RDSClient::DescribeEngineDefaultParametersAsync(const DescribeEngineDefaultParametersRequest& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1610,6 +2080,16 @@ void RDSClient::DescribeEngineDefaultParametersAsync(const DescribeEngineDefault
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEngineDefaultParametersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEngineDefaultParametersOutcomeCallable RDSClient::DescribeEngineDefaultParametersCallable(DescribeEngineDefaultParametersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeEngineDefaultParameters, this, std::move(request)));
+}
+
+void RDSClient::DescribeEngineDefaultParametersAsync(DescribeEngineDefaultParametersRequest&& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeEngineDefaultParametersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeEngineDefaultParametersAsyncHelper(const DescribeEngineDefaultParametersRequest& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEngineDefaultParameters(request), context);
@@ -1632,7 +2112,7 @@ DescribeEventCategoriesOutcome RDSClient::DescribeEventCategories(const Describe
 
 DescribeEventCategoriesOutcomeCallable RDSClient::DescribeEventCategoriesCallable(const DescribeEventCategoriesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEventCategories( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEventCategories( request ); } );
 }
 
 void RDSClient::DescribeEventCategoriesAsync(const DescribeEventCategoriesRequest& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1640,6 +2120,16 @@ void RDSClient::DescribeEventCategoriesAsync(const DescribeEventCategoriesReques
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEventCategoriesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEventCategoriesOutcomeCallable RDSClient::DescribeEventCategoriesCallable(DescribeEventCategoriesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeEventCategories, this, std::move(request)));
+}
+
+void RDSClient::DescribeEventCategoriesAsync(DescribeEventCategoriesRequest&& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeEventCategoriesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeEventCategoriesAsyncHelper(const DescribeEventCategoriesRequest& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEventCategories(request), context);
@@ -1662,7 +2152,7 @@ DescribeEventSubscriptionsOutcome RDSClient::DescribeEventSubscriptions(const De
 
 DescribeEventSubscriptionsOutcomeCallable RDSClient::DescribeEventSubscriptionsCallable(const DescribeEventSubscriptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEventSubscriptions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEventSubscriptions( request ); } );
 }
 
 void RDSClient::DescribeEventSubscriptionsAsync(const DescribeEventSubscriptionsRequest& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1670,6 +2160,16 @@ void RDSClient::DescribeEventSubscriptionsAsync(const DescribeEventSubscriptions
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEventSubscriptionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEventSubscriptionsOutcomeCallable RDSClient::DescribeEventSubscriptionsCallable(DescribeEventSubscriptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeEventSubscriptions, this, std::move(request)));
+}
+
+void RDSClient::DescribeEventSubscriptionsAsync(DescribeEventSubscriptionsRequest&& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeEventSubscriptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeEventSubscriptionsAsyncHelper(const DescribeEventSubscriptionsRequest& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEventSubscriptions(request), context);
@@ -1692,7 +2192,7 @@ DescribeEventsOutcome RDSClient::DescribeEvents(const DescribeEventsRequest& req
 
 DescribeEventsOutcomeCallable RDSClient::DescribeEventsCallable(const DescribeEventsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEvents( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEvents( request ); } );
 }
 
 void RDSClient::DescribeEventsAsync(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1700,6 +2200,16 @@ void RDSClient::DescribeEventsAsync(const DescribeEventsRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEventsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEventsOutcomeCallable RDSClient::DescribeEventsCallable(DescribeEventsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeEvents, this, std::move(request)));
+}
+
+void RDSClient::DescribeEventsAsync(DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeEventsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeEventsAsyncHelper(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEvents(request), context);
@@ -1722,7 +2232,7 @@ DescribeOptionGroupOptionsOutcome RDSClient::DescribeOptionGroupOptions(const De
 
 DescribeOptionGroupOptionsOutcomeCallable RDSClient::DescribeOptionGroupOptionsCallable(const DescribeOptionGroupOptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeOptionGroupOptions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeOptionGroupOptions( request ); } );
 }
 
 void RDSClient::DescribeOptionGroupOptionsAsync(const DescribeOptionGroupOptionsRequest& request, const DescribeOptionGroupOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1730,6 +2240,16 @@ void RDSClient::DescribeOptionGroupOptionsAsync(const DescribeOptionGroupOptions
   m_executor->Submit( [this, request, handler, context](){ this->DescribeOptionGroupOptionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeOptionGroupOptionsOutcomeCallable RDSClient::DescribeOptionGroupOptionsCallable(DescribeOptionGroupOptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeOptionGroupOptions, this, std::move(request)));
+}
+
+void RDSClient::DescribeOptionGroupOptionsAsync(DescribeOptionGroupOptionsRequest&& request, const DescribeOptionGroupOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeOptionGroupOptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeOptionGroupOptionsAsyncHelper(const DescribeOptionGroupOptionsRequest& request, const DescribeOptionGroupOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeOptionGroupOptions(request), context);
@@ -1752,7 +2272,7 @@ DescribeOptionGroupsOutcome RDSClient::DescribeOptionGroups(const DescribeOption
 
 DescribeOptionGroupsOutcomeCallable RDSClient::DescribeOptionGroupsCallable(const DescribeOptionGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeOptionGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeOptionGroups( request ); } );
 }
 
 void RDSClient::DescribeOptionGroupsAsync(const DescribeOptionGroupsRequest& request, const DescribeOptionGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1760,6 +2280,16 @@ void RDSClient::DescribeOptionGroupsAsync(const DescribeOptionGroupsRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DescribeOptionGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeOptionGroupsOutcomeCallable RDSClient::DescribeOptionGroupsCallable(DescribeOptionGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeOptionGroups, this, std::move(request)));
+}
+
+void RDSClient::DescribeOptionGroupsAsync(DescribeOptionGroupsRequest&& request, const DescribeOptionGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeOptionGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeOptionGroupsAsyncHelper(const DescribeOptionGroupsRequest& request, const DescribeOptionGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeOptionGroups(request), context);
@@ -1782,7 +2312,7 @@ DescribeOrderableDBInstanceOptionsOutcome RDSClient::DescribeOrderableDBInstance
 
 DescribeOrderableDBInstanceOptionsOutcomeCallable RDSClient::DescribeOrderableDBInstanceOptionsCallable(const DescribeOrderableDBInstanceOptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeOrderableDBInstanceOptions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeOrderableDBInstanceOptions( request ); } );
 }
 
 void RDSClient::DescribeOrderableDBInstanceOptionsAsync(const DescribeOrderableDBInstanceOptionsRequest& request, const DescribeOrderableDBInstanceOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1790,6 +2320,16 @@ void RDSClient::DescribeOrderableDBInstanceOptionsAsync(const DescribeOrderableD
   m_executor->Submit( [this, request, handler, context](){ this->DescribeOrderableDBInstanceOptionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeOrderableDBInstanceOptionsOutcomeCallable RDSClient::DescribeOrderableDBInstanceOptionsCallable(DescribeOrderableDBInstanceOptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeOrderableDBInstanceOptions, this, std::move(request)));
+}
+
+void RDSClient::DescribeOrderableDBInstanceOptionsAsync(DescribeOrderableDBInstanceOptionsRequest&& request, const DescribeOrderableDBInstanceOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeOrderableDBInstanceOptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeOrderableDBInstanceOptionsAsyncHelper(const DescribeOrderableDBInstanceOptionsRequest& request, const DescribeOrderableDBInstanceOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeOrderableDBInstanceOptions(request), context);
@@ -1812,7 +2352,7 @@ DescribePendingMaintenanceActionsOutcome RDSClient::DescribePendingMaintenanceAc
 
 DescribePendingMaintenanceActionsOutcomeCallable RDSClient::DescribePendingMaintenanceActionsCallable(const DescribePendingMaintenanceActionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribePendingMaintenanceActions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribePendingMaintenanceActions( request ); } );
 }
 
 void RDSClient::DescribePendingMaintenanceActionsAsync(const DescribePendingMaintenanceActionsRequest& request, const DescribePendingMaintenanceActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1820,6 +2360,16 @@ void RDSClient::DescribePendingMaintenanceActionsAsync(const DescribePendingMain
   m_executor->Submit( [this, request, handler, context](){ this->DescribePendingMaintenanceActionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribePendingMaintenanceActionsOutcomeCallable RDSClient::DescribePendingMaintenanceActionsCallable(DescribePendingMaintenanceActionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribePendingMaintenanceActions, this, std::move(request)));
+}
+
+void RDSClient::DescribePendingMaintenanceActionsAsync(DescribePendingMaintenanceActionsRequest&& request, const DescribePendingMaintenanceActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribePendingMaintenanceActionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribePendingMaintenanceActionsAsyncHelper(const DescribePendingMaintenanceActionsRequest& request, const DescribePendingMaintenanceActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribePendingMaintenanceActions(request), context);
@@ -1842,7 +2392,7 @@ DescribeReservedDBInstancesOutcome RDSClient::DescribeReservedDBInstances(const
 
 DescribeReservedDBInstancesOutcomeCallable RDSClient::DescribeReservedDBInstancesCallable(const DescribeReservedDBInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReservedDBInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReservedDBInstances( request ); } );
 }
 
 void RDSClient::DescribeReservedDBInstancesAsync(const DescribeReservedDBInstancesRequest& request, const DescribeReservedDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1850,6 +2400,16 @@ void RDSClient::DescribeReservedDBInstancesAsync(const DescribeReservedDBInstanc
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReservedDBInstancesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReservedDBInstancesOutcomeCallable RDSClient::DescribeReservedDBInstancesCallable(DescribeReservedDBInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeReservedDBInstances, this, std::move(request)));
+}
+
+void RDSClient::DescribeReservedDBInstancesAsync(DescribeReservedDBInstancesRequest&& request, const DescribeReservedDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeReservedDBInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeReservedDBInstancesAsyncHelper(const DescribeReservedDBInstancesRequest& request, const DescribeReservedDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReservedDBInstances(request), context);
@@ -1872,7 +2432,7 @@ DescribeReservedDBInstancesOfferingsOutcome RDSClient::DescribeReservedDBInstanc
 
 DescribeReservedDBInstancesOfferingsOutcomeCallable RDSClient::DescribeReservedDBInstancesOfferingsCallable(const DescribeReservedDBInstancesOfferingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReservedDBInstancesOfferings( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReservedDBInstancesOfferings( request ); } );
 }
 
 void RDSClient::DescribeReservedDBInstancesOfferingsAsync(const DescribeReservedDBInstancesOfferingsRequest& request, const DescribeReservedDBInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1880,6 +2440,16 @@ void RDSClient::DescribeReservedDBInstancesOfferingsAsync(const DescribeReserved
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReservedDBInstancesOfferingsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReservedDBInstancesOfferingsOutcomeCallable RDSClient::DescribeReservedDBInstancesOfferingsCallable(DescribeReservedDBInstancesOfferingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DescribeReservedDBInstancesOfferings, this, std::move(request)));
+}
+
+void RDSClient::DescribeReservedDBInstancesOfferingsAsync(DescribeReservedDBInstancesOfferingsRequest&& request, const DescribeReservedDBInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DescribeReservedDBInstancesOfferingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DescribeReservedDBInstancesOfferingsAsyncHelper(const DescribeReservedDBInstancesOfferingsRequest& request, const DescribeReservedDBInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReservedDBInstancesOfferings(request), context);
@@ -1902,7 +2472,7 @@ DownloadDBLogFilePortionOutcome RDSClient::DownloadDBLogFilePortion(const Downlo
 
 DownloadDBLogFilePortionOutcomeCallable RDSClient::DownloadDBLogFilePortionCallable(const DownloadDBLogFilePortionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DownloadDBLogFilePortion( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DownloadDBLogFilePortion( request ); } );
 }
 
 void RDSClient::DownloadDBLogFilePortionAsync(const DownloadDBLogFilePortionRequest& request, const DownloadDBLogFilePortionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1910,6 +2480,16 @@ void RDSClient::DownloadDBLogFilePortionAsync(const DownloadDBLogFilePortionRequ
   m_executor->Submit( [this, request, handler, context](){ this->DownloadDBLogFilePortionAsyncHelper( request, handler, context ); } );
 }
 
+DownloadDBLogFilePortionOutcomeCallable RDSClient::DownloadDBLogFilePortionCallable(DownloadDBLogFilePortionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::DownloadDBLogFilePortion, this, std::move(request)));
+}
+
+void RDSClient::DownloadDBLogFilePortionAsync(DownloadDBLogFilePortionRequest&& request, const DownloadDBLogFilePortionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::DownloadDBLogFilePortionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::DownloadDBLogFilePortionAsyncHelper(const DownloadDBLogFilePortionRequest& request, const DownloadDBLogFilePortionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DownloadDBLogFilePortion(request), context);
@@ -1932,7 +2512,7 @@ FailoverDBClusterOutcome RDSClient::FailoverDBCluster(const FailoverDBClusterReq
 
 FailoverDBClusterOutcomeCallable RDSClient::FailoverDBClusterCallable(const FailoverDBClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->FailoverDBCluster( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->FailoverDBCluster( request ); } );
 }
 
 void RDSClient::FailoverDBClusterAsync(const FailoverDBClusterRequest& request, const FailoverDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1940,6 +2520,16 @@ void RDSClient::FailoverDBClusterAsync(const FailoverDBClusterRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->FailoverDBClusterAsyncHelper( request, handler, context ); } );
 }
 
+FailoverDBClusterOutcomeCallable RDSClient::FailoverDBClusterCallable(FailoverDBClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::FailoverDBCluster, this, std::move(request)));
+}
+
+void RDSClient::FailoverDBClusterAsync(FailoverDBClusterRequest&& request, const FailoverDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::FailoverDBClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::FailoverDBClusterAsyncHelper(const FailoverDBClusterRequest& request, const FailoverDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, FailoverDBCluster(request), context);
@@ -1962,7 +2552,7 @@ ListTagsForResourceOutcome RDSClient::ListTagsForResource(const ListTagsForResou
 
 ListTagsForResourceOutcomeCallable RDSClient::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTagsForResource( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTagsForResource( request ); } );
 }
 
 void RDSClient::ListTagsForResourceAsync(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1970,6 +2560,16 @@ void RDSClient::ListTagsForResourceAsync(const ListTagsForResourceRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsForResourceAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsForResourceOutcomeCallable RDSClient::ListTagsForResourceCallable(ListTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::ListTagsForResource, this, std::move(request)));
+}
+
+void RDSClient::ListTagsForResourceAsync(ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::ListTagsForResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTagsForResource(request), context);
@@ -1992,7 +2592,7 @@ ModifyDBClusterOutcome RDSClient::ModifyDBCluster(const ModifyDBClusterRequest&
 
 ModifyDBClusterOutcomeCallable RDSClient::ModifyDBClusterCallable(const ModifyDBClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyDBCluster( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyDBCluster( request ); } );
 }
 
 void RDSClient::ModifyDBClusterAsync(const ModifyDBClusterRequest& request, const ModifyDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2000,6 +2600,16 @@ void RDSClient::ModifyDBClusterAsync(const ModifyDBClusterRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->ModifyDBClusterAsyncHelper( request, handler, context ); } );
 }
 
+ModifyDBClusterOutcomeCallable RDSClient::ModifyDBClusterCallable(ModifyDBClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::ModifyDBCluster, this, std::move(request)));
+}
+
+void RDSClient::ModifyDBClusterAsync(ModifyDBClusterRequest&& request, const ModifyDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::ModifyDBClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::ModifyDBClusterAsyncHelper(const ModifyDBClusterRequest& request, const ModifyDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyDBCluster(request), context);
@@ -2022,7 +2632,7 @@ ModifyDBClusterParameterGroupOutcome RDSClient::ModifyDBClusterParameterGroup(co
 
 ModifyDBClusterParameterGroupOutcomeCallable RDSClient::ModifyDBClusterParameterGroupCallable(const ModifyDBClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyDBClusterParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyDBClusterParameterGroup( request ); } );
 }
 
 void RDSClient::ModifyDBClusterParameterGroupAsync(const ModifyDBClusterParameterGroupRequest& request, const ModifyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2030,6 +2640,16 @@ void RDSClient::ModifyDBClusterParameterGroupAsync(const ModifyDBClusterParamete
   m_executor->Submit( [this, request, handler, context](){ this->ModifyDBClusterParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+ModifyDBClusterParameterGroupOutcomeCallable RDSClient::ModifyDBClusterParameterGroupCallable(ModifyDBClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::ModifyDBClusterParameterGroup, this, std::move(request)));
+}
+
+void RDSClient::ModifyDBClusterParameterGroupAsync(ModifyDBClusterParameterGroupRequest&& request, const ModifyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::ModifyDBClusterParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::ModifyDBClusterParameterGroupAsyncHelper(const ModifyDBClusterParameterGroupRequest& request, const ModifyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyDBClusterParameterGroup(request), context);
@@ -2052,7 +2672,7 @@ ModifyDBClusterSnapshotAttributeOutcome RDSClient::ModifyDBClusterSnapshotAttrib
 
 ModifyDBClusterSnapshotAttributeOutcomeCallable RDSClient::ModifyDBClusterSnapshotAttributeCallable(const ModifyDBClusterSnapshotAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyDBClusterSnapshotAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyDBClusterSnapshotAttribute( request ); } );
 }
 
 void RDSClient::ModifyDBClusterSnapshotAttributeAsync(const ModifyDBClusterSnapshotAttributeRequest& request, const ModifyDBClusterSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2060,6 +2680,16 @@ void RDSClient::ModifyDBClusterSnapshotAttributeAsync(const ModifyDBClusterSnaps
   m_executor->Submit( [this, request, handler, context](){ this->ModifyDBClusterSnapshotAttributeAsyncHelper( request, handler, context ); } );
 }
 
+ModifyDBClusterSnapshotAttributeOutcomeCallable RDSClient::ModifyDBClusterSnapshotAttributeCallable(ModifyDBClusterSnapshotAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::ModifyDBClusterSnapshotAttribute, this, std::move(request)));
+}
+
+void RDSClient::ModifyDBClusterSnapshotAttributeAsync(ModifyDBClusterSnapshotAttributeRequest&& request, const ModifyDBClusterSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::ModifyDBClusterSnapshotAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::ModifyDBClusterSnapshotAttributeAsyncHelper(const ModifyDBClusterSnapshotAttributeRequest& request, const ModifyDBClusterSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyDBClusterSnapshotAttribute(request), context);
@@ -2082,7 +2712,7 @@ ModifyDBInstanceOutcome RDSClient::ModifyDBInstance(const ModifyDBInstanceReques
 
 ModifyDBInstanceOutcomeCallable RDSClient::ModifyDBInstanceCallable(const ModifyDBInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyDBInstance( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyDBInstance( request ); } );
 }
 
 void RDSClient::ModifyDBInstanceAsync(const ModifyDBInstanceRequest& request, const ModifyDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2090,6 +2720,16 @@ void RDSClient::ModifyDBInstanceAsync(const ModifyDBInstanceRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->ModifyDBInstanceAsyncHelper( request, handler, context ); } );
 }
 
+ModifyDBInstanceOutcomeCallable RDSClient::ModifyDBInstanceCallable(ModifyDBInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::ModifyDBInstance, this, std::move(request)));
+}
+
+void RDSClient::ModifyDBInstanceAsync(ModifyDBInstanceRequest&& request, const ModifyDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::ModifyDBInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::ModifyDBInstanceAsyncHelper(const ModifyDBInstanceRequest& request, const ModifyDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyDBInstance(request), context);
@@ -2112,7 +2752,7 @@ ModifyDBParameterGroupOutcome RDSClient::ModifyDBParameterGroup(const ModifyDBPa
 
 ModifyDBParameterGroupOutcomeCallable RDSClient::ModifyDBParameterGroupCallable(const ModifyDBParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyDBParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyDBParameterGroup( request ); } );
 }
 
 void RDSClient::ModifyDBParameterGroupAsync(const ModifyDBParameterGroupRequest& request, const ModifyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2120,6 +2760,16 @@ void RDSClient::ModifyDBParameterGroupAsync(const ModifyDBParameterGroupRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ModifyDBParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+ModifyDBParameterGroupOutcomeCallable RDSClient::ModifyDBParameterGroupCallable(ModifyDBParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::ModifyDBParameterGroup, this, std::move(request)));
+}
+
+void RDSClient::ModifyDBParameterGroupAsync(ModifyDBParameterGroupRequest&& request, const ModifyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::ModifyDBParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::ModifyDBParameterGroupAsyncHelper(const ModifyDBParameterGroupRequest& request, const ModifyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyDBParameterGroup(request), context);
@@ -2142,7 +2792,7 @@ ModifyDBSnapshotAttributeOutcome RDSClient::ModifyDBSnapshotAttribute(const Modi
 
 ModifyDBSnapshotAttributeOutcomeCallable RDSClient::ModifyDBSnapshotAttributeCallable(const ModifyDBSnapshotAttributeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyDBSnapshotAttribute( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyDBSnapshotAttribute( request ); } );
 }
 
 void RDSClient::ModifyDBSnapshotAttributeAsync(const ModifyDBSnapshotAttributeRequest& request, const ModifyDBSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2150,6 +2800,16 @@ void RDSClient::ModifyDBSnapshotAttributeAsync(const ModifyDBSnapshotAttributeRe
   m_executor->Submit( [this, request, handler, context](){ this->ModifyDBSnapshotAttributeAsyncHelper( request, handler, context ); } );
 }
 
+ModifyDBSnapshotAttributeOutcomeCallable RDSClient::ModifyDBSnapshotAttributeCallable(ModifyDBSnapshotAttributeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::ModifyDBSnapshotAttribute, this, std::move(request)));
+}
+
+void RDSClient::ModifyDBSnapshotAttributeAsync(ModifyDBSnapshotAttributeRequest&& request, const ModifyDBSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::ModifyDBSnapshotAttributeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::ModifyDBSnapshotAttributeAsyncHelper(const ModifyDBSnapshotAttributeRequest& request, const ModifyDBSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyDBSnapshotAttribute(request), context);
@@ -2172,7 +2832,7 @@ ModifyDBSubnetGroupOutcome RDSClient::ModifyDBSubnetGroup(const ModifyDBSubnetGr
 
 ModifyDBSubnetGroupOutcomeCallable RDSClient::ModifyDBSubnetGroupCallable(const ModifyDBSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyDBSubnetGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyDBSubnetGroup( request ); } );
 }
 
 void RDSClient::ModifyDBSubnetGroupAsync(const ModifyDBSubnetGroupRequest& request, const ModifyDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2180,6 +2840,16 @@ void RDSClient::ModifyDBSubnetGroupAsync(const ModifyDBSubnetGroupRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ModifyDBSubnetGroupAsyncHelper( request, handler, context ); } );
 }
 
+ModifyDBSubnetGroupOutcomeCallable RDSClient::ModifyDBSubnetGroupCallable(ModifyDBSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::ModifyDBSubnetGroup, this, std::move(request)));
+}
+
+void RDSClient::ModifyDBSubnetGroupAsync(ModifyDBSubnetGroupRequest&& request, const ModifyDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::ModifyDBSubnetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::ModifyDBSubnetGroupAsyncHelper(const ModifyDBSubnetGroupRequest& request, const ModifyDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyDBSubnetGroup(request), context);
@@ -2202,7 +2872,7 @@ ModifyEventSubscriptionOutcome RDSClient::ModifyEventSubscription(const ModifyEv
 
 ModifyEventSubscriptionOutcomeCallable RDSClient::ModifyEventSubscriptionCallable(const ModifyEventSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyEventSubscription( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyEventSubscription( request ); } );
 }
 
 void RDSClient::ModifyEventSubscriptionAsync(const ModifyEventSubscriptionRequest& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2210,6 +2880,16 @@ void RDSClient::ModifyEventSubscriptionAsync(const ModifyEventSubscriptionReques
   m_executor->Submit( [this, request, handler, context](){ this->ModifyEventSubscriptionAsyncHelper( request, handler, context ); } );
 }
 
+ModifyEventSubscriptionOutcomeCallable RDSClient::ModifyEventSubscriptionCallable(ModifyEventSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::ModifyEventSubscription, this, std::move(request)));
+}
+
+void RDSClient::ModifyEventSubscriptionAsync(ModifyEventSubscriptionRequest&& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::ModifyEventSubscriptionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::ModifyEventSubscriptionAsyncHelper(const ModifyEventSubscriptionRequest& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyEventSubscription(request), context);
@@ -2232,7 +2912,7 @@ ModifyOptionGroupOutcome RDSClient::ModifyOptionGroup(const ModifyOptionGroupReq
 
 ModifyOptionGroupOutcomeCallable RDSClient::ModifyOptionGroupCallable(const ModifyOptionGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyOptionGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyOptionGroup( request ); } );
 }
 
 void RDSClient::ModifyOptionGroupAsync(const ModifyOptionGroupRequest& request, const ModifyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2240,6 +2920,16 @@ void RDSClient::ModifyOptionGroupAsync(const ModifyOptionGroupRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ModifyOptionGroupAsyncHelper( request, handler, context ); } );
 }
 
+ModifyOptionGroupOutcomeCallable RDSClient::ModifyOptionGroupCallable(ModifyOptionGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::ModifyOptionGroup, this, std::move(request)));
+}
+
+void RDSClient::ModifyOptionGroupAsync(ModifyOptionGroupRequest&& request, const ModifyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::ModifyOptionGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::ModifyOptionGroupAsyncHelper(const ModifyOptionGroupRequest& request, const ModifyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyOptionGroup(request), context);
@@ -2262,7 +2952,7 @@ PromoteReadReplicaOutcome RDSClient::PromoteReadReplica(const PromoteReadReplica
 
 PromoteReadReplicaOutcomeCallable RDSClient::PromoteReadReplicaCallable(const PromoteReadReplicaRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PromoteReadReplica( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PromoteReadReplica( request ); } );
 }
 
 void RDSClient::PromoteReadReplicaAsync(const PromoteReadReplicaRequest& request, const PromoteReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2270,6 +2960,16 @@ void RDSClient::PromoteReadReplicaAsync(const PromoteReadReplicaRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->PromoteReadReplicaAsyncHelper( request, handler, context ); } );
 }
 
+PromoteReadReplicaOutcomeCallable RDSClient::PromoteReadReplicaCallable(PromoteReadReplicaRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::PromoteReadReplica, this, std::move(request)));
+}
+
+void RDSClient::PromoteReadReplicaAsync(PromoteReadReplicaRequest&& request, const PromoteReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::PromoteReadReplicaAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::PromoteReadReplicaAsyncHelper(const PromoteReadReplicaRequest& request, const PromoteReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PromoteReadReplica(request), context);
@@ -2292,7 +2992,7 @@ PromoteReadReplicaDBClusterOutcome RDSClient::PromoteReadReplicaDBCluster(const
 
 PromoteReadReplicaDBClusterOutcomeCallable RDSClient::PromoteReadReplicaDBClusterCallable(const PromoteReadReplicaDBClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PromoteReadReplicaDBCluster( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PromoteReadReplicaDBCluster( request ); } );
 }
 
 void RDSClient::PromoteReadReplicaDBClusterAsync(const PromoteReadReplicaDBClusterRequest& request, const PromoteReadReplicaDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2300,6 +3000,16 @@ void RDSClient::PromoteReadReplicaDBClusterAsync(const PromoteReadReplicaDBClust
   m_executor->Submit( [this, request, handler, context](){ this->PromoteReadReplicaDBClusterAsyncHelper( request, handler, context ); } );
 }
 
+PromoteReadReplicaDBClusterOutcomeCallable RDSClient::PromoteReadReplicaDBClusterCallable(PromoteReadReplicaDBClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::PromoteReadReplicaDBCluster, this, std::move(request)));
+}
+
+void RDSClient::PromoteReadReplicaDBClusterAsync(PromoteReadReplicaDBClusterRequest&& request, const PromoteReadReplicaDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::PromoteReadReplicaDBClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::PromoteReadReplicaDBClusterAsyncHelper(const PromoteReadReplicaDBClusterRequest& request, const PromoteReadReplicaDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PromoteReadReplicaDBCluster(request), context);
@@ -2322,7 +3032,7 @@ PurchaseReservedDBInstancesOfferingOutcome RDSClient::PurchaseReservedDBInstance
 
 PurchaseReservedDBInstancesOfferingOutcomeCallable RDSClient::PurchaseReservedDBInstancesOfferingCallable(const PurchaseReservedDBInstancesOfferingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PurchaseReservedDBInstancesOffering( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PurchaseReservedDBInstancesOffering( request ); } );
 }
 
 void RDSClient::PurchaseReservedDBInstancesOfferingAsync(const PurchaseReservedDBInstancesOfferingRequest& request, const PurchaseReservedDBInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2330,6 +3040,16 @@ void RDSClient::PurchaseReservedDBInstancesOfferingAsync(const PurchaseReservedD
   m_executor->Submit( [this, request, handler, context](){ this->PurchaseReservedDBInstancesOfferingAsyncHelper( request, handler, context ); } );
 }
 
+PurchaseReservedDBInstancesOfferingOutcomeCallable RDSClient::PurchaseReservedDBInstancesOfferingCallable(PurchaseReservedDBInstancesOfferingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::PurchaseReservedDBInstancesOffering, this, std::move(request)));
+}
+
+void RDSClient::PurchaseReservedDBInstancesOfferingAsync(PurchaseReservedDBInstancesOfferingRequest&& request, const PurchaseReservedDBInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::PurchaseReservedDBInstancesOfferingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::PurchaseReservedDBInstancesOfferingAsyncHelper(const PurchaseReservedDBInstancesOfferingRequest& request, const PurchaseReservedDBInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PurchaseReservedDBInstancesOffering(request), context);
@@ -2352,7 +3072,7 @@ RebootDBInstanceOutcome RDSClient::RebootDBInstance(const RebootDBInstanceReques
 
 RebootDBInstanceOutcomeCallable RDSClient::RebootDBInstanceCallable(const RebootDBInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RebootDBInstance( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RebootDBInstance( request ); } );
 }
 
 void RDSClient::RebootDBInstanceAsync(const RebootDBInstanceRequest& request, const RebootDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2360,6 +3080,16 @@ void RDSClient::RebootDBInstanceAsync(const RebootDBInstanceRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->RebootDBInstanceAsyncHelper( request, handler, context ); } );
 }
 
+RebootDBInstanceOutcomeCallable RDSClient::RebootDBInstanceCallable(RebootDBInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::RebootDBInstance, this, std::move(request)));
+}
+
+void RDSClient::RebootDBInstanceAsync(RebootDBInstanceRequest&& request, const RebootDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::RebootDBInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::RebootDBInstanceAsyncHelper(const RebootDBInstanceRequest& request, const RebootDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RebootDBInstance(request), context);
@@ -2382,7 +3112,7 @@ RemoveSourceIdentifierFromSubscriptionOutcome RDSClient::RemoveSourceIdentifierF
 
 RemoveSourceIdentifierFromSubscriptionOutcomeCallable RDSClient::RemoveSourceIdentifierFromSubscriptionCallable(const RemoveSourceIdentifierFromSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveSourceIdentifierFromSubscription( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveSourceIdentifierFromSubscription( request ); } );
 }
 
 void RDSClient::RemoveSourceIdentifierFromSubscriptionAsync(const RemoveSourceIdentifierFromSubscriptionRequest& request, const RemoveSourceIdentifierFromSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2390,6 +3120,16 @@ void RDSClient::RemoveSourceIdentifierFromSubscriptionAsync(const RemoveSourceId
   m_executor->Submit( [this, request, handler, context](){ this->RemoveSourceIdentifierFromSubscriptionAsyncHelper( request, handler, context ); } );
 }
 
+RemoveSourceIdentifierFromSubscriptionOutcomeCallable RDSClient::RemoveSourceIdentifierFromSubscriptionCallable(RemoveSourceIdentifierFromSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::RemoveSourceIdentifierFromSubscription, this, std::move(request)));
+}
+
+void RDSClient::RemoveSourceIdentifierFromSubscriptionAsync(RemoveSourceIdentifierFromSubscriptionRequest&& request, const RemoveSourceIdentifierFromSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::RemoveSourceIdentifierFromSubscriptionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::RemoveSourceIdentifierFromSubscriptionAsyncHelper(const RemoveSourceIdentifierFromSubscriptionRequest& request, const RemoveSourceIdentifierFromSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveSourceIdentifierFromSubscription(request), context);
@@ -2412,7 +3152,7 @@ RemoveTagsFromResourceOutcome RDSClient::RemoveTagsFromResource(const RemoveTags
 
 RemoveTagsFromResourceOutcomeCallable RDSClient::RemoveTagsFromResourceCallable(const RemoveTagsFromResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTagsFromResource( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTagsFromResource( request ); } );
 }
 
 void RDSClient::RemoveTagsFromResourceAsync(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2420,6 +3160,16 @@ void RDSClient::RemoveTagsFromResourceAsync(const RemoveTagsFromResourceRequest&
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsFromResourceAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsFromResourceOutcomeCallable RDSClient::RemoveTagsFromResourceCallable(RemoveTagsFromResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::RemoveTagsFromResource, this, std::move(request)));
+}
+
+void RDSClient::RemoveTagsFromResourceAsync(RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::RemoveTagsFromResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::RemoveTagsFromResourceAsyncHelper(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTagsFromResource(request), context);
@@ -2442,7 +3192,7 @@ ResetDBClusterParameterGroupOutcome RDSClient::ResetDBClusterParameterGroup(cons
 
 ResetDBClusterParameterGroupOutcomeCallable RDSClient::ResetDBClusterParameterGroupCallable(const ResetDBClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResetDBClusterParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResetDBClusterParameterGroup( request ); } );
 }
 
 void RDSClient::ResetDBClusterParameterGroupAsync(const ResetDBClusterParameterGroupRequest& request, const ResetDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2450,6 +3200,16 @@ void RDSClient::ResetDBClusterParameterGroupAsync(const ResetDBClusterParameterG
   m_executor->Submit( [this, request, handler, context](){ this->ResetDBClusterParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+ResetDBClusterParameterGroupOutcomeCallable RDSClient::ResetDBClusterParameterGroupCallable(ResetDBClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::ResetDBClusterParameterGroup, this, std::move(request)));
+}
+
+void RDSClient::ResetDBClusterParameterGroupAsync(ResetDBClusterParameterGroupRequest&& request, const ResetDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::ResetDBClusterParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::ResetDBClusterParameterGroupAsyncHelper(const ResetDBClusterParameterGroupRequest& request, const ResetDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResetDBClusterParameterGroup(request), context);
@@ -2472,7 +3232,7 @@ ResetDBParameterGroupOutcome RDSClient::ResetDBParameterGroup(const ResetDBParam
 
 ResetDBParameterGroupOutcomeCallable RDSClient::ResetDBParameterGroupCallable(const ResetDBParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResetDBParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResetDBParameterGroup( request ); } );
 }
 
 void RDSClient::ResetDBParameterGroupAsync(const ResetDBParameterGroupRequest& request, const ResetDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2480,6 +3240,16 @@ void RDSClient::ResetDBParameterGroupAsync(const ResetDBParameterGroupRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->ResetDBParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+ResetDBParameterGroupOutcomeCallable RDSClient::ResetDBParameterGroupCallable(ResetDBParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::ResetDBParameterGroup, this, std::move(request)));
+}
+
+void RDSClient::ResetDBParameterGroupAsync(ResetDBParameterGroupRequest&& request, const ResetDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::ResetDBParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::ResetDBParameterGroupAsyncHelper(const ResetDBParameterGroupRequest& request, const ResetDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResetDBParameterGroup(request), context);
@@ -2502,7 +3272,7 @@ RestoreDBClusterFromS3Outcome RDSClient::RestoreDBClusterFromS3(const RestoreDBC
 
 RestoreDBClusterFromS3OutcomeCallable RDSClient::RestoreDBClusterFromS3Callable(const RestoreDBClusterFromS3Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RestoreDBClusterFromS3( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RestoreDBClusterFromS3( request ); } );
 }
 
 void RDSClient::RestoreDBClusterFromS3Async(const RestoreDBClusterFromS3Request& request, const RestoreDBClusterFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2510,6 +3280,16 @@ void RDSClient::RestoreDBClusterFromS3Async(const RestoreDBClusterFromS3Request&
   m_executor->Submit( [this, request, handler, context](){ this->RestoreDBClusterFromS3AsyncHelper( request, handler, context ); } );
 }
 
+RestoreDBClusterFromS3OutcomeCallable RDSClient::RestoreDBClusterFromS3Callable(RestoreDBClusterFromS3Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::RestoreDBClusterFromS3, this, std::move(request)));
+}
+
+void RDSClient::RestoreDBClusterFromS3Async(RestoreDBClusterFromS3Request&& request, const RestoreDBClusterFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::RestoreDBClusterFromS3AsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::RestoreDBClusterFromS3AsyncHelper(const RestoreDBClusterFromS3Request& request, const RestoreDBClusterFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RestoreDBClusterFromS3(request), context);
@@ -2532,7 +3312,7 @@ RestoreDBClusterFromSnapshotOutcome RDSClient::RestoreDBClusterFromSnapshot(cons
 
 RestoreDBClusterFromSnapshotOutcomeCallable RDSClient::RestoreDBClusterFromSnapshotCallable(const RestoreDBClusterFromSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RestoreDBClusterFromSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RestoreDBClusterFromSnapshot( request ); } );
 }
 
 void RDSClient::RestoreDBClusterFromSnapshotAsync(const RestoreDBClusterFromSnapshotRequest& request, const RestoreDBClusterFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2540,6 +3320,16 @@ void RDSClient::RestoreDBClusterFromSnapshotAsync(const RestoreDBClusterFromSnap
   m_executor->Submit( [this, request, handler, context](){ this->RestoreDBClusterFromSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+RestoreDBClusterFromSnapshotOutcomeCallable RDSClient::RestoreDBClusterFromSnapshotCallable(RestoreDBClusterFromSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::RestoreDBClusterFromSnapshot, this, std::move(request)));
+}
+
+void RDSClient::RestoreDBClusterFromSnapshotAsync(RestoreDBClusterFromSnapshotRequest&& request, const RestoreDBClusterFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::RestoreDBClusterFromSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::RestoreDBClusterFromSnapshotAsyncHelper(const RestoreDBClusterFromSnapshotRequest& request, const RestoreDBClusterFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RestoreDBClusterFromSnapshot(request), context);
@@ -2562,7 +3352,7 @@ RestoreDBClusterToPointInTimeOutcome RDSClient::RestoreDBClusterToPointInTime(co
 
 RestoreDBClusterToPointInTimeOutcomeCallable RDSClient::RestoreDBClusterToPointInTimeCallable(const RestoreDBClusterToPointInTimeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RestoreDBClusterToPointInTime( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RestoreDBClusterToPointInTime( request ); } );
 }
 
 void RDSClient::RestoreDBClusterToPointInTimeAsync(const RestoreDBClusterToPointInTimeRequest& request, const RestoreDBClusterToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2570,6 +3360,16 @@ void RDSClient::RestoreDBClusterToPointInTimeAsync(const RestoreDBClusterToPoint
   m_executor->Submit( [this, request, handler, context](){ this->RestoreDBClusterToPointInTimeAsyncHelper( request, handler, context ); } );
 }
 
+RestoreDBClusterToPointInTimeOutcomeCallable RDSClient::RestoreDBClusterToPointInTimeCallable(RestoreDBClusterToPointInTimeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::RestoreDBClusterToPointInTime, this, std::move(request)));
+}
+
+void RDSClient::RestoreDBClusterToPointInTimeAsync(RestoreDBClusterToPointInTimeRequest&& request, const RestoreDBClusterToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::RestoreDBClusterToPointInTimeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::RestoreDBClusterToPointInTimeAsyncHelper(const RestoreDBClusterToPointInTimeRequest& request, const RestoreDBClusterToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RestoreDBClusterToPointInTime(request), context);
@@ -2592,7 +3392,7 @@ RestoreDBInstanceFromDBSnapshotOutcome RDSClient::RestoreDBInstanceFromDBSnapsho
 
 RestoreDBInstanceFromDBSnapshotOutcomeCallable RDSClient::RestoreDBInstanceFromDBSnapshotCallable(const RestoreDBInstanceFromDBSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RestoreDBInstanceFromDBSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RestoreDBInstanceFromDBSnapshot( request ); } );
 }
 
 void RDSClient::RestoreDBInstanceFromDBSnapshotAsync(const RestoreDBInstanceFromDBSnapshotRequest& request, const RestoreDBInstanceFromDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2600,6 +3400,16 @@ void RDSClient::RestoreDBInstanceFromDBSnapshotAsync(const RestoreDBInstanceFrom
   m_executor->Submit( [this, request, handler, context](){ this->RestoreDBInstanceFromDBSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+RestoreDBInstanceFromDBSnapshotOutcomeCallable RDSClient::RestoreDBInstanceFromDBSnapshotCallable(RestoreDBInstanceFromDBSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::RestoreDBInstanceFromDBSnapshot, this, std::move(request)));
+}
+
+void RDSClient::RestoreDBInstanceFromDBSnapshotAsync(RestoreDBInstanceFromDBSnapshotRequest&& request, const RestoreDBInstanceFromDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::RestoreDBInstanceFromDBSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::RestoreDBInstanceFromDBSnapshotAsyncHelper(const RestoreDBInstanceFromDBSnapshotRequest& request, const RestoreDBInstanceFromDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RestoreDBInstanceFromDBSnapshot(request), context);
@@ -2622,7 +3432,7 @@ RestoreDBInstanceToPointInTimeOutcome RDSClient::RestoreDBInstanceToPointInTime(
 
 RestoreDBInstanceToPointInTimeOutcomeCallable RDSClient::RestoreDBInstanceToPointInTimeCallable(const RestoreDBInstanceToPointInTimeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RestoreDBInstanceToPointInTime( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RestoreDBInstanceToPointInTime( request ); } );
 }
 
 void RDSClient::RestoreDBInstanceToPointInTimeAsync(const RestoreDBInstanceToPointInTimeRequest& request, const RestoreDBInstanceToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2630,6 +3440,16 @@ void RDSClient::RestoreDBInstanceToPointInTimeAsync(const RestoreDBInstanceToPoi
   m_executor->Submit( [this, request, handler, context](){ this->RestoreDBInstanceToPointInTimeAsyncHelper( request, handler, context ); } );
 }
 
+RestoreDBInstanceToPointInTimeOutcomeCallable RDSClient::RestoreDBInstanceToPointInTimeCallable(RestoreDBInstanceToPointInTimeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::RestoreDBInstanceToPointInTime, this, std::move(request)));
+}
+
+void RDSClient::RestoreDBInstanceToPointInTimeAsync(RestoreDBInstanceToPointInTimeRequest&& request, const RestoreDBInstanceToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::RestoreDBInstanceToPointInTimeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::RestoreDBInstanceToPointInTimeAsyncHelper(const RestoreDBInstanceToPointInTimeRequest& request, const RestoreDBInstanceToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RestoreDBInstanceToPointInTime(request), context);
@@ -2652,7 +3472,7 @@ RevokeDBSecurityGroupIngressOutcome RDSClient::RevokeDBSecurityGroupIngress(cons
 
 RevokeDBSecurityGroupIngressOutcomeCallable RDSClient::RevokeDBSecurityGroupIngressCallable(const RevokeDBSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RevokeDBSecurityGroupIngress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RevokeDBSecurityGroupIngress( request ); } );
 }
 
 void RDSClient::RevokeDBSecurityGroupIngressAsync(const RevokeDBSecurityGroupIngressRequest& request, const RevokeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2660,8 +3480,809 @@ void RDSClient::RevokeDBSecurityGroupIngressAsync(const RevokeDBSecurityGroupIng
   m_executor->Submit( [this, request, handler, context](){ this->RevokeDBSecurityGroupIngressAsyncHelper( request, handler, context ); } );
 }
 
+RevokeDBSecurityGroupIngressOutcomeCallable RDSClient::RevokeDBSecurityGroupIngressCallable(RevokeDBSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RDSClient::RevokeDBSecurityGroupIngress, this, std::move(request)));
+}
+
+void RDSClient::RevokeDBSecurityGroupIngressAsync(RevokeDBSecurityGroupIngressRequest&& request, const RevokeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RDSClient::RevokeDBSecurityGroupIngressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RDSClient::RevokeDBSecurityGroupIngressAsyncHelper(const RevokeDBSecurityGroupIngressRequest& request, const RevokeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RevokeDBSecurityGroupIngress(request), context);
 }
 
+Paginator<RDSClient, DescribeCertificatesRequest, DescribeCertificatesOutcome> RDSClient::DescribeCertificatesPaginator(const DescribeCertificatesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeCertificatesRequest, DescribeCertificatesOutcome>(this, &RDSClient::DescribeCertificates, request,
+    [](const DescribeCertificatesRequest& current, const DescribeCertificatesOutcome& outcome, DescribeCertificatesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeDBClusterParameterGroupsRequest, DescribeDBClusterParameterGroupsOutcome> RDSClient::DescribeDBClusterParameterGroupsPaginator(const DescribeDBClusterParameterGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeDBClusterParameterGroupsRequest, DescribeDBClusterParameterGroupsOutcome>(this, &RDSClient::DescribeDBClusterParameterGroups, request,
+    [](const DescribeDBClusterParameterGroupsRequest& current, const DescribeDBClusterParameterGroupsOutcome& outcome, DescribeDBClusterParameterGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeDBClusterParametersRequest, DescribeDBClusterParametersOutcome> RDSClient::DescribeDBClusterParametersPaginator(const DescribeDBClusterParametersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeDBClusterParametersRequest, DescribeDBClusterParametersOutcome>(this, &RDSClient::DescribeDBClusterParameters, request,
+    [](const DescribeDBClusterParametersRequest& current, const DescribeDBClusterParametersOutcome& outcome, DescribeDBClusterParametersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeDBClusterSnapshotsRequest, DescribeDBClusterSnapshotsOutcome> RDSClient::DescribeDBClusterSnapshotsPaginator(const DescribeDBClusterSnapshotsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeDBClusterSnapshotsRequest, DescribeDBClusterSnapshotsOutcome>(this, &RDSClient::DescribeDBClusterSnapshots, request,
+    [](const DescribeDBClusterSnapshotsRequest& current, const DescribeDBClusterSnapshotsOutcome& outcome, DescribeDBClusterSnapshotsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeDBClustersRequest, DescribeDBClustersOutcome> RDSClient::DescribeDBClustersPaginator(const DescribeDBClustersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeDBClustersRequest, DescribeDBClustersOutcome>(this, &RDSClient::DescribeDBClusters, request,
+    [](const DescribeDBClustersRequest& current, const DescribeDBClustersOutcome& outcome, DescribeDBClustersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeDBEngineVersionsRequest, DescribeDBEngineVersionsOutcome> RDSClient::DescribeDBEngineVersionsPaginator(const DescribeDBEngineVersionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeDBEngineVersionsRequest, DescribeDBEngineVersionsOutcome>(this, &RDSClient::DescribeDBEngineVersions, request,
+    [](const DescribeDBEngineVersionsRequest& current, const DescribeDBEngineVersionsOutcome& outcome, DescribeDBEngineVersionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeDBInstancesRequest, DescribeDBInstancesOutcome> RDSClient::DescribeDBInstancesPaginator(const DescribeDBInstancesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeDBInstancesRequest, DescribeDBInstancesOutcome>(this, &RDSClient::DescribeDBInstances, request,
+    [](const DescribeDBInstancesRequest& current, const DescribeDBInstancesOutcome& outcome, DescribeDBInstancesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeDBLogFilesRequest, DescribeDBLogFilesOutcome> RDSClient::DescribeDBLogFilesPaginator(const DescribeDBLogFilesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeDBLogFilesRequest, DescribeDBLogFilesOutcome>(this, &RDSClient::DescribeDBLogFiles, request,
+    [](const DescribeDBLogFilesRequest& current, const DescribeDBLogFilesOutcome& outcome, DescribeDBLogFilesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeDBParameterGroupsRequest, DescribeDBParameterGroupsOutcome> RDSClient::DescribeDBParameterGroupsPaginator(const DescribeDBParameterGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeDBParameterGroupsRequest, DescribeDBParameterGroupsOutcome>(this, &RDSClient::DescribeDBParameterGroups, request,
+    [](const DescribeDBParameterGroupsRequest& current, const DescribeDBParameterGroupsOutcome& outcome, DescribeDBParameterGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeDBParametersRequest, DescribeDBParametersOutcome> RDSClient::DescribeDBParametersPaginator(const DescribeDBParametersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeDBParametersRequest, DescribeDBParametersOutcome>(this, &RDSClient::DescribeDBParameters, request,
+    [](const DescribeDBParametersRequest& current, const DescribeDBParametersOutcome& outcome, DescribeDBParametersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeDBSecurityGroupsRequest, DescribeDBSecurityGroupsOutcome> RDSClient::DescribeDBSecurityGroupsPaginator(const DescribeDBSecurityGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeDBSecurityGroupsRequest, DescribeDBSecurityGroupsOutcome>(this, &RDSClient::DescribeDBSecurityGroups, request,
+    [](const DescribeDBSecurityGroupsRequest& current, const DescribeDBSecurityGroupsOutcome& outcome, DescribeDBSecurityGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeDBSnapshotsRequest, DescribeDBSnapshotsOutcome> RDSClient::DescribeDBSnapshotsPaginator(const DescribeDBSnapshotsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeDBSnapshotsRequest, DescribeDBSnapshotsOutcome>(this, &RDSClient::DescribeDBSnapshots, request,
+    [](const DescribeDBSnapshotsRequest& current, const DescribeDBSnapshotsOutcome& outcome, DescribeDBSnapshotsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeDBSubnetGroupsRequest, DescribeDBSubnetGroupsOutcome> RDSClient::DescribeDBSubnetGroupsPaginator(const DescribeDBSubnetGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeDBSubnetGroupsRequest, DescribeDBSubnetGroupsOutcome>(this, &RDSClient::DescribeDBSubnetGroups, request,
+    [](const DescribeDBSubnetGroupsRequest& current, const DescribeDBSubnetGroupsOutcome& outcome, DescribeDBSubnetGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeEventSubscriptionsRequest, DescribeEventSubscriptionsOutcome> RDSClient::DescribeEventSubscriptionsPaginator(const DescribeEventSubscriptionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeEventSubscriptionsRequest, DescribeEventSubscriptionsOutcome>(this, &RDSClient::DescribeEventSubscriptions, request,
+    [](const DescribeEventSubscriptionsRequest& current, const DescribeEventSubscriptionsOutcome& outcome, DescribeEventSubscriptionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeEventsRequest, DescribeEventsOutcome> RDSClient::DescribeEventsPaginator(const DescribeEventsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeEventsRequest, DescribeEventsOutcome>(this, &RDSClient::DescribeEvents, request,
+    [](const DescribeEventsRequest& current, const DescribeEventsOutcome& outcome, DescribeEventsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeOptionGroupOptionsRequest, DescribeOptionGroupOptionsOutcome> RDSClient::DescribeOptionGroupOptionsPaginator(const DescribeOptionGroupOptionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeOptionGroupOptionsRequest, DescribeOptionGroupOptionsOutcome>(this, &RDSClient::DescribeOptionGroupOptions, request,
+    [](const DescribeOptionGroupOptionsRequest& current, const DescribeOptionGroupOptionsOutcome& outcome, DescribeOptionGroupOptionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeOptionGroupsRequest, DescribeOptionGroupsOutcome> RDSClient::DescribeOptionGroupsPaginator(const DescribeOptionGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeOptionGroupsRequest, DescribeOptionGroupsOutcome>(this, &RDSClient::DescribeOptionGroups, request,
+    [](const DescribeOptionGroupsRequest& current, const DescribeOptionGroupsOutcome& outcome, DescribeOptionGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeOrderableDBInstanceOptionsRequest, DescribeOrderableDBInstanceOptionsOutcome> RDSClient::DescribeOrderableDBInstanceOptionsPaginator(const DescribeOrderableDBInstanceOptionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeOrderableDBInstanceOptionsRequest, DescribeOrderableDBInstanceOptionsOutcome>(this, &RDSClient::DescribeOrderableDBInstanceOptions, request,
+    [](const DescribeOrderableDBInstanceOptionsRequest& current, const DescribeOrderableDBInstanceOptionsOutcome& outcome, DescribeOrderableDBInstanceOptionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribePendingMaintenanceActionsRequest, DescribePendingMaintenanceActionsOutcome> RDSClient::DescribePendingMaintenanceActionsPaginator(const DescribePendingMaintenanceActionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribePendingMaintenanceActionsRequest, DescribePendingMaintenanceActionsOutcome>(this, &RDSClient::DescribePendingMaintenanceActions, request,
+    [](const DescribePendingMaintenanceActionsRequest& current, const DescribePendingMaintenanceActionsOutcome& outcome, DescribePendingMaintenanceActionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeReservedDBInstancesRequest, DescribeReservedDBInstancesOutcome> RDSClient::DescribeReservedDBInstancesPaginator(const DescribeReservedDBInstancesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeReservedDBInstancesRequest, DescribeReservedDBInstancesOutcome>(this, &RDSClient::DescribeReservedDBInstances, request,
+    [](const DescribeReservedDBInstancesRequest& current, const DescribeReservedDBInstancesOutcome& outcome, DescribeReservedDBInstancesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DescribeReservedDBInstancesOfferingsRequest, DescribeReservedDBInstancesOfferingsOutcome> RDSClient::DescribeReservedDBInstancesOfferingsPaginator(const DescribeReservedDBInstancesOfferingsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DescribeReservedDBInstancesOfferingsRequest, DescribeReservedDBInstancesOfferingsOutcome>(this, &RDSClient::DescribeReservedDBInstancesOfferings, request,
+    [](const DescribeReservedDBInstancesOfferingsRequest& current, const DescribeReservedDBInstancesOfferingsOutcome& outcome, DescribeReservedDBInstancesOfferingsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RDSClient, DownloadDBLogFilePortionRequest, DownloadDBLogFilePortionOutcome> RDSClient::DownloadDBLogFilePortionPaginator(const DownloadDBLogFilePortionRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RDSClient, DownloadDBLogFilePortionRequest, DownloadDBLogFilePortionOutcome>(this, &RDSClient::DownloadDBLogFilePortion, request,
+    [](const DownloadDBLogFilePortionRequest& current, const DownloadDBLogFilePortionOutcome& outcome, DownloadDBLogFilePortionRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<RDSClient, AddSourceIdentifierToSubscriptionRequest, AddSourceIdentifierToSubscriptionOutcome> RDSClient::AddSourceIdentifierToSubscriptionAwaitable(AddSourceIdentifierToSubscriptionRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::AddSourceIdentifierToSubscription, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, AddTagsToResourceRequest, AddTagsToResourceOutcome> RDSClient::AddTagsToResourceAwaitable(AddTagsToResourceRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::AddTagsToResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, ApplyPendingMaintenanceActionRequest, ApplyPendingMaintenanceActionOutcome> RDSClient::ApplyPendingMaintenanceActionAwaitable(ApplyPendingMaintenanceActionRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::ApplyPendingMaintenanceAction, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, AuthorizeDBSecurityGroupIngressRequest, AuthorizeDBSecurityGroupIngressOutcome> RDSClient::AuthorizeDBSecurityGroupIngressAwaitable(AuthorizeDBSecurityGroupIngressRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::AuthorizeDBSecurityGroupIngress, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CopyDBClusterParameterGroupRequest, CopyDBClusterParameterGroupOutcome> RDSClient::CopyDBClusterParameterGroupAwaitable(CopyDBClusterParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CopyDBClusterParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CopyDBClusterSnapshotRequest, CopyDBClusterSnapshotOutcome> RDSClient::CopyDBClusterSnapshotAwaitable(CopyDBClusterSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CopyDBClusterSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CopyDBParameterGroupRequest, CopyDBParameterGroupOutcome> RDSClient::CopyDBParameterGroupAwaitable(CopyDBParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CopyDBParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CopyDBSnapshotRequest, CopyDBSnapshotOutcome> RDSClient::CopyDBSnapshotAwaitable(CopyDBSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CopyDBSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CopyOptionGroupRequest, CopyOptionGroupOutcome> RDSClient::CopyOptionGroupAwaitable(CopyOptionGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CopyOptionGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CreateDBClusterRequest, CreateDBClusterOutcome> RDSClient::CreateDBClusterAwaitable(CreateDBClusterRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CreateDBCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CreateDBClusterParameterGroupRequest, CreateDBClusterParameterGroupOutcome> RDSClient::CreateDBClusterParameterGroupAwaitable(CreateDBClusterParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CreateDBClusterParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CreateDBClusterSnapshotRequest, CreateDBClusterSnapshotOutcome> RDSClient::CreateDBClusterSnapshotAwaitable(CreateDBClusterSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CreateDBClusterSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CreateDBInstanceRequest, CreateDBInstanceOutcome> RDSClient::CreateDBInstanceAwaitable(CreateDBInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CreateDBInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CreateDBInstanceReadReplicaRequest, CreateDBInstanceReadReplicaOutcome> RDSClient::CreateDBInstanceReadReplicaAwaitable(CreateDBInstanceReadReplicaRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CreateDBInstanceReadReplica, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CreateDBParameterGroupRequest, CreateDBParameterGroupOutcome> RDSClient::CreateDBParameterGroupAwaitable(CreateDBParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CreateDBParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CreateDBSecurityGroupRequest, CreateDBSecurityGroupOutcome> RDSClient::CreateDBSecurityGroupAwaitable(CreateDBSecurityGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CreateDBSecurityGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CreateDBSnapshotRequest, CreateDBSnapshotOutcome> RDSClient::CreateDBSnapshotAwaitable(CreateDBSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CreateDBSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CreateDBSubnetGroupRequest, CreateDBSubnetGroupOutcome> RDSClient::CreateDBSubnetGroupAwaitable(CreateDBSubnetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CreateDBSubnetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CreateEventSubscriptionRequest, CreateEventSubscriptionOutcome> RDSClient::CreateEventSubscriptionAwaitable(CreateEventSubscriptionRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CreateEventSubscription, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, CreateOptionGroupRequest, CreateOptionGroupOutcome> RDSClient::CreateOptionGroupAwaitable(CreateOptionGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::CreateOptionGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DeleteDBClusterRequest, DeleteDBClusterOutcome> RDSClient::DeleteDBClusterAwaitable(DeleteDBClusterRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DeleteDBCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DeleteDBClusterParameterGroupRequest, DeleteDBClusterParameterGroupOutcome> RDSClient::DeleteDBClusterParameterGroupAwaitable(DeleteDBClusterParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DeleteDBClusterParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DeleteDBClusterSnapshotRequest, DeleteDBClusterSnapshotOutcome> RDSClient::DeleteDBClusterSnapshotAwaitable(DeleteDBClusterSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DeleteDBClusterSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DeleteDBInstanceRequest, DeleteDBInstanceOutcome> RDSClient::DeleteDBInstanceAwaitable(DeleteDBInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DeleteDBInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DeleteDBParameterGroupRequest, DeleteDBParameterGroupOutcome> RDSClient::DeleteDBParameterGroupAwaitable(DeleteDBParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DeleteDBParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DeleteDBSecurityGroupRequest, DeleteDBSecurityGroupOutcome> RDSClient::DeleteDBSecurityGroupAwaitable(DeleteDBSecurityGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DeleteDBSecurityGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DeleteDBSnapshotRequest, DeleteDBSnapshotOutcome> RDSClient::DeleteDBSnapshotAwaitable(DeleteDBSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DeleteDBSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DeleteDBSubnetGroupRequest, DeleteDBSubnetGroupOutcome> RDSClient::DeleteDBSubnetGroupAwaitable(DeleteDBSubnetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DeleteDBSubnetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DeleteEventSubscriptionRequest, DeleteEventSubscriptionOutcome> RDSClient::DeleteEventSubscriptionAwaitable(DeleteEventSubscriptionRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DeleteEventSubscription, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DeleteOptionGroupRequest, DeleteOptionGroupOutcome> RDSClient::DeleteOptionGroupAwaitable(DeleteOptionGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DeleteOptionGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeAccountAttributesRequest, DescribeAccountAttributesOutcome> RDSClient::DescribeAccountAttributesAwaitable(DescribeAccountAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeAccountAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeCertificatesRequest, DescribeCertificatesOutcome> RDSClient::DescribeCertificatesAwaitable(DescribeCertificatesRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeCertificates, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeDBClusterParameterGroupsRequest, DescribeDBClusterParameterGroupsOutcome> RDSClient::DescribeDBClusterParameterGroupsAwaitable(DescribeDBClusterParameterGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeDBClusterParameterGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeDBClusterParametersRequest, DescribeDBClusterParametersOutcome> RDSClient::DescribeDBClusterParametersAwaitable(DescribeDBClusterParametersRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeDBClusterParameters, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeDBClusterSnapshotAttributesRequest, DescribeDBClusterSnapshotAttributesOutcome> RDSClient::DescribeDBClusterSnapshotAttributesAwaitable(DescribeDBClusterSnapshotAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeDBClusterSnapshotAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeDBClusterSnapshotsRequest, DescribeDBClusterSnapshotsOutcome> RDSClient::DescribeDBClusterSnapshotsAwaitable(DescribeDBClusterSnapshotsRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeDBClusterSnapshots, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeDBClustersRequest, DescribeDBClustersOutcome> RDSClient::DescribeDBClustersAwaitable(DescribeDBClustersRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeDBClusters, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeDBEngineVersionsRequest, DescribeDBEngineVersionsOutcome> RDSClient::DescribeDBEngineVersionsAwaitable(DescribeDBEngineVersionsRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeDBEngineVersions, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeDBInstancesRequest, DescribeDBInstancesOutcome> RDSClient::DescribeDBInstancesAwaitable(DescribeDBInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeDBInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeDBLogFilesRequest, DescribeDBLogFilesOutcome> RDSClient::DescribeDBLogFilesAwaitable(DescribeDBLogFilesRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeDBLogFiles, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeDBParameterGroupsRequest, DescribeDBParameterGroupsOutcome> RDSClient::DescribeDBParameterGroupsAwaitable(DescribeDBParameterGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeDBParameterGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeDBParametersRequest, DescribeDBParametersOutcome> RDSClient::DescribeDBParametersAwaitable(DescribeDBParametersRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeDBParameters, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeDBSecurityGroupsRequest, DescribeDBSecurityGroupsOutcome> RDSClient::DescribeDBSecurityGroupsAwaitable(DescribeDBSecurityGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeDBSecurityGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeDBSnapshotAttributesRequest, DescribeDBSnapshotAttributesOutcome> RDSClient::DescribeDBSnapshotAttributesAwaitable(DescribeDBSnapshotAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeDBSnapshotAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeDBSnapshotsRequest, DescribeDBSnapshotsOutcome> RDSClient::DescribeDBSnapshotsAwaitable(DescribeDBSnapshotsRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeDBSnapshots, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeDBSubnetGroupsRequest, DescribeDBSubnetGroupsOutcome> RDSClient::DescribeDBSubnetGroupsAwaitable(DescribeDBSubnetGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeDBSubnetGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeEngineDefaultClusterParametersRequest, DescribeEngineDefaultClusterParametersOutcome> RDSClient::DescribeEngineDefaultClusterParametersAwaitable(DescribeEngineDefaultClusterParametersRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeEngineDefaultClusterParameters, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeEngineDefaultParametersRequest, DescribeEngineDefaultParametersOutcome> RDSClient::DescribeEngineDefaultParametersAwaitable(DescribeEngineDefaultParametersRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeEngineDefaultParameters, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeEventCategoriesRequest, DescribeEventCategoriesOutcome> RDSClient::DescribeEventCategoriesAwaitable(DescribeEventCategoriesRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeEventCategories, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeEventSubscriptionsRequest, DescribeEventSubscriptionsOutcome> RDSClient::DescribeEventSubscriptionsAwaitable(DescribeEventSubscriptionsRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeEventSubscriptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeEventsRequest, DescribeEventsOutcome> RDSClient::DescribeEventsAwaitable(DescribeEventsRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeEvents, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeOptionGroupOptionsRequest, DescribeOptionGroupOptionsOutcome> RDSClient::DescribeOptionGroupOptionsAwaitable(DescribeOptionGroupOptionsRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeOptionGroupOptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeOptionGroupsRequest, DescribeOptionGroupsOutcome> RDSClient::DescribeOptionGroupsAwaitable(DescribeOptionGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeOptionGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeOrderableDBInstanceOptionsRequest, DescribeOrderableDBInstanceOptionsOutcome> RDSClient::DescribeOrderableDBInstanceOptionsAwaitable(DescribeOrderableDBInstanceOptionsRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeOrderableDBInstanceOptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribePendingMaintenanceActionsRequest, DescribePendingMaintenanceActionsOutcome> RDSClient::DescribePendingMaintenanceActionsAwaitable(DescribePendingMaintenanceActionsRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribePendingMaintenanceActions, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeReservedDBInstancesRequest, DescribeReservedDBInstancesOutcome> RDSClient::DescribeReservedDBInstancesAwaitable(DescribeReservedDBInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeReservedDBInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DescribeReservedDBInstancesOfferingsRequest, DescribeReservedDBInstancesOfferingsOutcome> RDSClient::DescribeReservedDBInstancesOfferingsAwaitable(DescribeReservedDBInstancesOfferingsRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DescribeReservedDBInstancesOfferings, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, DownloadDBLogFilePortionRequest, DownloadDBLogFilePortionOutcome> RDSClient::DownloadDBLogFilePortionAwaitable(DownloadDBLogFilePortionRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::DownloadDBLogFilePortion, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, FailoverDBClusterRequest, FailoverDBClusterOutcome> RDSClient::FailoverDBClusterAwaitable(FailoverDBClusterRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::FailoverDBCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, ListTagsForResourceRequest, ListTagsForResourceOutcome> RDSClient::ListTagsForResourceAwaitable(ListTagsForResourceRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::ListTagsForResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, ModifyDBClusterRequest, ModifyDBClusterOutcome> RDSClient::ModifyDBClusterAwaitable(ModifyDBClusterRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::ModifyDBCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, ModifyDBClusterParameterGroupRequest, ModifyDBClusterParameterGroupOutcome> RDSClient::ModifyDBClusterParameterGroupAwaitable(ModifyDBClusterParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::ModifyDBClusterParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, ModifyDBClusterSnapshotAttributeRequest, ModifyDBClusterSnapshotAttributeOutcome> RDSClient::ModifyDBClusterSnapshotAttributeAwaitable(ModifyDBClusterSnapshotAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::ModifyDBClusterSnapshotAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, ModifyDBInstanceRequest, ModifyDBInstanceOutcome> RDSClient::ModifyDBInstanceAwaitable(ModifyDBInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::ModifyDBInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, ModifyDBParameterGroupRequest, ModifyDBParameterGroupOutcome> RDSClient::ModifyDBParameterGroupAwaitable(ModifyDBParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::ModifyDBParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, ModifyDBSnapshotAttributeRequest, ModifyDBSnapshotAttributeOutcome> RDSClient::ModifyDBSnapshotAttributeAwaitable(ModifyDBSnapshotAttributeRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::ModifyDBSnapshotAttribute, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, ModifyDBSubnetGroupRequest, ModifyDBSubnetGroupOutcome> RDSClient::ModifyDBSubnetGroupAwaitable(ModifyDBSubnetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::ModifyDBSubnetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, ModifyEventSubscriptionRequest, ModifyEventSubscriptionOutcome> RDSClient::ModifyEventSubscriptionAwaitable(ModifyEventSubscriptionRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::ModifyEventSubscription, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, ModifyOptionGroupRequest, ModifyOptionGroupOutcome> RDSClient::ModifyOptionGroupAwaitable(ModifyOptionGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::ModifyOptionGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, PromoteReadReplicaRequest, PromoteReadReplicaOutcome> RDSClient::PromoteReadReplicaAwaitable(PromoteReadReplicaRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::PromoteReadReplica, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, PromoteReadReplicaDBClusterRequest, PromoteReadReplicaDBClusterOutcome> RDSClient::PromoteReadReplicaDBClusterAwaitable(PromoteReadReplicaDBClusterRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::PromoteReadReplicaDBCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, PurchaseReservedDBInstancesOfferingRequest, PurchaseReservedDBInstancesOfferingOutcome> RDSClient::PurchaseReservedDBInstancesOfferingAwaitable(PurchaseReservedDBInstancesOfferingRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::PurchaseReservedDBInstancesOffering, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, RebootDBInstanceRequest, RebootDBInstanceOutcome> RDSClient::RebootDBInstanceAwaitable(RebootDBInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::RebootDBInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, RemoveSourceIdentifierFromSubscriptionRequest, RemoveSourceIdentifierFromSubscriptionOutcome> RDSClient::RemoveSourceIdentifierFromSubscriptionAwaitable(RemoveSourceIdentifierFromSubscriptionRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::RemoveSourceIdentifierFromSubscription, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, RemoveTagsFromResourceRequest, RemoveTagsFromResourceOutcome> RDSClient::RemoveTagsFromResourceAwaitable(RemoveTagsFromResourceRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::RemoveTagsFromResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, ResetDBClusterParameterGroupRequest, ResetDBClusterParameterGroupOutcome> RDSClient::ResetDBClusterParameterGroupAwaitable(ResetDBClusterParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::ResetDBClusterParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, ResetDBParameterGroupRequest, ResetDBParameterGroupOutcome> RDSClient::ResetDBParameterGroupAwaitable(ResetDBParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::ResetDBParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, RestoreDBClusterFromS3Request, RestoreDBClusterFromS3Outcome> RDSClient::RestoreDBClusterFromS3Awaitable(RestoreDBClusterFromS3Request request) const
+{
+  return { m_executor.get(), { this, &RDSClient::RestoreDBClusterFromS3, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, RestoreDBClusterFromSnapshotRequest, RestoreDBClusterFromSnapshotOutcome> RDSClient::RestoreDBClusterFromSnapshotAwaitable(RestoreDBClusterFromSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::RestoreDBClusterFromSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, RestoreDBClusterToPointInTimeRequest, RestoreDBClusterToPointInTimeOutcome> RDSClient::RestoreDBClusterToPointInTimeAwaitable(RestoreDBClusterToPointInTimeRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::RestoreDBClusterToPointInTime, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, RestoreDBInstanceFromDBSnapshotRequest, RestoreDBInstanceFromDBSnapshotOutcome> RDSClient::RestoreDBInstanceFromDBSnapshotAwaitable(RestoreDBInstanceFromDBSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::RestoreDBInstanceFromDBSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, RestoreDBInstanceToPointInTimeRequest, RestoreDBInstanceToPointInTimeOutcome> RDSClient::RestoreDBInstanceToPointInTimeAwaitable(RestoreDBInstanceToPointInTimeRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::RestoreDBInstanceToPointInTime, std::move(request) } };
+}
+
+ClientOperationAwaitable<RDSClient, RevokeDBSecurityGroupIngressRequest, RevokeDBSecurityGroupIngressOutcome> RDSClient::RevokeDBSecurityGroupIngressAwaitable(RevokeDBSecurityGroupIngressRequest request) const
+{
+  return { m_executor.get(), { this, &RDSClient::RevokeDBSecurityGroupIngress, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
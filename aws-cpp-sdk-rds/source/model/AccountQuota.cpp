@@ -57,19 +57,19 @@ AccountQuota& AccountQuota::operator =(const XmlNode& xmlNode)
     XmlNode accountQuotaNameNode = resultNode.FirstChild("AccountQuotaName");
     if(!accountQuotaNameNode.IsNull())
     {
-      m_accountQuotaName = StringUtils::Trim(accountQuotaNameNode.GetText().c_str());
+      m_accountQuotaName = accountQuotaNameNode.GetTextView().Trim().ToString();
       m_accountQuotaNameHasBeenSet = true;
     }
     XmlNode usedNode = resultNode.FirstChild("Used");
     if(!usedNode.IsNull())
     {
-      m_used = StringUtils::ConvertToInt64(StringUtils::Trim(usedNode.GetText().c_str()).c_str());
+      m_used = StringUtils::ConvertToInt64(usedNode.GetTextView().Trim().ToString().c_str());
       m_usedHasBeenSet = true;
     }
     XmlNode maxNode = resultNode.FirstChild("Max");
     if(!maxNode.IsNull())
     {
-      m_max = StringUtils::ConvertToInt64(StringUtils::Trim(maxNode.GetText().c_str()).c_str());
+      m_max = StringUtils::ConvertToInt64(maxNode.GetTextView().Trim().ToString().c_str());
       m_maxHasBeenSet = true;
     }
   }
@@ -81,7 +81,7 @@ void AccountQuota::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_accountQuotaNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AccountQuotaName=" << StringUtils::URLEncode(m_accountQuotaName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AccountQuotaName=" << StringUtils::URLEncoded(m_accountQuotaName) << "&";
   }
 
   if(m_usedHasBeenSet)
@@ -100,7 +100,7 @@ void AccountQuota::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_accountQuotaNameHasBeenSet)
   {
-      oStream << location << ".AccountQuotaName=" << StringUtils::URLEncode(m_accountQuotaName.c_str()) << "&";
+      oStream << location << ".AccountQuotaName=" << StringUtils::URLEncoded(m_accountQuotaName) << "&";
   }
   if(m_usedHasBeenSet)
   {
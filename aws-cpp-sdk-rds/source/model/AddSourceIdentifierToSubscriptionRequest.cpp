@@ -15,6 +15,7 @@
 #include <aws/rds/model/AddSourceIdentifierToSubscriptionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ AddSourceIdentifierToSubscriptionRequest::AddSourceIdentifierToSubscriptionReque
 
 Aws::String AddSourceIdentifierToSubscriptionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AddSourceIdentifierToSubscription&";
   if(m_subscriptionNameHasBeenSet)
   {
-    ss << "SubscriptionName=" << StringUtils::URLEncode(m_subscriptionName.c_str()) << "&";
+    ss << "SubscriptionName=" << StringUtils::URLEncoded(m_subscriptionName) << "&";
   }
 
   if(m_sourceIdentifierHasBeenSet)
   {
-    ss << "SourceIdentifier=" << StringUtils::URLEncode(m_sourceIdentifier.c_str()) << "&";
+    ss << "SourceIdentifier=" << StringUtils::URLEncoded(m_sourceIdentifier) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ AddSourceIdentifierToSubscriptionResult& AddSourceIdentifierToSubscriptionResult
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AddSourceIdentifierToSubscriptionResult")
+  if (rootNode.GetNameView() != "AddSourceIdentifierToSubscriptionResult")
   {
     resultNode = rootNode.FirstChild("AddSourceIdentifierToSubscriptionResult");
   }
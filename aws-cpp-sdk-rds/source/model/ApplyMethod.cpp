@@ -29,21 +29,29 @@ namespace Aws
       namespace ApplyMethodMapper
       {
 
-        static const int immediate_HASH = HashingUtils::HashString("immediate");
-        static const int pending_reboot_HASH = HashingUtils::HashString("pending-reboot");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int immediate_HASH = 1124382641;
+        static const int pending_reboot_HASH = 709046427;
 
 
         ApplyMethod GetApplyMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == immediate_HASH)
+          switch (hashCode)
           {
+          case immediate_HASH:
             return ApplyMethod::immediate;
-          }
-          else if (hashCode == pending_reboot_HASH)
-          {
+          case pending_reboot_HASH:
             return ApplyMethod::pending_reboot;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
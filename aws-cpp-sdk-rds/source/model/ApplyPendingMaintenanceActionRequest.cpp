@@ -15,6 +15,7 @@
 #include <aws/rds/model/ApplyPendingMaintenanceActionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ ApplyPendingMaintenanceActionRequest::ApplyPendingMaintenanceActionRequest() :
 
 Aws::String ApplyPendingMaintenanceActionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ApplyPendingMaintenanceAction&";
   if(m_resourceIdentifierHasBeenSet)
   {
-    ss << "ResourceIdentifier=" << StringUtils::URLEncode(m_resourceIdentifier.c_str()) << "&";
+    ss << "ResourceIdentifier=" << StringUtils::URLEncoded(m_resourceIdentifier) << "&";
   }
 
   if(m_applyActionHasBeenSet)
   {
-    ss << "ApplyAction=" << StringUtils::URLEncode(m_applyAction.c_str()) << "&";
+    ss << "ApplyAction=" << StringUtils::URLEncoded(m_applyAction) << "&";
   }
 
   if(m_optInTypeHasBeenSet)
   {
-    ss << "OptInType=" << StringUtils::URLEncode(m_optInType.c_str()) << "&";
+    ss << "OptInType=" << StringUtils::URLEncoded(m_optInType) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
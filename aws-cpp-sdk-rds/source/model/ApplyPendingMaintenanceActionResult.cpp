@@ -40,7 +40,7 @@ ApplyPendingMaintenanceActionResult& ApplyPendingMaintenanceActionResult::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ApplyPendingMaintenanceActionResult")
+  if (rootNode.GetNameView() != "ApplyPendingMaintenanceActionResult")
   {
     resultNode = rootNode.FirstChild("ApplyPendingMaintenanceActionResult");
   }
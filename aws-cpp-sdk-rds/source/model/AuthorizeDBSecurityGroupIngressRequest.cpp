@@ -15,6 +15,7 @@
 #include <aws/rds/model/AuthorizeDBSecurityGroupIngressRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -30,34 +31,34 @@ AuthorizeDBSecurityGroupIngressRequest::AuthorizeDBSecurityGroupIngressRequest()
 
 Aws::String AuthorizeDBSecurityGroupIngressRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AuthorizeDBSecurityGroupIngress&";
   if(m_dBSecurityGroupNameHasBeenSet)
   {
-    ss << "DBSecurityGroupName=" << StringUtils::URLEncode(m_dBSecurityGroupName.c_str()) << "&";
+    ss << "DBSecurityGroupName=" << StringUtils::URLEncoded(m_dBSecurityGroupName) << "&";
   }
 
   if(m_cIDRIPHasBeenSet)
   {
-    ss << "CIDRIP=" << StringUtils::URLEncode(m_cIDRIP.c_str()) << "&";
+    ss << "CIDRIP=" << StringUtils::URLEncoded(m_cIDRIP) << "&";
   }
 
   if(m_eC2SecurityGroupNameHasBeenSet)
   {
-    ss << "EC2SecurityGroupName=" << StringUtils::URLEncode(m_eC2SecurityGroupName.c_str()) << "&";
+    ss << "EC2SecurityGroupName=" << StringUtils::URLEncoded(m_eC2SecurityGroupName) << "&";
   }
 
   if(m_eC2SecurityGroupIdHasBeenSet)
   {
-    ss << "EC2SecurityGroupId=" << StringUtils::URLEncode(m_eC2SecurityGroupId.c_str()) << "&";
+    ss << "EC2SecurityGroupId=" << StringUtils::URLEncoded(m_eC2SecurityGroupId) << "&";
   }
 
   if(m_eC2SecurityGroupOwnerIdHasBeenSet)
   {
-    ss << "EC2SecurityGroupOwnerId=" << StringUtils::URLEncode(m_eC2SecurityGroupOwnerId.c_str()) << "&";
+    ss << "EC2SecurityGroupOwnerId=" << StringUtils::URLEncoded(m_eC2SecurityGroupOwnerId) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ AuthorizeDBSecurityGroupIngressResult& AuthorizeDBSecurityGroupIngressResult::op
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AuthorizeDBSecurityGroupIngressResult")
+  if (rootNode.GetNameView() != "AuthorizeDBSecurityGroupIngressResult")
   {
     resultNode = rootNode.FirstChild("AuthorizeDBSecurityGroupIngressResult");
   }
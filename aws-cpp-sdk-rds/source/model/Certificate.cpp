@@ -59,37 +59,37 @@ Certificate& Certificate::operator =(const XmlNode& xmlNode)
     XmlNode certificateIdentifierNode = resultNode.FirstChild("CertificateIdentifier");
     if(!certificateIdentifierNode.IsNull())
     {
-      m_certificateIdentifier = StringUtils::Trim(certificateIdentifierNode.GetText().c_str());
+      m_certificateIdentifier = certificateIdentifierNode.GetTextView().Trim().ToString();
       m_certificateIdentifierHasBeenSet = true;
     }
     XmlNode certificateTypeNode = resultNode.FirstChild("CertificateType");
     if(!certificateTypeNode.IsNull())
     {
-      m_certificateType = StringUtils::Trim(certificateTypeNode.GetText().c_str());
+      m_certificateType = certificateTypeNode.GetTextView().Trim().ToString();
       m_certificateTypeHasBeenSet = true;
     }
     XmlNode thumbprintNode = resultNode.FirstChild("Thumbprint");
     if(!thumbprintNode.IsNull())
     {
-      m_thumbprint = StringUtils::Trim(thumbprintNode.GetText().c_str());
+      m_thumbprint = thumbprintNode.GetTextView().Trim().ToString();
       m_thumbprintHasBeenSet = true;
     }
     XmlNode validFromNode = resultNode.FirstChild("ValidFrom");
     if(!validFromNode.IsNull())
     {
-      m_validFrom = DateTime(StringUtils::Trim(validFromNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_validFrom = DateTime(validFromNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_validFromHasBeenSet = true;
     }
     XmlNode validTillNode = resultNode.FirstChild("ValidTill");
     if(!validTillNode.IsNull())
     {
-      m_validTill = DateTime(StringUtils::Trim(validTillNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_validTill = DateTime(validTillNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_validTillHasBeenSet = true;
     }
     XmlNode certificateArnNode = resultNode.FirstChild("CertificateArn");
     if(!certificateArnNode.IsNull())
     {
-      m_certificateArn = StringUtils::Trim(certificateArnNode.GetText().c_str());
+      m_certificateArn = certificateArnNode.GetTextView().Trim().ToString();
       m_certificateArnHasBeenSet = true;
     }
   }
@@ -101,32 +101,32 @@ void Certificate::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_certificateIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CertificateIdentifier=" << StringUtils::URLEncode(m_certificateIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".CertificateIdentifier=" << StringUtils::URLEncoded(m_certificateIdentifier) << "&";
   }
 
   if(m_certificateTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CertificateType=" << StringUtils::URLEncode(m_certificateType.c_str()) << "&";
+      oStream << location << index << locationValue << ".CertificateType=" << StringUtils::URLEncoded(m_certificateType) << "&";
   }
 
   if(m_thumbprintHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Thumbprint=" << StringUtils::URLEncode(m_thumbprint.c_str()) << "&";
+      oStream << location << index << locationValue << ".Thumbprint=" << StringUtils::URLEncoded(m_thumbprint) << "&";
   }
 
   if(m_validFromHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ValidFrom=" << StringUtils::URLEncode(m_validFrom.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".ValidFrom=" << StringUtils::URLEncoded(m_validFrom.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_validTillHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ValidTill=" << StringUtils::URLEncode(m_validTill.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".ValidTill=" << StringUtils::URLEncoded(m_validTill.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_certificateArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CertificateArn=" << StringUtils::URLEncode(m_certificateArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".CertificateArn=" << StringUtils::URLEncoded(m_certificateArn) << "&";
   }
 
 }
@@ -135,27 +135,27 @@ void Certificate::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_certificateIdentifierHasBeenSet)
   {
-      oStream << location << ".CertificateIdentifier=" << StringUtils::URLEncode(m_certificateIdentifier.c_str()) << "&";
+      oStream << location << ".CertificateIdentifier=" << StringUtils::URLEncoded(m_certificateIdentifier) << "&";
   }
   if(m_certificateTypeHasBeenSet)
   {
-      oStream << location << ".CertificateType=" << StringUtils::URLEncode(m_certificateType.c_str()) << "&";
+      oStream << location << ".CertificateType=" << StringUtils::URLEncoded(m_certificateType) << "&";
   }
   if(m_thumbprintHasBeenSet)
   {
-      oStream << location << ".Thumbprint=" << StringUtils::URLEncode(m_thumbprint.c_str()) << "&";
+      oStream << location << ".Thumbprint=" << StringUtils::URLEncoded(m_thumbprint) << "&";
   }
   if(m_validFromHasBeenSet)
   {
-      oStream << location << ".ValidFrom=" << StringUtils::URLEncode(m_validFrom.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".ValidFrom=" << StringUtils::URLEncoded(m_validFrom.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_validTillHasBeenSet)
   {
-      oStream << location << ".ValidTill=" << StringUtils::URLEncode(m_validTill.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".ValidTill=" << StringUtils::URLEncoded(m_validTill.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_certificateArnHasBeenSet)
   {
-      oStream << location << ".CertificateArn=" << StringUtils::URLEncode(m_certificateArn.c_str()) << "&";
+      oStream << location << ".CertificateArn=" << StringUtils::URLEncoded(m_certificateArn) << "&";
   }
 }
 
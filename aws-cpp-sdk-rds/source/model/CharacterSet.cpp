@@ -51,13 +51,13 @@ CharacterSet& CharacterSet::operator =(const XmlNode& xmlNode)
     XmlNode characterSetNameNode = resultNode.FirstChild("CharacterSetName");
     if(!characterSetNameNode.IsNull())
     {
-      m_characterSetName = StringUtils::Trim(characterSetNameNode.GetText().c_str());
+      m_characterSetName = characterSetNameNode.GetTextView().Trim().ToString();
       m_characterSetNameHasBeenSet = true;
     }
     XmlNode characterSetDescriptionNode = resultNode.FirstChild("CharacterSetDescription");
     if(!characterSetDescriptionNode.IsNull())
     {
-      m_characterSetDescription = StringUtils::Trim(characterSetDescriptionNode.GetText().c_str());
+      m_characterSetDescription = characterSetDescriptionNode.GetTextView().Trim().ToString();
       m_characterSetDescriptionHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void CharacterSet::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_characterSetNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CharacterSetName=" << StringUtils::URLEncode(m_characterSetName.c_str()) << "&";
+      oStream << location << index << locationValue << ".CharacterSetName=" << StringUtils::URLEncoded(m_characterSetName) << "&";
   }
 
   if(m_characterSetDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CharacterSetDescription=" << StringUtils::URLEncode(m_characterSetDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".CharacterSetDescription=" << StringUtils::URLEncoded(m_characterSetDescription) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void CharacterSet::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_characterSetNameHasBeenSet)
   {
-      oStream << location << ".CharacterSetName=" << StringUtils::URLEncode(m_characterSetName.c_str()) << "&";
+      oStream << location << ".CharacterSetName=" << StringUtils::URLEncoded(m_characterSetName) << "&";
   }
   if(m_characterSetDescriptionHasBeenSet)
   {
-      oStream << location << ".CharacterSetDescription=" << StringUtils::URLEncode(m_characterSetDescription.c_str()) << "&";
+      oStream << location << ".CharacterSetDescription=" << StringUtils::URLEncoded(m_characterSetDescription) << "&";
   }
 }
 
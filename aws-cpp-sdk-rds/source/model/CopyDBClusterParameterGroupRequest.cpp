@@ -15,6 +15,7 @@
 #include <aws/rds/model/CopyDBClusterParameterGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -29,21 +30,21 @@ CopyDBClusterParameterGroupRequest::CopyDBClusterParameterGroupRequest() :
 
 Aws::String CopyDBClusterParameterGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CopyDBClusterParameterGroup&";
   if(m_sourceDBClusterParameterGroupIdentifierHasBeenSet)
   {
-    ss << "SourceDBClusterParameterGroupIdentifier=" << StringUtils::URLEncode(m_sourceDBClusterParameterGroupIdentifier.c_str()) << "&";
+    ss << "SourceDBClusterParameterGroupIdentifier=" << StringUtils::URLEncoded(m_sourceDBClusterParameterGroupIdentifier) << "&";
   }
 
   if(m_targetDBClusterParameterGroupIdentifierHasBeenSet)
   {
-    ss << "TargetDBClusterParameterGroupIdentifier=" << StringUtils::URLEncode(m_targetDBClusterParameterGroupIdentifier.c_str()) << "&";
+    ss << "TargetDBClusterParameterGroupIdentifier=" << StringUtils::URLEncoded(m_targetDBClusterParameterGroupIdentifier) << "&";
   }
 
   if(m_targetDBClusterParameterGroupDescriptionHasBeenSet)
   {
-    ss << "TargetDBClusterParameterGroupDescription=" << StringUtils::URLEncode(m_targetDBClusterParameterGroupDescription.c_str()) << "&";
+    ss << "TargetDBClusterParameterGroupDescription=" << StringUtils::URLEncoded(m_targetDBClusterParameterGroupDescription) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -57,6 +58,6 @@ Aws::String CopyDBClusterParameterGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CopyDBClusterParameterGroupResult& CopyDBClusterParameterGroupResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CopyDBClusterParameterGroupResult")
+  if (rootNode.GetNameView() != "CopyDBClusterParameterGroupResult")
   {
     resultNode = rootNode.FirstChild("CopyDBClusterParameterGroupResult");
   }
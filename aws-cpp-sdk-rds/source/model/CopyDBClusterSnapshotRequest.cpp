@@ -15,6 +15,7 @@
 #include <aws/rds/model/CopyDBClusterSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ CopyDBClusterSnapshotRequest::CopyDBClusterSnapshotRequest() :
 
 Aws::String CopyDBClusterSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CopyDBClusterSnapshot&";
   if(m_sourceDBClusterSnapshotIdentifierHasBeenSet)
   {
-    ss << "SourceDBClusterSnapshotIdentifier=" << StringUtils::URLEncode(m_sourceDBClusterSnapshotIdentifier.c_str()) << "&";
+    ss << "SourceDBClusterSnapshotIdentifier=" << StringUtils::URLEncoded(m_sourceDBClusterSnapshotIdentifier) << "&";
   }
 
   if(m_targetDBClusterSnapshotIdentifierHasBeenSet)
   {
-    ss << "TargetDBClusterSnapshotIdentifier=" << StringUtils::URLEncode(m_targetDBClusterSnapshotIdentifier.c_str()) << "&";
+    ss << "TargetDBClusterSnapshotIdentifier=" << StringUtils::URLEncoded(m_targetDBClusterSnapshotIdentifier) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -51,6 +52,6 @@ Aws::String CopyDBClusterSnapshotRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
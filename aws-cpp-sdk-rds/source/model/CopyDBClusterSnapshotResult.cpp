@@ -40,7 +40,7 @@ CopyDBClusterSnapshotResult& CopyDBClusterSnapshotResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CopyDBClusterSnapshotResult")
+  if (rootNode.GetNameView() != "CopyDBClusterSnapshotResult")
   {
     resultNode = rootNode.FirstChild("CopyDBClusterSnapshotResult");
   }
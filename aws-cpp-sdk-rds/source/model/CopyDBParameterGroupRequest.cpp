@@ -15,6 +15,7 @@
 #include <aws/rds/model/CopyDBParameterGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -29,21 +30,21 @@ CopyDBParameterGroupRequest::CopyDBParameterGroupRequest() :
 
 Aws::String CopyDBParameterGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CopyDBParameterGroup&";
   if(m_sourceDBParameterGroupIdentifierHasBeenSet)
   {
-    ss << "SourceDBParameterGroupIdentifier=" << StringUtils::URLEncode(m_sourceDBParameterGroupIdentifier.c_str()) << "&";
+    ss << "SourceDBParameterGroupIdentifier=" << StringUtils::URLEncoded(m_sourceDBParameterGroupIdentifier) << "&";
   }
 
   if(m_targetDBParameterGroupIdentifierHasBeenSet)
   {
-    ss << "TargetDBParameterGroupIdentifier=" << StringUtils::URLEncode(m_targetDBParameterGroupIdentifier.c_str()) << "&";
+    ss << "TargetDBParameterGroupIdentifier=" << StringUtils::URLEncoded(m_targetDBParameterGroupIdentifier) << "&";
   }
 
   if(m_targetDBParameterGroupDescriptionHasBeenSet)
   {
-    ss << "TargetDBParameterGroupDescription=" << StringUtils::URLEncode(m_targetDBParameterGroupDescription.c_str()) << "&";
+    ss << "TargetDBParameterGroupDescription=" << StringUtils::URLEncoded(m_targetDBParameterGroupDescription) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -57,6 +58,6 @@ Aws::String CopyDBParameterGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CopyDBParameterGroupResult& CopyDBParameterGroupResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CopyDBParameterGroupResult")
+  if (rootNode.GetNameView() != "CopyDBParameterGroupResult")
   {
     resultNode = rootNode.FirstChild("CopyDBParameterGroupResult");
   }
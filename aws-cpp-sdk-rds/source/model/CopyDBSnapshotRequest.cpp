@@ -15,6 +15,7 @@
 #include <aws/rds/model/CopyDBSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -31,21 +32,21 @@ CopyDBSnapshotRequest::CopyDBSnapshotRequest() :
 
 Aws::String CopyDBSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CopyDBSnapshot&";
   if(m_sourceDBSnapshotIdentifierHasBeenSet)
   {
-    ss << "SourceDBSnapshotIdentifier=" << StringUtils::URLEncode(m_sourceDBSnapshotIdentifier.c_str()) << "&";
+    ss << "SourceDBSnapshotIdentifier=" << StringUtils::URLEncoded(m_sourceDBSnapshotIdentifier) << "&";
   }
 
   if(m_targetDBSnapshotIdentifierHasBeenSet)
   {
-    ss << "TargetDBSnapshotIdentifier=" << StringUtils::URLEncode(m_targetDBSnapshotIdentifier.c_str()) << "&";
+    ss << "TargetDBSnapshotIdentifier=" << StringUtils::URLEncoded(m_targetDBSnapshotIdentifier) << "&";
   }
 
   if(m_kmsKeyIdHasBeenSet)
   {
-    ss << "KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+    ss << "KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -64,6 +65,6 @@ Aws::String CopyDBSnapshotRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
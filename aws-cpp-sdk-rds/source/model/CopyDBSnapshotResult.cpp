@@ -40,7 +40,7 @@ CopyDBSnapshotResult& CopyDBSnapshotResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CopyDBSnapshotResult")
+  if (rootNode.GetNameView() != "CopyDBSnapshotResult")
   {
     resultNode = rootNode.FirstChild("CopyDBSnapshotResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/rds/model/CopyOptionGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -29,21 +30,21 @@ CopyOptionGroupRequest::CopyOptionGroupRequest() :
 
 Aws::String CopyOptionGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CopyOptionGroup&";
   if(m_sourceOptionGroupIdentifierHasBeenSet)
   {
-    ss << "SourceOptionGroupIdentifier=" << StringUtils::URLEncode(m_sourceOptionGroupIdentifier.c_str()) << "&";
+    ss << "SourceOptionGroupIdentifier=" << StringUtils::URLEncoded(m_sourceOptionGroupIdentifier) << "&";
   }
 
   if(m_targetOptionGroupIdentifierHasBeenSet)
   {
-    ss << "TargetOptionGroupIdentifier=" << StringUtils::URLEncode(m_targetOptionGroupIdentifier.c_str()) << "&";
+    ss << "TargetOptionGroupIdentifier=" << StringUtils::URLEncoded(m_targetOptionGroupIdentifier) << "&";
   }
 
   if(m_targetOptionGroupDescriptionHasBeenSet)
   {
-    ss << "TargetOptionGroupDescription=" << StringUtils::URLEncode(m_targetOptionGroupDescription.c_str()) << "&";
+    ss << "TargetOptionGroupDescription=" << StringUtils::URLEncoded(m_targetOptionGroupDescription) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -57,6 +58,6 @@ Aws::String CopyOptionGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
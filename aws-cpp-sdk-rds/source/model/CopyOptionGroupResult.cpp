@@ -40,7 +40,7 @@ CopyOptionGroupResult& CopyOptionGroupResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CopyOptionGroupResult")
+  if (rootNode.GetNameView() != "CopyOptionGroupResult")
   {
     resultNode = rootNode.FirstChild("CopyOptionGroupResult");
   }
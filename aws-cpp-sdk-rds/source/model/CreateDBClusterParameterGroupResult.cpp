@@ -40,7 +40,7 @@ CreateDBClusterParameterGroupResult& CreateDBClusterParameterGroupResult::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateDBClusterParameterGroupResult")
+  if (rootNode.GetNameView() != "CreateDBClusterParameterGroupResult")
   {
     resultNode = rootNode.FirstChild("CreateDBClusterParameterGroupResult");
   }
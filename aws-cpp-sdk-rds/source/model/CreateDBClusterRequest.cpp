@@ -15,6 +15,7 @@
 #include <aws/rds/model/CreateDBClusterRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -48,7 +49,7 @@ CreateDBClusterRequest::CreateDBClusterRequest() :
 
 Aws::String CreateDBClusterRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateDBCluster&";
   if(m_availabilityZonesHasBeenSet)
   {
@@ -56,7 +57,7 @@ Aws::String CreateDBClusterRequest::SerializePayload() const
     for(auto& item : m_availabilityZones)
     {
       ss << "AvailabilityZones.member." << availabilityZonesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       availabilityZonesCount++;
     }
   }
@@ -68,22 +69,22 @@ Aws::String CreateDBClusterRequest::SerializePayload() const
 
   if(m_characterSetNameHasBeenSet)
   {
-    ss << "CharacterSetName=" << StringUtils::URLEncode(m_characterSetName.c_str()) << "&";
+    ss << "CharacterSetName=" << StringUtils::URLEncoded(m_characterSetName) << "&";
   }
 
   if(m_databaseNameHasBeenSet)
   {
-    ss << "DatabaseName=" << StringUtils::URLEncode(m_databaseName.c_str()) << "&";
+    ss << "DatabaseName=" << StringUtils::URLEncoded(m_databaseName) << "&";
   }
 
   if(m_dBClusterIdentifierHasBeenSet)
   {
-    ss << "DBClusterIdentifier=" << StringUtils::URLEncode(m_dBClusterIdentifier.c_str()) << "&";
+    ss << "DBClusterIdentifier=" << StringUtils::URLEncoded(m_dBClusterIdentifier) << "&";
   }
 
   if(m_dBClusterParameterGroupNameHasBeenSet)
   {
-    ss << "DBClusterParameterGroupName=" << StringUtils::URLEncode(m_dBClusterParameterGroupName.c_str()) << "&";
+    ss << "DBClusterParameterGroupName=" << StringUtils::URLEncoded(m_dBClusterParameterGroupName) << "&";
   }
 
   if(m_vpcSecurityGroupIdsHasBeenSet)
@@ -92,24 +93,24 @@ Aws::String CreateDBClusterRequest::SerializePayload() const
     for(auto& item : m_vpcSecurityGroupIds)
     {
       ss << "VpcSecurityGroupIds.member." << vpcSecurityGroupIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       vpcSecurityGroupIdsCount++;
     }
   }
 
   if(m_dBSubnetGroupNameHasBeenSet)
   {
-    ss << "DBSubnetGroupName=" << StringUtils::URLEncode(m_dBSubnetGroupName.c_str()) << "&";
+    ss << "DBSubnetGroupName=" << StringUtils::URLEncoded(m_dBSubnetGroupName) << "&";
   }
 
   if(m_engineHasBeenSet)
   {
-    ss << "Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+    ss << "Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
 
   if(m_engineVersionHasBeenSet)
   {
-    ss << "EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+    ss << "EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -119,32 +120,32 @@ Aws::String CreateDBClusterRequest::SerializePayload() const
 
   if(m_masterUsernameHasBeenSet)
   {
-    ss << "MasterUsername=" << StringUtils::URLEncode(m_masterUsername.c_str()) << "&";
+    ss << "MasterUsername=" << StringUtils::URLEncoded(m_masterUsername) << "&";
   }
 
   if(m_masterUserPasswordHasBeenSet)
   {
-    ss << "MasterUserPassword=" << StringUtils::URLEncode(m_masterUserPassword.c_str()) << "&";
+    ss << "MasterUserPassword=" << StringUtils::URLEncoded(m_masterUserPassword) << "&";
   }
 
   if(m_optionGroupNameHasBeenSet)
   {
-    ss << "OptionGroupName=" << StringUtils::URLEncode(m_optionGroupName.c_str()) << "&";
+    ss << "OptionGroupName=" << StringUtils::URLEncoded(m_optionGroupName) << "&";
   }
 
   if(m_preferredBackupWindowHasBeenSet)
   {
-    ss << "PreferredBackupWindow=" << StringUtils::URLEncode(m_preferredBackupWindow.c_str()) << "&";
+    ss << "PreferredBackupWindow=" << StringUtils::URLEncoded(m_preferredBackupWindow) << "&";
   }
 
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
 
   if(m_replicationSourceIdentifierHasBeenSet)
   {
-    ss << "ReplicationSourceIdentifier=" << StringUtils::URLEncode(m_replicationSourceIdentifier.c_str()) << "&";
+    ss << "ReplicationSourceIdentifier=" << StringUtils::URLEncoded(m_replicationSourceIdentifier) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -164,10 +165,10 @@ Aws::String CreateDBClusterRequest::SerializePayload() const
 
   if(m_kmsKeyIdHasBeenSet)
   {
-    ss << "KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+    ss << "KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateDBClusterResult& CreateDBClusterResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateDBClusterResult")
+  if (rootNode.GetNameView() != "CreateDBClusterResult")
   {
     resultNode = rootNode.FirstChild("CreateDBClusterResult");
   }
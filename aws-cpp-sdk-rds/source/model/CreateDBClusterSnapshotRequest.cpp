@@ -15,6 +15,7 @@
 #include <aws/rds/model/CreateDBClusterSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ CreateDBClusterSnapshotRequest::CreateDBClusterSnapshotRequest() :
 
 Aws::String CreateDBClusterSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateDBClusterSnapshot&";
   if(m_dBClusterSnapshotIdentifierHasBeenSet)
   {
-    ss << "DBClusterSnapshotIdentifier=" << StringUtils::URLEncode(m_dBClusterSnapshotIdentifier.c_str()) << "&";
+    ss << "DBClusterSnapshotIdentifier=" << StringUtils::URLEncoded(m_dBClusterSnapshotIdentifier) << "&";
   }
 
   if(m_dBClusterIdentifierHasBeenSet)
   {
-    ss << "DBClusterIdentifier=" << StringUtils::URLEncode(m_dBClusterIdentifier.c_str()) << "&";
+    ss << "DBClusterIdentifier=" << StringUtils::URLEncoded(m_dBClusterIdentifier) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -51,6 +52,6 @@ Aws::String CreateDBClusterSnapshotRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateDBClusterSnapshotResult& CreateDBClusterSnapshotResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateDBClusterSnapshotResult")
+  if (rootNode.GetNameView() != "CreateDBClusterSnapshotResult")
   {
     resultNode = rootNode.FirstChild("CreateDBClusterSnapshotResult");
   }
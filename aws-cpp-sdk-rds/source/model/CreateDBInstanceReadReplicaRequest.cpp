@@ -15,6 +15,7 @@
 #include <aws/rds/model/CreateDBInstanceReadReplicaRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -46,26 +47,26 @@ CreateDBInstanceReadReplicaRequest::CreateDBInstanceReadReplicaRequest() :
 
 Aws::String CreateDBInstanceReadReplicaRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateDBInstanceReadReplica&";
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-    ss << "DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+    ss << "DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
 
   if(m_sourceDBInstanceIdentifierHasBeenSet)
   {
-    ss << "SourceDBInstanceIdentifier=" << StringUtils::URLEncode(m_sourceDBInstanceIdentifier.c_str()) << "&";
+    ss << "SourceDBInstanceIdentifier=" << StringUtils::URLEncoded(m_sourceDBInstanceIdentifier) << "&";
   }
 
   if(m_dBInstanceClassHasBeenSet)
   {
-    ss << "DBInstanceClass=" << StringUtils::URLEncode(m_dBInstanceClass.c_str()) << "&";
+    ss << "DBInstanceClass=" << StringUtils::URLEncoded(m_dBInstanceClass) << "&";
   }
 
   if(m_availabilityZoneHasBeenSet)
   {
-    ss << "AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+    ss << "AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -85,7 +86,7 @@ Aws::String CreateDBInstanceReadReplicaRequest::SerializePayload() const
 
   if(m_optionGroupNameHasBeenSet)
   {
-    ss << "OptionGroupName=" << StringUtils::URLEncode(m_optionGroupName.c_str()) << "&";
+    ss << "OptionGroupName=" << StringUtils::URLEncoded(m_optionGroupName) << "&";
   }
 
   if(m_publiclyAccessibleHasBeenSet)
@@ -105,12 +106,12 @@ Aws::String CreateDBInstanceReadReplicaRequest::SerializePayload() const
 
   if(m_dBSubnetGroupNameHasBeenSet)
   {
-    ss << "DBSubnetGroupName=" << StringUtils::URLEncode(m_dBSubnetGroupName.c_str()) << "&";
+    ss << "DBSubnetGroupName=" << StringUtils::URLEncoded(m_dBSubnetGroupName) << "&";
   }
 
   if(m_storageTypeHasBeenSet)
   {
-    ss << "StorageType=" << StringUtils::URLEncode(m_storageType.c_str()) << "&";
+    ss << "StorageType=" << StringUtils::URLEncoded(m_storageType) << "&";
   }
 
   if(m_copyTagsToSnapshotHasBeenSet)
@@ -125,10 +126,10 @@ Aws::String CreateDBInstanceReadReplicaRequest::SerializePayload() const
 
   if(m_monitoringRoleArnHasBeenSet)
   {
-    ss << "MonitoringRoleArn=" << StringUtils::URLEncode(m_monitoringRoleArn.c_str()) << "&";
+    ss << "MonitoringRoleArn=" << StringUtils::URLEncoded(m_monitoringRoleArn) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
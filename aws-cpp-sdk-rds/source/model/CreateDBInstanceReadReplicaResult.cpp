@@ -40,7 +40,7 @@ CreateDBInstanceReadReplicaResult& CreateDBInstanceReadReplicaResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateDBInstanceReadReplicaResult")
+  if (rootNode.GetNameView() != "CreateDBInstanceReadReplicaResult")
   {
     resultNode = rootNode.FirstChild("CreateDBInstanceReadReplicaResult");
   }
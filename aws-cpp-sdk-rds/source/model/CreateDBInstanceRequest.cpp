@@ -15,6 +15,7 @@
 #include <aws/rds/model/CreateDBInstanceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -73,16 +74,16 @@ CreateDBInstanceRequest::CreateDBInstanceRequest() :
 
 Aws::String CreateDBInstanceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateDBInstance&";
   if(m_dBNameHasBeenSet)
   {
-    ss << "DBName=" << StringUtils::URLEncode(m_dBName.c_str()) << "&";
+    ss << "DBName=" << StringUtils::URLEncoded(m_dBName) << "&";
   }
 
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-    ss << "DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+    ss << "DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
 
   if(m_allocatedStorageHasBeenSet)
@@ -92,22 +93,22 @@ Aws::String CreateDBInstanceRequest::SerializePayload() const
 
   if(m_dBInstanceClassHasBeenSet)
   {
-    ss << "DBInstanceClass=" << StringUtils::URLEncode(m_dBInstanceClass.c_str()) << "&";
+    ss << "DBInstanceClass=" << StringUtils::URLEncoded(m_dBInstanceClass) << "&";
   }
 
   if(m_engineHasBeenSet)
   {
-    ss << "Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+    ss << "Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
 
   if(m_masterUsernameHasBeenSet)
   {
-    ss << "MasterUsername=" << StringUtils::URLEncode(m_masterUsername.c_str()) << "&";
+    ss << "MasterUsername=" << StringUtils::URLEncoded(m_masterUsername) << "&";
   }
 
   if(m_masterUserPasswordHasBeenSet)
   {
-    ss << "MasterUserPassword=" << StringUtils::URLEncode(m_masterUserPassword.c_str()) << "&";
+    ss << "MasterUserPassword=" << StringUtils::URLEncoded(m_masterUserPassword) << "&";
   }
 
   if(m_dBSecurityGroupsHasBeenSet)
@@ -116,7 +117,7 @@ Aws::String CreateDBInstanceRequest::SerializePayload() const
     for(auto& item : m_dBSecurityGroups)
     {
       ss << "DBSecurityGroups.member." << dBSecurityGroupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       dBSecurityGroupsCount++;
     }
   }
@@ -127,29 +128,29 @@ Aws::String CreateDBInstanceRequest::SerializePayload() const
     for(auto& item : m_vpcSecurityGroupIds)
     {
       ss << "VpcSecurityGroupIds.member." << vpcSecurityGroupIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       vpcSecurityGroupIdsCount++;
     }
   }
 
   if(m_availabilityZoneHasBeenSet)
   {
-    ss << "AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+    ss << "AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_dBSubnetGroupNameHasBeenSet)
   {
-    ss << "DBSubnetGroupName=" << StringUtils::URLEncode(m_dBSubnetGroupName.c_str()) << "&";
+    ss << "DBSubnetGroupName=" << StringUtils::URLEncoded(m_dBSubnetGroupName) << "&";
   }
 
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
 
   if(m_dBParameterGroupNameHasBeenSet)
   {
-    ss << "DBParameterGroupName=" << StringUtils::URLEncode(m_dBParameterGroupName.c_str()) << "&";
+    ss << "DBParameterGroupName=" << StringUtils::URLEncoded(m_dBParameterGroupName) << "&";
   }
 
   if(m_backupRetentionPeriodHasBeenSet)
@@ -159,7 +160,7 @@ Aws::String CreateDBInstanceRequest::SerializePayload() const
 
   if(m_preferredBackupWindowHasBeenSet)
   {
-    ss << "PreferredBackupWindow=" << StringUtils::URLEncode(m_preferredBackupWindow.c_str()) << "&";
+    ss << "PreferredBackupWindow=" << StringUtils::URLEncoded(m_preferredBackupWindow) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -174,7 +175,7 @@ Aws::String CreateDBInstanceRequest::SerializePayload() const
 
   if(m_engineVersionHasBeenSet)
   {
-    ss << "EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+    ss << "EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_autoMinorVersionUpgradeHasBeenSet)
@@ -184,7 +185,7 @@ Aws::String CreateDBInstanceRequest::SerializePayload() const
 
   if(m_licenseModelHasBeenSet)
   {
-    ss << "LicenseModel=" << StringUtils::URLEncode(m_licenseModel.c_str()) << "&";
+    ss << "LicenseModel=" << StringUtils::URLEncoded(m_licenseModel) << "&";
   }
 
   if(m_iopsHasBeenSet)
@@ -194,12 +195,12 @@ Aws::String CreateDBInstanceRequest::SerializePayload() const
 
   if(m_optionGroupNameHasBeenSet)
   {
-    ss << "OptionGroupName=" << StringUtils::URLEncode(m_optionGroupName.c_str()) << "&";
+    ss << "OptionGroupName=" << StringUtils::URLEncoded(m_optionGroupName) << "&";
   }
 
   if(m_characterSetNameHasBeenSet)
   {
-    ss << "CharacterSetName=" << StringUtils::URLEncode(m_characterSetName.c_str()) << "&";
+    ss << "CharacterSetName=" << StringUtils::URLEncoded(m_characterSetName) << "&";
   }
 
   if(m_publiclyAccessibleHasBeenSet)
@@ -219,22 +220,22 @@ Aws::String CreateDBInstanceRequest::SerializePayload() const
 
   if(m_dBClusterIdentifierHasBeenSet)
   {
-    ss << "DBClusterIdentifier=" << StringUtils::URLEncode(m_dBClusterIdentifier.c_str()) << "&";
+    ss << "DBClusterIdentifier=" << StringUtils::URLEncoded(m_dBClusterIdentifier) << "&";
   }
 
   if(m_storageTypeHasBeenSet)
   {
-    ss << "StorageType=" << StringUtils::URLEncode(m_storageType.c_str()) << "&";
+    ss << "StorageType=" << StringUtils::URLEncoded(m_storageType) << "&";
   }
 
   if(m_tdeCredentialArnHasBeenSet)
   {
-    ss << "TdeCredentialArn=" << StringUtils::URLEncode(m_tdeCredentialArn.c_str()) << "&";
+    ss << "TdeCredentialArn=" << StringUtils::URLEncoded(m_tdeCredentialArn) << "&";
   }
 
   if(m_tdeCredentialPasswordHasBeenSet)
   {
-    ss << "TdeCredentialPassword=" << StringUtils::URLEncode(m_tdeCredentialPassword.c_str()) << "&";
+    ss << "TdeCredentialPassword=" << StringUtils::URLEncoded(m_tdeCredentialPassword) << "&";
   }
 
   if(m_storageEncryptedHasBeenSet)
@@ -244,12 +245,12 @@ Aws::String CreateDBInstanceRequest::SerializePayload() const
 
   if(m_kmsKeyIdHasBeenSet)
   {
-    ss << "KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+    ss << "KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
 
   if(m_domainHasBeenSet)
   {
-    ss << "Domain=" << StringUtils::URLEncode(m_domain.c_str()) << "&";
+    ss << "Domain=" << StringUtils::URLEncoded(m_domain) << "&";
   }
 
   if(m_copyTagsToSnapshotHasBeenSet)
@@ -264,12 +265,12 @@ Aws::String CreateDBInstanceRequest::SerializePayload() const
 
   if(m_monitoringRoleArnHasBeenSet)
   {
-    ss << "MonitoringRoleArn=" << StringUtils::URLEncode(m_monitoringRoleArn.c_str()) << "&";
+    ss << "MonitoringRoleArn=" << StringUtils::URLEncoded(m_monitoringRoleArn) << "&";
   }
 
   if(m_domainIAMRoleNameHasBeenSet)
   {
-    ss << "DomainIAMRoleName=" << StringUtils::URLEncode(m_domainIAMRoleName.c_str()) << "&";
+    ss << "DomainIAMRoleName=" << StringUtils::URLEncoded(m_domainIAMRoleName) << "&";
   }
 
   if(m_promotionTierHasBeenSet)
@@ -278,6 +279,6 @@ Aws::String CreateDBInstanceRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateDBInstanceResult& CreateDBInstanceResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateDBInstanceResult")
+  if (rootNode.GetNameView() != "CreateDBInstanceResult")
   {
     resultNode = rootNode.FirstChild("CreateDBInstanceResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/rds/model/CreateDBParameterGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -29,21 +30,21 @@ CreateDBParameterGroupRequest::CreateDBParameterGroupRequest() :
 
 Aws::String CreateDBParameterGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateDBParameterGroup&";
   if(m_dBParameterGroupNameHasBeenSet)
   {
-    ss << "DBParameterGroupName=" << StringUtils::URLEncode(m_dBParameterGroupName.c_str()) << "&";
+    ss << "DBParameterGroupName=" << StringUtils::URLEncoded(m_dBParameterGroupName) << "&";
   }
 
   if(m_dBParameterGroupFamilyHasBeenSet)
   {
-    ss << "DBParameterGroupFamily=" << StringUtils::URLEncode(m_dBParameterGroupFamily.c_str()) << "&";
+    ss << "DBParameterGroupFamily=" << StringUtils::URLEncoded(m_dBParameterGroupFamily) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -57,6 +58,6 @@ Aws::String CreateDBParameterGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
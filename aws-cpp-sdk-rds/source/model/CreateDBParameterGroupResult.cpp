@@ -40,7 +40,7 @@ CreateDBParameterGroupResult& CreateDBParameterGroupResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateDBParameterGroupResult")
+  if (rootNode.GetNameView() != "CreateDBParameterGroupResult")
   {
     resultNode = rootNode.FirstChild("CreateDBParameterGroupResult");
   }
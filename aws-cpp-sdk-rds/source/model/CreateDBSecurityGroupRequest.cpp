@@ -15,6 +15,7 @@
 #include <aws/rds/model/CreateDBSecurityGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ CreateDBSecurityGroupRequest::CreateDBSecurityGroupRequest() :
 
 Aws::String CreateDBSecurityGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateDBSecurityGroup&";
   if(m_dBSecurityGroupNameHasBeenSet)
   {
-    ss << "DBSecurityGroupName=" << StringUtils::URLEncode(m_dBSecurityGroupName.c_str()) << "&";
+    ss << "DBSecurityGroupName=" << StringUtils::URLEncoded(m_dBSecurityGroupName) << "&";
   }
 
   if(m_dBSecurityGroupDescriptionHasBeenSet)
   {
-    ss << "DBSecurityGroupDescription=" << StringUtils::URLEncode(m_dBSecurityGroupDescription.c_str()) << "&";
+    ss << "DBSecurityGroupDescription=" << StringUtils::URLEncoded(m_dBSecurityGroupDescription) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -51,6 +52,6 @@ Aws::String CreateDBSecurityGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateDBSecurityGroupResult& CreateDBSecurityGroupResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateDBSecurityGroupResult")
+  if (rootNode.GetNameView() != "CreateDBSecurityGroupResult")
   {
     resultNode = rootNode.FirstChild("CreateDBSecurityGroupResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/rds/model/CreateDBSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ CreateDBSnapshotRequest::CreateDBSnapshotRequest() :
 
 Aws::String CreateDBSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateDBSnapshot&";
   if(m_dBSnapshotIdentifierHasBeenSet)
   {
-    ss << "DBSnapshotIdentifier=" << StringUtils::URLEncode(m_dBSnapshotIdentifier.c_str()) << "&";
+    ss << "DBSnapshotIdentifier=" << StringUtils::URLEncoded(m_dBSnapshotIdentifier) << "&";
   }
 
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-    ss << "DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+    ss << "DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -51,6 +52,6 @@ Aws::String CreateDBSnapshotRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateDBSnapshotResult& CreateDBSnapshotResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateDBSnapshotResult")
+  if (rootNode.GetNameView() != "CreateDBSnapshotResult")
   {
     resultNode = rootNode.FirstChild("CreateDBSnapshotResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/rds/model/CreateDBSubnetGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ CreateDBSubnetGroupRequest::CreateDBSubnetGroupRequest() :
 
 Aws::String CreateDBSubnetGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateDBSubnetGroup&";
   if(m_dBSubnetGroupNameHasBeenSet)
   {
-    ss << "DBSubnetGroupName=" << StringUtils::URLEncode(m_dBSubnetGroupName.c_str()) << "&";
+    ss << "DBSubnetGroupName=" << StringUtils::URLEncoded(m_dBSubnetGroupName) << "&";
   }
 
   if(m_dBSubnetGroupDescriptionHasBeenSet)
   {
-    ss << "DBSubnetGroupDescription=" << StringUtils::URLEncode(m_dBSubnetGroupDescription.c_str()) << "&";
+    ss << "DBSubnetGroupDescription=" << StringUtils::URLEncoded(m_dBSubnetGroupDescription) << "&";
   }
 
   if(m_subnetIdsHasBeenSet)
@@ -47,7 +48,7 @@ Aws::String CreateDBSubnetGroupRequest::SerializePayload() const
     for(auto& item : m_subnetIds)
     {
       ss << "SubnetIds.member." << subnetIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       subnetIdsCount++;
     }
   }
@@ -63,6 +64,6 @@ Aws::String CreateDBSubnetGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
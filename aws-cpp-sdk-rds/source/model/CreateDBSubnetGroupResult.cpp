@@ -40,7 +40,7 @@ CreateDBSubnetGroupResult& CreateDBSubnetGroupResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateDBSubnetGroupResult")
+  if (rootNode.GetNameView() != "CreateDBSubnetGroupResult")
   {
     resultNode = rootNode.FirstChild("CreateDBSubnetGroupResult");
   }
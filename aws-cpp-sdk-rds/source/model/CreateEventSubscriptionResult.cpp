@@ -40,7 +40,7 @@ CreateEventSubscriptionResult& CreateEventSubscriptionResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateEventSubscriptionResult")
+  if (rootNode.GetNameView() != "CreateEventSubscriptionResult")
   {
     resultNode = rootNode.FirstChild("CreateEventSubscriptionResult");
   }
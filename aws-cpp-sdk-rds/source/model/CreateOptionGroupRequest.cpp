@@ -15,6 +15,7 @@
 #include <aws/rds/model/CreateOptionGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -30,26 +31,26 @@ CreateOptionGroupRequest::CreateOptionGroupRequest() :
 
 Aws::String CreateOptionGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateOptionGroup&";
   if(m_optionGroupNameHasBeenSet)
   {
-    ss << "OptionGroupName=" << StringUtils::URLEncode(m_optionGroupName.c_str()) << "&";
+    ss << "OptionGroupName=" << StringUtils::URLEncoded(m_optionGroupName) << "&";
   }
 
   if(m_engineNameHasBeenSet)
   {
-    ss << "EngineName=" << StringUtils::URLEncode(m_engineName.c_str()) << "&";
+    ss << "EngineName=" << StringUtils::URLEncoded(m_engineName) << "&";
   }
 
   if(m_majorEngineVersionHasBeenSet)
   {
-    ss << "MajorEngineVersion=" << StringUtils::URLEncode(m_majorEngineVersion.c_str()) << "&";
+    ss << "MajorEngineVersion=" << StringUtils::URLEncoded(m_majorEngineVersion) << "&";
   }
 
   if(m_optionGroupDescriptionHasBeenSet)
   {
-    ss << "OptionGroupDescription=" << StringUtils::URLEncode(m_optionGroupDescription.c_str()) << "&";
+    ss << "OptionGroupDescription=" << StringUtils::URLEncoded(m_optionGroupDescription) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -63,6 +64,6 @@ Aws::String CreateOptionGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateOptionGroupResult& CreateOptionGroupResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateOptionGroupResult")
+  if (rootNode.GetNameView() != "CreateOptionGroupResult")
   {
     resultNode = rootNode.FirstChild("CreateOptionGroupResult");
   }
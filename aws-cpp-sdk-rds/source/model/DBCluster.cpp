@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -113,7 +114,7 @@ DBCluster& DBCluster::operator =(const XmlNode& xmlNode)
     XmlNode allocatedStorageNode = resultNode.FirstChild("AllocatedStorage");
     if(!allocatedStorageNode.IsNull())
     {
-      m_allocatedStorage = StringUtils::ConvertToInt32(StringUtils::Trim(allocatedStorageNode.GetText().c_str()).c_str());
+      m_allocatedStorage = StringUtils::ConvertToInt32(allocatedStorageNode.GetTextView().Trim().ToString().c_str());
       m_allocatedStorageHasBeenSet = true;
     }
     XmlNode availabilityZonesNode = resultNode.FirstChild("AvailabilityZones");
@@ -122,7 +123,7 @@ DBCluster& DBCluster::operator =(const XmlNode& xmlNode)
       XmlNode availabilityZonesMember = availabilityZonesNode.FirstChild("AvailabilityZone");
       while(!availabilityZonesMember.IsNull())
       {
-        m_availabilityZones.push_back(StringUtils::Trim(availabilityZonesMember.GetText().c_str()));
+        m_availabilityZones.push_back(availabilityZonesMember.GetTextView().Trim().ToString());
         availabilityZonesMember = availabilityZonesMember.NextNode("AvailabilityZone");
       }
 
@@ -131,91 +132,91 @@ DBCluster& DBCluster::operator =(const XmlNode& xmlNode)
     XmlNode backupRetentionPeriodNode = resultNode.FirstChild("BackupRetentionPeriod");
     if(!backupRetentionPeriodNode.IsNull())
     {
-      m_backupRetentionPeriod = StringUtils::ConvertToInt32(StringUtils::Trim(backupRetentionPeriodNode.GetText().c_str()).c_str());
+      m_backupRetentionPeriod = StringUtils::ConvertToInt32(backupRetentionPeriodNode.GetTextView().Trim().ToString().c_str());
       m_backupRetentionPeriodHasBeenSet = true;
     }
     XmlNode characterSetNameNode = resultNode.FirstChild("CharacterSetName");
     if(!characterSetNameNode.IsNull())
     {
-      m_characterSetName = StringUtils::Trim(characterSetNameNode.GetText().c_str());
+      m_characterSetName = characterSetNameNode.GetTextView().Trim().ToString();
       m_characterSetNameHasBeenSet = true;
     }
     XmlNode databaseNameNode = resultNode.FirstChild("DatabaseName");
     if(!databaseNameNode.IsNull())
     {
-      m_databaseName = StringUtils::Trim(databaseNameNode.GetText().c_str());
+      m_databaseName = databaseNameNode.GetTextView().Trim().ToString();
       m_databaseNameHasBeenSet = true;
     }
     XmlNode dBClusterIdentifierNode = resultNode.FirstChild("DBClusterIdentifier");
     if(!dBClusterIdentifierNode.IsNull())
     {
-      m_dBClusterIdentifier = StringUtils::Trim(dBClusterIdentifierNode.GetText().c_str());
+      m_dBClusterIdentifier = dBClusterIdentifierNode.GetTextView().Trim().ToString();
       m_dBClusterIdentifierHasBeenSet = true;
     }
     XmlNode dBClusterParameterGroupNode = resultNode.FirstChild("DBClusterParameterGroup");
     if(!dBClusterParameterGroupNode.IsNull())
     {
-      m_dBClusterParameterGroup = StringUtils::Trim(dBClusterParameterGroupNode.GetText().c_str());
+      m_dBClusterParameterGroup = dBClusterParameterGroupNode.GetTextView().Trim().ToString();
       m_dBClusterParameterGroupHasBeenSet = true;
     }
     XmlNode dBSubnetGroupNode = resultNode.FirstChild("DBSubnetGroup");
     if(!dBSubnetGroupNode.IsNull())
     {
-      m_dBSubnetGroup = StringUtils::Trim(dBSubnetGroupNode.GetText().c_str());
+      m_dBSubnetGroup = dBSubnetGroupNode.GetTextView().Trim().ToString();
       m_dBSubnetGroupHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode percentProgressNode = resultNode.FirstChild("PercentProgress");
     if(!percentProgressNode.IsNull())
     {
-      m_percentProgress = StringUtils::Trim(percentProgressNode.GetText().c_str());
+      m_percentProgress = percentProgressNode.GetTextView().Trim().ToString();
       m_percentProgressHasBeenSet = true;
     }
     XmlNode earliestRestorableTimeNode = resultNode.FirstChild("EarliestRestorableTime");
     if(!earliestRestorableTimeNode.IsNull())
     {
-      m_earliestRestorableTime = DateTime(StringUtils::Trim(earliestRestorableTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_earliestRestorableTime = DateTime(earliestRestorableTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_earliestRestorableTimeHasBeenSet = true;
     }
     XmlNode endpointNode = resultNode.FirstChild("Endpoint");
     if(!endpointNode.IsNull())
     {
-      m_endpoint = StringUtils::Trim(endpointNode.GetText().c_str());
+      m_endpoint = endpointNode.GetTextView().Trim().ToString();
       m_endpointHasBeenSet = true;
     }
     XmlNode engineNode = resultNode.FirstChild("Engine");
     if(!engineNode.IsNull())
     {
-      m_engine = StringUtils::Trim(engineNode.GetText().c_str());
+      m_engine = engineNode.GetTextView().Trim().ToString();
       m_engineHasBeenSet = true;
     }
     XmlNode engineVersionNode = resultNode.FirstChild("EngineVersion");
     if(!engineVersionNode.IsNull())
     {
-      m_engineVersion = StringUtils::Trim(engineVersionNode.GetText().c_str());
+      m_engineVersion = engineVersionNode.GetTextView().Trim().ToString();
       m_engineVersionHasBeenSet = true;
     }
     XmlNode latestRestorableTimeNode = resultNode.FirstChild("LatestRestorableTime");
     if(!latestRestorableTimeNode.IsNull())
     {
-      m_latestRestorableTime = DateTime(StringUtils::Trim(latestRestorableTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_latestRestorableTime = DateTime(latestRestorableTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_latestRestorableTimeHasBeenSet = true;
     }
     XmlNode portNode = resultNode.FirstChild("Port");
     if(!portNode.IsNull())
     {
-      m_port = StringUtils::ConvertToInt32(StringUtils::Trim(portNode.GetText().c_str()).c_str());
+      m_port = StringUtils::ConvertToInt32(portNode.GetTextView().Trim().ToString().c_str());
       m_portHasBeenSet = true;
     }
     XmlNode masterUsernameNode = resultNode.FirstChild("MasterUsername");
     if(!masterUsernameNode.IsNull())
     {
-      m_masterUsername = StringUtils::Trim(masterUsernameNode.GetText().c_str());
+      m_masterUsername = masterUsernameNode.GetTextView().Trim().ToString();
       m_masterUsernameHasBeenSet = true;
     }
     XmlNode dBClusterOptionGroupMembershipsNode = resultNode.FirstChild("DBClusterOptionGroupMemberships");
@@ -233,19 +234,19 @@ DBCluster& DBCluster::operator =(const XmlNode& xmlNode)
     XmlNode preferredBackupWindowNode = resultNode.FirstChild("PreferredBackupWindow");
     if(!preferredBackupWindowNode.IsNull())
     {
-      m_preferredBackupWindow = StringUtils::Trim(preferredBackupWindowNode.GetText().c_str());
+      m_preferredBackupWindow = preferredBackupWindowNode.GetTextView().Trim().ToString();
       m_preferredBackupWindowHasBeenSet = true;
     }
     XmlNode preferredMaintenanceWindowNode = resultNode.FirstChild("PreferredMaintenanceWindow");
     if(!preferredMaintenanceWindowNode.IsNull())
     {
-      m_preferredMaintenanceWindow = StringUtils::Trim(preferredMaintenanceWindowNode.GetText().c_str());
+      m_preferredMaintenanceWindow = preferredMaintenanceWindowNode.GetTextView().Trim().ToString();
       m_preferredMaintenanceWindowHasBeenSet = true;
     }
     XmlNode replicationSourceIdentifierNode = resultNode.FirstChild("ReplicationSourceIdentifier");
     if(!replicationSourceIdentifierNode.IsNull())
     {
-      m_replicationSourceIdentifier = StringUtils::Trim(replicationSourceIdentifierNode.GetText().c_str());
+      m_replicationSourceIdentifier = replicationSourceIdentifierNode.GetTextView().Trim().ToString();
       m_replicationSourceIdentifierHasBeenSet = true;
     }
     XmlNode readReplicaIdentifiersNode = resultNode.FirstChild("ReadReplicaIdentifiers");
@@ -254,7 +255,7 @@ DBCluster& DBCluster::operator =(const XmlNode& xmlNode)
       XmlNode readReplicaIdentifiersMember = readReplicaIdentifiersNode.FirstChild("ReadReplicaIdentifier");
       while(!readReplicaIdentifiersMember.IsNull())
       {
-        m_readReplicaIdentifiers.push_back(StringUtils::Trim(readReplicaIdentifiersMember.GetText().c_str()));
+        m_readReplicaIdentifiers.push_back(readReplicaIdentifiersMember.GetTextView().Trim().ToString());
         readReplicaIdentifiersMember = readReplicaIdentifiersMember.NextNode("ReadReplicaIdentifier");
       }
 
@@ -287,31 +288,31 @@ DBCluster& DBCluster::operator =(const XmlNode& xmlNode)
     XmlNode hostedZoneIdNode = resultNode.FirstChild("HostedZoneId");
     if(!hostedZoneIdNode.IsNull())
     {
-      m_hostedZoneId = StringUtils::Trim(hostedZoneIdNode.GetText().c_str());
+      m_hostedZoneId = hostedZoneIdNode.GetTextView().Trim().ToString();
       m_hostedZoneIdHasBeenSet = true;
     }
     XmlNode storageEncryptedNode = resultNode.FirstChild("StorageEncrypted");
     if(!storageEncryptedNode.IsNull())
     {
-      m_storageEncrypted = StringUtils::ConvertToBool(StringUtils::Trim(storageEncryptedNode.GetText().c_str()).c_str());
+      m_storageEncrypted = StringUtils::ConvertToBool(storageEncryptedNode.GetTextView().Trim().ToString().c_str());
       m_storageEncryptedHasBeenSet = true;
     }
     XmlNode kmsKeyIdNode = resultNode.FirstChild("KmsKeyId");
     if(!kmsKeyIdNode.IsNull())
     {
-      m_kmsKeyId = StringUtils::Trim(kmsKeyIdNode.GetText().c_str());
+      m_kmsKeyId = kmsKeyIdNode.GetTextView().Trim().ToString();
       m_kmsKeyIdHasBeenSet = true;
     }
     XmlNode dbClusterResourceIdNode = resultNode.FirstChild("DbClusterResourceId");
     if(!dbClusterResourceIdNode.IsNull())
     {
-      m_dbClusterResourceId = StringUtils::Trim(dbClusterResourceIdNode.GetText().c_str());
+      m_dbClusterResourceId = dbClusterResourceIdNode.GetTextView().Trim().ToString();
       m_dbClusterResourceIdHasBeenSet = true;
     }
     XmlNode dBClusterArnNode = resultNode.FirstChild("DBClusterArn");
     if(!dBClusterArnNode.IsNull())
     {
-      m_dBClusterArn = StringUtils::Trim(dBClusterArnNode.GetText().c_str());
+      m_dBClusterArn = dBClusterArnNode.GetTextView().Trim().ToString();
       m_dBClusterArnHasBeenSet = true;
     }
   }
@@ -331,7 +332,7 @@ void DBCluster::OutputToStream(Aws::OStream& oStream, const char* location, unsi
       unsigned availabilityZonesIdx = 1;
       for(auto& item : m_availabilityZones)
       {
-        oStream << location << index << locationValue << ".AvailabilityZone." << availabilityZonesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".AvailabilityZone." << availabilityZonesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -342,62 +343,62 @@ void DBCluster::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 
   if(m_characterSetNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CharacterSetName=" << StringUtils::URLEncode(m_characterSetName.c_str()) << "&";
+      oStream << location << index << locationValue << ".CharacterSetName=" << StringUtils::URLEncoded(m_characterSetName) << "&";
   }
 
   if(m_databaseNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DatabaseName=" << StringUtils::URLEncode(m_databaseName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DatabaseName=" << StringUtils::URLEncoded(m_databaseName) << "&";
   }
 
   if(m_dBClusterIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBClusterIdentifier=" << StringUtils::URLEncode(m_dBClusterIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBClusterIdentifier=" << StringUtils::URLEncoded(m_dBClusterIdentifier) << "&";
   }
 
   if(m_dBClusterParameterGroupHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBClusterParameterGroup=" << StringUtils::URLEncode(m_dBClusterParameterGroup.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBClusterParameterGroup=" << StringUtils::URLEncoded(m_dBClusterParameterGroup) << "&";
   }
 
   if(m_dBSubnetGroupHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBSubnetGroup=" << StringUtils::URLEncode(m_dBSubnetGroup.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBSubnetGroup=" << StringUtils::URLEncoded(m_dBSubnetGroup) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_percentProgressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PercentProgress=" << StringUtils::URLEncode(m_percentProgress.c_str()) << "&";
+      oStream << location << index << locationValue << ".PercentProgress=" << StringUtils::URLEncoded(m_percentProgress) << "&";
   }
 
   if(m_earliestRestorableTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EarliestRestorableTime=" << StringUtils::URLEncode(m_earliestRestorableTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".EarliestRestorableTime=" << StringUtils::URLEncoded(m_earliestRestorableTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_endpointHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Endpoint=" << StringUtils::URLEncode(m_endpoint.c_str()) << "&";
+      oStream << location << index << locationValue << ".Endpoint=" << StringUtils::URLEncoded(m_endpoint) << "&";
   }
 
   if(m_engineHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
 
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_latestRestorableTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LatestRestorableTime=" << StringUtils::URLEncode(m_latestRestorableTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".LatestRestorableTime=" << StringUtils::URLEncoded(m_latestRestorableTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -407,7 +408,7 @@ void DBCluster::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 
   if(m_masterUsernameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MasterUsername=" << StringUtils::URLEncode(m_masterUsername.c_str()) << "&";
+      oStream << location << index << locationValue << ".MasterUsername=" << StringUtils::URLEncoded(m_masterUsername) << "&";
   }
 
   if(m_dBClusterOptionGroupMembershipsHasBeenSet)
@@ -415,25 +416,25 @@ void DBCluster::OutputToStream(Aws::OStream& oStream, const char* location, unsi
       unsigned dBClusterOptionGroupMembershipsIdx = 1;
       for(auto& item : m_dBClusterOptionGroupMemberships)
       {
-        Aws::StringStream dBClusterOptionGroupMembershipsSs;
+        Aws::Utils::Stream::StringOutputStream dBClusterOptionGroupMembershipsSs;
         dBClusterOptionGroupMembershipsSs << location << index << locationValue << ".DBClusterOptionGroup." << dBClusterOptionGroupMembershipsIdx++;
-        item.OutputToStream(oStream, dBClusterOptionGroupMembershipsSs.str().c_str());
+        item.OutputToStream(oStream, dBClusterOptionGroupMembershipsSs.GetString().c_str());
       }
   }
 
   if(m_preferredBackupWindowHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PreferredBackupWindow=" << StringUtils::URLEncode(m_preferredBackupWindow.c_str()) << "&";
+      oStream << location << index << locationValue << ".PreferredBackupWindow=" << StringUtils::URLEncoded(m_preferredBackupWindow) << "&";
   }
 
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+      oStream << location << index << locationValue << ".PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
 
   if(m_replicationSourceIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReplicationSourceIdentifier=" << StringUtils::URLEncode(m_replicationSourceIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReplicationSourceIdentifier=" << StringUtils::URLEncoded(m_replicationSourceIdentifier) << "&";
   }
 
   if(m_readReplicaIdentifiersHasBeenSet)
@@ -441,7 +442,7 @@ void DBCluster::OutputToStream(Aws::OStream& oStream, const char* location, unsi
       unsigned readReplicaIdentifiersIdx = 1;
       for(auto& item : m_readReplicaIdentifiers)
       {
-        oStream << location << index << locationValue << ".ReadReplicaIdentifier." << readReplicaIdentifiersIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".ReadReplicaIdentifier." << readReplicaIdentifiersIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -450,9 +451,9 @@ void DBCluster::OutputToStream(Aws::OStream& oStream, const char* location, unsi
       unsigned dBClusterMembersIdx = 1;
       for(auto& item : m_dBClusterMembers)
       {
-        Aws::StringStream dBClusterMembersSs;
+        Aws::Utils::Stream::StringOutputStream dBClusterMembersSs;
         dBClusterMembersSs << location << index << locationValue << ".DBClusterMember." << dBClusterMembersIdx++;
-        item.OutputToStream(oStream, dBClusterMembersSs.str().c_str());
+        item.OutputToStream(oStream, dBClusterMembersSs.GetString().c_str());
       }
   }
 
@@ -461,15 +462,15 @@ void DBCluster::OutputToStream(Aws::OStream& oStream, const char* location, unsi
       unsigned vpcSecurityGroupsIdx = 1;
       for(auto& item : m_vpcSecurityGroups)
       {
-        Aws::StringStream vpcSecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream vpcSecurityGroupsSs;
         vpcSecurityGroupsSs << location << index << locationValue << ".VpcSecurityGroupMembership." << vpcSecurityGroupsIdx++;
-        item.OutputToStream(oStream, vpcSecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, vpcSecurityGroupsSs.GetString().c_str());
       }
   }
 
   if(m_hostedZoneIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HostedZoneId=" << StringUtils::URLEncode(m_hostedZoneId.c_str()) << "&";
+      oStream << location << index << locationValue << ".HostedZoneId=" << StringUtils::URLEncoded(m_hostedZoneId) << "&";
   }
 
   if(m_storageEncryptedHasBeenSet)
@@ -479,17 +480,17 @@ void DBCluster::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 
   if(m_kmsKeyIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+      oStream << location << index << locationValue << ".KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
 
   if(m_dbClusterResourceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DbClusterResourceId=" << StringUtils::URLEncode(m_dbClusterResourceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".DbClusterResourceId=" << StringUtils::URLEncoded(m_dbClusterResourceId) << "&";
   }
 
   if(m_dBClusterArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBClusterArn=" << StringUtils::URLEncode(m_dBClusterArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBClusterArn=" << StringUtils::URLEncoded(m_dBClusterArn) << "&";
   }
 
 }
@@ -505,7 +506,7 @@ void DBCluster::OutputToStream(Aws::OStream& oStream, const char* location) cons
       unsigned availabilityZonesIdx = 1;
       for(auto& item : m_availabilityZones)
       {
-        oStream << location << ".AvailabilityZone." << availabilityZonesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".AvailabilityZone." << availabilityZonesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_backupRetentionPeriodHasBeenSet)
@@ -514,51 +515,51 @@ void DBCluster::OutputToStream(Aws::OStream& oStream, const char* location) cons
   }
   if(m_characterSetNameHasBeenSet)
   {
-      oStream << location << ".CharacterSetName=" << StringUtils::URLEncode(m_characterSetName.c_str()) << "&";
+      oStream << location << ".CharacterSetName=" << StringUtils::URLEncoded(m_characterSetName) << "&";
   }
   if(m_databaseNameHasBeenSet)
   {
-      oStream << location << ".DatabaseName=" << StringUtils::URLEncode(m_databaseName.c_str()) << "&";
+      oStream << location << ".DatabaseName=" << StringUtils::URLEncoded(m_databaseName) << "&";
   }
   if(m_dBClusterIdentifierHasBeenSet)
   {
-      oStream << location << ".DBClusterIdentifier=" << StringUtils::URLEncode(m_dBClusterIdentifier.c_str()) << "&";
+      oStream << location << ".DBClusterIdentifier=" << StringUtils::URLEncoded(m_dBClusterIdentifier) << "&";
   }
   if(m_dBClusterParameterGroupHasBeenSet)
   {
-      oStream << location << ".DBClusterParameterGroup=" << StringUtils::URLEncode(m_dBClusterParameterGroup.c_str()) << "&";
+      oStream << location << ".DBClusterParameterGroup=" << StringUtils::URLEncoded(m_dBClusterParameterGroup) << "&";
   }
   if(m_dBSubnetGroupHasBeenSet)
   {
-      oStream << location << ".DBSubnetGroup=" << StringUtils::URLEncode(m_dBSubnetGroup.c_str()) << "&";
+      oStream << location << ".DBSubnetGroup=" << StringUtils::URLEncoded(m_dBSubnetGroup) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_percentProgressHasBeenSet)
   {
-      oStream << location << ".PercentProgress=" << StringUtils::URLEncode(m_percentProgress.c_str()) << "&";
+      oStream << location << ".PercentProgress=" << StringUtils::URLEncoded(m_percentProgress) << "&";
   }
   if(m_earliestRestorableTimeHasBeenSet)
   {
-      oStream << location << ".EarliestRestorableTime=" << StringUtils::URLEncode(m_earliestRestorableTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".EarliestRestorableTime=" << StringUtils::URLEncoded(m_earliestRestorableTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_endpointHasBeenSet)
   {
-      oStream << location << ".Endpoint=" << StringUtils::URLEncode(m_endpoint.c_str()) << "&";
+      oStream << location << ".Endpoint=" << StringUtils::URLEncoded(m_endpoint) << "&";
   }
   if(m_engineHasBeenSet)
   {
-      oStream << location << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
   if(m_latestRestorableTimeHasBeenSet)
   {
-      oStream << location << ".LatestRestorableTime=" << StringUtils::URLEncode(m_latestRestorableTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".LatestRestorableTime=" << StringUtils::URLEncoded(m_latestRestorableTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_portHasBeenSet)
   {
@@ -566,36 +567,36 @@ void DBCluster::OutputToStream(Aws::OStream& oStream, const char* location) cons
   }
   if(m_masterUsernameHasBeenSet)
   {
-      oStream << location << ".MasterUsername=" << StringUtils::URLEncode(m_masterUsername.c_str()) << "&";
+      oStream << location << ".MasterUsername=" << StringUtils::URLEncoded(m_masterUsername) << "&";
   }
   if(m_dBClusterOptionGroupMembershipsHasBeenSet)
   {
       unsigned dBClusterOptionGroupMembershipsIdx = 1;
       for(auto& item : m_dBClusterOptionGroupMemberships)
       {
-        Aws::StringStream dBClusterOptionGroupMembershipsSs;
+        Aws::Utils::Stream::StringOutputStream dBClusterOptionGroupMembershipsSs;
         dBClusterOptionGroupMembershipsSs << location <<  ".DBClusterOptionGroup." << dBClusterOptionGroupMembershipsIdx++;
-        item.OutputToStream(oStream, dBClusterOptionGroupMembershipsSs.str().c_str());
+        item.OutputToStream(oStream, dBClusterOptionGroupMembershipsSs.GetString().c_str());
       }
   }
   if(m_preferredBackupWindowHasBeenSet)
   {
-      oStream << location << ".PreferredBackupWindow=" << StringUtils::URLEncode(m_preferredBackupWindow.c_str()) << "&";
+      oStream << location << ".PreferredBackupWindow=" << StringUtils::URLEncoded(m_preferredBackupWindow) << "&";
   }
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-      oStream << location << ".PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+      oStream << location << ".PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
   if(m_replicationSourceIdentifierHasBeenSet)
   {
-      oStream << location << ".ReplicationSourceIdentifier=" << StringUtils::URLEncode(m_replicationSourceIdentifier.c_str()) << "&";
+      oStream << location << ".ReplicationSourceIdentifier=" << StringUtils::URLEncoded(m_replicationSourceIdentifier) << "&";
   }
   if(m_readReplicaIdentifiersHasBeenSet)
   {
       unsigned readReplicaIdentifiersIdx = 1;
       for(auto& item : m_readReplicaIdentifiers)
       {
-        oStream << location << ".ReadReplicaIdentifier." << readReplicaIdentifiersIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".ReadReplicaIdentifier." << readReplicaIdentifiersIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_dBClusterMembersHasBeenSet)
@@ -603,9 +604,9 @@ void DBCluster::OutputToStream(Aws::OStream& oStream, const char* location) cons
       unsigned dBClusterMembersIdx = 1;
       for(auto& item : m_dBClusterMembers)
       {
-        Aws::StringStream dBClusterMembersSs;
+        Aws::Utils::Stream::StringOutputStream dBClusterMembersSs;
         dBClusterMembersSs << location <<  ".DBClusterMember." << dBClusterMembersIdx++;
-        item.OutputToStream(oStream, dBClusterMembersSs.str().c_str());
+        item.OutputToStream(oStream, dBClusterMembersSs.GetString().c_str());
       }
   }
   if(m_vpcSecurityGroupsHasBeenSet)
@@ -613,14 +614,14 @@ void DBCluster::OutputToStream(Aws::OStream& oStream, const char* location) cons
       unsigned vpcSecurityGroupsIdx = 1;
       for(auto& item : m_vpcSecurityGroups)
       {
-        Aws::StringStream vpcSecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream vpcSecurityGroupsSs;
         vpcSecurityGroupsSs << location <<  ".VpcSecurityGroupMembership." << vpcSecurityGroupsIdx++;
-        item.OutputToStream(oStream, vpcSecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, vpcSecurityGroupsSs.GetString().c_str());
       }
   }
   if(m_hostedZoneIdHasBeenSet)
   {
-      oStream << location << ".HostedZoneId=" << StringUtils::URLEncode(m_hostedZoneId.c_str()) << "&";
+      oStream << location << ".HostedZoneId=" << StringUtils::URLEncoded(m_hostedZoneId) << "&";
   }
   if(m_storageEncryptedHasBeenSet)
   {
@@ -628,15 +629,15 @@ void DBCluster::OutputToStream(Aws::OStream& oStream, const char* location) cons
   }
   if(m_kmsKeyIdHasBeenSet)
   {
-      oStream << location << ".KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+      oStream << location << ".KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
   if(m_dbClusterResourceIdHasBeenSet)
   {
-      oStream << location << ".DbClusterResourceId=" << StringUtils::URLEncode(m_dbClusterResourceId.c_str()) << "&";
+      oStream << location << ".DbClusterResourceId=" << StringUtils::URLEncoded(m_dbClusterResourceId) << "&";
   }
   if(m_dBClusterArnHasBeenSet)
   {
-      oStream << location << ".DBClusterArn=" << StringUtils::URLEncode(m_dBClusterArn.c_str()) << "&";
+      oStream << location << ".DBClusterArn=" << StringUtils::URLEncoded(m_dBClusterArn) << "&";
   }
 }
 
@@ -59,25 +59,25 @@ DBClusterMember& DBClusterMember::operator =(const XmlNode& xmlNode)
     XmlNode dBInstanceIdentifierNode = resultNode.FirstChild("DBInstanceIdentifier");
     if(!dBInstanceIdentifierNode.IsNull())
     {
-      m_dBInstanceIdentifier = StringUtils::Trim(dBInstanceIdentifierNode.GetText().c_str());
+      m_dBInstanceIdentifier = dBInstanceIdentifierNode.GetTextView().Trim().ToString();
       m_dBInstanceIdentifierHasBeenSet = true;
     }
     XmlNode isClusterWriterNode = resultNode.FirstChild("IsClusterWriter");
     if(!isClusterWriterNode.IsNull())
     {
-      m_isClusterWriter = StringUtils::ConvertToBool(StringUtils::Trim(isClusterWriterNode.GetText().c_str()).c_str());
+      m_isClusterWriter = StringUtils::ConvertToBool(isClusterWriterNode.GetTextView().Trim().ToString().c_str());
       m_isClusterWriterHasBeenSet = true;
     }
     XmlNode dBClusterParameterGroupStatusNode = resultNode.FirstChild("DBClusterParameterGroupStatus");
     if(!dBClusterParameterGroupStatusNode.IsNull())
     {
-      m_dBClusterParameterGroupStatus = StringUtils::Trim(dBClusterParameterGroupStatusNode.GetText().c_str());
+      m_dBClusterParameterGroupStatus = dBClusterParameterGroupStatusNode.GetTextView().Trim().ToString();
       m_dBClusterParameterGroupStatusHasBeenSet = true;
     }
     XmlNode promotionTierNode = resultNode.FirstChild("PromotionTier");
     if(!promotionTierNode.IsNull())
     {
-      m_promotionTier = StringUtils::ConvertToInt32(StringUtils::Trim(promotionTierNode.GetText().c_str()).c_str());
+      m_promotionTier = StringUtils::ConvertToInt32(promotionTierNode.GetTextView().Trim().ToString().c_str());
       m_promotionTierHasBeenSet = true;
     }
   }
@@ -89,7 +89,7 @@ void DBClusterMember::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
 
   if(m_isClusterWriterHasBeenSet)
@@ -99,7 +99,7 @@ void DBClusterMember::OutputToStream(Aws::OStream& oStream, const char* location
 
   if(m_dBClusterParameterGroupStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBClusterParameterGroupStatus=" << StringUtils::URLEncode(m_dBClusterParameterGroupStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBClusterParameterGroupStatus=" << StringUtils::URLEncoded(m_dBClusterParameterGroupStatus) << "&";
   }
 
   if(m_promotionTierHasBeenSet)
@@ -113,7 +113,7 @@ void DBClusterMember::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-      oStream << location << ".DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+      oStream << location << ".DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
   if(m_isClusterWriterHasBeenSet)
   {
@@ -121,7 +121,7 @@ void DBClusterMember::OutputToStream(Aws::OStream& oStream, const char* location
   }
   if(m_dBClusterParameterGroupStatusHasBeenSet)
   {
-      oStream << location << ".DBClusterParameterGroupStatus=" << StringUtils::URLEncode(m_dBClusterParameterGroupStatus.c_str()) << "&";
+      oStream << location << ".DBClusterParameterGroupStatus=" << StringUtils::URLEncoded(m_dBClusterParameterGroupStatus) << "&";
   }
   if(m_promotionTierHasBeenSet)
   {
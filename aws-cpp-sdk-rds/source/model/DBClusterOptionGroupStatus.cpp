@@ -51,13 +51,13 @@ DBClusterOptionGroupStatus& DBClusterOptionGroupStatus::operator =(const XmlNode
     XmlNode dBClusterOptionGroupNameNode = resultNode.FirstChild("DBClusterOptionGroupName");
     if(!dBClusterOptionGroupNameNode.IsNull())
     {
-      m_dBClusterOptionGroupName = StringUtils::Trim(dBClusterOptionGroupNameNode.GetText().c_str());
+      m_dBClusterOptionGroupName = dBClusterOptionGroupNameNode.GetTextView().Trim().ToString();
       m_dBClusterOptionGroupNameHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void DBClusterOptionGroupStatus::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_dBClusterOptionGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBClusterOptionGroupName=" << StringUtils::URLEncode(m_dBClusterOptionGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBClusterOptionGroupName=" << StringUtils::URLEncoded(m_dBClusterOptionGroupName) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void DBClusterOptionGroupStatus::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_dBClusterOptionGroupNameHasBeenSet)
   {
-      oStream << location << ".DBClusterOptionGroupName=" << StringUtils::URLEncode(m_dBClusterOptionGroupName.c_str()) << "&";
+      oStream << location << ".DBClusterOptionGroupName=" << StringUtils::URLEncoded(m_dBClusterOptionGroupName) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 }
 
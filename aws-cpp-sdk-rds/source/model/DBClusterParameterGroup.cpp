@@ -55,25 +55,25 @@ DBClusterParameterGroup& DBClusterParameterGroup::operator =(const XmlNode& xmlN
     XmlNode dBClusterParameterGroupNameNode = resultNode.FirstChild("DBClusterParameterGroupName");
     if(!dBClusterParameterGroupNameNode.IsNull())
     {
-      m_dBClusterParameterGroupName = StringUtils::Trim(dBClusterParameterGroupNameNode.GetText().c_str());
+      m_dBClusterParameterGroupName = dBClusterParameterGroupNameNode.GetTextView().Trim().ToString();
       m_dBClusterParameterGroupNameHasBeenSet = true;
     }
     XmlNode dBParameterGroupFamilyNode = resultNode.FirstChild("DBParameterGroupFamily");
     if(!dBParameterGroupFamilyNode.IsNull())
     {
-      m_dBParameterGroupFamily = StringUtils::Trim(dBParameterGroupFamilyNode.GetText().c_str());
+      m_dBParameterGroupFamily = dBParameterGroupFamilyNode.GetTextView().Trim().ToString();
       m_dBParameterGroupFamilyHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode dBClusterParameterGroupArnNode = resultNode.FirstChild("DBClusterParameterGroupArn");
     if(!dBClusterParameterGroupArnNode.IsNull())
     {
-      m_dBClusterParameterGroupArn = StringUtils::Trim(dBClusterParameterGroupArnNode.GetText().c_str());
+      m_dBClusterParameterGroupArn = dBClusterParameterGroupArnNode.GetTextView().Trim().ToString();
       m_dBClusterParameterGroupArnHasBeenSet = true;
     }
   }
@@ -85,22 +85,22 @@ void DBClusterParameterGroup::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_dBClusterParameterGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBClusterParameterGroupName=" << StringUtils::URLEncode(m_dBClusterParameterGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBClusterParameterGroupName=" << StringUtils::URLEncoded(m_dBClusterParameterGroupName) << "&";
   }
 
   if(m_dBParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBParameterGroupFamily=" << StringUtils::URLEncode(m_dBParameterGroupFamily.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBParameterGroupFamily=" << StringUtils::URLEncoded(m_dBParameterGroupFamily) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_dBClusterParameterGroupArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBClusterParameterGroupArn=" << StringUtils::URLEncode(m_dBClusterParameterGroupArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBClusterParameterGroupArn=" << StringUtils::URLEncoded(m_dBClusterParameterGroupArn) << "&";
   }
 
 }
@@ -109,19 +109,19 @@ void DBClusterParameterGroup::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_dBClusterParameterGroupNameHasBeenSet)
   {
-      oStream << location << ".DBClusterParameterGroupName=" << StringUtils::URLEncode(m_dBClusterParameterGroupName.c_str()) << "&";
+      oStream << location << ".DBClusterParameterGroupName=" << StringUtils::URLEncoded(m_dBClusterParameterGroupName) << "&";
   }
   if(m_dBParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << ".DBParameterGroupFamily=" << StringUtils::URLEncode(m_dBParameterGroupFamily.c_str()) << "&";
+      oStream << location << ".DBParameterGroupFamily=" << StringUtils::URLEncoded(m_dBParameterGroupFamily) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_dBClusterParameterGroupArnHasBeenSet)
   {
-      oStream << location << ".DBClusterParameterGroupArn=" << StringUtils::URLEncode(m_dBClusterParameterGroupArn.c_str()) << "&";
+      oStream << location << ".DBClusterParameterGroupArn=" << StringUtils::URLEncoded(m_dBClusterParameterGroupArn) << "&";
   }
 }
 
@@ -51,7 +51,7 @@ DBClusterSnapshotAttribute& DBClusterSnapshotAttribute::operator =(const XmlNode
     XmlNode attributeNameNode = resultNode.FirstChild("AttributeName");
     if(!attributeNameNode.IsNull())
     {
-      m_attributeName = StringUtils::Trim(attributeNameNode.GetText().c_str());
+      m_attributeName = attributeNameNode.GetTextView().Trim().ToString();
       m_attributeNameHasBeenSet = true;
     }
     XmlNode attributeValuesNode = resultNode.FirstChild("AttributeValues");
@@ -60,7 +60,7 @@ DBClusterSnapshotAttribute& DBClusterSnapshotAttribute::operator =(const XmlNode
       XmlNode attributeValuesMember = attributeValuesNode.FirstChild("AttributeValue");
       while(!attributeValuesMember.IsNull())
       {
-        m_attributeValues.push_back(StringUtils::Trim(attributeValuesMember.GetText().c_str()));
+        m_attributeValues.push_back(attributeValuesMember.GetTextView().Trim().ToString());
         attributeValuesMember = attributeValuesMember.NextNode("AttributeValue");
       }
 
@@ -75,7 +75,7 @@ void DBClusterSnapshotAttribute::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_attributeNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AttributeName=" << StringUtils::URLEncode(m_attributeName.c_str()) << "&";
+      oStream << location << index << locationValue << ".AttributeName=" << StringUtils::URLEncoded(m_attributeName) << "&";
   }
 
   if(m_attributeValuesHasBeenSet)
@@ -83,7 +83,7 @@ void DBClusterSnapshotAttribute::OutputToStream(Aws::OStream& oStream, const cha
       unsigned attributeValuesIdx = 1;
       for(auto& item : m_attributeValues)
       {
-        oStream << location << index << locationValue << ".AttributeValue." << attributeValuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".AttributeValue." << attributeValuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -93,14 +93,14 @@ void DBClusterSnapshotAttribute::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_attributeNameHasBeenSet)
   {
-      oStream << location << ".AttributeName=" << StringUtils::URLEncode(m_attributeName.c_str()) << "&";
+      oStream << location << ".AttributeName=" << StringUtils::URLEncoded(m_attributeName) << "&";
   }
   if(m_attributeValuesHasBeenSet)
   {
       unsigned attributeValuesIdx = 1;
       for(auto& item : m_attributeValues)
       {
-        oStream << location << ".AttributeValue." << attributeValuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".AttributeValue." << attributeValuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
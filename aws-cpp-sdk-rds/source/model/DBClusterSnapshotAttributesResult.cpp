@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ DBClusterSnapshotAttributesResult& DBClusterSnapshotAttributesResult::operator =
     XmlNode dBClusterSnapshotIdentifierNode = resultNode.FirstChild("DBClusterSnapshotIdentifier");
     if(!dBClusterSnapshotIdentifierNode.IsNull())
     {
-      m_dBClusterSnapshotIdentifier = StringUtils::Trim(dBClusterSnapshotIdentifierNode.GetText().c_str());
+      m_dBClusterSnapshotIdentifier = dBClusterSnapshotIdentifierNode.GetTextView().Trim().ToString();
       m_dBClusterSnapshotIdentifierHasBeenSet = true;
     }
     XmlNode dBClusterSnapshotAttributesNode = resultNode.FirstChild("DBClusterSnapshotAttributes");
@@ -75,7 +76,7 @@ void DBClusterSnapshotAttributesResult::OutputToStream(Aws::OStream& oStream, co
 {
   if(m_dBClusterSnapshotIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBClusterSnapshotIdentifier=" << StringUtils::URLEncode(m_dBClusterSnapshotIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBClusterSnapshotIdentifier=" << StringUtils::URLEncoded(m_dBClusterSnapshotIdentifier) << "&";
   }
 
   if(m_dBClusterSnapshotAttributesHasBeenSet)
@@ -83,9 +84,9 @@ void DBClusterSnapshotAttributesResult::OutputToStream(Aws::OStream& oStream, co
       unsigned dBClusterSnapshotAttributesIdx = 1;
       for(auto& item : m_dBClusterSnapshotAttributes)
       {
-        Aws::StringStream dBClusterSnapshotAttributesSs;
+        Aws::Utils::Stream::StringOutputStream dBClusterSnapshotAttributesSs;
         dBClusterSnapshotAttributesSs << location << index << locationValue << ".DBClusterSnapshotAttribute." << dBClusterSnapshotAttributesIdx++;
-        item.OutputToStream(oStream, dBClusterSnapshotAttributesSs.str().c_str());
+        item.OutputToStream(oStream, dBClusterSnapshotAttributesSs.GetString().c_str());
       }
   }
 
@@ -95,16 +96,16 @@ void DBClusterSnapshotAttributesResult::OutputToStream(Aws::OStream& oStream, co
 {
   if(m_dBClusterSnapshotIdentifierHasBeenSet)
   {
-      oStream << location << ".DBClusterSnapshotIdentifier=" << StringUtils::URLEncode(m_dBClusterSnapshotIdentifier.c_str()) << "&";
+      oStream << location << ".DBClusterSnapshotIdentifier=" << StringUtils::URLEncoded(m_dBClusterSnapshotIdentifier) << "&";
   }
   if(m_dBClusterSnapshotAttributesHasBeenSet)
   {
       unsigned dBClusterSnapshotAttributesIdx = 1;
       for(auto& item : m_dBClusterSnapshotAttributes)
       {
-        Aws::StringStream dBClusterSnapshotAttributesSs;
+        Aws::Utils::Stream::StringOutputStream dBClusterSnapshotAttributesSs;
         dBClusterSnapshotAttributesSs << location <<  ".DBClusterSnapshotAttribute." << dBClusterSnapshotAttributesIdx++;
-        item.OutputToStream(oStream, dBClusterSnapshotAttributesSs.str().c_str());
+        item.OutputToStream(oStream, dBClusterSnapshotAttributesSs.GetString().c_str());
       }
   }
 }
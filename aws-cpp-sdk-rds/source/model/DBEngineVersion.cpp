@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -63,31 +64,31 @@ DBEngineVersion& DBEngineVersion::operator =(const XmlNode& xmlNode)
     XmlNode engineNode = resultNode.FirstChild("Engine");
     if(!engineNode.IsNull())
     {
-      m_engine = StringUtils::Trim(engineNode.GetText().c_str());
+      m_engine = engineNode.GetTextView().Trim().ToString();
       m_engineHasBeenSet = true;
     }
     XmlNode engineVersionNode = resultNode.FirstChild("EngineVersion");
     if(!engineVersionNode.IsNull())
     {
-      m_engineVersion = StringUtils::Trim(engineVersionNode.GetText().c_str());
+      m_engineVersion = engineVersionNode.GetTextView().Trim().ToString();
       m_engineVersionHasBeenSet = true;
     }
     XmlNode dBParameterGroupFamilyNode = resultNode.FirstChild("DBParameterGroupFamily");
     if(!dBParameterGroupFamilyNode.IsNull())
     {
-      m_dBParameterGroupFamily = StringUtils::Trim(dBParameterGroupFamilyNode.GetText().c_str());
+      m_dBParameterGroupFamily = dBParameterGroupFamilyNode.GetTextView().Trim().ToString();
       m_dBParameterGroupFamilyHasBeenSet = true;
     }
     XmlNode dBEngineDescriptionNode = resultNode.FirstChild("DBEngineDescription");
     if(!dBEngineDescriptionNode.IsNull())
     {
-      m_dBEngineDescription = StringUtils::Trim(dBEngineDescriptionNode.GetText().c_str());
+      m_dBEngineDescription = dBEngineDescriptionNode.GetTextView().Trim().ToString();
       m_dBEngineDescriptionHasBeenSet = true;
     }
     XmlNode dBEngineVersionDescriptionNode = resultNode.FirstChild("DBEngineVersionDescription");
     if(!dBEngineVersionDescriptionNode.IsNull())
     {
-      m_dBEngineVersionDescription = StringUtils::Trim(dBEngineVersionDescriptionNode.GetText().c_str());
+      m_dBEngineVersionDescription = dBEngineVersionDescriptionNode.GetTextView().Trim().ToString();
       m_dBEngineVersionDescriptionHasBeenSet = true;
     }
     XmlNode defaultCharacterSetNode = resultNode.FirstChild("DefaultCharacterSet");
@@ -129,34 +130,34 @@ void DBEngineVersion::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_engineHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
 
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_dBParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBParameterGroupFamily=" << StringUtils::URLEncode(m_dBParameterGroupFamily.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBParameterGroupFamily=" << StringUtils::URLEncoded(m_dBParameterGroupFamily) << "&";
   }
 
   if(m_dBEngineDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBEngineDescription=" << StringUtils::URLEncode(m_dBEngineDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBEngineDescription=" << StringUtils::URLEncoded(m_dBEngineDescription) << "&";
   }
 
   if(m_dBEngineVersionDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBEngineVersionDescription=" << StringUtils::URLEncode(m_dBEngineVersionDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBEngineVersionDescription=" << StringUtils::URLEncoded(m_dBEngineVersionDescription) << "&";
   }
 
   if(m_defaultCharacterSetHasBeenSet)
   {
-      Aws::StringStream defaultCharacterSetLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream defaultCharacterSetLocationAndMemberSs;
       defaultCharacterSetLocationAndMemberSs << location << index << locationValue << ".DefaultCharacterSet";
-      m_defaultCharacterSet.OutputToStream(oStream, defaultCharacterSetLocationAndMemberSs.str().c_str());
+      m_defaultCharacterSet.OutputToStream(oStream, defaultCharacterSetLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_supportedCharacterSetsHasBeenSet)
@@ -164,9 +165,9 @@ void DBEngineVersion::OutputToStream(Aws::OStream& oStream, const char* location
       unsigned supportedCharacterSetsIdx = 1;
       for(auto& item : m_supportedCharacterSets)
       {
-        Aws::StringStream supportedCharacterSetsSs;
+        Aws::Utils::Stream::StringOutputStream supportedCharacterSetsSs;
         supportedCharacterSetsSs << location << index << locationValue << ".CharacterSet." << supportedCharacterSetsIdx++;
-        item.OutputToStream(oStream, supportedCharacterSetsSs.str().c_str());
+        item.OutputToStream(oStream, supportedCharacterSetsSs.GetString().c_str());
       }
   }
 
@@ -175,9 +176,9 @@ void DBEngineVersion::OutputToStream(Aws::OStream& oStream, const char* location
       unsigned validUpgradeTargetIdx = 1;
       for(auto& item : m_validUpgradeTarget)
       {
-        Aws::StringStream validUpgradeTargetSs;
+        Aws::Utils::Stream::StringOutputStream validUpgradeTargetSs;
         validUpgradeTargetSs << location << index << locationValue << ".UpgradeTarget." << validUpgradeTargetIdx++;
-        item.OutputToStream(oStream, validUpgradeTargetSs.str().c_str());
+        item.OutputToStream(oStream, validUpgradeTargetSs.GetString().c_str());
       }
   }
 
@@ -187,23 +188,23 @@ void DBEngineVersion::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_engineHasBeenSet)
   {
-      oStream << location << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
   if(m_dBParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << ".DBParameterGroupFamily=" << StringUtils::URLEncode(m_dBParameterGroupFamily.c_str()) << "&";
+      oStream << location << ".DBParameterGroupFamily=" << StringUtils::URLEncoded(m_dBParameterGroupFamily) << "&";
   }
   if(m_dBEngineDescriptionHasBeenSet)
   {
-      oStream << location << ".DBEngineDescription=" << StringUtils::URLEncode(m_dBEngineDescription.c_str()) << "&";
+      oStream << location << ".DBEngineDescription=" << StringUtils::URLEncoded(m_dBEngineDescription) << "&";
   }
   if(m_dBEngineVersionDescriptionHasBeenSet)
   {
-      oStream << location << ".DBEngineVersionDescription=" << StringUtils::URLEncode(m_dBEngineVersionDescription.c_str()) << "&";
+      oStream << location << ".DBEngineVersionDescription=" << StringUtils::URLEncoded(m_dBEngineVersionDescription) << "&";
   }
   if(m_defaultCharacterSetHasBeenSet)
   {
@@ -216,9 +217,9 @@ void DBEngineVersion::OutputToStream(Aws::OStream& oStream, const char* location
       unsigned supportedCharacterSetsIdx = 1;
       for(auto& item : m_supportedCharacterSets)
       {
-        Aws::StringStream supportedCharacterSetsSs;
+        Aws::Utils::Stream::StringOutputStream supportedCharacterSetsSs;
         supportedCharacterSetsSs << location <<  ".CharacterSet." << supportedCharacterSetsIdx++;
-        item.OutputToStream(oStream, supportedCharacterSetsSs.str().c_str());
+        item.OutputToStream(oStream, supportedCharacterSetsSs.GetString().c_str());
       }
   }
   if(m_validUpgradeTargetHasBeenSet)
@@ -226,9 +227,9 @@ void DBEngineVersion::OutputToStream(Aws::OStream& oStream, const char* location
       unsigned validUpgradeTargetIdx = 1;
       for(auto& item : m_validUpgradeTarget)
       {
-        Aws::StringStream validUpgradeTargetSs;
+        Aws::Utils::Stream::StringOutputStream validUpgradeTargetSs;
         validUpgradeTargetSs << location <<  ".UpgradeTarget." << validUpgradeTargetIdx++;
-        item.OutputToStream(oStream, validUpgradeTargetSs.str().c_str());
+        item.OutputToStream(oStream, validUpgradeTargetSs.GetString().c_str());
       }
   }
 }
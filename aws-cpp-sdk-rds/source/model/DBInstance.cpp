@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -161,37 +162,37 @@ DBInstance& DBInstance::operator =(const XmlNode& xmlNode)
     XmlNode dBInstanceIdentifierNode = resultNode.FirstChild("DBInstanceIdentifier");
     if(!dBInstanceIdentifierNode.IsNull())
     {
-      m_dBInstanceIdentifier = StringUtils::Trim(dBInstanceIdentifierNode.GetText().c_str());
+      m_dBInstanceIdentifier = dBInstanceIdentifierNode.GetTextView().Trim().ToString();
       m_dBInstanceIdentifierHasBeenSet = true;
     }
     XmlNode dBInstanceClassNode = resultNode.FirstChild("DBInstanceClass");
     if(!dBInstanceClassNode.IsNull())
     {
-      m_dBInstanceClass = StringUtils::Trim(dBInstanceClassNode.GetText().c_str());
+      m_dBInstanceClass = dBInstanceClassNode.GetTextView().Trim().ToString();
       m_dBInstanceClassHasBeenSet = true;
     }
     XmlNode engineNode = resultNode.FirstChild("Engine");
     if(!engineNode.IsNull())
     {
-      m_engine = StringUtils::Trim(engineNode.GetText().c_str());
+      m_engine = engineNode.GetTextView().Trim().ToString();
       m_engineHasBeenSet = true;
     }
     XmlNode dBInstanceStatusNode = resultNode.FirstChild("DBInstanceStatus");
     if(!dBInstanceStatusNode.IsNull())
     {
-      m_dBInstanceStatus = StringUtils::Trim(dBInstanceStatusNode.GetText().c_str());
+      m_dBInstanceStatus = dBInstanceStatusNode.GetTextView().Trim().ToString();
       m_dBInstanceStatusHasBeenSet = true;
     }
     XmlNode masterUsernameNode = resultNode.FirstChild("MasterUsername");
     if(!masterUsernameNode.IsNull())
     {
-      m_masterUsername = StringUtils::Trim(masterUsernameNode.GetText().c_str());
+      m_masterUsername = masterUsernameNode.GetTextView().Trim().ToString();
       m_masterUsernameHasBeenSet = true;
     }
     XmlNode dBNameNode = resultNode.FirstChild("DBName");
     if(!dBNameNode.IsNull())
     {
-      m_dBName = StringUtils::Trim(dBNameNode.GetText().c_str());
+      m_dBName = dBNameNode.GetTextView().Trim().ToString();
       m_dBNameHasBeenSet = true;
     }
     XmlNode endpointNode = resultNode.FirstChild("Endpoint");
@@ -203,25 +204,25 @@ DBInstance& DBInstance::operator =(const XmlNode& xmlNode)
     XmlNode allocatedStorageNode = resultNode.FirstChild("AllocatedStorage");
     if(!allocatedStorageNode.IsNull())
     {
-      m_allocatedStorage = StringUtils::ConvertToInt32(StringUtils::Trim(allocatedStorageNode.GetText().c_str()).c_str());
+      m_allocatedStorage = StringUtils::ConvertToInt32(allocatedStorageNode.GetTextView().Trim().ToString().c_str());
       m_allocatedStorageHasBeenSet = true;
     }
     XmlNode instanceCreateTimeNode = resultNode.FirstChild("InstanceCreateTime");
     if(!instanceCreateTimeNode.IsNull())
     {
-      m_instanceCreateTime = DateTime(StringUtils::Trim(instanceCreateTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_instanceCreateTime = DateTime(instanceCreateTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_instanceCreateTimeHasBeenSet = true;
     }
     XmlNode preferredBackupWindowNode = resultNode.FirstChild("PreferredBackupWindow");
     if(!preferredBackupWindowNode.IsNull())
     {
-      m_preferredBackupWindow = StringUtils::Trim(preferredBackupWindowNode.GetText().c_str());
+      m_preferredBackupWindow = preferredBackupWindowNode.GetTextView().Trim().ToString();
       m_preferredBackupWindowHasBeenSet = true;
     }
     XmlNode backupRetentionPeriodNode = resultNode.FirstChild("BackupRetentionPeriod");
     if(!backupRetentionPeriodNode.IsNull())
     {
-      m_backupRetentionPeriod = StringUtils::ConvertToInt32(StringUtils::Trim(backupRetentionPeriodNode.GetText().c_str()).c_str());
+      m_backupRetentionPeriod = StringUtils::ConvertToInt32(backupRetentionPeriodNode.GetTextView().Trim().ToString().c_str());
       m_backupRetentionPeriodHasBeenSet = true;
     }
     XmlNode dBSecurityGroupsNode = resultNode.FirstChild("DBSecurityGroups");
@@ -263,7 +264,7 @@ DBInstance& DBInstance::operator =(const XmlNode& xmlNode)
     XmlNode availabilityZoneNode = resultNode.FirstChild("AvailabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode dBSubnetGroupNode = resultNode.FirstChild("DBSubnetGroup");
@@ -275,7 +276,7 @@ DBInstance& DBInstance::operator =(const XmlNode& xmlNode)
     XmlNode preferredMaintenanceWindowNode = resultNode.FirstChild("PreferredMaintenanceWindow");
     if(!preferredMaintenanceWindowNode.IsNull())
     {
-      m_preferredMaintenanceWindow = StringUtils::Trim(preferredMaintenanceWindowNode.GetText().c_str());
+      m_preferredMaintenanceWindow = preferredMaintenanceWindowNode.GetTextView().Trim().ToString();
       m_preferredMaintenanceWindowHasBeenSet = true;
     }
     XmlNode pendingModifiedValuesNode = resultNode.FirstChild("PendingModifiedValues");
@@ -287,31 +288,31 @@ DBInstance& DBInstance::operator =(const XmlNode& xmlNode)
     XmlNode latestRestorableTimeNode = resultNode.FirstChild("LatestRestorableTime");
     if(!latestRestorableTimeNode.IsNull())
     {
-      m_latestRestorableTime = DateTime(StringUtils::Trim(latestRestorableTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_latestRestorableTime = DateTime(latestRestorableTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_latestRestorableTimeHasBeenSet = true;
     }
     XmlNode multiAZNode = resultNode.FirstChild("MultiAZ");
     if(!multiAZNode.IsNull())
     {
-      m_multiAZ = StringUtils::ConvertToBool(StringUtils::Trim(multiAZNode.GetText().c_str()).c_str());
+      m_multiAZ = StringUtils::ConvertToBool(multiAZNode.GetTextView().Trim().ToString().c_str());
       m_multiAZHasBeenSet = true;
     }
     XmlNode engineVersionNode = resultNode.FirstChild("EngineVersion");
     if(!engineVersionNode.IsNull())
     {
-      m_engineVersion = StringUtils::Trim(engineVersionNode.GetText().c_str());
+      m_engineVersion = engineVersionNode.GetTextView().Trim().ToString();
       m_engineVersionHasBeenSet = true;
     }
     XmlNode autoMinorVersionUpgradeNode = resultNode.FirstChild("AutoMinorVersionUpgrade");
     if(!autoMinorVersionUpgradeNode.IsNull())
     {
-      m_autoMinorVersionUpgrade = StringUtils::ConvertToBool(StringUtils::Trim(autoMinorVersionUpgradeNode.GetText().c_str()).c_str());
+      m_autoMinorVersionUpgrade = StringUtils::ConvertToBool(autoMinorVersionUpgradeNode.GetTextView().Trim().ToString().c_str());
       m_autoMinorVersionUpgradeHasBeenSet = true;
     }
     XmlNode readReplicaSourceDBInstanceIdentifierNode = resultNode.FirstChild("ReadReplicaSourceDBInstanceIdentifier");
     if(!readReplicaSourceDBInstanceIdentifierNode.IsNull())
     {
-      m_readReplicaSourceDBInstanceIdentifier = StringUtils::Trim(readReplicaSourceDBInstanceIdentifierNode.GetText().c_str());
+      m_readReplicaSourceDBInstanceIdentifier = readReplicaSourceDBInstanceIdentifierNode.GetTextView().Trim().ToString();
       m_readReplicaSourceDBInstanceIdentifierHasBeenSet = true;
     }
     XmlNode readReplicaDBInstanceIdentifiersNode = resultNode.FirstChild("ReadReplicaDBInstanceIdentifiers");
@@ -320,7 +321,7 @@ DBInstance& DBInstance::operator =(const XmlNode& xmlNode)
       XmlNode readReplicaDBInstanceIdentifiersMember = readReplicaDBInstanceIdentifiersNode.FirstChild("ReadReplicaDBInstanceIdentifier");
       while(!readReplicaDBInstanceIdentifiersMember.IsNull())
       {
-        m_readReplicaDBInstanceIdentifiers.push_back(StringUtils::Trim(readReplicaDBInstanceIdentifiersMember.GetText().c_str()));
+        m_readReplicaDBInstanceIdentifiers.push_back(readReplicaDBInstanceIdentifiersMember.GetTextView().Trim().ToString());
         readReplicaDBInstanceIdentifiersMember = readReplicaDBInstanceIdentifiersMember.NextNode("ReadReplicaDBInstanceIdentifier");
       }
 
@@ -329,13 +330,13 @@ DBInstance& DBInstance::operator =(const XmlNode& xmlNode)
     XmlNode licenseModelNode = resultNode.FirstChild("LicenseModel");
     if(!licenseModelNode.IsNull())
     {
-      m_licenseModel = StringUtils::Trim(licenseModelNode.GetText().c_str());
+      m_licenseModel = licenseModelNode.GetTextView().Trim().ToString();
       m_licenseModelHasBeenSet = true;
     }
     XmlNode iopsNode = resultNode.FirstChild("Iops");
     if(!iopsNode.IsNull())
     {
-      m_iops = StringUtils::ConvertToInt32(StringUtils::Trim(iopsNode.GetText().c_str()).c_str());
+      m_iops = StringUtils::ConvertToInt32(iopsNode.GetTextView().Trim().ToString().c_str());
       m_iopsHasBeenSet = true;
     }
     XmlNode optionGroupMembershipsNode = resultNode.FirstChild("OptionGroupMemberships");
@@ -353,19 +354,19 @@ DBInstance& DBInstance::operator =(const XmlNode& xmlNode)
     XmlNode characterSetNameNode = resultNode.FirstChild("CharacterSetName");
     if(!characterSetNameNode.IsNull())
     {
-      m_characterSetName = StringUtils::Trim(characterSetNameNode.GetText().c_str());
+      m_characterSetName = characterSetNameNode.GetTextView().Trim().ToString();
       m_characterSetNameHasBeenSet = true;
     }
     XmlNode secondaryAvailabilityZoneNode = resultNode.FirstChild("SecondaryAvailabilityZone");
     if(!secondaryAvailabilityZoneNode.IsNull())
     {
-      m_secondaryAvailabilityZone = StringUtils::Trim(secondaryAvailabilityZoneNode.GetText().c_str());
+      m_secondaryAvailabilityZone = secondaryAvailabilityZoneNode.GetTextView().Trim().ToString();
       m_secondaryAvailabilityZoneHasBeenSet = true;
     }
     XmlNode publiclyAccessibleNode = resultNode.FirstChild("PubliclyAccessible");
     if(!publiclyAccessibleNode.IsNull())
     {
-      m_publiclyAccessible = StringUtils::ConvertToBool(StringUtils::Trim(publiclyAccessibleNode.GetText().c_str()).c_str());
+      m_publiclyAccessible = StringUtils::ConvertToBool(publiclyAccessibleNode.GetTextView().Trim().ToString().c_str());
       m_publiclyAccessibleHasBeenSet = true;
     }
     XmlNode statusInfosNode = resultNode.FirstChild("StatusInfos");
@@ -383,49 +384,49 @@ DBInstance& DBInstance::operator =(const XmlNode& xmlNode)
     XmlNode storageTypeNode = resultNode.FirstChild("StorageType");
     if(!storageTypeNode.IsNull())
     {
-      m_storageType = StringUtils::Trim(storageTypeNode.GetText().c_str());
+      m_storageType = storageTypeNode.GetTextView().Trim().ToString();
       m_storageTypeHasBeenSet = true;
     }
     XmlNode tdeCredentialArnNode = resultNode.FirstChild("TdeCredentialArn");
     if(!tdeCredentialArnNode.IsNull())
     {
-      m_tdeCredentialArn = StringUtils::Trim(tdeCredentialArnNode.GetText().c_str());
+      m_tdeCredentialArn = tdeCredentialArnNode.GetTextView().Trim().ToString();
       m_tdeCredentialArnHasBeenSet = true;
     }
     XmlNode dbInstancePortNode = resultNode.FirstChild("DbInstancePort");
     if(!dbInstancePortNode.IsNull())
     {
-      m_dbInstancePort = StringUtils::ConvertToInt32(StringUtils::Trim(dbInstancePortNode.GetText().c_str()).c_str());
+      m_dbInstancePort = StringUtils::ConvertToInt32(dbInstancePortNode.GetTextView().Trim().ToString().c_str());
       m_dbInstancePortHasBeenSet = true;
     }
     XmlNode dBClusterIdentifierNode = resultNode.FirstChild("DBClusterIdentifier");
     if(!dBClusterIdentifierNode.IsNull())
     {
-      m_dBClusterIdentifier = StringUtils::Trim(dBClusterIdentifierNode.GetText().c_str());
+      m_dBClusterIdentifier = dBClusterIdentifierNode.GetTextView().Trim().ToString();
       m_dBClusterIdentifierHasBeenSet = true;
     }
     XmlNode storageEncryptedNode = resultNode.FirstChild("StorageEncrypted");
     if(!storageEncryptedNode.IsNull())
     {
-      m_storageEncrypted = StringUtils::ConvertToBool(StringUtils::Trim(storageEncryptedNode.GetText().c_str()).c_str());
+      m_storageEncrypted = StringUtils::ConvertToBool(storageEncryptedNode.GetTextView().Trim().ToString().c_str());
       m_storageEncryptedHasBeenSet = true;
     }
     XmlNode kmsKeyIdNode = resultNode.FirstChild("KmsKeyId");
     if(!kmsKeyIdNode.IsNull())
     {
-      m_kmsKeyId = StringUtils::Trim(kmsKeyIdNode.GetText().c_str());
+      m_kmsKeyId = kmsKeyIdNode.GetTextView().Trim().ToString();
       m_kmsKeyIdHasBeenSet = true;
     }
     XmlNode dbiResourceIdNode = resultNode.FirstChild("DbiResourceId");
     if(!dbiResourceIdNode.IsNull())
     {
-      m_dbiResourceId = StringUtils::Trim(dbiResourceIdNode.GetText().c_str());
+      m_dbiResourceId = dbiResourceIdNode.GetTextView().Trim().ToString();
       m_dbiResourceIdHasBeenSet = true;
     }
     XmlNode cACertificateIdentifierNode = resultNode.FirstChild("CACertificateIdentifier");
     if(!cACertificateIdentifierNode.IsNull())
     {
-      m_cACertificateIdentifier = StringUtils::Trim(cACertificateIdentifierNode.GetText().c_str());
+      m_cACertificateIdentifier = cACertificateIdentifierNode.GetTextView().Trim().ToString();
       m_cACertificateIdentifierHasBeenSet = true;
     }
     XmlNode domainMembershipsNode = resultNode.FirstChild("DomainMemberships");
@@ -443,37 +444,37 @@ DBInstance& DBInstance::operator =(const XmlNode& xmlNode)
     XmlNode copyTagsToSnapshotNode = resultNode.FirstChild("CopyTagsToSnapshot");
     if(!copyTagsToSnapshotNode.IsNull())
     {
-      m_copyTagsToSnapshot = StringUtils::ConvertToBool(StringUtils::Trim(copyTagsToSnapshotNode.GetText().c_str()).c_str());
+      m_copyTagsToSnapshot = StringUtils::ConvertToBool(copyTagsToSnapshotNode.GetTextView().Trim().ToString().c_str());
       m_copyTagsToSnapshotHasBeenSet = true;
     }
     XmlNode monitoringIntervalNode = resultNode.FirstChild("MonitoringInterval");
     if(!monitoringIntervalNode.IsNull())
     {
-      m_monitoringInterval = StringUtils::ConvertToInt32(StringUtils::Trim(monitoringIntervalNode.GetText().c_str()).c_str());
+      m_monitoringInterval = StringUtils::ConvertToInt32(monitoringIntervalNode.GetTextView().Trim().ToString().c_str());
       m_monitoringIntervalHasBeenSet = true;
     }
     XmlNode enhancedMonitoringResourceArnNode = resultNode.FirstChild("EnhancedMonitoringResourceArn");
     if(!enhancedMonitoringResourceArnNode.IsNull())
     {
-      m_enhancedMonitoringResourceArn = StringUtils::Trim(enhancedMonitoringResourceArnNode.GetText().c_str());
+      m_enhancedMonitoringResourceArn = enhancedMonitoringResourceArnNode.GetTextView().Trim().ToString();
       m_enhancedMonitoringResourceArnHasBeenSet = true;
     }
     XmlNode monitoringRoleArnNode = resultNode.FirstChild("MonitoringRoleArn");
     if(!monitoringRoleArnNode.IsNull())
     {
-      m_monitoringRoleArn = StringUtils::Trim(monitoringRoleArnNode.GetText().c_str());
+      m_monitoringRoleArn = monitoringRoleArnNode.GetTextView().Trim().ToString();
       m_monitoringRoleArnHasBeenSet = true;
     }
     XmlNode promotionTierNode = resultNode.FirstChild("PromotionTier");
     if(!promotionTierNode.IsNull())
     {
-      m_promotionTier = StringUtils::ConvertToInt32(StringUtils::Trim(promotionTierNode.GetText().c_str()).c_str());
+      m_promotionTier = StringUtils::ConvertToInt32(promotionTierNode.GetTextView().Trim().ToString().c_str());
       m_promotionTierHasBeenSet = true;
     }
     XmlNode dBInstanceArnNode = resultNode.FirstChild("DBInstanceArn");
     if(!dBInstanceArnNode.IsNull())
     {
-      m_dBInstanceArn = StringUtils::Trim(dBInstanceArnNode.GetText().c_str());
+      m_dBInstanceArn = dBInstanceArnNode.GetTextView().Trim().ToString();
       m_dBInstanceArnHasBeenSet = true;
     }
   }
@@ -485,39 +486,39 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
 
   if(m_dBInstanceClassHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBInstanceClass=" << StringUtils::URLEncode(m_dBInstanceClass.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBInstanceClass=" << StringUtils::URLEncoded(m_dBInstanceClass) << "&";
   }
 
   if(m_engineHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
 
   if(m_dBInstanceStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBInstanceStatus=" << StringUtils::URLEncode(m_dBInstanceStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBInstanceStatus=" << StringUtils::URLEncoded(m_dBInstanceStatus) << "&";
   }
 
   if(m_masterUsernameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MasterUsername=" << StringUtils::URLEncode(m_masterUsername.c_str()) << "&";
+      oStream << location << index << locationValue << ".MasterUsername=" << StringUtils::URLEncoded(m_masterUsername) << "&";
   }
 
   if(m_dBNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBName=" << StringUtils::URLEncode(m_dBName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBName=" << StringUtils::URLEncoded(m_dBName) << "&";
   }
 
   if(m_endpointHasBeenSet)
   {
-      Aws::StringStream endpointLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream endpointLocationAndMemberSs;
       endpointLocationAndMemberSs << location << index << locationValue << ".Endpoint";
-      m_endpoint.OutputToStream(oStream, endpointLocationAndMemberSs.str().c_str());
+      m_endpoint.OutputToStream(oStream, endpointLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_allocatedStorageHasBeenSet)
@@ -527,12 +528,12 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_instanceCreateTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceCreateTime=" << StringUtils::URLEncode(m_instanceCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceCreateTime=" << StringUtils::URLEncoded(m_instanceCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_preferredBackupWindowHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PreferredBackupWindow=" << StringUtils::URLEncode(m_preferredBackupWindow.c_str()) << "&";
+      oStream << location << index << locationValue << ".PreferredBackupWindow=" << StringUtils::URLEncoded(m_preferredBackupWindow) << "&";
   }
 
   if(m_backupRetentionPeriodHasBeenSet)
@@ -545,9 +546,9 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned dBSecurityGroupsIdx = 1;
       for(auto& item : m_dBSecurityGroups)
       {
-        Aws::StringStream dBSecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream dBSecurityGroupsSs;
         dBSecurityGroupsSs << location << index << locationValue << ".DBSecurityGroup." << dBSecurityGroupsIdx++;
-        item.OutputToStream(oStream, dBSecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, dBSecurityGroupsSs.GetString().c_str());
       }
   }
 
@@ -556,9 +557,9 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned vpcSecurityGroupsIdx = 1;
       for(auto& item : m_vpcSecurityGroups)
       {
-        Aws::StringStream vpcSecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream vpcSecurityGroupsSs;
         vpcSecurityGroupsSs << location << index << locationValue << ".VpcSecurityGroupMembership." << vpcSecurityGroupsIdx++;
-        item.OutputToStream(oStream, vpcSecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, vpcSecurityGroupsSs.GetString().c_str());
       }
   }
 
@@ -567,39 +568,39 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned dBParameterGroupsIdx = 1;
       for(auto& item : m_dBParameterGroups)
       {
-        Aws::StringStream dBParameterGroupsSs;
+        Aws::Utils::Stream::StringOutputStream dBParameterGroupsSs;
         dBParameterGroupsSs << location << index << locationValue << ".DBParameterGroup." << dBParameterGroupsIdx++;
-        item.OutputToStream(oStream, dBParameterGroupsSs.str().c_str());
+        item.OutputToStream(oStream, dBParameterGroupsSs.GetString().c_str());
       }
   }
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_dBSubnetGroupHasBeenSet)
   {
-      Aws::StringStream dBSubnetGroupLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream dBSubnetGroupLocationAndMemberSs;
       dBSubnetGroupLocationAndMemberSs << location << index << locationValue << ".DBSubnetGroup";
-      m_dBSubnetGroup.OutputToStream(oStream, dBSubnetGroupLocationAndMemberSs.str().c_str());
+      m_dBSubnetGroup.OutputToStream(oStream, dBSubnetGroupLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+      oStream << location << index << locationValue << ".PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
 
   if(m_pendingModifiedValuesHasBeenSet)
   {
-      Aws::StringStream pendingModifiedValuesLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream pendingModifiedValuesLocationAndMemberSs;
       pendingModifiedValuesLocationAndMemberSs << location << index << locationValue << ".PendingModifiedValues";
-      m_pendingModifiedValues.OutputToStream(oStream, pendingModifiedValuesLocationAndMemberSs.str().c_str());
+      m_pendingModifiedValues.OutputToStream(oStream, pendingModifiedValuesLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_latestRestorableTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LatestRestorableTime=" << StringUtils::URLEncode(m_latestRestorableTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".LatestRestorableTime=" << StringUtils::URLEncoded(m_latestRestorableTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_multiAZHasBeenSet)
@@ -609,7 +610,7 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_autoMinorVersionUpgradeHasBeenSet)
@@ -619,7 +620,7 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_readReplicaSourceDBInstanceIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReadReplicaSourceDBInstanceIdentifier=" << StringUtils::URLEncode(m_readReplicaSourceDBInstanceIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReadReplicaSourceDBInstanceIdentifier=" << StringUtils::URLEncoded(m_readReplicaSourceDBInstanceIdentifier) << "&";
   }
 
   if(m_readReplicaDBInstanceIdentifiersHasBeenSet)
@@ -627,13 +628,13 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned readReplicaDBInstanceIdentifiersIdx = 1;
       for(auto& item : m_readReplicaDBInstanceIdentifiers)
       {
-        oStream << location << index << locationValue << ".ReadReplicaDBInstanceIdentifier." << readReplicaDBInstanceIdentifiersIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".ReadReplicaDBInstanceIdentifier." << readReplicaDBInstanceIdentifiersIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
   if(m_licenseModelHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LicenseModel=" << StringUtils::URLEncode(m_licenseModel.c_str()) << "&";
+      oStream << location << index << locationValue << ".LicenseModel=" << StringUtils::URLEncoded(m_licenseModel) << "&";
   }
 
   if(m_iopsHasBeenSet)
@@ -646,20 +647,20 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned optionGroupMembershipsIdx = 1;
       for(auto& item : m_optionGroupMemberships)
       {
-        Aws::StringStream optionGroupMembershipsSs;
+        Aws::Utils::Stream::StringOutputStream optionGroupMembershipsSs;
         optionGroupMembershipsSs << location << index << locationValue << ".OptionGroupMembership." << optionGroupMembershipsIdx++;
-        item.OutputToStream(oStream, optionGroupMembershipsSs.str().c_str());
+        item.OutputToStream(oStream, optionGroupMembershipsSs.GetString().c_str());
       }
   }
 
   if(m_characterSetNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CharacterSetName=" << StringUtils::URLEncode(m_characterSetName.c_str()) << "&";
+      oStream << location << index << locationValue << ".CharacterSetName=" << StringUtils::URLEncoded(m_characterSetName) << "&";
   }
 
   if(m_secondaryAvailabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SecondaryAvailabilityZone=" << StringUtils::URLEncode(m_secondaryAvailabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".SecondaryAvailabilityZone=" << StringUtils::URLEncoded(m_secondaryAvailabilityZone) << "&";
   }
 
   if(m_publiclyAccessibleHasBeenSet)
@@ -672,20 +673,20 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned statusInfosIdx = 1;
       for(auto& item : m_statusInfos)
       {
-        Aws::StringStream statusInfosSs;
+        Aws::Utils::Stream::StringOutputStream statusInfosSs;
         statusInfosSs << location << index << locationValue << ".DBInstanceStatusInfo." << statusInfosIdx++;
-        item.OutputToStream(oStream, statusInfosSs.str().c_str());
+        item.OutputToStream(oStream, statusInfosSs.GetString().c_str());
       }
   }
 
   if(m_storageTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StorageType=" << StringUtils::URLEncode(m_storageType.c_str()) << "&";
+      oStream << location << index << locationValue << ".StorageType=" << StringUtils::URLEncoded(m_storageType) << "&";
   }
 
   if(m_tdeCredentialArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TdeCredentialArn=" << StringUtils::URLEncode(m_tdeCredentialArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".TdeCredentialArn=" << StringUtils::URLEncoded(m_tdeCredentialArn) << "&";
   }
 
   if(m_dbInstancePortHasBeenSet)
@@ -695,7 +696,7 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_dBClusterIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBClusterIdentifier=" << StringUtils::URLEncode(m_dBClusterIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBClusterIdentifier=" << StringUtils::URLEncoded(m_dBClusterIdentifier) << "&";
   }
 
   if(m_storageEncryptedHasBeenSet)
@@ -705,17 +706,17 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_kmsKeyIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+      oStream << location << index << locationValue << ".KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
 
   if(m_dbiResourceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DbiResourceId=" << StringUtils::URLEncode(m_dbiResourceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".DbiResourceId=" << StringUtils::URLEncoded(m_dbiResourceId) << "&";
   }
 
   if(m_cACertificateIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CACertificateIdentifier=" << StringUtils::URLEncode(m_cACertificateIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".CACertificateIdentifier=" << StringUtils::URLEncoded(m_cACertificateIdentifier) << "&";
   }
 
   if(m_domainMembershipsHasBeenSet)
@@ -723,9 +724,9 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location, uns
       unsigned domainMembershipsIdx = 1;
       for(auto& item : m_domainMemberships)
       {
-        Aws::StringStream domainMembershipsSs;
+        Aws::Utils::Stream::StringOutputStream domainMembershipsSs;
         domainMembershipsSs << location << index << locationValue << ".DomainMembership." << domainMembershipsIdx++;
-        item.OutputToStream(oStream, domainMembershipsSs.str().c_str());
+        item.OutputToStream(oStream, domainMembershipsSs.GetString().c_str());
       }
   }
 
@@ -741,12 +742,12 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_enhancedMonitoringResourceArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EnhancedMonitoringResourceArn=" << StringUtils::URLEncode(m_enhancedMonitoringResourceArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".EnhancedMonitoringResourceArn=" << StringUtils::URLEncoded(m_enhancedMonitoringResourceArn) << "&";
   }
 
   if(m_monitoringRoleArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MonitoringRoleArn=" << StringUtils::URLEncode(m_monitoringRoleArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".MonitoringRoleArn=" << StringUtils::URLEncoded(m_monitoringRoleArn) << "&";
   }
 
   if(m_promotionTierHasBeenSet)
@@ -756,7 +757,7 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_dBInstanceArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBInstanceArn=" << StringUtils::URLEncode(m_dBInstanceArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBInstanceArn=" << StringUtils::URLEncoded(m_dBInstanceArn) << "&";
   }
 
 }
@@ -765,27 +766,27 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-      oStream << location << ".DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+      oStream << location << ".DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
   if(m_dBInstanceClassHasBeenSet)
   {
-      oStream << location << ".DBInstanceClass=" << StringUtils::URLEncode(m_dBInstanceClass.c_str()) << "&";
+      oStream << location << ".DBInstanceClass=" << StringUtils::URLEncoded(m_dBInstanceClass) << "&";
   }
   if(m_engineHasBeenSet)
   {
-      oStream << location << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
   if(m_dBInstanceStatusHasBeenSet)
   {
-      oStream << location << ".DBInstanceStatus=" << StringUtils::URLEncode(m_dBInstanceStatus.c_str()) << "&";
+      oStream << location << ".DBInstanceStatus=" << StringUtils::URLEncoded(m_dBInstanceStatus) << "&";
   }
   if(m_masterUsernameHasBeenSet)
   {
-      oStream << location << ".MasterUsername=" << StringUtils::URLEncode(m_masterUsername.c_str()) << "&";
+      oStream << location << ".MasterUsername=" << StringUtils::URLEncoded(m_masterUsername) << "&";
   }
   if(m_dBNameHasBeenSet)
   {
-      oStream << location << ".DBName=" << StringUtils::URLEncode(m_dBName.c_str()) << "&";
+      oStream << location << ".DBName=" << StringUtils::URLEncoded(m_dBName) << "&";
   }
   if(m_endpointHasBeenSet)
   {
@@ -799,11 +800,11 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_instanceCreateTimeHasBeenSet)
   {
-      oStream << location << ".InstanceCreateTime=" << StringUtils::URLEncode(m_instanceCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".InstanceCreateTime=" << StringUtils::URLEncoded(m_instanceCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_preferredBackupWindowHasBeenSet)
   {
-      oStream << location << ".PreferredBackupWindow=" << StringUtils::URLEncode(m_preferredBackupWindow.c_str()) << "&";
+      oStream << location << ".PreferredBackupWindow=" << StringUtils::URLEncoded(m_preferredBackupWindow) << "&";
   }
   if(m_backupRetentionPeriodHasBeenSet)
   {
@@ -814,9 +815,9 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned dBSecurityGroupsIdx = 1;
       for(auto& item : m_dBSecurityGroups)
       {
-        Aws::StringStream dBSecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream dBSecurityGroupsSs;
         dBSecurityGroupsSs << location <<  ".DBSecurityGroup." << dBSecurityGroupsIdx++;
-        item.OutputToStream(oStream, dBSecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, dBSecurityGroupsSs.GetString().c_str());
       }
   }
   if(m_vpcSecurityGroupsHasBeenSet)
@@ -824,9 +825,9 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned vpcSecurityGroupsIdx = 1;
       for(auto& item : m_vpcSecurityGroups)
       {
-        Aws::StringStream vpcSecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream vpcSecurityGroupsSs;
         vpcSecurityGroupsSs << location <<  ".VpcSecurityGroupMembership." << vpcSecurityGroupsIdx++;
-        item.OutputToStream(oStream, vpcSecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, vpcSecurityGroupsSs.GetString().c_str());
       }
   }
   if(m_dBParameterGroupsHasBeenSet)
@@ -834,14 +835,14 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned dBParameterGroupsIdx = 1;
       for(auto& item : m_dBParameterGroups)
       {
-        Aws::StringStream dBParameterGroupsSs;
+        Aws::Utils::Stream::StringOutputStream dBParameterGroupsSs;
         dBParameterGroupsSs << location <<  ".DBParameterGroup." << dBParameterGroupsIdx++;
-        item.OutputToStream(oStream, dBParameterGroupsSs.str().c_str());
+        item.OutputToStream(oStream, dBParameterGroupsSs.GetString().c_str());
       }
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_dBSubnetGroupHasBeenSet)
   {
@@ -851,7 +852,7 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-      oStream << location << ".PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+      oStream << location << ".PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
   if(m_pendingModifiedValuesHasBeenSet)
   {
@@ -861,7 +862,7 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_latestRestorableTimeHasBeenSet)
   {
-      oStream << location << ".LatestRestorableTime=" << StringUtils::URLEncode(m_latestRestorableTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".LatestRestorableTime=" << StringUtils::URLEncoded(m_latestRestorableTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_multiAZHasBeenSet)
   {
@@ -869,7 +870,7 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
   if(m_autoMinorVersionUpgradeHasBeenSet)
   {
@@ -877,19 +878,19 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_readReplicaSourceDBInstanceIdentifierHasBeenSet)
   {
-      oStream << location << ".ReadReplicaSourceDBInstanceIdentifier=" << StringUtils::URLEncode(m_readReplicaSourceDBInstanceIdentifier.c_str()) << "&";
+      oStream << location << ".ReadReplicaSourceDBInstanceIdentifier=" << StringUtils::URLEncoded(m_readReplicaSourceDBInstanceIdentifier) << "&";
   }
   if(m_readReplicaDBInstanceIdentifiersHasBeenSet)
   {
       unsigned readReplicaDBInstanceIdentifiersIdx = 1;
       for(auto& item : m_readReplicaDBInstanceIdentifiers)
       {
-        oStream << location << ".ReadReplicaDBInstanceIdentifier." << readReplicaDBInstanceIdentifiersIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".ReadReplicaDBInstanceIdentifier." << readReplicaDBInstanceIdentifiersIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_licenseModelHasBeenSet)
   {
-      oStream << location << ".LicenseModel=" << StringUtils::URLEncode(m_licenseModel.c_str()) << "&";
+      oStream << location << ".LicenseModel=" << StringUtils::URLEncoded(m_licenseModel) << "&";
   }
   if(m_iopsHasBeenSet)
   {
@@ -900,18 +901,18 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned optionGroupMembershipsIdx = 1;
       for(auto& item : m_optionGroupMemberships)
       {
-        Aws::StringStream optionGroupMembershipsSs;
+        Aws::Utils::Stream::StringOutputStream optionGroupMembershipsSs;
         optionGroupMembershipsSs << location <<  ".OptionGroupMembership." << optionGroupMembershipsIdx++;
-        item.OutputToStream(oStream, optionGroupMembershipsSs.str().c_str());
+        item.OutputToStream(oStream, optionGroupMembershipsSs.GetString().c_str());
       }
   }
   if(m_characterSetNameHasBeenSet)
   {
-      oStream << location << ".CharacterSetName=" << StringUtils::URLEncode(m_characterSetName.c_str()) << "&";
+      oStream << location << ".CharacterSetName=" << StringUtils::URLEncoded(m_characterSetName) << "&";
   }
   if(m_secondaryAvailabilityZoneHasBeenSet)
   {
-      oStream << location << ".SecondaryAvailabilityZone=" << StringUtils::URLEncode(m_secondaryAvailabilityZone.c_str()) << "&";
+      oStream << location << ".SecondaryAvailabilityZone=" << StringUtils::URLEncoded(m_secondaryAvailabilityZone) << "&";
   }
   if(m_publiclyAccessibleHasBeenSet)
   {
@@ -922,18 +923,18 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location) con
       unsigned statusInfosIdx = 1;
       for(auto& item : m_statusInfos)
       {
-        Aws::StringStream statusInfosSs;
+        Aws::Utils::Stream::StringOutputStream statusInfosSs;
         statusInfosSs << location <<  ".DBInstanceStatusInfo." << statusInfosIdx++;
-        item.OutputToStream(oStream, statusInfosSs.str().c_str());
+        item.OutputToStream(oStream, statusInfosSs.GetString().c_str());
       }
   }
   if(m_storageTypeHasBeenSet)
   {
-      oStream << location << ".StorageType=" << StringUtils::URLEncode(m_storageType.c_str()) << "&";
+      oStream << location << ".StorageType=" << StringUtils::URLEncoded(m_storageType) << "&";
   }
   if(m_tdeCredentialArnHasBeenSet)
   {
-      oStream << location << ".TdeCredentialArn=" << StringUtils::URLEncode(m_tdeCredentialArn.c_str()) << "&";
+      oStream << location << ".TdeCredentialArn=" << StringUtils::URLEncoded(m_tdeCredentialArn) << "&";
   }
   if(m_dbInstancePortHasBeenSet)
   {
@@ -941,7 +942,7 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_dBClusterIdentifierHasBeenSet)
   {
-      oStream << location << ".DBClusterIdentifier=" << StringUtils::URLEncode(m_dBClusterIdentifier.c_str()) << "&";
+      oStream << location << ".DBClusterIdentifier=" << StringUtils::URLEncoded(m_dBClusterIdentifier) << "&";
   }
   if(m_storageEncryptedHasBeenSet)
   {
@@ -949,24 +950,24 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_kmsKeyIdHasBeenSet)
   {
-      oStream << location << ".KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+      oStream << location << ".KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
   if(m_dbiResourceIdHasBeenSet)
   {
-      oStream << location << ".DbiResourceId=" << StringUtils::URLEncode(m_dbiResourceId.c_str()) << "&";
+      oStream << location << ".DbiResourceId=" << StringUtils::URLEncoded(m_dbiResourceId) << "&";
   }
   if(m_cACertificateIdentifierHasBeenSet)
   {
-      oStream << location << ".CACertificateIdentifier=" << StringUtils::URLEncode(m_cACertificateIdentifier.c_str()) << "&";
+      oStream << location << ".CACertificateIdentifier=" << StringUtils::URLEncoded(m_cACertificateIdentifier) << "&";
   }
   if(m_domainMembershipsHasBeenSet)
   {
       unsigned domainMembershipsIdx = 1;
       for(auto& item : m_domainMemberships)
       {
-        Aws::StringStream domainMembershipsSs;
+        Aws::Utils::Stream::StringOutputStream domainMembershipsSs;
         domainMembershipsSs << location <<  ".DomainMembership." << domainMembershipsIdx++;
-        item.OutputToStream(oStream, domainMembershipsSs.str().c_str());
+        item.OutputToStream(oStream, domainMembershipsSs.GetString().c_str());
       }
   }
   if(m_copyTagsToSnapshotHasBeenSet)
@@ -979,11 +980,11 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_enhancedMonitoringResourceArnHasBeenSet)
   {
-      oStream << location << ".EnhancedMonitoringResourceArn=" << StringUtils::URLEncode(m_enhancedMonitoringResourceArn.c_str()) << "&";
+      oStream << location << ".EnhancedMonitoringResourceArn=" << StringUtils::URLEncoded(m_enhancedMonitoringResourceArn) << "&";
   }
   if(m_monitoringRoleArnHasBeenSet)
   {
-      oStream << location << ".MonitoringRoleArn=" << StringUtils::URLEncode(m_monitoringRoleArn.c_str()) << "&";
+      oStream << location << ".MonitoringRoleArn=" << StringUtils::URLEncoded(m_monitoringRoleArn) << "&";
   }
   if(m_promotionTierHasBeenSet)
   {
@@ -991,7 +992,7 @@ void DBInstance::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_dBInstanceArnHasBeenSet)
   {
-      oStream << location << ".DBInstanceArn=" << StringUtils::URLEncode(m_dBInstanceArn.c_str()) << "&";
+      oStream << location << ".DBInstanceArn=" << StringUtils::URLEncoded(m_dBInstanceArn) << "&";
   }
 }
 
@@ -57,25 +57,25 @@ DBInstanceStatusInfo& DBInstanceStatusInfo::operator =(const XmlNode& xmlNode)
     XmlNode statusTypeNode = resultNode.FirstChild("StatusType");
     if(!statusTypeNode.IsNull())
     {
-      m_statusType = StringUtils::Trim(statusTypeNode.GetText().c_str());
+      m_statusType = statusTypeNode.GetTextView().Trim().ToString();
       m_statusTypeHasBeenSet = true;
     }
     XmlNode normalNode = resultNode.FirstChild("Normal");
     if(!normalNode.IsNull())
     {
-      m_normal = StringUtils::ConvertToBool(StringUtils::Trim(normalNode.GetText().c_str()).c_str());
+      m_normal = StringUtils::ConvertToBool(normalNode.GetTextView().Trim().ToString().c_str());
       m_normalHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode messageNode = resultNode.FirstChild("Message");
     if(!messageNode.IsNull())
     {
-      m_message = StringUtils::Trim(messageNode.GetText().c_str());
+      m_message = messageNode.GetTextView().Trim().ToString();
       m_messageHasBeenSet = true;
     }
   }
@@ -87,7 +87,7 @@ void DBInstanceStatusInfo::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_statusTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StatusType=" << StringUtils::URLEncode(m_statusType.c_str()) << "&";
+      oStream << location << index << locationValue << ".StatusType=" << StringUtils::URLEncoded(m_statusType) << "&";
   }
 
   if(m_normalHasBeenSet)
@@ -97,12 +97,12 @@ void DBInstanceStatusInfo::OutputToStream(Aws::OStream& oStream, const char* loc
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_messageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 
 }
@@ -111,7 +111,7 @@ void DBInstanceStatusInfo::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_statusTypeHasBeenSet)
   {
-      oStream << location << ".StatusType=" << StringUtils::URLEncode(m_statusType.c_str()) << "&";
+      oStream << location << ".StatusType=" << StringUtils::URLEncoded(m_statusType) << "&";
   }
   if(m_normalHasBeenSet)
   {
@@ -119,11 +119,11 @@ void DBInstanceStatusInfo::OutputToStream(Aws::OStream& oStream, const char* loc
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_messageHasBeenSet)
   {
-      oStream << location << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 }
 
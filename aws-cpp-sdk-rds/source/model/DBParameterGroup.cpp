@@ -55,25 +55,25 @@ DBParameterGroup& DBParameterGroup::operator =(const XmlNode& xmlNode)
     XmlNode dBParameterGroupNameNode = resultNode.FirstChild("DBParameterGroupName");
     if(!dBParameterGroupNameNode.IsNull())
     {
-      m_dBParameterGroupName = StringUtils::Trim(dBParameterGroupNameNode.GetText().c_str());
+      m_dBParameterGroupName = dBParameterGroupNameNode.GetTextView().Trim().ToString();
       m_dBParameterGroupNameHasBeenSet = true;
     }
     XmlNode dBParameterGroupFamilyNode = resultNode.FirstChild("DBParameterGroupFamily");
     if(!dBParameterGroupFamilyNode.IsNull())
     {
-      m_dBParameterGroupFamily = StringUtils::Trim(dBParameterGroupFamilyNode.GetText().c_str());
+      m_dBParameterGroupFamily = dBParameterGroupFamilyNode.GetTextView().Trim().ToString();
       m_dBParameterGroupFamilyHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode dBParameterGroupArnNode = resultNode.FirstChild("DBParameterGroupArn");
     if(!dBParameterGroupArnNode.IsNull())
     {
-      m_dBParameterGroupArn = StringUtils::Trim(dBParameterGroupArnNode.GetText().c_str());
+      m_dBParameterGroupArn = dBParameterGroupArnNode.GetTextView().Trim().ToString();
       m_dBParameterGroupArnHasBeenSet = true;
     }
   }
@@ -85,22 +85,22 @@ void DBParameterGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_dBParameterGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBParameterGroupName=" << StringUtils::URLEncode(m_dBParameterGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBParameterGroupName=" << StringUtils::URLEncoded(m_dBParameterGroupName) << "&";
   }
 
   if(m_dBParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBParameterGroupFamily=" << StringUtils::URLEncode(m_dBParameterGroupFamily.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBParameterGroupFamily=" << StringUtils::URLEncoded(m_dBParameterGroupFamily) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_dBParameterGroupArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBParameterGroupArn=" << StringUtils::URLEncode(m_dBParameterGroupArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBParameterGroupArn=" << StringUtils::URLEncoded(m_dBParameterGroupArn) << "&";
   }
 
 }
@@ -109,19 +109,19 @@ void DBParameterGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_dBParameterGroupNameHasBeenSet)
   {
-      oStream << location << ".DBParameterGroupName=" << StringUtils::URLEncode(m_dBParameterGroupName.c_str()) << "&";
+      oStream << location << ".DBParameterGroupName=" << StringUtils::URLEncoded(m_dBParameterGroupName) << "&";
   }
   if(m_dBParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << ".DBParameterGroupFamily=" << StringUtils::URLEncode(m_dBParameterGroupFamily.c_str()) << "&";
+      oStream << location << ".DBParameterGroupFamily=" << StringUtils::URLEncoded(m_dBParameterGroupFamily) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_dBParameterGroupArnHasBeenSet)
   {
-      oStream << location << ".DBParameterGroupArn=" << StringUtils::URLEncode(m_dBParameterGroupArn.c_str()) << "&";
+      oStream << location << ".DBParameterGroupArn=" << StringUtils::URLEncoded(m_dBParameterGroupArn) << "&";
   }
 }
 
@@ -51,13 +51,13 @@ DBParameterGroupStatus& DBParameterGroupStatus::operator =(const XmlNode& xmlNod
     XmlNode dBParameterGroupNameNode = resultNode.FirstChild("DBParameterGroupName");
     if(!dBParameterGroupNameNode.IsNull())
     {
-      m_dBParameterGroupName = StringUtils::Trim(dBParameterGroupNameNode.GetText().c_str());
+      m_dBParameterGroupName = dBParameterGroupNameNode.GetTextView().Trim().ToString();
       m_dBParameterGroupNameHasBeenSet = true;
     }
     XmlNode parameterApplyStatusNode = resultNode.FirstChild("ParameterApplyStatus");
     if(!parameterApplyStatusNode.IsNull())
     {
-      m_parameterApplyStatus = StringUtils::Trim(parameterApplyStatusNode.GetText().c_str());
+      m_parameterApplyStatus = parameterApplyStatusNode.GetTextView().Trim().ToString();
       m_parameterApplyStatusHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void DBParameterGroupStatus::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_dBParameterGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBParameterGroupName=" << StringUtils::URLEncode(m_dBParameterGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBParameterGroupName=" << StringUtils::URLEncoded(m_dBParameterGroupName) << "&";
   }
 
   if(m_parameterApplyStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterApplyStatus=" << StringUtils::URLEncode(m_parameterApplyStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterApplyStatus=" << StringUtils::URLEncoded(m_parameterApplyStatus) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void DBParameterGroupStatus::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_dBParameterGroupNameHasBeenSet)
   {
-      oStream << location << ".DBParameterGroupName=" << StringUtils::URLEncode(m_dBParameterGroupName.c_str()) << "&";
+      oStream << location << ".DBParameterGroupName=" << StringUtils::URLEncoded(m_dBParameterGroupName) << "&";
   }
   if(m_parameterApplyStatusHasBeenSet)
   {
-      oStream << location << ".ParameterApplyStatus=" << StringUtils::URLEncode(m_parameterApplyStatus.c_str()) << "&";
+      oStream << location << ".ParameterApplyStatus=" << StringUtils::URLEncoded(m_parameterApplyStatus) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,25 +62,25 @@ DBSecurityGroup& DBSecurityGroup::operator =(const XmlNode& xmlNode)
     XmlNode ownerIdNode = resultNode.FirstChild("OwnerId");
     if(!ownerIdNode.IsNull())
     {
-      m_ownerId = StringUtils::Trim(ownerIdNode.GetText().c_str());
+      m_ownerId = ownerIdNode.GetTextView().Trim().ToString();
       m_ownerIdHasBeenSet = true;
     }
     XmlNode dBSecurityGroupNameNode = resultNode.FirstChild("DBSecurityGroupName");
     if(!dBSecurityGroupNameNode.IsNull())
     {
-      m_dBSecurityGroupName = StringUtils::Trim(dBSecurityGroupNameNode.GetText().c_str());
+      m_dBSecurityGroupName = dBSecurityGroupNameNode.GetTextView().Trim().ToString();
       m_dBSecurityGroupNameHasBeenSet = true;
     }
     XmlNode dBSecurityGroupDescriptionNode = resultNode.FirstChild("DBSecurityGroupDescription");
     if(!dBSecurityGroupDescriptionNode.IsNull())
     {
-      m_dBSecurityGroupDescription = StringUtils::Trim(dBSecurityGroupDescriptionNode.GetText().c_str());
+      m_dBSecurityGroupDescription = dBSecurityGroupDescriptionNode.GetTextView().Trim().ToString();
       m_dBSecurityGroupDescriptionHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("VpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode eC2SecurityGroupsNode = resultNode.FirstChild("EC2SecurityGroups");
@@ -109,7 +110,7 @@ DBSecurityGroup& DBSecurityGroup::operator =(const XmlNode& xmlNode)
     XmlNode dBSecurityGroupArnNode = resultNode.FirstChild("DBSecurityGroupArn");
     if(!dBSecurityGroupArnNode.IsNull())
     {
-      m_dBSecurityGroupArn = StringUtils::Trim(dBSecurityGroupArnNode.GetText().c_str());
+      m_dBSecurityGroupArn = dBSecurityGroupArnNode.GetTextView().Trim().ToString();
       m_dBSecurityGroupArnHasBeenSet = true;
     }
   }
@@ -121,22 +122,22 @@ void DBSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_ownerIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OwnerId=" << StringUtils::URLEncode(m_ownerId.c_str()) << "&";
+      oStream << location << index << locationValue << ".OwnerId=" << StringUtils::URLEncoded(m_ownerId) << "&";
   }
 
   if(m_dBSecurityGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBSecurityGroupName=" << StringUtils::URLEncode(m_dBSecurityGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBSecurityGroupName=" << StringUtils::URLEncoded(m_dBSecurityGroupName) << "&";
   }
 
   if(m_dBSecurityGroupDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBSecurityGroupDescription=" << StringUtils::URLEncode(m_dBSecurityGroupDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBSecurityGroupDescription=" << StringUtils::URLEncoded(m_dBSecurityGroupDescription) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_eC2SecurityGroupsHasBeenSet)
@@ -144,9 +145,9 @@ void DBSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* location
       unsigned eC2SecurityGroupsIdx = 1;
       for(auto& item : m_eC2SecurityGroups)
       {
-        Aws::StringStream eC2SecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream eC2SecurityGroupsSs;
         eC2SecurityGroupsSs << location << index << locationValue << ".EC2SecurityGroup." << eC2SecurityGroupsIdx++;
-        item.OutputToStream(oStream, eC2SecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, eC2SecurityGroupsSs.GetString().c_str());
       }
   }
 
@@ -155,15 +156,15 @@ void DBSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* location
       unsigned iPRangesIdx = 1;
       for(auto& item : m_iPRanges)
       {
-        Aws::StringStream iPRangesSs;
+        Aws::Utils::Stream::StringOutputStream iPRangesSs;
         iPRangesSs << location << index << locationValue << ".IPRange." << iPRangesIdx++;
-        item.OutputToStream(oStream, iPRangesSs.str().c_str());
+        item.OutputToStream(oStream, iPRangesSs.GetString().c_str());
       }
   }
 
   if(m_dBSecurityGroupArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBSecurityGroupArn=" << StringUtils::URLEncode(m_dBSecurityGroupArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBSecurityGroupArn=" << StringUtils::URLEncoded(m_dBSecurityGroupArn) << "&";
   }
 
 }
@@ -172,28 +173,28 @@ void DBSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_ownerIdHasBeenSet)
   {
-      oStream << location << ".OwnerId=" << StringUtils::URLEncode(m_ownerId.c_str()) << "&";
+      oStream << location << ".OwnerId=" << StringUtils::URLEncoded(m_ownerId) << "&";
   }
   if(m_dBSecurityGroupNameHasBeenSet)
   {
-      oStream << location << ".DBSecurityGroupName=" << StringUtils::URLEncode(m_dBSecurityGroupName.c_str()) << "&";
+      oStream << location << ".DBSecurityGroupName=" << StringUtils::URLEncoded(m_dBSecurityGroupName) << "&";
   }
   if(m_dBSecurityGroupDescriptionHasBeenSet)
   {
-      oStream << location << ".DBSecurityGroupDescription=" << StringUtils::URLEncode(m_dBSecurityGroupDescription.c_str()) << "&";
+      oStream << location << ".DBSecurityGroupDescription=" << StringUtils::URLEncoded(m_dBSecurityGroupDescription) << "&";
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_eC2SecurityGroupsHasBeenSet)
   {
       unsigned eC2SecurityGroupsIdx = 1;
       for(auto& item : m_eC2SecurityGroups)
       {
-        Aws::StringStream eC2SecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream eC2SecurityGroupsSs;
         eC2SecurityGroupsSs << location <<  ".EC2SecurityGroup." << eC2SecurityGroupsIdx++;
-        item.OutputToStream(oStream, eC2SecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, eC2SecurityGroupsSs.GetString().c_str());
       }
   }
   if(m_iPRangesHasBeenSet)
@@ -201,14 +202,14 @@ void DBSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* location
       unsigned iPRangesIdx = 1;
       for(auto& item : m_iPRanges)
       {
-        Aws::StringStream iPRangesSs;
+        Aws::Utils::Stream::StringOutputStream iPRangesSs;
         iPRangesSs << location <<  ".IPRange." << iPRangesIdx++;
-        item.OutputToStream(oStream, iPRangesSs.str().c_str());
+        item.OutputToStream(oStream, iPRangesSs.GetString().c_str());
       }
   }
   if(m_dBSecurityGroupArnHasBeenSet)
   {
-      oStream << location << ".DBSecurityGroupArn=" << StringUtils::URLEncode(m_dBSecurityGroupArn.c_str()) << "&";
+      oStream << location << ".DBSecurityGroupArn=" << StringUtils::URLEncoded(m_dBSecurityGroupArn) << "&";
   }
 }
 
@@ -51,13 +51,13 @@ DBSecurityGroupMembership& DBSecurityGroupMembership::operator =(const XmlNode&
     XmlNode dBSecurityGroupNameNode = resultNode.FirstChild("DBSecurityGroupName");
     if(!dBSecurityGroupNameNode.IsNull())
     {
-      m_dBSecurityGroupName = StringUtils::Trim(dBSecurityGroupNameNode.GetText().c_str());
+      m_dBSecurityGroupName = dBSecurityGroupNameNode.GetTextView().Trim().ToString();
       m_dBSecurityGroupNameHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void DBSecurityGroupMembership::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_dBSecurityGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBSecurityGroupName=" << StringUtils::URLEncode(m_dBSecurityGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBSecurityGroupName=" << StringUtils::URLEncoded(m_dBSecurityGroupName) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void DBSecurityGroupMembership::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_dBSecurityGroupNameHasBeenSet)
   {
-      oStream << location << ".DBSecurityGroupName=" << StringUtils::URLEncode(m_dBSecurityGroupName.c_str()) << "&";
+      oStream << location << ".DBSecurityGroupName=" << StringUtils::URLEncoded(m_dBSecurityGroupName) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 }
 
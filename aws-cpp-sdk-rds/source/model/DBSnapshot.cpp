@@ -105,145 +105,145 @@ DBSnapshot& DBSnapshot::operator =(const XmlNode& xmlNode)
     XmlNode dBSnapshotIdentifierNode = resultNode.FirstChild("DBSnapshotIdentifier");
     if(!dBSnapshotIdentifierNode.IsNull())
     {
-      m_dBSnapshotIdentifier = StringUtils::Trim(dBSnapshotIdentifierNode.GetText().c_str());
+      m_dBSnapshotIdentifier = dBSnapshotIdentifierNode.GetTextView().Trim().ToString();
       m_dBSnapshotIdentifierHasBeenSet = true;
     }
     XmlNode dBInstanceIdentifierNode = resultNode.FirstChild("DBInstanceIdentifier");
     if(!dBInstanceIdentifierNode.IsNull())
     {
-      m_dBInstanceIdentifier = StringUtils::Trim(dBInstanceIdentifierNode.GetText().c_str());
+      m_dBInstanceIdentifier = dBInstanceIdentifierNode.GetTextView().Trim().ToString();
       m_dBInstanceIdentifierHasBeenSet = true;
     }
     XmlNode snapshotCreateTimeNode = resultNode.FirstChild("SnapshotCreateTime");
     if(!snapshotCreateTimeNode.IsNull())
     {
-      m_snapshotCreateTime = DateTime(StringUtils::Trim(snapshotCreateTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_snapshotCreateTime = DateTime(snapshotCreateTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_snapshotCreateTimeHasBeenSet = true;
     }
     XmlNode engineNode = resultNode.FirstChild("Engine");
     if(!engineNode.IsNull())
     {
-      m_engine = StringUtils::Trim(engineNode.GetText().c_str());
+      m_engine = engineNode.GetTextView().Trim().ToString();
       m_engineHasBeenSet = true;
     }
     XmlNode allocatedStorageNode = resultNode.FirstChild("AllocatedStorage");
     if(!allocatedStorageNode.IsNull())
     {
-      m_allocatedStorage = StringUtils::ConvertToInt32(StringUtils::Trim(allocatedStorageNode.GetText().c_str()).c_str());
+      m_allocatedStorage = StringUtils::ConvertToInt32(allocatedStorageNode.GetTextView().Trim().ToString().c_str());
       m_allocatedStorageHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode portNode = resultNode.FirstChild("Port");
     if(!portNode.IsNull())
     {
-      m_port = StringUtils::ConvertToInt32(StringUtils::Trim(portNode.GetText().c_str()).c_str());
+      m_port = StringUtils::ConvertToInt32(portNode.GetTextView().Trim().ToString().c_str());
       m_portHasBeenSet = true;
     }
     XmlNode availabilityZoneNode = resultNode.FirstChild("AvailabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("VpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode instanceCreateTimeNode = resultNode.FirstChild("InstanceCreateTime");
     if(!instanceCreateTimeNode.IsNull())
     {
-      m_instanceCreateTime = DateTime(StringUtils::Trim(instanceCreateTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_instanceCreateTime = DateTime(instanceCreateTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_instanceCreateTimeHasBeenSet = true;
     }
     XmlNode masterUsernameNode = resultNode.FirstChild("MasterUsername");
     if(!masterUsernameNode.IsNull())
     {
-      m_masterUsername = StringUtils::Trim(masterUsernameNode.GetText().c_str());
+      m_masterUsername = masterUsernameNode.GetTextView().Trim().ToString();
       m_masterUsernameHasBeenSet = true;
     }
     XmlNode engineVersionNode = resultNode.FirstChild("EngineVersion");
     if(!engineVersionNode.IsNull())
     {
-      m_engineVersion = StringUtils::Trim(engineVersionNode.GetText().c_str());
+      m_engineVersion = engineVersionNode.GetTextView().Trim().ToString();
       m_engineVersionHasBeenSet = true;
     }
     XmlNode licenseModelNode = resultNode.FirstChild("LicenseModel");
     if(!licenseModelNode.IsNull())
     {
-      m_licenseModel = StringUtils::Trim(licenseModelNode.GetText().c_str());
+      m_licenseModel = licenseModelNode.GetTextView().Trim().ToString();
       m_licenseModelHasBeenSet = true;
     }
     XmlNode snapshotTypeNode = resultNode.FirstChild("SnapshotType");
     if(!snapshotTypeNode.IsNull())
     {
-      m_snapshotType = StringUtils::Trim(snapshotTypeNode.GetText().c_str());
+      m_snapshotType = snapshotTypeNode.GetTextView().Trim().ToString();
       m_snapshotTypeHasBeenSet = true;
     }
     XmlNode iopsNode = resultNode.FirstChild("Iops");
     if(!iopsNode.IsNull())
     {
-      m_iops = StringUtils::ConvertToInt32(StringUtils::Trim(iopsNode.GetText().c_str()).c_str());
+      m_iops = StringUtils::ConvertToInt32(iopsNode.GetTextView().Trim().ToString().c_str());
       m_iopsHasBeenSet = true;
     }
     XmlNode optionGroupNameNode = resultNode.FirstChild("OptionGroupName");
     if(!optionGroupNameNode.IsNull())
     {
-      m_optionGroupName = StringUtils::Trim(optionGroupNameNode.GetText().c_str());
+      m_optionGroupName = optionGroupNameNode.GetTextView().Trim().ToString();
       m_optionGroupNameHasBeenSet = true;
     }
     XmlNode percentProgressNode = resultNode.FirstChild("PercentProgress");
     if(!percentProgressNode.IsNull())
     {
-      m_percentProgress = StringUtils::ConvertToInt32(StringUtils::Trim(percentProgressNode.GetText().c_str()).c_str());
+      m_percentProgress = StringUtils::ConvertToInt32(percentProgressNode.GetTextView().Trim().ToString().c_str());
       m_percentProgressHasBeenSet = true;
     }
     XmlNode sourceRegionNode = resultNode.FirstChild("SourceRegion");
     if(!sourceRegionNode.IsNull())
     {
-      m_sourceRegion = StringUtils::Trim(sourceRegionNode.GetText().c_str());
+      m_sourceRegion = sourceRegionNode.GetTextView().Trim().ToString();
       m_sourceRegionHasBeenSet = true;
     }
     XmlNode sourceDBSnapshotIdentifierNode = resultNode.FirstChild("SourceDBSnapshotIdentifier");
     if(!sourceDBSnapshotIdentifierNode.IsNull())
     {
-      m_sourceDBSnapshotIdentifier = StringUtils::Trim(sourceDBSnapshotIdentifierNode.GetText().c_str());
+      m_sourceDBSnapshotIdentifier = sourceDBSnapshotIdentifierNode.GetTextView().Trim().ToString();
       m_sourceDBSnapshotIdentifierHasBeenSet = true;
     }
     XmlNode storageTypeNode = resultNode.FirstChild("StorageType");
     if(!storageTypeNode.IsNull())
     {
-      m_storageType = StringUtils::Trim(storageTypeNode.GetText().c_str());
+      m_storageType = storageTypeNode.GetTextView().Trim().ToString();
       m_storageTypeHasBeenSet = true;
     }
     XmlNode tdeCredentialArnNode = resultNode.FirstChild("TdeCredentialArn");
     if(!tdeCredentialArnNode.IsNull())
     {
-      m_tdeCredentialArn = StringUtils::Trim(tdeCredentialArnNode.GetText().c_str());
+      m_tdeCredentialArn = tdeCredentialArnNode.GetTextView().Trim().ToString();
       m_tdeCredentialArnHasBeenSet = true;
     }
     XmlNode encryptedNode = resultNode.FirstChild("Encrypted");
     if(!encryptedNode.IsNull())
     {
-      m_encrypted = StringUtils::ConvertToBool(StringUtils::Trim(encryptedNode.GetText().c_str()).c_str());
+      m_encrypted = StringUtils::ConvertToBool(encryptedNode.GetTextView().Trim().ToString().c_str());
       m_encryptedHasBeenSet = true;
     }
     XmlNode kmsKeyIdNode = resultNode.FirstChild("KmsKeyId");
     if(!kmsKeyIdNode.IsNull())
     {
-      m_kmsKeyId = StringUtils::Trim(kmsKeyIdNode.GetText().c_str());
+      m_kmsKeyId = kmsKeyIdNode.GetTextView().Trim().ToString();
       m_kmsKeyIdHasBeenSet = true;
     }
     XmlNode dBSnapshotArnNode = resultNode.FirstChild("DBSnapshotArn");
     if(!dBSnapshotArnNode.IsNull())
     {
-      m_dBSnapshotArn = StringUtils::Trim(dBSnapshotArnNode.GetText().c_str());
+      m_dBSnapshotArn = dBSnapshotArnNode.GetTextView().Trim().ToString();
       m_dBSnapshotArnHasBeenSet = true;
     }
   }
@@ -255,22 +255,22 @@ void DBSnapshot::OutputToStream(Aws::OStream& oStream, const char* location, uns
 {
   if(m_dBSnapshotIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBSnapshotIdentifier=" << StringUtils::URLEncode(m_dBSnapshotIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBSnapshotIdentifier=" << StringUtils::URLEncoded(m_dBSnapshotIdentifier) << "&";
   }
 
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
 
   if(m_snapshotCreateTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotCreateTime=" << StringUtils::URLEncode(m_snapshotCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotCreateTime=" << StringUtils::URLEncoded(m_snapshotCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_engineHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
 
   if(m_allocatedStorageHasBeenSet)
@@ -280,7 +280,7 @@ void DBSnapshot::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -290,37 +290,37 @@ void DBSnapshot::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_instanceCreateTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".InstanceCreateTime=" << StringUtils::URLEncode(m_instanceCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".InstanceCreateTime=" << StringUtils::URLEncoded(m_instanceCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_masterUsernameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MasterUsername=" << StringUtils::URLEncode(m_masterUsername.c_str()) << "&";
+      oStream << location << index << locationValue << ".MasterUsername=" << StringUtils::URLEncoded(m_masterUsername) << "&";
   }
 
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_licenseModelHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LicenseModel=" << StringUtils::URLEncode(m_licenseModel.c_str()) << "&";
+      oStream << location << index << locationValue << ".LicenseModel=" << StringUtils::URLEncoded(m_licenseModel) << "&";
   }
 
   if(m_snapshotTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotType=" << StringUtils::URLEncode(m_snapshotType.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotType=" << StringUtils::URLEncoded(m_snapshotType) << "&";
   }
 
   if(m_iopsHasBeenSet)
@@ -330,7 +330,7 @@ void DBSnapshot::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_optionGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OptionGroupName=" << StringUtils::URLEncode(m_optionGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".OptionGroupName=" << StringUtils::URLEncoded(m_optionGroupName) << "&";
   }
 
   if(m_percentProgressHasBeenSet)
@@ -340,22 +340,22 @@ void DBSnapshot::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_sourceRegionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceRegion=" << StringUtils::URLEncode(m_sourceRegion.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceRegion=" << StringUtils::URLEncoded(m_sourceRegion) << "&";
   }
 
   if(m_sourceDBSnapshotIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceDBSnapshotIdentifier=" << StringUtils::URLEncode(m_sourceDBSnapshotIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceDBSnapshotIdentifier=" << StringUtils::URLEncoded(m_sourceDBSnapshotIdentifier) << "&";
   }
 
   if(m_storageTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StorageType=" << StringUtils::URLEncode(m_storageType.c_str()) << "&";
+      oStream << location << index << locationValue << ".StorageType=" << StringUtils::URLEncoded(m_storageType) << "&";
   }
 
   if(m_tdeCredentialArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TdeCredentialArn=" << StringUtils::URLEncode(m_tdeCredentialArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".TdeCredentialArn=" << StringUtils::URLEncoded(m_tdeCredentialArn) << "&";
   }
 
   if(m_encryptedHasBeenSet)
@@ -365,12 +365,12 @@ void DBSnapshot::OutputToStream(Aws::OStream& oStream, const char* location, uns
 
   if(m_kmsKeyIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+      oStream << location << index << locationValue << ".KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
 
   if(m_dBSnapshotArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBSnapshotArn=" << StringUtils::URLEncode(m_dBSnapshotArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBSnapshotArn=" << StringUtils::URLEncoded(m_dBSnapshotArn) << "&";
   }
 
 }
@@ -379,19 +379,19 @@ void DBSnapshot::OutputToStream(Aws::OStream& oStream, const char* location) con
 {
   if(m_dBSnapshotIdentifierHasBeenSet)
   {
-      oStream << location << ".DBSnapshotIdentifier=" << StringUtils::URLEncode(m_dBSnapshotIdentifier.c_str()) << "&";
+      oStream << location << ".DBSnapshotIdentifier=" << StringUtils::URLEncoded(m_dBSnapshotIdentifier) << "&";
   }
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-      oStream << location << ".DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+      oStream << location << ".DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
   if(m_snapshotCreateTimeHasBeenSet)
   {
-      oStream << location << ".SnapshotCreateTime=" << StringUtils::URLEncode(m_snapshotCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".SnapshotCreateTime=" << StringUtils::URLEncoded(m_snapshotCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_engineHasBeenSet)
   {
-      oStream << location << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
   if(m_allocatedStorageHasBeenSet)
   {
@@ -399,7 +399,7 @@ void DBSnapshot::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_portHasBeenSet)
   {
@@ -407,31 +407,31 @@ void DBSnapshot::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_instanceCreateTimeHasBeenSet)
   {
-      oStream << location << ".InstanceCreateTime=" << StringUtils::URLEncode(m_instanceCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".InstanceCreateTime=" << StringUtils::URLEncoded(m_instanceCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_masterUsernameHasBeenSet)
   {
-      oStream << location << ".MasterUsername=" << StringUtils::URLEncode(m_masterUsername.c_str()) << "&";
+      oStream << location << ".MasterUsername=" << StringUtils::URLEncoded(m_masterUsername) << "&";
   }
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
   if(m_licenseModelHasBeenSet)
   {
-      oStream << location << ".LicenseModel=" << StringUtils::URLEncode(m_licenseModel.c_str()) << "&";
+      oStream << location << ".LicenseModel=" << StringUtils::URLEncoded(m_licenseModel) << "&";
   }
   if(m_snapshotTypeHasBeenSet)
   {
-      oStream << location << ".SnapshotType=" << StringUtils::URLEncode(m_snapshotType.c_str()) << "&";
+      oStream << location << ".SnapshotType=" << StringUtils::URLEncoded(m_snapshotType) << "&";
   }
   if(m_iopsHasBeenSet)
   {
@@ -439,7 +439,7 @@ void DBSnapshot::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_optionGroupNameHasBeenSet)
   {
-      oStream << location << ".OptionGroupName=" << StringUtils::URLEncode(m_optionGroupName.c_str()) << "&";
+      oStream << location << ".OptionGroupName=" << StringUtils::URLEncoded(m_optionGroupName) << "&";
   }
   if(m_percentProgressHasBeenSet)
   {
@@ -447,19 +447,19 @@ void DBSnapshot::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_sourceRegionHasBeenSet)
   {
-      oStream << location << ".SourceRegion=" << StringUtils::URLEncode(m_sourceRegion.c_str()) << "&";
+      oStream << location << ".SourceRegion=" << StringUtils::URLEncoded(m_sourceRegion) << "&";
   }
   if(m_sourceDBSnapshotIdentifierHasBeenSet)
   {
-      oStream << location << ".SourceDBSnapshotIdentifier=" << StringUtils::URLEncode(m_sourceDBSnapshotIdentifier.c_str()) << "&";
+      oStream << location << ".SourceDBSnapshotIdentifier=" << StringUtils::URLEncoded(m_sourceDBSnapshotIdentifier) << "&";
   }
   if(m_storageTypeHasBeenSet)
   {
-      oStream << location << ".StorageType=" << StringUtils::URLEncode(m_storageType.c_str()) << "&";
+      oStream << location << ".StorageType=" << StringUtils::URLEncoded(m_storageType) << "&";
   }
   if(m_tdeCredentialArnHasBeenSet)
   {
-      oStream << location << ".TdeCredentialArn=" << StringUtils::URLEncode(m_tdeCredentialArn.c_str()) << "&";
+      oStream << location << ".TdeCredentialArn=" << StringUtils::URLEncoded(m_tdeCredentialArn) << "&";
   }
   if(m_encryptedHasBeenSet)
   {
@@ -467,11 +467,11 @@ void DBSnapshot::OutputToStream(Aws::OStream& oStream, const char* location) con
   }
   if(m_kmsKeyIdHasBeenSet)
   {
-      oStream << location << ".KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+      oStream << location << ".KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
   if(m_dBSnapshotArnHasBeenSet)
   {
-      oStream << location << ".DBSnapshotArn=" << StringUtils::URLEncode(m_dBSnapshotArn.c_str()) << "&";
+      oStream << location << ".DBSnapshotArn=" << StringUtils::URLEncoded(m_dBSnapshotArn) << "&";
   }
 }
 
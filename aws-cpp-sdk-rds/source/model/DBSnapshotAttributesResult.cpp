@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ DBSnapshotAttributesResult& DBSnapshotAttributesResult::operator =(const XmlNode
     XmlNode dBSnapshotIdentifierNode = resultNode.FirstChild("DBSnapshotIdentifier");
     if(!dBSnapshotIdentifierNode.IsNull())
     {
-      m_dBSnapshotIdentifier = StringUtils::Trim(dBSnapshotIdentifierNode.GetText().c_str());
+      m_dBSnapshotIdentifier = dBSnapshotIdentifierNode.GetTextView().Trim().ToString();
       m_dBSnapshotIdentifierHasBeenSet = true;
     }
     XmlNode dBSnapshotAttributesNode = resultNode.FirstChild("DBSnapshotAttributes");
@@ -75,7 +76,7 @@ void DBSnapshotAttributesResult::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_dBSnapshotIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBSnapshotIdentifier=" << StringUtils::URLEncode(m_dBSnapshotIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBSnapshotIdentifier=" << StringUtils::URLEncoded(m_dBSnapshotIdentifier) << "&";
   }
 
   if(m_dBSnapshotAttributesHasBeenSet)
@@ -83,9 +84,9 @@ void DBSnapshotAttributesResult::OutputToStream(Aws::OStream& oStream, const cha
       unsigned dBSnapshotAttributesIdx = 1;
       for(auto& item : m_dBSnapshotAttributes)
       {
-        Aws::StringStream dBSnapshotAttributesSs;
+        Aws::Utils::Stream::StringOutputStream dBSnapshotAttributesSs;
         dBSnapshotAttributesSs << location << index << locationValue << ".DBSnapshotAttribute." << dBSnapshotAttributesIdx++;
-        item.OutputToStream(oStream, dBSnapshotAttributesSs.str().c_str());
+        item.OutputToStream(oStream, dBSnapshotAttributesSs.GetString().c_str());
       }
   }
 
@@ -95,16 +96,16 @@ void DBSnapshotAttributesResult::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_dBSnapshotIdentifierHasBeenSet)
   {
-      oStream << location << ".DBSnapshotIdentifier=" << StringUtils::URLEncode(m_dBSnapshotIdentifier.c_str()) << "&";
+      oStream << location << ".DBSnapshotIdentifier=" << StringUtils::URLEncoded(m_dBSnapshotIdentifier) << "&";
   }
   if(m_dBSnapshotAttributesHasBeenSet)
   {
       unsigned dBSnapshotAttributesIdx = 1;
       for(auto& item : m_dBSnapshotAttributes)
       {
-        Aws::StringStream dBSnapshotAttributesSs;
+        Aws::Utils::Stream::StringOutputStream dBSnapshotAttributesSs;
         dBSnapshotAttributesSs << location <<  ".DBSnapshotAttribute." << dBSnapshotAttributesIdx++;
-        item.OutputToStream(oStream, dBSnapshotAttributesSs.str().c_str());
+        item.OutputToStream(oStream, dBSnapshotAttributesSs.GetString().c_str());
       }
   }
 }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,25 +60,25 @@ DBSubnetGroup& DBSubnetGroup::operator =(const XmlNode& xmlNode)
     XmlNode dBSubnetGroupNameNode = resultNode.FirstChild("DBSubnetGroupName");
     if(!dBSubnetGroupNameNode.IsNull())
     {
-      m_dBSubnetGroupName = StringUtils::Trim(dBSubnetGroupNameNode.GetText().c_str());
+      m_dBSubnetGroupName = dBSubnetGroupNameNode.GetTextView().Trim().ToString();
       m_dBSubnetGroupNameHasBeenSet = true;
     }
     XmlNode dBSubnetGroupDescriptionNode = resultNode.FirstChild("DBSubnetGroupDescription");
     if(!dBSubnetGroupDescriptionNode.IsNull())
     {
-      m_dBSubnetGroupDescription = StringUtils::Trim(dBSubnetGroupDescriptionNode.GetText().c_str());
+      m_dBSubnetGroupDescription = dBSubnetGroupDescriptionNode.GetTextView().Trim().ToString();
       m_dBSubnetGroupDescriptionHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("VpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode subnetGroupStatusNode = resultNode.FirstChild("SubnetGroupStatus");
     if(!subnetGroupStatusNode.IsNull())
     {
-      m_subnetGroupStatus = StringUtils::Trim(subnetGroupStatusNode.GetText().c_str());
+      m_subnetGroupStatus = subnetGroupStatusNode.GetTextView().Trim().ToString();
       m_subnetGroupStatusHasBeenSet = true;
     }
     XmlNode subnetsNode = resultNode.FirstChild("Subnets");
@@ -95,7 +96,7 @@ DBSubnetGroup& DBSubnetGroup::operator =(const XmlNode& xmlNode)
     XmlNode dBSubnetGroupArnNode = resultNode.FirstChild("DBSubnetGroupArn");
     if(!dBSubnetGroupArnNode.IsNull())
     {
-      m_dBSubnetGroupArn = StringUtils::Trim(dBSubnetGroupArnNode.GetText().c_str());
+      m_dBSubnetGroupArn = dBSubnetGroupArnNode.GetTextView().Trim().ToString();
       m_dBSubnetGroupArnHasBeenSet = true;
     }
   }
@@ -107,22 +108,22 @@ void DBSubnetGroup::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_dBSubnetGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBSubnetGroupName=" << StringUtils::URLEncode(m_dBSubnetGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBSubnetGroupName=" << StringUtils::URLEncoded(m_dBSubnetGroupName) << "&";
   }
 
   if(m_dBSubnetGroupDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBSubnetGroupDescription=" << StringUtils::URLEncode(m_dBSubnetGroupDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBSubnetGroupDescription=" << StringUtils::URLEncoded(m_dBSubnetGroupDescription) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_subnetGroupStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubnetGroupStatus=" << StringUtils::URLEncode(m_subnetGroupStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubnetGroupStatus=" << StringUtils::URLEncoded(m_subnetGroupStatus) << "&";
   }
 
   if(m_subnetsHasBeenSet)
@@ -130,15 +131,15 @@ void DBSubnetGroup::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned subnetsIdx = 1;
       for(auto& item : m_subnets)
       {
-        Aws::StringStream subnetsSs;
+        Aws::Utils::Stream::StringOutputStream subnetsSs;
         subnetsSs << location << index << locationValue << ".Subnet." << subnetsIdx++;
-        item.OutputToStream(oStream, subnetsSs.str().c_str());
+        item.OutputToStream(oStream, subnetsSs.GetString().c_str());
       }
   }
 
   if(m_dBSubnetGroupArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBSubnetGroupArn=" << StringUtils::URLEncode(m_dBSubnetGroupArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBSubnetGroupArn=" << StringUtils::URLEncoded(m_dBSubnetGroupArn) << "&";
   }
 
 }
@@ -147,33 +148,33 @@ void DBSubnetGroup::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_dBSubnetGroupNameHasBeenSet)
   {
-      oStream << location << ".DBSubnetGroupName=" << StringUtils::URLEncode(m_dBSubnetGroupName.c_str()) << "&";
+      oStream << location << ".DBSubnetGroupName=" << StringUtils::URLEncoded(m_dBSubnetGroupName) << "&";
   }
   if(m_dBSubnetGroupDescriptionHasBeenSet)
   {
-      oStream << location << ".DBSubnetGroupDescription=" << StringUtils::URLEncode(m_dBSubnetGroupDescription.c_str()) << "&";
+      oStream << location << ".DBSubnetGroupDescription=" << StringUtils::URLEncoded(m_dBSubnetGroupDescription) << "&";
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_subnetGroupStatusHasBeenSet)
   {
-      oStream << location << ".SubnetGroupStatus=" << StringUtils::URLEncode(m_subnetGroupStatus.c_str()) << "&";
+      oStream << location << ".SubnetGroupStatus=" << StringUtils::URLEncoded(m_subnetGroupStatus) << "&";
   }
   if(m_subnetsHasBeenSet)
   {
       unsigned subnetsIdx = 1;
       for(auto& item : m_subnets)
       {
-        Aws::StringStream subnetsSs;
+        Aws::Utils::Stream::StringOutputStream subnetsSs;
         subnetsSs << location <<  ".Subnet." << subnetsIdx++;
-        item.OutputToStream(oStream, subnetsSs.str().c_str());
+        item.OutputToStream(oStream, subnetsSs.GetString().c_str());
       }
   }
   if(m_dBSubnetGroupArnHasBeenSet)
   {
-      oStream << location << ".DBSubnetGroupArn=" << StringUtils::URLEncode(m_dBSubnetGroupArn.c_str()) << "&";
+      oStream << location << ".DBSubnetGroupArn=" << StringUtils::URLEncoded(m_dBSubnetGroupArn) << "&";
   }
 }
 
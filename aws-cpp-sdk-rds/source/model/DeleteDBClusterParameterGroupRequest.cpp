@@ -15,6 +15,7 @@
 #include <aws/rds/model/DeleteDBClusterParameterGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteDBClusterParameterGroupRequest::DeleteDBClusterParameterGroupRequest() :
 
 Aws::String DeleteDBClusterParameterGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteDBClusterParameterGroup&";
   if(m_dBClusterParameterGroupNameHasBeenSet)
   {
-    ss << "DBClusterParameterGroupName=" << StringUtils::URLEncode(m_dBClusterParameterGroupName.c_str()) << "&";
+    ss << "DBClusterParameterGroupName=" << StringUtils::URLEncoded(m_dBClusterParameterGroupName) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
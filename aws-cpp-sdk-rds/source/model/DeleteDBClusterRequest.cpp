@@ -15,6 +15,7 @@
 #include <aws/rds/model/DeleteDBClusterRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -29,11 +30,11 @@ DeleteDBClusterRequest::DeleteDBClusterRequest() :
 
 Aws::String DeleteDBClusterRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteDBCluster&";
   if(m_dBClusterIdentifierHasBeenSet)
   {
-    ss << "DBClusterIdentifier=" << StringUtils::URLEncode(m_dBClusterIdentifier.c_str()) << "&";
+    ss << "DBClusterIdentifier=" << StringUtils::URLEncoded(m_dBClusterIdentifier) << "&";
   }
 
   if(m_skipFinalSnapshotHasBeenSet)
@@ -43,10 +44,10 @@ Aws::String DeleteDBClusterRequest::SerializePayload() const
 
   if(m_finalDBSnapshotIdentifierHasBeenSet)
   {
-    ss << "FinalDBSnapshotIdentifier=" << StringUtils::URLEncode(m_finalDBSnapshotIdentifier.c_str()) << "&";
+    ss << "FinalDBSnapshotIdentifier=" << StringUtils::URLEncoded(m_finalDBSnapshotIdentifier) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
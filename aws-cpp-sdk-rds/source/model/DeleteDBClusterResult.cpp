@@ -40,7 +40,7 @@ DeleteDBClusterResult& DeleteDBClusterResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteDBClusterResult")
+  if (rootNode.GetNameView() != "DeleteDBClusterResult")
   {
     resultNode = rootNode.FirstChild("DeleteDBClusterResult");
   }
@@ -40,7 +40,7 @@ DeleteDBClusterSnapshotResult& DeleteDBClusterSnapshotResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteDBClusterSnapshotResult")
+  if (rootNode.GetNameView() != "DeleteDBClusterSnapshotResult")
   {
     resultNode = rootNode.FirstChild("DeleteDBClusterSnapshotResult");
   }
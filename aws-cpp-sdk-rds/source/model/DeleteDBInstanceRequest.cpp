@@ -15,6 +15,7 @@
 #include <aws/rds/model/DeleteDBInstanceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -29,11 +30,11 @@ DeleteDBInstanceRequest::DeleteDBInstanceRequest() :
 
 Aws::String DeleteDBInstanceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteDBInstance&";
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-    ss << "DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+    ss << "DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
 
   if(m_skipFinalSnapshotHasBeenSet)
@@ -43,10 +44,10 @@ Aws::String DeleteDBInstanceRequest::SerializePayload() const
 
   if(m_finalDBSnapshotIdentifierHasBeenSet)
   {
-    ss << "FinalDBSnapshotIdentifier=" << StringUtils::URLEncode(m_finalDBSnapshotIdentifier.c_str()) << "&";
+    ss << "FinalDBSnapshotIdentifier=" << StringUtils::URLEncoded(m_finalDBSnapshotIdentifier) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DeleteDBInstanceResult& DeleteDBInstanceResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteDBInstanceResult")
+  if (rootNode.GetNameView() != "DeleteDBInstanceResult")
   {
     resultNode = rootNode.FirstChild("DeleteDBInstanceResult");
   }
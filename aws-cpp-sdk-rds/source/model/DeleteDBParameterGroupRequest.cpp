@@ -15,6 +15,7 @@
 #include <aws/rds/model/DeleteDBParameterGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteDBParameterGroupRequest::DeleteDBParameterGroupRequest() :
 
 Aws::String DeleteDBParameterGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteDBParameterGroup&";
   if(m_dBParameterGroupNameHasBeenSet)
   {
-    ss << "DBParameterGroupName=" << StringUtils::URLEncode(m_dBParameterGroupName.c_str()) << "&";
+    ss << "DBParameterGroupName=" << StringUtils::URLEncoded(m_dBParameterGroupName) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
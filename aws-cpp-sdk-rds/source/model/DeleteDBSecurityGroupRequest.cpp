@@ -15,6 +15,7 @@
 #include <aws/rds/model/DeleteDBSecurityGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteDBSecurityGroupRequest::DeleteDBSecurityGroupRequest() :
 
 Aws::String DeleteDBSecurityGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteDBSecurityGroup&";
   if(m_dBSecurityGroupNameHasBeenSet)
   {
-    ss << "DBSecurityGroupName=" << StringUtils::URLEncode(m_dBSecurityGroupName.c_str()) << "&";
+    ss << "DBSecurityGroupName=" << StringUtils::URLEncoded(m_dBSecurityGroupName) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
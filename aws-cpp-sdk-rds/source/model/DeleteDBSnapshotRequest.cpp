@@ -15,6 +15,7 @@
 #include <aws/rds/model/DeleteDBSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteDBSnapshotRequest::DeleteDBSnapshotRequest() :
 
 Aws::String DeleteDBSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteDBSnapshot&";
   if(m_dBSnapshotIdentifierHasBeenSet)
   {
-    ss << "DBSnapshotIdentifier=" << StringUtils::URLEncode(m_dBSnapshotIdentifier.c_str()) << "&";
+    ss << "DBSnapshotIdentifier=" << StringUtils::URLEncoded(m_dBSnapshotIdentifier) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DeleteDBSnapshotResult& DeleteDBSnapshotResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteDBSnapshotResult")
+  if (rootNode.GetNameView() != "DeleteDBSnapshotResult")
   {
     resultNode = rootNode.FirstChild("DeleteDBSnapshotResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/rds/model/DeleteEventSubscriptionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteEventSubscriptionRequest::DeleteEventSubscriptionRequest() :
 
 Aws::String DeleteEventSubscriptionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteEventSubscription&";
   if(m_subscriptionNameHasBeenSet)
   {
-    ss << "SubscriptionName=" << StringUtils::URLEncode(m_subscriptionName.c_str()) << "&";
+    ss << "SubscriptionName=" << StringUtils::URLEncoded(m_subscriptionName) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DeleteEventSubscriptionResult& DeleteEventSubscriptionResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteEventSubscriptionResult")
+  if (rootNode.GetNameView() != "DeleteEventSubscriptionResult")
   {
     resultNode = rootNode.FirstChild("DeleteEventSubscriptionResult");
   }
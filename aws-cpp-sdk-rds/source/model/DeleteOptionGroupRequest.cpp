@@ -15,6 +15,7 @@
 #include <aws/rds/model/DeleteOptionGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteOptionGroupRequest::DeleteOptionGroupRequest() :
 
 Aws::String DeleteOptionGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteOptionGroup&";
   if(m_optionGroupNameHasBeenSet)
   {
-    ss << "OptionGroupName=" << StringUtils::URLEncode(m_optionGroupName.c_str()) << "&";
+    ss << "OptionGroupName=" << StringUtils::URLEncoded(m_optionGroupName) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
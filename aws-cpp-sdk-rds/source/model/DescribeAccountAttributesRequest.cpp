@@ -15,6 +15,7 @@
 #include <aws/rds/model/DescribeAccountAttributesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -25,9 +26,9 @@ DescribeAccountAttributesRequest::DescribeAccountAttributesRequest()
 
 Aws::String DescribeAccountAttributesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeAccountAttributes&";
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeAccountAttributesResult& DescribeAccountAttributesResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeAccountAttributesResult")
+  if (rootNode.GetNameView() != "DescribeAccountAttributesResult")
   {
     resultNode = rootNode.FirstChild("DescribeAccountAttributesResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/rds/model/DescribeCertificatesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -30,11 +31,11 @@ DescribeCertificatesRequest::DescribeCertificatesRequest() :
 
 Aws::String DescribeCertificatesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeCertificates&";
   if(m_certificateIdentifierHasBeenSet)
   {
-    ss << "CertificateIdentifier=" << StringUtils::URLEncode(m_certificateIdentifier.c_str()) << "&";
+    ss << "CertificateIdentifier=" << StringUtils::URLEncoded(m_certificateIdentifier) << "&";
   }
 
   if(m_filtersHasBeenSet)
@@ -54,10 +55,10 @@ Aws::String DescribeCertificatesRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
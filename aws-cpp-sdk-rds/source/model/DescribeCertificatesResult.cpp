@@ -40,7 +40,7 @@ DescribeCertificatesResult& DescribeCertificatesResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeCertificatesResult")
+  if (rootNode.GetNameView() != "DescribeCertificatesResult")
   {
     resultNode = rootNode.FirstChild("DescribeCertificatesResult");
   }
@@ -61,7 +61,7 @@ DescribeCertificatesResult& DescribeCertificatesResult::operator =(const AmazonW
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/rds/model/DescribeDBClusterParameterGroupsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -30,11 +31,11 @@ DescribeDBClusterParameterGroupsRequest::DescribeDBClusterParameterGroupsRequest
 
 Aws::String DescribeDBClusterParameterGroupsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeDBClusterParameterGroups&";
   if(m_dBClusterParameterGroupNameHasBeenSet)
   {
-    ss << "DBClusterParameterGroupName=" << StringUtils::URLEncode(m_dBClusterParameterGroupName.c_str()) << "&";
+    ss << "DBClusterParameterGroupName=" << StringUtils::URLEncoded(m_dBClusterParameterGroupName) << "&";
   }
 
   if(m_filtersHasBeenSet)
@@ -54,10 +55,10 @@ Aws::String DescribeDBClusterParameterGroupsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
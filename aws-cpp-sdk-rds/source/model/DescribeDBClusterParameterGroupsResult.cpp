@@ -40,7 +40,7 @@ DescribeDBClusterParameterGroupsResult& DescribeDBClusterParameterGroupsResult::
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDBClusterParameterGroupsResult")
+  if (rootNode.GetNameView() != "DescribeDBClusterParameterGroupsResult")
   {
     resultNode = rootNode.FirstChild("DescribeDBClusterParameterGroupsResult");
   }
@@ -50,7 +50,7 @@ DescribeDBClusterParameterGroupsResult& DescribeDBClusterParameterGroupsResult::
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode dBClusterParameterGroupsNode = resultNode.FirstChild("DBClusterParameterGroups");
     if(!dBClusterParameterGroupsNode.IsNull())
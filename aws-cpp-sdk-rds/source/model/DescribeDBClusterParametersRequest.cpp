@@ -15,6 +15,7 @@
 #include <aws/rds/model/DescribeDBClusterParametersRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -31,16 +32,16 @@ DescribeDBClusterParametersRequest::DescribeDBClusterParametersRequest() :
 
 Aws::String DescribeDBClusterParametersRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeDBClusterParameters&";
   if(m_dBClusterParameterGroupNameHasBeenSet)
   {
-    ss << "DBClusterParameterGroupName=" << StringUtils::URLEncode(m_dBClusterParameterGroupName.c_str()) << "&";
+    ss << "DBClusterParameterGroupName=" << StringUtils::URLEncoded(m_dBClusterParameterGroupName) << "&";
   }
 
   if(m_sourceHasBeenSet)
   {
-    ss << "Source=" << StringUtils::URLEncode(m_source.c_str()) << "&";
+    ss << "Source=" << StringUtils::URLEncoded(m_source) << "&";
   }
 
   if(m_filtersHasBeenSet)
@@ -60,10 +61,10 @@ Aws::String DescribeDBClusterParametersRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
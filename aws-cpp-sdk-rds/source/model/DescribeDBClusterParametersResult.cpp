@@ -40,7 +40,7 @@ DescribeDBClusterParametersResult& DescribeDBClusterParametersResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDBClusterParametersResult")
+  if (rootNode.GetNameView() != "DescribeDBClusterParametersResult")
   {
     resultNode = rootNode.FirstChild("DescribeDBClusterParametersResult");
   }
@@ -61,7 +61,7 @@ DescribeDBClusterParametersResult& DescribeDBClusterParametersResult::operator =
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
   }
 
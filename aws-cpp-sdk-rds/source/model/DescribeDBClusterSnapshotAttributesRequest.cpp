@@ -15,6 +15,7 @@
 #include <aws/rds/model/DescribeDBClusterSnapshotAttributesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DescribeDBClusterSnapshotAttributesRequest::DescribeDBClusterSnapshotAttributesR
 
 Aws::String DescribeDBClusterSnapshotAttributesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeDBClusterSnapshotAttributes&";
   if(m_dBClusterSnapshotIdentifierHasBeenSet)
   {
-    ss << "DBClusterSnapshotIdentifier=" << StringUtils::URLEncode(m_dBClusterSnapshotIdentifier.c_str()) << "&";
+    ss << "DBClusterSnapshotIdentifier=" << StringUtils::URLEncoded(m_dBClusterSnapshotIdentifier) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
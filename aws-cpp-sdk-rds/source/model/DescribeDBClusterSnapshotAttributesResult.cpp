@@ -40,7 +40,7 @@ DescribeDBClusterSnapshotAttributesResult& DescribeDBClusterSnapshotAttributesRe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDBClusterSnapshotAttributesResult")
+  if (rootNode.GetNameView() != "DescribeDBClusterSnapshotAttributesResult")
   {
     resultNode = rootNode.FirstChild("DescribeDBClusterSnapshotAttributesResult");
   }
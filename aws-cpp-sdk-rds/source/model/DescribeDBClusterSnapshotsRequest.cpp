@@ -15,6 +15,7 @@
 #include <aws/rds/model/DescribeDBClusterSnapshotsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -36,21 +37,21 @@ DescribeDBClusterSnapshotsRequest::DescribeDBClusterSnapshotsRequest() :
 
 Aws::String DescribeDBClusterSnapshotsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeDBClusterSnapshots&";
   if(m_dBClusterIdentifierHasBeenSet)
   {
-    ss << "DBClusterIdentifier=" << StringUtils::URLEncode(m_dBClusterIdentifier.c_str()) << "&";
+    ss << "DBClusterIdentifier=" << StringUtils::URLEncoded(m_dBClusterIdentifier) << "&";
   }
 
   if(m_dBClusterSnapshotIdentifierHasBeenSet)
   {
-    ss << "DBClusterSnapshotIdentifier=" << StringUtils::URLEncode(m_dBClusterSnapshotIdentifier.c_str()) << "&";
+    ss << "DBClusterSnapshotIdentifier=" << StringUtils::URLEncoded(m_dBClusterSnapshotIdentifier) << "&";
   }
 
   if(m_snapshotTypeHasBeenSet)
   {
-    ss << "SnapshotType=" << StringUtils::URLEncode(m_snapshotType.c_str()) << "&";
+    ss << "SnapshotType=" << StringUtils::URLEncoded(m_snapshotType) << "&";
   }
 
   if(m_filtersHasBeenSet)
@@ -70,7 +71,7 @@ Aws::String DescribeDBClusterSnapshotsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_includeSharedHasBeenSet)
@@ -84,6 +85,6 @@ Aws::String DescribeDBClusterSnapshotsRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeDBClusterSnapshotsResult& DescribeDBClusterSnapshotsResult::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDBClusterSnapshotsResult")
+  if (rootNode.GetNameView() != "DescribeDBClusterSnapshotsResult")
   {
     resultNode = rootNode.FirstChild("DescribeDBClusterSnapshotsResult");
   }
@@ -50,7 +50,7 @@ DescribeDBClusterSnapshotsResult& DescribeDBClusterSnapshotsResult::operator =(c
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode dBClusterSnapshotsNode = resultNode.FirstChild("DBClusterSnapshots");
     if(!dBClusterSnapshotsNode.IsNull())
@@ -40,7 +40,7 @@ DescribeDBClustersResult& DescribeDBClustersResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDBClustersResult")
+  if (rootNode.GetNameView() != "DescribeDBClustersResult")
   {
     resultNode = rootNode.FirstChild("DescribeDBClustersResult");
   }
@@ -50,7 +50,7 @@ DescribeDBClustersResult& DescribeDBClustersResult::operator =(const AmazonWebSe
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode dBClustersNode = resultNode.FirstChild("DBClusters");
     if(!dBClustersNode.IsNull())
@@ -40,7 +40,7 @@ DescribeDBEngineVersionsResult& DescribeDBEngineVersionsResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDBEngineVersionsResult")
+  if (rootNode.GetNameView() != "DescribeDBEngineVersionsResult")
   {
     resultNode = rootNode.FirstChild("DescribeDBEngineVersionsResult");
   }
@@ -50,7 +50,7 @@ DescribeDBEngineVersionsResult& DescribeDBEngineVersionsResult::operator =(const
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode dBEngineVersionsNode = resultNode.FirstChild("DBEngineVersions");
     if(!dBEngineVersionsNode.IsNull())
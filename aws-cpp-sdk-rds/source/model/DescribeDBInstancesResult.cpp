@@ -40,7 +40,7 @@ DescribeDBInstancesResult& DescribeDBInstancesResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDBInstancesResult")
+  if (rootNode.GetNameView() != "DescribeDBInstancesResult")
   {
     resultNode = rootNode.FirstChild("DescribeDBInstancesResult");
   }
@@ -50,7 +50,7 @@ DescribeDBInstancesResult& DescribeDBInstancesResult::operator =(const AmazonWeb
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode dBInstancesNode = resultNode.FirstChild("DBInstances");
     if(!dBInstancesNode.IsNull())
@@ -57,19 +57,19 @@ DescribeDBLogFilesDetails& DescribeDBLogFilesDetails::operator =(const XmlNode&
     XmlNode logFileNameNode = resultNode.FirstChild("LogFileName");
     if(!logFileNameNode.IsNull())
     {
-      m_logFileName = StringUtils::Trim(logFileNameNode.GetText().c_str());
+      m_logFileName = logFileNameNode.GetTextView().Trim().ToString();
       m_logFileNameHasBeenSet = true;
     }
     XmlNode lastWrittenNode = resultNode.FirstChild("LastWritten");
     if(!lastWrittenNode.IsNull())
     {
-      m_lastWritten = StringUtils::ConvertToInt64(StringUtils::Trim(lastWrittenNode.GetText().c_str()).c_str());
+      m_lastWritten = StringUtils::ConvertToInt64(lastWrittenNode.GetTextView().Trim().ToString().c_str());
       m_lastWrittenHasBeenSet = true;
     }
     XmlNode sizeNode = resultNode.FirstChild("Size");
     if(!sizeNode.IsNull())
     {
-      m_size = StringUtils::ConvertToInt64(StringUtils::Trim(sizeNode.GetText().c_str()).c_str());
+      m_size = StringUtils::ConvertToInt64(sizeNode.GetTextView().Trim().ToString().c_str());
       m_sizeHasBeenSet = true;
     }
   }
@@ -81,7 +81,7 @@ void DescribeDBLogFilesDetails::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_logFileNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LogFileName=" << StringUtils::URLEncode(m_logFileName.c_str()) << "&";
+      oStream << location << index << locationValue << ".LogFileName=" << StringUtils::URLEncoded(m_logFileName) << "&";
   }
 
   if(m_lastWrittenHasBeenSet)
@@ -100,7 +100,7 @@ void DescribeDBLogFilesDetails::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_logFileNameHasBeenSet)
   {
-      oStream << location << ".LogFileName=" << StringUtils::URLEncode(m_logFileName.c_str()) << "&";
+      oStream << location << ".LogFileName=" << StringUtils::URLEncoded(m_logFileName) << "&";
   }
   if(m_lastWrittenHasBeenSet)
   {
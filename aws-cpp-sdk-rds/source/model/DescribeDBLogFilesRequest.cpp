@@ -15,6 +15,7 @@
 #include <aws/rds/model/DescribeDBLogFilesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -35,16 +36,16 @@ DescribeDBLogFilesRequest::DescribeDBLogFilesRequest() :
 
 Aws::String DescribeDBLogFilesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeDBLogFiles&";
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-    ss << "DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+    ss << "DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
 
   if(m_filenameContainsHasBeenSet)
   {
-    ss << "FilenameContains=" << StringUtils::URLEncode(m_filenameContains.c_str()) << "&";
+    ss << "FilenameContains=" << StringUtils::URLEncoded(m_filenameContains) << "&";
   }
 
   if(m_fileLastWrittenHasBeenSet)
@@ -74,10 +75,10 @@ Aws::String DescribeDBLogFilesRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
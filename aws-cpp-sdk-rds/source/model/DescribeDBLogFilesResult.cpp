@@ -40,7 +40,7 @@ DescribeDBLogFilesResult& DescribeDBLogFilesResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDBLogFilesResult")
+  if (rootNode.GetNameView() != "DescribeDBLogFilesResult")
   {
     resultNode = rootNode.FirstChild("DescribeDBLogFilesResult");
   }
@@ -61,7 +61,7 @@ DescribeDBLogFilesResult& DescribeDBLogFilesResult::operator =(const AmazonWebSe
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ DescribeDBParameterGroupsResult& DescribeDBParameterGroupsResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDBParameterGroupsResult")
+  if (rootNode.GetNameView() != "DescribeDBParameterGroupsResult")
   {
     resultNode = rootNode.FirstChild("DescribeDBParameterGroupsResult");
   }
@@ -50,7 +50,7 @@ DescribeDBParameterGroupsResult& DescribeDBParameterGroupsResult::operator =(con
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode dBParameterGroupsNode = resultNode.FirstChild("DBParameterGroups");
     if(!dBParameterGroupsNode.IsNull())
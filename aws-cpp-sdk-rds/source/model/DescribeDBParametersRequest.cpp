@@ -15,6 +15,7 @@
 #include <aws/rds/model/DescribeDBParametersRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -31,16 +32,16 @@ DescribeDBParametersRequest::DescribeDBParametersRequest() :
 
 Aws::String DescribeDBParametersRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeDBParameters&";
   if(m_dBParameterGroupNameHasBeenSet)
   {
-    ss << "DBParameterGroupName=" << StringUtils::URLEncode(m_dBParameterGroupName.c_str()) << "&";
+    ss << "DBParameterGroupName=" << StringUtils::URLEncoded(m_dBParameterGroupName) << "&";
   }
 
   if(m_sourceHasBeenSet)
   {
-    ss << "Source=" << StringUtils::URLEncode(m_source.c_str()) << "&";
+    ss << "Source=" << StringUtils::URLEncoded(m_source) << "&";
   }
 
   if(m_filtersHasBeenSet)
@@ -60,10 +61,10 @@ Aws::String DescribeDBParametersRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
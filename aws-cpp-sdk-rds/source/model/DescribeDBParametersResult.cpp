@@ -40,7 +40,7 @@ DescribeDBParametersResult& DescribeDBParametersResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDBParametersResult")
+  if (rootNode.GetNameView() != "DescribeDBParametersResult")
   {
     resultNode = rootNode.FirstChild("DescribeDBParametersResult");
   }
@@ -61,7 +61,7 @@ DescribeDBParametersResult& DescribeDBParametersResult::operator =(const AmazonW
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
   }
 
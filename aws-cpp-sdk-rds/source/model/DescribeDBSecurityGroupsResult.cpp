@@ -40,7 +40,7 @@ DescribeDBSecurityGroupsResult& DescribeDBSecurityGroupsResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDBSecurityGroupsResult")
+  if (rootNode.GetNameView() != "DescribeDBSecurityGroupsResult")
   {
     resultNode = rootNode.FirstChild("DescribeDBSecurityGroupsResult");
   }
@@ -50,7 +50,7 @@ DescribeDBSecurityGroupsResult& DescribeDBSecurityGroupsResult::operator =(const
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode dBSecurityGroupsNode = resultNode.FirstChild("DBSecurityGroups");
     if(!dBSecurityGroupsNode.IsNull())
@@ -40,7 +40,7 @@ DescribeDBSnapshotAttributesResult& DescribeDBSnapshotAttributesResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDBSnapshotAttributesResult")
+  if (rootNode.GetNameView() != "DescribeDBSnapshotAttributesResult")
   {
     resultNode = rootNode.FirstChild("DescribeDBSnapshotAttributesResult");
   }
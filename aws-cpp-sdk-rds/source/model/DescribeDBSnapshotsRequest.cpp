@@ -15,6 +15,7 @@
 #include <aws/rds/model/DescribeDBSnapshotsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -36,21 +37,21 @@ DescribeDBSnapshotsRequest::DescribeDBSnapshotsRequest() :
 
 Aws::String DescribeDBSnapshotsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeDBSnapshots&";
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-    ss << "DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+    ss << "DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
 
   if(m_dBSnapshotIdentifierHasBeenSet)
   {
-    ss << "DBSnapshotIdentifier=" << StringUtils::URLEncode(m_dBSnapshotIdentifier.c_str()) << "&";
+    ss << "DBSnapshotIdentifier=" << StringUtils::URLEncoded(m_dBSnapshotIdentifier) << "&";
   }
 
   if(m_snapshotTypeHasBeenSet)
   {
-    ss << "SnapshotType=" << StringUtils::URLEncode(m_snapshotType.c_str()) << "&";
+    ss << "SnapshotType=" << StringUtils::URLEncoded(m_snapshotType) << "&";
   }
 
   if(m_filtersHasBeenSet)
@@ -70,7 +71,7 @@ Aws::String DescribeDBSnapshotsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_includeSharedHasBeenSet)
@@ -84,6 +85,6 @@ Aws::String DescribeDBSnapshotsRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
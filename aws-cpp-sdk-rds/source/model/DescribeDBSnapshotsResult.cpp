@@ -40,7 +40,7 @@ DescribeDBSnapshotsResult& DescribeDBSnapshotsResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDBSnapshotsResult")
+  if (rootNode.GetNameView() != "DescribeDBSnapshotsResult")
   {
     resultNode = rootNode.FirstChild("DescribeDBSnapshotsResult");
   }
@@ -50,7 +50,7 @@ DescribeDBSnapshotsResult& DescribeDBSnapshotsResult::operator =(const AmazonWeb
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode dBSnapshotsNode = resultNode.FirstChild("DBSnapshots");
     if(!dBSnapshotsNode.IsNull())
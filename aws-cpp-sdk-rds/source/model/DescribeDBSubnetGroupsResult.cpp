@@ -40,7 +40,7 @@ DescribeDBSubnetGroupsResult& DescribeDBSubnetGroupsResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDBSubnetGroupsResult")
+  if (rootNode.GetNameView() != "DescribeDBSubnetGroupsResult")
   {
     resultNode = rootNode.FirstChild("DescribeDBSubnetGroupsResult");
   }
@@ -50,7 +50,7 @@ DescribeDBSubnetGroupsResult& DescribeDBSubnetGroupsResult::operator =(const Ama
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode dBSubnetGroupsNode = resultNode.FirstChild("DBSubnetGroups");
     if(!dBSubnetGroupsNode.IsNull())
@@ -40,7 +40,7 @@ DescribeEngineDefaultClusterParametersResult& DescribeEngineDefaultClusterParame
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeEngineDefaultClusterParametersResult")
+  if (rootNode.GetNameView() != "DescribeEngineDefaultClusterParametersResult")
   {
     resultNode = rootNode.FirstChild("DescribeEngineDefaultClusterParametersResult");
   }
@@ -40,7 +40,7 @@ DescribeEngineDefaultParametersResult& DescribeEngineDefaultParametersResult::op
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeEngineDefaultParametersResult")
+  if (rootNode.GetNameView() != "DescribeEngineDefaultParametersResult")
   {
     resultNode = rootNode.FirstChild("DescribeEngineDefaultParametersResult");
   }
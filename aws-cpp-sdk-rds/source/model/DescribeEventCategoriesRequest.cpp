@@ -15,6 +15,7 @@
 #include <aws/rds/model/DescribeEventCategoriesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ DescribeEventCategoriesRequest::DescribeEventCategoriesRequest() :
 
 Aws::String DescribeEventCategoriesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeEventCategories&";
   if(m_sourceTypeHasBeenSet)
   {
-    ss << "SourceType=" << StringUtils::URLEncode(m_sourceType.c_str()) << "&";
+    ss << "SourceType=" << StringUtils::URLEncoded(m_sourceType) << "&";
   }
 
   if(m_filtersHasBeenSet)
@@ -45,6 +46,6 @@ Aws::String DescribeEventCategoriesRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeEventCategoriesResult& DescribeEventCategoriesResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeEventCategoriesResult")
+  if (rootNode.GetNameView() != "DescribeEventCategoriesResult")
   {
     resultNode = rootNode.FirstChild("DescribeEventCategoriesResult");
   }
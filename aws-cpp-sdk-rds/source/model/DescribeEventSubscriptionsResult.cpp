@@ -40,7 +40,7 @@ DescribeEventSubscriptionsResult& DescribeEventSubscriptionsResult::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeEventSubscriptionsResult")
+  if (rootNode.GetNameView() != "DescribeEventSubscriptionsResult")
   {
     resultNode = rootNode.FirstChild("DescribeEventSubscriptionsResult");
   }
@@ -50,7 +50,7 @@ DescribeEventSubscriptionsResult& DescribeEventSubscriptionsResult::operator =(c
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode eventSubscriptionsListNode = resultNode.FirstChild("EventSubscriptionsList");
     if(!eventSubscriptionsListNode.IsNull())
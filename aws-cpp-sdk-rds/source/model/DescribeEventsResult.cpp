@@ -40,7 +40,7 @@ DescribeEventsResult& DescribeEventsResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeEventsResult")
+  if (rootNode.GetNameView() != "DescribeEventsResult")
   {
     resultNode = rootNode.FirstChild("DescribeEventsResult");
   }
@@ -50,7 +50,7 @@ DescribeEventsResult& DescribeEventsResult::operator =(const AmazonWebServiceRes
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode eventsNode = resultNode.FirstChild("Events");
     if(!eventsNode.IsNull())
@@ -15,6 +15,7 @@
 #include <aws/rds/model/DescribeOptionGroupOptionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -31,16 +32,16 @@ DescribeOptionGroupOptionsRequest::DescribeOptionGroupOptionsRequest() :
 
 Aws::String DescribeOptionGroupOptionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeOptionGroupOptions&";
   if(m_engineNameHasBeenSet)
   {
-    ss << "EngineName=" << StringUtils::URLEncode(m_engineName.c_str()) << "&";
+    ss << "EngineName=" << StringUtils::URLEncoded(m_engineName) << "&";
   }
 
   if(m_majorEngineVersionHasBeenSet)
   {
-    ss << "MajorEngineVersion=" << StringUtils::URLEncode(m_majorEngineVersion.c_str()) << "&";
+    ss << "MajorEngineVersion=" << StringUtils::URLEncoded(m_majorEngineVersion) << "&";
   }
 
   if(m_filtersHasBeenSet)
@@ -60,10 +61,10 @@ Aws::String DescribeOptionGroupOptionsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeOptionGroupOptionsResult& DescribeOptionGroupOptionsResult::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeOptionGroupOptionsResult")
+  if (rootNode.GetNameView() != "DescribeOptionGroupOptionsResult")
   {
     resultNode = rootNode.FirstChild("DescribeOptionGroupOptionsResult");
   }
@@ -61,7 +61,7 @@ DescribeOptionGroupOptionsResult& DescribeOptionGroupOptionsResult::operator =(c
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/rds/model/DescribeOptionGroupsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -32,11 +33,11 @@ DescribeOptionGroupsRequest::DescribeOptionGroupsRequest() :
 
 Aws::String DescribeOptionGroupsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeOptionGroups&";
   if(m_optionGroupNameHasBeenSet)
   {
-    ss << "OptionGroupName=" << StringUtils::URLEncode(m_optionGroupName.c_str()) << "&";
+    ss << "OptionGroupName=" << StringUtils::URLEncoded(m_optionGroupName) << "&";
   }
 
   if(m_filtersHasBeenSet)
@@ -51,7 +52,7 @@ Aws::String DescribeOptionGroupsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -61,15 +62,15 @@ Aws::String DescribeOptionGroupsRequest::SerializePayload() const
 
   if(m_engineNameHasBeenSet)
   {
-    ss << "EngineName=" << StringUtils::URLEncode(m_engineName.c_str()) << "&";
+    ss << "EngineName=" << StringUtils::URLEncoded(m_engineName) << "&";
   }
 
   if(m_majorEngineVersionHasBeenSet)
   {
-    ss << "MajorEngineVersion=" << StringUtils::URLEncode(m_majorEngineVersion.c_str()) << "&";
+    ss << "MajorEngineVersion=" << StringUtils::URLEncoded(m_majorEngineVersion) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
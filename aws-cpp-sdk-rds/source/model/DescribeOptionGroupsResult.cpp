@@ -40,7 +40,7 @@ DescribeOptionGroupsResult& DescribeOptionGroupsResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeOptionGroupsResult")
+  if (rootNode.GetNameView() != "DescribeOptionGroupsResult")
   {
     resultNode = rootNode.FirstChild("DescribeOptionGroupsResult");
   }
@@ -61,7 +61,7 @@ DescribeOptionGroupsResult& DescribeOptionGroupsResult::operator =(const AmazonW
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/rds/model/DescribeOrderableDBInstanceOptionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -35,26 +36,26 @@ DescribeOrderableDBInstanceOptionsRequest::DescribeOrderableDBInstanceOptionsReq
 
 Aws::String DescribeOrderableDBInstanceOptionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeOrderableDBInstanceOptions&";
   if(m_engineHasBeenSet)
   {
-    ss << "Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+    ss << "Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
 
   if(m_engineVersionHasBeenSet)
   {
-    ss << "EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+    ss << "EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_dBInstanceClassHasBeenSet)
   {
-    ss << "DBInstanceClass=" << StringUtils::URLEncode(m_dBInstanceClass.c_str()) << "&";
+    ss << "DBInstanceClass=" << StringUtils::URLEncoded(m_dBInstanceClass) << "&";
   }
 
   if(m_licenseModelHasBeenSet)
   {
-    ss << "LicenseModel=" << StringUtils::URLEncode(m_licenseModel.c_str()) << "&";
+    ss << "LicenseModel=" << StringUtils::URLEncoded(m_licenseModel) << "&";
   }
 
   if(m_vpcHasBeenSet)
@@ -79,10 +80,10 @@ Aws::String DescribeOrderableDBInstanceOptionsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeOrderableDBInstanceOptionsResult& DescribeOrderableDBInstanceOptionsResu
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeOrderableDBInstanceOptionsResult")
+  if (rootNode.GetNameView() != "DescribeOrderableDBInstanceOptionsResult")
   {
     resultNode = rootNode.FirstChild("DescribeOrderableDBInstanceOptionsResult");
   }
@@ -61,7 +61,7 @@ DescribeOrderableDBInstanceOptionsResult& DescribeOrderableDBInstanceOptionsResu
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
   }
 
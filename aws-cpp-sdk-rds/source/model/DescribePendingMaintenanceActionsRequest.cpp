@@ -15,6 +15,7 @@
 #include <aws/rds/model/DescribePendingMaintenanceActionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -30,11 +31,11 @@ DescribePendingMaintenanceActionsRequest::DescribePendingMaintenanceActionsReque
 
 Aws::String DescribePendingMaintenanceActionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribePendingMaintenanceActions&";
   if(m_resourceIdentifierHasBeenSet)
   {
-    ss << "ResourceIdentifier=" << StringUtils::URLEncode(m_resourceIdentifier.c_str()) << "&";
+    ss << "ResourceIdentifier=" << StringUtils::URLEncoded(m_resourceIdentifier) << "&";
   }
 
   if(m_filtersHasBeenSet)
@@ -49,7 +50,7 @@ Aws::String DescribePendingMaintenanceActionsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -58,6 +59,6 @@ Aws::String DescribePendingMaintenanceActionsRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribePendingMaintenanceActionsResult& DescribePendingMaintenanceActionsResult
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribePendingMaintenanceActionsResult")
+  if (rootNode.GetNameView() != "DescribePendingMaintenanceActionsResult")
   {
     resultNode = rootNode.FirstChild("DescribePendingMaintenanceActionsResult");
   }
@@ -61,7 +61,7 @@ DescribePendingMaintenanceActionsResult& DescribePendingMaintenanceActionsResult
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
   }
 
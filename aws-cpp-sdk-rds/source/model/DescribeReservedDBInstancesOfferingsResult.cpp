@@ -40,7 +40,7 @@ DescribeReservedDBInstancesOfferingsResult& DescribeReservedDBInstancesOfferings
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeReservedDBInstancesOfferingsResult")
+  if (rootNode.GetNameView() != "DescribeReservedDBInstancesOfferingsResult")
   {
     resultNode = rootNode.FirstChild("DescribeReservedDBInstancesOfferingsResult");
   }
@@ -50,7 +50,7 @@ DescribeReservedDBInstancesOfferingsResult& DescribeReservedDBInstancesOfferings
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode reservedDBInstancesOfferingsNode = resultNode.FirstChild("ReservedDBInstancesOfferings");
     if(!reservedDBInstancesOfferingsNode.IsNull())
@@ -15,6 +15,7 @@
 #include <aws/rds/model/DescribeReservedDBInstancesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -37,36 +38,36 @@ DescribeReservedDBInstancesRequest::DescribeReservedDBInstancesRequest() :
 
 Aws::String DescribeReservedDBInstancesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeReservedDBInstances&";
   if(m_reservedDBInstanceIdHasBeenSet)
   {
-    ss << "ReservedDBInstanceId=" << StringUtils::URLEncode(m_reservedDBInstanceId.c_str()) << "&";
+    ss << "ReservedDBInstanceId=" << StringUtils::URLEncoded(m_reservedDBInstanceId) << "&";
   }
 
   if(m_reservedDBInstancesOfferingIdHasBeenSet)
   {
-    ss << "ReservedDBInstancesOfferingId=" << StringUtils::URLEncode(m_reservedDBInstancesOfferingId.c_str()) << "&";
+    ss << "ReservedDBInstancesOfferingId=" << StringUtils::URLEncoded(m_reservedDBInstancesOfferingId) << "&";
   }
 
   if(m_dBInstanceClassHasBeenSet)
   {
-    ss << "DBInstanceClass=" << StringUtils::URLEncode(m_dBInstanceClass.c_str()) << "&";
+    ss << "DBInstanceClass=" << StringUtils::URLEncoded(m_dBInstanceClass) << "&";
   }
 
   if(m_durationHasBeenSet)
   {
-    ss << "Duration=" << StringUtils::URLEncode(m_duration.c_str()) << "&";
+    ss << "Duration=" << StringUtils::URLEncoded(m_duration) << "&";
   }
 
   if(m_productDescriptionHasBeenSet)
   {
-    ss << "ProductDescription=" << StringUtils::URLEncode(m_productDescription.c_str()) << "&";
+    ss << "ProductDescription=" << StringUtils::URLEncoded(m_productDescription) << "&";
   }
 
   if(m_offeringTypeHasBeenSet)
   {
-    ss << "OfferingType=" << StringUtils::URLEncode(m_offeringType.c_str()) << "&";
+    ss << "OfferingType=" << StringUtils::URLEncoded(m_offeringType) << "&";
   }
 
   if(m_multiAZHasBeenSet)
@@ -91,10 +92,10 @@ Aws::String DescribeReservedDBInstancesRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeReservedDBInstancesResult& DescribeReservedDBInstancesResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeReservedDBInstancesResult")
+  if (rootNode.GetNameView() != "DescribeReservedDBInstancesResult")
   {
     resultNode = rootNode.FirstChild("DescribeReservedDBInstancesResult");
   }
@@ -50,7 +50,7 @@ DescribeReservedDBInstancesResult& DescribeReservedDBInstancesResult::operator =
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode reservedDBInstancesNode = resultNode.FirstChild("ReservedDBInstances");
     if(!reservedDBInstancesNode.IsNull())
@@ -55,25 +55,25 @@ DomainMembership& DomainMembership::operator =(const XmlNode& xmlNode)
     XmlNode domainNode = resultNode.FirstChild("Domain");
     if(!domainNode.IsNull())
     {
-      m_domain = StringUtils::Trim(domainNode.GetText().c_str());
+      m_domain = domainNode.GetTextView().Trim().ToString();
       m_domainHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode fQDNNode = resultNode.FirstChild("FQDN");
     if(!fQDNNode.IsNull())
     {
-      m_fQDN = StringUtils::Trim(fQDNNode.GetText().c_str());
+      m_fQDN = fQDNNode.GetTextView().Trim().ToString();
       m_fQDNHasBeenSet = true;
     }
     XmlNode iAMRoleNameNode = resultNode.FirstChild("IAMRoleName");
     if(!iAMRoleNameNode.IsNull())
     {
-      m_iAMRoleName = StringUtils::Trim(iAMRoleNameNode.GetText().c_str());
+      m_iAMRoleName = iAMRoleNameNode.GetTextView().Trim().ToString();
       m_iAMRoleNameHasBeenSet = true;
     }
   }
@@ -85,22 +85,22 @@ void DomainMembership::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_domainHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Domain=" << StringUtils::URLEncode(m_domain.c_str()) << "&";
+      oStream << location << index << locationValue << ".Domain=" << StringUtils::URLEncoded(m_domain) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_fQDNHasBeenSet)
   {
-      oStream << location << index << locationValue << ".FQDN=" << StringUtils::URLEncode(m_fQDN.c_str()) << "&";
+      oStream << location << index << locationValue << ".FQDN=" << StringUtils::URLEncoded(m_fQDN) << "&";
   }
 
   if(m_iAMRoleNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".IAMRoleName=" << StringUtils::URLEncode(m_iAMRoleName.c_str()) << "&";
+      oStream << location << index << locationValue << ".IAMRoleName=" << StringUtils::URLEncoded(m_iAMRoleName) << "&";
   }
 
 }
@@ -109,19 +109,19 @@ void DomainMembership::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_domainHasBeenSet)
   {
-      oStream << location << ".Domain=" << StringUtils::URLEncode(m_domain.c_str()) << "&";
+      oStream << location << ".Domain=" << StringUtils::URLEncoded(m_domain) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_fQDNHasBeenSet)
   {
-      oStream << location << ".FQDN=" << StringUtils::URLEncode(m_fQDN.c_str()) << "&";
+      oStream << location << ".FQDN=" << StringUtils::URLEncoded(m_fQDN) << "&";
   }
   if(m_iAMRoleNameHasBeenSet)
   {
-      oStream << location << ".IAMRoleName=" << StringUtils::URLEncode(m_iAMRoleName.c_str()) << "&";
+      oStream << location << ".IAMRoleName=" << StringUtils::URLEncoded(m_iAMRoleName) << "&";
   }
 }
 
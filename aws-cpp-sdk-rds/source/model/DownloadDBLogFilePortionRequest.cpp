@@ -15,6 +15,7 @@
 #include <aws/rds/model/DownloadDBLogFilePortionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -30,21 +31,21 @@ DownloadDBLogFilePortionRequest::DownloadDBLogFilePortionRequest() :
 
 Aws::String DownloadDBLogFilePortionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DownloadDBLogFilePortion&";
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-    ss << "DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+    ss << "DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
 
   if(m_logFileNameHasBeenSet)
   {
-    ss << "LogFileName=" << StringUtils::URLEncode(m_logFileName.c_str()) << "&";
+    ss << "LogFileName=" << StringUtils::URLEncoded(m_logFileName) << "&";
   }
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_numberOfLinesHasBeenSet)
@@ -53,6 +54,6 @@ Aws::String DownloadDBLogFilePortionRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -42,7 +42,7 @@ DownloadDBLogFilePortionResult& DownloadDBLogFilePortionResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DownloadDBLogFilePortionResult")
+  if (rootNode.GetNameView() != "DownloadDBLogFilePortionResult")
   {
     resultNode = rootNode.FirstChild("DownloadDBLogFilePortionResult");
   }
@@ -52,17 +52,17 @@ DownloadDBLogFilePortionResult& DownloadDBLogFilePortionResult::operator =(const
     XmlNode logFileDataNode = resultNode.FirstChild("LogFileData");
     if(!logFileDataNode.IsNull())
     {
-      m_logFileData = StringUtils::Trim(logFileDataNode.GetText().c_str());
+      m_logFileData = logFileDataNode.GetTextView().Trim().ToString();
     }
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode additionalDataPendingNode = resultNode.FirstChild("AdditionalDataPending");
     if(!additionalDataPendingNode.IsNull())
     {
-      m_additionalDataPending = StringUtils::ConvertToBool(StringUtils::Trim(additionalDataPendingNode.GetText().c_str()).c_str());
+      m_additionalDataPending = StringUtils::ConvertToBool(additionalDataPendingNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -55,25 +55,25 @@ EC2SecurityGroup& EC2SecurityGroup::operator =(const XmlNode& xmlNode)
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode eC2SecurityGroupNameNode = resultNode.FirstChild("EC2SecurityGroupName");
     if(!eC2SecurityGroupNameNode.IsNull())
     {
-      m_eC2SecurityGroupName = StringUtils::Trim(eC2SecurityGroupNameNode.GetText().c_str());
+      m_eC2SecurityGroupName = eC2SecurityGroupNameNode.GetTextView().Trim().ToString();
       m_eC2SecurityGroupNameHasBeenSet = true;
     }
     XmlNode eC2SecurityGroupIdNode = resultNode.FirstChild("EC2SecurityGroupId");
     if(!eC2SecurityGroupIdNode.IsNull())
     {
-      m_eC2SecurityGroupId = StringUtils::Trim(eC2SecurityGroupIdNode.GetText().c_str());
+      m_eC2SecurityGroupId = eC2SecurityGroupIdNode.GetTextView().Trim().ToString();
       m_eC2SecurityGroupIdHasBeenSet = true;
     }
     XmlNode eC2SecurityGroupOwnerIdNode = resultNode.FirstChild("EC2SecurityGroupOwnerId");
     if(!eC2SecurityGroupOwnerIdNode.IsNull())
     {
-      m_eC2SecurityGroupOwnerId = StringUtils::Trim(eC2SecurityGroupOwnerIdNode.GetText().c_str());
+      m_eC2SecurityGroupOwnerId = eC2SecurityGroupOwnerIdNode.GetTextView().Trim().ToString();
       m_eC2SecurityGroupOwnerIdHasBeenSet = true;
     }
   }
@@ -85,22 +85,22 @@ void EC2SecurityGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_eC2SecurityGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EC2SecurityGroupName=" << StringUtils::URLEncode(m_eC2SecurityGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".EC2SecurityGroupName=" << StringUtils::URLEncoded(m_eC2SecurityGroupName) << "&";
   }
 
   if(m_eC2SecurityGroupIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EC2SecurityGroupId=" << StringUtils::URLEncode(m_eC2SecurityGroupId.c_str()) << "&";
+      oStream << location << index << locationValue << ".EC2SecurityGroupId=" << StringUtils::URLEncoded(m_eC2SecurityGroupId) << "&";
   }
 
   if(m_eC2SecurityGroupOwnerIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EC2SecurityGroupOwnerId=" << StringUtils::URLEncode(m_eC2SecurityGroupOwnerId.c_str()) << "&";
+      oStream << location << index << locationValue << ".EC2SecurityGroupOwnerId=" << StringUtils::URLEncoded(m_eC2SecurityGroupOwnerId) << "&";
   }
 
 }
@@ -109,19 +109,19 @@ void EC2SecurityGroup::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_eC2SecurityGroupNameHasBeenSet)
   {
-      oStream << location << ".EC2SecurityGroupName=" << StringUtils::URLEncode(m_eC2SecurityGroupName.c_str()) << "&";
+      oStream << location << ".EC2SecurityGroupName=" << StringUtils::URLEncoded(m_eC2SecurityGroupName) << "&";
   }
   if(m_eC2SecurityGroupIdHasBeenSet)
   {
-      oStream << location << ".EC2SecurityGroupId=" << StringUtils::URLEncode(m_eC2SecurityGroupId.c_str()) << "&";
+      oStream << location << ".EC2SecurityGroupId=" << StringUtils::URLEncoded(m_eC2SecurityGroupId) << "&";
   }
   if(m_eC2SecurityGroupOwnerIdHasBeenSet)
   {
-      oStream << location << ".EC2SecurityGroupOwnerId=" << StringUtils::URLEncode(m_eC2SecurityGroupOwnerId.c_str()) << "&";
+      oStream << location << ".EC2SecurityGroupOwnerId=" << StringUtils::URLEncoded(m_eC2SecurityGroupOwnerId) << "&";
   }
 }
 
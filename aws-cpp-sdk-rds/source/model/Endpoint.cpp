@@ -55,19 +55,19 @@ Endpoint& Endpoint::operator =(const XmlNode& xmlNode)
     XmlNode addressNode = resultNode.FirstChild("Address");
     if(!addressNode.IsNull())
     {
-      m_address = StringUtils::Trim(addressNode.GetText().c_str());
+      m_address = addressNode.GetTextView().Trim().ToString();
       m_addressHasBeenSet = true;
     }
     XmlNode portNode = resultNode.FirstChild("Port");
     if(!portNode.IsNull())
     {
-      m_port = StringUtils::ConvertToInt32(StringUtils::Trim(portNode.GetText().c_str()).c_str());
+      m_port = StringUtils::ConvertToInt32(portNode.GetTextView().Trim().ToString().c_str());
       m_portHasBeenSet = true;
     }
     XmlNode hostedZoneIdNode = resultNode.FirstChild("HostedZoneId");
     if(!hostedZoneIdNode.IsNull())
     {
-      m_hostedZoneId = StringUtils::Trim(hostedZoneIdNode.GetText().c_str());
+      m_hostedZoneId = hostedZoneIdNode.GetTextView().Trim().ToString();
       m_hostedZoneIdHasBeenSet = true;
     }
   }
@@ -79,7 +79,7 @@ void Endpoint::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 {
   if(m_addressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Address=" << StringUtils::URLEncode(m_address.c_str()) << "&";
+      oStream << location << index << locationValue << ".Address=" << StringUtils::URLEncoded(m_address) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -89,7 +89,7 @@ void Endpoint::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_hostedZoneIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HostedZoneId=" << StringUtils::URLEncode(m_hostedZoneId.c_str()) << "&";
+      oStream << location << index << locationValue << ".HostedZoneId=" << StringUtils::URLEncoded(m_hostedZoneId) << "&";
   }
 
 }
@@ -98,7 +98,7 @@ void Endpoint::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_addressHasBeenSet)
   {
-      oStream << location << ".Address=" << StringUtils::URLEncode(m_address.c_str()) << "&";
+      oStream << location << ".Address=" << StringUtils::URLEncoded(m_address) << "&";
   }
   if(m_portHasBeenSet)
   {
@@ -106,7 +106,7 @@ void Endpoint::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_hostedZoneIdHasBeenSet)
   {
-      oStream << location << ".HostedZoneId=" << StringUtils::URLEncode(m_hostedZoneId.c_str()) << "&";
+      oStream << location << ".HostedZoneId=" << StringUtils::URLEncoded(m_hostedZoneId) << "&";
   }
 }
 
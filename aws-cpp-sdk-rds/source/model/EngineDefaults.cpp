@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,13 +54,13 @@ EngineDefaults& EngineDefaults::operator =(const XmlNode& xmlNode)
     XmlNode dBParameterGroupFamilyNode = resultNode.FirstChild("DBParameterGroupFamily");
     if(!dBParameterGroupFamilyNode.IsNull())
     {
-      m_dBParameterGroupFamily = StringUtils::Trim(dBParameterGroupFamilyNode.GetText().c_str());
+      m_dBParameterGroupFamily = dBParameterGroupFamilyNode.GetTextView().Trim().ToString();
       m_dBParameterGroupFamilyHasBeenSet = true;
     }
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
       m_markerHasBeenSet = true;
     }
     XmlNode parametersNode = resultNode.FirstChild("Parameters");
@@ -83,12 +84,12 @@ void EngineDefaults::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_dBParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBParameterGroupFamily=" << StringUtils::URLEncode(m_dBParameterGroupFamily.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBParameterGroupFamily=" << StringUtils::URLEncoded(m_dBParameterGroupFamily) << "&";
   }
 
   if(m_markerHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+      oStream << location << index << locationValue << ".Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_parametersHasBeenSet)
@@ -96,9 +97,9 @@ void EngineDefaults::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned parametersIdx = 1;
       for(auto& item : m_parameters)
       {
-        Aws::StringStream parametersSs;
+        Aws::Utils::Stream::StringOutputStream parametersSs;
         parametersSs << location << index << locationValue << ".Parameter." << parametersIdx++;
-        item.OutputToStream(oStream, parametersSs.str().c_str());
+        item.OutputToStream(oStream, parametersSs.GetString().c_str());
       }
   }
 
@@ -108,20 +109,20 @@ void EngineDefaults::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_dBParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << ".DBParameterGroupFamily=" << StringUtils::URLEncode(m_dBParameterGroupFamily.c_str()) << "&";
+      oStream << location << ".DBParameterGroupFamily=" << StringUtils::URLEncoded(m_dBParameterGroupFamily) << "&";
   }
   if(m_markerHasBeenSet)
   {
-      oStream << location << ".Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+      oStream << location << ".Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
   if(m_parametersHasBeenSet)
   {
       unsigned parametersIdx = 1;
       for(auto& item : m_parameters)
       {
-        Aws::StringStream parametersSs;
+        Aws::Utils::Stream::StringOutputStream parametersSs;
         parametersSs << location <<  ".Parameter." << parametersIdx++;
-        item.OutputToStream(oStream, parametersSs.str().c_str());
+        item.OutputToStream(oStream, parametersSs.GetString().c_str());
       }
   }
 }
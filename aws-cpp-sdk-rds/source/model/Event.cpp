@@ -59,19 +59,19 @@ Event& Event::operator =(const XmlNode& xmlNode)
     XmlNode sourceIdentifierNode = resultNode.FirstChild("SourceIdentifier");
     if(!sourceIdentifierNode.IsNull())
     {
-      m_sourceIdentifier = StringUtils::Trim(sourceIdentifierNode.GetText().c_str());
+      m_sourceIdentifier = sourceIdentifierNode.GetTextView().Trim().ToString();
       m_sourceIdentifierHasBeenSet = true;
     }
     XmlNode sourceTypeNode = resultNode.FirstChild("SourceType");
     if(!sourceTypeNode.IsNull())
     {
-      m_sourceType = SourceTypeMapper::GetSourceTypeForName(StringUtils::Trim(sourceTypeNode.GetText().c_str()).c_str());
+      m_sourceType = SourceTypeMapper::GetSourceTypeForName(sourceTypeNode.GetTextView().Trim().ToString().c_str());
       m_sourceTypeHasBeenSet = true;
     }
     XmlNode messageNode = resultNode.FirstChild("Message");
     if(!messageNode.IsNull())
     {
-      m_message = StringUtils::Trim(messageNode.GetText().c_str());
+      m_message = messageNode.GetTextView().Trim().ToString();
       m_messageHasBeenSet = true;
     }
     XmlNode eventCategoriesNode = resultNode.FirstChild("EventCategories");
@@ -80,7 +80,7 @@ Event& Event::operator =(const XmlNode& xmlNode)
       XmlNode eventCategoriesMember = eventCategoriesNode.FirstChild("EventCategory");
       while(!eventCategoriesMember.IsNull())
       {
-        m_eventCategories.push_back(StringUtils::Trim(eventCategoriesMember.GetText().c_str()));
+        m_eventCategories.push_back(eventCategoriesMember.GetTextView().Trim().ToString());
         eventCategoriesMember = eventCategoriesMember.NextNode("EventCategory");
       }
 
@@ -89,13 +89,13 @@ Event& Event::operator =(const XmlNode& xmlNode)
     XmlNode dateNode = resultNode.FirstChild("Date");
     if(!dateNode.IsNull())
     {
-      m_date = DateTime(StringUtils::Trim(dateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_date = DateTime(dateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_dateHasBeenSet = true;
     }
     XmlNode sourceArnNode = resultNode.FirstChild("SourceArn");
     if(!sourceArnNode.IsNull())
     {
-      m_sourceArn = StringUtils::Trim(sourceArnNode.GetText().c_str());
+      m_sourceArn = sourceArnNode.GetTextView().Trim().ToString();
       m_sourceArnHasBeenSet = true;
     }
   }
@@ -107,7 +107,7 @@ void Event::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 {
   if(m_sourceIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceIdentifier=" << StringUtils::URLEncode(m_sourceIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceIdentifier=" << StringUtils::URLEncoded(m_sourceIdentifier) << "&";
   }
 
   if(m_sourceTypeHasBeenSet)
@@ -117,7 +117,7 @@ void Event::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 
   if(m_messageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 
   if(m_eventCategoriesHasBeenSet)
@@ -125,18 +125,18 @@ void Event::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
       unsigned eventCategoriesIdx = 1;
       for(auto& item : m_eventCategories)
       {
-        oStream << location << index << locationValue << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
   if(m_dateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Date=" << StringUtils::URLEncode(m_date.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".Date=" << StringUtils::URLEncoded(m_date.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_sourceArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceArn=" << StringUtils::URLEncode(m_sourceArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceArn=" << StringUtils::URLEncoded(m_sourceArn) << "&";
   }
 
 }
@@ -145,7 +145,7 @@ void Event::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_sourceIdentifierHasBeenSet)
   {
-      oStream << location << ".SourceIdentifier=" << StringUtils::URLEncode(m_sourceIdentifier.c_str()) << "&";
+      oStream << location << ".SourceIdentifier=" << StringUtils::URLEncoded(m_sourceIdentifier) << "&";
   }
   if(m_sourceTypeHasBeenSet)
   {
@@ -153,23 +153,23 @@ void Event::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_messageHasBeenSet)
   {
-      oStream << location << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
   if(m_eventCategoriesHasBeenSet)
   {
       unsigned eventCategoriesIdx = 1;
       for(auto& item : m_eventCategories)
       {
-        oStream << location << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_dateHasBeenSet)
   {
-      oStream << location << ".Date=" << StringUtils::URLEncode(m_date.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".Date=" << StringUtils::URLEncoded(m_date.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_sourceArnHasBeenSet)
   {
-      oStream << location << ".SourceArn=" << StringUtils::URLEncode(m_sourceArn.c_str()) << "&";
+      oStream << location << ".SourceArn=" << StringUtils::URLEncoded(m_sourceArn) << "&";
   }
 }
 
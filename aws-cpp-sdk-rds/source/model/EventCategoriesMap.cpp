@@ -51,7 +51,7 @@ EventCategoriesMap& EventCategoriesMap::operator =(const XmlNode& xmlNode)
     XmlNode sourceTypeNode = resultNode.FirstChild("SourceType");
     if(!sourceTypeNode.IsNull())
     {
-      m_sourceType = StringUtils::Trim(sourceTypeNode.GetText().c_str());
+      m_sourceType = sourceTypeNode.GetTextView().Trim().ToString();
       m_sourceTypeHasBeenSet = true;
     }
     XmlNode eventCategoriesNode = resultNode.FirstChild("EventCategories");
@@ -60,7 +60,7 @@ EventCategoriesMap& EventCategoriesMap::operator =(const XmlNode& xmlNode)
       XmlNode eventCategoriesMember = eventCategoriesNode.FirstChild("EventCategory");
       while(!eventCategoriesMember.IsNull())
       {
-        m_eventCategories.push_back(StringUtils::Trim(eventCategoriesMember.GetText().c_str()));
+        m_eventCategories.push_back(eventCategoriesMember.GetTextView().Trim().ToString());
         eventCategoriesMember = eventCategoriesMember.NextNode("EventCategory");
       }
 
@@ -75,7 +75,7 @@ void EventCategoriesMap::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_sourceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceType=" << StringUtils::URLEncode(m_sourceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceType=" << StringUtils::URLEncoded(m_sourceType) << "&";
   }
 
   if(m_eventCategoriesHasBeenSet)
@@ -83,7 +83,7 @@ void EventCategoriesMap::OutputToStream(Aws::OStream& oStream, const char* locat
       unsigned eventCategoriesIdx = 1;
       for(auto& item : m_eventCategories)
       {
-        oStream << location << index << locationValue << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -93,14 +93,14 @@ void EventCategoriesMap::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_sourceTypeHasBeenSet)
   {
-      oStream << location << ".SourceType=" << StringUtils::URLEncode(m_sourceType.c_str()) << "&";
+      oStream << location << ".SourceType=" << StringUtils::URLEncoded(m_sourceType) << "&";
   }
   if(m_eventCategoriesHasBeenSet)
   {
       unsigned eventCategoriesIdx = 1;
       for(auto& item : m_eventCategories)
       {
-        oStream << location << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
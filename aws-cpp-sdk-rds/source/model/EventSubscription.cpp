@@ -69,37 +69,37 @@ EventSubscription& EventSubscription::operator =(const XmlNode& xmlNode)
     XmlNode customerAwsIdNode = resultNode.FirstChild("CustomerAwsId");
     if(!customerAwsIdNode.IsNull())
     {
-      m_customerAwsId = StringUtils::Trim(customerAwsIdNode.GetText().c_str());
+      m_customerAwsId = customerAwsIdNode.GetTextView().Trim().ToString();
       m_customerAwsIdHasBeenSet = true;
     }
     XmlNode custSubscriptionIdNode = resultNode.FirstChild("CustSubscriptionId");
     if(!custSubscriptionIdNode.IsNull())
     {
-      m_custSubscriptionId = StringUtils::Trim(custSubscriptionIdNode.GetText().c_str());
+      m_custSubscriptionId = custSubscriptionIdNode.GetTextView().Trim().ToString();
       m_custSubscriptionIdHasBeenSet = true;
     }
     XmlNode snsTopicArnNode = resultNode.FirstChild("SnsTopicArn");
     if(!snsTopicArnNode.IsNull())
     {
-      m_snsTopicArn = StringUtils::Trim(snsTopicArnNode.GetText().c_str());
+      m_snsTopicArn = snsTopicArnNode.GetTextView().Trim().ToString();
       m_snsTopicArnHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode subscriptionCreationTimeNode = resultNode.FirstChild("SubscriptionCreationTime");
     if(!subscriptionCreationTimeNode.IsNull())
     {
-      m_subscriptionCreationTime = StringUtils::Trim(subscriptionCreationTimeNode.GetText().c_str());
+      m_subscriptionCreationTime = subscriptionCreationTimeNode.GetTextView().Trim().ToString();
       m_subscriptionCreationTimeHasBeenSet = true;
     }
     XmlNode sourceTypeNode = resultNode.FirstChild("SourceType");
     if(!sourceTypeNode.IsNull())
     {
-      m_sourceType = StringUtils::Trim(sourceTypeNode.GetText().c_str());
+      m_sourceType = sourceTypeNode.GetTextView().Trim().ToString();
       m_sourceTypeHasBeenSet = true;
     }
     XmlNode sourceIdsListNode = resultNode.FirstChild("SourceIdsList");
@@ -108,7 +108,7 @@ EventSubscription& EventSubscription::operator =(const XmlNode& xmlNode)
       XmlNode sourceIdsListMember = sourceIdsListNode.FirstChild("SourceId");
       while(!sourceIdsListMember.IsNull())
       {
-        m_sourceIdsList.push_back(StringUtils::Trim(sourceIdsListMember.GetText().c_str()));
+        m_sourceIdsList.push_back(sourceIdsListMember.GetTextView().Trim().ToString());
         sourceIdsListMember = sourceIdsListMember.NextNode("SourceId");
       }
 
@@ -120,7 +120,7 @@ EventSubscription& EventSubscription::operator =(const XmlNode& xmlNode)
       XmlNode eventCategoriesListMember = eventCategoriesListNode.FirstChild("EventCategory");
       while(!eventCategoriesListMember.IsNull())
       {
-        m_eventCategoriesList.push_back(StringUtils::Trim(eventCategoriesListMember.GetText().c_str()));
+        m_eventCategoriesList.push_back(eventCategoriesListMember.GetTextView().Trim().ToString());
         eventCategoriesListMember = eventCategoriesListMember.NextNode("EventCategory");
       }
 
@@ -129,13 +129,13 @@ EventSubscription& EventSubscription::operator =(const XmlNode& xmlNode)
     XmlNode enabledNode = resultNode.FirstChild("Enabled");
     if(!enabledNode.IsNull())
     {
-      m_enabled = StringUtils::ConvertToBool(StringUtils::Trim(enabledNode.GetText().c_str()).c_str());
+      m_enabled = StringUtils::ConvertToBool(enabledNode.GetTextView().Trim().ToString().c_str());
       m_enabledHasBeenSet = true;
     }
     XmlNode eventSubscriptionArnNode = resultNode.FirstChild("EventSubscriptionArn");
     if(!eventSubscriptionArnNode.IsNull())
     {
-      m_eventSubscriptionArn = StringUtils::Trim(eventSubscriptionArnNode.GetText().c_str());
+      m_eventSubscriptionArn = eventSubscriptionArnNode.GetTextView().Trim().ToString();
       m_eventSubscriptionArnHasBeenSet = true;
     }
   }
@@ -147,32 +147,32 @@ void EventSubscription::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_customerAwsIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CustomerAwsId=" << StringUtils::URLEncode(m_customerAwsId.c_str()) << "&";
+      oStream << location << index << locationValue << ".CustomerAwsId=" << StringUtils::URLEncoded(m_customerAwsId) << "&";
   }
 
   if(m_custSubscriptionIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CustSubscriptionId=" << StringUtils::URLEncode(m_custSubscriptionId.c_str()) << "&";
+      oStream << location << index << locationValue << ".CustSubscriptionId=" << StringUtils::URLEncoded(m_custSubscriptionId) << "&";
   }
 
   if(m_snsTopicArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnsTopicArn=" << StringUtils::URLEncode(m_snsTopicArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnsTopicArn=" << StringUtils::URLEncoded(m_snsTopicArn) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_subscriptionCreationTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubscriptionCreationTime=" << StringUtils::URLEncode(m_subscriptionCreationTime.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubscriptionCreationTime=" << StringUtils::URLEncoded(m_subscriptionCreationTime) << "&";
   }
 
   if(m_sourceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceType=" << StringUtils::URLEncode(m_sourceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceType=" << StringUtils::URLEncoded(m_sourceType) << "&";
   }
 
   if(m_sourceIdsListHasBeenSet)
@@ -180,7 +180,7 @@ void EventSubscription::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned sourceIdsListIdx = 1;
       for(auto& item : m_sourceIdsList)
       {
-        oStream << location << index << locationValue << ".SourceId." << sourceIdsListIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".SourceId." << sourceIdsListIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -189,7 +189,7 @@ void EventSubscription::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned eventCategoriesListIdx = 1;
       for(auto& item : m_eventCategoriesList)
       {
-        oStream << location << index << locationValue << ".EventCategory." << eventCategoriesListIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".EventCategory." << eventCategoriesListIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -200,7 +200,7 @@ void EventSubscription::OutputToStream(Aws::OStream& oStream, const char* locati
 
   if(m_eventSubscriptionArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EventSubscriptionArn=" << StringUtils::URLEncode(m_eventSubscriptionArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".EventSubscriptionArn=" << StringUtils::URLEncoded(m_eventSubscriptionArn) << "&";
   }
 
 }
@@ -209,34 +209,34 @@ void EventSubscription::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_customerAwsIdHasBeenSet)
   {
-      oStream << location << ".CustomerAwsId=" << StringUtils::URLEncode(m_customerAwsId.c_str()) << "&";
+      oStream << location << ".CustomerAwsId=" << StringUtils::URLEncoded(m_customerAwsId) << "&";
   }
   if(m_custSubscriptionIdHasBeenSet)
   {
-      oStream << location << ".CustSubscriptionId=" << StringUtils::URLEncode(m_custSubscriptionId.c_str()) << "&";
+      oStream << location << ".CustSubscriptionId=" << StringUtils::URLEncoded(m_custSubscriptionId) << "&";
   }
   if(m_snsTopicArnHasBeenSet)
   {
-      oStream << location << ".SnsTopicArn=" << StringUtils::URLEncode(m_snsTopicArn.c_str()) << "&";
+      oStream << location << ".SnsTopicArn=" << StringUtils::URLEncoded(m_snsTopicArn) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_subscriptionCreationTimeHasBeenSet)
   {
-      oStream << location << ".SubscriptionCreationTime=" << StringUtils::URLEncode(m_subscriptionCreationTime.c_str()) << "&";
+      oStream << location << ".SubscriptionCreationTime=" << StringUtils::URLEncoded(m_subscriptionCreationTime) << "&";
   }
   if(m_sourceTypeHasBeenSet)
   {
-      oStream << location << ".SourceType=" << StringUtils::URLEncode(m_sourceType.c_str()) << "&";
+      oStream << location << ".SourceType=" << StringUtils::URLEncoded(m_sourceType) << "&";
   }
   if(m_sourceIdsListHasBeenSet)
   {
       unsigned sourceIdsListIdx = 1;
       for(auto& item : m_sourceIdsList)
       {
-        oStream << location << ".SourceId." << sourceIdsListIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".SourceId." << sourceIdsListIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_eventCategoriesListHasBeenSet)
@@ -244,7 +244,7 @@ void EventSubscription::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned eventCategoriesListIdx = 1;
       for(auto& item : m_eventCategoriesList)
       {
-        oStream << location << ".EventCategory." << eventCategoriesListIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".EventCategory." << eventCategoriesListIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_enabledHasBeenSet)
@@ -253,7 +253,7 @@ void EventSubscription::OutputToStream(Aws::OStream& oStream, const char* locati
   }
   if(m_eventSubscriptionArnHasBeenSet)
   {
-      oStream << location << ".EventSubscriptionArn=" << StringUtils::URLEncode(m_eventSubscriptionArn.c_str()) << "&";
+      oStream << location << ".EventSubscriptionArn=" << StringUtils::URLEncoded(m_eventSubscriptionArn) << "&";
   }
 }
 
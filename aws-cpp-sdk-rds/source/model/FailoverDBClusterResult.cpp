@@ -40,7 +40,7 @@ FailoverDBClusterResult& FailoverDBClusterResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "FailoverDBClusterResult")
+  if (rootNode.GetNameView() != "FailoverDBClusterResult")
   {
     resultNode = rootNode.FirstChild("FailoverDBClusterResult");
   }
@@ -51,13 +51,13 @@ IPRange& IPRange::operator =(const XmlNode& xmlNode)
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode cIDRIPNode = resultNode.FirstChild("CIDRIP");
     if(!cIDRIPNode.IsNull())
     {
-      m_cIDRIP = StringUtils::Trim(cIDRIPNode.GetText().c_str());
+      m_cIDRIP = cIDRIPNode.GetTextView().Trim().ToString();
       m_cIDRIPHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void IPRange::OutputToStream(Aws::OStream& oStream, const char* location, unsign
 {
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_cIDRIPHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CIDRIP=" << StringUtils::URLEncode(m_cIDRIP.c_str()) << "&";
+      oStream << location << index << locationValue << ".CIDRIP=" << StringUtils::URLEncoded(m_cIDRIP) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void IPRange::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_cIDRIPHasBeenSet)
   {
-      oStream << location << ".CIDRIP=" << StringUtils::URLEncode(m_cIDRIP.c_str()) << "&";
+      oStream << location << ".CIDRIP=" << StringUtils::URLEncoded(m_cIDRIP) << "&";
   }
 }
 
@@ -15,6 +15,7 @@
 #include <aws/rds/model/ListTagsForResourceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ ListTagsForResourceRequest::ListTagsForResourceRequest() :
 
 Aws::String ListTagsForResourceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListTagsForResource&";
   if(m_resourceNameHasBeenSet)
   {
-    ss << "ResourceName=" << StringUtils::URLEncode(m_resourceName.c_str()) << "&";
+    ss << "ResourceName=" << StringUtils::URLEncoded(m_resourceName) << "&";
   }
 
   if(m_filtersHasBeenSet)
@@ -45,6 +46,6 @@ Aws::String ListTagsForResourceRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
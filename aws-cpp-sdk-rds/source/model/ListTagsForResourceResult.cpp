@@ -40,7 +40,7 @@ ListTagsForResourceResult& ListTagsForResourceResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListTagsForResourceResult")
+  if (rootNode.GetNameView() != "ListTagsForResourceResult")
   {
     resultNode = rootNode.FirstChild("ListTagsForResourceResult");
   }
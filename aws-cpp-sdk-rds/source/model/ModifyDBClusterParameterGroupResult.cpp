@@ -40,7 +40,7 @@ ModifyDBClusterParameterGroupResult& ModifyDBClusterParameterGroupResult::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyDBClusterParameterGroupResult")
+  if (rootNode.GetNameView() != "ModifyDBClusterParameterGroupResult")
   {
     resultNode = rootNode.FirstChild("ModifyDBClusterParameterGroupResult");
   }
@@ -50,7 +50,7 @@ ModifyDBClusterParameterGroupResult& ModifyDBClusterParameterGroupResult::operat
     XmlNode dBClusterParameterGroupNameNode = resultNode.FirstChild("DBClusterParameterGroupName");
     if(!dBClusterParameterGroupNameNode.IsNull())
     {
-      m_dBClusterParameterGroupName = StringUtils::Trim(dBClusterParameterGroupNameNode.GetText().c_str());
+      m_dBClusterParameterGroupName = dBClusterParameterGroupNameNode.GetTextView().Trim().ToString();
     }
   }
 
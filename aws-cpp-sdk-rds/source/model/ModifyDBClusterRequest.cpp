@@ -15,6 +15,7 @@
 #include <aws/rds/model/ModifyDBClusterRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -39,16 +40,16 @@ ModifyDBClusterRequest::ModifyDBClusterRequest() :
 
 Aws::String ModifyDBClusterRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyDBCluster&";
   if(m_dBClusterIdentifierHasBeenSet)
   {
-    ss << "DBClusterIdentifier=" << StringUtils::URLEncode(m_dBClusterIdentifier.c_str()) << "&";
+    ss << "DBClusterIdentifier=" << StringUtils::URLEncoded(m_dBClusterIdentifier) << "&";
   }
 
   if(m_newDBClusterIdentifierHasBeenSet)
   {
-    ss << "NewDBClusterIdentifier=" << StringUtils::URLEncode(m_newDBClusterIdentifier.c_str()) << "&";
+    ss << "NewDBClusterIdentifier=" << StringUtils::URLEncoded(m_newDBClusterIdentifier) << "&";
   }
 
   if(m_applyImmediatelyHasBeenSet)
@@ -63,7 +64,7 @@ Aws::String ModifyDBClusterRequest::SerializePayload() const
 
   if(m_dBClusterParameterGroupNameHasBeenSet)
   {
-    ss << "DBClusterParameterGroupName=" << StringUtils::URLEncode(m_dBClusterParameterGroupName.c_str()) << "&";
+    ss << "DBClusterParameterGroupName=" << StringUtils::URLEncoded(m_dBClusterParameterGroupName) << "&";
   }
 
   if(m_vpcSecurityGroupIdsHasBeenSet)
@@ -72,7 +73,7 @@ Aws::String ModifyDBClusterRequest::SerializePayload() const
     for(auto& item : m_vpcSecurityGroupIds)
     {
       ss << "VpcSecurityGroupIds.member." << vpcSecurityGroupIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       vpcSecurityGroupIdsCount++;
     }
   }
@@ -84,25 +85,25 @@ Aws::String ModifyDBClusterRequest::SerializePayload() const
 
   if(m_masterUserPasswordHasBeenSet)
   {
-    ss << "MasterUserPassword=" << StringUtils::URLEncode(m_masterUserPassword.c_str()) << "&";
+    ss << "MasterUserPassword=" << StringUtils::URLEncoded(m_masterUserPassword) << "&";
   }
 
   if(m_optionGroupNameHasBeenSet)
   {
-    ss << "OptionGroupName=" << StringUtils::URLEncode(m_optionGroupName.c_str()) << "&";
+    ss << "OptionGroupName=" << StringUtils::URLEncoded(m_optionGroupName) << "&";
   }
 
   if(m_preferredBackupWindowHasBeenSet)
   {
-    ss << "PreferredBackupWindow=" << StringUtils::URLEncode(m_preferredBackupWindow.c_str()) << "&";
+    ss << "PreferredBackupWindow=" << StringUtils::URLEncoded(m_preferredBackupWindow) << "&";
   }
 
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ModifyDBClusterResult& ModifyDBClusterResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyDBClusterResult")
+  if (rootNode.GetNameView() != "ModifyDBClusterResult")
   {
     resultNode = rootNode.FirstChild("ModifyDBClusterResult");
   }
@@ -40,7 +40,7 @@ ModifyDBClusterSnapshotAttributeResult& ModifyDBClusterSnapshotAttributeResult::
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyDBClusterSnapshotAttributeResult")
+  if (rootNode.GetNameView() != "ModifyDBClusterSnapshotAttributeResult")
   {
     resultNode = rootNode.FirstChild("ModifyDBClusterSnapshotAttributeResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/rds/model/ModifyDBInstanceRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -69,11 +70,11 @@ ModifyDBInstanceRequest::ModifyDBInstanceRequest() :
 
 Aws::String ModifyDBInstanceRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyDBInstance&";
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-    ss << "DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+    ss << "DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
 
   if(m_allocatedStorageHasBeenSet)
@@ -83,12 +84,12 @@ Aws::String ModifyDBInstanceRequest::SerializePayload() const
 
   if(m_dBInstanceClassHasBeenSet)
   {
-    ss << "DBInstanceClass=" << StringUtils::URLEncode(m_dBInstanceClass.c_str()) << "&";
+    ss << "DBInstanceClass=" << StringUtils::URLEncoded(m_dBInstanceClass) << "&";
   }
 
   if(m_dBSubnetGroupNameHasBeenSet)
   {
-    ss << "DBSubnetGroupName=" << StringUtils::URLEncode(m_dBSubnetGroupName.c_str()) << "&";
+    ss << "DBSubnetGroupName=" << StringUtils::URLEncoded(m_dBSubnetGroupName) << "&";
   }
 
   if(m_dBSecurityGroupsHasBeenSet)
@@ -97,7 +98,7 @@ Aws::String ModifyDBInstanceRequest::SerializePayload() const
     for(auto& item : m_dBSecurityGroups)
     {
       ss << "DBSecurityGroups.member." << dBSecurityGroupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       dBSecurityGroupsCount++;
     }
   }
@@ -108,7 +109,7 @@ Aws::String ModifyDBInstanceRequest::SerializePayload() const
     for(auto& item : m_vpcSecurityGroupIds)
     {
       ss << "VpcSecurityGroupIds.member." << vpcSecurityGroupIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       vpcSecurityGroupIdsCount++;
     }
   }
@@ -120,12 +121,12 @@ Aws::String ModifyDBInstanceRequest::SerializePayload() const
 
   if(m_masterUserPasswordHasBeenSet)
   {
-    ss << "MasterUserPassword=" << StringUtils::URLEncode(m_masterUserPassword.c_str()) << "&";
+    ss << "MasterUserPassword=" << StringUtils::URLEncoded(m_masterUserPassword) << "&";
   }
 
   if(m_dBParameterGroupNameHasBeenSet)
   {
-    ss << "DBParameterGroupName=" << StringUtils::URLEncode(m_dBParameterGroupName.c_str()) << "&";
+    ss << "DBParameterGroupName=" << StringUtils::URLEncoded(m_dBParameterGroupName) << "&";
   }
 
   if(m_backupRetentionPeriodHasBeenSet)
@@ -135,12 +136,12 @@ Aws::String ModifyDBInstanceRequest::SerializePayload() const
 
   if(m_preferredBackupWindowHasBeenSet)
   {
-    ss << "PreferredBackupWindow=" << StringUtils::URLEncode(m_preferredBackupWindow.c_str()) << "&";
+    ss << "PreferredBackupWindow=" << StringUtils::URLEncoded(m_preferredBackupWindow) << "&";
   }
 
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
 
   if(m_multiAZHasBeenSet)
@@ -150,7 +151,7 @@ Aws::String ModifyDBInstanceRequest::SerializePayload() const
 
   if(m_engineVersionHasBeenSet)
   {
-    ss << "EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+    ss << "EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_allowMajorVersionUpgradeHasBeenSet)
@@ -165,7 +166,7 @@ Aws::String ModifyDBInstanceRequest::SerializePayload() const
 
   if(m_licenseModelHasBeenSet)
   {
-    ss << "LicenseModel=" << StringUtils::URLEncode(m_licenseModel.c_str()) << "&";
+    ss << "LicenseModel=" << StringUtils::URLEncoded(m_licenseModel) << "&";
   }
 
   if(m_iopsHasBeenSet)
@@ -175,37 +176,37 @@ Aws::String ModifyDBInstanceRequest::SerializePayload() const
 
   if(m_optionGroupNameHasBeenSet)
   {
-    ss << "OptionGroupName=" << StringUtils::URLEncode(m_optionGroupName.c_str()) << "&";
+    ss << "OptionGroupName=" << StringUtils::URLEncoded(m_optionGroupName) << "&";
   }
 
   if(m_newDBInstanceIdentifierHasBeenSet)
   {
-    ss << "NewDBInstanceIdentifier=" << StringUtils::URLEncode(m_newDBInstanceIdentifier.c_str()) << "&";
+    ss << "NewDBInstanceIdentifier=" << StringUtils::URLEncoded(m_newDBInstanceIdentifier) << "&";
   }
 
   if(m_storageTypeHasBeenSet)
   {
-    ss << "StorageType=" << StringUtils::URLEncode(m_storageType.c_str()) << "&";
+    ss << "StorageType=" << StringUtils::URLEncoded(m_storageType) << "&";
   }
 
   if(m_tdeCredentialArnHasBeenSet)
   {
-    ss << "TdeCredentialArn=" << StringUtils::URLEncode(m_tdeCredentialArn.c_str()) << "&";
+    ss << "TdeCredentialArn=" << StringUtils::URLEncoded(m_tdeCredentialArn) << "&";
   }
 
   if(m_tdeCredentialPasswordHasBeenSet)
   {
-    ss << "TdeCredentialPassword=" << StringUtils::URLEncode(m_tdeCredentialPassword.c_str()) << "&";
+    ss << "TdeCredentialPassword=" << StringUtils::URLEncoded(m_tdeCredentialPassword) << "&";
   }
 
   if(m_cACertificateIdentifierHasBeenSet)
   {
-    ss << "CACertificateIdentifier=" << StringUtils::URLEncode(m_cACertificateIdentifier.c_str()) << "&";
+    ss << "CACertificateIdentifier=" << StringUtils::URLEncoded(m_cACertificateIdentifier) << "&";
   }
 
   if(m_domainHasBeenSet)
   {
-    ss << "Domain=" << StringUtils::URLEncode(m_domain.c_str()) << "&";
+    ss << "Domain=" << StringUtils::URLEncoded(m_domain) << "&";
   }
 
   if(m_copyTagsToSnapshotHasBeenSet)
@@ -230,12 +231,12 @@ Aws::String ModifyDBInstanceRequest::SerializePayload() const
 
   if(m_monitoringRoleArnHasBeenSet)
   {
-    ss << "MonitoringRoleArn=" << StringUtils::URLEncode(m_monitoringRoleArn.c_str()) << "&";
+    ss << "MonitoringRoleArn=" << StringUtils::URLEncoded(m_monitoringRoleArn) << "&";
   }
 
   if(m_domainIAMRoleNameHasBeenSet)
   {
-    ss << "DomainIAMRoleName=" << StringUtils::URLEncode(m_domainIAMRoleName.c_str()) << "&";
+    ss << "DomainIAMRoleName=" << StringUtils::URLEncoded(m_domainIAMRoleName) << "&";
   }
 
   if(m_promotionTierHasBeenSet)
@@ -244,6 +245,6 @@ Aws::String ModifyDBInstanceRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ModifyDBInstanceResult& ModifyDBInstanceResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyDBInstanceResult")
+  if (rootNode.GetNameView() != "ModifyDBInstanceResult")
   {
     resultNode = rootNode.FirstChild("ModifyDBInstanceResult");
   }
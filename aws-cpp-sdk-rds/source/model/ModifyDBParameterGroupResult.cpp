@@ -40,7 +40,7 @@ ModifyDBParameterGroupResult& ModifyDBParameterGroupResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyDBParameterGroupResult")
+  if (rootNode.GetNameView() != "ModifyDBParameterGroupResult")
   {
     resultNode = rootNode.FirstChild("ModifyDBParameterGroupResult");
   }
@@ -50,7 +50,7 @@ ModifyDBParameterGroupResult& ModifyDBParameterGroupResult::operator =(const Ama
     XmlNode dBParameterGroupNameNode = resultNode.FirstChild("DBParameterGroupName");
     if(!dBParameterGroupNameNode.IsNull())
     {
-      m_dBParameterGroupName = StringUtils::Trim(dBParameterGroupNameNode.GetText().c_str());
+      m_dBParameterGroupName = dBParameterGroupNameNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/rds/model/ModifyDBSnapshotAttributeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ ModifyDBSnapshotAttributeRequest::ModifyDBSnapshotAttributeRequest() :
 
 Aws::String ModifyDBSnapshotAttributeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyDBSnapshotAttribute&";
   if(m_dBSnapshotIdentifierHasBeenSet)
   {
-    ss << "DBSnapshotIdentifier=" << StringUtils::URLEncode(m_dBSnapshotIdentifier.c_str()) << "&";
+    ss << "DBSnapshotIdentifier=" << StringUtils::URLEncoded(m_dBSnapshotIdentifier) << "&";
   }
 
   if(m_attributeNameHasBeenSet)
   {
-    ss << "AttributeName=" << StringUtils::URLEncode(m_attributeName.c_str()) << "&";
+    ss << "AttributeName=" << StringUtils::URLEncoded(m_attributeName) << "&";
   }
 
   if(m_valuesToAddHasBeenSet)
@@ -47,7 +48,7 @@ Aws::String ModifyDBSnapshotAttributeRequest::SerializePayload() const
     for(auto& item : m_valuesToAdd)
     {
       ss << "ValuesToAdd.member." << valuesToAddCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       valuesToAddCount++;
     }
   }
@@ -58,12 +59,12 @@ Aws::String ModifyDBSnapshotAttributeRequest::SerializePayload() const
     for(auto& item : m_valuesToRemove)
     {
       ss << "ValuesToRemove.member." << valuesToRemoveCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       valuesToRemoveCount++;
     }
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ModifyDBSnapshotAttributeResult& ModifyDBSnapshotAttributeResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyDBSnapshotAttributeResult")
+  if (rootNode.GetNameView() != "ModifyDBSnapshotAttributeResult")
   {
     resultNode = rootNode.FirstChild("ModifyDBSnapshotAttributeResult");
   }
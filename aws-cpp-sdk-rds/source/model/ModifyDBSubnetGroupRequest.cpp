@@ -15,6 +15,7 @@
 #include <aws/rds/model/ModifyDBSubnetGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ ModifyDBSubnetGroupRequest::ModifyDBSubnetGroupRequest() :
 
 Aws::String ModifyDBSubnetGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyDBSubnetGroup&";
   if(m_dBSubnetGroupNameHasBeenSet)
   {
-    ss << "DBSubnetGroupName=" << StringUtils::URLEncode(m_dBSubnetGroupName.c_str()) << "&";
+    ss << "DBSubnetGroupName=" << StringUtils::URLEncoded(m_dBSubnetGroupName) << "&";
   }
 
   if(m_dBSubnetGroupDescriptionHasBeenSet)
   {
-    ss << "DBSubnetGroupDescription=" << StringUtils::URLEncode(m_dBSubnetGroupDescription.c_str()) << "&";
+    ss << "DBSubnetGroupDescription=" << StringUtils::URLEncoded(m_dBSubnetGroupDescription) << "&";
   }
 
   if(m_subnetIdsHasBeenSet)
@@ -46,12 +47,12 @@ Aws::String ModifyDBSubnetGroupRequest::SerializePayload() const
     for(auto& item : m_subnetIds)
     {
       ss << "SubnetIds.member." << subnetIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       subnetIdsCount++;
     }
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ModifyDBSubnetGroupResult& ModifyDBSubnetGroupResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyDBSubnetGroupResult")
+  if (rootNode.GetNameView() != "ModifyDBSubnetGroupResult")
   {
     resultNode = rootNode.FirstChild("ModifyDBSubnetGroupResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/rds/model/ModifyEventSubscriptionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -31,21 +32,21 @@ ModifyEventSubscriptionRequest::ModifyEventSubscriptionRequest() :
 
 Aws::String ModifyEventSubscriptionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyEventSubscription&";
   if(m_subscriptionNameHasBeenSet)
   {
-    ss << "SubscriptionName=" << StringUtils::URLEncode(m_subscriptionName.c_str()) << "&";
+    ss << "SubscriptionName=" << StringUtils::URLEncoded(m_subscriptionName) << "&";
   }
 
   if(m_snsTopicArnHasBeenSet)
   {
-    ss << "SnsTopicArn=" << StringUtils::URLEncode(m_snsTopicArn.c_str()) << "&";
+    ss << "SnsTopicArn=" << StringUtils::URLEncoded(m_snsTopicArn) << "&";
   }
 
   if(m_sourceTypeHasBeenSet)
   {
-    ss << "SourceType=" << StringUtils::URLEncode(m_sourceType.c_str()) << "&";
+    ss << "SourceType=" << StringUtils::URLEncoded(m_sourceType) << "&";
   }
 
   if(m_eventCategoriesHasBeenSet)
@@ -54,7 +55,7 @@ Aws::String ModifyEventSubscriptionRequest::SerializePayload() const
     for(auto& item : m_eventCategories)
     {
       ss << "EventCategories.member." << eventCategoriesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       eventCategoriesCount++;
     }
   }
@@ -65,6 +66,6 @@ Aws::String ModifyEventSubscriptionRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ModifyEventSubscriptionResult& ModifyEventSubscriptionResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyEventSubscriptionResult")
+  if (rootNode.GetNameView() != "ModifyEventSubscriptionResult")
   {
     resultNode = rootNode.FirstChild("ModifyEventSubscriptionResult");
   }
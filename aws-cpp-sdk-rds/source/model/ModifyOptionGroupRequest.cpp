@@ -15,6 +15,7 @@
 #include <aws/rds/model/ModifyOptionGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -30,11 +31,11 @@ ModifyOptionGroupRequest::ModifyOptionGroupRequest() :
 
 Aws::String ModifyOptionGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyOptionGroup&";
   if(m_optionGroupNameHasBeenSet)
   {
-    ss << "OptionGroupName=" << StringUtils::URLEncode(m_optionGroupName.c_str()) << "&";
+    ss << "OptionGroupName=" << StringUtils::URLEncoded(m_optionGroupName) << "&";
   }
 
   if(m_optionsToIncludeHasBeenSet)
@@ -53,7 +54,7 @@ Aws::String ModifyOptionGroupRequest::SerializePayload() const
     for(auto& item : m_optionsToRemove)
     {
       ss << "OptionsToRemove.member." << optionsToRemoveCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       optionsToRemoveCount++;
     }
   }
@@ -64,6 +65,6 @@ Aws::String ModifyOptionGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
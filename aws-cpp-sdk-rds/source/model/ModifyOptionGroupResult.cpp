@@ -40,7 +40,7 @@ ModifyOptionGroupResult& ModifyOptionGroupResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyOptionGroupResult")
+  if (rootNode.GetNameView() != "ModifyOptionGroupResult")
   {
     resultNode = rootNode.FirstChild("ModifyOptionGroupResult");
   }
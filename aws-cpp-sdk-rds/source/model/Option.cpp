@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -71,37 +72,37 @@ Option& Option::operator =(const XmlNode& xmlNode)
     XmlNode optionNameNode = resultNode.FirstChild("OptionName");
     if(!optionNameNode.IsNull())
     {
-      m_optionName = StringUtils::Trim(optionNameNode.GetText().c_str());
+      m_optionName = optionNameNode.GetTextView().Trim().ToString();
       m_optionNameHasBeenSet = true;
     }
     XmlNode optionDescriptionNode = resultNode.FirstChild("OptionDescription");
     if(!optionDescriptionNode.IsNull())
     {
-      m_optionDescription = StringUtils::Trim(optionDescriptionNode.GetText().c_str());
+      m_optionDescription = optionDescriptionNode.GetTextView().Trim().ToString();
       m_optionDescriptionHasBeenSet = true;
     }
     XmlNode persistentNode = resultNode.FirstChild("Persistent");
     if(!persistentNode.IsNull())
     {
-      m_persistent = StringUtils::ConvertToBool(StringUtils::Trim(persistentNode.GetText().c_str()).c_str());
+      m_persistent = StringUtils::ConvertToBool(persistentNode.GetTextView().Trim().ToString().c_str());
       m_persistentHasBeenSet = true;
     }
     XmlNode permanentNode = resultNode.FirstChild("Permanent");
     if(!permanentNode.IsNull())
     {
-      m_permanent = StringUtils::ConvertToBool(StringUtils::Trim(permanentNode.GetText().c_str()).c_str());
+      m_permanent = StringUtils::ConvertToBool(permanentNode.GetTextView().Trim().ToString().c_str());
       m_permanentHasBeenSet = true;
     }
     XmlNode portNode = resultNode.FirstChild("Port");
     if(!portNode.IsNull())
     {
-      m_port = StringUtils::ConvertToInt32(StringUtils::Trim(portNode.GetText().c_str()).c_str());
+      m_port = StringUtils::ConvertToInt32(portNode.GetTextView().Trim().ToString().c_str());
       m_portHasBeenSet = true;
     }
     XmlNode optionVersionNode = resultNode.FirstChild("OptionVersion");
     if(!optionVersionNode.IsNull())
     {
-      m_optionVersion = StringUtils::Trim(optionVersionNode.GetText().c_str());
+      m_optionVersion = optionVersionNode.GetTextView().Trim().ToString();
       m_optionVersionHasBeenSet = true;
     }
     XmlNode optionSettingsNode = resultNode.FirstChild("OptionSettings");
@@ -149,12 +150,12 @@ void Option::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
 {
   if(m_optionNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OptionName=" << StringUtils::URLEncode(m_optionName.c_str()) << "&";
+      oStream << location << index << locationValue << ".OptionName=" << StringUtils::URLEncoded(m_optionName) << "&";
   }
 
   if(m_optionDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OptionDescription=" << StringUtils::URLEncode(m_optionDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".OptionDescription=" << StringUtils::URLEncoded(m_optionDescription) << "&";
   }
 
   if(m_persistentHasBeenSet)
@@ -174,7 +175,7 @@ void Option::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
 
   if(m_optionVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OptionVersion=" << StringUtils::URLEncode(m_optionVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".OptionVersion=" << StringUtils::URLEncoded(m_optionVersion) << "&";
   }
 
   if(m_optionSettingsHasBeenSet)
@@ -182,9 +183,9 @@ void Option::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
       unsigned optionSettingsIdx = 1;
       for(auto& item : m_optionSettings)
       {
-        Aws::StringStream optionSettingsSs;
+        Aws::Utils::Stream::StringOutputStream optionSettingsSs;
         optionSettingsSs << location << index << locationValue << ".OptionSetting." << optionSettingsIdx++;
-        item.OutputToStream(oStream, optionSettingsSs.str().c_str());
+        item.OutputToStream(oStream, optionSettingsSs.GetString().c_str());
       }
   }
 
@@ -193,9 +194,9 @@ void Option::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
       unsigned dBSecurityGroupMembershipsIdx = 1;
       for(auto& item : m_dBSecurityGroupMemberships)
       {
-        Aws::StringStream dBSecurityGroupMembershipsSs;
+        Aws::Utils::Stream::StringOutputStream dBSecurityGroupMembershipsSs;
         dBSecurityGroupMembershipsSs << location << index << locationValue << ".DBSecurityGroup." << dBSecurityGroupMembershipsIdx++;
-        item.OutputToStream(oStream, dBSecurityGroupMembershipsSs.str().c_str());
+        item.OutputToStream(oStream, dBSecurityGroupMembershipsSs.GetString().c_str());
       }
   }
 
@@ -204,9 +205,9 @@ void Option::OutputToStream(Aws::OStream& oStream, const char* location, unsigne
       unsigned vpcSecurityGroupMembershipsIdx = 1;
       for(auto& item : m_vpcSecurityGroupMemberships)
       {
-        Aws::StringStream vpcSecurityGroupMembershipsSs;
+        Aws::Utils::Stream::StringOutputStream vpcSecurityGroupMembershipsSs;
         vpcSecurityGroupMembershipsSs << location << index << locationValue << ".VpcSecurityGroupMembership." << vpcSecurityGroupMembershipsIdx++;
-        item.OutputToStream(oStream, vpcSecurityGroupMembershipsSs.str().c_str());
+        item.OutputToStream(oStream, vpcSecurityGroupMembershipsSs.GetString().c_str());
       }
   }
 
@@ -216,11 +217,11 @@ void Option::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_optionNameHasBeenSet)
   {
-      oStream << location << ".OptionName=" << StringUtils::URLEncode(m_optionName.c_str()) << "&";
+      oStream << location << ".OptionName=" << StringUtils::URLEncoded(m_optionName) << "&";
   }
   if(m_optionDescriptionHasBeenSet)
   {
-      oStream << location << ".OptionDescription=" << StringUtils::URLEncode(m_optionDescription.c_str()) << "&";
+      oStream << location << ".OptionDescription=" << StringUtils::URLEncoded(m_optionDescription) << "&";
   }
   if(m_persistentHasBeenSet)
   {
@@ -236,16 +237,16 @@ void Option::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_optionVersionHasBeenSet)
   {
-      oStream << location << ".OptionVersion=" << StringUtils::URLEncode(m_optionVersion.c_str()) << "&";
+      oStream << location << ".OptionVersion=" << StringUtils::URLEncoded(m_optionVersion) << "&";
   }
   if(m_optionSettingsHasBeenSet)
   {
       unsigned optionSettingsIdx = 1;
       for(auto& item : m_optionSettings)
       {
-        Aws::StringStream optionSettingsSs;
+        Aws::Utils::Stream::StringOutputStream optionSettingsSs;
         optionSettingsSs << location <<  ".OptionSetting." << optionSettingsIdx++;
-        item.OutputToStream(oStream, optionSettingsSs.str().c_str());
+        item.OutputToStream(oStream, optionSettingsSs.GetString().c_str());
       }
   }
   if(m_dBSecurityGroupMembershipsHasBeenSet)
@@ -253,9 +254,9 @@ void Option::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned dBSecurityGroupMembershipsIdx = 1;
       for(auto& item : m_dBSecurityGroupMemberships)
       {
-        Aws::StringStream dBSecurityGroupMembershipsSs;
+        Aws::Utils::Stream::StringOutputStream dBSecurityGroupMembershipsSs;
         dBSecurityGroupMembershipsSs << location <<  ".DBSecurityGroup." << dBSecurityGroupMembershipsIdx++;
-        item.OutputToStream(oStream, dBSecurityGroupMembershipsSs.str().c_str());
+        item.OutputToStream(oStream, dBSecurityGroupMembershipsSs.GetString().c_str());
       }
   }
   if(m_vpcSecurityGroupMembershipsHasBeenSet)
@@ -263,9 +264,9 @@ void Option::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned vpcSecurityGroupMembershipsIdx = 1;
       for(auto& item : m_vpcSecurityGroupMemberships)
       {
-        Aws::StringStream vpcSecurityGroupMembershipsSs;
+        Aws::Utils::Stream::StringOutputStream vpcSecurityGroupMembershipsSs;
         vpcSecurityGroupMembershipsSs << location <<  ".VpcSecurityGroupMembership." << vpcSecurityGroupMembershipsIdx++;
-        item.OutputToStream(oStream, vpcSecurityGroupMembershipsSs.str().c_str());
+        item.OutputToStream(oStream, vpcSecurityGroupMembershipsSs.GetString().c_str());
       }
   }
 }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,19 +62,19 @@ OptionConfiguration& OptionConfiguration::operator =(const XmlNode& xmlNode)
     XmlNode optionNameNode = resultNode.FirstChild("OptionName");
     if(!optionNameNode.IsNull())
     {
-      m_optionName = StringUtils::Trim(optionNameNode.GetText().c_str());
+      m_optionName = optionNameNode.GetTextView().Trim().ToString();
       m_optionNameHasBeenSet = true;
     }
     XmlNode portNode = resultNode.FirstChild("Port");
     if(!portNode.IsNull())
     {
-      m_port = StringUtils::ConvertToInt32(StringUtils::Trim(portNode.GetText().c_str()).c_str());
+      m_port = StringUtils::ConvertToInt32(portNode.GetTextView().Trim().ToString().c_str());
       m_portHasBeenSet = true;
     }
     XmlNode optionVersionNode = resultNode.FirstChild("OptionVersion");
     if(!optionVersionNode.IsNull())
     {
-      m_optionVersion = StringUtils::Trim(optionVersionNode.GetText().c_str());
+      m_optionVersion = optionVersionNode.GetTextView().Trim().ToString();
       m_optionVersionHasBeenSet = true;
     }
     XmlNode dBSecurityGroupMembershipsNode = resultNode.FirstChild("DBSecurityGroupMemberships");
@@ -82,7 +83,7 @@ OptionConfiguration& OptionConfiguration::operator =(const XmlNode& xmlNode)
       XmlNode dBSecurityGroupMembershipsMember = dBSecurityGroupMembershipsNode.FirstChild("DBSecurityGroupName");
       while(!dBSecurityGroupMembershipsMember.IsNull())
       {
-        m_dBSecurityGroupMemberships.push_back(StringUtils::Trim(dBSecurityGroupMembershipsMember.GetText().c_str()));
+        m_dBSecurityGroupMemberships.push_back(dBSecurityGroupMembershipsMember.GetTextView().Trim().ToString());
         dBSecurityGroupMembershipsMember = dBSecurityGroupMembershipsMember.NextNode("DBSecurityGroupName");
       }
 
@@ -94,7 +95,7 @@ OptionConfiguration& OptionConfiguration::operator =(const XmlNode& xmlNode)
       XmlNode vpcSecurityGroupMembershipsMember = vpcSecurityGroupMembershipsNode.FirstChild("VpcSecurityGroupId");
       while(!vpcSecurityGroupMembershipsMember.IsNull())
       {
-        m_vpcSecurityGroupMemberships.push_back(StringUtils::Trim(vpcSecurityGroupMembershipsMember.GetText().c_str()));
+        m_vpcSecurityGroupMemberships.push_back(vpcSecurityGroupMembershipsMember.GetTextView().Trim().ToString());
         vpcSecurityGroupMembershipsMember = vpcSecurityGroupMembershipsMember.NextNode("VpcSecurityGroupId");
       }
 
@@ -121,7 +122,7 @@ void OptionConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_optionNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OptionName=" << StringUtils::URLEncode(m_optionName.c_str()) << "&";
+      oStream << location << index << locationValue << ".OptionName=" << StringUtils::URLEncoded(m_optionName) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -131,7 +132,7 @@ void OptionConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
 
   if(m_optionVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OptionVersion=" << StringUtils::URLEncode(m_optionVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".OptionVersion=" << StringUtils::URLEncoded(m_optionVersion) << "&";
   }
 
   if(m_dBSecurityGroupMembershipsHasBeenSet)
@@ -139,7 +140,7 @@ void OptionConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned dBSecurityGroupMembershipsIdx = 1;
       for(auto& item : m_dBSecurityGroupMemberships)
       {
-        oStream << location << index << locationValue << ".DBSecurityGroupName." << dBSecurityGroupMembershipsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".DBSecurityGroupName." << dBSecurityGroupMembershipsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -148,7 +149,7 @@ void OptionConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned vpcSecurityGroupMembershipsIdx = 1;
       for(auto& item : m_vpcSecurityGroupMemberships)
       {
-        oStream << location << index << locationValue << ".VpcSecurityGroupId." << vpcSecurityGroupMembershipsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".VpcSecurityGroupId." << vpcSecurityGroupMembershipsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -157,9 +158,9 @@ void OptionConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned optionSettingsIdx = 1;
       for(auto& item : m_optionSettings)
       {
-        Aws::StringStream optionSettingsSs;
+        Aws::Utils::Stream::StringOutputStream optionSettingsSs;
         optionSettingsSs << location << index << locationValue << ".OptionSetting." << optionSettingsIdx++;
-        item.OutputToStream(oStream, optionSettingsSs.str().c_str());
+        item.OutputToStream(oStream, optionSettingsSs.GetString().c_str());
       }
   }
 
@@ -169,7 +170,7 @@ void OptionConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_optionNameHasBeenSet)
   {
-      oStream << location << ".OptionName=" << StringUtils::URLEncode(m_optionName.c_str()) << "&";
+      oStream << location << ".OptionName=" << StringUtils::URLEncoded(m_optionName) << "&";
   }
   if(m_portHasBeenSet)
   {
@@ -177,14 +178,14 @@ void OptionConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
   }
   if(m_optionVersionHasBeenSet)
   {
-      oStream << location << ".OptionVersion=" << StringUtils::URLEncode(m_optionVersion.c_str()) << "&";
+      oStream << location << ".OptionVersion=" << StringUtils::URLEncoded(m_optionVersion) << "&";
   }
   if(m_dBSecurityGroupMembershipsHasBeenSet)
   {
       unsigned dBSecurityGroupMembershipsIdx = 1;
       for(auto& item : m_dBSecurityGroupMemberships)
       {
-        oStream << location << ".DBSecurityGroupName." << dBSecurityGroupMembershipsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".DBSecurityGroupName." << dBSecurityGroupMembershipsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_vpcSecurityGroupMembershipsHasBeenSet)
@@ -192,7 +193,7 @@ void OptionConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned vpcSecurityGroupMembershipsIdx = 1;
       for(auto& item : m_vpcSecurityGroupMemberships)
       {
-        oStream << location << ".VpcSecurityGroupId." << vpcSecurityGroupMembershipsIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".VpcSecurityGroupId." << vpcSecurityGroupMembershipsIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_optionSettingsHasBeenSet)
@@ -200,9 +201,9 @@ void OptionConfiguration::OutputToStream(Aws::OStream& oStream, const char* loca
       unsigned optionSettingsIdx = 1;
       for(auto& item : m_optionSettings)
       {
-        Aws::StringStream optionSettingsSs;
+        Aws::Utils::Stream::StringOutputStream optionSettingsSs;
         optionSettingsSs << location <<  ".OptionSetting." << optionSettingsIdx++;
-        item.OutputToStream(oStream, optionSettingsSs.str().c_str());
+        item.OutputToStream(oStream, optionSettingsSs.GetString().c_str());
       }
   }
 }
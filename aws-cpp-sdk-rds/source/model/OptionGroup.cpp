@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -65,25 +66,25 @@ OptionGroup& OptionGroup::operator =(const XmlNode& xmlNode)
     XmlNode optionGroupNameNode = resultNode.FirstChild("OptionGroupName");
     if(!optionGroupNameNode.IsNull())
     {
-      m_optionGroupName = StringUtils::Trim(optionGroupNameNode.GetText().c_str());
+      m_optionGroupName = optionGroupNameNode.GetTextView().Trim().ToString();
       m_optionGroupNameHasBeenSet = true;
     }
     XmlNode optionGroupDescriptionNode = resultNode.FirstChild("OptionGroupDescription");
     if(!optionGroupDescriptionNode.IsNull())
     {
-      m_optionGroupDescription = StringUtils::Trim(optionGroupDescriptionNode.GetText().c_str());
+      m_optionGroupDescription = optionGroupDescriptionNode.GetTextView().Trim().ToString();
       m_optionGroupDescriptionHasBeenSet = true;
     }
     XmlNode engineNameNode = resultNode.FirstChild("EngineName");
     if(!engineNameNode.IsNull())
     {
-      m_engineName = StringUtils::Trim(engineNameNode.GetText().c_str());
+      m_engineName = engineNameNode.GetTextView().Trim().ToString();
       m_engineNameHasBeenSet = true;
     }
     XmlNode majorEngineVersionNode = resultNode.FirstChild("MajorEngineVersion");
     if(!majorEngineVersionNode.IsNull())
     {
-      m_majorEngineVersion = StringUtils::Trim(majorEngineVersionNode.GetText().c_str());
+      m_majorEngineVersion = majorEngineVersionNode.GetTextView().Trim().ToString();
       m_majorEngineVersionHasBeenSet = true;
     }
     XmlNode optionsNode = resultNode.FirstChild("Options");
@@ -101,19 +102,19 @@ OptionGroup& OptionGroup::operator =(const XmlNode& xmlNode)
     XmlNode allowsVpcAndNonVpcInstanceMembershipsNode = resultNode.FirstChild("AllowsVpcAndNonVpcInstanceMemberships");
     if(!allowsVpcAndNonVpcInstanceMembershipsNode.IsNull())
     {
-      m_allowsVpcAndNonVpcInstanceMemberships = StringUtils::ConvertToBool(StringUtils::Trim(allowsVpcAndNonVpcInstanceMembershipsNode.GetText().c_str()).c_str());
+      m_allowsVpcAndNonVpcInstanceMemberships = StringUtils::ConvertToBool(allowsVpcAndNonVpcInstanceMembershipsNode.GetTextView().Trim().ToString().c_str());
       m_allowsVpcAndNonVpcInstanceMembershipsHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("VpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode optionGroupArnNode = resultNode.FirstChild("OptionGroupArn");
     if(!optionGroupArnNode.IsNull())
     {
-      m_optionGroupArn = StringUtils::Trim(optionGroupArnNode.GetText().c_str());
+      m_optionGroupArn = optionGroupArnNode.GetTextView().Trim().ToString();
       m_optionGroupArnHasBeenSet = true;
     }
   }
@@ -125,22 +126,22 @@ void OptionGroup::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_optionGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OptionGroupName=" << StringUtils::URLEncode(m_optionGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".OptionGroupName=" << StringUtils::URLEncoded(m_optionGroupName) << "&";
   }
 
   if(m_optionGroupDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OptionGroupDescription=" << StringUtils::URLEncode(m_optionGroupDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".OptionGroupDescription=" << StringUtils::URLEncoded(m_optionGroupDescription) << "&";
   }
 
   if(m_engineNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EngineName=" << StringUtils::URLEncode(m_engineName.c_str()) << "&";
+      oStream << location << index << locationValue << ".EngineName=" << StringUtils::URLEncoded(m_engineName) << "&";
   }
 
   if(m_majorEngineVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MajorEngineVersion=" << StringUtils::URLEncode(m_majorEngineVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".MajorEngineVersion=" << StringUtils::URLEncoded(m_majorEngineVersion) << "&";
   }
 
   if(m_optionsHasBeenSet)
@@ -148,9 +149,9 @@ void OptionGroup::OutputToStream(Aws::OStream& oStream, const char* location, un
       unsigned optionsIdx = 1;
       for(auto& item : m_options)
       {
-        Aws::StringStream optionsSs;
+        Aws::Utils::Stream::StringOutputStream optionsSs;
         optionsSs << location << index << locationValue << ".Option." << optionsIdx++;
-        item.OutputToStream(oStream, optionsSs.str().c_str());
+        item.OutputToStream(oStream, optionsSs.GetString().c_str());
       }
   }
 
@@ -161,12 +162,12 @@ void OptionGroup::OutputToStream(Aws::OStream& oStream, const char* location, un
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_optionGroupArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OptionGroupArn=" << StringUtils::URLEncode(m_optionGroupArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".OptionGroupArn=" << StringUtils::URLEncoded(m_optionGroupArn) << "&";
   }
 
 }
@@ -175,28 +176,28 @@ void OptionGroup::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_optionGroupNameHasBeenSet)
   {
-      oStream << location << ".OptionGroupName=" << StringUtils::URLEncode(m_optionGroupName.c_str()) << "&";
+      oStream << location << ".OptionGroupName=" << StringUtils::URLEncoded(m_optionGroupName) << "&";
   }
   if(m_optionGroupDescriptionHasBeenSet)
   {
-      oStream << location << ".OptionGroupDescription=" << StringUtils::URLEncode(m_optionGroupDescription.c_str()) << "&";
+      oStream << location << ".OptionGroupDescription=" << StringUtils::URLEncoded(m_optionGroupDescription) << "&";
   }
   if(m_engineNameHasBeenSet)
   {
-      oStream << location << ".EngineName=" << StringUtils::URLEncode(m_engineName.c_str()) << "&";
+      oStream << location << ".EngineName=" << StringUtils::URLEncoded(m_engineName) << "&";
   }
   if(m_majorEngineVersionHasBeenSet)
   {
-      oStream << location << ".MajorEngineVersion=" << StringUtils::URLEncode(m_majorEngineVersion.c_str()) << "&";
+      oStream << location << ".MajorEngineVersion=" << StringUtils::URLEncoded(m_majorEngineVersion) << "&";
   }
   if(m_optionsHasBeenSet)
   {
       unsigned optionsIdx = 1;
       for(auto& item : m_options)
       {
-        Aws::StringStream optionsSs;
+        Aws::Utils::Stream::StringOutputStream optionsSs;
         optionsSs << location <<  ".Option." << optionsIdx++;
-        item.OutputToStream(oStream, optionsSs.str().c_str());
+        item.OutputToStream(oStream, optionsSs.GetString().c_str());
       }
   }
   if(m_allowsVpcAndNonVpcInstanceMembershipsHasBeenSet)
@@ -205,11 +206,11 @@ void OptionGroup::OutputToStream(Aws::OStream& oStream, const char* location) co
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_optionGroupArnHasBeenSet)
   {
-      oStream << location << ".OptionGroupArn=" << StringUtils::URLEncode(m_optionGroupArn.c_str()) << "&";
+      oStream << location << ".OptionGroupArn=" << StringUtils::URLEncoded(m_optionGroupArn) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -79,43 +80,43 @@ OptionGroupOption& OptionGroupOption::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode engineNameNode = resultNode.FirstChild("EngineName");
     if(!engineNameNode.IsNull())
     {
-      m_engineName = StringUtils::Trim(engineNameNode.GetText().c_str());
+      m_engineName = engineNameNode.GetTextView().Trim().ToString();
       m_engineNameHasBeenSet = true;
     }
     XmlNode majorEngineVersionNode = resultNode.FirstChild("MajorEngineVersion");
     if(!majorEngineVersionNode.IsNull())
     {
-      m_majorEngineVersion = StringUtils::Trim(majorEngineVersionNode.GetText().c_str());
+      m_majorEngineVersion = majorEngineVersionNode.GetTextView().Trim().ToString();
       m_majorEngineVersionHasBeenSet = true;
     }
     XmlNode minimumRequiredMinorEngineVersionNode = resultNode.FirstChild("MinimumRequiredMinorEngineVersion");
     if(!minimumRequiredMinorEngineVersionNode.IsNull())
     {
-      m_minimumRequiredMinorEngineVersion = StringUtils::Trim(minimumRequiredMinorEngineVersionNode.GetText().c_str());
+      m_minimumRequiredMinorEngineVersion = minimumRequiredMinorEngineVersionNode.GetTextView().Trim().ToString();
       m_minimumRequiredMinorEngineVersionHasBeenSet = true;
     }
     XmlNode portRequiredNode = resultNode.FirstChild("PortRequired");
     if(!portRequiredNode.IsNull())
     {
-      m_portRequired = StringUtils::ConvertToBool(StringUtils::Trim(portRequiredNode.GetText().c_str()).c_str());
+      m_portRequired = StringUtils::ConvertToBool(portRequiredNode.GetTextView().Trim().ToString().c_str());
       m_portRequiredHasBeenSet = true;
     }
     XmlNode defaultPortNode = resultNode.FirstChild("DefaultPort");
     if(!defaultPortNode.IsNull())
     {
-      m_defaultPort = StringUtils::ConvertToInt32(StringUtils::Trim(defaultPortNode.GetText().c_str()).c_str());
+      m_defaultPort = StringUtils::ConvertToInt32(defaultPortNode.GetTextView().Trim().ToString().c_str());
       m_defaultPortHasBeenSet = true;
     }
     XmlNode optionsDependedOnNode = resultNode.FirstChild("OptionsDependedOn");
@@ -124,7 +125,7 @@ OptionGroupOption& OptionGroupOption::operator =(const XmlNode& xmlNode)
       XmlNode optionsDependedOnMember = optionsDependedOnNode.FirstChild("OptionName");
       while(!optionsDependedOnMember.IsNull())
       {
-        m_optionsDependedOn.push_back(StringUtils::Trim(optionsDependedOnMember.GetText().c_str()));
+        m_optionsDependedOn.push_back(optionsDependedOnMember.GetTextView().Trim().ToString());
         optionsDependedOnMember = optionsDependedOnMember.NextNode("OptionName");
       }
 
@@ -133,13 +134,13 @@ OptionGroupOption& OptionGroupOption::operator =(const XmlNode& xmlNode)
     XmlNode persistentNode = resultNode.FirstChild("Persistent");
     if(!persistentNode.IsNull())
     {
-      m_persistent = StringUtils::ConvertToBool(StringUtils::Trim(persistentNode.GetText().c_str()).c_str());
+      m_persistent = StringUtils::ConvertToBool(persistentNode.GetTextView().Trim().ToString().c_str());
       m_persistentHasBeenSet = true;
     }
     XmlNode permanentNode = resultNode.FirstChild("Permanent");
     if(!permanentNode.IsNull())
     {
-      m_permanent = StringUtils::ConvertToBool(StringUtils::Trim(permanentNode.GetText().c_str()).c_str());
+      m_permanent = StringUtils::ConvertToBool(permanentNode.GetTextView().Trim().ToString().c_str());
       m_permanentHasBeenSet = true;
     }
     XmlNode optionGroupOptionSettingsNode = resultNode.FirstChild("OptionGroupOptionSettings");
@@ -175,27 +176,27 @@ void OptionGroupOption::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_engineNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EngineName=" << StringUtils::URLEncode(m_engineName.c_str()) << "&";
+      oStream << location << index << locationValue << ".EngineName=" << StringUtils::URLEncoded(m_engineName) << "&";
   }
 
   if(m_majorEngineVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MajorEngineVersion=" << StringUtils::URLEncode(m_majorEngineVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".MajorEngineVersion=" << StringUtils::URLEncoded(m_majorEngineVersion) << "&";
   }
 
   if(m_minimumRequiredMinorEngineVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MinimumRequiredMinorEngineVersion=" << StringUtils::URLEncode(m_minimumRequiredMinorEngineVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".MinimumRequiredMinorEngineVersion=" << StringUtils::URLEncoded(m_minimumRequiredMinorEngineVersion) << "&";
   }
 
   if(m_portRequiredHasBeenSet)
@@ -213,7 +214,7 @@ void OptionGroupOption::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned optionsDependedOnIdx = 1;
       for(auto& item : m_optionsDependedOn)
       {
-        oStream << location << index << locationValue << ".OptionName." << optionsDependedOnIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".OptionName." << optionsDependedOnIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -232,9 +233,9 @@ void OptionGroupOption::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned optionGroupOptionSettingsIdx = 1;
       for(auto& item : m_optionGroupOptionSettings)
       {
-        Aws::StringStream optionGroupOptionSettingsSs;
+        Aws::Utils::Stream::StringOutputStream optionGroupOptionSettingsSs;
         optionGroupOptionSettingsSs << location << index << locationValue << ".OptionGroupOptionSetting." << optionGroupOptionSettingsIdx++;
-        item.OutputToStream(oStream, optionGroupOptionSettingsSs.str().c_str());
+        item.OutputToStream(oStream, optionGroupOptionSettingsSs.GetString().c_str());
       }
   }
 
@@ -243,9 +244,9 @@ void OptionGroupOption::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned optionGroupOptionVersionsIdx = 1;
       for(auto& item : m_optionGroupOptionVersions)
       {
-        Aws::StringStream optionGroupOptionVersionsSs;
+        Aws::Utils::Stream::StringOutputStream optionGroupOptionVersionsSs;
         optionGroupOptionVersionsSs << location << index << locationValue << ".OptionVersion." << optionGroupOptionVersionsIdx++;
-        item.OutputToStream(oStream, optionGroupOptionVersionsSs.str().c_str());
+        item.OutputToStream(oStream, optionGroupOptionVersionsSs.GetString().c_str());
       }
   }
 
@@ -255,23 +256,23 @@ void OptionGroupOption::OutputToStream(Aws::OStream& oStream, const char* locati
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_engineNameHasBeenSet)
   {
-      oStream << location << ".EngineName=" << StringUtils::URLEncode(m_engineName.c_str()) << "&";
+      oStream << location << ".EngineName=" << StringUtils::URLEncoded(m_engineName) << "&";
   }
   if(m_majorEngineVersionHasBeenSet)
   {
-      oStream << location << ".MajorEngineVersion=" << StringUtils::URLEncode(m_majorEngineVersion.c_str()) << "&";
+      oStream << location << ".MajorEngineVersion=" << StringUtils::URLEncoded(m_majorEngineVersion) << "&";
   }
   if(m_minimumRequiredMinorEngineVersionHasBeenSet)
   {
-      oStream << location << ".MinimumRequiredMinorEngineVersion=" << StringUtils::URLEncode(m_minimumRequiredMinorEngineVersion.c_str()) << "&";
+      oStream << location << ".MinimumRequiredMinorEngineVersion=" << StringUtils::URLEncoded(m_minimumRequiredMinorEngineVersion) << "&";
   }
   if(m_portRequiredHasBeenSet)
   {
@@ -286,7 +287,7 @@ void OptionGroupOption::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned optionsDependedOnIdx = 1;
       for(auto& item : m_optionsDependedOn)
       {
-        oStream << location << ".OptionName." << optionsDependedOnIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".OptionName." << optionsDependedOnIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_persistentHasBeenSet)
@@ -302,9 +303,9 @@ void OptionGroupOption::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned optionGroupOptionSettingsIdx = 1;
       for(auto& item : m_optionGroupOptionSettings)
       {
-        Aws::StringStream optionGroupOptionSettingsSs;
+        Aws::Utils::Stream::StringOutputStream optionGroupOptionSettingsSs;
         optionGroupOptionSettingsSs << location <<  ".OptionGroupOptionSetting." << optionGroupOptionSettingsIdx++;
-        item.OutputToStream(oStream, optionGroupOptionSettingsSs.str().c_str());
+        item.OutputToStream(oStream, optionGroupOptionSettingsSs.GetString().c_str());
       }
   }
   if(m_optionGroupOptionVersionsHasBeenSet)
@@ -312,9 +313,9 @@ void OptionGroupOption::OutputToStream(Aws::OStream& oStream, const char* locati
       unsigned optionGroupOptionVersionsIdx = 1;
       for(auto& item : m_optionGroupOptionVersions)
       {
-        Aws::StringStream optionGroupOptionVersionsSs;
+        Aws::Utils::Stream::StringOutputStream optionGroupOptionVersionsSs;
         optionGroupOptionVersionsSs << location <<  ".OptionVersion." << optionGroupOptionVersionsIdx++;
-        item.OutputToStream(oStream, optionGroupOptionVersionsSs.str().c_str());
+        item.OutputToStream(oStream, optionGroupOptionVersionsSs.GetString().c_str());
       }
   }
 }
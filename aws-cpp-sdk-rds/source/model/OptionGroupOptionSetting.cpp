@@ -61,37 +61,37 @@ OptionGroupOptionSetting& OptionGroupOptionSetting::operator =(const XmlNode& xm
     XmlNode settingNameNode = resultNode.FirstChild("SettingName");
     if(!settingNameNode.IsNull())
     {
-      m_settingName = StringUtils::Trim(settingNameNode.GetText().c_str());
+      m_settingName = settingNameNode.GetTextView().Trim().ToString();
       m_settingNameHasBeenSet = true;
     }
     XmlNode settingDescriptionNode = resultNode.FirstChild("SettingDescription");
     if(!settingDescriptionNode.IsNull())
     {
-      m_settingDescription = StringUtils::Trim(settingDescriptionNode.GetText().c_str());
+      m_settingDescription = settingDescriptionNode.GetTextView().Trim().ToString();
       m_settingDescriptionHasBeenSet = true;
     }
     XmlNode defaultValueNode = resultNode.FirstChild("DefaultValue");
     if(!defaultValueNode.IsNull())
     {
-      m_defaultValue = StringUtils::Trim(defaultValueNode.GetText().c_str());
+      m_defaultValue = defaultValueNode.GetTextView().Trim().ToString();
       m_defaultValueHasBeenSet = true;
     }
     XmlNode applyTypeNode = resultNode.FirstChild("ApplyType");
     if(!applyTypeNode.IsNull())
     {
-      m_applyType = StringUtils::Trim(applyTypeNode.GetText().c_str());
+      m_applyType = applyTypeNode.GetTextView().Trim().ToString();
       m_applyTypeHasBeenSet = true;
     }
     XmlNode allowedValuesNode = resultNode.FirstChild("AllowedValues");
     if(!allowedValuesNode.IsNull())
     {
-      m_allowedValues = StringUtils::Trim(allowedValuesNode.GetText().c_str());
+      m_allowedValues = allowedValuesNode.GetTextView().Trim().ToString();
       m_allowedValuesHasBeenSet = true;
     }
     XmlNode isModifiableNode = resultNode.FirstChild("IsModifiable");
     if(!isModifiableNode.IsNull())
     {
-      m_isModifiable = StringUtils::ConvertToBool(StringUtils::Trim(isModifiableNode.GetText().c_str()).c_str());
+      m_isModifiable = StringUtils::ConvertToBool(isModifiableNode.GetTextView().Trim().ToString().c_str());
       m_isModifiableHasBeenSet = true;
     }
   }
@@ -103,27 +103,27 @@ void OptionGroupOptionSetting::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_settingNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SettingName=" << StringUtils::URLEncode(m_settingName.c_str()) << "&";
+      oStream << location << index << locationValue << ".SettingName=" << StringUtils::URLEncoded(m_settingName) << "&";
   }
 
   if(m_settingDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SettingDescription=" << StringUtils::URLEncode(m_settingDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".SettingDescription=" << StringUtils::URLEncoded(m_settingDescription) << "&";
   }
 
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
 
   if(m_applyTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ApplyType=" << StringUtils::URLEncode(m_applyType.c_str()) << "&";
+      oStream << location << index << locationValue << ".ApplyType=" << StringUtils::URLEncoded(m_applyType) << "&";
   }
 
   if(m_allowedValuesHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AllowedValues=" << StringUtils::URLEncode(m_allowedValues.c_str()) << "&";
+      oStream << location << index << locationValue << ".AllowedValues=" << StringUtils::URLEncoded(m_allowedValues) << "&";
   }
 
   if(m_isModifiableHasBeenSet)
@@ -137,23 +137,23 @@ void OptionGroupOptionSetting::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_settingNameHasBeenSet)
   {
-      oStream << location << ".SettingName=" << StringUtils::URLEncode(m_settingName.c_str()) << "&";
+      oStream << location << ".SettingName=" << StringUtils::URLEncoded(m_settingName) << "&";
   }
   if(m_settingDescriptionHasBeenSet)
   {
-      oStream << location << ".SettingDescription=" << StringUtils::URLEncode(m_settingDescription.c_str()) << "&";
+      oStream << location << ".SettingDescription=" << StringUtils::URLEncoded(m_settingDescription) << "&";
   }
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
   if(m_applyTypeHasBeenSet)
   {
-      oStream << location << ".ApplyType=" << StringUtils::URLEncode(m_applyType.c_str()) << "&";
+      oStream << location << ".ApplyType=" << StringUtils::URLEncoded(m_applyType) << "&";
   }
   if(m_allowedValuesHasBeenSet)
   {
-      oStream << location << ".AllowedValues=" << StringUtils::URLEncode(m_allowedValues.c_str()) << "&";
+      oStream << location << ".AllowedValues=" << StringUtils::URLEncoded(m_allowedValues) << "&";
   }
   if(m_isModifiableHasBeenSet)
   {
@@ -69,55 +69,55 @@ OptionSetting& OptionSetting::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode valueNode = resultNode.FirstChild("Value");
     if(!valueNode.IsNull())
     {
-      m_value = StringUtils::Trim(valueNode.GetText().c_str());
+      m_value = valueNode.GetTextView().Trim().ToString();
       m_valueHasBeenSet = true;
     }
     XmlNode defaultValueNode = resultNode.FirstChild("DefaultValue");
     if(!defaultValueNode.IsNull())
     {
-      m_defaultValue = StringUtils::Trim(defaultValueNode.GetText().c_str());
+      m_defaultValue = defaultValueNode.GetTextView().Trim().ToString();
       m_defaultValueHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode applyTypeNode = resultNode.FirstChild("ApplyType");
     if(!applyTypeNode.IsNull())
     {
-      m_applyType = StringUtils::Trim(applyTypeNode.GetText().c_str());
+      m_applyType = applyTypeNode.GetTextView().Trim().ToString();
       m_applyTypeHasBeenSet = true;
     }
     XmlNode dataTypeNode = resultNode.FirstChild("DataType");
     if(!dataTypeNode.IsNull())
     {
-      m_dataType = StringUtils::Trim(dataTypeNode.GetText().c_str());
+      m_dataType = dataTypeNode.GetTextView().Trim().ToString();
       m_dataTypeHasBeenSet = true;
     }
     XmlNode allowedValuesNode = resultNode.FirstChild("AllowedValues");
     if(!allowedValuesNode.IsNull())
     {
-      m_allowedValues = StringUtils::Trim(allowedValuesNode.GetText().c_str());
+      m_allowedValues = allowedValuesNode.GetTextView().Trim().ToString();
       m_allowedValuesHasBeenSet = true;
     }
     XmlNode isModifiableNode = resultNode.FirstChild("IsModifiable");
     if(!isModifiableNode.IsNull())
     {
-      m_isModifiable = StringUtils::ConvertToBool(StringUtils::Trim(isModifiableNode.GetText().c_str()).c_str());
+      m_isModifiable = StringUtils::ConvertToBool(isModifiableNode.GetTextView().Trim().ToString().c_str());
       m_isModifiableHasBeenSet = true;
     }
     XmlNode isCollectionNode = resultNode.FirstChild("IsCollection");
     if(!isCollectionNode.IsNull())
     {
-      m_isCollection = StringUtils::ConvertToBool(StringUtils::Trim(isCollectionNode.GetText().c_str()).c_str());
+      m_isCollection = StringUtils::ConvertToBool(isCollectionNode.GetTextView().Trim().ToString().c_str());
       m_isCollectionHasBeenSet = true;
     }
   }
@@ -129,37 +129,37 @@ void OptionSetting::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_valueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_applyTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ApplyType=" << StringUtils::URLEncode(m_applyType.c_str()) << "&";
+      oStream << location << index << locationValue << ".ApplyType=" << StringUtils::URLEncoded(m_applyType) << "&";
   }
 
   if(m_dataTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DataType=" << StringUtils::URLEncode(m_dataType.c_str()) << "&";
+      oStream << location << index << locationValue << ".DataType=" << StringUtils::URLEncoded(m_dataType) << "&";
   }
 
   if(m_allowedValuesHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AllowedValues=" << StringUtils::URLEncode(m_allowedValues.c_str()) << "&";
+      oStream << location << index << locationValue << ".AllowedValues=" << StringUtils::URLEncoded(m_allowedValues) << "&";
   }
 
   if(m_isModifiableHasBeenSet)
@@ -178,31 +178,31 @@ void OptionSetting::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_valueHasBeenSet)
   {
-      oStream << location << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
   if(m_defaultValueHasBeenSet)
   {
-      oStream << location << ".DefaultValue=" << StringUtils::URLEncode(m_defaultValue.c_str()) << "&";
+      oStream << location << ".DefaultValue=" << StringUtils::URLEncoded(m_defaultValue) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_applyTypeHasBeenSet)
   {
-      oStream << location << ".ApplyType=" << StringUtils::URLEncode(m_applyType.c_str()) << "&";
+      oStream << location << ".ApplyType=" << StringUtils::URLEncoded(m_applyType) << "&";
   }
   if(m_dataTypeHasBeenSet)
   {
-      oStream << location << ".DataType=" << StringUtils::URLEncode(m_dataType.c_str()) << "&";
+      oStream << location << ".DataType=" << StringUtils::URLEncoded(m_dataType) << "&";
   }
   if(m_allowedValuesHasBeenSet)
   {
-      oStream << location << ".AllowedValues=" << StringUtils::URLEncode(m_allowedValues.c_str()) << "&";
+      oStream << location << ".AllowedValues=" << StringUtils::URLEncoded(m_allowedValues) << "&";
   }
   if(m_isModifiableHasBeenSet)
   {
@@ -53,13 +53,13 @@ OptionVersion& OptionVersion::operator =(const XmlNode& xmlNode)
     XmlNode versionNode = resultNode.FirstChild("Version");
     if(!versionNode.IsNull())
     {
-      m_version = StringUtils::Trim(versionNode.GetText().c_str());
+      m_version = versionNode.GetTextView().Trim().ToString();
       m_versionHasBeenSet = true;
     }
     XmlNode isDefaultNode = resultNode.FirstChild("IsDefault");
     if(!isDefaultNode.IsNull())
     {
-      m_isDefault = StringUtils::ConvertToBool(StringUtils::Trim(isDefaultNode.GetText().c_str()).c_str());
+      m_isDefault = StringUtils::ConvertToBool(isDefaultNode.GetTextView().Trim().ToString().c_str());
       m_isDefaultHasBeenSet = true;
     }
   }
@@ -71,7 +71,7 @@ void OptionVersion::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_versionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Version=" << StringUtils::URLEncode(m_version.c_str()) << "&";
+      oStream << location << index << locationValue << ".Version=" << StringUtils::URLEncoded(m_version) << "&";
   }
 
   if(m_isDefaultHasBeenSet)
@@ -85,7 +85,7 @@ void OptionVersion::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_versionHasBeenSet)
   {
-      oStream << location << ".Version=" << StringUtils::URLEncode(m_version.c_str()) << "&";
+      oStream << location << ".Version=" << StringUtils::URLEncoded(m_version) << "&";
   }
   if(m_isDefaultHasBeenSet)
   {
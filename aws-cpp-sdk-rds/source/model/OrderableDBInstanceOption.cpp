@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -83,25 +84,25 @@ OrderableDBInstanceOption& OrderableDBInstanceOption::operator =(const XmlNode&
     XmlNode engineNode = resultNode.FirstChild("Engine");
     if(!engineNode.IsNull())
     {
-      m_engine = StringUtils::Trim(engineNode.GetText().c_str());
+      m_engine = engineNode.GetTextView().Trim().ToString();
       m_engineHasBeenSet = true;
     }
     XmlNode engineVersionNode = resultNode.FirstChild("EngineVersion");
     if(!engineVersionNode.IsNull())
     {
-      m_engineVersion = StringUtils::Trim(engineVersionNode.GetText().c_str());
+      m_engineVersion = engineVersionNode.GetTextView().Trim().ToString();
       m_engineVersionHasBeenSet = true;
     }
     XmlNode dBInstanceClassNode = resultNode.FirstChild("DBInstanceClass");
     if(!dBInstanceClassNode.IsNull())
     {
-      m_dBInstanceClass = StringUtils::Trim(dBInstanceClassNode.GetText().c_str());
+      m_dBInstanceClass = dBInstanceClassNode.GetTextView().Trim().ToString();
       m_dBInstanceClassHasBeenSet = true;
     }
     XmlNode licenseModelNode = resultNode.FirstChild("LicenseModel");
     if(!licenseModelNode.IsNull())
     {
-      m_licenseModel = StringUtils::Trim(licenseModelNode.GetText().c_str());
+      m_licenseModel = licenseModelNode.GetTextView().Trim().ToString();
       m_licenseModelHasBeenSet = true;
     }
     XmlNode availabilityZonesNode = resultNode.FirstChild("AvailabilityZones");
@@ -119,43 +120,43 @@ OrderableDBInstanceOption& OrderableDBInstanceOption::operator =(const XmlNode&
     XmlNode multiAZCapableNode = resultNode.FirstChild("MultiAZCapable");
     if(!multiAZCapableNode.IsNull())
     {
-      m_multiAZCapable = StringUtils::ConvertToBool(StringUtils::Trim(multiAZCapableNode.GetText().c_str()).c_str());
+      m_multiAZCapable = StringUtils::ConvertToBool(multiAZCapableNode.GetTextView().Trim().ToString().c_str());
       m_multiAZCapableHasBeenSet = true;
     }
     XmlNode readReplicaCapableNode = resultNode.FirstChild("ReadReplicaCapable");
     if(!readReplicaCapableNode.IsNull())
     {
-      m_readReplicaCapable = StringUtils::ConvertToBool(StringUtils::Trim(readReplicaCapableNode.GetText().c_str()).c_str());
+      m_readReplicaCapable = StringUtils::ConvertToBool(readReplicaCapableNode.GetTextView().Trim().ToString().c_str());
       m_readReplicaCapableHasBeenSet = true;
     }
     XmlNode vpcNode = resultNode.FirstChild("Vpc");
     if(!vpcNode.IsNull())
     {
-      m_vpc = StringUtils::ConvertToBool(StringUtils::Trim(vpcNode.GetText().c_str()).c_str());
+      m_vpc = StringUtils::ConvertToBool(vpcNode.GetTextView().Trim().ToString().c_str());
       m_vpcHasBeenSet = true;
     }
     XmlNode supportsStorageEncryptionNode = resultNode.FirstChild("SupportsStorageEncryption");
     if(!supportsStorageEncryptionNode.IsNull())
     {
-      m_supportsStorageEncryption = StringUtils::ConvertToBool(StringUtils::Trim(supportsStorageEncryptionNode.GetText().c_str()).c_str());
+      m_supportsStorageEncryption = StringUtils::ConvertToBool(supportsStorageEncryptionNode.GetTextView().Trim().ToString().c_str());
       m_supportsStorageEncryptionHasBeenSet = true;
     }
     XmlNode storageTypeNode = resultNode.FirstChild("StorageType");
     if(!storageTypeNode.IsNull())
     {
-      m_storageType = StringUtils::Trim(storageTypeNode.GetText().c_str());
+      m_storageType = storageTypeNode.GetTextView().Trim().ToString();
       m_storageTypeHasBeenSet = true;
     }
     XmlNode supportsIopsNode = resultNode.FirstChild("SupportsIops");
     if(!supportsIopsNode.IsNull())
     {
-      m_supportsIops = StringUtils::ConvertToBool(StringUtils::Trim(supportsIopsNode.GetText().c_str()).c_str());
+      m_supportsIops = StringUtils::ConvertToBool(supportsIopsNode.GetTextView().Trim().ToString().c_str());
       m_supportsIopsHasBeenSet = true;
     }
     XmlNode supportsEnhancedMonitoringNode = resultNode.FirstChild("SupportsEnhancedMonitoring");
     if(!supportsEnhancedMonitoringNode.IsNull())
     {
-      m_supportsEnhancedMonitoring = StringUtils::ConvertToBool(StringUtils::Trim(supportsEnhancedMonitoringNode.GetText().c_str()).c_str());
+      m_supportsEnhancedMonitoring = StringUtils::ConvertToBool(supportsEnhancedMonitoringNode.GetTextView().Trim().ToString().c_str());
       m_supportsEnhancedMonitoringHasBeenSet = true;
     }
   }
@@ -167,22 +168,22 @@ void OrderableDBInstanceOption::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_engineHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << index << locationValue << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
 
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_dBInstanceClassHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBInstanceClass=" << StringUtils::URLEncode(m_dBInstanceClass.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBInstanceClass=" << StringUtils::URLEncoded(m_dBInstanceClass) << "&";
   }
 
   if(m_licenseModelHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LicenseModel=" << StringUtils::URLEncode(m_licenseModel.c_str()) << "&";
+      oStream << location << index << locationValue << ".LicenseModel=" << StringUtils::URLEncoded(m_licenseModel) << "&";
   }
 
   if(m_availabilityZonesHasBeenSet)
@@ -190,9 +191,9 @@ void OrderableDBInstanceOption::OutputToStream(Aws::OStream& oStream, const char
       unsigned availabilityZonesIdx = 1;
       for(auto& item : m_availabilityZones)
       {
-        Aws::StringStream availabilityZonesSs;
+        Aws::Utils::Stream::StringOutputStream availabilityZonesSs;
         availabilityZonesSs << location << index << locationValue << ".AvailabilityZone." << availabilityZonesIdx++;
-        item.OutputToStream(oStream, availabilityZonesSs.str().c_str());
+        item.OutputToStream(oStream, availabilityZonesSs.GetString().c_str());
       }
   }
 
@@ -218,7 +219,7 @@ void OrderableDBInstanceOption::OutputToStream(Aws::OStream& oStream, const char
 
   if(m_storageTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StorageType=" << StringUtils::URLEncode(m_storageType.c_str()) << "&";
+      oStream << location << index << locationValue << ".StorageType=" << StringUtils::URLEncoded(m_storageType) << "&";
   }
 
   if(m_supportsIopsHasBeenSet)
@@ -237,28 +238,28 @@ void OrderableDBInstanceOption::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_engineHasBeenSet)
   {
-      oStream << location << ".Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+      oStream << location << ".Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
   if(m_dBInstanceClassHasBeenSet)
   {
-      oStream << location << ".DBInstanceClass=" << StringUtils::URLEncode(m_dBInstanceClass.c_str()) << "&";
+      oStream << location << ".DBInstanceClass=" << StringUtils::URLEncoded(m_dBInstanceClass) << "&";
   }
   if(m_licenseModelHasBeenSet)
   {
-      oStream << location << ".LicenseModel=" << StringUtils::URLEncode(m_licenseModel.c_str()) << "&";
+      oStream << location << ".LicenseModel=" << StringUtils::URLEncoded(m_licenseModel) << "&";
   }
   if(m_availabilityZonesHasBeenSet)
   {
       unsigned availabilityZonesIdx = 1;
       for(auto& item : m_availabilityZones)
       {
-        Aws::StringStream availabilityZonesSs;
+        Aws::Utils::Stream::StringOutputStream availabilityZonesSs;
         availabilityZonesSs << location <<  ".AvailabilityZone." << availabilityZonesIdx++;
-        item.OutputToStream(oStream, availabilityZonesSs.str().c_str());
+        item.OutputToStream(oStream, availabilityZonesSs.GetString().c_str());
       }
   }
   if(m_multiAZCapableHasBeenSet)
@@ -279,7 +280,7 @@ void OrderableDBInstanceOption::OutputToStream(Aws::OStream& oStream, const char
   }
   if(m_storageTypeHasBeenSet)
   {
-      oStream << location << ".StorageType=" << StringUtils::URLEncode(m_storageType.c_str()) << "&";
+      oStream << location << ".StorageType=" << StringUtils::URLEncoded(m_storageType) << "&";
   }
   if(m_supportsIopsHasBeenSet)
   {
@@ -59,37 +59,37 @@ PendingMaintenanceAction& PendingMaintenanceAction::operator =(const XmlNode& xm
     XmlNode actionNode = resultNode.FirstChild("Action");
     if(!actionNode.IsNull())
     {
-      m_action = StringUtils::Trim(actionNode.GetText().c_str());
+      m_action = actionNode.GetTextView().Trim().ToString();
       m_actionHasBeenSet = true;
     }
     XmlNode autoAppliedAfterDateNode = resultNode.FirstChild("AutoAppliedAfterDate");
     if(!autoAppliedAfterDateNode.IsNull())
     {
-      m_autoAppliedAfterDate = DateTime(StringUtils::Trim(autoAppliedAfterDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_autoAppliedAfterDate = DateTime(autoAppliedAfterDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_autoAppliedAfterDateHasBeenSet = true;
     }
     XmlNode forcedApplyDateNode = resultNode.FirstChild("ForcedApplyDate");
     if(!forcedApplyDateNode.IsNull())
     {
-      m_forcedApplyDate = DateTime(StringUtils::Trim(forcedApplyDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_forcedApplyDate = DateTime(forcedApplyDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_forcedApplyDateHasBeenSet = true;
     }
     XmlNode optInStatusNode = resultNode.FirstChild("OptInStatus");
     if(!optInStatusNode.IsNull())
     {
-      m_optInStatus = StringUtils::Trim(optInStatusNode.GetText().c_str());
+      m_optInStatus = optInStatusNode.GetTextView().Trim().ToString();
       m_optInStatusHasBeenSet = true;
     }
     XmlNode currentApplyDateNode = resultNode.FirstChild("CurrentApplyDate");
     if(!currentApplyDateNode.IsNull())
     {
-      m_currentApplyDate = DateTime(StringUtils::Trim(currentApplyDateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_currentApplyDate = DateTime(currentApplyDateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_currentApplyDateHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
   }
@@ -101,32 +101,32 @@ void PendingMaintenanceAction::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_actionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Action=" << StringUtils::URLEncode(m_action.c_str()) << "&";
+      oStream << location << index << locationValue << ".Action=" << StringUtils::URLEncoded(m_action) << "&";
   }
 
   if(m_autoAppliedAfterDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AutoAppliedAfterDate=" << StringUtils::URLEncode(m_autoAppliedAfterDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".AutoAppliedAfterDate=" << StringUtils::URLEncoded(m_autoAppliedAfterDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_forcedApplyDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ForcedApplyDate=" << StringUtils::URLEncode(m_forcedApplyDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".ForcedApplyDate=" << StringUtils::URLEncoded(m_forcedApplyDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_optInStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OptInStatus=" << StringUtils::URLEncode(m_optInStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".OptInStatus=" << StringUtils::URLEncoded(m_optInStatus) << "&";
   }
 
   if(m_currentApplyDateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CurrentApplyDate=" << StringUtils::URLEncode(m_currentApplyDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".CurrentApplyDate=" << StringUtils::URLEncoded(m_currentApplyDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
 }
@@ -135,27 +135,27 @@ void PendingMaintenanceAction::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_actionHasBeenSet)
   {
-      oStream << location << ".Action=" << StringUtils::URLEncode(m_action.c_str()) << "&";
+      oStream << location << ".Action=" << StringUtils::URLEncoded(m_action) << "&";
   }
   if(m_autoAppliedAfterDateHasBeenSet)
   {
-      oStream << location << ".AutoAppliedAfterDate=" << StringUtils::URLEncode(m_autoAppliedAfterDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".AutoAppliedAfterDate=" << StringUtils::URLEncoded(m_autoAppliedAfterDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_forcedApplyDateHasBeenSet)
   {
-      oStream << location << ".ForcedApplyDate=" << StringUtils::URLEncode(m_forcedApplyDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".ForcedApplyDate=" << StringUtils::URLEncoded(m_forcedApplyDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_optInStatusHasBeenSet)
   {
-      oStream << location << ".OptInStatus=" << StringUtils::URLEncode(m_optInStatus.c_str()) << "&";
+      oStream << location << ".OptInStatus=" << StringUtils::URLEncoded(m_optInStatus) << "&";
   }
   if(m_currentApplyDateHasBeenSet)
   {
-      oStream << location << ".CurrentApplyDate=" << StringUtils::URLEncode(m_currentApplyDate.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".CurrentApplyDate=" << StringUtils::URLEncoded(m_currentApplyDate.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 }
 
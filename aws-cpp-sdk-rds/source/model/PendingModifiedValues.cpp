@@ -83,79 +83,79 @@ PendingModifiedValues& PendingModifiedValues::operator =(const XmlNode& xmlNode)
     XmlNode dBInstanceClassNode = resultNode.FirstChild("DBInstanceClass");
     if(!dBInstanceClassNode.IsNull())
     {
-      m_dBInstanceClass = StringUtils::Trim(dBInstanceClassNode.GetText().c_str());
+      m_dBInstanceClass = dBInstanceClassNode.GetTextView().Trim().ToString();
       m_dBInstanceClassHasBeenSet = true;
     }
     XmlNode allocatedStorageNode = resultNode.FirstChild("AllocatedStorage");
     if(!allocatedStorageNode.IsNull())
     {
-      m_allocatedStorage = StringUtils::ConvertToInt32(StringUtils::Trim(allocatedStorageNode.GetText().c_str()).c_str());
+      m_allocatedStorage = StringUtils::ConvertToInt32(allocatedStorageNode.GetTextView().Trim().ToString().c_str());
       m_allocatedStorageHasBeenSet = true;
     }
     XmlNode masterUserPasswordNode = resultNode.FirstChild("MasterUserPassword");
     if(!masterUserPasswordNode.IsNull())
     {
-      m_masterUserPassword = StringUtils::Trim(masterUserPasswordNode.GetText().c_str());
+      m_masterUserPassword = masterUserPasswordNode.GetTextView().Trim().ToString();
       m_masterUserPasswordHasBeenSet = true;
     }
     XmlNode portNode = resultNode.FirstChild("Port");
     if(!portNode.IsNull())
     {
-      m_port = StringUtils::ConvertToInt32(StringUtils::Trim(portNode.GetText().c_str()).c_str());
+      m_port = StringUtils::ConvertToInt32(portNode.GetTextView().Trim().ToString().c_str());
       m_portHasBeenSet = true;
     }
     XmlNode backupRetentionPeriodNode = resultNode.FirstChild("BackupRetentionPeriod");
     if(!backupRetentionPeriodNode.IsNull())
     {
-      m_backupRetentionPeriod = StringUtils::ConvertToInt32(StringUtils::Trim(backupRetentionPeriodNode.GetText().c_str()).c_str());
+      m_backupRetentionPeriod = StringUtils::ConvertToInt32(backupRetentionPeriodNode.GetTextView().Trim().ToString().c_str());
       m_backupRetentionPeriodHasBeenSet = true;
     }
     XmlNode multiAZNode = resultNode.FirstChild("MultiAZ");
     if(!multiAZNode.IsNull())
     {
-      m_multiAZ = StringUtils::ConvertToBool(StringUtils::Trim(multiAZNode.GetText().c_str()).c_str());
+      m_multiAZ = StringUtils::ConvertToBool(multiAZNode.GetTextView().Trim().ToString().c_str());
       m_multiAZHasBeenSet = true;
     }
     XmlNode engineVersionNode = resultNode.FirstChild("EngineVersion");
     if(!engineVersionNode.IsNull())
     {
-      m_engineVersion = StringUtils::Trim(engineVersionNode.GetText().c_str());
+      m_engineVersion = engineVersionNode.GetTextView().Trim().ToString();
       m_engineVersionHasBeenSet = true;
     }
     XmlNode licenseModelNode = resultNode.FirstChild("LicenseModel");
     if(!licenseModelNode.IsNull())
     {
-      m_licenseModel = StringUtils::Trim(licenseModelNode.GetText().c_str());
+      m_licenseModel = licenseModelNode.GetTextView().Trim().ToString();
       m_licenseModelHasBeenSet = true;
     }
     XmlNode iopsNode = resultNode.FirstChild("Iops");
     if(!iopsNode.IsNull())
     {
-      m_iops = StringUtils::ConvertToInt32(StringUtils::Trim(iopsNode.GetText().c_str()).c_str());
+      m_iops = StringUtils::ConvertToInt32(iopsNode.GetTextView().Trim().ToString().c_str());
       m_iopsHasBeenSet = true;
     }
     XmlNode dBInstanceIdentifierNode = resultNode.FirstChild("DBInstanceIdentifier");
     if(!dBInstanceIdentifierNode.IsNull())
     {
-      m_dBInstanceIdentifier = StringUtils::Trim(dBInstanceIdentifierNode.GetText().c_str());
+      m_dBInstanceIdentifier = dBInstanceIdentifierNode.GetTextView().Trim().ToString();
       m_dBInstanceIdentifierHasBeenSet = true;
     }
     XmlNode storageTypeNode = resultNode.FirstChild("StorageType");
     if(!storageTypeNode.IsNull())
     {
-      m_storageType = StringUtils::Trim(storageTypeNode.GetText().c_str());
+      m_storageType = storageTypeNode.GetTextView().Trim().ToString();
       m_storageTypeHasBeenSet = true;
     }
     XmlNode cACertificateIdentifierNode = resultNode.FirstChild("CACertificateIdentifier");
     if(!cACertificateIdentifierNode.IsNull())
     {
-      m_cACertificateIdentifier = StringUtils::Trim(cACertificateIdentifierNode.GetText().c_str());
+      m_cACertificateIdentifier = cACertificateIdentifierNode.GetTextView().Trim().ToString();
       m_cACertificateIdentifierHasBeenSet = true;
     }
     XmlNode dBSubnetGroupNameNode = resultNode.FirstChild("DBSubnetGroupName");
     if(!dBSubnetGroupNameNode.IsNull())
     {
-      m_dBSubnetGroupName = StringUtils::Trim(dBSubnetGroupNameNode.GetText().c_str());
+      m_dBSubnetGroupName = dBSubnetGroupNameNode.GetTextView().Trim().ToString();
       m_dBSubnetGroupNameHasBeenSet = true;
     }
   }
@@ -167,7 +167,7 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_dBInstanceClassHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBInstanceClass=" << StringUtils::URLEncode(m_dBInstanceClass.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBInstanceClass=" << StringUtils::URLEncoded(m_dBInstanceClass) << "&";
   }
 
   if(m_allocatedStorageHasBeenSet)
@@ -177,7 +177,7 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
 
   if(m_masterUserPasswordHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MasterUserPassword=" << StringUtils::URLEncode(m_masterUserPassword.c_str()) << "&";
+      oStream << location << index << locationValue << ".MasterUserPassword=" << StringUtils::URLEncoded(m_masterUserPassword) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -197,12 +197,12 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
 
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
 
   if(m_licenseModelHasBeenSet)
   {
-      oStream << location << index << locationValue << ".LicenseModel=" << StringUtils::URLEncode(m_licenseModel.c_str()) << "&";
+      oStream << location << index << locationValue << ".LicenseModel=" << StringUtils::URLEncoded(m_licenseModel) << "&";
   }
 
   if(m_iopsHasBeenSet)
@@ -212,22 +212,22 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
 
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
 
   if(m_storageTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StorageType=" << StringUtils::URLEncode(m_storageType.c_str()) << "&";
+      oStream << location << index << locationValue << ".StorageType=" << StringUtils::URLEncoded(m_storageType) << "&";
   }
 
   if(m_cACertificateIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CACertificateIdentifier=" << StringUtils::URLEncode(m_cACertificateIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".CACertificateIdentifier=" << StringUtils::URLEncoded(m_cACertificateIdentifier) << "&";
   }
 
   if(m_dBSubnetGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBSubnetGroupName=" << StringUtils::URLEncode(m_dBSubnetGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBSubnetGroupName=" << StringUtils::URLEncoded(m_dBSubnetGroupName) << "&";
   }
 
 }
@@ -236,7 +236,7 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_dBInstanceClassHasBeenSet)
   {
-      oStream << location << ".DBInstanceClass=" << StringUtils::URLEncode(m_dBInstanceClass.c_str()) << "&";
+      oStream << location << ".DBInstanceClass=" << StringUtils::URLEncoded(m_dBInstanceClass) << "&";
   }
   if(m_allocatedStorageHasBeenSet)
   {
@@ -244,7 +244,7 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
   }
   if(m_masterUserPasswordHasBeenSet)
   {
-      oStream << location << ".MasterUserPassword=" << StringUtils::URLEncode(m_masterUserPassword.c_str()) << "&";
+      oStream << location << ".MasterUserPassword=" << StringUtils::URLEncoded(m_masterUserPassword) << "&";
   }
   if(m_portHasBeenSet)
   {
@@ -260,11 +260,11 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
   }
   if(m_engineVersionHasBeenSet)
   {
-      oStream << location << ".EngineVersion=" << StringUtils::URLEncode(m_engineVersion.c_str()) << "&";
+      oStream << location << ".EngineVersion=" << StringUtils::URLEncoded(m_engineVersion) << "&";
   }
   if(m_licenseModelHasBeenSet)
   {
-      oStream << location << ".LicenseModel=" << StringUtils::URLEncode(m_licenseModel.c_str()) << "&";
+      oStream << location << ".LicenseModel=" << StringUtils::URLEncoded(m_licenseModel) << "&";
   }
   if(m_iopsHasBeenSet)
   {
@@ -272,19 +272,19 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
   }
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-      oStream << location << ".DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+      oStream << location << ".DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
   if(m_storageTypeHasBeenSet)
   {
-      oStream << location << ".StorageType=" << StringUtils::URLEncode(m_storageType.c_str()) << "&";
+      oStream << location << ".StorageType=" << StringUtils::URLEncoded(m_storageType) << "&";
   }
   if(m_cACertificateIdentifierHasBeenSet)
   {
-      oStream << location << ".CACertificateIdentifier=" << StringUtils::URLEncode(m_cACertificateIdentifier.c_str()) << "&";
+      oStream << location << ".CACertificateIdentifier=" << StringUtils::URLEncoded(m_cACertificateIdentifier) << "&";
   }
   if(m_dBSubnetGroupNameHasBeenSet)
   {
-      oStream << location << ".DBSubnetGroupName=" << StringUtils::URLEncode(m_dBSubnetGroupName.c_str()) << "&";
+      oStream << location << ".DBSubnetGroupName=" << StringUtils::URLEncoded(m_dBSubnetGroupName) << "&";
   }
 }
 
@@ -40,7 +40,7 @@ PromoteReadReplicaDBClusterResult& PromoteReadReplicaDBClusterResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "PromoteReadReplicaDBClusterResult")
+  if (rootNode.GetNameView() != "PromoteReadReplicaDBClusterResult")
   {
     resultNode = rootNode.FirstChild("PromoteReadReplicaDBClusterResult");
   }
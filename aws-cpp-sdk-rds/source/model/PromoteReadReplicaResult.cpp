@@ -40,7 +40,7 @@ PromoteReadReplicaResult& PromoteReadReplicaResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "PromoteReadReplicaResult")
+  if (rootNode.GetNameView() != "PromoteReadReplicaResult")
   {
     resultNode = rootNode.FirstChild("PromoteReadReplicaResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/rds/model/PurchaseReservedDBInstancesOfferingRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -30,16 +31,16 @@ PurchaseReservedDBInstancesOfferingRequest::PurchaseReservedDBInstancesOfferingR
 
 Aws::String PurchaseReservedDBInstancesOfferingRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=PurchaseReservedDBInstancesOffering&";
   if(m_reservedDBInstancesOfferingIdHasBeenSet)
   {
-    ss << "ReservedDBInstancesOfferingId=" << StringUtils::URLEncode(m_reservedDBInstancesOfferingId.c_str()) << "&";
+    ss << "ReservedDBInstancesOfferingId=" << StringUtils::URLEncoded(m_reservedDBInstancesOfferingId) << "&";
   }
 
   if(m_reservedDBInstanceIdHasBeenSet)
   {
-    ss << "ReservedDBInstanceId=" << StringUtils::URLEncode(m_reservedDBInstanceId.c_str()) << "&";
+    ss << "ReservedDBInstanceId=" << StringUtils::URLEncoded(m_reservedDBInstanceId) << "&";
   }
 
   if(m_dBInstanceCountHasBeenSet)
@@ -58,6 +59,6 @@ Aws::String PurchaseReservedDBInstancesOfferingRequest::SerializePayload() const
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ PurchaseReservedDBInstancesOfferingResult& PurchaseReservedDBInstancesOfferingRe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "PurchaseReservedDBInstancesOfferingResult")
+  if (rootNode.GetNameView() != "PurchaseReservedDBInstancesOfferingResult")
   {
     resultNode = rootNode.FirstChild("PurchaseReservedDBInstancesOfferingResult");
   }
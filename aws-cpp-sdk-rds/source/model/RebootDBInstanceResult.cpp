@@ -40,7 +40,7 @@ RebootDBInstanceResult& RebootDBInstanceResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RebootDBInstanceResult")
+  if (rootNode.GetNameView() != "RebootDBInstanceResult")
   {
     resultNode = rootNode.FirstChild("RebootDBInstanceResult");
   }
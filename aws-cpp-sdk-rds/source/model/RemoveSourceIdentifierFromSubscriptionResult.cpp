@@ -40,7 +40,7 @@ RemoveSourceIdentifierFromSubscriptionResult& RemoveSourceIdentifierFromSubscrip
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RemoveSourceIdentifierFromSubscriptionResult")
+  if (rootNode.GetNameView() != "RemoveSourceIdentifierFromSubscriptionResult")
   {
     resultNode = rootNode.FirstChild("RemoveSourceIdentifierFromSubscriptionResult");
   }
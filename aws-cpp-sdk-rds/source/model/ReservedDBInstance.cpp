@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -87,79 +88,79 @@ ReservedDBInstance& ReservedDBInstance::operator =(const XmlNode& xmlNode)
     XmlNode reservedDBInstanceIdNode = resultNode.FirstChild("ReservedDBInstanceId");
     if(!reservedDBInstanceIdNode.IsNull())
     {
-      m_reservedDBInstanceId = StringUtils::Trim(reservedDBInstanceIdNode.GetText().c_str());
+      m_reservedDBInstanceId = reservedDBInstanceIdNode.GetTextView().Trim().ToString();
       m_reservedDBInstanceIdHasBeenSet = true;
     }
     XmlNode reservedDBInstancesOfferingIdNode = resultNode.FirstChild("ReservedDBInstancesOfferingId");
     if(!reservedDBInstancesOfferingIdNode.IsNull())
     {
-      m_reservedDBInstancesOfferingId = StringUtils::Trim(reservedDBInstancesOfferingIdNode.GetText().c_str());
+      m_reservedDBInstancesOfferingId = reservedDBInstancesOfferingIdNode.GetTextView().Trim().ToString();
       m_reservedDBInstancesOfferingIdHasBeenSet = true;
     }
     XmlNode dBInstanceClassNode = resultNode.FirstChild("DBInstanceClass");
     if(!dBInstanceClassNode.IsNull())
     {
-      m_dBInstanceClass = StringUtils::Trim(dBInstanceClassNode.GetText().c_str());
+      m_dBInstanceClass = dBInstanceClassNode.GetTextView().Trim().ToString();
       m_dBInstanceClassHasBeenSet = true;
     }
     XmlNode startTimeNode = resultNode.FirstChild("StartTime");
     if(!startTimeNode.IsNull())
     {
-      m_startTime = DateTime(StringUtils::Trim(startTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_startTime = DateTime(startTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_startTimeHasBeenSet = true;
     }
     XmlNode durationNode = resultNode.FirstChild("Duration");
     if(!durationNode.IsNull())
     {
-      m_duration = StringUtils::ConvertToInt32(StringUtils::Trim(durationNode.GetText().c_str()).c_str());
+      m_duration = StringUtils::ConvertToInt32(durationNode.GetTextView().Trim().ToString().c_str());
       m_durationHasBeenSet = true;
     }
     XmlNode fixedPriceNode = resultNode.FirstChild("FixedPrice");
     if(!fixedPriceNode.IsNull())
     {
-      m_fixedPrice = StringUtils::ConvertToDouble(StringUtils::Trim(fixedPriceNode.GetText().c_str()).c_str());
+      m_fixedPrice = StringUtils::ConvertToDouble(fixedPriceNode.GetTextView().Trim().ToString().c_str());
       m_fixedPriceHasBeenSet = true;
     }
     XmlNode usagePriceNode = resultNode.FirstChild("UsagePrice");
     if(!usagePriceNode.IsNull())
     {
-      m_usagePrice = StringUtils::ConvertToDouble(StringUtils::Trim(usagePriceNode.GetText().c_str()).c_str());
+      m_usagePrice = StringUtils::ConvertToDouble(usagePriceNode.GetTextView().Trim().ToString().c_str());
       m_usagePriceHasBeenSet = true;
     }
     XmlNode currencyCodeNode = resultNode.FirstChild("CurrencyCode");
     if(!currencyCodeNode.IsNull())
     {
-      m_currencyCode = StringUtils::Trim(currencyCodeNode.GetText().c_str());
+      m_currencyCode = currencyCodeNode.GetTextView().Trim().ToString();
       m_currencyCodeHasBeenSet = true;
     }
     XmlNode dBInstanceCountNode = resultNode.FirstChild("DBInstanceCount");
     if(!dBInstanceCountNode.IsNull())
     {
-      m_dBInstanceCount = StringUtils::ConvertToInt32(StringUtils::Trim(dBInstanceCountNode.GetText().c_str()).c_str());
+      m_dBInstanceCount = StringUtils::ConvertToInt32(dBInstanceCountNode.GetTextView().Trim().ToString().c_str());
       m_dBInstanceCountHasBeenSet = true;
     }
     XmlNode productDescriptionNode = resultNode.FirstChild("ProductDescription");
     if(!productDescriptionNode.IsNull())
     {
-      m_productDescription = StringUtils::Trim(productDescriptionNode.GetText().c_str());
+      m_productDescription = productDescriptionNode.GetTextView().Trim().ToString();
       m_productDescriptionHasBeenSet = true;
     }
     XmlNode offeringTypeNode = resultNode.FirstChild("OfferingType");
     if(!offeringTypeNode.IsNull())
     {
-      m_offeringType = StringUtils::Trim(offeringTypeNode.GetText().c_str());
+      m_offeringType = offeringTypeNode.GetTextView().Trim().ToString();
       m_offeringTypeHasBeenSet = true;
     }
     XmlNode multiAZNode = resultNode.FirstChild("MultiAZ");
     if(!multiAZNode.IsNull())
     {
-      m_multiAZ = StringUtils::ConvertToBool(StringUtils::Trim(multiAZNode.GetText().c_str()).c_str());
+      m_multiAZ = StringUtils::ConvertToBool(multiAZNode.GetTextView().Trim().ToString().c_str());
       m_multiAZHasBeenSet = true;
     }
     XmlNode stateNode = resultNode.FirstChild("State");
     if(!stateNode.IsNull())
     {
-      m_state = StringUtils::Trim(stateNode.GetText().c_str());
+      m_state = stateNode.GetTextView().Trim().ToString();
       m_stateHasBeenSet = true;
     }
     XmlNode recurringChargesNode = resultNode.FirstChild("RecurringCharges");
@@ -177,7 +178,7 @@ ReservedDBInstance& ReservedDBInstance::operator =(const XmlNode& xmlNode)
     XmlNode reservedDBInstanceArnNode = resultNode.FirstChild("ReservedDBInstanceArn");
     if(!reservedDBInstanceArnNode.IsNull())
     {
-      m_reservedDBInstanceArn = StringUtils::Trim(reservedDBInstanceArnNode.GetText().c_str());
+      m_reservedDBInstanceArn = reservedDBInstanceArnNode.GetTextView().Trim().ToString();
       m_reservedDBInstanceArnHasBeenSet = true;
     }
   }
@@ -189,22 +190,22 @@ void ReservedDBInstance::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_reservedDBInstanceIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReservedDBInstanceId=" << StringUtils::URLEncode(m_reservedDBInstanceId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReservedDBInstanceId=" << StringUtils::URLEncoded(m_reservedDBInstanceId) << "&";
   }
 
   if(m_reservedDBInstancesOfferingIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReservedDBInstancesOfferingId=" << StringUtils::URLEncode(m_reservedDBInstancesOfferingId.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReservedDBInstancesOfferingId=" << StringUtils::URLEncoded(m_reservedDBInstancesOfferingId) << "&";
   }
 
   if(m_dBInstanceClassHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBInstanceClass=" << StringUtils::URLEncode(m_dBInstanceClass.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBInstanceClass=" << StringUtils::URLEncoded(m_dBInstanceClass) << "&";
   }
 
   if(m_startTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_durationHasBeenSet)
@@ -224,7 +225,7 @@ void ReservedDBInstance::OutputToStream(Aws::OStream& oStream, const char* locat
 
   if(m_currencyCodeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".CurrencyCode=" << StringUtils::URLEncode(m_currencyCode.c_str()) << "&";
+      oStream << location << index << locationValue << ".CurrencyCode=" << StringUtils::URLEncoded(m_currencyCode) << "&";
   }
 
   if(m_dBInstanceCountHasBeenSet)
@@ -234,12 +235,12 @@ void ReservedDBInstance::OutputToStream(Aws::OStream& oStream, const char* locat
 
   if(m_productDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ProductDescription=" << StringUtils::URLEncode(m_productDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".ProductDescription=" << StringUtils::URLEncoded(m_productDescription) << "&";
   }
 
   if(m_offeringTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OfferingType=" << StringUtils::URLEncode(m_offeringType.c_str()) << "&";
+      oStream << location << index << locationValue << ".OfferingType=" << StringUtils::URLEncoded(m_offeringType) << "&";
   }
 
   if(m_multiAZHasBeenSet)
@@ -249,7 +250,7 @@ void ReservedDBInstance::OutputToStream(Aws::OStream& oStream, const char* locat
 
   if(m_stateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".State=" << StringUtils::URLEncode(m_state.c_str()) << "&";
+      oStream << location << index << locationValue << ".State=" << StringUtils::URLEncoded(m_state) << "&";
   }
 
   if(m_recurringChargesHasBeenSet)
@@ -257,15 +258,15 @@ void ReservedDBInstance::OutputToStream(Aws::OStream& oStream, const char* locat
       unsigned recurringChargesIdx = 1;
       for(auto& item : m_recurringCharges)
       {
-        Aws::StringStream recurringChargesSs;
+        Aws::Utils::Stream::StringOutputStream recurringChargesSs;
         recurringChargesSs << location << index << locationValue << ".RecurringCharge." << recurringChargesIdx++;
-        item.OutputToStream(oStream, recurringChargesSs.str().c_str());
+        item.OutputToStream(oStream, recurringChargesSs.GetString().c_str());
       }
   }
 
   if(m_reservedDBInstanceArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReservedDBInstanceArn=" << StringUtils::URLEncode(m_reservedDBInstanceArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReservedDBInstanceArn=" << StringUtils::URLEncoded(m_reservedDBInstanceArn) << "&";
   }
 
 }
@@ -274,19 +275,19 @@ void ReservedDBInstance::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_reservedDBInstanceIdHasBeenSet)
   {
-      oStream << location << ".ReservedDBInstanceId=" << StringUtils::URLEncode(m_reservedDBInstanceId.c_str()) << "&";
+      oStream << location << ".ReservedDBInstanceId=" << StringUtils::URLEncoded(m_reservedDBInstanceId) << "&";
   }
   if(m_reservedDBInstancesOfferingIdHasBeenSet)
   {
-      oStream << location << ".ReservedDBInstancesOfferingId=" << StringUtils::URLEncode(m_reservedDBInstancesOfferingId.c_str()) << "&";
+      oStream << location << ".ReservedDBInstancesOfferingId=" << StringUtils::URLEncoded(m_reservedDBInstancesOfferingId) << "&";
   }
   if(m_dBInstanceClassHasBeenSet)
   {
-      oStream << location << ".DBInstanceClass=" << StringUtils::URLEncode(m_dBInstanceClass.c_str()) << "&";
+      oStream << location << ".DBInstanceClass=" << StringUtils::URLEncoded(m_dBInstanceClass) << "&";
   }
   if(m_startTimeHasBeenSet)
   {
-      oStream << location << ".StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_durationHasBeenSet)
   {
@@ -302,7 +303,7 @@ void ReservedDBInstance::OutputToStream(Aws::OStream& oStream, const char* locat
   }
   if(m_currencyCodeHasBeenSet)
   {
-      oStream << location << ".CurrencyCode=" << StringUtils::URLEncode(m_currencyCode.c_str()) << "&";
+      oStream << location << ".CurrencyCode=" << StringUtils::URLEncoded(m_currencyCode) << "&";
   }
   if(m_dBInstanceCountHasBeenSet)
   {
@@ -310,11 +311,11 @@ void ReservedDBInstance::OutputToStream(Aws::OStream& oStream, const char* locat
   }
   if(m_productDescriptionHasBeenSet)
   {
-      oStream << location << ".ProductDescription=" << StringUtils::URLEncode(m_productDescription.c_str()) << "&";
+      oStream << location << ".ProductDescription=" << StringUtils::URLEncoded(m_productDescription) << "&";
   }
   if(m_offeringTypeHasBeenSet)
   {
-      oStream << location << ".OfferingType=" << StringUtils::URLEncode(m_offeringType.c_str()) << "&";
+      oStream << location << ".OfferingType=" << StringUtils::URLEncoded(m_offeringType) << "&";
   }
   if(m_multiAZHasBeenSet)
   {
@@ -322,21 +323,21 @@ void ReservedDBInstance::OutputToStream(Aws::OStream& oStream, const char* locat
   }
   if(m_stateHasBeenSet)
   {
-      oStream << location << ".State=" << StringUtils::URLEncode(m_state.c_str()) << "&";
+      oStream << location << ".State=" << StringUtils::URLEncoded(m_state) << "&";
   }
   if(m_recurringChargesHasBeenSet)
   {
       unsigned recurringChargesIdx = 1;
       for(auto& item : m_recurringCharges)
       {
-        Aws::StringStream recurringChargesSs;
+        Aws::Utils::Stream::StringOutputStream recurringChargesSs;
         recurringChargesSs << location <<  ".RecurringCharge." << recurringChargesIdx++;
-        item.OutputToStream(oStream, recurringChargesSs.str().c_str());
+        item.OutputToStream(oStream, recurringChargesSs.GetString().c_str());
       }
   }
   if(m_reservedDBInstanceArnHasBeenSet)
   {
-      oStream << location << ".ReservedDBInstanceArn=" << StringUtils::URLEncode(m_reservedDBInstanceArn.c_str()) << "&";
+      oStream << location << ".ReservedDBInstanceArn=" << StringUtils::URLEncoded(m_reservedDBInstanceArn) << "&";
   }
 }
 
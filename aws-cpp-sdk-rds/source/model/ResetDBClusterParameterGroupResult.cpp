@@ -40,7 +40,7 @@ ResetDBClusterParameterGroupResult& ResetDBClusterParameterGroupResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ResetDBClusterParameterGroupResult")
+  if (rootNode.GetNameView() != "ResetDBClusterParameterGroupResult")
   {
     resultNode = rootNode.FirstChild("ResetDBClusterParameterGroupResult");
   }
@@ -50,7 +50,7 @@ ResetDBClusterParameterGroupResult& ResetDBClusterParameterGroupResult::operator
     XmlNode dBClusterParameterGroupNameNode = resultNode.FirstChild("DBClusterParameterGroupName");
     if(!dBClusterParameterGroupNameNode.IsNull())
     {
-      m_dBClusterParameterGroupName = StringUtils::Trim(dBClusterParameterGroupNameNode.GetText().c_str());
+      m_dBClusterParameterGroupName = dBClusterParameterGroupNameNode.GetTextView().Trim().ToString();
     }
   }
 
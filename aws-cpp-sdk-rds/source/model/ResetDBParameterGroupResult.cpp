@@ -40,7 +40,7 @@ ResetDBParameterGroupResult& ResetDBParameterGroupResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ResetDBParameterGroupResult")
+  if (rootNode.GetNameView() != "ResetDBParameterGroupResult")
   {
     resultNode = rootNode.FirstChild("ResetDBParameterGroupResult");
   }
@@ -50,7 +50,7 @@ ResetDBParameterGroupResult& ResetDBParameterGroupResult::operator =(const Amazo
     XmlNode dBParameterGroupNameNode = resultNode.FirstChild("DBParameterGroupName");
     if(!dBParameterGroupNameNode.IsNull())
     {
-      m_dBParameterGroupName = StringUtils::Trim(dBParameterGroupNameNode.GetText().c_str());
+      m_dBParameterGroupName = dBParameterGroupNameNode.GetTextView().Trim().ToString();
     }
   }
 
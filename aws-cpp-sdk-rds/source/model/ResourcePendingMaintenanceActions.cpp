@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ ResourcePendingMaintenanceActions& ResourcePendingMaintenanceActions::operator =
     XmlNode resourceIdentifierNode = resultNode.FirstChild("ResourceIdentifier");
     if(!resourceIdentifierNode.IsNull())
     {
-      m_resourceIdentifier = StringUtils::Trim(resourceIdentifierNode.GetText().c_str());
+      m_resourceIdentifier = resourceIdentifierNode.GetTextView().Trim().ToString();
       m_resourceIdentifierHasBeenSet = true;
     }
     XmlNode pendingMaintenanceActionDetailsNode = resultNode.FirstChild("PendingMaintenanceActionDetails");
@@ -75,7 +76,7 @@ void ResourcePendingMaintenanceActions::OutputToStream(Aws::OStream& oStream, co
 {
   if(m_resourceIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceIdentifier=" << StringUtils::URLEncode(m_resourceIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceIdentifier=" << StringUtils::URLEncoded(m_resourceIdentifier) << "&";
   }
 
   if(m_pendingMaintenanceActionDetailsHasBeenSet)
@@ -83,9 +84,9 @@ void ResourcePendingMaintenanceActions::OutputToStream(Aws::OStream& oStream, co
       unsigned pendingMaintenanceActionDetailsIdx = 1;
       for(auto& item : m_pendingMaintenanceActionDetails)
       {
-        Aws::StringStream pendingMaintenanceActionDetailsSs;
+        Aws::Utils::Stream::StringOutputStream pendingMaintenanceActionDetailsSs;
         pendingMaintenanceActionDetailsSs << location << index << locationValue << ".PendingMaintenanceAction." << pendingMaintenanceActionDetailsIdx++;
-        item.OutputToStream(oStream, pendingMaintenanceActionDetailsSs.str().c_str());
+        item.OutputToStream(oStream, pendingMaintenanceActionDetailsSs.GetString().c_str());
       }
   }
 
@@ -95,16 +96,16 @@ void ResourcePendingMaintenanceActions::OutputToStream(Aws::OStream& oStream, co
 {
   if(m_resourceIdentifierHasBeenSet)
   {
-      oStream << location << ".ResourceIdentifier=" << StringUtils::URLEncode(m_resourceIdentifier.c_str()) << "&";
+      oStream << location << ".ResourceIdentifier=" << StringUtils::URLEncoded(m_resourceIdentifier) << "&";
   }
   if(m_pendingMaintenanceActionDetailsHasBeenSet)
   {
       unsigned pendingMaintenanceActionDetailsIdx = 1;
       for(auto& item : m_pendingMaintenanceActionDetails)
       {
-        Aws::StringStream pendingMaintenanceActionDetailsSs;
+        Aws::Utils::Stream::StringOutputStream pendingMaintenanceActionDetailsSs;
         pendingMaintenanceActionDetailsSs << location <<  ".PendingMaintenanceAction." << pendingMaintenanceActionDetailsIdx++;
-        item.OutputToStream(oStream, pendingMaintenanceActionDetailsSs.str().c_str());
+        item.OutputToStream(oStream, pendingMaintenanceActionDetailsSs.GetString().c_str());
       }
   }
 }
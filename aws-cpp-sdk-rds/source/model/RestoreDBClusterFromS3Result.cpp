@@ -40,7 +40,7 @@ RestoreDBClusterFromS3Result& RestoreDBClusterFromS3Result::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RestoreDBClusterFromS3Result")
+  if (rootNode.GetNameView() != "RestoreDBClusterFromS3Result")
   {
     resultNode = rootNode.FirstChild("RestoreDBClusterFromS3Result");
   }
@@ -40,7 +40,7 @@ RestoreDBClusterFromSnapshotResult& RestoreDBClusterFromSnapshotResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RestoreDBClusterFromSnapshotResult")
+  if (rootNode.GetNameView() != "RestoreDBClusterFromSnapshotResult")
   {
     resultNode = rootNode.FirstChild("RestoreDBClusterFromSnapshotResult");
   }
@@ -40,7 +40,7 @@ RestoreDBClusterToPointInTimeResult& RestoreDBClusterToPointInTimeResult::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RestoreDBClusterToPointInTimeResult")
+  if (rootNode.GetNameView() != "RestoreDBClusterToPointInTimeResult")
   {
     resultNode = rootNode.FirstChild("RestoreDBClusterToPointInTimeResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/rds/model/RestoreDBInstanceFromDBSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -52,21 +53,21 @@ RestoreDBInstanceFromDBSnapshotRequest::RestoreDBInstanceFromDBSnapshotRequest()
 
 Aws::String RestoreDBInstanceFromDBSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=RestoreDBInstanceFromDBSnapshot&";
   if(m_dBInstanceIdentifierHasBeenSet)
   {
-    ss << "DBInstanceIdentifier=" << StringUtils::URLEncode(m_dBInstanceIdentifier.c_str()) << "&";
+    ss << "DBInstanceIdentifier=" << StringUtils::URLEncoded(m_dBInstanceIdentifier) << "&";
   }
 
   if(m_dBSnapshotIdentifierHasBeenSet)
   {
-    ss << "DBSnapshotIdentifier=" << StringUtils::URLEncode(m_dBSnapshotIdentifier.c_str()) << "&";
+    ss << "DBSnapshotIdentifier=" << StringUtils::URLEncoded(m_dBSnapshotIdentifier) << "&";
   }
 
   if(m_dBInstanceClassHasBeenSet)
   {
-    ss << "DBInstanceClass=" << StringUtils::URLEncode(m_dBInstanceClass.c_str()) << "&";
+    ss << "DBInstanceClass=" << StringUtils::URLEncoded(m_dBInstanceClass) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -76,12 +77,12 @@ Aws::String RestoreDBInstanceFromDBSnapshotRequest::SerializePayload() const
 
   if(m_availabilityZoneHasBeenSet)
   {
-    ss << "AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+    ss << "AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_dBSubnetGroupNameHasBeenSet)
   {
-    ss << "DBSubnetGroupName=" << StringUtils::URLEncode(m_dBSubnetGroupName.c_str()) << "&";
+    ss << "DBSubnetGroupName=" << StringUtils::URLEncoded(m_dBSubnetGroupName) << "&";
   }
 
   if(m_multiAZHasBeenSet)
@@ -101,17 +102,17 @@ Aws::String RestoreDBInstanceFromDBSnapshotRequest::SerializePayload() const
 
   if(m_licenseModelHasBeenSet)
   {
-    ss << "LicenseModel=" << StringUtils::URLEncode(m_licenseModel.c_str()) << "&";
+    ss << "LicenseModel=" << StringUtils::URLEncoded(m_licenseModel) << "&";
   }
 
   if(m_dBNameHasBeenSet)
   {
-    ss << "DBName=" << StringUtils::URLEncode(m_dBName.c_str()) << "&";
+    ss << "DBName=" << StringUtils::URLEncoded(m_dBName) << "&";
   }
 
   if(m_engineHasBeenSet)
   {
-    ss << "Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+    ss << "Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
 
   if(m_iopsHasBeenSet)
@@ -121,7 +122,7 @@ Aws::String RestoreDBInstanceFromDBSnapshotRequest::SerializePayload() const
 
   if(m_optionGroupNameHasBeenSet)
   {
-    ss << "OptionGroupName=" << StringUtils::URLEncode(m_optionGroupName.c_str()) << "&";
+    ss << "OptionGroupName=" << StringUtils::URLEncoded(m_optionGroupName) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -136,22 +137,22 @@ Aws::String RestoreDBInstanceFromDBSnapshotRequest::SerializePayload() const
 
   if(m_storageTypeHasBeenSet)
   {
-    ss << "StorageType=" << StringUtils::URLEncode(m_storageType.c_str()) << "&";
+    ss << "StorageType=" << StringUtils::URLEncoded(m_storageType) << "&";
   }
 
   if(m_tdeCredentialArnHasBeenSet)
   {
-    ss << "TdeCredentialArn=" << StringUtils::URLEncode(m_tdeCredentialArn.c_str()) << "&";
+    ss << "TdeCredentialArn=" << StringUtils::URLEncoded(m_tdeCredentialArn) << "&";
   }
 
   if(m_tdeCredentialPasswordHasBeenSet)
   {
-    ss << "TdeCredentialPassword=" << StringUtils::URLEncode(m_tdeCredentialPassword.c_str()) << "&";
+    ss << "TdeCredentialPassword=" << StringUtils::URLEncoded(m_tdeCredentialPassword) << "&";
   }
 
   if(m_domainHasBeenSet)
   {
-    ss << "Domain=" << StringUtils::URLEncode(m_domain.c_str()) << "&";
+    ss << "Domain=" << StringUtils::URLEncoded(m_domain) << "&";
   }
 
   if(m_copyTagsToSnapshotHasBeenSet)
@@ -161,10 +162,10 @@ Aws::String RestoreDBInstanceFromDBSnapshotRequest::SerializePayload() const
 
   if(m_domainIAMRoleNameHasBeenSet)
   {
-    ss << "DomainIAMRoleName=" << StringUtils::URLEncode(m_domainIAMRoleName.c_str()) << "&";
+    ss << "DomainIAMRoleName=" << StringUtils::URLEncoded(m_domainIAMRoleName) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ RestoreDBInstanceFromDBSnapshotResult& RestoreDBInstanceFromDBSnapshotResult::op
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RestoreDBInstanceFromDBSnapshotResult")
+  if (rootNode.GetNameView() != "RestoreDBInstanceFromDBSnapshotResult")
   {
     resultNode = rootNode.FirstChild("RestoreDBInstanceFromDBSnapshotResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/rds/model/RestoreDBInstanceToPointInTimeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::RDS::Model;
 using namespace Aws::Utils;
@@ -55,21 +56,21 @@ RestoreDBInstanceToPointInTimeRequest::RestoreDBInstanceToPointInTimeRequest() :
 
 Aws::String RestoreDBInstanceToPointInTimeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=RestoreDBInstanceToPointInTime&";
   if(m_sourceDBInstanceIdentifierHasBeenSet)
   {
-    ss << "SourceDBInstanceIdentifier=" << StringUtils::URLEncode(m_sourceDBInstanceIdentifier.c_str()) << "&";
+    ss << "SourceDBInstanceIdentifier=" << StringUtils::URLEncoded(m_sourceDBInstanceIdentifier) << "&";
   }
 
   if(m_targetDBInstanceIdentifierHasBeenSet)
   {
-    ss << "TargetDBInstanceIdentifier=" << StringUtils::URLEncode(m_targetDBInstanceIdentifier.c_str()) << "&";
+    ss << "TargetDBInstanceIdentifier=" << StringUtils::URLEncoded(m_targetDBInstanceIdentifier) << "&";
   }
 
   if(m_restoreTimeHasBeenSet)
   {
-    ss << "RestoreTime=" << StringUtils::URLEncode(m_restoreTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "RestoreTime=" << StringUtils::URLEncoded(m_restoreTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_useLatestRestorableTimeHasBeenSet)
@@ -79,7 +80,7 @@ Aws::String RestoreDBInstanceToPointInTimeRequest::SerializePayload() const
 
   if(m_dBInstanceClassHasBeenSet)
   {
-    ss << "DBInstanceClass=" << StringUtils::URLEncode(m_dBInstanceClass.c_str()) << "&";
+    ss << "DBInstanceClass=" << StringUtils::URLEncoded(m_dBInstanceClass) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -89,12 +90,12 @@ Aws::String RestoreDBInstanceToPointInTimeRequest::SerializePayload() const
 
   if(m_availabilityZoneHasBeenSet)
   {
-    ss << "AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+    ss << "AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_dBSubnetGroupNameHasBeenSet)
   {
-    ss << "DBSubnetGroupName=" << StringUtils::URLEncode(m_dBSubnetGroupName.c_str()) << "&";
+    ss << "DBSubnetGroupName=" << StringUtils::URLEncoded(m_dBSubnetGroupName) << "&";
   }
 
   if(m_multiAZHasBeenSet)
@@ -114,17 +115,17 @@ Aws::String RestoreDBInstanceToPointInTimeRequest::SerializePayload() const
 
   if(m_licenseModelHasBeenSet)
   {
-    ss << "LicenseModel=" << StringUtils::URLEncode(m_licenseModel.c_str()) << "&";
+    ss << "LicenseModel=" << StringUtils::URLEncoded(m_licenseModel) << "&";
   }
 
   if(m_dBNameHasBeenSet)
   {
-    ss << "DBName=" << StringUtils::URLEncode(m_dBName.c_str()) << "&";
+    ss << "DBName=" << StringUtils::URLEncoded(m_dBName) << "&";
   }
 
   if(m_engineHasBeenSet)
   {
-    ss << "Engine=" << StringUtils::URLEncode(m_engine.c_str()) << "&";
+    ss << "Engine=" << StringUtils::URLEncoded(m_engine) << "&";
   }
 
   if(m_iopsHasBeenSet)
@@ -134,7 +135,7 @@ Aws::String RestoreDBInstanceToPointInTimeRequest::SerializePayload() const
 
   if(m_optionGroupNameHasBeenSet)
   {
-    ss << "OptionGroupName=" << StringUtils::URLEncode(m_optionGroupName.c_str()) << "&";
+    ss << "OptionGroupName=" << StringUtils::URLEncoded(m_optionGroupName) << "&";
   }
 
   if(m_copyTagsToSnapshotHasBeenSet)
@@ -154,30 +155,30 @@ Aws::String RestoreDBInstanceToPointInTimeRequest::SerializePayload() const
 
   if(m_storageTypeHasBeenSet)
   {
-    ss << "StorageType=" << StringUtils::URLEncode(m_storageType.c_str()) << "&";
+    ss << "StorageType=" << StringUtils::URLEncoded(m_storageType) << "&";
   }
 
   if(m_tdeCredentialArnHasBeenSet)
   {
-    ss << "TdeCredentialArn=" << StringUtils::URLEncode(m_tdeCredentialArn.c_str()) << "&";
+    ss << "TdeCredentialArn=" << StringUtils::URLEncoded(m_tdeCredentialArn) << "&";
   }
 
   if(m_tdeCredentialPasswordHasBeenSet)
   {
-    ss << "TdeCredentialPassword=" << StringUtils::URLEncode(m_tdeCredentialPassword.c_str()) << "&";
+    ss << "TdeCredentialPassword=" << StringUtils::URLEncoded(m_tdeCredentialPassword) << "&";
   }
 
   if(m_domainHasBeenSet)
   {
-    ss << "Domain=" << StringUtils::URLEncode(m_domain.c_str()) << "&";
+    ss << "Domain=" << StringUtils::URLEncoded(m_domain) << "&";
   }
 
   if(m_domainIAMRoleNameHasBeenSet)
   {
-    ss << "DomainIAMRoleName=" << StringUtils::URLEncode(m_domainIAMRoleName.c_str()) << "&";
+    ss << "DomainIAMRoleName=" << StringUtils::URLEncoded(m_domainIAMRoleName) << "&";
   }
 
   ss << "Version=2014-10-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
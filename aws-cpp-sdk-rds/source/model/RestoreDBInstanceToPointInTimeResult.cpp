@@ -40,7 +40,7 @@ RestoreDBInstanceToPointInTimeResult& RestoreDBInstanceToPointInTimeResult::oper
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RestoreDBInstanceToPointInTimeResult")
+  if (rootNode.GetNameView() != "RestoreDBInstanceToPointInTimeResult")
   {
     resultNode = rootNode.FirstChild("RestoreDBInstanceToPointInTimeResult");
   }
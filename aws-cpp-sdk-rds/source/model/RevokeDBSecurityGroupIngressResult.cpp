@@ -40,7 +40,7 @@ RevokeDBSecurityGroupIngressResult& RevokeDBSecurityGroupIngressResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RevokeDBSecurityGroupIngressResult")
+  if (rootNode.GetNameView() != "RevokeDBSecurityGroupIngressResult")
   {
     resultNode = rootNode.FirstChild("RevokeDBSecurityGroupIngressResult");
   }
@@ -29,41 +29,41 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int db_instance_HASH = HashingUtils::HashString("db-instance");
-        static const int db_parameter_group_HASH = HashingUtils::HashString("db-parameter-group");
-        static const int db_security_group_HASH = HashingUtils::HashString("db-security-group");
-        static const int db_snapshot_HASH = HashingUtils::HashString("db-snapshot");
-        static const int db_cluster_HASH = HashingUtils::HashString("db-cluster");
-        static const int db_cluster_snapshot_HASH = HashingUtils::HashString("db-cluster-snapshot");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int db_instance_HASH = -560908028;
+        static const int db_parameter_group_HASH = 683404300;
+        static const int db_security_group_HASH = 1016751841;
+        static const int db_snapshot_HASH = -831161805;
+        static const int db_cluster_HASH = -1519213653;
+        static const int db_cluster_snapshot_HASH = 1810212262;
 
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == db_instance_HASH)
+          switch (hashCode)
           {
+          case db_instance_HASH:
             return SourceType::db_instance;
-          }
-          else if (hashCode == db_parameter_group_HASH)
-          {
+          case db_parameter_group_HASH:
             return SourceType::db_parameter_group;
-          }
-          else if (hashCode == db_security_group_HASH)
-          {
+          case db_security_group_HASH:
             return SourceType::db_security_group;
-          }
-          else if (hashCode == db_snapshot_HASH)
-          {
+          case db_snapshot_HASH:
             return SourceType::db_snapshot;
-          }
-          else if (hashCode == db_cluster_HASH)
-          {
+          case db_cluster_HASH:
             return SourceType::db_cluster;
-          }
-          else if (hashCode == db_cluster_snapshot_HASH)
-          {
+          case db_cluster_snapshot_HASH:
             return SourceType::db_cluster_snapshot;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
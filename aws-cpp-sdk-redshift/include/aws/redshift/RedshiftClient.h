@@ -75,6 +75,9 @@
 #include <aws/redshift/model/RotateEncryptionKeyResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -497,6 +500,18 @@ namespace Model
          */
         virtual void AuthorizeClusterSecurityGroupIngressAsync(const Model::AuthorizeClusterSecurityGroupIngressRequest& request, const AuthorizeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AuthorizeClusterSecurityGroupIngressCallable(const Model::AuthorizeClusterSecurityGroupIngressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AuthorizeClusterSecurityGroupIngressOutcomeCallable AuthorizeClusterSecurityGroupIngressCallable(Model::AuthorizeClusterSecurityGroupIngressRequest&& request) const;
+
+        /**
+         * Same as AuthorizeClusterSecurityGroupIngressAsync(const Model::AuthorizeClusterSecurityGroupIngressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AuthorizeClusterSecurityGroupIngressAsync(Model::AuthorizeClusterSecurityGroupIngressRequest&& request, const AuthorizeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Authorizes the specified AWS customer account to restore the specified
          * snapshot. </p> <p> For more information about working with snapshots, go to <a
@@ -528,6 +543,18 @@ namespace Model
          */
         virtual void AuthorizeSnapshotAccessAsync(const Model::AuthorizeSnapshotAccessRequest& request, const AuthorizeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AuthorizeSnapshotAccessCallable(const Model::AuthorizeSnapshotAccessRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AuthorizeSnapshotAccessOutcomeCallable AuthorizeSnapshotAccessCallable(Model::AuthorizeSnapshotAccessRequest&& request) const;
+
+        /**
+         * Same as AuthorizeSnapshotAccessAsync(const Model::AuthorizeSnapshotAccessRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AuthorizeSnapshotAccessAsync(Model::AuthorizeSnapshotAccessRequest&& request, const AuthorizeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Copies the specified automated cluster snapshot to a new manual cluster
          * snapshot. The source must be an automated snapshot and it must be in the
@@ -577,6 +604,18 @@ namespace Model
          */
         virtual void CopyClusterSnapshotAsync(const Model::CopyClusterSnapshotRequest& request, const CopyClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopyClusterSnapshotCallable(const Model::CopyClusterSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CopyClusterSnapshotOutcomeCallable CopyClusterSnapshotCallable(Model::CopyClusterSnapshotRequest&& request) const;
+
+        /**
+         * Same as CopyClusterSnapshotAsync(const Model::CopyClusterSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CopyClusterSnapshotAsync(Model::CopyClusterSnapshotRequest&& request, const CopyClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new cluster. To create the cluster in virtual private cloud (VPC),
          * you must provide cluster subnet group name. If you don't provide a cluster
@@ -617,6 +656,18 @@ namespace Model
          */
         virtual void CreateClusterAsync(const Model::CreateClusterRequest& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateClusterCallable(const Model::CreateClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateClusterOutcomeCallable CreateClusterCallable(Model::CreateClusterRequest&& request) const;
+
+        /**
+         * Same as CreateClusterAsync(const Model::CreateClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateClusterAsync(Model::CreateClusterRequest&& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates an Amazon Redshift parameter group. </p> <p>Creating parameter
          * groups is independent of creating clusters. You can associate a cluster with a
@@ -663,6 +714,18 @@ namespace Model
          */
         virtual void CreateClusterParameterGroupAsync(const Model::CreateClusterParameterGroupRequest& request, const CreateClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateClusterParameterGroupCallable(const Model::CreateClusterParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateClusterParameterGroupOutcomeCallable CreateClusterParameterGroupCallable(Model::CreateClusterParameterGroupRequest&& request) const;
+
+        /**
+         * Same as CreateClusterParameterGroupAsync(const Model::CreateClusterParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateClusterParameterGroupAsync(Model::CreateClusterParameterGroupRequest&& request, const CreateClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new Amazon Redshift security group. You use security groups to
          * control access to non-VPC clusters. </p> <p> For information about managing
@@ -697,6 +760,18 @@ namespace Model
          */
         virtual void CreateClusterSecurityGroupAsync(const Model::CreateClusterSecurityGroupRequest& request, const CreateClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateClusterSecurityGroupCallable(const Model::CreateClusterSecurityGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateClusterSecurityGroupOutcomeCallable CreateClusterSecurityGroupCallable(Model::CreateClusterSecurityGroupRequest&& request) const;
+
+        /**
+         * Same as CreateClusterSecurityGroupAsync(const Model::CreateClusterSecurityGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateClusterSecurityGroupAsync(Model::CreateClusterSecurityGroupRequest&& request, const CreateClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a manual snapshot of the specified cluster. The cluster must be in
          * the <code>available</code> state. </p> <p> For more information about working
@@ -731,6 +806,18 @@ namespace Model
          */
         virtual void CreateClusterSnapshotAsync(const Model::CreateClusterSnapshotRequest& request, const CreateClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateClusterSnapshotCallable(const Model::CreateClusterSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateClusterSnapshotOutcomeCallable CreateClusterSnapshotCallable(Model::CreateClusterSnapshotRequest&& request) const;
+
+        /**
+         * Same as CreateClusterSnapshotAsync(const Model::CreateClusterSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateClusterSnapshotAsync(Model::CreateClusterSnapshotRequest&& request, const CreateClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new Amazon Redshift subnet group. You must provide a list of one
          * or more subnets in your existing Amazon Virtual Private Cloud (Amazon VPC) when
@@ -768,6 +855,18 @@ namespace Model
          */
         virtual void CreateClusterSubnetGroupAsync(const Model::CreateClusterSubnetGroupRequest& request, const CreateClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateClusterSubnetGroupCallable(const Model::CreateClusterSubnetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateClusterSubnetGroupOutcomeCallable CreateClusterSubnetGroupCallable(Model::CreateClusterSubnetGroupRequest&& request) const;
+
+        /**
+         * Same as CreateClusterSubnetGroupAsync(const Model::CreateClusterSubnetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateClusterSubnetGroupAsync(Model::CreateClusterSubnetGroupRequest&& request, const CreateClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates an Amazon Redshift event notification subscription. This action
          * requires an ARN (Amazon Resource Name) of an Amazon SNS topic created by either
@@ -841,6 +940,18 @@ namespace Model
          */
         virtual void CreateEventSubscriptionAsync(const Model::CreateEventSubscriptionRequest& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateEventSubscriptionCallable(const Model::CreateEventSubscriptionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateEventSubscriptionOutcomeCallable CreateEventSubscriptionCallable(Model::CreateEventSubscriptionRequest&& request) const;
+
+        /**
+         * Same as CreateEventSubscriptionAsync(const Model::CreateEventSubscriptionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateEventSubscriptionAsync(Model::CreateEventSubscriptionRequest&& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an HSM client certificate that an Amazon Redshift cluster will use to
          * connect to the client's HSM in order to store and retrieve the keys used to
@@ -884,6 +995,18 @@ namespace Model
          */
         virtual void CreateHsmClientCertificateAsync(const Model::CreateHsmClientCertificateRequest& request, const CreateHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateHsmClientCertificateCallable(const Model::CreateHsmClientCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateHsmClientCertificateOutcomeCallable CreateHsmClientCertificateCallable(Model::CreateHsmClientCertificateRequest&& request) const;
+
+        /**
+         * Same as CreateHsmClientCertificateAsync(const Model::CreateHsmClientCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateHsmClientCertificateAsync(Model::CreateHsmClientCertificateRequest&& request, const CreateHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an HSM configuration that contains the information required by an
          * Amazon Redshift cluster to store and use database encryption keys in a Hardware
@@ -924,6 +1047,18 @@ namespace Model
          */
         virtual void CreateHsmConfigurationAsync(const Model::CreateHsmConfigurationRequest& request, const CreateHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateHsmConfigurationCallable(const Model::CreateHsmConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateHsmConfigurationOutcomeCallable CreateHsmConfigurationCallable(Model::CreateHsmConfigurationRequest&& request) const;
+
+        /**
+         * Same as CreateHsmConfigurationAsync(const Model::CreateHsmConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateHsmConfigurationAsync(Model::CreateHsmConfigurationRequest&& request, const CreateHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a snapshot copy grant that permits Amazon Redshift to use a customer
          * master key (CMK) from AWS Key Management Service (AWS KMS) to encrypt copied
@@ -961,6 +1096,18 @@ namespace Model
          */
         virtual void CreateSnapshotCopyGrantAsync(const Model::CreateSnapshotCopyGrantRequest& request, const CreateSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSnapshotCopyGrantCallable(const Model::CreateSnapshotCopyGrantRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateSnapshotCopyGrantOutcomeCallable CreateSnapshotCopyGrantCallable(Model::CreateSnapshotCopyGrantRequest&& request) const;
+
+        /**
+         * Same as CreateSnapshotCopyGrantAsync(const Model::CreateSnapshotCopyGrantRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateSnapshotCopyGrantAsync(Model::CreateSnapshotCopyGrantRequest&& request, const CreateSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Adds one or more tags to a specified resource. </p> <p> A resource can have
          * up to 10 tags. If you try to create more than 10 tags for a resource, you will
@@ -992,6 +1139,18 @@ namespace Model
          */
         virtual void CreateTagsAsync(const Model::CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTagsCallable(const Model::CreateTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateTagsOutcomeCallable CreateTagsCallable(Model::CreateTagsRequest&& request) const;
+
+        /**
+         * Same as CreateTagsAsync(const Model::CreateTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateTagsAsync(Model::CreateTagsRequest&& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes a previously provisioned cluster. A successful response from the web
          * service indicates that the request was received correctly. Use
@@ -1059,6 +1218,18 @@ namespace Model
          */
         virtual void DeleteClusterAsync(const Model::DeleteClusterRequest& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteClusterCallable(const Model::DeleteClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteClusterOutcomeCallable DeleteClusterCallable(Model::DeleteClusterRequest&& request) const;
+
+        /**
+         * Same as DeleteClusterAsync(const Model::DeleteClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteClusterAsync(Model::DeleteClusterRequest&& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes a specified Amazon Redshift parameter group. <note>You cannot delete
          * a parameter group if it is associated with a cluster.</note> </p>
@@ -1081,6 +1252,18 @@ namespace Model
          */
         virtual void DeleteClusterParameterGroupAsync(const Model::DeleteClusterParameterGroupRequest& request, const DeleteClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteClusterParameterGroupCallable(const Model::DeleteClusterParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteClusterParameterGroupOutcomeCallable DeleteClusterParameterGroupCallable(Model::DeleteClusterParameterGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteClusterParameterGroupAsync(const Model::DeleteClusterParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteClusterParameterGroupAsync(Model::DeleteClusterParameterGroupRequest&& request, const DeleteClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes an Amazon Redshift security group. </p> <note>You cannot delete a
          * security group that is associated with any clusters. You cannot delete the
@@ -1118,6 +1301,18 @@ namespace Model
          */
         virtual void DeleteClusterSecurityGroupAsync(const Model::DeleteClusterSecurityGroupRequest& request, const DeleteClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteClusterSecurityGroupCallable(const Model::DeleteClusterSecurityGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteClusterSecurityGroupOutcomeCallable DeleteClusterSecurityGroupCallable(Model::DeleteClusterSecurityGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteClusterSecurityGroupAsync(const Model::DeleteClusterSecurityGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteClusterSecurityGroupAsync(Model::DeleteClusterSecurityGroupRequest&& request, const DeleteClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the specified manual snapshot. The snapshot must be in the
          * <code>available</code> state, with no other users authorized to access the
@@ -1155,6 +1350,18 @@ namespace Model
          */
         virtual void DeleteClusterSnapshotAsync(const Model::DeleteClusterSnapshotRequest& request, const DeleteClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteClusterSnapshotCallable(const Model::DeleteClusterSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteClusterSnapshotOutcomeCallable DeleteClusterSnapshotCallable(Model::DeleteClusterSnapshotRequest&& request) const;
+
+        /**
+         * Same as DeleteClusterSnapshotAsync(const Model::DeleteClusterSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteClusterSnapshotAsync(Model::DeleteClusterSnapshotRequest&& request, const DeleteClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the specified cluster subnet group. </p>
          */
@@ -1174,6 +1381,18 @@ namespace Model
          */
         virtual void DeleteClusterSubnetGroupAsync(const Model::DeleteClusterSubnetGroupRequest& request, const DeleteClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteClusterSubnetGroupCallable(const Model::DeleteClusterSubnetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteClusterSubnetGroupOutcomeCallable DeleteClusterSubnetGroupCallable(Model::DeleteClusterSubnetGroupRequest&& request) const;
+
+        /**
+         * Same as DeleteClusterSubnetGroupAsync(const Model::DeleteClusterSubnetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteClusterSubnetGroupAsync(Model::DeleteClusterSubnetGroupRequest&& request, const DeleteClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes an Amazon Redshift event notification subscription. </p>
          */
@@ -1193,6 +1412,18 @@ namespace Model
          */
         virtual void DeleteEventSubscriptionAsync(const Model::DeleteEventSubscriptionRequest& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteEventSubscriptionCallable(const Model::DeleteEventSubscriptionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteEventSubscriptionOutcomeCallable DeleteEventSubscriptionCallable(Model::DeleteEventSubscriptionRequest&& request) const;
+
+        /**
+         * Same as DeleteEventSubscriptionAsync(const Model::DeleteEventSubscriptionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteEventSubscriptionAsync(Model::DeleteEventSubscriptionRequest&& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified HSM client certificate.</p>
          */
@@ -1212,6 +1443,18 @@ namespace Model
          */
         virtual void DeleteHsmClientCertificateAsync(const Model::DeleteHsmClientCertificateRequest& request, const DeleteHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteHsmClientCertificateCallable(const Model::DeleteHsmClientCertificateRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteHsmClientCertificateOutcomeCallable DeleteHsmClientCertificateCallable(Model::DeleteHsmClientCertificateRequest&& request) const;
+
+        /**
+         * Same as DeleteHsmClientCertificateAsync(const Model::DeleteHsmClientCertificateRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteHsmClientCertificateAsync(Model::DeleteHsmClientCertificateRequest&& request, const DeleteHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified Amazon Redshift HSM configuration.</p>
          */
@@ -1231,6 +1474,18 @@ namespace Model
          */
         virtual void DeleteHsmConfigurationAsync(const Model::DeleteHsmConfigurationRequest& request, const DeleteHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteHsmConfigurationCallable(const Model::DeleteHsmConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteHsmConfigurationOutcomeCallable DeleteHsmConfigurationCallable(Model::DeleteHsmConfigurationRequest&& request) const;
+
+        /**
+         * Same as DeleteHsmConfigurationAsync(const Model::DeleteHsmConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteHsmConfigurationAsync(Model::DeleteHsmConfigurationRequest&& request, const DeleteHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified snapshot copy grant.</p>
          */
@@ -1250,6 +1505,18 @@ namespace Model
          */
         virtual void DeleteSnapshotCopyGrantAsync(const Model::DeleteSnapshotCopyGrantRequest& request, const DeleteSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSnapshotCopyGrantCallable(const Model::DeleteSnapshotCopyGrantRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteSnapshotCopyGrantOutcomeCallable DeleteSnapshotCopyGrantCallable(Model::DeleteSnapshotCopyGrantRequest&& request) const;
+
+        /**
+         * Same as DeleteSnapshotCopyGrantAsync(const Model::DeleteSnapshotCopyGrantRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteSnapshotCopyGrantAsync(Model::DeleteSnapshotCopyGrantRequest&& request, const DeleteSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes a tag or tags from a resource. You must provide the ARN of the
          * resource from which you want to delete the tag or tags.</p>
@@ -1272,6 +1539,18 @@ namespace Model
          */
         virtual void DeleteTagsAsync(const Model::DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTagsCallable(const Model::DeleteTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTagsOutcomeCallable DeleteTagsCallable(Model::DeleteTagsRequest&& request) const;
+
+        /**
+         * Same as DeleteTagsAsync(const Model::DeleteTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTagsAsync(Model::DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of Amazon Redshift parameter groups, including parameter
          * groups you created and the default parameter group. For each parameter group,
@@ -1336,6 +1615,18 @@ namespace Model
          */
         virtual void DescribeClusterParameterGroupsAsync(const Model::DescribeClusterParameterGroupsRequest& request, const DescribeClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClusterParameterGroupsCallable(const Model::DescribeClusterParameterGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeClusterParameterGroupsOutcomeCallable DescribeClusterParameterGroupsCallable(Model::DescribeClusterParameterGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeClusterParameterGroupsAsync(const Model::DescribeClusterParameterGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeClusterParameterGroupsAsync(Model::DescribeClusterParameterGroupsRequest&& request, const DescribeClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a detailed list of parameters contained within the specified Amazon
          * Redshift parameter group. For each parameter the response includes information
@@ -1388,6 +1679,18 @@ namespace Model
          */
         virtual void DescribeClusterParametersAsync(const Model::DescribeClusterParametersRequest& request, const DescribeClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClusterParametersCallable(const Model::DescribeClusterParametersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeClusterParametersOutcomeCallable DescribeClusterParametersCallable(Model::DescribeClusterParametersRequest&& request) const;
+
+        /**
+         * Same as DescribeClusterParametersAsync(const Model::DescribeClusterParametersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeClusterParametersAsync(Model::DescribeClusterParametersRequest&& request, const DescribeClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns information about Amazon Redshift security groups. If the name of a
          * security group is specified, the response will contain only information about
@@ -1446,6 +1749,18 @@ namespace Model
          */
         virtual void DescribeClusterSecurityGroupsAsync(const Model::DescribeClusterSecurityGroupsRequest& request, const DescribeClusterSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClusterSecurityGroupsCallable(const Model::DescribeClusterSecurityGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeClusterSecurityGroupsOutcomeCallable DescribeClusterSecurityGroupsCallable(Model::DescribeClusterSecurityGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeClusterSecurityGroupsAsync(const Model::DescribeClusterSecurityGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeClusterSecurityGroupsAsync(Model::DescribeClusterSecurityGroupsRequest&& request, const DescribeClusterSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns one or more snapshot objects, which contain metadata about your
          * cluster snapshots. By default, this operation returns information about all
@@ -1504,6 +1819,18 @@ namespace Model
          */
         virtual void DescribeClusterSnapshotsAsync(const Model::DescribeClusterSnapshotsRequest& request, const DescribeClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClusterSnapshotsCallable(const Model::DescribeClusterSnapshotsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeClusterSnapshotsOutcomeCallable DescribeClusterSnapshotsCallable(Model::DescribeClusterSnapshotsRequest&& request) const;
+
+        /**
+         * Same as DescribeClusterSnapshotsAsync(const Model::DescribeClusterSnapshotsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeClusterSnapshotsAsync(Model::DescribeClusterSnapshotsRequest&& request, const DescribeClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns one or more cluster subnet group objects, which contain metadata
          * about your cluster subnet groups. By default, this operation returns information
@@ -1553,6 +1880,18 @@ namespace Model
          */
         virtual void DescribeClusterSubnetGroupsAsync(const Model::DescribeClusterSubnetGroupsRequest& request, const DescribeClusterSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClusterSubnetGroupsCallable(const Model::DescribeClusterSubnetGroupsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeClusterSubnetGroupsOutcomeCallable DescribeClusterSubnetGroupsCallable(Model::DescribeClusterSubnetGroupsRequest&& request) const;
+
+        /**
+         * Same as DescribeClusterSubnetGroupsAsync(const Model::DescribeClusterSubnetGroupsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeClusterSubnetGroupsAsync(Model::DescribeClusterSubnetGroupsRequest&& request, const DescribeClusterSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns descriptions of the available Amazon Redshift cluster versions. You
          * can call this operation even before creating any clusters to learn more about
@@ -1590,6 +1929,18 @@ namespace Model
          */
         virtual void DescribeClusterVersionsAsync(const Model::DescribeClusterVersionsRequest& request, const DescribeClusterVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClusterVersionsCallable(const Model::DescribeClusterVersionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeClusterVersionsOutcomeCallable DescribeClusterVersionsCallable(Model::DescribeClusterVersionsRequest&& request) const;
+
+        /**
+         * Same as DescribeClusterVersionsAsync(const Model::DescribeClusterVersionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeClusterVersionsAsync(Model::DescribeClusterVersionsRequest&& request, const DescribeClusterVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns properties of provisioned clusters including general cluster
          * properties, cluster database properties, maintenance and backup properties, and
@@ -1648,6 +1999,18 @@ namespace Model
          */
         virtual void DescribeClustersAsync(const Model::DescribeClustersRequest& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClustersCallable(const Model::DescribeClustersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeClustersOutcomeCallable DescribeClustersCallable(Model::DescribeClustersRequest&& request) const;
+
+        /**
+         * Same as DescribeClustersAsync(const Model::DescribeClustersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeClustersAsync(Model::DescribeClustersRequest&& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of parameter settings for the specified parameter group
          * family. </p> <p> For more information about parameters and parameter groups, go
@@ -1682,6 +2045,18 @@ namespace Model
          */
         virtual void DescribeDefaultClusterParametersAsync(const Model::DescribeDefaultClusterParametersRequest& request, const DescribeDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDefaultClusterParametersCallable(const Model::DescribeDefaultClusterParametersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDefaultClusterParametersOutcomeCallable DescribeDefaultClusterParametersCallable(Model::DescribeDefaultClusterParametersRequest&& request) const;
+
+        /**
+         * Same as DescribeDefaultClusterParametersAsync(const Model::DescribeDefaultClusterParametersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDefaultClusterParametersAsync(Model::DescribeDefaultClusterParametersRequest&& request, const DescribeDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Displays a list of event categories for all event source types, or for a
          * specified source type. For a list of the event categories and source types, go
@@ -1713,6 +2088,18 @@ namespace Model
          */
         virtual void DescribeEventCategoriesAsync(const Model::DescribeEventCategoriesRequest& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventCategoriesCallable(const Model::DescribeEventCategoriesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEventCategoriesOutcomeCallable DescribeEventCategoriesCallable(Model::DescribeEventCategoriesRequest&& request) const;
+
+        /**
+         * Same as DescribeEventCategoriesAsync(const Model::DescribeEventCategoriesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEventCategoriesAsync(Model::DescribeEventCategoriesRequest&& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Lists descriptions of all the Amazon Redshift event notifications
          * subscription for a customer account. If you specify a subscription name, lists
@@ -1738,6 +2125,18 @@ namespace Model
          */
         virtual void DescribeEventSubscriptionsAsync(const Model::DescribeEventSubscriptionsRequest& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventSubscriptionsCallable(const Model::DescribeEventSubscriptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEventSubscriptionsOutcomeCallable DescribeEventSubscriptionsCallable(Model::DescribeEventSubscriptionsRequest&& request) const;
+
+        /**
+         * Same as DescribeEventSubscriptionsAsync(const Model::DescribeEventSubscriptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEventSubscriptionsAsync(Model::DescribeEventSubscriptionsRequest&& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns events related to clusters, security groups, snapshots, and
          * parameter groups for the past 14 days. Events specific to a particular cluster,
@@ -1766,6 +2165,18 @@ namespace Model
          */
         virtual void DescribeEventsAsync(const Model::DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventsCallable(const Model::DescribeEventsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeEventsOutcomeCallable DescribeEventsCallable(Model::DescribeEventsRequest&& request) const;
+
+        /**
+         * Same as DescribeEventsAsync(const Model::DescribeEventsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeEventsAsync(Model::DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the specified HSM client certificate. If no
          * certificate ID is specified, returns information about all the HSM certificates
@@ -1815,6 +2226,18 @@ namespace Model
          */
         virtual void DescribeHsmClientCertificatesAsync(const Model::DescribeHsmClientCertificatesRequest& request, const DescribeHsmClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeHsmClientCertificatesCallable(const Model::DescribeHsmClientCertificatesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeHsmClientCertificatesOutcomeCallable DescribeHsmClientCertificatesCallable(Model::DescribeHsmClientCertificatesRequest&& request) const;
+
+        /**
+         * Same as DescribeHsmClientCertificatesAsync(const Model::DescribeHsmClientCertificatesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeHsmClientCertificatesAsync(Model::DescribeHsmClientCertificatesRequest&& request, const DescribeHsmClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the specified Amazon Redshift HSM configuration. If
          * no configuration ID is specified, returns information about all the HSM
@@ -1864,6 +2287,18 @@ namespace Model
          */
         virtual void DescribeHsmConfigurationsAsync(const Model::DescribeHsmConfigurationsRequest& request, const DescribeHsmConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeHsmConfigurationsCallable(const Model::DescribeHsmConfigurationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeHsmConfigurationsOutcomeCallable DescribeHsmConfigurationsCallable(Model::DescribeHsmConfigurationsRequest&& request) const;
+
+        /**
+         * Same as DescribeHsmConfigurationsAsync(const Model::DescribeHsmConfigurationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeHsmConfigurationsAsync(Model::DescribeHsmConfigurationsRequest&& request, const DescribeHsmConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes whether information, such as queries and connection attempts, is
          * being logged for the specified Amazon Redshift cluster.</p>
@@ -1886,6 +2321,18 @@ namespace Model
          */
         virtual void DescribeLoggingStatusAsync(const Model::DescribeLoggingStatusRequest& request, const DescribeLoggingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoggingStatusCallable(const Model::DescribeLoggingStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeLoggingStatusOutcomeCallable DescribeLoggingStatusCallable(Model::DescribeLoggingStatusRequest&& request) const;
+
+        /**
+         * Same as DescribeLoggingStatusAsync(const Model::DescribeLoggingStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeLoggingStatusAsync(Model::DescribeLoggingStatusRequest&& request, const DescribeLoggingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of orderable cluster options. Before you create a new cluster
          * you can use this operation to find what options are available, such as the EC2
@@ -1932,6 +2379,18 @@ namespace Model
          */
         virtual void DescribeOrderableClusterOptionsAsync(const Model::DescribeOrderableClusterOptionsRequest& request, const DescribeOrderableClusterOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeOrderableClusterOptionsCallable(const Model::DescribeOrderableClusterOptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeOrderableClusterOptionsOutcomeCallable DescribeOrderableClusterOptionsCallable(Model::DescribeOrderableClusterOptionsRequest&& request) const;
+
+        /**
+         * Same as DescribeOrderableClusterOptionsAsync(const Model::DescribeOrderableClusterOptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeOrderableClusterOptionsAsync(Model::DescribeOrderableClusterOptionsRequest&& request, const DescribeOrderableClusterOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of the available reserved node offerings by Amazon Redshift
          * with their descriptions including the node type, the fixed and recurring costs
@@ -1978,6 +2437,18 @@ namespace Model
          */
         virtual void DescribeReservedNodeOfferingsAsync(const Model::DescribeReservedNodeOfferingsRequest& request, const DescribeReservedNodeOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedNodeOfferingsCallable(const Model::DescribeReservedNodeOfferingsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReservedNodeOfferingsOutcomeCallable DescribeReservedNodeOfferingsCallable(Model::DescribeReservedNodeOfferingsRequest&& request) const;
+
+        /**
+         * Same as DescribeReservedNodeOfferingsAsync(const Model::DescribeReservedNodeOfferingsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReservedNodeOfferingsAsync(Model::DescribeReservedNodeOfferingsRequest&& request, const DescribeReservedNodeOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns the descriptions of the reserved nodes. </p>
          */
@@ -1997,6 +2468,18 @@ namespace Model
          */
         virtual void DescribeReservedNodesAsync(const Model::DescribeReservedNodesRequest& request, const DescribeReservedNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedNodesCallable(const Model::DescribeReservedNodesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeReservedNodesOutcomeCallable DescribeReservedNodesCallable(Model::DescribeReservedNodesRequest&& request) const;
+
+        /**
+         * Same as DescribeReservedNodesAsync(const Model::DescribeReservedNodesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeReservedNodesAsync(Model::DescribeReservedNodesRequest&& request, const DescribeReservedNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns information about the last resize operation for the specified
          * cluster. If no resize operation has ever been initiated for the specified
@@ -2034,6 +2517,18 @@ namespace Model
          */
         virtual void DescribeResizeAsync(const Model::DescribeResizeRequest& request, const DescribeResizeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeResizeCallable(const Model::DescribeResizeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeResizeOutcomeCallable DescribeResizeCallable(Model::DescribeResizeRequest&& request) const;
+
+        /**
+         * Same as DescribeResizeAsync(const Model::DescribeResizeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeResizeAsync(Model::DescribeResizeRequest&& request, const DescribeResizeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of snapshot copy grants owned by the AWS account in the
          * destination region.</p> <p> For more information about managing snapshot copy
@@ -2068,6 +2563,18 @@ namespace Model
          */
         virtual void DescribeSnapshotCopyGrantsAsync(const Model::DescribeSnapshotCopyGrantsRequest& request, const DescribeSnapshotCopyGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSnapshotCopyGrantsCallable(const Model::DescribeSnapshotCopyGrantsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSnapshotCopyGrantsOutcomeCallable DescribeSnapshotCopyGrantsCallable(Model::DescribeSnapshotCopyGrantsRequest&& request) const;
+
+        /**
+         * Same as DescribeSnapshotCopyGrantsAsync(const Model::DescribeSnapshotCopyGrantsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSnapshotCopyGrantsAsync(Model::DescribeSnapshotCopyGrantsRequest&& request, const DescribeSnapshotCopyGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the status of one or more table restore requests made using the
          * <a>RestoreTableFromClusterSnapshot</a> API action. If you don't specify a value
@@ -2106,10 +2613,22 @@ namespace Model
         virtual void DescribeTableRestoreStatusAsync(const Model::DescribeTableRestoreStatusRequest& request, const DescribeTableRestoreStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
         /**
-         * <p> Returns a list of tags. You can return tags from a specific resource by
-         * specifying an ARN, or you can return all tags for a given type of resource, such
-         * as clusters, snapshots, and so on.</p> <p> The following are limitations for
-         * <code>DescribeTags</code>: <ul> <li>You cannot specify an ARN and a
+         * Same as DescribeTableRestoreStatusCallable(const Model::DescribeTableRestoreStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTableRestoreStatusOutcomeCallable DescribeTableRestoreStatusCallable(Model::DescribeTableRestoreStatusRequest&& request) const;
+
+        /**
+         * Same as DescribeTableRestoreStatusAsync(const Model::DescribeTableRestoreStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTableRestoreStatusAsync(Model::DescribeTableRestoreStatusRequest&& request, const DescribeTableRestoreStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+        /**
+         * <p> Returns a list of tags. You can return tags from a specific resource by
+         * specifying an ARN, or you can return all tags for a given type of resource, such
+         * as clusters, snapshots, and so on.</p> <p> The following are limitations for
+         * <code>DescribeTags</code>: <ul> <li>You cannot specify an ARN and a
          * resource-type value together in the same request.</li> <li>You cannot use the
          * <code>MaxRecords</code> and <code>Marker</code> parameters together with the ARN
          * parameter.</li> <li>The <code>MaxRecords</code> parameter can be a range from 10
@@ -2166,6 +2685,18 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTagsCallable(const Model::DescribeTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(Model::DescribeTagsRequest&& request) const;
+
+        /**
+         * Same as DescribeTagsAsync(const Model::DescribeTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTagsAsync(Model::DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stops logging information, such as queries and connection attempts, for the
          * specified Amazon Redshift cluster.</p>
@@ -2188,6 +2719,18 @@ namespace Model
          */
         virtual void DisableLoggingAsync(const Model::DisableLoggingRequest& request, const DisableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableLoggingCallable(const Model::DisableLoggingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableLoggingOutcomeCallable DisableLoggingCallable(Model::DisableLoggingRequest&& request) const;
+
+        /**
+         * Same as DisableLoggingAsync(const Model::DisableLoggingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableLoggingAsync(Model::DisableLoggingRequest&& request, const DisableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables the automatic copying of snapshots from one region to another region
          * for a specified cluster.</p> <p>If your cluster and its snapshots are encrypted
@@ -2219,6 +2762,18 @@ namespace Model
          */
         virtual void DisableSnapshotCopyAsync(const Model::DisableSnapshotCopyRequest& request, const DisableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableSnapshotCopyCallable(const Model::DisableSnapshotCopyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableSnapshotCopyOutcomeCallable DisableSnapshotCopyCallable(Model::DisableSnapshotCopyRequest&& request) const;
+
+        /**
+         * Same as DisableSnapshotCopyAsync(const Model::DisableSnapshotCopyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableSnapshotCopyAsync(Model::DisableSnapshotCopyRequest&& request, const DisableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts logging information, such as queries and connection attempts, for the
          * specified Amazon Redshift cluster.</p>
@@ -2241,6 +2796,18 @@ namespace Model
          */
         virtual void EnableLoggingAsync(const Model::EnableLoggingRequest& request, const EnableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableLoggingCallable(const Model::EnableLoggingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableLoggingOutcomeCallable EnableLoggingCallable(Model::EnableLoggingRequest&& request) const;
+
+        /**
+         * Same as EnableLoggingAsync(const Model::EnableLoggingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableLoggingAsync(Model::EnableLoggingRequest&& request, const EnableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables the automatic copy of snapshots from one region to another region for
          * a specified cluster.</p>
@@ -2263,6 +2830,18 @@ namespace Model
          */
         virtual void EnableSnapshotCopyAsync(const Model::EnableSnapshotCopyRequest& request, const EnableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableSnapshotCopyCallable(const Model::EnableSnapshotCopyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableSnapshotCopyOutcomeCallable EnableSnapshotCopyCallable(Model::EnableSnapshotCopyRequest&& request) const;
+
+        /**
+         * Same as EnableSnapshotCopyAsync(const Model::EnableSnapshotCopyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableSnapshotCopyAsync(Model::EnableSnapshotCopyRequest&& request, const EnableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies the settings for a cluster. For example, you can add another
          * security or parameter group, update the preferred maintenance window, or change
@@ -2312,6 +2891,18 @@ namespace Model
          */
         virtual void ModifyClusterAsync(const Model::ModifyClusterRequest& request, const ModifyClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyClusterCallable(const Model::ModifyClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyClusterOutcomeCallable ModifyClusterCallable(Model::ModifyClusterRequest&& request) const;
+
+        /**
+         * Same as ModifyClusterAsync(const Model::ModifyClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyClusterAsync(Model::ModifyClusterRequest&& request, const ModifyClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the list of AWS Identity and Access Management (IAM) roles that can
          * be used by the cluster to access other AWS services. </p> <p>A cluster can have
@@ -2337,6 +2928,18 @@ namespace Model
          */
         virtual void ModifyClusterIamRolesAsync(const Model::ModifyClusterIamRolesRequest& request, const ModifyClusterIamRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyClusterIamRolesCallable(const Model::ModifyClusterIamRolesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyClusterIamRolesOutcomeCallable ModifyClusterIamRolesCallable(Model::ModifyClusterIamRolesRequest&& request) const;
+
+        /**
+         * Same as ModifyClusterIamRolesAsync(const Model::ModifyClusterIamRolesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyClusterIamRolesAsync(Model::ModifyClusterIamRolesRequest&& request, const ModifyClusterIamRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies the parameters of a parameter group. </p> <p> For more information
          * about parameters and parameter groups, go to <a
@@ -2368,6 +2971,18 @@ namespace Model
          */
         virtual void ModifyClusterParameterGroupAsync(const Model::ModifyClusterParameterGroupRequest& request, const ModifyClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyClusterParameterGroupCallable(const Model::ModifyClusterParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyClusterParameterGroupOutcomeCallable ModifyClusterParameterGroupCallable(Model::ModifyClusterParameterGroupRequest&& request) const;
+
+        /**
+         * Same as ModifyClusterParameterGroupAsync(const Model::ModifyClusterParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyClusterParameterGroupAsync(Model::ModifyClusterParameterGroupRequest&& request, const ModifyClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies a cluster subnet group to include the specified list of VPC
          * subnets. The operation replaces the existing list of subnets with the new list
@@ -2393,6 +3008,18 @@ namespace Model
          */
         virtual void ModifyClusterSubnetGroupAsync(const Model::ModifyClusterSubnetGroupRequest& request, const ModifyClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyClusterSubnetGroupCallable(const Model::ModifyClusterSubnetGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyClusterSubnetGroupOutcomeCallable ModifyClusterSubnetGroupCallable(Model::ModifyClusterSubnetGroupRequest&& request) const;
+
+        /**
+         * Same as ModifyClusterSubnetGroupAsync(const Model::ModifyClusterSubnetGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyClusterSubnetGroupAsync(Model::ModifyClusterSubnetGroupRequest&& request, const ModifyClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies an existing Amazon Redshift event notification subscription. </p>
          */
@@ -2412,6 +3039,18 @@ namespace Model
          */
         virtual void ModifyEventSubscriptionAsync(const Model::ModifyEventSubscriptionRequest& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyEventSubscriptionCallable(const Model::ModifyEventSubscriptionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyEventSubscriptionOutcomeCallable ModifyEventSubscriptionCallable(Model::ModifyEventSubscriptionRequest&& request) const;
+
+        /**
+         * Same as ModifyEventSubscriptionAsync(const Model::ModifyEventSubscriptionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyEventSubscriptionAsync(Model::ModifyEventSubscriptionRequest&& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies the number of days to retain automated snapshots in the destination
          * region after they are copied from the source region. </p>
@@ -2434,6 +3073,18 @@ namespace Model
          */
         virtual void ModifySnapshotCopyRetentionPeriodAsync(const Model::ModifySnapshotCopyRetentionPeriodRequest& request, const ModifySnapshotCopyRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifySnapshotCopyRetentionPeriodCallable(const Model::ModifySnapshotCopyRetentionPeriodRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifySnapshotCopyRetentionPeriodOutcomeCallable ModifySnapshotCopyRetentionPeriodCallable(Model::ModifySnapshotCopyRetentionPeriodRequest&& request) const;
+
+        /**
+         * Same as ModifySnapshotCopyRetentionPeriodAsync(const Model::ModifySnapshotCopyRetentionPeriodRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifySnapshotCopyRetentionPeriodAsync(Model::ModifySnapshotCopyRetentionPeriodRequest&& request, const ModifySnapshotCopyRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Allows you to purchase reserved nodes. Amazon Redshift offers a predefined
          * set of reserved node offerings. You can purchase one or more of the offerings.
@@ -2474,6 +3125,18 @@ namespace Model
          */
         virtual void PurchaseReservedNodeOfferingAsync(const Model::PurchaseReservedNodeOfferingRequest& request, const PurchaseReservedNodeOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PurchaseReservedNodeOfferingCallable(const Model::PurchaseReservedNodeOfferingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PurchaseReservedNodeOfferingOutcomeCallable PurchaseReservedNodeOfferingCallable(Model::PurchaseReservedNodeOfferingRequest&& request) const;
+
+        /**
+         * Same as PurchaseReservedNodeOfferingAsync(const Model::PurchaseReservedNodeOfferingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PurchaseReservedNodeOfferingAsync(Model::PurchaseReservedNodeOfferingRequest&& request, const PurchaseReservedNodeOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Reboots a cluster. This action is taken as soon as possible. It results in a
          * momentary outage to the cluster, during which the cluster status is set to
@@ -2514,6 +3177,18 @@ namespace Model
          */
         virtual void RebootClusterAsync(const Model::RebootClusterRequest& request, const RebootClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebootClusterCallable(const Model::RebootClusterRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RebootClusterOutcomeCallable RebootClusterCallable(Model::RebootClusterRequest&& request) const;
+
+        /**
+         * Same as RebootClusterAsync(const Model::RebootClusterRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RebootClusterAsync(Model::RebootClusterRequest&& request, const RebootClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Sets one or more parameters of the specified parameter group to their
          * default values and sets the source values of the parameters to "engine-default".
@@ -2545,6 +3220,18 @@ namespace Model
          */
         virtual void ResetClusterParameterGroupAsync(const Model::ResetClusterParameterGroupRequest& request, const ResetClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetClusterParameterGroupCallable(const Model::ResetClusterParameterGroupRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResetClusterParameterGroupOutcomeCallable ResetClusterParameterGroupCallable(Model::ResetClusterParameterGroupRequest&& request) const;
+
+        /**
+         * Same as ResetClusterParameterGroupAsync(const Model::ResetClusterParameterGroupRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResetClusterParameterGroupAsync(Model::ResetClusterParameterGroupRequest&& request, const ResetClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new cluster from a snapshot. By default, Amazon Redshift creates
          * the resulting cluster with the same configuration as the original cluster from
@@ -2600,6 +3287,18 @@ namespace Model
          */
         virtual void RestoreFromClusterSnapshotAsync(const Model::RestoreFromClusterSnapshotRequest& request, const RestoreFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreFromClusterSnapshotCallable(const Model::RestoreFromClusterSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RestoreFromClusterSnapshotOutcomeCallable RestoreFromClusterSnapshotCallable(Model::RestoreFromClusterSnapshotRequest&& request) const;
+
+        /**
+         * Same as RestoreFromClusterSnapshotAsync(const Model::RestoreFromClusterSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RestoreFromClusterSnapshotAsync(Model::RestoreFromClusterSnapshotRequest&& request, const RestoreFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new table from a table in an Amazon Redshift cluster snapshot. You
          * must create the new table within the Amazon Redshift cluster that the snapshot
@@ -2652,6 +3351,18 @@ namespace Model
          */
         virtual void RestoreTableFromClusterSnapshotAsync(const Model::RestoreTableFromClusterSnapshotRequest& request, const RestoreTableFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreTableFromClusterSnapshotCallable(const Model::RestoreTableFromClusterSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RestoreTableFromClusterSnapshotOutcomeCallable RestoreTableFromClusterSnapshotCallable(Model::RestoreTableFromClusterSnapshotRequest&& request) const;
+
+        /**
+         * Same as RestoreTableFromClusterSnapshotAsync(const Model::RestoreTableFromClusterSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RestoreTableFromClusterSnapshotAsync(Model::RestoreTableFromClusterSnapshotRequest&& request, const RestoreTableFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Revokes an ingress rule in an Amazon Redshift security group for a
          * previously authorized IP range or Amazon EC2 security group. To add an ingress
@@ -2689,6 +3400,18 @@ namespace Model
          */
         virtual void RevokeClusterSecurityGroupIngressAsync(const Model::RevokeClusterSecurityGroupIngressRequest& request, const RevokeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RevokeClusterSecurityGroupIngressCallable(const Model::RevokeClusterSecurityGroupIngressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RevokeClusterSecurityGroupIngressOutcomeCallable RevokeClusterSecurityGroupIngressCallable(Model::RevokeClusterSecurityGroupIngressRequest&& request) const;
+
+        /**
+         * Same as RevokeClusterSecurityGroupIngressAsync(const Model::RevokeClusterSecurityGroupIngressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RevokeClusterSecurityGroupIngressAsync(Model::RevokeClusterSecurityGroupIngressRequest&& request, const RevokeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Removes the ability of the specified AWS customer account to restore the
          * specified snapshot. If the account is currently restoring the snapshot, the
@@ -2726,6 +3449,18 @@ namespace Model
          */
         virtual void RevokeSnapshotAccessAsync(const Model::RevokeSnapshotAccessRequest& request, const RevokeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RevokeSnapshotAccessCallable(const Model::RevokeSnapshotAccessRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RevokeSnapshotAccessOutcomeCallable RevokeSnapshotAccessCallable(Model::RevokeSnapshotAccessRequest&& request) const;
+
+        /**
+         * Same as RevokeSnapshotAccessAsync(const Model::RevokeSnapshotAccessRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RevokeSnapshotAccessAsync(Model::RevokeSnapshotAccessRequest&& request, const RevokeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Rotates the encryption keys for a cluster. </p>
          */
@@ -2745,6 +3480,415 @@ namespace Model
          */
         virtual void RotateEncryptionKeyAsync(const Model::RotateEncryptionKeyRequest& request, const RotateEncryptionKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RotateEncryptionKeyCallable(const Model::RotateEncryptionKeyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RotateEncryptionKeyOutcomeCallable RotateEncryptionKeyCallable(Model::RotateEncryptionKeyRequest&& request) const;
+
+        /**
+         * Same as RotateEncryptionKeyAsync(const Model::RotateEncryptionKeyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RotateEncryptionKeyAsync(Model::RotateEncryptionKeyRequest&& request, const RotateEncryptionKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeClusterParameterGroups(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeClusterParameterGroupsRequest, Model::DescribeClusterParameterGroupsOutcome> DescribeClusterParameterGroupsPaginator(const Model::DescribeClusterParameterGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeClusterParameters(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeClusterParametersRequest, Model::DescribeClusterParametersOutcome> DescribeClusterParametersPaginator(const Model::DescribeClusterParametersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeClusterSecurityGroups(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeClusterSecurityGroupsRequest, Model::DescribeClusterSecurityGroupsOutcome> DescribeClusterSecurityGroupsPaginator(const Model::DescribeClusterSecurityGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeClusterSnapshots(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeClusterSnapshotsRequest, Model::DescribeClusterSnapshotsOutcome> DescribeClusterSnapshotsPaginator(const Model::DescribeClusterSnapshotsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeClusterSubnetGroups(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeClusterSubnetGroupsRequest, Model::DescribeClusterSubnetGroupsOutcome> DescribeClusterSubnetGroupsPaginator(const Model::DescribeClusterSubnetGroupsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeClusterVersions(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeClusterVersionsRequest, Model::DescribeClusterVersionsOutcome> DescribeClusterVersionsPaginator(const Model::DescribeClusterVersionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeClusters(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeClustersRequest, Model::DescribeClustersOutcome> DescribeClustersPaginator(const Model::DescribeClustersRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeEventSubscriptions(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeEventSubscriptionsRequest, Model::DescribeEventSubscriptionsOutcome> DescribeEventSubscriptionsPaginator(const Model::DescribeEventSubscriptionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeEvents(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeEventsRequest, Model::DescribeEventsOutcome> DescribeEventsPaginator(const Model::DescribeEventsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeHsmClientCertificates(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeHsmClientCertificatesRequest, Model::DescribeHsmClientCertificatesOutcome> DescribeHsmClientCertificatesPaginator(const Model::DescribeHsmClientCertificatesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeHsmConfigurations(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeHsmConfigurationsRequest, Model::DescribeHsmConfigurationsOutcome> DescribeHsmConfigurationsPaginator(const Model::DescribeHsmConfigurationsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeOrderableClusterOptions(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeOrderableClusterOptionsRequest, Model::DescribeOrderableClusterOptionsOutcome> DescribeOrderableClusterOptionsPaginator(const Model::DescribeOrderableClusterOptionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeReservedNodeOfferings(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeReservedNodeOfferingsRequest, Model::DescribeReservedNodeOfferingsOutcome> DescribeReservedNodeOfferingsPaginator(const Model::DescribeReservedNodeOfferingsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeReservedNodes(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeReservedNodesRequest, Model::DescribeReservedNodesOutcome> DescribeReservedNodesPaginator(const Model::DescribeReservedNodesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeSnapshotCopyGrants(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeSnapshotCopyGrantsRequest, Model::DescribeSnapshotCopyGrantsOutcome> DescribeSnapshotCopyGrantsPaginator(const Model::DescribeSnapshotCopyGrantsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeTableRestoreStatus(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeTableRestoreStatusRequest, Model::DescribeTableRestoreStatusOutcome> DescribeTableRestoreStatusPaginator(const Model::DescribeTableRestoreStatusRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeTags(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<RedshiftClient, Model::DescribeTagsRequest, Model::DescribeTagsOutcome> DescribeTagsPaginator(const Model::DescribeTagsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AuthorizeClusterSecurityGroupIngress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::AuthorizeClusterSecurityGroupIngressRequest, Model::AuthorizeClusterSecurityGroupIngressOutcome> AuthorizeClusterSecurityGroupIngressAwaitable(Model::AuthorizeClusterSecurityGroupIngressRequest request) const;
+
+        /**
+         * co_await-able form of AuthorizeSnapshotAccess(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::AuthorizeSnapshotAccessRequest, Model::AuthorizeSnapshotAccessOutcome> AuthorizeSnapshotAccessAwaitable(Model::AuthorizeSnapshotAccessRequest request) const;
+
+        /**
+         * co_await-able form of CopyClusterSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::CopyClusterSnapshotRequest, Model::CopyClusterSnapshotOutcome> CopyClusterSnapshotAwaitable(Model::CopyClusterSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of CreateCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::CreateClusterRequest, Model::CreateClusterOutcome> CreateClusterAwaitable(Model::CreateClusterRequest request) const;
+
+        /**
+         * co_await-able form of CreateClusterParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::CreateClusterParameterGroupRequest, Model::CreateClusterParameterGroupOutcome> CreateClusterParameterGroupAwaitable(Model::CreateClusterParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateClusterSecurityGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::CreateClusterSecurityGroupRequest, Model::CreateClusterSecurityGroupOutcome> CreateClusterSecurityGroupAwaitable(Model::CreateClusterSecurityGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateClusterSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::CreateClusterSnapshotRequest, Model::CreateClusterSnapshotOutcome> CreateClusterSnapshotAwaitable(Model::CreateClusterSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of CreateClusterSubnetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::CreateClusterSubnetGroupRequest, Model::CreateClusterSubnetGroupOutcome> CreateClusterSubnetGroupAwaitable(Model::CreateClusterSubnetGroupRequest request) const;
+
+        /**
+         * co_await-able form of CreateEventSubscription(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::CreateEventSubscriptionRequest, Model::CreateEventSubscriptionOutcome> CreateEventSubscriptionAwaitable(Model::CreateEventSubscriptionRequest request) const;
+
+        /**
+         * co_await-able form of CreateHsmClientCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::CreateHsmClientCertificateRequest, Model::CreateHsmClientCertificateOutcome> CreateHsmClientCertificateAwaitable(Model::CreateHsmClientCertificateRequest request) const;
+
+        /**
+         * co_await-able form of CreateHsmConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::CreateHsmConfigurationRequest, Model::CreateHsmConfigurationOutcome> CreateHsmConfigurationAwaitable(Model::CreateHsmConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of CreateSnapshotCopyGrant(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::CreateSnapshotCopyGrantRequest, Model::CreateSnapshotCopyGrantOutcome> CreateSnapshotCopyGrantAwaitable(Model::CreateSnapshotCopyGrantRequest request) const;
+
+        /**
+         * co_await-able form of CreateTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::CreateTagsRequest, Model::CreateTagsOutcome> CreateTagsAwaitable(Model::CreateTagsRequest request) const;
+
+        /**
+         * co_await-able form of DeleteCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DeleteClusterRequest, Model::DeleteClusterOutcome> DeleteClusterAwaitable(Model::DeleteClusterRequest request) const;
+
+        /**
+         * co_await-able form of DeleteClusterParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DeleteClusterParameterGroupRequest, Model::DeleteClusterParameterGroupOutcome> DeleteClusterParameterGroupAwaitable(Model::DeleteClusterParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteClusterSecurityGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DeleteClusterSecurityGroupRequest, Model::DeleteClusterSecurityGroupOutcome> DeleteClusterSecurityGroupAwaitable(Model::DeleteClusterSecurityGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteClusterSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DeleteClusterSnapshotRequest, Model::DeleteClusterSnapshotOutcome> DeleteClusterSnapshotAwaitable(Model::DeleteClusterSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of DeleteClusterSubnetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DeleteClusterSubnetGroupRequest, Model::DeleteClusterSubnetGroupOutcome> DeleteClusterSubnetGroupAwaitable(Model::DeleteClusterSubnetGroupRequest request) const;
+
+        /**
+         * co_await-able form of DeleteEventSubscription(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DeleteEventSubscriptionRequest, Model::DeleteEventSubscriptionOutcome> DeleteEventSubscriptionAwaitable(Model::DeleteEventSubscriptionRequest request) const;
+
+        /**
+         * co_await-able form of DeleteHsmClientCertificate(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DeleteHsmClientCertificateRequest, Model::DeleteHsmClientCertificateOutcome> DeleteHsmClientCertificateAwaitable(Model::DeleteHsmClientCertificateRequest request) const;
+
+        /**
+         * co_await-able form of DeleteHsmConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DeleteHsmConfigurationRequest, Model::DeleteHsmConfigurationOutcome> DeleteHsmConfigurationAwaitable(Model::DeleteHsmConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of DeleteSnapshotCopyGrant(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DeleteSnapshotCopyGrantRequest, Model::DeleteSnapshotCopyGrantOutcome> DeleteSnapshotCopyGrantAwaitable(Model::DeleteSnapshotCopyGrantRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DeleteTagsRequest, Model::DeleteTagsOutcome> DeleteTagsAwaitable(Model::DeleteTagsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeClusterParameterGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeClusterParameterGroupsRequest, Model::DescribeClusterParameterGroupsOutcome> DescribeClusterParameterGroupsAwaitable(Model::DescribeClusterParameterGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeClusterParameters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeClusterParametersRequest, Model::DescribeClusterParametersOutcome> DescribeClusterParametersAwaitable(Model::DescribeClusterParametersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeClusterSecurityGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeClusterSecurityGroupsRequest, Model::DescribeClusterSecurityGroupsOutcome> DescribeClusterSecurityGroupsAwaitable(Model::DescribeClusterSecurityGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeClusterSnapshots(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeClusterSnapshotsRequest, Model::DescribeClusterSnapshotsOutcome> DescribeClusterSnapshotsAwaitable(Model::DescribeClusterSnapshotsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeClusterSubnetGroups(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeClusterSubnetGroupsRequest, Model::DescribeClusterSubnetGroupsOutcome> DescribeClusterSubnetGroupsAwaitable(Model::DescribeClusterSubnetGroupsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeClusterVersions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeClusterVersionsRequest, Model::DescribeClusterVersionsOutcome> DescribeClusterVersionsAwaitable(Model::DescribeClusterVersionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeClusters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeClustersRequest, Model::DescribeClustersOutcome> DescribeClustersAwaitable(Model::DescribeClustersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDefaultClusterParameters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeDefaultClusterParametersRequest, Model::DescribeDefaultClusterParametersOutcome> DescribeDefaultClusterParametersAwaitable(Model::DescribeDefaultClusterParametersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEventCategories(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeEventCategoriesRequest, Model::DescribeEventCategoriesOutcome> DescribeEventCategoriesAwaitable(Model::DescribeEventCategoriesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEventSubscriptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeEventSubscriptionsRequest, Model::DescribeEventSubscriptionsOutcome> DescribeEventSubscriptionsAwaitable(Model::DescribeEventSubscriptionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeEvents(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeEventsRequest, Model::DescribeEventsOutcome> DescribeEventsAwaitable(Model::DescribeEventsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeHsmClientCertificates(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeHsmClientCertificatesRequest, Model::DescribeHsmClientCertificatesOutcome> DescribeHsmClientCertificatesAwaitable(Model::DescribeHsmClientCertificatesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeHsmConfigurations(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeHsmConfigurationsRequest, Model::DescribeHsmConfigurationsOutcome> DescribeHsmConfigurationsAwaitable(Model::DescribeHsmConfigurationsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeLoggingStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeLoggingStatusRequest, Model::DescribeLoggingStatusOutcome> DescribeLoggingStatusAwaitable(Model::DescribeLoggingStatusRequest request) const;
+
+        /**
+         * co_await-able form of DescribeOrderableClusterOptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeOrderableClusterOptionsRequest, Model::DescribeOrderableClusterOptionsOutcome> DescribeOrderableClusterOptionsAwaitable(Model::DescribeOrderableClusterOptionsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReservedNodeOfferings(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeReservedNodeOfferingsRequest, Model::DescribeReservedNodeOfferingsOutcome> DescribeReservedNodeOfferingsAwaitable(Model::DescribeReservedNodeOfferingsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeReservedNodes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeReservedNodesRequest, Model::DescribeReservedNodesOutcome> DescribeReservedNodesAwaitable(Model::DescribeReservedNodesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeResize(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeResizeRequest, Model::DescribeResizeOutcome> DescribeResizeAwaitable(Model::DescribeResizeRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSnapshotCopyGrants(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeSnapshotCopyGrantsRequest, Model::DescribeSnapshotCopyGrantsOutcome> DescribeSnapshotCopyGrantsAwaitable(Model::DescribeSnapshotCopyGrantsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTableRestoreStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeTableRestoreStatusRequest, Model::DescribeTableRestoreStatusOutcome> DescribeTableRestoreStatusAwaitable(Model::DescribeTableRestoreStatusRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DescribeTagsRequest, Model::DescribeTagsOutcome> DescribeTagsAwaitable(Model::DescribeTagsRequest request) const;
+
+        /**
+         * co_await-able form of DisableLogging(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DisableLoggingRequest, Model::DisableLoggingOutcome> DisableLoggingAwaitable(Model::DisableLoggingRequest request) const;
+
+        /**
+         * co_await-able form of DisableSnapshotCopy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::DisableSnapshotCopyRequest, Model::DisableSnapshotCopyOutcome> DisableSnapshotCopyAwaitable(Model::DisableSnapshotCopyRequest request) const;
+
+        /**
+         * co_await-able form of EnableLogging(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::EnableLoggingRequest, Model::EnableLoggingOutcome> EnableLoggingAwaitable(Model::EnableLoggingRequest request) const;
+
+        /**
+         * co_await-able form of EnableSnapshotCopy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::EnableSnapshotCopyRequest, Model::EnableSnapshotCopyOutcome> EnableSnapshotCopyAwaitable(Model::EnableSnapshotCopyRequest request) const;
+
+        /**
+         * co_await-able form of ModifyCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::ModifyClusterRequest, Model::ModifyClusterOutcome> ModifyClusterAwaitable(Model::ModifyClusterRequest request) const;
+
+        /**
+         * co_await-able form of ModifyClusterIamRoles(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::ModifyClusterIamRolesRequest, Model::ModifyClusterIamRolesOutcome> ModifyClusterIamRolesAwaitable(Model::ModifyClusterIamRolesRequest request) const;
+
+        /**
+         * co_await-able form of ModifyClusterParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::ModifyClusterParameterGroupRequest, Model::ModifyClusterParameterGroupOutcome> ModifyClusterParameterGroupAwaitable(Model::ModifyClusterParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of ModifyClusterSubnetGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::ModifyClusterSubnetGroupRequest, Model::ModifyClusterSubnetGroupOutcome> ModifyClusterSubnetGroupAwaitable(Model::ModifyClusterSubnetGroupRequest request) const;
+
+        /**
+         * co_await-able form of ModifyEventSubscription(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::ModifyEventSubscriptionRequest, Model::ModifyEventSubscriptionOutcome> ModifyEventSubscriptionAwaitable(Model::ModifyEventSubscriptionRequest request) const;
+
+        /**
+         * co_await-able form of ModifySnapshotCopyRetentionPeriod(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::ModifySnapshotCopyRetentionPeriodRequest, Model::ModifySnapshotCopyRetentionPeriodOutcome> ModifySnapshotCopyRetentionPeriodAwaitable(Model::ModifySnapshotCopyRetentionPeriodRequest request) const;
+
+        /**
+         * co_await-able form of PurchaseReservedNodeOffering(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::PurchaseReservedNodeOfferingRequest, Model::PurchaseReservedNodeOfferingOutcome> PurchaseReservedNodeOfferingAwaitable(Model::PurchaseReservedNodeOfferingRequest request) const;
+
+        /**
+         * co_await-able form of RebootCluster(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::RebootClusterRequest, Model::RebootClusterOutcome> RebootClusterAwaitable(Model::RebootClusterRequest request) const;
+
+        /**
+         * co_await-able form of ResetClusterParameterGroup(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::ResetClusterParameterGroupRequest, Model::ResetClusterParameterGroupOutcome> ResetClusterParameterGroupAwaitable(Model::ResetClusterParameterGroupRequest request) const;
+
+        /**
+         * co_await-able form of RestoreFromClusterSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::RestoreFromClusterSnapshotRequest, Model::RestoreFromClusterSnapshotOutcome> RestoreFromClusterSnapshotAwaitable(Model::RestoreFromClusterSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of RestoreTableFromClusterSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::RestoreTableFromClusterSnapshotRequest, Model::RestoreTableFromClusterSnapshotOutcome> RestoreTableFromClusterSnapshotAwaitable(Model::RestoreTableFromClusterSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of RevokeClusterSecurityGroupIngress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::RevokeClusterSecurityGroupIngressRequest, Model::RevokeClusterSecurityGroupIngressOutcome> RevokeClusterSecurityGroupIngressAwaitable(Model::RevokeClusterSecurityGroupIngressRequest request) const;
+
+        /**
+         * co_await-able form of RevokeSnapshotAccess(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::RevokeSnapshotAccessRequest, Model::RevokeSnapshotAccessOutcome> RevokeSnapshotAccessAwaitable(Model::RevokeSnapshotAccessRequest request) const;
+
+        /**
+         * co_await-able form of RotateEncryptionKey(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<RedshiftClient, Model::RotateEncryptionKeyRequest, Model::RotateEncryptionKeyOutcome> RotateEncryptionKeyAwaitable(Model::RotateEncryptionKeyRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
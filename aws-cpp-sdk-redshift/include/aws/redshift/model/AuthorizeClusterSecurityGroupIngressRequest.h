@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AuthorizeClusterSecurityGroupIngressRequest();
+    inline const char* GetServiceRequestName() const override { return "AuthorizeClusterSecurityGroupIngress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
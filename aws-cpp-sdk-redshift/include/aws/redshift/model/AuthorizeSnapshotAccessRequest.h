@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AuthorizeSnapshotAccessRequest();
+    inline const char* GetServiceRequestName() const override { return "AuthorizeSnapshotAccess"; }
+
     Aws::String SerializePayload() const override;
 
     /**
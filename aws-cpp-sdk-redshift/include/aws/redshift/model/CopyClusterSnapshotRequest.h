@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CopyClusterSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "CopyClusterSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateClusterParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateClusterParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateCluster"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateClusterSecurityGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateClusterSecurityGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateClusterSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateClusterSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
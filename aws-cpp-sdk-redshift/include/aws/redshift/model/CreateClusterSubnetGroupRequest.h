@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateClusterSubnetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateClusterSubnetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
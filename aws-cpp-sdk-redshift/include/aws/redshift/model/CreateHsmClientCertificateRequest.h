@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateHsmClientCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateHsmClientCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateHsmConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateHsmConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateSnapshotCopyGrantRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateSnapshotCopyGrant"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteClusterParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteClusterParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
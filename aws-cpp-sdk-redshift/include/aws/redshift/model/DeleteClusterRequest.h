@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteCluster"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteClusterSecurityGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteClusterSecurityGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
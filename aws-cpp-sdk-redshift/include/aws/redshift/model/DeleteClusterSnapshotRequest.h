@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteClusterSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteClusterSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
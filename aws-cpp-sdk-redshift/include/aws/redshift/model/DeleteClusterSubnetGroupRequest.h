@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteClusterSubnetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteClusterSubnetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteHsmClientCertificateRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteHsmClientCertificate"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteHsmConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteHsmConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
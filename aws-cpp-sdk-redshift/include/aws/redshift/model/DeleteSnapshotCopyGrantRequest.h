@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteSnapshotCopyGrantRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteSnapshotCopyGrant"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeClusterParameterGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeClusterParameterGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeClusterParametersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeClusterParameters"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeClusterSecurityGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeClusterSecurityGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeClusterSnapshotsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeClusterSnapshots"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeClusterSubnetGroupsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeClusterSubnetGroups"; }
+
     Aws::String SerializePayload() const override;
 
     /**
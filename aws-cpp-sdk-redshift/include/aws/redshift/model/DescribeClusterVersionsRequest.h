@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeClusterVersionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeClusterVersions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeClustersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeClusters"; }
+
     Aws::String SerializePayload() const override;
 
     /**
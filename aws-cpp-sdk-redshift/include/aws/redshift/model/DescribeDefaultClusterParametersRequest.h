@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeDefaultClusterParametersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDefaultClusterParameters"; }
+
     Aws::String SerializePayload() const override;
 
     /**
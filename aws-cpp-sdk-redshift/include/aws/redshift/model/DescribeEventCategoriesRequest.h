@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeEventCategoriesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEventCategories"; }
+
     Aws::String SerializePayload() const override;
 
     /**
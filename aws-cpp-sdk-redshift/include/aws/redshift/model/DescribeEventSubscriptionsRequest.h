@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeEventSubscriptionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeEventSubscriptions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeHsmClientCertificatesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeHsmClientCertificates"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeHsmConfigurationsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeHsmConfigurations"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeLoggingStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeLoggingStatus"; }
+
     Aws::String SerializePayload() const override;
 
     /**
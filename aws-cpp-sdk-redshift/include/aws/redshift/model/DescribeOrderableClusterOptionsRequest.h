@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeOrderableClusterOptionsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeOrderableClusterOptions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
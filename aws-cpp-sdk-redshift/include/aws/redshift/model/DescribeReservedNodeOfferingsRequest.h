@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeReservedNodeOfferingsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReservedNodeOfferings"; }
+
     Aws::String SerializePayload() const override;
 
     /**
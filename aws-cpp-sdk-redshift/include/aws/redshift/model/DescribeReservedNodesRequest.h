@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeReservedNodesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeReservedNodes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
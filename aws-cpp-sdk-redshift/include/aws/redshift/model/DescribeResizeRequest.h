@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeResizeRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeResize"; }
+
     Aws::String SerializePayload() const override;
 
     /**
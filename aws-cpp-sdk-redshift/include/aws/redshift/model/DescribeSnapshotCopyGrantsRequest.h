@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeSnapshotCopyGrantsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSnapshotCopyGrants"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeTableRestoreStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTableRestoreStatus"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DisableLoggingRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableLogging"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DisableSnapshotCopyRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableSnapshotCopy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     EnableLoggingRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableLogging"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     EnableSnapshotCopyRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableSnapshotCopy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
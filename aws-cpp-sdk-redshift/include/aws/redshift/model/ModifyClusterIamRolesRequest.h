@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyClusterIamRolesRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyClusterIamRoles"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ModifyClusterParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyClusterParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
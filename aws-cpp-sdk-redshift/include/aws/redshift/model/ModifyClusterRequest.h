@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyCluster"; }
+
     Aws::String SerializePayload() const override;
 
     /**
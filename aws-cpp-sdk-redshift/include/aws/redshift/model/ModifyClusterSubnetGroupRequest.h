@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyClusterSubnetGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyClusterSubnetGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyEventSubscriptionRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyEventSubscription"; }
+
     Aws::String SerializePayload() const override;
 
     /**
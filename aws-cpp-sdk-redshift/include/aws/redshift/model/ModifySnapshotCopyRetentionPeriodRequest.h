@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ModifySnapshotCopyRetentionPeriodRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifySnapshotCopyRetentionPeriod"; }
+
     Aws::String SerializePayload() const override;
 
     /**
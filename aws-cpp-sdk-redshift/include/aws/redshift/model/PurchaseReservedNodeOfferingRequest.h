@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PurchaseReservedNodeOfferingRequest();
+    inline const char* GetServiceRequestName() const override { return "PurchaseReservedNodeOffering"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RebootClusterRequest();
+    inline const char* GetServiceRequestName() const override { return "RebootCluster"; }
+
     Aws::String SerializePayload() const override;
 
     /**
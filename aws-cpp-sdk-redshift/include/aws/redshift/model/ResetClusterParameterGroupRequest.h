@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ResetClusterParameterGroupRequest();
+    inline const char* GetServiceRequestName() const override { return "ResetClusterParameterGroup"; }
+
     Aws::String SerializePayload() const override;
 
     /**
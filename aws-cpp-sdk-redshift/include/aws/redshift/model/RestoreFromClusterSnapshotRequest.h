@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RestoreFromClusterSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "RestoreFromClusterSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RestoreTableFromClusterSnapshotRequest();
+    inline const char* GetServiceRequestName() const override { return "RestoreTableFromClusterSnapshot"; }
+
     Aws::String SerializePayload() const override;
 
     /**
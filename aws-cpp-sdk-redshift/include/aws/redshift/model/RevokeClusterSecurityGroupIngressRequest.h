@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RevokeClusterSecurityGroupIngressRequest();
+    inline const char* GetServiceRequestName() const override { return "RevokeClusterSecurityGroupIngress"; }
+
     Aws::String SerializePayload() const override;
 
     /**
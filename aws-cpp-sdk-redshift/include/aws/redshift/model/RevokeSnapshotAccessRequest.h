@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RevokeSnapshotAccessRequest();
+    inline const char* GetServiceRequestName() const override { return "RevokeSnapshotAccess"; }
+
     Aws::String SerializePayload() const override;
 
     /**
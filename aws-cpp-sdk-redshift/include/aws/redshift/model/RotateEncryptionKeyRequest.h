@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RotateEncryptionKeyRequest();
+    inline const char* GetServiceRequestName() const override { return "RotateEncryptionKey"; }
+
     Aws::String SerializePayload() const override;
 
     /**
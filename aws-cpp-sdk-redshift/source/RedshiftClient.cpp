@@ -171,7 +171,7 @@ AuthorizeClusterSecurityGroupIngressOutcome RedshiftClient::AuthorizeClusterSecu
 
 AuthorizeClusterSecurityGroupIngressOutcomeCallable RedshiftClient::AuthorizeClusterSecurityGroupIngressCallable(const AuthorizeClusterSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AuthorizeClusterSecurityGroupIngress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AuthorizeClusterSecurityGroupIngress( request ); } );
 }
 
 void RedshiftClient::AuthorizeClusterSecurityGroupIngressAsync(const AuthorizeClusterSecurityGroupIngressRequest& request, const AuthorizeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -179,6 +179,16 @@ void RedshiftClient::AuthorizeClusterSecurityGroupIngressAsync(const AuthorizeCl
   m_executor->Submit( [this, request, handler, context](){ this->AuthorizeClusterSecurityGroupIngressAsyncHelper( request, handler, context ); } );
 }
 
+AuthorizeClusterSecurityGroupIngressOutcomeCallable RedshiftClient::AuthorizeClusterSecurityGroupIngressCallable(AuthorizeClusterSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::AuthorizeClusterSecurityGroupIngress, this, std::move(request)));
+}
+
+void RedshiftClient::AuthorizeClusterSecurityGroupIngressAsync(AuthorizeClusterSecurityGroupIngressRequest&& request, const AuthorizeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::AuthorizeClusterSecurityGroupIngressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::AuthorizeClusterSecurityGroupIngressAsyncHelper(const AuthorizeClusterSecurityGroupIngressRequest& request, const AuthorizeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AuthorizeClusterSecurityGroupIngress(request), context);
@@ -201,7 +211,7 @@ AuthorizeSnapshotAccessOutcome RedshiftClient::AuthorizeSnapshotAccess(const Aut
 
 AuthorizeSnapshotAccessOutcomeCallable RedshiftClient::AuthorizeSnapshotAccessCallable(const AuthorizeSnapshotAccessRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AuthorizeSnapshotAccess( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AuthorizeSnapshotAccess( request ); } );
 }
 
 void RedshiftClient::AuthorizeSnapshotAccessAsync(const AuthorizeSnapshotAccessRequest& request, const AuthorizeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -209,6 +219,16 @@ void RedshiftClient::AuthorizeSnapshotAccessAsync(const AuthorizeSnapshotAccessR
   m_executor->Submit( [this, request, handler, context](){ this->AuthorizeSnapshotAccessAsyncHelper( request, handler, context ); } );
 }
 
+AuthorizeSnapshotAccessOutcomeCallable RedshiftClient::AuthorizeSnapshotAccessCallable(AuthorizeSnapshotAccessRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::AuthorizeSnapshotAccess, this, std::move(request)));
+}
+
+void RedshiftClient::AuthorizeSnapshotAccessAsync(AuthorizeSnapshotAccessRequest&& request, const AuthorizeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::AuthorizeSnapshotAccessAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::AuthorizeSnapshotAccessAsyncHelper(const AuthorizeSnapshotAccessRequest& request, const AuthorizeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AuthorizeSnapshotAccess(request), context);
@@ -231,7 +251,7 @@ CopyClusterSnapshotOutcome RedshiftClient::CopyClusterSnapshot(const CopyCluster
 
 CopyClusterSnapshotOutcomeCallable RedshiftClient::CopyClusterSnapshotCallable(const CopyClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CopyClusterSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CopyClusterSnapshot( request ); } );
 }
 
 void RedshiftClient::CopyClusterSnapshotAsync(const CopyClusterSnapshotRequest& request, const CopyClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -239,6 +259,16 @@ void RedshiftClient::CopyClusterSnapshotAsync(const CopyClusterSnapshotRequest&
   m_executor->Submit( [this, request, handler, context](){ this->CopyClusterSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+CopyClusterSnapshotOutcomeCallable RedshiftClient::CopyClusterSnapshotCallable(CopyClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::CopyClusterSnapshot, this, std::move(request)));
+}
+
+void RedshiftClient::CopyClusterSnapshotAsync(CopyClusterSnapshotRequest&& request, const CopyClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::CopyClusterSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::CopyClusterSnapshotAsyncHelper(const CopyClusterSnapshotRequest& request, const CopyClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CopyClusterSnapshot(request), context);
@@ -261,7 +291,7 @@ CreateClusterOutcome RedshiftClient::CreateCluster(const CreateClusterRequest& r
 
 CreateClusterOutcomeCallable RedshiftClient::CreateClusterCallable(const CreateClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateCluster( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateCluster( request ); } );
 }
 
 void RedshiftClient::CreateClusterAsync(const CreateClusterRequest& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -269,6 +299,16 @@ void RedshiftClient::CreateClusterAsync(const CreateClusterRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->CreateClusterAsyncHelper( request, handler, context ); } );
 }
 
+CreateClusterOutcomeCallable RedshiftClient::CreateClusterCallable(CreateClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::CreateCluster, this, std::move(request)));
+}
+
+void RedshiftClient::CreateClusterAsync(CreateClusterRequest&& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::CreateClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::CreateClusterAsyncHelper(const CreateClusterRequest& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateCluster(request), context);
@@ -291,7 +331,7 @@ CreateClusterParameterGroupOutcome RedshiftClient::CreateClusterParameterGroup(c
 
 CreateClusterParameterGroupOutcomeCallable RedshiftClient::CreateClusterParameterGroupCallable(const CreateClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateClusterParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateClusterParameterGroup( request ); } );
 }
 
 void RedshiftClient::CreateClusterParameterGroupAsync(const CreateClusterParameterGroupRequest& request, const CreateClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -299,6 +339,16 @@ void RedshiftClient::CreateClusterParameterGroupAsync(const CreateClusterParamet
   m_executor->Submit( [this, request, handler, context](){ this->CreateClusterParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateClusterParameterGroupOutcomeCallable RedshiftClient::CreateClusterParameterGroupCallable(CreateClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::CreateClusterParameterGroup, this, std::move(request)));
+}
+
+void RedshiftClient::CreateClusterParameterGroupAsync(CreateClusterParameterGroupRequest&& request, const CreateClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::CreateClusterParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::CreateClusterParameterGroupAsyncHelper(const CreateClusterParameterGroupRequest& request, const CreateClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateClusterParameterGroup(request), context);
@@ -321,7 +371,7 @@ CreateClusterSecurityGroupOutcome RedshiftClient::CreateClusterSecurityGroup(con
 
 CreateClusterSecurityGroupOutcomeCallable RedshiftClient::CreateClusterSecurityGroupCallable(const CreateClusterSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateClusterSecurityGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateClusterSecurityGroup( request ); } );
 }
 
 void RedshiftClient::CreateClusterSecurityGroupAsync(const CreateClusterSecurityGroupRequest& request, const CreateClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -329,6 +379,16 @@ void RedshiftClient::CreateClusterSecurityGroupAsync(const CreateClusterSecurity
   m_executor->Submit( [this, request, handler, context](){ this->CreateClusterSecurityGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateClusterSecurityGroupOutcomeCallable RedshiftClient::CreateClusterSecurityGroupCallable(CreateClusterSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::CreateClusterSecurityGroup, this, std::move(request)));
+}
+
+void RedshiftClient::CreateClusterSecurityGroupAsync(CreateClusterSecurityGroupRequest&& request, const CreateClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::CreateClusterSecurityGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::CreateClusterSecurityGroupAsyncHelper(const CreateClusterSecurityGroupRequest& request, const CreateClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateClusterSecurityGroup(request), context);
@@ -351,7 +411,7 @@ CreateClusterSnapshotOutcome RedshiftClient::CreateClusterSnapshot(const CreateC
 
 CreateClusterSnapshotOutcomeCallable RedshiftClient::CreateClusterSnapshotCallable(const CreateClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateClusterSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateClusterSnapshot( request ); } );
 }
 
 void RedshiftClient::CreateClusterSnapshotAsync(const CreateClusterSnapshotRequest& request, const CreateClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -359,6 +419,16 @@ void RedshiftClient::CreateClusterSnapshotAsync(const CreateClusterSnapshotReque
   m_executor->Submit( [this, request, handler, context](){ this->CreateClusterSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+CreateClusterSnapshotOutcomeCallable RedshiftClient::CreateClusterSnapshotCallable(CreateClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::CreateClusterSnapshot, this, std::move(request)));
+}
+
+void RedshiftClient::CreateClusterSnapshotAsync(CreateClusterSnapshotRequest&& request, const CreateClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::CreateClusterSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::CreateClusterSnapshotAsyncHelper(const CreateClusterSnapshotRequest& request, const CreateClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateClusterSnapshot(request), context);
@@ -381,7 +451,7 @@ CreateClusterSubnetGroupOutcome RedshiftClient::CreateClusterSubnetGroup(const C
 
 CreateClusterSubnetGroupOutcomeCallable RedshiftClient::CreateClusterSubnetGroupCallable(const CreateClusterSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateClusterSubnetGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateClusterSubnetGroup( request ); } );
 }
 
 void RedshiftClient::CreateClusterSubnetGroupAsync(const CreateClusterSubnetGroupRequest& request, const CreateClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -389,6 +459,16 @@ void RedshiftClient::CreateClusterSubnetGroupAsync(const CreateClusterSubnetGrou
   m_executor->Submit( [this, request, handler, context](){ this->CreateClusterSubnetGroupAsyncHelper( request, handler, context ); } );
 }
 
+CreateClusterSubnetGroupOutcomeCallable RedshiftClient::CreateClusterSubnetGroupCallable(CreateClusterSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::CreateClusterSubnetGroup, this, std::move(request)));
+}
+
+void RedshiftClient::CreateClusterSubnetGroupAsync(CreateClusterSubnetGroupRequest&& request, const CreateClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::CreateClusterSubnetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::CreateClusterSubnetGroupAsyncHelper(const CreateClusterSubnetGroupRequest& request, const CreateClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateClusterSubnetGroup(request), context);
@@ -411,7 +491,7 @@ CreateEventSubscriptionOutcome RedshiftClient::CreateEventSubscription(const Cre
 
 CreateEventSubscriptionOutcomeCallable RedshiftClient::CreateEventSubscriptionCallable(const CreateEventSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateEventSubscription( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateEventSubscription( request ); } );
 }
 
 void RedshiftClient::CreateEventSubscriptionAsync(const CreateEventSubscriptionRequest& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -419,6 +499,16 @@ void RedshiftClient::CreateEventSubscriptionAsync(const CreateEventSubscriptionR
   m_executor->Submit( [this, request, handler, context](){ this->CreateEventSubscriptionAsyncHelper( request, handler, context ); } );
 }
 
+CreateEventSubscriptionOutcomeCallable RedshiftClient::CreateEventSubscriptionCallable(CreateEventSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::CreateEventSubscription, this, std::move(request)));
+}
+
+void RedshiftClient::CreateEventSubscriptionAsync(CreateEventSubscriptionRequest&& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::CreateEventSubscriptionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::CreateEventSubscriptionAsyncHelper(const CreateEventSubscriptionRequest& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateEventSubscription(request), context);
@@ -441,7 +531,7 @@ CreateHsmClientCertificateOutcome RedshiftClient::CreateHsmClientCertificate(con
 
 CreateHsmClientCertificateOutcomeCallable RedshiftClient::CreateHsmClientCertificateCallable(const CreateHsmClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateHsmClientCertificate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateHsmClientCertificate( request ); } );
 }
 
 void RedshiftClient::CreateHsmClientCertificateAsync(const CreateHsmClientCertificateRequest& request, const CreateHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -449,6 +539,16 @@ void RedshiftClient::CreateHsmClientCertificateAsync(const CreateHsmClientCertif
   m_executor->Submit( [this, request, handler, context](){ this->CreateHsmClientCertificateAsyncHelper( request, handler, context ); } );
 }
 
+CreateHsmClientCertificateOutcomeCallable RedshiftClient::CreateHsmClientCertificateCallable(CreateHsmClientCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::CreateHsmClientCertificate, this, std::move(request)));
+}
+
+void RedshiftClient::CreateHsmClientCertificateAsync(CreateHsmClientCertificateRequest&& request, const CreateHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::CreateHsmClientCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::CreateHsmClientCertificateAsyncHelper(const CreateHsmClientCertificateRequest& request, const CreateHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateHsmClientCertificate(request), context);
@@ -471,7 +571,7 @@ CreateHsmConfigurationOutcome RedshiftClient::CreateHsmConfiguration(const Creat
 
 CreateHsmConfigurationOutcomeCallable RedshiftClient::CreateHsmConfigurationCallable(const CreateHsmConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateHsmConfiguration( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateHsmConfiguration( request ); } );
 }
 
 void RedshiftClient::CreateHsmConfigurationAsync(const CreateHsmConfigurationRequest& request, const CreateHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -479,6 +579,16 @@ void RedshiftClient::CreateHsmConfigurationAsync(const CreateHsmConfigurationReq
   m_executor->Submit( [this, request, handler, context](){ this->CreateHsmConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+CreateHsmConfigurationOutcomeCallable RedshiftClient::CreateHsmConfigurationCallable(CreateHsmConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::CreateHsmConfiguration, this, std::move(request)));
+}
+
+void RedshiftClient::CreateHsmConfigurationAsync(CreateHsmConfigurationRequest&& request, const CreateHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::CreateHsmConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::CreateHsmConfigurationAsyncHelper(const CreateHsmConfigurationRequest& request, const CreateHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateHsmConfiguration(request), context);
@@ -501,7 +611,7 @@ CreateSnapshotCopyGrantOutcome RedshiftClient::CreateSnapshotCopyGrant(const Cre
 
 CreateSnapshotCopyGrantOutcomeCallable RedshiftClient::CreateSnapshotCopyGrantCallable(const CreateSnapshotCopyGrantRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateSnapshotCopyGrant( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateSnapshotCopyGrant( request ); } );
 }
 
 void RedshiftClient::CreateSnapshotCopyGrantAsync(const CreateSnapshotCopyGrantRequest& request, const CreateSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -509,6 +619,16 @@ void RedshiftClient::CreateSnapshotCopyGrantAsync(const CreateSnapshotCopyGrantR
   m_executor->Submit( [this, request, handler, context](){ this->CreateSnapshotCopyGrantAsyncHelper( request, handler, context ); } );
 }
 
+CreateSnapshotCopyGrantOutcomeCallable RedshiftClient::CreateSnapshotCopyGrantCallable(CreateSnapshotCopyGrantRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::CreateSnapshotCopyGrant, this, std::move(request)));
+}
+
+void RedshiftClient::CreateSnapshotCopyGrantAsync(CreateSnapshotCopyGrantRequest&& request, const CreateSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::CreateSnapshotCopyGrantAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::CreateSnapshotCopyGrantAsyncHelper(const CreateSnapshotCopyGrantRequest& request, const CreateSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateSnapshotCopyGrant(request), context);
@@ -531,7 +651,7 @@ CreateTagsOutcome RedshiftClient::CreateTags(const CreateTagsRequest& request) c
 
 CreateTagsOutcomeCallable RedshiftClient::CreateTagsCallable(const CreateTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateTags( request ); } );
 }
 
 void RedshiftClient::CreateTagsAsync(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -539,6 +659,16 @@ void RedshiftClient::CreateTagsAsync(const CreateTagsRequest& request, const Cre
   m_executor->Submit( [this, request, handler, context](){ this->CreateTagsAsyncHelper( request, handler, context ); } );
 }
 
+CreateTagsOutcomeCallable RedshiftClient::CreateTagsCallable(CreateTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::CreateTags, this, std::move(request)));
+}
+
+void RedshiftClient::CreateTagsAsync(CreateTagsRequest&& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::CreateTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::CreateTagsAsyncHelper(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateTags(request), context);
@@ -561,7 +691,7 @@ DeleteClusterOutcome RedshiftClient::DeleteCluster(const DeleteClusterRequest& r
 
 DeleteClusterOutcomeCallable RedshiftClient::DeleteClusterCallable(const DeleteClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteCluster( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteCluster( request ); } );
 }
 
 void RedshiftClient::DeleteClusterAsync(const DeleteClusterRequest& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -569,6 +699,16 @@ void RedshiftClient::DeleteClusterAsync(const DeleteClusterRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->DeleteClusterAsyncHelper( request, handler, context ); } );
 }
 
+DeleteClusterOutcomeCallable RedshiftClient::DeleteClusterCallable(DeleteClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DeleteCluster, this, std::move(request)));
+}
+
+void RedshiftClient::DeleteClusterAsync(DeleteClusterRequest&& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DeleteClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DeleteClusterAsyncHelper(const DeleteClusterRequest& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteCluster(request), context);
@@ -591,7 +731,7 @@ DeleteClusterParameterGroupOutcome RedshiftClient::DeleteClusterParameterGroup(c
 
 DeleteClusterParameterGroupOutcomeCallable RedshiftClient::DeleteClusterParameterGroupCallable(const DeleteClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteClusterParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteClusterParameterGroup( request ); } );
 }
 
 void RedshiftClient::DeleteClusterParameterGroupAsync(const DeleteClusterParameterGroupRequest& request, const DeleteClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -599,6 +739,16 @@ void RedshiftClient::DeleteClusterParameterGroupAsync(const DeleteClusterParamet
   m_executor->Submit( [this, request, handler, context](){ this->DeleteClusterParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteClusterParameterGroupOutcomeCallable RedshiftClient::DeleteClusterParameterGroupCallable(DeleteClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DeleteClusterParameterGroup, this, std::move(request)));
+}
+
+void RedshiftClient::DeleteClusterParameterGroupAsync(DeleteClusterParameterGroupRequest&& request, const DeleteClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DeleteClusterParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DeleteClusterParameterGroupAsyncHelper(const DeleteClusterParameterGroupRequest& request, const DeleteClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteClusterParameterGroup(request), context);
@@ -621,7 +771,7 @@ DeleteClusterSecurityGroupOutcome RedshiftClient::DeleteClusterSecurityGroup(con
 
 DeleteClusterSecurityGroupOutcomeCallable RedshiftClient::DeleteClusterSecurityGroupCallable(const DeleteClusterSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteClusterSecurityGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteClusterSecurityGroup( request ); } );
 }
 
 void RedshiftClient::DeleteClusterSecurityGroupAsync(const DeleteClusterSecurityGroupRequest& request, const DeleteClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -629,6 +779,16 @@ void RedshiftClient::DeleteClusterSecurityGroupAsync(const DeleteClusterSecurity
   m_executor->Submit( [this, request, handler, context](){ this->DeleteClusterSecurityGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteClusterSecurityGroupOutcomeCallable RedshiftClient::DeleteClusterSecurityGroupCallable(DeleteClusterSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DeleteClusterSecurityGroup, this, std::move(request)));
+}
+
+void RedshiftClient::DeleteClusterSecurityGroupAsync(DeleteClusterSecurityGroupRequest&& request, const DeleteClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DeleteClusterSecurityGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DeleteClusterSecurityGroupAsyncHelper(const DeleteClusterSecurityGroupRequest& request, const DeleteClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteClusterSecurityGroup(request), context);
@@ -651,7 +811,7 @@ DeleteClusterSnapshotOutcome RedshiftClient::DeleteClusterSnapshot(const DeleteC
 
 DeleteClusterSnapshotOutcomeCallable RedshiftClient::DeleteClusterSnapshotCallable(const DeleteClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteClusterSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteClusterSnapshot( request ); } );
 }
 
 void RedshiftClient::DeleteClusterSnapshotAsync(const DeleteClusterSnapshotRequest& request, const DeleteClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -659,6 +819,16 @@ void RedshiftClient::DeleteClusterSnapshotAsync(const DeleteClusterSnapshotReque
   m_executor->Submit( [this, request, handler, context](){ this->DeleteClusterSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+DeleteClusterSnapshotOutcomeCallable RedshiftClient::DeleteClusterSnapshotCallable(DeleteClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DeleteClusterSnapshot, this, std::move(request)));
+}
+
+void RedshiftClient::DeleteClusterSnapshotAsync(DeleteClusterSnapshotRequest&& request, const DeleteClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DeleteClusterSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DeleteClusterSnapshotAsyncHelper(const DeleteClusterSnapshotRequest& request, const DeleteClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteClusterSnapshot(request), context);
@@ -681,7 +851,7 @@ DeleteClusterSubnetGroupOutcome RedshiftClient::DeleteClusterSubnetGroup(const D
 
 DeleteClusterSubnetGroupOutcomeCallable RedshiftClient::DeleteClusterSubnetGroupCallable(const DeleteClusterSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteClusterSubnetGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteClusterSubnetGroup( request ); } );
 }
 
 void RedshiftClient::DeleteClusterSubnetGroupAsync(const DeleteClusterSubnetGroupRequest& request, const DeleteClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -689,6 +859,16 @@ void RedshiftClient::DeleteClusterSubnetGroupAsync(const DeleteClusterSubnetGrou
   m_executor->Submit( [this, request, handler, context](){ this->DeleteClusterSubnetGroupAsyncHelper( request, handler, context ); } );
 }
 
+DeleteClusterSubnetGroupOutcomeCallable RedshiftClient::DeleteClusterSubnetGroupCallable(DeleteClusterSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DeleteClusterSubnetGroup, this, std::move(request)));
+}
+
+void RedshiftClient::DeleteClusterSubnetGroupAsync(DeleteClusterSubnetGroupRequest&& request, const DeleteClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DeleteClusterSubnetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DeleteClusterSubnetGroupAsyncHelper(const DeleteClusterSubnetGroupRequest& request, const DeleteClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteClusterSubnetGroup(request), context);
@@ -711,7 +891,7 @@ DeleteEventSubscriptionOutcome RedshiftClient::DeleteEventSubscription(const Del
 
 DeleteEventSubscriptionOutcomeCallable RedshiftClient::DeleteEventSubscriptionCallable(const DeleteEventSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteEventSubscription( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteEventSubscription( request ); } );
 }
 
 void RedshiftClient::DeleteEventSubscriptionAsync(const DeleteEventSubscriptionRequest& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -719,6 +899,16 @@ void RedshiftClient::DeleteEventSubscriptionAsync(const DeleteEventSubscriptionR
   m_executor->Submit( [this, request, handler, context](){ this->DeleteEventSubscriptionAsyncHelper( request, handler, context ); } );
 }
 
+DeleteEventSubscriptionOutcomeCallable RedshiftClient::DeleteEventSubscriptionCallable(DeleteEventSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DeleteEventSubscription, this, std::move(request)));
+}
+
+void RedshiftClient::DeleteEventSubscriptionAsync(DeleteEventSubscriptionRequest&& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DeleteEventSubscriptionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DeleteEventSubscriptionAsyncHelper(const DeleteEventSubscriptionRequest& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteEventSubscription(request), context);
@@ -741,7 +931,7 @@ DeleteHsmClientCertificateOutcome RedshiftClient::DeleteHsmClientCertificate(con
 
 DeleteHsmClientCertificateOutcomeCallable RedshiftClient::DeleteHsmClientCertificateCallable(const DeleteHsmClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteHsmClientCertificate( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteHsmClientCertificate( request ); } );
 }
 
 void RedshiftClient::DeleteHsmClientCertificateAsync(const DeleteHsmClientCertificateRequest& request, const DeleteHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -749,6 +939,16 @@ void RedshiftClient::DeleteHsmClientCertificateAsync(const DeleteHsmClientCertif
   m_executor->Submit( [this, request, handler, context](){ this->DeleteHsmClientCertificateAsyncHelper( request, handler, context ); } );
 }
 
+DeleteHsmClientCertificateOutcomeCallable RedshiftClient::DeleteHsmClientCertificateCallable(DeleteHsmClientCertificateRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DeleteHsmClientCertificate, this, std::move(request)));
+}
+
+void RedshiftClient::DeleteHsmClientCertificateAsync(DeleteHsmClientCertificateRequest&& request, const DeleteHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DeleteHsmClientCertificateAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DeleteHsmClientCertificateAsyncHelper(const DeleteHsmClientCertificateRequest& request, const DeleteHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteHsmClientCertificate(request), context);
@@ -771,7 +971,7 @@ DeleteHsmConfigurationOutcome RedshiftClient::DeleteHsmConfiguration(const Delet
 
 DeleteHsmConfigurationOutcomeCallable RedshiftClient::DeleteHsmConfigurationCallable(const DeleteHsmConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteHsmConfiguration( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteHsmConfiguration( request ); } );
 }
 
 void RedshiftClient::DeleteHsmConfigurationAsync(const DeleteHsmConfigurationRequest& request, const DeleteHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -779,6 +979,16 @@ void RedshiftClient::DeleteHsmConfigurationAsync(const DeleteHsmConfigurationReq
   m_executor->Submit( [this, request, handler, context](){ this->DeleteHsmConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+DeleteHsmConfigurationOutcomeCallable RedshiftClient::DeleteHsmConfigurationCallable(DeleteHsmConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DeleteHsmConfiguration, this, std::move(request)));
+}
+
+void RedshiftClient::DeleteHsmConfigurationAsync(DeleteHsmConfigurationRequest&& request, const DeleteHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DeleteHsmConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DeleteHsmConfigurationAsyncHelper(const DeleteHsmConfigurationRequest& request, const DeleteHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteHsmConfiguration(request), context);
@@ -801,7 +1011,7 @@ DeleteSnapshotCopyGrantOutcome RedshiftClient::DeleteSnapshotCopyGrant(const Del
 
 DeleteSnapshotCopyGrantOutcomeCallable RedshiftClient::DeleteSnapshotCopyGrantCallable(const DeleteSnapshotCopyGrantRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteSnapshotCopyGrant( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteSnapshotCopyGrant( request ); } );
 }
 
 void RedshiftClient::DeleteSnapshotCopyGrantAsync(const DeleteSnapshotCopyGrantRequest& request, const DeleteSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -809,6 +1019,16 @@ void RedshiftClient::DeleteSnapshotCopyGrantAsync(const DeleteSnapshotCopyGrantR
   m_executor->Submit( [this, request, handler, context](){ this->DeleteSnapshotCopyGrantAsyncHelper( request, handler, context ); } );
 }
 
+DeleteSnapshotCopyGrantOutcomeCallable RedshiftClient::DeleteSnapshotCopyGrantCallable(DeleteSnapshotCopyGrantRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DeleteSnapshotCopyGrant, this, std::move(request)));
+}
+
+void RedshiftClient::DeleteSnapshotCopyGrantAsync(DeleteSnapshotCopyGrantRequest&& request, const DeleteSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DeleteSnapshotCopyGrantAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DeleteSnapshotCopyGrantAsyncHelper(const DeleteSnapshotCopyGrantRequest& request, const DeleteSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteSnapshotCopyGrant(request), context);
@@ -831,7 +1051,7 @@ DeleteTagsOutcome RedshiftClient::DeleteTags(const DeleteTagsRequest& request) c
 
 DeleteTagsOutcomeCallable RedshiftClient::DeleteTagsCallable(const DeleteTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTags( request ); } );
 }
 
 void RedshiftClient::DeleteTagsAsync(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -839,6 +1059,16 @@ void RedshiftClient::DeleteTagsAsync(const DeleteTagsRequest& request, const Del
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTagsAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTagsOutcomeCallable RedshiftClient::DeleteTagsCallable(DeleteTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DeleteTags, this, std::move(request)));
+}
+
+void RedshiftClient::DeleteTagsAsync(DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DeleteTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DeleteTagsAsyncHelper(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTags(request), context);
@@ -861,7 +1091,7 @@ DescribeClusterParameterGroupsOutcome RedshiftClient::DescribeClusterParameterGr
 
 DescribeClusterParameterGroupsOutcomeCallable RedshiftClient::DescribeClusterParameterGroupsCallable(const DescribeClusterParameterGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeClusterParameterGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeClusterParameterGroups( request ); } );
 }
 
 void RedshiftClient::DescribeClusterParameterGroupsAsync(const DescribeClusterParameterGroupsRequest& request, const DescribeClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -869,6 +1099,16 @@ void RedshiftClient::DescribeClusterParameterGroupsAsync(const DescribeClusterPa
   m_executor->Submit( [this, request, handler, context](){ this->DescribeClusterParameterGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeClusterParameterGroupsOutcomeCallable RedshiftClient::DescribeClusterParameterGroupsCallable(DescribeClusterParameterGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeClusterParameterGroups, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeClusterParameterGroupsAsync(DescribeClusterParameterGroupsRequest&& request, const DescribeClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeClusterParameterGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeClusterParameterGroupsAsyncHelper(const DescribeClusterParameterGroupsRequest& request, const DescribeClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeClusterParameterGroups(request), context);
@@ -891,7 +1131,7 @@ DescribeClusterParametersOutcome RedshiftClient::DescribeClusterParameters(const
 
 DescribeClusterParametersOutcomeCallable RedshiftClient::DescribeClusterParametersCallable(const DescribeClusterParametersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeClusterParameters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeClusterParameters( request ); } );
 }
 
 void RedshiftClient::DescribeClusterParametersAsync(const DescribeClusterParametersRequest& request, const DescribeClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -899,6 +1139,16 @@ void RedshiftClient::DescribeClusterParametersAsync(const DescribeClusterParamet
   m_executor->Submit( [this, request, handler, context](){ this->DescribeClusterParametersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeClusterParametersOutcomeCallable RedshiftClient::DescribeClusterParametersCallable(DescribeClusterParametersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeClusterParameters, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeClusterParametersAsync(DescribeClusterParametersRequest&& request, const DescribeClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeClusterParametersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeClusterParametersAsyncHelper(const DescribeClusterParametersRequest& request, const DescribeClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeClusterParameters(request), context);
@@ -921,7 +1171,7 @@ DescribeClusterSecurityGroupsOutcome RedshiftClient::DescribeClusterSecurityGrou
 
 DescribeClusterSecurityGroupsOutcomeCallable RedshiftClient::DescribeClusterSecurityGroupsCallable(const DescribeClusterSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeClusterSecurityGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeClusterSecurityGroups( request ); } );
 }
 
 void RedshiftClient::DescribeClusterSecurityGroupsAsync(const DescribeClusterSecurityGroupsRequest& request, const DescribeClusterSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -929,6 +1179,16 @@ void RedshiftClient::DescribeClusterSecurityGroupsAsync(const DescribeClusterSec
   m_executor->Submit( [this, request, handler, context](){ this->DescribeClusterSecurityGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeClusterSecurityGroupsOutcomeCallable RedshiftClient::DescribeClusterSecurityGroupsCallable(DescribeClusterSecurityGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeClusterSecurityGroups, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeClusterSecurityGroupsAsync(DescribeClusterSecurityGroupsRequest&& request, const DescribeClusterSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeClusterSecurityGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeClusterSecurityGroupsAsyncHelper(const DescribeClusterSecurityGroupsRequest& request, const DescribeClusterSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeClusterSecurityGroups(request), context);
@@ -951,7 +1211,7 @@ DescribeClusterSnapshotsOutcome RedshiftClient::DescribeClusterSnapshots(const D
 
 DescribeClusterSnapshotsOutcomeCallable RedshiftClient::DescribeClusterSnapshotsCallable(const DescribeClusterSnapshotsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeClusterSnapshots( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeClusterSnapshots( request ); } );
 }
 
 void RedshiftClient::DescribeClusterSnapshotsAsync(const DescribeClusterSnapshotsRequest& request, const DescribeClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -959,6 +1219,16 @@ void RedshiftClient::DescribeClusterSnapshotsAsync(const DescribeClusterSnapshot
   m_executor->Submit( [this, request, handler, context](){ this->DescribeClusterSnapshotsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeClusterSnapshotsOutcomeCallable RedshiftClient::DescribeClusterSnapshotsCallable(DescribeClusterSnapshotsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeClusterSnapshots, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeClusterSnapshotsAsync(DescribeClusterSnapshotsRequest&& request, const DescribeClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeClusterSnapshotsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeClusterSnapshotsAsyncHelper(const DescribeClusterSnapshotsRequest& request, const DescribeClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeClusterSnapshots(request), context);
@@ -981,7 +1251,7 @@ DescribeClusterSubnetGroupsOutcome RedshiftClient::DescribeClusterSubnetGroups(c
 
 DescribeClusterSubnetGroupsOutcomeCallable RedshiftClient::DescribeClusterSubnetGroupsCallable(const DescribeClusterSubnetGroupsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeClusterSubnetGroups( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeClusterSubnetGroups( request ); } );
 }
 
 void RedshiftClient::DescribeClusterSubnetGroupsAsync(const DescribeClusterSubnetGroupsRequest& request, const DescribeClusterSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -989,6 +1259,16 @@ void RedshiftClient::DescribeClusterSubnetGroupsAsync(const DescribeClusterSubne
   m_executor->Submit( [this, request, handler, context](){ this->DescribeClusterSubnetGroupsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeClusterSubnetGroupsOutcomeCallable RedshiftClient::DescribeClusterSubnetGroupsCallable(DescribeClusterSubnetGroupsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeClusterSubnetGroups, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeClusterSubnetGroupsAsync(DescribeClusterSubnetGroupsRequest&& request, const DescribeClusterSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeClusterSubnetGroupsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeClusterSubnetGroupsAsyncHelper(const DescribeClusterSubnetGroupsRequest& request, const DescribeClusterSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeClusterSubnetGroups(request), context);
@@ -1011,7 +1291,7 @@ DescribeClusterVersionsOutcome RedshiftClient::DescribeClusterVersions(const Des
 
 DescribeClusterVersionsOutcomeCallable RedshiftClient::DescribeClusterVersionsCallable(const DescribeClusterVersionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeClusterVersions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeClusterVersions( request ); } );
 }
 
 void RedshiftClient::DescribeClusterVersionsAsync(const DescribeClusterVersionsRequest& request, const DescribeClusterVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1019,6 +1299,16 @@ void RedshiftClient::DescribeClusterVersionsAsync(const DescribeClusterVersionsR
   m_executor->Submit( [this, request, handler, context](){ this->DescribeClusterVersionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeClusterVersionsOutcomeCallable RedshiftClient::DescribeClusterVersionsCallable(DescribeClusterVersionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeClusterVersions, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeClusterVersionsAsync(DescribeClusterVersionsRequest&& request, const DescribeClusterVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeClusterVersionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeClusterVersionsAsyncHelper(const DescribeClusterVersionsRequest& request, const DescribeClusterVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeClusterVersions(request), context);
@@ -1041,7 +1331,7 @@ DescribeClustersOutcome RedshiftClient::DescribeClusters(const DescribeClustersR
 
 DescribeClustersOutcomeCallable RedshiftClient::DescribeClustersCallable(const DescribeClustersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeClusters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeClusters( request ); } );
 }
 
 void RedshiftClient::DescribeClustersAsync(const DescribeClustersRequest& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1049,6 +1339,16 @@ void RedshiftClient::DescribeClustersAsync(const DescribeClustersRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->DescribeClustersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeClustersOutcomeCallable RedshiftClient::DescribeClustersCallable(DescribeClustersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeClusters, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeClustersAsync(DescribeClustersRequest&& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeClustersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeClustersAsyncHelper(const DescribeClustersRequest& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeClusters(request), context);
@@ -1071,7 +1371,7 @@ DescribeDefaultClusterParametersOutcome RedshiftClient::DescribeDefaultClusterPa
 
 DescribeDefaultClusterParametersOutcomeCallable RedshiftClient::DescribeDefaultClusterParametersCallable(const DescribeDefaultClusterParametersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDefaultClusterParameters( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDefaultClusterParameters( request ); } );
 }
 
 void RedshiftClient::DescribeDefaultClusterParametersAsync(const DescribeDefaultClusterParametersRequest& request, const DescribeDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1079,6 +1379,16 @@ void RedshiftClient::DescribeDefaultClusterParametersAsync(const DescribeDefault
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDefaultClusterParametersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDefaultClusterParametersOutcomeCallable RedshiftClient::DescribeDefaultClusterParametersCallable(DescribeDefaultClusterParametersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeDefaultClusterParameters, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeDefaultClusterParametersAsync(DescribeDefaultClusterParametersRequest&& request, const DescribeDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeDefaultClusterParametersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeDefaultClusterParametersAsyncHelper(const DescribeDefaultClusterParametersRequest& request, const DescribeDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDefaultClusterParameters(request), context);
@@ -1101,7 +1411,7 @@ DescribeEventCategoriesOutcome RedshiftClient::DescribeEventCategories(const Des
 
 DescribeEventCategoriesOutcomeCallable RedshiftClient::DescribeEventCategoriesCallable(const DescribeEventCategoriesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEventCategories( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEventCategories( request ); } );
 }
 
 void RedshiftClient::DescribeEventCategoriesAsync(const DescribeEventCategoriesRequest& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1109,6 +1419,16 @@ void RedshiftClient::DescribeEventCategoriesAsync(const DescribeEventCategoriesR
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEventCategoriesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEventCategoriesOutcomeCallable RedshiftClient::DescribeEventCategoriesCallable(DescribeEventCategoriesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeEventCategories, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeEventCategoriesAsync(DescribeEventCategoriesRequest&& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeEventCategoriesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeEventCategoriesAsyncHelper(const DescribeEventCategoriesRequest& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEventCategories(request), context);
@@ -1131,7 +1451,7 @@ DescribeEventSubscriptionsOutcome RedshiftClient::DescribeEventSubscriptions(con
 
 DescribeEventSubscriptionsOutcomeCallable RedshiftClient::DescribeEventSubscriptionsCallable(const DescribeEventSubscriptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEventSubscriptions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEventSubscriptions( request ); } );
 }
 
 void RedshiftClient::DescribeEventSubscriptionsAsync(const DescribeEventSubscriptionsRequest& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1139,6 +1459,16 @@ void RedshiftClient::DescribeEventSubscriptionsAsync(const DescribeEventSubscrip
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEventSubscriptionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEventSubscriptionsOutcomeCallable RedshiftClient::DescribeEventSubscriptionsCallable(DescribeEventSubscriptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeEventSubscriptions, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeEventSubscriptionsAsync(DescribeEventSubscriptionsRequest&& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeEventSubscriptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeEventSubscriptionsAsyncHelper(const DescribeEventSubscriptionsRequest& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEventSubscriptions(request), context);
@@ -1161,7 +1491,7 @@ DescribeEventsOutcome RedshiftClient::DescribeEvents(const DescribeEventsRequest
 
 DescribeEventsOutcomeCallable RedshiftClient::DescribeEventsCallable(const DescribeEventsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeEvents( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeEvents( request ); } );
 }
 
 void RedshiftClient::DescribeEventsAsync(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1169,6 +1499,16 @@ void RedshiftClient::DescribeEventsAsync(const DescribeEventsRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->DescribeEventsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeEventsOutcomeCallable RedshiftClient::DescribeEventsCallable(DescribeEventsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeEvents, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeEventsAsync(DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeEventsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeEventsAsyncHelper(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeEvents(request), context);
@@ -1191,7 +1531,7 @@ DescribeHsmClientCertificatesOutcome RedshiftClient::DescribeHsmClientCertificat
 
 DescribeHsmClientCertificatesOutcomeCallable RedshiftClient::DescribeHsmClientCertificatesCallable(const DescribeHsmClientCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeHsmClientCertificates( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeHsmClientCertificates( request ); } );
 }
 
 void RedshiftClient::DescribeHsmClientCertificatesAsync(const DescribeHsmClientCertificatesRequest& request, const DescribeHsmClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1199,6 +1539,16 @@ void RedshiftClient::DescribeHsmClientCertificatesAsync(const DescribeHsmClientC
   m_executor->Submit( [this, request, handler, context](){ this->DescribeHsmClientCertificatesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeHsmClientCertificatesOutcomeCallable RedshiftClient::DescribeHsmClientCertificatesCallable(DescribeHsmClientCertificatesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeHsmClientCertificates, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeHsmClientCertificatesAsync(DescribeHsmClientCertificatesRequest&& request, const DescribeHsmClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeHsmClientCertificatesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeHsmClientCertificatesAsyncHelper(const DescribeHsmClientCertificatesRequest& request, const DescribeHsmClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeHsmClientCertificates(request), context);
@@ -1221,7 +1571,7 @@ DescribeHsmConfigurationsOutcome RedshiftClient::DescribeHsmConfigurations(const
 
 DescribeHsmConfigurationsOutcomeCallable RedshiftClient::DescribeHsmConfigurationsCallable(const DescribeHsmConfigurationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeHsmConfigurations( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeHsmConfigurations( request ); } );
 }
 
 void RedshiftClient::DescribeHsmConfigurationsAsync(const DescribeHsmConfigurationsRequest& request, const DescribeHsmConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1229,6 +1579,16 @@ void RedshiftClient::DescribeHsmConfigurationsAsync(const DescribeHsmConfigurati
   m_executor->Submit( [this, request, handler, context](){ this->DescribeHsmConfigurationsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeHsmConfigurationsOutcomeCallable RedshiftClient::DescribeHsmConfigurationsCallable(DescribeHsmConfigurationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeHsmConfigurations, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeHsmConfigurationsAsync(DescribeHsmConfigurationsRequest&& request, const DescribeHsmConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeHsmConfigurationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeHsmConfigurationsAsyncHelper(const DescribeHsmConfigurationsRequest& request, const DescribeHsmConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeHsmConfigurations(request), context);
@@ -1251,7 +1611,7 @@ DescribeLoggingStatusOutcome RedshiftClient::DescribeLoggingStatus(const Describ
 
 DescribeLoggingStatusOutcomeCallable RedshiftClient::DescribeLoggingStatusCallable(const DescribeLoggingStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeLoggingStatus( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeLoggingStatus( request ); } );
 }
 
 void RedshiftClient::DescribeLoggingStatusAsync(const DescribeLoggingStatusRequest& request, const DescribeLoggingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1259,6 +1619,16 @@ void RedshiftClient::DescribeLoggingStatusAsync(const DescribeLoggingStatusReque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeLoggingStatusAsyncHelper( request, handler, context ); } );
 }
 
+DescribeLoggingStatusOutcomeCallable RedshiftClient::DescribeLoggingStatusCallable(DescribeLoggingStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeLoggingStatus, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeLoggingStatusAsync(DescribeLoggingStatusRequest&& request, const DescribeLoggingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeLoggingStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeLoggingStatusAsyncHelper(const DescribeLoggingStatusRequest& request, const DescribeLoggingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeLoggingStatus(request), context);
@@ -1281,7 +1651,7 @@ DescribeOrderableClusterOptionsOutcome RedshiftClient::DescribeOrderableClusterO
 
 DescribeOrderableClusterOptionsOutcomeCallable RedshiftClient::DescribeOrderableClusterOptionsCallable(const DescribeOrderableClusterOptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeOrderableClusterOptions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeOrderableClusterOptions( request ); } );
 }
 
 void RedshiftClient::DescribeOrderableClusterOptionsAsync(const DescribeOrderableClusterOptionsRequest& request, const DescribeOrderableClusterOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1289,6 +1659,16 @@ void RedshiftClient::DescribeOrderableClusterOptionsAsync(const DescribeOrderabl
   m_executor->Submit( [this, request, handler, context](){ this->DescribeOrderableClusterOptionsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeOrderableClusterOptionsOutcomeCallable RedshiftClient::DescribeOrderableClusterOptionsCallable(DescribeOrderableClusterOptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeOrderableClusterOptions, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeOrderableClusterOptionsAsync(DescribeOrderableClusterOptionsRequest&& request, const DescribeOrderableClusterOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeOrderableClusterOptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeOrderableClusterOptionsAsyncHelper(const DescribeOrderableClusterOptionsRequest& request, const DescribeOrderableClusterOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeOrderableClusterOptions(request), context);
@@ -1311,7 +1691,7 @@ DescribeReservedNodeOfferingsOutcome RedshiftClient::DescribeReservedNodeOfferin
 
 DescribeReservedNodeOfferingsOutcomeCallable RedshiftClient::DescribeReservedNodeOfferingsCallable(const DescribeReservedNodeOfferingsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReservedNodeOfferings( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReservedNodeOfferings( request ); } );
 }
 
 void RedshiftClient::DescribeReservedNodeOfferingsAsync(const DescribeReservedNodeOfferingsRequest& request, const DescribeReservedNodeOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1319,6 +1699,16 @@ void RedshiftClient::DescribeReservedNodeOfferingsAsync(const DescribeReservedNo
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReservedNodeOfferingsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReservedNodeOfferingsOutcomeCallable RedshiftClient::DescribeReservedNodeOfferingsCallable(DescribeReservedNodeOfferingsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeReservedNodeOfferings, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeReservedNodeOfferingsAsync(DescribeReservedNodeOfferingsRequest&& request, const DescribeReservedNodeOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeReservedNodeOfferingsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeReservedNodeOfferingsAsyncHelper(const DescribeReservedNodeOfferingsRequest& request, const DescribeReservedNodeOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReservedNodeOfferings(request), context);
@@ -1341,7 +1731,7 @@ DescribeReservedNodesOutcome RedshiftClient::DescribeReservedNodes(const Describ
 
 DescribeReservedNodesOutcomeCallable RedshiftClient::DescribeReservedNodesCallable(const DescribeReservedNodesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeReservedNodes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeReservedNodes( request ); } );
 }
 
 void RedshiftClient::DescribeReservedNodesAsync(const DescribeReservedNodesRequest& request, const DescribeReservedNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1349,6 +1739,16 @@ void RedshiftClient::DescribeReservedNodesAsync(const DescribeReservedNodesReque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeReservedNodesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeReservedNodesOutcomeCallable RedshiftClient::DescribeReservedNodesCallable(DescribeReservedNodesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeReservedNodes, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeReservedNodesAsync(DescribeReservedNodesRequest&& request, const DescribeReservedNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeReservedNodesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeReservedNodesAsyncHelper(const DescribeReservedNodesRequest& request, const DescribeReservedNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeReservedNodes(request), context);
@@ -1371,7 +1771,7 @@ DescribeResizeOutcome RedshiftClient::DescribeResize(const DescribeResizeRequest
 
 DescribeResizeOutcomeCallable RedshiftClient::DescribeResizeCallable(const DescribeResizeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeResize( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeResize( request ); } );
 }
 
 void RedshiftClient::DescribeResizeAsync(const DescribeResizeRequest& request, const DescribeResizeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1379,6 +1779,16 @@ void RedshiftClient::DescribeResizeAsync(const DescribeResizeRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->DescribeResizeAsyncHelper( request, handler, context ); } );
 }
 
+DescribeResizeOutcomeCallable RedshiftClient::DescribeResizeCallable(DescribeResizeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeResize, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeResizeAsync(DescribeResizeRequest&& request, const DescribeResizeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeResizeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeResizeAsyncHelper(const DescribeResizeRequest& request, const DescribeResizeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeResize(request), context);
@@ -1401,7 +1811,7 @@ DescribeSnapshotCopyGrantsOutcome RedshiftClient::DescribeSnapshotCopyGrants(con
 
 DescribeSnapshotCopyGrantsOutcomeCallable RedshiftClient::DescribeSnapshotCopyGrantsCallable(const DescribeSnapshotCopyGrantsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSnapshotCopyGrants( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSnapshotCopyGrants( request ); } );
 }
 
 void RedshiftClient::DescribeSnapshotCopyGrantsAsync(const DescribeSnapshotCopyGrantsRequest& request, const DescribeSnapshotCopyGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1409,6 +1819,16 @@ void RedshiftClient::DescribeSnapshotCopyGrantsAsync(const DescribeSnapshotCopyG
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSnapshotCopyGrantsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSnapshotCopyGrantsOutcomeCallable RedshiftClient::DescribeSnapshotCopyGrantsCallable(DescribeSnapshotCopyGrantsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeSnapshotCopyGrants, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeSnapshotCopyGrantsAsync(DescribeSnapshotCopyGrantsRequest&& request, const DescribeSnapshotCopyGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeSnapshotCopyGrantsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeSnapshotCopyGrantsAsyncHelper(const DescribeSnapshotCopyGrantsRequest& request, const DescribeSnapshotCopyGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSnapshotCopyGrants(request), context);
@@ -1431,7 +1851,7 @@ DescribeTableRestoreStatusOutcome RedshiftClient::DescribeTableRestoreStatus(con
 
 DescribeTableRestoreStatusOutcomeCallable RedshiftClient::DescribeTableRestoreStatusCallable(const DescribeTableRestoreStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTableRestoreStatus( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTableRestoreStatus( request ); } );
 }
 
 void RedshiftClient::DescribeTableRestoreStatusAsync(const DescribeTableRestoreStatusRequest& request, const DescribeTableRestoreStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1439,14 +1859,24 @@ void RedshiftClient::DescribeTableRestoreStatusAsync(const DescribeTableRestoreS
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTableRestoreStatusAsyncHelper( request, handler, context ); } );
 }
 
-void RedshiftClient::DescribeTableRestoreStatusAsyncHelper(const DescribeTableRestoreStatusRequest& request, const DescribeTableRestoreStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+DescribeTableRestoreStatusOutcomeCallable RedshiftClient::DescribeTableRestoreStatusCallable(DescribeTableRestoreStatusRequest&& request) const
 {
-  handler(this, request, DescribeTableRestoreStatus(request), context);
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeTableRestoreStatus, this, std::move(request)));
 }
 
-DescribeTagsOutcome RedshiftClient::DescribeTags(const DescribeTagsRequest& request) const
+void RedshiftClient::DescribeTableRestoreStatusAsync(DescribeTableRestoreStatusRequest&& request, const DescribeTableRestoreStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  Aws::StringStream ss;
+  m_executor->Submit(&RedshiftClient::DescribeTableRestoreStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
+void RedshiftClient::DescribeTableRestoreStatusAsyncHelper(const DescribeTableRestoreStatusRequest& request, const DescribeTableRestoreStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  handler(this, request, DescribeTableRestoreStatus(request), context);
+}
+
+DescribeTagsOutcome RedshiftClient::DescribeTags(const DescribeTagsRequest& request) const
+{
+  Aws::StringStream ss;
   ss << m_uri << "/";
   XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
@@ -1461,7 +1891,7 @@ DescribeTagsOutcome RedshiftClient::DescribeTags(const DescribeTagsRequest& requ
 
 DescribeTagsOutcomeCallable RedshiftClient::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTags( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTags( request ); } );
 }
 
 void RedshiftClient::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1469,6 +1899,16 @@ void RedshiftClient::DescribeTagsAsync(const DescribeTagsRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTagsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTagsOutcomeCallable RedshiftClient::DescribeTagsCallable(DescribeTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DescribeTags, this, std::move(request)));
+}
+
+void RedshiftClient::DescribeTagsAsync(DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DescribeTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTags(request), context);
@@ -1491,7 +1931,7 @@ DisableLoggingOutcome RedshiftClient::DisableLogging(const DisableLoggingRequest
 
 DisableLoggingOutcomeCallable RedshiftClient::DisableLoggingCallable(const DisableLoggingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableLogging( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableLogging( request ); } );
 }
 
 void RedshiftClient::DisableLoggingAsync(const DisableLoggingRequest& request, const DisableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1499,6 +1939,16 @@ void RedshiftClient::DisableLoggingAsync(const DisableLoggingRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->DisableLoggingAsyncHelper( request, handler, context ); } );
 }
 
+DisableLoggingOutcomeCallable RedshiftClient::DisableLoggingCallable(DisableLoggingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DisableLogging, this, std::move(request)));
+}
+
+void RedshiftClient::DisableLoggingAsync(DisableLoggingRequest&& request, const DisableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DisableLoggingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DisableLoggingAsyncHelper(const DisableLoggingRequest& request, const DisableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableLogging(request), context);
@@ -1521,7 +1971,7 @@ DisableSnapshotCopyOutcome RedshiftClient::DisableSnapshotCopy(const DisableSnap
 
 DisableSnapshotCopyOutcomeCallable RedshiftClient::DisableSnapshotCopyCallable(const DisableSnapshotCopyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableSnapshotCopy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableSnapshotCopy( request ); } );
 }
 
 void RedshiftClient::DisableSnapshotCopyAsync(const DisableSnapshotCopyRequest& request, const DisableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1529,6 +1979,16 @@ void RedshiftClient::DisableSnapshotCopyAsync(const DisableSnapshotCopyRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DisableSnapshotCopyAsyncHelper( request, handler, context ); } );
 }
 
+DisableSnapshotCopyOutcomeCallable RedshiftClient::DisableSnapshotCopyCallable(DisableSnapshotCopyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::DisableSnapshotCopy, this, std::move(request)));
+}
+
+void RedshiftClient::DisableSnapshotCopyAsync(DisableSnapshotCopyRequest&& request, const DisableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::DisableSnapshotCopyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::DisableSnapshotCopyAsyncHelper(const DisableSnapshotCopyRequest& request, const DisableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableSnapshotCopy(request), context);
@@ -1551,7 +2011,7 @@ EnableLoggingOutcome RedshiftClient::EnableLogging(const EnableLoggingRequest& r
 
 EnableLoggingOutcomeCallable RedshiftClient::EnableLoggingCallable(const EnableLoggingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableLogging( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableLogging( request ); } );
 }
 
 void RedshiftClient::EnableLoggingAsync(const EnableLoggingRequest& request, const EnableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1559,6 +2019,16 @@ void RedshiftClient::EnableLoggingAsync(const EnableLoggingRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->EnableLoggingAsyncHelper( request, handler, context ); } );
 }
 
+EnableLoggingOutcomeCallable RedshiftClient::EnableLoggingCallable(EnableLoggingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::EnableLogging, this, std::move(request)));
+}
+
+void RedshiftClient::EnableLoggingAsync(EnableLoggingRequest&& request, const EnableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::EnableLoggingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::EnableLoggingAsyncHelper(const EnableLoggingRequest& request, const EnableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableLogging(request), context);
@@ -1581,7 +2051,7 @@ EnableSnapshotCopyOutcome RedshiftClient::EnableSnapshotCopy(const EnableSnapsho
 
 EnableSnapshotCopyOutcomeCallable RedshiftClient::EnableSnapshotCopyCallable(const EnableSnapshotCopyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableSnapshotCopy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableSnapshotCopy( request ); } );
 }
 
 void RedshiftClient::EnableSnapshotCopyAsync(const EnableSnapshotCopyRequest& request, const EnableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1589,6 +2059,16 @@ void RedshiftClient::EnableSnapshotCopyAsync(const EnableSnapshotCopyRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->EnableSnapshotCopyAsyncHelper( request, handler, context ); } );
 }
 
+EnableSnapshotCopyOutcomeCallable RedshiftClient::EnableSnapshotCopyCallable(EnableSnapshotCopyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::EnableSnapshotCopy, this, std::move(request)));
+}
+
+void RedshiftClient::EnableSnapshotCopyAsync(EnableSnapshotCopyRequest&& request, const EnableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::EnableSnapshotCopyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::EnableSnapshotCopyAsyncHelper(const EnableSnapshotCopyRequest& request, const EnableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableSnapshotCopy(request), context);
@@ -1611,7 +2091,7 @@ ModifyClusterOutcome RedshiftClient::ModifyCluster(const ModifyClusterRequest& r
 
 ModifyClusterOutcomeCallable RedshiftClient::ModifyClusterCallable(const ModifyClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyCluster( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyCluster( request ); } );
 }
 
 void RedshiftClient::ModifyClusterAsync(const ModifyClusterRequest& request, const ModifyClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1619,6 +2099,16 @@ void RedshiftClient::ModifyClusterAsync(const ModifyClusterRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->ModifyClusterAsyncHelper( request, handler, context ); } );
 }
 
+ModifyClusterOutcomeCallable RedshiftClient::ModifyClusterCallable(ModifyClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::ModifyCluster, this, std::move(request)));
+}
+
+void RedshiftClient::ModifyClusterAsync(ModifyClusterRequest&& request, const ModifyClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::ModifyClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::ModifyClusterAsyncHelper(const ModifyClusterRequest& request, const ModifyClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyCluster(request), context);
@@ -1641,7 +2131,7 @@ ModifyClusterIamRolesOutcome RedshiftClient::ModifyClusterIamRoles(const ModifyC
 
 ModifyClusterIamRolesOutcomeCallable RedshiftClient::ModifyClusterIamRolesCallable(const ModifyClusterIamRolesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyClusterIamRoles( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyClusterIamRoles( request ); } );
 }
 
 void RedshiftClient::ModifyClusterIamRolesAsync(const ModifyClusterIamRolesRequest& request, const ModifyClusterIamRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1649,6 +2139,16 @@ void RedshiftClient::ModifyClusterIamRolesAsync(const ModifyClusterIamRolesReque
   m_executor->Submit( [this, request, handler, context](){ this->ModifyClusterIamRolesAsyncHelper( request, handler, context ); } );
 }
 
+ModifyClusterIamRolesOutcomeCallable RedshiftClient::ModifyClusterIamRolesCallable(ModifyClusterIamRolesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::ModifyClusterIamRoles, this, std::move(request)));
+}
+
+void RedshiftClient::ModifyClusterIamRolesAsync(ModifyClusterIamRolesRequest&& request, const ModifyClusterIamRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::ModifyClusterIamRolesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::ModifyClusterIamRolesAsyncHelper(const ModifyClusterIamRolesRequest& request, const ModifyClusterIamRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyClusterIamRoles(request), context);
@@ -1671,7 +2171,7 @@ ModifyClusterParameterGroupOutcome RedshiftClient::ModifyClusterParameterGroup(c
 
 ModifyClusterParameterGroupOutcomeCallable RedshiftClient::ModifyClusterParameterGroupCallable(const ModifyClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyClusterParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyClusterParameterGroup( request ); } );
 }
 
 void RedshiftClient::ModifyClusterParameterGroupAsync(const ModifyClusterParameterGroupRequest& request, const ModifyClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1679,6 +2179,16 @@ void RedshiftClient::ModifyClusterParameterGroupAsync(const ModifyClusterParamet
   m_executor->Submit( [this, request, handler, context](){ this->ModifyClusterParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+ModifyClusterParameterGroupOutcomeCallable RedshiftClient::ModifyClusterParameterGroupCallable(ModifyClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::ModifyClusterParameterGroup, this, std::move(request)));
+}
+
+void RedshiftClient::ModifyClusterParameterGroupAsync(ModifyClusterParameterGroupRequest&& request, const ModifyClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::ModifyClusterParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::ModifyClusterParameterGroupAsyncHelper(const ModifyClusterParameterGroupRequest& request, const ModifyClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyClusterParameterGroup(request), context);
@@ -1701,7 +2211,7 @@ ModifyClusterSubnetGroupOutcome RedshiftClient::ModifyClusterSubnetGroup(const M
 
 ModifyClusterSubnetGroupOutcomeCallable RedshiftClient::ModifyClusterSubnetGroupCallable(const ModifyClusterSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyClusterSubnetGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyClusterSubnetGroup( request ); } );
 }
 
 void RedshiftClient::ModifyClusterSubnetGroupAsync(const ModifyClusterSubnetGroupRequest& request, const ModifyClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1709,6 +2219,16 @@ void RedshiftClient::ModifyClusterSubnetGroupAsync(const ModifyClusterSubnetGrou
   m_executor->Submit( [this, request, handler, context](){ this->ModifyClusterSubnetGroupAsyncHelper( request, handler, context ); } );
 }
 
+ModifyClusterSubnetGroupOutcomeCallable RedshiftClient::ModifyClusterSubnetGroupCallable(ModifyClusterSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::ModifyClusterSubnetGroup, this, std::move(request)));
+}
+
+void RedshiftClient::ModifyClusterSubnetGroupAsync(ModifyClusterSubnetGroupRequest&& request, const ModifyClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::ModifyClusterSubnetGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::ModifyClusterSubnetGroupAsyncHelper(const ModifyClusterSubnetGroupRequest& request, const ModifyClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyClusterSubnetGroup(request), context);
@@ -1731,7 +2251,7 @@ ModifyEventSubscriptionOutcome RedshiftClient::ModifyEventSubscription(const Mod
 
 ModifyEventSubscriptionOutcomeCallable RedshiftClient::ModifyEventSubscriptionCallable(const ModifyEventSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyEventSubscription( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyEventSubscription( request ); } );
 }
 
 void RedshiftClient::ModifyEventSubscriptionAsync(const ModifyEventSubscriptionRequest& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1739,6 +2259,16 @@ void RedshiftClient::ModifyEventSubscriptionAsync(const ModifyEventSubscriptionR
   m_executor->Submit( [this, request, handler, context](){ this->ModifyEventSubscriptionAsyncHelper( request, handler, context ); } );
 }
 
+ModifyEventSubscriptionOutcomeCallable RedshiftClient::ModifyEventSubscriptionCallable(ModifyEventSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::ModifyEventSubscription, this, std::move(request)));
+}
+
+void RedshiftClient::ModifyEventSubscriptionAsync(ModifyEventSubscriptionRequest&& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::ModifyEventSubscriptionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::ModifyEventSubscriptionAsyncHelper(const ModifyEventSubscriptionRequest& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyEventSubscription(request), context);
@@ -1761,7 +2291,7 @@ ModifySnapshotCopyRetentionPeriodOutcome RedshiftClient::ModifySnapshotCopyReten
 
 ModifySnapshotCopyRetentionPeriodOutcomeCallable RedshiftClient::ModifySnapshotCopyRetentionPeriodCallable(const ModifySnapshotCopyRetentionPeriodRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifySnapshotCopyRetentionPeriod( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifySnapshotCopyRetentionPeriod( request ); } );
 }
 
 void RedshiftClient::ModifySnapshotCopyRetentionPeriodAsync(const ModifySnapshotCopyRetentionPeriodRequest& request, const ModifySnapshotCopyRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1769,6 +2299,16 @@ void RedshiftClient::ModifySnapshotCopyRetentionPeriodAsync(const ModifySnapshot
   m_executor->Submit( [this, request, handler, context](){ this->ModifySnapshotCopyRetentionPeriodAsyncHelper( request, handler, context ); } );
 }
 
+ModifySnapshotCopyRetentionPeriodOutcomeCallable RedshiftClient::ModifySnapshotCopyRetentionPeriodCallable(ModifySnapshotCopyRetentionPeriodRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::ModifySnapshotCopyRetentionPeriod, this, std::move(request)));
+}
+
+void RedshiftClient::ModifySnapshotCopyRetentionPeriodAsync(ModifySnapshotCopyRetentionPeriodRequest&& request, const ModifySnapshotCopyRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::ModifySnapshotCopyRetentionPeriodAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::ModifySnapshotCopyRetentionPeriodAsyncHelper(const ModifySnapshotCopyRetentionPeriodRequest& request, const ModifySnapshotCopyRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifySnapshotCopyRetentionPeriod(request), context);
@@ -1791,7 +2331,7 @@ PurchaseReservedNodeOfferingOutcome RedshiftClient::PurchaseReservedNodeOffering
 
 PurchaseReservedNodeOfferingOutcomeCallable RedshiftClient::PurchaseReservedNodeOfferingCallable(const PurchaseReservedNodeOfferingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PurchaseReservedNodeOffering( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PurchaseReservedNodeOffering( request ); } );
 }
 
 void RedshiftClient::PurchaseReservedNodeOfferingAsync(const PurchaseReservedNodeOfferingRequest& request, const PurchaseReservedNodeOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1799,6 +2339,16 @@ void RedshiftClient::PurchaseReservedNodeOfferingAsync(const PurchaseReservedNod
   m_executor->Submit( [this, request, handler, context](){ this->PurchaseReservedNodeOfferingAsyncHelper( request, handler, context ); } );
 }
 
+PurchaseReservedNodeOfferingOutcomeCallable RedshiftClient::PurchaseReservedNodeOfferingCallable(PurchaseReservedNodeOfferingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::PurchaseReservedNodeOffering, this, std::move(request)));
+}
+
+void RedshiftClient::PurchaseReservedNodeOfferingAsync(PurchaseReservedNodeOfferingRequest&& request, const PurchaseReservedNodeOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::PurchaseReservedNodeOfferingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::PurchaseReservedNodeOfferingAsyncHelper(const PurchaseReservedNodeOfferingRequest& request, const PurchaseReservedNodeOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PurchaseReservedNodeOffering(request), context);
@@ -1821,7 +2371,7 @@ RebootClusterOutcome RedshiftClient::RebootCluster(const RebootClusterRequest& r
 
 RebootClusterOutcomeCallable RedshiftClient::RebootClusterCallable(const RebootClusterRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RebootCluster( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RebootCluster( request ); } );
 }
 
 void RedshiftClient::RebootClusterAsync(const RebootClusterRequest& request, const RebootClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1829,6 +2379,16 @@ void RedshiftClient::RebootClusterAsync(const RebootClusterRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->RebootClusterAsyncHelper( request, handler, context ); } );
 }
 
+RebootClusterOutcomeCallable RedshiftClient::RebootClusterCallable(RebootClusterRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::RebootCluster, this, std::move(request)));
+}
+
+void RedshiftClient::RebootClusterAsync(RebootClusterRequest&& request, const RebootClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::RebootClusterAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::RebootClusterAsyncHelper(const RebootClusterRequest& request, const RebootClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RebootCluster(request), context);
@@ -1851,7 +2411,7 @@ ResetClusterParameterGroupOutcome RedshiftClient::ResetClusterParameterGroup(con
 
 ResetClusterParameterGroupOutcomeCallable RedshiftClient::ResetClusterParameterGroupCallable(const ResetClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResetClusterParameterGroup( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResetClusterParameterGroup( request ); } );
 }
 
 void RedshiftClient::ResetClusterParameterGroupAsync(const ResetClusterParameterGroupRequest& request, const ResetClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1859,6 +2419,16 @@ void RedshiftClient::ResetClusterParameterGroupAsync(const ResetClusterParameter
   m_executor->Submit( [this, request, handler, context](){ this->ResetClusterParameterGroupAsyncHelper( request, handler, context ); } );
 }
 
+ResetClusterParameterGroupOutcomeCallable RedshiftClient::ResetClusterParameterGroupCallable(ResetClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::ResetClusterParameterGroup, this, std::move(request)));
+}
+
+void RedshiftClient::ResetClusterParameterGroupAsync(ResetClusterParameterGroupRequest&& request, const ResetClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::ResetClusterParameterGroupAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::ResetClusterParameterGroupAsyncHelper(const ResetClusterParameterGroupRequest& request, const ResetClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResetClusterParameterGroup(request), context);
@@ -1881,7 +2451,7 @@ RestoreFromClusterSnapshotOutcome RedshiftClient::RestoreFromClusterSnapshot(con
 
 RestoreFromClusterSnapshotOutcomeCallable RedshiftClient::RestoreFromClusterSnapshotCallable(const RestoreFromClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RestoreFromClusterSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RestoreFromClusterSnapshot( request ); } );
 }
 
 void RedshiftClient::RestoreFromClusterSnapshotAsync(const RestoreFromClusterSnapshotRequest& request, const RestoreFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1889,6 +2459,16 @@ void RedshiftClient::RestoreFromClusterSnapshotAsync(const RestoreFromClusterSna
   m_executor->Submit( [this, request, handler, context](){ this->RestoreFromClusterSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+RestoreFromClusterSnapshotOutcomeCallable RedshiftClient::RestoreFromClusterSnapshotCallable(RestoreFromClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::RestoreFromClusterSnapshot, this, std::move(request)));
+}
+
+void RedshiftClient::RestoreFromClusterSnapshotAsync(RestoreFromClusterSnapshotRequest&& request, const RestoreFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::RestoreFromClusterSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::RestoreFromClusterSnapshotAsyncHelper(const RestoreFromClusterSnapshotRequest& request, const RestoreFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RestoreFromClusterSnapshot(request), context);
@@ -1911,7 +2491,7 @@ RestoreTableFromClusterSnapshotOutcome RedshiftClient::RestoreTableFromClusterSn
 
 RestoreTableFromClusterSnapshotOutcomeCallable RedshiftClient::RestoreTableFromClusterSnapshotCallable(const RestoreTableFromClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RestoreTableFromClusterSnapshot( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RestoreTableFromClusterSnapshot( request ); } );
 }
 
 void RedshiftClient::RestoreTableFromClusterSnapshotAsync(const RestoreTableFromClusterSnapshotRequest& request, const RestoreTableFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1919,6 +2499,16 @@ void RedshiftClient::RestoreTableFromClusterSnapshotAsync(const RestoreTableFrom
   m_executor->Submit( [this, request, handler, context](){ this->RestoreTableFromClusterSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+RestoreTableFromClusterSnapshotOutcomeCallable RedshiftClient::RestoreTableFromClusterSnapshotCallable(RestoreTableFromClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::RestoreTableFromClusterSnapshot, this, std::move(request)));
+}
+
+void RedshiftClient::RestoreTableFromClusterSnapshotAsync(RestoreTableFromClusterSnapshotRequest&& request, const RestoreTableFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::RestoreTableFromClusterSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::RestoreTableFromClusterSnapshotAsyncHelper(const RestoreTableFromClusterSnapshotRequest& request, const RestoreTableFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RestoreTableFromClusterSnapshot(request), context);
@@ -1941,7 +2531,7 @@ RevokeClusterSecurityGroupIngressOutcome RedshiftClient::RevokeClusterSecurityGr
 
 RevokeClusterSecurityGroupIngressOutcomeCallable RedshiftClient::RevokeClusterSecurityGroupIngressCallable(const RevokeClusterSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RevokeClusterSecurityGroupIngress( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RevokeClusterSecurityGroupIngress( request ); } );
 }
 
 void RedshiftClient::RevokeClusterSecurityGroupIngressAsync(const RevokeClusterSecurityGroupIngressRequest& request, const RevokeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1949,6 +2539,16 @@ void RedshiftClient::RevokeClusterSecurityGroupIngressAsync(const RevokeClusterS
   m_executor->Submit( [this, request, handler, context](){ this->RevokeClusterSecurityGroupIngressAsyncHelper( request, handler, context ); } );
 }
 
+RevokeClusterSecurityGroupIngressOutcomeCallable RedshiftClient::RevokeClusterSecurityGroupIngressCallable(RevokeClusterSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::RevokeClusterSecurityGroupIngress, this, std::move(request)));
+}
+
+void RedshiftClient::RevokeClusterSecurityGroupIngressAsync(RevokeClusterSecurityGroupIngressRequest&& request, const RevokeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::RevokeClusterSecurityGroupIngressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::RevokeClusterSecurityGroupIngressAsyncHelper(const RevokeClusterSecurityGroupIngressRequest& request, const RevokeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RevokeClusterSecurityGroupIngress(request), context);
@@ -1971,7 +2571,7 @@ RevokeSnapshotAccessOutcome RedshiftClient::RevokeSnapshotAccess(const RevokeSna
 
 RevokeSnapshotAccessOutcomeCallable RedshiftClient::RevokeSnapshotAccessCallable(const RevokeSnapshotAccessRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RevokeSnapshotAccess( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RevokeSnapshotAccess( request ); } );
 }
 
 void RedshiftClient::RevokeSnapshotAccessAsync(const RevokeSnapshotAccessRequest& request, const RevokeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1979,6 +2579,16 @@ void RedshiftClient::RevokeSnapshotAccessAsync(const RevokeSnapshotAccessRequest
   m_executor->Submit( [this, request, handler, context](){ this->RevokeSnapshotAccessAsyncHelper( request, handler, context ); } );
 }
 
+RevokeSnapshotAccessOutcomeCallable RedshiftClient::RevokeSnapshotAccessCallable(RevokeSnapshotAccessRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::RevokeSnapshotAccess, this, std::move(request)));
+}
+
+void RedshiftClient::RevokeSnapshotAccessAsync(RevokeSnapshotAccessRequest&& request, const RevokeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::RevokeSnapshotAccessAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::RevokeSnapshotAccessAsyncHelper(const RevokeSnapshotAccessRequest& request, const RevokeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RevokeSnapshotAccess(request), context);
@@ -2001,7 +2611,7 @@ RotateEncryptionKeyOutcome RedshiftClient::RotateEncryptionKey(const RotateEncry
 
 RotateEncryptionKeyOutcomeCallable RedshiftClient::RotateEncryptionKeyCallable(const RotateEncryptionKeyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RotateEncryptionKey( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RotateEncryptionKey( request ); } );
 }
 
 void RedshiftClient::RotateEncryptionKeyAsync(const RotateEncryptionKeyRequest& request, const RotateEncryptionKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2009,8 +2619,619 @@ void RedshiftClient::RotateEncryptionKeyAsync(const RotateEncryptionKeyRequest&
   m_executor->Submit( [this, request, handler, context](){ this->RotateEncryptionKeyAsyncHelper( request, handler, context ); } );
 }
 
+RotateEncryptionKeyOutcomeCallable RedshiftClient::RotateEncryptionKeyCallable(RotateEncryptionKeyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&RedshiftClient::RotateEncryptionKey, this, std::move(request)));
+}
+
+void RedshiftClient::RotateEncryptionKeyAsync(RotateEncryptionKeyRequest&& request, const RotateEncryptionKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&RedshiftClient::RotateEncryptionKeyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void RedshiftClient::RotateEncryptionKeyAsyncHelper(const RotateEncryptionKeyRequest& request, const RotateEncryptionKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RotateEncryptionKey(request), context);
 }
 
+Paginator<RedshiftClient, DescribeClusterParameterGroupsRequest, DescribeClusterParameterGroupsOutcome> RedshiftClient::DescribeClusterParameterGroupsPaginator(const DescribeClusterParameterGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeClusterParameterGroupsRequest, DescribeClusterParameterGroupsOutcome>(this, &RedshiftClient::DescribeClusterParameterGroups, request,
+    [](const DescribeClusterParameterGroupsRequest& current, const DescribeClusterParameterGroupsOutcome& outcome, DescribeClusterParameterGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeClusterParametersRequest, DescribeClusterParametersOutcome> RedshiftClient::DescribeClusterParametersPaginator(const DescribeClusterParametersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeClusterParametersRequest, DescribeClusterParametersOutcome>(this, &RedshiftClient::DescribeClusterParameters, request,
+    [](const DescribeClusterParametersRequest& current, const DescribeClusterParametersOutcome& outcome, DescribeClusterParametersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeClusterSecurityGroupsRequest, DescribeClusterSecurityGroupsOutcome> RedshiftClient::DescribeClusterSecurityGroupsPaginator(const DescribeClusterSecurityGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeClusterSecurityGroupsRequest, DescribeClusterSecurityGroupsOutcome>(this, &RedshiftClient::DescribeClusterSecurityGroups, request,
+    [](const DescribeClusterSecurityGroupsRequest& current, const DescribeClusterSecurityGroupsOutcome& outcome, DescribeClusterSecurityGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeClusterSnapshotsRequest, DescribeClusterSnapshotsOutcome> RedshiftClient::DescribeClusterSnapshotsPaginator(const DescribeClusterSnapshotsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeClusterSnapshotsRequest, DescribeClusterSnapshotsOutcome>(this, &RedshiftClient::DescribeClusterSnapshots, request,
+    [](const DescribeClusterSnapshotsRequest& current, const DescribeClusterSnapshotsOutcome& outcome, DescribeClusterSnapshotsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeClusterSubnetGroupsRequest, DescribeClusterSubnetGroupsOutcome> RedshiftClient::DescribeClusterSubnetGroupsPaginator(const DescribeClusterSubnetGroupsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeClusterSubnetGroupsRequest, DescribeClusterSubnetGroupsOutcome>(this, &RedshiftClient::DescribeClusterSubnetGroups, request,
+    [](const DescribeClusterSubnetGroupsRequest& current, const DescribeClusterSubnetGroupsOutcome& outcome, DescribeClusterSubnetGroupsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeClusterVersionsRequest, DescribeClusterVersionsOutcome> RedshiftClient::DescribeClusterVersionsPaginator(const DescribeClusterVersionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeClusterVersionsRequest, DescribeClusterVersionsOutcome>(this, &RedshiftClient::DescribeClusterVersions, request,
+    [](const DescribeClusterVersionsRequest& current, const DescribeClusterVersionsOutcome& outcome, DescribeClusterVersionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeClustersRequest, DescribeClustersOutcome> RedshiftClient::DescribeClustersPaginator(const DescribeClustersRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeClustersRequest, DescribeClustersOutcome>(this, &RedshiftClient::DescribeClusters, request,
+    [](const DescribeClustersRequest& current, const DescribeClustersOutcome& outcome, DescribeClustersRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeEventSubscriptionsRequest, DescribeEventSubscriptionsOutcome> RedshiftClient::DescribeEventSubscriptionsPaginator(const DescribeEventSubscriptionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeEventSubscriptionsRequest, DescribeEventSubscriptionsOutcome>(this, &RedshiftClient::DescribeEventSubscriptions, request,
+    [](const DescribeEventSubscriptionsRequest& current, const DescribeEventSubscriptionsOutcome& outcome, DescribeEventSubscriptionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeEventsRequest, DescribeEventsOutcome> RedshiftClient::DescribeEventsPaginator(const DescribeEventsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeEventsRequest, DescribeEventsOutcome>(this, &RedshiftClient::DescribeEvents, request,
+    [](const DescribeEventsRequest& current, const DescribeEventsOutcome& outcome, DescribeEventsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeHsmClientCertificatesRequest, DescribeHsmClientCertificatesOutcome> RedshiftClient::DescribeHsmClientCertificatesPaginator(const DescribeHsmClientCertificatesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeHsmClientCertificatesRequest, DescribeHsmClientCertificatesOutcome>(this, &RedshiftClient::DescribeHsmClientCertificates, request,
+    [](const DescribeHsmClientCertificatesRequest& current, const DescribeHsmClientCertificatesOutcome& outcome, DescribeHsmClientCertificatesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeHsmConfigurationsRequest, DescribeHsmConfigurationsOutcome> RedshiftClient::DescribeHsmConfigurationsPaginator(const DescribeHsmConfigurationsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeHsmConfigurationsRequest, DescribeHsmConfigurationsOutcome>(this, &RedshiftClient::DescribeHsmConfigurations, request,
+    [](const DescribeHsmConfigurationsRequest& current, const DescribeHsmConfigurationsOutcome& outcome, DescribeHsmConfigurationsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeOrderableClusterOptionsRequest, DescribeOrderableClusterOptionsOutcome> RedshiftClient::DescribeOrderableClusterOptionsPaginator(const DescribeOrderableClusterOptionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeOrderableClusterOptionsRequest, DescribeOrderableClusterOptionsOutcome>(this, &RedshiftClient::DescribeOrderableClusterOptions, request,
+    [](const DescribeOrderableClusterOptionsRequest& current, const DescribeOrderableClusterOptionsOutcome& outcome, DescribeOrderableClusterOptionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeReservedNodeOfferingsRequest, DescribeReservedNodeOfferingsOutcome> RedshiftClient::DescribeReservedNodeOfferingsPaginator(const DescribeReservedNodeOfferingsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeReservedNodeOfferingsRequest, DescribeReservedNodeOfferingsOutcome>(this, &RedshiftClient::DescribeReservedNodeOfferings, request,
+    [](const DescribeReservedNodeOfferingsRequest& current, const DescribeReservedNodeOfferingsOutcome& outcome, DescribeReservedNodeOfferingsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeReservedNodesRequest, DescribeReservedNodesOutcome> RedshiftClient::DescribeReservedNodesPaginator(const DescribeReservedNodesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeReservedNodesRequest, DescribeReservedNodesOutcome>(this, &RedshiftClient::DescribeReservedNodes, request,
+    [](const DescribeReservedNodesRequest& current, const DescribeReservedNodesOutcome& outcome, DescribeReservedNodesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeSnapshotCopyGrantsRequest, DescribeSnapshotCopyGrantsOutcome> RedshiftClient::DescribeSnapshotCopyGrantsPaginator(const DescribeSnapshotCopyGrantsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeSnapshotCopyGrantsRequest, DescribeSnapshotCopyGrantsOutcome>(this, &RedshiftClient::DescribeSnapshotCopyGrants, request,
+    [](const DescribeSnapshotCopyGrantsRequest& current, const DescribeSnapshotCopyGrantsOutcome& outcome, DescribeSnapshotCopyGrantsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeTableRestoreStatusRequest, DescribeTableRestoreStatusOutcome> RedshiftClient::DescribeTableRestoreStatusPaginator(const DescribeTableRestoreStatusRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeTableRestoreStatusRequest, DescribeTableRestoreStatusOutcome>(this, &RedshiftClient::DescribeTableRestoreStatus, request,
+    [](const DescribeTableRestoreStatusRequest& current, const DescribeTableRestoreStatusOutcome& outcome, DescribeTableRestoreStatusRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<RedshiftClient, DescribeTagsRequest, DescribeTagsOutcome> RedshiftClient::DescribeTagsPaginator(const DescribeTagsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<RedshiftClient, DescribeTagsRequest, DescribeTagsOutcome>(this, &RedshiftClient::DescribeTags, request,
+    [](const DescribeTagsRequest& current, const DescribeTagsOutcome& outcome, DescribeTagsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<RedshiftClient, AuthorizeClusterSecurityGroupIngressRequest, AuthorizeClusterSecurityGroupIngressOutcome> RedshiftClient::AuthorizeClusterSecurityGroupIngressAwaitable(AuthorizeClusterSecurityGroupIngressRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::AuthorizeClusterSecurityGroupIngress, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, AuthorizeSnapshotAccessRequest, AuthorizeSnapshotAccessOutcome> RedshiftClient::AuthorizeSnapshotAccessAwaitable(AuthorizeSnapshotAccessRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::AuthorizeSnapshotAccess, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, CopyClusterSnapshotRequest, CopyClusterSnapshotOutcome> RedshiftClient::CopyClusterSnapshotAwaitable(CopyClusterSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::CopyClusterSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, CreateClusterRequest, CreateClusterOutcome> RedshiftClient::CreateClusterAwaitable(CreateClusterRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::CreateCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, CreateClusterParameterGroupRequest, CreateClusterParameterGroupOutcome> RedshiftClient::CreateClusterParameterGroupAwaitable(CreateClusterParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::CreateClusterParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, CreateClusterSecurityGroupRequest, CreateClusterSecurityGroupOutcome> RedshiftClient::CreateClusterSecurityGroupAwaitable(CreateClusterSecurityGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::CreateClusterSecurityGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, CreateClusterSnapshotRequest, CreateClusterSnapshotOutcome> RedshiftClient::CreateClusterSnapshotAwaitable(CreateClusterSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::CreateClusterSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, CreateClusterSubnetGroupRequest, CreateClusterSubnetGroupOutcome> RedshiftClient::CreateClusterSubnetGroupAwaitable(CreateClusterSubnetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::CreateClusterSubnetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, CreateEventSubscriptionRequest, CreateEventSubscriptionOutcome> RedshiftClient::CreateEventSubscriptionAwaitable(CreateEventSubscriptionRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::CreateEventSubscription, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, CreateHsmClientCertificateRequest, CreateHsmClientCertificateOutcome> RedshiftClient::CreateHsmClientCertificateAwaitable(CreateHsmClientCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::CreateHsmClientCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, CreateHsmConfigurationRequest, CreateHsmConfigurationOutcome> RedshiftClient::CreateHsmConfigurationAwaitable(CreateHsmConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::CreateHsmConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, CreateSnapshotCopyGrantRequest, CreateSnapshotCopyGrantOutcome> RedshiftClient::CreateSnapshotCopyGrantAwaitable(CreateSnapshotCopyGrantRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::CreateSnapshotCopyGrant, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, CreateTagsRequest, CreateTagsOutcome> RedshiftClient::CreateTagsAwaitable(CreateTagsRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::CreateTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DeleteClusterRequest, DeleteClusterOutcome> RedshiftClient::DeleteClusterAwaitable(DeleteClusterRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DeleteCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DeleteClusterParameterGroupRequest, DeleteClusterParameterGroupOutcome> RedshiftClient::DeleteClusterParameterGroupAwaitable(DeleteClusterParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DeleteClusterParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DeleteClusterSecurityGroupRequest, DeleteClusterSecurityGroupOutcome> RedshiftClient::DeleteClusterSecurityGroupAwaitable(DeleteClusterSecurityGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DeleteClusterSecurityGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DeleteClusterSnapshotRequest, DeleteClusterSnapshotOutcome> RedshiftClient::DeleteClusterSnapshotAwaitable(DeleteClusterSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DeleteClusterSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DeleteClusterSubnetGroupRequest, DeleteClusterSubnetGroupOutcome> RedshiftClient::DeleteClusterSubnetGroupAwaitable(DeleteClusterSubnetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DeleteClusterSubnetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DeleteEventSubscriptionRequest, DeleteEventSubscriptionOutcome> RedshiftClient::DeleteEventSubscriptionAwaitable(DeleteEventSubscriptionRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DeleteEventSubscription, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DeleteHsmClientCertificateRequest, DeleteHsmClientCertificateOutcome> RedshiftClient::DeleteHsmClientCertificateAwaitable(DeleteHsmClientCertificateRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DeleteHsmClientCertificate, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DeleteHsmConfigurationRequest, DeleteHsmConfigurationOutcome> RedshiftClient::DeleteHsmConfigurationAwaitable(DeleteHsmConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DeleteHsmConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DeleteSnapshotCopyGrantRequest, DeleteSnapshotCopyGrantOutcome> RedshiftClient::DeleteSnapshotCopyGrantAwaitable(DeleteSnapshotCopyGrantRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DeleteSnapshotCopyGrant, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DeleteTagsRequest, DeleteTagsOutcome> RedshiftClient::DeleteTagsAwaitable(DeleteTagsRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DeleteTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeClusterParameterGroupsRequest, DescribeClusterParameterGroupsOutcome> RedshiftClient::DescribeClusterParameterGroupsAwaitable(DescribeClusterParameterGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeClusterParameterGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeClusterParametersRequest, DescribeClusterParametersOutcome> RedshiftClient::DescribeClusterParametersAwaitable(DescribeClusterParametersRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeClusterParameters, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeClusterSecurityGroupsRequest, DescribeClusterSecurityGroupsOutcome> RedshiftClient::DescribeClusterSecurityGroupsAwaitable(DescribeClusterSecurityGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeClusterSecurityGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeClusterSnapshotsRequest, DescribeClusterSnapshotsOutcome> RedshiftClient::DescribeClusterSnapshotsAwaitable(DescribeClusterSnapshotsRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeClusterSnapshots, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeClusterSubnetGroupsRequest, DescribeClusterSubnetGroupsOutcome> RedshiftClient::DescribeClusterSubnetGroupsAwaitable(DescribeClusterSubnetGroupsRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeClusterSubnetGroups, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeClusterVersionsRequest, DescribeClusterVersionsOutcome> RedshiftClient::DescribeClusterVersionsAwaitable(DescribeClusterVersionsRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeClusterVersions, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeClustersRequest, DescribeClustersOutcome> RedshiftClient::DescribeClustersAwaitable(DescribeClustersRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeClusters, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeDefaultClusterParametersRequest, DescribeDefaultClusterParametersOutcome> RedshiftClient::DescribeDefaultClusterParametersAwaitable(DescribeDefaultClusterParametersRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeDefaultClusterParameters, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeEventCategoriesRequest, DescribeEventCategoriesOutcome> RedshiftClient::DescribeEventCategoriesAwaitable(DescribeEventCategoriesRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeEventCategories, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeEventSubscriptionsRequest, DescribeEventSubscriptionsOutcome> RedshiftClient::DescribeEventSubscriptionsAwaitable(DescribeEventSubscriptionsRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeEventSubscriptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeEventsRequest, DescribeEventsOutcome> RedshiftClient::DescribeEventsAwaitable(DescribeEventsRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeEvents, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeHsmClientCertificatesRequest, DescribeHsmClientCertificatesOutcome> RedshiftClient::DescribeHsmClientCertificatesAwaitable(DescribeHsmClientCertificatesRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeHsmClientCertificates, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeHsmConfigurationsRequest, DescribeHsmConfigurationsOutcome> RedshiftClient::DescribeHsmConfigurationsAwaitable(DescribeHsmConfigurationsRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeHsmConfigurations, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeLoggingStatusRequest, DescribeLoggingStatusOutcome> RedshiftClient::DescribeLoggingStatusAwaitable(DescribeLoggingStatusRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeLoggingStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeOrderableClusterOptionsRequest, DescribeOrderableClusterOptionsOutcome> RedshiftClient::DescribeOrderableClusterOptionsAwaitable(DescribeOrderableClusterOptionsRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeOrderableClusterOptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeReservedNodeOfferingsRequest, DescribeReservedNodeOfferingsOutcome> RedshiftClient::DescribeReservedNodeOfferingsAwaitable(DescribeReservedNodeOfferingsRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeReservedNodeOfferings, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeReservedNodesRequest, DescribeReservedNodesOutcome> RedshiftClient::DescribeReservedNodesAwaitable(DescribeReservedNodesRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeReservedNodes, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeResizeRequest, DescribeResizeOutcome> RedshiftClient::DescribeResizeAwaitable(DescribeResizeRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeResize, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeSnapshotCopyGrantsRequest, DescribeSnapshotCopyGrantsOutcome> RedshiftClient::DescribeSnapshotCopyGrantsAwaitable(DescribeSnapshotCopyGrantsRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeSnapshotCopyGrants, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeTableRestoreStatusRequest, DescribeTableRestoreStatusOutcome> RedshiftClient::DescribeTableRestoreStatusAwaitable(DescribeTableRestoreStatusRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeTableRestoreStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DescribeTagsRequest, DescribeTagsOutcome> RedshiftClient::DescribeTagsAwaitable(DescribeTagsRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DescribeTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DisableLoggingRequest, DisableLoggingOutcome> RedshiftClient::DisableLoggingAwaitable(DisableLoggingRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DisableLogging, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, DisableSnapshotCopyRequest, DisableSnapshotCopyOutcome> RedshiftClient::DisableSnapshotCopyAwaitable(DisableSnapshotCopyRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::DisableSnapshotCopy, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, EnableLoggingRequest, EnableLoggingOutcome> RedshiftClient::EnableLoggingAwaitable(EnableLoggingRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::EnableLogging, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, EnableSnapshotCopyRequest, EnableSnapshotCopyOutcome> RedshiftClient::EnableSnapshotCopyAwaitable(EnableSnapshotCopyRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::EnableSnapshotCopy, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, ModifyClusterRequest, ModifyClusterOutcome> RedshiftClient::ModifyClusterAwaitable(ModifyClusterRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::ModifyCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, ModifyClusterIamRolesRequest, ModifyClusterIamRolesOutcome> RedshiftClient::ModifyClusterIamRolesAwaitable(ModifyClusterIamRolesRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::ModifyClusterIamRoles, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, ModifyClusterParameterGroupRequest, ModifyClusterParameterGroupOutcome> RedshiftClient::ModifyClusterParameterGroupAwaitable(ModifyClusterParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::ModifyClusterParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, ModifyClusterSubnetGroupRequest, ModifyClusterSubnetGroupOutcome> RedshiftClient::ModifyClusterSubnetGroupAwaitable(ModifyClusterSubnetGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::ModifyClusterSubnetGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, ModifyEventSubscriptionRequest, ModifyEventSubscriptionOutcome> RedshiftClient::ModifyEventSubscriptionAwaitable(ModifyEventSubscriptionRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::ModifyEventSubscription, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, ModifySnapshotCopyRetentionPeriodRequest, ModifySnapshotCopyRetentionPeriodOutcome> RedshiftClient::ModifySnapshotCopyRetentionPeriodAwaitable(ModifySnapshotCopyRetentionPeriodRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::ModifySnapshotCopyRetentionPeriod, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, PurchaseReservedNodeOfferingRequest, PurchaseReservedNodeOfferingOutcome> RedshiftClient::PurchaseReservedNodeOfferingAwaitable(PurchaseReservedNodeOfferingRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::PurchaseReservedNodeOffering, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, RebootClusterRequest, RebootClusterOutcome> RedshiftClient::RebootClusterAwaitable(RebootClusterRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::RebootCluster, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, ResetClusterParameterGroupRequest, ResetClusterParameterGroupOutcome> RedshiftClient::ResetClusterParameterGroupAwaitable(ResetClusterParameterGroupRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::ResetClusterParameterGroup, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, RestoreFromClusterSnapshotRequest, RestoreFromClusterSnapshotOutcome> RedshiftClient::RestoreFromClusterSnapshotAwaitable(RestoreFromClusterSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::RestoreFromClusterSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, RestoreTableFromClusterSnapshotRequest, RestoreTableFromClusterSnapshotOutcome> RedshiftClient::RestoreTableFromClusterSnapshotAwaitable(RestoreTableFromClusterSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::RestoreTableFromClusterSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, RevokeClusterSecurityGroupIngressRequest, RevokeClusterSecurityGroupIngressOutcome> RedshiftClient::RevokeClusterSecurityGroupIngressAwaitable(RevokeClusterSecurityGroupIngressRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::RevokeClusterSecurityGroupIngress, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, RevokeSnapshotAccessRequest, RevokeSnapshotAccessOutcome> RedshiftClient::RevokeSnapshotAccessAwaitable(RevokeSnapshotAccessRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::RevokeSnapshotAccess, std::move(request) } };
+}
+
+ClientOperationAwaitable<RedshiftClient, RotateEncryptionKeyRequest, RotateEncryptionKeyOutcome> RedshiftClient::RotateEncryptionKeyAwaitable(RotateEncryptionKeyRequest request) const
+{
+  return { m_executor.get(), { this, &RedshiftClient::RotateEncryptionKey, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
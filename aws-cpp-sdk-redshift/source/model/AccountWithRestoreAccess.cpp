@@ -49,7 +49,7 @@ AccountWithRestoreAccess& AccountWithRestoreAccess::operator =(const XmlNode& xm
     XmlNode accountIdNode = resultNode.FirstChild("AccountId");
     if(!accountIdNode.IsNull())
     {
-      m_accountId = StringUtils::Trim(accountIdNode.GetText().c_str());
+      m_accountId = accountIdNode.GetTextView().Trim().ToString();
       m_accountIdHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void AccountWithRestoreAccess::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_accountIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AccountId=" << StringUtils::URLEncode(m_accountId.c_str()) << "&";
+      oStream << location << index << locationValue << ".AccountId=" << StringUtils::URLEncoded(m_accountId) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void AccountWithRestoreAccess::OutputToStream(Aws::OStream& oStream, const char*
 {
   if(m_accountIdHasBeenSet)
   {
-      oStream << location << ".AccountId=" << StringUtils::URLEncode(m_accountId.c_str()) << "&";
+      oStream << location << ".AccountId=" << StringUtils::URLEncoded(m_accountId) << "&";
   }
 }
 
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/AuthorizeClusterSecurityGroupIngressRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -29,29 +30,29 @@ AuthorizeClusterSecurityGroupIngressRequest::AuthorizeClusterSecurityGroupIngres
 
 Aws::String AuthorizeClusterSecurityGroupIngressRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AuthorizeClusterSecurityGroupIngress&";
   if(m_clusterSecurityGroupNameHasBeenSet)
   {
-    ss << "ClusterSecurityGroupName=" << StringUtils::URLEncode(m_clusterSecurityGroupName.c_str()) << "&";
+    ss << "ClusterSecurityGroupName=" << StringUtils::URLEncoded(m_clusterSecurityGroupName) << "&";
   }
 
   if(m_cIDRIPHasBeenSet)
   {
-    ss << "CIDRIP=" << StringUtils::URLEncode(m_cIDRIP.c_str()) << "&";
+    ss << "CIDRIP=" << StringUtils::URLEncoded(m_cIDRIP) << "&";
   }
 
   if(m_eC2SecurityGroupNameHasBeenSet)
   {
-    ss << "EC2SecurityGroupName=" << StringUtils::URLEncode(m_eC2SecurityGroupName.c_str()) << "&";
+    ss << "EC2SecurityGroupName=" << StringUtils::URLEncoded(m_eC2SecurityGroupName) << "&";
   }
 
   if(m_eC2SecurityGroupOwnerIdHasBeenSet)
   {
-    ss << "EC2SecurityGroupOwnerId=" << StringUtils::URLEncode(m_eC2SecurityGroupOwnerId.c_str()) << "&";
+    ss << "EC2SecurityGroupOwnerId=" << StringUtils::URLEncoded(m_eC2SecurityGroupOwnerId) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ AuthorizeClusterSecurityGroupIngressResult& AuthorizeClusterSecurityGroupIngress
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AuthorizeClusterSecurityGroupIngressResult")
+  if (rootNode.GetNameView() != "AuthorizeClusterSecurityGroupIngressResult")
   {
     resultNode = rootNode.FirstChild("AuthorizeClusterSecurityGroupIngressResult");
   }
@@ -40,7 +40,7 @@ AuthorizeSnapshotAccessResult& AuthorizeSnapshotAccessResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AuthorizeSnapshotAccessResult")
+  if (rootNode.GetNameView() != "AuthorizeSnapshotAccessResult")
   {
     resultNode = rootNode.FirstChild("AuthorizeSnapshotAccessResult");
   }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -121,37 +122,37 @@ Cluster& Cluster::operator =(const XmlNode& xmlNode)
     XmlNode clusterIdentifierNode = resultNode.FirstChild("ClusterIdentifier");
     if(!clusterIdentifierNode.IsNull())
     {
-      m_clusterIdentifier = StringUtils::Trim(clusterIdentifierNode.GetText().c_str());
+      m_clusterIdentifier = clusterIdentifierNode.GetTextView().Trim().ToString();
       m_clusterIdentifierHasBeenSet = true;
     }
     XmlNode nodeTypeNode = resultNode.FirstChild("NodeType");
     if(!nodeTypeNode.IsNull())
     {
-      m_nodeType = StringUtils::Trim(nodeTypeNode.GetText().c_str());
+      m_nodeType = nodeTypeNode.GetTextView().Trim().ToString();
       m_nodeTypeHasBeenSet = true;
     }
     XmlNode clusterStatusNode = resultNode.FirstChild("ClusterStatus");
     if(!clusterStatusNode.IsNull())
     {
-      m_clusterStatus = StringUtils::Trim(clusterStatusNode.GetText().c_str());
+      m_clusterStatus = clusterStatusNode.GetTextView().Trim().ToString();
       m_clusterStatusHasBeenSet = true;
     }
     XmlNode modifyStatusNode = resultNode.FirstChild("ModifyStatus");
     if(!modifyStatusNode.IsNull())
     {
-      m_modifyStatus = StringUtils::Trim(modifyStatusNode.GetText().c_str());
+      m_modifyStatus = modifyStatusNode.GetTextView().Trim().ToString();
       m_modifyStatusHasBeenSet = true;
     }
     XmlNode masterUsernameNode = resultNode.FirstChild("MasterUsername");
     if(!masterUsernameNode.IsNull())
     {
-      m_masterUsername = StringUtils::Trim(masterUsernameNode.GetText().c_str());
+      m_masterUsername = masterUsernameNode.GetTextView().Trim().ToString();
       m_masterUsernameHasBeenSet = true;
     }
     XmlNode dBNameNode = resultNode.FirstChild("DBName");
     if(!dBNameNode.IsNull())
     {
-      m_dBName = StringUtils::Trim(dBNameNode.GetText().c_str());
+      m_dBName = dBNameNode.GetTextView().Trim().ToString();
       m_dBNameHasBeenSet = true;
     }
     XmlNode endpointNode = resultNode.FirstChild("Endpoint");
@@ -163,13 +164,13 @@ Cluster& Cluster::operator =(const XmlNode& xmlNode)
     XmlNode clusterCreateTimeNode = resultNode.FirstChild("ClusterCreateTime");
     if(!clusterCreateTimeNode.IsNull())
     {
-      m_clusterCreateTime = DateTime(StringUtils::Trim(clusterCreateTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_clusterCreateTime = DateTime(clusterCreateTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_clusterCreateTimeHasBeenSet = true;
     }
     XmlNode automatedSnapshotRetentionPeriodNode = resultNode.FirstChild("AutomatedSnapshotRetentionPeriod");
     if(!automatedSnapshotRetentionPeriodNode.IsNull())
     {
-      m_automatedSnapshotRetentionPeriod = StringUtils::ConvertToInt32(StringUtils::Trim(automatedSnapshotRetentionPeriodNode.GetText().c_str()).c_str());
+      m_automatedSnapshotRetentionPeriod = StringUtils::ConvertToInt32(automatedSnapshotRetentionPeriodNode.GetTextView().Trim().ToString().c_str());
       m_automatedSnapshotRetentionPeriodHasBeenSet = true;
     }
     XmlNode clusterSecurityGroupsNode = resultNode.FirstChild("ClusterSecurityGroups");
@@ -211,25 +212,25 @@ Cluster& Cluster::operator =(const XmlNode& xmlNode)
     XmlNode clusterSubnetGroupNameNode = resultNode.FirstChild("ClusterSubnetGroupName");
     if(!clusterSubnetGroupNameNode.IsNull())
     {
-      m_clusterSubnetGroupName = StringUtils::Trim(clusterSubnetGroupNameNode.GetText().c_str());
+      m_clusterSubnetGroupName = clusterSubnetGroupNameNode.GetTextView().Trim().ToString();
       m_clusterSubnetGroupNameHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("VpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode availabilityZoneNode = resultNode.FirstChild("AvailabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode preferredMaintenanceWindowNode = resultNode.FirstChild("PreferredMaintenanceWindow");
     if(!preferredMaintenanceWindowNode.IsNull())
     {
-      m_preferredMaintenanceWindow = StringUtils::Trim(preferredMaintenanceWindowNode.GetText().c_str());
+      m_preferredMaintenanceWindow = preferredMaintenanceWindowNode.GetTextView().Trim().ToString();
       m_preferredMaintenanceWindowHasBeenSet = true;
     }
     XmlNode pendingModifiedValuesNode = resultNode.FirstChild("PendingModifiedValues");
@@ -241,31 +242,31 @@ Cluster& Cluster::operator =(const XmlNode& xmlNode)
     XmlNode clusterVersionNode = resultNode.FirstChild("ClusterVersion");
     if(!clusterVersionNode.IsNull())
     {
-      m_clusterVersion = StringUtils::Trim(clusterVersionNode.GetText().c_str());
+      m_clusterVersion = clusterVersionNode.GetTextView().Trim().ToString();
       m_clusterVersionHasBeenSet = true;
     }
     XmlNode allowVersionUpgradeNode = resultNode.FirstChild("AllowVersionUpgrade");
     if(!allowVersionUpgradeNode.IsNull())
     {
-      m_allowVersionUpgrade = StringUtils::ConvertToBool(StringUtils::Trim(allowVersionUpgradeNode.GetText().c_str()).c_str());
+      m_allowVersionUpgrade = StringUtils::ConvertToBool(allowVersionUpgradeNode.GetTextView().Trim().ToString().c_str());
       m_allowVersionUpgradeHasBeenSet = true;
     }
     XmlNode numberOfNodesNode = resultNode.FirstChild("NumberOfNodes");
     if(!numberOfNodesNode.IsNull())
     {
-      m_numberOfNodes = StringUtils::ConvertToInt32(StringUtils::Trim(numberOfNodesNode.GetText().c_str()).c_str());
+      m_numberOfNodes = StringUtils::ConvertToInt32(numberOfNodesNode.GetTextView().Trim().ToString().c_str());
       m_numberOfNodesHasBeenSet = true;
     }
     XmlNode publiclyAccessibleNode = resultNode.FirstChild("PubliclyAccessible");
     if(!publiclyAccessibleNode.IsNull())
     {
-      m_publiclyAccessible = StringUtils::ConvertToBool(StringUtils::Trim(publiclyAccessibleNode.GetText().c_str()).c_str());
+      m_publiclyAccessible = StringUtils::ConvertToBool(publiclyAccessibleNode.GetTextView().Trim().ToString().c_str());
       m_publiclyAccessibleHasBeenSet = true;
     }
     XmlNode encryptedNode = resultNode.FirstChild("Encrypted");
     if(!encryptedNode.IsNull())
     {
-      m_encrypted = StringUtils::ConvertToBool(StringUtils::Trim(encryptedNode.GetText().c_str()).c_str());
+      m_encrypted = StringUtils::ConvertToBool(encryptedNode.GetTextView().Trim().ToString().c_str());
       m_encryptedHasBeenSet = true;
     }
     XmlNode restoreStatusNode = resultNode.FirstChild("RestoreStatus");
@@ -289,7 +290,7 @@ Cluster& Cluster::operator =(const XmlNode& xmlNode)
     XmlNode clusterPublicKeyNode = resultNode.FirstChild("ClusterPublicKey");
     if(!clusterPublicKeyNode.IsNull())
     {
-      m_clusterPublicKey = StringUtils::Trim(clusterPublicKeyNode.GetText().c_str());
+      m_clusterPublicKey = clusterPublicKeyNode.GetTextView().Trim().ToString();
       m_clusterPublicKeyHasBeenSet = true;
     }
     XmlNode clusterNodesNode = resultNode.FirstChild("ClusterNodes");
@@ -313,7 +314,7 @@ Cluster& Cluster::operator =(const XmlNode& xmlNode)
     XmlNode clusterRevisionNumberNode = resultNode.FirstChild("ClusterRevisionNumber");
     if(!clusterRevisionNumberNode.IsNull())
     {
-      m_clusterRevisionNumber = StringUtils::Trim(clusterRevisionNumberNode.GetText().c_str());
+      m_clusterRevisionNumber = clusterRevisionNumberNode.GetTextView().Trim().ToString();
       m_clusterRevisionNumberHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("Tags");
@@ -331,7 +332,7 @@ Cluster& Cluster::operator =(const XmlNode& xmlNode)
     XmlNode kmsKeyIdNode = resultNode.FirstChild("KmsKeyId");
     if(!kmsKeyIdNode.IsNull())
     {
-      m_kmsKeyId = StringUtils::Trim(kmsKeyIdNode.GetText().c_str());
+      m_kmsKeyId = kmsKeyIdNode.GetTextView().Trim().ToString();
       m_kmsKeyIdHasBeenSet = true;
     }
     XmlNode iamRolesNode = resultNode.FirstChild("IamRoles");
@@ -355,44 +356,44 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location, unsign
 {
   if(m_clusterIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
 
   if(m_nodeTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NodeType=" << StringUtils::URLEncode(m_nodeType.c_str()) << "&";
+      oStream << location << index << locationValue << ".NodeType=" << StringUtils::URLEncoded(m_nodeType) << "&";
   }
 
   if(m_clusterStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterStatus=" << StringUtils::URLEncode(m_clusterStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterStatus=" << StringUtils::URLEncoded(m_clusterStatus) << "&";
   }
 
   if(m_modifyStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ModifyStatus=" << StringUtils::URLEncode(m_modifyStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".ModifyStatus=" << StringUtils::URLEncoded(m_modifyStatus) << "&";
   }
 
   if(m_masterUsernameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MasterUsername=" << StringUtils::URLEncode(m_masterUsername.c_str()) << "&";
+      oStream << location << index << locationValue << ".MasterUsername=" << StringUtils::URLEncoded(m_masterUsername) << "&";
   }
 
   if(m_dBNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBName=" << StringUtils::URLEncode(m_dBName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBName=" << StringUtils::URLEncoded(m_dBName) << "&";
   }
 
   if(m_endpointHasBeenSet)
   {
-      Aws::StringStream endpointLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream endpointLocationAndMemberSs;
       endpointLocationAndMemberSs << location << index << locationValue << ".Endpoint";
-      m_endpoint.OutputToStream(oStream, endpointLocationAndMemberSs.str().c_str());
+      m_endpoint.OutputToStream(oStream, endpointLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_clusterCreateTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterCreateTime=" << StringUtils::URLEncode(m_clusterCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterCreateTime=" << StringUtils::URLEncoded(m_clusterCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_automatedSnapshotRetentionPeriodHasBeenSet)
@@ -405,9 +406,9 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location, unsign
       unsigned clusterSecurityGroupsIdx = 1;
       for(auto& item : m_clusterSecurityGroups)
       {
-        Aws::StringStream clusterSecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream clusterSecurityGroupsSs;
         clusterSecurityGroupsSs << location << index << locationValue << ".ClusterSecurityGroup." << clusterSecurityGroupsIdx++;
-        item.OutputToStream(oStream, clusterSecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, clusterSecurityGroupsSs.GetString().c_str());
       }
   }
 
@@ -416,9 +417,9 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location, unsign
       unsigned vpcSecurityGroupsIdx = 1;
       for(auto& item : m_vpcSecurityGroups)
       {
-        Aws::StringStream vpcSecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream vpcSecurityGroupsSs;
         vpcSecurityGroupsSs << location << index << locationValue << ".VpcSecurityGroup." << vpcSecurityGroupsIdx++;
-        item.OutputToStream(oStream, vpcSecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, vpcSecurityGroupsSs.GetString().c_str());
       }
   }
 
@@ -427,42 +428,42 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location, unsign
       unsigned clusterParameterGroupsIdx = 1;
       for(auto& item : m_clusterParameterGroups)
       {
-        Aws::StringStream clusterParameterGroupsSs;
+        Aws::Utils::Stream::StringOutputStream clusterParameterGroupsSs;
         clusterParameterGroupsSs << location << index << locationValue << ".ClusterParameterGroup." << clusterParameterGroupsIdx++;
-        item.OutputToStream(oStream, clusterParameterGroupsSs.str().c_str());
+        item.OutputToStream(oStream, clusterParameterGroupsSs.GetString().c_str());
       }
   }
 
   if(m_clusterSubnetGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterSubnetGroupName=" << StringUtils::URLEncode(m_clusterSubnetGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterSubnetGroupName=" << StringUtils::URLEncoded(m_clusterSubnetGroupName) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+      oStream << location << index << locationValue << ".PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
 
   if(m_pendingModifiedValuesHasBeenSet)
   {
-      Aws::StringStream pendingModifiedValuesLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream pendingModifiedValuesLocationAndMemberSs;
       pendingModifiedValuesLocationAndMemberSs << location << index << locationValue << ".PendingModifiedValues";
-      m_pendingModifiedValues.OutputToStream(oStream, pendingModifiedValuesLocationAndMemberSs.str().c_str());
+      m_pendingModifiedValues.OutputToStream(oStream, pendingModifiedValuesLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_clusterVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterVersion=" << StringUtils::URLEncode(m_clusterVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterVersion=" << StringUtils::URLEncoded(m_clusterVersion) << "&";
   }
 
   if(m_allowVersionUpgradeHasBeenSet)
@@ -487,28 +488,28 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location, unsign
 
   if(m_restoreStatusHasBeenSet)
   {
-      Aws::StringStream restoreStatusLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream restoreStatusLocationAndMemberSs;
       restoreStatusLocationAndMemberSs << location << index << locationValue << ".RestoreStatus";
-      m_restoreStatus.OutputToStream(oStream, restoreStatusLocationAndMemberSs.str().c_str());
+      m_restoreStatus.OutputToStream(oStream, restoreStatusLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_hsmStatusHasBeenSet)
   {
-      Aws::StringStream hsmStatusLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream hsmStatusLocationAndMemberSs;
       hsmStatusLocationAndMemberSs << location << index << locationValue << ".HsmStatus";
-      m_hsmStatus.OutputToStream(oStream, hsmStatusLocationAndMemberSs.str().c_str());
+      m_hsmStatus.OutputToStream(oStream, hsmStatusLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_clusterSnapshotCopyStatusHasBeenSet)
   {
-      Aws::StringStream clusterSnapshotCopyStatusLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream clusterSnapshotCopyStatusLocationAndMemberSs;
       clusterSnapshotCopyStatusLocationAndMemberSs << location << index << locationValue << ".ClusterSnapshotCopyStatus";
-      m_clusterSnapshotCopyStatus.OutputToStream(oStream, clusterSnapshotCopyStatusLocationAndMemberSs.str().c_str());
+      m_clusterSnapshotCopyStatus.OutputToStream(oStream, clusterSnapshotCopyStatusLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_clusterPublicKeyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterPublicKey=" << StringUtils::URLEncode(m_clusterPublicKey.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterPublicKey=" << StringUtils::URLEncoded(m_clusterPublicKey) << "&";
   }
 
   if(m_clusterNodesHasBeenSet)
@@ -516,22 +517,22 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location, unsign
       unsigned clusterNodesIdx = 1;
       for(auto& item : m_clusterNodes)
       {
-        Aws::StringStream clusterNodesSs;
+        Aws::Utils::Stream::StringOutputStream clusterNodesSs;
         clusterNodesSs << location << index << locationValue << ".ClusterNodes.member." << clusterNodesIdx++;
-        item.OutputToStream(oStream, clusterNodesSs.str().c_str());
+        item.OutputToStream(oStream, clusterNodesSs.GetString().c_str());
       }
   }
 
   if(m_elasticIpStatusHasBeenSet)
   {
-      Aws::StringStream elasticIpStatusLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream elasticIpStatusLocationAndMemberSs;
       elasticIpStatusLocationAndMemberSs << location << index << locationValue << ".ElasticIpStatus";
-      m_elasticIpStatus.OutputToStream(oStream, elasticIpStatusLocationAndMemberSs.str().c_str());
+      m_elasticIpStatus.OutputToStream(oStream, elasticIpStatusLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_clusterRevisionNumberHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterRevisionNumber=" << StringUtils::URLEncode(m_clusterRevisionNumber.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterRevisionNumber=" << StringUtils::URLEncoded(m_clusterRevisionNumber) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -539,15 +540,15 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location, unsign
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".Tag." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
   if(m_kmsKeyIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+      oStream << location << index << locationValue << ".KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
 
   if(m_iamRolesHasBeenSet)
@@ -555,9 +556,9 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location, unsign
       unsigned iamRolesIdx = 1;
       for(auto& item : m_iamRoles)
       {
-        Aws::StringStream iamRolesSs;
+        Aws::Utils::Stream::StringOutputStream iamRolesSs;
         iamRolesSs << location << index << locationValue << ".ClusterIamRole." << iamRolesIdx++;
-        item.OutputToStream(oStream, iamRolesSs.str().c_str());
+        item.OutputToStream(oStream, iamRolesSs.GetString().c_str());
       }
   }
 
@@ -567,27 +568,27 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_clusterIdentifierHasBeenSet)
   {
-      oStream << location << ".ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+      oStream << location << ".ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
   if(m_nodeTypeHasBeenSet)
   {
-      oStream << location << ".NodeType=" << StringUtils::URLEncode(m_nodeType.c_str()) << "&";
+      oStream << location << ".NodeType=" << StringUtils::URLEncoded(m_nodeType) << "&";
   }
   if(m_clusterStatusHasBeenSet)
   {
-      oStream << location << ".ClusterStatus=" << StringUtils::URLEncode(m_clusterStatus.c_str()) << "&";
+      oStream << location << ".ClusterStatus=" << StringUtils::URLEncoded(m_clusterStatus) << "&";
   }
   if(m_modifyStatusHasBeenSet)
   {
-      oStream << location << ".ModifyStatus=" << StringUtils::URLEncode(m_modifyStatus.c_str()) << "&";
+      oStream << location << ".ModifyStatus=" << StringUtils::URLEncoded(m_modifyStatus) << "&";
   }
   if(m_masterUsernameHasBeenSet)
   {
-      oStream << location << ".MasterUsername=" << StringUtils::URLEncode(m_masterUsername.c_str()) << "&";
+      oStream << location << ".MasterUsername=" << StringUtils::URLEncoded(m_masterUsername) << "&";
   }
   if(m_dBNameHasBeenSet)
   {
-      oStream << location << ".DBName=" << StringUtils::URLEncode(m_dBName.c_str()) << "&";
+      oStream << location << ".DBName=" << StringUtils::URLEncoded(m_dBName) << "&";
   }
   if(m_endpointHasBeenSet)
   {
@@ -597,7 +598,7 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_clusterCreateTimeHasBeenSet)
   {
-      oStream << location << ".ClusterCreateTime=" << StringUtils::URLEncode(m_clusterCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".ClusterCreateTime=" << StringUtils::URLEncoded(m_clusterCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_automatedSnapshotRetentionPeriodHasBeenSet)
   {
@@ -608,9 +609,9 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned clusterSecurityGroupsIdx = 1;
       for(auto& item : m_clusterSecurityGroups)
       {
-        Aws::StringStream clusterSecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream clusterSecurityGroupsSs;
         clusterSecurityGroupsSs << location <<  ".ClusterSecurityGroup." << clusterSecurityGroupsIdx++;
-        item.OutputToStream(oStream, clusterSecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, clusterSecurityGroupsSs.GetString().c_str());
       }
   }
   if(m_vpcSecurityGroupsHasBeenSet)
@@ -618,9 +619,9 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned vpcSecurityGroupsIdx = 1;
       for(auto& item : m_vpcSecurityGroups)
       {
-        Aws::StringStream vpcSecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream vpcSecurityGroupsSs;
         vpcSecurityGroupsSs << location <<  ".VpcSecurityGroup." << vpcSecurityGroupsIdx++;
-        item.OutputToStream(oStream, vpcSecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, vpcSecurityGroupsSs.GetString().c_str());
       }
   }
   if(m_clusterParameterGroupsHasBeenSet)
@@ -628,26 +629,26 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned clusterParameterGroupsIdx = 1;
       for(auto& item : m_clusterParameterGroups)
       {
-        Aws::StringStream clusterParameterGroupsSs;
+        Aws::Utils::Stream::StringOutputStream clusterParameterGroupsSs;
         clusterParameterGroupsSs << location <<  ".ClusterParameterGroup." << clusterParameterGroupsIdx++;
-        item.OutputToStream(oStream, clusterParameterGroupsSs.str().c_str());
+        item.OutputToStream(oStream, clusterParameterGroupsSs.GetString().c_str());
       }
   }
   if(m_clusterSubnetGroupNameHasBeenSet)
   {
-      oStream << location << ".ClusterSubnetGroupName=" << StringUtils::URLEncode(m_clusterSubnetGroupName.c_str()) << "&";
+      oStream << location << ".ClusterSubnetGroupName=" << StringUtils::URLEncoded(m_clusterSubnetGroupName) << "&";
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-      oStream << location << ".PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+      oStream << location << ".PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
   if(m_pendingModifiedValuesHasBeenSet)
   {
@@ -657,7 +658,7 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_clusterVersionHasBeenSet)
   {
-      oStream << location << ".ClusterVersion=" << StringUtils::URLEncode(m_clusterVersion.c_str()) << "&";
+      oStream << location << ".ClusterVersion=" << StringUtils::URLEncoded(m_clusterVersion) << "&";
   }
   if(m_allowVersionUpgradeHasBeenSet)
   {
@@ -695,16 +696,16 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_clusterPublicKeyHasBeenSet)
   {
-      oStream << location << ".ClusterPublicKey=" << StringUtils::URLEncode(m_clusterPublicKey.c_str()) << "&";
+      oStream << location << ".ClusterPublicKey=" << StringUtils::URLEncoded(m_clusterPublicKey) << "&";
   }
   if(m_clusterNodesHasBeenSet)
   {
       unsigned clusterNodesIdx = 1;
       for(auto& item : m_clusterNodes)
       {
-        Aws::StringStream clusterNodesSs;
+        Aws::Utils::Stream::StringOutputStream clusterNodesSs;
         clusterNodesSs << location <<  ".ClusterNodes.member." << clusterNodesIdx++;
-        item.OutputToStream(oStream, clusterNodesSs.str().c_str());
+        item.OutputToStream(oStream, clusterNodesSs.GetString().c_str());
       }
   }
   if(m_elasticIpStatusHasBeenSet)
@@ -715,30 +716,30 @@ void Cluster::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_clusterRevisionNumberHasBeenSet)
   {
-      oStream << location << ".ClusterRevisionNumber=" << StringUtils::URLEncode(m_clusterRevisionNumber.c_str()) << "&";
+      oStream << location << ".ClusterRevisionNumber=" << StringUtils::URLEncoded(m_clusterRevisionNumber) << "&";
   }
   if(m_tagsHasBeenSet)
   {
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".Tag." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
   if(m_kmsKeyIdHasBeenSet)
   {
-      oStream << location << ".KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+      oStream << location << ".KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
   if(m_iamRolesHasBeenSet)
   {
       unsigned iamRolesIdx = 1;
       for(auto& item : m_iamRoles)
       {
-        Aws::StringStream iamRolesSs;
+        Aws::Utils::Stream::StringOutputStream iamRolesSs;
         iamRolesSs << location <<  ".ClusterIamRole." << iamRolesIdx++;
-        item.OutputToStream(oStream, iamRolesSs.str().c_str());
+        item.OutputToStream(oStream, iamRolesSs.GetString().c_str());
       }
   }
 }
@@ -51,13 +51,13 @@ ClusterIamRole& ClusterIamRole::operator =(const XmlNode& xmlNode)
     XmlNode iamRoleArnNode = resultNode.FirstChild("IamRoleArn");
     if(!iamRoleArnNode.IsNull())
     {
-      m_iamRoleArn = StringUtils::Trim(iamRoleArnNode.GetText().c_str());
+      m_iamRoleArn = iamRoleArnNode.GetTextView().Trim().ToString();
       m_iamRoleArnHasBeenSet = true;
     }
     XmlNode applyStatusNode = resultNode.FirstChild("ApplyStatus");
     if(!applyStatusNode.IsNull())
     {
-      m_applyStatus = StringUtils::Trim(applyStatusNode.GetText().c_str());
+      m_applyStatus = applyStatusNode.GetTextView().Trim().ToString();
       m_applyStatusHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void ClusterIamRole::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_iamRoleArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".IamRoleArn=" << StringUtils::URLEncode(m_iamRoleArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".IamRoleArn=" << StringUtils::URLEncoded(m_iamRoleArn) << "&";
   }
 
   if(m_applyStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ApplyStatus=" << StringUtils::URLEncode(m_applyStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".ApplyStatus=" << StringUtils::URLEncoded(m_applyStatus) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void ClusterIamRole::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_iamRoleArnHasBeenSet)
   {
-      oStream << location << ".IamRoleArn=" << StringUtils::URLEncode(m_iamRoleArn.c_str()) << "&";
+      oStream << location << ".IamRoleArn=" << StringUtils::URLEncoded(m_iamRoleArn) << "&";
   }
   if(m_applyStatusHasBeenSet)
   {
-      oStream << location << ".ApplyStatus=" << StringUtils::URLEncode(m_applyStatus.c_str()) << "&";
+      oStream << location << ".ApplyStatus=" << StringUtils::URLEncoded(m_applyStatus) << "&";
   }
 }
 
@@ -53,19 +53,19 @@ ClusterNode& ClusterNode::operator =(const XmlNode& xmlNode)
     XmlNode nodeRoleNode = resultNode.FirstChild("NodeRole");
     if(!nodeRoleNode.IsNull())
     {
-      m_nodeRole = StringUtils::Trim(nodeRoleNode.GetText().c_str());
+      m_nodeRole = nodeRoleNode.GetTextView().Trim().ToString();
       m_nodeRoleHasBeenSet = true;
     }
     XmlNode privateIPAddressNode = resultNode.FirstChild("PrivateIPAddress");
     if(!privateIPAddressNode.IsNull())
     {
-      m_privateIPAddress = StringUtils::Trim(privateIPAddressNode.GetText().c_str());
+      m_privateIPAddress = privateIPAddressNode.GetTextView().Trim().ToString();
       m_privateIPAddressHasBeenSet = true;
     }
     XmlNode publicIPAddressNode = resultNode.FirstChild("PublicIPAddress");
     if(!publicIPAddressNode.IsNull())
     {
-      m_publicIPAddress = StringUtils::Trim(publicIPAddressNode.GetText().c_str());
+      m_publicIPAddress = publicIPAddressNode.GetTextView().Trim().ToString();
       m_publicIPAddressHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void ClusterNode::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_nodeRoleHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NodeRole=" << StringUtils::URLEncode(m_nodeRole.c_str()) << "&";
+      oStream << location << index << locationValue << ".NodeRole=" << StringUtils::URLEncoded(m_nodeRole) << "&";
   }
 
   if(m_privateIPAddressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PrivateIPAddress=" << StringUtils::URLEncode(m_privateIPAddress.c_str()) << "&";
+      oStream << location << index << locationValue << ".PrivateIPAddress=" << StringUtils::URLEncoded(m_privateIPAddress) << "&";
   }
 
   if(m_publicIPAddressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PublicIPAddress=" << StringUtils::URLEncode(m_publicIPAddress.c_str()) << "&";
+      oStream << location << index << locationValue << ".PublicIPAddress=" << StringUtils::URLEncoded(m_publicIPAddress) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void ClusterNode::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_nodeRoleHasBeenSet)
   {
-      oStream << location << ".NodeRole=" << StringUtils::URLEncode(m_nodeRole.c_str()) << "&";
+      oStream << location << ".NodeRole=" << StringUtils::URLEncoded(m_nodeRole) << "&";
   }
   if(m_privateIPAddressHasBeenSet)
   {
-      oStream << location << ".PrivateIPAddress=" << StringUtils::URLEncode(m_privateIPAddress.c_str()) << "&";
+      oStream << location << ".PrivateIPAddress=" << StringUtils::URLEncoded(m_privateIPAddress) << "&";
   }
   if(m_publicIPAddressHasBeenSet)
   {
-      oStream << location << ".PublicIPAddress=" << StringUtils::URLEncode(m_publicIPAddress.c_str()) << "&";
+      oStream << location << ".PublicIPAddress=" << StringUtils::URLEncoded(m_publicIPAddress) << "&";
   }
 }
 
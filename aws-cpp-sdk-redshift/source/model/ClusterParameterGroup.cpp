@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -55,19 +56,19 @@ ClusterParameterGroup& ClusterParameterGroup::operator =(const XmlNode& xmlNode)
     XmlNode parameterGroupNameNode = resultNode.FirstChild("ParameterGroupName");
     if(!parameterGroupNameNode.IsNull())
     {
-      m_parameterGroupName = StringUtils::Trim(parameterGroupNameNode.GetText().c_str());
+      m_parameterGroupName = parameterGroupNameNode.GetTextView().Trim().ToString();
       m_parameterGroupNameHasBeenSet = true;
     }
     XmlNode parameterGroupFamilyNode = resultNode.FirstChild("ParameterGroupFamily");
     if(!parameterGroupFamilyNode.IsNull())
     {
-      m_parameterGroupFamily = StringUtils::Trim(parameterGroupFamilyNode.GetText().c_str());
+      m_parameterGroupFamily = parameterGroupFamilyNode.GetTextView().Trim().ToString();
       m_parameterGroupFamilyHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("Tags");
@@ -91,17 +92,17 @@ void ClusterParameterGroup::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_parameterGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterGroupName=" << StringUtils::URLEncode(m_parameterGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterGroupName=" << StringUtils::URLEncoded(m_parameterGroupName) << "&";
   }
 
   if(m_parameterGroupFamilyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterGroupFamily=" << StringUtils::URLEncode(m_parameterGroupFamily.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterGroupFamily=" << StringUtils::URLEncoded(m_parameterGroupFamily) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -109,9 +110,9 @@ void ClusterParameterGroup::OutputToStream(Aws::OStream& oStream, const char* lo
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".Tag." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -121,24 +122,24 @@ void ClusterParameterGroup::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_parameterGroupNameHasBeenSet)
   {
-      oStream << location << ".ParameterGroupName=" << StringUtils::URLEncode(m_parameterGroupName.c_str()) << "&";
+      oStream << location << ".ParameterGroupName=" << StringUtils::URLEncoded(m_parameterGroupName) << "&";
   }
   if(m_parameterGroupFamilyHasBeenSet)
   {
-      oStream << location << ".ParameterGroupFamily=" << StringUtils::URLEncode(m_parameterGroupFamily.c_str()) << "&";
+      oStream << location << ".ParameterGroupFamily=" << StringUtils::URLEncoded(m_parameterGroupFamily) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_tagsHasBeenSet)
   {
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".Tag." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,13 +54,13 @@ ClusterParameterGroupStatus& ClusterParameterGroupStatus::operator =(const XmlNo
     XmlNode parameterGroupNameNode = resultNode.FirstChild("ParameterGroupName");
     if(!parameterGroupNameNode.IsNull())
     {
-      m_parameterGroupName = StringUtils::Trim(parameterGroupNameNode.GetText().c_str());
+      m_parameterGroupName = parameterGroupNameNode.GetTextView().Trim().ToString();
       m_parameterGroupNameHasBeenSet = true;
     }
     XmlNode parameterApplyStatusNode = resultNode.FirstChild("ParameterApplyStatus");
     if(!parameterApplyStatusNode.IsNull())
     {
-      m_parameterApplyStatus = StringUtils::Trim(parameterApplyStatusNode.GetText().c_str());
+      m_parameterApplyStatus = parameterApplyStatusNode.GetTextView().Trim().ToString();
       m_parameterApplyStatusHasBeenSet = true;
     }
     XmlNode clusterParameterStatusListNode = resultNode.FirstChild("ClusterParameterStatusList");
@@ -83,12 +84,12 @@ void ClusterParameterGroupStatus::OutputToStream(Aws::OStream& oStream, const ch
 {
   if(m_parameterGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterGroupName=" << StringUtils::URLEncode(m_parameterGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterGroupName=" << StringUtils::URLEncoded(m_parameterGroupName) << "&";
   }
 
   if(m_parameterApplyStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterApplyStatus=" << StringUtils::URLEncode(m_parameterApplyStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterApplyStatus=" << StringUtils::URLEncoded(m_parameterApplyStatus) << "&";
   }
 
   if(m_clusterParameterStatusListHasBeenSet)
@@ -96,9 +97,9 @@ void ClusterParameterGroupStatus::OutputToStream(Aws::OStream& oStream, const ch
       unsigned clusterParameterStatusListIdx = 1;
       for(auto& item : m_clusterParameterStatusList)
       {
-        Aws::StringStream clusterParameterStatusListSs;
+        Aws::Utils::Stream::StringOutputStream clusterParameterStatusListSs;
         clusterParameterStatusListSs << location << index << locationValue << ".ClusterParameterStatusList.member." << clusterParameterStatusListIdx++;
-        item.OutputToStream(oStream, clusterParameterStatusListSs.str().c_str());
+        item.OutputToStream(oStream, clusterParameterStatusListSs.GetString().c_str());
       }
   }
 
@@ -108,20 +109,20 @@ void ClusterParameterGroupStatus::OutputToStream(Aws::OStream& oStream, const ch
 {
   if(m_parameterGroupNameHasBeenSet)
   {
-      oStream << location << ".ParameterGroupName=" << StringUtils::URLEncode(m_parameterGroupName.c_str()) << "&";
+      oStream << location << ".ParameterGroupName=" << StringUtils::URLEncoded(m_parameterGroupName) << "&";
   }
   if(m_parameterApplyStatusHasBeenSet)
   {
-      oStream << location << ".ParameterApplyStatus=" << StringUtils::URLEncode(m_parameterApplyStatus.c_str()) << "&";
+      oStream << location << ".ParameterApplyStatus=" << StringUtils::URLEncoded(m_parameterApplyStatus) << "&";
   }
   if(m_clusterParameterStatusListHasBeenSet)
   {
       unsigned clusterParameterStatusListIdx = 1;
       for(auto& item : m_clusterParameterStatusList)
       {
-        Aws::StringStream clusterParameterStatusListSs;
+        Aws::Utils::Stream::StringOutputStream clusterParameterStatusListSs;
         clusterParameterStatusListSs << location <<  ".ClusterParameterStatusList.member." << clusterParameterStatusListIdx++;
-        item.OutputToStream(oStream, clusterParameterStatusListSs.str().c_str());
+        item.OutputToStream(oStream, clusterParameterStatusListSs.GetString().c_str());
       }
   }
 }
@@ -53,19 +53,19 @@ ClusterParameterStatus& ClusterParameterStatus::operator =(const XmlNode& xmlNod
     XmlNode parameterNameNode = resultNode.FirstChild("ParameterName");
     if(!parameterNameNode.IsNull())
     {
-      m_parameterName = StringUtils::Trim(parameterNameNode.GetText().c_str());
+      m_parameterName = parameterNameNode.GetTextView().Trim().ToString();
       m_parameterNameHasBeenSet = true;
     }
     XmlNode parameterApplyStatusNode = resultNode.FirstChild("ParameterApplyStatus");
     if(!parameterApplyStatusNode.IsNull())
     {
-      m_parameterApplyStatus = StringUtils::Trim(parameterApplyStatusNode.GetText().c_str());
+      m_parameterApplyStatus = parameterApplyStatusNode.GetTextView().Trim().ToString();
       m_parameterApplyStatusHasBeenSet = true;
     }
     XmlNode parameterApplyErrorDescriptionNode = resultNode.FirstChild("ParameterApplyErrorDescription");
     if(!parameterApplyErrorDescriptionNode.IsNull())
     {
-      m_parameterApplyErrorDescription = StringUtils::Trim(parameterApplyErrorDescriptionNode.GetText().c_str());
+      m_parameterApplyErrorDescription = parameterApplyErrorDescriptionNode.GetTextView().Trim().ToString();
       m_parameterApplyErrorDescriptionHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void ClusterParameterStatus::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_parameterNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterName=" << StringUtils::URLEncode(m_parameterName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterName=" << StringUtils::URLEncoded(m_parameterName) << "&";
   }
 
   if(m_parameterApplyStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterApplyStatus=" << StringUtils::URLEncode(m_parameterApplyStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterApplyStatus=" << StringUtils::URLEncoded(m_parameterApplyStatus) << "&";
   }
 
   if(m_parameterApplyErrorDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ParameterApplyErrorDescription=" << StringUtils::URLEncode(m_parameterApplyErrorDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".ParameterApplyErrorDescription=" << StringUtils::URLEncoded(m_parameterApplyErrorDescription) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void ClusterParameterStatus::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_parameterNameHasBeenSet)
   {
-      oStream << location << ".ParameterName=" << StringUtils::URLEncode(m_parameterName.c_str()) << "&";
+      oStream << location << ".ParameterName=" << StringUtils::URLEncoded(m_parameterName) << "&";
   }
   if(m_parameterApplyStatusHasBeenSet)
   {
-      oStream << location << ".ParameterApplyStatus=" << StringUtils::URLEncode(m_parameterApplyStatus.c_str()) << "&";
+      oStream << location << ".ParameterApplyStatus=" << StringUtils::URLEncoded(m_parameterApplyStatus) << "&";
   }
   if(m_parameterApplyErrorDescriptionHasBeenSet)
   {
-      oStream << location << ".ParameterApplyErrorDescription=" << StringUtils::URLEncode(m_parameterApplyErrorDescription.c_str()) << "&";
+      oStream << location << ".ParameterApplyErrorDescription=" << StringUtils::URLEncoded(m_parameterApplyErrorDescription) << "&";
   }
 }
 
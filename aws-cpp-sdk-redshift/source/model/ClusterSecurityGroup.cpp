@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -57,13 +58,13 @@ ClusterSecurityGroup& ClusterSecurityGroup::operator =(const XmlNode& xmlNode)
     XmlNode clusterSecurityGroupNameNode = resultNode.FirstChild("ClusterSecurityGroupName");
     if(!clusterSecurityGroupNameNode.IsNull())
     {
-      m_clusterSecurityGroupName = StringUtils::Trim(clusterSecurityGroupNameNode.GetText().c_str());
+      m_clusterSecurityGroupName = clusterSecurityGroupNameNode.GetTextView().Trim().ToString();
       m_clusterSecurityGroupNameHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode eC2SecurityGroupsNode = resultNode.FirstChild("EC2SecurityGroups");
@@ -111,12 +112,12 @@ void ClusterSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_clusterSecurityGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterSecurityGroupName=" << StringUtils::URLEncode(m_clusterSecurityGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterSecurityGroupName=" << StringUtils::URLEncoded(m_clusterSecurityGroupName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_eC2SecurityGroupsHasBeenSet)
@@ -124,9 +125,9 @@ void ClusterSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* loc
       unsigned eC2SecurityGroupsIdx = 1;
       for(auto& item : m_eC2SecurityGroups)
       {
-        Aws::StringStream eC2SecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream eC2SecurityGroupsSs;
         eC2SecurityGroupsSs << location << index << locationValue << ".EC2SecurityGroup." << eC2SecurityGroupsIdx++;
-        item.OutputToStream(oStream, eC2SecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, eC2SecurityGroupsSs.GetString().c_str());
       }
   }
 
@@ -135,9 +136,9 @@ void ClusterSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* loc
       unsigned iPRangesIdx = 1;
       for(auto& item : m_iPRanges)
       {
-        Aws::StringStream iPRangesSs;
+        Aws::Utils::Stream::StringOutputStream iPRangesSs;
         iPRangesSs << location << index << locationValue << ".IPRange." << iPRangesIdx++;
-        item.OutputToStream(oStream, iPRangesSs.str().c_str());
+        item.OutputToStream(oStream, iPRangesSs.GetString().c_str());
       }
   }
 
@@ -146,9 +147,9 @@ void ClusterSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* loc
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".Tag." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -158,20 +159,20 @@ void ClusterSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_clusterSecurityGroupNameHasBeenSet)
   {
-      oStream << location << ".ClusterSecurityGroupName=" << StringUtils::URLEncode(m_clusterSecurityGroupName.c_str()) << "&";
+      oStream << location << ".ClusterSecurityGroupName=" << StringUtils::URLEncoded(m_clusterSecurityGroupName) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_eC2SecurityGroupsHasBeenSet)
   {
       unsigned eC2SecurityGroupsIdx = 1;
       for(auto& item : m_eC2SecurityGroups)
       {
-        Aws::StringStream eC2SecurityGroupsSs;
+        Aws::Utils::Stream::StringOutputStream eC2SecurityGroupsSs;
         eC2SecurityGroupsSs << location <<  ".EC2SecurityGroup." << eC2SecurityGroupsIdx++;
-        item.OutputToStream(oStream, eC2SecurityGroupsSs.str().c_str());
+        item.OutputToStream(oStream, eC2SecurityGroupsSs.GetString().c_str());
       }
   }
   if(m_iPRangesHasBeenSet)
@@ -179,9 +180,9 @@ void ClusterSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* loc
       unsigned iPRangesIdx = 1;
       for(auto& item : m_iPRanges)
       {
-        Aws::StringStream iPRangesSs;
+        Aws::Utils::Stream::StringOutputStream iPRangesSs;
         iPRangesSs << location <<  ".IPRange." << iPRangesIdx++;
-        item.OutputToStream(oStream, iPRangesSs.str().c_str());
+        item.OutputToStream(oStream, iPRangesSs.GetString().c_str());
       }
   }
   if(m_tagsHasBeenSet)
@@ -189,9 +190,9 @@ void ClusterSecurityGroup::OutputToStream(Aws::OStream& oStream, const char* loc
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".Tag." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
@@ -51,13 +51,13 @@ ClusterSecurityGroupMembership& ClusterSecurityGroupMembership::operator =(const
     XmlNode clusterSecurityGroupNameNode = resultNode.FirstChild("ClusterSecurityGroupName");
     if(!clusterSecurityGroupNameNode.IsNull())
     {
-      m_clusterSecurityGroupName = StringUtils::Trim(clusterSecurityGroupNameNode.GetText().c_str());
+      m_clusterSecurityGroupName = clusterSecurityGroupNameNode.GetTextView().Trim().ToString();
       m_clusterSecurityGroupNameHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void ClusterSecurityGroupMembership::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_clusterSecurityGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterSecurityGroupName=" << StringUtils::URLEncode(m_clusterSecurityGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterSecurityGroupName=" << StringUtils::URLEncoded(m_clusterSecurityGroupName) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void ClusterSecurityGroupMembership::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_clusterSecurityGroupNameHasBeenSet)
   {
-      oStream << location << ".ClusterSecurityGroupName=" << StringUtils::URLEncode(m_clusterSecurityGroupName.c_str()) << "&";
+      oStream << location << ".ClusterSecurityGroupName=" << StringUtils::URLEncoded(m_clusterSecurityGroupName) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 }
 
@@ -55,19 +55,19 @@ ClusterSnapshotCopyStatus& ClusterSnapshotCopyStatus::operator =(const XmlNode&
     XmlNode destinationRegionNode = resultNode.FirstChild("DestinationRegion");
     if(!destinationRegionNode.IsNull())
     {
-      m_destinationRegion = StringUtils::Trim(destinationRegionNode.GetText().c_str());
+      m_destinationRegion = destinationRegionNode.GetTextView().Trim().ToString();
       m_destinationRegionHasBeenSet = true;
     }
     XmlNode retentionPeriodNode = resultNode.FirstChild("RetentionPeriod");
     if(!retentionPeriodNode.IsNull())
     {
-      m_retentionPeriod = StringUtils::ConvertToInt64(StringUtils::Trim(retentionPeriodNode.GetText().c_str()).c_str());
+      m_retentionPeriod = StringUtils::ConvertToInt64(retentionPeriodNode.GetTextView().Trim().ToString().c_str());
       m_retentionPeriodHasBeenSet = true;
     }
     XmlNode snapshotCopyGrantNameNode = resultNode.FirstChild("SnapshotCopyGrantName");
     if(!snapshotCopyGrantNameNode.IsNull())
     {
-      m_snapshotCopyGrantName = StringUtils::Trim(snapshotCopyGrantNameNode.GetText().c_str());
+      m_snapshotCopyGrantName = snapshotCopyGrantNameNode.GetTextView().Trim().ToString();
       m_snapshotCopyGrantNameHasBeenSet = true;
     }
   }
@@ -79,7 +79,7 @@ void ClusterSnapshotCopyStatus::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_destinationRegionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DestinationRegion=" << StringUtils::URLEncode(m_destinationRegion.c_str()) << "&";
+      oStream << location << index << locationValue << ".DestinationRegion=" << StringUtils::URLEncoded(m_destinationRegion) << "&";
   }
 
   if(m_retentionPeriodHasBeenSet)
@@ -89,7 +89,7 @@ void ClusterSnapshotCopyStatus::OutputToStream(Aws::OStream& oStream, const char
 
   if(m_snapshotCopyGrantNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotCopyGrantName=" << StringUtils::URLEncode(m_snapshotCopyGrantName.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotCopyGrantName=" << StringUtils::URLEncoded(m_snapshotCopyGrantName) << "&";
   }
 
 }
@@ -98,7 +98,7 @@ void ClusterSnapshotCopyStatus::OutputToStream(Aws::OStream& oStream, const char
 {
   if(m_destinationRegionHasBeenSet)
   {
-      oStream << location << ".DestinationRegion=" << StringUtils::URLEncode(m_destinationRegion.c_str()) << "&";
+      oStream << location << ".DestinationRegion=" << StringUtils::URLEncoded(m_destinationRegion) << "&";
   }
   if(m_retentionPeriodHasBeenSet)
   {
@@ -106,7 +106,7 @@ void ClusterSnapshotCopyStatus::OutputToStream(Aws::OStream& oStream, const char
   }
   if(m_snapshotCopyGrantNameHasBeenSet)
   {
-      oStream << location << ".SnapshotCopyGrantName=" << StringUtils::URLEncode(m_snapshotCopyGrantName.c_str()) << "&";
+      oStream << location << ".SnapshotCopyGrantName=" << StringUtils::URLEncoded(m_snapshotCopyGrantName) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,25 +60,25 @@ ClusterSubnetGroup& ClusterSubnetGroup::operator =(const XmlNode& xmlNode)
     XmlNode clusterSubnetGroupNameNode = resultNode.FirstChild("ClusterSubnetGroupName");
     if(!clusterSubnetGroupNameNode.IsNull())
     {
-      m_clusterSubnetGroupName = StringUtils::Trim(clusterSubnetGroupNameNode.GetText().c_str());
+      m_clusterSubnetGroupName = clusterSubnetGroupNameNode.GetTextView().Trim().ToString();
       m_clusterSubnetGroupNameHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("VpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode subnetGroupStatusNode = resultNode.FirstChild("SubnetGroupStatus");
     if(!subnetGroupStatusNode.IsNull())
     {
-      m_subnetGroupStatus = StringUtils::Trim(subnetGroupStatusNode.GetText().c_str());
+      m_subnetGroupStatus = subnetGroupStatusNode.GetTextView().Trim().ToString();
       m_subnetGroupStatusHasBeenSet = true;
     }
     XmlNode subnetsNode = resultNode.FirstChild("Subnets");
@@ -113,22 +114,22 @@ void ClusterSubnetGroup::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_clusterSubnetGroupNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterSubnetGroupName=" << StringUtils::URLEncode(m_clusterSubnetGroupName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterSubnetGroupName=" << StringUtils::URLEncoded(m_clusterSubnetGroupName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_subnetGroupStatusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubnetGroupStatus=" << StringUtils::URLEncode(m_subnetGroupStatus.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubnetGroupStatus=" << StringUtils::URLEncoded(m_subnetGroupStatus) << "&";
   }
 
   if(m_subnetsHasBeenSet)
@@ -136,9 +137,9 @@ void ClusterSubnetGroup::OutputToStream(Aws::OStream& oStream, const char* locat
       unsigned subnetsIdx = 1;
       for(auto& item : m_subnets)
       {
-        Aws::StringStream subnetsSs;
+        Aws::Utils::Stream::StringOutputStream subnetsSs;
         subnetsSs << location << index << locationValue << ".Subnet." << subnetsIdx++;
-        item.OutputToStream(oStream, subnetsSs.str().c_str());
+        item.OutputToStream(oStream, subnetsSs.GetString().c_str());
       }
   }
 
@@ -147,9 +148,9 @@ void ClusterSubnetGroup::OutputToStream(Aws::OStream& oStream, const char* locat
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".Tag." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -159,28 +160,28 @@ void ClusterSubnetGroup::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_clusterSubnetGroupNameHasBeenSet)
   {
-      oStream << location << ".ClusterSubnetGroupName=" << StringUtils::URLEncode(m_clusterSubnetGroupName.c_str()) << "&";
+      oStream << location << ".ClusterSubnetGroupName=" << StringUtils::URLEncoded(m_clusterSubnetGroupName) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_subnetGroupStatusHasBeenSet)
   {
-      oStream << location << ".SubnetGroupStatus=" << StringUtils::URLEncode(m_subnetGroupStatus.c_str()) << "&";
+      oStream << location << ".SubnetGroupStatus=" << StringUtils::URLEncoded(m_subnetGroupStatus) << "&";
   }
   if(m_subnetsHasBeenSet)
   {
       unsigned subnetsIdx = 1;
       for(auto& item : m_subnets)
       {
-        Aws::StringStream subnetsSs;
+        Aws::Utils::Stream::StringOutputStream subnetsSs;
         subnetsSs << location <<  ".Subnet." << subnetsIdx++;
-        item.OutputToStream(oStream, subnetsSs.str().c_str());
+        item.OutputToStream(oStream, subnetsSs.GetString().c_str());
       }
   }
   if(m_tagsHasBeenSet)
@@ -188,9 +189,9 @@ void ClusterSubnetGroup::OutputToStream(Aws::OStream& oStream, const char* locat
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".Tag." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
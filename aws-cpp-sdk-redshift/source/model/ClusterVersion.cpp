@@ -53,19 +53,19 @@ ClusterVersion& ClusterVersion::operator =(const XmlNode& xmlNode)
     XmlNode clusterVersionNode = resultNode.FirstChild("ClusterVersion");
     if(!clusterVersionNode.IsNull())
     {
-      m_clusterVersion = StringUtils::Trim(clusterVersionNode.GetText().c_str());
+      m_clusterVersion = clusterVersionNode.GetTextView().Trim().ToString();
       m_clusterVersionHasBeenSet = true;
     }
     XmlNode clusterParameterGroupFamilyNode = resultNode.FirstChild("ClusterParameterGroupFamily");
     if(!clusterParameterGroupFamilyNode.IsNull())
     {
-      m_clusterParameterGroupFamily = StringUtils::Trim(clusterParameterGroupFamilyNode.GetText().c_str());
+      m_clusterParameterGroupFamily = clusterParameterGroupFamilyNode.GetTextView().Trim().ToString();
       m_clusterParameterGroupFamilyHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
   }
@@ -77,17 +77,17 @@ void ClusterVersion::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_clusterVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterVersion=" << StringUtils::URLEncode(m_clusterVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterVersion=" << StringUtils::URLEncoded(m_clusterVersion) << "&";
   }
 
   if(m_clusterParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterParameterGroupFamily=" << StringUtils::URLEncode(m_clusterParameterGroupFamily.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterParameterGroupFamily=" << StringUtils::URLEncoded(m_clusterParameterGroupFamily) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
 }
@@ -96,15 +96,15 @@ void ClusterVersion::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_clusterVersionHasBeenSet)
   {
-      oStream << location << ".ClusterVersion=" << StringUtils::URLEncode(m_clusterVersion.c_str()) << "&";
+      oStream << location << ".ClusterVersion=" << StringUtils::URLEncoded(m_clusterVersion) << "&";
   }
   if(m_clusterParameterGroupFamilyHasBeenSet)
   {
-      oStream << location << ".ClusterParameterGroupFamily=" << StringUtils::URLEncode(m_clusterParameterGroupFamily.c_str()) << "&";
+      oStream << location << ".ClusterParameterGroupFamily=" << StringUtils::URLEncoded(m_clusterParameterGroupFamily) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 }
 
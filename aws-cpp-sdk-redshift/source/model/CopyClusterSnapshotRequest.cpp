@@ -15,6 +15,7 @@
 #include <aws/redshift/model/CopyClusterSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ CopyClusterSnapshotRequest::CopyClusterSnapshotRequest() :
 
 Aws::String CopyClusterSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CopyClusterSnapshot&";
   if(m_sourceSnapshotIdentifierHasBeenSet)
   {
-    ss << "SourceSnapshotIdentifier=" << StringUtils::URLEncode(m_sourceSnapshotIdentifier.c_str()) << "&";
+    ss << "SourceSnapshotIdentifier=" << StringUtils::URLEncoded(m_sourceSnapshotIdentifier) << "&";
   }
 
   if(m_sourceSnapshotClusterIdentifierHasBeenSet)
   {
-    ss << "SourceSnapshotClusterIdentifier=" << StringUtils::URLEncode(m_sourceSnapshotClusterIdentifier.c_str()) << "&";
+    ss << "SourceSnapshotClusterIdentifier=" << StringUtils::URLEncoded(m_sourceSnapshotClusterIdentifier) << "&";
   }
 
   if(m_targetSnapshotIdentifierHasBeenSet)
   {
-    ss << "TargetSnapshotIdentifier=" << StringUtils::URLEncode(m_targetSnapshotIdentifier.c_str()) << "&";
+    ss << "TargetSnapshotIdentifier=" << StringUtils::URLEncoded(m_targetSnapshotIdentifier) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
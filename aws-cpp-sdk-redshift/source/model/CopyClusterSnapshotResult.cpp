@@ -40,7 +40,7 @@ CopyClusterSnapshotResult& CopyClusterSnapshotResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CopyClusterSnapshotResult")
+  if (rootNode.GetNameView() != "CopyClusterSnapshotResult")
   {
     resultNode = rootNode.FirstChild("CopyClusterSnapshotResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/CreateClusterParameterGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -29,21 +30,21 @@ CreateClusterParameterGroupRequest::CreateClusterParameterGroupRequest() :
 
 Aws::String CreateClusterParameterGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateClusterParameterGroup&";
   if(m_parameterGroupNameHasBeenSet)
   {
-    ss << "ParameterGroupName=" << StringUtils::URLEncode(m_parameterGroupName.c_str()) << "&";
+    ss << "ParameterGroupName=" << StringUtils::URLEncoded(m_parameterGroupName) << "&";
   }
 
   if(m_parameterGroupFamilyHasBeenSet)
   {
-    ss << "ParameterGroupFamily=" << StringUtils::URLEncode(m_parameterGroupFamily.c_str()) << "&";
+    ss << "ParameterGroupFamily=" << StringUtils::URLEncoded(m_parameterGroupFamily) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -57,6 +58,6 @@ Aws::String CreateClusterParameterGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
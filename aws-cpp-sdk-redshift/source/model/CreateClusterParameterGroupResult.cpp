@@ -40,7 +40,7 @@ CreateClusterParameterGroupResult& CreateClusterParameterGroupResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateClusterParameterGroupResult")
+  if (rootNode.GetNameView() != "CreateClusterParameterGroupResult")
   {
     resultNode = rootNode.FirstChild("CreateClusterParameterGroupResult");
   }
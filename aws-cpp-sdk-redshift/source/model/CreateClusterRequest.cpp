@@ -15,6 +15,7 @@
 #include <aws/redshift/model/CreateClusterRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -57,36 +58,36 @@ CreateClusterRequest::CreateClusterRequest() :
 
 Aws::String CreateClusterRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateCluster&";
   if(m_dBNameHasBeenSet)
   {
-    ss << "DBName=" << StringUtils::URLEncode(m_dBName.c_str()) << "&";
+    ss << "DBName=" << StringUtils::URLEncoded(m_dBName) << "&";
   }
 
   if(m_clusterIdentifierHasBeenSet)
   {
-    ss << "ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+    ss << "ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
 
   if(m_clusterTypeHasBeenSet)
   {
-    ss << "ClusterType=" << StringUtils::URLEncode(m_clusterType.c_str()) << "&";
+    ss << "ClusterType=" << StringUtils::URLEncoded(m_clusterType) << "&";
   }
 
   if(m_nodeTypeHasBeenSet)
   {
-    ss << "NodeType=" << StringUtils::URLEncode(m_nodeType.c_str()) << "&";
+    ss << "NodeType=" << StringUtils::URLEncoded(m_nodeType) << "&";
   }
 
   if(m_masterUsernameHasBeenSet)
   {
-    ss << "MasterUsername=" << StringUtils::URLEncode(m_masterUsername.c_str()) << "&";
+    ss << "MasterUsername=" << StringUtils::URLEncoded(m_masterUsername) << "&";
   }
 
   if(m_masterUserPasswordHasBeenSet)
   {
-    ss << "MasterUserPassword=" << StringUtils::URLEncode(m_masterUserPassword.c_str()) << "&";
+    ss << "MasterUserPassword=" << StringUtils::URLEncoded(m_masterUserPassword) << "&";
   }
 
   if(m_clusterSecurityGroupsHasBeenSet)
@@ -95,7 +96,7 @@ Aws::String CreateClusterRequest::SerializePayload() const
     for(auto& item : m_clusterSecurityGroups)
     {
       ss << "ClusterSecurityGroups.member." << clusterSecurityGroupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       clusterSecurityGroupsCount++;
     }
   }
@@ -106,29 +107,29 @@ Aws::String CreateClusterRequest::SerializePayload() const
     for(auto& item : m_vpcSecurityGroupIds)
     {
       ss << "VpcSecurityGroupIds.member." << vpcSecurityGroupIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       vpcSecurityGroupIdsCount++;
     }
   }
 
   if(m_clusterSubnetGroupNameHasBeenSet)
   {
-    ss << "ClusterSubnetGroupName=" << StringUtils::URLEncode(m_clusterSubnetGroupName.c_str()) << "&";
+    ss << "ClusterSubnetGroupName=" << StringUtils::URLEncoded(m_clusterSubnetGroupName) << "&";
   }
 
   if(m_availabilityZoneHasBeenSet)
   {
-    ss << "AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+    ss << "AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
 
   if(m_clusterParameterGroupNameHasBeenSet)
   {
-    ss << "ClusterParameterGroupName=" << StringUtils::URLEncode(m_clusterParameterGroupName.c_str()) << "&";
+    ss << "ClusterParameterGroupName=" << StringUtils::URLEncoded(m_clusterParameterGroupName) << "&";
   }
 
   if(m_automatedSnapshotRetentionPeriodHasBeenSet)
@@ -143,7 +144,7 @@ Aws::String CreateClusterRequest::SerializePayload() const
 
   if(m_clusterVersionHasBeenSet)
   {
-    ss << "ClusterVersion=" << StringUtils::URLEncode(m_clusterVersion.c_str()) << "&";
+    ss << "ClusterVersion=" << StringUtils::URLEncoded(m_clusterVersion) << "&";
   }
 
   if(m_allowVersionUpgradeHasBeenSet)
@@ -168,17 +169,17 @@ Aws::String CreateClusterRequest::SerializePayload() const
 
   if(m_hsmClientCertificateIdentifierHasBeenSet)
   {
-    ss << "HsmClientCertificateIdentifier=" << StringUtils::URLEncode(m_hsmClientCertificateIdentifier.c_str()) << "&";
+    ss << "HsmClientCertificateIdentifier=" << StringUtils::URLEncoded(m_hsmClientCertificateIdentifier) << "&";
   }
 
   if(m_hsmConfigurationIdentifierHasBeenSet)
   {
-    ss << "HsmConfigurationIdentifier=" << StringUtils::URLEncode(m_hsmConfigurationIdentifier.c_str()) << "&";
+    ss << "HsmConfigurationIdentifier=" << StringUtils::URLEncoded(m_hsmConfigurationIdentifier) << "&";
   }
 
   if(m_elasticIpHasBeenSet)
   {
-    ss << "ElasticIp=" << StringUtils::URLEncode(m_elasticIp.c_str()) << "&";
+    ss << "ElasticIp=" << StringUtils::URLEncoded(m_elasticIp) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -193,12 +194,12 @@ Aws::String CreateClusterRequest::SerializePayload() const
 
   if(m_kmsKeyIdHasBeenSet)
   {
-    ss << "KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+    ss << "KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
 
   if(m_additionalInfoHasBeenSet)
   {
-    ss << "AdditionalInfo=" << StringUtils::URLEncode(m_additionalInfo.c_str()) << "&";
+    ss << "AdditionalInfo=" << StringUtils::URLEncoded(m_additionalInfo) << "&";
   }
 
   if(m_iamRolesHasBeenSet)
@@ -207,12 +208,12 @@ Aws::String CreateClusterRequest::SerializePayload() const
     for(auto& item : m_iamRoles)
     {
       ss << "IamRoles.member." << iamRolesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       iamRolesCount++;
     }
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateClusterResult& CreateClusterResult::operator =(const AmazonWebServiceResul
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateClusterResult")
+  if (rootNode.GetNameView() != "CreateClusterResult")
   {
     resultNode = rootNode.FirstChild("CreateClusterResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/CreateClusterSecurityGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ CreateClusterSecurityGroupRequest::CreateClusterSecurityGroupRequest() :
 
 Aws::String CreateClusterSecurityGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateClusterSecurityGroup&";
   if(m_clusterSecurityGroupNameHasBeenSet)
   {
-    ss << "ClusterSecurityGroupName=" << StringUtils::URLEncode(m_clusterSecurityGroupName.c_str()) << "&";
+    ss << "ClusterSecurityGroupName=" << StringUtils::URLEncoded(m_clusterSecurityGroupName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -51,6 +52,6 @@ Aws::String CreateClusterSecurityGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
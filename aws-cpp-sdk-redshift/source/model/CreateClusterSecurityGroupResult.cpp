@@ -40,7 +40,7 @@ CreateClusterSecurityGroupResult& CreateClusterSecurityGroupResult::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateClusterSecurityGroupResult")
+  if (rootNode.GetNameView() != "CreateClusterSecurityGroupResult")
   {
     resultNode = rootNode.FirstChild("CreateClusterSecurityGroupResult");
   }
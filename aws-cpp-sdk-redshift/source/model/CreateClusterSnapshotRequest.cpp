@@ -15,6 +15,7 @@
 #include <aws/redshift/model/CreateClusterSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ CreateClusterSnapshotRequest::CreateClusterSnapshotRequest() :
 
 Aws::String CreateClusterSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateClusterSnapshot&";
   if(m_snapshotIdentifierHasBeenSet)
   {
-    ss << "SnapshotIdentifier=" << StringUtils::URLEncode(m_snapshotIdentifier.c_str()) << "&";
+    ss << "SnapshotIdentifier=" << StringUtils::URLEncoded(m_snapshotIdentifier) << "&";
   }
 
   if(m_clusterIdentifierHasBeenSet)
   {
-    ss << "ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+    ss << "ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -51,6 +52,6 @@ Aws::String CreateClusterSnapshotRequest::SerializePayload() const
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
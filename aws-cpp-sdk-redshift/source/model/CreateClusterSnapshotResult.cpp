@@ -40,7 +40,7 @@ CreateClusterSnapshotResult& CreateClusterSnapshotResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateClusterSnapshotResult")
+  if (rootNode.GetNameView() != "CreateClusterSnapshotResult")
   {
     resultNode = rootNode.FirstChild("CreateClusterSnapshotResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/CreateClusterSubnetGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ CreateClusterSubnetGroupRequest::CreateClusterSubnetGroupRequest() :
 
 Aws::String CreateClusterSubnetGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateClusterSubnetGroup&";
   if(m_clusterSubnetGroupNameHasBeenSet)
   {
-    ss << "ClusterSubnetGroupName=" << StringUtils::URLEncode(m_clusterSubnetGroupName.c_str()) << "&";
+    ss << "ClusterSubnetGroupName=" << StringUtils::URLEncoded(m_clusterSubnetGroupName) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_subnetIdsHasBeenSet)
@@ -47,7 +48,7 @@ Aws::String CreateClusterSubnetGroupRequest::SerializePayload() const
     for(auto& item : m_subnetIds)
     {
       ss << "SubnetIds.member." << subnetIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       subnetIdsCount++;
     }
   }
@@ -63,6 +64,6 @@ Aws::String CreateClusterSubnetGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
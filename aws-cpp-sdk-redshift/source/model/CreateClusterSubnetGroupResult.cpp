@@ -40,7 +40,7 @@ CreateClusterSubnetGroupResult& CreateClusterSubnetGroupResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateClusterSubnetGroupResult")
+  if (rootNode.GetNameView() != "CreateClusterSubnetGroupResult")
   {
     resultNode = rootNode.FirstChild("CreateClusterSubnetGroupResult");
   }
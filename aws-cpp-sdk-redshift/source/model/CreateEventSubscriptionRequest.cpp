@@ -15,6 +15,7 @@
 #include <aws/redshift/model/CreateEventSubscriptionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -34,21 +35,21 @@ CreateEventSubscriptionRequest::CreateEventSubscriptionRequest() :
 
 Aws::String CreateEventSubscriptionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateEventSubscription&";
   if(m_subscriptionNameHasBeenSet)
   {
-    ss << "SubscriptionName=" << StringUtils::URLEncode(m_subscriptionName.c_str()) << "&";
+    ss << "SubscriptionName=" << StringUtils::URLEncoded(m_subscriptionName) << "&";
   }
 
   if(m_snsTopicArnHasBeenSet)
   {
-    ss << "SnsTopicArn=" << StringUtils::URLEncode(m_snsTopicArn.c_str()) << "&";
+    ss << "SnsTopicArn=" << StringUtils::URLEncoded(m_snsTopicArn) << "&";
   }
 
   if(m_sourceTypeHasBeenSet)
   {
-    ss << "SourceType=" << StringUtils::URLEncode(m_sourceType.c_str()) << "&";
+    ss << "SourceType=" << StringUtils::URLEncoded(m_sourceType) << "&";
   }
 
   if(m_sourceIdsHasBeenSet)
@@ -57,7 +58,7 @@ Aws::String CreateEventSubscriptionRequest::SerializePayload() const
     for(auto& item : m_sourceIds)
     {
       ss << "SourceIds.member." << sourceIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       sourceIdsCount++;
     }
   }
@@ -68,14 +69,14 @@ Aws::String CreateEventSubscriptionRequest::SerializePayload() const
     for(auto& item : m_eventCategories)
     {
       ss << "EventCategories.member." << eventCategoriesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       eventCategoriesCount++;
     }
   }
 
   if(m_severityHasBeenSet)
   {
-    ss << "Severity=" << StringUtils::URLEncode(m_severity.c_str()) << "&";
+    ss << "Severity=" << StringUtils::URLEncoded(m_severity) << "&";
   }
 
   if(m_enabledHasBeenSet)
@@ -94,6 +95,6 @@ Aws::String CreateEventSubscriptionRequest::SerializePayload() const
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
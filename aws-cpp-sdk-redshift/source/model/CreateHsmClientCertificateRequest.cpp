@@ -15,6 +15,7 @@
 #include <aws/redshift/model/CreateHsmClientCertificateRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ CreateHsmClientCertificateRequest::CreateHsmClientCertificateRequest() :
 
 Aws::String CreateHsmClientCertificateRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateHsmClientCertificate&";
   if(m_hsmClientCertificateIdentifierHasBeenSet)
   {
-    ss << "HsmClientCertificateIdentifier=" << StringUtils::URLEncode(m_hsmClientCertificateIdentifier.c_str()) << "&";
+    ss << "HsmClientCertificateIdentifier=" << StringUtils::URLEncoded(m_hsmClientCertificateIdentifier) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -45,6 +46,6 @@ Aws::String CreateHsmClientCertificateRequest::SerializePayload() const
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateHsmClientCertificateResult& CreateHsmClientCertificateResult::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateHsmClientCertificateResult")
+  if (rootNode.GetNameView() != "CreateHsmClientCertificateResult")
   {
     resultNode = rootNode.FirstChild("CreateHsmClientCertificateResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/CreateHsmConfigurationRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -32,36 +33,36 @@ CreateHsmConfigurationRequest::CreateHsmConfigurationRequest() :
 
 Aws::String CreateHsmConfigurationRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateHsmConfiguration&";
   if(m_hsmConfigurationIdentifierHasBeenSet)
   {
-    ss << "HsmConfigurationIdentifier=" << StringUtils::URLEncode(m_hsmConfigurationIdentifier.c_str()) << "&";
+    ss << "HsmConfigurationIdentifier=" << StringUtils::URLEncoded(m_hsmConfigurationIdentifier) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-    ss << "Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+    ss << "Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_hsmIpAddressHasBeenSet)
   {
-    ss << "HsmIpAddress=" << StringUtils::URLEncode(m_hsmIpAddress.c_str()) << "&";
+    ss << "HsmIpAddress=" << StringUtils::URLEncoded(m_hsmIpAddress) << "&";
   }
 
   if(m_hsmPartitionNameHasBeenSet)
   {
-    ss << "HsmPartitionName=" << StringUtils::URLEncode(m_hsmPartitionName.c_str()) << "&";
+    ss << "HsmPartitionName=" << StringUtils::URLEncoded(m_hsmPartitionName) << "&";
   }
 
   if(m_hsmPartitionPasswordHasBeenSet)
   {
-    ss << "HsmPartitionPassword=" << StringUtils::URLEncode(m_hsmPartitionPassword.c_str()) << "&";
+    ss << "HsmPartitionPassword=" << StringUtils::URLEncoded(m_hsmPartitionPassword) << "&";
   }
 
   if(m_hsmServerPublicCertificateHasBeenSet)
   {
-    ss << "HsmServerPublicCertificate=" << StringUtils::URLEncode(m_hsmServerPublicCertificate.c_str()) << "&";
+    ss << "HsmServerPublicCertificate=" << StringUtils::URLEncoded(m_hsmServerPublicCertificate) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -75,6 +76,6 @@ Aws::String CreateHsmConfigurationRequest::SerializePayload() const
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateHsmConfigurationResult& CreateHsmConfigurationResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateHsmConfigurationResult")
+  if (rootNode.GetNameView() != "CreateHsmConfigurationResult")
   {
     resultNode = rootNode.FirstChild("CreateHsmConfigurationResult");
   }
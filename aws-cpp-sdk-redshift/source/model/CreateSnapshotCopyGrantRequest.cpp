@@ -15,6 +15,7 @@
 #include <aws/redshift/model/CreateSnapshotCopyGrantRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ CreateSnapshotCopyGrantRequest::CreateSnapshotCopyGrantRequest() :
 
 Aws::String CreateSnapshotCopyGrantRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateSnapshotCopyGrant&";
   if(m_snapshotCopyGrantNameHasBeenSet)
   {
-    ss << "SnapshotCopyGrantName=" << StringUtils::URLEncode(m_snapshotCopyGrantName.c_str()) << "&";
+    ss << "SnapshotCopyGrantName=" << StringUtils::URLEncoded(m_snapshotCopyGrantName) << "&";
   }
 
   if(m_kmsKeyIdHasBeenSet)
   {
-    ss << "KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+    ss << "KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -51,6 +52,6 @@ Aws::String CreateSnapshotCopyGrantRequest::SerializePayload() const
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
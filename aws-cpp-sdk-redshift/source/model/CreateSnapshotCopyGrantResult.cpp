@@ -40,7 +40,7 @@ CreateSnapshotCopyGrantResult& CreateSnapshotCopyGrantResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateSnapshotCopyGrantResult")
+  if (rootNode.GetNameView() != "CreateSnapshotCopyGrantResult")
   {
     resultNode = rootNode.FirstChild("CreateSnapshotCopyGrantResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DeleteClusterParameterGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteClusterParameterGroupRequest::DeleteClusterParameterGroupRequest() :
 
 Aws::String DeleteClusterParameterGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteClusterParameterGroup&";
   if(m_parameterGroupNameHasBeenSet)
   {
-    ss << "ParameterGroupName=" << StringUtils::URLEncode(m_parameterGroupName.c_str()) << "&";
+    ss << "ParameterGroupName=" << StringUtils::URLEncoded(m_parameterGroupName) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DeleteClusterRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -29,11 +30,11 @@ DeleteClusterRequest::DeleteClusterRequest() :
 
 Aws::String DeleteClusterRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteCluster&";
   if(m_clusterIdentifierHasBeenSet)
   {
-    ss << "ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+    ss << "ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
 
   if(m_skipFinalClusterSnapshotHasBeenSet)
@@ -43,10 +44,10 @@ Aws::String DeleteClusterRequest::SerializePayload() const
 
   if(m_finalClusterSnapshotIdentifierHasBeenSet)
   {
-    ss << "FinalClusterSnapshotIdentifier=" << StringUtils::URLEncode(m_finalClusterSnapshotIdentifier.c_str()) << "&";
+    ss << "FinalClusterSnapshotIdentifier=" << StringUtils::URLEncoded(m_finalClusterSnapshotIdentifier) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
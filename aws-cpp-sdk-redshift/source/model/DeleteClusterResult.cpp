@@ -40,7 +40,7 @@ DeleteClusterResult& DeleteClusterResult::operator =(const AmazonWebServiceResul
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteClusterResult")
+  if (rootNode.GetNameView() != "DeleteClusterResult")
   {
     resultNode = rootNode.FirstChild("DeleteClusterResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DeleteClusterSecurityGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteClusterSecurityGroupRequest::DeleteClusterSecurityGroupRequest() :
 
 Aws::String DeleteClusterSecurityGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteClusterSecurityGroup&";
   if(m_clusterSecurityGroupNameHasBeenSet)
   {
-    ss << "ClusterSecurityGroupName=" << StringUtils::URLEncode(m_clusterSecurityGroupName.c_str()) << "&";
+    ss << "ClusterSecurityGroupName=" << StringUtils::URLEncoded(m_clusterSecurityGroupName) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DeleteClusterSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ DeleteClusterSnapshotRequest::DeleteClusterSnapshotRequest() :
 
 Aws::String DeleteClusterSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteClusterSnapshot&";
   if(m_snapshotIdentifierHasBeenSet)
   {
-    ss << "SnapshotIdentifier=" << StringUtils::URLEncode(m_snapshotIdentifier.c_str()) << "&";
+    ss << "SnapshotIdentifier=" << StringUtils::URLEncoded(m_snapshotIdentifier) << "&";
   }
 
   if(m_snapshotClusterIdentifierHasBeenSet)
   {
-    ss << "SnapshotClusterIdentifier=" << StringUtils::URLEncode(m_snapshotClusterIdentifier.c_str()) << "&";
+    ss << "SnapshotClusterIdentifier=" << StringUtils::URLEncoded(m_snapshotClusterIdentifier) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
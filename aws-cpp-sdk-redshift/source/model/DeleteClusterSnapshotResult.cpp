@@ -40,7 +40,7 @@ DeleteClusterSnapshotResult& DeleteClusterSnapshotResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteClusterSnapshotResult")
+  if (rootNode.GetNameView() != "DeleteClusterSnapshotResult")
   {
     resultNode = rootNode.FirstChild("DeleteClusterSnapshotResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DeleteClusterSubnetGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteClusterSubnetGroupRequest::DeleteClusterSubnetGroupRequest() :
 
 Aws::String DeleteClusterSubnetGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteClusterSubnetGroup&";
   if(m_clusterSubnetGroupNameHasBeenSet)
   {
-    ss << "ClusterSubnetGroupName=" << StringUtils::URLEncode(m_clusterSubnetGroupName.c_str()) << "&";
+    ss << "ClusterSubnetGroupName=" << StringUtils::URLEncoded(m_clusterSubnetGroupName) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
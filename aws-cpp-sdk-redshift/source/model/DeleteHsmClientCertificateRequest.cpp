@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DeleteHsmClientCertificateRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteHsmClientCertificateRequest::DeleteHsmClientCertificateRequest() :
 
 Aws::String DeleteHsmClientCertificateRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteHsmClientCertificate&";
   if(m_hsmClientCertificateIdentifierHasBeenSet)
   {
-    ss << "HsmClientCertificateIdentifier=" << StringUtils::URLEncode(m_hsmClientCertificateIdentifier.c_str()) << "&";
+    ss << "HsmClientCertificateIdentifier=" << StringUtils::URLEncoded(m_hsmClientCertificateIdentifier) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
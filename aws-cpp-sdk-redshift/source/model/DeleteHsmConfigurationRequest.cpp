@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DeleteHsmConfigurationRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteHsmConfigurationRequest::DeleteHsmConfigurationRequest() :
 
 Aws::String DeleteHsmConfigurationRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteHsmConfiguration&";
   if(m_hsmConfigurationIdentifierHasBeenSet)
   {
-    ss << "HsmConfigurationIdentifier=" << StringUtils::URLEncode(m_hsmConfigurationIdentifier.c_str()) << "&";
+    ss << "HsmConfigurationIdentifier=" << StringUtils::URLEncoded(m_hsmConfigurationIdentifier) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
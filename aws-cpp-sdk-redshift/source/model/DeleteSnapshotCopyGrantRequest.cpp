@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DeleteSnapshotCopyGrantRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteSnapshotCopyGrantRequest::DeleteSnapshotCopyGrantRequest() :
 
 Aws::String DeleteSnapshotCopyGrantRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteSnapshotCopyGrant&";
   if(m_snapshotCopyGrantNameHasBeenSet)
   {
-    ss << "SnapshotCopyGrantName=" << StringUtils::URLEncode(m_snapshotCopyGrantName.c_str()) << "&";
+    ss << "SnapshotCopyGrantName=" << StringUtils::URLEncoded(m_snapshotCopyGrantName) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
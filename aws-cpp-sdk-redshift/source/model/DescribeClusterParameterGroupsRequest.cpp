@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DescribeClusterParameterGroupsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -31,11 +32,11 @@ DescribeClusterParameterGroupsRequest::DescribeClusterParameterGroupsRequest() :
 
 Aws::String DescribeClusterParameterGroupsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeClusterParameterGroups&";
   if(m_parameterGroupNameHasBeenSet)
   {
-    ss << "ParameterGroupName=" << StringUtils::URLEncode(m_parameterGroupName.c_str()) << "&";
+    ss << "ParameterGroupName=" << StringUtils::URLEncoded(m_parameterGroupName) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -45,7 +46,7 @@ Aws::String DescribeClusterParameterGroupsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_tagKeysHasBeenSet)
@@ -54,7 +55,7 @@ Aws::String DescribeClusterParameterGroupsRequest::SerializePayload() const
     for(auto& item : m_tagKeys)
     {
       ss << "TagKeys.member." << tagKeysCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       tagKeysCount++;
     }
   }
@@ -65,12 +66,12 @@ Aws::String DescribeClusterParameterGroupsRequest::SerializePayload() const
     for(auto& item : m_tagValues)
     {
       ss << "TagValues.member." << tagValuesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       tagValuesCount++;
     }
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
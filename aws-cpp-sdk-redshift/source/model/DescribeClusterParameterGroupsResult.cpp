@@ -40,7 +40,7 @@ DescribeClusterParameterGroupsResult& DescribeClusterParameterGroupsResult::oper
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeClusterParameterGroupsResult")
+  if (rootNode.GetNameView() != "DescribeClusterParameterGroupsResult")
   {
     resultNode = rootNode.FirstChild("DescribeClusterParameterGroupsResult");
   }
@@ -50,7 +50,7 @@ DescribeClusterParameterGroupsResult& DescribeClusterParameterGroupsResult::oper
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode parameterGroupsNode = resultNode.FirstChild("ParameterGroups");
     if(!parameterGroupsNode.IsNull())
@@ -40,7 +40,7 @@ DescribeClusterParametersResult& DescribeClusterParametersResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeClusterParametersResult")
+  if (rootNode.GetNameView() != "DescribeClusterParametersResult")
   {
     resultNode = rootNode.FirstChild("DescribeClusterParametersResult");
   }
@@ -61,7 +61,7 @@ DescribeClusterParametersResult& DescribeClusterParametersResult::operator =(con
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DescribeClusterSecurityGroupsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -31,11 +32,11 @@ DescribeClusterSecurityGroupsRequest::DescribeClusterSecurityGroupsRequest() :
 
 Aws::String DescribeClusterSecurityGroupsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeClusterSecurityGroups&";
   if(m_clusterSecurityGroupNameHasBeenSet)
   {
-    ss << "ClusterSecurityGroupName=" << StringUtils::URLEncode(m_clusterSecurityGroupName.c_str()) << "&";
+    ss << "ClusterSecurityGroupName=" << StringUtils::URLEncoded(m_clusterSecurityGroupName) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -45,7 +46,7 @@ Aws::String DescribeClusterSecurityGroupsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_tagKeysHasBeenSet)
@@ -54,7 +55,7 @@ Aws::String DescribeClusterSecurityGroupsRequest::SerializePayload() const
     for(auto& item : m_tagKeys)
     {
       ss << "TagKeys.member." << tagKeysCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       tagKeysCount++;
     }
   }
@@ -65,12 +66,12 @@ Aws::String DescribeClusterSecurityGroupsRequest::SerializePayload() const
     for(auto& item : m_tagValues)
     {
       ss << "TagValues.member." << tagValuesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       tagValuesCount++;
     }
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeClusterSecurityGroupsResult& DescribeClusterSecurityGroupsResult::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeClusterSecurityGroupsResult")
+  if (rootNode.GetNameView() != "DescribeClusterSecurityGroupsResult")
   {
     resultNode = rootNode.FirstChild("DescribeClusterSecurityGroupsResult");
   }
@@ -50,7 +50,7 @@ DescribeClusterSecurityGroupsResult& DescribeClusterSecurityGroupsResult::operat
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode clusterSecurityGroupsNode = resultNode.FirstChild("ClusterSecurityGroups");
     if(!clusterSecurityGroupsNode.IsNull())
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DescribeClusterSnapshotsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -36,31 +37,31 @@ DescribeClusterSnapshotsRequest::DescribeClusterSnapshotsRequest() :
 
 Aws::String DescribeClusterSnapshotsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeClusterSnapshots&";
   if(m_clusterIdentifierHasBeenSet)
   {
-    ss << "ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+    ss << "ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
 
   if(m_snapshotIdentifierHasBeenSet)
   {
-    ss << "SnapshotIdentifier=" << StringUtils::URLEncode(m_snapshotIdentifier.c_str()) << "&";
+    ss << "SnapshotIdentifier=" << StringUtils::URLEncoded(m_snapshotIdentifier) << "&";
   }
 
   if(m_snapshotTypeHasBeenSet)
   {
-    ss << "SnapshotType=" << StringUtils::URLEncode(m_snapshotType.c_str()) << "&";
+    ss << "SnapshotType=" << StringUtils::URLEncoded(m_snapshotType) << "&";
   }
 
   if(m_startTimeHasBeenSet)
   {
-    ss << "StartTime=" << StringUtils::URLEncode(m_startTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "StartTime=" << StringUtils::URLEncoded(m_startTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_endTimeHasBeenSet)
   {
-    ss << "EndTime=" << StringUtils::URLEncode(m_endTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+    ss << "EndTime=" << StringUtils::URLEncoded(m_endTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -70,12 +71,12 @@ Aws::String DescribeClusterSnapshotsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_ownerAccountHasBeenSet)
   {
-    ss << "OwnerAccount=" << StringUtils::URLEncode(m_ownerAccount.c_str()) << "&";
+    ss << "OwnerAccount=" << StringUtils::URLEncoded(m_ownerAccount) << "&";
   }
 
   if(m_tagKeysHasBeenSet)
@@ -84,7 +85,7 @@ Aws::String DescribeClusterSnapshotsRequest::SerializePayload() const
     for(auto& item : m_tagKeys)
     {
       ss << "TagKeys.member." << tagKeysCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       tagKeysCount++;
     }
   }
@@ -95,12 +96,12 @@ Aws::String DescribeClusterSnapshotsRequest::SerializePayload() const
     for(auto& item : m_tagValues)
     {
       ss << "TagValues.member." << tagValuesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       tagValuesCount++;
     }
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
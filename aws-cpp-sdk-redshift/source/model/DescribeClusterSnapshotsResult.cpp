@@ -40,7 +40,7 @@ DescribeClusterSnapshotsResult& DescribeClusterSnapshotsResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeClusterSnapshotsResult")
+  if (rootNode.GetNameView() != "DescribeClusterSnapshotsResult")
   {
     resultNode = rootNode.FirstChild("DescribeClusterSnapshotsResult");
   }
@@ -50,7 +50,7 @@ DescribeClusterSnapshotsResult& DescribeClusterSnapshotsResult::operator =(const
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode snapshotsNode = resultNode.FirstChild("Snapshots");
     if(!snapshotsNode.IsNull())
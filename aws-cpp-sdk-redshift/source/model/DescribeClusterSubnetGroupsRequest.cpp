@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DescribeClusterSubnetGroupsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -31,11 +32,11 @@ DescribeClusterSubnetGroupsRequest::DescribeClusterSubnetGroupsRequest() :
 
 Aws::String DescribeClusterSubnetGroupsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeClusterSubnetGroups&";
   if(m_clusterSubnetGroupNameHasBeenSet)
   {
-    ss << "ClusterSubnetGroupName=" << StringUtils::URLEncode(m_clusterSubnetGroupName.c_str()) << "&";
+    ss << "ClusterSubnetGroupName=" << StringUtils::URLEncoded(m_clusterSubnetGroupName) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -45,7 +46,7 @@ Aws::String DescribeClusterSubnetGroupsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   if(m_tagKeysHasBeenSet)
@@ -54,7 +55,7 @@ Aws::String DescribeClusterSubnetGroupsRequest::SerializePayload() const
     for(auto& item : m_tagKeys)
     {
       ss << "TagKeys.member." << tagKeysCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       tagKeysCount++;
     }
   }
@@ -65,12 +66,12 @@ Aws::String DescribeClusterSubnetGroupsRequest::SerializePayload() const
     for(auto& item : m_tagValues)
     {
       ss << "TagValues.member." << tagValuesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       tagValuesCount++;
     }
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
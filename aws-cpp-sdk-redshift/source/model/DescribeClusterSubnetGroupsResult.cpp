@@ -40,7 +40,7 @@ DescribeClusterSubnetGroupsResult& DescribeClusterSubnetGroupsResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeClusterSubnetGroupsResult")
+  if (rootNode.GetNameView() != "DescribeClusterSubnetGroupsResult")
   {
     resultNode = rootNode.FirstChild("DescribeClusterSubnetGroupsResult");
   }
@@ -50,7 +50,7 @@ DescribeClusterSubnetGroupsResult& DescribeClusterSubnetGroupsResult::operator =
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode clusterSubnetGroupsNode = resultNode.FirstChild("ClusterSubnetGroups");
     if(!clusterSubnetGroupsNode.IsNull())
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DescribeClusterVersionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -30,16 +31,16 @@ DescribeClusterVersionsRequest::DescribeClusterVersionsRequest() :
 
 Aws::String DescribeClusterVersionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeClusterVersions&";
   if(m_clusterVersionHasBeenSet)
   {
-    ss << "ClusterVersion=" << StringUtils::URLEncode(m_clusterVersion.c_str()) << "&";
+    ss << "ClusterVersion=" << StringUtils::URLEncoded(m_clusterVersion) << "&";
   }
 
   if(m_clusterParameterGroupFamilyHasBeenSet)
   {
-    ss << "ClusterParameterGroupFamily=" << StringUtils::URLEncode(m_clusterParameterGroupFamily.c_str()) << "&";
+    ss << "ClusterParameterGroupFamily=" << StringUtils::URLEncoded(m_clusterParameterGroupFamily) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -49,10 +50,10 @@ Aws::String DescribeClusterVersionsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeClusterVersionsResult& DescribeClusterVersionsResult::operator =(const A
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeClusterVersionsResult")
+  if (rootNode.GetNameView() != "DescribeClusterVersionsResult")
   {
     resultNode = rootNode.FirstChild("DescribeClusterVersionsResult");
   }
@@ -50,7 +50,7 @@ DescribeClusterVersionsResult& DescribeClusterVersionsResult::operator =(const A
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode clusterVersionsNode = resultNode.FirstChild("ClusterVersions");
     if(!clusterVersionsNode.IsNull())
@@ -40,7 +40,7 @@ DescribeClustersResult& DescribeClustersResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeClustersResult")
+  if (rootNode.GetNameView() != "DescribeClustersResult")
   {
     resultNode = rootNode.FirstChild("DescribeClustersResult");
   }
@@ -50,7 +50,7 @@ DescribeClustersResult& DescribeClustersResult::operator =(const AmazonWebServic
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode clustersNode = resultNode.FirstChild("Clusters");
     if(!clustersNode.IsNull())
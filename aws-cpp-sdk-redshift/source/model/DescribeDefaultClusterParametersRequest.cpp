@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DescribeDefaultClusterParametersRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -29,11 +30,11 @@ DescribeDefaultClusterParametersRequest::DescribeDefaultClusterParametersRequest
 
 Aws::String DescribeDefaultClusterParametersRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeDefaultClusterParameters&";
   if(m_parameterGroupFamilyHasBeenSet)
   {
-    ss << "ParameterGroupFamily=" << StringUtils::URLEncode(m_parameterGroupFamily.c_str()) << "&";
+    ss << "ParameterGroupFamily=" << StringUtils::URLEncoded(m_parameterGroupFamily) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -43,10 +44,10 @@ Aws::String DescribeDefaultClusterParametersRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
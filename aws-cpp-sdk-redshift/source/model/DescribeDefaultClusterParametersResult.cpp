@@ -40,7 +40,7 @@ DescribeDefaultClusterParametersResult& DescribeDefaultClusterParametersResult::
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeDefaultClusterParametersResult")
+  if (rootNode.GetNameView() != "DescribeDefaultClusterParametersResult")
   {
     resultNode = rootNode.FirstChild("DescribeDefaultClusterParametersResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DescribeEventCategoriesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DescribeEventCategoriesRequest::DescribeEventCategoriesRequest() :
 
 Aws::String DescribeEventCategoriesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeEventCategories&";
   if(m_sourceTypeHasBeenSet)
   {
-    ss << "SourceType=" << StringUtils::URLEncode(m_sourceType.c_str()) << "&";
+    ss << "SourceType=" << StringUtils::URLEncoded(m_sourceType) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
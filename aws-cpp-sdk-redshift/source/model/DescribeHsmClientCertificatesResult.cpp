@@ -40,7 +40,7 @@ DescribeHsmClientCertificatesResult& DescribeHsmClientCertificatesResult::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeHsmClientCertificatesResult")
+  if (rootNode.GetNameView() != "DescribeHsmClientCertificatesResult")
   {
     resultNode = rootNode.FirstChild("DescribeHsmClientCertificatesResult");
   }
@@ -50,7 +50,7 @@ DescribeHsmClientCertificatesResult& DescribeHsmClientCertificatesResult::operat
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode hsmClientCertificatesNode = resultNode.FirstChild("HsmClientCertificates");
     if(!hsmClientCertificatesNode.IsNull())
@@ -40,7 +40,7 @@ DescribeHsmConfigurationsResult& DescribeHsmConfigurationsResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeHsmConfigurationsResult")
+  if (rootNode.GetNameView() != "DescribeHsmConfigurationsResult")
   {
     resultNode = rootNode.FirstChild("DescribeHsmConfigurationsResult");
   }
@@ -50,7 +50,7 @@ DescribeHsmConfigurationsResult& DescribeHsmConfigurationsResult::operator =(con
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode hsmConfigurationsNode = resultNode.FirstChild("HsmConfigurations");
     if(!hsmConfigurationsNode.IsNull())
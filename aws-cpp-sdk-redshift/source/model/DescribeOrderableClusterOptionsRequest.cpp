@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DescribeOrderableClusterOptionsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -30,16 +31,16 @@ DescribeOrderableClusterOptionsRequest::DescribeOrderableClusterOptionsRequest()
 
 Aws::String DescribeOrderableClusterOptionsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeOrderableClusterOptions&";
   if(m_clusterVersionHasBeenSet)
   {
-    ss << "ClusterVersion=" << StringUtils::URLEncode(m_clusterVersion.c_str()) << "&";
+    ss << "ClusterVersion=" << StringUtils::URLEncoded(m_clusterVersion) << "&";
   }
 
   if(m_nodeTypeHasBeenSet)
   {
-    ss << "NodeType=" << StringUtils::URLEncode(m_nodeType.c_str()) << "&";
+    ss << "NodeType=" << StringUtils::URLEncoded(m_nodeType) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -49,10 +50,10 @@ Aws::String DescribeOrderableClusterOptionsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeOrderableClusterOptionsResult& DescribeOrderableClusterOptionsResult::op
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeOrderableClusterOptionsResult")
+  if (rootNode.GetNameView() != "DescribeOrderableClusterOptionsResult")
   {
     resultNode = rootNode.FirstChild("DescribeOrderableClusterOptionsResult");
   }
@@ -61,7 +61,7 @@ DescribeOrderableClusterOptionsResult& DescribeOrderableClusterOptionsResult::op
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
   }
 
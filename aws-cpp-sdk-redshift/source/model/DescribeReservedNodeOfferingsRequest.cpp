@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DescribeReservedNodeOfferingsRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -29,11 +30,11 @@ DescribeReservedNodeOfferingsRequest::DescribeReservedNodeOfferingsRequest() :
 
 Aws::String DescribeReservedNodeOfferingsRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeReservedNodeOfferings&";
   if(m_reservedNodeOfferingIdHasBeenSet)
   {
-    ss << "ReservedNodeOfferingId=" << StringUtils::URLEncode(m_reservedNodeOfferingId.c_str()) << "&";
+    ss << "ReservedNodeOfferingId=" << StringUtils::URLEncoded(m_reservedNodeOfferingId) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -43,10 +44,10 @@ Aws::String DescribeReservedNodeOfferingsRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DescribeReservedNodeOfferingsResult& DescribeReservedNodeOfferingsResult::operat
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeReservedNodeOfferingsResult")
+  if (rootNode.GetNameView() != "DescribeReservedNodeOfferingsResult")
   {
     resultNode = rootNode.FirstChild("DescribeReservedNodeOfferingsResult");
   }
@@ -50,7 +50,7 @@ DescribeReservedNodeOfferingsResult& DescribeReservedNodeOfferingsResult::operat
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode reservedNodeOfferingsNode = resultNode.FirstChild("ReservedNodeOfferings");
     if(!reservedNodeOfferingsNode.IsNull())
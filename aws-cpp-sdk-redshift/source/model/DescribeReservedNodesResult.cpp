@@ -40,7 +40,7 @@ DescribeReservedNodesResult& DescribeReservedNodesResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeReservedNodesResult")
+  if (rootNode.GetNameView() != "DescribeReservedNodesResult")
   {
     resultNode = rootNode.FirstChild("DescribeReservedNodesResult");
   }
@@ -50,7 +50,7 @@ DescribeReservedNodesResult& DescribeReservedNodesResult::operator =(const Amazo
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode reservedNodesNode = resultNode.FirstChild("ReservedNodes");
     if(!reservedNodesNode.IsNull())
@@ -52,7 +52,7 @@ DescribeResizeResult& DescribeResizeResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeResizeResult")
+  if (rootNode.GetNameView() != "DescribeResizeResult")
   {
     resultNode = rootNode.FirstChild("DescribeResizeResult");
   }
@@ -62,22 +62,22 @@ DescribeResizeResult& DescribeResizeResult::operator =(const AmazonWebServiceRes
     XmlNode targetNodeTypeNode = resultNode.FirstChild("TargetNodeType");
     if(!targetNodeTypeNode.IsNull())
     {
-      m_targetNodeType = StringUtils::Trim(targetNodeTypeNode.GetText().c_str());
+      m_targetNodeType = targetNodeTypeNode.GetTextView().Trim().ToString();
     }
     XmlNode targetNumberOfNodesNode = resultNode.FirstChild("TargetNumberOfNodes");
     if(!targetNumberOfNodesNode.IsNull())
     {
-      m_targetNumberOfNodes = StringUtils::ConvertToInt32(StringUtils::Trim(targetNumberOfNodesNode.GetText().c_str()).c_str());
+      m_targetNumberOfNodes = StringUtils::ConvertToInt32(targetNumberOfNodesNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode targetClusterTypeNode = resultNode.FirstChild("TargetClusterType");
     if(!targetClusterTypeNode.IsNull())
     {
-      m_targetClusterType = StringUtils::Trim(targetClusterTypeNode.GetText().c_str());
+      m_targetClusterType = targetClusterTypeNode.GetTextView().Trim().ToString();
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
     }
     XmlNode importTablesCompletedNode = resultNode.FirstChild("ImportTablesCompleted");
     if(!importTablesCompletedNode.IsNull())
@@ -85,7 +85,7 @@ DescribeResizeResult& DescribeResizeResult::operator =(const AmazonWebServiceRes
       XmlNode importTablesCompletedMember = importTablesCompletedNode.FirstChild("member");
       while(!importTablesCompletedMember.IsNull())
       {
-        m_importTablesCompleted.push_back(StringUtils::Trim(importTablesCompletedMember.GetText().c_str()));
+        m_importTablesCompleted.push_back(importTablesCompletedMember.GetTextView().Trim().ToString());
         importTablesCompletedMember = importTablesCompletedMember.NextNode("member");
       }
 
@@ -96,7 +96,7 @@ DescribeResizeResult& DescribeResizeResult::operator =(const AmazonWebServiceRes
       XmlNode importTablesInProgressMember = importTablesInProgressNode.FirstChild("member");
       while(!importTablesInProgressMember.IsNull())
       {
-        m_importTablesInProgress.push_back(StringUtils::Trim(importTablesInProgressMember.GetText().c_str()));
+        m_importTablesInProgress.push_back(importTablesInProgressMember.GetTextView().Trim().ToString());
         importTablesInProgressMember = importTablesInProgressMember.NextNode("member");
       }
 
@@ -107,7 +107,7 @@ DescribeResizeResult& DescribeResizeResult::operator =(const AmazonWebServiceRes
       XmlNode importTablesNotStartedMember = importTablesNotStartedNode.FirstChild("member");
       while(!importTablesNotStartedMember.IsNull())
       {
-        m_importTablesNotStarted.push_back(StringUtils::Trim(importTablesNotStartedMember.GetText().c_str()));
+        m_importTablesNotStarted.push_back(importTablesNotStartedMember.GetTextView().Trim().ToString());
         importTablesNotStartedMember = importTablesNotStartedMember.NextNode("member");
       }
 
@@ -115,27 +115,27 @@ DescribeResizeResult& DescribeResizeResult::operator =(const AmazonWebServiceRes
     XmlNode avgResizeRateInMegaBytesPerSecondNode = resultNode.FirstChild("AvgResizeRateInMegaBytesPerSecond");
     if(!avgResizeRateInMegaBytesPerSecondNode.IsNull())
     {
-      m_avgResizeRateInMegaBytesPerSecond = StringUtils::ConvertToDouble(StringUtils::Trim(avgResizeRateInMegaBytesPerSecondNode.GetText().c_str()).c_str());
+      m_avgResizeRateInMegaBytesPerSecond = StringUtils::ConvertToDouble(avgResizeRateInMegaBytesPerSecondNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode totalResizeDataInMegaBytesNode = resultNode.FirstChild("TotalResizeDataInMegaBytes");
     if(!totalResizeDataInMegaBytesNode.IsNull())
     {
-      m_totalResizeDataInMegaBytes = StringUtils::ConvertToInt64(StringUtils::Trim(totalResizeDataInMegaBytesNode.GetText().c_str()).c_str());
+      m_totalResizeDataInMegaBytes = StringUtils::ConvertToInt64(totalResizeDataInMegaBytesNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode progressInMegaBytesNode = resultNode.FirstChild("ProgressInMegaBytes");
     if(!progressInMegaBytesNode.IsNull())
     {
-      m_progressInMegaBytes = StringUtils::ConvertToInt64(StringUtils::Trim(progressInMegaBytesNode.GetText().c_str()).c_str());
+      m_progressInMegaBytes = StringUtils::ConvertToInt64(progressInMegaBytesNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode elapsedTimeInSecondsNode = resultNode.FirstChild("ElapsedTimeInSeconds");
     if(!elapsedTimeInSecondsNode.IsNull())
     {
-      m_elapsedTimeInSeconds = StringUtils::ConvertToInt64(StringUtils::Trim(elapsedTimeInSecondsNode.GetText().c_str()).c_str());
+      m_elapsedTimeInSeconds = StringUtils::ConvertToInt64(elapsedTimeInSecondsNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode estimatedTimeToCompletionInSecondsNode = resultNode.FirstChild("EstimatedTimeToCompletionInSeconds");
     if(!estimatedTimeToCompletionInSecondsNode.IsNull())
     {
-      m_estimatedTimeToCompletionInSeconds = StringUtils::ConvertToInt64(StringUtils::Trim(estimatedTimeToCompletionInSecondsNode.GetText().c_str()).c_str());
+      m_estimatedTimeToCompletionInSeconds = StringUtils::ConvertToInt64(estimatedTimeToCompletionInSecondsNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -40,7 +40,7 @@ DescribeSnapshotCopyGrantsResult& DescribeSnapshotCopyGrantsResult::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeSnapshotCopyGrantsResult")
+  if (rootNode.GetNameView() != "DescribeSnapshotCopyGrantsResult")
   {
     resultNode = rootNode.FirstChild("DescribeSnapshotCopyGrantsResult");
   }
@@ -50,7 +50,7 @@ DescribeSnapshotCopyGrantsResult& DescribeSnapshotCopyGrantsResult::operator =(c
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
     XmlNode snapshotCopyGrantsNode = resultNode.FirstChild("SnapshotCopyGrants");
     if(!snapshotCopyGrantsNode.IsNull())
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/DescribeTableRestoreStatusRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -30,16 +31,16 @@ DescribeTableRestoreStatusRequest::DescribeTableRestoreStatusRequest() :
 
 Aws::String DescribeTableRestoreStatusRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DescribeTableRestoreStatus&";
   if(m_clusterIdentifierHasBeenSet)
   {
-    ss << "ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+    ss << "ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
 
   if(m_tableRestoreRequestIdHasBeenSet)
   {
-    ss << "TableRestoreRequestId=" << StringUtils::URLEncode(m_tableRestoreRequestId.c_str()) << "&";
+    ss << "TableRestoreRequestId=" << StringUtils::URLEncoded(m_tableRestoreRequestId) << "&";
   }
 
   if(m_maxRecordsHasBeenSet)
@@ -49,10 +50,10 @@ Aws::String DescribeTableRestoreStatusRequest::SerializePayload() const
 
   if(m_markerHasBeenSet)
   {
-    ss << "Marker=" << StringUtils::URLEncode(m_marker.c_str()) << "&";
+    ss << "Marker=" << StringUtils::URLEncoded(m_marker) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
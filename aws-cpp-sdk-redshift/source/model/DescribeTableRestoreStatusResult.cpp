@@ -40,7 +40,7 @@ DescribeTableRestoreStatusResult& DescribeTableRestoreStatusResult::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DescribeTableRestoreStatusResult")
+  if (rootNode.GetNameView() != "DescribeTableRestoreStatusResult")
   {
     resultNode = rootNode.FirstChild("DescribeTableRestoreStatusResult");
   }
@@ -61,7 +61,7 @@ DescribeTableRestoreStatusResult& DescribeTableRestoreStatusResult::operator =(c
     XmlNode markerNode = resultNode.FirstChild("Marker");
     if(!markerNode.IsNull())
     {
-      m_marker = StringUtils::Trim(markerNode.GetText().c_str());
+      m_marker = markerNode.GetTextView().Trim().ToString();
     }
   }
 
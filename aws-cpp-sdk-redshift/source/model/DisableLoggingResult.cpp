@@ -42,7 +42,7 @@ DisableLoggingResult& DisableLoggingResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DisableLoggingResult")
+  if (rootNode.GetNameView() != "DisableLoggingResult")
   {
     resultNode = rootNode.FirstChild("DisableLoggingResult");
   }
@@ -52,32 +52,32 @@ DisableLoggingResult& DisableLoggingResult::operator =(const AmazonWebServiceRes
     XmlNode loggingEnabledNode = resultNode.FirstChild("LoggingEnabled");
     if(!loggingEnabledNode.IsNull())
     {
-      m_loggingEnabled = StringUtils::ConvertToBool(StringUtils::Trim(loggingEnabledNode.GetText().c_str()).c_str());
+      m_loggingEnabled = StringUtils::ConvertToBool(loggingEnabledNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode bucketNameNode = resultNode.FirstChild("BucketName");
     if(!bucketNameNode.IsNull())
     {
-      m_bucketName = StringUtils::Trim(bucketNameNode.GetText().c_str());
+      m_bucketName = bucketNameNode.GetTextView().Trim().ToString();
     }
     XmlNode s3KeyPrefixNode = resultNode.FirstChild("S3KeyPrefix");
     if(!s3KeyPrefixNode.IsNull())
     {
-      m_s3KeyPrefix = StringUtils::Trim(s3KeyPrefixNode.GetText().c_str());
+      m_s3KeyPrefix = s3KeyPrefixNode.GetTextView().Trim().ToString();
     }
     XmlNode lastSuccessfulDeliveryTimeNode = resultNode.FirstChild("LastSuccessfulDeliveryTime");
     if(!lastSuccessfulDeliveryTimeNode.IsNull())
     {
-      m_lastSuccessfulDeliveryTime = DateTime(StringUtils::Trim(lastSuccessfulDeliveryTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_lastSuccessfulDeliveryTime = DateTime(lastSuccessfulDeliveryTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
     XmlNode lastFailureTimeNode = resultNode.FirstChild("LastFailureTime");
     if(!lastFailureTimeNode.IsNull())
     {
-      m_lastFailureTime = DateTime(StringUtils::Trim(lastFailureTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_lastFailureTime = DateTime(lastFailureTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
     XmlNode lastFailureMessageNode = resultNode.FirstChild("LastFailureMessage");
     if(!lastFailureMessageNode.IsNull())
     {
-      m_lastFailureMessage = StringUtils::Trim(lastFailureMessageNode.GetText().c_str());
+      m_lastFailureMessage = lastFailureMessageNode.GetTextView().Trim().ToString();
     }
   }
 
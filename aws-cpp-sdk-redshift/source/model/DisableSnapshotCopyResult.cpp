@@ -40,7 +40,7 @@ DisableSnapshotCopyResult& DisableSnapshotCopyResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DisableSnapshotCopyResult")
+  if (rootNode.GetNameView() != "DisableSnapshotCopyResult")
   {
     resultNode = rootNode.FirstChild("DisableSnapshotCopyResult");
   }
@@ -51,13 +51,13 @@ ElasticIpStatus& ElasticIpStatus::operator =(const XmlNode& xmlNode)
     XmlNode elasticIpNode = resultNode.FirstChild("ElasticIp");
     if(!elasticIpNode.IsNull())
     {
-      m_elasticIp = StringUtils::Trim(elasticIpNode.GetText().c_str());
+      m_elasticIp = elasticIpNode.GetTextView().Trim().ToString();
       m_elasticIpHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void ElasticIpStatus::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_elasticIpHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ElasticIp=" << StringUtils::URLEncode(m_elasticIp.c_str()) << "&";
+      oStream << location << index << locationValue << ".ElasticIp=" << StringUtils::URLEncoded(m_elasticIp) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void ElasticIpStatus::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_elasticIpHasBeenSet)
   {
-      oStream << location << ".ElasticIp=" << StringUtils::URLEncode(m_elasticIp.c_str()) << "&";
+      oStream << location << ".ElasticIp=" << StringUtils::URLEncoded(m_elasticIp) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 }
 
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/EnableLoggingRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ EnableLoggingRequest::EnableLoggingRequest() :
 
 Aws::String EnableLoggingRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=EnableLogging&";
   if(m_clusterIdentifierHasBeenSet)
   {
-    ss << "ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+    ss << "ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
 
   if(m_bucketNameHasBeenSet)
   {
-    ss << "BucketName=" << StringUtils::URLEncode(m_bucketName.c_str()) << "&";
+    ss << "BucketName=" << StringUtils::URLEncoded(m_bucketName) << "&";
   }
 
   if(m_s3KeyPrefixHasBeenSet)
   {
-    ss << "S3KeyPrefix=" << StringUtils::URLEncode(m_s3KeyPrefix.c_str()) << "&";
+    ss << "S3KeyPrefix=" << StringUtils::URLEncoded(m_s3KeyPrefix) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
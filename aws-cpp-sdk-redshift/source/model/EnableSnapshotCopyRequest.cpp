@@ -15,6 +15,7 @@
 #include <aws/redshift/model/EnableSnapshotCopyRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -30,16 +31,16 @@ EnableSnapshotCopyRequest::EnableSnapshotCopyRequest() :
 
 Aws::String EnableSnapshotCopyRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=EnableSnapshotCopy&";
   if(m_clusterIdentifierHasBeenSet)
   {
-    ss << "ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+    ss << "ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
 
   if(m_destinationRegionHasBeenSet)
   {
-    ss << "DestinationRegion=" << StringUtils::URLEncode(m_destinationRegion.c_str()) << "&";
+    ss << "DestinationRegion=" << StringUtils::URLEncoded(m_destinationRegion) << "&";
   }
 
   if(m_retentionPeriodHasBeenSet)
@@ -49,10 +50,10 @@ Aws::String EnableSnapshotCopyRequest::SerializePayload() const
 
   if(m_snapshotCopyGrantNameHasBeenSet)
   {
-    ss << "SnapshotCopyGrantName=" << StringUtils::URLEncode(m_snapshotCopyGrantName.c_str()) << "&";
+    ss << "SnapshotCopyGrantName=" << StringUtils::URLEncoded(m_snapshotCopyGrantName) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
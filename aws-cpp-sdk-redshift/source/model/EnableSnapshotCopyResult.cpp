@@ -40,7 +40,7 @@ EnableSnapshotCopyResult& EnableSnapshotCopyResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "EnableSnapshotCopyResult")
+  if (rootNode.GetNameView() != "EnableSnapshotCopyResult")
   {
     resultNode = rootNode.FirstChild("EnableSnapshotCopyResult");
   }
@@ -61,19 +61,19 @@ Event& Event::operator =(const XmlNode& xmlNode)
     XmlNode sourceIdentifierNode = resultNode.FirstChild("SourceIdentifier");
     if(!sourceIdentifierNode.IsNull())
     {
-      m_sourceIdentifier = StringUtils::Trim(sourceIdentifierNode.GetText().c_str());
+      m_sourceIdentifier = sourceIdentifierNode.GetTextView().Trim().ToString();
       m_sourceIdentifierHasBeenSet = true;
     }
     XmlNode sourceTypeNode = resultNode.FirstChild("SourceType");
     if(!sourceTypeNode.IsNull())
     {
-      m_sourceType = SourceTypeMapper::GetSourceTypeForName(StringUtils::Trim(sourceTypeNode.GetText().c_str()).c_str());
+      m_sourceType = SourceTypeMapper::GetSourceTypeForName(sourceTypeNode.GetTextView().Trim().ToString().c_str());
       m_sourceTypeHasBeenSet = true;
     }
     XmlNode messageNode = resultNode.FirstChild("Message");
     if(!messageNode.IsNull())
     {
-      m_message = StringUtils::Trim(messageNode.GetText().c_str());
+      m_message = messageNode.GetTextView().Trim().ToString();
       m_messageHasBeenSet = true;
     }
     XmlNode eventCategoriesNode = resultNode.FirstChild("EventCategories");
@@ -82,7 +82,7 @@ Event& Event::operator =(const XmlNode& xmlNode)
       XmlNode eventCategoriesMember = eventCategoriesNode.FirstChild("EventCategory");
       while(!eventCategoriesMember.IsNull())
       {
-        m_eventCategories.push_back(StringUtils::Trim(eventCategoriesMember.GetText().c_str()));
+        m_eventCategories.push_back(eventCategoriesMember.GetTextView().Trim().ToString());
         eventCategoriesMember = eventCategoriesMember.NextNode("EventCategory");
       }
 
@@ -91,19 +91,19 @@ Event& Event::operator =(const XmlNode& xmlNode)
     XmlNode severityNode = resultNode.FirstChild("Severity");
     if(!severityNode.IsNull())
     {
-      m_severity = StringUtils::Trim(severityNode.GetText().c_str());
+      m_severity = severityNode.GetTextView().Trim().ToString();
       m_severityHasBeenSet = true;
     }
     XmlNode dateNode = resultNode.FirstChild("Date");
     if(!dateNode.IsNull())
     {
-      m_date = DateTime(StringUtils::Trim(dateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_date = DateTime(dateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_dateHasBeenSet = true;
     }
     XmlNode eventIdNode = resultNode.FirstChild("EventId");
     if(!eventIdNode.IsNull())
     {
-      m_eventId = StringUtils::Trim(eventIdNode.GetText().c_str());
+      m_eventId = eventIdNode.GetTextView().Trim().ToString();
       m_eventIdHasBeenSet = true;
     }
   }
@@ -115,7 +115,7 @@ void Event::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 {
   if(m_sourceIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceIdentifier=" << StringUtils::URLEncode(m_sourceIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceIdentifier=" << StringUtils::URLEncoded(m_sourceIdentifier) << "&";
   }
 
   if(m_sourceTypeHasBeenSet)
@@ -125,7 +125,7 @@ void Event::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 
   if(m_messageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 
   if(m_eventCategoriesHasBeenSet)
@@ -133,23 +133,23 @@ void Event::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
       unsigned eventCategoriesIdx = 1;
       for(auto& item : m_eventCategories)
       {
-        oStream << location << index << locationValue << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
   if(m_severityHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Severity=" << StringUtils::URLEncode(m_severity.c_str()) << "&";
+      oStream << location << index << locationValue << ".Severity=" << StringUtils::URLEncoded(m_severity) << "&";
   }
 
   if(m_dateHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Date=" << StringUtils::URLEncode(m_date.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".Date=" << StringUtils::URLEncoded(m_date.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_eventIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EventId=" << StringUtils::URLEncode(m_eventId.c_str()) << "&";
+      oStream << location << index << locationValue << ".EventId=" << StringUtils::URLEncoded(m_eventId) << "&";
   }
 
 }
@@ -158,7 +158,7 @@ void Event::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_sourceIdentifierHasBeenSet)
   {
-      oStream << location << ".SourceIdentifier=" << StringUtils::URLEncode(m_sourceIdentifier.c_str()) << "&";
+      oStream << location << ".SourceIdentifier=" << StringUtils::URLEncoded(m_sourceIdentifier) << "&";
   }
   if(m_sourceTypeHasBeenSet)
   {
@@ -166,27 +166,27 @@ void Event::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_messageHasBeenSet)
   {
-      oStream << location << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
   if(m_eventCategoriesHasBeenSet)
   {
       unsigned eventCategoriesIdx = 1;
       for(auto& item : m_eventCategories)
       {
-        oStream << location << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_severityHasBeenSet)
   {
-      oStream << location << ".Severity=" << StringUtils::URLEncode(m_severity.c_str()) << "&";
+      oStream << location << ".Severity=" << StringUtils::URLEncoded(m_severity) << "&";
   }
   if(m_dateHasBeenSet)
   {
-      oStream << location << ".Date=" << StringUtils::URLEncode(m_date.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".Date=" << StringUtils::URLEncoded(m_date.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_eventIdHasBeenSet)
   {
-      oStream << location << ".EventId=" << StringUtils::URLEncode(m_eventId.c_str()) << "&";
+      oStream << location << ".EventId=" << StringUtils::URLEncoded(m_eventId) << "&";
   }
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ EventCategoriesMap& EventCategoriesMap::operator =(const XmlNode& xmlNode)
     XmlNode sourceTypeNode = resultNode.FirstChild("SourceType");
     if(!sourceTypeNode.IsNull())
     {
-      m_sourceType = StringUtils::Trim(sourceTypeNode.GetText().c_str());
+      m_sourceType = sourceTypeNode.GetTextView().Trim().ToString();
       m_sourceTypeHasBeenSet = true;
     }
     XmlNode eventsNode = resultNode.FirstChild("Events");
@@ -75,7 +76,7 @@ void EventCategoriesMap::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_sourceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceType=" << StringUtils::URLEncode(m_sourceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceType=" << StringUtils::URLEncoded(m_sourceType) << "&";
   }
 
   if(m_eventsHasBeenSet)
@@ -83,9 +84,9 @@ void EventCategoriesMap::OutputToStream(Aws::OStream& oStream, const char* locat
       unsigned eventsIdx = 1;
       for(auto& item : m_events)
       {
-        Aws::StringStream eventsSs;
+        Aws::Utils::Stream::StringOutputStream eventsSs;
         eventsSs << location << index << locationValue << ".EventInfoMap." << eventsIdx++;
-        item.OutputToStream(oStream, eventsSs.str().c_str());
+        item.OutputToStream(oStream, eventsSs.GetString().c_str());
       }
   }
 
@@ -95,16 +96,16 @@ void EventCategoriesMap::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_sourceTypeHasBeenSet)
   {
-      oStream << location << ".SourceType=" << StringUtils::URLEncode(m_sourceType.c_str()) << "&";
+      oStream << location << ".SourceType=" << StringUtils::URLEncoded(m_sourceType) << "&";
   }
   if(m_eventsHasBeenSet)
   {
       unsigned eventsIdx = 1;
       for(auto& item : m_events)
       {
-        Aws::StringStream eventsSs;
+        Aws::Utils::Stream::StringOutputStream eventsSs;
         eventsSs << location <<  ".EventInfoMap." << eventsIdx++;
-        item.OutputToStream(oStream, eventsSs.str().c_str());
+        item.OutputToStream(oStream, eventsSs.GetString().c_str());
       }
   }
 }
@@ -55,7 +55,7 @@ EventInfoMap& EventInfoMap::operator =(const XmlNode& xmlNode)
     XmlNode eventIdNode = resultNode.FirstChild("EventId");
     if(!eventIdNode.IsNull())
     {
-      m_eventId = StringUtils::Trim(eventIdNode.GetText().c_str());
+      m_eventId = eventIdNode.GetTextView().Trim().ToString();
       m_eventIdHasBeenSet = true;
     }
     XmlNode eventCategoriesNode = resultNode.FirstChild("EventCategories");
@@ -64,7 +64,7 @@ EventInfoMap& EventInfoMap::operator =(const XmlNode& xmlNode)
       XmlNode eventCategoriesMember = eventCategoriesNode.FirstChild("EventCategory");
       while(!eventCategoriesMember.IsNull())
       {
-        m_eventCategories.push_back(StringUtils::Trim(eventCategoriesMember.GetText().c_str()));
+        m_eventCategories.push_back(eventCategoriesMember.GetTextView().Trim().ToString());
         eventCategoriesMember = eventCategoriesMember.NextNode("EventCategory");
       }
 
@@ -73,13 +73,13 @@ EventInfoMap& EventInfoMap::operator =(const XmlNode& xmlNode)
     XmlNode eventDescriptionNode = resultNode.FirstChild("EventDescription");
     if(!eventDescriptionNode.IsNull())
     {
-      m_eventDescription = StringUtils::Trim(eventDescriptionNode.GetText().c_str());
+      m_eventDescription = eventDescriptionNode.GetTextView().Trim().ToString();
       m_eventDescriptionHasBeenSet = true;
     }
     XmlNode severityNode = resultNode.FirstChild("Severity");
     if(!severityNode.IsNull())
     {
-      m_severity = StringUtils::Trim(severityNode.GetText().c_str());
+      m_severity = severityNode.GetTextView().Trim().ToString();
       m_severityHasBeenSet = true;
     }
   }
@@ -91,7 +91,7 @@ void EventInfoMap::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_eventIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EventId=" << StringUtils::URLEncode(m_eventId.c_str()) << "&";
+      oStream << location << index << locationValue << ".EventId=" << StringUtils::URLEncoded(m_eventId) << "&";
   }
 
   if(m_eventCategoriesHasBeenSet)
@@ -99,18 +99,18 @@ void EventInfoMap::OutputToStream(Aws::OStream& oStream, const char* location, u
       unsigned eventCategoriesIdx = 1;
       for(auto& item : m_eventCategories)
       {
-        oStream << location << index << locationValue << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
   if(m_eventDescriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".EventDescription=" << StringUtils::URLEncode(m_eventDescription.c_str()) << "&";
+      oStream << location << index << locationValue << ".EventDescription=" << StringUtils::URLEncoded(m_eventDescription) << "&";
   }
 
   if(m_severityHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Severity=" << StringUtils::URLEncode(m_severity.c_str()) << "&";
+      oStream << location << index << locationValue << ".Severity=" << StringUtils::URLEncoded(m_severity) << "&";
   }
 
 }
@@ -119,23 +119,23 @@ void EventInfoMap::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_eventIdHasBeenSet)
   {
-      oStream << location << ".EventId=" << StringUtils::URLEncode(m_eventId.c_str()) << "&";
+      oStream << location << ".EventId=" << StringUtils::URLEncoded(m_eventId) << "&";
   }
   if(m_eventCategoriesHasBeenSet)
   {
       unsigned eventCategoriesIdx = 1;
       for(auto& item : m_eventCategories)
       {
-        oStream << location << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".EventCategory." << eventCategoriesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_eventDescriptionHasBeenSet)
   {
-      oStream << location << ".EventDescription=" << StringUtils::URLEncode(m_eventDescription.c_str()) << "&";
+      oStream << location << ".EventDescription=" << StringUtils::URLEncoded(m_eventDescription) << "&";
   }
   if(m_severityHasBeenSet)
   {
-      oStream << location << ".Severity=" << StringUtils::URLEncode(m_severity.c_str()) << "&";
+      oStream << location << ".Severity=" << StringUtils::URLEncoded(m_severity) << "&";
   }
 }
 
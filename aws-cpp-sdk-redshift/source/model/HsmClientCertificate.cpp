@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,13 +54,13 @@ HsmClientCertificate& HsmClientCertificate::operator =(const XmlNode& xmlNode)
     XmlNode hsmClientCertificateIdentifierNode = resultNode.FirstChild("HsmClientCertificateIdentifier");
     if(!hsmClientCertificateIdentifierNode.IsNull())
     {
-      m_hsmClientCertificateIdentifier = StringUtils::Trim(hsmClientCertificateIdentifierNode.GetText().c_str());
+      m_hsmClientCertificateIdentifier = hsmClientCertificateIdentifierNode.GetTextView().Trim().ToString();
       m_hsmClientCertificateIdentifierHasBeenSet = true;
     }
     XmlNode hsmClientCertificatePublicKeyNode = resultNode.FirstChild("HsmClientCertificatePublicKey");
     if(!hsmClientCertificatePublicKeyNode.IsNull())
     {
-      m_hsmClientCertificatePublicKey = StringUtils::Trim(hsmClientCertificatePublicKeyNode.GetText().c_str());
+      m_hsmClientCertificatePublicKey = hsmClientCertificatePublicKeyNode.GetTextView().Trim().ToString();
       m_hsmClientCertificatePublicKeyHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("Tags");
@@ -83,12 +84,12 @@ void HsmClientCertificate::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_hsmClientCertificateIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HsmClientCertificateIdentifier=" << StringUtils::URLEncode(m_hsmClientCertificateIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".HsmClientCertificateIdentifier=" << StringUtils::URLEncoded(m_hsmClientCertificateIdentifier) << "&";
   }
 
   if(m_hsmClientCertificatePublicKeyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HsmClientCertificatePublicKey=" << StringUtils::URLEncode(m_hsmClientCertificatePublicKey.c_str()) << "&";
+      oStream << location << index << locationValue << ".HsmClientCertificatePublicKey=" << StringUtils::URLEncoded(m_hsmClientCertificatePublicKey) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -96,9 +97,9 @@ void HsmClientCertificate::OutputToStream(Aws::OStream& oStream, const char* loc
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".Tag." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -108,20 +109,20 @@ void HsmClientCertificate::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_hsmClientCertificateIdentifierHasBeenSet)
   {
-      oStream << location << ".HsmClientCertificateIdentifier=" << StringUtils::URLEncode(m_hsmClientCertificateIdentifier.c_str()) << "&";
+      oStream << location << ".HsmClientCertificateIdentifier=" << StringUtils::URLEncoded(m_hsmClientCertificateIdentifier) << "&";
   }
   if(m_hsmClientCertificatePublicKeyHasBeenSet)
   {
-      oStream << location << ".HsmClientCertificatePublicKey=" << StringUtils::URLEncode(m_hsmClientCertificatePublicKey.c_str()) << "&";
+      oStream << location << ".HsmClientCertificatePublicKey=" << StringUtils::URLEncoded(m_hsmClientCertificatePublicKey) << "&";
   }
   if(m_tagsHasBeenSet)
   {
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".Tag." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -57,25 +58,25 @@ HsmConfiguration& HsmConfiguration::operator =(const XmlNode& xmlNode)
     XmlNode hsmConfigurationIdentifierNode = resultNode.FirstChild("HsmConfigurationIdentifier");
     if(!hsmConfigurationIdentifierNode.IsNull())
     {
-      m_hsmConfigurationIdentifier = StringUtils::Trim(hsmConfigurationIdentifierNode.GetText().c_str());
+      m_hsmConfigurationIdentifier = hsmConfigurationIdentifierNode.GetTextView().Trim().ToString();
       m_hsmConfigurationIdentifierHasBeenSet = true;
     }
     XmlNode descriptionNode = resultNode.FirstChild("Description");
     if(!descriptionNode.IsNull())
     {
-      m_description = StringUtils::Trim(descriptionNode.GetText().c_str());
+      m_description = descriptionNode.GetTextView().Trim().ToString();
       m_descriptionHasBeenSet = true;
     }
     XmlNode hsmIpAddressNode = resultNode.FirstChild("HsmIpAddress");
     if(!hsmIpAddressNode.IsNull())
     {
-      m_hsmIpAddress = StringUtils::Trim(hsmIpAddressNode.GetText().c_str());
+      m_hsmIpAddress = hsmIpAddressNode.GetTextView().Trim().ToString();
       m_hsmIpAddressHasBeenSet = true;
     }
     XmlNode hsmPartitionNameNode = resultNode.FirstChild("HsmPartitionName");
     if(!hsmPartitionNameNode.IsNull())
     {
-      m_hsmPartitionName = StringUtils::Trim(hsmPartitionNameNode.GetText().c_str());
+      m_hsmPartitionName = hsmPartitionNameNode.GetTextView().Trim().ToString();
       m_hsmPartitionNameHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("Tags");
@@ -99,22 +100,22 @@ void HsmConfiguration::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_hsmConfigurationIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HsmConfigurationIdentifier=" << StringUtils::URLEncode(m_hsmConfigurationIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".HsmConfigurationIdentifier=" << StringUtils::URLEncoded(m_hsmConfigurationIdentifier) << "&";
   }
 
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << index << locationValue << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
 
   if(m_hsmIpAddressHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HsmIpAddress=" << StringUtils::URLEncode(m_hsmIpAddress.c_str()) << "&";
+      oStream << location << index << locationValue << ".HsmIpAddress=" << StringUtils::URLEncoded(m_hsmIpAddress) << "&";
   }
 
   if(m_hsmPartitionNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".HsmPartitionName=" << StringUtils::URLEncode(m_hsmPartitionName.c_str()) << "&";
+      oStream << location << index << locationValue << ".HsmPartitionName=" << StringUtils::URLEncoded(m_hsmPartitionName) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -122,9 +123,9 @@ void HsmConfiguration::OutputToStream(Aws::OStream& oStream, const char* locatio
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".Tag." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -134,28 +135,28 @@ void HsmConfiguration::OutputToStream(Aws::OStream& oStream, const char* locatio
 {
   if(m_hsmConfigurationIdentifierHasBeenSet)
   {
-      oStream << location << ".HsmConfigurationIdentifier=" << StringUtils::URLEncode(m_hsmConfigurationIdentifier.c_str()) << "&";
+      oStream << location << ".HsmConfigurationIdentifier=" << StringUtils::URLEncoded(m_hsmConfigurationIdentifier) << "&";
   }
   if(m_descriptionHasBeenSet)
   {
-      oStream << location << ".Description=" << StringUtils::URLEncode(m_description.c_str()) << "&";
+      oStream << location << ".Description=" << StringUtils::URLEncoded(m_description) << "&";
   }
   if(m_hsmIpAddressHasBeenSet)
   {
-      oStream << location << ".HsmIpAddress=" << StringUtils::URLEncode(m_hsmIpAddress.c_str()) << "&";
+      oStream << location << ".HsmIpAddress=" << StringUtils::URLEncoded(m_hsmIpAddress) << "&";
   }
   if(m_hsmPartitionNameHasBeenSet)
   {
-      oStream << location << ".HsmPartitionName=" << StringUtils::URLEncode(m_hsmPartitionName.c_str()) << "&";
+      oStream << location << ".HsmPartitionName=" << StringUtils::URLEncoded(m_hsmPartitionName) << "&";
   }
   if(m_tagsHasBeenSet)
   {
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".Tag." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 }
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/ModifyClusterIamRolesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -28,11 +29,11 @@ ModifyClusterIamRolesRequest::ModifyClusterIamRolesRequest() :
 
 Aws::String ModifyClusterIamRolesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyClusterIamRoles&";
   if(m_clusterIdentifierHasBeenSet)
   {
-    ss << "ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+    ss << "ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
 
   if(m_addIamRolesHasBeenSet)
@@ -41,7 +42,7 @@ Aws::String ModifyClusterIamRolesRequest::SerializePayload() const
     for(auto& item : m_addIamRoles)
     {
       ss << "AddIamRoles.member." << addIamRolesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       addIamRolesCount++;
     }
   }
@@ -52,12 +53,12 @@ Aws::String ModifyClusterIamRolesRequest::SerializePayload() const
     for(auto& item : m_removeIamRoles)
     {
       ss << "RemoveIamRoles.member." << removeIamRolesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       removeIamRolesCount++;
     }
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ModifyClusterIamRolesResult& ModifyClusterIamRolesResult::operator =(const Amazo
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyClusterIamRolesResult")
+  if (rootNode.GetNameView() != "ModifyClusterIamRolesResult")
   {
     resultNode = rootNode.FirstChild("ModifyClusterIamRolesResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/ModifyClusterParameterGroupRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ ModifyClusterParameterGroupRequest::ModifyClusterParameterGroupRequest() :
 
 Aws::String ModifyClusterParameterGroupRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyClusterParameterGroup&";
   if(m_parameterGroupNameHasBeenSet)
   {
-    ss << "ParameterGroupName=" << StringUtils::URLEncode(m_parameterGroupName.c_str()) << "&";
+    ss << "ParameterGroupName=" << StringUtils::URLEncoded(m_parameterGroupName) << "&";
   }
 
   if(m_parametersHasBeenSet)
@@ -45,6 +46,6 @@ Aws::String ModifyClusterParameterGroupRequest::SerializePayload() const
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
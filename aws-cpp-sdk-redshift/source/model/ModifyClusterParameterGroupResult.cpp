@@ -40,7 +40,7 @@ ModifyClusterParameterGroupResult& ModifyClusterParameterGroupResult::operator =
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyClusterParameterGroupResult")
+  if (rootNode.GetNameView() != "ModifyClusterParameterGroupResult")
   {
     resultNode = rootNode.FirstChild("ModifyClusterParameterGroupResult");
   }
@@ -50,12 +50,12 @@ ModifyClusterParameterGroupResult& ModifyClusterParameterGroupResult::operator =
     XmlNode parameterGroupNameNode = resultNode.FirstChild("ParameterGroupName");
     if(!parameterGroupNameNode.IsNull())
     {
-      m_parameterGroupName = StringUtils::Trim(parameterGroupNameNode.GetText().c_str());
+      m_parameterGroupName = parameterGroupNameNode.GetTextView().Trim().ToString();
     }
     XmlNode parameterGroupStatusNode = resultNode.FirstChild("ParameterGroupStatus");
     if(!parameterGroupStatusNode.IsNull())
     {
-      m_parameterGroupStatus = StringUtils::Trim(parameterGroupStatusNode.GetText().c_str());
+      m_parameterGroupStatus = parameterGroupStatusNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/ModifyClusterRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -46,21 +47,21 @@ ModifyClusterRequest::ModifyClusterRequest() :
 
 Aws::String ModifyClusterRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyCluster&";
   if(m_clusterIdentifierHasBeenSet)
   {
-    ss << "ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+    ss << "ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
 
   if(m_clusterTypeHasBeenSet)
   {
-    ss << "ClusterType=" << StringUtils::URLEncode(m_clusterType.c_str()) << "&";
+    ss << "ClusterType=" << StringUtils::URLEncoded(m_clusterType) << "&";
   }
 
   if(m_nodeTypeHasBeenSet)
   {
-    ss << "NodeType=" << StringUtils::URLEncode(m_nodeType.c_str()) << "&";
+    ss << "NodeType=" << StringUtils::URLEncoded(m_nodeType) << "&";
   }
 
   if(m_numberOfNodesHasBeenSet)
@@ -74,7 +75,7 @@ Aws::String ModifyClusterRequest::SerializePayload() const
     for(auto& item : m_clusterSecurityGroups)
     {
       ss << "ClusterSecurityGroups.member." << clusterSecurityGroupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       clusterSecurityGroupsCount++;
     }
   }
@@ -85,19 +86,19 @@ Aws::String ModifyClusterRequest::SerializePayload() const
     for(auto& item : m_vpcSecurityGroupIds)
     {
       ss << "VpcSecurityGroupIds.member." << vpcSecurityGroupIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       vpcSecurityGroupIdsCount++;
     }
   }
 
   if(m_masterUserPasswordHasBeenSet)
   {
-    ss << "MasterUserPassword=" << StringUtils::URLEncode(m_masterUserPassword.c_str()) << "&";
+    ss << "MasterUserPassword=" << StringUtils::URLEncoded(m_masterUserPassword) << "&";
   }
 
   if(m_clusterParameterGroupNameHasBeenSet)
   {
-    ss << "ClusterParameterGroupName=" << StringUtils::URLEncode(m_clusterParameterGroupName.c_str()) << "&";
+    ss << "ClusterParameterGroupName=" << StringUtils::URLEncoded(m_clusterParameterGroupName) << "&";
   }
 
   if(m_automatedSnapshotRetentionPeriodHasBeenSet)
@@ -107,12 +108,12 @@ Aws::String ModifyClusterRequest::SerializePayload() const
 
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
 
   if(m_clusterVersionHasBeenSet)
   {
-    ss << "ClusterVersion=" << StringUtils::URLEncode(m_clusterVersion.c_str()) << "&";
+    ss << "ClusterVersion=" << StringUtils::URLEncoded(m_clusterVersion) << "&";
   }
 
   if(m_allowVersionUpgradeHasBeenSet)
@@ -122,17 +123,17 @@ Aws::String ModifyClusterRequest::SerializePayload() const
 
   if(m_hsmClientCertificateIdentifierHasBeenSet)
   {
-    ss << "HsmClientCertificateIdentifier=" << StringUtils::URLEncode(m_hsmClientCertificateIdentifier.c_str()) << "&";
+    ss << "HsmClientCertificateIdentifier=" << StringUtils::URLEncoded(m_hsmClientCertificateIdentifier) << "&";
   }
 
   if(m_hsmConfigurationIdentifierHasBeenSet)
   {
-    ss << "HsmConfigurationIdentifier=" << StringUtils::URLEncode(m_hsmConfigurationIdentifier.c_str()) << "&";
+    ss << "HsmConfigurationIdentifier=" << StringUtils::URLEncoded(m_hsmConfigurationIdentifier) << "&";
   }
 
   if(m_newClusterIdentifierHasBeenSet)
   {
-    ss << "NewClusterIdentifier=" << StringUtils::URLEncode(m_newClusterIdentifier.c_str()) << "&";
+    ss << "NewClusterIdentifier=" << StringUtils::URLEncoded(m_newClusterIdentifier) << "&";
   }
 
   if(m_publiclyAccessibleHasBeenSet)
@@ -142,10 +143,10 @@ Aws::String ModifyClusterRequest::SerializePayload() const
 
   if(m_elasticIpHasBeenSet)
   {
-    ss << "ElasticIp=" << StringUtils::URLEncode(m_elasticIp.c_str()) << "&";
+    ss << "ElasticIp=" << StringUtils::URLEncoded(m_elasticIp) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
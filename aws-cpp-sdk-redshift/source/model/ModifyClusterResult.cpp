@@ -40,7 +40,7 @@ ModifyClusterResult& ModifyClusterResult::operator =(const AmazonWebServiceResul
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyClusterResult")
+  if (rootNode.GetNameView() != "ModifyClusterResult")
   {
     resultNode = rootNode.FirstChild("ModifyClusterResult");
   }
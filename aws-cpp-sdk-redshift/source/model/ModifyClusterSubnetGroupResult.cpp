@@ -40,7 +40,7 @@ ModifyClusterSubnetGroupResult& ModifyClusterSubnetGroupResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifyClusterSubnetGroupResult")
+  if (rootNode.GetNameView() != "ModifyClusterSubnetGroupResult")
   {
     resultNode = rootNode.FirstChild("ModifyClusterSubnetGroupResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/ModifyEventSubscriptionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -33,21 +34,21 @@ ModifyEventSubscriptionRequest::ModifyEventSubscriptionRequest() :
 
 Aws::String ModifyEventSubscriptionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ModifyEventSubscription&";
   if(m_subscriptionNameHasBeenSet)
   {
-    ss << "SubscriptionName=" << StringUtils::URLEncode(m_subscriptionName.c_str()) << "&";
+    ss << "SubscriptionName=" << StringUtils::URLEncoded(m_subscriptionName) << "&";
   }
 
   if(m_snsTopicArnHasBeenSet)
   {
-    ss << "SnsTopicArn=" << StringUtils::URLEncode(m_snsTopicArn.c_str()) << "&";
+    ss << "SnsTopicArn=" << StringUtils::URLEncoded(m_snsTopicArn) << "&";
   }
 
   if(m_sourceTypeHasBeenSet)
   {
-    ss << "SourceType=" << StringUtils::URLEncode(m_sourceType.c_str()) << "&";
+    ss << "SourceType=" << StringUtils::URLEncoded(m_sourceType) << "&";
   }
 
   if(m_sourceIdsHasBeenSet)
@@ -56,7 +57,7 @@ Aws::String ModifyEventSubscriptionRequest::SerializePayload() const
     for(auto& item : m_sourceIds)
     {
       ss << "SourceIds.member." << sourceIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       sourceIdsCount++;
     }
   }
@@ -67,14 +68,14 @@ Aws::String ModifyEventSubscriptionRequest::SerializePayload() const
     for(auto& item : m_eventCategories)
     {
       ss << "EventCategories.member." << eventCategoriesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       eventCategoriesCount++;
     }
   }
 
   if(m_severityHasBeenSet)
   {
-    ss << "Severity=" << StringUtils::URLEncode(m_severity.c_str()) << "&";
+    ss << "Severity=" << StringUtils::URLEncoded(m_severity) << "&";
   }
 
   if(m_enabledHasBeenSet)
@@ -83,6 +84,6 @@ Aws::String ModifyEventSubscriptionRequest::SerializePayload() const
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
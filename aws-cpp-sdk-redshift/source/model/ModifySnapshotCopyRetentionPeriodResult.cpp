@@ -40,7 +40,7 @@ ModifySnapshotCopyRetentionPeriodResult& ModifySnapshotCopyRetentionPeriodResult
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ModifySnapshotCopyRetentionPeriodResult")
+  if (rootNode.GetNameView() != "ModifySnapshotCopyRetentionPeriodResult")
   {
     resultNode = rootNode.FirstChild("ModifySnapshotCopyRetentionPeriodResult");
   }
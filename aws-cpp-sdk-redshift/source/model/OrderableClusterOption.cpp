@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -55,19 +56,19 @@ OrderableClusterOption& OrderableClusterOption::operator =(const XmlNode& xmlNod
     XmlNode clusterVersionNode = resultNode.FirstChild("ClusterVersion");
     if(!clusterVersionNode.IsNull())
     {
-      m_clusterVersion = StringUtils::Trim(clusterVersionNode.GetText().c_str());
+      m_clusterVersion = clusterVersionNode.GetTextView().Trim().ToString();
       m_clusterVersionHasBeenSet = true;
     }
     XmlNode clusterTypeNode = resultNode.FirstChild("ClusterType");
     if(!clusterTypeNode.IsNull())
     {
-      m_clusterType = StringUtils::Trim(clusterTypeNode.GetText().c_str());
+      m_clusterType = clusterTypeNode.GetTextView().Trim().ToString();
       m_clusterTypeHasBeenSet = true;
     }
     XmlNode nodeTypeNode = resultNode.FirstChild("NodeType");
     if(!nodeTypeNode.IsNull())
     {
-      m_nodeType = StringUtils::Trim(nodeTypeNode.GetText().c_str());
+      m_nodeType = nodeTypeNode.GetTextView().Trim().ToString();
       m_nodeTypeHasBeenSet = true;
     }
     XmlNode availabilityZonesNode = resultNode.FirstChild("AvailabilityZones");
@@ -91,17 +92,17 @@ void OrderableClusterOption::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_clusterVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterVersion=" << StringUtils::URLEncode(m_clusterVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterVersion=" << StringUtils::URLEncoded(m_clusterVersion) << "&";
   }
 
   if(m_clusterTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterType=" << StringUtils::URLEncode(m_clusterType.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterType=" << StringUtils::URLEncoded(m_clusterType) << "&";
   }
 
   if(m_nodeTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NodeType=" << StringUtils::URLEncode(m_nodeType.c_str()) << "&";
+      oStream << location << index << locationValue << ".NodeType=" << StringUtils::URLEncoded(m_nodeType) << "&";
   }
 
   if(m_availabilityZonesHasBeenSet)
@@ -109,9 +110,9 @@ void OrderableClusterOption::OutputToStream(Aws::OStream& oStream, const char* l
       unsigned availabilityZonesIdx = 1;
       for(auto& item : m_availabilityZones)
       {
-        Aws::StringStream availabilityZonesSs;
+        Aws::Utils::Stream::StringOutputStream availabilityZonesSs;
         availabilityZonesSs << location << index << locationValue << ".AvailabilityZone." << availabilityZonesIdx++;
-        item.OutputToStream(oStream, availabilityZonesSs.str().c_str());
+        item.OutputToStream(oStream, availabilityZonesSs.GetString().c_str());
       }
   }
 
@@ -121,24 +122,24 @@ void OrderableClusterOption::OutputToStream(Aws::OStream& oStream, const char* l
 {
   if(m_clusterVersionHasBeenSet)
   {
-      oStream << location << ".ClusterVersion=" << StringUtils::URLEncode(m_clusterVersion.c_str()) << "&";
+      oStream << location << ".ClusterVersion=" << StringUtils::URLEncoded(m_clusterVersion) << "&";
   }
   if(m_clusterTypeHasBeenSet)
   {
-      oStream << location << ".ClusterType=" << StringUtils::URLEncode(m_clusterType.c_str()) << "&";
+      oStream << location << ".ClusterType=" << StringUtils::URLEncoded(m_clusterType) << "&";
   }
   if(m_nodeTypeHasBeenSet)
   {
-      oStream << location << ".NodeType=" << StringUtils::URLEncode(m_nodeType.c_str()) << "&";
+      oStream << location << ".NodeType=" << StringUtils::URLEncoded(m_nodeType) << "&";
   }
   if(m_availabilityZonesHasBeenSet)
   {
       unsigned availabilityZonesIdx = 1;
       for(auto& item : m_availabilityZones)
       {
-        Aws::StringStream availabilityZonesSs;
+        Aws::Utils::Stream::StringOutputStream availabilityZonesSs;
         availabilityZonesSs << location <<  ".AvailabilityZone." << availabilityZonesIdx++;
-        item.OutputToStream(oStream, availabilityZonesSs.str().c_str());
+        item.OutputToStream(oStream, availabilityZonesSs.GetString().c_str());
       }
   }
 }
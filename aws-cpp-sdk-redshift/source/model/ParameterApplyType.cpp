@@ -29,21 +29,29 @@ namespace Aws
       namespace ParameterApplyTypeMapper
       {
 
-        static const int static__HASH = HashingUtils::HashString("static");
-        static const int dynamic_HASH = HashingUtils::HashString("dynamic");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int static__HASH = -892481938;
+        static const int dynamic_HASH = 2124767295;
 
 
         ParameterApplyType GetParameterApplyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == static__HASH)
+          switch (hashCode)
           {
+          case static__HASH:
             return ParameterApplyType::static_;
-          }
-          else if (hashCode == dynamic_HASH)
-          {
+          case dynamic_HASH:
             return ParameterApplyType::dynamic;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -69,49 +69,49 @@ PendingModifiedValues& PendingModifiedValues::operator =(const XmlNode& xmlNode)
     XmlNode masterUserPasswordNode = resultNode.FirstChild("MasterUserPassword");
     if(!masterUserPasswordNode.IsNull())
     {
-      m_masterUserPassword = StringUtils::Trim(masterUserPasswordNode.GetText().c_str());
+      m_masterUserPassword = masterUserPasswordNode.GetTextView().Trim().ToString();
       m_masterUserPasswordHasBeenSet = true;
     }
     XmlNode nodeTypeNode = resultNode.FirstChild("NodeType");
     if(!nodeTypeNode.IsNull())
     {
-      m_nodeType = StringUtils::Trim(nodeTypeNode.GetText().c_str());
+      m_nodeType = nodeTypeNode.GetTextView().Trim().ToString();
       m_nodeTypeHasBeenSet = true;
     }
     XmlNode numberOfNodesNode = resultNode.FirstChild("NumberOfNodes");
     if(!numberOfNodesNode.IsNull())
     {
-      m_numberOfNodes = StringUtils::ConvertToInt32(StringUtils::Trim(numberOfNodesNode.GetText().c_str()).c_str());
+      m_numberOfNodes = StringUtils::ConvertToInt32(numberOfNodesNode.GetTextView().Trim().ToString().c_str());
       m_numberOfNodesHasBeenSet = true;
     }
     XmlNode clusterTypeNode = resultNode.FirstChild("ClusterType");
     if(!clusterTypeNode.IsNull())
     {
-      m_clusterType = StringUtils::Trim(clusterTypeNode.GetText().c_str());
+      m_clusterType = clusterTypeNode.GetTextView().Trim().ToString();
       m_clusterTypeHasBeenSet = true;
     }
     XmlNode clusterVersionNode = resultNode.FirstChild("ClusterVersion");
     if(!clusterVersionNode.IsNull())
     {
-      m_clusterVersion = StringUtils::Trim(clusterVersionNode.GetText().c_str());
+      m_clusterVersion = clusterVersionNode.GetTextView().Trim().ToString();
       m_clusterVersionHasBeenSet = true;
     }
     XmlNode automatedSnapshotRetentionPeriodNode = resultNode.FirstChild("AutomatedSnapshotRetentionPeriod");
     if(!automatedSnapshotRetentionPeriodNode.IsNull())
     {
-      m_automatedSnapshotRetentionPeriod = StringUtils::ConvertToInt32(StringUtils::Trim(automatedSnapshotRetentionPeriodNode.GetText().c_str()).c_str());
+      m_automatedSnapshotRetentionPeriod = StringUtils::ConvertToInt32(automatedSnapshotRetentionPeriodNode.GetTextView().Trim().ToString().c_str());
       m_automatedSnapshotRetentionPeriodHasBeenSet = true;
     }
     XmlNode clusterIdentifierNode = resultNode.FirstChild("ClusterIdentifier");
     if(!clusterIdentifierNode.IsNull())
     {
-      m_clusterIdentifier = StringUtils::Trim(clusterIdentifierNode.GetText().c_str());
+      m_clusterIdentifier = clusterIdentifierNode.GetTextView().Trim().ToString();
       m_clusterIdentifierHasBeenSet = true;
     }
     XmlNode publiclyAccessibleNode = resultNode.FirstChild("PubliclyAccessible");
     if(!publiclyAccessibleNode.IsNull())
     {
-      m_publiclyAccessible = StringUtils::ConvertToBool(StringUtils::Trim(publiclyAccessibleNode.GetText().c_str()).c_str());
+      m_publiclyAccessible = StringUtils::ConvertToBool(publiclyAccessibleNode.GetTextView().Trim().ToString().c_str());
       m_publiclyAccessibleHasBeenSet = true;
     }
   }
@@ -123,12 +123,12 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_masterUserPasswordHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MasterUserPassword=" << StringUtils::URLEncode(m_masterUserPassword.c_str()) << "&";
+      oStream << location << index << locationValue << ".MasterUserPassword=" << StringUtils::URLEncoded(m_masterUserPassword) << "&";
   }
 
   if(m_nodeTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NodeType=" << StringUtils::URLEncode(m_nodeType.c_str()) << "&";
+      oStream << location << index << locationValue << ".NodeType=" << StringUtils::URLEncoded(m_nodeType) << "&";
   }
 
   if(m_numberOfNodesHasBeenSet)
@@ -138,12 +138,12 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
 
   if(m_clusterTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterType=" << StringUtils::URLEncode(m_clusterType.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterType=" << StringUtils::URLEncoded(m_clusterType) << "&";
   }
 
   if(m_clusterVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterVersion=" << StringUtils::URLEncode(m_clusterVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterVersion=" << StringUtils::URLEncoded(m_clusterVersion) << "&";
   }
 
   if(m_automatedSnapshotRetentionPeriodHasBeenSet)
@@ -153,7 +153,7 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
 
   if(m_clusterIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
 
   if(m_publiclyAccessibleHasBeenSet)
@@ -167,11 +167,11 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_masterUserPasswordHasBeenSet)
   {
-      oStream << location << ".MasterUserPassword=" << StringUtils::URLEncode(m_masterUserPassword.c_str()) << "&";
+      oStream << location << ".MasterUserPassword=" << StringUtils::URLEncoded(m_masterUserPassword) << "&";
   }
   if(m_nodeTypeHasBeenSet)
   {
-      oStream << location << ".NodeType=" << StringUtils::URLEncode(m_nodeType.c_str()) << "&";
+      oStream << location << ".NodeType=" << StringUtils::URLEncoded(m_nodeType) << "&";
   }
   if(m_numberOfNodesHasBeenSet)
   {
@@ -179,11 +179,11 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
   }
   if(m_clusterTypeHasBeenSet)
   {
-      oStream << location << ".ClusterType=" << StringUtils::URLEncode(m_clusterType.c_str()) << "&";
+      oStream << location << ".ClusterType=" << StringUtils::URLEncoded(m_clusterType) << "&";
   }
   if(m_clusterVersionHasBeenSet)
   {
-      oStream << location << ".ClusterVersion=" << StringUtils::URLEncode(m_clusterVersion.c_str()) << "&";
+      oStream << location << ".ClusterVersion=" << StringUtils::URLEncoded(m_clusterVersion) << "&";
   }
   if(m_automatedSnapshotRetentionPeriodHasBeenSet)
   {
@@ -191,7 +191,7 @@ void PendingModifiedValues::OutputToStream(Aws::OStream& oStream, const char* lo
   }
   if(m_clusterIdentifierHasBeenSet)
   {
-      oStream << location << ".ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+      oStream << location << ".ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
   if(m_publiclyAccessibleHasBeenSet)
   {
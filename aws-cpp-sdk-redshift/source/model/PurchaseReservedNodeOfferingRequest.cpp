@@ -15,6 +15,7 @@
 #include <aws/redshift/model/PurchaseReservedNodeOfferingRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -28,11 +29,11 @@ PurchaseReservedNodeOfferingRequest::PurchaseReservedNodeOfferingRequest() :
 
 Aws::String PurchaseReservedNodeOfferingRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=PurchaseReservedNodeOffering&";
   if(m_reservedNodeOfferingIdHasBeenSet)
   {
-    ss << "ReservedNodeOfferingId=" << StringUtils::URLEncode(m_reservedNodeOfferingId.c_str()) << "&";
+    ss << "ReservedNodeOfferingId=" << StringUtils::URLEncoded(m_reservedNodeOfferingId) << "&";
   }
 
   if(m_nodeCountHasBeenSet)
@@ -41,6 +42,6 @@ Aws::String PurchaseReservedNodeOfferingRequest::SerializePayload() const
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ PurchaseReservedNodeOfferingResult& PurchaseReservedNodeOfferingResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "PurchaseReservedNodeOfferingResult")
+  if (rootNode.GetNameView() != "PurchaseReservedNodeOfferingResult")
   {
     resultNode = rootNode.FirstChild("PurchaseReservedNodeOfferingResult");
   }
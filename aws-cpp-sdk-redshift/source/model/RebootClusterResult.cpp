@@ -40,7 +40,7 @@ RebootClusterResult& RebootClusterResult::operator =(const AmazonWebServiceResul
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RebootClusterResult")
+  if (rootNode.GetNameView() != "RebootClusterResult")
   {
     resultNode = rootNode.FirstChild("RebootClusterResult");
   }
@@ -40,7 +40,7 @@ ResetClusterParameterGroupResult& ResetClusterParameterGroupResult::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ResetClusterParameterGroupResult")
+  if (rootNode.GetNameView() != "ResetClusterParameterGroupResult")
   {
     resultNode = rootNode.FirstChild("ResetClusterParameterGroupResult");
   }
@@ -50,12 +50,12 @@ ResetClusterParameterGroupResult& ResetClusterParameterGroupResult::operator =(c
     XmlNode parameterGroupNameNode = resultNode.FirstChild("ParameterGroupName");
     if(!parameterGroupNameNode.IsNull())
     {
-      m_parameterGroupName = StringUtils::Trim(parameterGroupNameNode.GetText().c_str());
+      m_parameterGroupName = parameterGroupNameNode.GetTextView().Trim().ToString();
     }
     XmlNode parameterGroupStatusNode = resultNode.FirstChild("ParameterGroupStatus");
     if(!parameterGroupStatusNode.IsNull())
     {
-      m_parameterGroupStatus = StringUtils::Trim(parameterGroupStatusNode.GetText().c_str());
+      m_parameterGroupStatus = parameterGroupStatusNode.GetTextView().Trim().ToString();
     }
   }
 
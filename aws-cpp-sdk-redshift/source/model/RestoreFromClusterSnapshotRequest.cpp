@@ -15,6 +15,7 @@
 #include <aws/redshift/model/RestoreFromClusterSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -50,21 +51,21 @@ RestoreFromClusterSnapshotRequest::RestoreFromClusterSnapshotRequest() :
 
 Aws::String RestoreFromClusterSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=RestoreFromClusterSnapshot&";
   if(m_clusterIdentifierHasBeenSet)
   {
-    ss << "ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+    ss << "ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
 
   if(m_snapshotIdentifierHasBeenSet)
   {
-    ss << "SnapshotIdentifier=" << StringUtils::URLEncode(m_snapshotIdentifier.c_str()) << "&";
+    ss << "SnapshotIdentifier=" << StringUtils::URLEncoded(m_snapshotIdentifier) << "&";
   }
 
   if(m_snapshotClusterIdentifierHasBeenSet)
   {
-    ss << "SnapshotClusterIdentifier=" << StringUtils::URLEncode(m_snapshotClusterIdentifier.c_str()) << "&";
+    ss << "SnapshotClusterIdentifier=" << StringUtils::URLEncoded(m_snapshotClusterIdentifier) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -74,7 +75,7 @@ Aws::String RestoreFromClusterSnapshotRequest::SerializePayload() const
 
   if(m_availabilityZoneHasBeenSet)
   {
-    ss << "AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+    ss << "AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_allowVersionUpgradeHasBeenSet)
@@ -84,7 +85,7 @@ Aws::String RestoreFromClusterSnapshotRequest::SerializePayload() const
 
   if(m_clusterSubnetGroupNameHasBeenSet)
   {
-    ss << "ClusterSubnetGroupName=" << StringUtils::URLEncode(m_clusterSubnetGroupName.c_str()) << "&";
+    ss << "ClusterSubnetGroupName=" << StringUtils::URLEncoded(m_clusterSubnetGroupName) << "&";
   }
 
   if(m_publiclyAccessibleHasBeenSet)
@@ -94,27 +95,27 @@ Aws::String RestoreFromClusterSnapshotRequest::SerializePayload() const
 
   if(m_ownerAccountHasBeenSet)
   {
-    ss << "OwnerAccount=" << StringUtils::URLEncode(m_ownerAccount.c_str()) << "&";
+    ss << "OwnerAccount=" << StringUtils::URLEncoded(m_ownerAccount) << "&";
   }
 
   if(m_hsmClientCertificateIdentifierHasBeenSet)
   {
-    ss << "HsmClientCertificateIdentifier=" << StringUtils::URLEncode(m_hsmClientCertificateIdentifier.c_str()) << "&";
+    ss << "HsmClientCertificateIdentifier=" << StringUtils::URLEncoded(m_hsmClientCertificateIdentifier) << "&";
   }
 
   if(m_hsmConfigurationIdentifierHasBeenSet)
   {
-    ss << "HsmConfigurationIdentifier=" << StringUtils::URLEncode(m_hsmConfigurationIdentifier.c_str()) << "&";
+    ss << "HsmConfigurationIdentifier=" << StringUtils::URLEncoded(m_hsmConfigurationIdentifier) << "&";
   }
 
   if(m_elasticIpHasBeenSet)
   {
-    ss << "ElasticIp=" << StringUtils::URLEncode(m_elasticIp.c_str()) << "&";
+    ss << "ElasticIp=" << StringUtils::URLEncoded(m_elasticIp) << "&";
   }
 
   if(m_clusterParameterGroupNameHasBeenSet)
   {
-    ss << "ClusterParameterGroupName=" << StringUtils::URLEncode(m_clusterParameterGroupName.c_str()) << "&";
+    ss << "ClusterParameterGroupName=" << StringUtils::URLEncoded(m_clusterParameterGroupName) << "&";
   }
 
   if(m_clusterSecurityGroupsHasBeenSet)
@@ -123,7 +124,7 @@ Aws::String RestoreFromClusterSnapshotRequest::SerializePayload() const
     for(auto& item : m_clusterSecurityGroups)
     {
       ss << "ClusterSecurityGroups.member." << clusterSecurityGroupsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       clusterSecurityGroupsCount++;
     }
   }
@@ -134,14 +135,14 @@ Aws::String RestoreFromClusterSnapshotRequest::SerializePayload() const
     for(auto& item : m_vpcSecurityGroupIds)
     {
       ss << "VpcSecurityGroupIds.member." << vpcSecurityGroupIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       vpcSecurityGroupIdsCount++;
     }
   }
 
   if(m_preferredMaintenanceWindowHasBeenSet)
   {
-    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncode(m_preferredMaintenanceWindow.c_str()) << "&";
+    ss << "PreferredMaintenanceWindow=" << StringUtils::URLEncoded(m_preferredMaintenanceWindow) << "&";
   }
 
   if(m_automatedSnapshotRetentionPeriodHasBeenSet)
@@ -151,17 +152,17 @@ Aws::String RestoreFromClusterSnapshotRequest::SerializePayload() const
 
   if(m_kmsKeyIdHasBeenSet)
   {
-    ss << "KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+    ss << "KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
 
   if(m_nodeTypeHasBeenSet)
   {
-    ss << "NodeType=" << StringUtils::URLEncode(m_nodeType.c_str()) << "&";
+    ss << "NodeType=" << StringUtils::URLEncoded(m_nodeType) << "&";
   }
 
   if(m_additionalInfoHasBeenSet)
   {
-    ss << "AdditionalInfo=" << StringUtils::URLEncode(m_additionalInfo.c_str()) << "&";
+    ss << "AdditionalInfo=" << StringUtils::URLEncoded(m_additionalInfo) << "&";
   }
 
   if(m_iamRolesHasBeenSet)
@@ -170,12 +171,12 @@ Aws::String RestoreFromClusterSnapshotRequest::SerializePayload() const
     for(auto& item : m_iamRoles)
     {
       ss << "IamRoles.member." << iamRolesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       iamRolesCount++;
     }
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
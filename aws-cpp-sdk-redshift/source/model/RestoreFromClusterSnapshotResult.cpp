@@ -40,7 +40,7 @@ RestoreFromClusterSnapshotResult& RestoreFromClusterSnapshotResult::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RestoreFromClusterSnapshotResult")
+  if (rootNode.GetNameView() != "RestoreFromClusterSnapshotResult")
   {
     resultNode = rootNode.FirstChild("RestoreFromClusterSnapshotResult");
   }
@@ -69,37 +69,37 @@ RestoreStatus& RestoreStatus::operator =(const XmlNode& xmlNode)
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode currentRestoreRateInMegaBytesPerSecondNode = resultNode.FirstChild("CurrentRestoreRateInMegaBytesPerSecond");
     if(!currentRestoreRateInMegaBytesPerSecondNode.IsNull())
     {
-      m_currentRestoreRateInMegaBytesPerSecond = StringUtils::ConvertToDouble(StringUtils::Trim(currentRestoreRateInMegaBytesPerSecondNode.GetText().c_str()).c_str());
+      m_currentRestoreRateInMegaBytesPerSecond = StringUtils::ConvertToDouble(currentRestoreRateInMegaBytesPerSecondNode.GetTextView().Trim().ToString().c_str());
       m_currentRestoreRateInMegaBytesPerSecondHasBeenSet = true;
     }
     XmlNode snapshotSizeInMegaBytesNode = resultNode.FirstChild("SnapshotSizeInMegaBytes");
     if(!snapshotSizeInMegaBytesNode.IsNull())
     {
-      m_snapshotSizeInMegaBytes = StringUtils::ConvertToInt64(StringUtils::Trim(snapshotSizeInMegaBytesNode.GetText().c_str()).c_str());
+      m_snapshotSizeInMegaBytes = StringUtils::ConvertToInt64(snapshotSizeInMegaBytesNode.GetTextView().Trim().ToString().c_str());
       m_snapshotSizeInMegaBytesHasBeenSet = true;
     }
     XmlNode progressInMegaBytesNode = resultNode.FirstChild("ProgressInMegaBytes");
     if(!progressInMegaBytesNode.IsNull())
     {
-      m_progressInMegaBytes = StringUtils::ConvertToInt64(StringUtils::Trim(progressInMegaBytesNode.GetText().c_str()).c_str());
+      m_progressInMegaBytes = StringUtils::ConvertToInt64(progressInMegaBytesNode.GetTextView().Trim().ToString().c_str());
       m_progressInMegaBytesHasBeenSet = true;
     }
     XmlNode elapsedTimeInSecondsNode = resultNode.FirstChild("ElapsedTimeInSeconds");
     if(!elapsedTimeInSecondsNode.IsNull())
     {
-      m_elapsedTimeInSeconds = StringUtils::ConvertToInt64(StringUtils::Trim(elapsedTimeInSecondsNode.GetText().c_str()).c_str());
+      m_elapsedTimeInSeconds = StringUtils::ConvertToInt64(elapsedTimeInSecondsNode.GetTextView().Trim().ToString().c_str());
       m_elapsedTimeInSecondsHasBeenSet = true;
     }
     XmlNode estimatedTimeToCompletionInSecondsNode = resultNode.FirstChild("EstimatedTimeToCompletionInSeconds");
     if(!estimatedTimeToCompletionInSecondsNode.IsNull())
     {
-      m_estimatedTimeToCompletionInSeconds = StringUtils::ConvertToInt64(StringUtils::Trim(estimatedTimeToCompletionInSecondsNode.GetText().c_str()).c_str());
+      m_estimatedTimeToCompletionInSeconds = StringUtils::ConvertToInt64(estimatedTimeToCompletionInSecondsNode.GetTextView().Trim().ToString().c_str());
       m_estimatedTimeToCompletionInSecondsHasBeenSet = true;
     }
   }
@@ -111,7 +111,7 @@ void RestoreStatus::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_currentRestoreRateInMegaBytesPerSecondHasBeenSet)
@@ -145,7 +145,7 @@ void RestoreStatus::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_currentRestoreRateInMegaBytesPerSecondHasBeenSet)
   {
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/RestoreTableFromClusterSnapshotRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -33,49 +34,49 @@ RestoreTableFromClusterSnapshotRequest::RestoreTableFromClusterSnapshotRequest()
 
 Aws::String RestoreTableFromClusterSnapshotRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=RestoreTableFromClusterSnapshot&";
   if(m_clusterIdentifierHasBeenSet)
   {
-    ss << "ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+    ss << "ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
 
   if(m_snapshotIdentifierHasBeenSet)
   {
-    ss << "SnapshotIdentifier=" << StringUtils::URLEncode(m_snapshotIdentifier.c_str()) << "&";
+    ss << "SnapshotIdentifier=" << StringUtils::URLEncoded(m_snapshotIdentifier) << "&";
   }
 
   if(m_sourceDatabaseNameHasBeenSet)
   {
-    ss << "SourceDatabaseName=" << StringUtils::URLEncode(m_sourceDatabaseName.c_str()) << "&";
+    ss << "SourceDatabaseName=" << StringUtils::URLEncoded(m_sourceDatabaseName) << "&";
   }
 
   if(m_sourceSchemaNameHasBeenSet)
   {
-    ss << "SourceSchemaName=" << StringUtils::URLEncode(m_sourceSchemaName.c_str()) << "&";
+    ss << "SourceSchemaName=" << StringUtils::URLEncoded(m_sourceSchemaName) << "&";
   }
 
   if(m_sourceTableNameHasBeenSet)
   {
-    ss << "SourceTableName=" << StringUtils::URLEncode(m_sourceTableName.c_str()) << "&";
+    ss << "SourceTableName=" << StringUtils::URLEncoded(m_sourceTableName) << "&";
   }
 
   if(m_targetDatabaseNameHasBeenSet)
   {
-    ss << "TargetDatabaseName=" << StringUtils::URLEncode(m_targetDatabaseName.c_str()) << "&";
+    ss << "TargetDatabaseName=" << StringUtils::URLEncoded(m_targetDatabaseName) << "&";
   }
 
   if(m_targetSchemaNameHasBeenSet)
   {
-    ss << "TargetSchemaName=" << StringUtils::URLEncode(m_targetSchemaName.c_str()) << "&";
+    ss << "TargetSchemaName=" << StringUtils::URLEncoded(m_targetSchemaName) << "&";
   }
 
   if(m_newTableNameHasBeenSet)
   {
-    ss << "NewTableName=" << StringUtils::URLEncode(m_newTableName.c_str()) << "&";
+    ss << "NewTableName=" << StringUtils::URLEncoded(m_newTableName) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
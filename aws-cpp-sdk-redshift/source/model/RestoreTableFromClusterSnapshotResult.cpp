@@ -40,7 +40,7 @@ RestoreTableFromClusterSnapshotResult& RestoreTableFromClusterSnapshotResult::op
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RestoreTableFromClusterSnapshotResult")
+  if (rootNode.GetNameView() != "RestoreTableFromClusterSnapshotResult")
   {
     resultNode = rootNode.FirstChild("RestoreTableFromClusterSnapshotResult");
   }
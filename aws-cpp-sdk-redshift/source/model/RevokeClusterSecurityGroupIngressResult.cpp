@@ -40,7 +40,7 @@ RevokeClusterSecurityGroupIngressResult& RevokeClusterSecurityGroupIngressResult
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RevokeClusterSecurityGroupIngressResult")
+  if (rootNode.GetNameView() != "RevokeClusterSecurityGroupIngressResult")
   {
     resultNode = rootNode.FirstChild("RevokeClusterSecurityGroupIngressResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/redshift/model/RevokeSnapshotAccessRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::Redshift::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ RevokeSnapshotAccessRequest::RevokeSnapshotAccessRequest() :
 
 Aws::String RevokeSnapshotAccessRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=RevokeSnapshotAccess&";
   if(m_snapshotIdentifierHasBeenSet)
   {
-    ss << "SnapshotIdentifier=" << StringUtils::URLEncode(m_snapshotIdentifier.c_str()) << "&";
+    ss << "SnapshotIdentifier=" << StringUtils::URLEncoded(m_snapshotIdentifier) << "&";
   }
 
   if(m_snapshotClusterIdentifierHasBeenSet)
   {
-    ss << "SnapshotClusterIdentifier=" << StringUtils::URLEncode(m_snapshotClusterIdentifier.c_str()) << "&";
+    ss << "SnapshotClusterIdentifier=" << StringUtils::URLEncoded(m_snapshotClusterIdentifier) << "&";
   }
 
   if(m_accountWithRestoreAccessHasBeenSet)
   {
-    ss << "AccountWithRestoreAccess=" << StringUtils::URLEncode(m_accountWithRestoreAccess.c_str()) << "&";
+    ss << "AccountWithRestoreAccess=" << StringUtils::URLEncoded(m_accountWithRestoreAccess) << "&";
   }
 
   ss << "Version=2012-12-01";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ RevokeSnapshotAccessResult& RevokeSnapshotAccessResult::operator =(const AmazonW
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RevokeSnapshotAccessResult")
+  if (rootNode.GetNameView() != "RevokeSnapshotAccessResult")
   {
     resultNode = rootNode.FirstChild("RevokeSnapshotAccessResult");
   }
@@ -40,7 +40,7 @@ RotateEncryptionKeyResult& RotateEncryptionKeyResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "RotateEncryptionKeyResult")
+  if (rootNode.GetNameView() != "RotateEncryptionKeyResult")
   {
     resultNode = rootNode.FirstChild("RotateEncryptionKeyResult");
   }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -123,103 +124,103 @@ Snapshot& Snapshot::operator =(const XmlNode& xmlNode)
     XmlNode snapshotIdentifierNode = resultNode.FirstChild("SnapshotIdentifier");
     if(!snapshotIdentifierNode.IsNull())
     {
-      m_snapshotIdentifier = StringUtils::Trim(snapshotIdentifierNode.GetText().c_str());
+      m_snapshotIdentifier = snapshotIdentifierNode.GetTextView().Trim().ToString();
       m_snapshotIdentifierHasBeenSet = true;
     }
     XmlNode clusterIdentifierNode = resultNode.FirstChild("ClusterIdentifier");
     if(!clusterIdentifierNode.IsNull())
     {
-      m_clusterIdentifier = StringUtils::Trim(clusterIdentifierNode.GetText().c_str());
+      m_clusterIdentifier = clusterIdentifierNode.GetTextView().Trim().ToString();
       m_clusterIdentifierHasBeenSet = true;
     }
     XmlNode snapshotCreateTimeNode = resultNode.FirstChild("SnapshotCreateTime");
     if(!snapshotCreateTimeNode.IsNull())
     {
-      m_snapshotCreateTime = DateTime(StringUtils::Trim(snapshotCreateTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_snapshotCreateTime = DateTime(snapshotCreateTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_snapshotCreateTimeHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode portNode = resultNode.FirstChild("Port");
     if(!portNode.IsNull())
     {
-      m_port = StringUtils::ConvertToInt32(StringUtils::Trim(portNode.GetText().c_str()).c_str());
+      m_port = StringUtils::ConvertToInt32(portNode.GetTextView().Trim().ToString().c_str());
       m_portHasBeenSet = true;
     }
     XmlNode availabilityZoneNode = resultNode.FirstChild("AvailabilityZone");
     if(!availabilityZoneNode.IsNull())
     {
-      m_availabilityZone = StringUtils::Trim(availabilityZoneNode.GetText().c_str());
+      m_availabilityZone = availabilityZoneNode.GetTextView().Trim().ToString();
       m_availabilityZoneHasBeenSet = true;
     }
     XmlNode clusterCreateTimeNode = resultNode.FirstChild("ClusterCreateTime");
     if(!clusterCreateTimeNode.IsNull())
     {
-      m_clusterCreateTime = DateTime(StringUtils::Trim(clusterCreateTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_clusterCreateTime = DateTime(clusterCreateTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_clusterCreateTimeHasBeenSet = true;
     }
     XmlNode masterUsernameNode = resultNode.FirstChild("MasterUsername");
     if(!masterUsernameNode.IsNull())
     {
-      m_masterUsername = StringUtils::Trim(masterUsernameNode.GetText().c_str());
+      m_masterUsername = masterUsernameNode.GetTextView().Trim().ToString();
       m_masterUsernameHasBeenSet = true;
     }
     XmlNode clusterVersionNode = resultNode.FirstChild("ClusterVersion");
     if(!clusterVersionNode.IsNull())
     {
-      m_clusterVersion = StringUtils::Trim(clusterVersionNode.GetText().c_str());
+      m_clusterVersion = clusterVersionNode.GetTextView().Trim().ToString();
       m_clusterVersionHasBeenSet = true;
     }
     XmlNode snapshotTypeNode = resultNode.FirstChild("SnapshotType");
     if(!snapshotTypeNode.IsNull())
     {
-      m_snapshotType = StringUtils::Trim(snapshotTypeNode.GetText().c_str());
+      m_snapshotType = snapshotTypeNode.GetTextView().Trim().ToString();
       m_snapshotTypeHasBeenSet = true;
     }
     XmlNode nodeTypeNode = resultNode.FirstChild("NodeType");
     if(!nodeTypeNode.IsNull())
     {
-      m_nodeType = StringUtils::Trim(nodeTypeNode.GetText().c_str());
+      m_nodeType = nodeTypeNode.GetTextView().Trim().ToString();
       m_nodeTypeHasBeenSet = true;
     }
     XmlNode numberOfNodesNode = resultNode.FirstChild("NumberOfNodes");
     if(!numberOfNodesNode.IsNull())
     {
-      m_numberOfNodes = StringUtils::ConvertToInt32(StringUtils::Trim(numberOfNodesNode.GetText().c_str()).c_str());
+      m_numberOfNodes = StringUtils::ConvertToInt32(numberOfNodesNode.GetTextView().Trim().ToString().c_str());
       m_numberOfNodesHasBeenSet = true;
     }
     XmlNode dBNameNode = resultNode.FirstChild("DBName");
     if(!dBNameNode.IsNull())
     {
-      m_dBName = StringUtils::Trim(dBNameNode.GetText().c_str());
+      m_dBName = dBNameNode.GetTextView().Trim().ToString();
       m_dBNameHasBeenSet = true;
     }
     XmlNode vpcIdNode = resultNode.FirstChild("VpcId");
     if(!vpcIdNode.IsNull())
     {
-      m_vpcId = StringUtils::Trim(vpcIdNode.GetText().c_str());
+      m_vpcId = vpcIdNode.GetTextView().Trim().ToString();
       m_vpcIdHasBeenSet = true;
     }
     XmlNode encryptedNode = resultNode.FirstChild("Encrypted");
     if(!encryptedNode.IsNull())
     {
-      m_encrypted = StringUtils::ConvertToBool(StringUtils::Trim(encryptedNode.GetText().c_str()).c_str());
+      m_encrypted = StringUtils::ConvertToBool(encryptedNode.GetTextView().Trim().ToString().c_str());
       m_encryptedHasBeenSet = true;
     }
     XmlNode kmsKeyIdNode = resultNode.FirstChild("KmsKeyId");
     if(!kmsKeyIdNode.IsNull())
     {
-      m_kmsKeyId = StringUtils::Trim(kmsKeyIdNode.GetText().c_str());
+      m_kmsKeyId = kmsKeyIdNode.GetTextView().Trim().ToString();
       m_kmsKeyIdHasBeenSet = true;
     }
     XmlNode encryptedWithHSMNode = resultNode.FirstChild("EncryptedWithHSM");
     if(!encryptedWithHSMNode.IsNull())
     {
-      m_encryptedWithHSM = StringUtils::ConvertToBool(StringUtils::Trim(encryptedWithHSMNode.GetText().c_str()).c_str());
+      m_encryptedWithHSM = StringUtils::ConvertToBool(encryptedWithHSMNode.GetTextView().Trim().ToString().c_str());
       m_encryptedWithHSMHasBeenSet = true;
     }
     XmlNode accountsWithRestoreAccessNode = resultNode.FirstChild("AccountsWithRestoreAccess");
@@ -237,49 +238,49 @@ Snapshot& Snapshot::operator =(const XmlNode& xmlNode)
     XmlNode ownerAccountNode = resultNode.FirstChild("OwnerAccount");
     if(!ownerAccountNode.IsNull())
     {
-      m_ownerAccount = StringUtils::Trim(ownerAccountNode.GetText().c_str());
+      m_ownerAccount = ownerAccountNode.GetTextView().Trim().ToString();
       m_ownerAccountHasBeenSet = true;
     }
     XmlNode totalBackupSizeInMegaBytesNode = resultNode.FirstChild("TotalBackupSizeInMegaBytes");
     if(!totalBackupSizeInMegaBytesNode.IsNull())
     {
-      m_totalBackupSizeInMegaBytes = StringUtils::ConvertToDouble(StringUtils::Trim(totalBackupSizeInMegaBytesNode.GetText().c_str()).c_str());
+      m_totalBackupSizeInMegaBytes = StringUtils::ConvertToDouble(totalBackupSizeInMegaBytesNode.GetTextView().Trim().ToString().c_str());
       m_totalBackupSizeInMegaBytesHasBeenSet = true;
     }
     XmlNode actualIncrementalBackupSizeInMegaBytesNode = resultNode.FirstChild("ActualIncrementalBackupSizeInMegaBytes");
     if(!actualIncrementalBackupSizeInMegaBytesNode.IsNull())
     {
-      m_actualIncrementalBackupSizeInMegaBytes = StringUtils::ConvertToDouble(StringUtils::Trim(actualIncrementalBackupSizeInMegaBytesNode.GetText().c_str()).c_str());
+      m_actualIncrementalBackupSizeInMegaBytes = StringUtils::ConvertToDouble(actualIncrementalBackupSizeInMegaBytesNode.GetTextView().Trim().ToString().c_str());
       m_actualIncrementalBackupSizeInMegaBytesHasBeenSet = true;
     }
     XmlNode backupProgressInMegaBytesNode = resultNode.FirstChild("BackupProgressInMegaBytes");
     if(!backupProgressInMegaBytesNode.IsNull())
     {
-      m_backupProgressInMegaBytes = StringUtils::ConvertToDouble(StringUtils::Trim(backupProgressInMegaBytesNode.GetText().c_str()).c_str());
+      m_backupProgressInMegaBytes = StringUtils::ConvertToDouble(backupProgressInMegaBytesNode.GetTextView().Trim().ToString().c_str());
       m_backupProgressInMegaBytesHasBeenSet = true;
     }
     XmlNode currentBackupRateInMegaBytesPerSecondNode = resultNode.FirstChild("CurrentBackupRateInMegaBytesPerSecond");
     if(!currentBackupRateInMegaBytesPerSecondNode.IsNull())
     {
-      m_currentBackupRateInMegaBytesPerSecond = StringUtils::ConvertToDouble(StringUtils::Trim(currentBackupRateInMegaBytesPerSecondNode.GetText().c_str()).c_str());
+      m_currentBackupRateInMegaBytesPerSecond = StringUtils::ConvertToDouble(currentBackupRateInMegaBytesPerSecondNode.GetTextView().Trim().ToString().c_str());
       m_currentBackupRateInMegaBytesPerSecondHasBeenSet = true;
     }
     XmlNode estimatedSecondsToCompletionNode = resultNode.FirstChild("EstimatedSecondsToCompletion");
     if(!estimatedSecondsToCompletionNode.IsNull())
     {
-      m_estimatedSecondsToCompletion = StringUtils::ConvertToInt64(StringUtils::Trim(estimatedSecondsToCompletionNode.GetText().c_str()).c_str());
+      m_estimatedSecondsToCompletion = StringUtils::ConvertToInt64(estimatedSecondsToCompletionNode.GetTextView().Trim().ToString().c_str());
       m_estimatedSecondsToCompletionHasBeenSet = true;
     }
     XmlNode elapsedTimeInSecondsNode = resultNode.FirstChild("ElapsedTimeInSeconds");
     if(!elapsedTimeInSecondsNode.IsNull())
     {
-      m_elapsedTimeInSeconds = StringUtils::ConvertToInt64(StringUtils::Trim(elapsedTimeInSecondsNode.GetText().c_str()).c_str());
+      m_elapsedTimeInSeconds = StringUtils::ConvertToInt64(elapsedTimeInSecondsNode.GetTextView().Trim().ToString().c_str());
       m_elapsedTimeInSecondsHasBeenSet = true;
     }
     XmlNode sourceRegionNode = resultNode.FirstChild("SourceRegion");
     if(!sourceRegionNode.IsNull())
     {
-      m_sourceRegion = StringUtils::Trim(sourceRegionNode.GetText().c_str());
+      m_sourceRegion = sourceRegionNode.GetTextView().Trim().ToString();
       m_sourceRegionHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("Tags");
@@ -300,7 +301,7 @@ Snapshot& Snapshot::operator =(const XmlNode& xmlNode)
       XmlNode restorableNodeTypesMember = restorableNodeTypesNode.FirstChild("NodeType");
       while(!restorableNodeTypesMember.IsNull())
       {
-        m_restorableNodeTypes.push_back(StringUtils::Trim(restorableNodeTypesMember.GetText().c_str()));
+        m_restorableNodeTypes.push_back(restorableNodeTypesMember.GetTextView().Trim().ToString());
         restorableNodeTypesMember = restorableNodeTypesMember.NextNode("NodeType");
       }
 
@@ -315,22 +316,22 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 {
   if(m_snapshotIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotIdentifier=" << StringUtils::URLEncode(m_snapshotIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotIdentifier=" << StringUtils::URLEncoded(m_snapshotIdentifier) << "&";
   }
 
   if(m_clusterIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
 
   if(m_snapshotCreateTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotCreateTime=" << StringUtils::URLEncode(m_snapshotCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotCreateTime=" << StringUtils::URLEncoded(m_snapshotCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
   if(m_portHasBeenSet)
@@ -340,32 +341,32 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << index << locationValue << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
 
   if(m_clusterCreateTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterCreateTime=" << StringUtils::URLEncode(m_clusterCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterCreateTime=" << StringUtils::URLEncoded(m_clusterCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_masterUsernameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MasterUsername=" << StringUtils::URLEncode(m_masterUsername.c_str()) << "&";
+      oStream << location << index << locationValue << ".MasterUsername=" << StringUtils::URLEncoded(m_masterUsername) << "&";
   }
 
   if(m_clusterVersionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterVersion=" << StringUtils::URLEncode(m_clusterVersion.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterVersion=" << StringUtils::URLEncoded(m_clusterVersion) << "&";
   }
 
   if(m_snapshotTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotType=" << StringUtils::URLEncode(m_snapshotType.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotType=" << StringUtils::URLEncoded(m_snapshotType) << "&";
   }
 
   if(m_nodeTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NodeType=" << StringUtils::URLEncode(m_nodeType.c_str()) << "&";
+      oStream << location << index << locationValue << ".NodeType=" << StringUtils::URLEncoded(m_nodeType) << "&";
   }
 
   if(m_numberOfNodesHasBeenSet)
@@ -375,12 +376,12 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_dBNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DBName=" << StringUtils::URLEncode(m_dBName.c_str()) << "&";
+      oStream << location << index << locationValue << ".DBName=" << StringUtils::URLEncoded(m_dBName) << "&";
   }
 
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
 
   if(m_encryptedHasBeenSet)
@@ -390,7 +391,7 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_kmsKeyIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+      oStream << location << index << locationValue << ".KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
 
   if(m_encryptedWithHSMHasBeenSet)
@@ -403,15 +404,15 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location, unsig
       unsigned accountsWithRestoreAccessIdx = 1;
       for(auto& item : m_accountsWithRestoreAccess)
       {
-        Aws::StringStream accountsWithRestoreAccessSs;
+        Aws::Utils::Stream::StringOutputStream accountsWithRestoreAccessSs;
         accountsWithRestoreAccessSs << location << index << locationValue << ".AccountWithRestoreAccess." << accountsWithRestoreAccessIdx++;
-        item.OutputToStream(oStream, accountsWithRestoreAccessSs.str().c_str());
+        item.OutputToStream(oStream, accountsWithRestoreAccessSs.GetString().c_str());
       }
   }
 
   if(m_ownerAccountHasBeenSet)
   {
-      oStream << location << index << locationValue << ".OwnerAccount=" << StringUtils::URLEncode(m_ownerAccount.c_str()) << "&";
+      oStream << location << index << locationValue << ".OwnerAccount=" << StringUtils::URLEncoded(m_ownerAccount) << "&";
   }
 
   if(m_totalBackupSizeInMegaBytesHasBeenSet)
@@ -446,7 +447,7 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location, unsig
 
   if(m_sourceRegionHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceRegion=" << StringUtils::URLEncode(m_sourceRegion.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceRegion=" << StringUtils::URLEncoded(m_sourceRegion) << "&";
   }
 
   if(m_tagsHasBeenSet)
@@ -454,9 +455,9 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location, unsig
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location << index << locationValue << ".Tag." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
 
@@ -465,7 +466,7 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location, unsig
       unsigned restorableNodeTypesIdx = 1;
       for(auto& item : m_restorableNodeTypes)
       {
-        oStream << location << index << locationValue << ".NodeType." << restorableNodeTypesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".NodeType." << restorableNodeTypesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -475,19 +476,19 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_snapshotIdentifierHasBeenSet)
   {
-      oStream << location << ".SnapshotIdentifier=" << StringUtils::URLEncode(m_snapshotIdentifier.c_str()) << "&";
+      oStream << location << ".SnapshotIdentifier=" << StringUtils::URLEncoded(m_snapshotIdentifier) << "&";
   }
   if(m_clusterIdentifierHasBeenSet)
   {
-      oStream << location << ".ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+      oStream << location << ".ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
   if(m_snapshotCreateTimeHasBeenSet)
   {
-      oStream << location << ".SnapshotCreateTime=" << StringUtils::URLEncode(m_snapshotCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".SnapshotCreateTime=" << StringUtils::URLEncoded(m_snapshotCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
   if(m_portHasBeenSet)
   {
@@ -495,27 +496,27 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_availabilityZoneHasBeenSet)
   {
-      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncode(m_availabilityZone.c_str()) << "&";
+      oStream << location << ".AvailabilityZone=" << StringUtils::URLEncoded(m_availabilityZone) << "&";
   }
   if(m_clusterCreateTimeHasBeenSet)
   {
-      oStream << location << ".ClusterCreateTime=" << StringUtils::URLEncode(m_clusterCreateTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".ClusterCreateTime=" << StringUtils::URLEncoded(m_clusterCreateTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_masterUsernameHasBeenSet)
   {
-      oStream << location << ".MasterUsername=" << StringUtils::URLEncode(m_masterUsername.c_str()) << "&";
+      oStream << location << ".MasterUsername=" << StringUtils::URLEncoded(m_masterUsername) << "&";
   }
   if(m_clusterVersionHasBeenSet)
   {
-      oStream << location << ".ClusterVersion=" << StringUtils::URLEncode(m_clusterVersion.c_str()) << "&";
+      oStream << location << ".ClusterVersion=" << StringUtils::URLEncoded(m_clusterVersion) << "&";
   }
   if(m_snapshotTypeHasBeenSet)
   {
-      oStream << location << ".SnapshotType=" << StringUtils::URLEncode(m_snapshotType.c_str()) << "&";
+      oStream << location << ".SnapshotType=" << StringUtils::URLEncoded(m_snapshotType) << "&";
   }
   if(m_nodeTypeHasBeenSet)
   {
-      oStream << location << ".NodeType=" << StringUtils::URLEncode(m_nodeType.c_str()) << "&";
+      oStream << location << ".NodeType=" << StringUtils::URLEncoded(m_nodeType) << "&";
   }
   if(m_numberOfNodesHasBeenSet)
   {
@@ -523,11 +524,11 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_dBNameHasBeenSet)
   {
-      oStream << location << ".DBName=" << StringUtils::URLEncode(m_dBName.c_str()) << "&";
+      oStream << location << ".DBName=" << StringUtils::URLEncoded(m_dBName) << "&";
   }
   if(m_vpcIdHasBeenSet)
   {
-      oStream << location << ".VpcId=" << StringUtils::URLEncode(m_vpcId.c_str()) << "&";
+      oStream << location << ".VpcId=" << StringUtils::URLEncoded(m_vpcId) << "&";
   }
   if(m_encryptedHasBeenSet)
   {
@@ -535,7 +536,7 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_kmsKeyIdHasBeenSet)
   {
-      oStream << location << ".KmsKeyId=" << StringUtils::URLEncode(m_kmsKeyId.c_str()) << "&";
+      oStream << location << ".KmsKeyId=" << StringUtils::URLEncoded(m_kmsKeyId) << "&";
   }
   if(m_encryptedWithHSMHasBeenSet)
   {
@@ -546,14 +547,14 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned accountsWithRestoreAccessIdx = 1;
       for(auto& item : m_accountsWithRestoreAccess)
       {
-        Aws::StringStream accountsWithRestoreAccessSs;
+        Aws::Utils::Stream::StringOutputStream accountsWithRestoreAccessSs;
         accountsWithRestoreAccessSs << location <<  ".AccountWithRestoreAccess." << accountsWithRestoreAccessIdx++;
-        item.OutputToStream(oStream, accountsWithRestoreAccessSs.str().c_str());
+        item.OutputToStream(oStream, accountsWithRestoreAccessSs.GetString().c_str());
       }
   }
   if(m_ownerAccountHasBeenSet)
   {
-      oStream << location << ".OwnerAccount=" << StringUtils::URLEncode(m_ownerAccount.c_str()) << "&";
+      oStream << location << ".OwnerAccount=" << StringUtils::URLEncoded(m_ownerAccount) << "&";
   }
   if(m_totalBackupSizeInMegaBytesHasBeenSet)
   {
@@ -581,16 +582,16 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location) const
   }
   if(m_sourceRegionHasBeenSet)
   {
-      oStream << location << ".SourceRegion=" << StringUtils::URLEncode(m_sourceRegion.c_str()) << "&";
+      oStream << location << ".SourceRegion=" << StringUtils::URLEncoded(m_sourceRegion) << "&";
   }
   if(m_tagsHasBeenSet)
   {
       unsigned tagsIdx = 1;
       for(auto& item : m_tags)
       {
-        Aws::StringStream tagsSs;
+        Aws::Utils::Stream::StringOutputStream tagsSs;
         tagsSs << location <<  ".Tag." << tagsIdx++;
-        item.OutputToStream(oStream, tagsSs.str().c_str());
+        item.OutputToStream(oStream, tagsSs.GetString().c_str());
       }
   }
   if(m_restorableNodeTypesHasBeenSet)
@@ -598,7 +599,7 @@ void Snapshot::OutputToStream(Aws::OStream& oStream, const char* location) const
       unsigned restorableNodeTypesIdx = 1;
       for(auto& item : m_restorableNodeTypes)
       {
-        oStream << location << ".NodeType." << restorableNodeTypesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".NodeType." << restorableNodeTypesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 }
@@ -29,31 +29,35 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int cluster_HASH = HashingUtils::HashString("cluster");
-        static const int cluster_parameter_group_HASH = HashingUtils::HashString("cluster-parameter-group");
-        static const int cluster_security_group_HASH = HashingUtils::HashString("cluster-security-group");
-        static const int cluster_snapshot_HASH = HashingUtils::HashString("cluster-snapshot");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int cluster_HASH = 872092154;
+        static const int cluster_parameter_group_HASH = 1783921032;
+        static const int cluster_security_group_HASH = 1329347045;
+        static const int cluster_snapshot_HASH = -1482497993;
 
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == cluster_HASH)
+          switch (hashCode)
           {
+          case cluster_HASH:
             return SourceType::cluster;
-          }
-          else if (hashCode == cluster_parameter_group_HASH)
-          {
+          case cluster_parameter_group_HASH:
             return SourceType::cluster_parameter_group;
-          }
-          else if (hashCode == cluster_security_group_HASH)
-          {
+          case cluster_security_group_HASH:
             return SourceType::cluster_security_group;
-          }
-          else if (hashCode == cluster_snapshot_HASH)
-          {
+          case cluster_snapshot_HASH:
             return SourceType::cluster_snapshot;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
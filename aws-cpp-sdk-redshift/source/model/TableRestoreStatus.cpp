@@ -79,85 +79,85 @@ TableRestoreStatus& TableRestoreStatus::operator =(const XmlNode& xmlNode)
     XmlNode tableRestoreRequestIdNode = resultNode.FirstChild("TableRestoreRequestId");
     if(!tableRestoreRequestIdNode.IsNull())
     {
-      m_tableRestoreRequestId = StringUtils::Trim(tableRestoreRequestIdNode.GetText().c_str());
+      m_tableRestoreRequestId = tableRestoreRequestIdNode.GetTextView().Trim().ToString();
       m_tableRestoreRequestIdHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = TableRestoreStatusTypeMapper::GetTableRestoreStatusTypeForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = TableRestoreStatusTypeMapper::GetTableRestoreStatusTypeForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode messageNode = resultNode.FirstChild("Message");
     if(!messageNode.IsNull())
     {
-      m_message = StringUtils::Trim(messageNode.GetText().c_str());
+      m_message = messageNode.GetTextView().Trim().ToString();
       m_messageHasBeenSet = true;
     }
     XmlNode requestTimeNode = resultNode.FirstChild("RequestTime");
     if(!requestTimeNode.IsNull())
     {
-      m_requestTime = DateTime(StringUtils::Trim(requestTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_requestTime = DateTime(requestTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_requestTimeHasBeenSet = true;
     }
     XmlNode progressInMegaBytesNode = resultNode.FirstChild("ProgressInMegaBytes");
     if(!progressInMegaBytesNode.IsNull())
     {
-      m_progressInMegaBytes = StringUtils::ConvertToInt64(StringUtils::Trim(progressInMegaBytesNode.GetText().c_str()).c_str());
+      m_progressInMegaBytes = StringUtils::ConvertToInt64(progressInMegaBytesNode.GetTextView().Trim().ToString().c_str());
       m_progressInMegaBytesHasBeenSet = true;
     }
     XmlNode totalDataInMegaBytesNode = resultNode.FirstChild("TotalDataInMegaBytes");
     if(!totalDataInMegaBytesNode.IsNull())
     {
-      m_totalDataInMegaBytes = StringUtils::ConvertToInt64(StringUtils::Trim(totalDataInMegaBytesNode.GetText().c_str()).c_str());
+      m_totalDataInMegaBytes = StringUtils::ConvertToInt64(totalDataInMegaBytesNode.GetTextView().Trim().ToString().c_str());
       m_totalDataInMegaBytesHasBeenSet = true;
     }
     XmlNode clusterIdentifierNode = resultNode.FirstChild("ClusterIdentifier");
     if(!clusterIdentifierNode.IsNull())
     {
-      m_clusterIdentifier = StringUtils::Trim(clusterIdentifierNode.GetText().c_str());
+      m_clusterIdentifier = clusterIdentifierNode.GetTextView().Trim().ToString();
       m_clusterIdentifierHasBeenSet = true;
     }
     XmlNode snapshotIdentifierNode = resultNode.FirstChild("SnapshotIdentifier");
     if(!snapshotIdentifierNode.IsNull())
     {
-      m_snapshotIdentifier = StringUtils::Trim(snapshotIdentifierNode.GetText().c_str());
+      m_snapshotIdentifier = snapshotIdentifierNode.GetTextView().Trim().ToString();
       m_snapshotIdentifierHasBeenSet = true;
     }
     XmlNode sourceDatabaseNameNode = resultNode.FirstChild("SourceDatabaseName");
     if(!sourceDatabaseNameNode.IsNull())
     {
-      m_sourceDatabaseName = StringUtils::Trim(sourceDatabaseNameNode.GetText().c_str());
+      m_sourceDatabaseName = sourceDatabaseNameNode.GetTextView().Trim().ToString();
       m_sourceDatabaseNameHasBeenSet = true;
     }
     XmlNode sourceSchemaNameNode = resultNode.FirstChild("SourceSchemaName");
     if(!sourceSchemaNameNode.IsNull())
     {
-      m_sourceSchemaName = StringUtils::Trim(sourceSchemaNameNode.GetText().c_str());
+      m_sourceSchemaName = sourceSchemaNameNode.GetTextView().Trim().ToString();
       m_sourceSchemaNameHasBeenSet = true;
     }
     XmlNode sourceTableNameNode = resultNode.FirstChild("SourceTableName");
     if(!sourceTableNameNode.IsNull())
     {
-      m_sourceTableName = StringUtils::Trim(sourceTableNameNode.GetText().c_str());
+      m_sourceTableName = sourceTableNameNode.GetTextView().Trim().ToString();
       m_sourceTableNameHasBeenSet = true;
     }
     XmlNode targetDatabaseNameNode = resultNode.FirstChild("TargetDatabaseName");
     if(!targetDatabaseNameNode.IsNull())
     {
-      m_targetDatabaseName = StringUtils::Trim(targetDatabaseNameNode.GetText().c_str());
+      m_targetDatabaseName = targetDatabaseNameNode.GetTextView().Trim().ToString();
       m_targetDatabaseNameHasBeenSet = true;
     }
     XmlNode targetSchemaNameNode = resultNode.FirstChild("TargetSchemaName");
     if(!targetSchemaNameNode.IsNull())
     {
-      m_targetSchemaName = StringUtils::Trim(targetSchemaNameNode.GetText().c_str());
+      m_targetSchemaName = targetSchemaNameNode.GetTextView().Trim().ToString();
       m_targetSchemaNameHasBeenSet = true;
     }
     XmlNode newTableNameNode = resultNode.FirstChild("NewTableName");
     if(!newTableNameNode.IsNull())
     {
-      m_newTableName = StringUtils::Trim(newTableNameNode.GetText().c_str());
+      m_newTableName = newTableNameNode.GetTextView().Trim().ToString();
       m_newTableNameHasBeenSet = true;
     }
   }
@@ -169,7 +169,7 @@ void TableRestoreStatus::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_tableRestoreRequestIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TableRestoreRequestId=" << StringUtils::URLEncode(m_tableRestoreRequestId.c_str()) << "&";
+      oStream << location << index << locationValue << ".TableRestoreRequestId=" << StringUtils::URLEncoded(m_tableRestoreRequestId) << "&";
   }
 
   if(m_statusHasBeenSet)
@@ -179,12 +179,12 @@ void TableRestoreStatus::OutputToStream(Aws::OStream& oStream, const char* locat
 
   if(m_messageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 
   if(m_requestTimeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".RequestTime=" << StringUtils::URLEncode(m_requestTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".RequestTime=" << StringUtils::URLEncoded(m_requestTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
   if(m_progressInMegaBytesHasBeenSet)
@@ -199,42 +199,42 @@ void TableRestoreStatus::OutputToStream(Aws::OStream& oStream, const char* locat
 
   if(m_clusterIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
 
   if(m_snapshotIdentifierHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SnapshotIdentifier=" << StringUtils::URLEncode(m_snapshotIdentifier.c_str()) << "&";
+      oStream << location << index << locationValue << ".SnapshotIdentifier=" << StringUtils::URLEncoded(m_snapshotIdentifier) << "&";
   }
 
   if(m_sourceDatabaseNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceDatabaseName=" << StringUtils::URLEncode(m_sourceDatabaseName.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceDatabaseName=" << StringUtils::URLEncoded(m_sourceDatabaseName) << "&";
   }
 
   if(m_sourceSchemaNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceSchemaName=" << StringUtils::URLEncode(m_sourceSchemaName.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceSchemaName=" << StringUtils::URLEncoded(m_sourceSchemaName) << "&";
   }
 
   if(m_sourceTableNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SourceTableName=" << StringUtils::URLEncode(m_sourceTableName.c_str()) << "&";
+      oStream << location << index << locationValue << ".SourceTableName=" << StringUtils::URLEncoded(m_sourceTableName) << "&";
   }
 
   if(m_targetDatabaseNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TargetDatabaseName=" << StringUtils::URLEncode(m_targetDatabaseName.c_str()) << "&";
+      oStream << location << index << locationValue << ".TargetDatabaseName=" << StringUtils::URLEncoded(m_targetDatabaseName) << "&";
   }
 
   if(m_targetSchemaNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TargetSchemaName=" << StringUtils::URLEncode(m_targetSchemaName.c_str()) << "&";
+      oStream << location << index << locationValue << ".TargetSchemaName=" << StringUtils::URLEncoded(m_targetSchemaName) << "&";
   }
 
   if(m_newTableNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".NewTableName=" << StringUtils::URLEncode(m_newTableName.c_str()) << "&";
+      oStream << location << index << locationValue << ".NewTableName=" << StringUtils::URLEncoded(m_newTableName) << "&";
   }
 
 }
@@ -243,7 +243,7 @@ void TableRestoreStatus::OutputToStream(Aws::OStream& oStream, const char* locat
 {
   if(m_tableRestoreRequestIdHasBeenSet)
   {
-      oStream << location << ".TableRestoreRequestId=" << StringUtils::URLEncode(m_tableRestoreRequestId.c_str()) << "&";
+      oStream << location << ".TableRestoreRequestId=" << StringUtils::URLEncoded(m_tableRestoreRequestId) << "&";
   }
   if(m_statusHasBeenSet)
   {
@@ -251,11 +251,11 @@ void TableRestoreStatus::OutputToStream(Aws::OStream& oStream, const char* locat
   }
   if(m_messageHasBeenSet)
   {
-      oStream << location << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
   if(m_requestTimeHasBeenSet)
   {
-      oStream << location << ".RequestTime=" << StringUtils::URLEncode(m_requestTime.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".RequestTime=" << StringUtils::URLEncoded(m_requestTime.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
   if(m_progressInMegaBytesHasBeenSet)
   {
@@ -267,35 +267,35 @@ void TableRestoreStatus::OutputToStream(Aws::OStream& oStream, const char* locat
   }
   if(m_clusterIdentifierHasBeenSet)
   {
-      oStream << location << ".ClusterIdentifier=" << StringUtils::URLEncode(m_clusterIdentifier.c_str()) << "&";
+      oStream << location << ".ClusterIdentifier=" << StringUtils::URLEncoded(m_clusterIdentifier) << "&";
   }
   if(m_snapshotIdentifierHasBeenSet)
   {
-      oStream << location << ".SnapshotIdentifier=" << StringUtils::URLEncode(m_snapshotIdentifier.c_str()) << "&";
+      oStream << location << ".SnapshotIdentifier=" << StringUtils::URLEncoded(m_snapshotIdentifier) << "&";
   }
   if(m_sourceDatabaseNameHasBeenSet)
   {
-      oStream << location << ".SourceDatabaseName=" << StringUtils::URLEncode(m_sourceDatabaseName.c_str()) << "&";
+      oStream << location << ".SourceDatabaseName=" << StringUtils::URLEncoded(m_sourceDatabaseName) << "&";
   }
   if(m_sourceSchemaNameHasBeenSet)
   {
-      oStream << location << ".SourceSchemaName=" << StringUtils::URLEncode(m_sourceSchemaName.c_str()) << "&";
+      oStream << location << ".SourceSchemaName=" << StringUtils::URLEncoded(m_sourceSchemaName) << "&";
   }
   if(m_sourceTableNameHasBeenSet)
   {
-      oStream << location << ".SourceTableName=" << StringUtils::URLEncode(m_sourceTableName.c_str()) << "&";
+      oStream << location << ".SourceTableName=" << StringUtils::URLEncoded(m_sourceTableName) << "&";
   }
   if(m_targetDatabaseNameHasBeenSet)
   {
-      oStream << location << ".TargetDatabaseName=" << StringUtils::URLEncode(m_targetDatabaseName.c_str()) << "&";
+      oStream << location << ".TargetDatabaseName=" << StringUtils::URLEncoded(m_targetDatabaseName) << "&";
   }
   if(m_targetSchemaNameHasBeenSet)
   {
-      oStream << location << ".TargetSchemaName=" << StringUtils::URLEncode(m_targetSchemaName.c_str()) << "&";
+      oStream << location << ".TargetSchemaName=" << StringUtils::URLEncoded(m_targetSchemaName) << "&";
   }
   if(m_newTableNameHasBeenSet)
   {
-      oStream << location << ".NewTableName=" << StringUtils::URLEncode(m_newTableName.c_str()) << "&";
+      oStream << location << ".NewTableName=" << StringUtils::URLEncoded(m_newTableName) << "&";
   }
 }
 
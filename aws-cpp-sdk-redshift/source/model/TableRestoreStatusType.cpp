@@ -29,36 +29,38 @@ namespace Aws
       namespace TableRestoreStatusTypeMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PENDING_HASH = 35394935;
+        static const int IN_PROGRESS_HASH = -604548089;
+        static const int SUCCEEDED_HASH = -562638271;
+        static const int FAILED_HASH = 2066319421;
+        static const int CANCELED_HASH = 659453081;
 
 
         TableRestoreStatusType GetTableRestoreStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          switch (hashCode)
           {
+          case PENDING_HASH:
             return TableRestoreStatusType::PENDING;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
+          case IN_PROGRESS_HASH:
             return TableRestoreStatusType::IN_PROGRESS;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
+          case SUCCEEDED_HASH:
             return TableRestoreStatusType::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return TableRestoreStatusType::FAILED;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
+          case CANCELED_HASH:
             return TableRestoreStatusType::CANCELED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
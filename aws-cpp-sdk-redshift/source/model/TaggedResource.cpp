@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -59,13 +60,13 @@ TaggedResource& TaggedResource::operator =(const XmlNode& xmlNode)
     XmlNode resourceNameNode = resultNode.FirstChild("ResourceName");
     if(!resourceNameNode.IsNull())
     {
-      m_resourceName = StringUtils::Trim(resourceNameNode.GetText().c_str());
+      m_resourceName = resourceNameNode.GetTextView().Trim().ToString();
       m_resourceNameHasBeenSet = true;
     }
     XmlNode resourceTypeNode = resultNode.FirstChild("ResourceType");
     if(!resourceTypeNode.IsNull())
     {
-      m_resourceType = StringUtils::Trim(resourceTypeNode.GetText().c_str());
+      m_resourceType = resourceTypeNode.GetTextView().Trim().ToString();
       m_resourceTypeHasBeenSet = true;
     }
   }
@@ -77,19 +78,19 @@ void TaggedResource::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_tagHasBeenSet)
   {
-      Aws::StringStream tagLocationAndMemberSs;
+      Aws::Utils::Stream::StringOutputStream tagLocationAndMemberSs;
       tagLocationAndMemberSs << location << index << locationValue << ".Tag";
-      m_tag.OutputToStream(oStream, tagLocationAndMemberSs.str().c_str());
+      m_tag.OutputToStream(oStream, tagLocationAndMemberSs.GetString().c_str());
   }
 
   if(m_resourceNameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceName=" << StringUtils::URLEncode(m_resourceName.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceName=" << StringUtils::URLEncoded(m_resourceName) << "&";
   }
 
   if(m_resourceTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ResourceType=" << StringUtils::URLEncode(m_resourceType.c_str()) << "&";
+      oStream << location << index << locationValue << ".ResourceType=" << StringUtils::URLEncoded(m_resourceType) << "&";
   }
 
 }
@@ -104,11 +105,11 @@ void TaggedResource::OutputToStream(Aws::OStream& oStream, const char* location)
   }
   if(m_resourceNameHasBeenSet)
   {
-      oStream << location << ".ResourceName=" << StringUtils::URLEncode(m_resourceName.c_str()) << "&";
+      oStream << location << ".ResourceName=" << StringUtils::URLEncoded(m_resourceName) << "&";
   }
   if(m_resourceTypeHasBeenSet)
   {
-      oStream << location << ".ResourceType=" << StringUtils::URLEncode(m_resourceType.c_str()) << "&";
+      oStream << location << ".ResourceType=" << StringUtils::URLEncoded(m_resourceType) << "&";
   }
 }
 
@@ -51,13 +51,13 @@ VpcSecurityGroupMembership& VpcSecurityGroupMembership::operator =(const XmlNode
     XmlNode vpcSecurityGroupIdNode = resultNode.FirstChild("VpcSecurityGroupId");
     if(!vpcSecurityGroupIdNode.IsNull())
     {
-      m_vpcSecurityGroupId = StringUtils::Trim(vpcSecurityGroupIdNode.GetText().c_str());
+      m_vpcSecurityGroupId = vpcSecurityGroupIdNode.GetTextView().Trim().ToString();
       m_vpcSecurityGroupIdHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void VpcSecurityGroupMembership::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_vpcSecurityGroupIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".VpcSecurityGroupId=" << StringUtils::URLEncode(m_vpcSecurityGroupId.c_str()) << "&";
+      oStream << location << index << locationValue << ".VpcSecurityGroupId=" << StringUtils::URLEncoded(m_vpcSecurityGroupId) << "&";
   }
 
   if(m_statusHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << index << locationValue << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void VpcSecurityGroupMembership::OutputToStream(Aws::OStream& oStream, const cha
 {
   if(m_vpcSecurityGroupIdHasBeenSet)
   {
-      oStream << location << ".VpcSecurityGroupId=" << StringUtils::URLEncode(m_vpcSecurityGroupId.c_str()) << "&";
+      oStream << location << ".VpcSecurityGroupId=" << StringUtils::URLEncoded(m_vpcSecurityGroupId) << "&";
   }
   if(m_statusHasBeenSet)
   {
-      oStream << location << ".Status=" << StringUtils::URLEncode(m_status.c_str()) << "&";
+      oStream << location << ".Status=" << StringUtils::URLEncoded(m_status) << "&";
   }
 }
 
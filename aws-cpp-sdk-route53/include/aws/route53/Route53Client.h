@@ -66,6 +66,9 @@
 #include <aws/route53/model/UpdateTrafficPolicyCommentResult.h>
 #include <aws/route53/model/UpdateTrafficPolicyInstanceResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -369,6 +372,18 @@ namespace Model
          */
         virtual void AssociateVPCWithHostedZoneAsync(const Model::AssociateVPCWithHostedZoneRequest& request, const AssociateVPCWithHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssociateVPCWithHostedZoneCallable(const Model::AssociateVPCWithHostedZoneRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AssociateVPCWithHostedZoneOutcomeCallable AssociateVPCWithHostedZoneCallable(Model::AssociateVPCWithHostedZoneRequest&& request) const;
+
+        /**
+         * Same as AssociateVPCWithHostedZoneAsync(const Model::AssociateVPCWithHostedZoneRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AssociateVPCWithHostedZoneAsync(Model::AssociateVPCWithHostedZoneRequest&& request, const AssociateVPCWithHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Use this action to create or change your authoritative DNS information. To
          * use this action, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -454,6 +469,18 @@ namespace Model
          */
         virtual void ChangeResourceRecordSetsAsync(const Model::ChangeResourceRecordSetsRequest& request, const ChangeResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ChangeResourceRecordSetsCallable(const Model::ChangeResourceRecordSetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ChangeResourceRecordSetsOutcomeCallable ChangeResourceRecordSetsCallable(Model::ChangeResourceRecordSetsRequest&& request) const;
+
+        /**
+         * Same as ChangeResourceRecordSetsAsync(const Model::ChangeResourceRecordSetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ChangeResourceRecordSetsAsync(Model::ChangeResourceRecordSetsRequest&& request, const ChangeResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -473,6 +500,18 @@ namespace Model
          */
         virtual void ChangeTagsForResourceAsync(const Model::ChangeTagsForResourceRequest& request, const ChangeTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ChangeTagsForResourceCallable(const Model::ChangeTagsForResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ChangeTagsForResourceOutcomeCallable ChangeTagsForResourceCallable(Model::ChangeTagsForResourceRequest&& request) const;
+
+        /**
+         * Same as ChangeTagsForResourceAsync(const Model::ChangeTagsForResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ChangeTagsForResourceAsync(Model::ChangeTagsForResourceRequest&& request, const ChangeTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action creates a new health check.</p> <p>To create a new health check,
          * send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -507,6 +546,18 @@ namespace Model
          */
         virtual void CreateHealthCheckAsync(const Model::CreateHealthCheckRequest& request, const CreateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateHealthCheckCallable(const Model::CreateHealthCheckRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateHealthCheckOutcomeCallable CreateHealthCheckCallable(Model::CreateHealthCheckRequest&& request) const;
+
+        /**
+         * Same as CreateHealthCheckAsync(const Model::CreateHealthCheckRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateHealthCheckAsync(Model::CreateHealthCheckRequest&& request, const CreateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action creates a new hosted zone.</p> <p>To create a new hosted zone,
          * send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -577,6 +628,18 @@ namespace Model
          */
         virtual void CreateHostedZoneAsync(const Model::CreateHostedZoneRequest& request, const CreateHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateHostedZoneCallable(const Model::CreateHostedZoneRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateHostedZoneOutcomeCallable CreateHostedZoneCallable(Model::CreateHostedZoneRequest&& request) const;
+
+        /**
+         * Same as CreateHostedZoneAsync(const Model::CreateHostedZoneRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateHostedZoneAsync(Model::CreateHostedZoneRequest&& request, const CreateHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action creates a reusable delegationSet.</p> <p>To create a new reusable
          * delegationSet, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -617,6 +680,18 @@ namespace Model
          */
         virtual void CreateReusableDelegationSetAsync(const Model::CreateReusableDelegationSetRequest& request, const CreateReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateReusableDelegationSetCallable(const Model::CreateReusableDelegationSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateReusableDelegationSetOutcomeCallable CreateReusableDelegationSetCallable(Model::CreateReusableDelegationSetRequest&& request) const;
+
+        /**
+         * Same as CreateReusableDelegationSetAsync(const Model::CreateReusableDelegationSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateReusableDelegationSetAsync(Model::CreateReusableDelegationSetRequest&& request, const CreateReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a traffic policy, which you use to create multiple DNS resource
          * record sets for one domain name (such as example.com) or one subdomain name
@@ -657,6 +732,18 @@ namespace Model
          */
         virtual void CreateTrafficPolicyAsync(const Model::CreateTrafficPolicyRequest& request, const CreateTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTrafficPolicyCallable(const Model::CreateTrafficPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateTrafficPolicyOutcomeCallable CreateTrafficPolicyCallable(Model::CreateTrafficPolicyRequest&& request) const;
+
+        /**
+         * Same as CreateTrafficPolicyAsync(const Model::CreateTrafficPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateTrafficPolicyAsync(Model::CreateTrafficPolicyRequest&& request, const CreateTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates resource record sets in a specified hosted zone based on the settings
          * in a specified traffic policy version. In addition,
@@ -709,6 +796,18 @@ namespace Model
          */
         virtual void CreateTrafficPolicyInstanceAsync(const Model::CreateTrafficPolicyInstanceRequest& request, const CreateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTrafficPolicyInstanceCallable(const Model::CreateTrafficPolicyInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateTrafficPolicyInstanceOutcomeCallable CreateTrafficPolicyInstanceCallable(Model::CreateTrafficPolicyInstanceRequest&& request) const;
+
+        /**
+         * Same as CreateTrafficPolicyInstanceAsync(const Model::CreateTrafficPolicyInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateTrafficPolicyInstanceAsync(Model::CreateTrafficPolicyInstanceRequest&& request, const CreateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new version of an existing traffic policy. When you create a new
          * version of a traffic policy, you specify the ID of the traffic policy that you
@@ -758,6 +857,18 @@ namespace Model
          */
         virtual void CreateTrafficPolicyVersionAsync(const Model::CreateTrafficPolicyVersionRequest& request, const CreateTrafficPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTrafficPolicyVersionCallable(const Model::CreateTrafficPolicyVersionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateTrafficPolicyVersionOutcomeCallable CreateTrafficPolicyVersionCallable(Model::CreateTrafficPolicyVersionRequest&& request) const;
+
+        /**
+         * Same as CreateTrafficPolicyVersionAsync(const Model::CreateTrafficPolicyVersionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateTrafficPolicyVersionAsync(Model::CreateTrafficPolicyVersionRequest&& request, const CreateTrafficPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action deletes a health check. To delete a health check, send a
          * <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -807,6 +918,18 @@ namespace Model
          */
         virtual void DeleteHealthCheckAsync(const Model::DeleteHealthCheckRequest& request, const DeleteHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteHealthCheckCallable(const Model::DeleteHealthCheckRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteHealthCheckOutcomeCallable DeleteHealthCheckCallable(Model::DeleteHealthCheckRequest&& request) const;
+
+        /**
+         * Same as DeleteHealthCheckAsync(const Model::DeleteHealthCheckRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteHealthCheckAsync(Model::DeleteHealthCheckRequest&& request, const DeleteHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action deletes a hosted zone. To delete a hosted zone, send a
          * <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -853,6 +976,18 @@ namespace Model
          */
         virtual void DeleteHostedZoneAsync(const Model::DeleteHostedZoneRequest& request, const DeleteHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteHostedZoneCallable(const Model::DeleteHostedZoneRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteHostedZoneOutcomeCallable DeleteHostedZoneCallable(Model::DeleteHostedZoneRequest&& request) const;
+
+        /**
+         * Same as DeleteHostedZoneAsync(const Model::DeleteHostedZoneRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteHostedZoneAsync(Model::DeleteHostedZoneRequest&& request, const DeleteHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action deletes a reusable delegation set. To delete a reusable
          * delegation set, send a <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -896,6 +1031,18 @@ namespace Model
          */
         virtual void DeleteReusableDelegationSetAsync(const Model::DeleteReusableDelegationSetRequest& request, const DeleteReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteReusableDelegationSetCallable(const Model::DeleteReusableDelegationSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteReusableDelegationSetOutcomeCallable DeleteReusableDelegationSetCallable(Model::DeleteReusableDelegationSetRequest&& request) const;
+
+        /**
+         * Same as DeleteReusableDelegationSetAsync(const Model::DeleteReusableDelegationSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteReusableDelegationSetAsync(Model::DeleteReusableDelegationSetRequest&& request, const DeleteReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a traffic policy. To delete a traffic policy, send a
          * <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -921,6 +1068,18 @@ namespace Model
          */
         virtual void DeleteTrafficPolicyAsync(const Model::DeleteTrafficPolicyRequest& request, const DeleteTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTrafficPolicyCallable(const Model::DeleteTrafficPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTrafficPolicyOutcomeCallable DeleteTrafficPolicyCallable(Model::DeleteTrafficPolicyRequest&& request) const;
+
+        /**
+         * Same as DeleteTrafficPolicyAsync(const Model::DeleteTrafficPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTrafficPolicyAsync(Model::DeleteTrafficPolicyRequest&& request, const DeleteTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a traffic policy instance and all of the resource record sets that
          * Amazon Route 53 created when you created the instance.</p> <p>To delete a
@@ -958,6 +1117,18 @@ namespace Model
          */
         virtual void DeleteTrafficPolicyInstanceAsync(const Model::DeleteTrafficPolicyInstanceRequest& request, const DeleteTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTrafficPolicyInstanceCallable(const Model::DeleteTrafficPolicyInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTrafficPolicyInstanceOutcomeCallable DeleteTrafficPolicyInstanceCallable(Model::DeleteTrafficPolicyInstanceRequest&& request) const;
+
+        /**
+         * Same as DeleteTrafficPolicyInstanceAsync(const Model::DeleteTrafficPolicyInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTrafficPolicyInstanceAsync(Model::DeleteTrafficPolicyInstanceRequest&& request, const DeleteTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action disassociates a VPC from an hosted zone. </p> <p>To disassociate
          * a VPC to a hosted zone, send a <code>POST</code> request to the <code>/<i>Route
@@ -1004,6 +1175,18 @@ namespace Model
          */
         virtual void DisassociateVPCFromHostedZoneAsync(const Model::DisassociateVPCFromHostedZoneRequest& request, const DisassociateVPCFromHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisassociateVPCFromHostedZoneCallable(const Model::DisassociateVPCFromHostedZoneRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisassociateVPCFromHostedZoneOutcomeCallable DisassociateVPCFromHostedZoneCallable(Model::DisassociateVPCFromHostedZoneRequest&& request) const;
+
+        /**
+         * Same as DisassociateVPCFromHostedZoneAsync(const Model::DisassociateVPCFromHostedZoneRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisassociateVPCFromHostedZoneAsync(Model::DisassociateVPCFromHostedZoneRequest&& request, const DisassociateVPCFromHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action returns the current status of a change batch request. The status
          * is one of the following values:</p> <p>- <code>PENDING</code> indicates that the
@@ -1038,6 +1221,18 @@ namespace Model
          */
         virtual void GetChangeAsync(const Model::GetChangeRequest& request, const GetChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetChangeCallable(const Model::GetChangeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetChangeOutcomeCallable GetChangeCallable(Model::GetChangeRequest&& request) const;
+
+        /**
+         * Same as GetChangeAsync(const Model::GetChangeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetChangeAsync(Model::GetChangeRequest&& request, const GetChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a list of the IP ranges used by Amazon Route 53 health checkers
          * to check the health of your resources, send a <code>GET</code> request to the
@@ -1069,6 +1264,18 @@ namespace Model
          */
         virtual void GetCheckerIpRangesAsync(const Model::GetCheckerIpRangesRequest& request, const GetCheckerIpRangesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCheckerIpRangesCallable(const Model::GetCheckerIpRangesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetCheckerIpRangesOutcomeCallable GetCheckerIpRangesCallable(Model::GetCheckerIpRangesRequest&& request) const;
+
+        /**
+         * Same as GetCheckerIpRangesAsync(const Model::GetCheckerIpRangesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetCheckerIpRangesAsync(Model::GetCheckerIpRangesRequest&& request, const GetCheckerIpRangesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a single geo location, send a <code>GET</code> request to the
          * <code>/<i>Route 53 API version</i>/geolocation</code> resource with one of these
@@ -1094,6 +1301,18 @@ namespace Model
          */
         virtual void GetGeoLocationAsync(const Model::GetGeoLocationRequest& request, const GetGeoLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetGeoLocationCallable(const Model::GetGeoLocationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetGeoLocationOutcomeCallable GetGeoLocationCallable(Model::GetGeoLocationRequest&& request) const;
+
+        /**
+         * Same as GetGeoLocationAsync(const Model::GetGeoLocationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetGeoLocationAsync(Model::GetGeoLocationRequest&& request, const GetGeoLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve the health check, send a <code>GET</code> request to the
          * <code>/<i>Route 53 API version</i>/healthcheck/<i>health check ID</i></code>
@@ -1119,6 +1338,18 @@ namespace Model
          */
         virtual void GetHealthCheckAsync(const Model::GetHealthCheckRequest& request, const GetHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetHealthCheckCallable(const Model::GetHealthCheckRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetHealthCheckOutcomeCallable GetHealthCheckCallable(Model::GetHealthCheckRequest&& request) const;
+
+        /**
+         * Same as GetHealthCheckAsync(const Model::GetHealthCheckRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetHealthCheckAsync(Model::GetHealthCheckRequest&& request, const GetHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a count of all your health checks, send a <code>GET</code>
          * request to the <code>/<i>Route 53 API version</i>/healthcheckcount</code>
@@ -1144,6 +1375,18 @@ namespace Model
          */
         virtual void GetHealthCheckCountAsync(const Model::GetHealthCheckCountRequest& request, const GetHealthCheckCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetHealthCheckCountCallable(const Model::GetHealthCheckCountRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetHealthCheckCountOutcomeCallable GetHealthCheckCountCallable(Model::GetHealthCheckCountRequest&& request) const;
+
+        /**
+         * Same as GetHealthCheckCountAsync(const Model::GetHealthCheckCountRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetHealthCheckCountAsync(Model::GetHealthCheckCountRequest&& request, const GetHealthCheckCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>If you want to learn why a health check is currently failing or why it failed
          * most recently (if at all), you can get the failure reason for the most recent
@@ -1175,6 +1418,18 @@ namespace Model
          */
         virtual void GetHealthCheckLastFailureReasonAsync(const Model::GetHealthCheckLastFailureReasonRequest& request, const GetHealthCheckLastFailureReasonResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetHealthCheckLastFailureReasonCallable(const Model::GetHealthCheckLastFailureReasonRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetHealthCheckLastFailureReasonOutcomeCallable GetHealthCheckLastFailureReasonCallable(Model::GetHealthCheckLastFailureReasonRequest&& request) const;
+
+        /**
+         * Same as GetHealthCheckLastFailureReasonAsync(const Model::GetHealthCheckLastFailureReasonRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetHealthCheckLastFailureReasonAsync(Model::GetHealthCheckLastFailureReasonRequest&& request, const GetHealthCheckLastFailureReasonResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve the health check status, send a <code>GET</code> request to the
          * <code>/<i>Route 53 API version</i>/healthcheck/<i>health check
@@ -1203,6 +1458,18 @@ namespace Model
          */
         virtual void GetHealthCheckStatusAsync(const Model::GetHealthCheckStatusRequest& request, const GetHealthCheckStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetHealthCheckStatusCallable(const Model::GetHealthCheckStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetHealthCheckStatusOutcomeCallable GetHealthCheckStatusCallable(Model::GetHealthCheckStatusRequest&& request) const;
+
+        /**
+         * Same as GetHealthCheckStatusAsync(const Model::GetHealthCheckStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetHealthCheckStatusAsync(Model::GetHealthCheckStatusRequest&& request, const GetHealthCheckStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve the delegation set for a hosted zone, send a <code>GET</code>
          * request to the <code>/<i>Route 53 API version</i>/hostedzone/<i>hosted zone
@@ -1231,6 +1498,18 @@ namespace Model
          */
         virtual void GetHostedZoneAsync(const Model::GetHostedZoneRequest& request, const GetHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetHostedZoneCallable(const Model::GetHostedZoneRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetHostedZoneOutcomeCallable GetHostedZoneCallable(Model::GetHostedZoneRequest&& request) const;
+
+        /**
+         * Same as GetHostedZoneAsync(const Model::GetHostedZoneRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetHostedZoneAsync(Model::GetHostedZoneRequest&& request, const GetHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a count of all your hosted zones, send a <code>GET</code> request
          * to the <code>/<i>Route 53 API version</i>/hostedzonecount</code> resource.</p>
@@ -1253,6 +1532,18 @@ namespace Model
          */
         virtual void GetHostedZoneCountAsync(const Model::GetHostedZoneCountRequest& request, const GetHostedZoneCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetHostedZoneCountCallable(const Model::GetHostedZoneCountRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetHostedZoneCountOutcomeCallable GetHostedZoneCountCallable(Model::GetHostedZoneCountRequest&& request) const;
+
+        /**
+         * Same as GetHostedZoneCountAsync(const Model::GetHostedZoneCountRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetHostedZoneCountAsync(Model::GetHostedZoneCountRequest&& request, const GetHostedZoneCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve the reusable delegation set, send a <code>GET</code> request to
          * the <code>/<i>Route 53 API version</i>/delegationset/<i>delegation set
@@ -1278,6 +1569,18 @@ namespace Model
          */
         virtual void GetReusableDelegationSetAsync(const Model::GetReusableDelegationSetRequest& request, const GetReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetReusableDelegationSetCallable(const Model::GetReusableDelegationSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetReusableDelegationSetOutcomeCallable GetReusableDelegationSetCallable(Model::GetReusableDelegationSetRequest&& request) const;
+
+        /**
+         * Same as GetReusableDelegationSetAsync(const Model::GetReusableDelegationSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetReusableDelegationSetAsync(Model::GetReusableDelegationSetRequest&& request, const GetReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a specific traffic policy version. To get the
          * information, send a <code>GET</code> request to the <code>/<i>Route 53 API
@@ -1303,6 +1606,18 @@ namespace Model
          */
         virtual void GetTrafficPolicyAsync(const Model::GetTrafficPolicyRequest& request, const GetTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTrafficPolicyCallable(const Model::GetTrafficPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetTrafficPolicyOutcomeCallable GetTrafficPolicyCallable(Model::GetTrafficPolicyRequest&& request) const;
+
+        /**
+         * Same as GetTrafficPolicyAsync(const Model::GetTrafficPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetTrafficPolicyAsync(Model::GetTrafficPolicyRequest&& request, const GetTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a specified traffic policy instance.</p> <p>To get
          * information about the traffic policy instance, send a <code>GET</code> request
@@ -1343,6 +1658,18 @@ namespace Model
          */
         virtual void GetTrafficPolicyInstanceAsync(const Model::GetTrafficPolicyInstanceRequest& request, const GetTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTrafficPolicyInstanceCallable(const Model::GetTrafficPolicyInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetTrafficPolicyInstanceOutcomeCallable GetTrafficPolicyInstanceCallable(Model::GetTrafficPolicyInstanceRequest&& request) const;
+
+        /**
+         * Same as GetTrafficPolicyInstanceAsync(const Model::GetTrafficPolicyInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetTrafficPolicyInstanceAsync(Model::GetTrafficPolicyInstanceRequest&& request, const GetTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the number of traffic policy instances that are associated with the
          * current AWS account.</p> <p>To get the number of traffic policy instances, send
@@ -1371,6 +1698,18 @@ namespace Model
          */
         virtual void GetTrafficPolicyInstanceCountAsync(const Model::GetTrafficPolicyInstanceCountRequest& request, const GetTrafficPolicyInstanceCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTrafficPolicyInstanceCountCallable(const Model::GetTrafficPolicyInstanceCountRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetTrafficPolicyInstanceCountOutcomeCallable GetTrafficPolicyInstanceCountCallable(Model::GetTrafficPolicyInstanceCountRequest&& request) const;
+
+        /**
+         * Same as GetTrafficPolicyInstanceCountAsync(const Model::GetTrafficPolicyInstanceCountRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetTrafficPolicyInstanceCountAsync(Model::GetTrafficPolicyInstanceCountRequest&& request, const GetTrafficPolicyInstanceCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a list of supported geo locations, send a <code>GET</code>
          * request to the <code>/<i>Route 53 API version</i>/geolocations</code> resource.
@@ -1426,6 +1765,18 @@ namespace Model
          */
         virtual void ListGeoLocationsAsync(const Model::ListGeoLocationsRequest& request, const ListGeoLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListGeoLocationsCallable(const Model::ListGeoLocationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListGeoLocationsOutcomeCallable ListGeoLocationsCallable(Model::ListGeoLocationsRequest&& request) const;
+
+        /**
+         * Same as ListGeoLocationsAsync(const Model::ListGeoLocationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListGeoLocationsAsync(Model::ListGeoLocationsRequest&& request, const ListGeoLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a list of your health checks, send a <code>GET</code> request to
          * the <code>/<i>Route 53 API version</i>/healthcheck</code> resource. The response
@@ -1472,6 +1823,18 @@ namespace Model
          */
         virtual void ListHealthChecksAsync(const Model::ListHealthChecksRequest& request, const ListHealthChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListHealthChecksCallable(const Model::ListHealthChecksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListHealthChecksOutcomeCallable ListHealthChecksCallable(Model::ListHealthChecksRequest&& request) const;
+
+        /**
+         * Same as ListHealthChecksAsync(const Model::ListHealthChecksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListHealthChecksAsync(Model::ListHealthChecksRequest&& request, const ListHealthChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a list of your hosted zones, send a <code>GET</code> request to
          * the <code>/<i>Route 53 API version</i>/hostedzone</code> resource. The response
@@ -1518,6 +1881,18 @@ namespace Model
          */
         virtual void ListHostedZonesAsync(const Model::ListHostedZonesRequest& request, const ListHostedZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListHostedZonesCallable(const Model::ListHostedZonesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListHostedZonesOutcomeCallable ListHostedZonesCallable(Model::ListHostedZonesRequest&& request) const;
+
+        /**
+         * Same as ListHostedZonesAsync(const Model::ListHostedZonesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListHostedZonesAsync(Model::ListHostedZonesRequest&& request, const ListHostedZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a list of your hosted zones in lexicographic order, send a
          * <code>GET</code> request to the <code>/<i>Route 53 API
@@ -1567,6 +1942,18 @@ namespace Model
          */
         virtual void ListHostedZonesByNameAsync(const Model::ListHostedZonesByNameRequest& request, const ListHostedZonesByNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListHostedZonesByNameCallable(const Model::ListHostedZonesByNameRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListHostedZonesByNameOutcomeCallable ListHostedZonesByNameCallable(Model::ListHostedZonesByNameRequest&& request) const;
+
+        /**
+         * Same as ListHostedZonesByNameAsync(const Model::ListHostedZonesByNameRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListHostedZonesByNameAsync(Model::ListHostedZonesByNameRequest&& request, const ListHostedZonesByNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>List the resource record sets in a specified hosted zone. Send a GET request
          * to the <code>2013-04-01/hostedzone/<i>hosted zone ID</i>/rrset</code>
@@ -1667,6 +2054,18 @@ namespace Model
          */
         virtual void ListResourceRecordSetsAsync(const Model::ListResourceRecordSetsRequest& request, const ListResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListResourceRecordSetsCallable(const Model::ListResourceRecordSetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListResourceRecordSetsOutcomeCallable ListResourceRecordSetsCallable(Model::ListResourceRecordSetsRequest&& request) const;
+
+        /**
+         * Same as ListResourceRecordSetsAsync(const Model::ListResourceRecordSetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListResourceRecordSetsAsync(Model::ListResourceRecordSetsRequest&& request, const ListResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a list of your reusable delegation sets, send a <code>GET</code>
          * request to the <code>/<i>Route 53 API version</i>/delegationset</code> resource.
@@ -1713,6 +2112,18 @@ namespace Model
          */
         virtual void ListReusableDelegationSetsAsync(const Model::ListReusableDelegationSetsRequest& request, const ListReusableDelegationSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListReusableDelegationSetsCallable(const Model::ListReusableDelegationSetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListReusableDelegationSetsOutcomeCallable ListReusableDelegationSetsCallable(Model::ListReusableDelegationSetsRequest&& request) const;
+
+        /**
+         * Same as ListReusableDelegationSetsAsync(const Model::ListReusableDelegationSetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListReusableDelegationSetsAsync(Model::ListReusableDelegationSetsRequest&& request, const ListReusableDelegationSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -1732,6 +2143,18 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourceCallable(const Model::ListTagsForResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(Model::ListTagsForResourceRequest&& request) const;
+
+        /**
+         * Same as ListTagsForResourceAsync(const Model::ListTagsForResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsForResourceAsync(Model::ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -1751,6 +2174,18 @@ namespace Model
          */
         virtual void ListTagsForResourcesAsync(const Model::ListTagsForResourcesRequest& request, const ListTagsForResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourcesCallable(const Model::ListTagsForResourcesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsForResourcesOutcomeCallable ListTagsForResourcesCallable(Model::ListTagsForResourcesRequest&& request) const;
+
+        /**
+         * Same as ListTagsForResourcesAsync(const Model::ListTagsForResourcesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsForResourcesAsync(Model::ListTagsForResourcesRequest&& request, const ListTagsForResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the latest version for every traffic policy that is
          * associated with the current AWS account. To get the information, send a
@@ -1839,6 +2274,18 @@ namespace Model
          */
         virtual void ListTrafficPoliciesAsync(const Model::ListTrafficPoliciesRequest& request, const ListTrafficPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTrafficPoliciesCallable(const Model::ListTrafficPoliciesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTrafficPoliciesOutcomeCallable ListTrafficPoliciesCallable(Model::ListTrafficPoliciesRequest&& request) const;
+
+        /**
+         * Same as ListTrafficPoliciesAsync(const Model::ListTrafficPoliciesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTrafficPoliciesAsync(Model::ListTrafficPoliciesRequest&& request, const ListTrafficPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the traffic policy instances that you created by using
          * the current AWS account.</p> <note>After you submit an
@@ -1942,6 +2389,18 @@ namespace Model
          */
         virtual void ListTrafficPolicyInstancesAsync(const Model::ListTrafficPolicyInstancesRequest& request, const ListTrafficPolicyInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTrafficPolicyInstancesCallable(const Model::ListTrafficPolicyInstancesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTrafficPolicyInstancesOutcomeCallable ListTrafficPolicyInstancesCallable(Model::ListTrafficPolicyInstancesRequest&& request) const;
+
+        /**
+         * Same as ListTrafficPolicyInstancesAsync(const Model::ListTrafficPolicyInstancesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTrafficPolicyInstancesAsync(Model::ListTrafficPolicyInstancesRequest&& request, const ListTrafficPolicyInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the traffic policy instances that you created in a
          * specified hosted zone.</p> <note>After you submit an
@@ -2042,6 +2501,18 @@ namespace Model
          */
         virtual void ListTrafficPolicyInstancesByHostedZoneAsync(const Model::ListTrafficPolicyInstancesByHostedZoneRequest& request, const ListTrafficPolicyInstancesByHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTrafficPolicyInstancesByHostedZoneCallable(const Model::ListTrafficPolicyInstancesByHostedZoneRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTrafficPolicyInstancesByHostedZoneOutcomeCallable ListTrafficPolicyInstancesByHostedZoneCallable(Model::ListTrafficPolicyInstancesByHostedZoneRequest&& request) const;
+
+        /**
+         * Same as ListTrafficPolicyInstancesByHostedZoneAsync(const Model::ListTrafficPolicyInstancesByHostedZoneRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTrafficPolicyInstancesByHostedZoneAsync(Model::ListTrafficPolicyInstancesByHostedZoneRequest&& request, const ListTrafficPolicyInstancesByHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the traffic policy instances that you created by using
          * a specify traffic policy version.</p> <note>After you submit a
@@ -2154,6 +2625,18 @@ namespace Model
          */
         virtual void ListTrafficPolicyInstancesByPolicyAsync(const Model::ListTrafficPolicyInstancesByPolicyRequest& request, const ListTrafficPolicyInstancesByPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTrafficPolicyInstancesByPolicyCallable(const Model::ListTrafficPolicyInstancesByPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTrafficPolicyInstancesByPolicyOutcomeCallable ListTrafficPolicyInstancesByPolicyCallable(Model::ListTrafficPolicyInstancesByPolicyRequest&& request) const;
+
+        /**
+         * Same as ListTrafficPolicyInstancesByPolicyAsync(const Model::ListTrafficPolicyInstancesByPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTrafficPolicyInstancesByPolicyAsync(Model::ListTrafficPolicyInstancesByPolicyRequest&& request, const ListTrafficPolicyInstancesByPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about all of the versions for a specified traffic policy.
          * <code>ListTrafficPolicyVersions</code> lists only versions that have not been
@@ -2239,6 +2722,18 @@ namespace Model
          */
         virtual void ListTrafficPolicyVersionsAsync(const Model::ListTrafficPolicyVersionsRequest& request, const ListTrafficPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTrafficPolicyVersionsCallable(const Model::ListTrafficPolicyVersionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTrafficPolicyVersionsOutcomeCallable ListTrafficPolicyVersionsCallable(Model::ListTrafficPolicyVersionsRequest&& request) const;
+
+        /**
+         * Same as ListTrafficPolicyVersionsAsync(const Model::ListTrafficPolicyVersionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTrafficPolicyVersionsAsync(Model::ListTrafficPolicyVersionsRequest&& request, const ListTrafficPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action updates an existing health check.</p> <p>To update a health
          * check, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -2273,6 +2768,18 @@ namespace Model
          */
         virtual void UpdateHealthCheckAsync(const Model::UpdateHealthCheckRequest& request, const UpdateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateHealthCheckCallable(const Model::UpdateHealthCheckRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateHealthCheckOutcomeCallable UpdateHealthCheckCallable(Model::UpdateHealthCheckRequest&& request) const;
+
+        /**
+         * Same as UpdateHealthCheckAsync(const Model::UpdateHealthCheckRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateHealthCheckAsync(Model::UpdateHealthCheckRequest&& request, const UpdateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To update the hosted zone comment, send a <code>POST</code> request to the
          * <code>/<i>Route 53 API version</i>/hostedzone/<i>hosted zone ID</i></code>
@@ -2307,6 +2814,18 @@ namespace Model
          */
         virtual void UpdateHostedZoneCommentAsync(const Model::UpdateHostedZoneCommentRequest& request, const UpdateHostedZoneCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateHostedZoneCommentCallable(const Model::UpdateHostedZoneCommentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateHostedZoneCommentOutcomeCallable UpdateHostedZoneCommentCallable(Model::UpdateHostedZoneCommentRequest&& request) const;
+
+        /**
+         * Same as UpdateHostedZoneCommentAsync(const Model::UpdateHostedZoneCommentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateHostedZoneCommentAsync(Model::UpdateHostedZoneCommentRequest&& request, const UpdateHostedZoneCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the comment for a specified traffic policy version.</p> <p>To update
          * the comment, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -2335,6 +2854,18 @@ namespace Model
          */
         virtual void UpdateTrafficPolicyCommentAsync(const Model::UpdateTrafficPolicyCommentRequest& request, const UpdateTrafficPolicyCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateTrafficPolicyCommentCallable(const Model::UpdateTrafficPolicyCommentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateTrafficPolicyCommentOutcomeCallable UpdateTrafficPolicyCommentCallable(Model::UpdateTrafficPolicyCommentRequest&& request) const;
+
+        /**
+         * Same as UpdateTrafficPolicyCommentAsync(const Model::UpdateTrafficPolicyCommentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateTrafficPolicyCommentAsync(Model::UpdateTrafficPolicyCommentRequest&& request, const UpdateTrafficPolicyCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the resource record sets in a specified hosted zone that were created
          * based on the settings in a specified traffic policy version.</p> <important>The
@@ -2414,6 +2945,260 @@ namespace Model
          */
         virtual void UpdateTrafficPolicyInstanceAsync(const Model::UpdateTrafficPolicyInstanceRequest& request, const UpdateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateTrafficPolicyInstanceCallable(const Model::UpdateTrafficPolicyInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateTrafficPolicyInstanceOutcomeCallable UpdateTrafficPolicyInstanceCallable(Model::UpdateTrafficPolicyInstanceRequest&& request) const;
+
+        /**
+         * Same as UpdateTrafficPolicyInstanceAsync(const Model::UpdateTrafficPolicyInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateTrafficPolicyInstanceAsync(Model::UpdateTrafficPolicyInstanceRequest&& request, const UpdateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListHealthChecks(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<Route53Client, Model::ListHealthChecksRequest, Model::ListHealthChecksOutcome> ListHealthChecksPaginator(const Model::ListHealthChecksRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListHostedZones(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<Route53Client, Model::ListHostedZonesRequest, Model::ListHostedZonesOutcome> ListHostedZonesPaginator(const Model::ListHostedZonesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListReusableDelegationSets(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<Route53Client, Model::ListReusableDelegationSetsRequest, Model::ListReusableDelegationSetsOutcome> ListReusableDelegationSetsPaginator(const Model::ListReusableDelegationSetsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AssociateVPCWithHostedZone(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::AssociateVPCWithHostedZoneRequest, Model::AssociateVPCWithHostedZoneOutcome> AssociateVPCWithHostedZoneAwaitable(Model::AssociateVPCWithHostedZoneRequest request) const;
+
+        /**
+         * co_await-able form of ChangeResourceRecordSets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::ChangeResourceRecordSetsRequest, Model::ChangeResourceRecordSetsOutcome> ChangeResourceRecordSetsAwaitable(Model::ChangeResourceRecordSetsRequest request) const;
+
+        /**
+         * co_await-able form of ChangeTagsForResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::ChangeTagsForResourceRequest, Model::ChangeTagsForResourceOutcome> ChangeTagsForResourceAwaitable(Model::ChangeTagsForResourceRequest request) const;
+
+        /**
+         * co_await-able form of CreateHealthCheck(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::CreateHealthCheckRequest, Model::CreateHealthCheckOutcome> CreateHealthCheckAwaitable(Model::CreateHealthCheckRequest request) const;
+
+        /**
+         * co_await-able form of CreateHostedZone(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::CreateHostedZoneRequest, Model::CreateHostedZoneOutcome> CreateHostedZoneAwaitable(Model::CreateHostedZoneRequest request) const;
+
+        /**
+         * co_await-able form of CreateReusableDelegationSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::CreateReusableDelegationSetRequest, Model::CreateReusableDelegationSetOutcome> CreateReusableDelegationSetAwaitable(Model::CreateReusableDelegationSetRequest request) const;
+
+        /**
+         * co_await-able form of CreateTrafficPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::CreateTrafficPolicyRequest, Model::CreateTrafficPolicyOutcome> CreateTrafficPolicyAwaitable(Model::CreateTrafficPolicyRequest request) const;
+
+        /**
+         * co_await-able form of CreateTrafficPolicyInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::CreateTrafficPolicyInstanceRequest, Model::CreateTrafficPolicyInstanceOutcome> CreateTrafficPolicyInstanceAwaitable(Model::CreateTrafficPolicyInstanceRequest request) const;
+
+        /**
+         * co_await-able form of CreateTrafficPolicyVersion(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::CreateTrafficPolicyVersionRequest, Model::CreateTrafficPolicyVersionOutcome> CreateTrafficPolicyVersionAwaitable(Model::CreateTrafficPolicyVersionRequest request) const;
+
+        /**
+         * co_await-able form of DeleteHealthCheck(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::DeleteHealthCheckRequest, Model::DeleteHealthCheckOutcome> DeleteHealthCheckAwaitable(Model::DeleteHealthCheckRequest request) const;
+
+        /**
+         * co_await-able form of DeleteHostedZone(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::DeleteHostedZoneRequest, Model::DeleteHostedZoneOutcome> DeleteHostedZoneAwaitable(Model::DeleteHostedZoneRequest request) const;
+
+        /**
+         * co_await-able form of DeleteReusableDelegationSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::DeleteReusableDelegationSetRequest, Model::DeleteReusableDelegationSetOutcome> DeleteReusableDelegationSetAwaitable(Model::DeleteReusableDelegationSetRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTrafficPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::DeleteTrafficPolicyRequest, Model::DeleteTrafficPolicyOutcome> DeleteTrafficPolicyAwaitable(Model::DeleteTrafficPolicyRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTrafficPolicyInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::DeleteTrafficPolicyInstanceRequest, Model::DeleteTrafficPolicyInstanceOutcome> DeleteTrafficPolicyInstanceAwaitable(Model::DeleteTrafficPolicyInstanceRequest request) const;
+
+        /**
+         * co_await-able form of DisassociateVPCFromHostedZone(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::DisassociateVPCFromHostedZoneRequest, Model::DisassociateVPCFromHostedZoneOutcome> DisassociateVPCFromHostedZoneAwaitable(Model::DisassociateVPCFromHostedZoneRequest request) const;
+
+        /**
+         * co_await-able form of GetChange(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::GetChangeRequest, Model::GetChangeOutcome> GetChangeAwaitable(Model::GetChangeRequest request) const;
+
+        /**
+         * co_await-able form of GetCheckerIpRanges(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::GetCheckerIpRangesRequest, Model::GetCheckerIpRangesOutcome> GetCheckerIpRangesAwaitable(Model::GetCheckerIpRangesRequest request) const;
+
+        /**
+         * co_await-able form of GetGeoLocation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::GetGeoLocationRequest, Model::GetGeoLocationOutcome> GetGeoLocationAwaitable(Model::GetGeoLocationRequest request) const;
+
+        /**
+         * co_await-able form of GetHealthCheck(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::GetHealthCheckRequest, Model::GetHealthCheckOutcome> GetHealthCheckAwaitable(Model::GetHealthCheckRequest request) const;
+
+        /**
+         * co_await-able form of GetHealthCheckCount(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::GetHealthCheckCountRequest, Model::GetHealthCheckCountOutcome> GetHealthCheckCountAwaitable(Model::GetHealthCheckCountRequest request) const;
+
+        /**
+         * co_await-able form of GetHealthCheckLastFailureReason(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::GetHealthCheckLastFailureReasonRequest, Model::GetHealthCheckLastFailureReasonOutcome> GetHealthCheckLastFailureReasonAwaitable(Model::GetHealthCheckLastFailureReasonRequest request) const;
+
+        /**
+         * co_await-able form of GetHealthCheckStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::GetHealthCheckStatusRequest, Model::GetHealthCheckStatusOutcome> GetHealthCheckStatusAwaitable(Model::GetHealthCheckStatusRequest request) const;
+
+        /**
+         * co_await-able form of GetHostedZone(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::GetHostedZoneRequest, Model::GetHostedZoneOutcome> GetHostedZoneAwaitable(Model::GetHostedZoneRequest request) const;
+
+        /**
+         * co_await-able form of GetHostedZoneCount(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::GetHostedZoneCountRequest, Model::GetHostedZoneCountOutcome> GetHostedZoneCountAwaitable(Model::GetHostedZoneCountRequest request) const;
+
+        /**
+         * co_await-able form of GetReusableDelegationSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::GetReusableDelegationSetRequest, Model::GetReusableDelegationSetOutcome> GetReusableDelegationSetAwaitable(Model::GetReusableDelegationSetRequest request) const;
+
+        /**
+         * co_await-able form of GetTrafficPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::GetTrafficPolicyRequest, Model::GetTrafficPolicyOutcome> GetTrafficPolicyAwaitable(Model::GetTrafficPolicyRequest request) const;
+
+        /**
+         * co_await-able form of GetTrafficPolicyInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::GetTrafficPolicyInstanceRequest, Model::GetTrafficPolicyInstanceOutcome> GetTrafficPolicyInstanceAwaitable(Model::GetTrafficPolicyInstanceRequest request) const;
+
+        /**
+         * co_await-able form of GetTrafficPolicyInstanceCount(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::GetTrafficPolicyInstanceCountRequest, Model::GetTrafficPolicyInstanceCountOutcome> GetTrafficPolicyInstanceCountAwaitable(Model::GetTrafficPolicyInstanceCountRequest request) const;
+
+        /**
+         * co_await-able form of ListGeoLocations(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::ListGeoLocationsRequest, Model::ListGeoLocationsOutcome> ListGeoLocationsAwaitable(Model::ListGeoLocationsRequest request) const;
+
+        /**
+         * co_await-able form of ListHealthChecks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::ListHealthChecksRequest, Model::ListHealthChecksOutcome> ListHealthChecksAwaitable(Model::ListHealthChecksRequest request) const;
+
+        /**
+         * co_await-able form of ListHostedZones(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::ListHostedZonesRequest, Model::ListHostedZonesOutcome> ListHostedZonesAwaitable(Model::ListHostedZonesRequest request) const;
+
+        /**
+         * co_await-able form of ListHostedZonesByName(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::ListHostedZonesByNameRequest, Model::ListHostedZonesByNameOutcome> ListHostedZonesByNameAwaitable(Model::ListHostedZonesByNameRequest request) const;
+
+        /**
+         * co_await-able form of ListResourceRecordSets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::ListResourceRecordSetsRequest, Model::ListResourceRecordSetsOutcome> ListResourceRecordSetsAwaitable(Model::ListResourceRecordSetsRequest request) const;
+
+        /**
+         * co_await-able form of ListReusableDelegationSets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::ListReusableDelegationSetsRequest, Model::ListReusableDelegationSetsOutcome> ListReusableDelegationSetsAwaitable(Model::ListReusableDelegationSetsRequest request) const;
+
+        /**
+         * co_await-able form of ListTagsForResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::ListTagsForResourceRequest, Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(Model::ListTagsForResourceRequest request) const;
+
+        /**
+         * co_await-able form of ListTagsForResources(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::ListTagsForResourcesRequest, Model::ListTagsForResourcesOutcome> ListTagsForResourcesAwaitable(Model::ListTagsForResourcesRequest request) const;
+
+        /**
+         * co_await-able form of ListTrafficPolicies(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::ListTrafficPoliciesRequest, Model::ListTrafficPoliciesOutcome> ListTrafficPoliciesAwaitable(Model::ListTrafficPoliciesRequest request) const;
+
+        /**
+         * co_await-able form of ListTrafficPolicyInstances(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::ListTrafficPolicyInstancesRequest, Model::ListTrafficPolicyInstancesOutcome> ListTrafficPolicyInstancesAwaitable(Model::ListTrafficPolicyInstancesRequest request) const;
+
+        /**
+         * co_await-able form of ListTrafficPolicyInstancesByHostedZone(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::ListTrafficPolicyInstancesByHostedZoneRequest, Model::ListTrafficPolicyInstancesByHostedZoneOutcome> ListTrafficPolicyInstancesByHostedZoneAwaitable(Model::ListTrafficPolicyInstancesByHostedZoneRequest request) const;
+
+        /**
+         * co_await-able form of ListTrafficPolicyInstancesByPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::ListTrafficPolicyInstancesByPolicyRequest, Model::ListTrafficPolicyInstancesByPolicyOutcome> ListTrafficPolicyInstancesByPolicyAwaitable(Model::ListTrafficPolicyInstancesByPolicyRequest request) const;
+
+        /**
+         * co_await-able form of ListTrafficPolicyVersions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::ListTrafficPolicyVersionsRequest, Model::ListTrafficPolicyVersionsOutcome> ListTrafficPolicyVersionsAwaitable(Model::ListTrafficPolicyVersionsRequest request) const;
+
+        /**
+         * co_await-able form of UpdateHealthCheck(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::UpdateHealthCheckRequest, Model::UpdateHealthCheckOutcome> UpdateHealthCheckAwaitable(Model::UpdateHealthCheckRequest request) const;
+
+        /**
+         * co_await-able form of UpdateHostedZoneComment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::UpdateHostedZoneCommentRequest, Model::UpdateHostedZoneCommentOutcome> UpdateHostedZoneCommentAwaitable(Model::UpdateHostedZoneCommentRequest request) const;
+
+        /**
+         * co_await-able form of UpdateTrafficPolicyComment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::UpdateTrafficPolicyCommentRequest, Model::UpdateTrafficPolicyCommentOutcome> UpdateTrafficPolicyCommentAwaitable(Model::UpdateTrafficPolicyCommentRequest request) const;
+
+        /**
+         * co_await-able form of UpdateTrafficPolicyInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53Client, Model::UpdateTrafficPolicyInstanceRequest, Model::UpdateTrafficPolicyInstanceOutcome> UpdateTrafficPolicyInstanceAwaitable(Model::UpdateTrafficPolicyInstanceRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     AssociateVPCWithHostedZoneRequest();
+    inline const char* GetServiceRequestName() const override { return "AssociateVPCWithHostedZone"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ChangeResourceRecordSetsRequest();
+    inline const char* GetServiceRequestName() const override { return "ChangeResourceRecordSets"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ChangeTagsForResourceRequest();
+    inline const char* GetServiceRequestName() const override { return "ChangeTagsForResource"; }
+
     Aws::String SerializePayload() const override;
 
     /**
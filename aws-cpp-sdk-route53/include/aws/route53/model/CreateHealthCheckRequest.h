@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateHealthCheckRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateHealthCheck"; }
+
     Aws::String SerializePayload() const override;
 
     /**
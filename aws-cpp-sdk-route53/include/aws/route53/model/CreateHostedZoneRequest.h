@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CreateHostedZoneRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateHostedZone"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateReusableDelegationSetRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateReusableDelegationSet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
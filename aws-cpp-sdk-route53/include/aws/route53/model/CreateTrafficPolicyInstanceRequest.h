@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateTrafficPolicyInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateTrafficPolicyInstance"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateTrafficPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateTrafficPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateTrafficPolicyVersionRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateTrafficPolicyVersion"; }
+
     Aws::String SerializePayload() const override;
 
     /**
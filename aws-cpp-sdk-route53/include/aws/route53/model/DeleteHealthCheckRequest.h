@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteHealthCheckRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteHealthCheck"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteHostedZoneRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteHostedZone"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteReusableDelegationSetRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteReusableDelegationSet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
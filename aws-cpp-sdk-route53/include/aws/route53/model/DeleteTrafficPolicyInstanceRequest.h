@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteTrafficPolicyInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteTrafficPolicyInstance"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteTrafficPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteTrafficPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
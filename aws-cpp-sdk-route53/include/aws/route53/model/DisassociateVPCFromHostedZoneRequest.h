@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DisassociateVPCFromHostedZoneRequest();
+    inline const char* GetServiceRequestName() const override { return "DisassociateVPCFromHostedZone"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetChangeRequest();
+    inline const char* GetServiceRequestName() const override { return "GetChange"; }
+
     Aws::String SerializePayload() const override;
 
     /**
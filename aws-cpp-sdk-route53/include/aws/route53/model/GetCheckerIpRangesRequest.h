@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetCheckerIpRangesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetCheckerIpRanges"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetGeoLocationRequest();
+    inline const char* GetServiceRequestName() const override { return "GetGeoLocation"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
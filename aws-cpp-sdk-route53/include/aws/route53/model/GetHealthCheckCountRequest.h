@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetHealthCheckCountRequest();
+    inline const char* GetServiceRequestName() const override { return "GetHealthCheckCount"; }
+
     Aws::String SerializePayload() const override;
 
   };
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetHealthCheckLastFailureReasonRequest();
+    inline const char* GetServiceRequestName() const override { return "GetHealthCheckLastFailureReason"; }
+
     Aws::String SerializePayload() const override;
 
     /**
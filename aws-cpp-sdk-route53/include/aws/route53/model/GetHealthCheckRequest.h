@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetHealthCheckRequest();
+    inline const char* GetServiceRequestName() const override { return "GetHealthCheck"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetHealthCheckStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "GetHealthCheckStatus"; }
+
     Aws::String SerializePayload() const override;
 
     /**
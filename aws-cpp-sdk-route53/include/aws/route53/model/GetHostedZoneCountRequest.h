@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetHostedZoneCountRequest();
+    inline const char* GetServiceRequestName() const override { return "GetHostedZoneCount"; }
+
     Aws::String SerializePayload() const override;
 
   };
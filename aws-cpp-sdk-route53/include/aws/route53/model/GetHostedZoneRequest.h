@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetHostedZoneRequest();
+    inline const char* GetServiceRequestName() const override { return "GetHostedZone"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetReusableDelegationSetRequest();
+    inline const char* GetServiceRequestName() const override { return "GetReusableDelegationSet"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetTrafficPolicyInstanceCountRequest();
+    inline const char* GetServiceRequestName() const override { return "GetTrafficPolicyInstanceCount"; }
+
     Aws::String SerializePayload() const override;
 
   };
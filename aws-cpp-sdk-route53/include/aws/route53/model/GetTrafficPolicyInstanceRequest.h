@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     GetTrafficPolicyInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "GetTrafficPolicyInstance"; }
+
     Aws::String SerializePayload() const override;
 
     /**
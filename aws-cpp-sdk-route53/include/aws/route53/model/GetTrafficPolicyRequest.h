@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     GetTrafficPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetTrafficPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListGeoLocationsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListGeoLocations"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -44,6 +44,8 @@ namespace Model
   {
   public:
     ListHealthChecksRequest();
+    inline const char* GetServiceRequestName() const override { return "ListHealthChecks"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
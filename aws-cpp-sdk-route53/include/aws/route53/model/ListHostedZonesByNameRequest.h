@@ -43,6 +43,8 @@ namespace Model
   {
   public:
     ListHostedZonesByNameRequest();
+    inline const char* GetServiceRequestName() const override { return "ListHostedZonesByName"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -44,6 +44,8 @@ namespace Model
   {
   public:
     ListHostedZonesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListHostedZones"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     ListResourceRecordSetsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListResourceRecordSets"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -44,6 +44,8 @@ namespace Model
   {
   public:
     ListReusableDelegationSetsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListReusableDelegationSets"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ListTagsForResourceRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTagsForResource"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     ListTagsForResourcesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTagsForResources"; }
+
     Aws::String SerializePayload() const override;
 
     /**
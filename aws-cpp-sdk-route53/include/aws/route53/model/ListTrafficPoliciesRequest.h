@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     ListTrafficPoliciesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTrafficPolicies"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
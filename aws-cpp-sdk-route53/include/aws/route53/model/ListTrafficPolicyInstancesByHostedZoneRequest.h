@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     ListTrafficPolicyInstancesByHostedZoneRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTrafficPolicyInstancesByHostedZone"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     ListTrafficPolicyInstancesByPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTrafficPolicyInstancesByPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
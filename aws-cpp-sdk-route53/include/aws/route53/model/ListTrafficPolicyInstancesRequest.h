@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     ListTrafficPolicyInstancesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTrafficPolicyInstances"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     ListTrafficPolicyVersionsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTrafficPolicyVersions"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
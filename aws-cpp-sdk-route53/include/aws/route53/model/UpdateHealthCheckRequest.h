@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     UpdateHealthCheckRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateHealthCheck"; }
+
     Aws::String SerializePayload() const override;
 
     /**
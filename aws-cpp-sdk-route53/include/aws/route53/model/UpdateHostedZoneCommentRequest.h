@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateHostedZoneCommentRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateHostedZoneComment"; }
+
     Aws::String SerializePayload() const override;
 
     /**
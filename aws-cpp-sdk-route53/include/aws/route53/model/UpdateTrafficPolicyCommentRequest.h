@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateTrafficPolicyCommentRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateTrafficPolicyComment"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateTrafficPolicyInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateTrafficPolicyInstance"; }
+
     Aws::String SerializePayload() const override;
 
     /**
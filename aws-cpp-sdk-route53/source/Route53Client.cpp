@@ -156,7 +156,7 @@ AssociateVPCWithHostedZoneOutcome Route53Client::AssociateVPCWithHostedZone(cons
 
 AssociateVPCWithHostedZoneOutcomeCallable Route53Client::AssociateVPCWithHostedZoneCallable(const AssociateVPCWithHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AssociateVPCWithHostedZone( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AssociateVPCWithHostedZone( request ); } );
 }
 
 void Route53Client::AssociateVPCWithHostedZoneAsync(const AssociateVPCWithHostedZoneRequest& request, const AssociateVPCWithHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -164,6 +164,16 @@ void Route53Client::AssociateVPCWithHostedZoneAsync(const AssociateVPCWithHosted
   m_executor->Submit( [this, request, handler, context](){ this->AssociateVPCWithHostedZoneAsyncHelper( request, handler, context ); } );
 }
 
+AssociateVPCWithHostedZoneOutcomeCallable Route53Client::AssociateVPCWithHostedZoneCallable(AssociateVPCWithHostedZoneRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::AssociateVPCWithHostedZone, this, std::move(request)));
+}
+
+void Route53Client::AssociateVPCWithHostedZoneAsync(AssociateVPCWithHostedZoneRequest&& request, const AssociateVPCWithHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::AssociateVPCWithHostedZoneAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::AssociateVPCWithHostedZoneAsyncHelper(const AssociateVPCWithHostedZoneRequest& request, const AssociateVPCWithHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AssociateVPCWithHostedZone(request), context);
@@ -188,7 +198,7 @@ ChangeResourceRecordSetsOutcome Route53Client::ChangeResourceRecordSets(const Ch
 
 ChangeResourceRecordSetsOutcomeCallable Route53Client::ChangeResourceRecordSetsCallable(const ChangeResourceRecordSetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ChangeResourceRecordSets( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ChangeResourceRecordSets( request ); } );
 }
 
 void Route53Client::ChangeResourceRecordSetsAsync(const ChangeResourceRecordSetsRequest& request, const ChangeResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -196,6 +206,16 @@ void Route53Client::ChangeResourceRecordSetsAsync(const ChangeResourceRecordSets
   m_executor->Submit( [this, request, handler, context](){ this->ChangeResourceRecordSetsAsyncHelper( request, handler, context ); } );
 }
 
+ChangeResourceRecordSetsOutcomeCallable Route53Client::ChangeResourceRecordSetsCallable(ChangeResourceRecordSetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::ChangeResourceRecordSets, this, std::move(request)));
+}
+
+void Route53Client::ChangeResourceRecordSetsAsync(ChangeResourceRecordSetsRequest&& request, const ChangeResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::ChangeResourceRecordSetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::ChangeResourceRecordSetsAsyncHelper(const ChangeResourceRecordSetsRequest& request, const ChangeResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ChangeResourceRecordSets(request), context);
@@ -221,7 +241,7 @@ ChangeTagsForResourceOutcome Route53Client::ChangeTagsForResource(const ChangeTa
 
 ChangeTagsForResourceOutcomeCallable Route53Client::ChangeTagsForResourceCallable(const ChangeTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ChangeTagsForResource( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ChangeTagsForResource( request ); } );
 }
 
 void Route53Client::ChangeTagsForResourceAsync(const ChangeTagsForResourceRequest& request, const ChangeTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -229,6 +249,16 @@ void Route53Client::ChangeTagsForResourceAsync(const ChangeTagsForResourceReques
   m_executor->Submit( [this, request, handler, context](){ this->ChangeTagsForResourceAsyncHelper( request, handler, context ); } );
 }
 
+ChangeTagsForResourceOutcomeCallable Route53Client::ChangeTagsForResourceCallable(ChangeTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::ChangeTagsForResource, this, std::move(request)));
+}
+
+void Route53Client::ChangeTagsForResourceAsync(ChangeTagsForResourceRequest&& request, const ChangeTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::ChangeTagsForResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::ChangeTagsForResourceAsyncHelper(const ChangeTagsForResourceRequest& request, const ChangeTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ChangeTagsForResource(request), context);
@@ -251,7 +281,7 @@ CreateHealthCheckOutcome Route53Client::CreateHealthCheck(const CreateHealthChec
 
 CreateHealthCheckOutcomeCallable Route53Client::CreateHealthCheckCallable(const CreateHealthCheckRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateHealthCheck( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateHealthCheck( request ); } );
 }
 
 void Route53Client::CreateHealthCheckAsync(const CreateHealthCheckRequest& request, const CreateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -259,6 +289,16 @@ void Route53Client::CreateHealthCheckAsync(const CreateHealthCheckRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->CreateHealthCheckAsyncHelper( request, handler, context ); } );
 }
 
+CreateHealthCheckOutcomeCallable Route53Client::CreateHealthCheckCallable(CreateHealthCheckRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::CreateHealthCheck, this, std::move(request)));
+}
+
+void Route53Client::CreateHealthCheckAsync(CreateHealthCheckRequest&& request, const CreateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::CreateHealthCheckAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::CreateHealthCheckAsyncHelper(const CreateHealthCheckRequest& request, const CreateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateHealthCheck(request), context);
@@ -281,7 +321,7 @@ CreateHostedZoneOutcome Route53Client::CreateHostedZone(const CreateHostedZoneRe
 
 CreateHostedZoneOutcomeCallable Route53Client::CreateHostedZoneCallable(const CreateHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateHostedZone( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateHostedZone( request ); } );
 }
 
 void Route53Client::CreateHostedZoneAsync(const CreateHostedZoneRequest& request, const CreateHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -289,6 +329,16 @@ void Route53Client::CreateHostedZoneAsync(const CreateHostedZoneRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->CreateHostedZoneAsyncHelper( request, handler, context ); } );
 }
 
+CreateHostedZoneOutcomeCallable Route53Client::CreateHostedZoneCallable(CreateHostedZoneRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::CreateHostedZone, this, std::move(request)));
+}
+
+void Route53Client::CreateHostedZoneAsync(CreateHostedZoneRequest&& request, const CreateHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::CreateHostedZoneAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::CreateHostedZoneAsyncHelper(const CreateHostedZoneRequest& request, const CreateHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateHostedZone(request), context);
@@ -311,7 +361,7 @@ CreateReusableDelegationSetOutcome Route53Client::CreateReusableDelegationSet(co
 
 CreateReusableDelegationSetOutcomeCallable Route53Client::CreateReusableDelegationSetCallable(const CreateReusableDelegationSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateReusableDelegationSet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateReusableDelegationSet( request ); } );
 }
 
 void Route53Client::CreateReusableDelegationSetAsync(const CreateReusableDelegationSetRequest& request, const CreateReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -319,6 +369,16 @@ void Route53Client::CreateReusableDelegationSetAsync(const CreateReusableDelegat
   m_executor->Submit( [this, request, handler, context](){ this->CreateReusableDelegationSetAsyncHelper( request, handler, context ); } );
 }
 
+CreateReusableDelegationSetOutcomeCallable Route53Client::CreateReusableDelegationSetCallable(CreateReusableDelegationSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::CreateReusableDelegationSet, this, std::move(request)));
+}
+
+void Route53Client::CreateReusableDelegationSetAsync(CreateReusableDelegationSetRequest&& request, const CreateReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::CreateReusableDelegationSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::CreateReusableDelegationSetAsyncHelper(const CreateReusableDelegationSetRequest& request, const CreateReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateReusableDelegationSet(request), context);
@@ -341,7 +401,7 @@ CreateTrafficPolicyOutcome Route53Client::CreateTrafficPolicy(const CreateTraffi
 
 CreateTrafficPolicyOutcomeCallable Route53Client::CreateTrafficPolicyCallable(const CreateTrafficPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateTrafficPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateTrafficPolicy( request ); } );
 }
 
 void Route53Client::CreateTrafficPolicyAsync(const CreateTrafficPolicyRequest& request, const CreateTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -349,6 +409,16 @@ void Route53Client::CreateTrafficPolicyAsync(const CreateTrafficPolicyRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->CreateTrafficPolicyAsyncHelper( request, handler, context ); } );
 }
 
+CreateTrafficPolicyOutcomeCallable Route53Client::CreateTrafficPolicyCallable(CreateTrafficPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::CreateTrafficPolicy, this, std::move(request)));
+}
+
+void Route53Client::CreateTrafficPolicyAsync(CreateTrafficPolicyRequest&& request, const CreateTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::CreateTrafficPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::CreateTrafficPolicyAsyncHelper(const CreateTrafficPolicyRequest& request, const CreateTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateTrafficPolicy(request), context);
@@ -371,7 +441,7 @@ CreateTrafficPolicyInstanceOutcome Route53Client::CreateTrafficPolicyInstance(co
 
 CreateTrafficPolicyInstanceOutcomeCallable Route53Client::CreateTrafficPolicyInstanceCallable(const CreateTrafficPolicyInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateTrafficPolicyInstance( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateTrafficPolicyInstance( request ); } );
 }
 
 void Route53Client::CreateTrafficPolicyInstanceAsync(const CreateTrafficPolicyInstanceRequest& request, const CreateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -379,6 +449,16 @@ void Route53Client::CreateTrafficPolicyInstanceAsync(const CreateTrafficPolicyIn
   m_executor->Submit( [this, request, handler, context](){ this->CreateTrafficPolicyInstanceAsyncHelper( request, handler, context ); } );
 }
 
+CreateTrafficPolicyInstanceOutcomeCallable Route53Client::CreateTrafficPolicyInstanceCallable(CreateTrafficPolicyInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::CreateTrafficPolicyInstance, this, std::move(request)));
+}
+
+void Route53Client::CreateTrafficPolicyInstanceAsync(CreateTrafficPolicyInstanceRequest&& request, const CreateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::CreateTrafficPolicyInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::CreateTrafficPolicyInstanceAsyncHelper(const CreateTrafficPolicyInstanceRequest& request, const CreateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateTrafficPolicyInstance(request), context);
@@ -402,7 +482,7 @@ CreateTrafficPolicyVersionOutcome Route53Client::CreateTrafficPolicyVersion(cons
 
 CreateTrafficPolicyVersionOutcomeCallable Route53Client::CreateTrafficPolicyVersionCallable(const CreateTrafficPolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateTrafficPolicyVersion( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateTrafficPolicyVersion( request ); } );
 }
 
 void Route53Client::CreateTrafficPolicyVersionAsync(const CreateTrafficPolicyVersionRequest& request, const CreateTrafficPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -410,6 +490,16 @@ void Route53Client::CreateTrafficPolicyVersionAsync(const CreateTrafficPolicyVer
   m_executor->Submit( [this, request, handler, context](){ this->CreateTrafficPolicyVersionAsyncHelper( request, handler, context ); } );
 }
 
+CreateTrafficPolicyVersionOutcomeCallable Route53Client::CreateTrafficPolicyVersionCallable(CreateTrafficPolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::CreateTrafficPolicyVersion, this, std::move(request)));
+}
+
+void Route53Client::CreateTrafficPolicyVersionAsync(CreateTrafficPolicyVersionRequest&& request, const CreateTrafficPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::CreateTrafficPolicyVersionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::CreateTrafficPolicyVersionAsyncHelper(const CreateTrafficPolicyVersionRequest& request, const CreateTrafficPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateTrafficPolicyVersion(request), context);
@@ -433,7 +523,7 @@ DeleteHealthCheckOutcome Route53Client::DeleteHealthCheck(const DeleteHealthChec
 
 DeleteHealthCheckOutcomeCallable Route53Client::DeleteHealthCheckCallable(const DeleteHealthCheckRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteHealthCheck( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteHealthCheck( request ); } );
 }
 
 void Route53Client::DeleteHealthCheckAsync(const DeleteHealthCheckRequest& request, const DeleteHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -441,6 +531,16 @@ void Route53Client::DeleteHealthCheckAsync(const DeleteHealthCheckRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DeleteHealthCheckAsyncHelper( request, handler, context ); } );
 }
 
+DeleteHealthCheckOutcomeCallable Route53Client::DeleteHealthCheckCallable(DeleteHealthCheckRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::DeleteHealthCheck, this, std::move(request)));
+}
+
+void Route53Client::DeleteHealthCheckAsync(DeleteHealthCheckRequest&& request, const DeleteHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::DeleteHealthCheckAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::DeleteHealthCheckAsyncHelper(const DeleteHealthCheckRequest& request, const DeleteHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteHealthCheck(request), context);
@@ -464,7 +564,7 @@ DeleteHostedZoneOutcome Route53Client::DeleteHostedZone(const DeleteHostedZoneRe
 
 DeleteHostedZoneOutcomeCallable Route53Client::DeleteHostedZoneCallable(const DeleteHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteHostedZone( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteHostedZone( request ); } );
 }
 
 void Route53Client::DeleteHostedZoneAsync(const DeleteHostedZoneRequest& request, const DeleteHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -472,6 +572,16 @@ void Route53Client::DeleteHostedZoneAsync(const DeleteHostedZoneRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DeleteHostedZoneAsyncHelper( request, handler, context ); } );
 }
 
+DeleteHostedZoneOutcomeCallable Route53Client::DeleteHostedZoneCallable(DeleteHostedZoneRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::DeleteHostedZone, this, std::move(request)));
+}
+
+void Route53Client::DeleteHostedZoneAsync(DeleteHostedZoneRequest&& request, const DeleteHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::DeleteHostedZoneAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::DeleteHostedZoneAsyncHelper(const DeleteHostedZoneRequest& request, const DeleteHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteHostedZone(request), context);
@@ -495,7 +605,7 @@ DeleteReusableDelegationSetOutcome Route53Client::DeleteReusableDelegationSet(co
 
 DeleteReusableDelegationSetOutcomeCallable Route53Client::DeleteReusableDelegationSetCallable(const DeleteReusableDelegationSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteReusableDelegationSet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteReusableDelegationSet( request ); } );
 }
 
 void Route53Client::DeleteReusableDelegationSetAsync(const DeleteReusableDelegationSetRequest& request, const DeleteReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -503,6 +613,16 @@ void Route53Client::DeleteReusableDelegationSetAsync(const DeleteReusableDelegat
   m_executor->Submit( [this, request, handler, context](){ this->DeleteReusableDelegationSetAsyncHelper( request, handler, context ); } );
 }
 
+DeleteReusableDelegationSetOutcomeCallable Route53Client::DeleteReusableDelegationSetCallable(DeleteReusableDelegationSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::DeleteReusableDelegationSet, this, std::move(request)));
+}
+
+void Route53Client::DeleteReusableDelegationSetAsync(DeleteReusableDelegationSetRequest&& request, const DeleteReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::DeleteReusableDelegationSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::DeleteReusableDelegationSetAsyncHelper(const DeleteReusableDelegationSetRequest& request, const DeleteReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteReusableDelegationSet(request), context);
@@ -528,7 +648,7 @@ DeleteTrafficPolicyOutcome Route53Client::DeleteTrafficPolicy(const DeleteTraffi
 
 DeleteTrafficPolicyOutcomeCallable Route53Client::DeleteTrafficPolicyCallable(const DeleteTrafficPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTrafficPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTrafficPolicy( request ); } );
 }
 
 void Route53Client::DeleteTrafficPolicyAsync(const DeleteTrafficPolicyRequest& request, const DeleteTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -536,6 +656,16 @@ void Route53Client::DeleteTrafficPolicyAsync(const DeleteTrafficPolicyRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTrafficPolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTrafficPolicyOutcomeCallable Route53Client::DeleteTrafficPolicyCallable(DeleteTrafficPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::DeleteTrafficPolicy, this, std::move(request)));
+}
+
+void Route53Client::DeleteTrafficPolicyAsync(DeleteTrafficPolicyRequest&& request, const DeleteTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::DeleteTrafficPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::DeleteTrafficPolicyAsyncHelper(const DeleteTrafficPolicyRequest& request, const DeleteTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTrafficPolicy(request), context);
@@ -559,7 +689,7 @@ DeleteTrafficPolicyInstanceOutcome Route53Client::DeleteTrafficPolicyInstance(co
 
 DeleteTrafficPolicyInstanceOutcomeCallable Route53Client::DeleteTrafficPolicyInstanceCallable(const DeleteTrafficPolicyInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTrafficPolicyInstance( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTrafficPolicyInstance( request ); } );
 }
 
 void Route53Client::DeleteTrafficPolicyInstanceAsync(const DeleteTrafficPolicyInstanceRequest& request, const DeleteTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -567,6 +697,16 @@ void Route53Client::DeleteTrafficPolicyInstanceAsync(const DeleteTrafficPolicyIn
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTrafficPolicyInstanceAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTrafficPolicyInstanceOutcomeCallable Route53Client::DeleteTrafficPolicyInstanceCallable(DeleteTrafficPolicyInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::DeleteTrafficPolicyInstance, this, std::move(request)));
+}
+
+void Route53Client::DeleteTrafficPolicyInstanceAsync(DeleteTrafficPolicyInstanceRequest&& request, const DeleteTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::DeleteTrafficPolicyInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::DeleteTrafficPolicyInstanceAsyncHelper(const DeleteTrafficPolicyInstanceRequest& request, const DeleteTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTrafficPolicyInstance(request), context);
@@ -591,7 +731,7 @@ DisassociateVPCFromHostedZoneOutcome Route53Client::DisassociateVPCFromHostedZon
 
 DisassociateVPCFromHostedZoneOutcomeCallable Route53Client::DisassociateVPCFromHostedZoneCallable(const DisassociateVPCFromHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisassociateVPCFromHostedZone( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisassociateVPCFromHostedZone( request ); } );
 }
 
 void Route53Client::DisassociateVPCFromHostedZoneAsync(const DisassociateVPCFromHostedZoneRequest& request, const DisassociateVPCFromHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -599,6 +739,16 @@ void Route53Client::DisassociateVPCFromHostedZoneAsync(const DisassociateVPCFrom
   m_executor->Submit( [this, request, handler, context](){ this->DisassociateVPCFromHostedZoneAsyncHelper( request, handler, context ); } );
 }
 
+DisassociateVPCFromHostedZoneOutcomeCallable Route53Client::DisassociateVPCFromHostedZoneCallable(DisassociateVPCFromHostedZoneRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::DisassociateVPCFromHostedZone, this, std::move(request)));
+}
+
+void Route53Client::DisassociateVPCFromHostedZoneAsync(DisassociateVPCFromHostedZoneRequest&& request, const DisassociateVPCFromHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::DisassociateVPCFromHostedZoneAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::DisassociateVPCFromHostedZoneAsyncHelper(const DisassociateVPCFromHostedZoneRequest& request, const DisassociateVPCFromHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisassociateVPCFromHostedZone(request), context);
@@ -622,7 +772,7 @@ GetChangeOutcome Route53Client::GetChange(const GetChangeRequest& request) const
 
 GetChangeOutcomeCallable Route53Client::GetChangeCallable(const GetChangeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetChange( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetChange( request ); } );
 }
 
 void Route53Client::GetChangeAsync(const GetChangeRequest& request, const GetChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -630,6 +780,16 @@ void Route53Client::GetChangeAsync(const GetChangeRequest& request, const GetCha
   m_executor->Submit( [this, request, handler, context](){ this->GetChangeAsyncHelper( request, handler, context ); } );
 }
 
+GetChangeOutcomeCallable Route53Client::GetChangeCallable(GetChangeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::GetChange, this, std::move(request)));
+}
+
+void Route53Client::GetChangeAsync(GetChangeRequest&& request, const GetChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::GetChangeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::GetChangeAsyncHelper(const GetChangeRequest& request, const GetChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetChange(request), context);
@@ -652,7 +812,7 @@ GetCheckerIpRangesOutcome Route53Client::GetCheckerIpRanges(const GetCheckerIpRa
 
 GetCheckerIpRangesOutcomeCallable Route53Client::GetCheckerIpRangesCallable(const GetCheckerIpRangesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetCheckerIpRanges( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetCheckerIpRanges( request ); } );
 }
 
 void Route53Client::GetCheckerIpRangesAsync(const GetCheckerIpRangesRequest& request, const GetCheckerIpRangesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -660,6 +820,16 @@ void Route53Client::GetCheckerIpRangesAsync(const GetCheckerIpRangesRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->GetCheckerIpRangesAsyncHelper( request, handler, context ); } );
 }
 
+GetCheckerIpRangesOutcomeCallable Route53Client::GetCheckerIpRangesCallable(GetCheckerIpRangesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::GetCheckerIpRanges, this, std::move(request)));
+}
+
+void Route53Client::GetCheckerIpRangesAsync(GetCheckerIpRangesRequest&& request, const GetCheckerIpRangesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::GetCheckerIpRangesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::GetCheckerIpRangesAsyncHelper(const GetCheckerIpRangesRequest& request, const GetCheckerIpRangesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetCheckerIpRanges(request), context);
@@ -682,7 +852,7 @@ GetGeoLocationOutcome Route53Client::GetGeoLocation(const GetGeoLocationRequest&
 
 GetGeoLocationOutcomeCallable Route53Client::GetGeoLocationCallable(const GetGeoLocationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetGeoLocation( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetGeoLocation( request ); } );
 }
 
 void Route53Client::GetGeoLocationAsync(const GetGeoLocationRequest& request, const GetGeoLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -690,6 +860,16 @@ void Route53Client::GetGeoLocationAsync(const GetGeoLocationRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->GetGeoLocationAsyncHelper( request, handler, context ); } );
 }
 
+GetGeoLocationOutcomeCallable Route53Client::GetGeoLocationCallable(GetGeoLocationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::GetGeoLocation, this, std::move(request)));
+}
+
+void Route53Client::GetGeoLocationAsync(GetGeoLocationRequest&& request, const GetGeoLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::GetGeoLocationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::GetGeoLocationAsyncHelper(const GetGeoLocationRequest& request, const GetGeoLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetGeoLocation(request), context);
@@ -713,7 +893,7 @@ GetHealthCheckOutcome Route53Client::GetHealthCheck(const GetHealthCheckRequest&
 
 GetHealthCheckOutcomeCallable Route53Client::GetHealthCheckCallable(const GetHealthCheckRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetHealthCheck( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetHealthCheck( request ); } );
 }
 
 void Route53Client::GetHealthCheckAsync(const GetHealthCheckRequest& request, const GetHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -721,6 +901,16 @@ void Route53Client::GetHealthCheckAsync(const GetHealthCheckRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->GetHealthCheckAsyncHelper( request, handler, context ); } );
 }
 
+GetHealthCheckOutcomeCallable Route53Client::GetHealthCheckCallable(GetHealthCheckRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::GetHealthCheck, this, std::move(request)));
+}
+
+void Route53Client::GetHealthCheckAsync(GetHealthCheckRequest&& request, const GetHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::GetHealthCheckAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::GetHealthCheckAsyncHelper(const GetHealthCheckRequest& request, const GetHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetHealthCheck(request), context);
@@ -743,7 +933,7 @@ GetHealthCheckCountOutcome Route53Client::GetHealthCheckCount(const GetHealthChe
 
 GetHealthCheckCountOutcomeCallable Route53Client::GetHealthCheckCountCallable(const GetHealthCheckCountRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetHealthCheckCount( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetHealthCheckCount( request ); } );
 }
 
 void Route53Client::GetHealthCheckCountAsync(const GetHealthCheckCountRequest& request, const GetHealthCheckCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -751,6 +941,16 @@ void Route53Client::GetHealthCheckCountAsync(const GetHealthCheckCountRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->GetHealthCheckCountAsyncHelper( request, handler, context ); } );
 }
 
+GetHealthCheckCountOutcomeCallable Route53Client::GetHealthCheckCountCallable(GetHealthCheckCountRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::GetHealthCheckCount, this, std::move(request)));
+}
+
+void Route53Client::GetHealthCheckCountAsync(GetHealthCheckCountRequest&& request, const GetHealthCheckCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::GetHealthCheckCountAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::GetHealthCheckCountAsyncHelper(const GetHealthCheckCountRequest& request, const GetHealthCheckCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetHealthCheckCount(request), context);
@@ -775,7 +975,7 @@ GetHealthCheckLastFailureReasonOutcome Route53Client::GetHealthCheckLastFailureR
 
 GetHealthCheckLastFailureReasonOutcomeCallable Route53Client::GetHealthCheckLastFailureReasonCallable(const GetHealthCheckLastFailureReasonRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetHealthCheckLastFailureReason( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetHealthCheckLastFailureReason( request ); } );
 }
 
 void Route53Client::GetHealthCheckLastFailureReasonAsync(const GetHealthCheckLastFailureReasonRequest& request, const GetHealthCheckLastFailureReasonResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -783,6 +983,16 @@ void Route53Client::GetHealthCheckLastFailureReasonAsync(const GetHealthCheckLas
   m_executor->Submit( [this, request, handler, context](){ this->GetHealthCheckLastFailureReasonAsyncHelper( request, handler, context ); } );
 }
 
+GetHealthCheckLastFailureReasonOutcomeCallable Route53Client::GetHealthCheckLastFailureReasonCallable(GetHealthCheckLastFailureReasonRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::GetHealthCheckLastFailureReason, this, std::move(request)));
+}
+
+void Route53Client::GetHealthCheckLastFailureReasonAsync(GetHealthCheckLastFailureReasonRequest&& request, const GetHealthCheckLastFailureReasonResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::GetHealthCheckLastFailureReasonAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::GetHealthCheckLastFailureReasonAsyncHelper(const GetHealthCheckLastFailureReasonRequest& request, const GetHealthCheckLastFailureReasonResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetHealthCheckLastFailureReason(request), context);
@@ -807,7 +1017,7 @@ GetHealthCheckStatusOutcome Route53Client::GetHealthCheckStatus(const GetHealthC
 
 GetHealthCheckStatusOutcomeCallable Route53Client::GetHealthCheckStatusCallable(const GetHealthCheckStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetHealthCheckStatus( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetHealthCheckStatus( request ); } );
 }
 
 void Route53Client::GetHealthCheckStatusAsync(const GetHealthCheckStatusRequest& request, const GetHealthCheckStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -815,6 +1025,16 @@ void Route53Client::GetHealthCheckStatusAsync(const GetHealthCheckStatusRequest&
   m_executor->Submit( [this, request, handler, context](){ this->GetHealthCheckStatusAsyncHelper( request, handler, context ); } );
 }
 
+GetHealthCheckStatusOutcomeCallable Route53Client::GetHealthCheckStatusCallable(GetHealthCheckStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::GetHealthCheckStatus, this, std::move(request)));
+}
+
+void Route53Client::GetHealthCheckStatusAsync(GetHealthCheckStatusRequest&& request, const GetHealthCheckStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::GetHealthCheckStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::GetHealthCheckStatusAsyncHelper(const GetHealthCheckStatusRequest& request, const GetHealthCheckStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetHealthCheckStatus(request), context);
@@ -838,7 +1058,7 @@ GetHostedZoneOutcome Route53Client::GetHostedZone(const GetHostedZoneRequest& re
 
 GetHostedZoneOutcomeCallable Route53Client::GetHostedZoneCallable(const GetHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetHostedZone( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetHostedZone( request ); } );
 }
 
 void Route53Client::GetHostedZoneAsync(const GetHostedZoneRequest& request, const GetHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -846,6 +1066,16 @@ void Route53Client::GetHostedZoneAsync(const GetHostedZoneRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->GetHostedZoneAsyncHelper( request, handler, context ); } );
 }
 
+GetHostedZoneOutcomeCallable Route53Client::GetHostedZoneCallable(GetHostedZoneRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::GetHostedZone, this, std::move(request)));
+}
+
+void Route53Client::GetHostedZoneAsync(GetHostedZoneRequest&& request, const GetHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::GetHostedZoneAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::GetHostedZoneAsyncHelper(const GetHostedZoneRequest& request, const GetHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetHostedZone(request), context);
@@ -868,7 +1098,7 @@ GetHostedZoneCountOutcome Route53Client::GetHostedZoneCount(const GetHostedZoneC
 
 GetHostedZoneCountOutcomeCallable Route53Client::GetHostedZoneCountCallable(const GetHostedZoneCountRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetHostedZoneCount( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetHostedZoneCount( request ); } );
 }
 
 void Route53Client::GetHostedZoneCountAsync(const GetHostedZoneCountRequest& request, const GetHostedZoneCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -876,6 +1106,16 @@ void Route53Client::GetHostedZoneCountAsync(const GetHostedZoneCountRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->GetHostedZoneCountAsyncHelper( request, handler, context ); } );
 }
 
+GetHostedZoneCountOutcomeCallable Route53Client::GetHostedZoneCountCallable(GetHostedZoneCountRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::GetHostedZoneCount, this, std::move(request)));
+}
+
+void Route53Client::GetHostedZoneCountAsync(GetHostedZoneCountRequest&& request, const GetHostedZoneCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::GetHostedZoneCountAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::GetHostedZoneCountAsyncHelper(const GetHostedZoneCountRequest& request, const GetHostedZoneCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetHostedZoneCount(request), context);
@@ -899,7 +1139,7 @@ GetReusableDelegationSetOutcome Route53Client::GetReusableDelegationSet(const Ge
 
 GetReusableDelegationSetOutcomeCallable Route53Client::GetReusableDelegationSetCallable(const GetReusableDelegationSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetReusableDelegationSet( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetReusableDelegationSet( request ); } );
 }
 
 void Route53Client::GetReusableDelegationSetAsync(const GetReusableDelegationSetRequest& request, const GetReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -907,6 +1147,16 @@ void Route53Client::GetReusableDelegationSetAsync(const GetReusableDelegationSet
   m_executor->Submit( [this, request, handler, context](){ this->GetReusableDelegationSetAsyncHelper( request, handler, context ); } );
 }
 
+GetReusableDelegationSetOutcomeCallable Route53Client::GetReusableDelegationSetCallable(GetReusableDelegationSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::GetReusableDelegationSet, this, std::move(request)));
+}
+
+void Route53Client::GetReusableDelegationSetAsync(GetReusableDelegationSetRequest&& request, const GetReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::GetReusableDelegationSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::GetReusableDelegationSetAsyncHelper(const GetReusableDelegationSetRequest& request, const GetReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetReusableDelegationSet(request), context);
@@ -932,7 +1182,7 @@ GetTrafficPolicyOutcome Route53Client::GetTrafficPolicy(const GetTrafficPolicyRe
 
 GetTrafficPolicyOutcomeCallable Route53Client::GetTrafficPolicyCallable(const GetTrafficPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetTrafficPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetTrafficPolicy( request ); } );
 }
 
 void Route53Client::GetTrafficPolicyAsync(const GetTrafficPolicyRequest& request, const GetTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -940,6 +1190,16 @@ void Route53Client::GetTrafficPolicyAsync(const GetTrafficPolicyRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->GetTrafficPolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetTrafficPolicyOutcomeCallable Route53Client::GetTrafficPolicyCallable(GetTrafficPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::GetTrafficPolicy, this, std::move(request)));
+}
+
+void Route53Client::GetTrafficPolicyAsync(GetTrafficPolicyRequest&& request, const GetTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::GetTrafficPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::GetTrafficPolicyAsyncHelper(const GetTrafficPolicyRequest& request, const GetTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetTrafficPolicy(request), context);
@@ -963,7 +1223,7 @@ GetTrafficPolicyInstanceOutcome Route53Client::GetTrafficPolicyInstance(const Ge
 
 GetTrafficPolicyInstanceOutcomeCallable Route53Client::GetTrafficPolicyInstanceCallable(const GetTrafficPolicyInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetTrafficPolicyInstance( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetTrafficPolicyInstance( request ); } );
 }
 
 void Route53Client::GetTrafficPolicyInstanceAsync(const GetTrafficPolicyInstanceRequest& request, const GetTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -971,6 +1231,16 @@ void Route53Client::GetTrafficPolicyInstanceAsync(const GetTrafficPolicyInstance
   m_executor->Submit( [this, request, handler, context](){ this->GetTrafficPolicyInstanceAsyncHelper( request, handler, context ); } );
 }
 
+GetTrafficPolicyInstanceOutcomeCallable Route53Client::GetTrafficPolicyInstanceCallable(GetTrafficPolicyInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::GetTrafficPolicyInstance, this, std::move(request)));
+}
+
+void Route53Client::GetTrafficPolicyInstanceAsync(GetTrafficPolicyInstanceRequest&& request, const GetTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::GetTrafficPolicyInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::GetTrafficPolicyInstanceAsyncHelper(const GetTrafficPolicyInstanceRequest& request, const GetTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetTrafficPolicyInstance(request), context);
@@ -993,7 +1263,7 @@ GetTrafficPolicyInstanceCountOutcome Route53Client::GetTrafficPolicyInstanceCoun
 
 GetTrafficPolicyInstanceCountOutcomeCallable Route53Client::GetTrafficPolicyInstanceCountCallable(const GetTrafficPolicyInstanceCountRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetTrafficPolicyInstanceCount( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetTrafficPolicyInstanceCount( request ); } );
 }
 
 void Route53Client::GetTrafficPolicyInstanceCountAsync(const GetTrafficPolicyInstanceCountRequest& request, const GetTrafficPolicyInstanceCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1001,6 +1271,16 @@ void Route53Client::GetTrafficPolicyInstanceCountAsync(const GetTrafficPolicyIns
   m_executor->Submit( [this, request, handler, context](){ this->GetTrafficPolicyInstanceCountAsyncHelper( request, handler, context ); } );
 }
 
+GetTrafficPolicyInstanceCountOutcomeCallable Route53Client::GetTrafficPolicyInstanceCountCallable(GetTrafficPolicyInstanceCountRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::GetTrafficPolicyInstanceCount, this, std::move(request)));
+}
+
+void Route53Client::GetTrafficPolicyInstanceCountAsync(GetTrafficPolicyInstanceCountRequest&& request, const GetTrafficPolicyInstanceCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::GetTrafficPolicyInstanceCountAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::GetTrafficPolicyInstanceCountAsyncHelper(const GetTrafficPolicyInstanceCountRequest& request, const GetTrafficPolicyInstanceCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetTrafficPolicyInstanceCount(request), context);
@@ -1023,7 +1303,7 @@ ListGeoLocationsOutcome Route53Client::ListGeoLocations(const ListGeoLocationsRe
 
 ListGeoLocationsOutcomeCallable Route53Client::ListGeoLocationsCallable(const ListGeoLocationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListGeoLocations( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListGeoLocations( request ); } );
 }
 
 void Route53Client::ListGeoLocationsAsync(const ListGeoLocationsRequest& request, const ListGeoLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1031,6 +1311,16 @@ void Route53Client::ListGeoLocationsAsync(const ListGeoLocationsRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->ListGeoLocationsAsyncHelper( request, handler, context ); } );
 }
 
+ListGeoLocationsOutcomeCallable Route53Client::ListGeoLocationsCallable(ListGeoLocationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::ListGeoLocations, this, std::move(request)));
+}
+
+void Route53Client::ListGeoLocationsAsync(ListGeoLocationsRequest&& request, const ListGeoLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::ListGeoLocationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::ListGeoLocationsAsyncHelper(const ListGeoLocationsRequest& request, const ListGeoLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListGeoLocations(request), context);
@@ -1053,7 +1343,7 @@ ListHealthChecksOutcome Route53Client::ListHealthChecks(const ListHealthChecksRe
 
 ListHealthChecksOutcomeCallable Route53Client::ListHealthChecksCallable(const ListHealthChecksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListHealthChecks( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListHealthChecks( request ); } );
 }
 
 void Route53Client::ListHealthChecksAsync(const ListHealthChecksRequest& request, const ListHealthChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1061,6 +1351,16 @@ void Route53Client::ListHealthChecksAsync(const ListHealthChecksRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->ListHealthChecksAsyncHelper( request, handler, context ); } );
 }
 
+ListHealthChecksOutcomeCallable Route53Client::ListHealthChecksCallable(ListHealthChecksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::ListHealthChecks, this, std::move(request)));
+}
+
+void Route53Client::ListHealthChecksAsync(ListHealthChecksRequest&& request, const ListHealthChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::ListHealthChecksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::ListHealthChecksAsyncHelper(const ListHealthChecksRequest& request, const ListHealthChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListHealthChecks(request), context);
@@ -1083,7 +1383,7 @@ ListHostedZonesOutcome Route53Client::ListHostedZones(const ListHostedZonesReque
 
 ListHostedZonesOutcomeCallable Route53Client::ListHostedZonesCallable(const ListHostedZonesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListHostedZones( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListHostedZones( request ); } );
 }
 
 void Route53Client::ListHostedZonesAsync(const ListHostedZonesRequest& request, const ListHostedZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1091,6 +1391,16 @@ void Route53Client::ListHostedZonesAsync(const ListHostedZonesRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ListHostedZonesAsyncHelper( request, handler, context ); } );
 }
 
+ListHostedZonesOutcomeCallable Route53Client::ListHostedZonesCallable(ListHostedZonesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::ListHostedZones, this, std::move(request)));
+}
+
+void Route53Client::ListHostedZonesAsync(ListHostedZonesRequest&& request, const ListHostedZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::ListHostedZonesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::ListHostedZonesAsyncHelper(const ListHostedZonesRequest& request, const ListHostedZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListHostedZones(request), context);
@@ -1113,7 +1423,7 @@ ListHostedZonesByNameOutcome Route53Client::ListHostedZonesByName(const ListHost
 
 ListHostedZonesByNameOutcomeCallable Route53Client::ListHostedZonesByNameCallable(const ListHostedZonesByNameRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListHostedZonesByName( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListHostedZonesByName( request ); } );
 }
 
 void Route53Client::ListHostedZonesByNameAsync(const ListHostedZonesByNameRequest& request, const ListHostedZonesByNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1121,6 +1431,16 @@ void Route53Client::ListHostedZonesByNameAsync(const ListHostedZonesByNameReques
   m_executor->Submit( [this, request, handler, context](){ this->ListHostedZonesByNameAsyncHelper( request, handler, context ); } );
 }
 
+ListHostedZonesByNameOutcomeCallable Route53Client::ListHostedZonesByNameCallable(ListHostedZonesByNameRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::ListHostedZonesByName, this, std::move(request)));
+}
+
+void Route53Client::ListHostedZonesByNameAsync(ListHostedZonesByNameRequest&& request, const ListHostedZonesByNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::ListHostedZonesByNameAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::ListHostedZonesByNameAsyncHelper(const ListHostedZonesByNameRequest& request, const ListHostedZonesByNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListHostedZonesByName(request), context);
@@ -1145,7 +1465,7 @@ ListResourceRecordSetsOutcome Route53Client::ListResourceRecordSets(const ListRe
 
 ListResourceRecordSetsOutcomeCallable Route53Client::ListResourceRecordSetsCallable(const ListResourceRecordSetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListResourceRecordSets( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListResourceRecordSets( request ); } );
 }
 
 void Route53Client::ListResourceRecordSetsAsync(const ListResourceRecordSetsRequest& request, const ListResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1153,6 +1473,16 @@ void Route53Client::ListResourceRecordSetsAsync(const ListResourceRecordSetsRequ
   m_executor->Submit( [this, request, handler, context](){ this->ListResourceRecordSetsAsyncHelper( request, handler, context ); } );
 }
 
+ListResourceRecordSetsOutcomeCallable Route53Client::ListResourceRecordSetsCallable(ListResourceRecordSetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::ListResourceRecordSets, this, std::move(request)));
+}
+
+void Route53Client::ListResourceRecordSetsAsync(ListResourceRecordSetsRequest&& request, const ListResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::ListResourceRecordSetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::ListResourceRecordSetsAsyncHelper(const ListResourceRecordSetsRequest& request, const ListResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListResourceRecordSets(request), context);
@@ -1175,7 +1505,7 @@ ListReusableDelegationSetsOutcome Route53Client::ListReusableDelegationSets(cons
 
 ListReusableDelegationSetsOutcomeCallable Route53Client::ListReusableDelegationSetsCallable(const ListReusableDelegationSetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListReusableDelegationSets( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListReusableDelegationSets( request ); } );
 }
 
 void Route53Client::ListReusableDelegationSetsAsync(const ListReusableDelegationSetsRequest& request, const ListReusableDelegationSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1183,6 +1513,16 @@ void Route53Client::ListReusableDelegationSetsAsync(const ListReusableDelegation
   m_executor->Submit( [this, request, handler, context](){ this->ListReusableDelegationSetsAsyncHelper( request, handler, context ); } );
 }
 
+ListReusableDelegationSetsOutcomeCallable Route53Client::ListReusableDelegationSetsCallable(ListReusableDelegationSetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::ListReusableDelegationSets, this, std::move(request)));
+}
+
+void Route53Client::ListReusableDelegationSetsAsync(ListReusableDelegationSetsRequest&& request, const ListReusableDelegationSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::ListReusableDelegationSetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::ListReusableDelegationSetsAsyncHelper(const ListReusableDelegationSetsRequest& request, const ListReusableDelegationSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListReusableDelegationSets(request), context);
@@ -1208,7 +1548,7 @@ ListTagsForResourceOutcome Route53Client::ListTagsForResource(const ListTagsForR
 
 ListTagsForResourceOutcomeCallable Route53Client::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTagsForResource( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTagsForResource( request ); } );
 }
 
 void Route53Client::ListTagsForResourceAsync(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1216,6 +1556,16 @@ void Route53Client::ListTagsForResourceAsync(const ListTagsForResourceRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsForResourceAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsForResourceOutcomeCallable Route53Client::ListTagsForResourceCallable(ListTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::ListTagsForResource, this, std::move(request)));
+}
+
+void Route53Client::ListTagsForResourceAsync(ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::ListTagsForResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTagsForResource(request), context);
@@ -1239,7 +1589,7 @@ ListTagsForResourcesOutcome Route53Client::ListTagsForResources(const ListTagsFo
 
 ListTagsForResourcesOutcomeCallable Route53Client::ListTagsForResourcesCallable(const ListTagsForResourcesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTagsForResources( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTagsForResources( request ); } );
 }
 
 void Route53Client::ListTagsForResourcesAsync(const ListTagsForResourcesRequest& request, const ListTagsForResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1247,6 +1597,16 @@ void Route53Client::ListTagsForResourcesAsync(const ListTagsForResourcesRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsForResourcesAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsForResourcesOutcomeCallable Route53Client::ListTagsForResourcesCallable(ListTagsForResourcesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::ListTagsForResources, this, std::move(request)));
+}
+
+void Route53Client::ListTagsForResourcesAsync(ListTagsForResourcesRequest&& request, const ListTagsForResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::ListTagsForResourcesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::ListTagsForResourcesAsyncHelper(const ListTagsForResourcesRequest& request, const ListTagsForResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTagsForResources(request), context);
@@ -1269,7 +1629,7 @@ ListTrafficPoliciesOutcome Route53Client::ListTrafficPolicies(const ListTrafficP
 
 ListTrafficPoliciesOutcomeCallable Route53Client::ListTrafficPoliciesCallable(const ListTrafficPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTrafficPolicies( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTrafficPolicies( request ); } );
 }
 
 void Route53Client::ListTrafficPoliciesAsync(const ListTrafficPoliciesRequest& request, const ListTrafficPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1277,6 +1637,16 @@ void Route53Client::ListTrafficPoliciesAsync(const ListTrafficPoliciesRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->ListTrafficPoliciesAsyncHelper( request, handler, context ); } );
 }
 
+ListTrafficPoliciesOutcomeCallable Route53Client::ListTrafficPoliciesCallable(ListTrafficPoliciesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::ListTrafficPolicies, this, std::move(request)));
+}
+
+void Route53Client::ListTrafficPoliciesAsync(ListTrafficPoliciesRequest&& request, const ListTrafficPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::ListTrafficPoliciesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::ListTrafficPoliciesAsyncHelper(const ListTrafficPoliciesRequest& request, const ListTrafficPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTrafficPolicies(request), context);
@@ -1299,7 +1669,7 @@ ListTrafficPolicyInstancesOutcome Route53Client::ListTrafficPolicyInstances(cons
 
 ListTrafficPolicyInstancesOutcomeCallable Route53Client::ListTrafficPolicyInstancesCallable(const ListTrafficPolicyInstancesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTrafficPolicyInstances( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTrafficPolicyInstances( request ); } );
 }
 
 void Route53Client::ListTrafficPolicyInstancesAsync(const ListTrafficPolicyInstancesRequest& request, const ListTrafficPolicyInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1307,6 +1677,16 @@ void Route53Client::ListTrafficPolicyInstancesAsync(const ListTrafficPolicyInsta
   m_executor->Submit( [this, request, handler, context](){ this->ListTrafficPolicyInstancesAsyncHelper( request, handler, context ); } );
 }
 
+ListTrafficPolicyInstancesOutcomeCallable Route53Client::ListTrafficPolicyInstancesCallable(ListTrafficPolicyInstancesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::ListTrafficPolicyInstances, this, std::move(request)));
+}
+
+void Route53Client::ListTrafficPolicyInstancesAsync(ListTrafficPolicyInstancesRequest&& request, const ListTrafficPolicyInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::ListTrafficPolicyInstancesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::ListTrafficPolicyInstancesAsyncHelper(const ListTrafficPolicyInstancesRequest& request, const ListTrafficPolicyInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTrafficPolicyInstances(request), context);
@@ -1329,7 +1709,7 @@ ListTrafficPolicyInstancesByHostedZoneOutcome Route53Client::ListTrafficPolicyIn
 
 ListTrafficPolicyInstancesByHostedZoneOutcomeCallable Route53Client::ListTrafficPolicyInstancesByHostedZoneCallable(const ListTrafficPolicyInstancesByHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTrafficPolicyInstancesByHostedZone( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTrafficPolicyInstancesByHostedZone( request ); } );
 }
 
 void Route53Client::ListTrafficPolicyInstancesByHostedZoneAsync(const ListTrafficPolicyInstancesByHostedZoneRequest& request, const ListTrafficPolicyInstancesByHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1337,6 +1717,16 @@ void Route53Client::ListTrafficPolicyInstancesByHostedZoneAsync(const ListTraffi
   m_executor->Submit( [this, request, handler, context](){ this->ListTrafficPolicyInstancesByHostedZoneAsyncHelper( request, handler, context ); } );
 }
 
+ListTrafficPolicyInstancesByHostedZoneOutcomeCallable Route53Client::ListTrafficPolicyInstancesByHostedZoneCallable(ListTrafficPolicyInstancesByHostedZoneRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::ListTrafficPolicyInstancesByHostedZone, this, std::move(request)));
+}
+
+void Route53Client::ListTrafficPolicyInstancesByHostedZoneAsync(ListTrafficPolicyInstancesByHostedZoneRequest&& request, const ListTrafficPolicyInstancesByHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::ListTrafficPolicyInstancesByHostedZoneAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::ListTrafficPolicyInstancesByHostedZoneAsyncHelper(const ListTrafficPolicyInstancesByHostedZoneRequest& request, const ListTrafficPolicyInstancesByHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTrafficPolicyInstancesByHostedZone(request), context);
@@ -1359,7 +1749,7 @@ ListTrafficPolicyInstancesByPolicyOutcome Route53Client::ListTrafficPolicyInstan
 
 ListTrafficPolicyInstancesByPolicyOutcomeCallable Route53Client::ListTrafficPolicyInstancesByPolicyCallable(const ListTrafficPolicyInstancesByPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTrafficPolicyInstancesByPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTrafficPolicyInstancesByPolicy( request ); } );
 }
 
 void Route53Client::ListTrafficPolicyInstancesByPolicyAsync(const ListTrafficPolicyInstancesByPolicyRequest& request, const ListTrafficPolicyInstancesByPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1367,6 +1757,16 @@ void Route53Client::ListTrafficPolicyInstancesByPolicyAsync(const ListTrafficPol
   m_executor->Submit( [this, request, handler, context](){ this->ListTrafficPolicyInstancesByPolicyAsyncHelper( request, handler, context ); } );
 }
 
+ListTrafficPolicyInstancesByPolicyOutcomeCallable Route53Client::ListTrafficPolicyInstancesByPolicyCallable(ListTrafficPolicyInstancesByPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::ListTrafficPolicyInstancesByPolicy, this, std::move(request)));
+}
+
+void Route53Client::ListTrafficPolicyInstancesByPolicyAsync(ListTrafficPolicyInstancesByPolicyRequest&& request, const ListTrafficPolicyInstancesByPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::ListTrafficPolicyInstancesByPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::ListTrafficPolicyInstancesByPolicyAsyncHelper(const ListTrafficPolicyInstancesByPolicyRequest& request, const ListTrafficPolicyInstancesByPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTrafficPolicyInstancesByPolicy(request), context);
@@ -1391,7 +1791,7 @@ ListTrafficPolicyVersionsOutcome Route53Client::ListTrafficPolicyVersions(const
 
 ListTrafficPolicyVersionsOutcomeCallable Route53Client::ListTrafficPolicyVersionsCallable(const ListTrafficPolicyVersionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTrafficPolicyVersions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTrafficPolicyVersions( request ); } );
 }
 
 void Route53Client::ListTrafficPolicyVersionsAsync(const ListTrafficPolicyVersionsRequest& request, const ListTrafficPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1399,6 +1799,16 @@ void Route53Client::ListTrafficPolicyVersionsAsync(const ListTrafficPolicyVersio
   m_executor->Submit( [this, request, handler, context](){ this->ListTrafficPolicyVersionsAsyncHelper( request, handler, context ); } );
 }
 
+ListTrafficPolicyVersionsOutcomeCallable Route53Client::ListTrafficPolicyVersionsCallable(ListTrafficPolicyVersionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::ListTrafficPolicyVersions, this, std::move(request)));
+}
+
+void Route53Client::ListTrafficPolicyVersionsAsync(ListTrafficPolicyVersionsRequest&& request, const ListTrafficPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::ListTrafficPolicyVersionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::ListTrafficPolicyVersionsAsyncHelper(const ListTrafficPolicyVersionsRequest& request, const ListTrafficPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTrafficPolicyVersions(request), context);
@@ -1422,7 +1832,7 @@ UpdateHealthCheckOutcome Route53Client::UpdateHealthCheck(const UpdateHealthChec
 
 UpdateHealthCheckOutcomeCallable Route53Client::UpdateHealthCheckCallable(const UpdateHealthCheckRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateHealthCheck( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateHealthCheck( request ); } );
 }
 
 void Route53Client::UpdateHealthCheckAsync(const UpdateHealthCheckRequest& request, const UpdateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1430,6 +1840,16 @@ void Route53Client::UpdateHealthCheckAsync(const UpdateHealthCheckRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->UpdateHealthCheckAsyncHelper( request, handler, context ); } );
 }
 
+UpdateHealthCheckOutcomeCallable Route53Client::UpdateHealthCheckCallable(UpdateHealthCheckRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::UpdateHealthCheck, this, std::move(request)));
+}
+
+void Route53Client::UpdateHealthCheckAsync(UpdateHealthCheckRequest&& request, const UpdateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::UpdateHealthCheckAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::UpdateHealthCheckAsyncHelper(const UpdateHealthCheckRequest& request, const UpdateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateHealthCheck(request), context);
@@ -1453,7 +1873,7 @@ UpdateHostedZoneCommentOutcome Route53Client::UpdateHostedZoneComment(const Upda
 
 UpdateHostedZoneCommentOutcomeCallable Route53Client::UpdateHostedZoneCommentCallable(const UpdateHostedZoneCommentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateHostedZoneComment( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateHostedZoneComment( request ); } );
 }
 
 void Route53Client::UpdateHostedZoneCommentAsync(const UpdateHostedZoneCommentRequest& request, const UpdateHostedZoneCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1461,6 +1881,16 @@ void Route53Client::UpdateHostedZoneCommentAsync(const UpdateHostedZoneCommentRe
   m_executor->Submit( [this, request, handler, context](){ this->UpdateHostedZoneCommentAsyncHelper( request, handler, context ); } );
 }
 
+UpdateHostedZoneCommentOutcomeCallable Route53Client::UpdateHostedZoneCommentCallable(UpdateHostedZoneCommentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::UpdateHostedZoneComment, this, std::move(request)));
+}
+
+void Route53Client::UpdateHostedZoneCommentAsync(UpdateHostedZoneCommentRequest&& request, const UpdateHostedZoneCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::UpdateHostedZoneCommentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::UpdateHostedZoneCommentAsyncHelper(const UpdateHostedZoneCommentRequest& request, const UpdateHostedZoneCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateHostedZoneComment(request), context);
@@ -1486,7 +1916,7 @@ UpdateTrafficPolicyCommentOutcome Route53Client::UpdateTrafficPolicyComment(cons
 
 UpdateTrafficPolicyCommentOutcomeCallable Route53Client::UpdateTrafficPolicyCommentCallable(const UpdateTrafficPolicyCommentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateTrafficPolicyComment( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateTrafficPolicyComment( request ); } );
 }
 
 void Route53Client::UpdateTrafficPolicyCommentAsync(const UpdateTrafficPolicyCommentRequest& request, const UpdateTrafficPolicyCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1494,6 +1924,16 @@ void Route53Client::UpdateTrafficPolicyCommentAsync(const UpdateTrafficPolicyCom
   m_executor->Submit( [this, request, handler, context](){ this->UpdateTrafficPolicyCommentAsyncHelper( request, handler, context ); } );
 }
 
+UpdateTrafficPolicyCommentOutcomeCallable Route53Client::UpdateTrafficPolicyCommentCallable(UpdateTrafficPolicyCommentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::UpdateTrafficPolicyComment, this, std::move(request)));
+}
+
+void Route53Client::UpdateTrafficPolicyCommentAsync(UpdateTrafficPolicyCommentRequest&& request, const UpdateTrafficPolicyCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::UpdateTrafficPolicyCommentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::UpdateTrafficPolicyCommentAsyncHelper(const UpdateTrafficPolicyCommentRequest& request, const UpdateTrafficPolicyCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateTrafficPolicyComment(request), context);
@@ -1517,7 +1957,7 @@ UpdateTrafficPolicyInstanceOutcome Route53Client::UpdateTrafficPolicyInstance(co
 
 UpdateTrafficPolicyInstanceOutcomeCallable Route53Client::UpdateTrafficPolicyInstanceCallable(const UpdateTrafficPolicyInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateTrafficPolicyInstance( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateTrafficPolicyInstance( request ); } );
 }
 
 void Route53Client::UpdateTrafficPolicyInstanceAsync(const UpdateTrafficPolicyInstanceRequest& request, const UpdateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1525,8 +1965,308 @@ void Route53Client::UpdateTrafficPolicyInstanceAsync(const UpdateTrafficPolicyIn
   m_executor->Submit( [this, request, handler, context](){ this->UpdateTrafficPolicyInstanceAsyncHelper( request, handler, context ); } );
 }
 
+UpdateTrafficPolicyInstanceOutcomeCallable Route53Client::UpdateTrafficPolicyInstanceCallable(UpdateTrafficPolicyInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53Client::UpdateTrafficPolicyInstance, this, std::move(request)));
+}
+
+void Route53Client::UpdateTrafficPolicyInstanceAsync(UpdateTrafficPolicyInstanceRequest&& request, const UpdateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53Client::UpdateTrafficPolicyInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53Client::UpdateTrafficPolicyInstanceAsyncHelper(const UpdateTrafficPolicyInstanceRequest& request, const UpdateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateTrafficPolicyInstance(request), context);
 }
 
+Paginator<Route53Client, ListHealthChecksRequest, ListHealthChecksOutcome> Route53Client::ListHealthChecksPaginator(const ListHealthChecksRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<Route53Client, ListHealthChecksRequest, ListHealthChecksOutcome>(this, &Route53Client::ListHealthChecks, request,
+    [](const ListHealthChecksRequest& current, const ListHealthChecksOutcome& outcome, ListHealthChecksRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<Route53Client, ListHostedZonesRequest, ListHostedZonesOutcome> Route53Client::ListHostedZonesPaginator(const ListHostedZonesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<Route53Client, ListHostedZonesRequest, ListHostedZonesOutcome>(this, &Route53Client::ListHostedZones, request,
+    [](const ListHostedZonesRequest& current, const ListHostedZonesOutcome& outcome, ListHostedZonesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<Route53Client, ListReusableDelegationSetsRequest, ListReusableDelegationSetsOutcome> Route53Client::ListReusableDelegationSetsPaginator(const ListReusableDelegationSetsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<Route53Client, ListReusableDelegationSetsRequest, ListReusableDelegationSetsOutcome>(this, &Route53Client::ListReusableDelegationSets, request,
+    [](const ListReusableDelegationSetsRequest& current, const ListReusableDelegationSetsOutcome& outcome, ListReusableDelegationSetsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<Route53Client, AssociateVPCWithHostedZoneRequest, AssociateVPCWithHostedZoneOutcome> Route53Client::AssociateVPCWithHostedZoneAwaitable(AssociateVPCWithHostedZoneRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::AssociateVPCWithHostedZone, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, ChangeResourceRecordSetsRequest, ChangeResourceRecordSetsOutcome> Route53Client::ChangeResourceRecordSetsAwaitable(ChangeResourceRecordSetsRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::ChangeResourceRecordSets, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, ChangeTagsForResourceRequest, ChangeTagsForResourceOutcome> Route53Client::ChangeTagsForResourceAwaitable(ChangeTagsForResourceRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::ChangeTagsForResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, CreateHealthCheckRequest, CreateHealthCheckOutcome> Route53Client::CreateHealthCheckAwaitable(CreateHealthCheckRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::CreateHealthCheck, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, CreateHostedZoneRequest, CreateHostedZoneOutcome> Route53Client::CreateHostedZoneAwaitable(CreateHostedZoneRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::CreateHostedZone, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, CreateReusableDelegationSetRequest, CreateReusableDelegationSetOutcome> Route53Client::CreateReusableDelegationSetAwaitable(CreateReusableDelegationSetRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::CreateReusableDelegationSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, CreateTrafficPolicyRequest, CreateTrafficPolicyOutcome> Route53Client::CreateTrafficPolicyAwaitable(CreateTrafficPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::CreateTrafficPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, CreateTrafficPolicyInstanceRequest, CreateTrafficPolicyInstanceOutcome> Route53Client::CreateTrafficPolicyInstanceAwaitable(CreateTrafficPolicyInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::CreateTrafficPolicyInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, CreateTrafficPolicyVersionRequest, CreateTrafficPolicyVersionOutcome> Route53Client::CreateTrafficPolicyVersionAwaitable(CreateTrafficPolicyVersionRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::CreateTrafficPolicyVersion, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, DeleteHealthCheckRequest, DeleteHealthCheckOutcome> Route53Client::DeleteHealthCheckAwaitable(DeleteHealthCheckRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::DeleteHealthCheck, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, DeleteHostedZoneRequest, DeleteHostedZoneOutcome> Route53Client::DeleteHostedZoneAwaitable(DeleteHostedZoneRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::DeleteHostedZone, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, DeleteReusableDelegationSetRequest, DeleteReusableDelegationSetOutcome> Route53Client::DeleteReusableDelegationSetAwaitable(DeleteReusableDelegationSetRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::DeleteReusableDelegationSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, DeleteTrafficPolicyRequest, DeleteTrafficPolicyOutcome> Route53Client::DeleteTrafficPolicyAwaitable(DeleteTrafficPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::DeleteTrafficPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, DeleteTrafficPolicyInstanceRequest, DeleteTrafficPolicyInstanceOutcome> Route53Client::DeleteTrafficPolicyInstanceAwaitable(DeleteTrafficPolicyInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::DeleteTrafficPolicyInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, DisassociateVPCFromHostedZoneRequest, DisassociateVPCFromHostedZoneOutcome> Route53Client::DisassociateVPCFromHostedZoneAwaitable(DisassociateVPCFromHostedZoneRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::DisassociateVPCFromHostedZone, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, GetChangeRequest, GetChangeOutcome> Route53Client::GetChangeAwaitable(GetChangeRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::GetChange, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, GetCheckerIpRangesRequest, GetCheckerIpRangesOutcome> Route53Client::GetCheckerIpRangesAwaitable(GetCheckerIpRangesRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::GetCheckerIpRanges, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, GetGeoLocationRequest, GetGeoLocationOutcome> Route53Client::GetGeoLocationAwaitable(GetGeoLocationRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::GetGeoLocation, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, GetHealthCheckRequest, GetHealthCheckOutcome> Route53Client::GetHealthCheckAwaitable(GetHealthCheckRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::GetHealthCheck, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, GetHealthCheckCountRequest, GetHealthCheckCountOutcome> Route53Client::GetHealthCheckCountAwaitable(GetHealthCheckCountRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::GetHealthCheckCount, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, GetHealthCheckLastFailureReasonRequest, GetHealthCheckLastFailureReasonOutcome> Route53Client::GetHealthCheckLastFailureReasonAwaitable(GetHealthCheckLastFailureReasonRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::GetHealthCheckLastFailureReason, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, GetHealthCheckStatusRequest, GetHealthCheckStatusOutcome> Route53Client::GetHealthCheckStatusAwaitable(GetHealthCheckStatusRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::GetHealthCheckStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, GetHostedZoneRequest, GetHostedZoneOutcome> Route53Client::GetHostedZoneAwaitable(GetHostedZoneRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::GetHostedZone, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, GetHostedZoneCountRequest, GetHostedZoneCountOutcome> Route53Client::GetHostedZoneCountAwaitable(GetHostedZoneCountRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::GetHostedZoneCount, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, GetReusableDelegationSetRequest, GetReusableDelegationSetOutcome> Route53Client::GetReusableDelegationSetAwaitable(GetReusableDelegationSetRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::GetReusableDelegationSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, GetTrafficPolicyRequest, GetTrafficPolicyOutcome> Route53Client::GetTrafficPolicyAwaitable(GetTrafficPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::GetTrafficPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, GetTrafficPolicyInstanceRequest, GetTrafficPolicyInstanceOutcome> Route53Client::GetTrafficPolicyInstanceAwaitable(GetTrafficPolicyInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::GetTrafficPolicyInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, GetTrafficPolicyInstanceCountRequest, GetTrafficPolicyInstanceCountOutcome> Route53Client::GetTrafficPolicyInstanceCountAwaitable(GetTrafficPolicyInstanceCountRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::GetTrafficPolicyInstanceCount, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, ListGeoLocationsRequest, ListGeoLocationsOutcome> Route53Client::ListGeoLocationsAwaitable(ListGeoLocationsRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::ListGeoLocations, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, ListHealthChecksRequest, ListHealthChecksOutcome> Route53Client::ListHealthChecksAwaitable(ListHealthChecksRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::ListHealthChecks, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, ListHostedZonesRequest, ListHostedZonesOutcome> Route53Client::ListHostedZonesAwaitable(ListHostedZonesRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::ListHostedZones, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, ListHostedZonesByNameRequest, ListHostedZonesByNameOutcome> Route53Client::ListHostedZonesByNameAwaitable(ListHostedZonesByNameRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::ListHostedZonesByName, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, ListResourceRecordSetsRequest, ListResourceRecordSetsOutcome> Route53Client::ListResourceRecordSetsAwaitable(ListResourceRecordSetsRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::ListResourceRecordSets, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, ListReusableDelegationSetsRequest, ListReusableDelegationSetsOutcome> Route53Client::ListReusableDelegationSetsAwaitable(ListReusableDelegationSetsRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::ListReusableDelegationSets, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, ListTagsForResourceRequest, ListTagsForResourceOutcome> Route53Client::ListTagsForResourceAwaitable(ListTagsForResourceRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::ListTagsForResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, ListTagsForResourcesRequest, ListTagsForResourcesOutcome> Route53Client::ListTagsForResourcesAwaitable(ListTagsForResourcesRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::ListTagsForResources, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, ListTrafficPoliciesRequest, ListTrafficPoliciesOutcome> Route53Client::ListTrafficPoliciesAwaitable(ListTrafficPoliciesRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::ListTrafficPolicies, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, ListTrafficPolicyInstancesRequest, ListTrafficPolicyInstancesOutcome> Route53Client::ListTrafficPolicyInstancesAwaitable(ListTrafficPolicyInstancesRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::ListTrafficPolicyInstances, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, ListTrafficPolicyInstancesByHostedZoneRequest, ListTrafficPolicyInstancesByHostedZoneOutcome> Route53Client::ListTrafficPolicyInstancesByHostedZoneAwaitable(ListTrafficPolicyInstancesByHostedZoneRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::ListTrafficPolicyInstancesByHostedZone, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, ListTrafficPolicyInstancesByPolicyRequest, ListTrafficPolicyInstancesByPolicyOutcome> Route53Client::ListTrafficPolicyInstancesByPolicyAwaitable(ListTrafficPolicyInstancesByPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::ListTrafficPolicyInstancesByPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, ListTrafficPolicyVersionsRequest, ListTrafficPolicyVersionsOutcome> Route53Client::ListTrafficPolicyVersionsAwaitable(ListTrafficPolicyVersionsRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::ListTrafficPolicyVersions, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, UpdateHealthCheckRequest, UpdateHealthCheckOutcome> Route53Client::UpdateHealthCheckAwaitable(UpdateHealthCheckRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::UpdateHealthCheck, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, UpdateHostedZoneCommentRequest, UpdateHostedZoneCommentOutcome> Route53Client::UpdateHostedZoneCommentAwaitable(UpdateHostedZoneCommentRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::UpdateHostedZoneComment, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, UpdateTrafficPolicyCommentRequest, UpdateTrafficPolicyCommentOutcome> Route53Client::UpdateTrafficPolicyCommentAwaitable(UpdateTrafficPolicyCommentRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::UpdateTrafficPolicyComment, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53Client, UpdateTrafficPolicyInstanceRequest, UpdateTrafficPolicyInstanceOutcome> Route53Client::UpdateTrafficPolicyInstanceAwaitable(UpdateTrafficPolicyInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &Route53Client::UpdateTrafficPolicyInstance, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
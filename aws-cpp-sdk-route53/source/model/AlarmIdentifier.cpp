@@ -51,13 +51,13 @@ AlarmIdentifier& AlarmIdentifier::operator =(const XmlNode& xmlNode)
     XmlNode regionNode = resultNode.FirstChild("Region");
     if(!regionNode.IsNull())
     {
-      m_region = CloudWatchRegionMapper::GetCloudWatchRegionForName(StringUtils::Trim(regionNode.GetText().c_str()).c_str());
+      m_region = CloudWatchRegionMapper::GetCloudWatchRegionForName(regionNode.GetTextView().Trim().ToString().c_str());
       m_regionHasBeenSet = true;
     }
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
   }
@@ -55,19 +55,19 @@ AliasTarget& AliasTarget::operator =(const XmlNode& xmlNode)
     XmlNode hostedZoneIdNode = resultNode.FirstChild("HostedZoneId");
     if(!hostedZoneIdNode.IsNull())
     {
-      m_hostedZoneId = StringUtils::Trim(hostedZoneIdNode.GetText().c_str());
+      m_hostedZoneId = hostedZoneIdNode.GetTextView().Trim().ToString();
       m_hostedZoneIdHasBeenSet = true;
     }
     XmlNode dNSNameNode = resultNode.FirstChild("DNSName");
     if(!dNSNameNode.IsNull())
     {
-      m_dNSName = StringUtils::Trim(dNSNameNode.GetText().c_str());
+      m_dNSName = dNSNameNode.GetTextView().Trim().ToString();
       m_dNSNameHasBeenSet = true;
     }
     XmlNode evaluateTargetHealthNode = resultNode.FirstChild("EvaluateTargetHealth");
     if(!evaluateTargetHealthNode.IsNull())
     {
-      m_evaluateTargetHealth = StringUtils::ConvertToBool(StringUtils::Trim(evaluateTargetHealthNode.GetText().c_str()).c_str());
+      m_evaluateTargetHealth = StringUtils::ConvertToBool(evaluateTargetHealthNode.GetTextView().Trim().ToString().c_str());
       m_evaluateTargetHealthHasBeenSet = true;
     }
   }
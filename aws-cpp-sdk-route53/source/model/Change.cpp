@@ -51,7 +51,7 @@ Change& Change::operator =(const XmlNode& xmlNode)
     XmlNode actionNode = resultNode.FirstChild("Action");
     if(!actionNode.IsNull())
     {
-      m_action = ChangeActionMapper::GetChangeActionForName(StringUtils::Trim(actionNode.GetText().c_str()).c_str());
+      m_action = ChangeActionMapper::GetChangeActionForName(actionNode.GetTextView().Trim().ToString().c_str());
       m_actionHasBeenSet = true;
     }
     XmlNode resourceRecordSetNode = resultNode.FirstChild("ResourceRecordSet");
@@ -29,26 +29,32 @@ namespace Aws
       namespace ChangeActionMapper
       {
 
-        static const int CREATE_HASH = HashingUtils::HashString("CREATE");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
-        static const int UPSERT_HASH = HashingUtils::HashString("UPSERT");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CREATE_HASH = 1996002556;
+        static const int DELETE__HASH = 2012838315;
+        static const int UPSERT_HASH = -1785066193;
 
 
         ChangeAction GetChangeActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_HASH)
+          switch (hashCode)
           {
+          case CREATE_HASH:
             return ChangeAction::CREATE;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
+          case DELETE__HASH:
             return ChangeAction::DELETE_;
-          }
-          else if (hashCode == UPSERT_HASH)
-          {
+          case UPSERT_HASH:
             return ChangeAction::UPSERT;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -59,31 +59,31 @@ ChangeBatchRecord& ChangeBatchRecord::operator =(const XmlNode& xmlNode)
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode submittedAtNode = resultNode.FirstChild("SubmittedAt");
     if(!submittedAtNode.IsNull())
     {
-      m_submittedAt = DateTime(StringUtils::Trim(submittedAtNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_submittedAt = DateTime(submittedAtNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_submittedAtHasBeenSet = true;
     }
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = ChangeStatusMapper::GetChangeStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = ChangeStatusMapper::GetChangeStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
       m_statusHasBeenSet = true;
     }
     XmlNode commentNode = resultNode.FirstChild("Comment");
     if(!commentNode.IsNull())
     {
-      m_comment = StringUtils::Trim(commentNode.GetText().c_str());
+      m_comment = commentNode.GetTextView().Trim().ToString();
       m_commentHasBeenSet = true;
     }
     XmlNode submitterNode = resultNode.FirstChild("Submitter");
     if(!submitterNode.IsNull())
     {
-      m_submitter = StringUtils::Trim(submitterNode.GetText().c_str());
+      m_submitter = submitterNode.GetTextView().Trim().ToString();
       m_submitterHasBeenSet = true;
     }
     XmlNode changesNode = resultNode.FirstChild("Changes");
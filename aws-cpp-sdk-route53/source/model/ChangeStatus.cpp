@@ -29,21 +29,29 @@ namespace Aws
       namespace ChangeStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int INSYNC_HASH = HashingUtils::HashString("INSYNC");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PENDING_HASH = 35394935;
+        static const int INSYNC_HASH = -2130443968;
 
 
         ChangeStatus GetChangeStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          switch (hashCode)
           {
+          case PENDING_HASH:
             return ChangeStatus::PENDING;
-          }
-          else if (hashCode == INSYNC_HASH)
-          {
+          case INSYNC_HASH:
             return ChangeStatus::INSYNC;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -46,7 +46,7 @@ GetCheckerIpRangesResult& GetCheckerIpRangesResult::operator =(const AmazonWebSe
       XmlNode checkerIpRangesMember = checkerIpRangesNode.FirstChild("member");
       while(!checkerIpRangesMember.IsNull())
       {
-        m_checkerIpRanges.push_back(StringUtils::Trim(checkerIpRangesMember.GetText().c_str()));
+        m_checkerIpRanges.push_back(checkerIpRangesMember.GetTextView().Trim().ToString());
         checkerIpRangesMember = checkerIpRangesMember.NextNode("member");
       }
 
@@ -45,7 +45,7 @@ GetHealthCheckCountResult& GetHealthCheckCountResult::operator =(const AmazonWeb
     XmlNode healthCheckCountNode = resultNode.FirstChild("HealthCheckCount");
     if(!healthCheckCountNode.IsNull())
     {
-      m_healthCheckCount = StringUtils::ConvertToInt64(StringUtils::Trim(healthCheckCountNode.GetText().c_str()).c_str());
+      m_healthCheckCount = StringUtils::ConvertToInt64(healthCheckCountNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -45,7 +45,7 @@ GetHostedZoneCountResult& GetHostedZoneCountResult::operator =(const AmazonWebSe
     XmlNode hostedZoneCountNode = resultNode.FirstChild("HostedZoneCount");
     if(!hostedZoneCountNode.IsNull())
     {
-      m_hostedZoneCount = StringUtils::ConvertToInt64(StringUtils::Trim(hostedZoneCountNode.GetText().c_str()).c_str());
+      m_hostedZoneCount = StringUtils::ConvertToInt64(hostedZoneCountNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
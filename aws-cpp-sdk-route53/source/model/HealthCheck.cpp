@@ -59,13 +59,13 @@ HealthCheck& HealthCheck::operator =(const XmlNode& xmlNode)
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode callerReferenceNode = resultNode.FirstChild("CallerReference");
     if(!callerReferenceNode.IsNull())
     {
-      m_callerReference = StringUtils::Trim(callerReferenceNode.GetText().c_str());
+      m_callerReference = callerReferenceNode.GetTextView().Trim().ToString();
       m_callerReferenceHasBeenSet = true;
     }
     XmlNode healthCheckConfigNode = resultNode.FirstChild("HealthCheckConfig");
@@ -77,7 +77,7 @@ HealthCheck& HealthCheck::operator =(const XmlNode& xmlNode)
     XmlNode healthCheckVersionNode = resultNode.FirstChild("HealthCheckVersion");
     if(!healthCheckVersionNode.IsNull())
     {
-      m_healthCheckVersion = StringUtils::ConvertToInt64(StringUtils::Trim(healthCheckVersionNode.GetText().c_str()).c_str());
+      m_healthCheckVersion = StringUtils::ConvertToInt64(healthCheckVersionNode.GetTextView().Trim().ToString().c_str());
       m_healthCheckVersionHasBeenSet = true;
     }
     XmlNode cloudWatchAlarmConfigurationNode = resultNode.FirstChild("CloudWatchAlarmConfiguration");
@@ -93,67 +93,67 @@ HealthCheckConfig& HealthCheckConfig::operator =(const XmlNode& xmlNode)
     XmlNode iPAddressNode = resultNode.FirstChild("IPAddress");
     if(!iPAddressNode.IsNull())
     {
-      m_iPAddress = StringUtils::Trim(iPAddressNode.GetText().c_str());
+      m_iPAddress = iPAddressNode.GetTextView().Trim().ToString();
       m_iPAddressHasBeenSet = true;
     }
     XmlNode portNode = resultNode.FirstChild("Port");
     if(!portNode.IsNull())
     {
-      m_port = StringUtils::ConvertToInt32(StringUtils::Trim(portNode.GetText().c_str()).c_str());
+      m_port = StringUtils::ConvertToInt32(portNode.GetTextView().Trim().ToString().c_str());
       m_portHasBeenSet = true;
     }
     XmlNode typeNode = resultNode.FirstChild("Type");
     if(!typeNode.IsNull())
     {
-      m_type = HealthCheckTypeMapper::GetHealthCheckTypeForName(StringUtils::Trim(typeNode.GetText().c_str()).c_str());
+      m_type = HealthCheckTypeMapper::GetHealthCheckTypeForName(typeNode.GetTextView().Trim().ToString().c_str());
       m_typeHasBeenSet = true;
     }
     XmlNode resourcePathNode = resultNode.FirstChild("ResourcePath");
     if(!resourcePathNode.IsNull())
     {
-      m_resourcePath = StringUtils::Trim(resourcePathNode.GetText().c_str());
+      m_resourcePath = resourcePathNode.GetTextView().Trim().ToString();
       m_resourcePathHasBeenSet = true;
     }
     XmlNode fullyQualifiedDomainNameNode = resultNode.FirstChild("FullyQualifiedDomainName");
     if(!fullyQualifiedDomainNameNode.IsNull())
     {
-      m_fullyQualifiedDomainName = StringUtils::Trim(fullyQualifiedDomainNameNode.GetText().c_str());
+      m_fullyQualifiedDomainName = fullyQualifiedDomainNameNode.GetTextView().Trim().ToString();
       m_fullyQualifiedDomainNameHasBeenSet = true;
     }
     XmlNode searchStringNode = resultNode.FirstChild("SearchString");
     if(!searchStringNode.IsNull())
     {
-      m_searchString = StringUtils::Trim(searchStringNode.GetText().c_str());
+      m_searchString = searchStringNode.GetTextView().Trim().ToString();
       m_searchStringHasBeenSet = true;
     }
     XmlNode requestIntervalNode = resultNode.FirstChild("RequestInterval");
     if(!requestIntervalNode.IsNull())
     {
-      m_requestInterval = StringUtils::ConvertToInt32(StringUtils::Trim(requestIntervalNode.GetText().c_str()).c_str());
+      m_requestInterval = StringUtils::ConvertToInt32(requestIntervalNode.GetTextView().Trim().ToString().c_str());
       m_requestIntervalHasBeenSet = true;
     }
     XmlNode failureThresholdNode = resultNode.FirstChild("FailureThreshold");
     if(!failureThresholdNode.IsNull())
     {
-      m_failureThreshold = StringUtils::ConvertToInt32(StringUtils::Trim(failureThresholdNode.GetText().c_str()).c_str());
+      m_failureThreshold = StringUtils::ConvertToInt32(failureThresholdNode.GetTextView().Trim().ToString().c_str());
       m_failureThresholdHasBeenSet = true;
     }
     XmlNode measureLatencyNode = resultNode.FirstChild("MeasureLatency");
     if(!measureLatencyNode.IsNull())
     {
-      m_measureLatency = StringUtils::ConvertToBool(StringUtils::Trim(measureLatencyNode.GetText().c_str()).c_str());
+      m_measureLatency = StringUtils::ConvertToBool(measureLatencyNode.GetTextView().Trim().ToString().c_str());
       m_measureLatencyHasBeenSet = true;
     }
     XmlNode invertedNode = resultNode.FirstChild("Inverted");
     if(!invertedNode.IsNull())
     {
-      m_inverted = StringUtils::ConvertToBool(StringUtils::Trim(invertedNode.GetText().c_str()).c_str());
+      m_inverted = StringUtils::ConvertToBool(invertedNode.GetTextView().Trim().ToString().c_str());
       m_invertedHasBeenSet = true;
     }
     XmlNode healthThresholdNode = resultNode.FirstChild("HealthThreshold");
     if(!healthThresholdNode.IsNull())
     {
-      m_healthThreshold = StringUtils::ConvertToInt32(StringUtils::Trim(healthThresholdNode.GetText().c_str()).c_str());
+      m_healthThreshold = StringUtils::ConvertToInt32(healthThresholdNode.GetTextView().Trim().ToString().c_str());
       m_healthThresholdHasBeenSet = true;
     }
     XmlNode childHealthChecksNode = resultNode.FirstChild("ChildHealthChecks");
@@ -162,7 +162,7 @@ HealthCheckConfig& HealthCheckConfig::operator =(const XmlNode& xmlNode)
       XmlNode childHealthChecksMember = childHealthChecksNode.FirstChild("ChildHealthCheck");
       while(!childHealthChecksMember.IsNull())
       {
-        m_childHealthChecks.push_back(StringUtils::Trim(childHealthChecksMember.GetText().c_str()));
+        m_childHealthChecks.push_back(childHealthChecksMember.GetTextView().Trim().ToString());
         childHealthChecksMember = childHealthChecksMember.NextNode("ChildHealthCheck");
       }
 
@@ -171,7 +171,7 @@ HealthCheckConfig& HealthCheckConfig::operator =(const XmlNode& xmlNode)
     XmlNode enableSNINode = resultNode.FirstChild("EnableSNI");
     if(!enableSNINode.IsNull())
     {
-      m_enableSNI = StringUtils::ConvertToBool(StringUtils::Trim(enableSNINode.GetText().c_str()).c_str());
+      m_enableSNI = StringUtils::ConvertToBool(enableSNINode.GetTextView().Trim().ToString().c_str());
       m_enableSNIHasBeenSet = true;
     }
     XmlNode regionsNode = resultNode.FirstChild("Regions");
@@ -180,7 +180,7 @@ HealthCheckConfig& HealthCheckConfig::operator =(const XmlNode& xmlNode)
       XmlNode regionsMember = regionsNode.FirstChild("Region");
       while(!regionsMember.IsNull())
       {
-        m_regions.push_back(HealthCheckRegionMapper::GetHealthCheckRegionForName(StringUtils::Trim(regionsMember.GetText().c_str())));
+        m_regions.push_back(HealthCheckRegionMapper::GetHealthCheckRegionForName(regionsMember.GetTextView().Trim().ToString()));
         regionsMember = regionsMember.NextNode("Region");
       }
 
@@ -195,7 +195,7 @@ HealthCheckConfig& HealthCheckConfig::operator =(const XmlNode& xmlNode)
     XmlNode insufficientDataHealthStatusNode = resultNode.FirstChild("InsufficientDataHealthStatus");
     if(!insufficientDataHealthStatusNode.IsNull())
     {
-      m_insufficientDataHealthStatus = InsufficientDataHealthStatusMapper::GetInsufficientDataHealthStatusForName(StringUtils::Trim(insufficientDataHealthStatusNode.GetText().c_str()).c_str());
+      m_insufficientDataHealthStatus = InsufficientDataHealthStatusMapper::GetInsufficientDataHealthStatusForName(insufficientDataHealthStatusNode.GetTextView().Trim().ToString().c_str());
       m_insufficientDataHealthStatusHasBeenSet = true;
     }
   }
@@ -53,13 +53,13 @@ HealthCheckObservation& HealthCheckObservation::operator =(const XmlNode& xmlNod
     XmlNode regionNode = resultNode.FirstChild("Region");
     if(!regionNode.IsNull())
     {
-      m_region = HealthCheckRegionMapper::GetHealthCheckRegionForName(StringUtils::Trim(regionNode.GetText().c_str()).c_str());
+      m_region = HealthCheckRegionMapper::GetHealthCheckRegionForName(regionNode.GetTextView().Trim().ToString().c_str());
       m_regionHasBeenSet = true;
     }
     XmlNode iPAddressNode = resultNode.FirstChild("IPAddress");
     if(!iPAddressNode.IsNull())
     {
-      m_iPAddress = StringUtils::Trim(iPAddressNode.GetText().c_str());
+      m_iPAddress = iPAddressNode.GetTextView().Trim().ToString();
       m_iPAddressHasBeenSet = true;
     }
     XmlNode statusReportNode = resultNode.FirstChild("StatusReport");
@@ -29,51 +29,47 @@ namespace Aws
       namespace HealthCheckRegionMapper
       {
 
-        static const int us_east_1_HASH = HashingUtils::HashString("us-east-1");
-        static const int us_west_1_HASH = HashingUtils::HashString("us-west-1");
-        static const int us_west_2_HASH = HashingUtils::HashString("us-west-2");
-        static const int eu_west_1_HASH = HashingUtils::HashString("eu-west-1");
-        static const int ap_southeast_1_HASH = HashingUtils::HashString("ap-southeast-1");
-        static const int ap_southeast_2_HASH = HashingUtils::HashString("ap-southeast-2");
-        static const int ap_northeast_1_HASH = HashingUtils::HashString("ap-northeast-1");
-        static const int sa_east_1_HASH = HashingUtils::HashString("sa-east-1");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int us_east_1_HASH = 1808575600;
+        static const int us_west_1_HASH = -1967372894;
+        static const int us_west_2_HASH = -1967372893;
+        static const int eu_west_1_HASH = 372748112;
+        static const int ap_southeast_1_HASH = 468199888;
+        static const int ap_southeast_2_HASH = 468199889;
+        static const int ap_northeast_1_HASH = 1990418184;
+        static const int sa_east_1_HASH = -177297728;
 
 
         HealthCheckRegion GetHealthCheckRegionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == us_east_1_HASH)
+          switch (hashCode)
           {
+          case us_east_1_HASH:
             return HealthCheckRegion::us_east_1;
-          }
-          else if (hashCode == us_west_1_HASH)
-          {
+          case us_west_1_HASH:
             return HealthCheckRegion::us_west_1;
-          }
-          else if (hashCode == us_west_2_HASH)
-          {
+          case us_west_2_HASH:
             return HealthCheckRegion::us_west_2;
-          }
-          else if (hashCode == eu_west_1_HASH)
-          {
+          case eu_west_1_HASH:
             return HealthCheckRegion::eu_west_1;
-          }
-          else if (hashCode == ap_southeast_1_HASH)
-          {
+          case ap_southeast_1_HASH:
             return HealthCheckRegion::ap_southeast_1;
-          }
-          else if (hashCode == ap_southeast_2_HASH)
-          {
+          case ap_southeast_2_HASH:
             return HealthCheckRegion::ap_southeast_2;
-          }
-          else if (hashCode == ap_northeast_1_HASH)
-          {
+          case ap_northeast_1_HASH:
             return HealthCheckRegion::ap_northeast_1;
-          }
-          else if (hashCode == sa_east_1_HASH)
-          {
+          case sa_east_1_HASH:
             return HealthCheckRegion::sa_east_1;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,46 +29,44 @@ namespace Aws
       namespace HealthCheckTypeMapper
       {
 
-        static const int HTTP_HASH = HashingUtils::HashString("HTTP");
-        static const int HTTPS_HASH = HashingUtils::HashString("HTTPS");
-        static const int HTTP_STR_MATCH_HASH = HashingUtils::HashString("HTTP_STR_MATCH");
-        static const int HTTPS_STR_MATCH_HASH = HashingUtils::HashString("HTTPS_STR_MATCH");
-        static const int TCP_HASH = HashingUtils::HashString("TCP");
-        static const int CALCULATED_HASH = HashingUtils::HashString("CALCULATED");
-        static const int CLOUDWATCH_METRIC_HASH = HashingUtils::HashString("CLOUDWATCH_METRIC");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int HTTP_HASH = 2228360;
+        static const int HTTPS_HASH = 69079243;
+        static const int HTTP_STR_MATCH_HASH = 1051453184;
+        static const int HTTPS_STR_MATCH_HASH = -1162952829;
+        static const int TCP_HASH = 82881;
+        static const int CALCULATED_HASH = -653437506;
+        static const int CLOUDWATCH_METRIC_HASH = -377834027;
 
 
         HealthCheckType GetHealthCheckTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTTP_HASH)
+          switch (hashCode)
           {
+          case HTTP_HASH:
             return HealthCheckType::HTTP;
-          }
-          else if (hashCode == HTTPS_HASH)
-          {
+          case HTTPS_HASH:
             return HealthCheckType::HTTPS;
-          }
-          else if (hashCode == HTTP_STR_MATCH_HASH)
-          {
+          case HTTP_STR_MATCH_HASH:
             return HealthCheckType::HTTP_STR_MATCH;
-          }
-          else if (hashCode == HTTPS_STR_MATCH_HASH)
-          {
+          case HTTPS_STR_MATCH_HASH:
             return HealthCheckType::HTTPS_STR_MATCH;
-          }
-          else if (hashCode == TCP_HASH)
-          {
+          case TCP_HASH:
             return HealthCheckType::TCP;
-          }
-          else if (hashCode == CALCULATED_HASH)
-          {
+          case CALCULATED_HASH:
             return HealthCheckType::CALCULATED;
-          }
-          else if (hashCode == CLOUDWATCH_METRIC_HASH)
-          {
+          case CLOUDWATCH_METRIC_HASH:
             return HealthCheckType::CLOUDWATCH_METRIC;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
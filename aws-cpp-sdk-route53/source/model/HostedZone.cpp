@@ -59,19 +59,19 @@ HostedZone& HostedZone::operator =(const XmlNode& xmlNode)
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode callerReferenceNode = resultNode.FirstChild("CallerReference");
     if(!callerReferenceNode.IsNull())
     {
-      m_callerReference = StringUtils::Trim(callerReferenceNode.GetText().c_str());
+      m_callerReference = callerReferenceNode.GetTextView().Trim().ToString();
       m_callerReferenceHasBeenSet = true;
     }
     XmlNode configNode = resultNode.FirstChild("Config");
@@ -83,7 +83,7 @@ HostedZone& HostedZone::operator =(const XmlNode& xmlNode)
     XmlNode resourceRecordSetCountNode = resultNode.FirstChild("ResourceRecordSetCount");
     if(!resourceRecordSetCountNode.IsNull())
     {
-      m_resourceRecordSetCount = StringUtils::ConvertToInt64(StringUtils::Trim(resourceRecordSetCountNode.GetText().c_str()).c_str());
+      m_resourceRecordSetCount = StringUtils::ConvertToInt64(resourceRecordSetCountNode.GetTextView().Trim().ToString().c_str());
       m_resourceRecordSetCountHasBeenSet = true;
     }
   }
@@ -53,13 +53,13 @@ HostedZoneConfig& HostedZoneConfig::operator =(const XmlNode& xmlNode)
     XmlNode commentNode = resultNode.FirstChild("Comment");
     if(!commentNode.IsNull())
     {
-      m_comment = StringUtils::Trim(commentNode.GetText().c_str());
+      m_comment = commentNode.GetTextView().Trim().ToString();
       m_commentHasBeenSet = true;
     }
     XmlNode privateZoneNode = resultNode.FirstChild("PrivateZone");
     if(!privateZoneNode.IsNull())
     {
-      m_privateZone = StringUtils::ConvertToBool(StringUtils::Trim(privateZoneNode.GetText().c_str()).c_str());
+      m_privateZone = StringUtils::ConvertToBool(privateZoneNode.GetTextView().Trim().ToString().c_str());
       m_privateZoneHasBeenSet = true;
     }
   }
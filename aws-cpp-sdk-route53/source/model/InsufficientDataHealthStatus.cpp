@@ -29,26 +29,32 @@ namespace Aws
       namespace InsufficientDataHealthStatusMapper
       {
 
-        static const int Healthy_HASH = HashingUtils::HashString("Healthy");
-        static const int Unhealthy_HASH = HashingUtils::HashString("Unhealthy");
-        static const int LastKnownStatus_HASH = HashingUtils::HashString("LastKnownStatus");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Healthy_HASH = -1834753667;
+        static const int Unhealthy_HASH = 216362180;
+        static const int LastKnownStatus_HASH = 1552872575;
 
 
         InsufficientDataHealthStatus GetInsufficientDataHealthStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Healthy_HASH)
+          switch (hashCode)
           {
+          case Healthy_HASH:
             return InsufficientDataHealthStatus::Healthy;
-          }
-          else if (hashCode == Unhealthy_HASH)
-          {
+          case Unhealthy_HASH:
             return InsufficientDataHealthStatus::Unhealthy;
-          }
-          else if (hashCode == LastKnownStatus_HASH)
-          {
+          case LastKnownStatus_HASH:
             return InsufficientDataHealthStatus::LastKnownStatus;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
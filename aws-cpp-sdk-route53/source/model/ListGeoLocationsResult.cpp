@@ -56,27 +56,27 @@ ListGeoLocationsResult& ListGeoLocationsResult::operator =(const AmazonWebServic
     XmlNode isTruncatedNode = resultNode.FirstChild("IsTruncated");
     if(!isTruncatedNode.IsNull())
     {
-      m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(isTruncatedNode.GetText().c_str()).c_str());
+      m_isTruncated = StringUtils::ConvertToBool(isTruncatedNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode nextContinentCodeNode = resultNode.FirstChild("NextContinentCode");
     if(!nextContinentCodeNode.IsNull())
     {
-      m_nextContinentCode = StringUtils::Trim(nextContinentCodeNode.GetText().c_str());
+      m_nextContinentCode = nextContinentCodeNode.GetTextView().Trim().ToString();
     }
     XmlNode nextCountryCodeNode = resultNode.FirstChild("NextCountryCode");
     if(!nextCountryCodeNode.IsNull())
     {
-      m_nextCountryCode = StringUtils::Trim(nextCountryCodeNode.GetText().c_str());
+      m_nextCountryCode = nextCountryCodeNode.GetTextView().Trim().ToString();
     }
     XmlNode nextSubdivisionCodeNode = resultNode.FirstChild("NextSubdivisionCode");
     if(!nextSubdivisionCodeNode.IsNull())
     {
-      m_nextSubdivisionCode = StringUtils::Trim(nextSubdivisionCodeNode.GetText().c_str());
+      m_nextSubdivisionCode = nextSubdivisionCodeNode.GetTextView().Trim().ToString();
     }
     XmlNode maxItemsNode = resultNode.FirstChild("MaxItems");
     if(!maxItemsNode.IsNull())
     {
-      m_maxItems = StringUtils::Trim(maxItemsNode.GetText().c_str());
+      m_maxItems = maxItemsNode.GetTextView().Trim().ToString();
     }
   }
 
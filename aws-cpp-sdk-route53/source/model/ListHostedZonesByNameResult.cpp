@@ -56,32 +56,32 @@ ListHostedZonesByNameResult& ListHostedZonesByNameResult::operator =(const Amazo
     XmlNode dNSNameNode = resultNode.FirstChild("DNSName");
     if(!dNSNameNode.IsNull())
     {
-      m_dNSName = StringUtils::Trim(dNSNameNode.GetText().c_str());
+      m_dNSName = dNSNameNode.GetTextView().Trim().ToString();
     }
     XmlNode hostedZoneIdNode = resultNode.FirstChild("HostedZoneId");
     if(!hostedZoneIdNode.IsNull())
     {
-      m_hostedZoneId = StringUtils::Trim(hostedZoneIdNode.GetText().c_str());
+      m_hostedZoneId = hostedZoneIdNode.GetTextView().Trim().ToString();
     }
     XmlNode isTruncatedNode = resultNode.FirstChild("IsTruncated");
     if(!isTruncatedNode.IsNull())
     {
-      m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(isTruncatedNode.GetText().c_str()).c_str());
+      m_isTruncated = StringUtils::ConvertToBool(isTruncatedNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode nextDNSNameNode = resultNode.FirstChild("NextDNSName");
     if(!nextDNSNameNode.IsNull())
     {
-      m_nextDNSName = StringUtils::Trim(nextDNSNameNode.GetText().c_str());
+      m_nextDNSName = nextDNSNameNode.GetTextView().Trim().ToString();
     }
     XmlNode nextHostedZoneIdNode = resultNode.FirstChild("NextHostedZoneId");
     if(!nextHostedZoneIdNode.IsNull())
     {
-      m_nextHostedZoneId = StringUtils::Trim(nextHostedZoneIdNode.GetText().c_str());
+      m_nextHostedZoneId = nextHostedZoneIdNode.GetTextView().Trim().ToString();
     }
     XmlNode maxItemsNode = resultNode.FirstChild("MaxItems");
     if(!maxItemsNode.IsNull())
     {
-      m_maxItems = StringUtils::Trim(maxItemsNode.GetText().c_str());
+      m_maxItems = maxItemsNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -56,17 +56,17 @@ ListTrafficPoliciesResult& ListTrafficPoliciesResult::operator =(const AmazonWeb
     XmlNode isTruncatedNode = resultNode.FirstChild("IsTruncated");
     if(!isTruncatedNode.IsNull())
     {
-      m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(isTruncatedNode.GetText().c_str()).c_str());
+      m_isTruncated = StringUtils::ConvertToBool(isTruncatedNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode trafficPolicyIdMarkerNode = resultNode.FirstChild("TrafficPolicyIdMarker");
     if(!trafficPolicyIdMarkerNode.IsNull())
     {
-      m_trafficPolicyIdMarker = StringUtils::Trim(trafficPolicyIdMarkerNode.GetText().c_str());
+      m_trafficPolicyIdMarker = trafficPolicyIdMarkerNode.GetTextView().Trim().ToString();
     }
     XmlNode maxItemsNode = resultNode.FirstChild("MaxItems");
     if(!maxItemsNode.IsNull())
     {
-      m_maxItems = StringUtils::Trim(maxItemsNode.GetText().c_str());
+      m_maxItems = maxItemsNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -56,22 +56,22 @@ ListTrafficPolicyInstancesByHostedZoneResult& ListTrafficPolicyInstancesByHosted
     XmlNode trafficPolicyInstanceNameMarkerNode = resultNode.FirstChild("TrafficPolicyInstanceNameMarker");
     if(!trafficPolicyInstanceNameMarkerNode.IsNull())
     {
-      m_trafficPolicyInstanceNameMarker = StringUtils::Trim(trafficPolicyInstanceNameMarkerNode.GetText().c_str());
+      m_trafficPolicyInstanceNameMarker = trafficPolicyInstanceNameMarkerNode.GetTextView().Trim().ToString();
     }
     XmlNode trafficPolicyInstanceTypeMarkerNode = resultNode.FirstChild("TrafficPolicyInstanceTypeMarker");
     if(!trafficPolicyInstanceTypeMarkerNode.IsNull())
     {
-      m_trafficPolicyInstanceTypeMarker = RRTypeMapper::GetRRTypeForName(StringUtils::Trim(trafficPolicyInstanceTypeMarkerNode.GetText().c_str()).c_str());
+      m_trafficPolicyInstanceTypeMarker = RRTypeMapper::GetRRTypeForName(trafficPolicyInstanceTypeMarkerNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode isTruncatedNode = resultNode.FirstChild("IsTruncated");
     if(!isTruncatedNode.IsNull())
     {
-      m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(isTruncatedNode.GetText().c_str()).c_str());
+      m_isTruncated = StringUtils::ConvertToBool(isTruncatedNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode maxItemsNode = resultNode.FirstChild("MaxItems");
     if(!maxItemsNode.IsNull())
     {
-      m_maxItems = StringUtils::Trim(maxItemsNode.GetText().c_str());
+      m_maxItems = maxItemsNode.GetTextView().Trim().ToString();
     }
   }
 
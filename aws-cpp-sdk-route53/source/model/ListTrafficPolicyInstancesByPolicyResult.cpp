@@ -56,27 +56,27 @@ ListTrafficPolicyInstancesByPolicyResult& ListTrafficPolicyInstancesByPolicyResu
     XmlNode hostedZoneIdMarkerNode = resultNode.FirstChild("HostedZoneIdMarker");
     if(!hostedZoneIdMarkerNode.IsNull())
     {
-      m_hostedZoneIdMarker = StringUtils::Trim(hostedZoneIdMarkerNode.GetText().c_str());
+      m_hostedZoneIdMarker = hostedZoneIdMarkerNode.GetTextView().Trim().ToString();
     }
     XmlNode trafficPolicyInstanceNameMarkerNode = resultNode.FirstChild("TrafficPolicyInstanceNameMarker");
     if(!trafficPolicyInstanceNameMarkerNode.IsNull())
     {
-      m_trafficPolicyInstanceNameMarker = StringUtils::Trim(trafficPolicyInstanceNameMarkerNode.GetText().c_str());
+      m_trafficPolicyInstanceNameMarker = trafficPolicyInstanceNameMarkerNode.GetTextView().Trim().ToString();
     }
     XmlNode trafficPolicyInstanceTypeMarkerNode = resultNode.FirstChild("TrafficPolicyInstanceTypeMarker");
     if(!trafficPolicyInstanceTypeMarkerNode.IsNull())
     {
-      m_trafficPolicyInstanceTypeMarker = RRTypeMapper::GetRRTypeForName(StringUtils::Trim(trafficPolicyInstanceTypeMarkerNode.GetText().c_str()).c_str());
+      m_trafficPolicyInstanceTypeMarker = RRTypeMapper::GetRRTypeForName(trafficPolicyInstanceTypeMarkerNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode isTruncatedNode = resultNode.FirstChild("IsTruncated");
     if(!isTruncatedNode.IsNull())
     {
-      m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(isTruncatedNode.GetText().c_str()).c_str());
+      m_isTruncated = StringUtils::ConvertToBool(isTruncatedNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode maxItemsNode = resultNode.FirstChild("MaxItems");
     if(!maxItemsNode.IsNull())
     {
-      m_maxItems = StringUtils::Trim(maxItemsNode.GetText().c_str());
+      m_maxItems = maxItemsNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -29,61 +29,53 @@ namespace Aws
       namespace RRTypeMapper
       {
 
-        static const int SOA_HASH = HashingUtils::HashString("SOA");
-        static const int A_HASH = HashingUtils::HashString("A");
-        static const int TXT_HASH = HashingUtils::HashString("TXT");
-        static const int NS_HASH = HashingUtils::HashString("NS");
-        static const int CNAME_HASH = HashingUtils::HashString("CNAME");
-        static const int MX_HASH = HashingUtils::HashString("MX");
-        static const int PTR_HASH = HashingUtils::HashString("PTR");
-        static const int SRV_HASH = HashingUtils::HashString("SRV");
-        static const int SPF_HASH = HashingUtils::HashString("SPF");
-        static const int AAAA_HASH = HashingUtils::HashString("AAAA");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int SOA_HASH = 82277;
+        static const int A_HASH = 65;
+        static const int TXT_HASH = 83536;
+        static const int NS_HASH = 2501;
+        static const int CNAME_HASH = 64264526;
+        static const int MX_HASH = 2475;
+        static const int PTR_HASH = 79566;
+        static const int SRV_HASH = 82391;
+        static const int SPF_HASH = 82313;
+        static const int AAAA_HASH = 2000960;
 
 
         RRType GetRRTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SOA_HASH)
+          switch (hashCode)
           {
+          case SOA_HASH:
             return RRType::SOA;
-          }
-          else if (hashCode == A_HASH)
-          {
+          case A_HASH:
             return RRType::A;
-          }
-          else if (hashCode == TXT_HASH)
-          {
+          case TXT_HASH:
             return RRType::TXT;
-          }
-          else if (hashCode == NS_HASH)
-          {
+          case NS_HASH:
             return RRType::NS;
-          }
-          else if (hashCode == CNAME_HASH)
-          {
+          case CNAME_HASH:
             return RRType::CNAME;
-          }
-          else if (hashCode == MX_HASH)
-          {
+          case MX_HASH:
             return RRType::MX;
-          }
-          else if (hashCode == PTR_HASH)
-          {
+          case PTR_HASH:
             return RRType::PTR;
-          }
-          else if (hashCode == SRV_HASH)
-          {
+          case SRV_HASH:
             return RRType::SRV;
-          }
-          else if (hashCode == SPF_HASH)
-          {
+          case SPF_HASH:
             return RRType::SPF;
-          }
-          else if (hashCode == AAAA_HASH)
-          {
+          case AAAA_HASH:
             return RRType::AAAA;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
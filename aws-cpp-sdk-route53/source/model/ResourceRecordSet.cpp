@@ -75,31 +75,31 @@ ResourceRecordSet& ResourceRecordSet::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode typeNode = resultNode.FirstChild("Type");
     if(!typeNode.IsNull())
     {
-      m_type = RRTypeMapper::GetRRTypeForName(StringUtils::Trim(typeNode.GetText().c_str()).c_str());
+      m_type = RRTypeMapper::GetRRTypeForName(typeNode.GetTextView().Trim().ToString().c_str());
       m_typeHasBeenSet = true;
     }
     XmlNode setIdentifierNode = resultNode.FirstChild("SetIdentifier");
     if(!setIdentifierNode.IsNull())
     {
-      m_setIdentifier = StringUtils::Trim(setIdentifierNode.GetText().c_str());
+      m_setIdentifier = setIdentifierNode.GetTextView().Trim().ToString();
       m_setIdentifierHasBeenSet = true;
     }
     XmlNode weightNode = resultNode.FirstChild("Weight");
     if(!weightNode.IsNull())
     {
-      m_weight = StringUtils::ConvertToInt64(StringUtils::Trim(weightNode.GetText().c_str()).c_str());
+      m_weight = StringUtils::ConvertToInt64(weightNode.GetTextView().Trim().ToString().c_str());
       m_weightHasBeenSet = true;
     }
     XmlNode regionNode = resultNode.FirstChild("Region");
     if(!regionNode.IsNull())
     {
-      m_region = ResourceRecordSetRegionMapper::GetResourceRecordSetRegionForName(StringUtils::Trim(regionNode.GetText().c_str()).c_str());
+      m_region = ResourceRecordSetRegionMapper::GetResourceRecordSetRegionForName(regionNode.GetTextView().Trim().ToString().c_str());
       m_regionHasBeenSet = true;
     }
     XmlNode geoLocationNode = resultNode.FirstChild("GeoLocation");
@@ -111,13 +111,13 @@ ResourceRecordSet& ResourceRecordSet::operator =(const XmlNode& xmlNode)
     XmlNode failoverNode = resultNode.FirstChild("Failover");
     if(!failoverNode.IsNull())
     {
-      m_failover = ResourceRecordSetFailoverMapper::GetResourceRecordSetFailoverForName(StringUtils::Trim(failoverNode.GetText().c_str()).c_str());
+      m_failover = ResourceRecordSetFailoverMapper::GetResourceRecordSetFailoverForName(failoverNode.GetTextView().Trim().ToString().c_str());
       m_failoverHasBeenSet = true;
     }
     XmlNode tTLNode = resultNode.FirstChild("TTL");
     if(!tTLNode.IsNull())
     {
-      m_tTL = StringUtils::ConvertToInt64(StringUtils::Trim(tTLNode.GetText().c_str()).c_str());
+      m_tTL = StringUtils::ConvertToInt64(tTLNode.GetTextView().Trim().ToString().c_str());
       m_tTLHasBeenSet = true;
     }
     XmlNode resourceRecordsNode = resultNode.FirstChild("ResourceRecords");
@@ -141,13 +141,13 @@ ResourceRecordSet& ResourceRecordSet::operator =(const XmlNode& xmlNode)
     XmlNode healthCheckIdNode = resultNode.FirstChild("HealthCheckId");
     if(!healthCheckIdNode.IsNull())
     {
-      m_healthCheckId = StringUtils::Trim(healthCheckIdNode.GetText().c_str());
+      m_healthCheckId = healthCheckIdNode.GetTextView().Trim().ToString();
       m_healthCheckIdHasBeenSet = true;
     }
     XmlNode trafficPolicyInstanceIdNode = resultNode.FirstChild("TrafficPolicyInstanceId");
     if(!trafficPolicyInstanceIdNode.IsNull())
     {
-      m_trafficPolicyInstanceId = StringUtils::Trim(trafficPolicyInstanceIdNode.GetText().c_str());
+      m_trafficPolicyInstanceId = trafficPolicyInstanceIdNode.GetTextView().Trim().ToString();
       m_trafficPolicyInstanceIdHasBeenSet = true;
     }
   }
@@ -29,21 +29,29 @@ namespace Aws
       namespace ResourceRecordSetFailoverMapper
       {
 
-        static const int PRIMARY_HASH = HashingUtils::HashString("PRIMARY");
-        static const int SECONDARY_HASH = HashingUtils::HashString("SECONDARY");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PRIMARY_HASH = 403216866;
+        static const int SECONDARY_HASH = 1968996692;
 
 
         ResourceRecordSetFailover GetResourceRecordSetFailoverForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRIMARY_HASH)
+          switch (hashCode)
           {
+          case PRIMARY_HASH:
             return ResourceRecordSetFailover::PRIMARY;
-          }
-          else if (hashCode == SECONDARY_HASH)
-          {
+          case SECONDARY_HASH:
             return ResourceRecordSetFailover::SECONDARY;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -53,13 +53,13 @@ ResourceTagSet& ResourceTagSet::operator =(const XmlNode& xmlNode)
     XmlNode resourceTypeNode = resultNode.FirstChild("ResourceType");
     if(!resourceTypeNode.IsNull())
     {
-      m_resourceType = TagResourceTypeMapper::GetTagResourceTypeForName(StringUtils::Trim(resourceTypeNode.GetText().c_str()).c_str());
+      m_resourceType = TagResourceTypeMapper::GetTagResourceTypeForName(resourceTypeNode.GetTextView().Trim().ToString().c_str());
       m_resourceTypeHasBeenSet = true;
     }
     XmlNode resourceIdNode = resultNode.FirstChild("ResourceId");
     if(!resourceIdNode.IsNull())
     {
-      m_resourceId = StringUtils::Trim(resourceIdNode.GetText().c_str());
+      m_resourceId = resourceIdNode.GetTextView().Trim().ToString();
       m_resourceIdHasBeenSet = true;
     }
     XmlNode tagsNode = resultNode.FirstChild("Tags");
@@ -51,13 +51,13 @@ StatusReport& StatusReport::operator =(const XmlNode& xmlNode)
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = StringUtils::Trim(statusNode.GetText().c_str());
+      m_status = statusNode.GetTextView().Trim().ToString();
       m_statusHasBeenSet = true;
     }
     XmlNode checkedTimeNode = resultNode.FirstChild("CheckedTime");
     if(!checkedTimeNode.IsNull())
     {
-      m_checkedTime = DateTime(StringUtils::Trim(checkedTimeNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_checkedTime = DateTime(checkedTimeNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_checkedTimeHasBeenSet = true;
     }
   }
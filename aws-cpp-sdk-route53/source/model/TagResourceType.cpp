@@ -29,21 +29,29 @@ namespace Aws
       namespace TagResourceTypeMapper
       {
 
-        static const int healthcheck_HASH = HashingUtils::HashString("healthcheck");
-        static const int hostedzone_HASH = HashingUtils::HashString("hostedzone");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int healthcheck_HASH = -1908540372;
+        static const int hostedzone_HASH = -602939277;
 
 
         TagResourceType GetTagResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == healthcheck_HASH)
+          switch (hashCode)
           {
+          case healthcheck_HASH:
             return TagResourceType::healthcheck;
-          }
-          else if (hashCode == hostedzone_HASH)
-          {
+          case hostedzone_HASH:
             return TagResourceType::hostedzone;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
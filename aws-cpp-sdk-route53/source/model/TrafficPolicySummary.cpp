@@ -61,31 +61,31 @@ TrafficPolicySummary& TrafficPolicySummary::operator =(const XmlNode& xmlNode)
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode typeNode = resultNode.FirstChild("Type");
     if(!typeNode.IsNull())
     {
-      m_type = RRTypeMapper::GetRRTypeForName(StringUtils::Trim(typeNode.GetText().c_str()).c_str());
+      m_type = RRTypeMapper::GetRRTypeForName(typeNode.GetTextView().Trim().ToString().c_str());
       m_typeHasBeenSet = true;
     }
     XmlNode latestVersionNode = resultNode.FirstChild("LatestVersion");
     if(!latestVersionNode.IsNull())
     {
-      m_latestVersion = StringUtils::ConvertToInt32(StringUtils::Trim(latestVersionNode.GetText().c_str()).c_str());
+      m_latestVersion = StringUtils::ConvertToInt32(latestVersionNode.GetTextView().Trim().ToString().c_str());
       m_latestVersionHasBeenSet = true;
     }
     XmlNode trafficPolicyCountNode = resultNode.FirstChild("TrafficPolicyCount");
     if(!trafficPolicyCountNode.IsNull())
     {
-      m_trafficPolicyCount = StringUtils::ConvertToInt32(StringUtils::Trim(trafficPolicyCountNode.GetText().c_str()).c_str());
+      m_trafficPolicyCount = StringUtils::ConvertToInt32(trafficPolicyCountNode.GetTextView().Trim().ToString().c_str());
       m_trafficPolicyCountHasBeenSet = true;
     }
   }
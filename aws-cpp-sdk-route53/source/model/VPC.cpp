@@ -51,13 +51,13 @@ VPC& VPC::operator =(const XmlNode& xmlNode)
     XmlNode vPCRegionNode = resultNode.FirstChild("VPCRegion");
     if(!vPCRegionNode.IsNull())
     {
-      m_vPCRegion = VPCRegionMapper::GetVPCRegionForName(StringUtils::Trim(vPCRegionNode.GetText().c_str()).c_str());
+      m_vPCRegion = VPCRegionMapper::GetVPCRegionForName(vPCRegionNode.GetTextView().Trim().ToString().c_str());
       m_vPCRegionHasBeenSet = true;
     }
     XmlNode vPCIdNode = resultNode.FirstChild("VPCId");
     if(!vPCIdNode.IsNull())
     {
-      m_vPCId = StringUtils::Trim(vPCIdNode.GetText().c_str());
+      m_vPCId = vPCIdNode.GetTextView().Trim().ToString();
       m_vPCIdHasBeenSet = true;
     }
   }
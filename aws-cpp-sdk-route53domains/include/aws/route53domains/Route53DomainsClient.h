@@ -44,6 +44,9 @@
 #include <aws/route53domains/model/UpdateTagsForDomainResult.h>
 #include <aws/route53domains/model/ViewBillingResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -238,6 +241,18 @@ namespace Model
          */
         virtual void CheckDomainAvailabilityAsync(const Model::CheckDomainAvailabilityRequest& request, const CheckDomainAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CheckDomainAvailabilityCallable(const Model::CheckDomainAvailabilityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CheckDomainAvailabilityOutcomeCallable CheckDomainAvailabilityCallable(Model::CheckDomainAvailabilityRequest&& request) const;
+
+        /**
+         * Same as CheckDomainAvailabilityAsync(const Model::CheckDomainAvailabilityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CheckDomainAvailabilityAsync(Model::CheckDomainAvailabilityRequest&& request, const CheckDomainAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation deletes the specified tags for a domain.</p> <p>All tag
          * operations are eventually consistent; subsequent operations may not immediately
@@ -263,6 +278,18 @@ namespace Model
          */
         virtual void DeleteTagsForDomainAsync(const Model::DeleteTagsForDomainRequest& request, const DeleteTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTagsForDomainCallable(const Model::DeleteTagsForDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTagsForDomainOutcomeCallable DeleteTagsForDomainCallable(Model::DeleteTagsForDomainRequest&& request) const;
+
+        /**
+         * Same as DeleteTagsForDomainAsync(const Model::DeleteTagsForDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTagsForDomainAsync(Model::DeleteTagsForDomainRequest&& request, const DeleteTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation disables automatic renewal of domain registration for the
          * specified domain.</p>
@@ -285,6 +312,18 @@ namespace Model
          */
         virtual void DisableDomainAutoRenewAsync(const Model::DisableDomainAutoRenewRequest& request, const DisableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableDomainAutoRenewCallable(const Model::DisableDomainAutoRenewRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableDomainAutoRenewOutcomeCallable DisableDomainAutoRenewCallable(Model::DisableDomainAutoRenewRequest&& request) const;
+
+        /**
+         * Same as DisableDomainAutoRenewAsync(const Model::DisableDomainAutoRenewRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableDomainAutoRenewAsync(Model::DisableDomainAutoRenewRequest&& request, const DisableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation removes the transfer lock on the domain (specifically the
          * <code>clientTransferProhibited</code> status) to allow domain transfers. We
@@ -322,6 +361,18 @@ namespace Model
          */
         virtual void DisableDomainTransferLockAsync(const Model::DisableDomainTransferLockRequest& request, const DisableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableDomainTransferLockCallable(const Model::DisableDomainTransferLockRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableDomainTransferLockOutcomeCallable DisableDomainTransferLockCallable(Model::DisableDomainTransferLockRequest&& request) const;
+
+        /**
+         * Same as DisableDomainTransferLockAsync(const Model::DisableDomainTransferLockRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableDomainTransferLockAsync(Model::DisableDomainTransferLockRequest&& request, const DisableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation configures Amazon Route 53 to automatically renew the
          * specified domain before the domain registration expires. The cost of renewing
@@ -368,6 +419,18 @@ namespace Model
          */
         virtual void EnableDomainAutoRenewAsync(const Model::EnableDomainAutoRenewRequest& request, const EnableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableDomainAutoRenewCallable(const Model::EnableDomainAutoRenewRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableDomainAutoRenewOutcomeCallable EnableDomainAutoRenewCallable(Model::EnableDomainAutoRenewRequest&& request) const;
+
+        /**
+         * Same as EnableDomainAutoRenewAsync(const Model::EnableDomainAutoRenewRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableDomainAutoRenewAsync(Model::EnableDomainAutoRenewRequest&& request, const EnableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation sets the transfer lock on the domain (specifically the
          * <code>clientTransferProhibited</code> status) to prevent domain transfers.
@@ -399,6 +462,18 @@ namespace Model
          */
         virtual void EnableDomainTransferLockAsync(const Model::EnableDomainTransferLockRequest& request, const EnableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableDomainTransferLockCallable(const Model::EnableDomainTransferLockRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::EnableDomainTransferLockOutcomeCallable EnableDomainTransferLockCallable(Model::EnableDomainTransferLockRequest&& request) const;
+
+        /**
+         * Same as EnableDomainTransferLockAsync(const Model::EnableDomainTransferLockRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void EnableDomainTransferLockAsync(Model::EnableDomainTransferLockRequest&& request, const EnableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>For operations that require confirmation that the email address for the
          * registrant contact is valid, such as registering a new domain, this operation
@@ -430,6 +505,18 @@ namespace Model
          */
         virtual void GetContactReachabilityStatusAsync(const Model::GetContactReachabilityStatusRequest& request, const GetContactReachabilityStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetContactReachabilityStatusCallable(const Model::GetContactReachabilityStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetContactReachabilityStatusOutcomeCallable GetContactReachabilityStatusCallable(Model::GetContactReachabilityStatusRequest&& request) const;
+
+        /**
+         * Same as GetContactReachabilityStatusAsync(const Model::GetContactReachabilityStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetContactReachabilityStatusAsync(Model::GetContactReachabilityStatusRequest&& request, const GetContactReachabilityStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns detailed information about the domain. The domain's
          * contact information is also returned as part of the output.</p>
@@ -452,6 +539,18 @@ namespace Model
          */
         virtual void GetDomainDetailAsync(const Model::GetDomainDetailRequest& request, const GetDomainDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDomainDetailCallable(const Model::GetDomainDetailRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDomainDetailOutcomeCallable GetDomainDetailCallable(Model::GetDomainDetailRequest&& request) const;
+
+        /**
+         * Same as GetDomainDetailAsync(const Model::GetDomainDetailRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDomainDetailAsync(Model::GetDomainDetailRequest&& request, const GetDomainDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The GetDomainSuggestions operation returns a list of suggested domain names
          * given a string, which can either be a domain name or simply a word or phrase
@@ -501,6 +600,18 @@ namespace Model
          */
         virtual void GetDomainSuggestionsAsync(const Model::GetDomainSuggestionsRequest& request, const GetDomainSuggestionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDomainSuggestionsCallable(const Model::GetDomainSuggestionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDomainSuggestionsOutcomeCallable GetDomainSuggestionsCallable(Model::GetDomainSuggestionsRequest&& request) const;
+
+        /**
+         * Same as GetDomainSuggestionsAsync(const Model::GetDomainSuggestionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDomainSuggestionsAsync(Model::GetDomainSuggestionsRequest&& request, const GetDomainSuggestionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns the current status of an operation that is not
          * completed.</p>
@@ -523,6 +634,18 @@ namespace Model
          */
         virtual void GetOperationDetailAsync(const Model::GetOperationDetailRequest& request, const GetOperationDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetOperationDetailCallable(const Model::GetOperationDetailRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetOperationDetailOutcomeCallable GetOperationDetailCallable(Model::GetOperationDetailRequest&& request) const;
+
+        /**
+         * Same as GetOperationDetailAsync(const Model::GetOperationDetailRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetOperationDetailAsync(Model::GetOperationDetailRequest&& request, const GetOperationDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns all the domain names registered with Amazon Route 53
          * for the current AWS account.</p>
@@ -545,6 +668,18 @@ namespace Model
          */
         virtual void ListDomainsAsync(const Model::ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDomainsCallable(const Model::ListDomainsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDomainsOutcomeCallable ListDomainsCallable(Model::ListDomainsRequest&& request) const;
+
+        /**
+         * Same as ListDomainsAsync(const Model::ListDomainsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDomainsAsync(Model::ListDomainsRequest&& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns the operation IDs of operations that are not yet
          * complete.</p>
@@ -567,6 +702,18 @@ namespace Model
          */
         virtual void ListOperationsAsync(const Model::ListOperationsRequest& request, const ListOperationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListOperationsCallable(const Model::ListOperationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListOperationsOutcomeCallable ListOperationsCallable(Model::ListOperationsRequest&& request) const;
+
+        /**
+         * Same as ListOperationsAsync(const Model::ListOperationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListOperationsAsync(Model::ListOperationsRequest&& request, const ListOperationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns all of the tags that are associated with the specified
          * domain.</p> <p>All tag operations are eventually consistent; subsequent
@@ -592,6 +739,18 @@ namespace Model
          */
         virtual void ListTagsForDomainAsync(const Model::ListTagsForDomainRequest& request, const ListTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForDomainCallable(const Model::ListTagsForDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsForDomainOutcomeCallable ListTagsForDomainCallable(Model::ListTagsForDomainRequest&& request) const;
+
+        /**
+         * Same as ListTagsForDomainAsync(const Model::ListTagsForDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsForDomainAsync(Model::ListTagsForDomainRequest&& request, const ListTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation registers a domain. Domains are registered by the AWS
          * registrar partner, Gandi. For some top-level domains (TLDs), this operation
@@ -662,6 +821,18 @@ namespace Model
          */
         virtual void RegisterDomainAsync(const Model::RegisterDomainRequest& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterDomainCallable(const Model::RegisterDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterDomainOutcomeCallable RegisterDomainCallable(Model::RegisterDomainRequest&& request) const;
+
+        /**
+         * Same as RegisterDomainAsync(const Model::RegisterDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterDomainAsync(Model::RegisterDomainRequest&& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation renews a domain for the specified number of years. The cost of
          * renewing your domain is billed to your AWS account.</p> <p>We recommend that you
@@ -699,6 +870,18 @@ namespace Model
          */
         virtual void RenewDomainAsync(const Model::RenewDomainRequest& request, const RenewDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RenewDomainCallable(const Model::RenewDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RenewDomainOutcomeCallable RenewDomainCallable(Model::RenewDomainRequest&& request) const;
+
+        /**
+         * Same as RenewDomainAsync(const Model::RenewDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RenewDomainAsync(Model::RenewDomainRequest&& request, const RenewDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>For operations that require confirmation that the email address for the
          * registrant contact is valid, such as registering a new domain, this operation
@@ -727,6 +910,18 @@ namespace Model
          */
         virtual void ResendContactReachabilityEmailAsync(const Model::ResendContactReachabilityEmailRequest& request, const ResendContactReachabilityEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResendContactReachabilityEmailCallable(const Model::ResendContactReachabilityEmailRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResendContactReachabilityEmailOutcomeCallable ResendContactReachabilityEmailCallable(Model::ResendContactReachabilityEmailRequest&& request) const;
+
+        /**
+         * Same as ResendContactReachabilityEmailAsync(const Model::ResendContactReachabilityEmailRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResendContactReachabilityEmailAsync(Model::ResendContactReachabilityEmailRequest&& request, const ResendContactReachabilityEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns the AuthCode for the domain. To transfer a domain to
          * another registrar, you provide this value to the new registrar.</p>
@@ -749,6 +944,18 @@ namespace Model
          */
         virtual void RetrieveDomainAuthCodeAsync(const Model::RetrieveDomainAuthCodeRequest& request, const RetrieveDomainAuthCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RetrieveDomainAuthCodeCallable(const Model::RetrieveDomainAuthCodeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RetrieveDomainAuthCodeOutcomeCallable RetrieveDomainAuthCodeCallable(Model::RetrieveDomainAuthCodeRequest&& request) const;
+
+        /**
+         * Same as RetrieveDomainAuthCodeAsync(const Model::RetrieveDomainAuthCodeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RetrieveDomainAuthCodeAsync(Model::RetrieveDomainAuthCodeRequest&& request, const RetrieveDomainAuthCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation transfers a domain from another registrar to Amazon Route 53.
          * When the transfer is complete, the domain is registered with the AWS registrar
@@ -822,6 +1029,18 @@ namespace Model
          */
         virtual void TransferDomainAsync(const Model::TransferDomainRequest& request, const TransferDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TransferDomainCallable(const Model::TransferDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TransferDomainOutcomeCallable TransferDomainCallable(Model::TransferDomainRequest&& request) const;
+
+        /**
+         * Same as TransferDomainAsync(const Model::TransferDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TransferDomainAsync(Model::TransferDomainRequest&& request, const TransferDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation updates the contact information for a particular domain.
          * Information for at least one contact (registrant, administrator, or technical)
@@ -856,6 +1075,18 @@ namespace Model
          */
         virtual void UpdateDomainContactAsync(const Model::UpdateDomainContactRequest& request, const UpdateDomainContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDomainContactCallable(const Model::UpdateDomainContactRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateDomainContactOutcomeCallable UpdateDomainContactCallable(Model::UpdateDomainContactRequest&& request) const;
+
+        /**
+         * Same as UpdateDomainContactAsync(const Model::UpdateDomainContactRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateDomainContactAsync(Model::UpdateDomainContactRequest&& request, const UpdateDomainContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation updates the specified domain contact's privacy setting. When
          * the privacy option is enabled, personal information such as postal or email
@@ -902,6 +1133,18 @@ namespace Model
          */
         virtual void UpdateDomainContactPrivacyAsync(const Model::UpdateDomainContactPrivacyRequest& request, const UpdateDomainContactPrivacyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDomainContactPrivacyCallable(const Model::UpdateDomainContactPrivacyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateDomainContactPrivacyOutcomeCallable UpdateDomainContactPrivacyCallable(Model::UpdateDomainContactPrivacyRequest&& request) const;
+
+        /**
+         * Same as UpdateDomainContactPrivacyAsync(const Model::UpdateDomainContactPrivacyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateDomainContactPrivacyAsync(Model::UpdateDomainContactPrivacyRequest&& request, const UpdateDomainContactPrivacyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation replaces the current set of name servers for the domain with
          * the specified set of name servers. If you use Amazon Route 53 as your DNS
@@ -939,6 +1182,18 @@ namespace Model
          */
         virtual void UpdateDomainNameserversAsync(const Model::UpdateDomainNameserversRequest& request, const UpdateDomainNameserversResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDomainNameserversCallable(const Model::UpdateDomainNameserversRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateDomainNameserversOutcomeCallable UpdateDomainNameserversCallable(Model::UpdateDomainNameserversRequest&& request) const;
+
+        /**
+         * Same as UpdateDomainNameserversAsync(const Model::UpdateDomainNameserversRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateDomainNameserversAsync(Model::UpdateDomainNameserversRequest&& request, const UpdateDomainNameserversResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation adds or updates tags for a specified domain.</p> <p>All tag
          * operations are eventually consistent; subsequent operations may not immediately
@@ -964,6 +1219,18 @@ namespace Model
          */
         virtual void UpdateTagsForDomainAsync(const Model::UpdateTagsForDomainRequest& request, const UpdateTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateTagsForDomainCallable(const Model::UpdateTagsForDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateTagsForDomainOutcomeCallable UpdateTagsForDomainCallable(Model::UpdateTagsForDomainRequest&& request) const;
+
+        /**
+         * Same as UpdateTagsForDomainAsync(const Model::UpdateTagsForDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateTagsForDomainAsync(Model::UpdateTagsForDomainRequest&& request, const UpdateTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns all the domain-related billing records for the current
          * AWS account for a specified period</p>
@@ -986,6 +1253,150 @@ namespace Model
          */
         virtual void ViewBillingAsync(const Model::ViewBillingRequest& request, const ViewBillingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ViewBillingCallable(const Model::ViewBillingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ViewBillingOutcomeCallable ViewBillingCallable(Model::ViewBillingRequest&& request) const;
+
+        /**
+         * Same as ViewBillingAsync(const Model::ViewBillingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ViewBillingAsync(Model::ViewBillingRequest&& request, const ViewBillingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListDomains(), following NextPageMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<Route53DomainsClient, Model::ListDomainsRequest, Model::ListDomainsOutcome> ListDomainsPaginator(const Model::ListDomainsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListOperations(), following NextPageMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<Route53DomainsClient, Model::ListOperationsRequest, Model::ListOperationsOutcome> ListOperationsPaginator(const Model::ListOperationsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ViewBilling(), following NextPageMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<Route53DomainsClient, Model::ViewBillingRequest, Model::ViewBillingOutcome> ViewBillingPaginator(const Model::ViewBillingRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CheckDomainAvailability(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::CheckDomainAvailabilityRequest, Model::CheckDomainAvailabilityOutcome> CheckDomainAvailabilityAwaitable(Model::CheckDomainAvailabilityRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTagsForDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::DeleteTagsForDomainRequest, Model::DeleteTagsForDomainOutcome> DeleteTagsForDomainAwaitable(Model::DeleteTagsForDomainRequest request) const;
+
+        /**
+         * co_await-able form of DisableDomainAutoRenew(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::DisableDomainAutoRenewRequest, Model::DisableDomainAutoRenewOutcome> DisableDomainAutoRenewAwaitable(Model::DisableDomainAutoRenewRequest request) const;
+
+        /**
+         * co_await-able form of DisableDomainTransferLock(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::DisableDomainTransferLockRequest, Model::DisableDomainTransferLockOutcome> DisableDomainTransferLockAwaitable(Model::DisableDomainTransferLockRequest request) const;
+
+        /**
+         * co_await-able form of EnableDomainAutoRenew(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::EnableDomainAutoRenewRequest, Model::EnableDomainAutoRenewOutcome> EnableDomainAutoRenewAwaitable(Model::EnableDomainAutoRenewRequest request) const;
+
+        /**
+         * co_await-able form of EnableDomainTransferLock(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::EnableDomainTransferLockRequest, Model::EnableDomainTransferLockOutcome> EnableDomainTransferLockAwaitable(Model::EnableDomainTransferLockRequest request) const;
+
+        /**
+         * co_await-able form of GetContactReachabilityStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::GetContactReachabilityStatusRequest, Model::GetContactReachabilityStatusOutcome> GetContactReachabilityStatusAwaitable(Model::GetContactReachabilityStatusRequest request) const;
+
+        /**
+         * co_await-able form of GetDomainDetail(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::GetDomainDetailRequest, Model::GetDomainDetailOutcome> GetDomainDetailAwaitable(Model::GetDomainDetailRequest request) const;
+
+        /**
+         * co_await-able form of GetDomainSuggestions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::GetDomainSuggestionsRequest, Model::GetDomainSuggestionsOutcome> GetDomainSuggestionsAwaitable(Model::GetDomainSuggestionsRequest request) const;
+
+        /**
+         * co_await-able form of GetOperationDetail(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::GetOperationDetailRequest, Model::GetOperationDetailOutcome> GetOperationDetailAwaitable(Model::GetOperationDetailRequest request) const;
+
+        /**
+         * co_await-able form of ListDomains(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::ListDomainsRequest, Model::ListDomainsOutcome> ListDomainsAwaitable(Model::ListDomainsRequest request) const;
+
+        /**
+         * co_await-able form of ListOperations(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::ListOperationsRequest, Model::ListOperationsOutcome> ListOperationsAwaitable(Model::ListOperationsRequest request) const;
+
+        /**
+         * co_await-able form of ListTagsForDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::ListTagsForDomainRequest, Model::ListTagsForDomainOutcome> ListTagsForDomainAwaitable(Model::ListTagsForDomainRequest request) const;
+
+        /**
+         * co_await-able form of RegisterDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::RegisterDomainRequest, Model::RegisterDomainOutcome> RegisterDomainAwaitable(Model::RegisterDomainRequest request) const;
+
+        /**
+         * co_await-able form of RenewDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::RenewDomainRequest, Model::RenewDomainOutcome> RenewDomainAwaitable(Model::RenewDomainRequest request) const;
+
+        /**
+         * co_await-able form of ResendContactReachabilityEmail(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::ResendContactReachabilityEmailRequest, Model::ResendContactReachabilityEmailOutcome> ResendContactReachabilityEmailAwaitable(Model::ResendContactReachabilityEmailRequest request) const;
+
+        /**
+         * co_await-able form of RetrieveDomainAuthCode(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::RetrieveDomainAuthCodeRequest, Model::RetrieveDomainAuthCodeOutcome> RetrieveDomainAuthCodeAwaitable(Model::RetrieveDomainAuthCodeRequest request) const;
+
+        /**
+         * co_await-able form of TransferDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::TransferDomainRequest, Model::TransferDomainOutcome> TransferDomainAwaitable(Model::TransferDomainRequest request) const;
+
+        /**
+         * co_await-able form of UpdateDomainContact(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::UpdateDomainContactRequest, Model::UpdateDomainContactOutcome> UpdateDomainContactAwaitable(Model::UpdateDomainContactRequest request) const;
+
+        /**
+         * co_await-able form of UpdateDomainContactPrivacy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::UpdateDomainContactPrivacyRequest, Model::UpdateDomainContactPrivacyOutcome> UpdateDomainContactPrivacyAwaitable(Model::UpdateDomainContactPrivacyRequest request) const;
+
+        /**
+         * co_await-able form of UpdateDomainNameservers(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::UpdateDomainNameserversRequest, Model::UpdateDomainNameserversOutcome> UpdateDomainNameserversAwaitable(Model::UpdateDomainNameserversRequest request) const;
+
+        /**
+         * co_await-able form of UpdateTagsForDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::UpdateTagsForDomainRequest, Model::UpdateTagsForDomainOutcome> UpdateTagsForDomainAwaitable(Model::UpdateTagsForDomainRequest request) const;
+
+        /**
+         * co_await-able form of ViewBilling(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<Route53DomainsClient, Model::ViewBillingRequest, Model::ViewBillingOutcome> ViewBillingAwaitable(Model::ViewBillingRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CheckDomainAvailabilityRequest();
+    inline const char* GetServiceRequestName() const override { return "CheckDomainAvailability"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteTagsForDomainRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteTagsForDomain"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DisableDomainAutoRenewRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableDomainAutoRenew"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DisableDomainTransferLockRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableDomainTransferLock"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
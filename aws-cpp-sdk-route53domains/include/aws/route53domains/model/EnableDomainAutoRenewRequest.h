@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     EnableDomainAutoRenewRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableDomainAutoRenew"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     EnableDomainTransferLockRequest();
+    inline const char* GetServiceRequestName() const override { return "EnableDomainTransferLock"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
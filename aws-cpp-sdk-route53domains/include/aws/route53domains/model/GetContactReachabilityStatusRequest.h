@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetContactReachabilityStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "GetContactReachabilityStatus"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
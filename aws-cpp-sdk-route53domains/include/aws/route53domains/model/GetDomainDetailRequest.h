@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetDomainDetailRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDomainDetail"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetDomainSuggestionsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDomainSuggestions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
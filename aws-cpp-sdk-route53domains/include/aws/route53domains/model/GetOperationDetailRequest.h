@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetOperationDetailRequest();
+    inline const char* GetServiceRequestName() const override { return "GetOperationDetail"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
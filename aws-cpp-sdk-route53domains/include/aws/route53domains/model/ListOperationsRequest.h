@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListOperationsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListOperations"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
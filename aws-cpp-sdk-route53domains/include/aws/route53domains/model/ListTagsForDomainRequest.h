@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListTagsForDomainRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTagsForDomain"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
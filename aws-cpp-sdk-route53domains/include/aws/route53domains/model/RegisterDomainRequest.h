@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RegisterDomainRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterDomain"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RenewDomainRequest();
+    inline const char* GetServiceRequestName() const override { return "RenewDomain"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
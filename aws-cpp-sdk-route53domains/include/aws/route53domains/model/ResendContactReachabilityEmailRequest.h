@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ResendContactReachabilityEmailRequest();
+    inline const char* GetServiceRequestName() const override { return "ResendContactReachabilityEmail"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RetrieveDomainAuthCodeRequest();
+    inline const char* GetServiceRequestName() const override { return "RetrieveDomainAuthCode"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     TransferDomainRequest();
+    inline const char* GetServiceRequestName() const override { return "TransferDomain"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateDomainContactPrivacyRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateDomainContactPrivacy"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateDomainContactRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateDomainContact"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
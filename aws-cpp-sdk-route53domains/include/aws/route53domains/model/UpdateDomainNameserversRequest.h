@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateDomainNameserversRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateDomainNameservers"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateTagsForDomainRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateTagsForDomain"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ViewBillingRequest();
+    inline const char* GetServiceRequestName() const override { return "ViewBilling"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
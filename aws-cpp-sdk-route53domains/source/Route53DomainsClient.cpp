@@ -132,7 +132,7 @@ CheckDomainAvailabilityOutcome Route53DomainsClient::CheckDomainAvailability(con
 
 CheckDomainAvailabilityOutcomeCallable Route53DomainsClient::CheckDomainAvailabilityCallable(const CheckDomainAvailabilityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CheckDomainAvailability(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CheckDomainAvailability(request); } );
 }
 
 void Route53DomainsClient::CheckDomainAvailabilityAsync(const CheckDomainAvailabilityRequest& request, const CheckDomainAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -140,6 +140,16 @@ void Route53DomainsClient::CheckDomainAvailabilityAsync(const CheckDomainAvailab
   m_executor->Submit( [this, request, handler, context](){ this->CheckDomainAvailabilityAsyncHelper( request, handler, context ); } );
 }
 
+CheckDomainAvailabilityOutcomeCallable Route53DomainsClient::CheckDomainAvailabilityCallable(CheckDomainAvailabilityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::CheckDomainAvailability, this, std::move(request)));
+}
+
+void Route53DomainsClient::CheckDomainAvailabilityAsync(CheckDomainAvailabilityRequest&& request, const CheckDomainAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::CheckDomainAvailabilityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::CheckDomainAvailabilityAsyncHelper(const CheckDomainAvailabilityRequest& request, const CheckDomainAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CheckDomainAvailability(request), context);
@@ -163,7 +173,7 @@ DeleteTagsForDomainOutcome Route53DomainsClient::DeleteTagsForDomain(const Delet
 
 DeleteTagsForDomainOutcomeCallable Route53DomainsClient::DeleteTagsForDomainCallable(const DeleteTagsForDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTagsForDomain(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTagsForDomain(request); } );
 }
 
 void Route53DomainsClient::DeleteTagsForDomainAsync(const DeleteTagsForDomainRequest& request, const DeleteTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -171,6 +181,16 @@ void Route53DomainsClient::DeleteTagsForDomainAsync(const DeleteTagsForDomainReq
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTagsForDomainAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTagsForDomainOutcomeCallable Route53DomainsClient::DeleteTagsForDomainCallable(DeleteTagsForDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::DeleteTagsForDomain, this, std::move(request)));
+}
+
+void Route53DomainsClient::DeleteTagsForDomainAsync(DeleteTagsForDomainRequest&& request, const DeleteTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::DeleteTagsForDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::DeleteTagsForDomainAsyncHelper(const DeleteTagsForDomainRequest& request, const DeleteTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTagsForDomain(request), context);
@@ -194,7 +214,7 @@ DisableDomainAutoRenewOutcome Route53DomainsClient::DisableDomainAutoRenew(const
 
 DisableDomainAutoRenewOutcomeCallable Route53DomainsClient::DisableDomainAutoRenewCallable(const DisableDomainAutoRenewRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableDomainAutoRenew(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableDomainAutoRenew(request); } );
 }
 
 void Route53DomainsClient::DisableDomainAutoRenewAsync(const DisableDomainAutoRenewRequest& request, const DisableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -202,6 +222,16 @@ void Route53DomainsClient::DisableDomainAutoRenewAsync(const DisableDomainAutoRe
   m_executor->Submit( [this, request, handler, context](){ this->DisableDomainAutoRenewAsyncHelper( request, handler, context ); } );
 }
 
+DisableDomainAutoRenewOutcomeCallable Route53DomainsClient::DisableDomainAutoRenewCallable(DisableDomainAutoRenewRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::DisableDomainAutoRenew, this, std::move(request)));
+}
+
+void Route53DomainsClient::DisableDomainAutoRenewAsync(DisableDomainAutoRenewRequest&& request, const DisableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::DisableDomainAutoRenewAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::DisableDomainAutoRenewAsyncHelper(const DisableDomainAutoRenewRequest& request, const DisableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableDomainAutoRenew(request), context);
@@ -225,7 +255,7 @@ DisableDomainTransferLockOutcome Route53DomainsClient::DisableDomainTransferLock
 
 DisableDomainTransferLockOutcomeCallable Route53DomainsClient::DisableDomainTransferLockCallable(const DisableDomainTransferLockRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableDomainTransferLock(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableDomainTransferLock(request); } );
 }
 
 void Route53DomainsClient::DisableDomainTransferLockAsync(const DisableDomainTransferLockRequest& request, const DisableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -233,6 +263,16 @@ void Route53DomainsClient::DisableDomainTransferLockAsync(const DisableDomainTra
   m_executor->Submit( [this, request, handler, context](){ this->DisableDomainTransferLockAsyncHelper( request, handler, context ); } );
 }
 
+DisableDomainTransferLockOutcomeCallable Route53DomainsClient::DisableDomainTransferLockCallable(DisableDomainTransferLockRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::DisableDomainTransferLock, this, std::move(request)));
+}
+
+void Route53DomainsClient::DisableDomainTransferLockAsync(DisableDomainTransferLockRequest&& request, const DisableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::DisableDomainTransferLockAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::DisableDomainTransferLockAsyncHelper(const DisableDomainTransferLockRequest& request, const DisableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableDomainTransferLock(request), context);
@@ -256,7 +296,7 @@ EnableDomainAutoRenewOutcome Route53DomainsClient::EnableDomainAutoRenew(const E
 
 EnableDomainAutoRenewOutcomeCallable Route53DomainsClient::EnableDomainAutoRenewCallable(const EnableDomainAutoRenewRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableDomainAutoRenew(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableDomainAutoRenew(request); } );
 }
 
 void Route53DomainsClient::EnableDomainAutoRenewAsync(const EnableDomainAutoRenewRequest& request, const EnableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -264,6 +304,16 @@ void Route53DomainsClient::EnableDomainAutoRenewAsync(const EnableDomainAutoRene
   m_executor->Submit( [this, request, handler, context](){ this->EnableDomainAutoRenewAsyncHelper( request, handler, context ); } );
 }
 
+EnableDomainAutoRenewOutcomeCallable Route53DomainsClient::EnableDomainAutoRenewCallable(EnableDomainAutoRenewRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::EnableDomainAutoRenew, this, std::move(request)));
+}
+
+void Route53DomainsClient::EnableDomainAutoRenewAsync(EnableDomainAutoRenewRequest&& request, const EnableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::EnableDomainAutoRenewAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::EnableDomainAutoRenewAsyncHelper(const EnableDomainAutoRenewRequest& request, const EnableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableDomainAutoRenew(request), context);
@@ -287,7 +337,7 @@ EnableDomainTransferLockOutcome Route53DomainsClient::EnableDomainTransferLock(c
 
 EnableDomainTransferLockOutcomeCallable Route53DomainsClient::EnableDomainTransferLockCallable(const EnableDomainTransferLockRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->EnableDomainTransferLock(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->EnableDomainTransferLock(request); } );
 }
 
 void Route53DomainsClient::EnableDomainTransferLockAsync(const EnableDomainTransferLockRequest& request, const EnableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -295,6 +345,16 @@ void Route53DomainsClient::EnableDomainTransferLockAsync(const EnableDomainTrans
   m_executor->Submit( [this, request, handler, context](){ this->EnableDomainTransferLockAsyncHelper( request, handler, context ); } );
 }
 
+EnableDomainTransferLockOutcomeCallable Route53DomainsClient::EnableDomainTransferLockCallable(EnableDomainTransferLockRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::EnableDomainTransferLock, this, std::move(request)));
+}
+
+void Route53DomainsClient::EnableDomainTransferLockAsync(EnableDomainTransferLockRequest&& request, const EnableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::EnableDomainTransferLockAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::EnableDomainTransferLockAsyncHelper(const EnableDomainTransferLockRequest& request, const EnableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, EnableDomainTransferLock(request), context);
@@ -318,7 +378,7 @@ GetContactReachabilityStatusOutcome Route53DomainsClient::GetContactReachability
 
 GetContactReachabilityStatusOutcomeCallable Route53DomainsClient::GetContactReachabilityStatusCallable(const GetContactReachabilityStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetContactReachabilityStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetContactReachabilityStatus(request); } );
 }
 
 void Route53DomainsClient::GetContactReachabilityStatusAsync(const GetContactReachabilityStatusRequest& request, const GetContactReachabilityStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -326,6 +386,16 @@ void Route53DomainsClient::GetContactReachabilityStatusAsync(const GetContactRea
   m_executor->Submit( [this, request, handler, context](){ this->GetContactReachabilityStatusAsyncHelper( request, handler, context ); } );
 }
 
+GetContactReachabilityStatusOutcomeCallable Route53DomainsClient::GetContactReachabilityStatusCallable(GetContactReachabilityStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::GetContactReachabilityStatus, this, std::move(request)));
+}
+
+void Route53DomainsClient::GetContactReachabilityStatusAsync(GetContactReachabilityStatusRequest&& request, const GetContactReachabilityStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::GetContactReachabilityStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::GetContactReachabilityStatusAsyncHelper(const GetContactReachabilityStatusRequest& request, const GetContactReachabilityStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetContactReachabilityStatus(request), context);
@@ -349,7 +419,7 @@ GetDomainDetailOutcome Route53DomainsClient::GetDomainDetail(const GetDomainDeta
 
 GetDomainDetailOutcomeCallable Route53DomainsClient::GetDomainDetailCallable(const GetDomainDetailRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDomainDetail(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDomainDetail(request); } );
 }
 
 void Route53DomainsClient::GetDomainDetailAsync(const GetDomainDetailRequest& request, const GetDomainDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -357,6 +427,16 @@ void Route53DomainsClient::GetDomainDetailAsync(const GetDomainDetailRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->GetDomainDetailAsyncHelper( request, handler, context ); } );
 }
 
+GetDomainDetailOutcomeCallable Route53DomainsClient::GetDomainDetailCallable(GetDomainDetailRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::GetDomainDetail, this, std::move(request)));
+}
+
+void Route53DomainsClient::GetDomainDetailAsync(GetDomainDetailRequest&& request, const GetDomainDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::GetDomainDetailAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::GetDomainDetailAsyncHelper(const GetDomainDetailRequest& request, const GetDomainDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDomainDetail(request), context);
@@ -380,7 +460,7 @@ GetDomainSuggestionsOutcome Route53DomainsClient::GetDomainSuggestions(const Get
 
 GetDomainSuggestionsOutcomeCallable Route53DomainsClient::GetDomainSuggestionsCallable(const GetDomainSuggestionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDomainSuggestions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDomainSuggestions(request); } );
 }
 
 void Route53DomainsClient::GetDomainSuggestionsAsync(const GetDomainSuggestionsRequest& request, const GetDomainSuggestionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -388,6 +468,16 @@ void Route53DomainsClient::GetDomainSuggestionsAsync(const GetDomainSuggestionsR
   m_executor->Submit( [this, request, handler, context](){ this->GetDomainSuggestionsAsyncHelper( request, handler, context ); } );
 }
 
+GetDomainSuggestionsOutcomeCallable Route53DomainsClient::GetDomainSuggestionsCallable(GetDomainSuggestionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::GetDomainSuggestions, this, std::move(request)));
+}
+
+void Route53DomainsClient::GetDomainSuggestionsAsync(GetDomainSuggestionsRequest&& request, const GetDomainSuggestionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::GetDomainSuggestionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::GetDomainSuggestionsAsyncHelper(const GetDomainSuggestionsRequest& request, const GetDomainSuggestionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDomainSuggestions(request), context);
@@ -411,7 +501,7 @@ GetOperationDetailOutcome Route53DomainsClient::GetOperationDetail(const GetOper
 
 GetOperationDetailOutcomeCallable Route53DomainsClient::GetOperationDetailCallable(const GetOperationDetailRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetOperationDetail(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetOperationDetail(request); } );
 }
 
 void Route53DomainsClient::GetOperationDetailAsync(const GetOperationDetailRequest& request, const GetOperationDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -419,6 +509,16 @@ void Route53DomainsClient::GetOperationDetailAsync(const GetOperationDetailReque
   m_executor->Submit( [this, request, handler, context](){ this->GetOperationDetailAsyncHelper( request, handler, context ); } );
 }
 
+GetOperationDetailOutcomeCallable Route53DomainsClient::GetOperationDetailCallable(GetOperationDetailRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::GetOperationDetail, this, std::move(request)));
+}
+
+void Route53DomainsClient::GetOperationDetailAsync(GetOperationDetailRequest&& request, const GetOperationDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::GetOperationDetailAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::GetOperationDetailAsyncHelper(const GetOperationDetailRequest& request, const GetOperationDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetOperationDetail(request), context);
@@ -442,7 +542,7 @@ ListDomainsOutcome Route53DomainsClient::ListDomains(const ListDomainsRequest& r
 
 ListDomainsOutcomeCallable Route53DomainsClient::ListDomainsCallable(const ListDomainsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDomains(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDomains(request); } );
 }
 
 void Route53DomainsClient::ListDomainsAsync(const ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -450,6 +550,16 @@ void Route53DomainsClient::ListDomainsAsync(const ListDomainsRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->ListDomainsAsyncHelper( request, handler, context ); } );
 }
 
+ListDomainsOutcomeCallable Route53DomainsClient::ListDomainsCallable(ListDomainsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::ListDomains, this, std::move(request)));
+}
+
+void Route53DomainsClient::ListDomainsAsync(ListDomainsRequest&& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::ListDomainsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::ListDomainsAsyncHelper(const ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDomains(request), context);
@@ -473,7 +583,7 @@ ListOperationsOutcome Route53DomainsClient::ListOperations(const ListOperationsR
 
 ListOperationsOutcomeCallable Route53DomainsClient::ListOperationsCallable(const ListOperationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListOperations(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListOperations(request); } );
 }
 
 void Route53DomainsClient::ListOperationsAsync(const ListOperationsRequest& request, const ListOperationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -481,6 +591,16 @@ void Route53DomainsClient::ListOperationsAsync(const ListOperationsRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->ListOperationsAsyncHelper( request, handler, context ); } );
 }
 
+ListOperationsOutcomeCallable Route53DomainsClient::ListOperationsCallable(ListOperationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::ListOperations, this, std::move(request)));
+}
+
+void Route53DomainsClient::ListOperationsAsync(ListOperationsRequest&& request, const ListOperationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::ListOperationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::ListOperationsAsyncHelper(const ListOperationsRequest& request, const ListOperationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListOperations(request), context);
@@ -504,7 +624,7 @@ ListTagsForDomainOutcome Route53DomainsClient::ListTagsForDomain(const ListTagsF
 
 ListTagsForDomainOutcomeCallable Route53DomainsClient::ListTagsForDomainCallable(const ListTagsForDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTagsForDomain(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTagsForDomain(request); } );
 }
 
 void Route53DomainsClient::ListTagsForDomainAsync(const ListTagsForDomainRequest& request, const ListTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -512,6 +632,16 @@ void Route53DomainsClient::ListTagsForDomainAsync(const ListTagsForDomainRequest
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsForDomainAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsForDomainOutcomeCallable Route53DomainsClient::ListTagsForDomainCallable(ListTagsForDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::ListTagsForDomain, this, std::move(request)));
+}
+
+void Route53DomainsClient::ListTagsForDomainAsync(ListTagsForDomainRequest&& request, const ListTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::ListTagsForDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::ListTagsForDomainAsyncHelper(const ListTagsForDomainRequest& request, const ListTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTagsForDomain(request), context);
@@ -535,7 +665,7 @@ RegisterDomainOutcome Route53DomainsClient::RegisterDomain(const RegisterDomainR
 
 RegisterDomainOutcomeCallable Route53DomainsClient::RegisterDomainCallable(const RegisterDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterDomain(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterDomain(request); } );
 }
 
 void Route53DomainsClient::RegisterDomainAsync(const RegisterDomainRequest& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -543,6 +673,16 @@ void Route53DomainsClient::RegisterDomainAsync(const RegisterDomainRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->RegisterDomainAsyncHelper( request, handler, context ); } );
 }
 
+RegisterDomainOutcomeCallable Route53DomainsClient::RegisterDomainCallable(RegisterDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::RegisterDomain, this, std::move(request)));
+}
+
+void Route53DomainsClient::RegisterDomainAsync(RegisterDomainRequest&& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::RegisterDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::RegisterDomainAsyncHelper(const RegisterDomainRequest& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterDomain(request), context);
@@ -566,7 +706,7 @@ RenewDomainOutcome Route53DomainsClient::RenewDomain(const RenewDomainRequest& r
 
 RenewDomainOutcomeCallable Route53DomainsClient::RenewDomainCallable(const RenewDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RenewDomain(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RenewDomain(request); } );
 }
 
 void Route53DomainsClient::RenewDomainAsync(const RenewDomainRequest& request, const RenewDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -574,6 +714,16 @@ void Route53DomainsClient::RenewDomainAsync(const RenewDomainRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->RenewDomainAsyncHelper( request, handler, context ); } );
 }
 
+RenewDomainOutcomeCallable Route53DomainsClient::RenewDomainCallable(RenewDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::RenewDomain, this, std::move(request)));
+}
+
+void Route53DomainsClient::RenewDomainAsync(RenewDomainRequest&& request, const RenewDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::RenewDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::RenewDomainAsyncHelper(const RenewDomainRequest& request, const RenewDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RenewDomain(request), context);
@@ -597,7 +747,7 @@ ResendContactReachabilityEmailOutcome Route53DomainsClient::ResendContactReachab
 
 ResendContactReachabilityEmailOutcomeCallable Route53DomainsClient::ResendContactReachabilityEmailCallable(const ResendContactReachabilityEmailRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResendContactReachabilityEmail(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResendContactReachabilityEmail(request); } );
 }
 
 void Route53DomainsClient::ResendContactReachabilityEmailAsync(const ResendContactReachabilityEmailRequest& request, const ResendContactReachabilityEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -605,6 +755,16 @@ void Route53DomainsClient::ResendContactReachabilityEmailAsync(const ResendConta
   m_executor->Submit( [this, request, handler, context](){ this->ResendContactReachabilityEmailAsyncHelper( request, handler, context ); } );
 }
 
+ResendContactReachabilityEmailOutcomeCallable Route53DomainsClient::ResendContactReachabilityEmailCallable(ResendContactReachabilityEmailRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::ResendContactReachabilityEmail, this, std::move(request)));
+}
+
+void Route53DomainsClient::ResendContactReachabilityEmailAsync(ResendContactReachabilityEmailRequest&& request, const ResendContactReachabilityEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::ResendContactReachabilityEmailAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::ResendContactReachabilityEmailAsyncHelper(const ResendContactReachabilityEmailRequest& request, const ResendContactReachabilityEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResendContactReachabilityEmail(request), context);
@@ -628,7 +788,7 @@ RetrieveDomainAuthCodeOutcome Route53DomainsClient::RetrieveDomainAuthCode(const
 
 RetrieveDomainAuthCodeOutcomeCallable Route53DomainsClient::RetrieveDomainAuthCodeCallable(const RetrieveDomainAuthCodeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RetrieveDomainAuthCode(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RetrieveDomainAuthCode(request); } );
 }
 
 void Route53DomainsClient::RetrieveDomainAuthCodeAsync(const RetrieveDomainAuthCodeRequest& request, const RetrieveDomainAuthCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -636,6 +796,16 @@ void Route53DomainsClient::RetrieveDomainAuthCodeAsync(const RetrieveDomainAuthC
   m_executor->Submit( [this, request, handler, context](){ this->RetrieveDomainAuthCodeAsyncHelper( request, handler, context ); } );
 }
 
+RetrieveDomainAuthCodeOutcomeCallable Route53DomainsClient::RetrieveDomainAuthCodeCallable(RetrieveDomainAuthCodeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::RetrieveDomainAuthCode, this, std::move(request)));
+}
+
+void Route53DomainsClient::RetrieveDomainAuthCodeAsync(RetrieveDomainAuthCodeRequest&& request, const RetrieveDomainAuthCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::RetrieveDomainAuthCodeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::RetrieveDomainAuthCodeAsyncHelper(const RetrieveDomainAuthCodeRequest& request, const RetrieveDomainAuthCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RetrieveDomainAuthCode(request), context);
@@ -659,7 +829,7 @@ TransferDomainOutcome Route53DomainsClient::TransferDomain(const TransferDomainR
 
 TransferDomainOutcomeCallable Route53DomainsClient::TransferDomainCallable(const TransferDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TransferDomain(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TransferDomain(request); } );
 }
 
 void Route53DomainsClient::TransferDomainAsync(const TransferDomainRequest& request, const TransferDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -667,6 +837,16 @@ void Route53DomainsClient::TransferDomainAsync(const TransferDomainRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->TransferDomainAsyncHelper( request, handler, context ); } );
 }
 
+TransferDomainOutcomeCallable Route53DomainsClient::TransferDomainCallable(TransferDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::TransferDomain, this, std::move(request)));
+}
+
+void Route53DomainsClient::TransferDomainAsync(TransferDomainRequest&& request, const TransferDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::TransferDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::TransferDomainAsyncHelper(const TransferDomainRequest& request, const TransferDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TransferDomain(request), context);
@@ -690,7 +870,7 @@ UpdateDomainContactOutcome Route53DomainsClient::UpdateDomainContact(const Updat
 
 UpdateDomainContactOutcomeCallable Route53DomainsClient::UpdateDomainContactCallable(const UpdateDomainContactRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateDomainContact(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateDomainContact(request); } );
 }
 
 void Route53DomainsClient::UpdateDomainContactAsync(const UpdateDomainContactRequest& request, const UpdateDomainContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -698,6 +878,16 @@ void Route53DomainsClient::UpdateDomainContactAsync(const UpdateDomainContactReq
   m_executor->Submit( [this, request, handler, context](){ this->UpdateDomainContactAsyncHelper( request, handler, context ); } );
 }
 
+UpdateDomainContactOutcomeCallable Route53DomainsClient::UpdateDomainContactCallable(UpdateDomainContactRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::UpdateDomainContact, this, std::move(request)));
+}
+
+void Route53DomainsClient::UpdateDomainContactAsync(UpdateDomainContactRequest&& request, const UpdateDomainContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::UpdateDomainContactAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::UpdateDomainContactAsyncHelper(const UpdateDomainContactRequest& request, const UpdateDomainContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateDomainContact(request), context);
@@ -721,7 +911,7 @@ UpdateDomainContactPrivacyOutcome Route53DomainsClient::UpdateDomainContactPriva
 
 UpdateDomainContactPrivacyOutcomeCallable Route53DomainsClient::UpdateDomainContactPrivacyCallable(const UpdateDomainContactPrivacyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateDomainContactPrivacy(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateDomainContactPrivacy(request); } );
 }
 
 void Route53DomainsClient::UpdateDomainContactPrivacyAsync(const UpdateDomainContactPrivacyRequest& request, const UpdateDomainContactPrivacyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -729,6 +919,16 @@ void Route53DomainsClient::UpdateDomainContactPrivacyAsync(const UpdateDomainCon
   m_executor->Submit( [this, request, handler, context](){ this->UpdateDomainContactPrivacyAsyncHelper( request, handler, context ); } );
 }
 
+UpdateDomainContactPrivacyOutcomeCallable Route53DomainsClient::UpdateDomainContactPrivacyCallable(UpdateDomainContactPrivacyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::UpdateDomainContactPrivacy, this, std::move(request)));
+}
+
+void Route53DomainsClient::UpdateDomainContactPrivacyAsync(UpdateDomainContactPrivacyRequest&& request, const UpdateDomainContactPrivacyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::UpdateDomainContactPrivacyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::UpdateDomainContactPrivacyAsyncHelper(const UpdateDomainContactPrivacyRequest& request, const UpdateDomainContactPrivacyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateDomainContactPrivacy(request), context);
@@ -752,7 +952,7 @@ UpdateDomainNameserversOutcome Route53DomainsClient::UpdateDomainNameservers(con
 
 UpdateDomainNameserversOutcomeCallable Route53DomainsClient::UpdateDomainNameserversCallable(const UpdateDomainNameserversRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateDomainNameservers(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateDomainNameservers(request); } );
 }
 
 void Route53DomainsClient::UpdateDomainNameserversAsync(const UpdateDomainNameserversRequest& request, const UpdateDomainNameserversResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -760,6 +960,16 @@ void Route53DomainsClient::UpdateDomainNameserversAsync(const UpdateDomainNamese
   m_executor->Submit( [this, request, handler, context](){ this->UpdateDomainNameserversAsyncHelper( request, handler, context ); } );
 }
 
+UpdateDomainNameserversOutcomeCallable Route53DomainsClient::UpdateDomainNameserversCallable(UpdateDomainNameserversRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::UpdateDomainNameservers, this, std::move(request)));
+}
+
+void Route53DomainsClient::UpdateDomainNameserversAsync(UpdateDomainNameserversRequest&& request, const UpdateDomainNameserversResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::UpdateDomainNameserversAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::UpdateDomainNameserversAsyncHelper(const UpdateDomainNameserversRequest& request, const UpdateDomainNameserversResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateDomainNameservers(request), context);
@@ -783,7 +993,7 @@ UpdateTagsForDomainOutcome Route53DomainsClient::UpdateTagsForDomain(const Updat
 
 UpdateTagsForDomainOutcomeCallable Route53DomainsClient::UpdateTagsForDomainCallable(const UpdateTagsForDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateTagsForDomain(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateTagsForDomain(request); } );
 }
 
 void Route53DomainsClient::UpdateTagsForDomainAsync(const UpdateTagsForDomainRequest& request, const UpdateTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -791,6 +1001,16 @@ void Route53DomainsClient::UpdateTagsForDomainAsync(const UpdateTagsForDomainReq
   m_executor->Submit( [this, request, handler, context](){ this->UpdateTagsForDomainAsyncHelper( request, handler, context ); } );
 }
 
+UpdateTagsForDomainOutcomeCallable Route53DomainsClient::UpdateTagsForDomainCallable(UpdateTagsForDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::UpdateTagsForDomain, this, std::move(request)));
+}
+
+void Route53DomainsClient::UpdateTagsForDomainAsync(UpdateTagsForDomainRequest&& request, const UpdateTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::UpdateTagsForDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::UpdateTagsForDomainAsyncHelper(const UpdateTagsForDomainRequest& request, const UpdateTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateTagsForDomain(request), context);
@@ -814,7 +1034,7 @@ ViewBillingOutcome Route53DomainsClient::ViewBilling(const ViewBillingRequest& r
 
 ViewBillingOutcomeCallable Route53DomainsClient::ViewBillingCallable(const ViewBillingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ViewBilling(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ViewBilling(request); } );
 }
 
 void Route53DomainsClient::ViewBillingAsync(const ViewBillingRequest& request, const ViewBillingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -822,8 +1042,186 @@ void Route53DomainsClient::ViewBillingAsync(const ViewBillingRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->ViewBillingAsyncHelper( request, handler, context ); } );
 }
 
+ViewBillingOutcomeCallable Route53DomainsClient::ViewBillingCallable(ViewBillingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&Route53DomainsClient::ViewBilling, this, std::move(request)));
+}
+
+void Route53DomainsClient::ViewBillingAsync(ViewBillingRequest&& request, const ViewBillingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&Route53DomainsClient::ViewBillingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void Route53DomainsClient::ViewBillingAsyncHelper(const ViewBillingRequest& request, const ViewBillingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ViewBilling(request), context);
 }
 
+Paginator<Route53DomainsClient, ListDomainsRequest, ListDomainsOutcome> Route53DomainsClient::ListDomainsPaginator(const ListDomainsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<Route53DomainsClient, ListDomainsRequest, ListDomainsOutcome>(this, &Route53DomainsClient::ListDomains, request,
+    [](const ListDomainsRequest& current, const ListDomainsOutcome& outcome, ListDomainsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<Route53DomainsClient, ListOperationsRequest, ListOperationsOutcome> Route53DomainsClient::ListOperationsPaginator(const ListOperationsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<Route53DomainsClient, ListOperationsRequest, ListOperationsOutcome>(this, &Route53DomainsClient::ListOperations, request,
+    [](const ListOperationsRequest& current, const ListOperationsOutcome& outcome, ListOperationsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<Route53DomainsClient, ViewBillingRequest, ViewBillingOutcome> Route53DomainsClient::ViewBillingPaginator(const ViewBillingRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<Route53DomainsClient, ViewBillingRequest, ViewBillingOutcome>(this, &Route53DomainsClient::ViewBilling, request,
+    [](const ViewBillingRequest& current, const ViewBillingOutcome& outcome, ViewBillingRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<Route53DomainsClient, CheckDomainAvailabilityRequest, CheckDomainAvailabilityOutcome> Route53DomainsClient::CheckDomainAvailabilityAwaitable(CheckDomainAvailabilityRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::CheckDomainAvailability, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, DeleteTagsForDomainRequest, DeleteTagsForDomainOutcome> Route53DomainsClient::DeleteTagsForDomainAwaitable(DeleteTagsForDomainRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::DeleteTagsForDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, DisableDomainAutoRenewRequest, DisableDomainAutoRenewOutcome> Route53DomainsClient::DisableDomainAutoRenewAwaitable(DisableDomainAutoRenewRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::DisableDomainAutoRenew, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, DisableDomainTransferLockRequest, DisableDomainTransferLockOutcome> Route53DomainsClient::DisableDomainTransferLockAwaitable(DisableDomainTransferLockRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::DisableDomainTransferLock, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, EnableDomainAutoRenewRequest, EnableDomainAutoRenewOutcome> Route53DomainsClient::EnableDomainAutoRenewAwaitable(EnableDomainAutoRenewRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::EnableDomainAutoRenew, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, EnableDomainTransferLockRequest, EnableDomainTransferLockOutcome> Route53DomainsClient::EnableDomainTransferLockAwaitable(EnableDomainTransferLockRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::EnableDomainTransferLock, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, GetContactReachabilityStatusRequest, GetContactReachabilityStatusOutcome> Route53DomainsClient::GetContactReachabilityStatusAwaitable(GetContactReachabilityStatusRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::GetContactReachabilityStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, GetDomainDetailRequest, GetDomainDetailOutcome> Route53DomainsClient::GetDomainDetailAwaitable(GetDomainDetailRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::GetDomainDetail, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, GetDomainSuggestionsRequest, GetDomainSuggestionsOutcome> Route53DomainsClient::GetDomainSuggestionsAwaitable(GetDomainSuggestionsRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::GetDomainSuggestions, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, GetOperationDetailRequest, GetOperationDetailOutcome> Route53DomainsClient::GetOperationDetailAwaitable(GetOperationDetailRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::GetOperationDetail, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, ListDomainsRequest, ListDomainsOutcome> Route53DomainsClient::ListDomainsAwaitable(ListDomainsRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::ListDomains, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, ListOperationsRequest, ListOperationsOutcome> Route53DomainsClient::ListOperationsAwaitable(ListOperationsRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::ListOperations, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, ListTagsForDomainRequest, ListTagsForDomainOutcome> Route53DomainsClient::ListTagsForDomainAwaitable(ListTagsForDomainRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::ListTagsForDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, RegisterDomainRequest, RegisterDomainOutcome> Route53DomainsClient::RegisterDomainAwaitable(RegisterDomainRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::RegisterDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, RenewDomainRequest, RenewDomainOutcome> Route53DomainsClient::RenewDomainAwaitable(RenewDomainRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::RenewDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, ResendContactReachabilityEmailRequest, ResendContactReachabilityEmailOutcome> Route53DomainsClient::ResendContactReachabilityEmailAwaitable(ResendContactReachabilityEmailRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::ResendContactReachabilityEmail, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, RetrieveDomainAuthCodeRequest, RetrieveDomainAuthCodeOutcome> Route53DomainsClient::RetrieveDomainAuthCodeAwaitable(RetrieveDomainAuthCodeRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::RetrieveDomainAuthCode, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, TransferDomainRequest, TransferDomainOutcome> Route53DomainsClient::TransferDomainAwaitable(TransferDomainRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::TransferDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, UpdateDomainContactRequest, UpdateDomainContactOutcome> Route53DomainsClient::UpdateDomainContactAwaitable(UpdateDomainContactRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::UpdateDomainContact, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, UpdateDomainContactPrivacyRequest, UpdateDomainContactPrivacyOutcome> Route53DomainsClient::UpdateDomainContactPrivacyAwaitable(UpdateDomainContactPrivacyRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::UpdateDomainContactPrivacy, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, UpdateDomainNameserversRequest, UpdateDomainNameserversOutcome> Route53DomainsClient::UpdateDomainNameserversAwaitable(UpdateDomainNameserversRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::UpdateDomainNameservers, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, UpdateTagsForDomainRequest, UpdateTagsForDomainOutcome> Route53DomainsClient::UpdateTagsForDomainAwaitable(UpdateTagsForDomainRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::UpdateTagsForDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<Route53DomainsClient, ViewBillingRequest, ViewBillingOutcome> Route53DomainsClient::ViewBillingAwaitable(ViewBillingRequest request) const
+{
+  return { m_executor.get(), { this, &Route53DomainsClient::ViewBilling, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,36 +29,38 @@ namespace Aws
       namespace ContactTypeMapper
       {
 
-        static const int PERSON_HASH = HashingUtils::HashString("PERSON");
-        static const int COMPANY_HASH = HashingUtils::HashString("COMPANY");
-        static const int ASSOCIATION_HASH = HashingUtils::HashString("ASSOCIATION");
-        static const int PUBLIC_BODY_HASH = HashingUtils::HashString("PUBLIC_BODY");
-        static const int RESELLER_HASH = HashingUtils::HashString("RESELLER");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PERSON_HASH = -1938387115;
+        static const int COMPANY_HASH = 1668466781;
+        static const int ASSOCIATION_HASH = 2065461345;
+        static const int PUBLIC_BODY_HASH = 1101913528;
+        static const int RESELLER_HASH = 432053106;
 
 
         ContactType GetContactTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PERSON_HASH)
+          switch (hashCode)
           {
+          case PERSON_HASH:
             return ContactType::PERSON;
-          }
-          else if (hashCode == COMPANY_HASH)
-          {
+          case COMPANY_HASH:
             return ContactType::COMPANY;
-          }
-          else if (hashCode == ASSOCIATION_HASH)
-          {
+          case ASSOCIATION_HASH:
             return ContactType::ASSOCIATION;
-          }
-          else if (hashCode == PUBLIC_BODY_HASH)
-          {
+          case PUBLIC_BODY_HASH:
             return ContactType::PUBLIC_BODY;
-          }
-          else if (hashCode == RESELLER_HASH)
-          {
+          case RESELLER_HASH:
             return ContactType::RESELLER;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
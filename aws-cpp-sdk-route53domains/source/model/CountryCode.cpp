@@ -29,2139 +29,1191 @@ namespace Aws
       namespace CountryCodeMapper
       {
 
-        static const int AD_HASH = HashingUtils::HashString("AD");
-        static const int AE_HASH = HashingUtils::HashString("AE");
-        static const int AF_HASH = HashingUtils::HashString("AF");
-        static const int AG_HASH = HashingUtils::HashString("AG");
-        static const int AI_HASH = HashingUtils::HashString("AI");
-        static const int AL_HASH = HashingUtils::HashString("AL");
-        static const int AM_HASH = HashingUtils::HashString("AM");
-        static const int AN_HASH = HashingUtils::HashString("AN");
-        static const int AO_HASH = HashingUtils::HashString("AO");
-        static const int AQ_HASH = HashingUtils::HashString("AQ");
-        static const int AR_HASH = HashingUtils::HashString("AR");
-        static const int AS_HASH = HashingUtils::HashString("AS");
-        static const int AT_HASH = HashingUtils::HashString("AT");
-        static const int AU_HASH = HashingUtils::HashString("AU");
-        static const int AW_HASH = HashingUtils::HashString("AW");
-        static const int AZ_HASH = HashingUtils::HashString("AZ");
-        static const int BA_HASH = HashingUtils::HashString("BA");
-        static const int BB_HASH = HashingUtils::HashString("BB");
-        static const int BD_HASH = HashingUtils::HashString("BD");
-        static const int BE_HASH = HashingUtils::HashString("BE");
-        static const int BF_HASH = HashingUtils::HashString("BF");
-        static const int BG_HASH = HashingUtils::HashString("BG");
-        static const int BH_HASH = HashingUtils::HashString("BH");
-        static const int BI_HASH = HashingUtils::HashString("BI");
-        static const int BJ_HASH = HashingUtils::HashString("BJ");
-        static const int BL_HASH = HashingUtils::HashString("BL");
-        static const int BM_HASH = HashingUtils::HashString("BM");
-        static const int BN_HASH = HashingUtils::HashString("BN");
-        static const int BO_HASH = HashingUtils::HashString("BO");
-        static const int BR_HASH = HashingUtils::HashString("BR");
-        static const int BS_HASH = HashingUtils::HashString("BS");
-        static const int BT_HASH = HashingUtils::HashString("BT");
-        static const int BW_HASH = HashingUtils::HashString("BW");
-        static const int BY_HASH = HashingUtils::HashString("BY");
-        static const int BZ_HASH = HashingUtils::HashString("BZ");
-        static const int CA_HASH = HashingUtils::HashString("CA");
-        static const int CC_HASH = HashingUtils::HashString("CC");
-        static const int CD_HASH = HashingUtils::HashString("CD");
-        static const int CF_HASH = HashingUtils::HashString("CF");
-        static const int CG_HASH = HashingUtils::HashString("CG");
-        static const int CH_HASH = HashingUtils::HashString("CH");
-        static const int CI_HASH = HashingUtils::HashString("CI");
-        static const int CK_HASH = HashingUtils::HashString("CK");
-        static const int CL_HASH = HashingUtils::HashString("CL");
-        static const int CM_HASH = HashingUtils::HashString("CM");
-        static const int CN_HASH = HashingUtils::HashString("CN");
-        static const int CO_HASH = HashingUtils::HashString("CO");
-        static const int CR_HASH = HashingUtils::HashString("CR");
-        static const int CU_HASH = HashingUtils::HashString("CU");
-        static const int CV_HASH = HashingUtils::HashString("CV");
-        static const int CX_HASH = HashingUtils::HashString("CX");
-        static const int CY_HASH = HashingUtils::HashString("CY");
-        static const int CZ_HASH = HashingUtils::HashString("CZ");
-        static const int DE_HASH = HashingUtils::HashString("DE");
-        static const int DJ_HASH = HashingUtils::HashString("DJ");
-        static const int DK_HASH = HashingUtils::HashString("DK");
-        static const int DM_HASH = HashingUtils::HashString("DM");
-        static const int DO_HASH = HashingUtils::HashString("DO");
-        static const int DZ_HASH = HashingUtils::HashString("DZ");
-        static const int EC_HASH = HashingUtils::HashString("EC");
-        static const int EE_HASH = HashingUtils::HashString("EE");
-        static const int EG_HASH = HashingUtils::HashString("EG");
-        static const int ER_HASH = HashingUtils::HashString("ER");
-        static const int ES_HASH = HashingUtils::HashString("ES");
-        static const int ET_HASH = HashingUtils::HashString("ET");
-        static const int FI_HASH = HashingUtils::HashString("FI");
-        static const int FJ_HASH = HashingUtils::HashString("FJ");
-        static const int FK_HASH = HashingUtils::HashString("FK");
-        static const int FM_HASH = HashingUtils::HashString("FM");
-        static const int FO_HASH = HashingUtils::HashString("FO");
-        static const int FR_HASH = HashingUtils::HashString("FR");
-        static const int GA_HASH = HashingUtils::HashString("GA");
-        static const int GB_HASH = HashingUtils::HashString("GB");
-        static const int GD_HASH = HashingUtils::HashString("GD");
-        static const int GE_HASH = HashingUtils::HashString("GE");
-        static const int GH_HASH = HashingUtils::HashString("GH");
-        static const int GI_HASH = HashingUtils::HashString("GI");
-        static const int GL_HASH = HashingUtils::HashString("GL");
-        static const int GM_HASH = HashingUtils::HashString("GM");
-        static const int GN_HASH = HashingUtils::HashString("GN");
-        static const int GQ_HASH = HashingUtils::HashString("GQ");
-        static const int GR_HASH = HashingUtils::HashString("GR");
-        static const int GT_HASH = HashingUtils::HashString("GT");
-        static const int GU_HASH = HashingUtils::HashString("GU");
-        static const int GW_HASH = HashingUtils::HashString("GW");
-        static const int GY_HASH = HashingUtils::HashString("GY");
-        static const int HK_HASH = HashingUtils::HashString("HK");
-        static const int HN_HASH = HashingUtils::HashString("HN");
-        static const int HR_HASH = HashingUtils::HashString("HR");
-        static const int HT_HASH = HashingUtils::HashString("HT");
-        static const int HU_HASH = HashingUtils::HashString("HU");
-        static const int ID_HASH = HashingUtils::HashString("ID");
-        static const int IE_HASH = HashingUtils::HashString("IE");
-        static const int IL_HASH = HashingUtils::HashString("IL");
-        static const int IM_HASH = HashingUtils::HashString("IM");
-        static const int IN_HASH = HashingUtils::HashString("IN");
-        static const int IQ_HASH = HashingUtils::HashString("IQ");
-        static const int IR_HASH = HashingUtils::HashString("IR");
-        static const int IS_HASH = HashingUtils::HashString("IS");
-        static const int IT_HASH = HashingUtils::HashString("IT");
-        static const int JM_HASH = HashingUtils::HashString("JM");
-        static const int JO_HASH = HashingUtils::HashString("JO");
-        static const int JP_HASH = HashingUtils::HashString("JP");
-        static const int KE_HASH = HashingUtils::HashString("KE");
-        static const int KG_HASH = HashingUtils::HashString("KG");
-        static const int KH_HASH = HashingUtils::HashString("KH");
-        static const int KI_HASH = HashingUtils::HashString("KI");
-        static const int KM_HASH = HashingUtils::HashString("KM");
-        static const int KN_HASH = HashingUtils::HashString("KN");
-        static const int KP_HASH = HashingUtils::HashString("KP");
-        static const int KR_HASH = HashingUtils::HashString("KR");
-        static const int KW_HASH = HashingUtils::HashString("KW");
-        static const int KY_HASH = HashingUtils::HashString("KY");
-        static const int KZ_HASH = HashingUtils::HashString("KZ");
-        static const int LA_HASH = HashingUtils::HashString("LA");
-        static const int LB_HASH = HashingUtils::HashString("LB");
-        static const int LC_HASH = HashingUtils::HashString("LC");
-        static const int LI_HASH = HashingUtils::HashString("LI");
-        static const int LK_HASH = HashingUtils::HashString("LK");
-        static const int LR_HASH = HashingUtils::HashString("LR");
-        static const int LS_HASH = HashingUtils::HashString("LS");
-        static const int LT_HASH = HashingUtils::HashString("LT");
-        static const int LU_HASH = HashingUtils::HashString("LU");
-        static const int LV_HASH = HashingUtils::HashString("LV");
-        static const int LY_HASH = HashingUtils::HashString("LY");
-        static const int MA_HASH = HashingUtils::HashString("MA");
-        static const int MC_HASH = HashingUtils::HashString("MC");
-        static const int MD_HASH = HashingUtils::HashString("MD");
-        static const int ME_HASH = HashingUtils::HashString("ME");
-        static const int MF_HASH = HashingUtils::HashString("MF");
-        static const int MG_HASH = HashingUtils::HashString("MG");
-        static const int MH_HASH = HashingUtils::HashString("MH");
-        static const int MK_HASH = HashingUtils::HashString("MK");
-        static const int ML_HASH = HashingUtils::HashString("ML");
-        static const int MM_HASH = HashingUtils::HashString("MM");
-        static const int MN_HASH = HashingUtils::HashString("MN");
-        static const int MO_HASH = HashingUtils::HashString("MO");
-        static const int MP_HASH = HashingUtils::HashString("MP");
-        static const int MR_HASH = HashingUtils::HashString("MR");
-        static const int MS_HASH = HashingUtils::HashString("MS");
-        static const int MT_HASH = HashingUtils::HashString("MT");
-        static const int MU_HASH = HashingUtils::HashString("MU");
-        static const int MV_HASH = HashingUtils::HashString("MV");
-        static const int MW_HASH = HashingUtils::HashString("MW");
-        static const int MX_HASH = HashingUtils::HashString("MX");
-        static const int MY_HASH = HashingUtils::HashString("MY");
-        static const int MZ_HASH = HashingUtils::HashString("MZ");
-        static const int NA_HASH = HashingUtils::HashString("NA");
-        static const int NC_HASH = HashingUtils::HashString("NC");
-        static const int NE_HASH = HashingUtils::HashString("NE");
-        static const int NG_HASH = HashingUtils::HashString("NG");
-        static const int NI_HASH = HashingUtils::HashString("NI");
-        static const int NL_HASH = HashingUtils::HashString("NL");
-        static const int NO_HASH = HashingUtils::HashString("NO");
-        static const int NP_HASH = HashingUtils::HashString("NP");
-        static const int NR_HASH = HashingUtils::HashString("NR");
-        static const int NU_HASH = HashingUtils::HashString("NU");
-        static const int NZ_HASH = HashingUtils::HashString("NZ");
-        static const int OM_HASH = HashingUtils::HashString("OM");
-        static const int PA_HASH = HashingUtils::HashString("PA");
-        static const int PE_HASH = HashingUtils::HashString("PE");
-        static const int PF_HASH = HashingUtils::HashString("PF");
-        static const int PG_HASH = HashingUtils::HashString("PG");
-        static const int PH_HASH = HashingUtils::HashString("PH");
-        static const int PK_HASH = HashingUtils::HashString("PK");
-        static const int PL_HASH = HashingUtils::HashString("PL");
-        static const int PM_HASH = HashingUtils::HashString("PM");
-        static const int PN_HASH = HashingUtils::HashString("PN");
-        static const int PR_HASH = HashingUtils::HashString("PR");
-        static const int PT_HASH = HashingUtils::HashString("PT");
-        static const int PW_HASH = HashingUtils::HashString("PW");
-        static const int PY_HASH = HashingUtils::HashString("PY");
-        static const int QA_HASH = HashingUtils::HashString("QA");
-        static const int RO_HASH = HashingUtils::HashString("RO");
-        static const int RS_HASH = HashingUtils::HashString("RS");
-        static const int RU_HASH = HashingUtils::HashString("RU");
-        static const int RW_HASH = HashingUtils::HashString("RW");
-        static const int SA_HASH = HashingUtils::HashString("SA");
-        static const int SB_HASH = HashingUtils::HashString("SB");
-        static const int SC_HASH = HashingUtils::HashString("SC");
-        static const int SD_HASH = HashingUtils::HashString("SD");
-        static const int SE_HASH = HashingUtils::HashString("SE");
-        static const int SG_HASH = HashingUtils::HashString("SG");
-        static const int SH_HASH = HashingUtils::HashString("SH");
-        static const int SI_HASH = HashingUtils::HashString("SI");
-        static const int SK_HASH = HashingUtils::HashString("SK");
-        static const int SL_HASH = HashingUtils::HashString("SL");
-        static const int SM_HASH = HashingUtils::HashString("SM");
-        static const int SN_HASH = HashingUtils::HashString("SN");
-        static const int SO_HASH = HashingUtils::HashString("SO");
-        static const int SR_HASH = HashingUtils::HashString("SR");
-        static const int ST_HASH = HashingUtils::HashString("ST");
-        static const int SV_HASH = HashingUtils::HashString("SV");
-        static const int SY_HASH = HashingUtils::HashString("SY");
-        static const int SZ_HASH = HashingUtils::HashString("SZ");
-        static const int TC_HASH = HashingUtils::HashString("TC");
-        static const int TD_HASH = HashingUtils::HashString("TD");
-        static const int TG_HASH = HashingUtils::HashString("TG");
-        static const int TH_HASH = HashingUtils::HashString("TH");
-        static const int TJ_HASH = HashingUtils::HashString("TJ");
-        static const int TK_HASH = HashingUtils::HashString("TK");
-        static const int TL_HASH = HashingUtils::HashString("TL");
-        static const int TM_HASH = HashingUtils::HashString("TM");
-        static const int TN_HASH = HashingUtils::HashString("TN");
-        static const int TO_HASH = HashingUtils::HashString("TO");
-        static const int TR_HASH = HashingUtils::HashString("TR");
-        static const int TT_HASH = HashingUtils::HashString("TT");
-        static const int TV_HASH = HashingUtils::HashString("TV");
-        static const int TW_HASH = HashingUtils::HashString("TW");
-        static const int TZ_HASH = HashingUtils::HashString("TZ");
-        static const int UA_HASH = HashingUtils::HashString("UA");
-        static const int UG_HASH = HashingUtils::HashString("UG");
-        static const int US_HASH = HashingUtils::HashString("US");
-        static const int UY_HASH = HashingUtils::HashString("UY");
-        static const int UZ_HASH = HashingUtils::HashString("UZ");
-        static const int VA_HASH = HashingUtils::HashString("VA");
-        static const int VC_HASH = HashingUtils::HashString("VC");
-        static const int VE_HASH = HashingUtils::HashString("VE");
-        static const int VG_HASH = HashingUtils::HashString("VG");
-        static const int VI_HASH = HashingUtils::HashString("VI");
-        static const int VN_HASH = HashingUtils::HashString("VN");
-        static const int VU_HASH = HashingUtils::HashString("VU");
-        static const int WF_HASH = HashingUtils::HashString("WF");
-        static const int WS_HASH = HashingUtils::HashString("WS");
-        static const int YE_HASH = HashingUtils::HashString("YE");
-        static const int YT_HASH = HashingUtils::HashString("YT");
-        static const int ZA_HASH = HashingUtils::HashString("ZA");
-        static const int ZM_HASH = HashingUtils::HashString("ZM");
-        static const int ZW_HASH = HashingUtils::HashString("ZW");
-
         /*
-        The if-else chains in this file are converted into a jump table by the compiler,
-        which allows constant time lookup. The chain has been broken into helper functions
-        because MSVC has a maximum of 122 chained if-else blocks.
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
         */
-        static bool GetEnumForNameHelper0(int hashCode, CountryCode& enumValue)
-        {
-          if (hashCode == AD_HASH)
-          {
-            enumValue = CountryCode::AD;
-            return true;
-          }
-          else if (hashCode == AE_HASH)
-          {
-            enumValue = CountryCode::AE;
-            return true;
-          }
-          else if (hashCode == AF_HASH)
-          {
-            enumValue = CountryCode::AF;
-            return true;
-          }
-          else if (hashCode == AG_HASH)
-          {
-            enumValue = CountryCode::AG;
-            return true;
-          }
-          else if (hashCode == AI_HASH)
-          {
-            enumValue = CountryCode::AI;
-            return true;
-          }
-          else if (hashCode == AL_HASH)
-          {
-            enumValue = CountryCode::AL;
-            return true;
-          }
-          else if (hashCode == AM_HASH)
-          {
-            enumValue = CountryCode::AM;
-            return true;
-          }
-          else if (hashCode == AN_HASH)
-          {
-            enumValue = CountryCode::AN;
-            return true;
-          }
-          else if (hashCode == AO_HASH)
-          {
-            enumValue = CountryCode::AO;
-            return true;
-          }
-          else if (hashCode == AQ_HASH)
-          {
-            enumValue = CountryCode::AQ;
-            return true;
-          }
-          else if (hashCode == AR_HASH)
-          {
-            enumValue = CountryCode::AR;
-            return true;
-          }
-          else if (hashCode == AS_HASH)
-          {
-            enumValue = CountryCode::AS;
-            return true;
-          }
-          else if (hashCode == AT_HASH)
-          {
-            enumValue = CountryCode::AT;
-            return true;
-          }
-          else if (hashCode == AU_HASH)
-          {
-            enumValue = CountryCode::AU;
-            return true;
-          }
-          else if (hashCode == AW_HASH)
-          {
-            enumValue = CountryCode::AW;
-            return true;
-          }
-          else if (hashCode == AZ_HASH)
-          {
-            enumValue = CountryCode::AZ;
-            return true;
-          }
-          else if (hashCode == BA_HASH)
-          {
-            enumValue = CountryCode::BA;
-            return true;
-          }
-          else if (hashCode == BB_HASH)
-          {
-            enumValue = CountryCode::BB;
-            return true;
-          }
-          else if (hashCode == BD_HASH)
-          {
-            enumValue = CountryCode::BD;
-            return true;
-          }
-          else if (hashCode == BE_HASH)
-          {
-            enumValue = CountryCode::BE;
-            return true;
-          }
-          else if (hashCode == BF_HASH)
-          {
-            enumValue = CountryCode::BF;
-            return true;
-          }
-          else if (hashCode == BG_HASH)
-          {
-            enumValue = CountryCode::BG;
-            return true;
-          }
-          else if (hashCode == BH_HASH)
-          {
-            enumValue = CountryCode::BH;
-            return true;
-          }
-          else if (hashCode == BI_HASH)
-          {
-            enumValue = CountryCode::BI;
-            return true;
-          }
-          else if (hashCode == BJ_HASH)
-          {
-            enumValue = CountryCode::BJ;
-            return true;
-          }
-          else if (hashCode == BL_HASH)
-          {
-            enumValue = CountryCode::BL;
-            return true;
-          }
-          else if (hashCode == BM_HASH)
-          {
-            enumValue = CountryCode::BM;
-            return true;
-          }
-          else if (hashCode == BN_HASH)
-          {
-            enumValue = CountryCode::BN;
-            return true;
-          }
-          else if (hashCode == BO_HASH)
-          {
-            enumValue = CountryCode::BO;
-            return true;
-          }
-          else if (hashCode == BR_HASH)
-          {
-            enumValue = CountryCode::BR;
-            return true;
-          }
-          else if (hashCode == BS_HASH)
-          {
-            enumValue = CountryCode::BS;
-            return true;
-          }
-          else if (hashCode == BT_HASH)
-          {
-            enumValue = CountryCode::BT;
-            return true;
-          }
-          else if (hashCode == BW_HASH)
-          {
-            enumValue = CountryCode::BW;
-            return true;
-          }
-          else if (hashCode == BY_HASH)
-          {
-            enumValue = CountryCode::BY;
-            return true;
-          }
-          else if (hashCode == BZ_HASH)
-          {
-            enumValue = CountryCode::BZ;
-            return true;
-          }
-          else if (hashCode == CA_HASH)
-          {
-            enumValue = CountryCode::CA;
-            return true;
-          }
-          else if (hashCode == CC_HASH)
-          {
-            enumValue = CountryCode::CC;
-            return true;
-          }
-          else if (hashCode == CD_HASH)
-          {
-            enumValue = CountryCode::CD;
-            return true;
-          }
-          else if (hashCode == CF_HASH)
-          {
-            enumValue = CountryCode::CF;
-            return true;
-          }
-          else if (hashCode == CG_HASH)
-          {
-            enumValue = CountryCode::CG;
-            return true;
-          }
-          else if (hashCode == CH_HASH)
-          {
-            enumValue = CountryCode::CH;
-            return true;
-          }
-          else if (hashCode == CI_HASH)
-          {
-            enumValue = CountryCode::CI;
-            return true;
-          }
-          else if (hashCode == CK_HASH)
-          {
-            enumValue = CountryCode::CK;
-            return true;
-          }
-          else if (hashCode == CL_HASH)
-          {
-            enumValue = CountryCode::CL;
-            return true;
-          }
-          else if (hashCode == CM_HASH)
-          {
-            enumValue = CountryCode::CM;
-            return true;
-          }
-          else if (hashCode == CN_HASH)
-          {
-            enumValue = CountryCode::CN;
-            return true;
-          }
-          else if (hashCode == CO_HASH)
-          {
-            enumValue = CountryCode::CO;
-            return true;
-          }
-          else if (hashCode == CR_HASH)
-          {
-            enumValue = CountryCode::CR;
-            return true;
-          }
-          else if (hashCode == CU_HASH)
-          {
-            enumValue = CountryCode::CU;
-            return true;
-          }
-          else if (hashCode == CV_HASH)
-          {
-            enumValue = CountryCode::CV;
-            return true;
-          }
-          else if (hashCode == CX_HASH)
-          {
-            enumValue = CountryCode::CX;
-            return true;
-          }
-          else if (hashCode == CY_HASH)
-          {
-            enumValue = CountryCode::CY;
-            return true;
-          }
-          else if (hashCode == CZ_HASH)
-          {
-            enumValue = CountryCode::CZ;
-            return true;
-          }
-          else if (hashCode == DE_HASH)
-          {
-            enumValue = CountryCode::DE;
-            return true;
-          }
-          else if (hashCode == DJ_HASH)
-          {
-            enumValue = CountryCode::DJ;
-            return true;
-          }
-          else if (hashCode == DK_HASH)
-          {
-            enumValue = CountryCode::DK;
-            return true;
-          }
-          else if (hashCode == DM_HASH)
-          {
-            enumValue = CountryCode::DM;
-            return true;
-          }
-          else if (hashCode == DO_HASH)
-          {
-            enumValue = CountryCode::DO;
-            return true;
-          }
-          else if (hashCode == DZ_HASH)
-          {
-            enumValue = CountryCode::DZ;
-            return true;
-          }
-          else if (hashCode == EC_HASH)
-          {
-            enumValue = CountryCode::EC;
-            return true;
-          }
-          else if (hashCode == EE_HASH)
-          {
-            enumValue = CountryCode::EE;
-            return true;
-          }
-          else if (hashCode == EG_HASH)
-          {
-            enumValue = CountryCode::EG;
-            return true;
-          }
-          else if (hashCode == ER_HASH)
-          {
-            enumValue = CountryCode::ER;
-            return true;
-          }
-          else if (hashCode == ES_HASH)
-          {
-            enumValue = CountryCode::ES;
-            return true;
-          }
-          else if (hashCode == ET_HASH)
-          {
-            enumValue = CountryCode::ET;
-            return true;
-          }
-          else if (hashCode == FI_HASH)
-          {
-            enumValue = CountryCode::FI;
-            return true;
-          }
-          else if (hashCode == FJ_HASH)
-          {
-            enumValue = CountryCode::FJ;
-            return true;
-          }
-          else if (hashCode == FK_HASH)
-          {
-            enumValue = CountryCode::FK;
-            return true;
-          }
-          else if (hashCode == FM_HASH)
-          {
-            enumValue = CountryCode::FM;
-            return true;
-          }
-          else if (hashCode == FO_HASH)
-          {
-            enumValue = CountryCode::FO;
-            return true;
-          }
-          else if (hashCode == FR_HASH)
-          {
-            enumValue = CountryCode::FR;
-            return true;
-          }
-          else if (hashCode == GA_HASH)
-          {
-            enumValue = CountryCode::GA;
-            return true;
-          }
-          else if (hashCode == GB_HASH)
-          {
-            enumValue = CountryCode::GB;
-            return true;
-          }
-          else if (hashCode == GD_HASH)
-          {
-            enumValue = CountryCode::GD;
-            return true;
-          }
-          else if (hashCode == GE_HASH)
-          {
-            enumValue = CountryCode::GE;
-            return true;
-          }
-          else if (hashCode == GH_HASH)
-          {
-            enumValue = CountryCode::GH;
-            return true;
-          }
-          else if (hashCode == GI_HASH)
-          {
-            enumValue = CountryCode::GI;
-            return true;
-          }
-          else if (hashCode == GL_HASH)
-          {
-            enumValue = CountryCode::GL;
-            return true;
-          }
-          else if (hashCode == GM_HASH)
-          {
-            enumValue = CountryCode::GM;
-            return true;
-          }
-          else if (hashCode == GN_HASH)
-          {
-            enumValue = CountryCode::GN;
-            return true;
-          }
-          else if (hashCode == GQ_HASH)
-          {
-            enumValue = CountryCode::GQ;
-            return true;
-          }
-          else if (hashCode == GR_HASH)
-          {
-            enumValue = CountryCode::GR;
-            return true;
-          }
-          else if (hashCode == GT_HASH)
-          {
-            enumValue = CountryCode::GT;
-            return true;
-          }
-          else if (hashCode == GU_HASH)
-          {
-            enumValue = CountryCode::GU;
-            return true;
-          }
-          else if (hashCode == GW_HASH)
-          {
-            enumValue = CountryCode::GW;
-            return true;
-          }
-          else if (hashCode == GY_HASH)
-          {
-            enumValue = CountryCode::GY;
-            return true;
-          }
-          else if (hashCode == HK_HASH)
-          {
-            enumValue = CountryCode::HK;
-            return true;
-          }
-          else if (hashCode == HN_HASH)
-          {
-            enumValue = CountryCode::HN;
-            return true;
-          }
-          else if (hashCode == HR_HASH)
-          {
-            enumValue = CountryCode::HR;
-            return true;
-          }
-          else if (hashCode == HT_HASH)
-          {
-            enumValue = CountryCode::HT;
-            return true;
-          }
-          else if (hashCode == HU_HASH)
-          {
-            enumValue = CountryCode::HU;
-            return true;
-          }
-          else if (hashCode == ID_HASH)
-          {
-            enumValue = CountryCode::ID;
-            return true;
-          }
-          else if (hashCode == IE_HASH)
-          {
-            enumValue = CountryCode::IE;
-            return true;
-          }
-          else if (hashCode == IL_HASH)
-          {
-            enumValue = CountryCode::IL;
-            return true;
-          }
-          else if (hashCode == IM_HASH)
-          {
-            enumValue = CountryCode::IM;
-            return true;
-          }
-          else if (hashCode == IN_HASH)
-          {
-            enumValue = CountryCode::IN;
-            return true;
-          }
-          else if (hashCode == IQ_HASH)
-          {
-            enumValue = CountryCode::IQ;
-            return true;
-          }
-          else if (hashCode == IR_HASH)
-          {
-            enumValue = CountryCode::IR;
-            return true;
-          }
-          else if (hashCode == IS_HASH)
-          {
-            enumValue = CountryCode::IS;
-            return true;
-          }
-          else if (hashCode == IT_HASH)
-          {
-            enumValue = CountryCode::IT;
-            return true;
-          }
-          else if (hashCode == JM_HASH)
-          {
-            enumValue = CountryCode::JM;
-            return true;
-          }
-          else if (hashCode == JO_HASH)
-          {
-            enumValue = CountryCode::JO;
-            return true;
-          }
-          else if (hashCode == JP_HASH)
-          {
-            enumValue = CountryCode::JP;
-            return true;
-          }
-          else if (hashCode == KE_HASH)
-          {
-            enumValue = CountryCode::KE;
-            return true;
-          }
-          else if (hashCode == KG_HASH)
-          {
-            enumValue = CountryCode::KG;
-            return true;
-          }
-          else if (hashCode == KH_HASH)
-          {
-            enumValue = CountryCode::KH;
-            return true;
-          }
-          else if (hashCode == KI_HASH)
-          {
-            enumValue = CountryCode::KI;
-            return true;
-          }
-          else if (hashCode == KM_HASH)
-          {
-            enumValue = CountryCode::KM;
-            return true;
-          }
-          else if (hashCode == KN_HASH)
-          {
-            enumValue = CountryCode::KN;
-            return true;
-          }
-          else if (hashCode == KP_HASH)
-          {
-            enumValue = CountryCode::KP;
-            return true;
-          }
-          else if (hashCode == KR_HASH)
-          {
-            enumValue = CountryCode::KR;
-            return true;
-          }
-          else if (hashCode == KW_HASH)
-          {
-            enumValue = CountryCode::KW;
-            return true;
-          }
-          else if (hashCode == KY_HASH)
-          {
-            enumValue = CountryCode::KY;
-            return true;
-          }
-          else if (hashCode == KZ_HASH)
-          {
-            enumValue = CountryCode::KZ;
-            return true;
-          }
-          else if (hashCode == LA_HASH)
-          {
-            enumValue = CountryCode::LA;
-            return true;
-          }
-          else if (hashCode == LB_HASH)
-          {
-            enumValue = CountryCode::LB;
-            return true;
-          }
-          else if (hashCode == LC_HASH)
-          {
-            enumValue = CountryCode::LC;
-            return true;
-          }
-          else if (hashCode == LI_HASH)
-          {
-            enumValue = CountryCode::LI;
-            return true;
-          }
-          else if (hashCode == LK_HASH)
-          {
-            enumValue = CountryCode::LK;
-            return true;
-          }
-          else if (hashCode == LR_HASH)
-          {
-            enumValue = CountryCode::LR;
-            return true;
-          }
-          else if (hashCode == LS_HASH)
-          {
-            enumValue = CountryCode::LS;
-            return true;
-          }
-          else if (hashCode == LT_HASH)
-          {
-            enumValue = CountryCode::LT;
-            return true;
-          }
-          return false;
-        }
-        static bool GetEnumForNameHelper1(int hashCode, CountryCode& enumValue)
+        static const int AD_HASH = 2083;
+        static const int AE_HASH = 2084;
+        static const int AF_HASH = 2085;
+        static const int AG_HASH = 2086;
+        static const int AI_HASH = 2088;
+        static const int AL_HASH = 2091;
+        static const int AM_HASH = 2092;
+        static const int AN_HASH = 2093;
+        static const int AO_HASH = 2094;
+        static const int AQ_HASH = 2096;
+        static const int AR_HASH = 2097;
+        static const int AS_HASH = 2098;
+        static const int AT_HASH = 2099;
+        static const int AU_HASH = 2100;
+        static const int AW_HASH = 2102;
+        static const int AZ_HASH = 2105;
+        static const int BA_HASH = 2111;
+        static const int BB_HASH = 2112;
+        static const int BD_HASH = 2114;
+        static const int BE_HASH = 2115;
+        static const int BF_HASH = 2116;
+        static const int BG_HASH = 2117;
+        static const int BH_HASH = 2118;
+        static const int BI_HASH = 2119;
+        static const int BJ_HASH = 2120;
+        static const int BL_HASH = 2122;
+        static const int BM_HASH = 2123;
+        static const int BN_HASH = 2124;
+        static const int BO_HASH = 2125;
+        static const int BR_HASH = 2128;
+        static const int BS_HASH = 2129;
+        static const int BT_HASH = 2130;
+        static const int BW_HASH = 2133;
+        static const int BY_HASH = 2135;
+        static const int BZ_HASH = 2136;
+        static const int CA_HASH = 2142;
+        static const int CC_HASH = 2144;
+        static const int CD_HASH = 2145;
+        static const int CF_HASH = 2147;
+        static const int CG_HASH = 2148;
+        static const int CH_HASH = 2149;
+        static const int CI_HASH = 2150;
+        static const int CK_HASH = 2152;
+        static const int CL_HASH = 2153;
+        static const int CM_HASH = 2154;
+        static const int CN_HASH = 2155;
+        static const int CO_HASH = 2156;
+        static const int CR_HASH = 2159;
+        static const int CU_HASH = 2162;
+        static const int CV_HASH = 2163;
+        static const int CX_HASH = 2165;
+        static const int CY_HASH = 2166;
+        static const int CZ_HASH = 2167;
+        static const int DE_HASH = 2177;
+        static const int DJ_HASH = 2182;
+        static const int DK_HASH = 2183;
+        static const int DM_HASH = 2185;
+        static const int DO_HASH = 2187;
+        static const int DZ_HASH = 2198;
+        static const int EC_HASH = 2206;
+        static const int EE_HASH = 2208;
+        static const int EG_HASH = 2210;
+        static const int ER_HASH = 2221;
+        static const int ES_HASH = 2222;
+        static const int ET_HASH = 2223;
+        static const int FI_HASH = 2243;
+        static const int FJ_HASH = 2244;
+        static const int FK_HASH = 2245;
+        static const int FM_HASH = 2247;
+        static const int FO_HASH = 2249;
+        static const int FR_HASH = 2252;
+        static const int GA_HASH = 2266;
+        static const int GB_HASH = 2267;
+        static const int GD_HASH = 2269;
+        static const int GE_HASH = 2270;
+        static const int GH_HASH = 2273;
+        static const int GI_HASH = 2274;
+        static const int GL_HASH = 2277;
+        static const int GM_HASH = 2278;
+        static const int GN_HASH = 2279;
+        static const int GQ_HASH = 2282;
+        static const int GR_HASH = 2283;
+        static const int GT_HASH = 2285;
+        static const int GU_HASH = 2286;
+        static const int GW_HASH = 2288;
+        static const int GY_HASH = 2290;
+        static const int HK_HASH = 2307;
+        static const int HN_HASH = 2310;
+        static const int HR_HASH = 2314;
+        static const int HT_HASH = 2316;
+        static const int HU_HASH = 2317;
+        static const int ID_HASH = 2331;
+        static const int IE_HASH = 2332;
+        static const int IL_HASH = 2339;
+        static const int IM_HASH = 2340;
+        static const int IN_HASH = 2341;
+        static const int IQ_HASH = 2344;
+        static const int IR_HASH = 2345;
+        static const int IS_HASH = 2346;
+        static const int IT_HASH = 2347;
+        static const int JM_HASH = 2371;
+        static const int JO_HASH = 2373;
+        static const int JP_HASH = 2374;
+        static const int KE_HASH = 2394;
+        static const int KG_HASH = 2396;
+        static const int KH_HASH = 2397;
+        static const int KI_HASH = 2398;
+        static const int KM_HASH = 2402;
+        static const int KN_HASH = 2403;
+        static const int KP_HASH = 2405;
+        static const int KR_HASH = 2407;
+        static const int KW_HASH = 2412;
+        static const int KY_HASH = 2414;
+        static const int KZ_HASH = 2415;
+        static const int LA_HASH = 2421;
+        static const int LB_HASH = 2422;
+        static const int LC_HASH = 2423;
+        static const int LI_HASH = 2429;
+        static const int LK_HASH = 2431;
+        static const int LR_HASH = 2438;
+        static const int LS_HASH = 2439;
+        static const int LT_HASH = 2440;
+        static const int LU_HASH = 2441;
+        static const int LV_HASH = 2442;
+        static const int LY_HASH = 2445;
+        static const int MA_HASH = 2452;
+        static const int MC_HASH = 2454;
+        static const int MD_HASH = 2455;
+        static const int ME_HASH = 2456;
+        static const int MF_HASH = 2457;
+        static const int MG_HASH = 2458;
+        static const int MH_HASH = 2459;
+        static const int MK_HASH = 2462;
+        static const int ML_HASH = 2463;
+        static const int MM_HASH = 2464;
+        static const int MN_HASH = 2465;
+        static const int MO_HASH = 2466;
+        static const int MP_HASH = 2467;
+        static const int MR_HASH = 2469;
+        static const int MS_HASH = 2470;
+        static const int MT_HASH = 2471;
+        static const int MU_HASH = 2472;
+        static const int MV_HASH = 2473;
+        static const int MW_HASH = 2474;
+        static const int MX_HASH = 2475;
+        static const int MY_HASH = 2476;
+        static const int MZ_HASH = 2477;
+        static const int NA_HASH = 2483;
+        static const int NC_HASH = 2485;
+        static const int NE_HASH = 2487;
+        static const int NG_HASH = 2489;
+        static const int NI_HASH = 2491;
+        static const int NL_HASH = 2494;
+        static const int NO_HASH = 2497;
+        static const int NP_HASH = 2498;
+        static const int NR_HASH = 2500;
+        static const int NU_HASH = 2503;
+        static const int NZ_HASH = 2508;
+        static const int OM_HASH = 2526;
+        static const int PA_HASH = 2545;
+        static const int PE_HASH = 2549;
+        static const int PF_HASH = 2550;
+        static const int PG_HASH = 2551;
+        static const int PH_HASH = 2552;
+        static const int PK_HASH = 2555;
+        static const int PL_HASH = 2556;
+        static const int PM_HASH = 2557;
+        static const int PN_HASH = 2558;
+        static const int PR_HASH = 2562;
+        static const int PT_HASH = 2564;
+        static const int PW_HASH = 2567;
+        static const int PY_HASH = 2569;
+        static const int QA_HASH = 2576;
+        static const int RO_HASH = 2621;
+        static const int RS_HASH = 2625;
+        static const int RU_HASH = 2627;
+        static const int RW_HASH = 2629;
+        static const int SA_HASH = 2638;
+        static const int SB_HASH = 2639;
+        static const int SC_HASH = 2640;
+        static const int SD_HASH = 2641;
+        static const int SE_HASH = 2642;
+        static const int SG_HASH = 2644;
+        static const int SH_HASH = 2645;
+        static const int SI_HASH = 2646;
+        static const int SK_HASH = 2648;
+        static const int SL_HASH = 2649;
+        static const int SM_HASH = 2650;
+        static const int SN_HASH = 2651;
+        static const int SO_HASH = 2652;
+        static const int SR_HASH = 2655;
+        static const int ST_HASH = 2657;
+        static const int SV_HASH = 2659;
+        static const int SY_HASH = 2662;
+        static const int SZ_HASH = 2663;
+        static const int TC_HASH = 2671;
+        static const int TD_HASH = 2672;
+        static const int TG_HASH = 2675;
+        static const int TH_HASH = 2676;
+        static const int TJ_HASH = 2678;
+        static const int TK_HASH = 2679;
+        static const int TL_HASH = 2680;
+        static const int TM_HASH = 2681;
+        static const int TN_HASH = 2682;
+        static const int TO_HASH = 2683;
+        static const int TR_HASH = 2686;
+        static const int TT_HASH = 2688;
+        static const int TV_HASH = 2690;
+        static const int TW_HASH = 2691;
+        static const int TZ_HASH = 2694;
+        static const int UA_HASH = 2700;
+        static const int UG_HASH = 2706;
+        static const int US_HASH = 2718;
+        static const int UY_HASH = 2724;
+        static const int UZ_HASH = 2725;
+        static const int VA_HASH = 2731;
+        static const int VC_HASH = 2733;
+        static const int VE_HASH = 2735;
+        static const int VG_HASH = 2737;
+        static const int VI_HASH = 2739;
+        static const int VN_HASH = 2744;
+        static const int VU_HASH = 2751;
+        static const int WF_HASH = 2767;
+        static const int WS_HASH = 2780;
+        static const int YE_HASH = 2828;
+        static const int YT_HASH = 2843;
+        static const int ZA_HASH = 2855;
+        static const int ZM_HASH = 2867;
+        static const int ZW_HASH = 2877;
+
+
+        CountryCode GetCountryCodeForName(const Aws::String& name)
         {
-          if (hashCode == LU_HASH)
-          {
-            enumValue = CountryCode::LU;
-            return true;
-          }
-          else if (hashCode == LV_HASH)
-          {
-            enumValue = CountryCode::LV;
-            return true;
-          }
-          else if (hashCode == LY_HASH)
-          {
-            enumValue = CountryCode::LY;
-            return true;
-          }
-          else if (hashCode == MA_HASH)
-          {
-            enumValue = CountryCode::MA;
-            return true;
-          }
-          else if (hashCode == MC_HASH)
-          {
-            enumValue = CountryCode::MC;
-            return true;
-          }
-          else if (hashCode == MD_HASH)
-          {
-            enumValue = CountryCode::MD;
-            return true;
-          }
-          else if (hashCode == ME_HASH)
-          {
-            enumValue = CountryCode::ME;
-            return true;
-          }
-          else if (hashCode == MF_HASH)
-          {
-            enumValue = CountryCode::MF;
-            return true;
-          }
-          else if (hashCode == MG_HASH)
-          {
-            enumValue = CountryCode::MG;
-            return true;
-          }
-          else if (hashCode == MH_HASH)
-          {
-            enumValue = CountryCode::MH;
-            return true;
-          }
-          else if (hashCode == MK_HASH)
-          {
-            enumValue = CountryCode::MK;
-            return true;
-          }
-          else if (hashCode == ML_HASH)
-          {
-            enumValue = CountryCode::ML;
-            return true;
-          }
-          else if (hashCode == MM_HASH)
-          {
-            enumValue = CountryCode::MM;
-            return true;
-          }
-          else if (hashCode == MN_HASH)
-          {
-            enumValue = CountryCode::MN;
-            return true;
-          }
-          else if (hashCode == MO_HASH)
-          {
-            enumValue = CountryCode::MO;
-            return true;
-          }
-          else if (hashCode == MP_HASH)
-          {
-            enumValue = CountryCode::MP;
-            return true;
-          }
-          else if (hashCode == MR_HASH)
-          {
-            enumValue = CountryCode::MR;
-            return true;
-          }
-          else if (hashCode == MS_HASH)
-          {
-            enumValue = CountryCode::MS;
-            return true;
-          }
-          else if (hashCode == MT_HASH)
-          {
-            enumValue = CountryCode::MT;
-            return true;
-          }
-          else if (hashCode == MU_HASH)
-          {
-            enumValue = CountryCode::MU;
-            return true;
-          }
-          else if (hashCode == MV_HASH)
-          {
-            enumValue = CountryCode::MV;
-            return true;
-          }
-          else if (hashCode == MW_HASH)
-          {
-            enumValue = CountryCode::MW;
-            return true;
-          }
-          else if (hashCode == MX_HASH)
-          {
-            enumValue = CountryCode::MX;
-            return true;
-          }
-          else if (hashCode == MY_HASH)
-          {
-            enumValue = CountryCode::MY;
-            return true;
-          }
-          else if (hashCode == MZ_HASH)
-          {
-            enumValue = CountryCode::MZ;
-            return true;
-          }
-          else if (hashCode == NA_HASH)
-          {
-            enumValue = CountryCode::NA;
-            return true;
-          }
-          else if (hashCode == NC_HASH)
-          {
-            enumValue = CountryCode::NC;
-            return true;
-          }
-          else if (hashCode == NE_HASH)
-          {
-            enumValue = CountryCode::NE;
-            return true;
-          }
-          else if (hashCode == NG_HASH)
-          {
-            enumValue = CountryCode::NG;
-            return true;
-          }
-          else if (hashCode == NI_HASH)
-          {
-            enumValue = CountryCode::NI;
-            return true;
-          }
-          else if (hashCode == NL_HASH)
-          {
-            enumValue = CountryCode::NL;
-            return true;
-          }
-          else if (hashCode == NO_HASH)
-          {
-            enumValue = CountryCode::NO;
-            return true;
-          }
-          else if (hashCode == NP_HASH)
-          {
-            enumValue = CountryCode::NP;
-            return true;
-          }
-          else if (hashCode == NR_HASH)
-          {
-            enumValue = CountryCode::NR;
-            return true;
-          }
-          else if (hashCode == NU_HASH)
-          {
-            enumValue = CountryCode::NU;
-            return true;
-          }
-          else if (hashCode == NZ_HASH)
-          {
-            enumValue = CountryCode::NZ;
-            return true;
-          }
-          else if (hashCode == OM_HASH)
-          {
-            enumValue = CountryCode::OM;
-            return true;
-          }
-          else if (hashCode == PA_HASH)
-          {
-            enumValue = CountryCode::PA;
-            return true;
-          }
-          else if (hashCode == PE_HASH)
-          {
-            enumValue = CountryCode::PE;
-            return true;
-          }
-          else if (hashCode == PF_HASH)
-          {
-            enumValue = CountryCode::PF;
-            return true;
-          }
-          else if (hashCode == PG_HASH)
-          {
-            enumValue = CountryCode::PG;
-            return true;
-          }
-          else if (hashCode == PH_HASH)
-          {
-            enumValue = CountryCode::PH;
-            return true;
-          }
-          else if (hashCode == PK_HASH)
-          {
-            enumValue = CountryCode::PK;
-            return true;
-          }
-          else if (hashCode == PL_HASH)
-          {
-            enumValue = CountryCode::PL;
-            return true;
-          }
-          else if (hashCode == PM_HASH)
-          {
-            enumValue = CountryCode::PM;
-            return true;
-          }
-          else if (hashCode == PN_HASH)
-          {
-            enumValue = CountryCode::PN;
-            return true;
-          }
-          else if (hashCode == PR_HASH)
-          {
-            enumValue = CountryCode::PR;
-            return true;
-          }
-          else if (hashCode == PT_HASH)
-          {
-            enumValue = CountryCode::PT;
-            return true;
-          }
-          else if (hashCode == PW_HASH)
-          {
-            enumValue = CountryCode::PW;
-            return true;
-          }
-          else if (hashCode == PY_HASH)
-          {
-            enumValue = CountryCode::PY;
-            return true;
-          }
-          else if (hashCode == QA_HASH)
-          {
-            enumValue = CountryCode::QA;
-            return true;
-          }
-          else if (hashCode == RO_HASH)
-          {
-            enumValue = CountryCode::RO;
-            return true;
-          }
-          else if (hashCode == RS_HASH)
-          {
-            enumValue = CountryCode::RS;
-            return true;
-          }
-          else if (hashCode == RU_HASH)
-          {
-            enumValue = CountryCode::RU;
-            return true;
-          }
-          else if (hashCode == RW_HASH)
-          {
-            enumValue = CountryCode::RW;
-            return true;
-          }
-          else if (hashCode == SA_HASH)
-          {
-            enumValue = CountryCode::SA;
-            return true;
-          }
-          else if (hashCode == SB_HASH)
-          {
-            enumValue = CountryCode::SB;
-            return true;
-          }
-          else if (hashCode == SC_HASH)
-          {
-            enumValue = CountryCode::SC;
-            return true;
-          }
-          else if (hashCode == SD_HASH)
-          {
-            enumValue = CountryCode::SD;
-            return true;
-          }
-          else if (hashCode == SE_HASH)
-          {
-            enumValue = CountryCode::SE;
-            return true;
-          }
-          else if (hashCode == SG_HASH)
-          {
-            enumValue = CountryCode::SG;
-            return true;
-          }
-          else if (hashCode == SH_HASH)
-          {
-            enumValue = CountryCode::SH;
-            return true;
-          }
-          else if (hashCode == SI_HASH)
-          {
-            enumValue = CountryCode::SI;
-            return true;
-          }
-          else if (hashCode == SK_HASH)
-          {
-            enumValue = CountryCode::SK;
-            return true;
-          }
-          else if (hashCode == SL_HASH)
-          {
-            enumValue = CountryCode::SL;
-            return true;
-          }
-          else if (hashCode == SM_HASH)
-          {
-            enumValue = CountryCode::SM;
-            return true;
-          }
-          else if (hashCode == SN_HASH)
-          {
-            enumValue = CountryCode::SN;
-            return true;
-          }
-          else if (hashCode == SO_HASH)
-          {
-            enumValue = CountryCode::SO;
-            return true;
-          }
-          else if (hashCode == SR_HASH)
-          {
-            enumValue = CountryCode::SR;
-            return true;
-          }
-          else if (hashCode == ST_HASH)
-          {
-            enumValue = CountryCode::ST;
-            return true;
-          }
-          else if (hashCode == SV_HASH)
-          {
-            enumValue = CountryCode::SV;
-            return true;
-          }
-          else if (hashCode == SY_HASH)
-          {
-            enumValue = CountryCode::SY;
-            return true;
-          }
-          else if (hashCode == SZ_HASH)
-          {
-            enumValue = CountryCode::SZ;
-            return true;
-          }
-          else if (hashCode == TC_HASH)
-          {
-            enumValue = CountryCode::TC;
-            return true;
-          }
-          else if (hashCode == TD_HASH)
-          {
-            enumValue = CountryCode::TD;
-            return true;
-          }
-          else if (hashCode == TG_HASH)
-          {
-            enumValue = CountryCode::TG;
-            return true;
-          }
-          else if (hashCode == TH_HASH)
-          {
-            enumValue = CountryCode::TH;
-            return true;
-          }
-          else if (hashCode == TJ_HASH)
-          {
-            enumValue = CountryCode::TJ;
-            return true;
-          }
-          else if (hashCode == TK_HASH)
-          {
-            enumValue = CountryCode::TK;
-            return true;
-          }
-          else if (hashCode == TL_HASH)
-          {
-            enumValue = CountryCode::TL;
-            return true;
-          }
-          else if (hashCode == TM_HASH)
-          {
-            enumValue = CountryCode::TM;
-            return true;
-          }
-          else if (hashCode == TN_HASH)
-          {
-            enumValue = CountryCode::TN;
-            return true;
-          }
-          else if (hashCode == TO_HASH)
-          {
-            enumValue = CountryCode::TO;
-            return true;
-          }
-          else if (hashCode == TR_HASH)
-          {
-            enumValue = CountryCode::TR;
-            return true;
-          }
-          else if (hashCode == TT_HASH)
-          {
-            enumValue = CountryCode::TT;
-            return true;
-          }
-          else if (hashCode == TV_HASH)
-          {
-            enumValue = CountryCode::TV;
-            return true;
-          }
-          else if (hashCode == TW_HASH)
-          {
-            enumValue = CountryCode::TW;
-            return true;
-          }
-          else if (hashCode == TZ_HASH)
-          {
-            enumValue = CountryCode::TZ;
-            return true;
-          }
-          else if (hashCode == UA_HASH)
-          {
-            enumValue = CountryCode::UA;
-            return true;
-          }
-          else if (hashCode == UG_HASH)
-          {
-            enumValue = CountryCode::UG;
-            return true;
-          }
-          else if (hashCode == US_HASH)
-          {
-            enumValue = CountryCode::US;
-            return true;
-          }
-          else if (hashCode == UY_HASH)
-          {
-            enumValue = CountryCode::UY;
-            return true;
-          }
-          else if (hashCode == UZ_HASH)
-          {
-            enumValue = CountryCode::UZ;
-            return true;
-          }
-          else if (hashCode == VA_HASH)
-          {
-            enumValue = CountryCode::VA;
-            return true;
-          }
-          else if (hashCode == VC_HASH)
-          {
-            enumValue = CountryCode::VC;
-            return true;
-          }
-          else if (hashCode == VE_HASH)
-          {
-            enumValue = CountryCode::VE;
-            return true;
-          }
-          else if (hashCode == VG_HASH)
-          {
-            enumValue = CountryCode::VG;
-            return true;
-          }
-          else if (hashCode == VI_HASH)
-          {
-            enumValue = CountryCode::VI;
-            return true;
-          }
-          else if (hashCode == VN_HASH)
-          {
-            enumValue = CountryCode::VN;
-            return true;
-          }
-          else if (hashCode == VU_HASH)
-          {
-            enumValue = CountryCode::VU;
-            return true;
-          }
-          else if (hashCode == WF_HASH)
-          {
-            enumValue = CountryCode::WF;
-            return true;
-          }
-          else if (hashCode == WS_HASH)
-          {
-            enumValue = CountryCode::WS;
-            return true;
-          }
-          else if (hashCode == YE_HASH)
-          {
-            enumValue = CountryCode::YE;
-            return true;
-          }
-          else if (hashCode == YT_HASH)
-          {
-            enumValue = CountryCode::YT;
-            return true;
-          }
-          else if (hashCode == ZA_HASH)
-          {
-            enumValue = CountryCode::ZA;
-            return true;
-          }
-          else if (hashCode == ZM_HASH)
-          {
-            enumValue = CountryCode::ZM;
-            return true;
+          int hashCode = HashingUtils::HashString(name.c_str());
+          switch (hashCode)
+          {
+          case AD_HASH:
+            return CountryCode::AD;
+          case AE_HASH:
+            return CountryCode::AE;
+          case AF_HASH:
+            return CountryCode::AF;
+          case AG_HASH:
+            return CountryCode::AG;
+          case AI_HASH:
+            return CountryCode::AI;
+          case AL_HASH:
+            return CountryCode::AL;
+          case AM_HASH:
+            return CountryCode::AM;
+          case AN_HASH:
+            return CountryCode::AN;
+          case AO_HASH:
+            return CountryCode::AO;
+          case AQ_HASH:
+            return CountryCode::AQ;
+          case AR_HASH:
+            return CountryCode::AR;
+          case AS_HASH:
+            return CountryCode::AS;
+          case AT_HASH:
+            return CountryCode::AT;
+          case AU_HASH:
+            return CountryCode::AU;
+          case AW_HASH:
+            return CountryCode::AW;
+          case AZ_HASH:
+            return CountryCode::AZ;
+          case BA_HASH:
+            return CountryCode::BA;
+          case BB_HASH:
+            return CountryCode::BB;
+          case BD_HASH:
+            return CountryCode::BD;
+          case BE_HASH:
+            return CountryCode::BE;
+          case BF_HASH:
+            return CountryCode::BF;
+          case BG_HASH:
+            return CountryCode::BG;
+          case BH_HASH:
+            return CountryCode::BH;
+          case BI_HASH:
+            return CountryCode::BI;
+          case BJ_HASH:
+            return CountryCode::BJ;
+          case BL_HASH:
+            return CountryCode::BL;
+          case BM_HASH:
+            return CountryCode::BM;
+          case BN_HASH:
+            return CountryCode::BN;
+          case BO_HASH:
+            return CountryCode::BO;
+          case BR_HASH:
+            return CountryCode::BR;
+          case BS_HASH:
+            return CountryCode::BS;
+          case BT_HASH:
+            return CountryCode::BT;
+          case BW_HASH:
+            return CountryCode::BW;
+          case BY_HASH:
+            return CountryCode::BY;
+          case BZ_HASH:
+            return CountryCode::BZ;
+          case CA_HASH:
+            return CountryCode::CA;
+          case CC_HASH:
+            return CountryCode::CC;
+          case CD_HASH:
+            return CountryCode::CD;
+          case CF_HASH:
+            return CountryCode::CF;
+          case CG_HASH:
+            return CountryCode::CG;
+          case CH_HASH:
+            return CountryCode::CH;
+          case CI_HASH:
+            return CountryCode::CI;
+          case CK_HASH:
+            return CountryCode::CK;
+          case CL_HASH:
+            return CountryCode::CL;
+          case CM_HASH:
+            return CountryCode::CM;
+          case CN_HASH:
+            return CountryCode::CN;
+          case CO_HASH:
+            return CountryCode::CO;
+          case CR_HASH:
+            return CountryCode::CR;
+          case CU_HASH:
+            return CountryCode::CU;
+          case CV_HASH:
+            return CountryCode::CV;
+          case CX_HASH:
+            return CountryCode::CX;
+          case CY_HASH:
+            return CountryCode::CY;
+          case CZ_HASH:
+            return CountryCode::CZ;
+          case DE_HASH:
+            return CountryCode::DE;
+          case DJ_HASH:
+            return CountryCode::DJ;
+          case DK_HASH:
+            return CountryCode::DK;
+          case DM_HASH:
+            return CountryCode::DM;
+          case DO_HASH:
+            return CountryCode::DO;
+          case DZ_HASH:
+            return CountryCode::DZ;
+          case EC_HASH:
+            return CountryCode::EC;
+          case EE_HASH:
+            return CountryCode::EE;
+          case EG_HASH:
+            return CountryCode::EG;
+          case ER_HASH:
+            return CountryCode::ER;
+          case ES_HASH:
+            return CountryCode::ES;
+          case ET_HASH:
+            return CountryCode::ET;
+          case FI_HASH:
+            return CountryCode::FI;
+          case FJ_HASH:
+            return CountryCode::FJ;
+          case FK_HASH:
+            return CountryCode::FK;
+          case FM_HASH:
+            return CountryCode::FM;
+          case FO_HASH:
+            return CountryCode::FO;
+          case FR_HASH:
+            return CountryCode::FR;
+          case GA_HASH:
+            return CountryCode::GA;
+          case GB_HASH:
+            return CountryCode::GB;
+          case GD_HASH:
+            return CountryCode::GD;
+          case GE_HASH:
+            return CountryCode::GE;
+          case GH_HASH:
+            return CountryCode::GH;
+          case GI_HASH:
+            return CountryCode::GI;
+          case GL_HASH:
+            return CountryCode::GL;
+          case GM_HASH:
+            return CountryCode::GM;
+          case GN_HASH:
+            return CountryCode::GN;
+          case GQ_HASH:
+            return CountryCode::GQ;
+          case GR_HASH:
+            return CountryCode::GR;
+          case GT_HASH:
+            return CountryCode::GT;
+          case GU_HASH:
+            return CountryCode::GU;
+          case GW_HASH:
+            return CountryCode::GW;
+          case GY_HASH:
+            return CountryCode::GY;
+          case HK_HASH:
+            return CountryCode::HK;
+          case HN_HASH:
+            return CountryCode::HN;
+          case HR_HASH:
+            return CountryCode::HR;
+          case HT_HASH:
+            return CountryCode::HT;
+          case HU_HASH:
+            return CountryCode::HU;
+          case ID_HASH:
+            return CountryCode::ID;
+          case IE_HASH:
+            return CountryCode::IE;
+          case IL_HASH:
+            return CountryCode::IL;
+          case IM_HASH:
+            return CountryCode::IM;
+          case IN_HASH:
+            return CountryCode::IN;
+          case IQ_HASH:
+            return CountryCode::IQ;
+          case IR_HASH:
+            return CountryCode::IR;
+          case IS_HASH:
+            return CountryCode::IS;
+          case IT_HASH:
+            return CountryCode::IT;
+          case JM_HASH:
+            return CountryCode::JM;
+          case JO_HASH:
+            return CountryCode::JO;
+          case JP_HASH:
+            return CountryCode::JP;
+          case KE_HASH:
+            return CountryCode::KE;
+          case KG_HASH:
+            return CountryCode::KG;
+          case KH_HASH:
+            return CountryCode::KH;
+          case KI_HASH:
+            return CountryCode::KI;
+          case KM_HASH:
+            return CountryCode::KM;
+          case KN_HASH:
+            return CountryCode::KN;
+          case KP_HASH:
+            return CountryCode::KP;
+          case KR_HASH:
+            return CountryCode::KR;
+          case KW_HASH:
+            return CountryCode::KW;
+          case KY_HASH:
+            return CountryCode::KY;
+          case KZ_HASH:
+            return CountryCode::KZ;
+          case LA_HASH:
+            return CountryCode::LA;
+          case LB_HASH:
+            return CountryCode::LB;
+          case LC_HASH:
+            return CountryCode::LC;
+          case LI_HASH:
+            return CountryCode::LI;
+          case LK_HASH:
+            return CountryCode::LK;
+          case LR_HASH:
+            return CountryCode::LR;
+          case LS_HASH:
+            return CountryCode::LS;
+          case LT_HASH:
+            return CountryCode::LT;
+          case LU_HASH:
+            return CountryCode::LU;
+          case LV_HASH:
+            return CountryCode::LV;
+          case LY_HASH:
+            return CountryCode::LY;
+          case MA_HASH:
+            return CountryCode::MA;
+          case MC_HASH:
+            return CountryCode::MC;
+          case MD_HASH:
+            return CountryCode::MD;
+          case ME_HASH:
+            return CountryCode::ME;
+          case MF_HASH:
+            return CountryCode::MF;
+          case MG_HASH:
+            return CountryCode::MG;
+          case MH_HASH:
+            return CountryCode::MH;
+          case MK_HASH:
+            return CountryCode::MK;
+          case ML_HASH:
+            return CountryCode::ML;
+          case MM_HASH:
+            return CountryCode::MM;
+          case MN_HASH:
+            return CountryCode::MN;
+          case MO_HASH:
+            return CountryCode::MO;
+          case MP_HASH:
+            return CountryCode::MP;
+          case MR_HASH:
+            return CountryCode::MR;
+          case MS_HASH:
+            return CountryCode::MS;
+          case MT_HASH:
+            return CountryCode::MT;
+          case MU_HASH:
+            return CountryCode::MU;
+          case MV_HASH:
+            return CountryCode::MV;
+          case MW_HASH:
+            return CountryCode::MW;
+          case MX_HASH:
+            return CountryCode::MX;
+          case MY_HASH:
+            return CountryCode::MY;
+          case MZ_HASH:
+            return CountryCode::MZ;
+          case NA_HASH:
+            return CountryCode::NA;
+          case NC_HASH:
+            return CountryCode::NC;
+          case NE_HASH:
+            return CountryCode::NE;
+          case NG_HASH:
+            return CountryCode::NG;
+          case NI_HASH:
+            return CountryCode::NI;
+          case NL_HASH:
+            return CountryCode::NL;
+          case NO_HASH:
+            return CountryCode::NO;
+          case NP_HASH:
+            return CountryCode::NP;
+          case NR_HASH:
+            return CountryCode::NR;
+          case NU_HASH:
+            return CountryCode::NU;
+          case NZ_HASH:
+            return CountryCode::NZ;
+          case OM_HASH:
+            return CountryCode::OM;
+          case PA_HASH:
+            return CountryCode::PA;
+          case PE_HASH:
+            return CountryCode::PE;
+          case PF_HASH:
+            return CountryCode::PF;
+          case PG_HASH:
+            return CountryCode::PG;
+          case PH_HASH:
+            return CountryCode::PH;
+          case PK_HASH:
+            return CountryCode::PK;
+          case PL_HASH:
+            return CountryCode::PL;
+          case PM_HASH:
+            return CountryCode::PM;
+          case PN_HASH:
+            return CountryCode::PN;
+          case PR_HASH:
+            return CountryCode::PR;
+          case PT_HASH:
+            return CountryCode::PT;
+          case PW_HASH:
+            return CountryCode::PW;
+          case PY_HASH:
+            return CountryCode::PY;
+          case QA_HASH:
+            return CountryCode::QA;
+          case RO_HASH:
+            return CountryCode::RO;
+          case RS_HASH:
+            return CountryCode::RS;
+          case RU_HASH:
+            return CountryCode::RU;
+          case RW_HASH:
+            return CountryCode::RW;
+          case SA_HASH:
+            return CountryCode::SA;
+          case SB_HASH:
+            return CountryCode::SB;
+          case SC_HASH:
+            return CountryCode::SC;
+          case SD_HASH:
+            return CountryCode::SD;
+          case SE_HASH:
+            return CountryCode::SE;
+          case SG_HASH:
+            return CountryCode::SG;
+          case SH_HASH:
+            return CountryCode::SH;
+          case SI_HASH:
+            return CountryCode::SI;
+          case SK_HASH:
+            return CountryCode::SK;
+          case SL_HASH:
+            return CountryCode::SL;
+          case SM_HASH:
+            return CountryCode::SM;
+          case SN_HASH:
+            return CountryCode::SN;
+          case SO_HASH:
+            return CountryCode::SO;
+          case SR_HASH:
+            return CountryCode::SR;
+          case ST_HASH:
+            return CountryCode::ST;
+          case SV_HASH:
+            return CountryCode::SV;
+          case SY_HASH:
+            return CountryCode::SY;
+          case SZ_HASH:
+            return CountryCode::SZ;
+          case TC_HASH:
+            return CountryCode::TC;
+          case TD_HASH:
+            return CountryCode::TD;
+          case TG_HASH:
+            return CountryCode::TG;
+          case TH_HASH:
+            return CountryCode::TH;
+          case TJ_HASH:
+            return CountryCode::TJ;
+          case TK_HASH:
+            return CountryCode::TK;
+          case TL_HASH:
+            return CountryCode::TL;
+          case TM_HASH:
+            return CountryCode::TM;
+          case TN_HASH:
+            return CountryCode::TN;
+          case TO_HASH:
+            return CountryCode::TO;
+          case TR_HASH:
+            return CountryCode::TR;
+          case TT_HASH:
+            return CountryCode::TT;
+          case TV_HASH:
+            return CountryCode::TV;
+          case TW_HASH:
+            return CountryCode::TW;
+          case TZ_HASH:
+            return CountryCode::TZ;
+          case UA_HASH:
+            return CountryCode::UA;
+          case UG_HASH:
+            return CountryCode::UG;
+          case US_HASH:
+            return CountryCode::US;
+          case UY_HASH:
+            return CountryCode::UY;
+          case UZ_HASH:
+            return CountryCode::UZ;
+          case VA_HASH:
+            return CountryCode::VA;
+          case VC_HASH:
+            return CountryCode::VC;
+          case VE_HASH:
+            return CountryCode::VE;
+          case VG_HASH:
+            return CountryCode::VG;
+          case VI_HASH:
+            return CountryCode::VI;
+          case VN_HASH:
+            return CountryCode::VN;
+          case VU_HASH:
+            return CountryCode::VU;
+          case WF_HASH:
+            return CountryCode::WF;
+          case WS_HASH:
+            return CountryCode::WS;
+          case YE_HASH:
+            return CountryCode::YE;
+          case YT_HASH:
+            return CountryCode::YT;
+          case ZA_HASH:
+            return CountryCode::ZA;
+          case ZM_HASH:
+            return CountryCode::ZM;
+          case ZW_HASH:
+            return CountryCode::ZW;
+          default:
+            break;
           }
-          else if (hashCode == ZW_HASH)
+
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
           {
-            enumValue = CountryCode::ZW;
-            return true;
+            overflowContainer->StoreOverflow(hashCode, name);
+            return static_cast<CountryCode>(hashCode);
           }
-          return false;
+
+          return CountryCode::NOT_SET;
         }
 
-        static bool GetNameForEnumHelper0(CountryCode enumValue, Aws::String& value)
+        Aws::String GetNameForCountryCode(CountryCode enumValue)
         {
           switch(enumValue)
           {
           case CountryCode::AD:
-            value = "AD";
-            return true;
+            return "AD";
           case CountryCode::AE:
-            value = "AE";
-            return true;
+            return "AE";
           case CountryCode::AF:
-            value = "AF";
-            return true;
+            return "AF";
           case CountryCode::AG:
-            value = "AG";
-            return true;
+            return "AG";
           case CountryCode::AI:
-            value = "AI";
-            return true;
+            return "AI";
           case CountryCode::AL:
-            value = "AL";
-            return true;
+            return "AL";
           case CountryCode::AM:
-            value = "AM";
-            return true;
+            return "AM";
           case CountryCode::AN:
-            value = "AN";
-            return true;
+            return "AN";
           case CountryCode::AO:
-            value = "AO";
-            return true;
+            return "AO";
           case CountryCode::AQ:
-            value = "AQ";
-            return true;
+            return "AQ";
           case CountryCode::AR:
-            value = "AR";
-            return true;
+            return "AR";
           case CountryCode::AS:
-            value = "AS";
-            return true;
+            return "AS";
           case CountryCode::AT:
-            value = "AT";
-            return true;
+            return "AT";
           case CountryCode::AU:
-            value = "AU";
-            return true;
+            return "AU";
           case CountryCode::AW:
-            value = "AW";
-            return true;
+            return "AW";
           case CountryCode::AZ:
-            value = "AZ";
-            return true;
+            return "AZ";
           case CountryCode::BA:
-            value = "BA";
-            return true;
+            return "BA";
           case CountryCode::BB:
-            value = "BB";
-            return true;
+            return "BB";
           case CountryCode::BD:
-            value = "BD";
-            return true;
+            return "BD";
           case CountryCode::BE:
-            value = "BE";
-            return true;
+            return "BE";
           case CountryCode::BF:
-            value = "BF";
-            return true;
+            return "BF";
           case CountryCode::BG:
-            value = "BG";
-            return true;
+            return "BG";
           case CountryCode::BH:
-            value = "BH";
-            return true;
+            return "BH";
           case CountryCode::BI:
-            value = "BI";
-            return true;
+            return "BI";
           case CountryCode::BJ:
-            value = "BJ";
-            return true;
+            return "BJ";
           case CountryCode::BL:
-            value = "BL";
-            return true;
+            return "BL";
           case CountryCode::BM:
-            value = "BM";
-            return true;
+            return "BM";
           case CountryCode::BN:
-            value = "BN";
-            return true;
+            return "BN";
           case CountryCode::BO:
-            value = "BO";
-            return true;
+            return "BO";
           case CountryCode::BR:
-            value = "BR";
-            return true;
+            return "BR";
           case CountryCode::BS:
-            value = "BS";
-            return true;
+            return "BS";
           case CountryCode::BT:
-            value = "BT";
-            return true;
+            return "BT";
           case CountryCode::BW:
-            value = "BW";
-            return true;
+            return "BW";
           case CountryCode::BY:
-            value = "BY";
-            return true;
+            return "BY";
           case CountryCode::BZ:
-            value = "BZ";
-            return true;
+            return "BZ";
           case CountryCode::CA:
-            value = "CA";
-            return true;
+            return "CA";
           case CountryCode::CC:
-            value = "CC";
-            return true;
+            return "CC";
           case CountryCode::CD:
-            value = "CD";
-            return true;
+            return "CD";
           case CountryCode::CF:
-            value = "CF";
-            return true;
+            return "CF";
           case CountryCode::CG:
-            value = "CG";
-            return true;
+            return "CG";
           case CountryCode::CH:
-            value = "CH";
-            return true;
+            return "CH";
           case CountryCode::CI:
-            value = "CI";
-            return true;
+            return "CI";
           case CountryCode::CK:
-            value = "CK";
-            return true;
+            return "CK";
           case CountryCode::CL:
-            value = "CL";
-            return true;
+            return "CL";
           case CountryCode::CM:
-            value = "CM";
-            return true;
+            return "CM";
           case CountryCode::CN:
-            value = "CN";
-            return true;
+            return "CN";
           case CountryCode::CO:
-            value = "CO";
-            return true;
+            return "CO";
           case CountryCode::CR:
-            value = "CR";
-            return true;
+            return "CR";
           case CountryCode::CU:
-            value = "CU";
-            return true;
+            return "CU";
           case CountryCode::CV:
-            value = "CV";
-            return true;
+            return "CV";
           case CountryCode::CX:
-            value = "CX";
-            return true;
+            return "CX";
           case CountryCode::CY:
-            value = "CY";
-            return true;
+            return "CY";
           case CountryCode::CZ:
-            value = "CZ";
-            return true;
+            return "CZ";
           case CountryCode::DE:
-            value = "DE";
-            return true;
+            return "DE";
           case CountryCode::DJ:
-            value = "DJ";
-            return true;
+            return "DJ";
           case CountryCode::DK:
-            value = "DK";
-            return true;
+            return "DK";
           case CountryCode::DM:
-            value = "DM";
-            return true;
+            return "DM";
           case CountryCode::DO:
-            value = "DO";
-            return true;
+            return "DO";
           case CountryCode::DZ:
-            value = "DZ";
-            return true;
+            return "DZ";
           case CountryCode::EC:
-            value = "EC";
-            return true;
+            return "EC";
           case CountryCode::EE:
-            value = "EE";
-            return true;
+            return "EE";
           case CountryCode::EG:
-            value = "EG";
-            return true;
+            return "EG";
           case CountryCode::ER:
-            value = "ER";
-            return true;
+            return "ER";
           case CountryCode::ES:
-            value = "ES";
-            return true;
+            return "ES";
           case CountryCode::ET:
-            value = "ET";
-            return true;
+            return "ET";
           case CountryCode::FI:
-            value = "FI";
-            return true;
+            return "FI";
           case CountryCode::FJ:
-            value = "FJ";
-            return true;
+            return "FJ";
           case CountryCode::FK:
-            value = "FK";
-            return true;
+            return "FK";
           case CountryCode::FM:
-            value = "FM";
-            return true;
+            return "FM";
           case CountryCode::FO:
-            value = "FO";
-            return true;
+            return "FO";
           case CountryCode::FR:
-            value = "FR";
-            return true;
+            return "FR";
           case CountryCode::GA:
-            value = "GA";
-            return true;
+            return "GA";
           case CountryCode::GB:
-            value = "GB";
-            return true;
+            return "GB";
           case CountryCode::GD:
-            value = "GD";
-            return true;
+            return "GD";
           case CountryCode::GE:
-            value = "GE";
-            return true;
+            return "GE";
           case CountryCode::GH:
-            value = "GH";
-            return true;
+            return "GH";
           case CountryCode::GI:
-            value = "GI";
-            return true;
+            return "GI";
           case CountryCode::GL:
-            value = "GL";
-            return true;
+            return "GL";
           case CountryCode::GM:
-            value = "GM";
-            return true;
+            return "GM";
           case CountryCode::GN:
-            value = "GN";
-            return true;
+            return "GN";
           case CountryCode::GQ:
-            value = "GQ";
-            return true;
+            return "GQ";
           case CountryCode::GR:
-            value = "GR";
-            return true;
+            return "GR";
           case CountryCode::GT:
-            value = "GT";
-            return true;
+            return "GT";
           case CountryCode::GU:
-            value = "GU";
-            return true;
+            return "GU";
           case CountryCode::GW:
-            value = "GW";
-            return true;
+            return "GW";
           case CountryCode::GY:
-            value = "GY";
-            return true;
+            return "GY";
           case CountryCode::HK:
-            value = "HK";
-            return true;
+            return "HK";
           case CountryCode::HN:
-            value = "HN";
-            return true;
+            return "HN";
           case CountryCode::HR:
-            value = "HR";
-            return true;
+            return "HR";
           case CountryCode::HT:
-            value = "HT";
-            return true;
+            return "HT";
           case CountryCode::HU:
-            value = "HU";
-            return true;
+            return "HU";
           case CountryCode::ID:
-            value = "ID";
-            return true;
+            return "ID";
           case CountryCode::IE:
-            value = "IE";
-            return true;
+            return "IE";
           case CountryCode::IL:
-            value = "IL";
-            return true;
+            return "IL";
           case CountryCode::IM:
-            value = "IM";
-            return true;
+            return "IM";
           case CountryCode::IN:
-            value = "IN";
-            return true;
+            return "IN";
           case CountryCode::IQ:
-            value = "IQ";
-            return true;
+            return "IQ";
           case CountryCode::IR:
-            value = "IR";
-            return true;
+            return "IR";
           case CountryCode::IS:
-            value = "IS";
-            return true;
+            return "IS";
           case CountryCode::IT:
-            value = "IT";
-            return true;
+            return "IT";
           case CountryCode::JM:
-            value = "JM";
-            return true;
+            return "JM";
           case CountryCode::JO:
-            value = "JO";
-            return true;
+            return "JO";
           case CountryCode::JP:
-            value = "JP";
-            return true;
+            return "JP";
           case CountryCode::KE:
-            value = "KE";
-            return true;
+            return "KE";
           case CountryCode::KG:
-            value = "KG";
-            return true;
+            return "KG";
           case CountryCode::KH:
-            value = "KH";
-            return true;
+            return "KH";
           case CountryCode::KI:
-            value = "KI";
-            return true;
+            return "KI";
           case CountryCode::KM:
-            value = "KM";
-            return true;
+            return "KM";
           case CountryCode::KN:
-            value = "KN";
-            return true;
+            return "KN";
           case CountryCode::KP:
-            value = "KP";
-            return true;
+            return "KP";
           case CountryCode::KR:
-            value = "KR";
-            return true;
+            return "KR";
           case CountryCode::KW:
-            value = "KW";
-            return true;
+            return "KW";
           case CountryCode::KY:
-            value = "KY";
-            return true;
+            return "KY";
           case CountryCode::KZ:
-            value = "KZ";
-            return true;
+            return "KZ";
           case CountryCode::LA:
-            value = "LA";
-            return true;
+            return "LA";
           case CountryCode::LB:
-            value = "LB";
-            return true;
+            return "LB";
           case CountryCode::LC:
-            value = "LC";
-            return true;
+            return "LC";
           case CountryCode::LI:
-            value = "LI";
-            return true;
+            return "LI";
           case CountryCode::LK:
-            value = "LK";
-            return true;
+            return "LK";
           case CountryCode::LR:
-            value = "LR";
-            return true;
+            return "LR";
           case CountryCode::LS:
-            value = "LS";
-            return true;
+            return "LS";
           case CountryCode::LT:
-            value = "LT";
-            return true;
-          default:
-            return false;
-          }
-        }
-        static bool GetNameForEnumHelper1(CountryCode enumValue, Aws::String& value)
-        {
-          switch(enumValue)
-          {
+            return "LT";
           case CountryCode::LU:
-            value = "LU";
-            return true;
+            return "LU";
           case CountryCode::LV:
-            value = "LV";
-            return true;
+            return "LV";
           case CountryCode::LY:
-            value = "LY";
-            return true;
+            return "LY";
           case CountryCode::MA:
-            value = "MA";
-            return true;
+            return "MA";
           case CountryCode::MC:
-            value = "MC";
-            return true;
+            return "MC";
           case CountryCode::MD:
-            value = "MD";
-            return true;
+            return "MD";
           case CountryCode::ME:
-            value = "ME";
-            return true;
+            return "ME";
           case CountryCode::MF:
-            value = "MF";
-            return true;
+            return "MF";
           case CountryCode::MG:
-            value = "MG";
-            return true;
+            return "MG";
           case CountryCode::MH:
-            value = "MH";
-            return true;
+            return "MH";
           case CountryCode::MK:
-            value = "MK";
-            return true;
+            return "MK";
           case CountryCode::ML:
-            value = "ML";
-            return true;
+            return "ML";
           case CountryCode::MM:
-            value = "MM";
-            return true;
+            return "MM";
           case CountryCode::MN:
-            value = "MN";
-            return true;
+            return "MN";
           case CountryCode::MO:
-            value = "MO";
-            return true;
+            return "MO";
           case CountryCode::MP:
-            value = "MP";
-            return true;
+            return "MP";
           case CountryCode::MR:
-            value = "MR";
-            return true;
+            return "MR";
           case CountryCode::MS:
-            value = "MS";
-            return true;
+            return "MS";
           case CountryCode::MT:
-            value = "MT";
-            return true;
+            return "MT";
           case CountryCode::MU:
-            value = "MU";
-            return true;
+            return "MU";
           case CountryCode::MV:
-            value = "MV";
-            return true;
+            return "MV";
           case CountryCode::MW:
-            value = "MW";
-            return true;
+            return "MW";
           case CountryCode::MX:
-            value = "MX";
-            return true;
+            return "MX";
           case CountryCode::MY:
-            value = "MY";
-            return true;
+            return "MY";
           case CountryCode::MZ:
-            value = "MZ";
-            return true;
+            return "MZ";
           case CountryCode::NA:
-            value = "NA";
-            return true;
+            return "NA";
           case CountryCode::NC:
-            value = "NC";
-            return true;
+            return "NC";
           case CountryCode::NE:
-            value = "NE";
-            return true;
+            return "NE";
           case CountryCode::NG:
-            value = "NG";
-            return true;
+            return "NG";
           case CountryCode::NI:
-            value = "NI";
-            return true;
+            return "NI";
           case CountryCode::NL:
-            value = "NL";
-            return true;
+            return "NL";
           case CountryCode::NO:
-            value = "NO";
-            return true;
+            return "NO";
           case CountryCode::NP:
-            value = "NP";
-            return true;
+            return "NP";
           case CountryCode::NR:
-            value = "NR";
-            return true;
+            return "NR";
           case CountryCode::NU:
-            value = "NU";
-            return true;
+            return "NU";
           case CountryCode::NZ:
-            value = "NZ";
-            return true;
+            return "NZ";
           case CountryCode::OM:
-            value = "OM";
-            return true;
+            return "OM";
           case CountryCode::PA:
-            value = "PA";
-            return true;
+            return "PA";
           case CountryCode::PE:
-            value = "PE";
-            return true;
+            return "PE";
           case CountryCode::PF:
-            value = "PF";
-            return true;
+            return "PF";
           case CountryCode::PG:
-            value = "PG";
-            return true;
+            return "PG";
           case CountryCode::PH:
-            value = "PH";
-            return true;
+            return "PH";
           case CountryCode::PK:
-            value = "PK";
-            return true;
+            return "PK";
           case CountryCode::PL:
-            value = "PL";
-            return true;
+            return "PL";
           case CountryCode::PM:
-            value = "PM";
-            return true;
+            return "PM";
           case CountryCode::PN:
-            value = "PN";
-            return true;
+            return "PN";
           case CountryCode::PR:
-            value = "PR";
-            return true;
+            return "PR";
           case CountryCode::PT:
-            value = "PT";
-            return true;
+            return "PT";
           case CountryCode::PW:
-            value = "PW";
-            return true;
+            return "PW";
           case CountryCode::PY:
-            value = "PY";
-            return true;
+            return "PY";
           case CountryCode::QA:
-            value = "QA";
-            return true;
+            return "QA";
           case CountryCode::RO:
-            value = "RO";
-            return true;
+            return "RO";
           case CountryCode::RS:
-            value = "RS";
-            return true;
+            return "RS";
           case CountryCode::RU:
-            value = "RU";
-            return true;
+            return "RU";
           case CountryCode::RW:
-            value = "RW";
-            return true;
+            return "RW";
           case CountryCode::SA:
-            value = "SA";
-            return true;
+            return "SA";
           case CountryCode::SB:
-            value = "SB";
-            return true;
+            return "SB";
           case CountryCode::SC:
-            value = "SC";
-            return true;
+            return "SC";
           case CountryCode::SD:
-            value = "SD";
-            return true;
+            return "SD";
           case CountryCode::SE:
-            value = "SE";
-            return true;
+            return "SE";
           case CountryCode::SG:
-            value = "SG";
-            return true;
+            return "SG";
           case CountryCode::SH:
-            value = "SH";
-            return true;
+            return "SH";
           case CountryCode::SI:
-            value = "SI";
-            return true;
+            return "SI";
           case CountryCode::SK:
-            value = "SK";
-            return true;
+            return "SK";
           case CountryCode::SL:
-            value = "SL";
-            return true;
+            return "SL";
           case CountryCode::SM:
-            value = "SM";
-            return true;
+            return "SM";
           case CountryCode::SN:
-            value = "SN";
-            return true;
+            return "SN";
           case CountryCode::SO:
-            value = "SO";
-            return true;
+            return "SO";
           case CountryCode::SR:
-            value = "SR";
-            return true;
+            return "SR";
           case CountryCode::ST:
-            value = "ST";
-            return true;
+            return "ST";
           case CountryCode::SV:
-            value = "SV";
-            return true;
+            return "SV";
           case CountryCode::SY:
-            value = "SY";
-            return true;
+            return "SY";
           case CountryCode::SZ:
-            value = "SZ";
-            return true;
+            return "SZ";
           case CountryCode::TC:
-            value = "TC";
-            return true;
+            return "TC";
           case CountryCode::TD:
-            value = "TD";
-            return true;
+            return "TD";
           case CountryCode::TG:
-            value = "TG";
-            return true;
+            return "TG";
           case CountryCode::TH:
-            value = "TH";
-            return true;
+            return "TH";
           case CountryCode::TJ:
-            value = "TJ";
-            return true;
+            return "TJ";
           case CountryCode::TK:
-            value = "TK";
-            return true;
+            return "TK";
           case CountryCode::TL:
-            value = "TL";
-            return true;
+            return "TL";
           case CountryCode::TM:
-            value = "TM";
-            return true;
+            return "TM";
           case CountryCode::TN:
-            value = "TN";
-            return true;
+            return "TN";
           case CountryCode::TO:
-            value = "TO";
-            return true;
+            return "TO";
           case CountryCode::TR:
-            value = "TR";
-            return true;
+            return "TR";
           case CountryCode::TT:
-            value = "TT";
-            return true;
+            return "TT";
           case CountryCode::TV:
-            value = "TV";
-            return true;
+            return "TV";
           case CountryCode::TW:
-            value = "TW";
-            return true;
+            return "TW";
           case CountryCode::TZ:
-            value = "TZ";
-            return true;
+            return "TZ";
           case CountryCode::UA:
-            value = "UA";
-            return true;
+            return "UA";
           case CountryCode::UG:
-            value = "UG";
-            return true;
+            return "UG";
           case CountryCode::US:
-            value = "US";
-            return true;
+            return "US";
           case CountryCode::UY:
-            value = "UY";
-            return true;
+            return "UY";
           case CountryCode::UZ:
-            value = "UZ";
-            return true;
+            return "UZ";
           case CountryCode::VA:
-            value = "VA";
-            return true;
+            return "VA";
           case CountryCode::VC:
-            value = "VC";
-            return true;
+            return "VC";
           case CountryCode::VE:
-            value = "VE";
-            return true;
+            return "VE";
           case CountryCode::VG:
-            value = "VG";
-            return true;
+            return "VG";
           case CountryCode::VI:
-            value = "VI";
-            return true;
+            return "VI";
           case CountryCode::VN:
-            value = "VN";
-            return true;
+            return "VN";
           case CountryCode::VU:
-            value = "VU";
-            return true;
+            return "VU";
           case CountryCode::WF:
-            value = "WF";
-            return true;
+            return "WF";
           case CountryCode::WS:
-            value = "WS";
-            return true;
+            return "WS";
           case CountryCode::YE:
-            value = "YE";
-            return true;
+            return "YE";
           case CountryCode::YT:
-            value = "YT";
-            return true;
+            return "YT";
           case CountryCode::ZA:
-            value = "ZA";
-            return true;
+            return "ZA";
           case CountryCode::ZM:
-            value = "ZM";
-            return true;
+            return "ZM";
           case CountryCode::ZW:
-            value = "ZW";
-            return true;
+            return "ZW";
           default:
-            return false;
-          }
-        }
+            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+            if(overflowContainer)
+            {
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+            }
 
-        CountryCode GetCountryCodeForName(const Aws::String& name)
-        {
-          int hashCode = HashingUtils::HashString(name.c_str());
-          CountryCode enumValue;
-          if (GetEnumForNameHelper0(hashCode, enumValue))
-          {
-             return enumValue;
-          }
-          else if (GetEnumForNameHelper1(hashCode, enumValue))
-          {
-             return enumValue;
-          }
-          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-          if(overflowContainer)
-          {
-            overflowContainer->StoreOverflow(hashCode, name);
-            return static_cast<CountryCode>(hashCode);
+            return "";
           }
-
-          return CountryCode::NOT_SET;
-        }
-
-        Aws::String GetNameForCountryCode(CountryCode enumValue)
-        {
-          Aws::String value;
-          if (GetNameForEnumHelper0(enumValue, value))
-          {
-            return value;
-          }
-          else if (GetNameForEnumHelper1(enumValue, value))
-          {
-            return value;
-          }
-          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-          if(overflowContainer)
-          {
-            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-          }
-
-          return "";
         }
 
       } // namespace CountryCodeMapper
@@ -29,51 +29,47 @@ namespace Aws
       namespace DomainAvailabilityMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int AVAILABLE_RESERVED_HASH = HashingUtils::HashString("AVAILABLE_RESERVED");
-        static const int AVAILABLE_PREORDER_HASH = HashingUtils::HashString("AVAILABLE_PREORDER");
-        static const int UNAVAILABLE_HASH = HashingUtils::HashString("UNAVAILABLE");
-        static const int UNAVAILABLE_PREMIUM_HASH = HashingUtils::HashString("UNAVAILABLE_PREMIUM");
-        static const int UNAVAILABLE_RESTRICTED_HASH = HashingUtils::HashString("UNAVAILABLE_RESTRICTED");
-        static const int RESERVED_HASH = HashingUtils::HashString("RESERVED");
-        static const int DONT_KNOW_HASH = HashingUtils::HashString("DONT_KNOW");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int AVAILABLE_HASH = 2052692649;
+        static const int AVAILABLE_RESERVED_HASH = -1418199042;
+        static const int AVAILABLE_PREORDER_HASH = 1947170657;
+        static const int UNAVAILABLE_HASH = 1487498288;
+        static const int UNAVAILABLE_PREMIUM_HASH = -273531608;
+        static const int UNAVAILABLE_RESTRICTED_HASH = 1195335626;
+        static const int RESERVED_HASH = 432241448;
+        static const int DONT_KNOW_HASH = 595949177;
 
 
         DomainAvailability GetDomainAvailabilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
+          switch (hashCode)
           {
+          case AVAILABLE_HASH:
             return DomainAvailability::AVAILABLE;
-          }
-          else if (hashCode == AVAILABLE_RESERVED_HASH)
-          {
+          case AVAILABLE_RESERVED_HASH:
             return DomainAvailability::AVAILABLE_RESERVED;
-          }
-          else if (hashCode == AVAILABLE_PREORDER_HASH)
-          {
+          case AVAILABLE_PREORDER_HASH:
             return DomainAvailability::AVAILABLE_PREORDER;
-          }
-          else if (hashCode == UNAVAILABLE_HASH)
-          {
+          case UNAVAILABLE_HASH:
             return DomainAvailability::UNAVAILABLE;
-          }
-          else if (hashCode == UNAVAILABLE_PREMIUM_HASH)
-          {
+          case UNAVAILABLE_PREMIUM_HASH:
             return DomainAvailability::UNAVAILABLE_PREMIUM;
-          }
-          else if (hashCode == UNAVAILABLE_RESTRICTED_HASH)
-          {
+          case UNAVAILABLE_RESTRICTED_HASH:
             return DomainAvailability::UNAVAILABLE_RESTRICTED;
-          }
-          else if (hashCode == RESERVED_HASH)
-          {
+          case RESERVED_HASH:
             return DomainAvailability::RESERVED;
-          }
-          else if (hashCode == DONT_KNOW_HASH)
-          {
+          case DONT_KNOW_HASH:
             return DomainAvailability::DONT_KNOW;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
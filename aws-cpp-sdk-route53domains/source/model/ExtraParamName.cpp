@@ -29,116 +29,86 @@ namespace Aws
       namespace ExtraParamNameMapper
       {
 
-        static const int DUNS_NUMBER_HASH = HashingUtils::HashString("DUNS_NUMBER");
-        static const int BRAND_NUMBER_HASH = HashingUtils::HashString("BRAND_NUMBER");
-        static const int BIRTH_DEPARTMENT_HASH = HashingUtils::HashString("BIRTH_DEPARTMENT");
-        static const int BIRTH_DATE_IN_YYYY_MM_DD_HASH = HashingUtils::HashString("BIRTH_DATE_IN_YYYY_MM_DD");
-        static const int BIRTH_COUNTRY_HASH = HashingUtils::HashString("BIRTH_COUNTRY");
-        static const int BIRTH_CITY_HASH = HashingUtils::HashString("BIRTH_CITY");
-        static const int DOCUMENT_NUMBER_HASH = HashingUtils::HashString("DOCUMENT_NUMBER");
-        static const int AU_ID_NUMBER_HASH = HashingUtils::HashString("AU_ID_NUMBER");
-        static const int AU_ID_TYPE_HASH = HashingUtils::HashString("AU_ID_TYPE");
-        static const int CA_LEGAL_TYPE_HASH = HashingUtils::HashString("CA_LEGAL_TYPE");
-        static const int CA_BUSINESS_ENTITY_TYPE_HASH = HashingUtils::HashString("CA_BUSINESS_ENTITY_TYPE");
-        static const int ES_IDENTIFICATION_HASH = HashingUtils::HashString("ES_IDENTIFICATION");
-        static const int ES_IDENTIFICATION_TYPE_HASH = HashingUtils::HashString("ES_IDENTIFICATION_TYPE");
-        static const int ES_LEGAL_FORM_HASH = HashingUtils::HashString("ES_LEGAL_FORM");
-        static const int FI_BUSINESS_NUMBER_HASH = HashingUtils::HashString("FI_BUSINESS_NUMBER");
-        static const int FI_ID_NUMBER_HASH = HashingUtils::HashString("FI_ID_NUMBER");
-        static const int IT_PIN_HASH = HashingUtils::HashString("IT_PIN");
-        static const int RU_PASSPORT_DATA_HASH = HashingUtils::HashString("RU_PASSPORT_DATA");
-        static const int SE_ID_NUMBER_HASH = HashingUtils::HashString("SE_ID_NUMBER");
-        static const int SG_ID_NUMBER_HASH = HashingUtils::HashString("SG_ID_NUMBER");
-        static const int VAT_NUMBER_HASH = HashingUtils::HashString("VAT_NUMBER");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int DUNS_NUMBER_HASH = -1353108078;
+        static const int BRAND_NUMBER_HASH = -1548146911;
+        static const int BIRTH_DEPARTMENT_HASH = 495075058;
+        static const int BIRTH_DATE_IN_YYYY_MM_DD_HASH = -838880023;
+        static const int BIRTH_COUNTRY_HASH = 746321878;
+        static const int BIRTH_CITY_HASH = 1683347723;
+        static const int DOCUMENT_NUMBER_HASH = -1699895571;
+        static const int AU_ID_NUMBER_HASH = 368750754;
+        static const int AU_ID_TYPE_HASH = 1560341203;
+        static const int CA_LEGAL_TYPE_HASH = -495021151;
+        static const int CA_BUSINESS_ENTITY_TYPE_HASH = 672916824;
+        static const int ES_IDENTIFICATION_HASH = -821929441;
+        static const int ES_IDENTIFICATION_TYPE_HASH = 279863642;
+        static const int ES_LEGAL_FORM_HASH = 1241235163;
+        static const int FI_BUSINESS_NUMBER_HASH = 1171610924;
+        static const int FI_ID_NUMBER_HASH = 1102744177;
+        static const int IT_PIN_HASH = -2124554143;
+        static const int RU_PASSPORT_DATA_HASH = -919336261;
+        static const int SE_ID_NUMBER_HASH = 1378690368;
+        static const int SG_ID_NUMBER_HASH = 2079754946;
+        static const int VAT_NUMBER_HASH = -146098881;
 
 
         ExtraParamName GetExtraParamNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DUNS_NUMBER_HASH)
+          switch (hashCode)
           {
+          case DUNS_NUMBER_HASH:
             return ExtraParamName::DUNS_NUMBER;
-          }
-          else if (hashCode == BRAND_NUMBER_HASH)
-          {
+          case BRAND_NUMBER_HASH:
             return ExtraParamName::BRAND_NUMBER;
-          }
-          else if (hashCode == BIRTH_DEPARTMENT_HASH)
-          {
+          case BIRTH_DEPARTMENT_HASH:
             return ExtraParamName::BIRTH_DEPARTMENT;
-          }
-          else if (hashCode == BIRTH_DATE_IN_YYYY_MM_DD_HASH)
-          {
+          case BIRTH_DATE_IN_YYYY_MM_DD_HASH:
             return ExtraParamName::BIRTH_DATE_IN_YYYY_MM_DD;
-          }
-          else if (hashCode == BIRTH_COUNTRY_HASH)
-          {
+          case BIRTH_COUNTRY_HASH:
             return ExtraParamName::BIRTH_COUNTRY;
-          }
-          else if (hashCode == BIRTH_CITY_HASH)
-          {
+          case BIRTH_CITY_HASH:
             return ExtraParamName::BIRTH_CITY;
-          }
-          else if (hashCode == DOCUMENT_NUMBER_HASH)
-          {
+          case DOCUMENT_NUMBER_HASH:
             return ExtraParamName::DOCUMENT_NUMBER;
-          }
-          else if (hashCode == AU_ID_NUMBER_HASH)
-          {
+          case AU_ID_NUMBER_HASH:
             return ExtraParamName::AU_ID_NUMBER;
-          }
-          else if (hashCode == AU_ID_TYPE_HASH)
-          {
+          case AU_ID_TYPE_HASH:
             return ExtraParamName::AU_ID_TYPE;
-          }
-          else if (hashCode == CA_LEGAL_TYPE_HASH)
-          {
+          case CA_LEGAL_TYPE_HASH:
             return ExtraParamName::CA_LEGAL_TYPE;
-          }
-          else if (hashCode == CA_BUSINESS_ENTITY_TYPE_HASH)
-          {
+          case CA_BUSINESS_ENTITY_TYPE_HASH:
             return ExtraParamName::CA_BUSINESS_ENTITY_TYPE;
-          }
-          else if (hashCode == ES_IDENTIFICATION_HASH)
-          {
+          case ES_IDENTIFICATION_HASH:
             return ExtraParamName::ES_IDENTIFICATION;
-          }
-          else if (hashCode == ES_IDENTIFICATION_TYPE_HASH)
-          {
+          case ES_IDENTIFICATION_TYPE_HASH:
             return ExtraParamName::ES_IDENTIFICATION_TYPE;
-          }
-          else if (hashCode == ES_LEGAL_FORM_HASH)
-          {
+          case ES_LEGAL_FORM_HASH:
             return ExtraParamName::ES_LEGAL_FORM;
-          }
-          else if (hashCode == FI_BUSINESS_NUMBER_HASH)
-          {
+          case FI_BUSINESS_NUMBER_HASH:
             return ExtraParamName::FI_BUSINESS_NUMBER;
-          }
-          else if (hashCode == FI_ID_NUMBER_HASH)
-          {
+          case FI_ID_NUMBER_HASH:
             return ExtraParamName::FI_ID_NUMBER;
-          }
-          else if (hashCode == IT_PIN_HASH)
-          {
+          case IT_PIN_HASH:
             return ExtraParamName::IT_PIN;
-          }
-          else if (hashCode == RU_PASSPORT_DATA_HASH)
-          {
+          case RU_PASSPORT_DATA_HASH:
             return ExtraParamName::RU_PASSPORT_DATA;
-          }
-          else if (hashCode == SE_ID_NUMBER_HASH)
-          {
+          case SE_ID_NUMBER_HASH:
             return ExtraParamName::SE_ID_NUMBER;
-          }
-          else if (hashCode == SG_ID_NUMBER_HASH)
-          {
+          case SG_ID_NUMBER_HASH:
             return ExtraParamName::SG_ID_NUMBER;
-          }
-          else if (hashCode == VAT_NUMBER_HASH)
-          {
+          case VAT_NUMBER_HASH:
             return ExtraParamName::VAT_NUMBER;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,36 +29,38 @@ namespace Aws
       namespace OperationStatusMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int SUCCESSFUL_HASH = HashingUtils::HashString("SUCCESSFUL");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int SUBMITTED_HASH = -1159694117;
+        static const int IN_PROGRESS_HASH = -604548089;
+        static const int ERROR__HASH = 66247144;
+        static const int SUCCESSFUL_HASH = -248539494;
+        static const int FAILED_HASH = 2066319421;
 
 
         OperationStatus GetOperationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
+          switch (hashCode)
           {
+          case SUBMITTED_HASH:
             return OperationStatus::SUBMITTED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
+          case IN_PROGRESS_HASH:
             return OperationStatus::IN_PROGRESS;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
+          case ERROR__HASH:
             return OperationStatus::ERROR_;
-          }
-          else if (hashCode == SUCCESSFUL_HASH)
-          {
+          case SUCCESSFUL_HASH:
             return OperationStatus::SUCCESSFUL;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return OperationStatus::FAILED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,46 +29,44 @@ namespace Aws
       namespace OperationTypeMapper
       {
 
-        static const int REGISTER_DOMAIN_HASH = HashingUtils::HashString("REGISTER_DOMAIN");
-        static const int DELETE_DOMAIN_HASH = HashingUtils::HashString("DELETE_DOMAIN");
-        static const int TRANSFER_IN_DOMAIN_HASH = HashingUtils::HashString("TRANSFER_IN_DOMAIN");
-        static const int UPDATE_DOMAIN_CONTACT_HASH = HashingUtils::HashString("UPDATE_DOMAIN_CONTACT");
-        static const int UPDATE_NAMESERVER_HASH = HashingUtils::HashString("UPDATE_NAMESERVER");
-        static const int CHANGE_PRIVACY_PROTECTION_HASH = HashingUtils::HashString("CHANGE_PRIVACY_PROTECTION");
-        static const int DOMAIN_LOCK_HASH = HashingUtils::HashString("DOMAIN_LOCK");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int REGISTER_DOMAIN_HASH = -975799840;
+        static const int DELETE_DOMAIN_HASH = 964437464;
+        static const int TRANSFER_IN_DOMAIN_HASH = -480177718;
+        static const int UPDATE_DOMAIN_CONTACT_HASH = 903418299;
+        static const int UPDATE_NAMESERVER_HASH = 980468420;
+        static const int CHANGE_PRIVACY_PROTECTION_HASH = -1112097537;
+        static const int DOMAIN_LOCK_HASH = -2008381498;
 
 
         OperationType GetOperationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGISTER_DOMAIN_HASH)
+          switch (hashCode)
           {
+          case REGISTER_DOMAIN_HASH:
             return OperationType::REGISTER_DOMAIN;
-          }
-          else if (hashCode == DELETE_DOMAIN_HASH)
-          {
+          case DELETE_DOMAIN_HASH:
             return OperationType::DELETE_DOMAIN;
-          }
-          else if (hashCode == TRANSFER_IN_DOMAIN_HASH)
-          {
+          case TRANSFER_IN_DOMAIN_HASH:
             return OperationType::TRANSFER_IN_DOMAIN;
-          }
-          else if (hashCode == UPDATE_DOMAIN_CONTACT_HASH)
-          {
+          case UPDATE_DOMAIN_CONTACT_HASH:
             return OperationType::UPDATE_DOMAIN_CONTACT;
-          }
-          else if (hashCode == UPDATE_NAMESERVER_HASH)
-          {
+          case UPDATE_NAMESERVER_HASH:
             return OperationType::UPDATE_NAMESERVER;
-          }
-          else if (hashCode == CHANGE_PRIVACY_PROTECTION_HASH)
-          {
+          case CHANGE_PRIVACY_PROTECTION_HASH:
             return OperationType::CHANGE_PRIVACY_PROTECTION;
-          }
-          else if (hashCode == DOMAIN_LOCK_HASH)
-          {
+          case DOMAIN_LOCK_HASH:
             return OperationType::DOMAIN_LOCK;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace ReachabilityStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int DONE_HASH = HashingUtils::HashString("DONE");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PENDING_HASH = 35394935;
+        static const int DONE_HASH = 2104194;
+        static const int EXPIRED_HASH = -591252731;
 
 
         ReachabilityStatus GetReachabilityStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          switch (hashCode)
           {
+          case PENDING_HASH:
             return ReachabilityStatus::PENDING;
-          }
-          else if (hashCode == DONE_HASH)
-          {
+          case DONE_HASH:
             return ReachabilityStatus::DONE;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
+          case EXPIRED_HASH:
             return ReachabilityStatus::EXPIRED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
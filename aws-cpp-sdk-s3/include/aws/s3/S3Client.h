@@ -57,6 +57,9 @@
 #include <aws/s3/model/UploadPartCopyResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -379,6 +382,18 @@ namespace Aws
          */
         virtual void AbortMultipartUploadAsync(const Model::AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AbortMultipartUploadCallable(const Model::AbortMultipartUploadRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AbortMultipartUploadOutcomeCallable AbortMultipartUploadCallable(Model::AbortMultipartUploadRequest&& request) const;
+
+        /**
+         * Same as AbortMultipartUploadAsync(const Model::AbortMultipartUploadRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AbortMultipartUploadAsync(Model::AbortMultipartUploadRequest&& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Completes a multipart upload by assembling previously uploaded parts.
          */
@@ -398,6 +413,18 @@ namespace Aws
          */
         virtual void CompleteMultipartUploadAsync(const Model::CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CompleteMultipartUploadCallable(const Model::CompleteMultipartUploadRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CompleteMultipartUploadOutcomeCallable CompleteMultipartUploadCallable(Model::CompleteMultipartUploadRequest&& request) const;
+
+        /**
+         * Same as CompleteMultipartUploadAsync(const Model::CompleteMultipartUploadRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CompleteMultipartUploadAsync(Model::CompleteMultipartUploadRequest&& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Creates a copy of an object that is already stored in Amazon S3.
          */
@@ -417,6 +444,18 @@ namespace Aws
          */
         virtual void CopyObjectAsync(const Model::CopyObjectRequest& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopyObjectCallable(const Model::CopyObjectRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CopyObjectOutcomeCallable CopyObjectCallable(Model::CopyObjectRequest&& request) const;
+
+        /**
+         * Same as CopyObjectAsync(const Model::CopyObjectRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CopyObjectAsync(Model::CopyObjectRequest&& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Creates a new bucket.
          */
@@ -436,6 +475,18 @@ namespace Aws
          */
         virtual void CreateBucketAsync(const Model::CreateBucketRequest& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateBucketCallable(const Model::CreateBucketRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateBucketOutcomeCallable CreateBucketCallable(Model::CreateBucketRequest&& request) const;
+
+        /**
+         * Same as CreateBucketAsync(const Model::CreateBucketRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateBucketAsync(Model::CreateBucketRequest&& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Initiates a multipart upload and returns an upload ID.</p><p><b>Note:</b>
          * After you initiate multipart upload and upload one or more parts, you must
@@ -470,6 +521,18 @@ namespace Aws
          */
         virtual void CreateMultipartUploadAsync(const Model::CreateMultipartUploadRequest& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateMultipartUploadCallable(const Model::CreateMultipartUploadRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateMultipartUploadOutcomeCallable CreateMultipartUploadCallable(Model::CreateMultipartUploadRequest&& request) const;
+
+        /**
+         * Same as CreateMultipartUploadAsync(const Model::CreateMultipartUploadRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateMultipartUploadAsync(Model::CreateMultipartUploadRequest&& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Deletes the bucket. All objects (including all object versions and Delete
          * Markers) in the bucket must be deleted before the bucket itself can be deleted.
@@ -492,6 +555,18 @@ namespace Aws
          */
         virtual void DeleteBucketAsync(const Model::DeleteBucketRequest& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBucketCallable(const Model::DeleteBucketRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteBucketOutcomeCallable DeleteBucketCallable(Model::DeleteBucketRequest&& request) const;
+
+        /**
+         * Same as DeleteBucketAsync(const Model::DeleteBucketRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteBucketAsync(Model::DeleteBucketRequest&& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Deletes the cors configuration information set for the bucket.
          */
@@ -511,6 +586,18 @@ namespace Aws
          */
         virtual void DeleteBucketCorsAsync(const Model::DeleteBucketCorsRequest& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBucketCorsCallable(const Model::DeleteBucketCorsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteBucketCorsOutcomeCallable DeleteBucketCorsCallable(Model::DeleteBucketCorsRequest&& request) const;
+
+        /**
+         * Same as DeleteBucketCorsAsync(const Model::DeleteBucketCorsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteBucketCorsAsync(Model::DeleteBucketCorsRequest&& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Deletes the lifecycle configuration from the bucket.
          */
@@ -530,6 +617,18 @@ namespace Aws
          */
         virtual void DeleteBucketLifecycleAsync(const Model::DeleteBucketLifecycleRequest& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBucketLifecycleCallable(const Model::DeleteBucketLifecycleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteBucketLifecycleOutcomeCallable DeleteBucketLifecycleCallable(Model::DeleteBucketLifecycleRequest&& request) const;
+
+        /**
+         * Same as DeleteBucketLifecycleAsync(const Model::DeleteBucketLifecycleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteBucketLifecycleAsync(Model::DeleteBucketLifecycleRequest&& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Deletes the policy from the bucket.
          */
@@ -549,6 +648,18 @@ namespace Aws
          */
         virtual void DeleteBucketPolicyAsync(const Model::DeleteBucketPolicyRequest& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBucketPolicyCallable(const Model::DeleteBucketPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteBucketPolicyOutcomeCallable DeleteBucketPolicyCallable(Model::DeleteBucketPolicyRequest&& request) const;
+
+        /**
+         * Same as DeleteBucketPolicyAsync(const Model::DeleteBucketPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteBucketPolicyAsync(Model::DeleteBucketPolicyRequest&& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Deletes the replication configuration from the bucket.
          */
@@ -568,6 +679,18 @@ namespace Aws
          */
         virtual void DeleteBucketReplicationAsync(const Model::DeleteBucketReplicationRequest& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBucketReplicationCallable(const Model::DeleteBucketReplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteBucketReplicationOutcomeCallable DeleteBucketReplicationCallable(Model::DeleteBucketReplicationRequest&& request) const;
+
+        /**
+         * Same as DeleteBucketReplicationAsync(const Model::DeleteBucketReplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteBucketReplicationAsync(Model::DeleteBucketReplicationRequest&& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Deletes the tags from the bucket.
          */
@@ -587,6 +710,18 @@ namespace Aws
          */
         virtual void DeleteBucketTaggingAsync(const Model::DeleteBucketTaggingRequest& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBucketTaggingCallable(const Model::DeleteBucketTaggingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteBucketTaggingOutcomeCallable DeleteBucketTaggingCallable(Model::DeleteBucketTaggingRequest&& request) const;
+
+        /**
+         * Same as DeleteBucketTaggingAsync(const Model::DeleteBucketTaggingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteBucketTaggingAsync(Model::DeleteBucketTaggingRequest&& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * This operation removes the website configuration from the bucket.
          */
@@ -606,6 +741,18 @@ namespace Aws
          */
         virtual void DeleteBucketWebsiteAsync(const Model::DeleteBucketWebsiteRequest& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBucketWebsiteCallable(const Model::DeleteBucketWebsiteRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteBucketWebsiteOutcomeCallable DeleteBucketWebsiteCallable(Model::DeleteBucketWebsiteRequest&& request) const;
+
+        /**
+         * Same as DeleteBucketWebsiteAsync(const Model::DeleteBucketWebsiteRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteBucketWebsiteAsync(Model::DeleteBucketWebsiteRequest&& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Removes the null version (if there is one) of an object and inserts a delete
          * marker, which becomes the latest version of the object. If there isn't a null
@@ -631,6 +778,18 @@ namespace Aws
          */
         virtual void DeleteObjectAsync(const Model::DeleteObjectRequest& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteObjectCallable(const Model::DeleteObjectRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteObjectOutcomeCallable DeleteObjectCallable(Model::DeleteObjectRequest&& request) const;
+
+        /**
+         * Same as DeleteObjectAsync(const Model::DeleteObjectRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteObjectAsync(Model::DeleteObjectRequest&& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * This operation enables you to delete multiple objects from a bucket using a
          * single HTTP request. You may specify up to 1000 keys.
@@ -653,6 +812,18 @@ namespace Aws
          */
         virtual void DeleteObjectsAsync(const Model::DeleteObjectsRequest& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteObjectsCallable(const Model::DeleteObjectsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteObjectsOutcomeCallable DeleteObjectsCallable(Model::DeleteObjectsRequest&& request) const;
+
+        /**
+         * Same as DeleteObjectsAsync(const Model::DeleteObjectsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteObjectsAsync(Model::DeleteObjectsRequest&& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the accelerate configuration of a bucket.
          */
@@ -672,6 +843,18 @@ namespace Aws
          */
         virtual void GetBucketAccelerateConfigurationAsync(const Model::GetBucketAccelerateConfigurationRequest& request, const GetBucketAccelerateConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketAccelerateConfigurationCallable(const Model::GetBucketAccelerateConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBucketAccelerateConfigurationOutcomeCallable GetBucketAccelerateConfigurationCallable(Model::GetBucketAccelerateConfigurationRequest&& request) const;
+
+        /**
+         * Same as GetBucketAccelerateConfigurationAsync(const Model::GetBucketAccelerateConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBucketAccelerateConfigurationAsync(Model::GetBucketAccelerateConfigurationRequest&& request, const GetBucketAccelerateConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Gets the access control policy for the bucket.
          */
@@ -691,6 +874,18 @@ namespace Aws
          */
         virtual void GetBucketAclAsync(const Model::GetBucketAclRequest& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketAclCallable(const Model::GetBucketAclRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBucketAclOutcomeCallable GetBucketAclCallable(Model::GetBucketAclRequest&& request) const;
+
+        /**
+         * Same as GetBucketAclAsync(const Model::GetBucketAclRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBucketAclAsync(Model::GetBucketAclRequest&& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the cors configuration for the bucket.
          */
@@ -710,6 +905,18 @@ namespace Aws
          */
         virtual void GetBucketCorsAsync(const Model::GetBucketCorsRequest& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketCorsCallable(const Model::GetBucketCorsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBucketCorsOutcomeCallable GetBucketCorsCallable(Model::GetBucketCorsRequest&& request) const;
+
+        /**
+         * Same as GetBucketCorsAsync(const Model::GetBucketCorsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBucketCorsAsync(Model::GetBucketCorsRequest&& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the lifecycle configuration information set on the bucket.
          */
@@ -729,6 +936,18 @@ namespace Aws
          */
         virtual void GetBucketLifecycleConfigurationAsync(const Model::GetBucketLifecycleConfigurationRequest& request, const GetBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketLifecycleConfigurationCallable(const Model::GetBucketLifecycleConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBucketLifecycleConfigurationOutcomeCallable GetBucketLifecycleConfigurationCallable(Model::GetBucketLifecycleConfigurationRequest&& request) const;
+
+        /**
+         * Same as GetBucketLifecycleConfigurationAsync(const Model::GetBucketLifecycleConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBucketLifecycleConfigurationAsync(Model::GetBucketLifecycleConfigurationRequest&& request, const GetBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the region the bucket resides in.
          */
@@ -748,6 +967,18 @@ namespace Aws
          */
         virtual void GetBucketLocationAsync(const Model::GetBucketLocationRequest& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketLocationCallable(const Model::GetBucketLocationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBucketLocationOutcomeCallable GetBucketLocationCallable(Model::GetBucketLocationRequest&& request) const;
+
+        /**
+         * Same as GetBucketLocationAsync(const Model::GetBucketLocationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBucketLocationAsync(Model::GetBucketLocationRequest&& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the logging status of a bucket and the permissions users have to view
          * and modify that status. To use GET, you must be the bucket owner.
@@ -770,6 +1001,18 @@ namespace Aws
          */
         virtual void GetBucketLoggingAsync(const Model::GetBucketLoggingRequest& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketLoggingCallable(const Model::GetBucketLoggingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBucketLoggingOutcomeCallable GetBucketLoggingCallable(Model::GetBucketLoggingRequest&& request) const;
+
+        /**
+         * Same as GetBucketLoggingAsync(const Model::GetBucketLoggingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBucketLoggingAsync(Model::GetBucketLoggingRequest&& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the notification configuration of a bucket.
          */
@@ -789,6 +1032,18 @@ namespace Aws
          */
         virtual void GetBucketNotificationConfigurationAsync(const Model::GetBucketNotificationConfigurationRequest& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketNotificationConfigurationCallable(const Model::GetBucketNotificationConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBucketNotificationConfigurationOutcomeCallable GetBucketNotificationConfigurationCallable(Model::GetBucketNotificationConfigurationRequest&& request) const;
+
+        /**
+         * Same as GetBucketNotificationConfigurationAsync(const Model::GetBucketNotificationConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBucketNotificationConfigurationAsync(Model::GetBucketNotificationConfigurationRequest&& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the policy of a specified bucket.
          */
@@ -808,6 +1063,18 @@ namespace Aws
          */
         virtual void GetBucketPolicyAsync(const Model::GetBucketPolicyRequest& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketPolicyCallable(const Model::GetBucketPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBucketPolicyOutcomeCallable GetBucketPolicyCallable(Model::GetBucketPolicyRequest&& request) const;
+
+        /**
+         * Same as GetBucketPolicyAsync(const Model::GetBucketPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBucketPolicyAsync(Model::GetBucketPolicyRequest&& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the replication configuration of a bucket.
          */
@@ -827,6 +1094,18 @@ namespace Aws
          */
         virtual void GetBucketReplicationAsync(const Model::GetBucketReplicationRequest& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketReplicationCallable(const Model::GetBucketReplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBucketReplicationOutcomeCallable GetBucketReplicationCallable(Model::GetBucketReplicationRequest&& request) const;
+
+        /**
+         * Same as GetBucketReplicationAsync(const Model::GetBucketReplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBucketReplicationAsync(Model::GetBucketReplicationRequest&& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the request payment configuration of a bucket.
          */
@@ -846,6 +1125,18 @@ namespace Aws
          */
         virtual void GetBucketRequestPaymentAsync(const Model::GetBucketRequestPaymentRequest& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketRequestPaymentCallable(const Model::GetBucketRequestPaymentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBucketRequestPaymentOutcomeCallable GetBucketRequestPaymentCallable(Model::GetBucketRequestPaymentRequest&& request) const;
+
+        /**
+         * Same as GetBucketRequestPaymentAsync(const Model::GetBucketRequestPaymentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBucketRequestPaymentAsync(Model::GetBucketRequestPaymentRequest&& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the tag set associated with the bucket.
          */
@@ -865,6 +1156,18 @@ namespace Aws
          */
         virtual void GetBucketTaggingAsync(const Model::GetBucketTaggingRequest& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketTaggingCallable(const Model::GetBucketTaggingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBucketTaggingOutcomeCallable GetBucketTaggingCallable(Model::GetBucketTaggingRequest&& request) const;
+
+        /**
+         * Same as GetBucketTaggingAsync(const Model::GetBucketTaggingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBucketTaggingAsync(Model::GetBucketTaggingRequest&& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the versioning state of a bucket.
          */
@@ -884,6 +1187,18 @@ namespace Aws
          */
         virtual void GetBucketVersioningAsync(const Model::GetBucketVersioningRequest& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketVersioningCallable(const Model::GetBucketVersioningRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBucketVersioningOutcomeCallable GetBucketVersioningCallable(Model::GetBucketVersioningRequest&& request) const;
+
+        /**
+         * Same as GetBucketVersioningAsync(const Model::GetBucketVersioningRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBucketVersioningAsync(Model::GetBucketVersioningRequest&& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the website configuration for a bucket.
          */
@@ -903,6 +1218,18 @@ namespace Aws
          */
         virtual void GetBucketWebsiteAsync(const Model::GetBucketWebsiteRequest& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketWebsiteCallable(const Model::GetBucketWebsiteRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetBucketWebsiteOutcomeCallable GetBucketWebsiteCallable(Model::GetBucketWebsiteRequest&& request) const;
+
+        /**
+         * Same as GetBucketWebsiteAsync(const Model::GetBucketWebsiteRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetBucketWebsiteAsync(Model::GetBucketWebsiteRequest&& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Retrieves objects from Amazon S3.
          */
@@ -922,6 +1249,18 @@ namespace Aws
          */
         virtual void GetObjectAsync(const Model::GetObjectRequest& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetObjectCallable(const Model::GetObjectRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetObjectOutcomeCallable GetObjectCallable(Model::GetObjectRequest&& request) const;
+
+        /**
+         * Same as GetObjectAsync(const Model::GetObjectRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetObjectAsync(Model::GetObjectRequest&& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the access control list (ACL) of an object.
          */
@@ -941,6 +1280,18 @@ namespace Aws
          */
         virtual void GetObjectAclAsync(const Model::GetObjectAclRequest& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetObjectAclCallable(const Model::GetObjectAclRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetObjectAclOutcomeCallable GetObjectAclCallable(Model::GetObjectAclRequest&& request) const;
+
+        /**
+         * Same as GetObjectAclAsync(const Model::GetObjectAclRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetObjectAclAsync(Model::GetObjectAclRequest&& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Return torrent files from a bucket.
          */
@@ -960,6 +1311,18 @@ namespace Aws
          */
         virtual void GetObjectTorrentAsync(const Model::GetObjectTorrentRequest& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetObjectTorrentCallable(const Model::GetObjectTorrentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetObjectTorrentOutcomeCallable GetObjectTorrentCallable(Model::GetObjectTorrentRequest&& request) const;
+
+        /**
+         * Same as GetObjectTorrentAsync(const Model::GetObjectTorrentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetObjectTorrentAsync(Model::GetObjectTorrentRequest&& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * This operation is useful to determine if a bucket exists and you have permission
          * to access it.
@@ -982,6 +1345,18 @@ namespace Aws
          */
         virtual void HeadBucketAsync(const Model::HeadBucketRequest& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as HeadBucketCallable(const Model::HeadBucketRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::HeadBucketOutcomeCallable HeadBucketCallable(Model::HeadBucketRequest&& request) const;
+
+        /**
+         * Same as HeadBucketAsync(const Model::HeadBucketRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void HeadBucketAsync(Model::HeadBucketRequest&& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * The HEAD operation retrieves metadata from an object without returning the
          * object itself. This operation is useful if you're only interested in an object's
@@ -1007,6 +1382,18 @@ namespace Aws
          */
         virtual void HeadObjectAsync(const Model::HeadObjectRequest& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as HeadObjectCallable(const Model::HeadObjectRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::HeadObjectOutcomeCallable HeadObjectCallable(Model::HeadObjectRequest&& request) const;
+
+        /**
+         * Same as HeadObjectAsync(const Model::HeadObjectRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void HeadObjectAsync(Model::HeadObjectRequest&& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns a list of all buckets owned by the authenticated sender of the request.
          */
@@ -1044,6 +1431,18 @@ namespace Aws
          */
         virtual void ListMultipartUploadsAsync(const Model::ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListMultipartUploadsCallable(const Model::ListMultipartUploadsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListMultipartUploadsOutcomeCallable ListMultipartUploadsCallable(Model::ListMultipartUploadsRequest&& request) const;
+
+        /**
+         * Same as ListMultipartUploadsAsync(const Model::ListMultipartUploadsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListMultipartUploadsAsync(Model::ListMultipartUploadsRequest&& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns metadata about all of the versions of objects in a bucket.
          */
@@ -1063,6 +1462,18 @@ namespace Aws
          */
         virtual void ListObjectVersionsAsync(const Model::ListObjectVersionsRequest& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListObjectVersionsCallable(const Model::ListObjectVersionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListObjectVersionsOutcomeCallable ListObjectVersionsCallable(Model::ListObjectVersionsRequest&& request) const;
+
+        /**
+         * Same as ListObjectVersionsAsync(const Model::ListObjectVersionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListObjectVersionsAsync(Model::ListObjectVersionsRequest&& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns some or all (up to 1000) of the objects in a bucket. You can use the
          * request parameters as selection criteria to return a subset of the objects in a
@@ -1088,6 +1499,18 @@ namespace Aws
          */
         virtual void ListObjectsAsync(const Model::ListObjectsRequest& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListObjectsCallable(const Model::ListObjectsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListObjectsOutcomeCallable ListObjectsCallable(Model::ListObjectsRequest&& request) const;
+
+        /**
+         * Same as ListObjectsAsync(const Model::ListObjectsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListObjectsAsync(Model::ListObjectsRequest&& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns some or all (up to 1000) of the objects in a bucket. You can use the
          * request parameters as selection criteria to return a subset of the objects in a
@@ -1116,6 +1539,18 @@ namespace Aws
          */
         virtual void ListObjectsV2Async(const Model::ListObjectsV2Request& request, const ListObjectsV2ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListObjectsV2Callable(const Model::ListObjectsV2Request&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListObjectsV2OutcomeCallable ListObjectsV2Callable(Model::ListObjectsV2Request&& request) const;
+
+        /**
+         * Same as ListObjectsV2Async(const Model::ListObjectsV2Request&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListObjectsV2Async(Model::ListObjectsV2Request&& request, const ListObjectsV2ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Lists the parts that have been uploaded for a specific multipart upload.
          */
@@ -1135,6 +1570,18 @@ namespace Aws
          */
         virtual void ListPartsAsync(const Model::ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPartsCallable(const Model::ListPartsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListPartsOutcomeCallable ListPartsCallable(Model::ListPartsRequest&& request) const;
+
+        /**
+         * Same as ListPartsAsync(const Model::ListPartsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPartsAsync(Model::ListPartsRequest&& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Sets the accelerate configuration of an existing bucket.
          */
@@ -1154,6 +1601,18 @@ namespace Aws
          */
         virtual void PutBucketAccelerateConfigurationAsync(const Model::PutBucketAccelerateConfigurationRequest& request, const PutBucketAccelerateConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketAccelerateConfigurationCallable(const Model::PutBucketAccelerateConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutBucketAccelerateConfigurationOutcomeCallable PutBucketAccelerateConfigurationCallable(Model::PutBucketAccelerateConfigurationRequest&& request) const;
+
+        /**
+         * Same as PutBucketAccelerateConfigurationAsync(const Model::PutBucketAccelerateConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutBucketAccelerateConfigurationAsync(Model::PutBucketAccelerateConfigurationRequest&& request, const PutBucketAccelerateConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Sets the permissions on a bucket using access control lists (ACL).
          */
@@ -1173,6 +1632,18 @@ namespace Aws
          */
         virtual void PutBucketAclAsync(const Model::PutBucketAclRequest& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketAclCallable(const Model::PutBucketAclRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutBucketAclOutcomeCallable PutBucketAclCallable(Model::PutBucketAclRequest&& request) const;
+
+        /**
+         * Same as PutBucketAclAsync(const Model::PutBucketAclRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutBucketAclAsync(Model::PutBucketAclRequest&& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Sets the cors configuration for a bucket.
          */
@@ -1192,6 +1663,18 @@ namespace Aws
          */
         virtual void PutBucketCorsAsync(const Model::PutBucketCorsRequest& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketCorsCallable(const Model::PutBucketCorsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutBucketCorsOutcomeCallable PutBucketCorsCallable(Model::PutBucketCorsRequest&& request) const;
+
+        /**
+         * Same as PutBucketCorsAsync(const Model::PutBucketCorsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutBucketCorsAsync(Model::PutBucketCorsRequest&& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Sets lifecycle configuration for your bucket. If a lifecycle configuration
          * exists, it replaces it.
@@ -1214,6 +1697,18 @@ namespace Aws
          */
         virtual void PutBucketLifecycleConfigurationAsync(const Model::PutBucketLifecycleConfigurationRequest& request, const PutBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketLifecycleConfigurationCallable(const Model::PutBucketLifecycleConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutBucketLifecycleConfigurationOutcomeCallable PutBucketLifecycleConfigurationCallable(Model::PutBucketLifecycleConfigurationRequest&& request) const;
+
+        /**
+         * Same as PutBucketLifecycleConfigurationAsync(const Model::PutBucketLifecycleConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutBucketLifecycleConfigurationAsync(Model::PutBucketLifecycleConfigurationRequest&& request, const PutBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Set the logging parameters for a bucket and to specify permissions for who can
          * view and modify the logging parameters. To set the logging status of a bucket,
@@ -1239,6 +1734,18 @@ namespace Aws
          */
         virtual void PutBucketLoggingAsync(const Model::PutBucketLoggingRequest& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketLoggingCallable(const Model::PutBucketLoggingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutBucketLoggingOutcomeCallable PutBucketLoggingCallable(Model::PutBucketLoggingRequest&& request) const;
+
+        /**
+         * Same as PutBucketLoggingAsync(const Model::PutBucketLoggingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutBucketLoggingAsync(Model::PutBucketLoggingRequest&& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Enables notifications of specified events for a bucket.
          */
@@ -1258,6 +1765,18 @@ namespace Aws
          */
         virtual void PutBucketNotificationConfigurationAsync(const Model::PutBucketNotificationConfigurationRequest& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketNotificationConfigurationCallable(const Model::PutBucketNotificationConfigurationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutBucketNotificationConfigurationOutcomeCallable PutBucketNotificationConfigurationCallable(Model::PutBucketNotificationConfigurationRequest&& request) const;
+
+        /**
+         * Same as PutBucketNotificationConfigurationAsync(const Model::PutBucketNotificationConfigurationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutBucketNotificationConfigurationAsync(Model::PutBucketNotificationConfigurationRequest&& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Replaces a policy on a bucket. If the bucket already has a policy, the one in
          * this request completely replaces it.
@@ -1280,6 +1799,18 @@ namespace Aws
          */
         virtual void PutBucketPolicyAsync(const Model::PutBucketPolicyRequest& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketPolicyCallable(const Model::PutBucketPolicyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutBucketPolicyOutcomeCallable PutBucketPolicyCallable(Model::PutBucketPolicyRequest&& request) const;
+
+        /**
+         * Same as PutBucketPolicyAsync(const Model::PutBucketPolicyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutBucketPolicyAsync(Model::PutBucketPolicyRequest&& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Creates a new replication configuration (or replaces an existing one, if
          * present).
@@ -1302,6 +1833,18 @@ namespace Aws
          */
         virtual void PutBucketReplicationAsync(const Model::PutBucketReplicationRequest& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketReplicationCallable(const Model::PutBucketReplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutBucketReplicationOutcomeCallable PutBucketReplicationCallable(Model::PutBucketReplicationRequest&& request) const;
+
+        /**
+         * Same as PutBucketReplicationAsync(const Model::PutBucketReplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutBucketReplicationAsync(Model::PutBucketReplicationRequest&& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Sets the request payment configuration for a bucket. By default, the bucket
          * owner pays for downloads from the bucket. This configuration parameter enables
@@ -1336,6 +1879,18 @@ namespace Aws
          */
         virtual void PutBucketRequestPaymentAsync(const Model::PutBucketRequestPaymentRequest& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketRequestPaymentCallable(const Model::PutBucketRequestPaymentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutBucketRequestPaymentOutcomeCallable PutBucketRequestPaymentCallable(Model::PutBucketRequestPaymentRequest&& request) const;
+
+        /**
+         * Same as PutBucketRequestPaymentAsync(const Model::PutBucketRequestPaymentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutBucketRequestPaymentAsync(Model::PutBucketRequestPaymentRequest&& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Sets the tags for a bucket.
          */
@@ -1355,6 +1910,18 @@ namespace Aws
          */
         virtual void PutBucketTaggingAsync(const Model::PutBucketTaggingRequest& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketTaggingCallable(const Model::PutBucketTaggingRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutBucketTaggingOutcomeCallable PutBucketTaggingCallable(Model::PutBucketTaggingRequest&& request) const;
+
+        /**
+         * Same as PutBucketTaggingAsync(const Model::PutBucketTaggingRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutBucketTaggingAsync(Model::PutBucketTaggingRequest&& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Sets the versioning state of an existing bucket. To set the versioning state,
          * you must be the bucket owner.
@@ -1377,6 +1944,18 @@ namespace Aws
          */
         virtual void PutBucketVersioningAsync(const Model::PutBucketVersioningRequest& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketVersioningCallable(const Model::PutBucketVersioningRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutBucketVersioningOutcomeCallable PutBucketVersioningCallable(Model::PutBucketVersioningRequest&& request) const;
+
+        /**
+         * Same as PutBucketVersioningAsync(const Model::PutBucketVersioningRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutBucketVersioningAsync(Model::PutBucketVersioningRequest&& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Set the website configuration for a bucket.
          */
@@ -1396,6 +1975,18 @@ namespace Aws
          */
         virtual void PutBucketWebsiteAsync(const Model::PutBucketWebsiteRequest& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketWebsiteCallable(const Model::PutBucketWebsiteRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutBucketWebsiteOutcomeCallable PutBucketWebsiteCallable(Model::PutBucketWebsiteRequest&& request) const;
+
+        /**
+         * Same as PutBucketWebsiteAsync(const Model::PutBucketWebsiteRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutBucketWebsiteAsync(Model::PutBucketWebsiteRequest&& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Adds an object to a bucket.
          */
@@ -1415,6 +2006,18 @@ namespace Aws
          */
         virtual void PutObjectAsync(const Model::PutObjectRequest& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutObjectCallable(const Model::PutObjectRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutObjectOutcomeCallable PutObjectCallable(Model::PutObjectRequest&& request) const;
+
+        /**
+         * Same as PutObjectAsync(const Model::PutObjectRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutObjectAsync(Model::PutObjectRequest&& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * uses the acl subresource to set the access control list (ACL) permissions for an
          * object that already exists in a bucket
@@ -1437,6 +2040,18 @@ namespace Aws
          */
         virtual void PutObjectAclAsync(const Model::PutObjectAclRequest& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutObjectAclCallable(const Model::PutObjectAclRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutObjectAclOutcomeCallable PutObjectAclCallable(Model::PutObjectAclRequest&& request) const;
+
+        /**
+         * Same as PutObjectAclAsync(const Model::PutObjectAclRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutObjectAclAsync(Model::PutObjectAclRequest&& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Restores an archived copy of an object back into Amazon S3
          */
@@ -1456,6 +2071,18 @@ namespace Aws
          */
         virtual void RestoreObjectAsync(const Model::RestoreObjectRequest& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreObjectCallable(const Model::RestoreObjectRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RestoreObjectOutcomeCallable RestoreObjectCallable(Model::RestoreObjectRequest&& request) const;
+
+        /**
+         * Same as RestoreObjectAsync(const Model::RestoreObjectRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RestoreObjectAsync(Model::RestoreObjectRequest&& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Uploads a part in a multipart upload.</p><p><b>Note:</b> After you initiate
          * multipart upload and upload one or more parts, you must either complete or abort
@@ -1487,6 +2114,18 @@ namespace Aws
          */
         virtual void UploadPartAsync(const Model::UploadPartRequest& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadPartCallable(const Model::UploadPartRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UploadPartOutcomeCallable UploadPartCallable(Model::UploadPartRequest&& request) const;
+
+        /**
+         * Same as UploadPartAsync(const Model::UploadPartRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UploadPartAsync(Model::UploadPartRequest&& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Uploads a part by copying data from an existing object as data source.
          */
@@ -1506,8 +2145,307 @@ namespace Aws
          */
         virtual void UploadPartCopyAsync(const Model::UploadPartCopyRequest& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadPartCopyCallable(const Model::UploadPartCopyRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UploadPartCopyOutcomeCallable UploadPartCopyCallable(Model::UploadPartCopyRequest&& request) const;
+
+        /**
+         * Same as UploadPartCopyAsync(const Model::UploadPartCopyRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UploadPartCopyAsync(Model::UploadPartCopyRequest&& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
 
         Aws::String GeneratePresignedUrl(const Aws::String& bucketName, const Aws::String& key, Http::HttpMethod method, long long expirationInSeconds = MAX_EXPIRATION_SECONDS);
+        /**
+         * Pages through ListObjects(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<S3Client, Model::ListObjectsRequest, Model::ListObjectsOutcome> ListObjectsPaginator(const Model::ListObjectsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListObjectsV2(), following NextContinuationToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<S3Client, Model::ListObjectsV2Request, Model::ListObjectsV2Outcome> ListObjectsV2Paginator(const Model::ListObjectsV2Request& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AbortMultipartUpload(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::AbortMultipartUploadRequest, Model::AbortMultipartUploadOutcome> AbortMultipartUploadAwaitable(Model::AbortMultipartUploadRequest request) const;
+
+        /**
+         * co_await-able form of CompleteMultipartUpload(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::CompleteMultipartUploadRequest, Model::CompleteMultipartUploadOutcome> CompleteMultipartUploadAwaitable(Model::CompleteMultipartUploadRequest request) const;
+
+        /**
+         * co_await-able form of CopyObject(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::CopyObjectRequest, Model::CopyObjectOutcome> CopyObjectAwaitable(Model::CopyObjectRequest request) const;
+
+        /**
+         * co_await-able form of CreateBucket(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::CreateBucketRequest, Model::CreateBucketOutcome> CreateBucketAwaitable(Model::CreateBucketRequest request) const;
+
+        /**
+         * co_await-able form of CreateMultipartUpload(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::CreateMultipartUploadRequest, Model::CreateMultipartUploadOutcome> CreateMultipartUploadAwaitable(Model::CreateMultipartUploadRequest request) const;
+
+        /**
+         * co_await-able form of DeleteBucket(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::DeleteBucketRequest, Model::DeleteBucketOutcome> DeleteBucketAwaitable(Model::DeleteBucketRequest request) const;
+
+        /**
+         * co_await-able form of DeleteBucketCors(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::DeleteBucketCorsRequest, Model::DeleteBucketCorsOutcome> DeleteBucketCorsAwaitable(Model::DeleteBucketCorsRequest request) const;
+
+        /**
+         * co_await-able form of DeleteBucketLifecycle(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::DeleteBucketLifecycleRequest, Model::DeleteBucketLifecycleOutcome> DeleteBucketLifecycleAwaitable(Model::DeleteBucketLifecycleRequest request) const;
+
+        /**
+         * co_await-able form of DeleteBucketPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::DeleteBucketPolicyRequest, Model::DeleteBucketPolicyOutcome> DeleteBucketPolicyAwaitable(Model::DeleteBucketPolicyRequest request) const;
+
+        /**
+         * co_await-able form of DeleteBucketReplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::DeleteBucketReplicationRequest, Model::DeleteBucketReplicationOutcome> DeleteBucketReplicationAwaitable(Model::DeleteBucketReplicationRequest request) const;
+
+        /**
+         * co_await-able form of DeleteBucketTagging(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::DeleteBucketTaggingRequest, Model::DeleteBucketTaggingOutcome> DeleteBucketTaggingAwaitable(Model::DeleteBucketTaggingRequest request) const;
+
+        /**
+         * co_await-able form of DeleteBucketWebsite(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::DeleteBucketWebsiteRequest, Model::DeleteBucketWebsiteOutcome> DeleteBucketWebsiteAwaitable(Model::DeleteBucketWebsiteRequest request) const;
+
+        /**
+         * co_await-able form of DeleteObject(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::DeleteObjectRequest, Model::DeleteObjectOutcome> DeleteObjectAwaitable(Model::DeleteObjectRequest request) const;
+
+        /**
+         * co_await-able form of DeleteObjects(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::DeleteObjectsRequest, Model::DeleteObjectsOutcome> DeleteObjectsAwaitable(Model::DeleteObjectsRequest request) const;
+
+        /**
+         * co_await-able form of GetBucketAccelerateConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetBucketAccelerateConfigurationRequest, Model::GetBucketAccelerateConfigurationOutcome> GetBucketAccelerateConfigurationAwaitable(Model::GetBucketAccelerateConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of GetBucketAcl(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetBucketAclRequest, Model::GetBucketAclOutcome> GetBucketAclAwaitable(Model::GetBucketAclRequest request) const;
+
+        /**
+         * co_await-able form of GetBucketCors(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetBucketCorsRequest, Model::GetBucketCorsOutcome> GetBucketCorsAwaitable(Model::GetBucketCorsRequest request) const;
+
+        /**
+         * co_await-able form of GetBucketLifecycleConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetBucketLifecycleConfigurationRequest, Model::GetBucketLifecycleConfigurationOutcome> GetBucketLifecycleConfigurationAwaitable(Model::GetBucketLifecycleConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of GetBucketLocation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetBucketLocationRequest, Model::GetBucketLocationOutcome> GetBucketLocationAwaitable(Model::GetBucketLocationRequest request) const;
+
+        /**
+         * co_await-able form of GetBucketLogging(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetBucketLoggingRequest, Model::GetBucketLoggingOutcome> GetBucketLoggingAwaitable(Model::GetBucketLoggingRequest request) const;
+
+        /**
+         * co_await-able form of GetBucketNotificationConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetBucketNotificationConfigurationRequest, Model::GetBucketNotificationConfigurationOutcome> GetBucketNotificationConfigurationAwaitable(Model::GetBucketNotificationConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of GetBucketPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetBucketPolicyRequest, Model::GetBucketPolicyOutcome> GetBucketPolicyAwaitable(Model::GetBucketPolicyRequest request) const;
+
+        /**
+         * co_await-able form of GetBucketReplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetBucketReplicationRequest, Model::GetBucketReplicationOutcome> GetBucketReplicationAwaitable(Model::GetBucketReplicationRequest request) const;
+
+        /**
+         * co_await-able form of GetBucketRequestPayment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetBucketRequestPaymentRequest, Model::GetBucketRequestPaymentOutcome> GetBucketRequestPaymentAwaitable(Model::GetBucketRequestPaymentRequest request) const;
+
+        /**
+         * co_await-able form of GetBucketTagging(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetBucketTaggingRequest, Model::GetBucketTaggingOutcome> GetBucketTaggingAwaitable(Model::GetBucketTaggingRequest request) const;
+
+        /**
+         * co_await-able form of GetBucketVersioning(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetBucketVersioningRequest, Model::GetBucketVersioningOutcome> GetBucketVersioningAwaitable(Model::GetBucketVersioningRequest request) const;
+
+        /**
+         * co_await-able form of GetBucketWebsite(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetBucketWebsiteRequest, Model::GetBucketWebsiteOutcome> GetBucketWebsiteAwaitable(Model::GetBucketWebsiteRequest request) const;
+
+        /**
+         * co_await-able form of GetObject(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetObjectRequest, Model::GetObjectOutcome> GetObjectAwaitable(Model::GetObjectRequest request) const;
+
+        /**
+         * co_await-able form of GetObjectAcl(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetObjectAclRequest, Model::GetObjectAclOutcome> GetObjectAclAwaitable(Model::GetObjectAclRequest request) const;
+
+        /**
+         * co_await-able form of GetObjectTorrent(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::GetObjectTorrentRequest, Model::GetObjectTorrentOutcome> GetObjectTorrentAwaitable(Model::GetObjectTorrentRequest request) const;
+
+        /**
+         * co_await-able form of HeadBucket(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::HeadBucketRequest, Model::HeadBucketOutcome> HeadBucketAwaitable(Model::HeadBucketRequest request) const;
+
+        /**
+         * co_await-able form of HeadObject(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::HeadObjectRequest, Model::HeadObjectOutcome> HeadObjectAwaitable(Model::HeadObjectRequest request) const;
+
+        /**
+         * co_await-able form of ListBuckets(): the operation runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, void, Model::ListBucketsOutcome> ListBucketsAwaitable() const;
+
+        /**
+         * co_await-able form of ListMultipartUploads(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::ListMultipartUploadsRequest, Model::ListMultipartUploadsOutcome> ListMultipartUploadsAwaitable(Model::ListMultipartUploadsRequest request) const;
+
+        /**
+         * co_await-able form of ListObjectVersions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::ListObjectVersionsRequest, Model::ListObjectVersionsOutcome> ListObjectVersionsAwaitable(Model::ListObjectVersionsRequest request) const;
+
+        /**
+         * co_await-able form of ListObjects(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::ListObjectsRequest, Model::ListObjectsOutcome> ListObjectsAwaitable(Model::ListObjectsRequest request) const;
+
+        /**
+         * co_await-able form of ListObjectsV2(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::ListObjectsV2Request, Model::ListObjectsV2Outcome> ListObjectsV2Awaitable(Model::ListObjectsV2Request request) const;
+
+        /**
+         * co_await-able form of ListParts(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::ListPartsRequest, Model::ListPartsOutcome> ListPartsAwaitable(Model::ListPartsRequest request) const;
+
+        /**
+         * co_await-able form of PutBucketAccelerateConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::PutBucketAccelerateConfigurationRequest, Model::PutBucketAccelerateConfigurationOutcome> PutBucketAccelerateConfigurationAwaitable(Model::PutBucketAccelerateConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of PutBucketAcl(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::PutBucketAclRequest, Model::PutBucketAclOutcome> PutBucketAclAwaitable(Model::PutBucketAclRequest request) const;
+
+        /**
+         * co_await-able form of PutBucketCors(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::PutBucketCorsRequest, Model::PutBucketCorsOutcome> PutBucketCorsAwaitable(Model::PutBucketCorsRequest request) const;
+
+        /**
+         * co_await-able form of PutBucketLifecycleConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::PutBucketLifecycleConfigurationRequest, Model::PutBucketLifecycleConfigurationOutcome> PutBucketLifecycleConfigurationAwaitable(Model::PutBucketLifecycleConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of PutBucketLogging(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::PutBucketLoggingRequest, Model::PutBucketLoggingOutcome> PutBucketLoggingAwaitable(Model::PutBucketLoggingRequest request) const;
+
+        /**
+         * co_await-able form of PutBucketNotificationConfiguration(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::PutBucketNotificationConfigurationRequest, Model::PutBucketNotificationConfigurationOutcome> PutBucketNotificationConfigurationAwaitable(Model::PutBucketNotificationConfigurationRequest request) const;
+
+        /**
+         * co_await-able form of PutBucketPolicy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::PutBucketPolicyRequest, Model::PutBucketPolicyOutcome> PutBucketPolicyAwaitable(Model::PutBucketPolicyRequest request) const;
+
+        /**
+         * co_await-able form of PutBucketReplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::PutBucketReplicationRequest, Model::PutBucketReplicationOutcome> PutBucketReplicationAwaitable(Model::PutBucketReplicationRequest request) const;
+
+        /**
+         * co_await-able form of PutBucketRequestPayment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::PutBucketRequestPaymentRequest, Model::PutBucketRequestPaymentOutcome> PutBucketRequestPaymentAwaitable(Model::PutBucketRequestPaymentRequest request) const;
+
+        /**
+         * co_await-able form of PutBucketTagging(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::PutBucketTaggingRequest, Model::PutBucketTaggingOutcome> PutBucketTaggingAwaitable(Model::PutBucketTaggingRequest request) const;
+
+        /**
+         * co_await-able form of PutBucketVersioning(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::PutBucketVersioningRequest, Model::PutBucketVersioningOutcome> PutBucketVersioningAwaitable(Model::PutBucketVersioningRequest request) const;
+
+        /**
+         * co_await-able form of PutBucketWebsite(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::PutBucketWebsiteRequest, Model::PutBucketWebsiteOutcome> PutBucketWebsiteAwaitable(Model::PutBucketWebsiteRequest request) const;
+
+        /**
+         * co_await-able form of PutObject(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::PutObjectRequest, Model::PutObjectOutcome> PutObjectAwaitable(Model::PutObjectRequest request) const;
+
+        /**
+         * co_await-able form of PutObjectAcl(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::PutObjectAclRequest, Model::PutObjectAclOutcome> PutObjectAclAwaitable(Model::PutObjectAclRequest request) const;
+
+        /**
+         * co_await-able form of RestoreObject(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::RestoreObjectRequest, Model::RestoreObjectOutcome> RestoreObjectAwaitable(Model::RestoreObjectRequest request) const;
+
+        /**
+         * co_await-able form of UploadPart(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::UploadPartRequest, Model::UploadPartOutcome> UploadPartAwaitable(Model::UploadPartRequest request) const;
+
+        /**
+         * co_await-able form of UploadPartCopy(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<S3Client, Model::UploadPartCopyRequest, Model::UploadPartCopyOutcome> UploadPartCopyAwaitable(Model::UploadPartCopyRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
 
     private:
         void init(const Client::ClientConfiguration& clientConfiguration);
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     AbortMultipartUploadRequest();
+    inline const char* GetServiceRequestName() const override { return "AbortMultipartUpload"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     CompleteMultipartUploadRequest();
+    inline const char* GetServiceRequestName() const override { return "CompleteMultipartUpload"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     CopyObjectRequest();
+    inline const char* GetServiceRequestName() const override { return "CopyObject"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
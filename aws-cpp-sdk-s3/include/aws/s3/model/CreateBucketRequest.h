@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateBucketRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateBucket"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     CreateMultipartUploadRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateMultipartUpload"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteBucketCorsRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteBucketCors"; }
+
     Aws::String SerializePayload() const override;
 
     
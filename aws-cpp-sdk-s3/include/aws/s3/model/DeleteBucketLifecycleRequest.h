@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteBucketLifecycleRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteBucketLifecycle"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteBucketPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteBucketPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     
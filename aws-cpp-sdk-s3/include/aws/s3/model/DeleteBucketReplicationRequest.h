@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteBucketReplicationRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteBucketReplication"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteBucketRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteBucket"; }
+
     Aws::String SerializePayload() const override;
 
     
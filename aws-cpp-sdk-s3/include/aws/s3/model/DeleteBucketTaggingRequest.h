@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteBucketTaggingRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteBucketTagging"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteBucketWebsiteRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteBucketWebsite"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteObjectsRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteObjects"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetBucketAccelerateConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBucketAccelerateConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
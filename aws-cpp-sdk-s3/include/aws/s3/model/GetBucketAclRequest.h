@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetBucketAclRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBucketAcl"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetBucketCorsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBucketCors"; }
+
     Aws::String SerializePayload() const override;
 
     
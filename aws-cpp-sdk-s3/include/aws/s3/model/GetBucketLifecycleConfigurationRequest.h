@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetBucketLifecycleConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBucketLifecycleConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     
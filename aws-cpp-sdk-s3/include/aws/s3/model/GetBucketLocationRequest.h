@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetBucketLocationRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBucketLocation"; }
+
     Aws::String SerializePayload() const override;
 
     
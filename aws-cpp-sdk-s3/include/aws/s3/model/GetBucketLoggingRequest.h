@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetBucketLoggingRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBucketLogging"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetBucketNotificationConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBucketNotificationConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
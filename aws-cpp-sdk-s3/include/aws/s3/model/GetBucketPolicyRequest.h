@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetBucketPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBucketPolicy"; }
+
     Aws::String SerializePayload() const override;
 
     
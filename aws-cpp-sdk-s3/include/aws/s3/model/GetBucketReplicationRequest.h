@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetBucketReplicationRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBucketReplication"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetBucketRequestPaymentRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBucketRequestPayment"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetBucketTaggingRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBucketTagging"; }
+
     Aws::String SerializePayload() const override;
 
     
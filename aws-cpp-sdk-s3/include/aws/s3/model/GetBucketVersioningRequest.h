@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetBucketVersioningRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBucketVersioning"; }
+
     Aws::String SerializePayload() const override;
 
     
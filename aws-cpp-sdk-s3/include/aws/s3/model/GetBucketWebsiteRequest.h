@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetBucketWebsiteRequest();
+    inline const char* GetServiceRequestName() const override { return "GetBucketWebsite"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     GetObjectAclRequest();
+    inline const char* GetServiceRequestName() const override { return "GetObjectAcl"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
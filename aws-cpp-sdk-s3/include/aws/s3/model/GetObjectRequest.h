@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     GetObjectRequest();
+    inline const char* GetServiceRequestName() const override { return "GetObject"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
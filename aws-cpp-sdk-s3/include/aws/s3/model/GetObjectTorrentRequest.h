@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetObjectTorrentRequest();
+    inline const char* GetServiceRequestName() const override { return "GetObjectTorrent"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
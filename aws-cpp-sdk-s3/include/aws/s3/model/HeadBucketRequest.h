@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     HeadBucketRequest();
+    inline const char* GetServiceRequestName() const override { return "HeadBucket"; }
+
     Aws::String SerializePayload() const override;
 
     
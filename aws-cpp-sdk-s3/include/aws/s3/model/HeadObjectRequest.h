@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     HeadObjectRequest();
+    inline const char* GetServiceRequestName() const override { return "HeadObject"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListMultipartUploadsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListMultipartUploads"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListObjectVersionsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListObjectVersions"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
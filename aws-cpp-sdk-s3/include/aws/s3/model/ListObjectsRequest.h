@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListObjectsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListObjects"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
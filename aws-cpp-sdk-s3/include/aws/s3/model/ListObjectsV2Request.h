@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListObjectsV2Request();
+    inline const char* GetServiceRequestName() const override { return "ListObjectsV2"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
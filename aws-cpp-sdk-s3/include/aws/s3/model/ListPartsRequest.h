@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListPartsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListParts"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PutBucketAccelerateConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "PutBucketAccelerateConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     PutBucketAclRequest();
+    inline const char* GetServiceRequestName() const override { return "PutBucketAcl"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PutBucketCorsRequest();
+    inline const char* GetServiceRequestName() const override { return "PutBucketCors"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
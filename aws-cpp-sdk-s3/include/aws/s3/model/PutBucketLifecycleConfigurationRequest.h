@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PutBucketLifecycleConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "PutBucketLifecycleConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     inline bool ShouldComputeContentMd5() const override { return true; }
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PutBucketLoggingRequest();
+    inline const char* GetServiceRequestName() const override { return "PutBucketLogging"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PutBucketNotificationConfigurationRequest();
+    inline const char* GetServiceRequestName() const override { return "PutBucketNotificationConfiguration"; }
+
     Aws::String SerializePayload() const override;
 
     
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     PutBucketPolicyRequest();
+    inline const char* GetServiceRequestName() const override { return "PutBucketPolicy"; }
+
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
 
     inline bool ShouldComputeContentMd5() const override { return true; }
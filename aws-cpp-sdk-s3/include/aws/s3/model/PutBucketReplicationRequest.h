@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PutBucketReplicationRequest();
+    inline const char* GetServiceRequestName() const override { return "PutBucketReplication"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PutBucketRequestPaymentRequest();
+    inline const char* GetServiceRequestName() const override { return "PutBucketRequestPayment"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
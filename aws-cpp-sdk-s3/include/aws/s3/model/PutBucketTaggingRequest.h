@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PutBucketTaggingRequest();
+    inline const char* GetServiceRequestName() const override { return "PutBucketTagging"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
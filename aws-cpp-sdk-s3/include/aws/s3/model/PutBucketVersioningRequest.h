@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PutBucketVersioningRequest();
+    inline const char* GetServiceRequestName() const override { return "PutBucketVersioning"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PutBucketWebsiteRequest();
+    inline const char* GetServiceRequestName() const override { return "PutBucketWebsite"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     PutObjectAclRequest();
+    inline const char* GetServiceRequestName() const override { return "PutObjectAcl"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
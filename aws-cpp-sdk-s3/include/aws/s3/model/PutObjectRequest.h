@@ -37,6 +37,8 @@ namespace Model
   {
   public:
     PutObjectRequest();
+    inline const char* GetServiceRequestName() const override { return "PutObject"; }
+
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
 
     /**
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     RestoreObjectRequest();
+    inline const char* GetServiceRequestName() const override { return "RestoreObject"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     UploadPartCopyRequest();
+    inline const char* GetServiceRequestName() const override { return "UploadPartCopy"; }
+
     Aws::String SerializePayload() const override;
 
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     UploadPartRequest();
+    inline const char* GetServiceRequestName() const override { return "UploadPart"; }
+
     void AddQueryStringParameters(Aws::Http::URI& uri) const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -166,7 +166,7 @@ AbortMultipartUploadOutcome S3Client::AbortMultipartUpload(const AbortMultipartU
 
 AbortMultipartUploadOutcomeCallable S3Client::AbortMultipartUploadCallable(const AbortMultipartUploadRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AbortMultipartUpload( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AbortMultipartUpload( request ); } );
 }
 
 void S3Client::AbortMultipartUploadAsync(const AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -174,6 +174,16 @@ void S3Client::AbortMultipartUploadAsync(const AbortMultipartUploadRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->AbortMultipartUploadAsyncHelper( request, handler, context ); } );
 }
 
+AbortMultipartUploadOutcomeCallable S3Client::AbortMultipartUploadCallable(AbortMultipartUploadRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::AbortMultipartUpload, this, std::move(request)));
+}
+
+void S3Client::AbortMultipartUploadAsync(AbortMultipartUploadRequest&& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::AbortMultipartUploadAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::AbortMultipartUploadAsyncHelper(const AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AbortMultipartUpload(request), context);
@@ -199,7 +209,7 @@ CompleteMultipartUploadOutcome S3Client::CompleteMultipartUpload(const CompleteM
 
 CompleteMultipartUploadOutcomeCallable S3Client::CompleteMultipartUploadCallable(const CompleteMultipartUploadRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CompleteMultipartUpload( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CompleteMultipartUpload( request ); } );
 }
 
 void S3Client::CompleteMultipartUploadAsync(const CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -207,6 +217,16 @@ void S3Client::CompleteMultipartUploadAsync(const CompleteMultipartUploadRequest
   m_executor->Submit( [this, request, handler, context](){ this->CompleteMultipartUploadAsyncHelper( request, handler, context ); } );
 }
 
+CompleteMultipartUploadOutcomeCallable S3Client::CompleteMultipartUploadCallable(CompleteMultipartUploadRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::CompleteMultipartUpload, this, std::move(request)));
+}
+
+void S3Client::CompleteMultipartUploadAsync(CompleteMultipartUploadRequest&& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::CompleteMultipartUploadAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::CompleteMultipartUploadAsyncHelper(const CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CompleteMultipartUpload(request), context);
@@ -232,7 +252,7 @@ CopyObjectOutcome S3Client::CopyObject(const CopyObjectRequest& request) const
 
 CopyObjectOutcomeCallable S3Client::CopyObjectCallable(const CopyObjectRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CopyObject( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CopyObject( request ); } );
 }
 
 void S3Client::CopyObjectAsync(const CopyObjectRequest& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -240,6 +260,16 @@ void S3Client::CopyObjectAsync(const CopyObjectRequest& request, const CopyObjec
   m_executor->Submit( [this, request, handler, context](){ this->CopyObjectAsyncHelper( request, handler, context ); } );
 }
 
+CopyObjectOutcomeCallable S3Client::CopyObjectCallable(CopyObjectRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::CopyObject, this, std::move(request)));
+}
+
+void S3Client::CopyObjectAsync(CopyObjectRequest&& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::CopyObjectAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::CopyObjectAsyncHelper(const CopyObjectRequest& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CopyObject(request), context);
@@ -263,7 +293,7 @@ CreateBucketOutcome S3Client::CreateBucket(const CreateBucketRequest& request) c
 
 CreateBucketOutcomeCallable S3Client::CreateBucketCallable(const CreateBucketRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateBucket( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateBucket( request ); } );
 }
 
 void S3Client::CreateBucketAsync(const CreateBucketRequest& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -271,6 +301,16 @@ void S3Client::CreateBucketAsync(const CreateBucketRequest& request, const Creat
   m_executor->Submit( [this, request, handler, context](){ this->CreateBucketAsyncHelper( request, handler, context ); } );
 }
 
+CreateBucketOutcomeCallable S3Client::CreateBucketCallable(CreateBucketRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::CreateBucket, this, std::move(request)));
+}
+
+void S3Client::CreateBucketAsync(CreateBucketRequest&& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::CreateBucketAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::CreateBucketAsyncHelper(const CreateBucketRequest& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateBucket(request), context);
@@ -297,7 +337,7 @@ CreateMultipartUploadOutcome S3Client::CreateMultipartUpload(const CreateMultipa
 
 CreateMultipartUploadOutcomeCallable S3Client::CreateMultipartUploadCallable(const CreateMultipartUploadRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateMultipartUpload( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateMultipartUpload( request ); } );
 }
 
 void S3Client::CreateMultipartUploadAsync(const CreateMultipartUploadRequest& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -305,6 +345,16 @@ void S3Client::CreateMultipartUploadAsync(const CreateMultipartUploadRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->CreateMultipartUploadAsyncHelper( request, handler, context ); } );
 }
 
+CreateMultipartUploadOutcomeCallable S3Client::CreateMultipartUploadCallable(CreateMultipartUploadRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::CreateMultipartUpload, this, std::move(request)));
+}
+
+void S3Client::CreateMultipartUploadAsync(CreateMultipartUploadRequest&& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::CreateMultipartUploadAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::CreateMultipartUploadAsyncHelper(const CreateMultipartUploadRequest& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateMultipartUpload(request), context);
@@ -328,7 +378,7 @@ DeleteBucketOutcome S3Client::DeleteBucket(const DeleteBucketRequest& request) c
 
 DeleteBucketOutcomeCallable S3Client::DeleteBucketCallable(const DeleteBucketRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteBucket( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteBucket( request ); } );
 }
 
 void S3Client::DeleteBucketAsync(const DeleteBucketRequest& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -336,6 +386,16 @@ void S3Client::DeleteBucketAsync(const DeleteBucketRequest& request, const Delet
   m_executor->Submit( [this, request, handler, context](){ this->DeleteBucketAsyncHelper( request, handler, context ); } );
 }
 
+DeleteBucketOutcomeCallable S3Client::DeleteBucketCallable(DeleteBucketRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::DeleteBucket, this, std::move(request)));
+}
+
+void S3Client::DeleteBucketAsync(DeleteBucketRequest&& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::DeleteBucketAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::DeleteBucketAsyncHelper(const DeleteBucketRequest& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteBucket(request), context);
@@ -360,7 +420,7 @@ DeleteBucketCorsOutcome S3Client::DeleteBucketCors(const DeleteBucketCorsRequest
 
 DeleteBucketCorsOutcomeCallable S3Client::DeleteBucketCorsCallable(const DeleteBucketCorsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteBucketCors( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteBucketCors( request ); } );
 }
 
 void S3Client::DeleteBucketCorsAsync(const DeleteBucketCorsRequest& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -368,6 +428,16 @@ void S3Client::DeleteBucketCorsAsync(const DeleteBucketCorsRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->DeleteBucketCorsAsyncHelper( request, handler, context ); } );
 }
 
+DeleteBucketCorsOutcomeCallable S3Client::DeleteBucketCorsCallable(DeleteBucketCorsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::DeleteBucketCors, this, std::move(request)));
+}
+
+void S3Client::DeleteBucketCorsAsync(DeleteBucketCorsRequest&& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::DeleteBucketCorsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::DeleteBucketCorsAsyncHelper(const DeleteBucketCorsRequest& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteBucketCors(request), context);
@@ -392,7 +462,7 @@ DeleteBucketLifecycleOutcome S3Client::DeleteBucketLifecycle(const DeleteBucketL
 
 DeleteBucketLifecycleOutcomeCallable S3Client::DeleteBucketLifecycleCallable(const DeleteBucketLifecycleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteBucketLifecycle( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteBucketLifecycle( request ); } );
 }
 
 void S3Client::DeleteBucketLifecycleAsync(const DeleteBucketLifecycleRequest& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -400,6 +470,16 @@ void S3Client::DeleteBucketLifecycleAsync(const DeleteBucketLifecycleRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->DeleteBucketLifecycleAsyncHelper( request, handler, context ); } );
 }
 
+DeleteBucketLifecycleOutcomeCallable S3Client::DeleteBucketLifecycleCallable(DeleteBucketLifecycleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::DeleteBucketLifecycle, this, std::move(request)));
+}
+
+void S3Client::DeleteBucketLifecycleAsync(DeleteBucketLifecycleRequest&& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::DeleteBucketLifecycleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::DeleteBucketLifecycleAsyncHelper(const DeleteBucketLifecycleRequest& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteBucketLifecycle(request), context);
@@ -424,7 +504,7 @@ DeleteBucketPolicyOutcome S3Client::DeleteBucketPolicy(const DeleteBucketPolicyR
 
 DeleteBucketPolicyOutcomeCallable S3Client::DeleteBucketPolicyCallable(const DeleteBucketPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteBucketPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteBucketPolicy( request ); } );
 }
 
 void S3Client::DeleteBucketPolicyAsync(const DeleteBucketPolicyRequest& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -432,6 +512,16 @@ void S3Client::DeleteBucketPolicyAsync(const DeleteBucketPolicyRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DeleteBucketPolicyAsyncHelper( request, handler, context ); } );
 }
 
+DeleteBucketPolicyOutcomeCallable S3Client::DeleteBucketPolicyCallable(DeleteBucketPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::DeleteBucketPolicy, this, std::move(request)));
+}
+
+void S3Client::DeleteBucketPolicyAsync(DeleteBucketPolicyRequest&& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::DeleteBucketPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::DeleteBucketPolicyAsyncHelper(const DeleteBucketPolicyRequest& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteBucketPolicy(request), context);
@@ -456,7 +546,7 @@ DeleteBucketReplicationOutcome S3Client::DeleteBucketReplication(const DeleteBuc
 
 DeleteBucketReplicationOutcomeCallable S3Client::DeleteBucketReplicationCallable(const DeleteBucketReplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteBucketReplication( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteBucketReplication( request ); } );
 }
 
 void S3Client::DeleteBucketReplicationAsync(const DeleteBucketReplicationRequest& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -464,6 +554,16 @@ void S3Client::DeleteBucketReplicationAsync(const DeleteBucketReplicationRequest
   m_executor->Submit( [this, request, handler, context](){ this->DeleteBucketReplicationAsyncHelper( request, handler, context ); } );
 }
 
+DeleteBucketReplicationOutcomeCallable S3Client::DeleteBucketReplicationCallable(DeleteBucketReplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::DeleteBucketReplication, this, std::move(request)));
+}
+
+void S3Client::DeleteBucketReplicationAsync(DeleteBucketReplicationRequest&& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::DeleteBucketReplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::DeleteBucketReplicationAsyncHelper(const DeleteBucketReplicationRequest& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteBucketReplication(request), context);
@@ -488,7 +588,7 @@ DeleteBucketTaggingOutcome S3Client::DeleteBucketTagging(const DeleteBucketTaggi
 
 DeleteBucketTaggingOutcomeCallable S3Client::DeleteBucketTaggingCallable(const DeleteBucketTaggingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteBucketTagging( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteBucketTagging( request ); } );
 }
 
 void S3Client::DeleteBucketTaggingAsync(const DeleteBucketTaggingRequest& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -496,6 +596,16 @@ void S3Client::DeleteBucketTaggingAsync(const DeleteBucketTaggingRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->DeleteBucketTaggingAsyncHelper( request, handler, context ); } );
 }
 
+DeleteBucketTaggingOutcomeCallable S3Client::DeleteBucketTaggingCallable(DeleteBucketTaggingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::DeleteBucketTagging, this, std::move(request)));
+}
+
+void S3Client::DeleteBucketTaggingAsync(DeleteBucketTaggingRequest&& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::DeleteBucketTaggingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::DeleteBucketTaggingAsyncHelper(const DeleteBucketTaggingRequest& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteBucketTagging(request), context);
@@ -520,7 +630,7 @@ DeleteBucketWebsiteOutcome S3Client::DeleteBucketWebsite(const DeleteBucketWebsi
 
 DeleteBucketWebsiteOutcomeCallable S3Client::DeleteBucketWebsiteCallable(const DeleteBucketWebsiteRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteBucketWebsite( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteBucketWebsite( request ); } );
 }
 
 void S3Client::DeleteBucketWebsiteAsync(const DeleteBucketWebsiteRequest& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -528,6 +638,16 @@ void S3Client::DeleteBucketWebsiteAsync(const DeleteBucketWebsiteRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->DeleteBucketWebsiteAsyncHelper( request, handler, context ); } );
 }
 
+DeleteBucketWebsiteOutcomeCallable S3Client::DeleteBucketWebsiteCallable(DeleteBucketWebsiteRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::DeleteBucketWebsite, this, std::move(request)));
+}
+
+void S3Client::DeleteBucketWebsiteAsync(DeleteBucketWebsiteRequest&& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::DeleteBucketWebsiteAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::DeleteBucketWebsiteAsyncHelper(const DeleteBucketWebsiteRequest& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteBucketWebsite(request), context);
@@ -553,7 +673,7 @@ DeleteObjectOutcome S3Client::DeleteObject(const DeleteObjectRequest& request) c
 
 DeleteObjectOutcomeCallable S3Client::DeleteObjectCallable(const DeleteObjectRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteObject( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteObject( request ); } );
 }
 
 void S3Client::DeleteObjectAsync(const DeleteObjectRequest& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -561,6 +681,16 @@ void S3Client::DeleteObjectAsync(const DeleteObjectRequest& request, const Delet
   m_executor->Submit( [this, request, handler, context](){ this->DeleteObjectAsyncHelper( request, handler, context ); } );
 }
 
+DeleteObjectOutcomeCallable S3Client::DeleteObjectCallable(DeleteObjectRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::DeleteObject, this, std::move(request)));
+}
+
+void S3Client::DeleteObjectAsync(DeleteObjectRequest&& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::DeleteObjectAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::DeleteObjectAsyncHelper(const DeleteObjectRequest& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteObject(request), context);
@@ -585,7 +715,7 @@ DeleteObjectsOutcome S3Client::DeleteObjects(const DeleteObjectsRequest& request
 
 DeleteObjectsOutcomeCallable S3Client::DeleteObjectsCallable(const DeleteObjectsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteObjects( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteObjects( request ); } );
 }
 
 void S3Client::DeleteObjectsAsync(const DeleteObjectsRequest& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -593,6 +723,16 @@ void S3Client::DeleteObjectsAsync(const DeleteObjectsRequest& request, const Del
   m_executor->Submit( [this, request, handler, context](){ this->DeleteObjectsAsyncHelper( request, handler, context ); } );
 }
 
+DeleteObjectsOutcomeCallable S3Client::DeleteObjectsCallable(DeleteObjectsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::DeleteObjects, this, std::move(request)));
+}
+
+void S3Client::DeleteObjectsAsync(DeleteObjectsRequest&& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::DeleteObjectsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::DeleteObjectsAsyncHelper(const DeleteObjectsRequest& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteObjects(request), context);
@@ -617,7 +757,7 @@ GetBucketAccelerateConfigurationOutcome S3Client::GetBucketAccelerateConfigurati
 
 GetBucketAccelerateConfigurationOutcomeCallable S3Client::GetBucketAccelerateConfigurationCallable(const GetBucketAccelerateConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBucketAccelerateConfiguration( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBucketAccelerateConfiguration( request ); } );
 }
 
 void S3Client::GetBucketAccelerateConfigurationAsync(const GetBucketAccelerateConfigurationRequest& request, const GetBucketAccelerateConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -625,6 +765,16 @@ void S3Client::GetBucketAccelerateConfigurationAsync(const GetBucketAccelerateCo
   m_executor->Submit( [this, request, handler, context](){ this->GetBucketAccelerateConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+GetBucketAccelerateConfigurationOutcomeCallable S3Client::GetBucketAccelerateConfigurationCallable(GetBucketAccelerateConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetBucketAccelerateConfiguration, this, std::move(request)));
+}
+
+void S3Client::GetBucketAccelerateConfigurationAsync(GetBucketAccelerateConfigurationRequest&& request, const GetBucketAccelerateConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetBucketAccelerateConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetBucketAccelerateConfigurationAsyncHelper(const GetBucketAccelerateConfigurationRequest& request, const GetBucketAccelerateConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBucketAccelerateConfiguration(request), context);
@@ -649,7 +799,7 @@ GetBucketAclOutcome S3Client::GetBucketAcl(const GetBucketAclRequest& request) c
 
 GetBucketAclOutcomeCallable S3Client::GetBucketAclCallable(const GetBucketAclRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBucketAcl( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBucketAcl( request ); } );
 }
 
 void S3Client::GetBucketAclAsync(const GetBucketAclRequest& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -657,6 +807,16 @@ void S3Client::GetBucketAclAsync(const GetBucketAclRequest& request, const GetBu
   m_executor->Submit( [this, request, handler, context](){ this->GetBucketAclAsyncHelper( request, handler, context ); } );
 }
 
+GetBucketAclOutcomeCallable S3Client::GetBucketAclCallable(GetBucketAclRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetBucketAcl, this, std::move(request)));
+}
+
+void S3Client::GetBucketAclAsync(GetBucketAclRequest&& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetBucketAclAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetBucketAclAsyncHelper(const GetBucketAclRequest& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBucketAcl(request), context);
@@ -681,7 +841,7 @@ GetBucketCorsOutcome S3Client::GetBucketCors(const GetBucketCorsRequest& request
 
 GetBucketCorsOutcomeCallable S3Client::GetBucketCorsCallable(const GetBucketCorsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBucketCors( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBucketCors( request ); } );
 }
 
 void S3Client::GetBucketCorsAsync(const GetBucketCorsRequest& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -689,6 +849,16 @@ void S3Client::GetBucketCorsAsync(const GetBucketCorsRequest& request, const Get
   m_executor->Submit( [this, request, handler, context](){ this->GetBucketCorsAsyncHelper( request, handler, context ); } );
 }
 
+GetBucketCorsOutcomeCallable S3Client::GetBucketCorsCallable(GetBucketCorsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetBucketCors, this, std::move(request)));
+}
+
+void S3Client::GetBucketCorsAsync(GetBucketCorsRequest&& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetBucketCorsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetBucketCorsAsyncHelper(const GetBucketCorsRequest& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBucketCors(request), context);
@@ -713,7 +883,7 @@ GetBucketLifecycleConfigurationOutcome S3Client::GetBucketLifecycleConfiguration
 
 GetBucketLifecycleConfigurationOutcomeCallable S3Client::GetBucketLifecycleConfigurationCallable(const GetBucketLifecycleConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBucketLifecycleConfiguration( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBucketLifecycleConfiguration( request ); } );
 }
 
 void S3Client::GetBucketLifecycleConfigurationAsync(const GetBucketLifecycleConfigurationRequest& request, const GetBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -721,6 +891,16 @@ void S3Client::GetBucketLifecycleConfigurationAsync(const GetBucketLifecycleConf
   m_executor->Submit( [this, request, handler, context](){ this->GetBucketLifecycleConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+GetBucketLifecycleConfigurationOutcomeCallable S3Client::GetBucketLifecycleConfigurationCallable(GetBucketLifecycleConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetBucketLifecycleConfiguration, this, std::move(request)));
+}
+
+void S3Client::GetBucketLifecycleConfigurationAsync(GetBucketLifecycleConfigurationRequest&& request, const GetBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetBucketLifecycleConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetBucketLifecycleConfigurationAsyncHelper(const GetBucketLifecycleConfigurationRequest& request, const GetBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBucketLifecycleConfiguration(request), context);
@@ -745,7 +925,7 @@ GetBucketLocationOutcome S3Client::GetBucketLocation(const GetBucketLocationRequ
 
 GetBucketLocationOutcomeCallable S3Client::GetBucketLocationCallable(const GetBucketLocationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBucketLocation( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBucketLocation( request ); } );
 }
 
 void S3Client::GetBucketLocationAsync(const GetBucketLocationRequest& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -753,6 +933,16 @@ void S3Client::GetBucketLocationAsync(const GetBucketLocationRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->GetBucketLocationAsyncHelper( request, handler, context ); } );
 }
 
+GetBucketLocationOutcomeCallable S3Client::GetBucketLocationCallable(GetBucketLocationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetBucketLocation, this, std::move(request)));
+}
+
+void S3Client::GetBucketLocationAsync(GetBucketLocationRequest&& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetBucketLocationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetBucketLocationAsyncHelper(const GetBucketLocationRequest& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBucketLocation(request), context);
@@ -777,7 +967,7 @@ GetBucketLoggingOutcome S3Client::GetBucketLogging(const GetBucketLoggingRequest
 
 GetBucketLoggingOutcomeCallable S3Client::GetBucketLoggingCallable(const GetBucketLoggingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBucketLogging( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBucketLogging( request ); } );
 }
 
 void S3Client::GetBucketLoggingAsync(const GetBucketLoggingRequest& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -785,6 +975,16 @@ void S3Client::GetBucketLoggingAsync(const GetBucketLoggingRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->GetBucketLoggingAsyncHelper( request, handler, context ); } );
 }
 
+GetBucketLoggingOutcomeCallable S3Client::GetBucketLoggingCallable(GetBucketLoggingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetBucketLogging, this, std::move(request)));
+}
+
+void S3Client::GetBucketLoggingAsync(GetBucketLoggingRequest&& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetBucketLoggingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetBucketLoggingAsyncHelper(const GetBucketLoggingRequest& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBucketLogging(request), context);
@@ -809,7 +1009,7 @@ GetBucketNotificationConfigurationOutcome S3Client::GetBucketNotificationConfigu
 
 GetBucketNotificationConfigurationOutcomeCallable S3Client::GetBucketNotificationConfigurationCallable(const GetBucketNotificationConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBucketNotificationConfiguration( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBucketNotificationConfiguration( request ); } );
 }
 
 void S3Client::GetBucketNotificationConfigurationAsync(const GetBucketNotificationConfigurationRequest& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -817,6 +1017,16 @@ void S3Client::GetBucketNotificationConfigurationAsync(const GetBucketNotificati
   m_executor->Submit( [this, request, handler, context](){ this->GetBucketNotificationConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+GetBucketNotificationConfigurationOutcomeCallable S3Client::GetBucketNotificationConfigurationCallable(GetBucketNotificationConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetBucketNotificationConfiguration, this, std::move(request)));
+}
+
+void S3Client::GetBucketNotificationConfigurationAsync(GetBucketNotificationConfigurationRequest&& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetBucketNotificationConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetBucketNotificationConfigurationAsyncHelper(const GetBucketNotificationConfigurationRequest& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBucketNotificationConfiguration(request), context);
@@ -841,7 +1051,7 @@ GetBucketPolicyOutcome S3Client::GetBucketPolicy(const GetBucketPolicyRequest& r
 
 GetBucketPolicyOutcomeCallable S3Client::GetBucketPolicyCallable(const GetBucketPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBucketPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBucketPolicy( request ); } );
 }
 
 void S3Client::GetBucketPolicyAsync(const GetBucketPolicyRequest& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -849,6 +1059,16 @@ void S3Client::GetBucketPolicyAsync(const GetBucketPolicyRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->GetBucketPolicyAsyncHelper( request, handler, context ); } );
 }
 
+GetBucketPolicyOutcomeCallable S3Client::GetBucketPolicyCallable(GetBucketPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetBucketPolicy, this, std::move(request)));
+}
+
+void S3Client::GetBucketPolicyAsync(GetBucketPolicyRequest&& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetBucketPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetBucketPolicyAsyncHelper(const GetBucketPolicyRequest& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBucketPolicy(request), context);
@@ -873,7 +1093,7 @@ GetBucketReplicationOutcome S3Client::GetBucketReplication(const GetBucketReplic
 
 GetBucketReplicationOutcomeCallable S3Client::GetBucketReplicationCallable(const GetBucketReplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBucketReplication( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBucketReplication( request ); } );
 }
 
 void S3Client::GetBucketReplicationAsync(const GetBucketReplicationRequest& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -881,6 +1101,16 @@ void S3Client::GetBucketReplicationAsync(const GetBucketReplicationRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->GetBucketReplicationAsyncHelper( request, handler, context ); } );
 }
 
+GetBucketReplicationOutcomeCallable S3Client::GetBucketReplicationCallable(GetBucketReplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetBucketReplication, this, std::move(request)));
+}
+
+void S3Client::GetBucketReplicationAsync(GetBucketReplicationRequest&& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetBucketReplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetBucketReplicationAsyncHelper(const GetBucketReplicationRequest& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBucketReplication(request), context);
@@ -905,7 +1135,7 @@ GetBucketRequestPaymentOutcome S3Client::GetBucketRequestPayment(const GetBucket
 
 GetBucketRequestPaymentOutcomeCallable S3Client::GetBucketRequestPaymentCallable(const GetBucketRequestPaymentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBucketRequestPayment( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBucketRequestPayment( request ); } );
 }
 
 void S3Client::GetBucketRequestPaymentAsync(const GetBucketRequestPaymentRequest& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -913,6 +1143,16 @@ void S3Client::GetBucketRequestPaymentAsync(const GetBucketRequestPaymentRequest
   m_executor->Submit( [this, request, handler, context](){ this->GetBucketRequestPaymentAsyncHelper( request, handler, context ); } );
 }
 
+GetBucketRequestPaymentOutcomeCallable S3Client::GetBucketRequestPaymentCallable(GetBucketRequestPaymentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetBucketRequestPayment, this, std::move(request)));
+}
+
+void S3Client::GetBucketRequestPaymentAsync(GetBucketRequestPaymentRequest&& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetBucketRequestPaymentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetBucketRequestPaymentAsyncHelper(const GetBucketRequestPaymentRequest& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBucketRequestPayment(request), context);
@@ -937,7 +1177,7 @@ GetBucketTaggingOutcome S3Client::GetBucketTagging(const GetBucketTaggingRequest
 
 GetBucketTaggingOutcomeCallable S3Client::GetBucketTaggingCallable(const GetBucketTaggingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBucketTagging( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBucketTagging( request ); } );
 }
 
 void S3Client::GetBucketTaggingAsync(const GetBucketTaggingRequest& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -945,6 +1185,16 @@ void S3Client::GetBucketTaggingAsync(const GetBucketTaggingRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->GetBucketTaggingAsyncHelper( request, handler, context ); } );
 }
 
+GetBucketTaggingOutcomeCallable S3Client::GetBucketTaggingCallable(GetBucketTaggingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetBucketTagging, this, std::move(request)));
+}
+
+void S3Client::GetBucketTaggingAsync(GetBucketTaggingRequest&& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetBucketTaggingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetBucketTaggingAsyncHelper(const GetBucketTaggingRequest& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBucketTagging(request), context);
@@ -969,7 +1219,7 @@ GetBucketVersioningOutcome S3Client::GetBucketVersioning(const GetBucketVersioni
 
 GetBucketVersioningOutcomeCallable S3Client::GetBucketVersioningCallable(const GetBucketVersioningRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBucketVersioning( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBucketVersioning( request ); } );
 }
 
 void S3Client::GetBucketVersioningAsync(const GetBucketVersioningRequest& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -977,6 +1227,16 @@ void S3Client::GetBucketVersioningAsync(const GetBucketVersioningRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->GetBucketVersioningAsyncHelper( request, handler, context ); } );
 }
 
+GetBucketVersioningOutcomeCallable S3Client::GetBucketVersioningCallable(GetBucketVersioningRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetBucketVersioning, this, std::move(request)));
+}
+
+void S3Client::GetBucketVersioningAsync(GetBucketVersioningRequest&& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetBucketVersioningAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetBucketVersioningAsyncHelper(const GetBucketVersioningRequest& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBucketVersioning(request), context);
@@ -1001,7 +1261,7 @@ GetBucketWebsiteOutcome S3Client::GetBucketWebsite(const GetBucketWebsiteRequest
 
 GetBucketWebsiteOutcomeCallable S3Client::GetBucketWebsiteCallable(const GetBucketWebsiteRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetBucketWebsite( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetBucketWebsite( request ); } );
 }
 
 void S3Client::GetBucketWebsiteAsync(const GetBucketWebsiteRequest& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1009,6 +1269,16 @@ void S3Client::GetBucketWebsiteAsync(const GetBucketWebsiteRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->GetBucketWebsiteAsyncHelper( request, handler, context ); } );
 }
 
+GetBucketWebsiteOutcomeCallable S3Client::GetBucketWebsiteCallable(GetBucketWebsiteRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetBucketWebsite, this, std::move(request)));
+}
+
+void S3Client::GetBucketWebsiteAsync(GetBucketWebsiteRequest&& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetBucketWebsiteAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetBucketWebsiteAsyncHelper(const GetBucketWebsiteRequest& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetBucketWebsite(request), context);
@@ -1034,7 +1304,7 @@ GetObjectOutcome S3Client::GetObject(const GetObjectRequest& request) const
 
 GetObjectOutcomeCallable S3Client::GetObjectCallable(const GetObjectRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetObject( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetObject( request ); } );
 }
 
 void S3Client::GetObjectAsync(const GetObjectRequest& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1042,6 +1312,16 @@ void S3Client::GetObjectAsync(const GetObjectRequest& request, const GetObjectRe
   m_executor->Submit( [this, request, handler, context](){ this->GetObjectAsyncHelper( request, handler, context ); } );
 }
 
+GetObjectOutcomeCallable S3Client::GetObjectCallable(GetObjectRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetObject, this, std::move(request)));
+}
+
+void S3Client::GetObjectAsync(GetObjectRequest&& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetObjectAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetObjectAsyncHelper(const GetObjectRequest& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetObject(request), context);
@@ -1068,7 +1348,7 @@ GetObjectAclOutcome S3Client::GetObjectAcl(const GetObjectAclRequest& request) c
 
 GetObjectAclOutcomeCallable S3Client::GetObjectAclCallable(const GetObjectAclRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetObjectAcl( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetObjectAcl( request ); } );
 }
 
 void S3Client::GetObjectAclAsync(const GetObjectAclRequest& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1076,6 +1356,16 @@ void S3Client::GetObjectAclAsync(const GetObjectAclRequest& request, const GetOb
   m_executor->Submit( [this, request, handler, context](){ this->GetObjectAclAsyncHelper( request, handler, context ); } );
 }
 
+GetObjectAclOutcomeCallable S3Client::GetObjectAclCallable(GetObjectAclRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetObjectAcl, this, std::move(request)));
+}
+
+void S3Client::GetObjectAclAsync(GetObjectAclRequest&& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetObjectAclAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetObjectAclAsyncHelper(const GetObjectAclRequest& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetObjectAcl(request), context);
@@ -1102,7 +1392,7 @@ GetObjectTorrentOutcome S3Client::GetObjectTorrent(const GetObjectTorrentRequest
 
 GetObjectTorrentOutcomeCallable S3Client::GetObjectTorrentCallable(const GetObjectTorrentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetObjectTorrent( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetObjectTorrent( request ); } );
 }
 
 void S3Client::GetObjectTorrentAsync(const GetObjectTorrentRequest& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1110,6 +1400,16 @@ void S3Client::GetObjectTorrentAsync(const GetObjectTorrentRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->GetObjectTorrentAsyncHelper( request, handler, context ); } );
 }
 
+GetObjectTorrentOutcomeCallable S3Client::GetObjectTorrentCallable(GetObjectTorrentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::GetObjectTorrent, this, std::move(request)));
+}
+
+void S3Client::GetObjectTorrentAsync(GetObjectTorrentRequest&& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::GetObjectTorrentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::GetObjectTorrentAsyncHelper(const GetObjectTorrentRequest& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetObjectTorrent(request), context);
@@ -1133,7 +1433,7 @@ HeadBucketOutcome S3Client::HeadBucket(const HeadBucketRequest& request) const
 
 HeadBucketOutcomeCallable S3Client::HeadBucketCallable(const HeadBucketRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->HeadBucket( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->HeadBucket( request ); } );
 }
 
 void S3Client::HeadBucketAsync(const HeadBucketRequest& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1141,6 +1441,16 @@ void S3Client::HeadBucketAsync(const HeadBucketRequest& request, const HeadBucke
   m_executor->Submit( [this, request, handler, context](){ this->HeadBucketAsyncHelper( request, handler, context ); } );
 }
 
+HeadBucketOutcomeCallable S3Client::HeadBucketCallable(HeadBucketRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::HeadBucket, this, std::move(request)));
+}
+
+void S3Client::HeadBucketAsync(HeadBucketRequest&& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::HeadBucketAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::HeadBucketAsyncHelper(const HeadBucketRequest& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, HeadBucket(request), context);
@@ -1166,7 +1476,7 @@ HeadObjectOutcome S3Client::HeadObject(const HeadObjectRequest& request) const
 
 HeadObjectOutcomeCallable S3Client::HeadObjectCallable(const HeadObjectRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->HeadObject( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->HeadObject( request ); } );
 }
 
 void S3Client::HeadObjectAsync(const HeadObjectRequest& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1174,6 +1484,16 @@ void S3Client::HeadObjectAsync(const HeadObjectRequest& request, const HeadObjec
   m_executor->Submit( [this, request, handler, context](){ this->HeadObjectAsyncHelper( request, handler, context ); } );
 }
 
+HeadObjectOutcomeCallable S3Client::HeadObjectCallable(HeadObjectRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::HeadObject, this, std::move(request)));
+}
+
+void S3Client::HeadObjectAsync(HeadObjectRequest&& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::HeadObjectAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::HeadObjectAsyncHelper(const HeadObjectRequest& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, HeadObject(request), context);
@@ -1196,7 +1516,7 @@ ListBucketsOutcome S3Client::ListBuckets() const
 
 ListBucketsOutcomeCallable S3Client::ListBucketsCallable() const
 {
-  return std::async(std::launch::async, [this](){ return this->ListBuckets(); } );
+  return m_executor->SubmitCallable([this](){ return this->ListBuckets(); } );
 }
 
 void S3Client::ListBucketsAsync(const ListBucketsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1228,7 +1548,7 @@ ListMultipartUploadsOutcome S3Client::ListMultipartUploads(const ListMultipartUp
 
 ListMultipartUploadsOutcomeCallable S3Client::ListMultipartUploadsCallable(const ListMultipartUploadsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListMultipartUploads( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListMultipartUploads( request ); } );
 }
 
 void S3Client::ListMultipartUploadsAsync(const ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1236,6 +1556,16 @@ void S3Client::ListMultipartUploadsAsync(const ListMultipartUploadsRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->ListMultipartUploadsAsyncHelper( request, handler, context ); } );
 }
 
+ListMultipartUploadsOutcomeCallable S3Client::ListMultipartUploadsCallable(ListMultipartUploadsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::ListMultipartUploads, this, std::move(request)));
+}
+
+void S3Client::ListMultipartUploadsAsync(ListMultipartUploadsRequest&& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::ListMultipartUploadsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::ListMultipartUploadsAsyncHelper(const ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListMultipartUploads(request), context);
@@ -1260,7 +1590,7 @@ ListObjectVersionsOutcome S3Client::ListObjectVersions(const ListObjectVersionsR
 
 ListObjectVersionsOutcomeCallable S3Client::ListObjectVersionsCallable(const ListObjectVersionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListObjectVersions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListObjectVersions( request ); } );
 }
 
 void S3Client::ListObjectVersionsAsync(const ListObjectVersionsRequest& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1268,6 +1598,16 @@ void S3Client::ListObjectVersionsAsync(const ListObjectVersionsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ListObjectVersionsAsyncHelper( request, handler, context ); } );
 }
 
+ListObjectVersionsOutcomeCallable S3Client::ListObjectVersionsCallable(ListObjectVersionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::ListObjectVersions, this, std::move(request)));
+}
+
+void S3Client::ListObjectVersionsAsync(ListObjectVersionsRequest&& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::ListObjectVersionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::ListObjectVersionsAsyncHelper(const ListObjectVersionsRequest& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListObjectVersions(request), context);
@@ -1291,7 +1631,7 @@ ListObjectsOutcome S3Client::ListObjects(const ListObjectsRequest& request) cons
 
 ListObjectsOutcomeCallable S3Client::ListObjectsCallable(const ListObjectsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListObjects( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListObjects( request ); } );
 }
 
 void S3Client::ListObjectsAsync(const ListObjectsRequest& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1299,6 +1639,16 @@ void S3Client::ListObjectsAsync(const ListObjectsRequest& request, const ListObj
   m_executor->Submit( [this, request, handler, context](){ this->ListObjectsAsyncHelper( request, handler, context ); } );
 }
 
+ListObjectsOutcomeCallable S3Client::ListObjectsCallable(ListObjectsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::ListObjects, this, std::move(request)));
+}
+
+void S3Client::ListObjectsAsync(ListObjectsRequest&& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::ListObjectsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::ListObjectsAsyncHelper(const ListObjectsRequest& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListObjects(request), context);
@@ -1323,7 +1673,7 @@ ListObjectsV2Outcome S3Client::ListObjectsV2(const ListObjectsV2Request& request
 
 ListObjectsV2OutcomeCallable S3Client::ListObjectsV2Callable(const ListObjectsV2Request& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListObjectsV2( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListObjectsV2( request ); } );
 }
 
 void S3Client::ListObjectsV2Async(const ListObjectsV2Request& request, const ListObjectsV2ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1331,6 +1681,16 @@ void S3Client::ListObjectsV2Async(const ListObjectsV2Request& request, const Lis
   m_executor->Submit( [this, request, handler, context](){ this->ListObjectsV2AsyncHelper( request, handler, context ); } );
 }
 
+ListObjectsV2OutcomeCallable S3Client::ListObjectsV2Callable(ListObjectsV2Request&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::ListObjectsV2, this, std::move(request)));
+}
+
+void S3Client::ListObjectsV2Async(ListObjectsV2Request&& request, const ListObjectsV2ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::ListObjectsV2AsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::ListObjectsV2AsyncHelper(const ListObjectsV2Request& request, const ListObjectsV2ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListObjectsV2(request), context);
@@ -1356,7 +1716,7 @@ ListPartsOutcome S3Client::ListParts(const ListPartsRequest& request) const
 
 ListPartsOutcomeCallable S3Client::ListPartsCallable(const ListPartsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListParts( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListParts( request ); } );
 }
 
 void S3Client::ListPartsAsync(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1364,6 +1724,16 @@ void S3Client::ListPartsAsync(const ListPartsRequest& request, const ListPartsRe
   m_executor->Submit( [this, request, handler, context](){ this->ListPartsAsyncHelper( request, handler, context ); } );
 }
 
+ListPartsOutcomeCallable S3Client::ListPartsCallable(ListPartsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::ListParts, this, std::move(request)));
+}
+
+void S3Client::ListPartsAsync(ListPartsRequest&& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::ListPartsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::ListPartsAsyncHelper(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListParts(request), context);
@@ -1388,7 +1758,7 @@ PutBucketAccelerateConfigurationOutcome S3Client::PutBucketAccelerateConfigurati
 
 PutBucketAccelerateConfigurationOutcomeCallable S3Client::PutBucketAccelerateConfigurationCallable(const PutBucketAccelerateConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutBucketAccelerateConfiguration( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutBucketAccelerateConfiguration( request ); } );
 }
 
 void S3Client::PutBucketAccelerateConfigurationAsync(const PutBucketAccelerateConfigurationRequest& request, const PutBucketAccelerateConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1396,6 +1766,16 @@ void S3Client::PutBucketAccelerateConfigurationAsync(const PutBucketAccelerateCo
   m_executor->Submit( [this, request, handler, context](){ this->PutBucketAccelerateConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+PutBucketAccelerateConfigurationOutcomeCallable S3Client::PutBucketAccelerateConfigurationCallable(PutBucketAccelerateConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::PutBucketAccelerateConfiguration, this, std::move(request)));
+}
+
+void S3Client::PutBucketAccelerateConfigurationAsync(PutBucketAccelerateConfigurationRequest&& request, const PutBucketAccelerateConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::PutBucketAccelerateConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::PutBucketAccelerateConfigurationAsyncHelper(const PutBucketAccelerateConfigurationRequest& request, const PutBucketAccelerateConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutBucketAccelerateConfiguration(request), context);
@@ -1420,7 +1800,7 @@ PutBucketAclOutcome S3Client::PutBucketAcl(const PutBucketAclRequest& request) c
 
 PutBucketAclOutcomeCallable S3Client::PutBucketAclCallable(const PutBucketAclRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutBucketAcl( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutBucketAcl( request ); } );
 }
 
 void S3Client::PutBucketAclAsync(const PutBucketAclRequest& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1428,6 +1808,16 @@ void S3Client::PutBucketAclAsync(const PutBucketAclRequest& request, const PutBu
   m_executor->Submit( [this, request, handler, context](){ this->PutBucketAclAsyncHelper( request, handler, context ); } );
 }
 
+PutBucketAclOutcomeCallable S3Client::PutBucketAclCallable(PutBucketAclRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::PutBucketAcl, this, std::move(request)));
+}
+
+void S3Client::PutBucketAclAsync(PutBucketAclRequest&& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::PutBucketAclAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::PutBucketAclAsyncHelper(const PutBucketAclRequest& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutBucketAcl(request), context);
@@ -1452,7 +1842,7 @@ PutBucketCorsOutcome S3Client::PutBucketCors(const PutBucketCorsRequest& request
 
 PutBucketCorsOutcomeCallable S3Client::PutBucketCorsCallable(const PutBucketCorsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutBucketCors( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutBucketCors( request ); } );
 }
 
 void S3Client::PutBucketCorsAsync(const PutBucketCorsRequest& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1460,6 +1850,16 @@ void S3Client::PutBucketCorsAsync(const PutBucketCorsRequest& request, const Put
   m_executor->Submit( [this, request, handler, context](){ this->PutBucketCorsAsyncHelper( request, handler, context ); } );
 }
 
+PutBucketCorsOutcomeCallable S3Client::PutBucketCorsCallable(PutBucketCorsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::PutBucketCors, this, std::move(request)));
+}
+
+void S3Client::PutBucketCorsAsync(PutBucketCorsRequest&& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::PutBucketCorsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::PutBucketCorsAsyncHelper(const PutBucketCorsRequest& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutBucketCors(request), context);
@@ -1484,7 +1884,7 @@ PutBucketLifecycleConfigurationOutcome S3Client::PutBucketLifecycleConfiguration
 
 PutBucketLifecycleConfigurationOutcomeCallable S3Client::PutBucketLifecycleConfigurationCallable(const PutBucketLifecycleConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutBucketLifecycleConfiguration( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutBucketLifecycleConfiguration( request ); } );
 }
 
 void S3Client::PutBucketLifecycleConfigurationAsync(const PutBucketLifecycleConfigurationRequest& request, const PutBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1492,6 +1892,16 @@ void S3Client::PutBucketLifecycleConfigurationAsync(const PutBucketLifecycleConf
   m_executor->Submit( [this, request, handler, context](){ this->PutBucketLifecycleConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+PutBucketLifecycleConfigurationOutcomeCallable S3Client::PutBucketLifecycleConfigurationCallable(PutBucketLifecycleConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::PutBucketLifecycleConfiguration, this, std::move(request)));
+}
+
+void S3Client::PutBucketLifecycleConfigurationAsync(PutBucketLifecycleConfigurationRequest&& request, const PutBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::PutBucketLifecycleConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::PutBucketLifecycleConfigurationAsyncHelper(const PutBucketLifecycleConfigurationRequest& request, const PutBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutBucketLifecycleConfiguration(request), context);
@@ -1516,7 +1926,7 @@ PutBucketLoggingOutcome S3Client::PutBucketLogging(const PutBucketLoggingRequest
 
 PutBucketLoggingOutcomeCallable S3Client::PutBucketLoggingCallable(const PutBucketLoggingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutBucketLogging( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutBucketLogging( request ); } );
 }
 
 void S3Client::PutBucketLoggingAsync(const PutBucketLoggingRequest& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1524,6 +1934,16 @@ void S3Client::PutBucketLoggingAsync(const PutBucketLoggingRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->PutBucketLoggingAsyncHelper( request, handler, context ); } );
 }
 
+PutBucketLoggingOutcomeCallable S3Client::PutBucketLoggingCallable(PutBucketLoggingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::PutBucketLogging, this, std::move(request)));
+}
+
+void S3Client::PutBucketLoggingAsync(PutBucketLoggingRequest&& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::PutBucketLoggingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::PutBucketLoggingAsyncHelper(const PutBucketLoggingRequest& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutBucketLogging(request), context);
@@ -1548,7 +1968,7 @@ PutBucketNotificationConfigurationOutcome S3Client::PutBucketNotificationConfigu
 
 PutBucketNotificationConfigurationOutcomeCallable S3Client::PutBucketNotificationConfigurationCallable(const PutBucketNotificationConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutBucketNotificationConfiguration( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutBucketNotificationConfiguration( request ); } );
 }
 
 void S3Client::PutBucketNotificationConfigurationAsync(const PutBucketNotificationConfigurationRequest& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1556,6 +1976,16 @@ void S3Client::PutBucketNotificationConfigurationAsync(const PutBucketNotificati
   m_executor->Submit( [this, request, handler, context](){ this->PutBucketNotificationConfigurationAsyncHelper( request, handler, context ); } );
 }
 
+PutBucketNotificationConfigurationOutcomeCallable S3Client::PutBucketNotificationConfigurationCallable(PutBucketNotificationConfigurationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::PutBucketNotificationConfiguration, this, std::move(request)));
+}
+
+void S3Client::PutBucketNotificationConfigurationAsync(PutBucketNotificationConfigurationRequest&& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::PutBucketNotificationConfigurationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::PutBucketNotificationConfigurationAsyncHelper(const PutBucketNotificationConfigurationRequest& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutBucketNotificationConfiguration(request), context);
@@ -1580,7 +2010,7 @@ PutBucketPolicyOutcome S3Client::PutBucketPolicy(const PutBucketPolicyRequest& r
 
 PutBucketPolicyOutcomeCallable S3Client::PutBucketPolicyCallable(const PutBucketPolicyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutBucketPolicy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutBucketPolicy( request ); } );
 }
 
 void S3Client::PutBucketPolicyAsync(const PutBucketPolicyRequest& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1588,6 +2018,16 @@ void S3Client::PutBucketPolicyAsync(const PutBucketPolicyRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->PutBucketPolicyAsyncHelper( request, handler, context ); } );
 }
 
+PutBucketPolicyOutcomeCallable S3Client::PutBucketPolicyCallable(PutBucketPolicyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::PutBucketPolicy, this, std::move(request)));
+}
+
+void S3Client::PutBucketPolicyAsync(PutBucketPolicyRequest&& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::PutBucketPolicyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::PutBucketPolicyAsyncHelper(const PutBucketPolicyRequest& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutBucketPolicy(request), context);
@@ -1612,7 +2052,7 @@ PutBucketReplicationOutcome S3Client::PutBucketReplication(const PutBucketReplic
 
 PutBucketReplicationOutcomeCallable S3Client::PutBucketReplicationCallable(const PutBucketReplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutBucketReplication( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutBucketReplication( request ); } );
 }
 
 void S3Client::PutBucketReplicationAsync(const PutBucketReplicationRequest& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1620,6 +2060,16 @@ void S3Client::PutBucketReplicationAsync(const PutBucketReplicationRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->PutBucketReplicationAsyncHelper( request, handler, context ); } );
 }
 
+PutBucketReplicationOutcomeCallable S3Client::PutBucketReplicationCallable(PutBucketReplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::PutBucketReplication, this, std::move(request)));
+}
+
+void S3Client::PutBucketReplicationAsync(PutBucketReplicationRequest&& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::PutBucketReplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::PutBucketReplicationAsyncHelper(const PutBucketReplicationRequest& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutBucketReplication(request), context);
@@ -1644,7 +2094,7 @@ PutBucketRequestPaymentOutcome S3Client::PutBucketRequestPayment(const PutBucket
 
 PutBucketRequestPaymentOutcomeCallable S3Client::PutBucketRequestPaymentCallable(const PutBucketRequestPaymentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutBucketRequestPayment( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutBucketRequestPayment( request ); } );
 }
 
 void S3Client::PutBucketRequestPaymentAsync(const PutBucketRequestPaymentRequest& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1652,6 +2102,16 @@ void S3Client::PutBucketRequestPaymentAsync(const PutBucketRequestPaymentRequest
   m_executor->Submit( [this, request, handler, context](){ this->PutBucketRequestPaymentAsyncHelper( request, handler, context ); } );
 }
 
+PutBucketRequestPaymentOutcomeCallable S3Client::PutBucketRequestPaymentCallable(PutBucketRequestPaymentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::PutBucketRequestPayment, this, std::move(request)));
+}
+
+void S3Client::PutBucketRequestPaymentAsync(PutBucketRequestPaymentRequest&& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::PutBucketRequestPaymentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::PutBucketRequestPaymentAsyncHelper(const PutBucketRequestPaymentRequest& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutBucketRequestPayment(request), context);
@@ -1676,7 +2136,7 @@ PutBucketTaggingOutcome S3Client::PutBucketTagging(const PutBucketTaggingRequest
 
 PutBucketTaggingOutcomeCallable S3Client::PutBucketTaggingCallable(const PutBucketTaggingRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutBucketTagging( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutBucketTagging( request ); } );
 }
 
 void S3Client::PutBucketTaggingAsync(const PutBucketTaggingRequest& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1684,6 +2144,16 @@ void S3Client::PutBucketTaggingAsync(const PutBucketTaggingRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->PutBucketTaggingAsyncHelper( request, handler, context ); } );
 }
 
+PutBucketTaggingOutcomeCallable S3Client::PutBucketTaggingCallable(PutBucketTaggingRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::PutBucketTagging, this, std::move(request)));
+}
+
+void S3Client::PutBucketTaggingAsync(PutBucketTaggingRequest&& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::PutBucketTaggingAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::PutBucketTaggingAsyncHelper(const PutBucketTaggingRequest& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutBucketTagging(request), context);
@@ -1708,7 +2178,7 @@ PutBucketVersioningOutcome S3Client::PutBucketVersioning(const PutBucketVersioni
 
 PutBucketVersioningOutcomeCallable S3Client::PutBucketVersioningCallable(const PutBucketVersioningRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutBucketVersioning( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutBucketVersioning( request ); } );
 }
 
 void S3Client::PutBucketVersioningAsync(const PutBucketVersioningRequest& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1716,6 +2186,16 @@ void S3Client::PutBucketVersioningAsync(const PutBucketVersioningRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->PutBucketVersioningAsyncHelper( request, handler, context ); } );
 }
 
+PutBucketVersioningOutcomeCallable S3Client::PutBucketVersioningCallable(PutBucketVersioningRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::PutBucketVersioning, this, std::move(request)));
+}
+
+void S3Client::PutBucketVersioningAsync(PutBucketVersioningRequest&& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::PutBucketVersioningAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::PutBucketVersioningAsyncHelper(const PutBucketVersioningRequest& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutBucketVersioning(request), context);
@@ -1740,7 +2220,7 @@ PutBucketWebsiteOutcome S3Client::PutBucketWebsite(const PutBucketWebsiteRequest
 
 PutBucketWebsiteOutcomeCallable S3Client::PutBucketWebsiteCallable(const PutBucketWebsiteRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutBucketWebsite( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutBucketWebsite( request ); } );
 }
 
 void S3Client::PutBucketWebsiteAsync(const PutBucketWebsiteRequest& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1748,6 +2228,16 @@ void S3Client::PutBucketWebsiteAsync(const PutBucketWebsiteRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->PutBucketWebsiteAsyncHelper( request, handler, context ); } );
 }
 
+PutBucketWebsiteOutcomeCallable S3Client::PutBucketWebsiteCallable(PutBucketWebsiteRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::PutBucketWebsite, this, std::move(request)));
+}
+
+void S3Client::PutBucketWebsiteAsync(PutBucketWebsiteRequest&& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::PutBucketWebsiteAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::PutBucketWebsiteAsyncHelper(const PutBucketWebsiteRequest& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutBucketWebsite(request), context);
@@ -1773,7 +2263,7 @@ PutObjectOutcome S3Client::PutObject(const PutObjectRequest& request) const
 
 PutObjectOutcomeCallable S3Client::PutObjectCallable(const PutObjectRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutObject( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutObject( request ); } );
 }
 
 void S3Client::PutObjectAsync(const PutObjectRequest& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1781,6 +2271,16 @@ void S3Client::PutObjectAsync(const PutObjectRequest& request, const PutObjectRe
   m_executor->Submit( [this, request, handler, context](){ this->PutObjectAsyncHelper( request, handler, context ); } );
 }
 
+PutObjectOutcomeCallable S3Client::PutObjectCallable(PutObjectRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::PutObject, this, std::move(request)));
+}
+
+void S3Client::PutObjectAsync(PutObjectRequest&& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::PutObjectAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::PutObjectAsyncHelper(const PutObjectRequest& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutObject(request), context);
@@ -1807,7 +2307,7 @@ PutObjectAclOutcome S3Client::PutObjectAcl(const PutObjectAclRequest& request) c
 
 PutObjectAclOutcomeCallable S3Client::PutObjectAclCallable(const PutObjectAclRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutObjectAcl( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutObjectAcl( request ); } );
 }
 
 void S3Client::PutObjectAclAsync(const PutObjectAclRequest& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1815,6 +2315,16 @@ void S3Client::PutObjectAclAsync(const PutObjectAclRequest& request, const PutOb
   m_executor->Submit( [this, request, handler, context](){ this->PutObjectAclAsyncHelper( request, handler, context ); } );
 }
 
+PutObjectAclOutcomeCallable S3Client::PutObjectAclCallable(PutObjectAclRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::PutObjectAcl, this, std::move(request)));
+}
+
+void S3Client::PutObjectAclAsync(PutObjectAclRequest&& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::PutObjectAclAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::PutObjectAclAsyncHelper(const PutObjectAclRequest& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutObjectAcl(request), context);
@@ -1841,7 +2351,7 @@ RestoreObjectOutcome S3Client::RestoreObject(const RestoreObjectRequest& request
 
 RestoreObjectOutcomeCallable S3Client::RestoreObjectCallable(const RestoreObjectRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RestoreObject( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RestoreObject( request ); } );
 }
 
 void S3Client::RestoreObjectAsync(const RestoreObjectRequest& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1849,6 +2359,16 @@ void S3Client::RestoreObjectAsync(const RestoreObjectRequest& request, const Res
   m_executor->Submit( [this, request, handler, context](){ this->RestoreObjectAsyncHelper( request, handler, context ); } );
 }
 
+RestoreObjectOutcomeCallable S3Client::RestoreObjectCallable(RestoreObjectRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::RestoreObject, this, std::move(request)));
+}
+
+void S3Client::RestoreObjectAsync(RestoreObjectRequest&& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::RestoreObjectAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::RestoreObjectAsyncHelper(const RestoreObjectRequest& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RestoreObject(request), context);
@@ -1874,7 +2394,7 @@ UploadPartOutcome S3Client::UploadPart(const UploadPartRequest& request) const
 
 UploadPartOutcomeCallable S3Client::UploadPartCallable(const UploadPartRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UploadPart( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UploadPart( request ); } );
 }
 
 void S3Client::UploadPartAsync(const UploadPartRequest& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1882,6 +2402,16 @@ void S3Client::UploadPartAsync(const UploadPartRequest& request, const UploadPar
   m_executor->Submit( [this, request, handler, context](){ this->UploadPartAsyncHelper( request, handler, context ); } );
 }
 
+UploadPartOutcomeCallable S3Client::UploadPartCallable(UploadPartRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::UploadPart, this, std::move(request)));
+}
+
+void S3Client::UploadPartAsync(UploadPartRequest&& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::UploadPartAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::UploadPartAsyncHelper(const UploadPartRequest& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UploadPart(request), context);
@@ -1907,7 +2437,7 @@ UploadPartCopyOutcome S3Client::UploadPartCopy(const UploadPartCopyRequest& requ
 
 UploadPartCopyOutcomeCallable S3Client::UploadPartCopyCallable(const UploadPartCopyRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UploadPartCopy( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UploadPartCopy( request ); } );
 }
 
 void S3Client::UploadPartCopyAsync(const UploadPartCopyRequest& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1915,11 +2445,344 @@ void S3Client::UploadPartCopyAsync(const UploadPartCopyRequest& request, const U
   m_executor->Submit( [this, request, handler, context](){ this->UploadPartCopyAsyncHelper( request, handler, context ); } );
 }
 
+UploadPartCopyOutcomeCallable S3Client::UploadPartCopyCallable(UploadPartCopyRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&S3Client::UploadPartCopy, this, std::move(request)));
+}
+
+void S3Client::UploadPartCopyAsync(UploadPartCopyRequest&& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&S3Client::UploadPartCopyAsyncHelper, this, std::move(request), handler, context);
+}
+
 void S3Client::UploadPartCopyAsyncHelper(const UploadPartCopyRequest& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UploadPartCopy(request), context);
 }
 
+Paginator<S3Client, ListObjectsRequest, ListObjectsOutcome> S3Client::ListObjectsPaginator(const ListObjectsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<S3Client, ListObjectsRequest, ListObjectsOutcome>(this, &S3Client::ListObjects, request,
+    [](const ListObjectsRequest& current, const ListObjectsOutcome& outcome, ListObjectsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetNextMarker();
+      if(token.empty() && !result.GetContents().empty())
+      {
+        token = result.GetContents().back().GetKey();
+      }
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<S3Client, ListObjectsV2Request, ListObjectsV2Outcome> S3Client::ListObjectsV2Paginator(const ListObjectsV2Request& request, size_t prefetchDepth) const
+{
+  return Paginator<S3Client, ListObjectsV2Request, ListObjectsV2Outcome>(this, &S3Client::ListObjectsV2, request,
+    [](const ListObjectsV2Request& current, const ListObjectsV2Outcome& outcome, ListObjectsV2Request& next)
+    {
+      const auto& result = outcome.GetResult();
+      if(!result.GetIsTruncated())
+      {
+        return false;
+      }
+      auto token = result.GetNextContinuationToken();
+      if(token.empty() || token == current.GetContinuationToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetContinuationToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<S3Client, AbortMultipartUploadRequest, AbortMultipartUploadOutcome> S3Client::AbortMultipartUploadAwaitable(AbortMultipartUploadRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::AbortMultipartUpload, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, CompleteMultipartUploadRequest, CompleteMultipartUploadOutcome> S3Client::CompleteMultipartUploadAwaitable(CompleteMultipartUploadRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::CompleteMultipartUpload, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, CopyObjectRequest, CopyObjectOutcome> S3Client::CopyObjectAwaitable(CopyObjectRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::CopyObject, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, CreateBucketRequest, CreateBucketOutcome> S3Client::CreateBucketAwaitable(CreateBucketRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::CreateBucket, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, CreateMultipartUploadRequest, CreateMultipartUploadOutcome> S3Client::CreateMultipartUploadAwaitable(CreateMultipartUploadRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::CreateMultipartUpload, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, DeleteBucketRequest, DeleteBucketOutcome> S3Client::DeleteBucketAwaitable(DeleteBucketRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::DeleteBucket, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, DeleteBucketCorsRequest, DeleteBucketCorsOutcome> S3Client::DeleteBucketCorsAwaitable(DeleteBucketCorsRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::DeleteBucketCors, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, DeleteBucketLifecycleRequest, DeleteBucketLifecycleOutcome> S3Client::DeleteBucketLifecycleAwaitable(DeleteBucketLifecycleRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::DeleteBucketLifecycle, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, DeleteBucketPolicyRequest, DeleteBucketPolicyOutcome> S3Client::DeleteBucketPolicyAwaitable(DeleteBucketPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::DeleteBucketPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, DeleteBucketReplicationRequest, DeleteBucketReplicationOutcome> S3Client::DeleteBucketReplicationAwaitable(DeleteBucketReplicationRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::DeleteBucketReplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, DeleteBucketTaggingRequest, DeleteBucketTaggingOutcome> S3Client::DeleteBucketTaggingAwaitable(DeleteBucketTaggingRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::DeleteBucketTagging, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, DeleteBucketWebsiteRequest, DeleteBucketWebsiteOutcome> S3Client::DeleteBucketWebsiteAwaitable(DeleteBucketWebsiteRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::DeleteBucketWebsite, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, DeleteObjectRequest, DeleteObjectOutcome> S3Client::DeleteObjectAwaitable(DeleteObjectRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::DeleteObject, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, DeleteObjectsRequest, DeleteObjectsOutcome> S3Client::DeleteObjectsAwaitable(DeleteObjectsRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::DeleteObjects, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetBucketAccelerateConfigurationRequest, GetBucketAccelerateConfigurationOutcome> S3Client::GetBucketAccelerateConfigurationAwaitable(GetBucketAccelerateConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetBucketAccelerateConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetBucketAclRequest, GetBucketAclOutcome> S3Client::GetBucketAclAwaitable(GetBucketAclRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetBucketAcl, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetBucketCorsRequest, GetBucketCorsOutcome> S3Client::GetBucketCorsAwaitable(GetBucketCorsRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetBucketCors, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetBucketLifecycleConfigurationRequest, GetBucketLifecycleConfigurationOutcome> S3Client::GetBucketLifecycleConfigurationAwaitable(GetBucketLifecycleConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetBucketLifecycleConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetBucketLocationRequest, GetBucketLocationOutcome> S3Client::GetBucketLocationAwaitable(GetBucketLocationRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetBucketLocation, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetBucketLoggingRequest, GetBucketLoggingOutcome> S3Client::GetBucketLoggingAwaitable(GetBucketLoggingRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetBucketLogging, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetBucketNotificationConfigurationRequest, GetBucketNotificationConfigurationOutcome> S3Client::GetBucketNotificationConfigurationAwaitable(GetBucketNotificationConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetBucketNotificationConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetBucketPolicyRequest, GetBucketPolicyOutcome> S3Client::GetBucketPolicyAwaitable(GetBucketPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetBucketPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetBucketReplicationRequest, GetBucketReplicationOutcome> S3Client::GetBucketReplicationAwaitable(GetBucketReplicationRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetBucketReplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetBucketRequestPaymentRequest, GetBucketRequestPaymentOutcome> S3Client::GetBucketRequestPaymentAwaitable(GetBucketRequestPaymentRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetBucketRequestPayment, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetBucketTaggingRequest, GetBucketTaggingOutcome> S3Client::GetBucketTaggingAwaitable(GetBucketTaggingRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetBucketTagging, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetBucketVersioningRequest, GetBucketVersioningOutcome> S3Client::GetBucketVersioningAwaitable(GetBucketVersioningRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetBucketVersioning, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetBucketWebsiteRequest, GetBucketWebsiteOutcome> S3Client::GetBucketWebsiteAwaitable(GetBucketWebsiteRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetBucketWebsite, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetObjectRequest, GetObjectOutcome> S3Client::GetObjectAwaitable(GetObjectRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetObject, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetObjectAclRequest, GetObjectAclOutcome> S3Client::GetObjectAclAwaitable(GetObjectAclRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetObjectAcl, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, GetObjectTorrentRequest, GetObjectTorrentOutcome> S3Client::GetObjectTorrentAwaitable(GetObjectTorrentRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::GetObjectTorrent, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, HeadBucketRequest, HeadBucketOutcome> S3Client::HeadBucketAwaitable(HeadBucketRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::HeadBucket, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, HeadObjectRequest, HeadObjectOutcome> S3Client::HeadObjectAwaitable(HeadObjectRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::HeadObject, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, void, ListBucketsOutcome> S3Client::ListBucketsAwaitable() const
+{
+  return { m_executor.get(), { this, &S3Client::ListBuckets } };
+}
+
+ClientOperationAwaitable<S3Client, ListMultipartUploadsRequest, ListMultipartUploadsOutcome> S3Client::ListMultipartUploadsAwaitable(ListMultipartUploadsRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::ListMultipartUploads, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, ListObjectVersionsRequest, ListObjectVersionsOutcome> S3Client::ListObjectVersionsAwaitable(ListObjectVersionsRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::ListObjectVersions, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, ListObjectsRequest, ListObjectsOutcome> S3Client::ListObjectsAwaitable(ListObjectsRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::ListObjects, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, ListObjectsV2Request, ListObjectsV2Outcome> S3Client::ListObjectsV2Awaitable(ListObjectsV2Request request) const
+{
+  return { m_executor.get(), { this, &S3Client::ListObjectsV2, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, ListPartsRequest, ListPartsOutcome> S3Client::ListPartsAwaitable(ListPartsRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::ListParts, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, PutBucketAccelerateConfigurationRequest, PutBucketAccelerateConfigurationOutcome> S3Client::PutBucketAccelerateConfigurationAwaitable(PutBucketAccelerateConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::PutBucketAccelerateConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, PutBucketAclRequest, PutBucketAclOutcome> S3Client::PutBucketAclAwaitable(PutBucketAclRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::PutBucketAcl, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, PutBucketCorsRequest, PutBucketCorsOutcome> S3Client::PutBucketCorsAwaitable(PutBucketCorsRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::PutBucketCors, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, PutBucketLifecycleConfigurationRequest, PutBucketLifecycleConfigurationOutcome> S3Client::PutBucketLifecycleConfigurationAwaitable(PutBucketLifecycleConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::PutBucketLifecycleConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, PutBucketLoggingRequest, PutBucketLoggingOutcome> S3Client::PutBucketLoggingAwaitable(PutBucketLoggingRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::PutBucketLogging, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, PutBucketNotificationConfigurationRequest, PutBucketNotificationConfigurationOutcome> S3Client::PutBucketNotificationConfigurationAwaitable(PutBucketNotificationConfigurationRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::PutBucketNotificationConfiguration, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, PutBucketPolicyRequest, PutBucketPolicyOutcome> S3Client::PutBucketPolicyAwaitable(PutBucketPolicyRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::PutBucketPolicy, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, PutBucketReplicationRequest, PutBucketReplicationOutcome> S3Client::PutBucketReplicationAwaitable(PutBucketReplicationRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::PutBucketReplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, PutBucketRequestPaymentRequest, PutBucketRequestPaymentOutcome> S3Client::PutBucketRequestPaymentAwaitable(PutBucketRequestPaymentRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::PutBucketRequestPayment, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, PutBucketTaggingRequest, PutBucketTaggingOutcome> S3Client::PutBucketTaggingAwaitable(PutBucketTaggingRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::PutBucketTagging, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, PutBucketVersioningRequest, PutBucketVersioningOutcome> S3Client::PutBucketVersioningAwaitable(PutBucketVersioningRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::PutBucketVersioning, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, PutBucketWebsiteRequest, PutBucketWebsiteOutcome> S3Client::PutBucketWebsiteAwaitable(PutBucketWebsiteRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::PutBucketWebsite, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, PutObjectRequest, PutObjectOutcome> S3Client::PutObjectAwaitable(PutObjectRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::PutObject, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, PutObjectAclRequest, PutObjectAclOutcome> S3Client::PutObjectAclAwaitable(PutObjectAclRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::PutObjectAcl, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, RestoreObjectRequest, RestoreObjectOutcome> S3Client::RestoreObjectAwaitable(RestoreObjectRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::RestoreObject, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, UploadPartRequest, UploadPartOutcome> S3Client::UploadPartAwaitable(UploadPartRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::UploadPart, std::move(request) } };
+}
+
+ClientOperationAwaitable<S3Client, UploadPartCopyRequest, UploadPartCopyOutcome> S3Client::UploadPartCopyAwaitable(UploadPartCopyRequest request) const
+{
+  return { m_executor.get(), { this, &S3Client::UploadPartCopy, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
 
 Aws::String S3Client::GeneratePresignedUrl(const Aws::String& bucketName, const Aws::String& key, Http::HttpMethod method, long long expirationInSeconds)
 {
@@ -51,7 +51,7 @@ AbortIncompleteMultipartUpload& AbortIncompleteMultipartUpload::operator =(const
     XmlNode daysAfterInitiationNode = resultNode.FirstChild("DaysAfterInitiation");
     if(!daysAfterInitiationNode.IsNull())
     {
-      m_daysAfterInitiation = StringUtils::ConvertToInt32(StringUtils::Trim(daysAfterInitiationNode.GetText().c_str()).c_str());
+      m_daysAfterInitiation = StringUtils::ConvertToInt32(daysAfterInitiationNode.GetTextView().Trim().ToString().c_str());
       m_daysAfterInitiationHasBeenSet = true;
     }
   }
@@ -29,21 +29,29 @@ namespace Aws
       namespace BucketAccelerateStatusMapper
       {
 
-        static const int Enabled_HASH = HashingUtils::HashString("Enabled");
-        static const int Suspended_HASH = HashingUtils::HashString("Suspended");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Enabled_HASH = 55059233;
+        static const int Suspended_HASH = 342339003;
 
 
         BucketAccelerateStatus GetBucketAccelerateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Enabled_HASH)
+          switch (hashCode)
           {
+          case Enabled_HASH:
             return BucketAccelerateStatus::Enabled;
-          }
-          else if (hashCode == Suspended_HASH)
-          {
+          case Suspended_HASH:
             return BucketAccelerateStatus::Suspended;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
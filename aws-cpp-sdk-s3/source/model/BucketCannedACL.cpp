@@ -29,31 +29,35 @@ namespace Aws
       namespace BucketCannedACLMapper
       {
 
-        static const int private__HASH = HashingUtils::HashString("private");
-        static const int public_read_HASH = HashingUtils::HashString("public-read");
-        static const int public_read_write_HASH = HashingUtils::HashString("public-read-write");
-        static const int authenticated_read_HASH = HashingUtils::HashString("authenticated-read");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int private__HASH = -314497661;
+        static const int public_read_HASH = -1126309254;
+        static const int public_read_write_HASH = -1397683508;
+        static const int authenticated_read_HASH = 2076511348;
 
 
         BucketCannedACL GetBucketCannedACLForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == private__HASH)
+          switch (hashCode)
           {
+          case private__HASH:
             return BucketCannedACL::private_;
-          }
-          else if (hashCode == public_read_HASH)
-          {
+          case public_read_HASH:
             return BucketCannedACL::public_read;
-          }
-          else if (hashCode == public_read_write_HASH)
-          {
+          case public_read_write_HASH:
             return BucketCannedACL::public_read_write;
-          }
-          else if (hashCode == authenticated_read_HASH)
-          {
+          case authenticated_read_HASH:
             return BucketCannedACL::authenticated_read;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace BucketLogsPermissionMapper
       {
 
-        static const int FULL_CONTROL_HASH = HashingUtils::HashString("FULL_CONTROL");
-        static const int READ_HASH = HashingUtils::HashString("READ");
-        static const int WRITE_HASH = HashingUtils::HashString("WRITE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int FULL_CONTROL_HASH = 78885773;
+        static const int READ_HASH = 2511254;
+        static const int WRITE_HASH = 82862015;
 
 
         BucketLogsPermission GetBucketLogsPermissionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FULL_CONTROL_HASH)
+          switch (hashCode)
           {
+          case FULL_CONTROL_HASH:
             return BucketLogsPermission::FULL_CONTROL;
-          }
-          else if (hashCode == READ_HASH)
-          {
+          case READ_HASH:
             return BucketLogsPermission::READ;
-          }
-          else if (hashCode == WRITE_HASH)
-          {
+          case WRITE_HASH:
             return BucketLogsPermission::WRITE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
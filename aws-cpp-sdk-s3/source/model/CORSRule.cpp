@@ -62,7 +62,7 @@ CORSRule& CORSRule::operator =(const XmlNode& xmlNode)
       XmlNode allowedHeaderMember = allowedHeadersNode;
       while(!allowedHeaderMember.IsNull())
       {
-        m_allowedHeaders.push_back(StringUtils::Trim(allowedHeaderMember.GetText().c_str()));
+        m_allowedHeaders.push_back(allowedHeaderMember.GetTextView().Trim().ToString());
         allowedHeaderMember = allowedHeaderMember.NextNode("AllowedHeader");
       }
 
@@ -74,7 +74,7 @@ CORSRule& CORSRule::operator =(const XmlNode& xmlNode)
       XmlNode allowedMethodMember = allowedMethodsNode;
       while(!allowedMethodMember.IsNull())
       {
-        m_allowedMethods.push_back(StringUtils::Trim(allowedMethodMember.GetText().c_str()));
+        m_allowedMethods.push_back(allowedMethodMember.GetTextView().Trim().ToString());
         allowedMethodMember = allowedMethodMember.NextNode("AllowedMethod");
       }
 
@@ -86,7 +86,7 @@ CORSRule& CORSRule::operator =(const XmlNode& xmlNode)
       XmlNode allowedOriginMember = allowedOriginsNode;
       while(!allowedOriginMember.IsNull())
       {
-        m_allowedOrigins.push_back(StringUtils::Trim(allowedOriginMember.GetText().c_str()));
+        m_allowedOrigins.push_back(allowedOriginMember.GetTextView().Trim().ToString());
         allowedOriginMember = allowedOriginMember.NextNode("AllowedOrigin");
       }
 
@@ -98,7 +98,7 @@ CORSRule& CORSRule::operator =(const XmlNode& xmlNode)
       XmlNode exposeHeaderMember = exposeHeadersNode;
       while(!exposeHeaderMember.IsNull())
       {
-        m_exposeHeaders.push_back(StringUtils::Trim(exposeHeaderMember.GetText().c_str()));
+        m_exposeHeaders.push_back(exposeHeaderMember.GetTextView().Trim().ToString());
         exposeHeaderMember = exposeHeaderMember.NextNode("ExposeHeader");
       }
 
@@ -107,7 +107,7 @@ CORSRule& CORSRule::operator =(const XmlNode& xmlNode)
     XmlNode maxAgeSecondsNode = resultNode.FirstChild("MaxAgeSeconds");
     if(!maxAgeSecondsNode.IsNull())
     {
-      m_maxAgeSeconds = StringUtils::ConvertToInt32(StringUtils::Trim(maxAgeSecondsNode.GetText().c_str()).c_str());
+      m_maxAgeSeconds = StringUtils::ConvertToInt32(maxAgeSecondsNode.GetTextView().Trim().ToString().c_str());
       m_maxAgeSecondsHasBeenSet = true;
     }
   }
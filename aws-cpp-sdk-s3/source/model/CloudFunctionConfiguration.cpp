@@ -55,7 +55,7 @@ CloudFunctionConfiguration& CloudFunctionConfiguration::operator =(const XmlNode
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode eventsNode = resultNode.FirstChild("Event");
@@ -64,7 +64,7 @@ CloudFunctionConfiguration& CloudFunctionConfiguration::operator =(const XmlNode
       XmlNode eventMember = eventsNode;
       while(!eventMember.IsNull())
       {
-        m_events.push_back(EventMapper::GetEventForName(StringUtils::Trim(eventMember.GetText().c_str())));
+        m_events.push_back(EventMapper::GetEventForName(eventMember.GetTextView().Trim().ToString()));
         eventMember = eventMember.NextNode("Event");
       }
 
@@ -73,13 +73,13 @@ CloudFunctionConfiguration& CloudFunctionConfiguration::operator =(const XmlNode
     XmlNode cloudFunctionNode = resultNode.FirstChild("CloudFunction");
     if(!cloudFunctionNode.IsNull())
     {
-      m_cloudFunction = StringUtils::Trim(cloudFunctionNode.GetText().c_str());
+      m_cloudFunction = cloudFunctionNode.GetTextView().Trim().ToString();
       m_cloudFunctionHasBeenSet = true;
     }
     XmlNode invocationRoleNode = resultNode.FirstChild("InvocationRole");
     if(!invocationRoleNode.IsNull())
     {
-      m_invocationRole = StringUtils::Trim(invocationRoleNode.GetText().c_str());
+      m_invocationRole = invocationRoleNode.GetTextView().Trim().ToString();
       m_invocationRoleHasBeenSet = true;
     }
   }
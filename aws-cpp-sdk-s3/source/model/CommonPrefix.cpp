@@ -49,7 +49,7 @@ CommonPrefix& CommonPrefix::operator =(const XmlNode& xmlNode)
     XmlNode prefixNode = resultNode.FirstChild("Prefix");
     if(!prefixNode.IsNull())
     {
-      m_prefix = StringUtils::Trim(prefixNode.GetText().c_str());
+      m_prefix = prefixNode.GetTextView().Trim().ToString();
       m_prefixHasBeenSet = true;
     }
   }
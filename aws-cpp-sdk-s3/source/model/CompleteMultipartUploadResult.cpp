@@ -44,22 +44,22 @@ CompleteMultipartUploadResult& CompleteMultipartUploadResult::operator =(const A
     XmlNode locationNode = resultNode.FirstChild("Location");
     if(!locationNode.IsNull())
     {
-      m_location = StringUtils::Trim(locationNode.GetText().c_str());
+      m_location = locationNode.GetTextView().Trim().ToString();
     }
     XmlNode bucketNode = resultNode.FirstChild("Bucket");
     if(!bucketNode.IsNull())
     {
-      m_bucket = StringUtils::Trim(bucketNode.GetText().c_str());
+      m_bucket = bucketNode.GetTextView().Trim().ToString();
     }
     XmlNode keyNode = resultNode.FirstChild("Key");
     if(!keyNode.IsNull())
     {
-      m_key = StringUtils::Trim(keyNode.GetText().c_str());
+      m_key = keyNode.GetTextView().Trim().ToString();
     }
     XmlNode eTagNode = resultNode.FirstChild("ETag");
     if(!eTagNode.IsNull())
     {
-      m_eTag = StringUtils::Trim(eTagNode.GetText().c_str());
+      m_eTag = eTagNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -53,13 +53,13 @@ CompletedPart& CompletedPart::operator =(const XmlNode& xmlNode)
     XmlNode eTagNode = resultNode.FirstChild("ETag");
     if(!eTagNode.IsNull())
     {
-      m_eTag = StringUtils::Trim(eTagNode.GetText().c_str());
+      m_eTag = eTagNode.GetTextView().Trim().ToString();
       m_eTagHasBeenSet = true;
     }
     XmlNode partNumberNode = resultNode.FirstChild("PartNumber");
     if(!partNumberNode.IsNull())
     {
-      m_partNumber = StringUtils::ConvertToInt32(StringUtils::Trim(partNumberNode.GetText().c_str()).c_str());
+      m_partNumber = StringUtils::ConvertToInt32(partNumberNode.GetTextView().Trim().ToString().c_str());
       m_partNumberHasBeenSet = true;
     }
   }
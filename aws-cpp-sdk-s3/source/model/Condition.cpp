@@ -51,13 +51,13 @@ Condition& Condition::operator =(const XmlNode& xmlNode)
     XmlNode httpErrorCodeReturnedEqualsNode = resultNode.FirstChild("HttpErrorCodeReturnedEquals");
     if(!httpErrorCodeReturnedEqualsNode.IsNull())
     {
-      m_httpErrorCodeReturnedEquals = StringUtils::Trim(httpErrorCodeReturnedEqualsNode.GetText().c_str());
+      m_httpErrorCodeReturnedEquals = httpErrorCodeReturnedEqualsNode.GetTextView().Trim().ToString();
       m_httpErrorCodeReturnedEqualsHasBeenSet = true;
     }
     XmlNode keyPrefixEqualsNode = resultNode.FirstChild("KeyPrefixEquals");
     if(!keyPrefixEqualsNode.IsNull())
     {
-      m_keyPrefixEquals = StringUtils::Trim(keyPrefixEqualsNode.GetText().c_str());
+      m_keyPrefixEquals = keyPrefixEqualsNode.GetTextView().Trim().ToString();
       m_keyPrefixEqualsHasBeenSet = true;
     }
   }
@@ -43,12 +43,12 @@ CopyObjectResult& CopyObjectResult::operator =(const AmazonWebServiceResult<XmlD
     XmlNode eTagNode = resultNode.FirstChild("ETag");
     if(!eTagNode.IsNull())
     {
-      m_eTag = StringUtils::Trim(eTagNode.GetText().c_str());
+      m_eTag = eTagNode.GetTextView().Trim().ToString();
     }
     XmlNode lastModifiedNode = resultNode.FirstChild("LastModified");
     if(!lastModifiedNode.IsNull())
     {
-      m_lastModified = DateTime(StringUtils::Trim(lastModifiedNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_lastModified = DateTime(lastModifiedNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
     }
   }
 
@@ -51,13 +51,13 @@ CopyPartResult& CopyPartResult::operator =(const XmlNode& xmlNode)
     XmlNode eTagNode = resultNode.FirstChild("ETag");
     if(!eTagNode.IsNull())
     {
-      m_eTag = StringUtils::Trim(eTagNode.GetText().c_str());
+      m_eTag = eTagNode.GetTextView().Trim().ToString();
       m_eTagHasBeenSet = true;
     }
     XmlNode lastModifiedNode = resultNode.FirstChild("LastModified");
     if(!lastModifiedNode.IsNull())
     {
-      m_lastModified = DateTime(StringUtils::Trim(lastModifiedNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_lastModified = DateTime(lastModifiedNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_lastModifiedHasBeenSet = true;
     }
   }
@@ -49,7 +49,7 @@ CreateBucketConfiguration& CreateBucketConfiguration::operator =(const XmlNode&
     XmlNode locationConstraintNode = resultNode.FirstChild("LocationConstraint");
     if(!locationConstraintNode.IsNull())
     {
-      m_locationConstraint = BucketLocationConstraintMapper::GetBucketLocationConstraintForName(StringUtils::Trim(locationConstraintNode.GetText().c_str()).c_str());
+      m_locationConstraint = BucketLocationConstraintMapper::GetBucketLocationConstraintForName(locationConstraintNode.GetTextView().Trim().ToString().c_str());
       m_locationConstraintHasBeenSet = true;
     }
   }
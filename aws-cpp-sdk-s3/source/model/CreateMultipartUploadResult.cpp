@@ -44,17 +44,17 @@ CreateMultipartUploadResult& CreateMultipartUploadResult::operator =(const Amazo
     XmlNode bucketNode = resultNode.FirstChild("Bucket");
     if(!bucketNode.IsNull())
     {
-      m_bucket = StringUtils::Trim(bucketNode.GetText().c_str());
+      m_bucket = bucketNode.GetTextView().Trim().ToString();
     }
     XmlNode keyNode = resultNode.FirstChild("Key");
     if(!keyNode.IsNull())
     {
-      m_key = StringUtils::Trim(keyNode.GetText().c_str());
+      m_key = keyNode.GetTextView().Trim().ToString();
     }
     XmlNode uploadIdNode = resultNode.FirstChild("UploadId");
     if(!uploadIdNode.IsNull())
     {
-      m_uploadId = StringUtils::Trim(uploadIdNode.GetText().c_str());
+      m_uploadId = uploadIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -65,7 +65,7 @@ Delete& Delete::operator =(const XmlNode& xmlNode)
     XmlNode quietNode = resultNode.FirstChild("Quiet");
     if(!quietNode.IsNull())
     {
-      m_quiet = StringUtils::ConvertToBool(StringUtils::Trim(quietNode.GetText().c_str()).c_str());
+      m_quiet = StringUtils::ConvertToBool(quietNode.GetTextView().Trim().ToString().c_str());
       m_quietHasBeenSet = true;
     }
   }
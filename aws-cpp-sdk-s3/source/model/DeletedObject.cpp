@@ -57,25 +57,25 @@ DeletedObject& DeletedObject::operator =(const XmlNode& xmlNode)
     XmlNode keyNode = resultNode.FirstChild("Key");
     if(!keyNode.IsNull())
     {
-      m_key = StringUtils::Trim(keyNode.GetText().c_str());
+      m_key = keyNode.GetTextView().Trim().ToString();
       m_keyHasBeenSet = true;
     }
     XmlNode versionIdNode = resultNode.FirstChild("VersionId");
     if(!versionIdNode.IsNull())
     {
-      m_versionId = StringUtils::Trim(versionIdNode.GetText().c_str());
+      m_versionId = versionIdNode.GetTextView().Trim().ToString();
       m_versionIdHasBeenSet = true;
     }
     XmlNode deleteMarkerNode = resultNode.FirstChild("DeleteMarker");
     if(!deleteMarkerNode.IsNull())
     {
-      m_deleteMarker = StringUtils::ConvertToBool(StringUtils::Trim(deleteMarkerNode.GetText().c_str()).c_str());
+      m_deleteMarker = StringUtils::ConvertToBool(deleteMarkerNode.GetTextView().Trim().ToString().c_str());
       m_deleteMarkerHasBeenSet = true;
     }
     XmlNode deleteMarkerVersionIdNode = resultNode.FirstChild("DeleteMarkerVersionId");
     if(!deleteMarkerVersionIdNode.IsNull())
     {
-      m_deleteMarkerVersionId = StringUtils::Trim(deleteMarkerVersionIdNode.GetText().c_str());
+      m_deleteMarkerVersionId = deleteMarkerVersionIdNode.GetTextView().Trim().ToString();
       m_deleteMarkerVersionIdHasBeenSet = true;
     }
   }
@@ -29,16 +29,26 @@ namespace Aws
       namespace EncodingTypeMapper
       {
 
-        static const int url_HASH = HashingUtils::HashString("url");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int url_HASH = 116079;
 
 
         EncodingType GetEncodingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == url_HASH)
+          switch (hashCode)
           {
+          case url_HASH:
             return EncodingType::url;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
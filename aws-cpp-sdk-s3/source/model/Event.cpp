@@ -29,56 +29,50 @@ namespace Aws
       namespace EventMapper
       {
 
-        static const int s3_ReducedRedundancyLostObject_HASH = HashingUtils::HashString("s3:ReducedRedundancyLostObject");
-        static const int s3_ObjectCreated_HASH = HashingUtils::HashString("s3:ObjectCreated:*");
-        static const int s3_ObjectCreated_Put_HASH = HashingUtils::HashString("s3:ObjectCreated:Put");
-        static const int s3_ObjectCreated_Post_HASH = HashingUtils::HashString("s3:ObjectCreated:Post");
-        static const int s3_ObjectCreated_Copy_HASH = HashingUtils::HashString("s3:ObjectCreated:Copy");
-        static const int s3_ObjectCreated_CompleteMultipartUpload_HASH = HashingUtils::HashString("s3:ObjectCreated:CompleteMultipartUpload");
-        static const int s3_ObjectRemoved_HASH = HashingUtils::HashString("s3:ObjectRemoved:*");
-        static const int s3_ObjectRemoved_Delete_HASH = HashingUtils::HashString("s3:ObjectRemoved:Delete");
-        static const int s3_ObjectRemoved_DeleteMarkerCreated_HASH = HashingUtils::HashString("s3:ObjectRemoved:DeleteMarkerCreated");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int s3_ReducedRedundancyLostObject_HASH = 442328292;
+        static const int s3_ObjectCreated_HASH = 1479862815;
+        static const int s3_ObjectCreated_Put_HASH = 514030500;
+        static const int s3_ObjectCreated_Post_HASH = -1244929365;
+        static const int s3_ObjectCreated_Copy_HASH = -1245316736;
+        static const int s3_ObjectCreated_CompleteMultipartUpload_HASH = 1040332649;
+        static const int s3_ObjectRemoved_HASH = -2131098217;
+        static const int s3_ObjectRemoved_Delete_HASH = -951269250;
+        static const int s3_ObjectRemoved_DeleteMarkerCreated_HASH = 1458622832;
 
 
         Event GetEventForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == s3_ReducedRedundancyLostObject_HASH)
+          switch (hashCode)
           {
+          case s3_ReducedRedundancyLostObject_HASH:
             return Event::s3_ReducedRedundancyLostObject;
-          }
-          else if (hashCode == s3_ObjectCreated_HASH)
-          {
+          case s3_ObjectCreated_HASH:
             return Event::s3_ObjectCreated;
-          }
-          else if (hashCode == s3_ObjectCreated_Put_HASH)
-          {
+          case s3_ObjectCreated_Put_HASH:
             return Event::s3_ObjectCreated_Put;
-          }
-          else if (hashCode == s3_ObjectCreated_Post_HASH)
-          {
+          case s3_ObjectCreated_Post_HASH:
             return Event::s3_ObjectCreated_Post;
-          }
-          else if (hashCode == s3_ObjectCreated_Copy_HASH)
-          {
+          case s3_ObjectCreated_Copy_HASH:
             return Event::s3_ObjectCreated_Copy;
-          }
-          else if (hashCode == s3_ObjectCreated_CompleteMultipartUpload_HASH)
-          {
+          case s3_ObjectCreated_CompleteMultipartUpload_HASH:
             return Event::s3_ObjectCreated_CompleteMultipartUpload;
-          }
-          else if (hashCode == s3_ObjectRemoved_HASH)
-          {
+          case s3_ObjectRemoved_HASH:
             return Event::s3_ObjectRemoved;
-          }
-          else if (hashCode == s3_ObjectRemoved_Delete_HASH)
-          {
+          case s3_ObjectRemoved_Delete_HASH:
             return Event::s3_ObjectRemoved_Delete;
-          }
-          else if (hashCode == s3_ObjectRemoved_DeleteMarkerCreated_HASH)
-          {
+          case s3_ObjectRemoved_DeleteMarkerCreated_HASH:
             return Event::s3_ObjectRemoved_DeleteMarkerCreated;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
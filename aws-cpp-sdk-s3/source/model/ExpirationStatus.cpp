@@ -29,21 +29,29 @@ namespace Aws
       namespace ExpirationStatusMapper
       {
 
-        static const int Enabled_HASH = HashingUtils::HashString("Enabled");
-        static const int Disabled_HASH = HashingUtils::HashString("Disabled");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Enabled_HASH = 55059233;
+        static const int Disabled_HASH = 335584924;
 
 
         ExpirationStatus GetExpirationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Enabled_HASH)
+          switch (hashCode)
           {
+          case Enabled_HASH:
             return ExpirationStatus::Enabled;
-          }
-          else if (hashCode == Disabled_HASH)
-          {
+          case Disabled_HASH:
             return ExpirationStatus::Disabled;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
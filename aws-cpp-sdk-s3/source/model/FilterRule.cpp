@@ -51,13 +51,13 @@ FilterRule& FilterRule::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = FilterRuleNameMapper::GetFilterRuleNameForName(StringUtils::Trim(nameNode.GetText().c_str()).c_str());
+      m_name = FilterRuleNameMapper::GetFilterRuleNameForName(nameNode.GetTextView().Trim().ToString().c_str());
       m_nameHasBeenSet = true;
     }
     XmlNode valueNode = resultNode.FirstChild("Value");
     if(!valueNode.IsNull())
     {
-      m_value = StringUtils::Trim(valueNode.GetText().c_str());
+      m_value = valueNode.GetTextView().Trim().ToString();
       m_valueHasBeenSet = true;
     }
   }
@@ -29,21 +29,29 @@ namespace Aws
       namespace FilterRuleNameMapper
       {
 
-        static const int prefix_HASH = HashingUtils::HashString("prefix");
-        static const int suffix_HASH = HashingUtils::HashString("suffix");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int prefix_HASH = -980110702;
+        static const int suffix_HASH = -891422895;
 
 
         FilterRuleName GetFilterRuleNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == prefix_HASH)
+          switch (hashCode)
           {
+          case prefix_HASH:
             return FilterRuleName::prefix;
-          }
-          else if (hashCode == suffix_HASH)
-          {
+          case suffix_HASH:
             return FilterRuleName::suffix;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -43,7 +43,7 @@ GetBucketAccelerateConfigurationResult& GetBucketAccelerateConfigurationResult::
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = BucketAccelerateStatusMapper::GetBucketAccelerateStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = BucketAccelerateStatusMapper::GetBucketAccelerateStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -40,7 +40,7 @@ GetBucketLocationResult& GetBucketLocationResult::operator =(const AmazonWebServ
 
     if(!resultNode.IsNull())
     {
-        m_locationConstraint = BucketLocationConstraintMapper::GetBucketLocationConstraintForName(StringUtils::Trim(resultNode.GetText().c_str()).c_str());
+        m_locationConstraint = BucketLocationConstraintMapper::GetBucketLocationConstraintForName(resultNode.GetTextView().Trim().ToString().c_str());
     }
 
     return *this; 
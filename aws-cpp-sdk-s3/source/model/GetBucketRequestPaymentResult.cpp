@@ -43,7 +43,7 @@ GetBucketRequestPaymentResult& GetBucketRequestPaymentResult::operator =(const A
     XmlNode payerNode = resultNode.FirstChild("Payer");
     if(!payerNode.IsNull())
     {
-      m_payer = PayerMapper::GetPayerForName(StringUtils::Trim(payerNode.GetText().c_str()).c_str());
+      m_payer = PayerMapper::GetPayerForName(payerNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -43,12 +43,12 @@ GetBucketVersioningResult& GetBucketVersioningResult::operator =(const AmazonWeb
     XmlNode statusNode = resultNode.FirstChild("Status");
     if(!statusNode.IsNull())
     {
-      m_status = BucketVersioningStatusMapper::GetBucketVersioningStatusForName(StringUtils::Trim(statusNode.GetText().c_str()).c_str());
+      m_status = BucketVersioningStatusMapper::GetBucketVersioningStatusForName(statusNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode mFADeleteNode = resultNode.FirstChild("MfaDelete");
     if(!mFADeleteNode.IsNull())
     {
-      m_mFADelete = MFADeleteStatusMapper::GetMFADeleteStatusForName(StringUtils::Trim(mFADeleteNode.GetText().c_str()).c_str());
+      m_mFADelete = MFADeleteStatusMapper::GetMFADeleteStatusForName(mFADeleteNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -57,7 +57,7 @@ Grant& Grant::operator =(const XmlNode& xmlNode)
     XmlNode permissionNode = resultNode.FirstChild("Permission");
     if(!permissionNode.IsNull())
     {
-      m_permission = PermissionMapper::GetPermissionForName(StringUtils::Trim(permissionNode.GetText().c_str()).c_str());
+      m_permission = PermissionMapper::GetPermissionForName(permissionNode.GetTextView().Trim().ToString().c_str());
       m_permissionHasBeenSet = true;
     }
   }
@@ -57,31 +57,31 @@ Grantee& Grantee::operator =(const XmlNode& xmlNode)
     XmlNode displayNameNode = resultNode.FirstChild("DisplayName");
     if(!displayNameNode.IsNull())
     {
-      m_displayName = StringUtils::Trim(displayNameNode.GetText().c_str());
+      m_displayName = displayNameNode.GetTextView().Trim().ToString();
       m_displayNameHasBeenSet = true;
     }
     XmlNode emailAddressNode = resultNode.FirstChild("EmailAddress");
     if(!emailAddressNode.IsNull())
     {
-      m_emailAddress = StringUtils::Trim(emailAddressNode.GetText().c_str());
+      m_emailAddress = emailAddressNode.GetTextView().Trim().ToString();
       m_emailAddressHasBeenSet = true;
     }
     XmlNode iDNode = resultNode.FirstChild("ID");
     if(!iDNode.IsNull())
     {
-      m_iD = StringUtils::Trim(iDNode.GetText().c_str());
+      m_iD = iDNode.GetTextView().Trim().ToString();
       m_iDHasBeenSet = true;
     }
     XmlNode typeNode = resultNode.FirstChild("xsi:type");
     if(!typeNode.IsNull())
     {
-      m_type = TypeMapper::GetTypeForName(StringUtils::Trim(typeNode.GetText().c_str()).c_str());
+      m_type = TypeMapper::GetTypeForName(typeNode.GetTextView().Trim().ToString().c_str());
       m_typeHasBeenSet = true;
     }
     XmlNode uRINode = resultNode.FirstChild("URI");
     if(!uRINode.IsNull())
     {
-      m_uRI = StringUtils::Trim(uRINode.GetText().c_str());
+      m_uRI = uRINode.GetTextView().Trim().ToString();
       m_uRIHasBeenSet = true;
     }
   }
@@ -49,7 +49,7 @@ IndexDocument& IndexDocument::operator =(const XmlNode& xmlNode)
     XmlNode suffixNode = resultNode.FirstChild("Suffix");
     if(!suffixNode.IsNull())
     {
-      m_suffix = StringUtils::Trim(suffixNode.GetText().c_str());
+      m_suffix = suffixNode.GetTextView().Trim().ToString();
       m_suffixHasBeenSet = true;
     }
   }
@@ -55,13 +55,13 @@ LambdaFunctionConfiguration& LambdaFunctionConfiguration::operator =(const XmlNo
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode lambdaFunctionArnNode = resultNode.FirstChild("CloudFunction");
     if(!lambdaFunctionArnNode.IsNull())
     {
-      m_lambdaFunctionArn = StringUtils::Trim(lambdaFunctionArnNode.GetText().c_str());
+      m_lambdaFunctionArn = lambdaFunctionArnNode.GetTextView().Trim().ToString();
       m_lambdaFunctionArnHasBeenSet = true;
     }
     XmlNode eventsNode = resultNode.FirstChild("Event");
@@ -70,7 +70,7 @@ LambdaFunctionConfiguration& LambdaFunctionConfiguration::operator =(const XmlNo
       XmlNode eventMember = eventsNode;
       while(!eventMember.IsNull())
       {
-        m_events.push_back(EventMapper::GetEventForName(StringUtils::Trim(eventMember.GetText().c_str())));
+        m_events.push_back(EventMapper::GetEventForName(eventMember.GetTextView().Trim().ToString()));
         eventMember = eventMember.NextNode("Event");
       }
 
@@ -57,19 +57,19 @@ LifecycleExpiration& LifecycleExpiration::operator =(const XmlNode& xmlNode)
     XmlNode dateNode = resultNode.FirstChild("Date");
     if(!dateNode.IsNull())
     {
-      m_date = DateTime(StringUtils::Trim(dateNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_date = DateTime(dateNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_dateHasBeenSet = true;
     }
     XmlNode daysNode = resultNode.FirstChild("Days");
     if(!daysNode.IsNull())
     {
-      m_days = StringUtils::ConvertToInt32(StringUtils::Trim(daysNode.GetText().c_str()).c_str());
+      m_days = StringUtils::ConvertToInt32(daysNode.GetTextView().Trim().ToString().c_str());
       m_daysHasBeenSet = true;
     }
     XmlNode expiredObjectDeleteMarkerNode = resultNode.FirstChild("ExpiredObjectDeleteMarker");
     if(!expiredObjectDeleteMarkerNode.IsNull())
     {
-      m_expiredObjectDeleteMarker = StringUtils::ConvertToBool(StringUtils::Trim(expiredObjectDeleteMarkerNode.GetText().c_str()).c_str());
+      m_expiredObjectDeleteMarker = StringUtils::ConvertToBool(expiredObjectDeleteMarkerNode.GetTextView().Trim().ToString().c_str());
       m_expiredObjectDeleteMarkerHasBeenSet = true;
     }
   }
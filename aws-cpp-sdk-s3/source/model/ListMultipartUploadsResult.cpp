@@ -47,47 +47,47 @@ ListMultipartUploadsResult& ListMultipartUploadsResult::operator =(const AmazonW
     XmlNode bucketNode = resultNode.FirstChild("Bucket");
     if(!bucketNode.IsNull())
     {
-      m_bucket = StringUtils::Trim(bucketNode.GetText().c_str());
+      m_bucket = bucketNode.GetTextView().Trim().ToString();
     }
     XmlNode keyMarkerNode = resultNode.FirstChild("KeyMarker");
     if(!keyMarkerNode.IsNull())
     {
-      m_keyMarker = StringUtils::Trim(keyMarkerNode.GetText().c_str());
+      m_keyMarker = keyMarkerNode.GetTextView().Trim().ToString();
     }
     XmlNode uploadIdMarkerNode = resultNode.FirstChild("UploadIdMarker");
     if(!uploadIdMarkerNode.IsNull())
     {
-      m_uploadIdMarker = StringUtils::Trim(uploadIdMarkerNode.GetText().c_str());
+      m_uploadIdMarker = uploadIdMarkerNode.GetTextView().Trim().ToString();
     }
     XmlNode nextKeyMarkerNode = resultNode.FirstChild("NextKeyMarker");
     if(!nextKeyMarkerNode.IsNull())
     {
-      m_nextKeyMarker = StringUtils::Trim(nextKeyMarkerNode.GetText().c_str());
+      m_nextKeyMarker = nextKeyMarkerNode.GetTextView().Trim().ToString();
     }
     XmlNode prefixNode = resultNode.FirstChild("Prefix");
     if(!prefixNode.IsNull())
     {
-      m_prefix = StringUtils::Trim(prefixNode.GetText().c_str());
+      m_prefix = prefixNode.GetTextView().Trim().ToString();
     }
     XmlNode delimiterNode = resultNode.FirstChild("Delimiter");
     if(!delimiterNode.IsNull())
     {
-      m_delimiter = StringUtils::Trim(delimiterNode.GetText().c_str());
+      m_delimiter = delimiterNode.GetTextView().Trim().ToString();
     }
     XmlNode nextUploadIdMarkerNode = resultNode.FirstChild("NextUploadIdMarker");
     if(!nextUploadIdMarkerNode.IsNull())
     {
-      m_nextUploadIdMarker = StringUtils::Trim(nextUploadIdMarkerNode.GetText().c_str());
+      m_nextUploadIdMarker = nextUploadIdMarkerNode.GetTextView().Trim().ToString();
     }
     XmlNode maxUploadsNode = resultNode.FirstChild("MaxUploads");
     if(!maxUploadsNode.IsNull())
     {
-      m_maxUploads = StringUtils::ConvertToInt32(StringUtils::Trim(maxUploadsNode.GetText().c_str()).c_str());
+      m_maxUploads = StringUtils::ConvertToInt32(maxUploadsNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode isTruncatedNode = resultNode.FirstChild("IsTruncated");
     if(!isTruncatedNode.IsNull())
     {
-      m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(isTruncatedNode.GetText().c_str()).c_str());
+      m_isTruncated = StringUtils::ConvertToBool(isTruncatedNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode uploadsNode = resultNode.FirstChild("Upload");
     if(!uploadsNode.IsNull())
@@ -114,7 +114,7 @@ ListMultipartUploadsResult& ListMultipartUploadsResult::operator =(const AmazonW
     XmlNode encodingTypeNode = resultNode.FirstChild("EncodingType");
     if(!encodingTypeNode.IsNull())
     {
-      m_encodingType = EncodingTypeMapper::GetEncodingTypeForName(StringUtils::Trim(encodingTypeNode.GetText().c_str()).c_str());
+      m_encodingType = EncodingTypeMapper::GetEncodingTypeForName(encodingTypeNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
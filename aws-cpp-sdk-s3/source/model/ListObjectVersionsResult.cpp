@@ -47,27 +47,27 @@ ListObjectVersionsResult& ListObjectVersionsResult::operator =(const AmazonWebSe
     XmlNode isTruncatedNode = resultNode.FirstChild("IsTruncated");
     if(!isTruncatedNode.IsNull())
     {
-      m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(isTruncatedNode.GetText().c_str()).c_str());
+      m_isTruncated = StringUtils::ConvertToBool(isTruncatedNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode keyMarkerNode = resultNode.FirstChild("KeyMarker");
     if(!keyMarkerNode.IsNull())
     {
-      m_keyMarker = StringUtils::Trim(keyMarkerNode.GetText().c_str());
+      m_keyMarker = keyMarkerNode.GetTextView().Trim().ToString();
     }
     XmlNode versionIdMarkerNode = resultNode.FirstChild("VersionIdMarker");
     if(!versionIdMarkerNode.IsNull())
     {
-      m_versionIdMarker = StringUtils::Trim(versionIdMarkerNode.GetText().c_str());
+      m_versionIdMarker = versionIdMarkerNode.GetTextView().Trim().ToString();
     }
     XmlNode nextKeyMarkerNode = resultNode.FirstChild("NextKeyMarker");
     if(!nextKeyMarkerNode.IsNull())
     {
-      m_nextKeyMarker = StringUtils::Trim(nextKeyMarkerNode.GetText().c_str());
+      m_nextKeyMarker = nextKeyMarkerNode.GetTextView().Trim().ToString();
     }
     XmlNode nextVersionIdMarkerNode = resultNode.FirstChild("NextVersionIdMarker");
     if(!nextVersionIdMarkerNode.IsNull())
     {
-      m_nextVersionIdMarker = StringUtils::Trim(nextVersionIdMarkerNode.GetText().c_str());
+      m_nextVersionIdMarker = nextVersionIdMarkerNode.GetTextView().Trim().ToString();
     }
     XmlNode versionsNode = resultNode.FirstChild("Version");
     if(!versionsNode.IsNull())
@@ -94,22 +94,22 @@ ListObjectVersionsResult& ListObjectVersionsResult::operator =(const AmazonWebSe
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
     }
     XmlNode prefixNode = resultNode.FirstChild("Prefix");
     if(!prefixNode.IsNull())
     {
-      m_prefix = StringUtils::Trim(prefixNode.GetText().c_str());
+      m_prefix = prefixNode.GetTextView().Trim().ToString();
     }
     XmlNode delimiterNode = resultNode.FirstChild("Delimiter");
     if(!delimiterNode.IsNull())
     {
-      m_delimiter = StringUtils::Trim(delimiterNode.GetText().c_str());
+      m_delimiter = delimiterNode.GetTextView().Trim().ToString();
     }
     XmlNode maxKeysNode = resultNode.FirstChild("MaxKeys");
     if(!maxKeysNode.IsNull())
     {
-      m_maxKeys = StringUtils::ConvertToInt32(StringUtils::Trim(maxKeysNode.GetText().c_str()).c_str());
+      m_maxKeys = StringUtils::ConvertToInt32(maxKeysNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode commonPrefixesNode = resultNode.FirstChild("CommonPrefixes");
     if(!commonPrefixesNode.IsNull())
@@ -125,7 +125,7 @@ ListObjectVersionsResult& ListObjectVersionsResult::operator =(const AmazonWebSe
     XmlNode encodingTypeNode = resultNode.FirstChild("EncodingType");
     if(!encodingTypeNode.IsNull())
     {
-      m_encodingType = EncodingTypeMapper::GetEncodingTypeForName(StringUtils::Trim(encodingTypeNode.GetText().c_str()).c_str());
+      m_encodingType = EncodingTypeMapper::GetEncodingTypeForName(encodingTypeNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
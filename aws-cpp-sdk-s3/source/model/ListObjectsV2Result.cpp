@@ -49,7 +49,7 @@ ListObjectsV2Result& ListObjectsV2Result::operator =(const AmazonWebServiceResul
     XmlNode isTruncatedNode = resultNode.FirstChild("IsTruncated");
     if(!isTruncatedNode.IsNull())
     {
-      m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(isTruncatedNode.GetText().c_str()).c_str());
+      m_isTruncated = StringUtils::ConvertToBool(isTruncatedNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode contentsNode = resultNode.FirstChild("Contents");
     if(!contentsNode.IsNull())
@@ -65,22 +65,22 @@ ListObjectsV2Result& ListObjectsV2Result::operator =(const AmazonWebServiceResul
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
     }
     XmlNode prefixNode = resultNode.FirstChild("Prefix");
     if(!prefixNode.IsNull())
     {
-      m_prefix = StringUtils::Trim(prefixNode.GetText().c_str());
+      m_prefix = prefixNode.GetTextView().Trim().ToString();
     }
     XmlNode delimiterNode = resultNode.FirstChild("Delimiter");
     if(!delimiterNode.IsNull())
     {
-      m_delimiter = StringUtils::Trim(delimiterNode.GetText().c_str());
+      m_delimiter = delimiterNode.GetTextView().Trim().ToString();
     }
     XmlNode maxKeysNode = resultNode.FirstChild("MaxKeys");
     if(!maxKeysNode.IsNull())
     {
-      m_maxKeys = StringUtils::ConvertToInt32(StringUtils::Trim(maxKeysNode.GetText().c_str()).c_str());
+      m_maxKeys = StringUtils::ConvertToInt32(maxKeysNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode commonPrefixesNode = resultNode.FirstChild("CommonPrefixes");
     if(!commonPrefixesNode.IsNull())
@@ -96,27 +96,27 @@ ListObjectsV2Result& ListObjectsV2Result::operator =(const AmazonWebServiceResul
     XmlNode encodingTypeNode = resultNode.FirstChild("EncodingType");
     if(!encodingTypeNode.IsNull())
     {
-      m_encodingType = EncodingTypeMapper::GetEncodingTypeForName(StringUtils::Trim(encodingTypeNode.GetText().c_str()).c_str());
+      m_encodingType = EncodingTypeMapper::GetEncodingTypeForName(encodingTypeNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode keyCountNode = resultNode.FirstChild("KeyCount");
     if(!keyCountNode.IsNull())
     {
-      m_keyCount = StringUtils::ConvertToInt32(StringUtils::Trim(keyCountNode.GetText().c_str()).c_str());
+      m_keyCount = StringUtils::ConvertToInt32(keyCountNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode continuationTokenNode = resultNode.FirstChild("ContinuationToken");
     if(!continuationTokenNode.IsNull())
     {
-      m_continuationToken = StringUtils::Trim(continuationTokenNode.GetText().c_str());
+      m_continuationToken = continuationTokenNode.GetTextView().Trim().ToString();
     }
     XmlNode nextContinuationTokenNode = resultNode.FirstChild("NextContinuationToken");
     if(!nextContinuationTokenNode.IsNull())
     {
-      m_nextContinuationToken = StringUtils::Trim(nextContinuationTokenNode.GetText().c_str());
+      m_nextContinuationToken = nextContinuationTokenNode.GetTextView().Trim().ToString();
     }
     XmlNode startAfterNode = resultNode.FirstChild("StartAfter");
     if(!startAfterNode.IsNull())
     {
-      m_startAfter = StringUtils::Trim(startAfterNode.GetText().c_str());
+      m_startAfter = startAfterNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -52,37 +52,37 @@ ListPartsResult& ListPartsResult::operator =(const AmazonWebServiceResult<XmlDoc
     XmlNode bucketNode = resultNode.FirstChild("Bucket");
     if(!bucketNode.IsNull())
     {
-      m_bucket = StringUtils::Trim(bucketNode.GetText().c_str());
+      m_bucket = bucketNode.GetTextView().Trim().ToString();
     }
     XmlNode keyNode = resultNode.FirstChild("Key");
     if(!keyNode.IsNull())
     {
-      m_key = StringUtils::Trim(keyNode.GetText().c_str());
+      m_key = keyNode.GetTextView().Trim().ToString();
     }
     XmlNode uploadIdNode = resultNode.FirstChild("UploadId");
     if(!uploadIdNode.IsNull())
     {
-      m_uploadId = StringUtils::Trim(uploadIdNode.GetText().c_str());
+      m_uploadId = uploadIdNode.GetTextView().Trim().ToString();
     }
     XmlNode partNumberMarkerNode = resultNode.FirstChild("PartNumberMarker");
     if(!partNumberMarkerNode.IsNull())
     {
-      m_partNumberMarker = StringUtils::ConvertToInt32(StringUtils::Trim(partNumberMarkerNode.GetText().c_str()).c_str());
+      m_partNumberMarker = StringUtils::ConvertToInt32(partNumberMarkerNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode nextPartNumberMarkerNode = resultNode.FirstChild("NextPartNumberMarker");
     if(!nextPartNumberMarkerNode.IsNull())
     {
-      m_nextPartNumberMarker = StringUtils::ConvertToInt32(StringUtils::Trim(nextPartNumberMarkerNode.GetText().c_str()).c_str());
+      m_nextPartNumberMarker = StringUtils::ConvertToInt32(nextPartNumberMarkerNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode maxPartsNode = resultNode.FirstChild("MaxParts");
     if(!maxPartsNode.IsNull())
     {
-      m_maxParts = StringUtils::ConvertToInt32(StringUtils::Trim(maxPartsNode.GetText().c_str()).c_str());
+      m_maxParts = StringUtils::ConvertToInt32(maxPartsNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode isTruncatedNode = resultNode.FirstChild("IsTruncated");
     if(!isTruncatedNode.IsNull())
     {
-      m_isTruncated = StringUtils::ConvertToBool(StringUtils::Trim(isTruncatedNode.GetText().c_str()).c_str());
+      m_isTruncated = StringUtils::ConvertToBool(isTruncatedNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode partsNode = resultNode.FirstChild("Part");
     if(!partsNode.IsNull())
@@ -108,7 +108,7 @@ ListPartsResult& ListPartsResult::operator =(const AmazonWebServiceResult<XmlDoc
     XmlNode storageClassNode = resultNode.FirstChild("StorageClass");
     if(!storageClassNode.IsNull())
     {
-      m_storageClass = StorageClassMapper::GetStorageClassForName(StringUtils::Trim(storageClassNode.GetText().c_str()).c_str());
+      m_storageClass = StorageClassMapper::GetStorageClassForName(storageClassNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
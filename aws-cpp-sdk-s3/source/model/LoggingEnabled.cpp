@@ -53,7 +53,7 @@ LoggingEnabled& LoggingEnabled::operator =(const XmlNode& xmlNode)
     XmlNode targetBucketNode = resultNode.FirstChild("TargetBucket");
     if(!targetBucketNode.IsNull())
     {
-      m_targetBucket = StringUtils::Trim(targetBucketNode.GetText().c_str());
+      m_targetBucket = targetBucketNode.GetTextView().Trim().ToString();
       m_targetBucketHasBeenSet = true;
     }
     XmlNode targetGrantsNode = resultNode.FirstChild("TargetGrants");
@@ -71,7 +71,7 @@ LoggingEnabled& LoggingEnabled::operator =(const XmlNode& xmlNode)
     XmlNode targetPrefixNode = resultNode.FirstChild("TargetPrefix");
     if(!targetPrefixNode.IsNull())
     {
-      m_targetPrefix = StringUtils::Trim(targetPrefixNode.GetText().c_str());
+      m_targetPrefix = targetPrefixNode.GetTextView().Trim().ToString();
       m_targetPrefixHasBeenSet = true;
     }
   }
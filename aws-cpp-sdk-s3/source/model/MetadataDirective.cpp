@@ -29,21 +29,29 @@ namespace Aws
       namespace MetadataDirectiveMapper
       {
 
-        static const int COPY_HASH = HashingUtils::HashString("COPY");
-        static const int REPLACE_HASH = HashingUtils::HashString("REPLACE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int COPY_HASH = 2074485;
+        static const int REPLACE_HASH = 1812479636;
 
 
         MetadataDirective GetMetadataDirectiveForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COPY_HASH)
+          switch (hashCode)
           {
+          case COPY_HASH:
             return MetadataDirective::COPY;
-          }
-          else if (hashCode == REPLACE_HASH)
-          {
+          case REPLACE_HASH:
             return MetadataDirective::REPLACE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
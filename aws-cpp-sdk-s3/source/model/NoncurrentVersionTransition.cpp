@@ -53,13 +53,13 @@ NoncurrentVersionTransition& NoncurrentVersionTransition::operator =(const XmlNo
     XmlNode noncurrentDaysNode = resultNode.FirstChild("NoncurrentDays");
     if(!noncurrentDaysNode.IsNull())
     {
-      m_noncurrentDays = StringUtils::ConvertToInt32(StringUtils::Trim(noncurrentDaysNode.GetText().c_str()).c_str());
+      m_noncurrentDays = StringUtils::ConvertToInt32(noncurrentDaysNode.GetTextView().Trim().ToString().c_str());
       m_noncurrentDaysHasBeenSet = true;
     }
     XmlNode storageClassNode = resultNode.FirstChild("StorageClass");
     if(!storageClassNode.IsNull())
     {
-      m_storageClass = TransitionStorageClassMapper::GetTransitionStorageClassForName(StringUtils::Trim(storageClassNode.GetText().c_str()).c_str());
+      m_storageClass = TransitionStorageClassMapper::GetTransitionStorageClassForName(storageClassNode.GetTextView().Trim().ToString().c_str());
       m_storageClassHasBeenSet = true;
     }
   }
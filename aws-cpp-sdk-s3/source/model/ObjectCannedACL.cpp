@@ -29,46 +29,44 @@ namespace Aws
       namespace ObjectCannedACLMapper
       {
 
-        static const int private__HASH = HashingUtils::HashString("private");
-        static const int public_read_HASH = HashingUtils::HashString("public-read");
-        static const int public_read_write_HASH = HashingUtils::HashString("public-read-write");
-        static const int authenticated_read_HASH = HashingUtils::HashString("authenticated-read");
-        static const int aws_exec_read_HASH = HashingUtils::HashString("aws-exec-read");
-        static const int bucket_owner_read_HASH = HashingUtils::HashString("bucket-owner-read");
-        static const int bucket_owner_full_control_HASH = HashingUtils::HashString("bucket-owner-full-control");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int private__HASH = -314497661;
+        static const int public_read_HASH = -1126309254;
+        static const int public_read_write_HASH = -1397683508;
+        static const int authenticated_read_HASH = 2076511348;
+        static const int aws_exec_read_HASH = -2116027774;
+        static const int bucket_owner_read_HASH = 18410547;
+        static const int bucket_owner_full_control_HASH = -1751248452;
 
 
         ObjectCannedACL GetObjectCannedACLForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == private__HASH)
+          switch (hashCode)
           {
+          case private__HASH:
             return ObjectCannedACL::private_;
-          }
-          else if (hashCode == public_read_HASH)
-          {
+          case public_read_HASH:
             return ObjectCannedACL::public_read;
-          }
-          else if (hashCode == public_read_write_HASH)
-          {
+          case public_read_write_HASH:
             return ObjectCannedACL::public_read_write;
-          }
-          else if (hashCode == authenticated_read_HASH)
-          {
+          case authenticated_read_HASH:
             return ObjectCannedACL::authenticated_read;
-          }
-          else if (hashCode == aws_exec_read_HASH)
-          {
+          case aws_exec_read_HASH:
             return ObjectCannedACL::aws_exec_read;
-          }
-          else if (hashCode == bucket_owner_read_HASH)
-          {
+          case bucket_owner_read_HASH:
             return ObjectCannedACL::bucket_owner_read;
-          }
-          else if (hashCode == bucket_owner_full_control_HASH)
-          {
+          case bucket_owner_full_control_HASH:
             return ObjectCannedACL::bucket_owner_full_control;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
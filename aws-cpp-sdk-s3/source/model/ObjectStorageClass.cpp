@@ -29,26 +29,32 @@ namespace Aws
       namespace ObjectStorageClassMapper
       {
 
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-        static const int REDUCED_REDUNDANCY_HASH = HashingUtils::HashString("REDUCED_REDUNDANCY");
-        static const int GLACIER_HASH = HashingUtils::HashString("GLACIER");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int STANDARD_HASH = 2095255229;
+        static const int REDUCED_REDUNDANCY_HASH = 246938206;
+        static const int GLACIER_HASH = 826164623;
 
 
         ObjectStorageClass GetObjectStorageClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STANDARD_HASH)
+          switch (hashCode)
           {
+          case STANDARD_HASH:
             return ObjectStorageClass::STANDARD;
-          }
-          else if (hashCode == REDUCED_REDUNDANCY_HASH)
-          {
+          case REDUCED_REDUNDANCY_HASH:
             return ObjectStorageClass::REDUCED_REDUNDANCY;
-          }
-          else if (hashCode == GLACIER_HASH)
-          {
+          case GLACIER_HASH:
             return ObjectStorageClass::GLACIER;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
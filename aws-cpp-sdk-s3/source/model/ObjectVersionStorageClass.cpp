@@ -29,16 +29,26 @@ namespace Aws
       namespace ObjectVersionStorageClassMapper
       {
 
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int STANDARD_HASH = 2095255229;
 
 
         ObjectVersionStorageClass GetObjectVersionStorageClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STANDARD_HASH)
+          switch (hashCode)
           {
+          case STANDARD_HASH:
             return ObjectVersionStorageClass::STANDARD;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
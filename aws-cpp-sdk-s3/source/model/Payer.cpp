@@ -29,21 +29,29 @@ namespace Aws
       namespace PayerMapper
       {
 
-        static const int Requester_HASH = HashingUtils::HashString("Requester");
-        static const int BucketOwner_HASH = HashingUtils::HashString("BucketOwner");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Requester_HASH = -1597065380;
+        static const int BucketOwner_HASH = 1936982729;
 
 
         Payer GetPayerForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Requester_HASH)
+          switch (hashCode)
           {
+          case Requester_HASH:
             return Payer::Requester;
-          }
-          else if (hashCode == BucketOwner_HASH)
-          {
+          case BucketOwner_HASH:
             return Payer::BucketOwner;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
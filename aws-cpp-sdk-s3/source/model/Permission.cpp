@@ -29,36 +29,38 @@ namespace Aws
       namespace PermissionMapper
       {
 
-        static const int FULL_CONTROL_HASH = HashingUtils::HashString("FULL_CONTROL");
-        static const int WRITE_HASH = HashingUtils::HashString("WRITE");
-        static const int WRITE_ACP_HASH = HashingUtils::HashString("WRITE_ACP");
-        static const int READ_HASH = HashingUtils::HashString("READ");
-        static const int READ_ACP_HASH = HashingUtils::HashString("READ_ACP");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int FULL_CONTROL_HASH = 78885773;
+        static const int WRITE_HASH = 82862015;
+        static const int WRITE_ACP_HASH = 1381536750;
+        static const int READ_HASH = 2511254;
+        static const int READ_ACP_HASH = -83639739;
 
 
         Permission GetPermissionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FULL_CONTROL_HASH)
+          switch (hashCode)
           {
+          case FULL_CONTROL_HASH:
             return Permission::FULL_CONTROL;
-          }
-          else if (hashCode == WRITE_HASH)
-          {
+          case WRITE_HASH:
             return Permission::WRITE;
-          }
-          else if (hashCode == WRITE_ACP_HASH)
-          {
+          case WRITE_ACP_HASH:
             return Permission::WRITE_ACP;
-          }
-          else if (hashCode == READ_HASH)
-          {
+          case READ_HASH:
             return Permission::READ;
-          }
-          else if (hashCode == READ_ACP_HASH)
-          {
+          case READ_ACP_HASH:
             return Permission::READ_ACP;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
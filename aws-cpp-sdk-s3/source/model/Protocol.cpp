@@ -29,21 +29,29 @@ namespace Aws
       namespace ProtocolMapper
       {
 
-        static const int http_HASH = HashingUtils::HashString("http");
-        static const int https_HASH = HashingUtils::HashString("https");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int http_HASH = 3213448;
+        static const int https_HASH = 99617003;
 
 
         Protocol GetProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == http_HASH)
+          switch (hashCode)
           {
+          case http_HASH:
             return Protocol::http;
-          }
-          else if (hashCode == https_HASH)
-          {
+          case https_HASH:
             return Protocol::https;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -55,13 +55,13 @@ QueueConfiguration& QueueConfiguration::operator =(const XmlNode& xmlNode)
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode queueArnNode = resultNode.FirstChild("Queue");
     if(!queueArnNode.IsNull())
     {
-      m_queueArn = StringUtils::Trim(queueArnNode.GetText().c_str());
+      m_queueArn = queueArnNode.GetTextView().Trim().ToString();
       m_queueArnHasBeenSet = true;
     }
     XmlNode eventsNode = resultNode.FirstChild("Event");
@@ -70,7 +70,7 @@ QueueConfiguration& QueueConfiguration::operator =(const XmlNode& xmlNode)
       XmlNode eventMember = eventsNode;
       while(!eventMember.IsNull())
       {
-        m_events.push_back(EventMapper::GetEventForName(StringUtils::Trim(eventMember.GetText().c_str())));
+        m_events.push_back(EventMapper::GetEventForName(eventMember.GetTextView().Trim().ToString()));
         eventMember = eventMember.NextNode("Event");
       }
 
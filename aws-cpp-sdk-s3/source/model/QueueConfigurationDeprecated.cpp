@@ -53,7 +53,7 @@ QueueConfigurationDeprecated& QueueConfigurationDeprecated::operator =(const Xml
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode eventsNode = resultNode.FirstChild("Event");
@@ -62,7 +62,7 @@ QueueConfigurationDeprecated& QueueConfigurationDeprecated::operator =(const Xml
       XmlNode eventMember = eventsNode;
       while(!eventMember.IsNull())
       {
-        m_events.push_back(EventMapper::GetEventForName(StringUtils::Trim(eventMember.GetText().c_str())));
+        m_events.push_back(EventMapper::GetEventForName(eventMember.GetTextView().Trim().ToString()));
         eventMember = eventMember.NextNode("Event");
       }
 
@@ -71,7 +71,7 @@ QueueConfigurationDeprecated& QueueConfigurationDeprecated::operator =(const Xml
     XmlNode queueNode = resultNode.FirstChild("Queue");
     if(!queueNode.IsNull())
     {
-      m_queue = StringUtils::Trim(queueNode.GetText().c_str());
+      m_queue = queueNode.GetTextView().Trim().ToString();
       m_queueHasBeenSet = true;
     }
   }
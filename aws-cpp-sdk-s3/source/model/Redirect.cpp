@@ -57,31 +57,31 @@ Redirect& Redirect::operator =(const XmlNode& xmlNode)
     XmlNode hostNameNode = resultNode.FirstChild("HostName");
     if(!hostNameNode.IsNull())
     {
-      m_hostName = StringUtils::Trim(hostNameNode.GetText().c_str());
+      m_hostName = hostNameNode.GetTextView().Trim().ToString();
       m_hostNameHasBeenSet = true;
     }
     XmlNode httpRedirectCodeNode = resultNode.FirstChild("HttpRedirectCode");
     if(!httpRedirectCodeNode.IsNull())
     {
-      m_httpRedirectCode = StringUtils::Trim(httpRedirectCodeNode.GetText().c_str());
+      m_httpRedirectCode = httpRedirectCodeNode.GetTextView().Trim().ToString();
       m_httpRedirectCodeHasBeenSet = true;
     }
     XmlNode protocolNode = resultNode.FirstChild("Protocol");
     if(!protocolNode.IsNull())
     {
-      m_protocol = ProtocolMapper::GetProtocolForName(StringUtils::Trim(protocolNode.GetText().c_str()).c_str());
+      m_protocol = ProtocolMapper::GetProtocolForName(protocolNode.GetTextView().Trim().ToString().c_str());
       m_protocolHasBeenSet = true;
     }
     XmlNode replaceKeyPrefixWithNode = resultNode.FirstChild("ReplaceKeyPrefixWith");
     if(!replaceKeyPrefixWithNode.IsNull())
     {
-      m_replaceKeyPrefixWith = StringUtils::Trim(replaceKeyPrefixWithNode.GetText().c_str());
+      m_replaceKeyPrefixWith = replaceKeyPrefixWithNode.GetTextView().Trim().ToString();
       m_replaceKeyPrefixWithHasBeenSet = true;
     }
     XmlNode replaceKeyWithNode = resultNode.FirstChild("ReplaceKeyWith");
     if(!replaceKeyWithNode.IsNull())
     {
-      m_replaceKeyWith = StringUtils::Trim(replaceKeyWithNode.GetText().c_str());
+      m_replaceKeyWith = replaceKeyWithNode.GetTextView().Trim().ToString();
       m_replaceKeyWithHasBeenSet = true;
     }
   }
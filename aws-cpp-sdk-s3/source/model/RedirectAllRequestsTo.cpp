@@ -51,13 +51,13 @@ RedirectAllRequestsTo& RedirectAllRequestsTo::operator =(const XmlNode& xmlNode)
     XmlNode hostNameNode = resultNode.FirstChild("HostName");
     if(!hostNameNode.IsNull())
     {
-      m_hostName = StringUtils::Trim(hostNameNode.GetText().c_str());
+      m_hostName = hostNameNode.GetTextView().Trim().ToString();
       m_hostNameHasBeenSet = true;
     }
     XmlNode protocolNode = resultNode.FirstChild("Protocol");
     if(!protocolNode.IsNull())
     {
-      m_protocol = ProtocolMapper::GetProtocolForName(StringUtils::Trim(protocolNode.GetText().c_str()).c_str());
+      m_protocol = ProtocolMapper::GetProtocolForName(protocolNode.GetTextView().Trim().ToString().c_str());
       m_protocolHasBeenSet = true;
     }
   }
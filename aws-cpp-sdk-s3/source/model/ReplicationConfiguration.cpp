@@ -51,7 +51,7 @@ ReplicationConfiguration& ReplicationConfiguration::operator =(const XmlNode& xm
     XmlNode roleNode = resultNode.FirstChild("Role");
     if(!roleNode.IsNull())
     {
-      m_role = StringUtils::Trim(roleNode.GetText().c_str());
+      m_role = roleNode.GetTextView().Trim().ToString();
       m_roleHasBeenSet = true;
     }
     XmlNode rulesNode = resultNode.FirstChild("Rule");
@@ -29,31 +29,35 @@ namespace Aws
       namespace ReplicationStatusMapper
       {
 
-        static const int COMPLETE_HASH = HashingUtils::HashString("COMPLETE");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int REPLICA_HASH = HashingUtils::HashString("REPLICA");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int COMPLETE_HASH = 183181625;
+        static const int PENDING_HASH = 35394935;
+        static const int FAILED_HASH = 2066319421;
+        static const int REPLICA_HASH = 1812487320;
 
 
         ReplicationStatus GetReplicationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMPLETE_HASH)
+          switch (hashCode)
           {
+          case COMPLETE_HASH:
             return ReplicationStatus::COMPLETE;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
+          case PENDING_HASH:
             return ReplicationStatus::PENDING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return ReplicationStatus::FAILED;
-          }
-          else if (hashCode == REPLICA_HASH)
-          {
+          case REPLICA_HASH:
             return ReplicationStatus::REPLICA;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
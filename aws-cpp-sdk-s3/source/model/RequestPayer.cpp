@@ -29,16 +29,26 @@ namespace Aws
       namespace RequestPayerMapper
       {
 
-        static const int requester_HASH = HashingUtils::HashString("requester");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int requester_HASH = 693933948;
 
 
         RequestPayer GetRequestPayerForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == requester_HASH)
+          switch (hashCode)
           {
+          case requester_HASH:
             return RequestPayer::requester;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
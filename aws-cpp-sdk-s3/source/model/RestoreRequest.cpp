@@ -51,7 +51,7 @@ RestoreRequest& RestoreRequest::operator =(const XmlNode& xmlNode)
     XmlNode daysNode = resultNode.FirstChild("Days");
     if(!daysNode.IsNull())
     {
-      m_days = StringUtils::ConvertToInt32(StringUtils::Trim(daysNode.GetText().c_str()).c_str());
+      m_days = StringUtils::ConvertToInt32(daysNode.GetTextView().Trim().ToString().c_str());
       m_daysHasBeenSet = true;
     }
   }
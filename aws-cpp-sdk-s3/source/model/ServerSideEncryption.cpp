@@ -29,21 +29,29 @@ namespace Aws
       namespace ServerSideEncryptionMapper
       {
 
-        static const int AES256_HASH = HashingUtils::HashString("AES256");
-        static const int aws_kms_HASH = HashingUtils::HashString("aws:kms");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int AES256_HASH = 1927140164;
+        static const int aws_kms_HASH = -591548076;
 
 
         ServerSideEncryption GetServerSideEncryptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AES256_HASH)
+          switch (hashCode)
           {
+          case AES256_HASH:
             return ServerSideEncryption::AES256;
-          }
-          else if (hashCode == aws_kms_HASH)
-          {
+          case aws_kms_HASH:
             return ServerSideEncryption::aws_kms;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
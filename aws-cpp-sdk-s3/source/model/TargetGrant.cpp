@@ -57,7 +57,7 @@ TargetGrant& TargetGrant::operator =(const XmlNode& xmlNode)
     XmlNode permissionNode = resultNode.FirstChild("Permission");
     if(!permissionNode.IsNull())
     {
-      m_permission = BucketLogsPermissionMapper::GetBucketLogsPermissionForName(StringUtils::Trim(permissionNode.GetText().c_str()).c_str());
+      m_permission = BucketLogsPermissionMapper::GetBucketLogsPermissionForName(permissionNode.GetTextView().Trim().ToString().c_str());
       m_permissionHasBeenSet = true;
     }
   }
@@ -55,13 +55,13 @@ TopicConfiguration& TopicConfiguration::operator =(const XmlNode& xmlNode)
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode topicArnNode = resultNode.FirstChild("Topic");
     if(!topicArnNode.IsNull())
     {
-      m_topicArn = StringUtils::Trim(topicArnNode.GetText().c_str());
+      m_topicArn = topicArnNode.GetTextView().Trim().ToString();
       m_topicArnHasBeenSet = true;
     }
     XmlNode eventsNode = resultNode.FirstChild("Event");
@@ -70,7 +70,7 @@ TopicConfiguration& TopicConfiguration::operator =(const XmlNode& xmlNode)
       XmlNode eventMember = eventsNode;
       while(!eventMember.IsNull())
       {
-        m_events.push_back(EventMapper::GetEventForName(StringUtils::Trim(eventMember.GetText().c_str())));
+        m_events.push_back(EventMapper::GetEventForName(eventMember.GetTextView().Trim().ToString()));
         eventMember = eventMember.NextNode("Event");
       }
 
@@ -29,21 +29,29 @@ namespace Aws
       namespace TransitionStorageClassMapper
       {
 
-        static const int GLACIER_HASH = HashingUtils::HashString("GLACIER");
-        static const int STANDARD_IA_HASH = HashingUtils::HashString("STANDARD_IA");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int GLACIER_HASH = 826164623;
+        static const int STANDARD_IA_HASH = 988907994;
 
 
         TransitionStorageClass GetTransitionStorageClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GLACIER_HASH)
+          switch (hashCode)
           {
+          case GLACIER_HASH:
             return TransitionStorageClass::GLACIER;
-          }
-          else if (hashCode == STANDARD_IA_HASH)
-          {
+          case STANDARD_IA_HASH:
             return TransitionStorageClass::STANDARD_IA;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
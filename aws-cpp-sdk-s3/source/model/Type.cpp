@@ -29,26 +29,32 @@ namespace Aws
       namespace TypeMapper
       {
 
-        static const int CanonicalUser_HASH = HashingUtils::HashString("CanonicalUser");
-        static const int AmazonCustomerByEmail_HASH = HashingUtils::HashString("AmazonCustomerByEmail");
-        static const int Group_HASH = HashingUtils::HashString("Group");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CanonicalUser_HASH = -1373398337;
+        static const int AmazonCustomerByEmail_HASH = 2111195395;
+        static const int Group_HASH = 69076575;
 
 
         Type GetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CanonicalUser_HASH)
+          switch (hashCode)
           {
+          case CanonicalUser_HASH:
             return Type::CanonicalUser;
-          }
-          else if (hashCode == AmazonCustomerByEmail_HASH)
-          {
+          case AmazonCustomerByEmail_HASH:
             return Type::AmazonCustomerByEmail;
-          }
-          else if (hashCode == Group_HASH)
-          {
+          case Group_HASH:
             return Type::Group;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -26,6 +26,9 @@
 #include <aws/sdb/model/SelectResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -190,6 +193,18 @@ namespace Model
          */
         virtual void BatchDeleteAttributesAsync(const Model::BatchDeleteAttributesRequest& request, const BatchDeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchDeleteAttributesCallable(const Model::BatchDeleteAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BatchDeleteAttributesOutcomeCallable BatchDeleteAttributesCallable(Model::BatchDeleteAttributesRequest&& request) const;
+
+        /**
+         * Same as BatchDeleteAttributesAsync(const Model::BatchDeleteAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BatchDeleteAttributesAsync(Model::BatchDeleteAttributesRequest&& request, const BatchDeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> The <code>BatchPutAttributes</code> operation creates or replaces attributes
          * within one or more items. By using this operation, the client can perform
@@ -320,6 +335,18 @@ namespace Model
          */
         virtual void BatchPutAttributesAsync(const Model::BatchPutAttributesRequest& request, const BatchPutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchPutAttributesCallable(const Model::BatchPutAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::BatchPutAttributesOutcomeCallable BatchPutAttributesCallable(Model::BatchPutAttributesRequest&& request) const;
+
+        /**
+         * Same as BatchPutAttributesAsync(const Model::BatchPutAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void BatchPutAttributesAsync(Model::BatchPutAttributesRequest&& request, const BatchPutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> The <code>CreateDomain</code> operation creates a new domain. The domain
          * name should be unique among the domains associated with the Access Key ID
@@ -357,6 +384,18 @@ namespace Model
          */
         virtual void CreateDomainAsync(const Model::CreateDomainRequest& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDomainCallable(const Model::CreateDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDomainOutcomeCallable CreateDomainCallable(Model::CreateDomainRequest&& request) const;
+
+        /**
+         * Same as CreateDomainAsync(const Model::CreateDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDomainAsync(Model::CreateDomainRequest&& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes one or more attributes associated with an item. If all attributes of
          * the item are deleted, the item is deleted. </p> <p>
@@ -400,6 +439,18 @@ namespace Model
          */
         virtual void DeleteAttributesAsync(const Model::DeleteAttributesRequest& request, const DeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAttributesCallable(const Model::DeleteAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteAttributesOutcomeCallable DeleteAttributesCallable(Model::DeleteAttributesRequest&& request) const;
+
+        /**
+         * Same as DeleteAttributesAsync(const Model::DeleteAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteAttributesAsync(Model::DeleteAttributesRequest&& request, const DeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> The <code>DeleteDomain</code> operation deletes a domain. Any items (and
          * their attributes) in the domain are deleted as well. The
@@ -428,6 +479,18 @@ namespace Model
          */
         virtual void DeleteDomainAsync(const Model::DeleteDomainRequest& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDomainCallable(const Model::DeleteDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDomainOutcomeCallable DeleteDomainCallable(Model::DeleteDomainRequest&& request) const;
+
+        /**
+         * Same as DeleteDomainAsync(const Model::DeleteDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDomainAsync(Model::DeleteDomainRequest&& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns information about the domain, including when the domain was created,
          * the number of items and attributes in the domain, and the size of the attribute
@@ -453,6 +516,18 @@ namespace Model
          */
         virtual void DomainMetadataAsync(const Model::DomainMetadataRequest& request, const DomainMetadataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DomainMetadataCallable(const Model::DomainMetadataRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DomainMetadataOutcomeCallable DomainMetadataCallable(Model::DomainMetadataRequest&& request) const;
+
+        /**
+         * Same as DomainMetadataAsync(const Model::DomainMetadataRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DomainMetadataAsync(Model::DomainMetadataRequest&& request, const DomainMetadataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns all of the attributes associated with the specified item.
          * Optionally, the attributes returned can be limited to one or more attributes by
@@ -487,6 +562,18 @@ namespace Model
          */
         virtual void GetAttributesAsync(const Model::GetAttributesRequest& request, const GetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAttributesCallable(const Model::GetAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetAttributesOutcomeCallable GetAttributesCallable(Model::GetAttributesRequest&& request) const;
+
+        /**
+         * Same as GetAttributesAsync(const Model::GetAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetAttributesAsync(Model::GetAttributesRequest&& request, const GetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> The <code>ListDomains</code> operation lists all domains associated with the
          * Access Key ID. It returns domain names up to the limit set by <a
@@ -527,6 +614,18 @@ namespace Model
          */
         virtual void ListDomainsAsync(const Model::ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDomainsCallable(const Model::ListDomainsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDomainsOutcomeCallable ListDomainsCallable(Model::ListDomainsRequest&& request) const;
+
+        /**
+         * Same as ListDomainsAsync(const Model::ListDomainsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDomainsAsync(Model::ListDomainsRequest&& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> The PutAttributes operation creates or replaces attributes in an item. The
          * client may specify new attributes using a combination of the
@@ -630,6 +729,18 @@ namespace Model
          */
         virtual void PutAttributesAsync(const Model::PutAttributesRequest& request, const PutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutAttributesCallable(const Model::PutAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PutAttributesOutcomeCallable PutAttributesCallable(Model::PutAttributesRequest&& request) const;
+
+        /**
+         * Same as PutAttributesAsync(const Model::PutAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PutAttributesAsync(Model::PutAttributesRequest&& request, const PutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> The <code>Select</code> operation returns a set of attributes for
          * <code>ItemNames</code> that match the select expression. <code>Select</code> is
@@ -676,6 +787,80 @@ namespace Model
          */
         virtual void SelectAsync(const Model::SelectRequest& request, const SelectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SelectCallable(const Model::SelectRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SelectOutcomeCallable SelectCallable(Model::SelectRequest&& request) const;
+
+        /**
+         * Same as SelectAsync(const Model::SelectRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SelectAsync(Model::SelectRequest&& request, const SelectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListDomains(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SimpleDBClient, Model::ListDomainsRequest, Model::ListDomainsOutcome> ListDomainsPaginator(const Model::ListDomainsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through Select(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SimpleDBClient, Model::SelectRequest, Model::SelectOutcome> SelectPaginator(const Model::SelectRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of BatchDeleteAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SimpleDBClient, Model::BatchDeleteAttributesRequest, Model::BatchDeleteAttributesOutcome> BatchDeleteAttributesAwaitable(Model::BatchDeleteAttributesRequest request) const;
+
+        /**
+         * co_await-able form of BatchPutAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SimpleDBClient, Model::BatchPutAttributesRequest, Model::BatchPutAttributesOutcome> BatchPutAttributesAwaitable(Model::BatchPutAttributesRequest request) const;
+
+        /**
+         * co_await-able form of CreateDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SimpleDBClient, Model::CreateDomainRequest, Model::CreateDomainOutcome> CreateDomainAwaitable(Model::CreateDomainRequest request) const;
+
+        /**
+         * co_await-able form of DeleteAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SimpleDBClient, Model::DeleteAttributesRequest, Model::DeleteAttributesOutcome> DeleteAttributesAwaitable(Model::DeleteAttributesRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SimpleDBClient, Model::DeleteDomainRequest, Model::DeleteDomainOutcome> DeleteDomainAwaitable(Model::DeleteDomainRequest request) const;
+
+        /**
+         * co_await-able form of DomainMetadata(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SimpleDBClient, Model::DomainMetadataRequest, Model::DomainMetadataOutcome> DomainMetadataAwaitable(Model::DomainMetadataRequest request) const;
+
+        /**
+         * co_await-able form of GetAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SimpleDBClient, Model::GetAttributesRequest, Model::GetAttributesOutcome> GetAttributesAwaitable(Model::GetAttributesRequest request) const;
+
+        /**
+         * co_await-able form of ListDomains(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SimpleDBClient, Model::ListDomainsRequest, Model::ListDomainsOutcome> ListDomainsAwaitable(Model::ListDomainsRequest request) const;
+
+        /**
+         * co_await-able form of PutAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SimpleDBClient, Model::PutAttributesRequest, Model::PutAttributesOutcome> PutAttributesAwaitable(Model::PutAttributesRequest request) const;
+
+        /**
+         * co_await-able form of Select(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SimpleDBClient, Model::SelectRequest, Model::SelectOutcome> SelectAwaitable(Model::SelectRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
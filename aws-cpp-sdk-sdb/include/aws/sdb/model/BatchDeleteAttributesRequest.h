@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     BatchDeleteAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "BatchDeleteAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     BatchPutAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "BatchPutAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
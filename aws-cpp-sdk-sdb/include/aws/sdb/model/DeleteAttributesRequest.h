@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DeleteAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DomainMetadataRequest();
+    inline const char* GetServiceRequestName() const override { return "DomainMetadata"; }
+
     Aws::String SerializePayload() const override;
 
     /**
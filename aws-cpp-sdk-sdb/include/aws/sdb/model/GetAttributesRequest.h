@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
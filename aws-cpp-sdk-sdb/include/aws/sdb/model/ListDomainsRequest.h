@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListDomainsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListDomains"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     PutAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "PutAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     SelectRequest();
+    inline const char* GetServiceRequestName() const override { return "Select"; }
+
     Aws::String SerializePayload() const override;
 
     /**
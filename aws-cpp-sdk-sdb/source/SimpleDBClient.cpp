@@ -119,7 +119,7 @@ BatchDeleteAttributesOutcome SimpleDBClient::BatchDeleteAttributes(const BatchDe
 
 BatchDeleteAttributesOutcomeCallable SimpleDBClient::BatchDeleteAttributesCallable(const BatchDeleteAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BatchDeleteAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BatchDeleteAttributes( request ); } );
 }
 
 void SimpleDBClient::BatchDeleteAttributesAsync(const BatchDeleteAttributesRequest& request, const BatchDeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -127,6 +127,16 @@ void SimpleDBClient::BatchDeleteAttributesAsync(const BatchDeleteAttributesReque
   m_executor->Submit( [this, request, handler, context](){ this->BatchDeleteAttributesAsyncHelper( request, handler, context ); } );
 }
 
+BatchDeleteAttributesOutcomeCallable SimpleDBClient::BatchDeleteAttributesCallable(BatchDeleteAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SimpleDBClient::BatchDeleteAttributes, this, std::move(request)));
+}
+
+void SimpleDBClient::BatchDeleteAttributesAsync(BatchDeleteAttributesRequest&& request, const BatchDeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SimpleDBClient::BatchDeleteAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SimpleDBClient::BatchDeleteAttributesAsyncHelper(const BatchDeleteAttributesRequest& request, const BatchDeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BatchDeleteAttributes(request), context);
@@ -149,7 +159,7 @@ BatchPutAttributesOutcome SimpleDBClient::BatchPutAttributes(const BatchPutAttri
 
 BatchPutAttributesOutcomeCallable SimpleDBClient::BatchPutAttributesCallable(const BatchPutAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->BatchPutAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->BatchPutAttributes( request ); } );
 }
 
 void SimpleDBClient::BatchPutAttributesAsync(const BatchPutAttributesRequest& request, const BatchPutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -157,6 +167,16 @@ void SimpleDBClient::BatchPutAttributesAsync(const BatchPutAttributesRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->BatchPutAttributesAsyncHelper( request, handler, context ); } );
 }
 
+BatchPutAttributesOutcomeCallable SimpleDBClient::BatchPutAttributesCallable(BatchPutAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SimpleDBClient::BatchPutAttributes, this, std::move(request)));
+}
+
+void SimpleDBClient::BatchPutAttributesAsync(BatchPutAttributesRequest&& request, const BatchPutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SimpleDBClient::BatchPutAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SimpleDBClient::BatchPutAttributesAsyncHelper(const BatchPutAttributesRequest& request, const BatchPutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, BatchPutAttributes(request), context);
@@ -179,7 +199,7 @@ CreateDomainOutcome SimpleDBClient::CreateDomain(const CreateDomainRequest& requ
 
 CreateDomainOutcomeCallable SimpleDBClient::CreateDomainCallable(const CreateDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDomain( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDomain( request ); } );
 }
 
 void SimpleDBClient::CreateDomainAsync(const CreateDomainRequest& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -187,6 +207,16 @@ void SimpleDBClient::CreateDomainAsync(const CreateDomainRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->CreateDomainAsyncHelper( request, handler, context ); } );
 }
 
+CreateDomainOutcomeCallable SimpleDBClient::CreateDomainCallable(CreateDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SimpleDBClient::CreateDomain, this, std::move(request)));
+}
+
+void SimpleDBClient::CreateDomainAsync(CreateDomainRequest&& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SimpleDBClient::CreateDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SimpleDBClient::CreateDomainAsyncHelper(const CreateDomainRequest& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDomain(request), context);
@@ -209,7 +239,7 @@ DeleteAttributesOutcome SimpleDBClient::DeleteAttributes(const DeleteAttributesR
 
 DeleteAttributesOutcomeCallable SimpleDBClient::DeleteAttributesCallable(const DeleteAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteAttributes( request ); } );
 }
 
 void SimpleDBClient::DeleteAttributesAsync(const DeleteAttributesRequest& request, const DeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -217,6 +247,16 @@ void SimpleDBClient::DeleteAttributesAsync(const DeleteAttributesRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->DeleteAttributesAsyncHelper( request, handler, context ); } );
 }
 
+DeleteAttributesOutcomeCallable SimpleDBClient::DeleteAttributesCallable(DeleteAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SimpleDBClient::DeleteAttributes, this, std::move(request)));
+}
+
+void SimpleDBClient::DeleteAttributesAsync(DeleteAttributesRequest&& request, const DeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SimpleDBClient::DeleteAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SimpleDBClient::DeleteAttributesAsyncHelper(const DeleteAttributesRequest& request, const DeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteAttributes(request), context);
@@ -239,7 +279,7 @@ DeleteDomainOutcome SimpleDBClient::DeleteDomain(const DeleteDomainRequest& requ
 
 DeleteDomainOutcomeCallable SimpleDBClient::DeleteDomainCallable(const DeleteDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDomain( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDomain( request ); } );
 }
 
 void SimpleDBClient::DeleteDomainAsync(const DeleteDomainRequest& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -247,6 +287,16 @@ void SimpleDBClient::DeleteDomainAsync(const DeleteDomainRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDomainAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDomainOutcomeCallable SimpleDBClient::DeleteDomainCallable(DeleteDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SimpleDBClient::DeleteDomain, this, std::move(request)));
+}
+
+void SimpleDBClient::DeleteDomainAsync(DeleteDomainRequest&& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SimpleDBClient::DeleteDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SimpleDBClient::DeleteDomainAsyncHelper(const DeleteDomainRequest& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDomain(request), context);
@@ -269,7 +319,7 @@ DomainMetadataOutcome SimpleDBClient::DomainMetadata(const DomainMetadataRequest
 
 DomainMetadataOutcomeCallable SimpleDBClient::DomainMetadataCallable(const DomainMetadataRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DomainMetadata( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DomainMetadata( request ); } );
 }
 
 void SimpleDBClient::DomainMetadataAsync(const DomainMetadataRequest& request, const DomainMetadataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -277,6 +327,16 @@ void SimpleDBClient::DomainMetadataAsync(const DomainMetadataRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->DomainMetadataAsyncHelper( request, handler, context ); } );
 }
 
+DomainMetadataOutcomeCallable SimpleDBClient::DomainMetadataCallable(DomainMetadataRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SimpleDBClient::DomainMetadata, this, std::move(request)));
+}
+
+void SimpleDBClient::DomainMetadataAsync(DomainMetadataRequest&& request, const DomainMetadataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SimpleDBClient::DomainMetadataAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SimpleDBClient::DomainMetadataAsyncHelper(const DomainMetadataRequest& request, const DomainMetadataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DomainMetadata(request), context);
@@ -299,7 +359,7 @@ GetAttributesOutcome SimpleDBClient::GetAttributes(const GetAttributesRequest& r
 
 GetAttributesOutcomeCallable SimpleDBClient::GetAttributesCallable(const GetAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetAttributes( request ); } );
 }
 
 void SimpleDBClient::GetAttributesAsync(const GetAttributesRequest& request, const GetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -307,6 +367,16 @@ void SimpleDBClient::GetAttributesAsync(const GetAttributesRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->GetAttributesAsyncHelper( request, handler, context ); } );
 }
 
+GetAttributesOutcomeCallable SimpleDBClient::GetAttributesCallable(GetAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SimpleDBClient::GetAttributes, this, std::move(request)));
+}
+
+void SimpleDBClient::GetAttributesAsync(GetAttributesRequest&& request, const GetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SimpleDBClient::GetAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SimpleDBClient::GetAttributesAsyncHelper(const GetAttributesRequest& request, const GetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetAttributes(request), context);
@@ -329,7 +399,7 @@ ListDomainsOutcome SimpleDBClient::ListDomains(const ListDomainsRequest& request
 
 ListDomainsOutcomeCallable SimpleDBClient::ListDomainsCallable(const ListDomainsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDomains( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDomains( request ); } );
 }
 
 void SimpleDBClient::ListDomainsAsync(const ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -337,6 +407,16 @@ void SimpleDBClient::ListDomainsAsync(const ListDomainsRequest& request, const L
   m_executor->Submit( [this, request, handler, context](){ this->ListDomainsAsyncHelper( request, handler, context ); } );
 }
 
+ListDomainsOutcomeCallable SimpleDBClient::ListDomainsCallable(ListDomainsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SimpleDBClient::ListDomains, this, std::move(request)));
+}
+
+void SimpleDBClient::ListDomainsAsync(ListDomainsRequest&& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SimpleDBClient::ListDomainsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SimpleDBClient::ListDomainsAsyncHelper(const ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDomains(request), context);
@@ -359,7 +439,7 @@ PutAttributesOutcome SimpleDBClient::PutAttributes(const PutAttributesRequest& r
 
 PutAttributesOutcomeCallable SimpleDBClient::PutAttributesCallable(const PutAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PutAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PutAttributes( request ); } );
 }
 
 void SimpleDBClient::PutAttributesAsync(const PutAttributesRequest& request, const PutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -367,6 +447,16 @@ void SimpleDBClient::PutAttributesAsync(const PutAttributesRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->PutAttributesAsyncHelper( request, handler, context ); } );
 }
 
+PutAttributesOutcomeCallable SimpleDBClient::PutAttributesCallable(PutAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SimpleDBClient::PutAttributes, this, std::move(request)));
+}
+
+void SimpleDBClient::PutAttributesAsync(PutAttributesRequest&& request, const PutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SimpleDBClient::PutAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SimpleDBClient::PutAttributesAsyncHelper(const PutAttributesRequest& request, const PutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PutAttributes(request), context);
@@ -389,7 +479,7 @@ SelectOutcome SimpleDBClient::Select(const SelectRequest& request) const
 
 SelectOutcomeCallable SimpleDBClient::SelectCallable(const SelectRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->Select( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->Select( request ); } );
 }
 
 void SimpleDBClient::SelectAsync(const SelectRequest& request, const SelectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -397,8 +487,104 @@ void SimpleDBClient::SelectAsync(const SelectRequest& request, const SelectRespo
   m_executor->Submit( [this, request, handler, context](){ this->SelectAsyncHelper( request, handler, context ); } );
 }
 
+SelectOutcomeCallable SimpleDBClient::SelectCallable(SelectRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SimpleDBClient::Select, this, std::move(request)));
+}
+
+void SimpleDBClient::SelectAsync(SelectRequest&& request, const SelectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SimpleDBClient::SelectAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SimpleDBClient::SelectAsyncHelper(const SelectRequest& request, const SelectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, Select(request), context);
 }
 
+Paginator<SimpleDBClient, ListDomainsRequest, ListDomainsOutcome> SimpleDBClient::ListDomainsPaginator(const ListDomainsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SimpleDBClient, ListDomainsRequest, ListDomainsOutcome>(this, &SimpleDBClient::ListDomains, request,
+    [](const ListDomainsRequest& current, const ListDomainsOutcome& outcome, ListDomainsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SimpleDBClient, SelectRequest, SelectOutcome> SimpleDBClient::SelectPaginator(const SelectRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SimpleDBClient, SelectRequest, SelectOutcome>(this, &SimpleDBClient::Select, request,
+    [](const SelectRequest& current, const SelectOutcome& outcome, SelectRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<SimpleDBClient, BatchDeleteAttributesRequest, BatchDeleteAttributesOutcome> SimpleDBClient::BatchDeleteAttributesAwaitable(BatchDeleteAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SimpleDBClient::BatchDeleteAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SimpleDBClient, BatchPutAttributesRequest, BatchPutAttributesOutcome> SimpleDBClient::BatchPutAttributesAwaitable(BatchPutAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SimpleDBClient::BatchPutAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SimpleDBClient, CreateDomainRequest, CreateDomainOutcome> SimpleDBClient::CreateDomainAwaitable(CreateDomainRequest request) const
+{
+  return { m_executor.get(), { this, &SimpleDBClient::CreateDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<SimpleDBClient, DeleteAttributesRequest, DeleteAttributesOutcome> SimpleDBClient::DeleteAttributesAwaitable(DeleteAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SimpleDBClient::DeleteAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SimpleDBClient, DeleteDomainRequest, DeleteDomainOutcome> SimpleDBClient::DeleteDomainAwaitable(DeleteDomainRequest request) const
+{
+  return { m_executor.get(), { this, &SimpleDBClient::DeleteDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<SimpleDBClient, DomainMetadataRequest, DomainMetadataOutcome> SimpleDBClient::DomainMetadataAwaitable(DomainMetadataRequest request) const
+{
+  return { m_executor.get(), { this, &SimpleDBClient::DomainMetadata, std::move(request) } };
+}
+
+ClientOperationAwaitable<SimpleDBClient, GetAttributesRequest, GetAttributesOutcome> SimpleDBClient::GetAttributesAwaitable(GetAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SimpleDBClient::GetAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SimpleDBClient, ListDomainsRequest, ListDomainsOutcome> SimpleDBClient::ListDomainsAwaitable(ListDomainsRequest request) const
+{
+  return { m_executor.get(), { this, &SimpleDBClient::ListDomains, std::move(request) } };
+}
+
+ClientOperationAwaitable<SimpleDBClient, PutAttributesRequest, PutAttributesOutcome> SimpleDBClient::PutAttributesAwaitable(PutAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SimpleDBClient::PutAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SimpleDBClient, SelectRequest, SelectOutcome> SimpleDBClient::SelectAwaitable(SelectRequest request) const
+{
+  return { m_executor.get(), { this, &SimpleDBClient::Select, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -55,25 +55,25 @@ Attribute& Attribute::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode alternateNameEncodingNode = resultNode.FirstChild("AlternateNameEncoding");
     if(!alternateNameEncodingNode.IsNull())
     {
-      m_alternateNameEncoding = StringUtils::Trim(alternateNameEncodingNode.GetText().c_str());
+      m_alternateNameEncoding = alternateNameEncodingNode.GetTextView().Trim().ToString();
       m_alternateNameEncodingHasBeenSet = true;
     }
     XmlNode valueNode = resultNode.FirstChild("Value");
     if(!valueNode.IsNull())
     {
-      m_value = StringUtils::Trim(valueNode.GetText().c_str());
+      m_value = valueNode.GetTextView().Trim().ToString();
       m_valueHasBeenSet = true;
     }
     XmlNode alternateValueEncodingNode = resultNode.FirstChild("AlternateValueEncoding");
     if(!alternateValueEncodingNode.IsNull())
     {
-      m_alternateValueEncoding = StringUtils::Trim(alternateValueEncodingNode.GetText().c_str());
+      m_alternateValueEncoding = alternateValueEncodingNode.GetTextView().Trim().ToString();
       m_alternateValueEncodingHasBeenSet = true;
     }
   }
@@ -85,22 +85,22 @@ void Attribute::OutputToStream(Aws::OStream& oStream, const char* location, unsi
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_alternateNameEncodingHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AlternateNameEncoding=" << StringUtils::URLEncode(m_alternateNameEncoding.c_str()) << "&";
+      oStream << location << index << locationValue << ".AlternateNameEncoding=" << StringUtils::URLEncoded(m_alternateNameEncoding) << "&";
   }
 
   if(m_valueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 
   if(m_alternateValueEncodingHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AlternateValueEncoding=" << StringUtils::URLEncode(m_alternateValueEncoding.c_str()) << "&";
+      oStream << location << index << locationValue << ".AlternateValueEncoding=" << StringUtils::URLEncoded(m_alternateValueEncoding) << "&";
   }
 
 }
@@ -109,19 +109,19 @@ void Attribute::OutputToStream(Aws::OStream& oStream, const char* location) cons
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_alternateNameEncodingHasBeenSet)
   {
-      oStream << location << ".AlternateNameEncoding=" << StringUtils::URLEncode(m_alternateNameEncoding.c_str()) << "&";
+      oStream << location << ".AlternateNameEncoding=" << StringUtils::URLEncoded(m_alternateNameEncoding) << "&";
   }
   if(m_valueHasBeenSet)
   {
-      oStream << location << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
   if(m_alternateValueEncodingHasBeenSet)
   {
-      oStream << location << ".AlternateValueEncoding=" << StringUtils::URLEncode(m_alternateValueEncoding.c_str()) << "&";
+      oStream << location << ".AlternateValueEncoding=" << StringUtils::URLEncoded(m_alternateValueEncoding) << "&";
   }
 }
 
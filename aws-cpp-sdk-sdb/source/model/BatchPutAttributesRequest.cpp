@@ -15,6 +15,7 @@
 #include <aws/sdb/model/BatchPutAttributesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SimpleDB::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ BatchPutAttributesRequest::BatchPutAttributesRequest() :
 
 Aws::String BatchPutAttributesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=BatchPutAttributes&";
   if(m_domainNameHasBeenSet)
   {
-    ss << "DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+    ss << "DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
 
   if(m_itemsHasBeenSet)
@@ -45,6 +46,6 @@ Aws::String BatchPutAttributesRequest::SerializePayload() const
   }
 
   ss << "Version=2009-04-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -51,7 +52,7 @@ DeletableItem& DeletableItem::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("ItemName");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode attributesNode = resultNode.FirstChild("Attribute");
@@ -75,7 +76,7 @@ void DeletableItem::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_attributesHasBeenSet)
@@ -83,9 +84,9 @@ void DeletableItem::OutputToStream(Aws::OStream& oStream, const char* location,
       unsigned attributesIdx = 1;
       for(auto& item : m_attributes)
       {
-        Aws::StringStream attributesSs;
+        Aws::Utils::Stream::StringOutputStream attributesSs;
         attributesSs << location << index << locationValue << ".Attribute." << attributesIdx++;
-        item.OutputToStream(oStream, attributesSs.str().c_str());
+        item.OutputToStream(oStream, attributesSs.GetString().c_str());
       }
   }
 
@@ -95,16 +96,16 @@ void DeletableItem::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_attributesHasBeenSet)
   {
       unsigned attributesIdx = 1;
       for(auto& item : m_attributes)
       {
-        Aws::StringStream attributesSs;
+        Aws::Utils::Stream::StringOutputStream attributesSs;
         attributesSs << location <<  ".Attribute." << attributesIdx++;
-        item.OutputToStream(oStream, attributesSs.str().c_str());
+        item.OutputToStream(oStream, attributesSs.GetString().c_str());
       }
   }
 }
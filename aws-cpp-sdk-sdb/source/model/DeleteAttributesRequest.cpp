@@ -15,6 +15,7 @@
 #include <aws/sdb/model/DeleteAttributesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SimpleDB::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ DeleteAttributesRequest::DeleteAttributesRequest() :
 
 Aws::String DeleteAttributesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteAttributes&";
   if(m_domainNameHasBeenSet)
   {
-    ss << "DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+    ss << "DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
 
   if(m_itemNameHasBeenSet)
   {
-    ss << "ItemName=" << StringUtils::URLEncode(m_itemName.c_str()) << "&";
+    ss << "ItemName=" << StringUtils::URLEncoded(m_itemName) << "&";
   }
 
   if(m_attributesHasBeenSet)
@@ -57,6 +58,6 @@ Aws::String DeleteAttributesRequest::SerializePayload() const
   }
 
   ss << "Version=2009-04-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
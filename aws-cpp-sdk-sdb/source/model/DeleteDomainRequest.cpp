@@ -15,6 +15,7 @@
 #include <aws/sdb/model/DeleteDomainRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SimpleDB::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteDomainRequest::DeleteDomainRequest() :
 
 Aws::String DeleteDomainRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteDomain&";
   if(m_domainNameHasBeenSet)
   {
-    ss << "DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+    ss << "DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
 
   ss << "Version=2009-04-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/sdb/model/GetAttributesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SimpleDB::Model;
 using namespace Aws::Utils;
@@ -30,16 +31,16 @@ GetAttributesRequest::GetAttributesRequest() :
 
 Aws::String GetAttributesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetAttributes&";
   if(m_domainNameHasBeenSet)
   {
-    ss << "DomainName=" << StringUtils::URLEncode(m_domainName.c_str()) << "&";
+    ss << "DomainName=" << StringUtils::URLEncoded(m_domainName) << "&";
   }
 
   if(m_itemNameHasBeenSet)
   {
-    ss << "ItemName=" << StringUtils::URLEncode(m_itemName.c_str()) << "&";
+    ss << "ItemName=" << StringUtils::URLEncoded(m_itemName) << "&";
   }
 
   if(m_attributeNamesHasBeenSet)
@@ -48,7 +49,7 @@ Aws::String GetAttributesRequest::SerializePayload() const
     for(auto& item : m_attributeNames)
     {
       ss << "AttributeName." << attributeNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       attributeNamesCount++;
     }
   }
@@ -59,6 +60,6 @@ Aws::String GetAttributesRequest::SerializePayload() const
   }
 
   ss << "Version=2009-04-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ GetAttributesResult& GetAttributesResult::operator =(const AmazonWebServiceResul
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetAttributesResult")
+  if (rootNode.GetNameView() != "GetAttributesResult")
   {
     resultNode = rootNode.FirstChild("GetAttributesResult");
   }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -53,13 +54,13 @@ Item& Item::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode alternateNameEncodingNode = resultNode.FirstChild("AlternateNameEncoding");
     if(!alternateNameEncodingNode.IsNull())
     {
-      m_alternateNameEncoding = StringUtils::Trim(alternateNameEncodingNode.GetText().c_str());
+      m_alternateNameEncoding = alternateNameEncodingNode.GetTextView().Trim().ToString();
       m_alternateNameEncodingHasBeenSet = true;
     }
     XmlNode attributesNode = resultNode.FirstChild("Attribute");
@@ -83,12 +84,12 @@ void Item::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_alternateNameEncodingHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AlternateNameEncoding=" << StringUtils::URLEncode(m_alternateNameEncoding.c_str()) << "&";
+      oStream << location << index << locationValue << ".AlternateNameEncoding=" << StringUtils::URLEncoded(m_alternateNameEncoding) << "&";
   }
 
   if(m_attributesHasBeenSet)
@@ -96,9 +97,9 @@ void Item::OutputToStream(Aws::OStream& oStream, const char* location, unsigned
       unsigned attributesIdx = 1;
       for(auto& item : m_attributes)
       {
-        Aws::StringStream attributesSs;
+        Aws::Utils::Stream::StringOutputStream attributesSs;
         attributesSs << location << index << locationValue << ".Attribute." << attributesIdx++;
-        item.OutputToStream(oStream, attributesSs.str().c_str());
+        item.OutputToStream(oStream, attributesSs.GetString().c_str());
       }
   }
 
@@ -108,20 +109,20 @@ void Item::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_alternateNameEncodingHasBeenSet)
   {
-      oStream << location << ".AlternateNameEncoding=" << StringUtils::URLEncode(m_alternateNameEncoding.c_str()) << "&";
+      oStream << location << ".AlternateNameEncoding=" << StringUtils::URLEncoded(m_alternateNameEncoding) << "&";
   }
   if(m_attributesHasBeenSet)
   {
       unsigned attributesIdx = 1;
       for(auto& item : m_attributes)
       {
-        Aws::StringStream attributesSs;
+        Aws::Utils::Stream::StringOutputStream attributesSs;
         attributesSs << location <<  ".Attribute." << attributesIdx++;
-        item.OutputToStream(oStream, attributesSs.str().c_str());
+        item.OutputToStream(oStream, attributesSs.GetString().c_str());
       }
   }
 }
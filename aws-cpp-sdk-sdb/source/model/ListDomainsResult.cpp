@@ -40,7 +40,7 @@ ListDomainsResult& ListDomainsResult::operator =(const AmazonWebServiceResult<Xm
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListDomainsResult")
+  if (rootNode.GetNameView() != "ListDomainsResult")
   {
     resultNode = rootNode.FirstChild("ListDomainsResult");
   }
@@ -53,7 +53,7 @@ ListDomainsResult& ListDomainsResult::operator =(const AmazonWebServiceResult<Xm
       XmlNode domainNameMember = domainNamesNode;
       while(!domainNameMember.IsNull())
       {
-        m_domainNames.push_back(StringUtils::Trim(domainNameMember.GetText().c_str()));
+        m_domainNames.push_back(domainNameMember.GetTextView().Trim().ToString());
         domainNameMember = domainNameMember.NextNode("DomainName");
       }
 
@@ -61,7 +61,7 @@ ListDomainsResult& ListDomainsResult::operator =(const AmazonWebServiceResult<Xm
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
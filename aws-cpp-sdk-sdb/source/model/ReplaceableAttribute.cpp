@@ -55,19 +55,19 @@ ReplaceableAttribute& ReplaceableAttribute::operator =(const XmlNode& xmlNode)
     XmlNode nameNode = resultNode.FirstChild("Name");
     if(!nameNode.IsNull())
     {
-      m_name = StringUtils::Trim(nameNode.GetText().c_str());
+      m_name = nameNode.GetTextView().Trim().ToString();
       m_nameHasBeenSet = true;
     }
     XmlNode valueNode = resultNode.FirstChild("Value");
     if(!valueNode.IsNull())
     {
-      m_value = StringUtils::Trim(valueNode.GetText().c_str());
+      m_value = valueNode.GetTextView().Trim().ToString();
       m_valueHasBeenSet = true;
     }
     XmlNode replaceNode = resultNode.FirstChild("Replace");
     if(!replaceNode.IsNull())
     {
-      m_replace = StringUtils::ConvertToBool(StringUtils::Trim(replaceNode.GetText().c_str()).c_str());
+      m_replace = StringUtils::ConvertToBool(replaceNode.GetTextView().Trim().ToString().c_str());
       m_replaceHasBeenSet = true;
     }
   }
@@ -79,12 +79,12 @@ void ReplaceableAttribute::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << index << locationValue << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_valueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << index << locationValue << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
 
   if(m_replaceHasBeenSet)
@@ -98,11 +98,11 @@ void ReplaceableAttribute::OutputToStream(Aws::OStream& oStream, const char* loc
 {
   if(m_nameHasBeenSet)
   {
-      oStream << location << ".Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+      oStream << location << ".Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
   if(m_valueHasBeenSet)
   {
-      oStream << location << ".Value=" << StringUtils::URLEncode(m_value.c_str()) << "&";
+      oStream << location << ".Value=" << StringUtils::URLEncoded(m_value) << "&";
   }
   if(m_replaceHasBeenSet)
   {
@@ -15,6 +15,7 @@
 #include <aws/sdb/model/SelectRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SimpleDB::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ SelectRequest::SelectRequest() :
 
 Aws::String SelectRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=Select&";
   if(m_selectExpressionHasBeenSet)
   {
-    ss << "SelectExpression=" << StringUtils::URLEncode(m_selectExpression.c_str()) << "&";
+    ss << "SelectExpression=" << StringUtils::URLEncoded(m_selectExpression) << "&";
   }
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   if(m_consistentReadHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String SelectRequest::SerializePayload() const
   }
 
   ss << "Version=2009-04-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
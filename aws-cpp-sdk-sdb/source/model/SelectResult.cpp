@@ -40,7 +40,7 @@ SelectResult& SelectResult::operator =(const AmazonWebServiceResult<XmlDocument>
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SelectResult")
+  if (rootNode.GetNameView() != "SelectResult")
   {
     resultNode = rootNode.FirstChild("SelectResult");
   }
@@ -61,7 +61,7 @@ SelectResult& SelectResult::operator =(const AmazonWebServiceResult<XmlDocument>
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
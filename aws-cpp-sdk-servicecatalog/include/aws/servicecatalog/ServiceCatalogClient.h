@@ -32,6 +32,9 @@
 #include <aws/servicecatalog/model/TerminateProvisionedProductResult.h>
 #include <aws/servicecatalog/model/UpdateProvisionedProductResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -193,6 +196,18 @@ namespace Model
          */
         virtual void DescribeProductAsync(const Model::DescribeProductRequest& request, const DescribeProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeProductCallable(const Model::DescribeProductRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeProductOutcomeCallable DescribeProductCallable(Model::DescribeProductRequest&& request) const;
+
+        /**
+         * Same as DescribeProductAsync(const Model::DescribeProductRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeProductAsync(Model::DescribeProductRequest&& request, const DescribeProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about a specified product.</p> <p>This operation is
          * functionally identical to <a>DescribeProduct</a> except that it takes as input
@@ -218,6 +233,18 @@ namespace Model
          */
         virtual void DescribeProductViewAsync(const Model::DescribeProductViewRequest& request, const DescribeProductViewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeProductViewCallable(const Model::DescribeProductViewRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeProductViewOutcomeCallable DescribeProductViewCallable(Model::DescribeProductViewRequest&& request) const;
+
+        /**
+         * Same as DescribeProductViewAsync(const Model::DescribeProductViewRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeProductViewAsync(Model::DescribeProductViewRequest&& request, const DescribeProductViewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides information about parameters required to provision a specified
          * product in a specified manner. Use this operation to obtain the list of
@@ -246,6 +273,18 @@ namespace Model
          */
         virtual void DescribeProvisioningParametersAsync(const Model::DescribeProvisioningParametersRequest& request, const DescribeProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeProvisioningParametersCallable(const Model::DescribeProvisioningParametersRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeProvisioningParametersOutcomeCallable DescribeProvisioningParametersCallable(Model::DescribeProvisioningParametersRequest&& request) const;
+
+        /**
+         * Same as DescribeProvisioningParametersAsync(const Model::DescribeProvisioningParametersRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeProvisioningParametersAsync(Model::DescribeProvisioningParametersRequest&& request, const DescribeProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a paginated list of the full details of a specific request. Use
          * this operation after calling a request operation (<a>ProvisionProduct</a>,
@@ -271,6 +310,18 @@ namespace Model
          */
         virtual void DescribeRecordAsync(const Model::DescribeRecordRequest& request, const DescribeRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRecordCallable(const Model::DescribeRecordRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeRecordOutcomeCallable DescribeRecordCallable(Model::DescribeRecordRequest&& request) const;
+
+        /**
+         * Same as DescribeRecordAsync(const Model::DescribeRecordRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeRecordAsync(Model::DescribeRecordRequest&& request, const DescribeRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a paginated list of all paths to a specified product. A path is how
          * the user has access to a specified product, and is necessary when provisioning a
@@ -296,6 +347,18 @@ namespace Model
          */
         virtual void ListLaunchPathsAsync(const Model::ListLaunchPathsRequest& request, const ListLaunchPathsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListLaunchPathsCallable(const Model::ListLaunchPathsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListLaunchPathsOutcomeCallable ListLaunchPathsCallable(Model::ListLaunchPathsRequest&& request) const;
+
+        /**
+         * Same as ListLaunchPathsAsync(const Model::ListLaunchPathsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListLaunchPathsAsync(Model::ListLaunchPathsRequest&& request, const ListLaunchPathsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a paginated list of all performed requests, in the form of
          * RecordDetails objects that are filtered as specified.</p>
@@ -318,6 +381,18 @@ namespace Model
          */
         virtual void ListRecordHistoryAsync(const Model::ListRecordHistoryRequest& request, const ListRecordHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRecordHistoryCallable(const Model::ListRecordHistoryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListRecordHistoryOutcomeCallable ListRecordHistoryCallable(Model::ListRecordHistoryRequest&& request) const;
+
+        /**
+         * Same as ListRecordHistoryAsync(const Model::ListRecordHistoryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListRecordHistoryAsync(Model::ListRecordHistoryRequest&& request, const ListRecordHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a <i>Provision</i> of a specified product. A
          * <i>ProvisionedProduct</i> is a resourced instance for a product. For example,
@@ -352,6 +427,18 @@ namespace Model
          */
         virtual void ProvisionProductAsync(const Model::ProvisionProductRequest& request, const ProvisionProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ProvisionProductCallable(const Model::ProvisionProductRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ProvisionProductOutcomeCallable ProvisionProductCallable(Model::ProvisionProductRequest&& request) const;
+
+        /**
+         * Same as ProvisionProductAsync(const Model::ProvisionProductRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ProvisionProductAsync(Model::ProvisionProductRequest&& request, const ProvisionProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a paginated list of all the ProvisionedProduct objects that are
          * currently available (not terminated). </p>
@@ -374,6 +461,18 @@ namespace Model
          */
         virtual void ScanProvisionedProductsAsync(const Model::ScanProvisionedProductsRequest& request, const ScanProvisionedProductsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ScanProvisionedProductsCallable(const Model::ScanProvisionedProductsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ScanProvisionedProductsOutcomeCallable ScanProvisionedProductsCallable(Model::ScanProvisionedProductsRequest&& request) const;
+
+        /**
+         * Same as ScanProvisionedProductsAsync(const Model::ScanProvisionedProductsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ScanProvisionedProductsAsync(Model::ScanProvisionedProductsRequest&& request, const ScanProvisionedProductsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a paginated list all of the <code>Products</code> objects to which
          * the caller has access. </p> <p>The output of this operation can be used as input
@@ -399,6 +498,18 @@ namespace Model
          */
         virtual void SearchProductsAsync(const Model::SearchProductsRequest& request, const SearchProductsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SearchProductsCallable(const Model::SearchProductsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SearchProductsOutcomeCallable SearchProductsCallable(Model::SearchProductsRequest&& request) const;
+
+        /**
+         * Same as SearchProductsAsync(const Model::SearchProductsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SearchProductsAsync(Model::SearchProductsRequest&& request, const SearchProductsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests termination of an existing ProvisionedProduct object. If there are
          * <code>Tags</code> associated with the object, they are terminated when the
@@ -430,6 +541,18 @@ namespace Model
          */
         virtual void TerminateProvisionedProductAsync(const Model::TerminateProvisionedProductRequest& request, const TerminateProvisionedProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TerminateProvisionedProductCallable(const Model::TerminateProvisionedProductRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TerminateProvisionedProductOutcomeCallable TerminateProvisionedProductCallable(Model::TerminateProvisionedProductRequest&& request) const;
+
+        /**
+         * Same as TerminateProvisionedProductAsync(const Model::TerminateProvisionedProductRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TerminateProvisionedProductAsync(Model::TerminateProvisionedProductRequest&& request, const TerminateProvisionedProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests updates to the configuration of an existing ProvisionedProduct
          * object. If there are tags associated with the object, they cannot be updated or
@@ -464,6 +587,100 @@ namespace Model
          */
         virtual void UpdateProvisionedProductAsync(const Model::UpdateProvisionedProductRequest& request, const UpdateProvisionedProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateProvisionedProductCallable(const Model::UpdateProvisionedProductRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateProvisionedProductOutcomeCallable UpdateProvisionedProductCallable(Model::UpdateProvisionedProductRequest&& request) const;
+
+        /**
+         * Same as UpdateProvisionedProductAsync(const Model::UpdateProvisionedProductRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateProvisionedProductAsync(Model::UpdateProvisionedProductRequest&& request, const UpdateProvisionedProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeRecord(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ServiceCatalogClient, Model::DescribeRecordRequest, Model::DescribeRecordOutcome> DescribeRecordPaginator(const Model::DescribeRecordRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListLaunchPaths(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ServiceCatalogClient, Model::ListLaunchPathsRequest, Model::ListLaunchPathsOutcome> ListLaunchPathsPaginator(const Model::ListLaunchPathsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListRecordHistory(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ServiceCatalogClient, Model::ListRecordHistoryRequest, Model::ListRecordHistoryOutcome> ListRecordHistoryPaginator(const Model::ListRecordHistoryRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ScanProvisionedProducts(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ServiceCatalogClient, Model::ScanProvisionedProductsRequest, Model::ScanProvisionedProductsOutcome> ScanProvisionedProductsPaginator(const Model::ScanProvisionedProductsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through SearchProducts(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<ServiceCatalogClient, Model::SearchProductsRequest, Model::SearchProductsOutcome> SearchProductsPaginator(const Model::SearchProductsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of DescribeProduct(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ServiceCatalogClient, Model::DescribeProductRequest, Model::DescribeProductOutcome> DescribeProductAwaitable(Model::DescribeProductRequest request) const;
+
+        /**
+         * co_await-able form of DescribeProductView(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ServiceCatalogClient, Model::DescribeProductViewRequest, Model::DescribeProductViewOutcome> DescribeProductViewAwaitable(Model::DescribeProductViewRequest request) const;
+
+        /**
+         * co_await-able form of DescribeProvisioningParameters(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ServiceCatalogClient, Model::DescribeProvisioningParametersRequest, Model::DescribeProvisioningParametersOutcome> DescribeProvisioningParametersAwaitable(Model::DescribeProvisioningParametersRequest request) const;
+
+        /**
+         * co_await-able form of DescribeRecord(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ServiceCatalogClient, Model::DescribeRecordRequest, Model::DescribeRecordOutcome> DescribeRecordAwaitable(Model::DescribeRecordRequest request) const;
+
+        /**
+         * co_await-able form of ListLaunchPaths(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ServiceCatalogClient, Model::ListLaunchPathsRequest, Model::ListLaunchPathsOutcome> ListLaunchPathsAwaitable(Model::ListLaunchPathsRequest request) const;
+
+        /**
+         * co_await-able form of ListRecordHistory(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ServiceCatalogClient, Model::ListRecordHistoryRequest, Model::ListRecordHistoryOutcome> ListRecordHistoryAwaitable(Model::ListRecordHistoryRequest request) const;
+
+        /**
+         * co_await-able form of ProvisionProduct(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ServiceCatalogClient, Model::ProvisionProductRequest, Model::ProvisionProductOutcome> ProvisionProductAwaitable(Model::ProvisionProductRequest request) const;
+
+        /**
+         * co_await-able form of ScanProvisionedProducts(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ServiceCatalogClient, Model::ScanProvisionedProductsRequest, Model::ScanProvisionedProductsOutcome> ScanProvisionedProductsAwaitable(Model::ScanProvisionedProductsRequest request) const;
+
+        /**
+         * co_await-able form of SearchProducts(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ServiceCatalogClient, Model::SearchProductsRequest, Model::SearchProductsOutcome> SearchProductsAwaitable(Model::SearchProductsRequest request) const;
+
+        /**
+         * co_await-able form of TerminateProvisionedProduct(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ServiceCatalogClient, Model::TerminateProvisionedProductRequest, Model::TerminateProvisionedProductOutcome> TerminateProvisionedProductAwaitable(Model::TerminateProvisionedProductRequest request) const;
+
+        /**
+         * co_await-able form of UpdateProvisionedProduct(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<ServiceCatalogClient, Model::UpdateProvisionedProductRequest, Model::UpdateProvisionedProductOutcome> UpdateProvisionedProductAwaitable(Model::UpdateProvisionedProductRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
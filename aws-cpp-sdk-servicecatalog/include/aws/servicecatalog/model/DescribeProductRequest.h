@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeProductRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeProduct"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeProductViewRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeProductView"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeProvisioningParametersRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeProvisioningParameters"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
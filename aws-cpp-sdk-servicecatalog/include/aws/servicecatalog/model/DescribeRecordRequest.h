@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeRecordRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeRecord"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
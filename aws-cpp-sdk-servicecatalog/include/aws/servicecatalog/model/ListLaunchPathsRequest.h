@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListLaunchPathsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListLaunchPaths"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
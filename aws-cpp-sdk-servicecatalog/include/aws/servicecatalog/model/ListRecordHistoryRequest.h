@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListRecordHistoryRequest();
+    inline const char* GetServiceRequestName() const override { return "ListRecordHistory"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
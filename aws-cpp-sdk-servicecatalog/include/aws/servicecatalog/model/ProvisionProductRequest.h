@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ProvisionProductRequest();
+    inline const char* GetServiceRequestName() const override { return "ProvisionProduct"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
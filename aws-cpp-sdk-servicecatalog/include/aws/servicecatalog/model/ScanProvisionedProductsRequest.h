@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ScanProvisionedProductsRequest();
+    inline const char* GetServiceRequestName() const override { return "ScanProvisionedProducts"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     SearchProductsRequest();
+    inline const char* GetServiceRequestName() const override { return "SearchProducts"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     TerminateProvisionedProductRequest();
+    inline const char* GetServiceRequestName() const override { return "TerminateProvisionedProduct"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateProvisionedProductRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateProvisionedProduct"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -120,7 +120,7 @@ DescribeProductOutcome ServiceCatalogClient::DescribeProduct(const DescribeProdu
 
 DescribeProductOutcomeCallable ServiceCatalogClient::DescribeProductCallable(const DescribeProductRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeProduct(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeProduct(request); } );
 }
 
 void ServiceCatalogClient::DescribeProductAsync(const DescribeProductRequest& request, const DescribeProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -128,6 +128,16 @@ void ServiceCatalogClient::DescribeProductAsync(const DescribeProductRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->DescribeProductAsyncHelper( request, handler, context ); } );
 }
 
+DescribeProductOutcomeCallable ServiceCatalogClient::DescribeProductCallable(DescribeProductRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ServiceCatalogClient::DescribeProduct, this, std::move(request)));
+}
+
+void ServiceCatalogClient::DescribeProductAsync(DescribeProductRequest&& request, const DescribeProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ServiceCatalogClient::DescribeProductAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ServiceCatalogClient::DescribeProductAsyncHelper(const DescribeProductRequest& request, const DescribeProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeProduct(request), context);
@@ -151,7 +161,7 @@ DescribeProductViewOutcome ServiceCatalogClient::DescribeProductView(const Descr
 
 DescribeProductViewOutcomeCallable ServiceCatalogClient::DescribeProductViewCallable(const DescribeProductViewRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeProductView(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeProductView(request); } );
 }
 
 void ServiceCatalogClient::DescribeProductViewAsync(const DescribeProductViewRequest& request, const DescribeProductViewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -159,6 +169,16 @@ void ServiceCatalogClient::DescribeProductViewAsync(const DescribeProductViewReq
   m_executor->Submit( [this, request, handler, context](){ this->DescribeProductViewAsyncHelper( request, handler, context ); } );
 }
 
+DescribeProductViewOutcomeCallable ServiceCatalogClient::DescribeProductViewCallable(DescribeProductViewRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ServiceCatalogClient::DescribeProductView, this, std::move(request)));
+}
+
+void ServiceCatalogClient::DescribeProductViewAsync(DescribeProductViewRequest&& request, const DescribeProductViewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ServiceCatalogClient::DescribeProductViewAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ServiceCatalogClient::DescribeProductViewAsyncHelper(const DescribeProductViewRequest& request, const DescribeProductViewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeProductView(request), context);
@@ -182,7 +202,7 @@ DescribeProvisioningParametersOutcome ServiceCatalogClient::DescribeProvisioning
 
 DescribeProvisioningParametersOutcomeCallable ServiceCatalogClient::DescribeProvisioningParametersCallable(const DescribeProvisioningParametersRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeProvisioningParameters(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeProvisioningParameters(request); } );
 }
 
 void ServiceCatalogClient::DescribeProvisioningParametersAsync(const DescribeProvisioningParametersRequest& request, const DescribeProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -190,6 +210,16 @@ void ServiceCatalogClient::DescribeProvisioningParametersAsync(const DescribePro
   m_executor->Submit( [this, request, handler, context](){ this->DescribeProvisioningParametersAsyncHelper( request, handler, context ); } );
 }
 
+DescribeProvisioningParametersOutcomeCallable ServiceCatalogClient::DescribeProvisioningParametersCallable(DescribeProvisioningParametersRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ServiceCatalogClient::DescribeProvisioningParameters, this, std::move(request)));
+}
+
+void ServiceCatalogClient::DescribeProvisioningParametersAsync(DescribeProvisioningParametersRequest&& request, const DescribeProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ServiceCatalogClient::DescribeProvisioningParametersAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ServiceCatalogClient::DescribeProvisioningParametersAsyncHelper(const DescribeProvisioningParametersRequest& request, const DescribeProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeProvisioningParameters(request), context);
@@ -213,7 +243,7 @@ DescribeRecordOutcome ServiceCatalogClient::DescribeRecord(const DescribeRecordR
 
 DescribeRecordOutcomeCallable ServiceCatalogClient::DescribeRecordCallable(const DescribeRecordRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeRecord(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeRecord(request); } );
 }
 
 void ServiceCatalogClient::DescribeRecordAsync(const DescribeRecordRequest& request, const DescribeRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -221,6 +251,16 @@ void ServiceCatalogClient::DescribeRecordAsync(const DescribeRecordRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeRecordAsyncHelper( request, handler, context ); } );
 }
 
+DescribeRecordOutcomeCallable ServiceCatalogClient::DescribeRecordCallable(DescribeRecordRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ServiceCatalogClient::DescribeRecord, this, std::move(request)));
+}
+
+void ServiceCatalogClient::DescribeRecordAsync(DescribeRecordRequest&& request, const DescribeRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ServiceCatalogClient::DescribeRecordAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ServiceCatalogClient::DescribeRecordAsyncHelper(const DescribeRecordRequest& request, const DescribeRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeRecord(request), context);
@@ -244,7 +284,7 @@ ListLaunchPathsOutcome ServiceCatalogClient::ListLaunchPaths(const ListLaunchPat
 
 ListLaunchPathsOutcomeCallable ServiceCatalogClient::ListLaunchPathsCallable(const ListLaunchPathsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListLaunchPaths(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListLaunchPaths(request); } );
 }
 
 void ServiceCatalogClient::ListLaunchPathsAsync(const ListLaunchPathsRequest& request, const ListLaunchPathsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -252,6 +292,16 @@ void ServiceCatalogClient::ListLaunchPathsAsync(const ListLaunchPathsRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->ListLaunchPathsAsyncHelper( request, handler, context ); } );
 }
 
+ListLaunchPathsOutcomeCallable ServiceCatalogClient::ListLaunchPathsCallable(ListLaunchPathsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ServiceCatalogClient::ListLaunchPaths, this, std::move(request)));
+}
+
+void ServiceCatalogClient::ListLaunchPathsAsync(ListLaunchPathsRequest&& request, const ListLaunchPathsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ServiceCatalogClient::ListLaunchPathsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ServiceCatalogClient::ListLaunchPathsAsyncHelper(const ListLaunchPathsRequest& request, const ListLaunchPathsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListLaunchPaths(request), context);
@@ -275,7 +325,7 @@ ListRecordHistoryOutcome ServiceCatalogClient::ListRecordHistory(const ListRecor
 
 ListRecordHistoryOutcomeCallable ServiceCatalogClient::ListRecordHistoryCallable(const ListRecordHistoryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListRecordHistory(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListRecordHistory(request); } );
 }
 
 void ServiceCatalogClient::ListRecordHistoryAsync(const ListRecordHistoryRequest& request, const ListRecordHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -283,6 +333,16 @@ void ServiceCatalogClient::ListRecordHistoryAsync(const ListRecordHistoryRequest
   m_executor->Submit( [this, request, handler, context](){ this->ListRecordHistoryAsyncHelper( request, handler, context ); } );
 }
 
+ListRecordHistoryOutcomeCallable ServiceCatalogClient::ListRecordHistoryCallable(ListRecordHistoryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ServiceCatalogClient::ListRecordHistory, this, std::move(request)));
+}
+
+void ServiceCatalogClient::ListRecordHistoryAsync(ListRecordHistoryRequest&& request, const ListRecordHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ServiceCatalogClient::ListRecordHistoryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ServiceCatalogClient::ListRecordHistoryAsyncHelper(const ListRecordHistoryRequest& request, const ListRecordHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListRecordHistory(request), context);
@@ -306,7 +366,7 @@ ProvisionProductOutcome ServiceCatalogClient::ProvisionProduct(const ProvisionPr
 
 ProvisionProductOutcomeCallable ServiceCatalogClient::ProvisionProductCallable(const ProvisionProductRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ProvisionProduct(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ProvisionProduct(request); } );
 }
 
 void ServiceCatalogClient::ProvisionProductAsync(const ProvisionProductRequest& request, const ProvisionProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -314,6 +374,16 @@ void ServiceCatalogClient::ProvisionProductAsync(const ProvisionProductRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ProvisionProductAsyncHelper( request, handler, context ); } );
 }
 
+ProvisionProductOutcomeCallable ServiceCatalogClient::ProvisionProductCallable(ProvisionProductRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ServiceCatalogClient::ProvisionProduct, this, std::move(request)));
+}
+
+void ServiceCatalogClient::ProvisionProductAsync(ProvisionProductRequest&& request, const ProvisionProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ServiceCatalogClient::ProvisionProductAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ServiceCatalogClient::ProvisionProductAsyncHelper(const ProvisionProductRequest& request, const ProvisionProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ProvisionProduct(request), context);
@@ -337,7 +407,7 @@ ScanProvisionedProductsOutcome ServiceCatalogClient::ScanProvisionedProducts(con
 
 ScanProvisionedProductsOutcomeCallable ServiceCatalogClient::ScanProvisionedProductsCallable(const ScanProvisionedProductsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ScanProvisionedProducts(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ScanProvisionedProducts(request); } );
 }
 
 void ServiceCatalogClient::ScanProvisionedProductsAsync(const ScanProvisionedProductsRequest& request, const ScanProvisionedProductsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -345,6 +415,16 @@ void ServiceCatalogClient::ScanProvisionedProductsAsync(const ScanProvisionedPro
   m_executor->Submit( [this, request, handler, context](){ this->ScanProvisionedProductsAsyncHelper( request, handler, context ); } );
 }
 
+ScanProvisionedProductsOutcomeCallable ServiceCatalogClient::ScanProvisionedProductsCallable(ScanProvisionedProductsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ServiceCatalogClient::ScanProvisionedProducts, this, std::move(request)));
+}
+
+void ServiceCatalogClient::ScanProvisionedProductsAsync(ScanProvisionedProductsRequest&& request, const ScanProvisionedProductsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ServiceCatalogClient::ScanProvisionedProductsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ServiceCatalogClient::ScanProvisionedProductsAsyncHelper(const ScanProvisionedProductsRequest& request, const ScanProvisionedProductsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ScanProvisionedProducts(request), context);
@@ -368,7 +448,7 @@ SearchProductsOutcome ServiceCatalogClient::SearchProducts(const SearchProductsR
 
 SearchProductsOutcomeCallable ServiceCatalogClient::SearchProductsCallable(const SearchProductsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SearchProducts(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SearchProducts(request); } );
 }
 
 void ServiceCatalogClient::SearchProductsAsync(const SearchProductsRequest& request, const SearchProductsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -376,6 +456,16 @@ void ServiceCatalogClient::SearchProductsAsync(const SearchProductsRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->SearchProductsAsyncHelper( request, handler, context ); } );
 }
 
+SearchProductsOutcomeCallable ServiceCatalogClient::SearchProductsCallable(SearchProductsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ServiceCatalogClient::SearchProducts, this, std::move(request)));
+}
+
+void ServiceCatalogClient::SearchProductsAsync(SearchProductsRequest&& request, const SearchProductsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ServiceCatalogClient::SearchProductsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ServiceCatalogClient::SearchProductsAsyncHelper(const SearchProductsRequest& request, const SearchProductsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SearchProducts(request), context);
@@ -399,7 +489,7 @@ TerminateProvisionedProductOutcome ServiceCatalogClient::TerminateProvisionedPro
 
 TerminateProvisionedProductOutcomeCallable ServiceCatalogClient::TerminateProvisionedProductCallable(const TerminateProvisionedProductRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TerminateProvisionedProduct(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TerminateProvisionedProduct(request); } );
 }
 
 void ServiceCatalogClient::TerminateProvisionedProductAsync(const TerminateProvisionedProductRequest& request, const TerminateProvisionedProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -407,6 +497,16 @@ void ServiceCatalogClient::TerminateProvisionedProductAsync(const TerminateProvi
   m_executor->Submit( [this, request, handler, context](){ this->TerminateProvisionedProductAsyncHelper( request, handler, context ); } );
 }
 
+TerminateProvisionedProductOutcomeCallable ServiceCatalogClient::TerminateProvisionedProductCallable(TerminateProvisionedProductRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ServiceCatalogClient::TerminateProvisionedProduct, this, std::move(request)));
+}
+
+void ServiceCatalogClient::TerminateProvisionedProductAsync(TerminateProvisionedProductRequest&& request, const TerminateProvisionedProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ServiceCatalogClient::TerminateProvisionedProductAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ServiceCatalogClient::TerminateProvisionedProductAsyncHelper(const TerminateProvisionedProductRequest& request, const TerminateProvisionedProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TerminateProvisionedProduct(request), context);
@@ -430,7 +530,7 @@ UpdateProvisionedProductOutcome ServiceCatalogClient::UpdateProvisionedProduct(c
 
 UpdateProvisionedProductOutcomeCallable ServiceCatalogClient::UpdateProvisionedProductCallable(const UpdateProvisionedProductRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateProvisionedProduct(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateProvisionedProduct(request); } );
 }
 
 void ServiceCatalogClient::UpdateProvisionedProductAsync(const UpdateProvisionedProductRequest& request, const UpdateProvisionedProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -438,8 +538,160 @@ void ServiceCatalogClient::UpdateProvisionedProductAsync(const UpdateProvisioned
   m_executor->Submit( [this, request, handler, context](){ this->UpdateProvisionedProductAsyncHelper( request, handler, context ); } );
 }
 
+UpdateProvisionedProductOutcomeCallable ServiceCatalogClient::UpdateProvisionedProductCallable(UpdateProvisionedProductRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&ServiceCatalogClient::UpdateProvisionedProduct, this, std::move(request)));
+}
+
+void ServiceCatalogClient::UpdateProvisionedProductAsync(UpdateProvisionedProductRequest&& request, const UpdateProvisionedProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&ServiceCatalogClient::UpdateProvisionedProductAsyncHelper, this, std::move(request), handler, context);
+}
+
 void ServiceCatalogClient::UpdateProvisionedProductAsyncHelper(const UpdateProvisionedProductRequest& request, const UpdateProvisionedProductResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateProvisionedProduct(request), context);
 }
 
+Paginator<ServiceCatalogClient, DescribeRecordRequest, DescribeRecordOutcome> ServiceCatalogClient::DescribeRecordPaginator(const DescribeRecordRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ServiceCatalogClient, DescribeRecordRequest, DescribeRecordOutcome>(this, &ServiceCatalogClient::DescribeRecord, request,
+    [](const DescribeRecordRequest& current, const DescribeRecordOutcome& outcome, DescribeRecordRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ServiceCatalogClient, ListLaunchPathsRequest, ListLaunchPathsOutcome> ServiceCatalogClient::ListLaunchPathsPaginator(const ListLaunchPathsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ServiceCatalogClient, ListLaunchPathsRequest, ListLaunchPathsOutcome>(this, &ServiceCatalogClient::ListLaunchPaths, request,
+    [](const ListLaunchPathsRequest& current, const ListLaunchPathsOutcome& outcome, ListLaunchPathsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ServiceCatalogClient, ListRecordHistoryRequest, ListRecordHistoryOutcome> ServiceCatalogClient::ListRecordHistoryPaginator(const ListRecordHistoryRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ServiceCatalogClient, ListRecordHistoryRequest, ListRecordHistoryOutcome>(this, &ServiceCatalogClient::ListRecordHistory, request,
+    [](const ListRecordHistoryRequest& current, const ListRecordHistoryOutcome& outcome, ListRecordHistoryRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ServiceCatalogClient, ScanProvisionedProductsRequest, ScanProvisionedProductsOutcome> ServiceCatalogClient::ScanProvisionedProductsPaginator(const ScanProvisionedProductsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ServiceCatalogClient, ScanProvisionedProductsRequest, ScanProvisionedProductsOutcome>(this, &ServiceCatalogClient::ScanProvisionedProducts, request,
+    [](const ScanProvisionedProductsRequest& current, const ScanProvisionedProductsOutcome& outcome, ScanProvisionedProductsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<ServiceCatalogClient, SearchProductsRequest, SearchProductsOutcome> ServiceCatalogClient::SearchProductsPaginator(const SearchProductsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<ServiceCatalogClient, SearchProductsRequest, SearchProductsOutcome>(this, &ServiceCatalogClient::SearchProducts, request,
+    [](const SearchProductsRequest& current, const SearchProductsOutcome& outcome, SearchProductsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<ServiceCatalogClient, DescribeProductRequest, DescribeProductOutcome> ServiceCatalogClient::DescribeProductAwaitable(DescribeProductRequest request) const
+{
+  return { m_executor.get(), { this, &ServiceCatalogClient::DescribeProduct, std::move(request) } };
+}
+
+ClientOperationAwaitable<ServiceCatalogClient, DescribeProductViewRequest, DescribeProductViewOutcome> ServiceCatalogClient::DescribeProductViewAwaitable(DescribeProductViewRequest request) const
+{
+  return { m_executor.get(), { this, &ServiceCatalogClient::DescribeProductView, std::move(request) } };
+}
+
+ClientOperationAwaitable<ServiceCatalogClient, DescribeProvisioningParametersRequest, DescribeProvisioningParametersOutcome> ServiceCatalogClient::DescribeProvisioningParametersAwaitable(DescribeProvisioningParametersRequest request) const
+{
+  return { m_executor.get(), { this, &ServiceCatalogClient::DescribeProvisioningParameters, std::move(request) } };
+}
+
+ClientOperationAwaitable<ServiceCatalogClient, DescribeRecordRequest, DescribeRecordOutcome> ServiceCatalogClient::DescribeRecordAwaitable(DescribeRecordRequest request) const
+{
+  return { m_executor.get(), { this, &ServiceCatalogClient::DescribeRecord, std::move(request) } };
+}
+
+ClientOperationAwaitable<ServiceCatalogClient, ListLaunchPathsRequest, ListLaunchPathsOutcome> ServiceCatalogClient::ListLaunchPathsAwaitable(ListLaunchPathsRequest request) const
+{
+  return { m_executor.get(), { this, &ServiceCatalogClient::ListLaunchPaths, std::move(request) } };
+}
+
+ClientOperationAwaitable<ServiceCatalogClient, ListRecordHistoryRequest, ListRecordHistoryOutcome> ServiceCatalogClient::ListRecordHistoryAwaitable(ListRecordHistoryRequest request) const
+{
+  return { m_executor.get(), { this, &ServiceCatalogClient::ListRecordHistory, std::move(request) } };
+}
+
+ClientOperationAwaitable<ServiceCatalogClient, ProvisionProductRequest, ProvisionProductOutcome> ServiceCatalogClient::ProvisionProductAwaitable(ProvisionProductRequest request) const
+{
+  return { m_executor.get(), { this, &ServiceCatalogClient::ProvisionProduct, std::move(request) } };
+}
+
+ClientOperationAwaitable<ServiceCatalogClient, ScanProvisionedProductsRequest, ScanProvisionedProductsOutcome> ServiceCatalogClient::ScanProvisionedProductsAwaitable(ScanProvisionedProductsRequest request) const
+{
+  return { m_executor.get(), { this, &ServiceCatalogClient::ScanProvisionedProducts, std::move(request) } };
+}
+
+ClientOperationAwaitable<ServiceCatalogClient, SearchProductsRequest, SearchProductsOutcome> ServiceCatalogClient::SearchProductsAwaitable(SearchProductsRequest request) const
+{
+  return { m_executor.get(), { this, &ServiceCatalogClient::SearchProducts, std::move(request) } };
+}
+
+ClientOperationAwaitable<ServiceCatalogClient, TerminateProvisionedProductRequest, TerminateProvisionedProductOutcome> ServiceCatalogClient::TerminateProvisionedProductAwaitable(TerminateProvisionedProductRequest request) const
+{
+  return { m_executor.get(), { this, &ServiceCatalogClient::TerminateProvisionedProduct, std::move(request) } };
+}
+
+ClientOperationAwaitable<ServiceCatalogClient, UpdateProvisionedProductRequest, UpdateProvisionedProductOutcome> ServiceCatalogClient::UpdateProvisionedProductAwaitable(UpdateProvisionedProductRequest request) const
+{
+  return { m_executor.get(), { this, &ServiceCatalogClient::UpdateProvisionedProduct, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
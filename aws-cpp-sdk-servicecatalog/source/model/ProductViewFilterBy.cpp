@@ -29,26 +29,32 @@ namespace Aws
       namespace ProductViewFilterByMapper
       {
 
-        static const int FullTextSearch_HASH = HashingUtils::HashString("FullTextSearch");
-        static const int Owner_HASH = HashingUtils::HashString("Owner");
-        static const int ProductType_HASH = HashingUtils::HashString("ProductType");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int FullTextSearch_HASH = -1202952892;
+        static const int Owner_HASH = 76612243;
+        static const int ProductType_HASH = 176253097;
 
 
         ProductViewFilterBy GetProductViewFilterByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FullTextSearch_HASH)
+          switch (hashCode)
           {
+          case FullTextSearch_HASH:
             return ProductViewFilterBy::FullTextSearch;
-          }
-          else if (hashCode == Owner_HASH)
-          {
+          case Owner_HASH:
             return ProductViewFilterBy::Owner;
-          }
-          else if (hashCode == ProductType_HASH)
-          {
+          case ProductType_HASH:
             return ProductViewFilterBy::ProductType;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
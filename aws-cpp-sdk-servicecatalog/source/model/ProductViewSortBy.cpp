@@ -29,26 +29,32 @@ namespace Aws
       namespace ProductViewSortByMapper
       {
 
-        static const int Title_HASH = HashingUtils::HashString("Title");
-        static const int VersionCount_HASH = HashingUtils::HashString("VersionCount");
-        static const int CreationDate_HASH = HashingUtils::HashString("CreationDate");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Title_HASH = 80818744;
+        static const int VersionCount_HASH = 35839799;
+        static const int CreationDate_HASH = 1749851981;
 
 
         ProductViewSortBy GetProductViewSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Title_HASH)
+          switch (hashCode)
           {
+          case Title_HASH:
             return ProductViewSortBy::Title;
-          }
-          else if (hashCode == VersionCount_HASH)
-          {
+          case VersionCount_HASH:
             return ProductViewSortBy::VersionCount;
-          }
-          else if (hashCode == CreationDate_HASH)
-          {
+          case CreationDate_HASH:
             return ProductViewSortBy::CreationDate;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
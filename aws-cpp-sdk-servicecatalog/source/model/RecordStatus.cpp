@@ -29,26 +29,32 @@ namespace Aws
       namespace RecordStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int IN_PROGRESS_HASH = -604548089;
+        static const int SUCCEEDED_HASH = -562638271;
+        static const int ERROR__HASH = 66247144;
 
 
         RecordStatus GetRecordStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
+          switch (hashCode)
           {
+          case IN_PROGRESS_HASH:
             return RecordStatus::IN_PROGRESS;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
+          case SUCCEEDED_HASH:
             return RecordStatus::SUCCEEDED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
+          case ERROR__HASH:
             return RecordStatus::ERROR_;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace SortOrderMapper
       {
 
-        static const int ASCENDING_HASH = HashingUtils::HashString("ASCENDING");
-        static const int DESCENDING_HASH = HashingUtils::HashString("DESCENDING");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ASCENDING_HASH = -1513304392;
+        static const int DESCENDING_HASH = -631204104;
 
 
         SortOrder GetSortOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASCENDING_HASH)
+          switch (hashCode)
           {
+          case ASCENDING_HASH:
             return SortOrder::ASCENDING;
-          }
-          else if (hashCode == DESCENDING_HASH)
-          {
+          case DESCENDING_HASH:
             return SortOrder::DESCENDING;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -32,6 +32,9 @@
 #include <aws/snowball/model/ListJobsResult.h>
 #include <aws/snowball/model/UpdateJobResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -187,6 +190,18 @@ namespace Model
          */
         virtual void CancelJobAsync(const Model::CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelJobCallable(const Model::CancelJobRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelJobOutcomeCallable CancelJobCallable(Model::CancelJobRequest&& request) const;
+
+        /**
+         * Same as CancelJobAsync(const Model::CancelJobRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelJobAsync(Model::CancelJobRequest&& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an address for a Snowball to be shipped to. </p> <p>Addresses are
          * validated at the time of creation. The address you provide must be located
@@ -215,6 +230,18 @@ namespace Model
          */
         virtual void CreateAddressAsync(const Model::CreateAddressRequest& request, const CreateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAddressCallable(const Model::CreateAddressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateAddressOutcomeCallable CreateAddressCallable(Model::CreateAddressRequest&& request) const;
+
+        /**
+         * Same as CreateAddressAsync(const Model::CreateAddressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateAddressAsync(Model::CreateAddressRequest&& request, const CreateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a job to import or export data between Amazon S3 and your on-premises
          * data center. Note that your AWS account must have the right trust policies and
@@ -243,6 +270,18 @@ namespace Model
          */
         virtual void CreateJobAsync(const Model::CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateJobCallable(const Model::CreateJobRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateJobOutcomeCallable CreateJobCallable(Model::CreateJobRequest&& request) const;
+
+        /**
+         * Same as CreateJobAsync(const Model::CreateJobRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateJobAsync(Model::CreateJobRequest&& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Takes an <code>AddressId</code> and returns specific details about that
          * address in the form of an <code>Address</code> object.</p>
@@ -265,6 +304,18 @@ namespace Model
          */
         virtual void DescribeAddressAsync(const Model::DescribeAddressRequest& request, const DescribeAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAddressCallable(const Model::DescribeAddressRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAddressOutcomeCallable DescribeAddressCallable(Model::DescribeAddressRequest&& request) const;
+
+        /**
+         * Same as DescribeAddressAsync(const Model::DescribeAddressRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAddressAsync(Model::DescribeAddressRequest&& request, const DescribeAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a specified number of <code>ADDRESS</code> objects. Calling this API
          * in one of the US regions will return addresses from the list of all addresses
@@ -290,6 +341,18 @@ namespace Model
          */
         virtual void DescribeAddressesAsync(const Model::DescribeAddressesRequest& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAddressesCallable(const Model::DescribeAddressesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAddressesOutcomeCallable DescribeAddressesCallable(Model::DescribeAddressesRequest&& request) const;
+
+        /**
+         * Same as DescribeAddressesAsync(const Model::DescribeAddressesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAddressesAsync(Model::DescribeAddressesRequest&& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about a specific job including shipping information, job
          * status, and other important metadata.</p>
@@ -312,6 +375,18 @@ namespace Model
          */
         virtual void DescribeJobAsync(const Model::DescribeJobRequest& request, const DescribeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeJobCallable(const Model::DescribeJobRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeJobOutcomeCallable DescribeJobCallable(Model::DescribeJobRequest&& request) const;
+
+        /**
+         * Same as DescribeJobAsync(const Model::DescribeJobRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeJobAsync(Model::DescribeJobRequest&& request, const DescribeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a link to an Amazon S3 presigned URL for the manifest file associated
          * with the specified <code>JobId</code> value. You can access the manifest file
@@ -370,6 +445,18 @@ namespace Model
          */
         virtual void GetJobManifestAsync(const Model::GetJobManifestRequest& request, const GetJobManifestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetJobManifestCallable(const Model::GetJobManifestRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetJobManifestOutcomeCallable GetJobManifestCallable(Model::GetJobManifestRequest&& request) const;
+
+        /**
+         * Same as GetJobManifestAsync(const Model::GetJobManifestRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetJobManifestAsync(Model::GetJobManifestRequest&& request, const GetJobManifestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the <code>UnlockCode</code> code value for the specified job. A
          * particular <code>UnlockCode</code> value can be accessed for up to 90 days after
@@ -416,6 +503,18 @@ namespace Model
          */
         virtual void GetJobUnlockCodeAsync(const Model::GetJobUnlockCodeRequest& request, const GetJobUnlockCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetJobUnlockCodeCallable(const Model::GetJobUnlockCodeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetJobUnlockCodeOutcomeCallable GetJobUnlockCodeCallable(Model::GetJobUnlockCodeRequest&& request) const;
+
+        /**
+         * Same as GetJobUnlockCodeAsync(const Model::GetJobUnlockCodeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetJobUnlockCodeAsync(Model::GetJobUnlockCodeRequest&& request, const GetJobUnlockCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the Snowball service limit for your account, and
          * also the number of Snowballs your account has in use.</p> <p>Note that the
@@ -444,6 +543,18 @@ namespace Model
          */
         virtual void GetSnowballUsageAsync(const Model::GetSnowballUsageRequest& request, const GetSnowballUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSnowballUsageCallable(const Model::GetSnowballUsageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetSnowballUsageOutcomeCallable GetSnowballUsageCallable(Model::GetSnowballUsageRequest&& request) const;
+
+        /**
+         * Same as GetSnowballUsageAsync(const Model::GetSnowballUsageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetSnowballUsageAsync(Model::GetSnowballUsageRequest&& request, const GetSnowballUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of <code>JobListEntry</code> objects of the specified
          * length. Each <code>JobListEntry</code> object contains a job's state, a job's
@@ -475,6 +586,18 @@ namespace Model
          */
         virtual void ListJobsAsync(const Model::ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListJobsCallable(const Model::ListJobsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListJobsOutcomeCallable ListJobsCallable(Model::ListJobsRequest&& request) const;
+
+        /**
+         * Same as ListJobsAsync(const Model::ListJobsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListJobsAsync(Model::ListJobsRequest&& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>While a job's <code>JobState</code> value is <code>New</code>, you can update
          * some of the information associated with a job. Once the job changes to a
@@ -503,6 +626,85 @@ namespace Model
          */
         virtual void UpdateJobAsync(const Model::UpdateJobRequest& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateJobCallable(const Model::UpdateJobRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateJobOutcomeCallable UpdateJobCallable(Model::UpdateJobRequest&& request) const;
+
+        /**
+         * Same as UpdateJobAsync(const Model::UpdateJobRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateJobAsync(Model::UpdateJobRequest&& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeAddresses(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SnowballClient, Model::DescribeAddressesRequest, Model::DescribeAddressesOutcome> DescribeAddressesPaginator(const Model::DescribeAddressesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListJobs(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SnowballClient, Model::ListJobsRequest, Model::ListJobsOutcome> ListJobsPaginator(const Model::ListJobsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CancelJob(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SnowballClient, Model::CancelJobRequest, Model::CancelJobOutcome> CancelJobAwaitable(Model::CancelJobRequest request) const;
+
+        /**
+         * co_await-able form of CreateAddress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SnowballClient, Model::CreateAddressRequest, Model::CreateAddressOutcome> CreateAddressAwaitable(Model::CreateAddressRequest request) const;
+
+        /**
+         * co_await-able form of CreateJob(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SnowballClient, Model::CreateJobRequest, Model::CreateJobOutcome> CreateJobAwaitable(Model::CreateJobRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAddress(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SnowballClient, Model::DescribeAddressRequest, Model::DescribeAddressOutcome> DescribeAddressAwaitable(Model::DescribeAddressRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAddresses(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SnowballClient, Model::DescribeAddressesRequest, Model::DescribeAddressesOutcome> DescribeAddressesAwaitable(Model::DescribeAddressesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeJob(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SnowballClient, Model::DescribeJobRequest, Model::DescribeJobOutcome> DescribeJobAwaitable(Model::DescribeJobRequest request) const;
+
+        /**
+         * co_await-able form of GetJobManifest(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SnowballClient, Model::GetJobManifestRequest, Model::GetJobManifestOutcome> GetJobManifestAwaitable(Model::GetJobManifestRequest request) const;
+
+        /**
+         * co_await-able form of GetJobUnlockCode(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SnowballClient, Model::GetJobUnlockCodeRequest, Model::GetJobUnlockCodeOutcome> GetJobUnlockCodeAwaitable(Model::GetJobUnlockCodeRequest request) const;
+
+        /**
+         * co_await-able form of GetSnowballUsage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SnowballClient, Model::GetSnowballUsageRequest, Model::GetSnowballUsageOutcome> GetSnowballUsageAwaitable(Model::GetSnowballUsageRequest request) const;
+
+        /**
+         * co_await-able form of ListJobs(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SnowballClient, Model::ListJobsRequest, Model::ListJobsOutcome> ListJobsAwaitable(Model::ListJobsRequest request) const;
+
+        /**
+         * co_await-able form of UpdateJob(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SnowballClient, Model::UpdateJobRequest, Model::UpdateJobOutcome> UpdateJobAwaitable(Model::UpdateJobRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CancelJobRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelJob"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
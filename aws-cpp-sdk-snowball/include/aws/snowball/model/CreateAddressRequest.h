@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateAddressRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateAddress"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     CreateJobRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateJob"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeAddressRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAddress"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
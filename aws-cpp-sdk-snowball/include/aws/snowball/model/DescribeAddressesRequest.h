@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeAddressesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAddresses"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeJobRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeJob"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetJobManifestRequest();
+    inline const char* GetServiceRequestName() const override { return "GetJobManifest"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetJobUnlockCodeRequest();
+    inline const char* GetServiceRequestName() const override { return "GetJobUnlockCode"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     GetSnowballUsageRequest();
+    inline const char* GetServiceRequestName() const override { return "GetSnowballUsage"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
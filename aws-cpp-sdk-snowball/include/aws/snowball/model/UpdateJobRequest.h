@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     UpdateJobRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateJob"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -120,7 +120,7 @@ CancelJobOutcome SnowballClient::CancelJob(const CancelJobRequest& request) cons
 
 CancelJobOutcomeCallable SnowballClient::CancelJobCallable(const CancelJobRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelJob(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelJob(request); } );
 }
 
 void SnowballClient::CancelJobAsync(const CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -128,6 +128,16 @@ void SnowballClient::CancelJobAsync(const CancelJobRequest& request, const Cance
   m_executor->Submit( [this, request, handler, context](){ this->CancelJobAsyncHelper( request, handler, context ); } );
 }
 
+CancelJobOutcomeCallable SnowballClient::CancelJobCallable(CancelJobRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SnowballClient::CancelJob, this, std::move(request)));
+}
+
+void SnowballClient::CancelJobAsync(CancelJobRequest&& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SnowballClient::CancelJobAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SnowballClient::CancelJobAsyncHelper(const CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelJob(request), context);
@@ -151,7 +161,7 @@ CreateAddressOutcome SnowballClient::CreateAddress(const CreateAddressRequest& r
 
 CreateAddressOutcomeCallable SnowballClient::CreateAddressCallable(const CreateAddressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateAddress(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateAddress(request); } );
 }
 
 void SnowballClient::CreateAddressAsync(const CreateAddressRequest& request, const CreateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -159,6 +169,16 @@ void SnowballClient::CreateAddressAsync(const CreateAddressRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->CreateAddressAsyncHelper( request, handler, context ); } );
 }
 
+CreateAddressOutcomeCallable SnowballClient::CreateAddressCallable(CreateAddressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SnowballClient::CreateAddress, this, std::move(request)));
+}
+
+void SnowballClient::CreateAddressAsync(CreateAddressRequest&& request, const CreateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SnowballClient::CreateAddressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SnowballClient::CreateAddressAsyncHelper(const CreateAddressRequest& request, const CreateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateAddress(request), context);
@@ -182,7 +202,7 @@ CreateJobOutcome SnowballClient::CreateJob(const CreateJobRequest& request) cons
 
 CreateJobOutcomeCallable SnowballClient::CreateJobCallable(const CreateJobRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateJob(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateJob(request); } );
 }
 
 void SnowballClient::CreateJobAsync(const CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -190,6 +210,16 @@ void SnowballClient::CreateJobAsync(const CreateJobRequest& request, const Creat
   m_executor->Submit( [this, request, handler, context](){ this->CreateJobAsyncHelper( request, handler, context ); } );
 }
 
+CreateJobOutcomeCallable SnowballClient::CreateJobCallable(CreateJobRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SnowballClient::CreateJob, this, std::move(request)));
+}
+
+void SnowballClient::CreateJobAsync(CreateJobRequest&& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SnowballClient::CreateJobAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SnowballClient::CreateJobAsyncHelper(const CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateJob(request), context);
@@ -213,7 +243,7 @@ DescribeAddressOutcome SnowballClient::DescribeAddress(const DescribeAddressRequ
 
 DescribeAddressOutcomeCallable SnowballClient::DescribeAddressCallable(const DescribeAddressRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAddress(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAddress(request); } );
 }
 
 void SnowballClient::DescribeAddressAsync(const DescribeAddressRequest& request, const DescribeAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -221,6 +251,16 @@ void SnowballClient::DescribeAddressAsync(const DescribeAddressRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAddressAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAddressOutcomeCallable SnowballClient::DescribeAddressCallable(DescribeAddressRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SnowballClient::DescribeAddress, this, std::move(request)));
+}
+
+void SnowballClient::DescribeAddressAsync(DescribeAddressRequest&& request, const DescribeAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SnowballClient::DescribeAddressAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SnowballClient::DescribeAddressAsyncHelper(const DescribeAddressRequest& request, const DescribeAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAddress(request), context);
@@ -244,7 +284,7 @@ DescribeAddressesOutcome SnowballClient::DescribeAddresses(const DescribeAddress
 
 DescribeAddressesOutcomeCallable SnowballClient::DescribeAddressesCallable(const DescribeAddressesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAddresses(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAddresses(request); } );
 }
 
 void SnowballClient::DescribeAddressesAsync(const DescribeAddressesRequest& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -252,6 +292,16 @@ void SnowballClient::DescribeAddressesAsync(const DescribeAddressesRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAddressesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAddressesOutcomeCallable SnowballClient::DescribeAddressesCallable(DescribeAddressesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SnowballClient::DescribeAddresses, this, std::move(request)));
+}
+
+void SnowballClient::DescribeAddressesAsync(DescribeAddressesRequest&& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SnowballClient::DescribeAddressesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SnowballClient::DescribeAddressesAsyncHelper(const DescribeAddressesRequest& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAddresses(request), context);
@@ -275,7 +325,7 @@ DescribeJobOutcome SnowballClient::DescribeJob(const DescribeJobRequest& request
 
 DescribeJobOutcomeCallable SnowballClient::DescribeJobCallable(const DescribeJobRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeJob(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeJob(request); } );
 }
 
 void SnowballClient::DescribeJobAsync(const DescribeJobRequest& request, const DescribeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -283,6 +333,16 @@ void SnowballClient::DescribeJobAsync(const DescribeJobRequest& request, const D
   m_executor->Submit( [this, request, handler, context](){ this->DescribeJobAsyncHelper( request, handler, context ); } );
 }
 
+DescribeJobOutcomeCallable SnowballClient::DescribeJobCallable(DescribeJobRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SnowballClient::DescribeJob, this, std::move(request)));
+}
+
+void SnowballClient::DescribeJobAsync(DescribeJobRequest&& request, const DescribeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SnowballClient::DescribeJobAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SnowballClient::DescribeJobAsyncHelper(const DescribeJobRequest& request, const DescribeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeJob(request), context);
@@ -306,7 +366,7 @@ GetJobManifestOutcome SnowballClient::GetJobManifest(const GetJobManifestRequest
 
 GetJobManifestOutcomeCallable SnowballClient::GetJobManifestCallable(const GetJobManifestRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetJobManifest(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetJobManifest(request); } );
 }
 
 void SnowballClient::GetJobManifestAsync(const GetJobManifestRequest& request, const GetJobManifestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -314,6 +374,16 @@ void SnowballClient::GetJobManifestAsync(const GetJobManifestRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->GetJobManifestAsyncHelper( request, handler, context ); } );
 }
 
+GetJobManifestOutcomeCallable SnowballClient::GetJobManifestCallable(GetJobManifestRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SnowballClient::GetJobManifest, this, std::move(request)));
+}
+
+void SnowballClient::GetJobManifestAsync(GetJobManifestRequest&& request, const GetJobManifestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SnowballClient::GetJobManifestAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SnowballClient::GetJobManifestAsyncHelper(const GetJobManifestRequest& request, const GetJobManifestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetJobManifest(request), context);
@@ -337,7 +407,7 @@ GetJobUnlockCodeOutcome SnowballClient::GetJobUnlockCode(const GetJobUnlockCodeR
 
 GetJobUnlockCodeOutcomeCallable SnowballClient::GetJobUnlockCodeCallable(const GetJobUnlockCodeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetJobUnlockCode(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetJobUnlockCode(request); } );
 }
 
 void SnowballClient::GetJobUnlockCodeAsync(const GetJobUnlockCodeRequest& request, const GetJobUnlockCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -345,6 +415,16 @@ void SnowballClient::GetJobUnlockCodeAsync(const GetJobUnlockCodeRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->GetJobUnlockCodeAsyncHelper( request, handler, context ); } );
 }
 
+GetJobUnlockCodeOutcomeCallable SnowballClient::GetJobUnlockCodeCallable(GetJobUnlockCodeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SnowballClient::GetJobUnlockCode, this, std::move(request)));
+}
+
+void SnowballClient::GetJobUnlockCodeAsync(GetJobUnlockCodeRequest&& request, const GetJobUnlockCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SnowballClient::GetJobUnlockCodeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SnowballClient::GetJobUnlockCodeAsyncHelper(const GetJobUnlockCodeRequest& request, const GetJobUnlockCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetJobUnlockCode(request), context);
@@ -368,7 +448,7 @@ GetSnowballUsageOutcome SnowballClient::GetSnowballUsage(const GetSnowballUsageR
 
 GetSnowballUsageOutcomeCallable SnowballClient::GetSnowballUsageCallable(const GetSnowballUsageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetSnowballUsage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetSnowballUsage(request); } );
 }
 
 void SnowballClient::GetSnowballUsageAsync(const GetSnowballUsageRequest& request, const GetSnowballUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -376,6 +456,16 @@ void SnowballClient::GetSnowballUsageAsync(const GetSnowballUsageRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->GetSnowballUsageAsyncHelper( request, handler, context ); } );
 }
 
+GetSnowballUsageOutcomeCallable SnowballClient::GetSnowballUsageCallable(GetSnowballUsageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SnowballClient::GetSnowballUsage, this, std::move(request)));
+}
+
+void SnowballClient::GetSnowballUsageAsync(GetSnowballUsageRequest&& request, const GetSnowballUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SnowballClient::GetSnowballUsageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SnowballClient::GetSnowballUsageAsyncHelper(const GetSnowballUsageRequest& request, const GetSnowballUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetSnowballUsage(request), context);
@@ -399,7 +489,7 @@ ListJobsOutcome SnowballClient::ListJobs(const ListJobsRequest& request) const
 
 ListJobsOutcomeCallable SnowballClient::ListJobsCallable(const ListJobsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListJobs(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListJobs(request); } );
 }
 
 void SnowballClient::ListJobsAsync(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -407,6 +497,16 @@ void SnowballClient::ListJobsAsync(const ListJobsRequest& request, const ListJob
   m_executor->Submit( [this, request, handler, context](){ this->ListJobsAsyncHelper( request, handler, context ); } );
 }
 
+ListJobsOutcomeCallable SnowballClient::ListJobsCallable(ListJobsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SnowballClient::ListJobs, this, std::move(request)));
+}
+
+void SnowballClient::ListJobsAsync(ListJobsRequest&& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SnowballClient::ListJobsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SnowballClient::ListJobsAsyncHelper(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListJobs(request), context);
@@ -430,7 +530,7 @@ UpdateJobOutcome SnowballClient::UpdateJob(const UpdateJobRequest& request) cons
 
 UpdateJobOutcomeCallable SnowballClient::UpdateJobCallable(const UpdateJobRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateJob(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateJob(request); } );
 }
 
 void SnowballClient::UpdateJobAsync(const UpdateJobRequest& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -438,8 +538,109 @@ void SnowballClient::UpdateJobAsync(const UpdateJobRequest& request, const Updat
   m_executor->Submit( [this, request, handler, context](){ this->UpdateJobAsyncHelper( request, handler, context ); } );
 }
 
+UpdateJobOutcomeCallable SnowballClient::UpdateJobCallable(UpdateJobRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SnowballClient::UpdateJob, this, std::move(request)));
+}
+
+void SnowballClient::UpdateJobAsync(UpdateJobRequest&& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SnowballClient::UpdateJobAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SnowballClient::UpdateJobAsyncHelper(const UpdateJobRequest& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateJob(request), context);
 }
 
+Paginator<SnowballClient, DescribeAddressesRequest, DescribeAddressesOutcome> SnowballClient::DescribeAddressesPaginator(const DescribeAddressesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SnowballClient, DescribeAddressesRequest, DescribeAddressesOutcome>(this, &SnowballClient::DescribeAddresses, request,
+    [](const DescribeAddressesRequest& current, const DescribeAddressesOutcome& outcome, DescribeAddressesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SnowballClient, ListJobsRequest, ListJobsOutcome> SnowballClient::ListJobsPaginator(const ListJobsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SnowballClient, ListJobsRequest, ListJobsOutcome>(this, &SnowballClient::ListJobs, request,
+    [](const ListJobsRequest& current, const ListJobsOutcome& outcome, ListJobsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<SnowballClient, CancelJobRequest, CancelJobOutcome> SnowballClient::CancelJobAwaitable(CancelJobRequest request) const
+{
+  return { m_executor.get(), { this, &SnowballClient::CancelJob, std::move(request) } };
+}
+
+ClientOperationAwaitable<SnowballClient, CreateAddressRequest, CreateAddressOutcome> SnowballClient::CreateAddressAwaitable(CreateAddressRequest request) const
+{
+  return { m_executor.get(), { this, &SnowballClient::CreateAddress, std::move(request) } };
+}
+
+ClientOperationAwaitable<SnowballClient, CreateJobRequest, CreateJobOutcome> SnowballClient::CreateJobAwaitable(CreateJobRequest request) const
+{
+  return { m_executor.get(), { this, &SnowballClient::CreateJob, std::move(request) } };
+}
+
+ClientOperationAwaitable<SnowballClient, DescribeAddressRequest, DescribeAddressOutcome> SnowballClient::DescribeAddressAwaitable(DescribeAddressRequest request) const
+{
+  return { m_executor.get(), { this, &SnowballClient::DescribeAddress, std::move(request) } };
+}
+
+ClientOperationAwaitable<SnowballClient, DescribeAddressesRequest, DescribeAddressesOutcome> SnowballClient::DescribeAddressesAwaitable(DescribeAddressesRequest request) const
+{
+  return { m_executor.get(), { this, &SnowballClient::DescribeAddresses, std::move(request) } };
+}
+
+ClientOperationAwaitable<SnowballClient, DescribeJobRequest, DescribeJobOutcome> SnowballClient::DescribeJobAwaitable(DescribeJobRequest request) const
+{
+  return { m_executor.get(), { this, &SnowballClient::DescribeJob, std::move(request) } };
+}
+
+ClientOperationAwaitable<SnowballClient, GetJobManifestRequest, GetJobManifestOutcome> SnowballClient::GetJobManifestAwaitable(GetJobManifestRequest request) const
+{
+  return { m_executor.get(), { this, &SnowballClient::GetJobManifest, std::move(request) } };
+}
+
+ClientOperationAwaitable<SnowballClient, GetJobUnlockCodeRequest, GetJobUnlockCodeOutcome> SnowballClient::GetJobUnlockCodeAwaitable(GetJobUnlockCodeRequest request) const
+{
+  return { m_executor.get(), { this, &SnowballClient::GetJobUnlockCode, std::move(request) } };
+}
+
+ClientOperationAwaitable<SnowballClient, GetSnowballUsageRequest, GetSnowballUsageOutcome> SnowballClient::GetSnowballUsageAwaitable(GetSnowballUsageRequest request) const
+{
+  return { m_executor.get(), { this, &SnowballClient::GetSnowballUsage, std::move(request) } };
+}
+
+ClientOperationAwaitable<SnowballClient, ListJobsRequest, ListJobsOutcome> SnowballClient::ListJobsAwaitable(ListJobsRequest request) const
+{
+  return { m_executor.get(), { this, &SnowballClient::ListJobs, std::move(request) } };
+}
+
+ClientOperationAwaitable<SnowballClient, UpdateJobRequest, UpdateJobOutcome> SnowballClient::UpdateJobAwaitable(UpdateJobRequest request) const
+{
+  return { m_executor.get(), { this, &SnowballClient::UpdateJob, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
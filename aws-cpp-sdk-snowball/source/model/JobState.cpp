@@ -29,71 +29,59 @@ namespace Aws
       namespace JobStateMapper
       {
 
-        static const int New_HASH = HashingUtils::HashString("New");
-        static const int PreparingAppliance_HASH = HashingUtils::HashString("PreparingAppliance");
-        static const int PreparingShipment_HASH = HashingUtils::HashString("PreparingShipment");
-        static const int InTransitToCustomer_HASH = HashingUtils::HashString("InTransitToCustomer");
-        static const int WithCustomer_HASH = HashingUtils::HashString("WithCustomer");
-        static const int InTransitToAWS_HASH = HashingUtils::HashString("InTransitToAWS");
-        static const int WithAWS_HASH = HashingUtils::HashString("WithAWS");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Complete_HASH = HashingUtils::HashString("Complete");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Listing_HASH = HashingUtils::HashString("Listing");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int New_HASH = 78208;
+        static const int PreparingAppliance_HASH = -642416087;
+        static const int PreparingShipment_HASH = 1331484062;
+        static const int InTransitToCustomer_HASH = 2122413799;
+        static const int WithCustomer_HASH = -1002650908;
+        static const int InTransitToAWS_HASH = 625180244;
+        static const int WithAWS_HASH = -1275205577;
+        static const int InProgress_HASH = 646453906;
+        static const int Complete_HASH = -534801063;
+        static const int Cancelled_HASH = -1814410959;
+        static const int Listing_HASH = 1846628964;
+        static const int Pending_HASH = 982065527;
 
 
         JobState GetJobStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == New_HASH)
+          switch (hashCode)
           {
+          case New_HASH:
             return JobState::New;
-          }
-          else if (hashCode == PreparingAppliance_HASH)
-          {
+          case PreparingAppliance_HASH:
             return JobState::PreparingAppliance;
-          }
-          else if (hashCode == PreparingShipment_HASH)
-          {
+          case PreparingShipment_HASH:
             return JobState::PreparingShipment;
-          }
-          else if (hashCode == InTransitToCustomer_HASH)
-          {
+          case InTransitToCustomer_HASH:
             return JobState::InTransitToCustomer;
-          }
-          else if (hashCode == WithCustomer_HASH)
-          {
+          case WithCustomer_HASH:
             return JobState::WithCustomer;
-          }
-          else if (hashCode == InTransitToAWS_HASH)
-          {
+          case InTransitToAWS_HASH:
             return JobState::InTransitToAWS;
-          }
-          else if (hashCode == WithAWS_HASH)
-          {
+          case WithAWS_HASH:
             return JobState::WithAWS;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
+          case InProgress_HASH:
             return JobState::InProgress;
-          }
-          else if (hashCode == Complete_HASH)
-          {
+          case Complete_HASH:
             return JobState::Complete;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
+          case Cancelled_HASH:
             return JobState::Cancelled;
-          }
-          else if (hashCode == Listing_HASH)
-          {
+          case Listing_HASH:
             return JobState::Listing;
-          }
-          else if (hashCode == Pending_HASH)
-          {
+          case Pending_HASH:
             return JobState::Pending;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace JobTypeMapper
       {
 
-        static const int IMPORT_HASH = HashingUtils::HashString("IMPORT");
-        static const int EXPORT_HASH = HashingUtils::HashString("EXPORT");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int IMPORT_HASH = -2131466331;
+        static const int EXPORT_HASH = 2059143092;
 
 
         JobType GetJobTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IMPORT_HASH)
+          switch (hashCode)
           {
+          case IMPORT_HASH:
             return JobType::IMPORT;
-          }
-          else if (hashCode == EXPORT_HASH)
-          {
+          case EXPORT_HASH:
             return JobType::EXPORT;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
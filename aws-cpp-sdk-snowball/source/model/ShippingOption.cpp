@@ -29,31 +29,35 @@ namespace Aws
       namespace ShippingOptionMapper
       {
 
-        static const int SECOND_DAY_HASH = HashingUtils::HashString("SECOND_DAY");
-        static const int NEXT_DAY_HASH = HashingUtils::HashString("NEXT_DAY");
-        static const int EXPRESS_HASH = HashingUtils::HashString("EXPRESS");
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int SECOND_DAY_HASH = 910234929;
+        static const int NEXT_DAY_HASH = -2086664144;
+        static const int EXPRESS_HASH = -590996656;
+        static const int STANDARD_HASH = 2095255229;
 
 
         ShippingOption GetShippingOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SECOND_DAY_HASH)
+          switch (hashCode)
           {
+          case SECOND_DAY_HASH:
             return ShippingOption::SECOND_DAY;
-          }
-          else if (hashCode == NEXT_DAY_HASH)
-          {
+          case NEXT_DAY_HASH:
             return ShippingOption::NEXT_DAY;
-          }
-          else if (hashCode == EXPRESS_HASH)
-          {
+          case EXPRESS_HASH:
             return ShippingOption::EXPRESS;
-          }
-          else if (hashCode == STANDARD_HASH)
-          {
+          case STANDARD_HASH:
             return ShippingOption::STANDARD;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
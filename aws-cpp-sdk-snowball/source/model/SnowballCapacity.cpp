@@ -29,26 +29,32 @@ namespace Aws
       namespace SnowballCapacityMapper
       {
 
-        static const int T50_HASH = HashingUtils::HashString("T50");
-        static const int T80_HASH = HashingUtils::HashString("T80");
-        static const int NoPreference_HASH = HashingUtils::HashString("NoPreference");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int T50_HASH = 82415;
+        static const int T80_HASH = 82508;
+        static const int NoPreference_HASH = 119045532;
 
 
         SnowballCapacity GetSnowballCapacityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == T50_HASH)
+          switch (hashCode)
           {
+          case T50_HASH:
             return SnowballCapacity::T50;
-          }
-          else if (hashCode == T80_HASH)
-          {
+          case T80_HASH:
             return SnowballCapacity::T80;
-          }
-          else if (hashCode == NoPreference_HASH)
-          {
+          case NoPreference_HASH:
             return SnowballCapacity::NoPreference;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -42,6 +42,9 @@
 #include <aws/sns/model/SubscribeResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -277,6 +280,18 @@ namespace Model
          */
         virtual void AddPermissionAsync(const Model::AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddPermissionCallable(const Model::AddPermissionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddPermissionOutcomeCallable AddPermissionCallable(Model::AddPermissionRequest&& request) const;
+
+        /**
+         * Same as AddPermissionAsync(const Model::AddPermissionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddPermissionAsync(Model::AddPermissionRequest&& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Accepts a phone number and indicates whether the phone holder has opted out
          * of receiving SMS messages from your account. You cannot send SMS messages to a
@@ -305,6 +320,18 @@ namespace Model
          */
         virtual void CheckIfPhoneNumberIsOptedOutAsync(const Model::CheckIfPhoneNumberIsOptedOutRequest& request, const CheckIfPhoneNumberIsOptedOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CheckIfPhoneNumberIsOptedOutCallable(const Model::CheckIfPhoneNumberIsOptedOutRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CheckIfPhoneNumberIsOptedOutOutcomeCallable CheckIfPhoneNumberIsOptedOutCallable(Model::CheckIfPhoneNumberIsOptedOutRequest&& request) const;
+
+        /**
+         * Same as CheckIfPhoneNumberIsOptedOutAsync(const Model::CheckIfPhoneNumberIsOptedOutRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CheckIfPhoneNumberIsOptedOutAsync(Model::CheckIfPhoneNumberIsOptedOutRequest&& request, const CheckIfPhoneNumberIsOptedOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Verifies an endpoint owner's intent to receive messages by validating the
          * token sent to the endpoint by an earlier <code>Subscribe</code> action. If the
@@ -336,6 +363,18 @@ namespace Model
          */
         virtual void ConfirmSubscriptionAsync(const Model::ConfirmSubscriptionRequest& request, const ConfirmSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConfirmSubscriptionCallable(const Model::ConfirmSubscriptionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ConfirmSubscriptionOutcomeCallable ConfirmSubscriptionCallable(Model::ConfirmSubscriptionRequest&& request) const;
+
+        /**
+         * Same as ConfirmSubscriptionAsync(const Model::ConfirmSubscriptionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ConfirmSubscriptionAsync(Model::ConfirmSubscriptionRequest&& request, const ConfirmSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a platform application object for one of the supported push
          * notification services, such as APNS and GCM, to which devices and mobile apps
@@ -451,6 +490,18 @@ namespace Model
          */
         virtual void CreatePlatformApplicationAsync(const Model::CreatePlatformApplicationRequest& request, const CreatePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePlatformApplicationCallable(const Model::CreatePlatformApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreatePlatformApplicationOutcomeCallable CreatePlatformApplicationCallable(Model::CreatePlatformApplicationRequest&& request) const;
+
+        /**
+         * Same as CreatePlatformApplicationAsync(const Model::CreatePlatformApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreatePlatformApplicationAsync(Model::CreatePlatformApplicationRequest&& request, const CreatePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an endpoint for a device and mobile app on one of the supported push
          * notification services, such as GCM and APNS. <code>CreatePlatformEndpoint</code>
@@ -521,6 +572,18 @@ namespace Model
          */
         virtual void CreatePlatformEndpointAsync(const Model::CreatePlatformEndpointRequest& request, const CreatePlatformEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePlatformEndpointCallable(const Model::CreatePlatformEndpointRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreatePlatformEndpointOutcomeCallable CreatePlatformEndpointCallable(Model::CreatePlatformEndpointRequest&& request) const;
+
+        /**
+         * Same as CreatePlatformEndpointAsync(const Model::CreatePlatformEndpointRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreatePlatformEndpointAsync(Model::CreatePlatformEndpointRequest&& request, const CreatePlatformEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a topic to which notifications can be published. Users can create at
          * most 100,000 topics. For more information, see <a
@@ -552,6 +615,18 @@ namespace Model
          */
         virtual void CreateTopicAsync(const Model::CreateTopicRequest& request, const CreateTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTopicCallable(const Model::CreateTopicRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateTopicOutcomeCallable CreateTopicCallable(Model::CreateTopicRequest&& request) const;
+
+        /**
+         * Same as CreateTopicAsync(const Model::CreateTopicRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateTopicAsync(Model::CreateTopicRequest&& request, const CreateTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the endpoint for a device and mobile app from Amazon SNS. This action
          * is idempotent. For more information, see <a
@@ -586,6 +661,18 @@ namespace Model
          */
         virtual void DeleteEndpointAsync(const Model::DeleteEndpointRequest& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteEndpointCallable(const Model::DeleteEndpointRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteEndpointOutcomeCallable DeleteEndpointCallable(Model::DeleteEndpointRequest&& request) const;
+
+        /**
+         * Same as DeleteEndpointAsync(const Model::DeleteEndpointRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteEndpointAsync(Model::DeleteEndpointRequest&& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a platform application object for one of the supported push
          * notification services, such as APNS and GCM. For more information, see <a
@@ -614,6 +701,18 @@ namespace Model
          */
         virtual void DeletePlatformApplicationAsync(const Model::DeletePlatformApplicationRequest& request, const DeletePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePlatformApplicationCallable(const Model::DeletePlatformApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeletePlatformApplicationOutcomeCallable DeletePlatformApplicationCallable(Model::DeletePlatformApplicationRequest&& request) const;
+
+        /**
+         * Same as DeletePlatformApplicationAsync(const Model::DeletePlatformApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeletePlatformApplicationAsync(Model::DeletePlatformApplicationRequest&& request, const DeletePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a topic and all its subscriptions. Deleting a topic might prevent
          * some messages previously sent to the topic from being delivered to subscribers.
@@ -642,6 +741,18 @@ namespace Model
          */
         virtual void DeleteTopicAsync(const Model::DeleteTopicRequest& request, const DeleteTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTopicCallable(const Model::DeleteTopicRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTopicOutcomeCallable DeleteTopicCallable(Model::DeleteTopicRequest&& request) const;
+
+        /**
+         * Same as DeleteTopicAsync(const Model::DeleteTopicRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTopicAsync(Model::DeleteTopicRequest&& request, const DeleteTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the endpoint attributes for a device on one of the supported push
          * notification services, such as GCM and APNS. For more information, see <a
@@ -670,6 +781,18 @@ namespace Model
          */
         virtual void GetEndpointAttributesAsync(const Model::GetEndpointAttributesRequest& request, const GetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetEndpointAttributesCallable(const Model::GetEndpointAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetEndpointAttributesOutcomeCallable GetEndpointAttributesCallable(Model::GetEndpointAttributesRequest&& request) const;
+
+        /**
+         * Same as GetEndpointAttributesAsync(const Model::GetEndpointAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetEndpointAttributesAsync(Model::GetEndpointAttributesRequest&& request, const GetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the attributes of the platform application object for the supported
          * push notification services, such as APNS and GCM. For more information, see <a
@@ -698,6 +821,18 @@ namespace Model
          */
         virtual void GetPlatformApplicationAttributesAsync(const Model::GetPlatformApplicationAttributesRequest& request, const GetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPlatformApplicationAttributesCallable(const Model::GetPlatformApplicationAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetPlatformApplicationAttributesOutcomeCallable GetPlatformApplicationAttributesCallable(Model::GetPlatformApplicationAttributesRequest&& request) const;
+
+        /**
+         * Same as GetPlatformApplicationAttributesAsync(const Model::GetPlatformApplicationAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetPlatformApplicationAttributesAsync(Model::GetPlatformApplicationAttributesRequest&& request, const GetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the settings for sending SMS messages from your account.</p> <p>These
          * settings are set with the <code>SetSMSAttributes</code> action.</p>
@@ -720,6 +855,18 @@ namespace Model
          */
         virtual void GetSMSAttributesAsync(const Model::GetSMSAttributesRequest& request, const GetSMSAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSMSAttributesCallable(const Model::GetSMSAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetSMSAttributesOutcomeCallable GetSMSAttributesCallable(Model::GetSMSAttributesRequest&& request) const;
+
+        /**
+         * Same as GetSMSAttributesAsync(const Model::GetSMSAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetSMSAttributesAsync(Model::GetSMSAttributesRequest&& request, const GetSMSAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns all of the properties of a subscription.</p>
          */
@@ -739,6 +886,18 @@ namespace Model
          */
         virtual void GetSubscriptionAttributesAsync(const Model::GetSubscriptionAttributesRequest& request, const GetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSubscriptionAttributesCallable(const Model::GetSubscriptionAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetSubscriptionAttributesOutcomeCallable GetSubscriptionAttributesCallable(Model::GetSubscriptionAttributesRequest&& request) const;
+
+        /**
+         * Same as GetSubscriptionAttributesAsync(const Model::GetSubscriptionAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetSubscriptionAttributesAsync(Model::GetSubscriptionAttributesRequest&& request, const GetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns all of the properties of a topic. Topic properties returned might
          * differ based on the authorization of the user. </p>
@@ -761,6 +920,18 @@ namespace Model
          */
         virtual void GetTopicAttributesAsync(const Model::GetTopicAttributesRequest& request, const GetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTopicAttributesCallable(const Model::GetTopicAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetTopicAttributesOutcomeCallable GetTopicAttributesCallable(Model::GetTopicAttributesRequest&& request) const;
+
+        /**
+         * Same as GetTopicAttributesAsync(const Model::GetTopicAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetTopicAttributesAsync(Model::GetTopicAttributesRequest&& request, const GetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the endpoints and endpoint attributes for devices in a supported push
          * notification service, such as GCM and APNS. The results for
@@ -807,6 +978,18 @@ namespace Model
          */
         virtual void ListEndpointsByPlatformApplicationAsync(const Model::ListEndpointsByPlatformApplicationRequest& request, const ListEndpointsByPlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListEndpointsByPlatformApplicationCallable(const Model::ListEndpointsByPlatformApplicationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListEndpointsByPlatformApplicationOutcomeCallable ListEndpointsByPlatformApplicationCallable(Model::ListEndpointsByPlatformApplicationRequest&& request) const;
+
+        /**
+         * Same as ListEndpointsByPlatformApplicationAsync(const Model::ListEndpointsByPlatformApplicationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListEndpointsByPlatformApplicationAsync(Model::ListEndpointsByPlatformApplicationRequest&& request, const ListEndpointsByPlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of phone numbers that are opted out, meaning you cannot send
          * SMS messages to them.</p> <p>The results for
@@ -847,6 +1030,18 @@ namespace Model
          */
         virtual void ListPhoneNumbersOptedOutAsync(const Model::ListPhoneNumbersOptedOutRequest& request, const ListPhoneNumbersOptedOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPhoneNumbersOptedOutCallable(const Model::ListPhoneNumbersOptedOutRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListPhoneNumbersOptedOutOutcomeCallable ListPhoneNumbersOptedOutCallable(Model::ListPhoneNumbersOptedOutRequest&& request) const;
+
+        /**
+         * Same as ListPhoneNumbersOptedOutAsync(const Model::ListPhoneNumbersOptedOutRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPhoneNumbersOptedOutAsync(Model::ListPhoneNumbersOptedOutRequest&& request, const ListPhoneNumbersOptedOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the platform application objects for the supported push notification
          * services, such as APNS and GCM. The results for
@@ -893,6 +1088,18 @@ namespace Model
          */
         virtual void ListPlatformApplicationsAsync(const Model::ListPlatformApplicationsRequest& request, const ListPlatformApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPlatformApplicationsCallable(const Model::ListPlatformApplicationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListPlatformApplicationsOutcomeCallable ListPlatformApplicationsCallable(Model::ListPlatformApplicationsRequest&& request) const;
+
+        /**
+         * Same as ListPlatformApplicationsAsync(const Model::ListPlatformApplicationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListPlatformApplicationsAsync(Model::ListPlatformApplicationsRequest&& request, const ListPlatformApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of the requester's subscriptions. Each call returns a limited
          * list of subscriptions, up to 100. If there are more subscriptions, a
@@ -924,6 +1131,18 @@ namespace Model
          */
         virtual void ListSubscriptionsAsync(const Model::ListSubscriptionsRequest& request, const ListSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSubscriptionsCallable(const Model::ListSubscriptionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListSubscriptionsOutcomeCallable ListSubscriptionsCallable(Model::ListSubscriptionsRequest&& request) const;
+
+        /**
+         * Same as ListSubscriptionsAsync(const Model::ListSubscriptionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListSubscriptionsAsync(Model::ListSubscriptionsRequest&& request, const ListSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of the subscriptions to a specific topic. Each call returns a
          * limited list of subscriptions, up to 100. If there are more subscriptions, a
@@ -955,6 +1174,18 @@ namespace Model
          */
         virtual void ListSubscriptionsByTopicAsync(const Model::ListSubscriptionsByTopicRequest& request, const ListSubscriptionsByTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSubscriptionsByTopicCallable(const Model::ListSubscriptionsByTopicRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListSubscriptionsByTopicOutcomeCallable ListSubscriptionsByTopicCallable(Model::ListSubscriptionsByTopicRequest&& request) const;
+
+        /**
+         * Same as ListSubscriptionsByTopicAsync(const Model::ListSubscriptionsByTopicRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListSubscriptionsByTopicAsync(Model::ListSubscriptionsByTopicRequest&& request, const ListSubscriptionsByTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of the requester's topics. Each call returns a limited list of
          * topics, up to 100. If there are more topics, a <code>NextToken</code> is also
@@ -983,6 +1214,18 @@ namespace Model
          */
         virtual void ListTopicsAsync(const Model::ListTopicsRequest& request, const ListTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTopicsCallable(const Model::ListTopicsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTopicsOutcomeCallable ListTopicsCallable(Model::ListTopicsRequest&& request) const;
+
+        /**
+         * Same as ListTopicsAsync(const Model::ListTopicsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTopicsAsync(Model::ListTopicsRequest&& request, const ListTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Use this request to opt in a phone number that is opted out, which enables
          * you to resume sending SMS messages to the number.</p> <p>You can opt in a phone
@@ -1008,6 +1251,18 @@ namespace Model
          */
         virtual void OptInPhoneNumberAsync(const Model::OptInPhoneNumberRequest& request, const OptInPhoneNumberResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as OptInPhoneNumberCallable(const Model::OptInPhoneNumberRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::OptInPhoneNumberOutcomeCallable OptInPhoneNumberCallable(Model::OptInPhoneNumberRequest&& request) const;
+
+        /**
+         * Same as OptInPhoneNumberAsync(const Model::OptInPhoneNumberRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void OptInPhoneNumberAsync(Model::OptInPhoneNumberRequest&& request, const OptInPhoneNumberResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sends a message to all of a topic's subscribed endpoints. When a
          * <code>messageId</code> is returned, the message has been saved and Amazon SNS
@@ -1060,6 +1315,18 @@ namespace Model
          */
         virtual void PublishAsync(const Model::PublishRequest& request, const PublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PublishCallable(const Model::PublishRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PublishOutcomeCallable PublishCallable(Model::PublishRequest&& request) const;
+
+        /**
+         * Same as PublishAsync(const Model::PublishRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PublishAsync(Model::PublishRequest&& request, const PublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes a statement from a topic's access control policy.</p>
          */
@@ -1079,6 +1346,18 @@ namespace Model
          */
         virtual void RemovePermissionAsync(const Model::RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemovePermissionCallable(const Model::RemovePermissionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemovePermissionOutcomeCallable RemovePermissionCallable(Model::RemovePermissionRequest&& request) const;
+
+        /**
+         * Same as RemovePermissionAsync(const Model::RemovePermissionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemovePermissionAsync(Model::RemovePermissionRequest&& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the attributes for an endpoint for a device on one of the supported push
          * notification services, such as GCM and APNS. For more information, see <a
@@ -1107,6 +1386,18 @@ namespace Model
          */
         virtual void SetEndpointAttributesAsync(const Model::SetEndpointAttributesRequest& request, const SetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetEndpointAttributesCallable(const Model::SetEndpointAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetEndpointAttributesOutcomeCallable SetEndpointAttributesCallable(Model::SetEndpointAttributesRequest&& request) const;
+
+        /**
+         * Same as SetEndpointAttributesAsync(const Model::SetEndpointAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetEndpointAttributesAsync(Model::SetEndpointAttributesRequest&& request, const SetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the attributes of the platform application object for the supported push
          * notification services, such as APNS and GCM. For more information, see <a
@@ -1144,6 +1435,18 @@ namespace Model
          */
         virtual void SetPlatformApplicationAttributesAsync(const Model::SetPlatformApplicationAttributesRequest& request, const SetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetPlatformApplicationAttributesCallable(const Model::SetPlatformApplicationAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetPlatformApplicationAttributesOutcomeCallable SetPlatformApplicationAttributesCallable(Model::SetPlatformApplicationAttributesRequest&& request) const;
+
+        /**
+         * Same as SetPlatformApplicationAttributesAsync(const Model::SetPlatformApplicationAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetPlatformApplicationAttributesAsync(Model::SetPlatformApplicationAttributesRequest&& request, const SetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Use this request to set the default settings for sending SMS messages and
          * receiving daily SMS usage reports.</p> <p>You can override some of these
@@ -1181,6 +1484,18 @@ namespace Model
          */
         virtual void SetSMSAttributesAsync(const Model::SetSMSAttributesRequest& request, const SetSMSAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetSMSAttributesCallable(const Model::SetSMSAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetSMSAttributesOutcomeCallable SetSMSAttributesCallable(Model::SetSMSAttributesRequest&& request) const;
+
+        /**
+         * Same as SetSMSAttributesAsync(const Model::SetSMSAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetSMSAttributesAsync(Model::SetSMSAttributesRequest&& request, const SetSMSAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Allows a subscription owner to set an attribute of the topic to a new
          * value.</p>
@@ -1203,6 +1518,18 @@ namespace Model
          */
         virtual void SetSubscriptionAttributesAsync(const Model::SetSubscriptionAttributesRequest& request, const SetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetSubscriptionAttributesCallable(const Model::SetSubscriptionAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetSubscriptionAttributesOutcomeCallable SetSubscriptionAttributesCallable(Model::SetSubscriptionAttributesRequest&& request) const;
+
+        /**
+         * Same as SetSubscriptionAttributesAsync(const Model::SetSubscriptionAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetSubscriptionAttributesAsync(Model::SetSubscriptionAttributesRequest&& request, const SetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Allows a topic owner to set an attribute of the topic to a new value.</p>
          */
@@ -1222,6 +1549,18 @@ namespace Model
          */
         virtual void SetTopicAttributesAsync(const Model::SetTopicAttributesRequest& request, const SetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetTopicAttributesCallable(const Model::SetTopicAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetTopicAttributesOutcomeCallable SetTopicAttributesCallable(Model::SetTopicAttributesRequest&& request) const;
+
+        /**
+         * Same as SetTopicAttributesAsync(const Model::SetTopicAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetTopicAttributesAsync(Model::SetTopicAttributesRequest&& request, const SetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Prepares to subscribe an endpoint by sending the endpoint a confirmation
          * message. To actually create a subscription, the endpoint owner must call the
@@ -1250,6 +1589,18 @@ namespace Model
          */
         virtual void SubscribeAsync(const Model::SubscribeRequest& request, const SubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SubscribeCallable(const Model::SubscribeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SubscribeOutcomeCallable SubscribeCallable(Model::SubscribeRequest&& request) const;
+
+        /**
+         * Same as SubscribeAsync(const Model::SubscribeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SubscribeAsync(Model::SubscribeRequest&& request, const SubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a subscription. If the subscription requires authentication for
          * deletion, only the owner of the subscription or the topic's owner can
@@ -1287,6 +1638,200 @@ namespace Model
          */
         virtual void UnsubscribeAsync(const Model::UnsubscribeRequest& request, const UnsubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnsubscribeCallable(const Model::UnsubscribeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UnsubscribeOutcomeCallable UnsubscribeCallable(Model::UnsubscribeRequest&& request) const;
+
+        /**
+         * Same as UnsubscribeAsync(const Model::UnsubscribeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UnsubscribeAsync(Model::UnsubscribeRequest&& request, const UnsubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListEndpointsByPlatformApplication(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SNSClient, Model::ListEndpointsByPlatformApplicationRequest, Model::ListEndpointsByPlatformApplicationOutcome> ListEndpointsByPlatformApplicationPaginator(const Model::ListEndpointsByPlatformApplicationRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListPhoneNumbersOptedOut(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SNSClient, Model::ListPhoneNumbersOptedOutRequest, Model::ListPhoneNumbersOptedOutOutcome> ListPhoneNumbersOptedOutPaginator(const Model::ListPhoneNumbersOptedOutRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListPlatformApplications(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SNSClient, Model::ListPlatformApplicationsRequest, Model::ListPlatformApplicationsOutcome> ListPlatformApplicationsPaginator(const Model::ListPlatformApplicationsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListSubscriptions(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SNSClient, Model::ListSubscriptionsRequest, Model::ListSubscriptionsOutcome> ListSubscriptionsPaginator(const Model::ListSubscriptionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListSubscriptionsByTopic(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SNSClient, Model::ListSubscriptionsByTopicRequest, Model::ListSubscriptionsByTopicOutcome> ListSubscriptionsByTopicPaginator(const Model::ListSubscriptionsByTopicRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListTopics(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SNSClient, Model::ListTopicsRequest, Model::ListTopicsOutcome> ListTopicsPaginator(const Model::ListTopicsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddPermission(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::AddPermissionRequest, Model::AddPermissionOutcome> AddPermissionAwaitable(Model::AddPermissionRequest request) const;
+
+        /**
+         * co_await-able form of CheckIfPhoneNumberIsOptedOut(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::CheckIfPhoneNumberIsOptedOutRequest, Model::CheckIfPhoneNumberIsOptedOutOutcome> CheckIfPhoneNumberIsOptedOutAwaitable(Model::CheckIfPhoneNumberIsOptedOutRequest request) const;
+
+        /**
+         * co_await-able form of ConfirmSubscription(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::ConfirmSubscriptionRequest, Model::ConfirmSubscriptionOutcome> ConfirmSubscriptionAwaitable(Model::ConfirmSubscriptionRequest request) const;
+
+        /**
+         * co_await-able form of CreatePlatformApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::CreatePlatformApplicationRequest, Model::CreatePlatformApplicationOutcome> CreatePlatformApplicationAwaitable(Model::CreatePlatformApplicationRequest request) const;
+
+        /**
+         * co_await-able form of CreatePlatformEndpoint(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::CreatePlatformEndpointRequest, Model::CreatePlatformEndpointOutcome> CreatePlatformEndpointAwaitable(Model::CreatePlatformEndpointRequest request) const;
+
+        /**
+         * co_await-able form of CreateTopic(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::CreateTopicRequest, Model::CreateTopicOutcome> CreateTopicAwaitable(Model::CreateTopicRequest request) const;
+
+        /**
+         * co_await-able form of DeleteEndpoint(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::DeleteEndpointRequest, Model::DeleteEndpointOutcome> DeleteEndpointAwaitable(Model::DeleteEndpointRequest request) const;
+
+        /**
+         * co_await-able form of DeletePlatformApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::DeletePlatformApplicationRequest, Model::DeletePlatformApplicationOutcome> DeletePlatformApplicationAwaitable(Model::DeletePlatformApplicationRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTopic(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::DeleteTopicRequest, Model::DeleteTopicOutcome> DeleteTopicAwaitable(Model::DeleteTopicRequest request) const;
+
+        /**
+         * co_await-able form of GetEndpointAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::GetEndpointAttributesRequest, Model::GetEndpointAttributesOutcome> GetEndpointAttributesAwaitable(Model::GetEndpointAttributesRequest request) const;
+
+        /**
+         * co_await-able form of GetPlatformApplicationAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::GetPlatformApplicationAttributesRequest, Model::GetPlatformApplicationAttributesOutcome> GetPlatformApplicationAttributesAwaitable(Model::GetPlatformApplicationAttributesRequest request) const;
+
+        /**
+         * co_await-able form of GetSMSAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::GetSMSAttributesRequest, Model::GetSMSAttributesOutcome> GetSMSAttributesAwaitable(Model::GetSMSAttributesRequest request) const;
+
+        /**
+         * co_await-able form of GetSubscriptionAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::GetSubscriptionAttributesRequest, Model::GetSubscriptionAttributesOutcome> GetSubscriptionAttributesAwaitable(Model::GetSubscriptionAttributesRequest request) const;
+
+        /**
+         * co_await-able form of GetTopicAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::GetTopicAttributesRequest, Model::GetTopicAttributesOutcome> GetTopicAttributesAwaitable(Model::GetTopicAttributesRequest request) const;
+
+        /**
+         * co_await-able form of ListEndpointsByPlatformApplication(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::ListEndpointsByPlatformApplicationRequest, Model::ListEndpointsByPlatformApplicationOutcome> ListEndpointsByPlatformApplicationAwaitable(Model::ListEndpointsByPlatformApplicationRequest request) const;
+
+        /**
+         * co_await-able form of ListPhoneNumbersOptedOut(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::ListPhoneNumbersOptedOutRequest, Model::ListPhoneNumbersOptedOutOutcome> ListPhoneNumbersOptedOutAwaitable(Model::ListPhoneNumbersOptedOutRequest request) const;
+
+        /**
+         * co_await-able form of ListPlatformApplications(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::ListPlatformApplicationsRequest, Model::ListPlatformApplicationsOutcome> ListPlatformApplicationsAwaitable(Model::ListPlatformApplicationsRequest request) const;
+
+        /**
+         * co_await-able form of ListSubscriptions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::ListSubscriptionsRequest, Model::ListSubscriptionsOutcome> ListSubscriptionsAwaitable(Model::ListSubscriptionsRequest request) const;
+
+        /**
+         * co_await-able form of ListSubscriptionsByTopic(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::ListSubscriptionsByTopicRequest, Model::ListSubscriptionsByTopicOutcome> ListSubscriptionsByTopicAwaitable(Model::ListSubscriptionsByTopicRequest request) const;
+
+        /**
+         * co_await-able form of ListTopics(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::ListTopicsRequest, Model::ListTopicsOutcome> ListTopicsAwaitable(Model::ListTopicsRequest request) const;
+
+        /**
+         * co_await-able form of OptInPhoneNumber(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::OptInPhoneNumberRequest, Model::OptInPhoneNumberOutcome> OptInPhoneNumberAwaitable(Model::OptInPhoneNumberRequest request) const;
+
+        /**
+         * co_await-able form of Publish(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::PublishRequest, Model::PublishOutcome> PublishAwaitable(Model::PublishRequest request) const;
+
+        /**
+         * co_await-able form of RemovePermission(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::RemovePermissionRequest, Model::RemovePermissionOutcome> RemovePermissionAwaitable(Model::RemovePermissionRequest request) const;
+
+        /**
+         * co_await-able form of SetEndpointAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::SetEndpointAttributesRequest, Model::SetEndpointAttributesOutcome> SetEndpointAttributesAwaitable(Model::SetEndpointAttributesRequest request) const;
+
+        /**
+         * co_await-able form of SetPlatformApplicationAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::SetPlatformApplicationAttributesRequest, Model::SetPlatformApplicationAttributesOutcome> SetPlatformApplicationAttributesAwaitable(Model::SetPlatformApplicationAttributesRequest request) const;
+
+        /**
+         * co_await-able form of SetSMSAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::SetSMSAttributesRequest, Model::SetSMSAttributesOutcome> SetSMSAttributesAwaitable(Model::SetSMSAttributesRequest request) const;
+
+        /**
+         * co_await-able form of SetSubscriptionAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::SetSubscriptionAttributesRequest, Model::SetSubscriptionAttributesOutcome> SetSubscriptionAttributesAwaitable(Model::SetSubscriptionAttributesRequest request) const;
+
+        /**
+         * co_await-able form of SetTopicAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::SetTopicAttributesRequest, Model::SetTopicAttributesOutcome> SetTopicAttributesAwaitable(Model::SetTopicAttributesRequest request) const;
+
+        /**
+         * co_await-able form of Subscribe(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::SubscribeRequest, Model::SubscribeOutcome> SubscribeAwaitable(Model::SubscribeRequest request) const;
+
+        /**
+         * co_await-able form of Unsubscribe(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SNSClient, Model::UnsubscribeRequest, Model::UnsubscribeOutcome> UnsubscribeAwaitable(Model::UnsubscribeRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AddPermissionRequest();
+    inline const char* GetServiceRequestName() const override { return "AddPermission"; }
+
     Aws::String SerializePayload() const override;
 
     /**
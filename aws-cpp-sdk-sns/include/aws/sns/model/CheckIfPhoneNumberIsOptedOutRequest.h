@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CheckIfPhoneNumberIsOptedOutRequest();
+    inline const char* GetServiceRequestName() const override { return "CheckIfPhoneNumberIsOptedOut"; }
+
     Aws::String SerializePayload() const override;
 
     /**
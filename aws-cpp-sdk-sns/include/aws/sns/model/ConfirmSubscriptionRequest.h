@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ConfirmSubscriptionRequest();
+    inline const char* GetServiceRequestName() const override { return "ConfirmSubscription"; }
+
     Aws::String SerializePayload() const override;
 
     /**
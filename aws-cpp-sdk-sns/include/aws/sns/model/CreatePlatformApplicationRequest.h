@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreatePlatformApplicationRequest();
+    inline const char* GetServiceRequestName() const override { return "CreatePlatformApplication"; }
+
     Aws::String SerializePayload() const override;
 
     /**
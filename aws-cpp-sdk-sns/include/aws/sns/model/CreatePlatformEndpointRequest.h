@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreatePlatformEndpointRequest();
+    inline const char* GetServiceRequestName() const override { return "CreatePlatformEndpoint"; }
+
     Aws::String SerializePayload() const override;
 
     /**
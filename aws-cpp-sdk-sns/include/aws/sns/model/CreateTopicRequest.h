@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateTopicRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateTopic"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeletePlatformApplicationRequest();
+    inline const char* GetServiceRequestName() const override { return "DeletePlatformApplication"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteTopicRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteTopic"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetEndpointAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetEndpointAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetPlatformApplicationAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetPlatformApplicationAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     GetSMSAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetSMSAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetSubscriptionAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetSubscriptionAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
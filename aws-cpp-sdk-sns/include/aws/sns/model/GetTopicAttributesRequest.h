@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetTopicAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetTopicAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListEndpointsByPlatformApplicationRequest();
+    inline const char* GetServiceRequestName() const override { return "ListEndpointsByPlatformApplication"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListPhoneNumbersOptedOutRequest();
+    inline const char* GetServiceRequestName() const override { return "ListPhoneNumbersOptedOut"; }
+
     Aws::String SerializePayload() const override;
 
     /**
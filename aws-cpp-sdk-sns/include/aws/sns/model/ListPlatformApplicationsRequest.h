@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListPlatformApplicationsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListPlatformApplications"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListSubscriptionsByTopicRequest();
+    inline const char* GetServiceRequestName() const override { return "ListSubscriptionsByTopic"; }
+
     Aws::String SerializePayload() const override;
 
     /**
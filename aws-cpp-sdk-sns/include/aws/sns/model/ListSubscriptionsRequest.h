@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListSubscriptionsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListSubscriptions"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListTopicsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTopics"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     OptInPhoneNumberRequest();
+    inline const char* GetServiceRequestName() const override { return "OptInPhoneNumber"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     PublishRequest();
+    inline const char* GetServiceRequestName() const override { return "Publish"; }
+
     Aws::String SerializePayload() const override;
 
     /**
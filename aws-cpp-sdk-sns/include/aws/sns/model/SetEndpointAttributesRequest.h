@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetEndpointAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "SetEndpointAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetPlatformApplicationAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "SetPlatformApplicationAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
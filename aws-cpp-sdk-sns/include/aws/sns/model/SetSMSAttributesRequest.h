@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     SetSMSAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "SetSMSAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     SetSubscriptionAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "SetSubscriptionAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
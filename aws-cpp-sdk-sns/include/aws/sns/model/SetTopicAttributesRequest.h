@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     SetTopicAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "SetTopicAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     SubscribeRequest();
+    inline const char* GetServiceRequestName() const override { return "Subscribe"; }
+
     Aws::String SerializePayload() const override;
 
     /**
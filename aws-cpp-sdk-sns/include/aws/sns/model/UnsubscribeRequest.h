@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UnsubscribeRequest();
+    inline const char* GetServiceRequestName() const override { return "Unsubscribe"; }
+
     Aws::String SerializePayload() const override;
 
     /**
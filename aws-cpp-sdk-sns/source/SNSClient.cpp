@@ -139,7 +139,7 @@ AddPermissionOutcome SNSClient::AddPermission(const AddPermissionRequest& reques
 
 AddPermissionOutcomeCallable SNSClient::AddPermissionCallable(const AddPermissionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddPermission( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddPermission( request ); } );
 }
 
 void SNSClient::AddPermissionAsync(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -147,6 +147,16 @@ void SNSClient::AddPermissionAsync(const AddPermissionRequest& request, const Ad
   m_executor->Submit( [this, request, handler, context](){ this->AddPermissionAsyncHelper( request, handler, context ); } );
 }
 
+AddPermissionOutcomeCallable SNSClient::AddPermissionCallable(AddPermissionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::AddPermission, this, std::move(request)));
+}
+
+void SNSClient::AddPermissionAsync(AddPermissionRequest&& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::AddPermissionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::AddPermissionAsyncHelper(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddPermission(request), context);
@@ -169,7 +179,7 @@ CheckIfPhoneNumberIsOptedOutOutcome SNSClient::CheckIfPhoneNumberIsOptedOut(cons
 
 CheckIfPhoneNumberIsOptedOutOutcomeCallable SNSClient::CheckIfPhoneNumberIsOptedOutCallable(const CheckIfPhoneNumberIsOptedOutRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CheckIfPhoneNumberIsOptedOut( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CheckIfPhoneNumberIsOptedOut( request ); } );
 }
 
 void SNSClient::CheckIfPhoneNumberIsOptedOutAsync(const CheckIfPhoneNumberIsOptedOutRequest& request, const CheckIfPhoneNumberIsOptedOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -177,6 +187,16 @@ void SNSClient::CheckIfPhoneNumberIsOptedOutAsync(const CheckIfPhoneNumberIsOpte
   m_executor->Submit( [this, request, handler, context](){ this->CheckIfPhoneNumberIsOptedOutAsyncHelper( request, handler, context ); } );
 }
 
+CheckIfPhoneNumberIsOptedOutOutcomeCallable SNSClient::CheckIfPhoneNumberIsOptedOutCallable(CheckIfPhoneNumberIsOptedOutRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::CheckIfPhoneNumberIsOptedOut, this, std::move(request)));
+}
+
+void SNSClient::CheckIfPhoneNumberIsOptedOutAsync(CheckIfPhoneNumberIsOptedOutRequest&& request, const CheckIfPhoneNumberIsOptedOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::CheckIfPhoneNumberIsOptedOutAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::CheckIfPhoneNumberIsOptedOutAsyncHelper(const CheckIfPhoneNumberIsOptedOutRequest& request, const CheckIfPhoneNumberIsOptedOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CheckIfPhoneNumberIsOptedOut(request), context);
@@ -199,7 +219,7 @@ ConfirmSubscriptionOutcome SNSClient::ConfirmSubscription(const ConfirmSubscript
 
 ConfirmSubscriptionOutcomeCallable SNSClient::ConfirmSubscriptionCallable(const ConfirmSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ConfirmSubscription( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ConfirmSubscription( request ); } );
 }
 
 void SNSClient::ConfirmSubscriptionAsync(const ConfirmSubscriptionRequest& request, const ConfirmSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -207,6 +227,16 @@ void SNSClient::ConfirmSubscriptionAsync(const ConfirmSubscriptionRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ConfirmSubscriptionAsyncHelper( request, handler, context ); } );
 }
 
+ConfirmSubscriptionOutcomeCallable SNSClient::ConfirmSubscriptionCallable(ConfirmSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::ConfirmSubscription, this, std::move(request)));
+}
+
+void SNSClient::ConfirmSubscriptionAsync(ConfirmSubscriptionRequest&& request, const ConfirmSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::ConfirmSubscriptionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::ConfirmSubscriptionAsyncHelper(const ConfirmSubscriptionRequest& request, const ConfirmSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ConfirmSubscription(request), context);
@@ -229,7 +259,7 @@ CreatePlatformApplicationOutcome SNSClient::CreatePlatformApplication(const Crea
 
 CreatePlatformApplicationOutcomeCallable SNSClient::CreatePlatformApplicationCallable(const CreatePlatformApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreatePlatformApplication( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreatePlatformApplication( request ); } );
 }
 
 void SNSClient::CreatePlatformApplicationAsync(const CreatePlatformApplicationRequest& request, const CreatePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -237,6 +267,16 @@ void SNSClient::CreatePlatformApplicationAsync(const CreatePlatformApplicationRe
   m_executor->Submit( [this, request, handler, context](){ this->CreatePlatformApplicationAsyncHelper( request, handler, context ); } );
 }
 
+CreatePlatformApplicationOutcomeCallable SNSClient::CreatePlatformApplicationCallable(CreatePlatformApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::CreatePlatformApplication, this, std::move(request)));
+}
+
+void SNSClient::CreatePlatformApplicationAsync(CreatePlatformApplicationRequest&& request, const CreatePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::CreatePlatformApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::CreatePlatformApplicationAsyncHelper(const CreatePlatformApplicationRequest& request, const CreatePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreatePlatformApplication(request), context);
@@ -259,7 +299,7 @@ CreatePlatformEndpointOutcome SNSClient::CreatePlatformEndpoint(const CreatePlat
 
 CreatePlatformEndpointOutcomeCallable SNSClient::CreatePlatformEndpointCallable(const CreatePlatformEndpointRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreatePlatformEndpoint( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreatePlatformEndpoint( request ); } );
 }
 
 void SNSClient::CreatePlatformEndpointAsync(const CreatePlatformEndpointRequest& request, const CreatePlatformEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -267,6 +307,16 @@ void SNSClient::CreatePlatformEndpointAsync(const CreatePlatformEndpointRequest&
   m_executor->Submit( [this, request, handler, context](){ this->CreatePlatformEndpointAsyncHelper( request, handler, context ); } );
 }
 
+CreatePlatformEndpointOutcomeCallable SNSClient::CreatePlatformEndpointCallable(CreatePlatformEndpointRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::CreatePlatformEndpoint, this, std::move(request)));
+}
+
+void SNSClient::CreatePlatformEndpointAsync(CreatePlatformEndpointRequest&& request, const CreatePlatformEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::CreatePlatformEndpointAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::CreatePlatformEndpointAsyncHelper(const CreatePlatformEndpointRequest& request, const CreatePlatformEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreatePlatformEndpoint(request), context);
@@ -289,7 +339,7 @@ CreateTopicOutcome SNSClient::CreateTopic(const CreateTopicRequest& request) con
 
 CreateTopicOutcomeCallable SNSClient::CreateTopicCallable(const CreateTopicRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateTopic( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateTopic( request ); } );
 }
 
 void SNSClient::CreateTopicAsync(const CreateTopicRequest& request, const CreateTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -297,6 +347,16 @@ void SNSClient::CreateTopicAsync(const CreateTopicRequest& request, const Create
   m_executor->Submit( [this, request, handler, context](){ this->CreateTopicAsyncHelper( request, handler, context ); } );
 }
 
+CreateTopicOutcomeCallable SNSClient::CreateTopicCallable(CreateTopicRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::CreateTopic, this, std::move(request)));
+}
+
+void SNSClient::CreateTopicAsync(CreateTopicRequest&& request, const CreateTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::CreateTopicAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::CreateTopicAsyncHelper(const CreateTopicRequest& request, const CreateTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateTopic(request), context);
@@ -319,7 +379,7 @@ DeleteEndpointOutcome SNSClient::DeleteEndpoint(const DeleteEndpointRequest& req
 
 DeleteEndpointOutcomeCallable SNSClient::DeleteEndpointCallable(const DeleteEndpointRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteEndpoint( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteEndpoint( request ); } );
 }
 
 void SNSClient::DeleteEndpointAsync(const DeleteEndpointRequest& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -327,6 +387,16 @@ void SNSClient::DeleteEndpointAsync(const DeleteEndpointRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DeleteEndpointAsyncHelper( request, handler, context ); } );
 }
 
+DeleteEndpointOutcomeCallable SNSClient::DeleteEndpointCallable(DeleteEndpointRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::DeleteEndpoint, this, std::move(request)));
+}
+
+void SNSClient::DeleteEndpointAsync(DeleteEndpointRequest&& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::DeleteEndpointAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::DeleteEndpointAsyncHelper(const DeleteEndpointRequest& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteEndpoint(request), context);
@@ -349,7 +419,7 @@ DeletePlatformApplicationOutcome SNSClient::DeletePlatformApplication(const Dele
 
 DeletePlatformApplicationOutcomeCallable SNSClient::DeletePlatformApplicationCallable(const DeletePlatformApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeletePlatformApplication( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeletePlatformApplication( request ); } );
 }
 
 void SNSClient::DeletePlatformApplicationAsync(const DeletePlatformApplicationRequest& request, const DeletePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -357,6 +427,16 @@ void SNSClient::DeletePlatformApplicationAsync(const DeletePlatformApplicationRe
   m_executor->Submit( [this, request, handler, context](){ this->DeletePlatformApplicationAsyncHelper( request, handler, context ); } );
 }
 
+DeletePlatformApplicationOutcomeCallable SNSClient::DeletePlatformApplicationCallable(DeletePlatformApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::DeletePlatformApplication, this, std::move(request)));
+}
+
+void SNSClient::DeletePlatformApplicationAsync(DeletePlatformApplicationRequest&& request, const DeletePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::DeletePlatformApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::DeletePlatformApplicationAsyncHelper(const DeletePlatformApplicationRequest& request, const DeletePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeletePlatformApplication(request), context);
@@ -379,7 +459,7 @@ DeleteTopicOutcome SNSClient::DeleteTopic(const DeleteTopicRequest& request) con
 
 DeleteTopicOutcomeCallable SNSClient::DeleteTopicCallable(const DeleteTopicRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTopic( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTopic( request ); } );
 }
 
 void SNSClient::DeleteTopicAsync(const DeleteTopicRequest& request, const DeleteTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -387,6 +467,16 @@ void SNSClient::DeleteTopicAsync(const DeleteTopicRequest& request, const Delete
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTopicAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTopicOutcomeCallable SNSClient::DeleteTopicCallable(DeleteTopicRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::DeleteTopic, this, std::move(request)));
+}
+
+void SNSClient::DeleteTopicAsync(DeleteTopicRequest&& request, const DeleteTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::DeleteTopicAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::DeleteTopicAsyncHelper(const DeleteTopicRequest& request, const DeleteTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTopic(request), context);
@@ -409,7 +499,7 @@ GetEndpointAttributesOutcome SNSClient::GetEndpointAttributes(const GetEndpointA
 
 GetEndpointAttributesOutcomeCallable SNSClient::GetEndpointAttributesCallable(const GetEndpointAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetEndpointAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetEndpointAttributes( request ); } );
 }
 
 void SNSClient::GetEndpointAttributesAsync(const GetEndpointAttributesRequest& request, const GetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -417,6 +507,16 @@ void SNSClient::GetEndpointAttributesAsync(const GetEndpointAttributesRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->GetEndpointAttributesAsyncHelper( request, handler, context ); } );
 }
 
+GetEndpointAttributesOutcomeCallable SNSClient::GetEndpointAttributesCallable(GetEndpointAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::GetEndpointAttributes, this, std::move(request)));
+}
+
+void SNSClient::GetEndpointAttributesAsync(GetEndpointAttributesRequest&& request, const GetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::GetEndpointAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::GetEndpointAttributesAsyncHelper(const GetEndpointAttributesRequest& request, const GetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetEndpointAttributes(request), context);
@@ -439,7 +539,7 @@ GetPlatformApplicationAttributesOutcome SNSClient::GetPlatformApplicationAttribu
 
 GetPlatformApplicationAttributesOutcomeCallable SNSClient::GetPlatformApplicationAttributesCallable(const GetPlatformApplicationAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetPlatformApplicationAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetPlatformApplicationAttributes( request ); } );
 }
 
 void SNSClient::GetPlatformApplicationAttributesAsync(const GetPlatformApplicationAttributesRequest& request, const GetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -447,6 +547,16 @@ void SNSClient::GetPlatformApplicationAttributesAsync(const GetPlatformApplicati
   m_executor->Submit( [this, request, handler, context](){ this->GetPlatformApplicationAttributesAsyncHelper( request, handler, context ); } );
 }
 
+GetPlatformApplicationAttributesOutcomeCallable SNSClient::GetPlatformApplicationAttributesCallable(GetPlatformApplicationAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::GetPlatformApplicationAttributes, this, std::move(request)));
+}
+
+void SNSClient::GetPlatformApplicationAttributesAsync(GetPlatformApplicationAttributesRequest&& request, const GetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::GetPlatformApplicationAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::GetPlatformApplicationAttributesAsyncHelper(const GetPlatformApplicationAttributesRequest& request, const GetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetPlatformApplicationAttributes(request), context);
@@ -469,7 +579,7 @@ GetSMSAttributesOutcome SNSClient::GetSMSAttributes(const GetSMSAttributesReques
 
 GetSMSAttributesOutcomeCallable SNSClient::GetSMSAttributesCallable(const GetSMSAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetSMSAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetSMSAttributes( request ); } );
 }
 
 void SNSClient::GetSMSAttributesAsync(const GetSMSAttributesRequest& request, const GetSMSAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -477,6 +587,16 @@ void SNSClient::GetSMSAttributesAsync(const GetSMSAttributesRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->GetSMSAttributesAsyncHelper( request, handler, context ); } );
 }
 
+GetSMSAttributesOutcomeCallable SNSClient::GetSMSAttributesCallable(GetSMSAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::GetSMSAttributes, this, std::move(request)));
+}
+
+void SNSClient::GetSMSAttributesAsync(GetSMSAttributesRequest&& request, const GetSMSAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::GetSMSAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::GetSMSAttributesAsyncHelper(const GetSMSAttributesRequest& request, const GetSMSAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetSMSAttributes(request), context);
@@ -499,7 +619,7 @@ GetSubscriptionAttributesOutcome SNSClient::GetSubscriptionAttributes(const GetS
 
 GetSubscriptionAttributesOutcomeCallable SNSClient::GetSubscriptionAttributesCallable(const GetSubscriptionAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetSubscriptionAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetSubscriptionAttributes( request ); } );
 }
 
 void SNSClient::GetSubscriptionAttributesAsync(const GetSubscriptionAttributesRequest& request, const GetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -507,6 +627,16 @@ void SNSClient::GetSubscriptionAttributesAsync(const GetSubscriptionAttributesRe
   m_executor->Submit( [this, request, handler, context](){ this->GetSubscriptionAttributesAsyncHelper( request, handler, context ); } );
 }
 
+GetSubscriptionAttributesOutcomeCallable SNSClient::GetSubscriptionAttributesCallable(GetSubscriptionAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::GetSubscriptionAttributes, this, std::move(request)));
+}
+
+void SNSClient::GetSubscriptionAttributesAsync(GetSubscriptionAttributesRequest&& request, const GetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::GetSubscriptionAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::GetSubscriptionAttributesAsyncHelper(const GetSubscriptionAttributesRequest& request, const GetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetSubscriptionAttributes(request), context);
@@ -529,7 +659,7 @@ GetTopicAttributesOutcome SNSClient::GetTopicAttributes(const GetTopicAttributes
 
 GetTopicAttributesOutcomeCallable SNSClient::GetTopicAttributesCallable(const GetTopicAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetTopicAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetTopicAttributes( request ); } );
 }
 
 void SNSClient::GetTopicAttributesAsync(const GetTopicAttributesRequest& request, const GetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -537,6 +667,16 @@ void SNSClient::GetTopicAttributesAsync(const GetTopicAttributesRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->GetTopicAttributesAsyncHelper( request, handler, context ); } );
 }
 
+GetTopicAttributesOutcomeCallable SNSClient::GetTopicAttributesCallable(GetTopicAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::GetTopicAttributes, this, std::move(request)));
+}
+
+void SNSClient::GetTopicAttributesAsync(GetTopicAttributesRequest&& request, const GetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::GetTopicAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::GetTopicAttributesAsyncHelper(const GetTopicAttributesRequest& request, const GetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetTopicAttributes(request), context);
@@ -559,7 +699,7 @@ ListEndpointsByPlatformApplicationOutcome SNSClient::ListEndpointsByPlatformAppl
 
 ListEndpointsByPlatformApplicationOutcomeCallable SNSClient::ListEndpointsByPlatformApplicationCallable(const ListEndpointsByPlatformApplicationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListEndpointsByPlatformApplication( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListEndpointsByPlatformApplication( request ); } );
 }
 
 void SNSClient::ListEndpointsByPlatformApplicationAsync(const ListEndpointsByPlatformApplicationRequest& request, const ListEndpointsByPlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -567,6 +707,16 @@ void SNSClient::ListEndpointsByPlatformApplicationAsync(const ListEndpointsByPla
   m_executor->Submit( [this, request, handler, context](){ this->ListEndpointsByPlatformApplicationAsyncHelper( request, handler, context ); } );
 }
 
+ListEndpointsByPlatformApplicationOutcomeCallable SNSClient::ListEndpointsByPlatformApplicationCallable(ListEndpointsByPlatformApplicationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::ListEndpointsByPlatformApplication, this, std::move(request)));
+}
+
+void SNSClient::ListEndpointsByPlatformApplicationAsync(ListEndpointsByPlatformApplicationRequest&& request, const ListEndpointsByPlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::ListEndpointsByPlatformApplicationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::ListEndpointsByPlatformApplicationAsyncHelper(const ListEndpointsByPlatformApplicationRequest& request, const ListEndpointsByPlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListEndpointsByPlatformApplication(request), context);
@@ -589,7 +739,7 @@ ListPhoneNumbersOptedOutOutcome SNSClient::ListPhoneNumbersOptedOut(const ListPh
 
 ListPhoneNumbersOptedOutOutcomeCallable SNSClient::ListPhoneNumbersOptedOutCallable(const ListPhoneNumbersOptedOutRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListPhoneNumbersOptedOut( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListPhoneNumbersOptedOut( request ); } );
 }
 
 void SNSClient::ListPhoneNumbersOptedOutAsync(const ListPhoneNumbersOptedOutRequest& request, const ListPhoneNumbersOptedOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -597,6 +747,16 @@ void SNSClient::ListPhoneNumbersOptedOutAsync(const ListPhoneNumbersOptedOutRequ
   m_executor->Submit( [this, request, handler, context](){ this->ListPhoneNumbersOptedOutAsyncHelper( request, handler, context ); } );
 }
 
+ListPhoneNumbersOptedOutOutcomeCallable SNSClient::ListPhoneNumbersOptedOutCallable(ListPhoneNumbersOptedOutRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::ListPhoneNumbersOptedOut, this, std::move(request)));
+}
+
+void SNSClient::ListPhoneNumbersOptedOutAsync(ListPhoneNumbersOptedOutRequest&& request, const ListPhoneNumbersOptedOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::ListPhoneNumbersOptedOutAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::ListPhoneNumbersOptedOutAsyncHelper(const ListPhoneNumbersOptedOutRequest& request, const ListPhoneNumbersOptedOutResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListPhoneNumbersOptedOut(request), context);
@@ -619,7 +779,7 @@ ListPlatformApplicationsOutcome SNSClient::ListPlatformApplications(const ListPl
 
 ListPlatformApplicationsOutcomeCallable SNSClient::ListPlatformApplicationsCallable(const ListPlatformApplicationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListPlatformApplications( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListPlatformApplications( request ); } );
 }
 
 void SNSClient::ListPlatformApplicationsAsync(const ListPlatformApplicationsRequest& request, const ListPlatformApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -627,6 +787,16 @@ void SNSClient::ListPlatformApplicationsAsync(const ListPlatformApplicationsRequ
   m_executor->Submit( [this, request, handler, context](){ this->ListPlatformApplicationsAsyncHelper( request, handler, context ); } );
 }
 
+ListPlatformApplicationsOutcomeCallable SNSClient::ListPlatformApplicationsCallable(ListPlatformApplicationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::ListPlatformApplications, this, std::move(request)));
+}
+
+void SNSClient::ListPlatformApplicationsAsync(ListPlatformApplicationsRequest&& request, const ListPlatformApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::ListPlatformApplicationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::ListPlatformApplicationsAsyncHelper(const ListPlatformApplicationsRequest& request, const ListPlatformApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListPlatformApplications(request), context);
@@ -649,7 +819,7 @@ ListSubscriptionsOutcome SNSClient::ListSubscriptions(const ListSubscriptionsReq
 
 ListSubscriptionsOutcomeCallable SNSClient::ListSubscriptionsCallable(const ListSubscriptionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListSubscriptions( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListSubscriptions( request ); } );
 }
 
 void SNSClient::ListSubscriptionsAsync(const ListSubscriptionsRequest& request, const ListSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -657,6 +827,16 @@ void SNSClient::ListSubscriptionsAsync(const ListSubscriptionsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ListSubscriptionsAsyncHelper( request, handler, context ); } );
 }
 
+ListSubscriptionsOutcomeCallable SNSClient::ListSubscriptionsCallable(ListSubscriptionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::ListSubscriptions, this, std::move(request)));
+}
+
+void SNSClient::ListSubscriptionsAsync(ListSubscriptionsRequest&& request, const ListSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::ListSubscriptionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::ListSubscriptionsAsyncHelper(const ListSubscriptionsRequest& request, const ListSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListSubscriptions(request), context);
@@ -679,7 +859,7 @@ ListSubscriptionsByTopicOutcome SNSClient::ListSubscriptionsByTopic(const ListSu
 
 ListSubscriptionsByTopicOutcomeCallable SNSClient::ListSubscriptionsByTopicCallable(const ListSubscriptionsByTopicRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListSubscriptionsByTopic( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListSubscriptionsByTopic( request ); } );
 }
 
 void SNSClient::ListSubscriptionsByTopicAsync(const ListSubscriptionsByTopicRequest& request, const ListSubscriptionsByTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -687,6 +867,16 @@ void SNSClient::ListSubscriptionsByTopicAsync(const ListSubscriptionsByTopicRequ
   m_executor->Submit( [this, request, handler, context](){ this->ListSubscriptionsByTopicAsyncHelper( request, handler, context ); } );
 }
 
+ListSubscriptionsByTopicOutcomeCallable SNSClient::ListSubscriptionsByTopicCallable(ListSubscriptionsByTopicRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::ListSubscriptionsByTopic, this, std::move(request)));
+}
+
+void SNSClient::ListSubscriptionsByTopicAsync(ListSubscriptionsByTopicRequest&& request, const ListSubscriptionsByTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::ListSubscriptionsByTopicAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::ListSubscriptionsByTopicAsyncHelper(const ListSubscriptionsByTopicRequest& request, const ListSubscriptionsByTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListSubscriptionsByTopic(request), context);
@@ -709,7 +899,7 @@ ListTopicsOutcome SNSClient::ListTopics(const ListTopicsRequest& request) const
 
 ListTopicsOutcomeCallable SNSClient::ListTopicsCallable(const ListTopicsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTopics( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTopics( request ); } );
 }
 
 void SNSClient::ListTopicsAsync(const ListTopicsRequest& request, const ListTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -717,6 +907,16 @@ void SNSClient::ListTopicsAsync(const ListTopicsRequest& request, const ListTopi
   m_executor->Submit( [this, request, handler, context](){ this->ListTopicsAsyncHelper( request, handler, context ); } );
 }
 
+ListTopicsOutcomeCallable SNSClient::ListTopicsCallable(ListTopicsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::ListTopics, this, std::move(request)));
+}
+
+void SNSClient::ListTopicsAsync(ListTopicsRequest&& request, const ListTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::ListTopicsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::ListTopicsAsyncHelper(const ListTopicsRequest& request, const ListTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTopics(request), context);
@@ -739,7 +939,7 @@ OptInPhoneNumberOutcome SNSClient::OptInPhoneNumber(const OptInPhoneNumberReques
 
 OptInPhoneNumberOutcomeCallable SNSClient::OptInPhoneNumberCallable(const OptInPhoneNumberRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->OptInPhoneNumber( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->OptInPhoneNumber( request ); } );
 }
 
 void SNSClient::OptInPhoneNumberAsync(const OptInPhoneNumberRequest& request, const OptInPhoneNumberResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -747,6 +947,16 @@ void SNSClient::OptInPhoneNumberAsync(const OptInPhoneNumberRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->OptInPhoneNumberAsyncHelper( request, handler, context ); } );
 }
 
+OptInPhoneNumberOutcomeCallable SNSClient::OptInPhoneNumberCallable(OptInPhoneNumberRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::OptInPhoneNumber, this, std::move(request)));
+}
+
+void SNSClient::OptInPhoneNumberAsync(OptInPhoneNumberRequest&& request, const OptInPhoneNumberResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::OptInPhoneNumberAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::OptInPhoneNumberAsyncHelper(const OptInPhoneNumberRequest& request, const OptInPhoneNumberResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, OptInPhoneNumber(request), context);
@@ -769,7 +979,7 @@ PublishOutcome SNSClient::Publish(const PublishRequest& request) const
 
 PublishOutcomeCallable SNSClient::PublishCallable(const PublishRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->Publish( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->Publish( request ); } );
 }
 
 void SNSClient::PublishAsync(const PublishRequest& request, const PublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -777,6 +987,16 @@ void SNSClient::PublishAsync(const PublishRequest& request, const PublishRespons
   m_executor->Submit( [this, request, handler, context](){ this->PublishAsyncHelper( request, handler, context ); } );
 }
 
+PublishOutcomeCallable SNSClient::PublishCallable(PublishRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::Publish, this, std::move(request)));
+}
+
+void SNSClient::PublishAsync(PublishRequest&& request, const PublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::PublishAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::PublishAsyncHelper(const PublishRequest& request, const PublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, Publish(request), context);
@@ -799,7 +1019,7 @@ RemovePermissionOutcome SNSClient::RemovePermission(const RemovePermissionReques
 
 RemovePermissionOutcomeCallable SNSClient::RemovePermissionCallable(const RemovePermissionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemovePermission( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemovePermission( request ); } );
 }
 
 void SNSClient::RemovePermissionAsync(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -807,6 +1027,16 @@ void SNSClient::RemovePermissionAsync(const RemovePermissionRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->RemovePermissionAsyncHelper( request, handler, context ); } );
 }
 
+RemovePermissionOutcomeCallable SNSClient::RemovePermissionCallable(RemovePermissionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::RemovePermission, this, std::move(request)));
+}
+
+void SNSClient::RemovePermissionAsync(RemovePermissionRequest&& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::RemovePermissionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::RemovePermissionAsyncHelper(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemovePermission(request), context);
@@ -829,7 +1059,7 @@ SetEndpointAttributesOutcome SNSClient::SetEndpointAttributes(const SetEndpointA
 
 SetEndpointAttributesOutcomeCallable SNSClient::SetEndpointAttributesCallable(const SetEndpointAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetEndpointAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetEndpointAttributes( request ); } );
 }
 
 void SNSClient::SetEndpointAttributesAsync(const SetEndpointAttributesRequest& request, const SetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -837,6 +1067,16 @@ void SNSClient::SetEndpointAttributesAsync(const SetEndpointAttributesRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->SetEndpointAttributesAsyncHelper( request, handler, context ); } );
 }
 
+SetEndpointAttributesOutcomeCallable SNSClient::SetEndpointAttributesCallable(SetEndpointAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::SetEndpointAttributes, this, std::move(request)));
+}
+
+void SNSClient::SetEndpointAttributesAsync(SetEndpointAttributesRequest&& request, const SetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::SetEndpointAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::SetEndpointAttributesAsyncHelper(const SetEndpointAttributesRequest& request, const SetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetEndpointAttributes(request), context);
@@ -859,7 +1099,7 @@ SetPlatformApplicationAttributesOutcome SNSClient::SetPlatformApplicationAttribu
 
 SetPlatformApplicationAttributesOutcomeCallable SNSClient::SetPlatformApplicationAttributesCallable(const SetPlatformApplicationAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetPlatformApplicationAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetPlatformApplicationAttributes( request ); } );
 }
 
 void SNSClient::SetPlatformApplicationAttributesAsync(const SetPlatformApplicationAttributesRequest& request, const SetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -867,6 +1107,16 @@ void SNSClient::SetPlatformApplicationAttributesAsync(const SetPlatformApplicati
   m_executor->Submit( [this, request, handler, context](){ this->SetPlatformApplicationAttributesAsyncHelper( request, handler, context ); } );
 }
 
+SetPlatformApplicationAttributesOutcomeCallable SNSClient::SetPlatformApplicationAttributesCallable(SetPlatformApplicationAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::SetPlatformApplicationAttributes, this, std::move(request)));
+}
+
+void SNSClient::SetPlatformApplicationAttributesAsync(SetPlatformApplicationAttributesRequest&& request, const SetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::SetPlatformApplicationAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::SetPlatformApplicationAttributesAsyncHelper(const SetPlatformApplicationAttributesRequest& request, const SetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetPlatformApplicationAttributes(request), context);
@@ -889,7 +1139,7 @@ SetSMSAttributesOutcome SNSClient::SetSMSAttributes(const SetSMSAttributesReques
 
 SetSMSAttributesOutcomeCallable SNSClient::SetSMSAttributesCallable(const SetSMSAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetSMSAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetSMSAttributes( request ); } );
 }
 
 void SNSClient::SetSMSAttributesAsync(const SetSMSAttributesRequest& request, const SetSMSAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -897,6 +1147,16 @@ void SNSClient::SetSMSAttributesAsync(const SetSMSAttributesRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->SetSMSAttributesAsyncHelper( request, handler, context ); } );
 }
 
+SetSMSAttributesOutcomeCallable SNSClient::SetSMSAttributesCallable(SetSMSAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::SetSMSAttributes, this, std::move(request)));
+}
+
+void SNSClient::SetSMSAttributesAsync(SetSMSAttributesRequest&& request, const SetSMSAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::SetSMSAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::SetSMSAttributesAsyncHelper(const SetSMSAttributesRequest& request, const SetSMSAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetSMSAttributes(request), context);
@@ -919,7 +1179,7 @@ SetSubscriptionAttributesOutcome SNSClient::SetSubscriptionAttributes(const SetS
 
 SetSubscriptionAttributesOutcomeCallable SNSClient::SetSubscriptionAttributesCallable(const SetSubscriptionAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetSubscriptionAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetSubscriptionAttributes( request ); } );
 }
 
 void SNSClient::SetSubscriptionAttributesAsync(const SetSubscriptionAttributesRequest& request, const SetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -927,6 +1187,16 @@ void SNSClient::SetSubscriptionAttributesAsync(const SetSubscriptionAttributesRe
   m_executor->Submit( [this, request, handler, context](){ this->SetSubscriptionAttributesAsyncHelper( request, handler, context ); } );
 }
 
+SetSubscriptionAttributesOutcomeCallable SNSClient::SetSubscriptionAttributesCallable(SetSubscriptionAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::SetSubscriptionAttributes, this, std::move(request)));
+}
+
+void SNSClient::SetSubscriptionAttributesAsync(SetSubscriptionAttributesRequest&& request, const SetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::SetSubscriptionAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::SetSubscriptionAttributesAsyncHelper(const SetSubscriptionAttributesRequest& request, const SetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetSubscriptionAttributes(request), context);
@@ -949,7 +1219,7 @@ SetTopicAttributesOutcome SNSClient::SetTopicAttributes(const SetTopicAttributes
 
 SetTopicAttributesOutcomeCallable SNSClient::SetTopicAttributesCallable(const SetTopicAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetTopicAttributes( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetTopicAttributes( request ); } );
 }
 
 void SNSClient::SetTopicAttributesAsync(const SetTopicAttributesRequest& request, const SetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -957,6 +1227,16 @@ void SNSClient::SetTopicAttributesAsync(const SetTopicAttributesRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->SetTopicAttributesAsyncHelper( request, handler, context ); } );
 }
 
+SetTopicAttributesOutcomeCallable SNSClient::SetTopicAttributesCallable(SetTopicAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::SetTopicAttributes, this, std::move(request)));
+}
+
+void SNSClient::SetTopicAttributesAsync(SetTopicAttributesRequest&& request, const SetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::SetTopicAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::SetTopicAttributesAsyncHelper(const SetTopicAttributesRequest& request, const SetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetTopicAttributes(request), context);
@@ -979,7 +1259,7 @@ SubscribeOutcome SNSClient::Subscribe(const SubscribeRequest& request) const
 
 SubscribeOutcomeCallable SNSClient::SubscribeCallable(const SubscribeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->Subscribe( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->Subscribe( request ); } );
 }
 
 void SNSClient::SubscribeAsync(const SubscribeRequest& request, const SubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -987,6 +1267,16 @@ void SNSClient::SubscribeAsync(const SubscribeRequest& request, const SubscribeR
   m_executor->Submit( [this, request, handler, context](){ this->SubscribeAsyncHelper( request, handler, context ); } );
 }
 
+SubscribeOutcomeCallable SNSClient::SubscribeCallable(SubscribeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::Subscribe, this, std::move(request)));
+}
+
+void SNSClient::SubscribeAsync(SubscribeRequest&& request, const SubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::SubscribeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::SubscribeAsyncHelper(const SubscribeRequest& request, const SubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, Subscribe(request), context);
@@ -1009,7 +1299,7 @@ UnsubscribeOutcome SNSClient::Unsubscribe(const UnsubscribeRequest& request) con
 
 UnsubscribeOutcomeCallable SNSClient::UnsubscribeCallable(const UnsubscribeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->Unsubscribe( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->Unsubscribe( request ); } );
 }
 
 void SNSClient::UnsubscribeAsync(const UnsubscribeRequest& request, const UnsubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1017,8 +1307,272 @@ void SNSClient::UnsubscribeAsync(const UnsubscribeRequest& request, const Unsubs
   m_executor->Submit( [this, request, handler, context](){ this->UnsubscribeAsyncHelper( request, handler, context ); } );
 }
 
+UnsubscribeOutcomeCallable SNSClient::UnsubscribeCallable(UnsubscribeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SNSClient::Unsubscribe, this, std::move(request)));
+}
+
+void SNSClient::UnsubscribeAsync(UnsubscribeRequest&& request, const UnsubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SNSClient::UnsubscribeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SNSClient::UnsubscribeAsyncHelper(const UnsubscribeRequest& request, const UnsubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, Unsubscribe(request), context);
 }
 
+Paginator<SNSClient, ListEndpointsByPlatformApplicationRequest, ListEndpointsByPlatformApplicationOutcome> SNSClient::ListEndpointsByPlatformApplicationPaginator(const ListEndpointsByPlatformApplicationRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SNSClient, ListEndpointsByPlatformApplicationRequest, ListEndpointsByPlatformApplicationOutcome>(this, &SNSClient::ListEndpointsByPlatformApplication, request,
+    [](const ListEndpointsByPlatformApplicationRequest& current, const ListEndpointsByPlatformApplicationOutcome& outcome, ListEndpointsByPlatformApplicationRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SNSClient, ListPhoneNumbersOptedOutRequest, ListPhoneNumbersOptedOutOutcome> SNSClient::ListPhoneNumbersOptedOutPaginator(const ListPhoneNumbersOptedOutRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SNSClient, ListPhoneNumbersOptedOutRequest, ListPhoneNumbersOptedOutOutcome>(this, &SNSClient::ListPhoneNumbersOptedOut, request,
+    [](const ListPhoneNumbersOptedOutRequest& current, const ListPhoneNumbersOptedOutOutcome& outcome, ListPhoneNumbersOptedOutRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SNSClient, ListPlatformApplicationsRequest, ListPlatformApplicationsOutcome> SNSClient::ListPlatformApplicationsPaginator(const ListPlatformApplicationsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SNSClient, ListPlatformApplicationsRequest, ListPlatformApplicationsOutcome>(this, &SNSClient::ListPlatformApplications, request,
+    [](const ListPlatformApplicationsRequest& current, const ListPlatformApplicationsOutcome& outcome, ListPlatformApplicationsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SNSClient, ListSubscriptionsRequest, ListSubscriptionsOutcome> SNSClient::ListSubscriptionsPaginator(const ListSubscriptionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SNSClient, ListSubscriptionsRequest, ListSubscriptionsOutcome>(this, &SNSClient::ListSubscriptions, request,
+    [](const ListSubscriptionsRequest& current, const ListSubscriptionsOutcome& outcome, ListSubscriptionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SNSClient, ListSubscriptionsByTopicRequest, ListSubscriptionsByTopicOutcome> SNSClient::ListSubscriptionsByTopicPaginator(const ListSubscriptionsByTopicRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SNSClient, ListSubscriptionsByTopicRequest, ListSubscriptionsByTopicOutcome>(this, &SNSClient::ListSubscriptionsByTopic, request,
+    [](const ListSubscriptionsByTopicRequest& current, const ListSubscriptionsByTopicOutcome& outcome, ListSubscriptionsByTopicRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SNSClient, ListTopicsRequest, ListTopicsOutcome> SNSClient::ListTopicsPaginator(const ListTopicsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SNSClient, ListTopicsRequest, ListTopicsOutcome>(this, &SNSClient::ListTopics, request,
+    [](const ListTopicsRequest& current, const ListTopicsOutcome& outcome, ListTopicsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<SNSClient, AddPermissionRequest, AddPermissionOutcome> SNSClient::AddPermissionAwaitable(AddPermissionRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::AddPermission, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, CheckIfPhoneNumberIsOptedOutRequest, CheckIfPhoneNumberIsOptedOutOutcome> SNSClient::CheckIfPhoneNumberIsOptedOutAwaitable(CheckIfPhoneNumberIsOptedOutRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::CheckIfPhoneNumberIsOptedOut, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, ConfirmSubscriptionRequest, ConfirmSubscriptionOutcome> SNSClient::ConfirmSubscriptionAwaitable(ConfirmSubscriptionRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::ConfirmSubscription, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, CreatePlatformApplicationRequest, CreatePlatformApplicationOutcome> SNSClient::CreatePlatformApplicationAwaitable(CreatePlatformApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::CreatePlatformApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, CreatePlatformEndpointRequest, CreatePlatformEndpointOutcome> SNSClient::CreatePlatformEndpointAwaitable(CreatePlatformEndpointRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::CreatePlatformEndpoint, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, CreateTopicRequest, CreateTopicOutcome> SNSClient::CreateTopicAwaitable(CreateTopicRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::CreateTopic, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, DeleteEndpointRequest, DeleteEndpointOutcome> SNSClient::DeleteEndpointAwaitable(DeleteEndpointRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::DeleteEndpoint, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, DeletePlatformApplicationRequest, DeletePlatformApplicationOutcome> SNSClient::DeletePlatformApplicationAwaitable(DeletePlatformApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::DeletePlatformApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, DeleteTopicRequest, DeleteTopicOutcome> SNSClient::DeleteTopicAwaitable(DeleteTopicRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::DeleteTopic, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, GetEndpointAttributesRequest, GetEndpointAttributesOutcome> SNSClient::GetEndpointAttributesAwaitable(GetEndpointAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::GetEndpointAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, GetPlatformApplicationAttributesRequest, GetPlatformApplicationAttributesOutcome> SNSClient::GetPlatformApplicationAttributesAwaitable(GetPlatformApplicationAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::GetPlatformApplicationAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, GetSMSAttributesRequest, GetSMSAttributesOutcome> SNSClient::GetSMSAttributesAwaitable(GetSMSAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::GetSMSAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, GetSubscriptionAttributesRequest, GetSubscriptionAttributesOutcome> SNSClient::GetSubscriptionAttributesAwaitable(GetSubscriptionAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::GetSubscriptionAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, GetTopicAttributesRequest, GetTopicAttributesOutcome> SNSClient::GetTopicAttributesAwaitable(GetTopicAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::GetTopicAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, ListEndpointsByPlatformApplicationRequest, ListEndpointsByPlatformApplicationOutcome> SNSClient::ListEndpointsByPlatformApplicationAwaitable(ListEndpointsByPlatformApplicationRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::ListEndpointsByPlatformApplication, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, ListPhoneNumbersOptedOutRequest, ListPhoneNumbersOptedOutOutcome> SNSClient::ListPhoneNumbersOptedOutAwaitable(ListPhoneNumbersOptedOutRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::ListPhoneNumbersOptedOut, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, ListPlatformApplicationsRequest, ListPlatformApplicationsOutcome> SNSClient::ListPlatformApplicationsAwaitable(ListPlatformApplicationsRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::ListPlatformApplications, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, ListSubscriptionsRequest, ListSubscriptionsOutcome> SNSClient::ListSubscriptionsAwaitable(ListSubscriptionsRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::ListSubscriptions, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, ListSubscriptionsByTopicRequest, ListSubscriptionsByTopicOutcome> SNSClient::ListSubscriptionsByTopicAwaitable(ListSubscriptionsByTopicRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::ListSubscriptionsByTopic, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, ListTopicsRequest, ListTopicsOutcome> SNSClient::ListTopicsAwaitable(ListTopicsRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::ListTopics, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, OptInPhoneNumberRequest, OptInPhoneNumberOutcome> SNSClient::OptInPhoneNumberAwaitable(OptInPhoneNumberRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::OptInPhoneNumber, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, PublishRequest, PublishOutcome> SNSClient::PublishAwaitable(PublishRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::Publish, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, RemovePermissionRequest, RemovePermissionOutcome> SNSClient::RemovePermissionAwaitable(RemovePermissionRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::RemovePermission, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, SetEndpointAttributesRequest, SetEndpointAttributesOutcome> SNSClient::SetEndpointAttributesAwaitable(SetEndpointAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::SetEndpointAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, SetPlatformApplicationAttributesRequest, SetPlatformApplicationAttributesOutcome> SNSClient::SetPlatformApplicationAttributesAwaitable(SetPlatformApplicationAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::SetPlatformApplicationAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, SetSMSAttributesRequest, SetSMSAttributesOutcome> SNSClient::SetSMSAttributesAwaitable(SetSMSAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::SetSMSAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, SetSubscriptionAttributesRequest, SetSubscriptionAttributesOutcome> SNSClient::SetSubscriptionAttributesAwaitable(SetSubscriptionAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::SetSubscriptionAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, SetTopicAttributesRequest, SetTopicAttributesOutcome> SNSClient::SetTopicAttributesAwaitable(SetTopicAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::SetTopicAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, SubscribeRequest, SubscribeOutcome> SNSClient::SubscribeAwaitable(SubscribeRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::Subscribe, std::move(request) } };
+}
+
+ClientOperationAwaitable<SNSClient, UnsubscribeRequest, UnsubscribeOutcome> SNSClient::UnsubscribeAwaitable(UnsubscribeRequest request) const
+{
+  return { m_executor.get(), { this, &SNSClient::Unsubscribe, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -15,6 +15,7 @@
 #include <aws/sns/model/AddPermissionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ AddPermissionRequest::AddPermissionRequest() :
 
 Aws::String AddPermissionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AddPermission&";
   if(m_topicArnHasBeenSet)
   {
-    ss << "TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+    ss << "TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
   if(m_labelHasBeenSet)
   {
-    ss << "Label=" << StringUtils::URLEncode(m_label.c_str()) << "&";
+    ss << "Label=" << StringUtils::URLEncoded(m_label) << "&";
   }
 
   if(m_aWSAccountIdHasBeenSet)
@@ -47,7 +48,7 @@ Aws::String AddPermissionRequest::SerializePayload() const
     for(auto& item : m_aWSAccountId)
     {
       ss << "AWSAccountId.member." << aWSAccountIdCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       aWSAccountIdCount++;
     }
   }
@@ -58,12 +59,12 @@ Aws::String AddPermissionRequest::SerializePayload() const
     for(auto& item : m_actionName)
     {
       ss << "ActionName.member." << actionNameCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       actionNameCount++;
     }
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
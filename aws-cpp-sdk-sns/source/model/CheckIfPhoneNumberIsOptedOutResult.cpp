@@ -42,7 +42,7 @@ CheckIfPhoneNumberIsOptedOutResult& CheckIfPhoneNumberIsOptedOutResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CheckIfPhoneNumberIsOptedOutResult")
+  if (rootNode.GetNameView() != "CheckIfPhoneNumberIsOptedOutResult")
   {
     resultNode = rootNode.FirstChild("CheckIfPhoneNumberIsOptedOutResult");
   }
@@ -52,7 +52,7 @@ CheckIfPhoneNumberIsOptedOutResult& CheckIfPhoneNumberIsOptedOutResult::operator
     XmlNode isOptedOutNode = resultNode.FirstChild("isOptedOut");
     if(!isOptedOutNode.IsNull())
     {
-      m_isOptedOut = StringUtils::ConvertToBool(StringUtils::Trim(isOptedOutNode.GetText().c_str()).c_str());
+      m_isOptedOut = StringUtils::ConvertToBool(isOptedOutNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/sns/model/ConfirmSubscriptionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ ConfirmSubscriptionRequest::ConfirmSubscriptionRequest() :
 
 Aws::String ConfirmSubscriptionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ConfirmSubscription&";
   if(m_topicArnHasBeenSet)
   {
-    ss << "TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+    ss << "TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
   if(m_tokenHasBeenSet)
   {
-    ss << "Token=" << StringUtils::URLEncode(m_token.c_str()) << "&";
+    ss << "Token=" << StringUtils::URLEncoded(m_token) << "&";
   }
 
   if(m_authenticateOnUnsubscribeHasBeenSet)
   {
-    ss << "AuthenticateOnUnsubscribe=" << StringUtils::URLEncode(m_authenticateOnUnsubscribe.c_str()) << "&";
+    ss << "AuthenticateOnUnsubscribe=" << StringUtils::URLEncoded(m_authenticateOnUnsubscribe) << "&";
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ConfirmSubscriptionResult& ConfirmSubscriptionResult::operator =(const AmazonWeb
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ConfirmSubscriptionResult")
+  if (rootNode.GetNameView() != "ConfirmSubscriptionResult")
   {
     resultNode = rootNode.FirstChild("ConfirmSubscriptionResult");
   }
@@ -50,7 +50,7 @@ ConfirmSubscriptionResult& ConfirmSubscriptionResult::operator =(const AmazonWeb
     XmlNode subscriptionArnNode = resultNode.FirstChild("SubscriptionArn");
     if(!subscriptionArnNode.IsNull())
     {
-      m_subscriptionArn = StringUtils::Trim(subscriptionArnNode.GetText().c_str());
+      m_subscriptionArn = subscriptionArnNode.GetTextView().Trim().ToString();
     }
   }
 
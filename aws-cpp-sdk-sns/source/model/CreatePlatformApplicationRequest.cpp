@@ -15,6 +15,7 @@
 #include <aws/sns/model/CreatePlatformApplicationRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -28,16 +29,16 @@ CreatePlatformApplicationRequest::CreatePlatformApplicationRequest() :
 
 Aws::String CreatePlatformApplicationRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreatePlatformApplication&";
   if(m_nameHasBeenSet)
   {
-    ss << "Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+    ss << "Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_platformHasBeenSet)
   {
-    ss << "Platform=" << StringUtils::URLEncode(m_platform.c_str()) << "&";
+    ss << "Platform=" << StringUtils::URLEncoded(m_platform) << "&";
   }
 
   if(m_attributesHasBeenSet)
@@ -46,14 +47,14 @@ Aws::String CreatePlatformApplicationRequest::SerializePayload() const
     for(auto& item : m_attributes)
     {
       ss << "Attributes.entry." << attributesCount << ".key="
-          << StringUtils::URLEncode(item.first.c_str()) << "&";
+          << StringUtils::URLEncoded(item.first) << "&";
       ss << "Attributes.entry." << attributesCount << ".value="
-          << StringUtils::URLEncode(item.second.c_str()) << "&";
+          << StringUtils::URLEncoded(item.second) << "&";
       attributesCount++;
     }
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreatePlatformApplicationResult& CreatePlatformApplicationResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreatePlatformApplicationResult")
+  if (rootNode.GetNameView() != "CreatePlatformApplicationResult")
   {
     resultNode = rootNode.FirstChild("CreatePlatformApplicationResult");
   }
@@ -50,7 +50,7 @@ CreatePlatformApplicationResult& CreatePlatformApplicationResult::operator =(con
     XmlNode platformApplicationArnNode = resultNode.FirstChild("PlatformApplicationArn");
     if(!platformApplicationArnNode.IsNull())
     {
-      m_platformApplicationArn = StringUtils::Trim(platformApplicationArnNode.GetText().c_str());
+      m_platformApplicationArn = platformApplicationArnNode.GetTextView().Trim().ToString();
     }
   }
 
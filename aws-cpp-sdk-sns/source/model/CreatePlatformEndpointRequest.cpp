@@ -15,6 +15,7 @@
 #include <aws/sns/model/CreatePlatformEndpointRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -29,21 +30,21 @@ CreatePlatformEndpointRequest::CreatePlatformEndpointRequest() :
 
 Aws::String CreatePlatformEndpointRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreatePlatformEndpoint&";
   if(m_platformApplicationArnHasBeenSet)
   {
-    ss << "PlatformApplicationArn=" << StringUtils::URLEncode(m_platformApplicationArn.c_str()) << "&";
+    ss << "PlatformApplicationArn=" << StringUtils::URLEncoded(m_platformApplicationArn) << "&";
   }
 
   if(m_tokenHasBeenSet)
   {
-    ss << "Token=" << StringUtils::URLEncode(m_token.c_str()) << "&";
+    ss << "Token=" << StringUtils::URLEncoded(m_token) << "&";
   }
 
   if(m_customUserDataHasBeenSet)
   {
-    ss << "CustomUserData=" << StringUtils::URLEncode(m_customUserData.c_str()) << "&";
+    ss << "CustomUserData=" << StringUtils::URLEncoded(m_customUserData) << "&";
   }
 
   if(m_attributesHasBeenSet)
@@ -52,14 +53,14 @@ Aws::String CreatePlatformEndpointRequest::SerializePayload() const
     for(auto& item : m_attributes)
     {
       ss << "Attributes.entry." << attributesCount << ".key="
-          << StringUtils::URLEncode(item.first.c_str()) << "&";
+          << StringUtils::URLEncoded(item.first) << "&";
       ss << "Attributes.entry." << attributesCount << ".value="
-          << StringUtils::URLEncode(item.second.c_str()) << "&";
+          << StringUtils::URLEncoded(item.second) << "&";
       attributesCount++;
     }
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
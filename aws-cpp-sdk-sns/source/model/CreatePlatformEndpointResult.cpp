@@ -40,7 +40,7 @@ CreatePlatformEndpointResult& CreatePlatformEndpointResult::operator =(const Ama
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreatePlatformEndpointResult")
+  if (rootNode.GetNameView() != "CreatePlatformEndpointResult")
   {
     resultNode = rootNode.FirstChild("CreatePlatformEndpointResult");
   }
@@ -50,7 +50,7 @@ CreatePlatformEndpointResult& CreatePlatformEndpointResult::operator =(const Ama
     XmlNode endpointArnNode = resultNode.FirstChild("EndpointArn");
     if(!endpointArnNode.IsNull())
     {
-      m_endpointArn = StringUtils::Trim(endpointArnNode.GetText().c_str());
+      m_endpointArn = endpointArnNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ CreateTopicResult& CreateTopicResult::operator =(const AmazonWebServiceResult<Xm
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateTopicResult")
+  if (rootNode.GetNameView() != "CreateTopicResult")
   {
     resultNode = rootNode.FirstChild("CreateTopicResult");
   }
@@ -50,7 +50,7 @@ CreateTopicResult& CreateTopicResult::operator =(const AmazonWebServiceResult<Xm
     XmlNode topicArnNode = resultNode.FirstChild("TopicArn");
     if(!topicArnNode.IsNull())
     {
-      m_topicArn = StringUtils::Trim(topicArnNode.GetText().c_str());
+      m_topicArn = topicArnNode.GetTextView().Trim().ToString();
     }
   }
 
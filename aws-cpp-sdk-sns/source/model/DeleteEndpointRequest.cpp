@@ -15,6 +15,7 @@
 #include <aws/sns/model/DeleteEndpointRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteEndpointRequest::DeleteEndpointRequest() :
 
 Aws::String DeleteEndpointRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteEndpoint&";
   if(m_endpointArnHasBeenSet)
   {
-    ss << "EndpointArn=" << StringUtils::URLEncode(m_endpointArn.c_str()) << "&";
+    ss << "EndpointArn=" << StringUtils::URLEncoded(m_endpointArn) << "&";
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/sns/model/DeleteTopicRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DeleteTopicRequest::DeleteTopicRequest() :
 
 Aws::String DeleteTopicRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteTopic&";
   if(m_topicArnHasBeenSet)
   {
-    ss << "TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+    ss << "TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/sns/model/GetPlatformApplicationAttributesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ GetPlatformApplicationAttributesRequest::GetPlatformApplicationAttributesRequest
 
 Aws::String GetPlatformApplicationAttributesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetPlatformApplicationAttributes&";
   if(m_platformApplicationArnHasBeenSet)
   {
-    ss << "PlatformApplicationArn=" << StringUtils::URLEncode(m_platformApplicationArn.c_str()) << "&";
+    ss << "PlatformApplicationArn=" << StringUtils::URLEncoded(m_platformApplicationArn) << "&";
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
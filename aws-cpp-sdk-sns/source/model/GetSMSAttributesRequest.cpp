@@ -15,6 +15,7 @@
 #include <aws/sns/model/GetSMSAttributesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -26,7 +27,7 @@ GetSMSAttributesRequest::GetSMSAttributesRequest() :
 
 Aws::String GetSMSAttributesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetSMSAttributes&";
   if(m_attributesHasBeenSet)
   {
@@ -34,12 +35,12 @@ Aws::String GetSMSAttributesRequest::SerializePayload() const
     for(auto& item : m_attributes)
     {
       ss << "attributes.member." << attributesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       attributesCount++;
     }
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
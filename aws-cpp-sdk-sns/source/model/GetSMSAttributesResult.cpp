@@ -40,7 +40,7 @@ GetSMSAttributesResult& GetSMSAttributesResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetSMSAttributesResult")
+  if (rootNode.GetNameView() != "GetSMSAttributesResult")
   {
     resultNode = rootNode.FirstChild("GetSMSAttributesResult");
   }
@@ -56,8 +56,8 @@ GetSMSAttributesResult& GetSMSAttributesResult::operator =(const AmazonWebServic
       {
         XmlNode keyNode = attributesEntry.FirstChild("key");
         XmlNode valueNode = attributesEntry.FirstChild("value");
-        m_attributes[StringUtils::Trim(keyNode.GetText().c_str())] =
-            StringUtils::Trim(valueNode.GetText().c_str());
+        m_attributes[keyNode.GetTextView().Trim().ToString()] =
+            valueNode.GetTextView().Trim().ToString();
         attributesEntry = attributesEntry.NextNode("entry");
       }
 
@@ -40,7 +40,7 @@ GetSubscriptionAttributesResult& GetSubscriptionAttributesResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetSubscriptionAttributesResult")
+  if (rootNode.GetNameView() != "GetSubscriptionAttributesResult")
   {
     resultNode = rootNode.FirstChild("GetSubscriptionAttributesResult");
   }
@@ -56,8 +56,8 @@ GetSubscriptionAttributesResult& GetSubscriptionAttributesResult::operator =(con
       {
         XmlNode keyNode = attributesEntry.FirstChild("key");
         XmlNode valueNode = attributesEntry.FirstChild("value");
-        m_attributes[StringUtils::Trim(keyNode.GetText().c_str())] =
-            StringUtils::Trim(valueNode.GetText().c_str());
+        m_attributes[keyNode.GetTextView().Trim().ToString()] =
+            valueNode.GetTextView().Trim().ToString();
         attributesEntry = attributesEntry.NextNode("entry");
       }
 
@@ -40,7 +40,7 @@ GetTopicAttributesResult& GetTopicAttributesResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetTopicAttributesResult")
+  if (rootNode.GetNameView() != "GetTopicAttributesResult")
   {
     resultNode = rootNode.FirstChild("GetTopicAttributesResult");
   }
@@ -56,8 +56,8 @@ GetTopicAttributesResult& GetTopicAttributesResult::operator =(const AmazonWebSe
       {
         XmlNode keyNode = attributesEntry.FirstChild("key");
         XmlNode valueNode = attributesEntry.FirstChild("value");
-        m_attributes[StringUtils::Trim(keyNode.GetText().c_str())] =
-            StringUtils::Trim(valueNode.GetText().c_str());
+        m_attributes[keyNode.GetTextView().Trim().ToString()] =
+            valueNode.GetTextView().Trim().ToString();
         attributesEntry = attributesEntry.NextNode("entry");
       }
 
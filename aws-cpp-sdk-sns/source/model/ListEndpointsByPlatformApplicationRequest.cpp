@@ -15,6 +15,7 @@
 #include <aws/sns/model/ListEndpointsByPlatformApplicationRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ ListEndpointsByPlatformApplicationRequest::ListEndpointsByPlatformApplicationReq
 
 Aws::String ListEndpointsByPlatformApplicationRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListEndpointsByPlatformApplication&";
   if(m_platformApplicationArnHasBeenSet)
   {
-    ss << "PlatformApplicationArn=" << StringUtils::URLEncode(m_platformApplicationArn.c_str()) << "&";
+    ss << "PlatformApplicationArn=" << StringUtils::URLEncoded(m_platformApplicationArn) << "&";
   }
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
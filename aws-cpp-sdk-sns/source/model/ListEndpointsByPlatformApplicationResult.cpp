@@ -40,7 +40,7 @@ ListEndpointsByPlatformApplicationResult& ListEndpointsByPlatformApplicationResu
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListEndpointsByPlatformApplicationResult")
+  if (rootNode.GetNameView() != "ListEndpointsByPlatformApplicationResult")
   {
     resultNode = rootNode.FirstChild("ListEndpointsByPlatformApplicationResult");
   }
@@ -53,7 +53,7 @@ ListEndpointsByPlatformApplicationResult& ListEndpointsByPlatformApplicationResu
       XmlNode endpointsMember = endpointsNode.FirstChild("member");
       while(!endpointsMember.IsNull())
       {
-        m_endpoints.push_back(StringUtils::Trim(endpointsMember.GetText().c_str()));
+        m_endpoints.push_back(endpointsMember.GetTextView().Trim().ToString());
         endpointsMember = endpointsMember.NextNode("member");
       }
 
@@ -61,7 +61,7 @@ ListEndpointsByPlatformApplicationResult& ListEndpointsByPlatformApplicationResu
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
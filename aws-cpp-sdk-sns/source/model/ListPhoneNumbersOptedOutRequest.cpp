@@ -15,6 +15,7 @@
 #include <aws/sns/model/ListPhoneNumbersOptedOutRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ ListPhoneNumbersOptedOutRequest::ListPhoneNumbersOptedOutRequest() :
 
 Aws::String ListPhoneNumbersOptedOutRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListPhoneNumbersOptedOut&";
   if(m_nextTokenHasBeenSet)
   {
-    ss << "nextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "nextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ListPhoneNumbersOptedOutResult& ListPhoneNumbersOptedOutResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListPhoneNumbersOptedOutResult")
+  if (rootNode.GetNameView() != "ListPhoneNumbersOptedOutResult")
   {
     resultNode = rootNode.FirstChild("ListPhoneNumbersOptedOutResult");
   }
@@ -53,7 +53,7 @@ ListPhoneNumbersOptedOutResult& ListPhoneNumbersOptedOutResult::operator =(const
       XmlNode phoneNumbersMember = phoneNumbersNode.FirstChild("member");
       while(!phoneNumbersMember.IsNull())
       {
-        m_phoneNumbers.push_back(StringUtils::Trim(phoneNumbersMember.GetText().c_str()));
+        m_phoneNumbers.push_back(phoneNumbersMember.GetTextView().Trim().ToString());
         phoneNumbersMember = phoneNumbersMember.NextNode("member");
       }
 
@@ -61,7 +61,7 @@ ListPhoneNumbersOptedOutResult& ListPhoneNumbersOptedOutResult::operator =(const
     XmlNode nextTokenNode = resultNode.FirstChild("nextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ ListPlatformApplicationsResult& ListPlatformApplicationsResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListPlatformApplicationsResult")
+  if (rootNode.GetNameView() != "ListPlatformApplicationsResult")
   {
     resultNode = rootNode.FirstChild("ListPlatformApplicationsResult");
   }
@@ -61,7 +61,7 @@ ListPlatformApplicationsResult& ListPlatformApplicationsResult::operator =(const
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
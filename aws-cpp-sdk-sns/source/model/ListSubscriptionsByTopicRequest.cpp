@@ -15,6 +15,7 @@
 #include <aws/sns/model/ListSubscriptionsByTopicRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ ListSubscriptionsByTopicRequest::ListSubscriptionsByTopicRequest() :
 
 Aws::String ListSubscriptionsByTopicRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListSubscriptionsByTopic&";
   if(m_topicArnHasBeenSet)
   {
-    ss << "TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+    ss << "TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
   if(m_nextTokenHasBeenSet)
   {
-    ss << "NextToken=" << StringUtils::URLEncode(m_nextToken.c_str()) << "&";
+    ss << "NextToken=" << StringUtils::URLEncoded(m_nextToken) << "&";
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ListSubscriptionsByTopicResult& ListSubscriptionsByTopicResult::operator =(const
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListSubscriptionsByTopicResult")
+  if (rootNode.GetNameView() != "ListSubscriptionsByTopicResult")
   {
     resultNode = rootNode.FirstChild("ListSubscriptionsByTopicResult");
   }
@@ -61,7 +61,7 @@ ListSubscriptionsByTopicResult& ListSubscriptionsByTopicResult::operator =(const
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ ListSubscriptionsResult& ListSubscriptionsResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListSubscriptionsResult")
+  if (rootNode.GetNameView() != "ListSubscriptionsResult")
   {
     resultNode = rootNode.FirstChild("ListSubscriptionsResult");
   }
@@ -61,7 +61,7 @@ ListSubscriptionsResult& ListSubscriptionsResult::operator =(const AmazonWebServ
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
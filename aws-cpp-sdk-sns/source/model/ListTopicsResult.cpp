@@ -40,7 +40,7 @@ ListTopicsResult& ListTopicsResult::operator =(const AmazonWebServiceResult<XmlD
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListTopicsResult")
+  if (rootNode.GetNameView() != "ListTopicsResult")
   {
     resultNode = rootNode.FirstChild("ListTopicsResult");
   }
@@ -61,7 +61,7 @@ ListTopicsResult& ListTopicsResult::operator =(const AmazonWebServiceResult<XmlD
     XmlNode nextTokenNode = resultNode.FirstChild("NextToken");
     if(!nextTokenNode.IsNull())
     {
-      m_nextToken = StringUtils::Trim(nextTokenNode.GetText().c_str());
+      m_nextToken = nextTokenNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -54,19 +54,19 @@ MessageAttributeValue& MessageAttributeValue::operator =(const XmlNode& xmlNode)
     XmlNode dataTypeNode = resultNode.FirstChild("DataType");
     if(!dataTypeNode.IsNull())
     {
-      m_dataType = StringUtils::Trim(dataTypeNode.GetText().c_str());
+      m_dataType = dataTypeNode.GetTextView().Trim().ToString();
       m_dataTypeHasBeenSet = true;
     }
     XmlNode stringValueNode = resultNode.FirstChild("StringValue");
     if(!stringValueNode.IsNull())
     {
-      m_stringValue = StringUtils::Trim(stringValueNode.GetText().c_str());
+      m_stringValue = stringValueNode.GetTextView().Trim().ToString();
       m_stringValueHasBeenSet = true;
     }
     XmlNode binaryValueNode = resultNode.FirstChild("BinaryValue");
     if(!binaryValueNode.IsNull())
     {
-      m_binaryValue = HashingUtils::Base64Decode(StringUtils::Trim(binaryValueNode.GetText().c_str()));
+      m_binaryValue = HashingUtils::Base64Decode(binaryValueNode.GetTextView().Trim().ToString());
       m_binaryValueHasBeenSet = true;
     }
   }
@@ -78,17 +78,17 @@ void MessageAttributeValue::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_dataTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DataType=" << StringUtils::URLEncode(m_dataType.c_str()) << "&";
+      oStream << location << index << locationValue << ".DataType=" << StringUtils::URLEncoded(m_dataType) << "&";
   }
 
   if(m_stringValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StringValue=" << StringUtils::URLEncode(m_stringValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".StringValue=" << StringUtils::URLEncoded(m_stringValue) << "&";
   }
 
   if(m_binaryValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".BinaryValue=" << StringUtils::URLEncode(HashingUtils::Base64Encode(m_binaryValue).c_str()) << "&";
+      oStream << location << index << locationValue << ".BinaryValue=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(m_binaryValue)) << "&";
   }
 
 }
@@ -97,15 +97,15 @@ void MessageAttributeValue::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_dataTypeHasBeenSet)
   {
-      oStream << location << ".DataType=" << StringUtils::URLEncode(m_dataType.c_str()) << "&";
+      oStream << location << ".DataType=" << StringUtils::URLEncoded(m_dataType) << "&";
   }
   if(m_stringValueHasBeenSet)
   {
-      oStream << location << ".StringValue=" << StringUtils::URLEncode(m_stringValue.c_str()) << "&";
+      oStream << location << ".StringValue=" << StringUtils::URLEncoded(m_stringValue) << "&";
   }
   if(m_binaryValueHasBeenSet)
   {
-      oStream << location << ".BinaryValue=" << StringUtils::URLEncode(HashingUtils::Base64Encode(m_binaryValue).c_str()) << "&";
+      oStream << location << ".BinaryValue=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(m_binaryValue)) << "&";
   }
 }
 
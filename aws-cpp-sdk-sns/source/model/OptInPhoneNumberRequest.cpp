@@ -15,6 +15,7 @@
 #include <aws/sns/model/OptInPhoneNumberRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ OptInPhoneNumberRequest::OptInPhoneNumberRequest() :
 
 Aws::String OptInPhoneNumberRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=OptInPhoneNumber&";
   if(m_phoneNumberHasBeenSet)
   {
-    ss << "phoneNumber=" << StringUtils::URLEncode(m_phoneNumber.c_str()) << "&";
+    ss << "phoneNumber=" << StringUtils::URLEncoded(m_phoneNumber) << "&";
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
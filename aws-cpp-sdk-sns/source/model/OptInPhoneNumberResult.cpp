@@ -40,7 +40,7 @@ OptInPhoneNumberResult& OptInPhoneNumberResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "OptInPhoneNumberResult")
+  if (rootNode.GetNameView() != "OptInPhoneNumberResult")
   {
     resultNode = rootNode.FirstChild("OptInPhoneNumberResult");
   }
@@ -51,7 +51,7 @@ PlatformApplication& PlatformApplication::operator =(const XmlNode& xmlNode)
     XmlNode platformApplicationArnNode = resultNode.FirstChild("PlatformApplicationArn");
     if(!platformApplicationArnNode.IsNull())
     {
-      m_platformApplicationArn = StringUtils::Trim(platformApplicationArnNode.GetText().c_str());
+      m_platformApplicationArn = platformApplicationArnNode.GetTextView().Trim().ToString();
       m_platformApplicationArnHasBeenSet = true;
     }
     XmlNode attributesNode = resultNode.FirstChild("Attributes");
@@ -63,8 +63,8 @@ PlatformApplication& PlatformApplication::operator =(const XmlNode& xmlNode)
       {
         XmlNode keyNode = attributesEntry.FirstChild("key");
         XmlNode valueNode = attributesEntry.FirstChild("value");
-        m_attributes[StringUtils::Trim(keyNode.GetText().c_str())] =
-            StringUtils::Trim(valueNode.GetText().c_str());
+        m_attributes[keyNode.GetTextView().Trim().ToString()] =
+            valueNode.GetTextView().Trim().ToString();
         attributesEntry = attributesEntry.NextNode("entry");
       }
 
@@ -79,7 +79,7 @@ void PlatformApplication::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_platformApplicationArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".PlatformApplicationArn=" << StringUtils::URLEncode(m_platformApplicationArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".PlatformApplicationArn=" << StringUtils::URLEncoded(m_platformApplicationArn) << "&";
   }
 
   if(m_attributesHasBeenSet)
@@ -88,9 +88,9 @@ void PlatformApplication::OutputToStream(Aws::OStream& oStream, const char* loca
       for(auto& item : m_attributes)
       {
         oStream << location << index << locationValue << ".Attributes.entry." << attributesIdx << ".key="
-            << StringUtils::URLEncode(item.first.c_str()) << "&";
+            << StringUtils::URLEncoded(item.first) << "&";
         oStream << location << index << locationValue << ".Attributes.entry." << attributesIdx << ".value="
-            << StringUtils::URLEncode(item.second.c_str()) << "&";
+            << StringUtils::URLEncoded(item.second) << "&";
         attributesIdx++;
       }
   }
@@ -101,7 +101,7 @@ void PlatformApplication::OutputToStream(Aws::OStream& oStream, const char* loca
 {
   if(m_platformApplicationArnHasBeenSet)
   {
-      oStream << location << ".PlatformApplicationArn=" << StringUtils::URLEncode(m_platformApplicationArn.c_str()) << "&";
+      oStream << location << ".PlatformApplicationArn=" << StringUtils::URLEncoded(m_platformApplicationArn) << "&";
   }
   if(m_attributesHasBeenSet)
   {
@@ -109,9 +109,9 @@ void PlatformApplication::OutputToStream(Aws::OStream& oStream, const char* loca
       for(auto& item : m_attributes)
       {
         oStream << location << ".Attributes.entry."  << attributesIdx << ".key="
-            << StringUtils::URLEncode(item.first.c_str()) << "&";
+            << StringUtils::URLEncoded(item.first) << "&";
         oStream << location <<  ".Attributes.entry." << attributesIdx << ".value="
-            << StringUtils::URLEncode(item.second.c_str()) << "&";
+            << StringUtils::URLEncoded(item.second) << "&";
         attributesIdx++;
       }
 
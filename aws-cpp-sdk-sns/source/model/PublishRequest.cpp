@@ -15,6 +15,7 @@
 #include <aws/sns/model/PublishRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -32,36 +33,36 @@ PublishRequest::PublishRequest() :
 
 Aws::String PublishRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=Publish&";
   if(m_topicArnHasBeenSet)
   {
-    ss << "TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+    ss << "TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
   if(m_targetArnHasBeenSet)
   {
-    ss << "TargetArn=" << StringUtils::URLEncode(m_targetArn.c_str()) << "&";
+    ss << "TargetArn=" << StringUtils::URLEncoded(m_targetArn) << "&";
   }
 
   if(m_phoneNumberHasBeenSet)
   {
-    ss << "PhoneNumber=" << StringUtils::URLEncode(m_phoneNumber.c_str()) << "&";
+    ss << "PhoneNumber=" << StringUtils::URLEncoded(m_phoneNumber) << "&";
   }
 
   if(m_messageHasBeenSet)
   {
-    ss << "Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+    ss << "Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 
   if(m_subjectHasBeenSet)
   {
-    ss << "Subject=" << StringUtils::URLEncode(m_subject.c_str()) << "&";
+    ss << "Subject=" << StringUtils::URLEncoded(m_subject) << "&";
   }
 
   if(m_messageStructureHasBeenSet)
   {
-    ss << "MessageStructure=" << StringUtils::URLEncode(m_messageStructure.c_str()) << "&";
+    ss << "MessageStructure=" << StringUtils::URLEncoded(m_messageStructure) << "&";
   }
 
   if(m_messageAttributesHasBeenSet)
@@ -70,13 +71,13 @@ Aws::String PublishRequest::SerializePayload() const
     for(auto& item : m_messageAttributes)
     {
       ss << "MessageAttributes.entry." << messageAttributesCount << ".Name="
-          << StringUtils::URLEncode(item.first.c_str()) << "&";
+          << StringUtils::URLEncoded(item.first) << "&";
       item.second.OutputToStream(ss, "MessageAttributes.entry.", messageAttributesCount, ".Value");
       messageAttributesCount++;
     }
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ PublishResult& PublishResult::operator =(const AmazonWebServiceResult<XmlDocumen
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "PublishResult")
+  if (rootNode.GetNameView() != "PublishResult")
   {
     resultNode = rootNode.FirstChild("PublishResult");
   }
@@ -50,7 +50,7 @@ PublishResult& PublishResult::operator =(const AmazonWebServiceResult<XmlDocumen
     XmlNode messageIdNode = resultNode.FirstChild("MessageId");
     if(!messageIdNode.IsNull())
     {
-      m_messageId = StringUtils::Trim(messageIdNode.GetText().c_str());
+      m_messageId = messageIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/sns/model/RemovePermissionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ RemovePermissionRequest::RemovePermissionRequest() :
 
 Aws::String RemovePermissionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=RemovePermission&";
   if(m_topicArnHasBeenSet)
   {
-    ss << "TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+    ss << "TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
   if(m_labelHasBeenSet)
   {
-    ss << "Label=" << StringUtils::URLEncode(m_label.c_str()) << "&";
+    ss << "Label=" << StringUtils::URLEncoded(m_label) << "&";
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/sns/model/SetEndpointAttributesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ SetEndpointAttributesRequest::SetEndpointAttributesRequest() :
 
 Aws::String SetEndpointAttributesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SetEndpointAttributes&";
   if(m_endpointArnHasBeenSet)
   {
-    ss << "EndpointArn=" << StringUtils::URLEncode(m_endpointArn.c_str()) << "&";
+    ss << "EndpointArn=" << StringUtils::URLEncoded(m_endpointArn) << "&";
   }
 
   if(m_attributesHasBeenSet)
@@ -40,14 +41,14 @@ Aws::String SetEndpointAttributesRequest::SerializePayload() const
     for(auto& item : m_attributes)
     {
       ss << "Attributes.entry." << attributesCount << ".key="
-          << StringUtils::URLEncode(item.first.c_str()) << "&";
+          << StringUtils::URLEncoded(item.first) << "&";
       ss << "Attributes.entry." << attributesCount << ".value="
-          << StringUtils::URLEncode(item.second.c_str()) << "&";
+          << StringUtils::URLEncoded(item.second) << "&";
       attributesCount++;
     }
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/sns/model/SetSMSAttributesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -26,7 +27,7 @@ SetSMSAttributesRequest::SetSMSAttributesRequest() :
 
 Aws::String SetSMSAttributesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SetSMSAttributes&";
   if(m_attributesHasBeenSet)
   {
@@ -34,14 +35,14 @@ Aws::String SetSMSAttributesRequest::SerializePayload() const
     for(auto& item : m_attributes)
     {
       ss << "attributes.entry." << attributesCount << ".key="
-          << StringUtils::URLEncode(item.first.c_str()) << "&";
+          << StringUtils::URLEncoded(item.first) << "&";
       ss << "attributes.entry." << attributesCount << ".value="
-          << StringUtils::URLEncode(item.second.c_str()) << "&";
+          << StringUtils::URLEncoded(item.second) << "&";
       attributesCount++;
     }
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ SetSMSAttributesResult& SetSMSAttributesResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SetSMSAttributesResult")
+  if (rootNode.GetNameView() != "SetSMSAttributesResult")
   {
     resultNode = rootNode.FirstChild("SetSMSAttributesResult");
   }
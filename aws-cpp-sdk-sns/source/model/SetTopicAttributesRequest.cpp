@@ -15,6 +15,7 @@
 #include <aws/sns/model/SetTopicAttributesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ SetTopicAttributesRequest::SetTopicAttributesRequest() :
 
 Aws::String SetTopicAttributesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SetTopicAttributes&";
   if(m_topicArnHasBeenSet)
   {
-    ss << "TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+    ss << "TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
   if(m_attributeNameHasBeenSet)
   {
-    ss << "AttributeName=" << StringUtils::URLEncode(m_attributeName.c_str()) << "&";
+    ss << "AttributeName=" << StringUtils::URLEncoded(m_attributeName) << "&";
   }
 
   if(m_attributeValueHasBeenSet)
   {
-    ss << "AttributeValue=" << StringUtils::URLEncode(m_attributeValue.c_str()) << "&";
+    ss << "AttributeValue=" << StringUtils::URLEncoded(m_attributeValue) << "&";
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
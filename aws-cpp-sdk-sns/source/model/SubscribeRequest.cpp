@@ -15,6 +15,7 @@
 #include <aws/sns/model/SubscribeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -28,24 +29,24 @@ SubscribeRequest::SubscribeRequest() :
 
 Aws::String SubscribeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=Subscribe&";
   if(m_topicArnHasBeenSet)
   {
-    ss << "TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+    ss << "TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
   if(m_protocolHasBeenSet)
   {
-    ss << "Protocol=" << StringUtils::URLEncode(m_protocol.c_str()) << "&";
+    ss << "Protocol=" << StringUtils::URLEncoded(m_protocol) << "&";
   }
 
   if(m_endpointHasBeenSet)
   {
-    ss << "Endpoint=" << StringUtils::URLEncode(m_endpoint.c_str()) << "&";
+    ss << "Endpoint=" << StringUtils::URLEncoded(m_endpoint) << "&";
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
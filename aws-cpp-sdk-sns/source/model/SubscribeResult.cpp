@@ -40,7 +40,7 @@ SubscribeResult& SubscribeResult::operator =(const AmazonWebServiceResult<XmlDoc
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SubscribeResult")
+  if (rootNode.GetNameView() != "SubscribeResult")
   {
     resultNode = rootNode.FirstChild("SubscribeResult");
   }
@@ -50,7 +50,7 @@ SubscribeResult& SubscribeResult::operator =(const AmazonWebServiceResult<XmlDoc
     XmlNode subscriptionArnNode = resultNode.FirstChild("SubscriptionArn");
     if(!subscriptionArnNode.IsNull())
     {
-      m_subscriptionArn = StringUtils::Trim(subscriptionArnNode.GetText().c_str());
+      m_subscriptionArn = subscriptionArnNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -57,31 +57,31 @@ Subscription& Subscription::operator =(const XmlNode& xmlNode)
     XmlNode subscriptionArnNode = resultNode.FirstChild("SubscriptionArn");
     if(!subscriptionArnNode.IsNull())
     {
-      m_subscriptionArn = StringUtils::Trim(subscriptionArnNode.GetText().c_str());
+      m_subscriptionArn = subscriptionArnNode.GetTextView().Trim().ToString();
       m_subscriptionArnHasBeenSet = true;
     }
     XmlNode ownerNode = resultNode.FirstChild("Owner");
     if(!ownerNode.IsNull())
     {
-      m_owner = StringUtils::Trim(ownerNode.GetText().c_str());
+      m_owner = ownerNode.GetTextView().Trim().ToString();
       m_ownerHasBeenSet = true;
     }
     XmlNode protocolNode = resultNode.FirstChild("Protocol");
     if(!protocolNode.IsNull())
     {
-      m_protocol = StringUtils::Trim(protocolNode.GetText().c_str());
+      m_protocol = protocolNode.GetTextView().Trim().ToString();
       m_protocolHasBeenSet = true;
     }
     XmlNode endpointNode = resultNode.FirstChild("Endpoint");
     if(!endpointNode.IsNull())
     {
-      m_endpoint = StringUtils::Trim(endpointNode.GetText().c_str());
+      m_endpoint = endpointNode.GetTextView().Trim().ToString();
       m_endpointHasBeenSet = true;
     }
     XmlNode topicArnNode = resultNode.FirstChild("TopicArn");
     if(!topicArnNode.IsNull())
     {
-      m_topicArn = StringUtils::Trim(topicArnNode.GetText().c_str());
+      m_topicArn = topicArnNode.GetTextView().Trim().ToString();
       m_topicArnHasBeenSet = true;
     }
   }
@@ -93,27 +93,27 @@ void Subscription::OutputToStream(Aws::OStream& oStream, const char* location, u
 {
   if(m_subscriptionArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SubscriptionArn=" << StringUtils::URLEncode(m_subscriptionArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".SubscriptionArn=" << StringUtils::URLEncoded(m_subscriptionArn) << "&";
   }
 
   if(m_ownerHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Owner=" << StringUtils::URLEncode(m_owner.c_str()) << "&";
+      oStream << location << index << locationValue << ".Owner=" << StringUtils::URLEncoded(m_owner) << "&";
   }
 
   if(m_protocolHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Protocol=" << StringUtils::URLEncode(m_protocol.c_str()) << "&";
+      oStream << location << index << locationValue << ".Protocol=" << StringUtils::URLEncoded(m_protocol) << "&";
   }
 
   if(m_endpointHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Endpoint=" << StringUtils::URLEncode(m_endpoint.c_str()) << "&";
+      oStream << location << index << locationValue << ".Endpoint=" << StringUtils::URLEncoded(m_endpoint) << "&";
   }
 
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << index << locationValue << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 
 }
@@ -122,23 +122,23 @@ void Subscription::OutputToStream(Aws::OStream& oStream, const char* location) c
 {
   if(m_subscriptionArnHasBeenSet)
   {
-      oStream << location << ".SubscriptionArn=" << StringUtils::URLEncode(m_subscriptionArn.c_str()) << "&";
+      oStream << location << ".SubscriptionArn=" << StringUtils::URLEncoded(m_subscriptionArn) << "&";
   }
   if(m_ownerHasBeenSet)
   {
-      oStream << location << ".Owner=" << StringUtils::URLEncode(m_owner.c_str()) << "&";
+      oStream << location << ".Owner=" << StringUtils::URLEncoded(m_owner) << "&";
   }
   if(m_protocolHasBeenSet)
   {
-      oStream << location << ".Protocol=" << StringUtils::URLEncode(m_protocol.c_str()) << "&";
+      oStream << location << ".Protocol=" << StringUtils::URLEncoded(m_protocol) << "&";
   }
   if(m_endpointHasBeenSet)
   {
-      oStream << location << ".Endpoint=" << StringUtils::URLEncode(m_endpoint.c_str()) << "&";
+      oStream << location << ".Endpoint=" << StringUtils::URLEncoded(m_endpoint) << "&";
   }
   if(m_topicArnHasBeenSet)
   {
-      oStream << location << ".TopicArn=" << StringUtils::URLEncode(m_topicArn.c_str()) << "&";
+      oStream << location << ".TopicArn=" << StringUtils::URLEncoded(m_topicArn) << "&";
   }
 }
 
@@ -15,6 +15,7 @@
 #include <aws/sns/model/UnsubscribeRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SNS::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ UnsubscribeRequest::UnsubscribeRequest() :
 
 Aws::String UnsubscribeRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=Unsubscribe&";
   if(m_subscriptionArnHasBeenSet)
   {
-    ss << "SubscriptionArn=" << StringUtils::URLEncode(m_subscriptionArn.c_str()) << "&";
+    ss << "SubscriptionArn=" << StringUtils::URLEncoded(m_subscriptionArn) << "&";
   }
 
   ss << "Version=2010-03-31";
-  return ss.str();
+  return ss.TakeString();
 }
 
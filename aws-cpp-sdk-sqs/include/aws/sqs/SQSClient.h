@@ -32,6 +32,9 @@
 #include <aws/sqs/model/SendMessageBatchResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -93,6 +96,9 @@ namespace Model
         class SendMessageRequest;
         class SendMessageBatchRequest;
         class SetQueueAttributesRequest;
+        class ChangeMessageVisibilityBatchRequestEntry;
+        class DeleteMessageBatchRequestEntry;
+        class SendMessageBatchRequestEntry;
 
         typedef Aws::Utils::Outcome<NoResult, Aws::Client::AWSError<SQSErrors>> AddPermissionOutcome;
         typedef Aws::Utils::Outcome<NoResult, Aws::Client::AWSError<SQSErrors>> ChangeMessageVisibilityOutcome;
@@ -274,6 +280,18 @@ namespace Model
          */
         virtual void AddPermissionAsync(const Model::AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddPermissionCallable(const Model::AddPermissionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddPermissionOutcomeCallable AddPermissionCallable(Model::AddPermissionRequest&& request) const;
+
+        /**
+         * Same as AddPermissionAsync(const Model::AddPermissionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddPermissionAsync(Model::AddPermissionRequest&& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the visibility timeout of a specified message in a queue to a new
          * value. The maximum allowed timeout value you can set the value to is 12 hours.
@@ -380,6 +398,18 @@ namespace Model
          */
         virtual void ChangeMessageVisibilityAsync(const Model::ChangeMessageVisibilityRequest& request, const ChangeMessageVisibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ChangeMessageVisibilityCallable(const Model::ChangeMessageVisibilityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ChangeMessageVisibilityOutcomeCallable ChangeMessageVisibilityCallable(Model::ChangeMessageVisibilityRequest&& request) const;
+
+        /**
+         * Same as ChangeMessageVisibilityAsync(const Model::ChangeMessageVisibilityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ChangeMessageVisibilityAsync(Model::ChangeMessageVisibilityRequest&& request, const ChangeMessageVisibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the visibility timeout of multiple messages. This is a batch version
          * of <a>ChangeMessageVisibility</a>. The result of the action on each message is
@@ -435,6 +465,18 @@ namespace Model
          */
         virtual void ChangeMessageVisibilityBatchAsync(const Model::ChangeMessageVisibilityBatchRequest& request, const ChangeMessageVisibilityBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ChangeMessageVisibilityBatchCallable(const Model::ChangeMessageVisibilityBatchRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ChangeMessageVisibilityBatchOutcomeCallable ChangeMessageVisibilityBatchCallable(Model::ChangeMessageVisibilityBatchRequest&& request) const;
+
+        /**
+         * Same as ChangeMessageVisibilityBatchAsync(const Model::ChangeMessageVisibilityBatchRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ChangeMessageVisibilityBatchAsync(Model::ChangeMessageVisibilityBatchRequest&& request, const ChangeMessageVisibilityBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new queue, or returns the URL of an existing one. When you request
          * <code>CreateQueue</code>, you provide a name for the queue. To successfully
@@ -505,6 +547,18 @@ namespace Model
          */
         virtual void CreateQueueAsync(const Model::CreateQueueRequest& request, const CreateQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateQueueCallable(const Model::CreateQueueRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateQueueOutcomeCallable CreateQueueCallable(Model::CreateQueueRequest&& request) const;
+
+        /**
+         * Same as CreateQueueAsync(const Model::CreateQueueRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateQueueAsync(Model::CreateQueueRequest&& request, const CreateQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the specified message from the specified queue. You specify the
          * message by using the message's <code>receipt handle</code> and not the
@@ -575,6 +629,18 @@ namespace Model
          */
         virtual void DeleteMessageAsync(const Model::DeleteMessageRequest& request, const DeleteMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteMessageCallable(const Model::DeleteMessageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteMessageOutcomeCallable DeleteMessageCallable(Model::DeleteMessageRequest&& request) const;
+
+        /**
+         * Same as DeleteMessageAsync(const Model::DeleteMessageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteMessageAsync(Model::DeleteMessageRequest&& request, const DeleteMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes up to ten messages from the specified queue. This is a batch version
          * of <a>DeleteMessage</a>. The result of the delete action on each message is
@@ -624,6 +690,18 @@ namespace Model
          */
         virtual void DeleteMessageBatchAsync(const Model::DeleteMessageBatchRequest& request, const DeleteMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteMessageBatchCallable(const Model::DeleteMessageBatchRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteMessageBatchOutcomeCallable DeleteMessageBatchCallable(Model::DeleteMessageBatchRequest&& request) const;
+
+        /**
+         * Same as DeleteMessageBatchAsync(const Model::DeleteMessageBatchRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteMessageBatchAsync(Model::DeleteMessageBatchRequest&& request, const DeleteMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the queue specified by the <b>queue URL</b>, regardless of whether
          * the queue is empty. If the specified queue does not exist, Amazon SQS returns a
@@ -679,6 +757,18 @@ namespace Model
          */
         virtual void DeleteQueueAsync(const Model::DeleteQueueRequest& request, const DeleteQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteQueueCallable(const Model::DeleteQueueRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteQueueOutcomeCallable DeleteQueueCallable(Model::DeleteQueueRequest&& request) const;
+
+        /**
+         * Same as DeleteQueueAsync(const Model::DeleteQueueRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteQueueAsync(Model::DeleteQueueRequest&& request, const DeleteQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets attributes for the specified queue.</p> <note><p>Some API actions take
          * lists of parameters. These lists are specified using the <code>param.n</code>
@@ -713,6 +803,18 @@ namespace Model
          */
         virtual void GetQueueAttributesAsync(const Model::GetQueueAttributesRequest& request, const GetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetQueueAttributesCallable(const Model::GetQueueAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetQueueAttributesOutcomeCallable GetQueueAttributesCallable(Model::GetQueueAttributesRequest&& request) const;
+
+        /**
+         * Same as GetQueueAttributesAsync(const Model::GetQueueAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetQueueAttributesAsync(Model::GetQueueAttributesRequest&& request, const GetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns the URL of an existing queue. This action provides a simple way to
          * retrieve the URL of an Amazon SQS queue. </p> <p> To access a queue that belongs
@@ -753,6 +855,18 @@ namespace Model
          */
         virtual void GetQueueUrlAsync(const Model::GetQueueUrlRequest& request, const GetQueueUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetQueueUrlCallable(const Model::GetQueueUrlRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetQueueUrlOutcomeCallable GetQueueUrlCallable(Model::GetQueueUrlRequest&& request) const;
+
+        /**
+         * Same as GetQueueUrlAsync(const Model::GetQueueUrlRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetQueueUrlAsync(Model::GetQueueUrlRequest&& request, const GetQueueUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of your queues that have the RedrivePolicy queue attribute
          * configured with a dead letter queue.</p> <p>For more information about using
@@ -784,6 +898,18 @@ namespace Model
          */
         virtual void ListDeadLetterSourceQueuesAsync(const Model::ListDeadLetterSourceQueuesRequest& request, const ListDeadLetterSourceQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDeadLetterSourceQueuesCallable(const Model::ListDeadLetterSourceQueuesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDeadLetterSourceQueuesOutcomeCallable ListDeadLetterSourceQueuesCallable(Model::ListDeadLetterSourceQueuesRequest&& request) const;
+
+        /**
+         * Same as ListDeadLetterSourceQueuesAsync(const Model::ListDeadLetterSourceQueuesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDeadLetterSourceQueuesAsync(Model::ListDeadLetterSourceQueuesRequest&& request, const ListDeadLetterSourceQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of your queues. The maximum number of queues that can be
          * returned is 1000. If you specify a value for the optional
@@ -812,6 +938,18 @@ namespace Model
          */
         virtual void ListQueuesAsync(const Model::ListQueuesRequest& request, const ListQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListQueuesCallable(const Model::ListQueuesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListQueuesOutcomeCallable ListQueuesCallable(Model::ListQueuesRequest&& request) const;
+
+        /**
+         * Same as ListQueuesAsync(const Model::ListQueuesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListQueuesAsync(Model::ListQueuesRequest&& request, const ListQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the messages in a queue specified by the <b>queue URL</b>.</p>
          * <important><p>When you use the <code>PurgeQueue</code> API, the deleted messages
@@ -852,6 +990,18 @@ namespace Model
          */
         virtual void PurgeQueueAsync(const Model::PurgeQueueRequest& request, const PurgeQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PurgeQueueCallable(const Model::PurgeQueueRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PurgeQueueOutcomeCallable PurgeQueueCallable(Model::PurgeQueueRequest&& request) const;
+
+        /**
+         * Same as PurgeQueueAsync(const Model::PurgeQueueRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PurgeQueueAsync(Model::PurgeQueueRequest&& request, const PurgeQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Retrieves one or more messages, with a maximum limit of 10 messages, from
          * the specified queue. Long poll support is enabled by using the
@@ -964,6 +1114,18 @@ namespace Model
          */
         virtual void ReceiveMessageAsync(const Model::ReceiveMessageRequest& request, const ReceiveMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReceiveMessageCallable(const Model::ReceiveMessageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ReceiveMessageOutcomeCallable ReceiveMessageCallable(Model::ReceiveMessageRequest&& request) const;
+
+        /**
+         * Same as ReceiveMessageAsync(const Model::ReceiveMessageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ReceiveMessageAsync(Model::ReceiveMessageRequest&& request, const ReceiveMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Revokes any permissions in the queue policy that matches the specified
          * <code>Label</code> parameter. Only the owner of the queue can remove
@@ -989,6 +1151,18 @@ namespace Model
          */
         virtual void RemovePermissionAsync(const Model::RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemovePermissionCallable(const Model::RemovePermissionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemovePermissionOutcomeCallable RemovePermissionCallable(Model::RemovePermissionRequest&& request) const;
+
+        /**
+         * Same as RemovePermissionAsync(const Model::RemovePermissionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemovePermissionAsync(Model::RemovePermissionRequest&& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Delivers a message to the specified queue. With Amazon SQS, you now have the
          * ability to send large payload messages that are up to 256KB (262,144 bytes) in
@@ -1038,6 +1212,18 @@ namespace Model
          */
         virtual void SendMessageAsync(const Model::SendMessageRequest& request, const SendMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SendMessageCallable(const Model::SendMessageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SendMessageOutcomeCallable SendMessageCallable(Model::SendMessageRequest&& request) const;
+
+        /**
+         * Same as SendMessageAsync(const Model::SendMessageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SendMessageAsync(Model::SendMessageRequest&& request, const SendMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Delivers up to ten messages to the specified queue. This is a batch version
          * of <a>SendMessage</a>. The result of the send action on each message is reported
@@ -1117,6 +1303,18 @@ namespace Model
          */
         virtual void SendMessageBatchAsync(const Model::SendMessageBatchRequest& request, const SendMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SendMessageBatchCallable(const Model::SendMessageBatchRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SendMessageBatchOutcomeCallable SendMessageBatchCallable(Model::SendMessageBatchRequest&& request) const;
+
+        /**
+         * Same as SendMessageBatchAsync(const Model::SendMessageBatchRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SendMessageBatchAsync(Model::SendMessageBatchRequest&& request, const SendMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the value of one or more queue attributes. When you change a queue's
          * attributes, the change can take up to 60 seconds for most of the attributes to
@@ -1154,6 +1352,123 @@ namespace Model
          */
         virtual void SetQueueAttributesAsync(const Model::SetQueueAttributesRequest& request, const SetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetQueueAttributesCallable(const Model::SetQueueAttributesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetQueueAttributesOutcomeCallable SetQueueAttributesCallable(Model::SetQueueAttributesRequest&& request) const;
+
+        /**
+         * Same as SetQueueAttributesAsync(const Model::SetQueueAttributesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetQueueAttributesAsync(Model::SetQueueAttributesRequest&& request, const SetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Collects ChangeMessageVisibilityBatchRequestEntry entries and sends them with ChangeMessageVisibilityBatch() in calls of at most 10 entries, re-queueing the entries the service could not process. The client must outlive the accumulator.
+         * Entries are sent with their positions in the call as ids, since ids must be unique within a call; entries passed to the failed entry handler carry the ids they were added with.
+         */
+        std::shared_ptr<Aws::Client::BatchAccumulator<Model::ChangeMessageVisibilityBatchRequest, Model::ChangeMessageVisibilityBatchRequestEntry>> ChangeMessageVisibilityBatchAccumulator(const Model::ChangeMessageVisibilityBatchRequest& requestTemplate, const Aws::Client::BatchAccumulatorConfiguration& config = Aws::Client::BatchAccumulatorConfiguration()) const;
+
+        /**
+         * Collects DeleteMessageBatchRequestEntry entries and sends them with DeleteMessageBatch() in calls of at most 10 entries, re-queueing the entries the service could not process. The client must outlive the accumulator.
+         * Entries are sent with their positions in the call as ids, since ids must be unique within a call; entries passed to the failed entry handler carry the ids they were added with.
+         */
+        std::shared_ptr<Aws::Client::BatchAccumulator<Model::DeleteMessageBatchRequest, Model::DeleteMessageBatchRequestEntry>> DeleteMessageBatchAccumulator(const Model::DeleteMessageBatchRequest& requestTemplate, const Aws::Client::BatchAccumulatorConfiguration& config = Aws::Client::BatchAccumulatorConfiguration()) const;
+
+        /**
+         * Collects SendMessageBatchRequestEntry entries and sends them with SendMessageBatch() in calls of at most 10 entries and 262144 bytes, re-queueing the entries the service could not process. The client must outlive the accumulator.
+         * Entries are sent with their positions in the call as ids, since ids must be unique within a call; entries passed to the failed entry handler carry the ids they were added with.
+         */
+        std::shared_ptr<Aws::Client::BatchAccumulator<Model::SendMessageBatchRequest, Model::SendMessageBatchRequestEntry>> SendMessageBatchAccumulator(const Model::SendMessageBatchRequest& requestTemplate, const Aws::Client::BatchAccumulatorConfiguration& config = Aws::Client::BatchAccumulatorConfiguration()) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddPermission(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::AddPermissionRequest, Model::AddPermissionOutcome> AddPermissionAwaitable(Model::AddPermissionRequest request) const;
+
+        /**
+         * co_await-able form of ChangeMessageVisibility(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::ChangeMessageVisibilityRequest, Model::ChangeMessageVisibilityOutcome> ChangeMessageVisibilityAwaitable(Model::ChangeMessageVisibilityRequest request) const;
+
+        /**
+         * co_await-able form of ChangeMessageVisibilityBatch(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::ChangeMessageVisibilityBatchRequest, Model::ChangeMessageVisibilityBatchOutcome> ChangeMessageVisibilityBatchAwaitable(Model::ChangeMessageVisibilityBatchRequest request) const;
+
+        /**
+         * co_await-able form of CreateQueue(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::CreateQueueRequest, Model::CreateQueueOutcome> CreateQueueAwaitable(Model::CreateQueueRequest request) const;
+
+        /**
+         * co_await-able form of DeleteMessage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::DeleteMessageRequest, Model::DeleteMessageOutcome> DeleteMessageAwaitable(Model::DeleteMessageRequest request) const;
+
+        /**
+         * co_await-able form of DeleteMessageBatch(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::DeleteMessageBatchRequest, Model::DeleteMessageBatchOutcome> DeleteMessageBatchAwaitable(Model::DeleteMessageBatchRequest request) const;
+
+        /**
+         * co_await-able form of DeleteQueue(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::DeleteQueueRequest, Model::DeleteQueueOutcome> DeleteQueueAwaitable(Model::DeleteQueueRequest request) const;
+
+        /**
+         * co_await-able form of GetQueueAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::GetQueueAttributesRequest, Model::GetQueueAttributesOutcome> GetQueueAttributesAwaitable(Model::GetQueueAttributesRequest request) const;
+
+        /**
+         * co_await-able form of GetQueueUrl(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::GetQueueUrlRequest, Model::GetQueueUrlOutcome> GetQueueUrlAwaitable(Model::GetQueueUrlRequest request) const;
+
+        /**
+         * co_await-able form of ListDeadLetterSourceQueues(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::ListDeadLetterSourceQueuesRequest, Model::ListDeadLetterSourceQueuesOutcome> ListDeadLetterSourceQueuesAwaitable(Model::ListDeadLetterSourceQueuesRequest request) const;
+
+        /**
+         * co_await-able form of ListQueues(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::ListQueuesRequest, Model::ListQueuesOutcome> ListQueuesAwaitable(Model::ListQueuesRequest request) const;
+
+        /**
+         * co_await-able form of PurgeQueue(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::PurgeQueueRequest, Model::PurgeQueueOutcome> PurgeQueueAwaitable(Model::PurgeQueueRequest request) const;
+
+        /**
+         * co_await-able form of ReceiveMessage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::ReceiveMessageRequest, Model::ReceiveMessageOutcome> ReceiveMessageAwaitable(Model::ReceiveMessageRequest request) const;
+
+        /**
+         * co_await-able form of RemovePermission(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::RemovePermissionRequest, Model::RemovePermissionOutcome> RemovePermissionAwaitable(Model::RemovePermissionRequest request) const;
+
+        /**
+         * co_await-able form of SendMessage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::SendMessageRequest, Model::SendMessageOutcome> SendMessageAwaitable(Model::SendMessageRequest request) const;
+
+        /**
+         * co_await-able form of SendMessageBatch(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::SendMessageBatchRequest, Model::SendMessageBatchOutcome> SendMessageBatchAwaitable(Model::SendMessageBatchRequest request) const;
+
+        /**
+         * co_await-able form of SetQueueAttributes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SQSClient, Model::SetQueueAttributesRequest, Model::SetQueueAttributesOutcome> SetQueueAttributesAwaitable(Model::SetQueueAttributesRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AddPermissionRequest();
+    inline const char* GetServiceRequestName() const override { return "AddPermission"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ChangeMessageVisibilityBatchRequest();
+    inline const char* GetServiceRequestName() const override { return "ChangeMessageVisibilityBatch"; }
+
     Aws::String SerializePayload() const override;
 
     /**
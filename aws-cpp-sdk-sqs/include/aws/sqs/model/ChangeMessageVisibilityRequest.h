@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ChangeMessageVisibilityRequest();
+    inline const char* GetServiceRequestName() const override { return "ChangeMessageVisibility"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateQueueRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateQueue"; }
+
     Aws::String SerializePayload() const override;
 
     /**
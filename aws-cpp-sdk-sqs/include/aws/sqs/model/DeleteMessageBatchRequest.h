@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DeleteMessageBatchRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteMessageBatch"; }
+
     Aws::String SerializePayload() const override;
 
     /**
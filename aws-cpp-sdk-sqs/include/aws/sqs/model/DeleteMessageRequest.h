@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteMessageRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteMessage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteQueueRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteQueue"; }
+
     Aws::String SerializePayload() const override;
 
     /**
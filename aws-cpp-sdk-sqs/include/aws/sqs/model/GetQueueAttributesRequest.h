@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     GetQueueAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "GetQueueAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetQueueUrlRequest();
+    inline const char* GetServiceRequestName() const override { return "GetQueueUrl"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListDeadLetterSourceQueuesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListDeadLetterSourceQueues"; }
+
     Aws::String SerializePayload() const override;
 
     /**
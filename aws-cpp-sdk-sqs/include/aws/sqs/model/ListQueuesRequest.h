@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListQueuesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListQueues"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PurgeQueueRequest();
+    inline const char* GetServiceRequestName() const override { return "PurgeQueue"; }
+
     Aws::String SerializePayload() const override;
 
     /**
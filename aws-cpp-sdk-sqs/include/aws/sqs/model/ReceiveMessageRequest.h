@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ReceiveMessageRequest();
+    inline const char* GetServiceRequestName() const override { return "ReceiveMessage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RemovePermissionRequest();
+    inline const char* GetServiceRequestName() const override { return "RemovePermission"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     SendMessageBatchRequest();
+    inline const char* GetServiceRequestName() const override { return "SendMessageBatch"; }
+
     Aws::String SerializePayload() const override;
 
     /**
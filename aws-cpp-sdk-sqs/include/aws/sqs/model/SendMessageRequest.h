@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     SendMessageRequest();
+    inline const char* GetServiceRequestName() const override { return "SendMessage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     SetQueueAttributesRequest();
+    inline const char* GetServiceRequestName() const override { return "SetQueueAttributes"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -22,6 +22,7 @@
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/sqs/SQSClient.h>
 #include <aws/sqs/SQSEndpoint.h>
@@ -124,7 +125,7 @@ AddPermissionOutcome SQSClient::AddPermission(const AddPermissionRequest& reques
 
 AddPermissionOutcomeCallable SQSClient::AddPermissionCallable(const AddPermissionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddPermission(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->AddPermission(request); });
 }
 
 void SQSClient::AddPermissionAsync(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -132,6 +133,16 @@ void SQSClient::AddPermissionAsync(const AddPermissionRequest& request, const Ad
   m_executor->Submit( [this, request, handler, context](){ this->AddPermissionAsyncHelper(request, handler, context); } );
 }
 
+AddPermissionOutcomeCallable SQSClient::AddPermissionCallable(AddPermissionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::AddPermission, this, std::move(request)));
+}
+
+void SQSClient::AddPermissionAsync(AddPermissionRequest&& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::AddPermissionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::AddPermissionAsyncHelper(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddPermission(request), context);
@@ -152,7 +163,7 @@ ChangeMessageVisibilityOutcome SQSClient::ChangeMessageVisibility(const ChangeMe
 
 ChangeMessageVisibilityOutcomeCallable SQSClient::ChangeMessageVisibilityCallable(const ChangeMessageVisibilityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ChangeMessageVisibility(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->ChangeMessageVisibility(request); });
 }
 
 void SQSClient::ChangeMessageVisibilityAsync(const ChangeMessageVisibilityRequest& request, const ChangeMessageVisibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -160,6 +171,16 @@ void SQSClient::ChangeMessageVisibilityAsync(const ChangeMessageVisibilityReques
   m_executor->Submit( [this, request, handler, context](){ this->ChangeMessageVisibilityAsyncHelper(request, handler, context); } );
 }
 
+ChangeMessageVisibilityOutcomeCallable SQSClient::ChangeMessageVisibilityCallable(ChangeMessageVisibilityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::ChangeMessageVisibility, this, std::move(request)));
+}
+
+void SQSClient::ChangeMessageVisibilityAsync(ChangeMessageVisibilityRequest&& request, const ChangeMessageVisibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::ChangeMessageVisibilityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::ChangeMessageVisibilityAsyncHelper(const ChangeMessageVisibilityRequest& request, const ChangeMessageVisibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ChangeMessageVisibility(request), context);
@@ -180,7 +201,7 @@ ChangeMessageVisibilityBatchOutcome SQSClient::ChangeMessageVisibilityBatch(cons
 
 ChangeMessageVisibilityBatchOutcomeCallable SQSClient::ChangeMessageVisibilityBatchCallable(const ChangeMessageVisibilityBatchRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ChangeMessageVisibilityBatch(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->ChangeMessageVisibilityBatch(request); });
 }
 
 void SQSClient::ChangeMessageVisibilityBatchAsync(const ChangeMessageVisibilityBatchRequest& request, const ChangeMessageVisibilityBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -188,6 +209,16 @@ void SQSClient::ChangeMessageVisibilityBatchAsync(const ChangeMessageVisibilityB
   m_executor->Submit( [this, request, handler, context](){ this->ChangeMessageVisibilityBatchAsyncHelper(request, handler, context); } );
 }
 
+ChangeMessageVisibilityBatchOutcomeCallable SQSClient::ChangeMessageVisibilityBatchCallable(ChangeMessageVisibilityBatchRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::ChangeMessageVisibilityBatch, this, std::move(request)));
+}
+
+void SQSClient::ChangeMessageVisibilityBatchAsync(ChangeMessageVisibilityBatchRequest&& request, const ChangeMessageVisibilityBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::ChangeMessageVisibilityBatchAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::ChangeMessageVisibilityBatchAsyncHelper(const ChangeMessageVisibilityBatchRequest& request, const ChangeMessageVisibilityBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ChangeMessageVisibilityBatch(request), context);
@@ -212,7 +243,7 @@ CreateQueueOutcome SQSClient::CreateQueue(const CreateQueueRequest& request) con
 
 CreateQueueOutcomeCallable SQSClient::CreateQueueCallable(const CreateQueueRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateQueue(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->CreateQueue(request); });
 }
 
 void SQSClient::CreateQueueAsync(const CreateQueueRequest& request, const CreateQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -220,6 +251,16 @@ void SQSClient::CreateQueueAsync(const CreateQueueRequest& request, const Create
   m_executor->Submit( [this, request, handler, context](){ this->CreateQueueAsyncHelper(request, handler, context); } );
 }
 
+CreateQueueOutcomeCallable SQSClient::CreateQueueCallable(CreateQueueRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::CreateQueue, this, std::move(request)));
+}
+
+void SQSClient::CreateQueueAsync(CreateQueueRequest&& request, const CreateQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::CreateQueueAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::CreateQueueAsyncHelper(const CreateQueueRequest& request, const CreateQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateQueue(request), context);
@@ -240,7 +281,7 @@ DeleteMessageOutcome SQSClient::DeleteMessage(const DeleteMessageRequest& reques
 
 DeleteMessageOutcomeCallable SQSClient::DeleteMessageCallable(const DeleteMessageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteMessage(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteMessage(request); });
 }
 
 void SQSClient::DeleteMessageAsync(const DeleteMessageRequest& request, const DeleteMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -248,6 +289,16 @@ void SQSClient::DeleteMessageAsync(const DeleteMessageRequest& request, const De
   m_executor->Submit( [this, request, handler, context](){ this->DeleteMessageAsyncHelper(request, handler, context); } );
 }
 
+DeleteMessageOutcomeCallable SQSClient::DeleteMessageCallable(DeleteMessageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::DeleteMessage, this, std::move(request)));
+}
+
+void SQSClient::DeleteMessageAsync(DeleteMessageRequest&& request, const DeleteMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::DeleteMessageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::DeleteMessageAsyncHelper(const DeleteMessageRequest& request, const DeleteMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteMessage(request), context);
@@ -268,7 +319,7 @@ DeleteMessageBatchOutcome SQSClient::DeleteMessageBatch(const DeleteMessageBatch
 
 DeleteMessageBatchOutcomeCallable SQSClient::DeleteMessageBatchCallable(const DeleteMessageBatchRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteMessageBatch(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteMessageBatch(request); });
 }
 
 void SQSClient::DeleteMessageBatchAsync(const DeleteMessageBatchRequest& request, const DeleteMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -276,6 +327,16 @@ void SQSClient::DeleteMessageBatchAsync(const DeleteMessageBatchRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DeleteMessageBatchAsyncHelper(request, handler, context); } );
 }
 
+DeleteMessageBatchOutcomeCallable SQSClient::DeleteMessageBatchCallable(DeleteMessageBatchRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::DeleteMessageBatch, this, std::move(request)));
+}
+
+void SQSClient::DeleteMessageBatchAsync(DeleteMessageBatchRequest&& request, const DeleteMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::DeleteMessageBatchAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::DeleteMessageBatchAsyncHelper(const DeleteMessageBatchRequest& request, const DeleteMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteMessageBatch(request), context);
@@ -296,7 +357,7 @@ DeleteQueueOutcome SQSClient::DeleteQueue(const DeleteQueueRequest& request) con
 
 DeleteQueueOutcomeCallable SQSClient::DeleteQueueCallable(const DeleteQueueRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteQueue(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteQueue(request); });
 }
 
 void SQSClient::DeleteQueueAsync(const DeleteQueueRequest& request, const DeleteQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -304,6 +365,16 @@ void SQSClient::DeleteQueueAsync(const DeleteQueueRequest& request, const Delete
   m_executor->Submit( [this, request, handler, context](){ this->DeleteQueueAsyncHelper(request, handler, context); } );
 }
 
+DeleteQueueOutcomeCallable SQSClient::DeleteQueueCallable(DeleteQueueRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::DeleteQueue, this, std::move(request)));
+}
+
+void SQSClient::DeleteQueueAsync(DeleteQueueRequest&& request, const DeleteQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::DeleteQueueAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::DeleteQueueAsyncHelper(const DeleteQueueRequest& request, const DeleteQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteQueue(request), context);
@@ -324,7 +395,7 @@ GetQueueAttributesOutcome SQSClient::GetQueueAttributes(const GetQueueAttributes
 
 GetQueueAttributesOutcomeCallable SQSClient::GetQueueAttributesCallable(const GetQueueAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetQueueAttributes(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->GetQueueAttributes(request); });
 }
 
 void SQSClient::GetQueueAttributesAsync(const GetQueueAttributesRequest& request, const GetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -332,6 +403,16 @@ void SQSClient::GetQueueAttributesAsync(const GetQueueAttributesRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->GetQueueAttributesAsyncHelper(request, handler, context); } );
 }
 
+GetQueueAttributesOutcomeCallable SQSClient::GetQueueAttributesCallable(GetQueueAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::GetQueueAttributes, this, std::move(request)));
+}
+
+void SQSClient::GetQueueAttributesAsync(GetQueueAttributesRequest&& request, const GetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::GetQueueAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::GetQueueAttributesAsyncHelper(const GetQueueAttributesRequest& request, const GetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetQueueAttributes(request), context);
@@ -356,7 +437,7 @@ GetQueueUrlOutcome SQSClient::GetQueueUrl(const GetQueueUrlRequest& request) con
 
 GetQueueUrlOutcomeCallable SQSClient::GetQueueUrlCallable(const GetQueueUrlRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetQueueUrl(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->GetQueueUrl(request); });
 }
 
 void SQSClient::GetQueueUrlAsync(const GetQueueUrlRequest& request, const GetQueueUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -364,6 +445,16 @@ void SQSClient::GetQueueUrlAsync(const GetQueueUrlRequest& request, const GetQue
   m_executor->Submit( [this, request, handler, context](){ this->GetQueueUrlAsyncHelper(request, handler, context); } );
 }
 
+GetQueueUrlOutcomeCallable SQSClient::GetQueueUrlCallable(GetQueueUrlRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::GetQueueUrl, this, std::move(request)));
+}
+
+void SQSClient::GetQueueUrlAsync(GetQueueUrlRequest&& request, const GetQueueUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::GetQueueUrlAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::GetQueueUrlAsyncHelper(const GetQueueUrlRequest& request, const GetQueueUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetQueueUrl(request), context);
@@ -384,7 +475,7 @@ ListDeadLetterSourceQueuesOutcome SQSClient::ListDeadLetterSourceQueues(const Li
 
 ListDeadLetterSourceQueuesOutcomeCallable SQSClient::ListDeadLetterSourceQueuesCallable(const ListDeadLetterSourceQueuesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDeadLetterSourceQueues(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->ListDeadLetterSourceQueues(request); });
 }
 
 void SQSClient::ListDeadLetterSourceQueuesAsync(const ListDeadLetterSourceQueuesRequest& request, const ListDeadLetterSourceQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -392,6 +483,16 @@ void SQSClient::ListDeadLetterSourceQueuesAsync(const ListDeadLetterSourceQueues
   m_executor->Submit( [this, request, handler, context](){ this->ListDeadLetterSourceQueuesAsyncHelper(request, handler, context); } );
 }
 
+ListDeadLetterSourceQueuesOutcomeCallable SQSClient::ListDeadLetterSourceQueuesCallable(ListDeadLetterSourceQueuesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::ListDeadLetterSourceQueues, this, std::move(request)));
+}
+
+void SQSClient::ListDeadLetterSourceQueuesAsync(ListDeadLetterSourceQueuesRequest&& request, const ListDeadLetterSourceQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::ListDeadLetterSourceQueuesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::ListDeadLetterSourceQueuesAsyncHelper(const ListDeadLetterSourceQueuesRequest& request, const ListDeadLetterSourceQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDeadLetterSourceQueues(request), context);
@@ -416,7 +517,7 @@ ListQueuesOutcome SQSClient::ListQueues(const ListQueuesRequest& request) const
 
 ListQueuesOutcomeCallable SQSClient::ListQueuesCallable(const ListQueuesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListQueues(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->ListQueues(request); });
 }
 
 void SQSClient::ListQueuesAsync(const ListQueuesRequest& request, const ListQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -424,6 +525,16 @@ void SQSClient::ListQueuesAsync(const ListQueuesRequest& request, const ListQueu
   m_executor->Submit( [this, request, handler, context](){ this->ListQueuesAsyncHelper(request, handler, context); } );
 }
 
+ListQueuesOutcomeCallable SQSClient::ListQueuesCallable(ListQueuesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::ListQueues, this, std::move(request)));
+}
+
+void SQSClient::ListQueuesAsync(ListQueuesRequest&& request, const ListQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::ListQueuesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::ListQueuesAsyncHelper(const ListQueuesRequest& request, const ListQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListQueues(request), context);
@@ -444,7 +555,7 @@ PurgeQueueOutcome SQSClient::PurgeQueue(const PurgeQueueRequest& request) const
 
 PurgeQueueOutcomeCallable SQSClient::PurgeQueueCallable(const PurgeQueueRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PurgeQueue(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->PurgeQueue(request); });
 }
 
 void SQSClient::PurgeQueueAsync(const PurgeQueueRequest& request, const PurgeQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -452,6 +563,16 @@ void SQSClient::PurgeQueueAsync(const PurgeQueueRequest& request, const PurgeQue
   m_executor->Submit( [this, request, handler, context](){ this->PurgeQueueAsyncHelper(request, handler, context); } );
 }
 
+PurgeQueueOutcomeCallable SQSClient::PurgeQueueCallable(PurgeQueueRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::PurgeQueue, this, std::move(request)));
+}
+
+void SQSClient::PurgeQueueAsync(PurgeQueueRequest&& request, const PurgeQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::PurgeQueueAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::PurgeQueueAsyncHelper(const PurgeQueueRequest& request, const PurgeQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PurgeQueue(request), context);
@@ -472,7 +593,7 @@ ReceiveMessageOutcome SQSClient::ReceiveMessage(const ReceiveMessageRequest& req
 
 ReceiveMessageOutcomeCallable SQSClient::ReceiveMessageCallable(const ReceiveMessageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ReceiveMessage(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->ReceiveMessage(request); });
 }
 
 void SQSClient::ReceiveMessageAsync(const ReceiveMessageRequest& request, const ReceiveMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -480,6 +601,16 @@ void SQSClient::ReceiveMessageAsync(const ReceiveMessageRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ReceiveMessageAsyncHelper(request, handler, context); } );
 }
 
+ReceiveMessageOutcomeCallable SQSClient::ReceiveMessageCallable(ReceiveMessageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::ReceiveMessage, this, std::move(request)));
+}
+
+void SQSClient::ReceiveMessageAsync(ReceiveMessageRequest&& request, const ReceiveMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::ReceiveMessageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::ReceiveMessageAsyncHelper(const ReceiveMessageRequest& request, const ReceiveMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ReceiveMessage(request), context);
@@ -500,7 +631,7 @@ RemovePermissionOutcome SQSClient::RemovePermission(const RemovePermissionReques
 
 RemovePermissionOutcomeCallable SQSClient::RemovePermissionCallable(const RemovePermissionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemovePermission(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->RemovePermission(request); });
 }
 
 void SQSClient::RemovePermissionAsync(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -508,6 +639,16 @@ void SQSClient::RemovePermissionAsync(const RemovePermissionRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->RemovePermissionAsyncHelper(request, handler, context); } );
 }
 
+RemovePermissionOutcomeCallable SQSClient::RemovePermissionCallable(RemovePermissionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::RemovePermission, this, std::move(request)));
+}
+
+void SQSClient::RemovePermissionAsync(RemovePermissionRequest&& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::RemovePermissionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::RemovePermissionAsyncHelper(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemovePermission(request), context);
@@ -528,7 +669,7 @@ SendMessageOutcome SQSClient::SendMessage(const SendMessageRequest& request) con
 
 SendMessageOutcomeCallable SQSClient::SendMessageCallable(const SendMessageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SendMessage(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->SendMessage(request); });
 }
 
 void SQSClient::SendMessageAsync(const SendMessageRequest& request, const SendMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -536,6 +677,16 @@ void SQSClient::SendMessageAsync(const SendMessageRequest& request, const SendMe
   m_executor->Submit( [this, request, handler, context](){ this->SendMessageAsyncHelper(request, handler, context); } );
 }
 
+SendMessageOutcomeCallable SQSClient::SendMessageCallable(SendMessageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::SendMessage, this, std::move(request)));
+}
+
+void SQSClient::SendMessageAsync(SendMessageRequest&& request, const SendMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::SendMessageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::SendMessageAsyncHelper(const SendMessageRequest& request, const SendMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SendMessage(request), context);
@@ -556,7 +707,7 @@ SendMessageBatchOutcome SQSClient::SendMessageBatch(const SendMessageBatchReques
 
 SendMessageBatchOutcomeCallable SQSClient::SendMessageBatchCallable(const SendMessageBatchRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SendMessageBatch(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->SendMessageBatch(request); });
 }
 
 void SQSClient::SendMessageBatchAsync(const SendMessageBatchRequest& request, const SendMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -564,6 +715,16 @@ void SQSClient::SendMessageBatchAsync(const SendMessageBatchRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->SendMessageBatchAsyncHelper(request, handler, context); } );
 }
 
+SendMessageBatchOutcomeCallable SQSClient::SendMessageBatchCallable(SendMessageBatchRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::SendMessageBatch, this, std::move(request)));
+}
+
+void SQSClient::SendMessageBatchAsync(SendMessageBatchRequest&& request, const SendMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::SendMessageBatchAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::SendMessageBatchAsyncHelper(const SendMessageBatchRequest& request, const SendMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SendMessageBatch(request), context);
@@ -584,7 +745,7 @@ SetQueueAttributesOutcome SQSClient::SetQueueAttributes(const SetQueueAttributes
 
 SetQueueAttributesOutcomeCallable SQSClient::SetQueueAttributesCallable(const SetQueueAttributesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetQueueAttributes(request); });
+  return m_executor->SubmitCallable([this, request](){ return this->SetQueueAttributes(request); });
 }
 
 void SQSClient::SetQueueAttributesAsync(const SetQueueAttributesRequest& request, const SetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -592,8 +753,230 @@ void SQSClient::SetQueueAttributesAsync(const SetQueueAttributesRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->SetQueueAttributesAsyncHelper(request, handler, context); } );
 }
 
+SetQueueAttributesOutcomeCallable SQSClient::SetQueueAttributesCallable(SetQueueAttributesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SQSClient::SetQueueAttributes, this, std::move(request)));
+}
+
+void SQSClient::SetQueueAttributesAsync(SetQueueAttributesRequest&& request, const SetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SQSClient::SetQueueAttributesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SQSClient::SetQueueAttributesAsyncHelper(const SetQueueAttributesRequest& request, const SetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetQueueAttributes(request), context);
 }
 
+std::shared_ptr<BatchAccumulator<ChangeMessageVisibilityBatchRequest, ChangeMessageVisibilityBatchRequestEntry>> SQSClient::ChangeMessageVisibilityBatchAccumulator(const ChangeMessageVisibilityBatchRequest& requestTemplate, const BatchAccumulatorConfiguration& config) const
+{
+  return Aws::MakeShared<BatchAccumulator<ChangeMessageVisibilityBatchRequest, ChangeMessageVisibilityBatchRequestEntry>>(ALLOCATION_TAG, requestTemplate, 10, 0, config,
+    [](const ChangeMessageVisibilityBatchRequestEntry&) { return static_cast<size_t>(0); },
+    [this](const ChangeMessageVisibilityBatchRequest& requestTemplate, Aws::Vector<ChangeMessageVisibilityBatchRequestEntry>&& batch, Aws::Vector<BatchEntryFailure<ChangeMessageVisibilityBatchRequestEntry>>& failures)
+    {
+      // ids only need to be unique within one call, so entries are sent numbered by their position in the batch;
+      // failed entries get the caller's ids back before they are reported
+      Aws::Vector<Aws::String> callerIds;
+      callerIds.reserve(batch.size());
+      for(size_t i = 0; i < batch.size(); ++i)
+      {
+        callerIds.push_back(batch[i].GetId());
+        batch[i].SetId(Aws::Utils::StringUtils::to_string(i));
+      }
+      ChangeMessageVisibilityBatchRequest request(requestTemplate);
+      request.SetEntries(batch);
+      auto outcome = ChangeMessageVisibilityBatch(request);
+      if(!outcome.IsSuccess())
+      {
+        for(size_t i = 0; i < batch.size(); ++i)
+        {
+          batch[i].SetId(std::move(callerIds[i]));
+          failures.emplace_back(i, std::move(batch[i]), outcome.GetError().GetMessage(), outcome.GetError().ShouldRetry());
+        }
+        return;
+      }
+      for(const auto& failed : outcome.GetResult().GetFailed())
+      {
+        size_t index = static_cast<size_t>(Aws::Utils::StringUtils::ConvertToInt32(failed.GetId().c_str()));
+        if(index < batch.size())
+        {
+          batch[index].SetId(std::move(callerIds[index]));
+          failures.emplace_back(index, std::move(batch[index]), failed.GetMessage(), !failed.GetSenderFault());
+        }
+      }
+    }, GetRetryStrategy());
+}
+
+std::shared_ptr<BatchAccumulator<DeleteMessageBatchRequest, DeleteMessageBatchRequestEntry>> SQSClient::DeleteMessageBatchAccumulator(const DeleteMessageBatchRequest& requestTemplate, const BatchAccumulatorConfiguration& config) const
+{
+  return Aws::MakeShared<BatchAccumulator<DeleteMessageBatchRequest, DeleteMessageBatchRequestEntry>>(ALLOCATION_TAG, requestTemplate, 10, 0, config,
+    [](const DeleteMessageBatchRequestEntry&) { return static_cast<size_t>(0); },
+    [this](const DeleteMessageBatchRequest& requestTemplate, Aws::Vector<DeleteMessageBatchRequestEntry>&& batch, Aws::Vector<BatchEntryFailure<DeleteMessageBatchRequestEntry>>& failures)
+    {
+      // ids only need to be unique within one call, so entries are sent numbered by their position in the batch;
+      // failed entries get the caller's ids back before they are reported
+      Aws::Vector<Aws::String> callerIds;
+      callerIds.reserve(batch.size());
+      for(size_t i = 0; i < batch.size(); ++i)
+      {
+        callerIds.push_back(batch[i].GetId());
+        batch[i].SetId(Aws::Utils::StringUtils::to_string(i));
+      }
+      DeleteMessageBatchRequest request(requestTemplate);
+      request.SetEntries(batch);
+      auto outcome = DeleteMessageBatch(request);
+      if(!outcome.IsSuccess())
+      {
+        for(size_t i = 0; i < batch.size(); ++i)
+        {
+          batch[i].SetId(std::move(callerIds[i]));
+          failures.emplace_back(i, std::move(batch[i]), outcome.GetError().GetMessage(), outcome.GetError().ShouldRetry());
+        }
+        return;
+      }
+      for(const auto& failed : outcome.GetResult().GetFailed())
+      {
+        size_t index = static_cast<size_t>(Aws::Utils::StringUtils::ConvertToInt32(failed.GetId().c_str()));
+        if(index < batch.size())
+        {
+          batch[index].SetId(std::move(callerIds[index]));
+          failures.emplace_back(index, std::move(batch[index]), failed.GetMessage(), !failed.GetSenderFault());
+        }
+      }
+    }, GetRetryStrategy());
+}
+
+std::shared_ptr<BatchAccumulator<SendMessageBatchRequest, SendMessageBatchRequestEntry>> SQSClient::SendMessageBatchAccumulator(const SendMessageBatchRequest& requestTemplate, const BatchAccumulatorConfiguration& config) const
+{
+  return Aws::MakeShared<BatchAccumulator<SendMessageBatchRequest, SendMessageBatchRequestEntry>>(ALLOCATION_TAG, requestTemplate, 10, 262144, config,
+    [](const SendMessageBatchRequestEntry& entry)
+    {
+      size_t size = entry.GetMessageBody().size();
+      for(const auto& item : entry.GetMessageAttributes())
+      {
+        size += item.first.size() + item.second.GetStringValue().size() + item.second.GetBinaryValue().GetLength() + item.second.GetDataType().size();
+      }
+      return size;
+    },
+    [this](const SendMessageBatchRequest& requestTemplate, Aws::Vector<SendMessageBatchRequestEntry>&& batch, Aws::Vector<BatchEntryFailure<SendMessageBatchRequestEntry>>& failures)
+    {
+      // ids only need to be unique within one call, so entries are sent numbered by their position in the batch;
+      // failed entries get the caller's ids back before they are reported
+      Aws::Vector<Aws::String> callerIds;
+      callerIds.reserve(batch.size());
+      for(size_t i = 0; i < batch.size(); ++i)
+      {
+        callerIds.push_back(batch[i].GetId());
+        batch[i].SetId(Aws::Utils::StringUtils::to_string(i));
+      }
+      SendMessageBatchRequest request(requestTemplate);
+      request.SetEntries(batch);
+      auto outcome = SendMessageBatch(request);
+      if(!outcome.IsSuccess())
+      {
+        for(size_t i = 0; i < batch.size(); ++i)
+        {
+          batch[i].SetId(std::move(callerIds[i]));
+          failures.emplace_back(i, std::move(batch[i]), outcome.GetError().GetMessage(), outcome.GetError().ShouldRetry());
+        }
+        return;
+      }
+      for(const auto& failed : outcome.GetResult().GetFailed())
+      {
+        size_t index = static_cast<size_t>(Aws::Utils::StringUtils::ConvertToInt32(failed.GetId().c_str()));
+        if(index < batch.size())
+        {
+          batch[index].SetId(std::move(callerIds[index]));
+          failures.emplace_back(index, std::move(batch[index]), failed.GetMessage(), !failed.GetSenderFault());
+        }
+      }
+    }, GetRetryStrategy());
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<SQSClient, AddPermissionRequest, AddPermissionOutcome> SQSClient::AddPermissionAwaitable(AddPermissionRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::AddPermission, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, ChangeMessageVisibilityRequest, ChangeMessageVisibilityOutcome> SQSClient::ChangeMessageVisibilityAwaitable(ChangeMessageVisibilityRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::ChangeMessageVisibility, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, ChangeMessageVisibilityBatchRequest, ChangeMessageVisibilityBatchOutcome> SQSClient::ChangeMessageVisibilityBatchAwaitable(ChangeMessageVisibilityBatchRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::ChangeMessageVisibilityBatch, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, CreateQueueRequest, CreateQueueOutcome> SQSClient::CreateQueueAwaitable(CreateQueueRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::CreateQueue, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, DeleteMessageRequest, DeleteMessageOutcome> SQSClient::DeleteMessageAwaitable(DeleteMessageRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::DeleteMessage, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, DeleteMessageBatchRequest, DeleteMessageBatchOutcome> SQSClient::DeleteMessageBatchAwaitable(DeleteMessageBatchRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::DeleteMessageBatch, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, DeleteQueueRequest, DeleteQueueOutcome> SQSClient::DeleteQueueAwaitable(DeleteQueueRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::DeleteQueue, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, GetQueueAttributesRequest, GetQueueAttributesOutcome> SQSClient::GetQueueAttributesAwaitable(GetQueueAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::GetQueueAttributes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, GetQueueUrlRequest, GetQueueUrlOutcome> SQSClient::GetQueueUrlAwaitable(GetQueueUrlRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::GetQueueUrl, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, ListDeadLetterSourceQueuesRequest, ListDeadLetterSourceQueuesOutcome> SQSClient::ListDeadLetterSourceQueuesAwaitable(ListDeadLetterSourceQueuesRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::ListDeadLetterSourceQueues, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, ListQueuesRequest, ListQueuesOutcome> SQSClient::ListQueuesAwaitable(ListQueuesRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::ListQueues, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, PurgeQueueRequest, PurgeQueueOutcome> SQSClient::PurgeQueueAwaitable(PurgeQueueRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::PurgeQueue, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, ReceiveMessageRequest, ReceiveMessageOutcome> SQSClient::ReceiveMessageAwaitable(ReceiveMessageRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::ReceiveMessage, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, RemovePermissionRequest, RemovePermissionOutcome> SQSClient::RemovePermissionAwaitable(RemovePermissionRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::RemovePermission, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, SendMessageRequest, SendMessageOutcome> SQSClient::SendMessageAwaitable(SendMessageRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::SendMessage, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, SendMessageBatchRequest, SendMessageBatchOutcome> SQSClient::SendMessageBatchAwaitable(SendMessageBatchRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::SendMessageBatch, std::move(request) } };
+}
+
+ClientOperationAwaitable<SQSClient, SetQueueAttributesRequest, SetQueueAttributesOutcome> SQSClient::SetQueueAttributesAwaitable(SetQueueAttributesRequest request) const
+{
+  return { m_executor.get(), { this, &SQSClient::SetQueueAttributes, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
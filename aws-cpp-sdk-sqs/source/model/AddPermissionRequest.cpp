@@ -15,6 +15,7 @@
 #include <aws/sqs/model/AddPermissionRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SQS::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ AddPermissionRequest::AddPermissionRequest() :
 
 Aws::String AddPermissionRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AddPermission&";
   if(m_queueUrlHasBeenSet)
   {
-    ss << "QueueUrl=" << StringUtils::URLEncode(m_queueUrl.c_str()) << "&";
+    ss << "QueueUrl=" << StringUtils::URLEncoded(m_queueUrl) << "&";
   }
 
   if(m_labelHasBeenSet)
   {
-    ss << "Label=" << StringUtils::URLEncode(m_label.c_str()) << "&";
+    ss << "Label=" << StringUtils::URLEncoded(m_label) << "&";
   }
 
   if(m_aWSAccountIdsHasBeenSet)
@@ -47,7 +48,7 @@ Aws::String AddPermissionRequest::SerializePayload() const
     for(auto& item : m_aWSAccountIds)
     {
       ss << "AWSAccountId." << aWSAccountIdsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       aWSAccountIdsCount++;
     }
   }
@@ -58,12 +59,12 @@ Aws::String AddPermissionRequest::SerializePayload() const
     for(auto& item : m_actions)
     {
       ss << "ActionName." << actionsCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       actionsCount++;
     }
   }
 
   ss << "Version=2012-11-05";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -57,25 +57,25 @@ BatchResultErrorEntry& BatchResultErrorEntry::operator =(const XmlNode& xmlNode)
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode senderFaultNode = resultNode.FirstChild("SenderFault");
     if(!senderFaultNode.IsNull())
     {
-      m_senderFault = StringUtils::ConvertToBool(StringUtils::Trim(senderFaultNode.GetText().c_str()).c_str());
+      m_senderFault = StringUtils::ConvertToBool(senderFaultNode.GetTextView().Trim().ToString().c_str());
       m_senderFaultHasBeenSet = true;
     }
     XmlNode codeNode = resultNode.FirstChild("Code");
     if(!codeNode.IsNull())
     {
-      m_code = StringUtils::Trim(codeNode.GetText().c_str());
+      m_code = codeNode.GetTextView().Trim().ToString();
       m_codeHasBeenSet = true;
     }
     XmlNode messageNode = resultNode.FirstChild("Message");
     if(!messageNode.IsNull())
     {
-      m_message = StringUtils::Trim(messageNode.GetText().c_str());
+      m_message = messageNode.GetTextView().Trim().ToString();
       m_messageHasBeenSet = true;
     }
   }
@@ -87,7 +87,7 @@ void BatchResultErrorEntry::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_idHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
 
   if(m_senderFaultHasBeenSet)
@@ -97,12 +97,12 @@ void BatchResultErrorEntry::OutputToStream(Aws::OStream& oStream, const char* lo
 
   if(m_codeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Code=" << StringUtils::URLEncode(m_code.c_str()) << "&";
+      oStream << location << index << locationValue << ".Code=" << StringUtils::URLEncoded(m_code) << "&";
   }
 
   if(m_messageHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << index << locationValue << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 
 }
@@ -111,7 +111,7 @@ void BatchResultErrorEntry::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_idHasBeenSet)
   {
-      oStream << location << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
   if(m_senderFaultHasBeenSet)
   {
@@ -119,11 +119,11 @@ void BatchResultErrorEntry::OutputToStream(Aws::OStream& oStream, const char* lo
   }
   if(m_codeHasBeenSet)
   {
-      oStream << location << ".Code=" << StringUtils::URLEncode(m_code.c_str()) << "&";
+      oStream << location << ".Code=" << StringUtils::URLEncoded(m_code) << "&";
   }
   if(m_messageHasBeenSet)
   {
-      oStream << location << ".Message=" << StringUtils::URLEncode(m_message.c_str()) << "&";
+      oStream << location << ".Message=" << StringUtils::URLEncoded(m_message) << "&";
   }
 }
 
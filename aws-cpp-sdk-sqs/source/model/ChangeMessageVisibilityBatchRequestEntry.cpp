@@ -55,19 +55,19 @@ ChangeMessageVisibilityBatchRequestEntry& ChangeMessageVisibilityBatchRequestEnt
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode receiptHandleNode = resultNode.FirstChild("ReceiptHandle");
     if(!receiptHandleNode.IsNull())
     {
-      m_receiptHandle = StringUtils::Trim(receiptHandleNode.GetText().c_str());
+      m_receiptHandle = receiptHandleNode.GetTextView().Trim().ToString();
       m_receiptHandleHasBeenSet = true;
     }
     XmlNode visibilityTimeoutNode = resultNode.FirstChild("VisibilityTimeout");
     if(!visibilityTimeoutNode.IsNull())
     {
-      m_visibilityTimeout = StringUtils::ConvertToInt32(StringUtils::Trim(visibilityTimeoutNode.GetText().c_str()).c_str());
+      m_visibilityTimeout = StringUtils::ConvertToInt32(visibilityTimeoutNode.GetTextView().Trim().ToString().c_str());
       m_visibilityTimeoutHasBeenSet = true;
     }
   }
@@ -79,12 +79,12 @@ void ChangeMessageVisibilityBatchRequestEntry::OutputToStream(Aws::OStream& oStr
 {
   if(m_idHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
 
   if(m_receiptHandleHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReceiptHandle=" << StringUtils::URLEncode(m_receiptHandle.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReceiptHandle=" << StringUtils::URLEncoded(m_receiptHandle) << "&";
   }
 
   if(m_visibilityTimeoutHasBeenSet)
@@ -98,11 +98,11 @@ void ChangeMessageVisibilityBatchRequestEntry::OutputToStream(Aws::OStream& oStr
 {
   if(m_idHasBeenSet)
   {
-      oStream << location << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
   if(m_receiptHandleHasBeenSet)
   {
-      oStream << location << ".ReceiptHandle=" << StringUtils::URLEncode(m_receiptHandle.c_str()) << "&";
+      oStream << location << ".ReceiptHandle=" << StringUtils::URLEncoded(m_receiptHandle) << "&";
   }
   if(m_visibilityTimeoutHasBeenSet)
   {
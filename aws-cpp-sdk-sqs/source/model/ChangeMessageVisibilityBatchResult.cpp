@@ -40,7 +40,7 @@ ChangeMessageVisibilityBatchResult& ChangeMessageVisibilityBatchResult::operator
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ChangeMessageVisibilityBatchResult")
+  if (rootNode.GetNameView() != "ChangeMessageVisibilityBatchResult")
   {
     resultNode = rootNode.FirstChild("ChangeMessageVisibilityBatchResult");
   }
@@ -49,7 +49,7 @@ ChangeMessageVisibilityBatchResultEntry& ChangeMessageVisibilityBatchResultEntry
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
   }
@@ -61,7 +61,7 @@ void ChangeMessageVisibilityBatchResultEntry::OutputToStream(Aws::OStream& oStre
 {
   if(m_idHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
 
 }
@@ -70,7 +70,7 @@ void ChangeMessageVisibilityBatchResultEntry::OutputToStream(Aws::OStream& oStre
 {
   if(m_idHasBeenSet)
   {
-      oStream << location << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
 }
 
@@ -15,6 +15,7 @@
 #include <aws/sqs/model/ChangeMessageVisibilityRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SQS::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ ChangeMessageVisibilityRequest::ChangeMessageVisibilityRequest() :
 
 Aws::String ChangeMessageVisibilityRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ChangeMessageVisibility&";
   if(m_queueUrlHasBeenSet)
   {
-    ss << "QueueUrl=" << StringUtils::URLEncode(m_queueUrl.c_str()) << "&";
+    ss << "QueueUrl=" << StringUtils::URLEncoded(m_queueUrl) << "&";
   }
 
   if(m_receiptHandleHasBeenSet)
   {
-    ss << "ReceiptHandle=" << StringUtils::URLEncode(m_receiptHandle.c_str()) << "&";
+    ss << "ReceiptHandle=" << StringUtils::URLEncoded(m_receiptHandle) << "&";
   }
 
   if(m_visibilityTimeoutHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String ChangeMessageVisibilityRequest::SerializePayload() const
   }
 
   ss << "Version=2012-11-05";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -15,6 +15,7 @@
 #include <aws/sqs/model/CreateQueueRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SQS::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ CreateQueueRequest::CreateQueueRequest() :
 
 Aws::String CreateQueueRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=CreateQueue&";
   if(m_queueNameHasBeenSet)
   {
-    ss << "QueueName=" << StringUtils::URLEncode(m_queueName.c_str()) << "&";
+    ss << "QueueName=" << StringUtils::URLEncoded(m_queueName) << "&";
   }
 
   if(m_attributesHasBeenSet)
@@ -40,14 +41,14 @@ Aws::String CreateQueueRequest::SerializePayload() const
     for(auto& item : m_attributes)
     {
       ss << "Attribute." << attributesCount << ".Name="
-          << StringUtils::URLEncode(QueueAttributeNameMapper::GetNameForQueueAttributeName(item.first).c_str()) << "&";
+          << StringUtils::URLEncoded(QueueAttributeNameMapper::GetNameForQueueAttributeName(item.first)) << "&";
       ss << "Attribute." << attributesCount << ".Value="
-          << StringUtils::URLEncode(item.second.c_str()) << "&";
+          << StringUtils::URLEncoded(item.second) << "&";
       attributesCount++;
     }
   }
 
   ss << "Version=2012-11-05";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ CreateQueueResult& CreateQueueResult::operator =(const AmazonWebServiceResult<Xm
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "CreateQueueResult")
+  if (rootNode.GetNameView() != "CreateQueueResult")
   {
     resultNode = rootNode.FirstChild("CreateQueueResult");
   }
@@ -50,7 +50,7 @@ CreateQueueResult& CreateQueueResult::operator =(const AmazonWebServiceResult<Xm
     XmlNode queueUrlNode = resultNode.FirstChild("QueueUrl");
     if(!queueUrlNode.IsNull())
     {
-      m_queueUrl = StringUtils::Trim(queueUrlNode.GetText().c_str());
+      m_queueUrl = queueUrlNode.GetTextView().Trim().ToString();
     }
   }
 
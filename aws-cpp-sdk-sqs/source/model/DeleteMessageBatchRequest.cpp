@@ -15,6 +15,7 @@
 #include <aws/sqs/model/DeleteMessageBatchRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SQS::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ DeleteMessageBatchRequest::DeleteMessageBatchRequest() :
 
 Aws::String DeleteMessageBatchRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DeleteMessageBatch&";
   if(m_queueUrlHasBeenSet)
   {
-    ss << "QueueUrl=" << StringUtils::URLEncode(m_queueUrl.c_str()) << "&";
+    ss << "QueueUrl=" << StringUtils::URLEncoded(m_queueUrl) << "&";
   }
 
   if(m_entriesHasBeenSet)
@@ -45,6 +46,6 @@ Aws::String DeleteMessageBatchRequest::SerializePayload() const
   }
 
   ss << "Version=2012-11-05";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -51,13 +51,13 @@ DeleteMessageBatchRequestEntry& DeleteMessageBatchRequestEntry::operator =(const
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode receiptHandleNode = resultNode.FirstChild("ReceiptHandle");
     if(!receiptHandleNode.IsNull())
     {
-      m_receiptHandle = StringUtils::Trim(receiptHandleNode.GetText().c_str());
+      m_receiptHandle = receiptHandleNode.GetTextView().Trim().ToString();
       m_receiptHandleHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void DeleteMessageBatchRequestEntry::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_idHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
 
   if(m_receiptHandleHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReceiptHandle=" << StringUtils::URLEncode(m_receiptHandle.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReceiptHandle=" << StringUtils::URLEncoded(m_receiptHandle) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void DeleteMessageBatchRequestEntry::OutputToStream(Aws::OStream& oStream, const
 {
   if(m_idHasBeenSet)
   {
-      oStream << location << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
   if(m_receiptHandleHasBeenSet)
   {
-      oStream << location << ".ReceiptHandle=" << StringUtils::URLEncode(m_receiptHandle.c_str()) << "&";
+      oStream << location << ".ReceiptHandle=" << StringUtils::URLEncoded(m_receiptHandle) << "&";
   }
 }
 
@@ -40,7 +40,7 @@ DeleteMessageBatchResult& DeleteMessageBatchResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DeleteMessageBatchResult")
+  if (rootNode.GetNameView() != "DeleteMessageBatchResult")
   {
     resultNode = rootNode.FirstChild("DeleteMessageBatchResult");
   }
@@ -15,6 +15,7 @@
 #include <aws/sqs/model/GetQueueAttributesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SQS::Model;
 using namespace Aws::Utils;
@@ -27,11 +28,11 @@ GetQueueAttributesRequest::GetQueueAttributesRequest() :
 
 Aws::String GetQueueAttributesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetQueueAttributes&";
   if(m_queueUrlHasBeenSet)
   {
-    ss << "QueueUrl=" << StringUtils::URLEncode(m_queueUrl.c_str()) << "&";
+    ss << "QueueUrl=" << StringUtils::URLEncoded(m_queueUrl) << "&";
   }
 
   if(m_attributeNamesHasBeenSet)
@@ -40,12 +41,12 @@ Aws::String GetQueueAttributesRequest::SerializePayload() const
     for(auto& item : m_attributeNames)
     {
       ss << "AttributeName." << attributeNamesCount << "="
-          << StringUtils::URLEncode(QueueAttributeNameMapper::GetNameForQueueAttributeName(item).c_str()) << "&";
+          << StringUtils::URLEncoded(QueueAttributeNameMapper::GetNameForQueueAttributeName(item)) << "&";
       attributeNamesCount++;
     }
   }
 
   ss << "Version=2012-11-05";
-  return ss.str();
+  return ss.TakeString();
 }
 
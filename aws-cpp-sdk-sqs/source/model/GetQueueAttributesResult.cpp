@@ -40,7 +40,7 @@ GetQueueAttributesResult& GetQueueAttributesResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetQueueAttributesResult")
+  if (rootNode.GetNameView() != "GetQueueAttributesResult")
   {
     resultNode = rootNode.FirstChild("GetQueueAttributesResult");
   }
@@ -55,8 +55,8 @@ GetQueueAttributesResult& GetQueueAttributesResult::operator =(const AmazonWebSe
       {
         XmlNode keyNode = attributeEntry.FirstChild("Name");
         XmlNode valueNode = attributeEntry.FirstChild("Value");
-        m_attributes[QueueAttributeNameMapper::GetQueueAttributeNameForName(StringUtils::Trim(keyNode.GetText().c_str()))] =
-            StringUtils::Trim(valueNode.GetText().c_str());
+        m_attributes[QueueAttributeNameMapper::GetQueueAttributeNameForName(keyNode.GetTextView().Trim().ToString())] =
+            valueNode.GetTextView().Trim().ToString();
         attributeEntry = attributeEntry.NextNode("Attribute");
       }
 
@@ -15,6 +15,7 @@
 #include <aws/sqs/model/GetQueueUrlRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SQS::Model;
 using namespace Aws::Utils;
@@ -27,19 +28,19 @@ GetQueueUrlRequest::GetQueueUrlRequest() :
 
 Aws::String GetQueueUrlRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetQueueUrl&";
   if(m_queueNameHasBeenSet)
   {
-    ss << "QueueName=" << StringUtils::URLEncode(m_queueName.c_str()) << "&";
+    ss << "QueueName=" << StringUtils::URLEncoded(m_queueName) << "&";
   }
 
   if(m_queueOwnerAWSAccountIdHasBeenSet)
   {
-    ss << "QueueOwnerAWSAccountId=" << StringUtils::URLEncode(m_queueOwnerAWSAccountId.c_str()) << "&";
+    ss << "QueueOwnerAWSAccountId=" << StringUtils::URLEncoded(m_queueOwnerAWSAccountId) << "&";
   }
 
   ss << "Version=2012-11-05";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ GetQueueUrlResult& GetQueueUrlResult::operator =(const AmazonWebServiceResult<Xm
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetQueueUrlResult")
+  if (rootNode.GetNameView() != "GetQueueUrlResult")
   {
     resultNode = rootNode.FirstChild("GetQueueUrlResult");
   }
@@ -50,7 +50,7 @@ GetQueueUrlResult& GetQueueUrlResult::operator =(const AmazonWebServiceResult<Xm
     XmlNode queueUrlNode = resultNode.FirstChild("QueueUrl");
     if(!queueUrlNode.IsNull())
     {
-      m_queueUrl = StringUtils::Trim(queueUrlNode.GetText().c_str());
+      m_queueUrl = queueUrlNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -40,7 +40,7 @@ ListDeadLetterSourceQueuesResult& ListDeadLetterSourceQueuesResult::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListDeadLetterSourceQueuesResult")
+  if (rootNode.GetNameView() != "ListDeadLetterSourceQueuesResult")
   {
     resultNode = rootNode.FirstChild("ListDeadLetterSourceQueuesResult");
   }
@@ -53,7 +53,7 @@ ListDeadLetterSourceQueuesResult& ListDeadLetterSourceQueuesResult::operator =(c
       XmlNode queueUrlMember = queueUrlsNode;
       while(!queueUrlMember.IsNull())
       {
-        m_queueUrls.push_back(StringUtils::Trim(queueUrlMember.GetText().c_str()));
+        m_queueUrls.push_back(queueUrlMember.GetTextView().Trim().ToString());
         queueUrlMember = queueUrlMember.NextNode("QueueUrl");
       }
 
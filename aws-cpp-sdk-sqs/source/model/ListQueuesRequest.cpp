@@ -15,6 +15,7 @@
 #include <aws/sqs/model/ListQueuesRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SQS::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ ListQueuesRequest::ListQueuesRequest() :
 
 Aws::String ListQueuesRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ListQueues&";
   if(m_queueNamePrefixHasBeenSet)
   {
-    ss << "QueueNamePrefix=" << StringUtils::URLEncode(m_queueNamePrefix.c_str()) << "&";
+    ss << "QueueNamePrefix=" << StringUtils::URLEncoded(m_queueNamePrefix) << "&";
   }
 
   ss << "Version=2012-11-05";
-  return ss.str();
+  return ss.TakeString();
 }
 
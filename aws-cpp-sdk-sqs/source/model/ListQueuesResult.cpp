@@ -40,7 +40,7 @@ ListQueuesResult& ListQueuesResult::operator =(const AmazonWebServiceResult<XmlD
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ListQueuesResult")
+  if (rootNode.GetNameView() != "ListQueuesResult")
   {
     resultNode = rootNode.FirstChild("ListQueuesResult");
   }
@@ -53,7 +53,7 @@ ListQueuesResult& ListQueuesResult::operator =(const AmazonWebServiceResult<XmlD
       XmlNode queueUrlMember = queueUrlsNode;
       while(!queueUrlMember.IsNull())
       {
-        m_queueUrls.push_back(StringUtils::Trim(queueUrlMember.GetText().c_str()));
+        m_queueUrls.push_back(queueUrlMember.GetTextView().Trim().ToString());
         queueUrlMember = queueUrlMember.NextNode("QueueUrl");
       }
 
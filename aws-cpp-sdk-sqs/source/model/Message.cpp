@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -61,25 +62,25 @@ Message& Message::operator =(const XmlNode& xmlNode)
     XmlNode messageIdNode = resultNode.FirstChild("MessageId");
     if(!messageIdNode.IsNull())
     {
-      m_messageId = StringUtils::Trim(messageIdNode.GetText().c_str());
+      m_messageId = messageIdNode.GetTextView().Trim().ToString();
       m_messageIdHasBeenSet = true;
     }
     XmlNode receiptHandleNode = resultNode.FirstChild("ReceiptHandle");
     if(!receiptHandleNode.IsNull())
     {
-      m_receiptHandle = StringUtils::Trim(receiptHandleNode.GetText().c_str());
+      m_receiptHandle = receiptHandleNode.GetTextView().Trim().ToString();
       m_receiptHandleHasBeenSet = true;
     }
     XmlNode mD5OfBodyNode = resultNode.FirstChild("MD5OfBody");
     if(!mD5OfBodyNode.IsNull())
     {
-      m_mD5OfBody = StringUtils::Trim(mD5OfBodyNode.GetText().c_str());
+      m_mD5OfBody = mD5OfBodyNode.GetTextView().Trim().ToString();
       m_mD5OfBodyHasBeenSet = true;
     }
     XmlNode bodyNode = resultNode.FirstChild("Body");
     if(!bodyNode.IsNull())
     {
-      m_body = StringUtils::Trim(bodyNode.GetText().c_str());
+      m_body = bodyNode.GetTextView().Trim().ToString();
       m_bodyHasBeenSet = true;
     }
     XmlNode attributesNode = resultNode.FirstChild("Attribute");
@@ -90,8 +91,8 @@ Message& Message::operator =(const XmlNode& xmlNode)
       {
         XmlNode keyNode = attributeEntry.FirstChild("Name");
         XmlNode valueNode = attributeEntry.FirstChild("Value");
-        m_attributes[QueueAttributeNameMapper::GetQueueAttributeNameForName(StringUtils::Trim(keyNode.GetText().c_str()))] =
-            StringUtils::Trim(valueNode.GetText().c_str());
+        m_attributes[QueueAttributeNameMapper::GetQueueAttributeNameForName(keyNode.GetTextView().Trim().ToString())] =
+            valueNode.GetTextView().Trim().ToString();
         attributeEntry = attributeEntry.NextNode("Attribute");
       }
 
@@ -100,7 +101,7 @@ Message& Message::operator =(const XmlNode& xmlNode)
     XmlNode mD5OfMessageAttributesNode = resultNode.FirstChild("MD5OfMessageAttributes");
     if(!mD5OfMessageAttributesNode.IsNull())
     {
-      m_mD5OfMessageAttributes = StringUtils::Trim(mD5OfMessageAttributesNode.GetText().c_str());
+      m_mD5OfMessageAttributes = mD5OfMessageAttributesNode.GetTextView().Trim().ToString();
       m_mD5OfMessageAttributesHasBeenSet = true;
     }
     XmlNode messageAttributesNode = resultNode.FirstChild("MessageAttribute");
@@ -111,7 +112,7 @@ Message& Message::operator =(const XmlNode& xmlNode)
       {
         XmlNode keyNode = messageAttributeEntry.FirstChild("Name");
         XmlNode valueNode = messageAttributeEntry.FirstChild("Value");
-        m_messageAttributes[StringUtils::Trim(keyNode.GetText().c_str())] =
+        m_messageAttributes[keyNode.GetTextView().Trim().ToString()] =
             valueNode;
         messageAttributeEntry = messageAttributeEntry.NextNode("MessageAttribute");
       }
@@ -127,22 +128,22 @@ void Message::OutputToStream(Aws::OStream& oStream, const char* location, unsign
 {
   if(m_messageIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MessageId=" << StringUtils::URLEncode(m_messageId.c_str()) << "&";
+      oStream << location << index << locationValue << ".MessageId=" << StringUtils::URLEncoded(m_messageId) << "&";
   }
 
   if(m_receiptHandleHasBeenSet)
   {
-      oStream << location << index << locationValue << ".ReceiptHandle=" << StringUtils::URLEncode(m_receiptHandle.c_str()) << "&";
+      oStream << location << index << locationValue << ".ReceiptHandle=" << StringUtils::URLEncoded(m_receiptHandle) << "&";
   }
 
   if(m_mD5OfBodyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MD5OfBody=" << StringUtils::URLEncode(m_mD5OfBody.c_str()) << "&";
+      oStream << location << index << locationValue << ".MD5OfBody=" << StringUtils::URLEncoded(m_mD5OfBody) << "&";
   }
 
   if(m_bodyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Body=" << StringUtils::URLEncode(m_body.c_str()) << "&";
+      oStream << location << index << locationValue << ".Body=" << StringUtils::URLEncoded(m_body) << "&";
   }
 
   if(m_attributesHasBeenSet)
@@ -151,16 +152,16 @@ void Message::OutputToStream(Aws::OStream& oStream, const char* location, unsign
       for(auto& item : m_attributes)
       {
         oStream << location << index << locationValue << ".Attribute." << attributesIdx << ".Name="
-            << StringUtils::URLEncode(QueueAttributeNameMapper::GetNameForQueueAttributeName(item.first).c_str()) << "&";
+            << StringUtils::URLEncoded(QueueAttributeNameMapper::GetNameForQueueAttributeName(item.first)) << "&";
         oStream << location << index << locationValue << ".Attribute." << attributesIdx << ".Value="
-            << StringUtils::URLEncode(item.second.c_str()) << "&";
+            << StringUtils::URLEncoded(item.second) << "&";
         attributesIdx++;
       }
   }
 
   if(m_mD5OfMessageAttributesHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MD5OfMessageAttributes=" << StringUtils::URLEncode(m_mD5OfMessageAttributes.c_str()) << "&";
+      oStream << location << index << locationValue << ".MD5OfMessageAttributes=" << StringUtils::URLEncoded(m_mD5OfMessageAttributes) << "&";
   }
 
   if(m_messageAttributesHasBeenSet)
@@ -169,10 +170,10 @@ void Message::OutputToStream(Aws::OStream& oStream, const char* location, unsign
       for(auto& item : m_messageAttributes)
       {
         oStream << location << index << locationValue << ".MessageAttribute." << messageAttributesIdx << ".Name="
-            << StringUtils::URLEncode(item.first.c_str()) << "&";
-        Aws::StringStream messageAttributesSs;
+            << StringUtils::URLEncoded(item.first) << "&";
+        Aws::Utils::Stream::StringOutputStream messageAttributesSs;
         messageAttributesSs << location << index << locationValue << ".MessageAttribute." << messageAttributesIdx << ".Value";
-        item.second.OutputToStream(oStream, messageAttributesSs.str().c_str());
+        item.second.OutputToStream(oStream, messageAttributesSs.GetString().c_str());
         messageAttributesIdx++;
       }
   }
@@ -183,19 +184,19 @@ void Message::OutputToStream(Aws::OStream& oStream, const char* location) const
 {
   if(m_messageIdHasBeenSet)
   {
-      oStream << location << ".MessageId=" << StringUtils::URLEncode(m_messageId.c_str()) << "&";
+      oStream << location << ".MessageId=" << StringUtils::URLEncoded(m_messageId) << "&";
   }
   if(m_receiptHandleHasBeenSet)
   {
-      oStream << location << ".ReceiptHandle=" << StringUtils::URLEncode(m_receiptHandle.c_str()) << "&";
+      oStream << location << ".ReceiptHandle=" << StringUtils::URLEncoded(m_receiptHandle) << "&";
   }
   if(m_mD5OfBodyHasBeenSet)
   {
-      oStream << location << ".MD5OfBody=" << StringUtils::URLEncode(m_mD5OfBody.c_str()) << "&";
+      oStream << location << ".MD5OfBody=" << StringUtils::URLEncoded(m_mD5OfBody) << "&";
   }
   if(m_bodyHasBeenSet)
   {
-      oStream << location << ".Body=" << StringUtils::URLEncode(m_body.c_str()) << "&";
+      oStream << location << ".Body=" << StringUtils::URLEncoded(m_body) << "&";
   }
   if(m_attributesHasBeenSet)
   {
@@ -203,16 +204,16 @@ void Message::OutputToStream(Aws::OStream& oStream, const char* location) const
       for(auto& item : m_attributes)
       {
         oStream << location << ".Attribute."  << attributesIdx << ".Name="
-            << StringUtils::URLEncode(QueueAttributeNameMapper::GetNameForQueueAttributeName(item.first).c_str()) << "&";
+            << StringUtils::URLEncoded(QueueAttributeNameMapper::GetNameForQueueAttributeName(item.first)) << "&";
         oStream << location <<  ".Attribute." << attributesIdx << ".Value="
-            << StringUtils::URLEncode(item.second.c_str()) << "&";
+            << StringUtils::URLEncoded(item.second) << "&";
         attributesIdx++;
       }
 
   }
   if(m_mD5OfMessageAttributesHasBeenSet)
   {
-      oStream << location << ".MD5OfMessageAttributes=" << StringUtils::URLEncode(m_mD5OfMessageAttributes.c_str()) << "&";
+      oStream << location << ".MD5OfMessageAttributes=" << StringUtils::URLEncoded(m_mD5OfMessageAttributes) << "&";
   }
   if(m_messageAttributesHasBeenSet)
   {
@@ -220,10 +221,10 @@ void Message::OutputToStream(Aws::OStream& oStream, const char* location) const
       for(auto& item : m_messageAttributes)
       {
         oStream << location << ".MessageAttribute."  << messageAttributesIdx << ".Name="
-            << StringUtils::URLEncode(item.first.c_str()) << "&";
-        Aws::StringStream messageAttributesSs;
+            << StringUtils::URLEncoded(item.first) << "&";
+        Aws::Utils::Stream::StringOutputStream messageAttributesSs;
         messageAttributesSs << location << ".MessageAttribute." << messageAttributesIdx << ".Value";
-        item.second.OutputToStream(oStream, messageAttributesSs.str().c_str());
+        item.second.OutputToStream(oStream, messageAttributesSs.GetString().c_str());
         messageAttributesIdx++;
       }
 
@@ -58,13 +58,13 @@ MessageAttributeValue& MessageAttributeValue::operator =(const XmlNode& xmlNode)
     XmlNode stringValueNode = resultNode.FirstChild("StringValue");
     if(!stringValueNode.IsNull())
     {
-      m_stringValue = StringUtils::Trim(stringValueNode.GetText().c_str());
+      m_stringValue = stringValueNode.GetTextView().Trim().ToString();
       m_stringValueHasBeenSet = true;
     }
     XmlNode binaryValueNode = resultNode.FirstChild("BinaryValue");
     if(!binaryValueNode.IsNull())
     {
-      m_binaryValue = HashingUtils::Base64Decode(StringUtils::Trim(binaryValueNode.GetText().c_str()));
+      m_binaryValue = HashingUtils::Base64Decode(binaryValueNode.GetTextView().Trim().ToString());
       m_binaryValueHasBeenSet = true;
     }
     XmlNode stringListValuesNode = resultNode.FirstChild("StringListValue");
@@ -73,7 +73,7 @@ MessageAttributeValue& MessageAttributeValue::operator =(const XmlNode& xmlNode)
       XmlNode stringListValueMember = stringListValuesNode;
       while(!stringListValueMember.IsNull())
       {
-        m_stringListValues.push_back(StringUtils::Trim(stringListValueMember.GetText().c_str()));
+        m_stringListValues.push_back(stringListValueMember.GetTextView().Trim().ToString());
         stringListValueMember = stringListValueMember.NextNode("StringListValue");
       }
 
@@ -93,7 +93,7 @@ MessageAttributeValue& MessageAttributeValue::operator =(const XmlNode& xmlNode)
     XmlNode dataTypeNode = resultNode.FirstChild("DataType");
     if(!dataTypeNode.IsNull())
     {
-      m_dataType = StringUtils::Trim(dataTypeNode.GetText().c_str());
+      m_dataType = dataTypeNode.GetTextView().Trim().ToString();
       m_dataTypeHasBeenSet = true;
     }
   }
@@ -105,12 +105,12 @@ void MessageAttributeValue::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_stringValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".StringValue=" << StringUtils::URLEncode(m_stringValue.c_str()) << "&";
+      oStream << location << index << locationValue << ".StringValue=" << StringUtils::URLEncoded(m_stringValue) << "&";
   }
 
   if(m_binaryValueHasBeenSet)
   {
-      oStream << location << index << locationValue << ".BinaryValue=" << StringUtils::URLEncode(HashingUtils::Base64Encode(m_binaryValue).c_str()) << "&";
+      oStream << location << index << locationValue << ".BinaryValue=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(m_binaryValue)) << "&";
   }
 
   if(m_stringListValuesHasBeenSet)
@@ -118,7 +118,7 @@ void MessageAttributeValue::OutputToStream(Aws::OStream& oStream, const char* lo
       unsigned stringListValuesIdx = 1;
       for(auto& item : m_stringListValues)
       {
-        oStream << location << index << locationValue << ".StringListValue." << stringListValuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << index << locationValue << ".StringListValue." << stringListValuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
 
@@ -127,13 +127,13 @@ void MessageAttributeValue::OutputToStream(Aws::OStream& oStream, const char* lo
       unsigned binaryListValuesIdx = 1;
       for(auto& item : m_binaryListValues)
       {
-        oStream << location << index << locationValue << ".BinaryListValue." << binaryListValuesIdx++ << "=" << StringUtils::URLEncode(HashingUtils::Base64Encode(item).c_str()) << "&";
+        oStream << location << index << locationValue << ".BinaryListValue." << binaryListValuesIdx++ << "=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(item)) << "&";
       }
   }
 
   if(m_dataTypeHasBeenSet)
   {
-      oStream << location << index << locationValue << ".DataType=" << StringUtils::URLEncode(m_dataType.c_str()) << "&";
+      oStream << location << index << locationValue << ".DataType=" << StringUtils::URLEncoded(m_dataType) << "&";
   }
 
 }
@@ -142,18 +142,18 @@ void MessageAttributeValue::OutputToStream(Aws::OStream& oStream, const char* lo
 {
   if(m_stringValueHasBeenSet)
   {
-      oStream << location << ".StringValue=" << StringUtils::URLEncode(m_stringValue.c_str()) << "&";
+      oStream << location << ".StringValue=" << StringUtils::URLEncoded(m_stringValue) << "&";
   }
   if(m_binaryValueHasBeenSet)
   {
-      oStream << location << ".BinaryValue=" << StringUtils::URLEncode(HashingUtils::Base64Encode(m_binaryValue).c_str()) << "&";
+      oStream << location << ".BinaryValue=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(m_binaryValue)) << "&";
   }
   if(m_stringListValuesHasBeenSet)
   {
       unsigned stringListValuesIdx = 1;
       for(auto& item : m_stringListValues)
       {
-        oStream << location << ".StringListValue." << stringListValuesIdx++ << "=" << StringUtils::URLEncode(item.c_str()) << "&";
+        oStream << location << ".StringListValue." << stringListValuesIdx++ << "=" << StringUtils::URLEncoded(item) << "&";
       }
   }
   if(m_binaryListValuesHasBeenSet)
@@ -161,12 +161,12 @@ void MessageAttributeValue::OutputToStream(Aws::OStream& oStream, const char* lo
       unsigned binaryListValuesIdx = 1;
       for(auto& item : m_binaryListValues)
       {
-        oStream << location << ".BinaryListValue." << binaryListValuesIdx++ << "=" << StringUtils::URLEncode(HashingUtils::Base64Encode(item).c_str()) << "&";
+        oStream << location << ".BinaryListValue." << binaryListValuesIdx++ << "=" << StringUtils::URLEncoded(HashingUtils::Base64Encode(item)) << "&";
       }
   }
   if(m_dataTypeHasBeenSet)
   {
-      oStream << location << ".DataType=" << StringUtils::URLEncode(m_dataType.c_str()) << "&";
+      oStream << location << ".DataType=" << StringUtils::URLEncoded(m_dataType) << "&";
   }
 }
 
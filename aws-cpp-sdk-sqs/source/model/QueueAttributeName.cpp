@@ -29,101 +29,77 @@ namespace Aws
       namespace QueueAttributeNameMapper
       {
 
-        static const int All_HASH = HashingUtils::HashString("All");
-        static const int Policy_HASH = HashingUtils::HashString("Policy");
-        static const int VisibilityTimeout_HASH = HashingUtils::HashString("VisibilityTimeout");
-        static const int MaximumMessageSize_HASH = HashingUtils::HashString("MaximumMessageSize");
-        static const int MessageRetentionPeriod_HASH = HashingUtils::HashString("MessageRetentionPeriod");
-        static const int ApproximateNumberOfMessages_HASH = HashingUtils::HashString("ApproximateNumberOfMessages");
-        static const int ApproximateNumberOfMessagesNotVisible_HASH = HashingUtils::HashString("ApproximateNumberOfMessagesNotVisible");
-        static const int CreatedTimestamp_HASH = HashingUtils::HashString("CreatedTimestamp");
-        static const int LastModifiedTimestamp_HASH = HashingUtils::HashString("LastModifiedTimestamp");
-        static const int QueueArn_HASH = HashingUtils::HashString("QueueArn");
-        static const int ApproximateNumberOfMessagesDelayed_HASH = HashingUtils::HashString("ApproximateNumberOfMessagesDelayed");
-        static const int DelaySeconds_HASH = HashingUtils::HashString("DelaySeconds");
-        static const int ReceiveMessageWaitTimeSeconds_HASH = HashingUtils::HashString("ReceiveMessageWaitTimeSeconds");
-        static const int RedrivePolicy_HASH = HashingUtils::HashString("RedrivePolicy");
-        static const int SentTimestamp_HASH = HashingUtils::HashString("SentTimestamp");
-        static const int ApproximateFirstReceiveTimestamp_HASH = HashingUtils::HashString("ApproximateFirstReceiveTimestamp");
-        static const int ApproximateReceiveCount_HASH = HashingUtils::HashString("ApproximateReceiveCount");
-        static const int SenderId_HASH = HashingUtils::HashString("SenderId");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int All_HASH = 65921;
+        static const int Policy_HASH = -1898802862;
+        static const int VisibilityTimeout_HASH = 1969588687;
+        static const int MaximumMessageSize_HASH = -353398136;
+        static const int MessageRetentionPeriod_HASH = -1632737384;
+        static const int ApproximateNumberOfMessages_HASH = 1014811520;
+        static const int ApproximateNumberOfMessagesNotVisible_HASH = -424418881;
+        static const int CreatedTimestamp_HASH = -1423092946;
+        static const int LastModifiedTimestamp_HASH = -1675946953;
+        static const int QueueArn_HASH = -1099864148;
+        static const int ApproximateNumberOfMessagesDelayed_HASH = 1053838786;
+        static const int DelaySeconds_HASH = -127380580;
+        static const int ReceiveMessageWaitTimeSeconds_HASH = 148571609;
+        static const int RedrivePolicy_HASH = -2137215191;
+        static const int SentTimestamp_HASH = -2082950082;
+        static const int ApproximateFirstReceiveTimestamp_HASH = -1682884177;
+        static const int ApproximateReceiveCount_HASH = 615849216;
+        static const int SenderId_HASH = 1312607824;
 
 
         QueueAttributeName GetQueueAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == All_HASH)
+          switch (hashCode)
           {
+          case All_HASH:
             return QueueAttributeName::All;
-          }
-          else if (hashCode == Policy_HASH)
-          {
+          case Policy_HASH:
             return QueueAttributeName::Policy;
-          }
-          else if (hashCode == VisibilityTimeout_HASH)
-          {
+          case VisibilityTimeout_HASH:
             return QueueAttributeName::VisibilityTimeout;
-          }
-          else if (hashCode == MaximumMessageSize_HASH)
-          {
+          case MaximumMessageSize_HASH:
             return QueueAttributeName::MaximumMessageSize;
-          }
-          else if (hashCode == MessageRetentionPeriod_HASH)
-          {
+          case MessageRetentionPeriod_HASH:
             return QueueAttributeName::MessageRetentionPeriod;
-          }
-          else if (hashCode == ApproximateNumberOfMessages_HASH)
-          {
+          case ApproximateNumberOfMessages_HASH:
             return QueueAttributeName::ApproximateNumberOfMessages;
-          }
-          else if (hashCode == ApproximateNumberOfMessagesNotVisible_HASH)
-          {
+          case ApproximateNumberOfMessagesNotVisible_HASH:
             return QueueAttributeName::ApproximateNumberOfMessagesNotVisible;
-          }
-          else if (hashCode == CreatedTimestamp_HASH)
-          {
+          case CreatedTimestamp_HASH:
             return QueueAttributeName::CreatedTimestamp;
-          }
-          else if (hashCode == LastModifiedTimestamp_HASH)
-          {
+          case LastModifiedTimestamp_HASH:
             return QueueAttributeName::LastModifiedTimestamp;
-          }
-          else if (hashCode == QueueArn_HASH)
-          {
+          case QueueArn_HASH:
             return QueueAttributeName::QueueArn;
-          }
-          else if (hashCode == ApproximateNumberOfMessagesDelayed_HASH)
-          {
+          case ApproximateNumberOfMessagesDelayed_HASH:
             return QueueAttributeName::ApproximateNumberOfMessagesDelayed;
-          }
-          else if (hashCode == DelaySeconds_HASH)
-          {
+          case DelaySeconds_HASH:
             return QueueAttributeName::DelaySeconds;
-          }
-          else if (hashCode == ReceiveMessageWaitTimeSeconds_HASH)
-          {
+          case ReceiveMessageWaitTimeSeconds_HASH:
             return QueueAttributeName::ReceiveMessageWaitTimeSeconds;
-          }
-          else if (hashCode == RedrivePolicy_HASH)
-          {
+          case RedrivePolicy_HASH:
             return QueueAttributeName::RedrivePolicy;
-          }
-          else if (hashCode == SentTimestamp_HASH)
-          {
+          case SentTimestamp_HASH:
             return QueueAttributeName::SentTimestamp;
-          }
-          else if (hashCode == ApproximateFirstReceiveTimestamp_HASH)
-          {
+          case ApproximateFirstReceiveTimestamp_HASH:
             return QueueAttributeName::ApproximateFirstReceiveTimestamp;
-          }
-          else if (hashCode == ApproximateReceiveCount_HASH)
-          {
+          case ApproximateReceiveCount_HASH:
             return QueueAttributeName::ApproximateReceiveCount;
-          }
-          else if (hashCode == SenderId_HASH)
-          {
+          case SenderId_HASH:
             return QueueAttributeName::SenderId;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
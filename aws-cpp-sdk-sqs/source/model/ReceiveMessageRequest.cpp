@@ -15,6 +15,7 @@
 #include <aws/sqs/model/ReceiveMessageRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SQS::Model;
 using namespace Aws::Utils;
@@ -34,11 +35,11 @@ ReceiveMessageRequest::ReceiveMessageRequest() :
 
 Aws::String ReceiveMessageRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=ReceiveMessage&";
   if(m_queueUrlHasBeenSet)
   {
-    ss << "QueueUrl=" << StringUtils::URLEncode(m_queueUrl.c_str()) << "&";
+    ss << "QueueUrl=" << StringUtils::URLEncoded(m_queueUrl) << "&";
   }
 
   if(m_attributeNamesHasBeenSet)
@@ -47,7 +48,7 @@ Aws::String ReceiveMessageRequest::SerializePayload() const
     for(auto& item : m_attributeNames)
     {
       ss << "AttributeName." << attributeNamesCount << "="
-          << StringUtils::URLEncode(QueueAttributeNameMapper::GetNameForQueueAttributeName(item).c_str()) << "&";
+          << StringUtils::URLEncoded(QueueAttributeNameMapper::GetNameForQueueAttributeName(item)) << "&";
       attributeNamesCount++;
     }
   }
@@ -58,7 +59,7 @@ Aws::String ReceiveMessageRequest::SerializePayload() const
     for(auto& item : m_messageAttributeNames)
     {
       ss << "MessageAttributeName." << messageAttributeNamesCount << "="
-          << StringUtils::URLEncode(item.c_str()) << "&";
+          << StringUtils::URLEncoded(item) << "&";
       messageAttributeNamesCount++;
     }
   }
@@ -79,6 +80,6 @@ Aws::String ReceiveMessageRequest::SerializePayload() const
   }
 
   ss << "Version=2012-11-05";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ ReceiveMessageResult& ReceiveMessageResult::operator =(const AmazonWebServiceRes
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "ReceiveMessageResult")
+  if (rootNode.GetNameView() != "ReceiveMessageResult")
   {
     resultNode = rootNode.FirstChild("ReceiveMessageResult");
   }
@@ -16,6 +16,7 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 #include <utility>
 
@@ -57,19 +58,19 @@ SendMessageBatchRequestEntry& SendMessageBatchRequestEntry::operator =(const Xml
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode messageBodyNode = resultNode.FirstChild("MessageBody");
     if(!messageBodyNode.IsNull())
     {
-      m_messageBody = StringUtils::Trim(messageBodyNode.GetText().c_str());
+      m_messageBody = messageBodyNode.GetTextView().Trim().ToString();
       m_messageBodyHasBeenSet = true;
     }
     XmlNode delaySecondsNode = resultNode.FirstChild("DelaySeconds");
     if(!delaySecondsNode.IsNull())
     {
-      m_delaySeconds = StringUtils::ConvertToInt32(StringUtils::Trim(delaySecondsNode.GetText().c_str()).c_str());
+      m_delaySeconds = StringUtils::ConvertToInt32(delaySecondsNode.GetTextView().Trim().ToString().c_str());
       m_delaySecondsHasBeenSet = true;
     }
     XmlNode messageAttributesNode = resultNode.FirstChild("MessageAttribute");
@@ -80,7 +81,7 @@ SendMessageBatchRequestEntry& SendMessageBatchRequestEntry::operator =(const Xml
       {
         XmlNode keyNode = messageAttributeEntry.FirstChild("Name");
         XmlNode valueNode = messageAttributeEntry.FirstChild("Value");
-        m_messageAttributes[StringUtils::Trim(keyNode.GetText().c_str())] =
+        m_messageAttributes[keyNode.GetTextView().Trim().ToString()] =
             valueNode;
         messageAttributeEntry = messageAttributeEntry.NextNode("MessageAttribute");
       }
@@ -96,12 +97,12 @@ void SendMessageBatchRequestEntry::OutputToStream(Aws::OStream& oStream, const c
 {
   if(m_idHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
 
   if(m_messageBodyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MessageBody=" << StringUtils::URLEncode(m_messageBody.c_str()) << "&";
+      oStream << location << index << locationValue << ".MessageBody=" << StringUtils::URLEncoded(m_messageBody) << "&";
   }
 
   if(m_delaySecondsHasBeenSet)
@@ -115,10 +116,10 @@ void SendMessageBatchRequestEntry::OutputToStream(Aws::OStream& oStream, const c
       for(auto& item : m_messageAttributes)
       {
         oStream << location << index << locationValue << ".MessageAttribute." << messageAttributesIdx << ".Name="
-            << StringUtils::URLEncode(item.first.c_str()) << "&";
-        Aws::StringStream messageAttributesSs;
+            << StringUtils::URLEncoded(item.first) << "&";
+        Aws::Utils::Stream::StringOutputStream messageAttributesSs;
         messageAttributesSs << location << index << locationValue << ".MessageAttribute." << messageAttributesIdx << ".Value";
-        item.second.OutputToStream(oStream, messageAttributesSs.str().c_str());
+        item.second.OutputToStream(oStream, messageAttributesSs.GetString().c_str());
         messageAttributesIdx++;
       }
   }
@@ -129,11 +130,11 @@ void SendMessageBatchRequestEntry::OutputToStream(Aws::OStream& oStream, const c
 {
   if(m_idHasBeenSet)
   {
-      oStream << location << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
   if(m_messageBodyHasBeenSet)
   {
-      oStream << location << ".MessageBody=" << StringUtils::URLEncode(m_messageBody.c_str()) << "&";
+      oStream << location << ".MessageBody=" << StringUtils::URLEncoded(m_messageBody) << "&";
   }
   if(m_delaySecondsHasBeenSet)
   {
@@ -145,10 +146,10 @@ void SendMessageBatchRequestEntry::OutputToStream(Aws::OStream& oStream, const c
       for(auto& item : m_messageAttributes)
       {
         oStream << location << ".MessageAttribute."  << messageAttributesIdx << ".Name="
-            << StringUtils::URLEncode(item.first.c_str()) << "&";
-        Aws::StringStream messageAttributesSs;
+            << StringUtils::URLEncoded(item.first) << "&";
+        Aws::Utils::Stream::StringOutputStream messageAttributesSs;
         messageAttributesSs << location << ".MessageAttribute." << messageAttributesIdx << ".Value";
-        item.second.OutputToStream(oStream, messageAttributesSs.str().c_str());
+        item.second.OutputToStream(oStream, messageAttributesSs.GetString().c_str());
         messageAttributesIdx++;
       }
 
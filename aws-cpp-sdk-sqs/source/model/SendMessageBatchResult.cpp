@@ -40,7 +40,7 @@ SendMessageBatchResult& SendMessageBatchResult::operator =(const AmazonWebServic
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SendMessageBatchResult")
+  if (rootNode.GetNameView() != "SendMessageBatchResult")
   {
     resultNode = rootNode.FirstChild("SendMessageBatchResult");
   }
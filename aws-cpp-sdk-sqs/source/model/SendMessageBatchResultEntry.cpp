@@ -55,25 +55,25 @@ SendMessageBatchResultEntry& SendMessageBatchResultEntry::operator =(const XmlNo
     XmlNode idNode = resultNode.FirstChild("Id");
     if(!idNode.IsNull())
     {
-      m_id = StringUtils::Trim(idNode.GetText().c_str());
+      m_id = idNode.GetTextView().Trim().ToString();
       m_idHasBeenSet = true;
     }
     XmlNode messageIdNode = resultNode.FirstChild("MessageId");
     if(!messageIdNode.IsNull())
     {
-      m_messageId = StringUtils::Trim(messageIdNode.GetText().c_str());
+      m_messageId = messageIdNode.GetTextView().Trim().ToString();
       m_messageIdHasBeenSet = true;
     }
     XmlNode mD5OfMessageBodyNode = resultNode.FirstChild("MD5OfMessageBody");
     if(!mD5OfMessageBodyNode.IsNull())
     {
-      m_mD5OfMessageBody = StringUtils::Trim(mD5OfMessageBodyNode.GetText().c_str());
+      m_mD5OfMessageBody = mD5OfMessageBodyNode.GetTextView().Trim().ToString();
       m_mD5OfMessageBodyHasBeenSet = true;
     }
     XmlNode mD5OfMessageAttributesNode = resultNode.FirstChild("MD5OfMessageAttributes");
     if(!mD5OfMessageAttributesNode.IsNull())
     {
-      m_mD5OfMessageAttributes = StringUtils::Trim(mD5OfMessageAttributesNode.GetText().c_str());
+      m_mD5OfMessageAttributes = mD5OfMessageAttributesNode.GetTextView().Trim().ToString();
       m_mD5OfMessageAttributesHasBeenSet = true;
     }
   }
@@ -85,22 +85,22 @@ void SendMessageBatchResultEntry::OutputToStream(Aws::OStream& oStream, const ch
 {
   if(m_idHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << index << locationValue << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
 
   if(m_messageIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MessageId=" << StringUtils::URLEncode(m_messageId.c_str()) << "&";
+      oStream << location << index << locationValue << ".MessageId=" << StringUtils::URLEncoded(m_messageId) << "&";
   }
 
   if(m_mD5OfMessageBodyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MD5OfMessageBody=" << StringUtils::URLEncode(m_mD5OfMessageBody.c_str()) << "&";
+      oStream << location << index << locationValue << ".MD5OfMessageBody=" << StringUtils::URLEncoded(m_mD5OfMessageBody) << "&";
   }
 
   if(m_mD5OfMessageAttributesHasBeenSet)
   {
-      oStream << location << index << locationValue << ".MD5OfMessageAttributes=" << StringUtils::URLEncode(m_mD5OfMessageAttributes.c_str()) << "&";
+      oStream << location << index << locationValue << ".MD5OfMessageAttributes=" << StringUtils::URLEncoded(m_mD5OfMessageAttributes) << "&";
   }
 
 }
@@ -109,19 +109,19 @@ void SendMessageBatchResultEntry::OutputToStream(Aws::OStream& oStream, const ch
 {
   if(m_idHasBeenSet)
   {
-      oStream << location << ".Id=" << StringUtils::URLEncode(m_id.c_str()) << "&";
+      oStream << location << ".Id=" << StringUtils::URLEncoded(m_id) << "&";
   }
   if(m_messageIdHasBeenSet)
   {
-      oStream << location << ".MessageId=" << StringUtils::URLEncode(m_messageId.c_str()) << "&";
+      oStream << location << ".MessageId=" << StringUtils::URLEncoded(m_messageId) << "&";
   }
   if(m_mD5OfMessageBodyHasBeenSet)
   {
-      oStream << location << ".MD5OfMessageBody=" << StringUtils::URLEncode(m_mD5OfMessageBody.c_str()) << "&";
+      oStream << location << ".MD5OfMessageBody=" << StringUtils::URLEncoded(m_mD5OfMessageBody) << "&";
   }
   if(m_mD5OfMessageAttributesHasBeenSet)
   {
-      oStream << location << ".MD5OfMessageAttributes=" << StringUtils::URLEncode(m_mD5OfMessageAttributes.c_str()) << "&";
+      oStream << location << ".MD5OfMessageAttributes=" << StringUtils::URLEncoded(m_mD5OfMessageAttributes) << "&";
   }
 }
 
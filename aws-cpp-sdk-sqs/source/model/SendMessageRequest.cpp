@@ -15,6 +15,7 @@
 #include <aws/sqs/model/SendMessageRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::SQS::Model;
 using namespace Aws::Utils;
@@ -30,16 +31,16 @@ SendMessageRequest::SendMessageRequest() :
 
 Aws::String SendMessageRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=SendMessage&";
   if(m_queueUrlHasBeenSet)
   {
-    ss << "QueueUrl=" << StringUtils::URLEncode(m_queueUrl.c_str()) << "&";
+    ss << "QueueUrl=" << StringUtils::URLEncoded(m_queueUrl) << "&";
   }
 
   if(m_messageBodyHasBeenSet)
   {
-    ss << "MessageBody=" << StringUtils::URLEncode(m_messageBody.c_str()) << "&";
+    ss << "MessageBody=" << StringUtils::URLEncoded(m_messageBody) << "&";
   }
 
   if(m_delaySecondsHasBeenSet)
@@ -53,13 +54,13 @@ Aws::String SendMessageRequest::SerializePayload() const
     for(auto& item : m_messageAttributes)
     {
       ss << "MessageAttribute." << messageAttributesCount << ".Name="
-          << StringUtils::URLEncode(item.first.c_str()) << "&";
+          << StringUtils::URLEncoded(item.first) << "&";
       item.second.OutputToStream(ss, "MessageAttribute.", messageAttributesCount, ".Value");
       messageAttributesCount++;
     }
   }
 
   ss << "Version=2012-11-05";
-  return ss.str();
+  return ss.TakeString();
 }
 
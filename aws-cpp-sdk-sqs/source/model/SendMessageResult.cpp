@@ -40,7 +40,7 @@ SendMessageResult& SendMessageResult::operator =(const AmazonWebServiceResult<Xm
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "SendMessageResult")
+  if (rootNode.GetNameView() != "SendMessageResult")
   {
     resultNode = rootNode.FirstChild("SendMessageResult");
   }
@@ -50,17 +50,17 @@ SendMessageResult& SendMessageResult::operator =(const AmazonWebServiceResult<Xm
     XmlNode mD5OfMessageBodyNode = resultNode.FirstChild("MD5OfMessageBody");
     if(!mD5OfMessageBodyNode.IsNull())
     {
-      m_mD5OfMessageBody = StringUtils::Trim(mD5OfMessageBodyNode.GetText().c_str());
+      m_mD5OfMessageBody = mD5OfMessageBodyNode.GetTextView().Trim().ToString();
     }
     XmlNode mD5OfMessageAttributesNode = resultNode.FirstChild("MD5OfMessageAttributes");
     if(!mD5OfMessageAttributesNode.IsNull())
     {
-      m_mD5OfMessageAttributes = StringUtils::Trim(mD5OfMessageAttributesNode.GetText().c_str());
+      m_mD5OfMessageAttributes = mD5OfMessageAttributesNode.GetTextView().Trim().ToString();
     }
     XmlNode messageIdNode = resultNode.FirstChild("MessageId");
     if(!messageIdNode.IsNull())
     {
-      m_messageId = StringUtils::Trim(messageIdNode.GetText().c_str());
+      m_messageId = messageIdNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -47,6 +47,9 @@
 #include <aws/ssm/model/UpdateAssociationStatusResult.h>
 #include <aws/ssm/model/UpdateManagedInstanceRoleResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -392,6 +395,18 @@ namespace Model
          */
         virtual void AddTagsToResourceAsync(const Model::AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToResourceCallable(const Model::AddTagsToResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsToResourceOutcomeCallable AddTagsToResourceCallable(Model::AddTagsToResourceRequest&& request) const;
+
+        /**
+         * Same as AddTagsToResourceAsync(const Model::AddTagsToResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsToResourceAsync(Model::AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attempts to cancel the command specified by the Command ID. There is no
          * guarantee that the command will be terminated and the underlying process
@@ -417,6 +432,18 @@ namespace Model
          */
         virtual void CancelCommandAsync(const Model::CancelCommandRequest& request, const CancelCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelCommandCallable(const Model::CancelCommandRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelCommandOutcomeCallable CancelCommandCallable(Model::CancelCommandRequest&& request) const;
+
+        /**
+         * Same as CancelCommandAsync(const Model::CancelCommandRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelCommandAsync(Model::CancelCommandRequest&& request, const CancelCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers your on-premises server or virtual machine with Amazon EC2 so that
          * you can manage these resources using Run Command. An on-premises server or
@@ -457,6 +484,18 @@ namespace Model
          */
         virtual void CreateActivationAsync(const Model::CreateActivationRequest& request, const CreateActivationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateActivationCallable(const Model::CreateActivationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateActivationOutcomeCallable CreateActivationCallable(Model::CreateActivationRequest&& request) const;
+
+        /**
+         * Same as CreateActivationAsync(const Model::CreateActivationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateActivationAsync(Model::CreateActivationRequest&& request, const CreateActivationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates the specified SSM document with the specified instance.</p>
          * <p>When you associate an SSM document with an instance, the configuration agent
@@ -491,6 +530,18 @@ namespace Model
          */
         virtual void CreateAssociationAsync(const Model::CreateAssociationRequest& request, const CreateAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAssociationCallable(const Model::CreateAssociationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateAssociationOutcomeCallable CreateAssociationCallable(Model::CreateAssociationRequest&& request) const;
+
+        /**
+         * Same as CreateAssociationAsync(const Model::CreateAssociationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateAssociationAsync(Model::CreateAssociationRequest&& request, const CreateAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates the specified SSM document with the specified instances.</p>
          * <p>When you associate an SSM document with an instance, the configuration agent
@@ -525,6 +576,18 @@ namespace Model
          */
         virtual void CreateAssociationBatchAsync(const Model::CreateAssociationBatchRequest& request, const CreateAssociationBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAssociationBatchCallable(const Model::CreateAssociationBatchRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateAssociationBatchOutcomeCallable CreateAssociationBatchCallable(Model::CreateAssociationBatchRequest&& request) const;
+
+        /**
+         * Same as CreateAssociationBatchAsync(const Model::CreateAssociationBatchRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateAssociationBatchAsync(Model::CreateAssociationBatchRequest&& request, const CreateAssociationBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an SSM document.</p> <p>After you create an SSM document, you can use
          * CreateAssociation to associate it with one or more running instances.</p>
@@ -547,6 +610,18 @@ namespace Model
          */
         virtual void CreateDocumentAsync(const Model::CreateDocumentRequest& request, const CreateDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDocumentCallable(const Model::CreateDocumentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateDocumentOutcomeCallable CreateDocumentCallable(Model::CreateDocumentRequest&& request) const;
+
+        /**
+         * Same as CreateDocumentAsync(const Model::CreateDocumentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateDocumentAsync(Model::CreateDocumentRequest&& request, const CreateDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an activation. You are not required to delete an activation. If you
          * delete an activation, you can no longer use it to register additional managed
@@ -575,6 +650,18 @@ namespace Model
          */
         virtual void DeleteActivationAsync(const Model::DeleteActivationRequest& request, const DeleteActivationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteActivationCallable(const Model::DeleteActivationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteActivationOutcomeCallable DeleteActivationCallable(Model::DeleteActivationRequest&& request) const;
+
+        /**
+         * Same as DeleteActivationAsync(const Model::DeleteActivationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteActivationAsync(Model::DeleteActivationRequest&& request, const DeleteActivationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disassociates the specified SSM document from the specified instance.</p>
          * <p>When you disassociate an SSM document from an instance, it does not change
@@ -606,6 +693,18 @@ namespace Model
          */
         virtual void DeleteAssociationAsync(const Model::DeleteAssociationRequest& request, const DeleteAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAssociationCallable(const Model::DeleteAssociationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteAssociationOutcomeCallable DeleteAssociationCallable(Model::DeleteAssociationRequest&& request) const;
+
+        /**
+         * Same as DeleteAssociationAsync(const Model::DeleteAssociationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteAssociationAsync(Model::DeleteAssociationRequest&& request, const DeleteAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the SSM document and all instance associations to the document.</p>
          * <p>Before you delete the SSM document, we recommend that you use
@@ -634,6 +733,18 @@ namespace Model
          */
         virtual void DeleteDocumentAsync(const Model::DeleteDocumentRequest& request, const DeleteDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDocumentCallable(const Model::DeleteDocumentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteDocumentOutcomeCallable DeleteDocumentCallable(Model::DeleteDocumentRequest&& request) const;
+
+        /**
+         * Same as DeleteDocumentAsync(const Model::DeleteDocumentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteDocumentAsync(Model::DeleteDocumentRequest&& request, const DeleteDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the server or virtual machine from the list of registered servers.
          * You can reregister the instance again at any time. If you don’t plan to use Run
@@ -659,6 +770,18 @@ namespace Model
          */
         virtual void DeregisterManagedInstanceAsync(const Model::DeregisterManagedInstanceRequest& request, const DeregisterManagedInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterManagedInstanceCallable(const Model::DeregisterManagedInstanceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeregisterManagedInstanceOutcomeCallable DeregisterManagedInstanceCallable(Model::DeregisterManagedInstanceRequest&& request) const;
+
+        /**
+         * Same as DeregisterManagedInstanceAsync(const Model::DeregisterManagedInstanceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeregisterManagedInstanceAsync(Model::DeregisterManagedInstanceRequest&& request, const DeregisterManagedInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Details about the activation, including: the date and time the activation was
          * created, the expiration date, the IAM role assigned to the instances in the
@@ -684,6 +807,18 @@ namespace Model
          */
         virtual void DescribeActivationsAsync(const Model::DescribeActivationsRequest& request, const DescribeActivationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeActivationsCallable(const Model::DescribeActivationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeActivationsOutcomeCallable DescribeActivationsCallable(Model::DescribeActivationsRequest&& request) const;
+
+        /**
+         * Same as DescribeActivationsAsync(const Model::DescribeActivationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeActivationsAsync(Model::DescribeActivationsRequest&& request, const DescribeActivationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the associations for the specified SSM document or instance.</p>
          */
@@ -703,6 +838,18 @@ namespace Model
          */
         virtual void DescribeAssociationAsync(const Model::DescribeAssociationRequest& request, const DescribeAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAssociationCallable(const Model::DescribeAssociationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAssociationOutcomeCallable DescribeAssociationCallable(Model::DescribeAssociationRequest&& request) const;
+
+        /**
+         * Same as DescribeAssociationAsync(const Model::DescribeAssociationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAssociationAsync(Model::DescribeAssociationRequest&& request, const DescribeAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified SSM document.</p>
          */
@@ -722,6 +869,18 @@ namespace Model
          */
         virtual void DescribeDocumentAsync(const Model::DescribeDocumentRequest& request, const DescribeDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDocumentCallable(const Model::DescribeDocumentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDocumentOutcomeCallable DescribeDocumentCallable(Model::DescribeDocumentRequest&& request) const;
+
+        /**
+         * Same as DescribeDocumentAsync(const Model::DescribeDocumentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDocumentAsync(Model::DescribeDocumentRequest&& request, const DescribeDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the permissions for an SSM document. If you created the document,
          * you are the owner. If a document is shared, it can either be shared privately
@@ -747,6 +906,18 @@ namespace Model
          */
         virtual void DescribeDocumentPermissionAsync(const Model::DescribeDocumentPermissionRequest& request, const DescribeDocumentPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDocumentPermissionCallable(const Model::DescribeDocumentPermissionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDocumentPermissionOutcomeCallable DescribeDocumentPermissionCallable(Model::DescribeDocumentPermissionRequest&& request) const;
+
+        /**
+         * Same as DescribeDocumentPermissionAsync(const Model::DescribeDocumentPermissionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDocumentPermissionAsync(Model::DescribeDocumentPermissionRequest&& request, const DescribeDocumentPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your instances. You can use this to get information
          * about instances like the operating system platform, the SSM agent version,
@@ -781,6 +952,18 @@ namespace Model
          */
         virtual void DescribeInstanceInformationAsync(const Model::DescribeInstanceInformationRequest& request, const DescribeInstanceInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInstanceInformationCallable(const Model::DescribeInstanceInformationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeInstanceInformationOutcomeCallable DescribeInstanceInformationCallable(Model::DescribeInstanceInformationRequest&& request) const;
+
+        /**
+         * Same as DescribeInstanceInformationAsync(const Model::DescribeInstanceInformationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeInstanceInformationAsync(Model::DescribeInstanceInformationRequest&& request, const DescribeInstanceInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the contents of the specified SSM document.</p>
          */
@@ -800,6 +983,18 @@ namespace Model
          */
         virtual void GetDocumentAsync(const Model::GetDocumentRequest& request, const GetDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDocumentCallable(const Model::GetDocumentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetDocumentOutcomeCallable GetDocumentCallable(Model::GetDocumentRequest&& request) const;
+
+        /**
+         * Same as GetDocumentAsync(const Model::GetDocumentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetDocumentAsync(Model::GetDocumentRequest&& request, const GetDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the associations for the specified SSM document or instance.</p>
          */
@@ -819,6 +1014,18 @@ namespace Model
          */
         virtual void ListAssociationsAsync(const Model::ListAssociationsRequest& request, const ListAssociationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAssociationsCallable(const Model::ListAssociationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListAssociationsOutcomeCallable ListAssociationsCallable(Model::ListAssociationsRequest&& request) const;
+
+        /**
+         * Same as ListAssociationsAsync(const Model::ListAssociationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListAssociationsAsync(Model::ListAssociationsRequest&& request, const ListAssociationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>An invocation is copy of a command sent to a specific instance. A command can
          * apply to one or more instances. A command invocation applies to one instance.
@@ -850,6 +1057,18 @@ namespace Model
          */
         virtual void ListCommandInvocationsAsync(const Model::ListCommandInvocationsRequest& request, const ListCommandInvocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListCommandInvocationsCallable(const Model::ListCommandInvocationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListCommandInvocationsOutcomeCallable ListCommandInvocationsCallable(Model::ListCommandInvocationsRequest&& request) const;
+
+        /**
+         * Same as ListCommandInvocationsAsync(const Model::ListCommandInvocationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListCommandInvocationsAsync(Model::ListCommandInvocationsRequest&& request, const ListCommandInvocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the commands requested by users of the AWS account.</p>
          */
@@ -869,6 +1088,18 @@ namespace Model
          */
         virtual void ListCommandsAsync(const Model::ListCommandsRequest& request, const ListCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListCommandsCallable(const Model::ListCommandsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListCommandsOutcomeCallable ListCommandsCallable(Model::ListCommandsRequest&& request) const;
+
+        /**
+         * Same as ListCommandsAsync(const Model::ListCommandsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListCommandsAsync(Model::ListCommandsRequest&& request, const ListCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your SSM documents.</p>
          */
@@ -888,6 +1119,18 @@ namespace Model
          */
         virtual void ListDocumentsAsync(const Model::ListDocumentsRequest& request, const ListDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDocumentsCallable(const Model::ListDocumentsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDocumentsOutcomeCallable ListDocumentsCallable(Model::ListDocumentsRequest&& request) const;
+
+        /**
+         * Same as ListDocumentsAsync(const Model::ListDocumentsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDocumentsAsync(Model::ListDocumentsRequest&& request, const ListDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of the tags assigned to the specified resource.</p>
          */
@@ -907,6 +1150,18 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourceCallable(const Model::ListTagsForResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(Model::ListTagsForResourceRequest&& request) const;
+
+        /**
+         * Same as ListTagsForResourceAsync(const Model::ListTagsForResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsForResourceAsync(Model::ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Share a document publicly or privately. If you share a document privately,
          * you must specify the AWS user account IDs for those people who can use the
@@ -935,6 +1190,18 @@ namespace Model
          */
         virtual void ModifyDocumentPermissionAsync(const Model::ModifyDocumentPermissionRequest& request, const ModifyDocumentPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyDocumentPermissionCallable(const Model::ModifyDocumentPermissionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyDocumentPermissionOutcomeCallable ModifyDocumentPermissionCallable(Model::ModifyDocumentPermissionRequest&& request) const;
+
+        /**
+         * Same as ModifyDocumentPermissionAsync(const Model::ModifyDocumentPermissionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyDocumentPermissionAsync(Model::ModifyDocumentPermissionRequest&& request, const ModifyDocumentPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes all tags from the specified resource.</p>
          */
@@ -954,6 +1221,18 @@ namespace Model
          */
         virtual void RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromResourceCallable(const Model::RemoveTagsFromResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsFromResourceOutcomeCallable RemoveTagsFromResourceCallable(Model::RemoveTagsFromResourceRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsFromResourceAsync(Model::RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Executes commands on one or more remote instances.</p>
          */
@@ -973,6 +1252,18 @@ namespace Model
          */
         virtual void SendCommandAsync(const Model::SendCommandRequest& request, const SendCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SendCommandCallable(const Model::SendCommandRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SendCommandOutcomeCallable SendCommandCallable(Model::SendCommandRequest&& request) const;
+
+        /**
+         * Same as SendCommandAsync(const Model::SendCommandRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SendCommandAsync(Model::SendCommandRequest&& request, const SendCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the status of the SSM document associated with the specified
          * instance.</p>
@@ -995,6 +1286,18 @@ namespace Model
          */
         virtual void UpdateAssociationStatusAsync(const Model::UpdateAssociationStatusRequest& request, const UpdateAssociationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAssociationStatusCallable(const Model::UpdateAssociationStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateAssociationStatusOutcomeCallable UpdateAssociationStatusCallable(Model::UpdateAssociationStatusRequest&& request) const;
+
+        /**
+         * Same as UpdateAssociationStatusAsync(const Model::UpdateAssociationStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateAssociationStatusAsync(Model::UpdateAssociationStatusRequest&& request, const UpdateAssociationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Assigns or changes an Amazon Identity and Access Management (IAM) role to the
          * managed instance.</p>
@@ -1017,6 +1320,180 @@ namespace Model
          */
         virtual void UpdateManagedInstanceRoleAsync(const Model::UpdateManagedInstanceRoleRequest& request, const UpdateManagedInstanceRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateManagedInstanceRoleCallable(const Model::UpdateManagedInstanceRoleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateManagedInstanceRoleOutcomeCallable UpdateManagedInstanceRoleCallable(Model::UpdateManagedInstanceRoleRequest&& request) const;
+
+        /**
+         * Same as UpdateManagedInstanceRoleAsync(const Model::UpdateManagedInstanceRoleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateManagedInstanceRoleAsync(Model::UpdateManagedInstanceRoleRequest&& request, const UpdateManagedInstanceRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeActivations(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SSMClient, Model::DescribeActivationsRequest, Model::DescribeActivationsOutcome> DescribeActivationsPaginator(const Model::DescribeActivationsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeInstanceInformation(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SSMClient, Model::DescribeInstanceInformationRequest, Model::DescribeInstanceInformationOutcome> DescribeInstanceInformationPaginator(const Model::DescribeInstanceInformationRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListAssociations(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SSMClient, Model::ListAssociationsRequest, Model::ListAssociationsOutcome> ListAssociationsPaginator(const Model::ListAssociationsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListCommandInvocations(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SSMClient, Model::ListCommandInvocationsRequest, Model::ListCommandInvocationsOutcome> ListCommandInvocationsPaginator(const Model::ListCommandInvocationsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListCommands(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SSMClient, Model::ListCommandsRequest, Model::ListCommandsOutcome> ListCommandsPaginator(const Model::ListCommandsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListDocuments(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SSMClient, Model::ListDocumentsRequest, Model::ListDocumentsOutcome> ListDocumentsPaginator(const Model::ListDocumentsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddTagsToResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::AddTagsToResourceRequest, Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(Model::AddTagsToResourceRequest request) const;
+
+        /**
+         * co_await-able form of CancelCommand(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::CancelCommandRequest, Model::CancelCommandOutcome> CancelCommandAwaitable(Model::CancelCommandRequest request) const;
+
+        /**
+         * co_await-able form of CreateActivation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::CreateActivationRequest, Model::CreateActivationOutcome> CreateActivationAwaitable(Model::CreateActivationRequest request) const;
+
+        /**
+         * co_await-able form of CreateAssociation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::CreateAssociationRequest, Model::CreateAssociationOutcome> CreateAssociationAwaitable(Model::CreateAssociationRequest request) const;
+
+        /**
+         * co_await-able form of CreateAssociationBatch(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::CreateAssociationBatchRequest, Model::CreateAssociationBatchOutcome> CreateAssociationBatchAwaitable(Model::CreateAssociationBatchRequest request) const;
+
+        /**
+         * co_await-able form of CreateDocument(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::CreateDocumentRequest, Model::CreateDocumentOutcome> CreateDocumentAwaitable(Model::CreateDocumentRequest request) const;
+
+        /**
+         * co_await-able form of DeleteActivation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::DeleteActivationRequest, Model::DeleteActivationOutcome> DeleteActivationAwaitable(Model::DeleteActivationRequest request) const;
+
+        /**
+         * co_await-able form of DeleteAssociation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::DeleteAssociationRequest, Model::DeleteAssociationOutcome> DeleteAssociationAwaitable(Model::DeleteAssociationRequest request) const;
+
+        /**
+         * co_await-able form of DeleteDocument(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::DeleteDocumentRequest, Model::DeleteDocumentOutcome> DeleteDocumentAwaitable(Model::DeleteDocumentRequest request) const;
+
+        /**
+         * co_await-able form of DeregisterManagedInstance(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::DeregisterManagedInstanceRequest, Model::DeregisterManagedInstanceOutcome> DeregisterManagedInstanceAwaitable(Model::DeregisterManagedInstanceRequest request) const;
+
+        /**
+         * co_await-able form of DescribeActivations(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::DescribeActivationsRequest, Model::DescribeActivationsOutcome> DescribeActivationsAwaitable(Model::DescribeActivationsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAssociation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::DescribeAssociationRequest, Model::DescribeAssociationOutcome> DescribeAssociationAwaitable(Model::DescribeAssociationRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDocument(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::DescribeDocumentRequest, Model::DescribeDocumentOutcome> DescribeDocumentAwaitable(Model::DescribeDocumentRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDocumentPermission(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::DescribeDocumentPermissionRequest, Model::DescribeDocumentPermissionOutcome> DescribeDocumentPermissionAwaitable(Model::DescribeDocumentPermissionRequest request) const;
+
+        /**
+         * co_await-able form of DescribeInstanceInformation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::DescribeInstanceInformationRequest, Model::DescribeInstanceInformationOutcome> DescribeInstanceInformationAwaitable(Model::DescribeInstanceInformationRequest request) const;
+
+        /**
+         * co_await-able form of GetDocument(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::GetDocumentRequest, Model::GetDocumentOutcome> GetDocumentAwaitable(Model::GetDocumentRequest request) const;
+
+        /**
+         * co_await-able form of ListAssociations(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::ListAssociationsRequest, Model::ListAssociationsOutcome> ListAssociationsAwaitable(Model::ListAssociationsRequest request) const;
+
+        /**
+         * co_await-able form of ListCommandInvocations(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::ListCommandInvocationsRequest, Model::ListCommandInvocationsOutcome> ListCommandInvocationsAwaitable(Model::ListCommandInvocationsRequest request) const;
+
+        /**
+         * co_await-able form of ListCommands(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::ListCommandsRequest, Model::ListCommandsOutcome> ListCommandsAwaitable(Model::ListCommandsRequest request) const;
+
+        /**
+         * co_await-able form of ListDocuments(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::ListDocumentsRequest, Model::ListDocumentsOutcome> ListDocumentsAwaitable(Model::ListDocumentsRequest request) const;
+
+        /**
+         * co_await-able form of ListTagsForResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::ListTagsForResourceRequest, Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(Model::ListTagsForResourceRequest request) const;
+
+        /**
+         * co_await-able form of ModifyDocumentPermission(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::ModifyDocumentPermissionRequest, Model::ModifyDocumentPermissionOutcome> ModifyDocumentPermissionAwaitable(Model::ModifyDocumentPermissionRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTagsFromResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::RemoveTagsFromResourceRequest, Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(Model::RemoveTagsFromResourceRequest request) const;
+
+        /**
+         * co_await-able form of SendCommand(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::SendCommandRequest, Model::SendCommandOutcome> SendCommandAwaitable(Model::SendCommandRequest request) const;
+
+        /**
+         * co_await-able form of UpdateAssociationStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::UpdateAssociationStatusRequest, Model::UpdateAssociationStatusOutcome> UpdateAssociationStatusAwaitable(Model::UpdateAssociationStatusRequest request) const;
+
+        /**
+         * co_await-able form of UpdateManagedInstanceRole(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SSMClient, Model::UpdateManagedInstanceRoleRequest, Model::UpdateManagedInstanceRoleOutcome> UpdateManagedInstanceRoleAwaitable(Model::UpdateManagedInstanceRoleRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
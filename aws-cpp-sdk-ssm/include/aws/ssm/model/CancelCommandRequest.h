@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CancelCommandRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelCommand"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateActivationRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateActivation"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
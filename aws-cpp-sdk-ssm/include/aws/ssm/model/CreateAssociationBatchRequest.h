@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateAssociationBatchRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateAssociationBatch"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateAssociationRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateAssociation"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
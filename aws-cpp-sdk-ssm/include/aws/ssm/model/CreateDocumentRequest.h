@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateDocumentRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateDocument"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
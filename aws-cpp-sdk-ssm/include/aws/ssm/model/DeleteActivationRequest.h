@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteActivationRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteActivation"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
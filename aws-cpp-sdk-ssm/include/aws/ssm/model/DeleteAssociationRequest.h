@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteAssociationRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteAssociation"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
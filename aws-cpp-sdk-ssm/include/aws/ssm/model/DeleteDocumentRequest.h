@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteDocumentRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteDocument"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
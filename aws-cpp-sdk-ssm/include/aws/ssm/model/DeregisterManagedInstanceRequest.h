@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeregisterManagedInstanceRequest();
+    inline const char* GetServiceRequestName() const override { return "DeregisterManagedInstance"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeActivationsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeActivations"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
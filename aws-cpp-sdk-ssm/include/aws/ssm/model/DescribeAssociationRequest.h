@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeAssociationRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAssociation"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeDocumentPermissionRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDocumentPermission"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
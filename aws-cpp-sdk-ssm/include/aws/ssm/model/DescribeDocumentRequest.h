@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeDocumentRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDocument"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeInstanceInformationRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeInstanceInformation"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetDocumentRequest();
+    inline const char* GetServiceRequestName() const override { return "GetDocument"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
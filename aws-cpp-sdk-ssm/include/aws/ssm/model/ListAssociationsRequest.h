@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListAssociationsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListAssociations"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListCommandInvocationsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListCommandInvocations"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListCommandsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListCommands"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
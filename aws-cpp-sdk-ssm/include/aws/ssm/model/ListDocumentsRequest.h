@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListDocumentsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListDocuments"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListTagsForResourceRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTagsForResource"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ModifyDocumentPermissionRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyDocumentPermission"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
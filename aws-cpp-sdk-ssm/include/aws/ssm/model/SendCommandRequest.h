@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     SendCommandRequest();
+    inline const char* GetServiceRequestName() const override { return "SendCommand"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateAssociationStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateAssociationStatus"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateManagedInstanceRoleRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateManagedInstanceRole"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
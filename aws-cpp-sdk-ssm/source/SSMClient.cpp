@@ -135,7 +135,7 @@ AddTagsToResourceOutcome SSMClient::AddTagsToResource(const AddTagsToResourceReq
 
 AddTagsToResourceOutcomeCallable SSMClient::AddTagsToResourceCallable(const AddTagsToResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTagsToResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTagsToResource(request); } );
 }
 
 void SSMClient::AddTagsToResourceAsync(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -143,6 +143,16 @@ void SSMClient::AddTagsToResourceAsync(const AddTagsToResourceRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsToResourceAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsToResourceOutcomeCallable SSMClient::AddTagsToResourceCallable(AddTagsToResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::AddTagsToResource, this, std::move(request)));
+}
+
+void SSMClient::AddTagsToResourceAsync(AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::AddTagsToResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::AddTagsToResourceAsyncHelper(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTagsToResource(request), context);
@@ -166,7 +176,7 @@ CancelCommandOutcome SSMClient::CancelCommand(const CancelCommandRequest& reques
 
 CancelCommandOutcomeCallable SSMClient::CancelCommandCallable(const CancelCommandRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelCommand(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelCommand(request); } );
 }
 
 void SSMClient::CancelCommandAsync(const CancelCommandRequest& request, const CancelCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -174,6 +184,16 @@ void SSMClient::CancelCommandAsync(const CancelCommandRequest& request, const Ca
   m_executor->Submit( [this, request, handler, context](){ this->CancelCommandAsyncHelper( request, handler, context ); } );
 }
 
+CancelCommandOutcomeCallable SSMClient::CancelCommandCallable(CancelCommandRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::CancelCommand, this, std::move(request)));
+}
+
+void SSMClient::CancelCommandAsync(CancelCommandRequest&& request, const CancelCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::CancelCommandAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::CancelCommandAsyncHelper(const CancelCommandRequest& request, const CancelCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelCommand(request), context);
@@ -197,7 +217,7 @@ CreateActivationOutcome SSMClient::CreateActivation(const CreateActivationReques
 
 CreateActivationOutcomeCallable SSMClient::CreateActivationCallable(const CreateActivationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateActivation(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateActivation(request); } );
 }
 
 void SSMClient::CreateActivationAsync(const CreateActivationRequest& request, const CreateActivationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -205,6 +225,16 @@ void SSMClient::CreateActivationAsync(const CreateActivationRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->CreateActivationAsyncHelper( request, handler, context ); } );
 }
 
+CreateActivationOutcomeCallable SSMClient::CreateActivationCallable(CreateActivationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::CreateActivation, this, std::move(request)));
+}
+
+void SSMClient::CreateActivationAsync(CreateActivationRequest&& request, const CreateActivationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::CreateActivationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::CreateActivationAsyncHelper(const CreateActivationRequest& request, const CreateActivationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateActivation(request), context);
@@ -228,7 +258,7 @@ CreateAssociationOutcome SSMClient::CreateAssociation(const CreateAssociationReq
 
 CreateAssociationOutcomeCallable SSMClient::CreateAssociationCallable(const CreateAssociationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateAssociation(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateAssociation(request); } );
 }
 
 void SSMClient::CreateAssociationAsync(const CreateAssociationRequest& request, const CreateAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -236,6 +266,16 @@ void SSMClient::CreateAssociationAsync(const CreateAssociationRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->CreateAssociationAsyncHelper( request, handler, context ); } );
 }
 
+CreateAssociationOutcomeCallable SSMClient::CreateAssociationCallable(CreateAssociationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::CreateAssociation, this, std::move(request)));
+}
+
+void SSMClient::CreateAssociationAsync(CreateAssociationRequest&& request, const CreateAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::CreateAssociationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::CreateAssociationAsyncHelper(const CreateAssociationRequest& request, const CreateAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateAssociation(request), context);
@@ -259,7 +299,7 @@ CreateAssociationBatchOutcome SSMClient::CreateAssociationBatch(const CreateAsso
 
 CreateAssociationBatchOutcomeCallable SSMClient::CreateAssociationBatchCallable(const CreateAssociationBatchRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateAssociationBatch(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateAssociationBatch(request); } );
 }
 
 void SSMClient::CreateAssociationBatchAsync(const CreateAssociationBatchRequest& request, const CreateAssociationBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -267,6 +307,16 @@ void SSMClient::CreateAssociationBatchAsync(const CreateAssociationBatchRequest&
   m_executor->Submit( [this, request, handler, context](){ this->CreateAssociationBatchAsyncHelper( request, handler, context ); } );
 }
 
+CreateAssociationBatchOutcomeCallable SSMClient::CreateAssociationBatchCallable(CreateAssociationBatchRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::CreateAssociationBatch, this, std::move(request)));
+}
+
+void SSMClient::CreateAssociationBatchAsync(CreateAssociationBatchRequest&& request, const CreateAssociationBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::CreateAssociationBatchAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::CreateAssociationBatchAsyncHelper(const CreateAssociationBatchRequest& request, const CreateAssociationBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateAssociationBatch(request), context);
@@ -290,7 +340,7 @@ CreateDocumentOutcome SSMClient::CreateDocument(const CreateDocumentRequest& req
 
 CreateDocumentOutcomeCallable SSMClient::CreateDocumentCallable(const CreateDocumentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateDocument(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateDocument(request); } );
 }
 
 void SSMClient::CreateDocumentAsync(const CreateDocumentRequest& request, const CreateDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -298,6 +348,16 @@ void SSMClient::CreateDocumentAsync(const CreateDocumentRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->CreateDocumentAsyncHelper( request, handler, context ); } );
 }
 
+CreateDocumentOutcomeCallable SSMClient::CreateDocumentCallable(CreateDocumentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::CreateDocument, this, std::move(request)));
+}
+
+void SSMClient::CreateDocumentAsync(CreateDocumentRequest&& request, const CreateDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::CreateDocumentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::CreateDocumentAsyncHelper(const CreateDocumentRequest& request, const CreateDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateDocument(request), context);
@@ -321,7 +381,7 @@ DeleteActivationOutcome SSMClient::DeleteActivation(const DeleteActivationReques
 
 DeleteActivationOutcomeCallable SSMClient::DeleteActivationCallable(const DeleteActivationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteActivation(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteActivation(request); } );
 }
 
 void SSMClient::DeleteActivationAsync(const DeleteActivationRequest& request, const DeleteActivationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -329,6 +389,16 @@ void SSMClient::DeleteActivationAsync(const DeleteActivationRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DeleteActivationAsyncHelper( request, handler, context ); } );
 }
 
+DeleteActivationOutcomeCallable SSMClient::DeleteActivationCallable(DeleteActivationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::DeleteActivation, this, std::move(request)));
+}
+
+void SSMClient::DeleteActivationAsync(DeleteActivationRequest&& request, const DeleteActivationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::DeleteActivationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::DeleteActivationAsyncHelper(const DeleteActivationRequest& request, const DeleteActivationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteActivation(request), context);
@@ -352,7 +422,7 @@ DeleteAssociationOutcome SSMClient::DeleteAssociation(const DeleteAssociationReq
 
 DeleteAssociationOutcomeCallable SSMClient::DeleteAssociationCallable(const DeleteAssociationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteAssociation(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteAssociation(request); } );
 }
 
 void SSMClient::DeleteAssociationAsync(const DeleteAssociationRequest& request, const DeleteAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -360,6 +430,16 @@ void SSMClient::DeleteAssociationAsync(const DeleteAssociationRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DeleteAssociationAsyncHelper( request, handler, context ); } );
 }
 
+DeleteAssociationOutcomeCallable SSMClient::DeleteAssociationCallable(DeleteAssociationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::DeleteAssociation, this, std::move(request)));
+}
+
+void SSMClient::DeleteAssociationAsync(DeleteAssociationRequest&& request, const DeleteAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::DeleteAssociationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::DeleteAssociationAsyncHelper(const DeleteAssociationRequest& request, const DeleteAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteAssociation(request), context);
@@ -383,7 +463,7 @@ DeleteDocumentOutcome SSMClient::DeleteDocument(const DeleteDocumentRequest& req
 
 DeleteDocumentOutcomeCallable SSMClient::DeleteDocumentCallable(const DeleteDocumentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteDocument(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteDocument(request); } );
 }
 
 void SSMClient::DeleteDocumentAsync(const DeleteDocumentRequest& request, const DeleteDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -391,6 +471,16 @@ void SSMClient::DeleteDocumentAsync(const DeleteDocumentRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DeleteDocumentAsyncHelper( request, handler, context ); } );
 }
 
+DeleteDocumentOutcomeCallable SSMClient::DeleteDocumentCallable(DeleteDocumentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::DeleteDocument, this, std::move(request)));
+}
+
+void SSMClient::DeleteDocumentAsync(DeleteDocumentRequest&& request, const DeleteDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::DeleteDocumentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::DeleteDocumentAsyncHelper(const DeleteDocumentRequest& request, const DeleteDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteDocument(request), context);
@@ -414,7 +504,7 @@ DeregisterManagedInstanceOutcome SSMClient::DeregisterManagedInstance(const Dere
 
 DeregisterManagedInstanceOutcomeCallable SSMClient::DeregisterManagedInstanceCallable(const DeregisterManagedInstanceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeregisterManagedInstance(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeregisterManagedInstance(request); } );
 }
 
 void SSMClient::DeregisterManagedInstanceAsync(const DeregisterManagedInstanceRequest& request, const DeregisterManagedInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -422,6 +512,16 @@ void SSMClient::DeregisterManagedInstanceAsync(const DeregisterManagedInstanceRe
   m_executor->Submit( [this, request, handler, context](){ this->DeregisterManagedInstanceAsyncHelper( request, handler, context ); } );
 }
 
+DeregisterManagedInstanceOutcomeCallable SSMClient::DeregisterManagedInstanceCallable(DeregisterManagedInstanceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::DeregisterManagedInstance, this, std::move(request)));
+}
+
+void SSMClient::DeregisterManagedInstanceAsync(DeregisterManagedInstanceRequest&& request, const DeregisterManagedInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::DeregisterManagedInstanceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::DeregisterManagedInstanceAsyncHelper(const DeregisterManagedInstanceRequest& request, const DeregisterManagedInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeregisterManagedInstance(request), context);
@@ -445,7 +545,7 @@ DescribeActivationsOutcome SSMClient::DescribeActivations(const DescribeActivati
 
 DescribeActivationsOutcomeCallable SSMClient::DescribeActivationsCallable(const DescribeActivationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeActivations(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeActivations(request); } );
 }
 
 void SSMClient::DescribeActivationsAsync(const DescribeActivationsRequest& request, const DescribeActivationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -453,6 +553,16 @@ void SSMClient::DescribeActivationsAsync(const DescribeActivationsRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeActivationsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeActivationsOutcomeCallable SSMClient::DescribeActivationsCallable(DescribeActivationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::DescribeActivations, this, std::move(request)));
+}
+
+void SSMClient::DescribeActivationsAsync(DescribeActivationsRequest&& request, const DescribeActivationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::DescribeActivationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::DescribeActivationsAsyncHelper(const DescribeActivationsRequest& request, const DescribeActivationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeActivations(request), context);
@@ -476,7 +586,7 @@ DescribeAssociationOutcome SSMClient::DescribeAssociation(const DescribeAssociat
 
 DescribeAssociationOutcomeCallable SSMClient::DescribeAssociationCallable(const DescribeAssociationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAssociation(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAssociation(request); } );
 }
 
 void SSMClient::DescribeAssociationAsync(const DescribeAssociationRequest& request, const DescribeAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -484,6 +594,16 @@ void SSMClient::DescribeAssociationAsync(const DescribeAssociationRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAssociationAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAssociationOutcomeCallable SSMClient::DescribeAssociationCallable(DescribeAssociationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::DescribeAssociation, this, std::move(request)));
+}
+
+void SSMClient::DescribeAssociationAsync(DescribeAssociationRequest&& request, const DescribeAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::DescribeAssociationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::DescribeAssociationAsyncHelper(const DescribeAssociationRequest& request, const DescribeAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAssociation(request), context);
@@ -507,7 +627,7 @@ DescribeDocumentOutcome SSMClient::DescribeDocument(const DescribeDocumentReques
 
 DescribeDocumentOutcomeCallable SSMClient::DescribeDocumentCallable(const DescribeDocumentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDocument(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDocument(request); } );
 }
 
 void SSMClient::DescribeDocumentAsync(const DescribeDocumentRequest& request, const DescribeDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -515,6 +635,16 @@ void SSMClient::DescribeDocumentAsync(const DescribeDocumentRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDocumentAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDocumentOutcomeCallable SSMClient::DescribeDocumentCallable(DescribeDocumentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::DescribeDocument, this, std::move(request)));
+}
+
+void SSMClient::DescribeDocumentAsync(DescribeDocumentRequest&& request, const DescribeDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::DescribeDocumentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::DescribeDocumentAsyncHelper(const DescribeDocumentRequest& request, const DescribeDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDocument(request), context);
@@ -538,7 +668,7 @@ DescribeDocumentPermissionOutcome SSMClient::DescribeDocumentPermission(const De
 
 DescribeDocumentPermissionOutcomeCallable SSMClient::DescribeDocumentPermissionCallable(const DescribeDocumentPermissionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDocumentPermission(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDocumentPermission(request); } );
 }
 
 void SSMClient::DescribeDocumentPermissionAsync(const DescribeDocumentPermissionRequest& request, const DescribeDocumentPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -546,6 +676,16 @@ void SSMClient::DescribeDocumentPermissionAsync(const DescribeDocumentPermission
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDocumentPermissionAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDocumentPermissionOutcomeCallable SSMClient::DescribeDocumentPermissionCallable(DescribeDocumentPermissionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::DescribeDocumentPermission, this, std::move(request)));
+}
+
+void SSMClient::DescribeDocumentPermissionAsync(DescribeDocumentPermissionRequest&& request, const DescribeDocumentPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::DescribeDocumentPermissionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::DescribeDocumentPermissionAsyncHelper(const DescribeDocumentPermissionRequest& request, const DescribeDocumentPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDocumentPermission(request), context);
@@ -569,7 +709,7 @@ DescribeInstanceInformationOutcome SSMClient::DescribeInstanceInformation(const
 
 DescribeInstanceInformationOutcomeCallable SSMClient::DescribeInstanceInformationCallable(const DescribeInstanceInformationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeInstanceInformation(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeInstanceInformation(request); } );
 }
 
 void SSMClient::DescribeInstanceInformationAsync(const DescribeInstanceInformationRequest& request, const DescribeInstanceInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -577,6 +717,16 @@ void SSMClient::DescribeInstanceInformationAsync(const DescribeInstanceInformati
   m_executor->Submit( [this, request, handler, context](){ this->DescribeInstanceInformationAsyncHelper( request, handler, context ); } );
 }
 
+DescribeInstanceInformationOutcomeCallable SSMClient::DescribeInstanceInformationCallable(DescribeInstanceInformationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::DescribeInstanceInformation, this, std::move(request)));
+}
+
+void SSMClient::DescribeInstanceInformationAsync(DescribeInstanceInformationRequest&& request, const DescribeInstanceInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::DescribeInstanceInformationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::DescribeInstanceInformationAsyncHelper(const DescribeInstanceInformationRequest& request, const DescribeInstanceInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeInstanceInformation(request), context);
@@ -600,7 +750,7 @@ GetDocumentOutcome SSMClient::GetDocument(const GetDocumentRequest& request) con
 
 GetDocumentOutcomeCallable SSMClient::GetDocumentCallable(const GetDocumentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetDocument(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetDocument(request); } );
 }
 
 void SSMClient::GetDocumentAsync(const GetDocumentRequest& request, const GetDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -608,6 +758,16 @@ void SSMClient::GetDocumentAsync(const GetDocumentRequest& request, const GetDoc
   m_executor->Submit( [this, request, handler, context](){ this->GetDocumentAsyncHelper( request, handler, context ); } );
 }
 
+GetDocumentOutcomeCallable SSMClient::GetDocumentCallable(GetDocumentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::GetDocument, this, std::move(request)));
+}
+
+void SSMClient::GetDocumentAsync(GetDocumentRequest&& request, const GetDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::GetDocumentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::GetDocumentAsyncHelper(const GetDocumentRequest& request, const GetDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetDocument(request), context);
@@ -631,7 +791,7 @@ ListAssociationsOutcome SSMClient::ListAssociations(const ListAssociationsReques
 
 ListAssociationsOutcomeCallable SSMClient::ListAssociationsCallable(const ListAssociationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListAssociations(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListAssociations(request); } );
 }
 
 void SSMClient::ListAssociationsAsync(const ListAssociationsRequest& request, const ListAssociationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -639,6 +799,16 @@ void SSMClient::ListAssociationsAsync(const ListAssociationsRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->ListAssociationsAsyncHelper( request, handler, context ); } );
 }
 
+ListAssociationsOutcomeCallable SSMClient::ListAssociationsCallable(ListAssociationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::ListAssociations, this, std::move(request)));
+}
+
+void SSMClient::ListAssociationsAsync(ListAssociationsRequest&& request, const ListAssociationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::ListAssociationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::ListAssociationsAsyncHelper(const ListAssociationsRequest& request, const ListAssociationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListAssociations(request), context);
@@ -662,7 +832,7 @@ ListCommandInvocationsOutcome SSMClient::ListCommandInvocations(const ListComman
 
 ListCommandInvocationsOutcomeCallable SSMClient::ListCommandInvocationsCallable(const ListCommandInvocationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListCommandInvocations(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListCommandInvocations(request); } );
 }
 
 void SSMClient::ListCommandInvocationsAsync(const ListCommandInvocationsRequest& request, const ListCommandInvocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -670,6 +840,16 @@ void SSMClient::ListCommandInvocationsAsync(const ListCommandInvocationsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ListCommandInvocationsAsyncHelper( request, handler, context ); } );
 }
 
+ListCommandInvocationsOutcomeCallable SSMClient::ListCommandInvocationsCallable(ListCommandInvocationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::ListCommandInvocations, this, std::move(request)));
+}
+
+void SSMClient::ListCommandInvocationsAsync(ListCommandInvocationsRequest&& request, const ListCommandInvocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::ListCommandInvocationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::ListCommandInvocationsAsyncHelper(const ListCommandInvocationsRequest& request, const ListCommandInvocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListCommandInvocations(request), context);
@@ -693,7 +873,7 @@ ListCommandsOutcome SSMClient::ListCommands(const ListCommandsRequest& request)
 
 ListCommandsOutcomeCallable SSMClient::ListCommandsCallable(const ListCommandsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListCommands(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListCommands(request); } );
 }
 
 void SSMClient::ListCommandsAsync(const ListCommandsRequest& request, const ListCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -701,6 +881,16 @@ void SSMClient::ListCommandsAsync(const ListCommandsRequest& request, const List
   m_executor->Submit( [this, request, handler, context](){ this->ListCommandsAsyncHelper( request, handler, context ); } );
 }
 
+ListCommandsOutcomeCallable SSMClient::ListCommandsCallable(ListCommandsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::ListCommands, this, std::move(request)));
+}
+
+void SSMClient::ListCommandsAsync(ListCommandsRequest&& request, const ListCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::ListCommandsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::ListCommandsAsyncHelper(const ListCommandsRequest& request, const ListCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListCommands(request), context);
@@ -724,7 +914,7 @@ ListDocumentsOutcome SSMClient::ListDocuments(const ListDocumentsRequest& reques
 
 ListDocumentsOutcomeCallable SSMClient::ListDocumentsCallable(const ListDocumentsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDocuments(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDocuments(request); } );
 }
 
 void SSMClient::ListDocumentsAsync(const ListDocumentsRequest& request, const ListDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -732,6 +922,16 @@ void SSMClient::ListDocumentsAsync(const ListDocumentsRequest& request, const Li
   m_executor->Submit( [this, request, handler, context](){ this->ListDocumentsAsyncHelper( request, handler, context ); } );
 }
 
+ListDocumentsOutcomeCallable SSMClient::ListDocumentsCallable(ListDocumentsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::ListDocuments, this, std::move(request)));
+}
+
+void SSMClient::ListDocumentsAsync(ListDocumentsRequest&& request, const ListDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::ListDocumentsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::ListDocumentsAsyncHelper(const ListDocumentsRequest& request, const ListDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDocuments(request), context);
@@ -755,7 +955,7 @@ ListTagsForResourceOutcome SSMClient::ListTagsForResource(const ListTagsForResou
 
 ListTagsForResourceOutcomeCallable SSMClient::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTagsForResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTagsForResource(request); } );
 }
 
 void SSMClient::ListTagsForResourceAsync(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -763,6 +963,16 @@ void SSMClient::ListTagsForResourceAsync(const ListTagsForResourceRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsForResourceAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsForResourceOutcomeCallable SSMClient::ListTagsForResourceCallable(ListTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::ListTagsForResource, this, std::move(request)));
+}
+
+void SSMClient::ListTagsForResourceAsync(ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::ListTagsForResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTagsForResource(request), context);
@@ -786,7 +996,7 @@ ModifyDocumentPermissionOutcome SSMClient::ModifyDocumentPermission(const Modify
 
 ModifyDocumentPermissionOutcomeCallable SSMClient::ModifyDocumentPermissionCallable(const ModifyDocumentPermissionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyDocumentPermission(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyDocumentPermission(request); } );
 }
 
 void SSMClient::ModifyDocumentPermissionAsync(const ModifyDocumentPermissionRequest& request, const ModifyDocumentPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -794,6 +1004,16 @@ void SSMClient::ModifyDocumentPermissionAsync(const ModifyDocumentPermissionRequ
   m_executor->Submit( [this, request, handler, context](){ this->ModifyDocumentPermissionAsyncHelper( request, handler, context ); } );
 }
 
+ModifyDocumentPermissionOutcomeCallable SSMClient::ModifyDocumentPermissionCallable(ModifyDocumentPermissionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::ModifyDocumentPermission, this, std::move(request)));
+}
+
+void SSMClient::ModifyDocumentPermissionAsync(ModifyDocumentPermissionRequest&& request, const ModifyDocumentPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::ModifyDocumentPermissionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::ModifyDocumentPermissionAsyncHelper(const ModifyDocumentPermissionRequest& request, const ModifyDocumentPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyDocumentPermission(request), context);
@@ -817,7 +1037,7 @@ RemoveTagsFromResourceOutcome SSMClient::RemoveTagsFromResource(const RemoveTags
 
 RemoveTagsFromResourceOutcomeCallable SSMClient::RemoveTagsFromResourceCallable(const RemoveTagsFromResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTagsFromResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTagsFromResource(request); } );
 }
 
 void SSMClient::RemoveTagsFromResourceAsync(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -825,6 +1045,16 @@ void SSMClient::RemoveTagsFromResourceAsync(const RemoveTagsFromResourceRequest&
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsFromResourceAsyncHelper( request, handler, context ); } );
 }
 
+RemoveTagsFromResourceOutcomeCallable SSMClient::RemoveTagsFromResourceCallable(RemoveTagsFromResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::RemoveTagsFromResource, this, std::move(request)));
+}
+
+void SSMClient::RemoveTagsFromResourceAsync(RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::RemoveTagsFromResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::RemoveTagsFromResourceAsyncHelper(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RemoveTagsFromResource(request), context);
@@ -848,7 +1078,7 @@ SendCommandOutcome SSMClient::SendCommand(const SendCommandRequest& request) con
 
 SendCommandOutcomeCallable SSMClient::SendCommandCallable(const SendCommandRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SendCommand(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SendCommand(request); } );
 }
 
 void SSMClient::SendCommandAsync(const SendCommandRequest& request, const SendCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -856,6 +1086,16 @@ void SSMClient::SendCommandAsync(const SendCommandRequest& request, const SendCo
   m_executor->Submit( [this, request, handler, context](){ this->SendCommandAsyncHelper( request, handler, context ); } );
 }
 
+SendCommandOutcomeCallable SSMClient::SendCommandCallable(SendCommandRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::SendCommand, this, std::move(request)));
+}
+
+void SSMClient::SendCommandAsync(SendCommandRequest&& request, const SendCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::SendCommandAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::SendCommandAsyncHelper(const SendCommandRequest& request, const SendCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SendCommand(request), context);
@@ -879,7 +1119,7 @@ UpdateAssociationStatusOutcome SSMClient::UpdateAssociationStatus(const UpdateAs
 
 UpdateAssociationStatusOutcomeCallable SSMClient::UpdateAssociationStatusCallable(const UpdateAssociationStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateAssociationStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateAssociationStatus(request); } );
 }
 
 void SSMClient::UpdateAssociationStatusAsync(const UpdateAssociationStatusRequest& request, const UpdateAssociationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -887,6 +1127,16 @@ void SSMClient::UpdateAssociationStatusAsync(const UpdateAssociationStatusReques
   m_executor->Submit( [this, request, handler, context](){ this->UpdateAssociationStatusAsyncHelper( request, handler, context ); } );
 }
 
+UpdateAssociationStatusOutcomeCallable SSMClient::UpdateAssociationStatusCallable(UpdateAssociationStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::UpdateAssociationStatus, this, std::move(request)));
+}
+
+void SSMClient::UpdateAssociationStatusAsync(UpdateAssociationStatusRequest&& request, const UpdateAssociationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::UpdateAssociationStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::UpdateAssociationStatusAsyncHelper(const UpdateAssociationStatusRequest& request, const UpdateAssociationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateAssociationStatus(request), context);
@@ -910,7 +1160,7 @@ UpdateManagedInstanceRoleOutcome SSMClient::UpdateManagedInstanceRole(const Upda
 
 UpdateManagedInstanceRoleOutcomeCallable SSMClient::UpdateManagedInstanceRoleCallable(const UpdateManagedInstanceRoleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateManagedInstanceRole(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateManagedInstanceRole(request); } );
 }
 
 void SSMClient::UpdateManagedInstanceRoleAsync(const UpdateManagedInstanceRoleRequest& request, const UpdateManagedInstanceRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -918,8 +1168,252 @@ void SSMClient::UpdateManagedInstanceRoleAsync(const UpdateManagedInstanceRoleRe
   m_executor->Submit( [this, request, handler, context](){ this->UpdateManagedInstanceRoleAsyncHelper( request, handler, context ); } );
 }
 
+UpdateManagedInstanceRoleOutcomeCallable SSMClient::UpdateManagedInstanceRoleCallable(UpdateManagedInstanceRoleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SSMClient::UpdateManagedInstanceRole, this, std::move(request)));
+}
+
+void SSMClient::UpdateManagedInstanceRoleAsync(UpdateManagedInstanceRoleRequest&& request, const UpdateManagedInstanceRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SSMClient::UpdateManagedInstanceRoleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SSMClient::UpdateManagedInstanceRoleAsyncHelper(const UpdateManagedInstanceRoleRequest& request, const UpdateManagedInstanceRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateManagedInstanceRole(request), context);
 }
 
+Paginator<SSMClient, DescribeActivationsRequest, DescribeActivationsOutcome> SSMClient::DescribeActivationsPaginator(const DescribeActivationsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SSMClient, DescribeActivationsRequest, DescribeActivationsOutcome>(this, &SSMClient::DescribeActivations, request,
+    [](const DescribeActivationsRequest& current, const DescribeActivationsOutcome& outcome, DescribeActivationsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SSMClient, DescribeInstanceInformationRequest, DescribeInstanceInformationOutcome> SSMClient::DescribeInstanceInformationPaginator(const DescribeInstanceInformationRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SSMClient, DescribeInstanceInformationRequest, DescribeInstanceInformationOutcome>(this, &SSMClient::DescribeInstanceInformation, request,
+    [](const DescribeInstanceInformationRequest& current, const DescribeInstanceInformationOutcome& outcome, DescribeInstanceInformationRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SSMClient, ListAssociationsRequest, ListAssociationsOutcome> SSMClient::ListAssociationsPaginator(const ListAssociationsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SSMClient, ListAssociationsRequest, ListAssociationsOutcome>(this, &SSMClient::ListAssociations, request,
+    [](const ListAssociationsRequest& current, const ListAssociationsOutcome& outcome, ListAssociationsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SSMClient, ListCommandInvocationsRequest, ListCommandInvocationsOutcome> SSMClient::ListCommandInvocationsPaginator(const ListCommandInvocationsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SSMClient, ListCommandInvocationsRequest, ListCommandInvocationsOutcome>(this, &SSMClient::ListCommandInvocations, request,
+    [](const ListCommandInvocationsRequest& current, const ListCommandInvocationsOutcome& outcome, ListCommandInvocationsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SSMClient, ListCommandsRequest, ListCommandsOutcome> SSMClient::ListCommandsPaginator(const ListCommandsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SSMClient, ListCommandsRequest, ListCommandsOutcome>(this, &SSMClient::ListCommands, request,
+    [](const ListCommandsRequest& current, const ListCommandsOutcome& outcome, ListCommandsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SSMClient, ListDocumentsRequest, ListDocumentsOutcome> SSMClient::ListDocumentsPaginator(const ListDocumentsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SSMClient, ListDocumentsRequest, ListDocumentsOutcome>(this, &SSMClient::ListDocuments, request,
+    [](const ListDocumentsRequest& current, const ListDocumentsOutcome& outcome, ListDocumentsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<SSMClient, AddTagsToResourceRequest, AddTagsToResourceOutcome> SSMClient::AddTagsToResourceAwaitable(AddTagsToResourceRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::AddTagsToResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, CancelCommandRequest, CancelCommandOutcome> SSMClient::CancelCommandAwaitable(CancelCommandRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::CancelCommand, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, CreateActivationRequest, CreateActivationOutcome> SSMClient::CreateActivationAwaitable(CreateActivationRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::CreateActivation, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, CreateAssociationRequest, CreateAssociationOutcome> SSMClient::CreateAssociationAwaitable(CreateAssociationRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::CreateAssociation, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, CreateAssociationBatchRequest, CreateAssociationBatchOutcome> SSMClient::CreateAssociationBatchAwaitable(CreateAssociationBatchRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::CreateAssociationBatch, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, CreateDocumentRequest, CreateDocumentOutcome> SSMClient::CreateDocumentAwaitable(CreateDocumentRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::CreateDocument, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, DeleteActivationRequest, DeleteActivationOutcome> SSMClient::DeleteActivationAwaitable(DeleteActivationRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::DeleteActivation, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, DeleteAssociationRequest, DeleteAssociationOutcome> SSMClient::DeleteAssociationAwaitable(DeleteAssociationRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::DeleteAssociation, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, DeleteDocumentRequest, DeleteDocumentOutcome> SSMClient::DeleteDocumentAwaitable(DeleteDocumentRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::DeleteDocument, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, DeregisterManagedInstanceRequest, DeregisterManagedInstanceOutcome> SSMClient::DeregisterManagedInstanceAwaitable(DeregisterManagedInstanceRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::DeregisterManagedInstance, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, DescribeActivationsRequest, DescribeActivationsOutcome> SSMClient::DescribeActivationsAwaitable(DescribeActivationsRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::DescribeActivations, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, DescribeAssociationRequest, DescribeAssociationOutcome> SSMClient::DescribeAssociationAwaitable(DescribeAssociationRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::DescribeAssociation, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, DescribeDocumentRequest, DescribeDocumentOutcome> SSMClient::DescribeDocumentAwaitable(DescribeDocumentRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::DescribeDocument, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, DescribeDocumentPermissionRequest, DescribeDocumentPermissionOutcome> SSMClient::DescribeDocumentPermissionAwaitable(DescribeDocumentPermissionRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::DescribeDocumentPermission, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, DescribeInstanceInformationRequest, DescribeInstanceInformationOutcome> SSMClient::DescribeInstanceInformationAwaitable(DescribeInstanceInformationRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::DescribeInstanceInformation, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, GetDocumentRequest, GetDocumentOutcome> SSMClient::GetDocumentAwaitable(GetDocumentRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::GetDocument, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, ListAssociationsRequest, ListAssociationsOutcome> SSMClient::ListAssociationsAwaitable(ListAssociationsRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::ListAssociations, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, ListCommandInvocationsRequest, ListCommandInvocationsOutcome> SSMClient::ListCommandInvocationsAwaitable(ListCommandInvocationsRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::ListCommandInvocations, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, ListCommandsRequest, ListCommandsOutcome> SSMClient::ListCommandsAwaitable(ListCommandsRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::ListCommands, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, ListDocumentsRequest, ListDocumentsOutcome> SSMClient::ListDocumentsAwaitable(ListDocumentsRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::ListDocuments, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, ListTagsForResourceRequest, ListTagsForResourceOutcome> SSMClient::ListTagsForResourceAwaitable(ListTagsForResourceRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::ListTagsForResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, ModifyDocumentPermissionRequest, ModifyDocumentPermissionOutcome> SSMClient::ModifyDocumentPermissionAwaitable(ModifyDocumentPermissionRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::ModifyDocumentPermission, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, RemoveTagsFromResourceRequest, RemoveTagsFromResourceOutcome> SSMClient::RemoveTagsFromResourceAwaitable(RemoveTagsFromResourceRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::RemoveTagsFromResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, SendCommandRequest, SendCommandOutcome> SSMClient::SendCommandAwaitable(SendCommandRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::SendCommand, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, UpdateAssociationStatusRequest, UpdateAssociationStatusOutcome> SSMClient::UpdateAssociationStatusAwaitable(UpdateAssociationStatusRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::UpdateAssociationStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<SSMClient, UpdateManagedInstanceRoleRequest, UpdateManagedInstanceRoleOutcome> SSMClient::UpdateManagedInstanceRoleAwaitable(UpdateManagedInstanceRoleRequest request) const
+{
+  return { m_executor.get(), { this, &SSMClient::UpdateManagedInstanceRole, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,21 +29,29 @@ namespace Aws
       namespace AssociationFilterKeyMapper
       {
 
-        static const int InstanceId_HASH = HashingUtils::HashString("InstanceId");
-        static const int Name_HASH = HashingUtils::HashString("Name");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int InstanceId_HASH = -1399478096;
+        static const int Name_HASH = 2420395;
 
 
         AssociationFilterKey GetAssociationFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InstanceId_HASH)
+          switch (hashCode)
           {
+          case InstanceId_HASH:
             return AssociationFilterKey::InstanceId;
-          }
-          else if (hashCode == Name_HASH)
-          {
+          case Name_HASH:
             return AssociationFilterKey::Name;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
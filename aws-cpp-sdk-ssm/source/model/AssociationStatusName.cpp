@@ -29,26 +29,32 @@ namespace Aws
       namespace AssociationStatusNameMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Pending_HASH = 982065527;
+        static const int Success_HASH = -202516509;
+        static const int Failed_HASH = 2096857181;
 
 
         AssociationStatusName GetAssociationStatusNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          switch (hashCode)
           {
+          case Pending_HASH:
             return AssociationStatusName::Pending;
-          }
-          else if (hashCode == Success_HASH)
-          {
+          case Success_HASH:
             return AssociationStatusName::Success;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return AssociationStatusName::Failed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace CommandFilterKeyMapper
       {
 
-        static const int InvokedAfter_HASH = HashingUtils::HashString("InvokedAfter");
-        static const int InvokedBefore_HASH = HashingUtils::HashString("InvokedBefore");
-        static const int Status_HASH = HashingUtils::HashString("Status");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int InvokedAfter_HASH = 131011184;
+        static const int InvokedBefore_HASH = -206322325;
+        static const int Status_HASH = -1808614382;
 
 
         CommandFilterKey GetCommandFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InvokedAfter_HASH)
+          switch (hashCode)
           {
+          case InvokedAfter_HASH:
             return CommandFilterKey::InvokedAfter;
-          }
-          else if (hashCode == InvokedBefore_HASH)
-          {
+          case InvokedBefore_HASH:
             return CommandFilterKey::InvokedBefore;
-          }
-          else if (hashCode == Status_HASH)
-          {
+          case Status_HASH:
             return CommandFilterKey::Status;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
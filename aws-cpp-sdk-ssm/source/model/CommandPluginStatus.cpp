@@ -29,41 +29,41 @@ namespace Aws
       namespace CommandPluginStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int TimedOut_HASH = HashingUtils::HashString("TimedOut");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Pending_HASH = 982065527;
+        static const int InProgress_HASH = 646453906;
+        static const int Success_HASH = -202516509;
+        static const int TimedOut_HASH = -2012269385;
+        static const int Cancelled_HASH = -1814410959;
+        static const int Failed_HASH = 2096857181;
 
 
         CommandPluginStatus GetCommandPluginStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          switch (hashCode)
           {
+          case Pending_HASH:
             return CommandPluginStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
+          case InProgress_HASH:
             return CommandPluginStatus::InProgress;
-          }
-          else if (hashCode == Success_HASH)
-          {
+          case Success_HASH:
             return CommandPluginStatus::Success;
-          }
-          else if (hashCode == TimedOut_HASH)
-          {
+          case TimedOut_HASH:
             return CommandPluginStatus::TimedOut;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
+          case Cancelled_HASH:
             return CommandPluginStatus::Cancelled;
-          }
-          else if (hashCode == Failed_HASH)
-          {
+          case Failed_HASH:
             return CommandPluginStatus::Failed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
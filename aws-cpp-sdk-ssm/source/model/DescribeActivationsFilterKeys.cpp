@@ -29,26 +29,32 @@ namespace Aws
       namespace DescribeActivationsFilterKeysMapper
       {
 
-        static const int ActivationIds_HASH = HashingUtils::HashString("ActivationIds");
-        static const int DefaultInstanceName_HASH = HashingUtils::HashString("DefaultInstanceName");
-        static const int IamRole_HASH = HashingUtils::HashString("IamRole");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ActivationIds_HASH = -1738265182;
+        static const int DefaultInstanceName_HASH = 382454145;
+        static const int IamRole_HASH = -1051463605;
 
 
         DescribeActivationsFilterKeys GetDescribeActivationsFilterKeysForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ActivationIds_HASH)
+          switch (hashCode)
           {
+          case ActivationIds_HASH:
             return DescribeActivationsFilterKeys::ActivationIds;
-          }
-          else if (hashCode == DefaultInstanceName_HASH)
-          {
+          case DefaultInstanceName_HASH:
             return DescribeActivationsFilterKeys::DefaultInstanceName;
-          }
-          else if (hashCode == IamRole_HASH)
-          {
+          case IamRole_HASH:
             return DescribeActivationsFilterKeys::IamRole;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace DocumentFilterKeyMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int Owner_HASH = HashingUtils::HashString("Owner");
-        static const int PlatformTypes_HASH = HashingUtils::HashString("PlatformTypes");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Name_HASH = 2420395;
+        static const int Owner_HASH = 76612243;
+        static const int PlatformTypes_HASH = 1327005606;
 
 
         DocumentFilterKey GetDocumentFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
+          switch (hashCode)
           {
+          case Name_HASH:
             return DocumentFilterKey::Name;
-          }
-          else if (hashCode == Owner_HASH)
-          {
+          case Owner_HASH:
             return DocumentFilterKey::Owner;
-          }
-          else if (hashCode == PlatformTypes_HASH)
-          {
+          case PlatformTypes_HASH:
             return DocumentFilterKey::PlatformTypes;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace DocumentHashTypeMapper
       {
 
-        static const int Sha256_HASH = HashingUtils::HashString("Sha256");
-        static const int Sha1_HASH = HashingUtils::HashString("Sha1");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Sha256_HASH = -1819762105;
+        static const int Sha1_HASH = 2575653;
 
 
         DocumentHashType GetDocumentHashTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Sha256_HASH)
+          switch (hashCode)
           {
+          case Sha256_HASH:
             return DocumentHashType::Sha256;
-          }
-          else if (hashCode == Sha1_HASH)
-          {
+          case Sha1_HASH:
             return DocumentHashType::Sha1;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace DocumentParameterTypeMapper
       {
 
-        static const int String_HASH = HashingUtils::HashString("String");
-        static const int StringList_HASH = HashingUtils::HashString("StringList");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int String_HASH = -1808118735;
+        static const int StringList_HASH = 420147311;
 
 
         DocumentParameterType GetDocumentParameterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == String_HASH)
+          switch (hashCode)
           {
+          case String_HASH:
             return DocumentParameterType::String;
-          }
-          else if (hashCode == StringList_HASH)
-          {
+          case StringList_HASH:
             return DocumentParameterType::StringList;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace DocumentPermissionTypeMapper
       {
 
-        static const int Share_HASH = HashingUtils::HashString("Share");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Share_HASH = 79847359;
 
 
         DocumentPermissionType GetDocumentPermissionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Share_HASH)
+          switch (hashCode)
           {
+          case Share_HASH:
             return DocumentPermissionType::Share;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
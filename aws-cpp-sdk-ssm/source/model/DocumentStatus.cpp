@@ -29,26 +29,32 @@ namespace Aws
       namespace DocumentStatusMapper
       {
 
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Creating_HASH = 1885065945;
+        static const int Active_HASH = 1955883814;
+        static const int Deleting_HASH = 884361160;
 
 
         DocumentStatus GetDocumentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Creating_HASH)
+          switch (hashCode)
           {
+          case Creating_HASH:
             return DocumentStatus::Creating;
-          }
-          else if (hashCode == Active_HASH)
-          {
+          case Active_HASH:
             return DocumentStatus::Active;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
+          case Deleting_HASH:
             return DocumentStatus::Deleting;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
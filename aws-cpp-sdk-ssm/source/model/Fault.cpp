@@ -29,26 +29,32 @@ namespace Aws
       namespace FaultMapper
       {
 
-        static const int Client_HASH = HashingUtils::HashString("Client");
-        static const int Server_HASH = HashingUtils::HashString("Server");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Client_HASH = 2021122027;
+        static const int Server_HASH = -1821959325;
+        static const int Unknown_HASH = 1379812394;
 
 
         Fault GetFaultForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Client_HASH)
+          switch (hashCode)
           {
+          case Client_HASH:
             return Fault::Client;
-          }
-          else if (hashCode == Server_HASH)
-          {
+          case Server_HASH:
             return Fault::Server;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
+          case Unknown_HASH:
             return Fault::Unknown;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
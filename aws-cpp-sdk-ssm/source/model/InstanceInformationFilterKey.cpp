@@ -29,46 +29,44 @@ namespace Aws
       namespace InstanceInformationFilterKeyMapper
       {
 
-        static const int InstanceIds_HASH = HashingUtils::HashString("InstanceIds");
-        static const int AgentVersion_HASH = HashingUtils::HashString("AgentVersion");
-        static const int PingStatus_HASH = HashingUtils::HashString("PingStatus");
-        static const int PlatformTypes_HASH = HashingUtils::HashString("PlatformTypes");
-        static const int ActivationIds_HASH = HashingUtils::HashString("ActivationIds");
-        static const int IamRole_HASH = HashingUtils::HashString("IamRole");
-        static const int ResourceType_HASH = HashingUtils::HashString("ResourceType");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int InstanceIds_HASH = -434147901;
+        static const int AgentVersion_HASH = 2092320307;
+        static const int PingStatus_HASH = -1499808732;
+        static const int PlatformTypes_HASH = 1327005606;
+        static const int ActivationIds_HASH = -1738265182;
+        static const int IamRole_HASH = -1051463605;
+        static const int ResourceType_HASH = -220044152;
 
 
         InstanceInformationFilterKey GetInstanceInformationFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InstanceIds_HASH)
+          switch (hashCode)
           {
+          case InstanceIds_HASH:
             return InstanceInformationFilterKey::InstanceIds;
-          }
-          else if (hashCode == AgentVersion_HASH)
-          {
+          case AgentVersion_HASH:
             return InstanceInformationFilterKey::AgentVersion;
-          }
-          else if (hashCode == PingStatus_HASH)
-          {
+          case PingStatus_HASH:
             return InstanceInformationFilterKey::PingStatus;
-          }
-          else if (hashCode == PlatformTypes_HASH)
-          {
+          case PlatformTypes_HASH:
             return InstanceInformationFilterKey::PlatformTypes;
-          }
-          else if (hashCode == ActivationIds_HASH)
-          {
+          case ActivationIds_HASH:
             return InstanceInformationFilterKey::ActivationIds;
-          }
-          else if (hashCode == IamRole_HASH)
-          {
+          case IamRole_HASH:
             return InstanceInformationFilterKey::IamRole;
-          }
-          else if (hashCode == ResourceType_HASH)
-          {
+          case ResourceType_HASH:
             return InstanceInformationFilterKey::ResourceType;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
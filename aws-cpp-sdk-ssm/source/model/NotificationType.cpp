@@ -29,21 +29,29 @@ namespace Aws
       namespace NotificationTypeMapper
       {
 
-        static const int Command_HASH = HashingUtils::HashString("Command");
-        static const int Invocation_HASH = HashingUtils::HashString("Invocation");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Command_HASH = -1679919317;
+        static const int Invocation_HASH = -562801488;
 
 
         NotificationType GetNotificationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Command_HASH)
+          switch (hashCode)
           {
+          case Command_HASH:
             return NotificationType::Command;
-          }
-          else if (hashCode == Invocation_HASH)
-          {
+          case Invocation_HASH:
             return NotificationType::Invocation;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace PingStatusMapper
       {
 
-        static const int Online_HASH = HashingUtils::HashString("Online");
-        static const int ConnectionLost_HASH = HashingUtils::HashString("ConnectionLost");
-        static const int Inactive_HASH = HashingUtils::HashString("Inactive");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Online_HASH = -1928355213;
+        static const int ConnectionLost_HASH = 267970370;
+        static const int Inactive_HASH = 89309323;
 
 
         PingStatus GetPingStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Online_HASH)
+          switch (hashCode)
           {
+          case Online_HASH:
             return PingStatus::Online;
-          }
-          else if (hashCode == ConnectionLost_HASH)
-          {
+          case ConnectionLost_HASH:
             return PingStatus::ConnectionLost;
-          }
-          else if (hashCode == Inactive_HASH)
-          {
+          case Inactive_HASH:
             return PingStatus::Inactive;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace PlatformTypeMapper
       {
 
-        static const int Windows_HASH = HashingUtils::HashString("Windows");
-        static const int Linux_HASH = HashingUtils::HashString("Linux");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int Windows_HASH = -1280820637;
+        static const int Linux_HASH = 73425108;
 
 
         PlatformType GetPlatformTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Windows_HASH)
+          switch (hashCode)
           {
+          case Windows_HASH:
             return PlatformType::Windows;
-          }
-          else if (hashCode == Linux_HASH)
-          {
+          case Linux_HASH:
             return PlatformType::Linux;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
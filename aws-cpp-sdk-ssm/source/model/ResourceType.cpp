@@ -29,26 +29,32 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int ManagedInstance_HASH = HashingUtils::HashString("ManagedInstance");
-        static const int Document_HASH = HashingUtils::HashString("Document");
-        static const int EC2Instance_HASH = HashingUtils::HashString("EC2Instance");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ManagedInstance_HASH = 1531883828;
+        static const int Document_HASH = 926364987;
+        static const int EC2Instance_HASH = 724267017;
 
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ManagedInstance_HASH)
+          switch (hashCode)
           {
+          case ManagedInstance_HASH:
             return ResourceType::ManagedInstance;
-          }
-          else if (hashCode == Document_HASH)
-          {
+          case Document_HASH:
             return ResourceType::Document;
-          }
-          else if (hashCode == EC2Instance_HASH)
-          {
+          case EC2Instance_HASH:
             return ResourceType::EC2Instance;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace ResourceTypeForTaggingMapper
       {
 
-        static const int ManagedInstance_HASH = HashingUtils::HashString("ManagedInstance");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ManagedInstance_HASH = 1531883828;
 
 
         ResourceTypeForTagging GetResourceTypeForTaggingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ManagedInstance_HASH)
+          switch (hashCode)
           {
+          case ManagedInstance_HASH:
             return ResourceTypeForTagging::ManagedInstance;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
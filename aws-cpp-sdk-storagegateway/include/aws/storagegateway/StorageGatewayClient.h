@@ -77,6 +77,9 @@
 #include <aws/storagegateway/model/UpdateSnapshotScheduleResult.h>
 #include <aws/storagegateway/model/UpdateVTLDeviceTypeResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -470,6 +473,18 @@ namespace Model
          */
         virtual void ActivateGatewayAsync(const Model::ActivateGatewayRequest& request, const ActivateGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ActivateGatewayCallable(const Model::ActivateGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ActivateGatewayOutcomeCallable ActivateGatewayCallable(Model::ActivateGatewayRequest&& request) const;
+
+        /**
+         * Same as ActivateGatewayAsync(const Model::ActivateGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ActivateGatewayAsync(Model::ActivateGatewayRequest&& request, const ActivateGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures one or more gateway local disks as cache for a cached-volume
          * gateway. This operation is supported only for the gateway-cached volume
@@ -507,6 +522,18 @@ namespace Model
          */
         virtual void AddCacheAsync(const Model::AddCacheRequest& request, const AddCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddCacheCallable(const Model::AddCacheRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddCacheOutcomeCallable AddCacheCallable(Model::AddCacheRequest&& request) const;
+
+        /**
+         * Same as AddCacheAsync(const Model::AddCacheRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddCacheAsync(Model::AddCacheRequest&& request, const AddCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds one or more tags to the specified resource. You use tags to add metadata
          * to resources, which you can use to categorize these resources. For example, you
@@ -550,6 +577,18 @@ namespace Model
          */
         virtual void AddTagsToResourceAsync(const Model::AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToResourceCallable(const Model::AddTagsToResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddTagsToResourceOutcomeCallable AddTagsToResourceCallable(Model::AddTagsToResourceRequest&& request) const;
+
+        /**
+         * Same as AddTagsToResourceAsync(const Model::AddTagsToResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddTagsToResourceAsync(Model::AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures one or more gateway local disks as upload buffer for a specified
          * gateway. This operation is supported for both the gateway-stored and
@@ -581,6 +620,18 @@ namespace Model
          */
         virtual void AddUploadBufferAsync(const Model::AddUploadBufferRequest& request, const AddUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddUploadBufferCallable(const Model::AddUploadBufferRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddUploadBufferOutcomeCallable AddUploadBufferCallable(Model::AddUploadBufferRequest&& request) const;
+
+        /**
+         * Same as AddUploadBufferAsync(const Model::AddUploadBufferRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddUploadBufferAsync(Model::AddUploadBufferRequest&& request, const AddUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures one or more gateway local disks as working storage for a gateway.
          * This operation is supported only for the gateway-stored volume architecture.
@@ -624,6 +675,18 @@ namespace Model
          */
         virtual void AddWorkingStorageAsync(const Model::AddWorkingStorageRequest& request, const AddWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddWorkingStorageCallable(const Model::AddWorkingStorageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddWorkingStorageOutcomeCallable AddWorkingStorageCallable(Model::AddWorkingStorageRequest&& request) const;
+
+        /**
+         * Same as AddWorkingStorageAsync(const Model::AddWorkingStorageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddWorkingStorageAsync(Model::AddWorkingStorageRequest&& request, const AddWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels archiving of a virtual tape to the virtual tape shelf (VTS) after the
          * archiving process is initiated.</p>
@@ -646,6 +709,18 @@ namespace Model
          */
         virtual void CancelArchivalAsync(const Model::CancelArchivalRequest& request, const CancelArchivalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelArchivalCallable(const Model::CancelArchivalRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelArchivalOutcomeCallable CancelArchivalCallable(Model::CancelArchivalRequest&& request) const;
+
+        /**
+         * Same as CancelArchivalAsync(const Model::CancelArchivalRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelArchivalAsync(Model::CancelArchivalRequest&& request, const CancelArchivalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels retrieval of a virtual tape from the virtual tape shelf (VTS) to a
          * gateway after the retrieval process is initiated. The virtual tape is returned
@@ -671,6 +746,18 @@ namespace Model
          */
         virtual void CancelRetrievalAsync(const Model::CancelRetrievalRequest& request, const CancelRetrievalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelRetrievalCallable(const Model::CancelRetrievalRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CancelRetrievalOutcomeCallable CancelRetrievalCallable(Model::CancelRetrievalRequest&& request) const;
+
+        /**
+         * Same as CancelRetrievalAsync(const Model::CancelRetrievalRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CancelRetrievalAsync(Model::CancelRetrievalRequest&& request, const CancelRetrievalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a cached volume on a specified cached gateway. This operation is
          * supported only for the gateway-cached volume architecture.</p> <note><p>Cache
@@ -717,6 +804,18 @@ namespace Model
          */
         virtual void CreateCachediSCSIVolumeAsync(const Model::CreateCachediSCSIVolumeRequest& request, const CreateCachediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCachediSCSIVolumeCallable(const Model::CreateCachediSCSIVolumeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateCachediSCSIVolumeOutcomeCallable CreateCachediSCSIVolumeCallable(Model::CreateCachediSCSIVolumeRequest&& request) const;
+
+        /**
+         * Same as CreateCachediSCSIVolumeAsync(const Model::CreateCachediSCSIVolumeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateCachediSCSIVolumeAsync(Model::CreateCachediSCSIVolumeRequest&& request, const CreateCachediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Initiates a snapshot of a volume.</p> <p>AWS Storage Gateway provides the
          * ability to back up point-in-time snapshots of your data to Amazon Simple Storage
@@ -799,6 +898,18 @@ namespace Model
          */
         virtual void CreateSnapshotAsync(const Model::CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSnapshotCallable(const Model::CreateSnapshotRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateSnapshotOutcomeCallable CreateSnapshotCallable(Model::CreateSnapshotRequest&& request) const;
+
+        /**
+         * Same as CreateSnapshotAsync(const Model::CreateSnapshotRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateSnapshotAsync(Model::CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Initiates a snapshot of a gateway from a volume recovery point. This
          * operation is supported only for the gateway-cached volume architecture.</p> <p>A
@@ -860,6 +971,18 @@ namespace Model
          */
         virtual void CreateSnapshotFromVolumeRecoveryPointAsync(const Model::CreateSnapshotFromVolumeRecoveryPointRequest& request, const CreateSnapshotFromVolumeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSnapshotFromVolumeRecoveryPointCallable(const Model::CreateSnapshotFromVolumeRecoveryPointRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateSnapshotFromVolumeRecoveryPointOutcomeCallable CreateSnapshotFromVolumeRecoveryPointCallable(Model::CreateSnapshotFromVolumeRecoveryPointRequest&& request) const;
+
+        /**
+         * Same as CreateSnapshotFromVolumeRecoveryPointAsync(const Model::CreateSnapshotFromVolumeRecoveryPointRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateSnapshotFromVolumeRecoveryPointAsync(Model::CreateSnapshotFromVolumeRecoveryPointRequest&& request, const CreateSnapshotFromVolumeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a volume on a specified gateway. This operation is supported only for
          * the gateway-stored volume architecture.</p> <p>The size of the volume to create
@@ -906,6 +1029,18 @@ namespace Model
          */
         virtual void CreateStorediSCSIVolumeAsync(const Model::CreateStorediSCSIVolumeRequest& request, const CreateStorediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateStorediSCSIVolumeCallable(const Model::CreateStorediSCSIVolumeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateStorediSCSIVolumeOutcomeCallable CreateStorediSCSIVolumeCallable(Model::CreateStorediSCSIVolumeRequest&& request) const;
+
+        /**
+         * Same as CreateStorediSCSIVolumeAsync(const Model::CreateStorediSCSIVolumeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateStorediSCSIVolumeAsync(Model::CreateStorediSCSIVolumeRequest&& request, const CreateStorediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a virtual tape by using your own barcode. You write data to the
          * virtual tape and then archive the tape.</p> <note><p>Cache storage must be
@@ -934,6 +1069,18 @@ namespace Model
          */
         virtual void CreateTapeWithBarcodeAsync(const Model::CreateTapeWithBarcodeRequest& request, const CreateTapeWithBarcodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTapeWithBarcodeCallable(const Model::CreateTapeWithBarcodeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateTapeWithBarcodeOutcomeCallable CreateTapeWithBarcodeCallable(Model::CreateTapeWithBarcodeRequest&& request) const;
+
+        /**
+         * Same as CreateTapeWithBarcodeAsync(const Model::CreateTapeWithBarcodeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateTapeWithBarcodeAsync(Model::CreateTapeWithBarcodeRequest&& request, const CreateTapeWithBarcodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates one or more virtual tapes. You write data to the virtual tapes and
          * then archive the tapes.</p> <note><p>Cache storage must be allocated to the
@@ -962,6 +1109,18 @@ namespace Model
          */
         virtual void CreateTapesAsync(const Model::CreateTapesRequest& request, const CreateTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTapesCallable(const Model::CreateTapesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateTapesOutcomeCallable CreateTapesCallable(Model::CreateTapesRequest&& request) const;
+
+        /**
+         * Same as CreateTapesAsync(const Model::CreateTapesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateTapesAsync(Model::CreateTapesRequest&& request, const CreateTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the bandwidth rate limits of a gateway. You can delete either the
          * upload and download bandwidth rate limit, or you can delete both. If you delete
@@ -993,6 +1152,18 @@ namespace Model
          */
         virtual void DeleteBandwidthRateLimitAsync(const Model::DeleteBandwidthRateLimitRequest& request, const DeleteBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBandwidthRateLimitCallable(const Model::DeleteBandwidthRateLimitRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteBandwidthRateLimitOutcomeCallable DeleteBandwidthRateLimitCallable(Model::DeleteBandwidthRateLimitRequest&& request) const;
+
+        /**
+         * Same as DeleteBandwidthRateLimitAsync(const Model::DeleteBandwidthRateLimitRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteBandwidthRateLimitAsync(Model::DeleteBandwidthRateLimitRequest&& request, const DeleteBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes Challenge-Handshake Authentication Protocol (CHAP) credentials for a
          * specified iSCSI target and initiator pair.</p>
@@ -1015,6 +1186,18 @@ namespace Model
          */
         virtual void DeleteChapCredentialsAsync(const Model::DeleteChapCredentialsRequest& request, const DeleteChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteChapCredentialsCallable(const Model::DeleteChapCredentialsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteChapCredentialsOutcomeCallable DeleteChapCredentialsCallable(Model::DeleteChapCredentialsRequest&& request) const;
+
+        /**
+         * Same as DeleteChapCredentialsAsync(const Model::DeleteChapCredentialsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteChapCredentialsAsync(Model::DeleteChapCredentialsRequest&& request, const DeleteChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a gateway. To specify which gateway to delete, use the Amazon
          * Resource Name (ARN) of the gateway in your request. The operation deletes the
@@ -1076,6 +1259,18 @@ namespace Model
          */
         virtual void DeleteGatewayAsync(const Model::DeleteGatewayRequest& request, const DeleteGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteGatewayCallable(const Model::DeleteGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteGatewayOutcomeCallable DeleteGatewayCallable(Model::DeleteGatewayRequest&& request) const;
+
+        /**
+         * Same as DeleteGatewayAsync(const Model::DeleteGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteGatewayAsync(Model::DeleteGatewayRequest&& request, const DeleteGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a snapshot of a volume.</p> <p>You can take snapshots of your gateway
          * volumes on a scheduled or ad hoc basis. This API action enables you to delete a
@@ -1116,6 +1311,18 @@ namespace Model
          */
         virtual void DeleteSnapshotScheduleAsync(const Model::DeleteSnapshotScheduleRequest& request, const DeleteSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSnapshotScheduleCallable(const Model::DeleteSnapshotScheduleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteSnapshotScheduleOutcomeCallable DeleteSnapshotScheduleCallable(Model::DeleteSnapshotScheduleRequest&& request) const;
+
+        /**
+         * Same as DeleteSnapshotScheduleAsync(const Model::DeleteSnapshotScheduleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteSnapshotScheduleAsync(Model::DeleteSnapshotScheduleRequest&& request, const DeleteSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified virtual tape.</p>
          */
@@ -1135,6 +1342,18 @@ namespace Model
          */
         virtual void DeleteTapeAsync(const Model::DeleteTapeRequest& request, const DeleteTapeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTapeCallable(const Model::DeleteTapeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTapeOutcomeCallable DeleteTapeCallable(Model::DeleteTapeRequest&& request) const;
+
+        /**
+         * Same as DeleteTapeAsync(const Model::DeleteTapeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTapeAsync(Model::DeleteTapeRequest&& request, const DeleteTapeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified virtual tape from the virtual tape shelf (VTS).</p>
          */
@@ -1154,6 +1373,18 @@ namespace Model
          */
         virtual void DeleteTapeArchiveAsync(const Model::DeleteTapeArchiveRequest& request, const DeleteTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTapeArchiveCallable(const Model::DeleteTapeArchiveRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTapeArchiveOutcomeCallable DeleteTapeArchiveCallable(Model::DeleteTapeArchiveRequest&& request) const;
+
+        /**
+         * Same as DeleteTapeArchiveAsync(const Model::DeleteTapeArchiveRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTapeArchiveAsync(Model::DeleteTapeArchiveRequest&& request, const DeleteTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified gateway volume that you previously created using the
          * <a>CreateCachediSCSIVolume</a> or <a>CreateStorediSCSIVolume</a> API. For
@@ -1209,6 +1440,18 @@ namespace Model
          */
         virtual void DeleteVolumeAsync(const Model::DeleteVolumeRequest& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVolumeCallable(const Model::DeleteVolumeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteVolumeOutcomeCallable DeleteVolumeCallable(Model::DeleteVolumeRequest&& request) const;
+
+        /**
+         * Same as DeleteVolumeAsync(const Model::DeleteVolumeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteVolumeAsync(Model::DeleteVolumeRequest&& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the bandwidth rate limits of a gateway. By default, these limits are
          * not set, which means no bandwidth rate limiting is in effect.</p> <p>This
@@ -1243,6 +1486,18 @@ namespace Model
          */
         virtual void DescribeBandwidthRateLimitAsync(const Model::DescribeBandwidthRateLimitRequest& request, const DescribeBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeBandwidthRateLimitCallable(const Model::DescribeBandwidthRateLimitRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeBandwidthRateLimitOutcomeCallable DescribeBandwidthRateLimitCallable(Model::DescribeBandwidthRateLimitRequest&& request) const;
+
+        /**
+         * Same as DescribeBandwidthRateLimitAsync(const Model::DescribeBandwidthRateLimitRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeBandwidthRateLimitAsync(Model::DescribeBandwidthRateLimitRequest&& request, const DescribeBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the cache of a gateway. This operation is supported
          * only for the gateway-cached volume architecture.</p> <p>The response includes
@@ -1271,6 +1526,18 @@ namespace Model
          */
         virtual void DescribeCacheAsync(const Model::DescribeCacheRequest& request, const DescribeCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCacheCallable(const Model::DescribeCacheRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCacheOutcomeCallable DescribeCacheCallable(Model::DescribeCacheRequest&& request) const;
+
+        /**
+         * Same as DescribeCacheAsync(const Model::DescribeCacheRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCacheAsync(Model::DescribeCacheRequest&& request, const DescribeCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a description of the gateway volumes specified in the request. This
          * operation is supported only for the gateway-cached volume architecture.</p>
@@ -1302,6 +1569,18 @@ namespace Model
          */
         virtual void DescribeCachediSCSIVolumesAsync(const Model::DescribeCachediSCSIVolumesRequest& request, const DescribeCachediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCachediSCSIVolumesCallable(const Model::DescribeCachediSCSIVolumesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCachediSCSIVolumesOutcomeCallable DescribeCachediSCSIVolumesCallable(Model::DescribeCachediSCSIVolumesRequest&& request) const;
+
+        /**
+         * Same as DescribeCachediSCSIVolumesAsync(const Model::DescribeCachediSCSIVolumesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCachediSCSIVolumesAsync(Model::DescribeCachediSCSIVolumesRequest&& request, const DescribeCachediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of Challenge-Handshake Authentication Protocol (CHAP)
          * credentials information for a specified iSCSI target, one for each
@@ -1327,6 +1606,18 @@ namespace Model
          */
         virtual void DescribeChapCredentialsAsync(const Model::DescribeChapCredentialsRequest& request, const DescribeChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeChapCredentialsCallable(const Model::DescribeChapCredentialsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeChapCredentialsOutcomeCallable DescribeChapCredentialsCallable(Model::DescribeChapCredentialsRequest&& request) const;
+
+        /**
+         * Same as DescribeChapCredentialsAsync(const Model::DescribeChapCredentialsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeChapCredentialsAsync(Model::DescribeChapCredentialsRequest&& request, const DescribeChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns metadata about a gateway such as its name, network interfaces,
          * configured time zone, and the state (whether the gateway is running or not). To
@@ -1355,6 +1646,18 @@ namespace Model
          */
         virtual void DescribeGatewayInformationAsync(const Model::DescribeGatewayInformationRequest& request, const DescribeGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeGatewayInformationCallable(const Model::DescribeGatewayInformationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeGatewayInformationOutcomeCallable DescribeGatewayInformationCallable(Model::DescribeGatewayInformationRequest&& request) const;
+
+        /**
+         * Same as DescribeGatewayInformationAsync(const Model::DescribeGatewayInformationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeGatewayInformationAsync(Model::DescribeGatewayInformationRequest&& request, const DescribeGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns your gateway's weekly maintenance start time including the day and
          * time of the week. Note that values are in terms of the gateway's time zone.</p>
@@ -1377,6 +1680,18 @@ namespace Model
          */
         virtual void DescribeMaintenanceStartTimeAsync(const Model::DescribeMaintenanceStartTimeRequest& request, const DescribeMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeMaintenanceStartTimeCallable(const Model::DescribeMaintenanceStartTimeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeMaintenanceStartTimeOutcomeCallable DescribeMaintenanceStartTimeCallable(Model::DescribeMaintenanceStartTimeRequest&& request) const;
+
+        /**
+         * Same as DescribeMaintenanceStartTimeAsync(const Model::DescribeMaintenanceStartTimeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeMaintenanceStartTimeAsync(Model::DescribeMaintenanceStartTimeRequest&& request, const DescribeMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the snapshot schedule for the specified gateway volume. The
          * snapshot schedule information includes intervals at which snapshots are
@@ -1402,6 +1717,18 @@ namespace Model
          */
         virtual void DescribeSnapshotScheduleAsync(const Model::DescribeSnapshotScheduleRequest& request, const DescribeSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSnapshotScheduleCallable(const Model::DescribeSnapshotScheduleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSnapshotScheduleOutcomeCallable DescribeSnapshotScheduleCallable(Model::DescribeSnapshotScheduleRequest&& request) const;
+
+        /**
+         * Same as DescribeSnapshotScheduleAsync(const Model::DescribeSnapshotScheduleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSnapshotScheduleAsync(Model::DescribeSnapshotScheduleRequest&& request, const DescribeSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the description of the gateway volumes specified in the request. The
          * list of gateway volumes in the request must be from one gateway. In the response
@@ -1427,6 +1754,18 @@ namespace Model
          */
         virtual void DescribeStorediSCSIVolumesAsync(const Model::DescribeStorediSCSIVolumesRequest& request, const DescribeStorediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStorediSCSIVolumesCallable(const Model::DescribeStorediSCSIVolumesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeStorediSCSIVolumesOutcomeCallable DescribeStorediSCSIVolumesCallable(Model::DescribeStorediSCSIVolumesRequest&& request) const;
+
+        /**
+         * Same as DescribeStorediSCSIVolumesAsync(const Model::DescribeStorediSCSIVolumesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeStorediSCSIVolumesAsync(Model::DescribeStorediSCSIVolumesRequest&& request, const DescribeStorediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a description of specified virtual tapes in the virtual tape shelf
          * (VTS).</p> <p>If a specific <code>TapeARN</code> is not specified, AWS Storage
@@ -1455,6 +1794,18 @@ namespace Model
          */
         virtual void DescribeTapeArchivesAsync(const Model::DescribeTapeArchivesRequest& request, const DescribeTapeArchivesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTapeArchivesCallable(const Model::DescribeTapeArchivesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTapeArchivesOutcomeCallable DescribeTapeArchivesCallable(Model::DescribeTapeArchivesRequest&& request) const;
+
+        /**
+         * Same as DescribeTapeArchivesAsync(const Model::DescribeTapeArchivesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTapeArchivesAsync(Model::DescribeTapeArchivesRequest&& request, const DescribeTapeArchivesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of virtual tape recovery points that are available for the
          * specified gateway-VTL.</p> <p>A recovery point is a point-in-time view of a
@@ -1486,6 +1837,18 @@ namespace Model
          */
         virtual void DescribeTapeRecoveryPointsAsync(const Model::DescribeTapeRecoveryPointsRequest& request, const DescribeTapeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTapeRecoveryPointsCallable(const Model::DescribeTapeRecoveryPointsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTapeRecoveryPointsOutcomeCallable DescribeTapeRecoveryPointsCallable(Model::DescribeTapeRecoveryPointsRequest&& request) const;
+
+        /**
+         * Same as DescribeTapeRecoveryPointsAsync(const Model::DescribeTapeRecoveryPointsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTapeRecoveryPointsAsync(Model::DescribeTapeRecoveryPointsRequest&& request, const DescribeTapeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a description of the specified Amazon Resource Name (ARN) of virtual
          * tapes. If a <code>TapeARN</code> is not specified, returns a description of all
@@ -1511,6 +1874,18 @@ namespace Model
          */
         virtual void DescribeTapesAsync(const Model::DescribeTapesRequest& request, const DescribeTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTapesCallable(const Model::DescribeTapesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTapesOutcomeCallable DescribeTapesCallable(Model::DescribeTapesRequest&& request) const;
+
+        /**
+         * Same as DescribeTapesAsync(const Model::DescribeTapesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTapesAsync(Model::DescribeTapesRequest&& request, const DescribeTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the upload buffer of a gateway. This operation is
          * supported for both the gateway-stored and gateway-cached volume
@@ -1542,6 +1917,18 @@ namespace Model
          */
         virtual void DescribeUploadBufferAsync(const Model::DescribeUploadBufferRequest& request, const DescribeUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeUploadBufferCallable(const Model::DescribeUploadBufferRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeUploadBufferOutcomeCallable DescribeUploadBufferCallable(Model::DescribeUploadBufferRequest&& request) const;
+
+        /**
+         * Same as DescribeUploadBufferAsync(const Model::DescribeUploadBufferRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeUploadBufferAsync(Model::DescribeUploadBufferRequest&& request, const DescribeUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a description of virtual tape library (VTL) devices for the specified
          * gateway. In the response, AWS Storage Gateway returns VTL device
@@ -1567,6 +1954,18 @@ namespace Model
          */
         virtual void DescribeVTLDevicesAsync(const Model::DescribeVTLDevicesRequest& request, const DescribeVTLDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVTLDevicesCallable(const Model::DescribeVTLDevicesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeVTLDevicesOutcomeCallable DescribeVTLDevicesCallable(Model::DescribeVTLDevicesRequest&& request) const;
+
+        /**
+         * Same as DescribeVTLDevicesAsync(const Model::DescribeVTLDevicesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeVTLDevicesAsync(Model::DescribeVTLDevicesRequest&& request, const DescribeVTLDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the working storage of a gateway. This operation is
          * supported only for the gateway-stored volume architecture. This operation is
@@ -1607,6 +2006,18 @@ namespace Model
          */
         virtual void DescribeWorkingStorageAsync(const Model::DescribeWorkingStorageRequest& request, const DescribeWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeWorkingStorageCallable(const Model::DescribeWorkingStorageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeWorkingStorageOutcomeCallable DescribeWorkingStorageCallable(Model::DescribeWorkingStorageRequest&& request) const;
+
+        /**
+         * Same as DescribeWorkingStorageAsync(const Model::DescribeWorkingStorageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeWorkingStorageAsync(Model::DescribeWorkingStorageRequest&& request, const DescribeWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables a gateway when the gateway is no longer functioning. For example, if
          * your gateway VM is damaged, you can disable the gateway so you can recover
@@ -1638,6 +2049,18 @@ namespace Model
          */
         virtual void DisableGatewayAsync(const Model::DisableGatewayRequest& request, const DisableGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableGatewayCallable(const Model::DisableGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DisableGatewayOutcomeCallable DisableGatewayCallable(Model::DisableGatewayRequest&& request) const;
+
+        /**
+         * Same as DisableGatewayAsync(const Model::DisableGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DisableGatewayAsync(Model::DisableGatewayRequest&& request, const DisableGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists gateways owned by an AWS account in a region specified in the request.
          * The returned list is ordered by gateway Amazon Resource Name (ARN).</p> <p>By
@@ -1678,6 +2101,18 @@ namespace Model
          */
         virtual void ListGatewaysAsync(const Model::ListGatewaysRequest& request, const ListGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListGatewaysCallable(const Model::ListGatewaysRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListGatewaysOutcomeCallable ListGatewaysCallable(Model::ListGatewaysRequest&& request) const;
+
+        /**
+         * Same as ListGatewaysAsync(const Model::ListGatewaysRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListGatewaysAsync(Model::ListGatewaysRequest&& request, const ListGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of the gateway's local disks. To specify which gateway to
          * describe, you use the Amazon Resource Name (ARN) of the gateway in the body of
@@ -1721,6 +2156,18 @@ namespace Model
          */
         virtual void ListLocalDisksAsync(const Model::ListLocalDisksRequest& request, const ListLocalDisksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListLocalDisksCallable(const Model::ListLocalDisksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListLocalDisksOutcomeCallable ListLocalDisksCallable(Model::ListLocalDisksRequest&& request) const;
+
+        /**
+         * Same as ListLocalDisksAsync(const Model::ListLocalDisksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListLocalDisksAsync(Model::ListLocalDisksRequest&& request, const ListLocalDisksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the tags that have been added to the specified resource.</p>
          */
@@ -1740,6 +2187,18 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourceCallable(const Model::ListTagsForResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(Model::ListTagsForResourceRequest&& request) const;
+
+        /**
+         * Same as ListTagsForResourceAsync(const Model::ListTagsForResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTagsForResourceAsync(Model::ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists virtual tapes in your virtual tape library (VTL) and your virtual tape
          * shelf (VTS). You specify the tapes to list by specifying one or more tape Amazon
@@ -1783,6 +2242,18 @@ namespace Model
          */
         virtual void ListTapesAsync(const Model::ListTapesRequest& request, const ListTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTapesCallable(const Model::ListTapesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListTapesOutcomeCallable ListTapesCallable(Model::ListTapesRequest&& request) const;
+
+        /**
+         * Same as ListTapesAsync(const Model::ListTapesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListTapesAsync(Model::ListTapesRequest&& request, const ListTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists iSCSI initiators that are connected to a volume. You can use this
          * operation to determine whether a volume is being used or not.</p>
@@ -1805,6 +2276,18 @@ namespace Model
          */
         virtual void ListVolumeInitiatorsAsync(const Model::ListVolumeInitiatorsRequest& request, const ListVolumeInitiatorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListVolumeInitiatorsCallable(const Model::ListVolumeInitiatorsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListVolumeInitiatorsOutcomeCallable ListVolumeInitiatorsCallable(Model::ListVolumeInitiatorsRequest&& request) const;
+
+        /**
+         * Same as ListVolumeInitiatorsAsync(const Model::ListVolumeInitiatorsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListVolumeInitiatorsAsync(Model::ListVolumeInitiatorsRequest&& request, const ListVolumeInitiatorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the recovery points for a specified gateway. This operation is
          * supported only for the gateway-cached volume architecture.</p> <p>Each
@@ -1839,6 +2322,18 @@ namespace Model
          */
         virtual void ListVolumeRecoveryPointsAsync(const Model::ListVolumeRecoveryPointsRequest& request, const ListVolumeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListVolumeRecoveryPointsCallable(const Model::ListVolumeRecoveryPointsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListVolumeRecoveryPointsOutcomeCallable ListVolumeRecoveryPointsCallable(Model::ListVolumeRecoveryPointsRequest&& request) const;
+
+        /**
+         * Same as ListVolumeRecoveryPointsAsync(const Model::ListVolumeRecoveryPointsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListVolumeRecoveryPointsAsync(Model::ListVolumeRecoveryPointsRequest&& request, const ListVolumeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the iSCSI stored volumes of a gateway. Results are sorted by volume
          * ARN. The response includes only the volume ARNs. If you want additional volume
@@ -1882,6 +2377,18 @@ namespace Model
          */
         virtual void ListVolumesAsync(const Model::ListVolumesRequest& request, const ListVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListVolumesCallable(const Model::ListVolumesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListVolumesOutcomeCallable ListVolumesCallable(Model::ListVolumesRequest&& request) const;
+
+        /**
+         * Same as ListVolumesAsync(const Model::ListVolumesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListVolumesAsync(Model::ListVolumesRequest&& request, const ListVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes one or more tags from the specified resource.</p>
          */
@@ -1902,10 +2409,22 @@ namespace Model
         virtual void RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
         /**
-         * <p>Resets all cache disks that have encountered a error and makes the disks
-         * available for reconfiguration as cache storage. If your cache disk encounters a
-         * error, the gateway prevents read and write operations on virtual tapes in the
-         * gateway. For example, an error can occur when a disk is corrupted or removed
+         * Same as RemoveTagsFromResourceCallable(const Model::RemoveTagsFromResourceRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RemoveTagsFromResourceOutcomeCallable RemoveTagsFromResourceCallable(Model::RemoveTagsFromResourceRequest&& request) const;
+
+        /**
+         * Same as RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RemoveTagsFromResourceAsync(Model::RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+        /**
+         * <p>Resets all cache disks that have encountered a error and makes the disks
+         * available for reconfiguration as cache storage. If your cache disk encounters a
+         * error, the gateway prevents read and write operations on virtual tapes in the
+         * gateway. For example, an error can occur when a disk is corrupted or removed
          * from the gateway. When a cache is reset, the gateway loses its cache storage. At
          * this point you can reconfigure the disks as cache disks.</p> <important> <p>If
          * the cache disk you are resetting contains data that has not been uploaded to
@@ -1947,6 +2466,18 @@ namespace Model
          */
         virtual void ResetCacheAsync(const Model::ResetCacheRequest& request, const ResetCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetCacheCallable(const Model::ResetCacheRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResetCacheOutcomeCallable ResetCacheCallable(Model::ResetCacheRequest&& request) const;
+
+        /**
+         * Same as ResetCacheAsync(const Model::ResetCacheRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResetCacheAsync(Model::ResetCacheRequest&& request, const ResetCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves an archived virtual tape from the virtual tape shelf (VTS) to a
          * gateway-VTL. Virtual tapes archived in the VTS are not associated with any
@@ -1981,6 +2512,18 @@ namespace Model
          */
         virtual void RetrieveTapeArchiveAsync(const Model::RetrieveTapeArchiveRequest& request, const RetrieveTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RetrieveTapeArchiveCallable(const Model::RetrieveTapeArchiveRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RetrieveTapeArchiveOutcomeCallable RetrieveTapeArchiveCallable(Model::RetrieveTapeArchiveRequest&& request) const;
+
+        /**
+         * Same as RetrieveTapeArchiveAsync(const Model::RetrieveTapeArchiveRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RetrieveTapeArchiveAsync(Model::RetrieveTapeArchiveRequest&& request, const RetrieveTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the recovery point for the specified virtual tape.</p> <p>A
          * recovery point is a point in time view of a virtual tape at which all the data
@@ -2018,6 +2561,18 @@ namespace Model
          */
         virtual void RetrieveTapeRecoveryPointAsync(const Model::RetrieveTapeRecoveryPointRequest& request, const RetrieveTapeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RetrieveTapeRecoveryPointCallable(const Model::RetrieveTapeRecoveryPointRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RetrieveTapeRecoveryPointOutcomeCallable RetrieveTapeRecoveryPointCallable(Model::RetrieveTapeRecoveryPointRequest&& request) const;
+
+        /**
+         * Same as RetrieveTapeRecoveryPointAsync(const Model::RetrieveTapeRecoveryPointRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RetrieveTapeRecoveryPointAsync(Model::RetrieveTapeRecoveryPointRequest&& request, const RetrieveTapeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the password for your VM local console. When you log in to the local
          * console for the first time, you log in to the VM with the default credentials.
@@ -2046,6 +2601,18 @@ namespace Model
          */
         virtual void SetLocalConsolePasswordAsync(const Model::SetLocalConsolePasswordRequest& request, const SetLocalConsolePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetLocalConsolePasswordCallable(const Model::SetLocalConsolePasswordRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SetLocalConsolePasswordOutcomeCallable SetLocalConsolePasswordCallable(Model::SetLocalConsolePasswordRequest&& request) const;
+
+        /**
+         * Same as SetLocalConsolePasswordAsync(const Model::SetLocalConsolePasswordRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SetLocalConsolePasswordAsync(Model::SetLocalConsolePasswordRequest&& request, const SetLocalConsolePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Shuts down a gateway. To specify which gateway to shut down, use the Amazon
          * Resource Name (ARN) of the gateway in the body of your request.</p> <p>The
@@ -2113,6 +2680,18 @@ namespace Model
          */
         virtual void ShutdownGatewayAsync(const Model::ShutdownGatewayRequest& request, const ShutdownGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ShutdownGatewayCallable(const Model::ShutdownGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ShutdownGatewayOutcomeCallable ShutdownGatewayCallable(Model::ShutdownGatewayRequest&& request) const;
+
+        /**
+         * Same as ShutdownGatewayAsync(const Model::ShutdownGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ShutdownGatewayAsync(Model::ShutdownGatewayRequest&& request, const ShutdownGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts a gateway that you previously shut down (see <a>ShutdownGateway</a>).
          * After the gateway starts, you can then make other API calls, your applications
@@ -2156,6 +2735,18 @@ namespace Model
          */
         virtual void StartGatewayAsync(const Model::StartGatewayRequest& request, const StartGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartGatewayCallable(const Model::StartGatewayRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StartGatewayOutcomeCallable StartGatewayCallable(Model::StartGatewayRequest&& request) const;
+
+        /**
+         * Same as StartGatewayAsync(const Model::StartGatewayRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StartGatewayAsync(Model::StartGatewayRequest&& request, const StartGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the bandwidth rate limits of a gateway. You can update both the
          * upload and download bandwidth rate limit or specify only one of the two. If you
@@ -2196,6 +2787,18 @@ namespace Model
          */
         virtual void UpdateBandwidthRateLimitAsync(const Model::UpdateBandwidthRateLimitRequest& request, const UpdateBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateBandwidthRateLimitCallable(const Model::UpdateBandwidthRateLimitRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateBandwidthRateLimitOutcomeCallable UpdateBandwidthRateLimitCallable(Model::UpdateBandwidthRateLimitRequest&& request) const;
+
+        /**
+         * Same as UpdateBandwidthRateLimitAsync(const Model::UpdateBandwidthRateLimitRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateBandwidthRateLimitAsync(Model::UpdateBandwidthRateLimitRequest&& request, const UpdateBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the Challenge-Handshake Authentication Protocol (CHAP) credentials
          * for a specified iSCSI target. By default, a gateway does not have CHAP enabled;
@@ -2227,6 +2830,18 @@ namespace Model
          */
         virtual void UpdateChapCredentialsAsync(const Model::UpdateChapCredentialsRequest& request, const UpdateChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateChapCredentialsCallable(const Model::UpdateChapCredentialsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateChapCredentialsOutcomeCallable UpdateChapCredentialsCallable(Model::UpdateChapCredentialsRequest&& request) const;
+
+        /**
+         * Same as UpdateChapCredentialsAsync(const Model::UpdateChapCredentialsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateChapCredentialsAsync(Model::UpdateChapCredentialsRequest&& request, const UpdateChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a gateway's metadata, which includes the gateway's name and time
          * zone. To specify which gateway to update, use the Amazon Resource Name (ARN) of
@@ -2261,6 +2876,18 @@ namespace Model
          */
         virtual void UpdateGatewayInformationAsync(const Model::UpdateGatewayInformationRequest& request, const UpdateGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateGatewayInformationCallable(const Model::UpdateGatewayInformationRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateGatewayInformationOutcomeCallable UpdateGatewayInformationCallable(Model::UpdateGatewayInformationRequest&& request) const;
+
+        /**
+         * Same as UpdateGatewayInformationAsync(const Model::UpdateGatewayInformationRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateGatewayInformationAsync(Model::UpdateGatewayInformationRequest&& request, const UpdateGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the gateway virtual machine (VM) software. The request immediately
          * triggers the software update.</p> <note><p>When you make this request, you get a
@@ -2316,6 +2943,18 @@ namespace Model
          */
         virtual void UpdateGatewaySoftwareNowAsync(const Model::UpdateGatewaySoftwareNowRequest& request, const UpdateGatewaySoftwareNowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateGatewaySoftwareNowCallable(const Model::UpdateGatewaySoftwareNowRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateGatewaySoftwareNowOutcomeCallable UpdateGatewaySoftwareNowCallable(Model::UpdateGatewaySoftwareNowRequest&& request) const;
+
+        /**
+         * Same as UpdateGatewaySoftwareNowAsync(const Model::UpdateGatewaySoftwareNowRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateGatewaySoftwareNowAsync(Model::UpdateGatewaySoftwareNowRequest&& request, const UpdateGatewaySoftwareNowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a gateway's weekly maintenance start time information, including day
          * and time of the week. The maintenance time is the time in your gateway's time
@@ -2341,6 +2980,18 @@ namespace Model
          */
         virtual void UpdateMaintenanceStartTimeAsync(const Model::UpdateMaintenanceStartTimeRequest& request, const UpdateMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateMaintenanceStartTimeCallable(const Model::UpdateMaintenanceStartTimeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateMaintenanceStartTimeOutcomeCallable UpdateMaintenanceStartTimeCallable(Model::UpdateMaintenanceStartTimeRequest&& request) const;
+
+        /**
+         * Same as UpdateMaintenanceStartTimeAsync(const Model::UpdateMaintenanceStartTimeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateMaintenanceStartTimeAsync(Model::UpdateMaintenanceStartTimeRequest&& request, const UpdateMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a snapshot schedule configured for a gateway volume.</p> <p>The
          * default snapshot schedule for volume is once every 24 hours, starting at the
@@ -2378,6 +3029,18 @@ namespace Model
          */
         virtual void UpdateSnapshotScheduleAsync(const Model::UpdateSnapshotScheduleRequest& request, const UpdateSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateSnapshotScheduleCallable(const Model::UpdateSnapshotScheduleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateSnapshotScheduleOutcomeCallable UpdateSnapshotScheduleCallable(Model::UpdateSnapshotScheduleRequest&& request) const;
+
+        /**
+         * Same as UpdateSnapshotScheduleAsync(const Model::UpdateSnapshotScheduleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateSnapshotScheduleAsync(Model::UpdateSnapshotScheduleRequest&& request, const UpdateSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the type of medium changer in a gateway-VTL. When you activate a
          * gateway-VTL, you select a medium changer type for the gateway-VTL. This
@@ -2406,6 +3069,340 @@ namespace Model
          */
         virtual void UpdateVTLDeviceTypeAsync(const Model::UpdateVTLDeviceTypeRequest& request, const UpdateVTLDeviceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateVTLDeviceTypeCallable(const Model::UpdateVTLDeviceTypeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateVTLDeviceTypeOutcomeCallable UpdateVTLDeviceTypeCallable(Model::UpdateVTLDeviceTypeRequest&& request) const;
+
+        /**
+         * Same as UpdateVTLDeviceTypeAsync(const Model::UpdateVTLDeviceTypeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateVTLDeviceTypeAsync(Model::UpdateVTLDeviceTypeRequest&& request, const UpdateVTLDeviceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeTapeArchives(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<StorageGatewayClient, Model::DescribeTapeArchivesRequest, Model::DescribeTapeArchivesOutcome> DescribeTapeArchivesPaginator(const Model::DescribeTapeArchivesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeTapeRecoveryPoints(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<StorageGatewayClient, Model::DescribeTapeRecoveryPointsRequest, Model::DescribeTapeRecoveryPointsOutcome> DescribeTapeRecoveryPointsPaginator(const Model::DescribeTapeRecoveryPointsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeTapes(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<StorageGatewayClient, Model::DescribeTapesRequest, Model::DescribeTapesOutcome> DescribeTapesPaginator(const Model::DescribeTapesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeVTLDevices(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<StorageGatewayClient, Model::DescribeVTLDevicesRequest, Model::DescribeVTLDevicesOutcome> DescribeVTLDevicesPaginator(const Model::DescribeVTLDevicesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListGateways(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<StorageGatewayClient, Model::ListGatewaysRequest, Model::ListGatewaysOutcome> ListGatewaysPaginator(const Model::ListGatewaysRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListTagsForResource(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<StorageGatewayClient, Model::ListTagsForResourceRequest, Model::ListTagsForResourceOutcome> ListTagsForResourcePaginator(const Model::ListTagsForResourceRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListTapes(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<StorageGatewayClient, Model::ListTapesRequest, Model::ListTapesOutcome> ListTapesPaginator(const Model::ListTapesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListVolumes(), following Marker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<StorageGatewayClient, Model::ListVolumesRequest, Model::ListVolumesOutcome> ListVolumesPaginator(const Model::ListVolumesRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of ActivateGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::ActivateGatewayRequest, Model::ActivateGatewayOutcome> ActivateGatewayAwaitable(Model::ActivateGatewayRequest request) const;
+
+        /**
+         * co_await-able form of AddCache(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::AddCacheRequest, Model::AddCacheOutcome> AddCacheAwaitable(Model::AddCacheRequest request) const;
+
+        /**
+         * co_await-able form of AddTagsToResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::AddTagsToResourceRequest, Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(Model::AddTagsToResourceRequest request) const;
+
+        /**
+         * co_await-able form of AddUploadBuffer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::AddUploadBufferRequest, Model::AddUploadBufferOutcome> AddUploadBufferAwaitable(Model::AddUploadBufferRequest request) const;
+
+        /**
+         * co_await-able form of AddWorkingStorage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::AddWorkingStorageRequest, Model::AddWorkingStorageOutcome> AddWorkingStorageAwaitable(Model::AddWorkingStorageRequest request) const;
+
+        /**
+         * co_await-able form of CancelArchival(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::CancelArchivalRequest, Model::CancelArchivalOutcome> CancelArchivalAwaitable(Model::CancelArchivalRequest request) const;
+
+        /**
+         * co_await-able form of CancelRetrieval(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::CancelRetrievalRequest, Model::CancelRetrievalOutcome> CancelRetrievalAwaitable(Model::CancelRetrievalRequest request) const;
+
+        /**
+         * co_await-able form of CreateCachediSCSIVolume(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::CreateCachediSCSIVolumeRequest, Model::CreateCachediSCSIVolumeOutcome> CreateCachediSCSIVolumeAwaitable(Model::CreateCachediSCSIVolumeRequest request) const;
+
+        /**
+         * co_await-able form of CreateSnapshot(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::CreateSnapshotRequest, Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(Model::CreateSnapshotRequest request) const;
+
+        /**
+         * co_await-able form of CreateSnapshotFromVolumeRecoveryPoint(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::CreateSnapshotFromVolumeRecoveryPointRequest, Model::CreateSnapshotFromVolumeRecoveryPointOutcome> CreateSnapshotFromVolumeRecoveryPointAwaitable(Model::CreateSnapshotFromVolumeRecoveryPointRequest request) const;
+
+        /**
+         * co_await-able form of CreateStorediSCSIVolume(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::CreateStorediSCSIVolumeRequest, Model::CreateStorediSCSIVolumeOutcome> CreateStorediSCSIVolumeAwaitable(Model::CreateStorediSCSIVolumeRequest request) const;
+
+        /**
+         * co_await-able form of CreateTapeWithBarcode(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::CreateTapeWithBarcodeRequest, Model::CreateTapeWithBarcodeOutcome> CreateTapeWithBarcodeAwaitable(Model::CreateTapeWithBarcodeRequest request) const;
+
+        /**
+         * co_await-able form of CreateTapes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::CreateTapesRequest, Model::CreateTapesOutcome> CreateTapesAwaitable(Model::CreateTapesRequest request) const;
+
+        /**
+         * co_await-able form of DeleteBandwidthRateLimit(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DeleteBandwidthRateLimitRequest, Model::DeleteBandwidthRateLimitOutcome> DeleteBandwidthRateLimitAwaitable(Model::DeleteBandwidthRateLimitRequest request) const;
+
+        /**
+         * co_await-able form of DeleteChapCredentials(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DeleteChapCredentialsRequest, Model::DeleteChapCredentialsOutcome> DeleteChapCredentialsAwaitable(Model::DeleteChapCredentialsRequest request) const;
+
+        /**
+         * co_await-able form of DeleteGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DeleteGatewayRequest, Model::DeleteGatewayOutcome> DeleteGatewayAwaitable(Model::DeleteGatewayRequest request) const;
+
+        /**
+         * co_await-able form of DeleteSnapshotSchedule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DeleteSnapshotScheduleRequest, Model::DeleteSnapshotScheduleOutcome> DeleteSnapshotScheduleAwaitable(Model::DeleteSnapshotScheduleRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTape(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DeleteTapeRequest, Model::DeleteTapeOutcome> DeleteTapeAwaitable(Model::DeleteTapeRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTapeArchive(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DeleteTapeArchiveRequest, Model::DeleteTapeArchiveOutcome> DeleteTapeArchiveAwaitable(Model::DeleteTapeArchiveRequest request) const;
+
+        /**
+         * co_await-able form of DeleteVolume(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DeleteVolumeRequest, Model::DeleteVolumeOutcome> DeleteVolumeAwaitable(Model::DeleteVolumeRequest request) const;
+
+        /**
+         * co_await-able form of DescribeBandwidthRateLimit(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DescribeBandwidthRateLimitRequest, Model::DescribeBandwidthRateLimitOutcome> DescribeBandwidthRateLimitAwaitable(Model::DescribeBandwidthRateLimitRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCache(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DescribeCacheRequest, Model::DescribeCacheOutcome> DescribeCacheAwaitable(Model::DescribeCacheRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCachediSCSIVolumes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DescribeCachediSCSIVolumesRequest, Model::DescribeCachediSCSIVolumesOutcome> DescribeCachediSCSIVolumesAwaitable(Model::DescribeCachediSCSIVolumesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeChapCredentials(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DescribeChapCredentialsRequest, Model::DescribeChapCredentialsOutcome> DescribeChapCredentialsAwaitable(Model::DescribeChapCredentialsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeGatewayInformation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DescribeGatewayInformationRequest, Model::DescribeGatewayInformationOutcome> DescribeGatewayInformationAwaitable(Model::DescribeGatewayInformationRequest request) const;
+
+        /**
+         * co_await-able form of DescribeMaintenanceStartTime(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DescribeMaintenanceStartTimeRequest, Model::DescribeMaintenanceStartTimeOutcome> DescribeMaintenanceStartTimeAwaitable(Model::DescribeMaintenanceStartTimeRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSnapshotSchedule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DescribeSnapshotScheduleRequest, Model::DescribeSnapshotScheduleOutcome> DescribeSnapshotScheduleAwaitable(Model::DescribeSnapshotScheduleRequest request) const;
+
+        /**
+         * co_await-able form of DescribeStorediSCSIVolumes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DescribeStorediSCSIVolumesRequest, Model::DescribeStorediSCSIVolumesOutcome> DescribeStorediSCSIVolumesAwaitable(Model::DescribeStorediSCSIVolumesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTapeArchives(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DescribeTapeArchivesRequest, Model::DescribeTapeArchivesOutcome> DescribeTapeArchivesAwaitable(Model::DescribeTapeArchivesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTapeRecoveryPoints(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DescribeTapeRecoveryPointsRequest, Model::DescribeTapeRecoveryPointsOutcome> DescribeTapeRecoveryPointsAwaitable(Model::DescribeTapeRecoveryPointsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTapes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DescribeTapesRequest, Model::DescribeTapesOutcome> DescribeTapesAwaitable(Model::DescribeTapesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeUploadBuffer(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DescribeUploadBufferRequest, Model::DescribeUploadBufferOutcome> DescribeUploadBufferAwaitable(Model::DescribeUploadBufferRequest request) const;
+
+        /**
+         * co_await-able form of DescribeVTLDevices(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DescribeVTLDevicesRequest, Model::DescribeVTLDevicesOutcome> DescribeVTLDevicesAwaitable(Model::DescribeVTLDevicesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeWorkingStorage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DescribeWorkingStorageRequest, Model::DescribeWorkingStorageOutcome> DescribeWorkingStorageAwaitable(Model::DescribeWorkingStorageRequest request) const;
+
+        /**
+         * co_await-able form of DisableGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::DisableGatewayRequest, Model::DisableGatewayOutcome> DisableGatewayAwaitable(Model::DisableGatewayRequest request) const;
+
+        /**
+         * co_await-able form of ListGateways(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::ListGatewaysRequest, Model::ListGatewaysOutcome> ListGatewaysAwaitable(Model::ListGatewaysRequest request) const;
+
+        /**
+         * co_await-able form of ListLocalDisks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::ListLocalDisksRequest, Model::ListLocalDisksOutcome> ListLocalDisksAwaitable(Model::ListLocalDisksRequest request) const;
+
+        /**
+         * co_await-able form of ListTagsForResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::ListTagsForResourceRequest, Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(Model::ListTagsForResourceRequest request) const;
+
+        /**
+         * co_await-able form of ListTapes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::ListTapesRequest, Model::ListTapesOutcome> ListTapesAwaitable(Model::ListTapesRequest request) const;
+
+        /**
+         * co_await-able form of ListVolumeInitiators(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::ListVolumeInitiatorsRequest, Model::ListVolumeInitiatorsOutcome> ListVolumeInitiatorsAwaitable(Model::ListVolumeInitiatorsRequest request) const;
+
+        /**
+         * co_await-able form of ListVolumeRecoveryPoints(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::ListVolumeRecoveryPointsRequest, Model::ListVolumeRecoveryPointsOutcome> ListVolumeRecoveryPointsAwaitable(Model::ListVolumeRecoveryPointsRequest request) const;
+
+        /**
+         * co_await-able form of ListVolumes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::ListVolumesRequest, Model::ListVolumesOutcome> ListVolumesAwaitable(Model::ListVolumesRequest request) const;
+
+        /**
+         * co_await-able form of RemoveTagsFromResource(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::RemoveTagsFromResourceRequest, Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(Model::RemoveTagsFromResourceRequest request) const;
+
+        /**
+         * co_await-able form of ResetCache(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::ResetCacheRequest, Model::ResetCacheOutcome> ResetCacheAwaitable(Model::ResetCacheRequest request) const;
+
+        /**
+         * co_await-able form of RetrieveTapeArchive(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::RetrieveTapeArchiveRequest, Model::RetrieveTapeArchiveOutcome> RetrieveTapeArchiveAwaitable(Model::RetrieveTapeArchiveRequest request) const;
+
+        /**
+         * co_await-able form of RetrieveTapeRecoveryPoint(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::RetrieveTapeRecoveryPointRequest, Model::RetrieveTapeRecoveryPointOutcome> RetrieveTapeRecoveryPointAwaitable(Model::RetrieveTapeRecoveryPointRequest request) const;
+
+        /**
+         * co_await-able form of SetLocalConsolePassword(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::SetLocalConsolePasswordRequest, Model::SetLocalConsolePasswordOutcome> SetLocalConsolePasswordAwaitable(Model::SetLocalConsolePasswordRequest request) const;
+
+        /**
+         * co_await-able form of ShutdownGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::ShutdownGatewayRequest, Model::ShutdownGatewayOutcome> ShutdownGatewayAwaitable(Model::ShutdownGatewayRequest request) const;
+
+        /**
+         * co_await-able form of StartGateway(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::StartGatewayRequest, Model::StartGatewayOutcome> StartGatewayAwaitable(Model::StartGatewayRequest request) const;
+
+        /**
+         * co_await-able form of UpdateBandwidthRateLimit(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::UpdateBandwidthRateLimitRequest, Model::UpdateBandwidthRateLimitOutcome> UpdateBandwidthRateLimitAwaitable(Model::UpdateBandwidthRateLimitRequest request) const;
+
+        /**
+         * co_await-able form of UpdateChapCredentials(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::UpdateChapCredentialsRequest, Model::UpdateChapCredentialsOutcome> UpdateChapCredentialsAwaitable(Model::UpdateChapCredentialsRequest request) const;
+
+        /**
+         * co_await-able form of UpdateGatewayInformation(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::UpdateGatewayInformationRequest, Model::UpdateGatewayInformationOutcome> UpdateGatewayInformationAwaitable(Model::UpdateGatewayInformationRequest request) const;
+
+        /**
+         * co_await-able form of UpdateGatewaySoftwareNow(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::UpdateGatewaySoftwareNowRequest, Model::UpdateGatewaySoftwareNowOutcome> UpdateGatewaySoftwareNowAwaitable(Model::UpdateGatewaySoftwareNowRequest request) const;
+
+        /**
+         * co_await-able form of UpdateMaintenanceStartTime(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::UpdateMaintenanceStartTimeRequest, Model::UpdateMaintenanceStartTimeOutcome> UpdateMaintenanceStartTimeAwaitable(Model::UpdateMaintenanceStartTimeRequest request) const;
+
+        /**
+         * co_await-able form of UpdateSnapshotSchedule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::UpdateSnapshotScheduleRequest, Model::UpdateSnapshotScheduleOutcome> UpdateSnapshotScheduleAwaitable(Model::UpdateSnapshotScheduleRequest request) const;
+
+        /**
+         * co_await-able form of UpdateVTLDeviceType(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<StorageGatewayClient, Model::UpdateVTLDeviceTypeRequest, Model::UpdateVTLDeviceTypeOutcome> UpdateVTLDeviceTypeAwaitable(Model::UpdateVTLDeviceTypeRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
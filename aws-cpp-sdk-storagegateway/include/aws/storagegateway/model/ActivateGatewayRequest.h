@@ -38,6 +38,8 @@ namespace Model
   {
   public:
     ActivateGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "ActivateGateway"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AddCacheRequest();
+    inline const char* GetServiceRequestName() const override { return "AddCache"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     AddTagsToResourceRequest();
+    inline const char* GetServiceRequestName() const override { return "AddTagsToResource"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     AddUploadBufferRequest();
+    inline const char* GetServiceRequestName() const override { return "AddUploadBuffer"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
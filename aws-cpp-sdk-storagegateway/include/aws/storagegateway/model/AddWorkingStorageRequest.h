@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     AddWorkingStorageRequest();
+    inline const char* GetServiceRequestName() const override { return "AddWorkingStorage"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CancelArchivalRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelArchival"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
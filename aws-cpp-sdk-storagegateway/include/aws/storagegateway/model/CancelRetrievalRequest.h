@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CancelRetrievalRequest();
+    inline const char* GetServiceRequestName() const override { return "CancelRetrieval"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateCachediSCSIVolumeRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateCachediSCSIVolume"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
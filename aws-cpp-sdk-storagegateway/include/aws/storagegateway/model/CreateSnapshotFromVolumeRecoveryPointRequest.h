@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateSnapshotFromVolumeRecoveryPointRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateSnapshotFromVolumeRecoveryPoint"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -36,6 +36,8 @@ namespace Model
   {
   public:
     CreateStorediSCSIVolumeRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateStorediSCSIVolume"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
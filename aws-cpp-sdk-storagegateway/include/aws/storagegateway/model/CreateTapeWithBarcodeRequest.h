@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateTapeWithBarcodeRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateTapeWithBarcode"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateTapesRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateTapes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteBandwidthRateLimitRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteBandwidthRateLimit"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
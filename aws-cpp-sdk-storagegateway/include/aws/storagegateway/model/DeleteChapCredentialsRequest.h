@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DeleteChapCredentialsRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteChapCredentials"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteGateway"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteSnapshotScheduleRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteSnapshotSchedule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
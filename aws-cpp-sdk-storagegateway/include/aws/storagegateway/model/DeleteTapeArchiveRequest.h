@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteTapeArchiveRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteTapeArchive"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
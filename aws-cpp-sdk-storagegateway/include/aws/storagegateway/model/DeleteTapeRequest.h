@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteTapeRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteTape"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteVolumeRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteVolume"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeBandwidthRateLimitRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeBandwidthRateLimit"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeCacheRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCache"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
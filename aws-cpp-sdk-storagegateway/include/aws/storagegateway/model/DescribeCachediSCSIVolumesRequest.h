@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeCachediSCSIVolumesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCachediSCSIVolumes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeChapCredentialsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeChapCredentials"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeGatewayInformationRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeGatewayInformation"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeMaintenanceStartTimeRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeMaintenanceStartTime"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeSnapshotScheduleRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSnapshotSchedule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
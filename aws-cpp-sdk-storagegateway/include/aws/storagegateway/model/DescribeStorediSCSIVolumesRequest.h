@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeStorediSCSIVolumesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeStorediSCSIVolumes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
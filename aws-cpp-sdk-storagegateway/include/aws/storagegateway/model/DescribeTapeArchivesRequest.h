@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeTapeArchivesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTapeArchives"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
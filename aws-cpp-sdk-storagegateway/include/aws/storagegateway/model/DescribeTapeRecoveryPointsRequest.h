@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeTapeRecoveryPointsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTapeRecoveryPoints"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeTapesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTapes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
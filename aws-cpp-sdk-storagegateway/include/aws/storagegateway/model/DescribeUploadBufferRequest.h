@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeUploadBufferRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeUploadBuffer"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
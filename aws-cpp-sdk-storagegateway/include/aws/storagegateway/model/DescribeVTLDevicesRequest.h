@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeVTLDevicesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeVTLDevices"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
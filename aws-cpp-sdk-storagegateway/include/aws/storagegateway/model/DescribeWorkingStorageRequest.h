@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeWorkingStorageRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeWorkingStorage"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
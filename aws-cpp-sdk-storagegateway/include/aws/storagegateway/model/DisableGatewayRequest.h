@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DisableGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "DisableGateway"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
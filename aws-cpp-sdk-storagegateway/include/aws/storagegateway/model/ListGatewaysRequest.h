@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ListGatewaysRequest();
+    inline const char* GetServiceRequestName() const override { return "ListGateways"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
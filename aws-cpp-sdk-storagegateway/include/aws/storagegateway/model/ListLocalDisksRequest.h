@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListLocalDisksRequest();
+    inline const char* GetServiceRequestName() const override { return "ListLocalDisks"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListTapesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListTapes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListVolumeInitiatorsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListVolumeInitiators"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListVolumeRecoveryPointsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListVolumeRecoveryPoints"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     ListVolumesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListVolumes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
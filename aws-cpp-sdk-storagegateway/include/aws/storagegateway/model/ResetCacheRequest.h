@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ResetCacheRequest();
+    inline const char* GetServiceRequestName() const override { return "ResetCache"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
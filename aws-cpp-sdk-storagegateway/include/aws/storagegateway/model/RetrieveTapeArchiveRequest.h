@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RetrieveTapeArchiveRequest();
+    inline const char* GetServiceRequestName() const override { return "RetrieveTapeArchive"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
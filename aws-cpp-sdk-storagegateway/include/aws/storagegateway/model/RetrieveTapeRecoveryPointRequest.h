@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RetrieveTapeRecoveryPointRequest();
+    inline const char* GetServiceRequestName() const override { return "RetrieveTapeRecoveryPoint"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
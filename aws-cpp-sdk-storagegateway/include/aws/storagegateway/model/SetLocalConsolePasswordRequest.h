@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     SetLocalConsolePasswordRequest();
+    inline const char* GetServiceRequestName() const override { return "SetLocalConsolePassword"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ShutdownGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "ShutdownGateway"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
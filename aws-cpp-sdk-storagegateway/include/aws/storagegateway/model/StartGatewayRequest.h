@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     StartGatewayRequest();
+    inline const char* GetServiceRequestName() const override { return "StartGateway"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     UpdateBandwidthRateLimitRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateBandwidthRateLimit"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
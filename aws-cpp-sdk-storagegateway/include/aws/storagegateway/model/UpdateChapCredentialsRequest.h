@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     UpdateChapCredentialsRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateChapCredentials"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateGatewayInformationRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateGatewayInformation"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     UpdateGatewaySoftwareNowRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateGatewaySoftwareNow"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     UpdateMaintenanceStartTimeRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateMaintenanceStartTime"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
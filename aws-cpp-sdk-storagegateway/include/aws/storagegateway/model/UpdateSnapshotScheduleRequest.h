@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     UpdateSnapshotScheduleRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateSnapshotSchedule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
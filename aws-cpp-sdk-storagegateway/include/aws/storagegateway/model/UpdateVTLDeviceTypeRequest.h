@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     UpdateVTLDeviceTypeRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateVTLDeviceType"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -165,7 +165,7 @@ ActivateGatewayOutcome StorageGatewayClient::ActivateGateway(const ActivateGatew
 
 ActivateGatewayOutcomeCallable StorageGatewayClient::ActivateGatewayCallable(const ActivateGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ActivateGateway(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ActivateGateway(request); } );
 }
 
 void StorageGatewayClient::ActivateGatewayAsync(const ActivateGatewayRequest& request, const ActivateGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -173,6 +173,16 @@ void StorageGatewayClient::ActivateGatewayAsync(const ActivateGatewayRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->ActivateGatewayAsyncHelper( request, handler, context ); } );
 }
 
+ActivateGatewayOutcomeCallable StorageGatewayClient::ActivateGatewayCallable(ActivateGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::ActivateGateway, this, std::move(request)));
+}
+
+void StorageGatewayClient::ActivateGatewayAsync(ActivateGatewayRequest&& request, const ActivateGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::ActivateGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::ActivateGatewayAsyncHelper(const ActivateGatewayRequest& request, const ActivateGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ActivateGateway(request), context);
@@ -196,7 +206,7 @@ AddCacheOutcome StorageGatewayClient::AddCache(const AddCacheRequest& request) c
 
 AddCacheOutcomeCallable StorageGatewayClient::AddCacheCallable(const AddCacheRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddCache(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddCache(request); } );
 }
 
 void StorageGatewayClient::AddCacheAsync(const AddCacheRequest& request, const AddCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -204,6 +214,16 @@ void StorageGatewayClient::AddCacheAsync(const AddCacheRequest& request, const A
   m_executor->Submit( [this, request, handler, context](){ this->AddCacheAsyncHelper( request, handler, context ); } );
 }
 
+AddCacheOutcomeCallable StorageGatewayClient::AddCacheCallable(AddCacheRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::AddCache, this, std::move(request)));
+}
+
+void StorageGatewayClient::AddCacheAsync(AddCacheRequest&& request, const AddCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::AddCacheAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::AddCacheAsyncHelper(const AddCacheRequest& request, const AddCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddCache(request), context);
@@ -227,7 +247,7 @@ AddTagsToResourceOutcome StorageGatewayClient::AddTagsToResource(const AddTagsTo
 
 AddTagsToResourceOutcomeCallable StorageGatewayClient::AddTagsToResourceCallable(const AddTagsToResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddTagsToResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddTagsToResource(request); } );
 }
 
 void StorageGatewayClient::AddTagsToResourceAsync(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -235,6 +255,16 @@ void StorageGatewayClient::AddTagsToResourceAsync(const AddTagsToResourceRequest
   m_executor->Submit( [this, request, handler, context](){ this->AddTagsToResourceAsyncHelper( request, handler, context ); } );
 }
 
+AddTagsToResourceOutcomeCallable StorageGatewayClient::AddTagsToResourceCallable(AddTagsToResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::AddTagsToResource, this, std::move(request)));
+}
+
+void StorageGatewayClient::AddTagsToResourceAsync(AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::AddTagsToResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::AddTagsToResourceAsyncHelper(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddTagsToResource(request), context);
@@ -258,7 +288,7 @@ AddUploadBufferOutcome StorageGatewayClient::AddUploadBuffer(const AddUploadBuff
 
 AddUploadBufferOutcomeCallable StorageGatewayClient::AddUploadBufferCallable(const AddUploadBufferRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddUploadBuffer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddUploadBuffer(request); } );
 }
 
 void StorageGatewayClient::AddUploadBufferAsync(const AddUploadBufferRequest& request, const AddUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -266,6 +296,16 @@ void StorageGatewayClient::AddUploadBufferAsync(const AddUploadBufferRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->AddUploadBufferAsyncHelper( request, handler, context ); } );
 }
 
+AddUploadBufferOutcomeCallable StorageGatewayClient::AddUploadBufferCallable(AddUploadBufferRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::AddUploadBuffer, this, std::move(request)));
+}
+
+void StorageGatewayClient::AddUploadBufferAsync(AddUploadBufferRequest&& request, const AddUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::AddUploadBufferAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::AddUploadBufferAsyncHelper(const AddUploadBufferRequest& request, const AddUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddUploadBuffer(request), context);
@@ -289,7 +329,7 @@ AddWorkingStorageOutcome StorageGatewayClient::AddWorkingStorage(const AddWorkin
 
 AddWorkingStorageOutcomeCallable StorageGatewayClient::AddWorkingStorageCallable(const AddWorkingStorageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddWorkingStorage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddWorkingStorage(request); } );
 }
 
 void StorageGatewayClient::AddWorkingStorageAsync(const AddWorkingStorageRequest& request, const AddWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -297,6 +337,16 @@ void StorageGatewayClient::AddWorkingStorageAsync(const AddWorkingStorageRequest
   m_executor->Submit( [this, request, handler, context](){ this->AddWorkingStorageAsyncHelper( request, handler, context ); } );
 }
 
+AddWorkingStorageOutcomeCallable StorageGatewayClient::AddWorkingStorageCallable(AddWorkingStorageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::AddWorkingStorage, this, std::move(request)));
+}
+
+void StorageGatewayClient::AddWorkingStorageAsync(AddWorkingStorageRequest&& request, const AddWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::AddWorkingStorageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::AddWorkingStorageAsyncHelper(const AddWorkingStorageRequest& request, const AddWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddWorkingStorage(request), context);
@@ -320,7 +370,7 @@ CancelArchivalOutcome StorageGatewayClient::CancelArchival(const CancelArchivalR
 
 CancelArchivalOutcomeCallable StorageGatewayClient::CancelArchivalCallable(const CancelArchivalRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelArchival(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelArchival(request); } );
 }
 
 void StorageGatewayClient::CancelArchivalAsync(const CancelArchivalRequest& request, const CancelArchivalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -328,6 +378,16 @@ void StorageGatewayClient::CancelArchivalAsync(const CancelArchivalRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->CancelArchivalAsyncHelper( request, handler, context ); } );
 }
 
+CancelArchivalOutcomeCallable StorageGatewayClient::CancelArchivalCallable(CancelArchivalRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::CancelArchival, this, std::move(request)));
+}
+
+void StorageGatewayClient::CancelArchivalAsync(CancelArchivalRequest&& request, const CancelArchivalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::CancelArchivalAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::CancelArchivalAsyncHelper(const CancelArchivalRequest& request, const CancelArchivalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelArchival(request), context);
@@ -351,7 +411,7 @@ CancelRetrievalOutcome StorageGatewayClient::CancelRetrieval(const CancelRetriev
 
 CancelRetrievalOutcomeCallable StorageGatewayClient::CancelRetrievalCallable(const CancelRetrievalRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CancelRetrieval(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CancelRetrieval(request); } );
 }
 
 void StorageGatewayClient::CancelRetrievalAsync(const CancelRetrievalRequest& request, const CancelRetrievalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -359,6 +419,16 @@ void StorageGatewayClient::CancelRetrievalAsync(const CancelRetrievalRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->CancelRetrievalAsyncHelper( request, handler, context ); } );
 }
 
+CancelRetrievalOutcomeCallable StorageGatewayClient::CancelRetrievalCallable(CancelRetrievalRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::CancelRetrieval, this, std::move(request)));
+}
+
+void StorageGatewayClient::CancelRetrievalAsync(CancelRetrievalRequest&& request, const CancelRetrievalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::CancelRetrievalAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::CancelRetrievalAsyncHelper(const CancelRetrievalRequest& request, const CancelRetrievalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CancelRetrieval(request), context);
@@ -382,7 +452,7 @@ CreateCachediSCSIVolumeOutcome StorageGatewayClient::CreateCachediSCSIVolume(con
 
 CreateCachediSCSIVolumeOutcomeCallable StorageGatewayClient::CreateCachediSCSIVolumeCallable(const CreateCachediSCSIVolumeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateCachediSCSIVolume(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateCachediSCSIVolume(request); } );
 }
 
 void StorageGatewayClient::CreateCachediSCSIVolumeAsync(const CreateCachediSCSIVolumeRequest& request, const CreateCachediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -390,6 +460,16 @@ void StorageGatewayClient::CreateCachediSCSIVolumeAsync(const CreateCachediSCSIV
   m_executor->Submit( [this, request, handler, context](){ this->CreateCachediSCSIVolumeAsyncHelper( request, handler, context ); } );
 }
 
+CreateCachediSCSIVolumeOutcomeCallable StorageGatewayClient::CreateCachediSCSIVolumeCallable(CreateCachediSCSIVolumeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::CreateCachediSCSIVolume, this, std::move(request)));
+}
+
+void StorageGatewayClient::CreateCachediSCSIVolumeAsync(CreateCachediSCSIVolumeRequest&& request, const CreateCachediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::CreateCachediSCSIVolumeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::CreateCachediSCSIVolumeAsyncHelper(const CreateCachediSCSIVolumeRequest& request, const CreateCachediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateCachediSCSIVolume(request), context);
@@ -413,7 +493,7 @@ CreateSnapshotOutcome StorageGatewayClient::CreateSnapshot(const CreateSnapshotR
 
 CreateSnapshotOutcomeCallable StorageGatewayClient::CreateSnapshotCallable(const CreateSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateSnapshot(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateSnapshot(request); } );
 }
 
 void StorageGatewayClient::CreateSnapshotAsync(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -421,6 +501,16 @@ void StorageGatewayClient::CreateSnapshotAsync(const CreateSnapshotRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->CreateSnapshotAsyncHelper( request, handler, context ); } );
 }
 
+CreateSnapshotOutcomeCallable StorageGatewayClient::CreateSnapshotCallable(CreateSnapshotRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::CreateSnapshot, this, std::move(request)));
+}
+
+void StorageGatewayClient::CreateSnapshotAsync(CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::CreateSnapshotAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::CreateSnapshotAsyncHelper(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateSnapshot(request), context);
@@ -444,7 +534,7 @@ CreateSnapshotFromVolumeRecoveryPointOutcome StorageGatewayClient::CreateSnapsho
 
 CreateSnapshotFromVolumeRecoveryPointOutcomeCallable StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointCallable(const CreateSnapshotFromVolumeRecoveryPointRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateSnapshotFromVolumeRecoveryPoint(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateSnapshotFromVolumeRecoveryPoint(request); } );
 }
 
 void StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointAsync(const CreateSnapshotFromVolumeRecoveryPointRequest& request, const CreateSnapshotFromVolumeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -452,6 +542,16 @@ void StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointAsync(const Crea
   m_executor->Submit( [this, request, handler, context](){ this->CreateSnapshotFromVolumeRecoveryPointAsyncHelper( request, handler, context ); } );
 }
 
+CreateSnapshotFromVolumeRecoveryPointOutcomeCallable StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointCallable(CreateSnapshotFromVolumeRecoveryPointRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPoint, this, std::move(request)));
+}
+
+void StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointAsync(CreateSnapshotFromVolumeRecoveryPointRequest&& request, const CreateSnapshotFromVolumeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointAsyncHelper(const CreateSnapshotFromVolumeRecoveryPointRequest& request, const CreateSnapshotFromVolumeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateSnapshotFromVolumeRecoveryPoint(request), context);
@@ -475,7 +575,7 @@ CreateStorediSCSIVolumeOutcome StorageGatewayClient::CreateStorediSCSIVolume(con
 
 CreateStorediSCSIVolumeOutcomeCallable StorageGatewayClient::CreateStorediSCSIVolumeCallable(const CreateStorediSCSIVolumeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateStorediSCSIVolume(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateStorediSCSIVolume(request); } );
 }
 
 void StorageGatewayClient::CreateStorediSCSIVolumeAsync(const CreateStorediSCSIVolumeRequest& request, const CreateStorediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -483,6 +583,16 @@ void StorageGatewayClient::CreateStorediSCSIVolumeAsync(const CreateStorediSCSIV
   m_executor->Submit( [this, request, handler, context](){ this->CreateStorediSCSIVolumeAsyncHelper( request, handler, context ); } );
 }
 
+CreateStorediSCSIVolumeOutcomeCallable StorageGatewayClient::CreateStorediSCSIVolumeCallable(CreateStorediSCSIVolumeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::CreateStorediSCSIVolume, this, std::move(request)));
+}
+
+void StorageGatewayClient::CreateStorediSCSIVolumeAsync(CreateStorediSCSIVolumeRequest&& request, const CreateStorediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::CreateStorediSCSIVolumeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::CreateStorediSCSIVolumeAsyncHelper(const CreateStorediSCSIVolumeRequest& request, const CreateStorediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateStorediSCSIVolume(request), context);
@@ -506,7 +616,7 @@ CreateTapeWithBarcodeOutcome StorageGatewayClient::CreateTapeWithBarcode(const C
 
 CreateTapeWithBarcodeOutcomeCallable StorageGatewayClient::CreateTapeWithBarcodeCallable(const CreateTapeWithBarcodeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateTapeWithBarcode(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateTapeWithBarcode(request); } );
 }
 
 void StorageGatewayClient::CreateTapeWithBarcodeAsync(const CreateTapeWithBarcodeRequest& request, const CreateTapeWithBarcodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -514,6 +624,16 @@ void StorageGatewayClient::CreateTapeWithBarcodeAsync(const CreateTapeWithBarcod
   m_executor->Submit( [this, request, handler, context](){ this->CreateTapeWithBarcodeAsyncHelper( request, handler, context ); } );
 }
 
+CreateTapeWithBarcodeOutcomeCallable StorageGatewayClient::CreateTapeWithBarcodeCallable(CreateTapeWithBarcodeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::CreateTapeWithBarcode, this, std::move(request)));
+}
+
+void StorageGatewayClient::CreateTapeWithBarcodeAsync(CreateTapeWithBarcodeRequest&& request, const CreateTapeWithBarcodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::CreateTapeWithBarcodeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::CreateTapeWithBarcodeAsyncHelper(const CreateTapeWithBarcodeRequest& request, const CreateTapeWithBarcodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateTapeWithBarcode(request), context);
@@ -537,7 +657,7 @@ CreateTapesOutcome StorageGatewayClient::CreateTapes(const CreateTapesRequest& r
 
 CreateTapesOutcomeCallable StorageGatewayClient::CreateTapesCallable(const CreateTapesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateTapes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateTapes(request); } );
 }
 
 void StorageGatewayClient::CreateTapesAsync(const CreateTapesRequest& request, const CreateTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -545,6 +665,16 @@ void StorageGatewayClient::CreateTapesAsync(const CreateTapesRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->CreateTapesAsyncHelper( request, handler, context ); } );
 }
 
+CreateTapesOutcomeCallable StorageGatewayClient::CreateTapesCallable(CreateTapesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::CreateTapes, this, std::move(request)));
+}
+
+void StorageGatewayClient::CreateTapesAsync(CreateTapesRequest&& request, const CreateTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::CreateTapesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::CreateTapesAsyncHelper(const CreateTapesRequest& request, const CreateTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateTapes(request), context);
@@ -568,7 +698,7 @@ DeleteBandwidthRateLimitOutcome StorageGatewayClient::DeleteBandwidthRateLimit(c
 
 DeleteBandwidthRateLimitOutcomeCallable StorageGatewayClient::DeleteBandwidthRateLimitCallable(const DeleteBandwidthRateLimitRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteBandwidthRateLimit(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteBandwidthRateLimit(request); } );
 }
 
 void StorageGatewayClient::DeleteBandwidthRateLimitAsync(const DeleteBandwidthRateLimitRequest& request, const DeleteBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -576,6 +706,16 @@ void StorageGatewayClient::DeleteBandwidthRateLimitAsync(const DeleteBandwidthRa
   m_executor->Submit( [this, request, handler, context](){ this->DeleteBandwidthRateLimitAsyncHelper( request, handler, context ); } );
 }
 
+DeleteBandwidthRateLimitOutcomeCallable StorageGatewayClient::DeleteBandwidthRateLimitCallable(DeleteBandwidthRateLimitRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DeleteBandwidthRateLimit, this, std::move(request)));
+}
+
+void StorageGatewayClient::DeleteBandwidthRateLimitAsync(DeleteBandwidthRateLimitRequest&& request, const DeleteBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DeleteBandwidthRateLimitAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DeleteBandwidthRateLimitAsyncHelper(const DeleteBandwidthRateLimitRequest& request, const DeleteBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteBandwidthRateLimit(request), context);
@@ -599,7 +739,7 @@ DeleteChapCredentialsOutcome StorageGatewayClient::DeleteChapCredentials(const D
 
 DeleteChapCredentialsOutcomeCallable StorageGatewayClient::DeleteChapCredentialsCallable(const DeleteChapCredentialsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteChapCredentials(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteChapCredentials(request); } );
 }
 
 void StorageGatewayClient::DeleteChapCredentialsAsync(const DeleteChapCredentialsRequest& request, const DeleteChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -607,6 +747,16 @@ void StorageGatewayClient::DeleteChapCredentialsAsync(const DeleteChapCredential
   m_executor->Submit( [this, request, handler, context](){ this->DeleteChapCredentialsAsyncHelper( request, handler, context ); } );
 }
 
+DeleteChapCredentialsOutcomeCallable StorageGatewayClient::DeleteChapCredentialsCallable(DeleteChapCredentialsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DeleteChapCredentials, this, std::move(request)));
+}
+
+void StorageGatewayClient::DeleteChapCredentialsAsync(DeleteChapCredentialsRequest&& request, const DeleteChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DeleteChapCredentialsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DeleteChapCredentialsAsyncHelper(const DeleteChapCredentialsRequest& request, const DeleteChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteChapCredentials(request), context);
@@ -630,7 +780,7 @@ DeleteGatewayOutcome StorageGatewayClient::DeleteGateway(const DeleteGatewayRequ
 
 DeleteGatewayOutcomeCallable StorageGatewayClient::DeleteGatewayCallable(const DeleteGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteGateway(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteGateway(request); } );
 }
 
 void StorageGatewayClient::DeleteGatewayAsync(const DeleteGatewayRequest& request, const DeleteGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -638,6 +788,16 @@ void StorageGatewayClient::DeleteGatewayAsync(const DeleteGatewayRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->DeleteGatewayAsyncHelper( request, handler, context ); } );
 }
 
+DeleteGatewayOutcomeCallable StorageGatewayClient::DeleteGatewayCallable(DeleteGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DeleteGateway, this, std::move(request)));
+}
+
+void StorageGatewayClient::DeleteGatewayAsync(DeleteGatewayRequest&& request, const DeleteGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DeleteGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DeleteGatewayAsyncHelper(const DeleteGatewayRequest& request, const DeleteGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteGateway(request), context);
@@ -661,7 +821,7 @@ DeleteSnapshotScheduleOutcome StorageGatewayClient::DeleteSnapshotSchedule(const
 
 DeleteSnapshotScheduleOutcomeCallable StorageGatewayClient::DeleteSnapshotScheduleCallable(const DeleteSnapshotScheduleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteSnapshotSchedule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteSnapshotSchedule(request); } );
 }
 
 void StorageGatewayClient::DeleteSnapshotScheduleAsync(const DeleteSnapshotScheduleRequest& request, const DeleteSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -669,6 +829,16 @@ void StorageGatewayClient::DeleteSnapshotScheduleAsync(const DeleteSnapshotSched
   m_executor->Submit( [this, request, handler, context](){ this->DeleteSnapshotScheduleAsyncHelper( request, handler, context ); } );
 }
 
+DeleteSnapshotScheduleOutcomeCallable StorageGatewayClient::DeleteSnapshotScheduleCallable(DeleteSnapshotScheduleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DeleteSnapshotSchedule, this, std::move(request)));
+}
+
+void StorageGatewayClient::DeleteSnapshotScheduleAsync(DeleteSnapshotScheduleRequest&& request, const DeleteSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DeleteSnapshotScheduleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DeleteSnapshotScheduleAsyncHelper(const DeleteSnapshotScheduleRequest& request, const DeleteSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteSnapshotSchedule(request), context);
@@ -692,7 +862,7 @@ DeleteTapeOutcome StorageGatewayClient::DeleteTape(const DeleteTapeRequest& requ
 
 DeleteTapeOutcomeCallable StorageGatewayClient::DeleteTapeCallable(const DeleteTapeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTape(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTape(request); } );
 }
 
 void StorageGatewayClient::DeleteTapeAsync(const DeleteTapeRequest& request, const DeleteTapeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -700,6 +870,16 @@ void StorageGatewayClient::DeleteTapeAsync(const DeleteTapeRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTapeAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTapeOutcomeCallable StorageGatewayClient::DeleteTapeCallable(DeleteTapeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DeleteTape, this, std::move(request)));
+}
+
+void StorageGatewayClient::DeleteTapeAsync(DeleteTapeRequest&& request, const DeleteTapeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DeleteTapeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DeleteTapeAsyncHelper(const DeleteTapeRequest& request, const DeleteTapeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTape(request), context);
@@ -723,7 +903,7 @@ DeleteTapeArchiveOutcome StorageGatewayClient::DeleteTapeArchive(const DeleteTap
 
 DeleteTapeArchiveOutcomeCallable StorageGatewayClient::DeleteTapeArchiveCallable(const DeleteTapeArchiveRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTapeArchive(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTapeArchive(request); } );
 }
 
 void StorageGatewayClient::DeleteTapeArchiveAsync(const DeleteTapeArchiveRequest& request, const DeleteTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -731,6 +911,16 @@ void StorageGatewayClient::DeleteTapeArchiveAsync(const DeleteTapeArchiveRequest
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTapeArchiveAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTapeArchiveOutcomeCallable StorageGatewayClient::DeleteTapeArchiveCallable(DeleteTapeArchiveRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DeleteTapeArchive, this, std::move(request)));
+}
+
+void StorageGatewayClient::DeleteTapeArchiveAsync(DeleteTapeArchiveRequest&& request, const DeleteTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DeleteTapeArchiveAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DeleteTapeArchiveAsyncHelper(const DeleteTapeArchiveRequest& request, const DeleteTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTapeArchive(request), context);
@@ -754,7 +944,7 @@ DeleteVolumeOutcome StorageGatewayClient::DeleteVolume(const DeleteVolumeRequest
 
 DeleteVolumeOutcomeCallable StorageGatewayClient::DeleteVolumeCallable(const DeleteVolumeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteVolume(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteVolume(request); } );
 }
 
 void StorageGatewayClient::DeleteVolumeAsync(const DeleteVolumeRequest& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -762,6 +952,16 @@ void StorageGatewayClient::DeleteVolumeAsync(const DeleteVolumeRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DeleteVolumeAsyncHelper( request, handler, context ); } );
 }
 
+DeleteVolumeOutcomeCallable StorageGatewayClient::DeleteVolumeCallable(DeleteVolumeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DeleteVolume, this, std::move(request)));
+}
+
+void StorageGatewayClient::DeleteVolumeAsync(DeleteVolumeRequest&& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DeleteVolumeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DeleteVolumeAsyncHelper(const DeleteVolumeRequest& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteVolume(request), context);
@@ -785,7 +985,7 @@ DescribeBandwidthRateLimitOutcome StorageGatewayClient::DescribeBandwidthRateLim
 
 DescribeBandwidthRateLimitOutcomeCallable StorageGatewayClient::DescribeBandwidthRateLimitCallable(const DescribeBandwidthRateLimitRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeBandwidthRateLimit(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeBandwidthRateLimit(request); } );
 }
 
 void StorageGatewayClient::DescribeBandwidthRateLimitAsync(const DescribeBandwidthRateLimitRequest& request, const DescribeBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -793,6 +993,16 @@ void StorageGatewayClient::DescribeBandwidthRateLimitAsync(const DescribeBandwid
   m_executor->Submit( [this, request, handler, context](){ this->DescribeBandwidthRateLimitAsyncHelper( request, handler, context ); } );
 }
 
+DescribeBandwidthRateLimitOutcomeCallable StorageGatewayClient::DescribeBandwidthRateLimitCallable(DescribeBandwidthRateLimitRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DescribeBandwidthRateLimit, this, std::move(request)));
+}
+
+void StorageGatewayClient::DescribeBandwidthRateLimitAsync(DescribeBandwidthRateLimitRequest&& request, const DescribeBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DescribeBandwidthRateLimitAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DescribeBandwidthRateLimitAsyncHelper(const DescribeBandwidthRateLimitRequest& request, const DescribeBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeBandwidthRateLimit(request), context);
@@ -816,7 +1026,7 @@ DescribeCacheOutcome StorageGatewayClient::DescribeCache(const DescribeCacheRequ
 
 DescribeCacheOutcomeCallable StorageGatewayClient::DescribeCacheCallable(const DescribeCacheRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCache(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCache(request); } );
 }
 
 void StorageGatewayClient::DescribeCacheAsync(const DescribeCacheRequest& request, const DescribeCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -824,6 +1034,16 @@ void StorageGatewayClient::DescribeCacheAsync(const DescribeCacheRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCacheAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCacheOutcomeCallable StorageGatewayClient::DescribeCacheCallable(DescribeCacheRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DescribeCache, this, std::move(request)));
+}
+
+void StorageGatewayClient::DescribeCacheAsync(DescribeCacheRequest&& request, const DescribeCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DescribeCacheAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DescribeCacheAsyncHelper(const DescribeCacheRequest& request, const DescribeCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCache(request), context);
@@ -847,7 +1067,7 @@ DescribeCachediSCSIVolumesOutcome StorageGatewayClient::DescribeCachediSCSIVolum
 
 DescribeCachediSCSIVolumesOutcomeCallable StorageGatewayClient::DescribeCachediSCSIVolumesCallable(const DescribeCachediSCSIVolumesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCachediSCSIVolumes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCachediSCSIVolumes(request); } );
 }
 
 void StorageGatewayClient::DescribeCachediSCSIVolumesAsync(const DescribeCachediSCSIVolumesRequest& request, const DescribeCachediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -855,6 +1075,16 @@ void StorageGatewayClient::DescribeCachediSCSIVolumesAsync(const DescribeCachedi
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCachediSCSIVolumesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCachediSCSIVolumesOutcomeCallable StorageGatewayClient::DescribeCachediSCSIVolumesCallable(DescribeCachediSCSIVolumesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DescribeCachediSCSIVolumes, this, std::move(request)));
+}
+
+void StorageGatewayClient::DescribeCachediSCSIVolumesAsync(DescribeCachediSCSIVolumesRequest&& request, const DescribeCachediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DescribeCachediSCSIVolumesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DescribeCachediSCSIVolumesAsyncHelper(const DescribeCachediSCSIVolumesRequest& request, const DescribeCachediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCachediSCSIVolumes(request), context);
@@ -878,7 +1108,7 @@ DescribeChapCredentialsOutcome StorageGatewayClient::DescribeChapCredentials(con
 
 DescribeChapCredentialsOutcomeCallable StorageGatewayClient::DescribeChapCredentialsCallable(const DescribeChapCredentialsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeChapCredentials(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeChapCredentials(request); } );
 }
 
 void StorageGatewayClient::DescribeChapCredentialsAsync(const DescribeChapCredentialsRequest& request, const DescribeChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -886,6 +1116,16 @@ void StorageGatewayClient::DescribeChapCredentialsAsync(const DescribeChapCreden
   m_executor->Submit( [this, request, handler, context](){ this->DescribeChapCredentialsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeChapCredentialsOutcomeCallable StorageGatewayClient::DescribeChapCredentialsCallable(DescribeChapCredentialsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DescribeChapCredentials, this, std::move(request)));
+}
+
+void StorageGatewayClient::DescribeChapCredentialsAsync(DescribeChapCredentialsRequest&& request, const DescribeChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DescribeChapCredentialsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DescribeChapCredentialsAsyncHelper(const DescribeChapCredentialsRequest& request, const DescribeChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeChapCredentials(request), context);
@@ -909,7 +1149,7 @@ DescribeGatewayInformationOutcome StorageGatewayClient::DescribeGatewayInformati
 
 DescribeGatewayInformationOutcomeCallable StorageGatewayClient::DescribeGatewayInformationCallable(const DescribeGatewayInformationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeGatewayInformation(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeGatewayInformation(request); } );
 }
 
 void StorageGatewayClient::DescribeGatewayInformationAsync(const DescribeGatewayInformationRequest& request, const DescribeGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -917,6 +1157,16 @@ void StorageGatewayClient::DescribeGatewayInformationAsync(const DescribeGateway
   m_executor->Submit( [this, request, handler, context](){ this->DescribeGatewayInformationAsyncHelper( request, handler, context ); } );
 }
 
+DescribeGatewayInformationOutcomeCallable StorageGatewayClient::DescribeGatewayInformationCallable(DescribeGatewayInformationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DescribeGatewayInformation, this, std::move(request)));
+}
+
+void StorageGatewayClient::DescribeGatewayInformationAsync(DescribeGatewayInformationRequest&& request, const DescribeGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DescribeGatewayInformationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DescribeGatewayInformationAsyncHelper(const DescribeGatewayInformationRequest& request, const DescribeGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeGatewayInformation(request), context);
@@ -940,7 +1190,7 @@ DescribeMaintenanceStartTimeOutcome StorageGatewayClient::DescribeMaintenanceSta
 
 DescribeMaintenanceStartTimeOutcomeCallable StorageGatewayClient::DescribeMaintenanceStartTimeCallable(const DescribeMaintenanceStartTimeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeMaintenanceStartTime(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeMaintenanceStartTime(request); } );
 }
 
 void StorageGatewayClient::DescribeMaintenanceStartTimeAsync(const DescribeMaintenanceStartTimeRequest& request, const DescribeMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -948,6 +1198,16 @@ void StorageGatewayClient::DescribeMaintenanceStartTimeAsync(const DescribeMaint
   m_executor->Submit( [this, request, handler, context](){ this->DescribeMaintenanceStartTimeAsyncHelper( request, handler, context ); } );
 }
 
+DescribeMaintenanceStartTimeOutcomeCallable StorageGatewayClient::DescribeMaintenanceStartTimeCallable(DescribeMaintenanceStartTimeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DescribeMaintenanceStartTime, this, std::move(request)));
+}
+
+void StorageGatewayClient::DescribeMaintenanceStartTimeAsync(DescribeMaintenanceStartTimeRequest&& request, const DescribeMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DescribeMaintenanceStartTimeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DescribeMaintenanceStartTimeAsyncHelper(const DescribeMaintenanceStartTimeRequest& request, const DescribeMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeMaintenanceStartTime(request), context);
@@ -971,7 +1231,7 @@ DescribeSnapshotScheduleOutcome StorageGatewayClient::DescribeSnapshotSchedule(c
 
 DescribeSnapshotScheduleOutcomeCallable StorageGatewayClient::DescribeSnapshotScheduleCallable(const DescribeSnapshotScheduleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSnapshotSchedule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSnapshotSchedule(request); } );
 }
 
 void StorageGatewayClient::DescribeSnapshotScheduleAsync(const DescribeSnapshotScheduleRequest& request, const DescribeSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -979,6 +1239,16 @@ void StorageGatewayClient::DescribeSnapshotScheduleAsync(const DescribeSnapshotS
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSnapshotScheduleAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSnapshotScheduleOutcomeCallable StorageGatewayClient::DescribeSnapshotScheduleCallable(DescribeSnapshotScheduleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DescribeSnapshotSchedule, this, std::move(request)));
+}
+
+void StorageGatewayClient::DescribeSnapshotScheduleAsync(DescribeSnapshotScheduleRequest&& request, const DescribeSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DescribeSnapshotScheduleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DescribeSnapshotScheduleAsyncHelper(const DescribeSnapshotScheduleRequest& request, const DescribeSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSnapshotSchedule(request), context);
@@ -1002,7 +1272,7 @@ DescribeStorediSCSIVolumesOutcome StorageGatewayClient::DescribeStorediSCSIVolum
 
 DescribeStorediSCSIVolumesOutcomeCallable StorageGatewayClient::DescribeStorediSCSIVolumesCallable(const DescribeStorediSCSIVolumesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeStorediSCSIVolumes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeStorediSCSIVolumes(request); } );
 }
 
 void StorageGatewayClient::DescribeStorediSCSIVolumesAsync(const DescribeStorediSCSIVolumesRequest& request, const DescribeStorediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1010,6 +1280,16 @@ void StorageGatewayClient::DescribeStorediSCSIVolumesAsync(const DescribeStoredi
   m_executor->Submit( [this, request, handler, context](){ this->DescribeStorediSCSIVolumesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeStorediSCSIVolumesOutcomeCallable StorageGatewayClient::DescribeStorediSCSIVolumesCallable(DescribeStorediSCSIVolumesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DescribeStorediSCSIVolumes, this, std::move(request)));
+}
+
+void StorageGatewayClient::DescribeStorediSCSIVolumesAsync(DescribeStorediSCSIVolumesRequest&& request, const DescribeStorediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DescribeStorediSCSIVolumesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DescribeStorediSCSIVolumesAsyncHelper(const DescribeStorediSCSIVolumesRequest& request, const DescribeStorediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeStorediSCSIVolumes(request), context);
@@ -1033,7 +1313,7 @@ DescribeTapeArchivesOutcome StorageGatewayClient::DescribeTapeArchives(const Des
 
 DescribeTapeArchivesOutcomeCallable StorageGatewayClient::DescribeTapeArchivesCallable(const DescribeTapeArchivesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTapeArchives(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTapeArchives(request); } );
 }
 
 void StorageGatewayClient::DescribeTapeArchivesAsync(const DescribeTapeArchivesRequest& request, const DescribeTapeArchivesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1041,6 +1321,16 @@ void StorageGatewayClient::DescribeTapeArchivesAsync(const DescribeTapeArchivesR
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTapeArchivesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTapeArchivesOutcomeCallable StorageGatewayClient::DescribeTapeArchivesCallable(DescribeTapeArchivesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DescribeTapeArchives, this, std::move(request)));
+}
+
+void StorageGatewayClient::DescribeTapeArchivesAsync(DescribeTapeArchivesRequest&& request, const DescribeTapeArchivesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DescribeTapeArchivesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DescribeTapeArchivesAsyncHelper(const DescribeTapeArchivesRequest& request, const DescribeTapeArchivesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTapeArchives(request), context);
@@ -1064,7 +1354,7 @@ DescribeTapeRecoveryPointsOutcome StorageGatewayClient::DescribeTapeRecoveryPoin
 
 DescribeTapeRecoveryPointsOutcomeCallable StorageGatewayClient::DescribeTapeRecoveryPointsCallable(const DescribeTapeRecoveryPointsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTapeRecoveryPoints(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTapeRecoveryPoints(request); } );
 }
 
 void StorageGatewayClient::DescribeTapeRecoveryPointsAsync(const DescribeTapeRecoveryPointsRequest& request, const DescribeTapeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1072,6 +1362,16 @@ void StorageGatewayClient::DescribeTapeRecoveryPointsAsync(const DescribeTapeRec
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTapeRecoveryPointsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTapeRecoveryPointsOutcomeCallable StorageGatewayClient::DescribeTapeRecoveryPointsCallable(DescribeTapeRecoveryPointsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DescribeTapeRecoveryPoints, this, std::move(request)));
+}
+
+void StorageGatewayClient::DescribeTapeRecoveryPointsAsync(DescribeTapeRecoveryPointsRequest&& request, const DescribeTapeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DescribeTapeRecoveryPointsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DescribeTapeRecoveryPointsAsyncHelper(const DescribeTapeRecoveryPointsRequest& request, const DescribeTapeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTapeRecoveryPoints(request), context);
@@ -1095,7 +1395,7 @@ DescribeTapesOutcome StorageGatewayClient::DescribeTapes(const DescribeTapesRequ
 
 DescribeTapesOutcomeCallable StorageGatewayClient::DescribeTapesCallable(const DescribeTapesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTapes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTapes(request); } );
 }
 
 void StorageGatewayClient::DescribeTapesAsync(const DescribeTapesRequest& request, const DescribeTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1103,6 +1403,16 @@ void StorageGatewayClient::DescribeTapesAsync(const DescribeTapesRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTapesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTapesOutcomeCallable StorageGatewayClient::DescribeTapesCallable(DescribeTapesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DescribeTapes, this, std::move(request)));
+}
+
+void StorageGatewayClient::DescribeTapesAsync(DescribeTapesRequest&& request, const DescribeTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DescribeTapesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DescribeTapesAsyncHelper(const DescribeTapesRequest& request, const DescribeTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTapes(request), context);
@@ -1126,7 +1436,7 @@ DescribeUploadBufferOutcome StorageGatewayClient::DescribeUploadBuffer(const Des
 
 DescribeUploadBufferOutcomeCallable StorageGatewayClient::DescribeUploadBufferCallable(const DescribeUploadBufferRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeUploadBuffer(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeUploadBuffer(request); } );
 }
 
 void StorageGatewayClient::DescribeUploadBufferAsync(const DescribeUploadBufferRequest& request, const DescribeUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1134,6 +1444,16 @@ void StorageGatewayClient::DescribeUploadBufferAsync(const DescribeUploadBufferR
   m_executor->Submit( [this, request, handler, context](){ this->DescribeUploadBufferAsyncHelper( request, handler, context ); } );
 }
 
+DescribeUploadBufferOutcomeCallable StorageGatewayClient::DescribeUploadBufferCallable(DescribeUploadBufferRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DescribeUploadBuffer, this, std::move(request)));
+}
+
+void StorageGatewayClient::DescribeUploadBufferAsync(DescribeUploadBufferRequest&& request, const DescribeUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DescribeUploadBufferAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DescribeUploadBufferAsyncHelper(const DescribeUploadBufferRequest& request, const DescribeUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeUploadBuffer(request), context);
@@ -1157,7 +1477,7 @@ DescribeVTLDevicesOutcome StorageGatewayClient::DescribeVTLDevices(const Describ
 
 DescribeVTLDevicesOutcomeCallable StorageGatewayClient::DescribeVTLDevicesCallable(const DescribeVTLDevicesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeVTLDevices(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeVTLDevices(request); } );
 }
 
 void StorageGatewayClient::DescribeVTLDevicesAsync(const DescribeVTLDevicesRequest& request, const DescribeVTLDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1165,6 +1485,16 @@ void StorageGatewayClient::DescribeVTLDevicesAsync(const DescribeVTLDevicesReque
   m_executor->Submit( [this, request, handler, context](){ this->DescribeVTLDevicesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeVTLDevicesOutcomeCallable StorageGatewayClient::DescribeVTLDevicesCallable(DescribeVTLDevicesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DescribeVTLDevices, this, std::move(request)));
+}
+
+void StorageGatewayClient::DescribeVTLDevicesAsync(DescribeVTLDevicesRequest&& request, const DescribeVTLDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DescribeVTLDevicesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DescribeVTLDevicesAsyncHelper(const DescribeVTLDevicesRequest& request, const DescribeVTLDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeVTLDevices(request), context);
@@ -1188,7 +1518,7 @@ DescribeWorkingStorageOutcome StorageGatewayClient::DescribeWorkingStorage(const
 
 DescribeWorkingStorageOutcomeCallable StorageGatewayClient::DescribeWorkingStorageCallable(const DescribeWorkingStorageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeWorkingStorage(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeWorkingStorage(request); } );
 }
 
 void StorageGatewayClient::DescribeWorkingStorageAsync(const DescribeWorkingStorageRequest& request, const DescribeWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1196,6 +1526,16 @@ void StorageGatewayClient::DescribeWorkingStorageAsync(const DescribeWorkingStor
   m_executor->Submit( [this, request, handler, context](){ this->DescribeWorkingStorageAsyncHelper( request, handler, context ); } );
 }
 
+DescribeWorkingStorageOutcomeCallable StorageGatewayClient::DescribeWorkingStorageCallable(DescribeWorkingStorageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DescribeWorkingStorage, this, std::move(request)));
+}
+
+void StorageGatewayClient::DescribeWorkingStorageAsync(DescribeWorkingStorageRequest&& request, const DescribeWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DescribeWorkingStorageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DescribeWorkingStorageAsyncHelper(const DescribeWorkingStorageRequest& request, const DescribeWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeWorkingStorage(request), context);
@@ -1219,7 +1559,7 @@ DisableGatewayOutcome StorageGatewayClient::DisableGateway(const DisableGatewayR
 
 DisableGatewayOutcomeCallable StorageGatewayClient::DisableGatewayCallable(const DisableGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DisableGateway(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DisableGateway(request); } );
 }
 
 void StorageGatewayClient::DisableGatewayAsync(const DisableGatewayRequest& request, const DisableGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1227,6 +1567,16 @@ void StorageGatewayClient::DisableGatewayAsync(const DisableGatewayRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->DisableGatewayAsyncHelper( request, handler, context ); } );
 }
 
+DisableGatewayOutcomeCallable StorageGatewayClient::DisableGatewayCallable(DisableGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::DisableGateway, this, std::move(request)));
+}
+
+void StorageGatewayClient::DisableGatewayAsync(DisableGatewayRequest&& request, const DisableGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::DisableGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::DisableGatewayAsyncHelper(const DisableGatewayRequest& request, const DisableGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DisableGateway(request), context);
@@ -1250,7 +1600,7 @@ ListGatewaysOutcome StorageGatewayClient::ListGateways(const ListGatewaysRequest
 
 ListGatewaysOutcomeCallable StorageGatewayClient::ListGatewaysCallable(const ListGatewaysRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListGateways(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListGateways(request); } );
 }
 
 void StorageGatewayClient::ListGatewaysAsync(const ListGatewaysRequest& request, const ListGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1258,6 +1608,16 @@ void StorageGatewayClient::ListGatewaysAsync(const ListGatewaysRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ListGatewaysAsyncHelper( request, handler, context ); } );
 }
 
+ListGatewaysOutcomeCallable StorageGatewayClient::ListGatewaysCallable(ListGatewaysRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::ListGateways, this, std::move(request)));
+}
+
+void StorageGatewayClient::ListGatewaysAsync(ListGatewaysRequest&& request, const ListGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::ListGatewaysAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::ListGatewaysAsyncHelper(const ListGatewaysRequest& request, const ListGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListGateways(request), context);
@@ -1281,7 +1641,7 @@ ListLocalDisksOutcome StorageGatewayClient::ListLocalDisks(const ListLocalDisksR
 
 ListLocalDisksOutcomeCallable StorageGatewayClient::ListLocalDisksCallable(const ListLocalDisksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListLocalDisks(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListLocalDisks(request); } );
 }
 
 void StorageGatewayClient::ListLocalDisksAsync(const ListLocalDisksRequest& request, const ListLocalDisksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1289,6 +1649,16 @@ void StorageGatewayClient::ListLocalDisksAsync(const ListLocalDisksRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->ListLocalDisksAsyncHelper( request, handler, context ); } );
 }
 
+ListLocalDisksOutcomeCallable StorageGatewayClient::ListLocalDisksCallable(ListLocalDisksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::ListLocalDisks, this, std::move(request)));
+}
+
+void StorageGatewayClient::ListLocalDisksAsync(ListLocalDisksRequest&& request, const ListLocalDisksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::ListLocalDisksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::ListLocalDisksAsyncHelper(const ListLocalDisksRequest& request, const ListLocalDisksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListLocalDisks(request), context);
@@ -1312,7 +1682,7 @@ ListTagsForResourceOutcome StorageGatewayClient::ListTagsForResource(const ListT
 
 ListTagsForResourceOutcomeCallable StorageGatewayClient::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTagsForResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTagsForResource(request); } );
 }
 
 void StorageGatewayClient::ListTagsForResourceAsync(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1320,6 +1690,16 @@ void StorageGatewayClient::ListTagsForResourceAsync(const ListTagsForResourceReq
   m_executor->Submit( [this, request, handler, context](){ this->ListTagsForResourceAsyncHelper( request, handler, context ); } );
 }
 
+ListTagsForResourceOutcomeCallable StorageGatewayClient::ListTagsForResourceCallable(ListTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::ListTagsForResource, this, std::move(request)));
+}
+
+void StorageGatewayClient::ListTagsForResourceAsync(ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::ListTagsForResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTagsForResource(request), context);
@@ -1343,7 +1723,7 @@ ListTapesOutcome StorageGatewayClient::ListTapes(const ListTapesRequest& request
 
 ListTapesOutcomeCallable StorageGatewayClient::ListTapesCallable(const ListTapesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListTapes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListTapes(request); } );
 }
 
 void StorageGatewayClient::ListTapesAsync(const ListTapesRequest& request, const ListTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1351,6 +1731,16 @@ void StorageGatewayClient::ListTapesAsync(const ListTapesRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->ListTapesAsyncHelper( request, handler, context ); } );
 }
 
+ListTapesOutcomeCallable StorageGatewayClient::ListTapesCallable(ListTapesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::ListTapes, this, std::move(request)));
+}
+
+void StorageGatewayClient::ListTapesAsync(ListTapesRequest&& request, const ListTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::ListTapesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::ListTapesAsyncHelper(const ListTapesRequest& request, const ListTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListTapes(request), context);
@@ -1374,7 +1764,7 @@ ListVolumeInitiatorsOutcome StorageGatewayClient::ListVolumeInitiators(const Lis
 
 ListVolumeInitiatorsOutcomeCallable StorageGatewayClient::ListVolumeInitiatorsCallable(const ListVolumeInitiatorsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListVolumeInitiators(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListVolumeInitiators(request); } );
 }
 
 void StorageGatewayClient::ListVolumeInitiatorsAsync(const ListVolumeInitiatorsRequest& request, const ListVolumeInitiatorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1382,6 +1772,16 @@ void StorageGatewayClient::ListVolumeInitiatorsAsync(const ListVolumeInitiatorsR
   m_executor->Submit( [this, request, handler, context](){ this->ListVolumeInitiatorsAsyncHelper( request, handler, context ); } );
 }
 
+ListVolumeInitiatorsOutcomeCallable StorageGatewayClient::ListVolumeInitiatorsCallable(ListVolumeInitiatorsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::ListVolumeInitiators, this, std::move(request)));
+}
+
+void StorageGatewayClient::ListVolumeInitiatorsAsync(ListVolumeInitiatorsRequest&& request, const ListVolumeInitiatorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::ListVolumeInitiatorsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::ListVolumeInitiatorsAsyncHelper(const ListVolumeInitiatorsRequest& request, const ListVolumeInitiatorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListVolumeInitiators(request), context);
@@ -1405,7 +1805,7 @@ ListVolumeRecoveryPointsOutcome StorageGatewayClient::ListVolumeRecoveryPoints(c
 
 ListVolumeRecoveryPointsOutcomeCallable StorageGatewayClient::ListVolumeRecoveryPointsCallable(const ListVolumeRecoveryPointsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListVolumeRecoveryPoints(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListVolumeRecoveryPoints(request); } );
 }
 
 void StorageGatewayClient::ListVolumeRecoveryPointsAsync(const ListVolumeRecoveryPointsRequest& request, const ListVolumeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1413,6 +1813,16 @@ void StorageGatewayClient::ListVolumeRecoveryPointsAsync(const ListVolumeRecover
   m_executor->Submit( [this, request, handler, context](){ this->ListVolumeRecoveryPointsAsyncHelper( request, handler, context ); } );
 }
 
+ListVolumeRecoveryPointsOutcomeCallable StorageGatewayClient::ListVolumeRecoveryPointsCallable(ListVolumeRecoveryPointsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::ListVolumeRecoveryPoints, this, std::move(request)));
+}
+
+void StorageGatewayClient::ListVolumeRecoveryPointsAsync(ListVolumeRecoveryPointsRequest&& request, const ListVolumeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::ListVolumeRecoveryPointsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::ListVolumeRecoveryPointsAsyncHelper(const ListVolumeRecoveryPointsRequest& request, const ListVolumeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListVolumeRecoveryPoints(request), context);
@@ -1436,7 +1846,7 @@ ListVolumesOutcome StorageGatewayClient::ListVolumes(const ListVolumesRequest& r
 
 ListVolumesOutcomeCallable StorageGatewayClient::ListVolumesCallable(const ListVolumesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListVolumes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListVolumes(request); } );
 }
 
 void StorageGatewayClient::ListVolumesAsync(const ListVolumesRequest& request, const ListVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1444,6 +1854,16 @@ void StorageGatewayClient::ListVolumesAsync(const ListVolumesRequest& request, c
   m_executor->Submit( [this, request, handler, context](){ this->ListVolumesAsyncHelper( request, handler, context ); } );
 }
 
+ListVolumesOutcomeCallable StorageGatewayClient::ListVolumesCallable(ListVolumesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::ListVolumes, this, std::move(request)));
+}
+
+void StorageGatewayClient::ListVolumesAsync(ListVolumesRequest&& request, const ListVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::ListVolumesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::ListVolumesAsyncHelper(const ListVolumesRequest& request, const ListVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListVolumes(request), context);
@@ -1467,7 +1887,7 @@ RemoveTagsFromResourceOutcome StorageGatewayClient::RemoveTagsFromResource(const
 
 RemoveTagsFromResourceOutcomeCallable StorageGatewayClient::RemoveTagsFromResourceCallable(const RemoveTagsFromResourceRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RemoveTagsFromResource(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RemoveTagsFromResource(request); } );
 }
 
 void StorageGatewayClient::RemoveTagsFromResourceAsync(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1475,14 +1895,24 @@ void StorageGatewayClient::RemoveTagsFromResourceAsync(const RemoveTagsFromResou
   m_executor->Submit( [this, request, handler, context](){ this->RemoveTagsFromResourceAsyncHelper( request, handler, context ); } );
 }
 
-void StorageGatewayClient::RemoveTagsFromResourceAsyncHelper(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+RemoveTagsFromResourceOutcomeCallable StorageGatewayClient::RemoveTagsFromResourceCallable(RemoveTagsFromResourceRequest&& request) const
 {
-  handler(this, request, RemoveTagsFromResource(request), context);
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::RemoveTagsFromResource, this, std::move(request)));
 }
 
-ResetCacheOutcome StorageGatewayClient::ResetCache(const ResetCacheRequest& request) const
+void StorageGatewayClient::RemoveTagsFromResourceAsync(RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  Aws::StringStream ss;
+  m_executor->Submit(&StorageGatewayClient::RemoveTagsFromResourceAsyncHelper, this, std::move(request), handler, context);
+}
+
+void StorageGatewayClient::RemoveTagsFromResourceAsyncHelper(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  handler(this, request, RemoveTagsFromResource(request), context);
+}
+
+ResetCacheOutcome StorageGatewayClient::ResetCache(const ResetCacheRequest& request) const
+{
+  Aws::StringStream ss;
   ss << m_uri << "/";
 
   JsonOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
@@ -1498,7 +1928,7 @@ ResetCacheOutcome StorageGatewayClient::ResetCache(const ResetCacheRequest& requ
 
 ResetCacheOutcomeCallable StorageGatewayClient::ResetCacheCallable(const ResetCacheRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResetCache(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResetCache(request); } );
 }
 
 void StorageGatewayClient::ResetCacheAsync(const ResetCacheRequest& request, const ResetCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1506,6 +1936,16 @@ void StorageGatewayClient::ResetCacheAsync(const ResetCacheRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->ResetCacheAsyncHelper( request, handler, context ); } );
 }
 
+ResetCacheOutcomeCallable StorageGatewayClient::ResetCacheCallable(ResetCacheRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::ResetCache, this, std::move(request)));
+}
+
+void StorageGatewayClient::ResetCacheAsync(ResetCacheRequest&& request, const ResetCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::ResetCacheAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::ResetCacheAsyncHelper(const ResetCacheRequest& request, const ResetCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResetCache(request), context);
@@ -1529,7 +1969,7 @@ RetrieveTapeArchiveOutcome StorageGatewayClient::RetrieveTapeArchive(const Retri
 
 RetrieveTapeArchiveOutcomeCallable StorageGatewayClient::RetrieveTapeArchiveCallable(const RetrieveTapeArchiveRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RetrieveTapeArchive(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RetrieveTapeArchive(request); } );
 }
 
 void StorageGatewayClient::RetrieveTapeArchiveAsync(const RetrieveTapeArchiveRequest& request, const RetrieveTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1537,6 +1977,16 @@ void StorageGatewayClient::RetrieveTapeArchiveAsync(const RetrieveTapeArchiveReq
   m_executor->Submit( [this, request, handler, context](){ this->RetrieveTapeArchiveAsyncHelper( request, handler, context ); } );
 }
 
+RetrieveTapeArchiveOutcomeCallable StorageGatewayClient::RetrieveTapeArchiveCallable(RetrieveTapeArchiveRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::RetrieveTapeArchive, this, std::move(request)));
+}
+
+void StorageGatewayClient::RetrieveTapeArchiveAsync(RetrieveTapeArchiveRequest&& request, const RetrieveTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::RetrieveTapeArchiveAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::RetrieveTapeArchiveAsyncHelper(const RetrieveTapeArchiveRequest& request, const RetrieveTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RetrieveTapeArchive(request), context);
@@ -1560,7 +2010,7 @@ RetrieveTapeRecoveryPointOutcome StorageGatewayClient::RetrieveTapeRecoveryPoint
 
 RetrieveTapeRecoveryPointOutcomeCallable StorageGatewayClient::RetrieveTapeRecoveryPointCallable(const RetrieveTapeRecoveryPointRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RetrieveTapeRecoveryPoint(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RetrieveTapeRecoveryPoint(request); } );
 }
 
 void StorageGatewayClient::RetrieveTapeRecoveryPointAsync(const RetrieveTapeRecoveryPointRequest& request, const RetrieveTapeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1568,6 +2018,16 @@ void StorageGatewayClient::RetrieveTapeRecoveryPointAsync(const RetrieveTapeReco
   m_executor->Submit( [this, request, handler, context](){ this->RetrieveTapeRecoveryPointAsyncHelper( request, handler, context ); } );
 }
 
+RetrieveTapeRecoveryPointOutcomeCallable StorageGatewayClient::RetrieveTapeRecoveryPointCallable(RetrieveTapeRecoveryPointRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::RetrieveTapeRecoveryPoint, this, std::move(request)));
+}
+
+void StorageGatewayClient::RetrieveTapeRecoveryPointAsync(RetrieveTapeRecoveryPointRequest&& request, const RetrieveTapeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::RetrieveTapeRecoveryPointAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::RetrieveTapeRecoveryPointAsyncHelper(const RetrieveTapeRecoveryPointRequest& request, const RetrieveTapeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RetrieveTapeRecoveryPoint(request), context);
@@ -1591,7 +2051,7 @@ SetLocalConsolePasswordOutcome StorageGatewayClient::SetLocalConsolePassword(con
 
 SetLocalConsolePasswordOutcomeCallable StorageGatewayClient::SetLocalConsolePasswordCallable(const SetLocalConsolePasswordRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SetLocalConsolePassword(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SetLocalConsolePassword(request); } );
 }
 
 void StorageGatewayClient::SetLocalConsolePasswordAsync(const SetLocalConsolePasswordRequest& request, const SetLocalConsolePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1599,6 +2059,16 @@ void StorageGatewayClient::SetLocalConsolePasswordAsync(const SetLocalConsolePas
   m_executor->Submit( [this, request, handler, context](){ this->SetLocalConsolePasswordAsyncHelper( request, handler, context ); } );
 }
 
+SetLocalConsolePasswordOutcomeCallable StorageGatewayClient::SetLocalConsolePasswordCallable(SetLocalConsolePasswordRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::SetLocalConsolePassword, this, std::move(request)));
+}
+
+void StorageGatewayClient::SetLocalConsolePasswordAsync(SetLocalConsolePasswordRequest&& request, const SetLocalConsolePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::SetLocalConsolePasswordAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::SetLocalConsolePasswordAsyncHelper(const SetLocalConsolePasswordRequest& request, const SetLocalConsolePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SetLocalConsolePassword(request), context);
@@ -1622,7 +2092,7 @@ ShutdownGatewayOutcome StorageGatewayClient::ShutdownGateway(const ShutdownGatew
 
 ShutdownGatewayOutcomeCallable StorageGatewayClient::ShutdownGatewayCallable(const ShutdownGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ShutdownGateway(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ShutdownGateway(request); } );
 }
 
 void StorageGatewayClient::ShutdownGatewayAsync(const ShutdownGatewayRequest& request, const ShutdownGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1630,6 +2100,16 @@ void StorageGatewayClient::ShutdownGatewayAsync(const ShutdownGatewayRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->ShutdownGatewayAsyncHelper( request, handler, context ); } );
 }
 
+ShutdownGatewayOutcomeCallable StorageGatewayClient::ShutdownGatewayCallable(ShutdownGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::ShutdownGateway, this, std::move(request)));
+}
+
+void StorageGatewayClient::ShutdownGatewayAsync(ShutdownGatewayRequest&& request, const ShutdownGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::ShutdownGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::ShutdownGatewayAsyncHelper(const ShutdownGatewayRequest& request, const ShutdownGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ShutdownGateway(request), context);
@@ -1653,7 +2133,7 @@ StartGatewayOutcome StorageGatewayClient::StartGateway(const StartGatewayRequest
 
 StartGatewayOutcomeCallable StorageGatewayClient::StartGatewayCallable(const StartGatewayRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StartGateway(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StartGateway(request); } );
 }
 
 void StorageGatewayClient::StartGatewayAsync(const StartGatewayRequest& request, const StartGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1661,6 +2141,16 @@ void StorageGatewayClient::StartGatewayAsync(const StartGatewayRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->StartGatewayAsyncHelper( request, handler, context ); } );
 }
 
+StartGatewayOutcomeCallable StorageGatewayClient::StartGatewayCallable(StartGatewayRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::StartGateway, this, std::move(request)));
+}
+
+void StorageGatewayClient::StartGatewayAsync(StartGatewayRequest&& request, const StartGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::StartGatewayAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::StartGatewayAsyncHelper(const StartGatewayRequest& request, const StartGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StartGateway(request), context);
@@ -1684,7 +2174,7 @@ UpdateBandwidthRateLimitOutcome StorageGatewayClient::UpdateBandwidthRateLimit(c
 
 UpdateBandwidthRateLimitOutcomeCallable StorageGatewayClient::UpdateBandwidthRateLimitCallable(const UpdateBandwidthRateLimitRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateBandwidthRateLimit(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateBandwidthRateLimit(request); } );
 }
 
 void StorageGatewayClient::UpdateBandwidthRateLimitAsync(const UpdateBandwidthRateLimitRequest& request, const UpdateBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1692,6 +2182,16 @@ void StorageGatewayClient::UpdateBandwidthRateLimitAsync(const UpdateBandwidthRa
   m_executor->Submit( [this, request, handler, context](){ this->UpdateBandwidthRateLimitAsyncHelper( request, handler, context ); } );
 }
 
+UpdateBandwidthRateLimitOutcomeCallable StorageGatewayClient::UpdateBandwidthRateLimitCallable(UpdateBandwidthRateLimitRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::UpdateBandwidthRateLimit, this, std::move(request)));
+}
+
+void StorageGatewayClient::UpdateBandwidthRateLimitAsync(UpdateBandwidthRateLimitRequest&& request, const UpdateBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::UpdateBandwidthRateLimitAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::UpdateBandwidthRateLimitAsyncHelper(const UpdateBandwidthRateLimitRequest& request, const UpdateBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateBandwidthRateLimit(request), context);
@@ -1715,7 +2215,7 @@ UpdateChapCredentialsOutcome StorageGatewayClient::UpdateChapCredentials(const U
 
 UpdateChapCredentialsOutcomeCallable StorageGatewayClient::UpdateChapCredentialsCallable(const UpdateChapCredentialsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateChapCredentials(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateChapCredentials(request); } );
 }
 
 void StorageGatewayClient::UpdateChapCredentialsAsync(const UpdateChapCredentialsRequest& request, const UpdateChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1723,6 +2223,16 @@ void StorageGatewayClient::UpdateChapCredentialsAsync(const UpdateChapCredential
   m_executor->Submit( [this, request, handler, context](){ this->UpdateChapCredentialsAsyncHelper( request, handler, context ); } );
 }
 
+UpdateChapCredentialsOutcomeCallable StorageGatewayClient::UpdateChapCredentialsCallable(UpdateChapCredentialsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::UpdateChapCredentials, this, std::move(request)));
+}
+
+void StorageGatewayClient::UpdateChapCredentialsAsync(UpdateChapCredentialsRequest&& request, const UpdateChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::UpdateChapCredentialsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::UpdateChapCredentialsAsyncHelper(const UpdateChapCredentialsRequest& request, const UpdateChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateChapCredentials(request), context);
@@ -1746,7 +2256,7 @@ UpdateGatewayInformationOutcome StorageGatewayClient::UpdateGatewayInformation(c
 
 UpdateGatewayInformationOutcomeCallable StorageGatewayClient::UpdateGatewayInformationCallable(const UpdateGatewayInformationRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateGatewayInformation(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateGatewayInformation(request); } );
 }
 
 void StorageGatewayClient::UpdateGatewayInformationAsync(const UpdateGatewayInformationRequest& request, const UpdateGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1754,6 +2264,16 @@ void StorageGatewayClient::UpdateGatewayInformationAsync(const UpdateGatewayInfo
   m_executor->Submit( [this, request, handler, context](){ this->UpdateGatewayInformationAsyncHelper( request, handler, context ); } );
 }
 
+UpdateGatewayInformationOutcomeCallable StorageGatewayClient::UpdateGatewayInformationCallable(UpdateGatewayInformationRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::UpdateGatewayInformation, this, std::move(request)));
+}
+
+void StorageGatewayClient::UpdateGatewayInformationAsync(UpdateGatewayInformationRequest&& request, const UpdateGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::UpdateGatewayInformationAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::UpdateGatewayInformationAsyncHelper(const UpdateGatewayInformationRequest& request, const UpdateGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateGatewayInformation(request), context);
@@ -1777,7 +2297,7 @@ UpdateGatewaySoftwareNowOutcome StorageGatewayClient::UpdateGatewaySoftwareNow(c
 
 UpdateGatewaySoftwareNowOutcomeCallable StorageGatewayClient::UpdateGatewaySoftwareNowCallable(const UpdateGatewaySoftwareNowRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateGatewaySoftwareNow(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateGatewaySoftwareNow(request); } );
 }
 
 void StorageGatewayClient::UpdateGatewaySoftwareNowAsync(const UpdateGatewaySoftwareNowRequest& request, const UpdateGatewaySoftwareNowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1785,6 +2305,16 @@ void StorageGatewayClient::UpdateGatewaySoftwareNowAsync(const UpdateGatewaySoft
   m_executor->Submit( [this, request, handler, context](){ this->UpdateGatewaySoftwareNowAsyncHelper( request, handler, context ); } );
 }
 
+UpdateGatewaySoftwareNowOutcomeCallable StorageGatewayClient::UpdateGatewaySoftwareNowCallable(UpdateGatewaySoftwareNowRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::UpdateGatewaySoftwareNow, this, std::move(request)));
+}
+
+void StorageGatewayClient::UpdateGatewaySoftwareNowAsync(UpdateGatewaySoftwareNowRequest&& request, const UpdateGatewaySoftwareNowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::UpdateGatewaySoftwareNowAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::UpdateGatewaySoftwareNowAsyncHelper(const UpdateGatewaySoftwareNowRequest& request, const UpdateGatewaySoftwareNowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateGatewaySoftwareNow(request), context);
@@ -1808,7 +2338,7 @@ UpdateMaintenanceStartTimeOutcome StorageGatewayClient::UpdateMaintenanceStartTi
 
 UpdateMaintenanceStartTimeOutcomeCallable StorageGatewayClient::UpdateMaintenanceStartTimeCallable(const UpdateMaintenanceStartTimeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateMaintenanceStartTime(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateMaintenanceStartTime(request); } );
 }
 
 void StorageGatewayClient::UpdateMaintenanceStartTimeAsync(const UpdateMaintenanceStartTimeRequest& request, const UpdateMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1816,6 +2346,16 @@ void StorageGatewayClient::UpdateMaintenanceStartTimeAsync(const UpdateMaintenan
   m_executor->Submit( [this, request, handler, context](){ this->UpdateMaintenanceStartTimeAsyncHelper( request, handler, context ); } );
 }
 
+UpdateMaintenanceStartTimeOutcomeCallable StorageGatewayClient::UpdateMaintenanceStartTimeCallable(UpdateMaintenanceStartTimeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::UpdateMaintenanceStartTime, this, std::move(request)));
+}
+
+void StorageGatewayClient::UpdateMaintenanceStartTimeAsync(UpdateMaintenanceStartTimeRequest&& request, const UpdateMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::UpdateMaintenanceStartTimeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::UpdateMaintenanceStartTimeAsyncHelper(const UpdateMaintenanceStartTimeRequest& request, const UpdateMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateMaintenanceStartTime(request), context);
@@ -1839,7 +2379,7 @@ UpdateSnapshotScheduleOutcome StorageGatewayClient::UpdateSnapshotSchedule(const
 
 UpdateSnapshotScheduleOutcomeCallable StorageGatewayClient::UpdateSnapshotScheduleCallable(const UpdateSnapshotScheduleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateSnapshotSchedule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateSnapshotSchedule(request); } );
 }
 
 void StorageGatewayClient::UpdateSnapshotScheduleAsync(const UpdateSnapshotScheduleRequest& request, const UpdateSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1847,6 +2387,16 @@ void StorageGatewayClient::UpdateSnapshotScheduleAsync(const UpdateSnapshotSched
   m_executor->Submit( [this, request, handler, context](){ this->UpdateSnapshotScheduleAsyncHelper( request, handler, context ); } );
 }
 
+UpdateSnapshotScheduleOutcomeCallable StorageGatewayClient::UpdateSnapshotScheduleCallable(UpdateSnapshotScheduleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::UpdateSnapshotSchedule, this, std::move(request)));
+}
+
+void StorageGatewayClient::UpdateSnapshotScheduleAsync(UpdateSnapshotScheduleRequest&& request, const UpdateSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::UpdateSnapshotScheduleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::UpdateSnapshotScheduleAsyncHelper(const UpdateSnapshotScheduleRequest& request, const UpdateSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateSnapshotSchedule(request), context);
@@ -1870,7 +2420,7 @@ UpdateVTLDeviceTypeOutcome StorageGatewayClient::UpdateVTLDeviceType(const Updat
 
 UpdateVTLDeviceTypeOutcomeCallable StorageGatewayClient::UpdateVTLDeviceTypeCallable(const UpdateVTLDeviceTypeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateVTLDeviceType(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateVTLDeviceType(request); } );
 }
 
 void StorageGatewayClient::UpdateVTLDeviceTypeAsync(const UpdateVTLDeviceTypeRequest& request, const UpdateVTLDeviceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1878,8 +2428,436 @@ void StorageGatewayClient::UpdateVTLDeviceTypeAsync(const UpdateVTLDeviceTypeReq
   m_executor->Submit( [this, request, handler, context](){ this->UpdateVTLDeviceTypeAsyncHelper( request, handler, context ); } );
 }
 
+UpdateVTLDeviceTypeOutcomeCallable StorageGatewayClient::UpdateVTLDeviceTypeCallable(UpdateVTLDeviceTypeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&StorageGatewayClient::UpdateVTLDeviceType, this, std::move(request)));
+}
+
+void StorageGatewayClient::UpdateVTLDeviceTypeAsync(UpdateVTLDeviceTypeRequest&& request, const UpdateVTLDeviceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&StorageGatewayClient::UpdateVTLDeviceTypeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void StorageGatewayClient::UpdateVTLDeviceTypeAsyncHelper(const UpdateVTLDeviceTypeRequest& request, const UpdateVTLDeviceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateVTLDeviceType(request), context);
 }
 
+Paginator<StorageGatewayClient, DescribeTapeArchivesRequest, DescribeTapeArchivesOutcome> StorageGatewayClient::DescribeTapeArchivesPaginator(const DescribeTapeArchivesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<StorageGatewayClient, DescribeTapeArchivesRequest, DescribeTapeArchivesOutcome>(this, &StorageGatewayClient::DescribeTapeArchives, request,
+    [](const DescribeTapeArchivesRequest& current, const DescribeTapeArchivesOutcome& outcome, DescribeTapeArchivesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<StorageGatewayClient, DescribeTapeRecoveryPointsRequest, DescribeTapeRecoveryPointsOutcome> StorageGatewayClient::DescribeTapeRecoveryPointsPaginator(const DescribeTapeRecoveryPointsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<StorageGatewayClient, DescribeTapeRecoveryPointsRequest, DescribeTapeRecoveryPointsOutcome>(this, &StorageGatewayClient::DescribeTapeRecoveryPoints, request,
+    [](const DescribeTapeRecoveryPointsRequest& current, const DescribeTapeRecoveryPointsOutcome& outcome, DescribeTapeRecoveryPointsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<StorageGatewayClient, DescribeTapesRequest, DescribeTapesOutcome> StorageGatewayClient::DescribeTapesPaginator(const DescribeTapesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<StorageGatewayClient, DescribeTapesRequest, DescribeTapesOutcome>(this, &StorageGatewayClient::DescribeTapes, request,
+    [](const DescribeTapesRequest& current, const DescribeTapesOutcome& outcome, DescribeTapesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<StorageGatewayClient, DescribeVTLDevicesRequest, DescribeVTLDevicesOutcome> StorageGatewayClient::DescribeVTLDevicesPaginator(const DescribeVTLDevicesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<StorageGatewayClient, DescribeVTLDevicesRequest, DescribeVTLDevicesOutcome>(this, &StorageGatewayClient::DescribeVTLDevices, request,
+    [](const DescribeVTLDevicesRequest& current, const DescribeVTLDevicesOutcome& outcome, DescribeVTLDevicesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<StorageGatewayClient, ListGatewaysRequest, ListGatewaysOutcome> StorageGatewayClient::ListGatewaysPaginator(const ListGatewaysRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<StorageGatewayClient, ListGatewaysRequest, ListGatewaysOutcome>(this, &StorageGatewayClient::ListGateways, request,
+    [](const ListGatewaysRequest& current, const ListGatewaysOutcome& outcome, ListGatewaysRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<StorageGatewayClient, ListTagsForResourceRequest, ListTagsForResourceOutcome> StorageGatewayClient::ListTagsForResourcePaginator(const ListTagsForResourceRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<StorageGatewayClient, ListTagsForResourceRequest, ListTagsForResourceOutcome>(this, &StorageGatewayClient::ListTagsForResource, request,
+    [](const ListTagsForResourceRequest& current, const ListTagsForResourceOutcome& outcome, ListTagsForResourceRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<StorageGatewayClient, ListTapesRequest, ListTapesOutcome> StorageGatewayClient::ListTapesPaginator(const ListTapesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<StorageGatewayClient, ListTapesRequest, ListTapesOutcome>(this, &StorageGatewayClient::ListTapes, request,
+    [](const ListTapesRequest& current, const ListTapesOutcome& outcome, ListTapesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<StorageGatewayClient, ListVolumesRequest, ListVolumesOutcome> StorageGatewayClient::ListVolumesPaginator(const ListVolumesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<StorageGatewayClient, ListVolumesRequest, ListVolumesOutcome>(this, &StorageGatewayClient::ListVolumes, request,
+    [](const ListVolumesRequest& current, const ListVolumesOutcome& outcome, ListVolumesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetMarker();
+      if(token.empty() || token == current.GetMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<StorageGatewayClient, ActivateGatewayRequest, ActivateGatewayOutcome> StorageGatewayClient::ActivateGatewayAwaitable(ActivateGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::ActivateGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, AddCacheRequest, AddCacheOutcome> StorageGatewayClient::AddCacheAwaitable(AddCacheRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::AddCache, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, AddTagsToResourceRequest, AddTagsToResourceOutcome> StorageGatewayClient::AddTagsToResourceAwaitable(AddTagsToResourceRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::AddTagsToResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, AddUploadBufferRequest, AddUploadBufferOutcome> StorageGatewayClient::AddUploadBufferAwaitable(AddUploadBufferRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::AddUploadBuffer, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, AddWorkingStorageRequest, AddWorkingStorageOutcome> StorageGatewayClient::AddWorkingStorageAwaitable(AddWorkingStorageRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::AddWorkingStorage, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, CancelArchivalRequest, CancelArchivalOutcome> StorageGatewayClient::CancelArchivalAwaitable(CancelArchivalRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::CancelArchival, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, CancelRetrievalRequest, CancelRetrievalOutcome> StorageGatewayClient::CancelRetrievalAwaitable(CancelRetrievalRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::CancelRetrieval, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, CreateCachediSCSIVolumeRequest, CreateCachediSCSIVolumeOutcome> StorageGatewayClient::CreateCachediSCSIVolumeAwaitable(CreateCachediSCSIVolumeRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::CreateCachediSCSIVolume, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, CreateSnapshotRequest, CreateSnapshotOutcome> StorageGatewayClient::CreateSnapshotAwaitable(CreateSnapshotRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::CreateSnapshot, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, CreateSnapshotFromVolumeRecoveryPointRequest, CreateSnapshotFromVolumeRecoveryPointOutcome> StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointAwaitable(CreateSnapshotFromVolumeRecoveryPointRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPoint, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, CreateStorediSCSIVolumeRequest, CreateStorediSCSIVolumeOutcome> StorageGatewayClient::CreateStorediSCSIVolumeAwaitable(CreateStorediSCSIVolumeRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::CreateStorediSCSIVolume, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, CreateTapeWithBarcodeRequest, CreateTapeWithBarcodeOutcome> StorageGatewayClient::CreateTapeWithBarcodeAwaitable(CreateTapeWithBarcodeRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::CreateTapeWithBarcode, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, CreateTapesRequest, CreateTapesOutcome> StorageGatewayClient::CreateTapesAwaitable(CreateTapesRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::CreateTapes, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DeleteBandwidthRateLimitRequest, DeleteBandwidthRateLimitOutcome> StorageGatewayClient::DeleteBandwidthRateLimitAwaitable(DeleteBandwidthRateLimitRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DeleteBandwidthRateLimit, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DeleteChapCredentialsRequest, DeleteChapCredentialsOutcome> StorageGatewayClient::DeleteChapCredentialsAwaitable(DeleteChapCredentialsRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DeleteChapCredentials, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DeleteGatewayRequest, DeleteGatewayOutcome> StorageGatewayClient::DeleteGatewayAwaitable(DeleteGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DeleteGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DeleteSnapshotScheduleRequest, DeleteSnapshotScheduleOutcome> StorageGatewayClient::DeleteSnapshotScheduleAwaitable(DeleteSnapshotScheduleRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DeleteSnapshotSchedule, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DeleteTapeRequest, DeleteTapeOutcome> StorageGatewayClient::DeleteTapeAwaitable(DeleteTapeRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DeleteTape, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DeleteTapeArchiveRequest, DeleteTapeArchiveOutcome> StorageGatewayClient::DeleteTapeArchiveAwaitable(DeleteTapeArchiveRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DeleteTapeArchive, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DeleteVolumeRequest, DeleteVolumeOutcome> StorageGatewayClient::DeleteVolumeAwaitable(DeleteVolumeRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DeleteVolume, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DescribeBandwidthRateLimitRequest, DescribeBandwidthRateLimitOutcome> StorageGatewayClient::DescribeBandwidthRateLimitAwaitable(DescribeBandwidthRateLimitRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DescribeBandwidthRateLimit, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DescribeCacheRequest, DescribeCacheOutcome> StorageGatewayClient::DescribeCacheAwaitable(DescribeCacheRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DescribeCache, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DescribeCachediSCSIVolumesRequest, DescribeCachediSCSIVolumesOutcome> StorageGatewayClient::DescribeCachediSCSIVolumesAwaitable(DescribeCachediSCSIVolumesRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DescribeCachediSCSIVolumes, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DescribeChapCredentialsRequest, DescribeChapCredentialsOutcome> StorageGatewayClient::DescribeChapCredentialsAwaitable(DescribeChapCredentialsRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DescribeChapCredentials, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DescribeGatewayInformationRequest, DescribeGatewayInformationOutcome> StorageGatewayClient::DescribeGatewayInformationAwaitable(DescribeGatewayInformationRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DescribeGatewayInformation, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DescribeMaintenanceStartTimeRequest, DescribeMaintenanceStartTimeOutcome> StorageGatewayClient::DescribeMaintenanceStartTimeAwaitable(DescribeMaintenanceStartTimeRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DescribeMaintenanceStartTime, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DescribeSnapshotScheduleRequest, DescribeSnapshotScheduleOutcome> StorageGatewayClient::DescribeSnapshotScheduleAwaitable(DescribeSnapshotScheduleRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DescribeSnapshotSchedule, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DescribeStorediSCSIVolumesRequest, DescribeStorediSCSIVolumesOutcome> StorageGatewayClient::DescribeStorediSCSIVolumesAwaitable(DescribeStorediSCSIVolumesRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DescribeStorediSCSIVolumes, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DescribeTapeArchivesRequest, DescribeTapeArchivesOutcome> StorageGatewayClient::DescribeTapeArchivesAwaitable(DescribeTapeArchivesRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DescribeTapeArchives, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DescribeTapeRecoveryPointsRequest, DescribeTapeRecoveryPointsOutcome> StorageGatewayClient::DescribeTapeRecoveryPointsAwaitable(DescribeTapeRecoveryPointsRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DescribeTapeRecoveryPoints, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DescribeTapesRequest, DescribeTapesOutcome> StorageGatewayClient::DescribeTapesAwaitable(DescribeTapesRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DescribeTapes, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DescribeUploadBufferRequest, DescribeUploadBufferOutcome> StorageGatewayClient::DescribeUploadBufferAwaitable(DescribeUploadBufferRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DescribeUploadBuffer, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DescribeVTLDevicesRequest, DescribeVTLDevicesOutcome> StorageGatewayClient::DescribeVTLDevicesAwaitable(DescribeVTLDevicesRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DescribeVTLDevices, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DescribeWorkingStorageRequest, DescribeWorkingStorageOutcome> StorageGatewayClient::DescribeWorkingStorageAwaitable(DescribeWorkingStorageRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DescribeWorkingStorage, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, DisableGatewayRequest, DisableGatewayOutcome> StorageGatewayClient::DisableGatewayAwaitable(DisableGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::DisableGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, ListGatewaysRequest, ListGatewaysOutcome> StorageGatewayClient::ListGatewaysAwaitable(ListGatewaysRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::ListGateways, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, ListLocalDisksRequest, ListLocalDisksOutcome> StorageGatewayClient::ListLocalDisksAwaitable(ListLocalDisksRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::ListLocalDisks, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, ListTagsForResourceRequest, ListTagsForResourceOutcome> StorageGatewayClient::ListTagsForResourceAwaitable(ListTagsForResourceRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::ListTagsForResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, ListTapesRequest, ListTapesOutcome> StorageGatewayClient::ListTapesAwaitable(ListTapesRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::ListTapes, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, ListVolumeInitiatorsRequest, ListVolumeInitiatorsOutcome> StorageGatewayClient::ListVolumeInitiatorsAwaitable(ListVolumeInitiatorsRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::ListVolumeInitiators, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, ListVolumeRecoveryPointsRequest, ListVolumeRecoveryPointsOutcome> StorageGatewayClient::ListVolumeRecoveryPointsAwaitable(ListVolumeRecoveryPointsRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::ListVolumeRecoveryPoints, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, ListVolumesRequest, ListVolumesOutcome> StorageGatewayClient::ListVolumesAwaitable(ListVolumesRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::ListVolumes, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, RemoveTagsFromResourceRequest, RemoveTagsFromResourceOutcome> StorageGatewayClient::RemoveTagsFromResourceAwaitable(RemoveTagsFromResourceRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::RemoveTagsFromResource, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, ResetCacheRequest, ResetCacheOutcome> StorageGatewayClient::ResetCacheAwaitable(ResetCacheRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::ResetCache, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, RetrieveTapeArchiveRequest, RetrieveTapeArchiveOutcome> StorageGatewayClient::RetrieveTapeArchiveAwaitable(RetrieveTapeArchiveRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::RetrieveTapeArchive, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, RetrieveTapeRecoveryPointRequest, RetrieveTapeRecoveryPointOutcome> StorageGatewayClient::RetrieveTapeRecoveryPointAwaitable(RetrieveTapeRecoveryPointRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::RetrieveTapeRecoveryPoint, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, SetLocalConsolePasswordRequest, SetLocalConsolePasswordOutcome> StorageGatewayClient::SetLocalConsolePasswordAwaitable(SetLocalConsolePasswordRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::SetLocalConsolePassword, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, ShutdownGatewayRequest, ShutdownGatewayOutcome> StorageGatewayClient::ShutdownGatewayAwaitable(ShutdownGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::ShutdownGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, StartGatewayRequest, StartGatewayOutcome> StorageGatewayClient::StartGatewayAwaitable(StartGatewayRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::StartGateway, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, UpdateBandwidthRateLimitRequest, UpdateBandwidthRateLimitOutcome> StorageGatewayClient::UpdateBandwidthRateLimitAwaitable(UpdateBandwidthRateLimitRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::UpdateBandwidthRateLimit, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, UpdateChapCredentialsRequest, UpdateChapCredentialsOutcome> StorageGatewayClient::UpdateChapCredentialsAwaitable(UpdateChapCredentialsRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::UpdateChapCredentials, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, UpdateGatewayInformationRequest, UpdateGatewayInformationOutcome> StorageGatewayClient::UpdateGatewayInformationAwaitable(UpdateGatewayInformationRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::UpdateGatewayInformation, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, UpdateGatewaySoftwareNowRequest, UpdateGatewaySoftwareNowOutcome> StorageGatewayClient::UpdateGatewaySoftwareNowAwaitable(UpdateGatewaySoftwareNowRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::UpdateGatewaySoftwareNow, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, UpdateMaintenanceStartTimeRequest, UpdateMaintenanceStartTimeOutcome> StorageGatewayClient::UpdateMaintenanceStartTimeAwaitable(UpdateMaintenanceStartTimeRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::UpdateMaintenanceStartTime, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, UpdateSnapshotScheduleRequest, UpdateSnapshotScheduleOutcome> StorageGatewayClient::UpdateSnapshotScheduleAwaitable(UpdateSnapshotScheduleRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::UpdateSnapshotSchedule, std::move(request) } };
+}
+
+ClientOperationAwaitable<StorageGatewayClient, UpdateVTLDeviceTypeRequest, UpdateVTLDeviceTypeOutcome> StorageGatewayClient::UpdateVTLDeviceTypeAwaitable(UpdateVTLDeviceTypeRequest request) const
+{
+  return { m_executor.get(), { this, &StorageGatewayClient::UpdateVTLDeviceType, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
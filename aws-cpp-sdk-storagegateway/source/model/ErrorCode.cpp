@@ -29,316 +29,206 @@ namespace Aws
       namespace ErrorCodeMapper
       {
 
-        static const int ActivationKeyExpired_HASH = HashingUtils::HashString("ActivationKeyExpired");
-        static const int ActivationKeyInvalid_HASH = HashingUtils::HashString("ActivationKeyInvalid");
-        static const int ActivationKeyNotFound_HASH = HashingUtils::HashString("ActivationKeyNotFound");
-        static const int GatewayInternalError_HASH = HashingUtils::HashString("GatewayInternalError");
-        static const int GatewayNotConnected_HASH = HashingUtils::HashString("GatewayNotConnected");
-        static const int GatewayNotFound_HASH = HashingUtils::HashString("GatewayNotFound");
-        static const int GatewayProxyNetworkConnectionBusy_HASH = HashingUtils::HashString("GatewayProxyNetworkConnectionBusy");
-        static const int AuthenticationFailure_HASH = HashingUtils::HashString("AuthenticationFailure");
-        static const int BandwidthThrottleScheduleNotFound_HASH = HashingUtils::HashString("BandwidthThrottleScheduleNotFound");
-        static const int Blocked_HASH = HashingUtils::HashString("Blocked");
-        static const int CannotExportSnapshot_HASH = HashingUtils::HashString("CannotExportSnapshot");
-        static const int ChapCredentialNotFound_HASH = HashingUtils::HashString("ChapCredentialNotFound");
-        static const int DiskAlreadyAllocated_HASH = HashingUtils::HashString("DiskAlreadyAllocated");
-        static const int DiskDoesNotExist_HASH = HashingUtils::HashString("DiskDoesNotExist");
-        static const int DiskSizeGreaterThanVolumeMaxSize_HASH = HashingUtils::HashString("DiskSizeGreaterThanVolumeMaxSize");
-        static const int DiskSizeLessThanVolumeSize_HASH = HashingUtils::HashString("DiskSizeLessThanVolumeSize");
-        static const int DiskSizeNotGigAligned_HASH = HashingUtils::HashString("DiskSizeNotGigAligned");
-        static const int DuplicateCertificateInfo_HASH = HashingUtils::HashString("DuplicateCertificateInfo");
-        static const int DuplicateSchedule_HASH = HashingUtils::HashString("DuplicateSchedule");
-        static const int EndpointNotFound_HASH = HashingUtils::HashString("EndpointNotFound");
-        static const int IAMNotSupported_HASH = HashingUtils::HashString("IAMNotSupported");
-        static const int InitiatorInvalid_HASH = HashingUtils::HashString("InitiatorInvalid");
-        static const int InitiatorNotFound_HASH = HashingUtils::HashString("InitiatorNotFound");
-        static const int InternalError_HASH = HashingUtils::HashString("InternalError");
-        static const int InvalidGateway_HASH = HashingUtils::HashString("InvalidGateway");
-        static const int InvalidEndpoint_HASH = HashingUtils::HashString("InvalidEndpoint");
-        static const int InvalidParameters_HASH = HashingUtils::HashString("InvalidParameters");
-        static const int InvalidSchedule_HASH = HashingUtils::HashString("InvalidSchedule");
-        static const int LocalStorageLimitExceeded_HASH = HashingUtils::HashString("LocalStorageLimitExceeded");
-        static const int LunAlreadyAllocated_HASH = HashingUtils::HashString("LunAlreadyAllocated ");
-        static const int LunInvalid_HASH = HashingUtils::HashString("LunInvalid");
-        static const int MaximumContentLengthExceeded_HASH = HashingUtils::HashString("MaximumContentLengthExceeded");
-        static const int MaximumTapeCartridgeCountExceeded_HASH = HashingUtils::HashString("MaximumTapeCartridgeCountExceeded");
-        static const int MaximumVolumeCountExceeded_HASH = HashingUtils::HashString("MaximumVolumeCountExceeded");
-        static const int NetworkConfigurationChanged_HASH = HashingUtils::HashString("NetworkConfigurationChanged");
-        static const int NoDisksAvailable_HASH = HashingUtils::HashString("NoDisksAvailable");
-        static const int NotImplemented_HASH = HashingUtils::HashString("NotImplemented");
-        static const int NotSupported_HASH = HashingUtils::HashString("NotSupported");
-        static const int OperationAborted_HASH = HashingUtils::HashString("OperationAborted");
-        static const int OutdatedGateway_HASH = HashingUtils::HashString("OutdatedGateway");
-        static const int ParametersNotImplemented_HASH = HashingUtils::HashString("ParametersNotImplemented");
-        static const int RegionInvalid_HASH = HashingUtils::HashString("RegionInvalid");
-        static const int RequestTimeout_HASH = HashingUtils::HashString("RequestTimeout");
-        static const int ServiceUnavailable_HASH = HashingUtils::HashString("ServiceUnavailable");
-        static const int SnapshotDeleted_HASH = HashingUtils::HashString("SnapshotDeleted");
-        static const int SnapshotIdInvalid_HASH = HashingUtils::HashString("SnapshotIdInvalid");
-        static const int SnapshotInProgress_HASH = HashingUtils::HashString("SnapshotInProgress");
-        static const int SnapshotNotFound_HASH = HashingUtils::HashString("SnapshotNotFound");
-        static const int SnapshotScheduleNotFound_HASH = HashingUtils::HashString("SnapshotScheduleNotFound");
-        static const int StagingAreaFull_HASH = HashingUtils::HashString("StagingAreaFull");
-        static const int StorageFailure_HASH = HashingUtils::HashString("StorageFailure");
-        static const int TapeCartridgeNotFound_HASH = HashingUtils::HashString("TapeCartridgeNotFound");
-        static const int TargetAlreadyExists_HASH = HashingUtils::HashString("TargetAlreadyExists");
-        static const int TargetInvalid_HASH = HashingUtils::HashString("TargetInvalid");
-        static const int TargetNotFound_HASH = HashingUtils::HashString("TargetNotFound");
-        static const int UnauthorizedOperation_HASH = HashingUtils::HashString("UnauthorizedOperation");
-        static const int VolumeAlreadyExists_HASH = HashingUtils::HashString("VolumeAlreadyExists");
-        static const int VolumeIdInvalid_HASH = HashingUtils::HashString("VolumeIdInvalid");
-        static const int VolumeInUse_HASH = HashingUtils::HashString("VolumeInUse");
-        static const int VolumeNotFound_HASH = HashingUtils::HashString("VolumeNotFound");
-        static const int VolumeNotReady_HASH = HashingUtils::HashString("VolumeNotReady");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ActivationKeyExpired_HASH = 1103836572;
+        static const int ActivationKeyInvalid_HASH = 77889646;
+        static const int ActivationKeyNotFound_HASH = -950859560;
+        static const int GatewayInternalError_HASH = 1416050055;
+        static const int GatewayNotConnected_HASH = 343933370;
+        static const int GatewayNotFound_HASH = -666589517;
+        static const int GatewayProxyNetworkConnectionBusy_HASH = -1314083013;
+        static const int AuthenticationFailure_HASH = 385417170;
+        static const int BandwidthThrottleScheduleNotFound_HASH = 116069665;
+        static const int Blocked_HASH = 1643215308;
+        static const int CannotExportSnapshot_HASH = -639487589;
+        static const int ChapCredentialNotFound_HASH = 743578746;
+        static const int DiskAlreadyAllocated_HASH = -631384276;
+        static const int DiskDoesNotExist_HASH = -476464166;
+        static const int DiskSizeGreaterThanVolumeMaxSize_HASH = 766441358;
+        static const int DiskSizeLessThanVolumeSize_HASH = 498086067;
+        static const int DiskSizeNotGigAligned_HASH = -2083329196;
+        static const int DuplicateCertificateInfo_HASH = 587918970;
+        static const int DuplicateSchedule_HASH = 1626949794;
+        static const int EndpointNotFound_HASH = -345822908;
+        static const int IAMNotSupported_HASH = -987787792;
+        static const int InitiatorInvalid_HASH = 1308428520;
+        static const int InitiatorNotFound_HASH = -1458860130;
+        static const int InternalError_HASH = -1693386453;
+        static const int InvalidGateway_HASH = -1509235603;
+        static const int InvalidEndpoint_HASH = -527809396;
+        static const int InvalidParameters_HASH = 1877804833;
+        static const int InvalidSchedule_HASH = 1328134542;
+        static const int LocalStorageLimitExceeded_HASH = -493529762;
+        static const int LunAlreadyAllocated_HASH = -999229108;
+        static const int LunInvalid_HASH = -1008852398;
+        static const int MaximumContentLengthExceeded_HASH = 560940818;
+        static const int MaximumTapeCartridgeCountExceeded_HASH = -1889736295;
+        static const int MaximumVolumeCountExceeded_HASH = 485557864;
+        static const int NetworkConfigurationChanged_HASH = 641120268;
+        static const int NoDisksAvailable_HASH = 1011966260;
+        static const int NotImplemented_HASH = -2132380593;
+        static const int NotSupported_HASH = 248847163;
+        static const int OperationAborted_HASH = -614819704;
+        static const int OutdatedGateway_HASH = -1867667172;
+        static const int ParametersNotImplemented_HASH = -2055882535;
+        static const int RegionInvalid_HASH = 1302829123;
+        static const int RequestTimeout_HASH = 122916850;
+        static const int ServiceUnavailable_HASH = -1847483781;
+        static const int SnapshotDeleted_HASH = 683107733;
+        static const int SnapshotIdInvalid_HASH = 702897880;
+        static const int SnapshotInProgress_HASH = 2090420086;
+        static const int SnapshotNotFound_HASH = 435110515;
+        static const int SnapshotScheduleNotFound_HASH = 785608234;
+        static const int StagingAreaFull_HASH = 1143677431;
+        static const int StorageFailure_HASH = 1204658863;
+        static const int TapeCartridgeNotFound_HASH = 269657080;
+        static const int TargetAlreadyExists_HASH = 752634019;
+        static const int TargetInvalid_HASH = 767726342;
+        static const int TargetNotFound_HASH = -1040758464;
+        static const int UnauthorizedOperation_HASH = -1181827405;
+        static const int VolumeAlreadyExists_HASH = -1928930886;
+        static const int VolumeIdInvalid_HASH = -1137514942;
+        static const int VolumeInUse_HASH = 772612872;
+        static const int VolumeNotFound_HASH = 2038310345;
+        static const int VolumeNotReady_HASH = 2049075178;
 
 
         ErrorCode GetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ActivationKeyExpired_HASH)
+          switch (hashCode)
           {
+          case ActivationKeyExpired_HASH:
             return ErrorCode::ActivationKeyExpired;
-          }
-          else if (hashCode == ActivationKeyInvalid_HASH)
-          {
+          case ActivationKeyInvalid_HASH:
             return ErrorCode::ActivationKeyInvalid;
-          }
-          else if (hashCode == ActivationKeyNotFound_HASH)
-          {
+          case ActivationKeyNotFound_HASH:
             return ErrorCode::ActivationKeyNotFound;
-          }
-          else if (hashCode == GatewayInternalError_HASH)
-          {
+          case GatewayInternalError_HASH:
             return ErrorCode::GatewayInternalError;
-          }
-          else if (hashCode == GatewayNotConnected_HASH)
-          {
+          case GatewayNotConnected_HASH:
             return ErrorCode::GatewayNotConnected;
-          }
-          else if (hashCode == GatewayNotFound_HASH)
-          {
+          case GatewayNotFound_HASH:
             return ErrorCode::GatewayNotFound;
-          }
-          else if (hashCode == GatewayProxyNetworkConnectionBusy_HASH)
-          {
+          case GatewayProxyNetworkConnectionBusy_HASH:
             return ErrorCode::GatewayProxyNetworkConnectionBusy;
-          }
-          else if (hashCode == AuthenticationFailure_HASH)
-          {
+          case AuthenticationFailure_HASH:
             return ErrorCode::AuthenticationFailure;
-          }
-          else if (hashCode == BandwidthThrottleScheduleNotFound_HASH)
-          {
+          case BandwidthThrottleScheduleNotFound_HASH:
             return ErrorCode::BandwidthThrottleScheduleNotFound;
-          }
-          else if (hashCode == Blocked_HASH)
-          {
+          case Blocked_HASH:
             return ErrorCode::Blocked;
-          }
-          else if (hashCode == CannotExportSnapshot_HASH)
-          {
+          case CannotExportSnapshot_HASH:
             return ErrorCode::CannotExportSnapshot;
-          }
-          else if (hashCode == ChapCredentialNotFound_HASH)
-          {
+          case ChapCredentialNotFound_HASH:
             return ErrorCode::ChapCredentialNotFound;
-          }
-          else if (hashCode == DiskAlreadyAllocated_HASH)
-          {
+          case DiskAlreadyAllocated_HASH:
             return ErrorCode::DiskAlreadyAllocated;
-          }
-          else if (hashCode == DiskDoesNotExist_HASH)
-          {
+          case DiskDoesNotExist_HASH:
             return ErrorCode::DiskDoesNotExist;
-          }
-          else if (hashCode == DiskSizeGreaterThanVolumeMaxSize_HASH)
-          {
+          case DiskSizeGreaterThanVolumeMaxSize_HASH:
             return ErrorCode::DiskSizeGreaterThanVolumeMaxSize;
-          }
-          else if (hashCode == DiskSizeLessThanVolumeSize_HASH)
-          {
+          case DiskSizeLessThanVolumeSize_HASH:
             return ErrorCode::DiskSizeLessThanVolumeSize;
-          }
-          else if (hashCode == DiskSizeNotGigAligned_HASH)
-          {
+          case DiskSizeNotGigAligned_HASH:
             return ErrorCode::DiskSizeNotGigAligned;
-          }
-          else if (hashCode == DuplicateCertificateInfo_HASH)
-          {
+          case DuplicateCertificateInfo_HASH:
             return ErrorCode::DuplicateCertificateInfo;
-          }
-          else if (hashCode == DuplicateSchedule_HASH)
-          {
+          case DuplicateSchedule_HASH:
             return ErrorCode::DuplicateSchedule;
-          }
-          else if (hashCode == EndpointNotFound_HASH)
-          {
+          case EndpointNotFound_HASH:
             return ErrorCode::EndpointNotFound;
-          }
-          else if (hashCode == IAMNotSupported_HASH)
-          {
+          case IAMNotSupported_HASH:
             return ErrorCode::IAMNotSupported;
-          }
-          else if (hashCode == InitiatorInvalid_HASH)
-          {
+          case InitiatorInvalid_HASH:
             return ErrorCode::InitiatorInvalid;
-          }
-          else if (hashCode == InitiatorNotFound_HASH)
-          {
+          case InitiatorNotFound_HASH:
             return ErrorCode::InitiatorNotFound;
-          }
-          else if (hashCode == InternalError_HASH)
-          {
+          case InternalError_HASH:
             return ErrorCode::InternalError;
-          }
-          else if (hashCode == InvalidGateway_HASH)
-          {
+          case InvalidGateway_HASH:
             return ErrorCode::InvalidGateway;
-          }
-          else if (hashCode == InvalidEndpoint_HASH)
-          {
+          case InvalidEndpoint_HASH:
             return ErrorCode::InvalidEndpoint;
-          }
-          else if (hashCode == InvalidParameters_HASH)
-          {
+          case InvalidParameters_HASH:
             return ErrorCode::InvalidParameters;
-          }
-          else if (hashCode == InvalidSchedule_HASH)
-          {
+          case InvalidSchedule_HASH:
             return ErrorCode::InvalidSchedule;
-          }
-          else if (hashCode == LocalStorageLimitExceeded_HASH)
-          {
+          case LocalStorageLimitExceeded_HASH:
             return ErrorCode::LocalStorageLimitExceeded;
-          }
-          else if (hashCode == LunAlreadyAllocated_HASH)
-          {
+          case LunAlreadyAllocated_HASH:
             return ErrorCode::LunAlreadyAllocated;
-          }
-          else if (hashCode == LunInvalid_HASH)
-          {
+          case LunInvalid_HASH:
             return ErrorCode::LunInvalid;
-          }
-          else if (hashCode == MaximumContentLengthExceeded_HASH)
-          {
+          case MaximumContentLengthExceeded_HASH:
             return ErrorCode::MaximumContentLengthExceeded;
-          }
-          else if (hashCode == MaximumTapeCartridgeCountExceeded_HASH)
-          {
+          case MaximumTapeCartridgeCountExceeded_HASH:
             return ErrorCode::MaximumTapeCartridgeCountExceeded;
-          }
-          else if (hashCode == MaximumVolumeCountExceeded_HASH)
-          {
+          case MaximumVolumeCountExceeded_HASH:
             return ErrorCode::MaximumVolumeCountExceeded;
-          }
-          else if (hashCode == NetworkConfigurationChanged_HASH)
-          {
+          case NetworkConfigurationChanged_HASH:
             return ErrorCode::NetworkConfigurationChanged;
-          }
-          else if (hashCode == NoDisksAvailable_HASH)
-          {
+          case NoDisksAvailable_HASH:
             return ErrorCode::NoDisksAvailable;
-          }
-          else if (hashCode == NotImplemented_HASH)
-          {
+          case NotImplemented_HASH:
             return ErrorCode::NotImplemented;
-          }
-          else if (hashCode == NotSupported_HASH)
-          {
+          case NotSupported_HASH:
             return ErrorCode::NotSupported;
-          }
-          else if (hashCode == OperationAborted_HASH)
-          {
+          case OperationAborted_HASH:
             return ErrorCode::OperationAborted;
-          }
-          else if (hashCode == OutdatedGateway_HASH)
-          {
+          case OutdatedGateway_HASH:
             return ErrorCode::OutdatedGateway;
-          }
-          else if (hashCode == ParametersNotImplemented_HASH)
-          {
+          case ParametersNotImplemented_HASH:
             return ErrorCode::ParametersNotImplemented;
-          }
-          else if (hashCode == RegionInvalid_HASH)
-          {
+          case RegionInvalid_HASH:
             return ErrorCode::RegionInvalid;
-          }
-          else if (hashCode == RequestTimeout_HASH)
-          {
+          case RequestTimeout_HASH:
             return ErrorCode::RequestTimeout;
-          }
-          else if (hashCode == ServiceUnavailable_HASH)
-          {
+          case ServiceUnavailable_HASH:
             return ErrorCode::ServiceUnavailable;
-          }
-          else if (hashCode == SnapshotDeleted_HASH)
-          {
+          case SnapshotDeleted_HASH:
             return ErrorCode::SnapshotDeleted;
-          }
-          else if (hashCode == SnapshotIdInvalid_HASH)
-          {
+          case SnapshotIdInvalid_HASH:
             return ErrorCode::SnapshotIdInvalid;
-          }
-          else if (hashCode == SnapshotInProgress_HASH)
-          {
+          case SnapshotInProgress_HASH:
             return ErrorCode::SnapshotInProgress;
-          }
-          else if (hashCode == SnapshotNotFound_HASH)
-          {
+          case SnapshotNotFound_HASH:
             return ErrorCode::SnapshotNotFound;
-          }
-          else if (hashCode == SnapshotScheduleNotFound_HASH)
-          {
+          case SnapshotScheduleNotFound_HASH:
             return ErrorCode::SnapshotScheduleNotFound;
-          }
-          else if (hashCode == StagingAreaFull_HASH)
-          {
+          case StagingAreaFull_HASH:
             return ErrorCode::StagingAreaFull;
-          }
-          else if (hashCode == StorageFailure_HASH)
-          {
+          case StorageFailure_HASH:
             return ErrorCode::StorageFailure;
-          }
-          else if (hashCode == TapeCartridgeNotFound_HASH)
-          {
+          case TapeCartridgeNotFound_HASH:
             return ErrorCode::TapeCartridgeNotFound;
-          }
-          else if (hashCode == TargetAlreadyExists_HASH)
-          {
+          case TargetAlreadyExists_HASH:
             return ErrorCode::TargetAlreadyExists;
-          }
-          else if (hashCode == TargetInvalid_HASH)
-          {
+          case TargetInvalid_HASH:
             return ErrorCode::TargetInvalid;
-          }
-          else if (hashCode == TargetNotFound_HASH)
-          {
+          case TargetNotFound_HASH:
             return ErrorCode::TargetNotFound;
-          }
-          else if (hashCode == UnauthorizedOperation_HASH)
-          {
+          case UnauthorizedOperation_HASH:
             return ErrorCode::UnauthorizedOperation;
-          }
-          else if (hashCode == VolumeAlreadyExists_HASH)
-          {
+          case VolumeAlreadyExists_HASH:
             return ErrorCode::VolumeAlreadyExists;
-          }
-          else if (hashCode == VolumeIdInvalid_HASH)
-          {
+          case VolumeIdInvalid_HASH:
             return ErrorCode::VolumeIdInvalid;
-          }
-          else if (hashCode == VolumeInUse_HASH)
-          {
+          case VolumeInUse_HASH:
             return ErrorCode::VolumeInUse;
-          }
-          else if (hashCode == VolumeNotFound_HASH)
-          {
+          case VolumeNotFound_HASH:
             return ErrorCode::VolumeNotFound;
-          }
-          else if (hashCode == VolumeNotReady_HASH)
-          {
+          case VolumeNotReady_HASH:
             return ErrorCode::VolumeNotReady;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
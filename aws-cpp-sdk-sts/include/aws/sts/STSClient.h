@@ -28,6 +28,9 @@
 #include <aws/sts/model/GetFederationTokenResult.h>
 #include <aws/sts/model/GetSessionTokenResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -433,6 +436,18 @@ namespace Model
          */
         virtual void AssumeRoleAsync(const Model::AssumeRoleRequest& request, const AssumeRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssumeRoleCallable(const Model::AssumeRoleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AssumeRoleOutcomeCallable AssumeRoleCallable(Model::AssumeRoleRequest&& request) const;
+
+        /**
+         * Same as AssumeRoleAsync(const Model::AssumeRoleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AssumeRoleAsync(Model::AssumeRoleRequest&& request, const AssumeRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a set of temporary security credentials for users who have been
          * authenticated via a SAML authentication response. This operation provides a
@@ -638,6 +653,18 @@ namespace Model
          */
         virtual void AssumeRoleWithSAMLAsync(const Model::AssumeRoleWithSAMLRequest& request, const AssumeRoleWithSAMLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssumeRoleWithSAMLCallable(const Model::AssumeRoleWithSAMLRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AssumeRoleWithSAMLOutcomeCallable AssumeRoleWithSAMLCallable(Model::AssumeRoleWithSAMLRequest&& request) const;
+
+        /**
+         * Same as AssumeRoleWithSAMLAsync(const Model::AssumeRoleWithSAMLRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AssumeRoleWithSAMLAsync(Model::AssumeRoleWithSAMLRequest&& request, const AssumeRoleWithSAMLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a set of temporary security credentials for users who have been
          * authenticated in a mobile or web application with a web identity provider, such
@@ -906,6 +933,18 @@ namespace Model
          */
         virtual void AssumeRoleWithWebIdentityAsync(const Model::AssumeRoleWithWebIdentityRequest& request, const AssumeRoleWithWebIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssumeRoleWithWebIdentityCallable(const Model::AssumeRoleWithWebIdentityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AssumeRoleWithWebIdentityOutcomeCallable AssumeRoleWithWebIdentityCallable(Model::AssumeRoleWithWebIdentityRequest&& request) const;
+
+        /**
+         * Same as AssumeRoleWithWebIdentityAsync(const Model::AssumeRoleWithWebIdentityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AssumeRoleWithWebIdentityAsync(Model::AssumeRoleWithWebIdentityRequest&& request, const AssumeRoleWithWebIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Decodes additional information about the authorization status of a request
          * from an encoded message returned in response to an AWS request.</p> <p>For
@@ -994,6 +1033,18 @@ namespace Model
          */
         virtual void DecodeAuthorizationMessageAsync(const Model::DecodeAuthorizationMessageRequest& request, const DecodeAuthorizationMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DecodeAuthorizationMessageCallable(const Model::DecodeAuthorizationMessageRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DecodeAuthorizationMessageOutcomeCallable DecodeAuthorizationMessageCallable(Model::DecodeAuthorizationMessageRequest&& request) const;
+
+        /**
+         * Same as DecodeAuthorizationMessageAsync(const Model::DecodeAuthorizationMessageRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DecodeAuthorizationMessageAsync(Model::DecodeAuthorizationMessageRequest&& request, const DecodeAuthorizationMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns details about the IAM identity whose credentials are used to call the
          * API.</p>
@@ -1016,6 +1067,18 @@ namespace Model
          */
         virtual void GetCallerIdentityAsync(const Model::GetCallerIdentityRequest& request, const GetCallerIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCallerIdentityCallable(const Model::GetCallerIdentityRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetCallerIdentityOutcomeCallable GetCallerIdentityCallable(Model::GetCallerIdentityRequest&& request) const;
+
+        /**
+         * Same as GetCallerIdentityAsync(const Model::GetCallerIdentityRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetCallerIdentityAsync(Model::GetCallerIdentityRequest&& request, const GetCallerIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a set of temporary security credentials (consisting of an access key
          * ID, a secret access key, and a security token) for a federated user. A typical
@@ -1236,6 +1299,18 @@ namespace Model
          */
         virtual void GetFederationTokenAsync(const Model::GetFederationTokenRequest& request, const GetFederationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetFederationTokenCallable(const Model::GetFederationTokenRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetFederationTokenOutcomeCallable GetFederationTokenCallable(Model::GetFederationTokenRequest&& request) const;
+
+        /**
+         * Same as GetFederationTokenAsync(const Model::GetFederationTokenRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetFederationTokenAsync(Model::GetFederationTokenRequest&& request, const GetFederationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a set of temporary credentials for an AWS account or IAM user. The
          * credentials consist of an access key ID, a secret access key, and a security
@@ -1384,6 +1459,55 @@ namespace Model
          */
         virtual void GetSessionTokenAsync(const Model::GetSessionTokenRequest& request, const GetSessionTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSessionTokenCallable(const Model::GetSessionTokenRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetSessionTokenOutcomeCallable GetSessionTokenCallable(Model::GetSessionTokenRequest&& request) const;
+
+        /**
+         * Same as GetSessionTokenAsync(const Model::GetSessionTokenRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetSessionTokenAsync(Model::GetSessionTokenRequest&& request, const GetSessionTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AssumeRole(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<STSClient, Model::AssumeRoleRequest, Model::AssumeRoleOutcome> AssumeRoleAwaitable(Model::AssumeRoleRequest request) const;
+
+        /**
+         * co_await-able form of AssumeRoleWithSAML(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<STSClient, Model::AssumeRoleWithSAMLRequest, Model::AssumeRoleWithSAMLOutcome> AssumeRoleWithSAMLAwaitable(Model::AssumeRoleWithSAMLRequest request) const;
+
+        /**
+         * co_await-able form of AssumeRoleWithWebIdentity(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<STSClient, Model::AssumeRoleWithWebIdentityRequest, Model::AssumeRoleWithWebIdentityOutcome> AssumeRoleWithWebIdentityAwaitable(Model::AssumeRoleWithWebIdentityRequest request) const;
+
+        /**
+         * co_await-able form of DecodeAuthorizationMessage(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<STSClient, Model::DecodeAuthorizationMessageRequest, Model::DecodeAuthorizationMessageOutcome> DecodeAuthorizationMessageAwaitable(Model::DecodeAuthorizationMessageRequest request) const;
+
+        /**
+         * co_await-able form of GetCallerIdentity(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<STSClient, Model::GetCallerIdentityRequest, Model::GetCallerIdentityOutcome> GetCallerIdentityAwaitable(Model::GetCallerIdentityRequest request) const;
+
+        /**
+         * co_await-able form of GetFederationToken(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<STSClient, Model::GetFederationTokenRequest, Model::GetFederationTokenOutcome> GetFederationTokenAwaitable(Model::GetFederationTokenRequest request) const;
+
+        /**
+         * co_await-able form of GetSessionToken(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<STSClient, Model::GetSessionTokenRequest, Model::GetSessionTokenOutcome> GetSessionTokenAwaitable(Model::GetSessionTokenRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
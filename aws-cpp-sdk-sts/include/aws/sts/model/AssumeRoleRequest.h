@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     AssumeRoleRequest();
+    inline const char* GetServiceRequestName() const override { return "AssumeRole"; }
+
     Aws::String SerializePayload() const override;
 
     /**
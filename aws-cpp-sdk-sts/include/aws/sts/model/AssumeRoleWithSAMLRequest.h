@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     AssumeRoleWithSAMLRequest();
+    inline const char* GetServiceRequestName() const override { return "AssumeRoleWithSAML"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     AssumeRoleWithWebIdentityRequest();
+    inline const char* GetServiceRequestName() const override { return "AssumeRoleWithWebIdentity"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DecodeAuthorizationMessageRequest();
+    inline const char* GetServiceRequestName() const override { return "DecodeAuthorizationMessage"; }
+
     Aws::String SerializePayload() const override;
 
     /**
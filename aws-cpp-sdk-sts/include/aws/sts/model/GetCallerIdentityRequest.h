@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     GetCallerIdentityRequest();
+    inline const char* GetServiceRequestName() const override { return "GetCallerIdentity"; }
+
     Aws::String SerializePayload() const override;
 
   };
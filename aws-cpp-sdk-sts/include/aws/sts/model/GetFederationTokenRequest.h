@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetFederationTokenRequest();
+    inline const char* GetServiceRequestName() const override { return "GetFederationToken"; }
+
     Aws::String SerializePayload() const override;
 
     /**
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetSessionTokenRequest();
+    inline const char* GetServiceRequestName() const override { return "GetSessionToken"; }
+
     Aws::String SerializePayload() const override;
 
     /**
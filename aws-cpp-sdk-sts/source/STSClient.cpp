@@ -116,7 +116,7 @@ AssumeRoleOutcome STSClient::AssumeRole(const AssumeRoleRequest& request) const
 
 AssumeRoleOutcomeCallable STSClient::AssumeRoleCallable(const AssumeRoleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AssumeRole( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AssumeRole( request ); } );
 }
 
 void STSClient::AssumeRoleAsync(const AssumeRoleRequest& request, const AssumeRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -124,6 +124,16 @@ void STSClient::AssumeRoleAsync(const AssumeRoleRequest& request, const AssumeRo
   m_executor->Submit( [this, request, handler, context](){ this->AssumeRoleAsyncHelper( request, handler, context ); } );
 }
 
+AssumeRoleOutcomeCallable STSClient::AssumeRoleCallable(AssumeRoleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&STSClient::AssumeRole, this, std::move(request)));
+}
+
+void STSClient::AssumeRoleAsync(AssumeRoleRequest&& request, const AssumeRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&STSClient::AssumeRoleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void STSClient::AssumeRoleAsyncHelper(const AssumeRoleRequest& request, const AssumeRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AssumeRole(request), context);
@@ -146,7 +156,7 @@ AssumeRoleWithSAMLOutcome STSClient::AssumeRoleWithSAML(const AssumeRoleWithSAML
 
 AssumeRoleWithSAMLOutcomeCallable STSClient::AssumeRoleWithSAMLCallable(const AssumeRoleWithSAMLRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AssumeRoleWithSAML( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AssumeRoleWithSAML( request ); } );
 }
 
 void STSClient::AssumeRoleWithSAMLAsync(const AssumeRoleWithSAMLRequest& request, const AssumeRoleWithSAMLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -154,6 +164,16 @@ void STSClient::AssumeRoleWithSAMLAsync(const AssumeRoleWithSAMLRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->AssumeRoleWithSAMLAsyncHelper( request, handler, context ); } );
 }
 
+AssumeRoleWithSAMLOutcomeCallable STSClient::AssumeRoleWithSAMLCallable(AssumeRoleWithSAMLRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&STSClient::AssumeRoleWithSAML, this, std::move(request)));
+}
+
+void STSClient::AssumeRoleWithSAMLAsync(AssumeRoleWithSAMLRequest&& request, const AssumeRoleWithSAMLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&STSClient::AssumeRoleWithSAMLAsyncHelper, this, std::move(request), handler, context);
+}
+
 void STSClient::AssumeRoleWithSAMLAsyncHelper(const AssumeRoleWithSAMLRequest& request, const AssumeRoleWithSAMLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AssumeRoleWithSAML(request), context);
@@ -176,7 +196,7 @@ AssumeRoleWithWebIdentityOutcome STSClient::AssumeRoleWithWebIdentity(const Assu
 
 AssumeRoleWithWebIdentityOutcomeCallable STSClient::AssumeRoleWithWebIdentityCallable(const AssumeRoleWithWebIdentityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AssumeRoleWithWebIdentity( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AssumeRoleWithWebIdentity( request ); } );
 }
 
 void STSClient::AssumeRoleWithWebIdentityAsync(const AssumeRoleWithWebIdentityRequest& request, const AssumeRoleWithWebIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -184,6 +204,16 @@ void STSClient::AssumeRoleWithWebIdentityAsync(const AssumeRoleWithWebIdentityRe
   m_executor->Submit( [this, request, handler, context](){ this->AssumeRoleWithWebIdentityAsyncHelper( request, handler, context ); } );
 }
 
+AssumeRoleWithWebIdentityOutcomeCallable STSClient::AssumeRoleWithWebIdentityCallable(AssumeRoleWithWebIdentityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&STSClient::AssumeRoleWithWebIdentity, this, std::move(request)));
+}
+
+void STSClient::AssumeRoleWithWebIdentityAsync(AssumeRoleWithWebIdentityRequest&& request, const AssumeRoleWithWebIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&STSClient::AssumeRoleWithWebIdentityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void STSClient::AssumeRoleWithWebIdentityAsyncHelper(const AssumeRoleWithWebIdentityRequest& request, const AssumeRoleWithWebIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AssumeRoleWithWebIdentity(request), context);
@@ -206,7 +236,7 @@ DecodeAuthorizationMessageOutcome STSClient::DecodeAuthorizationMessage(const De
 
 DecodeAuthorizationMessageOutcomeCallable STSClient::DecodeAuthorizationMessageCallable(const DecodeAuthorizationMessageRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DecodeAuthorizationMessage( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DecodeAuthorizationMessage( request ); } );
 }
 
 void STSClient::DecodeAuthorizationMessageAsync(const DecodeAuthorizationMessageRequest& request, const DecodeAuthorizationMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -214,6 +244,16 @@ void STSClient::DecodeAuthorizationMessageAsync(const DecodeAuthorizationMessage
   m_executor->Submit( [this, request, handler, context](){ this->DecodeAuthorizationMessageAsyncHelper( request, handler, context ); } );
 }
 
+DecodeAuthorizationMessageOutcomeCallable STSClient::DecodeAuthorizationMessageCallable(DecodeAuthorizationMessageRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&STSClient::DecodeAuthorizationMessage, this, std::move(request)));
+}
+
+void STSClient::DecodeAuthorizationMessageAsync(DecodeAuthorizationMessageRequest&& request, const DecodeAuthorizationMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&STSClient::DecodeAuthorizationMessageAsyncHelper, this, std::move(request), handler, context);
+}
+
 void STSClient::DecodeAuthorizationMessageAsyncHelper(const DecodeAuthorizationMessageRequest& request, const DecodeAuthorizationMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DecodeAuthorizationMessage(request), context);
@@ -236,7 +276,7 @@ GetCallerIdentityOutcome STSClient::GetCallerIdentity(const GetCallerIdentityReq
 
 GetCallerIdentityOutcomeCallable STSClient::GetCallerIdentityCallable(const GetCallerIdentityRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetCallerIdentity( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetCallerIdentity( request ); } );
 }
 
 void STSClient::GetCallerIdentityAsync(const GetCallerIdentityRequest& request, const GetCallerIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -244,6 +284,16 @@ void STSClient::GetCallerIdentityAsync(const GetCallerIdentityRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->GetCallerIdentityAsyncHelper( request, handler, context ); } );
 }
 
+GetCallerIdentityOutcomeCallable STSClient::GetCallerIdentityCallable(GetCallerIdentityRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&STSClient::GetCallerIdentity, this, std::move(request)));
+}
+
+void STSClient::GetCallerIdentityAsync(GetCallerIdentityRequest&& request, const GetCallerIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&STSClient::GetCallerIdentityAsyncHelper, this, std::move(request), handler, context);
+}
+
 void STSClient::GetCallerIdentityAsyncHelper(const GetCallerIdentityRequest& request, const GetCallerIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetCallerIdentity(request), context);
@@ -266,7 +316,7 @@ GetFederationTokenOutcome STSClient::GetFederationToken(const GetFederationToken
 
 GetFederationTokenOutcomeCallable STSClient::GetFederationTokenCallable(const GetFederationTokenRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetFederationToken( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetFederationToken( request ); } );
 }
 
 void STSClient::GetFederationTokenAsync(const GetFederationTokenRequest& request, const GetFederationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -274,6 +324,16 @@ void STSClient::GetFederationTokenAsync(const GetFederationTokenRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->GetFederationTokenAsyncHelper( request, handler, context ); } );
 }
 
+GetFederationTokenOutcomeCallable STSClient::GetFederationTokenCallable(GetFederationTokenRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&STSClient::GetFederationToken, this, std::move(request)));
+}
+
+void STSClient::GetFederationTokenAsync(GetFederationTokenRequest&& request, const GetFederationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&STSClient::GetFederationTokenAsyncHelper, this, std::move(request), handler, context);
+}
+
 void STSClient::GetFederationTokenAsyncHelper(const GetFederationTokenRequest& request, const GetFederationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetFederationToken(request), context);
@@ -296,7 +356,7 @@ GetSessionTokenOutcome STSClient::GetSessionToken(const GetSessionTokenRequest&
 
 GetSessionTokenOutcomeCallable STSClient::GetSessionTokenCallable(const GetSessionTokenRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetSessionToken( request ); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetSessionToken( request ); } );
 }
 
 void STSClient::GetSessionTokenAsync(const GetSessionTokenRequest& request, const GetSessionTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -304,8 +364,55 @@ void STSClient::GetSessionTokenAsync(const GetSessionTokenRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->GetSessionTokenAsyncHelper( request, handler, context ); } );
 }
 
+GetSessionTokenOutcomeCallable STSClient::GetSessionTokenCallable(GetSessionTokenRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&STSClient::GetSessionToken, this, std::move(request)));
+}
+
+void STSClient::GetSessionTokenAsync(GetSessionTokenRequest&& request, const GetSessionTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&STSClient::GetSessionTokenAsyncHelper, this, std::move(request), handler, context);
+}
+
 void STSClient::GetSessionTokenAsyncHelper(const GetSessionTokenRequest& request, const GetSessionTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetSessionToken(request), context);
 }
 
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<STSClient, AssumeRoleRequest, AssumeRoleOutcome> STSClient::AssumeRoleAwaitable(AssumeRoleRequest request) const
+{
+  return { m_executor.get(), { this, &STSClient::AssumeRole, std::move(request) } };
+}
+
+ClientOperationAwaitable<STSClient, AssumeRoleWithSAMLRequest, AssumeRoleWithSAMLOutcome> STSClient::AssumeRoleWithSAMLAwaitable(AssumeRoleWithSAMLRequest request) const
+{
+  return { m_executor.get(), { this, &STSClient::AssumeRoleWithSAML, std::move(request) } };
+}
+
+ClientOperationAwaitable<STSClient, AssumeRoleWithWebIdentityRequest, AssumeRoleWithWebIdentityOutcome> STSClient::AssumeRoleWithWebIdentityAwaitable(AssumeRoleWithWebIdentityRequest request) const
+{
+  return { m_executor.get(), { this, &STSClient::AssumeRoleWithWebIdentity, std::move(request) } };
+}
+
+ClientOperationAwaitable<STSClient, DecodeAuthorizationMessageRequest, DecodeAuthorizationMessageOutcome> STSClient::DecodeAuthorizationMessageAwaitable(DecodeAuthorizationMessageRequest request) const
+{
+  return { m_executor.get(), { this, &STSClient::DecodeAuthorizationMessage, std::move(request) } };
+}
+
+ClientOperationAwaitable<STSClient, GetCallerIdentityRequest, GetCallerIdentityOutcome> STSClient::GetCallerIdentityAwaitable(GetCallerIdentityRequest request) const
+{
+  return { m_executor.get(), { this, &STSClient::GetCallerIdentity, std::move(request) } };
+}
+
+ClientOperationAwaitable<STSClient, GetFederationTokenRequest, GetFederationTokenOutcome> STSClient::GetFederationTokenAwaitable(GetFederationTokenRequest request) const
+{
+  return { m_executor.get(), { this, &STSClient::GetFederationToken, std::move(request) } };
+}
+
+ClientOperationAwaitable<STSClient, GetSessionTokenRequest, GetSessionTokenOutcome> STSClient::GetSessionTokenAwaitable(GetSessionTokenRequest request) const
+{
+  return { m_executor.get(), { this, &STSClient::GetSessionToken, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -15,6 +15,7 @@
 #include <aws/sts/model/AssumeRoleRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::STS::Model;
 using namespace Aws::Utils;
@@ -33,21 +34,21 @@ AssumeRoleRequest::AssumeRoleRequest() :
 
 Aws::String AssumeRoleRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AssumeRole&";
   if(m_roleArnHasBeenSet)
   {
-    ss << "RoleArn=" << StringUtils::URLEncode(m_roleArn.c_str()) << "&";
+    ss << "RoleArn=" << StringUtils::URLEncoded(m_roleArn) << "&";
   }
 
   if(m_roleSessionNameHasBeenSet)
   {
-    ss << "RoleSessionName=" << StringUtils::URLEncode(m_roleSessionName.c_str()) << "&";
+    ss << "RoleSessionName=" << StringUtils::URLEncoded(m_roleSessionName) << "&";
   }
 
   if(m_policyHasBeenSet)
   {
-    ss << "Policy=" << StringUtils::URLEncode(m_policy.c_str()) << "&";
+    ss << "Policy=" << StringUtils::URLEncoded(m_policy) << "&";
   }
 
   if(m_durationSecondsHasBeenSet)
@@ -57,20 +58,20 @@ Aws::String AssumeRoleRequest::SerializePayload() const
 
   if(m_externalIdHasBeenSet)
   {
-    ss << "ExternalId=" << StringUtils::URLEncode(m_externalId.c_str()) << "&";
+    ss << "ExternalId=" << StringUtils::URLEncoded(m_externalId) << "&";
   }
 
   if(m_serialNumberHasBeenSet)
   {
-    ss << "SerialNumber=" << StringUtils::URLEncode(m_serialNumber.c_str()) << "&";
+    ss << "SerialNumber=" << StringUtils::URLEncoded(m_serialNumber) << "&";
   }
 
   if(m_tokenCodeHasBeenSet)
   {
-    ss << "TokenCode=" << StringUtils::URLEncode(m_tokenCode.c_str()) << "&";
+    ss << "TokenCode=" << StringUtils::URLEncoded(m_tokenCode) << "&";
   }
 
   ss << "Version=2011-06-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
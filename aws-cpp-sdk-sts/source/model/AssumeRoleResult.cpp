@@ -42,7 +42,7 @@ AssumeRoleResult& AssumeRoleResult::operator =(const AmazonWebServiceResult<XmlD
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AssumeRoleResult")
+  if (rootNode.GetNameView() != "AssumeRoleResult")
   {
     resultNode = rootNode.FirstChild("AssumeRoleResult");
   }
@@ -62,7 +62,7 @@ AssumeRoleResult& AssumeRoleResult::operator =(const AmazonWebServiceResult<XmlD
     XmlNode packedPolicySizeNode = resultNode.FirstChild("PackedPolicySize");
     if(!packedPolicySizeNode.IsNull())
     {
-      m_packedPolicySize = StringUtils::ConvertToInt32(StringUtils::Trim(packedPolicySizeNode.GetText().c_str()).c_str());
+      m_packedPolicySize = StringUtils::ConvertToInt32(packedPolicySizeNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
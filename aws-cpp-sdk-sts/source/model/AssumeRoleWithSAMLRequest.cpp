@@ -15,6 +15,7 @@
 #include <aws/sts/model/AssumeRoleWithSAMLRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::STS::Model;
 using namespace Aws::Utils;
@@ -31,26 +32,26 @@ AssumeRoleWithSAMLRequest::AssumeRoleWithSAMLRequest() :
 
 Aws::String AssumeRoleWithSAMLRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AssumeRoleWithSAML&";
   if(m_roleArnHasBeenSet)
   {
-    ss << "RoleArn=" << StringUtils::URLEncode(m_roleArn.c_str()) << "&";
+    ss << "RoleArn=" << StringUtils::URLEncoded(m_roleArn) << "&";
   }
 
   if(m_principalArnHasBeenSet)
   {
-    ss << "PrincipalArn=" << StringUtils::URLEncode(m_principalArn.c_str()) << "&";
+    ss << "PrincipalArn=" << StringUtils::URLEncoded(m_principalArn) << "&";
   }
 
   if(m_sAMLAssertionHasBeenSet)
   {
-    ss << "SAMLAssertion=" << StringUtils::URLEncode(m_sAMLAssertion.c_str()) << "&";
+    ss << "SAMLAssertion=" << StringUtils::URLEncoded(m_sAMLAssertion) << "&";
   }
 
   if(m_policyHasBeenSet)
   {
-    ss << "Policy=" << StringUtils::URLEncode(m_policy.c_str()) << "&";
+    ss << "Policy=" << StringUtils::URLEncoded(m_policy) << "&";
   }
 
   if(m_durationSecondsHasBeenSet)
@@ -59,6 +60,6 @@ Aws::String AssumeRoleWithSAMLRequest::SerializePayload() const
   }
 
   ss << "Version=2011-06-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
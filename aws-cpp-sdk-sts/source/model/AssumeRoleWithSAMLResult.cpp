@@ -42,7 +42,7 @@ AssumeRoleWithSAMLResult& AssumeRoleWithSAMLResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AssumeRoleWithSAMLResult")
+  if (rootNode.GetNameView() != "AssumeRoleWithSAMLResult")
   {
     resultNode = rootNode.FirstChild("AssumeRoleWithSAMLResult");
   }
@@ -62,32 +62,32 @@ AssumeRoleWithSAMLResult& AssumeRoleWithSAMLResult::operator =(const AmazonWebSe
     XmlNode packedPolicySizeNode = resultNode.FirstChild("PackedPolicySize");
     if(!packedPolicySizeNode.IsNull())
     {
-      m_packedPolicySize = StringUtils::ConvertToInt32(StringUtils::Trim(packedPolicySizeNode.GetText().c_str()).c_str());
+      m_packedPolicySize = StringUtils::ConvertToInt32(packedPolicySizeNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode subjectNode = resultNode.FirstChild("Subject");
     if(!subjectNode.IsNull())
     {
-      m_subject = StringUtils::Trim(subjectNode.GetText().c_str());
+      m_subject = subjectNode.GetTextView().Trim().ToString();
     }
     XmlNode subjectTypeNode = resultNode.FirstChild("SubjectType");
     if(!subjectTypeNode.IsNull())
     {
-      m_subjectType = StringUtils::Trim(subjectTypeNode.GetText().c_str());
+      m_subjectType = subjectTypeNode.GetTextView().Trim().ToString();
     }
     XmlNode issuerNode = resultNode.FirstChild("Issuer");
     if(!issuerNode.IsNull())
     {
-      m_issuer = StringUtils::Trim(issuerNode.GetText().c_str());
+      m_issuer = issuerNode.GetTextView().Trim().ToString();
     }
     XmlNode audienceNode = resultNode.FirstChild("Audience");
     if(!audienceNode.IsNull())
     {
-      m_audience = StringUtils::Trim(audienceNode.GetText().c_str());
+      m_audience = audienceNode.GetTextView().Trim().ToString();
     }
     XmlNode nameQualifierNode = resultNode.FirstChild("NameQualifier");
     if(!nameQualifierNode.IsNull())
     {
-      m_nameQualifier = StringUtils::Trim(nameQualifierNode.GetText().c_str());
+      m_nameQualifier = nameQualifierNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/sts/model/AssumeRoleWithWebIdentityRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::STS::Model;
 using namespace Aws::Utils;
@@ -32,31 +33,31 @@ AssumeRoleWithWebIdentityRequest::AssumeRoleWithWebIdentityRequest() :
 
 Aws::String AssumeRoleWithWebIdentityRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=AssumeRoleWithWebIdentity&";
   if(m_roleArnHasBeenSet)
   {
-    ss << "RoleArn=" << StringUtils::URLEncode(m_roleArn.c_str()) << "&";
+    ss << "RoleArn=" << StringUtils::URLEncoded(m_roleArn) << "&";
   }
 
   if(m_roleSessionNameHasBeenSet)
   {
-    ss << "RoleSessionName=" << StringUtils::URLEncode(m_roleSessionName.c_str()) << "&";
+    ss << "RoleSessionName=" << StringUtils::URLEncoded(m_roleSessionName) << "&";
   }
 
   if(m_webIdentityTokenHasBeenSet)
   {
-    ss << "WebIdentityToken=" << StringUtils::URLEncode(m_webIdentityToken.c_str()) << "&";
+    ss << "WebIdentityToken=" << StringUtils::URLEncoded(m_webIdentityToken) << "&";
   }
 
   if(m_providerIdHasBeenSet)
   {
-    ss << "ProviderId=" << StringUtils::URLEncode(m_providerId.c_str()) << "&";
+    ss << "ProviderId=" << StringUtils::URLEncoded(m_providerId) << "&";
   }
 
   if(m_policyHasBeenSet)
   {
-    ss << "Policy=" << StringUtils::URLEncode(m_policy.c_str()) << "&";
+    ss << "Policy=" << StringUtils::URLEncoded(m_policy) << "&";
   }
 
   if(m_durationSecondsHasBeenSet)
@@ -65,6 +66,6 @@ Aws::String AssumeRoleWithWebIdentityRequest::SerializePayload() const
   }
 
   ss << "Version=2011-06-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -42,7 +42,7 @@ AssumeRoleWithWebIdentityResult& AssumeRoleWithWebIdentityResult::operator =(con
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "AssumeRoleWithWebIdentityResult")
+  if (rootNode.GetNameView() != "AssumeRoleWithWebIdentityResult")
   {
     resultNode = rootNode.FirstChild("AssumeRoleWithWebIdentityResult");
   }
@@ -57,7 +57,7 @@ AssumeRoleWithWebIdentityResult& AssumeRoleWithWebIdentityResult::operator =(con
     XmlNode subjectFromWebIdentityTokenNode = resultNode.FirstChild("SubjectFromWebIdentityToken");
     if(!subjectFromWebIdentityTokenNode.IsNull())
     {
-      m_subjectFromWebIdentityToken = StringUtils::Trim(subjectFromWebIdentityTokenNode.GetText().c_str());
+      m_subjectFromWebIdentityToken = subjectFromWebIdentityTokenNode.GetTextView().Trim().ToString();
     }
     XmlNode assumedRoleUserNode = resultNode.FirstChild("AssumedRoleUser");
     if(!assumedRoleUserNode.IsNull())
@@ -67,17 +67,17 @@ AssumeRoleWithWebIdentityResult& AssumeRoleWithWebIdentityResult::operator =(con
     XmlNode packedPolicySizeNode = resultNode.FirstChild("PackedPolicySize");
     if(!packedPolicySizeNode.IsNull())
     {
-      m_packedPolicySize = StringUtils::ConvertToInt32(StringUtils::Trim(packedPolicySizeNode.GetText().c_str()).c_str());
+      m_packedPolicySize = StringUtils::ConvertToInt32(packedPolicySizeNode.GetTextView().Trim().ToString().c_str());
     }
     XmlNode providerNode = resultNode.FirstChild("Provider");
     if(!providerNode.IsNull())
     {
-      m_provider = StringUtils::Trim(providerNode.GetText().c_str());
+      m_provider = providerNode.GetTextView().Trim().ToString();
     }
     XmlNode audienceNode = resultNode.FirstChild("Audience");
     if(!audienceNode.IsNull())
     {
-      m_audience = StringUtils::Trim(audienceNode.GetText().c_str());
+      m_audience = audienceNode.GetTextView().Trim().ToString();
     }
   }
 
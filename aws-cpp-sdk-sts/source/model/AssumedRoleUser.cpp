@@ -51,13 +51,13 @@ AssumedRoleUser& AssumedRoleUser::operator =(const XmlNode& xmlNode)
     XmlNode assumedRoleIdNode = resultNode.FirstChild("AssumedRoleId");
     if(!assumedRoleIdNode.IsNull())
     {
-      m_assumedRoleId = StringUtils::Trim(assumedRoleIdNode.GetText().c_str());
+      m_assumedRoleId = assumedRoleIdNode.GetTextView().Trim().ToString();
       m_assumedRoleIdHasBeenSet = true;
     }
     XmlNode arnNode = resultNode.FirstChild("Arn");
     if(!arnNode.IsNull())
     {
-      m_arn = StringUtils::Trim(arnNode.GetText().c_str());
+      m_arn = arnNode.GetTextView().Trim().ToString();
       m_arnHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void AssumedRoleUser::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_assumedRoleIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AssumedRoleId=" << StringUtils::URLEncode(m_assumedRoleId.c_str()) << "&";
+      oStream << location << index << locationValue << ".AssumedRoleId=" << StringUtils::URLEncoded(m_assumedRoleId) << "&";
   }
 
   if(m_arnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void AssumedRoleUser::OutputToStream(Aws::OStream& oStream, const char* location
 {
   if(m_assumedRoleIdHasBeenSet)
   {
-      oStream << location << ".AssumedRoleId=" << StringUtils::URLEncode(m_assumedRoleId.c_str()) << "&";
+      oStream << location << ".AssumedRoleId=" << StringUtils::URLEncoded(m_assumedRoleId) << "&";
   }
   if(m_arnHasBeenSet)
   {
-      oStream << location << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
 }
 
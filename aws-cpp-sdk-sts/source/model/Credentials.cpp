@@ -55,25 +55,25 @@ Credentials& Credentials::operator =(const XmlNode& xmlNode)
     XmlNode accessKeyIdNode = resultNode.FirstChild("AccessKeyId");
     if(!accessKeyIdNode.IsNull())
     {
-      m_accessKeyId = StringUtils::Trim(accessKeyIdNode.GetText().c_str());
+      m_accessKeyId = accessKeyIdNode.GetTextView().Trim().ToString();
       m_accessKeyIdHasBeenSet = true;
     }
     XmlNode secretAccessKeyNode = resultNode.FirstChild("SecretAccessKey");
     if(!secretAccessKeyNode.IsNull())
     {
-      m_secretAccessKey = StringUtils::Trim(secretAccessKeyNode.GetText().c_str());
+      m_secretAccessKey = secretAccessKeyNode.GetTextView().Trim().ToString();
       m_secretAccessKeyHasBeenSet = true;
     }
     XmlNode sessionTokenNode = resultNode.FirstChild("SessionToken");
     if(!sessionTokenNode.IsNull())
     {
-      m_sessionToken = StringUtils::Trim(sessionTokenNode.GetText().c_str());
+      m_sessionToken = sessionTokenNode.GetTextView().Trim().ToString();
       m_sessionTokenHasBeenSet = true;
     }
     XmlNode expirationNode = resultNode.FirstChild("Expiration");
     if(!expirationNode.IsNull())
     {
-      m_expiration = DateTime(StringUtils::Trim(expirationNode.GetText().c_str()).c_str(), DateFormat::ISO_8601);
+      m_expiration = DateTime(expirationNode.GetTextView().Trim().ToString().c_str(), DateFormat::ISO_8601);
       m_expirationHasBeenSet = true;
     }
   }
@@ -85,22 +85,22 @@ void Credentials::OutputToStream(Aws::OStream& oStream, const char* location, un
 {
   if(m_accessKeyIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".AccessKeyId=" << StringUtils::URLEncode(m_accessKeyId.c_str()) << "&";
+      oStream << location << index << locationValue << ".AccessKeyId=" << StringUtils::URLEncoded(m_accessKeyId) << "&";
   }
 
   if(m_secretAccessKeyHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SecretAccessKey=" << StringUtils::URLEncode(m_secretAccessKey.c_str()) << "&";
+      oStream << location << index << locationValue << ".SecretAccessKey=" << StringUtils::URLEncoded(m_secretAccessKey) << "&";
   }
 
   if(m_sessionTokenHasBeenSet)
   {
-      oStream << location << index << locationValue << ".SessionToken=" << StringUtils::URLEncode(m_sessionToken.c_str()) << "&";
+      oStream << location << index << locationValue << ".SessionToken=" << StringUtils::URLEncoded(m_sessionToken) << "&";
   }
 
   if(m_expirationHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Expiration=" << StringUtils::URLEncode(m_expiration.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << index << locationValue << ".Expiration=" << StringUtils::URLEncoded(m_expiration.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 
 }
@@ -109,19 +109,19 @@ void Credentials::OutputToStream(Aws::OStream& oStream, const char* location) co
 {
   if(m_accessKeyIdHasBeenSet)
   {
-      oStream << location << ".AccessKeyId=" << StringUtils::URLEncode(m_accessKeyId.c_str()) << "&";
+      oStream << location << ".AccessKeyId=" << StringUtils::URLEncoded(m_accessKeyId) << "&";
   }
   if(m_secretAccessKeyHasBeenSet)
   {
-      oStream << location << ".SecretAccessKey=" << StringUtils::URLEncode(m_secretAccessKey.c_str()) << "&";
+      oStream << location << ".SecretAccessKey=" << StringUtils::URLEncoded(m_secretAccessKey) << "&";
   }
   if(m_sessionTokenHasBeenSet)
   {
-      oStream << location << ".SessionToken=" << StringUtils::URLEncode(m_sessionToken.c_str()) << "&";
+      oStream << location << ".SessionToken=" << StringUtils::URLEncoded(m_sessionToken) << "&";
   }
   if(m_expirationHasBeenSet)
   {
-      oStream << location << ".Expiration=" << StringUtils::URLEncode(m_expiration.ToGmtString(DateFormat::ISO_8601).c_str()) << "&";
+      oStream << location << ".Expiration=" << StringUtils::URLEncoded(m_expiration.ToGmtString(DateFormat::ISO_8601)) << "&";
   }
 }
 
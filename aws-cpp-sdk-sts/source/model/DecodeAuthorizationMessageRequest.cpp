@@ -15,6 +15,7 @@
 #include <aws/sts/model/DecodeAuthorizationMessageRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::STS::Model;
 using namespace Aws::Utils;
@@ -26,14 +27,14 @@ DecodeAuthorizationMessageRequest::DecodeAuthorizationMessageRequest() :
 
 Aws::String DecodeAuthorizationMessageRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=DecodeAuthorizationMessage&";
   if(m_encodedMessageHasBeenSet)
   {
-    ss << "EncodedMessage=" << StringUtils::URLEncode(m_encodedMessage.c_str()) << "&";
+    ss << "EncodedMessage=" << StringUtils::URLEncoded(m_encodedMessage) << "&";
   }
 
   ss << "Version=2011-06-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ DecodeAuthorizationMessageResult& DecodeAuthorizationMessageResult::operator =(c
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "DecodeAuthorizationMessageResult")
+  if (rootNode.GetNameView() != "DecodeAuthorizationMessageResult")
   {
     resultNode = rootNode.FirstChild("DecodeAuthorizationMessageResult");
   }
@@ -50,7 +50,7 @@ DecodeAuthorizationMessageResult& DecodeAuthorizationMessageResult::operator =(c
     XmlNode decodedMessageNode = resultNode.FirstChild("DecodedMessage");
     if(!decodedMessageNode.IsNull())
     {
-      m_decodedMessage = StringUtils::Trim(decodedMessageNode.GetText().c_str());
+      m_decodedMessage = decodedMessageNode.GetTextView().Trim().ToString();
     }
   }
 
@@ -51,13 +51,13 @@ FederatedUser& FederatedUser::operator =(const XmlNode& xmlNode)
     XmlNode federatedUserIdNode = resultNode.FirstChild("FederatedUserId");
     if(!federatedUserIdNode.IsNull())
     {
-      m_federatedUserId = StringUtils::Trim(federatedUserIdNode.GetText().c_str());
+      m_federatedUserId = federatedUserIdNode.GetTextView().Trim().ToString();
       m_federatedUserIdHasBeenSet = true;
     }
     XmlNode arnNode = resultNode.FirstChild("Arn");
     if(!arnNode.IsNull())
     {
-      m_arn = StringUtils::Trim(arnNode.GetText().c_str());
+      m_arn = arnNode.GetTextView().Trim().ToString();
       m_arnHasBeenSet = true;
     }
   }
@@ -69,12 +69,12 @@ void FederatedUser::OutputToStream(Aws::OStream& oStream, const char* location,
 {
   if(m_federatedUserIdHasBeenSet)
   {
-      oStream << location << index << locationValue << ".FederatedUserId=" << StringUtils::URLEncode(m_federatedUserId.c_str()) << "&";
+      oStream << location << index << locationValue << ".FederatedUserId=" << StringUtils::URLEncoded(m_federatedUserId) << "&";
   }
 
   if(m_arnHasBeenSet)
   {
-      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << index << locationValue << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
 
 }
@@ -83,11 +83,11 @@ void FederatedUser::OutputToStream(Aws::OStream& oStream, const char* location)
 {
   if(m_federatedUserIdHasBeenSet)
   {
-      oStream << location << ".FederatedUserId=" << StringUtils::URLEncode(m_federatedUserId.c_str()) << "&";
+      oStream << location << ".FederatedUserId=" << StringUtils::URLEncoded(m_federatedUserId) << "&";
   }
   if(m_arnHasBeenSet)
   {
-      oStream << location << ".Arn=" << StringUtils::URLEncode(m_arn.c_str()) << "&";
+      oStream << location << ".Arn=" << StringUtils::URLEncoded(m_arn) << "&";
   }
 }
 
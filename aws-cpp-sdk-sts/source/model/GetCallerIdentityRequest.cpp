@@ -15,6 +15,7 @@
 #include <aws/sts/model/GetCallerIdentityRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::STS::Model;
 using namespace Aws::Utils;
@@ -25,9 +26,9 @@ GetCallerIdentityRequest::GetCallerIdentityRequest()
 
 Aws::String GetCallerIdentityRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetCallerIdentity&";
   ss << "Version=2011-06-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -40,7 +40,7 @@ GetCallerIdentityResult& GetCallerIdentityResult::operator =(const AmazonWebServ
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetCallerIdentityResult")
+  if (rootNode.GetNameView() != "GetCallerIdentityResult")
   {
     resultNode = rootNode.FirstChild("GetCallerIdentityResult");
   }
@@ -50,17 +50,17 @@ GetCallerIdentityResult& GetCallerIdentityResult::operator =(const AmazonWebServ
     XmlNode userIdNode = resultNode.FirstChild("UserId");
     if(!userIdNode.IsNull())
     {
-      m_userId = StringUtils::Trim(userIdNode.GetText().c_str());
+      m_userId = userIdNode.GetTextView().Trim().ToString();
     }
     XmlNode accountNode = resultNode.FirstChild("Account");
     if(!accountNode.IsNull())
     {
-      m_account = StringUtils::Trim(accountNode.GetText().c_str());
+      m_account = accountNode.GetTextView().Trim().ToString();
     }
     XmlNode arnNode = resultNode.FirstChild("Arn");
     if(!arnNode.IsNull())
     {
-      m_arn = StringUtils::Trim(arnNode.GetText().c_str());
+      m_arn = arnNode.GetTextView().Trim().ToString();
     }
   }
 
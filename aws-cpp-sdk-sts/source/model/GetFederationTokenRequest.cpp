@@ -15,6 +15,7 @@
 #include <aws/sts/model/GetFederationTokenRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::STS::Model;
 using namespace Aws::Utils;
@@ -29,16 +30,16 @@ GetFederationTokenRequest::GetFederationTokenRequest() :
 
 Aws::String GetFederationTokenRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetFederationToken&";
   if(m_nameHasBeenSet)
   {
-    ss << "Name=" << StringUtils::URLEncode(m_name.c_str()) << "&";
+    ss << "Name=" << StringUtils::URLEncoded(m_name) << "&";
   }
 
   if(m_policyHasBeenSet)
   {
-    ss << "Policy=" << StringUtils::URLEncode(m_policy.c_str()) << "&";
+    ss << "Policy=" << StringUtils::URLEncoded(m_policy) << "&";
   }
 
   if(m_durationSecondsHasBeenSet)
@@ -47,6 +48,6 @@ Aws::String GetFederationTokenRequest::SerializePayload() const
   }
 
   ss << "Version=2011-06-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
@@ -42,7 +42,7 @@ GetFederationTokenResult& GetFederationTokenResult::operator =(const AmazonWebSe
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetFederationTokenResult")
+  if (rootNode.GetNameView() != "GetFederationTokenResult")
   {
     resultNode = rootNode.FirstChild("GetFederationTokenResult");
   }
@@ -62,7 +62,7 @@ GetFederationTokenResult& GetFederationTokenResult::operator =(const AmazonWebSe
     XmlNode packedPolicySizeNode = resultNode.FirstChild("PackedPolicySize");
     if(!packedPolicySizeNode.IsNull())
     {
-      m_packedPolicySize = StringUtils::ConvertToInt32(StringUtils::Trim(packedPolicySizeNode.GetText().c_str()).c_str());
+      m_packedPolicySize = StringUtils::ConvertToInt32(packedPolicySizeNode.GetTextView().Trim().ToString().c_str());
     }
   }
 
@@ -15,6 +15,7 @@
 #include <aws/sts/model/GetSessionTokenRequest.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/StringOutputStream.h>
 
 using namespace Aws::STS::Model;
 using namespace Aws::Utils;
@@ -29,7 +30,7 @@ GetSessionTokenRequest::GetSessionTokenRequest() :
 
 Aws::String GetSessionTokenRequest::SerializePayload() const
 {
-  Aws::StringStream ss;
+  Aws::Utils::Stream::StringOutputStream ss;
   ss << "Action=GetSessionToken&";
   if(m_durationSecondsHasBeenSet)
   {
@@ -38,15 +39,15 @@ Aws::String GetSessionTokenRequest::SerializePayload() const
 
   if(m_serialNumberHasBeenSet)
   {
-    ss << "SerialNumber=" << StringUtils::URLEncode(m_serialNumber.c_str()) << "&";
+    ss << "SerialNumber=" << StringUtils::URLEncoded(m_serialNumber) << "&";
   }
 
   if(m_tokenCodeHasBeenSet)
   {
-    ss << "TokenCode=" << StringUtils::URLEncode(m_tokenCode.c_str()) << "&";
+    ss << "TokenCode=" << StringUtils::URLEncoded(m_tokenCode) << "&";
   }
 
   ss << "Version=2011-06-15";
-  return ss.str();
+  return ss.TakeString();
 }
 
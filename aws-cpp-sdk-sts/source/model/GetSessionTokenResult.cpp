@@ -40,7 +40,7 @@ GetSessionTokenResult& GetSessionTokenResult::operator =(const AmazonWebServiceR
   const XmlDocument& xmlDocument = result.GetPayload();
   XmlNode rootNode = xmlDocument.GetRootElement();
   XmlNode resultNode = rootNode;
-  if (rootNode.GetName() != "GetSessionTokenResult")
+  if (rootNode.GetNameView() != "GetSessionTokenResult")
   {
     resultNode = rootNode.FirstChild("GetSessionTokenResult");
   }
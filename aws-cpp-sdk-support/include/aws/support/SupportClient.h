@@ -35,6 +35,9 @@
 #include <aws/support/model/RefreshTrustedAdvisorCheckResult.h>
 #include <aws/support/model/ResolveCaseResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -253,6 +256,18 @@ namespace Model
          */
         virtual void AddAttachmentsToSetAsync(const Model::AddAttachmentsToSetRequest& request, const AddAttachmentsToSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddAttachmentsToSetCallable(const Model::AddAttachmentsToSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddAttachmentsToSetOutcomeCallable AddAttachmentsToSetCallable(Model::AddAttachmentsToSetRequest&& request) const;
+
+        /**
+         * Same as AddAttachmentsToSetAsync(const Model::AddAttachmentsToSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddAttachmentsToSetAsync(Model::AddAttachmentsToSetRequest&& request, const AddAttachmentsToSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds additional customer communication to an AWS Support case. You use the
          * <code>CaseId</code> value to identify the case to add communication to. You can
@@ -290,6 +305,18 @@ namespace Model
          */
         virtual void AddCommunicationToCaseAsync(const Model::AddCommunicationToCaseRequest& request, const AddCommunicationToCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddCommunicationToCaseCallable(const Model::AddCommunicationToCaseRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::AddCommunicationToCaseOutcomeCallable AddCommunicationToCaseCallable(Model::AddCommunicationToCaseRequest&& request) const;
+
+        /**
+         * Same as AddCommunicationToCaseAsync(const Model::AddCommunicationToCaseRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void AddCommunicationToCaseAsync(Model::AddCommunicationToCaseRequest&& request, const AddCommunicationToCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new case in the AWS Support Center. This operation is modeled on
          * the behavior of the AWS Support Center <a
@@ -411,6 +438,18 @@ namespace Model
          */
         virtual void CreateCaseAsync(const Model::CreateCaseRequest& request, const CreateCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCaseCallable(const Model::CreateCaseRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateCaseOutcomeCallable CreateCaseCallable(Model::CreateCaseRequest&& request) const;
+
+        /**
+         * Same as CreateCaseAsync(const Model::CreateCaseRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateCaseAsync(Model::CreateCaseRequest&& request, const CreateCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the attachment that has the specified ID. Attachment IDs are
          * generated by the case management system when you add an attachment to a case or
@@ -439,6 +478,18 @@ namespace Model
          */
         virtual void DescribeAttachmentAsync(const Model::DescribeAttachmentRequest& request, const DescribeAttachmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAttachmentCallable(const Model::DescribeAttachmentRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeAttachmentOutcomeCallable DescribeAttachmentCallable(Model::DescribeAttachmentRequest&& request) const;
+
+        /**
+         * Same as DescribeAttachmentAsync(const Model::DescribeAttachmentRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeAttachmentAsync(Model::DescribeAttachmentRequest&& request, const DescribeAttachmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of cases that you specify by passing one or more case IDs. In
          * addition, you can filter the cases by date by setting values for the
@@ -488,6 +539,18 @@ namespace Model
          */
         virtual void DescribeCasesAsync(const Model::DescribeCasesRequest& request, const DescribeCasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCasesCallable(const Model::DescribeCasesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCasesOutcomeCallable DescribeCasesCallable(Model::DescribeCasesRequest&& request) const;
+
+        /**
+         * Same as DescribeCasesAsync(const Model::DescribeCasesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCasesAsync(Model::DescribeCasesRequest&& request, const DescribeCasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns communications (and attachments) for one or more support cases. You
          * can use the <code>AfterTime</code> and <code>BeforeTime</code> parameters to
@@ -534,6 +597,18 @@ namespace Model
          */
         virtual void DescribeCommunicationsAsync(const Model::DescribeCommunicationsRequest& request, const DescribeCommunicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCommunicationsCallable(const Model::DescribeCommunicationsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeCommunicationsOutcomeCallable DescribeCommunicationsCallable(Model::DescribeCommunicationsRequest&& request) const;
+
+        /**
+         * Same as DescribeCommunicationsAsync(const Model::DescribeCommunicationsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeCommunicationsAsync(Model::DescribeCommunicationsRequest&& request, const DescribeCommunicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the current list of AWS services and a list of service categories
          * that applies to each one. You then use service names and categories in your
@@ -586,6 +661,18 @@ namespace Model
          */
         virtual void DescribeServicesAsync(const Model::DescribeServicesRequest& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeServicesCallable(const Model::DescribeServicesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeServicesOutcomeCallable DescribeServicesCallable(Model::DescribeServicesRequest&& request) const;
+
+        /**
+         * Same as DescribeServicesAsync(const Model::DescribeServicesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeServicesAsync(Model::DescribeServicesRequest&& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the list of severity levels that you can assign to an AWS Support
          * case. The severity level for a case is also a field in the <a>CaseDetails</a>
@@ -611,6 +698,18 @@ namespace Model
          */
         virtual void DescribeSeverityLevelsAsync(const Model::DescribeSeverityLevelsRequest& request, const DescribeSeverityLevelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSeverityLevelsCallable(const Model::DescribeSeverityLevelsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeSeverityLevelsOutcomeCallable DescribeSeverityLevelsCallable(Model::DescribeSeverityLevelsRequest&& request) const;
+
+        /**
+         * Same as DescribeSeverityLevelsAsync(const Model::DescribeSeverityLevelsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeSeverityLevelsAsync(Model::DescribeSeverityLevelsRequest&& request, const DescribeSeverityLevelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the refresh status of the Trusted Advisor checks that have the
          * specified check IDs. Check IDs can be obtained by calling
@@ -636,6 +735,18 @@ namespace Model
          */
         virtual void DescribeTrustedAdvisorCheckRefreshStatusesAsync(const Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest& request, const DescribeTrustedAdvisorCheckRefreshStatusesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTrustedAdvisorCheckRefreshStatusesCallable(const Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTrustedAdvisorCheckRefreshStatusesOutcomeCallable DescribeTrustedAdvisorCheckRefreshStatusesCallable(Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest&& request) const;
+
+        /**
+         * Same as DescribeTrustedAdvisorCheckRefreshStatusesAsync(const Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTrustedAdvisorCheckRefreshStatusesAsync(Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest&& request, const DescribeTrustedAdvisorCheckRefreshStatusesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the results of the Trusted Advisor check that has the specified check
          * ID. Check IDs can be obtained by calling
@@ -685,6 +796,18 @@ namespace Model
          */
         virtual void DescribeTrustedAdvisorCheckResultAsync(const Model::DescribeTrustedAdvisorCheckResultRequest& request, const DescribeTrustedAdvisorCheckResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTrustedAdvisorCheckResultCallable(const Model::DescribeTrustedAdvisorCheckResultRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTrustedAdvisorCheckResultOutcomeCallable DescribeTrustedAdvisorCheckResultCallable(Model::DescribeTrustedAdvisorCheckResultRequest&& request) const;
+
+        /**
+         * Same as DescribeTrustedAdvisorCheckResultAsync(const Model::DescribeTrustedAdvisorCheckResultRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTrustedAdvisorCheckResultAsync(Model::DescribeTrustedAdvisorCheckResultRequest&& request, const DescribeTrustedAdvisorCheckResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the summaries of the results of the Trusted Advisor checks that have
          * the specified check IDs. Check IDs can be obtained by calling
@@ -713,6 +836,18 @@ namespace Model
          */
         virtual void DescribeTrustedAdvisorCheckSummariesAsync(const Model::DescribeTrustedAdvisorCheckSummariesRequest& request, const DescribeTrustedAdvisorCheckSummariesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTrustedAdvisorCheckSummariesCallable(const Model::DescribeTrustedAdvisorCheckSummariesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTrustedAdvisorCheckSummariesOutcomeCallable DescribeTrustedAdvisorCheckSummariesCallable(Model::DescribeTrustedAdvisorCheckSummariesRequest&& request) const;
+
+        /**
+         * Same as DescribeTrustedAdvisorCheckSummariesAsync(const Model::DescribeTrustedAdvisorCheckSummariesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTrustedAdvisorCheckSummariesAsync(Model::DescribeTrustedAdvisorCheckSummariesRequest&& request, const DescribeTrustedAdvisorCheckSummariesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about all available Trusted Advisor checks, including
          * name, ID, category, description, and metadata. You must specify a language code;
@@ -741,6 +876,18 @@ namespace Model
          */
         virtual void DescribeTrustedAdvisorChecksAsync(const Model::DescribeTrustedAdvisorChecksRequest& request, const DescribeTrustedAdvisorChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTrustedAdvisorChecksCallable(const Model::DescribeTrustedAdvisorChecksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTrustedAdvisorChecksOutcomeCallable DescribeTrustedAdvisorChecksCallable(Model::DescribeTrustedAdvisorChecksRequest&& request) const;
+
+        /**
+         * Same as DescribeTrustedAdvisorChecksAsync(const Model::DescribeTrustedAdvisorChecksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTrustedAdvisorChecksAsync(Model::DescribeTrustedAdvisorChecksRequest&& request, const DescribeTrustedAdvisorChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a refresh of the Trusted Advisor check that has the specified check
          * ID. Check IDs can be obtained by calling
@@ -784,6 +931,18 @@ namespace Model
          */
         virtual void RefreshTrustedAdvisorCheckAsync(const Model::RefreshTrustedAdvisorCheckRequest& request, const RefreshTrustedAdvisorCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RefreshTrustedAdvisorCheckCallable(const Model::RefreshTrustedAdvisorCheckRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RefreshTrustedAdvisorCheckOutcomeCallable RefreshTrustedAdvisorCheckCallable(Model::RefreshTrustedAdvisorCheckRequest&& request) const;
+
+        /**
+         * Same as RefreshTrustedAdvisorCheckAsync(const Model::RefreshTrustedAdvisorCheckRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RefreshTrustedAdvisorCheckAsync(Model::RefreshTrustedAdvisorCheckRequest&& request, const RefreshTrustedAdvisorCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Takes a <code>CaseId</code> and returns the initial state of the case along
          * with the state of the case after the call to <a>ResolveCase</a> completed.</p>
@@ -806,6 +965,100 @@ namespace Model
          */
         virtual void ResolveCaseAsync(const Model::ResolveCaseRequest& request, const ResolveCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResolveCaseCallable(const Model::ResolveCaseRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ResolveCaseOutcomeCallable ResolveCaseCallable(Model::ResolveCaseRequest&& request) const;
+
+        /**
+         * Same as ResolveCaseAsync(const Model::ResolveCaseRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ResolveCaseAsync(Model::ResolveCaseRequest&& request, const ResolveCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeCases(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SupportClient, Model::DescribeCasesRequest, Model::DescribeCasesOutcome> DescribeCasesPaginator(const Model::DescribeCasesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeCommunications(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SupportClient, Model::DescribeCommunicationsRequest, Model::DescribeCommunicationsOutcome> DescribeCommunicationsPaginator(const Model::DescribeCommunicationsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of AddAttachmentsToSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SupportClient, Model::AddAttachmentsToSetRequest, Model::AddAttachmentsToSetOutcome> AddAttachmentsToSetAwaitable(Model::AddAttachmentsToSetRequest request) const;
+
+        /**
+         * co_await-able form of AddCommunicationToCase(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SupportClient, Model::AddCommunicationToCaseRequest, Model::AddCommunicationToCaseOutcome> AddCommunicationToCaseAwaitable(Model::AddCommunicationToCaseRequest request) const;
+
+        /**
+         * co_await-able form of CreateCase(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SupportClient, Model::CreateCaseRequest, Model::CreateCaseOutcome> CreateCaseAwaitable(Model::CreateCaseRequest request) const;
+
+        /**
+         * co_await-able form of DescribeAttachment(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SupportClient, Model::DescribeAttachmentRequest, Model::DescribeAttachmentOutcome> DescribeAttachmentAwaitable(Model::DescribeAttachmentRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCases(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SupportClient, Model::DescribeCasesRequest, Model::DescribeCasesOutcome> DescribeCasesAwaitable(Model::DescribeCasesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeCommunications(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SupportClient, Model::DescribeCommunicationsRequest, Model::DescribeCommunicationsOutcome> DescribeCommunicationsAwaitable(Model::DescribeCommunicationsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeServices(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SupportClient, Model::DescribeServicesRequest, Model::DescribeServicesOutcome> DescribeServicesAwaitable(Model::DescribeServicesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeSeverityLevels(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SupportClient, Model::DescribeSeverityLevelsRequest, Model::DescribeSeverityLevelsOutcome> DescribeSeverityLevelsAwaitable(Model::DescribeSeverityLevelsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTrustedAdvisorCheckRefreshStatuses(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SupportClient, Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest, Model::DescribeTrustedAdvisorCheckRefreshStatusesOutcome> DescribeTrustedAdvisorCheckRefreshStatusesAwaitable(Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTrustedAdvisorCheckResult(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SupportClient, Model::DescribeTrustedAdvisorCheckResultRequest, Model::DescribeTrustedAdvisorCheckResultOutcome> DescribeTrustedAdvisorCheckResultAwaitable(Model::DescribeTrustedAdvisorCheckResultRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTrustedAdvisorCheckSummaries(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SupportClient, Model::DescribeTrustedAdvisorCheckSummariesRequest, Model::DescribeTrustedAdvisorCheckSummariesOutcome> DescribeTrustedAdvisorCheckSummariesAwaitable(Model::DescribeTrustedAdvisorCheckSummariesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTrustedAdvisorChecks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SupportClient, Model::DescribeTrustedAdvisorChecksRequest, Model::DescribeTrustedAdvisorChecksOutcome> DescribeTrustedAdvisorChecksAwaitable(Model::DescribeTrustedAdvisorChecksRequest request) const;
+
+        /**
+         * co_await-able form of RefreshTrustedAdvisorCheck(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SupportClient, Model::RefreshTrustedAdvisorCheckRequest, Model::RefreshTrustedAdvisorCheckOutcome> RefreshTrustedAdvisorCheckAwaitable(Model::RefreshTrustedAdvisorCheckRequest request) const;
+
+        /**
+         * co_await-able form of ResolveCase(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SupportClient, Model::ResolveCaseRequest, Model::ResolveCaseOutcome> ResolveCaseAwaitable(Model::ResolveCaseRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
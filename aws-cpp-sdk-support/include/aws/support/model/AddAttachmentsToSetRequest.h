@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AddAttachmentsToSetRequest();
+    inline const char* GetServiceRequestName() const override { return "AddAttachmentsToSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
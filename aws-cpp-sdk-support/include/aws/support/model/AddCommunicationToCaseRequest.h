@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     AddCommunicationToCaseRequest();
+    inline const char* GetServiceRequestName() const override { return "AddCommunicationToCase"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateCaseRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateCase"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
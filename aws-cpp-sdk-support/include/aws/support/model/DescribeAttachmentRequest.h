@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeAttachmentRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeAttachment"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
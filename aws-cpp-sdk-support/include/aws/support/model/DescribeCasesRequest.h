@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeCasesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCases"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
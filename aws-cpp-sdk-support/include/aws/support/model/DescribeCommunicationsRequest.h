@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeCommunicationsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeCommunications"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
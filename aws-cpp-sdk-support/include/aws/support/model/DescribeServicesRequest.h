@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeServicesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeServices"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeSeverityLevelsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeSeverityLevels"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeTrustedAdvisorCheckRefreshStatusesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTrustedAdvisorCheckRefreshStatuses"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
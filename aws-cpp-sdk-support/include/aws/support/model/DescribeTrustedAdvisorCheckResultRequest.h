@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeTrustedAdvisorCheckResultRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTrustedAdvisorCheckResult"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
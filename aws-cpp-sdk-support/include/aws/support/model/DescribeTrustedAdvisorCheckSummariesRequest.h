@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeTrustedAdvisorCheckSummariesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTrustedAdvisorCheckSummaries"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
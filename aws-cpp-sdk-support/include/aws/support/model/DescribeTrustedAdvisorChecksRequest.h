@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeTrustedAdvisorChecksRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTrustedAdvisorChecks"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RefreshTrustedAdvisorCheckRequest();
+    inline const char* GetServiceRequestName() const override { return "RefreshTrustedAdvisorCheck"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ResolveCaseRequest();
+    inline const char* GetServiceRequestName() const override { return "ResolveCase"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -123,7 +123,7 @@ AddAttachmentsToSetOutcome SupportClient::AddAttachmentsToSet(const AddAttachmen
 
 AddAttachmentsToSetOutcomeCallable SupportClient::AddAttachmentsToSetCallable(const AddAttachmentsToSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddAttachmentsToSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddAttachmentsToSet(request); } );
 }
 
 void SupportClient::AddAttachmentsToSetAsync(const AddAttachmentsToSetRequest& request, const AddAttachmentsToSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -131,6 +131,16 @@ void SupportClient::AddAttachmentsToSetAsync(const AddAttachmentsToSetRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->AddAttachmentsToSetAsyncHelper( request, handler, context ); } );
 }
 
+AddAttachmentsToSetOutcomeCallable SupportClient::AddAttachmentsToSetCallable(AddAttachmentsToSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SupportClient::AddAttachmentsToSet, this, std::move(request)));
+}
+
+void SupportClient::AddAttachmentsToSetAsync(AddAttachmentsToSetRequest&& request, const AddAttachmentsToSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SupportClient::AddAttachmentsToSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SupportClient::AddAttachmentsToSetAsyncHelper(const AddAttachmentsToSetRequest& request, const AddAttachmentsToSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddAttachmentsToSet(request), context);
@@ -154,7 +164,7 @@ AddCommunicationToCaseOutcome SupportClient::AddCommunicationToCase(const AddCom
 
 AddCommunicationToCaseOutcomeCallable SupportClient::AddCommunicationToCaseCallable(const AddCommunicationToCaseRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->AddCommunicationToCase(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->AddCommunicationToCase(request); } );
 }
 
 void SupportClient::AddCommunicationToCaseAsync(const AddCommunicationToCaseRequest& request, const AddCommunicationToCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -162,6 +172,16 @@ void SupportClient::AddCommunicationToCaseAsync(const AddCommunicationToCaseRequ
   m_executor->Submit( [this, request, handler, context](){ this->AddCommunicationToCaseAsyncHelper( request, handler, context ); } );
 }
 
+AddCommunicationToCaseOutcomeCallable SupportClient::AddCommunicationToCaseCallable(AddCommunicationToCaseRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SupportClient::AddCommunicationToCase, this, std::move(request)));
+}
+
+void SupportClient::AddCommunicationToCaseAsync(AddCommunicationToCaseRequest&& request, const AddCommunicationToCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SupportClient::AddCommunicationToCaseAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SupportClient::AddCommunicationToCaseAsyncHelper(const AddCommunicationToCaseRequest& request, const AddCommunicationToCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, AddCommunicationToCase(request), context);
@@ -185,7 +205,7 @@ CreateCaseOutcome SupportClient::CreateCase(const CreateCaseRequest& request) co
 
 CreateCaseOutcomeCallable SupportClient::CreateCaseCallable(const CreateCaseRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateCase(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateCase(request); } );
 }
 
 void SupportClient::CreateCaseAsync(const CreateCaseRequest& request, const CreateCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -193,6 +213,16 @@ void SupportClient::CreateCaseAsync(const CreateCaseRequest& request, const Crea
   m_executor->Submit( [this, request, handler, context](){ this->CreateCaseAsyncHelper( request, handler, context ); } );
 }
 
+CreateCaseOutcomeCallable SupportClient::CreateCaseCallable(CreateCaseRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SupportClient::CreateCase, this, std::move(request)));
+}
+
+void SupportClient::CreateCaseAsync(CreateCaseRequest&& request, const CreateCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SupportClient::CreateCaseAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SupportClient::CreateCaseAsyncHelper(const CreateCaseRequest& request, const CreateCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateCase(request), context);
@@ -216,7 +246,7 @@ DescribeAttachmentOutcome SupportClient::DescribeAttachment(const DescribeAttach
 
 DescribeAttachmentOutcomeCallable SupportClient::DescribeAttachmentCallable(const DescribeAttachmentRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeAttachment(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeAttachment(request); } );
 }
 
 void SupportClient::DescribeAttachmentAsync(const DescribeAttachmentRequest& request, const DescribeAttachmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -224,6 +254,16 @@ void SupportClient::DescribeAttachmentAsync(const DescribeAttachmentRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DescribeAttachmentAsyncHelper( request, handler, context ); } );
 }
 
+DescribeAttachmentOutcomeCallable SupportClient::DescribeAttachmentCallable(DescribeAttachmentRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SupportClient::DescribeAttachment, this, std::move(request)));
+}
+
+void SupportClient::DescribeAttachmentAsync(DescribeAttachmentRequest&& request, const DescribeAttachmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SupportClient::DescribeAttachmentAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SupportClient::DescribeAttachmentAsyncHelper(const DescribeAttachmentRequest& request, const DescribeAttachmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeAttachment(request), context);
@@ -247,7 +287,7 @@ DescribeCasesOutcome SupportClient::DescribeCases(const DescribeCasesRequest& re
 
 DescribeCasesOutcomeCallable SupportClient::DescribeCasesCallable(const DescribeCasesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCases(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCases(request); } );
 }
 
 void SupportClient::DescribeCasesAsync(const DescribeCasesRequest& request, const DescribeCasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -255,6 +295,16 @@ void SupportClient::DescribeCasesAsync(const DescribeCasesRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCasesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCasesOutcomeCallable SupportClient::DescribeCasesCallable(DescribeCasesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SupportClient::DescribeCases, this, std::move(request)));
+}
+
+void SupportClient::DescribeCasesAsync(DescribeCasesRequest&& request, const DescribeCasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SupportClient::DescribeCasesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SupportClient::DescribeCasesAsyncHelper(const DescribeCasesRequest& request, const DescribeCasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCases(request), context);
@@ -278,7 +328,7 @@ DescribeCommunicationsOutcome SupportClient::DescribeCommunications(const Descri
 
 DescribeCommunicationsOutcomeCallable SupportClient::DescribeCommunicationsCallable(const DescribeCommunicationsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeCommunications(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeCommunications(request); } );
 }
 
 void SupportClient::DescribeCommunicationsAsync(const DescribeCommunicationsRequest& request, const DescribeCommunicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -286,6 +336,16 @@ void SupportClient::DescribeCommunicationsAsync(const DescribeCommunicationsRequ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeCommunicationsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeCommunicationsOutcomeCallable SupportClient::DescribeCommunicationsCallable(DescribeCommunicationsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SupportClient::DescribeCommunications, this, std::move(request)));
+}
+
+void SupportClient::DescribeCommunicationsAsync(DescribeCommunicationsRequest&& request, const DescribeCommunicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SupportClient::DescribeCommunicationsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SupportClient::DescribeCommunicationsAsyncHelper(const DescribeCommunicationsRequest& request, const DescribeCommunicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeCommunications(request), context);
@@ -309,7 +369,7 @@ DescribeServicesOutcome SupportClient::DescribeServices(const DescribeServicesRe
 
 DescribeServicesOutcomeCallable SupportClient::DescribeServicesCallable(const DescribeServicesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeServices(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeServices(request); } );
 }
 
 void SupportClient::DescribeServicesAsync(const DescribeServicesRequest& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -317,6 +377,16 @@ void SupportClient::DescribeServicesAsync(const DescribeServicesRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DescribeServicesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeServicesOutcomeCallable SupportClient::DescribeServicesCallable(DescribeServicesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SupportClient::DescribeServices, this, std::move(request)));
+}
+
+void SupportClient::DescribeServicesAsync(DescribeServicesRequest&& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SupportClient::DescribeServicesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SupportClient::DescribeServicesAsyncHelper(const DescribeServicesRequest& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeServices(request), context);
@@ -340,7 +410,7 @@ DescribeSeverityLevelsOutcome SupportClient::DescribeSeverityLevels(const Descri
 
 DescribeSeverityLevelsOutcomeCallable SupportClient::DescribeSeverityLevelsCallable(const DescribeSeverityLevelsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeSeverityLevels(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeSeverityLevels(request); } );
 }
 
 void SupportClient::DescribeSeverityLevelsAsync(const DescribeSeverityLevelsRequest& request, const DescribeSeverityLevelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -348,6 +418,16 @@ void SupportClient::DescribeSeverityLevelsAsync(const DescribeSeverityLevelsRequ
   m_executor->Submit( [this, request, handler, context](){ this->DescribeSeverityLevelsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeSeverityLevelsOutcomeCallable SupportClient::DescribeSeverityLevelsCallable(DescribeSeverityLevelsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SupportClient::DescribeSeverityLevels, this, std::move(request)));
+}
+
+void SupportClient::DescribeSeverityLevelsAsync(DescribeSeverityLevelsRequest&& request, const DescribeSeverityLevelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SupportClient::DescribeSeverityLevelsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SupportClient::DescribeSeverityLevelsAsyncHelper(const DescribeSeverityLevelsRequest& request, const DescribeSeverityLevelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeSeverityLevels(request), context);
@@ -371,7 +451,7 @@ DescribeTrustedAdvisorCheckRefreshStatusesOutcome SupportClient::DescribeTrusted
 
 DescribeTrustedAdvisorCheckRefreshStatusesOutcomeCallable SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesCallable(const DescribeTrustedAdvisorCheckRefreshStatusesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTrustedAdvisorCheckRefreshStatuses(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTrustedAdvisorCheckRefreshStatuses(request); } );
 }
 
 void SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesAsync(const DescribeTrustedAdvisorCheckRefreshStatusesRequest& request, const DescribeTrustedAdvisorCheckRefreshStatusesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -379,6 +459,16 @@ void SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesAsync(const Descri
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTrustedAdvisorCheckRefreshStatusesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTrustedAdvisorCheckRefreshStatusesOutcomeCallable SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesCallable(DescribeTrustedAdvisorCheckRefreshStatusesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SupportClient::DescribeTrustedAdvisorCheckRefreshStatuses, this, std::move(request)));
+}
+
+void SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesAsync(DescribeTrustedAdvisorCheckRefreshStatusesRequest&& request, const DescribeTrustedAdvisorCheckRefreshStatusesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesAsyncHelper(const DescribeTrustedAdvisorCheckRefreshStatusesRequest& request, const DescribeTrustedAdvisorCheckRefreshStatusesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTrustedAdvisorCheckRefreshStatuses(request), context);
@@ -402,7 +492,7 @@ DescribeTrustedAdvisorCheckResultOutcome SupportClient::DescribeTrustedAdvisorCh
 
 DescribeTrustedAdvisorCheckResultOutcomeCallable SupportClient::DescribeTrustedAdvisorCheckResultCallable(const DescribeTrustedAdvisorCheckResultRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTrustedAdvisorCheckResult(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTrustedAdvisorCheckResult(request); } );
 }
 
 void SupportClient::DescribeTrustedAdvisorCheckResultAsync(const DescribeTrustedAdvisorCheckResultRequest& request, const DescribeTrustedAdvisorCheckResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -410,6 +500,16 @@ void SupportClient::DescribeTrustedAdvisorCheckResultAsync(const DescribeTrusted
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTrustedAdvisorCheckResultAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTrustedAdvisorCheckResultOutcomeCallable SupportClient::DescribeTrustedAdvisorCheckResultCallable(DescribeTrustedAdvisorCheckResultRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SupportClient::DescribeTrustedAdvisorCheckResult, this, std::move(request)));
+}
+
+void SupportClient::DescribeTrustedAdvisorCheckResultAsync(DescribeTrustedAdvisorCheckResultRequest&& request, const DescribeTrustedAdvisorCheckResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SupportClient::DescribeTrustedAdvisorCheckResultAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SupportClient::DescribeTrustedAdvisorCheckResultAsyncHelper(const DescribeTrustedAdvisorCheckResultRequest& request, const DescribeTrustedAdvisorCheckResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTrustedAdvisorCheckResult(request), context);
@@ -433,7 +533,7 @@ DescribeTrustedAdvisorCheckSummariesOutcome SupportClient::DescribeTrustedAdviso
 
 DescribeTrustedAdvisorCheckSummariesOutcomeCallable SupportClient::DescribeTrustedAdvisorCheckSummariesCallable(const DescribeTrustedAdvisorCheckSummariesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTrustedAdvisorCheckSummaries(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTrustedAdvisorCheckSummaries(request); } );
 }
 
 void SupportClient::DescribeTrustedAdvisorCheckSummariesAsync(const DescribeTrustedAdvisorCheckSummariesRequest& request, const DescribeTrustedAdvisorCheckSummariesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -441,6 +541,16 @@ void SupportClient::DescribeTrustedAdvisorCheckSummariesAsync(const DescribeTrus
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTrustedAdvisorCheckSummariesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTrustedAdvisorCheckSummariesOutcomeCallable SupportClient::DescribeTrustedAdvisorCheckSummariesCallable(DescribeTrustedAdvisorCheckSummariesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SupportClient::DescribeTrustedAdvisorCheckSummaries, this, std::move(request)));
+}
+
+void SupportClient::DescribeTrustedAdvisorCheckSummariesAsync(DescribeTrustedAdvisorCheckSummariesRequest&& request, const DescribeTrustedAdvisorCheckSummariesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SupportClient::DescribeTrustedAdvisorCheckSummariesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SupportClient::DescribeTrustedAdvisorCheckSummariesAsyncHelper(const DescribeTrustedAdvisorCheckSummariesRequest& request, const DescribeTrustedAdvisorCheckSummariesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTrustedAdvisorCheckSummaries(request), context);
@@ -464,7 +574,7 @@ DescribeTrustedAdvisorChecksOutcome SupportClient::DescribeTrustedAdvisorChecks(
 
 DescribeTrustedAdvisorChecksOutcomeCallable SupportClient::DescribeTrustedAdvisorChecksCallable(const DescribeTrustedAdvisorChecksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTrustedAdvisorChecks(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTrustedAdvisorChecks(request); } );
 }
 
 void SupportClient::DescribeTrustedAdvisorChecksAsync(const DescribeTrustedAdvisorChecksRequest& request, const DescribeTrustedAdvisorChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -472,6 +582,16 @@ void SupportClient::DescribeTrustedAdvisorChecksAsync(const DescribeTrustedAdvis
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTrustedAdvisorChecksAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTrustedAdvisorChecksOutcomeCallable SupportClient::DescribeTrustedAdvisorChecksCallable(DescribeTrustedAdvisorChecksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SupportClient::DescribeTrustedAdvisorChecks, this, std::move(request)));
+}
+
+void SupportClient::DescribeTrustedAdvisorChecksAsync(DescribeTrustedAdvisorChecksRequest&& request, const DescribeTrustedAdvisorChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SupportClient::DescribeTrustedAdvisorChecksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SupportClient::DescribeTrustedAdvisorChecksAsyncHelper(const DescribeTrustedAdvisorChecksRequest& request, const DescribeTrustedAdvisorChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTrustedAdvisorChecks(request), context);
@@ -495,7 +615,7 @@ RefreshTrustedAdvisorCheckOutcome SupportClient::RefreshTrustedAdvisorCheck(cons
 
 RefreshTrustedAdvisorCheckOutcomeCallable SupportClient::RefreshTrustedAdvisorCheckCallable(const RefreshTrustedAdvisorCheckRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RefreshTrustedAdvisorCheck(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RefreshTrustedAdvisorCheck(request); } );
 }
 
 void SupportClient::RefreshTrustedAdvisorCheckAsync(const RefreshTrustedAdvisorCheckRequest& request, const RefreshTrustedAdvisorCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -503,6 +623,16 @@ void SupportClient::RefreshTrustedAdvisorCheckAsync(const RefreshTrustedAdvisorC
   m_executor->Submit( [this, request, handler, context](){ this->RefreshTrustedAdvisorCheckAsyncHelper( request, handler, context ); } );
 }
 
+RefreshTrustedAdvisorCheckOutcomeCallable SupportClient::RefreshTrustedAdvisorCheckCallable(RefreshTrustedAdvisorCheckRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SupportClient::RefreshTrustedAdvisorCheck, this, std::move(request)));
+}
+
+void SupportClient::RefreshTrustedAdvisorCheckAsync(RefreshTrustedAdvisorCheckRequest&& request, const RefreshTrustedAdvisorCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SupportClient::RefreshTrustedAdvisorCheckAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SupportClient::RefreshTrustedAdvisorCheckAsyncHelper(const RefreshTrustedAdvisorCheckRequest& request, const RefreshTrustedAdvisorCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RefreshTrustedAdvisorCheck(request), context);
@@ -526,7 +656,7 @@ ResolveCaseOutcome SupportClient::ResolveCase(const ResolveCaseRequest& request)
 
 ResolveCaseOutcomeCallable SupportClient::ResolveCaseCallable(const ResolveCaseRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ResolveCase(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ResolveCase(request); } );
 }
 
 void SupportClient::ResolveCaseAsync(const ResolveCaseRequest& request, const ResolveCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -534,8 +664,124 @@ void SupportClient::ResolveCaseAsync(const ResolveCaseRequest& request, const Re
   m_executor->Submit( [this, request, handler, context](){ this->ResolveCaseAsyncHelper( request, handler, context ); } );
 }
 
+ResolveCaseOutcomeCallable SupportClient::ResolveCaseCallable(ResolveCaseRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SupportClient::ResolveCase, this, std::move(request)));
+}
+
+void SupportClient::ResolveCaseAsync(ResolveCaseRequest&& request, const ResolveCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SupportClient::ResolveCaseAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SupportClient::ResolveCaseAsyncHelper(const ResolveCaseRequest& request, const ResolveCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ResolveCase(request), context);
 }
 
+Paginator<SupportClient, DescribeCasesRequest, DescribeCasesOutcome> SupportClient::DescribeCasesPaginator(const DescribeCasesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SupportClient, DescribeCasesRequest, DescribeCasesOutcome>(this, &SupportClient::DescribeCases, request,
+    [](const DescribeCasesRequest& current, const DescribeCasesOutcome& outcome, DescribeCasesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SupportClient, DescribeCommunicationsRequest, DescribeCommunicationsOutcome> SupportClient::DescribeCommunicationsPaginator(const DescribeCommunicationsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SupportClient, DescribeCommunicationsRequest, DescribeCommunicationsOutcome>(this, &SupportClient::DescribeCommunications, request,
+    [](const DescribeCommunicationsRequest& current, const DescribeCommunicationsOutcome& outcome, DescribeCommunicationsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<SupportClient, AddAttachmentsToSetRequest, AddAttachmentsToSetOutcome> SupportClient::AddAttachmentsToSetAwaitable(AddAttachmentsToSetRequest request) const
+{
+  return { m_executor.get(), { this, &SupportClient::AddAttachmentsToSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<SupportClient, AddCommunicationToCaseRequest, AddCommunicationToCaseOutcome> SupportClient::AddCommunicationToCaseAwaitable(AddCommunicationToCaseRequest request) const
+{
+  return { m_executor.get(), { this, &SupportClient::AddCommunicationToCase, std::move(request) } };
+}
+
+ClientOperationAwaitable<SupportClient, CreateCaseRequest, CreateCaseOutcome> SupportClient::CreateCaseAwaitable(CreateCaseRequest request) const
+{
+  return { m_executor.get(), { this, &SupportClient::CreateCase, std::move(request) } };
+}
+
+ClientOperationAwaitable<SupportClient, DescribeAttachmentRequest, DescribeAttachmentOutcome> SupportClient::DescribeAttachmentAwaitable(DescribeAttachmentRequest request) const
+{
+  return { m_executor.get(), { this, &SupportClient::DescribeAttachment, std::move(request) } };
+}
+
+ClientOperationAwaitable<SupportClient, DescribeCasesRequest, DescribeCasesOutcome> SupportClient::DescribeCasesAwaitable(DescribeCasesRequest request) const
+{
+  return { m_executor.get(), { this, &SupportClient::DescribeCases, std::move(request) } };
+}
+
+ClientOperationAwaitable<SupportClient, DescribeCommunicationsRequest, DescribeCommunicationsOutcome> SupportClient::DescribeCommunicationsAwaitable(DescribeCommunicationsRequest request) const
+{
+  return { m_executor.get(), { this, &SupportClient::DescribeCommunications, std::move(request) } };
+}
+
+ClientOperationAwaitable<SupportClient, DescribeServicesRequest, DescribeServicesOutcome> SupportClient::DescribeServicesAwaitable(DescribeServicesRequest request) const
+{
+  return { m_executor.get(), { this, &SupportClient::DescribeServices, std::move(request) } };
+}
+
+ClientOperationAwaitable<SupportClient, DescribeSeverityLevelsRequest, DescribeSeverityLevelsOutcome> SupportClient::DescribeSeverityLevelsAwaitable(DescribeSeverityLevelsRequest request) const
+{
+  return { m_executor.get(), { this, &SupportClient::DescribeSeverityLevels, std::move(request) } };
+}
+
+ClientOperationAwaitable<SupportClient, DescribeTrustedAdvisorCheckRefreshStatusesRequest, DescribeTrustedAdvisorCheckRefreshStatusesOutcome> SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesAwaitable(DescribeTrustedAdvisorCheckRefreshStatusesRequest request) const
+{
+  return { m_executor.get(), { this, &SupportClient::DescribeTrustedAdvisorCheckRefreshStatuses, std::move(request) } };
+}
+
+ClientOperationAwaitable<SupportClient, DescribeTrustedAdvisorCheckResultRequest, DescribeTrustedAdvisorCheckResultOutcome> SupportClient::DescribeTrustedAdvisorCheckResultAwaitable(DescribeTrustedAdvisorCheckResultRequest request) const
+{
+  return { m_executor.get(), { this, &SupportClient::DescribeTrustedAdvisorCheckResult, std::move(request) } };
+}
+
+ClientOperationAwaitable<SupportClient, DescribeTrustedAdvisorCheckSummariesRequest, DescribeTrustedAdvisorCheckSummariesOutcome> SupportClient::DescribeTrustedAdvisorCheckSummariesAwaitable(DescribeTrustedAdvisorCheckSummariesRequest request) const
+{
+  return { m_executor.get(), { this, &SupportClient::DescribeTrustedAdvisorCheckSummaries, std::move(request) } };
+}
+
+ClientOperationAwaitable<SupportClient, DescribeTrustedAdvisorChecksRequest, DescribeTrustedAdvisorChecksOutcome> SupportClient::DescribeTrustedAdvisorChecksAwaitable(DescribeTrustedAdvisorChecksRequest request) const
+{
+  return { m_executor.get(), { this, &SupportClient::DescribeTrustedAdvisorChecks, std::move(request) } };
+}
+
+ClientOperationAwaitable<SupportClient, RefreshTrustedAdvisorCheckRequest, RefreshTrustedAdvisorCheckOutcome> SupportClient::RefreshTrustedAdvisorCheckAwaitable(RefreshTrustedAdvisorCheckRequest request) const
+{
+  return { m_executor.get(), { this, &SupportClient::RefreshTrustedAdvisorCheck, std::move(request) } };
+}
+
+ClientOperationAwaitable<SupportClient, ResolveCaseRequest, ResolveCaseOutcome> SupportClient::ResolveCaseAwaitable(ResolveCaseRequest request) const
+{
+  return { m_executor.get(), { this, &SupportClient::ResolveCase, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
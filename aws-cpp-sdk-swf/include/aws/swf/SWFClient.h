@@ -40,6 +40,9 @@
 #include <aws/swf/model/StartWorkflowExecutionResult.h>
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -332,6 +335,18 @@ namespace Model
          */
         virtual void CountClosedWorkflowExecutionsAsync(const Model::CountClosedWorkflowExecutionsRequest& request, const CountClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CountClosedWorkflowExecutionsCallable(const Model::CountClosedWorkflowExecutionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CountClosedWorkflowExecutionsOutcomeCallable CountClosedWorkflowExecutionsCallable(Model::CountClosedWorkflowExecutionsRequest&& request) const;
+
+        /**
+         * Same as CountClosedWorkflowExecutionsAsync(const Model::CountClosedWorkflowExecutionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CountClosedWorkflowExecutionsAsync(Model::CountClosedWorkflowExecutionsRequest&& request, const CountClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the number of open workflow executions within the given domain that
          * meet the specified filtering criteria.</p> <note>This operation is eventually
@@ -408,6 +423,18 @@ namespace Model
          */
         virtual void CountOpenWorkflowExecutionsAsync(const Model::CountOpenWorkflowExecutionsRequest& request, const CountOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CountOpenWorkflowExecutionsCallable(const Model::CountOpenWorkflowExecutionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CountOpenWorkflowExecutionsOutcomeCallable CountOpenWorkflowExecutionsCallable(Model::CountOpenWorkflowExecutionsRequest&& request) const;
+
+        /**
+         * Same as CountOpenWorkflowExecutionsAsync(const Model::CountOpenWorkflowExecutionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CountOpenWorkflowExecutionsAsync(Model::CountOpenWorkflowExecutionsRequest&& request, const CountOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the estimated number of activity tasks in the specified task list.
          * The count returned is an approximation and is not guaranteed to be exact. If you
@@ -475,6 +502,18 @@ namespace Model
          */
         virtual void CountPendingActivityTasksAsync(const Model::CountPendingActivityTasksRequest& request, const CountPendingActivityTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CountPendingActivityTasksCallable(const Model::CountPendingActivityTasksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CountPendingActivityTasksOutcomeCallable CountPendingActivityTasksCallable(Model::CountPendingActivityTasksRequest&& request) const;
+
+        /**
+         * Same as CountPendingActivityTasksAsync(const Model::CountPendingActivityTasksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CountPendingActivityTasksAsync(Model::CountPendingActivityTasksRequest&& request, const CountPendingActivityTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the estimated number of decision tasks in the specified task list.
          * The count returned is an approximation and is not guaranteed to be exact. If you
@@ -542,6 +581,18 @@ namespace Model
          */
         virtual void CountPendingDecisionTasksAsync(const Model::CountPendingDecisionTasksRequest& request, const CountPendingDecisionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CountPendingDecisionTasksCallable(const Model::CountPendingDecisionTasksRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CountPendingDecisionTasksOutcomeCallable CountPendingDecisionTasksCallable(Model::CountPendingDecisionTasksRequest&& request) const;
+
+        /**
+         * Same as CountPendingDecisionTasksAsync(const Model::CountPendingDecisionTasksRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CountPendingDecisionTasksAsync(Model::CountPendingDecisionTasksRequest&& request, const CountPendingDecisionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deprecates the specified <i>activity type</i>. After an activity type has
          * been deprecated, you cannot create new tasks of that activity type. Tasks of
@@ -618,6 +669,18 @@ namespace Model
          */
         virtual void DeprecateActivityTypeAsync(const Model::DeprecateActivityTypeRequest& request, const DeprecateActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeprecateActivityTypeCallable(const Model::DeprecateActivityTypeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeprecateActivityTypeOutcomeCallable DeprecateActivityTypeCallable(Model::DeprecateActivityTypeRequest&& request) const;
+
+        /**
+         * Same as DeprecateActivityTypeAsync(const Model::DeprecateActivityTypeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeprecateActivityTypeAsync(Model::DeprecateActivityTypeRequest&& request, const DeprecateActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deprecates the specified domain. After a domain has been deprecated it cannot
          * be used to create new workflow executions or register new types. However, you
@@ -691,6 +754,18 @@ namespace Model
          */
         virtual void DeprecateDomainAsync(const Model::DeprecateDomainRequest& request, const DeprecateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeprecateDomainCallable(const Model::DeprecateDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeprecateDomainOutcomeCallable DeprecateDomainCallable(Model::DeprecateDomainRequest&& request) const;
+
+        /**
+         * Same as DeprecateDomainAsync(const Model::DeprecateDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeprecateDomainAsync(Model::DeprecateDomainRequest&& request, const DeprecateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deprecates the specified <i>workflow type</i>. After a workflow type has been
          * deprecated, you cannot create new executions of that type. Executions that were
@@ -770,6 +845,18 @@ namespace Model
          */
         virtual void DeprecateWorkflowTypeAsync(const Model::DeprecateWorkflowTypeRequest& request, const DeprecateWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeprecateWorkflowTypeCallable(const Model::DeprecateWorkflowTypeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeprecateWorkflowTypeOutcomeCallable DeprecateWorkflowTypeCallable(Model::DeprecateWorkflowTypeRequest&& request) const;
+
+        /**
+         * Same as DeprecateWorkflowTypeAsync(const Model::DeprecateWorkflowTypeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeprecateWorkflowTypeAsync(Model::DeprecateWorkflowTypeRequest&& request, const DeprecateWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the specified activity type. This includes
          * configuration settings provided when the type was registered and other general
@@ -837,6 +924,18 @@ namespace Model
          */
         virtual void DescribeActivityTypeAsync(const Model::DescribeActivityTypeRequest& request, const DescribeActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeActivityTypeCallable(const Model::DescribeActivityTypeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeActivityTypeOutcomeCallable DescribeActivityTypeCallable(Model::DescribeActivityTypeRequest&& request) const;
+
+        /**
+         * Same as DescribeActivityTypeAsync(const Model::DescribeActivityTypeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeActivityTypeAsync(Model::DescribeActivityTypeRequest&& request, const DescribeActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the specified domain, including description and
          * status.</p> <p><b>Access Control</b></p> <p>You can use IAM policies to control
@@ -892,6 +991,18 @@ namespace Model
          */
         virtual void DescribeDomainAsync(const Model::DescribeDomainRequest& request, const DescribeDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDomainCallable(const Model::DescribeDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeDomainOutcomeCallable DescribeDomainCallable(Model::DescribeDomainRequest&& request) const;
+
+        /**
+         * Same as DescribeDomainAsync(const Model::DescribeDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeDomainAsync(Model::DescribeDomainRequest&& request, const DescribeDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the specified workflow execution including its type
          * and some statistics.</p> <note>This operation is eventually consistent. The
@@ -953,6 +1064,18 @@ namespace Model
          */
         virtual void DescribeWorkflowExecutionAsync(const Model::DescribeWorkflowExecutionRequest& request, const DescribeWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeWorkflowExecutionCallable(const Model::DescribeWorkflowExecutionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeWorkflowExecutionOutcomeCallable DescribeWorkflowExecutionCallable(Model::DescribeWorkflowExecutionRequest&& request) const;
+
+        /**
+         * Same as DescribeWorkflowExecutionAsync(const Model::DescribeWorkflowExecutionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeWorkflowExecutionAsync(Model::DescribeWorkflowExecutionRequest&& request, const DescribeWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the specified <i>workflow type</i>. This includes
          * configuration settings specified when the type was registered and other
@@ -1023,6 +1146,18 @@ namespace Model
          */
         virtual void DescribeWorkflowTypeAsync(const Model::DescribeWorkflowTypeRequest& request, const DescribeWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeWorkflowTypeCallable(const Model::DescribeWorkflowTypeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeWorkflowTypeOutcomeCallable DescribeWorkflowTypeCallable(Model::DescribeWorkflowTypeRequest&& request) const;
+
+        /**
+         * Same as DescribeWorkflowTypeAsync(const Model::DescribeWorkflowTypeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeWorkflowTypeAsync(Model::DescribeWorkflowTypeRequest&& request, const DescribeWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the history of the specified workflow execution. The results may be
          * split into multiple pages. To retrieve subsequent pages, make the call again
@@ -1090,6 +1225,18 @@ namespace Model
          */
         virtual void GetWorkflowExecutionHistoryAsync(const Model::GetWorkflowExecutionHistoryRequest& request, const GetWorkflowExecutionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetWorkflowExecutionHistoryCallable(const Model::GetWorkflowExecutionHistoryRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetWorkflowExecutionHistoryOutcomeCallable GetWorkflowExecutionHistoryCallable(Model::GetWorkflowExecutionHistoryRequest&& request) const;
+
+        /**
+         * Same as GetWorkflowExecutionHistoryAsync(const Model::GetWorkflowExecutionHistoryRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetWorkflowExecutionHistoryAsync(Model::GetWorkflowExecutionHistoryRequest&& request, const GetWorkflowExecutionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about all activities registered in the specified domain
          * that match the specified name and registration status. The result includes
@@ -1157,6 +1304,18 @@ namespace Model
          */
         virtual void ListActivityTypesAsync(const Model::ListActivityTypesRequest& request, const ListActivityTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListActivityTypesCallable(const Model::ListActivityTypesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListActivityTypesOutcomeCallable ListActivityTypesCallable(Model::ListActivityTypesRequest&& request) const;
+
+        /**
+         * Same as ListActivityTypesAsync(const Model::ListActivityTypesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListActivityTypesAsync(Model::ListActivityTypesRequest&& request, const ListActivityTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of closed workflow executions in the specified domain that
          * meet the filtering criteria. The results may be split into multiple pages. To
@@ -1239,6 +1398,18 @@ namespace Model
          */
         virtual void ListClosedWorkflowExecutionsAsync(const Model::ListClosedWorkflowExecutionsRequest& request, const ListClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListClosedWorkflowExecutionsCallable(const Model::ListClosedWorkflowExecutionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListClosedWorkflowExecutionsOutcomeCallable ListClosedWorkflowExecutionsCallable(Model::ListClosedWorkflowExecutionsRequest&& request) const;
+
+        /**
+         * Same as ListClosedWorkflowExecutionsAsync(const Model::ListClosedWorkflowExecutionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListClosedWorkflowExecutionsAsync(Model::ListClosedWorkflowExecutionsRequest&& request, const ListClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the list of domains registered in the account. The results may be
          * split into multiple pages. To retrieve subsequent pages, make the call again
@@ -1309,6 +1480,18 @@ namespace Model
          */
         virtual void ListDomainsAsync(const Model::ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDomainsCallable(const Model::ListDomainsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListDomainsOutcomeCallable ListDomainsCallable(Model::ListDomainsRequest&& request) const;
+
+        /**
+         * Same as ListDomainsAsync(const Model::ListDomainsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListDomainsAsync(Model::ListDomainsRequest&& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of open workflow executions in the specified domain that meet
          * the filtering criteria. The results may be split into multiple pages. To
@@ -1391,6 +1574,18 @@ namespace Model
          */
         virtual void ListOpenWorkflowExecutionsAsync(const Model::ListOpenWorkflowExecutionsRequest& request, const ListOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListOpenWorkflowExecutionsCallable(const Model::ListOpenWorkflowExecutionsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListOpenWorkflowExecutionsOutcomeCallable ListOpenWorkflowExecutionsCallable(Model::ListOpenWorkflowExecutionsRequest&& request) const;
+
+        /**
+         * Same as ListOpenWorkflowExecutionsAsync(const Model::ListOpenWorkflowExecutionsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListOpenWorkflowExecutionsAsync(Model::ListOpenWorkflowExecutionsRequest&& request, const ListOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about workflow types in the specified domain. The results
          * may be split into multiple pages that can be retrieved by making the call
@@ -1449,6 +1644,18 @@ namespace Model
          */
         virtual void ListWorkflowTypesAsync(const Model::ListWorkflowTypesRequest& request, const ListWorkflowTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListWorkflowTypesCallable(const Model::ListWorkflowTypesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListWorkflowTypesOutcomeCallable ListWorkflowTypesCallable(Model::ListWorkflowTypesRequest&& request) const;
+
+        /**
+         * Same as ListWorkflowTypesAsync(const Model::ListWorkflowTypesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListWorkflowTypesAsync(Model::ListWorkflowTypesRequest&& request, const ListWorkflowTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by workers to get an <a>ActivityTask</a> from the specified activity
          * <code>taskList</code>. This initiates a long poll, where the service holds the
@@ -1537,6 +1744,18 @@ namespace Model
          */
         virtual void PollForActivityTaskAsync(const Model::PollForActivityTaskRequest& request, const PollForActivityTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PollForActivityTaskCallable(const Model::PollForActivityTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PollForActivityTaskOutcomeCallable PollForActivityTaskCallable(Model::PollForActivityTaskRequest&& request) const;
+
+        /**
+         * Same as PollForActivityTaskAsync(const Model::PollForActivityTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PollForActivityTaskAsync(Model::PollForActivityTaskRequest&& request, const PollForActivityTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by deciders to get a <a>DecisionTask</a> from the specified decision
          * <code>taskList</code>. A decision task may be returned for any open workflow
@@ -1649,6 +1868,18 @@ namespace Model
          */
         virtual void PollForDecisionTaskAsync(const Model::PollForDecisionTaskRequest& request, const PollForDecisionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PollForDecisionTaskCallable(const Model::PollForDecisionTaskRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::PollForDecisionTaskOutcomeCallable PollForDecisionTaskCallable(Model::PollForDecisionTaskRequest&& request) const;
+
+        /**
+         * Same as PollForDecisionTaskAsync(const Model::PollForDecisionTaskRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void PollForDecisionTaskAsync(Model::PollForDecisionTaskRequest&& request, const PollForDecisionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by activity workers to report to the service that the
          * <a>ActivityTask</a> represented by the specified <code>taskToken</code> is still
@@ -1776,6 +2007,18 @@ namespace Model
          */
         virtual void RecordActivityTaskHeartbeatAsync(const Model::RecordActivityTaskHeartbeatRequest& request, const RecordActivityTaskHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RecordActivityTaskHeartbeatCallable(const Model::RecordActivityTaskHeartbeatRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RecordActivityTaskHeartbeatOutcomeCallable RecordActivityTaskHeartbeatCallable(Model::RecordActivityTaskHeartbeatRequest&& request) const;
+
+        /**
+         * Same as RecordActivityTaskHeartbeatAsync(const Model::RecordActivityTaskHeartbeatRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RecordActivityTaskHeartbeatAsync(Model::RecordActivityTaskHeartbeatRequest&& request, const RecordActivityTaskHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers a new <i>activity type</i> along with its configuration settings in
          * the specified domain.</p> <important>A <code>TypeAlreadyExists</code> fault is
@@ -1855,6 +2098,18 @@ namespace Model
          */
         virtual void RegisterActivityTypeAsync(const Model::RegisterActivityTypeRequest& request, const RegisterActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterActivityTypeCallable(const Model::RegisterActivityTypeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterActivityTypeOutcomeCallable RegisterActivityTypeCallable(Model::RegisterActivityTypeRequest&& request) const;
+
+        /**
+         * Same as RegisterActivityTypeAsync(const Model::RegisterActivityTypeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterActivityTypeAsync(Model::RegisterActivityTypeRequest&& request, const RegisterActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers a new domain.</p> <p><b>Access Control</b></p> <p>You can use IAM
          * policies to control this action's access to Amazon SWF resources as follows:</p>
@@ -1910,6 +2165,18 @@ namespace Model
          */
         virtual void RegisterDomainAsync(const Model::RegisterDomainRequest& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterDomainCallable(const Model::RegisterDomainRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterDomainOutcomeCallable RegisterDomainCallable(Model::RegisterDomainRequest&& request) const;
+
+        /**
+         * Same as RegisterDomainAsync(const Model::RegisterDomainRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterDomainAsync(Model::RegisterDomainRequest&& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers a new <i>workflow type</i> and its configuration settings in the
          * specified domain.</p> <p>The retention period for the workflow history is set by
@@ -1992,6 +2259,18 @@ namespace Model
          */
         virtual void RegisterWorkflowTypeAsync(const Model::RegisterWorkflowTypeRequest& request, const RegisterWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterWorkflowTypeCallable(const Model::RegisterWorkflowTypeRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RegisterWorkflowTypeOutcomeCallable RegisterWorkflowTypeCallable(Model::RegisterWorkflowTypeRequest&& request) const;
+
+        /**
+         * Same as RegisterWorkflowTypeAsync(const Model::RegisterWorkflowTypeRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RegisterWorkflowTypeAsync(Model::RegisterWorkflowTypeRequest&& request, const RegisterWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Records a <code>WorkflowExecutionCancelRequested</code> event in the
          * currently running workflow execution identified by the given domain, workflowId,
@@ -2074,6 +2353,18 @@ namespace Model
          */
         virtual void RequestCancelWorkflowExecutionAsync(const Model::RequestCancelWorkflowExecutionRequest& request, const RequestCancelWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RequestCancelWorkflowExecutionCallable(const Model::RequestCancelWorkflowExecutionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RequestCancelWorkflowExecutionOutcomeCallable RequestCancelWorkflowExecutionCallable(Model::RequestCancelWorkflowExecutionRequest&& request) const;
+
+        /**
+         * Same as RequestCancelWorkflowExecutionAsync(const Model::RequestCancelWorkflowExecutionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RequestCancelWorkflowExecutionAsync(Model::RequestCancelWorkflowExecutionRequest&& request, const RequestCancelWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by workers to tell the service that the <a>ActivityTask</a> identified
          * by the <code>taskToken</code> was successfully canceled. Additional
@@ -2168,6 +2459,18 @@ namespace Model
          */
         virtual void RespondActivityTaskCanceledAsync(const Model::RespondActivityTaskCanceledRequest& request, const RespondActivityTaskCanceledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RespondActivityTaskCanceledCallable(const Model::RespondActivityTaskCanceledRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RespondActivityTaskCanceledOutcomeCallable RespondActivityTaskCanceledCallable(Model::RespondActivityTaskCanceledRequest&& request) const;
+
+        /**
+         * Same as RespondActivityTaskCanceledAsync(const Model::RespondActivityTaskCanceledRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RespondActivityTaskCanceledAsync(Model::RespondActivityTaskCanceledRequest&& request, const RespondActivityTaskCanceledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by workers to tell the service that the <a>ActivityTask</a> identified
          * by the <code>taskToken</code> completed successfully with a <code>result</code>
@@ -2265,6 +2568,18 @@ namespace Model
          */
         virtual void RespondActivityTaskCompletedAsync(const Model::RespondActivityTaskCompletedRequest& request, const RespondActivityTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RespondActivityTaskCompletedCallable(const Model::RespondActivityTaskCompletedRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RespondActivityTaskCompletedOutcomeCallable RespondActivityTaskCompletedCallable(Model::RespondActivityTaskCompletedRequest&& request) const;
+
+        /**
+         * Same as RespondActivityTaskCompletedAsync(const Model::RespondActivityTaskCompletedRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RespondActivityTaskCompletedAsync(Model::RespondActivityTaskCompletedRequest&& request, const RespondActivityTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by workers to tell the service that the <a>ActivityTask</a> identified
          * by the <code>taskToken</code> has failed with <code>reason</code> (if
@@ -2347,6 +2662,18 @@ namespace Model
          */
         virtual void RespondActivityTaskFailedAsync(const Model::RespondActivityTaskFailedRequest& request, const RespondActivityTaskFailedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RespondActivityTaskFailedCallable(const Model::RespondActivityTaskFailedRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RespondActivityTaskFailedOutcomeCallable RespondActivityTaskFailedCallable(Model::RespondActivityTaskFailedRequest&& request) const;
+
+        /**
+         * Same as RespondActivityTaskFailedAsync(const Model::RespondActivityTaskFailedRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RespondActivityTaskFailedAsync(Model::RespondActivityTaskFailedRequest&& request, const RespondActivityTaskFailedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by deciders to tell the service that the <a>DecisionTask</a> identified
          * by the <code>taskToken</code> has successfully completed. The
@@ -2408,6 +2735,18 @@ namespace Model
          */
         virtual void RespondDecisionTaskCompletedAsync(const Model::RespondDecisionTaskCompletedRequest& request, const RespondDecisionTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RespondDecisionTaskCompletedCallable(const Model::RespondDecisionTaskCompletedRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RespondDecisionTaskCompletedOutcomeCallable RespondDecisionTaskCompletedCallable(Model::RespondDecisionTaskCompletedRequest&& request) const;
+
+        /**
+         * Same as RespondDecisionTaskCompletedAsync(const Model::RespondDecisionTaskCompletedRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RespondDecisionTaskCompletedAsync(Model::RespondDecisionTaskCompletedRequest&& request, const RespondDecisionTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Records a <code>WorkflowExecutionSignaled</code> event in the workflow
          * execution history and creates a decision task for the workflow execution
@@ -2484,6 +2823,18 @@ namespace Model
          */
         virtual void SignalWorkflowExecutionAsync(const Model::SignalWorkflowExecutionRequest& request, const SignalWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SignalWorkflowExecutionCallable(const Model::SignalWorkflowExecutionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::SignalWorkflowExecutionOutcomeCallable SignalWorkflowExecutionCallable(Model::SignalWorkflowExecutionRequest&& request) const;
+
+        /**
+         * Same as SignalWorkflowExecutionAsync(const Model::SignalWorkflowExecutionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void SignalWorkflowExecutionAsync(Model::SignalWorkflowExecutionRequest&& request, const SignalWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts an execution of the workflow type in the specified domain using the
          * provided <code>workflowId</code> and input data.</p> <p>This action returns the
@@ -2581,6 +2932,18 @@ namespace Model
          */
         virtual void StartWorkflowExecutionAsync(const Model::StartWorkflowExecutionRequest& request, const StartWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartWorkflowExecutionCallable(const Model::StartWorkflowExecutionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StartWorkflowExecutionOutcomeCallable StartWorkflowExecutionCallable(Model::StartWorkflowExecutionRequest&& request) const;
+
+        /**
+         * Same as StartWorkflowExecutionAsync(const Model::StartWorkflowExecutionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StartWorkflowExecutionAsync(Model::StartWorkflowExecutionRequest&& request, const StartWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Records a <code>WorkflowExecutionTerminated</code> event and forces closure
          * of the workflow execution identified by the given domain, runId, and workflowId.
@@ -2666,6 +3029,210 @@ namespace Model
          */
         virtual void TerminateWorkflowExecutionAsync(const Model::TerminateWorkflowExecutionRequest& request, const TerminateWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TerminateWorkflowExecutionCallable(const Model::TerminateWorkflowExecutionRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TerminateWorkflowExecutionOutcomeCallable TerminateWorkflowExecutionCallable(Model::TerminateWorkflowExecutionRequest&& request) const;
+
+        /**
+         * Same as TerminateWorkflowExecutionAsync(const Model::TerminateWorkflowExecutionRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TerminateWorkflowExecutionAsync(Model::TerminateWorkflowExecutionRequest&& request, const TerminateWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through GetWorkflowExecutionHistory(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SWFClient, Model::GetWorkflowExecutionHistoryRequest, Model::GetWorkflowExecutionHistoryOutcome> GetWorkflowExecutionHistoryPaginator(const Model::GetWorkflowExecutionHistoryRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListActivityTypes(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SWFClient, Model::ListActivityTypesRequest, Model::ListActivityTypesOutcome> ListActivityTypesPaginator(const Model::ListActivityTypesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListClosedWorkflowExecutions(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SWFClient, Model::ListClosedWorkflowExecutionsRequest, Model::ListClosedWorkflowExecutionsOutcome> ListClosedWorkflowExecutionsPaginator(const Model::ListClosedWorkflowExecutionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListDomains(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SWFClient, Model::ListDomainsRequest, Model::ListDomainsOutcome> ListDomainsPaginator(const Model::ListDomainsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListOpenWorkflowExecutions(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SWFClient, Model::ListOpenWorkflowExecutionsRequest, Model::ListOpenWorkflowExecutionsOutcome> ListOpenWorkflowExecutionsPaginator(const Model::ListOpenWorkflowExecutionsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListWorkflowTypes(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SWFClient, Model::ListWorkflowTypesRequest, Model::ListWorkflowTypesOutcome> ListWorkflowTypesPaginator(const Model::ListWorkflowTypesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through PollForDecisionTask(), following NextPageToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<SWFClient, Model::PollForDecisionTaskRequest, Model::PollForDecisionTaskOutcome> PollForDecisionTaskPaginator(const Model::PollForDecisionTaskRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CountClosedWorkflowExecutions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::CountClosedWorkflowExecutionsRequest, Model::CountClosedWorkflowExecutionsOutcome> CountClosedWorkflowExecutionsAwaitable(Model::CountClosedWorkflowExecutionsRequest request) const;
+
+        /**
+         * co_await-able form of CountOpenWorkflowExecutions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::CountOpenWorkflowExecutionsRequest, Model::CountOpenWorkflowExecutionsOutcome> CountOpenWorkflowExecutionsAwaitable(Model::CountOpenWorkflowExecutionsRequest request) const;
+
+        /**
+         * co_await-able form of CountPendingActivityTasks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::CountPendingActivityTasksRequest, Model::CountPendingActivityTasksOutcome> CountPendingActivityTasksAwaitable(Model::CountPendingActivityTasksRequest request) const;
+
+        /**
+         * co_await-able form of CountPendingDecisionTasks(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::CountPendingDecisionTasksRequest, Model::CountPendingDecisionTasksOutcome> CountPendingDecisionTasksAwaitable(Model::CountPendingDecisionTasksRequest request) const;
+
+        /**
+         * co_await-able form of DeprecateActivityType(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::DeprecateActivityTypeRequest, Model::DeprecateActivityTypeOutcome> DeprecateActivityTypeAwaitable(Model::DeprecateActivityTypeRequest request) const;
+
+        /**
+         * co_await-able form of DeprecateDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::DeprecateDomainRequest, Model::DeprecateDomainOutcome> DeprecateDomainAwaitable(Model::DeprecateDomainRequest request) const;
+
+        /**
+         * co_await-able form of DeprecateWorkflowType(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::DeprecateWorkflowTypeRequest, Model::DeprecateWorkflowTypeOutcome> DeprecateWorkflowTypeAwaitable(Model::DeprecateWorkflowTypeRequest request) const;
+
+        /**
+         * co_await-able form of DescribeActivityType(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::DescribeActivityTypeRequest, Model::DescribeActivityTypeOutcome> DescribeActivityTypeAwaitable(Model::DescribeActivityTypeRequest request) const;
+
+        /**
+         * co_await-able form of DescribeDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::DescribeDomainRequest, Model::DescribeDomainOutcome> DescribeDomainAwaitable(Model::DescribeDomainRequest request) const;
+
+        /**
+         * co_await-able form of DescribeWorkflowExecution(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::DescribeWorkflowExecutionRequest, Model::DescribeWorkflowExecutionOutcome> DescribeWorkflowExecutionAwaitable(Model::DescribeWorkflowExecutionRequest request) const;
+
+        /**
+         * co_await-able form of DescribeWorkflowType(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::DescribeWorkflowTypeRequest, Model::DescribeWorkflowTypeOutcome> DescribeWorkflowTypeAwaitable(Model::DescribeWorkflowTypeRequest request) const;
+
+        /**
+         * co_await-able form of GetWorkflowExecutionHistory(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::GetWorkflowExecutionHistoryRequest, Model::GetWorkflowExecutionHistoryOutcome> GetWorkflowExecutionHistoryAwaitable(Model::GetWorkflowExecutionHistoryRequest request) const;
+
+        /**
+         * co_await-able form of ListActivityTypes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::ListActivityTypesRequest, Model::ListActivityTypesOutcome> ListActivityTypesAwaitable(Model::ListActivityTypesRequest request) const;
+
+        /**
+         * co_await-able form of ListClosedWorkflowExecutions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::ListClosedWorkflowExecutionsRequest, Model::ListClosedWorkflowExecutionsOutcome> ListClosedWorkflowExecutionsAwaitable(Model::ListClosedWorkflowExecutionsRequest request) const;
+
+        /**
+         * co_await-able form of ListDomains(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::ListDomainsRequest, Model::ListDomainsOutcome> ListDomainsAwaitable(Model::ListDomainsRequest request) const;
+
+        /**
+         * co_await-able form of ListOpenWorkflowExecutions(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::ListOpenWorkflowExecutionsRequest, Model::ListOpenWorkflowExecutionsOutcome> ListOpenWorkflowExecutionsAwaitable(Model::ListOpenWorkflowExecutionsRequest request) const;
+
+        /**
+         * co_await-able form of ListWorkflowTypes(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::ListWorkflowTypesRequest, Model::ListWorkflowTypesOutcome> ListWorkflowTypesAwaitable(Model::ListWorkflowTypesRequest request) const;
+
+        /**
+         * co_await-able form of PollForActivityTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::PollForActivityTaskRequest, Model::PollForActivityTaskOutcome> PollForActivityTaskAwaitable(Model::PollForActivityTaskRequest request) const;
+
+        /**
+         * co_await-able form of PollForDecisionTask(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::PollForDecisionTaskRequest, Model::PollForDecisionTaskOutcome> PollForDecisionTaskAwaitable(Model::PollForDecisionTaskRequest request) const;
+
+        /**
+         * co_await-able form of RecordActivityTaskHeartbeat(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::RecordActivityTaskHeartbeatRequest, Model::RecordActivityTaskHeartbeatOutcome> RecordActivityTaskHeartbeatAwaitable(Model::RecordActivityTaskHeartbeatRequest request) const;
+
+        /**
+         * co_await-able form of RegisterActivityType(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::RegisterActivityTypeRequest, Model::RegisterActivityTypeOutcome> RegisterActivityTypeAwaitable(Model::RegisterActivityTypeRequest request) const;
+
+        /**
+         * co_await-able form of RegisterDomain(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::RegisterDomainRequest, Model::RegisterDomainOutcome> RegisterDomainAwaitable(Model::RegisterDomainRequest request) const;
+
+        /**
+         * co_await-able form of RegisterWorkflowType(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::RegisterWorkflowTypeRequest, Model::RegisterWorkflowTypeOutcome> RegisterWorkflowTypeAwaitable(Model::RegisterWorkflowTypeRequest request) const;
+
+        /**
+         * co_await-able form of RequestCancelWorkflowExecution(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::RequestCancelWorkflowExecutionRequest, Model::RequestCancelWorkflowExecutionOutcome> RequestCancelWorkflowExecutionAwaitable(Model::RequestCancelWorkflowExecutionRequest request) const;
+
+        /**
+         * co_await-able form of RespondActivityTaskCanceled(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::RespondActivityTaskCanceledRequest, Model::RespondActivityTaskCanceledOutcome> RespondActivityTaskCanceledAwaitable(Model::RespondActivityTaskCanceledRequest request) const;
+
+        /**
+         * co_await-able form of RespondActivityTaskCompleted(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::RespondActivityTaskCompletedRequest, Model::RespondActivityTaskCompletedOutcome> RespondActivityTaskCompletedAwaitable(Model::RespondActivityTaskCompletedRequest request) const;
+
+        /**
+         * co_await-able form of RespondActivityTaskFailed(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::RespondActivityTaskFailedRequest, Model::RespondActivityTaskFailedOutcome> RespondActivityTaskFailedAwaitable(Model::RespondActivityTaskFailedRequest request) const;
+
+        /**
+         * co_await-able form of RespondDecisionTaskCompleted(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::RespondDecisionTaskCompletedRequest, Model::RespondDecisionTaskCompletedOutcome> RespondDecisionTaskCompletedAwaitable(Model::RespondDecisionTaskCompletedRequest request) const;
+
+        /**
+         * co_await-able form of SignalWorkflowExecution(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::SignalWorkflowExecutionRequest, Model::SignalWorkflowExecutionOutcome> SignalWorkflowExecutionAwaitable(Model::SignalWorkflowExecutionRequest request) const;
+
+        /**
+         * co_await-able form of StartWorkflowExecution(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::StartWorkflowExecutionRequest, Model::StartWorkflowExecutionOutcome> StartWorkflowExecutionAwaitable(Model::StartWorkflowExecutionRequest request) const;
+
+        /**
+         * co_await-able form of TerminateWorkflowExecution(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<SWFClient, Model::TerminateWorkflowExecutionRequest, Model::TerminateWorkflowExecutionOutcome> TerminateWorkflowExecutionAwaitable(Model::TerminateWorkflowExecutionRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     CountClosedWorkflowExecutionsRequest();
+    inline const char* GetServiceRequestName() const override { return "CountClosedWorkflowExecutions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     CountOpenWorkflowExecutionsRequest();
+    inline const char* GetServiceRequestName() const override { return "CountOpenWorkflowExecutions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
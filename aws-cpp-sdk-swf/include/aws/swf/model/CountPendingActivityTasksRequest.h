@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CountPendingActivityTasksRequest();
+    inline const char* GetServiceRequestName() const override { return "CountPendingActivityTasks"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
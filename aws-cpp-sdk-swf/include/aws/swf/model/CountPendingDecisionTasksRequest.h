@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CountPendingDecisionTasksRequest();
+    inline const char* GetServiceRequestName() const override { return "CountPendingDecisionTasks"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
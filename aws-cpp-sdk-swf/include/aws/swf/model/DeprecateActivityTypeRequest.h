@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeprecateActivityTypeRequest();
+    inline const char* GetServiceRequestName() const override { return "DeprecateActivityType"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeprecateDomainRequest();
+    inline const char* GetServiceRequestName() const override { return "DeprecateDomain"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
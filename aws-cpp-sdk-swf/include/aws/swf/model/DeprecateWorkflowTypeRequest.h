@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeprecateWorkflowTypeRequest();
+    inline const char* GetServiceRequestName() const override { return "DeprecateWorkflowType"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
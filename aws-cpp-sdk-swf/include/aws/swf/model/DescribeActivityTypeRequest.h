@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeActivityTypeRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeActivityType"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
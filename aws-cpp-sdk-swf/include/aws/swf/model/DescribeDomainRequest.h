@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DescribeDomainRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeDomain"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
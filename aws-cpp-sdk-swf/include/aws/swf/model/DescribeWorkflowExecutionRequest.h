@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeWorkflowExecutionRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeWorkflowExecution"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
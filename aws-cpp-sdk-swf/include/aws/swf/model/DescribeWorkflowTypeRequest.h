@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeWorkflowTypeRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeWorkflowType"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
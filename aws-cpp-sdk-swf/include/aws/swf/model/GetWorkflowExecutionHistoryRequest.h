@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetWorkflowExecutionHistoryRequest();
+    inline const char* GetServiceRequestName() const override { return "GetWorkflowExecutionHistory"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
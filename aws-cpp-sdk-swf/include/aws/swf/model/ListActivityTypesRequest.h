@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListActivityTypesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListActivityTypes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
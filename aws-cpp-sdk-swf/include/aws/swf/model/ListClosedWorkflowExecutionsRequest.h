@@ -35,6 +35,8 @@ namespace Model
   {
   public:
     ListClosedWorkflowExecutionsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListClosedWorkflowExecutions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
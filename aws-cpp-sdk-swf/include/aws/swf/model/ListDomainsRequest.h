@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListDomainsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListDomains"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
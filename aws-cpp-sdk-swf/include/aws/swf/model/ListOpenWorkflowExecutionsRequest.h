@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     ListOpenWorkflowExecutionsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListOpenWorkflowExecutions"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
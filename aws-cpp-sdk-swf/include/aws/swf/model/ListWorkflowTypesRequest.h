@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ListWorkflowTypesRequest();
+    inline const char* GetServiceRequestName() const override { return "ListWorkflowTypes"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PollForActivityTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "PollForActivityTask"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
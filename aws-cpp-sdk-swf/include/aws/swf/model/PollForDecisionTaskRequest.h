@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     PollForDecisionTaskRequest();
+    inline const char* GetServiceRequestName() const override { return "PollForDecisionTask"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RecordActivityTaskHeartbeatRequest();
+    inline const char* GetServiceRequestName() const override { return "RecordActivityTaskHeartbeat"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
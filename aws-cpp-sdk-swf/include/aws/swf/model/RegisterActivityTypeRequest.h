@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     RegisterActivityTypeRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterActivityType"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
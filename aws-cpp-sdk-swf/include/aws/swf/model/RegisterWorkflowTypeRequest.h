@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RegisterWorkflowTypeRequest();
+    inline const char* GetServiceRequestName() const override { return "RegisterWorkflowType"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
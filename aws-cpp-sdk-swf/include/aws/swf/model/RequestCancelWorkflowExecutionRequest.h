@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RequestCancelWorkflowExecutionRequest();
+    inline const char* GetServiceRequestName() const override { return "RequestCancelWorkflowExecution"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
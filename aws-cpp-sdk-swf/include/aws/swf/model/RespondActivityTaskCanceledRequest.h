@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RespondActivityTaskCanceledRequest();
+    inline const char* GetServiceRequestName() const override { return "RespondActivityTaskCanceled"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
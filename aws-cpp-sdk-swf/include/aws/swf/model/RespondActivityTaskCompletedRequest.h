@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RespondActivityTaskCompletedRequest();
+    inline const char* GetServiceRequestName() const override { return "RespondActivityTaskCompleted"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
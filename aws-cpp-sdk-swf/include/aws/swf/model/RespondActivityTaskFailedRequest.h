@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     RespondActivityTaskFailedRequest();
+    inline const char* GetServiceRequestName() const override { return "RespondActivityTaskFailed"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RespondDecisionTaskCompletedRequest();
+    inline const char* GetServiceRequestName() const override { return "RespondDecisionTaskCompleted"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     SignalWorkflowExecutionRequest();
+    inline const char* GetServiceRequestName() const override { return "SignalWorkflowExecution"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
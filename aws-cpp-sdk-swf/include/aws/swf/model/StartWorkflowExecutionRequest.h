@@ -34,6 +34,8 @@ namespace Model
   {
   public:
     StartWorkflowExecutionRequest();
+    inline const char* GetServiceRequestName() const override { return "StartWorkflowExecution"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     TerminateWorkflowExecutionRequest();
+    inline const char* GetServiceRequestName() const override { return "TerminateWorkflowExecution"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
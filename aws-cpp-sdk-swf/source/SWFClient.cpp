@@ -140,7 +140,7 @@ CountClosedWorkflowExecutionsOutcome SWFClient::CountClosedWorkflowExecutions(co
 
 CountClosedWorkflowExecutionsOutcomeCallable SWFClient::CountClosedWorkflowExecutionsCallable(const CountClosedWorkflowExecutionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CountClosedWorkflowExecutions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CountClosedWorkflowExecutions(request); } );
 }
 
 void SWFClient::CountClosedWorkflowExecutionsAsync(const CountClosedWorkflowExecutionsRequest& request, const CountClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -148,6 +148,16 @@ void SWFClient::CountClosedWorkflowExecutionsAsync(const CountClosedWorkflowExec
   m_executor->Submit( [this, request, handler, context](){ this->CountClosedWorkflowExecutionsAsyncHelper( request, handler, context ); } );
 }
 
+CountClosedWorkflowExecutionsOutcomeCallable SWFClient::CountClosedWorkflowExecutionsCallable(CountClosedWorkflowExecutionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::CountClosedWorkflowExecutions, this, std::move(request)));
+}
+
+void SWFClient::CountClosedWorkflowExecutionsAsync(CountClosedWorkflowExecutionsRequest&& request, const CountClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::CountClosedWorkflowExecutionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::CountClosedWorkflowExecutionsAsyncHelper(const CountClosedWorkflowExecutionsRequest& request, const CountClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CountClosedWorkflowExecutions(request), context);
@@ -171,7 +181,7 @@ CountOpenWorkflowExecutionsOutcome SWFClient::CountOpenWorkflowExecutions(const
 
 CountOpenWorkflowExecutionsOutcomeCallable SWFClient::CountOpenWorkflowExecutionsCallable(const CountOpenWorkflowExecutionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CountOpenWorkflowExecutions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CountOpenWorkflowExecutions(request); } );
 }
 
 void SWFClient::CountOpenWorkflowExecutionsAsync(const CountOpenWorkflowExecutionsRequest& request, const CountOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -179,6 +189,16 @@ void SWFClient::CountOpenWorkflowExecutionsAsync(const CountOpenWorkflowExecutio
   m_executor->Submit( [this, request, handler, context](){ this->CountOpenWorkflowExecutionsAsyncHelper( request, handler, context ); } );
 }
 
+CountOpenWorkflowExecutionsOutcomeCallable SWFClient::CountOpenWorkflowExecutionsCallable(CountOpenWorkflowExecutionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::CountOpenWorkflowExecutions, this, std::move(request)));
+}
+
+void SWFClient::CountOpenWorkflowExecutionsAsync(CountOpenWorkflowExecutionsRequest&& request, const CountOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::CountOpenWorkflowExecutionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::CountOpenWorkflowExecutionsAsyncHelper(const CountOpenWorkflowExecutionsRequest& request, const CountOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CountOpenWorkflowExecutions(request), context);
@@ -202,7 +222,7 @@ CountPendingActivityTasksOutcome SWFClient::CountPendingActivityTasks(const Coun
 
 CountPendingActivityTasksOutcomeCallable SWFClient::CountPendingActivityTasksCallable(const CountPendingActivityTasksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CountPendingActivityTasks(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CountPendingActivityTasks(request); } );
 }
 
 void SWFClient::CountPendingActivityTasksAsync(const CountPendingActivityTasksRequest& request, const CountPendingActivityTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -210,6 +230,16 @@ void SWFClient::CountPendingActivityTasksAsync(const CountPendingActivityTasksRe
   m_executor->Submit( [this, request, handler, context](){ this->CountPendingActivityTasksAsyncHelper( request, handler, context ); } );
 }
 
+CountPendingActivityTasksOutcomeCallable SWFClient::CountPendingActivityTasksCallable(CountPendingActivityTasksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::CountPendingActivityTasks, this, std::move(request)));
+}
+
+void SWFClient::CountPendingActivityTasksAsync(CountPendingActivityTasksRequest&& request, const CountPendingActivityTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::CountPendingActivityTasksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::CountPendingActivityTasksAsyncHelper(const CountPendingActivityTasksRequest& request, const CountPendingActivityTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CountPendingActivityTasks(request), context);
@@ -233,7 +263,7 @@ CountPendingDecisionTasksOutcome SWFClient::CountPendingDecisionTasks(const Coun
 
 CountPendingDecisionTasksOutcomeCallable SWFClient::CountPendingDecisionTasksCallable(const CountPendingDecisionTasksRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CountPendingDecisionTasks(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CountPendingDecisionTasks(request); } );
 }
 
 void SWFClient::CountPendingDecisionTasksAsync(const CountPendingDecisionTasksRequest& request, const CountPendingDecisionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -241,6 +271,16 @@ void SWFClient::CountPendingDecisionTasksAsync(const CountPendingDecisionTasksRe
   m_executor->Submit( [this, request, handler, context](){ this->CountPendingDecisionTasksAsyncHelper( request, handler, context ); } );
 }
 
+CountPendingDecisionTasksOutcomeCallable SWFClient::CountPendingDecisionTasksCallable(CountPendingDecisionTasksRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::CountPendingDecisionTasks, this, std::move(request)));
+}
+
+void SWFClient::CountPendingDecisionTasksAsync(CountPendingDecisionTasksRequest&& request, const CountPendingDecisionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::CountPendingDecisionTasksAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::CountPendingDecisionTasksAsyncHelper(const CountPendingDecisionTasksRequest& request, const CountPendingDecisionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CountPendingDecisionTasks(request), context);
@@ -264,7 +304,7 @@ DeprecateActivityTypeOutcome SWFClient::DeprecateActivityType(const DeprecateAct
 
 DeprecateActivityTypeOutcomeCallable SWFClient::DeprecateActivityTypeCallable(const DeprecateActivityTypeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeprecateActivityType(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeprecateActivityType(request); } );
 }
 
 void SWFClient::DeprecateActivityTypeAsync(const DeprecateActivityTypeRequest& request, const DeprecateActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -272,6 +312,16 @@ void SWFClient::DeprecateActivityTypeAsync(const DeprecateActivityTypeRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DeprecateActivityTypeAsyncHelper( request, handler, context ); } );
 }
 
+DeprecateActivityTypeOutcomeCallable SWFClient::DeprecateActivityTypeCallable(DeprecateActivityTypeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::DeprecateActivityType, this, std::move(request)));
+}
+
+void SWFClient::DeprecateActivityTypeAsync(DeprecateActivityTypeRequest&& request, const DeprecateActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::DeprecateActivityTypeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::DeprecateActivityTypeAsyncHelper(const DeprecateActivityTypeRequest& request, const DeprecateActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeprecateActivityType(request), context);
@@ -295,7 +345,7 @@ DeprecateDomainOutcome SWFClient::DeprecateDomain(const DeprecateDomainRequest&
 
 DeprecateDomainOutcomeCallable SWFClient::DeprecateDomainCallable(const DeprecateDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeprecateDomain(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeprecateDomain(request); } );
 }
 
 void SWFClient::DeprecateDomainAsync(const DeprecateDomainRequest& request, const DeprecateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -303,6 +353,16 @@ void SWFClient::DeprecateDomainAsync(const DeprecateDomainRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->DeprecateDomainAsyncHelper( request, handler, context ); } );
 }
 
+DeprecateDomainOutcomeCallable SWFClient::DeprecateDomainCallable(DeprecateDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::DeprecateDomain, this, std::move(request)));
+}
+
+void SWFClient::DeprecateDomainAsync(DeprecateDomainRequest&& request, const DeprecateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::DeprecateDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::DeprecateDomainAsyncHelper(const DeprecateDomainRequest& request, const DeprecateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeprecateDomain(request), context);
@@ -326,7 +386,7 @@ DeprecateWorkflowTypeOutcome SWFClient::DeprecateWorkflowType(const DeprecateWor
 
 DeprecateWorkflowTypeOutcomeCallable SWFClient::DeprecateWorkflowTypeCallable(const DeprecateWorkflowTypeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeprecateWorkflowType(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeprecateWorkflowType(request); } );
 }
 
 void SWFClient::DeprecateWorkflowTypeAsync(const DeprecateWorkflowTypeRequest& request, const DeprecateWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -334,6 +394,16 @@ void SWFClient::DeprecateWorkflowTypeAsync(const DeprecateWorkflowTypeRequest& r
   m_executor->Submit( [this, request, handler, context](){ this->DeprecateWorkflowTypeAsyncHelper( request, handler, context ); } );
 }
 
+DeprecateWorkflowTypeOutcomeCallable SWFClient::DeprecateWorkflowTypeCallable(DeprecateWorkflowTypeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::DeprecateWorkflowType, this, std::move(request)));
+}
+
+void SWFClient::DeprecateWorkflowTypeAsync(DeprecateWorkflowTypeRequest&& request, const DeprecateWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::DeprecateWorkflowTypeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::DeprecateWorkflowTypeAsyncHelper(const DeprecateWorkflowTypeRequest& request, const DeprecateWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeprecateWorkflowType(request), context);
@@ -357,7 +427,7 @@ DescribeActivityTypeOutcome SWFClient::DescribeActivityType(const DescribeActivi
 
 DescribeActivityTypeOutcomeCallable SWFClient::DescribeActivityTypeCallable(const DescribeActivityTypeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeActivityType(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeActivityType(request); } );
 }
 
 void SWFClient::DescribeActivityTypeAsync(const DescribeActivityTypeRequest& request, const DescribeActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -365,6 +435,16 @@ void SWFClient::DescribeActivityTypeAsync(const DescribeActivityTypeRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DescribeActivityTypeAsyncHelper( request, handler, context ); } );
 }
 
+DescribeActivityTypeOutcomeCallable SWFClient::DescribeActivityTypeCallable(DescribeActivityTypeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::DescribeActivityType, this, std::move(request)));
+}
+
+void SWFClient::DescribeActivityTypeAsync(DescribeActivityTypeRequest&& request, const DescribeActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::DescribeActivityTypeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::DescribeActivityTypeAsyncHelper(const DescribeActivityTypeRequest& request, const DescribeActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeActivityType(request), context);
@@ -388,7 +468,7 @@ DescribeDomainOutcome SWFClient::DescribeDomain(const DescribeDomainRequest& req
 
 DescribeDomainOutcomeCallable SWFClient::DescribeDomainCallable(const DescribeDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeDomain(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeDomain(request); } );
 }
 
 void SWFClient::DescribeDomainAsync(const DescribeDomainRequest& request, const DescribeDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -396,6 +476,16 @@ void SWFClient::DescribeDomainAsync(const DescribeDomainRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->DescribeDomainAsyncHelper( request, handler, context ); } );
 }
 
+DescribeDomainOutcomeCallable SWFClient::DescribeDomainCallable(DescribeDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::DescribeDomain, this, std::move(request)));
+}
+
+void SWFClient::DescribeDomainAsync(DescribeDomainRequest&& request, const DescribeDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::DescribeDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::DescribeDomainAsyncHelper(const DescribeDomainRequest& request, const DescribeDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeDomain(request), context);
@@ -419,7 +509,7 @@ DescribeWorkflowExecutionOutcome SWFClient::DescribeWorkflowExecution(const Desc
 
 DescribeWorkflowExecutionOutcomeCallable SWFClient::DescribeWorkflowExecutionCallable(const DescribeWorkflowExecutionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeWorkflowExecution(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeWorkflowExecution(request); } );
 }
 
 void SWFClient::DescribeWorkflowExecutionAsync(const DescribeWorkflowExecutionRequest& request, const DescribeWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -427,6 +517,16 @@ void SWFClient::DescribeWorkflowExecutionAsync(const DescribeWorkflowExecutionRe
   m_executor->Submit( [this, request, handler, context](){ this->DescribeWorkflowExecutionAsyncHelper( request, handler, context ); } );
 }
 
+DescribeWorkflowExecutionOutcomeCallable SWFClient::DescribeWorkflowExecutionCallable(DescribeWorkflowExecutionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::DescribeWorkflowExecution, this, std::move(request)));
+}
+
+void SWFClient::DescribeWorkflowExecutionAsync(DescribeWorkflowExecutionRequest&& request, const DescribeWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::DescribeWorkflowExecutionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::DescribeWorkflowExecutionAsyncHelper(const DescribeWorkflowExecutionRequest& request, const DescribeWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeWorkflowExecution(request), context);
@@ -450,7 +550,7 @@ DescribeWorkflowTypeOutcome SWFClient::DescribeWorkflowType(const DescribeWorkfl
 
 DescribeWorkflowTypeOutcomeCallable SWFClient::DescribeWorkflowTypeCallable(const DescribeWorkflowTypeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeWorkflowType(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeWorkflowType(request); } );
 }
 
 void SWFClient::DescribeWorkflowTypeAsync(const DescribeWorkflowTypeRequest& request, const DescribeWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -458,6 +558,16 @@ void SWFClient::DescribeWorkflowTypeAsync(const DescribeWorkflowTypeRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->DescribeWorkflowTypeAsyncHelper( request, handler, context ); } );
 }
 
+DescribeWorkflowTypeOutcomeCallable SWFClient::DescribeWorkflowTypeCallable(DescribeWorkflowTypeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::DescribeWorkflowType, this, std::move(request)));
+}
+
+void SWFClient::DescribeWorkflowTypeAsync(DescribeWorkflowTypeRequest&& request, const DescribeWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::DescribeWorkflowTypeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::DescribeWorkflowTypeAsyncHelper(const DescribeWorkflowTypeRequest& request, const DescribeWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeWorkflowType(request), context);
@@ -481,7 +591,7 @@ GetWorkflowExecutionHistoryOutcome SWFClient::GetWorkflowExecutionHistory(const
 
 GetWorkflowExecutionHistoryOutcomeCallable SWFClient::GetWorkflowExecutionHistoryCallable(const GetWorkflowExecutionHistoryRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetWorkflowExecutionHistory(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetWorkflowExecutionHistory(request); } );
 }
 
 void SWFClient::GetWorkflowExecutionHistoryAsync(const GetWorkflowExecutionHistoryRequest& request, const GetWorkflowExecutionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -489,6 +599,16 @@ void SWFClient::GetWorkflowExecutionHistoryAsync(const GetWorkflowExecutionHisto
   m_executor->Submit( [this, request, handler, context](){ this->GetWorkflowExecutionHistoryAsyncHelper( request, handler, context ); } );
 }
 
+GetWorkflowExecutionHistoryOutcomeCallable SWFClient::GetWorkflowExecutionHistoryCallable(GetWorkflowExecutionHistoryRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::GetWorkflowExecutionHistory, this, std::move(request)));
+}
+
+void SWFClient::GetWorkflowExecutionHistoryAsync(GetWorkflowExecutionHistoryRequest&& request, const GetWorkflowExecutionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::GetWorkflowExecutionHistoryAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::GetWorkflowExecutionHistoryAsyncHelper(const GetWorkflowExecutionHistoryRequest& request, const GetWorkflowExecutionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetWorkflowExecutionHistory(request), context);
@@ -512,7 +632,7 @@ ListActivityTypesOutcome SWFClient::ListActivityTypes(const ListActivityTypesReq
 
 ListActivityTypesOutcomeCallable SWFClient::ListActivityTypesCallable(const ListActivityTypesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListActivityTypes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListActivityTypes(request); } );
 }
 
 void SWFClient::ListActivityTypesAsync(const ListActivityTypesRequest& request, const ListActivityTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -520,6 +640,16 @@ void SWFClient::ListActivityTypesAsync(const ListActivityTypesRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ListActivityTypesAsyncHelper( request, handler, context ); } );
 }
 
+ListActivityTypesOutcomeCallable SWFClient::ListActivityTypesCallable(ListActivityTypesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::ListActivityTypes, this, std::move(request)));
+}
+
+void SWFClient::ListActivityTypesAsync(ListActivityTypesRequest&& request, const ListActivityTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::ListActivityTypesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::ListActivityTypesAsyncHelper(const ListActivityTypesRequest& request, const ListActivityTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListActivityTypes(request), context);
@@ -543,7 +673,7 @@ ListClosedWorkflowExecutionsOutcome SWFClient::ListClosedWorkflowExecutions(cons
 
 ListClosedWorkflowExecutionsOutcomeCallable SWFClient::ListClosedWorkflowExecutionsCallable(const ListClosedWorkflowExecutionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListClosedWorkflowExecutions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListClosedWorkflowExecutions(request); } );
 }
 
 void SWFClient::ListClosedWorkflowExecutionsAsync(const ListClosedWorkflowExecutionsRequest& request, const ListClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -551,6 +681,16 @@ void SWFClient::ListClosedWorkflowExecutionsAsync(const ListClosedWorkflowExecut
   m_executor->Submit( [this, request, handler, context](){ this->ListClosedWorkflowExecutionsAsyncHelper( request, handler, context ); } );
 }
 
+ListClosedWorkflowExecutionsOutcomeCallable SWFClient::ListClosedWorkflowExecutionsCallable(ListClosedWorkflowExecutionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::ListClosedWorkflowExecutions, this, std::move(request)));
+}
+
+void SWFClient::ListClosedWorkflowExecutionsAsync(ListClosedWorkflowExecutionsRequest&& request, const ListClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::ListClosedWorkflowExecutionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::ListClosedWorkflowExecutionsAsyncHelper(const ListClosedWorkflowExecutionsRequest& request, const ListClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListClosedWorkflowExecutions(request), context);
@@ -574,7 +714,7 @@ ListDomainsOutcome SWFClient::ListDomains(const ListDomainsRequest& request) con
 
 ListDomainsOutcomeCallable SWFClient::ListDomainsCallable(const ListDomainsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListDomains(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListDomains(request); } );
 }
 
 void SWFClient::ListDomainsAsync(const ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -582,6 +722,16 @@ void SWFClient::ListDomainsAsync(const ListDomainsRequest& request, const ListDo
   m_executor->Submit( [this, request, handler, context](){ this->ListDomainsAsyncHelper( request, handler, context ); } );
 }
 
+ListDomainsOutcomeCallable SWFClient::ListDomainsCallable(ListDomainsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::ListDomains, this, std::move(request)));
+}
+
+void SWFClient::ListDomainsAsync(ListDomainsRequest&& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::ListDomainsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::ListDomainsAsyncHelper(const ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListDomains(request), context);
@@ -605,7 +755,7 @@ ListOpenWorkflowExecutionsOutcome SWFClient::ListOpenWorkflowExecutions(const Li
 
 ListOpenWorkflowExecutionsOutcomeCallable SWFClient::ListOpenWorkflowExecutionsCallable(const ListOpenWorkflowExecutionsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListOpenWorkflowExecutions(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListOpenWorkflowExecutions(request); } );
 }
 
 void SWFClient::ListOpenWorkflowExecutionsAsync(const ListOpenWorkflowExecutionsRequest& request, const ListOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -613,6 +763,16 @@ void SWFClient::ListOpenWorkflowExecutionsAsync(const ListOpenWorkflowExecutions
   m_executor->Submit( [this, request, handler, context](){ this->ListOpenWorkflowExecutionsAsyncHelper( request, handler, context ); } );
 }
 
+ListOpenWorkflowExecutionsOutcomeCallable SWFClient::ListOpenWorkflowExecutionsCallable(ListOpenWorkflowExecutionsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::ListOpenWorkflowExecutions, this, std::move(request)));
+}
+
+void SWFClient::ListOpenWorkflowExecutionsAsync(ListOpenWorkflowExecutionsRequest&& request, const ListOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::ListOpenWorkflowExecutionsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::ListOpenWorkflowExecutionsAsyncHelper(const ListOpenWorkflowExecutionsRequest& request, const ListOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListOpenWorkflowExecutions(request), context);
@@ -636,7 +796,7 @@ ListWorkflowTypesOutcome SWFClient::ListWorkflowTypes(const ListWorkflowTypesReq
 
 ListWorkflowTypesOutcomeCallable SWFClient::ListWorkflowTypesCallable(const ListWorkflowTypesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListWorkflowTypes(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListWorkflowTypes(request); } );
 }
 
 void SWFClient::ListWorkflowTypesAsync(const ListWorkflowTypesRequest& request, const ListWorkflowTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -644,6 +804,16 @@ void SWFClient::ListWorkflowTypesAsync(const ListWorkflowTypesRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ListWorkflowTypesAsyncHelper( request, handler, context ); } );
 }
 
+ListWorkflowTypesOutcomeCallable SWFClient::ListWorkflowTypesCallable(ListWorkflowTypesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::ListWorkflowTypes, this, std::move(request)));
+}
+
+void SWFClient::ListWorkflowTypesAsync(ListWorkflowTypesRequest&& request, const ListWorkflowTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::ListWorkflowTypesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::ListWorkflowTypesAsyncHelper(const ListWorkflowTypesRequest& request, const ListWorkflowTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListWorkflowTypes(request), context);
@@ -667,7 +837,7 @@ PollForActivityTaskOutcome SWFClient::PollForActivityTask(const PollForActivityT
 
 PollForActivityTaskOutcomeCallable SWFClient::PollForActivityTaskCallable(const PollForActivityTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PollForActivityTask(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PollForActivityTask(request); } );
 }
 
 void SWFClient::PollForActivityTaskAsync(const PollForActivityTaskRequest& request, const PollForActivityTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -675,6 +845,16 @@ void SWFClient::PollForActivityTaskAsync(const PollForActivityTaskRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->PollForActivityTaskAsyncHelper( request, handler, context ); } );
 }
 
+PollForActivityTaskOutcomeCallable SWFClient::PollForActivityTaskCallable(PollForActivityTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::PollForActivityTask, this, std::move(request)));
+}
+
+void SWFClient::PollForActivityTaskAsync(PollForActivityTaskRequest&& request, const PollForActivityTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::PollForActivityTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::PollForActivityTaskAsyncHelper(const PollForActivityTaskRequest& request, const PollForActivityTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PollForActivityTask(request), context);
@@ -698,7 +878,7 @@ PollForDecisionTaskOutcome SWFClient::PollForDecisionTask(const PollForDecisionT
 
 PollForDecisionTaskOutcomeCallable SWFClient::PollForDecisionTaskCallable(const PollForDecisionTaskRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->PollForDecisionTask(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->PollForDecisionTask(request); } );
 }
 
 void SWFClient::PollForDecisionTaskAsync(const PollForDecisionTaskRequest& request, const PollForDecisionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -706,6 +886,16 @@ void SWFClient::PollForDecisionTaskAsync(const PollForDecisionTaskRequest& reque
   m_executor->Submit( [this, request, handler, context](){ this->PollForDecisionTaskAsyncHelper( request, handler, context ); } );
 }
 
+PollForDecisionTaskOutcomeCallable SWFClient::PollForDecisionTaskCallable(PollForDecisionTaskRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::PollForDecisionTask, this, std::move(request)));
+}
+
+void SWFClient::PollForDecisionTaskAsync(PollForDecisionTaskRequest&& request, const PollForDecisionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::PollForDecisionTaskAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::PollForDecisionTaskAsyncHelper(const PollForDecisionTaskRequest& request, const PollForDecisionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, PollForDecisionTask(request), context);
@@ -729,7 +919,7 @@ RecordActivityTaskHeartbeatOutcome SWFClient::RecordActivityTaskHeartbeat(const
 
 RecordActivityTaskHeartbeatOutcomeCallable SWFClient::RecordActivityTaskHeartbeatCallable(const RecordActivityTaskHeartbeatRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RecordActivityTaskHeartbeat(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RecordActivityTaskHeartbeat(request); } );
 }
 
 void SWFClient::RecordActivityTaskHeartbeatAsync(const RecordActivityTaskHeartbeatRequest& request, const RecordActivityTaskHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -737,6 +927,16 @@ void SWFClient::RecordActivityTaskHeartbeatAsync(const RecordActivityTaskHeartbe
   m_executor->Submit( [this, request, handler, context](){ this->RecordActivityTaskHeartbeatAsyncHelper( request, handler, context ); } );
 }
 
+RecordActivityTaskHeartbeatOutcomeCallable SWFClient::RecordActivityTaskHeartbeatCallable(RecordActivityTaskHeartbeatRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::RecordActivityTaskHeartbeat, this, std::move(request)));
+}
+
+void SWFClient::RecordActivityTaskHeartbeatAsync(RecordActivityTaskHeartbeatRequest&& request, const RecordActivityTaskHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::RecordActivityTaskHeartbeatAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::RecordActivityTaskHeartbeatAsyncHelper(const RecordActivityTaskHeartbeatRequest& request, const RecordActivityTaskHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RecordActivityTaskHeartbeat(request), context);
@@ -760,7 +960,7 @@ RegisterActivityTypeOutcome SWFClient::RegisterActivityType(const RegisterActivi
 
 RegisterActivityTypeOutcomeCallable SWFClient::RegisterActivityTypeCallable(const RegisterActivityTypeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterActivityType(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterActivityType(request); } );
 }
 
 void SWFClient::RegisterActivityTypeAsync(const RegisterActivityTypeRequest& request, const RegisterActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -768,6 +968,16 @@ void SWFClient::RegisterActivityTypeAsync(const RegisterActivityTypeRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->RegisterActivityTypeAsyncHelper( request, handler, context ); } );
 }
 
+RegisterActivityTypeOutcomeCallable SWFClient::RegisterActivityTypeCallable(RegisterActivityTypeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::RegisterActivityType, this, std::move(request)));
+}
+
+void SWFClient::RegisterActivityTypeAsync(RegisterActivityTypeRequest&& request, const RegisterActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::RegisterActivityTypeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::RegisterActivityTypeAsyncHelper(const RegisterActivityTypeRequest& request, const RegisterActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterActivityType(request), context);
@@ -791,7 +1001,7 @@ RegisterDomainOutcome SWFClient::RegisterDomain(const RegisterDomainRequest& req
 
 RegisterDomainOutcomeCallable SWFClient::RegisterDomainCallable(const RegisterDomainRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterDomain(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterDomain(request); } );
 }
 
 void SWFClient::RegisterDomainAsync(const RegisterDomainRequest& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -799,6 +1009,16 @@ void SWFClient::RegisterDomainAsync(const RegisterDomainRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->RegisterDomainAsyncHelper( request, handler, context ); } );
 }
 
+RegisterDomainOutcomeCallable SWFClient::RegisterDomainCallable(RegisterDomainRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::RegisterDomain, this, std::move(request)));
+}
+
+void SWFClient::RegisterDomainAsync(RegisterDomainRequest&& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::RegisterDomainAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::RegisterDomainAsyncHelper(const RegisterDomainRequest& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterDomain(request), context);
@@ -822,7 +1042,7 @@ RegisterWorkflowTypeOutcome SWFClient::RegisterWorkflowType(const RegisterWorkfl
 
 RegisterWorkflowTypeOutcomeCallable SWFClient::RegisterWorkflowTypeCallable(const RegisterWorkflowTypeRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RegisterWorkflowType(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RegisterWorkflowType(request); } );
 }
 
 void SWFClient::RegisterWorkflowTypeAsync(const RegisterWorkflowTypeRequest& request, const RegisterWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -830,6 +1050,16 @@ void SWFClient::RegisterWorkflowTypeAsync(const RegisterWorkflowTypeRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->RegisterWorkflowTypeAsyncHelper( request, handler, context ); } );
 }
 
+RegisterWorkflowTypeOutcomeCallable SWFClient::RegisterWorkflowTypeCallable(RegisterWorkflowTypeRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::RegisterWorkflowType, this, std::move(request)));
+}
+
+void SWFClient::RegisterWorkflowTypeAsync(RegisterWorkflowTypeRequest&& request, const RegisterWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::RegisterWorkflowTypeAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::RegisterWorkflowTypeAsyncHelper(const RegisterWorkflowTypeRequest& request, const RegisterWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RegisterWorkflowType(request), context);
@@ -853,7 +1083,7 @@ RequestCancelWorkflowExecutionOutcome SWFClient::RequestCancelWorkflowExecution(
 
 RequestCancelWorkflowExecutionOutcomeCallable SWFClient::RequestCancelWorkflowExecutionCallable(const RequestCancelWorkflowExecutionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RequestCancelWorkflowExecution(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RequestCancelWorkflowExecution(request); } );
 }
 
 void SWFClient::RequestCancelWorkflowExecutionAsync(const RequestCancelWorkflowExecutionRequest& request, const RequestCancelWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -861,6 +1091,16 @@ void SWFClient::RequestCancelWorkflowExecutionAsync(const RequestCancelWorkflowE
   m_executor->Submit( [this, request, handler, context](){ this->RequestCancelWorkflowExecutionAsyncHelper( request, handler, context ); } );
 }
 
+RequestCancelWorkflowExecutionOutcomeCallable SWFClient::RequestCancelWorkflowExecutionCallable(RequestCancelWorkflowExecutionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::RequestCancelWorkflowExecution, this, std::move(request)));
+}
+
+void SWFClient::RequestCancelWorkflowExecutionAsync(RequestCancelWorkflowExecutionRequest&& request, const RequestCancelWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::RequestCancelWorkflowExecutionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::RequestCancelWorkflowExecutionAsyncHelper(const RequestCancelWorkflowExecutionRequest& request, const RequestCancelWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RequestCancelWorkflowExecution(request), context);
@@ -884,7 +1124,7 @@ RespondActivityTaskCanceledOutcome SWFClient::RespondActivityTaskCanceled(const
 
 RespondActivityTaskCanceledOutcomeCallable SWFClient::RespondActivityTaskCanceledCallable(const RespondActivityTaskCanceledRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RespondActivityTaskCanceled(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RespondActivityTaskCanceled(request); } );
 }
 
 void SWFClient::RespondActivityTaskCanceledAsync(const RespondActivityTaskCanceledRequest& request, const RespondActivityTaskCanceledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -892,6 +1132,16 @@ void SWFClient::RespondActivityTaskCanceledAsync(const RespondActivityTaskCancel
   m_executor->Submit( [this, request, handler, context](){ this->RespondActivityTaskCanceledAsyncHelper( request, handler, context ); } );
 }
 
+RespondActivityTaskCanceledOutcomeCallable SWFClient::RespondActivityTaskCanceledCallable(RespondActivityTaskCanceledRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::RespondActivityTaskCanceled, this, std::move(request)));
+}
+
+void SWFClient::RespondActivityTaskCanceledAsync(RespondActivityTaskCanceledRequest&& request, const RespondActivityTaskCanceledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::RespondActivityTaskCanceledAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::RespondActivityTaskCanceledAsyncHelper(const RespondActivityTaskCanceledRequest& request, const RespondActivityTaskCanceledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RespondActivityTaskCanceled(request), context);
@@ -915,7 +1165,7 @@ RespondActivityTaskCompletedOutcome SWFClient::RespondActivityTaskCompleted(cons
 
 RespondActivityTaskCompletedOutcomeCallable SWFClient::RespondActivityTaskCompletedCallable(const RespondActivityTaskCompletedRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RespondActivityTaskCompleted(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RespondActivityTaskCompleted(request); } );
 }
 
 void SWFClient::RespondActivityTaskCompletedAsync(const RespondActivityTaskCompletedRequest& request, const RespondActivityTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -923,6 +1173,16 @@ void SWFClient::RespondActivityTaskCompletedAsync(const RespondActivityTaskCompl
   m_executor->Submit( [this, request, handler, context](){ this->RespondActivityTaskCompletedAsyncHelper( request, handler, context ); } );
 }
 
+RespondActivityTaskCompletedOutcomeCallable SWFClient::RespondActivityTaskCompletedCallable(RespondActivityTaskCompletedRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::RespondActivityTaskCompleted, this, std::move(request)));
+}
+
+void SWFClient::RespondActivityTaskCompletedAsync(RespondActivityTaskCompletedRequest&& request, const RespondActivityTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::RespondActivityTaskCompletedAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::RespondActivityTaskCompletedAsyncHelper(const RespondActivityTaskCompletedRequest& request, const RespondActivityTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RespondActivityTaskCompleted(request), context);
@@ -946,7 +1206,7 @@ RespondActivityTaskFailedOutcome SWFClient::RespondActivityTaskFailed(const Resp
 
 RespondActivityTaskFailedOutcomeCallable SWFClient::RespondActivityTaskFailedCallable(const RespondActivityTaskFailedRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RespondActivityTaskFailed(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RespondActivityTaskFailed(request); } );
 }
 
 void SWFClient::RespondActivityTaskFailedAsync(const RespondActivityTaskFailedRequest& request, const RespondActivityTaskFailedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -954,6 +1214,16 @@ void SWFClient::RespondActivityTaskFailedAsync(const RespondActivityTaskFailedRe
   m_executor->Submit( [this, request, handler, context](){ this->RespondActivityTaskFailedAsyncHelper( request, handler, context ); } );
 }
 
+RespondActivityTaskFailedOutcomeCallable SWFClient::RespondActivityTaskFailedCallable(RespondActivityTaskFailedRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::RespondActivityTaskFailed, this, std::move(request)));
+}
+
+void SWFClient::RespondActivityTaskFailedAsync(RespondActivityTaskFailedRequest&& request, const RespondActivityTaskFailedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::RespondActivityTaskFailedAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::RespondActivityTaskFailedAsyncHelper(const RespondActivityTaskFailedRequest& request, const RespondActivityTaskFailedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RespondActivityTaskFailed(request), context);
@@ -977,7 +1247,7 @@ RespondDecisionTaskCompletedOutcome SWFClient::RespondDecisionTaskCompleted(cons
 
 RespondDecisionTaskCompletedOutcomeCallable SWFClient::RespondDecisionTaskCompletedCallable(const RespondDecisionTaskCompletedRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RespondDecisionTaskCompleted(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RespondDecisionTaskCompleted(request); } );
 }
 
 void SWFClient::RespondDecisionTaskCompletedAsync(const RespondDecisionTaskCompletedRequest& request, const RespondDecisionTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -985,6 +1255,16 @@ void SWFClient::RespondDecisionTaskCompletedAsync(const RespondDecisionTaskCompl
   m_executor->Submit( [this, request, handler, context](){ this->RespondDecisionTaskCompletedAsyncHelper( request, handler, context ); } );
 }
 
+RespondDecisionTaskCompletedOutcomeCallable SWFClient::RespondDecisionTaskCompletedCallable(RespondDecisionTaskCompletedRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::RespondDecisionTaskCompleted, this, std::move(request)));
+}
+
+void SWFClient::RespondDecisionTaskCompletedAsync(RespondDecisionTaskCompletedRequest&& request, const RespondDecisionTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::RespondDecisionTaskCompletedAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::RespondDecisionTaskCompletedAsyncHelper(const RespondDecisionTaskCompletedRequest& request, const RespondDecisionTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RespondDecisionTaskCompleted(request), context);
@@ -1008,7 +1288,7 @@ SignalWorkflowExecutionOutcome SWFClient::SignalWorkflowExecution(const SignalWo
 
 SignalWorkflowExecutionOutcomeCallable SWFClient::SignalWorkflowExecutionCallable(const SignalWorkflowExecutionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->SignalWorkflowExecution(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->SignalWorkflowExecution(request); } );
 }
 
 void SWFClient::SignalWorkflowExecutionAsync(const SignalWorkflowExecutionRequest& request, const SignalWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1016,6 +1296,16 @@ void SWFClient::SignalWorkflowExecutionAsync(const SignalWorkflowExecutionReques
   m_executor->Submit( [this, request, handler, context](){ this->SignalWorkflowExecutionAsyncHelper( request, handler, context ); } );
 }
 
+SignalWorkflowExecutionOutcomeCallable SWFClient::SignalWorkflowExecutionCallable(SignalWorkflowExecutionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::SignalWorkflowExecution, this, std::move(request)));
+}
+
+void SWFClient::SignalWorkflowExecutionAsync(SignalWorkflowExecutionRequest&& request, const SignalWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::SignalWorkflowExecutionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::SignalWorkflowExecutionAsyncHelper(const SignalWorkflowExecutionRequest& request, const SignalWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, SignalWorkflowExecution(request), context);
@@ -1039,7 +1329,7 @@ StartWorkflowExecutionOutcome SWFClient::StartWorkflowExecution(const StartWorkf
 
 StartWorkflowExecutionOutcomeCallable SWFClient::StartWorkflowExecutionCallable(const StartWorkflowExecutionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StartWorkflowExecution(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StartWorkflowExecution(request); } );
 }
 
 void SWFClient::StartWorkflowExecutionAsync(const StartWorkflowExecutionRequest& request, const StartWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1047,6 +1337,16 @@ void SWFClient::StartWorkflowExecutionAsync(const StartWorkflowExecutionRequest&
   m_executor->Submit( [this, request, handler, context](){ this->StartWorkflowExecutionAsyncHelper( request, handler, context ); } );
 }
 
+StartWorkflowExecutionOutcomeCallable SWFClient::StartWorkflowExecutionCallable(StartWorkflowExecutionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::StartWorkflowExecution, this, std::move(request)));
+}
+
+void SWFClient::StartWorkflowExecutionAsync(StartWorkflowExecutionRequest&& request, const StartWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::StartWorkflowExecutionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::StartWorkflowExecutionAsyncHelper(const StartWorkflowExecutionRequest& request, const StartWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StartWorkflowExecution(request), context);
@@ -1070,7 +1370,7 @@ TerminateWorkflowExecutionOutcome SWFClient::TerminateWorkflowExecution(const Te
 
 TerminateWorkflowExecutionOutcomeCallable SWFClient::TerminateWorkflowExecutionCallable(const TerminateWorkflowExecutionRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TerminateWorkflowExecution(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TerminateWorkflowExecution(request); } );
 }
 
 void SWFClient::TerminateWorkflowExecutionAsync(const TerminateWorkflowExecutionRequest& request, const TerminateWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1078,8 +1378,294 @@ void SWFClient::TerminateWorkflowExecutionAsync(const TerminateWorkflowExecution
   m_executor->Submit( [this, request, handler, context](){ this->TerminateWorkflowExecutionAsyncHelper( request, handler, context ); } );
 }
 
+TerminateWorkflowExecutionOutcomeCallable SWFClient::TerminateWorkflowExecutionCallable(TerminateWorkflowExecutionRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&SWFClient::TerminateWorkflowExecution, this, std::move(request)));
+}
+
+void SWFClient::TerminateWorkflowExecutionAsync(TerminateWorkflowExecutionRequest&& request, const TerminateWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&SWFClient::TerminateWorkflowExecutionAsyncHelper, this, std::move(request), handler, context);
+}
+
 void SWFClient::TerminateWorkflowExecutionAsyncHelper(const TerminateWorkflowExecutionRequest& request, const TerminateWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TerminateWorkflowExecution(request), context);
 }
 
+Paginator<SWFClient, GetWorkflowExecutionHistoryRequest, GetWorkflowExecutionHistoryOutcome> SWFClient::GetWorkflowExecutionHistoryPaginator(const GetWorkflowExecutionHistoryRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SWFClient, GetWorkflowExecutionHistoryRequest, GetWorkflowExecutionHistoryOutcome>(this, &SWFClient::GetWorkflowExecutionHistory, request,
+    [](const GetWorkflowExecutionHistoryRequest& current, const GetWorkflowExecutionHistoryOutcome& outcome, GetWorkflowExecutionHistoryRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetNextPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SWFClient, ListActivityTypesRequest, ListActivityTypesOutcome> SWFClient::ListActivityTypesPaginator(const ListActivityTypesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SWFClient, ListActivityTypesRequest, ListActivityTypesOutcome>(this, &SWFClient::ListActivityTypes, request,
+    [](const ListActivityTypesRequest& current, const ListActivityTypesOutcome& outcome, ListActivityTypesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetNextPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SWFClient, ListClosedWorkflowExecutionsRequest, ListClosedWorkflowExecutionsOutcome> SWFClient::ListClosedWorkflowExecutionsPaginator(const ListClosedWorkflowExecutionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SWFClient, ListClosedWorkflowExecutionsRequest, ListClosedWorkflowExecutionsOutcome>(this, &SWFClient::ListClosedWorkflowExecutions, request,
+    [](const ListClosedWorkflowExecutionsRequest& current, const ListClosedWorkflowExecutionsOutcome& outcome, ListClosedWorkflowExecutionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetNextPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SWFClient, ListDomainsRequest, ListDomainsOutcome> SWFClient::ListDomainsPaginator(const ListDomainsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SWFClient, ListDomainsRequest, ListDomainsOutcome>(this, &SWFClient::ListDomains, request,
+    [](const ListDomainsRequest& current, const ListDomainsOutcome& outcome, ListDomainsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetNextPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SWFClient, ListOpenWorkflowExecutionsRequest, ListOpenWorkflowExecutionsOutcome> SWFClient::ListOpenWorkflowExecutionsPaginator(const ListOpenWorkflowExecutionsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SWFClient, ListOpenWorkflowExecutionsRequest, ListOpenWorkflowExecutionsOutcome>(this, &SWFClient::ListOpenWorkflowExecutions, request,
+    [](const ListOpenWorkflowExecutionsRequest& current, const ListOpenWorkflowExecutionsOutcome& outcome, ListOpenWorkflowExecutionsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetNextPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SWFClient, ListWorkflowTypesRequest, ListWorkflowTypesOutcome> SWFClient::ListWorkflowTypesPaginator(const ListWorkflowTypesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SWFClient, ListWorkflowTypesRequest, ListWorkflowTypesOutcome>(this, &SWFClient::ListWorkflowTypes, request,
+    [](const ListWorkflowTypesRequest& current, const ListWorkflowTypesOutcome& outcome, ListWorkflowTypesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetNextPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<SWFClient, PollForDecisionTaskRequest, PollForDecisionTaskOutcome> SWFClient::PollForDecisionTaskPaginator(const PollForDecisionTaskRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<SWFClient, PollForDecisionTaskRequest, PollForDecisionTaskOutcome>(this, &SWFClient::PollForDecisionTask, request,
+    [](const PollForDecisionTaskRequest& current, const PollForDecisionTaskOutcome& outcome, PollForDecisionTaskRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextPageToken();
+      if(token.empty() || token == current.GetNextPageToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextPageToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<SWFClient, CountClosedWorkflowExecutionsRequest, CountClosedWorkflowExecutionsOutcome> SWFClient::CountClosedWorkflowExecutionsAwaitable(CountClosedWorkflowExecutionsRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::CountClosedWorkflowExecutions, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, CountOpenWorkflowExecutionsRequest, CountOpenWorkflowExecutionsOutcome> SWFClient::CountOpenWorkflowExecutionsAwaitable(CountOpenWorkflowExecutionsRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::CountOpenWorkflowExecutions, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, CountPendingActivityTasksRequest, CountPendingActivityTasksOutcome> SWFClient::CountPendingActivityTasksAwaitable(CountPendingActivityTasksRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::CountPendingActivityTasks, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, CountPendingDecisionTasksRequest, CountPendingDecisionTasksOutcome> SWFClient::CountPendingDecisionTasksAwaitable(CountPendingDecisionTasksRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::CountPendingDecisionTasks, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, DeprecateActivityTypeRequest, DeprecateActivityTypeOutcome> SWFClient::DeprecateActivityTypeAwaitable(DeprecateActivityTypeRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::DeprecateActivityType, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, DeprecateDomainRequest, DeprecateDomainOutcome> SWFClient::DeprecateDomainAwaitable(DeprecateDomainRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::DeprecateDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, DeprecateWorkflowTypeRequest, DeprecateWorkflowTypeOutcome> SWFClient::DeprecateWorkflowTypeAwaitable(DeprecateWorkflowTypeRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::DeprecateWorkflowType, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, DescribeActivityTypeRequest, DescribeActivityTypeOutcome> SWFClient::DescribeActivityTypeAwaitable(DescribeActivityTypeRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::DescribeActivityType, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, DescribeDomainRequest, DescribeDomainOutcome> SWFClient::DescribeDomainAwaitable(DescribeDomainRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::DescribeDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, DescribeWorkflowExecutionRequest, DescribeWorkflowExecutionOutcome> SWFClient::DescribeWorkflowExecutionAwaitable(DescribeWorkflowExecutionRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::DescribeWorkflowExecution, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, DescribeWorkflowTypeRequest, DescribeWorkflowTypeOutcome> SWFClient::DescribeWorkflowTypeAwaitable(DescribeWorkflowTypeRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::DescribeWorkflowType, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, GetWorkflowExecutionHistoryRequest, GetWorkflowExecutionHistoryOutcome> SWFClient::GetWorkflowExecutionHistoryAwaitable(GetWorkflowExecutionHistoryRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::GetWorkflowExecutionHistory, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, ListActivityTypesRequest, ListActivityTypesOutcome> SWFClient::ListActivityTypesAwaitable(ListActivityTypesRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::ListActivityTypes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, ListClosedWorkflowExecutionsRequest, ListClosedWorkflowExecutionsOutcome> SWFClient::ListClosedWorkflowExecutionsAwaitable(ListClosedWorkflowExecutionsRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::ListClosedWorkflowExecutions, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, ListDomainsRequest, ListDomainsOutcome> SWFClient::ListDomainsAwaitable(ListDomainsRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::ListDomains, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, ListOpenWorkflowExecutionsRequest, ListOpenWorkflowExecutionsOutcome> SWFClient::ListOpenWorkflowExecutionsAwaitable(ListOpenWorkflowExecutionsRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::ListOpenWorkflowExecutions, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, ListWorkflowTypesRequest, ListWorkflowTypesOutcome> SWFClient::ListWorkflowTypesAwaitable(ListWorkflowTypesRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::ListWorkflowTypes, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, PollForActivityTaskRequest, PollForActivityTaskOutcome> SWFClient::PollForActivityTaskAwaitable(PollForActivityTaskRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::PollForActivityTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, PollForDecisionTaskRequest, PollForDecisionTaskOutcome> SWFClient::PollForDecisionTaskAwaitable(PollForDecisionTaskRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::PollForDecisionTask, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, RecordActivityTaskHeartbeatRequest, RecordActivityTaskHeartbeatOutcome> SWFClient::RecordActivityTaskHeartbeatAwaitable(RecordActivityTaskHeartbeatRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::RecordActivityTaskHeartbeat, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, RegisterActivityTypeRequest, RegisterActivityTypeOutcome> SWFClient::RegisterActivityTypeAwaitable(RegisterActivityTypeRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::RegisterActivityType, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, RegisterDomainRequest, RegisterDomainOutcome> SWFClient::RegisterDomainAwaitable(RegisterDomainRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::RegisterDomain, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, RegisterWorkflowTypeRequest, RegisterWorkflowTypeOutcome> SWFClient::RegisterWorkflowTypeAwaitable(RegisterWorkflowTypeRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::RegisterWorkflowType, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, RequestCancelWorkflowExecutionRequest, RequestCancelWorkflowExecutionOutcome> SWFClient::RequestCancelWorkflowExecutionAwaitable(RequestCancelWorkflowExecutionRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::RequestCancelWorkflowExecution, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, RespondActivityTaskCanceledRequest, RespondActivityTaskCanceledOutcome> SWFClient::RespondActivityTaskCanceledAwaitable(RespondActivityTaskCanceledRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::RespondActivityTaskCanceled, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, RespondActivityTaskCompletedRequest, RespondActivityTaskCompletedOutcome> SWFClient::RespondActivityTaskCompletedAwaitable(RespondActivityTaskCompletedRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::RespondActivityTaskCompleted, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, RespondActivityTaskFailedRequest, RespondActivityTaskFailedOutcome> SWFClient::RespondActivityTaskFailedAwaitable(RespondActivityTaskFailedRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::RespondActivityTaskFailed, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, RespondDecisionTaskCompletedRequest, RespondDecisionTaskCompletedOutcome> SWFClient::RespondDecisionTaskCompletedAwaitable(RespondDecisionTaskCompletedRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::RespondDecisionTaskCompleted, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, SignalWorkflowExecutionRequest, SignalWorkflowExecutionOutcome> SWFClient::SignalWorkflowExecutionAwaitable(SignalWorkflowExecutionRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::SignalWorkflowExecution, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, StartWorkflowExecutionRequest, StartWorkflowExecutionOutcome> SWFClient::StartWorkflowExecutionAwaitable(StartWorkflowExecutionRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::StartWorkflowExecution, std::move(request) } };
+}
+
+ClientOperationAwaitable<SWFClient, TerminateWorkflowExecutionRequest, TerminateWorkflowExecutionOutcome> SWFClient::TerminateWorkflowExecutionAwaitable(TerminateWorkflowExecutionRequest request) const
+{
+  return { m_executor.get(), { this, &SWFClient::TerminateWorkflowExecution, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
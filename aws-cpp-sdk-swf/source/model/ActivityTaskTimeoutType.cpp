@@ -29,31 +29,35 @@ namespace Aws
       namespace ActivityTaskTimeoutTypeMapper
       {
 
-        static const int START_TO_CLOSE_HASH = HashingUtils::HashString("START_TO_CLOSE");
-        static const int SCHEDULE_TO_START_HASH = HashingUtils::HashString("SCHEDULE_TO_START");
-        static const int SCHEDULE_TO_CLOSE_HASH = HashingUtils::HashString("SCHEDULE_TO_CLOSE");
-        static const int HEARTBEAT_HASH = HashingUtils::HashString("HEARTBEAT");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int START_TO_CLOSE_HASH = 1604344433;
+        static const int SCHEDULE_TO_START_HASH = 1616960038;
+        static const int SCHEDULE_TO_CLOSE_HASH = 1601958844;
+        static const int HEARTBEAT_HASH = -1307475748;
 
 
         ActivityTaskTimeoutType GetActivityTaskTimeoutTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == START_TO_CLOSE_HASH)
+          switch (hashCode)
           {
+          case START_TO_CLOSE_HASH:
             return ActivityTaskTimeoutType::START_TO_CLOSE;
-          }
-          else if (hashCode == SCHEDULE_TO_START_HASH)
-          {
+          case SCHEDULE_TO_START_HASH:
             return ActivityTaskTimeoutType::SCHEDULE_TO_START;
-          }
-          else if (hashCode == SCHEDULE_TO_CLOSE_HASH)
-          {
+          case SCHEDULE_TO_CLOSE_HASH:
             return ActivityTaskTimeoutType::SCHEDULE_TO_CLOSE;
-          }
-          else if (hashCode == HEARTBEAT_HASH)
-          {
+          case HEARTBEAT_HASH:
             return ActivityTaskTimeoutType::HEARTBEAT;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
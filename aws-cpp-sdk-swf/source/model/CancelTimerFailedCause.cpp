@@ -29,21 +29,29 @@ namespace Aws
       namespace CancelTimerFailedCauseMapper
       {
 
-        static const int TIMER_ID_UNKNOWN_HASH = HashingUtils::HashString("TIMER_ID_UNKNOWN");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int TIMER_ID_UNKNOWN_HASH = 1169779296;
+        static const int OPERATION_NOT_PERMITTED_HASH = 1767122548;
 
 
         CancelTimerFailedCause GetCancelTimerFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TIMER_ID_UNKNOWN_HASH)
+          switch (hashCode)
           {
+          case TIMER_ID_UNKNOWN_HASH:
             return CancelTimerFailedCause::TIMER_ID_UNKNOWN;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
-          {
+          case OPERATION_NOT_PERMITTED_HASH:
             return CancelTimerFailedCause::OPERATION_NOT_PERMITTED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace ChildPolicyMapper
       {
 
-        static const int TERMINATE_HASH = HashingUtils::HashString("TERMINATE");
-        static const int REQUEST_CANCEL_HASH = HashingUtils::HashString("REQUEST_CANCEL");
-        static const int ABANDON_HASH = HashingUtils::HashString("ABANDON");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int TERMINATE_HASH = 527617601;
+        static const int REQUEST_CANCEL_HASH = -1730455990;
+        static const int ABANDON_HASH = -489858475;
 
 
         ChildPolicy GetChildPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TERMINATE_HASH)
+          switch (hashCode)
           {
+          case TERMINATE_HASH:
             return ChildPolicy::TERMINATE;
-          }
-          else if (hashCode == REQUEST_CANCEL_HASH)
-          {
+          case REQUEST_CANCEL_HASH:
             return ChildPolicy::REQUEST_CANCEL;
-          }
-          else if (hashCode == ABANDON_HASH)
-          {
+          case ABANDON_HASH:
             return ChildPolicy::ABANDON;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,41 +29,41 @@ namespace Aws
       namespace CloseStatusMapper
       {
 
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int CONTINUED_AS_NEW_HASH = HashingUtils::HashString("CONTINUED_AS_NEW");
-        static const int TIMED_OUT_HASH = HashingUtils::HashString("TIMED_OUT");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int COMPLETED_HASH = 1383663147;
+        static const int FAILED_HASH = 2066319421;
+        static const int CANCELED_HASH = 659453081;
+        static const int TERMINATED_HASH = -823723485;
+        static const int CONTINUED_AS_NEW_HASH = 663251445;
+        static const int TIMED_OUT_HASH = -1466757626;
 
 
         CloseStatus GetCloseStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMPLETED_HASH)
+          switch (hashCode)
           {
+          case COMPLETED_HASH:
             return CloseStatus::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
+          case FAILED_HASH:
             return CloseStatus::FAILED;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
+          case CANCELED_HASH:
             return CloseStatus::CANCELED;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
+          case TERMINATED_HASH:
             return CloseStatus::TERMINATED;
-          }
-          else if (hashCode == CONTINUED_AS_NEW_HASH)
-          {
+          case CONTINUED_AS_NEW_HASH:
             return CloseStatus::CONTINUED_AS_NEW;
-          }
-          else if (hashCode == TIMED_OUT_HASH)
-          {
+          case TIMED_OUT_HASH:
             return CloseStatus::TIMED_OUT;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
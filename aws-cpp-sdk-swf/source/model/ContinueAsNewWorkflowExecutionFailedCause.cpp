@@ -29,56 +29,50 @@ namespace Aws
       namespace ContinueAsNewWorkflowExecutionFailedCauseMapper
       {
 
-        static const int UNHANDLED_DECISION_HASH = HashingUtils::HashString("UNHANDLED_DECISION");
-        static const int WORKFLOW_TYPE_DEPRECATED_HASH = HashingUtils::HashString("WORKFLOW_TYPE_DEPRECATED");
-        static const int WORKFLOW_TYPE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("WORKFLOW_TYPE_DOES_NOT_EXIST");
-        static const int DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_TASK_LIST_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_TASK_LIST_UNDEFINED");
-        static const int DEFAULT_CHILD_POLICY_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_CHILD_POLICY_UNDEFINED");
-        static const int CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED_HASH = HashingUtils::HashString("CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int UNHANDLED_DECISION_HASH = -369760712;
+        static const int WORKFLOW_TYPE_DEPRECATED_HASH = 412874584;
+        static const int WORKFLOW_TYPE_DOES_NOT_EXIST_HASH = -1957867734;
+        static const int DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = -1173928279;
+        static const int DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = -718320320;
+        static const int DEFAULT_TASK_LIST_UNDEFINED_HASH = -123805269;
+        static const int DEFAULT_CHILD_POLICY_UNDEFINED_HASH = -317730012;
+        static const int CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED_HASH = -1114389121;
+        static const int OPERATION_NOT_PERMITTED_HASH = 1767122548;
 
 
         ContinueAsNewWorkflowExecutionFailedCause GetContinueAsNewWorkflowExecutionFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNHANDLED_DECISION_HASH)
+          switch (hashCode)
           {
+          case UNHANDLED_DECISION_HASH:
             return ContinueAsNewWorkflowExecutionFailedCause::UNHANDLED_DECISION;
-          }
-          else if (hashCode == WORKFLOW_TYPE_DEPRECATED_HASH)
-          {
+          case WORKFLOW_TYPE_DEPRECATED_HASH:
             return ContinueAsNewWorkflowExecutionFailedCause::WORKFLOW_TYPE_DEPRECATED;
-          }
-          else if (hashCode == WORKFLOW_TYPE_DOES_NOT_EXIST_HASH)
-          {
+          case WORKFLOW_TYPE_DOES_NOT_EXIST_HASH:
             return ContinueAsNewWorkflowExecutionFailedCause::WORKFLOW_TYPE_DOES_NOT_EXIST;
-          }
-          else if (hashCode == DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
+          case DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH:
             return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
+          case DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH:
             return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_TASK_LIST_UNDEFINED_HASH)
-          {
+          case DEFAULT_TASK_LIST_UNDEFINED_HASH:
             return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_TASK_LIST_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_CHILD_POLICY_UNDEFINED_HASH)
-          {
+          case DEFAULT_CHILD_POLICY_UNDEFINED_HASH:
             return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_CHILD_POLICY_UNDEFINED;
-          }
-          else if (hashCode == CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED_HASH)
-          {
+          case CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED_HASH:
             return ContinueAsNewWorkflowExecutionFailedCause::CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
-          {
+          case OPERATION_NOT_PERMITTED_HASH:
             return ContinueAsNewWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
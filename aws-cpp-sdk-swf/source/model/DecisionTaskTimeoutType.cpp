@@ -29,16 +29,26 @@ namespace Aws
       namespace DecisionTaskTimeoutTypeMapper
       {
 
-        static const int START_TO_CLOSE_HASH = HashingUtils::HashString("START_TO_CLOSE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int START_TO_CLOSE_HASH = 1604344433;
 
 
         DecisionTaskTimeoutType GetDecisionTaskTimeoutTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == START_TO_CLOSE_HASH)
+          switch (hashCode)
           {
+          case START_TO_CLOSE_HASH:
             return DecisionTaskTimeoutType::START_TO_CLOSE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,76 +29,62 @@ namespace Aws
       namespace DecisionTypeMapper
       {
 
-        static const int ScheduleActivityTask_HASH = HashingUtils::HashString("ScheduleActivityTask");
-        static const int RequestCancelActivityTask_HASH = HashingUtils::HashString("RequestCancelActivityTask");
-        static const int CompleteWorkflowExecution_HASH = HashingUtils::HashString("CompleteWorkflowExecution");
-        static const int FailWorkflowExecution_HASH = HashingUtils::HashString("FailWorkflowExecution");
-        static const int CancelWorkflowExecution_HASH = HashingUtils::HashString("CancelWorkflowExecution");
-        static const int ContinueAsNewWorkflowExecution_HASH = HashingUtils::HashString("ContinueAsNewWorkflowExecution");
-        static const int RecordMarker_HASH = HashingUtils::HashString("RecordMarker");
-        static const int StartTimer_HASH = HashingUtils::HashString("StartTimer");
-        static const int CancelTimer_HASH = HashingUtils::HashString("CancelTimer");
-        static const int SignalExternalWorkflowExecution_HASH = HashingUtils::HashString("SignalExternalWorkflowExecution");
-        static const int RequestCancelExternalWorkflowExecution_HASH = HashingUtils::HashString("RequestCancelExternalWorkflowExecution");
-        static const int StartChildWorkflowExecution_HASH = HashingUtils::HashString("StartChildWorkflowExecution");
-        static const int ScheduleLambdaFunction_HASH = HashingUtils::HashString("ScheduleLambdaFunction");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ScheduleActivityTask_HASH = 1292529035;
+        static const int RequestCancelActivityTask_HASH = 202654109;
+        static const int CompleteWorkflowExecution_HASH = -11173440;
+        static const int FailWorkflowExecution_HASH = -1126976901;
+        static const int CancelWorkflowExecution_HASH = -1325726049;
+        static const int ContinueAsNewWorkflowExecution_HASH = -1328466606;
+        static const int RecordMarker_HASH = 1817903115;
+        static const int StartTimer_HASH = 409836579;
+        static const int CancelTimer_HASH = 85757131;
+        static const int SignalExternalWorkflowExecution_HASH = 1453743014;
+        static const int RequestCancelExternalWorkflowExecution_HASH = 1243583429;
+        static const int StartChildWorkflowExecution_HASH = 2027766591;
+        static const int ScheduleLambdaFunction_HASH = -1566004394;
 
 
         DecisionType GetDecisionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ScheduleActivityTask_HASH)
+          switch (hashCode)
           {
+          case ScheduleActivityTask_HASH:
             return DecisionType::ScheduleActivityTask;
-          }
-          else if (hashCode == RequestCancelActivityTask_HASH)
-          {
+          case RequestCancelActivityTask_HASH:
             return DecisionType::RequestCancelActivityTask;
-          }
-          else if (hashCode == CompleteWorkflowExecution_HASH)
-          {
+          case CompleteWorkflowExecution_HASH:
             return DecisionType::CompleteWorkflowExecution;
-          }
-          else if (hashCode == FailWorkflowExecution_HASH)
-          {
+          case FailWorkflowExecution_HASH:
             return DecisionType::FailWorkflowExecution;
-          }
-          else if (hashCode == CancelWorkflowExecution_HASH)
-          {
+          case CancelWorkflowExecution_HASH:
             return DecisionType::CancelWorkflowExecution;
-          }
-          else if (hashCode == ContinueAsNewWorkflowExecution_HASH)
-          {
+          case ContinueAsNewWorkflowExecution_HASH:
             return DecisionType::ContinueAsNewWorkflowExecution;
-          }
-          else if (hashCode == RecordMarker_HASH)
-          {
+          case RecordMarker_HASH:
             return DecisionType::RecordMarker;
-          }
-          else if (hashCode == StartTimer_HASH)
-          {
+          case StartTimer_HASH:
             return DecisionType::StartTimer;
-          }
-          else if (hashCode == CancelTimer_HASH)
-          {
+          case CancelTimer_HASH:
             return DecisionType::CancelTimer;
-          }
-          else if (hashCode == SignalExternalWorkflowExecution_HASH)
-          {
+          case SignalExternalWorkflowExecution_HASH:
             return DecisionType::SignalExternalWorkflowExecution;
-          }
-          else if (hashCode == RequestCancelExternalWorkflowExecution_HASH)
-          {
+          case RequestCancelExternalWorkflowExecution_HASH:
             return DecisionType::RequestCancelExternalWorkflowExecution;
-          }
-          else if (hashCode == StartChildWorkflowExecution_HASH)
-          {
+          case StartChildWorkflowExecution_HASH:
             return DecisionType::StartChildWorkflowExecution;
-          }
-          else if (hashCode == ScheduleLambdaFunction_HASH)
-          {
+          case ScheduleLambdaFunction_HASH:
             return DecisionType::ScheduleLambdaFunction;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
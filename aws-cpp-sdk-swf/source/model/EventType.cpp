@@ -29,281 +29,185 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int WorkflowExecutionStarted_HASH = HashingUtils::HashString("WorkflowExecutionStarted");
-        static const int WorkflowExecutionCancelRequested_HASH = HashingUtils::HashString("WorkflowExecutionCancelRequested");
-        static const int WorkflowExecutionCompleted_HASH = HashingUtils::HashString("WorkflowExecutionCompleted");
-        static const int CompleteWorkflowExecutionFailed_HASH = HashingUtils::HashString("CompleteWorkflowExecutionFailed");
-        static const int WorkflowExecutionFailed_HASH = HashingUtils::HashString("WorkflowExecutionFailed");
-        static const int FailWorkflowExecutionFailed_HASH = HashingUtils::HashString("FailWorkflowExecutionFailed");
-        static const int WorkflowExecutionTimedOut_HASH = HashingUtils::HashString("WorkflowExecutionTimedOut");
-        static const int WorkflowExecutionCanceled_HASH = HashingUtils::HashString("WorkflowExecutionCanceled");
-        static const int CancelWorkflowExecutionFailed_HASH = HashingUtils::HashString("CancelWorkflowExecutionFailed");
-        static const int WorkflowExecutionContinuedAsNew_HASH = HashingUtils::HashString("WorkflowExecutionContinuedAsNew");
-        static const int ContinueAsNewWorkflowExecutionFailed_HASH = HashingUtils::HashString("ContinueAsNewWorkflowExecutionFailed");
-        static const int WorkflowExecutionTerminated_HASH = HashingUtils::HashString("WorkflowExecutionTerminated");
-        static const int DecisionTaskScheduled_HASH = HashingUtils::HashString("DecisionTaskScheduled");
-        static const int DecisionTaskStarted_HASH = HashingUtils::HashString("DecisionTaskStarted");
-        static const int DecisionTaskCompleted_HASH = HashingUtils::HashString("DecisionTaskCompleted");
-        static const int DecisionTaskTimedOut_HASH = HashingUtils::HashString("DecisionTaskTimedOut");
-        static const int ActivityTaskScheduled_HASH = HashingUtils::HashString("ActivityTaskScheduled");
-        static const int ScheduleActivityTaskFailed_HASH = HashingUtils::HashString("ScheduleActivityTaskFailed");
-        static const int ActivityTaskStarted_HASH = HashingUtils::HashString("ActivityTaskStarted");
-        static const int ActivityTaskCompleted_HASH = HashingUtils::HashString("ActivityTaskCompleted");
-        static const int ActivityTaskFailed_HASH = HashingUtils::HashString("ActivityTaskFailed");
-        static const int ActivityTaskTimedOut_HASH = HashingUtils::HashString("ActivityTaskTimedOut");
-        static const int ActivityTaskCanceled_HASH = HashingUtils::HashString("ActivityTaskCanceled");
-        static const int ActivityTaskCancelRequested_HASH = HashingUtils::HashString("ActivityTaskCancelRequested");
-        static const int RequestCancelActivityTaskFailed_HASH = HashingUtils::HashString("RequestCancelActivityTaskFailed");
-        static const int WorkflowExecutionSignaled_HASH = HashingUtils::HashString("WorkflowExecutionSignaled");
-        static const int MarkerRecorded_HASH = HashingUtils::HashString("MarkerRecorded");
-        static const int RecordMarkerFailed_HASH = HashingUtils::HashString("RecordMarkerFailed");
-        static const int TimerStarted_HASH = HashingUtils::HashString("TimerStarted");
-        static const int StartTimerFailed_HASH = HashingUtils::HashString("StartTimerFailed");
-        static const int TimerFired_HASH = HashingUtils::HashString("TimerFired");
-        static const int TimerCanceled_HASH = HashingUtils::HashString("TimerCanceled");
-        static const int CancelTimerFailed_HASH = HashingUtils::HashString("CancelTimerFailed");
-        static const int StartChildWorkflowExecutionInitiated_HASH = HashingUtils::HashString("StartChildWorkflowExecutionInitiated");
-        static const int StartChildWorkflowExecutionFailed_HASH = HashingUtils::HashString("StartChildWorkflowExecutionFailed");
-        static const int ChildWorkflowExecutionStarted_HASH = HashingUtils::HashString("ChildWorkflowExecutionStarted");
-        static const int ChildWorkflowExecutionCompleted_HASH = HashingUtils::HashString("ChildWorkflowExecutionCompleted");
-        static const int ChildWorkflowExecutionFailed_HASH = HashingUtils::HashString("ChildWorkflowExecutionFailed");
-        static const int ChildWorkflowExecutionTimedOut_HASH = HashingUtils::HashString("ChildWorkflowExecutionTimedOut");
-        static const int ChildWorkflowExecutionCanceled_HASH = HashingUtils::HashString("ChildWorkflowExecutionCanceled");
-        static const int ChildWorkflowExecutionTerminated_HASH = HashingUtils::HashString("ChildWorkflowExecutionTerminated");
-        static const int SignalExternalWorkflowExecutionInitiated_HASH = HashingUtils::HashString("SignalExternalWorkflowExecutionInitiated");
-        static const int SignalExternalWorkflowExecutionFailed_HASH = HashingUtils::HashString("SignalExternalWorkflowExecutionFailed");
-        static const int ExternalWorkflowExecutionSignaled_HASH = HashingUtils::HashString("ExternalWorkflowExecutionSignaled");
-        static const int RequestCancelExternalWorkflowExecutionInitiated_HASH = HashingUtils::HashString("RequestCancelExternalWorkflowExecutionInitiated");
-        static const int RequestCancelExternalWorkflowExecutionFailed_HASH = HashingUtils::HashString("RequestCancelExternalWorkflowExecutionFailed");
-        static const int ExternalWorkflowExecutionCancelRequested_HASH = HashingUtils::HashString("ExternalWorkflowExecutionCancelRequested");
-        static const int LambdaFunctionScheduled_HASH = HashingUtils::HashString("LambdaFunctionScheduled");
-        static const int LambdaFunctionStarted_HASH = HashingUtils::HashString("LambdaFunctionStarted");
-        static const int LambdaFunctionCompleted_HASH = HashingUtils::HashString("LambdaFunctionCompleted");
-        static const int LambdaFunctionFailed_HASH = HashingUtils::HashString("LambdaFunctionFailed");
-        static const int LambdaFunctionTimedOut_HASH = HashingUtils::HashString("LambdaFunctionTimedOut");
-        static const int ScheduleLambdaFunctionFailed_HASH = HashingUtils::HashString("ScheduleLambdaFunctionFailed");
-        static const int StartLambdaFunctionFailed_HASH = HashingUtils::HashString("StartLambdaFunctionFailed");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int WorkflowExecutionStarted_HASH = 351372360;
+        static const int WorkflowExecutionCancelRequested_HASH = -2094154021;
+        static const int WorkflowExecutionCompleted_HASH = -907713454;
+        static const int CompleteWorkflowExecutionFailed_HASH = -1726434787;
+        static const int WorkflowExecutionFailed_HASH = -1486537834;
+        static const int FailWorkflowExecutionFailed_HASH = -1889523048;
+        static const int WorkflowExecutionTimedOut_HASH = -1091107408;
+        static const int WorkflowExecutionCanceled_HASH = 862632370;
+        static const int CancelWorkflowExecutionFailed_HASH = -2045193284;
+        static const int WorkflowExecutionContinuedAsNew_HASH = -297721910;
+        static const int ContinueAsNewWorkflowExecutionFailed_HASH = 688910383;
+        static const int WorkflowExecutionTerminated_HASH = 1158045948;
+        static const int DecisionTaskScheduled_HASH = 1096877580;
+        static const int DecisionTaskStarted_HASH = 48255392;
+        static const int DecisionTaskCompleted_HASH = -145343574;
+        static const int DecisionTaskTimedOut_HASH = -1897798824;
+        static const int ActivityTaskScheduled_HASH = 1550929337;
+        static const int ScheduleActivityTaskFailed_HASH = 448944552;
+        static const int ActivityTaskStarted_HASH = 1992859789;
+        static const int ActivityTaskCompleted_HASH = 308708183;
+        static const int ActivityTaskFailed_HASH = -1849228623;
+        static const int ActivityTaskTimedOut_HASH = -1744604661;
+        static const int ActivityTaskCanceled_HASH = 209135117;
+        static const int ActivityTaskCancelRequested_HASH = -1868904928;
+        static const int RequestCancelActivityTaskFailed_HASH = 273504314;
+        static const int WorkflowExecutionSignaled_HASH = 1297524320;
+        static const int MarkerRecorded_HASH = 867668778;
+        static const int RecordMarkerFailed_HASH = 1056640040;
+        static const int TimerStarted_HASH = 1321622940;
+        static const int StartTimerFailed_HASH = 1463694912;
+        static const int TimerFired_HASH = -663455543;
+        static const int TimerCanceled_HASH = 875629278;
+        static const int CancelTimerFailed_HASH = 403704040;
+        static const int StartChildWorkflowExecutionInitiated_HASH = -284437396;
+        static const int StartChildWorkflowExecutionFailed_HASH = 1648564316;
+        static const int ChildWorkflowExecutionStarted_HASH = -1500359356;
+        static const int ChildWorkflowExecutionCompleted_HASH = 1989535310;
+        static const int ChildWorkflowExecutionFailed_HASH = -299345126;
+        static const int ChildWorkflowExecutionTimedOut_HASH = 1634751540;
+        static const int ChildWorkflowExecutionCanceled_HASH = -706475978;
+        static const int ChildWorkflowExecutionTerminated_HASH = 778444416;
+        static const int SignalExternalWorkflowExecutionInitiated_HASH = -1349894171;
+        static const int SignalExternalWorkflowExecutionFailed_HASH = -478410877;
+        static const int ExternalWorkflowExecutionSignaled_HASH = 729812181;
+        static const int RequestCancelExternalWorkflowExecutionInitiated_HASH = 970242726;
+        static const int RequestCancelExternalWorkflowExecutionFailed_HASH = 1561095266;
+        static const int ExternalWorkflowExecutionCancelRequested_HASH = 1185880774;
+        static const int LambdaFunctionScheduled_HASH = 625617550;
+        static const int LambdaFunctionStarted_HASH = 409775778;
+        static const int LambdaFunctionCompleted_HASH = -616603604;
+        static const int LambdaFunctionFailed_HASH = -653369860;
+        static const int LambdaFunctionTimedOut_HASH = 719398550;
+        static const int ScheduleLambdaFunctionFailed_HASH = 277861171;
+        static const int StartLambdaFunctionFailed_HASH = -1626112706;
 
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WorkflowExecutionStarted_HASH)
+          switch (hashCode)
           {
+          case WorkflowExecutionStarted_HASH:
             return EventType::WorkflowExecutionStarted;
-          }
-          else if (hashCode == WorkflowExecutionCancelRequested_HASH)
-          {
+          case WorkflowExecutionCancelRequested_HASH:
             return EventType::WorkflowExecutionCancelRequested;
-          }
-          else if (hashCode == WorkflowExecutionCompleted_HASH)
-          {
+          case WorkflowExecutionCompleted_HASH:
             return EventType::WorkflowExecutionCompleted;
-          }
-          else if (hashCode == CompleteWorkflowExecutionFailed_HASH)
-          {
+          case CompleteWorkflowExecutionFailed_HASH:
             return EventType::CompleteWorkflowExecutionFailed;
-          }
-          else if (hashCode == WorkflowExecutionFailed_HASH)
-          {
+          case WorkflowExecutionFailed_HASH:
             return EventType::WorkflowExecutionFailed;
-          }
-          else if (hashCode == FailWorkflowExecutionFailed_HASH)
-          {
+          case FailWorkflowExecutionFailed_HASH:
             return EventType::FailWorkflowExecutionFailed;
-          }
-          else if (hashCode == WorkflowExecutionTimedOut_HASH)
-          {
+          case WorkflowExecutionTimedOut_HASH:
             return EventType::WorkflowExecutionTimedOut;
-          }
-          else if (hashCode == WorkflowExecutionCanceled_HASH)
-          {
+          case WorkflowExecutionCanceled_HASH:
             return EventType::WorkflowExecutionCanceled;
-          }
-          else if (hashCode == CancelWorkflowExecutionFailed_HASH)
-          {
+          case CancelWorkflowExecutionFailed_HASH:
             return EventType::CancelWorkflowExecutionFailed;
-          }
-          else if (hashCode == WorkflowExecutionContinuedAsNew_HASH)
-          {
+          case WorkflowExecutionContinuedAsNew_HASH:
             return EventType::WorkflowExecutionContinuedAsNew;
-          }
-          else if (hashCode == ContinueAsNewWorkflowExecutionFailed_HASH)
-          {
+          case ContinueAsNewWorkflowExecutionFailed_HASH:
             return EventType::ContinueAsNewWorkflowExecutionFailed;
-          }
-          else if (hashCode == WorkflowExecutionTerminated_HASH)
-          {
+          case WorkflowExecutionTerminated_HASH:
             return EventType::WorkflowExecutionTerminated;
-          }
-          else if (hashCode == DecisionTaskScheduled_HASH)
-          {
+          case DecisionTaskScheduled_HASH:
             return EventType::DecisionTaskScheduled;
-          }
-          else if (hashCode == DecisionTaskStarted_HASH)
-          {
+          case DecisionTaskStarted_HASH:
             return EventType::DecisionTaskStarted;
-          }
-          else if (hashCode == DecisionTaskCompleted_HASH)
-          {
+          case DecisionTaskCompleted_HASH:
             return EventType::DecisionTaskCompleted;
-          }
-          else if (hashCode == DecisionTaskTimedOut_HASH)
-          {
+          case DecisionTaskTimedOut_HASH:
             return EventType::DecisionTaskTimedOut;
-          }
-          else if (hashCode == ActivityTaskScheduled_HASH)
-          {
+          case ActivityTaskScheduled_HASH:
             return EventType::ActivityTaskScheduled;
-          }
-          else if (hashCode == ScheduleActivityTaskFailed_HASH)
-          {
+          case ScheduleActivityTaskFailed_HASH:
             return EventType::ScheduleActivityTaskFailed;
-          }
-          else if (hashCode == ActivityTaskStarted_HASH)
-          {
+          case ActivityTaskStarted_HASH:
             return EventType::ActivityTaskStarted;
-          }
-          else if (hashCode == ActivityTaskCompleted_HASH)
-          {
+          case ActivityTaskCompleted_HASH:
             return EventType::ActivityTaskCompleted;
-          }
-          else if (hashCode == ActivityTaskFailed_HASH)
-          {
+          case ActivityTaskFailed_HASH:
             return EventType::ActivityTaskFailed;
-          }
-          else if (hashCode == ActivityTaskTimedOut_HASH)
-          {
+          case ActivityTaskTimedOut_HASH:
             return EventType::ActivityTaskTimedOut;
-          }
-          else if (hashCode == ActivityTaskCanceled_HASH)
-          {
+          case ActivityTaskCanceled_HASH:
             return EventType::ActivityTaskCanceled;
-          }
-          else if (hashCode == ActivityTaskCancelRequested_HASH)
-          {
+          case ActivityTaskCancelRequested_HASH:
             return EventType::ActivityTaskCancelRequested;
-          }
-          else if (hashCode == RequestCancelActivityTaskFailed_HASH)
-          {
+          case RequestCancelActivityTaskFailed_HASH:
             return EventType::RequestCancelActivityTaskFailed;
-          }
-          else if (hashCode == WorkflowExecutionSignaled_HASH)
-          {
+          case WorkflowExecutionSignaled_HASH:
             return EventType::WorkflowExecutionSignaled;
-          }
-          else if (hashCode == MarkerRecorded_HASH)
-          {
+          case MarkerRecorded_HASH:
             return EventType::MarkerRecorded;
-          }
-          else if (hashCode == RecordMarkerFailed_HASH)
-          {
+          case RecordMarkerFailed_HASH:
             return EventType::RecordMarkerFailed;
-          }
-          else if (hashCode == TimerStarted_HASH)
-          {
+          case TimerStarted_HASH:
             return EventType::TimerStarted;
-          }
-          else if (hashCode == StartTimerFailed_HASH)
-          {
+          case StartTimerFailed_HASH:
             return EventType::StartTimerFailed;
-          }
-          else if (hashCode == TimerFired_HASH)
-          {
+          case TimerFired_HASH:
             return EventType::TimerFired;
-          }
-          else if (hashCode == TimerCanceled_HASH)
-          {
+          case TimerCanceled_HASH:
             return EventType::TimerCanceled;
-          }
-          else if (hashCode == CancelTimerFailed_HASH)
-          {
+          case CancelTimerFailed_HASH:
             return EventType::CancelTimerFailed;
-          }
-          else if (hashCode == StartChildWorkflowExecutionInitiated_HASH)
-          {
+          case StartChildWorkflowExecutionInitiated_HASH:
             return EventType::StartChildWorkflowExecutionInitiated;
-          }
-          else if (hashCode == StartChildWorkflowExecutionFailed_HASH)
-          {
+          case StartChildWorkflowExecutionFailed_HASH:
             return EventType::StartChildWorkflowExecutionFailed;
-          }
-          else if (hashCode == ChildWorkflowExecutionStarted_HASH)
-          {
+          case ChildWorkflowExecutionStarted_HASH:
             return EventType::ChildWorkflowExecutionStarted;
-          }
-          else if (hashCode == ChildWorkflowExecutionCompleted_HASH)
-          {
+          case ChildWorkflowExecutionCompleted_HASH:
             return EventType::ChildWorkflowExecutionCompleted;
-          }
-          else if (hashCode == ChildWorkflowExecutionFailed_HASH)
-          {
+          case ChildWorkflowExecutionFailed_HASH:
             return EventType::ChildWorkflowExecutionFailed;
-          }
-          else if (hashCode == ChildWorkflowExecutionTimedOut_HASH)
-          {
+          case ChildWorkflowExecutionTimedOut_HASH:
             return EventType::ChildWorkflowExecutionTimedOut;
-          }
-          else if (hashCode == ChildWorkflowExecutionCanceled_HASH)
-          {
+          case ChildWorkflowExecutionCanceled_HASH:
             return EventType::ChildWorkflowExecutionCanceled;
-          }
-          else if (hashCode == ChildWorkflowExecutionTerminated_HASH)
-          {
+          case ChildWorkflowExecutionTerminated_HASH:
             return EventType::ChildWorkflowExecutionTerminated;
-          }
-          else if (hashCode == SignalExternalWorkflowExecutionInitiated_HASH)
-          {
+          case SignalExternalWorkflowExecutionInitiated_HASH:
             return EventType::SignalExternalWorkflowExecutionInitiated;
-          }
-          else if (hashCode == SignalExternalWorkflowExecutionFailed_HASH)
-          {
+          case SignalExternalWorkflowExecutionFailed_HASH:
             return EventType::SignalExternalWorkflowExecutionFailed;
-          }
-          else if (hashCode == ExternalWorkflowExecutionSignaled_HASH)
-          {
+          case ExternalWorkflowExecutionSignaled_HASH:
             return EventType::ExternalWorkflowExecutionSignaled;
-          }
-          else if (hashCode == RequestCancelExternalWorkflowExecutionInitiated_HASH)
-          {
+          case RequestCancelExternalWorkflowExecutionInitiated_HASH:
             return EventType::RequestCancelExternalWorkflowExecutionInitiated;
-          }
-          else if (hashCode == RequestCancelExternalWorkflowExecutionFailed_HASH)
-          {
+          case RequestCancelExternalWorkflowExecutionFailed_HASH:
             return EventType::RequestCancelExternalWorkflowExecutionFailed;
-          }
-          else if (hashCode == ExternalWorkflowExecutionCancelRequested_HASH)
-          {
+          case ExternalWorkflowExecutionCancelRequested_HASH:
             return EventType::ExternalWorkflowExecutionCancelRequested;
-          }
-          else if (hashCode == LambdaFunctionScheduled_HASH)
-          {
+          case LambdaFunctionScheduled_HASH:
             return EventType::LambdaFunctionScheduled;
-          }
-          else if (hashCode == LambdaFunctionStarted_HASH)
-          {
+          case LambdaFunctionStarted_HASH:
             return EventType::LambdaFunctionStarted;
-          }
-          else if (hashCode == LambdaFunctionCompleted_HASH)
-          {
+          case LambdaFunctionCompleted_HASH:
             return EventType::LambdaFunctionCompleted;
-          }
-          else if (hashCode == LambdaFunctionFailed_HASH)
-          {
+          case LambdaFunctionFailed_HASH:
             return EventType::LambdaFunctionFailed;
-          }
-          else if (hashCode == LambdaFunctionTimedOut_HASH)
-          {
+          case LambdaFunctionTimedOut_HASH:
             return EventType::LambdaFunctionTimedOut;
-          }
-          else if (hashCode == ScheduleLambdaFunctionFailed_HASH)
-          {
+          case ScheduleLambdaFunctionFailed_HASH:
             return EventType::ScheduleLambdaFunctionFailed;
-          }
-          else if (hashCode == StartLambdaFunctionFailed_HASH)
-          {
+          case StartLambdaFunctionFailed_HASH:
             return EventType::StartLambdaFunctionFailed;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
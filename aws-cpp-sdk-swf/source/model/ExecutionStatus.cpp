@@ -29,21 +29,29 @@ namespace Aws
       namespace ExecutionStatusMapper
       {
 
-        static const int OPEN_HASH = HashingUtils::HashString("OPEN");
-        static const int CLOSED_HASH = HashingUtils::HashString("CLOSED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int OPEN_HASH = 2432586;
+        static const int CLOSED_HASH = 1990776172;
 
 
         ExecutionStatus GetExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OPEN_HASH)
+          switch (hashCode)
           {
+          case OPEN_HASH:
             return ExecutionStatus::OPEN;
-          }
-          else if (hashCode == CLOSED_HASH)
-          {
+          case CLOSED_HASH:
             return ExecutionStatus::CLOSED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
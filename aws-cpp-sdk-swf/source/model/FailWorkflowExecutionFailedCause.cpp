@@ -29,21 +29,29 @@ namespace Aws
       namespace FailWorkflowExecutionFailedCauseMapper
       {
 
-        static const int UNHANDLED_DECISION_HASH = HashingUtils::HashString("UNHANDLED_DECISION");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int UNHANDLED_DECISION_HASH = -369760712;
+        static const int OPERATION_NOT_PERMITTED_HASH = 1767122548;
 
 
         FailWorkflowExecutionFailedCause GetFailWorkflowExecutionFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNHANDLED_DECISION_HASH)
+          switch (hashCode)
           {
+          case UNHANDLED_DECISION_HASH:
             return FailWorkflowExecutionFailedCause::UNHANDLED_DECISION;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
-          {
+          case OPERATION_NOT_PERMITTED_HASH:
             return FailWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
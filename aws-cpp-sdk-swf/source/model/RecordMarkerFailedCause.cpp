@@ -29,16 +29,26 @@ namespace Aws
       namespace RecordMarkerFailedCauseMapper
       {
 
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int OPERATION_NOT_PERMITTED_HASH = 1767122548;
 
 
         RecordMarkerFailedCause GetRecordMarkerFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OPERATION_NOT_PERMITTED_HASH)
+          switch (hashCode)
           {
+          case OPERATION_NOT_PERMITTED_HASH:
             return RecordMarkerFailedCause::OPERATION_NOT_PERMITTED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
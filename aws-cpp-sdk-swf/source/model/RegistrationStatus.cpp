@@ -29,21 +29,29 @@ namespace Aws
       namespace RegistrationStatusMapper
       {
 
-        static const int REGISTERED_HASH = HashingUtils::HashString("REGISTERED");
-        static const int DEPRECATED_HASH = HashingUtils::HashString("DEPRECATED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int REGISTERED_HASH = -1384838526;
+        static const int DEPRECATED_HASH = -1147252301;
 
 
         RegistrationStatus GetRegistrationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGISTERED_HASH)
+          switch (hashCode)
           {
+          case REGISTERED_HASH:
             return RegistrationStatus::REGISTERED;
-          }
-          else if (hashCode == DEPRECATED_HASH)
-          {
+          case DEPRECATED_HASH:
             return RegistrationStatus::DEPRECATED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,66 +29,56 @@ namespace Aws
       namespace ScheduleActivityTaskFailedCauseMapper
       {
 
-        static const int ACTIVITY_TYPE_DEPRECATED_HASH = HashingUtils::HashString("ACTIVITY_TYPE_DEPRECATED");
-        static const int ACTIVITY_TYPE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ACTIVITY_TYPE_DOES_NOT_EXIST");
-        static const int ACTIVITY_ID_ALREADY_IN_USE_HASH = HashingUtils::HashString("ACTIVITY_ID_ALREADY_IN_USE");
-        static const int OPEN_ACTIVITIES_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OPEN_ACTIVITIES_LIMIT_EXCEEDED");
-        static const int ACTIVITY_CREATION_RATE_EXCEEDED_HASH = HashingUtils::HashString("ACTIVITY_CREATION_RATE_EXCEEDED");
-        static const int DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_TASK_LIST_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_TASK_LIST_UNDEFINED");
-        static const int DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ACTIVITY_TYPE_DEPRECATED_HASH = 1934324392;
+        static const int ACTIVITY_TYPE_DOES_NOT_EXIST_HASH = -1070685574;
+        static const int ACTIVITY_ID_ALREADY_IN_USE_HASH = -764417112;
+        static const int OPEN_ACTIVITIES_LIMIT_EXCEEDED_HASH = 436124756;
+        static const int ACTIVITY_CREATION_RATE_EXCEEDED_HASH = -304249438;
+        static const int DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = -1069556015;
+        static const int DEFAULT_TASK_LIST_UNDEFINED_HASH = -123805269;
+        static const int DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED_HASH = 209960635;
+        static const int DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = -342148158;
+        static const int DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED_HASH = 788555249;
+        static const int OPERATION_NOT_PERMITTED_HASH = 1767122548;
 
 
         ScheduleActivityTaskFailedCause GetScheduleActivityTaskFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVITY_TYPE_DEPRECATED_HASH)
+          switch (hashCode)
           {
+          case ACTIVITY_TYPE_DEPRECATED_HASH:
             return ScheduleActivityTaskFailedCause::ACTIVITY_TYPE_DEPRECATED;
-          }
-          else if (hashCode == ACTIVITY_TYPE_DOES_NOT_EXIST_HASH)
-          {
+          case ACTIVITY_TYPE_DOES_NOT_EXIST_HASH:
             return ScheduleActivityTaskFailedCause::ACTIVITY_TYPE_DOES_NOT_EXIST;
-          }
-          else if (hashCode == ACTIVITY_ID_ALREADY_IN_USE_HASH)
-          {
+          case ACTIVITY_ID_ALREADY_IN_USE_HASH:
             return ScheduleActivityTaskFailedCause::ACTIVITY_ID_ALREADY_IN_USE;
-          }
-          else if (hashCode == OPEN_ACTIVITIES_LIMIT_EXCEEDED_HASH)
-          {
+          case OPEN_ACTIVITIES_LIMIT_EXCEEDED_HASH:
             return ScheduleActivityTaskFailedCause::OPEN_ACTIVITIES_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == ACTIVITY_CREATION_RATE_EXCEEDED_HASH)
-          {
+          case ACTIVITY_CREATION_RATE_EXCEEDED_HASH:
             return ScheduleActivityTaskFailedCause::ACTIVITY_CREATION_RATE_EXCEEDED;
-          }
-          else if (hashCode == DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
+          case DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED_HASH:
             return ScheduleActivityTaskFailedCause::DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_TASK_LIST_UNDEFINED_HASH)
-          {
+          case DEFAULT_TASK_LIST_UNDEFINED_HASH:
             return ScheduleActivityTaskFailedCause::DEFAULT_TASK_LIST_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED_HASH)
-          {
+          case DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED_HASH:
             return ScheduleActivityTaskFailedCause::DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
+          case DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH:
             return ScheduleActivityTaskFailedCause::DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED_HASH)
-          {
+          case DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED_HASH:
             return ScheduleActivityTaskFailedCause::DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
-          {
+          case OPERATION_NOT_PERMITTED_HASH:
             return ScheduleActivityTaskFailedCause::OPERATION_NOT_PERMITTED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,31 +29,35 @@ namespace Aws
       namespace ScheduleLambdaFunctionFailedCauseMapper
       {
 
-        static const int ID_ALREADY_IN_USE_HASH = HashingUtils::HashString("ID_ALREADY_IN_USE");
-        static const int OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED");
-        static const int LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED_HASH = HashingUtils::HashString("LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED");
-        static const int LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION_HASH = HashingUtils::HashString("LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ID_ALREADY_IN_USE_HASH = -1393417000;
+        static const int OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED_HASH = -583228354;
+        static const int LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED_HASH = 21647937;
+        static const int LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION_HASH = 578301322;
 
 
         ScheduleLambdaFunctionFailedCause GetScheduleLambdaFunctionFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ID_ALREADY_IN_USE_HASH)
+          switch (hashCode)
           {
+          case ID_ALREADY_IN_USE_HASH:
             return ScheduleLambdaFunctionFailedCause::ID_ALREADY_IN_USE;
-          }
-          else if (hashCode == OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED_HASH)
-          {
+          case OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED_HASH:
             return ScheduleLambdaFunctionFailedCause::OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED_HASH)
-          {
+          case LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED_HASH:
             return ScheduleLambdaFunctionFailedCause::LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED;
-          }
-          else if (hashCode == LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION_HASH)
-          {
+          case LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION_HASH:
             return ScheduleLambdaFunctionFailedCause::LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,66 +29,56 @@ namespace Aws
       namespace StartChildWorkflowExecutionFailedCauseMapper
       {
 
-        static const int WORKFLOW_TYPE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("WORKFLOW_TYPE_DOES_NOT_EXIST");
-        static const int WORKFLOW_TYPE_DEPRECATED_HASH = HashingUtils::HashString("WORKFLOW_TYPE_DEPRECATED");
-        static const int OPEN_CHILDREN_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OPEN_CHILDREN_LIMIT_EXCEEDED");
-        static const int OPEN_WORKFLOWS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OPEN_WORKFLOWS_LIMIT_EXCEEDED");
-        static const int CHILD_CREATION_RATE_EXCEEDED_HASH = HashingUtils::HashString("CHILD_CREATION_RATE_EXCEEDED");
-        static const int WORKFLOW_ALREADY_RUNNING_HASH = HashingUtils::HashString("WORKFLOW_ALREADY_RUNNING");
-        static const int DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_TASK_LIST_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_TASK_LIST_UNDEFINED");
-        static const int DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_CHILD_POLICY_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_CHILD_POLICY_UNDEFINED");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int WORKFLOW_TYPE_DOES_NOT_EXIST_HASH = -1957867734;
+        static const int WORKFLOW_TYPE_DEPRECATED_HASH = 412874584;
+        static const int OPEN_CHILDREN_LIMIT_EXCEEDED_HASH = 856262338;
+        static const int OPEN_WORKFLOWS_LIMIT_EXCEEDED_HASH = -13720841;
+        static const int CHILD_CREATION_RATE_EXCEEDED_HASH = 1315082517;
+        static const int WORKFLOW_ALREADY_RUNNING_HASH = 650218520;
+        static const int DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = -1173928279;
+        static const int DEFAULT_TASK_LIST_UNDEFINED_HASH = -123805269;
+        static const int DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = -718320320;
+        static const int DEFAULT_CHILD_POLICY_UNDEFINED_HASH = -317730012;
+        static const int OPERATION_NOT_PERMITTED_HASH = 1767122548;
 
 
         StartChildWorkflowExecutionFailedCause GetStartChildWorkflowExecutionFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WORKFLOW_TYPE_DOES_NOT_EXIST_HASH)
+          switch (hashCode)
           {
+          case WORKFLOW_TYPE_DOES_NOT_EXIST_HASH:
             return StartChildWorkflowExecutionFailedCause::WORKFLOW_TYPE_DOES_NOT_EXIST;
-          }
-          else if (hashCode == WORKFLOW_TYPE_DEPRECATED_HASH)
-          {
+          case WORKFLOW_TYPE_DEPRECATED_HASH:
             return StartChildWorkflowExecutionFailedCause::WORKFLOW_TYPE_DEPRECATED;
-          }
-          else if (hashCode == OPEN_CHILDREN_LIMIT_EXCEEDED_HASH)
-          {
+          case OPEN_CHILDREN_LIMIT_EXCEEDED_HASH:
             return StartChildWorkflowExecutionFailedCause::OPEN_CHILDREN_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == OPEN_WORKFLOWS_LIMIT_EXCEEDED_HASH)
-          {
+          case OPEN_WORKFLOWS_LIMIT_EXCEEDED_HASH:
             return StartChildWorkflowExecutionFailedCause::OPEN_WORKFLOWS_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == CHILD_CREATION_RATE_EXCEEDED_HASH)
-          {
+          case CHILD_CREATION_RATE_EXCEEDED_HASH:
             return StartChildWorkflowExecutionFailedCause::CHILD_CREATION_RATE_EXCEEDED;
-          }
-          else if (hashCode == WORKFLOW_ALREADY_RUNNING_HASH)
-          {
+          case WORKFLOW_ALREADY_RUNNING_HASH:
             return StartChildWorkflowExecutionFailedCause::WORKFLOW_ALREADY_RUNNING;
-          }
-          else if (hashCode == DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
+          case DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH:
             return StartChildWorkflowExecutionFailedCause::DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_TASK_LIST_UNDEFINED_HASH)
-          {
+          case DEFAULT_TASK_LIST_UNDEFINED_HASH:
             return StartChildWorkflowExecutionFailedCause::DEFAULT_TASK_LIST_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
+          case DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH:
             return StartChildWorkflowExecutionFailedCause::DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_CHILD_POLICY_UNDEFINED_HASH)
-          {
+          case DEFAULT_CHILD_POLICY_UNDEFINED_HASH:
             return StartChildWorkflowExecutionFailedCause::DEFAULT_CHILD_POLICY_UNDEFINED;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
-          {
+          case OPERATION_NOT_PERMITTED_HASH:
             return StartChildWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
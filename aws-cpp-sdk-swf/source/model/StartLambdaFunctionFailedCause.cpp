@@ -29,16 +29,26 @@ namespace Aws
       namespace StartLambdaFunctionFailedCauseMapper
       {
 
-        static const int ASSUME_ROLE_FAILED_HASH = HashingUtils::HashString("ASSUME_ROLE_FAILED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int ASSUME_ROLE_FAILED_HASH = 1354504979;
 
 
         StartLambdaFunctionFailedCause GetStartLambdaFunctionFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASSUME_ROLE_FAILED_HASH)
+          switch (hashCode)
           {
+          case ASSUME_ROLE_FAILED_HASH:
             return StartLambdaFunctionFailedCause::ASSUME_ROLE_FAILED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,31 +29,35 @@ namespace Aws
       namespace StartTimerFailedCauseMapper
       {
 
-        static const int TIMER_ID_ALREADY_IN_USE_HASH = HashingUtils::HashString("TIMER_ID_ALREADY_IN_USE");
-        static const int OPEN_TIMERS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OPEN_TIMERS_LIMIT_EXCEEDED");
-        static const int TIMER_CREATION_RATE_EXCEEDED_HASH = HashingUtils::HashString("TIMER_CREATION_RATE_EXCEEDED");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int TIMER_ID_ALREADY_IN_USE_HASH = 1823571518;
+        static const int OPEN_TIMERS_LIMIT_EXCEEDED_HASH = 1439256019;
+        static const int TIMER_CREATION_RATE_EXCEEDED_HASH = -1212276532;
+        static const int OPERATION_NOT_PERMITTED_HASH = 1767122548;
 
 
         StartTimerFailedCause GetStartTimerFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TIMER_ID_ALREADY_IN_USE_HASH)
+          switch (hashCode)
           {
+          case TIMER_ID_ALREADY_IN_USE_HASH:
             return StartTimerFailedCause::TIMER_ID_ALREADY_IN_USE;
-          }
-          else if (hashCode == OPEN_TIMERS_LIMIT_EXCEEDED_HASH)
-          {
+          case OPEN_TIMERS_LIMIT_EXCEEDED_HASH:
             return StartTimerFailedCause::OPEN_TIMERS_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == TIMER_CREATION_RATE_EXCEEDED_HASH)
-          {
+          case TIMER_CREATION_RATE_EXCEEDED_HASH:
             return StartTimerFailedCause::TIMER_CREATION_RATE_EXCEEDED;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
-          {
+          case OPERATION_NOT_PERMITTED_HASH:
             return StartTimerFailedCause::OPERATION_NOT_PERMITTED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,16 +29,26 @@ namespace Aws
       namespace WorkflowExecutionCancelRequestedCauseMapper
       {
 
-        static const int CHILD_POLICY_APPLIED_HASH = HashingUtils::HashString("CHILD_POLICY_APPLIED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CHILD_POLICY_APPLIED_HASH = -1421736973;
 
 
         WorkflowExecutionCancelRequestedCause GetWorkflowExecutionCancelRequestedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHILD_POLICY_APPLIED_HASH)
+          switch (hashCode)
           {
+          case CHILD_POLICY_APPLIED_HASH:
             return WorkflowExecutionCancelRequestedCause::CHILD_POLICY_APPLIED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace WorkflowExecutionTerminatedCauseMapper
       {
 
-        static const int CHILD_POLICY_APPLIED_HASH = HashingUtils::HashString("CHILD_POLICY_APPLIED");
-        static const int EVENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("EVENT_LIMIT_EXCEEDED");
-        static const int OPERATOR_INITIATED_HASH = HashingUtils::HashString("OPERATOR_INITIATED");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CHILD_POLICY_APPLIED_HASH = -1421736973;
+        static const int EVENT_LIMIT_EXCEEDED_HASH = 447221724;
+        static const int OPERATOR_INITIATED_HASH = 1586915056;
 
 
         WorkflowExecutionTerminatedCause GetWorkflowExecutionTerminatedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHILD_POLICY_APPLIED_HASH)
+          switch (hashCode)
           {
+          case CHILD_POLICY_APPLIED_HASH:
             return WorkflowExecutionTerminatedCause::CHILD_POLICY_APPLIED;
-          }
-          else if (hashCode == EVENT_LIMIT_EXCEEDED_HASH)
-          {
+          case EVENT_LIMIT_EXCEEDED_HASH:
             return WorkflowExecutionTerminatedCause::EVENT_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == OPERATOR_INITIATED_HASH)
-          {
+          case OPERATOR_INITIATED_HASH:
             return WorkflowExecutionTerminatedCause::OPERATOR_INITIATED;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -59,6 +59,9 @@
 #include <aws/waf/model/UpdateWebACLResult.h>
 #include <aws/waf/model/UpdateXssMatchSetResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -372,6 +375,18 @@ namespace Model
          */
         virtual void CreateByteMatchSetAsync(const Model::CreateByteMatchSetRequest& request, const CreateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateByteMatchSetCallable(const Model::CreateByteMatchSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateByteMatchSetOutcomeCallable CreateByteMatchSetCallable(Model::CreateByteMatchSetRequest&& request) const;
+
+        /**
+         * Same as CreateByteMatchSetAsync(const Model::CreateByteMatchSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateByteMatchSetAsync(Model::CreateByteMatchSetRequest&& request, const CreateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an <a>IPSet</a>, which you use to specify which web requests you want
          * to allow or block based on the IP addresses that the requests originate from.
@@ -439,6 +454,18 @@ namespace Model
          */
         virtual void CreateIPSetAsync(const Model::CreateIPSetRequest& request, const CreateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateIPSetCallable(const Model::CreateIPSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateIPSetOutcomeCallable CreateIPSetCallable(Model::CreateIPSetRequest&& request) const;
+
+        /**
+         * Same as CreateIPSetAsync(const Model::CreateIPSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateIPSetAsync(Model::CreateIPSetRequest&& request, const CreateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <code>Rule</code>, which contains the <code>IPSet</code> objects,
          * <code>ByteMatchSet</code> objects, and other predicates that identify the
@@ -539,6 +566,18 @@ namespace Model
          */
         virtual void CreateRuleAsync(const Model::CreateRuleRequest& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRuleCallable(const Model::CreateRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateRuleOutcomeCallable CreateRuleCallable(Model::CreateRuleRequest&& request) const;
+
+        /**
+         * Same as CreateRuleAsync(const Model::CreateRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateRuleAsync(Model::CreateRuleRequest&& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <code>SizeConstraintSet</code>. You then use
          * <a>UpdateSizeConstraintSet</a> to identify the part of a web request that you
@@ -615,6 +654,18 @@ namespace Model
          */
         virtual void CreateSizeConstraintSetAsync(const Model::CreateSizeConstraintSetRequest& request, const CreateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSizeConstraintSetCallable(const Model::CreateSizeConstraintSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateSizeConstraintSetOutcomeCallable CreateSizeConstraintSetCallable(Model::CreateSizeConstraintSetRequest&& request) const;
+
+        /**
+         * Same as CreateSizeConstraintSetAsync(const Model::CreateSizeConstraintSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateSizeConstraintSetAsync(Model::CreateSizeConstraintSetRequest&& request, const CreateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <a>SqlInjectionMatchSet</a>, which you use to allow, block, or
          * count requests that contain snippets of SQL code in a specified part of web
@@ -679,6 +730,18 @@ namespace Model
          */
         virtual void CreateSqlInjectionMatchSetAsync(const Model::CreateSqlInjectionMatchSetRequest& request, const CreateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSqlInjectionMatchSetCallable(const Model::CreateSqlInjectionMatchSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateSqlInjectionMatchSetOutcomeCallable CreateSqlInjectionMatchSetCallable(Model::CreateSqlInjectionMatchSetRequest&& request) const;
+
+        /**
+         * Same as CreateSqlInjectionMatchSetAsync(const Model::CreateSqlInjectionMatchSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateSqlInjectionMatchSetAsync(Model::CreateSqlInjectionMatchSetRequest&& request, const CreateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <code>WebACL</code>, which contains the <code>Rules</code> that
          * identify the CloudFront web requests that you want to allow, block, or count.
@@ -773,6 +836,18 @@ namespace Model
          */
         virtual void CreateWebACLAsync(const Model::CreateWebACLRequest& request, const CreateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateWebACLCallable(const Model::CreateWebACLRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateWebACLOutcomeCallable CreateWebACLCallable(Model::CreateWebACLRequest&& request) const;
+
+        /**
+         * Same as CreateWebACLAsync(const Model::CreateWebACLRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateWebACLAsync(Model::CreateWebACLRequest&& request, const CreateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an <a>XssMatchSet</a>, which you use to allow, block, or count
          * requests that contain cross-site scripting attacks in the specified part of web
@@ -837,6 +912,18 @@ namespace Model
          */
         virtual void CreateXssMatchSetAsync(const Model::CreateXssMatchSetRequest& request, const CreateXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateXssMatchSetCallable(const Model::CreateXssMatchSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateXssMatchSetOutcomeCallable CreateXssMatchSetCallable(Model::CreateXssMatchSetRequest&& request) const;
+
+        /**
+         * Same as CreateXssMatchSetAsync(const Model::CreateXssMatchSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateXssMatchSetAsync(Model::CreateXssMatchSetRequest&& request, const CreateXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes a <a>ByteMatchSet</a>. You can't delete a
          * <code>ByteMatchSet</code> if it's still used in any <code>Rules</code> or if it
@@ -886,6 +973,18 @@ namespace Model
          */
         virtual void DeleteByteMatchSetAsync(const Model::DeleteByteMatchSetRequest& request, const DeleteByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteByteMatchSetCallable(const Model::DeleteByteMatchSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteByteMatchSetOutcomeCallable DeleteByteMatchSetCallable(Model::DeleteByteMatchSetRequest&& request) const;
+
+        /**
+         * Same as DeleteByteMatchSetAsync(const Model::DeleteByteMatchSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteByteMatchSetAsync(Model::DeleteByteMatchSetRequest&& request, const DeleteByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes an <a>IPSet</a>. You can't delete an <code>IPSet</code>
          * if it's still used in any <code>Rules</code> or if it still includes any IP
@@ -932,6 +1031,18 @@ namespace Model
          */
         virtual void DeleteIPSetAsync(const Model::DeleteIPSetRequest& request, const DeleteIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIPSetCallable(const Model::DeleteIPSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteIPSetOutcomeCallable DeleteIPSetCallable(Model::DeleteIPSetRequest&& request) const;
+
+        /**
+         * Same as DeleteIPSetAsync(const Model::DeleteIPSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteIPSetAsync(Model::DeleteIPSetRequest&& request, const DeleteIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes a <a>Rule</a>. You can't delete a <code>Rule</code> if
          * it's still used in any <code>WebACL</code> objects or if it still includes any
@@ -978,6 +1089,18 @@ namespace Model
          */
         virtual void DeleteRuleAsync(const Model::DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRuleCallable(const Model::DeleteRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteRuleOutcomeCallable DeleteRuleCallable(Model::DeleteRuleRequest&& request) const;
+
+        /**
+         * Same as DeleteRuleAsync(const Model::DeleteRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteRuleAsync(Model::DeleteRuleRequest&& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes a <a>SizeConstraintSet</a>. You can't delete a
          * <code>SizeConstraintSet</code> if it's still used in any <code>Rules</code> or
@@ -1030,6 +1153,18 @@ namespace Model
          */
         virtual void DeleteSizeConstraintSetAsync(const Model::DeleteSizeConstraintSetRequest& request, const DeleteSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSizeConstraintSetCallable(const Model::DeleteSizeConstraintSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteSizeConstraintSetOutcomeCallable DeleteSizeConstraintSetCallable(Model::DeleteSizeConstraintSetRequest&& request) const;
+
+        /**
+         * Same as DeleteSizeConstraintSetAsync(const Model::DeleteSizeConstraintSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteSizeConstraintSetAsync(Model::DeleteSizeConstraintSetRequest&& request, const DeleteSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes a <a>SqlInjectionMatchSet</a>. You can't delete a
          * <code>SqlInjectionMatchSet</code> if it's still used in any <code>Rules</code>
@@ -1082,6 +1217,18 @@ namespace Model
          */
         virtual void DeleteSqlInjectionMatchSetAsync(const Model::DeleteSqlInjectionMatchSetRequest& request, const DeleteSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSqlInjectionMatchSetCallable(const Model::DeleteSqlInjectionMatchSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteSqlInjectionMatchSetOutcomeCallable DeleteSqlInjectionMatchSetCallable(Model::DeleteSqlInjectionMatchSetRequest&& request) const;
+
+        /**
+         * Same as DeleteSqlInjectionMatchSetAsync(const Model::DeleteSqlInjectionMatchSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteSqlInjectionMatchSetAsync(Model::DeleteSqlInjectionMatchSetRequest&& request, const DeleteSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes a <a>WebACL</a>. You can't delete a <code>WebACL</code>
          * if it still contains any <code>Rules</code>.</p> <p>To delete a
@@ -1122,6 +1269,18 @@ namespace Model
          */
         virtual void DeleteWebACLAsync(const Model::DeleteWebACLRequest& request, const DeleteWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteWebACLCallable(const Model::DeleteWebACLRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteWebACLOutcomeCallable DeleteWebACLCallable(Model::DeleteWebACLRequest&& request) const;
+
+        /**
+         * Same as DeleteWebACLAsync(const Model::DeleteWebACLRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteWebACLAsync(Model::DeleteWebACLRequest&& request, const DeleteWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes an <a>XssMatchSet</a>. You can't delete an
          * <code>XssMatchSet</code> if it's still used in any <code>Rules</code> or if it
@@ -1171,6 +1330,18 @@ namespace Model
          */
         virtual void DeleteXssMatchSetAsync(const Model::DeleteXssMatchSetRequest& request, const DeleteXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteXssMatchSetCallable(const Model::DeleteXssMatchSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteXssMatchSetOutcomeCallable DeleteXssMatchSetCallable(Model::DeleteXssMatchSetRequest&& request) const;
+
+        /**
+         * Same as DeleteXssMatchSetAsync(const Model::DeleteXssMatchSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteXssMatchSetAsync(Model::DeleteXssMatchSetRequest&& request, const DeleteXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the <a>ByteMatchSet</a> specified by <code>ByteMatchSetId</code>.</p>
          */
@@ -1190,6 +1361,18 @@ namespace Model
          */
         virtual void GetByteMatchSetAsync(const Model::GetByteMatchSetRequest& request, const GetByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetByteMatchSetCallable(const Model::GetByteMatchSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetByteMatchSetOutcomeCallable GetByteMatchSetCallable(Model::GetByteMatchSetRequest&& request) const;
+
+        /**
+         * Same as GetByteMatchSetAsync(const Model::GetByteMatchSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetByteMatchSetAsync(Model::GetByteMatchSetRequest&& request, const GetByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>When you want to create, update, or delete AWS WAF objects, get a change
          * token and include the change token in the create, update, or delete request.
@@ -1245,6 +1428,18 @@ namespace Model
          */
         virtual void GetChangeTokenAsync(const Model::GetChangeTokenRequest& request, const GetChangeTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetChangeTokenCallable(const Model::GetChangeTokenRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetChangeTokenOutcomeCallable GetChangeTokenCallable(Model::GetChangeTokenRequest&& request) const;
+
+        /**
+         * Same as GetChangeTokenAsync(const Model::GetChangeTokenRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetChangeTokenAsync(Model::GetChangeTokenRequest&& request, const GetChangeTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the status of a <code>ChangeToken</code> that you got by calling
          * <a>GetChangeToken</a>. <code>ChangeTokenStatus</code> is one of the following
@@ -1282,6 +1477,18 @@ namespace Model
          */
         virtual void GetChangeTokenStatusAsync(const Model::GetChangeTokenStatusRequest& request, const GetChangeTokenStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetChangeTokenStatusCallable(const Model::GetChangeTokenStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetChangeTokenStatusOutcomeCallable GetChangeTokenStatusCallable(Model::GetChangeTokenStatusRequest&& request) const;
+
+        /**
+         * Same as GetChangeTokenStatusAsync(const Model::GetChangeTokenStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetChangeTokenStatusAsync(Model::GetChangeTokenStatusRequest&& request, const GetChangeTokenStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the <a>IPSet</a> that is specified by <code>IPSetId</code>.</p>
          */
@@ -1301,6 +1508,18 @@ namespace Model
          */
         virtual void GetIPSetAsync(const Model::GetIPSetRequest& request, const GetIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIPSetCallable(const Model::GetIPSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetIPSetOutcomeCallable GetIPSetCallable(Model::GetIPSetRequest&& request) const;
+
+        /**
+         * Same as GetIPSetAsync(const Model::GetIPSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetIPSetAsync(Model::GetIPSetRequest&& request, const GetIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the <a>Rule</a> that is specified by the <code>RuleId</code> that you
          * included in the <code>GetRule</code> request.</p>
@@ -1323,6 +1542,18 @@ namespace Model
          */
         virtual void GetRuleAsync(const Model::GetRuleRequest& request, const GetRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRuleCallable(const Model::GetRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetRuleOutcomeCallable GetRuleCallable(Model::GetRuleRequest&& request) const;
+
+        /**
+         * Same as GetRuleAsync(const Model::GetRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetRuleAsync(Model::GetRuleRequest&& request, const GetRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets detailed information about a specified number of requests--a
          * sample--that AWS WAF randomly selects from among the first 5,000 requests that
@@ -1369,6 +1600,18 @@ namespace Model
          */
         virtual void GetSampledRequestsAsync(const Model::GetSampledRequestsRequest& request, const GetSampledRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSampledRequestsCallable(const Model::GetSampledRequestsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetSampledRequestsOutcomeCallable GetSampledRequestsCallable(Model::GetSampledRequestsRequest&& request) const;
+
+        /**
+         * Same as GetSampledRequestsAsync(const Model::GetSampledRequestsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetSampledRequestsAsync(Model::GetSampledRequestsRequest&& request, const GetSampledRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the <a>SizeConstraintSet</a> specified by
          * <code>SizeConstraintSetId</code>.</p>
@@ -1391,6 +1634,18 @@ namespace Model
          */
         virtual void GetSizeConstraintSetAsync(const Model::GetSizeConstraintSetRequest& request, const GetSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSizeConstraintSetCallable(const Model::GetSizeConstraintSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetSizeConstraintSetOutcomeCallable GetSizeConstraintSetCallable(Model::GetSizeConstraintSetRequest&& request) const;
+
+        /**
+         * Same as GetSizeConstraintSetAsync(const Model::GetSizeConstraintSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetSizeConstraintSetAsync(Model::GetSizeConstraintSetRequest&& request, const GetSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the <a>SqlInjectionMatchSet</a> that is specified by
          * <code>SqlInjectionMatchSetId</code>.</p>
@@ -1413,6 +1668,18 @@ namespace Model
          */
         virtual void GetSqlInjectionMatchSetAsync(const Model::GetSqlInjectionMatchSetRequest& request, const GetSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSqlInjectionMatchSetCallable(const Model::GetSqlInjectionMatchSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetSqlInjectionMatchSetOutcomeCallable GetSqlInjectionMatchSetCallable(Model::GetSqlInjectionMatchSetRequest&& request) const;
+
+        /**
+         * Same as GetSqlInjectionMatchSetAsync(const Model::GetSqlInjectionMatchSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetSqlInjectionMatchSetAsync(Model::GetSqlInjectionMatchSetRequest&& request, const GetSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the <a>WebACL</a> that is specified by <code>WebACLId</code>.</p>
          */
@@ -1432,6 +1699,18 @@ namespace Model
          */
         virtual void GetWebACLAsync(const Model::GetWebACLRequest& request, const GetWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetWebACLCallable(const Model::GetWebACLRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetWebACLOutcomeCallable GetWebACLCallable(Model::GetWebACLRequest&& request) const;
+
+        /**
+         * Same as GetWebACLAsync(const Model::GetWebACLRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetWebACLAsync(Model::GetWebACLRequest&& request, const GetWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the <a>XssMatchSet</a> that is specified by
          * <code>XssMatchSetId</code>.</p>
@@ -1454,6 +1733,18 @@ namespace Model
          */
         virtual void GetXssMatchSetAsync(const Model::GetXssMatchSetRequest& request, const GetXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetXssMatchSetCallable(const Model::GetXssMatchSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::GetXssMatchSetOutcomeCallable GetXssMatchSetCallable(Model::GetXssMatchSetRequest&& request) const;
+
+        /**
+         * Same as GetXssMatchSetAsync(const Model::GetXssMatchSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void GetXssMatchSetAsync(Model::GetXssMatchSetRequest&& request, const GetXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of <a>ByteMatchSetSummary</a> objects.</p>
          */
@@ -1473,6 +1764,18 @@ namespace Model
          */
         virtual void ListByteMatchSetsAsync(const Model::ListByteMatchSetsRequest& request, const ListByteMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListByteMatchSetsCallable(const Model::ListByteMatchSetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListByteMatchSetsOutcomeCallable ListByteMatchSetsCallable(Model::ListByteMatchSetsRequest&& request) const;
+
+        /**
+         * Same as ListByteMatchSetsAsync(const Model::ListByteMatchSetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListByteMatchSetsAsync(Model::ListByteMatchSetsRequest&& request, const ListByteMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of <a>IPSetSummary</a> objects in the response.</p>
          */
@@ -1492,6 +1795,18 @@ namespace Model
          */
         virtual void ListIPSetsAsync(const Model::ListIPSetsRequest& request, const ListIPSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListIPSetsCallable(const Model::ListIPSetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListIPSetsOutcomeCallable ListIPSetsCallable(Model::ListIPSetsRequest&& request) const;
+
+        /**
+         * Same as ListIPSetsAsync(const Model::ListIPSetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListIPSetsAsync(Model::ListIPSetsRequest&& request, const ListIPSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of <a>RuleSummary</a> objects.</p>
          */
@@ -1511,6 +1826,18 @@ namespace Model
          */
         virtual void ListRulesAsync(const Model::ListRulesRequest& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRulesCallable(const Model::ListRulesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListRulesOutcomeCallable ListRulesCallable(Model::ListRulesRequest&& request) const;
+
+        /**
+         * Same as ListRulesAsync(const Model::ListRulesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListRulesAsync(Model::ListRulesRequest&& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of <a>SizeConstraintSetSummary</a> objects.</p>
          */
@@ -1530,6 +1857,18 @@ namespace Model
          */
         virtual void ListSizeConstraintSetsAsync(const Model::ListSizeConstraintSetsRequest& request, const ListSizeConstraintSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSizeConstraintSetsCallable(const Model::ListSizeConstraintSetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListSizeConstraintSetsOutcomeCallable ListSizeConstraintSetsCallable(Model::ListSizeConstraintSetsRequest&& request) const;
+
+        /**
+         * Same as ListSizeConstraintSetsAsync(const Model::ListSizeConstraintSetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListSizeConstraintSetsAsync(Model::ListSizeConstraintSetsRequest&& request, const ListSizeConstraintSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of <a>SqlInjectionMatchSet</a> objects.</p>
          */
@@ -1549,6 +1888,18 @@ namespace Model
          */
         virtual void ListSqlInjectionMatchSetsAsync(const Model::ListSqlInjectionMatchSetsRequest& request, const ListSqlInjectionMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSqlInjectionMatchSetsCallable(const Model::ListSqlInjectionMatchSetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListSqlInjectionMatchSetsOutcomeCallable ListSqlInjectionMatchSetsCallable(Model::ListSqlInjectionMatchSetsRequest&& request) const;
+
+        /**
+         * Same as ListSqlInjectionMatchSetsAsync(const Model::ListSqlInjectionMatchSetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListSqlInjectionMatchSetsAsync(Model::ListSqlInjectionMatchSetsRequest&& request, const ListSqlInjectionMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of <a>WebACLSummary</a> objects in the response.</p>
          */
@@ -1568,6 +1919,18 @@ namespace Model
          */
         virtual void ListWebACLsAsync(const Model::ListWebACLsRequest& request, const ListWebACLsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListWebACLsCallable(const Model::ListWebACLsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListWebACLsOutcomeCallable ListWebACLsCallable(Model::ListWebACLsRequest&& request) const;
+
+        /**
+         * Same as ListWebACLsAsync(const Model::ListWebACLsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListWebACLsAsync(Model::ListWebACLsRequest&& request, const ListWebACLsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of <a>XssMatchSet</a> objects.</p>
          */
@@ -1587,6 +1950,18 @@ namespace Model
          */
         virtual void ListXssMatchSetsAsync(const Model::ListXssMatchSetsRequest& request, const ListXssMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListXssMatchSetsCallable(const Model::ListXssMatchSetsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ListXssMatchSetsOutcomeCallable ListXssMatchSetsCallable(Model::ListXssMatchSetsRequest&& request) const;
+
+        /**
+         * Same as ListXssMatchSetsAsync(const Model::ListXssMatchSetsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ListXssMatchSetsAsync(Model::ListXssMatchSetsRequest&& request, const ListXssMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Inserts or deletes <a>ByteMatchTuple</a> objects (filters) in a
          * <a>ByteMatchSet</a>. For each <code>ByteMatchTuple</code> object, you specify
@@ -1684,6 +2059,18 @@ namespace Model
          */
         virtual void UpdateByteMatchSetAsync(const Model::UpdateByteMatchSetRequest& request, const UpdateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateByteMatchSetCallable(const Model::UpdateByteMatchSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateByteMatchSetOutcomeCallable UpdateByteMatchSetCallable(Model::UpdateByteMatchSetRequest&& request) const;
+
+        /**
+         * Same as UpdateByteMatchSetAsync(const Model::UpdateByteMatchSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateByteMatchSetAsync(Model::UpdateByteMatchSetRequest&& request, const UpdateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Inserts or deletes <a>IPSetDescriptor</a> objects in an <code>IPSet</code>.
          * For each <code>IPSetDescriptor</code> object, you specify the following values:
@@ -1790,6 +2177,18 @@ namespace Model
          */
         virtual void UpdateIPSetAsync(const Model::UpdateIPSetRequest& request, const UpdateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateIPSetCallable(const Model::UpdateIPSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateIPSetOutcomeCallable UpdateIPSetCallable(Model::UpdateIPSetRequest&& request) const;
+
+        /**
+         * Same as UpdateIPSetAsync(const Model::UpdateIPSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateIPSetAsync(Model::UpdateIPSetRequest&& request, const UpdateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Inserts or deletes <a>Predicate</a> objects in a <code>Rule</code>. Each
          * <code>Predicate</code> object identifies a predicate, such as a
@@ -1887,6 +2286,18 @@ namespace Model
          */
         virtual void UpdateRuleAsync(const Model::UpdateRuleRequest& request, const UpdateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateRuleCallable(const Model::UpdateRuleRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateRuleOutcomeCallable UpdateRuleCallable(Model::UpdateRuleRequest&& request) const;
+
+        /**
+         * Same as UpdateRuleAsync(const Model::UpdateRuleRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateRuleAsync(Model::UpdateRuleRequest&& request, const UpdateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Inserts or deletes <a>SizeConstraint</a> objects (filters) in a
          * <a>SizeConstraintSet</a>. For each <code>SizeConstraint</code> object, you
@@ -1993,6 +2404,18 @@ namespace Model
          */
         virtual void UpdateSizeConstraintSetAsync(const Model::UpdateSizeConstraintSetRequest& request, const UpdateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateSizeConstraintSetCallable(const Model::UpdateSizeConstraintSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateSizeConstraintSetOutcomeCallable UpdateSizeConstraintSetCallable(Model::UpdateSizeConstraintSetRequest&& request) const;
+
+        /**
+         * Same as UpdateSizeConstraintSetAsync(const Model::UpdateSizeConstraintSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateSizeConstraintSetAsync(Model::UpdateSizeConstraintSetRequest&& request, const UpdateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Inserts or deletes <a>SqlInjectionMatchTuple</a> objects (filters) in a
          * <a>SqlInjectionMatchSet</a>. For each <code>SqlInjectionMatchTuple</code>
@@ -2084,6 +2507,18 @@ namespace Model
          */
         virtual void UpdateSqlInjectionMatchSetAsync(const Model::UpdateSqlInjectionMatchSetRequest& request, const UpdateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateSqlInjectionMatchSetCallable(const Model::UpdateSqlInjectionMatchSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateSqlInjectionMatchSetOutcomeCallable UpdateSqlInjectionMatchSetCallable(Model::UpdateSqlInjectionMatchSetRequest&& request) const;
+
+        /**
+         * Same as UpdateSqlInjectionMatchSetAsync(const Model::UpdateSqlInjectionMatchSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateSqlInjectionMatchSetAsync(Model::UpdateSqlInjectionMatchSetRequest&& request, const UpdateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Inserts or deletes <a>ActivatedRule</a> objects in a <code>WebACL</code>.
          * Each <code>Rule</code> identifies web requests that you want to allow, block, or
@@ -2217,6 +2652,18 @@ namespace Model
          */
         virtual void UpdateWebACLAsync(const Model::UpdateWebACLRequest& request, const UpdateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateWebACLCallable(const Model::UpdateWebACLRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateWebACLOutcomeCallable UpdateWebACLCallable(Model::UpdateWebACLRequest&& request) const;
+
+        /**
+         * Same as UpdateWebACLAsync(const Model::UpdateWebACLRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateWebACLAsync(Model::UpdateWebACLRequest&& request, const UpdateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Inserts or deletes <a>XssMatchTuple</a> objects (filters) in an
          * <a>XssMatchSet</a>. For each <code>XssMatchTuple</code> object, you specify the
@@ -2305,6 +2752,245 @@ namespace Model
          */
         virtual void UpdateXssMatchSetAsync(const Model::UpdateXssMatchSetRequest& request, const UpdateXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateXssMatchSetCallable(const Model::UpdateXssMatchSetRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::UpdateXssMatchSetOutcomeCallable UpdateXssMatchSetCallable(Model::UpdateXssMatchSetRequest&& request) const;
+
+        /**
+         * Same as UpdateXssMatchSetAsync(const Model::UpdateXssMatchSetRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void UpdateXssMatchSetAsync(Model::UpdateXssMatchSetRequest&& request, const UpdateXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through ListByteMatchSets(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<WAFClient, Model::ListByteMatchSetsRequest, Model::ListByteMatchSetsOutcome> ListByteMatchSetsPaginator(const Model::ListByteMatchSetsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListIPSets(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<WAFClient, Model::ListIPSetsRequest, Model::ListIPSetsOutcome> ListIPSetsPaginator(const Model::ListIPSetsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListRules(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<WAFClient, Model::ListRulesRequest, Model::ListRulesOutcome> ListRulesPaginator(const Model::ListRulesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListSizeConstraintSets(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<WAFClient, Model::ListSizeConstraintSetsRequest, Model::ListSizeConstraintSetsOutcome> ListSizeConstraintSetsPaginator(const Model::ListSizeConstraintSetsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListSqlInjectionMatchSets(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<WAFClient, Model::ListSqlInjectionMatchSetsRequest, Model::ListSqlInjectionMatchSetsOutcome> ListSqlInjectionMatchSetsPaginator(const Model::ListSqlInjectionMatchSetsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListWebACLs(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<WAFClient, Model::ListWebACLsRequest, Model::ListWebACLsOutcome> ListWebACLsPaginator(const Model::ListWebACLsRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through ListXssMatchSets(), following NextMarker; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<WAFClient, Model::ListXssMatchSetsRequest, Model::ListXssMatchSetsOutcome> ListXssMatchSetsPaginator(const Model::ListXssMatchSetsRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CreateByteMatchSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::CreateByteMatchSetRequest, Model::CreateByteMatchSetOutcome> CreateByteMatchSetAwaitable(Model::CreateByteMatchSetRequest request) const;
+
+        /**
+         * co_await-able form of CreateIPSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::CreateIPSetRequest, Model::CreateIPSetOutcome> CreateIPSetAwaitable(Model::CreateIPSetRequest request) const;
+
+        /**
+         * co_await-able form of CreateRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::CreateRuleRequest, Model::CreateRuleOutcome> CreateRuleAwaitable(Model::CreateRuleRequest request) const;
+
+        /**
+         * co_await-able form of CreateSizeConstraintSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::CreateSizeConstraintSetRequest, Model::CreateSizeConstraintSetOutcome> CreateSizeConstraintSetAwaitable(Model::CreateSizeConstraintSetRequest request) const;
+
+        /**
+         * co_await-able form of CreateSqlInjectionMatchSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::CreateSqlInjectionMatchSetRequest, Model::CreateSqlInjectionMatchSetOutcome> CreateSqlInjectionMatchSetAwaitable(Model::CreateSqlInjectionMatchSetRequest request) const;
+
+        /**
+         * co_await-able form of CreateWebACL(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::CreateWebACLRequest, Model::CreateWebACLOutcome> CreateWebACLAwaitable(Model::CreateWebACLRequest request) const;
+
+        /**
+         * co_await-able form of CreateXssMatchSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::CreateXssMatchSetRequest, Model::CreateXssMatchSetOutcome> CreateXssMatchSetAwaitable(Model::CreateXssMatchSetRequest request) const;
+
+        /**
+         * co_await-able form of DeleteByteMatchSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::DeleteByteMatchSetRequest, Model::DeleteByteMatchSetOutcome> DeleteByteMatchSetAwaitable(Model::DeleteByteMatchSetRequest request) const;
+
+        /**
+         * co_await-able form of DeleteIPSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::DeleteIPSetRequest, Model::DeleteIPSetOutcome> DeleteIPSetAwaitable(Model::DeleteIPSetRequest request) const;
+
+        /**
+         * co_await-able form of DeleteRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::DeleteRuleRequest, Model::DeleteRuleOutcome> DeleteRuleAwaitable(Model::DeleteRuleRequest request) const;
+
+        /**
+         * co_await-able form of DeleteSizeConstraintSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::DeleteSizeConstraintSetRequest, Model::DeleteSizeConstraintSetOutcome> DeleteSizeConstraintSetAwaitable(Model::DeleteSizeConstraintSetRequest request) const;
+
+        /**
+         * co_await-able form of DeleteSqlInjectionMatchSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::DeleteSqlInjectionMatchSetRequest, Model::DeleteSqlInjectionMatchSetOutcome> DeleteSqlInjectionMatchSetAwaitable(Model::DeleteSqlInjectionMatchSetRequest request) const;
+
+        /**
+         * co_await-able form of DeleteWebACL(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::DeleteWebACLRequest, Model::DeleteWebACLOutcome> DeleteWebACLAwaitable(Model::DeleteWebACLRequest request) const;
+
+        /**
+         * co_await-able form of DeleteXssMatchSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::DeleteXssMatchSetRequest, Model::DeleteXssMatchSetOutcome> DeleteXssMatchSetAwaitable(Model::DeleteXssMatchSetRequest request) const;
+
+        /**
+         * co_await-able form of GetByteMatchSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::GetByteMatchSetRequest, Model::GetByteMatchSetOutcome> GetByteMatchSetAwaitable(Model::GetByteMatchSetRequest request) const;
+
+        /**
+         * co_await-able form of GetChangeToken(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::GetChangeTokenRequest, Model::GetChangeTokenOutcome> GetChangeTokenAwaitable(Model::GetChangeTokenRequest request) const;
+
+        /**
+         * co_await-able form of GetChangeTokenStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::GetChangeTokenStatusRequest, Model::GetChangeTokenStatusOutcome> GetChangeTokenStatusAwaitable(Model::GetChangeTokenStatusRequest request) const;
+
+        /**
+         * co_await-able form of GetIPSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::GetIPSetRequest, Model::GetIPSetOutcome> GetIPSetAwaitable(Model::GetIPSetRequest request) const;
+
+        /**
+         * co_await-able form of GetRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::GetRuleRequest, Model::GetRuleOutcome> GetRuleAwaitable(Model::GetRuleRequest request) const;
+
+        /**
+         * co_await-able form of GetSampledRequests(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::GetSampledRequestsRequest, Model::GetSampledRequestsOutcome> GetSampledRequestsAwaitable(Model::GetSampledRequestsRequest request) const;
+
+        /**
+         * co_await-able form of GetSizeConstraintSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::GetSizeConstraintSetRequest, Model::GetSizeConstraintSetOutcome> GetSizeConstraintSetAwaitable(Model::GetSizeConstraintSetRequest request) const;
+
+        /**
+         * co_await-able form of GetSqlInjectionMatchSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::GetSqlInjectionMatchSetRequest, Model::GetSqlInjectionMatchSetOutcome> GetSqlInjectionMatchSetAwaitable(Model::GetSqlInjectionMatchSetRequest request) const;
+
+        /**
+         * co_await-able form of GetWebACL(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::GetWebACLRequest, Model::GetWebACLOutcome> GetWebACLAwaitable(Model::GetWebACLRequest request) const;
+
+        /**
+         * co_await-able form of GetXssMatchSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::GetXssMatchSetRequest, Model::GetXssMatchSetOutcome> GetXssMatchSetAwaitable(Model::GetXssMatchSetRequest request) const;
+
+        /**
+         * co_await-able form of ListByteMatchSets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::ListByteMatchSetsRequest, Model::ListByteMatchSetsOutcome> ListByteMatchSetsAwaitable(Model::ListByteMatchSetsRequest request) const;
+
+        /**
+         * co_await-able form of ListIPSets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::ListIPSetsRequest, Model::ListIPSetsOutcome> ListIPSetsAwaitable(Model::ListIPSetsRequest request) const;
+
+        /**
+         * co_await-able form of ListRules(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::ListRulesRequest, Model::ListRulesOutcome> ListRulesAwaitable(Model::ListRulesRequest request) const;
+
+        /**
+         * co_await-able form of ListSizeConstraintSets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::ListSizeConstraintSetsRequest, Model::ListSizeConstraintSetsOutcome> ListSizeConstraintSetsAwaitable(Model::ListSizeConstraintSetsRequest request) const;
+
+        /**
+         * co_await-able form of ListSqlInjectionMatchSets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::ListSqlInjectionMatchSetsRequest, Model::ListSqlInjectionMatchSetsOutcome> ListSqlInjectionMatchSetsAwaitable(Model::ListSqlInjectionMatchSetsRequest request) const;
+
+        /**
+         * co_await-able form of ListWebACLs(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::ListWebACLsRequest, Model::ListWebACLsOutcome> ListWebACLsAwaitable(Model::ListWebACLsRequest request) const;
+
+        /**
+         * co_await-able form of ListXssMatchSets(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::ListXssMatchSetsRequest, Model::ListXssMatchSetsOutcome> ListXssMatchSetsAwaitable(Model::ListXssMatchSetsRequest request) const;
+
+        /**
+         * co_await-able form of UpdateByteMatchSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::UpdateByteMatchSetRequest, Model::UpdateByteMatchSetOutcome> UpdateByteMatchSetAwaitable(Model::UpdateByteMatchSetRequest request) const;
+
+        /**
+         * co_await-able form of UpdateIPSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::UpdateIPSetRequest, Model::UpdateIPSetOutcome> UpdateIPSetAwaitable(Model::UpdateIPSetRequest request) const;
+
+        /**
+         * co_await-able form of UpdateRule(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::UpdateRuleRequest, Model::UpdateRuleOutcome> UpdateRuleAwaitable(Model::UpdateRuleRequest request) const;
+
+        /**
+         * co_await-able form of UpdateSizeConstraintSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::UpdateSizeConstraintSetRequest, Model::UpdateSizeConstraintSetOutcome> UpdateSizeConstraintSetAwaitable(Model::UpdateSizeConstraintSetRequest request) const;
+
+        /**
+         * co_await-able form of UpdateSqlInjectionMatchSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::UpdateSqlInjectionMatchSetRequest, Model::UpdateSqlInjectionMatchSetOutcome> UpdateSqlInjectionMatchSetAwaitable(Model::UpdateSqlInjectionMatchSetRequest request) const;
+
+        /**
+         * co_await-able form of UpdateWebACL(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::UpdateWebACLRequest, Model::UpdateWebACLOutcome> UpdateWebACLAwaitable(Model::UpdateWebACLRequest request) const;
+
+        /**
+         * co_await-able form of UpdateXssMatchSet(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WAFClient, Model::UpdateXssMatchSetRequest, Model::UpdateXssMatchSetOutcome> UpdateXssMatchSetAwaitable(Model::UpdateXssMatchSetRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
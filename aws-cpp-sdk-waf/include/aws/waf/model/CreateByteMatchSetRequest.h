@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateByteMatchSetRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateByteMatchSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
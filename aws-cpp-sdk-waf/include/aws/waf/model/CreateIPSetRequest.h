@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateIPSetRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateIPSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
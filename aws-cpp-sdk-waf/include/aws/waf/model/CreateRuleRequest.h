@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateRule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     CreateSizeConstraintSetRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateSizeConstraintSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
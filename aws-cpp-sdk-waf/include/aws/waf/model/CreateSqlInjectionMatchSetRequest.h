@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateSqlInjectionMatchSetRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateSqlInjectionMatchSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
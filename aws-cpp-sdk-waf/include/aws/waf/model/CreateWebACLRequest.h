@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateWebACLRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateWebACL"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     CreateXssMatchSetRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateXssMatchSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
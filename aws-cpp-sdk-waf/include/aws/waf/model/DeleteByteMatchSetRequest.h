@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteByteMatchSetRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteByteMatchSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
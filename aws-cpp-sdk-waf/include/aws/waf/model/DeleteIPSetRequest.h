@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteIPSetRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteIPSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
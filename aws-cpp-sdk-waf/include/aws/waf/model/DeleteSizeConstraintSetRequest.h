@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteSizeConstraintSetRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteSizeConstraintSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteSqlInjectionMatchSetRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteSqlInjectionMatchSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     DeleteWebACLRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteWebACL"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
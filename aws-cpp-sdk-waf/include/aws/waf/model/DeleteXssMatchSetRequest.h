@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DeleteXssMatchSetRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteXssMatchSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
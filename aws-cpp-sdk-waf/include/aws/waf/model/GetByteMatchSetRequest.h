@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetByteMatchSetRequest();
+    inline const char* GetServiceRequestName() const override { return "GetByteMatchSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
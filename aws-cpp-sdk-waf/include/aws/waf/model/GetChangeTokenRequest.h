@@ -29,6 +29,8 @@ namespace Model
   {
   public:
     GetChangeTokenRequest();
+    inline const char* GetServiceRequestName() const override { return "GetChangeToken"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
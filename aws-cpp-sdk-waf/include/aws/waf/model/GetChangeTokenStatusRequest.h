@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetChangeTokenStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "GetChangeTokenStatus"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetIPSetRequest();
+    inline const char* GetServiceRequestName() const override { return "GetIPSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
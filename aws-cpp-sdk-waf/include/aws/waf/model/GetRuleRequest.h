@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "GetRule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetSampledRequestsRequest();
+    inline const char* GetServiceRequestName() const override { return "GetSampledRequests"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetSizeConstraintSetRequest();
+    inline const char* GetServiceRequestName() const override { return "GetSizeConstraintSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetSqlInjectionMatchSetRequest();
+    inline const char* GetServiceRequestName() const override { return "GetSqlInjectionMatchSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
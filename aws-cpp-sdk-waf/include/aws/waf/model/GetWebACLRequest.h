@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     GetWebACLRequest();
+    inline const char* GetServiceRequestName() const override { return "GetWebACL"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     GetXssMatchSetRequest();
+    inline const char* GetServiceRequestName() const override { return "GetXssMatchSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListByteMatchSetsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListByteMatchSets"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
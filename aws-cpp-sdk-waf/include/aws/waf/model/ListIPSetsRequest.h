@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListIPSetsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListIPSets"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
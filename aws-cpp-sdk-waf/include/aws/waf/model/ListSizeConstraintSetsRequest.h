@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListSizeConstraintSetsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListSizeConstraintSets"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListSqlInjectionMatchSetsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListSqlInjectionMatchSets"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -30,6 +30,8 @@ namespace Model
   {
   public:
     ListWebACLsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListWebACLs"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     ListXssMatchSetsRequest();
+    inline const char* GetServiceRequestName() const override { return "ListXssMatchSets"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
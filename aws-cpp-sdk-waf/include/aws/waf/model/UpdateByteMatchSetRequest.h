@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateByteMatchSetRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateByteMatchSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateIPSetRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateIPSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateRuleRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateRule"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
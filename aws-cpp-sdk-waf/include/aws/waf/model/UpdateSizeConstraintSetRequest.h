@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     UpdateSizeConstraintSetRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateSizeConstraintSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
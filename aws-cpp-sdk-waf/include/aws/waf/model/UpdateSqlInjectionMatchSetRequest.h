@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateSqlInjectionMatchSetRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateSqlInjectionMatchSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
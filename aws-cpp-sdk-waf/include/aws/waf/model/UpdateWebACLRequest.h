@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateWebACLRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateWebACL"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
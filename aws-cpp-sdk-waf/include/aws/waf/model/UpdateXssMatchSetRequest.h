@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     UpdateXssMatchSetRequest();
+    inline const char* GetServiceRequestName() const override { return "UpdateXssMatchSet"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
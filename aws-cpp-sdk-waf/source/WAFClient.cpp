@@ -147,7 +147,7 @@ CreateByteMatchSetOutcome WAFClient::CreateByteMatchSet(const CreateByteMatchSet
 
 CreateByteMatchSetOutcomeCallable WAFClient::CreateByteMatchSetCallable(const CreateByteMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateByteMatchSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateByteMatchSet(request); } );
 }
 
 void WAFClient::CreateByteMatchSetAsync(const CreateByteMatchSetRequest& request, const CreateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -155,6 +155,16 @@ void WAFClient::CreateByteMatchSetAsync(const CreateByteMatchSetRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->CreateByteMatchSetAsyncHelper( request, handler, context ); } );
 }
 
+CreateByteMatchSetOutcomeCallable WAFClient::CreateByteMatchSetCallable(CreateByteMatchSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::CreateByteMatchSet, this, std::move(request)));
+}
+
+void WAFClient::CreateByteMatchSetAsync(CreateByteMatchSetRequest&& request, const CreateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::CreateByteMatchSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::CreateByteMatchSetAsyncHelper(const CreateByteMatchSetRequest& request, const CreateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateByteMatchSet(request), context);
@@ -178,7 +188,7 @@ CreateIPSetOutcome WAFClient::CreateIPSet(const CreateIPSetRequest& request) con
 
 CreateIPSetOutcomeCallable WAFClient::CreateIPSetCallable(const CreateIPSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateIPSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateIPSet(request); } );
 }
 
 void WAFClient::CreateIPSetAsync(const CreateIPSetRequest& request, const CreateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -186,6 +196,16 @@ void WAFClient::CreateIPSetAsync(const CreateIPSetRequest& request, const Create
   m_executor->Submit( [this, request, handler, context](){ this->CreateIPSetAsyncHelper( request, handler, context ); } );
 }
 
+CreateIPSetOutcomeCallable WAFClient::CreateIPSetCallable(CreateIPSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::CreateIPSet, this, std::move(request)));
+}
+
+void WAFClient::CreateIPSetAsync(CreateIPSetRequest&& request, const CreateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::CreateIPSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::CreateIPSetAsyncHelper(const CreateIPSetRequest& request, const CreateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateIPSet(request), context);
@@ -209,7 +229,7 @@ CreateRuleOutcome WAFClient::CreateRule(const CreateRuleRequest& request) const
 
 CreateRuleOutcomeCallable WAFClient::CreateRuleCallable(const CreateRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateRule(request); } );
 }
 
 void WAFClient::CreateRuleAsync(const CreateRuleRequest& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -217,6 +237,16 @@ void WAFClient::CreateRuleAsync(const CreateRuleRequest& request, const CreateRu
   m_executor->Submit( [this, request, handler, context](){ this->CreateRuleAsyncHelper( request, handler, context ); } );
 }
 
+CreateRuleOutcomeCallable WAFClient::CreateRuleCallable(CreateRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::CreateRule, this, std::move(request)));
+}
+
+void WAFClient::CreateRuleAsync(CreateRuleRequest&& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::CreateRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::CreateRuleAsyncHelper(const CreateRuleRequest& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateRule(request), context);
@@ -240,7 +270,7 @@ CreateSizeConstraintSetOutcome WAFClient::CreateSizeConstraintSet(const CreateSi
 
 CreateSizeConstraintSetOutcomeCallable WAFClient::CreateSizeConstraintSetCallable(const CreateSizeConstraintSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateSizeConstraintSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateSizeConstraintSet(request); } );
 }
 
 void WAFClient::CreateSizeConstraintSetAsync(const CreateSizeConstraintSetRequest& request, const CreateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -248,6 +278,16 @@ void WAFClient::CreateSizeConstraintSetAsync(const CreateSizeConstraintSetReques
   m_executor->Submit( [this, request, handler, context](){ this->CreateSizeConstraintSetAsyncHelper( request, handler, context ); } );
 }
 
+CreateSizeConstraintSetOutcomeCallable WAFClient::CreateSizeConstraintSetCallable(CreateSizeConstraintSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::CreateSizeConstraintSet, this, std::move(request)));
+}
+
+void WAFClient::CreateSizeConstraintSetAsync(CreateSizeConstraintSetRequest&& request, const CreateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::CreateSizeConstraintSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::CreateSizeConstraintSetAsyncHelper(const CreateSizeConstraintSetRequest& request, const CreateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateSizeConstraintSet(request), context);
@@ -271,7 +311,7 @@ CreateSqlInjectionMatchSetOutcome WAFClient::CreateSqlInjectionMatchSet(const Cr
 
 CreateSqlInjectionMatchSetOutcomeCallable WAFClient::CreateSqlInjectionMatchSetCallable(const CreateSqlInjectionMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateSqlInjectionMatchSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateSqlInjectionMatchSet(request); } );
 }
 
 void WAFClient::CreateSqlInjectionMatchSetAsync(const CreateSqlInjectionMatchSetRequest& request, const CreateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -279,6 +319,16 @@ void WAFClient::CreateSqlInjectionMatchSetAsync(const CreateSqlInjectionMatchSet
   m_executor->Submit( [this, request, handler, context](){ this->CreateSqlInjectionMatchSetAsyncHelper( request, handler, context ); } );
 }
 
+CreateSqlInjectionMatchSetOutcomeCallable WAFClient::CreateSqlInjectionMatchSetCallable(CreateSqlInjectionMatchSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::CreateSqlInjectionMatchSet, this, std::move(request)));
+}
+
+void WAFClient::CreateSqlInjectionMatchSetAsync(CreateSqlInjectionMatchSetRequest&& request, const CreateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::CreateSqlInjectionMatchSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::CreateSqlInjectionMatchSetAsyncHelper(const CreateSqlInjectionMatchSetRequest& request, const CreateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateSqlInjectionMatchSet(request), context);
@@ -302,7 +352,7 @@ CreateWebACLOutcome WAFClient::CreateWebACL(const CreateWebACLRequest& request)
 
 CreateWebACLOutcomeCallable WAFClient::CreateWebACLCallable(const CreateWebACLRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateWebACL(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateWebACL(request); } );
 }
 
 void WAFClient::CreateWebACLAsync(const CreateWebACLRequest& request, const CreateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -310,6 +360,16 @@ void WAFClient::CreateWebACLAsync(const CreateWebACLRequest& request, const Crea
   m_executor->Submit( [this, request, handler, context](){ this->CreateWebACLAsyncHelper( request, handler, context ); } );
 }
 
+CreateWebACLOutcomeCallable WAFClient::CreateWebACLCallable(CreateWebACLRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::CreateWebACL, this, std::move(request)));
+}
+
+void WAFClient::CreateWebACLAsync(CreateWebACLRequest&& request, const CreateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::CreateWebACLAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::CreateWebACLAsyncHelper(const CreateWebACLRequest& request, const CreateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateWebACL(request), context);
@@ -333,7 +393,7 @@ CreateXssMatchSetOutcome WAFClient::CreateXssMatchSet(const CreateXssMatchSetReq
 
 CreateXssMatchSetOutcomeCallable WAFClient::CreateXssMatchSetCallable(const CreateXssMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateXssMatchSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateXssMatchSet(request); } );
 }
 
 void WAFClient::CreateXssMatchSetAsync(const CreateXssMatchSetRequest& request, const CreateXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -341,6 +401,16 @@ void WAFClient::CreateXssMatchSetAsync(const CreateXssMatchSetRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->CreateXssMatchSetAsyncHelper( request, handler, context ); } );
 }
 
+CreateXssMatchSetOutcomeCallable WAFClient::CreateXssMatchSetCallable(CreateXssMatchSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::CreateXssMatchSet, this, std::move(request)));
+}
+
+void WAFClient::CreateXssMatchSetAsync(CreateXssMatchSetRequest&& request, const CreateXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::CreateXssMatchSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::CreateXssMatchSetAsyncHelper(const CreateXssMatchSetRequest& request, const CreateXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateXssMatchSet(request), context);
@@ -364,7 +434,7 @@ DeleteByteMatchSetOutcome WAFClient::DeleteByteMatchSet(const DeleteByteMatchSet
 
 DeleteByteMatchSetOutcomeCallable WAFClient::DeleteByteMatchSetCallable(const DeleteByteMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteByteMatchSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteByteMatchSet(request); } );
 }
 
 void WAFClient::DeleteByteMatchSetAsync(const DeleteByteMatchSetRequest& request, const DeleteByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -372,6 +442,16 @@ void WAFClient::DeleteByteMatchSetAsync(const DeleteByteMatchSetRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->DeleteByteMatchSetAsyncHelper( request, handler, context ); } );
 }
 
+DeleteByteMatchSetOutcomeCallable WAFClient::DeleteByteMatchSetCallable(DeleteByteMatchSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::DeleteByteMatchSet, this, std::move(request)));
+}
+
+void WAFClient::DeleteByteMatchSetAsync(DeleteByteMatchSetRequest&& request, const DeleteByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::DeleteByteMatchSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::DeleteByteMatchSetAsyncHelper(const DeleteByteMatchSetRequest& request, const DeleteByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteByteMatchSet(request), context);
@@ -395,7 +475,7 @@ DeleteIPSetOutcome WAFClient::DeleteIPSet(const DeleteIPSetRequest& request) con
 
 DeleteIPSetOutcomeCallable WAFClient::DeleteIPSetCallable(const DeleteIPSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteIPSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteIPSet(request); } );
 }
 
 void WAFClient::DeleteIPSetAsync(const DeleteIPSetRequest& request, const DeleteIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -403,6 +483,16 @@ void WAFClient::DeleteIPSetAsync(const DeleteIPSetRequest& request, const Delete
   m_executor->Submit( [this, request, handler, context](){ this->DeleteIPSetAsyncHelper( request, handler, context ); } );
 }
 
+DeleteIPSetOutcomeCallable WAFClient::DeleteIPSetCallable(DeleteIPSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::DeleteIPSet, this, std::move(request)));
+}
+
+void WAFClient::DeleteIPSetAsync(DeleteIPSetRequest&& request, const DeleteIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::DeleteIPSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::DeleteIPSetAsyncHelper(const DeleteIPSetRequest& request, const DeleteIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteIPSet(request), context);
@@ -426,7 +516,7 @@ DeleteRuleOutcome WAFClient::DeleteRule(const DeleteRuleRequest& request) const
 
 DeleteRuleOutcomeCallable WAFClient::DeleteRuleCallable(const DeleteRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteRule(request); } );
 }
 
 void WAFClient::DeleteRuleAsync(const DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -434,6 +524,16 @@ void WAFClient::DeleteRuleAsync(const DeleteRuleRequest& request, const DeleteRu
   m_executor->Submit( [this, request, handler, context](){ this->DeleteRuleAsyncHelper( request, handler, context ); } );
 }
 
+DeleteRuleOutcomeCallable WAFClient::DeleteRuleCallable(DeleteRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::DeleteRule, this, std::move(request)));
+}
+
+void WAFClient::DeleteRuleAsync(DeleteRuleRequest&& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::DeleteRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::DeleteRuleAsyncHelper(const DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteRule(request), context);
@@ -457,7 +557,7 @@ DeleteSizeConstraintSetOutcome WAFClient::DeleteSizeConstraintSet(const DeleteSi
 
 DeleteSizeConstraintSetOutcomeCallable WAFClient::DeleteSizeConstraintSetCallable(const DeleteSizeConstraintSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteSizeConstraintSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteSizeConstraintSet(request); } );
 }
 
 void WAFClient::DeleteSizeConstraintSetAsync(const DeleteSizeConstraintSetRequest& request, const DeleteSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -465,6 +565,16 @@ void WAFClient::DeleteSizeConstraintSetAsync(const DeleteSizeConstraintSetReques
   m_executor->Submit( [this, request, handler, context](){ this->DeleteSizeConstraintSetAsyncHelper( request, handler, context ); } );
 }
 
+DeleteSizeConstraintSetOutcomeCallable WAFClient::DeleteSizeConstraintSetCallable(DeleteSizeConstraintSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::DeleteSizeConstraintSet, this, std::move(request)));
+}
+
+void WAFClient::DeleteSizeConstraintSetAsync(DeleteSizeConstraintSetRequest&& request, const DeleteSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::DeleteSizeConstraintSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::DeleteSizeConstraintSetAsyncHelper(const DeleteSizeConstraintSetRequest& request, const DeleteSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteSizeConstraintSet(request), context);
@@ -488,7 +598,7 @@ DeleteSqlInjectionMatchSetOutcome WAFClient::DeleteSqlInjectionMatchSet(const De
 
 DeleteSqlInjectionMatchSetOutcomeCallable WAFClient::DeleteSqlInjectionMatchSetCallable(const DeleteSqlInjectionMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteSqlInjectionMatchSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteSqlInjectionMatchSet(request); } );
 }
 
 void WAFClient::DeleteSqlInjectionMatchSetAsync(const DeleteSqlInjectionMatchSetRequest& request, const DeleteSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -496,6 +606,16 @@ void WAFClient::DeleteSqlInjectionMatchSetAsync(const DeleteSqlInjectionMatchSet
   m_executor->Submit( [this, request, handler, context](){ this->DeleteSqlInjectionMatchSetAsyncHelper( request, handler, context ); } );
 }
 
+DeleteSqlInjectionMatchSetOutcomeCallable WAFClient::DeleteSqlInjectionMatchSetCallable(DeleteSqlInjectionMatchSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::DeleteSqlInjectionMatchSet, this, std::move(request)));
+}
+
+void WAFClient::DeleteSqlInjectionMatchSetAsync(DeleteSqlInjectionMatchSetRequest&& request, const DeleteSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::DeleteSqlInjectionMatchSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::DeleteSqlInjectionMatchSetAsyncHelper(const DeleteSqlInjectionMatchSetRequest& request, const DeleteSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteSqlInjectionMatchSet(request), context);
@@ -519,7 +639,7 @@ DeleteWebACLOutcome WAFClient::DeleteWebACL(const DeleteWebACLRequest& request)
 
 DeleteWebACLOutcomeCallable WAFClient::DeleteWebACLCallable(const DeleteWebACLRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteWebACL(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteWebACL(request); } );
 }
 
 void WAFClient::DeleteWebACLAsync(const DeleteWebACLRequest& request, const DeleteWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -527,6 +647,16 @@ void WAFClient::DeleteWebACLAsync(const DeleteWebACLRequest& request, const Dele
   m_executor->Submit( [this, request, handler, context](){ this->DeleteWebACLAsyncHelper( request, handler, context ); } );
 }
 
+DeleteWebACLOutcomeCallable WAFClient::DeleteWebACLCallable(DeleteWebACLRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::DeleteWebACL, this, std::move(request)));
+}
+
+void WAFClient::DeleteWebACLAsync(DeleteWebACLRequest&& request, const DeleteWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::DeleteWebACLAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::DeleteWebACLAsyncHelper(const DeleteWebACLRequest& request, const DeleteWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteWebACL(request), context);
@@ -550,7 +680,7 @@ DeleteXssMatchSetOutcome WAFClient::DeleteXssMatchSet(const DeleteXssMatchSetReq
 
 DeleteXssMatchSetOutcomeCallable WAFClient::DeleteXssMatchSetCallable(const DeleteXssMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteXssMatchSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteXssMatchSet(request); } );
 }
 
 void WAFClient::DeleteXssMatchSetAsync(const DeleteXssMatchSetRequest& request, const DeleteXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -558,6 +688,16 @@ void WAFClient::DeleteXssMatchSetAsync(const DeleteXssMatchSetRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->DeleteXssMatchSetAsyncHelper( request, handler, context ); } );
 }
 
+DeleteXssMatchSetOutcomeCallable WAFClient::DeleteXssMatchSetCallable(DeleteXssMatchSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::DeleteXssMatchSet, this, std::move(request)));
+}
+
+void WAFClient::DeleteXssMatchSetAsync(DeleteXssMatchSetRequest&& request, const DeleteXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::DeleteXssMatchSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::DeleteXssMatchSetAsyncHelper(const DeleteXssMatchSetRequest& request, const DeleteXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteXssMatchSet(request), context);
@@ -581,7 +721,7 @@ GetByteMatchSetOutcome WAFClient::GetByteMatchSet(const GetByteMatchSetRequest&
 
 GetByteMatchSetOutcomeCallable WAFClient::GetByteMatchSetCallable(const GetByteMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetByteMatchSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetByteMatchSet(request); } );
 }
 
 void WAFClient::GetByteMatchSetAsync(const GetByteMatchSetRequest& request, const GetByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -589,6 +729,16 @@ void WAFClient::GetByteMatchSetAsync(const GetByteMatchSetRequest& request, cons
   m_executor->Submit( [this, request, handler, context](){ this->GetByteMatchSetAsyncHelper( request, handler, context ); } );
 }
 
+GetByteMatchSetOutcomeCallable WAFClient::GetByteMatchSetCallable(GetByteMatchSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::GetByteMatchSet, this, std::move(request)));
+}
+
+void WAFClient::GetByteMatchSetAsync(GetByteMatchSetRequest&& request, const GetByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::GetByteMatchSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::GetByteMatchSetAsyncHelper(const GetByteMatchSetRequest& request, const GetByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetByteMatchSet(request), context);
@@ -612,7 +762,7 @@ GetChangeTokenOutcome WAFClient::GetChangeToken(const GetChangeTokenRequest& req
 
 GetChangeTokenOutcomeCallable WAFClient::GetChangeTokenCallable(const GetChangeTokenRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetChangeToken(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetChangeToken(request); } );
 }
 
 void WAFClient::GetChangeTokenAsync(const GetChangeTokenRequest& request, const GetChangeTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -620,6 +770,16 @@ void WAFClient::GetChangeTokenAsync(const GetChangeTokenRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->GetChangeTokenAsyncHelper( request, handler, context ); } );
 }
 
+GetChangeTokenOutcomeCallable WAFClient::GetChangeTokenCallable(GetChangeTokenRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::GetChangeToken, this, std::move(request)));
+}
+
+void WAFClient::GetChangeTokenAsync(GetChangeTokenRequest&& request, const GetChangeTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::GetChangeTokenAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::GetChangeTokenAsyncHelper(const GetChangeTokenRequest& request, const GetChangeTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetChangeToken(request), context);
@@ -643,7 +803,7 @@ GetChangeTokenStatusOutcome WAFClient::GetChangeTokenStatus(const GetChangeToken
 
 GetChangeTokenStatusOutcomeCallable WAFClient::GetChangeTokenStatusCallable(const GetChangeTokenStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetChangeTokenStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetChangeTokenStatus(request); } );
 }
 
 void WAFClient::GetChangeTokenStatusAsync(const GetChangeTokenStatusRequest& request, const GetChangeTokenStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -651,6 +811,16 @@ void WAFClient::GetChangeTokenStatusAsync(const GetChangeTokenStatusRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->GetChangeTokenStatusAsyncHelper( request, handler, context ); } );
 }
 
+GetChangeTokenStatusOutcomeCallable WAFClient::GetChangeTokenStatusCallable(GetChangeTokenStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::GetChangeTokenStatus, this, std::move(request)));
+}
+
+void WAFClient::GetChangeTokenStatusAsync(GetChangeTokenStatusRequest&& request, const GetChangeTokenStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::GetChangeTokenStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::GetChangeTokenStatusAsyncHelper(const GetChangeTokenStatusRequest& request, const GetChangeTokenStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetChangeTokenStatus(request), context);
@@ -674,7 +844,7 @@ GetIPSetOutcome WAFClient::GetIPSet(const GetIPSetRequest& request) const
 
 GetIPSetOutcomeCallable WAFClient::GetIPSetCallable(const GetIPSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetIPSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetIPSet(request); } );
 }
 
 void WAFClient::GetIPSetAsync(const GetIPSetRequest& request, const GetIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -682,6 +852,16 @@ void WAFClient::GetIPSetAsync(const GetIPSetRequest& request, const GetIPSetResp
   m_executor->Submit( [this, request, handler, context](){ this->GetIPSetAsyncHelper( request, handler, context ); } );
 }
 
+GetIPSetOutcomeCallable WAFClient::GetIPSetCallable(GetIPSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::GetIPSet, this, std::move(request)));
+}
+
+void WAFClient::GetIPSetAsync(GetIPSetRequest&& request, const GetIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::GetIPSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::GetIPSetAsyncHelper(const GetIPSetRequest& request, const GetIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetIPSet(request), context);
@@ -705,7 +885,7 @@ GetRuleOutcome WAFClient::GetRule(const GetRuleRequest& request) const
 
 GetRuleOutcomeCallable WAFClient::GetRuleCallable(const GetRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetRule(request); } );
 }
 
 void WAFClient::GetRuleAsync(const GetRuleRequest& request, const GetRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -713,6 +893,16 @@ void WAFClient::GetRuleAsync(const GetRuleRequest& request, const GetRuleRespons
   m_executor->Submit( [this, request, handler, context](){ this->GetRuleAsyncHelper( request, handler, context ); } );
 }
 
+GetRuleOutcomeCallable WAFClient::GetRuleCallable(GetRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::GetRule, this, std::move(request)));
+}
+
+void WAFClient::GetRuleAsync(GetRuleRequest&& request, const GetRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::GetRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::GetRuleAsyncHelper(const GetRuleRequest& request, const GetRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetRule(request), context);
@@ -736,7 +926,7 @@ GetSampledRequestsOutcome WAFClient::GetSampledRequests(const GetSampledRequests
 
 GetSampledRequestsOutcomeCallable WAFClient::GetSampledRequestsCallable(const GetSampledRequestsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetSampledRequests(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetSampledRequests(request); } );
 }
 
 void WAFClient::GetSampledRequestsAsync(const GetSampledRequestsRequest& request, const GetSampledRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -744,6 +934,16 @@ void WAFClient::GetSampledRequestsAsync(const GetSampledRequestsRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->GetSampledRequestsAsyncHelper( request, handler, context ); } );
 }
 
+GetSampledRequestsOutcomeCallable WAFClient::GetSampledRequestsCallable(GetSampledRequestsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::GetSampledRequests, this, std::move(request)));
+}
+
+void WAFClient::GetSampledRequestsAsync(GetSampledRequestsRequest&& request, const GetSampledRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::GetSampledRequestsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::GetSampledRequestsAsyncHelper(const GetSampledRequestsRequest& request, const GetSampledRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetSampledRequests(request), context);
@@ -767,7 +967,7 @@ GetSizeConstraintSetOutcome WAFClient::GetSizeConstraintSet(const GetSizeConstra
 
 GetSizeConstraintSetOutcomeCallable WAFClient::GetSizeConstraintSetCallable(const GetSizeConstraintSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetSizeConstraintSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetSizeConstraintSet(request); } );
 }
 
 void WAFClient::GetSizeConstraintSetAsync(const GetSizeConstraintSetRequest& request, const GetSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -775,6 +975,16 @@ void WAFClient::GetSizeConstraintSetAsync(const GetSizeConstraintSetRequest& req
   m_executor->Submit( [this, request, handler, context](){ this->GetSizeConstraintSetAsyncHelper( request, handler, context ); } );
 }
 
+GetSizeConstraintSetOutcomeCallable WAFClient::GetSizeConstraintSetCallable(GetSizeConstraintSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::GetSizeConstraintSet, this, std::move(request)));
+}
+
+void WAFClient::GetSizeConstraintSetAsync(GetSizeConstraintSetRequest&& request, const GetSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::GetSizeConstraintSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::GetSizeConstraintSetAsyncHelper(const GetSizeConstraintSetRequest& request, const GetSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetSizeConstraintSet(request), context);
@@ -798,7 +1008,7 @@ GetSqlInjectionMatchSetOutcome WAFClient::GetSqlInjectionMatchSet(const GetSqlIn
 
 GetSqlInjectionMatchSetOutcomeCallable WAFClient::GetSqlInjectionMatchSetCallable(const GetSqlInjectionMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetSqlInjectionMatchSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetSqlInjectionMatchSet(request); } );
 }
 
 void WAFClient::GetSqlInjectionMatchSetAsync(const GetSqlInjectionMatchSetRequest& request, const GetSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -806,6 +1016,16 @@ void WAFClient::GetSqlInjectionMatchSetAsync(const GetSqlInjectionMatchSetReques
   m_executor->Submit( [this, request, handler, context](){ this->GetSqlInjectionMatchSetAsyncHelper( request, handler, context ); } );
 }
 
+GetSqlInjectionMatchSetOutcomeCallable WAFClient::GetSqlInjectionMatchSetCallable(GetSqlInjectionMatchSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::GetSqlInjectionMatchSet, this, std::move(request)));
+}
+
+void WAFClient::GetSqlInjectionMatchSetAsync(GetSqlInjectionMatchSetRequest&& request, const GetSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::GetSqlInjectionMatchSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::GetSqlInjectionMatchSetAsyncHelper(const GetSqlInjectionMatchSetRequest& request, const GetSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetSqlInjectionMatchSet(request), context);
@@ -829,7 +1049,7 @@ GetWebACLOutcome WAFClient::GetWebACL(const GetWebACLRequest& request) const
 
 GetWebACLOutcomeCallable WAFClient::GetWebACLCallable(const GetWebACLRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetWebACL(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetWebACL(request); } );
 }
 
 void WAFClient::GetWebACLAsync(const GetWebACLRequest& request, const GetWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -837,6 +1057,16 @@ void WAFClient::GetWebACLAsync(const GetWebACLRequest& request, const GetWebACLR
   m_executor->Submit( [this, request, handler, context](){ this->GetWebACLAsyncHelper( request, handler, context ); } );
 }
 
+GetWebACLOutcomeCallable WAFClient::GetWebACLCallable(GetWebACLRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::GetWebACL, this, std::move(request)));
+}
+
+void WAFClient::GetWebACLAsync(GetWebACLRequest&& request, const GetWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::GetWebACLAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::GetWebACLAsyncHelper(const GetWebACLRequest& request, const GetWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetWebACL(request), context);
@@ -860,7 +1090,7 @@ GetXssMatchSetOutcome WAFClient::GetXssMatchSet(const GetXssMatchSetRequest& req
 
 GetXssMatchSetOutcomeCallable WAFClient::GetXssMatchSetCallable(const GetXssMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->GetXssMatchSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->GetXssMatchSet(request); } );
 }
 
 void WAFClient::GetXssMatchSetAsync(const GetXssMatchSetRequest& request, const GetXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -868,6 +1098,16 @@ void WAFClient::GetXssMatchSetAsync(const GetXssMatchSetRequest& request, const
   m_executor->Submit( [this, request, handler, context](){ this->GetXssMatchSetAsyncHelper( request, handler, context ); } );
 }
 
+GetXssMatchSetOutcomeCallable WAFClient::GetXssMatchSetCallable(GetXssMatchSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::GetXssMatchSet, this, std::move(request)));
+}
+
+void WAFClient::GetXssMatchSetAsync(GetXssMatchSetRequest&& request, const GetXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::GetXssMatchSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::GetXssMatchSetAsyncHelper(const GetXssMatchSetRequest& request, const GetXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, GetXssMatchSet(request), context);
@@ -891,7 +1131,7 @@ ListByteMatchSetsOutcome WAFClient::ListByteMatchSets(const ListByteMatchSetsReq
 
 ListByteMatchSetsOutcomeCallable WAFClient::ListByteMatchSetsCallable(const ListByteMatchSetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListByteMatchSets(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListByteMatchSets(request); } );
 }
 
 void WAFClient::ListByteMatchSetsAsync(const ListByteMatchSetsRequest& request, const ListByteMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -899,6 +1139,16 @@ void WAFClient::ListByteMatchSetsAsync(const ListByteMatchSetsRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->ListByteMatchSetsAsyncHelper( request, handler, context ); } );
 }
 
+ListByteMatchSetsOutcomeCallable WAFClient::ListByteMatchSetsCallable(ListByteMatchSetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::ListByteMatchSets, this, std::move(request)));
+}
+
+void WAFClient::ListByteMatchSetsAsync(ListByteMatchSetsRequest&& request, const ListByteMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::ListByteMatchSetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::ListByteMatchSetsAsyncHelper(const ListByteMatchSetsRequest& request, const ListByteMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListByteMatchSets(request), context);
@@ -922,7 +1172,7 @@ ListIPSetsOutcome WAFClient::ListIPSets(const ListIPSetsRequest& request) const
 
 ListIPSetsOutcomeCallable WAFClient::ListIPSetsCallable(const ListIPSetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListIPSets(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListIPSets(request); } );
 }
 
 void WAFClient::ListIPSetsAsync(const ListIPSetsRequest& request, const ListIPSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -930,6 +1180,16 @@ void WAFClient::ListIPSetsAsync(const ListIPSetsRequest& request, const ListIPSe
   m_executor->Submit( [this, request, handler, context](){ this->ListIPSetsAsyncHelper( request, handler, context ); } );
 }
 
+ListIPSetsOutcomeCallable WAFClient::ListIPSetsCallable(ListIPSetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::ListIPSets, this, std::move(request)));
+}
+
+void WAFClient::ListIPSetsAsync(ListIPSetsRequest&& request, const ListIPSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::ListIPSetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::ListIPSetsAsyncHelper(const ListIPSetsRequest& request, const ListIPSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListIPSets(request), context);
@@ -953,7 +1213,7 @@ ListRulesOutcome WAFClient::ListRules(const ListRulesRequest& request) const
 
 ListRulesOutcomeCallable WAFClient::ListRulesCallable(const ListRulesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListRules(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListRules(request); } );
 }
 
 void WAFClient::ListRulesAsync(const ListRulesRequest& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -961,6 +1221,16 @@ void WAFClient::ListRulesAsync(const ListRulesRequest& request, const ListRulesR
   m_executor->Submit( [this, request, handler, context](){ this->ListRulesAsyncHelper( request, handler, context ); } );
 }
 
+ListRulesOutcomeCallable WAFClient::ListRulesCallable(ListRulesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::ListRules, this, std::move(request)));
+}
+
+void WAFClient::ListRulesAsync(ListRulesRequest&& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::ListRulesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::ListRulesAsyncHelper(const ListRulesRequest& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListRules(request), context);
@@ -984,7 +1254,7 @@ ListSizeConstraintSetsOutcome WAFClient::ListSizeConstraintSets(const ListSizeCo
 
 ListSizeConstraintSetsOutcomeCallable WAFClient::ListSizeConstraintSetsCallable(const ListSizeConstraintSetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListSizeConstraintSets(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListSizeConstraintSets(request); } );
 }
 
 void WAFClient::ListSizeConstraintSetsAsync(const ListSizeConstraintSetsRequest& request, const ListSizeConstraintSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -992,6 +1262,16 @@ void WAFClient::ListSizeConstraintSetsAsync(const ListSizeConstraintSetsRequest&
   m_executor->Submit( [this, request, handler, context](){ this->ListSizeConstraintSetsAsyncHelper( request, handler, context ); } );
 }
 
+ListSizeConstraintSetsOutcomeCallable WAFClient::ListSizeConstraintSetsCallable(ListSizeConstraintSetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::ListSizeConstraintSets, this, std::move(request)));
+}
+
+void WAFClient::ListSizeConstraintSetsAsync(ListSizeConstraintSetsRequest&& request, const ListSizeConstraintSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::ListSizeConstraintSetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::ListSizeConstraintSetsAsyncHelper(const ListSizeConstraintSetsRequest& request, const ListSizeConstraintSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListSizeConstraintSets(request), context);
@@ -1015,7 +1295,7 @@ ListSqlInjectionMatchSetsOutcome WAFClient::ListSqlInjectionMatchSets(const List
 
 ListSqlInjectionMatchSetsOutcomeCallable WAFClient::ListSqlInjectionMatchSetsCallable(const ListSqlInjectionMatchSetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListSqlInjectionMatchSets(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListSqlInjectionMatchSets(request); } );
 }
 
 void WAFClient::ListSqlInjectionMatchSetsAsync(const ListSqlInjectionMatchSetsRequest& request, const ListSqlInjectionMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1023,6 +1303,16 @@ void WAFClient::ListSqlInjectionMatchSetsAsync(const ListSqlInjectionMatchSetsRe
   m_executor->Submit( [this, request, handler, context](){ this->ListSqlInjectionMatchSetsAsyncHelper( request, handler, context ); } );
 }
 
+ListSqlInjectionMatchSetsOutcomeCallable WAFClient::ListSqlInjectionMatchSetsCallable(ListSqlInjectionMatchSetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::ListSqlInjectionMatchSets, this, std::move(request)));
+}
+
+void WAFClient::ListSqlInjectionMatchSetsAsync(ListSqlInjectionMatchSetsRequest&& request, const ListSqlInjectionMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::ListSqlInjectionMatchSetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::ListSqlInjectionMatchSetsAsyncHelper(const ListSqlInjectionMatchSetsRequest& request, const ListSqlInjectionMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListSqlInjectionMatchSets(request), context);
@@ -1046,7 +1336,7 @@ ListWebACLsOutcome WAFClient::ListWebACLs(const ListWebACLsRequest& request) con
 
 ListWebACLsOutcomeCallable WAFClient::ListWebACLsCallable(const ListWebACLsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListWebACLs(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListWebACLs(request); } );
 }
 
 void WAFClient::ListWebACLsAsync(const ListWebACLsRequest& request, const ListWebACLsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1054,6 +1344,16 @@ void WAFClient::ListWebACLsAsync(const ListWebACLsRequest& request, const ListWe
   m_executor->Submit( [this, request, handler, context](){ this->ListWebACLsAsyncHelper( request, handler, context ); } );
 }
 
+ListWebACLsOutcomeCallable WAFClient::ListWebACLsCallable(ListWebACLsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::ListWebACLs, this, std::move(request)));
+}
+
+void WAFClient::ListWebACLsAsync(ListWebACLsRequest&& request, const ListWebACLsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::ListWebACLsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::ListWebACLsAsyncHelper(const ListWebACLsRequest& request, const ListWebACLsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListWebACLs(request), context);
@@ -1077,7 +1377,7 @@ ListXssMatchSetsOutcome WAFClient::ListXssMatchSets(const ListXssMatchSetsReques
 
 ListXssMatchSetsOutcomeCallable WAFClient::ListXssMatchSetsCallable(const ListXssMatchSetsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ListXssMatchSets(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ListXssMatchSets(request); } );
 }
 
 void WAFClient::ListXssMatchSetsAsync(const ListXssMatchSetsRequest& request, const ListXssMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1085,6 +1385,16 @@ void WAFClient::ListXssMatchSetsAsync(const ListXssMatchSetsRequest& request, co
   m_executor->Submit( [this, request, handler, context](){ this->ListXssMatchSetsAsyncHelper( request, handler, context ); } );
 }
 
+ListXssMatchSetsOutcomeCallable WAFClient::ListXssMatchSetsCallable(ListXssMatchSetsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::ListXssMatchSets, this, std::move(request)));
+}
+
+void WAFClient::ListXssMatchSetsAsync(ListXssMatchSetsRequest&& request, const ListXssMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::ListXssMatchSetsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::ListXssMatchSetsAsyncHelper(const ListXssMatchSetsRequest& request, const ListXssMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ListXssMatchSets(request), context);
@@ -1108,7 +1418,7 @@ UpdateByteMatchSetOutcome WAFClient::UpdateByteMatchSet(const UpdateByteMatchSet
 
 UpdateByteMatchSetOutcomeCallable WAFClient::UpdateByteMatchSetCallable(const UpdateByteMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateByteMatchSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateByteMatchSet(request); } );
 }
 
 void WAFClient::UpdateByteMatchSetAsync(const UpdateByteMatchSetRequest& request, const UpdateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1116,6 +1426,16 @@ void WAFClient::UpdateByteMatchSetAsync(const UpdateByteMatchSetRequest& request
   m_executor->Submit( [this, request, handler, context](){ this->UpdateByteMatchSetAsyncHelper( request, handler, context ); } );
 }
 
+UpdateByteMatchSetOutcomeCallable WAFClient::UpdateByteMatchSetCallable(UpdateByteMatchSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::UpdateByteMatchSet, this, std::move(request)));
+}
+
+void WAFClient::UpdateByteMatchSetAsync(UpdateByteMatchSetRequest&& request, const UpdateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::UpdateByteMatchSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::UpdateByteMatchSetAsyncHelper(const UpdateByteMatchSetRequest& request, const UpdateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateByteMatchSet(request), context);
@@ -1139,7 +1459,7 @@ UpdateIPSetOutcome WAFClient::UpdateIPSet(const UpdateIPSetRequest& request) con
 
 UpdateIPSetOutcomeCallable WAFClient::UpdateIPSetCallable(const UpdateIPSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateIPSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateIPSet(request); } );
 }
 
 void WAFClient::UpdateIPSetAsync(const UpdateIPSetRequest& request, const UpdateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1147,6 +1467,16 @@ void WAFClient::UpdateIPSetAsync(const UpdateIPSetRequest& request, const Update
   m_executor->Submit( [this, request, handler, context](){ this->UpdateIPSetAsyncHelper( request, handler, context ); } );
 }
 
+UpdateIPSetOutcomeCallable WAFClient::UpdateIPSetCallable(UpdateIPSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::UpdateIPSet, this, std::move(request)));
+}
+
+void WAFClient::UpdateIPSetAsync(UpdateIPSetRequest&& request, const UpdateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::UpdateIPSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::UpdateIPSetAsyncHelper(const UpdateIPSetRequest& request, const UpdateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateIPSet(request), context);
@@ -1170,7 +1500,7 @@ UpdateRuleOutcome WAFClient::UpdateRule(const UpdateRuleRequest& request) const
 
 UpdateRuleOutcomeCallable WAFClient::UpdateRuleCallable(const UpdateRuleRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateRule(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateRule(request); } );
 }
 
 void WAFClient::UpdateRuleAsync(const UpdateRuleRequest& request, const UpdateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1178,6 +1508,16 @@ void WAFClient::UpdateRuleAsync(const UpdateRuleRequest& request, const UpdateRu
   m_executor->Submit( [this, request, handler, context](){ this->UpdateRuleAsyncHelper( request, handler, context ); } );
 }
 
+UpdateRuleOutcomeCallable WAFClient::UpdateRuleCallable(UpdateRuleRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::UpdateRule, this, std::move(request)));
+}
+
+void WAFClient::UpdateRuleAsync(UpdateRuleRequest&& request, const UpdateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::UpdateRuleAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::UpdateRuleAsyncHelper(const UpdateRuleRequest& request, const UpdateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateRule(request), context);
@@ -1201,7 +1541,7 @@ UpdateSizeConstraintSetOutcome WAFClient::UpdateSizeConstraintSet(const UpdateSi
 
 UpdateSizeConstraintSetOutcomeCallable WAFClient::UpdateSizeConstraintSetCallable(const UpdateSizeConstraintSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateSizeConstraintSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateSizeConstraintSet(request); } );
 }
 
 void WAFClient::UpdateSizeConstraintSetAsync(const UpdateSizeConstraintSetRequest& request, const UpdateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1209,6 +1549,16 @@ void WAFClient::UpdateSizeConstraintSetAsync(const UpdateSizeConstraintSetReques
   m_executor->Submit( [this, request, handler, context](){ this->UpdateSizeConstraintSetAsyncHelper( request, handler, context ); } );
 }
 
+UpdateSizeConstraintSetOutcomeCallable WAFClient::UpdateSizeConstraintSetCallable(UpdateSizeConstraintSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::UpdateSizeConstraintSet, this, std::move(request)));
+}
+
+void WAFClient::UpdateSizeConstraintSetAsync(UpdateSizeConstraintSetRequest&& request, const UpdateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::UpdateSizeConstraintSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::UpdateSizeConstraintSetAsyncHelper(const UpdateSizeConstraintSetRequest& request, const UpdateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateSizeConstraintSet(request), context);
@@ -1232,7 +1582,7 @@ UpdateSqlInjectionMatchSetOutcome WAFClient::UpdateSqlInjectionMatchSet(const Up
 
 UpdateSqlInjectionMatchSetOutcomeCallable WAFClient::UpdateSqlInjectionMatchSetCallable(const UpdateSqlInjectionMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateSqlInjectionMatchSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateSqlInjectionMatchSet(request); } );
 }
 
 void WAFClient::UpdateSqlInjectionMatchSetAsync(const UpdateSqlInjectionMatchSetRequest& request, const UpdateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1240,6 +1590,16 @@ void WAFClient::UpdateSqlInjectionMatchSetAsync(const UpdateSqlInjectionMatchSet
   m_executor->Submit( [this, request, handler, context](){ this->UpdateSqlInjectionMatchSetAsyncHelper( request, handler, context ); } );
 }
 
+UpdateSqlInjectionMatchSetOutcomeCallable WAFClient::UpdateSqlInjectionMatchSetCallable(UpdateSqlInjectionMatchSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::UpdateSqlInjectionMatchSet, this, std::move(request)));
+}
+
+void WAFClient::UpdateSqlInjectionMatchSetAsync(UpdateSqlInjectionMatchSetRequest&& request, const UpdateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::UpdateSqlInjectionMatchSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::UpdateSqlInjectionMatchSetAsyncHelper(const UpdateSqlInjectionMatchSetRequest& request, const UpdateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateSqlInjectionMatchSet(request), context);
@@ -1263,7 +1623,7 @@ UpdateWebACLOutcome WAFClient::UpdateWebACL(const UpdateWebACLRequest& request)
 
 UpdateWebACLOutcomeCallable WAFClient::UpdateWebACLCallable(const UpdateWebACLRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateWebACL(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateWebACL(request); } );
 }
 
 void WAFClient::UpdateWebACLAsync(const UpdateWebACLRequest& request, const UpdateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1271,6 +1631,16 @@ void WAFClient::UpdateWebACLAsync(const UpdateWebACLRequest& request, const Upda
   m_executor->Submit( [this, request, handler, context](){ this->UpdateWebACLAsyncHelper( request, handler, context ); } );
 }
 
+UpdateWebACLOutcomeCallable WAFClient::UpdateWebACLCallable(UpdateWebACLRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::UpdateWebACL, this, std::move(request)));
+}
+
+void WAFClient::UpdateWebACLAsync(UpdateWebACLRequest&& request, const UpdateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::UpdateWebACLAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::UpdateWebACLAsyncHelper(const UpdateWebACLRequest& request, const UpdateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateWebACL(request), context);
@@ -1294,7 +1664,7 @@ UpdateXssMatchSetOutcome WAFClient::UpdateXssMatchSet(const UpdateXssMatchSetReq
 
 UpdateXssMatchSetOutcomeCallable WAFClient::UpdateXssMatchSetCallable(const UpdateXssMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->UpdateXssMatchSet(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->UpdateXssMatchSet(request); } );
 }
 
 void WAFClient::UpdateXssMatchSetAsync(const UpdateXssMatchSetRequest& request, const UpdateXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1302,8 +1672,329 @@ void WAFClient::UpdateXssMatchSetAsync(const UpdateXssMatchSetRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->UpdateXssMatchSetAsyncHelper( request, handler, context ); } );
 }
 
+UpdateXssMatchSetOutcomeCallable WAFClient::UpdateXssMatchSetCallable(UpdateXssMatchSetRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WAFClient::UpdateXssMatchSet, this, std::move(request)));
+}
+
+void WAFClient::UpdateXssMatchSetAsync(UpdateXssMatchSetRequest&& request, const UpdateXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WAFClient::UpdateXssMatchSetAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WAFClient::UpdateXssMatchSetAsyncHelper(const UpdateXssMatchSetRequest& request, const UpdateXssMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, UpdateXssMatchSet(request), context);
 }
 
+Paginator<WAFClient, ListByteMatchSetsRequest, ListByteMatchSetsOutcome> WAFClient::ListByteMatchSetsPaginator(const ListByteMatchSetsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<WAFClient, ListByteMatchSetsRequest, ListByteMatchSetsOutcome>(this, &WAFClient::ListByteMatchSets, request,
+    [](const ListByteMatchSetsRequest& current, const ListByteMatchSetsOutcome& outcome, ListByteMatchSetsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetNextMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<WAFClient, ListIPSetsRequest, ListIPSetsOutcome> WAFClient::ListIPSetsPaginator(const ListIPSetsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<WAFClient, ListIPSetsRequest, ListIPSetsOutcome>(this, &WAFClient::ListIPSets, request,
+    [](const ListIPSetsRequest& current, const ListIPSetsOutcome& outcome, ListIPSetsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetNextMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<WAFClient, ListRulesRequest, ListRulesOutcome> WAFClient::ListRulesPaginator(const ListRulesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<WAFClient, ListRulesRequest, ListRulesOutcome>(this, &WAFClient::ListRules, request,
+    [](const ListRulesRequest& current, const ListRulesOutcome& outcome, ListRulesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetNextMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<WAFClient, ListSizeConstraintSetsRequest, ListSizeConstraintSetsOutcome> WAFClient::ListSizeConstraintSetsPaginator(const ListSizeConstraintSetsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<WAFClient, ListSizeConstraintSetsRequest, ListSizeConstraintSetsOutcome>(this, &WAFClient::ListSizeConstraintSets, request,
+    [](const ListSizeConstraintSetsRequest& current, const ListSizeConstraintSetsOutcome& outcome, ListSizeConstraintSetsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetNextMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<WAFClient, ListSqlInjectionMatchSetsRequest, ListSqlInjectionMatchSetsOutcome> WAFClient::ListSqlInjectionMatchSetsPaginator(const ListSqlInjectionMatchSetsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<WAFClient, ListSqlInjectionMatchSetsRequest, ListSqlInjectionMatchSetsOutcome>(this, &WAFClient::ListSqlInjectionMatchSets, request,
+    [](const ListSqlInjectionMatchSetsRequest& current, const ListSqlInjectionMatchSetsOutcome& outcome, ListSqlInjectionMatchSetsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetNextMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<WAFClient, ListWebACLsRequest, ListWebACLsOutcome> WAFClient::ListWebACLsPaginator(const ListWebACLsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<WAFClient, ListWebACLsRequest, ListWebACLsOutcome>(this, &WAFClient::ListWebACLs, request,
+    [](const ListWebACLsRequest& current, const ListWebACLsOutcome& outcome, ListWebACLsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetNextMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<WAFClient, ListXssMatchSetsRequest, ListXssMatchSetsOutcome> WAFClient::ListXssMatchSetsPaginator(const ListXssMatchSetsRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<WAFClient, ListXssMatchSetsRequest, ListXssMatchSetsOutcome>(this, &WAFClient::ListXssMatchSets, request,
+    [](const ListXssMatchSetsRequest& current, const ListXssMatchSetsOutcome& outcome, ListXssMatchSetsRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextMarker();
+      if(token.empty() || token == current.GetNextMarker())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextMarker(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<WAFClient, CreateByteMatchSetRequest, CreateByteMatchSetOutcome> WAFClient::CreateByteMatchSetAwaitable(CreateByteMatchSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::CreateByteMatchSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, CreateIPSetRequest, CreateIPSetOutcome> WAFClient::CreateIPSetAwaitable(CreateIPSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::CreateIPSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, CreateRuleRequest, CreateRuleOutcome> WAFClient::CreateRuleAwaitable(CreateRuleRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::CreateRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, CreateSizeConstraintSetRequest, CreateSizeConstraintSetOutcome> WAFClient::CreateSizeConstraintSetAwaitable(CreateSizeConstraintSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::CreateSizeConstraintSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, CreateSqlInjectionMatchSetRequest, CreateSqlInjectionMatchSetOutcome> WAFClient::CreateSqlInjectionMatchSetAwaitable(CreateSqlInjectionMatchSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::CreateSqlInjectionMatchSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, CreateWebACLRequest, CreateWebACLOutcome> WAFClient::CreateWebACLAwaitable(CreateWebACLRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::CreateWebACL, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, CreateXssMatchSetRequest, CreateXssMatchSetOutcome> WAFClient::CreateXssMatchSetAwaitable(CreateXssMatchSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::CreateXssMatchSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, DeleteByteMatchSetRequest, DeleteByteMatchSetOutcome> WAFClient::DeleteByteMatchSetAwaitable(DeleteByteMatchSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::DeleteByteMatchSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, DeleteIPSetRequest, DeleteIPSetOutcome> WAFClient::DeleteIPSetAwaitable(DeleteIPSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::DeleteIPSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, DeleteRuleRequest, DeleteRuleOutcome> WAFClient::DeleteRuleAwaitable(DeleteRuleRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::DeleteRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, DeleteSizeConstraintSetRequest, DeleteSizeConstraintSetOutcome> WAFClient::DeleteSizeConstraintSetAwaitable(DeleteSizeConstraintSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::DeleteSizeConstraintSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, DeleteSqlInjectionMatchSetRequest, DeleteSqlInjectionMatchSetOutcome> WAFClient::DeleteSqlInjectionMatchSetAwaitable(DeleteSqlInjectionMatchSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::DeleteSqlInjectionMatchSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, DeleteWebACLRequest, DeleteWebACLOutcome> WAFClient::DeleteWebACLAwaitable(DeleteWebACLRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::DeleteWebACL, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, DeleteXssMatchSetRequest, DeleteXssMatchSetOutcome> WAFClient::DeleteXssMatchSetAwaitable(DeleteXssMatchSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::DeleteXssMatchSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, GetByteMatchSetRequest, GetByteMatchSetOutcome> WAFClient::GetByteMatchSetAwaitable(GetByteMatchSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::GetByteMatchSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, GetChangeTokenRequest, GetChangeTokenOutcome> WAFClient::GetChangeTokenAwaitable(GetChangeTokenRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::GetChangeToken, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, GetChangeTokenStatusRequest, GetChangeTokenStatusOutcome> WAFClient::GetChangeTokenStatusAwaitable(GetChangeTokenStatusRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::GetChangeTokenStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, GetIPSetRequest, GetIPSetOutcome> WAFClient::GetIPSetAwaitable(GetIPSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::GetIPSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, GetRuleRequest, GetRuleOutcome> WAFClient::GetRuleAwaitable(GetRuleRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::GetRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, GetSampledRequestsRequest, GetSampledRequestsOutcome> WAFClient::GetSampledRequestsAwaitable(GetSampledRequestsRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::GetSampledRequests, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, GetSizeConstraintSetRequest, GetSizeConstraintSetOutcome> WAFClient::GetSizeConstraintSetAwaitable(GetSizeConstraintSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::GetSizeConstraintSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, GetSqlInjectionMatchSetRequest, GetSqlInjectionMatchSetOutcome> WAFClient::GetSqlInjectionMatchSetAwaitable(GetSqlInjectionMatchSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::GetSqlInjectionMatchSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, GetWebACLRequest, GetWebACLOutcome> WAFClient::GetWebACLAwaitable(GetWebACLRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::GetWebACL, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, GetXssMatchSetRequest, GetXssMatchSetOutcome> WAFClient::GetXssMatchSetAwaitable(GetXssMatchSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::GetXssMatchSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, ListByteMatchSetsRequest, ListByteMatchSetsOutcome> WAFClient::ListByteMatchSetsAwaitable(ListByteMatchSetsRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::ListByteMatchSets, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, ListIPSetsRequest, ListIPSetsOutcome> WAFClient::ListIPSetsAwaitable(ListIPSetsRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::ListIPSets, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, ListRulesRequest, ListRulesOutcome> WAFClient::ListRulesAwaitable(ListRulesRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::ListRules, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, ListSizeConstraintSetsRequest, ListSizeConstraintSetsOutcome> WAFClient::ListSizeConstraintSetsAwaitable(ListSizeConstraintSetsRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::ListSizeConstraintSets, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, ListSqlInjectionMatchSetsRequest, ListSqlInjectionMatchSetsOutcome> WAFClient::ListSqlInjectionMatchSetsAwaitable(ListSqlInjectionMatchSetsRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::ListSqlInjectionMatchSets, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, ListWebACLsRequest, ListWebACLsOutcome> WAFClient::ListWebACLsAwaitable(ListWebACLsRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::ListWebACLs, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, ListXssMatchSetsRequest, ListXssMatchSetsOutcome> WAFClient::ListXssMatchSetsAwaitable(ListXssMatchSetsRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::ListXssMatchSets, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, UpdateByteMatchSetRequest, UpdateByteMatchSetOutcome> WAFClient::UpdateByteMatchSetAwaitable(UpdateByteMatchSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::UpdateByteMatchSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, UpdateIPSetRequest, UpdateIPSetOutcome> WAFClient::UpdateIPSetAwaitable(UpdateIPSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::UpdateIPSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, UpdateRuleRequest, UpdateRuleOutcome> WAFClient::UpdateRuleAwaitable(UpdateRuleRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::UpdateRule, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, UpdateSizeConstraintSetRequest, UpdateSizeConstraintSetOutcome> WAFClient::UpdateSizeConstraintSetAwaitable(UpdateSizeConstraintSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::UpdateSizeConstraintSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, UpdateSqlInjectionMatchSetRequest, UpdateSqlInjectionMatchSetOutcome> WAFClient::UpdateSqlInjectionMatchSetAwaitable(UpdateSqlInjectionMatchSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::UpdateSqlInjectionMatchSet, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, UpdateWebACLRequest, UpdateWebACLOutcome> WAFClient::UpdateWebACLAwaitable(UpdateWebACLRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::UpdateWebACL, std::move(request) } };
+}
+
+ClientOperationAwaitable<WAFClient, UpdateXssMatchSetRequest, UpdateXssMatchSetOutcome> WAFClient::UpdateXssMatchSetAwaitable(UpdateXssMatchSetRequest request) const
+{
+  return { m_executor.get(), { this, &WAFClient::UpdateXssMatchSet, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,21 +29,29 @@ namespace Aws
       namespace ChangeActionMapper
       {
 
-        static const int INSERT_HASH = HashingUtils::HashString("INSERT");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int INSERT_HASH = -2130463047;
+        static const int DELETE__HASH = 2012838315;
 
 
         ChangeAction GetChangeActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSERT_HASH)
+          switch (hashCode)
           {
+          case INSERT_HASH:
             return ChangeAction::INSERT;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
+          case DELETE__HASH:
             return ChangeAction::DELETE_;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace ChangeTokenStatusMapper
       {
 
-        static const int PROVISIONED_HASH = HashingUtils::HashString("PROVISIONED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int INSYNC_HASH = HashingUtils::HashString("INSYNC");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PROVISIONED_HASH = 355751956;
+        static const int PENDING_HASH = 35394935;
+        static const int INSYNC_HASH = -2130443968;
 
 
         ChangeTokenStatus GetChangeTokenStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROVISIONED_HASH)
+          switch (hashCode)
           {
+          case PROVISIONED_HASH:
             return ChangeTokenStatus::PROVISIONED;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
+          case PENDING_HASH:
             return ChangeTokenStatus::PENDING;
-          }
-          else if (hashCode == INSYNC_HASH)
-          {
+          case INSYNC_HASH:
             return ChangeTokenStatus::INSYNC;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,41 +29,41 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int EQ_HASH = HashingUtils::HashString("EQ");
-        static const int NE_HASH = HashingUtils::HashString("NE");
-        static const int LE_HASH = HashingUtils::HashString("LE");
-        static const int LT_HASH = HashingUtils::HashString("LT");
-        static const int GE_HASH = HashingUtils::HashString("GE");
-        static const int GT_HASH = HashingUtils::HashString("GT");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int EQ_HASH = 2220;
+        static const int NE_HASH = 2487;
+        static const int LE_HASH = 2425;
+        static const int LT_HASH = 2440;
+        static const int GE_HASH = 2270;
+        static const int GT_HASH = 2285;
 
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQ_HASH)
+          switch (hashCode)
           {
+          case EQ_HASH:
             return ComparisonOperator::EQ;
-          }
-          else if (hashCode == NE_HASH)
-          {
+          case NE_HASH:
             return ComparisonOperator::NE;
-          }
-          else if (hashCode == LE_HASH)
-          {
+          case LE_HASH:
             return ComparisonOperator::LE;
-          }
-          else if (hashCode == LT_HASH)
-          {
+          case LT_HASH:
             return ComparisonOperator::LT;
-          }
-          else if (hashCode == GE_HASH)
-          {
+          case GE_HASH:
             return ComparisonOperator::GE;
-          }
-          else if (hashCode == GT_HASH)
-          {
+          case GT_HASH:
             return ComparisonOperator::GT;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
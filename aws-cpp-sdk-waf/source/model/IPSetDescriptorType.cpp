@@ -29,16 +29,26 @@ namespace Aws
       namespace IPSetDescriptorTypeMapper
       {
 
-        static const int IPV4_HASH = HashingUtils::HashString("IPV4");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int IPV4_HASH = 2254341;
 
 
         IPSetDescriptorType GetIPSetDescriptorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IPV4_HASH)
+          switch (hashCode)
           {
+          case IPV4_HASH:
             return IPSetDescriptorType::IPV4;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,36 +29,38 @@ namespace Aws
       namespace MatchFieldTypeMapper
       {
 
-        static const int URI_HASH = HashingUtils::HashString("URI");
-        static const int QUERY_STRING_HASH = HashingUtils::HashString("QUERY_STRING");
-        static const int HEADER_HASH = HashingUtils::HashString("HEADER");
-        static const int METHOD_HASH = HashingUtils::HashString("METHOD");
-        static const int BODY_HASH = HashingUtils::HashString("BODY");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int URI_HASH = 84300;
+        static const int QUERY_STRING_HASH = -2047040632;
+        static const int HEADER_HASH = 2127025805;
+        static const int METHOD_HASH = -2024225567;
+        static const int BODY_HASH = 2044322;
 
 
         MatchFieldType GetMatchFieldTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == URI_HASH)
+          switch (hashCode)
           {
+          case URI_HASH:
             return MatchFieldType::URI;
-          }
-          else if (hashCode == QUERY_STRING_HASH)
-          {
+          case QUERY_STRING_HASH:
             return MatchFieldType::QUERY_STRING;
-          }
-          else if (hashCode == HEADER_HASH)
-          {
+          case HEADER_HASH:
             return MatchFieldType::HEADER;
-          }
-          else if (hashCode == METHOD_HASH)
-          {
+          case METHOD_HASH:
             return MatchFieldType::METHOD;
-          }
-          else if (hashCode == BODY_HASH)
-          {
+          case BODY_HASH:
             return MatchFieldType::BODY;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,56 +29,50 @@ namespace Aws
       namespace ParameterExceptionFieldMapper
       {
 
-        static const int CHANGE_ACTION_HASH = HashingUtils::HashString("CHANGE_ACTION");
-        static const int WAF_ACTION_HASH = HashingUtils::HashString("WAF_ACTION");
-        static const int PREDICATE_TYPE_HASH = HashingUtils::HashString("PREDICATE_TYPE");
-        static const int IPSET_TYPE_HASH = HashingUtils::HashString("IPSET_TYPE");
-        static const int BYTE_MATCH_FIELD_TYPE_HASH = HashingUtils::HashString("BYTE_MATCH_FIELD_TYPE");
-        static const int SQL_INJECTION_MATCH_FIELD_TYPE_HASH = HashingUtils::HashString("SQL_INJECTION_MATCH_FIELD_TYPE");
-        static const int BYTE_MATCH_TEXT_TRANSFORMATION_HASH = HashingUtils::HashString("BYTE_MATCH_TEXT_TRANSFORMATION");
-        static const int BYTE_MATCH_POSITIONAL_CONSTRAINT_HASH = HashingUtils::HashString("BYTE_MATCH_POSITIONAL_CONSTRAINT");
-        static const int SIZE_CONSTRAINT_COMPARISON_OPERATOR_HASH = HashingUtils::HashString("SIZE_CONSTRAINT_COMPARISON_OPERATOR");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CHANGE_ACTION_HASH = 93413797;
+        static const int WAF_ACTION_HASH = 639259929;
+        static const int PREDICATE_TYPE_HASH = 1218112738;
+        static const int IPSET_TYPE_HASH = -2095264962;
+        static const int BYTE_MATCH_FIELD_TYPE_HASH = 192984240;
+        static const int SQL_INJECTION_MATCH_FIELD_TYPE_HASH = 1088000530;
+        static const int BYTE_MATCH_TEXT_TRANSFORMATION_HASH = 620243530;
+        static const int BYTE_MATCH_POSITIONAL_CONSTRAINT_HASH = -1792386537;
+        static const int SIZE_CONSTRAINT_COMPARISON_OPERATOR_HASH = -388357450;
 
 
         ParameterExceptionField GetParameterExceptionFieldForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHANGE_ACTION_HASH)
+          switch (hashCode)
           {
+          case CHANGE_ACTION_HASH:
             return ParameterExceptionField::CHANGE_ACTION;
-          }
-          else if (hashCode == WAF_ACTION_HASH)
-          {
+          case WAF_ACTION_HASH:
             return ParameterExceptionField::WAF_ACTION;
-          }
-          else if (hashCode == PREDICATE_TYPE_HASH)
-          {
+          case PREDICATE_TYPE_HASH:
             return ParameterExceptionField::PREDICATE_TYPE;
-          }
-          else if (hashCode == IPSET_TYPE_HASH)
-          {
+          case IPSET_TYPE_HASH:
             return ParameterExceptionField::IPSET_TYPE;
-          }
-          else if (hashCode == BYTE_MATCH_FIELD_TYPE_HASH)
-          {
+          case BYTE_MATCH_FIELD_TYPE_HASH:
             return ParameterExceptionField::BYTE_MATCH_FIELD_TYPE;
-          }
-          else if (hashCode == SQL_INJECTION_MATCH_FIELD_TYPE_HASH)
-          {
+          case SQL_INJECTION_MATCH_FIELD_TYPE_HASH:
             return ParameterExceptionField::SQL_INJECTION_MATCH_FIELD_TYPE;
-          }
-          else if (hashCode == BYTE_MATCH_TEXT_TRANSFORMATION_HASH)
-          {
+          case BYTE_MATCH_TEXT_TRANSFORMATION_HASH:
             return ParameterExceptionField::BYTE_MATCH_TEXT_TRANSFORMATION;
-          }
-          else if (hashCode == BYTE_MATCH_POSITIONAL_CONSTRAINT_HASH)
-          {
+          case BYTE_MATCH_POSITIONAL_CONSTRAINT_HASH:
             return ParameterExceptionField::BYTE_MATCH_POSITIONAL_CONSTRAINT;
-          }
-          else if (hashCode == SIZE_CONSTRAINT_COMPARISON_OPERATOR_HASH)
-          {
+          case SIZE_CONSTRAINT_COMPARISON_OPERATOR_HASH:
             return ParameterExceptionField::SIZE_CONSTRAINT_COMPARISON_OPERATOR;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
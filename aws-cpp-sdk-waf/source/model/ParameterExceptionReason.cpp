@@ -29,21 +29,29 @@ namespace Aws
       namespace ParameterExceptionReasonMapper
       {
 
-        static const int INVALID_OPTION_HASH = HashingUtils::HashString("INVALID_OPTION");
-        static const int ILLEGAL_COMBINATION_HASH = HashingUtils::HashString("ILLEGAL_COMBINATION");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int INVALID_OPTION_HASH = 165153757;
+        static const int ILLEGAL_COMBINATION_HASH = 138705734;
 
 
         ParameterExceptionReason GetParameterExceptionReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INVALID_OPTION_HASH)
+          switch (hashCode)
           {
+          case INVALID_OPTION_HASH:
             return ParameterExceptionReason::INVALID_OPTION;
-          }
-          else if (hashCode == ILLEGAL_COMBINATION_HASH)
-          {
+          case ILLEGAL_COMBINATION_HASH:
             return ParameterExceptionReason::ILLEGAL_COMBINATION;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,36 +29,38 @@ namespace Aws
       namespace PositionalConstraintMapper
       {
 
-        static const int EXACTLY_HASH = HashingUtils::HashString("EXACTLY");
-        static const int STARTS_WITH_HASH = HashingUtils::HashString("STARTS_WITH");
-        static const int ENDS_WITH_HASH = HashingUtils::HashString("ENDS_WITH");
-        static const int CONTAINS_HASH = HashingUtils::HashString("CONTAINS");
-        static const int CONTAINS_WORD_HASH = HashingUtils::HashString("CONTAINS_WORD");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int EXACTLY_HASH = -605282132;
+        static const int STARTS_WITH_HASH = 1213247476;
+        static const int ENDS_WITH_HASH = 1027273133;
+        static const int CONTAINS_HASH = 215180831;
+        static const int CONTAINS_WORD_HASH = 1202064682;
 
 
         PositionalConstraint GetPositionalConstraintForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EXACTLY_HASH)
+          switch (hashCode)
           {
+          case EXACTLY_HASH:
             return PositionalConstraint::EXACTLY;
-          }
-          else if (hashCode == STARTS_WITH_HASH)
-          {
+          case STARTS_WITH_HASH:
             return PositionalConstraint::STARTS_WITH;
-          }
-          else if (hashCode == ENDS_WITH_HASH)
-          {
+          case ENDS_WITH_HASH:
             return PositionalConstraint::ENDS_WITH;
-          }
-          else if (hashCode == CONTAINS_HASH)
-          {
+          case CONTAINS_HASH:
             return PositionalConstraint::CONTAINS;
-          }
-          else if (hashCode == CONTAINS_WORD_HASH)
-          {
+          case CONTAINS_WORD_HASH:
             return PositionalConstraint::CONTAINS_WORD;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
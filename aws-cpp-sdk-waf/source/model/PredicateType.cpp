@@ -29,36 +29,38 @@ namespace Aws
       namespace PredicateTypeMapper
       {
 
-        static const int IPMatch_HASH = HashingUtils::HashString("IPMatch");
-        static const int ByteMatch_HASH = HashingUtils::HashString("ByteMatch");
-        static const int SqlInjectionMatch_HASH = HashingUtils::HashString("SqlInjectionMatch");
-        static const int SizeConstraint_HASH = HashingUtils::HashString("SizeConstraint");
-        static const int XssMatch_HASH = HashingUtils::HashString("XssMatch");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int IPMatch_HASH = -1567260450;
+        static const int ByteMatch_HASH = -64352899;
+        static const int SqlInjectionMatch_HASH = 1712531580;
+        static const int SizeConstraint_HASH = -486387490;
+        static const int XssMatch_HASH = 1098662893;
 
 
         PredicateType GetPredicateTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IPMatch_HASH)
+          switch (hashCode)
           {
+          case IPMatch_HASH:
             return PredicateType::IPMatch;
-          }
-          else if (hashCode == ByteMatch_HASH)
-          {
+          case ByteMatch_HASH:
             return PredicateType::ByteMatch;
-          }
-          else if (hashCode == SqlInjectionMatch_HASH)
-          {
+          case SqlInjectionMatch_HASH:
             return PredicateType::SqlInjectionMatch;
-          }
-          else if (hashCode == SizeConstraint_HASH)
-          {
+          case SizeConstraint_HASH:
             return PredicateType::SizeConstraint;
-          }
-          else if (hashCode == XssMatch_HASH)
-          {
+          case XssMatch_HASH:
             return PredicateType::XssMatch;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,41 +29,41 @@ namespace Aws
       namespace TextTransformationMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int COMPRESS_WHITE_SPACE_HASH = HashingUtils::HashString("COMPRESS_WHITE_SPACE");
-        static const int HTML_ENTITY_DECODE_HASH = HashingUtils::HashString("HTML_ENTITY_DECODE");
-        static const int LOWERCASE_HASH = HashingUtils::HashString("LOWERCASE");
-        static const int CMD_LINE_HASH = HashingUtils::HashString("CMD_LINE");
-        static const int URL_DECODE_HASH = HashingUtils::HashString("URL_DECODE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int NONE_HASH = 2402104;
+        static const int COMPRESS_WHITE_SPACE_HASH = -474317869;
+        static const int HTML_ENTITY_DECODE_HASH = 447029302;
+        static const int LOWERCASE_HASH = -2022879855;
+        static const int CMD_LINE_HASH = -1835631623;
+        static const int URL_DECODE_HASH = -1970474274;
 
 
         TextTransformation GetTextTransformationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          switch (hashCode)
           {
+          case NONE_HASH:
             return TextTransformation::NONE;
-          }
-          else if (hashCode == COMPRESS_WHITE_SPACE_HASH)
-          {
+          case COMPRESS_WHITE_SPACE_HASH:
             return TextTransformation::COMPRESS_WHITE_SPACE;
-          }
-          else if (hashCode == HTML_ENTITY_DECODE_HASH)
-          {
+          case HTML_ENTITY_DECODE_HASH:
             return TextTransformation::HTML_ENTITY_DECODE;
-          }
-          else if (hashCode == LOWERCASE_HASH)
-          {
+          case LOWERCASE_HASH:
             return TextTransformation::LOWERCASE;
-          }
-          else if (hashCode == CMD_LINE_HASH)
-          {
+          case CMD_LINE_HASH:
             return TextTransformation::CMD_LINE;
-          }
-          else if (hashCode == URL_DECODE_HASH)
-          {
+          case URL_DECODE_HASH:
             return TextTransformation::URL_DECODE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
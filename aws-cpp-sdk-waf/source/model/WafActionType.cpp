@@ -29,26 +29,32 @@ namespace Aws
       namespace WafActionTypeMapper
       {
 
-        static const int BLOCK_HASH = HashingUtils::HashString("BLOCK");
-        static const int ALLOW_HASH = HashingUtils::HashString("ALLOW");
-        static const int COUNT_HASH = HashingUtils::HashString("COUNT");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int BLOCK_HASH = 63294573;
+        static const int ALLOW_HASH = 62368553;
+        static const int COUNT_HASH = 64313583;
 
 
         WafActionType GetWafActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLOCK_HASH)
+          switch (hashCode)
           {
+          case BLOCK_HASH:
             return WafActionType::BLOCK;
-          }
-          else if (hashCode == ALLOW_HASH)
-          {
+          case ALLOW_HASH:
             return WafActionType::ALLOW;
-          }
-          else if (hashCode == COUNT_HASH)
-          {
+          case COUNT_HASH:
             return WafActionType::COUNT;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -35,6 +35,9 @@
 #include <aws/workspaces/model/StopWorkspacesResult.h>
 #include <aws/workspaces/model/TerminateWorkspacesResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/client/BatchAccumulator.h>
+#include <aws/core/client/OperationAwaitable.h>
+#include <aws/core/client/Paginator.h>
 #include <aws/core/http/HttpTypes.h>
 #include <future>
 #include <functional>
@@ -191,6 +194,18 @@ namespace Model
          */
         virtual void CreateTagsAsync(const Model::CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTagsCallable(const Model::CreateTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateTagsOutcomeCallable CreateTagsCallable(Model::CreateTagsRequest&& request) const;
+
+        /**
+         * Same as CreateTagsAsync(const Model::CreateTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateTagsAsync(Model::CreateTagsRequest&& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates one or more WorkSpaces.</p> <note> <p>This operation is asynchronous
          * and returns before the WorkSpaces are created.</p> </note>
@@ -213,6 +228,18 @@ namespace Model
          */
         virtual void CreateWorkspacesAsync(const Model::CreateWorkspacesRequest& request, const CreateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateWorkspacesCallable(const Model::CreateWorkspacesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::CreateWorkspacesOutcomeCallable CreateWorkspacesCallable(Model::CreateWorkspacesRequest&& request) const;
+
+        /**
+         * Same as CreateWorkspacesAsync(const Model::CreateWorkspacesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void CreateWorkspacesAsync(Model::CreateWorkspacesRequest&& request, const CreateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes tags from a WorkSpace.</p>
          */
@@ -232,6 +259,18 @@ namespace Model
          */
         virtual void DeleteTagsAsync(const Model::DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTagsCallable(const Model::DeleteTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DeleteTagsOutcomeCallable DeleteTagsCallable(Model::DeleteTagsRequest&& request) const;
+
+        /**
+         * Same as DeleteTagsAsync(const Model::DeleteTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DeleteTagsAsync(Model::DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes tags for a WorkSpace.</p>
          */
@@ -251,6 +290,18 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTagsCallable(const Model::DescribeTagsRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(Model::DescribeTagsRequest&& request) const;
+
+        /**
+         * Same as DescribeTagsAsync(const Model::DescribeTagsRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeTagsAsync(Model::DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains information about the WorkSpace bundles that are available to your
          * account in the specified region.</p> <p>You can filter the results with either
@@ -288,6 +339,18 @@ namespace Model
          */
         virtual void DescribeWorkspaceBundlesAsync(const Model::DescribeWorkspaceBundlesRequest& request, const DescribeWorkspaceBundlesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeWorkspaceBundlesCallable(const Model::DescribeWorkspaceBundlesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeWorkspaceBundlesOutcomeCallable DescribeWorkspaceBundlesCallable(Model::DescribeWorkspaceBundlesRequest&& request) const;
+
+        /**
+         * Same as DescribeWorkspaceBundlesAsync(const Model::DescribeWorkspaceBundlesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeWorkspaceBundlesAsync(Model::DescribeWorkspaceBundlesRequest&& request, const DescribeWorkspaceBundlesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about the AWS Directory Service directories in the
          * region that are registered with Amazon WorkSpaces and are available to your
@@ -322,6 +385,18 @@ namespace Model
          */
         virtual void DescribeWorkspaceDirectoriesAsync(const Model::DescribeWorkspaceDirectoriesRequest& request, const DescribeWorkspaceDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeWorkspaceDirectoriesCallable(const Model::DescribeWorkspaceDirectoriesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeWorkspaceDirectoriesOutcomeCallable DescribeWorkspaceDirectoriesCallable(Model::DescribeWorkspaceDirectoriesRequest&& request) const;
+
+        /**
+         * Same as DescribeWorkspaceDirectoriesAsync(const Model::DescribeWorkspaceDirectoriesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeWorkspaceDirectoriesAsync(Model::DescribeWorkspaceDirectoriesRequest&& request, const DescribeWorkspaceDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains information about the specified WorkSpaces.</p> <p>Only one of the
          * filter parameters, such as <code>BundleId</code>, <code>DirectoryId</code>, or
@@ -359,6 +434,18 @@ namespace Model
          */
         virtual void DescribeWorkspacesAsync(const Model::DescribeWorkspacesRequest& request, const DescribeWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeWorkspacesCallable(const Model::DescribeWorkspacesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeWorkspacesOutcomeCallable DescribeWorkspacesCallable(Model::DescribeWorkspacesRequest&& request) const;
+
+        /**
+         * Same as DescribeWorkspacesAsync(const Model::DescribeWorkspacesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeWorkspacesAsync(Model::DescribeWorkspacesRequest&& request, const DescribeWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the connection status of a specified WorkSpace.</p>
          */
@@ -378,6 +465,18 @@ namespace Model
          */
         virtual void DescribeWorkspacesConnectionStatusAsync(const Model::DescribeWorkspacesConnectionStatusRequest& request, const DescribeWorkspacesConnectionStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeWorkspacesConnectionStatusCallable(const Model::DescribeWorkspacesConnectionStatusRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::DescribeWorkspacesConnectionStatusOutcomeCallable DescribeWorkspacesConnectionStatusCallable(Model::DescribeWorkspacesConnectionStatusRequest&& request) const;
+
+        /**
+         * Same as DescribeWorkspacesConnectionStatusAsync(const Model::DescribeWorkspacesConnectionStatusRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void DescribeWorkspacesConnectionStatusAsync(Model::DescribeWorkspacesConnectionStatusRequest&& request, const DescribeWorkspacesConnectionStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the WorkSpace properties, including the RunningMode and AutoStop
          * time.</p>
@@ -400,6 +499,18 @@ namespace Model
          */
         virtual void ModifyWorkspacePropertiesAsync(const Model::ModifyWorkspacePropertiesRequest& request, const ModifyWorkspacePropertiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyWorkspacePropertiesCallable(const Model::ModifyWorkspacePropertiesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::ModifyWorkspacePropertiesOutcomeCallable ModifyWorkspacePropertiesCallable(Model::ModifyWorkspacePropertiesRequest&& request) const;
+
+        /**
+         * Same as ModifyWorkspacePropertiesAsync(const Model::ModifyWorkspacePropertiesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void ModifyWorkspacePropertiesAsync(Model::ModifyWorkspacePropertiesRequest&& request, const ModifyWorkspacePropertiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Reboots the specified WorkSpaces.</p> <p>To be able to reboot a WorkSpace,
          * the WorkSpace must have a <b>State</b> of <code>AVAILABLE</code>,
@@ -428,6 +539,18 @@ namespace Model
          */
         virtual void RebootWorkspacesAsync(const Model::RebootWorkspacesRequest& request, const RebootWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebootWorkspacesCallable(const Model::RebootWorkspacesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RebootWorkspacesOutcomeCallable RebootWorkspacesCallable(Model::RebootWorkspacesRequest&& request) const;
+
+        /**
+         * Same as RebootWorkspacesAsync(const Model::RebootWorkspacesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RebootWorkspacesAsync(Model::RebootWorkspacesRequest&& request, const RebootWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Rebuilds the specified WorkSpaces.</p> <p>Rebuilding a WorkSpace is a
          * potentially destructive action that can result in the loss of data. Rebuilding a
@@ -483,6 +606,18 @@ namespace Model
          */
         virtual void RebuildWorkspacesAsync(const Model::RebuildWorkspacesRequest& request, const RebuildWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebuildWorkspacesCallable(const Model::RebuildWorkspacesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::RebuildWorkspacesOutcomeCallable RebuildWorkspacesCallable(Model::RebuildWorkspacesRequest&& request) const;
+
+        /**
+         * Same as RebuildWorkspacesAsync(const Model::RebuildWorkspacesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void RebuildWorkspacesAsync(Model::RebuildWorkspacesRequest&& request, const RebuildWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts the specified WorkSpaces. The API only works with WorkSpaces that have
          * RunningMode configured as AutoStop and the State set to “STOPPED.”</p>
@@ -505,6 +640,18 @@ namespace Model
          */
         virtual void StartWorkspacesAsync(const Model::StartWorkspacesRequest& request, const StartWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartWorkspacesCallable(const Model::StartWorkspacesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StartWorkspacesOutcomeCallable StartWorkspacesCallable(Model::StartWorkspacesRequest&& request) const;
+
+        /**
+         * Same as StartWorkspacesAsync(const Model::StartWorkspacesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StartWorkspacesAsync(Model::StartWorkspacesRequest&& request, const StartWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Stops the specified WorkSpaces. The API only works with WorkSpaces that have
          * RunningMode configured as AutoStop and the State set to AVAILABLE, IMPAIRED,
@@ -530,6 +677,18 @@ namespace Model
          */
         virtual void StopWorkspacesAsync(const Model::StopWorkspacesRequest& request, const StopWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopWorkspacesCallable(const Model::StopWorkspacesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::StopWorkspacesOutcomeCallable StopWorkspacesCallable(Model::StopWorkspacesRequest&& request) const;
+
+        /**
+         * Same as StopWorkspacesAsync(const Model::StopWorkspacesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void StopWorkspacesAsync(Model::StopWorkspacesRequest&& request, const StopWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Terminates the specified WorkSpaces.</p> <p>Terminating a WorkSpace is a
          * permanent action and cannot be undone. The user's data is not maintained and
@@ -567,6 +726,110 @@ namespace Model
          */
         virtual void TerminateWorkspacesAsync(const Model::TerminateWorkspacesRequest& request, const TerminateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TerminateWorkspacesCallable(const Model::TerminateWorkspacesRequest&), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual Model::TerminateWorkspacesOutcomeCallable TerminateWorkspacesCallable(Model::TerminateWorkspacesRequest&& request) const;
+
+        /**
+         * Same as TerminateWorkspacesAsync(const Model::TerminateWorkspacesRequest&, ...), but the request is moved into the queued task instead of copied.
+         * Derived clients that override one of the two overloads should override both.
+         */
+        virtual void TerminateWorkspacesAsync(Model::TerminateWorkspacesRequest&& request, const TerminateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+        /**
+         * Pages through DescribeWorkspaceBundles(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<WorkSpacesClient, Model::DescribeWorkspaceBundlesRequest, Model::DescribeWorkspaceBundlesOutcome> DescribeWorkspaceBundlesPaginator(const Model::DescribeWorkspaceBundlesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeWorkspaceDirectories(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<WorkSpacesClient, Model::DescribeWorkspaceDirectoriesRequest, Model::DescribeWorkspaceDirectoriesOutcome> DescribeWorkspaceDirectoriesPaginator(const Model::DescribeWorkspaceDirectoriesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeWorkspaces(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<WorkSpacesClient, Model::DescribeWorkspacesRequest, Model::DescribeWorkspacesOutcome> DescribeWorkspacesPaginator(const Model::DescribeWorkspacesRequest& request, size_t prefetchDepth = 1) const;
+
+        /**
+         * Pages through DescribeWorkspacesConnectionStatus(), following NextToken; up to prefetchDepth pages are requested ahead of the caller on the client executor.
+         */
+        Aws::Client::Paginator<WorkSpacesClient, Model::DescribeWorkspacesConnectionStatusRequest, Model::DescribeWorkspacesConnectionStatusOutcome> DescribeWorkspacesConnectionStatusPaginator(const Model::DescribeWorkspacesConnectionStatusRequest& request, size_t prefetchDepth = 1) const;
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+        /**
+         * co_await-able form of CreateTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WorkSpacesClient, Model::CreateTagsRequest, Model::CreateTagsOutcome> CreateTagsAwaitable(Model::CreateTagsRequest request) const;
+
+        /**
+         * co_await-able form of CreateWorkspaces(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WorkSpacesClient, Model::CreateWorkspacesRequest, Model::CreateWorkspacesOutcome> CreateWorkspacesAwaitable(Model::CreateWorkspacesRequest request) const;
+
+        /**
+         * co_await-able form of DeleteTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WorkSpacesClient, Model::DeleteTagsRequest, Model::DeleteTagsOutcome> DeleteTagsAwaitable(Model::DeleteTagsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeTags(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WorkSpacesClient, Model::DescribeTagsRequest, Model::DescribeTagsOutcome> DescribeTagsAwaitable(Model::DescribeTagsRequest request) const;
+
+        /**
+         * co_await-able form of DescribeWorkspaceBundles(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WorkSpacesClient, Model::DescribeWorkspaceBundlesRequest, Model::DescribeWorkspaceBundlesOutcome> DescribeWorkspaceBundlesAwaitable(Model::DescribeWorkspaceBundlesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeWorkspaceDirectories(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WorkSpacesClient, Model::DescribeWorkspaceDirectoriesRequest, Model::DescribeWorkspaceDirectoriesOutcome> DescribeWorkspaceDirectoriesAwaitable(Model::DescribeWorkspaceDirectoriesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeWorkspaces(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WorkSpacesClient, Model::DescribeWorkspacesRequest, Model::DescribeWorkspacesOutcome> DescribeWorkspacesAwaitable(Model::DescribeWorkspacesRequest request) const;
+
+        /**
+         * co_await-able form of DescribeWorkspacesConnectionStatus(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WorkSpacesClient, Model::DescribeWorkspacesConnectionStatusRequest, Model::DescribeWorkspacesConnectionStatusOutcome> DescribeWorkspacesConnectionStatusAwaitable(Model::DescribeWorkspacesConnectionStatusRequest request) const;
+
+        /**
+         * co_await-able form of ModifyWorkspaceProperties(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WorkSpacesClient, Model::ModifyWorkspacePropertiesRequest, Model::ModifyWorkspacePropertiesOutcome> ModifyWorkspacePropertiesAwaitable(Model::ModifyWorkspacePropertiesRequest request) const;
+
+        /**
+         * co_await-able form of RebootWorkspaces(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WorkSpacesClient, Model::RebootWorkspacesRequest, Model::RebootWorkspacesOutcome> RebootWorkspacesAwaitable(Model::RebootWorkspacesRequest request) const;
+
+        /**
+         * co_await-able form of RebuildWorkspaces(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WorkSpacesClient, Model::RebuildWorkspacesRequest, Model::RebuildWorkspacesOutcome> RebuildWorkspacesAwaitable(Model::RebuildWorkspacesRequest request) const;
+
+        /**
+         * co_await-able form of StartWorkspaces(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WorkSpacesClient, Model::StartWorkspacesRequest, Model::StartWorkspacesOutcome> StartWorkspacesAwaitable(Model::StartWorkspacesRequest request) const;
+
+        /**
+         * co_await-able form of StopWorkspaces(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WorkSpacesClient, Model::StopWorkspacesRequest, Model::StopWorkspacesOutcome> StopWorkspacesAwaitable(Model::StopWorkspacesRequest request) const;
+
+        /**
+         * co_await-able form of TerminateWorkspaces(): the request runs on the client executor and the awaiting coroutine resumes on that thread.
+         */
+        Aws::Client::ClientOperationAwaitable<WorkSpacesClient, Model::TerminateWorkspacesRequest, Model::TerminateWorkspacesOutcome> TerminateWorkspacesAwaitable(Model::TerminateWorkspacesRequest request) const;
+
+#endif // AWS_SDK_ENABLE_COROUTINES
+
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
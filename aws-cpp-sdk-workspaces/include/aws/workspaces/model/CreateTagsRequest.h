@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     CreateTagsRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateTags"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
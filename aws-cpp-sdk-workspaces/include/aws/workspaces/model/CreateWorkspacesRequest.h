@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     CreateWorkspacesRequest();
+    inline const char* GetServiceRequestName() const override { return "CreateWorkspaces"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DeleteTagsRequest();
+    inline const char* GetServiceRequestName() const override { return "DeleteTags"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
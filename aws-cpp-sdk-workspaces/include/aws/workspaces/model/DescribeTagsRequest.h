@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeTagsRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeTags"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeWorkspaceBundlesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeWorkspaceBundles"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
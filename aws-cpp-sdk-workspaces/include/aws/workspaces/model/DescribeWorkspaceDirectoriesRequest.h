@@ -33,6 +33,8 @@ namespace Model
   {
   public:
     DescribeWorkspaceDirectoriesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeWorkspaceDirectories"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
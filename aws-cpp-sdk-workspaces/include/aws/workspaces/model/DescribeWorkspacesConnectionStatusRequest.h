@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     DescribeWorkspacesConnectionStatusRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeWorkspacesConnectionStatus"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     DescribeWorkspacesRequest();
+    inline const char* GetServiceRequestName() const override { return "DescribeWorkspaces"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     ModifyWorkspacePropertiesRequest();
+    inline const char* GetServiceRequestName() const override { return "ModifyWorkspaceProperties"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RebootWorkspacesRequest();
+    inline const char* GetServiceRequestName() const override { return "RebootWorkspaces"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     RebuildWorkspacesRequest();
+    inline const char* GetServiceRequestName() const override { return "RebuildWorkspaces"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
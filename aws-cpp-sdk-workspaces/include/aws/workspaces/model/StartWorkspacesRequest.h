@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     StartWorkspacesRequest();
+    inline const char* GetServiceRequestName() const override { return "StartWorkspaces"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
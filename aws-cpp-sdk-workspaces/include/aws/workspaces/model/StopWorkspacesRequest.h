@@ -31,6 +31,8 @@ namespace Model
   {
   public:
     StopWorkspacesRequest();
+    inline const char* GetServiceRequestName() const override { return "StopWorkspaces"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
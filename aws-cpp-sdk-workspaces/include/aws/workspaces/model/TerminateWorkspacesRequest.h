@@ -32,6 +32,8 @@ namespace Model
   {
   public:
     TerminateWorkspacesRequest();
+    inline const char* GetServiceRequestName() const override { return "TerminateWorkspaces"; }
+
     Aws::String SerializePayload() const override;
 
     Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
@@ -123,7 +123,7 @@ CreateTagsOutcome WorkSpacesClient::CreateTags(const CreateTagsRequest& request)
 
 CreateTagsOutcomeCallable WorkSpacesClient::CreateTagsCallable(const CreateTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateTags(request); } );
 }
 
 void WorkSpacesClient::CreateTagsAsync(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -131,6 +131,16 @@ void WorkSpacesClient::CreateTagsAsync(const CreateTagsRequest& request, const C
   m_executor->Submit( [this, request, handler, context](){ this->CreateTagsAsyncHelper( request, handler, context ); } );
 }
 
+CreateTagsOutcomeCallable WorkSpacesClient::CreateTagsCallable(CreateTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WorkSpacesClient::CreateTags, this, std::move(request)));
+}
+
+void WorkSpacesClient::CreateTagsAsync(CreateTagsRequest&& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WorkSpacesClient::CreateTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WorkSpacesClient::CreateTagsAsyncHelper(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateTags(request), context);
@@ -154,7 +164,7 @@ CreateWorkspacesOutcome WorkSpacesClient::CreateWorkspaces(const CreateWorkspace
 
 CreateWorkspacesOutcomeCallable WorkSpacesClient::CreateWorkspacesCallable(const CreateWorkspacesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->CreateWorkspaces(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->CreateWorkspaces(request); } );
 }
 
 void WorkSpacesClient::CreateWorkspacesAsync(const CreateWorkspacesRequest& request, const CreateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -162,6 +172,16 @@ void WorkSpacesClient::CreateWorkspacesAsync(const CreateWorkspacesRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->CreateWorkspacesAsyncHelper( request, handler, context ); } );
 }
 
+CreateWorkspacesOutcomeCallable WorkSpacesClient::CreateWorkspacesCallable(CreateWorkspacesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WorkSpacesClient::CreateWorkspaces, this, std::move(request)));
+}
+
+void WorkSpacesClient::CreateWorkspacesAsync(CreateWorkspacesRequest&& request, const CreateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WorkSpacesClient::CreateWorkspacesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WorkSpacesClient::CreateWorkspacesAsyncHelper(const CreateWorkspacesRequest& request, const CreateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, CreateWorkspaces(request), context);
@@ -185,7 +205,7 @@ DeleteTagsOutcome WorkSpacesClient::DeleteTags(const DeleteTagsRequest& request)
 
 DeleteTagsOutcomeCallable WorkSpacesClient::DeleteTagsCallable(const DeleteTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DeleteTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DeleteTags(request); } );
 }
 
 void WorkSpacesClient::DeleteTagsAsync(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -193,6 +213,16 @@ void WorkSpacesClient::DeleteTagsAsync(const DeleteTagsRequest& request, const D
   m_executor->Submit( [this, request, handler, context](){ this->DeleteTagsAsyncHelper( request, handler, context ); } );
 }
 
+DeleteTagsOutcomeCallable WorkSpacesClient::DeleteTagsCallable(DeleteTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WorkSpacesClient::DeleteTags, this, std::move(request)));
+}
+
+void WorkSpacesClient::DeleteTagsAsync(DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WorkSpacesClient::DeleteTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WorkSpacesClient::DeleteTagsAsyncHelper(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DeleteTags(request), context);
@@ -216,7 +246,7 @@ DescribeTagsOutcome WorkSpacesClient::DescribeTags(const DescribeTagsRequest& re
 
 DescribeTagsOutcomeCallable WorkSpacesClient::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeTags(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeTags(request); } );
 }
 
 void WorkSpacesClient::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -224,6 +254,16 @@ void WorkSpacesClient::DescribeTagsAsync(const DescribeTagsRequest& request, con
   m_executor->Submit( [this, request, handler, context](){ this->DescribeTagsAsyncHelper( request, handler, context ); } );
 }
 
+DescribeTagsOutcomeCallable WorkSpacesClient::DescribeTagsCallable(DescribeTagsRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WorkSpacesClient::DescribeTags, this, std::move(request)));
+}
+
+void WorkSpacesClient::DescribeTagsAsync(DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WorkSpacesClient::DescribeTagsAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WorkSpacesClient::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeTags(request), context);
@@ -247,7 +287,7 @@ DescribeWorkspaceBundlesOutcome WorkSpacesClient::DescribeWorkspaceBundles(const
 
 DescribeWorkspaceBundlesOutcomeCallable WorkSpacesClient::DescribeWorkspaceBundlesCallable(const DescribeWorkspaceBundlesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeWorkspaceBundles(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeWorkspaceBundles(request); } );
 }
 
 void WorkSpacesClient::DescribeWorkspaceBundlesAsync(const DescribeWorkspaceBundlesRequest& request, const DescribeWorkspaceBundlesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -255,6 +295,16 @@ void WorkSpacesClient::DescribeWorkspaceBundlesAsync(const DescribeWorkspaceBund
   m_executor->Submit( [this, request, handler, context](){ this->DescribeWorkspaceBundlesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeWorkspaceBundlesOutcomeCallable WorkSpacesClient::DescribeWorkspaceBundlesCallable(DescribeWorkspaceBundlesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WorkSpacesClient::DescribeWorkspaceBundles, this, std::move(request)));
+}
+
+void WorkSpacesClient::DescribeWorkspaceBundlesAsync(DescribeWorkspaceBundlesRequest&& request, const DescribeWorkspaceBundlesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WorkSpacesClient::DescribeWorkspaceBundlesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WorkSpacesClient::DescribeWorkspaceBundlesAsyncHelper(const DescribeWorkspaceBundlesRequest& request, const DescribeWorkspaceBundlesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeWorkspaceBundles(request), context);
@@ -278,7 +328,7 @@ DescribeWorkspaceDirectoriesOutcome WorkSpacesClient::DescribeWorkspaceDirectori
 
 DescribeWorkspaceDirectoriesOutcomeCallable WorkSpacesClient::DescribeWorkspaceDirectoriesCallable(const DescribeWorkspaceDirectoriesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeWorkspaceDirectories(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeWorkspaceDirectories(request); } );
 }
 
 void WorkSpacesClient::DescribeWorkspaceDirectoriesAsync(const DescribeWorkspaceDirectoriesRequest& request, const DescribeWorkspaceDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -286,6 +336,16 @@ void WorkSpacesClient::DescribeWorkspaceDirectoriesAsync(const DescribeWorkspace
   m_executor->Submit( [this, request, handler, context](){ this->DescribeWorkspaceDirectoriesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeWorkspaceDirectoriesOutcomeCallable WorkSpacesClient::DescribeWorkspaceDirectoriesCallable(DescribeWorkspaceDirectoriesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WorkSpacesClient::DescribeWorkspaceDirectories, this, std::move(request)));
+}
+
+void WorkSpacesClient::DescribeWorkspaceDirectoriesAsync(DescribeWorkspaceDirectoriesRequest&& request, const DescribeWorkspaceDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WorkSpacesClient::DescribeWorkspaceDirectoriesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WorkSpacesClient::DescribeWorkspaceDirectoriesAsyncHelper(const DescribeWorkspaceDirectoriesRequest& request, const DescribeWorkspaceDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeWorkspaceDirectories(request), context);
@@ -309,7 +369,7 @@ DescribeWorkspacesOutcome WorkSpacesClient::DescribeWorkspaces(const DescribeWor
 
 DescribeWorkspacesOutcomeCallable WorkSpacesClient::DescribeWorkspacesCallable(const DescribeWorkspacesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeWorkspaces(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeWorkspaces(request); } );
 }
 
 void WorkSpacesClient::DescribeWorkspacesAsync(const DescribeWorkspacesRequest& request, const DescribeWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -317,6 +377,16 @@ void WorkSpacesClient::DescribeWorkspacesAsync(const DescribeWorkspacesRequest&
   m_executor->Submit( [this, request, handler, context](){ this->DescribeWorkspacesAsyncHelper( request, handler, context ); } );
 }
 
+DescribeWorkspacesOutcomeCallable WorkSpacesClient::DescribeWorkspacesCallable(DescribeWorkspacesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WorkSpacesClient::DescribeWorkspaces, this, std::move(request)));
+}
+
+void WorkSpacesClient::DescribeWorkspacesAsync(DescribeWorkspacesRequest&& request, const DescribeWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WorkSpacesClient::DescribeWorkspacesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WorkSpacesClient::DescribeWorkspacesAsyncHelper(const DescribeWorkspacesRequest& request, const DescribeWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeWorkspaces(request), context);
@@ -340,7 +410,7 @@ DescribeWorkspacesConnectionStatusOutcome WorkSpacesClient::DescribeWorkspacesCo
 
 DescribeWorkspacesConnectionStatusOutcomeCallable WorkSpacesClient::DescribeWorkspacesConnectionStatusCallable(const DescribeWorkspacesConnectionStatusRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->DescribeWorkspacesConnectionStatus(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->DescribeWorkspacesConnectionStatus(request); } );
 }
 
 void WorkSpacesClient::DescribeWorkspacesConnectionStatusAsync(const DescribeWorkspacesConnectionStatusRequest& request, const DescribeWorkspacesConnectionStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -348,6 +418,16 @@ void WorkSpacesClient::DescribeWorkspacesConnectionStatusAsync(const DescribeWor
   m_executor->Submit( [this, request, handler, context](){ this->DescribeWorkspacesConnectionStatusAsyncHelper( request, handler, context ); } );
 }
 
+DescribeWorkspacesConnectionStatusOutcomeCallable WorkSpacesClient::DescribeWorkspacesConnectionStatusCallable(DescribeWorkspacesConnectionStatusRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WorkSpacesClient::DescribeWorkspacesConnectionStatus, this, std::move(request)));
+}
+
+void WorkSpacesClient::DescribeWorkspacesConnectionStatusAsync(DescribeWorkspacesConnectionStatusRequest&& request, const DescribeWorkspacesConnectionStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WorkSpacesClient::DescribeWorkspacesConnectionStatusAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WorkSpacesClient::DescribeWorkspacesConnectionStatusAsyncHelper(const DescribeWorkspacesConnectionStatusRequest& request, const DescribeWorkspacesConnectionStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, DescribeWorkspacesConnectionStatus(request), context);
@@ -371,7 +451,7 @@ ModifyWorkspacePropertiesOutcome WorkSpacesClient::ModifyWorkspaceProperties(con
 
 ModifyWorkspacePropertiesOutcomeCallable WorkSpacesClient::ModifyWorkspacePropertiesCallable(const ModifyWorkspacePropertiesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->ModifyWorkspaceProperties(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->ModifyWorkspaceProperties(request); } );
 }
 
 void WorkSpacesClient::ModifyWorkspacePropertiesAsync(const ModifyWorkspacePropertiesRequest& request, const ModifyWorkspacePropertiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -379,6 +459,16 @@ void WorkSpacesClient::ModifyWorkspacePropertiesAsync(const ModifyWorkspacePrope
   m_executor->Submit( [this, request, handler, context](){ this->ModifyWorkspacePropertiesAsyncHelper( request, handler, context ); } );
 }
 
+ModifyWorkspacePropertiesOutcomeCallable WorkSpacesClient::ModifyWorkspacePropertiesCallable(ModifyWorkspacePropertiesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WorkSpacesClient::ModifyWorkspaceProperties, this, std::move(request)));
+}
+
+void WorkSpacesClient::ModifyWorkspacePropertiesAsync(ModifyWorkspacePropertiesRequest&& request, const ModifyWorkspacePropertiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WorkSpacesClient::ModifyWorkspacePropertiesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WorkSpacesClient::ModifyWorkspacePropertiesAsyncHelper(const ModifyWorkspacePropertiesRequest& request, const ModifyWorkspacePropertiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, ModifyWorkspaceProperties(request), context);
@@ -402,7 +492,7 @@ RebootWorkspacesOutcome WorkSpacesClient::RebootWorkspaces(const RebootWorkspace
 
 RebootWorkspacesOutcomeCallable WorkSpacesClient::RebootWorkspacesCallable(const RebootWorkspacesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RebootWorkspaces(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RebootWorkspaces(request); } );
 }
 
 void WorkSpacesClient::RebootWorkspacesAsync(const RebootWorkspacesRequest& request, const RebootWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -410,6 +500,16 @@ void WorkSpacesClient::RebootWorkspacesAsync(const RebootWorkspacesRequest& requ
   m_executor->Submit( [this, request, handler, context](){ this->RebootWorkspacesAsyncHelper( request, handler, context ); } );
 }
 
+RebootWorkspacesOutcomeCallable WorkSpacesClient::RebootWorkspacesCallable(RebootWorkspacesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WorkSpacesClient::RebootWorkspaces, this, std::move(request)));
+}
+
+void WorkSpacesClient::RebootWorkspacesAsync(RebootWorkspacesRequest&& request, const RebootWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WorkSpacesClient::RebootWorkspacesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WorkSpacesClient::RebootWorkspacesAsyncHelper(const RebootWorkspacesRequest& request, const RebootWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RebootWorkspaces(request), context);
@@ -433,7 +533,7 @@ RebuildWorkspacesOutcome WorkSpacesClient::RebuildWorkspaces(const RebuildWorksp
 
 RebuildWorkspacesOutcomeCallable WorkSpacesClient::RebuildWorkspacesCallable(const RebuildWorkspacesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->RebuildWorkspaces(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->RebuildWorkspaces(request); } );
 }
 
 void WorkSpacesClient::RebuildWorkspacesAsync(const RebuildWorkspacesRequest& request, const RebuildWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -441,6 +541,16 @@ void WorkSpacesClient::RebuildWorkspacesAsync(const RebuildWorkspacesRequest& re
   m_executor->Submit( [this, request, handler, context](){ this->RebuildWorkspacesAsyncHelper( request, handler, context ); } );
 }
 
+RebuildWorkspacesOutcomeCallable WorkSpacesClient::RebuildWorkspacesCallable(RebuildWorkspacesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WorkSpacesClient::RebuildWorkspaces, this, std::move(request)));
+}
+
+void WorkSpacesClient::RebuildWorkspacesAsync(RebuildWorkspacesRequest&& request, const RebuildWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WorkSpacesClient::RebuildWorkspacesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WorkSpacesClient::RebuildWorkspacesAsyncHelper(const RebuildWorkspacesRequest& request, const RebuildWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, RebuildWorkspaces(request), context);
@@ -464,7 +574,7 @@ StartWorkspacesOutcome WorkSpacesClient::StartWorkspaces(const StartWorkspacesRe
 
 StartWorkspacesOutcomeCallable WorkSpacesClient::StartWorkspacesCallable(const StartWorkspacesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StartWorkspaces(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StartWorkspaces(request); } );
 }
 
 void WorkSpacesClient::StartWorkspacesAsync(const StartWorkspacesRequest& request, const StartWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -472,6 +582,16 @@ void WorkSpacesClient::StartWorkspacesAsync(const StartWorkspacesRequest& reques
   m_executor->Submit( [this, request, handler, context](){ this->StartWorkspacesAsyncHelper( request, handler, context ); } );
 }
 
+StartWorkspacesOutcomeCallable WorkSpacesClient::StartWorkspacesCallable(StartWorkspacesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WorkSpacesClient::StartWorkspaces, this, std::move(request)));
+}
+
+void WorkSpacesClient::StartWorkspacesAsync(StartWorkspacesRequest&& request, const StartWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WorkSpacesClient::StartWorkspacesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WorkSpacesClient::StartWorkspacesAsyncHelper(const StartWorkspacesRequest& request, const StartWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StartWorkspaces(request), context);
@@ -495,7 +615,7 @@ StopWorkspacesOutcome WorkSpacesClient::StopWorkspaces(const StopWorkspacesReque
 
 StopWorkspacesOutcomeCallable WorkSpacesClient::StopWorkspacesCallable(const StopWorkspacesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->StopWorkspaces(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->StopWorkspaces(request); } );
 }
 
 void WorkSpacesClient::StopWorkspacesAsync(const StopWorkspacesRequest& request, const StopWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -503,6 +623,16 @@ void WorkSpacesClient::StopWorkspacesAsync(const StopWorkspacesRequest& request,
   m_executor->Submit( [this, request, handler, context](){ this->StopWorkspacesAsyncHelper( request, handler, context ); } );
 }
 
+StopWorkspacesOutcomeCallable WorkSpacesClient::StopWorkspacesCallable(StopWorkspacesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WorkSpacesClient::StopWorkspaces, this, std::move(request)));
+}
+
+void WorkSpacesClient::StopWorkspacesAsync(StopWorkspacesRequest&& request, const StopWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WorkSpacesClient::StopWorkspacesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WorkSpacesClient::StopWorkspacesAsyncHelper(const StopWorkspacesRequest& request, const StopWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, StopWorkspaces(request), context);
@@ -526,7 +656,7 @@ TerminateWorkspacesOutcome WorkSpacesClient::TerminateWorkspaces(const Terminate
 
 TerminateWorkspacesOutcomeCallable WorkSpacesClient::TerminateWorkspacesCallable(const TerminateWorkspacesRequest& request) const
 {
-  return std::async(std::launch::async, [this, request](){ return this->TerminateWorkspaces(request); } );
+  return m_executor->SubmitCallable([this, request](){ return this->TerminateWorkspaces(request); } );
 }
 
 void WorkSpacesClient::TerminateWorkspacesAsync(const TerminateWorkspacesRequest& request, const TerminateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -534,8 +664,158 @@ void WorkSpacesClient::TerminateWorkspacesAsync(const TerminateWorkspacesRequest
   m_executor->Submit( [this, request, handler, context](){ this->TerminateWorkspacesAsyncHelper( request, handler, context ); } );
 }
 
+TerminateWorkspacesOutcomeCallable WorkSpacesClient::TerminateWorkspacesCallable(TerminateWorkspacesRequest&& request) const
+{
+  return m_executor->SubmitCallable(std::bind(&WorkSpacesClient::TerminateWorkspaces, this, std::move(request)));
+}
+
+void WorkSpacesClient::TerminateWorkspacesAsync(TerminateWorkspacesRequest&& request, const TerminateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->Submit(&WorkSpacesClient::TerminateWorkspacesAsyncHelper, this, std::move(request), handler, context);
+}
+
 void WorkSpacesClient::TerminateWorkspacesAsyncHelper(const TerminateWorkspacesRequest& request, const TerminateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
   handler(this, request, TerminateWorkspaces(request), context);
 }
 
+Paginator<WorkSpacesClient, DescribeWorkspaceBundlesRequest, DescribeWorkspaceBundlesOutcome> WorkSpacesClient::DescribeWorkspaceBundlesPaginator(const DescribeWorkspaceBundlesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<WorkSpacesClient, DescribeWorkspaceBundlesRequest, DescribeWorkspaceBundlesOutcome>(this, &WorkSpacesClient::DescribeWorkspaceBundles, request,
+    [](const DescribeWorkspaceBundlesRequest& current, const DescribeWorkspaceBundlesOutcome& outcome, DescribeWorkspaceBundlesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<WorkSpacesClient, DescribeWorkspaceDirectoriesRequest, DescribeWorkspaceDirectoriesOutcome> WorkSpacesClient::DescribeWorkspaceDirectoriesPaginator(const DescribeWorkspaceDirectoriesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<WorkSpacesClient, DescribeWorkspaceDirectoriesRequest, DescribeWorkspaceDirectoriesOutcome>(this, &WorkSpacesClient::DescribeWorkspaceDirectories, request,
+    [](const DescribeWorkspaceDirectoriesRequest& current, const DescribeWorkspaceDirectoriesOutcome& outcome, DescribeWorkspaceDirectoriesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<WorkSpacesClient, DescribeWorkspacesRequest, DescribeWorkspacesOutcome> WorkSpacesClient::DescribeWorkspacesPaginator(const DescribeWorkspacesRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<WorkSpacesClient, DescribeWorkspacesRequest, DescribeWorkspacesOutcome>(this, &WorkSpacesClient::DescribeWorkspaces, request,
+    [](const DescribeWorkspacesRequest& current, const DescribeWorkspacesOutcome& outcome, DescribeWorkspacesRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+Paginator<WorkSpacesClient, DescribeWorkspacesConnectionStatusRequest, DescribeWorkspacesConnectionStatusOutcome> WorkSpacesClient::DescribeWorkspacesConnectionStatusPaginator(const DescribeWorkspacesConnectionStatusRequest& request, size_t prefetchDepth) const
+{
+  return Paginator<WorkSpacesClient, DescribeWorkspacesConnectionStatusRequest, DescribeWorkspacesConnectionStatusOutcome>(this, &WorkSpacesClient::DescribeWorkspacesConnectionStatus, request,
+    [](const DescribeWorkspacesConnectionStatusRequest& current, const DescribeWorkspacesConnectionStatusOutcome& outcome, DescribeWorkspacesConnectionStatusRequest& next)
+    {
+      const auto& result = outcome.GetResult();
+      auto token = result.GetNextToken();
+      if(token.empty() || token == current.GetNextToken())
+      {
+        return false;
+      }
+      next = current;
+      next.SetNextToken(std::move(token));
+      return true;
+    }, m_executor.get(), prefetchDepth);
+}
+
+#ifdef AWS_SDK_ENABLE_COROUTINES
+ClientOperationAwaitable<WorkSpacesClient, CreateTagsRequest, CreateTagsOutcome> WorkSpacesClient::CreateTagsAwaitable(CreateTagsRequest request) const
+{
+  return { m_executor.get(), { this, &WorkSpacesClient::CreateTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<WorkSpacesClient, CreateWorkspacesRequest, CreateWorkspacesOutcome> WorkSpacesClient::CreateWorkspacesAwaitable(CreateWorkspacesRequest request) const
+{
+  return { m_executor.get(), { this, &WorkSpacesClient::CreateWorkspaces, std::move(request) } };
+}
+
+ClientOperationAwaitable<WorkSpacesClient, DeleteTagsRequest, DeleteTagsOutcome> WorkSpacesClient::DeleteTagsAwaitable(DeleteTagsRequest request) const
+{
+  return { m_executor.get(), { this, &WorkSpacesClient::DeleteTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<WorkSpacesClient, DescribeTagsRequest, DescribeTagsOutcome> WorkSpacesClient::DescribeTagsAwaitable(DescribeTagsRequest request) const
+{
+  return { m_executor.get(), { this, &WorkSpacesClient::DescribeTags, std::move(request) } };
+}
+
+ClientOperationAwaitable<WorkSpacesClient, DescribeWorkspaceBundlesRequest, DescribeWorkspaceBundlesOutcome> WorkSpacesClient::DescribeWorkspaceBundlesAwaitable(DescribeWorkspaceBundlesRequest request) const
+{
+  return { m_executor.get(), { this, &WorkSpacesClient::DescribeWorkspaceBundles, std::move(request) } };
+}
+
+ClientOperationAwaitable<WorkSpacesClient, DescribeWorkspaceDirectoriesRequest, DescribeWorkspaceDirectoriesOutcome> WorkSpacesClient::DescribeWorkspaceDirectoriesAwaitable(DescribeWorkspaceDirectoriesRequest request) const
+{
+  return { m_executor.get(), { this, &WorkSpacesClient::DescribeWorkspaceDirectories, std::move(request) } };
+}
+
+ClientOperationAwaitable<WorkSpacesClient, DescribeWorkspacesRequest, DescribeWorkspacesOutcome> WorkSpacesClient::DescribeWorkspacesAwaitable(DescribeWorkspacesRequest request) const
+{
+  return { m_executor.get(), { this, &WorkSpacesClient::DescribeWorkspaces, std::move(request) } };
+}
+
+ClientOperationAwaitable<WorkSpacesClient, DescribeWorkspacesConnectionStatusRequest, DescribeWorkspacesConnectionStatusOutcome> WorkSpacesClient::DescribeWorkspacesConnectionStatusAwaitable(DescribeWorkspacesConnectionStatusRequest request) const
+{
+  return { m_executor.get(), { this, &WorkSpacesClient::DescribeWorkspacesConnectionStatus, std::move(request) } };
+}
+
+ClientOperationAwaitable<WorkSpacesClient, ModifyWorkspacePropertiesRequest, ModifyWorkspacePropertiesOutcome> WorkSpacesClient::ModifyWorkspacePropertiesAwaitable(ModifyWorkspacePropertiesRequest request) const
+{
+  return { m_executor.get(), { this, &WorkSpacesClient::ModifyWorkspaceProperties, std::move(request) } };
+}
+
+ClientOperationAwaitable<WorkSpacesClient, RebootWorkspacesRequest, RebootWorkspacesOutcome> WorkSpacesClient::RebootWorkspacesAwaitable(RebootWorkspacesRequest request) const
+{
+  return { m_executor.get(), { this, &WorkSpacesClient::RebootWorkspaces, std::move(request) } };
+}
+
+ClientOperationAwaitable<WorkSpacesClient, RebuildWorkspacesRequest, RebuildWorkspacesOutcome> WorkSpacesClient::RebuildWorkspacesAwaitable(RebuildWorkspacesRequest request) const
+{
+  return { m_executor.get(), { this, &WorkSpacesClient::RebuildWorkspaces, std::move(request) } };
+}
+
+ClientOperationAwaitable<WorkSpacesClient, StartWorkspacesRequest, StartWorkspacesOutcome> WorkSpacesClient::StartWorkspacesAwaitable(StartWorkspacesRequest request) const
+{
+  return { m_executor.get(), { this, &WorkSpacesClient::StartWorkspaces, std::move(request) } };
+}
+
+ClientOperationAwaitable<WorkSpacesClient, StopWorkspacesRequest, StopWorkspacesOutcome> WorkSpacesClient::StopWorkspacesAwaitable(StopWorkspacesRequest request) const
+{
+  return { m_executor.get(), { this, &WorkSpacesClient::StopWorkspaces, std::move(request) } };
+}
+
+ClientOperationAwaitable<WorkSpacesClient, TerminateWorkspacesRequest, TerminateWorkspacesOutcome> WorkSpacesClient::TerminateWorkspacesAwaitable(TerminateWorkspacesRequest request) const
+{
+  return { m_executor.get(), { this, &WorkSpacesClient::TerminateWorkspaces, std::move(request) } };
+}
+
+#endif // AWS_SDK_ENABLE_COROUTINES
@@ -29,26 +29,32 @@ namespace Aws
       namespace ComputeMapper
       {
 
-        static const int VALUE_HASH = HashingUtils::HashString("VALUE");
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-        static const int PERFORMANCE_HASH = HashingUtils::HashString("PERFORMANCE");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int VALUE_HASH = 81434961;
+        static const int STANDARD_HASH = 2095255229;
+        static const int PERFORMANCE_HASH = 672572432;
 
 
         Compute GetComputeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VALUE_HASH)
+          switch (hashCode)
           {
+          case VALUE_HASH:
             return Compute::VALUE;
-          }
-          else if (hashCode == STANDARD_HASH)
-          {
+          case STANDARD_HASH:
             return Compute::STANDARD;
-          }
-          else if (hashCode == PERFORMANCE_HASH)
-          {
+          case PERFORMANCE_HASH:
             return Compute::PERFORMANCE;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,26 +29,32 @@ namespace Aws
       namespace ConnectionStateMapper
       {
 
-        static const int CONNECTED_HASH = HashingUtils::HashString("CONNECTED");
-        static const int DISCONNECTED_HASH = HashingUtils::HashString("DISCONNECTED");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int CONNECTED_HASH = -2087582999;
+        static const int DISCONNECTED_HASH = 935892539;
+        static const int UNKNOWN_HASH = 433141802;
 
 
         ConnectionState GetConnectionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONNECTED_HASH)
+          switch (hashCode)
           {
+          case CONNECTED_HASH:
             return ConnectionState::CONNECTED;
-          }
-          else if (hashCode == DISCONNECTED_HASH)
-          {
+          case DISCONNECTED_HASH:
             return ConnectionState::DISCONNECTED;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
+          case UNKNOWN_HASH:
             return ConnectionState::UNKNOWN;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
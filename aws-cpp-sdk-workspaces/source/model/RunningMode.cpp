@@ -29,21 +29,29 @@ namespace Aws
       namespace RunningModeMapper
       {
 
-        static const int AUTO_STOP_HASH = HashingUtils::HashString("AUTO_STOP");
-        static const int ALWAYS_ON_HASH = HashingUtils::HashString("ALWAYS_ON");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int AUTO_STOP_HASH = 182458514;
+        static const int ALWAYS_ON_HASH = -361760241;
 
 
         RunningMode GetRunningModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_STOP_HASH)
+          switch (hashCode)
           {
+          case AUTO_STOP_HASH:
             return RunningMode::AUTO_STOP;
-          }
-          else if (hashCode == ALWAYS_ON_HASH)
-          {
+          case ALWAYS_ON_HASH:
             return RunningMode::ALWAYS_ON;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,36 +29,38 @@ namespace Aws
       namespace WorkspaceDirectoryStateMapper
       {
 
-        static const int REGISTERING_HASH = HashingUtils::HashString("REGISTERING");
-        static const int REGISTERED_HASH = HashingUtils::HashString("REGISTERED");
-        static const int DEREGISTERING_HASH = HashingUtils::HashString("DEREGISTERING");
-        static const int DEREGISTERED_HASH = HashingUtils::HashString("DEREGISTERED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int REGISTERING_HASH = 19682879;
+        static const int REGISTERED_HASH = -1384838526;
+        static const int DEREGISTERING_HASH = 1859887902;
+        static const int DEREGISTERED_HASH = -632740413;
+        static const int ERROR__HASH = 66247144;
 
 
         WorkspaceDirectoryState GetWorkspaceDirectoryStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGISTERING_HASH)
+          switch (hashCode)
           {
+          case REGISTERING_HASH:
             return WorkspaceDirectoryState::REGISTERING;
-          }
-          else if (hashCode == REGISTERED_HASH)
-          {
+          case REGISTERED_HASH:
             return WorkspaceDirectoryState::REGISTERED;
-          }
-          else if (hashCode == DEREGISTERING_HASH)
-          {
+          case DEREGISTERING_HASH:
             return WorkspaceDirectoryState::DEREGISTERING;
-          }
-          else if (hashCode == DEREGISTERED_HASH)
-          {
+          case DEREGISTERED_HASH:
             return WorkspaceDirectoryState::DEREGISTERED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
+          case ERROR__HASH:
             return WorkspaceDirectoryState::ERROR_;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,21 +29,29 @@ namespace Aws
       namespace WorkspaceDirectoryTypeMapper
       {
 
-        static const int SIMPLE_AD_HASH = HashingUtils::HashString("SIMPLE_AD");
-        static const int AD_CONNECTOR_HASH = HashingUtils::HashString("AD_CONNECTOR");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int SIMPLE_AD_HASH = 662245840;
+        static const int AD_CONNECTOR_HASH = -1414695151;
 
 
         WorkspaceDirectoryType GetWorkspaceDirectoryTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SIMPLE_AD_HASH)
+          switch (hashCode)
           {
+          case SIMPLE_AD_HASH:
             return WorkspaceDirectoryType::SIMPLE_AD;
-          }
-          else if (hashCode == AD_CONNECTOR_HASH)
-          {
+          case AD_CONNECTOR_HASH:
             return WorkspaceDirectoryType::AD_CONNECTOR;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -29,81 +29,65 @@ namespace Aws
       namespace WorkspaceStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int IMPAIRED_HASH = HashingUtils::HashString("IMPAIRED");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
-        static const int REBOOTING_HASH = HashingUtils::HashString("REBOOTING");
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int REBUILDING_HASH = HashingUtils::HashString("REBUILDING");
-        static const int MAINTENANCE_HASH = HashingUtils::HashString("MAINTENANCE");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int SUSPENDED_HASH = HashingUtils::HashString("SUSPENDED");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
+        /*
+        The hashes below are precomputed by the generator and match HashingUtils::HashString(),
+        so they are compile time constants the switch statements can use as case labels and the
+        compiler can turn into a jump table or binary search. The generator rejects members whose
+        hashes collide.
+        */
+        static const int PENDING_HASH = 35394935;
+        static const int AVAILABLE_HASH = 2052692649;
+        static const int IMPAIRED_HASH = 347058973;
+        static const int UNHEALTHY_HASH = 998988996;
+        static const int REBOOTING_HASH = -1404612099;
+        static const int STARTING_HASH = 2099433536;
+        static const int REBUILDING_HASH = 257436135;
+        static const int MAINTENANCE_HASH = -1824356621;
+        static const int TERMINATING_HASH = 234379966;
+        static const int TERMINATED_HASH = -823723485;
+        static const int SUSPENDED_HASH = 1124965819;
+        static const int STOPPING_HASH = -1796691852;
+        static const int STOPPED_HASH = -1166336595;
+        static const int ERROR__HASH = 66247144;
 
 
         WorkspaceState GetWorkspaceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          switch (hashCode)
           {
+          case PENDING_HASH:
             return WorkspaceState::PENDING;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
+          case AVAILABLE_HASH:
             return WorkspaceState::AVAILABLE;
-          }
-          else if (hashCode == IMPAIRED_HASH)
-          {
+          case IMPAIRED_HASH:
             return WorkspaceState::IMPAIRED;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
-          {
+          case UNHEALTHY_HASH:
             return WorkspaceState::UNHEALTHY;
-          }
-          else if (hashCode == REBOOTING_HASH)
-          {
+          case REBOOTING_HASH:
             return WorkspaceState::REBOOTING;
-          }
-          else if (hashCode == STARTING_HASH)
-          {
+          case STARTING_HASH:
             return WorkspaceState::STARTING;
-          }
-          else if (hashCode == REBUILDING_HASH)
-          {
+          case REBUILDING_HASH:
             return WorkspaceState::REBUILDING;
-          }
-          else if (hashCode == MAINTENANCE_HASH)
-          {
+          case MAINTENANCE_HASH:
             return WorkspaceState::MAINTENANCE;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
+          case TERMINATING_HASH:
             return WorkspaceState::TERMINATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
+          case TERMINATED_HASH:
             return WorkspaceState::TERMINATED;
-          }
-          else if (hashCode == SUSPENDED_HASH)
-          {
+          case SUSPENDED_HASH:
             return WorkspaceState::SUSPENDED;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
+          case STOPPING_HASH:
             return WorkspaceState::STOPPING;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
+          case STOPPED_HASH:
             return WorkspaceState::STOPPED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
+          case ERROR__HASH:
             return WorkspaceState::ERROR_;
+          default:
+            break;
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
@@ -0,0 +1,167 @@
+/*
+* Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+package com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration;
+
+import lombok.Data;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+/**
+ * Describes a batch operation that clients offer a BatchAccumulator for: where its entries go, the service limits on one
+ * call, and how the result reports the entries that were not processed.
+ */
+@Data
+public class BatchOperation {
+    /** Failed entries are listed by the id the caller gave them (SQS). */
+    public static final String FAILED_BY_ID = "FailedById";
+    /** Result entries line up with the request entries and carry an error code on failure (Kinesis, Firehose). */
+    public static final String ERROR_CODE_BY_POSITION = "ErrorCodeByPosition";
+    /** Unprocessed entries are handed back per table (DynamoDB). */
+    public static final String UNPROCESSED_ITEMS = "UnprocessedItems";
+
+    // keyed by endpoint prefix and operation name; the limits are the documented per-call service limits.
+    private static final Map<String, BatchOperation> BATCH_OPERATIONS = new HashMap<>();
+
+    static {
+        register("sqs", "SendMessageBatch", "Entries", 10, 262144, FAILED_BY_ID, "Failed", Arrays.asList("MessageBody", "MessageAttributes"));
+        register("sqs", "DeleteMessageBatch", "Entries", 10, 0, FAILED_BY_ID, "Failed", Collections.<String>emptyList());
+        register("sqs", "ChangeMessageVisibilityBatch", "Entries", 10, 0, FAILED_BY_ID, "Failed", Collections.<String>emptyList());
+        register("kinesis", "PutRecords", "Records", 500, 5242880, ERROR_CODE_BY_POSITION, "Records", Arrays.asList("Data", "PartitionKey"));
+        register("firehose", "PutRecordBatch", "Records", 500, 4194304, ERROR_CODE_BY_POSITION, "RequestResponses", Collections.singletonList("Data"));
+        register("dynamodb", "BatchWriteItem", "RequestItems", 25, 16777216, UNPROCESSED_ITEMS, "UnprocessedItems", Collections.<String>emptyList());
+    }
+
+    private String entriesMember;
+    private int maxEntries;
+    private int maxBytes;
+    private String failureStyle;
+    private String failuresMember;
+    /**
+     * String, blob and map members of an entry whose sizes add up to its size; without any, entries under a byte limit count their
+     * serialized JSON. A map item counts its key and the string and blob members of its value.
+     */
+    private List<String> sizeMembers;
+    private Shape entryShape;
+
+    private static void register(String endpointPrefix, String operationName, String entriesMember, int maxEntries, int maxBytes,
+                                 String failureStyle, String failuresMember, List<String> sizeMembers) {
+        BatchOperation batchOperation = new BatchOperation();
+        batchOperation.setEntriesMember(entriesMember);
+        batchOperation.setMaxEntries(maxEntries);
+        batchOperation.setMaxBytes(maxBytes);
+        batchOperation.setFailureStyle(failureStyle);
+        batchOperation.setFailuresMember(failuresMember);
+        batchOperation.setSizeMembers(sizeMembers);
+        BATCH_OPERATIONS.put(endpointPrefix + ":" + operationName, batchOperation);
+    }
+
+    public static BatchOperation fromOperation(final String endpointPrefix, final Operation operation) {
+        BatchOperation registered = BATCH_OPERATIONS.get(endpointPrefix + ":" + operation.getName());
+        if (registered == null || operation.getRequest() == null || operation.getResult() == null) {
+            return null;
+        }
+
+        ShapeMember entries = operation.getRequest().getShape().getMembers().get(registered.getEntriesMember());
+        if (entries == null) {
+            return null;
+        }
+
+        // entries are either a list, or a map of lists keyed by table
+        Shape entriesShape = entries.getShape();
+        if (entriesShape.isMap()) {
+            entriesShape = entriesShape.getMapValue().getShape();
+        }
+        if (!entriesShape.isList()) {
+            return null;
+        }
+
+        BatchOperation batchOperation = new BatchOperation();
+        batchOperation.setEntriesMember(registered.getEntriesMember());
+        batchOperation.setMaxEntries(registered.getMaxEntries());
+        batchOperation.setMaxBytes(registered.getMaxBytes());
+        batchOperation.setFailureStyle(registered.getFailureStyle());
+        batchOperation.setFailuresMember(registered.getFailuresMember());
+        batchOperation.setSizeMembers(registered.getSizeMembers());
+        batchOperation.setEntryShape(entriesShape.getListMember().getShape());
+        return batchOperation;
+    }
+
+    public String getEntryType() {
+        return entryShape.getName();
+    }
+
+    /**
+     * C++ expression for the size of an entry named entry, or null if entries are not counted against a byte limit. Map
+     * members are not part of it; see getSizeMapMembers().
+     */
+    public String getSizeExpression() {
+        if (sizeMembers.isEmpty()) {
+            return maxBytes > 0 ? "entry.Jsonize().WriteCompact().size()" : null;
+        }
+
+        List<String> terms = new ArrayList<>();
+        for (String member : sizeMembers) {
+            Shape memberShape = entryShape.getMembers().get(member).getShape();
+            if (!memberShape.isMap()) {
+                terms.add(sizeOf("entry.Get" + member + "()", memberShape));
+            }
+        }
+        return terms.isEmpty() ? "static_cast<size_t>(0)" : String.join(" + ", terms);
+    }
+
+    /**
+     * Map members among the size members, whose items are added up one by one.
+     */
+    public List<String> getSizeMapMembers() {
+        List<String> mapMembers = new ArrayList<>();
+        for (String member : sizeMembers) {
+            if (entryShape.getMembers().get(member).getShape().isMap()) {
+                mapMembers.add(member);
+            }
+        }
+        return mapMembers;
+    }
+
+    /**
+     * C++ expression for the size of an item, named item, of the given map member.
+     */
+    public String getSizeMapItemExpression(String member) {
+        Shape mapShape = entryShape.getMembers().get(member).getShape();
+        List<String> terms = new ArrayList<>();
+        terms.add(sizeOf("item.first", mapShape.getMapKey().getShape()));
+        Shape valueShape = mapShape.getMapValue().getShape();
+        if (valueShape.isStructure()) {
+            for (Map.Entry<String, ShapeMember> valueMember : valueShape.getMembers().entrySet()) {
+                Shape valueMemberShape = valueMember.getValue().getShape();
+                if (valueMemberShape.isString() || valueMemberShape.isBlob()) {
+                    terms.add(sizeOf("item.second.Get" + valueMember.getKey() + "()", valueMemberShape));
+                }
+            }
+        } else {
+            terms.add(sizeOf("item.second", valueShape));
+        }
+        return String.join(" + ", terms);
+    }
+
+    private static String sizeOf(String expression, Shape shape) {
+        return expression + (shape.isBlob() ? ".GetLength()" : ".size()");
+    }
+}
@@ -27,4 +27,16 @@ public class Operation {
     private ShapeMember result;
     private List<Error> errors;
     private String documentation;
+
+    public Pagination getPagination() {
+        return Pagination.fromOperation(this);
+    }
+
+    public BatchOperation getBatching(String endpointPrefix) {
+        return BatchOperation.fromOperation(endpointPrefix, this);
+    }
+
+    public PreparedOperation getPrepared(String endpointPrefix) {
+        return PreparedOperation.fromOperation(endpointPrefix, this);
+    }
 }
@@ -0,0 +1,115 @@
+/*
+* Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+package com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration;
+
+import lombok.Data;
+
+import java.util.Map;
+
+/**
+ * How to page through an operation: which request member takes the token that the result hands back for the next page.
+ * The models carry no pagination metadata, so this is inferred from the token members services use.
+ */
+@Data
+public class Pagination {
+    // request member, result member; the first pair an operation has both of wins.
+    private static final String[][] TOKEN_PAIRS = {
+            {"NextToken", "NextToken"},
+            {"ContinuationToken", "NextContinuationToken"},
+            {"ExclusiveStartKey", "LastEvaluatedKey"},
+            {"ExclusiveStartTableName", "LastEvaluatedTableName"},
+            {"Marker", "NextMarker"},
+            {"Marker", "NextPageMarker"},
+            {"Marker", "Marker"},
+            {"NextMarker", "NextMarker"},
+            {"PageToken", "NextPageToken"},
+            {"NextPageToken", "NextPageToken"},
+            {"Position", "Position"},
+            {"PaginationToken", "PaginationToken"}
+    };
+
+    private static final String[] TRUNCATION_FLAGS = {"IsTruncated", "Truncated"};
+
+    private String inputToken;
+    private String outputToken;
+    private String truncationFlag;
+    private boolean mapToken;
+    private boolean lastKeyFallback;
+
+    public static Pagination fromOperation(final Operation operation) {
+        if (operation.getRequest() == null || operation.getResult() == null) {
+            return null;
+        }
+
+        Map<String, ShapeMember> inputs = operation.getRequest().getShape().getMembers();
+        Map<String, ShapeMember> outputs = operation.getResult().getShape().getMembers();
+        if (inputs == null || outputs == null) {
+            return null;
+        }
+
+        for (String[] pair : TOKEN_PAIRS) {
+            String input = findMember(inputs, pair[0]);
+            String output = findMember(outputs, pair[1]);
+            if (input == null || output == null) {
+                continue;
+            }
+
+            Shape inputShape = inputs.get(input).getShape();
+            Shape outputShape = outputs.get(output).getShape();
+            if (!(inputShape.isString() && outputShape.isString()) && !(inputShape.isMap() && outputShape.isMap())) {
+                continue;
+            }
+
+            Pagination pagination = new Pagination();
+            pagination.setInputToken(capitalize(input));
+            pagination.setOutputToken(capitalize(output));
+            pagination.setMapToken(outputShape.isMap());
+            for (String flag : TRUNCATION_FLAGS) {
+                String flagMember = findMember(outputs, flag);
+                if (flagMember != null && "boolean".equals(outputs.get(flagMember).getShape().getType())) {
+                    pagination.setTruncationFlag(capitalize(flagMember));
+                    break;
+                }
+            }
+
+            // S3 ListObjects only returns NextMarker when a delimiter is used; otherwise the last key is the marker.
+            String contents = findMember(outputs, "Contents");
+            pagination.setLastKeyFallback(pagination.getTruncationFlag() != null && "NextMarker".equals(pagination.getOutputToken())
+                    && contents != null && outputs.get(contents).getShape().isList()
+                    && findMember(outputs.get(contents).getShape().getListMember().getShape().getMembers(), "Key") != null);
+            return pagination;
+        }
+
+        return null;
+    }
+
+    private static String findMember(final Map<String, ShapeMember> members, final String name) {
+        if (members == null) {
+            return null;
+        }
+
+        for (String member : members.keySet()) {
+            if (capitalize(member).equals(name)) {
+                return member;
+            }
+        }
+        return null;
+    }
+
+    private static String capitalize(final String name) {
+        return name.isEmpty() ? name : name.substring(0, 1).toUpperCase() + name.substring(1);
+    }
+}
@@ -0,0 +1,83 @@
+/*
+* Copyright 2010-2015 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+package com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration;
+
+import com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration.cpp.CppViewHelper;
+import lombok.Data;
+
+import java.util.HashMap;
+import java.util.Map;
+
+/**
+ * Describes a JSON operation that clients offer a prepared form of: Prepare&lt;Operation&gt;() freezes everything in a
+ * template request except one top level member, and &lt;Operation&gt;Prepared() takes just that member.
+ */
+@Data
+public class PreparedOperation {
+    // keyed by endpoint prefix and operation name; the value is the member supplied on each call.
+    private static final Map<String, String> PREPARED_MEMBERS = new HashMap<>();
+
+    static {
+        PREPARED_MEMBERS.put("dynamodb:GetItem", "Key");
+        PREPARED_MEMBERS.put("dynamodb:DeleteItem", "Key");
+        PREPARED_MEMBERS.put("dynamodb:PutItem", "Item");
+    }
+
+    private String memberName;
+    private Shape memberShape;
+
+    public static PreparedOperation fromOperation(final String endpointPrefix, final Operation operation) {
+        String memberName = PREPARED_MEMBERS.get(endpointPrefix + ":" + operation.getName());
+        if (memberName == null || operation.getRequest() == null || operation.getResult() == null) {
+            return null;
+        }
+
+        ShapeMember member = operation.getRequest().getShape().getMembers().get(memberName);
+        if (member == null) {
+            return null;
+        }
+
+        // the generated <Operation>Prepared() serializes the member itself, which it knows how to do for structures and maps of them
+        Shape memberShape = member.getShape();
+        if (!memberShape.isStructure() && !(memberShape.isMap() && memberShape.getMapValue().getShape().isStructure())) {
+            return null;
+        }
+
+        PreparedOperation preparedOperation = new PreparedOperation();
+        preparedOperation.setMemberName(memberName);
+        preparedOperation.setMemberShape(memberShape);
+        return preparedOperation;
+    }
+
+    /**
+     * C++ type of the member, with model types qualified so it can be used inside the client class declaration.
+     */
+    public String getMemberType() {
+        if (memberShape.isMap()) {
+            return String.format("Aws::Map<%s, Model::%s>", CppViewHelper.computeCppType(memberShape.getMapKey().getShape()),
+                    memberShape.getMapValue().getShape().getName());
+        }
+        return "Model::" + memberShape.getName();
+    }
+
+    public String getParameterName() {
+        return CppViewHelper.computeVariableName(memberName);
+    }
+
+    public boolean isMap() {
+        return memberShape.isMap();
+    }
+}
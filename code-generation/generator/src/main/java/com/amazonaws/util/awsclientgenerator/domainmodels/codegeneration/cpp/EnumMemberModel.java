@@ -19,10 +19,32 @@ import lombok.AllArgsConstructor;
 import lombok.Data;
 import lombok.NoArgsConstructor;
 
+import java.nio.charset.StandardCharsets;
+
 @Data
 @AllArgsConstructor
 @NoArgsConstructor
 public class EnumMemberModel {
     private String memberName;
     private String memberStringValue;
+
+    /**
+     * Same value Aws::Utils::HashingUtils::HashString() computes for memberStringValue at runtime, so the
+     * mapper can switch on it as a compile time constant instead of hashing every name at static init.
+     */
+    public int getMemberHash() {
+        int hash = 0;
+        for (byte charValue : memberStringValue.getBytes(StandardCharsets.UTF_8)) {
+            hash = charValue + 31 * hash;
+        }
+        return hash;
+    }
+
+    /**
+     * getMemberHash() as a C++ int literal; INT_MIN has no literal of type int.
+     */
+    public String getMemberHashLiteral() {
+        int hash = getMemberHash();
+        return hash == Integer.MIN_VALUE ? "(-2147483647 - 1)" : Integer.toString(hash);
+    }
 }
@@ -19,7 +19,9 @@ import lombok.Data;
 
 import java.util.ArrayList;
 import java.util.Collection;
+import java.util.HashMap;
 import java.util.List;
+import java.util.Map;
 
 @Data
 public class EnumModel {
@@ -32,6 +34,15 @@ public class EnumModel {
         for (String enumMember : enumMembers) {
            members.add(new EnumMemberModel(PlatformAndKeywordSanitizer.fixEnumValue(enumMember), enumMember));
         }
+
+        Map<Integer, String> valuesByHash = new HashMap<>();
+        for (EnumMemberModel member : members) {
+            String collidingValue = valuesByHash.put(member.getMemberHash(), member.getMemberStringValue());
+            if (collidingValue != null) {
+                throw new IllegalArgumentException(String.format("Enum %s members %s and %s hash to the same value; the mapper switch cannot tell them apart.",
+                        enumName, collidingValue, member.getMemberStringValue()));
+            }
+        }
     }
 
 }